@@ -0,0 +1,896 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <math.h>
+
+#define NOB_IMPLEMENTATION
+#define NOB_STRIP_PREFIX
+#include "nob.h"
+
+#define OLIVEC_IMPLEMENTATION
+#define OLIVEC_TILED
+#include "olive.c"
+
+#define BACKGROUND_COLOR 0xFF202020
+#define FOREGROUND_COLOR 0xFF2020FF
+#define TRANSPARENT_COLOR 0x802020FF
+
+#define SPRITE_SIZE 64
+#define DEFAULT_BUDGET_MS 50
+#define DEFAULT_THRESHOLD 10.0
+#define REPEATS 3
+#define SCENE_SHAPES 64
+#define TILE_SIZE 64
+#define TILED_THREADS 3
+
+typedef struct {
+    size_t width, height;
+} Canvas_Size;
+
+static Canvas_Size canvas_sizes[] = {
+    {256, 256},
+    {1280, 720},
+    {1920, 1080},
+};
+#define CANVAS_SIZES_COUNT (sizeof(canvas_sizes)/sizeof(canvas_sizes[0]))
+
+// Shape sizes are interpreted by each benchmark case as "the extent of the shape in pixels".
+static size_t shape_sizes[] = {8, 64, 512};
+#define SHAPE_SIZES_COUNT (sizeof(shape_sizes)/sizeof(shape_sizes[0]))
+
+static uint32_t sprite_pixels[SPRITE_SIZE*SPRITE_SIZE];
+static Olivec_Canvas sprite = {0};
+
+static void init_sprite(void)
+{
+    sprite = olivec_canvas(sprite_pixels, SPRITE_SIZE, SPRITE_SIZE, SPRITE_SIZE);
+    for (size_t y = 0; y < sprite.height; ++y) {
+        for (size_t x = 0; x < sprite.width; ++x) {
+            uint32_t a = (x + y)%3 == 0 ? 0x00 : (x*y)%2 == 0 ? 0xFF : 0x80;
+            OLIVEC_PIXEL(sprite, x, y) = OLIVEC_RGBA(x*4, y*4, (x + y)*2, a);
+        }
+    }
+}
+
+static size_t min_size(size_t a, size_t b)
+{
+    if (a < b) return a;
+    return b;
+}
+
+// Amount of pixels of the w x h rectangle centered in the canvas that are inside of the canvas
+static size_t clipped_area(Olivec_Canvas oc, size_t w, size_t h)
+{
+    return min_size(w, oc.width)*min_size(h, oc.height);
+}
+
+// Every draw function renders one instance of the primitive centered in the canvas and returns
+// the nominal amount of pixels it covers. That amount is used to compute the Mpixels/s metric.
+static size_t draw_fill(Olivec_Canvas oc, int size)
+{
+    UNUSED(size);
+    olivec_fill(oc, BACKGROUND_COLOR);
+    return oc.width*oc.height;
+}
+
+static size_t draw_rect(Olivec_Canvas oc, int size)
+{
+    olivec_rect(oc, oc.width/2 - size/2, oc.height/2 - size/2, size, size, FOREGROUND_COLOR);
+    return clipped_area(oc, size, size);
+}
+
+static size_t draw_rect_blend(Olivec_Canvas oc, int size)
+{
+    olivec_rect(oc, oc.width/2 - size/2, oc.height/2 - size/2, size, size, TRANSPARENT_COLOR);
+    return clipped_area(oc, size, size);
+}
+
+static size_t draw_frame(Olivec_Canvas oc, int size)
+{
+    olivec_frame(oc, oc.width/2 - size/2, oc.height/2 - size/2, size, size, 3, FOREGROUND_COLOR);
+    return 4*3*min_size(size, oc.height);
+}
+
+static size_t draw_circle(Olivec_Canvas oc, int size)
+{
+    olivec_circle(oc, oc.width/2, oc.height/2, size/2, FOREGROUND_COLOR);
+    return clipped_area(oc, size, size)*355/452;
+}
+
+static size_t draw_ellipse(Olivec_Canvas oc, int size)
+{
+    olivec_ellipse(oc, oc.width/2, oc.height/2, size/2, size/4, FOREGROUND_COLOR);
+    return clipped_area(oc, size, size/2)*355/452;
+}
+
+static size_t draw_line(Olivec_Canvas oc, int size)
+{
+    int x = oc.width/2 - size/2;
+    int y = oc.height/2 - size/3;
+    olivec_line(oc, x, y, x + size, y + size*2/3, FOREGROUND_COLOR);
+    return size;
+}
+
+// 1px anti-aliased diagonal of the whole canvas. Its cost should follow the length, not the
+// area of the bounding box.
+static size_t draw_line_aa(Olivec_Canvas oc, int size)
+{
+    UNUSED(size);
+    Olivec_Stroke stroke = {
+        .thickness = 1.0f,
+        .cap = OLIVEC_CAP_BUTT,
+        .join = OLIVEC_JOIN_ROUND,
+    };
+    olivec_line_aa(oc, 0, 0, oc.width - 1, oc.height - 1, stroke, FOREGROUND_COLOR);
+    return sqrtf((float) oc.width*oc.width + (float) oc.height*oc.height);
+}
+
+#define WIREFRAME_SEGMENTS 1000
+
+// Segments of the given length scattered over an area three times the canvas in each direction,
+// so most of them are completely or partially outside of the canvas
+static size_t draw_lines(Olivec_Canvas oc, int size)
+{
+    static Olivec_Segment segments[WIREFRAME_SEGMENTS];
+    int w = oc.width, h = oc.height;
+    for (int i = 0; i < WIREFRAME_SEGMENTS; ++i) {
+        int x = (i*7919)%(3*w) - w;
+        int y = (i*104729)%(3*h) - h;
+        segments[i] = (Olivec_Segment) {x, y, x + size*(i%3 - 1), y + size*((i/3)%3 - 1)};
+    }
+    olivec_lines(oc, segments, WIREFRAME_SEGMENTS, FOREGROUND_COLOR);
+    return WIREFRAME_SEGMENTS*size;
+}
+
+#define CHART_SEGMENTS 100000
+
+// Time series chart spanning the whole width of the canvas. size is the amplitude of the signal.
+static size_t draw_polyline_aa(Olivec_Canvas oc, int size)
+{
+    static Olivec_Point points[CHART_SEGMENTS + 1];
+    static size_t points_width = 0, points_height = 0;
+    static int points_size = 0;
+    if (points_width != oc.width || points_height != oc.height || points_size != size) {
+        for (size_t i = 0; i <= CHART_SEGMENTS; ++i) {
+            float t = (float) i/CHART_SEGMENTS;
+            points[i].x = t*(oc.width - 1);
+            points[i].y = oc.height/2 + size/2*(sinf(t*37.0f)*0.7f + sinf(t*1013.0f)*0.3f);
+        }
+        points_width = oc.width;
+        points_height = oc.height;
+        points_size = size;
+    }
+    Olivec_Stroke stroke = {
+        .thickness = 1.5f,
+        .cap = OLIVEC_CAP_BUTT,
+        .join = OLIVEC_JOIN_ROUND,
+    };
+    olivec_polyline_aa(oc, points, CHART_SEGMENTS + 1, stroke, FOREGROUND_COLOR);
+    return CHART_SEGMENTS;
+}
+
+static size_t draw_triangle(Olivec_Canvas oc, int size)
+{
+    int x = oc.width/2 - size/2;
+    int y = oc.height/2 - size/2;
+    olivec_triangle(oc, x + size/2, y, x, y + size - 1, x + size - 1, y + size*3/4, FOREGROUND_COLOR);
+    return clipped_area(oc, size, size)/2;
+}
+
+// Same triangle as draw_triangle() with anti-aliased edges at sub-pixel coordinates
+static size_t draw_triangle_aa(Olivec_Canvas oc, int size)
+{
+    float x = oc.width/2.0f - size/2.0f + 0.3f;
+    float y = oc.height/2.0f - size/2.0f + 0.6f;
+    olivec_triangle_aa(oc, x + size/2.0f, y, x, y + size - 1, x + size - 1, y + size*3/4.0f, FOREGROUND_COLOR);
+    return clipped_area(oc, size, size)/2;
+}
+
+// Long diagonal sliver that covers only a tiny part of its bounding box
+static size_t draw_triangle_thin(Olivec_Canvas oc, int size)
+{
+    int x = oc.width/2 - size/2;
+    int y = oc.height/2 - size/2;
+    olivec_triangle(oc, x, y, x + size - 1, y + size - 1, x + size - 1, y + size - 5, FOREGROUND_COLOR);
+    return clipped_area(oc, size, 4);
+}
+
+static size_t draw_triangle3c(Olivec_Canvas oc, int size)
+{
+    int x = oc.width/2 - size/2;
+    int y = oc.height/2 - size/2;
+    olivec_triangle3c(oc, x + size/2, y, x, y + size - 1, x + size - 1, y + size*3/4, 0xFF2020FF, 0xFF20FF20, 0xFFFF2020);
+    return clipped_area(oc, size, size)/2;
+}
+
+static size_t draw_triangle3z(Olivec_Canvas oc, int size)
+{
+    int x = oc.width/2 - size/2;
+    int y = oc.height/2 - size/2;
+    olivec_triangle3z(oc, x + size/2, y, x, y + size - 1, x + size - 1, y + size*3/4, 0.5f, 0.25f, 1.0f);
+    return clipped_area(oc, size, size)/2;
+}
+
+#define DEPTH_LAYERS 16
+// Allocated for the largest of canvas_sizes by run_bench_cases()
+static float *depth_values = NULL;
+static Olivec_Depth_Tile *depth_tiles = NULL;
+
+// Stack of triangles drawn front to back, so all but the first layer are hidden
+static size_t draw_depth_overdraw(Olivec_Canvas oc, int size)
+{
+    Olivec_Depth_Buffer db = olivec_depth_buffer(depth_values, oc.width, oc.height, oc.width);
+    db = olivec_depth_buffer_tiles(db, depth_tiles);
+    olivec_depth_clear(db, 0);
+    int x = oc.width/2 - size/2;
+    int y = oc.height/2 - size/2;
+    for (int i = 0; i < DEPTH_LAYERS; ++i) {
+        float z = 1.0f - i*(1.0f/DEPTH_LAYERS);
+        olivec_triangle3c_depth(oc, db, x + size/2, y, x, y + size - 1, x + size - 1, y + size*3/4,
+                                z, z*0.75f, z*0.5f, 0xFF2020FF, 0xFF20FF20, 0xFFFF2020);
+    }
+    return oc.width*oc.height + DEPTH_LAYERS*clipped_area(oc, size, size)/2;
+}
+
+#define TORUS_RINGS 64
+#define TORUS_SIDES 32
+#define TORUS_VERTICES (TORUS_RINGS*TORUS_SIDES)
+static float torus_vertices[TORUS_VERTICES*3];
+static int torus_indices[TORUS_VERTICES*6];
+static float torus_scratch[OLIVEC_MESH_SCRATCH(TORUS_VERTICES)];
+static bool torus_initialized = false;
+
+static bool torus_shader(void *data, int x, int y, const float *varyings, uint32_t *color)
+{
+    (void) data;
+    (void) x;
+    (void) y;
+    *color = mix_colors3(0xFF2020FF, 0xFF20FF20, 0xFFFF2020, varyings[1]*256, varyings[2]*256, 256);
+    return true;
+}
+
+// Torus filling the box of size x size pixels, tilted so both the front and the back faces show up
+static size_t draw_mesh(Olivec_Canvas oc, int size)
+{
+    if (!torus_initialized) {
+        for (int i = 0; i < TORUS_RINGS; ++i) {
+            for (int j = 0; j < TORUS_SIDES; ++j) {
+                float a = 2*M_PI*i/TORUS_RINGS, b = 2*M_PI*j/TORUS_SIDES;
+                float *v = &torus_vertices[(i*TORUS_SIDES + j)*3];
+                v[0] = (1 + 0.4f*cosf(b))*cosf(a);
+                v[1] = 0.4f*sinf(b);
+                v[2] = (1 + 0.4f*cosf(b))*sinf(a);
+                int i1 = (i + 1)%TORUS_RINGS, j1 = (j + 1)%TORUS_SIDES;
+                int *t = &torus_indices[(i*TORUS_SIDES + j)*6];
+                t[0] = i*TORUS_SIDES + j;  t[1] = i*TORUS_SIDES + j1; t[2] = i1*TORUS_SIDES + j;
+                t[3] = i1*TORUS_SIDES + j; t[4] = i*TORUS_SIDES + j1; t[5] = i1*TORUS_SIDES + j1;
+            }
+        }
+        torus_initialized = true;
+    }
+    Olivec_Depth_Buffer db = olivec_depth_buffer_tiles(olivec_depth_buffer(depth_values, oc.width, oc.height, oc.width), depth_tiles);
+    olivec_depth_clear(db, 0);
+    Olivec_Mesh mesh = {
+        .positions = torus_vertices,
+        .stride = 3,
+        .vertex_count = TORUS_VERTICES,
+        .indices = torus_indices,
+        .indices_stride = 3,
+        .triangle_count = TORUS_VERTICES*2,
+    };
+    // The torus is 2.8 units across, 4 units away from the camera
+    float f = 4.0f*size/1.4f;
+    Olivec_Mat4 transform = olivec_mat4_perspective(f/oc.width, f/oc.height);
+    transform = olivec_mat4_mul(transform, olivec_mat4_translate(0, 0, -4));
+    transform = olivec_mat4_mul(transform, olivec_mat4_rotate_x(cosf(0.6f), sinf(0.6f)));
+    olivec_mesh(oc, db, &mesh, transform, 0.1f, OLIVEC_CULL_BACK, torus_scratch, torus_shader, NULL);
+    return oc.width*oc.height + clipped_area(oc, size, size)/2;
+}
+
+static size_t draw_triangle3uv(Olivec_Canvas oc, int size)
+{
+    int x = oc.width/2 - size/2;
+    int y = oc.height/2 - size/2;
+    olivec_triangle3uv(oc, x + size/2, y, x, y + size - 1, x + size - 1, y + size*3/4, 0.5f, 0, 0, 1, 1, 0.75f, 1, 1, 1, sprite);
+    return clipped_area(oc, size, size)/2;
+}
+
+static size_t draw_triangle3uv_bilinear(Olivec_Canvas oc, int size)
+{
+    int x = oc.width/2 - size/2;
+    int y = oc.height/2 - size/2;
+    olivec_triangle3uv_bilinear(oc, x + size/2, y, x, y + size - 1, x + size - 1, y + size*3/4, 0.5f, 0, 0, 1, 1, 0.75f, 1, 1, 1, sprite);
+    return clipped_area(oc, size, size)/2;
+}
+
+static size_t draw_sprite_blend(Olivec_Canvas oc, int size)
+{
+    olivec_sprite_blend(oc, oc.width/2 - size/2, oc.height/2 - size/2, size, size, sprite);
+    return clipped_area(oc, size, size);
+}
+
+static size_t draw_sprite_copy(Olivec_Canvas oc, int size)
+{
+    olivec_sprite_copy(oc, oc.width/2 - size/2, oc.height/2 - size/2, size, size, sprite);
+    return clipped_area(oc, size, size);
+}
+
+// Hundreds of unscaled and flipped sprites scattered over the canvas like in a 2D game
+#define SPRITES_COUNT 500
+
+static size_t draw_sprites(Olivec_Canvas oc, int size)
+{
+    (void) size;
+    size_t area = 0;
+    uint32_t seed = 69;
+    for (size_t i = 0; i < SPRITES_COUNT; ++i) {
+        seed = seed*1103515245 + 12345;
+        int x = (seed >> 8)%oc.width - SPRITE_SIZE/2;
+        seed = seed*1103515245 + 12345;
+        int y = (seed >> 8)%oc.height - SPRITE_SIZE/2;
+        int w = i%4 == 3 ? -SPRITE_SIZE : SPRITE_SIZE;
+        olivec_sprite_blend(oc, x, y, w, SPRITE_SIZE, sprite);
+        area += SPRITE_SIZE*SPRITE_SIZE;
+    }
+    return area;
+}
+
+static size_t draw_sprite_copy_bilinear(Olivec_Canvas oc, int size)
+{
+    olivec_sprite_copy_bilinear(oc, oc.width/2 - size/2, oc.height/2 - size/2, size, size, sprite);
+    return clipped_area(oc, size, size);
+}
+
+#define BENCH_TEXT "hello, world"
+
+// Amount of pixels olivec_text() draws. Glyph cells are drawn only when their top-left corner is
+// inside of the canvas and are clipped by its right and bottom sides.
+static size_t text_area(Olivec_Canvas oc, const char *text, int tx, int ty, Olivec_Font font, size_t glyph_size)
+{
+    int64_t gs = glyph_size;
+    size_t area = 0;
+    for (int64_t gx = tx; *text; gx += font.width*gs, ++text) {
+        const char *glyph = &font.glyphs[(*text)*sizeof(char)*font.width*font.height];
+        for (size_t dy = 0; dy < font.height; ++dy) {
+            int64_t y = ty + dy*gs;
+            if (y < 0 || y >= (int64_t) oc.height) continue;
+            for (size_t dx = 0; dx < font.width; ++dx) {
+                int64_t x = gx + dx*gs;
+                if (x < 0 || x >= (int64_t) oc.width) continue;
+                if (!glyph[dy*font.width + dx]) continue;
+                area += min_size(gs, oc.width - x)*min_size(gs, oc.height - y);
+            }
+        }
+    }
+    return area;
+}
+
+static size_t draw_text(Olivec_Canvas oc, int size)
+{
+    size_t glyph_size = size/OLIVEC_DEFAULT_FONT_HEIGHT;
+    if (glyph_size == 0) glyph_size = 1;
+    size_t w = strlen(BENCH_TEXT)*OLIVEC_DEFAULT_FONT_WIDTH*glyph_size;
+    size_t h = OLIVEC_DEFAULT_FONT_HEIGHT*glyph_size;
+    int x = oc.width/2 - w/2;
+    int y = oc.height/2 - h/2;
+    olivec_text(oc, BENCH_TEXT, x, y, olivec_default_font, glyph_size, FOREGROUND_COLOR);
+    return text_area(oc, BENCH_TEXT, x, y, olivec_default_font, glyph_size);
+}
+
+// A frame of SCENE_SHAPES circles and triangles of the given size scattered over the canvas.
+// The immediate and tiled versions produce identical pixels.
+static size_t draw_scene(Olivec_Canvas oc, int size)
+{
+    olivec_fill(oc, BACKGROUND_COLOR);
+    for (int i = 0; i < SCENE_SHAPES; ++i) {
+        int x = (i*97)%oc.width;
+        int y = (i*61)%oc.height;
+        olivec_circle(oc, x, y, size/2, TRANSPARENT_COLOR);
+        olivec_triangle(oc, x, y, x + size, y + size/2, x + size/4, y + size, FOREGROUND_COLOR);
+    }
+    return oc.width*oc.height + SCENE_SHAPES*clipped_area(oc, size, size);
+}
+
+static Olivec_Tiled tiled = {0};
+
+static size_t draw_scene_tiled(Olivec_Canvas oc, int size)
+{
+    if (tiled.tile_size == 0 && !olivec_tiled_init(&tiled, TILE_SIZE, TILED_THREADS)) {
+        fprintf(stderr, "ERROR: could not start the tiled renderer\n");
+        exit(1);
+    }
+    olivec_tiled_begin(&tiled, oc);
+    olivec_tiled_fill(&tiled, BACKGROUND_COLOR);
+    for (int i = 0; i < SCENE_SHAPES; ++i) {
+        int x = (i*97)%oc.width;
+        int y = (i*61)%oc.height;
+        olivec_tiled_circle(&tiled, x, y, size/2, TRANSPARENT_COLOR);
+        olivec_tiled_triangle(&tiled, x, y, x + size, y + size/2, x + size/4, y + size, FOREGROUND_COLOR);
+    }
+    olivec_tiled_flush(&tiled);
+    return oc.width*oc.height + SCENE_SHAPES*clipped_area(oc, size, size);
+}
+
+typedef struct {
+    size_t (*draw)(Olivec_Canvas oc, int size);
+    const char *id;
+    bool sized; // false means the primitive ignores the shape size and covers the entire canvas
+} Bench_Case;
+
+#define DEFINE_BENCH_CASE(name, is_sized) \
+    { \
+        .draw = draw_##name, \
+        .id = #name, \
+        .sized = is_sized, \
+    }
+
+Bench_Case bench_cases[] = {
+    DEFINE_BENCH_CASE(fill, false),
+    DEFINE_BENCH_CASE(rect, true),
+    DEFINE_BENCH_CASE(rect_blend, true),
+    DEFINE_BENCH_CASE(frame, true),
+    DEFINE_BENCH_CASE(circle, true),
+    DEFINE_BENCH_CASE(ellipse, true),
+    DEFINE_BENCH_CASE(line, true),
+    DEFINE_BENCH_CASE(lines, true),
+    DEFINE_BENCH_CASE(line_aa, false),
+    DEFINE_BENCH_CASE(polyline_aa, true),
+    DEFINE_BENCH_CASE(triangle, true),
+    DEFINE_BENCH_CASE(triangle_thin, true),
+    DEFINE_BENCH_CASE(triangle_aa, true),
+    DEFINE_BENCH_CASE(triangle3c, true),
+    DEFINE_BENCH_CASE(triangle3z, true),
+    DEFINE_BENCH_CASE(depth_overdraw, true),
+    DEFINE_BENCH_CASE(mesh, true),
+    DEFINE_BENCH_CASE(triangle3uv, true),
+    DEFINE_BENCH_CASE(triangle3uv_bilinear, true),
+    DEFINE_BENCH_CASE(sprite_blend, true),
+    DEFINE_BENCH_CASE(sprite_copy, true),
+    DEFINE_BENCH_CASE(sprite_copy_bilinear, true),
+    DEFINE_BENCH_CASE(sprites, false),
+    DEFINE_BENCH_CASE(text, true),
+    DEFINE_BENCH_CASE(scene, true),
+    DEFINE_BENCH_CASE(scene_tiled, true),
+};
+#define BENCH_CASES_COUNT (sizeof(bench_cases)/sizeof(bench_cases[0]))
+
+typedef struct {
+    const char *id;
+    size_t canvas_width;
+    size_t canvas_height;
+    size_t size;
+    size_t iterations;
+    double ns_per_call;
+    double mpixels_per_sec;
+} Bench_Result;
+
+typedef struct {
+    Bench_Result *items;
+    size_t count;
+    size_t capacity;
+} Bench_Results;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec*1000*1000*1000 + ts.tv_nsec;
+}
+
+Bench_Result run_bench_case(const Bench_Case *bc, Olivec_Canvas oc, size_t size, uint64_t budget_ns)
+{
+    Bench_Result br = {
+        .id = bc->id,
+        .canvas_width = oc.width,
+        .canvas_height = oc.height,
+        .size = size,
+    };
+
+    // Warm up and figure out how many calls fit into a single repeat
+    olivec_fill(oc, BACKGROUND_COLOR);
+    size_t pixels = bc->draw(oc, size);
+    size_t iterations = 1;
+    for (;;) {
+        uint64_t start = now_ns();
+        for (size_t i = 0; i < iterations; ++i) bc->draw(oc, size);
+        uint64_t elapsed = now_ns() - start;
+        if (elapsed >= budget_ns/REPEATS) break;
+        iterations *= 2;
+    }
+
+    // The best repeat is the least disturbed by the rest of the system
+    double best = 0;
+    for (size_t r = 0; r < REPEATS; ++r) {
+        uint64_t start = now_ns();
+        for (size_t i = 0; i < iterations; ++i) bc->draw(oc, size);
+        double ns = (double)(now_ns() - start)/iterations;
+        if (r == 0 || ns < best) best = ns;
+    }
+
+    br.iterations = iterations*REPEATS;
+    br.ns_per_call = best;
+    br.mpixels_per_sec = best > 0 ? pixels*1e3/best : 0;
+    return br;
+}
+
+typedef enum {
+    FORMAT_TEXT,
+    FORMAT_CSV,
+    FORMAT_JSON,
+} Format;
+
+typedef struct {
+    Format format;
+    const char *output_file_path;
+    uint64_t budget_ns;
+    double threshold;
+    const char **filters;
+    size_t filters_count;
+} Options;
+
+static bool case_selected(const Options *opts, const Bench_Case *bc)
+{
+    if (opts->filters_count == 0) return true;
+    for (size_t i = 0; i < opts->filters_count; ++i) {
+        if (strcmp(opts->filters[i], bc->id) == 0) return true;
+    }
+    return false;
+}
+
+bool run_bench_cases(const Options *opts, Bench_Results *results)
+{
+    size_t max_width = 0, max_height = 0;
+    for (size_t i = 0; i < CANVAS_SIZES_COUNT; ++i) {
+        if (max_width < canvas_sizes[i].width) max_width = canvas_sizes[i].width;
+        if (max_height < canvas_sizes[i].height) max_height = canvas_sizes[i].height;
+    }
+    uint32_t *pixels = malloc(sizeof(uint32_t)*max_width*max_height);
+    if (pixels == NULL) {
+        fprintf(stderr, "ERROR: could not allocate canvas: %s\n", strerror(errno));
+        return false;
+    }
+    depth_values = malloc(sizeof(float)*max_width*max_height);
+    depth_tiles = malloc(sizeof(Olivec_Depth_Tile)*OLIVEC_DEPTH_TILES(max_width, max_height));
+    if (depth_values == NULL || depth_tiles == NULL) {
+        fprintf(stderr, "ERROR: could not allocate depth buffer: %s\n", strerror(errno));
+        free(pixels);
+        free(depth_values);
+        free(depth_tiles);
+        return false;
+    }
+
+    for (size_t i = 0; i < BENCH_CASES_COUNT; ++i) {
+        const Bench_Case *bc = &bench_cases[i];
+        if (!case_selected(opts, bc)) continue;
+        for (size_t j = 0; j < CANVAS_SIZES_COUNT; ++j) {
+            Olivec_Canvas oc = olivec_canvas(pixels, canvas_sizes[j].width, canvas_sizes[j].height, canvas_sizes[j].width);
+            size_t sizes_count = bc->sized ? SHAPE_SIZES_COUNT : 1;
+            for (size_t k = 0; k < sizes_count; ++k) {
+                size_t size = bc->sized ? shape_sizes[k] : 0;
+                Bench_Result br = run_bench_case(bc, oc, size, opts->budget_ns);
+                if (opts->format == FORMAT_TEXT || opts->output_file_path != NULL) {
+                    fprintf(stderr, "%-24s %4zux%-4zu size %-4zu %12.1f ns/call %10.1f Mpixels/s\n",
+                            br.id, br.canvas_width, br.canvas_height, br.size, br.ns_per_call, br.mpixels_per_sec);
+                }
+                da_append(results, br);
+            }
+        }
+    }
+
+    free(pixels);
+    free(depth_values);
+    free(depth_tiles);
+    return true;
+}
+
+#define CSV_HEADER "case,canvas_width,canvas_height,size,iterations,ns_per_call,mpixels_per_sec"
+
+void write_results(FILE *out, Format format, Bench_Results results)
+{
+    switch (format) {
+    case FORMAT_TEXT:
+        break;
+    case FORMAT_CSV:
+        fprintf(out, "%s\n", CSV_HEADER);
+        for (size_t i = 0; i < results.count; ++i) {
+            Bench_Result br = results.items[i];
+            fprintf(out, "%s,%zu,%zu,%zu,%zu,%.1f,%.3f\n", br.id, br.canvas_width, br.canvas_height, br.size, br.iterations, br.ns_per_call, br.mpixels_per_sec);
+        }
+        break;
+    case FORMAT_JSON:
+        fprintf(out, "[\n");
+        for (size_t i = 0; i < results.count; ++i) {
+            Bench_Result br = results.items[i];
+            fprintf(out, "  {\"case\": \"%s\", \"canvas_width\": %zu, \"canvas_height\": %zu, \"size\": %zu, \"iterations\": %zu, \"ns_per_call\": %.1f, \"mpixels_per_sec\": %.3f}%s\n",
+                    br.id, br.canvas_width, br.canvas_height, br.size, br.iterations, br.ns_per_call, br.mpixels_per_sec,
+                    i + 1 < results.count ? "," : "");
+        }
+        fprintf(out, "]\n");
+        break;
+    default:
+        UNREACHABLE("Format");
+    }
+}
+
+bool save_results(const Options *opts, Bench_Results results)
+{
+    if (opts->output_file_path == NULL) {
+        write_results(stdout, opts->format, results);
+        return true;
+    }
+
+    FILE *out = fopen(opts->output_file_path, "wb");
+    if (out == NULL) {
+        fprintf(stderr, "ERROR: could not write file %s: %s\n", opts->output_file_path, strerror(errno));
+        return false;
+    }
+    write_results(out, opts->format == FORMAT_TEXT ? FORMAT_CSV : opts->format, results);
+    fclose(out);
+    printf("Saved results to %s\n", opts->output_file_path);
+    return true;
+}
+
+#define JSON_RESULT_FORMAT "{\"case\": \"%127[^\"]\", \"canvas_width\": %zu, \"canvas_height\": %zu, \"size\": %zu, \"iterations\": %zu, \"ns_per_call\": %lf, \"mpixels_per_sec\": %lf}"
+
+// Loads results previously saved with `run -f csv -o <file>` or `run -f json -o <file>`.
+// JSON is only understood in the one-result-per-line layout write_results() produces.
+// The strings in the loaded results are leaked on purpose. The process is short-lived.
+bool load_baseline(const char *file_path, Bench_Results *baseline)
+{
+    String_Builder sb = {0};
+    if (!read_entire_file(file_path, &sb)) return false;
+
+    String_View content = sb_to_sv(sb);
+    for (size_t line_number = 1; content.count > 0; ++line_number) {
+        String_View line = sv_trim(sv_chop_by_delim(&content, '\n'));
+        if (line.count == 0) continue;
+        if (sv_eq(line, sv_from_cstr(CSV_HEADER))) continue;
+        if (sv_eq(line, sv_from_cstr("[")) || sv_eq(line, sv_from_cstr("]"))) continue;
+
+        const char *cline = temp_sv_to_cstr(line);
+        char id[128];
+        Bench_Result br = {0};
+        if (cline[0] == '{') {
+            if (sscanf(cline, JSON_RESULT_FORMAT, id, &br.canvas_width, &br.canvas_height, &br.size, &br.iterations, &br.ns_per_call, &br.mpixels_per_sec) != 7) {
+                fprintf(stderr, "%s:%zu: ERROR: could not parse benchmark result. Expected one JSON object per line as written by `run -f json`\n", file_path, line_number);
+                return false;
+            }
+        } else if (sscanf(cline, "%127[^,],%zu,%zu,%zu,%zu,%lf,%lf", id, &br.canvas_width, &br.canvas_height, &br.size, &br.iterations, &br.ns_per_call, &br.mpixels_per_sec) != 7) {
+            fprintf(stderr, "%s:%zu: ERROR: could not parse benchmark result. Expected CSV with columns: %s\n", file_path, line_number, CSV_HEADER);
+            return false;
+        }
+        br.id = strdup(id);
+        da_append(baseline, br);
+        temp_reset();
+    }
+
+    free(sb.items);
+    return true;
+}
+
+static const Bench_Result *find_result(Bench_Results results, const Bench_Result *key)
+{
+    for (size_t i = 0; i < results.count; ++i) {
+        const Bench_Result *br = &results.items[i];
+        if (strcmp(br->id, key->id) == 0 &&
+            br->canvas_width == key->canvas_width &&
+            br->canvas_height == key->canvas_height &&
+            br->size == key->size) {
+            return br;
+        }
+    }
+    return NULL;
+}
+
+void usage(const char *program_path);
+
+bool parse_options(const char *program_path, int argc, char **argv, Options *opts)
+{
+    opts->format = FORMAT_TEXT;
+    opts->budget_ns = (uint64_t)DEFAULT_BUDGET_MS*1000*1000;
+    opts->threshold = DEFAULT_THRESHOLD;
+    opts->filters = (const char**) argv;
+    opts->filters_count = 0;
+
+    while (argc > 0) {
+        const char *flag = shift(argv, argc);
+        if (strcmp(flag, "-f") == 0 || strcmp(flag, "-o") == 0 || strcmp(flag, "-t") == 0 || strcmp(flag, "-r") == 0) {
+            if (argc <= 0) {
+                usage(program_path);
+                fprintf(stderr, "ERROR: no value is provided for flag %s\n", flag);
+                return false;
+            }
+            const char *value = shift(argv, argc);
+            if (strcmp(flag, "-f") == 0) {
+                if (strcmp(value, "text") == 0)      opts->format = FORMAT_TEXT;
+                else if (strcmp(value, "csv") == 0)  opts->format = FORMAT_CSV;
+                else if (strcmp(value, "json") == 0) opts->format = FORMAT_JSON;
+                else {
+                    usage(program_path);
+                    fprintf(stderr, "ERROR: unknown output format `%s`\n", value);
+                    return false;
+                }
+            } else if (strcmp(flag, "-o") == 0) {
+                opts->output_file_path = value;
+            } else if (strcmp(flag, "-t") == 0) {
+                opts->budget_ns = (uint64_t)strtoull(value, NULL, 10)*1000*1000;
+            } else {
+                opts->threshold = strtod(value, NULL);
+            }
+        } else {
+            // Filters are collected in place since argv is only ever shifted forward
+            opts->filters[opts->filters_count++] = flag;
+        }
+    }
+
+    for (size_t i = 0; i < opts->filters_count; ++i) {
+        bool found = false;
+        for (size_t j = 0; j < BENCH_CASES_COUNT && !found; ++j) {
+            found = strcmp(bench_cases[j].id, opts->filters[i]) == 0;
+        }
+        if (!found) {
+            fprintf(stderr, "ERROR: could not find benchmark case `%s`\n", opts->filters[i]);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+typedef struct {
+    int (*run)(const char *program_path, int argc, char **argv);
+    const char *id;
+    const char *description;
+} Subcmd;
+
+int subcmd_run(const char *program_path, int argc, char **argv)
+{
+    Options opts = {0};
+    if (!parse_options(program_path, argc, argv, &opts)) return 1;
+
+    Bench_Results results = {0};
+    if (!run_bench_cases(&opts, &results)) return 1;
+    if (!save_results(&opts, results)) return 1;
+    return 0;
+}
+
+int subcmd_compare(const char *program_path, int argc, char **argv)
+{
+    if (argc <= 0) {
+        usage(program_path);
+        fprintf(stderr, "ERROR: no baseline file is provided\n");
+        return 1;
+    }
+    const char *baseline_file_path = shift(argv, argc);
+
+    Options opts = {0};
+    if (!parse_options(program_path, argc, argv, &opts)) return 1;
+
+    Bench_Results baseline = {0};
+    if (!load_baseline(baseline_file_path, &baseline)) return 1;
+
+    Bench_Results results = {0};
+    if (!run_bench_cases(&opts, &results)) return 1;
+
+    size_t regressions = 0;
+    printf("%-24s %-9s %-4s %12s %12s %8s\n", "case", "canvas", "size", "baseline ns", "current ns", "delta");
+    for (size_t i = 0; i < results.count; ++i) {
+        const Bench_Result *br = &results.items[i];
+        const Bench_Result *old = find_result(baseline, br);
+        if (old == NULL || old->ns_per_call <= 0) {
+            printf("%-24s %4zux%-4zu %-4zu %12s %12.1f %8s\n", br->id, br->canvas_width, br->canvas_height, br->size, "-", br->ns_per_call, "new");
+            continue;
+        }
+        double delta = (br->ns_per_call - old->ns_per_call)*100.0/old->ns_per_call;
+        const char *verdict = "";
+        if (delta > opts.threshold) {
+            verdict = "  REGRESSION";
+            regressions += 1;
+        } else if (delta < -opts.threshold) {
+            verdict = "  improved";
+        }
+        printf("%-24s %4zux%-4zu %-4zu %12.1f %12.1f %+7.1f%%%s\n", br->id, br->canvas_width, br->canvas_height, br->size, old->ns_per_call, br->ns_per_call, delta, verdict);
+    }
+
+    if (opts.output_file_path != NULL) {
+        if (!save_results(&opts, results)) return 1;
+    }
+
+    if (regressions > 0) {
+        fprintf(stderr, "ERROR: %zu benchmark(s) regressed by more than %.1f%% compared to %s\n", regressions, opts.threshold, baseline_file_path);
+        return 1;
+    }
+    return 0;
+}
+
+int subcmd_list(const char *program_path, int argc, char **argv)
+{
+    UNUSED(program_path);
+    UNUSED(argc);
+    UNUSED(argv);
+    fprintf(stderr, "Available benchmarks:\n");
+    for (size_t i = 0; i < BENCH_CASES_COUNT; ++i) {
+        fprintf(stderr, "    %s\n", bench_cases[i].id);
+    }
+    return 0;
+}
+
+int subcmd_help(const char *program_path, int argc, char **argv)
+{
+    UNUSED(argc);
+    UNUSED(argv);
+    usage(program_path);
+    return 0;
+}
+
+#define DEFINE_SUBCMD(name, desc) \
+    { \
+        .run = subcmd_##name, \
+        .id = #name, \
+        .description = desc, \
+    }
+
+Subcmd subcmds[] = {
+    DEFINE_SUBCMD(run, "Run the benchmarks: run [-f text|csv|json] [-o <file>] [-t <ms>] [<case>...]"),
+    DEFINE_SUBCMD(compare, "Run the benchmarks and compare them to a CSV or JSON baseline: compare <baseline> [-r <percent>] [-t <ms>] [<case>...]"),
+    DEFINE_SUBCMD(list, "List all available benchmarks"),
+    DEFINE_SUBCMD(help, "Print this help message"),
+};
+#define SUBCMDS_COUNT (sizeof(subcmds)/sizeof(subcmds[0]))
+
+Subcmd *find_subcmd_by_id(const char *id)
+{
+    for (size_t i = 0; i < SUBCMDS_COUNT; ++i) {
+        if (strcmp(subcmds[i].id, id) == 0) {
+            return &subcmds[i];
+        }
+    }
+    return NULL;
+}
+
+void usage(const char *program_path)
+{
+    fprintf(stderr, "Usage: %s [Subcommand]\n", program_path);
+    fprintf(stderr, "Subcommands:\n");
+
+    int width = 0;
+    for (size_t i = 0; i < SUBCMDS_COUNT; ++i) {
+        int len = strlen(subcmds[i].id);
+        if (width < len) width = len;
+    }
+
+    for (size_t i = 0; i < SUBCMDS_COUNT; ++i) {
+        fprintf(stderr, "    %-*s - %s\n", width, subcmds[i].id, subcmds[i].description);
+    }
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "    -f    output format of the results (default: text)\n");
+    fprintf(stderr, "    -o    save the results into a file (CSV unless -f json)\n");
+    fprintf(stderr, "    -t    time budget of a single measurement in milliseconds (default: %d)\n", DEFAULT_BUDGET_MS);
+    fprintf(stderr, "    -r    regression threshold in percents for compare (default: %.0f)\n", DEFAULT_THRESHOLD);
+}
+
+int main(int argc, char **argv)
+{
+    const char *program_path = shift(argv, argc);
+
+    if (argc <= 0) {
+        usage(program_path);
+        fprintf(stderr, "ERROR: no subcommand is provided\n");
+        return 1;
+    }
+
+    init_sprite();
+
+    const char *subcmd_id = shift(argv, argc);
+    Subcmd *subcmd = find_subcmd_by_id(subcmd_id);
+    if (subcmd == NULL) {
+        usage(program_path);
+        fprintf(stderr, "ERROR: unknown subcommand `%s`\n", subcmd_id);
+        return 1;
+    }
+    return subcmd->run(program_path, argc, argv);
+}
@@ -0,0 +1,5722 @@
+#ifndef LAVASTONE_H_
+#define LAVASTONE_H_
+size_t lavastone_width = 200;
+size_t lavastone_height = 200;
+uint32_t lavastone_pixels[] = {
+   0xFF240000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220002,0xFF1C0010,
+   0xFF1D000F,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF260000,0xFF25000E,
+   0xFF040058,0xFF040095,0xFF040052,0xFF1D000B,0xFF230000,0xFF230000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF230000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF250004,0xFF0A003D,0xFF000074,
+   0xFF050046,0xFF1A000B,0xFF1D0007,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF230000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF230000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF2D0000,0xFF1C0023,0xFF060053,0xFF1F0009,0xFF220000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF260001,0xFF0D0033,
+   0xFF0D002E,0xFF230000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210001,0xFF1B000B,0xFF1C000A,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF240000,0xFF23000A,0xFF03004E,0xFF040095,0xFF040052,0xFF1D000B,0xFF230000,
+   0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF230000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF250004,
+   0xFF0A003D,0xFF000079,0xFF050053,0xFF180013,0xFF1A000D,0xFF1D0004,0xFF1D0005,
+   0xFF1D0005,0xFF1E0003,0xFF200000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF200000,0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF1E0002,
+   0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF1F0002,
+   0xFF1F0002,0xFF200001,0xFF2A0000,0xFF1A002B,0xFF060059,0xFF1F0009,0xFF220000,
+   0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF260001,0xFF0D003B,0xFF0E003A,0xFF250000,0xFF240000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220001,0xFF170029,0xFF1B0019,0xFF240001,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF290009,0xFF06004D,0xFF040093,0xFF02005B,
+   0xFF1A0011,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF230000,0xFF210000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF250000,0xFF140027,0xFF00006D,0xFF020069,0xFF120024,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF230000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF250000,0xFF230000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF240000,0xFF2C0004,0xFF110040,
+   0xFF150024,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF20000D,0xFF04003F,0xFF180016,0xFF230000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210001,0xFF160021,0xFF1A0013,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF260006,0xFF060041,
+   0xFF040092,0xFF02005B,0xFF1A0011,0xFF240000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF230000,
+   0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF250000,0xFF140027,0xFF000071,0xFF020076,
+   0xFF11002F,0xFF1D0004,0xFF1D0005,0xFF1D0005,0xFF1D0005,0xFF1E0003,0xFF200000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF220000,
+   0xFF200001,0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF1E0002,
+   0xFF1E0002,0xFF1E0002,0xFF1F0001,0xFF200001,0xFF200001,0xFF1F0002,0xFF210001,
+   0xFF290005,0xFF100047,0xFF160025,0xFF220000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF20000E,0xFF04004E,0xFF19001E,
+   0xFF250000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF1F0004,0xFF160032,0xFF150043,
+   0xFF230002,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF2A0004,0xFF0A0043,0xFF040091,0xFF020064,0xFF170017,0xFF240000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF220000,0xFF1C0016,
+   0xFF020065,0xFF030079,0xFF16001D,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF260000,
+   0xFF270000,0xFF270000,0xFF240000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF240000,0xFF260000,0xFF250000,
+   0xFF240000,0xFF220000,0xFF270000,0xFF240018,0xFF07004E,0xFF1B000E,0xFF220000,
+   0xFF220000,0xFF230000,0xFF250000,0xFF250000,0xFF250000,0xFF280000,0xFF140025,
+   0xFF06003F,0xFF210005,0xFF230000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0003,
+   0xFF150028,0xFF140036,0xFF220001,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF280003,0xFF0A0035,0xFF04008D,0xFF020065,0xFF170017,
+   0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF220000,0xFF1C0016,0xFF020068,0xFF030084,0xFF140025,0xFF1E0003,0xFF1D0005,
+   0xFF1D0005,0xFF1D0005,0xFF1E0003,0xFF200000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF240000,0xFF250000,0xFF240000,0xFF220000,0xFF1F0002,0xFF1E0002,
+   0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF1F0001,0xFF210000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF1F0001,0xFF240000,0xFF21001C,0xFF070052,
+   0xFF1B000E,0xFF220000,0xFF220000,0xFF230000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF280000,0xFF140028,0xFF07004E,0xFF230007,0xFF250000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF200004,0xFF1C000C,
+   0xFF190010,0xFF1E000D,0xFF19002F,0xFF1C0019,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF290004,0xFF0A0041,0xFF040092,
+   0xFF02006A,0xFF16001A,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF210000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF200000,0xFF20000F,0xFF020057,0xFF03004F,0xFF1B000C,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF250000,
+   0xFF220000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF220000,
+   0xFF240000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,
+   0xFF2A0003,0xFF0B004E,0xFF060049,0xFF1B000C,0xFF230000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF270000,0xFF21000C,0xFF050047,0xFF0B0036,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF1F0003,0xFF1B0009,0xFF19000A,0xFF1E0008,0xFF180024,0xFF1C0013,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF270002,
+   0xFF0A0033,0xFF04008D,0xFF02006B,0xFF16001A,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF220000,
+   0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF200000,0xFF20000F,0xFF02005A,
+   0xFF02005C,0xFF180012,0xFF1D0004,0xFF1D0005,0xFF1D0005,0xFF1D0005,0xFF1E0002,
+   0xFF200000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF230000,0xFF200001,0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF1E0002,
+   0xFF1E0002,0xFF1F0002,0xFF210000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF270005,0xFF0A0054,0xFF060049,0xFF1B000C,0xFF230000,
+   0xFF250000,0xFF260000,0xFF260000,0xFF270000,0xFF21000B,0xFF06004A,0xFF0C0042,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF230000,0xFF220000,0xFF1F0005,
+   0xFF1C0015,0xFF170021,0xFF17001C,0xFF1B0014,0xFF200005,0xFF230001,0xFF1A0014,
+   0xFF1F0003,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF270007,0xFF070049,0xFF050099,0xFF020071,0xFF130020,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF230000,0xFF200000,0xFF1E0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF210000,
+   0xFF23000B,0xFF030051,0xFF080040,0xFF1F0003,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF230000,0xFF250000,0xFF260000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF230000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF230000,0xFF250000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF2C0000,0xFF16002F,0xFF00006F,
+   0xFF050043,0xFF160018,0xFF210006,0xFF250001,0xFF240002,0xFF1A0013,0xFF08003C,
+   0xFF00006B,0xFF0B002E,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF200000,0xFF1E0004,0xFF1B0011,0xFF16001A,0xFF170014,0xFF1B000E,0xFF200003,
+   0xFF230000,0xFF1B000D,0xFF200002,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF250005,0xFF07003A,0xFF050095,0xFF020074,
+   0xFF130022,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF220000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF210000,0xFF23000B,0xFF030052,0xFF070049,0xFF1C0007,0xFF1D0005,
+   0xFF1D0005,0xFF1D0005,0xFF1D0005,0xFF1E0002,0xFF210000,0xFF230000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF220000,
+   0xFF1F0001,0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF200001,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF280000,
+   0xFF140036,0xFF000071,0xFF050043,0xFF160018,0xFF210006,0xFF250001,0xFF240002,
+   0xFF1A0013,0xFF08003B,0xFF00006B,0xFF0C0036,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250001,0xFF230005,
+   0xFF1E000F,0xFF190018,0xFF170020,0xFF17002A,0xFF150050,0xFF0E005B,0xFF1A0015,
+   0xFF1F0003,0xFF200000,0xFF200002,0xFF1A000B,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF230000,0xFF22000E,0xFF040058,
+   0xFF0700A4,0xFF03007E,0xFF0F002A,0xFF230000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF210000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF210000,0xFF24000A,0xFF040051,0xFF13002A,
+   0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF220000,0xFF250000,
+   0xFF260000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF220000,
+   0xFF240000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF2A0000,0xFF230016,0xFF020063,0xFF030083,0xFF01005C,0xFF050044,
+   0xFF0A003F,0xFF08004C,0xFF02005F,0xFF010078,0xFF030088,0xFF070034,0xFF210002,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF200004,0xFF1C000C,0xFF180013,0xFF160018,0xFF160021,0xFF140041,
+   0xFF0D0049,0xFF1A000F,0xFF200002,0xFF210000,0xFF210001,0xFF1C0005,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF21000A,0xFF040048,0xFF0800A3,0xFF030082,0xFF0E002D,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF1F0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF210000,0xFF24000A,
+   0xFF040052,0xFF110030,0xFF200000,0xFF1F0002,0xFF1E0004,0xFF1D0005,0xFF1D0004,
+   0xFF200001,0xFF230000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF200000,0xFF1E0002,0xFF1E0002,
+   0xFF1E0002,0xFF200001,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF270000,0xFF21001B,0xFF020068,0xFF030082,
+   0xFF01005B,0xFF050043,0xFF0A003F,0xFF08004B,0xFF02005E,0xFF010078,0xFF030088,
+   0xFF080038,0xFF240003,0xFF260000,0xFF260000,0xFF260000,0xFF250003,0xFF20000D,
+   0xFF1B0018,0xFF1A001E,0xFF190021,0xFF1A0024,0xFF1B001D,0xFF1E0013,0xFF21000B,
+   0xFF230003,0xFF270002,0xFF220011,0xFF19001E,0xFF160023,0xFF17001C,0xFF150020,
+   0xFF1A000B,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF240000,0xFF1B001D,0xFF02006C,0xFF0700A9,0xFF040091,0xFF080043,
+   0xFF210003,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF220000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF220000,0xFF1C0015,0xFF020056,0xFF1B0016,0xFF240000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF230000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF230000,
+   0xFF200000,0xFF1F0000,0xFF200000,0xFF230000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF280000,0xFF2B0009,
+   0xFF06004A,0xFF06009D,0xFF0700A5,0xFF01007C,0xFF020062,0xFF0C004B,0xFF100040,
+   0xFF06004F,0xFF010070,0xFF020054,0xFF1A000B,0xFF240000,0xFF230000,0xFF230000,
+   0xFF210002,0xFF1D000A,0xFF190013,0xFF180018,0xFF17001A,0xFF18001D,0xFF1A0017,
+   0xFF1D000F,0xFF1F0008,0xFF220002,0xFF260002,0xFF21000D,0xFF190015,0xFF170019,
+   0xFF180014,0xFF170016,0xFF1C0006,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF230000,0xFF1A0015,0xFF020060,0xFF0900AB,
+   0xFF050095,0xFF080048,0xFF1E0004,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF220000,0xFF1C0015,0xFF020058,0xFF190019,0xFF210000,
+   0xFF200000,0xFF200000,0xFF1F0001,0xFF210001,0xFF230000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF220000,0xFF1F0001,0xFF1E0002,0xFF1F0001,0xFF210000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF250000,0xFF28000C,0xFF060053,0xFF06009D,0xFF0700A5,0xFF01007C,0xFF020062,
+   0xFF0C004A,0xFF11003E,0xFF06004D,0xFF010070,0xFF030057,0xFF1C000F,0xFF270000,
+   0xFF240005,0xFF1D0018,0xFF1B0022,0xFF1F001C,0xFF240012,0xFF26000B,0xFF270006,
+   0xFF260002,0xFF240000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF220000,0xFF220003,0xFF21000B,0xFF150027,0xFF1D0007,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF240000,0xFF110033,
+   0xFF01007C,0xFF020073,0xFF050060,0xFF030068,0xFF180019,0xFF240000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF230000,0xFF220000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF230000,0xFF160024,0xFF030057,
+   0xFF1E000C,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF220000,0xFF210000,0xFF220000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF260000,0xFF2E0002,0xFF0E0039,0xFF03008E,0xFF03008A,
+   0xFF04004D,0xFF1D001B,0xFF2D0003,0xFF310001,0xFF2D000B,0xFF150031,0xFF020066,
+   0xFF0E0025,0xFF230000,0xFF220003,0xFF1A0013,0xFF18001A,0xFF1C0016,0xFF21000E,
+   0xFF230009,0xFF240005,0xFF230001,0xFF220000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF200000,0xFF210000,0xFF210002,0xFF200008,0xFF16001C,0xFF1D0005,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF250000,0xFF110025,0xFF020074,0xFF030078,0xFF050066,0xFF030070,0xFF15001D,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1D0000,0xFF1B0000,
+   0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF230000,
+   0xFF160024,0xFF02005A,0xFF1B000F,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF220000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF210000,
+   0xFF200001,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF2A0003,0xFF0D0043,
+   0xFF030091,0xFF030089,0xFF04004C,0xFF1D001B,0xFF2D0003,0xFF310001,0xFF2D000B,
+   0xFF160030,0xFF020067,0xFF0F0029,0xFF260001,0xFF190024,0xFF210016,0xFF2A0004,
+   0xFF2B0000,0xFF290000,0xFF280000,0xFF270000,0xFF250000,0xFF230000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0004,
+   0xFF1B0009,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF230005,0xFF09004F,0xFF040069,0xFF190024,0xFF2A000A,
+   0xFF1E0037,0xFF0C0043,0xFF210003,0xFF230000,0xFF240000,0xFF230000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF250000,0xFF130030,0xFF030055,0xFF1E0009,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF250000,0xFF260000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF2C0000,0xFF130031,0xFF000075,0xFF040052,0xFF1D0017,0xFF290000,0xFF260000,
+   0xFF260000,0xFF2A0000,0xFF330002,0xFF160041,0xFF010050,0xFF150016,0xFF18001A,
+   0xFF1F0011,0xFF260003,0xFF270000,0xFF260000,0xFF250000,0xFF240000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0003,0xFF1B0005,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF240003,0xFF090041,0xFF040067,
+   0xFF170026,0xFF26000C,0xFF1B003B,0xFF0A004B,0xFF1D0004,0xFF1E0000,0xFF1E0000,
+   0xFF1D0000,0xFF1B0001,0xFF190001,0xFF190000,0xFF190000,0xFF1A0000,0xFF1B0000,
+   0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF250000,0xFF130030,0xFF020058,0xFF1B000C,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF290000,0xFF12003B,0xFF00007A,0xFF040050,0xFF1D0017,
+   0xFF290000,0xFF260000,0xFF260000,0xFF2B0000,0xFF330002,0xFF160041,0xFF020053,
+   0xFF16001B,0xFF250008,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF240000,0xFF230000,
+   0xFF210000,0xFF1F0000,0xFF1F0000,0xFF19000D,0xFF1D0005,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF1F0010,
+   0xFF050062,0xFF16002E,0xFF250000,0xFF250000,0xFF2D0003,0xFF16003A,0xFF140022,
+   0xFF240000,0xFF240000,0xFF220000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF250000,0xFF110038,
+   0xFF030055,0xFF1E0008,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF240000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF2B0000,0xFF140032,0xFF000068,
+   0xFF150027,0xFF280000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF2B0000,
+   0xFF260016,0xFF020060,0xFF050056,0xFF1F000D,0xFF260000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF190008,0xFF1C0003,
+   0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF1F000D,0xFF05005D,0xFF15002E,0xFF220000,0xFF200000,0xFF280004,
+   0xFF140041,0xFF110028,0xFF1E0000,0xFF1D0000,0xFF1A0000,0xFF180003,0xFF170004,
+   0xFF180003,0xFF180002,0xFF190001,0xFF190000,0xFF1B0000,0xFF1C0000,0xFF1D0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF250000,0xFF110037,0xFF030057,0xFF1C000B,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF230000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF280000,
+   0xFF12003C,0xFF00006D,0xFF160026,0xFF280000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF2B0000,0xFF260016,0xFF020060,0xFF030069,0xFF16001C,0xFF250002,
+   0xFF290000,0xFF280000,0xFF280000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF1E000A,
+   0xFF170015,0xFF1E0001,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF210000,0xFF15002D,0xFF0D004E,0xFF210004,0xFF200000,
+   0xFF210000,0xFF250000,0xFF290011,0xFF0F0038,0xFF1F0007,0xFF240000,0xFF230000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF240000,0xFF0E003B,0xFF030059,0xFF1E0009,0xFF220000,
+   0xFF220000,0xFF220000,0xFF240000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF2B0000,0xFF130036,0xFF02005F,0xFF1F000F,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF2F0003,0xFF0F003D,0xFF01006E,
+   0xFF12001F,0xFF230001,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF1F0007,0xFF18000E,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF210000,0xFF15002C,0xFF0D004D,
+   0xFF1F0005,0xFF1D0000,0xFF1D0000,0xFF200000,0xFF240013,0xFF0D0042,0xFF19000A,
+   0xFF1C0000,0xFF1A0000,0xFF180003,0xFF170005,0xFF170005,0xFF180003,0xFF180002,
+   0xFF180002,0xFF190000,0xFF1B0000,0xFF1C0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF230000,0xFF0E003B,0xFF03005B,
+   0xFF1C000B,0xFF200000,0xFF200000,0xFF200000,0xFF230000,0xFF260000,0xFF270000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF280000,0xFF110040,0xFF020065,0xFF20000E,
+   0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF2F0003,
+   0xFF0F003D,0xFF000078,0xFF010060,0xFF0C0037,0xFF1D0010,0xFF280001,0xFF280000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF1F000E,0xFF17001F,0xFF200006,0xFF210000,0xFF1F0000,
+   0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0009,
+   0xFF0B0050,0xFF1B001D,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF280000,
+   0xFF20001D,0xFF16001E,0xFF240000,0xFF230000,0xFF220000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF240001,
+   0xFF0C003F,0xFF030064,0xFF1C000C,0xFF220000,0xFF220000,0xFF240000,0xFF270000,
+   0xFF280000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF2B0000,0xFF11003D,
+   0xFF060055,0xFF230005,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF2C0000,0xFF2D000B,0xFF0E0044,0xFF01005E,0xFF0B0031,0xFF1B000C,
+   0xFF240000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF20000A,0xFF190014,0xFF210004,
+   0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0008,0xFF0B0050,0xFF1A001E,0xFF1E0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF220000,0xFF1B0023,0xFF110025,0xFF1C0000,0xFF1B0000,0xFF190002,
+   0xFF170004,0xFF170004,0xFF190001,0xFF180001,0xFF180001,0xFF190000,0xFF190000,
+   0xFF1B0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1C0000,
+   0xFF1C0000,0xFF230001,0xFF0C003F,0xFF030064,0xFF1B000D,0xFF200000,0xFF200000,
+   0xFF220000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF280000,0xFF0F0046,0xFF060059,0xFF230005,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF2C0000,0xFF2D000C,0xFF10003F,0xFF12003D,
+   0xFF010063,0xFF020055,0xFF0F002D,0xFF1D0010,0xFF260002,0xFF270000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF260000,0xFF260000,0xFF240001,0xFF1C0016,0xFF190022,
+   0xFF210007,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF210000,0xFF12002F,0xFF0E0049,0xFF210002,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF230000,0xFF28000B,0xFF10003A,0xFF200006,
+   0xFF240000,0xFF220000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF210000,0xFF200000,0xFF1E000F,0xFF070069,0xFF03007E,0xFF180017,
+   0xFF230000,0xFF240000,0xFF260000,0xFF280000,0xFF280000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF230000,0xFF210000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF290003,0xFF0B004B,0xFF09004B,0xFF250002,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF2D0000,
+   0xFF310006,0xFF150039,0xFF000065,0xFF020052,0xFF0E0026,0xFF1B000C,0xFF230001,
+   0xFF240000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230001,
+   0xFF1C0010,0xFF190019,0xFF220005,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF12002E,0xFF0E0049,
+   0xFF200002,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF22000D,
+   0xFF0D0044,0xFF1A0008,0xFF1D0000,0xFF1B0000,0xFF190001,0xFF190001,0xFF1A0000,
+   0xFF1B0000,0xFF1B0000,0xFF1B0000,0xFF1B0000,0xFF1D0000,0xFF1F0000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF220000,0xFF1E0000,0xFF1D0000,0xFF1D000F,0xFF070069,
+   0xFF03007E,0xFF170017,0xFF210000,0xFF220000,0xFF250000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF250000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF270004,0xFF0A0051,0xFF09004B,
+   0xFF250002,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF2C0000,0xFF320004,0xFF340004,0xFF24001D,0xFF0F0047,0xFF020062,
+   0xFF02005A,0xFF0A0039,0xFF140020,0xFF1E000F,0xFF240005,0xFF270001,0xFF270000,
+   0xFF22000A,0xFF190026,0xFF1C001F,0xFF240003,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF210000,0xFF1A000D,0xFF0F002F,
+   0xFF040069,0xFF0D0049,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF2A0002,0xFF120050,0xFF140026,0xFF240000,0xFF220000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF250000,0xFF260000,0xFF250000,0xFF230000,0xFF200005,
+   0xFF160038,0xFF1A0045,0xFF040064,0xFF0F0038,0xFF240000,0xFF270000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF250000,0xFF210012,
+   0xFF030060,0xFF0D003F,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF2A0000,0xFF320004,0xFF23001F,
+   0xFF0F004A,0xFF020062,0xFF020052,0xFF09002F,0xFF130018,0xFF1B000B,0xFF210003,
+   0xFF230000,0xFF230000,0xFF200008,0xFF17001F,0xFF1B0018,0xFF230002,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF1C0008,0xFF100028,0xFF040066,0xFF0D0048,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF240002,0xFF100057,0xFF10002C,0xFF1E0000,
+   0xFF1C0000,0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1E0000,0xFF200000,0xFF210000,0xFF230000,0xFF240000,0xFF230000,
+   0xFF210000,0xFF1E0006,0xFF150039,0xFF1A0045,0xFF030064,0xFF0E0038,0xFF220000,
+   0xFF250000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF1F0015,0xFF030063,0xFF0E003E,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF290000,
+   0xFF290000,0xFF310000,0xFF350002,0xFF2A0016,0xFF0E0046,0xFF00006E,0xFF01006C,
+   0xFF020054,0xFF070040,0xFF0C0032,0xFF0F002F,0xFF0B0061,0xFF140035,0xFF1D0011,
+   0xFF1C000E,0xFF1C000E,0xFF1C000F,0xFF1C000F,0xFF1C0010,0xFF1B0012,0xFF18001A,
+   0xFF12002F,0xFF0C0046,0xFF040063,0xFF000076,0xFF030086,0xFF040079,0xFF0C004F,
+   0xFF120035,0xFF17001C,0xFF1D0008,0xFF210000,0xFF230000,0xFF240006,0xFF0B005A,
+   0xFF070051,0xFF200006,0xFF230000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF240003,0xFF190020,0xFF230012,0xFF320001,0xFF13003C,
+   0xFF050057,0xFF230007,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF240000,0xFF220000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF240000,0xFF270000,0xFF14002C,0xFF00006D,0xFF0F0037,0xFF250000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF270000,0xFF2F0000,0xFF330003,0xFF290018,0xFF0E0048,
+   0xFF00006B,0xFF010060,0xFF020043,0xFF060031,0xFF0B0027,0xFF0E0025,0xFF0A0051,
+   0xFF12002A,0xFF1C000D,0xFF1C000B,0xFF1C000D,0xFF1C000D,0xFF1C000E,0xFF1B000E,
+   0xFF1A000F,0xFF180015,0xFF130025,0xFF0D0039,0xFF040057,0xFF00006F,0xFF020082,
+   0xFF030077,0xFF0B0050,0xFF110036,0xFF15001D,0xFF1B0008,0xFF1F0000,0xFF1F0000,
+   0xFF1F0008,0xFF0B0062,0xFF06005A,0xFF1B0007,0xFF1E0000,0xFF1D0000,0xFF1A0000,
+   0xFF1A0000,0xFF1D0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF230000,0xFF230000,0xFF230000,0xFF220003,0xFF180021,0xFF220013,
+   0xFF300001,0xFF12003D,0xFF060056,0xFF220007,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF240000,0xFF230000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF260000,0xFF130030,0xFF00006C,
+   0xFF0F0035,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF260000,0xFF2A0000,
+   0xFF320000,0xFF31000A,0xFF090049,0xFF040096,0xFF0700A5,0xFF050094,0xFF02007F,
+   0xFF010077,0xFF020086,0xFF010067,0xFF040060,0xFF05005D,0xFF05005D,0xFF05005D,
+   0xFF06005F,0xFF070062,0xFF080061,0xFF0A0061,0xFF0D005D,0xFF0C0058,0xFF0B0051,
+   0xFF0D0044,0xFF0F003C,0xFF0C0046,0xFF070055,0xFF040066,0xFF02006F,0xFF050062,
+   0xFF0B004A,0xFF0E003A,0xFF080044,0xFF020073,0xFF01006D,0xFF110027,0xFF220000,
+   0xFF200000,0xFF1E0000,0xFF1E0000,0xFF200000,0xFF210000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF260000,0xFF270000,0xFF1F0016,
+   0xFF1E0019,0xFF270000,0xFF2B0000,0xFF280015,0xFF030062,0xFF160025,0xFF280000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF260000,0xFF21000F,
+   0xFF050058,0xFF00007D,0xFF0E0034,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF250000,0xFF280000,0xFF300000,0xFF30000A,0xFF08004B,0xFF050095,0xFF0700A0,
+   0xFF05008D,0xFF020073,0xFF000069,0xFF010077,0xFF01005E,0xFF040059,0xFF050058,
+   0xFF050059,0xFF050058,0xFF06005A,0xFF07005C,0xFF08005D,0xFF0A005C,0xFF0D0056,
+   0xFF0C0051,0xFF0B004A,0xFF0E003D,0xFF100038,0xFF0D0044,0xFF070054,0xFF040066,
+   0xFF02006F,0xFF050062,0xFF0B004B,0xFF0D003E,0xFF07004C,0xFF02007C,0xFF020077,
+   0xFF0F002D,0xFF1E0000,0xFF1D0000,0xFF1A0001,0xFF190001,0xFF1D0000,0xFF200000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF1D0018,0xFF1C001A,0xFF250000,0xFF2A0000,0xFF270015,0xFF030060,
+   0xFF160023,0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF260000,0xFF200010,0xFF050059,0xFF000079,0xFF0F0033,0xFF260000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF260000,0xFF280000,0xFF320000,0xFF17002C,
+   0xFF030084,0xFF0800AD,0xFF030087,0xFF03005D,0xFF0F003E,0xFF1B002A,0xFF1F0022,
+   0xFF250019,0xFF260016,0xFF250016,0xFF250015,0xFF260015,0xFF270014,0xFF27000F,
+   0xFF29000A,0xFF2B0004,0xFF2B0003,0xFF280003,0xFF260002,0xFF270001,0xFF280003,
+   0xFF270008,0xFF250010,0xFF200020,0xFF150039,0xFF0B0054,0xFF030070,0xFF020084,
+   0xFF0700A5,0xFF050096,0xFF020057,0xFF170018,0xFF200000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF200000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF250000,0xFF260000,0xFF260001,0xFF190026,0xFF230009,0xFF260000,0xFF260000,
+   0xFF2E0002,0xFF0E0048,0xFF050054,0xFF21000A,0xFF270000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF270000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,
+   0xFF270000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF250000,0xFF260002,0xFF170028,0xFF1B003D,0xFF110052,0xFF0A0045,
+   0xFF220001,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF250000,0xFF270000,
+   0xFF310000,0xFF16002D,0xFF030084,0xFF0800AD,0xFF030088,0xFF03005D,0xFF0F003D,
+   0xFF1B002A,0xFF200022,0xFF260019,0xFF270016,0xFF260015,0xFF260014,0xFF270013,
+   0xFF290012,0xFF2A000E,0xFF2B000A,0xFF2E0004,0xFF2E0003,0xFF2B0003,0xFF2A0001,
+   0xFF2A0000,0xFF2A0002,0xFF290008,0xFF260010,0xFF200020,0xFF160038,0xFF0B0054,
+   0xFF030072,0xFF030089,0xFF0800A9,0xFF06009B,0xFF02005F,0xFF14001B,0xFF1D0000,
+   0xFF1B0000,0xFF1A0000,0xFF1C0000,0xFF1F0000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230001,0xFF180028,0xFF210009,
+   0xFF250000,0xFF260000,0xFF2F0002,0xFF0E0046,0xFF050050,0xFF200009,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250003,0xFF170029,0xFF1C003C,
+   0xFF11004F,0xFF0A0042,0xFF230001,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF260000,0xFF2E0000,0xFF1A0026,0xFF010079,0xFF010077,0xFF090043,
+   0xFF220017,0xFF2C0002,0xFF2C0000,0xFF290000,0xFF260000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF210000,
+   0xFF1F0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF210000,0xFF240000,
+   0xFF280000,0xFF2A0004,0xFF23001B,0xFF0A004F,0xFF030081,0xFF0800A7,0xFF030087,
+   0xFF04004C,0xFF180012,0xFF1F0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF200000,
+   0xFF220000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF250000,0xFF200010,
+   0xFF190023,0xFF250000,0xFF260000,0xFF250000,0xFF2B0000,0xFF1F0023,0xFF000068,
+   0xFF0E0033,0xFF250002,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF1C0016,
+   0xFF200014,0xFF2D0000,0xFF290015,0xFF080052,0xFF1D000B,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF240000,0xFF250000,0xFF2D0000,0xFF190027,0xFF01007A,
+   0xFF010078,0xFF090044,0xFF210017,0xFF2C0002,0xFF2C0000,0xFF2A0000,0xFF280000,
+   0xFF270000,0xFF270000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF230000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF260000,0xFF290000,0xFF2B0004,0xFF23001B,0xFF0A0052,0xFF030084,
+   0xFF0800AA,0xFF03008D,0xFF040053,0xFF160014,0xFF1D0000,0xFF1A0000,0xFF1A0000,
+   0xFF1D0000,0xFF200000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF1D0011,0xFF180025,0xFF240000,0xFF250000,0xFF260000,0xFF2C0000,
+   0xFF200021,0xFF000063,0xFF0E0030,0xFF250002,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF260000,0xFF1C0018,0xFF210014,0xFF300000,0xFF2B0014,0xFF09004E,0xFF1E000A,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF2A0000,
+   0xFF110038,0xFF000067,0xFF0D0039,0xFF26000B,0xFF280000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF200000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF280000,
+   0xFF29000D,0xFF0D0040,0xFF010075,0xFF0500A0,0xFF020080,0xFF050046,0xFF1A000D,
+   0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1E0000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF19001C,0xFF1F000D,0xFF230000,0xFF240000,
+   0xFF240000,0xFF270000,0xFF29000D,0xFF04005A,0xFF010060,0xFF150021,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF1F000F,0xFF08005E,0xFF150030,0xFF220001,0xFF2B0003,
+   0xFF10004B,0xFF180017,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF290000,0xFF110039,0xFF000068,0xFF0D003B,0xFF25000B,0xFF280000,
+   0xFF240000,0xFF230000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF280000,0xFF29000D,0xFF0D0042,0xFF010077,0xFF0600A2,0xFF030085,
+   0xFF05004C,0xFF18000E,0xFF1B0000,0xFF190001,0xFF1B0000,0xFF1E0000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF18001E,0xFF1E000E,
+   0xFF230000,0xFF240000,0xFF250000,0xFF280000,0xFF2A000C,0xFF040056,0xFF01005B,
+   0xFF15001E,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF1F000E,0xFF08005C,0xFF16002D,
+   0xFF250001,0xFF2D0003,0xFF110047,0xFF190015,0xFF250000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF240009,0xFF050056,0xFF0A0043,0xFF250009,
+   0xFF270000,0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF200000,0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,
+   0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF240000,0xFF28000A,0xFF0E003E,
+   0xFF010077,0xFF0600A1,0xFF020078,0xFF08003D,0xFF1A0007,0xFF1C0000,0xFF1C0000,
+   0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF1E0008,
+   0xFF16001F,0xFF220001,0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF2C0004,
+   0xFF0B0044,0xFF01007A,0xFF030050,0xFF1B0013,0xFF270000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF1A0017,0xFF070056,
+   0xFF090071,0xFF0D0059,0xFF110040,0xFF190027,0xFF0B0053,0xFF16001E,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF23000A,0xFF050057,
+   0xFF0A0045,0xFF250009,0xFF270000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF230000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF260000,
+   0xFF29000A,0xFF0E003F,0xFF010079,0xFF0600A4,0xFF02007B,0xFF070040,0xFF180008,
+   0xFF1A0001,0xFF1B0000,0xFF1E0000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF230000,0xFF1E0008,0xFF16001F,0xFF220001,0xFF230000,0xFF230000,0xFF240000,
+   0xFF250000,0xFF2D0004,0xFF0B0040,0xFF000076,0xFF03004B,0xFF1B0012,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250001,
+   0xFF1A001A,0xFF070054,0xFF09006E,0xFF0E0055,0xFF12003D,0xFF1B0025,0xFF0B004F,
+   0xFF17001C,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF260000,
+   0xFF1E001A,0xFF03005C,0xFF200014,0xFF280000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF210000,0xFF1E0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,
+   0xFF1E0000,0xFF1D0000,0xFF220000,0xFF27000B,0xFF0C0044,0xFF020081,0xFF0600A2,
+   0xFF01006F,0xFF0A0034,0xFF1A0005,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF160015,0xFF180017,0xFF210000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF220000,0xFF2A0001,0xFF0F0035,0xFF03008A,0xFF020081,
+   0xFF050044,0xFF1B0013,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF230003,0xFF12002C,0xFF090059,0xFF190039,0xFF29000B,0xFF2C0006,0xFF270019,
+   0xFF12004A,0xFF02007E,0xFF12002D,0xFF230000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF1D001B,0xFF03005E,0xFF1F0015,0xFF270000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF230000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF240000,0xFF29000A,0xFF0C0042,
+   0xFF020080,0xFF0600A1,0xFF010070,0xFF090037,0xFF1A0005,0xFF1D0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF180015,0xFF190017,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF2B0001,0xFF100031,
+   0xFF020087,0xFF02007D,0xFF050040,0xFF1B0011,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF240004,0xFF130030,0xFF09005A,0xFF1A0037,0xFF2B000A,
+   0xFF2E0005,0xFF290018,0xFF130047,0xFF020079,0xFF13002A,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF270000,0xFF150034,0xFF09004F,0xFF260003,
+   0xFF260000,0xFF260000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF220000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,
+   0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF230000,0xFF26000F,0xFF08004F,0xFF04008F,0xFF0700A3,0xFF020071,0xFF0B0036,
+   0xFF1B0005,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,
+   0xFF13001D,0xFF1C000B,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF250004,0xFF0A003C,0xFF050093,0xFF0900AE,0xFF02007F,0xFF040047,0xFF180017,
+   0xFF240001,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF230000,0xFF240000,0xFF250000,
+   0xFF260000,0xFF240003,0xFF1E000D,0xFF16001E,0xFF120034,0xFF190038,0xFF280014,
+   0xFF2A0000,0xFF250000,0xFF230000,0xFF270000,0xFF2C0006,0xFF0C004D,0xFF060051,
+   0xFF1E0006,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF250000,0xFF140036,
+   0xFF090051,0xFF250003,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF230000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF250000,0xFF27000E,0xFF08004B,0xFF04008C,0xFF0700A2,
+   0xFF020072,0xFF0B0036,0xFF1C0004,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF15001C,0xFF1D000B,0xFF220000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF260003,0xFF0A0039,0xFF040090,0xFF0800AB,0xFF02007A,
+   0xFF040041,0xFF180016,0xFF260001,0xFF260000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF230005,0xFF1E0010,0xFF160022,0xFF130038,
+   0xFF1B003B,0xFF2A0013,0xFF2C0000,0xFF270000,0xFF250000,0xFF290000,0xFF2E0006,
+   0xFF0C0048,0xFF07004C,0xFF200005,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF270005,0xFF0C0062,0xFF11003A,0xFF270000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF210000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1D0000,
+   0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF250000,0xFF20001B,
+   0xFF040063,0xFF06009C,0xFF02007E,0xFF010071,0xFF0A0044,0xFF1A0009,0xFF1E0000,
+   0xFF1D0000,0xFF1C0000,0xFF1D0000,0xFF1B0007,0xFF170011,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF230000,0xFF170017,0xFF020056,0xFF0800A6,
+   0xFF0B00B6,0xFF0A00B0,0xFF030085,0xFF02004E,0xFF110023,0xFF210005,0xFF240000,
+   0xFF240000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF220002,
+   0xFF1E0007,0xFF1B000F,0xFF170017,0xFF130022,0xFF0D0031,0xFF0A003B,0xFF0E003C,
+   0xFF1D0026,0xFF280010,0xFF290001,0xFF260000,0xFF240000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF280000,0xFF1F001C,0xFF000061,0xFF120025,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF250006,0xFF0C0064,0xFF10003C,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF230000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF270000,0xFF210019,0xFF03005E,0xFF050099,0xFF02007D,0xFF010070,0xFF0B0042,
+   0xFF1C0008,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1C0007,0xFF180010,
+   0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF180017,
+   0xFF020054,0xFF0700A3,0xFF0A00B3,0xFF0800AD,0xFF030080,0xFF020048,0xFF120020,
+   0xFF220005,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF250000,0xFF240002,0xFF210007,0xFF1D000F,0xFF190018,0xFF130023,0xFF0D0033,
+   0xFF0A003C,0xFF0F003F,0xFF1E002A,0xFF290011,0xFF2C0001,0xFF290000,0xFF270000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF2B0000,0xFF210019,0xFF01005B,0xFF140021,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF1E0013,0xFF040065,0xFF170025,
+   0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,
+   0xFF1D0000,0xFF1D0000,0xFF1F0000,0xFF290001,0xFF130037,0xFF010078,0xFF0E0038,
+   0xFF1F0020,0xFF120047,0xFF09004E,0xFF160018,0xFF1D0000,0xFF1D0000,0xFF1D0002,
+   0xFF160013,0xFF1C0003,0xFF1E0000,0xFF200000,0xFF200000,0xFF210000,0xFF1F0004,
+   0xFF12001F,0xFF03004B,0xFF04008B,0xFF0900B0,0xFF0A00AF,0xFF0900AE,0xFF0900AC,
+   0xFF040092,0xFF010063,0xFF09003A,0xFF160018,0xFF1B000C,0xFF1F0004,0xFF200004,
+   0xFF1C000C,0xFF160018,0xFF100026,0xFF0A0036,0xFF050048,0xFF020057,0xFF020065,
+   0xFF01006B,0xFF0C0053,0xFF24001D,0xFF2C0007,0xFF2A0000,0xFF270000,0xFF260000,
+   0xFF250000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF270009,
+   0xFF040055,0xFF060049,0xFF1F0005,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF1B0015,
+   0xFF040069,0xFF160027,0xFF260000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF240000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF2B0001,0xFF130034,
+   0xFF010075,0xFF0E0036,0xFF20001F,0xFF120045,0xFF0A004B,0xFF170016,0xFF1F0000,
+   0xFF1F0000,0xFF1F0002,0xFF170011,0xFF1E0003,0xFF210000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF200004,0xFF13001D,0xFF030049,0xFF03008A,0xFF0900AE,0xFF0900AB,
+   0xFF0900AB,0xFF0800AA,0xFF04008E,0xFF01005B,0xFF090032,0xFF170016,0xFF1C000D,
+   0xFF200005,0xFF210004,0xFF1D000D,0xFF18001A,0xFF110029,0xFF0B0037,0xFF060046,
+   0xFF030053,0xFF020060,0xFF000065,0xFF0C004F,0xFF26001B,0xFF2E0006,0xFF2C0000,
+   0xFF290000,0xFF280000,0xFF270000,0xFF260000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF260000,0xFF290008,0xFF05004F,0xFF070044,0xFF210004,0xFF240000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240002,
+   0xFF200009,0xFF200015,0xFF04005A,0xFF1B001A,0xFF270000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF250000,0xFF260000,0xFF250000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1E0000,
+   0xFF230000,0xFF240012,0xFF060069,0xFF190021,0xFF270000,0xFF290002,0xFF1E0027,
+   0xFF080057,0xFF0F0030,0xFF1A0007,0xFF140019,0xFF13001B,0xFF1E0000,0xFF1F0000,
+   0xFF1E0000,0xFF1C0007,0xFF14001F,0xFF070045,0xFF00005D,0xFF000068,0xFF02006D,
+   0xFF020062,0xFF020059,0xFF020058,0xFF02005C,0xFF020067,0xFF01006C,0xFF000066,
+   0xFF00005F,0xFF020059,0xFF06004F,0xFF06004D,0xFF020055,0xFF010061,0xFF020074,
+   0xFF040089,0xFF07009B,0xFF0900A7,0xFF050091,0xFF09004B,0xFF25000B,0xFF290000,
+   0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF250000,0xFF25000A,0xFF050052,0xFF010064,0xFF13001D,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF220002,0xFF1D000B,0xFF1E0018,0xFF04005F,0xFF19001C,0xFF250000,
+   0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF240000,0xFF220000,0xFF200000,0xFF200000,0xFF1F0000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF250000,0xFF260011,0xFF060065,0xFF1A0020,0xFF280000,
+   0xFF2B0002,0xFF1F0025,0xFF080054,0xFF10002D,0xFF1B0006,0xFF150017,0xFF140019,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1E0006,0xFF15001F,0xFF080044,0xFF00005C,
+   0xFF010069,0xFF02006F,0xFF020062,0xFF020056,0xFF020054,0xFF02005A,0xFF020065,
+   0xFF010069,0xFF000061,0xFF00005A,0xFF020056,0xFF06004F,0xFF06004D,0xFF020055,
+   0xFF010061,0xFF010073,0xFF030086,0xFF050095,0xFF0700A1,0xFF040088,0xFF0A0042,
+   0xFF28000A,0xFF2B0000,0xFF290000,0xFF280000,0xFF280000,0xFF270000,0xFF270000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF260009,0xFF05004E,
+   0xFF010060,0xFF14001A,0xFF250000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF200009,0xFF1F000B,0xFF260003,0xFF250011,0xFF040059,
+   0xFF1D0017,0xFF270000,0xFF260000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF220000,0xFF220000,0xFF200000,0xFF1E0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1A0000,0xFF1B0000,0xFF1B0000,
+   0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1E0000,0xFF200000,0xFF290000,0xFF140046,
+   0xFF140030,0xFF200000,0xFF200000,0xFF280000,0xFF220019,0xFF06005E,0xFF05005F,
+   0xFF03005C,0xFF080039,0xFF0F0020,0xFF100024,0xFF09003E,0xFF050052,0xFF050051,
+   0xFF09003D,0xFF0D002C,0xFF11001F,0xFF160018,0xFF1A0014,0xFF1F000E,0xFF21000D,
+   0xFF1F0010,0xFF1B0015,0xFF17001C,0xFF140026,0xFF100032,0xFF0C003B,0xFF080041,
+   0xFF070047,0xFF060049,0xFF030050,0xFF020068,0xFF050093,0xFF0B00B5,0xFF0B00B2,
+   0xFF020069,0xFF170019,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF240002,
+   0xFF120024,0xFF02006C,0xFF04008C,0xFF030048,0xFF170016,0xFF220001,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF220001,0xFF1E0009,0xFF1C000D,0xFF230004,
+   0xFF230013,0xFF04005E,0xFF1B0018,0xFF250000,0xFF250000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF220000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF2A0000,0xFF140044,0xFF14002F,0xFF210000,0xFF210000,0xFF290000,0xFF240018,
+   0xFF06005A,0xFF05005B,0xFF030057,0xFF090036,0xFF10001E,0xFF110023,0xFF0A003C,
+   0xFF050051,0xFF050052,0xFF0A0041,0xFF0E0031,0xFF130025,0xFF17001C,0xFF1C0015,
+   0xFF21000F,0xFF23000C,0xFF21000F,0xFF1D0013,0xFF180019,0xFF150023,0xFF110030,
+   0xFF0C003A,0xFF09003D,0xFF080042,0xFF060046,0xFF03004E,0xFF010063,0xFF03008C,
+   0xFF0900AF,0xFF0900AD,0xFF02005F,0xFF1A0014,0xFF290000,0xFF270000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF270000,0xFF270000,
+   0xFF260000,0xFF250002,0xFF130023,0xFF02006A,0xFF030088,0xFF040043,0xFF190013,
+   0xFF250001,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250001,0xFF220009,
+   0xFF260002,0xFF280000,0xFF1A0020,0xFF010063,0xFF1A001E,0xFF270000,0xFF260000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF1E0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF190000,0xFF1A0000,0xFF1C0000,
+   0xFF1F0000,0xFF1F0000,0xFF240000,0xFF1E0024,0xFF090056,0xFF1D0005,0xFF1F0000,
+   0xFF1F0000,0xFF290000,0xFF13002E,0xFF030089,0xFF0700A5,0xFF02007E,0xFF01006F,
+   0xFF02006C,0xFF090053,0xFF160028,0xFF23000A,0xFF260001,0xFF270000,0xFF280000,
+   0xFF260000,0xFF240000,0xFF220000,0xFF220000,0xFF230000,0xFF250000,0xFF290000,
+   0xFF2C0000,0xFF2D0000,0xFF2D0001,0xFF2B0003,0xFF2B0005,0xFF2A0006,0xFF26000C,
+   0xFF1C001A,0xFF050046,0xFF050092,0xFF0A00AE,0xFF02005E,0xFF190011,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF200002,0xFF1D0009,
+   0xFF1A0013,0xFF17001D,0xFF130029,0xFF090041,0xFF01005E,0xFF010079,0xFF030084,
+   0xFF02007D,0xFF020059,0xFF0E002E,0xFF1D000A,0xFF230000,0xFF230000,0xFF1E0009,
+   0xFF1B0012,0xFF1F000C,0xFF230002,0xFF250000,0xFF180023,0xFF01006A,0xFF180020,
+   0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF220000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF260000,0xFF1F0023,0xFF090055,
+   0xFF1E0005,0xFF200000,0xFF210000,0xFF2A0000,0xFF14002B,0xFF020084,0xFF0600A3,
+   0xFF02007C,0xFF01006F,0xFF02006B,0xFF090053,0xFF160029,0xFF23000B,0xFF270003,
+   0xFF280001,0xFF290000,0xFF280000,0xFF260000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF280000,0xFF2C0000,0xFF2E0000,0xFF2F0000,0xFF2F0001,0xFF2D0002,0xFF2D0004,
+   0xFF2D0006,0xFF2A000C,0xFF1F001A,0xFF060041,0xFF04008B,0xFF0800A9,0xFF020054,
+   0xFF1C000E,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF250000,0xFF240000,
+   0xFF230001,0xFF200007,0xFF1C0011,0xFF19001A,0xFF140027,0xFF09003F,0xFF01005C,
+   0xFF010077,0xFF020081,0xFF010079,0xFF020054,0xFF0F002B,0xFF1F0009,0xFF250000,
+   0xFF250000,0xFF210008,0xFF1D0011,0xFF270000,0xFF270000,0xFF22000B,0xFF080046,
+   0xFF02007A,0xFF180020,0xFF270000,0xFF260000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1C0000,0xFF1B0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1A0000,0xFF190000,
+   0xFF190000,0xFF190001,0xFF190000,0xFF1C0000,0xFF1E0000,0xFF1F0000,0xFF220000,
+   0xFF220011,0xFF040065,0xFF11002A,0xFF200000,0xFF1F0000,0xFF220002,0xFF0D0038,
+   0xFF01007C,0xFF030076,0xFF020052,0xFF08003E,0xFF16001C,0xFF230003,0xFF240000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF2D0000,0xFF1D0019,0xFF02005B,
+   0xFF0700A6,0xFF02006D,0xFF110020,0xFF210000,0xFF220000,0xFF220001,0xFF1E000A,
+   0xFF15001C,0xFF0E002E,0xFF080042,0xFF040056,0xFF04005C,0xFF080055,0xFF0B004D,
+   0xFF0F0041,0xFF140036,0xFF13002D,0xFF13002D,0xFF12003E,0xFF0B0059,0xFF050062,
+   0xFF050057,0xFF110033,0xFF15002D,0xFF1A0014,0xFF230003,0xFF240000,0xFF240000,
+   0xFF1F000C,0xFF07004C,0xFF030080,0xFF160023,0xFF250000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF240000,0xFF230000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF230000,0xFF220011,0xFF040065,0xFF12002A,0xFF210000,0xFF210000,
+   0xFF240002,0xFF0E0035,0xFF01007A,0xFF020079,0xFF020058,0xFF080043,0xFF17001E,
+   0xFF240003,0xFF240000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF230000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF290000,0xFF310000,
+   0xFF200018,0xFF010057,0xFF0600A1,0xFF010064,0xFF13001A,0xFF250000,0xFF250000,
+   0xFF240001,0xFF200009,0xFF17001A,0xFF0F0029,0xFF09003B,0xFF04004E,0xFF040054,
+   0xFF08004F,0xFF0C0048,0xFF10003D,0xFF140034,0xFF14002C,0xFF14002B,0xFF12003B,
+   0xFF0B0055,0xFF05005E,0xFF060053,0xFF120031,0xFF17002A,0xFF1D0011,0xFF250003,
+   0xFF160023,0xFF140026,0xFF070041,0xFF02007B,0xFF030086,0xFF140024,0xFF270000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1E0000,
+   0xFF1D0000,0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF190001,0xFF190002,0xFF180002,0xFF1A0000,
+   0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF2A0002,0xFF12003B,0xFF05005F,
+   0xFF14001A,0xFF15001E,0xFF0C003C,0xFF030057,0xFF090041,0xFF14001D,0xFF1C000C,
+   0xFF200003,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1E0000,0xFF1D0000,0xFF1E0000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF240000,0xFF2B0004,0xFF0B0032,0xFF04008B,0xFF050093,0xFF02004F,
+   0xFF0B0032,0xFF0E0036,0xFF0B0048,0xFF060053,0xFF060052,0xFF0B0049,0xFF12003E,
+   0xFF1C0026,0xFF230013,0xFF290007,0xFF2B0003,0xFF2C0001,0xFF2E0000,0xFF2E0000,
+   0xFF2E0000,0xFF2E0000,0xFF2D0005,0xFF2B000D,0xFF210028,0xFF0F005F,0xFF0B0073,
+   0xFF0C0048,0xFF0F0038,0xFF140028,0xFF12002A,0xFF070047,0xFF030081,0xFF04008C,
+   0xFF120028,0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF250000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF2A0002,
+   0xFF12003B,0xFF05005F,0xFF150019,0xFF16001D,0xFF0D003C,0xFF030059,0xFF090045,
+   0xFF150022,0xFF1C0010,0xFF200004,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF270000,0xFF2F0004,0xFF0C0033,0xFF030088,
+   0xFF04008D,0xFF030047,0xFF0C002E,0xFF100033,0xFF0B0044,0xFF06004F,0xFF07004E,
+   0xFF0C0043,0xFF130038,0xFF1E0023,0xFF260010,0xFF2C0006,0xFF2E0002,0xFF2E0000,
+   0xFF2F0000,0xFF2F0000,0xFF2F0000,0xFF300000,0xFF2F0004,0xFF2D000D,0xFF230026,
+   0xFF0F005C,0xFF0A0070,0xFF0D0045,0xFF100037,0xFF090055,0xFF010067,0xFF010079,
+   0xFF0600A3,0xFF03008A,0xFF0D0033,0xFF260001,0xFF260000,0xFF260000,0xFF250000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,
+   0xFF1B0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,
+   0xFF190001,0xFF180002,0xFF180002,0xFF1A0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,
+   0xFF1F0000,0xFF260000,0xFF1A0020,0xFF020072,0xFF020071,0xFF02005D,0xFF0D003A,
+   0xFF1D0014,0xFF240003,0xFF230000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF210000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF2A0000,
+   0xFF1A001B,0xFF020067,0xFF0900AE,0xFF06009A,0xFF010075,0xFF02005A,0xFF0F0039,
+   0xFF1E001A,0xFF270009,0xFF280002,0xFF270000,0xFF250000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF240000,0xFF250000,
+   0xFF270000,0xFF2C0000,0xFF2E0005,0xFF2B000F,0xFF28001C,0xFF1B0039,0xFF0A0058,
+   0xFF01006D,0xFF01007F,0xFF0700A7,0xFF04008F,0xFF0B0038,0xFF240001,0xFF250000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF260000,0xFF1A0020,0xFF020073,0xFF02006F,
+   0xFF02005A,0xFF0E003A,0xFF1F0015,0xFF250004,0xFF240000,0xFF210000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF2D0000,0xFF1C001C,0xFF010067,0xFF0800AB,0xFF050096,0xFF010070,
+   0xFF020056,0xFF100035,0xFF200018,0xFF290008,0xFF2B0002,0xFF2B0000,0xFF290000,
+   0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF270000,0xFF290000,0xFF2E0000,0xFF2F0004,0xFF2C000F,0xFF29001C,
+   0xFF1E0034,0xFF310007,0xFF220020,0xFF0D0042,0xFF020066,0xFF01007C,0xFF070044,
+   0xFF240004,0xFF260000,0xFF260000,0xFF250000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1A0000,0xFF1B0000,0xFF1B0000,
+   0xFF1A0000,0xFF190000,0xFF1A0000,0xFF1A0000,0xFF190001,0xFF190002,0xFF1A0001,
+   0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF200006,0xFF090040,
+   0xFF02007D,0xFF030055,0xFF180019,0xFF240001,0xFF220000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,
+   0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1E0000,0xFF1F0000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF260000,0xFF25000B,0xFF04004A,0xFF0700A3,
+   0xFF04008C,0xFF040048,0xFF1D0016,0xFF290001,0xFF260000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF250000,0xFF280000,0xFF2E0000,0xFF2F0007,0xFF200023,0xFF0C0048,0xFF02006C,
+   0xFF010082,0xFF060049,0xFF220005,0xFF250000,0xFF250000,0xFF250000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210006,0xFF09003F,0xFF02007B,0xFF030052,0xFF190018,0xFF250001,0xFF240000,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF200000,0xFF210000,0xFF220000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF280000,0xFF28000C,
+   0xFF04004A,0xFF0600A0,0xFF030088,0xFF040044,0xFF1E0014,0xFF2B0001,0xFF280000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF270000,0xFF2A0000,0xFF300000,0xFF280000,0xFF2E0000,
+   0xFF310004,0xFF200021,0xFF030055,0xFF040055,0xFF210009,0xFF260000,0xFF260000,
+   0xFF240000,0xFF230000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,
+   0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,
+   0xFF1B0000,0xFF1A0000,0xFF190000,0xFF1B0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF200000,0xFF120024,0xFF010069,0xFF030064,0xFF14001A,0xFF220000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF290003,0xFF09003B,0xFF020082,0xFF030050,0xFF190018,0xFF260000,
+   0xFF240000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF220000,
+   0xFF240000,0xFF2B0000,0xFF2F0005,0xFF1E0024,0xFF03005B,0xFF04005A,0xFF20000A,
+   0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF230000,0xFF140021,0xFF010061,0xFF03005F,
+   0xFF150019,0xFF230000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF260000,0xFF2C0003,0xFF0A003B,0xFF02007D,0xFF03004A,
+   0xFF1B0015,0xFF280000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF260000,0xFF2F0000,0xFF200021,
+   0xFF03005E,0xFF1B0015,0xFF250000,0xFF240000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,
+   0xFF1A0000,0xFF190001,0xFF190000,0xFF1A0000,0xFF1B0000,0xFF1B0000,0xFF1B0000,
+   0xFF1C0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1C000C,0xFF05004D,
+   0xFF000074,0xFF0C0033,0xFF210001,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF260003,0xFF08003D,
+   0xFF010063,0xFF150021,0xFF250001,0xFF230000,0xFF240000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF230000,
+   0xFF2D0000,0xFF1F0023,0xFF030060,0xFF1A0015,0xFF240000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF20000A,0xFF050045,0xFF000068,0xFF0D002E,0xFF220001,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF290003,0xFF090038,0xFF00005D,0xFF17001D,0xFF270000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF2D0003,0xFF0D004E,0xFF0D003C,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1D0000,
+   0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF190000,0xFF1A0000,
+   0xFF190000,0xFF1A0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,
+   0xFF1C0000,0xFF1E0000,0xFF11002A,0xFF01006C,0xFF02005C,0xFF180011,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1D0000,
+   0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1D0000,
+   0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240008,0xFF05004B,0xFF040057,0xFF200009,0xFF230000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF230000,0xFF2C0003,0xFF0D0050,
+   0xFF0D003E,0xFF210001,0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF230000,0xFF130024,0xFF010061,0xFF02004E,
+   0xFF19000E,0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF230000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF260006,0xFF050040,0xFF040052,
+   0xFF220008,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF290000,0xFF24001C,0xFF050063,0xFF150021,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,
+   0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF190000,0xFF180002,0xFF190001,0xFF1A0000,
+   0xFF1B0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1D0000,0xFF190011,0xFF040055,
+   0xFF02007F,0xFF070040,0xFF1D0003,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF200000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF250000,0xFF21000E,
+   0xFF020055,0xFF08004B,0xFF210003,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF220000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF270000,0xFF23001E,0xFF050065,0xFF150021,0xFF210000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF1D000F,0xFF04004B,0xFF010072,0xFF070036,0xFF1F0003,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF260000,0xFF22000B,0xFF02004B,0xFF080047,0xFF230002,0xFF250000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF240000,0xFF2C0001,0xFF10004A,
+   0xFF05005E,0xFF1B000A,0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF200000,
+   0xFF1F0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF190001,
+   0xFF190002,0xFF180003,0xFF190001,0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF1C0000,
+   0xFF1C0000,0xFF1E0003,0xFF0B003E,0xFF020084,0xFF030082,0xFF0C002C,0xFF1E0000,
+   0xFF1D0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1B0000,0xFF1B0000,0xFF1B0000,
+   0xFF1C0000,0xFF1D0000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF260000,0xFF1B0016,0xFF00005E,0xFF09003F,0xFF230002,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF2B0001,0xFF10004B,0xFF05005D,0xFF1C0009,0xFF220000,0xFF220000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220002,0xFF0C0036,0xFF01007A,0xFF020071,
+   0xFF0E0023,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF270000,0xFF1C0014,0xFF000059,
+   0xFF0A003C,0xFF240001,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF280000,0xFF18002D,0xFF000076,0xFF10002C,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF210000,0xFF1F0000,0xFF1E0000,0xFF1D0000,
+   0xFF1C0000,0xFF1B0000,0xFF190001,0xFF180003,0xFF180003,0xFF180002,0xFF190001,
+   0xFF1A0001,0xFF190001,0xFF1A0001,0xFF1A0000,0xFF1C0000,0xFF140024,0xFF02006A,
+   0xFF02007B,0xFF010073,0xFF11001F,0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,
+   0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF1B0000,0xFF190000,
+   0xFF190000,0xFF1A0000,0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF270000,
+   0xFF120026,0xFF000065,0xFF0C0032,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF270000,0xFF18002D,0xFF000074,
+   0xFF11002A,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF17001F,0xFF020061,0xFF02006F,0xFF00005E,0xFF130017,0xFF200000,0xFF1E0000,
+   0xFF1E0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF280000,0xFF120024,0xFF000062,0xFF0C0030,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF270000,
+   0xFF1D0020,0xFF01006F,0xFF060055,0xFF1C0007,0xFF1F0000,0xFF1E0000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1B0000,0xFF190002,
+   0xFF180004,0xFF180005,0xFF180005,0xFF180004,0xFF180003,0xFF180004,0xFF180004,
+   0xFF1A0001,0xFF170013,0xFF06005C,0xFF140036,0xFF130036,0xFF00006A,0xFF11001A,
+   0xFF190000,0xFF190000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF190000,
+   0xFF190000,0xFF190000,0xFF1A0000,0xFF190000,0xFF190000,0xFF190000,0xFF1A0000,
+   0xFF1C0000,0xFF1E0000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF250003,0xFF09003B,0xFF01006A,0xFF100028,
+   0xFF240000,0xFF240000,0xFF240000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF260000,0xFF1D001F,0xFF00006C,0xFF070051,0xFF1F0006,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF1C0010,0xFF070053,0xFF17002F,0xFF15002E,
+   0xFF000058,0xFF140014,0xFF1D0000,0xFF1B0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,
+   0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1D0000,0xFF1F0000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF260003,0xFF0A0039,
+   0xFF000067,0xFF100027,0xFF250000,0xFF250000,0xFF250000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF250000,0xFF200018,0xFF020068,0xFF020076,
+   0xFF0D0031,0xFF1D0005,0xFF200000,0xFF1F0000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,
+   0xFF200000,0xFF1E0000,0xFF1B0000,0xFF1A0000,0xFF1A0001,0xFF190003,0xFF180004,
+   0xFF180004,0xFF180005,0xFF180006,0xFF190004,0xFF190009,0xFF08004F,0xFF0F003C,
+   0xFF210000,0xFF1B001F,0xFF010067,0xFF110015,0xFF170000,0xFF180000,0xFF190000,
+   0xFF1A0000,0xFF190000,0xFF190000,0xFF180000,0xFF170000,0xFF180000,0xFF190000,
+   0xFF1A0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF1C0000,0xFF1E0000,0xFF200000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF21000B,0xFF03004D,0xFF010068,0xFF14001F,0xFF250000,0xFF240000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF240000,0xFF200017,
+   0xFF020065,0xFF010071,0xFF0F002D,0xFF200005,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0007,
+   0xFF090048,0xFF110037,0xFF240000,0xFF1D001B,0xFF020057,0xFF150010,0xFF1B0000,
+   0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1C0000,0xFF1A0000,0xFF190000,
+   0xFF190000,0xFF1A0000,0xFF1B0000,0xFF1B0000,0xFF1B0000,0xFF1D0000,0xFF1F0000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF250000,0xFF22000B,0xFF03004C,0xFF010066,0xFF14001E,0xFF260000,
+   0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF270000,0xFF270000,0xFF250000,
+   0xFF260000,0xFF230013,0xFF030066,0xFF05009B,0xFF020078,0xFF080047,0xFF160018,
+   0xFF1E0002,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF210000,0xFF1F0000,0xFF1D0000,
+   0xFF1A0000,0xFF1A0000,0xFF190002,0xFF190003,0xFF190003,0xFF180005,0xFF180004,
+   0xFF1A0005,0xFF0B003D,0xFF0A0051,0xFF190008,0xFF1B0000,0xFF19001B,0xFF020064,
+   0xFF110014,0xFF160000,0xFF170000,0xFF180000,0xFF190000,0xFF190000,0xFF180000,
+   0xFF170000,0xFF170000,0xFF180000,0xFF1A0000,0xFF1A0000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF1C0000,0xFF1F0000,0xFF200000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF260000,0xFF18001B,0xFF010061,0xFF010065,
+   0xFF16001A,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF230000,0xFF260000,0xFF270000,0xFF270000,0xFF250000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF240000,0xFF230013,0xFF030064,0xFF050097,0xFF020070,
+   0xFF090041,0xFF190015,0xFF220002,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0003,0xFF0D0038,0xFF0B004C,0xFF1C0007,0xFF1D0000,
+   0xFF1A0019,0xFF020058,0xFF140010,0xFF1A0000,0xFF190000,0xFF1A0000,0xFF1A0000,
+   0xFF1A0000,0xFF1A0000,0xFF190000,0xFF180000,0xFF190000,0xFF190000,0xFF1A0000,
+   0xFF1A0000,0xFF1C0000,0xFF1D0000,0xFF1F0000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF260000,0xFF180019,
+   0xFF01005F,0xFF010063,0xFF170019,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF260000,0xFF270000,0xFF270000,0xFF260000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF270000,
+   0xFF2B0000,0xFF2F0000,0xFF300000,0xFF2E0000,0xFF2B0000,0xFF220017,0xFF02006C,
+   0xFF04007E,0xFF0B006F,0xFF060084,0xFF04006A,0xFF0B0041,0xFF1A000F,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF1F0000,0xFF1D0000,0xFF1B0000,0xFF1A0001,0xFF190002,
+   0xFF190003,0xFF190003,0xFF190002,0xFF17000B,0xFF0B0038,0xFF090052,0xFF1A0012,
+   0xFF180001,0xFF1A0000,0xFF1B0017,0xFF020065,0xFF0F0019,0xFF160000,0xFF170000,
+   0xFF170000,0xFF180000,0xFF190000,0xFF180000,0xFF170000,0xFF180000,0xFF190000,
+   0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF1C0000,0xFF1E0000,
+   0xFF1F0000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF220000,0xFF230000,
+   0xFF250002,0xFF0C0032,0xFF010078,0xFF02005B,0xFF190012,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF260000,0xFF280000,
+   0xFF270000,0xFF260000,0xFF250000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF280000,0xFF2C0000,0xFF2D0000,0xFF2B0000,0xFF2A0000,
+   0xFF210017,0xFF02006A,0xFF03007A,0xFF0B0069,0xFF05007D,0xFF040063,0xFF0C003B,
+   0xFF1D000D,0xFF240000,0xFF240000,0xFF230000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1D0007,0xFF0E0033,
+   0xFF0A004E,0xFF1C0011,0xFF1B0000,0xFF1C0000,0xFF1C0015,0xFF02005A,0xFF110015,
+   0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF180000,
+   0xFF180000,0xFF180000,0xFF190000,0xFF190000,0xFF1A0000,0xFF1C0000,0xFF1D0000,
+   0xFF1F0000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF260002,0xFF0C0031,0xFF000076,0xFF020058,0xFF1A0011,
+   0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF260000,0xFF270000,0xFF280000,0xFF270000,0xFF260000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF2E0000,0xFF300000,0xFF310000,0xFF310000,
+   0xFF2F0000,0xFF2E0000,0xFF150031,0xFF02006F,0xFF16002B,0xFF2A0006,0xFF1F0039,
+   0xFF1A003F,0xFF130055,0xFF060062,0xFF12002C,0xFF1D0006,0xFF200000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF200000,
+   0xFF1D0000,0xFF1B0000,0xFF1A0000,0xFF190001,0xFF180004,0xFF170009,0xFF11001D,
+   0xFF08004B,0xFF0F0047,0xFF1C0010,0xFF1A0001,0xFF170004,0xFF190002,0xFF1D0010,
+   0xFF040065,0xFF0C0025,0xFF170000,0xFF170000,0xFF160000,0xFF170000,0xFF180000,
+   0xFF180000,0xFF170000,0xFF180000,0xFF190000,0xFF1A0000,0xFF190000,0xFF190000,
+   0xFF180000,0xFF1A0000,0xFF1D0000,0xFF1F0000,0xFF200000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF1F000F,0xFF030052,0xFF02008A,
+   0xFF060049,0xFF1E0006,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF240000,0xFF270000,0xFF2B0000,0xFF2E0000,
+   0xFF2E0000,0xFF2D0000,0xFF2C0000,0xFF2C0000,0xFF150032,0xFF02006D,0xFF180028,
+   0xFF2D0005,0xFF200036,0xFF1C003C,0xFF140050,0xFF06005A,0xFF140027,0xFF210005,
+   0xFF230000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,
+   0xFF1D0003,0xFF160016,0xFF0A0042,0xFF100041,0xFF1F000F,0xFF1E0000,0xFF1A0000,
+   0xFF1B0000,0xFF1E000F,0xFF04005C,0xFF0D0021,0xFF190000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF180000,0xFF180000,0xFF190000,
+   0xFF190000,0xFF190000,0xFF1B0000,0xFF1D0000,0xFF1F0000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF200011,
+   0xFF030056,0xFF020088,0xFF060047,0xFF1F0006,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF260000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF250000,0xFF240000,0xFF250000,0xFF260000,0xFF290000,
+   0xFF310000,0xFF310000,0xFF310000,0xFF310000,0xFF310000,0xFF27000E,0xFF05005E,
+   0xFF11003E,0xFF240001,0xFF220000,0xFF260005,0xFF1B0025,0xFF28000D,0xFF200030,
+   0xFF0A0064,0xFF070059,0xFF110028,0xFF19000D,0xFF1E0003,0xFF210000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF210000,0xFF1E0000,0xFF1B0001,0xFF180008,
+   0xFF11001E,0xFF0A003C,0xFF060056,0xFF04006F,0xFF15002F,0xFF1F0002,0xFF1B0000,
+   0xFF180002,0xFF170005,0xFF170005,0xFF1C000B,0xFF050062,0xFF090036,0xFF180000,
+   0xFF170000,0xFF160000,0xFF160000,0xFF170000,0xFF170000,0xFF170002,0xFF180000,
+   0xFF180000,0xFF190000,0xFF180000,0xFF180000,0xFF180000,0xFF1A0000,0xFF1E0000,
+   0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF240002,0xFF0F002C,0xFF020078,0xFF040096,0xFF070044,0xFF1E0004,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF240000,0xFF260000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF240000,0xFF260000,
+   0xFF2A0000,0xFF2E0000,0xFF300000,0xFF2F0000,0xFF2E0000,0xFF2D0000,0xFF2E0000,
+   0xFF26000F,0xFF05005F,0xFF11003E,0xFF260001,0xFF260000,0xFF2A0005,0xFF1E0021,
+   0xFF2C000B,0xFF22002D,0xFF0B005D,0xFF080052,0xFF120025,0xFF1B000C,0xFF1F0003,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF1E0006,0xFF160018,0xFF0D0031,0xFF080049,0xFF040063,0xFF18002A,
+   0xFF220002,0xFF1F0000,0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF1E000A,0xFF05005B,
+   0xFF090033,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF190000,0xFF180000,0xFF190000,0xFF190000,0xFF190000,0xFF1A0000,
+   0xFF1D0000,0xFF1F0000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF250002,0xFF100031,0xFF02007B,0xFF040094,0xFF070042,
+   0xFF1F0004,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF240000,0xFF260000,0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF270000,0xFF2C0000,0xFF300000,0xFF310000,0xFF310000,0xFF310000,
+   0xFF310000,0xFF2F0004,0xFF0F0041,0xFF060060,0xFF20000C,0xFF220000,0xFF200000,
+   0xFF220000,0xFF22000D,0xFF180021,0xFF280001,0xFF2B000C,0xFF0E0052,0xFF010077,
+   0xFF04005B,0xFF070044,0xFF0B0037,0xFF0E002F,0xFF100029,0xFF110028,0xFF120027,
+   0xFF11002A,0xFF0E0035,0xFF0A0048,0xFF050060,0xFF010073,0xFF010081,0xFF040094,
+   0xFF030085,0xFF0A0046,0xFF12001F,0xFF18000A,0xFF190001,0xFF180000,0xFF190001,
+   0xFF190011,0xFF020061,0xFF060048,0xFF170002,0xFF170000,0xFF170000,0xFF160000,
+   0xFF160000,0xFF170000,0xFF180002,0xFF180001,0xFF180000,0xFF190000,0xFF180000,
+   0xFF180000,0xFF180000,0xFF190000,0xFF1C0000,0xFF1F0000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF230000,0xFF16001C,0xFF02005A,0xFF0700A1,
+   0xFF0600A0,0xFF040051,0xFF1B000A,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF230000,0xFF260000,0xFF260000,0xFF260000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF290000,0xFF2C0000,0xFF300000,0xFF300000,0xFF300000,
+   0xFF300000,0xFF2F0000,0xFF2F0000,0xFF2D0004,0xFF0E0043,0xFF060061,0xFF21000C,
+   0xFF240000,0xFF240000,0xFF260000,0xFF25000C,0xFF1B001D,0xFF2D0001,0xFF2F000B,
+   0xFF0E004E,0xFF000073,0xFF040058,0xFF070045,0xFF0A003A,0xFF0D0033,0xFF0F002E,
+   0xFF10002B,0xFF110028,0xFF110029,0xFF10002F,0xFF0C003E,0xFF060053,0xFF010065,
+   0xFF000074,0xFF020089,0xFF02007B,0xFF0C003F,0xFF15001C,0xFF19000A,0xFF1A0001,
+   0xFF190000,0xFF1B0000,0xFF1A0010,0xFF03005B,0xFF060046,0xFF180002,0xFF190000,
+   0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF180000,0xFF180000,
+   0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF1B0000,0xFF1E0000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF170020,
+   0xFF02005F,0xFF0600A0,0xFF06009E,0xFF04004F,0xFF1C000A,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF240000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF290000,0xFF2E0000,0xFF310000,
+   0xFF310000,0xFF310000,0xFF310000,0xFF320000,0xFF300002,0xFF16002D,0xFF02006A,
+   0xFF1B0026,0xFF250000,0xFF220000,0xFF200000,0xFF200000,0xFF230000,0xFF1D0019,
+   0xFF18001C,0xFF260001,0xFF0E003F,0xFF040092,0xFF0700A0,0xFF020086,0xFF000074,
+   0xFF000074,0xFF000076,0xFF000074,0xFF000072,0xFF000074,0xFF010074,0xFF04006D,
+   0xFF060063,0xFF080058,0xFF090052,0xFF080054,0xFF050062,0xFF02006E,0xFF020070,
+   0xFF030062,0xFF080048,0xFF0D002D,0xFF0F0021,0xFF0A0038,0xFF020075,0xFF04005E,
+   0xFF13000A,0xFF170000,0xFF170000,0xFF160000,0xFF160000,0xFF170000,0xFF180000,
+   0xFF180000,0xFF170000,0xFF190000,0xFF180000,0xFF180000,0xFF180000,0xFF180000,
+   0xFF190000,0xFF1D0000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF1F0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF220000,
+   0xFF180016,0xFF03004F,0xFF040091,0xFF0A00B4,0xFF0800AC,0xFF01006B,0xFF110024,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF230000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF2B0000,
+   0xFF2E0000,0xFF300000,0xFF300000,0xFF300000,0xFF300000,0xFF310000,0xFF2F0002,
+   0xFF15002F,0xFF02006C,0xFF1B0027,0xFF260000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF280000,0xFF210016,0xFF1C0019,0xFF290001,0xFF0E003C,0xFF03008F,0xFF06009E,
+   0xFF020087,0xFF000077,0xFF010079,0xFF01007C,0xFF000079,0xFF000075,0xFF000072,
+   0xFF01006E,0xFF040063,0xFF060056,0xFF09004A,0xFF0B0045,0xFF0A0048,0xFF050058,
+   0xFF020066,0xFF02006C,0xFF040062,0xFF08004A,0xFF0D002F,0xFF100021,0xFF0B0036,
+   0xFF020072,0xFF04005B,0xFF150009,0xFF190000,0xFF190000,0xFF180000,0xFF180000,
+   0xFF180000,0xFF180000,0xFF170000,0xFF180000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF190000,0xFF1A0000,0xFF1C0000,0xFF1E0000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF230000,0xFF190019,0xFF040053,0xFF040090,0xFF0A00B1,0xFF0800AA,
+   0xFF010068,0xFF120022,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF210000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF220000,0xFF240000,0xFF260000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF280000,0xFF2C0000,0xFF300000,0xFF310000,0xFF310000,0xFF310000,0xFF310000,
+   0xFF2B0008,0xFF140034,0xFF020076,0xFF0D004D,0xFF2C0003,0xFF280000,0xFF240000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF250005,0xFF14004F,0xFF110054,0xFF030074,
+   0xFF010075,0xFF030068,0xFF050059,0xFF09004C,0xFF0C0047,0xFF0E0043,0xFF10003D,
+   0xFF120036,0xFF17002C,0xFF1D001D,0xFF210010,0xFF20000A,0xFF1F0006,0xFF200005,
+   0xFF210006,0xFF20000D,0xFF1E0015,0xFF1C0020,0xFF160033,0xFF090054,0xFF01006C,
+   0xFF010074,0xFF030082,0xFF0700A2,0xFF03006C,0xFF0D001A,0xFF170000,0xFF170000,
+   0xFF170000,0xFF160000,0xFF170000,0xFF180000,0xFF170000,0xFF170000,0xFF180000,
+   0xFF180000,0xFF180000,0xFF180000,0xFF180000,0xFF190000,0xFF1A0000,0xFF1C0000,
+   0xFF1D0000,0xFF1D0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1E0000,0xFF1D0004,0xFF110021,0xFF030054,0xFF03008B,0xFF0900AE,
+   0xFF0A00B2,0xFF0A00B4,0xFF040091,0xFF03004E,0xFF180011,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF210000,0xFF240000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF270000,0xFF290000,0xFF2C0000,0xFF2F0000,0xFF2F0000,0xFF300000,
+   0xFF300000,0xFF310000,0xFF2A0008,0xFF130036,0xFF020078,0xFF0D004E,0xFF2C0003,
+   0xFF290000,0xFF260000,0xFF250000,0xFF240000,0xFF250000,0xFF290004,0xFF16004B,
+   0xFF120050,0xFF020070,0xFF010071,0xFF020066,0xFF05005B,0xFF08004F,0xFF0B004C,
+   0xFF0D0049,0xFF0F0042,0xFF120039,0xFF17002C,0xFF1E001B,0xFF24000E,0xFF260007,
+   0xFF260004,0xFF270003,0xFF270004,0xFF25000B,0xFF220013,0xFF1E001F,0xFF160034,
+   0xFF090056,0xFF01006E,0xFF010074,0xFF030082,0xFF0700A4,0xFF03006B,0xFF0E0017,
+   0xFF190000,0xFF180000,0xFF180000,0xFF180000,0xFF170000,0xFF170000,0xFF170000,
+   0xFF170000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF180000,0xFF190000,
+   0xFF190000,0xFF190000,0xFF1B0000,0xFF1D0000,0xFF1F0000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1D0004,0xFF120026,0xFF03005C,
+   0xFF03008C,0xFF0800AD,0xFF0A00B1,0xFF0A00B2,0xFF04008F,0xFF04004C,0xFF190011,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF210000,0xFF240000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF270000,0xFF270000,0xFF2A0000,0xFF2E0000,0xFF310000,
+   0xFF310000,0xFF310000,0xFF2A0009,0xFF1E001F,0xFF130042,0xFF0D005E,0xFF04007B,
+   0xFF1C0020,0xFF300000,0xFF2C0000,0xFF290000,0xFF250000,0xFF220000,0xFF210000,
+   0xFF1E0013,0xFF0C006E,0xFF06006E,0xFF120040,0xFF200022,0xFF260015,0xFF28000D,
+   0xFF2C0006,0xFF2E0003,0xFF2E0002,0xFF2D0001,0xFF2A0000,0xFF260000,0xFF220000,
+   0xFF1D0000,0xFF190002,0xFF180004,0xFF170006,0xFF170006,0xFF190004,0xFF1B0002,
+   0xFF1E0000,0xFF220000,0xFF250005,0xFF170027,0xFF03005B,0xFF04008C,0xFF0900AF,
+   0xFF03007B,0xFF07002D,0xFF160001,0xFF160000,0xFF170000,0xFF180000,0xFF180000,
+   0xFF180000,0xFF170000,0xFF170000,0xFF180000,0xFF180000,0xFF180000,0xFF180000,
+   0xFF180000,0xFF180000,0xFF1A0000,0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,
+   0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1C0002,0xFF14001A,0xFF070045,
+   0xFF000065,0xFF010073,0xFF020072,0xFF020072,0xFF020078,0xFF030083,0xFF040093,
+   0xFF02007B,0xFF070044,0xFF1B000A,0xFF200000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF240000,0xFF270000,0xFF270000,0xFF270000,0xFF280000,0xFF280000,0xFF2A0000,
+   0xFF2D0000,0xFF2F0000,0xFF300000,0xFF300000,0xFF2A0009,0xFF1D0020,0xFF120044,
+   0xFF0D0060,0xFF04007C,0xFF1B0021,0xFF300000,0xFF2E0000,0xFF2C0000,0xFF290000,
+   0xFF260000,0xFF250000,0xFF220012,0xFF0C0068,0xFF060069,0xFF12003C,0xFF210020,
+   0xFF260015,0xFF28000D,0xFF2A0006,0xFF2B0004,0xFF2B0003,0xFF2A0001,0xFF280000,
+   0xFF260000,0xFF230000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF200000,0xFF210000,0xFF240000,0xFF250005,0xFF170027,0xFF03005D,
+   0xFF05008F,0xFF0A00B3,0xFF03007F,0xFF07002B,0xFF180001,0xFF180000,0xFF170000,
+   0xFF170000,0xFF170000,0xFF170000,0xFF170000,0xFF170000,0xFF180000,0xFF180000,
+   0xFF180000,0xFF180000,0xFF180000,0xFF190000,0xFF1A0000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF1B0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1E0002,
+   0xFF15001D,0xFF07004E,0xFF000072,0xFF01007D,0xFF02007B,0xFF02007B,0xFF020081,
+   0xFF03008B,0xFF040098,0xFF02007C,0xFF070042,0xFF1C0009,0xFF220000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF240000,0xFF270000,0xFF280000,0xFF280000,0xFF290000,
+   0xFF290000,0xFF2B0000,0xFF2F0000,0xFF310000,0xFF320000,0xFF320000,0xFF190033,
+   0xFF2E0016,0xFF38000C,0xFF3D0006,0xFF1E0040,0xFF16002A,0xFF2E0000,0xFF2D0000,
+   0xFF2A0001,0xFF25000C,0xFF1B0027,0xFF0F0040,0xFF0D0045,0xFF1B002C,0xFF2A000D,
+   0xFF300001,0xFF2E0000,0xFF2A0000,0xFF270000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF220000,0xFF1F0000,0xFF1D0000,0xFF1A0000,0xFF190002,0xFF180003,
+   0xFF170006,0xFF160007,0xFF160007,0xFF170006,0xFF170005,0xFF180003,0xFF1A0002,
+   0xFF220001,0xFF1D0017,0xFF060045,0xFF02007C,0xFF050093,0xFF020046,0xFF11000F,
+   0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF180000,0xFF170000,
+   0xFF180000,0xFF170000,0xFF170000,0xFF170000,0xFF170000,0xFF180000,0xFF190000,
+   0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1C0001,
+   0xFF160013,0xFF090038,0xFF01005B,0xFF03005A,0xFF0E0041,0xFF190027,0xFF1E001C,
+   0xFF1E001D,0xFF1A0024,0xFF15002E,0xFF0A0047,0xFF030069,0xFF02007A,0xFF080051,
+   0xFF160017,0xFF1F0002,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF270000,0xFF290000,0xFF290000,
+   0xFF290000,0xFF280000,0xFF290000,0xFF2B0000,0xFF2F0000,0xFF2E0001,0xFF25000B,
+   0xFF160027,0xFF170035,0xFF2D0016,0xFF37000D,0xFF3D0006,0xFF1E0041,0xFF16002B,
+   0xFF2F0000,0xFF2F0000,0xFF2E0001,0xFF28000B,0xFF1D0025,0xFF11003C,0xFF0E003F,
+   0xFF1D0028,0xFF2C000C,0xFF310001,0xFF2F0000,0xFF2A0000,0xFF260000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF1F0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,
+   0xFF1B0000,0xFF1C0000,0xFF240001,0xFF1D0018,0xFF060048,0xFF030080,0xFF060099,
+   0xFF02004B,0xFF11000F,0xFF180000,0xFF180000,0xFF180000,0xFF170000,0xFF170000,
+   0xFF170000,0xFF170000,0xFF180000,0xFF180000,0xFF170000,0xFF170000,0xFF180000,
+   0xFF190000,0xFF1A0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF1A0000,0xFF1C0000,
+   0xFF1E0000,0xFF1D0001,0xFF160014,0xFF0A0040,0xFF01006A,0xFF030069,0xFF0D004A,
+   0xFF17002D,0xFF1C0022,0xFF1C0023,0xFF18002B,0xFF140036,0xFF090051,0xFF030072,
+   0xFF02007D,0xFF09004E,0xFF180015,0xFF200002,0xFF230000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF230000,0xFF270000,
+   0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF2A0000,0xFF2D0000,0xFF310000,
+   0xFF310001,0xFF27000A,0xFF190020,0xFF210021,0xFF350000,0xFF340000,0xFF380000,
+   0xFF21002F,0xFF050073,0xFF0F003E,0xFF11003D,0xFF0D0053,0xFF090066,0xFF0F0055,
+   0xFF1D002A,0xFF2A000A,0xFF2D0000,0xFF2B0000,0xFF290000,0xFF280000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF220000,0xFF1E0000,
+   0xFF1B0000,0xFF190000,0xFF190001,0xFF180003,0xFF170006,0xFF170007,0xFF160007,
+   0xFF170007,0xFF170006,0xFF170005,0xFF170005,0xFF180003,0xFF210000,0xFF23000D,
+   0xFF0C0037,0xFF030071,0xFF04007C,0xFF03003F,0xFF0B001F,0xFF13000D,0xFF150007,
+   0xFF170002,0xFF180000,0xFF180000,0xFF170000,0xFF170000,0xFF160001,0xFF160001,
+   0xFF160001,0xFF170002,0xFF180001,0xFF170001,0xFF170002,0xFF180003,0xFF180005,
+   0xFF170008,0xFF16000E,0xFF11001F,0xFF090046,0xFF02005E,0xFF080045,0xFF140024,
+   0xFF1E0010,0xFF250002,0xFF250000,0xFF250000,0xFF260000,0xFF270000,0xFF290000,
+   0xFF290006,0xFF230013,0xFF1A002F,0xFF0A0064,0xFF030073,0xFF0A004B,0xFF130021,
+   0xFF190010,0xFF1D0009,0xFF1F0005,0xFF210002,0xFF210000,0xFF220000,0xFF220000,
+   0xFF250000,0xFF280000,0xFF290000,0xFF290000,0xFF290000,0xFF270000,0xFF260003,
+   0xFF24000A,0xFF1C0019,0xFF0F0036,0xFF05005C,0xFF020078,0xFF1C002D,0xFF340000,
+   0xFF330000,0xFF370000,0xFF21002F,0xFF050073,0xFF0F003E,0xFF12003B,0xFF0E004F,
+   0xFF0A0061,0xFF0F0050,0xFF1E0026,0xFF2D0009,0xFF300000,0xFF2D0000,0xFF2A0000,
+   0xFF280000,0xFF260000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF200000,0xFF200000,0xFF1F0000,0xFF200000,0xFF1F0000,0xFF1E0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1B0000,0xFF1B0000,
+   0xFF220000,0xFF22000E,0xFF0C0038,0xFF030075,0xFF040084,0xFF030043,0xFF0A0021,
+   0xFF11000F,0xFF140008,0xFF150002,0xFF160000,0xFF160000,0xFF160000,0xFF170000,
+   0xFF160001,0xFF160001,0xFF160001,0xFF160002,0xFF180001,0xFF190001,0xFF190001,
+   0xFF180002,0xFF170003,0xFF160006,0xFF15000A,0xFF110019,0xFF09003F,0xFF020064,
+   0xFF070052,0xFF14002C,0xFF1D0013,0xFF230004,0xFF230001,0xFF220001,0xFF230001,
+   0xFF240001,0xFF270001,0xFF270008,0xFF220017,0xFF190034,0xFF090066,0xFF030070,
+   0xFF0A0047,0xFF15001F,0xFF1B000F,0xFF1E0008,0xFF210004,0xFF220002,0xFF230000,
+   0xFF230000,0xFF230000,0xFF260000,0xFF280000,0xFF290000,0xFF290000,0xFF290000,
+   0xFF280000,0xFF270003,0xFF25000A,0xFF1D0018,0xFF0F0031,0xFF050057,0xFF020076,
+   0xFF06003E,0xFF160027,0xFF1D001F,0xFF190027,0xFF07005A,0xFF0700A7,0xFF0700A3,
+   0xFF020076,0xFF0A004A,0xFF20001B,0xFF2D0004,0xFF2E0000,0xFF290000,0xFF280000,
+   0xFF290000,0xFF290000,0xFF280000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF220000,0xFF1E0000,0xFF1A0000,0xFF190000,0xFF190001,
+   0xFF180005,0xFF170006,0xFF170006,0xFF170006,0xFF170007,0xFF170006,0xFF170006,
+   0xFF170005,0xFF170004,0xFF180001,0xFF1F0000,0xFF250005,0xFF10002D,0xFF04007F,
+   0xFF060090,0xFF020069,0xFF020056,0xFF04004D,0xFF050047,0xFF07003E,0xFF080038,
+   0xFF080033,0xFF080030,0xFF070034,0xFF06003A,0xFF05003B,0xFF050039,0xFF060037,
+   0xFF06003C,0xFF06003C,0xFF05003C,0xFF050041,0xFF040050,0xFF05006F,0xFF040084,
+   0xFF010074,0xFF0D0040,0xFF1E0009,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF230000,0xFF280000,
+   0xFF26000C,0xFF100044,0xFF040081,0xFF060090,0xFF050076,0xFF05005D,0xFF07004F,
+   0xFF09004B,0xFF0B0049,0xFF0D0041,0xFF0D0039,0xFF0F0033,0xFF100033,0xFF120033,
+   0xFF130033,0xFF100035,0xFF0B003D,0xFF080045,0xFF04004E,0xFF010058,0xFF02006D,
+   0xFF060087,0xFF040072,0xFF050041,0xFF160028,0xFF1D0020,0xFF190028,0xFF07005B,
+   0xFF0700A7,0xFF0700A3,0xFF020073,0xFF0A0046,0xFF220019,0xFF300003,0xFF300000,
+   0xFF2C0000,0xFF2B0000,0xFF2A0000,0xFF2A0000,0xFF280000,0xFF270000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF200000,0xFF250005,
+   0xFF10002E,0xFF050083,0xFF070099,0xFF030076,0xFF030066,0xFF05005C,0xFF050051,
+   0xFF070047,0xFF08003D,0xFF080036,0xFF080033,0xFF070036,0xFF06003A,0xFF05003A,
+   0xFF050037,0xFF060031,0xFF060031,0xFF060032,0xFF050036,0xFF05003D,0xFF04004A,
+   0xFF050067,0xFF04007F,0xFF01007A,0xFF0C0048,0xFF1C000D,0xFF1F0002,0xFF1F0001,
+   0xFF1E0003,0xFF1E0003,0xFF1E0003,0xFF1E0003,0xFF1E0005,0xFF1D0006,0xFF1F0005,
+   0xFF210003,0xFF270000,0xFF25000E,0xFF100043,0xFF04007D,0xFF05008C,0xFF050072,
+   0xFF050059,0xFF07004B,0xFF090048,0xFF0C0047,0xFF0E003F,0xFF0E0037,0xFF0F0032,
+   0xFF110032,0xFF130032,0xFF130033,0xFF100034,0xFF0C003B,0xFF080043,0xFF04004D,
+   0xFF010055,0xFF020069,0xFF050083,0xFF040073,0xFF1D001E,0xFF18002A,0xFF12003A,
+   0xFF08004C,0xFF020059,0xFF020070,0xFF05008C,0xFF01005A,0xFF160019,0xFF2A0000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF270000,0xFF270000,0xFF280000,0xFF270000,
+   0xFF260000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF200000,
+   0xFF1D0000,0xFF1A0000,0xFF190000,0xFF190001,0xFF180004,0xFF170006,0xFF170006,
+   0xFF170005,0xFF170005,0xFF170005,0xFF170006,0xFF170005,0xFF180003,0xFF1A0001,
+   0xFF1D0000,0xFF240000,0xFF19001E,0xFF010060,0xFF040057,0xFF110030,0xFF1B0020,
+   0xFF1F001E,0xFF1D0029,0xFF14003F,0xFF070069,0xFF070096,0xFF08009B,0xFF060089,
+   0xFF040068,0xFF050050,0xFF060041,0xFF060039,0xFF090038,0xFF09003B,0xFF060048,
+   0xFF030066,0xFF08009C,0xFF0A00AF,0xFF040075,0xFF13002B,0xFF210005,0xFF210000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF230003,0xFF0C0035,
+   0xFF060094,0xFF0B00B6,0xFF0A00AF,0xFF07009E,0xFF04008B,0xFF030082,0xFF040077,
+   0xFF080062,0xFF0C004F,0xFF0E0047,0xFF0E0043,0xFF0D003F,0xFF0F0034,0xFF11002C,
+   0xFF140024,0xFF16001E,0xFF180019,0xFF1B0016,0xFF1E0013,0xFF220014,0xFF1D001E,
+   0xFF18002C,0xFF12003B,0xFF08004D,0xFF02005A,0xFF020071,0xFF05008C,0xFF010059,
+   0xFF170018,0xFF2C0000,0xFF2B0000,0xFF2A0000,0xFF2A0000,0xFF2A0000,0xFF290000,
+   0xFF280000,0xFF270000,0xFF260000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF260000,0xFF1A001E,0xFF01006E,0xFF05006D,
+   0xFF110041,0xFF1A002B,0xFF1E0028,0xFF1D0034,0xFF15004F,0xFF09007A,0xFF08009D,
+   0xFF08009E,0xFF06008F,0xFF04006F,0xFF050054,0xFF070040,0xFF080034,0xFF0A0032,
+   0xFF0B0037,0xFF070048,0xFF030069,0xFF08009F,0xFF0A00B0,0xFF04007E,0xFF110034,
+   0xFF1F0007,0xFF1F0000,0xFF1F0001,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF1F0001,0xFF1E0003,0xFF1E0005,0xFF1D0007,0xFF1C0007,0xFF1D0005,0xFF1E0003,
+   0xFF230004,0xFF0C0037,0xFF060093,0xFF0A00B3,0xFF0900AC,0xFF07009B,0xFF040088,
+   0xFF030080,0xFF030076,0xFF080061,0xFF0C004D,0xFF0E0047,0xFF0E0043,0xFF0D003F,
+   0xFF0F0034,0xFF12002B,0xFF150023,0xFF17001D,0xFF190018,0xFF1C0014,0xFF200012,
+   0xFF230012,0xFF300000,0xFF320000,0xFF340001,0xFF320006,0xFF2B0010,0xFF1B0021,
+   0xFF070049,0xFF01006E,0xFF090035,0xFF230004,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF260000,0xFF250000,0xFF240000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1A0000,0xFF190000,
+   0xFF190001,0xFF180003,0xFF180004,0xFF180003,0xFF190001,0xFF1A0001,0xFF190001,
+   0xFF180002,0xFF190001,0xFF1B0000,0xFF1E0000,0xFF220000,0xFF230008,0xFF070044,
+   0xFF06003E,0xFF20000D,0xFF2B0000,0xFF290000,0xFF280000,0xFF290000,0xFF2E0000,
+   0xFF230013,0xFF07006F,0xFF080099,0xFF060041,0xFF110011,0xFF170004,0xFF180001,
+   0xFF180001,0xFF190000,0xFF1D0000,0xFF230004,0xFF1D0013,0xFF080058,0xFF07009C,
+   0xFF08004D,0xFF210005,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF220000,0xFF100028,0xFF040083,0xFF0A00B1,0xFF050088,
+   0xFF020056,0xFF06003D,0xFF10002A,0xFF1D0014,0xFF230006,0xFF230001,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF260000,0xFF2B0000,0xFF2E0000,0xFF300000,0xFF330001,0xFF320006,
+   0xFF2B0010,0xFF1B0022,0xFF070049,0xFF01006D,0xFF090034,0xFF250004,0xFF280000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF230000,0xFF240000,
+   0xFF250007,0xFF080048,0xFF07004D,0xFF210014,0xFF2A0001,0xFF270000,0xFF260000,
+   0xFF280000,0xFF2E0000,0xFF24001B,0xFF08007F,0xFF0800A1,0xFF06004D,0xFF110018,
+   0xFF180005,0xFF1A0002,0xFF1B0001,0xFF1D0000,0xFF220001,0xFF270005,0xFF1E0018,
+   0xFF080062,0xFF0700A3,0xFF070059,0xFF1E0009,0xFF1E0003,0xFF1F0001,0xFF200000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0002,0xFF1E0003,0xFF1E0004,0xFF1D0005,
+   0xFF1D0006,0xFF1D0006,0xFF1D0006,0xFF1D0005,0xFF220002,0xFF10002E,0xFF040086,
+   0xFF0900AE,0xFF040084,0xFF020054,0xFF06003B,0xFF100029,0xFF1D0013,0xFF240006,
+   0xFF240001,0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF240000,0xFF280000,0xFF2C0000,0xFF290000,0xFF290000,
+   0xFF290000,0xFF2B0000,0xFF2F0000,0xFF350000,0xFF2D0010,0xFF07004F,0xFF00005B,
+   0xFF15001C,0xFF250000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF210000,0xFF210000,0xFF1F0000,0xFF1E0000,
+   0xFF1D0000,0xFF1C0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF190000,0xFF1A0000,
+   0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1E0000,
+   0xFF200000,0xFF240000,0xFF180022,0xFF020053,0xFF1B0013,0xFF280000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF2C0000,0xFF120032,0xFF040054,
+   0xFF150007,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF180000,0xFF1A0000,
+   0xFF1E0000,0xFF290000,0xFF200015,0xFF040070,0xFF0B0040,0xFF220003,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF1E0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF210003,
+   0xFF090035,0xFF05008E,0xFF05008C,0xFF08003A,0xFF1B0014,0xFF210006,0xFF210001,
+   0xFF210000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF220000,0xFF260000,
+   0xFF280000,0xFF280000,0xFF290000,0xFF2B0000,0xFF2E0000,0xFF340000,0xFF2C0010,
+   0xFF07004F,0xFF00005A,0xFF15001C,0xFF270000,0xFF270000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF240000,0xFF250000,0xFF270000,0xFF1A001F,0xFF020059,0xFF1C0019,
+   0xFF280000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF230000,0xFF2C0000,
+   0xFF130041,0xFF040062,0xFF15000C,0xFF190001,0xFF190001,0xFF1A0000,0xFF1B0000,
+   0xFF1C0000,0xFF1E0000,0xFF210000,0xFF290000,0xFF20001B,0xFF04007C,0xFF0A004D,
+   0xFF1F0007,0xFF1E0004,0xFF1F0001,0xFF200000,0xFF200000,0xFF200000,0xFF1F0001,
+   0xFF1D0005,0xFF1C0007,0xFF1C0007,0xFF1C0007,0xFF1D0007,0xFF1D0006,0xFF1D0007,
+   0xFF1D0006,0xFF200006,0xFF09003E,0xFF040092,0xFF05008A,0xFF080039,0xFF1A0014,
+   0xFF200006,0xFF210001,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,
+   0xFF240000,0xFF280000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,
+   0xFF290000,0xFF340000,0xFF1E0021,0xFF000061,0xFF03004C,0xFF160018,0xFF230002,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF1E0000,0xFF1C0000,0xFF1A0000,
+   0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF250001,0xFF0D0041,
+   0xFF0E0034,0xFF250000,0xFF240000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF270000,0xFF19001D,0xFF09002E,0xFF190000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF190000,0xFF190000,0xFF1B0000,0xFF1D0000,0xFF200000,0xFF2A0001,
+   0xFF0F003E,0xFF08003C,0xFF210003,0xFF200000,0xFF200000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,
+   0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1E000B,0xFF04004A,0xFF06009E,0xFF03006B,
+   0xFF150017,0xFF200000,0xFF1E0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF210000,0xFF250000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF330000,0xFF1D0021,0xFF000061,0xFF03004A,
+   0xFF170016,0xFF260001,0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF280001,0xFF0D003E,0xFF100039,0xFF260001,0xFF240000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF270000,0xFF19002A,0xFF08003F,0xFF170005,
+   0xFF180005,0xFF180004,0xFF190001,0xFF1B0000,0xFF1C0000,0xFF1E0000,0xFF1F0000,
+   0xFF210000,0xFF290001,0xFF0F004A,0xFF07004D,0xFF1E0008,0xFF1E0003,0xFF1E0002,
+   0xFF1F0001,0xFF200000,0xFF200000,0xFF1F0001,0xFF1D0004,0xFF1C0006,0xFF1C0008,
+   0xFF1C0007,0xFF1D0006,0xFF1D0005,0xFF1C0007,0xFF1D0006,0xFF1C000F,0xFF040055,
+   0xFF0700A1,0xFF03006C,0xFF150018,0xFF1F0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,
+   0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF200000,0xFF200000,0xFF210000,0xFF230000,0xFF270000,0xFF290000,
+   0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF2C0000,0xFF2D000A,
+   0xFF05004A,0xFF010078,0xFF020059,0xFF0C0033,0xFF1D000D,0xFF260000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF240000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF1D0000,0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1E0000,
+   0xFF1F0000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF250008,0xFF09004D,0xFF1C0014,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF260000,0xFF14001F,
+   0xFF0C0021,0xFF190000,0xFF190000,0xFF190000,0xFF1A0000,0xFF190000,0xFF190000,
+   0xFF1A0000,0xFF1D0000,0xFF1E0000,0xFF260000,0xFF1E001C,0xFF04003F,0xFF1D0008,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1E0000,0xFF200000,
+   0xFF13001F,0xFF020067,0xFF0900AC,0xFF02006F,0xFF0F0020,0xFF1D0000,0xFF1D0000,
+   0xFF1E0000,0xFF1F0000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF240000,0xFF280000,0xFF280000,0xFF280000,0xFF290000,0xFF280000,0xFF280000,
+   0xFF2B0000,0xFF2C000A,0xFF050049,0xFF000076,0xFF020055,0xFF0D002F,0xFF1E000C,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF240000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF260008,0xFF09004B,0xFF1F0015,
+   0xFF260000,0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF240000,0xFF130031,0xFF0B0034,0xFF170006,0xFF170007,0xFF170006,0xFF180004,
+   0xFF190001,0xFF1B0000,0xFF1D0000,0xFF1F0000,0xFF200000,0xFF250000,0xFF1E0023,
+   0xFF030053,0xFF1A0010,0xFF1E0004,0xFF1E0002,0xFF1F0000,0xFF1F0000,0xFF1F0001,
+   0xFF1F0002,0xFF1E0003,0xFF1D0005,0xFF1C0007,0xFF1C0007,0xFF1D0006,0xFF1D0006,
+   0xFF1C0008,0xFF1C0008,0xFF120027,0xFF02006F,0xFF0900AC,0xFF02006F,0xFF0F0020,
+   0xFF1C0000,0xFF1C0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF220000,0xFF260000,0xFF280000,0xFF290000,0xFF290000,0xFF290000,
+   0xFF290000,0xFF290000,0xFF280000,0xFF2D0003,0xFF0C003A,0xFF010077,0xFF040061,
+   0xFF050060,0xFF050051,0xFF17001F,0xFF260001,0xFF270000,0xFF250000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF1E0000,
+   0xFF1D0000,0xFF1D0000,0xFF1F0000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF220000,0xFF23000F,
+   0xFF0A0047,0xFF210006,0xFF240000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF240000,0xFF250000,0xFF100025,0xFF0C0022,0xFF190000,0xFF190000,
+   0xFF190000,0xFF190000,0xFF190000,0xFF180000,0xFF190000,0xFF1C0000,0xFF1E0000,
+   0xFF220000,0xFF23000F,0xFF040045,0xFF160012,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF1E0000,0xFF1B000C,0xFF040045,0xFF050091,0xFF0B00B6,
+   0xFF04008A,0xFF06003D,0xFF1A0006,0xFF1D0000,0xFF1D0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF230000,0xFF270000,0xFF280000,
+   0xFF280000,0xFF290000,0xFF280000,0xFF280000,0xFF270000,0xFF2D0003,0xFF0C0039,
+   0xFF010075,0xFF03005E,0xFF05005D,0xFF05004F,0xFF17001F,0xFF250001,0xFF260000,
+   0xFF250000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF230000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF24000E,0xFF0B0047,0xFF230006,0xFF250000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF0E003B,0xFF0A0036,
+   0xFF160008,0xFF170007,0xFF170007,0xFF170006,0xFF180003,0xFF1A0000,0xFF1C0000,
+   0xFF1E0000,0xFF1F0000,0xFF220000,0xFF230012,0xFF040059,0xFF14001E,0xFF1E0006,
+   0xFF1E0004,0xFF1F0002,0xFF1E0003,0xFF1E0003,0xFF1E0004,0xFF1E0004,0xFF1E0003,
+   0xFF1D0005,0xFF1C0007,0xFF1C0007,0xFF1C0007,0xFF1B0009,0xFF180015,0xFF040050,
+   0xFF050092,0xFF0B00B5,0xFF04008A,0xFF05003D,0xFF1A0006,0xFF1D0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF240000,
+   0xFF290001,0xFF0E0037,0xFF100049,0xFF29000F,0xFF2E000D,0xFF250026,0xFF0C004B,
+   0xFF100037,0xFF20000C,0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF220000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF230000,0xFF190021,0xFF0A0046,0xFF230002,0xFF240000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF0D002A,0xFF0C0023,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF180000,
+   0xFF180000,0xFF180000,0xFF1A0000,0xFF1D0000,0xFF1F0000,0xFF260004,0xFF0A0044,
+   0xFF0D0025,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1F0000,
+   0xFF0E0028,0xFF020072,0xFF0900B0,0xFF0900AD,0xFF050096,0xFF010061,0xFF100021,
+   0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF210000,0xFF240000,0xFF240000,0xFF250000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF250000,0xFF2A0001,0xFF0E0036,0xFF100049,0xFF29000E,0xFF2E000C,
+   0xFF240026,0xFF0C004D,0xFF0F0039,0xFF1F000C,0xFF240000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF240000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF240000,0xFF190021,0xFF0B004A,
+   0xFF240003,0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF0C0042,0xFF0A0037,0xFF170007,0xFF170006,0xFF170007,
+   0xFF170006,0xFF170006,0xFF190002,0xFF1B0000,0xFF1D0000,0xFF1F0000,0xFF200000,
+   0xFF280005,0xFF0A0052,0xFF0C0032,0xFF1E0006,0xFF1E0006,0xFF1E0005,0xFF1D0005,
+   0xFF1D0005,0xFF1D0005,0xFF1D0005,0xFF1E0003,0xFF1E0003,0xFF1D0005,0xFF1C0007,
+   0xFF1B0008,0xFF1C0008,0xFF0D0033,0xFF020078,0xFF0900AF,0xFF0900AC,0xFF050095,
+   0xFF010061,0xFF100021,0xFF1C0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,
+   0xFF260000,0xFF270000,0xFF260000,0xFF240000,0xFF270002,0xFF0C003D,0xFF1B0027,
+   0xFF2A0000,0xFF2A0000,0xFF300000,0xFF2F000B,0xFF110045,0xFF05005E,0xFF0E0033,
+   0xFF160016,0xFF1D0008,0xFF210001,0xFF220000,0xFF220000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF210007,
+   0xFF080045,0xFF0D0042,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF0C002F,0xFF0B0022,0xFF190000,
+   0xFF180000,0xFF190000,0xFF190000,0xFF190000,0xFF180000,0xFF180000,0xFF190000,
+   0xFF1B0000,0xFF1D0000,0xFF240000,0xFF130031,0xFF05003E,0xFF1C0005,0xFF1F0000,
+   0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF170012,0xFF04005D,0xFF050098,0xFF0700A4,
+   0xFF020071,0xFF07004C,0xFF070055,0xFF03005A,0xFF130021,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF230000,0xFF250000,0xFF260000,0xFF270000,0xFF260000,0xFF250000,0xFF280002,
+   0xFF0C003D,0xFF1B0027,0xFF2A0000,0xFF2A0000,0xFF2F0000,0xFF2F000C,0xFF110045,
+   0xFF05005D,0xFF0E0031,0xFF170015,0xFF1E0008,0xFF220001,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF210007,0xFF080049,0xFF0E004E,0xFF240000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF0B0046,
+   0xFF0A0037,0xFF160007,0xFF160008,0xFF160009,0xFF170008,0xFF170006,0xFF190003,
+   0xFF190001,0xFF1C0000,0xFF1E0000,0xFF1F0000,0xFF270000,0xFF140038,0xFF05004C,
+   0xFF1B000C,0xFF1E0006,0xFF1E0004,0xFF1E0003,0xFF1E0003,0xFF1D0005,0xFF1D0006,
+   0xFF1D0006,0xFF1D0005,0xFF1D0007,0xFF1C0008,0xFF1B0008,0xFF15001C,0xFF040068,
+   0xFF050098,0xFF0700A3,0xFF020071,0xFF07004B,0xFF060055,0xFF03005C,0xFF120023,
+   0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF22000D,0xFF070048,0xFF1F0012,0xFF260000,0xFF270000,0xFF270000,
+   0xFF2B0000,0xFF300006,0xFF0F0044,0xFF010079,0xFF020064,0xFF040048,0xFF090036,
+   0xFF0F0029,0xFF130020,0xFF160019,0xFF1A0011,0xFF1F0006,0xFF220001,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF200004,0xFF0E002F,0xFF020071,0xFF090045,0xFF220001,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF0C0032,0xFF090026,0xFF190000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF180000,0xFF180000,0xFF180000,0xFF180000,0xFF190000,0xFF1B0000,0xFF200000,
+   0xFF210011,0xFF050052,0xFF0D002C,0xFF1D0001,0xFF1E0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF150016,
+   0xFF070054,0xFF0C006B,0xFF0C004C,0xFF050060,0xFF070050,0xFF210008,0xFF260007,
+   0xFF20001F,0xFF100045,0xFF12002B,0xFF1F0003,0xFF210000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF22000D,0xFF070048,0xFF1F0012,0xFF260000,
+   0xFF260000,0xFF260000,0xFF2B0000,0xFF300006,0xFF0F0042,0xFF010077,0xFF020062,
+   0xFF040046,0xFF0A0034,0xFF0F0028,0xFF13001F,0xFF160018,0xFF1B0010,0xFF210006,
+   0xFF240001,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF210004,0xFF0E002E,0xFF020077,
+   0xFF090058,0xFF210003,0xFF240000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF0C0048,0xFF08003C,0xFF160009,0xFF15000C,
+   0xFF15000C,0xFF16000A,0xFF170006,0xFF180004,0xFF190002,0xFF1A0000,0xFF1C0000,
+   0xFF1E0000,0xFF220000,0xFF240013,0xFF05005B,0xFF0D0035,0xFF1D0008,0xFF1D0004,
+   0xFF1E0003,0xFF1E0004,0xFF1C0007,0xFF1B000A,0xFF1B000A,0xFF1A000B,0xFF1A000B,
+   0xFF1B0008,0xFF14001F,0xFF070060,0xFF0C006D,0xFF0B0044,0xFF050056,0xFF07004F,
+   0xFF200008,0xFF240007,0xFF1F0020,0xFF0F0049,0xFF10002F,0xFF1C0004,0xFF1E0000,
+   0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1B0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF200000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF260000,0xFF190021,0xFF0A0052,
+   0xFF230006,0xFF240000,0xFF250000,0xFF240000,0xFF230000,0xFF290000,0xFF13002C,
+   0xFF030087,0xFF0800AB,0xFF040093,0xFF01007C,0xFF000067,0xFF000059,0xFF000054,
+   0xFF010051,0xFF050043,0xFF0D002C,0xFF160018,0xFF180012,0xFF180012,0xFF190011,
+   0xFF190013,0xFF190012,0xFF1B0010,0xFF1A0012,0xFF190014,0xFF170018,0xFF0C0036,
+   0xFF02006C,0xFF07009A,0xFF040047,0xFF1E0006,0xFF250000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF260000,0xFF0D0032,0xFF08002B,
+   0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF180000,0xFF170000,0xFF170000,
+   0xFF170000,0xFF180000,0xFF190000,0xFF1A0000,0xFF220000,0xFF160026,0xFF01005E,
+   0xFF0E002A,0xFF1B0003,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1D0000,0xFF1C0002,0xFF120020,0xFF070050,0xFF19002F,0xFF250007,0xFF280002,
+   0xFF230017,0xFF080054,0xFF1A000E,0xFF210000,0xFF270000,0xFF2B0007,0xFF180038,
+   0xFF0E0039,0xFF1E0008,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF260000,
+   0xFF190022,0xFF0A0052,0xFF230006,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF290000,0xFF13002B,0xFF030084,0xFF0700A8,0xFF040092,0xFF010079,0xFF000062,
+   0xFF000053,0xFF000050,0xFF01004E,0xFF060041,0xFF0E0029,0xFF170016,0xFF1B0010,
+   0xFF1B000F,0xFF1B000F,0xFF1B0010,0xFF1C000F,0xFF1C000E,0xFF1B000F,0xFF1A0012,
+   0xFF190017,0xFF0D0033,0xFF02006A,0xFF07009D,0xFF040059,0xFF1D000A,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF0C0048,0xFF070043,0xFF15000D,0xFF140010,0xFF14000F,0xFF15000C,0xFF160009,
+   0xFF170007,0xFF180002,0xFF1A0000,0xFF1B0000,0xFF1E0000,0xFF1F0000,0xFF260000,
+   0xFF190029,0xFF010065,0xFF0D0033,0xFF1A000B,0xFF1D0005,0xFF1D0006,0xFF1B000A,
+   0xFF19000D,0xFF19000C,0xFF1A000B,0xFF19000D,0xFF10002C,0xFF070059,0xFF170033,
+   0xFF220007,0xFF250001,0xFF200012,0xFF08004F,0xFF19000F,0xFF200000,0xFF250000,
+   0xFF290008,0xFF16003D,0xFF0C003F,0xFF1A000A,0xFF1D0000,0xFF1C0000,0xFF1B0000,
+   0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF200000,0xFF200000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF220007,0xFF080054,0xFF110051,0xFF240000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF1B001F,0xFF030062,0xFF01007D,0xFF020073,0xFF020064,
+   0xFF040058,0xFF07004D,0xFF090044,0xFF060047,0xFF01005A,0xFF000071,0xFF010075,
+   0xFF010064,0xFF02005D,0xFF020061,0xFF020062,0xFF010065,0xFF010062,0xFF03005B,
+   0xFF04005A,0xFF04005B,0xFF02005D,0xFF000064,0xFF01007B,0xFF050096,0xFF020056,
+   0xFF18000D,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF0D0034,0xFF080033,0xFF190000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF180000,0xFF170000,0xFF170000,0xFF170000,0xFF180000,0xFF190000,
+   0xFF190000,0xFF1B0000,0xFF230003,0xFF0D003B,0xFF000065,0xFF0B0030,0xFF1A0005,
+   0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1A0003,0xFF140016,0xFF09003D,0xFF04005F,
+   0xFF180024,0xFF1F0001,0xFF1E0000,0xFF1F0000,0xFF270000,0xFF10004B,0xFF110030,
+   0xFF200000,0xFF200000,0xFF240000,0xFF2C0003,0xFF1B0033,0xFF0B0046,0xFF1C000C,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF230000,0xFF230000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF220007,0xFF080054,0xFF110051,0xFF250000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF1B001F,0xFF03005F,0xFF010076,
+   0xFF020069,0xFF020058,0xFF040048,0xFF07003B,0xFF090032,0xFF060039,0xFF010052,
+   0xFF00006F,0xFF010072,0xFF010061,0xFF020058,0xFF02005A,0xFF02005B,0xFF010059,
+   0xFF010053,0xFF04004F,0xFF04004E,0xFF040050,0xFF020056,0xFF00005E,0xFF010078,
+   0xFF050096,0xFF020062,0xFF180014,0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF0C0047,0xFF07004A,0xFF14000E,
+   0xFF140010,0xFF140010,0xFF15000D,0xFF15000B,0xFF160009,0xFF170004,0xFF190000,
+   0xFF1B0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF270003,0xFF0E003F,0xFF00006B,
+   0xFF0A003A,0xFF18000F,0xFF1C0008,0xFF1B0009,0xFF1A000B,0xFF19000E,0xFF130021,
+   0xFF080046,0xFF040062,0xFF160023,0xFF1C0000,0xFF1B0000,0xFF1D0000,0xFF240000,
+   0xFF0F0043,0xFF100030,0xFF1E0000,0xFF1D0000,0xFF200000,0xFF280004,0xFF190039,
+   0xFF090050,0xFF160010,0xFF1B0000,0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1E0000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF230004,0xFF0D0032,0xFF02007D,
+   0xFF0C0043,0xFF200007,0xFF220005,0xFF1F000A,0xFF1B0011,0xFF130027,0xFF0A004C,
+   0xFF0D0048,0xFF15002F,0xFF1C0020,0xFF220016,0xFF26000E,0xFF280009,0xFF2A0005,
+   0xFF2C0009,0xFF1E0020,0xFF06004C,0xFF020084,0xFF0700A9,0xFF0800A7,0xFF03008B,
+   0xFF010064,0xFF0D0042,0xFF1D0025,0xFF230017,0xFF260014,0xFF270012,0xFF250015,
+   0xFF1F001F,0xFF130031,0xFF050051,0xFF000068,0xFF100028,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF0E0036,
+   0xFF09003C,0xFF1A0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF190000,0xFF180000,
+   0xFF180000,0xFF180000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF1E0000,
+   0xFF21000D,0xFF050052,0xFF01006E,0xFF070042,0xFF0D002E,0xFF0E002A,0xFF0D0031,
+   0xFF080043,0xFF070052,0xFF0C0069,0xFF0E0056,0xFF12002F,0xFF140026,0xFF150022,
+   0xFF150025,0xFF170025,0xFF09005E,0xFF0C004B,0xFF200000,0xFF210000,0xFF210000,
+   0xFF230000,0xFF2D0002,0xFF150046,0xFF060057,0xFF170019,0xFF210001,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF230005,
+   0xFF0D0032,0xFF02007D,0xFF0C0043,0xFF210007,0xFF230004,0xFF200008,0xFF1B000B,
+   0xFF13001F,0xFF0A0044,0xFF0D003E,0xFF150023,0xFF1C0015,0xFF22000E,0xFF260008,
+   0xFF280005,0xFF2A0003,0xFF2B0005,0xFF1D0018,0xFF050041,0xFF02007D,0xFF0700A8,
+   0xFF0700A5,0xFF020085,0xFF010054,0xFF0E0034,0xFF1F001C,0xFF250012,0xFF270010,
+   0xFF27000F,0xFF250011,0xFF1E001B,0xFF13002B,0xFF05004D,0xFF00006B,0xFF10002F,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF0C0044,0xFF070051,0xFF14000E,0xFF14000F,0xFF14000F,0xFF15000C,
+   0xFF15000B,0xFF160008,0xFF170004,0xFF190001,0xFF1C0000,0xFF1D0000,0xFF1D0000,
+   0xFF1E0000,0xFF220000,0xFF23000E,0xFF050054,0xFF010074,0xFF07004D,0xFF0C0038,
+   0xFF0E0036,0xFF0C003C,0xFF070048,0xFF060050,0xFF0A005E,0xFF0D0049,0xFF110026,
+   0xFF120020,0xFF13001C,0xFF14001E,0xFF16001E,0xFF090056,0xFF0B004C,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF270002,0xFF13004D,0xFF040062,0xFF110020,
+   0xFF190002,0xFF1A0000,0xFF1B0000,0xFF1D0000,0xFF1F0000,0xFF200000,0xFF200000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220003,0xFF0F0029,0xFF02006C,0xFF050099,0xFF020071,0xFF07005E,0xFF090049,
+   0xFF090040,0xFF12002C,0xFF1F0018,0xFF26000A,0xFF280002,0xFF280000,0xFF270000,
+   0xFF250000,0xFF230000,0xFF230000,0xFF230000,0xFF260000,0xFF2E0000,0xFF260014,
+   0xFF05004B,0xFF040091,0xFF050093,0xFF04004F,0xFF180020,0xFF270003,0xFF260000,
+   0xFF240000,0xFF230000,0xFF240000,0xFF260000,0xFF290000,0xFF2D0001,0xFF29000E,
+   0xFF10003D,0xFF040053,0xFF19000F,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF0E0034,0xFF090045,0xFF1A0000,0xFF1A0000,
+   0xFF190000,0xFF190000,0xFF180000,0xFF190000,0xFF190000,0xFF190000,0xFF180000,
+   0xFF180000,0xFF190000,0xFF190000,0xFF190000,0xFF220000,0xFF190022,0xFF02006D,
+   0xFF050096,0xFF030085,0xFF03006F,0xFF0E0052,0xFF19002F,0xFF210012,0xFF250008,
+   0xFF240005,0xFF220007,0xFF210007,0xFF20000A,0xFF200013,0xFF1F0025,0xFF0A0063,
+   0xFF060068,0xFF1C000A,0xFF220000,0xFF220000,0xFF220000,0xFF230005,0xFF10003D,
+   0xFF00007D,0xFF02005F,0xFF130023,0xFF200001,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220003,0xFF0F0029,0xFF02006C,0xFF050099,0xFF02006D,
+   0xFF070053,0xFF090038,0xFF0A002D,0xFF12001D,0xFF1F0010,0xFF260007,0xFF290001,
+   0xFF290000,0xFF280000,0xFF260000,0xFF240000,0xFF230000,0xFF230000,0xFF250000,
+   0xFF2D0000,0xFF25000D,0xFF050039,0xFF04008B,0xFF040091,0xFF040045,0xFF1A0016,
+   0xFF290002,0xFF280000,0xFF260000,0xFF250000,0xFF240000,0xFF250000,0xFF270000,
+   0xFF2B0000,0xFF27000C,0xFF0F003A,0xFF040057,0xFF180013,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF1F0000,0xFF1E0000,0xFF0C0041,0xFF08005A,
+   0xFF140010,0xFF140010,0xFF140010,0xFF14000E,0xFF15000B,0xFF160007,0xFF170003,
+   0xFF180002,0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF240000,
+   0xFF1A0022,0xFF02006B,0xFF050096,0xFF030084,0xFF03006F,0xFF0D004F,0xFF17002A,
+   0xFF20000E,0xFF230007,0xFF220004,0xFF1F0006,0xFF1E0006,0xFF1E0008,0xFF1E0010,
+   0xFF1C001E,0xFF0A005C,0xFF06006C,0xFF18000C,0xFF1D0000,0xFF1D0000,0xFF1C0000,
+   0xFF1D0007,0xFF0D0049,0xFF01008A,0xFF02006F,0xFF0D002D,0xFF190002,0xFF1B0000,
+   0xFF1C0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF1E0009,0xFF0C0035,0xFF010062,0xFF01006E,
+   0xFF020064,0xFF040050,0xFF0D0039,0xFF1B001F,0xFF25000C,0xFF270001,0xFF250000,
+   0xFF220000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF240000,0xFF2F0000,0xFF1E001F,0xFF010060,0xFF02006C,
+   0xFF17001C,0xFF250000,0xFF210000,0xFF200000,0xFF200000,0xFF1E0000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF290000,0xFF2C0009,0xFF09006D,0xFF060051,
+   0xFF1B000B,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF0E0032,0xFF09004F,0xFF1A0001,0xFF1A0000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF190000,0xFF190000,0xFF180000,0xFF180000,0xFF190000,0xFF190000,
+   0xFF180000,0xFF1A0000,0xFF230003,0xFF0D0041,0xFF030089,0xFF030065,0xFF180020,
+   0xFF230002,0xFF200000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1E0000,0xFF1F0000,0xFF260000,0xFF11003C,0xFF01007F,0xFF0A0046,0xFF130024,
+   0xFF140023,0xFF0F0036,0xFF070056,0xFF010073,0xFF020089,0xFF010081,0xFF020067,
+   0xFF0F002D,0xFF1D0005,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF1E000A,0xFF0C0036,
+   0xFF010060,0xFF010068,0xFF020058,0xFF04003F,0xFF0D0029,0xFF1B0015,0xFF240008,
+   0xFF270001,0xFF250000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF230000,0xFF2D0000,0xFF1D0014,
+   0xFF010052,0xFF020067,0xFF180017,0xFF270000,0xFF230000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF250000,0xFF2A0008,
+   0xFF09006B,0xFF060058,0xFF19000F,0xFF210000,0xFF200000,0xFF210000,0xFF200000,
+   0xFF1E0000,0xFF1C0000,0xFF0B0040,0xFF070064,0xFF130013,0xFF130011,0xFF130011,
+   0xFF130011,0xFF15000B,0xFF160007,0xFF170003,0xFF180002,0xFF190001,0xFF190001,
+   0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF250003,0xFF0D003E,0xFF020077,
+   0xFF030050,0xFF160019,0xFF200001,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,
+   0xFF1B0000,0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF220000,0xFF100036,0xFF020083,
+   0xFF09004E,0xFF10002A,0xFF110029,0xFF0D003E,0xFF060062,0xFF010084,0xFF040099,
+   0xFF030092,0xFF020077,0xFF0C0037,0xFF170007,0xFF1C0000,0xFF1E0000,0xFF1F0000,
+   0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230001,0xFF19001B,
+   0xFF06004D,0xFF030056,0xFF0B003D,0xFF160024,0xFF200015,0xFF26000B,0xFF290002,
+   0xFF270000,0xFF240000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF260000,0xFF2D0007,0xFF090042,0xFF050057,0xFF1F0007,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF220000,0xFF220000,
+   0xFF240000,0xFF240009,0xFF190046,0xFF050063,0xFF08003A,0xFF1F0004,0xFF230000,
+   0xFF230000,0xFF230000,0xFF210000,0xFF210000,0xFF0D0034,0xFF07005B,0xFF180004,
+   0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF180000,0xFF180000,0xFF190000,0xFF190000,0xFF180000,0xFF180000,0xFF1E0000,
+   0xFF170028,0xFF010075,0xFF100031,0xFF1F0001,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0007,
+   0xFF080050,0xFF06009B,0xFF050096,0xFF01007D,0xFF010076,0xFF02006B,0xFF080056,
+   0xFF100042,0xFF13003B,0xFF11003F,0xFF0A0056,0xFF020064,0xFF080046,0xFF170013,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220001,0xFF19001B,0xFF06004C,0xFF03004F,0xFF0A0032,0xFF150019,0xFF1E000D,
+   0xFF250007,0xFF280002,0xFF260000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF250000,0xFF2B0004,0xFF090034,0xFF05004F,0xFF200005,
+   0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF200000,0xFF200009,0xFF180044,0xFF040065,0xFF070045,
+   0xFF1D0007,0xFF210000,0xFF210000,0xFF200000,0xFF1C0000,0xFF1B0000,0xFF0B0042,
+   0xFF060070,0xFF120016,0xFF130011,0xFF130011,0xFF130011,0xFF15000C,0xFF160008,
+   0xFF160007,0xFF170005,0xFF170005,0xFF170005,0xFF190002,0xFF1B0000,0xFF1B0000,
+   0xFF1B0000,0xFF210000,0xFF180026,0xFF010062,0xFF100024,0xFF1E0000,0xFF1C0000,
+   0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF190000,
+   0xFF190000,0xFF1B0006,0xFF080049,0xFF07009E,0xFF06009E,0xFF020088,0xFF010082,
+   0xFF030079,0xFF070064,0xFF0D0050,0xFF0F004A,0xFF0D0050,0xFF080066,0xFF020074,
+   0xFF060051,0xFF140017,0xFF1D0001,0xFF1F0000,0xFF200000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF1C000B,0xFF0F0031,0xFF07004C,0xFF16002A,0xFF24000D,0xFF290003,
+   0xFF290000,0xFF280000,0xFF250000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF2C0000,0xFF14002F,
+   0xFF080052,0xFF1F0004,0xFF1F0000,0xFF200000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF220003,0xFF200008,0xFF2F0001,
+   0xFF1B002B,0xFF00005F,0xFF100021,0xFF210000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF0B0039,0xFF040068,0xFF14000E,0xFF1A0000,0xFF1A0000,0xFF1A0000,
+   0xFF1A0000,0xFF190000,0xFF190000,0xFF180000,0xFF180000,0xFF180000,0xFF180000,
+   0xFF190000,0xFF180000,0xFF180000,0xFF1C0000,0xFF120034,0xFF07005F,0xFF1B0008,
+   0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1C0000,
+   0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF11002E,0xFF02007B,0xFF020084,0xFF05006A,
+   0xFF0F0048,0xFF1B0029,0xFF230014,0xFF270006,0xFF290001,0xFF2A0000,0xFF2B0001,
+   0xFF2B0005,0xFF230019,0xFF0D0049,0xFF020059,0xFF0F002E,0xFF1C0007,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210001,0xFF1C000A,0xFF0F0032,0xFF070049,0xFF140024,
+   0xFF220009,0xFF270001,0xFF270000,0xFF260000,0xFF240000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF2A0000,0xFF140024,0xFF080049,0xFF210003,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1E0003,
+   0xFF1C0007,0xFF2B0001,0xFF18002B,0xFF000066,0xFF0F002D,0xFF200001,0xFF210000,
+   0xFF1F0000,0xFF1B0000,0xFF1A0003,0xFF0A0049,0xFF04007E,0xFF0E0024,0xFF140010,
+   0xFF130011,0xFF130011,0xFF15000C,0xFF160008,0xFF160007,0xFF160007,0xFF160008,
+   0xFF160008,0xFF170005,0xFF190001,0xFF1A0000,0xFF1A0000,0xFF1E0000,0xFF130031,
+   0xFF060050,0xFF1C0005,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF0F0029,0xFF020079,
+   0xFF03008C,0xFF050074,0xFF0D0053,0xFF170031,0xFF1C0019,0xFF200009,0xFF200003,
+   0xFF200002,0xFF210003,0xFF220008,0xFF1E001F,0xFF0C0052,0xFF020063,0xFF0D0032,
+   0xFF1B0007,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF03004A,0xFF06004B,
+   0xFF200010,0xFF280000,0xFF250000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF270000,0xFF1D001F,0xFF080051,0xFF1F0006,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF230001,0xFF1F0009,0xFF230002,0xFF260000,0xFF2D0006,0xFF0A004A,0xFF020046,
+   0xFF1A000A,0xFF220000,0xFF200000,0xFF1F0000,0xFF1E0004,0xFF070045,0xFF040080,
+   0xFF070035,0xFF170006,0xFF1A0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF180000,0xFF170000,0xFF180000,0xFF180000,0xFF180000,0xFF190000,
+   0xFF19000A,0xFF07005D,0xFF110031,0xFF1C0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,
+   0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1B0000,0xFF1D0000,0xFF1F0000,0xFF180019,
+   0xFF03006E,0xFF04006A,0xFF10003A,0xFF210013,0xFF270002,0xFF260000,0xFF240000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF260000,0xFF2B0006,
+   0xFF17002D,0xFF020056,0xFF06004C,0xFF120022,0xFF17000F,0xFF140014,0xFF0C0026,
+   0xFF030049,0xFF050048,0xFF1E000D,0xFF250000,0xFF240000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF260000,0xFF1D0016,0xFF080047,
+   0xFF200006,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0000,0xFF1F0001,0xFF1B0008,0xFF1F0002,0xFF220000,0xFF290006,
+   0xFF09004D,0xFF010057,0xFF180012,0xFF210000,0xFF1F0000,0xFF1B0000,0xFF190008,
+   0xFF060057,0xFF050092,0xFF050050,0xFF11001A,0xFF120014,0xFF120014,0xFF14000E,
+   0xFF150009,0xFF160007,0xFF160007,0xFF160009,0xFF15000A,0xFF160007,0xFF180003,
+   0xFF180001,0xFF190000,0xFF19000A,0xFF07005A,0xFF100029,0xFF1C0000,0xFF1B0000,
+   0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,
+   0xFF1C0000,0xFF140017,0xFF04006C,0xFF040073,0xFF0E0041,0xFF1C0017,0xFF1F0003,
+   0xFF1D0000,0xFF1A0002,0xFF180005,0xFF170008,0xFF160009,0xFF160008,0xFF180006,
+   0xFF1F0001,0xFF260007,0xFF150033,0xFF02005D,0xFF06004F,0xFF120022,0xFF19000D,
+   0xFF160012,0xFF0E0021,0xFF01005F,0xFF15001D,0xFF270000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF220000,
+   0xFF220012,0xFF070056,0xFF1C000D,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF200000,0xFF220000,0xFF220000,0xFF230000,0xFF1D000E,0xFF200008,0xFF230000,
+   0xFF230000,0xFF2C0000,0xFF17002E,0xFF000057,0xFF100019,0xFF220000,0xFF200000,
+   0xFF1D0002,0xFF0F001E,0xFF030062,0xFF0900A6,0xFF02006C,0xFF070033,0xFF15000B,
+   0xFF190001,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF180000,0xFF170000,
+   0xFF180000,0xFF180000,0xFF170002,0xFF120012,0xFF080048,0xFF040068,0xFF18000D,
+   0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,
+   0xFF1B0000,0xFF1E0000,0xFF1C000C,0xFF07005B,0xFF0B0057,0xFF1F0015,0xFF250001,
+   0xFF230000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF230000,0xFF2C0001,0xFF220016,0xFF080042,
+   0xFF00005E,0xFF01005A,0xFF02005D,0xFF020076,0xFF010061,0xFF140015,0xFF240000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF230000,0xFF23000B,0xFF070044,0xFF1D000B,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF19000D,
+   0xFF1D0007,0xFF200000,0xFF200000,0xFF270000,0xFF14002F,0xFF000066,0xFF0F0029,
+   0xFF210000,0xFF1F0000,0xFF1A0004,0xFF0D0029,0xFF03006E,0xFF0B00AF,0xFF030084,
+   0xFF050051,0xFF0E0025,0xFF110017,0xFF13000F,0xFF160009,0xFF160008,0xFF150009,
+   0xFF150009,0xFF150009,0xFF150009,0xFF170006,0xFF160008,0xFF12001A,0xFF08004D,
+   0xFF040061,0xFF17000A,0xFF1A0000,0xFF1A0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF190009,0xFF060054,0xFF09005C,
+   0xFF1A0019,0xFF1F0002,0xFF1B0001,0xFF170005,0xFF170007,0xFF170007,0xFF170007,
+   0xFF160008,0xFF16000A,0xFF15000B,0xFF160009,0xFF180003,0xFF1E0000,0xFF280001,
+   0xFF1F0019,0xFF070047,0xFF00005F,0xFF020056,0xFF03005A,0xFF03006F,0xFF02004B,
+   0xFF1B0010,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF270005,0xFF0C0050,0xFF120028,
+   0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF210007,0xFF1C0015,0xFF240000,0xFF230000,0xFF230000,0xFF2A0000,0xFF190024,
+   0xFF000065,0xFF040036,0xFF120011,0xFF120011,0xFF08002B,0xFF020059,0xFF07009A,
+   0xFF0B00B7,0xFF0900A6,0xFF020072,0xFF03004E,0xFF090033,0xFF0E0020,0xFF100017,
+   0xFF120014,0xFF120011,0xFF110013,0xFF0F0018,0xFF0E001B,0xFF0C0024,0xFF070039,
+   0xFF020059,0xFF01007A,0xFF0B0042,0xFF1B0000,0xFF1B0000,0xFF1B0000,0xFF1B0000,
+   0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1C0000,0xFF1D0005,0xFF0B0048,
+   0xFF08005A,0xFF20000C,0xFF230000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF220000,0xFF2A0000,0xFF2A0009,0xFF12002A,0xFF010055,0xFF030088,
+   0xFF0700A8,0xFF02004F,0xFF190009,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF280002,
+   0xFF0C003A,0xFF14001E,0xFF220000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF1F0000,0xFF1E0007,0xFF180014,0xFF200000,0xFF200000,0xFF200000,
+   0xFF250000,0xFF170027,0xFF000071,0xFF04004D,0xFF11001F,0xFF11001D,0xFF08003A,
+   0xFF020065,0xFF0900A0,0xFF0D00BC,0xFF0B00B1,0xFF03008B,0xFF02006C,0xFF060050,
+   0xFF0A0038,0xFF0E0027,0xFF0F0021,0xFF10001F,0xFF100020,0xFF0E0026,0xFF0D002A,
+   0xFF0B0036,0xFF06004D,0xFF02006C,0xFF01007F,0xFF0A0039,0xFF1A0000,0xFF1A0000,
+   0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,
+   0xFF1B0004,0xFF0A003F,0xFF060057,0xFF1A000E,0xFF1B0000,0xFF180003,0xFF180005,
+   0xFF170007,0xFF16000A,0xFF16000A,0xFF170007,0xFF170006,0xFF160009,0xFF15000C,
+   0xFF160008,0xFF190002,0xFF1B0000,0xFF1E0000,0xFF270000,0xFF28000A,0xFF12002B,
+   0xFF020053,0xFF030086,0xFF0800AD,0xFF01005F,0xFF17001A,0xFF260000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF240000,0xFF1D0026,0xFF080053,0xFF1C0008,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF220000,0xFF1C0014,0xFF20000C,0xFF240000,
+   0xFF240000,0xFF250000,0xFF240006,0xFF0B0035,0xFF010080,0xFF010076,0xFF000047,
+   0xFF00004D,0xFF010073,0xFF040089,0xFF050095,0xFF050097,0xFF06009B,0xFF040094,
+   0xFF010081,0xFF00006F,0xFF000063,0xFF000060,0xFF010064,0xFF020063,0xFF020064,
+   0xFF020069,0xFF02006B,0xFF020073,0xFF040087,0xFF0700A1,0xFF030081,0xFF110026,
+   0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,
+   0xFF1A0000,0xFF1C0001,0xFF0E003D,0xFF060064,0xFF1B0015,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF270000,0xFF2F0002,0xFF200017,0xFF06003E,0xFF02007A,0xFF01005B,0xFF160012,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF260000,0xFF1F001A,0xFF09003F,0xFF1F0005,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF200000,0xFF190013,
+   0xFF1C000B,0xFF200000,0xFF200000,0xFF200000,0xFF1F0006,0xFF0A003E,0xFF030089,
+   0xFF020082,0xFF00005A,0xFF00005C,0xFF02007B,0xFF05008E,0xFF060098,0xFF06009A,
+   0xFF0700A0,0xFF06009F,0xFF030092,0xFF000084,0xFF00007B,0xFF000072,0xFF010070,
+   0xFF020071,0xFF020072,0xFF020076,0xFF02007C,0xFF030086,0xFF050096,0xFF0900AA,
+   0xFF03007D,0xFF0F0020,0xFF1B0000,0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,
+   0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0001,0xFF0D0034,0xFF05005F,0xFF160017,
+   0xFF190001,0xFF180003,0xFF170006,0xFF170006,0xFF170008,0xFF160009,0xFF170008,
+   0xFF170007,0xFF160009,0xFF16000B,0xFF15000B,0xFF170006,0xFF190001,0xFF1B0000,
+   0xFF1D0000,0xFF1F0000,0xFF250000,0xFF2F0002,0xFF210016,0xFF07003C,0xFF030076,
+   0xFF000078,0xFF110037,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF240009,
+   0xFF06005B,0xFF0D003C,0xFF1E0002,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,
+   0xFF210005,0xFF19001A,0xFF240002,0xFF250000,0xFF230001,0xFF1A0015,0xFF090044,
+   0xFF000069,0xFF00006C,0xFF030055,0xFF060046,0xFF07004B,0xFF0A004E,0xFF0A004D,
+   0xFF0A004D,0xFF0C004C,0xFF0C004F,0xFF0B0053,0xFF090057,0xFF06005D,0xFF030063,
+   0xFF01006A,0xFF000075,0xFF010084,0xFF040094,0xFF0800A4,0xFF0A00AF,0xFF0B00B3,
+   0xFF0C00B7,0xFF0C00B8,0xFF030082,0xFF0F002D,0xFF1F0000,0xFF1E0000,0xFF1D0000,
+   0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF12002E,0xFF030074,
+   0xFF150026,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF240000,0xFF260000,0xFF2F0000,
+   0xFF29000D,0xFF0B0039,0xFF000065,0xFF10002A,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF270005,0xFF070042,0xFF0F002E,0xFF200001,0xFF200000,0xFF200000,
+   0xFF200000,0xFF1F0000,0xFF1F0004,0xFF160018,0xFF200001,0xFF210000,0xFF1F0001,
+   0xFF170014,0xFF070043,0xFF00006D,0xFF01006E,0xFF030058,0xFF050047,0xFF07004A,
+   0xFF0A004C,0xFF0B004A,0xFF0B0047,0xFF0C0048,0xFF0B004F,0xFF0A0056,0xFF09005B,
+   0xFF060063,0xFF03006A,0xFF01006F,0xFF00007A,0xFF02008A,0xFF050099,0xFF0800A9,
+   0xFF0B00B5,0xFF0D00BA,0xFF0E00BC,0xFF0D00B9,0xFF03007A,0xFF0D0028,0xFF1D0000,
+   0xFF1B0000,0xFF1A0000,0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,
+   0xFF110025,0xFF030068,0xFF120028,0xFF190003,0xFF170008,0xFF160008,0xFF170008,
+   0xFF170007,0xFF170007,0xFF170007,0xFF170005,0xFF170006,0xFF16000B,0xFF15000C,
+   0xFF16000A,0xFF170006,0xFF190001,0xFF1C0000,0xFF1E0000,0xFF200000,0xFF220000,
+   0xFF250000,0xFF300000,0xFF2A000D,0xFF0D0031,0xFF020056,0xFF090057,0xFF230005,
+   0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF240000,0xFF14002E,0xFF010069,0xFF0F0033,
+   0xFF1D0003,0xFF200000,0xFF210000,0xFF220000,0xFF190024,0xFF1A001A,0xFF200006,
+   0xFF190018,0xFF0C003E,0xFF020063,0xFF050061,0xFF0F0042,0xFF180024,0xFF1F0011,
+   0xFF220009,0xFF21000A,0xFF210008,0xFF20000B,0xFF1F0009,0xFF220005,0xFF230005,
+   0xFF230006,0xFF230007,0xFF22000C,0xFF210013,0xFF1D001E,0xFF18002D,0xFF11003F,
+   0xFF090053,0xFF03006B,0xFF020082,0xFF050098,0xFF0900AD,0xFF0C00B8,0xFF04008D,
+   0xFF0B0039,0xFF200000,0xFF200000,0xFF1F0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,
+   0xFF1A0002,0xFF0F0030,0xFF030078,0xFF0E0041,0xFF1E0002,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF2D0000,0xFF2B000C,0xFF060046,
+   0xFF080046,0xFF210003,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF280000,0xFF16001C,
+   0xFF01004B,0xFF100024,0xFF1E0002,0xFF210000,0xFF210000,0xFF210000,0xFF180023,
+   0xFF170019,0xFF1C0005,0xFF160016,0xFF0B0037,0xFF010058,0xFF05005B,0xFF0F003E,
+   0xFF170021,0xFF1E000F,0xFF210007,0xFF210007,0xFF210004,0xFF220004,0xFF210003,
+   0xFF210002,0xFF200004,0xFF200005,0xFF210006,0xFF21000B,0xFF200011,0xFF1E001B,
+   0xFF19002B,0xFF120040,0xFF090057,0xFF030072,0xFF03008B,0xFF07009F,0xFF0B00B1,
+   0xFF0D00BA,0xFF040086,0xFF090034,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,
+   0xFF190000,0xFF1A0000,0xFF190002,0xFF0F0026,0xFF020065,0xFF0D003C,0xFF1B0003,
+   0xFF180004,0xFF170008,0xFF170007,0xFF170006,0xFF170006,0xFF180005,0xFF170006,
+   0xFF170006,0xFF170008,0xFF15000C,0xFF16000B,0xFF170007,0xFF170005,0xFF180002,
+   0xFF1B0000,0xFF1F0000,0xFF210000,0xFF220000,0xFF230000,0xFF250000,0xFF2D0000,
+   0xFF300007,0xFF190029,0xFF030067,0xFF190025,0xFF250000,0xFF250000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1F0000,0xFF250008,0xFF0A0047,0xFF010073,0xFF080043,0xFF12001E,0xFF150017,
+   0xFF120025,0xFF0A0079,0xFF070054,0xFF060057,0xFF01006E,0xFF040063,0xFF150034,
+   0xFF24000C,0xFF260001,0xFF230002,0xFF1F0005,0xFF1E0007,0xFF1D0009,0xFF1C000B,
+   0xFF1B000C,0xFF1A000C,0xFF1B0009,0xFF1A000A,0xFF19000B,0xFF1A000A,0xFF1A000A,
+   0xFF1B0009,0xFF1D0008,0xFF200005,0xFF230004,0xFF250009,0xFF20001A,0xFF150034,
+   0xFF090050,0xFF03006D,0xFF04008D,0xFF06009B,0xFF050064,0xFF180014,0xFF200000,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF1C0004,0xFF0E0034,0xFF02007D,0xFF090057,
+   0xFF1E0007,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF2E0000,0xFF1D0023,0xFF02005A,0xFF17001D,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF230000,0xFF280004,0xFF0A002B,0xFF010054,0xFF090033,
+   0xFF130015,0xFF150012,0xFF110020,0xFF090074,0xFF070050,0xFF050051,0xFF010060,
+   0xFF050055,0xFF17002D,0xFF26000B,0xFF270001,0xFF230000,0xFF1F0000,0xFF1D0000,
+   0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1A0000,0xFF170003,0xFF170005,
+   0xFF170004,0xFF180004,0xFF190003,0xFF1D0000,0xFF220000,0xFF250000,0xFF260007,
+   0xFF20001A,0xFF150036,0xFF090053,0xFF03006F,0xFF050092,0xFF07009D,0xFF04005D,
+   0xFF160011,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1A0003,0xFF0D002A,
+   0xFF010069,0xFF08004D,0xFF1C0007,0xFF1B0000,0xFF190002,0xFF180005,0xFF180002,
+   0xFF180003,0xFF180003,0xFF190002,0xFF170005,0xFF170006,0xFF160009,0xFF16000B,
+   0xFF170007,0xFF1A0002,0xFF1B0001,0xFF1C0000,0xFF1D0000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF240000,0xFF250000,0xFF250000,0xFF2D0000,0xFF300004,0xFF0F0049,
+   0xFF090058,0xFF220005,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF230000,0xFF1C001B,
+   0xFF020068,0xFF04008D,0xFF020072,0xFF020069,0xFF030077,0xFF0800A7,0xFF050096,
+   0xFF030075,0xFF11003E,0xFF20000F,0xFF220002,0xFF210001,0xFF1F0003,0xFF1D0007,
+   0xFF1D0009,0xFF1D0009,0xFF1C0009,0xFF1C000A,0xFF1C0009,0xFF1C0009,0xFF1B0009,
+   0xFF1A000B,0xFF19000C,0xFF19000B,0xFF19000E,0xFF180010,0xFF180010,0xFF18000F,
+   0xFF18000F,0xFF1B000A,0xFF200003,0xFF240001,0xFF260008,0xFF21001A,0xFF160037,
+   0xFF080063,0xFF030084,0xFF060072,0xFF100033,0xFF170016,0xFF15001A,0xFF120022,
+   0xFF0A0045,0xFF03007E,0xFF08005A,0xFF1E0010,0xFF220000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF260000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF270000,
+   0xFF2F0004,0xFF0F0044,0xFF080047,0xFF210003,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF260000,0xFF1E000F,0xFF020049,0xFF03007A,0xFF020062,0xFF02005C,0xFF03006F,
+   0xFF0900A2,0xFF060090,0xFF030068,0xFF110032,0xFF21000B,0xFF250000,0xFF230000,
+   0xFF210000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1C0000,0xFF180002,0xFF170006,0xFF160006,0xFF150009,0xFF160008,
+   0xFF180002,0xFF190000,0xFF1A0000,0xFF1B0000,0xFF1F0000,0xFF240000,0xFF270006,
+   0xFF220019,0xFF150037,0xFF080068,0xFF030088,0xFF06006B,0xFF0F002D,0xFF150012,
+   0xFF130015,0xFF11001C,0xFF090037,0xFF02006A,0xFF070050,0xFF1B0010,0xFF1D0000,
+   0xFF1C0000,0xFF1B0000,0xFF190001,0xFF190001,0xFF180002,0xFF180002,0xFF180004,
+   0xFF170007,0xFF160009,0xFF15000C,0xFF170007,0xFF1A0001,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF230000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF2C0000,0xFF24001D,0xFF03006F,0xFF1A001F,0xFF250000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1C0000,0xFF1B0000,0xFF1C0000,0xFF230006,0xFF090043,0xFF050090,0xFF0B00B5,
+   0xFF0B00B1,0xFF0B00B4,0xFF0900AE,0xFF020074,0xFF12002E,0xFF210004,0xFF1E0006,
+   0xFF1D0008,0xFF1D0007,0xFF1D0007,0xFF1D0008,0xFF1D0008,0xFF1C0009,0xFF1D0008,
+   0xFF1D0007,0xFF1D0005,0xFF1D0007,0xFF1C0008,0xFF1A000B,0xFF19000C,0xFF1A000B,
+   0xFF19000D,0xFF19000E,0xFF19000E,0xFF18000F,0xFF180010,0xFF19000D,0xFF1A000A,
+   0xFF1B000A,0xFF1B0009,0xFF200004,0xFF270001,0xFF26000C,0xFF18002F,0xFF080061,
+   0xFF030081,0xFF030071,0xFF02006D,0xFF020076,0xFF030083,0xFF05005D,0xFF1B0012,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF250000,0xFF260000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF2B0000,0xFF24001C,0xFF02005F,
+   0xFF180017,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF260003,0xFF0A002A,
+   0xFF03007D,0xFF0A00B1,0xFF0A00AE,0xFF0A00B1,0xFF0900AA,0xFF02006B,0xFF120027,
+   0xFF230001,0xFF210000,0xFF200000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF190000,
+   0xFF170003,0xFF160007,0xFF15000A,0xFF160009,0xFF180003,0xFF190000,0xFF180001,
+   0xFF180002,0xFF190000,0xFF1C0000,0xFF1D0000,0xFF210000,0xFF250000,0xFF24000C,
+   0xFF180032,0xFF090066,0xFF030080,0xFF030069,0xFF020062,0xFF02006A,0xFF020074,
+   0xFF050057,0xFF1A0013,0xFF200000,0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1B0000,
+   0xFF1B0000,0xFF190002,0xFF180004,0xFF170008,0xFF170008,0xFF170007,0xFF170007,
+   0xFF190002,0xFF1C0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF220000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF2C0007,0xFF09005E,0xFF0F0048,0xFF250000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF200000,
+   0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1B0000,0xFF1A0000,0xFF190001,
+   0xFF1F0000,0xFF180020,0xFF02006D,0xFF0A00B0,0xFF0C00B8,0xFF0C00B7,0xFF050099,
+   0xFF050052,0xFF1C000C,0xFF1D0007,0xFF1C000A,0xFF1C000A,0xFF1C0008,0xFF1C0009,
+   0xFF1C0009,0xFF1C0008,0xFF1C0007,0xFF1D0007,0xFF1D0006,0xFF1E0004,0xFF1D0005,
+   0xFF1C0007,0xFF1B000A,0xFF1A000B,0xFF1A000A,0xFF1B0009,0xFF1B0009,0xFF1A000C,
+   0xFF19000E,0xFF18000F,0xFF19000E,0xFF1A000B,0xFF1B000A,0xFF1A000B,0xFF1B0009,
+   0xFF1D0005,0xFF200002,0xFF260001,0xFF26000D,0xFF0D0049,0xFF020083,0xFF0900AB,
+   0xFF0900AE,0xFF02006F,0xFF140022,0xFF220000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF2D0007,0xFF090057,0xFF0E003B,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF1E0000,0xFF230000,0xFF1A0013,0xFF010058,0xFF0900AD,0xFF0C00B7,
+   0xFF0B00B7,0xFF040091,0xFF060045,0xFF1F0007,0xFF200000,0xFF200000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF1D0000,0xFF1C0000,0xFF1A0000,0xFF180001,0xFF170005,0xFF160007,
+   0xFF170006,0xFF180004,0xFF180002,0xFF180002,0xFF180003,0xFF190001,0xFF1A0000,
+   0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1E0000,0xFF250000,0xFF27000C,0xFF0E0046,
+   0xFF030081,0xFF0900AC,0xFF0A00AE,0xFF020074,0xFF120026,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1A0000,0xFF180003,
+   0xFF170007,0xFF180004,0xFF190001,0xFF180002,0xFF1A0001,0xFF1C0000,0xFF1D0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF2D0000,0xFF190035,0xFF070062,
+   0xFF220007,0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1B0000,0xFF190001,0xFF180004,0xFF1A0003,0xFF210009,0xFF06004E,
+   0xFF07009D,0xFF0C00B9,0xFF0A00B1,0xFF010078,0xFF0F002F,0xFF1D0007,0xFF1D0008,
+   0xFF1C000A,0xFF1C000A,0xFF1C0008,0xFF1C0009,0xFF1C0009,0xFF1B0009,0xFF1C0008,
+   0xFF1D0006,0xFF1D0005,0xFF1E0004,0xFF1E0005,0xFF1D0006,0xFF1C0008,0xFF1D0005,
+   0xFF1D0005,0xFF1D0005,0xFF1D0006,0xFF1C0008,0xFF1A000B,0xFF19000C,0xFF19000C,
+   0xFF1A000B,0xFF1B0009,0xFF1B0009,0xFF1B000A,0xFF1C0007,0xFF1D0005,0xFF1C0007,
+   0xFF220002,0xFF26000F,0xFF080050,0xFF03008C,0xFF06009C,0xFF04004E,0xFF1D000A,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF260000,0xFF260000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF2D0000,
+   0xFF190035,0xFF07005A,0xFF210006,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1F0000,
+   0xFF240005,0xFF070038,0xFF060096,0xFF0B00B8,0xFF0900AE,0xFF01006B,0xFF120024,
+   0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,
+   0xFF1B0000,0xFF1A0000,0xFF180001,0xFF180004,0xFF170004,0xFF180004,0xFF180003,
+   0xFF180002,0xFF180002,0xFF180001,0xFF190000,0xFF1A0000,0xFF1B0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF230000,0xFF28000C,0xFF090047,0xFF040089,0xFF0700A0,
+   0xFF030057,0xFF19000C,0xFF1C0000,0xFF1D0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,
+   0xFF1C0000,0xFF1B0000,0xFF190000,0xFF180003,0xFF170006,0xFF170004,0xFF190002,
+   0xFF190001,0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF200000,
+   0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF280000,0xFF280013,0xFF050062,0xFF1B0022,0xFF250000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1B0000,0xFF190001,
+   0xFF180004,0xFF180005,0xFF1F0002,0xFF0F0034,0xFF030086,0xFF0B00B7,0xFF050099,
+   0xFF050053,0xFF190012,0xFF1B000B,0xFF1C000A,0xFF1C000B,0xFF1B000A,0xFF1C0008,
+   0xFF1C0009,0xFF1A000B,0xFF1A000B,0xFF1B000B,0xFF1C0008,0xFF1D0006,0xFF1D0004,
+   0xFF1D0005,0xFF1D0006,0xFF1D0006,0xFF1E0004,0xFF1D0004,0xFF1D0005,0xFF1D0006,
+   0xFF1D0007,0xFF1C0008,0xFF1B0009,0xFF1A000B,0xFF1A000B,0xFF1B0009,0xFF1B000A,
+   0xFF1A000B,0xFF1C0008,0xFF1D0006,0xFF1C0007,0xFF1D0006,0xFF240001,0xFF220017,
+   0xFF05005D,0xFF01007A,0xFF0A0038,0xFF200002,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF260000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF280000,0xFF280013,0xFF050061,0xFF190020,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF230000,0xFF110020,0xFF020078,
+   0xFF0A00B5,0xFF050093,0xFF060047,0xFF1E0009,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1A0000,0xFF190001,
+   0xFF180003,0xFF170005,0xFF180003,0xFF180002,0xFF180002,0xFF180002,0xFF180002,
+   0xFF190000,0xFF1A0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF250000,0xFF240013,0xFF050057,0xFF01007F,0xFF08003F,0xFF1B0002,0xFF1A0000,
+   0xFF1A0000,0xFF1A0000,0xFF1A0001,0xFF1B0001,0xFF190002,0xFF190002,0xFF180002,
+   0xFF170004,0xFF170006,0xFF180003,0xFF190001,0xFF190000,0xFF1A0000,0xFF1C0000,
+   0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF210000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF2C0005,
+   0xFF0A004C,0xFF0B0053,0xFF220004,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF190002,0xFF170006,0xFF1C0002,
+   0xFF170020,0xFF020074,0xFF0A00B4,0xFF020080,0xFF0E0031,0xFF1B000B,0xFF1A000C,
+   0xFF1C000B,0xFF1B000B,0xFF1A000B,0xFF1B000A,0xFF1A000C,0xFF19000D,0xFF1A000C,
+   0xFF1A000C,0xFF1B000A,0xFF1D0007,0xFF1D0005,0xFF1D0006,0xFF1D0006,0xFF1C0007,
+   0xFF1D0006,0xFF1C0007,0xFF1C0008,0xFF1C0008,0xFF1C0007,0xFF1C0007,0xFF1C0008,
+   0xFF1B000A,0xFF1A000A,0xFF1B0009,0xFF1B0009,0xFF1C0009,0xFF1C0008,0xFF1C0007,
+   0xFF1C0007,0xFF1D0006,0xFF1E0004,0xFF260001,0xFF110039,0xFF00006B,0xFF0D0030,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF260000,0xFF260000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF260000,0xFF2C0005,0xFF0A004C,0xFF0A004C,0xFF210003,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,
+   0xFF1C0000,0xFF200000,0xFF190013,0xFF020061,0xFF0900AD,0xFF020075,0xFF110026,
+   0xFF210000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1A0000,0xFF180002,0xFF170005,0xFF170005,
+   0xFF180003,0xFF180003,0xFF180002,0xFF180002,0xFF190001,0xFF1A0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF280000,0xFF130034,
+   0xFF00006F,0xFF0A0038,0xFF1A0000,0xFF190001,0xFF190001,0xFF190003,0xFF180005,
+   0xFF180006,0xFF170007,0xFF180004,0xFF180002,0xFF180003,0xFF180003,0xFF190001,
+   0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,
+   0xFF200000,0xFF210000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF2C0000,0xFF17002F,0xFF010069,0xFF170027,
+   0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF1F0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1A0000,0xFF1A0000,
+   0xFF1A0001,0xFF180003,0xFF170006,0xFF1A0004,0xFF1A0016,0xFF03006C,0xFF0900AE,
+   0xFF020070,0xFF130022,0xFF1A000E,0xFF1A000D,0xFF1C000B,0xFF1B000B,0xFF1A000D,
+   0xFF19000F,0xFF180011,0xFF180010,0xFF19000F,0xFF1A000C,0xFF1A000B,0xFF1C0008,
+   0xFF1C0007,0xFF1C0007,0xFF1C0007,0xFF1B0009,0xFF1B0009,0xFF1A000A,0xFF1A000A,
+   0xFF1B0009,0xFF1C0007,0xFF1D0006,0xFF1C0008,0xFF1B0009,0xFF1B0009,0xFF1B0009,
+   0xFF1B0009,0xFF1B0008,0xFF1C0008,0xFF1C0008,0xFF1C0007,0xFF1D0006,0xFF1C0007,
+   0xFF200004,0xFF1E001A,0xFF020063,0xFF0C003B,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF2C0000,0xFF17002E,
+   0xFF000063,0xFF170020,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1E0000,0xFF1C000C,
+   0xFF020056,0xFF0700A4,0xFF020061,0xFF170013,0xFF200000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,
+   0xFF1D0000,0xFF1A0000,0xFF190002,0xFF180003,0xFF180002,0xFF180002,0xFF180002,
+   0xFF180002,0xFF180002,0xFF190000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,
+   0xFF1B0000,0xFF1B0000,0xFF200000,0xFF1F0017,0xFF020066,0xFF090045,0xFF190001,
+   0xFF190002,0xFF180003,0xFF180005,0xFF170007,0xFF16000A,0xFF160009,0xFF170006,
+   0xFF170004,0xFF180004,0xFF180003,0xFF190000,0xFF1B0000,0xFF1B0000,0xFF1A0000,
+   0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1F0000,0xFF200000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF290000,0xFF230019,0xFF01005C,0xFF0B0053,0xFF210003,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF210000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,
+   0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF190002,0xFF180005,0xFF170007,
+   0xFF190004,0xFF180018,0xFF030070,0xFF0900AC,0xFF020069,0xFF13001F,0xFF1A000D,
+   0xFF1B000C,0xFF1C000A,0xFF1C000A,0xFF1A000E,0xFF170012,0xFF180012,0xFF170012,
+   0xFF170012,0xFF19000F,0xFF1A000C,0xFF1A000B,0xFF1B0008,0xFF1C0007,0xFF1B0008,
+   0xFF1A000B,0xFF1A000C,0xFF19000D,0xFF1A000C,0xFF1B000A,0xFF1B0008,0xFF1C0007,
+   0xFF1C0007,0xFF1C0007,0xFF1C0008,0xFF1B0009,0xFF1C0008,0xFF1C0008,0xFF1C0008,
+   0xFF1B0009,0xFF1B0009,0xFF1C0009,0xFF1C000A,0xFF1D0008,0xFF250005,0xFF0B0043,
+   0xFF07004B,0xFF200003,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF290000,0xFF230018,0xFF010058,0xFF0A0046,0xFF220002,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1F0000,0xFF1B000E,0xFF02005A,0xFF0700A2,0xFF02005A,
+   0xFF18000F,0xFF210000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF1E0000,0xFF1C0000,
+   0xFF190000,0xFF190001,0xFF190001,0xFF180002,0xFF180002,0xFF180002,0xFF180001,
+   0xFF190000,0xFF190000,0xFF190001,0xFF190001,0xFF190001,0xFF190001,0xFF1B0000,
+   0xFF250003,0xFF0B0049,0xFF050057,0xFF180005,0xFF180003,0xFF180005,0xFF170007,
+   0xFF170008,0xFF160009,0xFF160008,0xFF160007,0xFF160007,0xFF170005,0xFF170004,
+   0xFF190001,0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,
+   0xFF1F0000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF250000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF2D0006,0xFF0C0042,
+   0xFF020068,0xFF1B0019,0xFF220000,0xFF220000,0xFF230000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1A0000,
+   0xFF190000,0xFF190003,0xFF180005,0xFF180005,0xFF1A0003,0xFF11002B,0xFF03007D,
+   0xFF0A00B2,0xFF020071,0xFF100028,0xFF1A000D,0xFF1A000D,0xFF1A000D,0xFF1A000E,
+   0xFF190010,0xFF170012,0xFF180011,0xFF170013,0xFF170014,0xFF180011,0xFF19000D,
+   0xFF19000D,0xFF1A000C,0xFF1B0008,0xFF1A000A,0xFF19000C,0xFF1A000C,0xFF19000E,
+   0xFF19000E,0xFF1A000B,0xFF1B0009,0xFF1C0008,0xFF1C0008,0xFF1C0008,0xFF1C0007,
+   0xFF1D0006,0xFF1D0005,0xFF1D0006,0xFF1C0008,0xFF1B0009,0xFF1B000A,0xFF1B000B,
+   0xFF1C0009,0xFF1D0007,0xFF240002,0xFF190022,0xFF030054,0xFF1B000F,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF2D0005,0xFF0C003E,0xFF020058,0xFF1C0012,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1F0000,
+   0xFF12001B,0xFF02006F,0xFF0800AA,0xFF02005F,0xFF150015,0xFF220000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF1E0000,0xFF1B0000,0xFF1A0000,0xFF190000,
+   0xFF180002,0xFF180002,0xFF190001,0xFF190000,0xFF190001,0xFF180001,0xFF190001,
+   0xFF180002,0xFF180002,0xFF190001,0xFF1A0000,0xFF220000,0xFF180028,0xFF020061,
+   0xFF140015,0xFF170006,0xFF170008,0xFF160009,0xFF160009,0xFF170007,0xFF170007,
+   0xFF170006,0xFF170006,0xFF170005,0xFF180004,0xFF190001,0xFF1B0000,0xFF1D0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF270000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF2B0000,0xFF23001A,0xFF020060,0xFF0F0043,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF1E0000,
+   0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF190000,0xFF180003,0xFF180005,
+   0xFF180005,0xFF1A0008,0xFF07004D,0xFF060098,0xFF0C00B9,0xFF02007E,0xFF0D0033,
+   0xFF180010,0xFF19000F,0xFF190010,0xFF190010,0xFF19000F,0xFF19000E,0xFF19000D,
+   0xFF180011,0xFF170013,0xFF18000F,0xFF19000D,0xFF18000F,0xFF19000E,0xFF1A000B,
+   0xFF19000C,0xFF1A000C,0xFF1C000A,0xFF1A000C,0xFF19000E,0xFF19000D,0xFF19000D,
+   0xFF1A000C,0xFF1B000A,0xFF1C0008,0xFF1C0007,0xFF1C0007,0xFF1D0005,0xFF1D0005,
+   0xFF1D0006,0xFF1C0008,0xFF1B0009,0xFF1C0009,0xFF1D0008,0xFF1E0006,0xFF210002,
+   0xFF1B0019,0xFF010058,0xFF16001D,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF270000,0xFF270000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF2C0000,0xFF240019,0xFF020055,
+   0xFF0F0035,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1E0003,0xFF080038,0xFF04008D,0xFF0900B0,
+   0xFF020068,0xFF12001B,0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF240000,0xFF230000,0xFF210000,
+   0xFF1F0000,0xFF1D0000,0xFF1B0000,0xFF1A0000,0xFF190001,0xFF180001,0xFF190000,
+   0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF180001,0xFF190002,0xFF190000,
+   0xFF1A0000,0xFF1F0000,0xFF1B001E,0xFF010067,0xFF100026,0xFF170006,0xFF170008,
+   0xFF160008,0xFF160009,0xFF160008,0xFF170007,0xFF170005,0xFF180002,0xFF180003,
+   0xFF190001,0xFF1B0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF2E0002,0xFF120039,0xFF02006C,0xFF150024,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1B0000,0xFF1A0000,0xFF190002,0xFF180006,0xFF180004,0xFF15001C,0xFF020070,
+   0xFF030090,0xFF07009F,0xFF030089,0xFF0B003B,0xFF170013,0xFF180012,0xFF190010,
+   0xFF19000F,0xFF1A000E,0xFF1A000C,0xFF1B000A,0xFF1B000B,0xFF1A000C,0xFF1A000B,
+   0xFF1B000A,0xFF19000C,0xFF1A000C,0xFF1A000C,0xFF19000D,0xFF1B000B,0xFF1C0009,
+   0xFF1C000B,0xFF1B000C,0xFF1A000C,0xFF19000E,0xFF19000D,0xFF1B000A,0xFF1C0008,
+   0xFF1C0008,0xFF1B0009,0xFF1C0007,0xFF1D0005,0xFF1D0005,0xFF1D0006,0xFF1C0008,
+   0xFF1D0008,0xFF1D0007,0xFF1D0006,0xFF200003,0xFF1B0018,0xFF00005F,0xFF10002D,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF2F0002,0xFF130035,0xFF01005C,0xFF150019,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,
+   0xFF190010,0xFF02005D,0xFF020086,0xFF050098,0xFF020078,0xFF100021,0xFF210000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF220000,0xFF240000,0xFF240000,0xFF220000,0xFF200000,0xFF1E0000,0xFF1D0000,
+   0xFF1C0000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF190001,0xFF190001,0xFF1A0000,0xFF1A0000,0xFF1E0000,0xFF1A001C,
+   0xFF01006F,0xFF0B0039,0xFF180004,0xFF180006,0xFF170007,0xFF170006,0xFF170005,
+   0xFF170005,0xFF180003,0xFF190000,0xFF180001,0xFF180002,0xFF1B0000,0xFF1E0000,
+   0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF230000,0xFF280000,0xFF20001C,0xFF010069,
+   0xFF030066,0xFF130023,0xFF210001,0xFF220000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,
+   0xFF1E0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,
+   0xFF190002,0xFF17000C,0xFF0B0045,0xFF0B0057,0xFF0E003F,0xFF050053,0xFF010078,
+   0xFF070058,0xFF170015,0xFF190010,0xFF1A000E,0xFF1A000D,0xFF1A000D,0xFF1B000B,
+   0xFF1D0007,0xFF1E0004,0xFF1E0004,0xFF1D0004,0xFF1D0004,0xFF1C0009,0xFF1C0009,
+   0xFF1C0009,0xFF1A000C,0xFF1C000A,0xFF1D0008,0xFF1D0008,0xFF1D0008,0xFF1C0009,
+   0xFF1A000B,0xFF1B000A,0xFF1B0009,0xFF1B0009,0xFF1B000A,0xFF1C0008,0xFF1D0005,
+   0xFF1E0003,0xFF1E0002,0xFF1F0002,0xFF1E0004,0xFF1E0005,0xFF1E0006,0xFF1E0006,
+   0xFF200002,0xFF150025,0xFF000067,0xFF0B0039,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF2A0000,
+   0xFF22001B,0xFF000060,0xFF03004D,0xFF140016,0xFF230001,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1C0005,0xFF0D0032,0xFF0C0051,0xFF0F003C,
+   0xFF050052,0xFF010075,0xFF0A0046,0xFF200002,0xFF220000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF220000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1B0000,0xFF190000,
+   0xFF190000,0xFF190000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF190001,0xFF190001,
+   0xFF1A0000,0xFF1A0000,0xFF1D0000,0xFF130029,0xFF010078,0xFF080049,0xFF180004,
+   0xFF180003,0xFF180003,0xFF180004,0xFF180003,0xFF180004,0xFF180003,0xFF1A0000,
+   0xFF1A0001,0xFF190001,0xFF1B0000,0xFF1F0000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF250000,0xFF260000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,
+   0xFF230000,0xFF240000,0xFF240010,0xFF04005F,0xFF030090,0xFF020062,0xFF10002D,
+   0xFF1E0008,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF16000E,0xFF0D0031,0xFF17001B,
+   0xFF1E0005,0xFF210002,0xFF23000D,0xFF110037,0xFF02006C,0xFF0D003D,0xFF19000F,
+   0xFF1B000B,0xFF1D0008,0xFF1C0009,0xFF1D0009,0xFF1D0006,0xFF1E0005,0xFF1E0005,
+   0xFF1E0005,0xFF1E0003,0xFF1D0006,0xFF1D0006,0xFF1D0006,0xFF1C000A,0xFF1D0008,
+   0xFF1E0004,0xFF1F0003,0xFF1E0005,0xFF1C0007,0xFF1B000A,0xFF1B000A,0xFF1C0008,
+   0xFF1C0009,0xFF1C0008,0xFF1D0005,0xFF1E0003,0xFF1F0001,0xFF200000,0xFF200000,
+   0xFF1F0002,0xFF1F0003,0xFF1E0005,0xFF1E0005,0xFF200005,0xFF0A0044,0xFF000075,
+   0xFF0B0038,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF270000,0xFF27000F,0xFF04005A,0xFF02007C,
+   0xFF020045,0xFF11001C,0xFF1F0004,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF1B0009,
+   0xFF0F0023,0xFF1A0015,0xFF220007,0xFF250003,0xFF25000D,0xFF120038,0xFF02006A,
+   0xFF13002B,0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF220000,0xFF210000,
+   0xFF200000,0xFF1E0000,0xFF1B0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF1A0000,
+   0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1B0000,0xFF1D0004,
+   0xFF09004A,0xFF020085,0xFF08004A,0xFF180004,0xFF190000,0xFF190001,0xFF190002,
+   0xFF190002,0xFF190002,0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1F0000,
+   0xFF210000,0xFF230000,0xFF240000,0xFF240000,0xFF250000,0xFF260000,0xFF270000,
+   0xFF260000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF200014,
+   0xFF030064,0xFF0800AB,0xFF06009C,0xFF020075,0xFF060051,0xFF10002D,0xFF190014,
+   0xFF1F0005,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF190006,
+   0xFF13001C,0xFF120028,0xFF1A000F,0xFF1A0002,0xFF180004,0xFF1A0002,0xFF210000,
+   0xFF2A0003,0xFF170031,0xFF02006A,0xFF0D0036,0xFF1B000C,0xFF1D0009,0xFF1C000A,
+   0xFF1C0009,0xFF1D0007,0xFF1D0007,0xFF1D0008,0xFF1D0007,0xFF1E0006,0xFF1D0007,
+   0xFF1E0006,0xFF1D0007,0xFF1D0008,0xFF1E0006,0xFF1F0002,0xFF1F0002,0xFF1E0004,
+   0xFF1D0008,0xFF1C0009,0xFF1C0008,0xFF1C0007,0xFF1C0008,0xFF1C0008,0xFF1D0006,
+   0xFF1E0003,0xFF1F0001,0xFF200000,0xFF200000,0xFF1F0002,0xFF1F0002,0xFF1F0003,
+   0xFF1F0002,0xFF190018,0xFF030062,0xFF020082,0xFF0A0036,0xFF210001,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF270000,0xFF220012,0xFF03005F,0xFF0700A4,0xFF040085,0xFF010057,0xFF070039,
+   0xFF11001F,0xFF1A000D,0xFF1F0003,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1D0005,0xFF160015,0xFF14001D,0xFF1C000D,0xFF1D0006,0xFF1C0008,
+   0xFF1E0004,0xFF240000,0xFF2B0003,0xFF170034,0xFF030063,0xFF120023,0xFF200001,
+   0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1C0000,
+   0xFF1A0000,0xFF190000,0xFF190000,0xFF190000,0xFF1A0000,0xFF1A0000,0xFF1B0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF170018,0xFF03006B,0xFF050093,0xFF070049,
+   0xFF170006,0xFF190003,0xFF190001,0xFF190002,0xFF190001,0xFF1A0000,0xFF1B0000,
+   0xFF1B0000,0xFF1C0000,0xFF1F0000,0xFF210000,0xFF230000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF240000,0xFF260000,0xFF150029,0xFF020079,0xFF0A00B4,0xFF0A00B0,
+   0xFF05009A,0xFF020087,0xFF01007A,0xFF02006B,0xFF060055,0xFF0F0036,0xFF190017,
+   0xFF1E0008,0xFF200004,0xFF200001,0xFF200001,0xFF1F0001,0xFF1C0004,0xFF19000A,
+   0xFF160011,0xFF13001D,0xFF0D0032,0xFF0D0037,0xFF17001D,0xFF1E0003,0xFF1B0000,
+   0xFF190001,0xFF190000,0xFF1B0000,0xFF1D0000,0xFF210000,0xFF2B0002,0xFF14003E,
+   0xFF01006D,0xFF10002A,0xFF1A000D,0xFF1B000B,0xFF1D0008,0xFF1E0004,0xFF1F0004,
+   0xFF1E0005,0xFF1E0005,0xFF1F0004,0xFF1F0003,0xFF1F0004,0xFF1E0005,0xFF1D0008,
+   0xFF1D0008,0xFF1E0006,0xFF1E0006,0xFF1C0009,0xFF1C000A,0xFF1C0008,0xFF1C0007,
+   0xFF1C0006,0xFF1C0007,0xFF1C0007,0xFF1D0005,0xFF1E0002,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF200001,0xFF1F0001,0xFF1F0001,0xFF1E0007,0xFF090046,0xFF01007E,
+   0xFF020087,0xFF050047,0xFF1C000A,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF280000,0xFF160027,0xFF020075,
+   0xFF0900B0,0xFF0800AA,0xFF03008F,0xFF01007B,0xFF01006F,0xFF02005D,0xFF060047,
+   0xFF0F002A,0xFF190010,0xFF1F0004,0xFF200002,0xFF210000,0xFF210000,0xFF210000,
+   0xFF1E0002,0xFF1B0006,0xFF19000A,0xFF150012,0xFF0E0029,0xFF0E002E,0xFF190017,
+   0xFF200005,0xFF1D0005,0xFF1C0007,0xFF1D0007,0xFF1E0004,0xFF1F0001,0xFF220001,
+   0xFF2A0002,0xFF140041,0xFF010060,0xFF160016,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF1D0000,0xFF1B0000,0xFF1A0000,0xFF190000,
+   0xFF190000,0xFF1A0000,0xFF1A0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1B0007,
+   0xFF08004A,0xFF030088,0xFF050098,0xFF03005B,0xFF140013,0xFF180003,0xFF190001,
+   0xFF1A0000,0xFF1B0000,0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF200000,
+   0xFF220000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF260000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250007,
+   0xFF080046,0xFF040090,0xFF05009A,0xFF010075,0xFF070052,0xFF160034,0xFF1F0029,
+   0xFF1C0033,0xFF130049,0xFF060064,0xFF02006A,0xFF04005F,0xFF060052,0xFF080049,
+   0xFF090047,0xFF080048,0xFF060051,0xFF03005A,0xFF020065,0xFF010072,0xFF080061,
+   0xFF1D000F,0xFF1E0000,0xFF1B0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF1A0000,
+   0xFF1C0000,0xFF1E0000,0xFF220000,0xFF280009,0xFF0A0058,0xFF06004E,0xFF1A000E,
+   0xFF1D0009,0xFF1E0004,0xFF200001,0xFF200001,0xFF1F0002,0xFF200002,0xFF200000,
+   0xFF210000,0xFF200000,0xFF1F0001,0xFF1D0007,0xFF1C000A,0xFF1D0008,0xFF1D0007,
+   0xFF1C0009,0xFF1B000C,0xFF19000E,0xFF1A000C,0xFF1B0009,0xFF1C0007,0xFF1D0006,
+   0xFF1E0004,0xFF1F0002,0xFF1F0001,0xFF1F0000,0xFF200000,0xFF200000,0xFF200001,
+   0xFF210001,0xFF110033,0xFF010065,0xFF080044,0xFF090047,0xFF010059,0xFF0D002E,
+   0xFF1A000F,0xFF200003,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF260006,0xFF080044,0xFF03008D,0xFF050096,0xFF01006E,0xFF07004B,
+   0xFF17002F,0xFF210026,0xFF1E0031,0xFF130045,0xFF07005C,0xFF02005D,0xFF04004F,
+   0xFF060043,0xFF09003B,0xFF09003C,0xFF09003F,0xFF060044,0xFF040048,0xFF030052,
+   0xFF010064,0xFF080060,0xFF1D0011,0xFF1F0004,0xFF1D0007,0xFF1C0007,0xFF1D0007,
+   0xFF1D0007,0xFF1D0007,0xFF1E0005,0xFF1E0004,0xFF210003,0xFF27000A,0xFF0A0056,
+   0xFF09003E,0xFF200001,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1D0000,0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF1A0000,
+   0xFF1B0000,0xFF1A0000,0xFF1B0000,0xFF0E0039,0xFF020079,0xFF07005E,0xFF080060,
+   0xFF010070,0xFF090040,0xFF120019,0xFF170006,0xFF1B0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF220000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF270000,0xFF1D001A,0xFF010060,0xFF000078,0xFF050053,
+   0xFF15002C,0xFF25000B,0xFF280000,0xFF270000,0xFF280000,0xFF2B0001,0xFF29000C,
+   0xFF200024,0xFF180034,0xFF15003B,0xFF100044,0xFF0E0048,0xFF0F0047,0xFF0D004D,
+   0xFF030062,0xFF02007E,0xFF040093,0xFF0D0044,0xFF1E0000,0xFF1C0000,0xFF1D0000,
+   0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF190000,0xFF1A0000,0xFF1D0000,0xFF1D0000,
+   0xFF230000,0xFF20001E,0xFF040060,0xFF14001D,0xFF1D0008,0xFF1F0003,0xFF200001,
+   0xFF1F0002,0xFF1E0004,0xFF1F0002,0xFF200000,0xFF210000,0xFF200000,0xFF200001,
+   0xFF1E0006,0xFF1D0008,0xFF1D0008,0xFF1D0008,0xFF1C000A,0xFF19000E,0xFF170012,
+   0xFF170011,0xFF19000E,0xFF1A000C,0xFF1B000A,0xFF1C0007,0xFF1E0003,0xFF1E0002,
+   0xFF1E0002,0xFF1F0003,0xFF1F0003,0xFF1F0004,0xFF160020,0xFF030066,0xFF0E002F,
+   0xFF260002,0xFF2A0008,0xFF0D0048,0xFF180020,0xFF21000D,0xFF1A0012,0xFF1C000A,
+   0xFF210002,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF260000,
+   0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF1D0019,0xFF01005D,
+   0xFF000073,0xFF05004E,0xFF160028,0xFF26000A,0xFF290000,0xFF280000,0xFF2A0000,
+   0xFF2D0001,0xFF2B000B,0xFF210023,0xFF180033,0xFF140039,0xFF100041,0xFF0E0046,
+   0xFF0F0046,0xFF0C004B,0xFF03005D,0xFF01007A,0xFF030092,0xFF0D004A,0xFF1D0004,
+   0xFF1D0007,0xFF1C0007,0xFF1C0007,0xFF1D0007,0xFF1D0007,0xFF1D0009,0xFF1D0009,
+   0xFF1D0009,0xFF1D0009,0xFF230002,0xFF1F001F,0xFF05005B,0xFF180014,0xFF220000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF1C0000,0xFF1A0000,0xFF190001,0xFF190001,0xFF190002,0xFF190001,
+   0xFF190001,0xFF190000,0xFF190001,0xFF190001,0xFF190002,0xFF180003,0xFF120023,
+   0xFF030075,0xFF0B0046,0xFF1F0008,0xFF24000D,0xFF0B005A,0xFF14002A,0xFF1B0013,
+   0xFF14001A,0xFF150010,0xFF1B0004,0xFF1D0000,0xFF1D0000,0xFF1F0000,0xFF200000,
+   0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260004,
+   0xFF0C0041,0xFF000063,0xFF0C003D,0xFF220010,0xFF270000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF220000,0xFF260000,0xFF290000,0xFF2B0000,
+   0xFF2B0000,0xFF290001,0xFF290000,0xFF2A0003,0xFF260012,0xFF170030,0xFF05005F,
+   0xFF04005C,0xFF180010,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1D0000,0xFF1C0000,
+   0xFF1B0000,0xFF190000,0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF270001,0xFF11003F,
+   0xFF040055,0xFF13001E,0xFF1D0008,0xFF1E0004,0xFF1E0006,0xFF1E0007,0xFF1E0005,
+   0xFF1F0002,0xFF200000,0xFF200000,0xFF200001,0xFF1E0006,0xFF1D0007,0xFF1D0007,
+   0xFF1D0007,0xFF1C000A,0xFF19000F,0xFF170012,0xFF170011,0xFF19000E,0xFF19000C,
+   0xFF19000D,0xFF19000C,0xFF1A000A,0xFF1B0008,0xFF1C0008,0xFF1D0008,0xFF190013,
+   0xFF0D0033,0xFF030067,0xFF030064,0xFF1A000B,0xFF210000,0xFF260000,0xFF1B0029,
+   0xFF0F002D,0xFF260000,0xFF270002,0xFF220009,0xFF1D000E,0xFF1C000C,0xFF210004,
+   0xFF240000,0xFF250000,0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260004,0xFF0C003F,0xFF000060,0xFF0D0039,0xFF23000F,0xFF280000,
+   0xFF240000,0xFF220000,0xFF220000,0xFF210000,0xFF220000,0xFF240000,0xFF280000,
+   0xFF290000,0xFF2A0000,0xFF2A0000,0xFF290001,0xFF270000,0xFF290002,0xFF260011,
+   0xFF17002E,0xFF05005E,0xFF040062,0xFF160019,0xFF1D0006,0xFF1C0007,0xFF1D0007,
+   0xFF1D0008,0xFF1D0009,0xFF1C000A,0xFF1C000B,0xFF1C000B,0xFF1D0009,0xFF1E0005,
+   0xFF270002,0xFF110040,0xFF050050,0xFF170013,0xFF200001,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1F0000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1D0000,0xFF1A0000,0xFF190000,
+   0xFF180001,0xFF180002,0xFF180003,0xFF170004,0xFF170005,0xFF170006,0xFF170006,
+   0xFF170006,0xFF140012,0xFF0A0037,0xFF03006D,0xFF030078,0xFF130019,0xFF180005,
+   0xFF1F0000,0xFF190036,0xFF0C003B,0xFF200000,0xFF210002,0xFF1D000E,0xFF160016,
+   0xFF160012,0xFF1B0006,0xFF1F0000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF240000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF270000,0xFF170025,0xFF02005C,0xFF130030,0xFF270006,
+   0xFF250000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF240000,0xFF2C0000,0xFF240016,0xFF080053,0xFF050050,0xFF1A000E,
+   0xFF210000,0xFF210000,0xFF1F0000,0xFF1E0000,0xFF1C0000,0xFF1A0000,0xFF190000,
+   0xFF1A0000,0xFF1B0000,0xFF200000,0xFF210013,0xFF030065,0xFF020062,0xFF0A003A,
+   0xFF14001E,0xFF19000E,0xFF1C0009,0xFF1D0006,0xFF1E0003,0xFF1F0001,0xFF200000,
+   0xFF200001,0xFF1D0006,0xFF1D0009,0xFF1D0008,0xFF1D0009,0xFF1B000B,0xFF19000E,
+   0xFF180010,0xFF18000F,0xFF19000D,0xFF19000B,0xFF19000B,0xFF19000C,0xFF19000C,
+   0xFF18000F,0xFF160017,0xFF0F0032,0xFF040057,0xFF010075,0xFF05009D,0xFF020064,
+   0xFF120013,0xFF1F0000,0xFF210000,0xFF200017,0xFF080044,0xFF1D0007,0xFF220000,
+   0xFF250000,0xFF280001,0xFF250007,0xFF1E000D,0xFF1C000B,0xFF200004,0xFF240001,
+   0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF270000,0xFF170025,0xFF02005B,
+   0xFF14002F,0xFF280005,0xFF260000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF230000,0xFF2B0000,0xFF240015,0xFF080054,
+   0xFF04005B,0xFF160018,0xFF1D0006,0xFF1D0007,0xFF1D0009,0xFF1C000A,0xFF1B000C,
+   0xFF1A000D,0xFF1B000B,0xFF1D0009,0xFF1E0006,0xFF220002,0xFF200015,0xFF020064,
+   0xFF02005A,0xFF0C002A,0xFF18000F,0xFF1E0002,0xFF1F0000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF1F0000,
+   0xFF1E0000,0xFF1B0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF190001,0xFF180003,0xFF15000A,0xFF120014,0xFF0C0032,0xFF03005B,0xFF02007D,
+   0xFF0800A4,0xFF03007B,0xFF0D0029,0xFF170006,0xFF1A0003,0xFF1C0020,0xFF070058,
+   0xFF18000A,0xFF1E0000,0xFF210000,0xFF220002,0xFF1F000A,0xFF190012,0xFF19000F,
+   0xFF1D0006,0xFF200001,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF250000,0xFF1A001C,
+   0xFF040055,0xFF15002C,0xFF260003,0xFF250000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF210000,
+   0xFF280000,0xFF28000E,0xFF0A0050,0xFF05004F,0xFF160017,0xFF210001,0xFF210000,
+   0xFF1F0000,0xFF1D0000,0xFF1B0000,0xFF190000,0xFF190001,0xFF190001,0xFF1C0000,
+   0xFF1D000F,0xFF04005E,0xFF06009C,0xFF03007D,0xFF020065,0xFF07004F,0xFF0E0038,
+   0xFF130025,0xFF160019,0xFF180013,0xFF1C0007,0xFF1F0001,0xFF1E0004,0xFF1D0006,
+   0xFF1D0007,0xFF1C0009,0xFF1A000C,0xFF18000F,0xFF170013,0xFF14001B,0xFF110026,
+   0xFF0F002D,0xFF0D0032,0xFF0C0037,0xFF090042,0xFF060052,0xFF020060,0xFF00006B,
+   0xFF010063,0xFF02005E,0xFF030068,0xFF010070,0xFF030055,0xFF150019,0xFF1F0000,
+   0xFF1E000E,0xFF030052,0xFF12001C,0xFF200000,0xFF200000,0xFF210000,0xFF250000,
+   0xFF280000,0xFF260003,0xFF220007,0xFF1F0009,0xFF210005,0xFF230004,0xFF260001,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF260000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF1A001C,0xFF040055,0xFF15002B,0xFF270002,0xFF250000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF200000,0xFF290000,0xFF29000E,0xFF0B0052,0xFF04005D,0xFF130024,
+   0xFF1C0008,0xFF1D0009,0xFF1B000B,0xFF19000E,0xFF190010,0xFF1A000E,0xFF1B000B,
+   0xFF1C0009,0xFF1E0005,0xFF1D0012,0xFF040060,0xFF050098,0xFF020075,0xFF030053,
+   0xFF09003D,0xFF110029,0xFF160019,0xFF19000F,0xFF1A000C,0xFF1C0005,0xFF1F0000,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1D0000,0xFF1A0000,0xFF180004,
+   0xFF15000D,0xFF110019,0xFF0F0021,0xFF0D0027,0xFF0C002D,0xFF09003C,0xFF050053,
+   0xFF020067,0xFF000073,0xFF01006F,0xFF02006E,0xFF040079,0xFF02007F,0xFF02006C,
+   0xFF0F0029,0xFF190005,0xFF1A0018,0xFF04006C,0xFF0F0023,0xFF1C0000,0xFF1D0000,
+   0xFF1D0000,0xFF1F0000,0xFF240000,0xFF230004,0xFF1D000A,0xFF1A000D,0xFF1B0009,
+   0xFF1D0006,0xFF210002,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF19001A,0xFF060054,0xFF17002B,0xFF260001,0xFF240000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF270000,0xFF230015,
+   0xFF020060,0xFF02005C,0xFF100027,0xFF1F0005,0xFF200000,0xFF1E0000,0xFF1C0000,
+   0xFF1B0000,0xFF190000,0xFF190001,0xFF18000A,0xFF090042,0xFF010075,0xFF03007D,
+   0xFF020079,0xFF02007B,0xFF030081,0xFF030088,0xFF040085,0xFF04007B,0xFF04006F,
+   0xFF07005B,0xFF0A0047,0xFF0A0044,0xFF0A0045,0xFF0A0044,0xFF0B003F,0xFF0A003D,
+   0xFF080043,0xFF05004F,0xFF020060,0xFF01006F,0xFF010076,0xFF02007C,0xFF01007C,
+   0xFF000073,0xFF030062,0xFF0B0045,0xFF160028,0xFF1F0017,0xFF220011,0xFF210013,
+   0xFF1F001C,0xFF130038,0xFF07004B,0xFF09003D,0xFF07003E,0xFF02006D,0xFF09003F,
+   0xFF1E0002,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF240000,0xFF270000,
+   0xFF280001,0xFF260004,0xFF22000D,0xFF18001B,0xFF1B0011,0xFF200009,0xFF220005,
+   0xFF250002,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF18001B,0xFF060054,0xFF17002B,
+   0xFF260001,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF210000,
+   0xFF280000,0xFF240015,0xFF030064,0xFF02006A,0xFF0D0034,0xFF1A000F,0xFF1C000A,
+   0xFF19000E,0xFF180011,0xFF19000F,0xFF1A000D,0xFF1B000B,0xFF1A0010,0xFF0A0046,
+   0xFF000073,0xFF020075,0xFF020070,0xFF020071,0xFF020076,0xFF03007D,0xFF04007B,
+   0xFF040071,0xFF040067,0xFF070054,0xFF0B0042,0xFF0B003B,0xFF0B0039,0xFF0B0039,
+   0xFF0C0034,0xFF0C0030,0xFF090037,0xFF060045,0xFF020058,0xFF020068,0xFF010071,
+   0xFF020078,0xFF02007D,0xFF000079,0xFF03006C,0xFF0A0050,0xFF130031,0xFF1A001D,
+   0xFF1C0017,0xFF1B001A,0xFF1A0023,0xFF110043,0xFF05005D,0xFF070052,0xFF060058,
+   0xFF030085,0xFF080048,0xFF1A0003,0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1D0000,
+   0xFF200000,0xFF220000,0xFF220002,0xFF1F0007,0xFF1B0012,0xFF140023,0xFF160018,
+   0xFF1B000D,0xFF1E0007,0xFF210003,0xFF230000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF0B003D,0xFF05005A,
+   0xFF1A0028,0xFF270000,0xFF240000,0xFF240000,0xFF250000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1D0000,
+   0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1D0000,0xFF1D0000,0xFF1F0000,0xFF270004,0xFF090044,0xFF020085,0xFF010067,
+   0xFF07003A,0xFF150018,0xFF1B0008,0xFF1A0007,0xFF18000A,0xFF140014,0xFF0E002C,
+   0xFF050057,0xFF09005B,0xFF140038,0xFF190024,0xFF190023,0xFF15002C,0xFF110036,
+   0xFF0E0040,0xFF0B004E,0xFF060062,0xFF040076,0xFF030088,0xFF02008A,0xFF03008C,
+   0xFF030089,0xFF030083,0xFF030081,0xFF030087,0xFF04008C,0xFF050095,0xFF0700A3,
+   0xFF0700A4,0xFF020086,0xFF030075,0xFF050075,0xFF0E0035,0xFF1E0012,0xFF240002,
+   0xFF240000,0xFF230000,0xFF220000,0xFF240000,0xFF260000,0xFF2B0001,0xFF27000D,
+   0xFF16002C,0xFF07004A,0xFF020070,0xFF020070,0xFF0B003B,0xFF160016,0xFF1D0004,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF240000,0xFF290000,
+   0xFF280006,0xFF1D0014,0xFF240009,0xFF220008,0xFF1E000D,0xFF120029,0xFF12002D,
+   0xFF140025,0xFF140026,0xFF140028,0xFF130028,0xFF130025,0xFF120025,0xFF110026,
+   0xFF0C003B,0xFF05005B,0xFF1A0028,0xFF270000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF290004,0xFF0A0041,
+   0xFF020087,0xFF010072,0xFF06004B,0xFF120026,0xFF170016,0xFF160017,0xFF14001B,
+   0xFF130022,0xFF0E0036,0xFF05005C,0xFF09005C,0xFF150033,0xFF1A001C,0xFF1B001A,
+   0xFF170020,0xFF120026,0xFF0E0031,0xFF0B0042,0xFF060058,0xFF040071,0xFF030087,
+   0xFF03008A,0xFF030088,0xFF030084,0xFF03007F,0xFF02007B,0xFF030081,0xFF040089,
+   0xFF050094,0xFF0800A3,0xFF0800A6,0xFF030089,0xFF030079,0xFF06007A,0xFF0D003B,
+   0xFF1A0015,0xFF1F0003,0xFF1E0000,0xFF1B0002,0xFF1A0003,0xFF1B0003,0xFF1D0002,
+   0xFF220002,0xFF200011,0xFF120039,0xFF06005C,0xFF03007E,0xFF02007A,0xFF090041,
+   0xFF130019,0xFF1A0005,0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,
+   0xFF1C0000,0xFF210000,0xFF220009,0xFF18001B,0xFF1F000D,0xFF1E000B,0xFF1B0010,
+   0xFF10002E,0xFF100031,0xFF130027,0xFF140028,0xFF130029,0xFF140027,0xFF140023,
+   0xFF130023,0xFF110024,0xFF010064,0xFF15002D,0xFF260001,0xFF240000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF220000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF1E0000,0xFF1C0000,0xFF1B0000,0xFF1B0000,0xFF1B0000,0xFF1B0000,
+   0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,
+   0xFF250002,0xFF0C003A,0xFF050092,0xFF0800A8,0xFF030082,0xFF02005F,0xFF040051,
+   0xFF040054,0xFF02005B,0xFF020067,0xFF03006B,0xFF0E0043,0xFF20000B,0xFF230000,
+   0xFF220000,0xFF230000,0xFF240000,0xFF260000,0xFF270002,0xFF280004,0xFF26000B,
+   0xFF220014,0xFF1C0029,0xFF12003E,0xFF0B0056,0xFF060080,0xFF0800A4,0xFF0B00B4,
+   0xFF0B00B6,0xFF0B00B6,0xFF0B00B6,0xFF0800A8,0xFF020078,0xFF070046,0xFF1A001B,
+   0xFF1D0014,0xFF220002,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF240000,0xFF2A0000,0xFF290008,0xFF1E001C,
+   0xFF10003A,0xFF070055,0xFF020059,0xFF060047,0xFF0E002C,0xFF180012,0xFF1F0004,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF250000,0xFF1F001B,0xFF120046,
+   0xFF180027,0xFF100040,0xFF030069,0xFF00006A,0xFF02005A,0xFF050052,0xFF0B004A,
+   0xFF0E0046,0xFF070053,0xFF000067,0xFF010072,0xFF010068,0xFF15002D,0xFF260001,
+   0xFF240000,0xFF240000,0xFF250000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF280001,0xFF0D0037,0xFF040090,0xFF0800AA,0xFF03008C,
+   0xFF020070,0xFF040063,0xFF030064,0xFF020068,0xFF01006D,0xFF03006A,0xFF100040,
+   0xFF22000A,0xFF260000,0xFF250000,0xFF270000,0xFF280000,0xFF290000,0xFF290001,
+   0xFF2A0002,0xFF270007,0xFF210010,0xFF1B0028,0xFF110040,0xFF0B0057,0xFF060080,
+   0xFF0800A3,0xFF0A00B3,0xFF0B00B4,0xFF0B00B5,0xFF0B00B6,0xFF0800AA,0xFF02007C,
+   0xFF07004A,0xFF18001E,0xFF1B0015,0xFF1E0003,0xFF1B0000,0xFF1B0000,0xFF1B0001,
+   0xFF180003,0xFF180005,0xFF170006,0xFF170008,0xFF170009,0xFF1B0005,0xFF210002,
+   0xFF22000A,0xFF1A0023,0xFF0E0042,0xFF06005B,0xFF02005E,0xFF05004A,0xFF0C002F,
+   0xFF140015,0xFF190005,0xFF1A0000,0xFF190000,0xFF180001,0xFF1A0000,0xFF1E0000,
+   0xFF1A0020,0xFF10004D,0xFF15002C,0xFF0F0045,0xFF030070,0xFF000070,0xFF02005D,
+   0xFF050055,0xFF0B004A,0xFF0F0044,0xFF080050,0xFF000065,0xFF000070,0xFF0E0030,
+   0xFF240004,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1D0000,
+   0xFF1B0000,0xFF1A0000,0xFF1A0001,0xFF190002,0xFF190002,0xFF190002,0xFF1A0000,
+   0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1C0020,0xFF08007A,0xFF0700A0,
+   0xFF0B00B5,0xFF0A00B2,0xFF05009A,0xFF010072,0xFF070054,0xFF160034,0xFF1B0027,
+   0xFF1C0015,0xFF1E0002,0xFF1B0000,0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF230000,0xFF270000,0xFF260000,
+   0xFF260003,0xFF190024,0xFF030063,0xFF06009A,0xFF0B00B5,0xFF0B00B6,0xFF0800A7,
+   0xFF010071,0xFF0B003A,0xFF1F000C,0xFF1F0001,0xFF1F0000,0xFF1E0000,0xFF1F0000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF220000,0xFF270000,0xFF2A0001,0xFF290008,0xFF230019,
+   0xFF160035,0xFF0D0049,0xFF050052,0xFF060048,0xFF0C0038,0xFF0F002A,0xFF0F0025,
+   0xFF0E0027,0xFF0C0030,0xFF090047,0xFF040082,0xFF010072,0xFF020057,0xFF0F003B,
+   0xFF1B0022,0xFF240012,0xFF28000A,0xFF2A0003,0xFF2D0001,0xFF2D000A,0xFF0D003F,
+   0xFF00006C,0xFF0C0038,0xFF240003,0xFF240000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1D0000,
+   0xFF1D0000,0xFF1E0000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF1E001E,
+   0xFF080077,0xFF06009F,0xFF0B00B6,0xFF0B00B4,0xFF06009C,0xFF010073,0xFF070056,
+   0xFF160037,0xFF1C0025,0xFF1F0011,0xFF220001,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF250000,0xFF250000,0xFF250003,0xFF190023,0xFF03005E,0xFF050097,0xFF0B00B4,
+   0xFF0B00B4,0xFF0800A7,0xFF010073,0xFF0A003E,0xFF1D000D,0xFF1D0003,0xFF1B0000,
+   0xFF180001,0xFF1A0000,0xFF1E0000,0xFF1E0000,0xFF1B0000,0xFF1A0000,0xFF180003,
+   0xFF170008,0xFF170009,0xFF170009,0xFF170007,0xFF1B0002,0xFF210000,0xFF250001,
+   0xFF260008,0xFF21001A,0xFF160037,0xFF0C004D,0xFF05005A,0xFF040052,0xFF080044,
+   0xFF0A0038,0xFF0A0035,0xFF0A0034,0xFF09003C,0xFF080053,0xFF05008C,0xFF02007B,
+   0xFF02005E,0xFF0E0040,0xFF1A0024,0xFF240013,0xFF28000A,0xFF2B0004,0xFF2E0001,
+   0xFF2E0009,0xFF0E003D,0xFF00006B,0xFF220009,0xFF250000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF260000,0xFF250000,0xFF240000,0xFF230000,0xFF220000,0xFF210000,
+   0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1C0000,0xFF1A0002,0xFF180004,0xFF180005,
+   0xFF180005,0xFF180005,0xFF190003,0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1C0002,
+   0xFF170013,0xFF130042,0xFF110065,0xFF060098,0xFF0B00B4,0xFF0700A2,0xFF010068,
+   0xFF0E0035,0xFF20000B,0xFF240000,0xFF1F0000,0xFF1C0000,0xFF1A0000,0xFF1A0000,
+   0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1B0000,
+   0xFF1A0000,0xFF1B0000,0xFF1A0000,0xFF1A0001,0xFF1B0002,0xFF230001,0xFF190024,
+   0xFF020065,0xFF0700A3,0xFF0A00B2,0xFF02007A,0xFF0B0039,0xFF210007,0xFF1E0002,
+   0xFF1D0001,0xFF1E0000,0xFF1E0000,0xFF200000,0xFF220000,0xFF230000,0xFF220000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF220000,0xFF250000,0xFF290000,0xFF2B0003,0xFF270012,
+   0xFF180032,0xFF050056,0xFF000064,0xFF01006D,0xFF020079,0xFF02007F,0xFF00006E,
+   0xFF050050,0xFF13002C,0xFF220011,0xFF290002,0xFF280000,0xFF260000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF2A0000,0xFF16002F,0xFF040055,0xFF1E000F,0xFF240000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1E0000,
+   0xFF1D0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1F0000,
+   0xFF200000,0xFF1F0002,0xFF1A0010,0xFF14003F,0xFF110064,0xFF060097,0xFF0B00B5,
+   0xFF0800A1,0xFF020063,0xFF0C0031,0xFF1F000A,0xFF240000,0xFF230000,0xFF210000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF1E0000,0xFF1C0000,0xFF1B0000,0xFF190000,0xFF190000,0xFF1B0000,
+   0xFF240000,0xFF19001F,0xFF020060,0xFF0700A2,0xFF0A00B0,0xFF02007A,0xFF0B003B,
+   0xFF1F0008,0xFF1C0004,0xFF1B0002,0xFF1A0000,0xFF180001,0xFF1B0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1C0000,0xFF1A0001,0xFF180005,0xFF170007,0xFF170007,
+   0xFF180005,0xFF190002,0xFF1A0000,0xFF1C0000,0xFF1F0000,0xFF230000,0xFF270000,
+   0xFF280003,0xFF230014,0xFF150039,0xFF040066,0xFF000079,0xFF020080,0xFF040088,
+   0xFF03008C,0xFF01007C,0xFF04005D,0xFF110034,0xFF1F0014,0xFF270002,0xFF270000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF2B0000,0xFF17002D,0xFF01005A,
+   0xFF250000,0xFF240000,0xFF240000,0xFF250000,0xFF260000,0xFF250000,0xFF240000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF1F0000,0xFF1D0000,
+   0xFF1A0001,0xFF180006,0xFF170007,0xFF170007,0xFF170007,0xFF170007,0xFF180005,
+   0xFF1A0001,0xFF1A0003,0xFF180007,0xFF1A0008,0xFF1D0009,0xFF250003,0xFF1F0018,
+   0xFF02006D,0xFF0900AE,0xFF02007B,0xFF0E0033,0xFF230004,0xFF210000,0xFF1E0000,
+   0xFF1C0000,0xFF1B0000,0xFF1B0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,
+   0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF1D0000,0xFF1B0000,0xFF190000,0xFF190000,
+   0xFF190001,0xFF180002,0xFF1B0001,0xFF250002,0xFF100035,0xFF02007F,0xFF06009F,
+   0xFF040051,0xFF1C000D,0xFF200001,0xFF1C0004,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF200000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF220000,0xFF250000,0xFF2C0000,0xFF28000D,0xFF110031,
+   0xFF01005E,0xFF030094,0xFF010070,0xFF0D0031,0xFF22000C,0xFF270000,0xFF250000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF240004,
+   0xFF0A0047,0xFF120031,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF200000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1E0002,0xFF1C0004,0xFF1D0006,0xFF200008,
+   0xFF270003,0xFF200018,0xFF02006C,0xFF0900AD,0xFF020076,0xFF0D002E,0xFF200003,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF200000,0xFF210000,0xFF210000,0xFF1F0000,0xFF1B0000,
+   0xFF180000,0xFF180000,0xFF180000,0xFF180000,0xFF1B0000,0xFF250001,0xFF10002F,
+   0xFF02007C,0xFF06009E,0xFF040053,0xFF1B000D,0xFF1E0001,0xFF1A0006,0xFF1C0000,
+   0xFF1A0000,0xFF1A0000,0xFF1D0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF1F0000,
+   0xFF1D0000,0xFF1A0001,0xFF190003,0xFF180004,0xFF190002,0xFF1A0000,0xFF1B0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF200000,0xFF250000,
+   0xFF210013,0xFF0E0043,0xFF020072,0xFF06009F,0xFF03007F,0xFF0A003F,0xFF1E0010,
+   0xFF230001,0xFF220000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF260003,0xFF0B0043,0xFF100036,0xFF240000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF260000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF1F0000,0xFF1D0000,0xFF1A0001,0xFF180005,0xFF170009,
+   0xFF16000A,0xFF170009,0xFF170009,0xFF180006,0xFF16000C,0xFF16000C,0xFF1A0003,
+   0xFF1D0000,0xFF1E0000,0xFF200000,0xFF1E0016,0xFF030069,0xFF0700A2,0xFF03005E,
+   0xFF190012,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1E0000,0xFF1F0000,
+   0xFF1D0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF190001,0xFF190002,0xFF190001,
+   0xFF1E0000,0xFF200012,0xFF03005E,0xFF03008A,0xFF070044,0xFF1E0004,0xFF1C0007,
+   0xFF1D0003,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF210000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF270000,0xFF2E0003,0xFF1A0020,0xFF02005B,0xFF03004F,
+   0xFF1F000A,0xFF230000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF1A001B,0xFF050053,0xFF1E000F,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF200000,0xFF1E0000,0xFF1D0000,
+   0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF1B0008,
+   0xFF1B0008,0xFF1E0002,0xFF200000,0xFF200000,0xFF220000,0xFF1F0016,0xFF030069,
+   0xFF0700A0,0xFF03005A,0xFF180010,0xFF1E0000,0xFF1D0000,0xFF1E0000,0xFF200000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,
+   0xFF210000,0xFF200000,0xFF1D0000,0xFF190000,0xFF170000,0xFF170000,0xFF180000,
+   0xFF170000,0xFF180000,0xFF1E0000,0xFF20000E,0xFF030059,0xFF03008A,0xFF070044,
+   0xFF1D0004,0xFF1A0008,0xFF1C0004,0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF200000,0xFF1E0000,0xFF1B0000,
+   0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1C0000,0xFF1D0000,0xFF1C0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1B0000,0xFF1A0000,0xFF1E0000,0xFF250005,0xFF16002D,
+   0xFF02006C,0xFF030060,0xFF1A000F,0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF260000,0xFF1B001A,0xFF05004F,
+   0xFF1E0010,0xFF240000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF1F0000,
+   0xFF1D0000,0xFF1B0000,0xFF190003,0xFF170008,0xFF16000B,0xFF16000B,0xFF16000C,
+   0xFF12001A,0xFF130018,0xFF190003,0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF1E0000,
+   0xFF200012,0xFF030064,0xFF06009C,0xFF030059,0xFF1A000C,0xFF1E0000,0xFF1E0000,
+   0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1B0000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF180001,0xFF170006,0xFF180004,0xFF1A0001,0xFF220005,0xFF090045,
+   0xFF00007A,0xFF050048,0xFF1A000B,0xFF1C0007,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF220000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF240000,0xFF2D0001,0xFF190029,0xFF050054,0xFF1E0009,0xFF210000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF250001,
+   0xFF0D003C,0xFF0D003F,0xFF230000,0xFF220000,0xFF230000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,
+   0xFF1D0000,0xFF1C0002,0xFF170012,0xFF170013,0xFF1E0002,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF210000,0xFF210012,0xFF030065,0xFF06009B,0xFF030057,0xFF17000B,
+   0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1B0000,0xFF180000,
+   0xFF160000,0xFF160000,0xFF170000,0xFF170000,0xFF170000,0xFF180000,0xFF1B0000,
+   0xFF230003,0xFF09003D,0xFF000079,0xFF050048,0xFF19000C,0xFF1B0008,0xFF1E0000,
+   0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1D0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,
+   0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,
+   0xFF1A0000,0xFF190000,0xFF1B0000,0xFF250002,0xFF150034,0xFF050061,0xFF19000B,
+   0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF260001,0xFF0E0038,0xFF0E003C,0xFF250000,0xFF240000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF200000,0xFF1E0000,0xFF1C0000,0xFF1B0000,0xFF1A0001,
+   0xFF180005,0xFF160009,0xFF16000B,0xFF0F0039,0xFF120025,0xFF180005,0xFF180004,
+   0xFF180003,0xFF190002,0xFF1A0000,0xFF1E0000,0xFF23000B,0xFF06005A,0xFF05009A,
+   0xFF020066,0xFF160015,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1C0000,0xFF1A0000,
+   0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF180001,0xFF170005,
+   0xFF180004,0xFF190002,0xFF210000,0xFF13002B,0xFF000071,0xFF02006C,0xFF120026,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF210000,0xFF230000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF240000,0xFF2C0003,
+   0xFF110042,0xFF150026,0xFF210000,0xFF200000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF230000,0xFF1E000F,0xFF040052,0xFF17001F,0xFF220000,
+   0xFF220000,0xFF220000,0xFF240000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF1F0000,0xFF1E0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1E0001,0xFF14002F,0xFF16001E,
+   0xFF1E0001,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF23000B,
+   0xFF06005C,0xFF06009A,0xFF020063,0xFF140013,0xFF1D0000,0xFF1E0000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF1F0000,0xFF1B0000,0xFF180000,0xFF170000,0xFF170000,0xFF170000,0xFF170000,
+   0xFF170000,0xFF170000,0xFF180000,0xFF190000,0xFF220000,0xFF130025,0xFF00006F,
+   0xFF02006B,0xFF120026,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1E0000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,
+   0xFF1C0000,0xFF250005,0xFF0F004C,0xFF11002B,0xFF1D0000,0xFF1E0000,0xFF1F0000,
+   0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF250000,0xFF20000E,0xFF04004E,
+   0xFF19001D,0xFF250000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF1E0000,
+   0xFF1D0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF190004,0xFF15000D,0xFF10003E,
+   0xFF10004F,0xFF16000A,0xFF160009,0xFF170008,0xFF170006,0xFF190002,0xFF1A0000,
+   0xFF1D0000,0xFF250005,0xFF09004E,0xFF05009A,0xFF020072,0xFF12001D,0xFF1D0000,
+   0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF190001,0xFF180001,0xFF190000,0xFF190000,
+   0xFF190000,0xFF180001,0xFF180002,0xFF180004,0xFF190002,0xFF190000,0xFF1E0000,
+   0xFF1B0017,0xFF020068,0xFF03007B,0xFF15001E,0xFF210000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF200000,0xFF230000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF260000,0xFF230000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF220000,0xFF240000,0xFF250000,
+   0xFF240000,0xFF230000,0xFF210000,0xFF260000,0xFF230019,0xFF070051,0xFF1A000F,
+   0xFF210000,0xFF200000,0xFF220000,0xFF230000,0xFF240000,0xFF230000,0xFF260000,
+   0xFF13002A,0xFF060052,0xFF200007,0xFF220000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1B0005,0xFF140035,0xFF120048,0xFF1D0002,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF230005,0xFF090052,0xFF06009A,0xFF02006C,
+   0xFF11001A,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF1C0000,0xFF190000,0xFF180000,
+   0xFF170000,0xFF170000,0xFF170000,0xFF170000,0xFF180000,0xFF170000,0xFF180000,
+   0xFF180000,0xFF1E0000,0xFF1B0015,0xFF020066,0xFF03007A,0xFF15001D,0xFF200000,
+   0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF1F0000,0xFF1B0000,
+   0xFF1B0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1B0000,0xFF1F0000,0xFF1F001C,
+   0xFF060058,0xFF170012,0xFF1F0000,0xFF200000,0xFF220000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF280000,0xFF140028,0xFF07004E,0xFF230007,0xFF250000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF1F0000,0xFF1E0000,0xFF1C0000,0xFF1B0000,0xFF190005,
+   0xFF150010,0xFF130018,0xFF170014,0xFF140038,0xFF140021,0xFF160009,0xFF16000B,
+   0xFF160008,0xFF180005,0xFF190002,0xFF1A0000,0xFF1C0000,0xFF230005,0xFF09004D,
+   0xFF06009D,0xFF020078,0xFF110022,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1A0000,
+   0xFF180002,0xFF180003,0xFF180001,0xFF180001,0xFF180001,0xFF180003,0xFF180003,
+   0xFF180003,0xFF190001,0xFF1B0000,0xFF1E0000,0xFF1F000F,0xFF020058,0xFF030051,
+   0xFF1A000C,0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF230000,
+   0xFF250000,0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF250000,0xFF230000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,
+   0xFF230000,0xFF290004,0xFF0B0051,0xFF06004C,0xFF1A000D,0xFF220000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF20000C,0xFF05004E,0xFF0B0046,0xFF230000,
+   0xFF230000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1D0000,0xFF1C0004,0xFF19000E,0xFF170013,0xFF1B000F,0xFF170032,0xFF19001A,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,
+   0xFF210005,0xFF080052,0xFF07009D,0xFF020072,0xFF11001D,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF1D0000,0xFF1A0000,0xFF180000,0xFF170000,0xFF170000,0xFF170000,0xFF170000,
+   0xFF170000,0xFF180000,0xFF170000,0xFF170000,0xFF180000,0xFF1C0000,0xFF1E0010,
+   0xFF02005A,0xFF030050,0xFF1A000C,0xFF200000,0xFF1E0000,0xFF1E0000,0xFF1D0000,
+   0xFF1E0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF210000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF220000,0xFF1E0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF1F0000,0xFF1E0000,0xFF250004,0xFF0A0056,0xFF060050,0xFF18000E,
+   0xFF220000,0xFF240000,0xFF250000,0xFF260000,0xFF270000,0xFF21000B,0xFF06004A,
+   0xFF0C0042,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF210000,0xFF1E0000,
+   0xFF1C0005,0xFF180017,0xFF130025,0xFF140021,0xFF170018,0xFF1B0007,0xFF1D0001,
+   0xFF14001C,0xFF16000B,0xFF16000A,0xFF16000B,0xFF160009,0xFF170007,0xFF180005,
+   0xFF190001,0xFF1B0000,0xFF200009,0xFF060057,0xFF0700A3,0xFF030080,0xFF0F002A,
+   0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,
+   0xFF1C0000,0xFF1B0000,0xFF190002,0xFF170004,0xFF170005,0xFF180003,0xFF180001,
+   0xFF180002,0xFF180001,0xFF180002,0xFF180001,0xFF190001,0xFF1B0000,0xFF1C0000,
+   0xFF200000,0xFF23000C,0xFF030052,0xFF080042,0xFF1E0003,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1F0000,0xFF200000,0xFF230000,0xFF250000,0xFF270000,0xFF280000,
+   0xFF280000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF240000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF230000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF2A0000,0xFF150031,
+   0xFF000072,0xFF050046,0xFF15001A,0xFF1F0007,0xFF230001,0xFF220003,0xFF190015,
+   0xFF07003F,0xFF010070,0xFF0B003A,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF200000,0xFF1E0000,0xFF1D0005,0xFF190016,0xFF140024,0xFF16001E,0xFF1A0015,
+   0xFF1D0006,0xFF200001,0xFF180017,0xFF1C0004,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF200009,0xFF06005A,0xFF0800A4,
+   0xFF030079,0xFF0F0024,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1E0000,0xFF1B0000,0xFF180000,0xFF180000,
+   0xFF170000,0xFF170000,0xFF160000,0xFF170000,0xFF180000,0xFF180000,0xFF180000,
+   0xFF180000,0xFF190000,0xFF1D0000,0xFF20000C,0xFF030054,0xFF080041,0xFF1F0003,
+   0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF220000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF210000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF210000,
+   0xFF270000,0xFF140034,0xFF000076,0xFF050048,0xFF15001A,0xFF200006,0xFF240001,
+   0xFF240002,0xFF1A0013,0xFF08003B,0xFF00006B,0xFF0C0036,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,0xFF230001,
+   0xFF210006,0xFF1C0010,0xFF17001B,0xFF140023,0xFF14002E,0xFF140055,0xFF0E0060,
+   0xFF180017,0xFF1C0003,0xFF1C0000,0xFF1C0002,0xFF150010,0xFF170005,0xFF160009,
+   0xFF16000A,0xFF160008,0xFF170005,0xFF180003,0xFF180001,0xFF1A0000,0xFF1C0013,
+   0xFF030067,0xFF0A00AD,0xFF04008C,0xFF0C0036,0xFF1D0000,0xFF1E0000,0xFF1E0000,
+   0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1C0000,0xFF190001,0xFF170005,
+   0xFF160006,0xFF160007,0xFF170005,0xFF180001,0xFF180002,0xFF180001,0xFF180001,
+   0xFF190000,0xFF1A0000,0xFF1C0000,0xFF1D0000,0xFF200000,0xFF23000B,0xFF040053,
+   0xFF12002C,0xFF220000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF220000,
+   0xFF250000,0xFF270000,0xFF280000,0xFF280000,0xFF280000,0xFF270000,0xFF270000,
+   0xFF280000,0xFF280000,0xFF260000,0xFF230000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF230000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF290000,0xFF220016,0xFF020065,0xFF030086,0xFF010060,
+   0xFF050048,0xFF090043,0xFF07004F,0xFF020063,0xFF02007C,0xFF03008C,0xFF07003D,
+   0xFF200004,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF210001,0xFF200006,0xFF1B0010,0xFF17001B,0xFF140023,0xFF15002D,
+   0xFF150053,0xFF0E005E,0xFF190016,0xFF1E0003,0xFF1D0000,0xFF1D0002,0xFF18000D,
+   0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF1B0000,
+   0xFF1C0000,0xFF1C0012,0xFF030068,0xFF0A00AD,0xFF040085,0xFF0C002E,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1B0000,0xFF180000,0xFF180000,0xFF180000,0xFF170000,0xFF170000,0xFF170000,
+   0xFF170000,0xFF170000,0xFF180000,0xFF190000,0xFF1A0000,0xFF1B0000,0xFF1E0000,
+   0xFF21000A,0xFF040053,0xFF12002B,0xFF230000,0xFF220000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF210000,0xFF240000,0xFF250000,0xFF260000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF260000,0xFF260000,0xFF240000,0xFF200000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF210000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF260000,0xFF200019,0xFF020069,
+   0xFF030086,0xFF01005E,0xFF050045,0xFF0A0042,0xFF080052,0xFF020064,0xFF01007C,
+   0xFF030089,0xFF080038,0xFF240003,0xFF260000,0xFF260000,0xFF260000,0xFF250003,
+   0xFF20000D,0xFF1C0018,0xFF19001F,0xFF180022,0xFF180026,0xFF1A001F,0xFF1C0015,
+   0xFF1E000C,0xFF210004,0xFF240002,0xFF200012,0xFF18001F,0xFF130026,0xFF130020,
+   0xFF120024,0xFF17000E,0xFF190000,0xFF170004,0xFF160006,0xFF170005,0xFF180002,
+   0xFF180001,0xFF180001,0xFF1B0000,0xFF160024,0xFF02007A,0xFF0B00B1,0xFF06009C,
+   0xFF070050,0xFF1B0005,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1B0000,0xFF170004,0xFF170005,0xFF170006,0xFF160006,0xFF170005,
+   0xFF180002,0xFF180002,0xFF190001,0xFF190000,0xFF1A0000,0xFF190000,0xFF1A0000,
+   0xFF1C0000,0xFF210000,0xFF1C0016,0xFF020059,0xFF1A0017,0xFF220000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF220000,0xFF250000,0xFF270000,0xFF270000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF250000,0xFF220000,0xFF210000,0xFF220000,0xFF240000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF260000,
+   0xFF2A000A,0xFF06004D,0xFF0700A0,0xFF0800A8,0xFF020080,0xFF020066,0xFF0B004E,
+   0xFF100043,0xFF050053,0xFF010076,0xFF03005E,0xFF190012,0xFF230000,0xFF220000,
+   0xFF220000,0xFF200004,0xFF1C000F,0xFF18001B,0xFF160022,0xFF160026,0xFF170027,
+   0xFF190020,0xFF1C0015,0xFF1E000C,0xFF210003,0xFF250002,0xFF200012,0xFF18001E,
+   0xFF140024,0xFF14001F,0xFF130023,0xFF18000D,0xFF1C0000,0xFF1B0000,0xFF1B0000,
+   0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1E0000,0xFF170024,0xFF02007B,
+   0xFF0B00B2,0xFF060097,0xFF070045,0xFF1D0003,0xFF1F0000,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1C0000,0xFF190000,0xFF180000,0xFF180000,
+   0xFF180000,0xFF170000,0xFF170000,0xFF170000,0xFF170000,0xFF180000,0xFF190000,
+   0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1F0000,0xFF1A0014,0xFF020057,0xFF1B0017,
+   0xFF240000,0xFF230000,0xFF220000,0xFF210000,0xFF230000,0xFF250000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF260000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF230000,0xFF200000,0xFF200000,0xFF210000,0xFF240000,
+   0xFF250000,0xFF240000,0xFF230000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF240000,0xFF29000A,0xFF060051,0xFF0700A0,0xFF0700A6,0xFF010083,
+   0xFF02006E,0xFF0B0055,0xFF0F0049,0xFF05005A,0xFF010079,0xFF030058,0xFF1C000F,
+   0xFF270000,0xFF240005,0xFF1D0018,0xFF1B0022,0xFF1F001C,0xFF240012,0xFF27000B,
+   0xFF270006,0xFF250002,0xFF230000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1D0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0003,0xFF1D000C,0xFF13002A,0xFF1B0008,0xFF1A0000,
+   0xFF180002,0xFF170004,0xFF180002,0xFF190000,0xFF190000,0xFF190001,0xFF1E0000,
+   0xFF0F003B,0xFF020085,0xFF03007E,0xFF05006B,0xFF040075,0xFF130020,0xFF1C0000,
+   0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1B0000,0xFF190002,0xFF170004,
+   0xFF170004,0xFF180003,0xFF180002,0xFF180002,0xFF180001,0xFF190001,0xFF1A0000,
+   0xFF190000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1C0000,0xFF220000,0xFF160026,
+   0xFF030059,0xFF1D000C,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF230000,
+   0xFF250000,0xFF270000,0xFF270000,0xFF270000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF270000,0xFF240000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF2C0002,0xFF0D003B,0xFF040091,
+   0xFF04008D,0xFF040050,0xFF1C001C,0xFF2B0003,0xFF2E0001,0xFF2A000C,0xFF140036,
+   0xFF02006F,0xFF0D0030,0xFF220001,0xFF210004,0xFF19001B,0xFF160027,0xFF1B0020,
+   0xFF1F0014,0xFF21000C,0xFF220007,0xFF210002,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF200003,0xFF1F000C,0xFF140029,
+   0xFF1A0008,0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF1B0000,0xFF1A0000,
+   0xFF1A0000,0xFF1F0000,0xFF0F003B,0xFF030086,0xFF030080,0xFF050068,0xFF040069,
+   0xFF150019,0xFF1F0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1E0000,0xFF1B0000,
+   0xFF180000,0xFF180000,0xFF180000,0xFF180000,0xFF180000,0xFF180000,0xFF180000,
+   0xFF180000,0xFF180000,0xFF190000,0xFF1A0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,
+   0xFF200000,0xFF140022,0xFF030059,0xFF1D000C,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF240000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,
+   0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF250000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF2B0002,
+   0xFF0D003E,0xFF040091,0xFF030090,0xFF04005A,0xFF1B0021,0xFF2A0004,0xFF2D0001,
+   0xFF2A000E,0xFF14003A,0xFF02006E,0xFF0F002A,0xFF260001,0xFF190024,0xFF210016,
+   0xFF2A0004,0xFF2C0000,0xFF2A0000,0xFF290000,0xFF280000,0xFF250000,0xFF230000,
+   0xFF220000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0005,0xFF1A000A,0xFF1D0000,0xFF1A0000,0xFF180002,0xFF180002,0xFF190000,
+   0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1F0006,0xFF080056,0xFF04006D,0xFF160027,
+   0xFF25000D,0xFF1A003D,0xFF09004F,0xFF180005,0xFF1A0000,0xFF1A0001,0xFF1A0001,
+   0xFF190002,0xFF190001,0xFF190001,0xFF180001,0xFF180002,0xFF180002,0xFF190001,
+   0xFF190000,0xFF190000,0xFF1A0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF1A0000,0xFF1C0000,0xFF230000,0xFF120032,0xFF030057,0xFF1D0009,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF250000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF2B0000,0xFF130033,0xFF000078,0xFF040055,0xFF1C0019,0xFF270000,
+   0xFF240000,0xFF240000,0xFF280000,0xFF2F0002,0xFF150046,0xFF01005C,0xFF140020,
+   0xFF170025,0xFF1D0019,0xFF250005,0xFF260000,0xFF250000,0xFF230000,0xFF220000,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1E0000,0xFF1E0005,0xFF1A000A,0xFF1D0000,0xFF1C0000,0xFF1B0000,
+   0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1B0000,0xFF1C0000,0xFF1F0006,0xFF080056,
+   0xFF040070,0xFF15002B,0xFF25000C,0xFF1B0037,0xFF0A0041,0xFF1C0003,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1A0000,0xFF180000,0xFF170000,0xFF180000,0xFF180000,
+   0xFF180000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF210000,0xFF11002D,0xFF030057,
+   0xFF1D000A,0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF230000,0xFF260000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF2A0000,0xFF120035,0xFF000079,0xFF03005D,
+   0xFF1B001D,0xFF260000,0xFF230000,0xFF230000,0xFF280000,0xFF2F0003,0xFF150048,
+   0xFF020055,0xFF16001B,0xFF250008,0xFF280000,0xFF280000,0xFF290000,0xFF290000,
+   0xFF290000,0xFF290000,0xFF280000,0xFF280000,0xFF270000,0xFF240000,0xFF220000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF19000D,0xFF1C0005,0xFF1C0000,
+   0xFF190000,0xFF190000,0xFF190000,0xFF1A0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,
+   0xFF1D0011,0xFF050064,0xFF15002C,0xFF210000,0xFF210000,0xFF270004,0xFF130044,
+   0xFF0F002B,0xFF1A0000,0xFF190002,0xFF180005,0xFF170007,0xFF180004,0xFF190000,
+   0xFF190000,0xFF180001,0xFF180001,0xFF190001,0xFF190000,0xFF190000,0xFF190001,
+   0xFF190001,0xFF190001,0xFF180001,0xFF180003,0xFF190001,0xFF1A0000,0xFF220000,
+   0xFF10003A,0xFF030057,0xFF1D0009,0xFF220000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF270000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF250000,0xFF2A0000,0xFF130034,
+   0xFF00006A,0xFF150029,0xFF260000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF270000,0xFF230019,0xFF020069,0xFF060067,0xFF1E0013,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF19000E,
+   0xFF1C0005,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1E0000,0xFF1D0011,0xFF050067,0xFF140030,0xFF210000,0xFF200000,
+   0xFF290003,0xFF140038,0xFF120020,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF190000,
+   0xFF170000,0xFF170000,0xFF170000,0xFF170000,0xFF180000,0xFF180000,0xFF180000,
+   0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF1A0000,0xFF1A0000,0xFF190000,
+   0xFF190000,0xFF200000,0xFF0F0036,0xFF030059,0xFF1D0009,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF250000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF280000,0xFF120035,0xFF00006C,0xFF13002E,0xFF250000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF270000,0xFF24001A,0xFF020067,0xFF03006A,0xFF16001C,
+   0xFF250002,0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,
+   0xFF280000,0xFF280000,0xFF270000,0xFF250000,0xFF230000,0xFF230000,0xFF250000,
+   0xFF200009,0xFF190013,0xFF1F0001,0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,
+   0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF14002F,0xFF0D004C,0xFF200004,
+   0xFF1F0000,0xFF1E0000,0xFF200000,0xFF230014,0xFF0C0045,0xFF16000B,0xFF1A0001,
+   0xFF180005,0xFF160008,0xFF170006,0xFF180002,0xFF190000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF190000,0xFF190000,0xFF180003,0xFF170004,0xFF170004,0xFF180002,
+   0xFF180002,0xFF190001,0xFF1B0000,0xFF220000,0xFF0D003F,0xFF03005C,0xFF1D0009,
+   0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF280000,0xFF290000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF240000,0xFF290000,0xFF120039,0xFF020062,0xFF1E0010,0xFF240000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF230000,0xFF2B0004,0xFF0E0045,
+   0xFF010079,0xFF11002A,0xFF210003,0xFF240000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF1F0009,0xFF180014,0xFF1E0001,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1F0000,0xFF140030,
+   0xFF0C0051,0xFF1E0005,0xFF1D0000,0xFF1C0000,0xFF200000,0xFF250011,0xFF0D0038,
+   0xFF1A0007,0xFF1D0000,0xFF1B0000,0xFF190000,0xFF180000,0xFF180000,0xFF180000,
+   0xFF170000,0xFF170000,0xFF180000,0xFF180000,0xFF180000,0xFF190000,0xFF190000,
+   0xFF1A0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF190000,0xFF1F0000,0xFF0C003B,
+   0xFF03005E,0xFF1C000A,0xFF210000,0xFF210000,0xFF220000,0xFF250000,0xFF280000,
+   0xFF290000,0xFF280000,0xFF270000,0xFF260000,0xFF270000,0xFF270000,0xFF260000,
+   0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF230000,0xFF280000,0xFF12003A,0xFF020064,
+   0xFF1C0012,0xFF230000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF2B0005,0xFF0E0048,0xFF000080,0xFF010061,0xFF0C0037,0xFF1D0010,0xFF280001,
+   0xFF2A0000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF280000,
+   0xFF270000,0xFF260000,0xFF260000,0xFF21000C,0xFF1A001B,0xFF240005,0xFF230000,
+   0xFF1F0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF200000,
+   0xFF1F000A,0xFF0A0051,0xFF1A001D,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF230000,0xFF1B0024,0xFF0F0028,0xFF1A0001,0xFF190004,0xFF170006,0xFF170005,
+   0xFF180002,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF1B0000,0xFF1A0000,
+   0xFF1A0001,0xFF1A0001,0xFF1B0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1C0000,
+   0xFF220001,0xFF0C0042,0xFF030067,0xFF1C000C,0xFF220000,0xFF220000,0xFF240000,
+   0xFF280000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF270000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF290000,
+   0xFF10003F,0xFF060057,0xFF220005,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF270000,0xFF29000E,0xFF0D004C,0xFF01006B,0xFF0A0040,
+   0xFF190014,0xFF230001,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF20000D,0xFF19001C,
+   0xFF220005,0xFF220000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,
+   0xFF1D0000,0xFF1E0000,0xFF1D000A,0xFF0A0054,0xFF19001F,0xFF1D0000,0xFF1C0000,
+   0xFF1B0000,0xFF1C0000,0xFF230000,0xFF1B001E,0xFF11001F,0xFF1C0000,0xFF1B0000,
+   0xFF1A0000,0xFF190000,0xFF190000,0xFF190000,0xFF180000,0xFF190000,0xFF190000,
+   0xFF180000,0xFF180000,0xFF190000,0xFF1B0000,0xFF1D0000,0xFF1D0000,0xFF1B0000,
+   0xFF1A0000,0xFF190000,0xFF1F0000,0xFF0B003F,0xFF030069,0xFF1B000D,0xFF220000,
+   0xFF210000,0xFF230000,0xFF270000,0xFF290000,0xFF290000,0xFF290000,0xFF280000,
+   0xFF270000,0xFF270000,0xFF280000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF250000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF280000,0xFF100040,0xFF05005B,0xFF200007,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF280000,0xFF290010,0xFF0F0049,
+   0xFF100046,0xFF01006B,0xFF020058,0xFF0F002D,0xFF1E000F,0xFF270002,0xFF290000,
+   0xFF2A0000,0xFF290000,0xFF290000,0xFF280000,0xFF280000,0xFF270001,0xFF1F0014,
+   0xFF1C001E,0xFF260006,0xFF260000,0xFF240000,0xFF230000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF210000,0xFF120030,0xFF0E0049,0xFF200001,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF22000E,0xFF0C0047,
+   0xFF180009,0xFF1A0001,0xFF180003,0xFF180003,0xFF180002,0xFF190000,0xFF1A0000,
+   0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,
+   0xFF200000,0xFF1F0000,0xFF1C0000,0xFF1D0000,0xFF1D000F,0xFF07006B,0xFF040081,
+   0xFF180018,0xFF230000,0xFF240000,0xFF270000,0xFF290000,0xFF2A0000,0xFF290000,
+   0xFF290000,0xFF290000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF290000,0xFF280000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF230000,0xFF280003,0xFF0B004D,0xFF09004C,0xFF230002,
+   0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF280000,0xFF2D0008,0xFF13003F,0xFF00006F,0xFF020061,0xFF0D0034,0xFF1A0013,
+   0xFF220002,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF250000,0xFF260000,
+   0xFF260001,0xFF1F0014,0xFF1B001F,0xFF250006,0xFF260000,0xFF250000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF200000,0xFF1E0000,0xFF1E0000,0xFF200000,0xFF110031,
+   0xFF0D004C,0xFF1E0002,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,
+   0xFF21000D,0xFF0C0040,0xFF180007,0xFF1C0000,0xFF1A0000,0xFF190000,0xFF1A0000,
+   0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1B0000,0xFF190000,0xFF1A0000,0xFF1B0000,
+   0xFF1E0000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1C0000,0xFF1A0000,0xFF1A000E,
+   0xFF07006A,0xFF040083,0xFF170018,0xFF220000,0xFF230000,0xFF260000,0xFF280000,
+   0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF280000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF280000,0xFF270000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF280003,0xFF0B004D,
+   0xFF090051,0xFF220003,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF290000,0xFF2F0006,0xFF300006,0xFF220024,0xFF0E0051,
+   0xFF02006A,0xFF02005D,0xFF0B0038,0xFF15001E,0xFF1F000E,0xFF250005,0xFF280001,
+   0xFF280000,0xFF240009,0xFF1B0024,0xFF1F001C,0xFF280003,0xFF270000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF240000,0xFF240000,0xFF220000,0xFF1A000D,
+   0xFF0F002F,0xFF040069,0xFF0C0046,0xFF1F0000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF230002,0xFF100059,0xFF0F002E,0xFF1C0000,0xFF1A0000,
+   0xFF190001,0xFF180002,0xFF190001,0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,
+   0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF210000,0xFF220000,0xFF220000,0xFF1F0000,
+   0xFF1D0006,0xFF15003A,0xFF1A0046,0xFF040066,0xFF0F0038,0xFF240000,0xFF270000,
+   0xFF290000,0xFF290000,0xFF2A0000,0xFF2A0000,0xFF2A0000,0xFF2A0000,0xFF290000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF290000,0xFF290000,0xFF280000,0xFF270000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF200012,0xFF030061,0xFF0D0040,0xFF250000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF260000,0xFF2E0005,
+   0xFF210022,0xFF0F004E,0xFF02006A,0xFF020062,0xFF090040,0xFF120024,0xFF1B0012,
+   0xFF200006,0xFF240001,0xFF260000,0xFF230009,0xFF1A0024,0xFF1F001C,0xFF270003,
+   0xFF270000,0xFF270000,0xFF260000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF220000,0xFF1B000C,0xFF0F002F,0xFF04006C,0xFF0C004C,0xFF1C0000,0xFF1D0000,
+   0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF210003,0xFF0F0059,0xFF0F002B,
+   0xFF1D0000,0xFF1B0000,0xFF190000,0xFF190000,0xFF1B0000,0xFF1D0000,0xFF1E0000,
+   0xFF1D0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF220000,
+   0xFF210000,0xFF1F0000,0xFF1C0005,0xFF140036,0xFF190046,0xFF03006A,0xFF0E003C,
+   0xFF220000,0xFF260000,0xFF270000,0xFF280000,0xFF290000,0xFF290000,0xFF290000,
+   0xFF290000,0xFF280000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF280000,0xFF280000,0xFF280000,0xFF270000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF260000,0xFF210011,0xFF03005F,0xFF0C0043,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF260000,0xFF260000,0xFF2D0000,0xFF310004,0xFF27001B,0xFF0D0050,0xFF000074,
+   0xFF01006A,0xFF020051,0xFF07003D,0xFF0D002F,0xFF10002D,0xFF0C005E,0xFF150031,
+   0xFF20000F,0xFF20000C,0xFF20000C,0xFF1E000E,0xFF1E000E,0xFF1E000E,0xFF1C0011,
+   0xFF190019,0xFF13002D,0xFF0C0046,0xFF040065,0xFF000078,0xFF030086,0xFF030077,
+   0xFF0B004C,0xFF110031,0xFF160019,0xFF1B0007,0xFF1E0000,0xFF1F0000,0xFF1F0007,
+   0xFF0B0062,0xFF06005C,0xFF1B0007,0xFF1D0000,0xFF1B0000,0xFF190001,0xFF1A0000,
+   0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF210003,0xFF170022,0xFF220013,0xFF310001,
+   0xFF12003D,0xFF050058,0xFF230007,0xFF290000,0xFF290000,0xFF290000,0xFF2A0000,
+   0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF290000,0xFF290000,0xFF290000,
+   0xFF280000,0xFF260000,0xFF250000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF240000,0xFF260000,0xFF13002E,0xFF000070,0xFF0E0039,
+   0xFF250000,0xFF240000,0xFF240000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF1F0000,0xFF200000,0xFF240000,0xFF2D0000,0xFF320003,0xFF280019,
+   0xFF0D004C,0xFF000075,0xFF020074,0xFF02005D,0xFF060048,0xFF0B0036,0xFF0F0031,
+   0xFF0B0061,0xFF150033,0xFF1F0010,0xFF1F000D,0xFF1F000D,0xFF20000D,0xFF1F000D,
+   0xFF1E000E,0xFF1D0010,0xFF1A0019,0xFF13002D,0xFF0D0045,0xFF040062,0xFF000077,
+   0xFF030088,0xFF04007D,0xFF0A0053,0xFF0F0039,0xFF130020,0xFF18000A,0xFF1B0001,
+   0xFF1B0000,0xFF1B0009,0xFF0A0067,0xFF060059,0xFF190007,0xFF1B0000,0xFF190000,
+   0xFF180000,0xFF190000,0xFF1C0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,
+   0xFF1E0000,0xFF1F0000,0xFF210000,0xFF220000,0xFF220000,0xFF200003,0xFF16001F,
+   0xFF200011,0xFF2E0002,0xFF120041,0xFF05005B,0xFF220007,0xFF280000,0xFF290000,
+   0xFF290000,0xFF290000,0xFF290000,0xFF280000,0xFF280000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF290000,0xFF270000,0xFF260000,0xFF250000,0xFF260000,
+   0xFF270000,0xFF280000,0xFF280000,0xFF270000,0xFF260000,0xFF280000,0xFF14002A,
+   0xFF00006A,0xFF0E0039,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF230000,
+   0xFF260000,0xFF2E0000,0xFF2E000D,0xFF080054,0xFF05009A,0xFF0700A3,0xFF040092,
+   0xFF02007B,0xFF000073,0xFF020080,0xFF010060,0xFF040057,0xFF050054,0xFF050056,
+   0xFF050059,0xFF06005D,0xFF07005C,0xFF08005D,0xFF0A005F,0xFF0D005B,0xFF0C0058,
+   0xFF0A0052,0xFF0D0046,0xFF0F003D,0xFF0C0046,0xFF070055,0xFF040065,0xFF02006D,
+   0xFF050062,0xFF0B004C,0xFF0D003E,0xFF07004A,0xFF02007B,0xFF020077,0xFF0E002E,
+   0xFF1D0001,0xFF1C0000,0xFF190001,0xFF1A0001,0xFF1B0000,0xFF1D0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF1C0018,0xFF1C001A,0xFF250000,0xFF2A0000,0xFF270015,0xFF030061,0xFF160024,
+   0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF290000,0xFF290000,0xFF290000,0xFF280000,0xFF280000,0xFF270000,
+   0xFF260000,0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF260000,
+   0xFF20000F,0xFF05005B,0xFF00007F,0xFF0E0037,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF230000,0xFF270000,0xFF2E0000,0xFF2D000B,0xFF080051,0xFF06009C,
+   0xFF0900AA,0xFF060098,0xFF020081,0xFF010078,0xFF020086,0xFF010065,0xFF04005D,
+   0xFF05005A,0xFF050058,0xFF050056,0xFF060057,0xFF070059,0xFF08005B,0xFF0A005E,
+   0xFF0D005A,0xFF0C0056,0xFF0B004F,0xFF0D0044,0xFF0F003E,0xFF0C004A,0xFF07005B,
+   0xFF04006D,0xFF020076,0xFF05006A,0xFF0A0052,0xFF0B0045,0xFF060054,0xFF030083,
+   0xFF020077,0xFF0C002B,0xFF1A0000,0xFF1A0000,0xFF180000,0xFF190000,0xFF1B0000,
+   0xFF1E0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF1B0015,0xFF1A0018,0xFF230000,0xFF270000,0xFF250016,
+   0xFF030064,0xFF150026,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF290000,0xFF280000,0xFF270000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF22000E,0xFF050055,0xFF000079,0xFF0D0035,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF230000,0xFF250000,0xFF2F0000,
+   0xFF150035,0xFF03008B,0xFF0800AC,0xFF030085,0xFF030058,0xFF100039,0xFF1D0026,
+   0xFF22001E,0xFF290016,0xFF2A0013,0xFF280014,0xFF270014,0xFF270014,0xFF280012,
+   0xFF2A000E,0xFF2B000A,0xFF2C0004,0xFF2B0003,0xFF270003,0xFF250002,0xFF270001,
+   0xFF280003,0xFF280008,0xFF250011,0xFF200020,0xFF160039,0xFF0B0055,0xFF030073,
+   0xFF030088,0xFF0800A9,0xFF06009C,0xFF020061,0xFF13001C,0xFF1C0000,0xFF190001,
+   0xFF180003,0xFF180003,0xFF1B0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF200000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF240001,0xFF180028,0xFF210009,0xFF240000,
+   0xFF260000,0xFF2E0002,0xFF0E0047,0xFF050052,0xFF220009,0xFF290000,0xFF290000,
+   0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF290000,0xFF290000,
+   0xFF290000,0xFF290000,0xFF280000,0xFF280000,0xFF270000,0xFF270000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF250002,0xFF170029,0xFF1B003F,0xFF110054,
+   0xFF090048,0xFF200002,0xFF220000,0xFF220000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF230000,
+   0xFF250000,0xFF2E0000,0xFF150032,0xFF04008A,0xFF0A00B1,0xFF03008A,0xFF03005F,
+   0xFF0F003E,0xFF1B002A,0xFF1F0022,0xFF250018,0xFF270015,0xFF270014,0xFF280013,
+   0xFF290013,0xFF290012,0xFF2B000E,0xFF2C0009,0xFF2E0004,0xFF2D0003,0xFF2A0003,
+   0xFF280002,0xFF270001,0xFF280003,0xFF270009,0xFF230012,0xFF1D0023,0xFF14003E,
+   0xFF0A005D,0xFF04007C,0xFF040092,0xFF0A00AF,0xFF07009E,0xFF02005B,0xFF120018,
+   0xFF1B0000,0xFF190000,0xFF1A0000,0xFF1A0000,0xFF1D0000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF230001,0xFF170024,
+   0xFF200008,0xFF230000,0xFF230000,0xFF2B0003,0xFF0D0049,0xFF050054,0xFF21000A,
+   0xFF280000,0xFF280000,0xFF280000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF270000,0xFF280000,0xFF280000,0xFF280002,0xFF180026,
+   0xFF1C003C,0xFF12004F,0xFF090044,0xFF200002,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF230000,0xFF2A0000,0xFF18002E,0xFF010081,0xFF010075,
+   0xFF090040,0xFF230015,0xFF2F0002,0xFF2F0000,0xFF2D0000,0xFF2B0000,0xFF2B0000,
+   0xFF2A0000,0xFF280000,0xFF270000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,
+   0xFF220000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF220000,
+   0xFF250000,0xFF290000,0xFF2B0004,0xFF23001B,0xFF0A0051,0xFF030083,0xFF0800AA,
+   0xFF04008E,0xFF030057,0xFF130017,0xFF190002,0xFF170006,0xFF170006,0xFF180003,
+   0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF1F0010,0xFF180024,0xFF230000,0xFF250000,0xFF250000,0xFF2C0000,0xFF1F0022,
+   0xFF000065,0xFF0F0031,0xFF270002,0xFF290000,0xFF290000,0xFF290000,0xFF290000,
+   0xFF290000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF280000,
+   0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF260000,
+   0xFF1B0018,0xFF1F0015,0xFF2D0000,0xFF290015,0xFF080054,0xFF1C000B,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF230000,0xFF2A0000,0xFF18002A,
+   0xFF02007E,0xFF02007C,0xFF080046,0xFF210017,0xFF2B0002,0xFF2B0000,0xFF280000,
+   0xFF260000,0xFF270000,0xFF280000,0xFF290000,0xFF280000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF250000,0xFF220000,0xFF200000,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF220000,0xFF240000,0xFF250005,0xFF1F0020,0xFF09005E,
+   0xFF04008F,0xFF0A00B0,0xFF04008A,0xFF03004D,0xFF150011,0xFF1C0000,0xFF1A0000,
+   0xFF1A0000,0xFF1C0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF1D000F,0xFF170021,0xFF220000,0xFF230000,0xFF230000,
+   0xFF2A0000,0xFF1E001F,0xFF000063,0xFF0F0031,0xFF270002,0xFF280000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF270000,0xFF270000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF270000,0xFF270000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF290000,0xFF1E0015,0xFF220013,0xFF300000,0xFF2B0014,0xFF08004F,
+   0xFF1C000B,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF270001,0xFF100042,0xFF00006E,0xFF0D0037,0xFF27000A,0xFF2A0000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF280000,0xFF280000,0xFF270000,0xFF260000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF210000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF210000,
+   0xFF280000,0xFF2A000D,0xFF0D0041,0xFF010076,0xFF0600A2,0xFF030089,0xFF040053,
+   0xFF130013,0xFF170005,0xFF170006,0xFF180005,0xFF190002,0xFF1B0000,0xFF1D0000,
+   0xFF1F0000,0xFF210000,0xFF220000,0xFF230000,0xFF18001E,0xFF1D000E,0xFF220000,
+   0xFF230000,0xFF240000,0xFF270000,0xFF29000D,0xFF040057,0xFF01005B,0xFF16001E,
+   0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF290000,0xFF290000,0xFF290000,0xFF280000,0xFF280000,0xFF270000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF1E0010,0xFF080062,0xFF140031,0xFF220001,
+   0xFF2A0003,0xFF10004C,0xFF170018,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF270000,0xFF10003B,0xFF00006C,0xFF0C003E,0xFF24000C,
+   0xFF270000,0xFF230000,0xFF220000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF240000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1C0000,
+   0xFF1B0000,0xFF1B0000,0xFF220000,0xFF230010,0xFF0B004F,0xFF020083,0xFF0800A5,
+   0xFF030080,0xFF040046,0xFF16000C,0xFF190000,0xFF190000,0xFF1A0000,0xFF1D0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF17001A,
+   0xFF1B000C,0xFF200000,0xFF220000,0xFF240000,0xFF270000,0xFF29000A,0xFF040051,
+   0xFF01005B,0xFF16001F,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF260000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF280000,0xFF280000,
+   0xFF270000,0xFF270000,0xFF280000,0xFF280000,0xFF290000,0xFF21000D,0xFF09005B,
+   0xFF16002D,0xFF250001,0xFF2D0003,0xFF110048,0xFF170017,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF21000C,0xFF050061,0xFF0A0046,
+   0xFF260009,0xFF290000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF270000,0xFF2A000A,
+   0xFF0E003E,0xFF010078,0xFF0700A6,0xFF020082,0xFF060048,0xFF15000D,0xFF170006,
+   0xFF180005,0xFF180004,0xFF190001,0xFF1B0000,0xFF1D0000,0xFF200000,0xFF210000,
+   0xFF1D0008,0xFF150020,0xFF200001,0xFF210000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF2C0004,0xFF0B0041,0xFF000076,0xFF04004A,0xFF1D0012,0xFF290000,0xFF290000,
+   0xFF290000,0xFF290000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF290000,0xFF290000,
+   0xFF280000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF1A0018,
+   0xFF070058,0xFF090074,0xFF0D005B,0xFF110041,0xFF190027,0xFF0B0053,0xFF16001E,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF21000B,
+   0xFF05005A,0xFF0A0047,0xFF23000A,0xFF240000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF190002,
+   0xFF1E0001,0xFF23000D,0xFF0C004A,0xFF020081,0xFF0800A4,0xFF020079,0xFF06003D,
+   0xFF160007,0xFF180000,0xFF190000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1C0000,
+   0xFF1E0000,0xFF1F0000,0xFF1C0007,0xFF14001C,0xFF1F0001,0xFF1F0000,0xFF200000,
+   0xFF220000,0xFF240000,0xFF2C0003,0xFF0B003B,0xFF000077,0xFF03004D,0xFF1C0013,
+   0xFF280000,0xFF270000,0xFF270000,0xFF280000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF280000,
+   0xFF280000,0xFF1C0015,0xFF080051,0xFF09006E,0xFF0E0055,0xFF12003D,0xFF1B0025,
+   0xFF0B004F,0xFF16001D,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF230000,0xFF1C0020,0xFF030064,0xFF200014,0xFF290000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF270000,0xFF260000,0xFF260000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF220000,0xFF200000,
+   0xFF1F0000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF250000,0xFF29000A,0xFF0C0043,0xFF020082,
+   0xFF0700A5,0xFF010076,0xFF08003D,0xFF16000A,0xFF190002,0xFF190002,0xFF190001,
+   0xFF190001,0xFF1A0000,0xFF1D0000,0xFF1E0000,0xFF160016,0xFF170018,0xFF200000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF2A0001,0xFF100032,0xFF020087,
+   0xFF02007E,0xFF050040,0xFF1D0010,0xFF290000,0xFF290000,0xFF290000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF290000,0xFF280000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF250003,0xFF13002B,0xFF09005A,0xFF18003B,0xFF28000C,0xFF2B0006,
+   0xFF26001A,0xFF12004A,0xFF02007D,0xFF12002D,0xFF230000,0xFF230000,0xFF240000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF230000,0xFF1C001D,0xFF030063,0xFF1E0016,0xFF250000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF230000,0xFF210000,0xFF210000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF1D0000,0xFF1A0000,0xFF180003,0xFF170006,0xFF1C0002,0xFF23000D,
+   0xFF0B004C,0xFF030087,0xFF0800A3,0xFF02006F,0xFF080034,0xFF160005,0xFF180000,
+   0xFF180000,0xFF180000,0xFF180000,0xFF190000,0xFF1A0000,0xFF1B0000,0xFF140013,
+   0xFF160015,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF2A0000,
+   0xFF0F002F,0xFF020087,0xFF020080,0xFF050043,0xFF1C0012,0xFF270000,0xFF280000,
+   0xFF280000,0xFF270000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF280000,0xFF280000,0xFF270003,0xFF140028,0xFF0A0054,0xFF1A0037,
+   0xFF2B000A,0xFF2E0005,0xFF290018,0xFF130047,0xFF020079,0xFF12002A,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF240000,0xFF13003C,0xFF090053,
+   0xFF260003,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF260000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF230000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF250000,0xFF26000F,0xFF08004E,0xFF040090,0xFF0800A7,0xFF03007A,
+   0xFF09003D,0xFF170006,0xFF190000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,
+   0xFF1C0000,0xFF13001D,0xFF1B000C,0xFF200000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF260004,0xFF0A0039,0xFF040090,0xFF0800AB,0xFF02007B,0xFF040040,
+   0xFF1B0014,0xFF290001,0xFF290000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF290000,
+   0xFF290000,0xFF290000,0xFF250003,0xFF1F000C,0xFF18001C,0xFF130031,0xFF1A0037,
+   0xFF280014,0xFF290000,0xFF240000,0xFF220000,0xFF270000,0xFF2C0006,0xFF0C004B,
+   0xFF07004F,0xFF200006,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF210000,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF210000,0xFF250000,
+   0xFF140038,0xFF080055,0xFF220004,0xFF230000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF1E0000,0xFF1B0000,
+   0xFF190002,0xFF170006,0xFF170005,0xFF1E0001,0xFF220011,0xFF070055,0xFF050094,
+   0xFF0900A8,0xFF030078,0xFF08003B,0xFF150006,0xFF170000,0xFF170000,0xFF180000,
+   0xFF180000,0xFF180000,0xFF190000,0xFF11001B,0xFF19000B,0xFF1E0000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF250003,0xFF0A0038,0xFF040090,0xFF0800AC,
+   0xFF02007C,0xFF040043,0xFF190015,0xFF270001,0xFF280000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF280000,0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF240003,0xFF1F000C,0xFF18001C,
+   0xFF140030,0xFF1B0035,0xFF2A0013,0xFF2C0000,0xFF270000,0xFF250000,0xFF290000,
+   0xFF2E0006,0xFF0C0048,0xFF06004D,0xFF1E0007,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF240007,0xFF0B006A,0xFF11003E,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF240000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF200000,0xFF200000,0xFF260000,
+   0xFF20001B,0xFF040064,0xFF07009F,0xFF030084,0xFF020078,0xFF090049,0xFF17000A,
+   0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1A0007,0xFF160011,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF180017,0xFF020054,
+   0xFF0700A3,0xFF0A00B3,0xFF0800AD,0xFF030080,0xFF020047,0xFF13001E,0xFF250004,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF290000,0xFF280000,
+   0xFF270001,0xFF240005,0xFF20000B,0xFF1B0012,0xFF15001C,0xFF0F002C,0xFF0B0036,
+   0xFF0F0038,0xFF1D0024,0xFF28000F,0xFF2A0001,0xFF260000,0xFF240000,0xFF220000,
+   0xFF210000,0xFF220000,0xFF290000,0xFF20001A,0xFF01005D,0xFF140022,0xFF240000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF210000,0xFF200000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF250006,0xFF0C0065,0xFF0F003D,0xFF230000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF1F0000,0xFF1D0000,0xFF1A0001,0xFF180002,0xFF180003,
+   0xFF180002,0xFF210000,0xFF1D001E,0xFF04006C,0xFF0800A4,0xFF04008B,0xFF02007E,
+   0xFF08004B,0xFF140009,0xFF180000,0xFF180000,0xFF180000,0xFF180000,0xFF170006,
+   0xFF14000E,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF160014,0xFF020054,0xFF0700A3,0xFF0A00B3,0xFF0800AD,0xFF030082,0xFF02004A,
+   0xFF130020,0xFF240004,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF280000,
+   0xFF270000,0xFF260000,0xFF250001,0xFF220005,0xFF1E000C,0xFF190014,0xFF14001F,
+   0xFF0E002F,0xFF0B0039,0xFF0F003A,0xFF1D0024,0xFF2A000F,0xFF2C0001,0xFF290000,
+   0xFF270000,0xFF250000,0xFF240000,0xFF240000,0xFF2B0000,0xFF210019,0xFF01005C,
+   0xFF120027,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220001,0xFF1B001A,0xFF040071,
+   0xFF17002A,0xFF280000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF260000,0xFF240000,0xFF220000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF290001,0xFF130038,0xFF01007A,
+   0xFF0D003C,0xFF1E0023,0xFF11004B,0xFF080051,0xFF130019,0xFF1B0000,0xFF1D0000,
+   0xFF1D0002,0xFF160012,0xFF1D0003,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF200004,0xFF13001D,0xFF030049,0xFF03008A,0xFF0900AE,0xFF0900AB,0xFF0900AB,
+   0xFF0800AA,0xFF03008E,0xFF01005B,0xFF0A0030,0xFF190013,0xFF1F0009,0xFF230003,
+   0xFF240002,0xFF200009,0xFF1A0013,0xFF12001E,0xFF0C002A,0xFF060039,0xFF030049,
+   0xFF020059,0xFF000062,0xFF0C004E,0xFF26001B,0xFF2D0006,0xFF2B0000,0xFF270000,
+   0xFF250000,0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF240000,
+   0xFF280009,0xFF040051,0xFF070045,0xFF210004,0xFF240000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF1B0015,0xFF040069,0xFF160027,0xFF240000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF220000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF1E0000,0xFF1B0000,0xFF1A0000,0xFF190000,0xFF190001,0xFF1A0000,0xFF250002,
+   0xFF11003E,0xFF020082,0xFF0C0043,0xFF1B0026,0xFF10004E,0xFF080053,0xFF120017,
+   0xFF180000,0xFF190000,0xFF190002,0xFF130010,0xFF1A0003,0xFF1D0000,0xFF1E0000,
+   0xFF200000,0xFF200000,0xFF1E0003,0xFF120019,0xFF030045,0xFF03008A,0xFF0900AE,
+   0xFF0900AB,0xFF0900AB,0xFF0800AB,0xFF040090,0xFF01005E,0xFF0A0033,0xFF180015,
+   0xFF1E000A,0xFF220003,0xFF230003,0xFF1F000A,0xFF190015,0xFF110021,0xFF0B002E,
+   0xFF06003E,0xFF03004D,0xFF02005E,0xFF010067,0xFF0C0051,0xFF25001D,0xFF2D0007,
+   0xFF2B0000,0xFF280000,0xFF270000,0xFF270000,0xFF260000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF260000,0xFF290008,0xFF050050,0xFF06004C,0xFF1E0006,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210003,0xFF1D000E,0xFF1E001C,0xFF040067,0xFF1A001F,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF260000,0xFF230000,0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF230000,0xFF240012,0xFF060069,0xFF180022,0xFF250000,0xFF280002,
+   0xFF1D0028,0xFF070058,0xFF0F002F,0xFF1A0006,0xFF150017,0xFF140019,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF1E0006,0xFF15001F,0xFF080043,0xFF00005C,0xFF010069,
+   0xFF02006F,0xFF020062,0xFF020057,0xFF030054,0xFF02005B,0xFF020066,0xFF01006A,
+   0xFF000062,0xFF00005A,0xFF020052,0xFF070048,0xFF070044,0xFF03004A,0xFF010056,
+   0xFF01006A,0xFF030080,0xFF050092,0xFF0700A0,0xFF040088,0xFF0A0042,0xFF27000A,
+   0xFF2A0000,0xFF280000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF250000,0xFF250009,0xFF050050,0xFF010062,
+   0xFF14001B,0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200003,0xFF1C000C,0xFF1E0018,0xFF04005E,0xFF19001C,
+   0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF220000,0xFF200000,0xFF1F0000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF1E0000,0xFF1C0000,0xFF1B0000,
+   0xFF1A0000,0xFF190000,0xFF1A0000,0xFF1F0000,0xFF210015,0xFF060071,0xFF150025,
+   0xFF210000,0xFF250002,0xFF1B002A,0xFF07005A,0xFF0D002F,0xFF170006,0xFF130015,
+   0xFF110017,0xFF1C0000,0xFF1E0000,0xFF1E0000,0xFF1C0005,0xFF14001B,0xFF07003B,
+   0xFF000053,0xFF010061,0xFF020065,0xFF020057,0xFF03004E,0xFF03004F,0xFF020053,
+   0xFF02005B,0xFF010060,0xFF00005A,0xFF000057,0xFF020052,0xFF06004A,0xFF070047,
+   0xFF03004E,0xFF01005A,0xFF01006E,0xFF030083,0xFF060096,0xFF0800A3,0xFF04008C,
+   0xFF0A0046,0xFF26000A,0xFF2A0000,0xFF280000,0xFF270000,0xFF270000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF250009,
+   0xFF05004F,0xFF010065,0xFF120022,0xFF220000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF1D000D,0xFF1C0011,0xFF230005,0xFF220015,
+   0xFF040065,0xFF1D001A,0xFF280000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF260000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF230000,0xFF220000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF290000,
+   0xFF140045,0xFF140030,0xFF200000,0xFF1F0000,0xFF280000,0xFF220019,0xFF06005E,
+   0xFF05005D,0xFF030057,0xFF090035,0xFF10001E,0xFF110022,0xFF0A003C,0xFF050050,
+   0xFF050051,0xFF0A0040,0xFF0E0031,0xFF130025,0xFF17001D,0xFF1C0016,0xFF220010,
+   0xFF24000E,0xFF220012,0xFF1D0017,0xFF19001E,0xFF160029,0xFF110035,0xFF0D003D,
+   0xFF090041,0xFF080045,0xFF060046,0xFF03004E,0xFF010063,0xFF03008C,0xFF0900AF,
+   0xFF0900AD,0xFF02005F,0xFF1A0014,0xFF280000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF240002,0xFF120023,0xFF02006C,0xFF03008A,0xFF040046,0xFF170015,0xFF230001,
+   0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF210001,0xFF1D000A,0xFF1B000E,
+   0xFF220004,0xFF230013,0xFF04005E,0xFF1B0018,0xFF250000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF200000,0xFF1F0000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF1F0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF1B0000,0xFF1B0000,
+   0xFF1C0000,0xFF250001,0xFF12004C,0xFF110034,0xFF1B0000,0xFF1C0000,0xFF250000,
+   0xFF21001B,0xFF060061,0xFF04005F,0xFF030058,0xFF080036,0xFF0E001E,0xFF0F0021,
+   0xFF090038,0xFF04004B,0xFF050048,0xFF090034,0xFF0E0024,0xFF12001A,0xFF170013,
+   0xFF1B000E,0xFF210009,0xFF220008,0xFF20000B,0xFF1C000F,0xFF180014,0xFF14001E,
+   0xFF10002A,0xFF0C0034,0xFF09003B,0xFF07003F,0xFF060040,0xFF030048,0xFF010061,
+   0xFF04008E,0xFF0A00B2,0xFF0A00B0,0xFF020063,0xFF180017,0xFF270000,0xFF260000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF270000,0xFF250002,0xFF130023,0xFF02006A,0xFF030089,0xFF03004B,
+   0xFF16001A,0xFF220001,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220001,
+   0xFF1F000D,0xFF230002,0xFF250000,0xFF180028,0xFF01006E,0xFF1A001F,0xFF270000,
+   0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF250000,0xFF1E0024,0xFF090055,0xFF1D0005,
+   0xFF1F0000,0xFF200000,0xFF290000,0xFF13002F,0xFF030088,0xFF0600A3,0xFF02007B,
+   0xFF01006D,0xFF02006A,0xFF0A0052,0xFF170029,0xFF24000A,0xFF290003,0xFF2A0001,
+   0xFF2A0000,0xFF290000,0xFF270000,0xFF260000,0xFF260000,0xFF270000,0xFF290000,
+   0xFF2D0000,0xFF2F0000,0xFF300000,0xFF300002,0xFF2E0003,0xFF2E0005,0xFF2E0007,
+   0xFF2B000C,0xFF20001A,0xFF060041,0xFF04008B,0xFF0800A9,0xFF020054,0xFF1C000E,
+   0xFF240000,0xFF230000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF220001,
+   0xFF1F0007,0xFF1B0012,0xFF18001B,0xFF140027,0xFF09003F,0xFF01005C,0xFF010078,
+   0xFF030083,0xFF02007B,0xFF020057,0xFF0E002D,0xFF1D000A,0xFF220000,0xFF220000,
+   0xFF1E0009,0xFF1A0013,0xFF1E000C,0xFF230002,0xFF250000,0xFF180023,0xFF010069,
+   0xFF18001F,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1D0000,
+   0xFF1C0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF200000,0xFF1B0027,
+   0xFF08005C,0xFF1A0006,0xFF1D0000,0xFF1E0000,0xFF270000,0xFF120031,0xFF03008B,
+   0xFF0700A6,0xFF02007F,0xFF01006F,0xFF020066,0xFF09004C,0xFF150023,0xFF220007,
+   0xFF260001,0xFF270000,0xFF280000,0xFF270000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF270000,0xFF290000,0xFF2B0000,0xFF2C0000,0xFF2C0001,0xFF2B0002,
+   0xFF2B0003,0xFF2A0005,0xFF270008,0xFF1D0014,0xFF05003A,0xFF04008B,0xFF0900AC,
+   0xFF02005A,0xFF1A0010,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220001,0xFF1F0007,0xFF1C0011,0xFF18001B,0xFF140027,0xFF0A003F,
+   0xFF01005C,0xFF010077,0xFF020081,0xFF01007A,0xFF02005C,0xFF0D0034,0xFF1C000D,
+   0xFF220000,0xFF220001,0xFF1E000B,0xFF1A0017,0xFF240000,0xFF240000,0xFF1F000E,
+   0xFF070053,0xFF020080,0xFF180020,0xFF280000,0xFF270000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF230000,0xFF220011,0xFF040064,0xFF120029,0xFF200000,0xFF200000,0xFF230002,
+   0xFF0D0038,0xFF01007D,0xFF02007A,0xFF020058,0xFF080043,0xFF18001F,0xFF250003,
+   0xFF260000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF260000,0xFF260000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF280000,0xFF2A0000,0xFF320000,0xFF200018,
+   0xFF010057,0xFF0600A1,0xFF010064,0xFF13001B,0xFF240000,0xFF240000,0xFF230001,
+   0xFF1F000A,0xFF16001C,0xFF0F002C,0xFF08003D,0xFF04004E,0xFF040054,0xFF08004F,
+   0xFF0B0048,0xFF0F003C,0xFF130034,0xFF13002C,0xFF13002C,0xFF11003C,0xFF0B0057,
+   0xFF050061,0xFF050056,0xFF110033,0xFF15002D,0xFF1A0015,0xFF230003,0xFF240000,
+   0xFF240000,0xFF1F000C,0xFF07004B,0xFF02007E,0xFF160022,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1C0000,0xFF1E0000,0xFF1F0013,0xFF04006B,0xFF10002D,0xFF1E0000,
+   0xFF1E0000,0xFF210002,0xFF0D0038,0xFF010077,0xFF030070,0xFF02004E,0xFF080039,
+   0xFF160018,0xFF230002,0xFF230000,0xFF210000,0xFF200000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF200000,
+   0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF270000,
+   0xFF2D0000,0xFF1D0012,0xFF01004F,0xFF0700A3,0xFF020069,0xFF12001E,0xFF230000,
+   0xFF230000,0xFF230001,0xFF1E000A,0xFF16001C,0xFF0E002C,0xFF08003E,0xFF040050,
+   0xFF040056,0xFF080051,0xFF0B004A,0xFF10003E,0xFF140034,0xFF14002C,0xFF14002B,
+   0xFF12003B,0xFF0B0056,0xFF050061,0xFF05005A,0xFF100037,0xFF150031,0xFF1A0018,
+   0xFF220004,0xFF14002B,0xFF12002F,0xFF07004E,0xFF030086,0xFF030088,0xFF140024,
+   0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF2A0002,0xFF12003A,
+   0xFF05005E,0xFF150018,0xFF15001D,0xFF0D003E,0xFF03005C,0xFF090048,0xFF150022,
+   0xFF1D0010,0xFF210004,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF280000,0xFF300004,0xFF0C0034,0xFF030088,0xFF04008D,
+   0xFF030047,0xFF0C002F,0xFF0F0034,0xFF0B0046,0xFF060052,0xFF060050,0xFF0B0043,
+   0xFF130036,0xFF1D0020,0xFF25000E,0xFF2B0005,0xFF2D0002,0xFF2D0000,0xFF2D0000,
+   0xFF2D0000,0xFF2D0000,0xFF2E0000,0xFF2E0004,0xFF2B000D,0xFF210026,0xFF0F005A,
+   0xFF0A0070,0xFF0C0046,0xFF0F0037,0xFF140026,0xFF130029,0xFF070045,0xFF03007F,
+   0xFF04008A,0xFF120028,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,
+   0xFF270002,0xFF110040,0xFF050064,0xFF13001B,0xFF14001C,0xFF0C0035,0xFF03004E,
+   0xFF08003A,0xFF130019,0xFF1B000B,0xFF1F0003,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF230000,0xFF250000,0xFF2B0003,0xFF0B002A,
+   0xFF040087,0xFF040091,0xFF03004C,0xFF0C0031,0xFF0F0036,0xFF0B0047,0xFF060053,
+   0xFF070051,0xFF0B0046,0xFF13003B,0xFF1D0024,0xFF250011,0xFF2B0006,0xFF2D0002,
+   0xFF2E0001,0xFF2F0000,0xFF2F0000,0xFF2F0000,0xFF300000,0xFF2F0004,0xFF2D000C,
+   0xFF230026,0xFF0F005D,0xFF0A0075,0xFF0C004D,0xFF0E0040,0xFF09005F,0xFF010073,
+   0xFF010083,0xFF0600A6,0xFF03008A,0xFF0C0033,0xFF260001,0xFF260000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF240000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF220000,0xFF220000,0xFF230000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF270000,0xFF1A001F,0xFF020072,0xFF020071,0xFF020062,
+   0xFF0E0040,0xFF1F0017,0xFF250004,0xFF250000,0xFF220000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF2E0000,0xFF1D001C,0xFF010067,0xFF0800AB,0xFF050096,0xFF010071,0xFF020056,
+   0xFF0F0035,0xFF1F0018,0xFF270007,0xFF2A0002,0xFF2A0000,0xFF280000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF270000,0xFF2C0000,0xFF2D0004,0xFF2B000E,0xFF28001A,0xFF1B0034,
+   0xFF0A0050,0xFF010068,0xFF01007D,0xFF0700A5,0xFF04008E,0xFF0B0037,0xFF230001,
+   0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF240000,0xFF180023,0xFF020078,
+   0xFF020070,0xFF010055,0xFF0C0034,0xFF1C0012,0xFF230003,0xFF220000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF200000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF200000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF2B0000,0xFF1A0016,0xFF010065,0xFF0900AE,0xFF060099,
+   0xFF010074,0xFF02005A,0xFF0F0038,0xFF1F0019,0xFF280008,0xFF2A0002,0xFF290000,
+   0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF270000,0xFF290000,0xFF2E0000,0xFF2F0004,0xFF2C000E,
+   0xFF29001D,0xFF1E0038,0xFF310008,0xFF220022,0xFF0D0043,0xFF020066,0xFF01007C,
+   0xFF070044,0xFF230004,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210005,
+   0xFF09003E,0xFF02007E,0xFF03005D,0xFF19001E,0xFF250002,0xFF240000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF290000,0xFF29000C,0xFF04004B,
+   0xFF0600A0,0xFF030088,0xFF040041,0xFF1D0012,0xFF290001,0xFF260000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF250000,0xFF280000,0xFF2E0000,0xFF2F0005,0xFF21001D,0xFF0D0041,
+   0xFF020068,0xFF01007F,0xFF060048,0xFF210005,0xFF240000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0006,0xFF080043,0xFF030080,0xFF030052,0xFF160018,0xFF220001,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF270000,
+   0xFF260009,0xFF04004B,0xFF0700A3,0xFF04008C,0xFF040049,0xFF1D0016,0xFF290001,
+   0xFF260000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF270000,0xFF2A0000,0xFF300000,0xFF280000,
+   0xFF2E0000,0xFF310004,0xFF200021,0xFF030055,0xFF040055,0xFF210009,0xFF260000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF230000,0xFF140021,0xFF010063,0xFF030067,0xFF15001F,
+   0xFF230001,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF2D0003,0xFF0A003C,0xFF02007C,0xFF030043,0xFF1A0011,
+   0xFF270000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF250000,0xFF2C0000,0xFF2F0004,0xFF1E001F,0xFF030054,0xFF040057,
+   0xFF200009,0xFF250000,0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF120025,0xFF010069,
+   0xFF030063,0xFF130019,0xFF200000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF2A0002,0xFF0A003A,0xFF020081,
+   0xFF030050,0xFF190018,0xFF260000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF260000,0xFF2F0000,
+   0xFF200021,0xFF03005D,0xFF1B0015,0xFF250000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF210000,0xFF220000,0xFF20000A,
+   0xFF050045,0xFF00006F,0xFF0D0035,0xFF230001,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF290004,
+   0xFF09003A,0xFF000057,0xFF160018,0xFF260000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF230000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF240000,0xFF2D0000,0xFF1F001C,0xFF030059,0xFF1C0014,0xFF250000,0xFF240000,
+   0xFF230000,0xFF220000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF1E000B,0xFF05004C,0xFF00006F,0xFF0C002E,0xFF200001,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF270002,0xFF090036,0xFF000063,0xFF150021,0xFF240001,0xFF230000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF2E0003,0xFF0D004E,0xFF0E003B,
+   0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF230000,0xFF130024,0xFF010063,0xFF020058,0xFF1A0012,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF260000,0xFF260008,0xFF050042,0xFF04004A,0xFF200006,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF2D0002,
+   0xFF0D0045,0xFF0E0038,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF230000,0xFF130025,0xFF010065,
+   0xFF02004F,0xFF18000D,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF250000,0xFF250005,0xFF05003F,
+   0xFF040057,0xFF1F0009,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF2A0000,0xFF25001C,0xFF050060,0xFF16001F,0xFF240000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF1D000F,
+   0xFF04004C,0xFF010078,0xFF07003F,0xFF200004,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF260000,
+   0xFF22000F,0xFF02004C,0xFF070040,0xFF210002,0xFF230000,0xFF230000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF290000,0xFF240017,0xFF050059,0xFF17001E,
+   0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF1D000E,0xFF04004B,0xFF010073,0xFF070031,0xFF1F0003,0xFF200000,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF250000,0xFF21000A,0xFF02004D,0xFF07004C,0xFF200003,0xFF220000,
+   0xFF220000,0xFF230000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF2E0001,
+   0xFF110046,0xFF050058,0xFF1F0008,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220003,0xFF0C0037,0xFF02007C,0xFF02007A,0xFF0E002B,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF270000,0xFF1C001A,0xFF00005B,0xFF090035,
+   0xFF220001,0xFF230000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF2D0000,0xFF100040,0xFF050056,0xFF1F0008,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF230000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF230002,0xFF0C0035,0xFF01007A,
+   0xFF020071,0xFF0E001E,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF260000,0xFF1B0014,
+   0xFF00005E,0xFF090041,0xFF210002,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF2A0000,0xFF1A002A,0xFF00006E,0xFF130027,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF210000,0xFF200000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF180020,
+   0xFF020062,0xFF020073,0xFF01006A,0xFF14001D,0xFF210000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF270000,0xFF12002E,0xFF000066,0xFF0B0029,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF290000,0xFF190024,
+   0xFF00006B,0xFF130027,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF220000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF220000,0xFF18001E,0xFF02005F,0xFF01006F,0xFF01005D,0xFF150013,0xFF200000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF260000,0xFF110025,0xFF000069,0xFF0B0034,0xFF220001,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF280000,0xFF1E001D,0xFF000069,0xFF08004D,0xFF210005,0xFF250000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF200000,0xFF1C0010,0xFF070054,0xFF160030,0xFF150030,0xFF000061,
+   0xFF150019,0xFF1F0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF200000,0xFF220000,0xFF230000,0xFF240000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF250004,0xFF090046,0xFF01006B,
+   0xFF0F0021,0xFF230000,0xFF230000,0xFF230000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF270000,0xFF1E0018,0xFF000063,0xFF08004C,0xFF220005,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF1D000F,0xFF070050,0xFF18002D,
+   0xFF16002D,0xFF000054,0xFF160010,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF230003,
+   0xFF090039,0xFF01006D,0xFF0F002A,0xFF230000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF270000,0xFF220016,0xFF020061,
+   0xFF01006D,0xFF10002A,0xFF220004,0xFF260000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0007,0xFF090048,
+   0xFF100038,0xFF230000,0xFF1C001C,0xFF020061,0xFF150015,0xFF1D0000,0xFF1C0000,
+   0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF210000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF21000F,0xFF03005A,0xFF010067,0xFF13001A,0xFF240000,0xFF230000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF260000,
+   0xFF210012,0xFF02005B,0xFF01006B,0xFF110028,0xFF230004,0xFF260000,0xFF260000,
+   0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF1F0006,0xFF0A0045,0xFF110035,0xFF260000,0xFF1E001B,0xFF020056,0xFF16000E,
+   0xFF1E0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,
+   0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,
+   0xFF1F0000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF220000,0xFF1F000B,0xFF03004E,0xFF01006C,0xFF130021,
+   0xFF240000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF270000,0xFF280000,
+   0xFF260000,0xFF270000,0xFF250011,0xFF03005E,0xFF040093,0xFF01006D,0xFF0A003D,
+   0xFF1A0013,0xFF240001,0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0003,0xFF0D003A,0xFF0B004D,0xFF1C0007,0xFF1D0000,0xFF1A001A,
+   0xFF020061,0xFF150014,0xFF1B0000,0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1D0000,
+   0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1E0000,0xFF210000,0xFF230000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF250000,0xFF170022,0xFF01006C,
+   0xFF010063,0xFF150016,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF250000,0xFF270000,0xFF270000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF260000,0xFF260000,0xFF250000,0xFF260000,0xFF24000F,0xFF03005C,0xFF040093,
+   0xFF01006B,0xFF0A003C,0xFF1B0013,0xFF250001,0xFF250000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200003,0xFF0D0036,0xFF0B004A,0xFF1E0006,
+   0xFF1F0000,0xFF1B0019,0xFF020059,0xFF16000E,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF230000,
+   0xFF160019,0xFF010061,0xFF010068,0xFF15001B,0xFF220000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF260000,0xFF280000,0xFF280000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF270000,0xFF2B0000,0xFF2F0000,0xFF310000,0xFF2F0000,0xFF2D0000,0xFF230015,
+   0xFF020064,0xFF030075,0xFF0B0067,0xFF05007A,0xFF04005F,0xFF0D0039,0xFF1E000C,
+   0xFF240000,0xFF240000,0xFF230000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,
+   0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1C0007,0xFF0D0035,0xFF090051,
+   0xFF1B0011,0xFF1A0000,0xFF1B0000,0xFF1C0016,0xFF020063,0xFF120019,0xFF1A0000,
+   0xFF1A0000,0xFF190000,0xFF1A0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1E0000,0xFF210000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF240003,0xFF0B003F,0xFF01007F,0xFF02005A,0xFF18000F,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF260000,
+   0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF260000,0xFF2A0000,0xFF2E0000,0xFF300000,0xFF2E0000,
+   0xFF2C0000,0xFF230014,0xFF020063,0xFF030074,0xFF0B0066,0xFF050079,0xFF04005D,
+   0xFF0E0037,0xFF1E000C,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF1D0006,
+   0xFF0E0031,0xFF0A004B,0xFF1E0010,0xFF1F0000,0xFF200000,0xFF1F0015,0xFF02005A,
+   0xFF140012,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,
+   0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF1B0000,0xFF1B0000,
+   0xFF1D0000,0xFF200000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF230002,0xFF0B002E,0xFF010076,0xFF02005B,
+   0xFF190012,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF250000,0xFF270000,0xFF280000,0xFF280000,0xFF270000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF2E0000,0xFF300000,0xFF310000,
+   0xFF310000,0xFF310000,0xFF2F0000,0xFF16002F,0xFF020068,0xFF190025,0xFF2F0005,
+   0xFF220035,0xFF1D003A,0xFF14004E,0xFF060059,0xFF140026,0xFF200005,0xFF220000,
+   0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1D0000,0xFF1D0000,0xFF1C0003,
+   0xFF160017,0xFF0A0044,0xFF0F0044,0xFF1C0010,0xFF1A0000,0xFF180001,0xFF1A0000,
+   0xFF1E000F,0xFF040065,0xFF0E0028,0xFF1A0000,0xFF190000,0xFF190000,0xFF1A0000,
+   0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1C0000,
+   0xFF1C0000,0xFF1B0000,0xFF1D0000,0xFF210000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF1E0013,0xFF03005E,
+   0xFF03008D,0xFF05004D,0xFF1C0006,0xFF1F0000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF240000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF260000,0xFF250000,0xFF240000,0xFF240000,0xFF250000,0xFF280000,0xFF2D0000,
+   0xFF2F0000,0xFF300000,0xFF300000,0xFF2F0000,0xFF2E0000,0xFF16002E,0xFF020067,
+   0xFF190024,0xFF2F0005,0xFF220034,0xFF1E0039,0xFF14004D,0xFF060058,0xFF140027,
+   0xFF200005,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF1E0003,0xFF170015,0xFF0A0040,0xFF11003F,0xFF21000E,0xFF200000,
+   0xFF1E0000,0xFF1F0000,0xFF21000E,0xFF04005B,0xFF10001C,0xFF1D0000,0xFF1C0000,
+   0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,
+   0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1C0000,0xFF1F0000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF220000,
+   0xFF1D000E,0xFF03004C,0xFF030088,0xFF060049,0xFF1E0006,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF250000,0xFF270000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF290000,0xFF310000,0xFF310000,0xFF310000,0xFF310000,0xFF320000,0xFF28000E,
+   0xFF05005B,0xFF12003B,0xFF280000,0xFF280000,0xFF2C0004,0xFF1F0020,0xFF2E000B,
+   0xFF23002C,0xFF0B005C,0xFF080052,0xFF120025,0xFF1A000C,0xFF1E0003,0xFF200000,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1B0007,0xFF140019,0xFF0C0032,0xFF07004C,0xFF040067,0xFF16002D,0xFF1F0002,
+   0xFF1A0000,0xFF180003,0xFF180003,0xFF190001,0xFF1D000A,0xFF050062,0xFF09003D,
+   0xFF190001,0xFF190001,0xFF190001,0xFF190001,0xFF190001,0xFF1A0000,0xFF1A0000,
+   0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1D0000,
+   0xFF200000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230003,0xFF0F0036,0xFF020080,0xFF050098,0xFF060049,0xFF1C0004,
+   0xFF1E0000,0xFF1F0000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF240000,
+   0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,
+   0xFF260000,0xFF2B0000,0xFF2F0000,0xFF300000,0xFF300000,0xFF300000,0xFF300000,
+   0xFF310000,0xFF28000D,0xFF060059,0xFF13003A,0xFF290000,0xFF280000,0xFF2C0004,
+   0xFF20001F,0xFF2E000B,0xFF23002C,0xFF0B005D,0xFF080053,0xFF120025,0xFF1B000C,
+   0xFF200003,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF1F0005,0xFF170016,0xFF0E002D,0xFF080046,0xFF040061,
+   0xFF18002A,0xFF240002,0xFF210000,0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF220009,
+   0xFF050059,0xFF0B002D,0xFF1D0000,0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,
+   0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF190000,0xFF1A0000,0xFF1A0000,0xFF190000,
+   0xFF190000,0xFF1C0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210002,0xFF0E0028,0xFF020073,0xFF050095,
+   0xFF070044,0xFF1E0004,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF250000,0xFF270000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF270000,0xFF260000,0xFF270000,0xFF2C0000,0xFF300000,0xFF310000,0xFF310000,
+   0xFF310000,0xFF310000,0xFF2F0004,0xFF0F003F,0xFF06005E,0xFF22000B,0xFF260000,
+   0xFF260000,0xFF280000,0xFF27000C,0xFF1C001D,0xFF2D0001,0xFF2F000B,0xFF0E004E,
+   0xFF000072,0xFF040058,0xFF070044,0xFF0A003A,0xFF0D0033,0xFF0E002F,0xFF0F002E,
+   0xFF0F002C,0xFF10002C,0xFF0F0034,0xFF0B0044,0xFF05005A,0xFF010069,0xFF000075,
+   0xFF03008C,0xFF030082,0xFF0A0046,0xFF110020,0xFF15000F,0xFF160006,0xFF170004,
+   0xFF190001,0xFF190010,0xFF030061,0xFF060050,0xFF180003,0xFF190001,0xFF190001,
+   0xFF190002,0xFF190001,0xFF1B0000,0xFF1A0000,0xFF190000,0xFF1A0001,0xFF1B0000,
+   0xFF1B0000,0xFF1B0000,0xFF1A0000,0xFF1C0000,0xFF1F0000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF160023,0xFF020066,
+   0xFF0700A3,0xFF0700A2,0xFF030054,0xFF19000A,0xFF1E0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF260000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF290000,0xFF2D0000,0xFF300000,0xFF300000,
+   0xFF300000,0xFF300000,0xFF300000,0xFF300000,0xFF2F0004,0xFF0F003F,0xFF06005C,
+   0xFF23000B,0xFF260000,0xFF260000,0xFF280000,0xFF27000B,0xFF1D001C,0xFF2E0001,
+   0xFF30000B,0xFF0F004D,0xFF000071,0xFF040056,0xFF070042,0xFF0B0037,0xFF0E002F,
+   0xFF10002A,0xFF110028,0xFF120026,0xFF120027,0xFF11002D,0xFF0C003C,0xFF060051,
+   0xFF010060,0xFF00006F,0xFF020086,0xFF020078,0xFF0C003D,0xFF16001B,0xFF1B0009,
+   0xFF1E0001,0xFF1E0000,0xFF200000,0xFF1E000D,0xFF030057,0xFF07003F,0xFF1B0001,
+   0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF1A0000,0xFF190000,0xFF190000,0xFF190000,0xFF1A0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF210000,
+   0xFF15001B,0xFF020057,0xFF0600A0,0xFF06009E,0xFF04004E,0xFF1C000A,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF250000,0xFF270000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF2A0000,0xFF2E0000,
+   0xFF310000,0xFF310000,0xFF310000,0xFF310000,0xFF320000,0xFF300002,0xFF16002D,
+   0xFF020068,0xFF1C0025,0xFF280000,0xFF250000,0xFF250000,0xFF250000,0xFF280000,
+   0xFF210016,0xFF1B0019,0xFF290001,0xFF0E003C,0xFF03008F,0xFF06009E,0xFF020087,
+   0xFF000077,0xFF01007A,0xFF01007C,0xFF00007C,0xFF01007C,0xFF000078,0xFF010074,
+   0xFF040069,0xFF06005D,0xFF09004F,0xFF0A0047,0xFF09004B,0xFF05005F,0xFF02006F,
+   0xFF020073,0xFF03006A,0xFF070051,0xFF0B0036,0xFF0E0028,0xFF0A0039,0xFF020076,
+   0xFF040065,0xFF15000C,0xFF1A0000,0xFF190002,0xFF190002,0xFF190001,0xFF1B0000,
+   0xFF1A0000,0xFF190002,0xFF190002,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF190001,
+   0xFF1A0000,0xFF1C0000,0xFF1E0000,0xFF200000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF220000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF18001B,0xFF030058,0xFF050094,0xFF0B00B4,0xFF0900AD,0xFF01006D,
+   0xFF100020,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF250000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF280000,
+   0xFF2C0000,0xFF2F0000,0xFF300000,0xFF300000,0xFF300000,0xFF300000,0xFF310000,
+   0xFF2F0002,0xFF16002D,0xFF020068,0xFF1C0025,0xFF280000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF2A0000,0xFF220015,0xFF1D0018,0xFF2B0001,0xFF0F0039,0xFF03008C,
+   0xFF05009C,0xFF020084,0xFF000073,0xFF000073,0xFF000075,0xFF000074,0xFF000071,
+   0xFF00006E,0xFF01006A,0xFF040060,0xFF060053,0xFF0A0047,0xFF0B0042,0xFF0A0044,
+   0xFF060053,0xFF020062,0xFF020068,0xFF04005D,0xFF090044,0xFF0F002A,0xFF13001C,
+   0xFF0C002E,0xFF01006D,0xFF040054,0xFF180006,0xFF1C0000,0xFF1A0000,0xFF1A0000,
+   0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF190000,0xFF190000,0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF160016,0xFF03004D,0xFF050092,0xFF0A00B3,
+   0xFF0800AA,0xFF010068,0xFF120021,0xFF210000,0xFF210000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF260000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,
+   0xFF280000,0xFF290000,0xFF2D0000,0xFF310000,0xFF310000,0xFF310000,0xFF310000,
+   0xFF310000,0xFF2B0008,0xFF140034,0xFF020076,0xFF0E004B,0xFF2E0003,0xFF2B0000,
+   0xFF270000,0xFF250000,0xFF240000,0xFF250000,0xFF290004,0xFF16004B,0xFF120051,
+   0xFF020070,0xFF010071,0xFF030067,0xFF05005C,0xFF080050,0xFF0B004C,0xFF0D0049,
+   0xFF0F0044,0xFF11003E,0xFF160030,0xFF1D001D,0xFF22000F,0xFF230009,0xFF240004,
+   0xFF250003,0xFF240005,0xFF21000C,0xFF1E0015,0xFF1B0022,0xFF140039,0xFF09005B,
+   0xFF010074,0xFF02007B,0xFF030086,0xFF0700A5,0xFF030075,0xFF0F001E,0xFF1A0000,
+   0xFF190001,0xFF190001,0xFF190000,0xFF1A0000,0xFF190001,0xFF180004,0xFF190002,
+   0xFF1A0000,0xFF1A0000,0xFF190002,0xFF190002,0xFF190001,0xFF190001,0xFF1A0001,
+   0xFF1B0000,0xFF1D0000,0xFF1F0000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF1D0006,0xFF110029,0xFF03005E,0xFF03008B,
+   0xFF0900AD,0xFF0A00B1,0xFF0A00B2,0xFF040091,0xFF030049,0xFF16000F,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF250000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF280000,0xFF280000,0xFF2A0000,0xFF2D0000,0xFF300000,0xFF300000,
+   0xFF300000,0xFF300000,0xFF300000,0xFF2A0006,0xFF130033,0xFF020076,0xFF0E004B,
+   0xFF2E0003,0xFF2B0000,0xFF280000,0xFF260000,0xFF260000,0xFF260000,0xFF2B0004,
+   0xFF170049,0xFF13004F,0xFF02006C,0xFF01006D,0xFF020062,0xFF050057,0xFF09004A,
+   0xFF0C0046,0xFF0E0043,0xFF10003D,0xFF130036,0xFF180029,0xFF1F001A,0xFF26000D,
+   0xFF270007,0xFF280004,0xFF280003,0xFF290004,0xFF270009,0xFF240011,0xFF20001D,
+   0xFF180030,0xFF0A004E,0xFF010064,0xFF01006B,0xFF02007A,0xFF05009F,0xFF020064,
+   0xFF110012,0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF180000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF1A0000,0xFF1C0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1B0004,0xFF100021,
+   0xFF030058,0xFF04008E,0xFF0900AF,0xFF0A00B3,0xFF0A00B3,0xFF04008F,0xFF04004C,
+   0xFF190011,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF240000,0xFF260000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF290000,0xFF290000,0xFF2B0000,0xFF2F0000,
+   0xFF310000,0xFF310000,0xFF310000,0xFF2A0009,0xFF1E001F,0xFF130042,0xFF0D005E,
+   0xFF04007B,0xFF1C0020,0xFF310000,0xFF300000,0xFF2D0000,0xFF280000,0xFF250000,
+   0xFF240000,0xFF220012,0xFF0C006A,0xFF06006A,0xFF12003D,0xFF200021,0xFF260015,
+   0xFF28000D,0xFF2A0006,0xFF2B0004,0xFF2B0003,0xFF2A0001,0xFF260000,0xFF230000,
+   0xFF210000,0xFF1F0000,0xFF1D0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF1A0001,
+   0xFF1B0001,0xFF1D0000,0xFF200000,0xFF220006,0xFF15002B,0xFF030064,0xFF050093,
+   0xFF0B00B4,0xFF040087,0xFF070037,0xFF180003,0xFF190000,0xFF190000,0xFF1A0000,
+   0xFF1A0000,0xFF190002,0xFF180004,0xFF190003,0xFF190001,0xFF190002,0xFF180005,
+   0xFF180005,0xFF190002,0xFF190002,0xFF190001,0xFF1A0000,0xFF1C0000,0xFF1D0000,
+   0xFF1D0000,0xFF1F0000,0xFF210000,0xFF220000,0xFF220000,0xFF1F0003,0xFF15001D,
+   0xFF070047,0xFF000061,0xFF010066,0xFF020063,0xFF020062,0xFF020069,0xFF020073,
+   0xFF030085,0xFF010073,0xFF06003D,0xFF190008,0xFF1E0000,0xFF1E0000,0xFF1F0000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF250000,0xFF280000,0xFF290000,0xFF290000,0xFF2A0000,0xFF2A0000,
+   0xFF2B0000,0xFF2F0000,0xFF300000,0xFF310000,0xFF300000,0xFF2A0006,0xFF1D001B,
+   0xFF12003E,0xFF0D005E,0xFF04007B,0xFF1C0020,0xFF310000,0xFF300000,0xFF2D0000,
+   0xFF2A0000,0xFF270000,0xFF260000,0xFF240011,0xFF0C0066,0xFF060065,0xFF130039,
+   0xFF22001E,0xFF280014,0xFF2A000C,0xFF2D0006,0xFF2E0003,0xFF2E0002,0xFF2D0001,
+   0xFF2A0000,0xFF280000,0xFF260000,0xFF240000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF210000,0xFF220000,0xFF230000,0xFF250000,0xFF280000,0xFF290004,0xFF1A0021,
+   0xFF040052,0xFF030088,0xFF0800AE,0xFF030079,0xFF090022,0xFF1B0001,0xFF1B0000,
+   0xFF1A0000,0xFF190000,0xFF190000,0xFF190000,0xFF180000,0xFF180000,0xFF190000,
+   0xFF190000,0xFF180000,0xFF180000,0xFF180000,0xFF190000,0xFF190000,0xFF190000,
+   0xFF180000,0xFF180000,0xFF190000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,
+   0xFF1C0002,0xFF130018,0xFF060042,0xFF000067,0xFF010078,0xFF020075,0xFF020074,
+   0xFF020079,0xFF030083,0xFF040092,0xFF01007A,0xFF070043,0xFF1C0009,0xFF210000,
+   0xFF200000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF240000,0xFF260000,0xFF290000,0xFF2A0000,0xFF2A0000,
+   0xFF2B0000,0xFF2B0000,0xFF2D0000,0xFF300000,0xFF310000,0xFF320000,0xFF320000,
+   0xFF190033,0xFF2E0016,0xFF38000C,0xFF3D0006,0xFF1E0040,0xFF16002A,0xFF2F0000,
+   0xFF300000,0xFF2D0001,0xFF27000C,0xFF1C0026,0xFF10003E,0xFF0E0042,0xFF1C002A,
+   0xFF2A000D,0xFF2F0001,0xFF2D0000,0xFF290000,0xFF260000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF220000,0xFF1F0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,
+   0xFF190000,0xFF190001,0xFF180002,0xFF180004,0xFF170005,0xFF170005,0xFF170005,
+   0xFF180005,0xFF1F0002,0xFF1A001C,0xFF050050,0xFF030085,0xFF06009C,0xFF020057,
+   0xFF110018,0xFF190002,0xFF190000,0xFF1A0000,0xFF1A0000,0xFF190002,0xFF180003,
+   0xFF180004,0xFF180003,0xFF170006,0xFF170008,0xFF170007,0xFF180004,0xFF190001,
+   0xFF1A0000,0xFF1A0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF200000,0xFF220000,
+   0xFF210001,0xFF190014,0xFF0A003B,0xFF010057,0xFF03004D,0xFF0D0034,0xFF17001F,
+   0xFF1C0017,0xFF1B0017,0xFF17001D,0xFF130026,0xFF09003B,0xFF030059,0xFF01006A,
+   0xFF070047,0xFF150014,0xFF1D0002,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF250000,0xFF280000,0xFF2A0000,
+   0xFF2A0000,0xFF2A0000,0xFF2A0000,0xFF2A0000,0xFF2D0000,0xFF300000,0xFF300001,
+   0xFF260007,0xFF16001F,0xFF17002E,0xFF2E0013,0xFF38000C,0xFF3D0006,0xFF1E0040,
+   0xFF16002A,0xFF2F0000,0xFF300000,0xFF2E0001,0xFF29000B,0xFF1E0025,0xFF11003A,
+   0xFF0F003D,0xFF1E0026,0xFF2D000B,0xFF330001,0xFF310000,0xFF2C0000,0xFF280000,
+   0xFF270000,0xFF260000,0xFF260000,0xFF250000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF280000,0xFF200014,0xFF07003E,0xFF020078,
+   0xFF040094,0xFF020041,0xFF13000B,0xFF1B0000,0xFF1A0000,0xFF190000,0xFF190000,
+   0xFF180000,0xFF180000,0xFF180000,0xFF190000,0xFF190000,0xFF180000,0xFF180000,
+   0xFF170000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF190000,0xFF1A0000,
+   0xFF1C0000,0xFF1D0000,0xFF1C0001,0xFF160011,0xFF090032,0xFF010056,0xFF03005C,
+   0xFF0D0044,0xFF170029,0xFF1D001E,0xFF1D001F,0xFF190025,0xFF15002E,0xFF0A0046,
+   0xFF030067,0xFF010077,0xFF09004D,0xFF170015,0xFF1F0002,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF260000,
+   0xFF290000,0xFF2B0000,0xFF2B0000,0xFF2B0000,0xFF2B0000,0xFF2B0000,0xFF2E0000,
+   0xFF310000,0xFF310001,0xFF27000A,0xFF190020,0xFF210021,0xFF350000,0xFF340000,
+   0xFF380000,0xFF21002F,0xFF050073,0xFF0F003D,0xFF12003A,0xFF0E0050,0xFF0A0064,
+   0xFF0F0052,0xFF1D0028,0xFF2B0009,0xFF2E0000,0xFF2A0000,0xFF270000,0xFF260000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF240000,0xFF230000,0xFF220000,0xFF200000,
+   0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF190001,0xFF180003,0xFF180002,
+   0xFF180004,0xFF170006,0xFF170006,0xFF170005,0xFF160007,0xFF160009,0xFF1C0003,
+   0xFF1E0010,0xFF0B003F,0xFF03007A,0xFF050089,0xFF030052,0xFF0A002C,0xFF120014,
+   0xFF16000A,0xFF170004,0xFF180002,0xFF180004,0xFF170005,0xFF170007,0xFF160009,
+   0xFF160009,0xFF160009,0xFF160008,0xFF180004,0xFF190002,0xFF1A0002,0xFF1A0003,
+   0xFF1A0005,0xFF190007,0xFF18000C,0xFF13001C,0xFF0A0040,0xFF020058,0xFF08003D,
+   0xFF14001D,0xFF1D000C,0xFF230001,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF240000,0xFF250005,0xFF200010,0xFF180027,0xFF080055,0xFF020064,0xFF090042,
+   0xFF12001D,0xFF18000E,0xFF1C0007,0xFF1F0003,0xFF200001,0xFF210000,0xFF220000,
+   0xFF240000,0xFF270000,0xFF2A0000,0xFF2A0000,0xFF2B0000,0xFF2A0000,0xFF290000,
+   0xFF270002,0xFF250007,0xFF1D0012,0xFF0F002A,0xFF050050,0xFF010071,0xFF1D002B,
+   0xFF350000,0xFF340000,0xFF380000,0xFF21002F,0xFF050073,0xFF0F003D,0xFF12003A,
+   0xFF0E004E,0xFF0A0061,0xFF10004E,0xFF1F0025,0xFF2E0008,0xFF310000,0xFF2E0000,
+   0xFF2B0000,0xFF2A0000,0xFF280000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF240000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF260000,0xFF25000B,0xFF0D0031,0xFF02006F,0xFF04007E,0xFF030039,
+   0xFF0B001A,0xFF12000D,0xFF150006,0xFF160002,0xFF170000,0xFF170000,0xFF170000,
+   0xFF170000,0xFF170000,0xFF170001,0xFF170001,0xFF170001,0xFF180001,0xFF180001,
+   0xFF190001,0xFF180001,0xFF170003,0xFF160005,0xFF14000A,0xFF110017,0xFF090037,
+   0xFF010052,0xFF080042,0xFF140025,0xFF1D0011,0xFF240002,0xFF230000,0xFF240000,
+   0xFF250000,0xFF260000,0xFF290000,0xFF2A0006,0xFF240013,0xFF1B002D,0xFF0A0060,
+   0xFF03006F,0xFF0A0048,0xFF15001F,0xFF1B000F,0xFF1E0008,0xFF210004,0xFF220002,
+   0xFF230000,0xFF240000,0xFF250000,0xFF280000,0xFF2B0000,0xFF2B0000,0xFF2C0000,
+   0xFF2B0000,0xFF2A0000,0xFF280003,0xFF260009,0xFF1E0017,0xFF100031,0xFF050057,
+   0xFF020076,0xFF060039,0xFF160024,0xFF1D001F,0xFF190027,0xFF07005A,0xFF0700A7,
+   0xFF0700A3,0xFF020073,0xFF0A0048,0xFF21001A,0xFF2E0004,0xFF2E0000,0xFF2A0000,
+   0xFF280000,0xFF280000,0xFF270000,0xFF260000,0xFF250000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF1E0000,0xFF1D0000,0xFF1D0000,
+   0xFF1B0000,0xFF190001,0xFF180003,0xFF180002,0xFF180004,0xFF170005,0xFF180004,
+   0xFF180004,0xFF170006,0xFF160008,0xFF160008,0xFF1A0003,0xFF200007,0xFF0E0035,
+   0xFF050089,0xFF08009F,0xFF03007E,0xFF03006D,0xFF050061,0xFF060056,0xFF08004B,
+   0xFF080044,0xFF08003E,0xFF08003C,0xFF070040,0xFF060046,0xFF050047,0xFF050046,
+   0xFF060041,0xFF06003E,0xFF06003B,0xFF06003E,0xFF050043,0xFF05004F,0xFF05006B,
+   0xFF04007C,0xFF010065,0xFF0C0031,0xFF1D0006,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1F0000,
+   0xFF230000,0xFF230009,0xFF0F0038,0xFF03006E,0xFF040082,0xFF050073,0xFF050059,
+   0xFF07004B,0xFF090049,0xFF0B0046,0xFF0D003C,0xFF0E0030,0xFF0F0028,0xFF110028,
+   0xFF13002A,0xFF14002A,0xFF11002A,0xFF0C0031,0xFF080039,0xFF040043,0xFF01004E,
+   0xFF020067,0xFF060083,0xFF04006E,0xFF05003E,0xFF160027,0xFF1D001F,0xFF190027,
+   0xFF07005A,0xFF0700A7,0xFF0700A3,0xFF020072,0xFF0B0046,0xFF220018,0xFF300003,
+   0xFF310000,0xFF2D0000,0xFF2C0000,0xFF2C0000,0xFF2B0000,0xFF2A0000,0xFF290000,
+   0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF240000,
+   0xFF280005,0xFF11002B,0xFF040080,0xFF070096,0xFF030071,0xFF030063,0xFF050057,
+   0xFF050049,0xFF07003F,0xFF080035,0xFF08002E,0xFF08002A,0xFF07002B,0xFF07002F,
+   0xFF060031,0xFF050030,0xFF06002C,0xFF06002B,0xFF06002B,0xFF05002F,0xFF050039,
+   0xFF040048,0xFF050064,0xFF030077,0xFF01006B,0xFF0C003D,0xFF1E0009,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF220000,0xFF250000,0xFF290000,0xFF27000B,0xFF110041,0xFF04007D,0xFF05008C,
+   0xFF050072,0xFF050059,0xFF07004B,0xFF090048,0xFF0C0046,0xFF0D0040,0xFF0E0036,
+   0xFF10002F,0xFF11002E,0xFF14002F,0xFF14002F,0xFF110030,0xFF0D0038,0xFF08003F,
+   0xFF040049,0xFF010053,0xFF020068,0xFF050082,0xFF040072,0xFF1C0019,0xFF180024,
+   0xFF110035,0xFF07004B,0xFF020059,0xFF02006F,0xFF05008C,0xFF010059,0xFF170018,
+   0xFF2A0000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF270000,0xFF260000,
+   0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1A0000,0xFF190000,0xFF190000,
+   0xFF190001,0xFF180002,0xFF190002,0xFF190001,0xFF180001,0xFF180004,0xFF170004,
+   0xFF180003,0xFF190002,0xFF200000,0xFF170024,0xFF020075,0xFF060071,0xFF110042,
+   0xFF1B002C,0xFF1F0029,0xFF1E0034,0xFF16004E,0xFF09007B,0xFF07009F,0xFF0800A2,
+   0xFF060093,0xFF040074,0xFF05005C,0xFF06004D,0xFF060044,0xFF09003E,0xFF0B003E,
+   0xFF07004C,0xFF03006B,0xFF08009F,0xFF0900AA,0xFF030063,0xFF120020,0xFF1F0003,
+   0xFF1E0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1B0000,0xFF1D0000,0xFF210002,
+   0xFF0B0029,0xFF050082,0xFF0B00B4,0xFF0A00B0,0xFF07009E,0xFF05008B,0xFF030081,
+   0xFF030075,0xFF08005E,0xFF0D0049,0xFF0F0041,0xFF0F003C,0xFF0E0037,0xFF11002D,
+   0xFF130027,0xFF160021,0xFF18001C,0xFF1A0017,0xFF1C0014,0xFF200012,0xFF230012,
+   0xFF1E001D,0xFF18002A,0xFF12003A,0xFF08004C,0xFF020059,0xFF02006F,0xFF05008B,
+   0xFF010057,0xFF180017,0xFF2C0000,0xFF2B0000,0xFF2B0000,0xFF2B0000,0xFF2B0000,
+   0xFF2A0000,0xFF2A0000,0xFF290000,0xFF280000,0xFF270000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF280000,0xFF1B001C,0xFF01006B,
+   0xFF050069,0xFF12003E,0xFF1C002B,0xFF200028,0xFF1E0032,0xFF160049,0xFF080073,
+   0xFF070095,0xFF070095,0xFF050083,0xFF030063,0xFF05004B,0xFF06003C,0xFF080033,
+   0xFF0B0030,0xFF0B0035,0xFF070048,0xFF03006B,0xFF0800A1,0xFF0B00B2,0xFF040079,
+   0xFF11002E,0xFF1F0005,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF210000,0xFF260002,0xFF0E002F,0xFF060090,0xFF0A00B3,0xFF0900AC,0xFF07009B,
+   0xFF040087,0xFF03007D,0xFF030071,0xFF08005D,0xFF0C004A,0xFF0F0043,0xFF0F003E,
+   0xFF0E003A,0xFF10002F,0xFF130028,0xFF160021,0xFF17001C,0xFF190017,0xFF1B0012,
+   0xFF1F0011,0xFF220010,0xFF2F0000,0xFF300000,0xFF330000,0xFF310006,0xFF2A0010,
+   0xFF1B0020,0xFF070048,0xFF01006E,0xFF090035,0xFF230004,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1B0000,
+   0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1D0000,
+   0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1B0000,0xFF1D0000,0xFF200000,0xFF210008,
+   0xFF070050,0xFF060053,0xFF200016,0xFF2A0001,0xFF280000,0xFF270000,0xFF290000,
+   0xFF2F0000,0xFF25001B,0xFF08007F,0xFF0800A2,0xFF06004F,0xFF10001B,0xFF16000A,
+   0xFF160007,0xFF170006,0xFF1A0003,0xFF200001,0xFF270005,0xFF1F0017,0xFF080062,
+   0xFF060095,0xFF08003E,0xFF1E0003,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,
+   0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF1B0000,0xFF1A0000,
+   0xFF1B0000,0xFF1C0000,0xFF1A0000,0xFF1F0000,0xFF0E001E,0xFF030072,0xFF0A00B0,
+   0xFF050088,0xFF020056,0xFF06003D,0xFF10002A,0xFF1E0013,0xFF240006,0xFF250001,
+   0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF280000,0xFF2C0000,0xFF2F0000,0xFF320000,0xFF340001,
+   0xFF320006,0xFF2B0010,0xFF1B0020,0xFF070047,0xFF01006B,0xFF090032,0xFF250003,
+   0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF280000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF250000,
+   0xFF270000,0xFF270006,0xFF080044,0xFF070049,0xFF230012,0xFF2D0001,0xFF2A0000,
+   0xFF290000,0xFF2B0000,0xFF300000,0xFF26001A,0xFF08007C,0xFF08009F,0xFF06004B,
+   0xFF110018,0xFF180006,0xFF1A0002,0xFF1B0001,0xFF1E0000,0xFF220001,0xFF260005,
+   0xFF1E0018,0xFF080064,0xFF0700A3,0xFF080052,0xFF1F0006,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF250000,0xFF120023,
+   0xFF04007E,0xFF0900AE,0xFF040081,0xFF02004C,0xFF060032,0xFF100021,0xFF1E000F,
+   0xFF250005,0xFF250001,0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF270000,0xFF2B0000,0xFF280000,
+   0xFF280000,0xFF280000,0xFF2A0000,0xFF2D0000,0xFF340000,0xFF2C0010,0xFF070050,
+   0xFF00005C,0xFF14001D,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1B0000,0xFF1C0000,
+   0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF200000,0xFF1E0000,
+   0xFF1F0000,0xFF200000,0xFF220000,0xFF170024,0xFF020062,0xFF1B001C,0xFF270000,
+   0xFF230000,0xFF220000,0xFF230000,0xFF220000,0xFF230000,0xFF2C0000,0xFF130041,
+   0xFF040064,0xFF14000D,0xFF180005,0xFF180005,0xFF180005,0xFF170006,0xFF180005,
+   0xFF1C0000,0xFF220000,0xFF2B0000,0xFF20001B,0xFF04006E,0xFF0A0035,0xFF1F0002,
+   0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1B0000,
+   0xFF190000,0xFF190000,0xFF190000,0xFF1A0000,0xFF1C0000,0xFF1B0000,0xFF1A0000,
+   0xFF1E0002,0xFF090028,0xFF040080,0xFF05008C,0xFF08003A,0xFF1B0014,0xFF200006,
+   0xFF210001,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF240000,
+   0xFF280000,0xFF290000,0xFF290000,0xFF290000,0xFF2B0000,0xFF2F0000,0xFF350000,
+   0xFF2D000F,0xFF07004C,0xFF000058,0xFF16001A,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF260000,0xFF270000,0xFF2A0000,0xFF1C001D,0xFF020055,
+   0xFF1F0017,0xFF2B0000,0xFF270000,0xFF250000,0xFF250000,0xFF240000,0xFF250000,
+   0xFF2E0000,0xFF130040,0xFF040062,0xFF14000D,0xFF190002,0xFF1A0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF200000,0xFF280000,0xFF1F001C,0xFF05007B,
+   0xFF0A0046,0xFF200003,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF230002,0xFF0A002F,0xFF04008A,0xFF050085,0xFF08002D,
+   0xFF1B000D,0xFF210004,0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF230000,0xFF270000,0xFF280000,0xFF280000,0xFF280000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF320000,0xFF1D0022,0xFF000063,0xFF03004F,0xFF150019,
+   0xFF230002,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF220000,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,
+   0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1F0000,0xFF210000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF240001,
+   0xFF0C0045,0xFF0F003F,0xFF240001,0xFF230000,0xFF220000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF260000,0xFF19002A,0xFF08003F,0xFF180004,0xFF170006,
+   0xFF170006,0xFF170005,0xFF170006,0xFF180004,0xFF1B0001,0xFF1F0000,0xFF210000,
+   0xFF290002,0xFF0E0040,0xFF070034,0xFF1D0002,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1B0000,0xFF1A0000,0xFF190000,0xFF190000,
+   0xFF1B0000,0xFF1C0000,0xFF1B0000,0xFF1C0000,0xFF1C0007,0xFF03003A,0xFF060096,
+   0xFF03006B,0xFF150016,0xFF200000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF230000,0xFF270000,0xFF290000,0xFF290000,
+   0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF340000,0xFF1E001F,0xFF00005E,
+   0xFF030049,0xFF170016,0xFF260001,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF2A0001,0xFF0E003A,0xFF110035,0xFF290001,0xFF260000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF240000,0xFF240000,0xFF270000,0xFF1A002A,0xFF08003E,
+   0xFF170005,0xFF180004,0xFF1A0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF1C0000,
+   0xFF1D0000,0xFF1E0000,0xFF270002,0xFF0E004B,0xFF070047,0xFF1E0004,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF200009,
+   0xFF040044,0xFF06009A,0xFF03005E,0xFF16000F,0xFF210000,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF220000,0xFF260000,
+   0xFF280000,0xFF280000,0xFF280000,0xFF270000,0xFF270000,0xFF270000,0xFF2A0000,
+   0xFF2B000A,0xFF05004C,0xFF01007B,0xFF02005C,0xFF0C0034,0xFF1C000E,0xFF240000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF200000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF230009,0xFF080052,0xFF1C0018,0xFF240000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF140030,0xFF0B0032,0xFF180004,0xFF170006,0xFF170006,0xFF170005,0xFF170005,
+   0xFF170005,0xFF190002,0xFF1D0000,0xFF1F0000,0xFF250000,0xFF1D001D,0xFF03003A,
+   0xFF190006,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1D0000,
+   0xFF1F0000,0xFF120016,0xFF020059,0xFF0900AB,0xFF02006E,0xFF0F001E,0xFF1D0000,
+   0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF260000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,
+   0xFF290000,0xFF2C0000,0xFF2D0009,0xFF050047,0xFF000076,0xFF020055,0xFF0D002F,
+   0xFF1E000C,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF2A0007,0xFF0A0044,
+   0xFF210013,0xFF2A0000,0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF240000,0xFF250000,0xFF130030,0xFF0B0032,0xFF170005,0xFF170006,0xFF190002,
+   0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF190001,0xFF1B0000,0xFF1C0000,0xFF220000,
+   0xFF1C0024,0xFF03004F,0xFF1A000A,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF220000,0xFF15001B,0xFF010061,0xFF0800A9,0xFF020060,
+   0xFF100015,0xFF1E0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF250000,0xFF270000,0xFF280000,0xFF280000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF2B0003,0xFF0B003E,0xFF01007B,
+   0xFF030065,0xFF050064,0xFF050055,0xFF150021,0xFF230001,0xFF240000,0xFF220000,
+   0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF200000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210010,0xFF0A004D,0xFF200007,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF0F0039,0xFF0B0033,0xFF170005,
+   0xFF170007,0xFF170006,0xFF180005,0xFF170006,0xFF170007,0xFF180004,0xFF1B0000,
+   0xFF1E0000,0xFF200000,0xFF220012,0xFF040047,0xFF14000F,0xFF1D0000,0xFF1D0000,
+   0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF1A0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,
+   0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1E0000,0xFF1A0008,0xFF040032,0xFF050088,
+   0xFF0B00B6,0xFF040088,0xFF06003A,0xFF1B0005,0xFF1D0000,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF250000,0xFF280000,
+   0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF290000,0xFF280000,0xFF2D0003,
+   0xFF0C0039,0xFF010075,0xFF03005E,0xFF05005D,0xFF05004E,0xFF18001E,0xFF260001,
+   0xFF270000,0xFF260000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF280000,0xFF27000C,0xFF0D003F,0xFF270005,0xFF2A0000,0xFF290000,
+   0xFF270000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,0xFF230000,0xFF0F0039,
+   0xFF0B0032,0xFF170005,0xFF170007,0xFF190003,0xFF1B0000,0xFF1A0000,0xFF190002,
+   0xFF180004,0xFF190001,0xFF1C0000,0xFF1E0000,0xFF200014,0xFF040056,0xFF140016,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF1D000B,
+   0xFF05003E,0xFF04008B,0xFF0A00B3,0xFF03007F,0xFF06002C,0xFF1C0003,0xFF1E0000,
+   0xFF1E0000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF230000,0xFF270001,0xFF0D003A,0xFF0F004D,0xFF270010,0xFF2B000E,0xFF220028,
+   0xFF0B0051,0xFF0E003B,0xFF1D000D,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF210000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF170025,0xFF0A004F,0xFF220003,
+   0xFF220000,0xFF220000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF0C0041,0xFF0A0037,0xFF160007,0xFF170007,0xFF170006,0xFF170005,
+   0xFF170006,0xFF170007,0xFF170007,0xFF180004,0xFF1B0000,0xFF1D0000,0xFF240006,
+   0xFF090049,0xFF0B0020,0xFF1D0000,0xFF1D0000,0xFF1B0000,0xFF1A0000,0xFF1B0000,
+   0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1C0000,0xFF1C0000,
+   0xFF1F0000,0xFF0E001B,0xFF020061,0xFF0900AE,0xFF0900AC,0xFF050094,0xFF01005E,
+   0xFF110020,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF230000,0xFF250000,0xFF250000,0xFF260000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF250000,0xFF2A0001,0xFF0E0036,0xFF100049,0xFF29000E,
+   0xFF2E000C,0xFF250026,0xFF0C004B,0xFF100037,0xFF20000B,0xFF250000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF290000,0xFF1C001D,
+   0xFF0C0042,0xFF280002,0xFF290000,0xFF290000,0xFF270000,0xFF260000,0xFF260000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF0C003F,0xFF0B0032,0xFF180004,0xFF170006,
+   0xFF180004,0xFF190001,0xFF1A0000,0xFF190002,0xFF170006,0xFF190002,0xFF1B0000,
+   0xFF1C0000,0xFF240006,0xFF090051,0xFF0C002B,0xFF1D0000,0xFF1D0000,0xFF1C0000,
+   0xFF1C0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF1E0000,0xFF210000,0xFF0F0024,0xFF01006C,0xFF0800AC,0xFF0800A9,
+   0xFF040090,0xFF010051,0xFF110018,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF250002,0xFF0A003D,
+   0xFF190028,0xFF270000,0xFF270000,0xFF2D0000,0xFF2D000D,0xFF100049,0xFF050063,
+   0xFF0D0037,0xFF150018,0xFF1B0009,0xFF1E0002,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF1F0008,0xFF08004F,0xFF0D0051,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF0B0046,0xFF090039,
+   0xFF160009,0xFF160008,0xFF170007,0xFF170007,0xFF170007,0xFF160009,0xFF16000A,
+   0xFF160008,0xFF180003,0xFF1A0000,0xFF220000,0xFF120037,0xFF05003A,0xFF1A0004,
+   0xFF1D0000,0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,
+   0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF17000D,0xFF04004D,0xFF050092,
+   0xFF0700A3,0xFF02006E,0xFF070048,0xFF070052,0xFF03005A,0xFF120022,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF250000,0xFF260000,0xFF270000,0xFF260000,0xFF250000,
+   0xFF280002,0xFF0C003D,0xFF1B0027,0xFF2A0000,0xFF2A0000,0xFF300000,0xFF30000B,
+   0xFF110044,0xFF05005D,0xFF0E0030,0xFF180014,0xFF1F0007,0xFF230001,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF250005,0xFF090042,0xFF0E0049,0xFF280000,0xFF280000,
+   0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF0C0044,0xFF0A0033,0xFF180002,0xFF180004,0xFF180003,0xFF190001,0xFF1A0000,
+   0xFF190001,0xFF170006,0xFF180003,0xFF190001,0xFF1A0000,0xFF220000,0xFF130039,
+   0xFF050044,0xFF1A0005,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF190011,
+   0xFF040057,0xFF040094,0xFF06009F,0xFF02006A,0xFF070044,0xFF07004C,0xFF03004F,
+   0xFF13001C,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF20000B,0xFF070046,0xFF1D0013,0xFF230000,0xFF240000,
+   0xFF240000,0xFF290000,0xFF2D0006,0xFF0E0048,0xFF01007E,0xFF020068,0xFF04004E,
+   0xFF08003B,0xFF0D002E,0xFF110023,0xFF14001C,0xFF170013,0xFF1D0007,0xFF210001,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF200004,0xFF0D0031,0xFF03007B,0xFF09005B,
+   0xFF200004,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF0C0047,0xFF08003C,0xFF170007,0xFF170008,0xFF170007,
+   0xFF170007,0xFF160008,0xFF16000A,0xFF15000B,0xFF15000A,0xFF170006,0xFF180002,
+   0xFF1D0000,0xFF200014,0xFF040052,0xFF0C0025,0xFF1B0001,0xFF1B0000,0xFF1C0000,
+   0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1C0000,0xFF1B0000,0xFF1B0000,0xFF1C0000,
+   0xFF140011,0xFF070048,0xFF0C0066,0xFF0C004C,0xFF05005F,0xFF07004D,0xFF220007,
+   0xFF260007,0xFF21001F,0xFF0F0047,0xFF11002D,0xFF1E0003,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF22000D,0xFF070048,0xFF1F0012,
+   0xFF260000,0xFF270000,0xFF270000,0xFF2C0000,0xFF310005,0xFF0F0042,0xFF010076,
+   0xFF020060,0xFF040044,0xFF0A0032,0xFF100026,0xFF14001E,0xFF170017,0xFF1B000F,
+   0xFF210006,0xFF250000,0xFF260000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF250003,0xFF100027,
+   0xFF02006F,0xFF090052,0xFF250002,0xFF280000,0xFF260000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF0C0045,0xFF090037,0xFF190001,
+   0xFF190002,0xFF190002,0xFF1A0000,0xFF1A0000,0xFF190001,0xFF180004,0xFF170006,
+   0xFF180003,0xFF190000,0xFF1D0000,0xFF200014,0xFF050058,0xFF0D002C,0xFF1D0001,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF160015,0xFF070051,0xFF0C0068,0xFF0D0047,0xFF050059,
+   0xFF080049,0xFF240006,0xFF280006,0xFF22001C,0xFF10003E,0xFF120026,0xFF1F0002,
+   0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF17001E,
+   0xFF0A0050,0xFF210007,0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF260000,
+   0xFF110030,0xFF03008A,0xFF0900AC,0xFF050096,0xFF010080,0xFF00006C,0xFF00005E,
+   0xFF00005A,0xFF010057,0xFF050048,0xFF0D002E,0xFF160018,0xFF190012,0xFF180013,
+   0xFF180013,0xFF180013,0xFF190012,0xFF1A0010,0xFF1A0011,0xFF190014,0xFF180018,
+   0xFF0D0034,0xFF02006C,0xFF07009F,0xFF04005D,0xFF1C000B,0xFF230000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF0C0046,
+   0xFF08003F,0xFF170006,0xFF170007,0xFF160007,0xFF160008,0xFF16000A,0xFF16000B,
+   0xFF15000B,0xFF15000A,0xFF160009,0xFF170006,0xFF190001,0xFF210000,0xFF16002D,
+   0xFF01005C,0xFF0C0023,0xFF180002,0xFF1B0000,0xFF1B0000,0xFF1A0000,0xFF190000,
+   0xFF190000,0xFF1A0000,0xFF190001,0xFF10001B,0xFF070048,0xFF18002C,0xFF240007,
+   0xFF270002,0xFF220017,0xFF080054,0xFF1A000E,0xFF210000,0xFF270000,0xFF2A0008,
+   0xFF17003A,0xFF0D003A,0xFF1E0009,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF260000,0xFF190021,0xFF0A0052,0xFF230006,0xFF240000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF2A0000,0xFF13002A,0xFF030084,0xFF0700A8,0xFF040090,0xFF010077,
+   0xFF000062,0xFF000053,0xFF00004E,0xFF01004B,0xFF06003F,0xFF0E0028,0xFF180015,
+   0xFF1C000F,0xFF1C000F,0xFF1C000F,0xFF1C000F,0xFF1C000F,0xFF1E000E,0xFF1D000F,
+   0xFF1C0011,0xFF1B0014,0xFF0F002C,0xFF010060,0xFF050098,0xFF040051,0xFF200008,
+   0xFF280000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF0D0043,0xFF08003A,0xFF190000,0xFF190000,0xFF190000,0xFF1A0000,
+   0xFF1B0000,0xFF1A0001,0xFF180004,0xFF170006,0xFF170005,0xFF180003,0xFF190001,
+   0xFF210000,0xFF17002A,0xFF010060,0xFF0E002A,0xFF1B0003,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF1F0002,0xFF13001E,0xFF07004E,
+   0xFF1A002E,0xFF270007,0xFF2A0001,0xFF240015,0xFF090050,0xFF1C000D,0xFF240000,
+   0xFF290000,0xFF2C0007,0xFF180035,0xFF0E0032,0xFF1E0006,0xFF220000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF200006,0xFF08004F,0xFF100051,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF190021,0xFF030065,0xFF01007D,0xFF020073,
+   0xFF020066,0xFF04005B,0xFF06004F,0xFF090046,0xFF06004B,0xFF01005F,0xFF000075,
+   0xFF010078,0xFF020067,0xFF02005F,0xFF020064,0xFF020067,0xFF010065,0xFF010060,
+   0xFF03005B,0xFF04005A,0xFF04005B,0xFF02005D,0xFF000065,0xFF02007E,0xFF06009A,
+   0xFF020064,0xFF170014,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF0D0044,0xFF080043,0xFF170005,0xFF170007,
+   0xFF170007,0xFF170008,0xFF16000A,0xFF16000B,0xFF160009,0xFF150009,0xFF160008,
+   0xFF160007,0xFF180003,0xFF190001,0xFF210005,0xFF0C0045,0xFF000061,0xFF090029,
+   0xFF160005,0xFF190000,0xFF180000,0xFF170000,0xFF170002,0xFF110012,0xFF080039,
+   0xFF04005D,0xFF170024,0xFF1D0001,0xFF1B0000,0xFF1D0000,0xFF270000,0xFF10004B,
+   0xFF110030,0xFF200000,0xFF200000,0xFF230000,0xFF2B0004,0xFF1B0034,0xFF0B0047,
+   0xFF1C000D,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF220007,0xFF080054,0xFF110051,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF1B001E,0xFF03005E,
+   0xFF010078,0xFF02006D,0xFF02005E,0xFF040052,0xFF070046,0xFF0A003D,0xFF070041,
+   0xFF010055,0xFF00006D,0xFF010072,0xFF020060,0xFF020056,0xFF020059,0xFF02005B,
+   0xFF01005B,0xFF020057,0xFF040053,0xFF050052,0xFF040052,0xFF030054,0xFF000059,
+   0xFF010072,0xFF040091,0xFF020059,0xFF1B0010,0xFF260000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF0D003F,0xFF09003D,
+   0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1A0000,0xFF180002,
+   0xFF170005,0xFF170004,0xFF180003,0xFF180001,0xFF1A0000,0xFF240004,0xFF0D0041,
+   0xFF000066,0xFF0B002F,0xFF1B0005,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0002,
+   0xFF170012,0xFF0A0037,0xFF05005A,0xFF190023,0xFF200001,0xFF1F0000,0xFF210000,
+   0xFF2A0000,0xFF100047,0xFF12002E,0xFF220000,0xFF220000,0xFF250000,0xFF2D0003,
+   0xFF1C0030,0xFF0B003F,0xFF1C000A,0xFF230000,0xFF220000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210004,0xFF0C002C,
+   0xFF03007B,0xFF0B0046,0xFF1F0007,0xFF200005,0xFF1D000B,0xFF190013,0xFF11002A,
+   0xFF09004F,0xFF0D0049,0xFF15002E,0xFF1C001F,0xFF220016,0xFF26000E,0xFF280009,
+   0xFF2A0005,0xFF2B000A,0xFF1D0023,0xFF05004F,0xFF030087,0xFF0800AC,0xFF0900AB,
+   0xFF04008F,0xFF010068,0xFF0D0044,0xFF1D0024,0xFF240017,0xFF260014,0xFF260012,
+   0xFF250015,0xFF1E0021,0xFF120036,0xFF040058,0xFF00006F,0xFF100030,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF0D003F,0xFF080048,0xFF170005,0xFF170006,0xFF170006,0xFF170007,0xFF170007,
+   0xFF160008,0xFF160007,0xFF160007,0xFF160008,0xFF160008,0xFF170007,0xFF170005,
+   0xFF1B0002,0xFF1E0011,0xFF05005C,0xFF01006E,0xFF060042,0xFF0B002C,0xFF0C0027,
+   0xFF0A002D,0xFF06003D,0xFF06004E,0xFF0C006A,0xFF0D005A,0xFF120031,0xFF130028,
+   0xFF130023,0xFF140025,0xFF170025,0xFF09005F,0xFF0C004C,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF220000,0xFF2C0002,0xFF150047,0xFF050059,0xFF16001A,0xFF200001,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF220005,0xFF0D0033,0xFF02007D,0xFF0C0043,0xFF210006,0xFF230005,0xFF20000A,
+   0xFF1B0010,0xFF130026,0xFF0A0049,0xFF0E0044,0xFF16002B,0xFF1E001C,0xFF240013,
+   0xFF29000C,0xFF2C0007,0xFF2E0004,0xFF2E0008,0xFF1F001E,0xFF060048,0xFF020083,
+   0xFF0700A9,0xFF0700A5,0xFF020086,0xFF01005C,0xFF0F003B,0xFF200020,0xFF270014,
+   0xFF290012,0xFF2A0010,0xFF280012,0xFF21001B,0xFF15002B,0xFF050049,0xFF000063,
+   0xFF12002A,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF0E0038,0xFF0A0041,0xFF1C0000,0xFF1C0000,0xFF1C0000,
+   0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF180001,0xFF170004,0xFF170004,0xFF170004,
+   0xFF180003,0xFF190001,0xFF1F0000,0xFF22000F,0xFF050052,0xFF00006B,0xFF08003F,
+   0xFF0F002A,0xFF100026,0xFF0E002C,0xFF09003B,0xFF070049,0xFF0C0063,0xFF0E0053,
+   0xFF13002D,0xFF150025,0xFF160020,0xFF170023,0xFF190023,0xFF0A005A,0xFF0D0049,
+   0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF2D0002,0xFF150043,0xFF06004E,
+   0xFF170014,0xFF210001,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF200002,0xFF0E0022,0xFF020067,0xFF05009B,0xFF020074,0xFF070061,
+   0xFF09004C,0xFF090043,0xFF11002F,0xFF1E001A,0xFF25000B,0xFF290002,0xFF290000,
+   0xFF270000,0xFF250000,0xFF240000,0xFF230000,0xFF220000,0xFF250000,0xFF2D0000,
+   0xFF250016,0xFF050050,0xFF050096,0xFF060099,0xFF030057,0xFF170022,0xFF260004,
+   0xFF260000,0xFF240000,0xFF230000,0xFF220000,0xFF240000,0xFF260000,0xFF290001,
+   0xFF260011,0xFF0F0041,0xFF04005B,0xFF180013,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF220000,0xFF210000,0xFF0D003A,0xFF090050,0xFF180003,
+   0xFF180003,0xFF180003,0xFF180004,0xFF180003,0xFF170005,0xFF170006,0xFF170006,
+   0xFF160007,0xFF160008,0xFF160007,0xFF160007,0xFF170006,0xFF1F0001,0xFF170028,
+   0xFF030075,0xFF06009C,0xFF030089,0xFF03006F,0xFF0C0050,0xFF16002E,0xFF1E0013,
+   0xFF210009,0xFF210006,0xFF200007,0xFF200008,0xFF20000A,0xFF210013,0xFF200025,
+   0xFF0B0063,0xFF06006A,0xFF1A000B,0xFF200000,0xFF200000,0xFF200000,0xFF210005,
+   0xFF0F003F,0xFF00007F,0xFF020061,0xFF120024,0xFF200001,0xFF210000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF230000,0xFF210004,0xFF0F002B,0xFF02006D,0xFF050099,
+   0xFF020070,0xFF07005D,0xFF090047,0xFF0A003D,0xFF13002A,0xFF200017,0xFF280009,
+   0xFF2B0002,0xFF2B0000,0xFF2A0000,0xFF280000,0xFF270000,0xFF260000,0xFF260000,
+   0xFF280000,0xFF300000,0xFF260014,0xFF05004B,0xFF040091,0xFF040092,0xFF04004C,
+   0xFF1A001C,0xFF2B0003,0xFF2B0000,0xFF290000,0xFF280000,0xFF280000,0xFF2A0000,
+   0xFF2C0000,0xFF300001,0xFF2C000C,0xFF110036,0xFF05004E,0xFF1D000F,0xFF270000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF0F0035,
+   0xFF0A0049,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1A0000,
+   0xFF180001,0xFF170003,0xFF170005,0xFF170004,0xFF190001,0xFF1A0000,0xFF1C0000,
+   0xFF240000,0xFF1A0021,0xFF020068,0xFF050092,0xFF020080,0xFF030069,0xFF0F004E,
+   0xFF1A002C,0xFF240010,0xFF260008,0xFF250005,0xFF230007,0xFF220007,0xFF230009,
+   0xFF230012,0xFF210024,0xFF0B005F,0xFF060066,0xFF1D000A,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220005,0xFF10003D,0xFF00007A,0xFF020056,0xFF13001D,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF1D0007,0xFF0C002F,0xFF01005D,
+   0xFF010070,0xFF020067,0xFF040053,0xFF0D003C,0xFF1A0021,0xFF24000D,0xFF260002,
+   0xFF240000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF2D0000,0xFF1D0022,0xFF010066,
+   0xFF020074,0xFF150021,0xFF230000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1D0000,
+   0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF240000,0xFF29000A,0xFF080071,
+   0xFF060058,0xFF1A000E,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF0D0039,0xFF080059,0xFF190002,0xFF190000,0xFF190001,0xFF190001,
+   0xFF190000,0xFF180002,0xFF180002,0xFF180002,0xFF180003,0xFF170004,0xFF170004,
+   0xFF170005,0xFF170006,0xFF180005,0xFF210005,0xFF0C0047,0xFF040090,0xFF03006F,
+   0xFF140026,0xFF1C0005,0xFF1A0003,0xFF180003,0xFF180003,0xFF190001,0xFF1B0000,
+   0xFF1D0000,0xFF1E0000,0xFF200000,0xFF270000,0xFF12003B,0xFF020082,0xFF09004A,
+   0xFF120027,0xFF130026,0xFF0F003C,0xFF070060,0xFF01007D,0xFF020091,0xFF020088,
+   0xFF02006B,0xFF0F002E,0xFF1E0005,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF1D000A,
+   0xFF0C0037,0xFF010064,0xFF010070,0xFF020065,0xFF040050,0xFF0D0038,0xFF1C001E,
+   0xFF26000B,0xFF280001,0xFF270000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF2E0000,
+   0xFF1E001F,0xFF01005F,0xFF02006A,0xFF18001C,0xFF270000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF2C0000,
+   0xFF300008,0xFF090065,0xFF07004C,0xFF1F000B,0xFF270000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF240000,0xFF0E0034,0xFF090053,0xFF1C0001,0xFF1D0000,
+   0xFF1D0000,0xFF1C0000,0xFF1A0000,0xFF190001,0xFF180002,0xFF180002,0xFF180002,
+   0xFF180001,0xFF190000,0xFF1B0000,0xFF1C0000,0xFF1E0000,0xFF260003,0xFF0E003D,
+   0xFF020084,0xFF030060,0xFF18001E,0xFF240002,0xFF220000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF220000,0xFF290000,0xFF130038,
+   0xFF01007D,0xFF0A0045,0xFF130024,0xFF140023,0xFF0F0037,0xFF070057,0xFF010074,
+   0xFF020089,0xFF010080,0xFF020062,0xFF0F0028,0xFF1D0004,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF180017,0xFF060048,0xFF020055,0xFF0A003F,0xFF150026,0xFF1F0016,0xFF25000C,
+   0xFF280003,0xFF260000,0xFF230000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF2B0007,0xFF080049,0xFF05005E,0xFF1D0008,0xFF1F0000,
+   0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,
+   0xFF1D0000,0xFF1F0000,0xFF20000C,0xFF180049,0xFF050067,0xFF080040,0xFF1E0006,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF0D0039,0xFF070063,
+   0xFF180006,0xFF1A0000,0xFF190000,0xFF190000,0xFF1A0000,0xFF1A0000,0xFF1A0000,
+   0xFF1A0000,0xFF1A0000,0xFF190001,0xFF190001,0xFF180001,0xFF180003,0xFF170005,
+   0xFF1B0002,0xFF15002C,0xFF01007D,0xFF0E0038,0xFF180005,0xFF160008,0xFF160008,
+   0xFF170006,0xFF180004,0xFF190001,0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,
+   0xFF1F0007,0xFF080050,0xFF06009E,0xFF06009C,0xFF020086,0xFF010082,0xFF02007B,
+   0xFF070066,0xFF0E004F,0xFF110046,0xFF0F004B,0xFF090062,0xFF02006D,0xFF080049,
+   0xFF180012,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220001,0xFF18001C,0xFF060050,0xFF020058,0xFF0A003F,0xFF150026,
+   0xFF1F0016,0xFF26000B,0xFF290002,0xFF270000,0xFF250000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF2D0007,0xFF090041,0xFF050055,
+   0xFF210007,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF270000,0xFF270008,0xFF1B0041,0xFF05005C,
+   0xFF0A0036,0xFF240004,0xFF270000,0xFF260000,0xFF260000,0xFF240000,0xFF230000,
+   0xFF0E0036,0xFF07005F,0xFF1B0005,0xFF1C0000,0xFF1B0000,0xFF1A0000,0xFF190001,
+   0xFF180002,0xFF180002,0xFF180002,0xFF180001,0xFF190001,0xFF1A0000,0xFF1A0000,
+   0xFF1B0000,0xFF1C0000,0xFF210000,0xFF180026,0xFF010072,0xFF11002F,0xFF200001,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF200000,0xFF210006,0xFF09004C,0xFF050099,0xFF050096,0xFF01007D,
+   0xFF010076,0xFF02006C,0xFF080057,0xFF100042,0xFF13003A,0xFF11003F,0xFF0A0055,
+   0xFF020062,0xFF080042,0xFF180010,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF1B0007,0xFF0F002A,0xFF070045,0xFF160029,0xFF23000E,
+   0xFF280003,0xFF280000,0xFF270000,0xFF240000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF290000,
+   0xFF130035,0xFF070058,0xFF1D0004,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,
+   0xFF1C0000,0xFF1B0000,0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1D0004,0xFF1C000C,
+   0xFF2C0001,0xFF19002E,0xFF000064,0xFF0F0029,0xFF210001,0xFF220000,0xFF210000,
+   0xFF1F0000,0xFF200001,0xFF0B003E,0xFF04006F,0xFF140013,0xFF1A0000,0xFF1A0000,
+   0xFF1A0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF1B0000,0xFF1A0000,
+   0xFF1A0000,0xFF190000,0xFF190001,0xFF180002,0xFF1A0002,0xFF110039,0xFF060065,
+   0xFF17000B,0xFF160007,0xFF160007,0xFF170006,0xFF180004,0xFF190001,0xFF1A0000,
+   0xFF1B0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF12002F,0xFF020081,0xFF030091,
+   0xFF04007A,0xFF0D0055,0xFF180031,0xFF1E001A,0xFF230009,0xFF250002,0xFF260001,
+   0xFF280002,0xFF270007,0xFF20001F,0xFF0C0052,0xFF020060,0xFF0F002E,0xFF1D0006,
+   0xFF210000,0xFF220000,0xFF220000,0xFF210001,0xFF1B000B,0xFF0E0034,0xFF06004F,
+   0xFF15002C,0xFF23000E,0xFF280003,0xFF280000,0xFF270000,0xFF250000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF2C0000,0xFF15002E,0xFF08004F,0xFF220004,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF250002,0xFF230006,0xFF320001,0xFF1C0027,0xFF000057,0xFF130021,0xFF270000,
+   0xFF270000,0xFF250000,0xFF230000,0xFF220001,0xFF0C003C,0xFF04006E,0xFF150012,
+   0xFF1B0000,0xFF1A0001,0xFF190002,0xFF180002,0xFF170003,0xFF170003,0xFF180002,
+   0xFF180001,0xFF190000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1D0000,
+   0xFF120034,0xFF07005E,0xFF1D0008,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF13002B,
+   0xFF010077,0xFF020083,0xFF05006A,0xFF0F0049,0xFF1B002A,0xFF230014,0xFF270006,
+   0xFF290001,0xFF2A0000,0xFF2B0001,0xFF2B0005,0xFF240019,0xFF0D0047,0xFF020054,
+   0xFF0F0029,0xFF1E0005,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF030040,
+   0xFF060045,0xFF200010,0xFF280000,0xFF250000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF240000,0xFF1C0022,0xFF080056,0xFF1D0006,
+   0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,
+   0xFF1B0000,0xFF1D0002,0xFF19000D,0xFF1E0004,0xFF230000,0xFF2B0007,0xFF09004F,
+   0xFF010054,0xFF180011,0xFF220000,0xFF200000,0xFF1F0000,0xFF1E0006,0xFF07004B,
+   0xFF040087,0xFF070041,0xFF170008,0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF1B0000,0xFF1A0000,0xFF190000,
+   0xFF190000,0xFF18000C,0xFF070063,0xFF0E0035,0xFF180002,0xFF170006,0xFF170006,
+   0xFF170006,0xFF180002,0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF1D0000,0xFF1E0000,
+   0xFF17001A,0xFF040077,0xFF040077,0xFF0E0045,0xFF1C001A,0xFF210006,0xFF200004,
+   0xFF1E0006,0xFF1E0005,0xFF1E0005,0xFF1E0005,0xFF1E0005,0xFF1F0005,0xFF230002,
+   0xFF270008,0xFF150035,0xFF020060,0xFF06004F,0xFF120021,0xFF18000E,0xFF150013,
+   0xFF0C0024,0xFF03004A,0xFF05004F,0xFF1E0012,0xFF270000,0xFF240000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF280000,0xFF1E001D,
+   0xFF08004D,0xFF220006,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF250001,0xFF220007,0xFF260002,0xFF2A0000,
+   0xFF300005,0xFF0B0043,0xFF020046,0xFF1D000D,0xFF260000,0xFF240000,0xFF210000,
+   0xFF1F0006,0xFF070048,0xFF040086,0xFF070040,0xFF170008,0xFF190000,0xFF190002,
+   0xFF180002,0xFF180002,0xFF180002,0xFF180001,0xFF190000,0xFF1A0000,0xFF1A0000,
+   0xFF1B0000,0xFF1B0000,0xFF1B0000,0xFF1A000A,0xFF07005C,0xFF110030,0xFF1E0000,
+   0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF200000,0xFF190018,0xFF03006C,0xFF040068,0xFF110039,0xFF210013,
+   0xFF270002,0xFF250000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF280000,0xFF2C0005,0xFF18002A,0xFF020051,0xFF060046,0xFF13001C,
+   0xFF180009,0xFF15000D,0xFF0D0018,0xFF01005D,0xFF15001D,0xFF270000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1F0000,
+   0xFF200000,0xFF210013,0xFF070059,0xFF1B000E,0xFF1E0000,0xFF1D0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF180012,0xFF1B000B,
+   0xFF1F0000,0xFF200000,0xFF290000,0xFF150033,0xFF000065,0xFF0F0028,0xFF210000,
+   0xFF1F0000,0xFF1C0004,0xFF0F0023,0xFF030064,0xFF0900AA,0xFF030079,0xFF07003F,
+   0xFF15000F,0xFF1A0001,0xFF1B0000,0xFF1B0000,0xFF1A0000,0xFF1B0000,0xFF1C0000,
+   0xFF1C0000,0xFF1B0000,0xFF1B0000,0xFF190002,0xFF130015,0xFF08004E,0xFF04006C,
+   0xFF16000F,0xFF180001,0xFF180004,0xFF170005,0xFF170004,0xFF190001,0xFF1A0000,
+   0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1B000C,0xFF070061,0xFF0A0062,0xFF1B001B,
+   0xFF210005,0xFF1D0008,0xFF1A000C,0xFF1B000C,0xFF1C000A,0xFF1D0007,0xFF1D0007,
+   0xFF1D0007,0xFF1C0009,0xFF1C0009,0xFF1C000A,0xFF1F0005,0xFF270002,0xFF1E001C,
+   0xFF070050,0xFF000066,0xFF020059,0xFF02005C,0xFF020074,0xFF010066,0xFF14001E,
+   0xFF250000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF230000,0xFF240010,0xFF080050,0xFF1F000C,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF20000C,0xFF230007,0xFF270000,0xFF270000,0xFF2F0000,0xFF18002A,0xFF000058,
+   0xFF110021,0xFF250000,0xFF230000,0xFF1F0003,0xFF100020,0xFF030061,0xFF0900A8,
+   0xFF020077,0xFF07003F,0xFF140010,0xFF180003,0xFF180000,0xFF180000,0xFF190000,
+   0xFF190000,0xFF1A0000,0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1C0002,0xFF150014,
+   0xFF08004A,0xFF040066,0xFF19000C,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,
+   0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1C000C,0xFF07005A,
+   0xFF0B0056,0xFF200015,0xFF260001,0xFF230000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF240000,
+   0xFF2D0001,0xFF220014,0xFF08003F,0xFF000059,0xFF020050,0xFF020050,0xFF020066,
+   0xFF02004B,0xFF1B0010,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF250005,0xFF0C0051,
+   0xFF120028,0xFF1F0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,
+   0xFF1D0000,0xFF1C0009,0xFF17001A,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF250000,
+   0xFF170029,0xFF000070,0xFF04004B,0xFF11001D,0xFF11001C,0xFF080038,0xFF020060,
+   0xFF08009C,0xFF0C00B9,0xFF0900AC,0xFF02007F,0xFF03005A,0xFF09003D,0xFF0E0028,
+   0xFF11001D,0xFF120017,0xFF140013,0xFF140015,0xFF12001A,0xFF10001D,0xFF0D0029,
+   0xFF080040,0xFF020060,0xFF01007E,0xFF0A0044,0xFF190001,0xFF180002,0xFF180002,
+   0xFF180003,0xFF180002,0xFF1A0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1C0005,
+   0xFF0A004B,0xFF070063,0xFF1B0012,0xFF1D0007,0xFF1B000B,0xFF1A000D,0xFF1A000E,
+   0xFF1B000C,0xFF1C000A,0xFF1D0009,0xFF1D0007,0xFF1D0008,0xFF1B000C,0xFF1A000D,
+   0xFF1C000A,0xFF1C000A,0xFF1D0008,0xFF240002,0xFF25000D,0xFF100037,0xFF010061,
+   0xFF03008A,0xFF0700AA,0xFF02005B,0xFF1A0010,0xFF240000,0xFF240000,0xFF240000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF280004,0xFF0D0049,0xFF150024,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230006,0xFF1E0013,0xFF270000,0xFF270000,
+   0xFF270000,0xFF2C0000,0xFF1A0022,0xFF000065,0xFF040042,0xFF140019,0xFF130018,
+   0xFF090031,0xFF02005A,0xFF070099,0xFF0B00B7,0xFF0800A9,0xFF02007C,0xFF030058,
+   0xFF08003C,0xFF0E0027,0xFF10001D,0xFF120018,0xFF130013,0xFF130015,0xFF130019,
+   0xFF12001B,0xFF0F0025,0xFF08003C,0xFF02005E,0xFF000079,0xFF0C003E,0xFF1D0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1E0005,0xFF0B0048,0xFF080059,0xFF20000C,0xFF230000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF230000,0xFF2B0000,0xFF2B0008,
+   0xFF130028,0xFF020052,0xFF030085,0xFF0800AB,0xFF01005F,0xFF17001A,0xFF260000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0000,0xFF240000,0xFF1E0025,0xFF080051,0xFF1C0007,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF180017,0xFF1C000E,
+   0xFF200000,0xFF200000,0xFF210000,0xFF200007,0xFF0A003E,0xFF020086,0xFF02007F,
+   0xFF000058,0xFF00005B,0xFF02007A,0xFF05008D,0xFF060097,0xFF060097,0xFF060099,
+   0xFF040096,0xFF010087,0xFF000079,0xFF00006F,0xFF00006A,0xFF010067,0xFF020067,
+   0xFF020068,0xFF01006B,0xFF02006F,0xFF02007A,0xFF03008B,0xFF0700A2,0xFF020081,
+   0xFF100028,0xFF1A0000,0xFF190001,0xFF190001,0xFF190001,0xFF190000,0xFF1B0000,
+   0xFF1C0000,0xFF1C0000,0xFF1D0001,0xFF0E003E,0xFF05006C,0xFF18001C,0xFF1D0006,
+   0xFF1C000A,0xFF1B000C,0xFF1A000D,0xFF1A000E,0xFF1A000D,0xFF1B000C,0xFF1C000A,
+   0xFF1D0007,0xFF1D0008,0xFF1C000B,0xFF1A000D,0xFF1B000C,0xFF1C000B,0xFF1C000A,
+   0xFF1C0009,0xFF230002,0xFF2B0003,0xFF1D0020,0xFF050046,0xFF03007C,0xFF02006B,
+   0xFF16001B,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF260000,0xFF200022,0xFF09004B,
+   0xFF200006,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF250000,
+   0xFF1E0012,0xFF22000B,0xFF270000,0xFF270000,0xFF270000,0xFF250005,0xFF0C0034,
+   0xFF01007F,0xFF010078,0xFF00004E,0xFF000051,0xFF010071,0xFF040086,0xFF050091,
+   0xFF050091,0xFF050094,0xFF030091,0xFF010082,0xFF000073,0xFF00006B,0xFF000068,
+   0xFF010067,0xFF020066,0xFF020066,0xFF020069,0xFF02006D,0xFF020075,0xFF030088,
+   0xFF0600A0,0xFF02007C,0xFF120023,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0001,0xFF0E003B,0xFF060063,
+   0xFF1B0015,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF280000,0xFF310002,0xFF210016,0xFF07003C,
+   0xFF030076,0xFF000078,0xFF110037,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF200000,
+   0xFF260008,0xFF070057,0xFF0D0039,0xFF1E0002,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0005,0xFF16001E,0xFF210002,0xFF220000,0xFF210001,0xFF180017,
+   0xFF080048,0xFF00006B,0xFF01006A,0xFF030053,0xFF060044,0xFF070049,0xFF0A004C,
+   0xFF0A004A,0xFF0A0047,0xFF0C0045,0xFF0D0047,0xFF0C004C,0xFF0A0051,0xFF07005A,
+   0xFF040061,0xFF01006A,0xFF000075,0xFF010082,0xFF040092,0xFF0600A2,0xFF0900AD,
+   0xFF0A00B2,0xFF0B00B5,0xFF0B00B4,0xFF020080,0xFF0E002E,0xFF1E0000,0xFF1B0000,
+   0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF13002D,
+   0xFF030078,0xFF15002B,0xFF200002,0xFF1E0005,0xFF1D0008,0xFF1A000D,0xFF1A000E,
+   0xFF1A000F,0xFF1A000E,0xFF1A000C,0xFF1B000B,0xFF1C000A,0xFF1C000A,0xFF1C000A,
+   0xFF1B000B,0xFF1B000B,0xFF1C000A,0xFF1C0009,0xFF1E0005,0xFF200001,0xFF220000,
+   0xFF2A0000,0xFF250010,0xFF0A003D,0xFF000077,0xFF100039,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF270008,0xFF070052,0xFF0F0035,0xFF220001,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF240004,0xFF1C0017,0xFF270001,0xFF280000,
+   0xFF260001,0xFF1C0013,0xFF09003D,0xFF00005F,0xFF000060,0xFF04004A,0xFF08003A,
+   0xFF08003E,0xFF0B0042,0xFF0C0040,0xFF0D003D,0xFF0E003C,0xFF0F003E,0xFF0D0044,
+   0xFF0B004A,0xFF070052,0xFF04005B,0xFF010065,0xFF000072,0xFF010080,0xFF03008F,
+   0xFF0600A0,0xFF0900AC,0xFF0A00B2,0xFF0B00B4,0xFF0B00B4,0xFF02007D,0xFF100029,
+   0xFF210000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1D0000,
+   0xFF1E0000,0xFF13002C,0xFF030070,0xFF160025,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF230000,
+   0xFF240000,0xFF270000,0xFF300000,0xFF2A000D,0xFF0D0031,0xFF020056,0xFF090057,
+   0xFF230005,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF270000,0xFF16002A,0xFF010063,
+   0xFF0F0030,0xFF1E0003,0xFF200000,0xFF200000,0xFF200000,0xFF180026,0xFF18001C,
+   0xFF1E0006,0xFF180018,0xFF0C003B,0xFF02005D,0xFF05005B,0xFF0F003C,0xFF18001F,
+   0xFF1F000E,0xFF220007,0xFF210007,0xFF210004,0xFF200004,0xFF1F0004,0xFF220002,
+   0xFF240002,0xFF240003,0xFF250005,0xFF250009,0xFF24000F,0xFF21001A,0xFF1B0029,
+   0xFF130039,0xFF0A004E,0xFF030064,0xFF02007C,0xFF050094,0xFF0800A8,0xFF0B00B5,
+   0xFF04008C,0xFF0B0039,0xFF200000,0xFF200000,0xFF1E0000,0xFF1D0000,0xFF1C0000,
+   0xFF1D0000,0xFF1D0002,0xFF10002E,0xFF03007A,0xFF0E0044,0xFF1F0003,0xFF200001,
+   0xFF1F0003,0xFF1D0009,0xFF1B000C,0xFF1A000D,0xFF1A000D,0xFF1A000E,0xFF1A000D,
+   0xFF1A000C,0xFF1B000C,0xFF1C000A,0xFF1C000A,0xFF1C000A,0xFF1D0009,0xFF1D0007,
+   0xFF1E0004,0xFF200001,0xFF210000,0xFF200000,0xFF210000,0xFF270000,0xFF27000D,
+   0xFF050054,0xFF09005A,0xFF220005,0xFF240000,0xFF240000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF290000,
+   0xFF170027,0xFF01005E,0xFF11002C,0xFF210002,0xFF230000,0xFF240000,0xFF250000,
+   0xFF1C0022,0xFF1C0018,0xFF230005,0xFF1B0015,0xFF0E0034,0xFF020052,0xFF060051,
+   0xFF110033,0xFF1C0019,0xFF24000B,0xFF270005,0xFF270005,0xFF270003,0xFF270003,
+   0xFF270002,0xFF290001,0xFF2B0001,0xFF2A0002,0xFF2A0004,0xFF290008,0xFF26000E,
+   0xFF220018,0xFF1C0027,0xFF140036,0xFF0A0049,0xFF030060,0xFF020079,0xFF050093,
+   0xFF0800A8,0xFF0B00B4,0xFF030088,0xFF0C0034,0xFF220000,0xFF210000,0xFF1F0000,
+   0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1C0002,0xFF10002E,0xFF030074,0xFF0F003D,
+   0xFF210002,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF2D0000,0xFF300007,0xFF190029,0xFF030067,0xFF190025,0xFF250000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF220000,0xFF280007,0xFF0B0041,0xFF01006D,0xFF09003E,0xFF13001B,
+   0xFF150017,0xFF110026,0xFF09007A,0xFF070057,0xFF050059,0xFF010067,0xFF050058,
+   0xFF17002E,0xFF26000A,0xFF270001,0xFF230000,0xFF1F0000,0xFF1E0000,0xFF1D0000,
+   0xFF1B0000,0xFF190001,0xFF190001,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,
+   0xFF1D0000,0xFF1F0000,0xFF220000,0xFF260000,0xFF290000,0xFF2A0006,0xFF250015,
+   0xFF19002B,0xFF0B0045,0xFF030062,0xFF040088,0xFF050099,0xFF050062,0xFF190013,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF1F0003,0xFF0F0031,0xFF02007D,
+   0xFF09005A,0xFF1F0008,0xFF200000,0xFF1F0003,0xFF1E0006,0xFF1D0008,0xFF1D0008,
+   0xFF1C0009,0xFF1B000B,0xFF1A000C,0xFF1A000C,0xFF1A000C,0xFF1B000C,0xFF1C0009,
+   0xFF1E0005,0xFF1F0003,0xFF200002,0xFF200001,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF290000,0xFF19002B,0xFF020070,0xFF180026,
+   0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF240000,0xFF2B0006,0xFF0B003D,0xFF010068,
+   0xFF0A003A,0xFF150018,0xFF180014,0xFF140021,0xFF090073,0xFF08004E,0xFF06004E,
+   0xFF01005D,0xFF050050,0xFF190029,0xFF2A0009,0xFF2C0001,0xFF290000,0xFF250000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF250000,0xFF290000,0xFF2C0000,
+   0xFF2D0005,0xFF270013,0xFF1A0028,0xFF0B0043,0xFF030060,0xFF040084,0xFF050095,
+   0xFF05005E,0xFF1A0012,0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF1E0003,
+   0xFF0F0032,0xFF020079,0xFF0A0052,0xFF210006,0xFF220000,0xFF220000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF2D0000,0xFF300004,
+   0xFF0F0049,0xFF090058,0xFF220005,0xFF250000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF200000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF260000,
+   0xFF1F0017,0xFF020060,0xFF040087,0xFF02006B,0xFF020067,0xFF030078,0xFF0800A8,
+   0xFF060097,0xFF030070,0xFF110037,0xFF23000C,0xFF260000,0xFF230000,0xFF210000,
+   0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,
+   0xFF1C0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1A0000,0xFF1B0000,0xFF1D0000,
+   0xFF1E0000,0xFF1F0000,0xFF210000,0xFF250000,0xFF2A0000,0xFF2B0005,0xFF250015,
+   0xFF18002E,0xFF09005B,0xFF03007F,0xFF06006F,0xFF110031,0xFF190014,0xFF170018,
+   0xFF14001E,0xFF0B003F,0xFF03007D,0xFF08005F,0xFF1D0011,0xFF210000,0xFF1F0002,
+   0xFF1F0003,0xFF1E0005,0xFF1E0006,0xFF1E0005,0xFF1E0006,0xFF1D0009,0xFF1B000C,
+   0xFF1A000C,0xFF1B000B,0xFF1C0008,0xFF1E0003,0xFF200000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF220000,0xFF2A0006,0xFF0E0056,0xFF090061,0xFF210006,0xFF240000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF290000,0xFF210015,0xFF02005B,0xFF030083,0xFF020066,0xFF010060,
+   0xFF020070,0xFF0600A2,0xFF04008E,0xFF030064,0xFF140030,0xFF26000A,0xFF290000,
+   0xFF270000,0xFF250000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF280000,0xFF2D0000,
+   0xFF2E0005,0xFF280013,0xFF19002B,0xFF090057,0xFF02007C,0xFF06006D,0xFF12002F,
+   0xFF190014,0xFF160018,0xFF13001F,0xFF0B0040,0xFF02007A,0xFF080056,0xFF1F000E,
+   0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF260000,0xFF2C0000,0xFF24001D,0xFF03006F,0xFF1A001F,
+   0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF270005,0xFF0B003A,0xFF030089,
+   0xFF0A00B1,0xFF0A00AF,0xFF0A00B3,0xFF0900AC,0xFF02006C,0xFF130027,0xFF240001,
+   0xFF230000,0xFF210000,0xFF210000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1A0000,0xFF1A0000,
+   0xFF1A0000,0xFF1A0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF260000,0xFF2C0000,0xFF2C0009,0xFF1C0027,
+   0xFF0A0059,0xFF02007C,0xFF03006C,0xFF020068,0xFF020072,0xFF020082,0xFF050063,
+   0xFF1B0015,0xFF210001,0xFF1F0002,0xFF1F0002,0xFF200002,0xFF200002,0xFF1F0003,
+   0xFF1E0004,0xFF1E0005,0xFF1D0007,0xFF1C000A,0xFF1C0008,0xFF1E0004,0xFF1F0001,
+   0xFF1F0000,0xFF210000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF260000,0xFF200024,
+   0xFF03007E,0xFF180025,0xFF240000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF290004,
+   0xFF0B0037,0xFF030085,0xFF0900AE,0xFF0900AB,0xFF0900AF,0xFF0800A8,0xFF020063,
+   0xFF150020,0xFF280001,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF250000,0xFF290000,0xFF2E0000,
+   0xFF2D0009,0xFF1D0026,0xFF0A0058,0xFF02007A,0xFF03006A,0xFF020068,0xFF020071,
+   0xFF02007E,0xFF060057,0xFF1D0010,0xFF240000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF260000,0xFF2C0007,0xFF09005E,0xFF0F0048,0xFF250000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF220000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF240000,0xFF1C001B,0xFF010062,0xFF0900AB,0xFF0B00B5,0xFF0B00B5,
+   0xFF04008F,0xFF060042,0xFF200007,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,
+   0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,
+   0xFF1C0000,0xFF1D0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF220000,0xFF260000,0xFF2D0000,0xFF2D0009,0xFF10003C,0xFF02007A,
+   0xFF0800A9,0xFF0900AF,0xFF020079,0xFF130028,0xFF210001,0xFF1F0003,0xFF1F0003,
+   0xFF1F0003,0xFF1F0002,0xFF200002,0xFF1F0002,0xFF1F0002,0xFF1F0001,0xFF1F0002,
+   0xFF1F0002,0xFF1F0001,0xFF1F0000,0xFF200000,0xFF200000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF220000,0xFF280009,0xFF09006C,0xFF0D0053,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF200000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF260000,0xFF1C0019,0xFF01005F,0xFF0800A8,
+   0xFF0A00B2,0xFF0A00B2,0xFF04008B,0xFF07003C,0xFF230006,0xFF230000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF260000,0xFF2D0000,0xFF2D0009,
+   0xFF0F003C,0xFF02007B,0xFF0800A9,0xFF0900AC,0xFF02006B,0xFF15001F,0xFF240000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF2D0000,0xFF190035,
+   0xFF070062,0xFF220007,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF230000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF200000,0xFF260007,
+   0xFF070043,0xFF050095,0xFF0B00B5,0xFF0800AA,0xFF010065,0xFF130020,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF290000,0xFF2C000A,0xFF0A0041,0xFF030085,0xFF0600A1,0xFF04005A,
+   0xFF1B000E,0xFF1E0004,0xFF1E0005,0xFF1E0005,0xFF1F0003,0xFF200001,0xFF200001,
+   0xFF200001,0xFF200001,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF210000,0xFF220000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF280000,0xFF17003E,0xFF07006E,0xFF200009,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF1F0000,
+   0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF210000,0xFF270006,0xFF070040,0xFF050093,0xFF0A00B3,0xFF0800A9,0xFF010063,
+   0xFF14001F,0xFF240000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF280000,0xFF2B000B,0xFF090044,0xFF030086,
+   0xFF06009A,0xFF04004A,0xFF1F0009,0xFF230000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF280000,0xFF280013,0xFF050063,0xFF1B0022,0xFF250000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF260000,0xFF120029,0xFF02007A,0xFF0900B1,
+   0xFF04008C,0xFF06003E,0xFF210007,0xFF230000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF2B0000,
+   0xFF270011,0xFF050052,0xFF010082,0xFF090044,0xFF1E0007,0xFF1E0006,0xFF1E0006,
+   0xFF1E0005,0xFF1F0003,0xFF200001,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF240000,0xFF240017,0xFF050070,
+   0xFF190026,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF260000,0xFF130027,
+   0xFF020077,0xFF0900B1,0xFF04008C,0xFF06003E,0xFF210007,0xFF230000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF290000,0xFF260012,0xFF050052,0xFF000076,0xFF0B0033,0xFF220001,
+   0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF2C0005,0xFF0A004C,0xFF0B0052,0xFF220004,0xFF240000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF240000,0xFF1C0018,0xFF010063,0xFF0700A9,0xFF01006B,0xFF140020,0xFF250000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1D0000,
+   0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF240000,0xFF240000,0xFF2C0000,0xFF14002F,0xFF00006F,
+   0xFF0B003C,0xFF1E0005,0xFF1D0007,0xFF1E0006,0xFF1E0005,0xFF1F0004,0xFF1F0002,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF280007,0xFF09005A,0xFF0B0058,0xFF220004,0xFF250000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF230000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1E0000,
+   0xFF1F0000,0xFF1F0000,0xFF230000,0xFF1C0017,0xFF010062,0xFF0700A9,0xFF01006B,
+   0xFF13001F,0xFF240000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF2B0000,
+   0xFF14002E,0xFF000063,0xFF0E002C,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF2C0000,0xFF17002E,0xFF010068,
+   0xFF180026,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF220000,0xFF200010,0xFF02005A,
+   0xFF06009F,0xFF020057,0xFF1A0010,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1F0000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF230000,0xFF270000,0xFF230013,0xFF02005F,0xFF0A0047,0xFF1D0006,0xFF1D0007,
+   0xFF1D0007,0xFF1E0006,0xFF1E0005,0xFF1F0002,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF280000,
+   0xFF150038,0xFF01006E,0xFF180026,0xFF250000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF230000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF210000,
+   0xFF20000F,0xFF02005A,0xFF06009F,0xFF020057,0xFF1A0010,0xFF230000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF240000,0xFF230013,0xFF020057,0xFF0D0038,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF290000,0xFF230018,0xFF01005A,0xFF0B0052,0xFF230003,0xFF240000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF220000,0xFF1E0012,0xFF02005E,0xFF06009E,0xFF020051,0xFF1B000D,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF2B0003,
+   0xFF0C0042,0xFF060058,0xFF1B000B,0xFF1D0007,0xFF1D0007,0xFF1E0007,0xFF1F0004,
+   0xFF1F0001,0xFF200000,0xFF200000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF260000,0xFF20001E,0xFF010062,0xFF0B0052,
+   0xFF230003,0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF210000,
+   0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF210000,0xFF1D0012,0xFF02005E,0xFF06009E,
+   0xFF020051,0xFF1B000D,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,
+   0xFF1F0000,0xFF2A0003,0xFF0C003C,0xFF080049,0xFF210003,0xFF230000,0xFF220000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF270000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF2D0005,
+   0xFF0C003E,0xFF020064,0xFF1C0018,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF200000,0xFF200000,0xFF230000,0xFF150021,
+   0xFF02006F,0xFF0700A6,0xFF020059,0xFF170012,0xFF230000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF280000,0xFF1B0025,0xFF020063,0xFF17001A,
+   0xFF1D0007,0xFF1D0007,0xFF1D0007,0xFF1E0004,0xFF1F0000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF2A0007,0xFF0B004A,0xFF020069,0xFF1C0018,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF230000,0xFF220000,0xFF210000,0xFF1F0000,0xFF1E0000,
+   0xFF1D0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF220000,0xFF150021,0xFF02006F,0xFF0700A6,0xFF020059,0xFF170012,0xFF230000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF260000,0xFF1B0021,
+   0xFF030053,0xFF1C000E,0xFF230000,0xFF230000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF2C0000,0xFF240019,0xFF02005B,0xFF100041,
+   0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210005,0xFF08003C,0xFF03008A,0xFF0800AD,0xFF010063,
+   0xFF130019,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF220000,
+   0xFF210000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF260000,0xFF1E001A,0xFF010065,0xFF130028,0xFF1D0006,0xFF1E0006,0xFF1E0006,
+   0xFF1E0003,0xFF1F0001,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF280000,0xFF20001F,
+   0xFF020068,0xFF0F0044,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF200000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF210005,0xFF08003C,0xFF03008A,
+   0xFF0800AD,0xFF010063,0xFF130019,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,
+   0xFF1C0000,0xFF1D0000,0xFF210000,0xFF1C001A,0xFF01005A,0xFF17001D,0xFF230000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF260000,0xFF2F0002,0xFF130036,0xFF020069,0xFF160023,0xFF240000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF210000,0xFF1B0014,
+   0xFF02005D,0xFF01007F,0xFF040092,0xFF020072,0xFF11001F,0xFF220000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF250000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF250000,0xFF1F0016,0xFF010066,
+   0xFF0E0037,0xFF1E0005,0xFF1E0005,0xFF1E0005,0xFF1E0003,0xFF1F0001,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF2A0003,0xFF110042,0xFF020071,0xFF140024,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF210000,0xFF1B0014,0xFF02005D,0xFF01007F,0xFF040092,0xFF020072,0xFF10001F,
+   0xFF210000,0xFF220000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200000,
+   0xFF210000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1C0000,0xFF1B0000,0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF200000,
+   0xFF1C0018,0xFF000061,0xFF10002D,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1F0000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF2A0000,0xFF22001B,
+   0xFF010065,0xFF030062,0xFF15001F,0xFF240001,0xFF240000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF1E0007,0xFF0E0036,0xFF0E0049,0xFF11002F,0xFF060040,
+   0xFF000066,0xFF0B003E,0xFF220002,0xFF250000,0xFF250000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF260000,0xFF270000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF240000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF240000,0xFF250000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF250000,0xFF19001D,0xFF000068,0xFF0A0044,0xFF1E0004,0xFF1F0003,
+   0xFF1E0005,0xFF1E0004,0xFF200001,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF210000,0xFF220000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF250000,0xFF1E0022,0xFF01006F,0xFF030066,0xFF130022,0xFF220001,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF1E0007,0xFF0E0036,0xFF0E0049,
+   0xFF11002F,0xFF060040,0xFF000066,0xFF0A003F,0xFF210002,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF220000,0xFF200000,0xFF200000,0xFF1F0000,0xFF1F0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,
+   0xFF1C0000,0xFF1D0000,0xFF1D0000,0xFF200000,0xFF160022,0xFF000069,0xFF0B003A,
+   0xFF210000,0xFF220000,0xFF230000,0xFF220000,0xFF220000,0xFF200000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF240000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF270000,0xFF27000F,0xFF04005B,0xFF03008B,0xFF02005A,
+   0xFF120027,0xFF210006,0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF1D000A,0xFF110025,
+   0xFF1E0014,0xFF280002,0xFF2B0000,0xFF2A0009,0xFF15002A,0xFF020059,0xFF150025,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,0xFF270000,0xFF270000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF230000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF230000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF250002,0xFF0C0036,
+   0xFF000073,0xFF0A0042,0xFF1F0002,0xFF200001,0xFF1F0003,0xFF1F0003,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF220013,0xFF030063,
+   0xFF03008F,0xFF020060,0xFF10002B,0xFF1E0007,0xFF210000,0xFF210000,0xFF210000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF200000,0xFF1E0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,
+   0xFF1C000B,0xFF110026,0xFF1E0015,0xFF280002,0xFF2A0000,0xFF2A0009,0xFF14002B,
+   0xFF02005C,0xFF140027,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF200000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1E0000,
+   0xFF200003,0xFF0A003F,0xFF010076,0xFF0A003A,0xFF200000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF210000,0xFF200000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1E0000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,0xFF270000,
+   0xFF220012,0xFF03005E,0xFF0700A8,0xFF050096,0xFF01006C,0xFF070049,0xFF120028,
+   0xFF1B0012,0xFF200005,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF200000,
+   0xFF1E0005,0xFF180016,0xFF16001F,0xFF20000C,0xFF220000,0xFF210000,0xFF230000,
+   0xFF290000,0xFF310002,0xFF1A0027,0xFF030054,0xFF15001E,0xFF240000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF270000,
+   0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF230000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF1E0011,0xFF030054,0xFF020084,0xFF0A0040,0xFF200002,
+   0xFF210000,0xFF200001,0xFF1F0002,0xFF210000,0xFF200000,0xFF1F0001,0xFF200000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF1E0017,0xFF030065,0xFF0800AB,0xFF05009A,0xFF010071,
+   0xFF06004D,0xFF10002C,0xFF180015,0xFF1F0006,0xFF220000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF230000,0xFF210000,0xFF1F0000,0xFF1E0000,0xFF1E0000,
+   0xFF1F0000,0xFF200000,0xFF1D0006,0xFF170018,0xFF150020,0xFF1F000C,0xFF210000,
+   0xFF210000,0xFF220000,0xFF270000,0xFF2F0002,0xFF190029,0xFF030059,0xFF130021,
+   0xFF220001,0xFF230000,0xFF230000,0xFF230000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1B0000,
+   0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1F0000,0xFF1A0014,0xFF03005D,0xFF030084,
+   0xFF0A0038,0xFF200001,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF210000,0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF280000,0xFF160027,0xFF020075,0xFF0900B0,
+   0xFF0800AB,0xFF040094,0xFF01007F,0xFF010073,0xFF020065,0xFF060051,0xFF0F0034,
+   0xFF190016,0xFF1E0008,0xFF1F0004,0xFF200001,0xFF200001,0xFF1F0001,0xFF1E0004,
+   0xFF1B0009,0xFF19000F,0xFF160019,0xFF0F002B,0xFF10002E,0xFF1C0017,0xFF240003,
+   0xFF220000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF280000,0xFF310001,
+   0xFF180033,0xFF020054,0xFF190012,0xFF250000,0xFF250000,0xFF260000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,0xFF260000,
+   0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230004,0xFF0B0036,
+   0xFF000072,0xFF020087,0xFF05004E,0xFF1C000C,0xFF210000,0xFF200001,0xFF200001,
+   0xFF200000,0xFF200001,0xFF1F0002,0xFF200001,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF230000,0xFF130030,
+   0xFF02007B,0xFF0A00AF,0xFF0800A0,0xFF030084,0xFF010072,0xFF01006C,0xFF010065,
+   0xFF050055,0xFF0F0036,0xFF1A0016,0xFF1F0007,0xFF210004,0xFF220002,0xFF220001,
+   0xFF200001,0xFF1D0004,0xFF1A000A,0xFF180010,0xFF15001B,0xFF0F002D,0xFF0F0031,
+   0xFF1A0019,0xFF220003,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF260000,0xFF2F0001,0xFF160036,0xFF02005A,0xFF170016,0xFF230000,0xFF220000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF210000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF200000,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1F0000,
+   0xFF1E0000,0xFF1D0000,0xFF1C0000,0xFF1B0000,0xFF1B0000,0xFF1D0000,0xFF1E0000,
+   0xFF1E0006,0xFF09003F,0xFF01007A,0xFF03008A,0xFF050049,0xFF1C000A,0xFF220000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF220000,0xFF200000,0xFF1F0000,
+   0xFF200000,0xFF200000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF250000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,
+   0xFF260006,0xFF080044,0xFF03008D,0xFF050096,0xFF01006E,0xFF07004B,0xFF17002F,
+   0xFF210026,0xFF1E0030,0xFF140046,0xFF070060,0xFF020067,0xFF04005E,0xFF060053,
+   0xFF08004A,0xFF090047,0xFF080048,0xFF06004D,0xFF040054,0xFF03005E,0xFF01006B,
+   0xFF08005A,0xFF21000D,0xFF240000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF240000,0xFF250000,0xFF280000,0xFF2F0006,0xFF0C0048,0xFF0A0036,
+   0xFF240001,0xFF250000,0xFF260000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF240000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF13002A,0xFF010060,0xFF090045,0xFF0A004B,0xFF010061,
+   0xFF0D0035,0xFF180014,0xFF1D0007,0xFF200001,0xFF200000,0xFF200001,0xFF200002,
+   0xFF1F0002,0xFF200000,0xFF210000,0xFF220000,0xFF230000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF210000,0xFF210000,0xFF210009,0xFF07004F,0xFF030088,0xFF040084,0xFF00005B,
+   0xFF06003E,0xFF150028,0xFF1D0021,0xFF1B002B,0xFF120042,0xFF06005C,0xFF02005F,
+   0xFF040055,0xFF06004B,0xFF090043,0xFF090043,0xFF080047,0xFF06004F,0xFF040058,
+   0xFF030062,0xFF01006F,0xFF08005D,0xFF1F000E,0xFF220000,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF260000,0xFF2C0007,
+   0xFF0B0050,0xFF09003E,0xFF200001,0xFF210000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF200000,0xFF1D0000,0xFF1D0000,
+   0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,0xFF1C0000,
+   0xFF1C0000,0xFF1C0000,0xFF1D0000,0xFF1F0000,0xFF110030,0xFF01006A,0xFF08004E,
+   0xFF090051,0xFF01005C,0xFF0D002E,0xFF1A000E,0xFF210003,0xFF240000,0xFF250000,
+   0xFF240000,0xFF220000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF250000,0xFF240000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF1D0019,0xFF01005D,0xFF000073,
+   0xFF05004E,0xFF170028,0xFF27000A,0xFF2A0000,0xFF290000,0xFF2B0000,0xFF2E0001,
+   0xFF2C000B,0xFF210023,0xFF190034,0xFF15003C,0xFF100045,0xFF0E0048,0xFF0F0046,
+   0xFF0D004A,0xFF03005C,0xFF010079,0xFF03008F,0xFF0E0041,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,
+   0xFF250000,0xFF2C0000,0xFF260017,0xFF06004F,0xFF1B0011,0xFF260000,0xFF260000,
+   0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF270000,0xFF260000,
+   0xFF260000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF190018,0xFF03005E,
+   0xFF100032,0xFF2A0004,0xFF2E000A,0xFF0E004F,0xFF170025,0xFF1F0012,0xFF18001B,
+   0xFF190012,0xFF1E0005,0xFF200000,0xFF200001,0xFF200001,0xFF200000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF220000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF220000,0xFF230000,0xFF190020,
+   0xFF01005C,0xFF000062,0xFF04003F,0xFF140020,0xFF230008,0xFF250000,0xFF240000,
+   0xFF260000,0xFF2A0000,0xFF280008,0xFF1F001B,0xFF170029,0xFF14002E,0xFF0F0035,
+   0xFF0E0039,0xFF0E003D,0xFF0C0045,0xFF030058,0xFF020079,0xFF040092,0xFF0D0044,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF280000,0xFF23001A,0xFF050056,0xFF180014,
+   0xFF220000,0xFF220000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF220000,0xFF220000,0xFF230000,0xFF230000,
+   0xFF220000,0xFF1F0000,0xFF1C0000,0xFF1B0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,
+   0xFF1D0000,0xFF1E0000,0xFF1D0000,0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0001,
+   0xFF15001D,0xFF030068,0xFF0E0039,0xFF270005,0xFF2B000B,0xFF0D004C,0xFF190020,
+   0xFF22000D,0xFF1B0011,0xFF1E0009,0xFF230002,0xFF240000,0xFF220000,0xFF200000,
+   0xFF1F0000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF250000,0xFF260000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260004,0xFF0C003F,0xFF000060,0xFF0D003A,0xFF24000F,0xFF2A0000,0xFF250000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF260000,0xFF290000,0xFF2A0000,
+   0xFF2B0000,0xFF2B0000,0xFF2A0001,0xFF2A0000,0xFF2C0002,0xFF280011,0xFF17002E,
+   0xFF05005C,0xFF040059,0xFF1A000F,0xFF210000,0xFF210000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF260000,0xFF2F0001,
+   0xFF150033,0xFF060046,0xFF1B000E,0xFF250001,0xFF270000,0xFF270000,0xFF270000,
+   0xFF270000,0xFF270000,0xFF260000,0xFF260000,0xFF260000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF220000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF200000,0xFF220000,0xFF220000,
+   0xFF1D0007,0xFF0F0024,0xFF030056,0xFF020062,0xFF1C000E,0xFF230000,0xFF2A0000,
+   0xFF1E0030,0xFF0F0035,0xFF240000,0xFF240002,0xFF1F000F,0xFF190017,0xFF190013,
+   0xFF1D0007,0xFF200000,0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF220000,
+   0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF230000,0xFF220006,0xFF0A0042,0xFF000050,0xFF0C002D,0xFF20000C,
+   0xFF250000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF200000,0xFF200000,0xFF220000,
+   0xFF260000,0xFF270000,0xFF290000,0xFF290000,0xFF280000,0xFF270000,0xFF280002,
+   0xFF24000D,0xFF150028,0xFF04005A,0xFF04005E,0xFF170011,0xFF1F0000,0xFF1F0000,
+   0xFF200000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF220000,
+   0xFF230000,0xFF2C0001,0xFF140037,0xFF05004B,0xFF180011,0xFF220001,0xFF250000,
+   0xFF250000,0xFF240000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF240000,0xFF220000,0xFF1F0000,0xFF1D0000,
+   0xFF1D0000,0xFF1C0000,0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF1B0000,0xFF1B0000,
+   0xFF1B0000,0xFF1B0000,0xFF180009,0xFF0C002B,0xFF030061,0xFF02006A,0xFF180011,
+   0xFF200000,0xFF270000,0xFF1D002E,0xFF10002F,0xFF270000,0xFF280001,0xFF240008,
+   0xFF1E000D,0xFF1C000B,0xFF1F0004,0xFF200000,0xFF200000,0xFF200000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF250000,0xFF270000,0xFF170025,0xFF02005B,0xFF14002F,
+   0xFF280005,0xFF270000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF260000,0xFF2C0000,0xFF250015,0xFF080051,0xFF05004F,
+   0xFF1A000E,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF240000,0xFF290000,0xFF28000D,0xFF030053,0xFF03004E,
+   0xFF0F0020,0xFF1D000B,0xFF250001,0xFF270000,0xFF270000,0xFF270000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF220000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF1F0000,0xFF1E0002,0xFF1B000A,0xFF120023,0xFF050045,0xFF010065,0xFF040094,
+   0xFF020067,0xFF130019,0xFF210000,0xFF240000,0xFF24001C,0xFF080050,0xFF1B000B,
+   0xFF200002,0xFF220001,0xFF250002,0xFF22000B,0xFF1B0014,0xFF190013,0xFF1D0008,
+   0xFF210001,0xFF230000,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200001,
+   0xFF210001,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF15002A,
+   0xFF010051,0xFF120025,0xFF240004,0xFF230000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF210000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF230000,0xFF290000,0xFF220012,
+   0xFF08004F,0xFF050053,0xFF18000F,0xFF200000,0xFF200000,0xFF210000,0xFF210000,
+   0xFF200000,0xFF200000,0xFF210000,0xFF220000,0xFF220000,0xFF270000,0xFF27000E,
+   0xFF030057,0xFF020052,0xFF0E0023,0xFF1B000C,0xFF230001,0xFF240000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF250000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF210000,0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF1E0000,0xFF1D0000,
+   0xFF1C0000,0xFF1C0000,0xFF1B0000,0xFF190003,0xFF16000C,0xFF0F0029,0xFF04004F,
+   0xFF01006F,0xFF05009A,0xFF02006E,0xFF11001C,0xFF1F0000,0xFF220000,0xFF22001B,
+   0xFF080048,0xFF1F0006,0xFF240000,0xFF270000,0xFF290001,0xFF250007,0xFF1C000F,
+   0xFF19000E,0xFF1C0006,0xFF200001,0xFF210000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF250000,
+   0xFF1A001C,0xFF040055,0xFF15002B,0xFF270002,0xFF260000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF2A0000,0xFF29000E,0xFF0B004F,0xFF05004F,0xFF160017,0xFF210001,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF260000,0xFF260009,0xFF05004A,0xFF03008F,0xFF020068,0xFF040046,0xFF0C0030,
+   0xFF160020,0xFF1C0012,0xFF1F000B,0xFF210008,0xFF240003,0xFF260000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF210000,0xFF200000,0xFF1E0003,0xFF1B000A,
+   0xFF160014,0xFF13001A,0xFF11001F,0xFF0F0024,0xFF0C0031,0xFF070044,0xFF030055,
+   0xFF00005F,0xFF010059,0xFF020057,0xFF030064,0xFF01006D,0xFF03005A,0xFF16001D,
+   0xFF220000,0xFF210013,0xFF040063,0xFF120026,0xFF1E0006,0xFF1D0006,0xFF1E0005,
+   0xFF220002,0xFF250001,0xFF230006,0xFF1E000D,0xFF1B0010,0xFF1E000B,0xFF200006,
+   0xFF220002,0xFF230000,0xFF230000,0xFF220000,0xFF220000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF200001,0xFF1F0002,0xFF200002,0xFF200001,0xFF200000,
+   0xFF210000,0xFF220000,0xFF170021,0xFF040052,0xFF140022,0xFF240002,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF260000,0xFF26000B,0xFF0A004D,0xFF040052,
+   0xFF140019,0xFF200001,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF220000,0xFF250000,0xFF24000A,0xFF04004E,0xFF040091,0xFF02006C,
+   0xFF03004A,0xFF0B0034,0xFF140022,0xFF1B0013,0xFF1E000B,0xFF200008,0xFF240003,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF200000,0xFF1E0000,
+   0xFF1C0003,0xFF19000B,0xFF140016,0xFF11001D,0xFF0E0023,0xFF0D0029,0xFF0B0039,
+   0xFF060051,0xFF020065,0xFF000072,0xFF01006B,0xFF020069,0xFF030074,0xFF02007A,
+   0xFF030063,0xFF150021,0xFF200001,0xFF200013,0xFF04005C,0xFF14001B,0xFF210000,
+   0xFF210000,0xFF220000,0xFF240000,0xFF260000,0xFF230004,0xFF1D000A,0xFF1A000D,
+   0xFF1C0008,0xFF1F0005,0xFF220001,0xFF240000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF19001A,0xFF060054,0xFF17002B,0xFF260001,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF290000,
+   0xFF240015,0xFF03005F,0xFF02005C,0xFF100026,0xFF1F0005,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF210006,0xFF0D002F,0xFF00005F,
+   0xFF020069,0xFF010064,0xFF010065,0xFF02006B,0xFF020072,0xFF03006D,0xFF040061,
+   0xFF050056,0xFF090045,0xFF0D0036,0xFF0D0032,0xFF0D0030,0xFF0D0030,0xFF0E002C,
+   0xFF0E0029,0xFF0C002E,0xFF07003A,0xFF03004C,0xFF01005C,0xFF010065,0xFF01006D,
+   0xFF010071,0xFF00006B,0xFF03005D,0xFF0C0041,0xFF180025,0xFF210014,0xFF23000F,
+   0xFF230011,0xFF20001A,0xFF140037,0xFF07004C,0xFF0A0043,0xFF080049,0xFF02007A,
+   0xFF080048,0xFF1C0008,0xFF1E0006,0xFF1D0007,0xFF1D0007,0xFF1E0005,0xFF200002,
+   0xFF230001,0xFF240003,0xFF230007,0xFF1F0013,0xFF150024,0xFF17001A,0xFF1C000F,
+   0xFF1E0009,0xFF200004,0xFF220001,0xFF220000,0xFF210000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF210001,0xFF160020,0xFF060054,
+   0xFF150025,0xFF240000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,
+   0xFF200000,0xFF260000,0xFF220011,0xFF02005D,0xFF02005F,0xFF0F0027,0xFF1E0005,
+   0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,0xFF220000,0xFF200006,
+   0xFF0C0031,0xFF000062,0xFF01006B,0xFF010067,0xFF010068,0xFF02006E,0xFF020073,
+   0xFF03006F,0xFF040063,0xFF050057,0xFF090046,0xFF0D0037,0xFF0D0034,0xFF0C0032,
+   0xFF0D0032,0xFF0E002E,0xFF0D002C,0xFF0B0032,0xFF07003E,0xFF030050,0xFF010060,
+   0xFF01006B,0xFF020075,0xFF02007D,0xFF00007B,0xFF03006E,0xFF0A0051,0xFF150030,
+   0xFF1C001C,0xFF1F0017,0xFF1E0019,0xFF1C0022,0xFF120042,0xFF06005A,0xFF09004F,
+   0xFF080051,0xFF020079,0xFF09003C,0xFF1F0002,0xFF220000,0xFF210000,0xFF200000,
+   0xFF1F0000,0xFF200000,0xFF220000,0xFF230002,0xFF220005,0xFF1E0010,0xFF16001E,
+   0xFF180013,0xFF1E000A,0xFF210006,0xFF230003,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF0B003D,
+   0xFF05005A,0xFF1A0028,0xFF270000,0xFF240000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF2A0004,0xFF0A0041,0xFF020084,
+   0xFF010065,0xFF080038,0xFF160017,0xFF1E0007,0xFF1F0006,0xFF1D0008,0xFF1A000E,
+   0xFF140021,0xFF080044,0xFF0B0049,0xFF18002B,0xFF1F0017,0xFF200016,0xFF1B001D,
+   0xFF160024,0xFF12002E,0xFF0E003D,0xFF080051,0xFF050066,0xFF020079,0xFF01007D,
+   0xFF02007D,0xFF02007A,0xFF020074,0xFF020073,0xFF02007A,0xFF030081,0xFF04008D,
+   0xFF06009D,0xFF0600A0,0xFF020080,0xFF02006F,0xFF050070,0xFF100030,0xFF200010,
+   0xFF270002,0xFF260000,0xFF250000,0xFF240000,0xFF250000,0xFF270000,0xFF2C0000,
+   0xFF28000C,0xFF16002B,0xFF07004A,0xFF02006E,0xFF010074,0xFF0A0043,0xFF14001F,
+   0xFF1B000C,0xFF1D0006,0xFF1D0006,0xFF1E0006,0xFF1E0005,0xFF1F0004,0xFF210002,
+   0xFF250001,0xFF24000A,0xFF19001E,0xFF20000F,0xFF1F000E,0xFF1A0016,0xFF100034,
+   0xFF0F0038,0xFF12002E,0xFF120029,0xFF12002A,0xFF110029,0xFF120025,0xFF110025,
+   0xFF100026,0xFF0B003C,0xFF040056,0xFF190022,0xFF250000,0xFF220000,0xFF210000,
+   0xFF220000,0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF200000,0xFF200000,0xFF200000,0xFF210000,0xFF270002,
+   0xFF090038,0xFF020084,0xFF010067,0xFF07003A,0xFF160018,0xFF1E0008,0xFF1E0006,
+   0xFF1C0008,0xFF19000F,0xFF130022,0xFF070046,0xFF0B004A,0xFF18002C,0xFF1E0018,
+   0xFF1F0017,0xFF1B001E,0xFF160026,0xFF120030,0xFF0D003E,0xFF080052,0xFF040067,
+   0xFF02007B,0xFF01007E,0xFF02007F,0xFF02007B,0xFF020076,0xFF020076,0xFF03007F,
+   0xFF030085,0xFF050090,0xFF0700A0,0xFF0700A6,0xFF02008C,0xFF03007D,0xFF06007E,
+   0xFF0E003E,0xFF1C0016,0xFF220005,0xFF220003,0xFF200004,0xFF200004,0xFF210003,
+   0xFF230002,0xFF270001,0xFF240011,0xFF140035,0xFF070056,0xFF020079,0xFF020073,
+   0xFF0B0039,0xFF170015,0xFF1E0004,0xFF1F0000,0xFF1E0000,0xFF1D0000,0xFF1E0000,
+   0xFF1F0000,0xFF200000,0xFF250000,0xFF250008,0xFF1B0016,0xFF23000A,0xFF220008,
+   0xFF1D000D,0xFF12002A,0xFF11002E,0xFF140026,0xFF140026,0xFF140028,0xFF140026,
+   0xFF140023,0xFF130023,0xFF110024,0xFF010064,0xFF15002D,0xFF260001,0xFF240000,
+   0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF290001,0xFF0D0036,0xFF040090,0xFF0700A6,0xFF02007F,0xFF01005D,
+   0xFF05004D,0xFF05004D,0xFF030050,0xFF020056,0xFF030058,0xFF120035,0xFF280008,
+   0xFF2D0000,0xFF2C0000,0xFF2D0000,0xFF2F0000,0xFF300000,0xFF300001,0xFF300002,
+   0xFF2D0006,0xFF28000D,0xFF1F0022,0xFF140036,0xFF0C004D,0xFF050077,0xFF07009D,
+   0xFF0900B0,0xFF0A00B1,0xFF0A00B2,0xFF0A00B3,0xFF0700A5,0xFF010074,0xFF080040,
+   0xFF1B0018,0xFF200012,0xFF250002,0xFF230000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF250000,0xFF2B0000,0xFF2B0007,
+   0xFF1F001A,0xFF100038,0xFF070055,0xFF02005E,0xFF05004F,0xFF0D0036,0xFF16001C,
+   0xFF1C0009,0xFF1F0004,0xFF1F0003,0xFF1F0003,0xFF1F0004,0xFF210001,0xFF1C0021,
+   0xFF11004E,0xFF16002E,0xFF0E004A,0xFF030077,0xFF000079,0xFF020063,0xFF050054,
+   0xFF0B004B,0xFF0F0045,0xFF080052,0xFF000067,0xFF000071,0xFF010061,0xFF140025,
+   0xFF240000,0xFF220000,0xFF220000,0xFF220000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF260001,0xFF0C002A,0xFF04008D,0xFF0700A6,
+   0xFF020080,0xFF01005E,0xFF04004E,0xFF04004F,0xFF030052,0xFF020058,0xFF03005A,
+   0xFF120036,0xFF280009,0xFF2C0000,0xFF2C0000,0xFF2D0000,0xFF2F0000,0xFF300000,
+   0xFF300001,0xFF300002,0xFF2D0007,0xFF27000E,0xFF1F0023,0xFF130038,0xFF0C004F,
+   0xFF050079,0xFF07009E,0xFF0A00B2,0xFF0B00B4,0xFF0B00B5,0xFF0B00B6,0xFF0800AD,
+   0xFF020082,0xFF07004F,0xFF180021,0xFF1C0018,0xFF210005,0xFF1F0002,0xFF1E0004,
+   0xFF1D0006,0xFF1D0007,0xFF1D0007,0xFF1D0007,0xFF1D0007,0xFF1E0006,0xFF210003,
+   0xFF270001,0xFF270009,0xFF1C0021,0xFF0F0042,0xFF06005A,0xFF02005B,0xFF050049,
+   0xFF0E002E,0xFF160013,0xFF1C0004,0xFF1E0000,0xFF1F0000,0xFF1F0000,0xFF1F0000,
+   0xFF230000,0xFF1D001D,0xFF120047,0xFF180028,0xFF100040,0xFF030069,0xFF00006B,
+   0xFF02005A,0xFF050052,0xFF0B0049,0xFF0F0044,0xFF080050,0xFF000065,0xFF000070,
+   0xFF0E0030,0xFF240004,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF230000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF20001D,0xFF080074,
+   0xFF06009D,0xFF0A00B2,0xFF0900B0,0xFF040097,0xFF00006C,0xFF07004D,0xFF19002F,
+   0xFF1F0020,0xFF24000F,0xFF270001,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF270000,0xFF280000,0xFF2A0000,0xFF2D0000,
+   0xFF2C0000,0xFF2A0002,0xFF1C001E,0xFF030057,0xFF040092,0xFF0900B0,0xFF0A00B1,
+   0xFF0700A3,0xFF01006C,0xFF0B0037,0xFF20000B,0xFF210000,0xFF210000,0xFF200000,
+   0xFF220000,0xFF240000,0xFF240000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF230000,0xFF280000,0xFF2B0001,0xFF2A0007,
+   0xFF240018,0xFF170034,0xFF0D004B,0xFF050057,0xFF050052,0xFF0A0043,0xFF0D0035,
+   0xFF0D0031,0xFF0C0033,0xFF0A003C,0xFF080053,0xFF04008D,0xFF01007E,0xFF020064,
+   0xFF0E0046,0xFF1B0029,0xFF240013,0xFF28000A,0xFF2B0004,0xFF2E0001,0xFF2D000A,
+   0xFF0D003F,0xFF000066,0xFF0B002C,0xFF220002,0xFF220000,0xFF220000,0xFF220000,
+   0xFF230000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF1D0018,0xFF060060,0xFF050094,0xFF0A00B3,0xFF0900B0,0xFF040097,0xFF00006D,
+   0xFF07004E,0xFF190030,0xFF1F0021,0xFF230010,0xFF270001,0xFF250000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF280000,
+   0xFF290000,0xFF2C0000,0xFF2B0000,0xFF290002,0xFF1B001F,0xFF03005A,0xFF040094,
+   0xFF0A00B2,0xFF0A00B3,0xFF0700A9,0xFF01007B,0xFF0A0044,0xFF1D0010,0xFF1D0007,
+   0xFF1E0004,0xFF1D0006,0xFF1F0003,0xFF210000,0xFF200002,0xFF1F0005,0xFF1E0006,
+   0xFF1E0006,0xFF1E0007,0xFF1E0007,0xFF1E0007,0xFF1E0006,0xFF200004,0xFF240001,
+   0xFF270002,0xFF26000A,0xFF20001D,0xFF14003C,0xFF0C0052,0xFF05005A,0xFF05004D,
+   0xFF0A003B,0xFF0D002C,0xFF0D0028,0xFF0D0029,0xFF0B0033,0xFF09004A,0xFF040084,
+   0xFF010072,0xFF020056,0xFF0F0039,0xFF1C0021,0xFF250012,0xFF290009,0xFF2B0003,
+   0xFF2E0001,0xFF2E0009,0xFF0E003D,0xFF00006B,0xFF220009,0xFF250000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF250000,0xFF240000,0xFF240000,0xFF230000,0xFF230000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF230001,0xFF1D000E,0xFF16003C,0xFF120060,0xFF050093,0xFF0A00B1,0xFF06009E,
+   0xFF010062,0xFF0F0030,0xFF24000A,0xFF290000,0xFF270000,0xFF250000,0xFF240000,
+   0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF250000,0xFF230000,0xFF220000,0xFF200000,0xFF1F0000,0xFF200000,0xFF280000,
+   0xFF1C001F,0xFF02005B,0xFF06009E,0xFF0800AD,0xFF010075,0xFF0C0036,0xFF220007,
+   0xFF200002,0xFF1F0001,0xFF200000,0xFF200000,0xFF220000,0xFF240000,0xFF250000,
+   0xFF240000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF230000,0xFF260000,0xFF2A0000,0xFF2B0003,
+   0xFF270012,0xFF180033,0xFF05005B,0xFF00006D,0xFF010078,0xFF030084,0xFF020089,
+   0xFF00007A,0xFF05005C,0xFF130035,0xFF210016,0xFF290003,0xFF290000,0xFF270000,
+   0xFF250000,0xFF240000,0xFF240000,0xFF2B0000,0xFF17002C,0xFF040046,0xFF1E000A,
+   0xFF230000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF230000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF210000,0xFF1C0009,0xFF15002F,0xFF0F004E,0xFF040083,
+   0xFF0A00B0,0xFF06009E,0xFF010062,0xFF0F0030,0xFF24000A,0xFF290000,0xFF270000,
+   0xFF250000,0xFF240000,0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF240000,0xFF230000,0xFF220000,0xFF200000,0xFF1F0000,
+   0xFF200000,0xFF280001,0xFF1C001F,0xFF02005B,0xFF06009E,0xFF0900AF,0xFF020081,
+   0xFF0B0041,0xFF1F0009,0xFF1C0007,0xFF1C0007,0xFF1D0005,0xFF1D0004,0xFF1F0001,
+   0xFF210000,0xFF220000,0xFF210000,0xFF1F0002,0xFF1E0004,0xFF1E0005,0xFF1E0005,
+   0xFF1E0005,0xFF1E0005,0xFF1E0005,0xFF1E0005,0xFF1E0005,0xFF200003,0xFF230001,
+   0xFF260000,0xFF280004,0xFF240016,0xFF160039,0xFF04005F,0xFF00006C,0xFF010070,
+   0xFF02007A,0xFF02007F,0xFF00006E,0xFF050050,0xFF13002C,0xFF230011,0xFF2A0002,
+   0xFF290000,0xFF270000,0xFF250000,0xFF240000,0xFF240000,0xFF2B0000,0xFF17002D,
+   0xFF01005A,0xFF250000,0xFF240000,0xFF240000,0xFF250000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF240000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF230000,0xFF230001,0xFF210002,0xFF210003,0xFF230007,0xFF2A0002,
+   0xFF230014,0xFF020064,0xFF0800A9,0xFF020074,0xFF0F002D,0xFF260003,0xFF240000,
+   0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,0xFF230000,0xFF200000,
+   0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF280002,0xFF12002F,0xFF020078,
+   0xFF05009B,0xFF04004E,0xFF1D000C,0xFF210001,0xFF1D0004,0xFF200000,0xFF200000,
+   0xFF200000,0xFF220000,0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF250000,0xFF2C0000,0xFF28000D,
+   0xFF110031,0xFF02005E,0xFF040094,0xFF020073,0xFF0D0034,0xFF22000E,0xFF280001,
+   0xFF260000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF250004,0xFF0B003D,0xFF120024,0xFF230000,0xFF220000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF230000,0xFF220000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF220000,0xFF210000,0xFF1F0000,0xFF200001,
+   0xFF220004,0xFF280002,0xFF21000D,0xFF020051,0xFF0700A4,0xFF020075,0xFF0F002D,
+   0xFF260003,0xFF240000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF250000,
+   0xFF230000,0xFF200000,0xFF1F0000,0xFF1F0000,0xFF1E0000,0xFF1F0000,0xFF280002,
+   0xFF12002F,0xFF020077,0xFF05009F,0xFF04005B,0xFF1B0010,0xFF1E0004,0xFF1A000B,
+   0xFF1D0005,0xFF1D0005,0xFF1D0004,0xFF1F0001,0xFF220000,0xFF220000,0xFF220000,
+   0xFF210000,0xFF200001,0xFF1E0004,0xFF1E0005,0xFF1E0005,0xFF1E0005,0xFF1E0005,
+   0xFF1E0005,0xFF1E0005,0xFF1E0004,0xFF1E0004,0xFF1E0004,0xFF1F0003,0xFF220000,
+   0xFF290000,0xFF250011,0xFF10003B,0xFF010069,0xFF040096,0xFF010070,0xFF0D0031,
+   0xFF22000C,0xFF280000,0xFF260000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF250004,0xFF0B0043,0xFF100035,0xFF240000,0xFF240000,
+   0xFF240000,0xFF250000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,0xFF260000,
+   0xFF260000,0xFF260000,0xFF260000,0xFF240000,0xFF220000,0xFF220000,0xFF220000,
+   0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF210003,0xFF200004,
+   0xFF230001,0xFF250000,0xFF250000,0xFF270000,0xFF220012,0xFF02005F,0xFF06009D,
+   0xFF020057,0xFF1C0010,0xFF240000,0xFF230000,0xFF230000,0xFF240000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF260000,
+   0xFF260000,0xFF240000,0xFF210000,0xFF1F0000,0xFF1F0000,0xFF1F0000,0xFF1E0000,
+   0xFF1E0000,0xFF220000,0xFF220011,0xFF03005A,0xFF020088,0xFF070040,0xFF1F0003,
+   0xFF1D0005,0xFF1E0003,0xFF200000,0xFF200000,0xFF210000,0xFF230000,0xFF250000,
+   0xFF250000,0xFF250000,0xFF250000,0xFF240000,0xFF230000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF220000,0xFF280000,0xFF2F0003,0xFF170024,0xFF00005E,
+   0xFF03004E,0xFF1F000B,0xFF240000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF1C0017,0xFF050047,0xFF1D000B,
+   0xFF220000,0xFF220000,0xFF220000,0xFF230000,0xFF240000,0xFF240000,0xFF240000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF220000,0xFF210000,
+   0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF210000,0xFF220000,
+   0xFF200001,0xFF1E0001,0xFF220000,0xFF230000,0xFF230000,0xFF240000,0xFF21000C,
+   0xFF02004A,0xFF050094,0xFF030058,0xFF1C0010,0xFF240000,0xFF230000,0xFF230000,
+   0xFF240000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,0xFF250000,
+   0xFF250000,0xFF260000,0xFF260000,0xFF240000,0xFF210000,0xFF1F0000,0xFF1F0000,
+   0xFF1F0000,0xFF1E0000,0xFF1E0000,0xFF220000,0xFF220011,0xFF03005A,0xFF02008D,
+   0xFF06004D,0xFF1C0007,0xFF1A000C,0xFF1B0009,0xFF1D0005,0xFF1D0005,0xFF1E0003,
+   0xFF200001,0xFF220000,0xFF220000,0xFF220000,0xFF220000,0xFF210000,0xFF200001,
+   0xFF1E0004,0xFF1E0005,0xFF1E0003,0xFF1E0003,0xFF1E0003,0xFF1E0002,0xFF1E0002,
+   0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF1E0002,0xFF1F0001,0xFF250000,0xFF2B0005,
+   0xFF15002F,0xFF000068,0xFF03004F,0xFF1F000B,0xFF240000,0xFF220000,0xFF230000,
+   0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF240000,0xFF250000,0xFF1C0017,
+   0xFF050050,0xFF1E0012,
+};
+#endif // LAVASTONE_H_
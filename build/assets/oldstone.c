@@ -0,0 +1,5722 @@
+#ifndef OLDSTONE_H_
+#define OLDSTONE_H_
+size_t oldstone_width = 200;
+size_t oldstone_height = 200;
+uint32_t oldstone_pixels[] = {
+   0xFF606E80,0xFF606E80,0xFF617082,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF617082,0xFF606F81,0xFF5E6D7E,
+   0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF576576,
+   0xFF596678,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF627082,0xFF616F82,
+   0xFF374455,0xFF222B3A,0xFF394657,0xFF596779,0xFF5F6D7F,0xFF5F6D7F,0xFF606E80,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,
+   0xFF617081,0xFF5F6D7F,0xFF5C6B7D,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,
+   0xFF5B697B,0xFF5A6879,0xFF5A6879,0xFF5A697A,0xFF617081,0xFF435162,0xFF2C3747,
+   0xFF3D4A5C,0xFF576577,0xFF596779,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5D6B7D,
+   0xFF5F6D7F,0xFF617082,0xFF617082,0xFF617082,0xFF617082,0xFF617082,0xFF617082,
+   0xFF5F6E80,0xFF5D6C7E,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,
+   0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5E6C7E,0xFF5E6C7E,0xFF5F6D7F,
+   0xFF69788A,0xFF566477,0xFF394556,0xFF5A687A,0xFF5E6C7E,0xFF5E6C7E,0xFF5F6D7F,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF627183,0xFF465367,
+   0xFF45536A,0xFF5F6E86,0xFF5E6D85,0xFF5E6D85,0xFF5F6F87,0xFF607087,0xFF607087,
+   0xFF607087,0xFF607087,0xFF607087,0xFF607087,0xFF607087,0xFF607087,0xFF5F6F87,
+   0xFF5E6E86,0xFF5D6C84,0xFF5D6B83,0xFF5D6B83,0xFF5D6B83,0xFF5D6B83,0xFF5D6B83,
+   0xFF5D6B83,0xFF56647C,0xFF58667D,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,
+   0xFF606F87,0xFF5F6E87,0xFF384559,0xFF222B39,0xFF394657,0xFF596779,0xFF5F6D7F,
+   0xFF5F6D7F,0xFF606E80,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,
+   0xFF617081,0xFF617081,0xFF617081,0xFF5F6D7F,0xFF5C6B7D,0xFF5B697B,0xFF5B697B,
+   0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5A6879,0xFF5A6879,0xFF5A697A,0xFF617081,
+   0xFF435163,0xFF2B3645,0xFF3B4655,0xFF545F6F,0xFF566171,0xFF596474,0xFF596474,
+   0xFF596474,0xFF5A6575,0xFF5C6776,0xFF5E6A78,0xFF5E6A78,0xFF5E6A78,0xFF5E6A78,
+   0xFF5E6A78,0xFF5E6A78,0xFF5C6876,0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5A6675,
+   0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5B6675,
+   0xFF5B6675,0xFF5C6776,0xFF657180,0xFF535F6E,0xFF384454,0xFF5A687A,0xFF5E6C7E,
+   0xFF5E6C7E,0xFF5F6D7F,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF627183,0xFF455364,0xFF455264,0xFF616F81,0xFF606E80,0xFF616F81,0xFF627082,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF617082,0xFF5F6E80,0xFF5F6D7F,0xFF5E6C7E,0xFF5E6C7D,0xFF5E6C7D,
+   0xFF5E6C7D,0xFF5E6D7E,0xFF4D5A6B,0xFF556274,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF616F81,0xFF647385,0xFF3C495B,0xFF222B3A,0xFF354152,
+   0xFF566476,0xFF606E80,0xFF606E80,0xFF616F81,0xFF617081,0xFF617081,0xFF617081,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF5F6E7F,0xFF5D6B7D,0xFF5B697B,
+   0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5A6879,0xFF5A6879,
+   0xFF5A6879,0xFF616F81,0xFF505E6F,0xFF2F3A4A,0xFF303C4C,0xFF4C5A6B,0xFF5D6B7D,
+   0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5D6B7D,0xFF5F6E80,0xFF617082,0xFF617082,
+   0xFF617082,0xFF617082,0xFF617082,0xFF627183,0xFF617082,0xFF5F6E7F,0xFF5D6C7D,
+   0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,
+   0xFF5E6D7E,0xFF5F6D7F,0xFF5F6D7F,0xFF5E6C7E,0xFF606F81,0xFF687789,0xFF465365,
+   0xFF4D5B6C,0xFF5F6D7F,0xFF5E6C7E,0xFF5E6C7E,0xFF5F6D7F,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF616F81,0xFF5C6A7D,0xFF3C495F,0xFF526078,0xFF5F6E86,0xFF5E6D85,
+   0xFF5F6E86,0xFF5F6F87,0xFF607087,0xFF607087,0xFF607087,0xFF607087,0xFF607087,
+   0xFF607087,0xFF607087,0xFF607087,0xFF5F6F87,0xFF5E6D85,0xFF5E6C84,0xFF5D6B84,
+   0xFF5D6B83,0xFF5D6B83,0xFF5D6B83,0xFF5D6C83,0xFF4D5A72,0xFF54627A,0xFF5E6D85,
+   0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5F6E86,0xFF627189,0xFF3D4A60,
+   0xFF232C3B,0xFF354152,0xFF566476,0xFF606E80,0xFF606E80,0xFF616F81,0xFF617081,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF5F6E7F,
+   0xFF5D6B7D,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,
+   0xFF5A6879,0xFF5A6879,0xFF5A6879,0xFF616F81,0xFF505E70,0xFF2E3949,0xFF2E3847,
+   0xFF4A5564,0xFF5A6574,0xFF596474,0xFF596474,0xFF596474,0xFF5A6575,0xFF5C6876,
+   0xFF5E6A78,0xFF5E6A78,0xFF5E6A78,0xFF5E6A78,0xFF5E6A78,0xFF5F6B79,0xFF5E6A78,
+   0xFF5C6876,0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5A6675,
+   0xFF5A6675,0xFF5A6675,0xFF5B6776,0xFF5C6776,0xFF5C6776,0xFF5B6675,0xFF5D6877,
+   0xFF65717F,0xFF44505F,0xFF4D5A6C,0xFF5F6D7F,0xFF5E6C7E,0xFF5E6C7E,0xFF5F6D7F,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF616F81,0xFF5C6A7C,0xFF3B4759,0xFF536072,
+   0xFF616F81,0xFF606F81,0xFF617082,0xFF627183,0xFF627183,0xFF627182,0xFF627182,
+   0xFF627182,0xFF627182,0xFF617282,0xFF617282,0xFF607181,0xFF5F7080,0xFF5E6F7F,
+   0xFF5E6F7F,0xFF5E6E7E,0xFF5E6D7D,0xFF5D6D7C,0xFF5B6B7A,0xFF4A5867,0xFF445160,
+   0xFF5F6E7E,0xFF5F6E7F,0xFF5F6F7F,0xFF606E7F,0xFF606E7F,0xFF606E80,0xFF606E80,
+   0xFF667487,0xFF424F61,0xFF232C3B,0xFF323D4E,0xFF536173,0xFF606F80,0xFF616F80,
+   0xFF617080,0xFF617080,0xFF617080,0xFF617080,0xFF607180,0xFF617080,0xFF617080,
+   0xFF606F7F,0xFF5D6C7D,0xFF5B6A7B,0xFF5B697A,0xFF5B697B,0xFF5B697B,0xFF5B697B,
+   0xFF5B697B,0xFF5B697B,0xFF5A6879,0xFF5A6879,0xFF5A6879,0xFF5E6C7D,0xFF586779,
+   0xFF323D4E,0xFF2B3545,0xFF505D6F,0xFF5D6B7D,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,
+   0xFF5D6B7D,0xFF5F6E7F,0xFF607181,0xFF607181,0xFF607181,0xFF617182,0xFF627283,
+   0xFF637384,0xFF637383,0xFF607080,0xFF5D6D7D,0xFF5C6D7C,0xFF5C6D7C,0xFF5C6D7C,
+   0xFF5D6C7C,0xFF5D6C7C,0xFF5D6C7D,0xFF5E6D7E,0xFF606F80,0xFF627082,0xFF616F81,
+   0xFF606E80,0xFF5E6C7E,0xFF637184,0xFF5E6C7E,0xFF3B4859,0xFF566476,0xFF5F6D7F,
+   0xFF5E6C7E,0xFF5F6E80,0xFF616F81,0xFF617082,0xFF617082,0xFF647385,0xFF4F5E70,
+   0xFF3C4A60,0xFF5C6C83,0xFF5F6E85,0xFF5E6E85,0xFF5F6F86,0xFF5F7186,0xFF5F7186,
+   0xFF5F7186,0xFF5F7186,0xFF5F7186,0xFF5F7186,0xFF5F7185,0xFF5F7185,0xFF5E7085,
+   0xFF5D6F85,0xFF5D6E84,0xFF5D6E84,0xFF5D6D83,0xFF5D6C83,0xFF5C6C82,0xFF5B6980,
+   0xFF4B586E,0xFF455268,0xFF5E6D83,0xFF5E6D84,0xFF5E6D84,0xFF5E6D84,0xFF5E6D84,
+   0xFF5E6D84,0xFF5E6D85,0xFF64738B,0xFF435067,0xFF232C3C,0xFF313D4E,0xFF536172,
+   0xFF606F7F,0xFF607080,0xFF617080,0xFF617080,0xFF617080,0xFF617080,0xFF617080,
+   0xFF617081,0xFF617081,0xFF606F80,0xFF5D6C7D,0xFF5B697B,0xFF5B697A,0xFF5B697B,
+   0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5A6879,0xFF5A6879,0xFF5A6879,
+   0xFF5E6C7D,0xFF586779,0xFF313C4D,0xFF293340,0xFF4D5868,0xFF5A6575,0xFF596474,
+   0xFF596474,0xFF596474,0xFF5A6575,0xFF5C6877,0xFF5E6A78,0xFF5E6A78,0xFF5E6A78,
+   0xFF5E6A78,0xFF606C7A,0xFF616D7B,0xFF606C7A,0xFF5E6A77,0xFF5B6775,0xFF5A6675,
+   0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5B6775,0xFF5D6977,
+   0xFF5F6A78,0xFF5E6977,0xFF5D6876,0xFF5B6675,0xFF606B7A,0xFF5A6675,0xFF3B4757,
+   0xFF576476,0xFF5F6D7F,0xFF5E6C7E,0xFF5F6E80,0xFF616F81,0xFF617082,0xFF617082,
+   0xFF647385,0xFF4F5D6F,0xFF3B4859,0xFF5E6D7F,0xFF616F81,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627182,0xFF627182,0xFF617282,0xFF617282,0xFF617282,0xFF617282,
+   0xFF607281,0xFF5F7080,0xFF5E6F7F,0xFF5E707F,0xFF5E707F,0xFF5C6D7B,0xFF576876,
+   0xFF566674,0xFF5A6B79,0xFF4F5F6C,0xFF556573,0xFF5E6F7E,0xFF5E6E7D,0xFF5E6E7E,
+   0xFF5F6F7E,0xFF5F6F7F,0xFF5F6F7F,0xFF606E80,0xFF647385,0xFF424F61,0xFF222C3A,
+   0xFF2F3B4C,0xFF526072,0xFF617080,0xFF607180,0xFF607180,0xFF607180,0xFF607180,
+   0xFF607180,0xFF607180,0xFF607180,0xFF607080,0xFF5D6E7D,0xFF5B6B7A,0xFF5A6A7A,
+   0xFF5A6A7A,0xFF5B697A,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5A6879,
+   0xFF5A6879,0xFF5A6879,0xFF5C6A7B,0xFF5C6B7D,0xFF374355,0xFF394657,0xFF576577,
+   0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5D6C7D,0xFF5F6F7F,0xFF607181,
+   0xFF607181,0xFF617282,0xFF627383,0xFF637484,0xFF637484,0xFF637484,0xFF617282,
+   0xFF5E6F7E,0xFF5C6D7C,0xFF5C6D7B,0xFF5C6D7C,0xFF5C6D7C,0xFF5C6D7C,0xFF5E6D7D,
+   0xFF606E80,0xFF627082,0xFF627082,0xFF627082,0xFF627082,0xFF616F81,0xFF606E80,
+   0xFF667587,0xFF3E4B5C,0xFF3C495A,0xFF576577,0xFF606E80,0xFF617082,0xFF627183,
+   0xFF627183,0xFF637284,0xFF5E6D7E,0xFF3D4B5C,0xFF415065,0xFF5F7186,0xFF5F7186,
+   0xFF5F7186,0xFF5F7186,0xFF5F7186,0xFF5F7186,0xFF5F7185,0xFF5F7185,0xFF5F7185,
+   0xFF5F7185,0xFF5F7185,0xFF5E7185,0xFF5D6F84,0xFF5D6E83,0xFF5D6F83,0xFF5D6F83,
+   0xFF5B6C81,0xFF57677C,0xFF56657B,0xFF5B6980,0xFF505D74,0xFF55647A,0xFF5E6E84,
+   0xFF5D6D83,0xFF5D6D83,0xFF5D6D84,0xFF5E6D84,0xFF5E6D84,0xFF5E6D84,0xFF62728A,
+   0xFF435068,0xFF232C3C,0xFF2F3C4B,0xFF516171,0xFF607180,0xFF607180,0xFF607180,
+   0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607080,0xFF5E6D7D,
+   0xFF5B6B7B,0xFF5A6A7A,0xFF5B697A,0xFF5B697A,0xFF5B697B,0xFF5B697B,0xFF5B697B,
+   0xFF5B697B,0xFF5A6879,0xFF5A6879,0xFF5A6879,0xFF5C6A7B,0xFF5C6B7D,0xFF374354,
+   0xFF374252,0xFF545F6F,0xFF596474,0xFF596474,0xFF596474,0xFF596474,0xFF5A6575,
+   0xFF5C6877,0xFF5E6A78,0xFF5E6A78,0xFF5F6B79,0xFF606C7A,0xFF616D7B,0xFF616D7B,
+   0xFF616D7B,0xFF5F6B79,0xFF5C6876,0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5A6675,
+   0xFF5A6675,0xFF5B6775,0xFF5D6877,0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,
+   0xFF5E6977,0xFF5D6877,0xFF636F7D,0xFF3D4858,0xFF3C495A,0xFF576577,0xFF606E80,
+   0xFF617082,0xFF627183,0xFF627183,0xFF637284,0xFF5E6D7F,0xFF3D4A5B,0xFF414E5F,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627182,0xFF617282,
+   0xFF617282,0xFF617282,0xFF617282,0xFF617282,0xFF607180,0xFF5E707E,0xFF5B6D7B,
+   0xFF546673,0xFF4F616D,0xFF526470,0xFF566975,0xFF5C6F7B,0xFF5F727E,0xFF566874,
+   0xFF5C6E7A,0xFF5D6F7C,0xFF5D6F7C,0xFF5D6F7C,0xFF5E6E7D,0xFF5E6E7E,0xFF5F6F7E,
+   0xFF5F6F7F,0xFF627282,0xFF3E4B5D,0xFF202937,0xFF2D3949,0xFF4F5D6E,0xFF607080,
+   0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF617080,0xFF617081,
+   0xFF5F6E7F,0xFF5C6B7B,0xFF5A6A79,0xFF5A6A79,0xFF5A6A79,0xFF5A6A7A,0xFF5B697B,
+   0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697A,0xFF5B697A,0xFF5A687A,0xFF5D6B7D,
+   0xFF5F6E80,0xFF3A4658,0xFF414D5F,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,
+   0xFF5C6A7B,0xFF5C6C7C,0xFF5F6F7F,0xFF617281,0xFF627383,0xFF637483,0xFF637483,
+   0xFF637483,0xFF637483,0xFF637483,0xFF627483,0xFF607180,0xFF5D6E7C,0xFF5C6D7B,
+   0xFF5C6D7B,0xFF5C6D7C,0xFF5D6D7C,0xFF5F6E7E,0xFF616F81,0xFF627082,0xFF627082,
+   0xFF627082,0xFF627082,0xFF627082,0xFF616F81,0xFF677688,0xFF4F5C6E,0xFF2E3949,
+   0xFF3E4B5C,0xFF526172,0xFF5E6C7E,0xFF617082,0xFF606F81,0xFF576677,0xFF425061,
+   0xFF2F3B4B,0xFF445469,0xFF5F7186,0xFF5F7186,0xFF5F7186,0xFF5F7186,0xFF5F7185,
+   0xFF5F7185,0xFF5F7185,0xFF5F7185,0xFF5F7185,0xFF5F7285,0xFF5F7285,0xFF5D7184,
+   0xFF5D6F83,0xFF5A6C80,0xFF546679,0xFF4F6174,0xFF526477,0xFF56677C,0xFF5C6C82,
+   0xFF5F6F86,0xFF57667C,0xFF5C6C82,0xFF5D6D83,0xFF5D6D83,0xFF5D6D82,0xFF5D6D83,
+   0xFF5D6D83,0xFF5D6E84,0xFF5E6E84,0xFF617087,0xFF3F4D63,0xFF202A39,0xFF2C3A47,
+   0xFF4E5E6C,0xFF60717F,0xFF5F717F,0xFF60717F,0xFF60717F,0xFF60717F,0xFF60717F,
+   0xFF60717F,0xFF60717F,0xFF5E6F7E,0xFF5B6C7B,0xFF5A6A7A,0xFF5A6A7A,0xFF5A6A7A,
+   0xFF5A6A7A,0xFF5A6A7A,0xFF5B697A,0xFF5B697B,0xFF5B697B,0xFF5B697A,0xFF5B697A,
+   0xFF5A687A,0xFF5D6B7D,0xFF5F6E80,0xFF3A4658,0xFF3E4A59,0xFF596473,0xFF596474,
+   0xFF596474,0xFF596474,0xFF596474,0xFF5A6575,0xFF5D6877,0xFF5F6B79,0xFF606C7A,
+   0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF606C7A,0xFF5E6A78,
+   0xFF5B6775,0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5C6876,0xFF5E6977,
+   0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,0xFF5E6978,0xFF646F7E,
+   0xFF4C5868,0xFF2D3849,0xFF3E4B5D,0xFF526173,0xFF5E6C7E,0xFF617082,0xFF606F82,
+   0xFF576678,0xFF435062,0xFF2F3A4B,0xFF455365,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627283,0xFF617282,0xFF617281,0xFF5E6F7E,
+   0xFF596978,0xFF536472,0xFF50626E,0xFF4E606C,0xFF42525D,0xFF3A4B54,0xFF556A73,
+   0xFF5B707A,0xFF5C717B,0xFF5D717B,0xFF576C76,0xFF5C707A,0xFF5C707B,0xFF5C707B,
+   0xFF5C707B,0xFF5D707C,0xFF5D6F7D,0xFF5E6F7E,0xFF5F707F,0xFF5E6E7D,0xFF374555,
+   0xFF1D2533,0xFF293443,0xFF495968,0xFF5F707F,0xFF5F707F,0xFF607180,0xFF60717F,
+   0xFF607180,0xFF607180,0xFF607080,0xFF606F7F,0xFF5D6C7D,0xFF5B697B,0xFF5A6A7A,
+   0xFF5A6A7A,0xFF5A6A7A,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,
+   0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5D6C7D,0xFF606F81,0xFF3A4758,0xFF4C5A6B,
+   0xFF5F6E7F,0xFF5E6C7D,0xFF5D6B7C,0xFF5C6B7B,0xFF5C6B7C,0xFF5E6E7E,0xFF617282,
+   0xFF637483,0xFF637483,0xFF637483,0xFF637483,0xFF637483,0xFF637483,0xFF627583,
+   0xFF627582,0xFF617381,0xFF5E707E,0xFF5C6D7B,0xFF5C6D7B,0xFF5C6D7B,0xFF5E6E7E,
+   0xFF607080,0xFF627081,0xFF627081,0xFF627082,0xFF627082,0xFF627082,0xFF627082,
+   0xFF627082,0xFF667587,0xFF5F6D80,0xFF333E4F,0xFF283241,0xFF354151,0xFF3E4B5D,
+   0xFF424F60,0xFF3D495A,0xFF334050,0xFF2B3645,0xFF26303E,0xFF425165,0xFF5D6F84,
+   0xFF5F7186,0xFF5F7186,0xFF5F7186,0xFF5F7185,0xFF5F7185,0xFF5F7285,0xFF5F7285,
+   0xFF5E7184,0xFF5B6F81,0xFF576A7C,0xFF526577,0xFF506275,0xFF4E6072,0xFF435365,
+   0xFF3C4C5E,0xFF55687B,0xFF5C6E82,0xFF5D6D83,0xFF5E6E84,0xFF59697E,0xFF5D6D83,
+   0xFF5D6D83,0xFF5D6D83,0xFF5D6D83,0xFF5D6E83,0xFF5D6E84,0xFF5D6E84,0xFF5E6F84,
+   0xFF5C6D83,0xFF37475B,0xFF1C2633,0xFF283541,0xFF485A66,0xFF5E717C,0xFF5E717D,
+   0xFF5F727E,0xFF5F727E,0xFF5F727E,0xFF5F727E,0xFF5F727D,0xFF5E707D,0xFF5B6D7A,
+   0xFF596B79,0xFF596B78,0xFF596B79,0xFF5A6A79,0xFF5A6A79,0xFF5A6A79,0xFF5A6A7A,
+   0xFF5B697A,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5D6C7D,0xFF606F81,
+   0xFF3A4658,0xFF495564,0xFF5C6876,0xFF5B6675,0xFF5A6575,0xFF596474,0xFF596574,
+   0xFF5C6776,0xFF5F6B79,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,
+   0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF606C79,0xFF5C6877,0xFF5A6675,0xFF5A6675,
+   0xFF5A6675,0xFF5C6776,0xFF5E6977,0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,
+   0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,0xFF636E7C,0xFF5C6777,0xFF323D4D,0xFF283241,
+   0xFF354152,0xFF3E4B5D,0xFF424F60,0xFF3D495A,0xFF344051,0xFF2B3646,0xFF26303F,
+   0xFF435063,0xFF606F81,0xFF627183,0xFF627183,0xFF627284,0xFF606F81,0xFF5B6A7B,
+   0xFF556575,0xFF536372,0xFF526271,0xFF526270,0xFF556674,0xFF596B78,0xFF5C6F7C,
+   0xFF607480,0xFF637983,0xFF5C727B,0xFF536970,0xFF4F636C,0xFF51646E,0xFF4F636C,
+   0xFF566C74,0xFF5B727A,0xFF5B717A,0xFF5C717B,0xFF5C717C,0xFF5C717C,0xFF5D707C,
+   0xFF5D707C,0xFF60727F,0xFF556774,0xFF2F3D4B,0xFF1C2430,0xFF232D3B,0xFF3F4E5D,
+   0xFF5D6D7C,0xFF5F6F7E,0xFF60707F,0xFF607180,0xFF607180,0xFF607180,0xFF607080,
+   0xFF5E6D7E,0xFF5C6A7B,0xFF5B697B,0xFF5B697B,0xFF5B697A,0xFF5B697A,0xFF5B697B,
+   0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,
+   0xFF5E6D7E,0xFF586779,0xFF374455,0xFF556475,0xFF606F80,0xFF5F6E7F,0xFF5F6E7E,
+   0xFF5E6D7D,0xFF5F6F7F,0xFF617282,0xFF637483,0xFF637483,0xFF637483,0xFF627583,
+   0xFF627583,0xFF627583,0xFF627582,0xFF627582,0xFF627582,0xFF627581,0xFF5F727F,
+   0xFF5C6F7C,0xFF5B6E7A,0xFF5C6E7C,0xFF5F707F,0xFF617181,0xFF617181,0xFF617181,
+   0xFF617181,0xFF627081,0xFF627081,0xFF627082,0xFF627082,0xFF647283,0xFF677587,
+   0xFF3E4A5C,0xFF1F2836,0xFF1D2532,0xFF2A3444,0xFF333F4F,0xFF404E5E,0xFF475565,
+   0xFF3C4A5A,0xFF2E3948,0xFF374355,0xFF57677D,0xFF607186,0xFF5F7186,0xFF5F7186,
+   0xFF5D6F83,0xFF596B7E,0xFF536678,0xFF516476,0xFF506375,0xFF506375,0xFF536679,
+   0xFF586B7D,0xFF5B6E81,0xFF5F7385,0xFF627689,0xFF5C6F82,0xFF546779,0xFF506275,
+   0xFF526276,0xFF516175,0xFF58697E,0xFF5D6E83,0xFF5D6E83,0xFF5D6E83,0xFF5D6E83,
+   0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5F7085,0xFF55667B,0xFF2F3E50,0xFF1B252F,
+   0xFF212E39,0xFF3D4F5A,0xFF5B6F79,0xFF5D717B,0xFF5E727C,0xFF5E737C,0xFF5E737C,
+   0xFF5E737C,0xFF5D737B,0xFF5B6F7A,0xFF596C78,0xFF586B77,0xFF596B78,0xFF596B78,
+   0xFF596B78,0xFF596B78,0xFF596B78,0xFF596B79,0xFF5A6A7A,0xFF5B697B,0xFF5B697B,
+   0xFF5B697B,0xFF5B697B,0xFF5E6D7E,0xFF586779,0xFF374354,0xFF535F6D,0xFF5D6977,
+   0xFF5C6876,0xFF5C6876,0xFF5B6776,0xFF5D6877,0xFF5F6B79,0xFF616D7B,0xFF616D7B,
+   0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,
+   0xFF616D7B,0xFF5E6A78,0xFF5B6776,0xFF5A6675,0xFF5B6775,0xFF5D6977,0xFF5F6A78,
+   0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,
+   0xFF616C7A,0xFF636F7E,0xFF3C4757,0xFF1F2836,0xFF1D2533,0xFF2A3444,0xFF333F4F,
+   0xFF414D5F,0xFF475566,0xFF3C495B,0xFF2E3949,0xFF374354,0xFF596779,0xFF637284,
+   0xFF606F81,0xFF576476,0xFF536172,0xFF586778,0xFF5E6E7E,0xFF617281,0xFF627383,
+   0xFF627383,0xFF607281,0xFF5E727F,0xFF5D717D,0xFF5C717C,0xFF5C717C,0xFF5D737D,
+   0xFF5E757E,0xFF5E747D,0xFF5C717B,0xFF4E626B,0xFF586E77,0xFF5B727A,0xFF5B727A,
+   0xFF5B727A,0xFF5C717B,0xFF5C717C,0xFF5C717C,0xFF5C717B,0xFF61747F,0xFF4A5C68,
+   0xFF293744,0xFF2D3A48,0xFF354352,0xFF313E4D,0xFF536171,0xFF606F7F,0xFF606F7E,
+   0xFF606F80,0xFF617080,0xFF5F707F,0xFF5E6D7E,0xFF5C6A7C,0xFF5C6A7C,0xFF5B697B,
+   0xFF5C697B,0xFF5C697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,
+   0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5F6E80,0xFF515F71,0xFF374354,
+   0xFF596879,0xFF5F6E7F,0xFF5F6E7E,0xFF5F6E7E,0xFF5F6F7E,0xFF607180,0xFF627382,
+   0xFF627583,0xFF627582,0xFF627582,0xFF627582,0xFF627582,0xFF627582,0xFF627582,
+   0xFF627582,0xFF617581,0xFF627581,0xFF617481,0xFF5E717E,0xFF5D707D,0xFF5E717E,
+   0xFF607180,0xFF607180,0xFF617181,0xFF617181,0xFF617181,0xFF617181,0xFF617181,
+   0xFF617181,0xFF617081,0xFF627181,0xFF69788A,0xFF485567,0xFF242D3C,0xFF25303E,
+   0xFF3C495A,0xFF59687A,0xFF69798B,0xFF6D7D8E,0xFF68798A,0xFF4F5D6E,0xFF313D4E,
+   0xFF4A586E,0xFF607086,0xFF5E6F84,0xFF55657A,0xFF526276,0xFF56687C,0xFF5B6E81,
+   0xFF5E7285,0xFF5F7386,0xFF5F7386,0xFF5E7284,0xFF5D7183,0xFF5C7082,0xFF5C7081,
+   0xFF5C7081,0xFF5D7183,0xFF5E7384,0xFF5E7284,0xFF5C7082,0xFF4F6174,0xFF596C7F,
+   0xFF5C6F82,0xFF5D6E83,0xFF5D6E83,0xFF5D6E83,0xFF5D6E83,0xFF5D6E84,0xFF5E6D83,
+   0xFF617186,0xFF4B5C70,0xFF2A3847,0xFF2B3B45,0xFF33454E,0xFF2E4049,0xFF4F656C,
+   0xFF5D727A,0xFF5C727A,0xFF5D737A,0xFF5D747B,0xFF5C737A,0xFF5A7178,0xFF586E77,
+   0xFF586D76,0xFF586D77,0xFF586C77,0xFF596C77,0xFF596C78,0xFF596B78,0xFF596B79,
+   0xFF5A6B79,0xFF5A6A7A,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5F6E80,
+   0xFF515F71,0xFF364253,0xFF576371,0xFF5C6876,0xFF5C6876,0xFF5C6876,0xFF5C6876,
+   0xFF5E6A78,0xFF606C7A,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,
+   0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF606C7A,0xFF5D6977,
+   0xFF5C6876,0xFF5D6977,0xFF5E6A77,0xFF5E6A77,0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,
+   0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,0xFF667280,0xFF455161,
+   0xFF242D3B,0xFF262F3E,0xFF3C495A,0xFF59687A,0xFF69788B,0xFF6D7D8F,0xFF69798B,
+   0xFF4F5D6F,0xFF313D4D,0xFF4B586A,0xFF627183,0xFF525F70,0xFF5B6A7B,0xFF657487,
+   0xFF677789,0xFF657787,0xFF647685,0xFF637484,0xFF617282,0xFF5F7180,0xFF5E717E,
+   0xFF5D717D,0xFF5C717C,0xFF5C707C,0xFF5C717B,0xFF5B717A,0xFF5B727B,0xFF5B727A,
+   0xFF596E77,0xFF5C717C,0xFF5B717B,0xFF5B727A,0xFF5B7279,0xFF5B727A,0xFF5B727B,
+   0xFF5B727A,0xFF5C7279,0xFF5F747D,0xFF3C505A,0xFF31424D,0xFF536472,0xFF667686,
+   0xFF515F6F,0xFF414E5E,0xFF5E6D7C,0xFF5F6F7E,0xFF606F7E,0xFF5F6E7E,0xFF5D6C7D,
+   0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,
+   0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5B697B,
+   0xFF5B697B,0xFF616F81,0xFF4B596B,0xFF374455,0xFF5A697A,0xFF5F6F7F,0xFF5E6F7E,
+   0xFF5E6F7E,0xFF5E6F7E,0xFF5F707F,0xFF617382,0xFF627582,0xFF627582,0xFF627582,
+   0xFF627582,0xFF627582,0xFF627582,0xFF627582,0xFF627581,0xFF617581,0xFF627581,
+   0xFF617481,0xFF60737F,0xFF5F727E,0xFF5F717F,0xFF60717F,0xFF60717F,0xFF60717F,
+   0xFF60717F,0xFF60717F,0xFF617180,0xFF617181,0xFF617181,0xFF617181,0xFF617181,
+   0xFF687889,0xFF4D5B6D,0xFF2B3746,0xFF3A4757,0xFF596879,0xFF657486,0xFF627283,
+   0xFF627283,0xFF667787,0xFF6E7E90,0xFF4A5768,0xFF384557,0xFF516177,0xFF516177,
+   0xFF596A7F,0xFF627489,0xFF64778B,0xFF627689,0xFF617588,0xFF607487,0xFF5E7285,
+   0xFF5D7183,0xFF5D7182,0xFF5C7081,0xFF5B7081,0xFF5B7080,0xFF5B7080,0xFF5B7080,
+   0xFF5B7081,0xFF5B7080,0xFF586D7E,0xFF5C7081,0xFF5C6F82,0xFF5C6F82,0xFF5D6E83,
+   0xFF5C6F82,0xFF5C6F82,0xFF5D6E83,0xFF5D6E83,0xFF607186,0xFF3E4F61,0xFF31424D,
+   0xFF50666E,0xFF627A80,0xFF4D6369,0xFF3D5258,0xFF597176,0xFF5B7378,0xFF5B7378,
+   0xFF5A7378,0xFF587176,0xFF576F74,0xFF576F75,0xFF576F75,0xFF586E75,0xFF586E76,
+   0xFF596D77,0xFF596C78,0xFF5A6C79,0xFF5B6B7A,0xFF5B6B7A,0xFF5A6A7A,0xFF5A6A7A,
+   0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF616F81,0xFF4B596B,0xFF374253,0xFF576372,
+   0xFF5C6876,0xFF5C6876,0xFF5C6876,0xFF5C6876,0xFF5D6977,0xFF606C79,0xFF616D7B,
+   0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,
+   0xFF616D7B,0xFF616D7B,0xFF606C7A,0xFF5F6B78,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,
+   0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5F6A78,0xFF5F6A78,0xFF5F6A78,
+   0xFF5F6A78,0xFF5F6A78,0xFF657180,0xFF4A5665,0xFF2B3545,0xFF3A4658,0xFF59687A,
+   0xFF657486,0xFF627284,0xFF627284,0xFF677688,0xFF6E7E90,0xFF4A5768,0xFF384456,
+   0xFF526072,0xFF617081,0xFF657486,0xFF647386,0xFF647586,0xFF647585,0xFF647585,
+   0xFF637685,0xFF637585,0xFF637684,0xFF627683,0xFF617582,0xFF607581,0xFF5F757F,
+   0xFF5E747D,0xFF5C747B,0xFF5C747B,0xFF566D74,0xFF597078,0xFF5C717B,0xFF5C717B,
+   0xFF5B7279,0xFF5A7379,0xFF5B727A,0xFF5B717B,0xFF5B727A,0xFF5D737A,0xFF5B7178,
+   0xFF34484F,0xFF4D6069,0xFF627580,0xFF617380,0xFF697988,0xFF4B5A69,0xFF4E5E6D,
+   0xFF606F7E,0xFF606E7E,0xFF5E6D7D,0xFF5C6B7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,
+   0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7B,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,
+   0xFF5C6A7C,0xFF5C6A7C,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF617082,0xFF485667,
+   0xFF384455,0xFF5A697A,0xFF5F6F7E,0xFF5E6F7E,0xFF5E6F7E,0xFF5E6F7E,0xFF617281,
+   0xFF627583,0xFF627582,0xFF627581,0xFF617581,0xFF617581,0xFF617581,0xFF627582,
+   0xFF627582,0xFF627582,0xFF617681,0xFF617581,0xFF617480,0xFF5F727E,0xFF5F727E,
+   0xFF5F727E,0xFF5F727E,0xFF5F727E,0xFF5F727E,0xFF5F727E,0xFF5F717F,0xFF60717F,
+   0xFF607180,0xFF617181,0xFF617181,0xFF617282,0xFF677788,0xFF4D5B6C,0xFF303D4C,
+   0xFF4F5F6F,0xFF647485,0xFF627183,0xFF627183,0xFF627183,0xFF627182,0xFF677688,
+   0xFF617082,0xFF344051,0xFF364256,0xFF5A6A81,0xFF627489,0xFF617488,0xFF617588,
+   0xFF617588,0xFF617588,0xFF617588,0xFF617587,0xFF617587,0xFF607586,0xFF5F7585,
+   0xFF5E7484,0xFF5E7383,0xFF5D7383,0xFF5C7282,0xFF5C7181,0xFF566B7B,0xFF596E7E,
+   0xFF5C7081,0xFF5C6F82,0xFF5C6F82,0xFF5D6E83,0xFF5C6F82,0xFF5C6F82,0xFF5C6F81,
+   0xFF5D7082,0xFF5B6E7F,0xFF354752,0xFF4C6168,0xFF5F777C,0xFF5D767A,0xFF647E81,
+   0xFF475E63,0xFF496266,0xFF5B7477,0xFF5A7376,0xFF587275,0xFF567073,0xFF557072,
+   0xFF567073,0xFF566F73,0xFF566F74,0xFF576F75,0xFF586E76,0xFF596D78,0xFF5A6C78,
+   0xFF5A6C79,0xFF5A6C7A,0xFF5A6C7A,0xFF5A6B79,0xFF5A6A79,0xFF5A6A79,0xFF5A6A7A,
+   0xFF617081,0xFF485668,0xFF374353,0xFF586472,0xFF5C6876,0xFF5C6876,0xFF5C6876,
+   0xFF5D6976,0xFF5F6B79,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,
+   0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF606C79,
+   0xFF5E6A78,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,
+   0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5F6A78,0xFF5F6A78,0xFF5F6B79,0xFF64707F,
+   0xFF4A5665,0xFF2F3B4A,0xFF505E70,0xFF647385,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF677688,0xFF617082,0xFF344051,0xFF313C4C,0xFF526072,0xFF627183,
+   0xFF657487,0xFF647586,0xFF647585,0xFF647585,0xFF637685,0xFF637685,0xFF637685,
+   0xFF637684,0xFF637683,0xFF627782,0xFF617880,0xFF60797F,0xFF60797F,0xFF5A7379,
+   0xFF536B71,0xFF5B737A,0xFF5B727A,0xFF5B7279,0xFF5A7378,0xFF5A7378,0xFF5A7279,
+   0xFF5B727A,0xFF5B7279,0xFF5E747B,0xFF4C6269,0xFF3E5159,0xFF5D727A,0xFF5D717B,
+   0xFF5E707B,0xFF61737F,0xFF627481,0xFF475665,0xFF5B6B79,0xFF606F7E,0xFF5F6D7E,
+   0xFF5D6B7D,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,
+   0xFF5C6A7B,0xFF5C6A7B,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5B697B,
+   0xFF5B6A7B,0xFF5B6A7B,0xFF607081,0xFF455364,0xFF364253,0xFF5A6979,0xFF5E6F7E,
+   0xFF5E6F7E,0xFF5E6F7E,0xFF617281,0xFF637584,0xFF647784,0xFF637683,0xFF627582,
+   0xFF627581,0xFF617681,0xFF617681,0xFF617681,0xFF627582,0xFF627581,0xFF617681,
+   0xFF617681,0xFF60747F,0xFF5F727E,0xFF5F727D,0xFF5E737D,0xFF5E737D,0xFF5E737D,
+   0xFF5E727D,0xFF5F727E,0xFF5F727E,0xFF60717F,0xFF60717F,0xFF607180,0xFF617281,
+   0xFF617182,0xFF677788,0xFF4B596B,0xFF344151,0xFF5B6B7B,0xFF627283,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF637284,0xFF6A7A8C,0xFF475466,0xFF2D384A,
+   0xFF4D5C72,0xFF5F7187,0xFF627489,0xFF627589,0xFF617588,0xFF617588,0xFF617587,
+   0xFF617587,0xFF617587,0xFF607687,0xFF607686,0xFF607686,0xFF607686,0xFF607686,
+   0xFF607687,0xFF5B7081,0xFF546979,0xFF5B7081,0xFF5B7081,0xFF5C6F82,0xFF5C6F82,
+   0xFF5C6F82,0xFF5C6F82,0xFF5B7080,0xFF5B707F,0xFF5D7282,0xFF4C606D,0xFF3E5159,
+   0xFF5B7378,0xFF5A7376,0xFF5A7476,0xFF5D7779,0xFF5E787B,0xFF425B5D,0xFF557072,
+   0xFF597476,0xFF587374,0xFF567173,0xFF557072,0xFF557072,0xFF567073,0xFF567073,
+   0xFF567073,0xFF576F74,0xFF586E76,0xFF596D77,0xFF5A6C79,0xFF5A6C79,0xFF5A6C79,
+   0xFF5A6C79,0xFF596C78,0xFF596C77,0xFF596C78,0xFF607180,0xFF455364,0xFF354152,
+   0xFF576372,0xFF5C6876,0xFF5C6876,0xFF5C6876,0xFF5F6B79,0xFF626D7C,0xFF636E7D,
+   0xFF626E7C,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,
+   0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF5F6B79,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,
+   0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,
+   0xFF5E6A78,0xFF5F6B79,0xFF5F6B79,0xFF64707E,0xFF495463,0xFF333F4F,0xFF5B6A7C,
+   0xFF637284,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF637284,0xFF6A7A8C,
+   0xFF475466,0xFF2B3546,0xFF333F50,0xFF455264,0xFF5A687B,0xFF647486,0xFF657686,
+   0xFF647585,0xFF637685,0xFF637685,0xFF637685,0xFF637684,0xFF637683,0xFF627782,
+   0xFF607980,0xFF607980,0xFF5A7278,0xFF526B6F,0xFF5D777B,0xFF5E787D,0xFF5C767B,
+   0xFF5B747A,0xFF5A7378,0xFF597377,0xFF5A7378,0xFF5A7279,0xFF5C7279,0xFF5B7179,
+   0xFF3C4F58,0xFF536770,0xFF5E727B,0xFF5D717B,0xFF5E707B,0xFF5E707C,0xFF647783,
+   0xFF5A6A78,0xFF50606F,0xFF606F7F,0xFF5F6D7E,0xFF5E6C7D,0xFF5C6A7B,0xFF5C6A7C,
+   0xFF5C6A7C,0xFF5C6A7C,0xFF5C6A7C,0xFF5C6B7C,0xFF5C6A7B,0xFF5C6A7B,0xFF5D6B7C,
+   0xFF5E6C7E,0xFF5E6D7F,0xFF5E6D7F,0xFF5D6C7D,0xFF5B6B7C,0xFF5B6A7B,0xFF607081,
+   0xFF435162,0xFF323E4E,0xFF586878,0xFF5E6F7E,0xFF5E6F7E,0xFF607280,0xFF637583,
+   0xFF647784,0xFF647784,0xFF647784,0xFF637683,0xFF627582,0xFF617581,0xFF617681,
+   0xFF617681,0xFF617581,0xFF617581,0xFF617681,0xFF617681,0xFF607580,0xFF5F747E,
+   0xFF5E737D,0xFF5D737C,0xFF5D737C,0xFF5E737C,0xFF5E737D,0xFF5E737D,0xFF5F727D,
+   0xFF5F717E,0xFF60717F,0xFF607180,0xFF617281,0xFF617182,0xFF667788,0xFF475566,
+   0xFF394656,0xFF5F6F80,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF677789,0xFF68788A,0xFF445163,0xFF333F51,0xFF445367,0xFF576A7E,
+   0xFF617488,0xFF627688,0xFF617587,0xFF617587,0xFF617587,0xFF607686,0xFF607686,
+   0xFF607686,0xFF607686,0xFF607686,0xFF617687,0xFF5B6F81,0xFF546779,0xFF5E7384,
+   0xFF5F7485,0xFF5D7383,0xFF5C7182,0xFF5C7081,0xFF5B7081,0xFF5B7081,0xFF5B707F,
+   0xFF5B717F,0xFF5A6F7E,0xFF3C4F59,0xFF52686E,0xFF5B7478,0xFF5A7476,0xFF5A7476,
+   0xFF5A7476,0xFF5F7B7C,0xFF546F70,0xFF4A6566,0xFF597575,0xFF587475,0xFF577273,
+   0xFF557072,0xFF557073,0xFF566F74,0xFF566F74,0xFF567074,0xFF577075,0xFF576F75,
+   0xFF586E77,0xFF5A6D79,0xFF5B6E7B,0xFF5C6F7B,0xFF5C6F7B,0xFF5B6E7A,0xFF596D77,
+   0xFF586C77,0xFF5F717F,0xFF435162,0xFF323D4E,0xFF566271,0xFF5C6876,0xFF5C6876,
+   0xFF5E6A78,0xFF626D7C,0xFF636E7D,0xFF636E7D,0xFF636E7D,0xFF626E7C,0xFF616D7B,
+   0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,
+   0xFF606C7A,0xFF5F6B78,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,
+   0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A78,0xFF5F6B79,0xFF5F6B79,
+   0xFF64707E,0xFF455160,0xFF384555,0xFF606F81,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF677789,0xFF68778A,0xFF475466,0xFF495668,
+   0xFF323E4F,0xFF374355,0xFF4A5869,0xFF5A6A7A,0xFF627383,0xFF647685,0xFF647686,
+   0xFF647585,0xFF647585,0xFF637684,0xFF627782,0xFF617881,0xFF576D75,0xFF52696F,
+   0xFF5E787D,0xFF5F7A7E,0xFF5F797E,0xFF5E7A7D,0xFF5E797D,0xFF5E777D,0xFF5C767B,
+   0xFF5B747A,0xFF5B7379,0xFF5E747B,0xFF4A5F68,0xFF3F525B,0xFF5D727A,0xFF5D717A,
+   0xFF5D707B,0xFF5E707B,0xFF5E707C,0xFF5F717E,0xFF637382,0xFF465564,0xFF5C6B7B,
+   0xFF606E7E,0xFF5E6C7D,0xFF5C6B7B,0xFF5C6A7B,0xFF5C6A7B,0xFF5C6B7C,0xFF5D6C7D,
+   0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5E6D7E,0xFF606F80,0xFF617082,0xFF617183,
+   0xFF607081,0xFF5D6C7E,0xFF5C6B7C,0xFF596979,0xFF323E4D,0xFF293443,0xFF536372,
+   0xFF5F707F,0xFF607180,0xFF637583,0xFF647784,0xFF647784,0xFF647784,0xFF647783,
+   0xFF647784,0xFF637683,0xFF617681,0xFF617681,0xFF617681,0xFF617681,0xFF617681,
+   0xFF617681,0xFF617681,0xFF627681,0xFF617680,0xFF5F757E,0xFF5E747C,0xFF5D747B,
+   0xFF5D737C,0xFF5E737C,0xFF5E737D,0xFF5E727D,0xFF5F727E,0xFF5F727E,0xFF5F727F,
+   0xFF607380,0xFF617281,0xFF657686,0xFF404D5E,0xFF3E4B5B,0xFF617082,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF68788A,
+   0xFF6C7C8E,0xFF4C5B6C,0xFF313E4D,0xFF364555,0xFF485A6D,0xFF576B7E,0xFF5F7486,
+   0xFF617687,0xFF617688,0xFF607687,0xFF607686,0xFF607685,0xFF607785,0xFF607685,
+   0xFF576C7C,0xFF536777,0xFF5E7584,0xFF607686,0xFF5F7685,0xFF5F7684,0xFF5E7684,
+   0xFF5D7583,0xFF5D7383,0xFF5C7182,0xFF5C7081,0xFF5D7281,0xFF4A5E6B,0xFF3F525B,
+   0xFF5C7379,0xFF5A7377,0xFF5A7376,0xFF5A7377,0xFF5A7376,0xFF5A7576,0xFF5D787A,
+   0xFF415A5C,0xFF567073,0xFF5A7476,0xFF587275,0xFF577074,0xFF576F74,0xFF576E75,
+   0xFF586E76,0xFF587076,0xFF587176,0xFF587076,0xFF596F78,0xFF5B707B,0xFF5D717D,
+   0xFF5F727F,0xFF5F7380,0xFF5E727E,0xFF5B6F7A,0xFF596D78,0xFF586A77,0xFF323E4D,
+   0xFF2A3443,0xFF525E6D,0xFF5D6977,0xFF5E6A78,0xFF616D7C,0xFF636E7D,0xFF636E7D,
+   0xFF636E7D,0xFF636E7D,0xFF636E7D,0xFF626E7D,0xFF616D7B,0xFF616D7B,0xFF616D7B,
+   0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF626E7C,0xFF616D7B,0xFF5F6B79,
+   0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,
+   0xFF5E6A77,0xFF5E6A78,0xFF5F6B79,0xFF5F6B79,0xFF636F7D,0xFF3E4A59,0xFF3E4B5C,
+   0xFF617082,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF68788A,0xFF6E7E90,0xFF6F7F92,0xFF5E6D80,0xFF445163,0xFF333F50,
+   0xFF354352,0xFF445363,0xFF516171,0xFF5A6B7B,0xFF607181,0xFF637484,0xFF637685,
+   0xFF5E727D,0xFF51656E,0xFF556B73,0xFF607A80,0xFF607A7F,0xFF5F797E,0xFF5F7A7E,
+   0xFF5F7A7E,0xFF5F7A7E,0xFF607A7F,0xFF607A7F,0xFF5E787D,0xFF566F74,0xFF485F65,
+   0xFF30444C,0xFF3E5159,0xFF5D727A,0xFF5E727C,0xFF5E717C,0xFF5E717B,0xFF5E707C,
+   0xFF5F6F7D,0xFF657584,0xFF414F5D,0xFF4C5B6B,0xFF606F7F,0xFF5E6D7D,0xFF5C6C7C,
+   0xFF5B6B7B,0xFF5B6B7B,0xFF5C6C7D,0xFF5D6E7E,0xFF5E6E7F,0xFF5E6F7F,0xFF5E6F7F,
+   0xFF5F6F80,0xFF607081,0xFF617182,0xFF627283,0xFF617183,0xFF5F6E80,0xFF5C6B7C,
+   0xFF4A5868,0xFF4A5868,0xFF333F50,0xFF455363,0xFF607181,0xFF637583,0xFF647784,
+   0xFF647784,0xFF647784,0xFF647784,0xFF647784,0xFF647783,0xFF637783,0xFF617681,
+   0xFF617681,0xFF617681,0xFF617680,0xFF617680,0xFF617680,0xFF617680,0xFF627781,
+   0xFF627781,0xFF617681,0xFF60757F,0xFF5E747C,0xFF5D747B,0xFF5D737C,0xFF5E737C,
+   0xFF5E737D,0xFF5F747E,0xFF607580,0xFF607581,0xFF607480,0xFF617482,0xFF5C6D7D,
+   0xFF344251,0xFF435261,0xFF617282,0xFF627182,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF667687,0xFF6E7F90,0xFF5D6E7E,
+   0xFF425260,0xFF32414F,0xFF354555,0xFF435567,0xFF4F6275,0xFF586B7E,0xFF5D7284,
+   0xFF5F7586,0xFF607786,0xFF5B7280,0xFF506573,0xFF546B79,0xFF607785,0xFF5F7785,
+   0xFF5F7784,0xFF5F7784,0xFF5E7784,0xFF5E7884,0xFF5F7884,0xFF607686,0xFF5F7486,
+   0xFF586C7E,0xFF4A5C6C,0xFF31434E,0xFF3E515A,0xFF5C7279,0xFF5C7479,0xFF5B7478,
+   0xFF5B7378,0xFF5B7377,0xFF5A7377,0xFF60797D,0xFF3D5257,0xFF485F64,0xFF5B7378,
+   0xFF597276,0xFF596F76,0xFF576E75,0xFF586E76,0xFF596F78,0xFF5A7179,0xFF5A7278,
+   0xFF5A7379,0xFF5B727A,0xFF5C727C,0xFF5E727E,0xFF5F7380,0xFF607481,0xFF5F7380,
+   0xFF5D707D,0xFF5A6D7A,0xFF485966,0xFF495967,0xFF334050,0xFF455161,0xFF5E6B79,
+   0xFF616D7B,0xFF636E7D,0xFF636E7D,0xFF636E7D,0xFF636E7D,0xFF636E7D,0xFF636E7D,
+   0xFF626E7D,0xFF616D7C,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,
+   0xFF616D7B,0xFF626E7C,0xFF626E7C,0xFF616D7B,0xFF606C79,0xFF5E6A78,0xFF5E6A77,
+   0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5F6B78,0xFF606C7A,0xFF606C7B,0xFF606C7A,
+   0xFF606C7A,0xFF5A6675,0xFF344050,0xFF445162,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF657487,
+   0xFF657486,0xFF6D7C8F,0xFF708093,0xFF647386,0xFF445262,0xFF2E3B4A,0xFF2F3C4B,
+   0xFF384655,0xFF404F5F,0xFF475766,0xFF495A68,0xFF364651,0xFF4A5D68,0xFF597078,
+   0xFF587077,0xFF587177,0xFF577176,0xFF577175,0xFF577176,0xFF567075,0xFF526B71,
+   0xFF496166,0xFF3F565B,0xFF33484E,0xFF2B3E45,0xFF26373E,0xFF2B3C44,0xFF3C4D57,
+   0xFF465962,0xFF50646D,0xFF596D76,0xFF5E707B,0xFF5F707E,0xFF60707F,0xFF3A4856,
+   0xFF394857,0xFF5C6B7B,0xFF5F6E7E,0xFF5C6C7C,0xFF5B6B7B,0xFF5B6B7B,0xFF5D6D7D,
+   0xFF5E6F7F,0xFF5F7080,0xFF5F7080,0xFF5F7080,0xFF5F7080,0xFF607181,0xFF617282,
+   0xFF627383,0xFF627283,0xFF607081,0xFF536172,0xFF5E6D7E,0xFF6E7F91,0xFF495869,
+   0xFF374554,0xFF5F707F,0xFF657785,0xFF647784,0xFF647785,0xFF647784,0xFF647783,
+   0xFF647783,0xFF637683,0xFF627682,0xFF617681,0xFF617681,0xFF617680,0xFF617680,
+   0xFF617680,0xFF617680,0xFF617680,0xFF627782,0xFF627782,0xFF627782,0xFF627682,
+   0xFF607580,0xFF5F747D,0xFF5E737C,0xFF5E747D,0xFF5F757F,0xFF617681,0xFF617681,
+   0xFF617681,0xFF617581,0xFF637684,0xFF4D5E6D,0xFF2E3C4A,0xFF465665,0xFF627283,
+   0xFF627182,0xFF627182,0xFF617082,0xFF617082,0xFF617082,0xFF617081,0xFF616F81,
+   0xFF606F80,0xFF606F80,0xFF637484,0xFF6B7E8C,0xFF6E8290,0xFF637583,0xFF435361,
+   0xFF2E3C4B,0xFF2F3E4F,0xFF39485C,0xFF405165,0xFF46596B,0xFF485C6D,0xFF374958,
+   0xFF495F6D,0xFF586F7D,0xFF586F7D,0xFF586F7C,0xFF576F7B,0xFF576F7B,0xFF576F7A,
+   0xFF566E7A,0xFF526A77,0xFF4B5F6F,0xFF425464,0xFF364555,0xFF2E3C49,0xFF273641,
+   0xFF2B3B45,0xFF3B4E56,0xFF455A61,0xFF4F656B,0xFF586E75,0xFF5C7279,0xFF5C7379,
+   0xFF5C7479,0xFF364B51,0xFF354B51,0xFF587075,0xFF5B7278,0xFF5A6F78,0xFF586E75,
+   0xFF576F75,0xFF5A7079,0xFF5C717B,0xFF5C727C,0xFF5D727C,0xFF5D727C,0xFF5D727C,
+   0xFF5E737E,0xFF607380,0xFF607481,0xFF607480,0xFF5E727F,0xFF516370,0xFF5C6F7C,
+   0xFF6C808F,0xFF495868,0xFF384455,0xFF5E6B7B,0xFF636E7D,0xFF636E7D,0xFF636E7D,
+   0xFF636E7D,0xFF636E7D,0xFF636E7D,0xFF626E7D,0xFF626E7C,0xFF616D7B,0xFF616D7B,
+   0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF626E7C,0xFF626E7C,
+   0xFF626E7C,0xFF626E7C,0xFF606C7A,0xFF5F6B78,0xFF5E6A77,0xFF5F6B78,0xFF606C7A,
+   0xFF616D7B,0xFF616D7C,0xFF616D7C,0xFF606C7B,0xFF626E7D,0xFF4C5968,0xFF2F3A4B,
+   0xFF475566,0xFF627183,0xFF627183,0xFF627183,0xFF617082,0xFF617082,0xFF617082,
+   0xFF617082,0xFF616F81,0xFF606F81,0xFF606F81,0xFF606E81,0xFF627183,0xFF657487,
+   0xFF6D7D8F,0xFF6C7C8E,0xFF3F4D5E,0xFF212B38,0xFF1D2632,0xFF222D39,0xFF293643,
+   0xFF2B3945,0xFF26343F,0xFF31434D,0xFF344851,0xFF364A52,0xFF354A51,0xFF354C51,
+   0xFF354C51,0xFF354C50,0xFF354C51,0xFF374C52,0xFF3B5056,0xFF3C5258,0xFF3D545A,
+   0xFF435A60,0xFF465D63,0xFF42575F,0xFF3A4F57,0xFF32464E,0xFF2E4149,0xFF33454E,
+   0xFF3D4F59,0xFF445461,0xFF3F4E5D,0xFF2D3A48,0xFF2E3C4A,0xFF4B5B6A,0xFF5E6E7D,
+   0xFF5C6C7C,0xFF5A6A7A,0xFF5A6A7A,0xFF5C6C7B,0xFF5E6F7E,0xFF5F707F,0xFF5F7080,
+   0xFF5F707F,0xFF5F7180,0xFF607281,0xFF617383,0xFF627283,0xFF637385,0xFF596879,
+   0xFF576678,0xFF637385,0xFF677789,0xFF627384,0xFF344251,0xFF4F606F,0xFF647785,
+   0xFF647684,0xFF637684,0xFF637683,0xFF637682,0xFF637683,0xFF637683,0xFF627682,
+   0xFF617581,0xFF617581,0xFF617681,0xFF617680,0xFF617680,0xFF617680,0xFF617680,
+   0xFF627782,0xFF627782,0xFF627682,0xFF627782,0xFF627682,0xFF617681,0xFF607580,
+   0xFF617680,0xFF617681,0xFF617681,0xFF617681,0xFF617681,0xFF627683,0xFF5D6F7D,
+   0xFF374754,0xFF293643,0xFF465666,0xFF617282,0xFF607081,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E7F,0xFF606F7F,
+   0xFF617281,0xFF647685,0xFF6C7E8D,0xFF6B7D8D,0xFF3F4E5D,0xFF212B39,0xFF1D2634,
+   0xFF222E3C,0xFF2A3847,0xFF2C3C4B,0xFF273745,0xFF314450,0xFF354954,0xFF364A54,
+   0xFF364953,0xFF374A54,0xFF374A54,0xFF374A53,0xFF364B53,0xFF384C55,0xFF3D4F5A,
+   0xFF3F4F5C,0xFF40515E,0xFF465764,0xFF485B67,0xFF435661,0xFF3A4E57,0xFF32464E,
+   0xFF2E4149,0xFF33454E,0xFF3D5058,0xFF41565E,0xFF3B5258,0xFF293D43,0xFF2B3F45,
+   0xFF475E65,0xFF5B7178,0xFF5A6F77,0xFF576D75,0xFF576E74,0xFF596E78,0xFF5C707C,
+   0xFF5E717E,0xFF5E717E,0xFF5E717E,0xFF5E727E,0xFF5F737F,0xFF5F7480,0xFF5F7480,
+   0xFF617582,0xFF576A76,0xFF556875,0xFF627583,0xFF667888,0xFF627483,0xFF344152,
+   0xFF4F5D6E,0xFF636F7E,0xFF626E7D,0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF626E7C,
+   0xFF626E7C,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,
+   0xFF616D7B,0xFF616D7B,0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF626E7C,
+   0xFF616D7B,0xFF606C7B,0xFF616D7B,0xFF616D7C,0xFF616D7C,0xFF616D7C,0xFF616D7C,
+   0xFF626E7D,0xFF5C6777,0xFF384354,0xFF2A3545,0xFF485567,0xFF627183,0xFF617082,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E81,0xFF627183,0xFF647386,0xFF6E7D90,0xFF516071,
+   0xFF273240,0xFF1A222E,0xFF26323F,0xFF354552,0xFF465965,0xFF546873,0xFF596F78,
+   0xFF5F777E,0xFF607980,0xFF5F787F,0xFF60797F,0xFF607A80,0xFF617D80,0xFF627D81,
+   0xFF657F84,0xFF678287,0xFF678287,0xFF647E84,0xFF637C81,0xFF637C81,0xFF647C82,
+   0xFF637B81,0xFF60787E,0xFF597076,0xFF4B6168,0xFF3C5159,0xFF2E3F4A,0xFF273440,
+   0xFF1D2632,0xFF212D39,0xFF364554,0xFF526171,0xFF5C6C7C,0xFF5A6A79,0xFF5A6A78,
+   0xFF5A6C79,0xFF5C6E7B,0xFF5E707E,0xFF5F707F,0xFF5E717E,0xFF5E727F,0xFF607380,
+   0xFF617382,0xFF627283,0xFF627284,0xFF516071,0xFF5E6E80,0xFF627284,0xFF627384,
+   0xFF6A7C8C,0xFF425261,0xFF394856,0xFF5D6F7D,0xFF647684,0xFF637683,0xFF637682,
+   0xFF627682,0xFF637683,0xFF637683,0xFF627582,0xFF617581,0xFF617681,0xFF617680,
+   0xFF617680,0xFF617680,0xFF60777F,0xFF617780,0xFF627781,0xFF627782,0xFF637683,
+   0xFF637683,0xFF637683,0xFF637683,0xFF627682,0xFF617681,0xFF617682,0xFF617681,
+   0xFF617681,0xFF617682,0xFF627683,0xFF516270,0xFF4E5F6C,0xFF41515E,0xFF3F4E5D,
+   0xFF5E6F7F,0xFF5F7080,0xFF5F7080,0xFF5F7080,0xFF5F7080,0xFF5F6F80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E7F,0xFF5F6F7F,0xFF5F6F7F,0xFF617281,0xFF637484,
+   0xFF6D7E8F,0xFF516171,0xFF273240,0xFF1A222E,0xFF26323E,0xFF354552,0xFF465965,
+   0xFF546873,0xFF596E78,0xFF5F767F,0xFF617881,0xFF617781,0xFF617881,0xFF627982,
+   0xFF647A84,0xFF647B85,0xFF667D87,0xFF6A808A,0xFF6A7F8B,0xFF677B88,0xFF667985,
+   0xFF667985,0xFF667B85,0xFF657A84,0xFF627680,0xFF596F78,0xFF4C6069,0xFF3D5059,
+   0xFF2D4048,0xFF25363D,0xFF1B282F,0xFF1F2F35,0xFF33484F,0xFF4F646C,0xFF5A6E78,
+   0xFF586D76,0xFF576C75,0xFF596D77,0xFF5B6F7B,0xFF5E707E,0xFF5F7080,0xFF5F707F,
+   0xFF5E727F,0xFF5F747F,0xFF5F757F,0xFF5E757E,0xFF607580,0xFF4F626D,0xFF5D707D,
+   0xFF617383,0xFF627384,0xFF6A7C8C,0xFF445162,0xFF3A4657,0xFF5C6978,0xFF626E7C,
+   0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF616D7B,0xFF616D7B,
+   0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF626E7C,
+   0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF616D7C,0xFF616D7C,
+   0xFF616D7C,0xFF616D7C,0xFF616D7C,0xFF616D7C,0xFF626D7D,0xFF515D6E,0xFF505D6E,
+   0xFF434F61,0xFF404D5F,0xFF5F6E80,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E81,0xFF627083,0xFF69798B,0xFF546375,0xFF2A3645,0xFF2B3846,0xFF415160,
+   0xFF5D707D,0xFF687C89,0xFF687D88,0xFF657C86,0xFF637C83,0xFF627D82,0xFF637D82,
+   0xFF627C82,0xFF627C81,0xFF617C81,0xFF617B80,0xFF607A7F,0xFF5F797E,0xFF5E787D,
+   0xFF5C757A,0xFF5A7277,0xFF5A7377,0xFF5B7378,0xFF5C7478,0xFF5D767A,0xFF61797E,
+   0xFF647C82,0xFF667D84,0xFF5D727B,0xFF3E4F5B,0xFF283641,0xFF1C2631,0xFF26333F,
+   0xFF3A4A58,0xFF536373,0xFF5B6B7B,0xFF5A6A78,0xFF596B77,0xFF5A6D78,0xFF5C6F7C,
+   0xFF5E707E,0xFF5E717E,0xFF5E727E,0xFF5F7380,0xFF607381,0xFF617283,0xFF5B6A7B,
+   0xFF515F70,0xFF617183,0xFF627283,0xFF617283,0xFF677A89,0xFF586A79,0xFF303F4D,
+   0xFF475866,0xFF627481,0xFF637682,0xFF627782,0xFF627782,0xFF627782,0xFF627782,
+   0xFF617681,0xFF617681,0xFF617681,0xFF617680,0xFF617680,0xFF617680,0xFF60777F,
+   0xFF60777F,0xFF617780,0xFF627782,0xFF637683,0xFF637684,0xFF637683,0xFF637683,
+   0xFF627583,0xFF617582,0xFF617582,0xFF617682,0xFF617682,0xFF637784,0xFF586A78,
+   0xFF5B6D7B,0xFF6A7D8B,0xFF637583,0xFF3B4A58,0xFF596A79,0xFF5F7080,0xFF5F7080,
+   0xFF5F7080,0xFF5F7080,0xFF5F6F80,0xFF5F6F7F,0xFF606E7F,0xFF606E7F,0xFF606E7F,
+   0xFF606E7F,0xFF5F6F7F,0xFF606F7F,0xFF617181,0xFF687A8A,0xFF536474,0xFF2A3645,
+   0xFF2B3846,0xFF41515F,0xFF5D707D,0xFF687D89,0xFF687D88,0xFF667C87,0xFF647B85,
+   0xFF647B84,0xFF647C84,0xFF637C83,0xFF637B83,0xFF637984,0xFF637984,0xFF627882,
+   0xFF627782,0xFF617582,0xFF5F727F,0xFF5E6F7D,0xFF5E6F7C,0xFF5E707C,0xFF5F727D,
+   0xFF60747E,0xFF627780,0xFF657B83,0xFF677D86,0xFF5D727B,0xFF3C5159,0xFF273740,
+   0xFF1B272F,0xFF24343C,0xFF374C54,0xFF51656F,0xFF596D78,0xFF586C75,0xFF586C75,
+   0xFF5A6D78,0xFF5D6E7C,0xFF5F6F7F,0xFF5F7080,0xFF5F717F,0xFF5F747F,0xFF5E757E,
+   0xFF5E757E,0xFF586C77,0xFF4F616D,0xFF607281,0xFF617383,0xFF627283,0xFF68798A,
+   0xFF5A697B,0xFF323E4F,0xFF485565,0xFF616D7B,0xFF626E7C,0xFF626E7C,0xFF626E7C,
+   0xFF626E7C,0xFF626E7C,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,
+   0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF626E7B,0xFF626E7C,0xFF626E7C,0xFF626E7C,
+   0xFF626E7C,0xFF626E7C,0xFF616D7C,0xFF616D7C,0xFF616D7C,0xFF616D7C,0xFF616D7C,
+   0xFF626E7D,0xFF576473,0xFF5D6B7D,0xFF6C7B8E,0xFF647386,0xFF3C495A,0xFF5A697B,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF667487,
+   0xFF495769,0xFF2F3D4C,0xFF465565,0xFF617381,0xFF647784,0xFF617480,0xFF60757F,
+   0xFF60767F,0xFF5F777E,0xFF5F797E,0xFF5F797E,0xFF5E797D,0xFF5F797E,0xFF5F797F,
+   0xFF5F797F,0xFF5F797E,0xFF5F787D,0xFF5C757B,0xFF5A7377,0xFF597276,0xFF597376,
+   0xFF597376,0xFF597376,0xFF597277,0xFF5A7377,0xFF5B7378,0xFF5D737A,0xFF657A83,
+   0xFF657984,0xFF445763,0xFF2C3A46,0xFF1E2935,0xFF283543,0xFF3C4C5B,0xFF556575,
+   0xFF5A6C78,0xFF586B76,0xFF596C77,0xFF5B6D79,0xFF5C6E7C,0xFF5D6F7D,0xFF5E717E,
+   0xFF5F737F,0xFF5F7280,0xFF607281,0xFF536273,0xFF5A6879,0xFF5F6F7F,0xFF607081,
+   0xFF607282,0xFF637685,0xFF647786,0xFF374754,0xFF334350,0xFF50626F,0xFF637682,
+   0xFF627682,0xFF627782,0xFF627782,0xFF627781,0xFF617681,0xFF617680,0xFF617680,
+   0xFF617681,0xFF617681,0xFF60777F,0xFF60777D,0xFF60777D,0xFF60777F,0xFF627781,
+   0xFF627682,0xFF637682,0xFF637682,0xFF637682,0xFF627682,0xFF617582,0xFF617682,
+   0xFF617582,0xFF637683,0xFF5B6E7C,0xFF364552,0xFF4A5B68,0xFF5F727F,0xFF677A88,
+   0xFF425260,0xFF526472,0xFF5F7180,0xFF5F7080,0xFF5F707F,0xFF5F707F,0xFF5F6F7F,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF606E7F,0xFF606E7F,0xFF606E7F,0xFF606E7F,0xFF5F6F7F,
+   0xFF5F6F7F,0xFF657586,0xFF485768,0xFF2F3D4C,0xFF455664,0xFF617381,0xFF647784,
+   0xFF60757F,0xFF60757F,0xFF607580,0xFF607680,0xFF607880,0xFF60787F,0xFF607880,
+   0xFF607781,0xFF617682,0xFF617682,0xFF617782,0xFF617582,0xFF607280,0xFF5E707D,
+   0xFF5D6F7D,0xFF5E6E7D,0xFF5E6E7D,0xFF5D6F7C,0xFF5D707B,0xFF5C717A,0xFF5D717A,
+   0xFF5E727C,0xFF657983,0xFF647983,0xFF445862,0xFF2B3B45,0xFF1D2A33,0xFF263740,
+   0xFF3A4E58,0xFF546772,0xFF586D76,0xFF576D74,0xFF586C76,0xFF5B6C7A,0xFF5E6D7D,
+   0xFF5E6E7E,0xFF5F707F,0xFF5F7280,0xFF5F737F,0xFF5E737F,0xFF526470,0xFF596978,
+   0xFF5F6F7F,0xFF607081,0xFF617183,0xFF647486,0xFF657688,0xFF384556,0xFF354152,
+   0xFF515D6D,0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF616D7B,
+   0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7A,0xFF616D7A,
+   0xFF616D7B,0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF616D7C,
+   0xFF616D7C,0xFF616D7C,0xFF616D7C,0xFF626E7D,0xFF5B6777,0xFF374253,0xFF4C5A6B,
+   0xFF617083,0xFF69788A,0xFF445162,0xFF546374,0xFF617082,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF616F81,0xFF606E80,0xFF394557,0xFF414F60,0xFF617281,
+   0xFF637583,0xFF617480,0xFF617480,0xFF60757F,0xFF60757E,0xFF5F767E,0xFF5F777E,
+   0xFF5F797E,0xFF5F797D,0xFF5F797D,0xFF5F787E,0xFF5F777E,0xFF5F787E,0xFF5F777E,
+   0xFF5D747B,0xFF5A7278,0xFF597276,0xFF597376,0xFF597376,0xFF597376,0xFF597277,
+   0xFF597277,0xFF5B7278,0xFF5B7179,0xFF5C717A,0xFF61767F,0xFF647983,0xFF455964,
+   0xFF2B3B45,0xFF1E2933,0xFF2B3945,0xFF40515F,0xFF576975,0xFF596C76,0xFF586B76,
+   0xFF596B77,0xFF5A6C79,0xFF5B6C7A,0xFF5B6E7A,0xFF5D707C,0xFF5E717E,0xFF5A6C7A,
+   0xFF50606F,0xFF5E6E7E,0xFF5E6E7E,0xFF5E6E7E,0xFF5F6F7F,0xFF607281,0xFF687A89,
+   0xFF435361,0xFF2A3844,0xFF3A4A57,0xFF576A76,0xFF637783,0xFF627682,0xFF627782,
+   0xFF627781,0xFF617680,0xFF617680,0xFF617680,0xFF617680,0xFF60767F,0xFF60777E,
+   0xFF60777D,0xFF60777D,0xFF60777D,0xFF61777F,0xFF627781,0xFF627782,0xFF627782,
+   0xFF627782,0xFF617682,0xFF617682,0xFF617681,0xFF627682,0xFF566876,0xFF394855,
+   0xFF313F4B,0xFF3C4B58,0xFF435460,0xFF50626E,0xFF3C4C59,0xFF50616F,0xFF5F7180,
+   0xFF5F707F,0xFF5F707F,0xFF5F7080,0xFF5F707F,0xFF5F6F7E,0xFF5F6F7F,0xFF606E7F,
+   0xFF606E7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF60707F,0xFF5F6F7F,0xFF384656,
+   0xFF40505F,0xFF617281,0xFF637583,0xFF617480,0xFF61747F,0xFF60757F,0xFF60747F,
+   0xFF60757F,0xFF60777F,0xFF607780,0xFF617781,0xFF617681,0xFF617681,0xFF617681,
+   0xFF617681,0xFF617581,0xFF5F727F,0xFF5D6F7D,0xFF5E6E7D,0xFF5E6E7E,0xFF5E6E7E,
+   0xFF5D6F7D,0xFF5D6F7B,0xFF5C707B,0xFF5C707B,0xFF5C707B,0xFF5D707B,0xFF627681,
+   0xFF647984,0xFF455963,0xFF2A3B45,0xFF1D2A32,0xFF293A44,0xFF3F525D,0xFF556A72,
+   0xFF576D74,0xFF586C76,0xFF5A6A79,0xFF5C6A7B,0xFF5C6B7B,0xFF5D6C7C,0xFF5E6F7F,
+   0xFF5F707F,0xFF5A6C7A,0xFF50606F,0xFF5E6E7E,0xFF5F6D7E,0xFF5F6D7F,0xFF606E80,
+   0xFF617183,0xFF69798B,0xFF445163,0xFF2C3647,0xFF3B4859,0xFF576373,0xFF626E7C,
+   0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,
+   0xFF616D7B,0xFF616D7A,0xFF616D7A,0xFF616D7A,0xFF616D7A,0xFF616D7B,0xFF626E7C,
+   0xFF626E7C,0xFF626E7C,0xFF626E7C,0xFF616D7C,0xFF616D7C,0xFF616D7C,0xFF616D7C,
+   0xFF566170,0xFF3A4556,0xFF333D4E,0xFF3D495A,0xFF455263,0xFF526071,0xFF3E4B5C,
+   0xFF516071,0xFF617082,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF627082,
+   0xFF586678,0xFF364253,0xFF5B6A7A,0xFF647584,0xFF627381,0xFF617480,0xFF617480,
+   0xFF60747F,0xFF60757F,0xFF60757E,0xFF5F767E,0xFF5F777E,0xFF5F787D,0xFF5F787E,
+   0xFF5F787E,0xFF5F777E,0xFF60777F,0xFF60767F,0xFF5E747C,0xFF5B7279,0xFF5A7277,
+   0xFF597277,0xFF5A7277,0xFF597277,0xFF597277,0xFF597277,0xFF5A7278,0xFF5A7178,
+   0xFF5A7178,0xFF597177,0xFF5F767D,0xFF637982,0xFF425860,0xFF273941,0xFF1D2A33,
+   0xFF2E3D49,0xFF435562,0xFF576975,0xFF596C77,0xFF596B78,0xFF5A6A78,0xFF5A6B78,
+   0xFF596C78,0xFF596E78,0xFF5A6F79,0xFF516470,0xFF536371,0xFF5E6E7D,0xFF5E6E7D,
+   0xFF5E6E7E,0xFF5E6E7D,0xFF5E6F7E,0xFF667787,0xFF495A69,0xFF25313D,0xFF283542,
+   0xFF3E4F5C,0xFF576B76,0xFF627782,0xFF627781,0xFF617780,0xFF607780,0xFF607680,
+   0xFF617680,0xFF607680,0xFF60777E,0xFF60777E,0xFF60777E,0xFF5F777D,0xFF5F777D,
+   0xFF60777E,0xFF617780,0xFF627781,0xFF627781,0xFF627782,0xFF627683,0xFF627782,
+   0xFF607580,0xFF4C5E6A,0xFF3A4956,0xFF4C5D6B,0xFF647785,0xFF677B88,0xFF5F717E,
+   0xFF445460,0xFF293742,0xFF495B68,0xFF5F7180,0xFF5F707F,0xFF5F707F,0xFF5F7080,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,
+   0xFF5F6F7E,0xFF617180,0xFF576777,0xFF354352,0xFF5A6B79,0xFF637583,0xFF617381,
+   0xFF617480,0xFF617480,0xFF617480,0xFF61747F,0xFF60747F,0xFF60757F,0xFF617680,
+   0xFF617681,0xFF627581,0xFF617581,0xFF617581,0xFF617681,0xFF617581,0xFF5F727F,
+   0xFF5D707C,0xFF5D6F7C,0xFF5D6F7D,0xFF5E6E7D,0xFF5D6F7C,0xFF5D6F7C,0xFF5D6F7B,
+   0xFF5D6F7B,0xFF5C6F7B,0xFF5C6F7B,0xFF5C6E7A,0xFF607480,0xFF647884,0xFF435762,
+   0xFF283842,0xFF1E2934,0xFF2D3D49,0xFF425660,0xFF566A74,0xFF5A6B78,0xFF5B6979,
+   0xFF5B697A,0xFF5B697A,0xFF5B6A7A,0xFF5C6B7B,0xFF5D6D7C,0xFF536272,0xFF546372,
+   0xFF5F6D7E,0xFF5F6D7F,0xFF5F6D7F,0xFF5F6D7F,0xFF5F6D7F,0xFF677688,0xFF4B596B,
+   0xFF26303F,0xFF2A3444,0xFF404C5E,0xFF586473,0xFF626E7C,0xFF626E7C,0xFF626E7C,
+   0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7B,0xFF616D7A,0xFF616D7A,0xFF616D7A,
+   0xFF616D7A,0xFF616D7A,0xFF616D7A,0xFF616D7B,0xFF626E7C,0xFF626E7C,0xFF626E7C,
+   0xFF626E7C,0xFF626E7D,0xFF606C7B,0xFF4C5766,0xFF3B4656,0xFF4E5B6D,0xFF667588,
+   0xFF69798C,0xFF616F81,0xFF455263,0xFF2B3545,0xFF4B596A,0xFF617082,0xFF606F81,
+   0xFF606F81,0xFF606F81,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF637284,0xFF4C596B,0xFF3C4959,0xFF627181,
+   0xFF627382,0xFF627381,0xFF617480,0xFF617480,0xFF617480,0xFF60757F,0xFF60757E,
+   0xFF5F757E,0xFF60777E,0xFF60777E,0xFF5F777E,0xFF5F787E,0xFF5F777E,0xFF60777F,
+   0xFF60767F,0xFF5E747D,0xFF5C727A,0xFF5B7179,0xFF5A7178,0xFF5A7278,0xFF5A7277,
+   0xFF597276,0xFF597277,0xFF597277,0xFF5A7278,0xFF5A7277,0xFF597176,0xFF597177,
+   0xFF5F767E,0xFF617780,0xFF3C5259,0xFF23323B,0xFF1D2833,0xFF2D3A48,0xFF435361,
+   0xFF576975,0xFF5A6B78,0xFF596B78,0xFF5A6B78,0xFF596C78,0xFF586D77,0xFF596D78,
+   0xFF4E606D,0xFF576975,0xFF5D6E7B,0xFF5D6E7C,0xFF5E6E7D,0xFF5E6E7D,0xFF5E6E7E,
+   0xFF617282,0xFF445462,0xFF222E3A,0xFF1A232E,0xFF293642,0xFF3D4E5B,0xFF546873,
+   0xFF617780,0xFF617880,0xFF60777F,0xFF60777F,0xFF60777F,0xFF60777F,0xFF60777E,
+   0xFF60777E,0xFF60777E,0xFF5F777D,0xFF5F787D,0xFF60787E,0xFF61787F,0xFF617781,
+   0xFF627782,0xFF607480,0xFF5A6D7A,0xFF526571,0xFF4A5D68,0xFF4D606B,0xFF607380,
+   0xFF667A87,0xFF617482,0xFF5F727F,0xFF637784,0xFF687C89,0xFF40505D,0xFF3A4A56,
+   0xFF5B6D7A,0xFF5E717F,0xFF5E717F,0xFF5F707F,0xFF5F707F,0xFF5F6F7F,0xFF5F6F7F,
+   0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7F,0xFF5E707E,0xFF627482,0xFF4B5B69,
+   0xFF3B4A58,0xFF617280,0xFF627381,0xFF627381,0xFF617381,0xFF617480,0xFF617480,
+   0xFF60747F,0xFF60757F,0xFF60757F,0xFF617680,0xFF617680,0xFF617681,0xFF617581,
+   0xFF617581,0xFF617681,0xFF617581,0xFF60737F,0xFF5E707D,0xFF5D6F7B,0xFF5D6F7B,
+   0xFF5D6F7C,0xFF5D6F7C,0xFF5D6F7C,0xFF5D6F7C,0xFF5D6F7B,0xFF5D6F7B,0xFF5C6F7B,
+   0xFF5C6E7B,0xFF5C6E7B,0xFF617481,0xFF627682,0xFF3E505C,0xFF24313D,0xFF1E2733,
+   0xFF2D3B48,0xFF435361,0xFF596877,0xFF5B697A,0xFF5B697A,0xFF5B6A7A,0xFF5B6A7A,
+   0xFF5B6A7A,0xFF5B6B7B,0xFF4F5F6E,0xFF586777,0xFF5E6C7D,0xFF5E6C7E,0xFF5F6D7F,
+   0xFF5F6D7F,0xFF5F6D7F,0xFF627183,0xFF455264,0xFF242C3B,0xFF1B2230,0xFF2B3545,
+   0xFF3F4B5D,0xFF556171,0xFF626E7C,0xFF626E7C,0xFF616D7B,0xFF616D7B,0xFF616D7B,
+   0xFF616D7A,0xFF616D7A,0xFF616D7A,0xFF616D7A,0xFF616D7A,0xFF616D7A,0xFF616D7A,
+   0xFF626E7B,0xFF626E7C,0xFF626E7C,0xFF606B7A,0xFF5A6574,0xFF525D6C,0xFF4A5665,
+   0xFF4F5B6C,0xFF637184,0xFF68788A,0xFF637285,0xFF617082,0xFF657587,0xFF6A7A8C,
+   0xFF424E60,0xFF3C4859,0xFF5D6B7E,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF617081,0xFF617081,0xFF617081,
+   0xFF627182,0xFF384454,0xFF465464,0xFF647383,0xFF627382,0xFF627381,0xFF617480,
+   0xFF617480,0xFF60757F,0xFF60757E,0xFF5F757E,0xFF5F767E,0xFF60767F,0xFF60777F,
+   0xFF60777F,0xFF60777F,0xFF60777F,0xFF60777F,0xFF60777E,0xFF5E757D,0xFF5C727A,
+   0xFF5B7179,0xFF5B7178,0xFF5B7178,0xFF5A7278,0xFF597277,0xFF597277,0xFF597277,
+   0xFF597277,0xFF597277,0xFF597177,0xFF5A7077,0xFF5A7078,0xFF627881,0xFF5A6F7A,
+   0xFF33444F,0xFF1F2A36,0xFF293543,0xFF2D3A48,0xFF3E4D5B,0xFF566774,0xFF5A6C79,
+   0xFF5A6B79,0xFF596C78,0xFF596C78,0xFF576A77,0xFF536672,0xFF5C6E7A,0xFF5C6E7B,
+   0xFF5C6E7B,0xFF5D6D7C,0xFF5E6E7E,0xFF5F6F7F,0xFF546474,0xFF374554,0xFF1C2632,
+   0xFF17202B,0xFF19232D,0xFF273440,0xFF3A4B57,0xFF4D626C,0xFF5D747D,0xFF607780,
+   0xFF60777F,0xFF60777E,0xFF60777E,0xFF60777E,0xFF60787E,0xFF60777E,0xFF5E767C,
+   0xFF5B7479,0xFF587075,0xFF546B72,0xFF4E646D,0xFF485A66,0xFF445562,0xFF475865,
+   0xFF566875,0xFF627582,0xFF667A86,0xFF637784,0xFF607481,0xFF5F727F,0xFF5E717E,
+   0xFF5E717E,0xFF657885,0xFF5A6D7B,0xFF33434F,0xFF4C5E6B,0xFF5E727F,0xFF5E717E,
+   0xFF5E717F,0xFF5E717E,0xFF5F707E,0xFF5F717E,0xFF5F717E,0xFF60717F,0xFF60717F,
+   0xFF60717F,0xFF5F727E,0xFF60737F,0xFF364551,0xFF455563,0xFF637482,0xFF627381,
+   0xFF627382,0xFF627381,0xFF617381,0xFF617480,0xFF60757F,0xFF60757F,0xFF60757F,
+   0xFF607680,0xFF617680,0xFF617680,0xFF617681,0xFF617581,0xFF617581,0xFF627581,
+   0xFF607380,0xFF5E707D,0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7C,0xFF5D6F7C,
+   0xFF5D6F7C,0xFF5D6F7B,0xFF5D6F7C,0xFF5C6F7B,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7B,
+   0xFF647683,0xFF5C6E7D,0xFF344252,0xFF202937,0xFF293543,0xFF2E3949,0xFF3F4C5C,
+   0xFF576576,0xFF5C6A7B,0xFF5B6A7A,0xFF5B6A7A,0xFF5B6B7A,0xFF586979,0xFF546574,
+   0xFF5D6C7C,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7E,0xFF5F6D7F,0xFF606E80,0xFF556375,
+   0xFF384455,0xFF1D2533,0xFF181F2C,0xFF1A222F,0xFF293342,0xFF3C485A,0xFF4F5C6C,
+   0xFF5F6B79,0xFF616D7B,0xFF616D7B,0xFF616D7A,0xFF616D7A,0xFF616D7A,0xFF626E7B,
+   0xFF616D7A,0xFF606C79,0xFF5E6977,0xFF5A6673,0xFF56616F,0xFF505C6B,0xFF495464,
+   0xFF455161,0xFF485464,0xFF576475,0xFF637183,0xFF68778A,0xFF657587,0xFF637284,
+   0xFF617082,0xFF606F81,0xFF606F81,0xFF677688,0xFF5C6B7E,0xFF354152,0xFF4F5C6E,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F80,0xFF616F81,0xFF616F81,
+   0xFF616F81,0xFF617081,0xFF617081,0xFF617081,0xFF596778,0xFF333E4F,0xFF505E6F,
+   0xFF647383,0xFF627382,0xFF627381,0xFF617480,0xFF617480,0xFF60757F,0xFF60757E,
+   0xFF5F767D,0xFF5F767E,0xFF60767F,0xFF617680,0xFF617681,0xFF607680,0xFF60777F,
+   0xFF5F787E,0xFF5F787D,0xFF5D767C,0xFF5B7379,0xFF5A7178,0xFF5B7178,0xFF5B7179,
+   0xFF5A7178,0xFF597277,0xFF597277,0xFF597277,0xFF597277,0xFF597277,0xFF597177,
+   0xFF597177,0xFF5A7077,0xFF5B7079,0xFF667986,0xFF4A5C69,0xFF2A3845,0xFF475766,
+   0xFF596979,0xFF445462,0xFF3B4A58,0xFF50616E,0xFF5A6C79,0xFF596C79,0xFF5A6D79,
+   0xFF526572,0xFF596C78,0xFF5B6D7A,0xFF5C6E7A,0xFF5D6E7B,0xFF5E6E7D,0xFF5C6C7C,
+   0xFF4F5E6F,0xFF3B4859,0xFF252F3D,0xFF19222D,0xFF1A232E,0xFF1A232E,0xFF1A242F,
+   0xFF232F3A,0xFF32434E,0xFF435860,0xFF526871,0xFF586D77,0xFF5C727B,0xFF5D737C,
+   0xFF596F77,0xFF526970,0xFF4B626A,0xFF445B62,0xFF3D555A,0xFF374D53,0xFF32464D,
+   0xFF2F414A,0xFF3D4E59,0xFF5D6F7C,0xFF677A87,0xFF677888,0xFF647685,0xFF627583,
+   0xFF617482,0xFF5F737F,0xFF5E717E,0xFF5E717E,0xFF5E707E,0xFF607380,0xFF637684,
+   0xFF394A56,0xFF3C4D5A,0xFF5B6E7B,0xFF5E717E,0xFF5E717F,0xFF5F717F,0xFF5F717F,
+   0xFF5F717F,0xFF60717F,0xFF60717F,0xFF60717F,0xFF60717F,0xFF5F727E,0xFF576975,
+   0xFF31404C,0xFF4E5F6C,0xFF627482,0xFF627381,0xFF627382,0xFF627382,0xFF627381,
+   0xFF617480,0xFF61747F,0xFF60757F,0xFF60757F,0xFF617580,0xFF617681,0xFF617681,
+   0xFF617681,0xFF617581,0xFF627582,0xFF627582,0xFF607380,0xFF5E707D,0xFF5D6F7B,
+   0xFF5C6F7B,0xFF5C707B,0xFF5C6F7B,0xFF5D6F7C,0xFF5D6F7C,0xFF5D6F7C,0xFF5D6E7C,
+   0xFF5C6E7C,0xFF5C6F7B,0xFF5C6E7B,0xFF5C6E7B,0xFF5D6E7D,0xFF677888,0xFF4C5A6B,
+   0xFF2C3746,0xFF485667,0xFF596879,0xFF465263,0xFF3D495A,0xFF516070,0xFF5B6B7A,
+   0xFF5B6B7A,0xFF5B6C7B,0xFF536474,0xFF5A6A7A,0xFF5D6B7C,0xFF5E6C7C,0xFF5E6C7D,
+   0xFF5F6D7E,0xFF5D6B7D,0xFF505E70,0xFF3C485A,0xFF262F3E,0xFF1A212F,0xFF1B2230,
+   0xFF1B2230,0xFF1B2330,0xFF242E3D,0xFF354152,0xFF465263,0xFF54606F,0xFF596473,
+   0xFF5D6877,0xFF5D6977,0xFF5A6674,0xFF54606E,0xFF4E5968,0xFF475262,0xFF414C5B,
+   0xFF3B4656,0xFF354050,0xFF323E4E,0xFF3F4C5D,0xFF5F6D7F,0xFF69788A,0xFF68778A,
+   0xFF657487,0xFF647386,0xFF637285,0xFF627183,0xFF606F81,0xFF606F81,0xFF606F81,
+   0xFF627183,0xFF657487,0xFF3B4859,0xFF3E4B5D,0xFF5D6C7E,0xFF606F81,0xFF606F81,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF606F80,
+   0xFF5C6B7C,0xFF5C6B7C,0xFF374354,0xFF556374,0xFF637383,0xFF627382,0xFF617381,
+   0xFF617480,0xFF617480,0xFF60757F,0xFF5F757E,0xFF5F767D,0xFF5F767E,0xFF60767F,
+   0xFF627581,0xFF627582,0xFF617581,0xFF60777F,0xFF5F787D,0xFF5F787D,0xFF5D767B,
+   0xFF5B7479,0xFF5A7278,0xFF5A7278,0xFF5B7178,0xFF5A7278,0xFF597277,0xFF597277,
+   0xFF597276,0xFF587276,0xFF587276,0xFF597276,0xFF597277,0xFF597177,0xFF5A6F79,
+   0xFF60727F,0xFF5F727F,0xFF32414D,0xFF516270,0xFF647484,0xFF667887,0xFF556775,
+   0xFF394856,0xFF465763,0xFF566975,0xFF50636F,0xFF4F626D,0xFF5A6E79,0xFF5B6D7A,
+   0xFF5B6D7A,0xFF596977,0xFF4F5E6D,0xFF3E4D5C,0xFF344150,0xFF2F3C4C,0xFF2D3A4A,
+   0xFF31404F,0xFF344553,0xFF354653,0xFF344351,0xFF2F3F4C,0xFF2D3D4A,0xFF2F404C,
+   0xFF32444F,0xFF354752,0xFF3A4C57,0xFF3C4F58,0xFF384C54,0xFF33464F,0xFF2C3E46,
+   0xFF25353D,0xFF202F35,0xFF1C2930,0xFF23323A,0xFF3E515B,0xFF60747F,0xFF657885,
+   0xFF647684,0xFF637484,0xFF637484,0xFF627483,0xFF617481,0xFF5F737F,0xFF5F727F,
+   0xFF607180,0xFF607180,0xFF617281,0xFF617282,0xFF3A4957,0xFF32414E,0xFF4F616F,
+   0xFF5F727F,0xFF5F717F,0xFF5F717F,0xFF5F727E,0xFF60717F,0xFF60717F,0xFF5F717F,
+   0xFF60727F,0xFF5E707D,0xFF5A6D79,0xFF5A6D79,0xFF354552,0xFF536571,0xFF627481,
+   0xFF617480,0xFF627382,0xFF627382,0xFF627381,0xFF617480,0xFF61747F,0xFF60757F,
+   0xFF60757F,0xFF617580,0xFF617681,0xFF617681,0xFF617581,0xFF627581,0xFF627582,
+   0xFF627583,0xFF617381,0xFF5E717E,0xFF5D6F7C,0xFF5C707B,0xFF5C707B,0xFF5C707B,
+   0xFF5D6F7C,0xFF5D6F7D,0xFF5D6E7D,0xFF5D6E7C,0xFF5D6E7D,0xFF5C6E7C,0xFF5C6F7B,
+   0xFF5C6E7B,0xFF5D6D7C,0xFF617181,0xFF617182,0xFF33404F,0xFF526171,0xFF647485,
+   0xFF667788,0xFF566576,0xFF3A4757,0xFF475666,0xFF576877,0xFF516272,0xFF506070,
+   0xFF5C6C7C,0xFF5C6C7C,0xFF5C6C7B,0xFF5A6978,0xFF4F5D6E,0xFF3F4C5D,0xFF344051,
+   0xFF303B4B,0xFF2E3949,0xFF323E4F,0xFF374354,0xFF384456,0xFF354153,0xFF313C4D,
+   0xFF2F3B4C,0xFF323E4F,0xFF354152,0xFF384354,0xFF3C4757,0xFF3D4858,0xFF3A4555,
+   0xFF354050,0xFF2E3848,0xFF283140,0xFF232B39,0xFF1E2634,0xFF262F3F,0xFF424E60,
+   0xFF637283,0xFF677688,0xFF657486,0xFF647386,0xFF647386,0xFF637285,0xFF637284,
+   0xFF627183,0xFF617082,0xFF617082,0xFF617082,0xFF627183,0xFF627184,0xFF3B4859,
+   0xFF333F50,0xFF515F71,0xFF617082,0xFF606F81,0xFF617081,0xFF617081,0xFF617081,
+   0xFF617081,0xFF617081,0xFF5C6B7C,0xFF5B6A7B,0xFF627182,0xFF606F81,0xFF374455,
+   0xFF576576,0xFF637383,0xFF627382,0xFF617381,0xFF617480,0xFF617480,0xFF60757F,
+   0xFF60757E,0xFF5F767D,0xFF5F757D,0xFF5F757E,0xFF607580,0xFF617581,0xFF617581,
+   0xFF60777F,0xFF5F787D,0xFF5F787D,0xFF5D777B,0xFF5B7479,0xFF597277,0xFF5A7278,
+   0xFF5A7278,0xFF5A7277,0xFF597277,0xFF597276,0xFF587375,0xFF587275,0xFF587275,
+   0xFF587275,0xFF587276,0xFF597177,0xFF5B7079,0xFF5C6E7B,0xFF657885,0xFF455662,
+   0xFF485866,0xFF5D6E7D,0xFF5D6E7C,0xFF647785,0xFF5C6F7C,0xFF364652,0xFF344350,
+   0xFF354552,0xFF425360,0xFF4C5D6B,0xFF4C5C6A,0xFF41505E,0xFF394756,0xFF394858,
+   0xFF415263,0xFF495B6C,0xFF4E6274,0xFF53677A,0xFF576D7E,0xFF5C7383,0xFF5E7584,
+   0xFF5C7282,0xFF586F7E,0xFF546A7A,0xFF4F6474,0xFF485D6D,0xFF435866,0xFF3F5461,
+   0xFF3E525F,0xFF3C515C,0xFF374C57,0xFF2E414B,0xFF223139,0xFF17232A,0xFF18242B,
+   0xFF30434B,0xFF546A73,0xFF627781,0xFF60747F,0xFF617381,0xFF607181,0xFF607180,
+   0xFF5F727F,0xFF5F737F,0xFF607380,0xFF617480,0xFF617481,0xFF627382,0xFF617281,
+   0xFF4F6070,0xFF2F3C4B,0xFF25313D,0xFF3C4D5A,0xFF536673,0xFF5F727E,0xFF5F727E,
+   0xFF5F727E,0xFF5F727E,0xFF60717F,0xFF5F717E,0xFF5B6C7A,0xFF596B78,0xFF60737F,
+   0xFF5E717D,0xFF354652,0xFF556773,0xFF627581,0xFF627381,0xFF627382,0xFF627382,
+   0xFF627381,0xFF617480,0xFF60757F,0xFF60757F,0xFF60747F,0xFF60747F,0xFF607580,
+   0xFF617581,0xFF627581,0xFF617581,0xFF627581,0xFF627582,0xFF617480,0xFF5E717D,
+   0xFF5C6F7B,0xFF5C707B,0xFF5C707B,0xFF5D6F7B,0xFF5D6F7C,0xFF5D6F7C,0xFF5D6E7C,
+   0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7D,0xFF5D6D7D,
+   0xFF667787,0xFF475564,0xFF495767,0xFF5D6E7D,0xFF5D6E7D,0xFF657686,0xFF5E6D7E,
+   0xFF384455,0xFF354252,0xFF364454,0xFF435262,0xFF4D5C6C,0xFF4C5B6B,0xFF42505F,
+   0xFF3A4656,0xFF3A4757,0xFF425061,0xFF4A586B,0xFF505F73,0xFF556579,0xFF596B7F,
+   0xFF5E7185,0xFF607287,0xFF5E7085,0xFF5A6C81,0xFF56687D,0xFF516277,0xFF4B5A6E,
+   0xFF465468,0xFF425064,0xFF414F62,0xFF3F4D5F,0xFF3B4759,0xFF323D4E,0xFF252E3D,
+   0xFF19212E,0xFF1A222F,0xFF344050,0xFF586678,0xFF657485,0xFF637283,0xFF627183,
+   0xFF617083,0xFF617082,0xFF617082,0xFF627183,0xFF627183,0xFF637284,0xFF637284,
+   0xFF637283,0xFF617282,0xFF505F70,0xFF303B4C,0xFF26303F,0xFF3E4B5D,0xFF556476,
+   0xFF617081,0xFF617082,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF5E6D7E,
+   0xFF627182,0xFF647485,0xFF556375,0xFF323E4F,0xFF536172,0xFF637483,0xFF627381,
+   0xFF617480,0xFF617480,0xFF617480,0xFF60757F,0xFF60757F,0xFF5F747E,0xFF5E747D,
+   0xFF5E737D,0xFF5E737D,0xFF5F737E,0xFF5F747E,0xFF5F767E,0xFF5F777D,0xFF5E777C,
+   0xFF5B7679,0xFF597477,0xFF597376,0xFF597377,0xFF597377,0xFF597377,0xFF597377,
+   0xFF597376,0xFF587375,0xFF587375,0xFF577374,0xFF577374,0xFF577375,0xFF597276,
+   0xFF5B707A,0xFF5C6E7A,0xFF617380,0xFF556775,0xFF394754,0xFF5A6B79,0xFF5C6D7B,
+   0xFF5C6E7B,0xFF657885,0xFF4D5F6C,0xFF26323E,0xFF1D2732,0xFF293643,0xFF2E3B49,
+   0xFF2F3D4B,0xFF3B4A5A,0xFF4F6172,0xFF5F7386,0xFF63788B,0xFF63798C,0xFF63798C,
+   0xFF62788A,0xFF607787,0xFF5E7785,0xFF5E7785,0xFF5F7886,0xFF617A89,0xFF657E8D,
+   0xFF688090,0xFF698192,0xFF698192,0xFF688090,0xFF67808F,0xFF66808E,0xFF637D8A,
+   0xFF58737E,0xFF3C535D,0xFF22313A,0xFF1A252D,0xFF344750,0xFF566B75,0xFF5F747E,
+   0xFF5E737E,0xFF5F727F,0xFF5F717F,0xFF5F717F,0xFF5E727E,0xFF5D717C,0xFF5A6E7A,
+   0xFF566975,0xFF516470,0xFF4C5D6B,0xFF41505F,0xFF344250,0xFF2A3645,0xFF273340,
+   0xFF293643,0xFF364552,0xFF485966,0xFF596C79,0xFF60727F,0xFF5F727F,0xFF5B6D79,
+   0xFF576975,0xFF5B6E7A,0xFF5F737E,0xFF627681,0xFF526571,0xFF30404B,0xFF51646F,
+   0xFF627581,0xFF627381,0xFF627382,0xFF627382,0xFF627381,0xFF617480,0xFF60757F,
+   0xFF5F747E,0xFF5F737D,0xFF5E727D,0xFF5E737D,0xFF5F737E,0xFF60737F,0xFF60747F,
+   0xFF617580,0xFF607480,0xFF5F727E,0xFF5D717C,0xFF5C717B,0xFF5C717B,0xFF5C707B,
+   0xFF5D707C,0xFF5D6F7C,0xFF5D6F7C,0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7D,0xFF5D6E7D,
+   0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6D7D,0xFF627282,0xFF566676,0xFF394755,
+   0xFF5A6B7A,0xFF5C6D7C,0xFF5D6D7D,0xFF667787,0xFF4F5D6E,0xFF273140,0xFF1E2633,
+   0xFF2A3644,0xFF2E3B49,0xFF303C4B,0xFF3C4959,0xFF4F5F72,0xFF5F7285,0xFF63778B,
+   0xFF64788C,0xFF64788D,0xFF63778C,0xFF62758A,0xFF617489,0xFF617489,0xFF62758A,
+   0xFF64788D,0xFF677B91,0xFF6A7E94,0xFF6B7F95,0xFF6A7F95,0xFF697E94,0xFF697E93,
+   0xFF697D92,0xFF66798D,0xFF5D6C7F,0xFF404D60,0xFF252E3D,0xFF1C2331,0xFF384455,
+   0xFF59687A,0xFF627183,0xFF617082,0xFF617082,0xFF606F81,0xFF617082,0xFF606F81,
+   0xFF606F81,0xFF5D6C7E,0xFF586779,0xFF536173,0xFF4D5B6D,0xFF414F60,0xFF354151,
+   0xFF2B3546,0xFF283241,0xFF2B3545,0xFF384355,0xFF4A5869,0xFF5B6A7B,0xFF627182,
+   0xFF617182,0xFF5D6B7C,0xFF596778,0xFF637283,0xFF637283,0xFF5E6D7E,0xFF3F4C5D,
+   0xFF2A3545,0xFF516070,0xFF637483,0xFF627381,0xFF617480,0xFF617480,0xFF61747F,
+   0xFF60747F,0xFF60737E,0xFF5F727E,0xFF5E727D,0xFF5E737D,0xFF5E737D,0xFF5E737C,
+   0xFF5D747B,0xFF5D747A,0xFF5C757A,0xFF5A7578,0xFF597476,0xFF587475,0xFF597476,
+   0xFF597476,0xFF597476,0xFF597377,0xFF597377,0xFF597476,0xFF587375,0xFF577374,
+   0xFF577374,0xFF577374,0xFF577374,0xFF597276,0xFF5B7079,0xFF5B6F7A,0xFF5E717E,
+   0xFF5D6E7D,0xFF32404E,0xFF4A5968,0xFF5C6E7C,0xFF5C6E7B,0xFF5F727E,0xFF465865,
+   0xFF293743,0xFF2A3746,0xFF364556,0xFF3F5061,0xFF516576,0xFF607587,0xFF607587,
+   0xFF5D7284,0xFF5C7183,0xFF5C7183,0xFF5C7183,0xFF5B7282,0xFF5A7281,0xFF5A7381,
+   0xFF5A7380,0xFF5A7380,0xFF5A7381,0xFF5C7583,0xFF5E7785,0xFF5F7787,0xFF607788,
+   0xFF617889,0xFF607888,0xFF607A88,0xFF627D89,0xFF698590,0xFF58737F,0xFF324651,
+   0xFF1C2831,0xFF2F414A,0xFF4E636C,0xFF5E737D,0xFF5F737F,0xFF5E727E,0xFF5A6C7A,
+   0xFF506270,0xFF485A66,0xFF3F525C,0xFF374954,0xFF364852,0xFF3B4C57,0xFF3F505D,
+   0xFF465664,0xFF4C5C6B,0xFF4F5F6F,0xFF4F5F6F,0xFF485866,0xFF3B4A57,0xFF354451,
+   0xFF374754,0xFF475865,0xFF4B5C68,0xFF566975,0xFF60737F,0xFF617480,0xFF60747F,
+   0xFF5B707A,0xFF3C4F59,0xFF283742,0xFF4F626D,0xFF627581,0xFF617480,0xFF627382,
+   0xFF627382,0xFF627381,0xFF617480,0xFF5F747E,0xFF5E737C,0xFF5E737C,0xFF5E737D,
+   0xFF5E727D,0xFF5F727E,0xFF5F727E,0xFF5E727D,0xFF5E727D,0xFF5E717D,0xFF5D707C,
+   0xFF5C717B,0xFF5C717A,0xFF5C717A,0xFF5C717B,0xFF5D707C,0xFF5D6F7D,0xFF5D6F7D,
+   0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5E6D7D,0xFF5D6E7D,
+   0xFF5D6E7D,0xFF5F7080,0xFF5E6E7E,0xFF32404F,0xFF4A5968,0xFF5D6E7D,0xFF5D6D7D,
+   0xFF607180,0xFF485667,0xFF2A3545,0xFF2B3645,0xFF364454,0xFF3F4F5F,0xFF526376,
+   0xFF607487,0xFF607588,0xFF5D7285,0xFF5C7184,0xFF5C7184,0xFF5D7084,0xFF5D7084,
+   0xFF5D7084,0xFF5D7085,0xFF5D7085,0xFF5D7085,0xFF5D7085,0xFF5F7287,0xFF617489,
+   0xFF61758A,0xFF62768B,0xFF62768B,0xFF62768B,0xFF63778C,0xFF65798F,0xFF6D8095,
+   0xFF5D6D80,0xFF364254,0xFF1E2634,0xFF323E4E,0xFF515F71,0xFF617082,0xFF627183,
+   0xFF617082,0xFF5B6A7C,0xFF526172,0xFF4A586A,0xFF424F61,0xFF3A4658,0xFF394556,
+   0xFF3D495B,0xFF414E60,0xFF475566,0xFF4D5B6C,0xFF505E70,0xFF505E71,0xFF495768,
+   0xFF3C485A,0xFF364253,0xFF394556,0xFF495667,0xFF4D5A6B,0xFF596778,0xFF627182,
+   0xFF4F5D6E,0xFF4E5C6D,0xFF414D5F,0xFF2A3545,0xFF263040,0xFF4E5C6D,0xFF637383,
+   0xFF627382,0xFF627381,0xFF617381,0xFF61747F,0xFF60737F,0xFF5F727E,0xFF5F727E,
+   0xFF5F727E,0xFF5E737D,0xFF5E737D,0xFF5D737C,0xFF5D747A,0xFF5C757A,0xFF5B7578,
+   0xFF597477,0xFF587475,0xFF587475,0xFF597476,0xFF597476,0xFF597476,0xFF597476,
+   0xFF597476,0xFF587475,0xFF587474,0xFF577374,0xFF577473,0xFF567473,0xFF577374,
+   0xFF597276,0xFF5A7178,0xFF5B7079,0xFF5C6F7B,0xFF667785,0xFF495868,0xFF344250,
+   0xFF50616F,0xFF4E606D,0xFF415360,0xFF344654,0xFF3E5161,0xFF506477,0xFF596E80,
+   0xFF5D7385,0xFF5D7385,0xFF5B7183,0xFF5B7082,0xFF5B7082,0xFF5B7082,0xFF5B7182,
+   0xFF5B7282,0xFF5A7381,0xFF5A7380,0xFF5A7380,0xFF5A7380,0xFF5A7380,0xFF5A7380,
+   0xFF5C7583,0xFF5E7784,0xFF5F7786,0xFF5F7787,0xFF5F7787,0xFF5F7787,0xFF5F7786,
+   0xFF5E7785,0xFF607A87,0xFF67828F,0xFF455B69,0xFF23323D,0xFF23303A,0xFF3A4C57,
+   0xFF465864,0xFF465763,0xFF3E4F5B,0xFF394956,0xFF3B4B58,0xFF40525E,0xFF485A66,
+   0xFF546873,0xFF5E737E,0xFF657A85,0xFF687C88,0xFF687B89,0xFF6A7B8B,0xFF6A7B8B,
+   0xFF6A7B8B,0xFF6A7E8B,0xFF697D8A,0xFF667987,0xFF586A77,0xFF3B4956,0xFF313E4A,
+   0xFF404F5D,0xFF455562,0xFF4C5E6A,0xFF4C5E69,0xFF3E505B,0xFF283741,0xFF25323D,
+   0xFF4C5E6A,0xFF627580,0xFF617480,0xFF627381,0xFF627382,0xFF617380,0xFF60737E,
+   0xFF5E737D,0xFF5E737C,0xFF5E737C,0xFF5E737D,0xFF5E737C,0xFF5E737D,0xFF5E737D,
+   0xFF5E737D,0xFF5E727D,0xFF5D717C,0xFF5C717B,0xFF5C717B,0xFF5C717B,0xFF5C707B,
+   0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5D6F7C,0xFF5D6E7C,0xFF5D6E7D,
+   0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5E6E7D,0xFF667686,
+   0xFF495868,0xFF344250,0xFF506070,0xFF505F6F,0xFF435161,0xFF364354,0xFF404E60,
+   0xFF516374,0xFF596D7E,0xFF5D7285,0xFF5D7386,0xFF5C7184,0xFF5B6F83,0xFF5B7083,
+   0xFF5B7083,0xFF5C7083,0xFF5C7184,0xFF5D7084,0xFF5D7084,0xFF5D7085,0xFF5D7085,
+   0xFF5D7085,0xFF5D7085,0xFF5F7287,0xFF607489,0xFF61758A,0xFF61758A,0xFF61758A,
+   0xFF61758A,0xFF61758A,0xFF61758A,0xFF63778C,0xFF6B7D91,0xFF485668,0xFF262F3E,
+   0xFF252E3D,0xFF3D495B,0xFF485668,0xFF485566,0xFF404D5E,0xFF3B4758,0xFF3D495B,
+   0xFF435062,0xFF4A586A,0xFF576577,0xFF617083,0xFF68778A,0xFF6A798C,0xFF6A7A8C,
+   0xFF6A7A8C,0xFF6A7A8C,0xFF6B7A8C,0xFF6C7C8E,0xFF6B7B8D,0xFF687789,0xFF5A687A,
+   0xFF3C4859,0xFF323C4C,0xFF414E5F,0xFF465364,0xFF3C4859,0xFF313C4D,0xFF2B3545,
+   0xFF1E2634,0xFF252F3E,0xFF475466,0xFF627282,0xFF627382,0xFF627382,0xFF617381,
+   0xFF60737F,0xFF5F727F,0xFF5F727E,0xFF5F727E,0xFF5F727E,0xFF5E727D,0xFF5E737D,
+   0xFF5D747B,0xFF5C747A,0xFF5C757A,0xFF5B7479,0xFF5A7477,0xFF587475,0xFF587475,
+   0xFF587475,0xFF597476,0xFF587475,0xFF587475,0xFF587475,0xFF587475,0xFF587574,
+   0xFF577473,0xFF567473,0xFF567473,0xFF587375,0xFF597177,0xFF5A7177,0xFF5A7078,
+   0xFF5B6E79,0xFF627381,0xFF566575,0xFF2D3948,0xFF2D3A49,0xFF324351,0xFF435667,
+   0xFF586F7F,0xFF607789,0xFF607688,0xFF5D7385,0xFF5B7183,0xFF5B7183,0xFF5B7182,
+   0xFF5B7182,0xFF5A7181,0xFF5A7181,0xFF5A7181,0xFF5B7281,0xFF5A7381,0xFF5A7380,
+   0xFF59747F,0xFF59747F,0xFF5A7380,0xFF5A7380,0xFF5B7582,0xFF5D7784,0xFF5E7886,
+   0xFF5F7787,0xFF5F7787,0xFF5F7787,0xFF5F7786,0xFF5F7786,0xFF5F7786,0xFF667F8E,
+   0xFF566E7C,0xFF2E404C,0xFF1A242E,0xFF202C37,0xFF2C3A47,0xFF364553,0xFF485967,
+   0xFF596C79,0xFF637783,0xFF647985,0xFF647984,0xFF627782,0xFF5F757F,0xFF5F747F,
+   0xFF607380,0xFF617381,0xFF617281,0xFF617282,0xFF617282,0xFF617381,0xFF627482,
+   0xFF637684,0xFF687B89,0xFF697B8A,0xFF657685,0xFF60717F,0xFF4F616D,0xFF3B4B58,
+   0xFF2F3E4A,0xFF293742,0xFF1C2731,0xFF23313B,0xFF445662,0xFF60737F,0xFF617480,
+   0xFF617480,0xFF617381,0xFF60737F,0xFF5F727D,0xFF5E737C,0xFF5E737C,0xFF5D737C,
+   0xFF5E737C,0xFF5E737C,0xFF5E737D,0xFF5E737D,0xFF5E737D,0xFF5E727C,0xFF5D717B,
+   0xFF5C717B,0xFF5C717B,0xFF5D707B,0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5D707C,
+   0xFF5D707C,0xFF5D6F7C,0xFF5D6E7C,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,
+   0xFF5D6E7C,0xFF5D6D7C,0xFF5D6D7C,0xFF627281,0xFF556575,0xFF2D3948,0xFF2E3A49,
+   0xFF334153,0xFF445467,0xFF5A6C80,0xFF61768A,0xFF607688,0xFF5D7385,0xFF5B7283,
+   0xFF5B7183,0xFF5B7083,0xFF5C6F83,0xFF5C6F83,0xFF5B7083,0xFF5B7083,0xFF5C7184,
+   0xFF5C7184,0xFF5D7084,0xFF5D7085,0xFF5D7085,0xFF5D7085,0xFF5D7085,0xFF5E7287,
+   0xFF607489,0xFF61758A,0xFF61758A,0xFF61758A,0xFF61758A,0xFF61758A,0xFF61758A,
+   0xFF61758A,0xFF687C91,0xFF5A697B,0xFF313C4D,0xFF1B2230,0xFF222A39,0xFF2E3949,
+   0xFF384455,0xFF4A5769,0xFF5B6A7C,0xFF657587,0xFF677789,0xFF677689,0xFF657486,
+   0xFF637284,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF637284,0xFF657486,0xFF6A798B,0xFF6A7A8C,0xFF667586,0xFF617081,
+   0xFF536172,0xFF6C7C8D,0xFF5C6B7C,0xFF455263,0xFF323D4E,0xFF2A3444,0xFF3F4C5D,
+   0xFF606F7F,0xFF627382,0xFF627382,0xFF617380,0xFF5F737E,0xFF5F727E,0xFF5F727D,
+   0xFF5F727E,0xFF5F727E,0xFF5E727D,0xFF5D737C,0xFF5D747B,0xFF5C747A,0xFF5C757A,
+   0xFF5B7479,0xFF5A7377,0xFF597376,0xFF587475,0xFF587475,0xFF587475,0xFF587475,
+   0xFF587475,0xFF577574,0xFF587574,0xFF587574,0xFF577474,0xFF577473,0xFF577375,
+   0xFF597177,0xFF5A7078,0xFF5A7077,0xFF5B6F78,0xFF5C6F79,0xFF5C6F7B,0xFF41515F,
+   0xFF293443,0xFF344455,0xFF526879,0xFF607788,0xFF5F7587,0xFF5C7284,0xFF5B7283,
+   0xFF5B7283,0xFF5B7183,0xFF5B7182,0xFF5B7182,0xFF5B7182,0xFF5B7182,0xFF5A7180,
+   0xFF5A7180,0xFF5A7280,0xFF5A7381,0xFF5A7380,0xFF5A737F,0xFF5A737F,0xFF5A7380,
+   0xFF5A7380,0xFF5B7481,0xFF5D7684,0xFF5F7786,0xFF5F7787,0xFF5F7787,0xFF5F7787,
+   0xFF5F7787,0xFF5F7787,0xFF5F7787,0xFF627A8A,0xFF617B89,0xFF394E5A,0xFF1D2832,
+   0xFF25313D,0xFF3D4D5B,0xFF5A6B7A,0xFF657886,0xFF627582,0xFF5F727F,0xFF5E717E,
+   0xFF5D717D,0xFF5D727D,0xFF5D727D,0xFF5E727E,0xFF5F7280,0xFF617281,0xFF617281,
+   0xFF617282,0xFF617282,0xFF617281,0xFF607281,0xFF5F7280,0xFF5F717F,0xFF607180,
+   0xFF617381,0xFF647784,0xFF6A7E8A,0xFF6A7E8A,0xFF5A6D79,0xFF43545F,0xFF30404A,
+   0xFF283641,0xFF3D4E5A,0xFF5E717D,0xFF617480,0xFF617480,0xFF617380,0xFF60737F,
+   0xFF5E737D,0xFF5E737C,0xFF5D747B,0xFF5D747B,0xFF5E737C,0xFF5E737D,0xFF5F727D,
+   0xFF5E727D,0xFF5E737D,0xFF5E727C,0xFF5C717B,0xFF5C717B,0xFF5C717B,0xFF5C707B,
+   0xFF5D707C,0xFF5D707C,0xFF5D707B,0xFF5C707B,0xFF5D707B,0xFF5D707C,0xFF5D6F7C,
+   0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7B,0xFF5D6D7C,
+   0xFF5D6D7D,0xFF425060,0xFF293544,0xFF354356,0xFF54667B,0xFF61758B,0xFF607388,
+   0xFF5D7186,0xFF5C7185,0xFF5B7183,0xFF5B7183,0xFF5B7082,0xFF5B7082,0xFF5B7082,
+   0xFF5B7083,0xFF5B7083,0xFF5B7083,0xFF5C7083,0xFF5C7184,0xFF5C7184,0xFF5C7184,
+   0xFF5D7084,0xFF5C7184,0xFF5D7084,0xFF5E7186,0xFF607488,0xFF61758A,0xFF61758A,
+   0xFF61758A,0xFF61758A,0xFF61758A,0xFF61758A,0xFF61758A,0xFF64788D,0xFF657689,
+   0xFF3C495B,0xFF1E2735,0xFF262F3F,0xFF3E4B5D,0xFF5B6A7C,0xFF677688,0xFF647385,
+   0xFF617082,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF617082,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF617082,
+   0xFF617082,0xFF617082,0xFF637283,0xFF667687,0xFF6C7C8D,0xFF637384,0xFF6A798B,
+   0xFF6D7C8E,0xFF5A697B,0xFF384556,0xFF384455,0xFF5D6D7C,0xFF627382,0xFF627381,
+   0xFF60737F,0xFF5F737E,0xFF5E727D,0xFF5F727E,0xFF60717F,0xFF5F717F,0xFF5F727D,
+   0xFF5E737C,0xFF5D747B,0xFF5D747A,0xFF5C757A,0xFF5B7479,0xFF5A7378,0xFF597377,
+   0xFF597376,0xFF587475,0xFF587475,0xFF587475,0xFF587574,0xFF587574,0xFF587475,
+   0xFF587475,0xFF587475,0xFF577374,0xFF587275,0xFF5A7078,0xFF5A7077,0xFF597076,
+   0xFF5A7077,0xFF5D717A,0xFF4E616C,0xFF30404C,0xFF2F3F4E,0xFF4F6376,0xFF5E7486,
+   0xFF5B7283,0xFF5B7283,0xFF5B7283,0xFF5B7282,0xFF5B7183,0xFF5B7182,0xFF5B7182,
+   0xFF5B7181,0xFF5A7181,0xFF5B7181,0xFF5A7180,0xFF597280,0xFF597280,0xFF5A7380,
+   0xFF5A7380,0xFF5A7380,0xFF5A7380,0xFF5A7380,0xFF5A7381,0xFF5B7482,0xFF5D7684,
+   0xFF5E7786,0xFF5F7786,0xFF5F7786,0xFF5F7786,0xFF5F7787,0xFF5F7787,0xFF5F7787,
+   0xFF5F7887,0xFF657F8D,0xFF415764,0xFF273541,0xFF394A57,0xFF556876,0xFF627483,
+   0xFF607180,0xFF5F717F,0xFF5E717E,0xFF5E717E,0xFF5E717E,0xFF5D727D,0xFF5D727D,
+   0xFF5E717D,0xFF5E717F,0xFF607280,0xFF607281,0xFF607181,0xFF607180,0xFF60707F,
+   0xFF5F707E,0xFF5E707E,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E717E,0xFF5E717E,
+   0xFF617481,0xFF677B87,0xFF6A7F8A,0xFF586B77,0xFF364753,0xFF364653,0xFF5C6E7B,
+   0xFF617481,0xFF617480,0xFF617380,0xFF5F737E,0xFF5E737C,0xFF5E737C,0xFF5D737C,
+   0xFF5D737C,0xFF5E737C,0xFF5E737D,0xFF5E727D,0xFF5F727D,0xFF5E727D,0xFF5D727C,
+   0xFF5C717B,0xFF5C717B,0xFF5C717B,0xFF5D707B,0xFF5D707C,0xFF5D707B,0xFF5C717B,
+   0xFF5C717B,0xFF5C707B,0xFF5D707C,0xFF5D6F7C,0xFF5D6E7C,0xFF5D6D7C,0xFF5D6D7C,
+   0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7B,0xFF5F6E7E,0xFF505F6F,0xFF323F4F,0xFF303F51,
+   0xFF506278,0xFF5F7388,0xFF5D7086,0xFF5D7085,0xFF5D7085,0xFF5C7185,0xFF5C7184,
+   0xFF5B7083,0xFF5B7082,0xFF5B7082,0xFF5B7082,0xFF5B7082,0xFF5B7083,0xFF5B7083,
+   0xFF5B7083,0xFF5C7184,0xFF5C7184,0xFF5C7184,0xFF5C7183,0xFF5C7183,0xFF5C7184,
+   0xFF5D7285,0xFF5F7487,0xFF607589,0xFF61758A,0xFF61758A,0xFF61758A,0xFF61758A,
+   0xFF61758A,0xFF61758A,0xFF62768B,0xFF687B90,0xFF455265,0xFF293343,0xFF3B485A,
+   0xFF576679,0xFF647385,0xFF617082,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF617082,0xFF627183,0xFF627082,
+   0xFF617082,0xFF616F81,0xFF606F81,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF627183,0xFF6B7B8D,0xFF5A697A,
+   0xFF354352,0xFF566675,0xFF617281,0xFF60737F,0xFF5F737E,0xFF5E737D,0xFF5F727D,
+   0xFF60717F,0xFF607180,0xFF60717F,0xFF5F727E,0xFF5F727D,0xFF5E737C,0xFF5D747B,
+   0xFF5C757A,0xFF5B7479,0xFF5A7378,0xFF597377,0xFF597376,0xFF587475,0xFF587475,
+   0xFF587574,0xFF577573,0xFF577574,0xFF587475,0xFF587475,0xFF587475,0xFF587275,
+   0xFF597176,0xFF597076,0xFF597176,0xFF597175,0xFF5A7177,0xFF596E77,0xFF3B4E58,
+   0xFF2C3C47,0xFF435867,0xFF5D7485,0xFF5B7283,0xFF5B7282,0xFF5A7381,0xFF5A7381,
+   0xFF5A7281,0xFF5A7181,0xFF597280,0xFF59727F,0xFF59727F,0xFF59727F,0xFF59727F,
+   0xFF59727F,0xFF59727F,0xFF597280,0xFF5A7280,0xFF5A7381,0xFF5A7380,0xFF5A7381,
+   0xFF5A7381,0xFF5C7482,0xFF5D7583,0xFF5E7684,0xFF5E7785,0xFF5E7786,0xFF5F7786,
+   0xFF5F7786,0xFF5F7786,0xFF5F7787,0xFF5F7786,0xFF5F7886,0xFF627C8A,0xFF415562,
+   0xFF32414E,0xFF516371,0xFF617481,0xFF607180,0xFF607180,0xFF5F7080,0xFF5F707F,
+   0xFF5E717E,0xFF5E717E,0xFF5E717D,0xFF5D717D,0xFF5E717E,0xFF5E717E,0xFF5F707F,
+   0xFF5F707F,0xFF5F6F7F,0xFF5F6F7E,0xFF5F6F7E,0xFF5E707E,0xFF5E707D,0xFF5E707D,
+   0xFF5E707D,0xFF5E707E,0xFF5E717E,0xFF5E717E,0xFF5E717D,0xFF5E717D,0xFF607380,
+   0xFF697D8A,0xFF586B78,0xFF344351,0xFF556774,0xFF60737F,0xFF60737F,0xFF5F737E,
+   0xFF5F737D,0xFF5E737C,0xFF5E737C,0xFF5E737C,0xFF5E737C,0xFF5D737C,0xFF5E737C,
+   0xFF5E737D,0xFF5E727D,0xFF5E727D,0xFF5D727C,0xFF5C717B,0xFF5C717B,0xFF5C707B,
+   0xFF5D707C,0xFF5D707B,0xFF5C717B,0xFF5C717B,0xFF5C717B,0xFF5C707B,0xFF5D707B,
+   0xFF5D707C,0xFF5D6E7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5E6E7C,
+   0xFF5C6B7B,0xFF3E4C5D,0xFF2D3B4C,0xFF44576A,0xFF5E7387,0xFF5D7085,0xFF5D7085,
+   0xFF5C7185,0xFF5C7184,0xFF5C7084,0xFF5B7083,0xFF5B7082,0xFF5B7082,0xFF5B7082,
+   0xFF5B7082,0xFF5B7082,0xFF5B7082,0xFF5B7083,0xFF5B7083,0xFF5B7083,0xFF5C7184,
+   0xFF5C7183,0xFF5C7183,0xFF5C7184,0xFF5E7285,0xFF5F7386,0xFF5F7587,0xFF5F7588,
+   0xFF617589,0xFF61758A,0xFF61758A,0xFF61758A,0xFF61758A,0xFF61758A,0xFF61758A,
+   0xFF65798F,0xFF445266,0xFF343F51,0xFF536174,0xFF637284,0xFF617082,0xFF617082,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF606F81,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606F81,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF606F81,0xFF617182,0xFF697A8B,0xFF3F4E5E,0xFF435361,0xFF5E717E,
+   0xFF5E717D,0xFF5E727D,0xFF5E737D,0xFF5F727E,0xFF60717F,0xFF607180,0xFF60717F,
+   0xFF5F727E,0xFF5F727D,0xFF5E737C,0xFF5D747B,0xFF5B7579,0xFF5B7479,0xFF5A7377,
+   0xFF597377,0xFF597376,0xFF597476,0xFF587475,0xFF587475,0xFF577574,0xFF587474,
+   0xFF577574,0xFF587475,0xFF597376,0xFF597177,0xFF5A7077,0xFF597076,0xFF587175,
+   0xFF597176,0xFF5B7378,0xFF4B6169,0xFF2F414A,0xFF334552,0xFF536A79,0xFF5C7383,
+   0xFF5B7282,0xFF5A7380,0xFF59737F,0xFF597280,0xFF5A7181,0xFF5A7181,0xFF597280,
+   0xFF59727E,0xFF59727F,0xFF58737E,0xFF58747D,0xFF58737D,0xFF59727F,0xFF5A7180,
+   0xFF5A7180,0xFF5A7281,0xFF5B7281,0xFF5C7383,0xFF5C7583,0xFF5D7684,0xFF5E7684,
+   0xFF5E7684,0xFF5E7784,0xFF5F7786,0xFF5F7786,0xFF5F7786,0xFF5F7786,0xFF5F7787,
+   0xFF5F7786,0xFF607887,0xFF607887,0xFF3D4E5B,0xFF384854,0xFF5C6F7C,0xFF607280,
+   0xFF607180,0xFF607181,0xFF5F717F,0xFF5E707F,0xFF5E717F,0xFF5E717E,0xFF5E717E,
+   0xFF5E717E,0xFF5E717E,0xFF5E717E,0xFF5F707E,0xFF5F6F7E,0xFF5F6F7E,0xFF5E707E,
+   0xFF5E707E,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E717E,0xFF5E717E,
+   0xFF5E717D,0xFF5E717E,0xFF5E717E,0xFF5E717D,0xFF5F737F,0xFF687B89,0xFF3F4F5C,
+   0xFF425360,0xFF5D717D,0xFF5E717D,0xFF5E727D,0xFF5E737D,0xFF5E737C,0xFF5E737C,
+   0xFF5D737C,0xFF5D737C,0xFF5D737C,0xFF5D747B,0xFF5E737C,0xFF5E737C,0xFF5E727D,
+   0xFF5E717D,0xFF5D707B,0xFF5C717B,0xFF5C717B,0xFF5C717B,0xFF5C717B,0xFF5C717B,
+   0xFF5C717B,0xFF5C717B,0xFF5C717B,0xFF5D707B,0xFF5D707C,0xFF5D6E7C,0xFF5D6D7B,
+   0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5F6F7E,0xFF4E5E6E,0xFF323F50,0xFF354458,
+   0xFF55687C,0xFF5D7285,0xFF5C7184,0xFF5C7184,0xFF5B7084,0xFF5B7083,0xFF5B7083,
+   0xFF5B7082,0xFF5B7182,0xFF5B7182,0xFF5B7082,0xFF5B7082,0xFF5B7082,0xFF5B7082,
+   0xFF5B7082,0xFF5B7083,0xFF5B7082,0xFF5C7183,0xFF5C7183,0xFF5D7284,0xFF5E7385,
+   0xFF5F7487,0xFF607487,0xFF5F7587,0xFF607588,0xFF607589,0xFF617589,0xFF61758A,
+   0xFF61758A,0xFF61758A,0xFF61758A,0xFF62768B,0xFF62768C,0xFF3E4D60,0xFF394657,
+   0xFF5E6D7F,0xFF617082,0xFF617082,0xFF617082,0xFF606F81,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF5F6F80,
+   0xFF657686,0xFF5D6E7D,0xFF344350,0xFF4E616D,0xFF5D727D,0xFF5D737C,0xFF5E737C,
+   0xFF5E737D,0xFF5F717F,0xFF607180,0xFF5F727F,0xFF5F727E,0xFF5F727E,0xFF5E737D,
+   0xFF5D747B,0xFF5C747A,0xFF5B7479,0xFF5A7377,0xFF597377,0xFF597377,0xFF597476,
+   0xFF587475,0xFF587475,0xFF587574,0xFF577574,0xFF577673,0xFF577573,0xFF587474,
+   0xFF587275,0xFF597076,0xFF597076,0xFF597176,0xFF5A7177,0xFF556C73,0xFF384D54,
+   0xFF283942,0xFF3E525F,0xFF5A7180,0xFF5A7381,0xFF597380,0xFF59737F,0xFF58737E,
+   0xFF59727F,0xFF5A7181,0xFF5B7182,0xFF5A7181,0xFF59727F,0xFF59727F,0xFF58727E,
+   0xFF58737D,0xFF58737D,0xFF58737E,0xFF59727F,0xFF5A7180,0xFF5B7281,0xFF5C7383,
+   0xFF5E7585,0xFF5E7685,0xFF5E7684,0xFF5E7684,0xFF5E7684,0xFF5E7685,0xFF5E7686,
+   0xFF5F7786,0xFF5F7786,0xFF5F7786,0xFF5F7787,0xFF5F7787,0xFF617989,0xFF5D7384,
+   0xFF374855,0xFF3D4D5A,0xFF5E707F,0xFF607180,0xFF607181,0xFF607181,0xFF5F7180,
+   0xFF5F707F,0xFF5F707F,0xFF5F707F,0xFF5E717F,0xFF5F707F,0xFF5F707F,0xFF5F707F,
+   0xFF5F707E,0xFF5F6F7E,0xFF5F6F7E,0xFF5E707E,0xFF5E707D,0xFF5E707D,0xFF5E707D,
+   0xFF5E707D,0xFF5E707D,0xFF5F717D,0xFF5E717D,0xFF5E717E,0xFF5E717E,0xFF5E717E,
+   0xFF5E717E,0xFF5E717E,0xFF647784,0xFF5C6F7C,0xFF33444F,0xFF4E616D,0xFF5E727E,
+   0xFF5E727D,0xFF5E737D,0xFF5E737C,0xFF5E737C,0xFF5D737C,0xFF5D737C,0xFF5E737C,
+   0xFF5E737C,0xFF5E737C,0xFF5E737C,0xFF5E737D,0xFF5E717D,0xFF5D707C,0xFF5C717A,
+   0xFF5C717A,0xFF5C717A,0xFF5C717A,0xFF5C717B,0xFF5C707B,0xFF5C717B,0xFF5D707B,
+   0xFF5D707C,0xFF5D6F7C,0xFF5D6E7B,0xFF5D6D7B,0xFF5D6D7B,0xFF5D6D7C,0xFF5E6E7D,
+   0xFF596978,0xFF3B495A,0xFF2B3748,0xFF3F5164,0xFF5B6F82,0xFF5C7183,0xFF5C7183,
+   0xFF5B7083,0xFF5B7083,0xFF5B7082,0xFF5B7082,0xFF5B7082,0xFF5A7181,0xFF5A7181,
+   0xFF5B7082,0xFF5B7082,0xFF5B7082,0xFF5B7082,0xFF5B7082,0xFF5B7082,0xFF5B7082,
+   0xFF5C7183,0xFF5D7284,0xFF5E7486,0xFF5F7587,0xFF5F7587,0xFF607488,0xFF607488,
+   0xFF607487,0xFF607588,0xFF607689,0xFF607689,0xFF607689,0xFF607689,0xFF617589,
+   0xFF62778B,0xFF5E7287,0xFF384659,0xFF3E4B5C,0xFF606F81,0xFF617082,0xFF617082,
+   0xFF617082,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF606F81,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E7F,0xFF606E80,0xFF616F81,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF5F7080,0xFF607180,0xFF687B8A,0xFF435360,
+   0xFF344650,0xFF576E76,0xFF5C747A,0xFF5C747A,0xFF5D747B,0xFF5F727D,0xFF5F727E,
+   0xFF5F727E,0xFF5F717F,0xFF5F717F,0xFF5F727E,0xFF5F727E,0xFF5E737D,0xFF5D737B,
+   0xFF5B7279,0xFF5A7278,0xFF597377,0xFF597376,0xFF587475,0xFF587574,0xFF577573,
+   0xFF577673,0xFF567672,0xFF577573,0xFF587474,0xFF587274,0xFF587175,0xFF597176,
+   0xFF597176,0xFF5B7179,0xFF42575F,0xFF273940,0xFF283941,0xFF465D69,0xFF5B7381,
+   0xFF59747E,0xFF58737E,0xFF58737E,0xFF58737E,0xFF58737E,0xFF59727F,0xFF5A7180,
+   0xFF59717F,0xFF59707E,0xFF58707D,0xFF58717D,0xFF58737D,0xFF58737D,0xFF58737E,
+   0xFF58727E,0xFF5A7280,0xFF5C7383,0xFF5D7584,0xFF5E7685,0xFF5E7685,0xFF5E7685,
+   0xFF5E7685,0xFF5E7685,0xFF5E7685,0xFF5E7685,0xFF5E7685,0xFF5E7686,0xFF5F7786,
+   0xFF5F7787,0xFF5F7787,0xFF62798B,0xFF566C7E,0xFF314150,0xFF41515F,0xFF5F7080,
+   0xFF607181,0xFF607181,0xFF607181,0xFF5F7080,0xFF5F7080,0xFF5F7080,0xFF5F707F,
+   0xFF5F707F,0xFF5F707F,0xFF5F707F,0xFF5F707F,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,
+   0xFF5F6F7E,0xFF5E707E,0xFF5E707E,0xFF5E707D,0xFF5E707D,0xFF5F717E,0xFF5F717E,
+   0xFF5F717E,0xFF5E717E,0xFF5E717E,0xFF5E717E,0xFF5E717E,0xFF5E717E,0xFF5F727E,
+   0xFF677C88,0xFF42545F,0xFF354551,0xFF596C78,0xFF5E737D,0xFF5E737D,0xFF5E737C,
+   0xFF5E737D,0xFF5E737D,0xFF5E737C,0xFF5E737C,0xFF5E737D,0xFF5E737D,0xFF5E737D,
+   0xFF5E737D,0xFF5E717C,0xFF5D707B,0xFF5C707A,0xFF5C717A,0xFF5C717A,0xFF5C717A,
+   0xFF5C707B,0xFF5D707B,0xFF5D707B,0xFF5D707B,0xFF5D707C,0xFF5D6F7B,0xFF5D6E7B,
+   0xFF5D6D7C,0xFF5D6D7B,0xFF5D6D7C,0xFF5E6E7D,0xFF455564,0xFF2A3644,0xFF2A3848,
+   0xFF485C6E,0xFF5D7284,0xFF5B7182,0xFF5B7082,0xFF5B7082,0xFF5B7082,0xFF5B7182,
+   0xFF5A7181,0xFF5A7181,0xFF5A7180,0xFF5A6F80,0xFF596F80,0xFF5A6F80,0xFF5B7082,
+   0xFF5B7082,0xFF5B7082,0xFF5B7082,0xFF5B7182,0xFF5C7384,0xFF5E7585,0xFF5F7586,
+   0xFF5F7586,0xFF5F7587,0xFF607487,0xFF607487,0xFF607487,0xFF5F7587,0xFF5F7588,
+   0xFF607588,0xFF607589,0xFF607689,0xFF607689,0xFF63788C,0xFF586A80,0xFF334053,
+   0xFF425061,0xFF606F81,0xFF617082,0xFF617082,0xFF617082,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E7F,
+   0xFF616F80,0xFF616F81,0xFF616F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,
+   0xFF5F7080,0xFF5F7080,0xFF657785,0xFF506370,0xFF2B3C46,0xFF485F66,0xFF5C757A,
+   0xFF5B7579,0xFF5C757A,0xFF5D747B,0xFF5E737C,0xFF5E737D,0xFF5F727E,0xFF60717F,
+   0xFF60717F,0xFF60717F,0xFF5F717E,0xFF5E717C,0xFF5C7079,0xFF5B7178,0xFF5A7276,
+   0xFF597276,0xFF587375,0xFF577573,0xFF567672,0xFF567672,0xFF567572,0xFF577474,
+   0xFF577274,0xFF577174,0xFF587174,0xFF587174,0xFF597376,0xFF4D656A,0xFF2F444B,
+   0xFF2A3E43,0xFF2C4247,0xFF4C676E,0xFF59757E,0xFF58727C,0xFF58727C,0xFF58737D,
+   0xFF58737D,0xFF58737D,0xFF58727E,0xFF58717E,0xFF58707D,0xFF58707D,0xFF57707C,
+   0xFF56707B,0xFF57717C,0xFF58727D,0xFF58737D,0xFF59747E,0xFF5C7482,0xFF5D7684,
+   0xFF5E7684,0xFF5E7685,0xFF5E7685,0xFF5E7685,0xFF5E7685,0xFF5E7684,0xFF5E7684,
+   0xFF5E7685,0xFF5E7686,0xFF5E7686,0xFF5F7687,0xFF5F7687,0xFF5F7587,0xFF63798C,
+   0xFF4C6072,0xFF2F3D4D,0xFF465666,0xFF607181,0xFF607181,0xFF607181,0xFF607180,
+   0xFF5F6F7F,0xFF5E6F7E,0xFF5E6F7E,0xFF5E707E,0xFF5E707E,0xFF5F707F,0xFF5F707F,
+   0xFF5F707F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7E,0xFF5E707E,
+   0xFF5E707E,0xFF5F717E,0xFF5F717E,0xFF5F717E,0xFF5F717E,0xFF5F717E,0xFF5E717E,
+   0xFF5E717E,0xFF5E717E,0xFF5E717E,0xFF5D717D,0xFF637784,0xFF506370,0xFF2C3B47,
+   0xFF4A5D68,0xFF5E737E,0xFF5E737D,0xFF5E737D,0xFF5E737D,0xFF5E737D,0xFF5E737D,
+   0xFF5E737C,0xFF5E737D,0xFF5E737D,0xFF5E737D,0xFF5E727D,0xFF5E707C,0xFF5D6F7B,
+   0xFF5C6F7A,0xFF5C7079,0xFF5C7079,0xFF5C7179,0xFF5C707A,0xFF5C707B,0xFF5D707B,
+   0xFF5D707C,0xFF5C6F7B,0xFF5C6E7A,0xFF5C6D7B,0xFF5D6D7B,0xFF5D6D7B,0xFF5E6F7D,
+   0xFF516170,0xFF334150,0xFF2E3B4A,0xFF304050,0xFF4F6475,0xFF5C7283,0xFF5A7080,
+   0xFF5A7081,0xFF5B7082,0xFF5B7182,0xFF5B7182,0xFF5A7181,0xFF59707F,0xFF586F7E,
+   0xFF596F7E,0xFF586E7E,0xFF586E7E,0xFF596F80,0xFF5A6F81,0xFF5B7082,0xFF5C7283,
+   0xFF5D7484,0xFF5E7585,0xFF5E7685,0xFF5F7686,0xFF5F7586,0xFF5F7586,0xFF5F7586,
+   0xFF5F7586,0xFF5F7586,0xFF5F7587,0xFF5F7587,0xFF5F7588,0xFF5F7588,0xFF5F7588,
+   0xFF607489,0xFF64788D,0xFF4D5E74,0xFF303C4F,0xFF475567,0xFF617082,0xFF617082,
+   0xFF617082,0xFF617081,0xFF606E80,0xFF5F6E7F,0xFF5F6E80,0xFF5F6E80,0xFF606F80,
+   0xFF606F81,0xFF606F81,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF616F80,0xFF616F80,0xFF616F81,0xFF616F81,
+   0xFF616F81,0xFF616F81,0xFF606F81,0xFF606F81,0xFF5F7080,0xFF5F7080,0xFF637484,
+   0xFF576A77,0xFF2D3F49,0xFF384D54,0xFF597277,0xFF5C7679,0xFF5B7679,0xFF5C7579,
+   0xFF5C747A,0xFF5D747B,0xFF5E737D,0xFF5F727E,0xFF60717F,0xFF607180,0xFF5F6F7E,
+   0xFF5E6E7D,0xFF5D6F7B,0xFF5B7079,0xFF5B7178,0xFF5A7276,0xFF587374,0xFF577473,
+   0xFF577572,0xFF567572,0xFF567372,0xFF567173,0xFF567173,0xFF567173,0xFF567173,
+   0xFF587274,0xFF536C6F,0xFF364D51,0xFF4B6267,0xFF4B6368,0xFF2F464A,0xFF4D686F,
+   0xFF57737C,0xFF56707B,0xFF57717C,0xFF58737D,0xFF58737D,0xFF58737C,0xFF57717B,
+   0xFF56707B,0xFF566F7B,0xFF576F7C,0xFF576F7C,0xFF576F7B,0xFF576F7B,0xFF57717C,
+   0xFF58757E,0xFF5B7780,0xFF5D7783,0xFF5E7684,0xFF5E7684,0xFF5E7685,0xFF5E7684,
+   0xFF5E7684,0xFF5D7784,0xFF5D7783,0xFF5D7784,0xFF5E7685,0xFF5E7686,0xFF5F7587,
+   0xFF5F7587,0xFF5F7587,0xFF5F7587,0xFF61778B,0xFF405264,0xFF2E3C4B,0xFF4B5B6B,
+   0xFF617182,0xFF607181,0xFF607180,0xFF5E6F7E,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7B,
+   0xFF5C6E7B,0xFF5D6E7B,0xFF5D6E7C,0xFF5D6F7C,0xFF5E6F7D,0xFF5F6F7E,0xFF5F6F7F,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF5E6F7E,0xFF5E707E,0xFF5F707E,0xFF5F717E,0xFF5F717E,
+   0xFF5F717E,0xFF5F717E,0xFF5F717E,0xFF5F717E,0xFF5E717E,0xFF5E717E,0xFF5E717E,
+   0xFF5E717E,0xFF627582,0xFF576A77,0xFF2E3E4B,0xFF3A4B57,0xFF5B707A,0xFF5F737E,
+   0xFF5E737D,0xFF5E737D,0xFF5E737D,0xFF5E737D,0xFF5E737D,0xFF5E737D,0xFF5E737D,
+   0xFF5E727D,0xFF5E707D,0xFF5E6F7C,0xFF5E6E7C,0xFF5D6F7B,0xFF5C6F7A,0xFF5C7079,
+   0xFF5C7079,0xFF5C707A,0xFF5C707A,0xFF5C6F7A,0xFF5C6E7A,0xFF5B6D79,0xFF5B6D79,
+   0xFF5C6C7A,0xFF5B6D7A,0xFF5C6E7B,0xFF576876,0xFF3A4957,0xFF4F5F6E,0xFF4F606E,
+   0xFF324453,0xFF506576,0xFF5A7080,0xFF586E7E,0xFF596F7F,0xFF5A7181,0xFF5A7181,
+   0xFF5A7080,0xFF59707E,0xFF586F7D,0xFF576E7D,0xFF586E7E,0xFF586E7E,0xFF586E7E,
+   0xFF586E7E,0xFF596F80,0xFF5B7283,0xFF5D7585,0xFF5E7685,0xFF5E7685,0xFF5E7685,
+   0xFF5E7685,0xFF5E7685,0xFF5F7686,0xFF5F7686,0xFF5F7586,0xFF5F7586,0xFF5F7587,
+   0xFF5F7587,0xFF5F7588,0xFF5F7588,0xFF607488,0xFF607489,0xFF62768C,0xFF415165,
+   0xFF2F3B4D,0xFF4C5A6C,0xFF617183,0xFF617082,0xFF617081,0xFF5F6E7F,0xFF5E6C7E,
+   0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7E,0xFF5E6D7E,0xFF5F6E7F,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF616F80,
+   0xFF607080,0xFF607080,0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,
+   0xFF606F81,0xFF5F6F80,0xFF5F7080,0xFF627382,0xFF5B6E7B,0xFF30434C,0xFF2B3F46,
+   0xFF465F63,0xFF5A7477,0xFF5D777A,0xFF5C7679,0xFF5C767A,0xFF5D757A,0xFF5D747B,
+   0xFF5E737D,0xFF5E717D,0xFF5E6F7D,0xFF5F6E7D,0xFF5F6D7E,0xFF5E6E7D,0xFF5D6F7B,
+   0xFF5C6F7A,0xFF5B7178,0xFF597375,0xFF587374,0xFF587374,0xFF577373,0xFF567172,
+   0xFF567173,0xFF567172,0xFF567272,0xFF577273,0xFF567072,0xFF3A5256,0xFF435960,
+   0xFF5E747D,0xFF556B73,0xFF31464C,0xFF4D6870,0xFF557179,0xFF557079,0xFF56707B,
+   0xFF57717C,0xFF57727C,0xFF56717B,0xFF56717A,0xFF557079,0xFF556F7A,0xFF576F7C,
+   0xFF576F7C,0xFF576F7C,0xFF576F7B,0xFF57727C,0xFF59767E,0xFF5B7980,0xFF5D7882,
+   0xFF5E7685,0xFF5E7685,0xFF5E7685,0xFF5E7685,0xFF5E7684,0xFF5E7684,0xFF5D7784,
+   0xFF5D7784,0xFF5E7685,0xFF5F7587,0xFF5F7588,0xFF5F7587,0xFF5F7587,0xFF607688,
+   0xFF5D7285,0xFF374659,0xFF303D4C,0xFF506070,0xFF617282,0xFF607080,0xFF5E6F7E,
+   0xFF5D6D7D,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7B,0xFF5D6D7B,0xFF5C6E7B,0xFF5C6E7B,
+   0xFF5C6E7B,0xFF5E6F7D,0xFF5E6F7E,0xFF5F6F7F,0xFF5F7080,0xFF607080,0xFF5F707F,
+   0xFF5F707F,0xFF5F717F,0xFF5F717E,0xFF5F717E,0xFF5F717E,0xFF5F717E,0xFF5F717E,
+   0xFF5F717E,0xFF5E717E,0xFF5D717D,0xFF5E717D,0xFF5E717E,0xFF617481,0xFF5B6E7B,
+   0xFF32424E,0xFF2D3D48,0xFF495C67,0xFF5D717B,0xFF60747E,0xFF5F747E,0xFF5F747E,
+   0xFF5F737E,0xFF5F737E,0xFF5F737D,0xFF5E727C,0xFF5D707C,0xFF5D6F7B,0xFF5D6F7B,
+   0xFF5E6E7C,0xFF5D6F7B,0xFF5D6F7B,0xFF5C6F7A,0xFF5C707A,0xFF5C707A,0xFF5C6F7A,
+   0xFF5C6E79,0xFF5B6D79,0xFF5B6D79,0xFF5B6D7A,0xFF5C6C7A,0xFF5B6D7A,0xFF5A6C78,
+   0xFF3E4F5B,0xFF465764,0xFF607280,0xFF576977,0xFF334454,0xFF506576,0xFF586E7E,
+   0xFF576E7D,0xFF586F7E,0xFF596F7F,0xFF59707F,0xFF586F7E,0xFF576F7D,0xFF566E7C,
+   0xFF566E7B,0xFF576F7C,0xFF586E7D,0xFF586E7D,0xFF586E7E,0xFF59707F,0xFF5C7383,
+   0xFF5E7684,0xFF5E7685,0xFF5E7685,0xFF5E7685,0xFF5E7685,0xFF5E7685,0xFF5E7685,
+   0xFF5E7685,0xFF5F7586,0xFF5F7586,0xFF5F7588,0xFF5F7588,0xFF5F7588,0xFF5F7588,
+   0xFF5F7588,0xFF61758A,0xFF5D7187,0xFF37465A,0xFF303C4D,0xFF515F71,0xFF627183,
+   0xFF606F81,0xFF5F6E7F,0xFF5E6C7E,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,
+   0xFF5E6C7D,0xFF5E6C7D,0xFF5E6D7E,0xFF5F6E7F,0xFF5F6E7F,0xFF606E80,0xFF606F81,
+   0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,0xFF607080,0xFF607080,0xFF616F81,
+   0xFF616F81,0xFF616F81,0xFF616F81,0xFF627082,0xFF637284,0xFF637384,0xFF617382,
+   0xFF627482,0xFF5E727E,0xFF31454D,0xFF1F2F35,0xFF2B3F44,0xFF3D5559,0xFF516B6F,
+   0xFF5B7579,0xFF5C777A,0xFF5D767A,0xFF5D757B,0xFF5D747B,0xFF5D717B,0xFF5D6F7B,
+   0xFF5E6E7D,0xFF5F6D7E,0xFF5F6D7E,0xFF5F6D7D,0xFF5E6E7C,0xFF5B7179,0xFF597276,
+   0xFF587374,0xFF587374,0xFF577273,0xFF577173,0xFF577173,0xFF567172,0xFF567273,
+   0xFF577174,0xFF42585E,0xFF3B5057,0xFF556D73,0xFF586E77,0xFF536872,0xFF31454E,
+   0xFF4C676F,0xFF547178,0xFF547078,0xFF56707A,0xFF56707B,0xFF57707B,0xFF56707A,
+   0xFF557079,0xFF556F79,0xFF556F7A,0xFF576F7C,0xFF576F7C,0xFF576F7C,0xFF566F7B,
+   0xFF57727C,0xFF59777F,0xFF5B7980,0xFF5C7881,0xFF5E7684,0xFF5E7685,0xFF5E7685,
+   0xFF5E7685,0xFF5E7684,0xFF5E7684,0xFF5D7784,0xFF5D7784,0xFF5E7686,0xFF5F7687,
+   0xFF5F7587,0xFF5F7587,0xFF5F7587,0xFF62788A,0xFF52677A,0xFF2F3E4F,0xFF313E4E,
+   0xFF526271,0xFF5E6F7E,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,
+   0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7B,0xFF5D6E7B,0xFF5D6E7C,0xFF5D6F7D,0xFF5E6F7D,
+   0xFF5F7080,0xFF627383,0xFF637485,0xFF637484,0xFF617382,0xFF60717F,0xFF5F717E,
+   0xFF5F717E,0xFF5F717E,0xFF5F717E,0xFF5F717E,0xFF5F717E,0xFF5F727E,0xFF607480,
+   0xFF617581,0xFF607480,0xFF617481,0xFF5E727D,0xFF32444F,0xFF212D38,0xFF2D3D48,
+   0xFF40525E,0xFF546872,0xFF5E737D,0xFF60747E,0xFF60737E,0xFF60737F,0xFF5F727E,
+   0xFF5E707C,0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7C,0xFF5D6F7B,0xFF5D6F7B,
+   0xFF5C6F7A,0xFF5C707A,0xFF5C6F7A,0xFF5C6F7A,0xFF5C6E7A,0xFF5B6D7A,0xFF5B6D7A,
+   0xFF5B6D7A,0xFF5C6D7A,0xFF5B6D7A,0xFF455662,0xFF3D4E5A,0xFF586A77,0xFF5A6D7A,
+   0xFF556775,0xFF334454,0xFF4F6475,0xFF586D7D,0xFF576D7C,0xFF576E7D,0xFF586E7D,
+   0xFF586F7D,0xFF576F7C,0xFF566E7B,0xFF566E7B,0xFF566E7B,0xFF576F7C,0xFF576F7C,
+   0xFF586E7D,0xFF586E7E,0xFF597080,0xFF5B7482,0xFF5D7784,0xFF5E7784,0xFF5D7784,
+   0xFF5E7684,0xFF5E7684,0xFF5E7685,0xFF5E7684,0xFF5E7685,0xFF5E7685,0xFF5F7587,
+   0xFF607488,0xFF5F7588,0xFF5F7588,0xFF5F7588,0xFF5F7588,0xFF62778C,0xFF53667B,
+   0xFF303D50,0xFF323E4F,0xFF536172,0xFF5F6E7F,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,
+   0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5F6D7E,
+   0xFF5F6E7F,0xFF5F6E7F,0xFF606F81,0xFF627284,0xFF637485,0xFF637384,0xFF627183,
+   0xFF617081,0xFF607080,0xFF607080,0xFF616F81,0xFF616F81,0xFF616F81,0xFF637284,
+   0xFF677688,0xFF6A7B8D,0xFF6B7D8E,0xFF697C8C,0xFF687A88,0xFF5C707C,0xFF2F424A,
+   0xFF293C42,0xFF32464C,0xFF283B41,0xFF30464B,0xFF3F575C,0xFF556F73,0xFF5D777B,
+   0xFF5D757B,0xFF5D737B,0xFF5C717A,0xFF5C707A,0xFF5D6F7C,0xFF5F6D7D,0xFF5F6D7E,
+   0xFF5F6D7E,0xFF5E6E7D,0xFF5C7079,0xFF5A7277,0xFF587374,0xFF587374,0xFF577273,
+   0xFF577173,0xFF577173,0xFF577273,0xFF546F70,0xFF435A5F,0xFF3B4F57,0xFF546A72,
+   0xFF566E74,0xFF586E76,0xFF566B74,0xFF31464D,0xFF4A656D,0xFF547178,0xFF547078,
+   0xFF556F79,0xFF556F7A,0xFF566E7B,0xFF566F7A,0xFF556F79,0xFF556F7A,0xFF566E7B,
+   0xFF576F7C,0xFF576F7C,0xFF576F7C,0xFF56707B,0xFF57737C,0xFF59777F,0xFF5B7980,
+   0xFF5C7881,0xFF5E7684,0xFF5E7685,0xFF5E7685,0xFF5E7685,0xFF5E7685,0xFF5E7685,
+   0xFF5E7684,0xFF5E7684,0xFF5E7686,0xFF5F7687,0xFF5F7587,0xFF5F7687,0xFF5F7587,
+   0xFF61778A,0xFF435769,0xFF293646,0xFF354352,0xFF556574,0xFF5D6D7B,0xFF5C6C7A,
+   0xFF5C6C7A,0xFF5D6D7B,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,
+   0xFF5D6E7B,0xFF5D6F7C,0xFF5D6F7D,0xFF5E6F7D,0xFF5F7180,0xFF627383,0xFF647585,
+   0xFF637585,0xFF627483,0xFF617281,0xFF60717F,0xFF5F717E,0xFF5F717E,0xFF5F717E,
+   0xFF5F717E,0xFF617380,0xFF657885,0xFF687D89,0xFF697F8B,0xFF687D89,0xFF667B87,
+   0xFF5C707B,0xFF2F414B,0xFF2B3A45,0xFF35434F,0xFF2B3944,0xFF33434F,0xFF435560,
+   0xFF596C78,0xFF617380,0xFF607380,0xFF5F717E,0xFF5E6F7C,0xFF5D6F7B,0xFF5D6F7B,
+   0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7B,
+   0xFF5D6F7B,0xFF5C6E7A,0xFF5B6D7A,0xFF5B6D79,0xFF5C6E7A,0xFF596B77,0xFF475764,
+   0xFF3E4D5A,0xFF576875,0xFF596B77,0xFF596C79,0xFF576A77,0xFF334553,0xFF4D6372,
+   0xFF576E7C,0xFF576D7C,0xFF576D7C,0xFF576E7C,0xFF566E7C,0xFF566E7B,0xFF566E7B,
+   0xFF566E7A,0xFF566E7B,0xFF576F7B,0xFF576F7B,0xFF576F7C,0xFF586E7E,0xFF59707F,
+   0xFF5B7582,0xFF5D7783,0xFF5D7783,0xFF5D7783,0xFF5E7684,0xFF5D7784,0xFF5E7684,
+   0xFF5E7684,0xFF5E7685,0xFF5E7685,0xFF5F7587,0xFF607488,0xFF607488,0xFF5F7588,
+   0xFF5F7588,0xFF607489,0xFF62768C,0xFF45566A,0xFF2A3546,0xFF364254,0xFF566475,
+   0xFF5E6C7D,0xFF5D6B7C,0xFF5D6B7C,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,
+   0xFF5E6C7D,0xFF5E6C7D,0xFF5E6D7E,0xFF5F6E7F,0xFF5F6E7F,0xFF5F6E7F,0xFF607081,
+   0xFF627384,0xFF637585,0xFF647485,0xFF637384,0xFF627182,0xFF607080,0xFF607080,
+   0xFF616F81,0xFF616F81,0xFF616F81,0xFF697A8C,0xFF6C7C8E,0xFF6C7D8F,0xFF6C7D8E,
+   0xFF6B7D8D,0xFF6A7C8B,0xFF4D5F6C,0xFF2E4049,0xFF4F666D,0xFF667F85,0xFF50666B,
+   0xFF4C6267,0xFF40565B,0xFF33494E,0xFF496166,0xFF5A7277,0xFF5D737A,0xFF5C717A,
+   0xFF5C707A,0xFF5D6F7C,0xFF5F6D7D,0xFF5F6D7E,0xFF5F6D7E,0xFF5E6E7D,0xFF5C707A,
+   0xFF5A7277,0xFF597375,0xFF587374,0xFF577274,0xFF567272,0xFF557071,0xFF4D6869,
+   0xFF3C5557,0xFF41585C,0xFF566E73,0xFF577075,0xFF556D72,0xFF566E74,0xFF586F77,
+   0xFF32454E,0xFF465F69,0xFF557079,0xFF547078,0xFF547078,0xFF547079,0xFF566E7B,
+   0xFF566E7B,0xFF556F79,0xFF556F7A,0xFF566E7C,0xFF576F7C,0xFF576F7C,0xFF56707B,
+   0xFF56707A,0xFF58737D,0xFF5A7780,0xFF5C7881,0xFF5D7882,0xFF5E7684,0xFF5E7685,
+   0xFF5E7685,0xFF5E7685,0xFF5F7686,0xFF5E7685,0xFF5E7684,0xFF5D7784,0xFF5E7685,
+   0xFF5E7686,0xFF5E7686,0xFF5F7687,0xFF607688,0xFF5A6F82,0xFF354657,0xFF25303E,
+   0xFF3C4B5A,0xFF5A6A79,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5D6C7C,
+   0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6E7C,0xFF5D6F7C,0xFF5E6F7D,
+   0xFF5E6F7E,0xFF607180,0xFF627483,0xFF637585,0xFF637585,0xFF637584,0xFF627483,
+   0xFF607280,0xFF5F717E,0xFF5F717E,0xFF60727F,0xFF637683,0xFF677B89,0xFF6A7E8C,
+   0xFF6A7F8C,0xFF69808B,0xFF697F8A,0xFF697E89,0xFF4C606B,0xFF2F404A,0xFF516470,
+   0xFF697D88,0xFF52646F,0xFF4E606B,0xFF435360,0xFF364653,0xFF4C5E6B,0xFF5D6E7C,
+   0xFF5F717E,0xFF5E6F7C,0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7B,
+   0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7C,0xFF5D6F7B,0xFF5C6E7B,0xFF5B6D79,
+   0xFF5A6C78,0xFF526470,0xFF40515E,0xFF455562,0xFF596B78,0xFF5B6D79,0xFF586A76,
+   0xFF586C77,0xFF596E79,0xFF334652,0xFF475E6C,0xFF576E7C,0xFF566E7C,0xFF576D7C,
+   0xFF566E7C,0xFF566E7C,0xFF566E7C,0xFF566E7B,0xFF566E7B,0xFF566E7A,0xFF576F7B,
+   0xFF576F7B,0xFF576F7C,0xFF586F7D,0xFF59717F,0xFF5B7582,0xFF5D7783,0xFF5D7783,
+   0xFF5D7783,0xFF5E7684,0xFF5E7684,0xFF5E7684,0xFF5E7685,0xFF5E7685,0xFF5F7686,
+   0xFF5F7587,0xFF607488,0xFF607489,0xFF607488,0xFF607488,0xFF61758A,0xFF5B6D81,
+   0xFF364455,0xFF262F3F,0xFF3D4A5B,0xFF5B697A,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,
+   0xFF5D6B7C,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6D7E,
+   0xFF5F6E7F,0xFF5F6E7F,0xFF5F6F7F,0xFF607180,0xFF627483,0xFF637585,0xFF637585,
+   0xFF637585,0xFF627483,0xFF617181,0xFF607080,0xFF616F81,0xFF627082,0xFF657486,
+   0xFF6C7D8F,0xFF6C7D8F,0xFF6C7D8F,0xFF6C7D8E,0xFF6C7F8F,0xFF627484,0xFF364552,
+   0xFF455862,0xFF61787F,0xFF5F787D,0xFF627C80,0xFF536C70,0xFF637D81,0xFF546C71,
+   0xFF364B51,0xFF374B52,0xFF4A6067,0xFF556B73,0xFF5A6E78,0xFF5D6E7C,0xFF5F6E7E,
+   0xFF5F6D7E,0xFF606E7F,0xFF5F6E7E,0xFF5D707B,0xFF5B7278,0xFF597375,0xFF557071,
+   0xFF4C6768,0xFF415C5C,0xFF375252,0xFF2E4748,0xFF4A6466,0xFF5B7478,0xFF587175,
+   0xFF566E73,0xFF556D72,0xFF556E73,0xFF597177,0xFF344750,0xFF405562,0xFF566E7B,
+   0xFF547078,0xFF547077,0xFF547078,0xFF556F79,0xFF556F79,0xFF556E75,0xFF556E79,
+   0xFF566E7B,0xFF576F7B,0xFF56707A,0xFF56707A,0xFF56707A,0xFF58737D,0xFF5A7780,
+   0xFF5C7881,0xFF5D7783,0xFF5E7684,0xFF5E7685,0xFF5E7685,0xFF5E7685,0xFF5E7685,
+   0xFF5E7784,0xFF5D7783,0xFF5D7783,0xFF5D7784,0xFF5E7685,0xFF5E7686,0xFF5F7687,
+   0xFF607688,0xFF475B6D,0xFF293645,0xFF212C39,0xFF3E4D5C,0xFF5A6A79,0xFF5C6C7B,
+   0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5D6C7B,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,
+   0xFF5D6D7C,0xFF5D6F7C,0xFF5D6F7D,0xFF5E6F7D,0xFF5E6F7E,0xFF607180,0xFF627483,
+   0xFF637584,0xFF637584,0xFF637584,0xFF637584,0xFF617482,0xFF607280,0xFF627382,
+   0xFF667888,0xFF6A7D8C,0xFF6B7E8D,0xFF6B7F8D,0xFF6A7F8C,0xFF6A7F8B,0xFF6A808C,
+   0xFF617581,0xFF354651,0xFF465763,0xFF637682,0xFF627581,0xFF657984,0xFF576974,
+   0xFF677987,0xFF576876,0xFF394856,0xFF3A4957,0xFF4C5E6A,0xFF576975,0xFF5B6D79,
+   0xFF5D6F7A,0xFF5D6F7B,0xFF5D6F7B,0xFF5E707C,0xFF5E707C,0xFF5E6F7C,0xFF5E6F7D,
+   0xFF5E6E7D,0xFF5A6B79,0xFF51636F,0xFF465864,0xFF3C4D59,0xFF33424F,0xFF4F606C,
+   0xFF5F717D,0xFF5C6E79,0xFF596C77,0xFF576B76,0xFF576C76,0xFF5A6F7A,0xFF344753,
+   0xFF405663,0xFF576E7C,0xFF566E7C,0xFF566E7C,0xFF566E7B,0xFF566E7C,0xFF576D7C,
+   0xFF566E7C,0xFF566E7B,0xFF566F7A,0xFF566F7B,0xFF56707B,0xFF576F7B,0xFF576F7C,
+   0xFF59717F,0xFF5C7582,0xFF5D7783,0xFF5D7783,0xFF5D7783,0xFF5D7783,0xFF5E7684,
+   0xFF5E7684,0xFF5E7685,0xFF5F7686,0xFF5F7586,0xFF5F7587,0xFF5F7588,0xFF607489,
+   0xFF607489,0xFF607489,0xFF617488,0xFF49586A,0xFF2A3544,0xFF222B3A,0xFF3E4C5D,
+   0xFF5B697A,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5E6C7D,
+   0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5F6D7E,0xFF5F6E7F,0xFF5F6E7F,0xFF5E6F7E,
+   0xFF607180,0xFF627483,0xFF637584,0xFF637584,0xFF637584,0xFF627584,0xFF627382,
+   0xFF617181,0xFF637284,0xFF677789,0xFF6B7B8D,0xFF6C7D8F,0xFF6C7D8F,0xFF6C7D8F,
+   0xFF6C7D8F,0xFF6A7C8C,0xFF445463,0xFF354451,0xFF5B707A,0xFF5F757D,0xFF5D757B,
+   0xFF5F787D,0xFF5D767A,0xFF51696D,0xFF657E84,0xFF667E84,0xFF3E525B,0xFF2B3C45,
+   0xFF344851,0xFF3E505B,0xFF435462,0xFF475766,0xFF4A5869,0xFF4B596A,0xFF4C5B6B,
+   0xFF4A5C67,0xFF455B61,0xFF3D5558,0xFF334C4E,0xFF2C4546,0xFF273F40,0xFF213638,
+   0xFF263B3F,0xFF3E5559,0xFF4C6369,0xFF546A72,0xFF576D75,0xFF566D74,0xFF576E74,
+   0xFF556E73,0xFF32484F,0xFF384D5A,0xFF556D7A,0xFF547079,0xFF547078,0xFF547077,
+   0xFF547078,0xFF547078,0xFF556D75,0xFF556E78,0xFF556F7A,0xFF566F7B,0xFF56707A,
+   0xFF56707A,0xFF56707A,0xFF56727B,0xFF59767F,0xFF5C7881,0xFF5D7783,0xFF5D7784,
+   0xFF5E7684,0xFF5E7684,0xFF5E7684,0xFF5D7784,0xFF5D7783,0xFF5C7782,0xFF5C7782,
+   0xFF5D7784,0xFF5D7685,0xFF5E7686,0xFF607788,0xFF506577,0xFF324353,0xFF1E2834,
+   0xFF1E2835,0xFF394856,0xFF576775,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,
+   0xFF5C6C7B,0xFF5C6C7B,0xFF5D6D7C,0xFF5D6D7B,0xFF5D6E7C,0xFF5D6F7C,0xFF5D707C,
+   0xFF5D6F7D,0xFF5E707D,0xFF607280,0xFF627583,0xFF627684,0xFF637584,0xFF637584,
+   0xFF637584,0xFF637584,0xFF657786,0xFF687B8A,0xFF6B7E8D,0xFF6B7E8E,0xFF6B7E8E,
+   0xFF6B7E8E,0xFF6B7E8D,0xFF6B7F8D,0xFF697D8A,0xFF435561,0xFF354450,0xFF5C6F7C,
+   0xFF617380,0xFF60737F,0xFF627582,0xFF60737F,0xFF556573,0xFF697B89,0xFF697B89,
+   0xFF41505E,0xFF2C3B47,0xFF364753,0xFF3E505B,0xFF425560,0xFF455863,0xFF475A65,
+   0xFF495B67,0xFF4B5C69,0xFF4B5B69,0xFF485866,0xFF42515F,0xFF394756,0xFF31404E,
+   0xFF2C3A47,0xFF25323E,0xFF2A3844,0xFF41525E,0xFF4F616C,0xFF566873,0xFF586C76,
+   0xFF576C76,0xFF586D77,0xFF566C76,0xFF334752,0xFF394D5B,0xFF566C7B,0xFF576E7C,
+   0xFF566E7B,0xFF566E7B,0xFF566E7B,0xFF566E7B,0xFF566E7B,0xFF566E7A,0xFF556F7A,
+   0xFF566F7B,0xFF576F7B,0xFF576F7B,0xFF576F7C,0xFF58717D,0xFF5A7481,0xFF5D7782,
+   0xFF5D7783,0xFF5D7783,0xFF5D7783,0xFF5D7783,0xFF5E7684,0xFF5E7685,0xFF5F7586,
+   0xFF5F7586,0xFF5F7586,0xFF5F7587,0xFF5F7588,0xFF607488,0xFF617589,0xFF526274,
+   0xFF344050,0xFF1F2734,0xFF1F2835,0xFF394757,0xFF586677,0xFF5D6B7C,0xFF5D6B7C,
+   0xFF5D6B7C,0xFF5D6B7C,0xFF5C6C7B,0xFF5D6C7C,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6D7E,
+   0xFF5F6E7E,0xFF5F6E7E,0xFF5E6F7E,0xFF5E6F7E,0xFF607281,0xFF627583,0xFF627684,
+   0xFF627684,0xFF627684,0xFF627684,0xFF637584,0xFF657787,0xFF6A7A8C,0xFF6C7D8F,
+   0xFF6C7D8F,0xFF6C7D8F,0xFF6C7D8F,0xFF6D7E90,0xFF6C7C8E,0xFF4F5E6F,0xFF303D4C,
+   0xFF536472,0xFF627681,0xFF5E747C,0xFF5D757B,0xFF5D767A,0xFF607A7E,0xFF576F73,
+   0xFF51686E,0xFF637A82,0xFF445862,0xFF22313A,0xFF1E2B34,0xFF26343F,0xFF2C3A48,
+   0xFF2C3847,0xFF2B3646,0xFF2C3747,0xFF2C3948,0xFF2C3B47,0xFF2C3F47,0xFF2F464A,
+   0xFF344D4F,0xFF395454,0xFF3B5757,0xFF3A5556,0xFF344C4F,0xFF2F4449,0xFF2E4148,
+   0xFF32444E,0xFF3C4E59,0xFF465863,0xFF4B5F68,0xFF435A61,0xFF2B3F46,0xFF304550,
+   0xFF506A75,0xFF557079,0xFF547079,0xFF547078,0xFF547077,0xFF556F79,0xFF566E7A,
+   0xFF556F79,0xFF556F7A,0xFF56707B,0xFF56707A,0xFF557179,0xFF557179,0xFF56717A,
+   0xFF57717C,0xFF5A737F,0xFF5C7482,0xFF5D7684,0xFF5D7783,0xFF5D7784,0xFF5D7783,
+   0xFF5D7783,0xFF5B7681,0xFF5A7680,0xFF5A7580,0xFF5B7582,0xFF5C7584,0xFF5E7586,
+   0xFF53697A,0xFF374959,0xFF232E3B,0xFF18212C,0xFF1B242F,0xFF2F3D4B,0xFF4C5C6A,
+   0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7A,0xFF5C6C7B,0xFF5D6D7B,0xFF5E6E7D,
+   0xFF5E6E7D,0xFF5D6F7D,0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5D717D,0xFF607380,
+   0xFF627583,0xFF627684,0xFF627684,0xFF637584,0xFF627684,0xFF637785,0xFF677B88,
+   0xFF6A7E8C,0xFF6B7E8D,0xFF6B7E8E,0xFF6B7E8E,0xFF6B7E8E,0xFF6C7E8E,0xFF6A7E8C,
+   0xFF4E5F6E,0xFF2F3E4B,0xFF526471,0xFF627582,0xFF60727F,0xFF607280,0xFF607280,
+   0xFF647683,0xFF5B6C79,0xFF556574,0xFF667886,0xFF465765,0xFF23303B,0xFF1F2A35,
+   0xFF26343F,0xFF2B3B46,0xFF2A3A44,0xFF293843,0xFF2A3945,0xFF2B3A47,0xFF2C3A48,
+   0xFF2E3D4A,0xFF334250,0xFF394957,0xFF3F4E5D,0xFF425160,0xFF3F505E,0xFF384855,
+   0xFF32414E,0xFF2F3F4B,0xFF32444E,0xFF3C4E58,0xFF455963,0xFF4B5F69,0xFF445962,
+   0xFF2C3D48,0xFF324452,0xFF526977,0xFF576E7C,0xFF566E7B,0xFF566E7B,0xFF566E7B,
+   0xFF556F7A,0xFF556F7A,0xFF556F79,0xFF556F7A,0xFF56707B,0xFF576F7B,0xFF56707B,
+   0xFF56707B,0xFF56707B,0xFF58717D,0xFF59737F,0xFF5B7581,0xFF5D7683,0xFF5D7783,
+   0xFF5D7784,0xFF5E7685,0xFF5E7585,0xFF5D7485,0xFF5D7384,0xFF5C7384,0xFF5C7384,
+   0xFF5D7486,0xFF5F7587,0xFF546677,0xFF384756,0xFF232D3B,0xFF19202D,0xFF1B2330,
+   0xFF303C4C,0xFF4D5A6B,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5C6C7B,
+   0xFF5D6C7C,0xFF5F6D7E,0xFF5F6D7F,0xFF5F6E7E,0xFF5E6F7E,0xFF5E6F7D,0xFF5D6F7D,
+   0xFF5E707D,0xFF607281,0xFF627583,0xFF627683,0xFF627683,0xFF627683,0xFF627684,
+   0xFF647685,0xFF687A8A,0xFF6C7D8E,0xFF6C7D8F,0xFF6C7D8F,0xFF6C7D90,0xFF6D7E90,
+   0xFF667689,0xFF4B596B,0xFF2C3746,0xFF404E5D,0xFF687B89,0xFF657985,0xFF60767F,
+   0xFF5E757C,0xFF5D767A,0xFF5D777A,0xFF617B7F,0xFF41545A,0xFF3D4F57,0xFF2C3E47,
+   0xFF2B3D46,0xFF31414D,0xFF384755,0xFF3E4D5C,0xFF414F60,0xFF445163,0xFF475466,
+   0xFF4A5969,0xFF50616F,0xFF576C76,0xFF5C757A,0xFF5C797A,0xFF5C7A7A,0xFF5D7B7B,
+   0xFF5E7B7B,0xFF5C797A,0xFF597477,0xFF566D74,0xFF4D616B,0xFF3C4D58,0xFF2F404B,
+   0xFF2C3E47,0xFF283841,0xFF1D2A33,0xFF2C3F4A,0xFF49636D,0xFF557079,0xFF547078,
+   0xFF547078,0xFF547078,0xFF556F79,0xFF556F7A,0xFF556F7A,0xFF556F79,0xFF56707A,
+   0xFF56707A,0xFF55717A,0xFF56707A,0xFF56707A,0xFF56707B,0xFF586E7D,0xFF586E7F,
+   0xFF59707F,0xFF5A7280,0xFF5B7481,0xFF5B7582,0xFF5A7581,0xFF597580,0xFF59757F,
+   0xFF5A7580,0xFF5B7582,0xFF597180,0xFF4A6070,0xFF354655,0xFF25313D,0xFF1A232E,
+   0xFF18212C,0xFF18212C,0xFF232E3B,0xFF394857,0xFF546472,0xFF5C6D7B,0xFF5C6C7A,
+   0xFF5C6C7B,0xFF5C6C7B,0xFF5E6E7D,0xFF5F6F7E,0xFF5F6F7E,0xFF5E707E,0xFF5E707D,
+   0xFF5D707C,0xFF5D707C,0xFF5E717C,0xFF607380,0xFF627583,0xFF627684,0xFF627684,
+   0xFF637683,0xFF637783,0xFF657985,0xFF687C89,0xFF6A7F8C,0xFF6B7E8D,0xFF6B7E8D,
+   0xFF6B7E8E,0xFF6C7E8F,0xFF657787,0xFF4A5A69,0xFF2B3745,0xFF3F4E5D,0xFF687B89,
+   0xFF667886,0xFF627482,0xFF617281,0xFF607280,0xFF617380,0xFF657785,0xFF44525F,
+   0xFF3F4D5A,0xFF2E3C49,0xFF2D3B48,0xFF31414D,0xFF374853,0xFF3D4E5A,0xFF3F515D,
+   0xFF41545F,0xFF455662,0xFF495968,0xFF50616F,0xFF586B78,0xFF5F727F,0xFF627482,
+   0xFF627483,0xFF637583,0xFF637683,0xFF617481,0xFF5D717D,0xFF576C76,0xFF4C616A,
+   0xFF3B4E57,0xFF2F414A,0xFF2C3E46,0xFF283840,0xFF1D2932,0xFF2C3E4B,0xFF4B6170,
+   0xFF576E7C,0xFF566E7B,0xFF556F7A,0xFF556F7A,0xFF556F79,0xFF556F79,0xFF556F79,
+   0xFF556F79,0xFF56707B,0xFF56707B,0xFF56707B,0xFF56707B,0xFF56707A,0xFF576F7B,
+   0xFF576F7C,0xFF57707C,0xFF58717D,0xFF59727F,0xFF5B7382,0xFF5C7484,0xFF5C7483,
+   0xFF5B7383,0xFF5B7383,0xFF5B7383,0xFF5C7484,0xFF597081,0xFF4B5F6E,0xFF354452,
+   0xFF25303D,0xFF1A222F,0xFF19202D,0xFF19202C,0xFF242D3C,0xFF3A4858,0xFF556374,
+   0xFF5E6C7D,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6C7C,0xFF5E6D7E,0xFF606E7F,0xFF5F6F7F,
+   0xFF5F6F7F,0xFF5E6F7E,0xFF5D6F7D,0xFF5D707C,0xFF5E717D,0xFF607381,0xFF627583,
+   0xFF627683,0xFF627683,0xFF637783,0xFF647785,0xFF667887,0xFF697B8B,0xFF6C7D8F,
+   0xFF6C7D8F,0xFF6C7D8F,0xFF657587,0xFF586779,0xFF475566,0xFF3B4757,0xFF2B3645,
+   0xFF566676,0xFF6B7E8D,0xFF697D8A,0xFF667C86,0xFF627981,0xFF5F777D,0xFF5E767B,
+   0xFF587176,0xFF33454B,0xFF30434B,0xFF475C66,0xFF5A6F7A,0xFF617481,0xFF647584,
+   0xFF677887,0xFF6A788A,0xFF6A788A,0xFF697789,0xFF667686,0xFF627482,0xFF5E747D,
+   0xFF5A7477,0xFF577474,0xFF567372,0xFF557272,0xFF557372,0xFF577473,0xFF587576,
+   0xFF5B7679,0xFF5F787E,0xFF617980,0xFF516770,0xFF364952,0xFF25313C,0xFF19232D,
+   0xFF273744,0xFF415965,0xFF546F78,0xFF547078,0xFF547079,0xFF556F7A,0xFF566E7B,
+   0xFF556F7A,0xFF556F79,0xFF556F79,0xFF56707A,0xFF56707A,0xFF56707A,0xFF566F7B,
+   0xFF56707A,0xFF56707A,0xFF576F7D,0xFF586E7E,0xFF586E7D,0xFF576E7D,0xFF58707D,
+   0xFF58737F,0xFF59757F,0xFF59757F,0xFF5A7680,0xFF59747F,0xFF4D6673,0xFF3A4F5C,
+   0xFF2E3F4D,0xFF2C3A47,0xFF2D3B48,0xFF2D3A48,0xFF2B3745,0xFF273341,0xFF222D3A,
+   0xFF2A3744,0xFF3E4D5C,0xFF576875,0xFF5D6D7B,0xFF5C6C7B,0xFF5D6D7C,0xFF5E6E7E,
+   0xFF5F6F7F,0xFF5F6F7E,0xFF5F6F7E,0xFF5E707D,0xFF5E707D,0xFF5D707C,0xFF5E717D,
+   0xFF617481,0xFF637684,0xFF647784,0xFF647884,0xFF647984,0xFF657984,0xFF667A86,
+   0xFF697D8A,0xFF6B7F8C,0xFF6B7F8E,0xFF6B7E8E,0xFF657787,0xFF566777,0xFF465665,
+   0xFF3A4856,0xFF2B3644,0xFF566676,0xFF6B7D8D,0xFF6A7C8B,0xFF687A89,0xFF657686,
+   0xFF637482,0xFF617380,0xFF5C6D7B,0xFF354250,0xFF32414E,0xFF495B68,0xFF5B6E7C,
+   0xFF617481,0xFF637683,0xFF667985,0xFF677A87,0xFF677B87,0xFF667986,0xFF647784,
+   0xFF627582,0xFF5F737F,0xFF5E717D,0xFF5C6F7C,0xFF5B6E7A,0xFF5A6D79,0xFF5A6E79,
+   0xFF5C6F7B,0xFF5D717C,0xFF5E747D,0xFF60787F,0xFF617881,0xFF516770,0xFF354951,
+   0xFF23323B,0xFF18232C,0xFF273742,0xFF425866,0xFF556D7A,0xFF556F7A,0xFF556F79,
+   0xFF556F79,0xFF556F79,0xFF556F79,0xFF556F79,0xFF557079,0xFF56707A,0xFF56707A,
+   0xFF56707A,0xFF56707A,0xFF56707A,0xFF576F7B,0xFF576F7C,0xFF576F7C,0xFF56707B,
+   0xFF576F7C,0xFF58707D,0xFF597280,0xFF5A7481,0xFF5A7481,0xFF5B7482,0xFF5A7281,
+   0xFF4E6473,0xFF3A4C5A,0xFF2E3B48,0xFF2B3744,0xFF2C3845,0xFF2C3744,0xFF2A3342,
+   0xFF262F3E,0xFF222A38,0xFF2A3544,0xFF3F4C5D,0xFF596678,0xFF5E6C7D,0xFF5D6B7C,
+   0xFF5E6C7D,0xFF5F6D7F,0xFF5F6E7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7E,
+   0xFF5D707C,0xFF5E717D,0xFF607481,0xFF637684,0xFF647784,0xFF647885,0xFF657885,
+   0xFF667886,0xFF677989,0xFF6A7C8C,0xFF6C7D8F,0xFF6D7E90,0xFF6D7E90,0xFF4F5D6F,
+   0xFF677789,0xFF718193,0xFF77889A,0xFF505E6F,0xFF4F5D6E,0xFF6A7C8C,0xFF6A7D8B,
+   0xFF677C88,0xFF60767F,0xFF50656D,0xFF43575F,0xFF42575F,0xFF536972,0xFF667D87,
+   0xFF6C818D,0xFF6A7F8C,0xFF677987,0xFF637483,0xFF627182,0xFF627082,0xFF627082,
+   0xFF617081,0xFF5E6F7D,0xFF5B6F7A,0xFF597177,0xFF577374,0xFF577373,0xFF567273,
+   0xFF557271,0xFF547271,0xFF547271,0xFF557171,0xFF557172,0xFF557172,0xFF577175,
+   0xFF5F787E,0xFF596F79,0xFF3F525D,0xFF2A3743,0xFF212D3A,0xFF384C5A,0xFF4E6573,
+   0xFF566E7B,0xFF576E7C,0xFF576E7C,0xFF576D7C,0xFF576E7C,0xFF566F7A,0xFF556F79,
+   0xFF55707A,0xFF557079,0xFF556F79,0xFF556F7A,0xFF557079,0xFF56717A,0xFF56707B,
+   0xFF576F7C,0xFF576F7D,0xFF576F7D,0xFF58707E,0xFF59737F,0xFF5A747E,0xFF59747E,
+   0xFF506B75,0xFF3F5862,0xFF314651,0xFF344753,0xFF435662,0xFF526571,0xFF596B79,
+   0xFF586979,0xFF546474,0xFF4F5E6E,0xFF404F5F,0xFF313F4D,0xFF2A3844,0xFF394A56,
+   0xFF51626F,0xFF5B6C7A,0xFF5E6F7D,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7E,
+   0xFF5E707E,0xFF5E707D,0xFF5E707D,0xFF607380,0xFF637784,0xFF657885,0xFF657985,
+   0xFF657985,0xFF657985,0xFF657985,0xFF677B88,0xFF6A7E8B,0xFF6A7E8B,0xFF627583,
+   0xFF506170,0xFF4D5D6D,0xFF667888,0xFF708292,0xFF768999,0xFF505F6E,0xFF4F5E6E,
+   0xFF6A7B8C,0xFF6B7C8D,0xFF697B8B,0xFF627383,0xFF536371,0xFF455562,0xFF455563,
+   0xFF566776,0xFF677B89,0xFF6D808F,0xFF6B7E8C,0xFF667A86,0xFF627582,0xFF617380,
+   0xFF60727F,0xFF60727F,0xFF5F717E,0xFF5D6F7D,0xFF5C6F7B,0xFF5C6F7A,0xFF5C6F7B,
+   0xFF5C6E7B,0xFF5B6D7A,0xFF5A6D79,0xFF596D78,0xFF596E78,0xFF596D78,0xFF596E77,
+   0xFF586E76,0xFF597078,0xFF607780,0xFF596F78,0xFF3E535C,0xFF283841,0xFF202D37,
+   0xFF384B58,0xFF4E6673,0xFF556F7A,0xFF566F7A,0xFF556F7A,0xFF556F79,0xFF556F79,
+   0xFF547078,0xFF547079,0xFF55707A,0xFF557079,0xFF556F79,0xFF556F79,0xFF557079,
+   0xFF56707B,0xFF576F7C,0xFF576F7C,0xFF56707B,0xFF57707B,0xFF58707D,0xFF597380,
+   0xFF5A7581,0xFF597381,0xFF516976,0xFF3F5360,0xFF30404C,0xFF33424C,0xFF42505C,
+   0xFF505E6B,0xFF566471,0xFF566370,0xFF525E6C,0xFF4D5867,0xFF3E4A59,0xFF303B49,
+   0xFF2A3543,0xFF3B4858,0xFF536172,0xFF5D6B7C,0xFF5F6D7F,0xFF606E80,0xFF606F80,
+   0xFF606F80,0xFF606E80,0xFF606E7F,0xFF5F6F7F,0xFF5F707E,0xFF60737F,0xFF637783,
+   0xFF657886,0xFF657886,0xFF657985,0xFF657985,0xFF667887,0xFF687A8A,0xFF6C7D8E,
+   0xFF6C7C8E,0xFF637385,0xFF556376,0xFF59687A,0xFF708193,0xFF6F7F92,0xFF738496,
+   0xFF576577,0xFF2E3848,0xFF455363,0xFF475764,0xFF3D4D59,0xFF34454F,0xFF3E515A,
+   0xFF556A74,0xFF667E86,0xFF6A818B,0xFF677D88,0xFF657A86,0xFF647785,0xFF637483,
+   0xFF627182,0xFF627082,0xFF627082,0xFF627082,0xFF617080,0xFF5E707D,0xFF5A7178,
+   0xFF587275,0xFF577374,0xFF577374,0xFF567273,0xFF557271,0xFF557271,0xFF547271,
+   0xFF557271,0xFF557172,0xFF557172,0xFF557072,0xFF566F73,0xFF5E747D,0xFF5E737F,
+   0xFF475965,0xFF2D3C48,0xFF273544,0xFF3A4D5D,0xFF475D6C,0xFF506575,0xFF536978,
+   0xFF556C7A,0xFF566E7B,0xFF556E7A,0xFF556F7A,0xFF556F79,0xFF546F78,0xFF546E78,
+   0xFF546E79,0xFF546E79,0xFF556F7A,0xFF556F79,0xFF556F79,0xFF566E7A,0xFF556C79,
+   0xFF556B77,0xFF536974,0xFF4C626B,0xFF3D535B,0xFF324850,0xFF3D535C,0xFF4D646D,
+   0xFF596F79,0xFF617781,0xFF617581,0xFF617481,0xFF627482,0xFF637483,0xFF657685,
+   0xFF657685,0xFF5E707E,0xFF51626F,0xFF364552,0xFF2D3B47,0xFF3C4C59,0xFF4D5F6C,
+   0xFF556774,0xFF596A79,0xFF5C6C7B,0xFF5E6E7D,0xFF5E6F7E,0xFF5E707E,0xFF5F717E,
+   0xFF627581,0xFF657984,0xFF657A85,0xFF667A85,0xFF657985,0xFF647884,0xFF637782,
+   0xFF607480,0xFF586B78,0xFF485A67,0xFF364552,0xFF2B3845,0xFF536372,0xFF708293,
+   0xFF6E8091,0xFF728495,0xFF566676,0xFF2D3948,0xFF455363,0xFF485666,0xFF3F4B5C,
+   0xFF364352,0xFF404F5E,0xFF576878,0xFF687B8B,0xFF6C7F8E,0xFF697C8A,0xFF667987,
+   0xFF647785,0xFF627582,0xFF607380,0xFF60727F,0xFF60727F,0xFF60727F,0xFF60717F,
+   0xFF5E6F7D,0xFF5C6F7B,0xFF5C6F7B,0xFF5C6F7B,0xFF5C6E7B,0xFF5B6D7A,0xFF5A6D7A,
+   0xFF5A6D79,0xFF5A6D79,0xFF5A6D78,0xFF5A6D78,0xFF596E78,0xFF586E77,0xFF586D77,
+   0xFF5F747E,0xFF5E737E,0xFF465A64,0xFF2C3C46,0xFF273540,0xFF394E5B,0xFF465E6A,
+   0xFF4E6772,0xFF516B76,0xFF536E78,0xFF547078,0xFF547078,0xFF547078,0xFF547078,
+   0xFF546F78,0xFF546F78,0xFF546E78,0xFF546F78,0xFF566F7A,0xFF566E7B,0xFF566E7B,
+   0xFF556E7A,0xFF546D79,0xFF546C78,0xFF526C78,0xFF4C6571,0xFF3E5360,0xFF32444E,
+   0xFF3C4D56,0xFF4C5C66,0xFF586872,0xFF5F7079,0xFF5F6E79,0xFF5F6D79,0xFF5F6D79,
+   0xFF606D7A,0xFF636E7C,0xFF636F7C,0xFF5C6976,0xFF505B69,0xFF364150,0xFF2E3949,
+   0xFF3E4B5C,0xFF4F5D6F,0xFF576577,0xFF5B697A,0xFF5D6B7D,0xFF5F6D7F,0xFF5F6E7F,
+   0xFF606F7F,0xFF607080,0xFF627482,0xFF657885,0xFF667986,0xFF667A86,0xFF657985,
+   0xFF657885,0xFF647584,0xFF617382,0xFF596A7A,0xFF4A586A,0xFF384455,0xFF2C3646,
+   0xFF414E60,0xFF505F71,0xFF576678,0xFF536173,0xFF384455,0xFF1C2431,0xFF1D2532,
+   0xFF2C3946,0xFF3E4F5B,0xFF5A6E79,0xFF69808A,0xFF6A818B,0xFF667D86,0xFF657C85,
+   0xFF657B86,0xFF657A86,0xFF647885,0xFF647684,0xFF627383,0xFF617181,0xFF617181,
+   0xFF617181,0xFF617180,0xFF5E717D,0xFF5A7278,0xFF587375,0xFF577374,0xFF577374,
+   0xFF567372,0xFF557271,0xFF557272,0xFF557271,0xFF557271,0xFF557271,0xFF557172,
+   0xFF557172,0xFF557072,0xFF566F74,0xFF5C727A,0xFF617681,0xFF4C5F6B,0xFF283642,
+   0xFF202D3B,0xFF2B3B4B,0xFF314254,0xFF344758,0xFF374C5A,0xFF3A515D,0xFF3D5560,
+   0xFF3F5862,0xFF405963,0xFF3E5861,0xFF3D555F,0xFF3C545F,0xFF3D5560,0xFF3F5761,
+   0xFF3F555E,0xFF3F555E,0xFF3E535E,0xFF3C505C,0xFF384B56,0xFF2F3F49,0xFF273740,
+   0xFF2C3E47,0xFF425860,0xFF5A7179,0xFF5D747C,0xFF5D737C,0xFF5D717C,0xFF5D707C,
+   0xFF5D707C,0xFF5D6E7C,0xFF5C6D7C,0xFF5C6C7B,0xFF5D6E7C,0xFF5F717E,0xFF647784,
+   0xFF617481,0xFF445561,0xFF283641,0xFF232F3B,0xFF2C3A46,0xFF354451,0xFF3B4958,
+   0xFF3D4B5A,0xFF3E4D5B,0xFF41515E,0xFF445561,0xFF475965,0xFF485A66,0xFF495C67,
+   0xFF4A5D68,0xFF485A66,0xFF435561,0xFF3F515D,0xFF3A4B58,0xFF364653,0xFF2F3D49,
+   0xFF27333F,0xFF2E3B48,0xFF3F4F5E,0xFF506070,0xFF566677,0xFF526172,0xFF384454,
+   0xFF1C2431,0xFF1D2532,0xFF2C3847,0xFF404E5E,0xFF5C6C7C,0xFF6B7D8E,0xFF6C7F8E,
+   0xFF687B8A,0xFF677A88,0xFF677A88,0xFF667987,0xFF647885,0xFF637784,0xFF617481,
+   0xFF60727F,0xFF60727F,0xFF607280,0xFF60717F,0xFF5F717E,0xFF5D707D,0xFF5C6F7B,
+   0xFF5C6F7B,0xFF5C6F7B,0xFF5B6D7A,0xFF5B6C7A,0xFF5B6C7A,0xFF5A6D7A,0xFF5A6D79,
+   0xFF5A6D79,0xFF5A6D79,0xFF596D78,0xFF596D78,0xFF586D77,0xFF5D717C,0xFF617681,
+   0xFF4C5F6A,0xFF283640,0xFF1F2C36,0xFF293B45,0xFF2D424C,0xFF314850,0xFF354C55,
+   0xFF385159,0xFF3C565D,0xFF3E5960,0xFF3F5A62,0xFF3E5860,0xFF3C565F,0xFF3C545F,
+   0xFF3D5461,0xFF405663,0xFF405564,0xFF3F5663,0xFF3E5461,0xFF3B525E,0xFF374D58,
+   0xFF2D414C,0xFF273742,0xFF2B3B45,0xFF41525B,0xFF586A72,0xFF5C6C75,0xFF5B6A75,
+   0xFF5A6A74,0xFF5A6A74,0xFF5A6974,0xFF5A6874,0xFF5A6774,0xFF596673,0xFF5B6774,
+   0xFF5E6A77,0xFF636E7D,0xFF606C7B,0xFF455061,0xFF2A3444,0xFF252E3D,0xFF2E3848,
+   0xFF374253,0xFF3C4859,0xFF3E4A5B,0xFF3F4C5C,0xFF434F60,0xFF455463,0xFF485867,
+   0xFF495A67,0xFF4A5C68,0xFF4A5C68,0xFF485A66,0xFF445563,0xFF40505E,0xFF3B4A59,
+   0xFF374555,0xFF303B4C,0xFF283241,0xFF2D3848,0xFF59677A,0xFF526073,0xFF4A5769,
+   0xFF3E4A5C,0xFF374253,0xFF2E3948,0xFF252F3C,0xFF354352,0xFF546674,0xFF667B87,
+   0xFF647A85,0xFF647A84,0xFF647B84,0xFF647A84,0xFF647A84,0xFF647884,0xFF637783,
+   0xFF627582,0xFF617381,0xFF60727F,0xFF5F717E,0xFF5F707E,0xFF5E717D,0xFF5D727B,
+   0xFF5A7278,0xFF587275,0xFF577274,0xFF577274,0xFF567272,0xFF557272,0xFF557272,
+   0xFF557272,0xFF557372,0xFF557372,0xFF557271,0xFF557272,0xFF567273,0xFF577275,
+   0xFF5A7278,0xFF617880,0xFF556A75,0xFF30404F,0xFF334254,0xFF47596C,0xFF526578,
+   0xFF55687A,0xFF516475,0xFF455968,0xFF2E414E,0xFF1F2E38,0xFF1E2D35,0xFF23343D,
+   0xFF2D414B,0xFF364C56,0xFF3B525D,0xFF3E5760,0xFF405962,0xFF405A62,0xFF3A535C,
+   0xFF2E434D,0xFF1E2B35,0xFF19242D,0xFF2C3D46,0xFF4C606A,0xFF5D737D,0xFF5D727D,
+   0xFF5D727C,0xFF5D727D,0xFF5D717D,0xFF5D717D,0xFF5D717D,0xFF5D707D,0xFF5D6F7C,
+   0xFF5C6E7B,0xFF5B6D7A,0xFF5A6D79,0xFF5A6D79,0xFF5C6E7B,0xFF60747F,0xFF475965,
+   0xFF222E39,0xFF17202B,0xFF19232E,0xFF1F2935,0xFF25313D,0xFF283441,0xFF2C3946,
+   0xFF364551,0xFF3E4E5A,0xFF41525E,0xFF435460,0xFF435560,0xFF475A65,0xFF4B5D68,
+   0xFF4E606C,0xFF51626F,0xFF536572,0xFF566875,0xFF5A6C7A,0xFF5D6E7E,0xFF586979,
+   0xFF516171,0xFF495768,0xFF3E4A5B,0xFF364253,0xFF2E3948,0xFF252F3C,0xFF364353,
+   0xFF556676,0xFF687A8A,0xFF677888,0xFF667887,0xFF667988,0xFF667887,0xFF657886,
+   0xFF647785,0xFF637684,0xFF627583,0xFF617381,0xFF60727F,0xFF60717F,0xFF5F707F,
+   0xFF5F707F,0xFF5F707E,0xFF5E6F7D,0xFF5C6E7C,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6D7B,
+   0xFF5B6C7B,0xFF5B6C7B,0xFF5B6D7A,0xFF5B6D7A,0xFF5B6E7A,0xFF5B6D7A,0xFF5A6D7A,
+   0xFF5A6E7A,0xFF5B6F7A,0xFF5C707B,0xFF627682,0xFF566975,0xFF2F3E49,0xFF30404B,
+   0xFF455A62,0xFF50676E,0xFF536B70,0xFF4F666C,0xFF43595E,0xFF2C4045,0xFF1D2E34,
+   0xFF1D2E34,0xFF22343B,0xFF2D4048,0xFF374A54,0xFF3D4F5D,0xFF415362,0xFF435664,
+   0xFF435663,0xFF3C4F5C,0xFF2F414B,0xFF1D2B34,0xFF18242C,0xFF2B3B43,0xFF495B63,
+   0xFF5B6C74,0xFF5B6B75,0xFF5B6A75,0xFF5B6A75,0xFF5B6A75,0xFF5B6A75,0xFF5C6A75,
+   0xFF5B6976,0xFF5A6875,0xFF5A6774,0xFF596673,0xFF586573,0xFF596574,0xFF5A6675,
+   0xFF5F6C7B,0xFF475363,0xFF232C3A,0xFF181F2C,0xFF1A222F,0xFF202837,0xFF26303F,
+   0xFF293342,0xFF2D3947,0xFF364452,0xFF3F4E5B,0xFF41525E,0xFF435560,0xFF435560,
+   0xFF475A65,0xFF4B5C69,0xFF4E606D,0xFF516270,0xFF546473,0xFF576677,0xFF5B6A7C,
+   0xFF5F6D80,0xFF6B7B8D,0xFF6D7C8F,0xFF6F7F92,0xFF6D7D90,0xFF677689,0xFF59677A,
+   0xFF3F4D5D,0xFF2E3B4A,0xFF445464,0xFF607380,0xFF617682,0xFF617781,0xFF617781,
+   0xFF627782,0xFF627682,0xFF627682,0xFF617581,0xFF617481,0xFF607480,0xFF5F727E,
+   0xFF5D717C,0xFF5C707B,0xFF5B7079,0xFF5A7178,0xFF597177,0xFF587275,0xFF577274,
+   0xFF577274,0xFF567373,0xFF567372,0xFF567473,0xFF577574,0xFF577574,0xFF577574,
+   0xFF567573,0xFF577574,0xFF587576,0xFF5B777A,0xFF5E787E,0xFF5F777E,0xFF3E535D,
+   0xFF3D5160,0xFF5D7183,0xFF677B8E,0xFF65798B,0xFF64798A,0xFF667C8C,0xFF6A8290,
+   0xFF5E7683,0xFF2D3E4A,0xFF1F2D36,0xFF3B525C,0xFF4E6773,0xFF556D7A,0xFF566E7B,
+   0xFF566F7B,0xFF57737B,0xFF5B7880,0xFF607E86,0xFF5A7680,0xFF354955,0xFF1E2B35,
+   0xFF3C5059,0xFF5D737D,0xFF5D727D,0xFF5D727D,0xFF5D717D,0xFF5D717D,0xFF5D717D,
+   0xFF5D717C,0xFF5C707C,0xFF5C6F7C,0xFF5B6E7B,0xFF5B6E7A,0xFF5A6D79,0xFF5A6D79,
+   0xFF5A6D79,0xFF5A6C79,0xFF5F727E,0xFF4D606C,0xFF283540,0xFF19222C,0xFF26333E,
+   0xFF374654,0xFF425260,0xFF4C5D6B,0xFF596B79,0xFF5F727E,0xFF60737E,0xFF60737E,
+   0xFF5F737D,0xFF5E727C,0xFF5D717B,0xFF5D707B,0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7C,
+   0xFF5E707D,0xFF627482,0xFF677888,0xFF6A7B8B,0xFF6C7D8E,0xFF6F7F91,0xFF6D7D8F,
+   0xFF677688,0xFF586879,0xFF3E4D5D,0xFF2E3B4A,0xFF455464,0xFF617182,0xFF647484,
+   0xFF637584,0xFF637685,0xFF637684,0xFF637584,0xFF637583,0xFF627483,0xFF627482,
+   0xFF617381,0xFF607180,0xFF5F707F,0xFF5E6E7E,0xFF5E6E7D,0xFF5D6E7D,0xFF5D6E7C,
+   0xFF5D6D7C,0xFF5D6D7C,0xFF5C6D7C,0xFF5C6D7C,0xFF5C6D7C,0xFF5D6E7C,0xFF5D6F7D,
+   0xFF5D6F7D,0xFF5D6F7D,0xFF5C707C,0xFF5C6F7C,0xFF5D717D,0xFF5F7380,0xFF617581,
+   0xFF627582,0xFF3F505D,0xFF3D4E5A,0xFF5D737D,0xFF677F86,0xFF647E83,0xFF637D81,
+   0xFF658084,0xFF6B868A,0xFF5E797D,0xFF2B3E43,0xFF1E2D33,0xFF3B5056,0xFF4F646D,
+   0xFF566A74,0xFF586A76,0xFF586A76,0xFF5A6D78,0xFF5E717D,0xFF647883,0xFF5B717B,
+   0xFF354750,0xFF1D2A32,0xFF394C53,0xFF5A6D73,0xFF5A6C73,0xFF5B6A74,0xFF5C6A75,
+   0xFF5C6A76,0xFF5C6A76,0xFF5B6976,0xFF5B6975,0xFF5A6875,0xFF5A6774,0xFF596674,
+   0xFF596673,0xFF596573,0xFF596573,0xFF596574,0xFF5E6A78,0xFF4D5968,0xFF293140,
+   0xFF1A212E,0xFF273240,0xFF384655,0xFF425161,0xFF4C5D6C,0xFF596B79,0xFF5F727F,
+   0xFF60737F,0xFF5F737E,0xFF5F737D,0xFF5D727C,0xFF5D717B,0xFF5D707C,0xFF5D6F7B,
+   0xFF5E6E7C,0xFF5E6E7D,0xFF606E7F,0xFF647285,0xFF68778A,0xFF657487,0xFF657487,
+   0xFF657487,0xFF677689,0xFF6A7A8D,0xFF708093,0xFF68788A,0xFF3D4B5B,0xFF354352,
+   0xFF516271,0xFF617581,0xFF617580,0xFF617580,0xFF617581,0xFF617581,0xFF617581,
+   0xFF617581,0xFF617481,0xFF5F737F,0xFF5E717D,0xFF5D717D,0xFF5C717B,0xFF5B7079,
+   0xFF5A7077,0xFF597177,0xFF587275,0xFF577274,0xFF577274,0xFF577374,0xFF587575,
+   0xFF5A7777,0xFF5A7878,0xFF5A7878,0xFF5A7978,0xFF5A7977,0xFF5A7977,0xFF5B7979,
+   0xFF5D787C,0xFF617A80,0xFF536A71,0xFF354A55,0xFF566D7B,0xFF64798A,0xFF627687,
+   0xFF617586,0xFF607685,0xFF5F7684,0xFF607784,0xFF68808D,0xFF485E6C,0xFF344954,
+   0xFF536D78,0xFF566F7B,0xFF566E7B,0xFF566E7C,0xFF566E7B,0xFF566F7A,0xFF57727C,
+   0xFF5B7781,0xFF65808C,0xFF5B7381,0xFF2C3D49,0xFF425660,0xFF5F747E,0xFF5D727C,
+   0xFF5D727D,0xFF5D717D,0xFF5D727D,0xFF5D717D,0xFF5C707C,0xFF5B6E7A,0xFF5A6D79,
+   0xFF5A6D78,0xFF596E78,0xFF596E78,0xFF5A6D78,0xFF5A6D79,0xFF5B6C7A,0xFF5D707D,
+   0xFF465864,0xFF24303B,0xFF25313D,0xFF435562,0xFF586A78,0xFF5D6F7E,0xFF5D707D,
+   0xFF5D6F7C,0xFF5C6E7A,0xFF5B6D78,0xFF5A6D78,0xFF5A6D78,0xFF5B6D78,0xFF5B6D78,
+   0xFF5A6D78,0xFF5B6D79,0xFF5B6D79,0xFF5B6D79,0xFF5B6D7A,0xFF5E717E,0xFF627483,
+   0xFF647585,0xFF647585,0xFF657586,0xFF677788,0xFF6A7A8C,0xFF708192,0xFF677989,
+   0xFF3D4B5B,0xFF354352,0xFF526272,0xFF637384,0xFF637483,0xFF627483,0xFF627483,
+   0xFF627483,0xFF627483,0xFF627483,0xFF627482,0xFF607281,0xFF5F7080,0xFF5F707F,
+   0xFF5E6F7F,0xFF5D6E7D,0xFF5D6D7C,0xFF5D6D7D,0xFF5D6D7D,0xFF5D6D7D,0xFF5D6D7D,
+   0xFF5D6E7D,0xFF5F707F,0xFF607181,0xFF617281,0xFF607381,0xFF607381,0xFF607381,
+   0xFF5F7380,0xFF607481,0xFF617582,0xFF637884,0xFF556875,0xFF364753,0xFF586D77,
+   0xFF657C84,0xFF617A7F,0xFF60797E,0xFF5F797E,0xFF5F797D,0xFF607A7F,0xFF698488,
+   0xFF475F64,0xFF33474D,0xFF536A71,0xFF576C74,0xFF576B74,0xFF576B75,0xFF586A76,
+   0xFF586A77,0xFF5A6C79,0xFF5D717C,0xFF667C85,0xFF5B717A,0xFF2B3B44,0xFF3F5159,
+   0xFF5B6E75,0xFF5A6C73,0xFF5B6B74,0xFF5C6A75,0xFF5C6A76,0xFF5C6A76,0xFF5B6975,
+   0xFF596774,0xFF586673,0xFF586673,0xFF586673,0xFF596573,0xFF596573,0xFF596573,
+   0xFF596573,0xFF5C6976,0xFF465260,0xFF242E3A,0xFF25313D,0xFF435562,0xFF576B77,
+   0xFF5C707C,0xFF5E707D,0xFF5D6F7C,0xFF5C6E7A,0xFF5B6D79,0xFF5B6D78,0xFF5A6D78,
+   0xFF5A6E77,0xFF5A6D78,0xFF5B6D79,0xFF5B6D79,0xFF5C6C7A,0xFF5C6C7B,0xFF5D6B7C,
+   0xFF606F81,0xFF647285,0xFF657487,0xFF657487,0xFF657487,0xFF657487,0xFF657487,
+   0xFF657487,0xFF6F7F91,0xFF5A697A,0xFF33404F,0xFF3B4A59,0xFF536572,0xFF607480,
+   0xFF617582,0xFF617482,0xFF627482,0xFF617581,0xFF617481,0xFF607380,0xFF5F717F,
+   0xFF5E717E,0xFF5E717D,0xFF5D727D,0xFF5C717B,0xFF5B7179,0xFF597177,0xFF587175,
+   0xFF587275,0xFF587275,0xFF597576,0xFF5A7778,0xFF5B7779,0xFF5B7779,0xFF5B7879,
+   0xFF5B7979,0xFF5B7A79,0xFF5C7A7A,0xFF5D797B,0xFF5D787C,0xFF617B81,0xFF435960,
+   0xFF455B67,0xFF617886,0xFF617786,0xFF617686,0xFF617586,0xFF607685,0xFF607685,
+   0xFF607685,0xFF647989,0xFF526878,0xFF415965,0xFF56707B,0xFF566E7B,0xFF576D7C,
+   0xFF576D7C,0xFF576D7C,0xFF576E7C,0xFF58717E,0xFF5A7480,0xFF5C7683,0xFF667F8E,
+   0xFF435866,0xFF415560,0xFF5D737D,0xFF5D727C,0xFF5D727C,0xFF5D727D,0xFF5D727C,
+   0xFF5D717C,0xFF5C707B,0xFF5B6F7A,0xFF596E78,0xFF596E77,0xFF596E77,0xFF596E78,
+   0xFF5A6D78,0xFF5A6D79,0xFF5B6D7A,0xFF5A6E7A,0xFF3C4D59,0xFF1F2A35,0xFF303F4B,
+   0xFF526572,0xFF5C6F7C,0xFF5A6C79,0xFF5A6C78,0xFF5B6D79,0xFF5B6D79,0xFF5B6E79,
+   0xFF5B6E79,0xFF5C6E7A,0xFF5C6E7A,0xFF5B6D79,0xFF5A6D78,0xFF5B6D79,0xFF5B6D79,
+   0xFF5B6D79,0xFF5B6D79,0xFF5D707C,0xFF617382,0xFF647585,0xFF647586,0xFF647586,
+   0xFF647586,0xFF647486,0xFF647586,0xFF6E8090,0xFF596A7A,0xFF33404F,0xFF3B4959,
+   0xFF556474,0xFF627282,0xFF637484,0xFF627483,0xFF627483,0xFF627483,0xFF627483,
+   0xFF617282,0xFF5F7180,0xFF5F7080,0xFF5F7080,0xFF5F7080,0xFF5E6F7F,0xFF5E6E7E,
+   0xFF5D6D7D,0xFF5D6D7D,0xFF5D6D7D,0xFF5D6E7C,0xFF5E707E,0xFF607180,0xFF617282,
+   0xFF617282,0xFF617282,0xFF617382,0xFF617582,0xFF617582,0xFF617582,0xFF617582,
+   0xFF647885,0xFF455763,0xFF475A65,0xFF637A82,0xFF61797F,0xFF607A7F,0xFF5F797E,
+   0xFF60797E,0xFF60797E,0xFF5F797E,0xFF637D82,0xFF51696E,0xFF3F575C,0xFF556E72,
+   0xFF556C72,0xFF566C73,0xFF576B74,0xFF586A76,0xFF596A77,0xFF5A6C79,0xFF5C6F7A,
+   0xFF5D727C,0xFF667C86,0xFF42555E,0xFF3F5058,0xFF5B6D74,0xFF5A6B73,0xFF5B6B74,
+   0xFF5B6B74,0xFF5C6A76,0xFF5C6976,0xFF5B6875,0xFF596774,0xFF586673,0xFF586673,
+   0xFF586673,0xFF596574,0xFF596574,0xFF586673,0xFF596773,0xFF596773,0xFF3B4855,
+   0xFF1F2934,0xFF2F3F4A,0xFF516671,0xFF5B707B,0xFF596D77,0xFF5A6C78,0xFF5B6D79,
+   0xFF5B6D79,0xFF5B6E79,0xFF5B6E79,0xFF5B6E79,0xFF5B6E79,0xFF5B6D79,0xFF5B6D79,
+   0xFF5B6D7A,0xFF5C6C7B,0xFF5C6C7B,0xFF5D6B7C,0xFF5F6E7F,0xFF637184,0xFF657487,
+   0xFF657487,0xFF657487,0xFF657487,0xFF657487,0xFF657487,0xFF687789,0xFF69798A,
+   0xFF3D4C5C,0xFF2B3746,0xFF364552,0xFF465864,0xFF596C79,0xFF627483,0xFF627483,
+   0xFF627483,0xFF617382,0xFF607180,0xFF5F707F,0xFF5E717E,0xFF5E717E,0xFF5E717D,
+   0xFF5D717D,0xFF5C727B,0xFF5A7278,0xFF587176,0xFF587176,0xFF597377,0xFF5B7679,
+   0xFF5C777A,0xFF5D767B,0xFF5D767B,0xFF5C767A,0xFF5B7779,0xFF5B7879,0xFF5C797A,
+   0xFF5D797C,0xFF5E787E,0xFF617A80,0xFF3D525A,0xFF576E7A,0xFF617886,0xFF617786,
+   0xFF617686,0xFF607686,0xFF607685,0xFF617586,0xFF617586,0xFF627788,0xFF4D6274,
+   0xFF465D6C,0xFF576F7C,0xFF566E7C,0xFF576D7C,0xFF576D7D,0xFF576D7C,0xFF566E7B,
+   0xFF57707D,0xFF597480,0xFF5B7582,0xFF627B8A,0xFF576E7E,0xFF3D515E,0xFF5A6F79,
+   0xFF5C727B,0xFF5D727C,0xFF5D727C,0xFF5C727C,0xFF5C717B,0xFF5B707B,0xFF5B707A,
+   0xFF596F79,0xFF596E78,0xFF596E77,0xFF596E77,0xFF596E78,0xFF5A6D79,0xFF5C6F7B,
+   0xFF50636F,0xFF31414C,0xFF1A242F,0xFF2E3D49,0xFF4B5E6A,0xFF596C78,0xFF596C78,
+   0xFF5A6C78,0xFF5B6D79,0xFF5C6E7A,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7B,
+   0xFF5B6E79,0xFF5B6D78,0xFF5B6D78,0xFF5B6D79,0xFF5B6D79,0xFF5B6D79,0xFF5C6E7B,
+   0xFF617281,0xFF647585,0xFF647585,0xFF647586,0xFF657486,0xFF647586,0xFF647586,
+   0xFF677889,0xFF687A8A,0xFF3D4B5C,0xFF2C3746,0xFF374354,0xFF485667,0xFF5A6B7B,
+   0xFF627483,0xFF627483,0xFF627483,0xFF617382,0xFF607181,0xFF5F7080,0xFF5F7080,
+   0xFF5F7080,0xFF5F7080,0xFF5F7080,0xFF5F6F7F,0xFF5E6E7E,0xFF5D6D7D,0xFF5D6D7C,
+   0xFF5E6F7E,0xFF607180,0xFF617281,0xFF617281,0xFF617281,0xFF607381,0xFF617281,
+   0xFF607381,0xFF607581,0xFF607581,0xFF607681,0xFF627883,0xFF3F515C,0xFF5A6D78,
+   0xFF637A82,0xFF617A7F,0xFF607A7E,0xFF5F7A7D,0xFF5F7A7D,0xFF5F7A7D,0xFF5F7A7D,
+   0xFF617B7F,0xFF4A6467,0xFF445D60,0xFF556E71,0xFF556D71,0xFF556D72,0xFF566C73,
+   0xFF576B75,0xFF586A76,0xFF596B78,0xFF5B6E7A,0xFF5C707B,0xFF627781,0xFF576B75,
+   0xFF3C4C55,0xFF576971,0xFF5A6B74,0xFF5B6B74,0xFF5B6A75,0xFF5B6A76,0xFF5B6876,
+   0xFF5B6775,0xFF5A6875,0xFF596774,0xFF586673,0xFF586673,0xFF596573,0xFF596574,
+   0xFF586673,0xFF596973,0xFF4E5D68,0xFF303D49,0xFF1A242F,0xFF2E3D49,0xFF4B5F6A,
+   0xFF586D77,0xFF596C77,0xFF5A6C79,0xFF5B6D7A,0xFF5C6E7A,0xFF5C6E7B,0xFF5C6E7B,
+   0xFF5C6E7A,0xFF5B6E7A,0xFF5B6E79,0xFF5B6D79,0xFF5C6C7A,0xFF5C6C7B,0xFF5C6C7B,
+   0xFF5D6B7C,0xFF5E6D7E,0xFF627082,0xFF647386,0xFF657487,0xFF657486,0xFF657486,
+   0xFF657487,0xFF657486,0xFF647384,0xFF687A89,0xFF465565,0xFF2B3746,0xFF344251,
+   0xFF354452,0xFF3A4857,0xFF516171,0xFF627383,0xFF637484,0xFF617281,0xFF5F717F,
+   0xFF5F707F,0xFF5E717E,0xFF5E717E,0xFF5E717E,0xFF5E717E,0xFF5D727C,0xFF5B7379,
+   0xFF5A7278,0xFF5A7278,0xFF5C747A,0xFF5D757C,0xFF5D757C,0xFF5E757D,0xFF5E757D,
+   0xFF5D757C,0xFF5D767C,0xFF5D767B,0xFF5C777B,0xFF5D777C,0xFF5F797E,0xFF5E767E,
+   0xFF3F545D,0xFF5D7581,0xFF617886,0xFF617687,0xFF617686,0xFF607685,0xFF607686,
+   0xFF617587,0xFF617586,0xFF617687,0xFF485C6E,0xFF465D6B,0xFF576F7C,0xFF576D7C,
+   0xFF566E7C,0xFF576D7C,0xFF566E7B,0xFF566E7A,0xFF576F7C,0xFF59737F,0xFF5B7482,
+   0xFF5E7686,0xFF5E7585,0xFF3B4E5C,0xFF536872,0xFF5C727A,0xFF5C727A,0xFF5C717B,
+   0xFF5B717B,0xFF5B707A,0xFF5B707A,0xFF5A707A,0xFF5A7079,0xFF5A6F79,0xFF596E78,
+   0xFF596E77,0xFF596E77,0xFF5A6E79,0xFF576A77,0xFF3E505C,0xFF23303B,0xFF17202A,
+   0xFF25333D,0xFF40525E,0xFF576A76,0xFF596C78,0xFF5A6D78,0xFF5B6E79,0xFF5C6E7A,
+   0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7A,0xFF5B6D79,0xFF5B6D78,0xFF5B6D79,
+   0xFF5B6D79,0xFF5B6D79,0xFF5B6D79,0xFF5C6E7A,0xFF5F717F,0xFF637484,0xFF647585,
+   0xFF647485,0xFF657486,0xFF647486,0xFF647586,0xFF637484,0xFF687A89,0xFF465465,
+   0xFF2C3747,0xFF354152,0xFF364253,0xFF3A4858,0xFF516171,0xFF627483,0xFF627483,
+   0xFF617282,0xFF5F7080,0xFF5F7080,0xFF5F7080,0xFF606F80,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF5F6F80,0xFF5E6E7F,0xFF5E6F7E,0xFF607080,0xFF617281,0xFF617281,
+   0xFF617281,0xFF607380,0xFF607380,0xFF607380,0xFF60737F,0xFF5F747F,0xFF5F7580,
+   0xFF607880,0xFF5F767F,0xFF40545D,0xFF5F767E,0xFF627A80,0xFF607A7E,0xFF5F7A7D,
+   0xFF5F7A7D,0xFF5F7A7D,0xFF5F797D,0xFF5F7A7D,0xFF5F7B7D,0xFF445E60,0xFF435D5F,
+   0xFF556E71,0xFF556D71,0xFF556D71,0xFF556D72,0xFF566C73,0xFF576A75,0xFF596B77,
+   0xFF5B6E79,0xFF5C707A,0xFF5E737D,0xFF5E727D,0xFF3A4A54,0xFF51626A,0xFF5A6B73,
+   0xFF5A6A74,0xFF5B6975,0xFF5A6975,0xFF5A6875,0xFF5A6874,0xFF5A6874,0xFF5A6875,
+   0xFF596774,0xFF586673,0xFF586673,0xFF586673,0xFF586772,0xFF54656E,0xFF3C4C57,
+   0xFF232F3A,0xFF17202A,0xFF25333E,0xFF40535E,0xFF566A75,0xFF596C78,0xFF5B6C79,
+   0xFF5C6E7A,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7A,0xFF5B6F79,0xFF5A6E78,
+   0xFF5B6D78,0xFF5B6D7A,0xFF5C6C7B,0xFF5C6C7B,0xFF5D6B7C,0xFF5E6C7D,0xFF616F81,
+   0xFF617081,0xFF617082,0xFF627182,0xFF637285,0xFF637285,0xFF637283,0xFF607181,
+   0xFF657786,0xFF485667,0xFF435060,0xFF647585,0xFF687989,0xFF5B6B7B,0xFF404D5E,
+   0xFF465464,0xFF5B6C7B,0xFF607281,0xFF5F7180,0xFF5F717F,0xFF5E717F,0xFF5E717E,
+   0xFF5E717E,0xFF5E717E,0xFF5E717D,0xFF5C737B,0xFF5C737B,0xFF5D737C,0xFF5E747E,
+   0xFF5F747F,0xFF5F747E,0xFF5E747E,0xFF5E747E,0xFF5E757E,0xFF5F747E,0xFF5E757C,
+   0xFF5D767C,0xFF5D767C,0xFF60797F,0xFF536A72,0xFF3E535E,0xFF5F7684,0xFF617785,
+   0xFF617687,0xFF617586,0xFF617586,0xFF617586,0xFF617587,0xFF617587,0xFF617687,
+   0xFF45586B,0xFF465C6B,0xFF576F7C,0xFF566E7B,0xFF566E7B,0xFF566E7B,0xFF566E7B,
+   0xFF566E7B,0xFF566F7B,0xFF58727D,0xFF5A7481,0xFF5C7583,0xFF627C89,0xFF3E5360,
+   0xFF495E68,0xFF5C727A,0xFF5B7279,0xFF5B7179,0xFF5A7179,0xFF5A707A,0xFF5B707A,
+   0xFF5A7179,0xFF5A7179,0xFF5A7079,0xFF5A6F78,0xFF596E78,0xFF596E78,0xFF5B707A,
+   0xFF4B5E6A,0xFF2D3C48,0xFF19232D,0xFF1A252E,0xFF212E38,0xFF33444F,0xFF4B5E6A,
+   0xFF5A6C78,0xFF5A6D79,0xFF5C6E7A,0xFF5C6E7A,0xFF5C6E7B,0xFF5C6E7A,0xFF5C6E7A,
+   0xFF5B6D79,0xFF5B6D79,0xFF5B6D78,0xFF5B6D78,0xFF5B6D79,0xFF5B6D7A,0xFF5B6D79,
+   0xFF5C6D7A,0xFF5E6E7D,0xFF607180,0xFF607180,0xFF617182,0xFF637284,0xFF637284,
+   0xFF637283,0xFF617081,0xFF667686,0xFF485667,0xFF435061,0xFF657586,0xFF68798A,
+   0xFF5B6B7B,0xFF3F4E5D,0xFF455564,0xFF5B6C7B,0xFF607281,0xFF607181,0xFF607080,
+   0xFF5F7080,0xFF606F80,0xFF5F7080,0xFF606F80,0xFF606F81,0xFF606F81,0xFF606F81,
+   0xFF607081,0xFF617281,0xFF617281,0xFF617281,0xFF607380,0xFF607380,0xFF607380,
+   0xFF5F747F,0xFF5F747F,0xFF5F747F,0xFF5F747F,0xFF617881,0xFF536A72,0xFF3E535B,
+   0xFF60787F,0xFF617A7F,0xFF607A7E,0xFF5F7A7D,0xFF5F7A7D,0xFF5F797D,0xFF5F797D,
+   0xFF5F7A7D,0xFF5F7B7C,0xFF415B5D,0xFF435C5E,0xFF556E71,0xFF556D72,0xFF556D71,
+   0xFF556D72,0xFF556D72,0xFF576B74,0xFF586B76,0xFF5A6D78,0xFF5B6F7A,0xFF5D717C,
+   0xFF637783,0xFF3F4E5A,0xFF485862,0xFF5A6A73,0xFF5A6A73,0xFF5A6974,0xFF596874,
+   0xFF596874,0xFF596874,0xFF596874,0xFF5A6874,0xFF5A6875,0xFF596774,0xFF586673,
+   0xFF586672,0xFF596973,0xFF485A62,0xFF2D3A45,0xFF1A232D,0xFF1A242E,0xFF222E39,
+   0xFF33444F,0xFF4B5E69,0xFF596D78,0xFF5A6D78,0xFF5B6E7A,0xFF5B6E7A,0xFF5B6F7A,
+   0xFF5B6F79,0xFF5A6E78,0xFF596F77,0xFF596E77,0xFF5A6E77,0xFF5B6D79,0xFF5B6D7A,
+   0xFF5C6C7B,0xFF5D6B7C,0xFF5D6B7C,0xFF5F6D7F,0xFF5F6E80,0xFF606F80,0xFF617081,
+   0xFF627183,0xFF637283,0xFF627282,0xFF607180,0xFF637484,0xFF445263,0xFF526071,
+   0xFF667687,0xFF667687,0xFF6C7D8E,0xFF6A7B8C,0xFF465464,0xFF354251,0xFF475665,
+   0xFF536473,0xFF5A6C7A,0xFF5D707D,0xFF5E717E,0xFF5F727F,0xFF5F727F,0xFF5F727E,
+   0xFF5E727D,0xFF5D727D,0xFF5E737D,0xFF5F747E,0xFF5F747F,0xFF5F747E,0xFF5F747E,
+   0xFF5F747F,0xFF5F747F,0xFF5F747F,0xFF5E757D,0xFF5D757C,0xFF5E767D,0xFF5E747D,
+   0xFF3E525D,0xFF3F5261,0xFF617786,0xFF617786,0xFF617686,0xFF617587,0xFF617587,
+   0xFF617587,0xFF617587,0xFF617587,0xFF617587,0xFF435669,0xFF465B6B,0xFF576F7C,
+   0xFF566E7A,0xFF566E7B,0xFF566E7B,0xFF566E7B,0xFF566E7A,0xFF556F7A,0xFF56717B,
+   0xFF58737E,0xFF597480,0xFF617C88,0xFF4A626D,0xFF3E535D,0xFF596F77,0xFF5B727A,
+   0xFF5A7179,0xFF5A7178,0xFF5A7178,0xFF5A7179,0xFF5A7179,0xFF5A7179,0xFF5A707A,
+   0xFF5A7079,0xFF5A6F78,0xFF5A6F78,0xFF546973,0xFF354751,0xFF202D37,0xFF1D2932,
+   0xFF2E3F48,0xFF3D505A,0xFF3A4C57,0xFF364652,0xFF4C5D6A,0xFF5B6D7A,0xFF5C6E7A,
+   0xFF5C6E7A,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7A,0xFF5B6E79,0xFF5B6E79,0xFF5B6D79,
+   0xFF5B6D7A,0xFF5C6C7A,0xFF5C6C7A,0xFF5C6C7A,0xFF5D6D7C,0xFF5E6E7E,0xFF5E6F7F,
+   0xFF5F707F,0xFF617080,0xFF627183,0xFF637284,0xFF627182,0xFF617081,0xFF647384,
+   0xFF445263,0xFF526071,0xFF667687,0xFF667686,0xFF6B7D8D,0xFF697C8B,0xFF455464,
+   0xFF354251,0xFF475666,0xFF536474,0xFF5A6B7B,0xFF5E6F7F,0xFF5F7080,0xFF607181,
+   0xFF607181,0xFF607081,0xFF606F81,0xFF606F81,0xFF617181,0xFF617281,0xFF617281,
+   0xFF617281,0xFF607380,0xFF607380,0xFF60737F,0xFF5F737F,0xFF5F737F,0xFF5F747F,
+   0xFF5F747F,0xFF5E747D,0xFF3D525B,0xFF3E5259,0xFF617A80,0xFF607A7F,0xFF5F7A7D,
+   0xFF5F7A7D,0xFF5F797D,0xFF60797E,0xFF5F797E,0xFF5F7A7D,0xFF5F7A7D,0xFF3F585B,
+   0xFF435B5F,0xFF556E71,0xFF546D71,0xFF546D71,0xFF546D71,0xFF556D72,0xFF566C73,
+   0xFF576B75,0xFF586D76,0xFF5A6E78,0xFF5C6F7A,0xFF637783,0xFF4B5D68,0xFF3E4D57,
+   0xFF586871,0xFF5A6A73,0xFF5A6874,0xFF5A6875,0xFF5A6875,0xFF596874,0xFF596973,
+   0xFF596973,0xFF596874,0xFF596873,0xFF586773,0xFF586872,0xFF51636B,0xFF33444C,
+   0xFF202D37,0xFF1D2932,0xFF2E3F48,0xFF3D505A,0xFF3A4D56,0xFF354751,0xFF4B5E68,
+   0xFF5A6E78,0xFF5B6F79,0xFF5A6F78,0xFF5A7078,0xFF5A7077,0xFF597076,0xFF597076,
+   0xFF597076,0xFF5A6F77,0xFF5B6D78,0xFF5B6D79,0xFF5C6C7B,0xFF5D6B7C,0xFF5E6C7D,
+   0xFF5E6D7F,0xFF5F6E80,0xFF5F6E80,0xFF606F80,0xFF617081,0xFF617081,0xFF607181,
+   0xFF607181,0xFF5E6D7E,0xFF3E4B5C,0xFF596878,0xFF627283,0xFF637283,0xFF637383,
+   0xFF677888,0xFF6B7D8D,0xFF445363,0xFF2A3745,0xFF32414E,0xFF3C4D5A,0xFF445562,
+   0xFF4A5B68,0xFF4E606D,0xFF516370,0xFF566775,0xFF5B6D7A,0xFF5E717D,0xFF5F737E,
+   0xFF5F757E,0xFF5F757E,0xFF5F757F,0xFF60757F,0xFF60747F,0xFF60747F,0xFF60747F,
+   0xFF5F757E,0xFF5E767D,0xFF5D757B,0xFF495F67,0xFF2C3D48,0xFF3A4D5D,0xFF5F7484,
+   0xFF627787,0xFF617586,0xFF607486,0xFF607486,0xFF607486,0xFF617587,0xFF617587,
+   0xFF627588,0xFF435568,0xFF445969,0xFF576E7C,0xFF566E7C,0xFF566E7B,0xFF566E7B,
+   0xFF566E7A,0xFF556F7A,0xFF556F7A,0xFF55707A,0xFF57727C,0xFF58737F,0xFF5C7883,
+   0xFF5C7782,0xFF384E57,0xFF485D65,0xFF5A7178,0xFF5A7179,0xFF5A7179,0xFF5A7178,
+   0xFF5A7178,0xFF5A7179,0xFF5A7079,0xFF5A7079,0xFF5A6F78,0xFF5B7079,0xFF516670,
+   0xFF394C55,0xFF34454E,0xFF40535D,0xFF354851,0xFF3B4E57,0xFF5E747D,0xFF627882,
+   0xFF596D79,0xFF445461,0xFF495A67,0xFF5C6D7A,0xFF5D6F7C,0xFF5D6F7B,0xFF5C6E7B,
+   0xFF5C6E7B,0xFF5C6E7A,0xFF5C6E7A,0xFF5C6E7B,0xFF5D6D7C,0xFF5C6C7B,0xFF5C6C7B,
+   0xFF5D6D7C,0xFF5E6E7E,0xFF5E6F7F,0xFF5F6E7F,0xFF5F6F7F,0xFF606F7F,0xFF607080,
+   0xFF617081,0xFF617081,0xFF617082,0xFF5E6D7E,0xFF3E4B5C,0xFF596878,0xFF627282,
+   0xFF627383,0xFF627483,0xFF677988,0xFF6B7D8D,0xFF455363,0xFF2B3646,0xFF33404F,
+   0xFF3D4C5B,0xFF455464,0xFF4B5A6A,0xFF4F5F6F,0xFF526272,0xFF576677,0xFF5D6C7C,
+   0xFF606F80,0xFF617181,0xFF627282,0xFF627382,0xFF617382,0xFF617382,0xFF617381,
+   0xFF617381,0xFF607480,0xFF617480,0xFF607580,0xFF5E747E,0xFF495F68,0xFF2B3D45,
+   0xFF384C53,0xFF5E777D,0xFF607A7F,0xFF5F797D,0xFF5E787D,0xFF5E787D,0xFF5F787E,
+   0xFF60797E,0xFF5F7A7D,0xFF5F7A7D,0xFF3F575B,0xFF41595D,0xFF546E70,0xFF536E6F,
+   0xFF536E6F,0xFF546E70,0xFF556D72,0xFF566C73,0xFF566C74,0xFF576C76,0xFF596D78,
+   0xFF5A6E79,0xFF5F727E,0xFF5E717E,0xFF394854,0xFF485761,0xFF596973,0xFF5A6974,
+   0xFF5A6875,0xFF5A6874,0xFF596973,0xFF586A71,0xFF586A71,0xFF576971,0xFF576971,
+   0xFF586972,0xFF4F6069,0xFF37484F,0xFF33444E,0xFF3F5460,0xFF364955,0xFF3B4F58,
+   0xFF5D747C,0xFF617980,0xFF586E76,0xFF42565E,0xFF475C63,0xFF597077,0xFF5A7278,
+   0xFF597177,0xFF597177,0xFF587176,0xFF587175,0xFF597077,0xFF5A6F78,0xFF5B6E79,
+   0xFF5B6D7A,0xFF5C6C7B,0xFF5E6C7D,0xFF5F6D7F,0xFF5F6E80,0xFF5F6E80,0xFF5F6E80,
+   0xFF606F80,0xFF606F80,0xFF606F80,0xFF606F7F,0xFF627282,0xFF536173,0xFF3C4858,
+   0xFF5E6D7D,0xFF607080,0xFF617080,0xFF607080,0xFF5F707F,0xFF657686,0xFF4E5F6E,
+   0xFF26323F,0xFF1B252F,0xFF222E3A,0xFF2A3844,0xFF31404C,0xFF354652,0xFF374854,
+   0xFF394956,0xFF3E4F5C,0xFF495967,0xFF526571,0xFF546A73,0xFF546A73,0xFF556A74,
+   0xFF546A73,0xFF556A74,0xFF576B76,0xFF566B74,0xFF546973,0xFF526971,0xFF455D63,
+   0xFF2F434A,0xFF1F2D36,0xFF384B5A,0xFF5B7080,0xFF627687,0xFF607486,0xFF607486,
+   0xFF607486,0xFF607486,0xFF617487,0xFF627488,0xFF627489,0xFF445569,0xFF425767,
+   0xFF576D7D,0xFF576D7C,0xFF566E7C,0xFF566E7B,0xFF556F7A,0xFF556F79,0xFF55707A,
+   0xFF55707A,0xFF56717B,0xFF57727D,0xFF58737E,0xFF5F7B86,0xFF4F6973,0xFF334850,
+   0xFF485E65,0xFF586E77,0xFF5A7179,0xFF5A7179,0xFF5A7178,0xFF597177,0xFF597077,
+   0xFF597077,0xFF596F78,0xFF4D626B,0xFF3B4D57,0xFF4E626B,0xFF607680,0xFF647B84,
+   0xFF5D747C,0xFF3A4D56,0xFF556A73,0xFF5E737D,0xFF637882,0xFF667A86,0xFF4D5D6A,
+   0xFF445562,0xFF5A6C79,0xFF5E707D,0xFF5E707C,0xFF5D6F7C,0xFF5D6F7B,0xFF5D6E7C,
+   0xFF5D6D7D,0xFF5D6D7D,0xFF5D6D7C,0xFF5D6D7D,0xFF5E6D7E,0xFF5F6E7F,0xFF5E6F7F,
+   0xFF5F6E7F,0xFF5F6E7F,0xFF5F6F7F,0xFF606F7F,0xFF606F80,0xFF606F80,0xFF627283,
+   0xFF536173,0xFF3C4858,0xFF5E6D7D,0xFF607080,0xFF607080,0xFF607180,0xFF5F707F,
+   0xFF657686,0xFF4F5E6E,0xFF273140,0xFF1C2431,0xFF232D3B,0xFF2B3745,0xFF323F4F,
+   0xFF374555,0xFF384757,0xFF394858,0xFF3F4E5E,0xFF4A5869,0xFF546374,0xFF576777,
+   0xFF586778,0xFF586778,0xFF586778,0xFF586878,0xFF586A78,0xFF576977,0xFF566875,
+   0xFF546873,0xFF475B65,0xFF30424B,0xFF1F2D35,0xFF364B52,0xFF5A7378,0xFF607A7E,
+   0xFF5E797D,0xFF5E787C,0xFF5E797C,0xFF5E797C,0xFF5E7A7C,0xFF5F7A7C,0xFF5F7B7D,
+   0xFF3F595B,0xFF3E585A,0xFF536F6F,0xFF52706E,0xFF526F6E,0xFF536E6F,0xFF546D70,
+   0xFF556D71,0xFF566C74,0xFF576C76,0xFF586C77,0xFF5A6C79,0xFF5B6D7A,0xFF627483,
+   0xFF526371,0xFF34424D,0xFF485761,0xFF576771,0xFF596874,0xFF596973,0xFF586A72,
+   0xFF576A70,0xFF576970,0xFF576A71,0xFF576970,0xFF4B5C64,0xFF394A53,0xFF4B616B,
+   0xFF5E7682,0xFF627A87,0xFF5B7380,0xFF3A4E58,0xFF546B72,0xFF5C747A,0xFF617980,
+   0xFF647C83,0xFF4A6066,0xFF41585D,0xFF566F73,0xFF5A7477,0xFF597376,0xFF597376,
+   0xFF597276,0xFF5A7177,0xFF5A7078,0xFF5C6E7B,0xFF5C6D7B,0xFF5D6D7C,0xFF5E6D7F,
+   0xFF5F6E80,0xFF5F6E80,0xFF5F6E80,0xFF5F6E80,0xFF5F6E80,0xFF606F80,0xFF606F80,
+   0xFF617080,0xFF5F6E7F,0xFF3A4757,0xFF3E4A59,0xFF617080,0xFF5F707F,0xFF5F707F,
+   0xFF5F707F,0xFF607180,0xFF536372,0xFF33424F,0xFF293743,0xFF2D3C47,0xFF33424E,
+   0xFF384854,0xFF3D4F5A,0xFF41535F,0xFF3F505D,0xFF354552,0xFF2D3B49,0xFF2C3947,
+   0xFF32404E,0xFF344550,0xFF33444F,0xFF32434E,0xFF31444D,0xFF33464F,0xFF354952,
+   0xFF374953,0xFF364953,0xFF354851,0xFF31454D,0xFF2A3B43,0xFF213038,0xFF344753,
+   0xFF556B7A,0xFF5F7485,0xFF5F7385,0xFF5F7385,0xFF607386,0xFF607386,0xFF617387,
+   0xFF617388,0xFF627589,0xFF455668,0xFF415463,0xFF576D7D,0xFF576D7C,0xFF576D7C,
+   0xFF566E7C,0xFF566E7A,0xFF556F7A,0xFF55707A,0xFF55707A,0xFF56717B,0xFF56717B,
+   0xFF57727D,0xFF58737E,0xFF5F7C87,0xFF435B65,0xFF31454D,0xFF455B63,0xFF576E75,
+   0xFF5A7179,0xFF597178,0xFF597177,0xFF576F75,0xFF50676E,0xFF41555E,0xFF354850,
+   0xFF50646D,0xFF5C727B,0xFF5B7079,0xFF5B717A,0xFF647B83,0xFF42565F,0xFF475B64,
+   0xFF5D727C,0xFF5D717C,0xFF60737F,0xFF687A87,0xFF51616F,0xFF404F5D,0xFF586977,
+   0xFF5F717E,0xFF5E707D,0xFF5D6F7D,0xFF5D6E7D,0xFF5E6E7E,0xFF5E6E7E,0xFF5D6E7D,
+   0xFF5D6E7E,0xFF5F6E7F,0xFF5F6E7F,0xFF5E6F7F,0xFF5F6E7F,0xFF5F6E7F,0xFF5F6E7F,
+   0xFF606F7F,0xFF606F80,0xFF607080,0xFF5F6E7E,0xFF3A4757,0xFF3E4A5A,0xFF617081,
+   0xFF606F80,0xFF606F7F,0xFF60707F,0xFF607180,0xFF546372,0xFF354151,0xFF2B3646,
+   0xFF2F3A4C,0xFF344254,0xFF3A485C,0xFF3F4F63,0xFF435367,0xFF405063,0xFF364556,
+   0xFF2E3A4A,0xFF2D3848,0xFF333F4F,0xFF364353,0xFF354252,0xFF354152,0xFF344252,
+   0xFF354455,0xFF384858,0xFF384959,0xFF384A58,0xFF354955,0xFF314650,0xFF2A3B45,
+   0xFF212F38,0xFF33474E,0xFF546D72,0xFF5E787C,0xFF5D787B,0xFF5D787B,0xFF5C797A,
+   0xFF5D797B,0xFF5E797C,0xFF5E797C,0xFF5E7B7C,0xFF3F5B5B,0xFF3C5757,0xFF52706E,
+   0xFF52706D,0xFF526F6E,0xFF536E6F,0xFF536E70,0xFF546E70,0xFF556D73,0xFF576C75,
+   0xFF586C77,0xFF5A6B79,0xFF5A6B7A,0xFF5C6D7C,0xFF637584,0xFF465663,0xFF323F4B,
+   0xFF45545F,0xFF566670,0xFF596A73,0xFF586A72,0xFF576A71,0xFF566870,0xFF4F6068,
+   0xFF405159,0xFF34464F,0xFF4E646F,0xFF5A727E,0xFF59707D,0xFF5A717E,0xFF627A87,
+   0xFF415762,0xFF465C63,0xFF5B7479,0xFF5A7377,0xFF5D767B,0xFF647E82,0xFF4D6569,
+   0xFF3B5456,0xFF526E6F,0xFF597675,0xFF587575,0xFF597376,0xFF597277,0xFF5B7179,
+   0xFF5C6F7B,0xFF5C6F7B,0xFF5D6E7D,0xFF5F6E7F,0xFF5F6E80,0xFF5F6E80,0xFF5F6E80,
+   0xFF5F6E80,0xFF5F6E80,0xFF5F6E80,0xFF606F80,0xFF5F6E7F,0xFF475566,0xFF293443,
+   0xFF404D5D,0xFF5C6C7B,0xFF5D6E7C,0xFF5A6B79,0xFF566775,0xFF4D5D6B,0xFF3E4D5C,
+   0xFF42535F,0xFF4E616D,0xFF576B76,0xFF5D717D,0xFF617681,0xFF647983,0xFF667B86,
+   0xFF687A88,0xFF596A79,0xFF3D4C5B,0xFF273341,0xFF1C2430,0xFF1C2531,0xFF25323D,
+   0xFF32444E,0xFF435761,0xFF566C75,0xFF5D747C,0xFF607780,0xFF617881,0xFF607680,
+   0xFF5A6F79,0xFF4E636C,0xFF3A4E58,0xFF2F424B,0xFF495F6B,0xFF5F7584,0xFF5F7384,
+   0xFF5F7385,0xFF5F7385,0xFF607286,0xFF607286,0xFF607287,0xFF607386,0xFF455766,
+   0xFF3F5160,0xFF576E7D,0xFF576D7D,0xFF576D7C,0xFF566E7C,0xFF566E7B,0xFF566F7B,
+   0xFF566F7B,0xFF56707C,0xFF56707C,0xFF56707C,0xFF56707C,0xFF56707C,0xFF5B7682,
+   0xFF5D7884,0xFF394E57,0xFF2F4149,0xFF3F535B,0xFF475D64,0xFF485E65,0xFF455B62,
+   0xFF3F545B,0xFF3B4F57,0xFF35474F,0xFF3D4F58,0xFF4A5F68,0xFF4C6069,0xFF4E626B,
+   0xFF4C6169,0xFF4E636B,0xFF374A53,0xFF3D4F59,0xFF5D717C,0xFF5D717C,0xFF5D707C,
+   0xFF60727F,0xFF697B89,0xFF485765,0xFF374754,0xFF516370,0xFF5E707D,0xFF5D6F7D,
+   0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7D,0xFF5E6E7E,0xFF5E6F7F,
+   0xFF5E6F7F,0xFF5F6E7F,0xFF5F6E7F,0xFF5F6E7F,0xFF5F6E7F,0xFF606F80,0xFF5F6E7F,
+   0xFF475566,0xFF293444,0xFF404D5E,0xFF5C6B7C,0xFF5E6D7E,0xFF5B6A7C,0xFF576679,
+   0xFF4E5D70,0xFF3F4D5F,0xFF435165,0xFF505F75,0xFF59687F,0xFF5E6E85,0xFF627389,
+   0xFF64758B,0xFF66778D,0xFF66788D,0xFF59697F,0xFF3E4C60,0xFF283343,0xFF1C2331,
+   0xFF1D2532,0xFF263140,0xFF344355,0xFF45586A,0xFF586C7F,0xFF5F7587,0xFF61788A,
+   0xFF627A8A,0xFF5F7986,0xFF59737F,0xFF4D6671,0xFF3A4F5A,0xFF2E424A,0xFF486065,
+   0xFF5E787C,0xFF5D787B,0xFF5C787A,0xFF5C787A,0xFF5D787B,0xFF5D777B,0xFF5D787A,
+   0xFF5C797A,0xFF405D5B,0xFF3A5554,0xFF52706E,0xFF526F6E,0xFF526F6E,0xFF536E6F,
+   0xFF536E70,0xFF546E71,0xFF556E72,0xFF566D74,0xFF586C77,0xFF596B79,0xFF5A6B79,
+   0xFF5A6B7A,0xFF5E707E,0xFF5F7380,0xFF3B4A57,0xFF2F3D47,0xFF3E4D57,0xFF46565F,
+   0xFF475860,0xFF44555D,0xFF3E5059,0xFF3B4D59,0xFF364755,0xFF3D515F,0xFF49606D,
+   0xFF4A626D,0xFF4C646F,0xFF4C626F,0xFF4E6471,0xFF374B56,0xFF3C5157,0xFF5A7478,
+   0xFF5A7477,0xFF5A7377,0xFF5B7679,0xFF647F82,0xFF435B5E,0xFF334B4D,0xFF4B6967,
+   0xFF577573,0xFF587475,0xFF587275,0xFF5A7177,0xFF5B707A,0xFF5C6F7B,0xFF5D6E7C,
+   0xFF5E6E7F,0xFF5F6E80,0xFF5F6E80,0xFF5F6E80,0xFF5F6E80,0xFF5F6E80,0xFF5F6F81,
+   0xFF5F6E80,0xFF4C596B,0xFF303A4B,0xFF212938,0xFF2E3949,0xFF364251,0xFF3E4C5B,
+   0xFF425160,0xFF4D5D6C,0xFF5A6C7A,0xFF627582,0xFF647984,0xFF647983,0xFF637782,
+   0xFF617680,0xFF60747F,0xFF5F737E,0xFF5F727E,0xFF627481,0xFF6A7B8A,0xFF627282,
+   0xFF3D4B5B,0xFF232D3B,0xFF232D3A,0xFF3A4B58,0xFF546873,0xFF637983,0xFF637A82,
+   0xFF617880,0xFF60787F,0xFF617780,0xFF627882,0xFF657B85,0xFF697F8A,0xFF657B85,
+   0xFF485D66,0xFF374C55,0xFF566B79,0xFF5F7484,0xFF5F7385,0xFF5F7385,0xFF607285,
+   0xFF607285,0xFF607286,0xFF5F7286,0xFF475867,0xFF3C4D5D,0xFF576D7E,0xFF576D7D,
+   0xFF576D7C,0xFF566E7B,0xFF566F7C,0xFF566F7C,0xFF566F7C,0xFF566F7D,0xFF566F7C,
+   0xFF566F7C,0xFF57707D,0xFF57707C,0xFF56717C,0xFF5E7B86,0xFF536D77,0xFF2F424A,
+   0xFF213038,0xFF27383F,0xFF2F424A,0xFF3E525A,0xFF4E646C,0xFF5B727A,0xFF5F757E,
+   0xFF5F757E,0xFF5E747D,0xFF5C737B,0xFF5C737A,0xFF5A7178,0xFF556B73,0xFF364852,
+   0xFF31424C,0xFF586C77,0xFF5E717D,0xFF5E717D,0xFF5E717D,0xFF5F707F,0xFF475665,
+   0xFF293743,0xFF344350,0xFF4D5F6B,0xFF5C6F7C,0xFF5D6F7C,0xFF5D6E7C,0xFF5D6E7C,
+   0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7E,0xFF5E6F7F,0xFF5E6F7F,0xFF5F6E7F,0xFF5F6E7F,
+   0xFF5F6E7F,0xFF5F6F80,0xFF5F6E7F,0xFF4C596B,0xFF303A4B,0xFF212938,0xFF2E394A,
+   0xFF374356,0xFF404D62,0xFF445169,0xFF4E5D74,0xFF5A6A81,0xFF627289,0xFF65758C,
+   0xFF65758B,0xFF64738A,0xFF627288,0xFF607187,0xFF5F7086,0xFF5F7086,0xFF617287,
+   0xFF697990,0xFF617088,0xFF3E4C63,0xFF242D3E,0xFF232C3B,0xFF3B4A5D,0xFF55697D,
+   0xFF657B8E,0xFF657B8D,0xFF637A8B,0xFF617A8A,0xFF617B88,0xFF617D88,0xFF63808A,
+   0xFF67848F,0xFF637F8A,0xFF476068,0xFF364D53,0xFF546E72,0xFF5D787B,0xFF5D787B,
+   0xFF5D787B,0xFF5D777C,0xFF5D777C,0xFF5C777A,0xFF5B7878,0xFF415E5C,0xFF375150,
+   0xFF52706D,0xFF526F6E,0xFF526F6E,0xFF526F6E,0xFF536F70,0xFF546F71,0xFF556D73,
+   0xFF566D74,0xFF576B76,0xFF586B77,0xFF596C78,0xFF596C78,0xFF596C78,0xFF607580,
+   0xFF546974,0xFF30404B,0xFF222E38,0xFF273540,0xFF2F4049,0xFF3D515C,0xFF4D6370,
+   0xFF5A707F,0xFF5E7484,0xFF5E7583,0xFF5B7480,0xFF59747D,0xFF59737D,0xFF58717C,
+   0xFF546B77,0xFF364B55,0xFF2F4449,0xFF556F72,0xFF5B7578,0xFF5A7578,0xFF5A7577,
+   0xFF597577,0xFF415C5C,0xFF243B3C,0xFF2D4947,0xFF466462,0xFF577374,0xFF587375,
+   0xFF597277,0xFF5A7079,0xFF5C6F7A,0xFF5D6E7C,0xFF5E6D7F,0xFF5F6E80,0xFF5F6E80,
+   0xFF5F6E80,0xFF5F6E80,0xFF606F81,0xFF5B697B,0xFF465365,0xFF333E4F,0xFF2E3949,
+   0xFF323D4E,0xFF3B4758,0xFF475666,0xFF566776,0xFF617281,0xFF647684,0xFF617481,
+   0xFF5F737E,0xFF5D727B,0xFF5D727B,0xFF5E727C,0xFF5E727D,0xFF5E727D,0xFF5E727D,
+   0xFF5F717D,0xFF5F707F,0xFF617180,0xFF6A7A8B,0xFF5A697A,0xFF334150,0xFF2F3D4B,
+   0xFF536673,0xFF627782,0xFF5E747E,0xFF5D737D,0xFF5C747C,0xFF5B757A,0xFF5C747B,
+   0xFF5D737D,0xFF5D727E,0xFF5E737F,0xFF657A85,0xFF687E88,0xFF32444C,0xFF394C57,
+   0xFF586C7D,0xFF5F7385,0xFF5F7385,0xFF5F7385,0xFF607285,0xFF5F7185,0xFF5E7085,
+   0xFF475768,0xFF384958,0xFF576C7D,0xFF576D7D,0xFF576D7C,0xFF566E7C,0xFF566E7C,
+   0xFF576E7D,0xFF566F7D,0xFF566F7C,0xFF566F7C,0xFF56707B,0xFF56717C,0xFF56717C,
+   0xFF56717B,0xFF57737D,0xFF607D86,0xFF445A63,0xFF25363D,0xFF32464D,0xFF516870,
+   0xFF5F767E,0xFF5D747B,0xFF5A7179,0xFF597078,0xFF597078,0xFF5A7078,0xFF5A7178,
+   0xFF5B7278,0xFF5C737A,0xFF637B82,0xFF485D66,0xFF283842,0xFF3F4F5C,0xFF4D5E6B,
+   0xFF4E5F6B,0xFF465763,0xFF384855,0xFF2C3A48,0xFF25323E,0xFF273541,0xFF30404C,
+   0xFF485966,0xFF5A6C79,0xFF5D6F7C,0xFF5C6E7C,0xFF5C6E7C,0xFF5C6F7B,0xFF5D6E7D,
+   0xFF5E6F7E,0xFF5E6F7F,0xFF5E6F7F,0xFF5E6F7F,0xFF606F80,0xFF5B697B,0xFF465364,
+   0xFF333E50,0xFF2F3A4C,0xFF333E53,0xFF3C485F,0xFF48566E,0xFF57667D,0xFF607087,
+   0xFF63738A,0xFF617188,0xFF5F6F86,0xFF5E6E85,0xFF5E6E84,0xFF5E6E85,0xFF5F6E85,
+   0xFF5F6E85,0xFF5F6E85,0xFF5E6E85,0xFF5E6E85,0xFF5F6F86,0xFF68788F,0xFF596880,
+   0xFF354156,0xFF303C4D,0xFF54677B,0xFF62798C,0xFF5F7688,0xFF5E7686,0xFF5D7685,
+   0xFF5D7784,0xFF5C7784,0xFF5B7882,0xFF5A7981,0xFF5B7A82,0xFF628089,0xFF65848C,
+   0xFF30474D,0xFF374E52,0xFF567073,0xFF5D787C,0xFF5D777B,0xFF5D777C,0xFF5D787B,
+   0xFF5B7778,0xFF5A7777,0xFF415D5C,0xFF334C4C,0xFF516F6C,0xFF51706D,0xFF52706D,
+   0xFF52706D,0xFF536F6F,0xFF546E71,0xFF556D73,0xFF566D73,0xFF566C75,0xFF566D75,
+   0xFF586D76,0xFF596C77,0xFF596C77,0xFF596E78,0xFF617881,0xFF445963,0xFF273745,
+   0xFF344757,0xFF516775,0xFF5D7582,0xFF5B7380,0xFF5A6F80,0xFF5A6E7F,0xFF596E7E,
+   0xFF58707D,0xFF58717C,0xFF58727C,0xFF59737D,0xFF607B84,0xFF466068,0xFF263B3F,
+   0xFF3B5356,0xFF486264,0xFF496365,0xFF415B5D,0xFF334D4D,0xFF26403E,0xFF1F3735,
+   0xFF213B38,0xFF2A4544,0xFF435E5E,0xFF557072,0xFF597376,0xFF5A7178,0xFF5B6F7A,
+   0xFF5D6E7C,0xFF5E6D7E,0xFF5F6E7F,0xFF5F6E80,0xFF5F6E80,0xFF5F6E80,0xFF536173,
+   0xFF3B4859,0xFF384455,0xFF445163,0xFF526173,0xFF5D6B7D,0xFF627283,0xFF657685,
+   0xFF637583,0xFF617280,0xFF5F707E,0xFF5E717D,0xFF5D727C,0xFF5C727B,0xFF5C727B,
+   0xFF5D727B,0xFF5E727D,0xFF5E727D,0xFF5E727D,0xFF5E727D,0xFF5F717E,0xFF60707F,
+   0xFF627282,0xFF697989,0xFF425161,0xFF384754,0xFF5B717C,0xFF5D737E,0xFF5D737E,
+   0xFF5D727E,0xFF5D737E,0xFF5C747C,0xFF5C747C,0xFF5D737D,0xFF5E727F,0xFF5F727F,
+   0xFF607480,0xFF60757F,0xFF485B64,0xFF344650,0xFF415462,0xFF5C7081,0xFF5F7385,
+   0xFF5F7385,0xFF5F7385,0xFF5D7083,0xFF5D6F83,0xFF465767,0xFF344452,0xFF556B7B,
+   0xFF576D7D,0xFF576D7D,0xFF576D7D,0xFF576E7E,0xFF576E7D,0xFF566F7C,0xFF566F7C,
+   0xFF566F7C,0xFF566F7B,0xFF56717C,0xFF56717B,0xFF56717B,0xFF56717B,0xFF5B7781,
+   0xFF4F686F,0xFF2C3F46,0xFF485E65,0xFF5B727A,0xFF5A6F78,0xFF597077,0xFF597077,
+   0xFF597077,0xFF597077,0xFF597077,0xFF5A7177,0xFF597177,0xFF5A7177,0xFF5B7279,
+   0xFF3B5058,0xFF1F2C36,0xFF212D38,0xFF293743,0xFF2C3A46,0xFF30404C,0xFF3A4B57,
+   0xFF455663,0xFF4A5B68,0xFF475865,0xFF3B4B58,0xFF33414F,0xFF3E4D5B,0xFF536572,
+   0xFF5C6F7B,0xFF5C6F7C,0xFF5C6F7B,0xFF5C6E7C,0xFF5D6E7D,0xFF5E6F7E,0xFF5E6F7F,
+   0xFF5F6F7F,0xFF536172,0xFF3B4859,0xFF384458,0xFF445268,0xFF526179,0xFF5B6B83,
+   0xFF617188,0xFF64748B,0xFF627289,0xFF5F7086,0xFF5E6E85,0xFF5E6E85,0xFF5E6E85,
+   0xFF5E6E85,0xFF5E6E85,0xFF5E6E85,0xFF5F6E86,0xFF5F6E86,0xFF5F6E86,0xFF5F6E86,
+   0xFF5F6E85,0xFF5F6E86,0xFF617087,0xFF67768E,0xFF435167,0xFF394759,0xFF5C7286,
+   0xFF5E7687,0xFF5E7687,0xFF5D7686,0xFF5D7685,0xFF5C7784,0xFF5C7784,0xFF5B7882,
+   0xFF5A7981,0xFF5B7981,0xFF5D7B82,0xFF5C7C82,0xFF466066,0xFF31494F,0xFF3E585A,
+   0xFF5A7577,0xFF5D787C,0xFF5D777C,0xFF5D777A,0xFF5A7677,0xFF597676,0xFF415C5C,
+   0xFF2F4847,0xFF4F6E6B,0xFF52706D,0xFF52706D,0xFF51706D,0xFF52706F,0xFF546F71,
+   0xFF546F71,0xFF546E72,0xFF556E72,0xFF546E72,0xFF566E74,0xFF586D76,0xFF586D77,
+   0xFF586C77,0xFF5D737C,0xFF516670,0xFF2E404E,0xFF495D6E,0xFF5B7080,0xFF596F7D,
+   0xFF596E7E,0xFF5A6E7F,0xFF596E7F,0xFF596E7E,0xFF596F7D,0xFF59717D,0xFF57727B,
+   0xFF57737A,0xFF58737B,0xFF3A535B,0xFF1E2F34,0xFF1E3034,0xFF253B3D,0xFF273F3F,
+   0xFF2B4544,0xFF34504E,0xFF3D5D58,0xFF41635C,0xFF3E6059,0xFF34514E,0xFF2D4646,
+   0xFF395154,0xFF4F686C,0xFF5A7178,0xFF5C707A,0xFF5D6E7C,0xFF5E6D7E,0xFF5E6D7F,
+   0xFF5F6E80,0xFF59677A,0xFF485567,0xFF3D495A,0xFF505E70,0xFF607082,0xFF657587,
+   0xFF657587,0xFF647284,0xFF617181,0xFF5F6F7F,0xFF5F6F7E,0xFF5F707E,0xFF5E707E,
+   0xFF5E717D,0xFF5D727C,0xFF5C737A,0xFF5C737A,0xFF5D727C,0xFF5E717C,0xFF5E727D,
+   0xFF5E727D,0xFF5E727D,0xFF5E727D,0xFF5F717E,0xFF60707F,0xFF687888,0xFF4F5F6E,
+   0xFF3A4A57,0xFF5C717C,0xFF5C747C,0xFF5C737D,0xFF5D737E,0xFF5D737D,0xFF5D737D,
+   0xFF5D737E,0xFF5D727E,0xFF5E727F,0xFF5F7380,0xFF5F737F,0xFF5D717C,0xFF6B818C,
+   0xFF546773,0xFF33454F,0xFF4C606F,0xFF5E7383,0xFF5F7384,0xFF5E7283,0xFF5C6F81,
+   0xFF5C6F81,0xFF435464,0xFF2E3E4C,0xFF506675,0xFF576E7D,0xFF576D7D,0xFF576D7D,
+   0xFF576E7E,0xFF576E7D,0xFF566F7C,0xFF566F7C,0xFF566F7B,0xFF55707B,0xFF56707B,
+   0xFF56717B,0xFF56717B,0xFF56717B,0xFF59757E,0xFF485F66,0xFF354950,0xFF586F76,
+   0xFF597077,0xFF597077,0xFF597077,0xFF597076,0xFF597077,0xFF597077,0xFF597077,
+   0xFF5A7177,0xFF5A7178,0xFF5B7379,0xFF496067,0xFF2A3C44,0xFF263640,0xFF31414C,
+   0xFF42535F,0xFF536572,0xFF5E707D,0xFF637683,0xFF657885,0xFF667986,0xFF677A87,
+   0xFF667A87,0xFF5D6F7D,0xFF42525F,0xFF364552,0xFF475965,0xFF596B78,0xFF5D707C,
+   0xFF5C6F7C,0xFF5D6F7D,0xFF5D6F7E,0xFF596979,0xFF475566,0xFF3C4A5B,0xFF4E5E73,
+   0xFF5F6F86,0xFF63738C,0xFF63738B,0xFF627189,0xFF606F87,0xFF5E6D85,0xFF5E6D85,
+   0xFF5E6E85,0xFF5E6E85,0xFF5E6E85,0xFF5E6E85,0xFF5E6E85,0xFF5E6E85,0xFF5E6E84,
+   0xFF5E6E85,0xFF5F6E86,0xFF5F6E86,0xFF5F6E86,0xFF5F6E86,0xFF5F6E86,0xFF5F6E86,
+   0xFF66768D,0xFF4F5E74,0xFF3B4B5D,0xFF5D7486,0xFF5D7686,0xFF5D7686,0xFF5D7686,
+   0xFF5D7785,0xFF5C7784,0xFF5C7783,0xFF5B7882,0xFF5A7981,0xFF5B7A82,0xFF5B7A81,
+   0xFF59787E,0xFF68888E,0xFF506E73,0xFF2F494C,0xFF496365,0xFF5D777B,0xFF5E777C,
+   0xFF5C767A,0xFF597475,0xFF587575,0xFF3E5959,0xFF294241,0xFF4A6966,0xFF52706D,
+   0xFF51706D,0xFF51706D,0xFF53706F,0xFF546F71,0xFF546F71,0xFF546E71,0xFF546F71,
+   0xFF546F71,0xFF556F72,0xFF566E74,0xFF576D76,0xFF576D76,0xFF5B717A,0xFF4A5D69,
+   0xFF374958,0xFF586D7D,0xFF596F7E,0xFF596F7D,0xFF596E7F,0xFF5A6D7F,0xFF596E7F,
+   0xFF596E7E,0xFF596F7D,0xFF59707D,0xFF58717B,0xFF58747B,0xFF476269,0xFF283F44,
+   0xFF23393B,0xFF2D4546,0xFF3C5857,0xFF4C6B68,0xFF567773,0xFF5C7D78,0xFF5E807A,
+   0xFF5E8179,0xFF5F827B,0xFF5F817B,0xFF577574,0xFF3E5659,0xFF32484D,0xFF455B62,
+   0xFF586C77,0xFF5D6F7C,0xFF5E6E7E,0xFF5F6E7F,0xFF5F6E7F,0xFF3B4859,0xFF3D495A,
+   0xFF5C6B7D,0xFF647486,0xFF617083,0xFF5F6E80,0xFF5F6E80,0xFF606E80,0xFF606E7F,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF5F707E,0xFF5E717D,0xFF5E717D,0xFF5D727C,0xFF5C727B,
+   0xFF5C727B,0xFF5D727C,0xFF5D717C,0xFF5E717D,0xFF5E717D,0xFF5D717C,0xFF5D717C,
+   0xFF5E707C,0xFF5E707D,0xFF637583,0xFF586B78,0xFF3B4B58,0xFF5B717B,0xFF5C747C,
+   0xFF5C747B,0xFF5B747B,0xFF5C747B,0xFF5C737D,0xFF5E727E,0xFF5E727F,0xFF5F7280,
+   0xFF5F7380,0xFF5B6F7B,0xFF5F747F,0xFF627882,0xFF697F8A,0xFF40535D,0xFF3A4C5A,
+   0xFF576A7C,0xFF5F7384,0xFF5D7182,0xFF5C6E81,0xFF5B6D80,0xFF3D4E5C,0xFF263542,
+   0xFF3E5362,0xFF546A79,0xFF576E7D,0xFF576D7D,0xFF576E7D,0xFF566F7C,0xFF566F7C,
+   0xFF566F7C,0xFF55707B,0xFF55707A,0xFF55707A,0xFF56717B,0xFF56717B,0xFF57727C,
+   0xFF557079,0xFF364A52,0xFF475D63,0xFF597177,0xFF587076,0xFF597077,0xFF597077,
+   0xFF587076,0xFF587076,0xFF597077,0xFF587076,0xFF5A7178,0xFF5C717A,0xFF526871,
+   0xFF2F414A,0xFF31434C,0xFF475B65,0xFF5C6F7B,0xFF647683,0xFF637582,0xFF607280,
+   0xFF5F717D,0xFF5E707D,0xFF5E707C,0xFF5D707C,0xFF5E717D,0xFF637682,0xFF677B87,
+   0xFF516270,0xFF384755,0xFF3B4B58,0xFF4C5E6B,0xFF546674,0xFF526372,0xFF4A5B6A,
+   0xFF3C4A5A,0xFF3C4A5C,0xFF5A6B80,0xFF627389,0xFF607087,0xFF5E6D85,0xFF5E6D85,
+   0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6E85,0xFF5E6E85,
+   0xFF5E6E85,0xFF5E6E85,0xFF5E6E84,0xFF5E6E84,0xFF5E6E85,0xFF5F6E85,0xFF5F6E86,
+   0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF62728A,0xFF58697F,0xFF3C4C5E,
+   0xFF5C7384,0xFF5D7686,0xFF5D7686,0xFF5D7685,0xFF5D7785,0xFF5C7783,0xFF5C7783,
+   0xFF5B7882,0xFF5B7981,0xFF5B7A81,0xFF58767D,0xFF5C7B81,0xFF5F7F85,0xFF65868B,
+   0xFF3C585C,0xFF364F52,0xFF556E73,0xFF5E777D,0xFF5B7479,0xFF597375,0xFF577373,
+   0xFF385253,0xFF223839,0xFF395654,0xFF4E6D69,0xFF51716C,0xFF51716C,0xFF52706E,
+   0xFF536F70,0xFF546F71,0xFF546E71,0xFF536F70,0xFF536F70,0xFF546F71,0xFF556F73,
+   0xFF566F74,0xFF576F75,0xFF566D74,0xFF364A53,0xFF475C6A,0xFF59707E,0xFF586F7D,
+   0xFF596E7E,0xFF5A6D7F,0xFF5A6D80,0xFF596E7F,0xFF596F7D,0xFF596E7E,0xFF5A6F7E,
+   0xFF59727D,0xFF4E6B71,0xFF2C4649,0xFF2D4746,0xFF43605F,0xFF567473,0xFF5D7C79,
+   0xFF5B7C77,0xFF587A74,0xFF577872,0xFF557870,0xFF557870,0xFF557770,0xFF567772,
+   0xFF5D7C7A,0xFF637E81,0xFF4D656B,0xFF354951,0xFF3A4C57,0xFF4D5E6B,0xFF566576,
+   0xFF536274,0xFF4C5A6D,0xFF343F50,0xFF526072,0xFF637183,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7E,
+   0xFF5E707D,0xFF5E707D,0xFF5D717C,0xFF5C727B,0xFF5C727B,0xFF5D727B,0xFF5D727B,
+   0xFF5C717B,0xFF5C707A,0xFF5B707A,0xFF5B707A,0xFF5B707A,0xFF5B6F7A,0xFF5E727E,
+   0xFF5D737E,0xFF394C55,0xFF576D76,0xFF5C747C,0xFF5B757B,0xFF5B757A,0xFF5B757A,
+   0xFF5C737D,0xFF5E727F,0xFF5F7180,0xFF607281,0xFF5A6D79,0xFF5C717C,0xFF60767F,
+   0xFF5F757F,0xFF687D88,0xFF50646F,0xFF344453,0xFF4D5F72,0xFF5E7284,0xFF5C7081,
+   0xFF5A6C7F,0xFF4D5F70,0xFF33424F,0xFF1C2631,0xFF2B3C4A,0xFF3F5463,0xFF516776,
+   0xFF566D7C,0xFF576F7D,0xFF57707D,0xFF57707D,0xFF56707C,0xFF56717B,0xFF55717A,
+   0xFF55717B,0xFF56727B,0xFF55717A,0xFF4E6A73,0xFF3A535B,0xFF30454C,0xFF546C72,
+   0xFF587176,0xFF587076,0xFF597077,0xFF587076,0xFF587176,0xFF587176,0xFF587076,
+   0xFF587076,0xFF5B7179,0xFF586D77,0xFF374953,0xFF3B4D57,0xFF5A6E79,0xFF627681,
+   0xFF5F737E,0xFF5E707D,0xFF5E707C,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707C,
+   0xFF5D6F7C,0xFF5C6F7B,0xFF5C6F7B,0xFF5F727F,0xFF687A89,0xFF5E6F7F,0xFF415060,
+   0xFF334250,0xFF364352,0xFF354251,0xFF2C3946,0xFF323F4F,0xFF516176,0xFF607187,
+   0xFF5E6E85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,
+   0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6E85,0xFF5E6E85,0xFF5E6E85,
+   0xFF5E6E85,0xFF5E6E85,0xFF5E6D84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,
+   0xFF5D6C84,0xFF5F6F86,0xFF5E6F86,0xFF3C4B5F,0xFF586F80,0xFF5D7686,0xFF5D7686,
+   0xFF5D7685,0xFF5D7785,0xFF5C7784,0xFF5C7783,0xFF5B7882,0xFF5B7A82,0xFF56747A,
+   0xFF59787E,0xFF5D7C82,0xFF5C7C81,0xFF64848A,0xFF4C6A6F,0xFF30484C,0xFF4A6268,
+   0xFF5D767C,0xFF5B7379,0xFF577074,0xFF496366,0xFF2F4648,0xFF19292C,0xFF263F3E,
+   0xFF395953,0xFF4A6C65,0xFF50716A,0xFF52726E,0xFF547070,0xFF547071,0xFF537070,
+   0xFF547070,0xFF537070,0xFF537070,0xFF557072,0xFF547071,0xFF4D686A,0xFF3A5157,
+   0xFF31454F,0xFF546B78,0xFF58707C,0xFF586F7C,0xFF596E7E,0xFF5A6E7F,0xFF5A6D7F,
+   0xFF596E7E,0xFF596E7E,0xFF596E7E,0xFF5A707F,0xFF556D7A,0xFF344D55,0xFF365251,
+   0xFF547370,0xFF5C7B79,0xFF597975,0xFF567771,0xFF557870,0xFF567771,0xFF567771,
+   0xFF557870,0xFF55786F,0xFF54776F,0xFF547670,0xFF567472,0xFF5B7679,0xFF647D83,
+   0xFF5B727A,0xFF3F525D,0xFF334250,0xFF374254,0xFF364152,0xFF2E3949,0xFF3B4759,
+   0xFF586678,0xFF627082,0xFF616F81,0xFF616F81,0xFF606E80,0xFF606E80,0xFF606E7F,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7E,0xFF5E707E,0xFF5E707D,0xFF5E707C,0xFF5D717C,
+   0xFF5C727B,0xFF5C727A,0xFF5C727A,0xFF5B7179,0xFF5B707A,0xFF5B707A,0xFF5B707A,
+   0xFF5B7079,0xFF5B7079,0xFF5B7079,0xFF5C717A,0xFF637883,0xFF3E525B,0xFF4B6169,
+   0xFF5C757C,0xFF5B757B,0xFF5B757A,0xFF5C747B,0xFF5D737D,0xFF5D727E,0xFF5E727F,
+   0xFF5D707E,0xFF576A76,0xFF607580,0xFF60757F,0xFF60757F,0xFF667986,0xFF556775,
+   0xFF31404D,0xFF3F4F62,0xFF506376,0xFF506275,0xFF455767,0xFF364552,0xFF212C36,
+   0xFF17202A,0xFF1B2631,0xFF293B48,0xFF354B57,0xFF405763,0xFF485F6C,0xFF4B6370,
+   0xFF4D6672,0xFF4E6773,0xFF4C6771,0xFF4A666E,0xFF49656E,0xFF46606A,0xFF3D5860,
+   0xFF314A52,0xFF283D44,0xFF40565C,0xFF597176,0xFF587076,0xFF587076,0xFF587076,
+   0xFF587175,0xFF577175,0xFF577175,0xFF587176,0xFF597077,0xFF597078,0xFF3E515B,
+   0xFF384A54,0xFF5B6F7A,0xFF5F737E,0xFF5D717C,0xFF5E707C,0xFF5E707D,0xFF5E707C,
+   0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5D6F7C,0xFF5C6E7C,0xFF5C6E7C,
+   0xFF5C6E7C,0xFF5E6F7E,0xFF657786,0xFF667787,0xFF4F5F6F,0xFF374554,0xFF26313F,
+   0xFF1C2430,0xFF364456,0xFF56677D,0xFF5F7086,0xFF5F6E85,0xFF5F6E86,0xFF5E6D85,
+   0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,
+   0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6E85,0xFF5E6D85,0xFF5E6D84,0xFF5D6C84,
+   0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,0xFF5E6D84,0xFF64748C,
+   0xFF425067,0xFF4E6174,0xFF5E7687,0xFF5D7685,0xFF5D7785,0xFF5C7784,0xFF5C7784,
+   0xFF5C7784,0xFF5C7883,0xFF5A7780,0xFF537077,0xFF5D7C82,0xFF5D7C82,0xFF5C7B81,
+   0xFF618187,0xFF516E73,0xFF2D4347,0xFF3B5257,0xFF4E666B,0xFF4E656B,0xFF42595F,
+   0xFF32484D,0xFF1E2E33,0xFF152226,0xFF18292B,0xFF243F3B,0xFF2E4F48,0xFF395B54,
+   0xFF42625D,0xFF486465,0xFF4A6667,0xFF4B6868,0xFF4B6667,0xFF486565,0xFF476563,
+   0xFF43615E,0xFF3A5855,0xFF2F4A49,0xFF273D41,0xFF3F5761,0xFF58707C,0xFF57707B,
+   0xFF586F7C,0xFF596E7E,0xFF596E7E,0xFF596E7E,0xFF596E7E,0xFF596E7E,0xFF596F7E,
+   0xFF586F7C,0xFF3D545F,0xFF354E53,0xFF567473,0xFF597875,0xFF577772,0xFF567772,
+   0xFF557871,0xFF55796F,0xFF557870,0xFF567871,0xFF567771,0xFF557870,0xFF54776F,
+   0xFF547670,0xFF577473,0xFF587276,0xFF5B7279,0xFF637982,0xFF647984,0xFF4E5F6E,
+   0xFF384456,0xFF273040,0xFF1A222F,0xFF343F50,0xFF536072,0xFF627082,0xFF616F81,
+   0xFF616F81,0xFF606E80,0xFF606E7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7E,0xFF5E707E,
+   0xFF5E707D,0xFF5E707D,0xFF5E707C,0xFF5D717C,0xFF5D717B,0xFF5C717A,0xFF5B7079,
+   0xFF5A7078,0xFF5B7079,0xFF5B7079,0xFF5B7079,0xFF5B7079,0xFF5A7178,0xFF5B7079,
+   0xFF5B7079,0xFF617780,0xFF556B73,0xFF394E55,0xFF587177,0xFF5C747C,0xFF5C747B,
+   0xFF5C747C,0xFF5D737D,0xFF5D737D,0xFF5E747F,0xFF576B77,0xFF5B6F7B,0xFF607580,
+   0xFF607580,0xFF617581,0xFF607380,0xFF475766,0xFF293542,0xFF2B3946,0xFF39495A,
+   0xFF384857,0xFF2D3B47,0xFF26323E,0xFF222E38,0xFF212F37,0xFF202E36,0xFF213138,
+   0xFF253941,0xFF2A4049,0xFF2E434E,0xFF30444F,0xFF30444D,0xFF30454E,0xFF2E454D,
+   0xFF2C444B,0xFF2B424A,0xFF293E47,0xFF24363E,0xFF1D2C33,0xFF283A41,0xFF4A6268,
+   0xFF5A7278,0xFF597077,0xFF597076,0xFF587076,0xFF587175,0xFF577175,0xFF577175,
+   0xFF577175,0xFF597277,0xFF42575F,0xFF33454F,0xFF566A74,0xFF5E727D,0xFF5E707C,
+   0xFF5E707C,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5F6F7E,
+   0xFF5F6F7E,0xFF5E6E7D,0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7D,0xFF5D6E7D,
+   0xFF637483,0xFF6B7C8C,0xFF5D6D7E,0xFF425060,0xFF2B3644,0xFF323E52,0xFF526278,
+   0xFF5F6F85,0xFF5F6E85,0xFF5F6E86,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,
+   0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,
+   0xFF5E6C84,0xFF5D6C84,0xFF5D6B84,0xFF5D6B84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,
+   0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,0xFF62728A,0xFF58677E,0xFF3E4D61,0xFF5B7184,
+   0xFF5E7686,0xFF5D7785,0xFF5C7784,0xFF5C7784,0xFF5C7783,0xFF5C7984,0xFF547179,
+   0xFF58757C,0xFF5D7C82,0xFF5D7C82,0xFF5D7D82,0xFF5C7B81,0xFF425D62,0xFF25383D,
+   0xFF283B41,0xFF354B51,0xFF354A51,0xFF2A3E43,0xFF23353A,0xFF203137,0xFF1F3135,
+   0xFF1D3232,0xFF1D3532,0xFF213C38,0xFF25433E,0xFF294642,0xFF2C4747,0xFF2D4747,
+   0xFF2C4747,0xFF2C4546,0xFF2B4345,0xFF294342,0xFF26403E,0xFF213837,0xFF1B2D2E,
+   0xFF263E42,0xFF49646C,0xFF58717C,0xFF57707B,0xFF586F7C,0xFF596F7D,0xFF596E7E,
+   0xFF596E7E,0xFF596E7E,0xFF586F7D,0xFF59707D,0xFF425A64,0xFF324A4F,0xFF516F6E,
+   0xFF587774,0xFF577672,0xFF567771,0xFF567771,0xFF557871,0xFF557870,0xFF557870,
+   0xFF567771,0xFF557870,0xFF54796F,0xFF54776F,0xFF557571,0xFF577374,0xFF587276,
+   0xFF5A7178,0xFF5B707A,0xFF617581,0xFF6B7C8B,0xFF5E6C7F,0xFF424F61,0xFF2C3646,
+   0xFF2B3646,0xFF475365,0xFF627082,0xFF616F81,0xFF617081,0xFF616F80,0xFF606E7F,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7E,0xFF5E707E,0xFF5E707D,0xFF5E707C,0xFF5E707C,
+   0xFF5D717C,0xFF5D717B,0xFF5C707A,0xFF5B6F79,0xFF5A6F79,0xFF5A6F79,0xFF5B7079,
+   0xFF5A7079,0xFF5A7178,0xFF5A7178,0xFF5A7178,0xFF5A7078,0xFF5B7379,0xFF60787E,
+   0xFF374D53,0xFF42595F,0xFF5B747A,0xFF5B757B,0xFF5C747C,0xFF5D737D,0xFF5D737E,
+   0xFF5D737E,0xFF546873,0xFF607480,0xFF617581,0xFF607580,0xFF566975,0xFF41525D,
+   0xFF31404C,0xFF313F4B,0xFF3A4954,0xFF41505C,0xFF404F5A,0xFF3F4F59,0xFF3F515A,
+   0xFF3F5359,0xFF41555B,0xFF40565A,0xFF3E5458,0xFF3B5155,0xFF374D52,0xFF33494F,
+   0xFF30444B,0xFF2B3F46,0xFF263940,0xFF213238,0xFF1C2B31,0xFF19262D,0xFF18232A,
+   0xFF172329,0xFF172329,0xFF273A40,0xFF486066,0xFF5C747B,0xFF5A7278,0xFF597078,
+   0xFF597077,0xFF587076,0xFF577175,0xFF577175,0xFF587276,0xFF485F65,0xFF2D3F47,
+   0xFF4D636B,0xFF5E737C,0xFF5D717B,0xFF5E707C,0xFF5E707C,0xFF5E707D,0xFF5E707D,
+   0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5F6F7E,0xFF5F6F7F,0xFF5E6E7E,0xFF5D6E7D,
+   0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5E6F7E,0xFF606F7F,0xFF627282,0xFF6A7B8B,
+   0xFF667686,0xFF465465,0xFF2E394E,0xFF47556C,0xFF5F6F86,0xFF5F6E86,0xFF5F6F86,
+   0xFF5F6E86,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,
+   0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6C84,0xFF5D6B84,0xFF5D6B84,
+   0xFF5D6B84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,
+   0xFF5E6D85,0xFF62738A,0xFF3C4A60,0xFF46586B,0xFF5D7586,0xFF5D7785,0xFF5C7784,
+   0xFF5C7784,0xFF5C7883,0xFF5B7882,0xFF516E75,0xFF5D7B82,0xFF5E7C83,0xFF5C7B81,
+   0xFF527076,0xFF3D585D,0xFF2E4549,0xFF2F4549,0xFF384F53,0xFF3F565C,0xFF3E555B,
+   0xFF3E565A,0xFF3F575D,0xFF40585D,0xFF405C5D,0xFF3E5E59,0xFF3B5E56,0xFF385953,
+   0xFF34544E,0xFF304E4B,0xFF2D4849,0xFF294143,0xFF243B3C,0xFF1F3435,0xFF1B2C2F,
+   0xFF172729,0xFF152527,0xFF152426,0xFF152527,0xFF263F43,0xFF456268,0xFF5A757D,
+   0xFF58727C,0xFF58707C,0xFF586F7C,0xFF586F7D,0xFF596F7D,0xFF596F7D,0xFF59707D,
+   0xFF48606B,0xFF2D434C,0xFF4A6667,0xFF587873,0xFF557870,0xFF557870,0xFF557870,
+   0xFF557870,0xFF567871,0xFF567771,0xFF567772,0xFF567771,0xFF54796F,0xFF54796E,
+   0xFF54776F,0xFF557571,0xFF577374,0xFF597276,0xFF5A7179,0xFF5C717B,0xFF5E717D,
+   0xFF627281,0xFF6B7A8C,0xFF667587,0xFF4A576A,0xFF374355,0xFF394556,0xFF5F6D7F,
+   0xFF617081,0xFF617081,0xFF606F80,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7E,0xFF5F6F7E,
+   0xFF5E707D,0xFF5E707D,0xFF5E707C,0xFF5D707C,0xFF5D717C,0xFF5C707B,0xFF5B6F79,
+   0xFF5A6F79,0xFF5A6F79,0xFF5A7078,0xFF5A7078,0xFF5A7178,0xFF5A7178,0xFF5A7177,
+   0xFF5A7177,0xFF597277,0xFF587276,0xFF617A80,0xFF4E656C,0xFF30444B,0xFF465D63,
+   0xFF597379,0xFF5C757D,0xFF5D747E,0xFF5E747F,0xFF50646E,0xFF546772,0xFF5D717C,
+   0xFF546873,0xFF435660,0xFF35454F,0xFF374751,0xFF465760,0xFF54646E,0xFF5C6C76,
+   0xFF5F6E78,0xFF5E6D77,0xFF5D6F77,0xFF5C7075,0xFF5C7075,0xFF5F7378,0xFF607579,
+   0xFF5F7579,0xFF5F7579,0xFF5E7478,0xFF5C7275,0xFF576E71,0xFF50676A,0xFF475E61,
+   0xFF3B5256,0xFF30464A,0xFF273A40,0xFF203037,0xFF1A282E,0xFF162329,0xFF24353B,
+   0xFF435B60,0xFF5D767B,0xFF5C757B,0xFF5B737A,0xFF5A7178,0xFF597077,0xFF587176,
+   0xFF587176,0xFF465E63,0xFF2B3F45,0xFF42585E,0xFF5B7379,0xFF5C727A,0xFF5C717B,
+   0xFF5D717B,0xFF5D707C,0xFF5E707C,0xFF5E707D,0xFF5E707E,0xFF5F6F7E,0xFF5F6F7E,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF5E6F7E,0xFF5D6E7D,0xFF5D6E7D,0xFF5E6E7E,0xFF5F6F7F,
+   0xFF607080,0xFF616F80,0xFF616F80,0xFF617081,0xFF687789,0xFF677688,0xFF3D4A5D,
+   0xFF3A475E,0xFF5D6D83,0xFF5F6F86,0xFF5F6F86,0xFF5F6E86,0xFF5E6D85,0xFF5E6D85,
+   0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,
+   0xFF5E6C84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6C84,
+   0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,0xFF64748B,0xFF526178,
+   0xFF344359,0xFF485D6E,0xFF5B7583,0xFF5D7885,0xFF5D7885,0xFF5D7985,0xFF4E6972,
+   0xFF516D74,0xFF59777E,0xFF516E75,0xFF415C63,0xFF334C53,0xFF374E53,0xFF465F62,
+   0xFF536E71,0xFF5B7579,0xFF5E787C,0xFF5D777B,0xFF5E777C,0xFF5E777C,0xFF5E787B,
+   0xFF5E7D7C,0xFF5E817A,0xFF5D817A,0xFF5E807B,0xFF5D7F7A,0xFF5B7C79,0xFF587676,
+   0xFF516E6F,0xFF476463,0xFF3A5755,0xFF2D4947,0xFF243E3B,0xFF1D3232,0xFF18292B,
+   0xFF152427,0xFF223B3E,0xFF405F62,0xFF5A767D,0xFF5A757E,0xFF59737D,0xFF58717C,
+   0xFF57707B,0xFF58707C,0xFF57707B,0xFF475E6A,0xFF2D424D,0xFF425A60,0xFF587575,
+   0xFF567772,0xFF557870,0xFF557871,0xFF567771,0xFF567871,0xFF567772,0xFF567771,
+   0xFF567771,0xFF557870,0xFF54796E,0xFF54796F,0xFF557771,0xFF567571,0xFF567473,
+   0xFF597276,0xFF5B7279,0xFF5D727C,0xFF5F717E,0xFF60707F,0xFF616F81,0xFF687789,
+   0xFF6C7B8D,0xFF536274,0xFF313D4E,0xFF505D6E,0xFF627182,0xFF617080,0xFF607080,
+   0xFF5F707F,0xFF5F6F7F,0xFF5F6F7E,0xFF5E707E,0xFF5E707D,0xFF5E707D,0xFF5E707C,
+   0xFF5D717C,0xFF5D717C,0xFF5C707A,0xFF5B6F79,0xFF5A7078,0xFF5A7078,0xFF5A7078,
+   0xFF5A7078,0xFF5A7078,0xFF5A7178,0xFF5A7177,0xFF597177,0xFF597177,0xFF597177,
+   0xFF5C757A,0xFF627B81,0xFF40575D,0xFF2D4147,0xFF3F565C,0xFF4E666D,0xFF526771,
+   0xFF4C616B,0xFF2D3C45,0xFF394B55,0xFF384954,0xFF30404A,0xFF36464F,0xFF4D5E67,
+   0xFF60717A,0xFF62737C,0xFF5F6F78,0xFF5C6B75,0xFF5A6A73,0xFF596A72,0xFF586A71,
+   0xFF586A70,0xFF586B70,0xFF586D71,0xFF576C70,0xFF576C70,0xFF586D71,0xFF586E71,
+   0xFF596F72,0xFF5A7373,0xFF5E7776,0xFF607979,0xFF61797A,0xFF5A7274,0xFF4D6468,
+   0xFF3E5358,0xFF30444A,0xFF24363B,0xFF1F3035,0xFF32484D,0xFF536C71,0xFF5D777C,
+   0xFF5E767C,0xFF5D747C,0xFF5C737A,0xFF597177,0xFF455C62,0xFF293C43,0xFF394E55,
+   0xFF5B7279,0xFF5C737A,0xFF5C727A,0xFF5C727A,0xFF5D717B,0xFF5D717C,0xFF5E707C,
+   0xFF5E707D,0xFF5F6F7E,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF606F7F,0xFF607180,
+   0xFF607180,0xFF606F80,0xFF606F80,0xFF616F80,0xFF616F80,0xFF616F81,0xFF616F81,
+   0xFF616F81,0xFF617081,0xFF6A798B,0xFF576678,0xFF323E53,0xFF4F5E75,0xFF607087,
+   0xFF5F6F86,0xFF5F6E86,0xFF5E6E85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,
+   0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6C84,0xFF5D6B84,0xFF5D6B84,
+   0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,
+   0xFF5D6C84,0xFF5D6C84,0xFF5F6F86,0xFF64768B,0xFF45556B,0xFF304154,0xFF415665,
+   0xFF4F6776,0xFF526A78,0xFF4B6470,0xFF2C3F48,0xFF374F57,0xFF354E56,0xFF2F474F,
+   0xFF364E55,0xFF4E656D,0xFF627981,0xFF637C82,0xFF60787E,0xFF5C7479,0xFF5A7377,
+   0xFF597276,0xFF597276,0xFF597276,0xFF597376,0xFF587675,0xFF567772,0xFF557771,
+   0xFF567872,0xFF567973,0xFF587A74,0xFF5B7C78,0xFF5F7F7D,0xFF628280,0xFF628280,
+   0xFF5A7B77,0xFF4C6D68,0xFF3B5A57,0xFF2E4948,0xFF223938,0xFF1D3333,0xFF314C4F,
+   0xFF526C75,0xFF5B767F,0xFF5B767F,0xFF5A747E,0xFF59737D,0xFF58717B,0xFF455D68,
+   0xFF2B3F4B,0xFF395058,0xFF597476,0xFF587675,0xFF577673,0xFF567772,0xFF577673,
+   0xFF577673,0xFF577772,0xFF577673,0xFF567771,0xFF567771,0xFF557870,0xFF54796F,
+   0xFF567871,0xFF587874,0xFF597776,0xFF597676,0xFF5A7477,0xFF5C737A,0xFF5E727C,
+   0xFF5F717E,0xFF60707F,0xFF616F81,0xFF617081,0xFF697889,0xFF6C7C8D,0xFF435061,
+   0xFF384455,0xFF5E6D7E,0xFF617080,0xFF607180,0xFF607181,0xFF607080,0xFF5F707F,
+   0xFF5E707E,0xFF5E707D,0xFF5E707D,0xFF5D707C,0xFF5D717C,0xFF5D717B,0xFF5C707A,
+   0xFF5A6F79,0xFF5A6F79,0xFF5A7078,0xFF5A7078,0xFF5A7077,0xFF5A7077,0xFF5A7177,
+   0xFF597177,0xFF597177,0xFF597177,0xFF597177,0xFF597276,0xFF5F797E,0xFF587176,
+   0xFF31464C,0xFF24363B,0xFF2D4247,0xFF30434B,0xFF2B3B45,0xFF1C2830,0xFF222F38,
+   0xFF2E3D47,0xFF475861,0xFF5B6D75,0xFF5F7078,0xFF5D6E76,0xFF5B6C74,0xFF596A72,
+   0xFF596A72,0xFF596A72,0xFF596A72,0xFF596B71,0xFF596C72,0xFF596C71,0xFF586D71,
+   0xFF576C70,0xFF576C70,0xFF576C70,0xFF566D6F,0xFF566E6E,0xFF566F6E,0xFF56706E,
+   0xFF56706E,0xFF597171,0xFF5D7475,0xFF61787A,0xFF62797B,0xFF5C7275,0xFF4D6367,
+   0xFF364B4F,0xFF27393F,0xFF2E4147,0xFF475D63,0xFF526B71,0xFF51686E,0xFF4D646B,
+   0xFF3F555B,0xFF293B42,0xFF384C53,0xFF596F78,0xFF5E747D,0xFF5D737B,0xFF5D737B,
+   0xFF5C727A,0xFF5C727A,0xFF5D707C,0xFF5E707D,0xFF5E707E,0xFF5F6F7F,0xFF5F6F7F,
+   0xFF5F6F7F,0xFF607180,0xFF627282,0xFF637383,0xFF637383,0xFF627283,0xFF617081,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF637283,
+   0xFF6B7B8C,0xFF435163,0xFF39465D,0xFF5D6C84,0xFF5F6F86,0xFF5F6F86,0xFF5F6F87,
+   0xFF5F6E86,0xFF5E6E86,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,
+   0xFF5E6D85,0xFF5E6C84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,
+   0xFF5D6B84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,0xFF5D6C83,
+   0xFF627489,0xFF5B6D82,0xFF354659,0xFF273644,0xFF2F414E,0xFF314451,0xFF2A3D48,
+   0xFF1B2932,0xFF21313A,0xFF2E434C,0xFF486068,0xFF5D757C,0xFF627781,0xFF60747F,
+   0xFF5D737C,0xFF5B7279,0xFF5A7278,0xFF5A7278,0xFF5A7278,0xFF5A7378,0xFF5A7378,
+   0xFF5A7478,0xFF597577,0xFF567673,0xFF557771,0xFF557771,0xFF547870,0xFF547970,
+   0xFF577873,0xFF587874,0xFF587975,0xFF597A76,0xFF5D7E79,0xFF62827F,0xFF638281,
+   0xFF5C7C7A,0xFF4C6C68,0xFF33524C,0xFF243D3C,0xFF2D444A,0xFF455F67,0xFF516C74,
+   0xFF4F6972,0xFF4C656F,0xFF3F5762,0xFF2B3F4A,0xFF384E57,0xFF577175,0xFF5A7777,
+   0xFF597676,0xFF587675,0xFF587674,0xFF587674,0xFF577673,0xFF577673,0xFF567772,
+   0xFF567871,0xFF557870,0xFF54796F,0xFF557B70,0xFF587B74,0xFF5B7A78,0xFF5C7979,
+   0xFF5B7879,0xFF5B7579,0xFF5D747B,0xFF5E737C,0xFF5F727E,0xFF60717F,0xFF617081,
+   0xFF617081,0xFF627182,0xFF687788,0xFF5D6C7D,0xFF2F3A4A,0xFF526071,0xFF617181,
+   0xFF607181,0xFF607181,0xFF607180,0xFF5F7280,0xFF5F727F,0xFF5F727F,0xFF5E717E,
+   0xFF5E717D,0xFF5D717C,0xFF5C707B,0xFF5B6F79,0xFF5A6F79,0xFF5A6F79,0xFF5A6F79,
+   0xFF5A7078,0xFF5A7078,0xFF5A7078,0xFF5A7077,0xFF5A7177,0xFF5A7177,0xFF597177,
+   0xFF597276,0xFF587276,0xFF597377,0xFF5F797D,0xFF415A5E,0xFF23353A,0xFF17242A,
+   0xFF19252C,0xFF17232B,0xFF1A262E,0xFF2D3F47,0xFF4C5D66,0xFF5E6F77,0xFF5B6D73,
+   0xFF596B72,0xFF596B72,0xFF596B72,0xFF596B72,0xFF596B72,0xFF596C72,0xFF596B72,
+   0xFF5A6B73,0xFF5A6C72,0xFF596D72,0xFF586D71,0xFF576C71,0xFF576C70,0xFF576C71,
+   0xFF576D70,0xFF576E6F,0xFF57706F,0xFF56706E,0xFF56716D,0xFF57706F,0xFF586F70,
+   0xFF586F70,0xFF597171,0xFF5D7576,0xFF63797C,0xFF62787C,0xFF51666B,0xFF374B50,
+   0xFF283B40,0xFF2D4247,0xFF2F4449,0xFF2C3E45,0xFF273940,0xFF364A51,0xFF586E76,
+   0xFF5F747D,0xFF5E727C,0xFF5D737B,0xFF5D727C,0xFF5E727C,0xFF5D727C,0xFF5E717D,
+   0xFF5E707E,0xFF5F707E,0xFF5F6F7F,0xFF607180,0xFF617282,0xFF627483,0xFF637383,
+   0xFF637384,0xFF637384,0xFF627283,0xFF617182,0xFF617081,0xFF617081,0xFF617081,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF677687,0xFF5D6C7E,0xFF303C51,
+   0xFF516077,0xFF607087,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,
+   0xFF5F6F87,0xFF5F6E86,0xFF5E6E86,0xFF5E6D85,0xFF5E6C84,0xFF5D6B84,0xFF5D6B84,
+   0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6C84,
+   0xFF5D6C84,0xFF5D6C84,0xFF5D6C84,0xFF5C6D83,0xFF5D6E82,0xFF627488,0xFF45586B,
+   0xFF263543,0xFF18242D,0xFF19252E,0xFF18232C,0xFF1A262F,0xFF2F424A,0xFF4D646B,
+   0xFF5F777E,0xFF5D737C,0xFF5D717B,0xFF5D707C,0xFF5D717B,0xFF5C727A,0xFF5B7279,
+   0xFF5B7379,0xFF5B7279,0xFF5B7379,0xFF5B747A,0xFF5B7479,0xFF5A7577,0xFF577674,
+   0xFF567772,0xFF557871,0xFF54796F,0xFF547A70,0xFF577973,0xFF577974,0xFF577973,
+   0xFF577973,0xFF587874,0xFF597876,0xFF5A7978,0xFF5E7E7B,0xFF638580,0xFF60847D,
+   0xFF4F706A,0xFF34514E,0xFF263D40,0xFF2D444A,0xFF2F464E,0xFF2C424A,0xFF283D46,
+   0xFF364C53,0xFF576F74,0xFF5D767A,0xFF5A7577,0xFF597676,0xFF597775,0xFF597775,
+   0xFF587675,0xFF577773,0xFF567772,0xFF557870,0xFF557970,0xFF567A71,0xFF567D71,
+   0xFF577D73,0xFF597C76,0xFF5B7A78,0xFF5C797A,0xFF5B7879,0xFF5C7679,0xFF5D747B,
+   0xFF5E737D,0xFF5F727E,0xFF607180,0xFF617081,0xFF617081,0xFF617081,0xFF627182,
+   0xFF687789,0xFF394555,0xFF404C5D,0xFF617081,0xFF607181,0xFF607181,0xFF607180,
+   0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF5E727E,0xFF5E737E,0xFF5E737E,0xFF5D717C,
+   0xFF5C707A,0xFF5B6F79,0xFF5B6F79,0xFF5B6F79,0xFF5B6F79,0xFF5A6F79,0xFF5A6F78,
+   0xFF5A7077,0xFF597177,0xFF5A7177,0xFF597177,0xFF587276,0xFF587275,0xFF577074,
+   0xFF5C767A,0xFF536E71,0xFF2F4549,0xFF19272C,0xFF172229,0xFF172129,0xFF212F37,
+   0xFF3B4E55,0xFF586A71,0xFF5A6C72,0xFF596C71,0xFF596C71,0xFF596C71,0xFF596C72,
+   0xFF596C72,0xFF596D72,0xFF596D72,0xFF596C72,0xFF5A6C72,0xFF5A6C73,0xFF5A6C73,
+   0xFF596C72,0xFF586C71,0xFF576C71,0xFF586C71,0xFF586D71,0xFF586E70,0xFF58706F,
+   0xFF57706E,0xFF56706E,0xFF57706F,0xFF586F70,0xFF586F70,0xFF586F70,0xFF586F70,
+   0xFF5A7072,0xFF5D7375,0xFF63797C,0xFF62797C,0xFF42595D,0xFF283B40,0xFF1A282E,
+   0xFF1A262D,0xFF2E4148,0xFF4F666D,0xFF5F757C,0xFF5D737B,0xFF5D727C,0xFF5E727C,
+   0xFF5E727C,0xFF5E727D,0xFF5E727D,0xFF5E727D,0xFF5F717F,0xFF5F717F,0xFF617281,
+   0xFF627383,0xFF627483,0xFF627483,0xFF637384,0xFF637384,0xFF637384,0xFF637384,
+   0xFF627183,0xFF617082,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,
+   0xFF617081,0xFF627182,0xFF687788,0xFF394658,0xFF414E64,0xFF5F6F87,0xFF5F6F87,
+   0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,
+   0xFF5F6F87,0xFF5E6D85,0xFF5D6C84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,
+   0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6C83,0xFF5D6C83,0xFF5D6C83,
+   0xFF5C6C82,0xFF5B6B80,0xFF5F7185,0xFF566A7C,0xFF324453,0xFF1A252E,0xFF17222A,
+   0xFF17212A,0xFF23303A,0xFF3E525C,0xFF5B7179,0xFF5D727B,0xFF5D717B,0xFF5D717C,
+   0xFF5D727C,0xFF5D717B,0xFF5C727A,0xFF5C737A,0xFF5B737A,0xFF5B7479,0xFF5B7479,
+   0xFF5B747A,0xFF5A7478,0xFF597577,0xFF587575,0xFF577673,0xFF567872,0xFF557971,
+   0xFF557A71,0xFF567A72,0xFF577A73,0xFF567A72,0xFF567A72,0xFF587974,0xFF587875,
+   0xFF587875,0xFF587875,0xFF597976,0xFF5C7D78,0xFF62847F,0xFF638381,0xFF435E60,
+   0xFF283C40,0xFF1A292E,0xFF19282D,0xFF2C4446,0xFF4C6869,0xFF5C777A,0xFF5B7479,
+   0xFF5B7479,0xFF5A7677,0xFF5A7676,0xFF5A7677,0xFF597676,0xFF587774,0xFF577972,
+   0xFF557A71,0xFF567C72,0xFF587D73,0xFF577E72,0xFF587D74,0xFF597C76,0xFF5B7B77,
+   0xFF5C7A79,0xFF5C7979,0xFF5C777A,0xFF5D747B,0xFF5E737D,0xFF5F727E,0xFF607180,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF697889,0xFF4F5D6E,0xFF354050,
+   0xFF5E6C7E,0xFF617181,0xFF607180,0xFF5F7280,0xFF5F727F,0xFF5F727F,0xFF5F727E,
+   0xFF5E727E,0xFF5E737E,0xFF5E737E,0xFF5E737D,0xFF5D717C,0xFF5B707A,0xFF5B6F79,
+   0xFF5B6F79,0xFF5B6F79,0xFF5A6F79,0xFF5A7078,0xFF5A7077,0xFF597077,0xFF5A7178,
+   0xFF5A7178,0xFF587176,0xFF577074,0xFF566F72,0xFF587174,0xFF5D787B,0xFF3C5558,
+   0xFF1F3034,0xFF162228,0xFF19242C,0xFF2D3D45,0xFF495C63,0xFF5A6C72,0xFF596B72,
+   0xFF596C71,0xFF586C71,0xFF596D71,0xFF586D71,0xFF586D71,0xFF586D71,0xFF596D71,
+   0xFF5A6D72,0xFF5A6D72,0xFF5A6E73,0xFF5A6D73,0xFF596D72,0xFF596D72,0xFF596D72,
+   0xFF5A6D72,0xFF5A6E73,0xFF596E72,0xFF596F71,0xFF586F70,0xFF57706F,0xFF57706F,
+   0xFF586F70,0xFF596F71,0xFF586F71,0xFF586F70,0xFF596F71,0xFF5A6F72,0xFF597071,
+   0xFF5E7677,0xFF61787A,0xFF3F5358,0xFF25363C,0xFF1F2E35,0xFF3B5057,0xFF5A7077,
+   0xFF5D737B,0xFF5D737B,0xFF5D737B,0xFF5E727D,0xFF5E727D,0xFF5E717D,0xFF5E727D,
+   0xFF5E727E,0xFF5F727F,0xFF5F7280,0xFF617381,0xFF627483,0xFF627483,0xFF637383,
+   0xFF637384,0xFF637384,0xFF637384,0xFF637384,0xFF637284,0xFF627183,0xFF617082,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF697889,
+   0xFF4F5D6F,0xFF354155,0xFF5C6C83,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,
+   0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5E6D85,
+   0xFF5D6C84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,
+   0xFF5D6B84,0xFF5C6C83,0xFF5C6D83,0xFF5C6C82,0xFF5B6B81,0xFF5A6A7F,0xFF5B6C80,
+   0xFF607386,0xFF405363,0xFF212E38,0xFF172129,0xFF1A252E,0xFF2F404B,0xFF4D616B,
+   0xFF5E727C,0xFF5D717C,0xFF5D717C,0xFF5D717C,0xFF5D727C,0xFF5D717D,0xFF5C727B,
+   0xFF5B747A,0xFF5B7479,0xFF5B7578,0xFF5B7579,0xFF5B7579,0xFF5B7579,0xFF5A7578,
+   0xFF597676,0xFF587775,0xFF577973,0xFF567A72,0xFF567A72,0xFF567A72,0xFF577A73,
+   0xFF577A73,0xFF577A73,0xFF577973,0xFF587974,0xFF587875,0xFF597876,0xFF597876,
+   0xFF5A7976,0xFF597976,0xFF607F7D,0xFF648082,0xFF40585D,0xFF25373D,0xFF1E2F33,
+   0xFF375252,0xFF567372,0xFF5A7676,0xFF5A7577,0xFF5A7676,0xFF5A7677,0xFF5A7577,
+   0xFF5A7676,0xFF597775,0xFF587874,0xFF567A72,0xFF557B71,0xFF567D71,0xFF577E72,
+   0xFF577E73,0xFF597D75,0xFF597C76,0xFF5A7B77,0xFF5B7B77,0xFF5B7A79,0xFF5D787A,
+   0xFF5D757C,0xFF5E737D,0xFF5F727E,0xFF607180,0xFF617081,0xFF617081,0xFF617081,
+   0xFF617081,0xFF647485,0xFF627283,0xFF344051,0xFF515F70,0xFF617282,0xFF607180,
+   0xFF5F727F,0xFF5F727F,0xFF5F727E,0xFF5E727E,0xFF5E737E,0xFF5E737E,0xFF5E737D,
+   0xFF5E737D,0xFF5E737D,0xFF5C717B,0xFF5B7079,0xFF5A6F79,0xFF5A7078,0xFF5A7078,
+   0xFF5A7078,0xFF597077,0xFF597177,0xFF5A7077,0xFF597077,0xFF596F76,0xFF576F74,
+   0xFF566F72,0xFF567072,0xFF5D787A,0xFF496466,0xFF263B3E,0xFF172329,0xFF212E37,
+   0xFF3A4D55,0xFF566A6E,0xFF586C71,0xFF586C71,0xFF586C71,0xFF586C71,0xFF596D71,
+   0xFF586D71,0xFF586E70,0xFF586E70,0xFF586E70,0xFF596E71,0xFF596E72,0xFF5A6E73,
+   0xFF5A6E73,0xFF596E72,0xFF596E72,0xFF5A6D73,0xFF5A6E73,0xFF5A6E72,0xFF596E72,
+   0xFF596E72,0xFF596F71,0xFF586F70,0xFF586F70,0xFF586F70,0xFF586F70,0xFF586F70,
+   0xFF586F70,0xFF596F71,0xFF5A7072,0xFF597071,0xFF597072,0xFF617679,0xFF5D7276,
+   0xFF384C51,0xFF2A3C44,0xFF445962,0xFF5D737B,0xFF5D737B,0xFF5D737B,0xFF5E727C,
+   0xFF5E727C,0xFF5E727D,0xFF5E717D,0xFF5E727E,0xFF5F727F,0xFF5F7280,0xFF607280,
+   0xFF617381,0xFF627483,0xFF627483,0xFF637384,0xFF637384,0xFF637384,0xFF637383,
+   0xFF637384,0xFF637284,0xFF637284,0xFF627183,0xFF617082,0xFF617081,0xFF617081,
+   0xFF617081,0xFF617081,0xFF617081,0xFF647485,0xFF627283,0xFF344052,0xFF505E75,
+   0xFF607088,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,
+   0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5E6D85,0xFF5D6B84,0xFF5D6B84,
+   0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5D6B84,0xFF5C6C83,0xFF5C6C82,
+   0xFF5B6B81,0xFF5A6A7F,0xFF596B7E,0xFF596B7D,0xFF5F7385,0xFF4D6072,0xFF2A3945,
+   0xFF17222A,0xFF223139,0xFF3D515B,0xFF5A6F78,0xFF5D717C,0xFF5D707C,0xFF5E707C,
+   0xFF5D717D,0xFF5E717D,0xFF5E717E,0xFF5D727C,0xFF5C747A,0xFF5B7479,0xFF5B7678,
+   0xFF5B7678,0xFF5B7579,0xFF5B7579,0xFF5A7678,0xFF5A7777,0xFF587875,0xFF577973,
+   0xFF567A72,0xFF567A72,0xFF567A72,0xFF577A73,0xFF577A73,0xFF577A73,0xFF577A73,
+   0xFF577974,0xFF587875,0xFF597776,0xFF5A7777,0xFF5A7977,0xFF597976,0xFF5A7976,
+   0xFF627F80,0xFF607A7E,0xFF384F55,0xFF283D41,0xFF405C5D,0xFF587675,0xFF587774,
+   0xFF587774,0xFF587774,0xFF587774,0xFF587775,0xFF587873,0xFF577873,0xFF577973,
+   0xFF567A72,0xFF567B71,0xFF567C72,0xFF587D73,0xFF587D73,0xFF597D74,0xFF597C76,
+   0xFF5A7B76,0xFF5A7B77,0xFF5B7A78,0xFF5C787A,0xFF5E777D,0xFF5F747E,0xFF5F727E,
+   0xFF60717F,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF627182,0xFF687788,
+   0xFF3F4C5D,0xFF3B4757,0xFF5E6F7E,0xFF5F7280,0xFF5F727F,0xFF5F727E,0xFF5E727E,
+   0xFF5E737E,0xFF5E737E,0xFF5E737D,0xFF5E737D,0xFF5E737D,0xFF5D737D,0xFF5D737C,
+   0xFF5B727A,0xFF5A7078,0xFF5A7078,0xFF5A7078,0xFF5A7078,0xFF597077,0xFF597077,
+   0xFF597077,0xFF586F75,0xFF586E75,0xFF576E74,0xFF576F73,0xFF557072,0xFF597576,
+   0xFF526E70,0xFF2D4446,0xFF18252A,0xFF2A3B41,0xFF485D62,0xFF586E70,0xFF586C70,
+   0xFF586C71,0xFF586C71,0xFF586D70,0xFF586D70,0xFF586E6F,0xFF576E6F,0xFF586E6F,
+   0xFF586F6F,0xFF586F70,0xFF596E72,0xFF5A6E72,0xFF596E72,0xFF596E72,0xFF596E71,
+   0xFF596E72,0xFF596E72,0xFF596F71,0xFF596F71,0xFF596E71,0xFF596E72,0xFF596F71,
+   0xFF586F70,0xFF586F70,0xFF586F71,0xFF586F71,0xFF596F71,0xFF596F71,0xFF596F71,
+   0xFF597071,0xFF5A7072,0xFF5A6F73,0xFF63787C,0xFF4A5E64,0xFF2F424A,0xFF485C66,
+   0xFF5E737C,0xFF5D727C,0xFF5E727C,0xFF5E727C,0xFF5E727C,0xFF5E727D,0xFF5F717E,
+   0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF5F7280,0xFF607381,0xFF627483,0xFF627483,
+   0xFF637383,0xFF637384,0xFF637384,0xFF637383,0xFF637384,0xFF637284,0xFF637284,
+   0xFF637284,0xFF627183,0xFF617082,0xFF617081,0xFF617081,0xFF617081,0xFF617081,
+   0xFF627182,0xFF687788,0xFF3F4C5D,0xFF3B475C,0xFF5D6D85,0xFF5F6F87,0xFF5F6F87,
+   0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,
+   0xFF5F6F87,0xFF5F6E86,0xFF5E6D85,0xFF5D6B84,0xFF5D6B84,0xFF5D6B83,0xFF5D6B84,
+   0xFF5D6B84,0xFF5C6C83,0xFF5C6C82,0xFF5B6B81,0xFF5A6A80,0xFF5A6A7F,0xFF596B7E,
+   0xFF586B7D,0xFF5C7081,0xFF556A7B,0xFF31414F,0xFF1A252E,0xFF2C3E46,0xFF4C626A,
+   0xFF5D727C,0xFF5D717B,0xFF5D717C,0xFF5E707D,0xFF5E707D,0xFF5E717E,0xFF5E717E,
+   0xFF5D727C,0xFF5D737B,0xFF5C747A,0xFF5C757A,0xFF5B757A,0xFF5C757A,0xFF5C757A,
+   0xFF5B7679,0xFF5A7778,0xFF597776,0xFF587875,0xFF577973,0xFF567A72,0xFF567A72,
+   0xFF577A73,0xFF577A73,0xFF577A73,0xFF577A73,0xFF577974,0xFF587875,0xFF597776,
+   0xFF597777,0xFF597976,0xFF597976,0xFF597976,0xFF5B7878,0xFF658083,0xFF4B6469,
+   0xFF2E4548,0xFF44605F,0xFF587874,0xFF587873,0xFF587873,0xFF577873,0xFF567971,
+   0xFF567971,0xFF567A71,0xFF567A72,0xFF577A73,0xFF577A73,0xFF567A72,0xFF577C73,
+   0xFF597C75,0xFF587D74,0xFF597D75,0xFF597C75,0xFF597C76,0xFF5A7B77,0xFF5C7A79,
+   0xFF5D787B,0xFF5E777D,0xFF5F757F,0xFF60737F,0xFF607280,0xFF617081,0xFF617081,
+   0xFF617081,0xFF617081,0xFF617081,0xFF687889,0xFF4F5F6F,0xFF2F3D4C,0xFF4E5E6C,
+   0xFF607380,0xFF5F727E,0xFF5E727E,0xFF5E737E,0xFF5E737E,0xFF5E737E,0xFF5E737D,
+   0xFF5E737D,0xFF5E737D,0xFF5E737D,0xFF5E737D,0xFF5D727C,0xFF5B717A,0xFF5A7078,
+   0xFF5A7078,0xFF5A7077,0xFF5A7077,0xFF597077,0xFF586F76,0xFF576E75,0xFF586E75,
+   0xFF576E74,0xFF566F73,0xFF557072,0xFF577374,0xFF567173,0xFF30474A,0xFF1A272D,
+   0xFF304248,0xFF4F6367,0xFF586D6F,0xFF586D70,0xFF586C71,0xFF586C70,0xFF576D6F,
+   0xFF576F6E,0xFF566F6D,0xFF566F6D,0xFF576F6E,0xFF586F6F,0xFF586F70,0xFF596F71,
+   0xFF596E71,0xFF596E71,0xFF596E71,0xFF586F71,0xFF586F70,0xFF586F70,0xFF586F70,
+   0xFF586F71,0xFF596E71,0xFF596E72,0xFF596F71,0xFF586F70,0xFF586F71,0xFF586F71,
+   0xFF586F71,0xFF596F71,0xFF596F71,0xFF596F71,0xFF597071,0xFF5A6F72,0xFF596E71,
+   0xFF5D7275,0xFF5A6E73,0xFF34464E,0xFF435661,0xFF5E727D,0xFF5E727C,0xFF5E727C,
+   0xFF5E727C,0xFF5E727C,0xFF5E727D,0xFF5E727E,0xFF5F727F,0xFF5F727F,0xFF5F727F,
+   0xFF607280,0xFF617381,0xFF627483,0xFF627483,0xFF627483,0xFF637384,0xFF637384,
+   0xFF637384,0xFF637384,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF627183,
+   0xFF617082,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF687889,0xFF505E70,
+   0xFF303C4F,0xFF4E5D74,0xFF607088,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,
+   0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6E86,
+   0xFF5E6D85,0xFF5D6B84,0xFF5D6B83,0xFF5C6C83,0xFF5C6C83,0xFF5C6C82,0xFF5B6B81,
+   0xFF5A6A80,0xFF5A6A7F,0xFF596B7E,0xFF596B7E,0xFF596B7E,0xFF5B6E80,0xFF596D7E,
+   0xFF344554,0xFF1D2832,0xFF33464F,0xFF536871,0xFF5D717B,0xFF5D717C,0xFF5E707C,
+   0xFF5E707D,0xFF5E707D,0xFF5E717D,0xFF5E717E,0xFF5E717D,0xFF5E727C,0xFF5D737C,
+   0xFF5D747C,0xFF5C747B,0xFF5D747B,0xFF5D747C,0xFF5C747B,0xFF5C757A,0xFF5B7579,
+   0xFF5A7777,0xFF587875,0xFF577973,0xFF567A72,0xFF577A73,0xFF577A73,0xFF577A73,
+   0xFF577A73,0xFF577973,0xFF587974,0xFF587875,0xFF587875,0xFF587975,0xFF587A75,
+   0xFF597975,0xFF587875,0xFF5D7B7A,0xFF5B7679,0xFF324B4D,0xFF3E5B59,0xFF587873,
+   0xFF577873,0xFF577872,0xFF567972,0xFF567971,0xFF557A6F,0xFF557B70,0xFF557B71,
+   0xFF567A72,0xFF567A72,0xFF567A72,0xFF587B74,0xFF597C75,0xFF597D75,0xFF597D75,
+   0xFF597C75,0xFF597C76,0xFF5B7B78,0xFF5C797A,0xFF5D777B,0xFF5E767D,0xFF5F757F,
+   0xFF607480,0xFF617381,0xFF617082,0xFF617081,0xFF617081,0xFF617081,0xFF617081,
+   0xFF657586,0xFF5D6D7E,0xFF344352,0xFF3A4956,0xFF5D707C,0xFF5E727E,0xFF5E727E,
+   0xFF5E727E,0xFF5E727E,0xFF5E737E,0xFF5E737D,0xFF5E737D,0xFF5E737D,0xFF5E737E,
+   0xFF5F727F,0xFF5F717F,0xFF5D717D,0xFF5C717A,0xFF5B7079,0xFF5A7078,0xFF597077,
+   0xFF597076,0xFF586F75,0xFF576E74,0xFF576E74,0xFF576F73,0xFF567072,0xFF557071,
+   0xFF577274,0xFF546E71,0xFF2E4548,0xFF1B272D,0xFF33454B,0xFF506469,0xFF586C70,
+   0xFF586C70,0xFF596C71,0xFF596C71,0xFF576D6F,0xFF556F6D,0xFF56706D,0xFF55706D,
+   0xFF55706D,0xFF57706E,0xFF58706F,0xFF586F70,0xFF596F71,0xFF596E71,0xFF596F71,
+   0xFF586F70,0xFF57706F,0xFF57706F,0xFF58706F,0xFF586F70,0xFF596F71,0xFF596E71,
+   0xFF596E71,0xFF596E71,0xFF596F71,0xFF586F71,0xFF596F71,0xFF596F71,0xFF596F71,
+   0xFF586F71,0xFF596F71,0xFF596E71,0xFF596D71,0xFF596D72,0xFF62757B,0xFF43565F,
+   0xFF3C4E59,0xFF5D707B,0xFF5E727D,0xFF5E727C,0xFF5E727C,0xFF5E727D,0xFF5E727E,
+   0xFF5F727E,0xFF5F727F,0xFF5F7280,0xFF607180,0xFF607180,0xFF617282,0xFF627483,
+   0xFF627483,0xFF627483,0xFF637384,0xFF637384,0xFF637383,0xFF637284,0xFF637284,
+   0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF627183,0xFF617082,0xFF617081,
+   0xFF617081,0xFF617081,0xFF657586,0xFF5E6D7E,0xFF354254,0xFF3C495E,0xFF5E6D85,
+   0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,
+   0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F86,0xFF5E6E85,0xFF5D6D84,0xFF5D6C83,
+   0xFF5C6C83,0xFF5C6C82,0xFF5B6C81,0xFF5B6B80,0xFF5A6A7F,0xFF5A6A7F,0xFF596B7E,
+   0xFF596B7E,0xFF596B7E,0xFF5B6D80,0xFF576A7D,0xFF334352,0xFF1E2933,0xFF354852,
+   0xFF546872,0xFF5D707C,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707C,0xFF5E717D,
+   0xFF5F717E,0xFF5E717E,0xFF5D727D,0xFF5E737D,0xFF5E737E,0xFF5E737D,0xFF5E737D,
+   0xFF5E737D,0xFF5E737D,0xFF5D737D,0xFF5E737D,0xFF5D747C,0xFF5B7679,0xFF597776,
+   0xFF587974,0xFF577973,0xFF577973,0xFF577A73,0xFF577973,0xFF577A73,0xFF577973,
+   0xFF577974,0xFF587974,0xFF577973,0xFF577973,0xFF577873,0xFF577773,0xFF597775,
+   0xFF627F7F,0xFF405B5D,0xFF375251,0xFF567672,0xFF577872,0xFF567971,0xFF567A71,
+   0xFF557A70,0xFF557B70,0xFF557B70,0xFF557B70,0xFF557B70,0xFF567B71,0xFF567B72,
+   0xFF577B73,0xFF597C75,0xFF597C76,0xFF5A7C76,0xFF5A7B76,0xFF5A7B76,0xFF5B7B78,
+   0xFF5C797A,0xFF5E777C,0xFF5F767E,0xFF60757F,0xFF617480,0xFF617382,0xFF627183,
+   0xFF617082,0xFF617081,0xFF617081,0xFF617081,0xFF627182,0xFF687989,0xFF435462,
+   0xFF31404C,0xFF546671,0xFF5F737E,0xFF5E727E,0xFF5F727F,0xFF5E727E,0xFF5E737D,
+   0xFF5D737D,0xFF5D737D,0xFF5E737D,0xFF5F727F,0xFF5F707F,0xFF5F707F,0xFF5E707E,
+   0xFF5E707C,0xFF5D717B,0xFF5B7179,0xFF5A7077,0xFF597076,0xFF587076,0xFF586F75,
+   0xFF576F74,0xFF566F73,0xFF566F72,0xFF567072,0xFF587375,0xFF4B6468,0xFF293D42,
+   0xFF18252B,0xFF304247,0xFF4D6065,0xFF586B70,0xFF586C70,0xFF586D70,0xFF576D70,
+   0xFF566E6E,0xFF556F6D,0xFF566F6D,0xFF55706D,0xFF55706C,0xFF56706D,0xFF57706F,
+   0xFF57706F,0xFF57706F,0xFF596F71,0xFF586F70,0xFF57706F,0xFF58706F,0xFF57706F,
+   0xFF57706F,0xFF587070,0xFF586F70,0xFF596F71,0xFF596E71,0xFF596D71,0xFF596D71,
+   0xFF596E72,0xFF5A6E72,0xFF596E72,0xFF596E71,0xFF586F71,0xFF586E70,0xFF586D71,
+   0xFF596C72,0xFF5A6C72,0xFF607279,0xFF546770,0xFF384955,0xFF566A75,0xFF5E727C,
+   0xFF5E727C,0xFF5E727C,0xFF5E727D,0xFF5E727E,0xFF5F727F,0xFF5F7280,0xFF607181,
+   0xFF607181,0xFF607181,0xFF617282,0xFF627383,0xFF637383,0xFF637383,0xFF637383,
+   0xFF637383,0xFF637383,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,
+   0xFF637284,0xFF637284,0xFF627183,0xFF617082,0xFF617081,0xFF617081,0xFF627182,
+   0xFF69788A,0xFF445264,0xFF334054,0xFF55647B,0xFF607087,0xFF5F6F87,0xFF5F6F87,
+   0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6E86,
+   0xFF5E6E85,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6D83,0xFF5C6C82,0xFF5B6C81,
+   0xFF5B6C81,0xFF5A6B80,0xFF5A6A7F,0xFF596B7E,0xFF5A6A7F,0xFF5A6A7F,0xFF5C6D81,
+   0xFF4E6174,0xFF2D3B49,0xFF1B2530,0xFF33444F,0xFF516470,0xFF5E6F7D,0xFF5F6F7E,
+   0xFF5E707D,0xFF5D717C,0xFF5D717C,0xFF5E717E,0xFF5F707F,0xFF5E717E,0xFF5D727D,
+   0xFF5E727E,0xFF5F727E,0xFF5F727E,0xFF5E737E,0xFF5E737E,0xFF5E737D,0xFF5E727E,
+   0xFF5F727F,0xFF5E727E,0xFF5D747C,0xFF5B7679,0xFF597876,0xFF587875,0xFF587874,
+   0xFF577873,0xFF577873,0xFF577974,0xFF577974,0xFF577973,0xFF577973,0xFF577973,
+   0xFF577873,0xFF577772,0xFF577773,0xFF587674,0xFF5F7D7C,0xFF526E6F,0xFF334D4E,
+   0xFF50706C,0xFF567971,0xFF557A70,0xFF557A70,0xFF557A70,0xFF557B70,0xFF557B71,
+   0xFF557B71,0xFF567B71,0xFF567B71,0xFF567A72,0xFF577B73,0xFF597C75,0xFF5A7B77,
+   0xFF5B7A78,0xFF5B7A78,0xFF5B7A78,0xFF5C7A79,0xFF5D787B,0xFF5E777C,0xFF5F767E,
+   0xFF607580,0xFF617480,0xFF627382,0xFF637284,0xFF627183,0xFF627182,0xFF617081,
+   0xFF617081,0xFF617081,0xFF677887,0xFF5D6F7D,0xFF344450,0xFF41525D,0xFF5E737D,
+   0xFF5E737D,0xFF5F727E,0xFF5F727E,0xFF5E737D,0xFF5D737D,0xFF5D737D,0xFF5E727D,
+   0xFF5E717E,0xFF5F707E,0xFF5F6F7E,0xFF5F6F7E,0xFF5E707D,0xFF5D717B,0xFF5B7179,
+   0xFF597077,0xFF597076,0xFF587076,0xFF587076,0xFF576F75,0xFF566F73,0xFF567072,
+   0xFF567072,0xFF577174,0xFF3B5658,0xFF203336,0xFF162428,0xFF2B3F42,0xFF485E61,
+   0xFF566B6E,0xFF576D6F,0xFF566E6E,0xFF566E6E,0xFF576D6F,0xFF576D6F,0xFF576E6F,
+   0xFF566F6E,0xFF55706D,0xFF56706E,0xFF57706F,0xFF56706E,0xFF57706E,0xFF58706F,
+   0xFF57706F,0xFF58716F,0xFF597170,0xFF58716F,0xFF57716F,0xFF57706F,0xFF576F6F,
+   0xFF576E6F,0xFF586D70,0xFF586D71,0xFF596D72,0xFF596D72,0xFF5A6E72,0xFF5A6E73,
+   0xFF596E72,0xFF596E71,0xFF586D71,0xFF596D71,0xFF5A6C72,0xFF5A6B73,0xFF5D6F76,
+   0xFF576973,0xFF354753,0xFF50646E,0xFF5E737C,0xFF5E727C,0xFF5E717D,0xFF5E727E,
+   0xFF5F727F,0xFF5F7280,0xFF5F7280,0xFF607181,0xFF617081,0xFF617082,0xFF627183,
+   0xFF637383,0xFF637383,0xFF627483,0xFF637383,0xFF637384,0xFF637384,0xFF637284,
+   0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,
+   0xFF627182,0xFF617081,0xFF617081,0xFF617081,0xFF687788,0xFF5F6E7F,0xFF364355,
+   0xFF435167,0xFF5F6F86,0xFF5F6F86,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,
+   0xFF5F6F87,0xFF5F6F87,0xFF5E6E86,0xFF5E6D85,0xFF5E6D85,0xFF5E6D84,0xFF5D6E84,
+   0xFF5D6E84,0xFF5D6D83,0xFF5B6C82,0xFF5B6C82,0xFF5B6C81,0xFF5B6C80,0xFF5A6B7F,
+   0xFF596B7F,0xFF5A6A7F,0xFF5A6A7F,0xFF5B6C80,0xFF405263,0xFF24303C,0xFF19232D,
+   0xFF30404C,0xFF4F606D,0xFF5E6E7D,0xFF5F6F7E,0xFF5E707D,0xFF5D707C,0xFF5D717C,
+   0xFF5E707D,0xFF5E707F,0xFF5E707E,0xFF5D717D,0xFF5D737D,0xFF5E737E,0xFF5E737D,
+   0xFF5D747C,0xFF5D747C,0xFF5D747C,0xFF5E747E,0xFF60747F,0xFF5F737F,0xFF5E747D,
+   0xFF5C757A,0xFF5A7678,0xFF597676,0xFF587775,0xFF577774,0xFF577873,0xFF577874,
+   0xFF587974,0xFF577974,0xFF587974,0xFF587974,0xFF577873,0xFF577773,0xFF577773,
+   0xFF587674,0xFF5C7979,0xFF557273,0xFF304B4C,0xFF496965,0xFF567A71,0xFF557A70,
+   0xFF557A70,0xFF557B70,0xFF557B70,0xFF557B71,0xFF567A72,0xFF577A73,0xFF567A72,
+   0xFF577A73,0xFF597A75,0xFF5A7B77,0xFF5B7A79,0xFF5C7A79,0xFF5C797A,0xFF5D797B,
+   0xFF5E787C,0xFF5E777C,0xFF5F767D,0xFF5F757F,0xFF607580,0xFF617480,0xFF627482,
+   0xFF637284,0xFF637284,0xFF627182,0xFF617081,0xFF617081,0xFF617081,0xFF617281,
+   0xFF6A7C8A,0xFF4A5C69,0xFF2F3E4A,0xFF4D606B,0xFF5E737D,0xFF5F727E,0xFF5E727E,
+   0xFF5E737D,0xFF5D737D,0xFF5D737C,0xFF5D717C,0xFF5E707D,0xFF5E707D,0xFF5F6F7E,
+   0xFF5E707D,0xFF5D717C,0xFF5C717B,0xFF5A7079,0xFF597077,0xFF597077,0xFF587076,
+   0xFF587076,0xFF587075,0xFF567073,0xFF567072,0xFF567273,0xFF506B6C,0xFF2D4747,
+   0xFF23393A,0xFF1E3033,0xFF273A3D,0xFF455B5D,0xFF556B6D,0xFF566D6E,0xFF566E6E,
+   0xFF576D6F,0xFF576D6F,0xFF586C70,0xFF586E70,0xFF586F70,0xFF58706F,0xFF587070,
+   0xFF586F70,0xFF57706F,0xFF58706F,0xFF58706F,0xFF57706F,0xFF587170,0xFF597270,
+   0xFF597270,0xFF58726F,0xFF58706F,0xFF576F6F,0xFF576E6F,0xFF586D70,0xFF596D71,
+   0xFF596D71,0xFF586D71,0xFF596E71,0xFF5A6E73,0xFF5A6E72,0xFF596E72,0xFF596D71,
+   0xFF596C72,0xFF5A6C73,0xFF5A6C73,0xFF5D6E76,0xFF586973,0xFF344450,0xFF495C67,
+   0xFF5D737C,0xFF5D727C,0xFF5E717D,0xFF5F727E,0xFF5F727F,0xFF607180,0xFF607180,
+   0xFF607181,0xFF617081,0xFF617082,0xFF627183,0xFF637383,0xFF637383,0xFF637383,
+   0xFF637384,0xFF637384,0xFF637384,0xFF637284,0xFF637284,0xFF637284,0xFF637284,
+   0xFF637284,0xFF637284,0xFF637284,0xFF627183,0xFF627182,0xFF617081,0xFF617081,
+   0xFF617081,0xFF627182,0xFF6B7B8C,0xFF4C5A6C,0xFF313E52,0xFF4F5E75,0xFF5F6F86,
+   0xFF5F6F86,0xFF5F6F87,0xFF5F6F87,0xFF5F6F87,0xFF5F6E86,0xFF5E6D85,0xFF5E6D85,
+   0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5D6E84,0xFF5D6E83,0xFF5C6D82,0xFF5B6C82,
+   0xFF5B6C81,0xFF5B6C81,0xFF5B6C81,0xFF5B6C81,0xFF5A6B80,0xFF5A6A7F,0xFF5B6B80,
+   0xFF55667A,0xFF334251,0xFF27343F,0xFF212C37,0xFF2B3945,0xFF4C5D6B,0xFF5D6E7C,
+   0xFF5E6F7D,0xFF5E707D,0xFF5D707C,0xFF5D717C,0xFF5D717C,0xFF5E727D,0xFF5F727E,
+   0xFF5F737E,0xFF5E747D,0xFF5D747C,0xFF5C747B,0xFF5C757A,0xFF5C757B,0xFF5D747C,
+   0xFF5F747E,0xFF60757F,0xFF60757F,0xFF5F757D,0xFF5C757B,0xFF5B7479,0xFF5A7578,
+   0xFF597677,0xFF587774,0xFF577774,0xFF577774,0xFF587874,0xFF587974,0xFF587974,
+   0xFF587974,0xFF577873,0xFF577773,0xFF587774,0xFF587675,0xFF5B7978,0xFF557372,
+   0xFF2E4A48,0xFF42625D,0xFF577972,0xFF567871,0xFF557971,0xFF567A71,0xFF567A71,
+   0xFF567A72,0xFF577A72,0xFF587974,0xFF577973,0xFF577973,0xFF597975,0xFF5B7978,
+   0xFF5C797A,0xFF5D797B,0xFF5E787C,0xFF5E777D,0xFF5F767F,0xFF60757F,0xFF60757F,
+   0xFF60757F,0xFF607580,0xFF617480,0xFF617382,0xFF627283,0xFF627183,0xFF627182,
+   0xFF617082,0xFF617081,0xFF617081,0xFF60717F,0xFF647784,0xFF5A6D7B,0xFF2F3F4C,
+   0xFF31414D,0xFF4D616B,0xFF5E727C,0xFF5F727E,0xFF5E727D,0xFF5D727C,0xFF5D717B,
+   0xFF5D717C,0xFF5D707C,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5D717B,0xFF5C717A,
+   0xFF5A7079,0xFF597077,0xFF597077,0xFF597076,0xFF587076,0xFF587176,0xFF577174,
+   0xFF577173,0xFF546F70,0xFF3F5A5B,0xFF3A5555,0xFF446161,0xFF3A5456,0xFF2B4044,
+   0xFF3A4F51,0xFF556D6C,0xFF576F6E,0xFF576F6F,0xFF586D70,0xFF586D70,0xFF596E70,
+   0xFF5A6F72,0xFF5B7073,0xFF5A6F73,0xFF5A6F73,0xFF5A6F73,0xFF597071,0xFF597071,
+   0xFF597070,0xFF58716F,0xFF597270,0xFF5A7171,0xFF5A7171,0xFF5A7171,0xFF596F71,
+   0xFF586E70,0xFF586D70,0xFF586D71,0xFF586D71,0xFF586D70,0xFF586D71,0xFF596C72,
+   0xFF5B6D73,0xFF5B6D74,0xFF5B6C74,0xFF5A6B73,0xFF5A6B73,0xFF5A6B73,0xFF5A6B73,
+   0xFF5D6E76,0xFF50626B,0xFF31424D,0xFF435561,0xFF5D717C,0xFF5E717C,0xFF5E717D,
+   0xFF5F707E,0xFF5F717F,0xFF60707F,0xFF607080,0xFF607080,0xFF616F81,0xFF616F81,
+   0xFF617082,0xFF627283,0xFF637383,0xFF637384,0xFF637384,0xFF637384,0xFF637384,
+   0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF617082,0xFF617081,0xFF617081,0xFF617081,0xFF667687,
+   0xFF5C6C7D,0xFF323E50,0xFF344258,0xFF4F5F76,0xFF5F6F85,0xFF5F6F87,0xFF5F6F87,
+   0xFF5E6E86,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D84,
+   0xFF5D6E84,0xFF5D6E83,0xFF5C6D82,0xFF5B6C81,0xFF5B6C81,0xFF5B6C81,0xFF5B6C81,
+   0xFF5B6C82,0xFF5B6B81,0xFF5B6B80,0xFF58697E,0xFF455467,0xFF3E4C59,0xFF485762,
+   0xFF3D4B57,0xFF2E3B46,0xFF3F4F5B,0xFF5C6F7B,0xFF5E717D,0xFF5E727D,0xFF5D727B,
+   0xFF5D727B,0xFF5D737B,0xFF5E757C,0xFF5F757D,0xFF5E757D,0xFF5E757D,0xFF5D757C,
+   0xFF5D757B,0xFF5D757B,0xFF5D757C,0xFF5F747E,0xFF60757F,0xFF60747F,0xFF60757F,
+   0xFF5F757D,0xFF5D747C,0xFF5C737B,0xFF5C737B,0xFF5B7479,0xFF597676,0xFF587774,
+   0xFF577774,0xFF577774,0xFF587875,0xFF587875,0xFF587874,0xFF577773,0xFF577773,
+   0xFF587674,0xFF587675,0xFF5B7977,0xFF4D6D69,0xFF2B4844,0xFF3C5C57,0xFF567772,
+   0xFF577772,0xFF567772,0xFF567872,0xFF577872,0xFF577972,0xFF577873,0xFF587774,
+   0xFF587774,0xFF587873,0xFF597875,0xFF5C7879,0xFF5E787C,0xFF5F777E,0xFF5F767F,
+   0xFF60767F,0xFF617481,0xFF627382,0xFF617482,0xFF617480,0xFF607480,0xFF607480,
+   0xFF617381,0xFF627183,0xFF627183,0xFF627183,0xFF627182,0xFF617081,0xFF617081,
+   0xFF5F717F,0xFF60757F,0xFF607480,0xFF344451,0xFF23303B,0xFF32454E,0xFF485D66,
+   0xFF5A6E78,0xFF5E727D,0xFF5E717D,0xFF5E707C,0xFF5E707C,0xFF5E707C,0xFF5E707D,
+   0xFF5E707D,0xFF5E707C,0xFF5D717B,0xFF5B707A,0xFF5A7078,0xFF597077,0xFF597077,
+   0xFF597077,0xFF587076,0xFF587176,0xFF587276,0xFF536D70,0xFF466163,0xFF526E6E,
+   0xFF5B7978,0xFF5F7C7B,0xFF5F7C7C,0xFF4A6467,0xFF30464A,0xFF455D5C,0xFF57706E,
+   0xFF596F70,0xFF596E71,0xFF596E71,0xFF597071,0xFF5A7172,0xFF5B7072,0xFF5B7072,
+   0xFF5A7072,0xFF5B6F73,0xFF5A7072,0xFF5A7072,0xFF5A7172,0xFF597270,0xFF5A7171,
+   0xFF5B7073,0xFF5B7073,0xFF5B7073,0xFF596E71,0xFF586D70,0xFF586D70,0xFF586D71,
+   0xFF586D71,0xFF596D71,0xFF5A6C72,0xFF5A6B73,0xFF5B6B74,0xFF5C6C75,0xFF5C6B75,
+   0xFF5B6B74,0xFF5B6B74,0xFF5B6B74,0xFF5B6B74,0xFF5D6E76,0xFF42535C,0xFF2C3C47,
+   0xFF445561,0xFF5E717D,0xFF5E717D,0xFF5E717D,0xFF5F707E,0xFF60707F,0xFF60707F,
+   0xFF607080,0xFF607080,0xFF616F80,0xFF616F81,0xFF627082,0xFF627183,0xFF637283,
+   0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627182,
+   0xFF617081,0xFF617081,0xFF617081,0xFF637283,0xFF627283,0xFF364354,0xFF263144,
+   0xFF36455B,0xFF4B5B72,0xFF5B6B82,0xFF5F6E86,0xFF5F6E86,0xFF5E6D85,0xFF5E6D85,
+   0xFF5E6D85,0xFF5E6D85,0xFF5E6D85,0xFF5E6D84,0xFF5D6E84,0xFF5D6D83,0xFF5C6C82,
+   0xFF5B6C81,0xFF5B6C82,0xFF5A6D81,0xFF5B6C81,0xFF5C6C82,0xFF5C6C83,0xFF56677C,
+   0xFF4A5A6D,0xFF556371,0xFF5E6D78,0xFF61707B,0xFF61707B,0xFF4C5B66,0xFF33414C,
+   0xFF4B5D68,0xFF5E737D,0xFF5E737C,0xFF5D747B,0xFF5D747B,0xFF5D757B,0xFF5E777C,
+   0xFF5E767C,0xFF5E767C,0xFF5D767C,0xFF5E767C,0xFF5E757C,0xFF5E767C,0xFF5F767D,
+   0xFF5F767D,0xFF60757E,0xFF60757F,0xFF60747F,0xFF60747F,0xFF5E737E,0xFF5D727C,
+   0xFF5C727C,0xFF5B7479,0xFF597676,0xFF587775,0xFF587774,0xFF587774,0xFF587775,
+   0xFF587875,0xFF587874,0xFF587675,0xFF597675,0xFF597576,0xFF597675,0xFF5A7977,
+   0xFF3E5E59,0xFF26423E,0xFF3C5C57,0xFF567772,0xFF577773,0xFF577773,0xFF577773,
+   0xFF577873,0xFF577873,0xFF587774,0xFF597775,0xFF597676,0xFF5A7677,0xFF5B7579,
+   0xFF5D767C,0xFF60757F,0xFF607580,0xFF617481,0xFF627382,0xFF627383,0xFF637283,
+   0xFF627383,0xFF617382,0xFF617381,0xFF607380,0xFF607281,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF617082,0xFF617081,0xFF60717F,0xFF60747F,0xFF5B6F7A,
+   0xFF32424F,0xFF1B252F,0xFF1F2D36,0xFF2B3E46,0xFF394D56,0xFF485C66,0xFF546672,
+   0xFF5B6D7A,0xFF5E707D,0xFF5F717E,0xFF5E707D,0xFF5E707D,0xFF5E707C,0xFF5D717B,
+   0xFF5B707A,0xFF5A7078,0xFF597077,0xFF597077,0xFF5A7177,0xFF597177,0xFF566E73,
+   0xFF4E676B,0xFF4C6569,0xFF567173,0xFF577374,0xFF567372,0xFF577574,0xFF5E7B7B,
+   0xFF678285,0xFF4F686D,0xFF31484B,0xFF475F5F,0xFF586E70,0xFF596E71,0xFF596F70,
+   0xFF597070,0xFF5A7171,0xFF5A7171,0xFF5A7171,0xFF5A7171,0xFF5A7172,0xFF5A7171,
+   0xFF5A7172,0xFF5A7171,0xFF5A7171,0xFF5B7072,0xFF5C6F74,0xFF5C6F74,0xFF5B7073,
+   0xFF596E71,0xFF586D71,0xFF596D71,0xFF596D72,0xFF586D71,0xFF596D71,0xFF596C72,
+   0xFF5A6B74,0xFF5B6A75,0xFF5C6B76,0xFF5C6B75,0xFF5B6A75,0xFF5B6A75,0xFF5B6B74,
+   0xFF5C6C75,0xFF55666F,0xFF35444F,0xFF283641,0xFF445662,0xFF5D717C,0xFF5E717D,
+   0xFF5F707E,0xFF5F707E,0xFF60707F,0xFF60707F,0xFF607080,0xFF607080,0xFF616F80,
+   0xFF616F81,0xFF627081,0xFF637283,0xFF637283,0xFF637284,0xFF637284,0xFF637284,
+   0xFF637284,0xFF637284,0xFF637284,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF617082,0xFF617081,0xFF617081,
+   0xFF637283,0xFF5D6C7E,0xFF344151,0xFF1C2433,0xFF232D40,0xFF303D54,0xFF3D4B62,
+   0xFF4B5971,0xFF55647C,0xFF5C6A83,0xFF5E6D85,0xFF5F6E85,0xFF5E6D85,0xFF5E6D85,
+   0xFF5E6D84,0xFF5E6D84,0xFF5D6D83,0xFF5C6C82,0xFF5B6C82,0xFF5C6C82,0xFF5C6D82,
+   0xFF5B6C81,0xFF59687E,0xFF516176,0xFF4E5E70,0xFF576674,0xFF596874,0xFF586772,
+   0xFF5A6974,0xFF606F79,0xFF677881,0xFF506069,0xFF34454E,0xFF4D616B,0xFF5D737B,
+   0xFF5D747C,0xFF5D747B,0xFF5D757B,0xFF5E777B,0xFF5E777B,0xFF5E777B,0xFF5E777C,
+   0xFF5E767C,0xFF5E767C,0xFF5F767C,0xFF5F767C,0xFF5F767D,0xFF5F767D,0xFF60757E,
+   0xFF60747F,0xFF60747F,0xFF5F727E,0xFF5E717D,0xFF5D727C,0xFF5C737A,0xFF597577,
+   0xFF587775,0xFF587774,0xFF577774,0xFF577774,0xFF587875,0xFF587775,0xFF597676,
+   0xFF5A7577,0xFF5A7577,0xFF5A7677,0xFF52716F,0xFF304E4A,0xFF223C38,0xFF3C5D57,
+   0xFF567871,0xFF577773,0xFF577773,0xFF577773,0xFF577873,0xFF587774,0xFF597775,
+   0xFF597775,0xFF597676,0xFF5C7479,0xFF5E747C,0xFF60747F,0xFF617480,0xFF617481,
+   0xFF617482,0xFF637283,0xFF637284,0xFF637284,0xFF637284,0xFF617282,0xFF617281,
+   0xFF617281,0xFF617281,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627182,
+   0xFF617081,0xFF607180,0xFF627482,0xFF4F606E,0xFF2B3945,0xFF18222B,0xFF19242D,
+   0xFF202D36,0xFF25363E,0xFF2A3A44,0xFF2F404B,0xFF384854,0xFF455663,0xFF536572,
+   0xFF5A6C79,0xFF5C6E7B,0xFF5D6F7C,0xFF5D707B,0xFF5B6F7A,0xFF586E77,0xFF556C73,
+   0xFF52696F,0xFF4D646B,0xFF455B62,0xFF455C62,0xFF526B70,0xFF5B7479,0xFF587376,
+   0xFF577274,0xFF577374,0xFF587475,0xFF5A7577,0xFF5E787C,0xFF688286,0xFF496266,
+   0xFF304749,0xFF4C6564,0xFF58706F,0xFF586F70,0xFF5A7071,0xFF5B7073,0xFF5B7073,
+   0xFF5B7072,0xFF5B7072,0xFF5B7073,0xFF5C7073,0xFF5B7073,0xFF5B7073,0xFF596E72,
+   0xFF596E72,0xFF5A6D73,0xFF5A6D73,0xFF596E71,0xFF586D71,0xFF596D71,0xFF596D72,
+   0xFF596D72,0xFF596D71,0xFF596D72,0xFF5A6C73,0xFF5B6B74,0xFF5B6A75,0xFF5C6A75,
+   0xFF5C6A75,0xFF5C6A75,0xFF5B6A75,0xFF5B6A75,0xFF5B6A74,0xFF41505B,0xFF2A3843,
+   0xFF26333E,0xFF3D4F5A,0xFF586C77,0xFF5F717E,0xFF5F707E,0xFF5F707E,0xFF60707F,
+   0xFF60707F,0xFF607080,0xFF607080,0xFF616F80,0xFF616F81,0xFF617181,0xFF637283,
+   0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,
+   0xFF637284,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627182,0xFF617081,0xFF617081,0xFF647384,0xFF505F70,0xFF2C3747,
+   0xFF19202D,0xFF1B2230,0xFF222C3C,0xFF293344,0xFF2D384A,0xFF323E52,0xFF3A475C,
+   0xFF47556B,0xFF54637A,0xFF5B6981,0xFF5C6B82,0xFF5D6C84,0xFF5D6D84,0xFF5D6C83,
+   0xFF5A6B81,0xFF57687E,0xFF55657B,0xFF506176,0xFF47566A,0xFF475566,0xFF536271,
+   0xFF5C6A76,0xFF596874,0xFF586773,0xFF596873,0xFF5A6974,0xFF5B6B74,0xFF5E6E77,
+   0xFF667880,0xFF495B62,0xFF34464F,0xFF526771,0xFF5E747C,0xFF5D747B,0xFF5E757B,
+   0xFF5E777C,0xFF5E777B,0xFF5E777C,0xFF5E777C,0xFF5E767C,0xFF5F767C,0xFF5F767C,
+   0xFF5F767D,0xFF5D747B,0xFF5D747B,0xFF5D737C,0xFF5E727D,0xFF5E727D,0xFF5E717E,
+   0xFF5E717D,0xFF5D727D,0xFF5C737B,0xFF5A7478,0xFF597676,0xFF587775,0xFF577774,
+   0xFF577774,0xFF587775,0xFF587775,0xFF597576,0xFF597576,0xFF597676,0xFF587675,
+   0xFF3D5B58,0xFF25403D,0xFF203935,0xFF35564F,0xFF51736C,0xFF577872,0xFF577773,
+   0xFF587774,0xFF597775,0xFF597775,0xFF597775,0xFF597775,0xFF5A7677,0xFF5C747A,
+   0xFF5E747D,0xFF607480,0xFF617481,0xFF617481,0xFF627382,0xFF627383,0xFF637284,
+   0xFF637284,0xFF637284,0xFF627383,0xFF617282,0xFF617281,0xFF617281,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF617082,0xFF617181,0xFF617181,
+   0xFF3F4E5E,0xFF232F3B,0xFF202C36,0xFF2B3C46,0xFF3A4E58,0xFF4C606B,0xFF556873,
+   0xFF51636F,0xFF455562,0xFF354551,0xFF30414B,0xFF344450,0xFF394856,0xFF3C4C5A,
+   0xFF3D4E5B,0xFF3D4E5A,0xFF394C56,0xFF354951,0xFF31454D,0xFF2C3F47,0xFF354850,
+   0xFF586F76,0xFF5B7379,0xFF587176,0xFF577175,0xFF577374,0xFF577374,0xFF587375,
+   0xFF597576,0xFF5B7578,0xFF5E797C,0xFF648082,0xFF3B5456,0xFF3C5555,0xFF576E6F,
+   0xFF596E71,0xFF5B6F73,0xFF5C6F74,0xFF5C6F74,0xFF5C7073,0xFF5C6F74,0xFF5D6F75,
+   0xFF5D6F75,0xFF5C6E75,0xFF5C6D75,0xFF5A6C73,0xFF596D72,0xFF596C72,0xFF5A6C73,
+   0xFF596C72,0xFF586C70,0xFF576B70,0xFF576B70,0xFF586B71,0xFF596C72,0xFF596C72,
+   0xFF5A6C73,0xFF5B6B74,0xFF5B6B74,0xFF5B6A75,0xFF5C6A76,0xFF5C6A76,0xFF5C6A76,
+   0xFF5D6C76,0xFF495763,0xFF313F4E,0xFF3E4F5F,0xFF3E4F5F,0xFF354653,0xFF485A66,
+   0xFF566875,0xFF5D6E7C,0xFF60707F,0xFF60707F,0xFF60707F,0xFF607080,0xFF607080,
+   0xFF607080,0xFF617080,0xFF617182,0xFF627383,0xFF637284,0xFF637284,0xFF637284,
+   0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF617082,
+   0xFF617081,0xFF627182,0xFF404E5F,0xFF242E3D,0xFF212A39,0xFF2E3A4A,0xFF3D4B5C,
+   0xFF4F5D6E,0xFF576677,0xFF536172,0xFF465464,0xFF374455,0xFF324052,0xFF364458,
+   0xFF3A495E,0xFF3E4C61,0xFF3E4D61,0xFF3E4D60,0xFF3B4B5D,0xFF38485A,0xFF354356,
+   0xFF2F3D4E,0xFF364350,0xFF586672,0xFF5B6A75,0xFF596773,0xFF586773,0xFF596873,
+   0xFF596873,0xFF596973,0xFF5A6A74,0xFF5B6C73,0xFF5D7175,0xFF62777B,0xFF3C4F56,
+   0xFF41555E,0xFF5D727B,0xFF5E737C,0xFF5D757B,0xFF5D777B,0xFF5D777A,0xFF5D777B,
+   0xFF5E777B,0xFF5E767C,0xFF5E767C,0xFF5E767C,0xFF5D757C,0xFF5C737A,0xFF5C7379,
+   0xFF5C727A,0xFF5D717C,0xFF5D717C,0xFF5D707C,0xFF5C707B,0xFF5B717A,0xFF5B7279,
+   0xFF5A7478,0xFF597577,0xFF587676,0xFF587775,0xFF577774,0xFF587774,0xFF587675,
+   0xFF597675,0xFF587674,0xFF597876,0xFF44635F,0xFF2B4843,0xFF375751,0xFF365650,
+   0xFF2E4C47,0xFF40615B,0xFF4F6F6A,0xFF557571,0xFF597675,0xFF5A7577,0xFF5A7577,
+   0xFF5A7676,0xFF5A7577,0xFF5B7478,0xFF5D747B,0xFF5E747D,0xFF607580,0xFF617481,
+   0xFF617481,0xFF627382,0xFF627383,0xFF637283,0xFF637283,0xFF627383,0xFF627383,
+   0xFF617282,0xFF617282,0xFF617282,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627182,0xFF637283,0xFF576777,0xFF334150,0xFF2B3946,0xFF394A57,
+   0xFF4F626E,0xFF607380,0xFF647684,0xFF647683,0xFF657884,0xFF677C87,0xFF647984,
+   0xFF586B77,0xFF4E5F6D,0xFF4B5A69,0xFF455563,0xFF425360,0xFF425461,0xFF40515D,
+   0xFF334650,0xFF283842,0xFF222F39,0xFF40525C,0xFF5B7079,0xFF597077,0xFF596F77,
+   0xFF597077,0xFF587276,0xFF587375,0xFF577374,0xFF587475,0xFF597576,0xFF5A7677,
+   0xFF607E7E,0xFF5A7676,0xFF354D4F,0xFF4F6769,0xFF5A6F71,0xFF5B6E73,0xFF5C6F74,
+   0xFF5C7073,0xFF5B7073,0xFF5C7074,0xFF5D6F75,0xFF5D6E75,0xFF5C6D76,0xFF5C6D75,
+   0xFF5A6C73,0xFF596C72,0xFF5A6C72,0xFF596C72,0xFF596C72,0xFF576A70,0xFF55686E,
+   0xFF55686E,0xFF566770,0xFF576871,0xFF586971,0xFF596A72,0xFF5A6A74,0xFF5B6A74,
+   0xFF5B6A74,0xFF5B6974,0xFF5B6975,0xFF5B6974,0xFF515F6A,0xFF323F4E,0xFF47566A,
+   0xFF637689,0xFF65798B,0xFF415160,0xFF536573,0xFF5E707E,0xFF576876,0xFF596A78,
+   0xFF5E6F7D,0xFF60707F,0xFF607080,0xFF607080,0xFF607080,0xFF607180,0xFF627282,
+   0xFF627283,0xFF637283,0xFF637283,0xFF637284,0xFF637284,0xFF637284,0xFF637284,
+   0xFF637284,0xFF637284,0xFF637284,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627182,0xFF637283,0xFF586778,0xFF344052,
+   0xFF2C3748,0xFF3B485A,0xFF516071,0xFF627282,0xFF657685,0xFF647584,0xFF667786,
+   0xFF697A89,0xFF667786,0xFF596A79,0xFF4E5F6E,0xFF4B5B6A,0xFF455564,0xFF425361,
+   0xFF425460,0xFF40515E,0xFF354453,0xFF2A3745,0xFF232E3A,0xFF3F4C59,0xFF5A6874,
+   0xFF596773,0xFF586773,0xFF586773,0xFF596873,0xFF596872,0xFF596972,0xFF596A72,
+   0xFF596C72,0xFF596E71,0xFF5F7578,0xFF596D72,0xFF374952,0xFF546872,0xFF5E747D,
+   0xFF5E757C,0xFF5D777B,0xFF5C787A,0xFF5D787A,0xFF5D777B,0xFF5E777B,0xFF5E777B,
+   0xFF5D767B,0xFF5D767B,0xFF5B7479,0xFF5B7379,0xFF5C727B,0xFF5D727C,0xFF5D717B,
+   0xFF5B6F7A,0xFF596E77,0xFF586E75,0xFF576F75,0xFF577174,0xFF577274,0xFF577475,
+   0xFF577575,0xFF577674,0xFF577774,0xFF577574,0xFF577574,0xFF577672,0xFF4C6C67,
+   0xFF2C4945,0xFF40605A,0xFF5D7F79,0xFF60817C,0xFF3A5854,0xFF4D6B69,0xFF577674,
+   0xFF516E6D,0xFF536F6F,0xFF587475,0xFF5A7577,0xFF5A7577,0xFF5B7479,0xFF5D737A,
+   0xFF5D747C,0xFF5E757D,0xFF5F757F,0xFF607480,0xFF617481,0xFF617481,0xFF627382,
+   0xFF627382,0xFF627382,0xFF627382,0xFF627383,0xFF627383,0xFF617282,0xFF617282,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627282,
+   0xFF425161,0xFF31404F,0xFF445563,0xFF5D707D,0xFF647683,0xFF60727F,0xFF5F6F7E,
+   0xFF5E6F7E,0xFF5D707C,0xFF5D727B,0xFF5F747D,0xFF637782,0xFF667886,0xFF677888,
+   0xFF677987,0xFF657885,0xFF657885,0xFF667A87,0xFF617481,0xFF4F626E,0xFF354552,
+   0xFF354451,0xFF546573,0xFF5C6E7B,0xFF5B6E7A,0xFF5B6F7A,0xFF5A7178,0xFF597177,
+   0xFF587275,0xFF577374,0xFF587475,0xFF597576,0xFF5A7877,0xFF648281,0xFF476163,
+   0xFF384E53,0xFF506769,0xFF596E71,0xFF5B7073,0xFF5A7172,0xFF5A7172,0xFF5B7073,
+   0xFF5C6F74,0xFF5C6E75,0xFF5C6D76,0xFF5C6D75,0xFF5A6C73,0xFF5A6C73,0xFF5A6C73,
+   0xFF5A6C72,0xFF596B72,0xFF56696F,0xFF54686E,0xFF55686E,0xFF566670,0xFF566671,
+   0xFF566670,0xFF566671,0xFF576672,0xFF586772,0xFF596872,0xFF596772,0xFF55646E,
+   0xFF485662,0xFF34414D,0xFF313E4E,0xFF56677C,0xFF5D6E82,0xFF627589,0xFF526476,
+   0xFF495A68,0xFF627482,0xFF637583,0xFF5F707F,0xFF596A79,0xFF596978,0xFF5D6D7D,
+   0xFF607080,0xFF617080,0xFF617181,0xFF627282,0xFF637283,0xFF637284,0xFF637284,
+   0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF435062,0xFF323E50,0xFF465365,0xFF5F6F7F,0xFF647684,
+   0xFF607180,0xFF5F6F7E,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF617380,0xFF647684,
+   0xFF657885,0xFF667986,0xFF667986,0xFF657985,0xFF647983,0xFF657B85,0xFF617481,
+   0xFF506170,0xFF364453,0xFF34414F,0xFF515F6C,0xFF596773,0xFF586773,0xFF596873,
+   0xFF596972,0xFF596972,0xFF596972,0xFF586971,0xFF586B71,0xFF596D71,0xFF5B6E73,
+   0xFF64777D,0xFF485A61,0xFF3A4D56,0xFF546A72,0xFF5D747B,0xFF5E777C,0xFF5D787A,
+   0xFF5C7879,0xFF5D787A,0xFF5D777B,0xFF5D767B,0xFF5C777A,0xFF5C767A,0xFF5B7479,
+   0xFF5C737A,0xFF5D727B,0xFF5D727B,0xFF5C717A,0xFF596F78,0xFF586E76,0xFF576F75,
+   0xFF566F74,0xFF566F73,0xFF567073,0xFF557072,0xFF557172,0xFF557272,0xFF557372,
+   0xFF567371,0xFF51706D,0xFF43625E,0xFF2F4B48,0xFF2B4644,0xFF4F6F6B,0xFF567672,
+   0xFF5D7D79,0xFF4D6B68,0xFF435F5E,0xFF5D797A,0xFF5E7A7C,0xFF597577,0xFF536F70,
+   0xFF536F6F,0xFF587275,0xFF5C737A,0xFF5E727C,0xFF5E747C,0xFF5E757D,0xFF5E767D,
+   0xFF5F767E,0xFF5F757F,0xFF607580,0xFF617481,0xFF617481,0xFF617481,0xFF617481,
+   0xFF627382,0xFF627383,0xFF617282,0xFF617282,0xFF627183,0xFF627183,0xFF627183,
+   0xFF617082,0xFF617082,0xFF637284,0xFF515F70,0xFF344252,0xFF4C5B6B,0xFF637383,
+   0xFF627381,0xFF5F707F,0xFF5F6F7F,0xFF5F6F7E,0xFF5E707E,0xFF5D707C,0xFF5C727A,
+   0xFF5C727A,0xFF5C717B,0xFF5E707C,0xFF5F6F7E,0xFF5E6F7E,0xFF5D707B,0xFF5C6F7B,
+   0xFF5D707C,0xFF607380,0xFF687A88,0xFF5F7180,0xFF3C4A59,0xFF394757,0xFF566575,
+   0xFF5D6D7D,0xFF5D6E7C,0xFF5C6F7B,0xFF5A7178,0xFF597276,0xFF577375,0xFF577374,
+   0xFF587575,0xFF587675,0xFF5D7C7A,0xFF5D7A7B,0xFF324B4D,0xFF334B4D,0xFF455D5E,
+   0xFF506968,0xFF57706E,0xFF597271,0xFF5A7172,0xFF5B7073,0xFF5B6F74,0xFF5C6E75,
+   0xFF5C6D75,0xFF5A6C73,0xFF596C72,0xFF596C72,0xFF596C72,0xFF586971,0xFF566770,
+   0xFF55686F,0xFF56686F,0xFF566770,0xFF576771,0xFF576771,0xFF576771,0xFF566671,
+   0xFF556570,0xFF52626D,0xFF485762,0xFF3A4853,0xFF2E3B47,0xFF202B35,0xFF303E4E,
+   0xFF4F5F74,0xFF5C6B81,0xFF5D6E83,0xFF596B7E,0xFF3E4E5D,0xFF5A6C79,0xFF5E707E,
+   0xFF617281,0xFF647584,0xFF617281,0xFF5B6B7B,0xFF596979,0xFF5C6C7C,0xFF607080,
+   0xFF627383,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,
+   0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF627182,0xFF617081,0xFF617082,
+   0xFF617082,0xFF617082,0xFF617082,0xFF617082,0xFF637284,0xFF515F71,0xFF354153,
+   0xFF4D5B6C,0xFF637383,0xFF627382,0xFF5F707F,0xFF5F6F7E,0xFF5F6F7E,0xFF5E707D,
+   0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707C,0xFF5D707C,0xFF5D707C,0xFF5D717C,
+   0xFF5C707A,0xFF5A7079,0xFF5B717A,0xFF60747F,0xFF677A88,0xFF5F7180,0xFF3C4959,
+   0xFF374452,0xFF52606C,0xFF596874,0xFF596873,0xFF596972,0xFF586972,0xFF586A71,
+   0xFF586A70,0xFF586A71,0xFF596B72,0xFF5A6C72,0xFF5E7276,0xFF5C7176,0xFF34474E,
+   0xFF364A51,0xFF495F67,0xFF566D74,0xFF5B7579,0xFF5D787A,0xFF5D787A,0xFF5D787A,
+   0xFF5C777A,0xFF5C7779,0xFF5C767A,0xFF5C7479,0xFF5C737A,0xFF5C727A,0xFF5C727A,
+   0xFF5A7078,0xFF586E76,0xFF576E75,0xFF576F75,0xFF577075,0xFF577075,0xFF577074,
+   0xFF577074,0xFF567073,0xFF536F70,0xFF506C6C,0xFF456160,0xFF35524F,0xFF294542,
+   0xFF1C3131,0xFF2A4342,0xFF486664,0xFF567371,0xFF587574,0xFF54716F,0xFF375352,
+   0xFF557072,0xFF5A7378,0xFF5D767B,0xFF5F797D,0xFF5B7779,0xFF566F74,0xFF566B74,
+   0xFF5A6E78,0xFF5D737B,0xFF5E767D,0xFF5E777D,0xFF5F767D,0xFF5F767D,0xFF5F767E,
+   0xFF60757F,0xFF607580,0xFF617480,0xFF617481,0xFF627382,0xFF627383,0xFF617282,
+   0xFF617181,0xFF617082,0xFF617082,0xFF617082,0xFF606E80,0xFF616F81,0xFF546273,
+   0xFF384556,0xFF4E5C6D,0xFF627282,0xFF617181,0xFF60707F,0xFF5F707E,0xFF5F6F7E,
+   0xFF5F6F7E,0xFF5E707D,0xFF5D717C,0xFF5C727A,0xFF5C727A,0xFF5C727A,0xFF5D717B,
+   0xFF5E707C,0xFF5E707D,0xFF5C717B,0xFF5B707A,0xFF5B707A,0xFF5C6F7B,0xFF5D6F7C,
+   0xFF647784,0xFF637584,0xFF3D4C5B,0xFF394657,0xFF526071,0xFF5D6D7D,0xFF5D6E7D,
+   0xFF5B6F7A,0xFF597177,0xFF587375,0xFF577374,0xFF577473,0xFF577673,0xFF5A7976,
+   0xFF5A7977,0xFF355050,0xFF1F3235,0xFF2A4142,0xFF344D4C,0xFF3D5755,0xFF46605E,
+   0xFF4E6666,0xFF52696A,0xFF546A6D,0xFF596C72,0xFF5C6E74,0xFF5A6D73,0xFF5A6E72,
+   0xFF596D72,0xFF596C72,0xFF576970,0xFF566770,0xFF54666E,0xFF51626B,0xFF4D5E66,
+   0xFF495B64,0xFF475862,0xFF455660,0xFF41515B,0xFF3A4A55,0xFF34434F,0xFF303F4B,
+   0xFF33434E,0xFF354451,0xFF313F4C,0xFF2E3B49,0xFF354355,0xFF4E5E73,0xFF5B6C81,
+   0xFF586B7E,0xFF364656,0xFF4E5F6D,0xFF5C6D7B,0xFF5C6C7B,0xFF5D6D7D,0xFF617180,
+   0xFF647484,0xFF627383,0xFF5E6E7E,0xFF5B6B7B,0xFF5D6D7D,0xFF5F6F80,0xFF627183,
+   0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,0xFF637284,
+   0xFF627183,0xFF616F81,0xFF606E7F,0xFF606E7F,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF616F81,0xFF546273,0xFF384556,0xFF4E5C6E,0xFF637283,0xFF617081,0xFF607080,
+   0xFF5F707F,0xFF5F6F7F,0xFF5E707E,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707C,
+   0xFF5D707C,0xFF5D717C,0xFF5D717C,0xFF5D717B,0xFF5C727A,0xFF5A7179,0xFF5A7079,
+   0xFF5B7079,0xFF5D6F7C,0xFF657685,0xFF647485,0xFF3D4B5B,0xFF374351,0xFF4D5C68,
+   0xFF596872,0xFF596972,0xFF586A71,0xFF576B70,0xFF566B6F,0xFF576A70,0xFF586A71,
+   0xFF596B72,0xFF5B6F73,0xFF5A7073,0xFF374A50,0xFF213037,0xFF2C3F46,0xFF384E54,
+   0xFF41595E,0xFF4A6467,0xFF516C6E,0xFF557072,0xFF567274,0xFF597577,0xFF5C767B,
+   0xFF5D757B,0xFF5C747B,0xFF5C747A,0xFF5C727A,0xFF5A6F78,0xFF586E75,0xFF566D73,
+   0xFF526970,0xFF4E656B,0xFF4A6268,0xFF485F66,0xFF465D63,0xFF41585D,0xFF385153,
+   0xFF314A4B,0xFF2C4546,0xFF2E4948,0xFF2E4A48,0xFF2B4544,0xFF284041,0xFF2F4749,
+   0xFF486464,0xFF567273,0xFF547071,0xFF30484A,0xFF4A6367,0xFF597076,0xFF596F76,
+   0xFF5A7177,0xFF5C7579,0xFF60777F,0xFF60757F,0xFF5B7179,0xFF576F75,0xFF587176,
+   0xFF5A7379,0xFF5D757C,0xFF5E777D,0xFF5F767E,0xFF5F767F,0xFF60757F,0xFF607580,
+   0xFF617480,0xFF617482,0xFF617282,0xFF607080,0xFF606E7F,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF536173,0xFF394657,0xFF4F5D6E,0xFF627183,0xFF606F80,
+   0xFF606F7F,0xFF5F6F7F,0xFF5F6F7E,0xFF5F6F7E,0xFF5E707D,0xFF5D707C,0xFF5D717B,
+   0xFF5C727A,0xFF5B7279,0xFF5B7378,0xFF5B7379,0xFF5B7279,0xFF5C727A,0xFF5B7279,
+   0xFF5A7278,0xFF5A7178,0xFF5A7178,0xFF5B7079,0xFF5B707A,0xFF637783,0xFF5E707F,
+   0xFF334151,0xFF354152,0xFF4B5A6A,0xFF5B6B7A,0xFF5D6F7C,0xFF5B7179,0xFF597277,
+   0xFF587375,0xFF577474,0xFF577673,0xFF557472,0xFF405E5C,0xFF2C4645,0xFF2A4242,
+   0xFF2B4344,0xFF2A4343,0xFF284040,0xFF263C3D,0xFF283D3F,0xFF2C4143,0xFF304548,
+   0xFF384B51,0xFF405259,0xFF41545A,0xFF40545A,0xFF41555A,0xFF43565C,0xFF43555D,
+   0xFF41525B,0xFF3C4D56,0xFF35464F,0xFF304049,0xFF2D3D46,0xFF2B3A44,0xFF2A3943,
+   0xFF2C3C47,0xFF33434F,0xFF41525F,0xFF50626F,0xFF5A6D7A,0xFF5D707D,0xFF5D6F7D,
+   0xFF5A6A79,0xFF4B5A69,0xFF3C4A5B,0xFF3F4E61,0xFF3D4D60,0xFF2C394A,0xFF40505E,
+   0xFF5B6B79,0xFF5C6D7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5D6D7D,0xFF606F7F,0xFF637282,
+   0xFF647384,0xFF627283,0xFF5E6D7E,0xFF546274,0xFF576678,0xFF5C6B7D,0xFF5F6D7F,
+   0xFF617081,0xFF627183,0xFF627183,0xFF627082,0xFF616F81,0xFF616F81,0xFF616F80,
+   0xFF607080,0xFF606F80,0xFF606F80,0xFF606E80,0xFF536173,0xFF394657,0xFF4F5D6E,
+   0xFF637183,0xFF606E80,0xFF606F80,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7E,0xFF5E707E,
+   0xFF5E707E,0xFF5E707D,0xFF5E707D,0xFF5D707C,0xFF5D717C,0xFF5D717B,0xFF5C717B,
+   0xFF5C727A,0xFF5C7279,0xFF5B7179,0xFF5A7178,0xFF5B7079,0xFF5C6F7B,0xFF5D6E7C,
+   0xFF647685,0xFF5F6F80,0xFF333F50,0xFF323E4C,0xFF475661,0xFF566670,0xFF596A72,
+   0xFF576B70,0xFF566B6E,0xFF576B6F,0xFF576B70,0xFF586C71,0xFF566B6F,0xFF41565A,
+   0xFF2E4146,0xFF2C3F45,0xFF2D4148,0xFF2D4147,0xFF2B3E45,0xFF283C42,0xFF293F42,
+   0xFF2D4547,0xFF314A4B,0xFF385154,0xFF40595C,0xFF42595F,0xFF425960,0xFF435A60,
+   0xFF455B63,0xFF455A64,0xFF425860,0xFF3C535A,0xFF364B52,0xFF31444B,0xFF2D4148,
+   0xFF2B3E45,0xFF293C43,0xFF2A3F44,0xFF30474A,0xFF3D5658,0xFF4B6768,0xFF557272,
+   0xFF577574,0xFF567573,0xFF547070,0xFF455F61,0xFF364F51,0xFF395254,0xFF375052,
+   0xFF263B3E,0xFF3C5458,0xFF576E74,0xFF5A6F77,0xFF596F76,0xFF587075,0xFF5A7077,
+   0xFF5D717B,0xFF5F757D,0xFF5F787D,0xFF5D777B,0xFF587276,0xFF4F676D,0xFF526B70,
+   0xFF586F76,0xFF5B717A,0xFF5E727D,0xFF5F737F,0xFF60737F,0xFF607280,0xFF607180,
+   0xFF606F80,0xFF616F80,0xFF616F81,0xFF616F81,0xFF606E80,0xFF424F61,0xFF364354,
+   0xFF515F71,0xFF637183,0xFF606E80,0xFF606E80,0xFF616F81,0xFF617181,0xFF5F707F,
+   0xFF5E707D,0xFF5E707C,0xFF5D717B,0xFF5C727A,0xFF5B7279,0xFF5A7378,0xFF5A7477,
+   0xFF597476,0xFF5A7477,0xFF5A7477,0xFF5A7477,0xFF597377,0xFF597376,0xFF587276,
+   0xFF597177,0xFF5A7178,0xFF5C717A,0xFF637783,0xFF40505F,0xFF273140,0xFF313E4D,
+   0xFF425161,0xFF516270,0xFF586B77,0xFF576E75,0xFF546D72,0xFF506B6D,0xFF476462,
+   0xFF375352,0xFF395454,0xFF4A6766,0xFF547371,0xFF547472,0xFF506F6C,0xFF4A6867,
+   0xFF456161,0xFF3F595A,0xFF354C4F,0xFF2D4146,0xFF26383E,0xFF25353D,0xFF25353C,
+   0xFF26373D,0xFF283940,0xFF293941,0xFF27363F,0xFF25333D,0xFF222F39,0xFF1E2933,
+   0xFF1D2832,0xFF26353F,0xFF2C3C47,0xFF2D3C47,0xFF475A66,0xFF596D79,0xFF617380,
+   0xFF60737F,0xFF5F717D,0xFF5F707D,0xFF60707F,0xFF627382,0xFF677787,0xFF637383,
+   0xFF50606F,0xFF3E4D5C,0xFF2E3B49,0xFF2E3B49,0xFF425260,0xFF526270,0xFF5A6A79,
+   0xFF5D6C7B,0xFF5D6C7C,0xFF5D6B7C,0xFF5E6C7D,0xFF5E6D7E,0xFF606E80,0xFF657385,
+   0xFF647385,0xFF586779,0xFF606F80,0xFF5F6E7F,0xFF5B697B,0xFF4C596B,0xFF4A5768,
+   0xFF4D5B6C,0xFF4D5A6C,0xFF4C5A6B,0xFF4C5B6B,0xFF4D5C6C,0xFF4C5C6C,0xFF4B5B6B,
+   0xFF435161,0xFF364353,0xFF515F71,0xFF637183,0xFF606E80,0xFF606E80,0xFF616F81,
+   0xFF607181,0xFF607080,0xFF5F6F7F,0xFF5F6F7E,0xFF5E707E,0xFF5E707D,0xFF5E707C,
+   0xFF5D717C,0xFF5C717B,0xFF5C727A,0xFF5C727A,0xFF5C727A,0xFF5B7279,0xFF5B7279,
+   0xFF5B7178,0xFF5B7079,0xFF5C6F7A,0xFF5C6E7C,0xFF5E6F7D,0xFF657686,0xFF414F61,
+   0xFF26303F,0xFF2F3C48,0xFF3E4D58,0xFF4D5D66,0xFF54676D,0xFF53686C,0xFF52676A,
+   0xFF4F6468,0xFF475C5F,0xFF384C50,0xFF3A5055,0xFF4C666D,0xFF57737A,0xFF58747C,
+   0xFF536E78,0xFF4E6772,0xFF47616B,0xFF405961,0xFF364E54,0xFF2D4347,0xFF253A3E,
+   0xFF24383C,0xFF25373D,0xFF26383F,0xFF283B42,0xFF2A3A44,0xFF283741,0xFF25353E,
+   0xFF223039,0xFF1D2A32,0xFF1C2931,0xFF25363E,0xFF2B3D45,0xFF2C3E44,0xFF445D62,
+   0xFF567074,0xFF5C777A,0xFF5C7778,0xFF597675,0xFF587675,0xFF597675,0xFF5B7977,
+   0xFF607D7C,0xFF5C7979,0xFF496665,0xFF375252,0xFF293F42,0xFF2A3E43,0xFF3F555B,
+   0xFF4F646C,0xFF576C74,0xFF597076,0xFF597076,0xFF5A6F77,0xFF597077,0xFF587276,
+   0xFF597477,0xFF5E797C,0xFF5E787D,0xFF536C71,0xFF5B737A,0xFF5B727A,0xFF586C77,
+   0xFF495C67,0xFF475965,0xFF4C5C6A,0xFF4C5B6A,0xFF4B5A6A,0xFF4C5A6B,0xFF4E5B6D,
+   0xFF4D5B6D,0xFF4C5A6C,0xFF313D4E,0xFF4D5A6C,0xFF627183,0xFF606E80,0xFF606E80,
+   0xFF616F81,0xFF617182,0xFF617282,0xFF607280,0xFF5E717D,0xFF5D717C,0xFF5C727A,
+   0xFF5C7279,0xFF5B7378,0xFF597476,0xFF597575,0xFF597575,0xFF597575,0xFF597575,
+   0xFF597576,0xFF597476,0xFF597476,0xFF597376,0xFF5A7278,0xFF5B7279,0xFF5C717A,
+   0xFF627781,0xFF455764,0xFF222D3A,0xFF1C2531,0xFF283442,0xFF334150,0xFF394956,
+   0xFF384A55,0xFF354951,0xFF31484C,0xFF304A4A,0xFF425E5E,0xFF5C7A79,0xFF60807E,
+   0xFF5F7F7C,0xFF60807D,0xFF62827F,0xFF638380,0xFF648382,0xFF658383,0xFF638081,
+   0xFF5E797D,0xFF546D72,0xFF465D64,0xFF3A4E56,0xFF293A42,0xFF1C2A31,0xFF17232A,
+   0xFF17222A,0xFF17212A,0xFF17202A,0xFF1C2630,0xFF2B3945,0xFF3E505D,0xFF556775,
+   0xFF586A77,0xFF5E717E,0xFF5D6F7C,0xFF5C6E7B,0xFF5B6D7A,0xFF5B6D79,0xFF5B6C7A,
+   0xFF5C6C7A,0xFF5C6C7A,0xFF5C6C7B,0xFF60707F,0xFF667685,0xFF657685,0xFF5A6A79,
+   0xFF485766,0xFF3A4957,0xFF364453,0xFF3C4B5A,0xFF485767,0xFF546272,0xFF5B697A,
+   0xFF5E6C7E,0xFF5E6C7E,0xFF5E6C7E,0xFF5E6C7E,0xFF627082,0xFF576577,0xFF424F5E,
+   0xFF505E6E,0xFF455263,0xFF313D4D,0xFF2F3B4B,0xFF364353,0xFF3A4758,0xFF404E5E,
+   0xFF435262,0xFF3B4A59,0xFF303E4D,0xFF2C3A48,0xFF303E4D,0xFF4C5B6B,0xFF627182,
+   0xFF606E80,0xFF606E80,0xFF616F81,0xFF627182,0xFF617282,0xFF617181,0xFF607080,
+   0xFF5F6F7E,0xFF5E707D,0xFF5E707C,0xFF5D717C,0xFF5D717B,0xFF5C717B,0xFF5C727A,
+   0xFF5C727A,0xFF5C7279,0xFF5B7379,0xFF5B7279,0xFF5B7279,0xFF5C717A,0xFF5C707B,
+   0xFF5D707C,0xFF5E6F7D,0xFF647585,0xFF475567,0xFF232D3B,0xFF1C2530,0xFF26333D,
+   0xFF2F3F48,0xFF35474E,0xFF35474D,0xFF32464B,0xFF314449,0xFF32464C,0xFF445D64,
+   0xFF5E7B83,0xFF63828A,0xFF628088,0xFF63818A,0xFF65828C,0xFF65848C,0xFF66848D,
+   0xFF67848E,0xFF64828A,0xFF5E7D83,0xFF537076,0xFF465E64,0xFF3A4F55,0xFF293A41,
+   0xFF1D2A32,0xFF18222B,0xFF18212B,0xFF18212B,0xFF17202A,0xFF1B262F,0xFF293A43,
+   0xFF3D525B,0xFF536972,0xFF556D73,0xFF5B7479,0xFF597377,0xFF597176,0xFF587075,
+   0xFF567173,0xFF567172,0xFF557271,0xFF557270,0xFF557370,0xFF597774,0xFF5E7D7B,
+   0xFF5F7C7C,0xFF546F71,0xFF445B61,0xFF384B54,0xFF344651,0xFF3B4C58,0xFF455962,
+   0xFF50666D,0xFF576D74,0xFF587175,0xFF577374,0xFF577373,0xFF587275,0xFF5C767A,
+   0xFF526A6F,0xFF3E5259,0xFF4C6169,0xFF42555F,0xFF2E3F49,0xFF2D3D48,0xFF354452,
+   0xFF394857,0xFF3F4E5E,0xFF445263,0xFF3C495A,0xFF313D4E,0xFF2D3949,0xFF495668,
+   0xFF606F81,0xFF606E80,0xFF606E80,0xFF606F81,0xFF617082,0xFF617282,0xFF617281,
+   0xFF607380,0xFF5F737E,0xFF5D727C,0xFF5C727A,0xFF5C7279,0xFF5B7379,0xFF5A7477,
+   0xFF597575,0xFF587575,0xFF587574,0xFF577474,0xFF577473,0xFF577473,0xFF587475,
+   0xFF597476,0xFF5A7377,0xFF5B7378,0xFF5C747A,0xFF52686F,0xFF2C3B45,0xFF1E2934,
+   0xFF18202B,0xFF18222D,0xFF202B37,0xFF2D3C48,0xFF3A4C57,0xFF4D616A,0xFF526C70,
+   0xFF577475,0xFF5C7A79,0xFF597976,0xFF597975,0xFF597976,0xFF597976,0xFF597976,
+   0xFF5A7976,0xFF5B7878,0xFF5B7979,0xFF5D7A7B,0xFF607B7E,0xFF637C82,0xFF637B82,
+   0xFF627982,0xFF536971,0xFF32484E,0xFF202F36,0xFF17222A,0xFF17222A,0xFF1C2731,
+   0xFF2D3C49,0xFF445463,0xFF5B6C7B,0xFF5C6E7C,0xFF5B6E7B,0xFF5A6C79,0xFF5C6E7B,
+   0xFF5D717D,0xFF5D707D,0xFF5C6E7A,0xFF5B6D7A,0xFF5C6C7A,0xFF5C6C7B,0xFF5C6C7B,
+   0xFF5C6C7B,0xFF5C6C7B,0xFF5E6E7D,0xFF637382,0xFF667685,0xFF647584,0xFF5C6D7C,
+   0xFF4D5C6C,0xFF414F5F,0xFF3A4858,0xFF3C495A,0xFF445162,0xFF4A5769,0xFF4B586A,
+   0xFF4A586A,0xFF475466,0xFF3F4C5D,0xFF283241,0xFF2D3848,0xFF374555,0xFF475666,
+   0xFF566575,0xFF5F707F,0xFF647484,0xFF667787,0xFF697989,0xFF687989,0xFF455464,
+   0xFF2F3C4B,0xFF455464,0xFF607080,0xFF606E80,0xFF606E7F,0xFF606F80,0xFF617082,
+   0xFF627182,0xFF617282,0xFF617281,0xFF607280,0xFF5F717E,0xFF5E707D,0xFF5D717C,
+   0xFF5D717B,0xFF5C717B,0xFF5C717A,0xFF5C727A,0xFF5C717A,0xFF5B7278,0xFF5A7277,
+   0xFF5A7177,0xFF5B7178,0xFF5C717A,0xFF5D717B,0xFF5D717C,0xFF5F717E,0xFF556573,
+   0xFF2D3A47,0xFF1E2835,0xFF17212A,0xFF18222B,0xFF1E2D35,0xFF2A3E47,0xFF384E56,
+   0xFF4C626A,0xFF546B75,0xFF5A747F,0xFF5E7B85,0xFF5C7A82,0xFF5C7A82,0xFF5C7A82,
+   0xFF5C7A82,0xFF5C7A82,0xFF5C7A81,0xFF5C7A82,0xFF5E7B84,0xFF5E7D84,0xFF607F85,
+   0xFF628188,0xFF627E87,0xFF627B84,0xFF536A74,0xFF344751,0xFF212E38,0xFF18222B,
+   0xFF18212B,0xFF1C2731,0xFF2C3D47,0xFF425660,0xFF596E78,0xFF5A7079,0xFF597077,
+   0xFF567074,0xFF587275,0xFF5B7479,0xFF5B7379,0xFF597176,0xFF587074,0xFF567173,
+   0xFF557271,0xFF557370,0xFF557270,0xFF557271,0xFF587475,0xFF5E787B,0xFF627A80,
+   0xFF627781,0xFF5B6E7A,0xFF4C5D6A,0xFF3F515D,0xFF374B53,0xFF384D54,0xFF3E565A,
+   0xFF425D5E,0xFF435F5F,0xFF445E60,0xFF415A5D,0xFF3A5156,0xFF25363C,0xFF293B43,
+   0xFF344751,0xFF455863,0xFF546773,0xFF5F707F,0xFF647484,0xFF667687,0xFF6A788A,
+   0xFF69788A,0xFF465365,0xFF2F3A4B,0xFF5E6C7E,0xFF616F81,0xFF606E80,0xFF606F81,
+   0xFF617082,0xFF627182,0xFF617281,0xFF607380,0xFF5F747F,0xFF5F747E,0xFF5E747C,
+   0xFF5D737B,0xFF5C727A,0xFF5B7279,0xFF597376,0xFF577474,0xFF567473,0xFF567372,
+   0xFF567372,0xFF567372,0xFF577373,0xFF587474,0xFF597575,0xFF597476,0xFF597277,
+   0xFF546C71,0xFF465A61,0xFF384952,0xFF212D37,0xFF18212B,0xFF1E2833,0xFF31414C,
+   0xFF485A66,0xFF5D717C,0xFF61777F,0xFF5D787A,0xFF5A7776,0xFF587774,0xFF587874,
+   0xFF587975,0xFF597975,0xFF597976,0xFF597976,0xFF597976,0xFF5A7877,0xFF597776,
+   0xFF587475,0xFF587275,0xFF576F75,0xFF576E74,0xFF586F76,0xFF60777F,0xFF526971,
+   0xFF31454D,0xFF1D2A32,0xFF18242C,0xFF2A3944,0xFF445563,0xFF5C6D7D,0xFF5B6B7B,
+   0xFF5A6B79,0xFF5A6C79,0xFF5A6C79,0xFF5C6F7B,0xFF5E717E,0xFF5F727F,0xFF5E707E,
+   0xFF5C6E7C,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7A,
+   0xFF5C6C7A,0xFF5C6C7B,0xFF5E6E7D,0xFF617180,0xFF657584,0xFF677686,0xFF617081,
+   0xFF4F5D6F,0xFF394557,0xFF313D4E,0xFF2F3A4A,0xFF2B3545,0xFF293343,0xFF2E394A,
+   0xFF3A4758,0xFF4D5D6D,0xFF5D6E7E,0xFF657586,0xFF647484,0xFF627281,0xFF607080,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF667786,0xFF4F5F6E,0xFF384756,0xFF5A6A7A,0xFF607080,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF607181,0xFF617282,0xFF617282,0xFF617281,0xFF607381,
+   0xFF607380,0xFF60727F,0xFF5E717D,0xFF5D707C,0xFF5C717A,0xFF5B7179,0xFF5B7178,
+   0xFF5A7077,0xFF5A7077,0xFF597076,0xFF597176,0xFF597176,0xFF5A7278,0xFF5C727A,
+   0xFF5C717B,0xFF5C707A,0xFF566974,0xFF485864,0xFF394853,0xFF212D38,0xFF17222B,
+   0xFF1C2B33,0xFF2E444E,0xFF445F69,0xFF5A7681,0xFF617B87,0xFF5F7986,0xFF5D7783,
+   0xFF5C7781,0xFF5C7882,0xFF5C7981,0xFF5C7A81,0xFF5C7A82,0xFF5C7A82,0xFF5D7A82,
+   0xFF5D7983,0xFF5B7881,0xFF59777E,0xFF58767D,0xFF57737B,0xFF56717B,0xFF58717E,
+   0xFF607988,0xFF536A79,0xFF324550,0xFF1E2933,0xFF19232D,0xFF2A3944,0xFF435662,
+   0xFF5B6E7A,0xFF596D78,0xFF586D76,0xFF586E75,0xFF567074,0xFF587276,0xFF5B7479,
+   0xFF5C747B,0xFF5B7379,0xFF597177,0xFF577074,0xFF567172,0xFF557271,0xFF557271,
+   0xFF567172,0xFF577073,0xFF587074,0xFF596F76,0xFF5B7079,0xFF5F737E,0xFF637683,
+   0xFF647883,0xFF5E747C,0xFF4A6268,0xFF334B4D,0xFF2A4443,0xFF284040,0xFF253A3D,
+   0xFF24383C,0xFF293E43,0xFF364B52,0xFF4A6068,0xFF5B707A,0xFF637782,0xFF637582,
+   0xFF627281,0xFF607080,0xFF606F7F,0xFF606E80,0xFF677688,0xFF505E70,0xFF354253,
+   0xFF616F81,0xFF606E80,0xFF606E80,0xFF616F81,0xFF627183,0xFF617282,0xFF607381,
+   0xFF5F737F,0xFF5F747E,0xFF5E757D,0xFF5E757D,0xFF5D747C,0xFF5C727A,0xFF5A7177,
+   0xFF587274,0xFF567372,0xFF557471,0xFF567471,0xFF567471,0xFF567471,0xFF567472,
+   0xFF587574,0xFF577474,0xFF567173,0xFF587175,0xFF5A7278,0xFF61797F,0xFF5B717A,
+   0xFF2E414A,0xFF1A252E,0xFF293944,0xFF475B66,0xFF5F737F,0xFF5D717C,0xFF5B7179,
+   0xFF597376,0xFF587675,0xFF597775,0xFF587874,0xFF587874,0xFF587974,0xFF597975,
+   0xFF5A7976,0xFF5A7977,0xFF5B7878,0xFF5A7677,0xFF597376,0xFF576F75,0xFF576D74,
+   0xFF576D74,0xFF566C73,0xFF586C75,0xFF617680,0xFF495D67,0xFF283842,0xFF1E2A35,
+   0xFF384857,0xFF586878,0xFF5C6C7C,0xFF596979,0xFF5B6B7A,0xFF5A6C79,0xFF5A6C7A,
+   0xFF5D6F7D,0xFF5F717F,0xFF5F7280,0xFF5F7280,0xFF5F717F,0xFF5D6E7D,0xFF5C6C7B,
+   0xFF5C6C7A,0xFF5C6C7A,0xFF5C6C7A,0xFF5C6C7A,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,
+   0xFF5C6C7B,0xFF5C6C7B,0xFF5E6C7D,0xFF617081,0xFF687789,0xFF647385,0xFF4C5A6C,
+   0xFF344051,0xFF222B3A,0xFF2E3949,0xFF485668,0xFF5E6D7F,0xFF637383,0xFF617181,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF607280,
+   0xFF40505E,0xFF4A5968,0xFF617181,0xFF5F6F7F,0xFF5F6F7F,0xFF60717F,0xFF617281,
+   0xFF617281,0xFF617281,0xFF617281,0xFF607380,0xFF60737F,0xFF60737F,0xFF5F727E,
+   0xFF5D717B,0xFF5B7078,0xFF5A7077,0xFF5A7077,0xFF597076,0xFF597076,0xFF597076,
+   0xFF597076,0xFF5A7077,0xFF5B7278,0xFF5B7178,0xFF596F77,0xFF5A6F79,0xFF5C707B,
+   0xFF637882,0xFF5B717B,0xFF2F414A,0xFF19262E,0xFF283C45,0xFF455F69,0xFF5D7983,
+   0xFF5B7781,0xFF5B7481,0xFF5B7482,0xFF5C7682,0xFF5D7782,0xFF5C7882,0xFF5B7980,
+   0xFF5B7A7F,0xFF5B7A80,0xFF5C7A82,0xFF5D7983,0xFF5D7984,0xFF5B7881,0xFF59767E,
+   0xFF56737C,0xFF56717A,0xFF56707B,0xFF566E7B,0xFF586F7E,0xFF617989,0xFF495E6D,
+   0xFF293743,0xFF1F2A35,0xFF384956,0xFF576977,0xFF5A6D7A,0xFF576B76,0xFF596D77,
+   0xFF586E76,0xFF586F75,0xFF597277,0xFF5C747A,0xFF5C757B,0xFF5D747B,0xFF5C737A,
+   0xFF5A7178,0xFF587074,0xFF577173,0xFF567173,0xFF577073,0xFF577074,0xFF586F76,
+   0xFF596F76,0xFF596F76,0xFF596E77,0xFF5A6E78,0xFF5B6F79,0xFF5C747A,0xFF627D7F,
+   0xFF5C7A7A,0xFF436160,0xFF2D4646,0xFF1E3033,0xFF283E41,0xFF425B60,0xFF5A7178,
+   0xFF60767F,0xFF5F737D,0xFF5D717C,0xFF5E707D,0xFF5F6F7E,0xFF5F6F7F,0xFF606E7F,
+   0xFF606E80,0xFF627082,0xFF424F60,0xFF475566,0xFF606E80,0xFF606E80,0xFF606F81,
+   0xFF617082,0xFF627183,0xFF617282,0xFF607381,0xFF60737F,0xFF5F747F,0xFF5F747E,
+   0xFF5E747E,0xFF5E747D,0xFF5C727A,0xFF5A7177,0xFF587274,0xFF567372,0xFF557470,
+   0xFF557470,0xFF557470,0xFF557470,0xFF567571,0xFF54726F,0xFF547270,0xFF587575,
+   0xFF5A7577,0xFF5B7478,0xFF5C767A,0xFF597178,0xFF30444C,0xFF1D2A33,0xFF344650,
+   0xFF556A74,0xFF5C717B,0xFF5B707A,0xFF5B7278,0xFF5A7477,0xFF597776,0xFF597775,
+   0xFF597775,0xFF587874,0xFF587874,0xFF597875,0xFF5A7776,0xFF5B7779,0xFF5B767A,
+   0xFF5A7378,0xFF586F76,0xFF576D75,0xFF576D75,0xFF576D74,0xFF566C73,0xFF576B74,
+   0xFF5B6F79,0xFF5B6F7A,0xFF344551,0xFF25313E,0xFF3E4E5C,0xFF5A6B7A,0xFF586878,
+   0xFF5A6A7A,0xFF5B6B7B,0xFF5B6B7A,0xFF5B6C7B,0xFF5D6E7E,0xFF5F7180,0xFF607180,
+   0xFF607180,0xFF607180,0xFF5F707F,0xFF5E6F7D,0xFF5C6D7B,0xFF5C6D7A,0xFF5C6D7B,
+   0xFF5C6D7B,0xFF5C6D7B,0xFF5C6D7C,0xFF5C6D7C,0xFF5C6D7C,0xFF5D6C7C,0xFF5D6C7D,
+   0xFF5D6C7D,0xFF5E6C7E,0xFF637284,0xFF69788B,0xFF566577,0xFF354252,0xFF3A4657,
+   0xFF5C6A7C,0xFF5F6F7F,0xFF5D6D7D,0xFF5E6E7E,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,
+   0xFF5F6F7E,0xFF5F6F7E,0xFF607180,0xFF556674,0xFF394956,0xFF596A78,0xFF5F6F7F,
+   0xFF5F6F7F,0xFF5F707F,0xFF607280,0xFF617281,0xFF617281,0xFF607381,0xFF607380,
+   0xFF607380,0xFF5F737F,0xFF5F747F,0xFF5F747E,0xFF5D727B,0xFF5B7078,0xFF5A7077,
+   0xFF5A7077,0xFF597175,0xFF597176,0xFF597176,0xFF597076,0xFF5A7178,0xFF576E75,
+   0xFF586E75,0xFF5B7279,0xFF5D727B,0xFF5D727C,0xFF5F747D,0xFF5A7179,0xFF30444C,
+   0xFF1D2C33,0xFF314A52,0xFF536F78,0xFF5B7780,0xFF59767F,0xFF5B7581,0xFF5C7582,
+   0xFF5D7783,0xFF5D7783,0xFF5C7882,0xFF5C7881,0xFF5B7980,0xFF5B7980,0xFF5C7981,
+   0xFF5D7983,0xFF5D7883,0xFF5A7680,0xFF56737C,0xFF55727A,0xFF55717A,0xFF55717A,
+   0xFF556F79,0xFF566E7B,0xFF5B7182,0xFF5B7183,0xFF354554,0xFF25313E,0xFF3E4E5C,
+   0xFF596B79,0xFF576976,0xFF586B77,0xFF596D78,0xFF586D77,0xFF586F76,0xFF5A7178,
+   0xFF5C747A,0xFF5C757B,0xFF5D747B,0xFF5D747C,0xFF5D737C,0xFF5B7278,0xFF587075,
+   0xFF577074,0xFF577175,0xFF577175,0xFF597076,0xFF597077,0xFF597077,0xFF596F77,
+   0xFF596F78,0xFF597077,0xFF587076,0xFF587275,0xFF5C7879,0xFF627F7F,0xFF4F6B6C,
+   0xFF2F474A,0xFF344C4F,0xFF566F74,0xFF5B7379,0xFF5A7078,0xFF5C707A,0xFF5E707C,
+   0xFF5E707E,0xFF5F6F7F,0xFF5F6F7F,0xFF606E7F,0xFF627082,0xFF566476,0xFF3B4759,
+   0xFF5A687A,0xFF606E80,0xFF606E80,0xFF617082,0xFF627183,0xFF627182,0xFF617282,
+   0xFF617281,0xFF607380,0xFF5F737F,0xFF5F747F,0xFF5F747E,0xFF5E747D,0xFF5B737A,
+   0xFF597277,0xFF587175,0xFF577373,0xFF557471,0xFF55756F,0xFF54756F,0xFF54756F,
+   0xFF4F6E69,0xFF506F6B,0xFF577673,0xFF587674,0xFF587575,0xFF597575,0xFF5B7679,
+   0xFF5B7479,0xFF33484E,0xFF1F2D36,0xFF364952,0xFF566B74,0xFF5B7179,0xFF5A7278,
+   0xFF5A7477,0xFF5A7677,0xFF597775,0xFF597775,0xFF597775,0xFF597775,0xFF597775,
+   0xFF597776,0xFF597676,0xFF5A7377,0xFF587076,0xFF576E75,0xFF576D75,0xFF576D75,
+   0xFF576D75,0xFF566D74,0xFF556D72,0xFF566C73,0xFF576C75,0xFF5E727D,0xFF40525E,
+   0xFF2A3845,0xFF3C4C5A,0xFF566676,0xFF586878,0xFF5C6B7B,0xFF5B6B7B,0xFF5B6B7B,
+   0xFF5C6B7C,0xFF5E6E7F,0xFF607081,0xFF607181,0xFF607181,0xFF607180,0xFF607180,
+   0xFF5F717F,0xFF5D707D,0xFF5C6E7B,0xFF5C6D7B,0xFF5C6D7C,0xFF5C6D7C,0xFF5C6D7C,
+   0xFF5C6D7C,0xFF5D6C7C,0xFF5D6C7C,0xFF5D6C7D,0xFF5D6C7D,0xFF5E6C7E,0xFF5E6C7E,
+   0xFF606E80,0xFF69788A,0xFF526272,0xFF394656,0xFF5A6A7A,0xFF5D6D7D,0xFF5D6D7C,
+   0xFF5E6E7D,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF617281,
+   0xFF455564,0xFF425260,0xFF5F717F,0xFF5F6F7E,0xFF5F707E,0xFF607180,0xFF617281,
+   0xFF617282,0xFF617281,0xFF607380,0xFF60737F,0xFF60737F,0xFF5F747F,0xFF5F747E,
+   0xFF5E747D,0xFF5C727B,0xFF5A7178,0xFF5A7077,0xFF597176,0xFF597176,0xFF5A7077,
+   0xFF5A7077,0xFF597076,0xFF536A70,0xFF536B70,0xFF5B7378,0xFF5B7379,0xFF5B7379,
+   0xFF5C7279,0xFF5D747B,0xFF5C737B,0xFF32484E,0xFF1E3035,0xFF324E53,0xFF537178,
+   0xFF59767F,0xFF5A7680,0xFF5B7680,0xFF5C7782,0xFF5D7783,0xFF5D7784,0xFF5D7784,
+   0xFF5D7782,0xFF5C7882,0xFF5C7882,0xFF5C7782,0xFF5B7581,0xFF58737E,0xFF56727B,
+   0xFF547278,0xFF547278,0xFF547279,0xFF557179,0xFF547079,0xFF556E7A,0xFF586E7E,
+   0xFF5F7487,0xFF415263,0xFF2B3846,0xFF3C4C5A,0xFF566775,0xFF576977,0xFF5B6C7A,
+   0xFF5A6C79,0xFF596D77,0xFF596F76,0xFF5A7278,0xFF5C747B,0xFF5C757B,0xFF5C747B,
+   0xFF5D747B,0xFF5C747B,0xFF5C747A,0xFF5A7278,0xFF587175,0xFF587175,0xFF577175,
+   0xFF597076,0xFF597077,0xFF597077,0xFF5A6F78,0xFF596F78,0xFF597077,0xFF587076,
+   0xFF587175,0xFF577274,0xFF597576,0xFF627F80,0xFF4C6869,0xFF344B4E,0xFF556E72,
+   0xFF597177,0xFF5A7078,0xFF5C6F7A,0xFF5E707C,0xFF5F6F7E,0xFF5F6F7F,0xFF606E7F,
+   0xFF606E80,0xFF627183,0xFF475466,0xFF445162,0xFF616F81,0xFF606E80,0xFF616F81,
+   0xFF627082,0xFF627183,0xFF627182,0xFF617282,0xFF617281,0xFF607380,0xFF60737F,
+   0xFF5F747F,0xFF5E747D,0xFF5C747B,0xFF5B7379,0xFF597377,0xFF587275,0xFF577274,
+   0xFF567372,0xFF557570,0xFF54766F,0xFF44635D,0xFF4B6B65,0xFF577772,0xFF567772,
+   0xFF577772,0xFF577673,0xFF587574,0xFF5B7578,0xFF5F787D,0xFF374E54,0xFF202E36,
+   0xFF31454C,0xFF51686F,0xFF5A7378,0xFF5A7377,0xFF5A7577,0xFF597776,0xFF597775,
+   0xFF597775,0xFF597776,0xFF597776,0xFF597776,0xFF5A7677,0xFF597476,0xFF586F75,
+   0xFF576D74,0xFF576D74,0xFF576D74,0xFF576D75,0xFF576D75,0xFF566D74,0xFF556D72,
+   0xFF566C73,0xFF566B74,0xFF5E727C,0xFF4D606C,0xFF2D3B48,0xFF2F3D4B,0xFF4B5A6A,
+   0xFF5C6B7C,0xFF5C6A7B,0xFF5B6B7B,0xFF5B6B7B,0xFF5D6B7C,0xFF5F6E7F,0xFF617082,
+   0xFF617082,0xFF617081,0xFF607181,0xFF607180,0xFF607281,0xFF5F7280,0xFF5D6F7D,
+   0xFF5C6D7C,0xFF5C6D7C,0xFF5D6C7C,0xFF5C6D7C,0xFF5C6D7C,0xFF5D6C7C,0xFF5D6C7D,
+   0xFF5D6C7D,0xFF5E6D7E,0xFF5F6D7F,0xFF5F6D7E,0xFF5E6C7D,0xFF606F80,0xFF687889,
+   0xFF455464,0xFF4C5B6A,0xFF5E6E7D,0xFF5D6D7C,0xFF5D6E7C,0xFF5E6E7D,0xFF5F6F7E,
+   0xFF5F6F7E,0xFF5F6F7E,0xFF60707F,0xFF5B6C7A,0xFF394957,0xFF51626F,0xFF5F717E,
+   0xFF5E707D,0xFF5F717E,0xFF607280,0xFF617281,0xFF617281,0xFF607380,0xFF60737F,
+   0xFF5F747F,0xFF5F747F,0xFF5E747E,0xFF5E747D,0xFF5D737D,0xFF5B727A,0xFF5B7179,
+   0xFF5A7077,0xFF597076,0xFF5A7077,0xFF5A7077,0xFF5A7178,0xFF495E64,0xFF4F676C,
+   0xFF5A7378,0xFF5A7378,0xFF5A7377,0xFF5A7378,0xFF5B7378,0xFF5C7479,0xFF5E787C,
+   0xFF364F52,0xFF1E3136,0xFF2E494D,0xFF4F6D73,0xFF5A777F,0xFF5A777F,0xFF5C7881,
+   0xFF5C7882,0xFF5D7783,0xFF5E7684,0xFF5E7684,0xFF5D7784,0xFF5D7783,0xFF5D7783,
+   0xFF5B7582,0xFF58727E,0xFF56717B,0xFF557279,0xFF547279,0xFF557279,0xFF55717A,
+   0xFF55717A,0xFF547079,0xFF556F7A,0xFF566D7C,0xFF5E7486,0xFF4E6173,0xFF2E3B4A,
+   0xFF303C4B,0xFF4B5A6A,0xFF5C6C7C,0xFF5A6C7A,0xFF5A6C79,0xFF596D78,0xFF596F77,
+   0xFF5B7279,0xFF5D747B,0xFF5C747B,0xFF5C747B,0xFF5C747B,0xFF5C757B,0xFF5C767B,
+   0xFF5C757A,0xFF597377,0xFF587176,0xFF587175,0xFF596F78,0xFF5A6E79,0xFF5A6E79,
+   0xFF5B6E7A,0xFF5A6E79,0xFF5A6F78,0xFF5A7178,0xFF597377,0xFF597276,0xFF587275,
+   0xFF597576,0xFF627E7F,0xFF41595C,0xFF485F64,0xFF5A7178,0xFF5B6F79,0xFF5C6F7A,
+   0xFF5D6F7D,0xFF5F6F7E,0xFF5F6F7F,0xFF606E7F,0xFF616F81,0xFF5C6A7C,0xFF3B4759,
+   0xFF536072,0xFF616F81,0xFF606F81,0xFF617082,0xFF627183,0xFF627183,0xFF627182,
+   0xFF617282,0xFF617281,0xFF607380,0xFF5F737F,0xFF5F747E,0xFF5D747C,0xFF5B737A,
+   0xFF5A7378,0xFF597476,0xFF587375,0xFF587374,0xFF577372,0xFF53726F,0xFF42605B,
+   0xFF3C5954,0xFF547770,0xFF557770,0xFF557871,0xFF567771,0xFF577673,0xFF587575,
+   0xFF5A7477,0xFF61797F,0xFF3D535A,0xFF1F2F36,0xFF2D4247,0xFF4D666A,0xFF5A7477,
+   0xFF5A7677,0xFF597776,0xFF597776,0xFF597776,0xFF597776,0xFF5A7776,0xFF5A7677,
+   0xFF5A7777,0xFF5A7477,0xFF597076,0xFF576E74,0xFF566D74,0xFF566D74,0xFF576D75,
+   0xFF576D74,0xFF566E74,0xFF566E74,0xFF566C73,0xFF576B74,0xFF576B74,0xFF5B6E79,
+   0xFF576877,0xFF313E4D,0xFF2A3644,0xFF4F5E6E,0xFF5D6B7D,0xFF5B6B7B,0xFF5B6B7B,
+   0xFF5B6B7B,0xFF5C6C7C,0xFF5F6E7F,0xFF617082,0xFF617082,0xFF617082,0xFF617182,
+   0xFF627382,0xFF627483,0xFF627382,0xFF5F717F,0xFF5D6E7D,0xFF5D6C7C,0xFF5D6C7C,
+   0xFF5C6D7C,0xFF5C6D7C,0xFF5D6C7C,0xFF5D6C7D,0xFF5E6D7E,0xFF606F80,0xFF617081,
+   0xFF607080,0xFF5F6F7F,0xFF5D6D7D,0xFF627282,0xFF5D6D7D,0xFF3A4957,0xFF556574,
+   0xFF5D6E7D,0xFF5D6E7C,0xFF5E6F7E,0xFF60707F,0xFF607180,0xFF607180,0xFF637483,
+   0xFF4D5F6D,0xFF3A4A57,0xFF5C6F7B,0xFF5E717D,0xFF5E717D,0xFF5F727F,0xFF607380,
+   0xFF607381,0xFF617281,0xFF607381,0xFF5F737F,0xFF5F747F,0xFF5F747E,0xFF5E747E,
+   0xFF5D747C,0xFF5C727C,0xFF5B727A,0xFF5B7279,0xFF5A7178,0xFF5A7178,0xFF5A7077,
+   0xFF586E75,0xFF475B62,0xFF40555A,0xFF597377,0xFF5A7277,0xFF5A7378,0xFF5A7477,
+   0xFF5A7378,0xFF5A7378,0xFF5A7477,0xFF5F7A7D,0xFF3B5557,0xFF1E3235,0xFF2B4549,
+   0xFF4C6A70,0xFF5A7880,0xFF5B7880,0xFF5C7981,0xFF5C7881,0xFF5D7782,0xFF5E7684,
+   0xFF5E7684,0xFF5D7784,0xFF5D7783,0xFF5C7683,0xFF597380,0xFF57707C,0xFF55717A,
+   0xFF557279,0xFF557279,0xFF55717A,0xFF55717A,0xFF56707B,0xFF556F79,0xFF556F7A,
+   0xFF566E7A,0xFF5B7281,0xFF576B7D,0xFF313E4D,0xFF2B3645,0xFF4F5E6E,0xFF5C6C7C,
+   0xFF5A6C7A,0xFF5A6C78,0xFF5A6C78,0xFF5A6E78,0xFF5B7279,0xFF5D747B,0xFF5C747B,
+   0xFF5D747B,0xFF5E747C,0xFF5E767D,0xFF5F777E,0xFF5F767E,0xFF5C747A,0xFF597177,
+   0xFF587076,0xFF5A6F78,0xFF5B6E79,0xFF5B6E7A,0xFF5B6E7A,0xFF5B6E7A,0xFF5B707A,
+   0xFF5C737A,0xFF5C757A,0xFF5B7479,0xFF5A7378,0xFF587276,0xFF5D777A,0xFF587176,
+   0xFF374C53,0xFF536871,0xFF5C6F7A,0xFF5C6E7B,0xFF5E6F7E,0xFF607080,0xFF617081,
+   0xFF617082,0xFF647385,0xFF4F5D6F,0xFF3B4859,0xFF5E6D7F,0xFF616F81,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF617282,0xFF617281,0xFF607380,0xFF60737F,
+   0xFF5F747F,0xFF5E747D,0xFF5C737B,0xFF5A7379,0xFF5A7478,0xFF597577,0xFF567274,
+   0xFF526D6E,0xFF4F6C6B,0xFF53726F,0xFF476561,0xFF4C6D67,0xFF557870,0xFF54776F,
+   0xFF557770,0xFF567672,0xFF577673,0xFF587574,0xFF597477,0xFF5F787D,0xFF3C5459,
+   0xFF1F2F34,0xFF2A4044,0xFF4B6668,0xFF5A7677,0xFF5A7677,0xFF5A7677,0xFF5A7677,
+   0xFF5A7677,0xFF5A7677,0xFF5A7776,0xFF5A7777,0xFF5A7677,0xFF597276,0xFF576E75,
+   0xFF566E73,0xFF556E73,0xFF566E74,0xFF566E74,0xFF566E74,0xFF556E73,0xFF566E73,
+   0xFF566C73,0xFF576B74,0xFF586A75,0xFF5A6C79,0xFF5B6B7B,0xFF374354,0xFF384756,
+   0xFF566676,0xFF5B6B7B,0xFF5B6B7A,0xFF5B6B7A,0xFF5B6B7B,0xFF5C6C7C,0xFF5F6F7F,
+   0xFF617081,0xFF617082,0xFF627183,0xFF637284,0xFF637484,0xFF637483,0xFF637484,
+   0xFF617282,0xFF5F6F7E,0xFF5D6C7C,0xFF5D6C7C,0xFF5C6D7C,0xFF5C6D7C,0xFF5D6C7C,
+   0xFF5E6D7E,0xFF606E80,0xFF617081,0xFF627081,0xFF627181,0xFF617181,0xFF60707F,
+   0xFF5F6F7F,0xFF657686,0xFF3D4C5B,0xFF3B4A59,0xFF566675,0xFF5E6F7E,0xFF5F727F,
+   0xFF607380,0xFF617281,0xFF627382,0xFF5D6E7D,0xFF3B4B59,0xFF3F505C,0xFF5F747F,
+   0xFF5F747F,0xFF5F747E,0xFF5F747F,0xFF5F737F,0xFF607380,0xFF607380,0xFF617281,
+   0xFF60737F,0xFF5F747E,0xFF5F747E,0xFF5E747D,0xFF5C737B,0xFF5B727A,0xFF5B737A,
+   0xFF5B7479,0xFF597077,0xFF556A73,0xFF536970,0xFF586E75,0xFF4C6168,0xFF51686D,
+   0xFF5A7378,0xFF5A7277,0xFF5A7278,0xFF5A7378,0xFF5A7378,0xFF5A7477,0xFF597476,
+   0xFF5E797B,0xFF3B5557,0xFF1E3134,0xFF294347,0xFF4B696E,0xFF5B7980,0xFF5B7980,
+   0xFF5B7980,0xFF5C7981,0xFF5C7882,0xFF5D7783,0xFF5D7784,0xFF5D7783,0xFF5D7782,
+   0xFF5A7481,0xFF57717D,0xFF56707B,0xFF55717A,0xFF547279,0xFF547279,0xFF55717A,
+   0xFF55717A,0xFF56707B,0xFF556F7A,0xFF556F79,0xFF556E7A,0xFF59707F,0xFF5A6F80,
+   0xFF364454,0xFF394657,0xFF566576,0xFF5C6B7B,0xFF5B6B7A,0xFF5A6C79,0xFF5A6C79,
+   0xFF5B6E79,0xFF5C727A,0xFF5D747C,0xFF5D747C,0xFF5E757D,0xFF60767F,0xFF617680,
+   0xFF617680,0xFF617680,0xFF5E757D,0xFF5A7279,0xFF597076,0xFF5A6F78,0xFF5B6E79,
+   0xFF5B6D7B,0xFF5B6D7B,0xFF5C6E7B,0xFF5D717B,0xFF5E747C,0xFF5D757B,0xFF5D757B,
+   0xFF5D747B,0xFF5C737A,0xFF5B7379,0xFF627981,0xFF3B4E57,0xFF394B56,0xFF556774,
+   0xFF5E6F7D,0xFF607181,0xFF617282,0xFF627183,0xFF637284,0xFF5E6D7F,0xFF3D4A5B,
+   0xFF414E5F,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF617282,0xFF607381,0xFF607380,0xFF5F747F,0xFF5F747F,0xFF5D747D,0xFF5B737A,
+   0xFF587076,0xFF506A6D,0xFF4B6467,0xFF4E686B,0xFF526D6F,0xFF577374,0xFF5A7777,
+   0xFF506E6B,0xFF54756F,0xFF54776F,0xFF54776F,0xFF557670,0xFF557671,0xFF567672,
+   0xFF577673,0xFF597675,0xFF5C7879,0xFF385155,0xFF1D2D32,0xFF283E41,0xFF486365,
+   0xFF5A7677,0xFF5B7678,0xFF5A7677,0xFF5A7677,0xFF5A7677,0xFF5A7677,0xFF5A7776,
+   0xFF597776,0xFF587475,0xFF567074,0xFF556E72,0xFF556E72,0xFF556E73,0xFF566E74,
+   0xFF566E74,0xFF566E74,0xFF566E73,0xFF566D74,0xFF576C75,0xFF586B76,0xFF596A78,
+   0xFF5C6C7B,0xFF5F6F7F,0xFF394757,0xFF404E5E,0xFF5A6B7A,0xFF5A6C7A,0xFF5A6C79,
+   0xFF5B6B7A,0xFF5B6B7A,0xFF5C6C7C,0xFF5F6F7F,0xFF617182,0xFF637284,0xFF647385,
+   0xFF647385,0xFF637484,0xFF637484,0xFF637484,0xFF637383,0xFF607080,0xFF5D6D7D,
+   0xFF5D6C7C,0xFF5D6C7C,0xFF5D6C7D,0xFF5D6C7D,0xFF5F6E7F,0xFF616F81,0xFF627082,
+   0xFF627082,0xFF627082,0xFF617181,0xFF617181,0xFF607080,0xFF667787,0xFF4E5D6D,
+   0xFF2D3A48,0xFF3D4C5B,0xFF516271,0xFF5C6E7C,0xFF5F727F,0xFF5F717F,0xFF566776,
+   0xFF415160,0xFF2E3C49,0xFF435561,0xFF5F747E,0xFF5F747E,0xFF5F747E,0xFF5F747E,
+   0xFF5F747E,0xFF5F747E,0xFF5F747F,0xFF607380,0xFF5F747F,0xFF5F747E,0xFF5F747E,
+   0xFF5D747C,0xFF5B737A,0xFF596F77,0xFF526870,0xFF4C6369,0xFF50666E,0xFF556A73,
+   0xFF5A7178,0xFF5D747B,0xFF546B71,0xFF597176,0xFF597277,0xFF597277,0xFF597277,
+   0xFF597277,0xFF597376,0xFF597476,0xFF597576,0xFF5C7779,0xFF375253,0xFF1C2E31,
+   0xFF274043,0xFF48666B,0xFF5B7980,0xFF5B7980,0xFF5B7980,0xFF5B7981,0xFF5C7881,
+   0xFF5C7882,0xFF5D7882,0xFF5D7782,0xFF5B7581,0xFF58727E,0xFF56707B,0xFF56717B,
+   0xFF557179,0xFF547279,0xFF547279,0xFF557179,0xFF55717A,0xFF56707B,0xFF566F7B,
+   0xFF566F7B,0xFF576E7C,0xFF5A7181,0xFF5C7483,0xFF384856,0xFF404E5E,0xFF5B6A7B,
+   0xFF5C6A7B,0xFF5B6B7B,0xFF5A6C7A,0xFF5A6C79,0xFF5B6E7A,0xFF5D717C,0xFF5E747E,
+   0xFF607480,0xFF617680,0xFF617681,0xFF617680,0xFF617680,0xFF617581,0xFF617581,
+   0xFF5E737D,0xFF5A7079,0xFF5A6F79,0xFF5B6E7A,0xFF5B6D7B,0xFF5C6D7B,0xFF5D707C,
+   0xFF5E727D,0xFF5E747C,0xFF5D747B,0xFF5E747B,0xFF5E747C,0xFF5E747C,0xFF5D737B,
+   0xFF637A82,0xFF4C5F6A,0xFF2C3B46,0xFF3C4D5A,0xFF516271,0xFF5D6D7D,0xFF617181,
+   0xFF606F81,0xFF576678,0xFF435062,0xFF2F3A4B,0xFF455365,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627283,0xFF627382,0xFF617381,0xFF60737F,
+   0xFF5C707C,0xFF576B75,0xFF51676F,0xFF4D646A,0xFF4B6367,0xFF3F5459,0xFF384D51,
+   0xFF526C70,0xFF597377,0xFF597376,0xFF597576,0xFF53706F,0xFF567572,0xFF557770,
+   0xFF557770,0xFF557770,0xFF557671,0xFF567673,0xFF577673,0xFF587774,0xFF577473,
+   0xFF314B4C,0xFF1A292D,0xFF24393C,0xFF445E60,0xFF5A7477,0xFF5B7478,0xFF5A7677,
+   0xFF5A7677,0xFF5B7678,0xFF5B7578,0xFF5B7678,0xFF597576,0xFF577274,0xFF556F72,
+   0xFF546F71,0xFF546F71,0xFF556F72,0xFF566E74,0xFF566E74,0xFF566E74,0xFF566E74,
+   0xFF576D75,0xFF586C76,0xFF596B78,0xFF5A6A79,0xFF5C6D7C,0xFF5F6F80,0xFF394757,
+   0xFF4B5B69,0xFF5E6F7E,0xFF5C6E7B,0xFF5B6D7A,0xFF5B6B7A,0xFF5B6B7B,0xFF5E6E7E,
+   0xFF617282,0xFF637384,0xFF647384,0xFF647385,0xFF647384,0xFF637484,0xFF637484,
+   0xFF647384,0xFF647384,0xFF627283,0xFF5F6E7F,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,
+   0xFF5F6D7E,0xFF616F81,0xFF627082,0xFF627082,0xFF627082,0xFF627082,0xFF627081,
+   0xFF617181,0xFF617180,0xFF657685,0xFF5E6E7E,0xFF323F4E,0xFF273340,0xFF334350,
+   0xFF3C4D5A,0xFF40505D,0xFF3B4B58,0xFF32414E,0xFF293743,0xFF24313C,0xFF41525F,
+   0xFF5D717C,0xFF5F747E,0xFF5E747E,0xFF5E747E,0xFF5E747E,0xFF5E757D,0xFF5F757E,
+   0xFF5E757E,0xFF5E747D,0xFF5C717A,0xFF566C75,0xFF51676E,0xFF4D646A,0xFF4C6269,
+   0xFF40535A,0xFF394C52,0xFF546B72,0xFF5B7179,0xFF5A7378,0xFF5B7378,0xFF556D73,
+   0xFF597277,0xFF597276,0xFF597376,0xFF597377,0xFF597377,0xFF597476,0xFF587476,
+   0xFF5A7577,0xFF587375,0xFF314B4C,0xFF192A2D,0xFF233B3E,0xFF436166,0xFF5B7780,
+   0xFF5C7781,0xFF5C7980,0xFF5B7981,0xFF5C7881,0xFF5C7881,0xFF5C7881,0xFF5B7781,
+   0xFF58737F,0xFF56717C,0xFF56707B,0xFF56717B,0xFF557179,0xFF557179,0xFF557179,
+   0xFF557179,0xFF55717A,0xFF56707B,0xFF576F7D,0xFF586E7E,0xFF586E7F,0xFF5B7182,
+   0xFF5D7485,0xFF394857,0xFF4B5A6A,0xFF5F6E7F,0xFF5E6C7D,0xFF5C6C7C,0xFF5B6B7B,
+   0xFF5B6C7B,0xFF5D6F7D,0xFF607380,0xFF627582,0xFF627483,0xFF627582,0xFF617681,
+   0xFF617680,0xFF617680,0xFF627582,0xFF627583,0xFF607480,0xFF5C717B,0xFF5B6E7A,
+   0xFF5B6D7B,0xFF5C6D7B,0xFF5D6E7D,0xFF5F717E,0xFF5F727E,0xFF5F737D,0xFF5E747B,
+   0xFF5E747B,0xFF5E747C,0xFF5E747C,0xFF5E737C,0xFF637882,0xFF5C707B,0xFF30414C,
+   0xFF26333F,0xFF344251,0xFF3E4C5C,0xFF414E5E,0xFF3C4758,0xFF333E4E,0xFF2B3544,
+   0xFF262F3F,0xFF435063,0xFF606F81,0xFF627183,0xFF627183,0xFF627284,0xFF606F81,
+   0xFF5B6A7B,0xFF556575,0xFF536371,0xFF516270,0xFF51636F,0xFF536771,0xFF566D75,
+   0xFF597278,0xFF5D777C,0xFF617B80,0xFF5A7378,0xFF516A6E,0xFF4C6668,0xFF4D6769,
+   0xFF4C6667,0xFF546E70,0xFF577574,0xFF567772,0xFF557771,0xFF557772,0xFF567673,
+   0xFF567673,0xFF567673,0xFF597875,0xFF4F6C6C,0xFF2A4143,0xFF18272B,0xFF1F3135,
+   0xFF395255,0xFF587274,0xFF5A7476,0xFF5A7576,0xFF5A7677,0xFF5A7677,0xFF5B7678,
+   0xFF5A7578,0xFF587275,0xFF557073,0xFF556E72,0xFF556F72,0xFF546F71,0xFF556F72,
+   0xFF566E73,0xFF566E73,0xFF566D74,0xFF576D75,0xFF576D75,0xFF576D75,0xFF586C76,
+   0xFF596B78,0xFF5D6E7C,0xFF576878,0xFF364554,0xFF546574,0xFF5F707E,0xFF5D707C,
+   0xFF5D6F7C,0xFF5D6E7C,0xFF5E6F7E,0xFF617281,0xFF637483,0xFF637484,0xFF647384,
+   0xFF647384,0xFF647384,0xFF647384,0xFF647384,0xFF647385,0xFF647385,0xFF647385,
+   0xFF617082,0xFF5E6D7E,0xFF5D6C7D,0xFF5E6D7D,0xFF606F80,0xFF627082,0xFF627082,
+   0xFF627082,0xFF627082,0xFF627081,0xFF617181,0xFF617181,0xFF617180,0xFF627382,
+   0xFF667785,0xFF3D4B5A,0xFF1E2935,0xFF1C2631,0xFF283642,0xFF31404E,0xFF3F4F5D,
+   0xFF455663,0xFF3A4C57,0xFF2B3B46,0xFF344550,0xFF566A75,0xFF5F757F,0xFF5E747E,
+   0xFF5F757E,0xFF5C737B,0xFF576E75,0xFF52686F,0xFF4F666C,0xFF4F656B,0xFF4F646C,
+   0xFF526870,0xFF576D75,0xFF5A7278,0xFF5D767D,0xFF617B80,0xFF5A7378,0xFF52696F,
+   0xFF4D656A,0xFF4E666A,0xFF4D6568,0xFF546E71,0xFF597476,0xFF587476,0xFF597476,
+   0xFF597477,0xFF597477,0xFF587476,0xFF587476,0xFF5B7678,0xFF506C6D,0xFF294243,
+   0xFF18282B,0xFF1E3236,0xFF3A545B,0xFF5A747F,0xFF5C7681,0xFF5B787F,0xFF5B7980,
+   0xFF5B7980,0xFF5B7980,0xFF5B7880,0xFF59757F,0xFF57717C,0xFF56717B,0xFF56717B,
+   0xFF56717B,0xFF55717A,0xFF55717A,0xFF557179,0xFF557179,0xFF55717A,0xFF576F7C,
+   0xFF586E7E,0xFF586E7F,0xFF586E7F,0xFF5C7283,0xFF566C7D,0xFF364554,0xFF556474,
+   0xFF606F7F,0xFF5F6E7F,0xFF5E6E7E,0xFF5D6E7D,0xFF5F6F7F,0xFF617282,0xFF637483,
+   0xFF637483,0xFF637483,0xFF627582,0xFF627581,0xFF627582,0xFF627582,0xFF637483,
+   0xFF637484,0xFF627482,0xFF5F727F,0xFF5D6F7C,0xFF5C6D7B,0xFF5D6E7D,0xFF606F7F,
+   0xFF617180,0xFF607280,0xFF5F737E,0xFF5E747C,0xFF5E747B,0xFF5E747C,0xFF5F737D,
+   0xFF5F737D,0xFF61757F,0xFF647883,0xFF3B4C58,0xFF1E2934,0xFF1D2531,0xFF293341,
+   0xFF313B4A,0xFF3E4958,0xFF45505F,0xFF3A4554,0xFF2C3645,0xFF374353,0xFF596779,
+   0xFF637284,0xFF606F81,0xFF576476,0xFF536172,0xFF596778,0xFF5E6D7F,0xFF617182,
+   0xFF627383,0xFF627482,0xFF5F737F,0xFF5D737C,0xFF5B737A,0xFF5A7279,0xFF5A7379,
+   0xFF5C757A,0xFF5C777B,0xFF5B7779,0xFF597576,0xFF4B6568,0xFF577074,0xFF587575,
+   0xFF567673,0xFF567772,0xFF567673,0xFF577574,0xFF577574,0xFF577573,0xFF5B7977,
+   0xFF456062,0xFF263A3F,0xFF293E42,0xFF31474B,0xFF2C4246,0xFF4D6768,0xFF597575,
+   0xFF597575,0xFF597676,0xFF5A7676,0xFF5A7577,0xFF587276,0xFF567074,0xFF556F72,
+   0xFF556F73,0xFF566F73,0xFF566F73,0xFF566F73,0xFF566E74,0xFF566E74,0xFF576D75,
+   0xFF576D75,0xFF576D75,0xFF576C76,0xFF586C76,0xFF596B77,0xFF5E707E,0xFF50606F,
+   0xFF364453,0xFF586978,0xFF5E6F7E,0xFF5E6F7D,0xFF5E6F7D,0xFF5E6F7D,0xFF5F717F,
+   0xFF627382,0xFF637483,0xFF637484,0xFF637484,0xFF647384,0xFF647385,0xFF647385,
+   0xFF647384,0xFF647384,0xFF647384,0xFF647385,0xFF637284,0xFF606F81,0xFF5F6E7F,
+   0xFF606F80,0xFF617081,0xFF617081,0xFF627082,0xFF627082,0xFF627082,0xFF627082,
+   0xFF617181,0xFF617181,0xFF617180,0xFF617280,0xFF687A88,0xFF475665,0xFF232E3B,
+   0xFF24303D,0xFF3A4A58,0xFF586978,0xFF677A88,0xFF6B7F8B,0xFF667B87,0xFF4C606B,
+   0xFF2E3F49,0xFF475B65,0xFF5E747E,0xFF5C737C,0xFF526870,0xFF4F656C,0xFF546B72,
+   0xFF5A7278,0xFF5D767B,0xFF5E767D,0xFF5E777D,0xFF5D767C,0xFF5C747B,0xFF5B737A,
+   0xFF5B7279,0xFF5A7379,0xFF5B757A,0xFF5D767C,0xFF5D767B,0xFF5A7379,0xFF4C6469,
+   0xFF567074,0xFF597477,0xFF587476,0xFF587476,0xFF587476,0xFF587476,0xFF587476,
+   0xFF587475,0xFF5C7879,0xFF456062,0xFF253B3E,0xFF283E41,0xFF30494C,0xFF2D434B,
+   0xFF4F6873,0xFF5C7781,0xFF5A777F,0xFF5B787F,0xFF5B7980,0xFF5A787F,0xFF58767D,
+   0xFF56737C,0xFF56727B,0xFF56717B,0xFF56717B,0xFF56717B,0xFF56717B,0xFF56717B,
+   0xFF56717B,0xFF56717B,0xFF56707C,0xFF576F7E,0xFF586E7E,0xFF576F7D,0xFF576F7E,
+   0xFF5C7484,0xFF4E6474,0xFF354553,0xFF596978,0xFF5F6F7F,0xFF5F6E7E,0xFF5F6E7E,
+   0xFF5E6F7E,0xFF607180,0xFF627382,0xFF637483,0xFF637484,0xFF637484,0xFF627583,
+   0xFF627582,0xFF627582,0xFF637483,0xFF637484,0xFF637484,0xFF637484,0xFF627382,
+   0xFF5F7080,0xFF5F6F7E,0xFF607080,0xFF617081,0xFF617081,0xFF617180,0xFF60727E,
+   0xFF5F737D,0xFF5E737D,0xFF5F737D,0xFF5F727E,0xFF5F737E,0xFF5F737E,0xFF677A87,
+   0xFF465764,0xFF232E3A,0xFF242F3B,0xFF394553,0xFF566271,0xFF657281,0xFF697684,
+   0xFF667281,0xFF4C5867,0xFF303B4A,0xFF4B586A,0xFF627183,0xFF525F70,0xFF5B6A7B,
+   0xFF657487,0xFF677789,0xFF667688,0xFF657587,0xFF647386,0xFF617283,0xFF5F7180,
+   0xFF5E717E,0xFF5C727B,0xFF5A7379,0xFF5A7378,0xFF5A7378,0xFF5A7378,0xFF5A7478,
+   0xFF5A7378,0xFF577075,0xFF5A7478,0xFF587575,0xFF567673,0xFF567673,0xFF577575,
+   0xFF587476,0xFF587575,0xFF587574,0xFF5B7878,0xFF395355,0xFF2E454A,0xFF4F6A71,
+   0xFF617E84,0xFF4C666B,0xFF3A5455,0xFF567372,0xFF587674,0xFF587674,0xFF587574,
+   0xFF577273,0xFF567074,0xFF566F74,0xFF566F73,0xFF566F73,0xFF566F73,0xFF566F74,
+   0xFF576F75,0xFF576F74,0xFF576E75,0xFF586E76,0xFF576E75,0xFF576D75,0xFF576D75,
+   0xFF576D75,0xFF586B77,0xFF5F717F,0xFF4A5A69,0xFF364554,0xFF596A79,0xFF5E6F7E,
+   0xFF5E6F7D,0xFF5E6F7E,0xFF5E6F7D,0xFF5F707F,0xFF617381,0xFF637483,0xFF637484,
+   0xFF637484,0xFF647384,0xFF647385,0xFF647385,0xFF647385,0xFF647384,0xFF647384,
+   0xFF647385,0xFF637284,0xFF627182,0xFF617081,0xFF617081,0xFF617081,0xFF617081,
+   0xFF617081,0xFF617081,0xFF617081,0xFF627082,0xFF627081,0xFF627081,0xFF617181,
+   0xFF617181,0xFF677988,0xFF4C5C6B,0xFF2A3845,0xFF384856,0xFF576A78,0xFF637684,
+   0xFF617381,0xFF607480,0xFF647984,0xFF6B818B,0xFF475A64,0xFF344751,0xFF4F646D,
+   0xFF4F646C,0xFF576D75,0xFF617880,0xFF637B82,0xFF627A81,0xFF607A7F,0xFF5F787E,
+   0xFF5D767C,0xFF5C757A,0xFF5C737A,0xFF5B737A,0xFF5B7279,0xFF5A7379,0xFF5A7378,
+   0xFF5A7378,0xFF5B7379,0xFF5B7279,0xFF586F76,0xFF5A7379,0xFF597377,0xFF597476,
+   0xFF587476,0xFF597476,0xFF597476,0xFF597476,0xFF597476,0xFF5C7778,0xFF395355,
+   0xFF2E4448,0xFF4E686B,0xFF607B7F,0xFF4D656D,0xFF3D535F,0xFF59747E,0xFF5A777F,
+   0xFF5A777F,0xFF5A777F,0xFF58757D,0xFF56747B,0xFF55737A,0xFF55737B,0xFF56727C,
+   0xFF56727C,0xFF56727C,0xFF56727C,0xFF56727C,0xFF57717D,0xFF57717D,0xFF57707D,
+   0xFF576F7E,0xFF576F7D,0xFF576F7D,0xFF576F7E,0xFF5D7585,0xFF485E6E,0xFF354653,
+   0xFF596A78,0xFF5E6F7E,0xFF5F6E7E,0xFF5F6E7E,0xFF5E6F7E,0xFF5F7080,0xFF627382,
+   0xFF637484,0xFF637484,0xFF637484,0xFF637483,0xFF627582,0xFF637483,0xFF637484,
+   0xFF637484,0xFF637484,0xFF637484,0xFF637383,0xFF617281,0xFF617180,0xFF617081,
+   0xFF617081,0xFF617081,0xFF607180,0xFF5F727E,0xFF5F727E,0xFF5F727E,0xFF60727E,
+   0xFF60727F,0xFF60727F,0xFF60727E,0xFF667A86,0xFF4B5D6A,0xFF2A3845,0xFF374452,
+   0xFF566370,0xFF626E7C,0xFF5F6B7A,0xFF5F6B7A,0xFF64707E,0xFF6B7786,0xFF485362,
+   0xFF384455,0xFF526072,0xFF617081,0xFF657486,0xFF647386,0xFF657487,0xFF657487,
+   0xFF657487,0xFF657487,0xFF647586,0xFF647585,0xFF637584,0xFF617681,0xFF5E777E,
+   0xFF5C777B,0xFF5C767A,0xFF5C747B,0xFF5C737B,0xFF566C75,0xFF597077,0xFF597477,
+   0xFF577575,0xFF577574,0xFF577574,0xFF587476,0xFF597477,0xFF597476,0xFF5A7577,
+   0xFF587375,0xFF324A4E,0xFF4B656C,0xFF5E7B84,0xFF5D7A82,0xFF648288,0xFF456163,
+   0xFF476463,0xFF587674,0xFF587673,0xFF567472,0xFF557271,0xFF557073,0xFF576F74,
+   0xFF576F74,0xFF566F74,0xFF566F74,0xFF566F74,0xFF576F74,0xFF576F74,0xFF566F74,
+   0xFF566F74,0xFF566F74,0xFF566E74,0xFF566E73,0xFF566D74,0xFF586C76,0xFF5F727F,
+   0xFF475765,0xFF364554,0xFF596A79,0xFF5E6F7D,0xFF5E6F7D,0xFF5E6F7D,0xFF5E707E,
+   0xFF617281,0xFF637483,0xFF637484,0xFF637484,0xFF637484,0xFF647384,0xFF647385,
+   0xFF647385,0xFF647385,0xFF647384,0xFF647385,0xFF647385,0xFF637283,0xFF617082,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,
+   0xFF617081,0xFF617080,0xFF617081,0xFF627182,0xFF617281,0xFF667887,0xFF4C5C6B,
+   0xFF2F3D4B,0xFF4E5F6E,0xFF627583,0xFF607380,0xFF60737F,0xFF5F747F,0xFF5F747E,
+   0xFF647983,0xFF5E737D,0xFF30424C,0xFF32444D,0xFF586E77,0xFF617881,0xFF607780,
+   0xFF617880,0xFF607980,0xFF607980,0xFF607980,0xFF60797F,0xFF60797F,0xFF60787F,
+   0xFF60777F,0xFF5E777E,0xFF5D767C,0xFF5C767B,0xFF5C747A,0xFF5C747B,0xFF566D74,
+   0xFF597078,0xFF5A7379,0xFF5A7378,0xFF597377,0xFF597476,0xFF597477,0xFF597477,
+   0xFF597476,0xFF5B7577,0xFF587375,0xFF32494D,0xFF4A6266,0xFF5E787B,0xFF5D767A,
+   0xFF657E85,0xFF485F6A,0xFF4A646E,0xFF5B7780,0xFF5A777F,0xFF59757E,0xFF56737C,
+   0xFF55737A,0xFF55737A,0xFF55737A,0xFF55737B,0xFF55737B,0xFF56727B,0xFF56727C,
+   0xFF56727C,0xFF57727C,0xFF56727C,0xFF57717D,0xFF57707E,0xFF576F7D,0xFF576F7D,
+   0xFF576F7D,0xFF5D7784,0xFF455B69,0xFF354653,0xFF596B78,0xFF5E6F7E,0xFF5E6F7E,
+   0xFF5E6E7E,0xFF5F6F7F,0xFF617282,0xFF637484,0xFF637484,0xFF637484,0xFF637483,
+   0xFF637484,0xFF637483,0xFF637483,0xFF637484,0xFF637484,0xFF637484,0xFF637484,
+   0xFF637283,0xFF617181,0xFF617080,0xFF617081,0xFF617081,0xFF617081,0xFF607180,
+   0xFF60717F,0xFF5F727E,0xFF5F727E,0xFF5F727E,0xFF60727F,0xFF607280,0xFF5F737F,
+   0xFF657985,0xFF4B5D6A,0xFF2F3D4A,0xFF4C5B68,0xFF616E7A,0xFF5F6B78,0xFF5F6B79,
+   0xFF5F6B79,0xFF5F6B79,0xFF63707E,0xFF5E6A79,0xFF333E4E,0xFF313C4C,0xFF526072,
+   0xFF627183,0xFF657487,0xFF657487,0xFF657487,0xFF657487,0xFF657487,0xFF657486,
+   0xFF647586,0xFF647585,0xFF637684,0xFF617881,0xFF60797F,0xFF60797F,0xFF617881,
+   0xFF5C717B,0xFF556974,0xFF5B727A,0xFF597477,0xFF587575,0xFF587476,0xFF597476,
+   0xFF597377,0xFF597378,0xFF5A7378,0xFF5D757A,0xFF4A6367,0xFF3C545B,0xFF5C7681,
+   0xFF5B7681,0xFF5B7680,0xFF5D7A82,0xFF5D7B7F,0xFF405C5C,0xFF54726F,0xFF587673,
+   0xFF567572,0xFF557371,0xFF557172,0xFF566F73,0xFF576F75,0xFF576F74,0xFF576F75,
+   0xFF576F75,0xFF576F75,0xFF576F75,0xFF567073,0xFF557072,0xFF557072,0xFF567073,
+   0xFF566E73,0xFF566E74,0xFF586D76,0xFF5E727E,0xFF435461,0xFF354351,0xFF596A78,
+   0xFF5E6F7E,0xFF5E6F7D,0xFF5E707E,0xFF617281,0xFF647585,0xFF657685,0xFF647585,
+   0xFF647484,0xFF647384,0xFF647385,0xFF647385,0xFF647385,0xFF647385,0xFF647385,
+   0xFF647385,0xFF647384,0xFF627183,0xFF617081,0xFF617081,0xFF617081,0xFF617081,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617080,0xFF607180,0xFF607181,
+   0xFF617281,0xFF617281,0xFF657986,0xFF495B69,0xFF334250,0xFF5A6B7A,0xFF617481,
+   0xFF60737F,0xFF5F737F,0xFF5F747F,0xFF5F747E,0xFF60757F,0xFF677D87,0xFF435761,
+   0xFF2A3B44,0xFF4A6068,0xFF5E757D,0xFF617980,0xFF60797F,0xFF607880,0xFF617881,
+   0xFF617880,0xFF617880,0xFF607980,0xFF607880,0xFF617880,0xFF607980,0xFF60797F,
+   0xFF60797F,0xFF617880,0xFF5B727A,0xFF546B72,0xFF5B727A,0xFF5A7379,0xFF5A7378,
+   0xFF5A7378,0xFF597477,0xFF597377,0xFF597377,0xFF597476,0xFF5C7679,0xFF4A6367,
+   0xFF3C5356,0xFF5A7477,0xFF5A7476,0xFF597475,0xFF5D777A,0xFF5E797F,0xFF425C65,
+   0xFF56737B,0xFF5A787E,0xFF58777D,0xFF57747C,0xFF56727B,0xFF56727B,0xFF56727B,
+   0xFF55737A,0xFF55737A,0xFF56737B,0xFF56737B,0xFF56727B,0xFF56727C,0xFF57727C,
+   0xFF57727D,0xFF58717E,0xFF57707C,0xFF56707C,0xFF57707C,0xFF5C7783,0xFF415864,
+   0xFF344551,0xFF586B77,0xFF5E707D,0xFF5D6F7D,0xFF5E6F7E,0xFF617281,0xFF647485,
+   0xFF657686,0xFF647585,0xFF637484,0xFF637483,0xFF637484,0xFF637483,0xFF627583,
+   0xFF637483,0xFF637484,0xFF637484,0xFF637384,0xFF627282,0xFF617081,0xFF617081,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF607180,0xFF60717F,0xFF60717F,
+   0xFF60717F,0xFF5F727F,0xFF607380,0xFF607380,0xFF657985,0xFF495B68,0xFF32414E,
+   0xFF586672,0xFF5F6D79,0xFF5E6C78,0xFF5F6B78,0xFF5F6B79,0xFF5F6B79,0xFF606C7A,
+   0xFF677482,0xFF44505F,0xFF2A3342,0xFF333F4F,0xFF455264,0xFF5A687B,0xFF647386,
+   0xFF667588,0xFF657487,0xFF657487,0xFF657487,0xFF657487,0xFF657486,0xFF647585,
+   0xFF637684,0xFF627783,0xFF627783,0xFF5C707C,0xFF556874,0xFF607480,0xFF607680,
+   0xFF5C767B,0xFF5A7578,0xFF5A7478,0xFF5A7378,0xFF5A7279,0xFF5B7279,0xFF5C7279,
+   0xFF5B7178,0xFF3B5158,0xFF526B75,0xFF5D7683,0xFF5C7582,0xFF5B7681,0xFF5A777F,
+   0xFF5F7E83,0xFF547172,0xFF496764,0xFF587673,0xFF577572,0xFF557371,0xFF557072,
+   0xFF567073,0xFF576E75,0xFF576E75,0xFF576F75,0xFF586F76,0xFF586E76,0xFF586E75,
+   0xFF577075,0xFF587175,0xFF587276,0xFF597277,0xFF587076,0xFF576E75,0xFF586C77,
+   0xFF5F727F,0xFF425360,0xFF313F4D,0xFF586977,0xFF5E6F7E,0xFF5E6F7E,0xFF607181,
+   0xFF647484,0xFF657586,0xFF657686,0xFF657686,0xFF657585,0xFF647385,0xFF647385,
+   0xFF647385,0xFF647385,0xFF647385,0xFF647385,0xFF647384,0xFF647384,0xFF637284,
+   0xFF627182,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617080,0xFF607180,
+   0xFF607180,0xFF607180,0xFF60717F,0xFF607180,0xFF617281,0xFF607380,0xFF657885,
+   0xFF465765,0xFF384755,0xFF5E707F,0xFF607381,0xFF60737F,0xFF5F737F,0xFF5F747F,
+   0xFF5F747E,0xFF5F747E,0xFF637A83,0xFF647B85,0xFF40555D,0xFF2F424A,0xFF41565E,
+   0xFF556D74,0xFF60787F,0xFF617980,0xFF617880,0xFF617881,0xFF617881,0xFF607880,
+   0xFF617880,0xFF617881,0xFF617881,0xFF617881,0xFF627882,0xFF5B717B,0xFF546972,
+   0xFF5E757E,0xFF5F777E,0xFF5D757C,0xFF5B747A,0xFF5A7379,0xFF597378,0xFF597377,
+   0xFF597377,0xFF5B7477,0xFF597276,0xFF3A5155,0xFF50696C,0xFF5B7577,0xFF597475,
+   0xFF597574,0xFF597475,0xFF607B7D,0xFF547175,0xFF4A686D,0xFF59797D,0xFF58777C,
+   0xFF57757C,0xFF57727C,0xFF57717D,0xFF57717D,0xFF56727C,0xFF56737C,0xFF57747C,
+   0xFF55737B,0xFF55737B,0xFF57747C,0xFF58747E,0xFF5A7480,0xFF5A7481,0xFF58747F,
+   0xFF57717D,0xFF57707D,0xFF5C7783,0xFF405662,0xFF30404B,0xFF576976,0xFF5E707D,
+   0xFF5E707D,0xFF607280,0xFF637584,0xFF657686,0xFF657686,0xFF657686,0xFF647585,
+   0xFF637484,0xFF637484,0xFF647384,0xFF637484,0xFF637483,0xFF637483,0xFF637484,
+   0xFF637484,0xFF627383,0xFF617281,0xFF607180,0xFF617080,0xFF617080,0xFF617081,
+   0xFF617081,0xFF617081,0xFF607180,0xFF607180,0xFF60717F,0xFF607180,0xFF607281,
+   0xFF607380,0xFF657885,0xFF455764,0xFF374552,0xFF5C6976,0xFF5F6B78,0xFF5F6B78,
+   0xFF5F6B79,0xFF5F6B79,0xFF5F6B79,0xFF5F6B79,0xFF64707F,0xFF647180,0xFF44505F,
+   0xFF465262,0xFF313C4C,0xFF374354,0xFF4A586A,0xFF5B697C,0xFF637285,0xFF667588,
+   0xFF667588,0xFF657487,0xFF657487,0xFF647585,0xFF647685,0xFF637685,0xFF596B79,
+   0xFF556674,0xFF617582,0xFF627783,0xFF617781,0xFF5F787F,0xFF5E797D,0xFF5E777D,
+   0xFF5D757C,0xFF5C737A,0xFF5C737A,0xFF5E747B,0xFF4A6067,0xFF3E555D,0xFF5C7682,
+   0xFF5C7582,0xFF5C7582,0xFF5B7681,0xFF5B7780,0xFF5B797F,0xFF5D7B7E,0xFF405C5B,
+   0xFF557270,0xFF587574,0xFF577373,0xFF567173,0xFF566F73,0xFF576F75,0xFF586F76,
+   0xFF587076,0xFF597177,0xFF597077,0xFF597077,0xFF5A7178,0xFF5B747A,0xFF5C757B,
+   0xFF5D757C,0xFF5C737B,0xFF597078,0xFF5A6D78,0xFF586A77,0xFF313F4C,0xFF283542,
+   0xFF536371,0xFF5F707F,0xFF607181,0xFF637484,0xFF657686,0xFF667587,0xFF657686,
+   0xFF657686,0xFF657586,0xFF647586,0xFF647385,0xFF647385,0xFF647385,0xFF647385,
+   0xFF647385,0xFF647385,0xFF647385,0xFF657485,0xFF647385,0xFF627183,0xFF617081,
+   0xFF617081,0xFF617080,0xFF607180,0xFF607180,0xFF60717F,0xFF60717F,0xFF5F717F,
+   0xFF607280,0xFF607380,0xFF607380,0xFF647784,0xFF3F4E5D,0xFF3D4C5B,0xFF607280,
+   0xFF607381,0xFF607380,0xFF5F747F,0xFF5F747F,0xFF5F747E,0xFF5E747E,0xFF5E757E,
+   0xFF647B84,0xFF698089,0xFF495E67,0xFF2D4148,0xFF33474E,0xFF465B64,0xFF566D75,
+   0xFF5F777E,0xFF617981,0xFF617981,0xFF607980,0xFF617880,0xFF627782,0xFF637783,
+   0xFF637684,0xFF596B78,0xFF546773,0xFF617582,0xFF627683,0xFF617782,0xFF607880,
+   0xFF5F787F,0xFF5E777E,0xFF5D767C,0xFF5B747A,0xFF5B7379,0xFF5D757A,0xFF496165,
+   0xFF3D5458,0xFF5B7477,0xFF597476,0xFF597475,0xFF597575,0xFF597475,0xFF5A7676,
+   0xFF5C7979,0xFF3F5D5E,0xFF557578,0xFF59787D,0xFF58767C,0xFF57737C,0xFF57717D,
+   0xFF58707F,0xFF58717F,0xFF59737F,0xFF58747F,0xFF57757D,0xFF57757D,0xFF58767F,
+   0xFF5B7881,0xFF5C7883,0xFF5C7883,0xFF5C7783,0xFF597480,0xFF58727E,0xFF556F7B,
+   0xFF2F414C,0xFF283640,0xFF526470,0xFF5E717D,0xFF5F727F,0xFF627582,0xFF647784,
+   0xFF657685,0xFF657686,0xFF657686,0xFF657685,0xFF647585,0xFF637484,0xFF637484,
+   0xFF637484,0xFF637484,0xFF637484,0xFF637484,0xFF637484,0xFF647585,0xFF637484,
+   0xFF627282,0xFF617181,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,
+   0xFF607180,0xFF607180,0xFF607180,0xFF617281,0xFF617281,0xFF657685,0xFF3F4E5D,
+   0xFF3C4857,0xFF5E6A78,0xFF5F6B79,0xFF5F6B79,0xFF5F6B79,0xFF5F6B79,0xFF5F6B79,
+   0xFF5F6B79,0xFF5F6B79,0xFF65717F,0xFF6A7785,0xFF6B7887,0xFF5B6777,0xFF424D5C,
+   0xFF323D4C,0xFF354151,0xFF455264,0xFF526072,0xFF5B6A7D,0xFF617083,0xFF647486,
+   0xFF647586,0xFF607080,0xFF536371,0xFF586977,0xFF647685,0xFF637685,0xFF627782,
+   0xFF617881,0xFF607880,0xFF607980,0xFF607980,0xFF617980,0xFF5F777E,0xFF566F74,
+   0xFF485F65,0xFF30444B,0xFF3D545D,0xFF5C7682,0xFF5D7683,0xFF5C7682,0xFF5C7682,
+   0xFF5B7680,0xFF5A777F,0xFF607D83,0xFF3C5457,0xFF466162,0xFF5A7576,0xFF587374,
+   0xFF577074,0xFF566F73,0xFF576F74,0xFF587076,0xFF597277,0xFF597378,0xFF5A7379,
+   0xFF5B727A,0xFF5C727B,0xFF5C747C,0xFF5D757D,0xFF5F757F,0xFF5E747E,0xFF5C717B,
+   0xFF596D79,0xFF485966,0xFF495967,0xFF32404F,0xFF455363,0xFF617181,0xFF637484,
+   0xFF657686,0xFF657686,0xFF667587,0xFF667586,0xFF667586,0xFF667586,0xFF657586,
+   0xFF647485,0xFF647385,0xFF647385,0xFF647385,0xFF647385,0xFF647385,0xFF647385,
+   0xFF657486,0xFF657486,0xFF647385,0xFF637283,0xFF617181,0xFF607180,0xFF607180,
+   0xFF607180,0xFF607180,0xFF607280,0xFF617382,0xFF617482,0xFF607480,0xFF607580,
+   0xFF5B6E7B,0xFF344350,0xFF425261,0xFF617382,0xFF617281,0xFF607380,0xFF5F737F,
+   0xFF5F747F,0xFF5F747E,0xFF5E747E,0xFF5E757D,0xFF5E757D,0xFF637A82,0xFF6A828B,
+   0xFF5B717A,0xFF41545E,0xFF30424C,0xFF32454E,0xFF41565E,0xFF4E646C,0xFF576E76,
+   0xFF5D757C,0xFF607780,0xFF627783,0xFF5E717E,0xFF526371,0xFF586877,0xFF647685,
+   0xFF647685,0xFF637684,0xFF627683,0xFF617881,0xFF617881,0xFF617981,0xFF617981,
+   0xFF5F777F,0xFF576E75,0xFF485F65,0xFF2F454A,0xFF3C5357,0xFF5A7476,0xFF5A7577,
+   0xFF5A7576,0xFF597575,0xFF597575,0xFF587574,0xFF5E7C7A,0xFF3A5554,0xFF456467,
+   0xFF5A787E,0xFF58767D,0xFF57747C,0xFF57717D,0xFF58717F,0xFF597281,0xFF5A7481,
+   0xFF5A7581,0xFF59777F,0xFF59777F,0xFF5A7880,0xFF5B7882,0xFF5D7984,0xFF5E7985,
+   0xFF5E7886,0xFF5B7583,0xFF58727F,0xFF475D6A,0xFF475C68,0xFF31424D,0xFF435560,
+   0xFF5F737F,0xFF627583,0xFF647784,0xFF647784,0xFF657685,0xFF657686,0xFF657686,
+   0xFF657686,0xFF647585,0xFF637484,0xFF637484,0xFF637483,0xFF637484,0xFF637484,
+   0xFF637484,0xFF637484,0xFF647585,0xFF647585,0xFF647484,0xFF637283,0xFF617082,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF627182,0xFF627283,0xFF627383,
+   0xFF627382,0xFF627382,0xFF5C6D7D,0xFF354252,0xFF424E5D,0xFF5F6B79,0xFF5F6B79,
+   0xFF5F6B79,0xFF5F6B79,0xFF5F6B79,0xFF5F6B79,0xFF5F6B79,0xFF5F6B79,0xFF5F6B79,
+   0xFF626E7D,0xFF626D7C,0xFF697584,0xFF6C7988,0xFF616D7C,0xFF424D5C,0xFF2E3847,
+   0xFF303B4B,0xFF394557,0xFF414E60,0xFF485668,0xFF4A596A,0xFF384553,0xFF4C5B6B,
+   0xFF5C6D7D,0xFF5C6D7D,0xFF5B6E7C,0xFF596F79,0xFF596F78,0xFF596F79,0xFF586E77,
+   0xFF546A72,0xFF4A6068,0xFF40555C,0xFF32484D,0xFF2A3F44,0xFF26373E,0xFF2A3D45,
+   0xFF3B505A,0xFF465C68,0xFF4F6873,0xFF57717C,0xFF5B767F,0xFF5C7680,0xFF5C767F,
+   0xFF364B51,0xFF354C50,0xFF577074,0xFF5A7377,0xFF587075,0xFF576F74,0xFF576F75,
+   0xFF597077,0xFF5A7279,0xFF5B7479,0xFF5B737A,0xFF5D727C,0xFF5D727D,0xFF5E737E,
+   0xFF5F747F,0xFF5F7580,0xFF5F747F,0xFF5D727D,0xFF50636F,0xFF5C6F7C,0xFF6D808F,
+   0xFF495868,0xFF374554,0xFF5F6F80,0xFF657686,0xFF657686,0xFF657586,0xFF667587,
+   0xFF657686,0xFF657586,0xFF657486,0xFF657485,0xFF647385,0xFF647385,0xFF647385,
+   0xFF647385,0xFF647385,0xFF647385,0xFF647385,0xFF657486,0xFF657486,0xFF657486,
+   0xFF647485,0xFF627383,0xFF617281,0xFF607180,0xFF617281,0xFF627382,0xFF637483,
+   0xFF627484,0xFF627583,0xFF617581,0xFF627782,0xFF4C5F6B,0xFF2D3D49,0xFF455664,
+   0xFF617381,0xFF617281,0xFF607280,0xFF5F727F,0xFF5E727E,0xFF5E737D,0xFF5E737C,
+   0xFF5D737B,0xFF5C737A,0xFF5C737A,0xFF60777F,0xFF697F8A,0xFF6E828F,0xFF627682,
+   0xFF41545E,0xFF2C3D46,0xFF2C3F46,0xFF344950,0xFF3D525A,0xFF455963,0xFF485B66,
+   0xFF364651,0xFF4B5C69,0xFF5B6E7C,0xFF5A6E7B,0xFF5B6E7B,0xFF5B6E7C,0xFF5B6E7B,
+   0xFF5A6E7A,0xFF586E78,0xFF546A73,0xFF4A6068,0xFF40555D,0xFF33474F,0xFF2B3F45,
+   0xFF25383D,0xFF293D42,0xFF395053,0xFF435C5E,0xFF4D6868,0xFF557171,0xFF597575,
+   0xFF597675,0xFF597774,0xFF334E4D,0xFF335051,0xFF567579,0xFF59787D,0xFF57757C,
+   0xFF56727B,0xFF57727D,0xFF59747F,0xFF5A7681,0xFF5B7781,0xFF5A7880,0xFF5A7880,
+   0xFF5A7880,0xFF5B7982,0xFF5D7985,0xFF5F7987,0xFF5F7886,0xFF5C7684,0xFF4F6874,
+   0xFF5A7381,0xFF6B8593,0xFF475A67,0xFF364652,0xFF5E717E,0xFF647785,0xFF657685,
+   0xFF657685,0xFF657686,0xFF657686,0xFF657685,0xFF647585,0xFF647584,0xFF637484,
+   0xFF637484,0xFF637484,0xFF637484,0xFF637484,0xFF637484,0xFF637484,0xFF647585,
+   0xFF647585,0xFF647585,0xFF657485,0xFF637284,0xFF627182,0xFF617081,0xFF627182,
+   0xFF637284,0xFF647385,0xFF647386,0xFF637485,0xFF627483,0xFF647585,0xFF4E5D6E,
+   0xFF2F3B4C,0xFF465161,0xFF5F6B79,0xFF5F6B79,0xFF5F6B79,0xFF5E6A78,0xFF5E6A78,
+   0xFF5E6A78,0xFF5E6A78,0xFF5E6978,0xFF5D6977,0xFF5D6977,0xFF5D6877,0xFF5F6B79,
+   0xFF626E7D,0xFF6A7685,0xFF697585,0xFF3D4958,0xFF212937,0xFF1D2533,0xFF232C3B,
+   0xFF2A3444,0xFF2C3747,0xFF283341,0xFF334050,0xFF384555,0xFF394757,0xFF384855,
+   0xFF374A53,0xFF364A52,0xFF374A53,0xFF374A53,0xFF384B53,0xFF3C5057,0xFF3C5158,
+   0xFF3D5458,0xFF425B5E,0xFF465D63,0xFF42585F,0xFF3A4F56,0xFF32464E,0xFF2E424A,
+   0xFF32474E,0xFF3C5158,0xFF41575F,0xFF3C515A,0xFF2A3C44,0xFF2B3F45,0xFF475F64,
+   0xFF5A7277,0xFF597076,0xFF576E74,0xFF576D75,0xFF587076,0xFF5A7278,0xFF5B7479,
+   0xFF5B737A,0xFF5C737B,0xFF5D737D,0xFF5E747E,0xFF5F757F,0xFF5F7480,0xFF607581,
+   0xFF566A76,0xFF556875,0xFF627583,0xFF667888,0xFF627483,0xFF344251,0xFF4F5F70,
+   0xFF657586,0xFF657586,0xFF657486,0xFF657486,0xFF657486,0xFF657485,0xFF657485,
+   0xFF647385,0xFF647385,0xFF647385,0xFF647385,0xFF647385,0xFF647385,0xFF647385,
+   0xFF647385,0xFF657486,0xFF657486,0xFF657486,0xFF647585,0xFF647585,0xFF637484,
+   0xFF627383,0xFF637484,0xFF637484,0xFF627584,0xFF627583,0xFF617582,0xFF627782,
+   0xFF5C707B,0xFF364853,0xFF283742,0xFF455764,0xFF607380,0xFF5F7180,0xFF5F707F,
+   0xFF5F707F,0xFF5E717E,0xFF5D717C,0xFF5D717B,0xFF5C727A,0xFF5C7279,0xFF5C727A,
+   0xFF5D727B,0xFF5F737F,0xFF637683,0xFF6A7F8B,0xFF697F8A,0xFF3C5059,0xFF1F2D35,
+   0xFF1B272F,0xFF212E37,0xFF283641,0xFF2B3945,0xFF26343F,0xFF31424D,0xFF364752,
+   0xFF374953,0xFF374854,0xFF384955,0xFF384955,0xFF384955,0xFF384954,0xFF384B54,
+   0xFF3C4F58,0xFF3D5159,0xFF3E535B,0xFF435A60,0xFF455D62,0xFF40595D,0xFF385153,
+   0xFF30484A,0xFF2B4445,0xFF304849,0xFF395353,0xFF3E5959,0xFF385553,0xFF27403F,
+   0xFF284344,0xFF446466,0xFF58777C,0xFF57747C,0xFF56717B,0xFF56717B,0xFF58737E,
+   0xFF5A7581,0xFF5B7782,0xFF5B7781,0xFF5A7880,0xFF5B7881,0xFF5C7983,0xFF5E7986,
+   0xFF5F7887,0xFF607988,0xFF556E7C,0xFF546C7A,0xFF607A88,0xFF637E8B,0xFF5F7783,
+   0xFF33434F,0xFF4E606E,0xFF647685,0xFF647585,0xFF647585,0xFF647585,0xFF647585,
+   0xFF647584,0xFF647584,0xFF637484,0xFF637484,0xFF637484,0xFF637484,0xFF637484,
+   0xFF637484,0xFF637483,0xFF637484,0xFF647585,0xFF647585,0xFF647585,0xFF647585,
+   0xFF657485,0xFF647385,0xFF637285,0xFF647385,0xFF647386,0xFF647485,0xFF647385,
+   0xFF647385,0xFF647586,0xFF5E6E7F,0xFF384556,0xFF2A3545,0xFF465263,0xFF5F6B79,
+   0xFF5E6A78,0xFF5D6977,0xFF5D6977,0xFF5D6977,0xFF5D6877,0xFF5D6877,0xFF5D6877,
+   0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5F6B79,0xFF616D7C,0xFF6A7686,
+   0xFF4F5A6A,0xFF262F3E,0xFF1B222F,0xFF273140,0xFF374354,0xFF495669,0xFF576577,
+   0xFF5C6B7D,0xFF637385,0xFF647586,0xFF627583,0xFF617881,0xFF617A81,0xFF637B83,
+   0xFF647B84,0xFF667E86,0xFF688188,0xFF678187,0xFF637F82,0xFF627D7F,0xFF637C81,
+   0xFF657C83,0xFF637B81,0xFF60787E,0xFF597077,0xFF4B6169,0xFF3C5159,0xFF2D4048,
+   0xFF25363E,0xFF1B2830,0xFF1F2F35,0xFF32494E,0xFF4E656B,0xFF596F76,0xFF576D74,
+   0xFF566E73,0xFF566F73,0xFF587276,0xFF5A7378,0xFF5B7479,0xFF5B747A,0xFF5D747C,
+   0xFF5E757E,0xFF5E757F,0xFF5F7480,0xFF607481,0xFF50616E,0xFF5D707D,0xFF617482,
+   0xFF627484,0xFF6A7C8C,0xFF435261,0xFF394757,0xFF5E6E7F,0xFF657586,0xFF657486,
+   0xFF657486,0xFF657486,0xFF657486,0xFF657486,0xFF647385,0xFF647385,0xFF647385,
+   0xFF647385,0xFF647385,0xFF647385,0xFF647385,0xFF647385,0xFF657486,0xFF657486,
+   0xFF657486,0xFF657486,0xFF647585,0xFF647584,0xFF637484,0xFF637484,0xFF627583,
+   0xFF627583,0xFF627583,0xFF617682,0xFF627782,0xFF50636F,0xFF4D5F6B,0xFF40525D,
+   0xFF3E4F5B,0xFF5D707D,0xFF5E717E,0xFF5F707F,0xFF5F7080,0xFF5F707F,0xFF5E707D,
+   0xFF5D717B,0xFF5C727A,0xFF5C727A,0xFF5C727A,0xFF5D717B,0xFF5D717C,0xFF5F737F,
+   0xFF617681,0xFF6A808B,0xFF4E636D,0xFF25343D,0xFF19242C,0xFF25333D,0xFF354551,
+   0xFF475965,0xFF546873,0xFF596F78,0xFF5F767F,0xFF617881,0xFF617682,0xFF627684,
+   0xFF637884,0xFF647985,0xFF657A86,0xFF677C88,0xFF6A808A,0xFF69808A,0xFF667C86,
+   0xFF647B82,0xFF637C81,0xFF647D82,0xFF637C80,0xFF5E7A7B,0xFF567272,0xFF486464,
+   0xFF385453,0xFF2A4443,0xFF223938,0xFF192A2C,0xFF1D3134,0xFF304D50,0xFF4C6971,
+   0xFF58737E,0xFF57707C,0xFF576F7C,0xFF58717D,0xFF5A7381,0xFF5C7583,0xFF5C7683,
+   0xFF5C7782,0xFF5C7783,0xFF5D7984,0xFF5E7986,0xFF5F7886,0xFF5F7888,0xFF4F6574,
+   0xFF5C7483,0xFF5F7887,0xFF5F7987,0xFF68818F,0xFF425361,0xFF384856,0xFF5E6F7E,
+   0xFF657585,0xFF647584,0xFF647584,0xFF637684,0xFF637684,0xFF647584,0xFF637583,
+   0xFF637484,0xFF637484,0xFF637484,0xFF637483,0xFF637483,0xFF637483,0xFF637483,
+   0xFF647584,0xFF647584,0xFF647585,0xFF647585,0xFF647585,0xFF647485,0xFF647386,
+   0xFF647386,0xFF647386,0xFF637485,0xFF647385,0xFF647386,0xFF647486,0xFF526172,
+   0xFF4F5D6E,0xFF435061,0xFF3F4B5C,0xFF5C6876,0xFF5D6977,0xFF5D6977,0xFF5D6977,
+   0xFF5D6977,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,
+   0xFF5D6877,0xFF5D6877,0xFF5F6A79,0xFF667281,0xFF515D6D,0xFF293342,0xFF2C3747,
+   0xFF435062,0xFF5F6E80,0xFF6B7A8D,0xFF6B7A8D,0xFF69798B,0xFF677889,0xFF677889,
+   0xFF667988,0xFF657A85,0xFF637A84,0xFF627A83,0xFF627983,0xFF617882,0xFF617881,
+   0xFF5F777E,0xFF5B7579,0xFF5A7377,0xFF5A7278,0xFF5B7378,0xFF5C747A,0xFF5F757C,
+   0xFF62787F,0xFF657C83,0xFF677D85,0xFF5D727B,0xFF3D505A,0xFF273640,0xFF1B272F,
+   0xFF23353B,0xFF364E52,0xFF4F686C,0xFF577074,0xFF556E72,0xFF556E72,0xFF567073,
+   0xFF597276,0xFF5A7479,0xFF5B737A,0xFF5C747C,0xFF5E757E,0xFF5F747F,0xFF607381,
+   0xFF596B79,0xFF50606E,0xFF607380,0xFF617382,0xFF617283,0xFF677A8A,0xFF596A7A,
+   0xFF313E4E,0xFF485767,0xFF637384,0xFF657486,0xFF657486,0xFF657486,0xFF657486,
+   0xFF657486,0xFF647385,0xFF647385,0xFF647385,0xFF647385,0xFF647385,0xFF647385,
+   0xFF647385,0xFF647385,0xFF657485,0xFF657486,0xFF657486,0xFF657486,0xFF647585,
+   0xFF647584,0xFF637484,0xFF627584,0xFF627583,0xFF627583,0xFF627583,0xFF627783,
+   0xFF576B76,0xFF5A6E7A,0xFF697E8A,0xFF627682,0xFF3A4B57,0xFF586B78,0xFF5E717E,
+   0xFF5E717F,0xFF5F7080,0xFF5F7080,0xFF5E707E,0xFF5D717C,0xFF5C727B,0xFF5C727A,
+   0xFF5C717B,0xFF5D717B,0xFF5D717B,0xFF5D717C,0xFF5F737E,0xFF677B87,0xFF516571,
+   0xFF283842,0xFF2A3943,0xFF40525E,0xFF5D707D,0xFF687D88,0xFF677E87,0xFF657D84,
+   0xFF637C83,0xFF637C83,0xFF657A85,0xFF657987,0xFF657985,0xFF637984,0xFF637884,
+   0xFF637784,0xFF627683,0xFF617581,0xFF5F727E,0xFF5D707C,0xFF5C717A,0xFF5C727A,
+   0xFF5D747A,0xFF5D7779,0xFF5F7A7B,0xFF617F7D,0xFF62817E,0xFF587774,0xFF375551,
+   0xFF223B39,0xFF19292C,0xFF22373C,0xFF355057,0xFF506975,0xFF59707E,0xFF576F7C,
+   0xFF576F7C,0xFF59717F,0xFF5B7383,0xFF5C7584,0xFF5C7683,0xFF5C7783,0xFF5D7984,
+   0xFF5E7985,0xFF5E7886,0xFF586F7E,0xFF4E6473,0xFF5E7786,0xFF5F7888,0xFF5F7888,
+   0xFF667E90,0xFF586D7E,0xFF313F4E,0xFF495768,0xFF637384,0xFF647585,0xFF647584,
+   0xFF637684,0xFF637684,0xFF647584,0xFF637483,0xFF637483,0xFF637483,0xFF637484,
+   0xFF637483,0xFF637483,0xFF637483,0xFF637483,0xFF647583,0xFF647584,0xFF647584,
+   0xFF647585,0xFF647584,0xFF647585,0xFF637485,0xFF637485,0xFF647385,0xFF647386,
+   0xFF647386,0xFF657587,0xFF5A697B,0xFF5D6B7E,0xFF6C7B8E,0xFF647486,0xFF3C4859,
+   0xFF586472,0xFF5D6977,0xFF5D6977,0xFF5D6977,0xFF5D6977,0xFF5D6877,0xFF5D6877,
+   0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,
+   0xFF636E7D,0xFF465261,0xFF2F3A4A,0xFF475466,0xFF637283,0xFF667587,0xFF637283,
+   0xFF637283,0xFF637284,0xFF647385,0xFF647485,0xFF637585,0xFF627583,0xFF617682,
+   0xFF617781,0xFF617781,0xFF617781,0xFF607680,0xFF5E747D,0xFF5B7279,0xFF5B7178,
+   0xFF5B7178,0xFF5A7178,0xFF5A7278,0xFF5B7178,0xFF5B7279,0xFF5C7279,0xFF5E727B,
+   0xFF657983,0xFF657984,0xFF455763,0xFF2B3B46,0xFF1D2A33,0xFF25383D,0xFF375053,
+   0xFF506A6D,0xFF566F72,0xFF556E72,0xFF556E72,0xFF577074,0xFF597276,0xFF5A7279,
+   0xFF5C727B,0xFF5E747E,0xFF5E737E,0xFF5F7380,0xFF526371,0xFF586A77,0xFF5E707E,
+   0xFF5F7080,0xFF607282,0xFF637585,0xFF657687,0xFF384556,0xFF354152,0xFF526072,
+   0xFF657486,0xFF657486,0xFF657486,0xFF657486,0xFF657486,0xFF647385,0xFF647385,
+   0xFF647385,0xFF647385,0xFF647385,0xFF647385,0xFF647384,0xFF647384,0xFF647385,
+   0xFF657486,0xFF657486,0xFF657486,0xFF647585,0xFF647584,0xFF637484,0xFF627584,
+   0xFF627584,0xFF627583,0xFF637683,0xFF5A6F7A,0xFF354650,0xFF495C67,0xFF5E737E,
+   0xFF667A87,0xFF42535F,0xFF526571,0xFF5F727F,0xFF5E717F,0xFF5F7080,0xFF5F7080,
+   0xFF5F707E,0xFF5D717C,0xFF5C717B,0xFF5C727A,0xFF5C717B,0xFF5C717B,0xFF5C717B,
+   0xFF5D717C,0xFF5E707D,0xFF637783,0xFF475966,0xFF2E3E4A,0xFF445762,0xFF5F757E,
+   0xFF637882,0xFF5F767E,0xFF5E767D,0xFF5E777D,0xFF5F787E,0xFF60787F,0xFF607781,
+   0xFF617682,0xFF617782,0xFF607781,0xFF617782,0xFF627683,0xFF627583,0xFF607280,
+   0xFF5E6F7E,0xFF5E6E7D,0xFF5D6F7C,0xFF5C707B,0xFF5B717A,0xFF5A7277,0xFF597375,
+   0xFF587574,0xFF597775,0xFF5F7E7B,0xFF5F7F7B,0xFF3E5D59,0xFF263F3F,0xFF1C2C31,
+   0xFF253A41,0xFF38525A,0xFF526B77,0xFF57717C,0xFF56707B,0xFF576F7D,0xFF597080,
+   0xFF5A7382,0xFF5A7581,0xFF5B7682,0xFF5D7884,0xFF5D7885,0xFF5D7885,0xFF506875,
+   0xFF566E7C,0xFF5C7584,0xFF5E7586,0xFF607689,0xFF63798D,0xFF64798E,0xFF384658,
+   0xFF354152,0xFF526171,0xFF647584,0xFF637684,0xFF637683,0xFF637684,0xFF637584,
+   0xFF637583,0xFF627583,0xFF627583,0xFF637483,0xFF637483,0xFF637483,0xFF637482,
+   0xFF637482,0xFF637483,0xFF637584,0xFF647584,0xFF647584,0xFF647584,0xFF647584,
+   0xFF637484,0xFF637485,0xFF647386,0xFF647386,0xFF657487,0xFF5D6C7F,0xFF384454,
+   0xFF4C5A6B,0xFF617083,0xFF69788A,0xFF445062,0xFF525E6D,0xFF5E6A77,0xFF5D6977,
+   0xFF5D6977,0xFF5D6977,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,
+   0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5E6977,0xFF5D6877,0xFF374251,0xFF414E5F,
+   0xFF627183,0xFF657485,0xFF637283,0xFF637282,0xFF637282,0xFF637282,0xFF637383,
+   0xFF637484,0xFF637485,0xFF637584,0xFF627583,0xFF627682,0xFF617681,0xFF617680,
+   0xFF607680,0xFF5E737D,0xFF5C717B,0xFF5C707A,0xFF5B707A,0xFF5B7179,0xFF5B7178,
+   0xFF5A7178,0xFF5B7178,0xFF5C7179,0xFF5C707A,0xFF5D707B,0xFF637582,0xFF657886,
+   0xFF465865,0xFF2A3B45,0xFF1C2A31,0xFF273C40,0xFF3C5558,0xFF526C6F,0xFF556F72,
+   0xFF556E72,0xFF566E72,0xFF576F74,0xFF586F76,0xFF597077,0xFF5C717B,0xFF5D727D,
+   0xFF596D79,0xFF4F616D,0xFF5D6F7B,0xFF5D6F7D,0xFF5E6E7E,0xFF5F6F7F,0xFF607282,
+   0xFF687A8A,0xFF445262,0xFF2C3646,0xFF3C4859,0xFF596879,0xFF657586,0xFF657486,
+   0xFF657486,0xFF657486,0xFF647385,0xFF647385,0xFF647385,0xFF647385,0xFF647385,
+   0xFF647384,0xFF647384,0xFF647384,0xFF647384,0xFF647385,0xFF657486,0xFF657486,
+   0xFF647585,0xFF637684,0xFF637584,0xFF637484,0xFF627584,0xFF627584,0xFF566975,
+   0xFF384A54,0xFF304049,0xFF3B4C56,0xFF43545F,0xFF50626E,0xFF3C4C59,0xFF4F626E,
+   0xFF5F727F,0xFF5F707F,0xFF5F7080,0xFF5F7080,0xFF5E707E,0xFF5D717C,0xFF5D717B,
+   0xFF5C717B,0xFF5C727A,0xFF5C727A,0xFF5C717B,0xFF5D717C,0xFF5E717D,0xFF5D717C,
+   0xFF374754,0xFF3F515D,0xFF5F747E,0xFF61777F,0xFF5F767C,0xFF5F767C,0xFF5E767C,
+   0xFF5E777B,0xFF5E777C,0xFF5E787D,0xFF5F797E,0xFF60787F,0xFF60787F,0xFF5F787E,
+   0xFF617780,0xFF617581,0xFF627482,0xFF607280,0xFF5E6F7E,0xFF5E6E7E,0xFF5E6E7D,
+   0xFF5D6F7B,0xFF5C707B,0xFF5B7179,0xFF597277,0xFF587475,0xFF587574,0xFF577673,
+   0xFF5C7B77,0xFF5E7E7B,0xFF405E5C,0xFF273E40,0xFF1B2C31,0xFF273E44,0xFF3C575E,
+   0xFF536E77,0xFF56717A,0xFF566F7B,0xFF576F7C,0xFF57717D,0xFF58727D,0xFF59737F,
+   0xFF5B7681,0xFF5C7782,0xFF57727E,0xFF4D6572,0xFF5B7482,0xFF5C7383,0xFF5D7385,
+   0xFF5E7386,0xFF607589,0xFF687D92,0xFF435366,0xFF2B3746,0xFF3B4958,0xFF586978,
+   0xFF647684,0xFF637683,0xFF637684,0xFF647584,0xFF637583,0xFF627582,0xFF627582,
+   0xFF627583,0xFF637483,0xFF637482,0xFF637482,0xFF637482,0xFF637482,0xFF637583,
+   0xFF637584,0xFF647584,0xFF647584,0xFF647584,0xFF637484,0xFF637485,0xFF647485,
+   0xFF647386,0xFF586679,0xFF3B4758,0xFF333D4D,0xFF3D495A,0xFF455263,0xFF526071,
+   0xFF3E4B5C,0xFF505C6B,0xFF5E6A78,0xFF5D6977,0xFF5D6977,0xFF5D6977,0xFF5D6877,
+   0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,
+   0xFF5F6A79,0xFF556170,0xFF354050,0xFF5B6A7B,0xFF657485,0xFF637283,0xFF637283,
+   0xFF637283,0xFF627382,0xFF637282,0xFF627382,0xFF627383,0xFF637484,0xFF637484,
+   0xFF637484,0xFF627583,0xFF627582,0xFF627581,0xFF617680,0xFF5E737D,0xFF5D717C,
+   0xFF5C707B,0xFF5C707B,0xFF5C707A,0xFF5B7179,0xFF5A7278,0xFF5B7179,0xFF5C707A,
+   0xFF5D6F7B,0xFF5D6E7C,0xFF5D6D7C,0xFF627382,0xFF657885,0xFF435761,0xFF273940,
+   0xFF1C2B31,0xFF2B4045,0xFF3F585C,0xFF536C70,0xFF576E73,0xFF566D73,0xFF576D74,
+   0xFF576D74,0xFF576D75,0xFF596E78,0xFF5A6F7A,0xFF516470,0xFF526470,0xFF5D6F7B,
+   0xFF5E6E7D,0xFF5E6E7E,0xFF5E6E7E,0xFF5E6E7E,0xFF667787,0xFF4B596A,0xFF26303F,
+   0xFF293443,0xFF404D5E,0xFF5A687A,0xFF657486,0xFF657486,0xFF657486,0xFF647385,
+   0xFF647385,0xFF647385,0xFF647385,0xFF647384,0xFF647384,0xFF647384,0xFF647384,
+   0xFF647384,0xFF647384,0xFF647385,0xFF657486,0xFF647585,0xFF637684,0xFF647584,
+   0xFF637585,0xFF617482,0xFF4C5E6B,0xFF394955,0xFF4B5E69,0xFF637883,0xFF667C87,
+   0xFF5E727D,0xFF445460,0xFF293743,0xFF495A68,0xFF5F7180,0xFF5F7080,0xFF606F80,
+   0xFF5F7080,0xFF5E707E,0xFF5D717C,0xFF5D717B,0xFF5C727A,0xFF5C727A,0xFF5C717A,
+   0xFF5D717B,0xFF5D707C,0xFF60727F,0xFF556974,0xFF33454F,0xFF586C77,0xFF617780,
+   0xFF5E767C,0xFF5E777B,0xFF5E777C,0xFF5D777B,0xFF5D787A,0xFF5D787A,0xFF5C787A,
+   0xFF5D797B,0xFF5E797C,0xFF5E797C,0xFF5E787C,0xFF5F777E,0xFF60777F,0xFF607680,
+   0xFF5F737F,0xFF5E707D,0xFF5E6E7D,0xFF5E6E7E,0xFF5D6F7C,0xFF5D6F7B,0xFF5D6F7C,
+   0xFF5B7179,0xFF597277,0xFF587375,0xFF567473,0xFF557471,0xFF5B7977,0xFF5F7D7C,
+   0xFF3F5B5B,0xFF253B3E,0xFF1C2C32,0xFF2A4248,0xFF3F5B62,0xFF536F77,0xFF56717A,
+   0xFF56707A,0xFF55717A,0xFF56707A,0xFF56717B,0xFF57737D,0xFF58747F,0xFF4F6974,
+   0xFF506975,0xFF5B7482,0xFF5C7383,0xFF5C7384,0xFF5D7285,0xFF5D7286,0xFF657A8F,
+   0xFF4A5B6E,0xFF26303F,0xFF293542,0xFF3E4F5D,0xFF586A78,0xFF637684,0xFF647584,
+   0xFF647585,0xFF637483,0xFF637483,0xFF637483,0xFF637483,0xFF637482,0xFF637482,
+   0xFF637482,0xFF637482,0xFF637482,0xFF637482,0xFF637583,0xFF637684,0xFF647684,
+   0xFF647584,0xFF647585,0xFF647586,0xFF637284,0xFF4E5C6E,0xFF3B4759,0xFF4E5B6D,
+   0xFF667588,0xFF69798B,0xFF616F81,0xFF455263,0xFF2B3545,0xFF4A5666,0xFF5E6A78,
+   0xFF5D6977,0xFF5D6977,0xFF5D6977,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,
+   0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF606C7A,0xFF495563,0xFF3C4858,
+   0xFF627182,0xFF637283,0xFF637283,0xFF637283,0xFF637283,0xFF637282,0xFF637282,
+   0xFF627382,0xFF627382,0xFF637483,0xFF637484,0xFF637484,0xFF637484,0xFF637483,
+   0xFF627582,0xFF617581,0xFF5F737F,0xFF5D707C,0xFF5D6F7B,0xFF5C6F7B,0xFF5C707B,
+   0xFF5C707A,0xFF5B7079,0xFF5C707A,0xFF5C6F7B,0xFF5D6F7C,0xFF5D6E7C,0xFF5D6D7C,
+   0xFF5C6D7C,0xFF617480,0xFF627781,0xFF3C515A,0xFF23323A,0xFF1C2931,0xFF2A3E44,
+   0xFF40565C,0xFF556B72,0xFF576D74,0xFF576C75,0xFF586D75,0xFF586D76,0xFF586D76,
+   0xFF596D78,0xFF4E606C,0xFF576975,0xFF5D6E7B,0xFF5D6D7D,0xFF5E6E7E,0xFF5E6E7E,
+   0xFF5E6E7E,0xFF627182,0xFF455264,0xFF242C3B,0xFF1B2230,0xFF2A3545,0xFF3F4C5E,
+   0xFF576678,0xFF657486,0xFF657486,0xFF647385,0xFF647385,0xFF647385,0xFF647384,
+   0xFF647384,0xFF647384,0xFF647384,0xFF647384,0xFF647384,0xFF647384,0xFF657485,
+   0xFF657486,0xFF657486,0xFF627282,0xFF5C6C7C,0xFF536373,0xFF4B5B6A,0xFF4E5F6C,
+   0xFF607480,0xFF657B86,0xFF607580,0xFF5F737E,0xFF637784,0xFF687C8A,0xFF40505E,
+   0xFF3B4958,0xFF5C6C7C,0xFF607081,0xFF606F81,0xFF607080,0xFF5F707F,0xFF5E707C,
+   0xFF5C717B,0xFF5C727A,0xFF5C727A,0xFF5C727A,0xFF5D717B,0xFF5E707D,0xFF627482,
+   0xFF4A5B68,0xFF394C56,0xFF5F747D,0xFF5F767D,0xFF5D777B,0xFF5D777B,0xFF5D777A,
+   0xFF5D787A,0xFF5C7879,0xFF5B7978,0xFF5B7978,0xFF5C7A79,0xFF5D7A7A,0xFF5D7A7B,
+   0xFF5E797B,0xFF5E787D,0xFF5F787E,0xFF60777F,0xFF5F737E,0xFF5E707C,0xFF5D6F7C,
+   0xFF5E6E7E,0xFF5E6E7D,0xFF5E6E7D,0xFF5E6E7D,0xFF5D6F7C,0xFF5B7179,0xFF597376,
+   0xFF577473,0xFF557471,0xFF567472,0xFF5C7979,0xFF5E7A7B,0xFF395456,0xFF213438,
+   0xFF1B2B2F,0xFF284044,0xFF3E595E,0xFF536F76,0xFF557179,0xFF557179,0xFF56717A,
+   0xFF56717B,0xFF56717B,0xFF57727C,0xFF4B656F,0xFF546E7A,0xFF5B7381,0xFF5B7282,
+   0xFF5C7384,0xFF5D7285,0xFF5D7286,0xFF617589,0xFF455366,0xFF242C3B,0xFF1B232F,
+   0xFF2A3544,0xFF3E4D5D,0xFF566776,0xFF647584,0xFF647585,0xFF637483,0xFF637483,
+   0xFF637484,0xFF647383,0xFF637483,0xFF637482,0xFF637482,0xFF637482,0xFF637482,
+   0xFF637482,0xFF637583,0xFF637683,0xFF637684,0xFF617381,0xFF5C6C7C,0xFF536374,
+   0xFF4C5A6B,0xFF505D6F,0xFF637184,0xFF68788A,0xFF637285,0xFF617082,0xFF657587,
+   0xFF6A7A8C,0xFF424E60,0xFF3B4757,0xFF5A6674,0xFF5D6977,0xFF5D6977,0xFF5D6977,
+   0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5D6877,0xFF5E6A77,0xFF5E6A77,
+   0xFF5E6A77,0xFF5F6B79,0xFF36404E,0xFF465363,0xFF647384,0xFF637283,0xFF637283,
+   0xFF637283,0xFF637282,0xFF627382,0xFF627382,0xFF627382,0xFF627382,0xFF637483,
+   0xFF637484,0xFF637484,0xFF637484,0xFF637483,0xFF627583,0xFF627582,0xFF607380,
+   0xFF5E707D,0xFF5D6F7C,0xFF5D6F7B,0xFF5D6F7C,0xFF5D6F7B,0xFF5C707A,0xFF5C707B,
+   0xFF5D6F7B,0xFF5D6F7B,0xFF5C6E7C,0xFF5D6D7C,0xFF5C6E7C,0xFF5C6E7B,0xFF637782,
+   0xFF5B6F7A,0xFF32444E,0xFF1E2B34,0xFF273740,0xFF2B3C45,0xFF3C4F57,0xFF546971,
+   0xFF586E76,0xFF586D76,0xFF586D77,0xFF596D77,0xFF576B76,0xFF536672,0xFF5C6E7A,
+   0xFF5D6D7B,0xFF5D6D7C,0xFF5E6D7D,0xFF5F6D7E,0xFF606E80,0xFF556375,0xFF384455,
+   0xFF1D2533,0xFF181F2C,0xFF1A222F,0xFF293342,0xFF3C495B,0xFF515F71,0xFF617082,
+   0xFF647385,0xFF647385,0xFF647384,0xFF647384,0xFF647384,0xFF657485,0xFF647384,
+   0xFF637283,0xFF606F80,0xFF5D6B7C,0xFF586778,0xFF526072,0xFF4A586A,0xFF465465,
+   0xFF495667,0xFF576777,0xFF627483,0xFF667986,0xFF627783,0xFF607480,0xFF5E727E,
+   0xFF5E717E,0xFF5E717E,0xFF657886,0xFF5B6C7C,0xFF344251,0xFF4E5D6E,0xFF606F81,
+   0xFF606F81,0xFF5F7080,0xFF5F707F,0xFF5E717C,0xFF5D727B,0xFF5D737B,0xFF5D737B,
+   0xFF5D747B,0xFF5D737B,0xFF5F727E,0xFF617280,0xFF374552,0xFF445661,0xFF60767F,
+   0xFF5E767C,0xFF5D777B,0xFF5D787A,0xFF5D787A,0xFF5D787A,0xFF5C7879,0xFF5B7978,
+   0xFF5B7977,0xFF5C7A78,0xFF5C7A79,0xFF5D7A7A,0xFF5E797B,0xFF5E787D,0xFF5F787E,
+   0xFF60777E,0xFF5F747E,0xFF5D717C,0xFF5D6F7C,0xFF5E6E7D,0xFF5E6E7E,0xFF5E6E7E,
+   0xFF5E6E7E,0xFF5D6F7D,0xFF5C707A,0xFF5A7278,0xFF577374,0xFF567373,0xFF567373,
+   0xFF567373,0xFF5E7B7C,0xFF577275,0xFF2F474A,0xFF1C2D31,0xFF24393C,0xFF283E41,
+   0xFF3A5257,0xFF516D74,0xFF56727A,0xFF56727B,0xFF56717B,0xFF56727B,0xFF54707A,
+   0xFF516B76,0xFF59737F,0xFF5A7381,0xFF5B7282,0xFF5C7284,0xFF5D7285,0xFF5E7386,
+   0xFF53677A,0xFF384455,0xFF1D2533,0xFF181F2C,0xFF1A222F,0xFF283341,0xFF3B4A59,
+   0xFF50606F,0xFF607181,0xFF637484,0xFF637484,0xFF637483,0xFF637383,0xFF637483,
+   0xFF647583,0xFF637482,0xFF627381,0xFF5F707E,0xFF5B6C7A,0xFF566876,0xFF50626F,
+   0xFF485A67,0xFF455563,0xFF485766,0xFF576777,0xFF647385,0xFF68778A,0xFF657487,
+   0xFF637284,0xFF617082,0xFF606F81,0xFF606F81,0xFF677688,0xFF5C6B7E,0xFF354152,
+   0xFF4C5867,0xFF5D6977,0xFF5D6977,0xFF5D6977,0xFF5D6977,0xFF5D6977,0xFF5E6977,
+   0xFF5E6977,0xFF5E6977,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF56626F,0xFF313B49,
+   0xFF4F5C6C,0xFF647384,0xFF637283,0xFF637283,0xFF637283,0xFF637282,0xFF627382,
+   0xFF627382,0xFF627382,0xFF627382,0xFF637483,0xFF637484,0xFF637484,0xFF637484,
+   0xFF637483,0xFF637483,0xFF637483,0xFF617381,0xFF5E707D,0xFF5D6F7B,0xFF5D6F7C,
+   0xFF5E6E7D,0xFF5D6F7C,0xFF5C6F7B,0xFF5D6F7B,0xFF5D6F7B,0xFF5B707A,0xFF5C6F7B,
+   0xFF5D6E7C,0xFF5C6E7C,0xFF5C6E7B,0xFF5C6F7B,0xFF657985,0xFF4A5C68,0xFF2A3944,
+   0xFF455963,0xFF566B75,0xFF42555F,0xFF3A4C56,0xFF4E636C,0xFF586D77,0xFF596C78,
+   0xFF5A6C79,0xFF536572,0xFF596B79,0xFF5B6D7A,0xFF5D6D7B,0xFF5E6D7C,0xFF5F6D7E,
+   0xFF5D6B7D,0xFF505E70,0xFF3C485A,0xFF262F3E,0xFF1A212F,0xFF1B2230,0xFF1B2230,
+   0xFF1B2330,0xFF242E3D,0xFF354152,0xFF475466,0xFF566476,0xFF5B6A7C,0xFF606E80,
+   0xFF606F81,0xFF5D6C7D,0xFF576577,0xFF505E70,0xFF495769,0xFF425061,0xFF3C495A,
+   0xFF364253,0xFF333E4F,0xFF3F4C5D,0xFF5E6D7E,0xFF687889,0xFF677888,0xFF637684,
+   0xFF627582,0xFF617481,0xFF5F7380,0xFF5E717E,0xFF5E717E,0xFF5E717E,0xFF607281,
+   0xFF647586,0xFF3A4958,0xFF3E4C5C,0xFF5D6C7E,0xFF606F81,0xFF5F7080,0xFF5F717E,
+   0xFF5E737D,0xFF5E737C,0xFF5D747C,0xFF5D747B,0xFF5D747B,0xFF5D747C,0xFF5E737D,
+   0xFF576975,0xFF31404D,0xFF4E606C,0xFF61767F,0xFF5E767C,0xFF5E777B,0xFF5D777A,
+   0xFF5D777A,0xFF5D777A,0xFF5D787A,0xFF5C7978,0xFF5B7A77,0xFF5C7A78,0xFF5C7A79,
+   0xFF5D7A7A,0xFF5E797C,0xFF5F787D,0xFF5F787E,0xFF60777E,0xFF5F757E,0xFF5D717C,
+   0xFF5C707B,0xFF5D6E7D,0xFF5E6E7D,0xFF5E6E7D,0xFF5E6E7D,0xFF5D6F7C,0xFF5C6F7B,
+   0xFF5B7079,0xFF587276,0xFF577374,0xFF577374,0xFF577373,0xFF587375,0xFF627C80,
+   0xFF466063,0xFF273C3F,0xFF425C5E,0xFF546E71,0xFF40575C,0xFF374F55,0xFF4C676F,
+   0xFF56727C,0xFF56717C,0xFF57727C,0xFF506A75,0xFF57717D,0xFF597280,0xFF5B7282,
+   0xFF5C7283,0xFF5D7284,0xFF5B7082,0xFF4E6274,0xFF3A4A5C,0xFF252F3E,0xFF1A212F,
+   0xFF1B222F,0xFF1B222F,0xFF1B232F,0xFF242E3C,0xFF344151,0xFF465565,0xFF556575,
+   0xFF5A6B7B,0xFF5F6F7F,0xFF5F7080,0xFF5C6D7C,0xFF566675,0xFF4F5F6E,0xFF485867,
+   0xFF41515F,0xFF3A4B58,0xFF344450,0xFF31404C,0xFF3E4D5A,0xFF5D6E7D,0xFF687989,
+   0xFF677889,0xFF647586,0xFF637385,0xFF637285,0xFF627183,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF627182,0xFF657586,0xFF3B4859,0xFF3D4958,0xFF5A6675,0xFF5D6977,
+   0xFF5D6977,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,
+   0xFF5D6976,0xFF596573,0xFF596573,0xFF35404F,0xFF546171,0xFF647383,0xFF637283,
+   0xFF637283,0xFF637283,0xFF637283,0xFF637282,0xFF627382,0xFF627382,0xFF627382,
+   0xFF637383,0xFF637484,0xFF637484,0xFF637484,0xFF637484,0xFF637483,0xFF637483,
+   0xFF627282,0xFF5F707F,0xFF5D6F7D,0xFF5E6E7D,0xFF5E6E7E,0xFF5D6F7D,0xFF5D6F7C,
+   0xFF5D6F7C,0xFF5C6F7B,0xFF5B707A,0xFF5B707A,0xFF5C6E7C,0xFF5C6E7C,0xFF5C6E7B,
+   0xFF5C6E7B,0xFF60727F,0xFF60727F,0xFF32414D,0xFF51626F,0xFF627682,0xFF647985,
+   0xFF546773,0xFF384955,0xFF465763,0xFF576876,0xFF516271,0xFF50616F,0xFF5B6D7B,
+   0xFF5C6C7B,0xFF5C6C7B,0xFF5A6879,0xFF505D6E,0xFF3F4C5D,0xFF344051,0xFF303B4C,
+   0xFF2E3949,0xFF323E4F,0xFF374254,0xFF384455,0xFF364152,0xFF313C4D,0xFF2F3A4B,
+   0xFF323D4E,0xFF354152,0xFF384456,0xFF3D495B,0xFF3F4B5D,0xFF3B485A,0xFF364254,
+   0xFF2F3A4B,0xFF293242,0xFF232C3A,0xFF1E2634,0xFF262F3F,0xFF414E5F,0xFF627282,
+   0xFF667787,0xFF647585,0xFF637484,0xFF627483,0xFF627483,0xFF617382,0xFF607280,
+   0xFF5F727F,0xFF5F727F,0xFF5F7180,0xFF617282,0xFF617282,0xFF3A4958,0xFF33404F,
+   0xFF506070,0xFF607081,0xFF5F717F,0xFF5F727E,0xFF5E737D,0xFF5E737C,0xFF5D747B,
+   0xFF5D737C,0xFF5E737C,0xFF5D727B,0xFF596E78,0xFF5A6D79,0xFF354552,0xFF536571,
+   0xFF617580,0xFF60757E,0xFF5F767D,0xFF5F767D,0xFF5F767D,0xFF5E767C,0xFF5D777B,
+   0xFF5C7879,0xFF5B7978,0xFF5C7A79,0xFF5C7A7A,0xFF5D7A7A,0xFF5E797B,0xFF5F787D,
+   0xFF5F787E,0xFF5F777E,0xFF5F757E,0xFF5D727C,0xFF5C707B,0xFF5D6F7C,0xFF5D6F7D,
+   0xFF5D6F7C,0xFF5D6F7C,0xFF5D6F7C,0xFF5C6F7B,0xFF5B7079,0xFF597276,0xFF587275,
+   0xFF587375,0xFF577374,0xFF577275,0xFF5C767A,0xFF5C767A,0xFF2F4448,0xFF4D6669,
+   0xFF5F797D,0xFF617C80,0xFF526A70,0xFF364B54,0xFF435B65,0xFF546D7A,0xFF4E6874,
+   0xFF4D6672,0xFF597280,0xFF5A7282,0xFF5A7182,0xFF586D7F,0xFF4E6173,0xFF3E4F61,
+   0xFF344254,0xFF303C4E,0xFF2E3A4C,0xFF333E53,0xFF374357,0xFF384457,0xFF364255,
+   0xFF323D51,0xFF303C4F,0xFF323F51,0xFF354253,0xFF384555,0xFF3D4A5A,0xFF3E4D5C,
+   0xFF3A4958,0xFF354352,0xFF2E3B4A,0xFF273441,0xFF222D39,0xFF1D2833,0xFF25313C,
+   0xFF40505D,0xFF617381,0xFF667786,0xFF647585,0xFF637484,0xFF637484,0xFF627484,
+   0xFF627283,0xFF627182,0xFF617082,0xFF617082,0xFF617082,0xFF627182,0xFF627283,
+   0xFF3B4859,0xFF333E4E,0xFF4F5A69,0xFF5E6A78,0xFF5D6977,0xFF5E6A77,0xFF5E6A77,
+   0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF596572,0xFF586472,0xFF5F6B78,0xFF5D6978,
+   0xFF35404F,0xFF566474,0xFF647383,0xFF637282,0xFF637282,0xFF637282,0xFF637282,
+   0xFF627382,0xFF637282,0xFF637282,0xFF627282,0xFF627282,0xFF637283,0xFF637484,
+   0xFF637484,0xFF637484,0xFF637484,0xFF637484,0xFF627382,0xFF5F7080,0xFF5E6E7E,
+   0xFF5F6D7E,0xFF5E6E7E,0xFF5E6E7D,0xFF5D6F7C,0xFF5D6F7B,0xFF5C6F7B,0xFF5C6F7A,
+   0xFF5C6F7B,0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7C,0xFF5C6E7C,0xFF5C6E7B,0xFF657885,
+   0xFF465563,0xFF495866,0xFF5C6F7B,0xFF5C6F7B,0xFF647785,0xFF5C6F7D,0xFF364553,
+   0xFF354351,0xFF364454,0xFF435262,0xFF4D5C6C,0xFF4C5B6B,0xFF424F60,0xFF3A4657,
+   0xFF3A4658,0xFF434F61,0xFF4A5869,0xFF505E70,0xFF556375,0xFF5A687A,0xFF5F6E80,
+   0xFF616F81,0xFF5F6D7F,0xFF5B697C,0xFF576577,0xFF515F72,0xFF4B586A,0xFF465365,
+   0xFF424F61,0xFF414E60,0xFF404C5E,0xFF3B4759,0xFF323D4E,0xFF252E3D,0xFF19212E,
+   0xFF1A222F,0xFF344050,0xFF586778,0xFF647584,0xFF617381,0xFF617282,0xFF607181,
+   0xFF607181,0xFF607181,0xFF617281,0xFF617282,0xFF617382,0xFF617382,0xFF627383,
+   0xFF617282,0xFF4F6070,0xFF2F3C4B,0xFF25313E,0xFF3D4C5B,0xFF546574,0xFF5F717F,
+   0xFF5F727E,0xFF5E727D,0xFF5E737C,0xFF5E737C,0xFF5D727C,0xFF596E77,0xFF586D76,
+   0xFF5F737E,0xFF5E717D,0xFF354552,0xFF556773,0xFF617580,0xFF60757F,0xFF60757E,
+   0xFF60757E,0xFF5F767D,0xFF5E777C,0xFF5D777B,0xFF5D777A,0xFF5B7878,0xFF5B7878,
+   0xFF5C7979,0xFF5C7A79,0xFF5D797B,0xFF5E787C,0xFF5F787D,0xFF5F787E,0xFF5F767D,
+   0xFF5C737B,0xFF5C707A,0xFF5D6F7C,0xFF5D6F7C,0xFF5D6F7B,0xFF5D6F7C,0xFF5D6F7C,
+   0xFF5C6F7B,0xFF5B707A,0xFF597177,0xFF587276,0xFF587276,0xFF587276,0xFF587276,
+   0xFF597176,0xFF617B80,0xFF42595E,0xFF455B60,0xFF597276,0xFF597277,0xFF627981,
+   0xFF5A7179,0xFF344751,0xFF334550,0xFF344753,0xFF415662,0xFF4B606E,0xFF4B5E6E,
+   0xFF415263,0xFF394959,0xFF3A485B,0xFF425166,0xFF4A586F,0xFF505E75,0xFF55637B,
+   0xFF596880,0xFF5E6D84,0xFF5F6E86,0xFF5D6C84,0xFF5A6980,0xFF55657C,0xFF506076,
+   0xFF4A596F,0xFF455468,0xFF415064,0xFF404F62,0xFF3F4D60,0xFF3A495B,0xFF313F4F,
+   0xFF232F3C,0xFF18222C,0xFF19232D,0xFF32414E,0xFF566875,0xFF647583,0xFF627382,
+   0xFF617282,0xFF607181,0xFF607180,0xFF607181,0xFF617182,0xFF627282,0xFF627283,
+   0xFF627283,0xFF637284,0xFF627182,0xFF505F70,0xFF303B4B,0xFF26303E,0xFF3D4858,
+   0xFF535E6D,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,0xFF5E6A77,
+   0xFF5B6774,0xFF5F6B78,0xFF616D7B,0xFF525E6C,0xFF313B4A,0xFF536172,0xFF647383,
+   0xFF637282,0xFF627382,0xFF627382,0xFF627382,0xFF627382,0xFF627282,0xFF627182,
+   0xFF617180,0xFF617080,0xFF617180,0xFF617181,0xFF617282,0xFF627382,0xFF627383,
+   0xFF627382,0xFF60727F,0xFF5E707E,0xFF5E6F7E,0xFF5E6F7D,0xFF5E6F7D,0xFF5E6F7D,
+   0xFF5D6F7C,0xFF5C707B,0xFF5C6F7B,0xFF5C6F7B,0xFF5D6E7C,0xFF5D6E7D,0xFF5D6E7D,
+   0xFF5D6E7C,0xFF5D6E7C,0xFF5C6E7B,0xFF617281,0xFF566676,0xFF394755,0xFF5A6B79,
+   0xFF5C6D7B,0xFF5C6E7C,0xFF657886,0xFF4D5F6C,0xFF26323E,0xFF1D2633,0xFF2A3544,
+   0xFF2F3A4A,0xFF303B4B,0xFF3C4859,0xFF505E6F,0xFF616F81,0xFF657385,0xFF657486,
+   0xFF657485,0xFF647384,0xFF637182,0xFF627081,0xFF627081,0xFF637182,0xFF657485,
+   0xFF687789,0xFF6B7A8C,0xFF6C7B8D,0xFF6B7B8D,0xFF6A7A8C,0xFF6A7A8C,0xFF6A798C,
+   0xFF677688,0xFF5D6C7E,0xFF404D60,0xFF252E3D,0xFF1C2331,0xFF384455,0xFF596879,
+   0xFF617281,0xFF607180,0xFF607180,0xFF5F7080,0xFF607180,0xFF5F7080,0xFF5F7080,
+   0xFF5C6D7D,0xFF576877,0xFF526272,0xFF4D5C6C,0xFF414F60,0xFF344151,0xFF2B3645,
+   0xFF273240,0xFF2A3644,0xFF374453,0xFF485967,0xFF596C78,0xFF5F737E,0xFF5F737D,
+   0xFF5A6E78,0xFF566A74,0xFF5A6F79,0xFF5F747E,0xFF627681,0xFF526571,0xFF30404C,
+   0xFF51646F,0xFF617680,0xFF60757F,0xFF60757F,0xFF60757E,0xFF5F767D,0xFF5E777B,
+   0xFF5D777B,0xFF5D767A,0xFF5B7678,0xFF5A7776,0xFF5A7677,0xFF5A7777,0xFF5B7778,
+   0xFF5D777A,0xFF5E777C,0xFF5E777C,0xFF5D747B,0xFF5B727A,0xFF5C717A,0xFF5D707C,
+   0xFF5D6F7C,0xFF5D6F7C,0xFF5D6F7D,0xFF5D6F7C,0xFF5C6F7B,0xFF5B707A,0xFF5A7177,
+   0xFF597177,0xFF597177,0xFF597177,0xFF597177,0xFF597176,0xFF5D767B,0xFF536A70,
+   0xFF364951,0xFF576E75,0xFF597077,0xFF5A7079,0xFF637983,0xFF4C606A,0xFF25333D,
+   0xFF1C2731,0xFF293742,0xFF2E3B49,0xFF303D4D,0xFF3B4A5C,0xFF4E5E73,0xFF5E6F84,
+   0xFF627389,0xFF63738A,0xFF64738A,0xFF637289,0xFF617087,0xFF607085,0xFF607085,
+   0xFF617186,0xFF627389,0xFF65778B,0xFF677A8E,0xFF687A90,0xFF687A90,0xFF67798F,
+   0xFF67798F,0xFF67798E,0xFF64768B,0xFF5A6C81,0xFF3F5062,0xFF24303D,0xFF1B242F,
+   0xFF364652,0xFF576A77,0xFF607280,0xFF607181,0xFF607180,0xFF5F7180,0xFF5F7180,
+   0xFF5F7180,0xFF5F707F,0xFF5C6D7D,0xFF576778,0xFF536272,0xFF4D5B6C,0xFF424F60,
+   0xFF354151,0xFF2B3546,0xFF283241,0xFF2B3544,0xFF364151,0xFF485362,0xFF586472,
+   0xFF5F6B78,0xFF5E6A78,0xFF5A6673,0xFF56616F,0xFF606C79,0xFF606C79,0xFF5B6775,
+   0xFF3C4857,0xFF293342,0xFF525F70,0xFF647383,0xFF637282,0xFF627382,0xFF627382,
+   0xFF627382,0xFF627282,0xFF627182,0xFF617081,0xFF607180,0xFF607180,0xFF607180,
+   0xFF607180,0xFF607180,0xFF60717F,0xFF5F727F,0xFF5E717D,0xFF5D707C,0xFF5D707C,
+   0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5C6F7B,
+   0xFF5D6E7C,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,
+   0xFF5F707F,0xFF5D6E7E,0xFF33404F,0xFF4A5969,0xFF5D6E7C,0xFF5C6E7C,0xFF5F717F,
+   0xFF475765,0xFF293643,0xFF2B3745,0xFF374454,0xFF404E5E,0xFF536172,0xFF617082,
+   0xFF627081,0xFF5F6D7E,0xFF5E6C7C,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,
+   0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF606E80,0xFF627082,0xFF627183,
+   0xFF637284,0xFF637284,0xFF637284,0xFF647385,0xFF667587,0xFF6D7D8F,0xFF5D6C7F,
+   0xFF364254,0xFF1E2634,0xFF323E4E,0xFF516071,0xFF607181,0xFF607281,0xFF607180,
+   0xFF5A6B7B,0xFF516171,0xFF495968,0xFF414F60,0xFF3A4758,0xFF394657,0xFF3D4A5C,
+   0xFF414F61,0xFF475669,0xFF4D5D6F,0xFF4F6072,0xFF4F6172,0xFF485969,0xFF3B4A59,
+   0xFF354352,0xFF384754,0xFF475864,0xFF4B5D67,0xFF566A74,0xFF5F737E,0xFF60757F,
+   0xFF60747F,0xFF5C6F7B,0xFF3D4E5A,0xFF293742,0xFF4F626D,0xFF617680,0xFF60757F,
+   0xFF60757F,0xFF60757F,0xFF5F767D,0xFF5E767C,0xFF5C767A,0xFF5C7579,0xFF5B7579,
+   0xFF5A7677,0xFF5A7677,0xFF5A7677,0xFF5A7677,0xFF5A7677,0xFF5B7678,0xFF5B7478,
+   0xFF5B7278,0xFF5B717A,0xFF5C707B,0xFF5D707C,0xFF5D6F7D,0xFF5D6F7D,0xFF5D6F7D,
+   0xFF5D707C,0xFF5C6F7B,0xFF5B7079,0xFF5A7178,0xFF5A7178,0xFF5A7178,0xFF5A7178,
+   0xFF5A7177,0xFF597177,0xFF5B7379,0xFF5A7179,0xFF30424B,0xFF475B65,0xFF5B707A,
+   0xFF5B6F7A,0xFF5E737D,0xFF455964,0xFF293846,0xFF2B3948,0xFF374657,0xFF3F4F62,
+   0xFF516276,0xFF5F7085,0xFF5F7085,0xFF5D6D83,0xFF5C6B82,0xFF5D6B82,0xFF5C6B82,
+   0xFF5C6B82,0xFF5C6C81,0xFF5C6C81,0xFF5C6C81,0xFF5C6C81,0xFF5C6D81,0xFF5C6F82,
+   0xFF5E7184,0xFF5F7186,0xFF607287,0xFF607287,0xFF617287,0xFF617388,0xFF637589,
+   0xFF697D90,0xFF5A6D81,0xFF354557,0xFF1D2733,0xFF31404B,0xFF4F616E,0xFF5F7280,
+   0xFF607281,0xFF5F717F,0xFF5A6C7A,0xFF516270,0xFF495968,0xFF41505F,0xFF394757,
+   0xFF384655,0xFF3C4A5A,0xFF404F5F,0xFF475566,0xFF4D5B6D,0xFF505E70,0xFF505E70,
+   0xFF495768,0xFF3C4859,0xFF364152,0xFF384353,0xFF475260,0xFF4B5663,0xFF56616F,
+   0xFF5F6B78,0xFF4C5866,0xFF4B5765,0xFF3E4959,0xFF293240,0xFF26303E,0xFF4E5C6D,
+   0xFF637383,0xFF627382,0xFF627382,0xFF627381,0xFF627381,0xFF627181,0xFF617081,
+   0xFF617080,0xFF607180,0xFF607180,0xFF607180,0xFF60717F,0xFF5F717F,0xFF5F727E,
+   0xFF5F727D,0xFF5E717C,0xFF5D707B,0xFF5D707C,0xFF5D707D,0xFF5D707C,0xFF5D707C,
+   0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5D6F7C,0xFF5D6E7C,0xFF5D6E7D,0xFF5D6E7D,
+   0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5E6E7D,0xFF667686,0xFF495768,
+   0xFF354151,0xFF516070,0xFF4F5F6E,0xFF425260,0xFF364452,0xFF3F4E5E,0xFF516271,
+   0xFF5A6B7A,0xFF5E6F7E,0xFF5E6F7E,0xFF5D6C7D,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,
+   0xFF5D6B7C,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,
+   0xFF5E6C7D,0xFF606E7F,0xFF617082,0xFF627183,0xFF627182,0xFF627183,0xFF627183,
+   0xFF627182,0xFF627182,0xFF647385,0xFF6B7B8D,0xFF485668,0xFF262F3E,0xFF252E3D,
+   0xFF3D495B,0xFF485667,0xFF475665,0xFF3F4E5D,0xFF3A4857,0xFF3B4B5A,0xFF415263,
+   0xFF495A6D,0xFF56687D,0xFF607489,0xFF677B91,0xFF697D93,0xFF697E93,0xFF697E93,
+   0xFF687F93,0xFF697F93,0xFF6A8094,0xFF697F93,0xFF667B8D,0xFF586D7D,0xFF3B4B5A,
+   0xFF303F4D,0xFF3F505E,0xFF455563,0xFF4D5D6B,0xFF4C5E6A,0xFF3F4F5C,0xFF293643,
+   0xFF25323D,0xFF4C5E6A,0xFF617580,0xFF60747F,0xFF60747F,0xFF60757F,0xFF5F757D,
+   0xFF5D757B,0xFF5C7579,0xFF5C7579,0xFF5B7579,0xFF5B7678,0xFF5B7678,0xFF5A7677,
+   0xFF5A7677,0xFF5A7677,0xFF5A7677,0xFF5A7478,0xFF5B7279,0xFF5C717A,0xFF5D707C,
+   0xFF5D6F7D,0xFF5E6F7D,0xFF5D6F7D,0xFF5D707C,0xFF5C717B,0xFF5C707A,0xFF5B7079,
+   0xFF5B7079,0xFF5B7079,0xFF5A7079,0xFF5A7178,0xFF5A7178,0xFF5A7178,0xFF5B7079,
+   0xFF637982,0xFF465A64,0xFF32434D,0xFF4E626D,0xFF4E616D,0xFF425463,0xFF354758,
+   0xFF3F5163,0xFF506376,0xFF586B7E,0xFF5C6E82,0xFF5D6E83,0xFF5B6C81,0xFF5B6A81,
+   0xFF5C6A81,0xFF5C6A82,0xFF5C6B82,0xFF5C6C82,0xFF5C6C82,0xFF5C6C81,0xFF5C6C81,
+   0xFF5C6C81,0xFF5B6C80,0xFF5B6D80,0xFF5C6F81,0xFF5D7183,0xFF5E7284,0xFF5F7185,
+   0xFF5F7186,0xFF607086,0xFF607086,0xFF5F7086,0xFF617387,0xFF677B8F,0xFF47596C,
+   0xFF25313F,0xFF232F3B,0xFF3B4B58,0xFF465865,0xFF465764,0xFF3F4E5C,0xFF394856,
+   0xFF3C4A59,0xFF425160,0xFF495968,0xFF566676,0xFF607182,0xFF677889,0xFF697A8B,
+   0xFF6A7A8B,0xFF6B7A8C,0xFF6A7A8C,0xFF6B7A8C,0xFF6C7C8D,0xFF6B7B8D,0xFF687789,
+   0xFF5A687A,0xFF3C4858,0xFF313B4A,0xFF3F4A59,0xFF444E5D,0xFF3A4655,0xFF2F3948,
+   0xFF293341,0xFF1D2532,0xFF252F3E,0xFF475465,0xFF627281,0xFF627382,0xFF627382,
+   0xFF627381,0xFF617280,0xFF607180,0xFF617080,0xFF617080,0xFF607180,0xFF607180,
+   0xFF60717F,0xFF5F727E,0xFF5F727E,0xFF5F727E,0xFF5F717D,0xFF5D717C,0xFF5D707C,
+   0xFF5D707C,0xFF5D707C,0xFF5D6F7D,0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5D707C,
+   0xFF5D6F7D,0xFF5C6F7B,0xFF5C6E7C,0xFF5D6E7C,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,
+   0xFF5D6D7C,0xFF5D6C7C,0xFF627282,0xFF566575,0xFF2D3848,0xFF2E3948,0xFF334150,
+   0xFF445362,0xFF5A6A7A,0xFF617382,0xFF617281,0xFF5E6F7E,0xFF5C6D7C,0xFF5C6D7C,
+   0xFF5D6C7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5E6C7D,0xFF5E6C7D,
+   0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5F6E7F,0xFF617082,
+   0xFF627182,0xFF627182,0xFF627182,0xFF627182,0xFF627183,0xFF627183,0xFF627182,
+   0xFF69798A,0xFF5A687A,0xFF313C4D,0xFF1B2230,0xFF222A39,0xFF2E3948,0xFF374555,
+   0xFF48596B,0xFF5A6E80,0xFF63798C,0xFF667B8F,0xFF667A90,0xFF64788E,0xFF62768B,
+   0xFF61758A,0xFF61758A,0xFF61758A,0xFF607689,0xFF607689,0xFF607689,0xFF607689,
+   0xFF61778A,0xFF63798C,0xFF687F91,0xFF687F91,0xFF647A8C,0xFF5F7486,0xFF4F6374,
+   0xFF3C4C5D,0xFF303D4C,0xFF293643,0xFF1D2732,0xFF24303C,0xFF445663,0xFF60737E,
+   0xFF60747F,0xFF60757F,0xFF60757E,0xFF5F747D,0xFF5D747B,0xFF5D747A,0xFF5C747A,
+   0xFF5C7579,0xFF5C7579,0xFF5B7579,0xFF5B7678,0xFF5A7677,0xFF5A7677,0xFF5A7578,
+   0xFF5A7378,0xFF5B7279,0xFF5C717A,0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5D707C,
+   0xFF5C707B,0xFF5C717B,0xFF5C707B,0xFF5C6F7A,0xFF5C6F7A,0xFF5B6F7A,0xFF5B7079,
+   0xFF5B7079,0xFF5B7079,0xFF5B6F79,0xFF5C6E79,0xFF60747F,0xFF536772,0xFF2B3A45,
+   0xFF2D3C49,0xFF334455,0xFF435667,0xFF576B7D,0xFF5F7286,0xFF5F7185,0xFF5C6E83,
+   0xFF5B6C82,0xFF5B6C81,0xFF5B6B81,0xFF5C6A81,0xFF5C6A82,0xFF5C6A82,0xFF5B6B81,
+   0xFF5C6C81,0xFF5C6C81,0xFF5C6C81,0xFF5C6C81,0xFF5C6C81,0xFF5C6C81,0xFF5B6D80,
+   0xFF5B7080,0xFF5C7282,0xFF5E7283,0xFF5E7283,0xFF5E7284,0xFF5F7185,0xFF5F7186,
+   0xFF607087,0xFF607086,0xFF66788E,0xFF57697E,0xFF303E4D,0xFF1A232E,0xFF212C37,
+   0xFF2C3A47,0xFF364553,0xFF485867,0xFF5A6B7B,0xFF647685,0xFF667888,0xFF667787,
+   0xFF647584,0xFF627383,0xFF617282,0xFF617282,0xFF627282,0xFF627182,0xFF627183,
+   0xFF627183,0xFF627183,0xFF637284,0xFF657486,0xFF6A7A8B,0xFF6A7A8C,0xFF667586,
+   0xFF616F80,0xFF526070,0xFF6C7C8D,0xFF5C6A7C,0xFF455263,0xFF323D4E,0xFF2A3444,
+   0xFF3F4C5D,0xFF5F707F,0xFF627382,0xFF627382,0xFF627381,0xFF617280,0xFF607180,
+   0xFF617080,0xFF617081,0xFF607180,0xFF607180,0xFF5F717F,0xFF5E727D,0xFF5F727D,
+   0xFF5F727E,0xFF5E717D,0xFF5D707C,0xFF5D707C,0xFF5D707D,0xFF5E6F7D,0xFF5E6F7D,
+   0xFF5D6F7D,0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5D6F7D,0xFF5D6F7C,0xFF5C6F7B,
+   0xFF5C6F7B,0xFF5D6E7C,0xFF5D6D7D,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5E6D7D,
+   0xFF425061,0xFF293443,0xFF354252,0xFF546473,0xFF627282,0xFF60707F,0xFF5D6E7D,
+   0xFF5D6D7C,0xFF5C6D7C,0xFF5C6D7C,0xFF5C6C7B,0xFF5D6B7B,0xFF5D6B7C,0xFF5D6B7C,
+   0xFF5D6B7C,0xFF5D6B7C,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,
+   0xFF5E6C7D,0xFF5E6C7D,0xFF5F6D7E,0xFF617081,0xFF627182,0xFF627182,0xFF627182,
+   0xFF617282,0xFF617282,0xFF627182,0xFF627182,0xFF657485,0xFF657486,0xFF3C495A,
+   0xFF1E2734,0xFF262F3F,0xFF3E4C5F,0xFF5A6D81,0xFF657B8F,0xFF62788C,0xFF607589,
+   0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF607489,0xFF617589,
+   0xFF607689,0xFF607689,0xFF607689,0xFF607689,0xFF607589,0xFF607488,0xFF5F7587,
+   0xFF5F7587,0xFF617788,0xFF647B8C,0xFF6A8193,0xFF6B8194,0xFF5A6F81,0xFF435564,
+   0xFF313F4D,0xFF293542,0xFF3D4E5B,0xFF5E717C,0xFF61747F,0xFF60757F,0xFF60757E,
+   0xFF5E747D,0xFF5D737C,0xFF5E737C,0xFF5E737C,0xFF5E737C,0xFF5D747B,0xFF5C747A,
+   0xFF5B7579,0xFF5B7578,0xFF5B7579,0xFF5B7479,0xFF5B7379,0xFF5B7179,0xFF5C717A,
+   0xFF5C717B,0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5D707B,0xFF5D707B,0xFF5D707C,
+   0xFF5C6F7B,0xFF5C6F7B,0xFF5C6F7B,0xFF5B6F7A,0xFF5B6F79,0xFF5B6F79,0xFF5B6E79,
+   0xFF5C6F79,0xFF5B6F7A,0xFF40525D,0xFF283542,0xFF354556,0xFF516677,0xFF5E7384,
+   0xFF5D7083,0xFF5C6D82,0xFF5B6C81,0xFF5B6C81,0xFF5B6B82,0xFF5B6B81,0xFF5B6B81,
+   0xFF5C6A82,0xFF5C6A81,0xFF5C6A81,0xFF5B6B80,0xFF5B6C81,0xFF5C6C81,0xFF5C6C81,
+   0xFF5C6C81,0xFF5C6C81,0xFF5B6D80,0xFF5A6E7F,0xFF5A6F7F,0xFF5C7281,0xFF5D7383,
+   0xFF5D7383,0xFF5E7283,0xFF5F7185,0xFF5F7185,0xFF5F7186,0xFF607087,0xFF63738A,
+   0xFF627489,0xFF3B4B5A,0xFF1D2832,0xFF25313D,0xFF3C4D5A,0xFF596C79,0xFF657886,
+   0xFF637483,0xFF607180,0xFF5F7080,0xFF5F7080,0xFF5F707F,0xFF5F707F,0xFF5F7080,
+   0xFF607181,0xFF617282,0xFF627182,0xFF627182,0xFF627183,0xFF627183,0xFF627183,
+   0xFF617082,0xFF617082,0xFF617082,0xFF637283,0xFF667687,0xFF6C7C8D,0xFF637384,
+   0xFF6A798B,0xFF6D7C8E,0xFF5A697B,0xFF384556,0xFF384455,0xFF5D6D7C,0xFF627382,
+   0xFF627382,0xFF627381,0xFF617280,0xFF607180,0xFF607180,0xFF617081,0xFF617080,
+   0xFF607180,0xFF5F727E,0xFF5E737D,0xFF5E727D,0xFF5F727D,0xFF5E717D,0xFF5D707C,
+   0xFF5D707D,0xFF5E6F7E,0xFF5E6F7D,0xFF5E6F7D,0xFF5D6F7D,0xFF5E6F7D,0xFF5D707C,
+   0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5C6F7C,0xFF5C6E7B,0xFF5D6D7C,0xFF5E6C7C,
+   0xFF5E6C7C,0xFF5D6D7C,0xFF5F6E7E,0xFF505F6F,0xFF323E4E,0xFF313D4D,0xFF506071,
+   0xFF607080,0xFF5D6D7D,0xFF5D6D7C,0xFF5D6D7D,0xFF5D6D7C,0xFF5D6D7C,0xFF5C6C7C,
+   0xFF5C6C7B,0xFF5D6B7B,0xFF5D6B7B,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,
+   0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7C,0xFF5E6C7C,0xFF5E6C7C,0xFF5E6C7C,0xFF5E6E7D,
+   0xFF607080,0xFF617282,0xFF617282,0xFF617282,0xFF617282,0xFF617282,0xFF617282,
+   0xFF617282,0xFF627283,0xFF687889,0xFF445264,0xFF293444,0xFF3B495D,0xFF56697F,
+   0xFF63778C,0xFF607488,0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,
+   0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF607589,0xFF607688,0xFF607588,0xFF5F7587,
+   0xFF5F7487,0xFF5F7387,0xFF5F7287,0xFF5F7286,0xFF5E7385,0xFF5E7386,0xFF5E7487,
+   0xFF5E7487,0xFF61778A,0xFF687E90,0xFF6B8193,0xFF596D7F,0xFF374657,0xFF374554,
+   0xFF5C6D7B,0xFF627481,0xFF61747F,0xFF60747E,0xFF5F737D,0xFF5E727D,0xFF5F727D,
+   0xFF5E737D,0xFF5D747B,0xFF5D747B,0xFF5D737C,0xFF5D747A,0xFF5B7579,0xFF5C7579,
+   0xFF5C7479,0xFF5B7279,0xFF5C717A,0xFF5C717A,0xFF5C707B,0xFF5D707C,0xFF5D707C,
+   0xFF5D707C,0xFF5D6F7D,0xFF5E6F7D,0xFF5D6F7D,0xFF5D6F7C,0xFF5C6F7C,0xFF5C6E7B,
+   0xFF5C6E7A,0xFF5C6E7A,0xFF5C6E7A,0xFF5C6E7A,0xFF5D707A,0xFF4D616B,0xFF30404C,
+   0xFF303F4E,0xFF4F6274,0xFF5C7082,0xFF5B6E80,0xFF5B6D81,0xFF5C6C82,0xFF5C6C82,
+   0xFF5C6C81,0xFF5B6B81,0xFF5B6B81,0xFF5B6B81,0xFF5C6A82,0xFF5C6A81,0xFF5B6B81,
+   0xFF5B6B80,0xFF5B6B80,0xFF5C6C81,0xFF5C6C81,0xFF5B6D80,0xFF5B6D80,0xFF5B6D80,
+   0xFF5A6E7E,0xFF5A707E,0xFF5C7181,0xFF5D7382,0xFF5D7383,0xFF5E7283,0xFF5E7284,
+   0xFF5F7185,0xFF5F7185,0xFF607086,0xFF617188,0xFF66778D,0xFF435464,0xFF283541,
+   0xFF394A57,0xFF556876,0xFF627582,0xFF607180,0xFF5F7080,0xFF5F707F,0xFF5F707F,
+   0xFF5F707F,0xFF5F707F,0xFF5F707F,0xFF5F707F,0xFF5F7080,0xFF607181,0xFF617182,
+   0xFF617181,0xFF617081,0xFF616F81,0xFF606F81,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF627183,0xFF6B7B8D,
+   0xFF5A697B,0xFF354252,0xFF566676,0xFF617282,0xFF617281,0xFF617281,0xFF607180,
+   0xFF607180,0xFF607180,0xFF617081,0xFF617081,0xFF607180,0xFF5F727E,0xFF5E737D,
+   0xFF5E737D,0xFF5E727D,0xFF5E717D,0xFF5D707D,0xFF5E6F7D,0xFF5E6F7E,0xFF5E6F7E,
+   0xFF5E6F7E,0xFF5E6F7D,0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5E6F7D,0xFF5D707C,
+   0xFF5C6F7B,0xFF5C6E7A,0xFF5D6D7B,0xFF5E6C7C,0xFF5D6D7C,0xFF5E6D7D,0xFF5C6B7B,
+   0xFF3E4C5C,0xFF2E3A4A,0xFF465465,0xFF5F6F7F,0xFF5D6D7D,0xFF5D6D7D,0xFF5D6D7D,
+   0xFF5D6D7C,0xFF5D6C7C,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,
+   0xFF5C6C7B,0xFF5D6B7B,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5E6C7D,0xFF5D6D7C,
+   0xFF5D6D7C,0xFF5E6D7C,0xFF5E6E7D,0xFF5F707F,0xFF607180,0xFF607181,0xFF617282,
+   0xFF617282,0xFF617282,0xFF617282,0xFF617282,0xFF617282,0xFF617282,0xFF657686,
+   0xFF435263,0xFF334153,0xFF526579,0xFF62778B,0xFF607488,0xFF607488,0xFF5F7388,
+   0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,
+   0xFF5E7487,0xFF5F7386,0xFF5E7386,0xFF5E7386,0xFF5F7286,0xFF5F7287,0xFF5F7287,
+   0xFF5F7287,0xFF5F7287,0xFF5E7386,0xFF5E7487,0xFF5E7487,0xFF5E7486,0xFF5E7486,
+   0xFF607689,0xFF698093,0xFF596C80,0xFF354354,0xFF566576,0xFF627282,0xFF617280,
+   0xFF60737F,0xFF5F727E,0xFF5F727E,0xFF5F727D,0xFF5E737C,0xFF5D737C,0xFF5E737C,
+   0xFF5E737C,0xFF5D747A,0xFF5C7579,0xFF5C7579,0xFF5C737A,0xFF5C727A,0xFF5C717A,
+   0xFF5C717B,0xFF5D707C,0xFF5D6F7D,0xFF5D707C,0xFF5E6F7D,0xFF5E6F7E,0xFF5E6F7E,
+   0xFF5E6F7D,0xFF5D6F7D,0xFF5D6E7C,0xFF5D6D7B,0xFF5D6D7B,0xFF5D6D7B,0xFF5D6D7B,
+   0xFF5D6E7B,0xFF5A6D78,0xFF3B4E59,0xFF2D3B49,0xFF455569,0xFF5D6F83,0xFF5B6D81,
+   0xFF5B6D81,0xFF5B6D81,0xFF5B6C81,0xFF5B6B81,0xFF5B6B81,0xFF5B6B81,0xFF5B6B81,
+   0xFF5B6B81,0xFF5B6B81,0xFF5B6B81,0xFF5B6B81,0xFF5B6B81,0xFF5B6B80,0xFF5B6C80,
+   0xFF5B6D80,0xFF5B6D80,0xFF5B6D7F,0xFF5A6E7F,0xFF5B6F7F,0xFF5B717F,0xFF5C7281,
+   0xFF5C7282,0xFF5E7283,0xFF5E7284,0xFF5E7284,0xFF5E7284,0xFF5F7185,0xFF5F7186,
+   0xFF607087,0xFF63748B,0xFF435365,0xFF32414E,0xFF516370,0xFF617481,0xFF5F7280,
+   0xFF607181,0xFF607080,0xFF5F7080,0xFF5F7080,0xFF5F7080,0xFF5F707F,0xFF5F707F,
+   0xFF5F7080,0xFF5F7080,0xFF5F7080,0xFF5F6F7F,0xFF5F6F7F,0xFF606E7F,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF617182,0xFF6A7A8B,0xFF404E5E,0xFF435262,
+   0xFF5F7080,0xFF5F7080,0xFF5F7080,0xFF607180,0xFF607180,0xFF617080,0xFF617081,
+   0xFF617081,0xFF607180,0xFF5F727E,0xFF5E737D,0xFF5E727D,0xFF5F727D,0xFF5E717D,
+   0xFF5D707D,0xFF5D707C,0xFF5D707C,0xFF5E6F7D,0xFF5E6F7D,0xFF5D6F7D,0xFF5D707C,
+   0xFF5D707C,0xFF5D707C,0xFF5E6F7D,0xFF5D6F7C,0xFF5C6F7B,0xFF5C6E7B,0xFF5D6D7B,
+   0xFF5D6D7C,0xFF5D6D7C,0xFF5F6F7E,0xFF4F5D6E,0xFF323E4F,0xFF364353,0xFF566575,
+   0xFF5E6E7D,0xFF5D6D7D,0xFF5D6C7C,0xFF5D6C7C,0xFF5C6C7C,0xFF5C6C7B,0xFF5D6B7B,
+   0xFF5D6B7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5D6B7B,0xFF5D6B7B,0xFF5D6B7B,
+   0xFF5D6B7C,0xFF5D6B7C,0xFF5E6C7D,0xFF5E6C7C,0xFF5E6D7D,0xFF5F6F7E,0xFF607180,
+   0xFF607180,0xFF607180,0xFF607180,0xFF617281,0xFF617282,0xFF617282,0xFF617281,
+   0xFF617281,0xFF617282,0xFF627383,0xFF627383,0xFF3E4E5E,0xFF38495A,0xFF5C7285,
+   0xFF607589,0xFF607488,0xFF607488,0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,
+   0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5E7487,0xFF5E7386,0xFF5E7386,0xFF5F7286,
+   0xFF5F7286,0xFF5F7287,0xFF5F7287,0xFF5F7287,0xFF5F7287,0xFF5F7287,0xFF5F7387,
+   0xFF5E7487,0xFF5E7487,0xFF5E7487,0xFF5E7487,0xFF5E7487,0xFF607589,0xFF697D93,
+   0xFF404F63,0xFF445263,0xFF606F81,0xFF5F7080,0xFF5E717E,0xFF5E737D,0xFF5E737D,
+   0xFF5E727D,0xFF5F727D,0xFF5F727D,0xFF5E727D,0xFF5E737C,0xFF5D747A,0xFF5C757A,
+   0xFF5C747A,0xFF5D727B,0xFF5C717B,0xFF5C717B,0xFF5C707B,0xFF5D707C,0xFF5E6F7D,
+   0xFF5E6F7D,0xFF5E6F7E,0xFF5E6F7E,0xFF5E6F7D,0xFF5E6F7D,0xFF5D6F7D,0xFF5C6E7B,
+   0xFF5C6E7B,0xFF5D6D7B,0xFF5D6D7B,0xFF5D6D7B,0xFF5F6F7E,0xFF4E5E6D,0xFF313F4D,
+   0xFF364557,0xFF54657A,0xFF5C6D82,0xFF5C6C81,0xFF5B6C81,0xFF5B6C80,0xFF5A6C80,
+   0xFF5B6B81,0xFF5B6B81,0xFF5C6A81,0xFF5C6A82,0xFF5C6A81,0xFF5B6B81,0xFF5B6B81,
+   0xFF5B6B81,0xFF5B6B80,0xFF5B6B80,0xFF5A6C7F,0xFF5A6D7F,0xFF5A6E7F,0xFF5B6F7F,
+   0xFF5B7080,0xFF5B7280,0xFF5B7380,0xFF5C7280,0xFF5C7282,0xFF5D7283,0xFF5E7284,
+   0xFF5E7284,0xFF5E7284,0xFF5F7185,0xFF5F7186,0xFF617187,0xFF617288,0xFF3E4E60,
+   0xFF384854,0xFF5C6F7C,0xFF5F727F,0xFF5F727F,0xFF5F7280,0xFF5F7180,0xFF5F7080,
+   0xFF5F7080,0xFF606F80,0xFF606F80,0xFF606F80,0xFF606F81,0xFF606F81,0xFF606F7F,
+   0xFF5F6F7F,0xFF606E7F,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF667587,0xFF5E6D7E,0xFF354251,0xFF50606F,0xFF607081,0xFF607080,
+   0xFF617080,0xFF617080,0xFF617081,0xFF617081,0xFF617081,0xFF607180,0xFF5F717F,
+   0xFF5F727E,0xFF5F727E,0xFF5F727E,0xFF5E717D,0xFF5D707C,0xFF5C707B,0xFF5C707B,
+   0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5D707C,0xFF5D6F7D,0xFF5E6F7D,
+   0xFF5D6F7C,0xFF5D6E7B,0xFF5D6D7B,0xFF5D6D7C,0xFF5D6D7C,0xFF5E6E7D,0xFF596978,
+   0xFF3B4A5A,0xFF2B3646,0xFF404E5F,0xFF5C6B7B,0xFF5D6D7C,0xFF5D6D7C,0xFF5C6C7C,
+   0xFF5C6C7B,0xFF5C6C7B,0xFF5D6B7B,0xFF5C6C7B,0xFF5D6B7C,0xFF5D6B7B,0xFF5C6C7B,
+   0xFF5C6C7B,0xFF5D6B7B,0xFF5D6B7B,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6C7C,
+   0xFF5F6E7E,0xFF5F707F,0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607180,
+   0xFF607181,0xFF617282,0xFF617282,0xFF617281,0xFF617281,0xFF617281,0xFF637483,
+   0xFF5E6F7F,0xFF374759,0xFF3D4E60,0xFF5E7386,0xFF5F7588,0xFF5F7588,0xFF607488,
+   0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,
+   0xFF5E7387,0xFF5E7386,0xFF5F7286,0xFF5F7287,0xFF5F7286,0xFF5F7286,0xFF5F7287,
+   0xFF5F7287,0xFF5F7287,0xFF5F7387,0xFF607387,0xFF5F7387,0xFF5E7487,0xFF5E7487,
+   0xFF5F7387,0xFF5F7388,0xFF5F7388,0xFF65798F,0xFF5D7086,0xFF354355,0xFF515F70,
+   0xFF607081,0xFF5F717F,0xFF5E737D,0xFF5E737D,0xFF5F727D,0xFF5F717F,0xFF60717F,
+   0xFF5F727E,0xFF5D737B,0xFF5D747B,0xFF5D747B,0xFF5D737B,0xFF5D727C,0xFF5D707C,
+   0xFF5C707B,0xFF5C707B,0xFF5D707C,0xFF5E6F7D,0xFF5E6F7E,0xFF5F6E7E,0xFF5E6F7E,
+   0xFF5E6F7D,0xFF5E6F7D,0xFF5D6F7C,0xFF5C6F7B,0xFF5C6E7A,0xFF5C6E7B,0xFF5D6D7B,
+   0xFF5E6E7D,0xFF596878,0xFF3C495A,0xFF2B3748,0xFF415065,0xFF5B6B80,0xFF5C6C82,
+   0xFF5C6C82,0xFF5B6B81,0xFF5B6B81,0xFF5B6B80,0xFF5B6B81,0xFF5C6A81,0xFF5C6A82,
+   0xFF5C6A82,0xFF5C6A81,0xFF5C6A81,0xFF5C6A82,0xFF5C6A81,0xFF5B6B80,0xFF5B6B80,
+   0xFF5A6C7F,0xFF5A6D7F,0xFF5B6F80,0xFF5B7180,0xFF5C7281,0xFF5C7280,0xFF5B737F,
+   0xFF5B7380,0xFF5C7281,0xFF5C7282,0xFF5E7283,0xFF5E7284,0xFF5E7284,0xFF5F7185,
+   0xFF5F7186,0xFF617288,0xFF5D6E85,0xFF384758,0xFF3C4D59,0xFF5E717D,0xFF5F727F,
+   0xFF5F727F,0xFF5F727F,0xFF5E717F,0xFF5F707F,0xFF5F7080,0xFF606F80,0xFF606F81,
+   0xFF606F81,0xFF606F81,0xFF606F80,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF606E7F,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF616F81,0xFF606F81,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF617082,0xFF6A7A8B,
+   0xFF445262,0xFF374453,0xFF5B6A7B,0xFF617081,0xFF617081,0xFF617081,0xFF617081,
+   0xFF617081,0xFF607180,0xFF60717F,0xFF60717F,0xFF5F727E,0xFF5F727E,0xFF5F727E,
+   0xFF5E717D,0xFF5D717B,0xFF5C707B,0xFF5C707B,0xFF5D707C,0xFF5D707C,0xFF5D707C,
+   0xFF5D707B,0xFF5D707B,0xFF5D707C,0xFF5E6F7D,0xFF5E6F7D,0xFF5D6D7C,0xFF5D6D7C,
+   0xFF5D6D7C,0xFF5D6D7C,0xFF5E6E7E,0xFF455564,0xFF2A3644,0xFF2A3745,0xFF495968,
+   0xFF5E6E7C,0xFF5D6D7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,
+   0xFF5D6B7B,0xFF5C6B7B,0xFF5C6B7A,0xFF5B6B7A,0xFF5C6B7A,0xFF5D6B7B,0xFF5D6B7C,
+   0xFF5D6B7C,0xFF5D6B7B,0xFF5D6C7C,0xFF5E6E7D,0xFF60707F,0xFF607180,0xFF607180,
+   0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607181,
+   0xFF617281,0xFF617281,0xFF617281,0xFF647584,0xFF586878,0xFF324152,0xFF415366,
+   0xFF5E7487,0xFF5F7588,0xFF607489,0xFF607488,0xFF5F7488,0xFF5F7387,0xFF5F7387,
+   0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7387,0xFF5E7386,0xFF5F7287,
+   0xFF5F7287,0xFF5F7287,0xFF5F7287,0xFF5F7287,0xFF5F7287,0xFF5F7287,0xFF5F7387,
+   0xFF5F7487,0xFF5F7387,0xFF5F7387,0xFF5F7387,0xFF5F7388,0xFF5F7388,0xFF5F7388,
+   0xFF607489,0xFF697D93,0xFF445468,0xFF374455,0xFF5B6A7C,0xFF617181,0xFF60717F,
+   0xFF5F727E,0xFF60717F,0xFF607180,0xFF607180,0xFF5F727E,0xFF5E737C,0xFF5D747B,
+   0xFF5E737C,0xFF5E737D,0xFF5E717D,0xFF5E707D,0xFF5D6F7C,0xFF5D707B,0xFF5D707C,
+   0xFF5E6F7E,0xFF5F6E7E,0xFF5F6E7E,0xFF5F6E7E,0xFF5E6F7E,0xFF5E6F7D,0xFF5D6F7C,
+   0xFF5C6E7A,0xFF5C6E7A,0xFF5C6E7A,0xFF5D6D7B,0xFF5F6E7E,0xFF465465,0xFF2A3545,
+   0xFF2B3649,0xFF4A5970,0xFF5D6C83,0xFF5C6C82,0xFF5B6B81,0xFF5B6B81,0xFF5B6B80,
+   0xFF5B6B80,0xFF5B6B80,0xFF5C6A81,0xFF5C6A81,0xFF5B6981,0xFF5B6981,0xFF5B6981,
+   0xFF5C6A82,0xFF5B6B81,0xFF5B6B80,0xFF5B6B80,0xFF5A6D7F,0xFF5B6F7F,0xFF5C7180,
+   0xFF5C7281,0xFF5C7280,0xFF5C7280,0xFF5B7380,0xFF5C7280,0xFF5C7281,0xFF5C7282,
+   0xFF5D7183,0xFF5D7184,0xFF5E7284,0xFF5F7185,0xFF5F7186,0xFF627389,0xFF57687D,
+   0xFF324150,0xFF41515E,0xFF5E717E,0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF5E717E,
+   0xFF5E717F,0xFF5F707F,0xFF5F7080,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F80,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF616F81,0xFF616F81,0xFF616F81,0xFF606F81,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF667587,0xFF526172,0xFF2E3949,0xFF4C5B6C,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF607180,0xFF60717F,
+   0xFF60717F,0xFF5F727E,0xFF5F727E,0xFF5F717E,0xFF5E717C,0xFF5C707A,0xFF5C707A,
+   0xFF5C6F7A,0xFF5D6F7B,0xFF5D6F7C,0xFF5D707B,0xFF5C707B,0xFF5C717A,0xFF5C707B,
+   0xFF5D6F7B,0xFF5D6D7B,0xFF5C6D7B,0xFF5C6D7B,0xFF5D6D7B,0xFF5E6F7D,0xFF516170,
+   0xFF32414F,0xFF2D3B48,0xFF303F4C,0xFF50606E,0xFF5D6D7C,0xFF5C6C7A,0xFF5B6C79,
+   0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7A,0xFF5C6B7A,0xFF5B6B7A,0xFF5B6B7A,
+   0xFF5A6A79,0xFF5A6A79,0xFF5B6A7A,0xFF5C6B7A,0xFF5C6C7B,0xFF5D6D7C,0xFF5E6F7E,
+   0xFF607080,0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607180,
+   0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607280,0xFF607280,
+   0xFF647584,0xFF4D5D6C,0xFF2F3D4D,0xFF46586B,0xFF5F7588,0xFF5F7588,0xFF5F7588,
+   0xFF5F7487,0xFF5E7386,0xFF5D7386,0xFF5E7286,0xFF5E7287,0xFF5F7387,0xFF5F7388,
+   0xFF5F7388,0xFF5F7387,0xFF5F7286,0xFF5F7286,0xFF5F7287,0xFF5F7287,0xFF5F7287,
+   0xFF5F7287,0xFF5F7287,0xFF607388,0xFF607388,0xFF5F7487,0xFF5F7487,0xFF5F7487,
+   0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF65798F,0xFF516479,
+   0xFF2D3A4B,0xFF4C5A6C,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617080,
+   0xFF607180,0xFF60717F,0xFF5E727D,0xFF5E737D,0xFF5F727D,0xFF5F727E,0xFF5E707D,
+   0xFF5E6E7C,0xFF5E6E7C,0xFF5E6F7C,0xFF5E6E7D,0xFF5F6E7E,0xFF5F6E7E,0xFF5F6E7F,
+   0xFF5F6E7E,0xFF5E6F7E,0xFF5D6E7C,0xFF5C6E7A,0xFF5B6D79,0xFF5C6E7A,0xFF5C6E7A,
+   0xFF5E6E7D,0xFF526171,0xFF344051,0xFF2E3A4A,0xFF323E51,0xFF515F77,0xFF5D6C82,
+   0xFF5A6B7F,0xFF5A6B7F,0xFF5B6B80,0xFF5B6B80,0xFF5B6B80,0xFF5B6B80,0xFF5B6A80,
+   0xFF5A6980,0xFF5B6980,0xFF5A6880,0xFF5A6880,0xFF5A6980,0xFF5B6B80,0xFF5B6C80,
+   0xFF5B6D80,0xFF5C6F81,0xFF5C7180,0xFF5C7281,0xFF5C7281,0xFF5C7281,0xFF5C7280,
+   0xFF5B7380,0xFF5C7280,0xFF5C7281,0xFF5C7282,0xFF5C7283,0xFF5D7183,0xFF5D7184,
+   0xFF5E7184,0xFF5E7085,0xFF627489,0xFF4C5D71,0xFF2F3D4B,0xFF455764,0xFF5F727E,
+   0xFF5F727F,0xFF5F727F,0xFF5F727E,0xFF5E707D,0xFF5D707D,0xFF5E6F7E,0xFF5E6F7F,
+   0xFF5F6F7F,0xFF606F80,0xFF606F81,0xFF606E80,0xFF606E7F,0xFF606E7F,0xFF606E7F,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF616F81,0xFF616F81,0xFF616F81,
+   0xFF616F81,0xFF616F81,0xFF616F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,
+   0xFF647385,0xFF586879,0xFF2F3D4C,0xFF3B4A59,0xFF5E6E7D,0xFF617181,0xFF617180,
+   0xFF607180,0xFF607180,0xFF60717F,0xFF5F717F,0xFF5F717F,0xFF5F727E,0xFF5F717E,
+   0xFF5E717C,0xFF5D6F7B,0xFF5C6F7A,0xFF5C707A,0xFF5D6F7A,0xFF5D6F7B,0xFF5C6F7A,
+   0xFF5C707A,0xFF5C707A,0xFF5C7079,0xFF5B6F78,0xFF5B6D79,0xFF5C6C7A,0xFF5B6D7A,
+   0xFF5B6D7A,0xFF5C6E7A,0xFF576876,0xFF3A4957,0xFF4E606C,0xFF4E616C,0xFF33434F,
+   0xFF51626F,0xFF5B6C7A,0xFF5A6B78,0xFF5A6C78,0xFF5C6C7A,0xFF5C6C7A,0xFF5B6C7A,
+   0xFF5B6C79,0xFF5A6B78,0xFF5A6A78,0xFF5A6A79,0xFF5A6A79,0xFF5A6A79,0xFF5A6A78,
+   0xFF5A6C78,0xFF5C6E7B,0xFF5F707E,0xFF60717F,0xFF607180,0xFF617080,0xFF607180,
+   0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607180,
+   0xFF607180,0xFF607180,0xFF607180,0xFF607280,0xFF627483,0xFF40505E,0xFF2E3C4B,
+   0xFF4A5E71,0xFF607589,0xFF5F7588,0xFF5F7587,0xFF5D7386,0xFF5C7184,0xFF5C7184,
+   0xFF5D7084,0xFF5D7085,0xFF5D7085,0xFF5D7085,0xFF5D7186,0xFF5E7287,0xFF5F7287,
+   0xFF5F7287,0xFF5F7287,0xFF5F7287,0xFF5F7287,0xFF5F7287,0xFF607388,0xFF607388,
+   0xFF607388,0xFF607388,0xFF607387,0xFF607387,0xFF607388,0xFF5F7388,0xFF5F7388,
+   0xFF5F7388,0xFF5F7388,0xFF63778C,0xFF586B80,0xFF303D4F,0xFF3C495A,0xFF5E6D7E,
+   0xFF627182,0xFF617081,0xFF617081,0xFF617081,0xFF607180,0xFF5F717F,0xFF5F727E,
+   0xFF5F727D,0xFF5F727E,0xFF5E707D,0xFF5D6F7C,0xFF5E6E7C,0xFF5E6E7D,0xFF5E6E7D,
+   0xFF5F6D7D,0xFF5F6D7E,0xFF5F6D7E,0xFF5F6D7E,0xFF5F6D7E,0xFF5D6D7C,0xFF5C6D7A,
+   0xFF5B6D79,0xFF5B6D79,0xFF5B6D79,0xFF5D6D7B,0xFF586777,0xFF3B4858,0xFF505E6F,
+   0xFF505E6F,0xFF354255,0xFF526078,0xFF5B6A81,0xFF5A697F,0xFF5A6A7F,0xFF5B6B80,
+   0xFF5B6B80,0xFF5B6B80,0xFF5A6A80,0xFF59697F,0xFF59687F,0xFF5A687F,0xFF59697F,
+   0xFF59697F,0xFF59697F,0xFF5A6A7F,0xFF5B6D80,0xFF5C7082,0xFF5D7183,0xFF5D7182,
+   0xFF5D7182,0xFF5D7182,0xFF5C7281,0xFF5B7380,0xFF5B7380,0xFF5C7281,0xFF5C7281,
+   0xFF5C7281,0xFF5C7282,0xFF5D7183,0xFF5D7184,0xFF5D7184,0xFF5D7184,0xFF607386,
+   0xFF405163,0xFF2E3C4A,0xFF4A5C6A,0xFF5F7380,0xFF5F727F,0xFF5F727E,0xFF5D707C,
+   0xFF5C6E7B,0xFF5C6E7B,0xFF5D6D7B,0xFF5D6D7C,0xFF5D6D7C,0xFF5E6D7D,0xFF5E6D7E,
+   0xFF5F6E7F,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,
+   0xFF616F81,0xFF606F81,0xFF606F81,0xFF606F80,0xFF637283,0xFF5D6C7E,0xFF334150,
+   0xFF2E3C4A,0xFF4A5B6A,0xFF5F6F7E,0xFF627382,0xFF617281,0xFF617280,0xFF617280,
+   0xFF60727F,0xFF5F727F,0xFF5F717E,0xFF5E6F7D,0xFF5D6F7C,0xFF5D6F7A,0xFF5C6F7A,
+   0xFF5C707A,0xFF5D6F7A,0xFF5D6F7A,0xFF5C707A,0xFF5C7079,0xFF5C7079,0xFF5B6F78,
+   0xFF5A6F77,0xFF5A6E78,0xFF5C6C7A,0xFF5B6D7A,0xFF5B6D7A,0xFF5A6C78,0xFF3E4F5B,
+   0xFF465763,0xFF5F737F,0xFF566A75,0xFF33434F,0xFF51626F,0xFF596B77,0xFF596B77,
+   0xFF596B77,0xFF5B6C79,0xFF5B6C79,0xFF5A6B78,0xFF596B78,0xFF586A77,0xFF596A77,
+   0xFF596A78,0xFF5A6A78,0xFF5A6A78,0xFF596B77,0xFF5A6C78,0xFF5D6F7C,0xFF5F727E,
+   0xFF5F727E,0xFF60717F,0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607180,
+   0xFF607180,0xFF607180,0xFF607180,0xFF5F7280,0xFF607180,0xFF607180,0xFF5F7280,
+   0xFF607381,0xFF5D6F7D,0xFF374553,0xFF2F3D4C,0xFF4F6375,0xFF607689,0xFF5F7487,
+   0xFF5D7386,0xFF5C7184,0xFF5C7184,0xFF5C7184,0xFF5D7084,0xFF5D7085,0xFF5D7085,
+   0xFF5D7085,0xFF5D7186,0xFF5E7287,0xFF5E7287,0xFF5F7287,0xFF5F7388,0xFF607388,
+   0xFF607388,0xFF607388,0xFF607388,0xFF607388,0xFF607388,0xFF607388,0xFF607388,
+   0xFF607388,0xFF607388,0xFF607388,0xFF5F7388,0xFF5F7388,0xFF5F7388,0xFF62768B,
+   0xFF5C7085,0xFF334153,0xFF2F3B4B,0xFF4B5A6B,0xFF606E7F,0xFF637283,0xFF627182,
+   0xFF617181,0xFF607280,0xFF60727F,0xFF5F727E,0xFF5F717E,0xFF5E707C,0xFF5D6F7B,
+   0xFF5D6F7B,0xFF5D6F7B,0xFF5E6E7D,0xFF5F6D7E,0xFF5F6D7E,0xFF5F6D7E,0xFF5F6D7E,
+   0xFF5F6D7E,0xFF5E6C7D,0xFF5D6B7C,0xFF5C6C7B,0xFF5C6C7A,0xFF5C6C7A,0xFF5C6D7A,
+   0xFF5B6B7A,0xFF3F4D5D,0xFF475566,0xFF627182,0xFF596878,0xFF354255,0xFF526077,
+   0xFF5A687F,0xFF59687F,0xFF5A697F,0xFF5A6A80,0xFF5A6A80,0xFF5A6A80,0xFF59697F,
+   0xFF58697E,0xFF58687D,0xFF59697F,0xFF59697F,0xFF59697F,0xFF59697F,0xFF5A6A7F,
+   0xFF5C6E81,0xFF5D7183,0xFF5D7183,0xFF5D7182,0xFF5D7182,0xFF5C7282,0xFF5B7380,
+   0xFF5C7280,0xFF5C7281,0xFF5C7281,0xFF5B7380,0xFF5B7381,0xFF5C7282,0xFF5C7282,
+   0xFF5D7183,0xFF5D7183,0xFF5E7285,0xFF5B6F82,0xFF374758,0xFF2F3D4B,0xFF4F616E,
+   0xFF607380,0xFF5F717E,0xFF5E6F7D,0xFF5D6E7B,0xFF5C6E7B,0xFF5D6D7B,0xFF5D6D7C,
+   0xFF5D6D7C,0xFF5D6D7C,0xFF5D6C7C,0xFF5E6D7D,0xFF5F6E7F,0xFF5F6E7F,0xFF606E80,
+   0xFF606F81,0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,
+   0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,0xFF627082,0xFF637284,0xFF637385,
+   0xFF627283,0xFF637283,0xFF606F80,0xFF354252,0xFF222C3A,0xFF2E3B4A,0xFF425160,
+   0xFF566676,0xFF607180,0xFF617281,0xFF617280,0xFF607280,0xFF60727F,0xFF5E707D,
+   0xFF5E6E7C,0xFF5D6F7C,0xFF5C707A,0xFF5C707A,0xFF5C6F7A,0xFF5C7079,0xFF5C7079,
+   0xFF5C7079,0xFF5C7079,0xFF5B7079,0xFF5A7077,0xFF596F76,0xFF5A6E78,0xFF5B6D79,
+   0xFF5B6D7A,0xFF5B6E79,0xFF445661,0xFF3D4E59,0xFF586B76,0xFF5A6D79,0xFF546773,
+   0xFF33434F,0xFF50626F,0xFF586B76,0xFF576B75,0xFF586B76,0xFF596B77,0xFF5A6A78,
+   0xFF596A78,0xFF596A77,0xFF586A77,0xFF596977,0xFF596A78,0xFF596B78,0xFF596B77,
+   0xFF596B77,0xFF5B6C79,0xFF5D6F7C,0xFF5F727E,0xFF5F727E,0xFF5F727E,0xFF607180,
+   0xFF607180,0xFF607180,0xFF617080,0xFF607180,0xFF607180,0xFF607180,0xFF607180,
+   0xFF607180,0xFF5F7280,0xFF5F727F,0xFF5F727E,0xFF627582,0xFF526572,0xFF2F3D4A,
+   0xFF313F4E,0xFF506577,0xFF5D7386,0xFF5C7184,0xFF5C7183,0xFF5C7183,0xFF5C7184,
+   0xFF5C7184,0xFF5D7084,0xFF5D7085,0xFF5D7085,0xFF5D7085,0xFF5E7186,0xFF5E7287,
+   0xFF5E7287,0xFF5F7388,0xFF61768B,0xFF63788D,0xFF63778C,0xFF61758A,0xFF607488,
+   0xFF607388,0xFF607388,0xFF607388,0xFF607388,0xFF607388,0xFF607388,0xFF617489,
+   0xFF62768B,0xFF62778C,0xFF61758B,0xFF62768B,0xFF5F7388,0xFF354253,0xFF222C3A,
+   0xFF2F3B4B,0xFF425061,0xFF576577,0xFF617081,0xFF617281,0xFF60737F,0xFF60737E,
+   0xFF5F727E,0xFF5E707D,0xFF5D6F7C,0xFF5D6F7C,0xFF5D6F7B,0xFF5D6F7B,0xFF5E6E7D,
+   0xFF5F6D7E,0xFF5F6D7E,0xFF5F6D7E,0xFF5F6D7E,0xFF5F6D7E,0xFF5E6C7D,0xFF5D6B7C,
+   0xFF5C6C7B,0xFF5C6C7A,0xFF5C6C7B,0xFF5C6C7B,0xFF465564,0xFF3E4D5C,0xFF596979,
+   0xFF5B6C7C,0xFF566576,0xFF354253,0xFF526077,0xFF59687F,0xFF59677E,0xFF59687F,
+   0xFF59697F,0xFF59697F,0xFF59687F,0xFF58687E,0xFF58687D,0xFF57697C,0xFF586A7D,
+   0xFF586A7E,0xFF59697E,0xFF59697E,0xFF5A6A80,0xFF5C6E82,0xFF5D7183,0xFF5D7183,
+   0xFF5D7182,0xFF5C7281,0xFF5C7282,0xFF5C7281,0xFF5C7281,0xFF5C7282,0xFF5C7281,
+   0xFF5B7380,0xFF5B7381,0xFF5C7281,0xFF5C7282,0xFF5D7183,0xFF5D7184,0xFF5F7486,
+   0xFF526578,0xFF303E4F,0xFF303F4C,0xFF516270,0xFF5E6F7D,0xFF5D6D7B,0xFF5D6D7B,
+   0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,
+   0xFF5F6D7E,0xFF5F6E7F,0xFF5F6E7F,0xFF606F81,0xFF627284,0xFF647486,0xFF647385,
+   0xFF627183,0xFF617082,0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,
+   0xFF637284,0xFF677688,0xFF6A7B8D,0xFF6C7D8F,0xFF6A7B8D,0xFF697989,0xFF5E6E7E,
+   0xFF323F4E,0xFF2D3847,0xFF364251,0xFF2C3746,0xFF344251,0xFF445463,0xFF5A6B79,
+   0xFF617381,0xFF607280,0xFF5F717E,0xFF5E6F7C,0xFF5D6F7B,0xFF5D6F7B,0xFF5D6F7B,
+   0xFF5C707A,0xFF5B7079,0xFF5B7178,0xFF5B7178,0xFF5B7178,0xFF5B7079,0xFF5B7079,
+   0xFF5A6F77,0xFF5A6E77,0xFF5B6D78,0xFF5C6E7A,0xFF596B77,0xFF455862,0xFF3C4F58,
+   0xFF556A73,0xFF586C76,0xFF596D78,0xFF566A76,0xFF33444F,0xFF4E606C,0xFF586B76,
+   0xFF576B75,0xFF576B75,0xFF586B75,0xFF586A77,0xFF586A77,0xFF586A76,0xFF586A77,
+   0xFF596A77,0xFF596A78,0xFF596B77,0xFF596B76,0xFF596B76,0xFF5B6C79,0xFF5E6F7D,
+   0xFF5F717E,0xFF5F727E,0xFF5F727E,0xFF60717F,0xFF607180,0xFF617080,0xFF607180,
+   0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF5F727F,0xFF5F727E,0xFF5E737E,
+   0xFF5E727E,0xFF617481,0xFF435562,0xFF283742,0xFF344553,0xFF54687A,0xFF5C7184,
+   0xFF5B6F83,0xFF5B7083,0xFF5C7183,0xFF5C7183,0xFF5C7183,0xFF5C7184,0xFF5D7084,
+   0xFF5D7085,0xFF5D7186,0xFF5E7287,0xFF5E7287,0xFF5E7287,0xFF607488,0xFF62778B,
+   0xFF63788D,0xFF63788D,0xFF62778C,0xFF61758A,0xFF607388,0xFF607388,0xFF607388,
+   0xFF607388,0xFF607388,0xFF62758A,0xFF667A90,0xFF697E95,0xFF6B8096,0xFF697E95,
+   0xFF687D92,0xFF5D7084,0xFF323F4F,0xFF2D3848,0xFF364252,0xFF2C3747,0xFF354152,
+   0xFF455364,0xFF5A6B79,0xFF60747F,0xFF5F747E,0xFF5F717D,0xFF5D707C,0xFF5D6F7C,
+   0xFF5D6F7C,0xFF5D6F7B,0xFF5D6F7B,0xFF5E6E7C,0xFF5F6D7E,0xFF5F6D7E,0xFF5F6D7E,
+   0xFF5F6D7E,0xFF5F6D7E,0xFF5E6C7D,0xFF5D6B7C,0xFF5C6C7B,0xFF5C6D7B,0xFF5A6A78,
+   0xFF485666,0xFF3F4C5C,0xFF586777,0xFF5B697A,0xFF5C6A7C,0xFF596879,0xFF354253,
+   0xFF505E75,0xFF59687F,0xFF59677E,0xFF58687E,0xFF58687E,0xFF58687E,0xFF58687E,
+   0xFF58687D,0xFF57697C,0xFF57697C,0xFF586A7D,0xFF586A7D,0xFF586A7D,0xFF586A7D,
+   0xFF5A6B7F,0xFF5C6E82,0xFF5E7084,0xFF5D7183,0xFF5C7282,0xFF5C7281,0xFF5C7281,
+   0xFF5C7281,0xFF5C7281,0xFF5C7280,0xFF5C7280,0xFF5C7281,0xFF5B7381,0xFF5C7281,
+   0xFF5C7282,0xFF5D7184,0xFF5D7184,0xFF5F7386,0xFF445669,0xFF2A3746,0xFF354452,
+   0xFF556573,0xFF5D6D7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5D6C7C,0xFF5D6D7C,0xFF5D6D7C,
+   0xFF5D6D7C,0xFF5E6C7C,0xFF5E6C7C,0xFF5E6D7D,0xFF5F6E7E,0xFF5F6E7F,0xFF5F6E7F,
+   0xFF617081,0xFF637384,0xFF647486,0xFF647486,0xFF637385,0xFF627183,0xFF616F81,
+   0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,0xFF697A8C,0xFF6C7C8E,0xFF6C7D8F,
+   0xFF6C7D8F,0xFF6C7C8E,0xFF6B7B8C,0xFF4F5E6E,0xFF313E4D,0xFF536372,0xFF6A7B8B,
+   0xFF546271,0xFF505F6D,0xFF445261,0xFF374554,0xFF4D5D6C,0xFF5D6E7C,0xFF5F717E,
+   0xFF5D707B,0xFF5D6F7A,0xFF5D6F7B,0xFF5D6F7B,0xFF5C7079,0xFF5B7178,0xFF5A7177,
+   0xFF5B7178,0xFF5B7178,0xFF5C7079,0xFF5B7079,0xFF5A7077,0xFF5A6F77,0xFF596C77,
+   0xFF51646F,0xFF3F525C,0xFF42575E,0xFF566E74,0xFF586F75,0xFF566C74,0xFF586D76,
+   0xFF596E78,0xFF33454F,0xFF485B65,0xFF576B75,0xFF576B75,0xFF576B74,0xFF576B75,
+   0xFF586A75,0xFF586A75,0xFF586A76,0xFF586A77,0xFF586A77,0xFF596B77,0xFF596B77,
+   0xFF586B76,0xFF586C76,0xFF5A6D78,0xFF5D707C,0xFF5F727E,0xFF5F727E,0xFF5F727E,
+   0xFF5F717F,0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF60717F,0xFF607180,
+   0xFF5F7280,0xFF5F727E,0xFF5E737E,0xFF5E737E,0xFF607380,0xFF5A6D79,0xFF354551,
+   0xFF24313C,0xFF3A4C58,0xFF586E7D,0xFF5B7083,0xFF5C6F83,0xFF5C6F83,0xFF5B7083,
+   0xFF5C7183,0xFF5C7183,0xFF5C7184,0xFF5D7084,0xFF5D7085,0xFF5D7186,0xFF5E7287,
+   0xFF5E7287,0xFF5E7287,0xFF607489,0xFF62778C,0xFF63788D,0xFF63788D,0xFF63788D,
+   0xFF62778B,0xFF617489,0xFF607388,0xFF607388,0xFF617489,0xFF64788D,0xFF687D93,
+   0xFF6B8096,0xFF6B8097,0xFF6B8097,0xFF6B8096,0xFF6A7F94,0xFF4F5E71,0xFF313D4E,
+   0xFF536273,0xFF6B7A8C,0xFF546272,0xFF505E6E,0xFF455262,0xFF374554,0xFF4C5E6A,
+   0xFF5C6F7B,0xFF5F717D,0xFF5E6F7C,0xFF5E6E7C,0xFF5E6F7C,0xFF5D6F7A,0xFF5D6F7B,
+   0xFF5E6E7D,0xFF5F6D7E,0xFF5F6D7E,0xFF5F6D7E,0xFF5F6D7E,0xFF5F6D7E,0xFF5E6C7D,
+   0xFF5D6B7C,0xFF5B6B7A,0xFF526371,0xFF41515F,0xFF465463,0xFF5B697A,0xFF5D6B7C,
+   0xFF5A687A,0xFF5B697B,0xFF5C6B7D,0xFF364253,0xFF4B5970,0xFF5A6880,0xFF58687E,
+   0xFF58687D,0xFF58687D,0xFF58687E,0xFF58687D,0xFF58687D,0xFF57697C,0xFF57697C,
+   0xFF586A7C,0xFF576B7C,0xFF576B7C,0xFF576B7C,0xFF596D7E,0xFF5C6F81,0xFF5D7183,
+   0xFF5D7182,0xFF5C7282,0xFF5C7280,0xFF5C7280,0xFF5C7280,0xFF5B7380,0xFF5B737F,
+   0xFF5B7380,0xFF5C7281,0xFF5C7281,0xFF5C7281,0xFF5C7282,0xFF5D7183,0xFF5E7285,
+   0xFF596C7F,0xFF374659,0xFF25313F,0xFF3C4B5A,0xFF5A6A78,0xFF5C6C7A,0xFF5C6C7B,
+   0xFF5C6C7B,0xFF5C6C7B,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5E6C7C,0xFF5E6C7D,
+   0xFF5E6D7E,0xFF5F6E7F,0xFF5F6E7F,0xFF5F6E7F,0xFF617082,0xFF637385,0xFF647486,
+   0xFF647486,0xFF647486,0xFF637385,0xFF627082,0xFF616F81,0xFF616F81,0xFF627082,
+   0xFF657486,0xFF6C7D8F,0xFF6C7D8F,0xFF6C7D8F,0xFF6C7D8F,0xFF6D7E90,0xFF637484,
+   0xFF374554,0xFF475665,0xFF647584,0xFF647483,0xFF677787,0xFF586776,0xFF687888,
+   0xFF586877,0xFF3A4856,0xFF3A4957,0xFF4C5E6A,0xFF576974,0xFF5B6E78,0xFF5C6F7A,
+   0xFF5D707A,0xFF5C7179,0xFF5B7278,0xFF5B7278,0xFF5C7179,0xFF5C717A,0xFF5C7079,
+   0xFF586D75,0xFF4F646C,0xFF455962,0xFF3B4E58,0xFF31444C,0xFF4C6269,0xFF5C7479,
+   0xFF587175,0xFF566E73,0xFF556D73,0xFF576D75,0xFF5A7079,0xFF344650,0xFF40535D,
+   0xFF576B74,0xFF576B74,0xFF576B74,0xFF576B74,0xFF576B74,0xFF586A75,0xFF586A75,
+   0xFF586A75,0xFF586A76,0xFF596B77,0xFF596B76,0xFF586C76,0xFF586C75,0xFF596E77,
+   0xFF5D717B,0xFF5F727D,0xFF5F727D,0xFF5F727E,0xFF5F727E,0xFF5F727E,0xFF60717F,
+   0xFF617080,0xFF607180,0xFF607180,0xFF607180,0xFF5F727F,0xFF5E737E,0xFF5E737E,
+   0xFF5E727E,0xFF60737F,0xFF475A66,0xFF283742,0xFF202D37,0xFF3C4E59,0xFF586E7C,
+   0xFF5B7182,0xFF5B7083,0xFF5C6F83,0xFF5B7083,0xFF5B7083,0xFF5C7183,0xFF5C7183,
+   0xFF5C7184,0xFF5D7185,0xFF5E7186,0xFF5E7287,0xFF5E7287,0xFF5E7287,0xFF607489,
+   0xFF62778C,0xFF63788D,0xFF63788C,0xFF63788D,0xFF63788C,0xFF62768B,0xFF617489,
+   0xFF62768B,0xFF667B91,0xFF6A7F95,0xFF6B8097,0xFF6B8097,0xFF6B8097,0xFF6B8097,
+   0xFF6C8198,0xFF637589,0xFF384455,0xFF485566,0xFF657485,0xFF647384,0xFF687788,
+   0xFF596777,0xFF687889,0xFF586777,0xFF394856,0xFF394956,0xFF4C5D6A,0xFF586876,
+   0xFF5C6C7A,0xFF5D6E7C,0xFF5E6F7C,0xFF5E6F7D,0xFF5F6E7E,0xFF606E7F,0xFF606E7F,
+   0xFF606E7F,0xFF5F6D7E,0xFF5C6A7B,0xFF536172,0xFF485667,0xFF3E4C5B,0xFF334250,
+   0xFF4F5F6D,0xFF60707F,0xFF5D6C7C,0xFF5B697A,0xFF5A687A,0xFF5B697B,0xFF5E6C7F,
+   0xFF374455,0xFF445167,0xFF59677F,0xFF58687E,0xFF57697C,0xFF57697C,0xFF57697C,
+   0xFF57697C,0xFF57697C,0xFF57697C,0xFF57697C,0xFF576A7C,0xFF576B7B,0xFF576B7B,
+   0xFF576C7B,0xFF596D7D,0xFF5B7081,0xFF5C7182,0xFF5C7281,0xFF5C7281,0xFF5C7280,
+   0xFF5C7280,0xFF5B7380,0xFF5B737F,0xFF5A747E,0xFF5B737F,0xFF5B7381,0xFF5C7381,
+   0xFF5C7281,0xFF5C7282,0xFF5D7183,0xFF5E7284,0xFF475A6D,0xFF2A3747,0xFF222C39,
+   0xFF3E4D5C,0xFF5A6A79,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,
+   0xFF5D6D7C,0xFF5E6C7C,0xFF5E6C7D,0xFF5E6C7D,0xFF5F6D7E,0xFF5F6E7F,0xFF5F6E7F,
+   0xFF5F6E7F,0xFF617082,0xFF637385,0xFF647486,0xFF647486,0xFF647486,0xFF647486,
+   0xFF637284,0xFF627082,0xFF637284,0xFF677789,0xFF6B7B8D,0xFF6C7D8F,0xFF6C7D8F,
+   0xFF6C7D8F,0xFF6C7D8F,0xFF6B7B8D,0xFF455364,0xFF364352,0xFF5D6E7D,0xFF627382,
+   0xFF627181,0xFF647384,0xFF617281,0xFF556574,0xFF697B8A,0xFF697B8A,0xFF41505E,
+   0xFF2C3B48,0xFF364753,0xFF3E505C,0xFF425560,0xFF455963,0xFF475B64,0xFF475C65,
+   0xFF485E65,0xFF495D66,0xFF455A62,0xFF3F535B,0xFF364A52,0xFF2F424B,0xFF2B3B46,
+   0xFF24333C,0xFF283A40,0xFF3E5559,0xFF4B6467,0xFF526C6E,0xFF556F72,0xFF556E72,
+   0xFF576E74,0xFF566D75,0xFF334650,0xFF394B56,0xFF566A74,0xFF576B74,0xFF576B74,
+   0xFF566C73,0xFF576B74,0xFF586A76,0xFF586A75,0xFF576B75,0xFF576B75,0xFF586C75,
+   0xFF586C76,0xFF586C76,0xFF586C75,0xFF596D76,0xFF5C707A,0xFF5E727C,0xFF5E737D,
+   0xFF5F727E,0xFF5F727E,0xFF5F727E,0xFF60717F,0xFF617080,0xFF617080,0xFF60717F,
+   0xFF5F717F,0xFF5E727E,0xFF5E727E,0xFF5E727E,0xFF5F747F,0xFF4F636E,0xFF31424D,
+   0xFF1D2832,0xFF1E2933,0xFF374955,0xFF566B7A,0xFF5B7182,0xFF5B7082,0xFF5B7083,
+   0xFF5B7083,0xFF5B7082,0xFF5B7083,0xFF5C7183,0xFF5C7184,0xFF5D7285,0xFF5E7286,
+   0xFF5E7287,0xFF5E7287,0xFF5E7287,0xFF607589,0xFF62778C,0xFF63788C,0xFF63788D,
+   0xFF63788D,0xFF63788D,0xFF63788D,0xFF657A8F,0xFF697D94,0xFF6B8097,0xFF6B8097,
+   0xFF6B8097,0xFF6B8097,0xFF6B8097,0xFF6B8097,0xFF6A7D92,0xFF455365,0xFF364353,
+   0xFF5E6D7E,0xFF637283,0xFF627182,0xFF647384,0xFF627182,0xFF566475,0xFF6A7A8B,
+   0xFF6A7A8A,0xFF41505F,0xFF2D3A48,0xFF374654,0xFF3F4F5D,0xFF445462,0xFF475766,
+   0xFF495868,0xFF4B596A,0xFF4D5A6C,0xFF4C5A6B,0xFF495768,0xFF435061,0xFF3A4657,
+   0xFF333F50,0xFF2E394A,0xFF273140,0xFF2B3746,0xFF425160,0xFF50606E,0xFF576776,
+   0xFF5A6A79,0xFF5A697A,0xFF5C6A7C,0xFF5A697B,0xFF374355,0xFF3C495F,0xFF58667E,
+   0xFF58687E,0xFF57697C,0xFF57697C,0xFF57697C,0xFF57697B,0xFF566A7B,0xFF566A7B,
+   0xFF566A7B,0xFF576B7B,0xFF576B7B,0xFF566C7A,0xFF566C7A,0xFF586D7C,0xFF5A6F7F,
+   0xFF5C7281,0xFF5C7280,0xFF5B7380,0xFF5B737F,0xFF5B737F,0xFF5B737F,0xFF5A747E,
+   0xFF5A747E,0xFF5B737F,0xFF5B7380,0xFF5B7281,0xFF5C7281,0xFF5C7282,0xFF5E7384,
+   0xFF4F6375,0xFF324453,0xFF1E2834,0xFF1F2735,0xFF3A4758,0xFF586677,0xFF5D6B7C,
+   0xFF5D6B7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5D6C7B,0xFF5E6C7D,0xFF5E6C7D,
+   0xFF5E6D7E,0xFF5F6E7F,0xFF5F6E7F,0xFF5F6E7F,0xFF5F6E7F,0xFF617182,0xFF637385,
+   0xFF647486,0xFF647486,0xFF647486,0xFF647486,0xFF647486,0xFF667688,0xFF6A7A8C,
+   0xFF6C7D8F,0xFF6C7D8F,0xFF6C7D8F,0xFF6C7D8F,0xFF6D7E90,0xFF6C7C8F,0xFF505E70,
+   0xFF313C4D,0xFF546373,0xFF647484,0xFF617281,0xFF617281,0xFF617181,0xFF657684,
+   0xFF5B6C79,0xFF556573,0xFF667886,0xFF465764,0xFF232F3B,0xFF1F2A35,0xFF26343F,
+   0xFF2A3B45,0xFF293A44,0xFF293843,0xFF293A43,0xFF293C43,0xFF2A3C45,0xFF2C3F47,
+   0xFF31444C,0xFF374B53,0xFF3C505A,0xFF40535E,0xFF3E525B,0xFF354B51,0xFF2E4449,
+   0xFF2C4246,0xFF30474A,0xFF395154,0xFF435C5F,0xFF486265,0xFF435A61,0xFF2C3D46,
+   0xFF32424D,0xFF536671,0xFF576B75,0xFF566B74,0xFF566C73,0xFF576B74,0xFF586A76,
+   0xFF586A75,0xFF566B74,0xFF576B74,0xFF586C75,0xFF586C75,0xFF576C75,0xFF576D74,
+   0xFF586C75,0xFF596D76,0xFF5A6F78,0xFF5C717B,0xFF5E717D,0xFF5F727E,0xFF5F727E,
+   0xFF607180,0xFF607080,0xFF606F7F,0xFF5E6E7E,0xFF5D6F7C,0xFF5D707C,0xFF5D707D,
+   0xFF5E727E,0xFF536672,0xFF364854,0xFF222E39,0xFF18212B,0xFF1A242E,0xFF2E3E4A,
+   0xFF4A5F6F,0xFF5B7181,0xFF5A7181,0xFF5B7082,0xFF5B7082,0xFF5B7082,0xFF5C7183,
+   0xFF5D7284,0xFF5D7285,0xFF5D7385,0xFF5D7286,0xFF5E7287,0xFF5E7287,0xFF5E7387,
+   0xFF617589,0xFF63778C,0xFF63788D,0xFF63788D,0xFF63788D,0xFF63788D,0xFF64798E,
+   0xFF687D93,0xFF6B8097,0xFF6B8097,0xFF6B8097,0xFF6B8097,0xFF6B8097,0xFF6C8198,
+   0xFF6B7F94,0xFF505E70,0xFF313C4D,0xFF546274,0xFF647385,0xFF627182,0xFF627182,
+   0xFF627182,0xFF667586,0xFF5C6B7B,0xFF566475,0xFF677788,0xFF475567,0xFF242E3D,
+   0xFF202936,0xFF273340,0xFF2C3948,0xFF2C3847,0xFF2B3646,0xFF2C3747,0xFF2D3849,
+   0xFF2E394A,0xFF303B4C,0xFF354152,0xFF3B4858,0xFF404D5F,0xFF435062,0xFF414F60,
+   0xFF3A4757,0xFF334050,0xFF303E4D,0xFF344251,0xFF3E4C5C,0xFF485667,0xFF4E5C6E,
+   0xFF485668,0xFF2F3A4B,0xFF354155,0xFF54637A,0xFF58687E,0xFF57697C,0xFF57697C,
+   0xFF57697C,0xFF566A7B,0xFF566A7B,0xFF566A7B,0xFF566A7B,0xFF576B7B,0xFF566C7A,
+   0xFF566C7A,0xFF566C7A,0xFF576B7B,0xFF586C7C,0xFF596F7D,0xFF5A717E,0xFF5A727F,
+   0xFF5B737F,0xFF5B737F,0xFF5B737F,0xFF5B737F,0xFF5A727E,0xFF59717E,0xFF59707E,
+   0xFF5A707E,0xFF5B717F,0xFF5C7281,0xFF516776,0xFF364A58,0xFF222F3A,0xFF18202C,
+   0xFF1B2330,0xFF303C4D,0xFF4D5A6C,0xFF5D6B7C,0xFF5D6B7B,0xFF5C6C7B,0xFF5D6B7B,
+   0xFF5D6B7B,0xFF5D6C7C,0xFF5F6D7E,0xFF5F6D7F,0xFF5F6E7F,0xFF5F6E7F,0xFF5F6E7F,
+   0xFF5F6E7F,0xFF5F6F80,0xFF627183,0xFF647385,0xFF647486,0xFF647486,0xFF647486,
+   0xFF647486,0xFF657587,0xFF69798B,0xFF6C7D8F,0xFF6C7D8F,0xFF6C7D8F,0xFF6C7D90,
+   0xFF6D7E90,0xFF667689,0xFF4B596B,0xFF2C3747,0xFF404D5E,0xFF69798B,0xFF677788,
+   0xFF637383,0xFF617280,0xFF607280,0xFF617381,0xFF657785,0xFF43525F,0xFF3F4E5A,
+   0xFF2E3C49,0xFF2D3B48,0xFF31414D,0xFF364853,0xFF3C4F5A,0xFF3F525D,0xFF41545F,
+   0xFF435761,0xFF465C64,0xFF4D646B,0xFF566C75,0xFF5D747D,0xFF5F777E,0xFF60777F,
+   0xFF617781,0xFF607880,0xFF5D787C,0xFF597477,0xFF546F72,0xFF4A6366,0xFF395054,
+   0xFF2C4346,0xFF2A4043,0xFF27393F,0xFF1C2A31,0xFF2C3D46,0xFF4C5F6A,0xFF586B75,
+   0xFF576B74,0xFF576B74,0xFF576B75,0xFF586A75,0xFF576B75,0xFF566C73,0xFF566C74,
+   0xFF586C75,0xFF576D74,0xFF566D73,0xFF566D73,0xFF576D74,0xFF576D74,0xFF576D74,
+   0xFF586C76,0xFF5A6D78,0xFF5B6E7A,0xFF5D6F7C,0xFF5E6F7E,0xFF5E6E7E,0xFF5E6D7E,
+   0xFF5D6E7D,0xFF5C6E7C,0xFF5D707B,0xFF5A6D78,0xFF4A5E69,0xFF344651,0xFF24313D,
+   0xFF1A232F,0xFF19222D,0xFF18212C,0xFF222F3A,0xFF384B5A,0xFF526878,0xFF5A7281,
+   0xFF5A7181,0xFF5A7181,0xFF5B7182,0xFF5C7284,0xFF5E7385,0xFF5D7484,0xFF5E7485,
+   0xFF5E7385,0xFF5D7386,0xFF5D7286,0xFF5E7387,0xFF61758A,0xFF63788D,0xFF63788D,
+   0xFF63788D,0xFF64798E,0xFF64798E,0xFF667B90,0xFF697E94,0xFF6B8097,0xFF6B8097,
+   0xFF6B8097,0xFF6B8097,0xFF6C8198,0xFF657A90,0xFF4B5A6E,0xFF2C3747,0xFF404D5E,
+   0xFF69798B,0xFF677788,0xFF647384,0xFF627182,0xFF627182,0xFF627283,0xFF667687,
+   0xFF455161,0xFF404C5C,0xFF2F3B4B,0xFF2F3A4B,0xFF333F4F,0xFF384656,0xFF3F4C5D,
+   0xFF424F61,0xFF445163,0xFF475466,0xFF4A586A,0xFF516071,0xFF5A697A,0xFF617182,
+   0xFF637384,0xFF647385,0xFF647485,0xFF657486,0xFF637284,0xFF5F6F80,0xFF5A6A7A,
+   0xFF505E6F,0xFF3F4B5C,0xFF323E4E,0xFF303B4B,0xFF2B3545,0xFF1F2735,0xFF303B4E,
+   0xFF4E5D74,0xFF58687E,0xFF57697C,0xFF57697C,0xFF566A7B,0xFF566A7B,0xFF566A7B,
+   0xFF566A7A,0xFF566A7A,0xFF566C7A,0xFF566C7A,0xFF566C7A,0xFF566C7A,0xFF566C7A,
+   0xFF566C7A,0xFF566C7A,0xFF576C7B,0xFF576D7A,0xFF586F7B,0xFF59707D,0xFF5A717E,
+   0xFF5A717E,0xFF5A707F,0xFF5A6F7E,0xFF59707E,0xFF5A717E,0xFF576E7C,0xFF495F6D,
+   0xFF334753,0xFF23323B,0xFF1A232D,0xFF18212C,0xFF18202C,0xFF242D3C,0xFF3A4858,
+   0xFF556373,0xFF5D6C7C,0xFF5C6C7B,0xFF5D6B7B,0xFF5D6B7C,0xFF5F6D7E,0xFF606E7F,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF5F6E7F,0xFF5F6E7F,0xFF606F80,0xFF627183,
+   0xFF647486,0xFF647486,0xFF647486,0xFF657586,0xFF657587,0xFF677788,0xFF6A7A8C,
+   0xFF6C7D8F,0xFF6C7D8F,0xFF6C7D8F,0xFF657587,0xFF586779,0xFF475566,0xFF3B4757,
+   0xFF2B3645,0xFF576577,0xFF6C7C8F,0xFF6B7B8D,0xFF68798A,0xFF647784,0xFF627581,
+   0xFF617380,0xFF5C6E7A,0xFF35434F,0xFF32414D,0xFF485B67,0xFF5A6E7B,0xFF617481,
+   0xFF637683,0xFF667985,0xFF677A87,0xFF687B87,0xFF667A85,0xFF627981,0xFF60777E,
+   0xFF5E757C,0xFF5C737B,0xFF5A7278,0xFF597076,0xFF587076,0xFF577175,0xFF587375,
+   0xFF597576,0xFF5B7778,0xFF5E7A7C,0xFF5E7B7D,0xFF4E6A6B,0xFF334B4E,0xFF223439,
+   0xFF18242B,0xFF26373E,0xFF42575F,0xFF566A74,0xFF576B75,0xFF576B75,0xFF576A75,
+   0xFF586A75,0xFF576B74,0xFF566C73,0xFF566C73,0xFF576D74,0xFF576D74,0xFF556E72,
+   0xFF566D72,0xFF576D74,0xFF576D74,0xFF576D74,0xFF576C75,0xFF586B76,0xFF596B77,
+   0xFF5A6B78,0xFF5C6D7B,0xFF5D6D7D,0xFF5E6D7E,0xFF5E6E7E,0xFF5B6E7A,0xFF4F626D,
+   0xFF3B4D5A,0xFF2F414F,0xFF2C3D4D,0xFF2D3E4E,0xFF2D3D4F,0xFF2B3A4C,0xFF283747,
+   0xFF23313F,0xFF293A47,0xFF3B515F,0xFF556D7B,0xFF5B7281,0xFF5A7181,0xFF5C7283,
+   0xFF5D7385,0xFF5D7484,0xFF5D7484,0xFF5E7485,0xFF5E7385,0xFF5E7386,0xFF5E7386,
+   0xFF5F7387,0xFF61768B,0xFF64798E,0xFF657A8F,0xFF657A8F,0xFF667B90,0xFF667B90,
+   0xFF677C92,0xFF6A7E95,0xFF6B8097,0xFF6C8198,0xFF6B8198,0xFF657990,0xFF57697F,
+   0xFF475669,0xFF3B4758,0xFF2B3645,0xFF576577,0xFF6C7C8F,0xFF6B7B8D,0xFF69798A,
+   0xFF667587,0xFF647384,0xFF627182,0xFF5D6C7D,0xFF364151,0xFF333F50,0xFF4B596B,
+   0xFF5D6C7E,0xFF637284,0xFF657486,0xFF687789,0xFF6A788A,0xFF6A788A,0xFF697789,
+   0xFF667587,0xFF647384,0xFF627182,0xFF606F80,0xFF5E6D7E,0xFF5D6C7D,0xFF5C6B7C,
+   0xFF5D6C7D,0xFF5E6D7E,0xFF5F6F80,0xFF617182,0xFF647485,0xFF657587,0xFF556376,
+   0xFF394657,0xFF26303F,0xFF1A212F,0xFF2A3445,0xFF46556B,0xFF58677D,0xFF58687D,
+   0xFF57697C,0xFF566A7B,0xFF566A7B,0xFF566A7B,0xFF566A7A,0xFF566B7A,0xFF566C7A,
+   0xFF566C7A,0xFF566C7A,0xFF556C79,0xFF566C79,0xFF566C7A,0xFF576B7B,0xFF576B7A,
+   0xFF566C79,0xFF566C7A,0xFF576C7B,0xFF596E7D,0xFF5A6F7F,0xFF5A6F7F,0xFF5B707F,
+   0xFF596F7E,0xFF4D6372,0xFF3A4F5D,0xFF2E404C,0xFF2A3C45,0xFF2C3C46,0xFF2C3B47,
+   0xFF2A3845,0xFF273341,0xFF232C3A,0xFF2A3645,0xFF3E4D5D,0xFF586777,0xFF5D6D7C,
+   0xFF5C6C7B,0xFF5E6C7D,0xFF5F6D7F,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF5F6E7F,0xFF606F80,0xFF627284,0xFF657586,0xFF667687,0xFF667687,
+   0xFF677788,0xFF677788,0xFF68788A,0xFF6B7B8D,0xFF6C7D8F,0xFF6D7E90,0xFF6D7E90,
+   0xFF4F5D6F,0xFF677789,0xFF718193,0xFF77889A,0xFF505E6F,0xFF4F5D6F,0xFF6B7B8D,
+   0xFF6B7B8D,0xFF697B8B,0xFF617482,0xFF526470,0xFF445561,0xFF435661,0xFF546974,
+   0xFF667C87,0xFF6B828C,0xFF69808A,0xFF657A85,0xFF637582,0xFF617380,0xFF617280,
+   0xFF607280,0xFF5E727D,0xFF5C717A,0xFF5A7178,0xFF597177,0xFF597177,0xFF587276,
+   0xFF577174,0xFF567074,0xFF567073,0xFF557172,0xFF557172,0xFF557172,0xFF557172,
+   0xFF567373,0xFF5D7A7A,0xFF557273,0xFF3B5557,0xFF273A3F,0xFF1F2E35,0xFF364B53,
+   0xFF4E646B,0xFF566C74,0xFF576C75,0xFF576B75,0xFF576A75,0xFF566B74,0xFF566C73,
+   0xFF566C73,0xFF566D73,0xFF556D72,0xFF546D71,0xFF546D71,0xFF566D73,0xFF576D74,
+   0xFF576D75,0xFF586C75,0xFF596B76,0xFF596B77,0xFF5A6C78,0xFF5C6D7B,0xFF5E6E7D,
+   0xFF5D6D7D,0xFF546573,0xFF425360,0xFF334553,0xFF354859,0xFF435768,0xFF506676,
+   0xFF566C7C,0xFF566A7B,0xFF526577,0xFF4C6071,0xFF3F5363,0xFF314353,0xFF2A3C4B,
+   0xFF394D5B,0xFF506675,0xFF5A7081,0xFF5D7384,0xFF5D7485,0xFF5D7484,0xFF5E7485,
+   0xFF5E7385,0xFF5E7386,0xFF5E7386,0xFF5F7287,0xFF61758A,0xFF64798E,0xFF667B90,
+   0xFF667B90,0xFF667B90,0xFF667B90,0xFF667B90,0xFF687D93,0xFF6B8096,0xFF6B7F96,
+   0xFF62768D,0xFF516378,0xFF4E5E72,0xFF67788A,0xFF718193,0xFF77889A,0xFF505E6F,
+   0xFF4F5D6F,0xFF6B7B8D,0xFF6B7B8D,0xFF6A7A8C,0xFF637284,0xFF546273,0xFF475464,
+   0xFF465465,0xFF576678,0xFF697A8B,0xFF6E7F91,0xFF6C7D8E,0xFF687889,0xFF647385,
+   0xFF637183,0xFF627082,0xFF627082,0xFF616F81,0xFF5F6E7F,0xFF5E6D7E,0xFF5E6D7E,
+   0xFF5E6D7E,0xFF5E6D7E,0xFF5D6C7D,0xFF5C6B7C,0xFF5C6B7C,0xFF5C6B7C,0xFF5C6B7C,
+   0xFF5C6B7C,0xFF5C6B7C,0xFF5D6C7D,0xFF647385,0xFF5D6B7E,0xFF424F61,0xFF2B3645,
+   0xFF222B39,0xFF3B495D,0xFF506176,0xFF58697D,0xFF58697D,0xFF576A7B,0xFF566A7B,
+   0xFF566A7A,0xFF556B79,0xFF556B79,0xFF566C7A,0xFF566B7A,0xFF566B7A,0xFF556B79,
+   0xFF556B79,0xFF566C7A,0xFF576B7B,0xFF576C7B,0xFF576C7B,0xFF576B7B,0xFF576C7B,
+   0xFF596E7D,0xFF5A707F,0xFF596F7E,0xFF516775,0xFF405664,0xFF324653,0xFF344852,
+   0xFF425760,0xFF50666F,0xFF576C76,0xFF576A77,0xFF536573,0xFF4E5E6E,0xFF404F5F,
+   0xFF313F4E,0xFF2B3746,0xFF3B4858,0xFF526171,0xFF5C6B7B,0xFF5F6D7F,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF627183,
+   0xFF657587,0xFF677788,0xFF677788,0xFF677788,0xFF677788,0xFF677788,0xFF69798B,
+   0xFF6C7C8E,0xFF6C7C8E,0xFF637385,0xFF556376,0xFF59687A,0xFF708193,0xFF6F7F92,
+   0xFF738496,0xFF576577,0xFF2E3848,0xFF455364,0xFF485666,0xFF3E4C5B,0xFF364451,
+   0xFF40505C,0xFF566975,0xFF677C88,0xFF6A818B,0xFF677E87,0xFF647B84,0xFF627982,
+   0xFF60777F,0xFF5F747E,0xFF5F737E,0xFF60727F,0xFF60727F,0xFF5E727D,0xFF5C717B,
+   0xFF5A7178,0xFF597177,0xFF597177,0xFF587276,0xFF577174,0xFF567173,0xFF567173,
+   0xFF557172,0xFF557271,0xFF557172,0xFF557172,0xFF547171,0xFF547170,0xFF5A7878,
+   0xFF5A7778,0xFF435D60,0xFF2B3E44,0xFF26363D,0xFF384E55,0xFF465C64,0xFF4F646D,
+   0xFF536771,0xFF566973,0xFF566B74,0xFF566C73,0xFF556C72,0xFF556D72,0xFF546D71,
+   0xFF546C71,0xFF546C71,0xFF546C71,0xFF566C73,0xFF576B74,0xFF576B75,0xFF576A75,
+   0xFF576975,0xFF566875,0xFF556774,0xFF4F606E,0xFF404F5E,0xFF354553,0xFF3E5261,
+   0xFF4E6373,0xFF586E7D,0xFF5F7685,0xFF5F7584,0xFF5E7484,0xFF5E7583,0xFF5E7583,
+   0xFF607785,0xFF617785,0xFF5B7180,0xFF4F6473,0xFF364957,0xFF2D3E4D,0xFF3C4F5F,
+   0xFF4C6271,0xFF546A7B,0xFF586E7F,0xFF5B7082,0xFF5D7284,0xFF5E7385,0xFF5F7387,
+   0xFF607388,0xFF63778C,0xFF667B90,0xFF677C91,0xFF677C91,0xFF667B91,0xFF657A8F,
+   0xFF64788E,0xFF61758B,0xFF596C82,0xFF495A6F,0xFF374558,0xFF2C3748,0xFF546274,
+   0xFF718194,0xFF6F7F92,0xFF738496,0xFF576577,0xFF2E3848,0xFF455364,0xFF485567,
+   0xFF3F4B5C,0xFF374253,0xFF414E5F,0xFF586779,0xFF697A8C,0xFF6D7E90,0xFF6A7B8C,
+   0xFF677889,0xFF667687,0xFF647385,0xFF627183,0xFF627082,0xFF627082,0xFF627082,
+   0xFF616F81,0xFF606E80,0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF5D6C7D,
+   0xFF5C6B7C,0xFF5C6B7C,0xFF5C6B7C,0xFF5C6B7C,0xFF5C6B7C,0xFF5C6B7C,0xFF5C6A7C,
+   0xFF5B6A7C,0xFF627183,0xFF627083,0xFF495769,0xFF2E3A49,0xFF283443,0xFF3C4C60,
+   0xFF485B6E,0xFF4F6374,0xFF526777,0xFF546979,0xFF556B79,0xFF556B78,0xFF556B78,
+   0xFF556B79,0xFF556A79,0xFF556979,0xFF556979,0xFF556A79,0xFF556B79,0xFF566B7A,
+   0xFF566A7B,0xFF566A7A,0xFF556979,0xFF536978,0xFF526976,0xFF4C6370,0xFF3E5462,
+   0xFF344855,0xFF3E535E,0xFF4D646C,0xFF597077,0xFF607880,0xFF60767F,0xFF60757F,
+   0xFF617580,0xFF627581,0xFF657685,0xFF667586,0xFF5F6F7F,0xFF526171,0xFF374454,
+   0xFF2E3A49,0xFF3E4B5B,0xFF4F5D6F,0xFF576577,0xFF5B697B,0xFF5D6B7D,0xFF5F6D7F,
+   0xFF5F6E7F,0xFF606E80,0xFF616F81,0xFF647385,0xFF677788,0xFF687889,0xFF687889,
+   0xFF677789,0xFF667687,0xFF657586,0xFF627283,0xFF5A697B,0xFF4A586A,0xFF384455,
+   0xFF2C3646,0xFF414F62,0xFF505F72,0xFF576678,0xFF536173,0xFF384455,0xFF1C2431,
+   0xFF1D2533,0xFF2D3847,0xFF3F4E5D,0xFF5B6D7B,0xFF6A7F8B,0xFF6A808B,0xFF667D87,
+   0xFF657C85,0xFF657C85,0xFF647B84,0xFF627A82,0xFF617980,0xFF5F767E,0xFF5F737D,
+   0xFF5F737E,0xFF5F737D,0xFF5E737C,0xFF5D737B,0xFF5B7279,0xFF5A7178,0xFF597177,
+   0xFF587276,0xFF577174,0xFF567173,0xFF567173,0xFF567172,0xFF557172,0xFF557172,
+   0xFF557172,0xFF557172,0xFF547170,0xFF547170,0xFF587575,0xFF5D7A7B,0xFF496266,
+   0xFF26383D,0xFF1E2D34,0xFF293A42,0xFF2F4049,0xFF33454F,0xFF374952,0xFF3A4D56,
+   0xFF3D525A,0xFF40565C,0xFF40575D,0xFF3F565B,0xFF3D5459,0xFF3C5359,0xFF3D5459,
+   0xFF3E555B,0xFF3F545C,0xFF40535E,0xFF3F515D,0xFF3D4E5B,0xFF394957,0xFF303E4A,
+   0xFF293643,0xFF2E3E4D,0xFF445768,0xFF5A707F,0xFF5C7281,0xFF5B7280,0xFF5A717F,
+   0xFF5B7080,0xFF5B7080,0xFF5A6F7F,0xFF596F7D,0xFF586E7D,0xFF596F7E,0xFF5C7280,
+   0xFF607785,0xFF5E7483,0xFF435767,0xFF293A49,0xFF243241,0xFF2C3B48,0xFF354554,
+   0xFF3B4A5A,0xFF3D4C5C,0xFF3E4E5E,0xFF425263,0xFF455669,0xFF49596E,0xFF4A5B70,
+   0xFF4B5D71,0xFF4C5D71,0xFF4A5B6F,0xFF45566A,0xFF415064,0xFF3C4A5E,0xFF374557,
+   0xFF303C4C,0xFF283241,0xFF2F3A4A,0xFF404E60,0xFF505F71,0xFF576678,0xFF536173,
+   0xFF384455,0xFF1C2431,0xFF1D2533,0xFF2D3848,0xFF404D5E,0xFF5C6C7D,0xFF6C7D8E,
+   0xFF6D7E8F,0xFF697A8B,0xFF68798A,0xFF68798A,0xFF677889,0xFF667788,0xFF657586,
+   0xFF637284,0xFF627082,0xFF627082,0xFF627082,0xFF627082,0xFF616F81,0xFF5F6E7F,
+   0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF5D6C7D,0xFF5C6B7C,0xFF5C6B7C,0xFF5C6B7C,
+   0xFF5C6B7C,0xFF5C6B7C,0xFF5C6B7C,0xFF5C6B7C,0xFF5C6A7B,0xFF5B6A7B,0xFF5F6F80,
+   0xFF647484,0xFF4E5E6D,0xFF293542,0xFF202B38,0xFF2B3947,0xFF2F404E,0xFF334653,
+   0xFF374B58,0xFF3B4F5C,0xFF3E5461,0xFF415764,0xFF425865,0xFF415566,0xFF405364,
+   0xFF3F5263,0xFF3F5364,0xFF415566,0xFF415566,0xFF415466,0xFF405264,0xFF3D5060,
+   0xFF384D59,0xFF2E424D,0xFF283A45,0xFF2D404A,0xFF425861,0xFF5A7179,0xFF5D747C,
+   0xFF5D737C,0xFF5D717C,0xFF5C707C,0xFF5D707C,0xFF5D6F7C,0xFF5C6D7B,0xFF5C6C7B,
+   0xFF5E6D7D,0xFF617080,0xFF657585,0xFF627383,0xFF455363,0xFF2A3444,0xFF252E3D,
+   0xFF2E3848,0xFF374253,0xFF3C485A,0xFF3E4A5B,0xFF3F4B5C,0xFF425060,0xFF465364,
+   0xFF495768,0xFF4A586A,0xFF4C5A6B,0xFF4C5A6B,0xFF4A586A,0xFF465365,0xFF414E60,
+   0xFF3C495B,0xFF384456,0xFF303B4C,0xFF283241,0xFF2D3848,0xFF586A80,0xFF516378,
+   0xFF49596D,0xFF3E4B5D,0xFF374253,0xFF2E3849,0xFF252E3D,0xFF364353,0xFF556675,
+   0xFF677B88,0xFF657A85,0xFF647A84,0xFF647B85,0xFF647A84,0xFF637A83,0xFF627982,
+   0xFF617980,0xFF60777F,0xFF5F757D,0xFF5E737D,0xFF5E727C,0xFF5D737B,0xFF5C737A,
+   0xFF5B7379,0xFF5A7378,0xFF597177,0xFF597176,0xFF587175,0xFF577174,0xFF577074,
+   0xFF567174,0xFF567173,0xFF567173,0xFF577274,0xFF567273,0xFF567272,0xFF557272,
+   0xFF567373,0xFF577474,0xFF5E7B7B,0xFF526D6F,0xFF2C4045,0xFF2F4148,0xFF455A62,
+   0xFF51666E,0xFF546971,0xFF50656D,0xFF44585F,0xFF2D3F46,0xFF1E2D34,0xFF1D2D32,
+   0xFF223339,0xFF2D4046,0xFF354A50,0xFF3A5156,0xFF3D555A,0xFF41575E,0xFF435561,
+   0xFF3D4E5A,0xFF303F4B,0xFF1E2934,0xFF1A242F,0xFF2E3E4E,0xFF4C6071,0xFF5B7281,
+   0xFF5A727F,0xFF5A727F,0xFF5A7280,0xFF5A7280,0xFF5A7280,0xFF5A727F,0xFF5A717F,
+   0xFF5A707E,0xFF596F7E,0xFF586E7D,0xFF586D7C,0xFF586D7D,0xFF5A6E7F,0xFF5D7483,
+   0xFF465B6A,0xFF233140,0xFF17212B,0xFF19232E,0xFF1F2935,0xFF25313D,0xFF283441,
+   0xFF2D3947,0xFF374453,0xFF404D5E,0xFF445162,0xFF455264,0xFF465365,0xFF4A5869,
+   0xFF4D5B6C,0xFF505E6F,0xFF536172,0xFF556373,0xFF576677,0xFF5B6A7C,0xFF5E6D80,
+   0xFF59687A,0xFF526073,0xFF4A5769,0xFF3E4A5C,0xFF374253,0xFF2E3949,0xFF252E3D,
+   0xFF364254,0xFF566577,0xFF68798A,0xFF677889,0xFF677788,0xFF677889,0xFF677788,
+   0xFF667788,0xFF667687,0xFF657586,0xFF647385,0xFF637283,0xFF627082,0xFF616F81,
+   0xFF616F81,0xFF616F81,0xFF616F81,0xFF606E80,0xFF5E6C7E,0xFF5E6C7E,0xFF5E6C7E,
+   0xFF5D6C7D,0xFF5D6B7D,0xFF5C6B7C,0xFF5C6B7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,
+   0xFF5C6B7D,0xFF5C6C7D,0xFF5D6D7E,0xFF5E6E7F,0xFF647585,0xFF576877,0xFF303D4B,
+   0xFF323F4D,0xFF475865,0xFF526570,0xFF556973,0xFF51656F,0xFF455962,0xFF2E4049,
+   0xFF1F2E38,0xFF1F2D38,0xFF253440,0xFF2F404E,0xFF384A58,0xFF3E505E,0xFF415362,
+   0xFF445565,0xFF445565,0xFF3D4E5C,0xFF2F404B,0xFF1D2B32,0xFF18252B,0xFF2A3E44,
+   0xFF4A6268,0xFF5C747B,0xFF5D737C,0xFF5C727C,0xFF5D727C,0xFF5D727D,0xFF5E717E,
+   0xFF5E707E,0xFF5E6F7E,0xFF5D6E7E,0xFF5D6D7D,0xFF5C6C7B,0xFF5B6B7B,0xFF5B6B7B,
+   0xFF5D6D7D,0xFF627283,0xFF495769,0xFF242C3B,0xFF181F2C,0xFF1A222F,0xFF202836,
+   0xFF26303F,0xFF293343,0xFF2D3949,0xFF374455,0xFF404D5F,0xFF435163,0xFF455365,
+   0xFF465466,0xFF49586B,0xFF4D5C6F,0xFF506073,0xFF526376,0xFF556579,0xFF57687D,
+   0xFF5B6D82,0xFF5E7086,0xFF6A7E95,0xFF6C8097,0xFF6E8399,0xFF6D8096,0xFF67788D,
+   0xFF58687C,0xFF3F4C5D,0xFF2E3B4A,0xFF445464,0xFF607280,0xFF627682,0xFF617681,
+   0xFF617782,0xFF617881,0xFF617781,0xFF607780,0xFF5F777E,0xFF5F767E,0xFF5E757D,
+   0xFF5D747C,0xFF5C727B,0xFF5B7179,0xFF5A7278,0xFF597277,0xFF587276,0xFF587176,
+   0xFF587176,0xFF587175,0xFF577174,0xFF587175,0xFF587276,0xFF597378,0xFF5A7378,
+   0xFF597378,0xFF587376,0xFF577475,0xFF597576,0xFF5B7779,0xFF5D797B,0xFF5D797C,
+   0xFF3B5458,0xFF3A5156,0xFF5C747A,0xFF677F85,0xFF657D83,0xFF647C83,0xFF667F85,
+   0xFF6B868B,0xFF5F787D,0xFF2B3E43,0xFF1E2D32,0xFF3A5055,0xFF4D656A,0xFF546C71,
+   0xFF556D72,0xFF556D72,0xFF576F75,0xFF5D737C,0xFF647783,0xFF5C707C,0xFF364751,
+   0xFF1F2C38,0xFF3C5260,0xFF5B7380,0xFF5A737E,0xFF59737E,0xFF59737E,0xFF59737E,
+   0xFF5A727F,0xFF5A717F,0xFF59717D,0xFF59707D,0xFF59707D,0xFF586F7D,0xFF586E7D,
+   0xFF586D7D,0xFF586D7E,0xFF586D7D,0xFF5C7282,0xFF4C6271,0xFF293847,0xFF19232D,
+   0xFF26333E,0xFF374754,0xFF425260,0xFF4C5D6C,0xFF5A6B7A,0xFF607180,0xFF617281,
+   0xFF617181,0xFF617081,0xFF606F80,0xFF606F7F,0xFF5F6F7E,0xFF5F6E7E,0xFF5F6D7E,
+   0xFF5F6D7D,0xFF5F6F7F,0xFF647284,0xFF68778A,0xFF6B7A8D,0xFF6D7C8F,0xFF6F7F92,
+   0xFF6D7D90,0xFF677689,0xFF59677A,0xFF3F4C5E,0xFF2F3A4B,0xFF455365,0xFF617182,
+   0xFF647485,0xFF647485,0xFF647586,0xFF647586,0xFF647485,0xFF647485,0xFF637384,
+   0xFF637284,0xFF627283,0xFF617082,0xFF606F80,0xFF5F6D7F,0xFF5F6D7F,0xFF5F6D7F,
+   0xFF5E6C7E,0xFF5E6C7E,0xFF5E6C7E,0xFF5E6C7E,0xFF5D6C7D,0xFF5D6C7D,0xFF5E6D7E,
+   0xFF5E6E7F,0xFF5F6E7F,0xFF5E6E7F,0xFF5E6E7F,0xFF5E6E7F,0xFF5F6F80,0xFF617183,
+   0xFF637385,0xFF637484,0xFF404F5F,0xFF3E4D5D,0xFF607180,0xFF697D89,0xFF667C86,
+   0xFF667B85,0xFF687E87,0xFF6D848C,0xFF60777F,0xFF2C3D44,0xFF1E2C33,0xFF3B4F57,
+   0xFF4F646D,0xFF566974,0xFF576A75,0xFF586A77,0xFF5A6C79,0xFF5F717E,0xFF637883,
+   0xFF5B727A,0xFF35484F,0xFF1D2B32,0xFF3A5156,0xFF5C757B,0xFF5B747A,0xFF5C737B,
+   0xFF5C737B,0xFF5C737B,0xFF5D727C,0xFF5D717D,0xFF5D6F7D,0xFF5D6E7D,0xFF5D6E7D,
+   0xFF5C6C7C,0xFF5C6B7B,0xFF5C6B7B,0xFF5C6B7B,0xFF5C6B7B,0xFF617082,0xFF505E70,
+   0xFF2A3343,0xFF1A212E,0xFF283241,0xFF384659,0xFF425266,0xFF4D5E73,0xFF5A6D82,
+   0xFF617489,0xFF617489,0xFF617489,0xFF617488,0xFF607387,0xFF5F7287,0xFF5F7287,
+   0xFF5E7186,0xFF5E7186,0xFF5E7186,0xFF5F7287,0xFF63768C,0xFF677B91,0xFF64788E,
+   0xFF64788E,0xFF64788E,0xFF667A90,0xFF697E93,0xFF6F8499,0xFF677A8C,0xFF3D4B5A,
+   0xFF344351,0xFF506370,0xFF617581,0xFF607680,0xFF607680,0xFF607680,0xFF607680,
+   0xFF60767F,0xFF60767F,0xFF5F767E,0xFF5D757C,0xFF5C737B,0xFF5C737B,0xFF5B7279,
+   0xFF597277,0xFF597176,0xFF587176,0xFF587176,0xFF587176,0xFF587176,0xFF597277,
+   0xFF5B737A,0xFF5D747C,0xFF5E747D,0xFF5F747F,0xFF5E757E,0xFF5C767B,0xFF5B777A,
+   0xFF5C787B,0xFF5D797B,0xFF607B7E,0xFF516B6F,0xFF334A4F,0xFF566F74,0xFF647D82,
+   0xFF607A7E,0xFF5F797D,0xFF5F797E,0xFF5F797E,0xFF607A7E,0xFF698388,0xFF475F64,
+   0xFF32474D,0xFF526B70,0xFF556E72,0xFF556D72,0xFF566C73,0xFF556D72,0xFF556D72,
+   0xFF596D76,0xFF5E717D,0xFF677B87,0xFF5B717A,0xFF2C3E49,0xFF425865,0xFF5C7581,
+   0xFF59737D,0xFF59737E,0xFF59737E,0xFF59737D,0xFF59737E,0xFF5A717E,0xFF58707C,
+   0xFF576F7B,0xFF576E7B,0xFF576E7B,0xFF586E7C,0xFF586D7D,0xFF586D7D,0xFF586D7D,
+   0xFF5B7180,0xFF455A6B,0xFF253341,0xFF25323D,0xFF435562,0xFF576A78,0xFF5D707D,
+   0xFF5E707D,0xFF5E6F7D,0xFF5C6D7A,0xFF5B6D79,0xFF5B6D79,0xFF5C6C7A,0xFF5C6C7B,
+   0xFF5C6C7B,0xFF5C6C7B,0xFF5D6B7B,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6C7C,0xFF606F80,
+   0xFF647385,0xFF657487,0xFF657487,0xFF657487,0xFF677689,0xFF6A7A8D,0xFF708093,
+   0xFF68788B,0xFF3E4A5C,0xFF364253,0xFF526173,0xFF637384,0xFF637384,0xFF637384,
+   0xFF637384,0xFF637384,0xFF637384,0xFF637384,0xFF637284,0xFF617182,0xFF606F81,
+   0xFF606F81,0xFF5F6E80,0xFF5E6D7F,0xFF5E6C7E,0xFF5E6C7E,0xFF5E6C7E,0xFF5E6C7E,
+   0xFF5E6C7E,0xFF5E6D7F,0xFF606E80,0xFF617082,0xFF627183,0xFF627183,0xFF627283,
+   0xFF627183,0xFF617183,0xFF627284,0xFF637385,0xFF667587,0xFF576677,0xFF384655,
+   0xFF5A6B7A,0xFF677A87,0xFF637883,0xFF627781,0xFF617781,0xFF617780,0xFF627980,
+   0xFF6B828A,0xFF485E65,0xFF33474D,0xFF536B70,0xFF576C74,0xFF586A75,0xFF586A76,
+   0xFF586A77,0xFF586A77,0xFF5A6D78,0xFF5C727A,0xFF647D83,0xFF597278,0xFF2B3D43,
+   0xFF40585D,0xFF5D767B,0xFF5B7479,0xFF5B747A,0xFF5B737A,0xFF5C737B,0xFF5C727C,
+   0xFF5C707C,0xFF5C6E7B,0xFF5B6C7B,0xFF5C6C7B,0xFF5C6B7B,0xFF5C6B7B,0xFF5C6B7B,
+   0xFF5C6B7B,0xFF5C6B7B,0xFF5F6F80,0xFF485668,0xFF262F3E,0xFF263040,0xFF455569,
+   0xFF586C81,0xFF5D7287,0xFF5E7286,0xFF5E7286,0xFF5D7085,0xFF5C6F84,0xFF5C6F84,
+   0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,
+   0xFF5C6F85,0xFF5F7388,0xFF63768C,0xFF64788E,0xFF64788E,0xFF64788E,0xFF63788D,
+   0xFF63798D,0xFF63798D,0xFF6D8396,0xFF586B7A,0xFF32414E,0xFF3A4B57,0xFF526671,
+   0xFF5F757F,0xFF607780,0xFF607680,0xFF607680,0xFF607680,0xFF607580,0xFF5E757D,
+   0xFF5C747B,0xFF5C737B,0xFF5C737A,0xFF5B737A,0xFF5A7379,0xFF5A7278,0xFF597177,
+   0xFF597176,0xFF597177,0xFF5A7178,0xFF5B727A,0xFF5E737D,0xFF5F747F,0xFF5F747F,
+   0xFF607380,0xFF607480,0xFF5F767F,0xFF5E777E,0xFF5E787D,0xFF5D797B,0xFF617C7F,
+   0xFF415A5E,0xFF445C61,0xFF617B7F,0xFF607A7D,0xFF5F7B7D,0xFF5E7A7C,0xFF5F7A7D,
+   0xFF5F797D,0xFF5F797D,0xFF637D82,0xFF51696E,0xFF3F575C,0xFF566E73,0xFF556D72,
+   0xFF556D72,0xFF556D72,0xFF556D72,0xFF566C73,0xFF586E76,0xFF5B6F7A,0xFF5D727C,
+   0xFF657D85,0xFF435862,0xFF415664,0xFF5A737F,0xFF59737E,0xFF5A727F,0xFF5A727F,
+   0xFF59737E,0xFF59737D,0xFF5A717E,0xFF586F7D,0xFF576E7C,0xFF576E7B,0xFF576E7B,
+   0xFF586D7D,0xFF586D7E,0xFF586D7E,0xFF596E7E,0xFF596E7E,0xFF3C4F60,0xFF202B38,
+   0xFF303E4B,0xFF526572,0xFF5C707C,0xFF5A6C79,0xFF5A6C78,0xFF5A6D78,0xFF5B6D79,
+   0xFF5B6E7A,0xFF5C6E7B,0xFF5C6D7B,0xFF5C6D7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5D6B7C,
+   0xFF5D6B7C,0xFF5D6B7B,0xFF5D6C7B,0xFF5F6E7F,0xFF637284,0xFF657487,0xFF657487,
+   0xFF657487,0xFF657487,0xFF657487,0xFF657487,0xFF6F7F91,0xFF5A697B,0xFF343F50,
+   0xFF3C495A,0xFF556375,0xFF627283,0xFF637384,0xFF637384,0xFF637384,0xFF637384,
+   0xFF637384,0xFF627183,0xFF607081,0xFF606F81,0xFF606F81,0xFF606F81,0xFF5F6E80,
+   0xFF5F6D7F,0xFF5E6C7E,0xFF5E6C7E,0xFF5E6C7E,0xFF5E6C7E,0xFF606E80,0xFF617082,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627284,0xFF637385,0xFF637385,0xFF637385,
+   0xFF637385,0xFF667688,0xFF475566,0xFF495868,0xFF667786,0xFF627882,0xFF627782,
+   0xFF627782,0xFF627781,0xFF617880,0xFF60787F,0xFF647C83,0xFF51696F,0xFF40575C,
+   0xFF556E72,0xFF566C73,0xFF576A75,0xFF586A77,0xFF586A77,0xFF586A76,0xFF596D76,
+   0xFF597177,0xFF5B7478,0xFF647E83,0xFF41575D,0xFF3E565B,0xFF5B7579,0xFF5A7479,
+   0xFF5B7479,0xFF5B747A,0xFF5B737A,0xFF5C727A,0xFF5B707B,0xFF5B6E7B,0xFF5C6C7C,
+   0xFF5C6B7C,0xFF5C6B7C,0xFF5C6B7C,0xFF5C6B7C,0xFF5C6B7C,0xFF5D6C7D,0xFF5C6C7D,
+   0xFF3E4B5D,0xFF202937,0xFF313E50,0xFF53677B,0xFF5D7285,0xFF5A6F82,0xFF5A6E81,
+   0xFF5B6F83,0xFF5C6F84,0xFF5D7085,0xFF5D7085,0xFF5D7085,0xFF5D7085,0xFF5C6F84,
+   0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,0xFF5E7287,0xFF62758B,
+   0xFF64788E,0xFF64788E,0xFF64788E,0xFF63798D,0xFF63798D,0xFF63798C,0xFF667C8F,
+   0xFF677C8C,0xFF3C4D5A,0xFF2A3844,0xFF354551,0xFF455963,0xFF586D78,0xFF607680,
+   0xFF607580,0xFF607580,0xFF5F757F,0xFF5D737C,0xFF5C737B,0xFF5C737B,0xFF5B737A,
+   0xFF5B747A,0xFF5B747A,0xFF5B7379,0xFF5A7178,0xFF5A7078,0xFF5B6F79,0xFF5C707B,
+   0xFF5E727E,0xFF5F737F,0xFF60737F,0xFF60737F,0xFF60737F,0xFF5F747F,0xFF5F757E,
+   0xFF5F767E,0xFF5E787D,0xFF5D797C,0xFF5F7B7E,0xFF3B5457,0xFF567074,0xFF617C7E,
+   0xFF5F7C7C,0xFF5E7B7C,0xFF5E7A7C,0xFF5F7A7D,0xFF5F7A7D,0xFF5F797E,0xFF617B80,
+   0xFF4B6368,0xFF445C60,0xFF566E72,0xFF556D72,0xFF556D72,0xFF556D72,0xFF556D72,
+   0xFF556D72,0xFF576E74,0xFF5A7078,0xFF5C717A,0xFF627881,0xFF576D77,0xFF3D535F,
+   0xFF57707B,0xFF5A727E,0xFF5A727F,0xFF5A727F,0xFF5A727E,0xFF59717D,0xFF59707D,
+   0xFF59707D,0xFF586F7D,0xFF576E7C,0xFF586E7C,0xFF586D7D,0xFF596C7E,0xFF596B7F,
+   0xFF5B6E81,0xFF4F6375,0xFF324352,0xFF1B242F,0xFF2F3D4A,0xFF4C5E6B,0xFF596C79,
+   0xFF596C78,0xFF5A6C78,0xFF5B6D79,0xFF5C6E7A,0xFF5C6E7B,0xFF5C6E7C,0xFF5D6D7C,
+   0xFF5D6D7C,0xFF5D6D7C,0xFF5C6C7B,0xFF5D6B7B,0xFF5D6B7C,0xFF5D6B7B,0xFF5D6B7C,
+   0xFF5E6D7E,0xFF627183,0xFF657487,0xFF657487,0xFF657487,0xFF657487,0xFF657487,
+   0xFF657487,0xFF68778A,0xFF69798B,0xFF3E4B5D,0xFF2C3647,0xFF374355,0xFF485668,
+   0xFF5B6A7C,0xFF637384,0xFF637384,0xFF637384,0xFF627283,0xFF617082,0xFF606F81,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606E80,0xFF5F6D7F,0xFF5E6C7E,
+   0xFF5E6C7E,0xFF5F6E80,0xFF617082,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627284,0xFF637284,0xFF637385,0xFF637385,0xFF657587,0xFF414E60,
+   0xFF5C6B7C,0xFF667787,0xFF647783,0xFF637782,0xFF627682,0xFF627782,0xFF617781,
+   0xFF60787F,0xFF627B80,0xFF4B6368,0xFF445C61,0xFF556E72,0xFF556D72,0xFF576B74,
+   0xFF586A77,0xFF586A76,0xFF576B75,0xFF576E74,0xFF587175,0xFF597376,0xFF5F7A7D,
+   0xFF546E72,0xFF3A5357,0xFF577275,0xFF5A7478,0xFF5A7479,0xFF5B7479,0xFF5B7379,
+   0xFF5B717A,0xFF5B707B,0xFF5C6F7C,0xFF5C6D7D,0xFF5C6B7C,0xFF5C6B7B,0xFF5C6B7B,
+   0xFF5C6B7C,0xFF5C6B7C,0xFF5E6D7E,0xFF526173,0xFF333F50,0xFF1C2331,0xFF303D50,
+   0xFF4D5F74,0xFF5A6E82,0xFF596E81,0xFF5A6F82,0xFF5B7084,0xFF5D7085,0xFF5D7086,
+   0xFF5D7086,0xFF5D7086,0xFF5D7086,0xFF5D7085,0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,
+   0xFF5C6F84,0xFF5C6F84,0xFF5D7186,0xFF617489,0xFF63778D,0xFF64788E,0xFF64788D,
+   0xFF63788D,0xFF63798C,0xFF63798C,0xFF62788B,0xFF677E8E,0xFF445663,0xFF2A3944,
+   0xFF33434F,0xFF344550,0xFF384A55,0xFF4F636E,0xFF607580,0xFF607680,0xFF5F747E,
+   0xFF5D737C,0xFF5C737B,0xFF5C737B,0xFF5C737A,0xFF5B737A,0xFF5B747A,0xFF5B747A,
+   0xFF5B7379,0xFF5B7179,0xFF5C707B,0xFF5F717E,0xFF607380,0xFF607380,0xFF607380,
+   0xFF60737F,0xFF5F747F,0xFF5F747E,0xFF5E757D,0xFF5E757D,0xFF5D777C,0xFF5E7A7C,
+   0xFF5C787A,0xFF3D5759,0xFF5D787A,0xFF5F7C7D,0xFF5E7C7C,0xFF5E7B7C,0xFF5E7A7C,
+   0xFF5F7A7D,0xFF60797E,0xFF60797F,0xFF617A7F,0xFF455D62,0xFF445C60,0xFF556E72,
+   0xFF556D72,0xFF556D72,0xFF556C72,0xFF556D72,0xFF556D71,0xFF566E73,0xFF587075,
+   0xFF5A7278,0xFF5D747B,0xFF5C747B,0xFF3A505A,0xFF516974,0xFF5A727D,0xFF59727D,
+   0xFF59727D,0xFF58727C,0xFF58717C,0xFF58717C,0xFF59717D,0xFF596F7E,0xFF596E7F,
+   0xFF596D7F,0xFF586D7E,0xFF596D7E,0xFF5A6C80,0xFF57697D,0xFF3F5164,0xFF24313E,
+   0xFF17202A,0xFF26323E,0xFF415260,0xFF576976,0xFF596C78,0xFF5A6D79,0xFF5C6E7A,
+   0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6C7C,0xFF5C6B7B,
+   0xFF5C6C7B,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5E6C7D,0xFF616F81,0xFF647386,
+   0xFF657487,0xFF657486,0xFF657486,0xFF657486,0xFF657487,0xFF647385,0xFF69798A,
+   0xFF465466,0xFF2C3747,0xFF354152,0xFF364253,0xFF3B4758,0xFF526072,0xFF637384,
+   0xFF637384,0xFF627183,0xFF607081,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF5F6D7F,0xFF5F6D7F,0xFF616F81,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627284,0xFF647486,0xFF637284,0xFF445162,0xFF637284,0xFF667587,0xFF657686,
+   0xFF647684,0xFF637682,0xFF627782,0xFF617781,0xFF60787F,0xFF607A7F,0xFF455D62,
+   0xFF455C61,0xFF556E72,0xFF556D71,0xFF566C73,0xFF586A76,0xFF586A75,0xFF566B74,
+   0xFF566E73,0xFF577174,0xFF597376,0xFF5B7678,0xFF5B7679,0xFF385054,0xFF516A6E,
+   0xFF5A7377,0xFF5A7377,0xFF5A7378,0xFF5A7279,0xFF5A7179,0xFF5B707B,0xFF5C6F7C,
+   0xFF5D6E7D,0xFF5C6D7D,0xFF5B6C7B,0xFF5B6C7B,0xFF5B6C7B,0xFF5C6C7C,0xFF596979,
+   0xFF414E5F,0xFF252E3D,0xFF181F2C,0xFF273242,0xFF425267,0xFF586B7F,0xFF5A6E81,
+   0xFF5A6F82,0xFF5C7184,0xFF5C7185,0xFF5D7085,0xFF5D7086,0xFF5D7086,0xFF5D7085,
+   0xFF5C6F85,0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,0xFF5D7085,
+   0xFF607388,0xFF607489,0xFF607489,0xFF617589,0xFF61778B,0xFF61778B,0xFF617789,
+   0xFF5F7587,0xFF647B8C,0xFF465967,0xFF41525D,0xFF627782,0xFF657C86,0xFF596D78,
+   0xFF3E4F5A,0xFF445661,0xFF596E78,0xFF5E747E,0xFF5D737C,0xFF5C737B,0xFF5C737B,
+   0xFF5C737B,0xFF5C737A,0xFF5B737A,0xFF5B737A,0xFF5C737A,0xFF5C737B,0xFF5E727D,
+   0xFF5F737F,0xFF60737F,0xFF60737F,0xFF607380,0xFF5F747F,0xFF5E747E,0xFF5E757D,
+   0xFF5E757D,0xFF5E757C,0xFF5D767C,0xFF5E7A7D,0xFF506C6E,0xFF3C5558,0xFF5E7A7C,
+   0xFF5F7C7D,0xFF5F7B7C,0xFF5E7A7C,0xFF5F7A7D,0xFF5F7A7D,0xFF60797E,0xFF60797F,
+   0xFF60797F,0xFF425A5E,0xFF435C5F,0xFF556E71,0xFF546D71,0xFF556D72,0xFF556D72,
+   0xFF556D72,0xFF556D71,0xFF556E71,0xFF567073,0xFF587275,0xFF5A7377,0xFF607A7E,
+   0xFF3D545B,0xFF48606A,0xFF5A727D,0xFF59717D,0xFF58727C,0xFF58717C,0xFF58717C,
+   0xFF59707D,0xFF59707E,0xFF5A6F80,0xFF5B6E80,0xFF5A6D80,0xFF596D7E,0xFF596C7E,
+   0xFF5B6E81,0xFF4B5E71,0xFF2F3E4F,0xFF1A232E,0xFF1B242F,0xFF222D39,0xFF334350,
+   0xFF4C5D6A,0xFF5A6C78,0xFF5A6D79,0xFF5C6E7A,0xFF5C6E7B,0xFF5C6E7B,0xFF5D6D7B,
+   0xFF5D6D7C,0xFF5C6C7B,0xFF5C6C7B,0xFF5D6B7B,0xFF5C6C7B,0xFF5D6B7B,0xFF5D6B7B,
+   0xFF5D6B7B,0xFF5D6B7C,0xFF5F6D7E,0xFF617081,0xFF617082,0xFF627182,0xFF637285,
+   0xFF637285,0xFF637284,0xFF617081,0xFF667687,0xFF485667,0xFF435061,0xFF657586,
+   0xFF68798A,0xFF5C6B7C,0xFF404D5E,0xFF465465,0xFF5C6B7C,0xFF617182,0xFF617082,
+   0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,0xFF606F81,
+   0xFF606F81,0xFF617082,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF657486,0xFF576678,
+   0xFF425060,0xFF647584,0xFF657686,0xFF657586,0xFF637684,0xFF637682,0xFF627782,
+   0xFF617880,0xFF60797E,0xFF60797E,0xFF425A5F,0xFF445B61,0xFF566D73,0xFF556D72,
+   0xFF566C73,0xFF576B74,0xFF576A75,0xFF566B74,0xFF556D72,0xFF567073,0xFF587275,
+   0xFF597476,0xFF607A7E,0xFF3D5359,0xFF475F65,0xFF5A7377,0xFF5A7377,0xFF597277,
+   0xFF597278,0xFF5A7179,0xFF5B707B,0xFF5B6F7B,0xFF5C6F7C,0xFF5D6E7D,0xFF5C6D7D,
+   0xFF5B6C7B,0xFF5A6C7A,0xFF5D6F7D,0xFF4D5C6D,0xFF2F3A4B,0xFF1B222F,0xFF1C2330,
+   0xFF232C3B,0xFF354356,0xFF4C5F72,0xFF5A6E81,0xFF5B7082,0xFF5C7184,0xFF5C7184,
+   0xFF5C7185,0xFF5C7084,0xFF5D7084,0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,
+   0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,0xFF5E7186,0xFF5E7287,0xFF5F7387,
+   0xFF607488,0xFF61768A,0xFF617789,0xFF607688,0xFF5F7586,0xFF62798A,0xFF425564,
+   0xFF50626D,0xFF637983,0xFF637983,0xFF697F8A,0xFF687D88,0xFF435661,0xFF33444E,
+   0xFF445862,0xFF506670,0xFF576E76,0xFF5B727A,0xFF5C737B,0xFF5D747B,0xFF5D747B,
+   0xFF5C747B,0xFF5C737B,0xFF5D727C,0xFF5F727E,0xFF5F737F,0xFF5F747E,0xFF5F747E,
+   0xFF5F747E,0xFF5E757D,0xFF5E757D,0xFF5E757C,0xFF5E757C,0xFF5E757D,0xFF5E767C,
+   0xFF5C767A,0xFF3B5458,0xFF3C5357,0xFF607B7E,0xFF5F7B7D,0xFF5F7B7C,0xFF5F7A7C,
+   0xFF5F7A7D,0xFF5F797E,0xFF5F797E,0xFF5F797E,0xFF5F797D,0xFF3F585B,0xFF425B5E,
+   0xFF546E71,0xFF546D71,0xFF556D71,0xFF556D71,0xFF556D71,0xFF546D71,0xFF546E70,
+   0xFF547071,0xFF567273,0xFF587275,0xFF5F7A7D,0xFF486266,0xFF3D555F,0xFF576F7A,
+   0xFF59727D,0xFF58717C,0xFF59717D,0xFF59707E,0xFF59707E,0xFF59707E,0xFF5A6F7F,
+   0xFF5A6F7F,0xFF596F7F,0xFF596E7E,0xFF596E7E,0xFF546979,0xFF364858,0xFF212D3A,
+   0xFF1D2833,0xFF2F3E4A,0xFF3E4F5C,0xFF3B4B58,0xFF364653,0xFF4B5D69,0xFF5A6E78,
+   0xFF5B6F7A,0xFF5B6E7A,0xFF5C6E7B,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6C7C,
+   0xFF5D6C7C,0xFF5C6C7B,0xFF5C6C7B,0xFF5C6C7B,0xFF5D6B7B,0xFF5D6D7C,0xFF5E6E7E,
+   0xFF5F6E7F,0xFF606F80,0xFF617081,0xFF627183,0xFF637284,0xFF627183,0xFF617081,
+   0xFF647485,0xFF445263,0xFF526071,0xFF667687,0xFF667687,0xFF6C7D8E,0xFF6A7B8C,
+   0xFF465464,0xFF354252,0xFF485567,0xFF546375,0xFF5B6A7C,0xFF5F6E80,0xFF606F81,
+   0xFF617082,0xFF617082,0xFF617082,0xFF606F81,0xFF616F81,0xFF617082,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF617183,0xFF414F5F,0xFF40505D,0xFF647784,0xFF647785,
+   0xFF647684,0xFF627682,0xFF617781,0xFF617880,0xFF60787F,0xFF60797E,0xFF60797E,
+   0xFF40575C,0xFF445A60,0xFF566D73,0xFF566C73,0xFF566C73,0xFF576B74,0xFF576A75,
+   0xFF576B74,0xFF556D72,0xFF556F73,0xFF577174,0xFF587275,0xFF5F7A7D,0xFF496066,
+   0xFF3E535A,0xFF577075,0xFF5A7378,0xFF5A7278,0xFF5A7178,0xFF5A7179,0xFF5B707B,
+   0xFF5C6F7B,0xFF5C6F7C,0xFF5D6E7D,0xFF5D6D7D,0xFF5B6D7B,0xFF5B6E7B,0xFF566875,
+   0xFF374554,0xFF222B39,0xFF1F2735,0xFF303C4C,0xFF404E5E,0xFF3C4B5B,0xFF374758,
+   0xFF4C5F71,0xFF5B7082,0xFF5C7184,0xFF5C7184,0xFF5C7185,0xFF5C7185,0xFF5D7085,
+   0xFF5D7085,0xFF5D7085,0xFF5C6F85,0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,0xFF5C6F84,
+   0xFF5D7085,0xFF5D7187,0xFF5E7287,0xFF5E7287,0xFF5F7387,0xFF5F7487,0xFF5F7587,
+   0xFF5F7587,0xFF5F7687,0xFF5C7283,0xFF3C4E5D,0xFF576975,0xFF5F747F,0xFF607580,
+   0xFF607580,0xFF657B85,0xFF697F89,0xFF42555F,0xFF283942,0xFF30424B,0xFF3A4E57,
+   0xFF42575F,0xFF485D65,0xFF4C626A,0xFF4F656D,0xFF546A72,0xFF596F78,0xFF5E727C,
+   0xFF5F727F,0xFF60747F,0xFF5F757E,0xFF5E767D,0xFF5F767D,0xFF5E767D,0xFF5E757E,
+   0xFF5F757E,0xFF5F757E,0xFF5F757F,0xFF5D757C,0xFF476065,0xFF2A3E43,0xFF374E51,
+   0xFF5D787B,0xFF607B7E,0xFF5F7A7C,0xFF5E797C,0xFF5E797C,0xFF5F797D,0xFF60797E,
+   0xFF5F797E,0xFF5F7A7D,0xFF3F575B,0xFF41595D,0xFF556E71,0xFF546D71,0xFF546D71,
+   0xFF546D71,0xFF546D71,0xFF546E70,0xFF536E6F,0xFF536F70,0xFF557171,0xFF567273,
+   0xFF5B7579,0xFF5B7479,0xFF384F56,0xFF465F69,0xFF58717B,0xFF59717D,0xFF59707D,
+   0xFF5A707E,0xFF59707D,0xFF59717D,0xFF59707D,0xFF59707D,0xFF586F7D,0xFF59707D,
+   0xFF506774,0xFF394E5A,0xFF354650,0xFF40535C,0xFF364752,0xFF3C4E59,0xFF5E737E,
+   0xFF627783,0xFF596D79,0xFF435560,0xFF485B65,0xFF5B6E79,0xFF5D707B,0xFF5D6E7C,
+   0xFF5D6E7C,0xFF5D6D7C,0xFF5D6D7D,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5C6C7B,
+   0xFF5D6B7B,0xFF5D6D7C,0xFF5E6E7E,0xFF5E6F7F,0xFF5F6E80,0xFF5F6E80,0xFF606F80,
+   0xFF617081,0xFF617082,0xFF617082,0xFF617082,0xFF5E6D7E,0xFF3E4B5C,0xFF596878,
+   0xFF627283,0xFF637283,0xFF637384,0xFF687889,0xFF6C7C8D,0xFF455364,0xFF2B3646,
+   0xFF333F50,0xFF3E4B5C,0xFF465365,0xFF4C596B,0xFF505E70,0xFF536173,0xFF586678,
+   0xFF5D6B7D,0xFF616F81,0xFF627082,0xFF627183,0xFF637284,0xFF637284,0xFF637284,
+   0xFF637284,0xFF627284,0xFF637284,0xFF637284,0xFF637284,0xFF617183,0xFF4D5B6D,
+   0xFF2E3B49,0xFF3B4A57,0xFF617482,0xFF647784,0xFF637682,0xFF617681,0xFF607680,
+   0xFF60777F,0xFF61787F,0xFF60797F,0xFF60797F,0xFF40565D,0xFF42575F,0xFF576C74,
+   0xFF566C73,0xFF566B74,0xFF576B75,0xFF586A75,0xFF576B75,0xFF556D72,0xFF556E72,
+   0xFF567073,0xFF577174,0xFF5B7578,0xFF5B7479,0xFF384C54,0xFF475E64,0xFF5A7178,
+   0xFF5B707A,0xFF5A7179,0xFF5A707A,0xFF5B707B,0xFF5C6F7B,0xFF5C6F7C,0xFF5C6E7C,
+   0xFF5C6D7C,0xFF5C6E7B,0xFF536572,0xFF3A4B57,0xFF364451,0xFF425160,0xFF384655,
+   0xFF3E4C5C,0xFF607181,0xFF647685,0xFF5B6C7C,0xFF445465,0xFF495C6D,0xFF5C7083,
+   0xFF5D7285,0xFF5D7285,0xFF5C7185,0xFF5D7185,0xFF5D7085,0xFF5D7085,0xFF5D7085,
+   0xFF5D7085,0xFF5C6F84,0xFF5C6F84,0xFF5D7085,0xFF5E7187,0xFF5E7287,0xFF5E7287,
+   0xFF5E7287,0xFF5F7387,0xFF5E7486,0xFF5E7486,0xFF5E7485,0xFF607788,0xFF516677,
+   0xFF3A4A58,0xFF5C6F7A,0xFF5E727D,0xFF5E727D,0xFF5E727D,0xFF5D727C,0xFF637882,
+   0xFF4C606A,0xFF25343D,0xFF1A252E,0xFF212F38,0xFF293942,0xFF2F424A,0xFF344750,
+   0xFF354A52,0xFF364B53,0xFF3C505A,0xFF475A66,0xFF526571,0xFF556974,0xFF546B73,
+   0xFF546B73,0xFF546A73,0xFF556B73,0xFF566C75,0xFF556B74,0xFF546973,0xFF536872,
+   0xFF465C64,0xFF2F434A,0xFF1E2E33,0xFF354C50,0xFF597476,0xFF607B7D,0xFF5E797C,
+   0xFF5E797C,0xFF5E797C,0xFF5F787D,0xFF60787F,0xFF60797E,0xFF607A7F,0xFF40585C,
+   0xFF3F575C,0xFF556D72,0xFF556D71,0xFF546D71,0xFF546D71,0xFF546E70,0xFF546E70,
+   0xFF536F70,0xFF536F70,0xFF547070,0xFF557172,0xFF577174,0xFF5E787D,0xFF4E686C,
+   0xFF324A50,0xFF476069,0xFF566F7A,0xFF59717D,0xFF58717C,0xFF57727B,0xFF57727A,
+   0xFF57717B,0xFF57717B,0xFF57707B,0xFF4C636F,0xFF3A505B,0xFF4D636B,0xFF5F777E,
+   0xFF647C83,0xFF5D747C,0xFF3A4D57,0xFF556A73,0xFF5E737D,0xFF637883,0xFF667A85,
+   0xFF4B5E69,0xFF435561,0xFF5A6C78,0xFF5F707E,0xFF5E6F7D,0xFF5D6F7D,0xFF5E6E7D,
+   0xFF5D6D7D,0xFF5D6D7D,0xFF5D6D7D,0xFF5D6D7C,0xFF5D6D7D,0xFF5E6E7E,0xFF5F6E80,
+   0xFF5F6E80,0xFF5F6E80,0xFF5F6E80,0xFF606F80,0xFF606F80,0xFF606F80,0xFF606F80,
+   0xFF627282,0xFF536173,0xFF3C4858,0xFF5E6D7E,0xFF607081,0xFF617081,0xFF617080,
+   0xFF606F80,0xFF667587,0xFF4F5D6F,0xFF273140,0xFF1C2431,0xFF242D3C,0xFF2C3646,
+   0xFF333E4F,0xFF384455,0xFF394657,0xFF3A4759,0xFF404D5F,0xFF4A586A,0xFF546375,
+   0xFF586678,0xFF586779,0xFF586779,0xFF586779,0xFF596779,0xFF5A687A,0xFF596779,
+   0xFF576678,0xFF576577,0xFF4A586A,0xFF333F4F,0xFF212B38,0xFF394856,0xFF5D6F7D,
+   0xFF647784,0xFF627582,0xFF627581,0xFF617681,0xFF617680,0xFF617780,0xFF617880,
+   0xFF617980,0xFF42565E,0xFF41555F,0xFF576B75,0xFF576B75,0xFF576B75,0xFF586A75,
+   0xFF586A76,0xFF576B75,0xFF556D73,0xFF546E72,0xFF556F72,0xFF567073,0xFF567174,
+   0xFF5E787D,0xFF50666E,0xFF34474F,0xFF485E65,0xFF586E77,0xFF5B707A,0xFF5B707A,
+   0xFF5B6F7B,0xFF5B6F7B,0xFF5B6E7B,0xFF5C6E7C,0xFF5B6D7B,0xFF4E606D,0xFF3C4C59,
+   0xFF4F616D,0xFF627582,0xFF677987,0xFF5F7180,0xFF3C4B59,0xFF576877,0xFF607180,
+   0xFF657685,0xFF687988,0xFF4D5D6D,0xFF445667,0xFF5A6E80,0xFF5E7386,0xFF5E7386,
+   0xFF5D7286,0xFF5D7186,0xFF5D7086,0xFF5D7086,0xFF5D7086,0xFF5D7085,0xFF5D7086,
+   0xFF5E7187,0xFF5E7287,0xFF5E7287,0xFF5E7287,0xFF5E7287,0xFF5E7287,0xFF5E7386,
+   0xFF5E7486,0xFF5F7586,0xFF5D7284,0xFF384A5A,0xFF3C4C58,0xFF5F727E,0xFF5E717C,
+   0xFF5D727C,0xFF5E727C,0xFF5E737D,0xFF51656F,0xFF32434E,0xFF293743,0xFF2D3C47,
+   0xFF32434D,0xFF374953,0xFF3C5059,0xFF40545E,0xFF3D525B,0xFF334750,0xFF2C3C46,
+   0xFF2B3A45,0xFF31414C,0xFF33454F,0xFF32454D,0xFF31454C,0xFF31444D,0xFF33454F,
+   0xFF364853,0xFF374953,0xFF374953,0xFF354851,0xFF31454D,0xFF293C42,0xFF203136,
+   0xFF32484D,0xFF536D71,0xFF5E797C,0xFF5D787B,0xFF5D777C,0xFF5E777C,0xFF5F777E,
+   0xFF60777F,0xFF60787F,0xFF61797F,0xFF41595D,0xFF3E555A,0xFF556D72,0xFF556D71,
+   0xFF556D71,0xFF546D71,0xFF546D70,0xFF536E70,0xFF536F70,0xFF536F70,0xFF547070,
+   0xFF547071,0xFF557073,0xFF577175,0xFF5E7A7C,0xFF415C5D,0xFF30484E,0xFF445D66,
+   0xFF546F78,0xFF57737A,0xFF567379,0xFF567279,0xFF557178,0xFF4E6871,0xFF3F5760,
+   0xFF344951,0xFF4E656C,0xFF5A7379,0xFF597177,0xFF5A7278,0xFF647C82,0xFF42565E,
+   0xFF475B64,0xFF5D727B,0xFF5C717B,0xFF5F747E,0xFF677B86,0xFF50626E,0xFF3F4F5C,
+   0xFF586A76,0xFF5E717D,0xFF5E707D,0xFF5D6F7D,0xFF5D6E7D,0xFF5E6E7D,0xFF5E6E7E,
+   0xFF5D6E7D,0xFF5D6E7D,0xFF5F6E7F,0xFF5F6E80,0xFF5F6E80,0xFF5F6E80,0xFF5F6E80,
+   0xFF5F6E80,0xFF606F80,0xFF606F80,0xFF607080,0xFF5F6E7E,0xFF3A4757,0xFF3E4A5A,
+   0xFF617081,0xFF606F80,0xFF606F80,0xFF607080,0xFF607180,0xFF546373,0xFF354151,
+   0xFF2B3646,0xFF2F3A4A,0xFF354051,0xFF3A4658,0xFF404D5E,0xFF445163,0xFF414E60,
+   0xFF374355,0xFF2E3A4A,0xFF2D3849,0xFF333F50,0xFF364354,0xFF364253,0xFF354152,
+   0xFF354152,0xFF364354,0xFF394557,0xFF3A4658,0xFF3A4658,0xFF384556,0xFF354252,
+   0xFF2D3948,0xFF232E3B,0xFF364453,0xFF586978,0xFF627582,0xFF617481,0xFF617481,
+   0xFF617481,0xFF617580,0xFF617680,0xFF617781,0xFF627881,0xFF445761,0xFF40525D,
+   0xFF586B76,0xFF586A75,0xFF586A76,0xFF596977,0xFF596977,0xFF576A75,0xFF566D73,
+   0xFF546E72,0xFF556F72,0xFF556F73,0xFF566F73,0xFF587076,0xFF607880,0xFF445961,
+   0xFF31444C,0xFF465A63,0xFF586D77,0xFF5C707B,0xFF5C6F7B,0xFF5C6F7B,0xFF5B6C7A,
+   0xFF546373,0xFF435362,0xFF374653,0xFF51636F,0xFF5D717C,0xFF5C6F7B,0xFF5D6F7D,
+   0xFF667987,0xFF445462,0xFF495967,0xFF5F707E,0xFF5E6F7E,0xFF617281,0xFF687A89,
+   0xFF516170,0xFF405161,0xFF586C7E,0xFF5F7486,0xFF5E7386,0xFF5D7286,0xFF5E7186,
+   0xFF5E7187,0xFF5E7187,0xFF5D7186,0xFF5D7187,0xFF5E7287,0xFF5E7287,0xFF5E7287,
+   0xFF5E7287,0xFF5E7287,0xFF5E7287,0xFF5E7386,0xFF5E7486,0xFF5D7385,0xFF45596B,
+   0xFF283644,0xFF3F4F5C,0xFF5A6D79,0xFF5C6F7A,0xFF586C77,0xFF546873,0xFF4B5F69,
+   0xFF3D4F59,0xFF42535F,0xFF4F616E,0xFF586A77,0xFF5D717D,0xFF617681,0xFF647983,
+   0xFF667B85,0xFF677B86,0xFF586C77,0xFF3B4D59,0xFF26343F,0xFF1A252F,0xFF1B272F,
+   0xFF23343B,0xFF30454C,0xFF435860,0xFF566C75,0xFF5E737D,0xFF607780,0xFF617880,
+   0xFF60767F,0xFF587177,0xFF4B6569,0xFF385154,0xFF2D4348,0xFF486065,0xFF5E787C,
+   0xFF5D777B,0xFF5D777C,0xFF5E777C,0xFF5F767E,0xFF5F757F,0xFF5F767E,0xFF5F777D,
+   0xFF435A5F,0xFF3C5258,0xFF556D72,0xFF556D72,0xFF556D72,0xFF556D72,0xFF546D71,
+   0xFF546E71,0xFF546F71,0xFF546F71,0xFF547071,0xFF547071,0xFF547071,0xFF547072,
+   0xFF597576,0xFF5A7778,0xFF365052,0xFF2C4448,0xFF3C575B,0xFF436164,0xFF456266,
+   0xFF435F64,0xFF3D585D,0xFF395258,0xFF33484D,0xFF3B5155,0xFF496066,0xFF4A6167,
+   0xFF4C6469,0xFF4C6168,0xFF4E646B,0xFF374A52,0xFF3D5058,0xFF5C727A,0xFF5C727A,
+   0xFF5C727A,0xFF5E737D,0xFF687C88,0xFF475864,0xFF364852,0xFF50646F,0xFF5D707C,
+   0xFF5D6F7C,0xFF5D6E7C,0xFF5D6E7D,0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7D,0xFF5E6E7E,
+   0xFF5E6F7F,0xFF5E6F7F,0xFF5E6F7F,0xFF5F6E7F,0xFF5F6E7F,0xFF5F6E80,0xFF607080,
+   0xFF5E6F7E,0xFF475666,0xFF293444,0xFF404D5E,0xFF5C6B7C,0xFF5E6D7E,0xFF5B6A7B,
+   0xFF576677,0xFF4E5C6C,0xFF3F4C5D,0xFF445162,0xFF515F71,0xFF5A687B,0xFF606F81,
+   0xFF647385,0xFF677688,0xFF69788A,0xFF6A788B,0xFF5B697B,0xFF3E4B5C,0xFF283241,
+   0xFF1C2330,0xFF1D2532,0xFF263040,0xFF354152,0xFF475466,0xFF5A687A,0xFF617082,
+   0xFF647385,0xFF657486,0xFF637385,0xFF5D6C7E,0xFF506071,0xFF3D4C5C,0xFF31404E,
+   0xFF4B5D6A,0xFF627581,0xFF617481,0xFF617482,0xFF617481,0xFF607580,0xFF607580,
+   0xFF607580,0xFF617581,0xFF465764,0xFF3F4F5C,0xFF596A77,0xFF596977,0xFF586A77,
+   0xFF596977,0xFF596977,0xFF586B76,0xFF566D74,0xFF556E72,0xFF556F72,0xFF556F72,
+   0xFF556F73,0xFF566E74,0xFF5C727B,0xFF5E747E,0xFF3A4C57,0xFF30404B,0xFF40525D,
+   0xFF495B67,0xFF4B5C69,0xFF485966,0xFF425160,0xFF3E4C5C,0xFF374453,0xFF3E4E5A,
+   0xFF4B5E69,0xFF4D5F6A,0xFF4F616D,0xFF4E5F6C,0xFF50626E,0xFF394855,0xFF3F4E5B,
+   0xFF5E707D,0xFF5E707E,0xFF5E707D,0xFF60727F,0xFF697B89,0xFF485766,0xFF374859,
+   0xFF516577,0xFF5E7385,0xFF5D7286,0xFF5D7185,0xFF5D7186,0xFF5D7186,0xFF5D7186,
+   0xFF5D7186,0xFF5E7287,0xFF5E7287,0xFF5E7287,0xFF5E7287,0xFF5E7287,0xFF5E7287,
+   0xFF5E7387,0xFF5D7385,0xFF4A5D6F,0xFF2E3D4D,0xFF202A37,0xFF2D3A47,0xFF34434F,
+   0xFF3D4D59,0xFF40525E,0xFF4B5F6A,0xFF596D78,0xFF617681,0xFF657985,0xFF657885,
+   0xFF647683,0xFF627581,0xFF61737F,0xFF5F737E,0xFF5F737E,0xFF617480,0xFF697C88,
+   0xFF60747F,0xFF3B4D58,0xFF212F38,0xFF202F37,0xFF374D54,0xFF526A71,0xFF627A82,
+   0xFF627A82,0xFF617980,0xFF60787E,0xFF5F797E,0xFF617A80,0xFF637D82,0xFF668285,
+   0xFF627E80,0xFF455F62,0xFF364E51,0xFF546F71,0xFF5E787C,0xFF5E777C,0xFF5E777D,
+   0xFF5F767E,0xFF5F757F,0xFF5F757E,0xFF5E767C,0xFF445B61,0xFF3A4E55,0xFF566C73,
+   0xFF566C73,0xFF566C73,0xFF566C73,0xFF556D73,0xFF546E72,0xFF546E72,0xFF546E72,
+   0xFF546F71,0xFF546F71,0xFF547071,0xFF547071,0xFF547071,0xFF5C797A,0xFF516C6E,
+   0xFF2C4446,0xFF1F3334,0xFF243B3D,0xFF2C4748,0xFF3B5758,0xFF4B6868,0xFF587575,
+   0xFF5C7879,0xFF5D787B,0xFF5C757A,0xFF5B747A,0xFF5B737A,0xFF5A7179,0xFF566A74,
+   0xFF364852,0xFF31424B,0xFF576D74,0xFF5D737A,0xFF5D737B,0xFF5D727B,0xFF5D727C,
+   0xFF465763,0xFF283742,0xFF33444F,0xFF4C5F6A,0xFF5C6F7C,0xFF5D6E7D,0xFF5D6E7C,
+   0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7D,0xFF5E6F7E,0xFF5E6F7E,0xFF5E6F7E,
+   0xFF5E6F7E,0xFF5E6F7F,0xFF5F6F80,0xFF5E6F7E,0xFF4B5A6A,0xFF2F3B4A,0xFF212938,
+   0xFF2E3949,0xFF364152,0xFF3F4B5C,0xFF435061,0xFF4E5C6E,0xFF5C6B7B,0xFF647385,
+   0xFF677788,0xFF677688,0xFF667486,0xFF647385,0xFF637183,0xFF627082,0xFF627082,
+   0xFF647284,0xFF6B7A8C,0xFF627282,0xFF3C4B5B,0xFF232D3B,0xFF232D3A,0xFF3B4A5A,
+   0xFF566677,0xFF667688,0xFF677688,0xFF657486,0xFF647485,0xFF647485,0xFF657586,
+   0xFF687889,0xFF6C7C8E,0xFF687889,0xFF4B5A6A,0xFF3A4958,0xFF596A79,0xFF637383,
+   0xFF627383,0xFF617481,0xFF617481,0xFF617481,0xFF617381,0xFF607380,0xFF475865,
+   0xFF3D4B59,0xFF596978,0xFF596978,0xFF596977,0xFF596977,0xFF586A77,0xFF576C76,
+   0xFF566D74,0xFF556D73,0xFF556E72,0xFF556E72,0xFF566E74,0xFF576D75,0xFF596D77,
+   0xFF617581,0xFF556874,0xFF31404C,0xFF232F3A,0xFF283642,0xFF31404D,0xFF40505D,
+   0xFF51616F,0xFF5E6F7D,0xFF617481,0xFF617580,0xFF5E737D,0xFF5E727D,0xFF5E717D,
+   0xFF5C6F7B,0xFF576976,0xFF384754,0xFF32414D,0xFF596B78,0xFF5F717E,0xFF5F717E,
+   0xFF5E717E,0xFF5F717E,0xFF465765,0xFF293745,0xFF344454,0xFF4D6172,0xFF5C7285,
+   0xFF5C7285,0xFF5D7185,0xFF5D7186,0xFF5D7186,0xFF5D7186,0xFF5D7187,0xFF5E7287,
+   0xFF5E7287,0xFF5E7287,0xFF5E7287,0xFF5F7388,0xFF596E82,0xFF445769,0xFF314051,
+   0xFF2D3A49,0xFF313E4D,0xFF3A4857,0xFF465764,0xFF556874,0xFF5F737F,0xFF627782,
+   0xFF607580,0xFF5E737D,0xFF5D727C,0xFF5E717C,0xFF5E717C,0xFF5E717D,0xFF5F717D,
+   0xFF5F717D,0xFF5F717D,0xFF5F717E,0xFF60717F,0xFF697B89,0xFF586B77,0xFF31434D,
+   0xFF2D4047,0xFF50696F,0xFF60787F,0xFF5D757C,0xFF5B757B,0xFF5B757A,0xFF5A7679,
+   0xFF5A7678,0xFF5A7579,0xFF5A7678,0xFF5B7779,0xFF617E80,0xFF658183,0xFF304649,
+   0xFF374D52,0xFF577075,0xFF5E777D,0xFF5E767D,0xFF5F767E,0xFF5F757F,0xFF5E747D,
+   0xFF5E737C,0xFF455A62,0xFF374951,0xFF566B74,0xFF576B75,0xFF576B74,0xFF576B74,
+   0xFF576C75,0xFF566D74,0xFF556D73,0xFF566D74,0xFF556D73,0xFF556E72,0xFF556F72,
+   0xFF557072,0xFF557072,0xFF567273,0xFF5E7B7C,0xFF405D5D,0xFF22383A,0xFF2E4948,
+   0xFF4D6C69,0xFF5A7A76,0xFF587875,0xFF567473,0xFF567373,0xFF577274,0xFF587176,
+   0xFF5A7277,0xFF5B7279,0xFF5C737B,0xFF647A83,0xFF485D66,0xFF273940,0xFF3C5258,
+   0xFF4B6068,0xFF4C6069,0xFF445760,0xFF364750,0xFF2A3943,0xFF24313A,0xFF26353E,
+   0xFF2F404A,0xFF485966,0xFF5A6C7A,0xFF5D6F7D,0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7D,
+   0xFF5D6E7D,0xFF5E6F7E,0xFF5E6F7E,0xFF5E6F7E,0xFF5E6F7E,0xFF5F707F,0xFF5A6A7A,
+   0xFF455464,0xFF323F4E,0xFF2E3A49,0xFF323E4E,0xFF3B4758,0xFF485566,0xFF576677,
+   0xFF617282,0xFF647585,0xFF637383,0xFF617181,0xFF606F80,0xFF606F80,0xFF606F80,
+   0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,0xFF617081,0xFF6A7A8B,
+   0xFF59697A,0xFF344150,0xFF303D4C,0xFF546575,0xFF637585,0xFF607182,0xFF607081,
+   0xFF607081,0xFF607081,0xFF607081,0xFF607081,0xFF607081,0xFF617183,0xFF687889,
+   0xFF6B7B8D,0xFF354151,0xFF3C4959,0xFF5C6B7C,0xFF637383,0xFF627383,0xFF627382,
+   0xFF627383,0xFF617281,0xFF607180,0xFF485766,0xFF394755,0xFF586877,0xFF596978,
+   0xFF596977,0xFF586A76,0xFF576C76,0xFF566D74,0xFF566D73,0xFF556D73,0xFF566D73,
+   0xFF566D74,0xFF576E75,0xFF586D76,0xFF586C77,0xFF5A6E79,0xFF627882,0xFF455864,
+   0xFF273440,0xFF344450,0xFF536672,0xFF607480,0xFF5E727E,0xFF5C6F7B,0xFF5B6F7A,
+   0xFF5A6F79,0xFF5B6F79,0xFF5C707B,0xFF5D707C,0xFF5E717D,0xFF657985,0xFF4A5C68,
+   0xFF293743,0xFF3F4F5C,0xFF4D5E6B,0xFF4E5F6C,0xFF465763,0xFF384854,0xFF2C3A47,
+   0xFF25323E,0xFF283542,0xFF31404F,0xFF485B6C,0xFF5A6F82,0xFF5D7286,0xFF5D7185,
+   0xFF5D7186,0xFF5D7186,0xFF5D7186,0xFF5E7287,0xFF5E7287,0xFF5E7388,0xFF5E7287,
+   0xFF526479,0xFF3A4A5C,0xFF374555,0xFF435262,0xFF516271,0xFF5C6C7C,0xFF627382,
+   0xFF647784,0xFF627682,0xFF5F737E,0xFF5D727C,0xFF5D727C,0xFF5D727C,0xFF5D727B,
+   0xFF5D727B,0xFF5D727C,0xFF5E727D,0xFF5F717D,0xFF5F717D,0xFF5F717D,0xFF5F717F,
+   0xFF60707F,0xFF627281,0xFF677A87,0xFF3F535D,0xFF354A51,0xFF597379,0xFF5C747B,
+   0xFF5B747B,0xFF5B757A,0xFF5A7679,0xFF5A7678,0xFF597778,0xFF597778,0xFF597778,
+   0xFF5A7778,0xFF5C797A,0xFF5C787A,0xFF465D61,0xFF32474E,0xFF40565D,0xFF5B747A,
+   0xFF5F767E,0xFF5F767E,0xFF5F757E,0xFF5D737C,0xFF5D727C,0xFF455862,0xFF33444E,
+   0xFF556973,0xFF576B75,0xFF576B75,0xFF576B75,0xFF576B76,0xFF576B76,0xFF576C76,
+   0xFF576C76,0xFF576C75,0xFF566C75,0xFF566E74,0xFF566F74,0xFF556F73,0xFF556F72,
+   0xFF597677,0xFF4D6A69,0xFF294142,0xFF44615F,0xFF567672,0xFF547470,0xFF547470,
+   0xFF557371,0xFF557372,0xFF577274,0xFF587176,0xFF597177,0xFF5A7177,0xFF5A7178,
+   0xFF5B727A,0xFF3B5058,0xFF1F2D34,0xFF202E35,0xFF27373F,0xFF293941,0xFF2D3E45,
+   0xFF36484F,0xFF41535A,0xFF46585F,0xFF43545D,0xFF394752,0xFF313F4B,0xFF3D4C5A,
+   0xFF546473,0xFF5D6E7D,0xFF5D6E7C,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7E,0xFF5E6F7E,
+   0xFF5E6F7F,0xFF5E6F7F,0xFF526271,0xFF3A4958,0xFF374554,0xFF435262,0xFF516272,
+   0xFF5C6C7C,0xFF627383,0xFF657685,0xFF637584,0xFF617280,0xFF5F707F,0xFF5F707F,
+   0xFF5F6F7F,0xFF606F7F,0xFF606F80,0xFF606F80,0xFF616F81,0xFF616F81,0xFF616F81,
+   0xFF616F81,0xFF616F81,0xFF616F80,0xFF627282,0xFF687989,0xFF425161,0xFF384756,
+   0xFF5D6F7F,0xFF5F7181,0xFF5F7181,0xFF607081,0xFF607081,0xFF607081,0xFF607081,
+   0xFF607081,0xFF607082,0xFF617082,0xFF637284,0xFF637283,0xFF4B5868,0xFF374353,
+   0xFF445264,0xFF606F80,0xFF637384,0xFF627383,0xFF627283,0xFF607080,0xFF60707F,
+   0xFF475765,0xFF354250,0xFF576775,0xFF596A77,0xFF586A76,0xFF576B75,0xFF566C74,
+   0xFF566D73,0xFF556D73,0xFF556D73,0xFF566D74,0xFF566D74,0xFF576D75,0xFF586D76,
+   0xFF586D77,0xFF586C77,0xFF5D737C,0xFF516670,0xFF2D3E48,0xFF495C67,0xFF5C717B,
+   0xFF5A6F79,0xFF5A6E79,0xFF5A6F78,0xFF5A6F79,0xFF5A6F79,0xFF5B6E7A,0xFF5C6F7B,
+   0xFF5C6F7B,0xFF5C6F7B,0xFF5D707C,0xFF3D4F5B,0xFF202C37,0xFF212D38,0xFF293743,
+   0xFF2C3A46,0xFF30404C,0xFF3A4B57,0xFF455663,0xFF4A5B69,0xFF475866,0xFF3C4A59,
+   0xFF334150,0xFF3E4E5F,0xFF54677A,0xFF5D7186,0xFF5D7186,0xFF5D7186,0xFF5D7186,
+   0xFF5D7187,0xFF5E7287,0xFF586B80,0xFF47586C,0xFF3D4A5D,0xFF505E70,0xFF607081,
+   0xFF647686,0xFF647686,0xFF637483,0xFF607180,0xFF5E707E,0xFF5E707D,0xFF5E717D,
+   0xFF5D717C,0xFF5D727C,0xFF5D727B,0xFF5D727B,0xFF5D727B,0xFF5D727B,0xFF5E717C,
+   0xFF5F717E,0xFF5F717D,0xFF5E717D,0xFF5F717E,0xFF5F717F,0xFF5F717E,0xFF667A85,
+   0xFF4C616A,0xFF384D53,0xFF5A7379,0xFF5B757B,0xFF5B757A,0xFF5A7679,0xFF5A7678,
+   0xFF597778,0xFF597777,0xFF597777,0xFF597777,0xFF5A7878,0xFF5A7878,0xFF597577,
+   0xFF698388,0xFF526970,0xFF32464D,0xFF4A6268,0xFF5E767D,0xFF5F767D,0xFF5E757C,
+   0xFF5C717A,0xFF5D717B,0xFF435460,0xFF2E3D48,0xFF50636E,0xFF586B75,0xFF576A75,
+   0xFF576A75,0xFF586B77,0xFF596A78,0xFF586B77,0xFF586B77,0xFF586B77,0xFF586B77,
+   0xFF586C76,0xFF576E75,0xFF566E74,0xFF556F73,0xFF587475,0xFF456262,0xFF324B4C,
+   0xFF547270,0xFF557470,0xFF547470,0xFF557371,0xFF567372,0xFF577274,0xFF587175,
+   0xFF587076,0xFF597177,0xFF5A7177,0xFF5B7379,0xFF495F67,0xFF293A41,0xFF24343A,
+   0xFF2D3F44,0xFF3E5057,0xFF4F6168,0xFF586C71,0xFF5F7178,0xFF61727B,0xFF62737C,
+   0xFF64737D,0xFF63727D,0xFF596973,0xFF404E59,0xFF354350,0xFF485766,0xFF5A6A79,
+   0xFF5E6F7D,0xFF5D6E7D,0xFF5E6F7E,0xFF5E6F7E,0xFF586979,0xFF465665,0xFF3B4A58,
+   0xFF4F5F6E,0xFF5F7181,0xFF647686,0xFF647685,0xFF637383,0xFF617181,0xFF5F6F7F,
+   0xFF5F6F7E,0xFF5F707E,0xFF5F707E,0xFF5F707F,0xFF5F707F,0xFF5F707F,0xFF606F80,
+   0xFF606F80,0xFF606F80,0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,0xFF616F81,
+   0xFF616F80,0xFF687888,0xFF4F5E6F,0xFF3C4959,0xFF5E6F80,0xFF5F7181,0xFF5F7181,
+   0xFF5F7181,0xFF607081,0xFF607081,0xFF607081,0xFF607081,0xFF607081,0xFF617182,
+   0xFF617182,0xFF5F6F80,0xFF6E7E8F,0xFF566576,0xFF364254,0xFF4F5D6F,0xFF637283,
+   0xFF637283,0xFF617282,0xFF5F6F7E,0xFF5F6F7E,0xFF435461,0xFF2F3D49,0xFF51636F,
+   0xFF586B76,0xFF576B75,0xFF566C74,0xFF566D73,0xFF556D73,0xFF556D73,0xFF556D73,
+   0xFF566D74,0xFF576C75,0xFF576C76,0xFF576D76,0xFF586D76,0xFF576D76,0xFF5A7279,
+   0xFF495F66,0xFF354851,0xFF596E78,0xFF5A6F79,0xFF5A6F78,0xFF5A6F78,0xFF597077,
+   0xFF596F78,0xFF5A6E79,0xFF5B6E79,0xFF5C6F7A,0xFF5C6F7A,0xFF5D717C,0xFF4B5E69,
+   0xFF2B3A46,0xFF273540,0xFF31414C,0xFF42535F,0xFF526571,0xFF5D707C,0xFF647683,
+   0xFF667885,0xFF667986,0xFF677A88,0xFF677988,0xFF5E6F7E,0xFF435161,0xFF374455,
+   0xFF49596C,0xFF5A6D82,0xFF5E7287,0xFF5D7287,0xFF5E7287,0xFF5E7287,0xFF3B4A5E,
+   0xFF3D4A5D,0xFF5C6B7D,0xFF647486,0xFF617182,0xFF5E6F7F,0xFF5E6F7F,0xFF5F6F7E,
+   0xFF5E6F7E,0xFF5E707E,0xFF5E707D,0xFF5E707D,0xFF5E717C,0xFF5E717C,0xFF5D727C,
+   0xFF5D727B,0xFF5D727C,0xFF5D727C,0xFF5E717C,0xFF5E717D,0xFF5F717D,0xFF5E717C,
+   0xFF5D717C,0xFF5D717C,0xFF5D717C,0xFF617780,0xFF566D75,0xFF384E54,0xFF597278,
+   0xFF5B757B,0xFF5A7579,0xFF5A7678,0xFF597678,0xFF597778,0xFF597777,0xFF597777,
+   0xFF597777,0xFF5A7878,0xFF577473,0xFF5C7879,0xFF607A7E,0xFF678186,0xFF3E555A,
+   0xFF374E54,0xFF556D73,0xFF5E777D,0xFF5C737A,0xFF5B7179,0xFF5B6F79,0xFF3C4E59,
+   0xFF26343E,0xFF3E515B,0xFF546872,0xFF586A76,0xFF586A76,0xFF586A77,0xFF596A78,
+   0xFF586B78,0xFF586B77,0xFF586B77,0xFF586B77,0xFF586B77,0xFF576D76,0xFF576E75,
+   0xFF576F75,0xFF546F72,0xFF334C4E,0xFF445F5F,0xFF567473,0xFF557371,0xFF557371,
+   0xFF557371,0xFF567273,0xFF577175,0xFF587176,0xFF587076,0xFF597177,0xFF5B7278,
+   0xFF52686F,0xFF2E3F46,0xFF2F4046,0xFF44585C,0xFF566B6F,0xFF5E7276,0xFF5D7176,
+   0xFF5B6E74,0xFF5A6B73,0xFF5A6A74,0xFF5A6A73,0xFF5A6A74,0xFF5B6A74,0xFF5F7079,
+   0xFF63747D,0xFF4E5C68,0xFF364350,0xFF3B4957,0xFF4D5D6C,0xFF556675,0xFF536373,
+   0xFF4B5A6B,0xFF3C4A59,0xFF3B4A58,0xFF5A6C7A,0xFF637584,0xFF607181,0xFF5E6F7F,
+   0xFF5E6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF5F707E,
+   0xFF5F707E,0xFF5F707F,0xFF5F707F,0xFF606F7F,0xFF606F80,0xFF606F7F,0xFF606F80,
+   0xFF616F80,0xFF606F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF647484,0xFF59697A,
+   0xFF3D4A5A,0xFF5D6E7E,0xFF5F7181,0xFF5F7181,0xFF5F7181,0xFF5F7181,0xFF607081,
+   0xFF607081,0xFF607081,0xFF607181,0xFF617182,0xFF5E6D7E,0xFF627283,0xFF667586,
+   0xFF6C7C8D,0xFF435061,0xFF3C495B,0xFF5A697A,0xFF627383,0xFF60717F,0xFF5E6F7C,
+   0xFF5C6E7B,0xFF3D4D5A,0xFF273440,0xFF3F515C,0xFF546871,0xFF576C74,0xFF566C73,
+   0xFF566D73,0xFF556D73,0xFF556D73,0xFF566D74,0xFF576C75,0xFF576C76,0xFF576C76,
+   0xFF586D76,0xFF586D77,0xFF596E77,0xFF566D75,0xFF364A52,0xFF475C64,0xFF5B707A,
+   0xFF5A6F79,0xFF5A6F79,0xFF5A6F78,0xFF596F78,0xFF5A6F78,0xFF5A6F79,0xFF5A6F79,
+   0xFF5B6F7A,0xFF5C707B,0xFF536772,0xFF30404B,0xFF32424D,0xFF485B66,0xFF5C6F7B,
+   0xFF637782,0xFF627681,0xFF5F737F,0xFF5E717D,0xFF5E707C,0xFF5E707D,0xFF5D707D,
+   0xFF5E707E,0xFF647584,0xFF687989,0xFF526072,0xFF394557,0xFF3D4A5D,0xFF4E5F73,
+   0xFF55687D,0xFF52657A,0xFF4B5D73,0xFF343F51,0xFF526072,0xFF637183,0xFF606E80,
+   0xFF606E7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7E,0xFF5E707D,0xFF5E707D,
+   0xFF5E707C,0xFF5E707D,0xFF5E707D,0xFF5E717C,0xFF5D717C,0xFF5D717C,0xFF5D717C,
+   0xFF5D717C,0xFF5C717B,0xFF5C707B,0xFF5B707A,0xFF5B707A,0xFF5B7079,0xFF5B707A,
+   0xFF5D737C,0xFF5C747B,0xFF384C53,0xFF566E75,0xFF5B757B,0xFF5A7679,0xFF597678,
+   0xFF597678,0xFF597678,0xFF597778,0xFF597777,0xFF5A7878,0xFF547271,0xFF587675,
+   0xFF5C797A,0xFF5D787B,0xFF657F84,0xFF4E666B,0xFF31474C,0xFF4A6268,0xFF5E767C,
+   0xFF5C7379,0xFF596F76,0xFF4C616A,0xFF32434E,0xFF1B272F,0xFF2A3C44,0xFF3F535C,
+   0xFF52656F,0xFF576A75,0xFF586C77,0xFF586C77,0xFF586C77,0xFF586C77,0xFF596B78,
+   0xFF596B78,0xFF586C77,0xFF586D77,0xFF576D75,0xFF4F666D,0xFF3A5156,0xFF2F4649,
+   0xFF526E6F,0xFF567373,0xFF567372,0xFF557372,0xFF557372,0xFF577274,0xFF587176,
+   0xFF587076,0xFF597076,0xFF5A7178,0xFF576E75,0xFF35484F,0xFF38494F,0xFF56696F,
+   0xFF5D7176,0xFF5A6E72,0xFF586C70,0xFF586C70,0xFF596C71,0xFF5A6B73,0xFF5A6B73,
+   0xFF596B72,0xFF596A72,0xFF596972,0xFF596972,0xFF5C6C75,0xFF63747D,0xFF5A6974,
+   0xFF3F4C59,0xFF33404D,0xFF364353,0xFF354251,0xFF2D3947,0xFF313F4D,0xFF516270,
+   0xFF617381,0xFF5F707E,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,
+   0xFF5E707E,0xFF5E707E,0xFF5E707E,0xFF5E707E,0xFF5E707E,0xFF5F707E,0xFF5F707F,
+   0xFF5F707F,0xFF5F707F,0xFF5F707F,0xFF5E6F7E,0xFF5E6E7D,0xFF5D6E7D,0xFF5D6E7D,
+   0xFF5D6E7D,0xFF5D6E7D,0xFF5F7180,0xFF5F7181,0xFF3B4959,0xFF596B7B,0xFF5F7181,
+   0xFF5F7181,0xFF5F7181,0xFF5F7181,0xFF5F7181,0xFF5F7181,0xFF5F7181,0xFF607182,
+   0xFF5C6B7C,0xFF606E80,0xFF637284,0xFF637283,0xFF6B7A8C,0xFF536272,0xFF354353,
+   0xFF4E5E6E,0xFF617281,0xFF5F707E,0xFF5B6D7A,0xFF4E5F6C,0xFF33424F,0xFF1C2631,
+   0xFF2B3B46,0xFF3F535C,0xFF51666E,0xFF566C73,0xFF576E74,0xFF566E74,0xFF566D74,
+   0xFF576D75,0xFF586C76,0xFF586C77,0xFF586C77,0xFF596D78,0xFF586C77,0xFF516470,
+   0xFF3C5059,0xFF31444D,0xFF556B73,0xFF5A6F78,0xFF5A6F79,0xFF5A6F79,0xFF596F78,
+   0xFF5A6F78,0xFF5A6E79,0xFF5A6F79,0xFF5A6F79,0xFF5B707A,0xFF586D77,0xFF374853,
+   0xFF3B4C57,0xFF5A6D79,0xFF627581,0xFF5F737E,0xFF5D717C,0xFF5D717C,0xFF5D717C,
+   0xFF5D717C,0xFF5D707C,0xFF5E707C,0xFF5D6F7C,0xFF5C6E7C,0xFF5D6E7C,0xFF607180,
+   0xFF69798A,0xFF5F6E80,0xFF424F61,0xFF354152,0xFF364457,0xFF354356,0xFF2E3A4D,
+   0xFF3B4759,0xFF586678,0xFF627082,0xFF616F81,0xFF616F80,0xFF606F7F,0xFF5F6F7F,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF5E707E,0xFF5E707C,0xFF5E707C,0xFF5E707D,0xFF5E707D,
+   0xFF5E707D,0xFF5E717C,0xFF5E717C,0xFF5D717C,0xFF5C717B,0xFF5B707A,0xFF5C6F7A,
+   0xFF5C6F7B,0xFF5B6F7A,0xFF5B707A,0xFF5B707A,0xFF5B717A,0xFF627981,0xFF3E535A,
+   0xFF4B6168,0xFF5C767B,0xFF5A7579,0xFF5A7679,0xFF5A7679,0xFF5A7679,0xFF5A7679,
+   0xFF5A7679,0xFF587576,0xFF526E6F,0xFF5C7A79,0xFF5B7979,0xFF5C787A,0xFF627D80,
+   0xFF526A6F,0xFF2E4248,0xFF3C5158,0xFF4E656C,0xFF4E646C,0xFF435960,0xFF34474F,
+   0xFF202D35,0xFF162129,0xFF1A272F,0xFF283A42,0xFF354951,0xFF40555D,0xFF485D65,
+   0xFF4C6169,0xFF4E636C,0xFF4F646E,0xFF4F626E,0xFF4E606C,0xFF4C606A,0xFF475D65,
+   0xFF3F545C,0xFF33474F,0xFF293C42,0xFF3E575A,0xFF577274,0xFF567273,0xFF567273,
+   0xFF567273,0xFF567273,0xFF587175,0xFF587076,0xFF587076,0xFF597077,0xFF597077,
+   0xFF3D5159,0xFF35474E,0xFF576A70,0xFF5A6E72,0xFF586C71,0xFF586D70,0xFF576D6F,
+   0xFF586C70,0xFF596C71,0xFF596B72,0xFF5A6B72,0xFF596B72,0xFF586A71,0xFF576A70,
+   0xFF586971,0xFF586971,0xFF596A73,0xFF61727A,0xFF61727C,0xFF4C5A66,0xFF364350,
+   0xFF26313E,0xFF1B2430,0xFF364352,0xFF576877,0xFF607180,0xFF60707F,0xFF60707F,
+   0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF5E707E,0xFF5E707E,0xFF5E707E,0xFF5E707E,
+   0xFF5E707E,0xFF5E707D,0xFF5E707E,0xFF5F6F7F,0xFF5F707F,0xFF5F6F7E,0xFF5E6F7D,
+   0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5E6F7D,
+   0xFF657785,0xFF41505F,0xFF4E5E6E,0xFF607282,0xFF5F7181,0xFF5F7181,0xFF5F7181,
+   0xFF5F7181,0xFF5F7180,0xFF5F7181,0xFF5F6F80,0xFF596879,0xFF637284,0xFF637284,
+   0xFF637283,0xFF677888,0xFF566676,0xFF313F4D,0xFF3F4E5D,0xFF516271,0xFF516270,
+   0xFF455664,0xFF364552,0xFF212C37,0xFF17202A,0xFF1B2630,0xFF293944,0xFF364852,
+   0xFF40555D,0xFF485D65,0xFF4B6269,0xFF4D646B,0xFF4F646D,0xFF4F626E,0xFF4E606D,
+   0xFF4D5F6C,0xFF4A5B68,0xFF41525F,0xFF344650,0xFF2A3A45,0xFF41545F,0xFF5A6F78,
+   0xFF5A6F79,0xFF5B6E79,0xFF5A6F79,0xFF596F78,0xFF5A6F79,0xFF5A6F79,0xFF5A6F79,
+   0xFF5A6F79,0xFF5A6F79,0xFF3E515B,0xFF384954,0xFF5B6F7A,0xFF5F737E,0xFF5D707C,
+   0xFF5D717C,0xFF5D717C,0xFF5D717B,0xFF5D717B,0xFF5D717C,0xFF5D717C,0xFF5D707C,
+   0xFF5D6F7B,0xFF5C6F7B,0xFF5D6E7C,0xFF5D6E7D,0xFF5F6E7F,0xFF667687,0xFF677688,
+   0xFF505E70,0xFF384456,0xFF273140,0xFF1A2230,0xFF343F50,0xFF536072,0xFF627082,
+   0xFF616F81,0xFF616F81,0xFF606F80,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5E707E,
+   0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707C,0xFF5D707C,0xFF5C707B,
+   0xFF5B707A,0xFF5B6F79,0xFF5B6F79,0xFF5C6F7B,0xFF5C6F7B,0xFF5C6F7B,0xFF5B6F7A,
+   0xFF5B707A,0xFF5B7079,0xFF617780,0xFF556B74,0xFF3A4D57,0xFF587078,0xFF5B757B,
+   0xFF5B757B,0xFF5B757A,0xFF5B757A,0xFF5B757A,0xFF5B777A,0xFF536F70,0xFF587275,
+   0xFF5D787C,0xFF5D787B,0xFF5E787C,0xFF5D777B,0xFF435B60,0xFF26373F,0xFF293A42,
+   0xFF364A53,0xFF354A51,0xFF2A3D44,0xFF24353B,0xFF213037,0xFF203037,0xFF1F2F36,
+   0xFF203237,0xFF25383E,0xFF2A3F44,0xFF2D4348,0xFF2F444B,0xFF30444C,0xFF30444C,
+   0xFF30424C,0xFF2F3F4B,0xFF2E3E49,0xFF2A3B44,0xFF25343D,0xFF1E2A33,0xFF283A41,
+   0xFF496366,0xFF587375,0xFF567273,0xFF567273,0xFF577274,0xFF577174,0xFF587076,
+   0xFF587076,0xFF597076,0xFF5A7179,0xFF43565F,0xFF32424A,0xFF53656B,0xFF5A6C73,
+   0xFF596B71,0xFF586C70,0xFF586D70,0xFF576D6F,0xFF586D70,0xFF586C70,0xFF596C71,
+   0xFF5A6B72,0xFF596B72,0xFF586A71,0xFF576A70,0xFF586A71,0xFF586971,0xFF596972,
+   0xFF596972,0xFF5F6E78,0xFF677681,0xFF596874,0xFF404F5C,0xFF2A3644,0xFF303D4B,
+   0xFF526271,0xFF607180,0xFF60707F,0xFF60707F,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,
+   0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707D,
+   0xFF5F6F7F,0xFF5E6E7E,0xFF5D6E7C,0xFF5D6D7C,0xFF5D6E7C,0xFF5C6E7C,0xFF5C6E7C,
+   0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7C,0xFF5C6E7C,0xFF637583,0xFF586978,0xFF3D4B5A,
+   0xFF5C6D7D,0xFF5F7181,0xFF5F7181,0xFF5F7181,0xFF5F7181,0xFF5F7181,0xFF617182,
+   0xFF5A687A,0xFF5E6C7E,0xFF637284,0xFF637284,0xFF637384,0xFF617282,0xFF475767,
+   0xFF293543,0xFF2C3846,0xFF394857,0xFF384756,0xFF2E3B48,0xFF27323F,0xFF232E3B,
+   0xFF222E3A,0xFF212E38,0xFF22303A,0xFF273641,0xFF2C3D47,0xFF2F414B,0xFF30434C,
+   0xFF30444C,0xFF31434D,0xFF30414D,0xFF303F4C,0xFF2F3D4A,0xFF2C3A47,0xFF26333F,
+   0xFF1E2A34,0xFF293843,0xFF4D606B,0xFF5C707A,0xFF5A6F79,0xFF5A6F79,0xFF5A6F78,
+   0xFF596F78,0xFF596F78,0xFF5A6F78,0xFF5A6F78,0xFF5B707A,0xFF435761,0xFF34454F,
+   0xFF566A75,0xFF5E727D,0xFF5D717C,0xFF5D707C,0xFF5D717C,0xFF5D717C,0xFF5D717B,
+   0xFF5D717B,0xFF5D717B,0xFF5D717C,0xFF5D717C,0xFF5D6F7B,0xFF5C6F7B,0xFF5D6E7C,
+   0xFF5D6E7D,0xFF5E6D7D,0xFF5E6D7E,0xFF647384,0xFF6C7B8D,0xFF5E6C7F,0xFF424F61,
+   0xFF2C3646,0xFF2B3646,0xFF475365,0xFF627082,0xFF616F80,0xFF617080,0xFF616F80,
+   0xFF606E7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5E707E,0xFF5E707E,0xFF5E707E,0xFF5E707D,
+   0xFF5E707D,0xFF5E707D,0xFF5E707C,0xFF5C6F7B,0xFF5B6E7A,0xFF5B6F79,0xFF5B6F7A,
+   0xFF5B6F7A,0xFF5C6F7B,0xFF5C6F7B,0xFF5C6F7A,0xFF5B707A,0xFF5B7079,0xFF5C717B,
+   0xFF617681,0xFF394B56,0xFF445761,0xFF5B737B,0xFF5C747C,0xFF5B747B,0xFF5C747B,
+   0xFF5C747C,0xFF5B757A,0xFF516B6E,0xFF5E777C,0xFF5F777E,0xFF5E767D,0xFF546C72,
+   0xFF3E555A,0xFF2F444A,0xFF30444B,0xFF394E55,0xFF40565D,0xFF3E555B,0xFF3E565A,
+   0xFF3F585C,0xFF40595D,0xFF415A5E,0xFF415B5E,0xFF40595C,0xFF3C5559,0xFF375054,
+   0xFF344B50,0xFF2F464B,0xFF2B4046,0xFF273840,0xFF22313A,0xFF1E2933,0xFF1A242E,
+   0xFF18222C,0xFF18212B,0xFF18212B,0xFF283941,0xFF476065,0xFF5B7678,0xFF587376,
+   0xFF577175,0xFF577175,0xFF587175,0xFF587076,0xFF597076,0xFF5A7178,0xFF4A5D67,
+   0xFF2D3B46,0xFF4C5C65,0xFF5C6B75,0xFF5B6A74,0xFF596B72,0xFF586D70,0xFF576D6F,
+   0xFF576D6F,0xFF576D6F,0xFF586D70,0xFF586C70,0xFF596C71,0xFF596C71,0xFF586B71,
+   0xFF586A71,0xFF586A71,0xFF586971,0xFF596972,0xFF5A6974,0xFF5C6A75,0xFF5E6C77,
+   0xFF66747F,0xFF62717D,0xFF445462,0xFF2B3946,0xFF455563,0xFF617180,0xFF607080,
+   0xFF60717F,0xFF60707F,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,
+   0xFF5E707E,0xFF5E707D,0xFF5E707D,0xFF5E707E,0xFF5F6F7E,0xFF5E6E7E,0xFF5D6D7C,
+   0xFF5D6D7C,0xFF5C6E7C,0xFF5C6E7C,0xFF5C6E7C,0xFF5C6F7B,0xFF5C6E7C,0xFF5C6F7B,
+   0xFF5C6F7B,0xFF5E707D,0xFF637584,0xFF3B4958,0xFF465565,0xFF5E7080,0xFF5F7181,
+   0xFF5F7180,0xFF5F7181,0xFF607081,0xFF607082,0xFF576577,0xFF637284,0xFF647385,
+   0xFF637284,0xFF586878,0xFF425161,0xFF334050,0xFF334050,0xFF3C4B5A,0xFF445262,
+   0xFF425161,0xFF435261,0xFF445363,0xFF455464,0xFF465665,0xFF465765,0xFF435662,
+   0xFF40525E,0xFF3B4D59,0xFF364954,0xFF31444E,0xFF2C3E48,0xFF283842,0xFF23303B,
+   0xFF1E2934,0xFF1A242F,0xFF19222D,0xFF18212B,0xFF18212B,0xFF293843,0xFF4A5D69,
+   0xFF5E737D,0xFF5B7179,0xFF597078,0xFF596F78,0xFF5A6F78,0xFF597077,0xFF597077,
+   0xFF5B7079,0xFF4A5E67,0xFF2E3E49,0xFF4E626D,0xFF5E727D,0xFF5D717B,0xFF5D717B,
+   0xFF5D717C,0xFF5D717C,0xFF5D717C,0xFF5D717B,0xFF5D717B,0xFF5D717B,0xFF5D717B,
+   0xFF5D717C,0xFF5C707B,0xFF5C6F7B,0xFF5D6E7C,0xFF5D6E7D,0xFF5D6E7D,0xFF5F6E7F,
+   0xFF606F80,0xFF637183,0xFF6B7A8C,0xFF667587,0xFF4A576A,0xFF374355,0xFF394556,
+   0xFF5F6D7F,0xFF617081,0xFF617080,0xFF616F80,0xFF606E80,0xFF5F6F7F,0xFF5F6F7F,
+   0xFF5F6F7F,0xFF5F6F7E,0xFF5F6F7E,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5D6F7C,
+   0xFF5D6E7C,0xFF5C6E7B,0xFF5C6E7B,0xFF5B6E7A,0xFF5B6F7A,0xFF5C6F7B,0xFF5C6F7B,
+   0xFF5C6F7B,0xFF5B6F7A,0xFF5B707A,0xFF5B707A,0xFF637883,0xFF50636F,0xFF32434E,
+   0xFF475B65,0xFF5B727B,0xFF5D747D,0xFF5D757D,0xFF5D757D,0xFF4F656C,0xFF52696F,
+   0xFF5B7379,0xFF536972,0xFF435861,0xFF354951,0xFF374D53,0xFF475E64,0xFF546D73,
+   0xFF5C757B,0xFF5F787D,0xFF5D777B,0xFF5D787B,0xFF5D797B,0xFF5D797A,0xFF5F7C7D,
+   0xFF617E7F,0xFF617E80,0xFF617D80,0xFF607C7F,0xFF5F797E,0xFF5A747A,0xFF536C72,
+   0xFF4A6168,0xFF3E535B,0xFF32454E,0xFF293843,0xFF222E39,0xFF1B2630,0xFF17212A,
+   0xFF24353C,0xFF435B60,0xFF5D767B,0xFF5C757B,0xFF5B7379,0xFF597178,0xFF597077,
+   0xFF5A7078,0xFF5A6F78,0xFF485B65,0xFF2C3A45,0xFF43505C,0xFF5C6976,0xFF5C6976,
+   0xFF5B6A74,0xFF596B72,0xFF586C70,0xFF586D70,0xFF586D70,0xFF576D6F,0xFF586D70,
+   0xFF586C70,0xFF586C70,0xFF596C71,0xFF596B72,0xFF586A72,0xFF596972,0xFF596973,
+   0xFF5A6974,0xFF5C6A75,0xFF5D6A76,0xFF5C6A75,0xFF5D6B75,0xFF63727C,0xFF63727E,
+   0xFF3A4956,0xFF384654,0xFF5E6E7D,0xFF607180,0xFF60717F,0xFF60707F,0xFF5F6F7E,
+   0xFF5F6F7E,0xFF5F6F7E,0xFF5E707E,0xFF5E707E,0xFF5E707E,0xFF5E707D,0xFF5E707D,
+   0xFF5E707E,0xFF5E6F7E,0xFF5D6D7D,0xFF5D6D7C,0xFF5C6E7C,0xFF5C6E7C,0xFF5D6D7C,
+   0xFF5D6E7C,0xFF5C6E7C,0xFF5D6E7C,0xFF5C6F7B,0xFF5C6F7B,0xFF5C6F7B,0xFF657685,
+   0xFF526272,0xFF344151,0xFF495969,0xFF5D6F7E,0xFF607281,0xFF607282,0xFF617282,
+   0xFF536272,0xFF566575,0xFF5F6E80,0xFF576577,0xFF475566,0xFF384556,0xFF3B4959,
+   0xFF4B5A6B,0xFF596879,0xFF617181,0xFF637383,0xFF637282,0xFF637383,0xFF637383,
+   0xFF637383,0xFF657786,0xFF677988,0xFF667987,0xFF667987,0xFF647985,0xFF617782,
+   0xFF5C727D,0xFF556A75,0xFF4C5F6B,0xFF40515E,0xFF344351,0xFF2A3745,0xFF222E3A,
+   0xFF1C2630,0xFF18212B,0xFF26333E,0xFF455964,0xFF5E747E,0xFF5D747C,0xFF5C737A,
+   0xFF5A7178,0xFF5A6F78,0xFF597078,0xFF597077,0xFF485C65,0xFF2D3D47,0xFF445661,
+   0xFF5E707D,0xFF5E707D,0xFF5D717C,0xFF5D717B,0xFF5D717B,0xFF5D717C,0xFF5D717C,
+   0xFF5D717C,0xFF5D717B,0xFF5D717B,0xFF5D717B,0xFF5D717B,0xFF5C717B,0xFF5C6F7B,
+   0xFF5C6E7C,0xFF5D6E7D,0xFF5E6F7E,0xFF606F80,0xFF616F81,0xFF616F81,0xFF616F81,
+   0xFF687789,0xFF6C7B8D,0xFF536274,0xFF313D4E,0xFF505D6E,0xFF627182,0xFF617081,
+   0xFF616F81,0xFF606F80,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7E,0xFF5F6F7E,
+   0xFF5E707E,0xFF5F707E,0xFF5E6F7E,0xFF5D6F7C,0xFF5C6E7B,0xFF5C6D7C,0xFF5D6D7C,
+   0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6F7B,0xFF5C6F7B,0xFF5C6F7B,0xFF5B6F7A,
+   0xFF5B707A,0xFF5E737D,0xFF647985,0xFF435561,0xFF2E3F49,0xFF41545F,0xFF4F656F,
+   0xFF526871,0xFF4B616A,0xFF2C3D45,0xFF384C53,0xFF364B52,0xFF30444C,0xFF384A55,
+   0xFF4F646E,0xFF627981,0xFF647C83,0xFF60787E,0xFF5C747A,0xFF5A7378,0xFF5A7277,
+   0xFF587375,0xFF577374,0xFF577574,0xFF587676,0xFF587576,0xFF587576,0xFF597577,
+   0xFF5A7578,0xFF5C767A,0xFF5F797E,0xFF637C82,0xFF667F85,0xFF667E86,0xFF607680,
+   0xFF526772,0xFF415560,0xFF33454F,0xFF25353E,0xFF202F36,0xFF33474E,0xFF546B72,
+   0xFF5E757E,0xFF5F757E,0xFF5E737D,0xFF5D727C,0xFF5B6F7A,0xFF475965,0xFF2A3843,
+   0xFF3A4753,0xFF5B6975,0xFF5C6A76,0xFF5B6A75,0xFF5A6A73,0xFF596B72,0xFF596B72,
+   0xFF596C71,0xFF586C71,0xFF586C70,0xFF586C70,0xFF586C70,0xFF586C70,0xFF596D71,
+   0xFF5B6D73,0xFF5C6C75,0xFF5C6A75,0xFF5C6A75,0xFF5C6A75,0xFF5C6A75,0xFF5D6A75,
+   0xFF5D6A76,0xFF5D6A75,0xFF5C6B75,0xFF65747E,0xFF53626E,0xFF2F3C49,0xFF4E5E6C,
+   0xFF617280,0xFF60717F,0xFF60707F,0xFF5F707E,0xFF5F6F7E,0xFF5E6F7E,0xFF5E707E,
+   0xFF5E707E,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5D6F7C,0xFF5C6E7C,
+   0xFF5C6E7C,0xFF5C6E7B,0xFF5C6E7C,0xFF5D6D7C,0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7C,
+   0xFF5C6F7B,0xFF5C6F7B,0xFF5C6E7C,0xFF607180,0xFF667787,0xFF445363,0xFF303D4C,
+   0xFF435261,0xFF526372,0xFF546575,0xFF4F5E6F,0xFF2F3A49,0xFF3C4859,0xFF3B4758,
+   0xFF344051,0xFF3B4759,0xFF536172,0xFF657586,0xFF687889,0xFF657485,0xFF617080,
+   0xFF5F6E7E,0xFF5F6E7E,0xFF5F6D7D,0xFF5E6D7D,0xFF5E6E7E,0xFF5E707F,0xFF5E6F7F,
+   0xFF5E707E,0xFF5E707E,0xFF5E717E,0xFF5F737F,0xFF617681,0xFF657A86,0xFF687C89,
+   0xFF697C8A,0xFF627483,0xFF546575,0xFF435462,0xFF344451,0xFF27343F,0xFF212E38,
+   0xFF344651,0xFF556A74,0xFF5F757F,0xFF5F757E,0xFF5D747C,0xFF5D727C,0xFF5B707A,
+   0xFF465B64,0xFF2A3B44,0xFF3B4C57,0xFF5D707D,0xFF5F707E,0xFF5E707E,0xFF5D707C,
+   0xFF5D717B,0xFF5C717B,0xFF5D717B,0xFF5D717B,0xFF5D717B,0xFF5D717B,0xFF5D717B,
+   0xFF5C717B,0xFF5D727B,0xFF5E737D,0xFF5E737D,0xFF5E717D,0xFF5E717E,0xFF60707F,
+   0xFF607080,0xFF616F80,0xFF616F81,0xFF616F81,0xFF617081,0xFF697889,0xFF6C7C8D,
+   0xFF435061,0xFF384455,0xFF5E6D7E,0xFF617081,0xFF617081,0xFF617081,0xFF607080,
+   0xFF5F7080,0xFF5F6F7F,0xFF5F6F7E,0xFF5F6F7E,0xFF5E707E,0xFF5E707E,0xFF5E6F7D,
+   0xFF5D6F7C,0xFF5C6E7B,0xFF5D6D7C,0xFF5D6D7C,0xFF5C6E7B,0xFF5C6E7C,0xFF5D6D7C,
+   0xFF5C6E7C,0xFF5D6E7C,0xFF5D6E7C,0xFF5C6F7B,0xFF5C6F7B,0xFF5C6F7A,0xFF637682,
+   0xFF5B6E7B,0xFF344450,0xFF26343F,0xFF2F3F4A,0xFF31424C,0xFF2B3B45,0xFF1C2830,
+   0xFF213037,0xFF2E4248,0xFF485E66,0xFF5F737E,0xFF627682,0xFF60747F,0xFF5E727D,
+   0xFF5C717A,0xFF5B7179,0xFF5B7278,0xFF5A7278,0xFF597376,0xFF597576,0xFF597576,
+   0xFF597577,0xFF587576,0xFF587576,0xFF587476,0xFF587576,0xFF597576,0xFF5A7578,
+   0xFF5B757A,0xFF5C757B,0xFF5E767D,0xFF627982,0xFF677D87,0xFF677E87,0xFF607780,
+   0xFF51676F,0xFF394D54,0xFF283942,0xFF2F4049,0xFF485C65,0xFF546973,0xFF526671,
+   0xFF50626E,0xFF42535F,0xFF2A3843,0xFF384651,0xFF596772,0xFF5D6C75,0xFF5C6B74,
+   0xFF5B6B74,0xFF5B6B74,0xFF5A6A73,0xFF5A6A73,0xFF5A6B73,0xFF596B72,0xFF586C70,
+   0xFF586C70,0xFF586C71,0xFF596E71,0xFF5A7073,0xFF5D7076,0xFF5E6E77,0xFF5E6D77,
+   0xFF5D6B76,0xFF5D6B75,0xFF5D6B75,0xFF5C6B75,0xFF5C6B75,0xFF5C6B75,0xFF5C6B74,
+   0xFF5E6E76,0xFF66767F,0xFF3F4D58,0xFF364450,0xFF5D6E7C,0xFF607180,0xFF607180,
+   0xFF607180,0xFF607080,0xFF5F707F,0xFF5F707E,0xFF5E707E,0xFF5E707D,0xFF5E707D,
+   0xFF5E707D,0xFF5E707C,0xFF5D6F7B,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7B,0xFF5D6D7C,
+   0xFF5D6D7C,0xFF5C6E7C,0xFF5C6E7C,0xFF5C6F7B,0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7D,
+   0xFF5E6D7D,0xFF657485,0xFF5D6C7E,0xFF354252,0xFF283340,0xFF313E4D,0xFF334050,
+   0xFF2E3949,0xFF1E2634,0xFF242D3C,0xFF323E4E,0xFF4D5A6C,0xFF627082,0xFF657485,
+   0xFF637283,0xFF617081,0xFF5F6E7F,0xFF5F6D7F,0xFF5F6E7F,0xFF5F6E7F,0xFF5F6E7E,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF5F707F,0xFF5E6F7E,0xFF5E6F7E,0xFF5D707D,0xFF5D707D,
+   0xFF5D707D,0xFF5E717D,0xFF5F727E,0xFF5F727F,0xFF607381,0xFF647685,0xFF697B8A,
+   0xFF6A7C8B,0xFF637584,0xFF536672,0xFF3B4B57,0xFF293843,0xFF303F4A,0xFF495B67,
+   0xFF556974,0xFF526771,0xFF4F626D,0xFF41535F,0xFF2B3A44,0xFF394A55,0xFF5B6E7A,
+   0xFF60727F,0xFF5F717F,0xFF5F717E,0xFF5E717D,0xFF5D717B,0xFF5C717B,0xFF5C717B,
+   0xFF5C717B,0xFF5C717B,0xFF5C717B,0xFF5D727B,0xFF5D737C,0xFF5E757E,0xFF60767F,
+   0xFF607680,0xFF60747F,0xFF5F727E,0xFF5F717F,0xFF607180,0xFF607180,0xFF617080,
+   0xFF617081,0xFF617081,0xFF627182,0xFF687788,0xFF5D6C7D,0xFF2F3A4A,0xFF526071,
+   0xFF627182,0xFF617081,0xFF617081,0xFF607181,0xFF607181,0xFF607181,0xFF607180,
+   0xFF5F707F,0xFF5F707F,0xFF5F6F7F,0xFF5D6F7D,0xFF5C6E7B,0xFF5C6E7B,0xFF5D6D7C,
+   0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5C6E7C,0xFF5C6E7C,0xFF5D6E7D,0xFF5E6D7D,
+   0xFF5D6E7C,0xFF5C6F7B,0xFF5C6F7B,0xFF5D6F7C,0xFF637683,0xFF455764,0xFF26323E,
+   0xFF19222D,0xFF1A232D,0xFF18222C,0xFF1A252F,0xFF2F414A,0xFF4E646C,0xFF617680,
+   0xFF5F727E,0xFF5E707D,0xFF5D707C,0xFF5E707D,0xFF5D707C,0xFF5D717C,0xFF5C727A,
+   0xFF5B7378,0xFF5A7477,0xFF5A7478,0xFF5A7478,0xFF5A7578,0xFF587576,0xFF587576,
+   0xFF587476,0xFF587576,0xFF597677,0xFF5A7678,0xFF5B7679,0xFF5B757A,0xFF5C757B,
+   0xFF5D747C,0xFF5D737C,0xFF5E757D,0xFF627A82,0xFF687F88,0xFF677E88,0xFF566975,
+   0xFF3A4B56,0xFF2A3943,0xFF2F404A,0xFF31424C,0xFF2D3D48,0xFF283641,0xFF36444F,
+   0xFF576670,0xFF5D6D76,0xFF5C6B74,0xFF5C6B74,0xFF5C6B74,0xFF5C6B74,0xFF5B6B74,
+   0xFF5B6A74,0xFF5A6A73,0xFF596B72,0xFF596C71,0xFF596E71,0xFF5A6F73,0xFF5B7074,
+   0xFF5C7075,0xFF5D6F76,0xFF5E6F77,0xFF5E6D77,0xFF5D6C77,0xFF5D6B76,0xFF5D6B76,
+   0xFF5D6B75,0xFF5D6B75,0xFF5C6B75,0xFF5C6C74,0xFF5C6B74,0xFF62717B,0xFF586772,
+   0xFF2C3943,0xFF4F606B,0xFF617280,0xFF617081,0xFF617081,0xFF607181,0xFF607180,
+   0xFF607180,0xFF5F7180,0xFF5F717F,0xFF5E717E,0xFF5E707D,0xFF5D6F7C,0xFF5C6E7A,
+   0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7B,0xFF5D6D7C,0xFF5D6D7D,
+   0xFF5D6E7C,0xFF5D6E7D,0xFF5D6E7D,0xFF5E6D7D,0xFF5E6D7D,0xFF5F6E7E,0xFF657486,
+   0xFF465566,0xFF273140,0xFF1A212E,0xFF1B222F,0xFF19212E,0xFF1C2431,0xFF323E4F,
+   0xFF526071,0xFF647384,0xFF607080,0xFF5F6F7E,0xFF5F6F7F,0xFF5F6F7E,0xFF5F6F7E,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF606E7F,0xFF5F6F7F,0xFF5F7080,0xFF5F7080,0xFF5F707F,
+   0xFF5D707E,0xFF5D707D,0xFF5D707D,0xFF5D707D,0xFF5E717E,0xFF5F727F,0xFF5F727F,
+   0xFF5F727F,0xFF5F7280,0xFF5F7180,0xFF607180,0xFF617382,0xFF657786,0xFF6A7D8B,
+   0xFF697D89,0xFF576976,0xFF3A4A57,0xFF2A3844,0xFF30404B,0xFF31424C,0xFF2E3D48,
+   0xFF293743,0xFF384854,0xFF5A6C79,0xFF60737F,0xFF5F717E,0xFF5F717E,0xFF5F717E,
+   0xFF5E717D,0xFF5E727C,0xFF5D727B,0xFF5C727A,0xFF5C727A,0xFF5C727B,0xFF5D737C,
+   0xFF5E757E,0xFF5F767E,0xFF5F777E,0xFF60767F,0xFF60767F,0xFF60757F,0xFF5F737E,
+   0xFF5F717F,0xFF60717F,0xFF607180,0xFF607180,0xFF617081,0xFF617081,0xFF617081,
+   0xFF627182,0xFF687789,0xFF394555,0xFF404C5C,0xFF617081,0xFF617081,0xFF607181,
+   0xFF607181,0xFF607181,0xFF607180,0xFF607180,0xFF607180,0xFF607181,0xFF607180,
+   0xFF5E707E,0xFF5D6F7C,0xFF5C6E7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7D,0xFF5D6D7D,
+   0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7D,0xFF5E6D7D,0xFF5D6E7D,0xFF5D6E7C,0xFF5C6E7B,
+   0xFF5B6C7A,0xFF617280,0xFF586A77,0xFF32424E,0xFF1B242F,0xFF18212B,0xFF18212B,
+   0xFF24303B,0xFF3F515D,0xFF5D6F7C,0xFF5F707E,0xFF5F6F7E,0xFF5F6F7E,0xFF5E707E,
+   0xFF5E707E,0xFF5E707E,0xFF5E717D,0xFF5C737B,0xFF5B7479,0xFF5B7479,0xFF5C747A,
+   0xFF5B7479,0xFF5A7478,0xFF597477,0xFF597477,0xFF587576,0xFF597677,0xFF5A7777,
+   0xFF5A7777,0xFF5A7678,0xFF5C757A,0xFF5C757B,0xFF5C757B,0xFF5C747B,0xFF5D747C,
+   0xFF5D747C,0xFF5E757E,0xFF627782,0xFF6A7D8A,0xFF697D8A,0xFF475A66,0xFF2A3A44,
+   0xFF1B2730,0xFF1A252D,0xFF2D3D45,0xFF4E5F67,0xFF5D6D75,0xFF5B6B73,0xFF5B6B73,
+   0xFF5B6B73,0xFF5C6B74,0xFF5C6B74,0xFF5C6B74,0xFF5C6B74,0xFF5B6B74,0xFF5B6C74,
+   0xFF5B6E74,0xFF5C7074,0xFF5C7075,0xFF5C7075,0xFF5D7076,0xFF5E6F77,0xFF5E6F77,
+   0xFF5E6E78,0xFF5E6C77,0xFF5D6B76,0xFF5D6B76,0xFF5C6B75,0xFF5C6B75,0xFF5C6B75,
+   0xFF5C6B75,0xFF5C6B75,0xFF5E6C77,0xFF63727D,0xFF35424E,0xFF3D4A55,0xFF5F707D,
+   0xFF607181,0xFF607181,0xFF607181,0xFF607180,0xFF607180,0xFF607180,0xFF5F7280,
+   0xFF5F727F,0xFF5F727F,0xFF5E707D,0xFF5D6F7B,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7B,
+   0xFF5C6E7B,0xFF5C6E7C,0xFF5D6D7C,0xFF5C6E7C,0xFF5C6E7B,0xFF5D6E7C,0xFF5D6E7C,
+   0xFF5D6E7D,0xFF5D6D7D,0xFF5C6C7B,0xFF627281,0xFF596979,0xFF334150,0xFF1C2331,
+   0xFF19202C,0xFF19202D,0xFF252E3E,0xFF424F60,0xFF5F6E7F,0xFF5F707F,0xFF5E707D,
+   0xFF5E707D,0xFF5F707F,0xFF5F707E,0xFF5E707D,0xFF5E717E,0xFF5E717E,0xFF5F707F,
+   0xFF5F707F,0xFF607080,0xFF606F80,0xFF5F707F,0xFF5E6F7E,0xFF5D707E,0xFF5D707D,
+   0xFF5E717E,0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF5F727F,
+   0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF607380,0xFF637683,0xFF697D8A,0xFF697D8A,
+   0xFF475A66,0xFF2A3A43,0xFF1B2730,0xFF1A252F,0xFF303F4B,0xFF526470,0xFF617380,
+   0xFF5F717E,0xFF5F717E,0xFF5F717D,0xFF5E717D,0xFF5E727D,0xFF5E727C,0xFF5D737B,
+   0xFF5D737B,0xFF5D747C,0xFF5E757D,0xFF5F767E,0xFF5F767F,0xFF5F767F,0xFF5F777E,
+   0xFF5F777E,0xFF60767F,0xFF607580,0xFF60737F,0xFF5F727F,0xFF60717F,0xFF607180,
+   0xFF617080,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF697889,0xFF4F5D6E,
+   0xFF354050,0xFF5E6C7D,0xFF617081,0xFF607181,0xFF607181,0xFF607180,0xFF607180,
+   0xFF5F7280,0xFF607180,0xFF607181,0xFF607180,0xFF5F7180,0xFF5E707D,0xFF5C6F7B,
+   0xFF5C6E7B,0xFF5D6D7C,0xFF5D6D7D,0xFF5D6D7D,0xFF5D6D7D,0xFF5D6D7D,0xFF5D6D7D,
+   0xFF5D6E7D,0xFF5D6E7D,0xFF5D6D7C,0xFF5C6C7B,0xFF5B6B79,0xFF5C6D7B,0xFF627482,
+   0xFF40515F,0xFF222D38,0xFF18202B,0xFF1B2430,0xFF313E4E,0xFF4F5F6F,0xFF60707F,
+   0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7F,0xFF5F707F,0xFF5F707F,0xFF5E717E,0xFF5D727D,
+   0xFF5C737B,0xFF5B747A,0xFF5C757A,0xFF5C747B,0xFF5C747A,0xFF5B7479,0xFF5B7479,
+   0xFF5B7579,0xFF5A7678,0xFF5A7678,0xFF5A7778,0xFF5A7777,0xFF5A7778,0xFF5B7579,
+   0xFF5C757A,0xFF5C757B,0xFF5C757B,0xFF5D747C,0xFF5E737D,0xFF5F737E,0xFF60737F,
+   0xFF60737F,0xFF657985,0xFF687C88,0xFF435661,0xFF27363F,0xFF1F2C33,0xFF394B52,
+   0xFF576970,0xFF5B6C73,0xFF5B6C73,0xFF5B6C73,0xFF5B6B73,0xFF5C6B74,0xFF5C6B74,
+   0xFF5C6B74,0xFF5C6B75,0xFF5C6B76,0xFF5C6C75,0xFF5C6E75,0xFF5D6F76,0xFF5D6F76,
+   0xFF5D7076,0xFF5D6F76,0xFF5E6F77,0xFF5E6F77,0xFF5E6E78,0xFF5F6D79,0xFF5E6C78,
+   0xFF5D6B76,0xFF5D6B76,0xFF5D6B76,0xFF5D6B76,0xFF5D6B75,0xFF5D6B76,0xFF5D6B75,
+   0xFF64737E,0xFF4B5966,0xFF323E49,0xFF5B6A77,0xFF607181,0xFF607181,0xFF607181,
+   0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF5F7280,0xFF5F727F,0xFF5F727F,
+   0xFF5E707D,0xFF5C6F7C,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7B,0xFF5C6E7B,
+   0xFF5B6F7A,0xFF5B6F7A,0xFF5C6F7A,0xFF5C6F7B,0xFF5C6E7B,0xFF5C6C7B,0xFF5B6B7A,
+   0xFF5D6D7C,0xFF627383,0xFF415060,0xFF232C3A,0xFF181F2C,0xFF1C2331,0xFF323E4F,
+   0xFF505E70,0xFF607080,0xFF5E707D,0xFF5E707D,0xFF5E707E,0xFF5F707F,0xFF5F707F,
+   0xFF5E717E,0xFF5E717E,0xFF5E717E,0xFF5F717E,0xFF607180,0xFF607180,0xFF607080,
+   0xFF5F7080,0xFF5F7080,0xFF5F7080,0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF5F727E,
+   0xFF5E737E,0xFF5F727E,0xFF5F727E,0xFF5E737E,0xFF5E737E,0xFF5E737E,0xFF5E737E,
+   0xFF5F737F,0xFF5F737F,0xFF5F747F,0xFF657A85,0xFF677D87,0xFF42575F,0xFF26373E,
+   0xFF202D36,0xFF3C4E5A,0xFF5C6E7A,0xFF5F717E,0xFF5F717E,0xFF5E717D,0xFF5E727D,
+   0xFF5E727C,0xFF5E727C,0xFF5D727C,0xFF5D737C,0xFF5D747C,0xFF5D747C,0xFF5E767D,
+   0xFF5F777E,0xFF5F777E,0xFF5F777E,0xFF5F777E,0xFF5F777E,0xFF5F767F,0xFF60767F,
+   0xFF607480,0xFF607380,0xFF607180,0xFF607180,0xFF617080,0xFF617081,0xFF617081,
+   0xFF617081,0xFF617081,0xFF647485,0xFF627283,0xFF344050,0xFF515F6F,0xFF617182,
+   0xFF607181,0xFF607181,0xFF607181,0xFF607180,0xFF5F7280,0xFF607180,0xFF607181,
+   0xFF607181,0xFF607180,0xFF5F717F,0xFF5D707D,0xFF5C6F7B,0xFF5C6E7B,0xFF5D6D7C,
+   0xFF5D6D7C,0xFF5D6D7D,0xFF5D6D7D,0xFF5D6D7D,0xFF5D6D7D,0xFF5D6D7C,0xFF5C6C7B,
+   0xFF5B6B7A,0xFF5B6B7A,0xFF5B6B7A,0xFF627382,0xFF4E5F6E,0xFF2A3745,0xFF19202D,
+   0xFF252E3D,0xFF414E5F,0xFF5D6C7D,0xFF5F6F7F,0xFF5E707E,0xFF5F6F7E,0xFF5F6F7F,
+   0xFF5F707F,0xFF5F707F,0xFF5E717E,0xFF5D727D,0xFF5D737B,0xFF5D747B,0xFF5D747B,
+   0xFF5D747B,0xFF5C747B,0xFF5C757A,0xFF5C757A,0xFF5C757B,0xFF5C757A,0xFF5B7679,
+   0xFF5B7678,0xFF5A7678,0xFF5A7678,0xFF5B7679,0xFF5C757A,0xFF5C757B,0xFF5C747B,
+   0xFF5D747C,0xFF5E737D,0xFF5F737E,0xFF607380,0xFF607380,0xFF607380,0xFF677B87,
+   0xFF627782,0xFF3A4E57,0xFF293A41,0xFF42545A,0xFF5A6C72,0xFF5A6C72,0xFF5A6C72,
+   0xFF5A6C72,0xFF5B6B74,0xFF5C6B74,0xFF5C6B74,0xFF5C6B75,0xFF5C6B75,0xFF5C6C75,
+   0xFF5C6C75,0xFF5C6E76,0xFF5E6F77,0xFF5E6F77,0xFF5E6F77,0xFF5E6F77,0xFF5E6F77,
+   0xFF5E6F77,0xFF5E6E78,0xFF5F6D79,0xFF5F6D79,0xFF5F6C78,0xFF5E6B77,0xFF5D6B76,
+   0xFF5D6B75,0xFF5D6B76,0xFF5D6B76,0xFF5D6B76,0xFF606E79,0xFF5E6C78,0xFF313E4A,
+   0xFF4F5D6B,0xFF617282,0xFF607181,0xFF607181,0xFF607181,0xFF607180,0xFF607180,
+   0xFF607180,0xFF607180,0xFF607181,0xFF607180,0xFF5F717F,0xFF5E707D,0xFF5C6E7B,
+   0xFF5C6E7A,0xFF5C6E7A,0xFF5C6E7A,0xFF5B6F7A,0xFF5B6F7A,0xFF5B6F7A,0xFF5C6E7A,
+   0xFF5B6F79,0xFF5A6D79,0xFF5B6C79,0xFF5B6B7A,0xFF5B6B79,0xFF627382,0xFF4F5F6F,
+   0xFF2B3645,0xFF19202D,0xFF252E3D,0xFF414E60,0xFF5D6C7D,0xFF5F707E,0xFF5E707D,
+   0xFF5E707D,0xFF5E707E,0xFF5F707F,0xFF5F707F,0xFF5E717E,0xFF5E717E,0xFF5F717E,
+   0xFF60717F,0xFF607180,0xFF607180,0xFF607180,0xFF607181,0xFF607181,0xFF607180,
+   0xFF5F727F,0xFF5F727F,0xFF5E727E,0xFF5E737D,0xFF5E737D,0xFF5E737E,0xFF5E737E,
+   0xFF5D737D,0xFF5D747C,0xFF5D747C,0xFF5D747C,0xFF5E747D,0xFF5E747E,0xFF5E747E,
+   0xFF5E757D,0xFF657C84,0xFF617880,0xFF3A4E57,0xFF2C3B46,0xFF465765,0xFF5F717E,
+   0xFF5F717E,0xFF5F717D,0xFF5E727D,0xFF5E727D,0xFF5E727D,0xFF5E727C,0xFF5D737C,
+   0xFF5D747C,0xFF5D747C,0xFF5D747C,0xFF5E767D,0xFF5F777E,0xFF5F777E,0xFF5F777E,
+   0xFF5F777D,0xFF5F777E,0xFF5F777E,0xFF60767F,0xFF607580,0xFF617480,0xFF617281,
+   0xFF607181,0xFF617080,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF627182,
+   0xFF687788,0xFF3F4C5D,0xFF3B4757,0xFF5E6F7F,0xFF607181,0xFF607181,0xFF607181,
+   0xFF607180,0xFF5F7280,0xFF607180,0xFF607181,0xFF607181,0xFF607180,0xFF5F7280,
+   0xFF5F717F,0xFF5E6F7E,0xFF5D6E7C,0xFF5C6E7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,
+   0xFF5D6D7C,0xFF5D6D7D,0xFF5C6C7B,0xFF5B6B7A,0xFF5B6B7A,0xFF5B6B7A,0xFF5B6B7A,
+   0xFF606F7F,0xFF586979,0xFF323F4E,0xFF1C2331,0xFF2F3B4B,0xFF505E6F,0xFF616F80,
+   0xFF5F6F7F,0xFF5F6F7E,0xFF5F6F7F,0xFF5F6F7F,0xFF5F707F,0xFF5F707F,0xFF5E717E,
+   0xFF5E717D,0xFF5E737C,0xFF5D747C,0xFF5D747C,0xFF5D747C,0xFF5D747C,0xFF5C757B,
+   0xFF5C757B,0xFF5D747B,0xFF5C757B,0xFF5C757A,0xFF5C757A,0xFF5B7579,0xFF5A7678,
+   0xFF5A7678,0xFF5C757A,0xFF5C757B,0xFF5C747B,0xFF5D747C,0xFF5E737D,0xFF5F727F,
+   0xFF607281,0xFF617281,0xFF617281,0xFF607380,0xFF687D88,0xFF4E626D,0xFF2F4149,
+   0xFF45585D,0xFF5A6D72,0xFF5A6D72,0xFF5A6C72,0xFF5A6C72,0xFF5B6C73,0xFF5C6B74,
+   0xFF5C6A75,0xFF5C6B76,0xFF5C6C75,0xFF5C6C75,0xFF5C6C75,0xFF5D6E76,0xFF5D6F76,
+   0xFF5E6F77,0xFF5E6F77,0xFF5E6E78,0xFF5F6E78,0xFF5F6E79,0xFF5F6D79,0xFF5F6D79,
+   0xFF606C79,0xFF5F6D79,0xFF5E6C78,0xFF5D6B76,0xFF5D6B76,0xFF5D6B76,0xFF5D6B76,
+   0xFF5D6B76,0xFF5D6C76,0xFF63727D,0xFF3C4956,0xFF3A4755,0xFF5E6F7F,0xFF617181,
+   0xFF607181,0xFF607181,0xFF607181,0xFF607181,0xFF617081,0xFF617082,0xFF617082,
+   0xFF617082,0xFF607181,0xFF5F7180,0xFF5D707D,0xFF5C6E7B,0xFF5C6E7A,0xFF5C6E7A,
+   0xFF5B6F7A,0xFF5B6F7A,0xFF5B6E7A,0xFF5C6E7A,0xFF5B6D79,0xFF5A6C78,0xFF5A6C79,
+   0xFF5B6B7A,0xFF5B6B79,0xFF5F707F,0xFF596879,0xFF333E4F,0xFF1C2331,0xFF2F3B4B,
+   0xFF505E70,0xFF607080,0xFF5E707D,0xFF5E707D,0xFF5E707E,0xFF5E707E,0xFF5F717F,
+   0xFF5F707F,0xFF5F707F,0xFF5F717F,0xFF5F717F,0xFF607181,0xFF607181,0xFF607180,
+   0xFF607180,0xFF607180,0xFF5F7280,0xFF5F727F,0xFF5F727F,0xFF5E737E,0xFF5D737D,
+   0xFF5D747C,0xFF5E737D,0xFF5E737D,0xFF5E737D,0xFF5D747C,0xFF5D747C,0xFF5D747B,
+   0xFF5C747B,0xFF5D747C,0xFF5D757C,0xFF5E757C,0xFF5D757C,0xFF5E757D,0xFF677E87,
+   0xFF4E626D,0xFF32414E,0xFF4A5A69,0xFF60717F,0xFF5F717F,0xFF5F717E,0xFF5E717D,
+   0xFF5E727D,0xFF5E727D,0xFF5E727C,0xFF5D737C,0xFF5D747C,0xFF5D747C,0xFF5D747C,
+   0xFF5E767D,0xFF5F777E,0xFF5F777E,0xFF5F777D,0xFF5E777D,0xFF5F777D,0xFF5F777E,
+   0xFF5F767E,0xFF60757F,0xFF617481,0xFF627382,0xFF617282,0xFF617181,0xFF617081,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF687889,0xFF505E6F,0xFF303C4C,
+   0xFF4E5E6D,0xFF617282,0xFF607181,0xFF607180,0xFF5F727F,0xFF5F727F,0xFF5F727F,
+   0xFF5F7280,0xFF607180,0xFF5F7280,0xFF5F727F,0xFF5F727F,0xFF5F7080,0xFF5E6F7E,
+   0xFF5D6D7D,0xFF5D6D7D,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6D7C,0xFF5D6C7C,0xFF5C6A7B,
+   0xFF5B6B7A,0xFF5B6B7A,0xFF5B6B7A,0xFF5B6B7A,0xFF5E6D7D,0xFF5C6B7C,0xFF364253,
+   0xFF1F2735,0xFF364254,0xFF576576,0xFF606F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,
+   0xFF5F6F7F,0xFF5F7080,0xFF5F707F,0xFF5F717F,0xFF5E717D,0xFF5E737D,0xFF5E737D,
+   0xFF5D737D,0xFF5D747C,0xFF5D737C,0xFF5D747C,0xFF5D747C,0xFF5D747C,0xFF5D747C,
+   0xFF5C747B,0xFF5C747B,0xFF5C757B,0xFF5B7678,0xFF5A7678,0xFF5C757A,0xFF5D747C,
+   0xFF5E737D,0xFF5E737D,0xFF5E737E,0xFF5F7180,0xFF617181,0xFF617282,0xFF617281,
+   0xFF60717F,0xFF637683,0xFF5F737F,0xFF354751,0xFF405259,0xFF5A6D72,0xFF5A6D71,
+   0xFF5A6D72,0xFF5A6C72,0xFF5A6C72,0xFF5C6B74,0xFF5C6B75,0xFF5C6B76,0xFF5C6B76,
+   0xFF5C6B76,0xFF5C6B76,0xFF5D6D76,0xFF5D6F76,0xFF5D6F77,0xFF5E6F77,0xFF5E6F77,
+   0xFF5F6E78,0xFF5F6E79,0xFF606D79,0xFF606C7A,0xFF606C7A,0xFF5F6D79,0xFF5F6D79,
+   0xFF5E6C78,0xFF5E6B77,0xFF5E6A76,0xFF5E6A76,0xFF5D6B76,0xFF5D6B76,0xFF64727E,
+   0xFF4C5A67,0xFF2F3C4A,0xFF4E5E6D,0xFF617182,0xFF617082,0xFF607181,0xFF607181,
+   0xFF607181,0xFF617081,0xFF617082,0xFF617082,0xFF617082,0xFF617082,0xFF607181,
+   0xFF5F7080,0xFF5D6F7D,0xFF5C6E7B,0xFF5B6E7A,0xFF5B6F7A,0xFF5B6F7A,0xFF5B6E7A,
+   0xFF5B6D79,0xFF5A6C78,0xFF5A6C78,0xFF5B6B79,0xFF5B6B7A,0xFF5B6B7A,0xFF5D6E7D,
+   0xFF5C6B7C,0xFF364253,0xFF1F2735,0xFF364254,0xFF576576,0xFF5F6F7F,0xFF5F6F7E,
+   0xFF5F6F7E,0xFF5F6F7E,0xFF5F707E,0xFF5E717F,0xFF5F717F,0xFF5F707F,0xFF607080,
+   0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF607180,0xFF5F7280,0xFF5F727F,
+   0xFF5F727F,0xFF5E737E,0xFF5D737D,0xFF5D747C,0xFF5D747C,0xFF5E737D,0xFF5E737D,
+   0xFF5D747C,0xFF5D747C,0xFF5D747C,0xFF5D747B,0xFF5D747B,0xFF5C747B,0xFF5C757B,
+   0xFF5C767B,0xFF5C767B,0xFF5C757A,0xFF60787F,0xFF5F737E,0xFF374654,0xFF455463,
+   0xFF60717F,0xFF5F717F,0xFF5F717E,0xFF5E717D,0xFF5E727C,0xFF5E727C,0xFF5E737D,
+   0xFF5D747C,0xFF5D747C,0xFF5D747C,0xFF5D747C,0xFF5D767C,0xFF5E777D,0xFF5E787D,
+   0xFF5E777D,0xFF5E777D,0xFF5E777D,0xFF5F777D,0xFF5F767E,0xFF607580,0xFF617481,
+   0xFF627383,0xFF627383,0xFF627282,0xFF617082,0xFF617081,0xFF617081,0xFF617081,
+   0xFF617081,0xFF657586,0xFF5E6D7E,0xFF354252,0xFF3B4957,0xFF5E6F7E,0xFF607180,
+   0xFF5F7280,0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF5F727F,
+   0xFF5F727F,0xFF607180,0xFF5F7180,0xFF5F707F,0xFF5E6F7E,0xFF5D6E7D,0xFF5D6D7C,
+   0xFF5D6D7C,0xFF5D6D7C,0xFF5D6B7C,0xFF5C6A7B,0xFF5B6B7A,0xFF5B6B7A,0xFF5B6B7A,
+   0xFF5B6A7A,0xFF5E6C7D,0xFF5A687A,0xFF344051,0xFF1F2735,0xFF394556,0xFF576577,
+   0xFF5F6E7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F7080,0xFF607080,
+   0xFF5F707F,0xFF5E717E,0xFF5E727E,0xFF5E737E,0xFF5E737E,0xFF5E737D,0xFF5E737D,
+   0xFF5E737E,0xFF5E737E,0xFF5E737E,0xFF5E737D,0xFF5C747B,0xFF5D747B,0xFF5C747B,
+   0xFF5B757A,0xFF5B757A,0xFF5D747B,0xFF5E737D,0xFF5F727F,0xFF5F727F,0xFF5F727F,
+   0xFF607181,0xFF617081,0xFF607181,0xFF607180,0xFF5F707F,0xFF5F717F,0xFF677B87,
+   0xFF445761,0xFF394B52,0xFF586B70,0xFF5A6D72,0xFF5A6D71,0xFF5A6C72,0xFF5B6C73,
+   0xFF5C6B75,0xFF5C6C75,0xFF5C6B76,0xFF5D6B76,0xFF5C6B76,0xFF5C6B76,0xFF5D6D76,
+   0xFF5E6F77,0xFF5E6F77,0xFF5E6F77,0xFF5E6F77,0xFF5E6E78,0xFF5F6E79,0xFF5F6D79,
+   0xFF606C79,0xFF606C7A,0xFF606C79,0xFF606C79,0xFF606C79,0xFF5F6B79,0xFF5E6A78,
+   0xFF5E6A76,0xFF5D6B76,0xFF5D6B76,0xFF626E7B,0xFF5A6775,0xFF334150,0xFF3B4957,
+   0xFF5F6F7E,0xFF617181,0xFF607181,0xFF607180,0xFF607180,0xFF607180,0xFF607181,
+   0xFF617081,0xFF617082,0xFF617082,0xFF617082,0xFF607081,0xFF5F707F,0xFF5D6F7C,
+   0xFF5C6F7A,0xFF5B6F79,0xFF5B6F79,0xFF5A6F79,0xFF5A6D79,0xFF5A6C78,0xFF5B6B79,
+   0xFF5B6B79,0xFF5B6B7A,0xFF5B6B7A,0xFF5D6D7C,0xFF5A6979,0xFF344051,0xFF1F2735,
+   0xFF394556,0xFF576577,0xFF5F6E7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7E,0xFF5F6F7F,
+   0xFF5F707F,0xFF5F707F,0xFF5F7080,0xFF5F7080,0xFF607180,0xFF5F7280,0xFF5F727F,
+   0xFF5F727F,0xFF5F727F,0xFF5F7280,0xFF5F727F,0xFF5F727F,0xFF5E737E,0xFF5E737D,
+   0xFF5E737D,0xFF5E737D,0xFF5E737D,0xFF5D747C,0xFF5D747C,0xFF5D747C,0xFF5D747C,
+   0xFF5D747C,0xFF5D747C,0xFF5C747B,0xFF5C757A,0xFF5B7679,0xFF5A7677,0xFF5A7577,
+   0xFF5B7579,0xFF667C85,0xFF465764,0xFF3D4D5A,0xFF5D6F7C,0xFF5F717F,0xFF5F717E,
+   0xFF5E727D,0xFF5D737C,0xFF5D737C,0xFF5D747C,0xFF5D747C,0xFF5D747C,0xFF5D747B,
+   0xFF5D747B,0xFF5D767C,0xFF5E777D,0xFF5E787D,0xFF5E787D,0xFF5E777D,0xFF5E777D,
+   0xFF5E777D,0xFF5F767F,0xFF617480,0xFF627382,0xFF627382,0xFF627383,0xFF637283,
+   0xFF627183,0xFF617082,0xFF617081,0xFF617081,0xFF617081,0xFF627182,0xFF69788A,
+   0xFF445363,0xFF323F4E,0xFF556574,0xFF617280,0xFF5F727F,0xFF5F727F,0xFF5F727F,
+   0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF5F717F,0xFF5F707E,
+   0xFF5F6F7E,0xFF5F6F7E,0xFF5F6F7E,0xFF5E6E7E,0xFF5D6D7D,0xFF5D6C7D,0xFF5D6C7C,
+   0xFF5C6B7C,0xFF5C6A7B,0xFF5B6A7A,0xFF5C6A7A,0xFF5C6A7B,0xFF5F6D7E,0xFF515F70,
+   0xFF2E394A,0xFF1C2432,0xFF364253,0xFF546273,0xFF5F6D7F,0xFF606E80,0xFF606E7F,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F80,0xFF5F7080,0xFF5F7080,0xFF5F717F,0xFF5F727F,
+   0xFF5F727F,0xFF5E727E,0xFF5E737E,0xFF5E737E,0xFF5F727E,0xFF5F727F,0xFF5F727F,
+   0xFF5E737D,0xFF5D747C,0xFF5D747C,0xFF5D747C,0xFF5C757B,0xFF5C747B,0xFF5D737C,
+   0xFF5E717D,0xFF5F727F,0xFF5F727F,0xFF607180,0xFF617081,0xFF617082,0xFF607080,
+   0xFF5F707F,0xFF5F707F,0xFF5F707E,0xFF657884,0xFF556A74,0xFF35464E,0xFF52666A,
+   0xFF5A6D72,0xFF5A6D71,0xFF5A6D72,0xFF5B6C73,0xFF5B6C75,0xFF5C6C75,0xFF5C6B76,
+   0xFF5D6B77,0xFF5D6B76,0xFF5C6C76,0xFF5D6D76,0xFF5E6F77,0xFF5E6F77,0xFF5E6F77,
+   0xFF5E6F77,0xFF5E6E78,0xFF5F6E79,0xFF5F6D79,0xFF5F6D79,0xFF5F6D79,0xFF5F6D79,
+   0xFF606C79,0xFF606C79,0xFF606C7A,0xFF5F6B79,0xFF5E6A77,0xFF5E6A77,0xFF5E6A76,
+   0xFF5F6B78,0xFF65727F,0xFF414F5D,0xFF313F4C,0xFF556573,0xFF607280,0xFF5F727F,
+   0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF607180,0xFF607181,0xFF617081,0xFF617082,
+   0xFF616F81,0xFF606F80,0xFF5F6F7F,0xFF5E707D,0xFF5D707C,0xFF5C707A,0xFF5A6F78,
+   0xFF5A6F78,0xFF5B6E7A,0xFF5B6C7A,0xFF5B6B7A,0xFF5B6B7A,0xFF5B6B7A,0xFF5B6B7A,
+   0xFF5E6D7D,0xFF515F70,0xFF2E3949,0xFF1C2432,0xFF364253,0xFF546273,0xFF5F6E7E,
+   0xFF606E7F,0xFF606E7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F707F,0xFF5F707F,0xFF5F707F,
+   0xFF5F7080,0xFF5F717F,0xFF5F727F,0xFF5E727E,0xFF5E737E,0xFF5E727E,0xFF5F727F,
+   0xFF5F727F,0xFF5F727E,0xFF5E737E,0xFF5E737E,0xFF5E737E,0xFF5E737E,0xFF5E737D,
+   0xFF5D737C,0xFF5C737B,0xFF5C737B,0xFF5C747B,0xFF5C747B,0xFF5C747B,0xFF5C757B,
+   0xFF5C757A,0xFF5A7578,0xFF597576,0xFF597576,0xFF5A7477,0xFF627A81,0xFF566A75,
+   0xFF384955,0xFF586976,0xFF60717F,0xFF5F717E,0xFF5E727C,0xFF5D737C,0xFF5D747C,
+   0xFF5D747C,0xFF5D747B,0xFF5C757B,0xFF5C757B,0xFF5C757B,0xFF5D767B,0xFF5E777D,
+   0xFF5E787D,0xFF5E777D,0xFF5F777D,0xFF5F777D,0xFF5F767E,0xFF617580,0xFF627382,
+   0xFF627382,0xFF627383,0xFF627383,0xFF637284,0xFF637284,0xFF627183,0xFF627182,
+   0xFF617081,0xFF617081,0xFF617081,0xFF687788,0xFF5F6E7F,0xFF354353,0xFF43515F,
+   0xFF607180,0xFF60717F,0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF5F727F,
+   0xFF5F727F,0xFF5E717E,0xFF5E707D,0xFF5F6F7E,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,
+   0xFF5E6D7E,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5C6B7C,0xFF5C6A7B,
+   0xFF5C6A7B,0xFF5C6A7B,0xFF5D6C7D,0xFF425061,0xFF252F3E,0xFF1A212F,0xFF323E4F,
+   0xFF505E70,0xFF5F6D7E,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606F80,0xFF5F6F80,0xFF5F707F,0xFF5F717F,0xFF5F727F,0xFF5F727F,0xFF5F727F,
+   0xFF5F727F,0xFF5F727F,0xFF60737F,0xFF60747F,0xFF5E747D,0xFF5E747D,0xFF5E737E,
+   0xFF5D737D,0xFF5C737B,0xFF5C737B,0xFF5D727C,0xFF5D717D,0xFF5E717E,0xFF5F727F,
+   0xFF607180,0xFF617082,0xFF617082,0xFF607080,0xFF5F707F,0xFF5F707F,0xFF5F707E,
+   0xFF627481,0xFF5A6D79,0xFF33444D,0xFF4D5E65,0xFF5A6D73,0xFF5A6C72,0xFF5A6C72,
+   0xFF5B6D73,0xFF5B6C74,0xFF5C6C75,0xFF5C6C75,0xFF5C6C75,0xFF5C6B76,0xFF5D6B76,
+   0xFF5D6D77,0xFF5E6E77,0xFF5E6F77,0xFF5E6F77,0xFF5E6F77,0xFF5F6E78,0xFF5F6E78,
+   0xFF5F6D78,0xFF5F6D79,0xFF5F6D79,0xFF606C7A,0xFF606C7A,0xFF606C79,0xFF606C7A,
+   0xFF606C7A,0xFF5F6B78,0xFF5E6A77,0xFF5E6A77,0xFF5E6A76,0xFF63717D,0xFF5A6975,
+   0xFF32414D,0xFF41515D,0xFF5F727E,0xFF5F727E,0xFF5F727F,0xFF5F727F,0xFF5F727F,
+   0xFF5F727F,0xFF607180,0xFF607081,0xFF606F80,0xFF606E80,0xFF606E80,0xFF606E7F,
+   0xFF5E707E,0xFF5E707D,0xFF5C6F7B,0xFF5A6F79,0xFF5A6E79,0xFF5B6D7B,0xFF5C6D7B,
+   0xFF5B6C7B,0xFF5B6B7A,0xFF5B6B7A,0xFF5B6B7A,0xFF5D6C7C,0xFF424F61,0xFF252F3E,
+   0xFF1A212F,0xFF323E4E,0xFF505F6F,0xFF5E6E7D,0xFF5F6E7F,0xFF5F6F7F,0xFF5F6F7F,
+   0xFF5F6F7E,0xFF5E707E,0xFF5E717D,0xFF5E707E,0xFF5F707F,0xFF5F717F,0xFF5F727E,
+   0xFF5E727E,0xFF5E737E,0xFF5E737D,0xFF5E737D,0xFF5F737E,0xFF5F747E,0xFF5F747E,
+   0xFF5F727F,0xFF5E737E,0xFF5E727D,0xFF5D727D,0xFF5D727C,0xFF5C737B,0xFF5C737A,
+   0xFF5B747A,0xFF5C757B,0xFF5C757B,0xFF5B7579,0xFF5B7678,0xFF597677,0xFF597576,
+   0xFF597576,0xFF597576,0xFF5E787C,0xFF586F77,0xFF354752,0xFF51626F,0xFF5F717E,
+   0xFF5F717E,0xFF5E717D,0xFF5E737D,0xFF5D747C,0xFF5D747B,0xFF5C747B,0xFF5C757B,
+   0xFF5C757A,0xFF5C757A,0xFF5D767B,0xFF5E777C,0xFF5E777D,0xFF5F777D,0xFF5F777E,
+   0xFF5F777E,0xFF607680,0xFF617482,0xFF627382,0xFF627382,0xFF627383,0xFF627383,
+   0xFF637283,0xFF637284,0xFF637284,0xFF627182,0xFF617081,0xFF617081,0xFF617081,
+   0xFF627182,0xFF6B7B8C,0xFF4C5A6B,0xFF303D4C,0xFF4F5F6E,0xFF607180,0xFF607180,
+   0xFF5F7280,0xFF5F727F,0xFF5F727F,0xFF5F717E,0xFF5E707D,0xFF5E707C,0xFF5E707D,
+   0xFF5F6F7E,0xFF5F6F7F,0xFF5F6F7E,0xFF5E6F7E,0xFF5D6E7D,0xFF5D6D7C,0xFF5C6D7C,
+   0xFF5D6C7C,0xFF5D6C7D,0xFF5D6C7D,0xFF5C6B7C,0xFF5C6A7B,0xFF5D6C7D,0xFF566576,
+   0xFF344051,0xFF293343,0xFF232C3B,0xFF2D3848,0xFF4E5B6D,0xFF5E6C7E,0xFF5F6E7F,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF616F81,0xFF617082,0xFF617181,
+   0xFF607180,0xFF607180,0xFF607180,0xFF5F7280,0xFF607180,0xFF5F727F,0xFF5F747E,
+   0xFF5F757E,0xFF5F767D,0xFF5F747E,0xFF5F727E,0xFF5E717D,0xFF5D727C,0xFF5C727C,
+   0xFF5D727D,0xFF5D727D,0xFF5D727D,0xFF5E727E,0xFF5F7280,0xFF617081,0xFF617082,
+   0xFF607080,0xFF5F707F,0xFF5F707F,0xFF5F707F,0xFF627381,0xFF5B6D7B,0xFF33424D,
+   0xFF475660,0xFF5B6C74,0xFF5A6B74,0xFF5A6B73,0xFF5B6C73,0xFF5B6C75,0xFF5C6C75,
+   0xFF5C6C75,0xFF5C6C75,0xFF5C6C75,0xFF5C6B76,0xFF5D6C76,0xFF5E6D78,0xFF5E6E78,
+   0xFF5E6E78,0xFF5E6E78,0xFF5E6E78,0xFF5E6E78,0xFF5F6D79,0xFF5F6D79,0xFF606C79,
+   0xFF606C7A,0xFF606C7A,0xFF606C7A,0xFF606C7A,0xFF5F6B79,0xFF5F6B78,0xFF5E6A77,
+   0xFF5E6A77,0xFF5D6B76,0xFF5D6C76,0xFF66757F,0xFF475662,0xFF2E3D49,0xFF4E606B,
+   0xFF5F727E,0xFF5F727E,0xFF5F727F,0xFF5F727F,0xFF5F727F,0xFF60707F,0xFF5F6F7F,
+   0xFF606E7F,0xFF606E80,0xFF606E80,0xFF606E7F,0xFF5F6F7E,0xFF5E6F7E,0xFF5D6E7C,
+   0xFF5B6E7A,0xFF5B6E7A,0xFF5C6D7C,0xFF5C6D7C,0xFF5C6D7C,0xFF5B6C7B,0xFF5B6B7A,
+   0xFF5D6C7C,0xFF566576,0xFF344051,0xFF293343,0xFF232C3B,0xFF2D3848,0xFF4D5C6C,
+   0xFF5D6E7C,0xFF5E6F7E,0xFF5F6F7E,0xFF5E707E,0xFF5E707D,0xFF5E707C,0xFF5E717D,
+   0xFF5F727E,0xFF5F737E,0xFF5F737E,0xFF5E737E,0xFF5E737D,0xFF5D737D,0xFF5D747C,
+   0xFF5D747C,0xFF5F747E,0xFF60757E,0xFF60757F,0xFF60747F,0xFF5F737E,0xFF5D727C,
+   0xFF5D727D,0xFF5C727C,0xFF5B737A,0xFF5B747A,0xFF5B7479,0xFF5B757A,0xFF5C757A,
+   0xFF5B7679,0xFF5A7777,0xFF597676,0xFF597576,0xFF597576,0xFF5A7577,0xFF5D777B,
+   0xFF587076,0xFF32464F,0xFF495C67,0xFF5F717E,0xFF5E707E,0xFF5E717E,0xFF5E727D,
+   0xFF5D737D,0xFF5C747B,0xFF5C757B,0xFF5C757A,0xFF5B757A,0xFF5B7579,0xFF5C767A,
+   0xFF5D777C,0xFF5E787C,0xFF5E787D,0xFF5F767F,0xFF617580,0xFF617581,0xFF617481,
+   0xFF617480,0xFF617481,0xFF627382,0xFF627383,0xFF627383,0xFF637284,0xFF627183,
+   0xFF627182,0xFF617082,0xFF617081,0xFF617081,0xFF617081,0xFF667687,0xFF5C6C7D,
+   0xFF313E4D,0xFF33404F,0xFF4F5F6F,0xFF607080,0xFF607181,0xFF5F7180,0xFF5E717E,
+   0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707D,
+   0xFF5D6F7D,0xFF5C6E7C,0xFF5C6D7B,0xFF5C6D7C,0xFF5C6D7C,0xFF5D6C7C,0xFF5D6C7C,
+   0xFF5D6C7C,0xFF5D6B7C,0xFF5A697A,0xFF465465,0xFF414E5F,0xFF4C5A6C,0xFF414E60,
+   0xFF313C4D,0xFF414E5F,0xFF5E6D7E,0xFF616F81,0xFF616F81,0xFF606F80,0xFF606F80,
+   0xFF617081,0xFF627182,0xFF637183,0xFF627183,0xFF617282,0xFF617182,0xFF617281,
+   0xFF617281,0xFF617281,0xFF607380,0xFF60757F,0xFF60757E,0xFF60757E,0xFF60747F,
+   0xFF5F727F,0xFF5E717E,0xFF5D717D,0xFF5D727D,0xFF5E717D,0xFF5E717E,0xFF5D717D,
+   0xFF5E717D,0xFF5F727E,0xFF607180,0xFF617081,0xFF607080,0xFF5F707F,0xFF5F707F,
+   0xFF5F707F,0xFF627381,0xFF546674,0xFF31404D,0xFF41515B,0xFF5B6B74,0xFF5B6B75,
+   0xFF5B6B74,0xFF5B6B74,0xFF5C6B74,0xFF5C6A75,0xFF5C6A75,0xFF5C6A75,0xFF5C6A75,
+   0xFF5C6A75,0xFF5D6B76,0xFF5E6D77,0xFF5F6E78,0xFF5E6E78,0xFF5E6E77,0xFF5E6E78,
+   0xFF5E6E78,0xFF5F6D78,0xFF5F6D79,0xFF5F6D79,0xFF606C7A,0xFF606C7A,0xFF5F6B79,
+   0xFF5F6B79,0xFF5F6B79,0xFF5F6B78,0xFF5E6B77,0xFF5D6B76,0xFF5D6B76,0xFF5C6B75,
+   0xFF61707A,0xFF586772,0xFF2F3D49,0xFF31414D,0xFF4E616C,0xFF5F727D,0xFF5F727F,
+   0xFF5F727E,0xFF5E717E,0xFF5E707E,0xFF5F6F7F,0xFF606E7F,0xFF606E80,0xFF5F6F7F,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF5E6F7E,0xFF5D6E7C,0xFF5B6E7A,0xFF5B6E7A,0xFF5C6D7B,
+   0xFF5C6D7B,0xFF5C6D7C,0xFF5C6D7B,0xFF5C6C7B,0xFF5A6A79,0xFF465465,0xFF414E5F,
+   0xFF4C5A6C,0xFF414E60,0xFF313C4D,0xFF414F5E,0xFF5D6E7D,0xFF60707F,0xFF5F707E,
+   0xFF5F717E,0xFF5E717D,0xFF5E727D,0xFF60737E,0xFF60747F,0xFF5F747E,0xFF5F747E,
+   0xFF5F747E,0xFF5E747D,0xFF5E757C,0xFF5E747C,0xFF5F747D,0xFF60757E,0xFF60757F,
+   0xFF60757F,0xFF60747F,0xFF5E737D,0xFF5C737C,0xFF5C727C,0xFF5C737B,0xFF5B737A,
+   0xFF5B7479,0xFF5B7479,0xFF5B7479,0xFF5B757A,0xFF5A7678,0xFF597777,0xFF597676,
+   0xFF597576,0xFF5A7577,0xFF5A7477,0xFF5D777B,0xFF51696F,0xFF30434B,0xFF435660,
+   0xFF5E717D,0xFF5F707E,0xFF5F707E,0xFF5F707E,0xFF5E727D,0xFF5D737B,0xFF5C747A,
+   0xFF5C7479,0xFF5B7479,0xFF5B7478,0xFF5B7679,0xFF5D777B,0xFF5D787C,0xFF5E777D,
+   0xFF5F767E,0xFF617580,0xFF617581,0xFF607580,0xFF607480,0xFF617481,0xFF617382,
+   0xFF617382,0xFF617282,0xFF627183,0xFF627183,0xFF627183,0xFF627182,0xFF617081,
+   0xFF617081,0xFF617081,0xFF637283,0xFF627283,0xFF364354,0xFF252E3E,0xFF354253,
+   0xFF4C5A6B,0xFF5D6B7D,0xFF607080,0xFF5F707F,0xFF5E707E,0xFF5E707D,0xFF5E707D,
+   0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5E707D,0xFF5D6F7C,0xFF5C6E7B,0xFF5B6D7B,
+   0xFF5C6D7C,0xFF5C6D7C,0xFF5C6D7C,0xFF5C6D7C,0xFF5D6D7D,0xFF596778,0xFF4C5B6C,
+   0xFF596779,0xFF637283,0xFF667587,0xFF667587,0xFF505F70,0xFF364253,0xFF4E5C6D,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF627182,0xFF637283,0xFF637283,
+   0xFF627282,0xFF627282,0xFF627282,0xFF617282,0xFF627282,0xFF627382,0xFF627381,
+   0xFF617381,0xFF617480,0xFF617480,0xFF617380,0xFF607280,0xFF5F717F,0xFF5E717E,
+   0xFF5D717D,0xFF5E717E,0xFF5E717E,0xFF5E717D,0xFF5E717D,0xFF5E727E,0xFF607180,
+   0xFF607081,0xFF5F707F,0xFF5F707F,0xFF5F707F,0xFF5F707F,0xFF617381,0xFF465665,
+   0xFF2D3A48,0xFF42505C,0xFF5B6A75,0xFF5C6A75,0xFF5B6B74,0xFF5B6B74,0xFF5C6A75,
+   0xFF5C6A75,0xFF5C6A75,0xFF5C6A75,0xFF5D6A76,0xFF5D6A75,0xFF5D6B76,0xFF5E6C77,
+   0xFF5E6D78,0xFF5E6D78,0xFF5E6E77,0xFF5E6E77,0xFF5E6E77,0xFF5E6D78,0xFF5F6D78,
+   0xFF5E6C78,0xFF5F6C78,0xFF5F6B79,0xFF5F6B79,0xFF5F6B79,0xFF5F6B79,0xFF5F6B78,
+   0xFF5E6B77,0xFF5D6B76,0xFF5D6B76,0xFF5D6B75,0xFF5E6D77,0xFF5D6D78,0xFF34434F,
+   0xFF23303B,0xFF33444F,0xFF495C67,0xFF5A6D79,0xFF5E717D,0xFF5E717C,0xFF5E707D,
+   0xFF5F6F7E,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5E6E7E,
+   0xFF5C6E7C,0xFF5A6E79,0xFF5A6E79,0xFF5B6E7A,0xFF5B6E7A,0xFF5C6D7B,0xFF5C6E7C,
+   0xFF586877,0xFF4C5B6B,0xFF596778,0xFF637283,0xFF667586,0xFF667686,0xFF505F6F,
+   0xFF354352,0xFF4D5D6B,0xFF5F727F,0xFF5F727E,0xFF5F727E,0xFF5F727E,0xFF60737E,
+   0xFF61747F,0xFF61747F,0xFF60757E,0xFF5F757E,0xFF5F747E,0xFF5F757D,0xFF5F757D,
+   0xFF5F757E,0xFF5F757E,0xFF60757E,0xFF60757F,0xFF60757E,0xFF60747E,0xFF5E737D,
+   0xFF5C727C,0xFF5C727C,0xFF5C737B,0xFF5B747A,0xFF5B747A,0xFF5B7479,0xFF5B7479,
+   0xFF5B7579,0xFF5A7678,0xFF597776,0xFF597576,0xFF597576,0xFF5A7577,0xFF5A7478,
+   0xFF5D777B,0xFF425A5F,0xFF2B3D46,0xFF425660,0xFF5D717C,0xFF5E717D,0xFF5F707F,
+   0xFF5F707F,0xFF5F717E,0xFF5E727D,0xFF5D737B,0xFF5C7479,0xFF5B7578,0xFF5B7578,
+   0xFF5B7679,0xFF5C767B,0xFF5E777C,0xFF5F767D,0xFF5F767E,0xFF60757F,0xFF617480,
+   0xFF607480,0xFF617480,0xFF607380,0xFF617381,0xFF617281,0xFF617282,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF617082,0xFF617081,0xFF617081,0xFF637283,
+   0xFF5D6C7E,0xFF344152,0xFF1C2431,0xFF222A39,0xFF2F3A4B,0xFF3D4A5B,0xFF4C596B,
+   0xFF566575,0xFF5C6C7B,0xFF5F707E,0xFF5F717D,0xFF5E707D,0xFF5E707D,0xFF5E707D,
+   0xFF5E707D,0xFF5D6F7C,0xFF5B6E7A,0xFF5B6E7B,0xFF5C6D7C,0xFF5D6E7D,0xFF5C6E7C,
+   0xFF5A6A7A,0xFF536272,0xFF526072,0xFF5C6B7C,0xFF5E6D7E,0xFF5D6C7D,0xFF5F6E7F,
+   0xFF657485,0xFF6D7D8E,0xFF556375,0xFF384456,0xFF505E70,0xFF617081,0xFF617081,
+   0xFF617081,0xFF627182,0xFF637282,0xFF637282,0xFF627382,0xFF627382,0xFF637282,
+   0xFF637282,0xFF627382,0xFF627382,0xFF627382,0xFF627381,0xFF627381,0xFF627381,
+   0xFF617381,0xFF607180,0xFF5F707F,0xFF5E717E,0xFF5D727D,0xFF5E717D,0xFF5E717E,
+   0xFF5E717E,0xFF5E717E,0xFF5E717E,0xFF5F7180,0xFF607081,0xFF606F80,0xFF5F707F,
+   0xFF606F7F,0xFF617081,0xFF5A6A7A,0xFF384756,0xFF283441,0xFF43515D,0xFF5C6976,
+   0xFF5D6976,0xFF5C6A75,0xFF5B6A75,0xFF5D6A75,0xFF5C6A75,0xFF5C6B74,0xFF5C6A75,
+   0xFF5D6A76,0xFF5D6A76,0xFF5E6B76,0xFF5E6C78,0xFF5E6D78,0xFF5E6D78,0xFF5E6E77,
+   0xFF5E6E77,0xFF5E6E77,0xFF5E6E77,0xFF5E6D78,0xFF5E6C78,0xFF5E6C78,0xFF5E6C78,
+   0xFF5F6B78,0xFF5E6C78,0xFF5E6B78,0xFF5F6B78,0xFF5E6C78,0xFF5D6B77,0xFF5D6B76,
+   0xFF5D6B76,0xFF5E6D77,0xFF596873,0xFF32414E,0xFF1B2530,0xFF202C37,0xFF2D3D48,
+   0xFF3A4C58,0xFF495C67,0xFF536772,0xFF5B6D7A,0xFF5F707E,0xFF607080,0xFF5F6F7F,
+   0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5E6E7D,0xFF5C6E7B,0xFF5A6F79,0xFF5B6F7A,
+   0xFF5C6E7B,0xFF5C6E7C,0xFF596B79,0xFF526371,0xFF506170,0xFF5B6C7B,0xFF5D6E7D,
+   0xFF5D6D7C,0xFF5E6F7D,0xFF647583,0xFF6B7E8C,0xFF546473,0xFF374653,0xFF4E606D,
+   0xFF5F717E,0xFF5F717F,0xFF5F727E,0xFF60737F,0xFF60747F,0xFF60757E,0xFF5F757D,
+   0xFF5F767D,0xFF5F767D,0xFF5F767D,0xFF60757F,0xFF60757F,0xFF5F757E,0xFF5F757E,
+   0xFF60757F,0xFF60747F,0xFF5F747E,0xFF5D747C,0xFF5C737B,0xFF5C737B,0xFF5C737B,
+   0xFF5B737A,0xFF5B747A,0xFF5B747A,0xFF5A7479,0xFF5A7578,0xFF5A7677,0xFF597676,
+   0xFF597676,0xFF597576,0xFF5A7477,0xFF5C757A,0xFF566E74,0xFF354A51,0xFF273740,
+   0xFF435761,0xFF5D717C,0xFF5E717D,0xFF5F707F,0xFF60707F,0xFF607080,0xFF5F717E,
+   0xFF5E727C,0xFF5C747A,0xFF5B7479,0xFF5B7479,0xFF5C757A,0xFF5D767C,0xFF5F767D,
+   0xFF5F767E,0xFF5F767E,0xFF60757F,0xFF607580,0xFF607480,0xFF617481,0xFF607380,
+   0xFF607381,0xFF617281,0xFF617282,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627182,0xFF617081,0xFF617081,0xFF647384,0xFF505F70,0xFF2C3747,0xFF19202D,
+   0xFF1B2230,0xFF222B3A,0xFF283343,0xFF2C3848,0xFF313D4E,0xFF394657,0xFF465564,
+   0xFF536572,0xFF5A6C79,0xFF5C6E7A,0xFF5D6F7C,0xFF5D6F7C,0xFF5C6F7B,0xFF5A6C79,
+   0xFF576976,0xFF556674,0xFF506170,0xFF495868,0xFF495868,0xFF576677,0xFF606F81,
+   0xFF5E6D7E,0xFF5D6C7D,0xFF5E6D7E,0xFF5F6E7F,0xFF606F80,0xFF637384,0xFF6D7C8E,
+   0xFF4F5D6E,0xFF384455,0xFF566476,0xFF617081,0xFF617081,0xFF627181,0xFF637282,
+   0xFF637282,0xFF637282,0xFF637282,0xFF637282,0xFF637283,0xFF627382,0xFF627282,
+   0xFF607180,0xFF60717F,0xFF60717F,0xFF60717F,0xFF60717F,0xFF5F707F,0xFF5F707F,
+   0xFF5E717E,0xFF5D727D,0xFF5D717D,0xFF5E717E,0xFF5E717E,0xFF5E717E,0xFF5F707F,
+   0xFF5F7080,0xFF606F80,0xFF606F7F,0xFF606F7F,0xFF60707F,0xFF606F80,0xFF455365,
+   0xFF2D3848,0xFF27313F,0xFF3C4957,0xFF586472,0xFF5D6A77,0xFF5C6A75,0xFF5C6A75,
+   0xFF5C6A75,0xFF5C6B74,0xFF5C6B74,0xFF5C6B74,0xFF5D6A75,0xFF5D6A76,0xFF5E6B76,
+   0xFF5E6D78,0xFF5E6D78,0xFF5E6D78,0xFF5E6D78,0xFF5E6E77,0xFF5E6E77,0xFF5E6D78,
+   0xFF5E6D78,0xFF5E6D78,0xFF5E6C77,0xFF5E6C77,0xFF5E6C78,0xFF5E6C77,0xFF5E6C77,
+   0xFF5F6B78,0xFF5F6B78,0xFF5E6B77,0xFF5D6B76,0xFF5D6B76,0xFF5F6E78,0xFF4C5C67,
+   0xFF2A3844,0xFF19222E,0xFF1B2534,0xFF233040,0xFF283848,0xFF2B3D4A,0xFF2F414D,
+   0xFF374854,0xFF455663,0xFF546473,0xFF5B6B7B,0xFF5D6C7C,0xFF5E6E7E,0xFF5E6E7E,
+   0xFF5D6E7C,0xFF596D78,0xFF566A75,0xFF546772,0xFF4F626E,0xFF485967,0xFF485967,
+   0xFF556775,0xFF5E717E,0xFF5D6E7C,0xFF5C6D7C,0xFF5D6E7D,0xFF5E707D,0xFF5E717D,
+   0xFF627481,0xFF6C7E8C,0xFF4D5E6C,0xFF354652,0xFF536672,0xFF5F737E,0xFF5F727D,
+   0xFF5F747E,0xFF5F757E,0xFF5F767D,0xFF5F767D,0xFF5E767C,0xFF5E767C,0xFF5F757E,
+   0xFF617480,0xFF60747F,0xFF5E737C,0xFF5E737D,0xFF5F727D,0xFF5F727E,0xFF5E727D,
+   0xFF5C737B,0xFF5B747A,0xFF5B737A,0xFF5C737B,0xFF5B737A,0xFF5B747A,0xFF5C737A,
+   0xFF5B747A,0xFF5A7578,0xFF597677,0xFF597676,0xFF597675,0xFF597576,0xFF5B7478,
+   0xFF5B7379,0xFF41575E,0xFF2A3B44,0xFF25343D,0xFF3C4F5A,0xFF586C77,0xFF5F717E,
+   0xFF5F707F,0xFF60707F,0xFF607080,0xFF60707F,0xFF5E727D,0xFF5D737A,0xFF5C7479,
+   0xFF5C747A,0xFF5D757B,0xFF5E767D,0xFF5F767E,0xFF5F767D,0xFF5F767D,0xFF5F767E,
+   0xFF60757F,0xFF607580,0xFF617481,0xFF617481,0xFF607380,0xFF617281,0xFF617282,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF617082,0xFF617081,
+   0xFF627182,0xFF404E5E,0xFF242E3C,0xFF212A39,0xFF2E3A4A,0xFF3D4B5B,0xFF4F5D6F,
+   0xFF586577,0xFF536172,0xFF475465,0xFF364353,0xFF313F4D,0xFF344451,0xFF384955,
+   0xFF3C4D59,0xFF3D4E5B,0xFF3D4D5A,0xFF3A4A58,0xFF384755,0xFF344251,0xFF2F3D4B,
+   0xFF384554,0xFF5C6B7C,0xFF606F80,0xFF5D6C7D,0xFF5D6C7D,0xFF5E6D7E,0xFF5E6D7E,
+   0xFF5E6D7E,0xFF606F80,0xFF617081,0xFF647385,0xFF6A7A8B,0xFF424E60,0xFF445263,
+   0xFF606F80,0xFF617081,0xFF627182,0xFF637283,0xFF637283,0xFF637283,0xFF637283,
+   0xFF637283,0xFF637283,0xFF627282,0xFF627182,0xFF60707F,0xFF5F707F,0xFF5F707E,
+   0xFF5F707E,0xFF5F707E,0xFF5E6F7E,0xFF5D6E7E,0xFF5D6E7D,0xFF5D707D,0xFF5E717D,
+   0xFF5E717E,0xFF5E717E,0xFF5F707F,0xFF5F707F,0xFF5F7080,0xFF606F80,0xFF606F7F,
+   0xFF606F7F,0xFF617181,0xFF4D5B6C,0xFF333F50,0xFF414E5F,0xFF404C5E,0xFF354050,
+   0xFF475362,0xFF54626E,0xFF596873,0xFF5C6B75,0xFF5C6B75,0xFF5C6B74,0xFF5C6B74,
+   0xFF5C6B74,0xFF5C6A75,0xFF5D6A76,0xFF5E6C77,0xFF5F6D78,0xFF5E6D78,0xFF5E6D78,
+   0xFF5E6D78,0xFF5E6E77,0xFF5E6E77,0xFF5E6E77,0xFF5E6D78,0xFF5E6D78,0xFF5D6C77,
+   0xFF5D6C77,0xFF5D6C77,0xFF5E6C77,0xFF5E6C78,0xFF5F6B78,0xFF5F6B79,0xFF5F6B78,
+   0xFF5D6B77,0xFF5D6B76,0xFF5D6C76,0xFF3D4C58,0xFF24303F,0xFF232E41,0xFF2F3E52,
+   0xFF3C4E61,0xFF4C6071,0xFF546878,0xFF506474,0xFF445666,0xFF354555,0xFF324051,
+   0xFF364455,0xFF3A4959,0xFF3D4D5D,0xFF3E4E5D,0xFF3D4E5B,0xFF394C56,0xFF364853,
+   0xFF32434F,0xFF2E3E49,0xFF374752,0xFF5A6D7A,0xFF5E707E,0xFF5B6E7B,0xFF5B6D7B,
+   0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7C,0xFF5E707D,0xFF5F717E,0xFF627582,0xFF687C87,
+   0xFF3E515B,0xFF41555E,0xFF5D727B,0xFF5E747C,0xFF5E747D,0xFF5F767D,0xFF5F767D,
+   0xFF5F767D,0xFF5F767D,0xFF5F767C,0xFF60757E,0xFF617480,0xFF60737F,0xFF5E717D,
+   0xFF5E717D,0xFF5E707E,0xFF5E707E,0xFF5E707D,0xFF5C717B,0xFF5A7178,0xFF5A7178,
+   0xFF5B727A,0xFF5B7379,0xFF5B7479,0xFF5B747A,0xFF5B747A,0xFF5A7578,0xFF597577,
+   0xFF597576,0xFF597576,0xFF5A7577,0xFF5C767A,0xFF495F66,0xFF30434B,0xFF3D515A,
+   0xFF3D505A,0xFF344651,0xFF475A66,0xFF566876,0xFF5D6E7D,0xFF607080,0xFF616F81,
+   0xFF607080,0xFF5E717D,0xFF5D737B,0xFF5C747A,0xFF5C747A,0xFF5E757C,0xFF5F767E,
+   0xFF5F767D,0xFF5E777D,0xFF5E777D,0xFF5F767E,0xFF60757F,0xFF607580,0xFF617481,
+   0xFF617481,0xFF607381,0xFF617281,0xFF617282,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627182,0xFF637283,0xFF586778,0xFF344051,0xFF2C3747,
+   0xFF3B4859,0xFF516070,0xFF637182,0xFF667586,0xFF667486,0xFF677688,0xFF6A798B,
+   0xFF677688,0xFF5A6A79,0xFF4F5F6E,0xFF4A5B69,0xFF445563,0xFF425360,0xFF435362,
+   0xFF415060,0xFF364453,0xFF2A3645,0xFF232E3B,0xFF42505F,0xFF5E6E7D,0xFF5D6C7D,
+   0xFF5D6C7D,0xFF5D6C7D,0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF5F6E7F,0xFF606F80,
+   0xFF617081,0xFF687788,0xFF606F81,0xFF3B4759,0xFF576577,0xFF627182,0xFF627182,
+   0xFF637283,0xFF637283,0xFF637283,0xFF637283,0xFF637283,0xFF637283,0xFF627182,
+   0xFF627182,0xFF606F80,0xFF606F7F,0xFF5F707F,0xFF5F707F,0xFF5F707E,0xFF5D6D7D,
+   0xFF5C6B7B,0xFF5C6A7B,0xFF5C6B7B,0xFF5C6C7B,0xFF5C6E7C,0xFF5D6E7D,0xFF5E6F7E,
+   0xFF5F707F,0xFF606F80,0xFF5F6E7F,0xFF5F6E7F,0xFF5F6E7E,0xFF556374,0xFF354151,
+   0xFF495768,0xFF667687,0xFF69798A,0xFF424E5E,0xFF525E6D,0xFF5C6976,0xFF54636E,
+   0xFF55656E,0xFF5A6973,0xFF5C6B74,0xFF5C6B74,0xFF5C6B74,0xFF5C6A75,0xFF5D6B76,
+   0xFF5E6C77,0xFF5F6D78,0xFF5E6D78,0xFF5F6D78,0xFF5E6D78,0xFF5E6D78,0xFF5E6D78,
+   0xFF5E6E77,0xFF5E6E77,0xFF5E6E77,0xFF5E6D77,0xFF5D6C77,0xFF5D6C77,0xFF5E6C77,
+   0xFF5E6C78,0xFF5E6C78,0xFF5F6B79,0xFF5F6B78,0xFF5E6C77,0xFF5F6D78,0xFF54626E,
+   0xFF334252,0xFF2D3C4F,0xFF3B4C5F,0xFF4F6275,0xFF5F7285,0xFF617687,0xFF607686,
+   0xFF637788,0xFF66798C,0xFF63768A,0xFF586A7D,0xFF4E5F73,0xFF4A5B70,0xFF45556A,
+   0xFF425367,0xFF425465,0xFF3F5261,0xFF344755,0xFF293844,0xFF222F3A,0xFF40525D,
+   0xFF5C6F7B,0xFF5B6E7A,0xFF5B6D7B,0xFF5C6D7B,0xFF5D6E7C,0xFF5D6E7C,0xFF5C6E7C,
+   0xFF5D6F7C,0xFF5E717D,0xFF5F727D,0xFF657A84,0xFF5D727C,0xFF384A55,0xFF546872,
+   0xFF5E747D,0xFF5F747D,0xFF60757E,0xFF5F757E,0xFF5F767D,0xFF5F757E,0xFF5F767D,
+   0xFF60757F,0xFF607380,0xFF607380,0xFF5F707E,0xFF5F707E,0xFF5F707E,0xFF5F707F,
+   0xFF5E707E,0xFF5C6E7B,0xFF596E77,0xFF586E77,0xFF586E77,0xFF596F77,0xFF597177,
+   0xFF5A7278,0xFF5B7379,0xFF5A7478,0xFF597577,0xFF597476,0xFF597476,0xFF597377,
+   0xFF4F686D,0xFF31444C,0xFF465A63,0xFF637983,0xFF667B86,0xFF40525D,0xFF536573,
+   0xFF5E6F7E,0xFF586878,0xFF5A697A,0xFF5F6D7F,0xFF607080,0xFF5F727E,0xFF5D737B,
+   0xFF5C747A,0xFF5C747A,0xFF5E757C,0xFF5F767E,0xFF5F767D,0xFF5E767D,0xFF5F767E,
+   0xFF60757F,0xFF607580,0xFF617481,0xFF627382,0xFF627382,0xFF617382,0xFF617282,
+   0xFF617282,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF435062,0xFF323E50,0xFF465364,0xFF5F6E7F,0xFF657585,0xFF617081,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF627182,0xFF657585,0xFF677787,
+   0xFF677888,0xFF677887,0xFF667786,0xFF667786,0xFF677988,0xFF637383,0xFF506170,
+   0xFF364453,0xFF364352,0xFF556474,0xFF5D6C7D,0xFF5D6C7D,0xFF5E6D7E,0xFF5E6D7E,
+   0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF5F6E7F,0xFF606F80,0xFF627182,0xFF6B7B8C,
+   0xFF4E5B6D,0xFF3E4A5C,0xFF586677,0xFF617081,0xFF637283,0xFF637283,0xFF637283,
+   0xFF637283,0xFF637283,0xFF627183,0xFF627183,0xFF627182,0xFF606F80,0xFF606F80,
+   0xFF606F7F,0xFF5F707F,0xFF5E6E7E,0xFF5C6C7C,0xFF5C6A7B,0xFF5C6A7C,0xFF5C6A7C,
+   0xFF5C6A7B,0xFF5C6A7B,0xFF5C6B7B,0xFF5C6B7B,0xFF5C6C7C,0xFF5E6C7D,0xFF5E6C7D,
+   0xFF5A6878,0xFF4C5A6A,0xFF374354,0xFF333F50,0xFF586778,0xFF5F6E7F,0xFF667586,
+   0xFF556273,0xFF485362,0xFF606D7A,0xFF606F7A,0xFF5B6A75,0xFF56656F,0xFF55646E,
+   0xFF596872,0xFF5C6A75,0xFF5D6A75,0xFF5D6B76,0xFF5E6C77,0xFF5F6D78,0xFF5E6D78,
+   0xFF5F6D78,0xFF5E6D78,0xFF5E6D78,0xFF5E6D78,0xFF5E6D78,0xFF5E6D78,0xFF5E6D78,
+   0xFF5E6D78,0xFF5D6C77,0xFF5D6C77,0xFF5E6C77,0xFF5E6C78,0xFF5E6C78,0xFF5F6B78,
+   0xFF5F6B78,0xFF5F6C78,0xFF5E6C78,0xFF414F5E,0xFF334256,0xFF45566A,0xFF5C6F82,
+   0xFF627588,0xFF5E7184,0xFF5C6F81,0xFF5C6F81,0xFF5C6F82,0xFF5C6F82,0xFF5F7185,
+   0xFF627588,0xFF64768A,0xFF65768C,0xFF65778C,0xFF64768A,0xFF637789,0xFF64798A,
+   0xFF5F7385,0xFF4E6273,0xFF354654,0xFF344450,0xFF536671,0xFF5B6E7A,0xFF5B6E7B,
+   0xFF5D6E7C,0xFF5D6E7D,0xFF5D6E7C,0xFF5C6F7B,0xFF5C6F7B,0xFF5D6F7C,0xFF5E717D,
+   0xFF5F737E,0xFF687D88,0xFF4B5D69,0xFF3C4C59,0xFF556874,0xFF5F727E,0xFF617480,
+   0xFF617480,0xFF60757F,0xFF60757E,0xFF60747F,0xFF607380,0xFF607381,0xFF607281,
+   0xFF5F707F,0xFF5F707F,0xFF606F7F,0xFF606F7F,0xFF5E6E7E,0xFF5C6D7B,0xFF5A6C79,
+   0xFF596D78,0xFF596D78,0xFF596D77,0xFF586D77,0xFF586E76,0xFF586E76,0xFF587076,
+   0xFF587176,0xFF587175,0xFF556C72,0xFF485E65,0xFF33474F,0xFF30424B,0xFF556A73,
+   0xFF5C707B,0xFF637782,0xFF536571,0xFF495968,0xFF637483,0xFF647585,0xFF606F80,
+   0xFF5A697A,0xFF596978,0xFF5C6F7A,0xFF5D727B,0xFF5D737A,0xFF5D747B,0xFF5E767C,
+   0xFF5E777D,0xFF5E777D,0xFF5E767D,0xFF60757F,0xFF617480,0xFF617481,0xFF617481,
+   0xFF627382,0xFF627383,0xFF627383,0xFF617282,0xFF617282,0xFF627183,0xFF627183,
+   0xFF627183,0xFF617082,0xFF617082,0xFF637284,0xFF515F71,0xFF354153,0xFF4D5B6C,
+   0xFF637383,0xFF637282,0xFF616F80,0xFF606E7F,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E7F,0xFF5F6E7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5F6F7F,0xFF5E6E7E,
+   0xFF5E6E7D,0xFF5E6F7E,0xFF627282,0xFF687989,0xFF607080,0xFF3C495A,0xFF3A4757,
+   0xFF566576,0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,
+   0xFF5E6D7E,0xFF5F6E7F,0xFF606F80,0xFF657586,0xFF647485,0xFF394557,0xFF3A4658,
+   0xFF4D5B6E,0xFF5A697B,0xFF617082,0xFF637284,0xFF637284,0xFF637283,0xFF627183,
+   0xFF627183,0xFF627183,0xFF606F80,0xFF606F80,0xFF606F7F,0xFF606E7F,0xFF5E6D7D,
+   0xFF5C6A7B,0xFF5C6A7C,0xFF5C6A7C,0xFF5D6B7D,0xFF5D6B7D,0xFF5D6A7D,0xFF5C6B7C,
+   0xFF5C6B7B,0xFF5A697A,0xFF576577,0xFF4D5A6C,0xFF3E4A5C,0xFF323D4D,0xFF222B3A,
+   0xFF313C4D,0xFF505E70,0xFF5D6B7C,0xFF606E7F,0xFF5C6A7B,0xFF3D4957,0xFF586572,
+   0xFF5C6976,0xFF5E6C78,0xFF616E7A,0xFF5E6B77,0xFF586571,0xFF56636F,0xFF596772,
+   0xFF5D6A76,0xFF5F6D78,0xFF5F6D79,0xFF5F6D78,0xFF5E6D78,0xFF5E6D78,0xFF5E6D78,
+   0xFF5E6D78,0xFF5E6D78,0xFF5E6D78,0xFF5E6D78,0xFF5E6D78,0xFF5D6C77,0xFF5C6B76,
+   0xFF5D6B76,0xFF5D6B77,0xFF5E6B77,0xFF5E6A78,0xFF5E6A78,0xFF606C7A,0xFF4E5A69,
+   0xFF354256,0xFF4C5C71,0xFF607386,0xFF607286,0xFF5E6F84,0xFF5D6E83,0xFF5C6F82,
+   0xFF5C6F82,0xFF5D6E83,0xFF5D6E83,0xFF5D6E83,0xFF5D6E83,0xFF5D6E83,0xFF5D6E83,
+   0xFF5D6E83,0xFF5D6D82,0xFF5C6E81,0xFF5C6F81,0xFF5F7285,0xFF65798B,0xFF5D7183,
+   0xFF3B4B5B,0xFF384955,0xFF546773,0xFF5C6F7B,0xFF5D6E7C,0xFF5D6E7D,0xFF5D6E7D,
+   0xFF5D6E7C,0xFF5D6E7C,0xFF5D6E7C,0xFF5E6F7D,0xFF5E717E,0xFF647683,0xFF637583,
+   0xFF384655,0xFF394856,0xFF4C5C6B,0xFF586A78,0xFF5F727F,0xFF617480,0xFF617481,
+   0xFF617381,0xFF627282,0xFF617282,0xFF617281,0xFF60707F,0xFF606F7F,0xFF606F7F,
+   0xFF606F7F,0xFF5D6D7D,0xFF5B6C7A,0xFF5A6C79,0xFF5A6C79,0xFF5A6D79,0xFF5A6E78,
+   0xFF596E78,0xFF596E77,0xFF586E76,0xFF566C75,0xFF536971,0xFF495E66,0xFF3A4D56,
+   0xFF2F3F49,0xFF202D37,0xFF2F3E4A,0xFF4E606C,0xFF5C6D7A,0xFF5E707D,0xFF5B6B79,
+   0xFF3E4D5C,0xFF5B6A7A,0xFF606F7F,0xFF627183,0xFF657485,0xFF617281,0xFF596D78,
+   0xFF566B74,0xFF596F77,0xFF5C747A,0xFF5E767D,0xFF5E777D,0xFF5F767D,0xFF5F767E,
+   0xFF60757F,0xFF607480,0xFF617481,0xFF617481,0xFF627382,0xFF627383,0xFF627383,
+   0xFF617282,0xFF617081,0xFF617082,0xFF617082,0xFF617082,0xFF606E80,0xFF616F81,
+   0xFF546273,0xFF384556,0xFF4E5C6E,0xFF637283,0xFF627081,0xFF616F80,0xFF606F7F,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E7F,0xFF606E7F,
+   0xFF606E7F,0xFF606E7F,0xFF5F6F7F,0xFF5F6E7E,0xFF5E6E7D,0xFF5D6E7D,0xFF5E6D7D,
+   0xFF5E6E7E,0xFF667686,0xFF647485,0xFF3E4B5C,0xFF394657,0xFF526071,0xFF5E6C7E,
+   0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF5F6E7F,
+   0xFF627182,0xFF627283,0xFF3D495B,0xFF242D3C,0xFF313B4C,0xFF3D495B,0xFF475466,
+   0xFF505E70,0xFF576678,0xFF5B6A7C,0xFF5D6B7D,0xFF606F81,0xFF627183,0xFF617082,
+   0xFF617081,0xFF617081,0xFF606F80,0xFF5D6C7D,0xFF5C6A7C,0xFF5B697A,0xFF576577,
+   0xFF536072,0xFF4F5D6F,0xFF4D5B6C,0xFF4B586A,0xFF465364,0xFF3E4B5C,0xFF374454,
+   0xFF333F50,0xFF354253,0xFF374354,0xFF323E4F,0xFF2F3A4A,0xFF354152,0xFF4F5D6E,
+   0xFF5E6C7D,0xFF5B6A7B,0xFF354050,0xFF4D5967,0xFF5A6674,0xFF596673,0xFF5A6774,
+   0xFF5E6B77,0xFF616E7A,0xFF606C79,0xFF5B6875,0xFF586672,0xFF5A6774,0xFF5D6976,
+   0xFF5E6C78,0xFF5F6D79,0xFF5F6D78,0xFF5E6D78,0xFF5E6D78,0xFF5F6D78,0xFF5E6D78,
+   0xFF5E6D78,0xFF5D6C77,0xFF5C6A75,0xFF5B6975,0xFF5C6975,0xFF5C6976,0xFF5C6976,
+   0xFF5D6877,0xFF5E6978,0xFF515C6B,0xFF384456,0xFF4D5D73,0xFF607287,0xFF5E7085,
+   0xFF5E6F84,0xFF5D6F84,0xFF5D6E84,0xFF5D6E83,0xFF5D6E83,0xFF5D6E83,0xFF5D6E83,
+   0xFF5D6E83,0xFF5D6E83,0xFF5D6E83,0xFF5D6E83,0xFF5D6E83,0xFF5D6E82,0xFF5C6D82,
+   0xFF5B6E81,0xFF5B6D81,0xFF5C6E82,0xFF627589,0xFF617487,0xFF3C4D5D,0xFF384855,
+   0xFF50616F,0xFF5C6D7C,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5D6E7D,
+   0xFF5D6E7D,0xFF5E6F7D,0xFF617281,0xFF617381,0xFF3C4A59,0xFF232E3B,0xFF303C4B,
+   0xFF3C4B59,0xFF455664,0xFF4F606E,0xFF566776,0xFF5A6B7B,0xFF5C6C7D,0xFF606F80,
+   0xFF617182,0xFF617181,0xFF617080,0xFF617080,0xFF5F6F7F,0xFF5C6D7C,0xFF5A6C7A,
+   0xFF596B78,0xFF556774,0xFF50626F,0xFF4D606B,0xFF4A5D68,0xFF485B66,0xFF435560,
+   0xFF3A4C56,0xFF33444D,0xFF2E3F48,0xFF31414B,0xFF32414C,0xFF2F3C47,0xFF2C3945,
+   0xFF33414E,0xFF4E5D6B,0xFF5C6C7B,0xFF5A6A7A,0xFF364353,0xFF505E6F,0xFF5E6C7D,
+   0xFF5D6B7C,0xFF5E6D7E,0xFF617180,0xFF627582,0xFF60757F,0xFF5B7179,0xFF576F75,
+   0xFF597078,0xFF5C727A,0xFF5F747E,0xFF607580,0xFF617581,0xFF617481,0xFF617481,
+   0xFF617482,0xFF627383,0xFF627383,0xFF617282,0xFF607080,0xFF606E7F,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF536173,0xFF394657,0xFF4F5D6E,0xFF637183,
+   0xFF606E80,0xFF606E80,0xFF606F80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF5F6E7F,0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF657586,
+   0xFF5F6F80,0xFF344052,0xFF354152,0xFF4C596B,0xFF5B6A7B,0xFF5F6E7F,0xFF5E6D7E,
+   0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF5F6E7F,0xFF5E6D7E,0xFF485668,0xFF333F50,
+   0xFF303B4C,0xFF323D4E,0xFF313C4D,0xFF2F3A4A,0xFF2D3748,0xFF2F3A4A,0xFF333F50,
+   0xFF374455,0xFF3E4B5D,0xFF465365,0xFF475567,0xFF475567,0xFF485567,0xFF495769,
+   0xFF495769,0xFF465466,0xFF414F61,0xFF3B4759,0xFF354152,0xFF323D4E,0xFF2F3A4A,
+   0xFF2D3849,0xFF2F3B4B,0xFF354152,0xFF435062,0xFF526072,0xFF5C6B7D,0xFF5F6E7F,
+   0xFF5F6D7F,0xFF5B697B,0xFF4C596A,0xFF3D495B,0xFF404C5D,0xFF3E4A5B,0xFF2B3645,
+   0xFF404A5A,0xFF596473,0xFF5A6674,0xFF596673,0xFF596673,0xFF5A6774,0xFF5C6976,
+   0xFF5F6C79,0xFF606D7A,0xFF5F6C79,0xFF5B6775,0xFF505E6B,0xFF54616E,0xFF586672,
+   0xFF5B6974,0xFF5C6B76,0xFF5E6C77,0xFF5E6C77,0xFF5D6B77,0xFF5C6B76,0xFF5C6A76,
+   0xFF5C6A76,0xFF5C6A76,0xFF5D6976,0xFF5D6977,0xFF5D6977,0xFF505D6B,0xFF384556,
+   0xFF4E5D73,0xFF607187,0xFF5D6E84,0xFF5D6E84,0xFF5D6F84,0xFF5D6E84,0xFF5D6E84,
+   0xFF5D6E83,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,
+   0xFF5D6E84,0xFF5D6E84,0xFF5D6E83,0xFF5D6D82,0xFF5C6D82,0xFF5C6D82,0xFF5C6D82,
+   0xFF5C6D82,0xFF627489,0xFF5D6F83,0xFF334252,0xFF344250,0xFF4B5A69,0xFF5A6B7A,
+   0xFF5E6E7E,0xFF5E6E7D,0xFF5E6E7D,0xFF5D6E7D,0xFF5D6E7D,0xFF5E6F7E,0xFF5D6E7D,
+   0xFF475767,0xFF32404F,0xFF2F3C4B,0xFF313E4D,0xFF303D4C,0xFF2E3A49,0xFF2D3847,
+   0xFF2E3A49,0xFF333F4F,0xFF374454,0xFF3E4C5C,0xFF455464,0xFF465566,0xFF465666,
+   0xFF475666,0xFF485868,0xFF475866,0xFF445663,0xFF3F515E,0xFF394957,0xFF33424F,
+   0xFF303F4B,0xFF2D3B47,0xFF2B3843,0xFF2B3944,0xFF313F4A,0xFF3F4D58,0xFF4D5D67,
+   0xFF576671,0xFF5A6974,0xFF5A6974,0xFF576571,0xFF485562,0xFF3A4654,0xFF3D4A57,
+   0xFF3C4958,0xFF2B3645,0xFF424F60,0xFF5C6A7B,0xFF5E6C7D,0xFF5D6B7C,0xFF5C6C7B,
+   0xFF5C6E7A,0xFF5D717B,0xFF5F757D,0xFF60777F,0xFF5F757E,0xFF5B707A,0xFF516570,
+   0xFF556875,0xFF5B6C7B,0xFF5D6F7E,0xFF5F7180,0xFF617281,0xFF617282,0xFF617181,
+   0xFF617081,0xFF616F80,0xFF616F80,0xFF616F81,0xFF616F81,0xFF606E80,0xFF424F61,
+   0xFF364354,0xFF515F71,0xFF637183,0xFF606E80,0xFF606E80,0xFF616F81,0xFF617082,
+   0xFF616F81,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF5F6D7F,
+   0xFF5E6D7E,0xFF5E6D7E,0xFF5E6D7E,0xFF5F6E7F,0xFF667587,0xFF414F61,0xFF273141,
+   0xFF323D4E,0xFF435062,0xFF526072,0xFF5B697B,0xFF5B6A7B,0xFF5A687A,0xFF576576,
+   0xFF4E5C6E,0xFF3F4C5D,0xFF404D5E,0xFF526072,0xFF5C6B7D,0xFF5D6C7E,0xFF586779,
+   0xFF536173,0xFF4D5A6D,0xFF465264,0xFF3B4758,0xFF323D4E,0xFF2A3545,0xFF293343,
+   0xFF293343,0xFF2A3545,0xFF2C3747,0xFF2C3848,0xFF2A3545,0xFF283242,0xFF242E3D,
+   0xFF1F2836,0xFF1E2735,0xFF283342,0xFF2F3A4A,0xFF2F3A4A,0xFF4A586A,0xFF5C6A7D,
+   0xFF637183,0xFF627182,0xFF616F80,0xFF606F80,0xFF616F80,0xFF637283,0xFF677688,
+   0xFF647284,0xFF515E70,0xFF3E4B5D,0xFF2F3A4A,0xFF2E3847,0xFF414C5B,0xFF505B69,
+   0xFF576471,0xFF596673,0xFF5A6673,0xFF5A6674,0xFF5A6674,0xFF5B6774,0xFF5D6876,
+   0xFF616D7B,0xFF606E7B,0xFF55626F,0xFF5C6A76,0xFF5B6975,0xFF576471,0xFF485562,
+   0xFF46535F,0xFF495764,0xFF4B5967,0xFF4A5866,0xFF4A5865,0xFF4B5967,0xFF4B5967,
+   0xFF4A5867,0xFF42505F,0xFF354455,0xFF505F75,0xFF617087,0xFF5E6E84,0xFF5D6E84,
+   0xFF5E6F85,0xFF5F6F86,0xFF5E6F85,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,
+   0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,
+   0xFF5D6E84,0xFF5D6D83,0xFF5C6D83,0xFF5C6D83,0xFF5C6D83,0xFF5D6E83,0xFF63758A,
+   0xFF415165,0xFF263240,0xFF313E4D,0xFF425161,0xFF526171,0xFF5B697A,0xFF5B6A7A,
+   0xFF596979,0xFF566675,0xFF4D5D6D,0xFF3E4C5C,0xFF404D5E,0xFF516171,0xFF5B6C7C,
+   0xFF5D6C7D,0xFF586779,0xFF526173,0xFF4D5A6C,0xFF455263,0xFF3B4758,0xFF323D4D,
+   0xFF2A3544,0xFF283443,0xFF283443,0xFF2A3544,0xFF2B3846,0xFF2B3946,0xFF283643,
+   0xFF263440,0xFF232F3B,0xFF1E2934,0xFF1D2732,0xFF26313D,0xFF2C3843,0xFF2C3843,
+   0xFF455461,0xFF576672,0xFF5E6C78,0xFF5E6B77,0xFF5C6A76,0xFF5C6A76,0xFF5D6A76,
+   0xFF5F6C79,0xFF63717D,0xFF5F6D79,0xFF4D5A67,0xFF3C4756,0xFF2D3745,0xFF2E3848,
+   0xFF435061,0xFF536172,0xFF5A6A79,0xFF5C6D7A,0xFF5B6E79,0xFF5A6E78,0xFF5A6F79,
+   0xFF5B707A,0xFF5D717C,0xFF627681,0xFF617581,0xFF576877,0xFF5F7080,0xFF5F6E7F,
+   0xFF5A6A7A,0xFF4B5A6A,0xFF495867,0xFF4D5B6B,0xFF4D5A6B,0xFF4C5A6B,0xFF4C5A6B,
+   0xFF4E5B6D,0xFF4D5B6D,0xFF4C5A6C,0xFF313D4E,0xFF4D5A6C,0xFF627183,0xFF606E80,
+   0xFF606E80,0xFF616F81,0xFF627082,0xFF627183,0xFF627082,0xFF616F81,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E7F,0xFF5F6D7F,0xFF5F6E7F,0xFF5F6E7F,
+   0xFF5F6E7F,0xFF657486,0xFF475567,0xFF232C3B,0xFF1D2432,0xFF293343,0xFF344051,
+   0xFF3B4759,0xFF3B4759,0xFF394657,0xFF374354,0xFF374355,0xFF4A5769,0xFF637385,
+   0xFF69798B,0xFF687789,0xFF69788A,0xFF6A7A8C,0xFF6B7B8D,0xFF6C7B8E,0xFF6C7C8E,
+   0xFF6A798C,0xFF657486,0xFF59687A,0xFF4B596B,0xFF3E4B5C,0xFF2C3747,0xFF1F2736,
+   0xFF19212E,0xFF19202D,0xFF19202D,0xFF181F2C,0xFF1D2432,0xFF2C3748,0xFF404E60,
+   0xFF576578,0xFF5A687A,0xFF616F81,0xFF5F6D7F,0xFF5E6C7E,0xFF5D6B7D,0xFF5D6B7C,
+   0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF616F80,0xFF677587,0xFF667587,
+   0xFF5B697B,0xFF495668,0xFF3B4758,0xFF364251,0xFF3C4756,0xFF465260,0xFF515D6B,
+   0xFF586372,0xFF5B6675,0xFF5B6675,0xFF5B6675,0xFF5B6774,0xFF5E6B78,0xFF54606D,
+   0xFF3F4B57,0xFF4C5966,0xFF424F5B,0xFF2E3A47,0xFF2D3945,0xFF344250,0xFF394858,
+   0xFF3F4F5E,0xFF435262,0xFF3B495A,0xFF303E4D,0xFF2D3A49,0xFF313E4F,0xFF4C5C71,
+   0xFF607086,0xFF5E6D84,0xFF5E6D84,0xFF5E6E85,0xFF606F86,0xFF607086,0xFF606F86,
+   0xFF5E6F85,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,
+   0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6E84,0xFF5D6D83,
+   0xFF5D6D84,0xFF5D6E84,0xFF5D6E84,0xFF62748A,0xFF46576D,0xFF232D3C,0xFF1C2431,
+   0xFF283342,0xFF344151,0xFF3A4858,0xFF3A4858,0xFF384656,0xFF364453,0xFF364454,
+   0xFF495868,0xFF637384,0xFF68798A,0xFF677888,0xFF69788A,0xFF6A7A8C,0xFF6B7B8D,
+   0xFF6C7B8D,0xFF6C7C8D,0xFF697A8B,0xFF647585,0xFF586979,0xFF4A5A6A,0xFF3D4C5B,
+   0xFF2C3746,0xFF1F2835,0xFF19212D,0xFF18212C,0xFF18212C,0xFF17202B,0xFF1B232E,
+   0xFF2A3542,0xFF3D4B58,0xFF53616E,0xFF566370,0xFF5C6A77,0xFF5B6876,0xFF5A6774,
+   0xFF596673,0xFF596673,0xFF596673,0xFF596573,0xFF596573,0xFF5A6673,0xFF5D6A77,
+   0xFF636F7C,0xFF636F7C,0xFF586372,0xFF475261,0xFF394554,0xFF364353,0xFF3C4B59,
+   0xFF475865,0xFF526470,0xFF596B77,0xFF5B6E7A,0xFF5C6F7A,0xFF5B6F7A,0xFF5C6E7A,
+   0xFF60727F,0xFF566774,0xFF424F5E,0xFF4F5E6E,0xFF455362,0xFF313D4C,0xFF2F3B4B,
+   0xFF364353,0xFF3A4758,0xFF404D5E,0xFF445163,0xFF3C495B,0xFF313D4E,0xFF2D3949,
+   0xFF495668,0xFF606F81,0xFF606E80,0xFF606E80,0xFF606F81,0xFF617082,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627082,0xFF616F81,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E7F,0xFF5F6D7F,0xFF5F6D7E,0xFF5F6D7E,
+   0xFF5F6D7F,0xFF606E80,0xFF606E80,0xFF606E80,0xFF616F81,0xFF566475,0xFF2E3949,
+   0xFF1F2836,0xFF191F2C,0xFF19212E,0xFF212A39,0xFF2F3A4B,0xFF3D495B,0xFF505E70,
+   0xFF586678,0xFF5F6D80,0xFF647285,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF637284,0xFF647385,0xFF667587,0xFF687889,
+   0xFF677789,0xFF667688,0xFF576577,0xFF374455,0xFF232C3B,0xFF19202D,0xFF19202D,
+   0xFF1D2533,0xFF2F3A4B,0xFF455365,0xFF5C6B7D,0xFF5E6C7E,0xFF5D6C7E,0xFF5C6A7C,
+   0xFF5E6C7E,0xFF606F81,0xFF606E80,0xFF5E6C7D,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,
+   0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5F6D7F,0xFF647284,0xFF677587,0xFF657486,
+   0xFF5D6C7D,0xFF4E5B6D,0xFF414E5F,0xFF3A4555,0xFF3B4655,0xFF424C5B,0xFF475261,
+   0xFF485463,0xFF475362,0xFF44505E,0xFF3C4856,0xFF262F3D,0xFF2A3543,0xFF34414F,
+   0xFF455260,0xFF546372,0xFF5F6F80,0xFF647485,0xFF667687,0xFF6A788A,0xFF697889,
+   0xFF465464,0xFF303C4D,0xFF46546A,0xFF5E6E85,0xFF5E6D84,0xFF5E6D84,0xFF5E6E85,
+   0xFF5F6F86,0xFF607087,0xFF607086,0xFF607086,0xFF606F86,0xFF5E6E85,0xFF5D6E84,
+   0xFF5D6E84,0xFF5D6E84,0xFF5E6D84,0xFF5E6D84,0xFF5E6D84,0xFF5D6D84,0xFF5D6D83,
+   0xFF5D6C83,0xFF5D6C83,0xFF5E6C83,0xFF5E6D84,0xFF5E6D84,0xFF5E6D84,0xFF5E6F85,
+   0xFF55647A,0xFF303C52,0xFF20293A,0xFF191F2C,0xFF19202E,0xFF212A38,0xFF2E3B4A,
+   0xFF3C4A5A,0xFF505E6F,0xFF586778,0xFF5E6E7F,0xFF637384,0xFF617182,0xFF617182,
+   0xFF627182,0xFF627183,0xFF627183,0xFF627183,0xFF627282,0xFF627383,0xFF637485,
+   0xFF657686,0xFF677889,0xFF667788,0xFF657687,0xFF566677,0xFF364454,0xFF222D3A,
+   0xFF19212D,0xFF18202C,0xFF1C242F,0xFF2C3845,0xFF424F5D,0xFF586673,0xFF5A6775,
+   0xFF5A6674,0xFF596573,0xFF5B6775,0xFF5D6976,0xFF5C6976,0xFF5B6674,0xFF5A6574,
+   0xFF5A6574,0xFF5A6573,0xFF5A6573,0xFF5A6573,0xFF5A6573,0xFF5C6875,0xFF606D7A,
+   0xFF636F7D,0xFF626E7B,0xFF5A6774,0xFF4A5864,0xFF3F4D59,0xFF384753,0xFF3B4A57,
+   0xFF425260,0xFF485866,0xFF495A68,0xFF495A67,0xFF455664,0xFF3E4D5B,0xFF283340,
+   0xFF2C3948,0xFF374555,0xFF485566,0xFF576576,0xFF606F81,0xFF657385,0xFF677688,
+   0xFF6A788B,0xFF69788A,0xFF465365,0xFF2F3A4B,0xFF5E6C7E,0xFF616F81,0xFF606E80,
+   0xFF606F81,0xFF617082,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627082,0xFF616F81,0xFF606E80,0xFF606E7F,0xFF5F6D7F,0xFF5F6D7E,0xFF5E6C7E,
+   0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5F6D7F,0xFF606E80,0xFF606E80,
+   0xFF5F6D7F,0xFF596778,0xFF4A5667,0xFF3B4656,0xFF222B3A,0xFF19202D,0xFF1F2735,
+   0xFF333F50,0xFF4A586A,0xFF606E80,0xFF657486,0xFF637284,0xFF617082,0xFF606F80,
+   0xFF617081,0xFF617082,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF616F81,0xFF5F6E80,0xFF5E6D7E,0xFF5C6B7C,0xFF5B6A7B,0xFF5C6B7C,0xFF647384,
+   0xFF576577,0xFF354253,0xFF1F2836,0xFF1A222F,0xFF2C3747,0xFF455465,0xFF5D6C7E,
+   0xFF5C6A7C,0xFF5B697C,0xFF5C6A7C,0xFF5C6A7C,0xFF5E6D7F,0xFF606F81,0xFF617082,
+   0xFF606F80,0xFF5E6C7E,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,
+   0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5F6D7E,0xFF627082,0xFF657486,0xFF677687,
+   0xFF627082,0xFF4F5D6F,0xFF384455,0xFF303B4A,0xFF2D3746,0xFF293241,0xFF27313E,
+   0xFF2C3645,0xFF384453,0xFF4C5868,0xFF5D6A7A,0xFF657384,0xFF657385,0xFF637183,
+   0xFF617081,0xFF606F80,0xFF606E80,0xFF677688,0xFF505E70,0xFF3A475D,0xFF5A6980,
+   0xFF5F6E86,0xFF5E6D85,0xFF5E6E85,0xFF5F6F87,0xFF607087,0xFF607087,0xFF607087,
+   0xFF607087,0xFF607087,0xFF606F87,0xFF5F6E86,0xFF5E6D85,0xFF5E6D84,0xFF5E6C84,
+   0xFF5E6C84,0xFF5D6B83,0xFF5D6B83,0xFF5D6B83,0xFF5D6B83,0xFF5D6B83,0xFF5E6C84,
+   0xFF5E6D85,0xFF5E6D85,0xFF5D6C84,0xFF58667E,0xFF4A576E,0xFF3C485F,0xFF242E41,
+   0xFF19202D,0xFF1F2735,0xFF333F50,0xFF4A5869,0xFF606E80,0xFF657486,0xFF637284,
+   0xFF617081,0xFF606F80,0xFF617081,0xFF617082,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF606F81,0xFF5F6E7F,0xFF5E6D7E,0xFF5C6B7C,0xFF5B6A7B,
+   0xFF5C6B7C,0xFF647384,0xFF566577,0xFF354253,0xFF1F2836,0xFF1A212E,0xFF2A3442,
+   0xFF434F5E,0xFF5A6675,0xFF596474,0xFF586473,0xFF596474,0xFF596474,0xFF5B6776,
+   0xFF5D6977,0xFF5E6A78,0xFF5D6977,0xFF5B6675,0xFF5A6574,0xFF5A6574,0xFF5A6574,
+   0xFF5A6574,0xFF5A6574,0xFF5A6574,0xFF5A6574,0xFF5A6574,0xFF5C6775,0xFF5F6A78,
+   0xFF626E7C,0xFF636F7D,0xFF5E6A78,0xFF4D5968,0xFF374352,0xFF303B4B,0xFF2E3949,
+   0xFF2B3645,0xFF293343,0xFF2E3A4A,0xFF3A4758,0xFF4E5C6E,0xFF5E6D7F,0xFF667487,
+   0xFF657385,0xFF637183,0xFF616F81,0xFF606E80,0xFF606E80,0xFF677688,0xFF505E70,
+   0xFF354253,0xFF616F81,0xFF606E80,0xFF606E80,0xFF616F81,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF617082,0xFF606E7F,
+   0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,
+   0xFF5E6C7E,0xFF5F6D7F,0xFF5F6D7F,0xFF5D6B7D,0xFF5E6B7D,0xFF5F6D7F,0xFF667587,
+   0xFF5F6E80,0xFF323E4F,0xFF1C2331,0xFF2C3747,0xFF4B586A,0xFF627083,0xFF606E80,
+   0xFF5F6D7F,0xFF5F6D7F,0xFF606F80,0xFF617081,0xFF617081,0xFF617081,0xFF617081,
+   0xFF627182,0xFF627183,0xFF627183,0xFF627183,0xFF617081,0xFF5F6D7F,0xFF5C6B7C,
+   0xFF5B697B,0xFF5B697A,0xFF5A6879,0xFF5B697A,0xFF647384,0xFF4C5A6C,0xFF2B3646,
+   0xFF202937,0xFF3A4759,0xFF59677A,0xFF5D6B7D,0xFF5A687A,0xFF5C6A7C,0xFF5C6A7C,
+   0xFF5C6B7D,0xFF5E6D7F,0xFF616F81,0xFF617082,0xFF617082,0xFF606F81,0xFF5F6D7E,
+   0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,
+   0xFF5D6B7C,0xFF5D6B7C,0xFF5D6B7C,0xFF5E6C7D,0xFF617081,0xFF687789,0xFF647385,
+   0xFF4C5A6C,0xFF344051,0xFF222B3A,0xFF2D3848,0xFF485567,0xFF5E6C7E,0xFF647284,
+   0xFF627082,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF627082,0xFF424F63,0xFF4B5970,0xFF606F87,0xFF5E6D85,0xFF5E6D85,0xFF5F6E86,
+   0xFF607087,0xFF607087,0xFF607087,0xFF607087,0xFF607087,0xFF607087,0xFF607087,
+   0xFF5F6F87,0xFF5E6D85,0xFF5D6B83,0xFF5D6B83,0xFF5D6B83,0xFF5D6B83,0xFF5D6B83,
+   0xFF5D6B83,0xFF5D6B83,0xFF5D6B84,0xFF5E6C84,0xFF5D6C84,0xFF5C6A82,0xFF5C6B82,
+   0xFF5E6D84,0xFF64738B,0xFF5E6D85,0xFF334056,0xFF1C2433,0xFF2C3747,0xFF4B586A,
+   0xFF627083,0xFF606E81,0xFF5F6D7F,0xFF5F6D7F,0xFF606F80,0xFF617081,0xFF617081,
+   0xFF617081,0xFF617081,0xFF627182,0xFF627183,0xFF627183,0xFF627183,0xFF617081,
+   0xFF5F6D7F,0xFF5C6B7C,0xFF5B697B,0xFF5B697B,0xFF5A6879,0xFF5B697A,0xFF647384,
+   0xFF4C5A6C,0xFF2B3646,0xFF1F2835,0xFF384352,0xFF566271,0xFF5A6575,0xFF576272,
+   0xFF596474,0xFF596474,0xFF596574,0xFF5B6776,0xFF5E6978,0xFF5E6A78,0xFF5E6A78,
+   0xFF5D6977,0xFF5C6776,0xFF5A6574,0xFF5A6574,0xFF5A6574,0xFF5A6574,0xFF5A6574,
+   0xFF5A6574,0xFF5A6574,0xFF5A6574,0xFF5A6574,0xFF5A6574,0xFF5B6675,0xFF5E6A78,
+   0xFF65707F,0xFF616C7C,0xFF495565,0xFF323D4C,0xFF222B39,0xFF2E3949,0xFF485668,
+   0xFF5E6D7F,0xFF647285,0xFF627082,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF627082,0xFF424F60,0xFF485566,0xFF606E80,0xFF606E80,
+   0xFF606F81,0xFF617082,0xFF627183,0xFF627183,0xFF627183,0xFF627183,0xFF627183,
+   0xFF627183,0xFF627183,0xFF627183,0xFF606F80,0xFF5E6C7E,0xFF5E6C7D,0xFF5E6C7D,
+   0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5E6C7D,0xFF5F6D7E,0xFF5D6B7D,0xFF5C6A7C,
+   0xFF5F6D80,0xFF616F81,0xFF616F81,0xFF637183,0xFF5E6C7E,0xFF344151,0xFF1F2836,
+   0xFF364354,0xFF586679,0xFF606E80,0xFF5F6D7F,0xFF5F6D7F,0xFF606E80,0xFF617081,
+   0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617082,0xFF627183,
+   0xFF627183,0xFF606E80,0xFF5D6B7D,0xFF5B697B,0xFF5B697B,0xFF5B697B,0xFF5A6879,
+   0xFF5A6879,0xFF5E6D7E,0xFF5D6C7E,0xFF364253,0xFF26303F,0xFF3F4C5E,0xFF5B6A7C,
+   0xFF59687A,0xFF5A697B,0xFF5C6A7C,0xFF5C6A7C,0xFF5D6B7D,0xFF5F6D7F,0xFF617082,
+   0xFF617082,0xFF617082,0xFF617082,0xFF606F81,0xFF5F6D7F,0xFF5D6B7D,0xFF5D6B7C,
+   0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,0xFF5D6C7D,
+   0xFF5D6C7D,0xFF5D6C7D,0xFF5E6C7E,0xFF647285,0xFF6A798C,0xFF536174,0xFF344051,
+   0xFF3A4658,0xFF5C6A7C,0xFF606F81,0xFF5E6C7E,0xFF5F6D7F,0xFF606E80,0xFF606E80,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF617082,0xFF586678,0xFF3A475C,0xFF58677F,
+   0xFF5E6E86,0xFF5E6D85,0xFF5E6E86,0xFF5F6F87,0xFF607087,0xFF607087,0xFF607087,
+   0xFF607087,0xFF607087,0xFF607087,0xFF607087,0xFF607087,0xFF5E6E85,0xFF5D6B83,
+   0xFF5D6B83,0xFF5D6B83,0xFF5D6B83,0xFF5D6B83,0xFF5D6B83,0xFF5D6B83,0xFF5E6C84,
+   0xFF5C6A82,0xFF5B6981,0xFF5E6D85,0xFF5F6E86,0xFF5F6E86,0xFF607087,0xFF5D6B83,
+   0xFF36435A,0xFF20293A,0xFF364354,0xFF586679,0xFF606E80,0xFF5F6D7F,0xFF5F6D7F,
+   0xFF606E80,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,0xFF617081,
+   0xFF617082,0xFF627183,0xFF627183,0xFF606E80,0xFF5D6B7D,0xFF5B697B,0xFF5B697B,
+   0xFF5B697B,0xFF5A6879,0xFF5A6879,0xFF5E6D7E,0xFF5D6C7E,0xFF364254,0xFF252E3D,
+   0xFF3D4858,0xFF586473,0xFF576271,0xFF586372,0xFF596474,0xFF596474,0xFF5A6575,
+   0xFF5C6776,0xFF5E6A78,0xFF5E6A78,0xFF5E6A78,0xFF5E6A78,0xFF5D6977,0xFF5C6776,
+   0xFF5A6574,0xFF5A6574,0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5A6675,
+   0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5A6675,0xFF5B6675,0xFF616C7B,0xFF677382,
+   0xFF505C6C,0xFF323D4D,0xFF3A4658,0xFF5C6A7C,0xFF606F81,0xFF5E6C7E,0xFF5F6D7F,
+   0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF606E80,0xFF617082,0xFF586678,
+   0xFF3A4758,0xFF596779,
+};
+#endif // OLDSTONE_H_
@@ -0,0 +1,6939 @@
+#ifndef OBJ_H_
+#define OBJ_H_
+#define vertices_count 596
+static const float vertices[][3] = {
+    {-0.130370, 0.265927, 0.489209},
+    {-0.104332, 0.344153, 0.453780},
+    {-0.188143, 0.307190, 0.152513},
+    {-0.131146, 0.388591, 0.162489},
+    {0.130372, 0.265927, 0.489209},
+    {0.104333, 0.344153, 0.453780},
+    {0.188144, 0.307190, 0.152513},
+    {0.131147, 0.388591, 0.162489},
+    {-0.243691, 0.346372, 0.133902},
+    {-0.180047, 0.277640, 0.319767},
+    {0.000001, 0.324976, 0.114528},
+    {0.000001, 0.496334, 0.127686},
+    {0.243692, 0.346372, 0.133902},
+    {0.180049, 0.277640, 0.319767},
+    {0.057949, 0.376879, 0.331929},
+    {0.168863, 0.299834, 0.513638},
+    {0.000001, 0.274670, 0.525006},
+    {0.000001, 0.358750, 0.554339},
+    {-0.057947, 0.376879, 0.331929},
+    {0.000001, 0.350074, 0.072915},
+    {0.226975, 0.319387, 0.323315},
+    {0.000001, 0.310883, 0.573716},
+    {0.000001, 0.299176, 0.317780},
+    {0.000001, 0.394519, 0.330803},
+    {-0.168862, 0.299834, 0.513638},
+    {0.140608, 0.223568, 0.500432},
+    {0.120149, 0.384523, 0.465828},
+    {0.198986, 0.266606, 0.136377},
+    {0.157927, 0.424052, 0.155393},
+    {-0.226973, 0.319387, 0.323315},
+    {0.000001, 0.285221, 0.093446},
+    {0.000001, 0.540575, 0.119456},
+    {0.282686, 0.344434, 0.111528},
+    {0.193922, 0.234890, 0.317526},
+    {0.077843, 0.415285, 0.344349},
+    {0.202726, 0.298988, 0.543263},
+    {0.000001, 0.232652, 0.541115},
+    {0.000001, 0.398764, 0.574928},
+    {-0.140606, 0.223568, 0.500432},
+    {0.000001, 0.341621, 0.028716},
+    {0.270889, 0.324653, 0.331611},
+    {0.000001, 0.315446, 0.618483},
+    {0.000001, 0.254558, 0.311922},
+    {0.000001, 0.435469, 0.349460},
+    {-0.120148, 0.384523, 0.465828},
+    {-0.198985, 0.266606, 0.136377},
+    {-0.157925, 0.424052, 0.155393},
+    {-0.282685, 0.344434, 0.111528},
+    {-0.193921, 0.234890, 0.317526},
+    {-0.077842, 0.415285, 0.344349},
+    {-0.202724, 0.298988, 0.543263},
+    {-0.270887, 0.324653, 0.331611},
+    {0.178328, 0.449548, 0.177566},
+    {0.150055, 0.500390, 0.187622},
+    {0.154450, 0.444203, 0.137456},
+    {0.126178, 0.495046, 0.147512},
+    {0.264913, 0.509470, 0.118037},
+    {0.236641, 0.560312, 0.128093},
+    {0.241036, 0.504125, 0.077927},
+    {0.212762, 0.554968, 0.087983},
+    {0.160000, 0.434738, 0.162932},
+    {0.157321, 0.468989, 0.193512},
+    {0.125531, 0.496723, 0.175191},
+    {0.128210, 0.462473, 0.144612},
+    {0.198224, 0.468008, 0.102195},
+    {0.163756, 0.529991, 0.114455},
+    {0.233770, 0.535526, 0.072038},
+    {0.265559, 0.507793, 0.090357},
+    {0.231091, 0.569777, 0.102617},
+    {0.262880, 0.542042, 0.120938},
+    {0.227335, 0.474524, 0.151095},
+    {0.192866, 0.536507, 0.163355},
+    {0.122857, 0.451952, 0.182750},
+    {0.175499, 0.497771, 0.099102},
+    {0.268234, 0.552563, 0.082799},
+    {0.215591, 0.506744, 0.166448},
+    {0.219280, 0.459575, 0.124332},
+    {0.171809, 0.544940, 0.141216},
+    {-0.178327, 0.449548, 0.177566},
+    {-0.150053, 0.500390, 0.187622},
+    {-0.154448, 0.444203, 0.137456},
+    {-0.126176, 0.495046, 0.147512},
+    {-0.264911, 0.509470, 0.118037},
+    {-0.236639, 0.560312, 0.128093},
+    {-0.241034, 0.504125, 0.077927},
+    {-0.212761, 0.554968, 0.087983},
+    {-0.159998, 0.434738, 0.162932},
+    {-0.157319, 0.468989, 0.193512},
+    {-0.125530, 0.496723, 0.175191},
+    {-0.128209, 0.462473, 0.144612},
+    {-0.198223, 0.468008, 0.102195},
+    {-0.163754, 0.529991, 0.114455},
+    {-0.233768, 0.535526, 0.072038},
+    {-0.265558, 0.507793, 0.090357},
+    {-0.231089, 0.569777, 0.102617},
+    {-0.262879, 0.542042, 0.120938},
+    {-0.227333, 0.474524, 0.151095},
+    {-0.192865, 0.536507, 0.163355},
+    {-0.122855, 0.451952, 0.182750},
+    {-0.175498, 0.497771, 0.099102},
+    {-0.268232, 0.552563, 0.082800},
+    {-0.215590, 0.506744, 0.166448},
+    {-0.219280, 0.459575, 0.124332},
+    {-0.171808, 0.544940, 0.141216},
+    {0.174728, 0.750364, 0.101738},
+    {0.392126, -0.600247, 0.411696},
+    {-0.174727, 0.750364, 0.101738},
+    {-0.392125, -0.600247, 0.411696},
+    {0.168070, 0.835357, -0.189717},
+    {0.358874, -0.578813, -0.404284},
+    {-0.168068, 0.835357, -0.189717},
+    {-0.358873, -0.578813, -0.404284},
+    {0.273548, -0.771223, -0.306753},
+    {-0.273547, -0.771223, -0.306753},
+    {0.278056, -0.767084, 0.317796},
+    {-0.278054, -0.767084, 0.317796},
+    {0.000001, -0.571441, -0.543753},
+    {0.000001, 0.878002, -0.199531},
+    {0.000001, -0.603925, 0.516231},
+    {0.000001, -0.790496, -0.374140},
+    {0.000001, 0.774808, 0.147416},
+    {0.520151, -0.621311, 0.012464},
+    {0.201691, 0.828541, -0.030127},
+    {0.339575, -0.802283, 0.011226},
+    {0.000001, -0.759469, -0.014259},
+    {0.000001, 0.903854, 0.003258},
+    {0.222359, 0.599408, -0.305107},
+    {0.251099, 0.175670, -0.379512},
+    {0.000001, 0.615146, -0.377113},
+    {0.000001, 0.182948, -0.476118},
+    {0.000001, -0.781928, 0.343776},
+    {-0.520150, -0.621311, 0.012464},
+    {-0.201689, 0.828541, -0.030127},
+    {0.380816, 0.159715, -0.129771},
+    {0.321938, 0.568757, -0.106233},
+    {0.237194, 0.525041, 0.090008},
+    {0.282920, 0.131836, 0.111509},
+    {0.000001, 0.516584, 0.193598},
+    {0.000001, 0.134398, 0.245123},
+    {-0.339574, -0.802283, 0.011226},
+    {0.342112, -0.239909, -0.419029},
+    {0.000001, -0.233795, -0.543821},
+    {0.000001, -0.266897, 0.460298},
+    {-0.222358, 0.599408, -0.305107},
+    {-0.251098, 0.175670, -0.379512},
+    {0.504716, -0.257458, -0.054706},
+    {0.388096, -0.272138, 0.331569},
+    {-0.380815, 0.159715, -0.129771},
+    {-0.321937, 0.568757, -0.106233},
+    {-0.237193, 0.525041, 0.090008},
+    {-0.282919, 0.131836, 0.111509},
+    {-0.342110, -0.239909, -0.419029},
+    {-0.504715, -0.257458, -0.054706},
+    {-0.388094, -0.272138, 0.331569},
+    {0.099359, 0.865963, -0.196678},
+    {0.320236, -0.702955, -0.359127},
+    {0.193306, -0.570808, -0.511405},
+    {0.160103, -0.784519, -0.351702},
+    {0.000001, -0.710828, -0.485344},
+    {0.472010, -0.602954, -0.217557},
+    {-0.472009, -0.602954, -0.217557},
+    {0.316384, -0.793309, -0.176827},
+    {0.000001, -0.784976, -0.208845},
+    {-0.366301, -0.421561, -0.422379},
+    {0.190001, 0.844813, -0.120802},
+    {-0.292940, 0.586394, -0.214084},
+    {0.000001, 0.916321, -0.095758},
+    {-0.320234, -0.702955, -0.359127},
+    {0.106778, 0.886576, -0.005250},
+    {-0.232861, 0.397189, -0.349008},
+    {0.454603, -0.745843, 0.019679},
+    {-0.198167, 0.753506, -0.244366},
+    {0.181417, -0.784429, -0.005086},
+    {0.274556, 0.722423, -0.068044},
+    {0.198169, 0.753506, -0.244366},
+    {0.232862, 0.397189, -0.349008},
+    {0.366302, -0.421561, -0.422379},
+    {0.000001, 0.775991, -0.296841},
+    {0.000001, 0.408368, -0.433834},
+    {0.000001, -0.411439, -0.558484},
+    {0.154762, 0.131593, 0.205140},
+    {0.000001, -0.448060, 0.518600},
+    {-0.442039, -0.052336, -0.099382},
+    {-0.194324, 0.791575, 0.051098},
+    {0.442040, -0.052336, -0.099382},
+    {0.348031, 0.373915, -0.130422},
+    {0.000001, 0.335486, 0.201882},
+    {0.132884, 0.180638, -0.451963},
+    {0.119596, 0.610294, -0.359743},
+    {-0.348029, 0.373915, -0.130422},
+    {0.292942, 0.586394, -0.214084},
+    {0.339472, 0.169760, -0.263785},
+    {0.255391, 0.339049, 0.079269},
+    {0.000001, 0.662936, 0.180674},
+    {0.207908, 0.667844, 0.101724},
+    {-0.316382, -0.793309, -0.176827},
+    {0.336359, -0.709703, 0.375713},
+    {0.000001, -0.722494, 0.457649},
+    {0.161072, -0.776995, 0.338754},
+    {0.103685, 0.767768, 0.132312},
+    {0.216166, -0.600098, 0.496433},
+    {0.410197, -0.450740, 0.399776},
+    {0.129796, 0.517253, 0.163151},
+    {-0.255389, 0.339049, 0.079269},
+    {0.000001, 0.855305, 0.086883},
+    {-0.339470, 0.169760, -0.263785},
+    {0.194326, 0.791575, 0.051098},
+    {-0.190000, 0.844813, -0.120802},
+    {0.361349, 0.143905, -0.002664},
+    {0.303142, 0.545131, -0.002413},
+    {-0.336358, -0.709703, 0.375713},
+    {0.294743, -0.039434, -0.403273},
+    {0.000001, -0.034412, -0.513778},
+    {0.000001, -0.069820, 0.349082},
+    {0.534974, -0.452152, -0.014140},
+    {0.335563, -0.075269, 0.214380},
+    {0.453620, -0.247694, -0.257920},
+    {-0.207907, 0.667844, 0.101724},
+    {0.215039, -0.269761, 0.430833},
+    {-0.410195, -0.450740, 0.399776},
+    {0.183425, -0.235276, -0.513898},
+    {0.485234, -0.267122, 0.157056},
+    {-0.274555, 0.722423, -0.068044},
+    {0.317351, -0.788665, 0.196571},
+    {0.494870, -0.614192, 0.238644},
+    {-0.454601, -0.745843, 0.019679},
+    {0.000001, -0.774587, 0.179081},
+    {-0.361348, 0.143905, -0.002664},
+    {-0.303140, 0.545131, -0.002413},
+    {-0.294742, -0.039434, -0.403273},
+    {-0.534973, -0.452152, -0.014140},
+    {-0.335561, -0.075269, 0.214380},
+    {-0.453619, -0.247694, -0.257920},
+    {-0.485233, -0.267122, 0.157056},
+    {-0.317350, -0.788665, 0.196571},
+    {-0.494869, -0.614192, 0.238644},
+    {-0.181415, -0.784429, -0.005086},
+    {-0.193304, -0.570808, -0.511405},
+    {-0.160102, -0.784519, -0.351702},
+    {-0.106777, 0.886574, -0.005250},
+    {-0.154760, 0.131593, 0.205140},
+    {-0.216164, -0.600098, 0.496433},
+    {-0.099358, 0.865963, -0.196678},
+    {-0.119594, 0.610294, -0.359743},
+    {-0.132883, 0.180638, -0.451963},
+    {-0.103684, 0.767768, 0.132312},
+    {-0.161071, -0.776995, 0.338754},
+    {-0.129794, 0.517253, 0.163151},
+    {-0.215038, -0.269761, 0.430833},
+    {-0.183424, -0.235276, -0.513898},
+    {-0.174280, -0.704023, -0.455259},
+    {-0.108991, 0.768799, -0.285403},
+    {0.174281, -0.704024, -0.455259},
+    {0.169669, -0.787303, 0.183210},
+    {0.328033, 0.354737, -0.020656},
+    {-0.123775, 0.404939, -0.412651},
+    {-0.513218, -0.454511, 0.216920},
+    {-0.416224, -0.727564, -0.190293},
+    {0.513220, -0.454511, 0.216920},
+    {-0.184981, -0.073462, 0.313008},
+    {0.156919, -0.035966, -0.486609},
+    {-0.395042, -0.043952, -0.266310},
+    {0.108992, 0.768799, -0.285403},
+    {0.102433, 0.900050, -0.100455},
+    {-0.328031, 0.354737, -0.020656},
+    {-0.102431, 0.900050, -0.100455},
+    {0.139265, 0.334733, 0.164514},
+    {0.416225, -0.727564, -0.190293},
+    {-0.139264, 0.334733, 0.164514},
+    {0.171517, -0.796382, -0.194544},
+    {-0.104689, 0.841333, 0.076011},
+    {0.184982, -0.073462, 0.313008},
+    {-0.169667, -0.787303, 0.183210},
+    {0.185054, -0.714073, 0.443702},
+    {0.104690, 0.841333, 0.076011},
+    {-0.253535, 0.741601, -0.165394},
+    {-0.227230, -0.448480, 0.494324},
+    {0.123776, 0.404939, -0.412651},
+    {0.426998, -0.730529, 0.224519},
+    {-0.426997, -0.730529, 0.224519},
+    {-0.115685, 0.662038, 0.158229},
+    {-0.185053, -0.714073, 0.443702},
+    {0.483043, -0.437992, -0.241275},
+    {-0.171515, -0.796382, -0.194544},
+    {0.253537, 0.741601, -0.165394},
+    {0.312545, 0.387668, -0.247344},
+    {0.115687, 0.662038, 0.158229},
+    {-0.483041, -0.437992, -0.241275},
+    {0.260231, 0.693281, 0.024537},
+    {0.395044, -0.043952, -0.266310},
+    {-0.260230, 0.693281, 0.024537},
+    {-0.197051, -0.413219, -0.526654},
+    {-0.312544, 0.387668, -0.247344},
+    {0.227231, -0.448480, 0.494324},
+    {-0.423104, -0.065777, 0.069287},
+    {0.197053, -0.413219, -0.526654},
+    {0.423107, -0.065777, 0.069287},
+    {-0.156917, -0.035966, -0.486609},
+    {0.209185, 0.772829, 0.145419},
+    {0.430907, -0.615445, 0.454881},
+    {-0.209183, 0.772829, 0.145419},
+    {-0.430906, -0.615445, 0.454881},
+    {0.200501, 0.877277, -0.217840},
+    {0.399550, -0.594806, -0.445390},
+    {-0.200500, 0.877277, -0.217840},
+    {-0.399548, -0.594805, -0.445390},
+    {0.293501, -0.823523, -0.328351},
+    {-0.293500, -0.823523, -0.328351},
+    {0.291712, -0.822029, 0.337659},
+    {-0.291710, -0.822029, 0.337659},
+    {0.000001, -0.586198, -0.601911},
+    {0.000001, 0.928312, -0.232224},
+    {0.000001, -0.617620, 0.574647},
+    {0.000001, -0.846874, -0.394675},
+    {0.000001, 0.801500, 0.201152},
+    {0.577486, -0.638801, 0.009849},
+    {0.244303, 0.869197, -0.018670},
+    {0.353327, -0.860686, 0.011348},
+    {0.000001, -0.819448, -0.012634},
+    {0.000001, 0.960676, 0.022527},
+    {0.260869, 0.616687, -0.347751},
+    {0.290563, 0.186661, -0.423351},
+    {0.000001, 0.636148, -0.433318},
+    {0.000001, 0.193622, -0.535161},
+    {0.000001, -0.839914, 0.359195},
+    {-0.577484, -0.638801, 0.009849},
+    {-0.244301, 0.869197, -0.018670},
+    {0.439279, 0.172726, -0.133350},
+    {0.380650, 0.581113, -0.106782},
+    {0.278927, 0.528842, 0.132950},
+    {0.323273, 0.151816, 0.151164},
+    {0.000001, 0.519713, 0.253517},
+    {0.000001, 0.155497, 0.301292},
+    {-0.353326, -0.860686, 0.011348},
+    {0.383053, -0.230746, -0.461923},
+    {0.000001, -0.226718, -0.603402},
+    {0.000001, -0.241853, 0.514821},
+    {-0.260867, 0.616687, -0.347751},
+    {-0.290561, 0.186661, -0.423351},
+    {0.563137, -0.244294, -0.058431},
+    {0.427051, -0.247622, 0.370058},
+    {-0.439277, 0.172726, -0.133350},
+    {-0.380648, 0.581113, -0.106782},
+    {-0.278926, 0.528842, 0.132950},
+    {-0.323272, 0.151816, 0.151164},
+    {-0.383051, -0.230746, -0.461923},
+    {-0.563135, -0.244294, -0.058431},
+    {-0.427049, -0.247622, 0.370058},
+    {0.115454, 0.914515, -0.228042},
+    {0.354043, -0.738199, -0.393985},
+    {0.214076, -0.585938, -0.565624},
+    {0.169016, -0.839891, -0.373020},
+    {0.000001, -0.747628, -0.532734},
+    {0.525080, -0.619808, -0.239904},
+    {-0.525079, -0.619808, -0.239904},
+    {0.333410, -0.850028, -0.186471},
+    {0.000001, -0.844934, -0.206605},
+    {-0.408350, -0.421969, -0.465177},
+    {0.229711, 0.888923, -0.129609},
+    {-0.345890, 0.601333, -0.238024},
+    {0.000001, 0.976015, -0.101812},
+    {-0.354041, -0.738199, -0.393985},
+    {0.128573, 0.939713, 0.012110},
+    {-0.272059, 0.407879, -0.393159},
+    {0.497171, -0.788113, 0.018603},
+    {-0.234778, 0.782992, -0.281652},
+    {0.176549, -0.844220, -0.003897},
+    {0.329261, 0.746698, -0.063783},
+    {0.234779, 0.782992, -0.281652},
+    {0.272060, 0.407879, -0.393159},
+    {0.408352, -0.421969, -0.465177},
+    {0.000001, 0.810104, -0.346200},
+    {0.000001, 0.421582, -0.492361},
+    {0.000001, -0.411791, -0.618483},
+    {0.178430, 0.152591, 0.256119},
+    {0.000001, -0.438430, 0.577823},
+    {-0.499429, -0.035209, -0.103003},
+    {-0.234662, 0.824516, 0.080894},
+    {0.499430, -0.035209, -0.103003},
+    {0.407353, 0.382442, -0.133257},
+    {0.000001, 0.342979, 0.261413},
+    {0.153667, 0.191420, -0.507207},
+    {0.138481, 0.630142, -0.413124},
+    {-0.407351, 0.382442, -0.133257},
+    {0.345892, 0.601333, -0.238024},
+    {0.392098, 0.181094, -0.290280},
+    {0.297553, 0.346183, 0.121358},
+    {0.000001, 0.673190, 0.239792},
+    {0.247495, 0.678671, 0.145493},
+    {-0.333409, -0.850028, -0.186471},
+    {0.364517, -0.749591, 0.410586},
+    {0.000001, -0.763759, 0.501206},
+    {0.165352, -0.834181, 0.356403},
+    {0.122609, 0.793451, 0.183128},
+    {0.232168, -0.613928, 0.552582},
+    {0.451384, -0.441841, 0.442488},
+    {0.153907, 0.520067, 0.218021},
+    {-0.297551, 0.346183, 0.121358},
+    {0.000001, 0.900422, 0.126435},
+    {-0.392096, 0.181094, -0.290280},
+    {0.234664, 0.824516, 0.080894},
+    {-0.229708, 0.888923, -0.129609},
+    {0.414829, 0.160529, 0.018867},
+    {0.357533, 0.552964, 0.021674},
+    {-0.364516, -0.749591, 0.410586},
+    {0.334529, -0.026990, -0.446427},
+    {0.000001, -0.024607, -0.572971},
+    {0.000001, -0.040252, 0.401291},
+    {0.594850, -0.450686, -0.017715},
+    {0.373349, -0.046570, 0.251100},
+    {0.507659, -0.237290, -0.281830},
+    {-0.247493, 0.678671, 0.145493},
+    {0.232868, -0.244028, 0.482019},
+    {-0.451382, -0.441841, 0.442488},
+    {0.204226, -0.227473, -0.569634},
+    {0.539368, -0.248195, 0.174701},
+    {-0.329260, 0.746698, -0.063783},
+    {0.330691, -0.846437, 0.205757},
+    {0.548950, -0.631316, 0.258192},
+    {-0.497170, -0.788113, 0.018603},
+    {0.000001, -0.834574, 0.177801},
+    {-0.414827, 0.160529, 0.018867},
+    {-0.357532, 0.552964, 0.021674},
+    {-0.334528, -0.026990, -0.446427},
+    {-0.594848, -0.450686, -0.017715},
+    {-0.373348, -0.046570, 0.251100},
+    {-0.507658, -0.237290, -0.281830},
+    {-0.539366, -0.248195, 0.174701},
+    {-0.330689, -0.846437, 0.205757},
+    {-0.548948, -0.631318, 0.258192},
+    {-0.176548, -0.844220, -0.003897},
+    {-0.214075, -0.585938, -0.565624},
+    {-0.169015, -0.839891, -0.373020},
+    {-0.128572, 0.939713, 0.012110},
+    {-0.178429, 0.152591, 0.256119},
+    {-0.232166, -0.613928, 0.552582},
+    {-0.115453, 0.914515, -0.228042},
+    {-0.138479, 0.630142, -0.413124},
+    {-0.153665, 0.191420, -0.507207},
+    {-0.122608, 0.793451, 0.183128},
+    {-0.165350, -0.834181, 0.356403},
+    {-0.153905, 0.520067, 0.218021},
+    {-0.232867, -0.244028, 0.482019},
+    {-0.204224, -0.227473, -0.569634},
+    {-0.191722, -0.739739, -0.500205},
+    {-0.125509, 0.801407, -0.332983},
+    {0.191723, -0.739739, -0.500205},
+    {0.167237, -0.847235, 0.184691},
+    {0.382766, 0.362444, 0.002687},
+    {-0.144052, 0.417370, -0.467736},
+    {-0.570088, -0.449506, 0.235382},
+    {-0.458197, -0.766274, -0.208726},
+    {0.570089, -0.449506, 0.235382},
+    {-0.204718, -0.043450, 0.361068},
+    {0.177631, -0.025294, -0.541900},
+    {-0.447710, -0.029885, -0.291372},
+    {0.125510, 0.801407, -0.332983},
+    {0.121979, 0.956479, -0.106266},
+    {-0.382765, 0.362444, 0.002687},
+    {-0.121978, 0.956479, -0.106266},
+    {0.164713, 0.341933, 0.218372},
+    {0.458198, -0.766274, -0.208726},
+    {-0.164711, 0.341933, 0.218372},
+    {0.170486, -0.856369, -0.195298},
+    {-0.125057, 0.884321, 0.112578},
+    {0.204719, -0.043450, 0.361068},
+    {-0.167236, -0.847235, 0.184691},
+    {0.196453, -0.754103, 0.486917},
+    {0.125059, 0.884321, 0.112578},
+    {-0.304171, 0.768817, -0.182578},
+    {-0.244615, -0.438406, 0.550859},
+    {0.144053, 0.417370, -0.467736},
+    {0.466382, -0.772526, 0.241404},
+    {-0.466381, -0.772526, 0.241404},
+    {-0.136861, 0.671452, 0.213573},
+    {-0.196451, -0.754103, 0.486917},
+    {0.538334, -0.438140, -0.264574},
+    {-0.170485, -0.856369, -0.195298},
+    {0.304172, 0.768817, -0.182578},
+    {0.365528, 0.396944, -0.273927},
+    {0.136862, 0.671452, 0.213573},
+    {-0.538333, -0.438140, -0.264574},
+    {0.311683, 0.710912, 0.049872},
+    {0.447712, -0.029885, -0.291372},
+    {-0.311681, 0.710912, 0.049872},
+    {-0.218185, -0.413573, -0.582808},
+    {-0.365527, 0.396944, -0.273927},
+    {0.244616, -0.438406, 0.550859},
+    {-0.475178, -0.042641, 0.088076},
+    {0.218186, -0.413573, -0.582808},
+    {0.475180, -0.042641, 0.088076},
+    {-0.177629, -0.025294, -0.541900},
+    {-0.763241, -0.883499, 0.123206},
+    {-0.783811, -0.765491, 0.131409},
+    {-0.423877, -0.883499, -0.283993},
+    {-0.423877, -0.615053, -0.283993},
+    {-0.542633, -0.883499, 0.307062},
+    {-0.546995, -0.765491, 0.328773},
+    {-0.203270, -0.883499, -0.100137},
+    {-0.203270, -0.615053, -0.100137},
+    {-0.617731, -0.893993, -0.100539},
+    {-0.824596, -0.833767, 0.147677},
+    {-0.617731, -0.583588, -0.100539},
+    {-0.410866, -0.833767, -0.348754},
+    {-0.276391, -0.893993, -0.236682},
+    {-0.276391, -0.583588, -0.236682},
+    {-0.141914, -0.833767, -0.124608},
+    {-0.348779, -0.893993, 0.123608},
+    {-0.348779, -0.583588, 0.123608},
+    {-0.555644, -0.833767, 0.371822},
+    {-0.690121, -0.893993, 0.259749},
+    {-0.716281, -0.744574, 0.291140},
+    {-0.668456, -0.833767, -0.142815},
+    {-0.198358, -0.833767, -0.330312},
+    {-0.298054, -0.833767, 0.165882},
+    {-0.768152, -0.833767, 0.353379},
+    {-0.483256, -0.916015, 0.011534},
+    {-0.483256, -0.517555, 0.011534},
+    {0.763241, -0.883499, 0.123206},
+    {0.783812, -0.765491, 0.131409},
+    {0.423878, -0.883499, -0.283993},
+    {0.423878, -0.615053, -0.283993},
+    {0.542635, -0.883499, 0.307062},
+    {0.546997, -0.765491, 0.328773},
+    {0.203272, -0.883499, -0.100137},
+    {0.203272, -0.615053, -0.100137},
+    {0.617732, -0.893993, -0.100539},
+    {0.824597, -0.833767, 0.147677},
+    {0.617732, -0.583588, -0.100539},
+    {0.410867, -0.833767, -0.348754},
+    {0.276392, -0.893993, -0.236682},
+    {0.276392, -0.583588, -0.236682},
+    {0.141916, -0.833767, -0.124608},
+    {0.348781, -0.893993, 0.123608},
+    {0.348781, -0.583588, 0.123608},
+    {0.555646, -0.833767, 0.371822},
+    {0.690121, -0.893993, 0.259749},
+    {0.716282, -0.744574, 0.291140},
+    {0.668458, -0.833767, -0.142815},
+    {0.198359, -0.833767, -0.330312},
+    {0.298055, -0.833767, 0.165882},
+    {0.768154, -0.833767, 0.353379},
+    {0.483257, -0.916015, 0.011534},
+    {0.483257, -0.517555, 0.011534},
+    {-0.790303, -0.936706, 0.117147},
+    {-0.832943, -0.731266, 0.127589},
+    {-0.434714, -0.936706, -0.309520},
+    {-0.438794, -0.579449, -0.329926},
+    {-0.531796, -0.936706, 0.332589},
+    {-0.534382, -0.731266, 0.376413},
+    {-0.176207, -0.936706, -0.094078},
+    {-0.155401, -0.579449, -0.093742},
+    {-0.638681, -0.947437, -0.117999},
+    {-0.883301, -0.845923, 0.145245},
+    {-0.655045, -0.541910, -0.122233},
+    {-0.424076, -0.850762, -0.404760},
+    {-0.263990, -0.950782, -0.251559},
+    {-0.251272, -0.538192, -0.266820},
+    {-0.084445, -0.850762, -0.121708},
+    {-0.327829, -0.947437, 0.141068},
+    {-0.320716, -0.541910, 0.156401},
+    {-0.542672, -0.845923, 0.429128},
+    {-0.702520, -0.950782, 0.274628},
+    {-0.742256, -0.700372, 0.322308},
+    {-0.713729, -0.848225, -0.179439},
+    {-0.161284, -0.849473, -0.374796},
+    {-0.253870, -0.848225, 0.203813},
+    {-0.806158, -0.842494, 0.398980},
+    {-0.483256, -0.976015, 0.011534},
+    {-0.490054, -0.458501, 0.019692},
+    {0.790304, -0.936706, 0.117147},
+    {0.832945, -0.731266, 0.127589},
+    {0.434716, -0.936706, -0.309520},
+    {0.438796, -0.579449, -0.329926},
+    {0.531797, -0.936706, 0.332589},
+    {0.534383, -0.731266, 0.376413},
+    {0.176209, -0.936706, -0.094078},
+    {0.155402, -0.579449, -0.093742},
+    {0.638683, -0.947437, -0.117999},
+    {0.883301, -0.845923, 0.145245},
+    {0.655046, -0.541910, -0.122233},
+    {0.424078, -0.850762, -0.404760},
+    {0.263992, -0.950782, -0.251559},
+    {0.251273, -0.538192, -0.266820},
+    {0.084446, -0.850762, -0.121708},
+    {0.327830, -0.947437, 0.141068},
+    {0.320717, -0.541910, 0.156401},
+    {0.542674, -0.845923, 0.429128},
+    {0.702521, -0.950782, 0.274628},
+    {0.742258, -0.700372, 0.322308},
+    {0.713731, -0.848225, -0.179439},
+    {0.161285, -0.849473, -0.374796},
+    {0.253871, -0.848225, 0.203813},
+    {0.806159, -0.842494, 0.398980},
+    {0.483257, -0.976015, 0.011534},
+    {0.490055, -0.458501, 0.019692},
+};
+#define texcoords_count 663
+static const float texcoords[][3] = {
+    {0.009831, 0.035651},
+    {0.022569, 0.022913},
+    {0.022569, 0.010176},
+    {0.027346, 0.058473},
+    {0.048045, 0.048389},
+    {0.030000, 0.048389},
+    {0.048045, 0.022913},
+    {0.060783, 0.035651},
+    {0.048045, 0.035651},
+    {0.030000, 0.035651},
+    {0.030000, 0.022913},
+    {0.022569, 0.048389},
+    {0.060783, 0.022913},
+    {0.027346, 0.012829},
+    {0.022569, 0.035651},
+    {0.058552, 0.058052},
+    {0.009831, 0.048389},
+    {0.042069, 0.919810},
+    {0.025357, 0.936523},
+    {0.042069, 0.903098},
+    {0.075494, 0.953235},
+    {0.048336, 0.966466},
+    {0.051818, 0.953235},
+    {0.075494, 0.936523},
+    {0.092207, 0.919810},
+    {0.075494, 0.919810},
+    {0.051818, 0.936523},
+    {0.042069, 0.936523},
+    {0.042069, 0.953235},
+    {0.025357, 0.953235},
+    {0.092207, 0.936523},
+    {0.089279, 0.965914},
+    {0.048336, 0.906579},
+    {0.051818, 0.919810},
+    {0.044493, 0.911901},
+    {0.049930, 0.920258},
+    {0.041425, 0.922613},
+    {0.049566, 0.930222},
+    {0.029819, 0.983012},
+    {0.041206, 0.973418},
+    {0.031998, 0.988770},
+    {0.041206, 0.955516},
+    {0.031242, 0.955880},
+    {0.033597, 0.947375},
+    {0.022885, 0.950443},
+    {0.025064, 0.956202},
+    {0.041206, 0.928736},
+    {0.029819, 0.938329},
+    {0.034570, 0.926898},
+    {0.013677, 0.965795},
+    {0.068954, 0.965795},
+    {0.057567, 0.956202},
+    {0.059746, 0.950443},
+    {0.027441, 0.969607},
+    {0.023641, 0.983334},
+    {0.041425, 0.973418},
+    {0.046256, 0.959334},
+    {0.048061, 0.971581},
+    {0.018508, 0.979880},
+    {0.055189, 0.969607},
+    {0.051388, 0.955880},
+    {0.020313, 0.967633},
+    {0.082820, 0.921014},
+    {0.077383, 0.912657},
+    {0.085888, 0.910302},
+    {0.077747, 0.902693},
+    {0.073930, 0.907524},
+    {0.021286, 0.991838},
+    {0.077061, 0.918835},
+    {0.067468, 0.930222},
+    {0.065630, 0.923586},
+    {0.027441, 0.924925},
+    {0.036375, 0.914651},
+    {0.059845, 0.902693},
+    {0.061683, 0.909329},
+    {0.052812, 0.983012},
+    {0.050633, 0.988770},
+    {0.062318, 0.967633},
+    {0.041425, 0.955516},
+    {0.025064, 0.911520},
+    {0.031242, 0.911198},
+    {0.064123, 0.979880},
+    {0.058990, 0.983334},
+    {0.022885, 0.905761},
+    {0.013677, 0.921113},
+    {0.020313, 0.922951},
+    {0.041206, 0.910834},
+    {0.033597, 0.902693},
+    {0.018508, 0.935198},
+    {0.023641, 0.938651},
+    {0.013677, 0.939015},
+    {0.036375, 0.959334},
+    {0.068954, 0.983697},
+    {0.061345, 0.991838},
+    {0.021286, 0.947156},
+    {0.053383, 0.925391},
+    {0.063656, 0.916457},
+    {0.031998, 0.944088},
+    {0.050252, 0.914080},
+    {0.034570, 0.971581},
+    {0.013677, 0.983697},
+    {0.229068, 0.283003},
+    {0.171021, 0.368583},
+    {0.235716, 0.372905},
+    {0.104567, 0.291799},
+    {0.161402, 0.287784},
+    {0.118691, 0.365651},
+    {0.177081, 0.436390},
+    {0.237434, 0.450190},
+    {0.772487, 0.244608},
+    {0.830885, 0.291437},
+    {0.831241, 0.240456},
+    {0.773900, 0.300420},
+    {0.829115, 0.333252},
+    {0.858218, 0.317125},
+    {0.866299, 0.284431},
+    {0.869054, 0.237785},
+    {0.159565, 0.206435},
+    {0.213843, 0.116300},
+    {0.223009, 0.193059},
+    {0.156030, 0.138449},
+    {0.108167, 0.216695},
+    {0.868437, 0.835431},
+    {0.916164, 0.782980},
+    {0.891119, 0.855846},
+    {0.877245, 0.780118},
+    {0.924195, 0.701498},
+    {0.957286, 0.796000},
+    {0.930059, 0.894764},
+    {0.249114, 0.893652},
+    {0.328855, 0.924338},
+    {0.225876, 0.926457},
+    {0.257535, 0.859491},
+    {0.339356, 0.898423},
+    {0.344655, 0.861842},
+    {0.438835, 0.906224},
+    {0.431835, 0.922219},
+    {0.580003, 0.258208},
+    {0.686235, 0.308569},
+    {0.683794, 0.250874},
+    {0.583296, 0.320100},
+    {0.686303, 0.359562},
+    {0.691504, 0.441139},
+    {0.602015, 0.493654},
+    {0.594643, 0.454895},
+    {0.788365, 0.427384},
+    {0.689209, 0.474676},
+    {0.765689, 0.476993},
+    {0.690181, 0.526260},
+    {0.607823, 0.542411},
+    {0.227666, 0.508117},
+    {0.136648, 0.417420},
+    {0.165829, 0.485511},
+    {0.086053, 0.486788},
+    {0.143284, 0.527760},
+    {0.200515, 0.568731},
+    {0.634440, 0.952577},
+    {0.730424, 0.991987},
+    {0.632591, 0.991987},
+    {0.633335, 0.903487},
+    {0.723436, 0.959106},
+    {0.717145, 0.907898},
+    {0.798831, 0.946058},
+    {0.828257, 0.991987},
+    {0.526463, 0.729599},
+    {0.612405, 0.622994},
+    {0.618141, 0.723122},
+    {0.431463, 0.736311},
+    {0.522077, 0.643428},
+    {0.427681, 0.664226},
+    {0.517969, 0.573320},
+    {0.386138, 0.271905},
+    {0.473008, 0.192406},
+    {0.379420, 0.186626},
+    {0.478888, 0.265352},
+    {0.574560, 0.196467},
+    {0.568364, 0.141638},
+    {0.466865, 0.128406},
+    {0.372049, 0.112959},
+    {0.583189, 0.443916},
+    {0.487880, 0.452057},
+    {0.488713, 0.492568},
+    {0.585318, 0.418038},
+    {0.486240, 0.402628},
+    {0.394538, 0.431253},
+    {0.394863, 0.487115},
+    {0.394237, 0.541219},
+    {0.823720, 0.190033},
+    {0.766038, 0.189151},
+    {0.859768, 0.191989},
+    {0.847170, 0.160757},
+    {0.816088, 0.148881},
+    {0.758302, 0.141655},
+    {0.894025, 0.128798},
+    {0.887748, 0.188080},
+    {0.915920, 0.180862},
+    {0.861783, 0.148124},
+    {0.899896, 0.235606},
+    {0.937815, 0.232927},
+    {0.303437, 0.564580},
+    {0.228802, 0.606173},
+    {0.201183, 0.576962},
+    {0.405691, 0.552198},
+    {0.317477, 0.588761},
+    {0.414871, 0.567050},
+    {0.327867, 0.624233},
+    {0.241943, 0.638810},
+    {0.909101, 0.342178},
+    {0.894551, 0.284367},
+    {0.874462, 0.327577},
+    {0.923458, 0.287552},
+    {0.437854, 0.808212},
+    {0.337918, 0.742921},
+    {0.441953, 0.867838},
+    {0.342845, 0.807680},
+    {0.257628, 0.809274},
+    {0.253673, 0.748873},
+    {0.196028, 0.060322},
+    {0.160623, 0.004128},
+    {0.137983, 0.091398},
+    {0.058820, 0.101351},
+    {0.095632, 0.140872},
+    {0.118666, 0.162916},
+    {0.249096, 0.688515},
+    {0.333691, 0.678111},
+    {0.423355, 0.604616},
+    {0.068431, 0.212573},
+    {0.031594, 0.200115},
+    {0.004367, 0.298879},
+    {0.059852, 0.294958},
+    {0.117239, 0.666316},
+    {0.065422, 0.708562},
+    {0.079778, 0.653937},
+    {0.139178, 0.675275},
+    {0.097441, 0.710472},
+    {0.133417, 0.708896},
+    {0.093800, 0.760168},
+    {0.051065, 0.763188},
+    {0.626541, 0.823061},
+    {0.534236, 0.815531},
+    {0.540027, 0.885520},
+    {0.850159, 0.576735},
+    {0.904787, 0.621954},
+    {0.866657, 0.630260},
+    {0.902827, 0.509326},
+    {0.869745, 0.553333},
+    {0.943670, 0.603281},
+    {0.880327, 0.704597},
+    {0.774922, 0.712044},
+    {0.834344, 0.794361},
+    {0.780248, 0.812728},
+    {0.832905, 0.707948},
+    {0.836519, 0.864944},
+    {0.786100, 0.894578},
+    {0.072960, 0.815252},
+    {0.130202, 0.849793},
+    {0.094854, 0.867316},
+    {0.104392, 0.808859},
+    {0.140233, 0.805362},
+    {0.150664, 0.837838},
+    {0.848399, 0.380665},
+    {0.835276, 0.360419},
+    {0.774076, 0.384184},
+    {0.787697, 0.419153},
+    {0.702416, 0.717167},
+    {0.766038, 0.611612},
+    {0.695143, 0.611448},
+    {0.760323, 0.529752},
+    {0.678098, 0.193410},
+    {0.670996, 0.142913},
+    {0.852630, 0.909631},
+    {0.879158, 0.943376},
+    {0.814409, 0.552003},
+    {0.824076, 0.505494},
+    {0.845596, 0.468355},
+    {0.182207, 0.699838},
+    {0.185592, 0.753683},
+    {0.176475, 0.657128},
+    {0.822179, 0.622190},
+    {0.356289, 0.004127},
+    {0.274120, 0.050504},
+    {0.364516, 0.057606},
+    {0.258456, 0.004127},
+    {0.286751, 0.107677},
+    {0.079930, 0.375319},
+    {0.116942, 0.442483},
+    {0.045210, 0.392834},
+    {0.828514, 0.099228},
+    {0.763004, 0.069658},
+    {0.818368, 0.121118},
+    {0.754435, 0.106194},
+    {0.664745, 0.103857},
+    {0.660024, 0.071777},
+    {0.562792, 0.099218},
+    {0.189812, 0.807469},
+    {0.190142, 0.850561},
+    {0.133550, 0.757360},
+    {0.306364, 0.506857},
+    {0.297376, 0.554975},
+    {0.310830, 0.448476},
+    {0.179066, 0.877522},
+    {0.160365, 0.896887},
+    {0.557045, 0.073896},
+    {0.461538, 0.079237},
+    {0.456667, 0.039012},
+    {0.161718, 0.631992},
+    {0.140481, 0.615449},
+    {0.309148, 0.369469},
+    {0.303499, 0.277744},
+    {0.391478, 0.357281},
+    {0.685605, 0.399110},
+    {0.685443, 0.431535},
+    {0.772919, 0.348532},
+    {0.584870, 0.375255},
+    {0.710080, 0.822858},
+    {0.500167, 0.503547},
+    {0.510231, 0.530285},
+    {0.296194, 0.186135},
+    {0.532213, 0.957103},
+    {0.538417, 0.929215},
+    {0.483323, 0.338399},
+    {0.038332, 0.914438},
+    {0.032492, 0.923049},
+    {0.031524, 0.914919},
+    {0.025805, 0.915324},
+    {0.029033, 0.927963},
+    {0.027226, 0.922754},
+    {0.039174, 0.931260},
+    {0.039001, 0.923484},
+    {0.093009, 0.910575},
+    {0.098885, 0.915287},
+    {0.093152, 0.916191},
+    {0.098707, 0.919494},
+    {0.093053, 0.921032},
+    {0.101635, 0.917872},
+    {0.098921, 0.910158},
+    {0.102449, 0.914582},
+    {0.031339, 0.906734},
+    {0.037723, 0.905389},
+    {0.036800, 0.897665},
+    {0.027224, 0.902356},
+    {0.030983, 0.899894},
+    {0.102664, 0.970022},
+    {0.107466, 0.964745},
+    {0.103550, 0.964457},
+    {0.103860, 0.956858},
+    {0.111603, 0.966055},
+    {0.108274, 0.956546},
+    {0.108864, 0.975992},
+    {0.104946, 0.972076},
+    {0.048373, 0.978968},
+    {0.040349, 0.975880},
+    {0.038011, 0.979181},
+    {0.049429, 0.976360},
+    {0.041197, 0.972443},
+    {0.059438, 0.977145},
+    {0.049962, 0.972680},
+    {0.058734, 0.978754},
+    {0.073642, 0.911944},
+    {0.084331, 0.917011},
+    {0.073974, 0.918171},
+    {0.084338, 0.922142},
+    {0.074132, 0.923721},
+    {0.084085, 0.911206},
+    {0.075857, 0.935634},
+    {0.084861, 0.930350},
+    {0.075115, 0.931734},
+    {0.084630, 0.933724},
+    {0.094607, 0.928966},
+    {0.084728, 0.938914},
+    {0.092326, 0.933957},
+    {0.076441, 0.940539},
+    {0.038191, 0.937089},
+    {0.033101, 0.929872},
+    {0.031969, 0.934814},
+    {0.023943, 0.934943},
+    {0.027050, 0.930485},
+    {0.035459, 0.943188},
+    {0.088777, 0.985774},
+    {0.079120, 0.981809},
+    {0.078934, 0.985774},
+    {0.088074, 0.982466},
+    {0.079008, 0.976870},
+    {0.095660, 0.981153},
+    {0.087441, 0.977314},
+    {0.098621, 0.985774},
+    {0.076903, 0.948647},
+    {0.068255, 0.959374},
+    {0.077480, 0.958722},
+    {0.067814, 0.950703},
+    {0.058697, 0.960049},
+    {0.067401, 0.943649},
+    {0.058316, 0.952796},
+    {0.054136, 0.913322},
+    {0.062877, 0.905323},
+    {0.063468, 0.912662},
+    {0.073095, 0.905731},
+    {0.072471, 0.900215},
+    {0.053460, 0.904741},
+    {0.062259, 0.898883},
+    {0.073963, 0.930629},
+    {0.064373, 0.931448},
+    {0.074177, 0.928025},
+    {0.064208, 0.926475},
+    {0.054981, 0.929355},
+    {0.064457, 0.935524},
+    {0.055014, 0.934976},
+    {0.098164, 0.905084},
+    {0.101791, 0.905281},
+    {0.102726, 0.909889},
+    {0.100524, 0.902138},
+    {0.092361, 0.904995},
+    {0.097397, 0.900944},
+    {0.105238, 0.898923},
+    {0.104607, 0.904888},
+    {0.101994, 0.900867},
+    {0.107441, 0.904161},
+    {0.105829, 0.909670},
+    {0.038306, 0.946955},
+    {0.045815, 0.942770},
+    {0.035527, 0.944016},
+    {0.047228, 0.945203},
+    {0.056104, 0.941524},
+    {0.048273, 0.948772},
+    {0.057027, 0.943018},
+    {0.039628, 0.950239},
+    {0.106755, 0.920392},
+    {0.105291, 0.914576},
+    {0.108200, 0.914896},
+    {0.109644, 0.909400},
+    {0.103270, 0.918923},
+    {0.049284, 0.960714},
+    {0.059340, 0.967283},
+    {0.049780, 0.967230},
+    {0.059752, 0.973283},
+    {0.041206, 0.967390},
+    {0.035008, 0.892033},
+    {0.029168, 0.895160},
+    {0.031446, 0.886379},
+    {0.021202, 0.896161},
+    {0.026324, 0.891270},
+    {0.040347, 0.955240},
+    {0.040808, 0.961313},
+    {0.048859, 0.954193},
+    {0.057881, 0.946798},
+    {0.022169, 0.907352},
+    {0.024906, 0.900138},
+    {0.018463, 0.906098},
+    {0.015724, 0.916036},
+    {0.026168, 0.907767},
+    {0.021306, 0.915641},
+    {0.021867, 0.957257},
+    {0.027080, 0.953006},
+    {0.023311, 0.951761},
+    {0.025088, 0.957449},
+    {0.029288, 0.953908},
+    {0.024722, 0.962449},
+    {0.028708, 0.957291},
+    {0.020422, 0.962753},
+    {0.078325, 0.968778},
+    {0.069037, 0.968020},
+    {0.069620, 0.975062},
+    {0.100825, 0.943993},
+    {0.106321, 0.948543},
+    {0.102795, 0.941638},
+    {0.106124, 0.937210},
+    {0.110233, 0.946664},
+    {0.102485, 0.949378},
+    {0.093255, 0.957607},
+    {0.099233, 0.965890},
+    {0.099089, 0.957195},
+    {0.093790, 0.967738},
+    {0.099452, 0.972992},
+    {0.028385, 0.971467},
+    {0.022625, 0.967992},
+    {0.024828, 0.973230},
+    {0.025788, 0.967349},
+    {0.029394, 0.966997},
+    {0.030443, 0.970264},
+    {0.100648, 0.924265},
+    {0.099327, 0.922228},
+    {0.093169, 0.924619},
+    {0.094540, 0.928137},
+    {0.092361, 0.947502},
+    {0.085959, 0.958123},
+    {0.085227, 0.947486},
+    {0.091786, 0.939266},
+    {0.083512, 0.905424},
+    {0.082798, 0.900343},
+    {0.094379, 0.975973},
+    {0.101073, 0.977488},
+    {0.103742, 0.980883},
+    {0.097228, 0.941504},
+    {0.098200, 0.936825},
+    {0.100365, 0.933088},
+    {0.033617, 0.956379},
+    {0.033958, 0.961797},
+    {0.028722, 0.962167},
+    {0.033041, 0.952082},
+    {0.098009, 0.948566},
+    {0.051133, 0.886379},
+    {0.042865, 0.891045},
+    {0.041289, 0.886379},
+    {0.051961, 0.891760},
+    {0.044136, 0.896798},
+    {0.023326, 0.923727},
+    {0.019833, 0.925489},
+    {0.098647, 0.895948},
+    {0.097626, 0.898150},
+    {0.092055, 0.892972},
+    {0.091193, 0.896648},
+    {0.082169, 0.896413},
+    {0.081694, 0.893185},
+    {0.071911, 0.895947},
+    {0.071332, 0.893399},
+    {0.091582, 0.900216},
+    {0.034382, 0.967209},
+    {0.034416, 0.971545},
+    {0.054951, 0.940419},
+    {0.046110, 0.936962},
+    {0.046559, 0.931088},
+    {0.045205, 0.941803},
+    {0.033301, 0.974257},
+    {0.031420, 0.976206},
+    {0.061723, 0.893936},
+    {0.061233, 0.889889},
+    {0.052719, 0.897329},
+    {0.031556, 0.949553},
+    {0.029419, 0.947888},
+    {0.046390, 0.923138},
+    {0.045821, 0.913909},
+    {0.054673, 0.921912},
+    {0.084268, 0.926121},
+    {0.084251, 0.929383},
+    {0.086730, 0.968757},
+    {0.065609, 0.936629},
+    {0.066622, 0.939319},
+    {0.045086, 0.904692},
+    {0.068834, 0.982264},
+    {0.069458, 0.979458},
+    {0.063915, 0.920012},
+    {0.026495, 0.015853},
+    {0.033128, 0.022486},
+    {0.026495, 0.022486},
+    {0.037537, 0.015853},
+    {0.033128, 0.015853},
+    {0.039761, 0.029119},
+    {0.033128, 0.029119},
+    {0.026495, 0.029119},
+    {0.026495, 0.035752},
+    {0.039761, 0.035752},
+    {0.033128, 0.035752},
+    {0.033128, 0.042386},
+    {0.026495, 0.042386},
+    {0.033128, 0.049019},
+    {0.026495, 0.049019},
+    {0.039761, 0.042386},
+    {0.037537, 0.055652},
+    {0.033128, 0.055652},
+    {0.026495, 0.055652},
+    {0.026495, 0.062285},
+    {0.037537, 0.062285},
+    {0.033128, 0.062285},
+    {0.033128, 0.068918},
+    {0.026495, 0.068918},
+    {0.013229, 0.042386},
+    {0.019862, 0.049019},
+    {0.013229, 0.049019},
+    {0.019862, 0.042386},
+    {0.019862, 0.055652},
+    {0.013229, 0.055652},
+    {0.046394, 0.049019},
+    {0.039761, 0.049019},
+    {0.053027, 0.042386},
+    {0.046394, 0.042386},
+    {0.053748, 0.056327},
+    {0.046394, 0.056875},
+    {0.039761, 0.022486},
+    {0.053027, 0.049019},
+    {0.043345, 0.873754},
+    {0.057804, 0.888212},
+    {0.057804, 0.873754},
+    {0.067415, 0.873754},
+    {0.072262, 0.902670},
+    {0.072262, 0.888212},
+    {0.043345, 0.902670},
+    {0.043345, 0.888212},
+    {0.043345, 0.917128},
+    {0.057804, 0.902670},
+    {0.057804, 0.917128},
+    {0.072262, 0.931587},
+    {0.072262, 0.917128},
+    {0.057804, 0.931587},
+    {0.043345, 0.931587},
+    {0.057804, 0.946045},
+    {0.067415, 0.960503},
+    {0.072262, 0.946045},
+    {0.043345, 0.960503},
+    {0.043345, 0.946045},
+    {0.043345, 0.974962},
+    {0.057804, 0.960503},
+    {0.067415, 0.974962},
+    {0.057804, 0.989420},
+    {0.057804, 0.974962},
+    {0.014429, 0.931587},
+    {0.028887, 0.946045},
+    {0.028887, 0.931587},
+    {0.014429, 0.960503},
+    {0.014429, 0.946045},
+    {0.086720, 0.946045},
+    {0.086720, 0.931587},
+    {0.101178, 0.931587},
+    {0.102750, 0.961976},
+    {0.101178, 0.946045},
+    {0.033214, 0.908776},
+    {0.043601, 0.919163},
+    {0.033214, 0.919163},
+    {0.050505, 0.908776},
+    {0.043601, 0.908776},
+    {0.053988, 0.929550},
+    {0.043601, 0.929550},
+    {0.033214, 0.929550},
+    {0.033214, 0.939937},
+    {0.043601, 0.939937},
+    {0.053988, 0.950323},
+    {0.043601, 0.950323},
+    {0.033214, 0.950323},
+    {0.043601, 0.960710},
+    {0.033214, 0.960710},
+    {0.050505, 0.971097},
+    {0.043601, 0.971097},
+    {0.033214, 0.971097},
+    {0.033214, 0.981484},
+    {0.050505, 0.981484},
+    {0.043601, 0.981484},
+    {0.043601, 0.991871},
+    {0.033214, 0.991871},
+    {0.012440, 0.950323},
+    {0.022827, 0.960710},
+    {0.012440, 0.960710},
+    {0.022827, 0.950323},
+    {0.022827, 0.971097},
+    {0.012440, 0.971097},
+    {0.064375, 0.960710},
+    {0.053988, 0.960710},
+    {0.074761, 0.950323},
+    {0.064375, 0.950323},
+    {0.075890, 0.972155},
+    {0.064375, 0.973013},
+    {0.049034, 0.947375},
+    {0.984513, 0.697236},
+    {0.109722, 0.052739},
+    {0.114343, 0.956117},
+    {0.029701, 0.939065},
+    {0.037537, 0.068918},
+    {0.067415, 0.989420},
+    {0.043345, 0.989420},
+    {0.028887, 0.960503},
+    {0.086720, 0.963170},
+    {0.053988, 0.919163},
+    {0.053988, 0.939937},
+    {0.050505, 0.991871},
+    {0.074761, 0.960710},
+};
+#define normals_count 594
+static const float normals[][3] = {
+    {-0.229800, -0.938200, 0.258900},
+    {-0.332100, 0.907400, 0.257700},
+    {-0.253300, -0.885000, -0.390600},
+    {-0.396000, 0.898300, -0.190300},
+    {0.229800, -0.938200, 0.258900},
+    {0.332100, 0.907400, 0.257700},
+    {0.253300, -0.885000, -0.390600},
+    {0.396000, 0.898300, -0.190300},
+    {-0.853500, 0.130300, -0.504500},
+    {-0.321800, -0.944800, -0.061600},
+    {-0.000000, -0.934700, -0.355400},
+    {-0.000000, 0.935600, -0.353000},
+    {0.853500, 0.130300, -0.504500},
+    {0.321800, -0.944800, -0.061600},
+    {0.299700, 0.939500, 0.165900},
+    {0.736200, 0.042700, 0.675400},
+    {-0.000000, -0.947600, 0.319500},
+    {-0.000000, 0.700000, 0.714200},
+    {-0.299700, 0.939500, 0.165900},
+    {-0.000000, -0.206000, -0.978500},
+    {0.975100, 0.137700, 0.173700},
+    {-0.000000, -0.100500, 0.994900},
+    {-0.000000, -0.991500, -0.130400},
+    {-0.000000, 0.972000, 0.234800},
+    {-0.736200, 0.042700, 0.675400},
+    {-0.295800, 0.903800, -0.309400},
+    {-0.403500, -0.864300, -0.300200},
+    {-0.330900, 0.847800, 0.414400},
+    {-0.486800, -0.836100, 0.253100},
+    {-0.975100, 0.137700, 0.173700},
+    {-0.000000, 0.891600, 0.452700},
+    {-0.000000, -0.930100, 0.367300},
+    {-0.849300, -0.099300, 0.518400},
+    {-0.397200, 0.916700, 0.044200},
+    {-0.361800, -0.906900, -0.216000},
+    {-0.734700, -0.023800, -0.678000},
+    {-0.000000, 0.904600, -0.426300},
+    {-0.000000, -0.735200, -0.677900},
+    {0.295800, 0.903800, -0.309400},
+    {-0.000000, 0.108200, 0.994100},
+    {-0.974800, -0.141000, -0.172900},
+    {-0.000000, -0.004100, -1.000000},
+    {-0.000000, 0.992100, 0.125100},
+    {-0.000000, -0.956700, -0.290900},
+    {0.403500, -0.864300, -0.300200},
+    {0.330900, 0.847800, 0.414400},
+    {0.486800, -0.836100, 0.253100},
+    {0.849300, -0.099300, 0.518400},
+    {0.397200, 0.916700, 0.044200},
+    {0.361800, -0.906900, -0.216000},
+    {0.734700, -0.023800, -0.678000},
+    {0.974800, -0.141000, -0.172900},
+    {0.392400, -0.623200, 0.676500},
+    {-0.191300, 0.426400, 0.884100},
+    {-0.325200, -0.783800, -0.529000},
+    {-0.908900, 0.265800, -0.321400},
+    {0.908900, -0.265800, 0.321400},
+    {0.325200, 0.783800, 0.529000},
+    {0.191300, -0.426400, -0.884100},
+    {-0.392400, 0.623200, -0.676500},
+    {-0.039100, -0.987200, 0.154800},
+    {0.055900, -0.163700, 0.984900},
+    {-0.810200, 0.399500, 0.429100},
+    {-0.808700, -0.357300, -0.467400},
+    {-0.069000, -0.651200, -0.755800},
+    {-0.697700, 0.479600, -0.532100},
+    {-0.055900, 0.163700, -0.984900},
+    {0.810200, -0.399500, -0.429100},
+    {0.039100, 0.987200, -0.154800},
+    {0.808700, 0.357300, 0.467400},
+    {0.697700, -0.479600, 0.532100},
+    {0.069000, 0.651200, 0.755800},
+    {-0.715800, -0.495400, 0.492100},
+    {-0.508200, -0.113800, -0.853700},
+    {0.715800, 0.495400, -0.492100},
+    {0.508200, 0.113800, 0.853700},
+    {0.478900, -0.861200, -0.170300},
+    {-0.478900, 0.861200, 0.170300},
+    {-0.392400, -0.623200, 0.676500},
+    {0.191300, 0.426400, 0.884100},
+    {0.325200, -0.783800, -0.529000},
+    {0.908900, 0.265800, -0.321400},
+    {-0.908900, -0.265800, 0.321400},
+    {-0.325200, 0.783800, 0.529000},
+    {-0.191300, -0.426400, -0.884100},
+    {0.392400, 0.623200, -0.676500},
+    {0.039100, -0.987200, 0.154800},
+    {-0.055900, -0.163700, 0.984900},
+    {0.810200, 0.399500, 0.429100},
+    {0.808700, -0.357300, -0.467400},
+    {0.069000, -0.651200, -0.755800},
+    {0.697700, 0.479600, -0.532100},
+    {0.055900, 0.163700, -0.984900},
+    {-0.810200, -0.399500, -0.429100},
+    {-0.039100, 0.987200, -0.154800},
+    {-0.808700, 0.357300, 0.467400},
+    {-0.697700, -0.479600, 0.532100},
+    {-0.069000, 0.651200, 0.755800},
+    {0.715800, -0.495400, 0.492100},
+    {0.508200, -0.113800, -0.853700},
+    {-0.715800, 0.495400, -0.492100},
+    {-0.508200, 0.113800, 0.853700},
+    {-0.478900, -0.861200, -0.170300},
+    {0.478900, 0.861200, 0.170300},
+    {0.574700, 0.377200, 0.726300},
+    {0.645400, -0.259800, 0.718300},
+    {-0.574700, 0.377200, 0.726300},
+    {-0.645400, -0.259800, 0.718300},
+    {0.533200, 0.714100, -0.453600},
+    {0.679000, -0.266800, -0.684000},
+    {-0.533200, 0.714100, -0.453600},
+    {-0.679000, -0.266800, -0.684000},
+    {0.333300, -0.860900, -0.384400},
+    {-0.333300, -0.860900, -0.384400},
+    {0.233400, -0.912800, 0.335100},
+    {-0.233400, -0.912800, 0.335100},
+    {-0.000000, -0.244800, -0.969600},
+    {-0.000000, 0.840200, -0.542200},
+    {-0.000000, -0.233700, 0.972300},
+    {-0.000000, -0.947900, -0.318600},
+    {-0.000000, 0.449600, 0.893200},
+    {0.955600, -0.292000, -0.040100},
+    {0.709000, 0.677900, 0.194500},
+    {0.210300, -0.977600, -0.013000},
+    {-0.000000, -0.999900, 0.013000},
+    {-0.000000, 0.947500, 0.319700},
+    {0.638200, 0.281200, -0.716700},
+    {0.658100, 0.182700, -0.730400},
+    {-0.000000, 0.351900, -0.936000},
+    {-0.000000, 0.175900, -0.984400},
+    {-0.000000, -0.975400, 0.220300},
+    {-0.955600, -0.292000, -0.040100},
+    {-0.709000, 0.677900, 0.194500},
+    {0.974800, 0.216000, -0.056700},
+    {0.979000, 0.203500, -0.009100},
+    {0.698500, 0.060900, 0.713100},
+    {0.675600, 0.336000, 0.656200},
+    {-0.000000, 0.057900, 0.998300},
+    {-0.000000, 0.352700, 0.935700},
+    {-0.210300, -0.977600, -0.013000},
+    {0.678500, 0.157300, -0.717500},
+    {-0.000000, 0.117700, -0.993000},
+    {-0.000000, 0.398500, 0.917200},
+    {-0.638200, 0.281200, -0.716700},
+    {-0.658100, 0.182700, -0.730400},
+    {0.974300, 0.217100, -0.059500},
+    {0.653300, 0.414800, 0.633400},
+    {-0.974800, 0.216000, -0.056700},
+    {-0.979000, 0.203500, -0.009100},
+    {-0.698500, 0.060900, 0.713100},
+    {-0.675600, 0.336000, 0.656200},
+    {-0.678500, 0.157300, -0.717500},
+    {-0.974300, 0.217100, -0.059500},
+    {-0.653300, 0.414800, 0.633400},
+    {0.259200, 0.814400, -0.519200},
+    {0.567600, -0.575000, -0.589200},
+    {0.342600, -0.251700, -0.905100},
+    {0.156800, -0.923700, -0.349600},
+    {-0.000000, -0.613400, -0.789800},
+    {0.884900, -0.280800, -0.371600},
+    {-0.884900, -0.280800, -0.371600},
+    {0.279200, -0.949800, -0.141100},
+    {-0.000000, -0.998600, 0.052400},
+    {-0.700200, -0.004900, -0.713900},
+    {0.661300, 0.738200, -0.133000},
+    {-0.883000, 0.242800, -0.401600},
+    {-0.000000, 0.994700, -0.103000},
+    {-0.567600, -0.575000, -0.589200},
+    {0.363000, 0.885600, 0.289600},
+    {-0.651800, 0.179100, -0.736900},
+    {0.705100, -0.708900, -0.015500},
+    {-0.611200, 0.480600, -0.628800},
+    {-0.101700, -0.994800, -0.000000},
+    {0.910600, 0.406300, 0.076100},
+    {0.611200, 0.480600, -0.628800},
+    {0.651800, 0.179100, -0.736900},
+    {0.700200, -0.004900, -0.713900},
+    {-0.000000, 0.571300, -0.820700},
+    {-0.000000, 0.220400, -0.975400},
+    {-0.000000, -0.003800, -1.000000},
+    {0.401900, 0.355300, 0.843900},
+    {-0.000000, 0.158200, 0.987400},
+    {-0.957300, 0.283400, -0.057300},
+    {-0.675700, 0.555700, 0.484400},
+    {0.957300, 0.283400, -0.057300},
+    {0.988600, 0.143000, -0.047000},
+    {-0.000000, 0.124300, 0.992200},
+    {0.349400, 0.177800, -0.920000},
+    {0.316200, 0.328000, -0.890200},
+    {-0.988600, 0.143000, -0.047000},
+    {0.883000, 0.242800, -0.401600},
+    {0.875800, 0.190200, -0.443600},
+    {0.704200, 0.114300, 0.700800},
+    {-0.000000, 0.178900, 0.983900},
+    {0.664600, 0.168100, 0.728100},
+    {-0.279200, -0.949800, -0.141100},
+    {0.481100, -0.647700, 0.590700},
+    {-0.000000, -0.690100, 0.723700},
+    {0.072300, -0.958100, 0.277100},
+    {0.298700, 0.429500, 0.852300},
+    {0.263300, -0.234000, 0.935900},
+    {0.688600, 0.152400, 0.709000},
+    {0.400900, 0.046800, 0.914900},
+    {-0.704200, 0.114300, 0.700800},
+    {-0.000000, 0.749700, 0.661800},
+    {-0.875800, 0.190200, -0.443600},
+    {0.675700, 0.555700, 0.484400},
+    {-0.661300, 0.738200, -0.133000},
+    {0.889600, 0.274800, 0.364800},
+    {0.906000, 0.131100, 0.402500},
+    {-0.481100, -0.647700, 0.590700},
+    {0.659700, 0.210300, -0.721500},
+    {-0.000000, 0.161600, -0.986900},
+    {-0.000000, 0.485500, 0.874200},
+    {0.997900, 0.024400, -0.059200},
+    {0.634700, 0.483300, 0.603000},
+    {0.900800, 0.173400, -0.398200},
+    {-0.664600, 0.168100, 0.728100},
+    {0.292100, 0.424900, 0.856800},
+    {-0.688600, 0.152400, 0.709000},
+    {0.343800, 0.132800, -0.929600},
+    {0.902500, 0.317000, 0.291700},
+    {-0.910600, 0.406300, 0.076100},
+    {0.215300, -0.962700, 0.163900},
+    {0.899000, -0.294500, 0.324200},
+    {-0.705100, -0.708900, -0.015500},
+    {-0.000000, -0.999800, -0.020800},
+    {-0.889600, 0.274800, 0.364800},
+    {-0.906000, 0.131100, 0.402500},
+    {-0.659700, 0.210300, -0.721500},
+    {-0.997900, 0.024400, -0.059200},
+    {-0.634700, 0.483300, 0.603000},
+    {-0.900800, 0.173400, -0.398200},
+    {-0.902500, 0.317000, 0.291700},
+    {-0.215300, -0.962700, 0.163900},
+    {-0.899000, -0.294500, 0.324200},
+    {0.101700, -0.994800, -0.000000},
+    {-0.342600, -0.251700, -0.905100},
+    {-0.156800, -0.923700, -0.349600},
+    {-0.363000, 0.885600, 0.289600},
+    {-0.401900, 0.355300, 0.843900},
+    {-0.263300, -0.234000, 0.935900},
+    {-0.259200, 0.814400, -0.519200},
+    {-0.316200, 0.328000, -0.890200},
+    {-0.349400, 0.177800, -0.920000},
+    {-0.298700, 0.429500, 0.852300},
+    {-0.072300, -0.958100, 0.277100},
+    {-0.400900, 0.046800, 0.914900},
+    {-0.292100, 0.424900, 0.856800},
+    {-0.343800, 0.132800, -0.929600},
+    {-0.292300, -0.599400, -0.745200},
+    {-0.273800, 0.543500, -0.793500},
+    {0.292300, -0.599400, -0.745200},
+    {-0.044400, -0.997900, 0.047600},
+    {0.910400, 0.125100, 0.394300},
+    {-0.341200, 0.208900, -0.916500},
+    {-0.948400, 0.086100, 0.305200},
+    {-0.700900, -0.647500, -0.299100},
+    {0.948400, 0.086100, 0.305200},
+    {-0.332000, 0.502400, 0.798400},
+    {0.344700, 0.178200, -0.921700},
+    {-0.876800, 0.235700, -0.419100},
+    {0.273800, 0.543500, -0.793500},
+    {0.328100, 0.939300, -0.099900},
+    {-0.910400, 0.125100, 0.394300},
+    {-0.328100, 0.939300, -0.099900},
+    {0.429000, 0.117200, 0.895700},
+    {0.700900, -0.647500, -0.299100},
+    {-0.429000, 0.117200, 0.895700},
+    {-0.013800, -0.999800, -0.013500},
+    {-0.335700, 0.715200, 0.613000},
+    {0.332000, 0.502400, 0.798400},
+    {0.044400, -0.997900, 0.047600},
+    {0.190000, -0.665600, 0.721700},
+    {0.335700, 0.715200, 0.613000},
+    {-0.844700, 0.452100, -0.286500},
+    {-0.282700, 0.169200, 0.944200},
+    {0.341200, 0.208900, -0.916500},
+    {0.657100, -0.698400, 0.283700},
+    {-0.657100, -0.698400, 0.283700},
+    {-0.349000, 0.158100, 0.923700},
+    {-0.190000, -0.665600, 0.721700},
+    {0.922300, -0.004200, -0.386500},
+    {0.013800, -0.999800, -0.013500},
+    {0.844700, 0.452100, -0.286500},
+    {0.882600, 0.154800, -0.443800},
+    {0.349000, 0.158100, 0.923700},
+    {-0.922300, -0.004200, -0.386500},
+    {0.858000, 0.293100, 0.421900},
+    {0.876800, 0.235700, -0.419100},
+    {-0.858000, 0.293100, 0.421900},
+    {-0.349800, -0.002400, -0.936800},
+    {-0.882600, 0.154800, -0.443800},
+    {0.282700, 0.169200, 0.944200},
+    {-0.867900, 0.385800, 0.313100},
+    {0.349800, -0.002400, -0.936800},
+    {0.867900, 0.385800, 0.313100},
+    {-0.344700, 0.178200, -0.921700},
+    {-0.574400, -0.379700, -0.725200},
+    {-0.646100, 0.259500, -0.717800},
+    {0.574400, -0.379700, -0.725200},
+    {0.646100, 0.259500, -0.717800},
+    {-0.539000, -0.704000, 0.462400},
+    {-0.678200, 0.268600, 0.684100},
+    {0.539000, -0.704000, 0.462400},
+    {0.678200, 0.268600, 0.684100},
+    {-0.341500, 0.864800, 0.368100},
+    {0.341500, 0.864800, 0.368100},
+    {-0.237900, 0.910000, -0.339600},
+    {0.237900, 0.910000, -0.339600},
+    {-0.000000, 0.249000, 0.968500},
+    {-0.000000, -0.842400, 0.538900},
+    {-0.000000, 0.237100, -0.971500},
+    {-0.000000, 0.944700, 0.327900},
+    {-0.000000, -0.451800, -0.892100},
+    {-0.954200, 0.296800, 0.038800},
+    {-0.707500, -0.679800, -0.193400},
+    {-0.222900, 0.974800, 0.012700},
+    {-0.000000, 0.999900, -0.011600},
+    {-0.000000, -0.948100, -0.317800},
+    {-0.638800, -0.282600, 0.715600},
+    {-0.657200, -0.182900, 0.731200},
+    {-0.000000, -0.352900, 0.935600},
+    {-0.000000, -0.176000, 0.984400},
+    {-0.000000, 0.966500, -0.256500},
+    {0.954200, 0.296800, 0.038800},
+    {0.707500, -0.679800, -0.193400},
+    {-0.974700, -0.216200, 0.056700},
+    {-0.978800, -0.204400, 0.008700},
+    {-0.700100, -0.061500, -0.711400},
+    {-0.678000, -0.335800, -0.653800},
+    {-0.000000, -0.057900, -0.998300},
+    {-0.000000, -0.352000, -0.936000},
+    {0.222900, 0.974800, 0.012700},
+    {-0.678800, -0.156100, 0.717600},
+    {-0.000000, -0.117000, 0.993100},
+    {-0.000000, -0.405100, -0.914300},
+    {0.638800, -0.282600, 0.715600},
+    {0.657200, -0.182900, 0.731200},
+    {-0.974600, -0.216100, 0.058100},
+    {-0.654100, -0.412500, -0.634000},
+    {0.974700, -0.216200, 0.056700},
+    {0.978800, -0.204400, 0.008700},
+    {0.700100, -0.061500, -0.711400},
+    {0.678000, -0.335800, -0.653800},
+    {0.678800, -0.156100, 0.717600},
+    {0.974600, -0.216100, 0.058100},
+    {0.654100, -0.412500, -0.634000},
+    {-0.253100, -0.814600, 0.521800},
+    {-0.573800, 0.571400, 0.586700},
+    {-0.343700, 0.254700, 0.903900},
+    {-0.145200, 0.925400, 0.350100},
+    {-0.000000, 0.616400, 0.787400},
+    {-0.883900, 0.283800, 0.371700},
+    {0.883900, 0.283800, 0.371700},
+    {-0.286200, 0.947500, 0.142800},
+    {-0.000000, 0.999200, -0.040600},
+    {0.700100, 0.006800, 0.714000},
+    {-0.665400, -0.735300, 0.128600},
+    {0.883200, -0.243800, 0.400700},
+    {-0.000000, -0.994600, 0.103900},
+    {0.573800, 0.571400, 0.586700},
+    {-0.364100, -0.886000, -0.287200},
+    {0.651600, -0.179700, 0.737000},
+    {-0.705100, 0.709000, 0.015700},
+    {0.611400, -0.482200, 0.627400},
+    {0.092200, 0.995700, 0.001200},
+    {-0.909500, -0.408600, -0.076900},
+    {-0.611400, -0.482200, 0.627400},
+    {-0.651600, -0.179700, 0.737000},
+    {-0.700100, 0.006800, 0.714000},
+    {-0.000000, -0.574600, 0.818400},
+    {-0.000000, -0.220900, 0.975300},
+    {-0.000000, 0.005800, 1.000000},
+    {-0.399100, -0.355400, -0.845200},
+    {-0.000000, -0.148000, -0.989000},
+    {0.957500, -0.283100, 0.056100},
+    {0.674400, -0.557100, -0.484600},
+    {-0.957500, -0.283100, 0.056100},
+    {-0.988500, -0.143600, 0.047500},
+    {-0.000000, -0.122400, -0.992500},
+    {-0.348600, -0.177900, 0.920200},
+    {-0.318300, -0.329200, 0.889000},
+    {0.988500, -0.143600, 0.047500},
+    {-0.883200, -0.243800, 0.400700},
+    {-0.876100, -0.190600, 0.442800},
+    {-0.706600, -0.113100, -0.698500},
+    {-0.000000, -0.181900, -0.983300},
+    {-0.665600, -0.170900, -0.726500},
+    {0.286200, 0.947500, 0.142800},
+    {-0.483600, 0.645300, -0.591400},
+    {-0.000000, 0.688600, -0.725200},
+    {-0.089200, 0.950400, -0.298000},
+    {-0.298900, -0.432500, -0.850700},
+    {-0.266800, 0.235500, -0.934500},
+    {-0.689100, -0.148700, -0.709200},
+    {-0.399200, -0.046600, -0.915700},
+    {0.706600, -0.113100, -0.698500},
+    {-0.000000, -0.750400, -0.661000},
+    {0.876100, -0.190600, 0.442800},
+    {-0.674400, -0.557100, -0.484600},
+    {0.665400, -0.735300, 0.128600},
+    {-0.891500, -0.274700, -0.360100},
+    {-0.907100, -0.132700, -0.399500},
+    {0.483600, 0.645300, -0.591400},
+    {-0.659500, -0.210000, 0.721800},
+    {-0.000000, -0.161400, 0.986900},
+    {-0.000000, -0.485500, -0.874200},
+    {-0.998100, -0.022200, 0.057600},
+    {-0.635800, -0.483300, -0.601800},
+    {-0.900700, -0.172300, 0.398800},
+    {0.665600, -0.170900, -0.726500},
+    {-0.299500, -0.426300, -0.853600},
+    {0.689100, -0.148700, -0.709200},
+    {-0.345400, -0.131900, 0.929100},
+    {-0.902200, -0.315200, -0.294300},
+    {0.909500, -0.408600, -0.076900},
+    {-0.223300, 0.960700, -0.165100},
+    {-0.897700, 0.295600, -0.326600},
+    {0.705100, 0.709000, 0.015700},
+    {-0.000000, 0.999200, 0.039100},
+    {0.891500, -0.274700, -0.360100},
+    {0.907100, -0.132700, -0.399500},
+    {0.659500, -0.210000, 0.721800},
+    {0.998100, -0.022200, 0.057600},
+    {0.635800, -0.483300, -0.601800},
+    {0.900700, -0.172300, 0.398800},
+    {0.902200, -0.315200, -0.294300},
+    {0.223300, 0.960700, -0.165100},
+    {0.897700, 0.295600, -0.326600},
+    {-0.092200, 0.995700, 0.001200},
+    {0.343700, 0.254700, 0.903900},
+    {0.145200, 0.925400, 0.350100},
+    {0.364100, -0.886000, -0.287200},
+    {0.399100, -0.355400, -0.845200},
+    {0.266800, 0.235500, -0.934500},
+    {0.253100, -0.814600, 0.521800},
+    {0.318300, -0.329200, 0.889000},
+    {0.348600, -0.177900, 0.920200},
+    {0.298900, -0.432500, -0.850700},
+    {0.089200, 0.950400, -0.298000},
+    {0.399200, -0.046600, -0.915700},
+    {0.299500, -0.426300, -0.853600},
+    {0.345400, -0.131900, 0.929100},
+    {0.288200, 0.597300, 0.748400},
+    {0.276500, -0.546100, 0.790700},
+    {-0.288200, 0.597300, 0.748400},
+    {0.026800, 0.998900, -0.038000},
+    {-0.912800, -0.125300, -0.388800},
+    {0.341400, -0.209500, 0.916300},
+    {0.947400, -0.083200, -0.309000},
+    {0.699900, 0.648700, 0.299000},
+    {-0.947400, -0.083200, -0.309000},
+    {0.332300, -0.502400, -0.798200},
+    {-0.345300, -0.178000, 0.921500},
+    {0.876900, -0.235500, 0.419100},
+    {-0.276500, -0.546100, 0.790700},
+    {-0.325200, -0.940800, 0.095900},
+    {0.912800, -0.125300, -0.388800},
+    {0.325200, -0.940800, 0.095900},
+    {-0.425700, -0.115400, -0.897500},
+    {-0.699900, 0.648700, 0.299000},
+    {0.425700, -0.115400, -0.897500},
+    {0.008000, 0.999800, 0.019400},
+    {0.336200, -0.716500, -0.611200},
+    {-0.332300, -0.502400, -0.798200},
+    {-0.026800, 0.998900, -0.038000},
+    {-0.193100, 0.662600, -0.723700},
+    {-0.336200, -0.716500, -0.611200},
+    {0.843300, -0.454800, 0.286400},
+    {0.291200, -0.161600, -0.942900},
+    {-0.341400, -0.209500, 0.916300},
+    {-0.659600, 0.695600, -0.284900},
+    {0.659600, 0.695600, -0.284900},
+    {0.348200, -0.160900, -0.923500},
+    {0.193100, 0.662600, -0.723700},
+    {-0.921900, 0.006000, 0.387400},
+    {-0.008000, 0.999800, 0.019400},
+    {-0.843300, -0.454800, 0.286400},
+    {-0.883300, -0.155300, 0.442300},
+    {-0.348200, -0.160900, -0.923500},
+    {0.921900, 0.006000, 0.387400},
+    {-0.857600, -0.295900, -0.420600},
+    {-0.876900, -0.235500, 0.419100},
+    {0.857600, -0.295900, -0.420600},
+    {0.351400, 0.004400, 0.936200},
+    {0.883300, -0.155300, 0.442300},
+    {-0.291200, -0.161600, -0.942900},
+    {0.868000, -0.385500, -0.313000},
+    {-0.351400, 0.004400, 0.936200},
+    {-0.868000, -0.385500, -0.313000},
+    {0.345300, -0.178000, 0.921500},
+    {-0.480600, -0.873000, -0.083100},
+    {-0.810500, 0.582600, -0.061200},
+    {-0.168300, -0.873000, -0.457800},
+    {-0.211400, 0.586400, -0.781900},
+    {0.168300, -0.873000, 0.457800},
+    {0.206300, 0.582600, 0.786200},
+    {0.480600, -0.873000, 0.083100},
+    {0.807200, 0.586400, 0.067000},
+    {-0.333700, -0.900700, -0.278100},
+    {-0.986500, -0.161700, -0.026900},
+    {-0.634400, 0.693300, -0.341900},
+    {-0.209000, -0.270700, -0.939700},
+    {0.203600, -0.948100, -0.244300},
+    {0.428000, 0.743700, -0.513500},
+    {0.962000, -0.270700, 0.036200},
+    {0.333700, -0.900700, 0.278100},
+    {0.450600, 0.693300, 0.562300},
+    {0.204300, -0.161700, 0.965500},
+    {-0.203600, -0.948100, 0.244300},
+    {-0.426800, 0.745300, 0.512200},
+    {-0.752200, -0.259900, -0.605400},
+    {0.617400, -0.264700, -0.740800},
+    {0.731100, -0.259900, 0.630800},
+    {-0.633100, -0.148400, 0.759700},
+    {-0.000000, -1.000000, -0.000000},
+    {-0.118700, 0.982700, 0.142500},
+    {0.480600, -0.873000, -0.083100},
+    {0.810500, 0.582600, -0.061200},
+    {0.168300, -0.873000, -0.457800},
+    {0.211400, 0.586400, -0.781900},
+    {-0.168300, -0.873000, 0.457800},
+    {-0.206300, 0.582600, 0.786200},
+    {-0.480600, -0.873000, 0.083100},
+    {-0.807200, 0.586400, 0.067000},
+    {0.333700, -0.900700, -0.278100},
+    {0.986500, -0.161700, -0.026900},
+    {0.634400, 0.693300, -0.341900},
+    {0.209000, -0.270700, -0.939700},
+    {-0.203600, -0.948100, -0.244300},
+    {-0.428000, 0.743700, -0.513500},
+    {-0.962000, -0.270700, 0.036200},
+    {-0.333700, -0.900700, 0.278100},
+    {-0.450600, 0.693300, 0.562300},
+    {-0.204300, -0.161700, 0.965500},
+    {0.203600, -0.948100, 0.244300},
+    {0.426800, 0.745300, 0.512200},
+    {0.752200, -0.259900, -0.605400},
+    {-0.617400, -0.264700, -0.740800},
+    {-0.731100, -0.259900, 0.630800},
+    {0.633100, -0.148400, 0.759700},
+    {0.118700, 0.982700, 0.142500},
+    {0.523400, 0.849800, 0.062800},
+    {0.845300, -0.533100, 0.035400},
+    {0.157900, 0.855000, 0.494000},
+    {0.228100, -0.589700, 0.774700},
+    {-0.156100, 0.849800, -0.503500},
+    {-0.187200, -0.533100, -0.825100},
+    {-0.514400, 0.855000, -0.066300},
+    {-0.803200, -0.589700, -0.084700},
+    {0.359200, 0.883800, 0.299700},
+    {0.984600, 0.173500, 0.023200},
+    {0.632300, -0.692200, 0.348100},
+    {0.215500, 0.264100, 0.940100},
+    {-0.240500, 0.926700, 0.288600},
+    {-0.419800, -0.755000, 0.503800},
+    {-0.963600, 0.264100, -0.042500},
+    {-0.359500, 0.883800, -0.299300},
+    {-0.456300, -0.692200, -0.559200},
+    {-0.200300, 0.173500, -0.964300},
+    {0.249200, 0.921100, -0.299000},
+    {0.458200, -0.698500, -0.549700},
+    {0.755100, 0.233900, 0.612500},
+    {-0.618200, 0.259900, 0.741800},
+    {-0.738600, 0.233900, -0.632300},
+    {0.633400, 0.145900, -0.760000},
+    {-0.000000, 1.000000, -0.000000},
+    {0.114800, -0.983800, -0.137700},
+    {-0.523400, 0.849800, 0.062800},
+    {-0.845300, -0.533100, 0.035400},
+    {-0.157900, 0.855000, 0.494000},
+    {-0.228100, -0.589700, 0.774700},
+    {0.156100, 0.849800, -0.503500},
+    {0.187200, -0.533100, -0.825100},
+    {0.514400, 0.855000, -0.066300},
+    {0.803200, -0.589700, -0.084700},
+    {-0.359200, 0.883800, 0.299700},
+    {-0.984600, 0.173500, 0.023200},
+    {-0.632300, -0.692200, 0.348100},
+    {-0.215500, 0.264100, 0.940100},
+    {0.240500, 0.926700, 0.288600},
+    {0.419800, -0.755000, 0.503800},
+    {0.963600, 0.264100, -0.042500},
+    {0.359500, 0.883800, -0.299300},
+    {0.456300, -0.692200, -0.559200},
+    {0.200300, 0.173500, -0.964300},
+    {-0.249200, 0.921100, -0.299000},
+    {-0.458200, -0.698500, -0.549700},
+    {-0.755100, 0.233900, 0.612500},
+    {0.618200, 0.259900, 0.741800},
+    {0.738600, 0.233900, -0.632300},
+    {-0.633400, 0.145900, -0.760000},
+    {-0.114800, -0.983800, -0.137700},
+};
+#define faces_count 1152
+static const int faces[1152][9] = {
+    {22, 2, 10, 0, 1, 2, 22, 2, 10},
+    {21, 1, 24, 3, 4, 5, 21, 1, 24},
+    {7, 23, 14, 6, 7, 8, 7, 23, 14},
+    {2, 29, 8, 1, 9, 10, 2, 29, 8},
+    {0, 21, 24, 11, 3, 5, 0, 21, 24},
+    {1, 23, 18, 4, 7, 8, 1, 23, 18},
+    {3, 23, 11, 6, 7, 12, 3, 23, 11},
+    {2, 19, 10, 1, 13, 2, 2, 19, 10},
+    {19, 7, 12, 13, 6, 10, 19, 7, 12},
+    {6, 19, 12, 1, 13, 10, 6, 19, 12},
+    {22, 0, 9, 0, 11, 14, 22, 0, 9},
+    {20, 5, 15, 9, 4, 5, 20, 5, 15},
+    {13, 15, 4, 14, 5, 11, 13, 15, 4},
+    {7, 20, 12, 6, 9, 10, 7, 20, 12},
+    {5, 23, 17, 4, 7, 15, 5, 23, 17},
+    {29, 1, 18, 9, 4, 8, 29, 1, 18},
+    {22, 4, 16, 0, 11, 16, 22, 4, 16},
+    {6, 22, 10, 1, 0, 2, 6, 22, 10},
+    {19, 3, 11, 13, 6, 12, 19, 3, 11},
+    {24, 9, 0, 5, 14, 11, 24, 9, 0},
+    {4, 21, 16, 11, 3, 16, 4, 21, 16},
+    {5, 21, 15, 4, 3, 5, 5, 21, 15},
+    {29, 3, 8, 9, 6, 10, 29, 3, 8},
+    {6, 20, 13, 1, 9, 14, 6, 20, 13},
+    {45, 42, 30, 17, 18, 19, 45, 42, 30},
+    {44, 41, 50, 20, 21, 22, 44, 41, 50},
+    {34, 31, 28, 23, 24, 25, 34, 31, 28},
+    {45, 51, 48, 17, 26, 27, 45, 51, 48},
+    {38, 41, 36, 28, 21, 29, 38, 41, 36},
+    {44, 43, 37, 20, 30, 31, 44, 43, 37},
+    {31, 49, 46, 24, 23, 25, 31, 49, 46},
+    {45, 39, 47, 17, 32, 33, 45, 39, 47},
+    {39, 28, 31, 32, 25, 24, 39, 28, 31},
+    {27, 39, 30, 17, 32, 19, 27, 39, 30},
+    {42, 38, 36, 18, 28, 29, 42, 38, 36},
+    {40, 26, 34, 26, 20, 23, 40, 26, 34},
+    {25, 40, 33, 28, 26, 27, 25, 40, 33},
+    {40, 28, 32, 26, 25, 33, 40, 28, 32},
+    {26, 43, 34, 20, 30, 23, 26, 43, 34},
+    {51, 44, 50, 26, 20, 22, 51, 44, 50},
+    {42, 25, 33, 18, 28, 27, 42, 25, 33},
+    {42, 27, 30, 18, 17, 19, 42, 27, 30},
+    {39, 46, 47, 32, 25, 33, 39, 46, 47},
+    {38, 51, 50, 28, 26, 22, 38, 51, 50},
+    {25, 41, 35, 28, 21, 22, 25, 41, 35},
+    {41, 26, 35, 21, 20, 22, 41, 26, 35},
+    {46, 51, 47, 25, 26, 33, 46, 51, 47},
+    {27, 40, 32, 17, 26, 33, 27, 40, 32},
+    {60, 61, 72, 34, 35, 36, 60, 61, 72},
+    {61, 62, 72, 35, 37, 36, 61, 62, 72},
+    {59, 77, 68, 38, 39, 40, 59, 77, 68},
+    {62, 63, 72, 41, 42, 43, 62, 63, 72},
+    {60, 63, 54, 44, 42, 45, 60, 63, 54},
+    {102, 84, 90, 46, 47, 48, 102, 84, 90},
+    {54, 76, 60, 45, 49, 44, 54, 76, 60},
+    {103, 79, 88, 50, 51, 52, 103, 79, 88},
+    {73, 59, 66, 53, 38, 54, 73, 59, 66},
+    {102, 78, 96, 55, 56, 57, 102, 78, 96},
+    {58, 73, 66, 58, 53, 54, 58, 73, 66},
+    {101, 78, 87, 59, 56, 60, 101, 78, 87},
+    {54, 73, 64, 45, 53, 61, 54, 73, 64},
+    {68, 69, 74, 62, 63, 64, 68, 69, 74},
+    {67, 69, 56, 65, 63, 66, 67, 69, 56},
+    {66, 68, 74, 54, 40, 67, 66, 68, 74},
+    {57, 77, 71, 68, 69, 70, 57, 77, 71},
+    {99, 80, 90, 71, 72, 48, 99, 80, 90},
+    {76, 56, 70, 73, 66, 74, 76, 56, 70},
+    {58, 76, 64, 58, 49, 61, 58, 76, 64},
+    {102, 82, 93, 55, 75, 76, 102, 82, 93},
+    {101, 79, 97, 59, 51, 77, 101, 79, 97},
+    {86, 87, 78, 78, 60, 56, 86, 87, 78},
+    {99, 81, 89, 71, 79, 80, 99, 81, 89},
+    {87, 88, 79, 60, 52, 51, 87, 88, 79},
+    {101, 83, 95, 59, 81, 82, 101, 83, 95},
+    {88, 89, 81, 83, 80, 79, 88, 89, 81},
+    {103, 81, 91, 84, 79, 85, 103, 81, 91},
+    {86, 89, 98, 86, 80, 87, 86, 89, 98},
+    {102, 80, 86, 46, 72, 86, 102, 80, 86},
+    {85, 99, 92, 88, 71, 89, 85, 99, 92},
+    {103, 85, 94, 84, 88, 90, 103, 85, 94},
+    {99, 84, 92, 71, 47, 89, 99, 84, 92},
+    {55, 73, 63, 91, 53, 42, 55, 73, 63},
+    {94, 95, 83, 92, 82, 81, 94, 95, 83},
+    {103, 83, 97, 50, 81, 77, 103, 83, 97},
+    {93, 95, 100, 76, 82, 93, 93, 95, 100},
+    {94, 92, 100, 90, 89, 94, 94, 92, 100},
+    {53, 75, 71, 95, 96, 70, 53, 75, 71},
+    {101, 82, 96, 59, 75, 57, 101, 82, 96},
+    {93, 92, 84, 97, 89, 47, 93, 92, 84},
+    {52, 76, 70, 98, 73, 74, 52, 76, 70},
+    {75, 52, 70, 96, 98, 74, 75, 52, 70},
+    {55, 77, 65, 91, 39, 99, 55, 77, 65},
+    {56, 75, 70, 66, 96, 74, 56, 75, 70},
+    {57, 75, 69, 68, 96, 63, 57, 75, 69},
+    {77, 53, 71, 69, 95, 70, 77, 53, 71},
+    {66, 67, 58, 54, 100, 58, 66, 67, 58},
+    {116, 250, 237, 101, 102, 103, 116, 250, 237},
+    {119, 250, 158, 104, 102, 105, 119, 250, 158},
+    {238, 167, 250, 106, 107, 102, 238, 167, 250},
+    {250, 111, 237, 102, 108, 103, 250, 111, 237},
+    {128, 251, 177, 109, 110, 111, 128, 251, 177},
+    {243, 171, 251, 112, 113, 110, 243, 171, 251},
+    {251, 110, 242, 110, 114, 115, 251, 110, 242},
+    {177, 242, 117, 111, 115, 116, 177, 242, 117},
+    {116, 252, 158, 101, 117, 105, 116, 252, 158},
+    {109, 252, 156, 118, 117, 119, 109, 252, 156},
+    {155, 157, 252, 120, 121, 117, 155, 157, 252},
+    {252, 119, 158, 117, 104, 105, 252, 119, 158},
+    {114, 253, 223, 122, 123, 124, 114, 253, 223},
+    {198, 226, 253, 125, 126, 123, 198, 226, 253},
+    {226, 172, 253, 126, 127, 123, 226, 172, 253},
+    {253, 123, 223, 123, 128, 124, 253, 123, 223},
+    {209, 185, 134, 129, 130, 131, 209, 185, 134},
+    {135, 254, 209, 132, 133, 129, 135, 254, 209},
+    {192, 208, 254, 134, 135, 133, 192, 208, 254},
+    {254, 133, 185, 133, 136, 130, 254, 133, 185},
+    {129, 255, 178, 137, 138, 139, 129, 255, 178},
+    {244, 169, 255, 140, 141, 138, 244, 169, 255},
+    {169, 243, 255, 141, 112, 138, 169, 243, 255},
+    {178, 243, 128, 139, 112, 109, 178, 243, 128},
+    {230, 233, 152, 142, 143, 144, 230, 233, 152},
+    {131, 256, 230, 145, 146, 142, 131, 256, 230},
+    {235, 219, 256, 147, 148, 146, 235, 219, 256},
+    {256, 153, 233, 146, 149, 143, 256, 153, 233},
+    {167, 160, 111, 107, 150, 108, 167, 160, 111},
+    {113, 257, 167, 151, 152, 107, 113, 257, 167},
+    {257, 139, 225, 152, 153, 154, 257, 139, 225},
+    {257, 131, 160, 152, 155, 150, 257, 131, 160},
+    {221, 214, 145, 156, 157, 158, 221, 214, 145},
+    {146, 258, 221, 159, 160, 156, 146, 258, 221},
+    {201, 224, 258, 161, 162, 160, 201, 224, 258},
+    {258, 121, 214, 160, 163, 157, 258, 121, 214},
+    {213, 248, 142, 164, 165, 166, 213, 248, 142},
+    {138, 259, 213, 167, 168, 164, 138, 259, 213},
+    {240, 231, 259, 169, 170, 168, 240, 231, 259},
+    {259, 153, 248, 168, 149, 165, 259, 153, 248},
+    {141, 260, 220, 171, 172, 173, 141, 260, 220},
+    {212, 187, 260, 174, 175, 172, 212, 187, 260},
+    {260, 127, 211, 172, 176, 177, 260, 127, 211},
+    {220, 211, 140, 173, 177, 178, 220, 211, 140},
+    {147, 261, 182, 179, 180, 181, 147, 261, 182},
+    {205, 229, 261, 182, 183, 180, 205, 229, 261},
+    {261, 151, 232, 180, 184, 185, 261, 151, 232},
+    {182, 232, 152, 181, 185, 186, 182, 232, 152},
+    {128, 262, 188, 109, 187, 188, 128, 262, 188},
+    {177, 154, 262, 111, 189, 187, 177, 154, 262},
+    {262, 108, 174, 187, 190, 191, 262, 108, 174},
+    {188, 174, 126, 188, 191, 192, 188, 174, 126},
+    {122, 263, 168, 193, 194, 195, 122, 263, 168},
+    {164, 154, 263, 196, 189, 194, 164, 154, 263},
+    {263, 117, 166, 194, 116, 197, 263, 117, 166},
+    {168, 166, 125, 195, 197, 198, 168, 166, 125},
+    {189, 228, 148, 199, 200, 201, 189, 228, 148},
+    {147, 264, 189, 202, 203, 199, 147, 264, 189},
+    {227, 203, 264, 204, 205, 203, 227, 203, 264},
+    {264, 149, 228, 203, 206, 200, 264, 149, 228},
+    {132, 265, 207, 207, 208, 209, 132, 265, 207},
+    {239, 166, 265, 210, 197, 208, 239, 166, 265},
+    {265, 117, 242, 208, 116, 115, 265, 117, 242},
+    {207, 242, 110, 209, 115, 114, 207, 242, 110},
+    {180, 186, 138, 211, 212, 167, 180, 186, 138},
+    {136, 266, 180, 213, 214, 211, 136, 266, 180},
+    {266, 135, 202, 214, 132, 215, 266, 135, 202},
+    {186, 202, 137, 212, 215, 216, 186, 202, 137},
+    {159, 155, 109, 217, 120, 118, 159, 155, 109},
+    {121, 267, 159, 218, 219, 217, 121, 267, 159},
+    {267, 123, 161, 219, 220, 221, 267, 123, 161},
+    {267, 112, 155, 219, 222, 120, 267, 112, 155},
+    {186, 240, 138, 212, 169, 167, 186, 240, 138},
+    {186, 247, 268, 212, 223, 224, 186, 247, 268},
+    {268, 149, 203, 224, 206, 205, 268, 149, 203},
+    {268, 150, 240, 224, 225, 169, 268, 150, 240},
+    {112, 269, 157, 222, 226, 121, 112, 269, 157},
+    {161, 172, 269, 221, 227, 226, 161, 172, 269},
+    {269, 124, 162, 226, 228, 229, 269, 124, 162},
+    {157, 162, 119, 121, 229, 104, 157, 162, 119},
+    {183, 239, 132, 230, 231, 232, 183, 239, 132},
+    {106, 270, 183, 233, 234, 230, 106, 270, 183},
+    {245, 204, 270, 235, 236, 234, 245, 204, 270},
+    {270, 125, 239, 234, 237, 231, 270, 125, 239},
+    {218, 213, 142, 238, 164, 166, 218, 213, 142},
+    {146, 271, 218, 159, 239, 238, 146, 271, 218},
+    {215, 180, 271, 240, 211, 239, 215, 180, 271},
+    {271, 138, 213, 239, 167, 164, 271, 138, 213},
+    {115, 272, 246, 241, 242, 243, 115, 272, 246},
+    {139, 272, 234, 244, 242, 245, 139, 272, 234},
+    {236, 226, 272, 246, 126, 242, 236, 226, 272},
+    {246, 226, 130, 243, 126, 247, 246, 226, 130},
+    {118, 273, 200, 248, 249, 250, 118, 273, 200},
+    {197, 198, 273, 251, 125, 249, 197, 198, 273},
+    {273, 114, 196, 249, 122, 252, 273, 114, 196},
+    {200, 196, 105, 250, 252, 253, 200, 196, 105},
+    {168, 206, 122, 254, 255, 256, 168, 206, 122},
+    {125, 274, 168, 237, 257, 254, 125, 274, 168},
+    {204, 199, 274, 236, 258, 257, 204, 199, 274},
+    {274, 104, 206, 257, 259, 255, 274, 104, 206},
+    {207, 222, 132, 209, 260, 207, 207, 222, 132},
+    {110, 275, 207, 114, 261, 209, 110, 275, 207},
+    {171, 165, 275, 113, 262, 261, 171, 165, 275},
+    {275, 148, 222, 261, 263, 260, 275, 148, 222},
+    {181, 241, 118, 264, 265, 248, 181, 241, 118},
+    {181, 248, 276, 264, 165, 266, 181, 248, 276},
+    {248, 219, 276, 165, 148, 266, 248, 219, 276},
+    {276, 107, 241, 266, 267, 265, 276, 107, 241},
+    {129, 277, 187, 137, 268, 175, 129, 277, 187},
+    {178, 188, 277, 139, 188, 268, 178, 188, 277},
+    {188, 175, 277, 188, 269, 268, 188, 175, 277},
+    {187, 175, 127, 175, 269, 176, 187, 175, 127},
+    {196, 224, 105, 252, 162, 253, 196, 224, 105},
+    {114, 278, 196, 122, 270, 252, 114, 278, 196},
+    {223, 170, 278, 124, 271, 270, 223, 170, 278},
+    {278, 121, 224, 270, 163, 162, 278, 121, 224},
+    {235, 210, 107, 147, 272, 267, 235, 210, 107},
+    {131, 279, 235, 145, 273, 147, 131, 279, 235},
+    {225, 234, 279, 274, 245, 273, 225, 234, 279},
+    {279, 115, 210, 273, 241, 272, 279, 115, 210},
+    {137, 280, 247, 216, 275, 223, 137, 280, 247},
+    {193, 245, 280, 276, 235, 275, 193, 245, 280},
+    {280, 106, 217, 275, 233, 277, 280, 106, 217},
+    {247, 217, 149, 223, 277, 206, 247, 217, 149},
+    {118, 281, 197, 248, 278, 251, 118, 281, 197},
+    {241, 210, 281, 265, 272, 278, 241, 210, 281},
+    {281, 115, 246, 278, 241, 243, 281, 115, 246},
+    {197, 246, 130, 251, 243, 247, 197, 246, 130},
+    {145, 282, 216, 279, 280, 281, 145, 282, 216},
+    {214, 159, 282, 282, 217, 280, 214, 159, 282},
+    {282, 109, 176, 280, 118, 283, 282, 109, 176},
+    {216, 176, 140, 281, 283, 178, 216, 176, 140},
+    {113, 283, 195, 151, 284, 285, 113, 283, 195},
+    {238, 162, 283, 106, 229, 284, 238, 162, 283},
+    {283, 124, 236, 284, 228, 286, 283, 124, 236},
+    {195, 236, 139, 285, 286, 153, 195, 236, 139},
+    {173, 164, 122, 287, 196, 193, 173, 164, 122},
+    {134, 284, 173, 288, 289, 287, 134, 284, 173},
+    {190, 174, 284, 290, 191, 289, 190, 174, 284},
+    {284, 108, 164, 289, 190, 196, 284, 108, 164},
+    {134, 285, 190, 288, 291, 290, 134, 285, 190},
+    {185, 191, 285, 292, 293, 291, 185, 191, 285},
+    {285, 127, 175, 291, 176, 269, 285, 127, 175},
+    {285, 126, 190, 291, 192, 290, 285, 126, 190},
+    {137, 286, 193, 216, 294, 276, 137, 286, 193},
+    {202, 194, 286, 215, 295, 294, 202, 194, 286},
+    {286, 104, 199, 294, 259, 258, 286, 104, 199},
+    {193, 199, 120, 276, 258, 296, 193, 199, 120},
+    {152, 287, 230, 186, 297, 298, 152, 287, 230},
+    {232, 163, 287, 185, 299, 297, 232, 163, 287},
+    {287, 111, 160, 297, 108, 150, 287, 111, 160},
+    {230, 160, 131, 298, 150, 155, 230, 160, 131},
+    {122, 288, 173, 256, 300, 301, 122, 288, 173},
+    {104, 288, 206, 259, 300, 255, 104, 288, 206},
+    {288, 135, 209, 300, 132, 129, 288, 135, 209},
+    {288, 134, 173, 300, 131, 301, 288, 134, 173},
+    {133, 289, 191, 302, 303, 293, 133, 289, 191},
+    {184, 216, 289, 304, 281, 303, 184, 216, 289},
+    {289, 140, 211, 303, 178, 177, 289, 140, 211},
+    {191, 211, 127, 293, 177, 176, 191, 211, 127},
+    {132, 290, 183, 232, 305, 230, 132, 290, 183},
+    {148, 290, 222, 201, 305, 306, 148, 290, 222},
+    {290, 149, 217, 305, 206, 277, 290, 149, 217},
+    {290, 106, 183, 305, 233, 230, 290, 106, 183},
+    {116, 291, 179, 101, 307, 308, 116, 291, 179},
+    {237, 163, 291, 103, 299, 307, 237, 163, 291},
+    {291, 151, 249, 307, 184, 309, 291, 151, 249},
+    {179, 249, 141, 308, 309, 171, 179, 249, 141},
+    {148, 292, 189, 263, 310, 311, 148, 292, 189},
+    {143, 292, 165, 312, 310, 262, 143, 292, 165},
+    {292, 144, 205, 310, 313, 182, 292, 144, 205},
+    {189, 205, 147, 311, 182, 179, 189, 205, 147},
+    {200, 181, 118, 250, 264, 248, 200, 181, 118},
+    {105, 293, 200, 253, 314, 250, 105, 293, 200},
+    {201, 218, 293, 161, 238, 314, 201, 218, 293},
+    {181, 218, 142, 264, 238, 166, 181, 218, 142},
+    {182, 227, 147, 315, 204, 202, 182, 227, 147},
+    {152, 294, 182, 144, 316, 315, 152, 294, 182},
+    {233, 231, 294, 143, 170, 316, 233, 231, 294},
+    {294, 150, 227, 316, 225, 204, 294, 150, 227},
+    {116, 295, 156, 101, 317, 119, 116, 295, 156},
+    {179, 220, 295, 308, 173, 317, 179, 220, 295},
+    {295, 140, 176, 317, 178, 283, 295, 140, 176},
+    {156, 176, 109, 119, 283, 118, 156, 176, 109},
+    {208, 184, 133, 135, 318, 136, 208, 184, 133},
+    {136, 296, 208, 213, 319, 135, 136, 296, 208},
+    {215, 221, 296, 240, 156, 319, 215, 221, 296},
+    {296, 145, 184, 319, 158, 318, 296, 145, 184},
+    {141, 297, 212, 171, 320, 174, 141, 297, 212},
+    {249, 229, 297, 309, 183, 320, 249, 229, 297},
+    {297, 144, 244, 320, 313, 140, 297, 144, 244},
+    {212, 244, 129, 174, 140, 137, 212, 244, 129},
+    {310, 444, 352, 321, 322, 323, 310, 444, 352},
+    {444, 313, 352, 322, 324, 323, 444, 313, 352},
+    {444, 307, 432, 322, 325, 326, 444, 307, 432},
+    {305, 444, 431, 327, 322, 328, 305, 444, 431},
+    {322, 445, 437, 329, 330, 331, 322, 445, 437},
+    {437, 365, 337, 331, 332, 333, 437, 365, 337},
+    {445, 304, 365, 330, 334, 332, 445, 304, 365},
+    {371, 436, 445, 335, 336, 330, 371, 436, 445},
+    {310, 446, 350, 321, 337, 338, 310, 446, 350},
+    {446, 303, 350, 337, 339, 338, 446, 303, 350},
+    {446, 306, 349, 337, 340, 341, 446, 306, 349},
+    {313, 446, 352, 324, 337, 323, 313, 446, 352},
+    {308, 447, 392, 342, 343, 344, 308, 447, 392},
+    {447, 324, 392, 343, 345, 344, 447, 324, 392},
+    {366, 420, 447, 346, 347, 343, 366, 420, 447},
+    {317, 447, 417, 348, 343, 349, 317, 447, 417},
+    {379, 403, 328, 350, 351, 352, 379, 403, 328},
+    {448, 329, 403, 353, 354, 351, 448, 329, 403},
+    {402, 386, 448, 355, 356, 353, 402, 386, 448},
+    {327, 448, 379, 357, 353, 350, 327, 448, 379},
+    {323, 449, 438, 358, 359, 360, 323, 449, 438},
+    {438, 363, 338, 360, 361, 362, 438, 363, 338},
+    {437, 363, 449, 331, 361, 359, 437, 363, 449},
+    {372, 437, 449, 363, 331, 359, 372, 437, 449},
+    {427, 424, 346, 364, 365, 366, 427, 424, 346},
+    {450, 325, 424, 367, 368, 365, 450, 325, 424},
+    {413, 429, 450, 369, 370, 367, 413, 429, 450},
+    {347, 450, 427, 371, 367, 364, 347, 450, 427},
+    {354, 361, 305, 372, 373, 327, 354, 361, 305},
+    {451, 307, 361, 374, 325, 373, 451, 307, 361},
+    {451, 333, 389, 374, 375, 376, 451, 333, 389},
+    {325, 451, 354, 377, 374, 372, 325, 451, 354},
+    {408, 415, 339, 378, 379, 380, 408, 415, 339},
+    {452, 340, 415, 381, 382, 379, 452, 340, 415},
+    {418, 395, 452, 383, 384, 381, 418, 395, 452},
+    {315, 452, 408, 385, 381, 378, 315, 452, 408},
+    {442, 407, 336, 386, 387, 388, 442, 407, 336},
+    {453, 332, 407, 389, 390, 387, 453, 332, 407},
+    {425, 434, 453, 391, 392, 389, 425, 434, 453},
+    {347, 453, 442, 371, 389, 386, 347, 453, 442},
+    {335, 454, 406, 393, 394, 395, 335, 454, 406},
+    {406, 381, 323, 395, 396, 358, 406, 381, 323},
+    {454, 321, 381, 394, 397, 396, 454, 321, 381},
+    {414, 405, 454, 398, 399, 394, 414, 405, 454},
+    {341, 455, 399, 400, 401, 402, 341, 455, 399},
+    {399, 423, 338, 402, 403, 362, 399, 423, 338},
+    {455, 345, 423, 401, 404, 403, 455, 345, 423},
+    {376, 426, 455, 405, 406, 401, 376, 426, 455},
+    {322, 456, 371, 329, 407, 335, 322, 456, 371},
+    {371, 348, 311, 335, 408, 409, 371, 348, 311},
+    {456, 302, 348, 407, 410, 408, 456, 302, 348},
+    {382, 368, 456, 411, 412, 407, 382, 368, 456},
+    {316, 457, 358, 413, 414, 415, 316, 457, 358},
+    {457, 302, 358, 414, 410, 415, 457, 302, 358},
+    {457, 311, 348, 414, 409, 408, 457, 311, 348},
+    {362, 360, 457, 416, 417, 414, 362, 360, 457},
+    {422, 383, 342, 418, 419, 420, 422, 383, 342},
+    {458, 341, 383, 421, 422, 419, 458, 341, 383},
+    {397, 421, 458, 423, 424, 421, 397, 421, 458},
+    {343, 458, 422, 425, 421, 418, 343, 458, 422},
+    {326, 459, 433, 426, 427, 428, 326, 459, 433},
+    {433, 360, 319, 428, 417, 429, 433, 360, 319},
+    {459, 311, 360, 427, 409, 417, 459, 311, 360},
+    {304, 459, 401, 334, 427, 430, 304, 459, 401},
+    {380, 374, 332, 431, 432, 390, 380, 374, 332},
+    {460, 330, 374, 433, 434, 432, 460, 330, 374},
+    {460, 329, 386, 433, 354, 356, 460, 329, 386},
+    {380, 396, 460, 431, 435, 433, 380, 396, 460},
+    {349, 353, 303, 341, 436, 339, 349, 353, 303},
+    {461, 315, 353, 437, 438, 436, 461, 315, 353},
+    {461, 317, 364, 437, 439, 440, 461, 317, 364},
+    {306, 461, 349, 340, 437, 341, 306, 461, 349},
+    {434, 380, 332, 392, 431, 390, 434, 380, 332},
+    {380, 441, 331, 431, 441, 442, 380, 441, 331},
+    {462, 343, 441, 443, 425, 441, 462, 343, 441},
+    {344, 462, 434, 444, 443, 392, 344, 462, 434},
+    {306, 463, 355, 340, 445, 446, 306, 463, 355},
+    {355, 366, 317, 446, 447, 439, 355, 366, 317},
+    {463, 318, 366, 445, 448, 447, 463, 318, 366},
+    {351, 356, 463, 449, 450, 445, 351, 356, 463},
+    {433, 377, 326, 451, 452, 453, 433, 377, 326},
+    {464, 300, 377, 454, 455, 452, 464, 300, 377},
+    {398, 439, 464, 456, 457, 454, 398, 439, 464},
+    {319, 464, 433, 458, 454, 451, 319, 464, 433},
+    {407, 412, 336, 387, 459, 388, 407, 412, 336},
+    {465, 340, 412, 460, 382, 459, 465, 340, 412},
+    {374, 409, 465, 432, 461, 460, 374, 409, 465},
+    {332, 465, 407, 390, 460, 387, 332, 465, 407},
+    {309, 466, 428, 462, 463, 464, 309, 466, 428},
+    {466, 333, 428, 463, 465, 464, 466, 333, 428},
+    {420, 430, 466, 347, 466, 463, 420, 430, 466},
+    {324, 466, 440, 345, 463, 467, 324, 466, 440},
+    {312, 467, 391, 468, 469, 470, 312, 467, 391},
+    {391, 392, 324, 470, 344, 345, 391, 392, 324},
+    {467, 308, 392, 469, 342, 344, 467, 308, 392},
+    {394, 390, 467, 471, 472, 469, 394, 390, 467},
+    {400, 362, 316, 473, 474, 475, 400, 362, 316},
+    {468, 319, 362, 476, 458, 474, 468, 319, 362},
+    {393, 398, 468, 477, 456, 476, 393, 398, 468},
+    {298, 468, 400, 478, 476, 473, 298, 468, 400},
+    {416, 401, 326, 479, 430, 426, 416, 401, 326},
+    {469, 304, 401, 480, 334, 430, 469, 304, 401},
+    {359, 365, 469, 481, 332, 480, 359, 365, 469},
+    {342, 469, 416, 482, 480, 479, 342, 469, 416},
+    {435, 375, 312, 483, 484, 468, 435, 375, 312},
+    {470, 336, 375, 485, 388, 484, 470, 336, 375},
+    {413, 442, 470, 369, 386, 485, 413, 442, 470},
+    {301, 470, 435, 486, 485, 483, 301, 470, 435},
+    {323, 471, 372, 358, 487, 363, 323, 471, 372},
+    {372, 382, 322, 363, 411, 329, 372, 382, 322},
+    {369, 382, 471, 488, 411, 487, 369, 382, 471},
+    {381, 369, 471, 396, 488, 487, 381, 369, 471},
+    {418, 390, 299, 383, 472, 489, 418, 390, 299},
+    {472, 308, 390, 490, 342, 472, 472, 308, 390},
+    {364, 417, 472, 491, 349, 490, 364, 417, 472},
+    {315, 472, 418, 385, 490, 383, 315, 472, 418},
+    {404, 429, 301, 492, 370, 486, 404, 429, 301},
+    {473, 325, 429, 493, 368, 370, 473, 325, 429},
+    {428, 419, 473, 464, 494, 493, 428, 419, 473},
+    {309, 473, 404, 462, 493, 492, 309, 473, 404},
+    {331, 474, 387, 442, 495, 496, 331, 474, 387},
+    {387, 439, 314, 496, 457, 497, 387, 439, 314},
+    {474, 300, 439, 495, 455, 457, 474, 300, 439},
+    {441, 411, 474, 441, 498, 495, 441, 411, 474},
+    {312, 475, 435, 468, 499, 483, 312, 475, 435},
+    {435, 404, 301, 483, 492, 486, 435, 404, 301},
+    {475, 309, 404, 499, 462, 492, 475, 309, 404},
+    {391, 440, 475, 470, 467, 499, 391, 440, 475},
+    {339, 476, 408, 500, 501, 502, 339, 476, 408},
+    {408, 353, 315, 502, 436, 438, 408, 353, 315},
+    {476, 303, 353, 501, 339, 436, 476, 303, 353},
+    {410, 370, 476, 503, 504, 501, 410, 370, 476},
+    {307, 477, 432, 325, 505, 326, 307, 477, 432},
+    {432, 356, 313, 326, 450, 324, 432, 356, 313},
+    {477, 318, 356, 505, 448, 450, 477, 318, 356},
+    {389, 430, 477, 376, 506, 505, 389, 430, 477},
+    {358, 367, 316, 415, 507, 413, 358, 367, 316},
+    {478, 328, 367, 508, 509, 507, 478, 328, 367},
+    {368, 384, 478, 412, 510, 508, 368, 384, 478},
+    {302, 478, 358, 410, 508, 415, 302, 478, 358},
+    {328, 479, 379, 509, 511, 512, 328, 479, 379},
+    {379, 385, 327, 512, 513, 514, 379, 385, 327},
+    {479, 321, 385, 511, 397, 513, 479, 321, 385},
+    {320, 479, 384, 515, 511, 510, 320, 479, 384},
+    {331, 480, 396, 442, 516, 435, 331, 480, 396},
+    {396, 388, 329, 435, 517, 354, 396, 388, 329},
+    {480, 298, 388, 516, 478, 517, 480, 298, 388},
+    {387, 393, 480, 496, 477, 516, 387, 393, 480},
+    {346, 481, 426, 518, 519, 406, 346, 481, 426},
+    {426, 357, 345, 406, 520, 404, 426, 357, 345},
+    {481, 305, 357, 519, 327, 520, 481, 305, 357},
+    {424, 354, 481, 521, 372, 519, 424, 354, 481},
+    {316, 482, 400, 475, 522, 473, 316, 482, 400},
+    {482, 298, 400, 522, 478, 473, 482, 298, 400},
+    {482, 329, 388, 522, 354, 517, 482, 329, 388},
+    {367, 403, 482, 523, 351, 522, 367, 403, 482},
+    {327, 483, 378, 514, 524, 525, 327, 483, 378},
+    {378, 410, 339, 525, 503, 500, 378, 410, 339},
+    {483, 334, 410, 524, 526, 503, 483, 334, 410},
+    {385, 405, 483, 513, 399, 524, 385, 405, 483},
+    {326, 484, 416, 453, 527, 528, 326, 484, 416},
+    {416, 422, 342, 528, 418, 420, 416, 422, 342},
+    {484, 343, 422, 527, 425, 418, 484, 343, 422},
+    {300, 484, 377, 455, 527, 452, 300, 484, 377},
+    {310, 485, 431, 321, 529, 328, 310, 485, 431},
+    {431, 357, 305, 328, 520, 327, 431, 357, 305},
+    {485, 345, 357, 529, 404, 520, 485, 345, 357},
+    {373, 443, 485, 530, 531, 529, 373, 443, 485},
+    {342, 486, 359, 482, 532, 481, 342, 486, 359},
+    {486, 337, 359, 532, 333, 481, 486, 337, 359},
+    {486, 338, 363, 532, 362, 361, 486, 338, 363},
+    {383, 399, 486, 533, 402, 532, 383, 399, 486},
+    {375, 394, 312, 484, 471, 468, 375, 394, 312},
+    {487, 299, 394, 534, 489, 471, 487, 299, 394},
+    {412, 395, 487, 459, 384, 534, 412, 395, 487},
+    {336, 487, 375, 388, 534, 484, 336, 487, 375},
+    {421, 376, 341, 424, 535, 422, 421, 376, 341},
+    {488, 346, 376, 536, 366, 535, 488, 346, 376},
+    {425, 427, 488, 391, 364, 536, 425, 427, 488},
+    {344, 488, 421, 444, 536, 424, 344, 488, 421},
+    {310, 489, 373, 321, 537, 530, 310, 489, 373},
+    {373, 414, 335, 530, 398, 393, 373, 414, 335},
+    {489, 334, 414, 537, 526, 398, 489, 334, 414},
+    {350, 370, 489, 338, 504, 537, 350, 370, 489},
+    {378, 402, 327, 538, 355, 357, 378, 402, 327},
+    {490, 330, 402, 539, 434, 355, 490, 330, 402},
+    {415, 409, 490, 379, 461, 539, 415, 409, 490},
+    {339, 490, 378, 380, 539, 538, 339, 490, 378},
+    {335, 491, 443, 393, 540, 531, 335, 491, 443},
+    {443, 423, 345, 531, 403, 404, 443, 423, 345},
+    {491, 338, 423, 540, 362, 403, 491, 338, 423},
+    {406, 438, 491, 395, 360, 540, 406, 438, 491},
+    {492, 512, 500, 541, 542, 543, 492, 512, 500},
+    {493, 512, 501, 544, 542, 545, 493, 512, 501},
+    {512, 495, 503, 542, 546, 547, 512, 495, 503},
+    {512, 494, 500, 542, 548, 543, 512, 494, 500},
+    {503, 504, 494, 547, 549, 548, 503, 504, 494},
+    {503, 505, 513, 547, 550, 551, 503, 505, 513},
+    {505, 506, 513, 550, 552, 551, 505, 506, 513},
+    {504, 506, 498, 549, 552, 553, 504, 506, 498},
+    {498, 514, 507, 553, 554, 555, 498, 514, 507},
+    {499, 514, 506, 556, 554, 552, 499, 514, 506},
+    {514, 497, 509, 554, 557, 558, 514, 497, 509},
+    {514, 496, 507, 554, 559, 555, 514, 496, 507},
+    {509, 510, 496, 558, 560, 559, 509, 510, 496},
+    {509, 511, 515, 558, 561, 562, 509, 511, 515},
+    {511, 501, 515, 561, 563, 562, 511, 501, 515},
+    {510, 501, 492, 560, 563, 564, 510, 501, 492},
+    {494, 516, 500, 565, 566, 567, 494, 516, 500},
+    {498, 516, 504, 553, 566, 568, 498, 516, 504},
+    {516, 496, 510, 566, 559, 569, 516, 496, 510},
+    {516, 492, 500, 566, 570, 567, 516, 492, 500},
+    {499, 517, 508, 556, 571, 572, 499, 517, 508},
+    {495, 517, 505, 573, 571, 574, 495, 517, 505},
+    {517, 493, 511, 571, 575, 576, 517, 493, 511},
+    {517, 497, 508, 571, 557, 572, 517, 497, 508},
+    {518, 538, 527, 541, 542, 545, 518, 538, 527},
+    {538, 519, 527, 542, 544, 545, 538, 519, 527},
+    {538, 521, 528, 542, 546, 577, 538, 521, 528},
+    {520, 538, 526, 548, 542, 543, 520, 538, 526},
+    {530, 529, 520, 549, 547, 548, 530, 529, 520},
+    {529, 531, 521, 547, 550, 546, 529, 531, 521},
+    {532, 531, 539, 552, 550, 551, 532, 531, 539},
+    {530, 532, 539, 549, 552, 551, 530, 532, 539},
+    {524, 540, 532, 553, 554, 552, 524, 540, 532},
+    {540, 525, 532, 554, 556, 552, 540, 525, 532},
+    {540, 523, 534, 554, 557, 572, 540, 523, 534},
+    {522, 540, 533, 559, 554, 555, 522, 540, 533},
+    {536, 535, 522, 560, 558, 559, 536, 535, 522},
+    {535, 537, 523, 558, 561, 557, 535, 537, 523},
+    {527, 537, 541, 563, 561, 562, 527, 537, 541},
+    {536, 527, 541, 560, 563, 562, 536, 527, 541},
+    {520, 542, 530, 565, 566, 568, 520, 516, 530},
+    {542, 524, 530, 566, 553, 568, 516, 524, 530},
+    {542, 522, 533, 566, 559, 555, 516, 522, 533},
+    {518, 542, 526, 570, 566, 567, 518, 516, 526},
+    {525, 543, 531, 556, 571, 574, 525, 542, 531},
+    {543, 521, 531, 571, 573, 574, 542, 521, 531},
+    {543, 519, 528, 571, 575, 578, 542, 519, 528},
+    {523, 543, 534, 557, 571, 572, 523, 542, 534},
+    {544, 564, 553, 579, 580, 581, 543, 563, 552},
+    {564, 545, 553, 580, 582, 581, 563, 544, 552},
+    {564, 547, 554, 580, 583, 584, 563, 546, 553},
+    {546, 564, 552, 585, 580, 586, 545, 563, 551},
+    {556, 555, 546, 587, 588, 585, 555, 554, 545},
+    {565, 547, 555, 589, 583, 588, 564, 546, 554},
+    {565, 551, 557, 589, 590, 591, 564, 550, 556},
+    {556, 558, 565, 587, 592, 589, 555, 557, 564},
+    {550, 566, 558, 593, 594, 592, 549, 565, 557},
+    {566, 551, 558, 594, 590, 592, 565, 550, 557},
+    {566, 549, 560, 594, 595, 596, 565, 548, 559},
+    {548, 566, 559, 597, 594, 598, 547, 565, 558},
+    {562, 561, 548, 599, 600, 597, 561, 560, 547},
+    {561, 563, 549, 600, 601, 595, 560, 562, 548},
+    {553, 563, 567, 602, 601, 603, 552, 562, 566},
+    {562, 553, 567, 599, 602, 603, 561, 552, 566},
+    {546, 568, 556, 604, 605, 606, 545, 567, 555},
+    {568, 550, 556, 605, 593, 606, 567, 549, 555},
+    {568, 548, 559, 605, 597, 598, 567, 547, 558},
+    {544, 568, 552, 607, 605, 608, 543, 567, 551},
+    {551, 569, 557, 590, 609, 610, 550, 568, 556},
+    {569, 547, 557, 609, 611, 610, 568, 546, 556},
+    {569, 545, 554, 609, 612, 613, 568, 544, 553},
+    {549, 569, 560, 595, 609, 596, 548, 568, 559},
+    {570, 590, 578, 614, 615, 616, 569, 589, 577},
+    {571, 590, 579, 617, 615, 618, 570, 589, 578},
+    {590, 573, 581, 615, 619, 620, 589, 572, 580},
+    {590, 572, 578, 615, 621, 616, 589, 571, 577},
+    {581, 582, 572, 620, 622, 621, 580, 581, 571},
+    {573, 591, 581, 619, 623, 620, 572, 590, 580},
+    {591, 577, 584, 623, 624, 625, 590, 576, 583},
+    {582, 584, 576, 622, 625, 626, 581, 583, 575},
+    {576, 592, 585, 626, 627, 628, 575, 591, 584},
+    {577, 592, 584, 624, 627, 625, 576, 591, 583},
+    {592, 575, 587, 627, 629, 630, 591, 574, 586},
+    {592, 574, 585, 627, 631, 628, 591, 573, 584},
+    {587, 588, 574, 630, 632, 631, 586, 587, 573},
+    {587, 589, 593, 630, 633, 634, 586, 588, 592},
+    {589, 579, 593, 633, 635, 634, 588, 578, 592},
+    {588, 579, 570, 632, 635, 636, 587, 578, 569},
+    {572, 594, 578, 637, 638, 639, 571, 567, 577},
+    {576, 594, 582, 626, 638, 640, 575, 567, 581},
+    {594, 574, 588, 638, 631, 641, 567, 573, 587},
+    {594, 570, 578, 638, 642, 639, 567, 569, 577},
+    {577, 595, 586, 624, 643, 644, 576, 593, 585},
+    {573, 595, 583, 645, 643, 646, 572, 593, 582},
+    {595, 571, 589, 643, 647, 648, 593, 570, 588},
+    {595, 575, 586, 643, 629, 644, 593, 574, 585},
+    {22, 9, 2, 0, 14, 1, 22, 9, 2},
+    {21, 17, 1, 3, 15, 4, 21, 17, 1},
+    {7, 11, 23, 6, 12, 7, 7, 11, 23},
+    {2, 9, 29, 1, 14, 9, 2, 9, 29},
+    {0, 16, 21, 11, 16, 3, 0, 16, 21},
+    {1, 17, 23, 4, 15, 7, 1, 17, 23},
+    {3, 18, 23, 6, 8, 7, 3, 18, 23},
+    {2, 8, 19, 1, 10, 13, 2, 8, 19},
+    {19, 11, 7, 13, 12, 6, 19, 11, 7},
+    {6, 10, 19, 1, 2, 13, 6, 10, 19},
+    {22, 16, 0, 0, 16, 11, 22, 16, 0},
+    {20, 14, 5, 9, 8, 4, 20, 14, 5},
+    {13, 20, 15, 14, 9, 5, 13, 20, 15},
+    {7, 14, 20, 6, 8, 9, 7, 14, 20},
+    {5, 14, 23, 4, 8, 7, 5, 14, 23},
+    {29, 24, 1, 9, 5, 4, 29, 24, 1},
+    {22, 13, 4, 0, 14, 11, 22, 13, 4},
+    {6, 13, 22, 1, 14, 0, 6, 13, 22},
+    {19, 8, 3, 13, 10, 6, 19, 8, 3},
+    {24, 29, 9, 5, 9, 14, 24, 29, 9},
+    {4, 15, 21, 11, 5, 3, 4, 15, 21},
+    {5, 17, 21, 4, 15, 3, 5, 17, 21},
+    {29, 18, 3, 9, 8, 6, 29, 18, 3},
+    {6, 12, 20, 1, 10, 9, 6, 12, 20},
+    {45, 48, 42, 17, 27, 18, 45, 48, 42},
+    {44, 37, 41, 20, 31, 21, 44, 37, 41},
+    {34, 43, 31, 23, 30, 24, 34, 43, 31},
+    {45, 47, 51, 17, 33, 26, 45, 47, 51},
+    {38, 50, 41, 28, 22, 21, 38, 50, 41},
+    {44, 49, 43, 20, 23, 30, 44, 49, 43},
+    {31, 43, 49, 24, 30, 23, 31, 43, 49},
+    {45, 30, 39, 17, 19, 32, 45, 30, 39},
+    {39, 32, 28, 32, 33, 25, 39, 32, 28},
+    {27, 32, 39, 17, 33, 32, 27, 32, 39},
+    {42, 48, 38, 18, 27, 28, 42, 48, 38},
+    {40, 35, 26, 26, 22, 20, 40, 35, 26},
+    {25, 35, 40, 28, 22, 26, 25, 35, 40},
+    {40, 34, 28, 26, 23, 25, 40, 34, 28},
+    {26, 37, 43, 20, 31, 30, 26, 37, 43},
+    {51, 49, 44, 26, 23, 20, 51, 49, 44},
+    {42, 36, 25, 18, 29, 28, 42, 36, 25},
+    {42, 33, 27, 18, 27, 17, 42, 33, 27},
+    {39, 31, 46, 32, 24, 25, 39, 31, 46},
+    {38, 48, 51, 28, 27, 26, 38, 48, 51},
+    {25, 36, 41, 28, 29, 21, 25, 36, 41},
+    {41, 37, 26, 21, 31, 20, 41, 37, 26},
+    {46, 49, 51, 25, 23, 26, 46, 49, 51},
+    {27, 33, 40, 17, 27, 26, 27, 33, 40},
+    {60, 52, 61, 34, 98, 35, 60, 52, 61},
+    {61, 53, 62, 35, 95, 37, 61, 53, 62},
+    {59, 65, 77, 38, 99, 39, 59, 65, 77},
+    {62, 55, 63, 41, 91, 42, 62, 55, 63},
+    {60, 72, 63, 44, 43, 42, 60, 72, 63},
+    {102, 93, 84, 46, 97, 47, 102, 93, 84},
+    {54, 64, 76, 45, 61, 49, 54, 64, 76},
+    {103, 97, 79, 50, 77, 51, 103, 97, 79},
+    {73, 65, 59, 53, 99, 38, 73, 65, 59},
+    {102, 86, 78, 55, 78, 56, 102, 86, 78},
+    {58, 64, 73, 58, 61, 53, 58, 64, 73},
+    {101, 96, 78, 59, 57, 56, 101, 96, 78},
+    {54, 63, 73, 45, 42, 53, 54, 63, 73},
+    {68, 57, 69, 62, 68, 63, 68, 57, 69},
+    {67, 74, 69, 65, 64, 63, 67, 74, 69},
+    {66, 59, 68, 54, 38, 40, 66, 59, 68},
+    {57, 68, 77, 68, 62, 69, 57, 68, 77},
+    {99, 89, 80, 71, 80, 72, 99, 89, 80},
+    {76, 67, 56, 73, 65, 66, 76, 67, 56},
+    {58, 67, 76, 58, 100, 49, 58, 67, 76},
+    {102, 96, 82, 55, 57, 75, 102, 96, 82},
+    {101, 87, 79, 59, 60, 51, 101, 87, 79},
+    {86, 98, 87, 78, 649, 60, 86, 98, 87},
+    {99, 91, 81, 71, 85, 79, 99, 91, 81},
+    {87, 98, 88, 60, 649, 52, 87, 98, 88},
+    {101, 97, 83, 59, 77, 81, 101, 97, 83},
+    {88, 98, 89, 83, 87, 80, 88, 98, 89},
+    {103, 88, 81, 84, 83, 79, 103, 88, 81},
+    {86, 80, 89, 86, 72, 80, 86, 80, 89},
+    {102, 90, 80, 46, 48, 72, 102, 90, 80},
+    {85, 91, 99, 88, 85, 71, 85, 91, 99},
+    {103, 91, 85, 84, 85, 88, 103, 91, 85},
+    {99, 90, 84, 71, 48, 47, 99, 90, 84},
+    {55, 65, 73, 91, 99, 53, 55, 65, 73},
+    {94, 100, 95, 92, 93, 82, 94, 100, 95},
+    {103, 94, 83, 50, 92, 81, 103, 94, 83},
+    {93, 82, 95, 76, 75, 82, 93, 82, 95},
+    {94, 85, 92, 90, 88, 89, 94, 85, 92},
+    {53, 61, 75, 95, 35, 96, 53, 61, 75},
+    {101, 95, 82, 59, 82, 75, 101, 95, 82},
+    {93, 100, 92, 97, 94, 89, 93, 100, 92},
+    {52, 60, 76, 98, 34, 73, 52, 60, 76},
+    {75, 61, 52, 96, 35, 98, 75, 61, 52},
+    {55, 62, 77, 91, 41, 39, 55, 62, 77},
+    {56, 69, 75, 66, 63, 96, 56, 69, 75},
+    {57, 71, 75, 68, 70, 96, 57, 71, 75},
+    {77, 62, 53, 69, 37, 95, 77, 62, 53},
+    {66, 74, 67, 54, 67, 100, 66, 74, 67},
+    {116, 158, 250, 101, 105, 102, 116, 158, 250},
+    {119, 238, 250, 104, 106, 102, 119, 238, 250},
+    {238, 113, 167, 106, 151, 107, 238, 113, 167},
+    {250, 167, 111, 102, 107, 108, 250, 167, 111},
+    {128, 243, 251, 109, 112, 110, 128, 243, 251},
+    {243, 143, 171, 112, 312, 113, 243, 143, 171},
+    {251, 171, 110, 110, 113, 114, 251, 171, 110},
+    {177, 251, 242, 111, 110, 115, 177, 251, 242},
+    {116, 156, 252, 101, 119, 117, 116, 156, 252},
+    {109, 155, 252, 118, 120, 117, 109, 155, 252},
+    {155, 112, 157, 120, 222, 121, 155, 112, 157},
+    {252, 157, 119, 117, 121, 104, 252, 157, 119},
+    {114, 198, 253, 122, 125, 123, 114, 198, 253},
+    {198, 130, 226, 125, 247, 126, 198, 130, 226},
+    {226, 124, 172, 126, 650, 127, 226, 124, 172},
+    {253, 172, 123, 123, 127, 128, 253, 172, 123},
+    {209, 254, 185, 129, 133, 130, 209, 254, 185},
+    {135, 192, 254, 132, 134, 133, 135, 192, 254},
+    {192, 136, 208, 134, 213, 135, 192, 136, 208},
+    {254, 208, 133, 133, 135, 136, 254, 208, 133},
+    {129, 244, 255, 137, 140, 138, 129, 244, 255},
+    {244, 144, 169, 140, 313, 141, 244, 144, 169},
+    {169, 143, 243, 141, 312, 112, 169, 143, 243},
+    {178, 255, 243, 139, 138, 112, 178, 255, 243},
+    {230, 256, 233, 142, 146, 143, 230, 256, 233},
+    {131, 235, 256, 145, 147, 146, 131, 235, 256},
+    {235, 107, 219, 147, 267, 148, 235, 107, 219},
+    {256, 219, 153, 146, 148, 149, 256, 219, 153},
+    {167, 257, 160, 107, 152, 150, 167, 257, 160},
+    {113, 195, 257, 151, 285, 152, 113, 195, 257},
+    {257, 195, 139, 152, 285, 153, 257, 195, 139},
+    {257, 225, 131, 152, 154, 155, 257, 225, 131},
+    {221, 258, 214, 156, 160, 157, 221, 258, 214},
+    {146, 201, 258, 159, 161, 160, 146, 201, 258},
+    {201, 105, 224, 161, 253, 162, 201, 105, 224},
+    {258, 224, 121, 160, 162, 163, 258, 224, 121},
+    {213, 259, 248, 164, 168, 165, 213, 259, 248},
+    {138, 240, 259, 167, 169, 168, 138, 240, 259},
+    {240, 150, 231, 169, 225, 170, 240, 150, 231},
+    {259, 231, 153, 168, 170, 149, 259, 231, 153},
+    {141, 212, 260, 171, 174, 172, 141, 212, 260},
+    {212, 129, 187, 174, 137, 175, 212, 129, 187},
+    {260, 187, 127, 172, 175, 176, 260, 187, 127},
+    {220, 260, 211, 173, 172, 177, 220, 260, 211},
+    {147, 205, 261, 179, 182, 180, 147, 205, 261},
+    {205, 144, 229, 182, 313, 183, 205, 144, 229},
+    {261, 229, 151, 180, 183, 184, 261, 229, 151},
+    {182, 261, 232, 181, 180, 185, 182, 261, 232},
+    {128, 177, 262, 109, 111, 187, 128, 177, 262},
+    {177, 117, 154, 111, 116, 189, 177, 117, 154},
+    {262, 154, 108, 187, 189, 190, 262, 154, 108},
+    {188, 262, 174, 188, 187, 191, 188, 262, 174},
+    {122, 164, 263, 193, 196, 194, 122, 164, 263},
+    {164, 108, 154, 196, 190, 189, 164, 108, 154},
+    {263, 154, 117, 194, 189, 116, 263, 154, 117},
+    {168, 263, 166, 195, 194, 197, 168, 263, 166},
+    {189, 264, 228, 199, 203, 200, 189, 264, 228},
+    {147, 227, 264, 202, 204, 203, 147, 227, 264},
+    {227, 150, 203, 204, 225, 205, 227, 150, 203},
+    {264, 203, 149, 203, 205, 206, 264, 203, 149},
+    {132, 239, 265, 207, 210, 208, 132, 239, 265},
+    {239, 125, 166, 210, 198, 197, 239, 125, 166},
+    {265, 166, 117, 208, 197, 116, 265, 166, 117},
+    {207, 265, 242, 209, 208, 115, 207, 265, 242},
+    {180, 266, 186, 211, 214, 212, 180, 266, 186},
+    {136, 192, 266, 213, 134, 214, 136, 192, 266},
+    {266, 192, 135, 214, 134, 132, 266, 192, 135},
+    {186, 266, 202, 212, 214, 215, 186, 266, 202},
+    {159, 267, 155, 217, 219, 120, 159, 267, 155},
+    {121, 170, 267, 218, 651, 219, 121, 170, 267},
+    {267, 170, 123, 219, 651, 220, 267, 170, 123},
+    {267, 161, 112, 219, 221, 222, 267, 161, 112},
+    {186, 268, 240, 212, 224, 169, 186, 268, 240},
+    {186, 137, 247, 212, 216, 223, 186, 137, 247},
+    {268, 247, 149, 224, 223, 206, 268, 247, 149},
+    {268, 203, 150, 224, 205, 225, 268, 203, 150},
+    {112, 161, 269, 222, 221, 226, 112, 161, 269},
+    {161, 123, 172, 221, 220, 227, 161, 123, 172},
+    {269, 172, 124, 226, 227, 228, 269, 172, 124},
+    {157, 269, 162, 121, 226, 229, 157, 269, 162},
+    {183, 270, 239, 230, 234, 231, 183, 270, 239},
+    {106, 245, 270, 233, 235, 234, 106, 245, 270},
+    {245, 120, 204, 235, 296, 236, 245, 120, 204},
+    {270, 204, 125, 234, 236, 237, 270, 204, 125},
+    {218, 271, 213, 238, 239, 164, 218, 271, 213},
+    {146, 215, 271, 159, 240, 239, 146, 215, 271},
+    {215, 136, 180, 240, 213, 211, 215, 136, 180},
+    {271, 180, 138, 239, 211, 167, 271, 180, 138},
+    {115, 234, 272, 241, 245, 242, 115, 234, 272},
+    {139, 236, 272, 244, 246, 242, 139, 236, 272},
+    {236, 124, 226, 246, 650, 126, 236, 124, 226},
+    {246, 272, 226, 243, 242, 126, 246, 272, 226},
+    {118, 197, 273, 248, 251, 249, 118, 197, 273},
+    {197, 130, 198, 251, 247, 125, 197, 130, 198},
+    {273, 198, 114, 249, 125, 122, 273, 198, 114},
+    {200, 273, 196, 250, 249, 252, 200, 273, 196},
+    {168, 274, 206, 254, 257, 255, 168, 274, 206},
+    {125, 204, 274, 237, 236, 257, 125, 204, 274},
+    {204, 120, 199, 236, 296, 258, 204, 120, 199},
+    {274, 199, 104, 257, 258, 259, 274, 199, 104},
+    {207, 275, 222, 209, 261, 260, 207, 275, 222},
+    {110, 171, 275, 114, 113, 261, 110, 171, 275},
+    {171, 143, 165, 113, 312, 262, 171, 143, 165},
+    {275, 165, 148, 261, 262, 263, 275, 165, 148},
+    {181, 276, 241, 264, 266, 265, 181, 276, 241},
+    {181, 142, 248, 264, 166, 165, 181, 142, 248},
+    {248, 153, 219, 165, 149, 148, 248, 153, 219},
+    {276, 219, 107, 266, 148, 267, 276, 219, 107},
+    {129, 178, 277, 137, 139, 268, 129, 178, 277},
+    {178, 128, 188, 139, 109, 188, 178, 128, 188},
+    {188, 126, 175, 188, 192, 269, 188, 126, 175},
+    {187, 277, 175, 175, 268, 269, 187, 277, 175},
+    {196, 278, 224, 252, 270, 162, 196, 278, 224},
+    {114, 223, 278, 122, 124, 270, 114, 223, 278},
+    {223, 123, 170, 124, 128, 271, 223, 123, 170},
+    {278, 170, 121, 270, 271, 163, 278, 170, 121},
+    {235, 279, 210, 147, 273, 272, 235, 279, 210},
+    {131, 225, 279, 145, 274, 273, 131, 225, 279},
+    {225, 139, 234, 274, 244, 245, 225, 139, 234},
+    {279, 234, 115, 273, 245, 241, 279, 234, 115},
+    {137, 193, 280, 216, 276, 275, 137, 193, 280},
+    {193, 120, 245, 276, 296, 235, 193, 120, 245},
+    {280, 245, 106, 275, 235, 233, 280, 245, 106},
+    {247, 280, 217, 223, 275, 277, 247, 280, 217},
+    {118, 241, 281, 248, 265, 278, 118, 241, 281},
+    {241, 107, 210, 265, 267, 272, 241, 107, 210},
+    {281, 210, 115, 278, 272, 241, 281, 210, 115},
+    {197, 281, 246, 251, 278, 243, 197, 281, 246},
+    {145, 214, 282, 279, 282, 280, 145, 214, 282},
+    {214, 121, 159, 282, 218, 217, 214, 121, 159},
+    {282, 159, 109, 280, 217, 118, 282, 159, 109},
+    {216, 282, 176, 281, 280, 283, 216, 282, 176},
+    {113, 238, 283, 151, 106, 284, 113, 238, 283},
+    {238, 119, 162, 106, 104, 229, 238, 119, 162},
+    {283, 162, 124, 284, 229, 228, 283, 162, 124},
+    {195, 283, 236, 285, 284, 286, 195, 283, 236},
+    {173, 284, 164, 287, 289, 196, 173, 284, 164},
+    {134, 190, 284, 288, 290, 289, 134, 190, 284},
+    {190, 126, 174, 290, 192, 191, 190, 126, 174},
+    {284, 174, 108, 289, 191, 190, 284, 174, 108},
+    {134, 185, 285, 288, 292, 291, 134, 185, 285},
+    {185, 133, 191, 292, 302, 293, 185, 133, 191},
+    {285, 191, 127, 291, 293, 176, 285, 191, 127},
+    {285, 175, 126, 291, 269, 192, 285, 175, 126},
+    {137, 202, 286, 216, 215, 294, 137, 202, 286},
+    {202, 135, 194, 215, 132, 295, 202, 135, 194},
+    {286, 194, 104, 294, 295, 259, 286, 194, 104},
+    {193, 286, 199, 276, 294, 258, 193, 286, 199},
+    {152, 232, 287, 186, 185, 297, 152, 232, 287},
+    {232, 151, 163, 185, 184, 299, 232, 151, 163},
+    {287, 163, 111, 297, 299, 108, 287, 163, 111},
+    {230, 287, 160, 298, 297, 150, 230, 287, 160},
+    {122, 206, 288, 256, 255, 300, 122, 206, 288},
+    {104, 194, 288, 259, 295, 300, 104, 194, 288},
+    {288, 194, 135, 300, 295, 132, 288, 194, 135},
+    {288, 209, 134, 300, 129, 131, 288, 209, 134},
+    {133, 184, 289, 302, 304, 303, 133, 184, 289},
+    {184, 145, 216, 304, 279, 281, 184, 145, 216},
+    {289, 216, 140, 303, 281, 178, 289, 216, 140},
+    {191, 289, 211, 293, 303, 177, 191, 289, 211},
+    {132, 222, 290, 232, 306, 305, 132, 222, 290},
+    {148, 228, 290, 201, 200, 305, 148, 228, 290},
+    {290, 228, 149, 305, 200, 206, 290, 228, 149},
+    {290, 217, 106, 305, 277, 233, 290, 217, 106},
+    {116, 237, 291, 101, 103, 307, 116, 237, 291},
+    {237, 111, 163, 103, 108, 299, 237, 111, 163},
+    {291, 163, 151, 307, 299, 184, 291, 163, 151},
+    {179, 291, 249, 308, 307, 309, 179, 291, 249},
+    {148, 165, 292, 263, 262, 310, 148, 165, 292},
+    {143, 169, 292, 312, 141, 310, 143, 169, 292},
+    {292, 169, 144, 310, 141, 313, 292, 169, 144},
+    {189, 292, 205, 311, 310, 182, 189, 292, 205},
+    {200, 293, 181, 250, 314, 264, 200, 293, 181},
+    {105, 201, 293, 253, 161, 314, 105, 201, 293},
+    {201, 146, 218, 161, 159, 238, 201, 146, 218},
+    {181, 293, 218, 264, 314, 238, 181, 293, 218},
+    {182, 294, 227, 315, 316, 204, 182, 294, 227},
+    {152, 233, 294, 144, 143, 316, 152, 233, 294},
+    {233, 153, 231, 143, 149, 170, 233, 153, 231},
+    {294, 231, 150, 316, 170, 225, 294, 231, 150},
+    {116, 179, 295, 101, 308, 317, 116, 179, 295},
+    {179, 141, 220, 308, 171, 173, 179, 141, 220},
+    {295, 220, 140, 317, 173, 178, 295, 220, 140},
+    {156, 295, 176, 119, 317, 283, 156, 295, 176},
+    {208, 296, 184, 135, 319, 318, 208, 296, 184},
+    {136, 215, 296, 213, 240, 319, 136, 215, 296},
+    {215, 146, 221, 240, 159, 156, 215, 146, 221},
+    {296, 221, 145, 319, 156, 158, 296, 221, 145},
+    {141, 249, 297, 171, 309, 320, 141, 249, 297},
+    {249, 151, 229, 309, 184, 183, 249, 151, 229},
+    {297, 229, 144, 320, 183, 313, 297, 229, 144},
+    {212, 297, 244, 174, 320, 140, 212, 297, 244},
+    {310, 431, 444, 321, 328, 322, 310, 431, 444},
+    {444, 432, 313, 322, 326, 324, 444, 432, 313},
+    {444, 361, 307, 322, 373, 325, 444, 361, 307},
+    {305, 361, 444, 327, 373, 322, 305, 361, 444},
+    {322, 371, 445, 329, 335, 330, 322, 371, 445},
+    {437, 445, 365, 331, 330, 332, 437, 445, 365},
+    {445, 436, 304, 330, 336, 334, 445, 436, 304},
+    {371, 311, 436, 335, 409, 336, 371, 311, 436},
+    {310, 352, 446, 321, 323, 337, 310, 352, 446},
+    {446, 349, 303, 337, 341, 339, 446, 349, 303},
+    {446, 351, 306, 337, 449, 340, 446, 351, 306},
+    {313, 351, 446, 324, 449, 337, 313, 351, 446},
+    {308, 417, 447, 342, 349, 343, 308, 417, 447},
+    {447, 420, 324, 343, 347, 345, 447, 420, 324},
+    {366, 318, 420, 346, 652, 347, 366, 318, 420},
+    {317, 366, 447, 348, 346, 343, 317, 366, 447},
+    {379, 448, 403, 350, 353, 351, 379, 448, 403},
+    {448, 386, 329, 353, 356, 354, 448, 386, 329},
+    {402, 330, 386, 355, 434, 356, 402, 330, 386},
+    {327, 402, 448, 357, 355, 353, 327, 402, 448},
+    {323, 372, 449, 358, 363, 359, 323, 372, 449},
+    {438, 449, 363, 360, 359, 361, 438, 449, 363},
+    {437, 337, 363, 331, 333, 361, 437, 337, 363},
+    {372, 322, 437, 363, 329, 331, 372, 322, 437},
+    {427, 450, 424, 364, 367, 365, 427, 450, 424},
+    {450, 429, 325, 367, 370, 368, 450, 429, 325},
+    {413, 301, 429, 369, 486, 370, 413, 301, 429},
+    {347, 413, 450, 371, 369, 367, 347, 413, 450},
+    {354, 451, 361, 372, 374, 373, 354, 451, 361},
+    {451, 389, 307, 374, 376, 325, 451, 389, 307},
+    {451, 419, 333, 374, 653, 375, 451, 419, 333},
+    {325, 419, 451, 377, 653, 374, 325, 419, 451},
+    {408, 452, 415, 378, 381, 379, 408, 452, 415},
+    {452, 395, 340, 381, 384, 382, 452, 395, 340},
+    {418, 299, 395, 383, 489, 384, 418, 299, 395},
+    {315, 418, 452, 385, 383, 381, 315, 418, 452},
+    {442, 453, 407, 386, 389, 387, 442, 453, 407},
+    {453, 434, 332, 389, 392, 390, 453, 434, 332},
+    {425, 344, 434, 391, 444, 392, 425, 344, 434},
+    {347, 425, 453, 371, 391, 389, 347, 425, 453},
+    {335, 414, 454, 393, 398, 394, 335, 414, 454},
+    {406, 454, 381, 395, 394, 396, 406, 454, 381},
+    {454, 405, 321, 394, 399, 397, 454, 405, 321},
+    {414, 334, 405, 398, 526, 399, 414, 334, 405},
+    {341, 376, 455, 400, 405, 401, 341, 376, 455},
+    {399, 455, 423, 402, 401, 403, 399, 455, 423},
+    {455, 426, 345, 401, 406, 404, 455, 426, 345},
+    {376, 346, 426, 405, 518, 406, 376, 346, 426},
+    {322, 382, 456, 329, 411, 407, 322, 382, 456},
+    {371, 456, 348, 335, 407, 408, 371, 456, 348},
+    {456, 368, 302, 407, 412, 410, 456, 368, 302},
+    {382, 320, 368, 411, 515, 412, 382, 320, 368},
+    {316, 362, 457, 413, 416, 414, 316, 362, 457},
+    {457, 348, 302, 414, 408, 410, 457, 348, 302},
+    {457, 360, 311, 414, 417, 409, 457, 360, 311},
+    {362, 319, 360, 416, 429, 417, 362, 319, 360},
+    {422, 458, 383, 418, 421, 419, 422, 458, 383},
+    {458, 421, 341, 421, 424, 422, 458, 421, 341},
+    {397, 344, 421, 423, 444, 424, 397, 344, 421},
+    {343, 397, 458, 425, 423, 421, 343, 397, 458},
+    {326, 401, 459, 426, 430, 427, 326, 401, 459},
+    {433, 459, 360, 428, 427, 417, 433, 459, 360},
+    {459, 436, 311, 427, 336, 409, 459, 436, 311},
+    {304, 436, 459, 334, 336, 427, 304, 436, 459},
+    {380, 460, 374, 431, 433, 432, 380, 460, 374},
+    {460, 386, 330, 433, 356, 434, 460, 386, 330},
+    {460, 396, 329, 433, 435, 354, 460, 396, 329},
+    {380, 331, 396, 431, 442, 435, 380, 331, 396},
+    {349, 461, 353, 341, 437, 436, 349, 461, 353},
+    {461, 364, 315, 437, 440, 438, 461, 364, 315},
+    {461, 355, 317, 437, 446, 439, 461, 355, 317},
+    {306, 355, 461, 340, 446, 437, 306, 355, 461},
+    {434, 462, 380, 392, 443, 431, 434, 462, 380},
+    {380, 462, 441, 431, 443, 441, 380, 462, 441},
+    {462, 397, 343, 443, 423, 425, 462, 397, 343},
+    {344, 397, 462, 444, 423, 443, 344, 397, 462},
+    {306, 351, 463, 340, 449, 445, 306, 351, 463},
+    {355, 463, 366, 446, 445, 447, 355, 463, 366},
+    {463, 356, 318, 445, 450, 448, 463, 356, 318},
+    {351, 313, 356, 449, 324, 450, 351, 313, 356},
+    {433, 464, 377, 451, 454, 452, 433, 464, 377},
+    {464, 439, 300, 454, 457, 455, 464, 439, 300},
+    {398, 314, 439, 456, 497, 457, 398, 314, 439},
+    {319, 398, 464, 458, 456, 454, 319, 398, 464},
+    {407, 465, 412, 387, 460, 459, 407, 465, 412},
+    {465, 409, 340, 460, 461, 382, 465, 409, 340},
+    {374, 330, 409, 432, 434, 461, 374, 330, 409},
+    {332, 374, 465, 390, 432, 460, 332, 374, 465},
+    {309, 440, 466, 462, 467, 463, 309, 440, 466},
+    {466, 430, 333, 463, 466, 465, 466, 430, 333},
+    {420, 318, 430, 347, 652, 466, 420, 318, 430},
+    {324, 420, 466, 345, 347, 463, 324, 420, 466},
+    {312, 394, 467, 468, 471, 469, 312, 394, 467},
+    {391, 467, 392, 470, 469, 344, 391, 467, 392},
+    {467, 390, 308, 469, 472, 342, 467, 390, 308},
+    {394, 299, 390, 471, 489, 472, 394, 299, 390},
+    {400, 468, 362, 473, 476, 474, 400, 468, 362},
+    {468, 398, 319, 476, 456, 458, 468, 398, 319},
+    {393, 314, 398, 477, 497, 456, 393, 314, 398},
+    {298, 393, 468, 478, 477, 476, 298, 393, 468},
+    {416, 469, 401, 479, 480, 430, 416, 469, 401},
+    {469, 365, 304, 480, 332, 334, 469, 365, 304},
+    {359, 337, 365, 481, 333, 332, 359, 337, 365},
+    {342, 359, 469, 482, 481, 480, 342, 359, 469},
+    {435, 470, 375, 483, 485, 484, 435, 470, 375},
+    {470, 442, 336, 485, 386, 388, 470, 442, 336},
+    {413, 347, 442, 369, 371, 386, 413, 347, 442},
+    {301, 413, 470, 486, 369, 485, 301, 413, 470},
+    {323, 381, 471, 358, 396, 487, 323, 381, 471},
+    {372, 471, 382, 363, 487, 411, 372, 471, 382},
+    {369, 320, 382, 488, 515, 411, 369, 320, 382},
+    {381, 321, 369, 396, 397, 488, 381, 321, 369},
+    {418, 472, 390, 383, 490, 472, 418, 472, 390},
+    {472, 417, 308, 490, 349, 342, 472, 417, 308},
+    {364, 317, 417, 491, 348, 349, 364, 317, 417},
+    {315, 364, 472, 385, 491, 490, 315, 364, 472},
+    {404, 473, 429, 492, 493, 370, 404, 473, 429},
+    {473, 419, 325, 493, 494, 368, 473, 419, 325},
+    {428, 333, 419, 464, 465, 494, 428, 333, 419},
+    {309, 428, 473, 462, 464, 493, 309, 428, 473},
+    {331, 441, 474, 442, 441, 495, 331, 441, 474},
+    {387, 474, 439, 496, 495, 457, 387, 474, 439},
+    {474, 411, 300, 495, 498, 455, 474, 411, 300},
+    {441, 343, 411, 441, 425, 498, 441, 343, 411},
+    {312, 391, 475, 468, 470, 499, 312, 391, 475},
+    {435, 475, 404, 483, 499, 492, 435, 475, 404},
+    {475, 440, 309, 499, 467, 462, 475, 440, 309},
+    {391, 324, 440, 470, 345, 467, 391, 324, 440},
+    {339, 410, 476, 500, 503, 501, 339, 410, 476},
+    {408, 476, 353, 502, 501, 436, 408, 476, 353},
+    {476, 370, 303, 501, 504, 339, 476, 370, 303},
+    {410, 334, 370, 503, 526, 504, 410, 334, 370},
+    {307, 389, 477, 325, 376, 505, 307, 389, 477},
+    {432, 477, 356, 326, 505, 450, 432, 477, 356},
+    {477, 430, 318, 505, 506, 448, 477, 430, 318},
+    {389, 333, 430, 376, 375, 506, 389, 333, 430},
+    {358, 478, 367, 415, 508, 507, 358, 478, 367},
+    {478, 384, 328, 508, 510, 509, 478, 384, 328},
+    {368, 320, 384, 412, 515, 510, 368, 320, 384},
+    {302, 368, 478, 410, 412, 508, 302, 368, 478},
+    {328, 384, 479, 509, 510, 511, 328, 384, 479},
+    {379, 479, 385, 512, 511, 513, 379, 479, 385},
+    {479, 369, 321, 511, 488, 397, 479, 369, 321},
+    {320, 369, 479, 515, 488, 511, 320, 369, 479},
+    {331, 387, 480, 442, 496, 516, 331, 387, 480},
+    {396, 480, 388, 435, 516, 517, 396, 480, 388},
+    {480, 393, 298, 516, 477, 478, 480, 393, 298},
+    {387, 314, 393, 496, 497, 477, 387, 314, 393},
+    {346, 424, 481, 518, 521, 519, 346, 424, 481},
+    {426, 481, 357, 406, 519, 520, 426, 481, 357},
+    {481, 354, 305, 519, 372, 327, 481, 354, 305},
+    {424, 325, 354, 521, 377, 372, 424, 325, 354},
+    {316, 367, 482, 475, 523, 522, 316, 367, 482},
+    {482, 388, 298, 522, 517, 478, 482, 388, 298},
+    {482, 403, 329, 522, 351, 354, 482, 403, 329},
+    {367, 328, 403, 523, 352, 351, 367, 328, 403},
+    {327, 385, 483, 514, 513, 524, 327, 385, 483},
+    {378, 483, 410, 525, 524, 503, 378, 483, 410},
+    {483, 405, 334, 524, 399, 526, 483, 405, 334},
+    {385, 321, 405, 513, 397, 399, 385, 321, 405},
+    {326, 377, 484, 453, 452, 527, 326, 377, 484},
+    {416, 484, 422, 528, 527, 418, 416, 484, 422},
+    {484, 411, 343, 527, 498, 425, 484, 411, 343},
+    {300, 411, 484, 455, 498, 527, 300, 411, 484},
+    {310, 373, 485, 321, 530, 529, 310, 373, 485},
+    {431, 485, 357, 328, 529, 520, 431, 485, 357},
+    {485, 443, 345, 529, 531, 404, 485, 443, 345},
+    {373, 335, 443, 530, 393, 531, 373, 335, 443},
+    {342, 383, 486, 482, 533, 532, 342, 383, 486},
+    {486, 363, 337, 532, 361, 333, 486, 363, 337},
+    {486, 399, 338, 532, 402, 362, 486, 399, 338},
+    {383, 341, 399, 533, 400, 402, 383, 341, 399},
+    {375, 487, 394, 484, 534, 471, 375, 487, 394},
+    {487, 395, 299, 534, 384, 489, 487, 395, 299},
+    {412, 340, 395, 459, 382, 384, 412, 340, 395},
+    {336, 412, 487, 388, 459, 534, 336, 412, 487},
+    {421, 488, 376, 424, 536, 535, 421, 488, 376},
+    {488, 427, 346, 536, 364, 366, 488, 427, 346},
+    {425, 347, 427, 391, 371, 364, 425, 347, 427},
+    {344, 425, 488, 444, 391, 536, 344, 425, 488},
+    {310, 350, 489, 321, 338, 537, 310, 350, 489},
+    {373, 489, 414, 530, 537, 398, 373, 489, 414},
+    {489, 370, 334, 537, 504, 526, 489, 370, 334},
+    {350, 303, 370, 338, 339, 504, 350, 303, 370},
+    {378, 490, 402, 538, 539, 355, 378, 490, 402},
+    {490, 409, 330, 539, 461, 434, 490, 409, 330},
+    {415, 340, 409, 379, 382, 461, 415, 340, 409},
+    {339, 415, 490, 380, 379, 539, 339, 415, 490},
+    {335, 406, 491, 393, 395, 540, 335, 406, 491},
+    {443, 491, 423, 531, 540, 403, 443, 491, 423},
+    {491, 438, 338, 540, 360, 362, 491, 438, 338},
+    {406, 323, 438, 395, 358, 360, 406, 323, 438},
+    {492, 501, 512, 541, 545, 542, 492, 501, 512},
+    {493, 502, 512, 544, 577, 542, 493, 502, 512},
+    {512, 502, 495, 542, 577, 546, 512, 502, 495},
+    {512, 503, 494, 542, 547, 548, 512, 503, 494},
+    {503, 513, 504, 547, 551, 549, 503, 513, 504},
+    {503, 495, 505, 547, 546, 550, 503, 495, 505},
+    {505, 499, 506, 550, 556, 552, 505, 499, 506},
+    {504, 513, 506, 549, 551, 552, 504, 513, 506},
+    {498, 506, 514, 553, 552, 554, 498, 506, 514},
+    {499, 508, 514, 556, 572, 554, 499, 508, 514},
+    {514, 508, 497, 554, 572, 557, 514, 508, 497},
+    {514, 509, 496, 554, 558, 559, 514, 509, 496},
+    {509, 515, 510, 558, 562, 560, 509, 515, 510},
+    {509, 497, 511, 558, 557, 561, 509, 497, 511},
+    {511, 493, 501, 561, 654, 563, 511, 493, 501},
+    {510, 515, 501, 560, 562, 563, 510, 515, 501},
+    {494, 504, 516, 565, 568, 566, 494, 504, 516},
+    {498, 507, 516, 553, 555, 566, 498, 507, 516},
+    {516, 507, 496, 566, 555, 559, 516, 507, 496},
+    {516, 510, 492, 566, 569, 570, 516, 510, 492},
+    {499, 505, 517, 556, 574, 571, 499, 505, 517},
+    {495, 502, 517, 573, 578, 571, 495, 502, 517},
+    {517, 502, 493, 571, 578, 575, 517, 502, 493},
+    {517, 511, 497, 571, 576, 557, 517, 511, 497},
+    {518, 526, 538, 541, 543, 542, 518, 526, 538},
+    {538, 528, 519, 542, 577, 544, 538, 528, 519},
+    {538, 529, 521, 542, 547, 546, 538, 529, 521},
+    {520, 529, 538, 548, 547, 542, 520, 529, 538},
+    {530, 539, 529, 549, 551, 547, 530, 539, 529},
+    {529, 539, 531, 547, 551, 550, 529, 539, 531},
+    {532, 525, 531, 552, 556, 550, 532, 525, 531},
+    {530, 524, 532, 549, 553, 552, 530, 524, 532},
+    {524, 533, 540, 553, 555, 554, 524, 533, 540},
+    {540, 534, 525, 554, 572, 556, 540, 534, 525},
+    {540, 535, 523, 554, 558, 557, 540, 535, 523},
+    {522, 535, 540, 559, 558, 554, 522, 535, 540},
+    {536, 541, 535, 560, 562, 558, 536, 541, 535},
+    {535, 541, 537, 558, 562, 561, 535, 541, 537},
+    {527, 519, 537, 563, 654, 561, 527, 519, 537},
+    {536, 518, 527, 560, 564, 563, 536, 518, 527},
+    {520, 526, 542, 565, 567, 566, 520, 526, 516},
+    {542, 533, 524, 566, 555, 553, 516, 533, 524},
+    {542, 536, 522, 566, 569, 559, 516, 536, 522},
+    {518, 536, 542, 570, 569, 566, 518, 536, 516},
+    {525, 534, 543, 556, 572, 571, 525, 534, 542},
+    {543, 528, 521, 571, 578, 573, 542, 528, 521},
+    {543, 537, 519, 571, 576, 575, 542, 537, 519},
+    {523, 537, 543, 557, 576, 571, 523, 537, 542},
+    {544, 552, 564, 579, 586, 580, 543, 551, 563},
+    {564, 554, 545, 580, 584, 582, 563, 553, 544},
+    {564, 555, 547, 580, 588, 583, 563, 554, 546},
+    {546, 555, 564, 585, 588, 580, 545, 554, 563},
+    {556, 565, 555, 587, 589, 588, 555, 564, 554},
+    {565, 557, 547, 589, 591, 583, 564, 556, 546},
+    {565, 558, 551, 589, 592, 590, 564, 557, 550},
+    {556, 550, 558, 587, 593, 592, 555, 549, 557},
+    {550, 559, 566, 593, 598, 594, 549, 558, 565},
+    {566, 560, 551, 594, 596, 590, 565, 559, 550},
+    {566, 561, 549, 594, 600, 595, 565, 560, 548},
+    {548, 561, 566, 597, 600, 594, 547, 560, 565},
+    {562, 567, 561, 599, 603, 600, 561, 566, 560},
+    {561, 567, 563, 600, 603, 601, 560, 566, 562},
+    {553, 545, 563, 602, 655, 601, 552, 544, 562},
+    {562, 544, 553, 599, 656, 602, 561, 543, 552},
+    {546, 552, 568, 604, 608, 605, 545, 551, 567},
+    {568, 559, 550, 605, 598, 593, 567, 558, 549},
+    {568, 562, 548, 605, 657, 597, 567, 561, 547},
+    {544, 562, 568, 607, 657, 605, 543, 561, 567},
+    {551, 560, 569, 590, 596, 609, 550, 559, 568},
+    {569, 554, 547, 609, 613, 611, 568, 553, 546},
+    {569, 563, 545, 609, 658, 612, 568, 562, 544},
+    {549, 563, 569, 595, 658, 609, 548, 562, 568},
+    {570, 579, 590, 614, 618, 615, 569, 578, 589},
+    {571, 580, 590, 617, 659, 615, 570, 579, 589},
+    {590, 580, 573, 615, 659, 619, 589, 579, 572},
+    {590, 581, 572, 615, 620, 621, 589, 580, 571},
+    {581, 591, 582, 620, 623, 622, 580, 590, 581},
+    {573, 583, 591, 619, 660, 623, 572, 582, 590},
+    {591, 583, 577, 623, 660, 624, 590, 582, 576},
+    {582, 591, 584, 622, 623, 625, 581, 590, 583},
+    {576, 584, 592, 626, 625, 627, 575, 583, 591},
+    {577, 586, 592, 624, 644, 627, 576, 585, 591},
+    {592, 586, 575, 627, 644, 629, 591, 585, 574},
+    {592, 587, 574, 627, 630, 631, 591, 586, 573},
+    {587, 593, 588, 630, 634, 632, 586, 592, 587},
+    {587, 575, 589, 630, 629, 633, 586, 574, 588},
+    {589, 571, 579, 633, 661, 635, 588, 570, 578},
+    {588, 593, 579, 632, 634, 635, 587, 592, 578},
+    {572, 582, 594, 637, 640, 638, 571, 581, 567},
+    {576, 585, 594, 626, 628, 638, 575, 584, 567},
+    {594, 585, 574, 638, 628, 631, 567, 584, 573},
+    {594, 588, 570, 638, 641, 642, 567, 587, 569},
+    {577, 583, 595, 624, 646, 643, 576, 582, 593},
+    {573, 580, 595, 645, 662, 643, 572, 579, 593},
+    {595, 580, 571, 643, 662, 647, 593, 579, 570},
+    {595, 589, 575, 643, 648, 629, 593, 588, 574},
+};
+#define mesh_stride 8
+#define mesh_vertices_count 1680
+static const float mesh_vertices[][8] = {
+    {0.000001, 0.299176, 0.317780, -0.000000, -0.991500, -0.130400, 0.009831, 0.035651},
+    {-0.188143, 0.307190, 0.152513, -0.253300, -0.885000, -0.390600, 0.022569, 0.022913},
+    {0.000001, 0.324976, 0.114528, -0.000000, -0.934700, -0.355400, 0.022569, 0.010176},
+    {-0.130370, 0.265927, 0.489209, -0.229800, -0.938200, 0.258900, 0.022569, 0.048389},
+    {-0.180047, 0.277640, 0.319767, -0.321800, -0.944800, -0.061600, 0.022569, 0.035651},
+    {0.130372, 0.265927, 0.489209, 0.229800, -0.938200, 0.258900, 0.022569, 0.048389},
+    {0.000001, 0.274670, 0.525006, -0.000000, -0.947600, 0.319500, 0.009831, 0.048389},
+    {0.188144, 0.307190, 0.152513, 0.253300, -0.885000, -0.390600, 0.022569, 0.022913},
+    {0.180049, 0.277640, 0.319767, 0.321800, -0.944800, -0.061600, 0.022569, 0.035651},
+    {-0.226973, 0.319387, 0.323315, -0.975100, 0.137700, 0.173700, 0.030000, 0.035651},
+    {-0.243691, 0.346372, 0.133902, -0.853500, 0.130300, -0.504500, 0.030000, 0.022913},
+    {0.000001, 0.350074, 0.072915, -0.000000, -0.206000, -0.978500, 0.027346, 0.012829},
+    {0.243692, 0.346372, 0.133902, 0.853500, 0.130300, -0.504500, 0.030000, 0.022913},
+    {0.226975, 0.319387, 0.323315, 0.975100, 0.137700, 0.173700, 0.030000, 0.035651},
+    {0.168863, 0.299834, 0.513638, 0.736200, 0.042700, 0.675400, 0.030000, 0.048389},
+    {0.000001, 0.310883, 0.573716, -0.000000, -0.100500, 0.994900, 0.027346, 0.058473},
+    {-0.104332, 0.344153, 0.453780, -0.332100, 0.907400, 0.257700, 0.048045, 0.048389},
+    {-0.168862, 0.299834, 0.513638, -0.736200, 0.042700, 0.675400, 0.030000, 0.048389},
+    {0.104333, 0.344153, 0.453780, 0.332100, 0.907400, 0.257700, 0.048045, 0.048389},
+    {0.000001, 0.358750, 0.554339, -0.000000, 0.700000, 0.714200, 0.058552, 0.058052},
+    {0.131147, 0.388591, 0.162489, 0.396000, 0.898300, -0.190300, 0.048045, 0.022913},
+    {0.057949, 0.376879, 0.331929, 0.299700, 0.939500, 0.165900, 0.048045, 0.035651},
+    {0.000001, 0.394519, 0.330803, -0.000000, 0.972000, 0.234800, 0.060783, 0.035651},
+    {0.000001, 0.496334, 0.127686, -0.000000, 0.935600, -0.353000, 0.060783, 0.022913},
+    {-0.057947, 0.376879, 0.331929, -0.299700, 0.939500, 0.165900, 0.048045, 0.035651},
+    {-0.131146, 0.388591, 0.162489, -0.396000, 0.898300, -0.190300, 0.048045, 0.022913},
+    {-0.198985, 0.266606, 0.136377, 0.330900, 0.847800, 0.414400, 0.042069, 0.919810},
+    {0.000001, 0.254558, 0.311922, -0.000000, 0.992100, 0.125100, 0.025357, 0.936523},
+    {0.000001, 0.285221, 0.093446, -0.000000, 0.891600, 0.452700, 0.042069, 0.903098},
+    {-0.270887, 0.324653, 0.331611, 0.974800, -0.141000, -0.172900, 0.051818, 0.936523},
+    {-0.193921, 0.234890, 0.317526, 0.397200, 0.916700, 0.044200, 0.042069, 0.936523},
+    {0.000001, 0.341621, 0.028716, -0.000000, 0.108200, 0.994100, 0.048336, 0.906579},
+    {-0.282685, 0.344434, 0.111528, 0.849300, -0.099300, 0.518400, 0.051818, 0.919810},
+    {0.198986, 0.266606, 0.136377, -0.330900, 0.847800, 0.414400, 0.042069, 0.919810},
+    {0.157927, 0.424052, 0.155393, -0.486800, -0.836100, 0.253100, 0.075494, 0.919810},
+    {0.000001, 0.540575, 0.119456, -0.000000, -0.930100, 0.367300, 0.092207, 0.919810},
+    {-0.157925, 0.424052, 0.155393, 0.486800, -0.836100, 0.253100, 0.075494, 0.919810},
+    {0.282686, 0.344434, 0.111528, -0.849300, -0.099300, 0.518400, 0.051818, 0.919810},
+    {-0.077842, 0.415285, 0.344349, 0.361800, -0.906900, -0.216000, 0.075494, 0.936523},
+    {0.077843, 0.415285, 0.344349, -0.361800, -0.906900, -0.216000, 0.075494, 0.936523},
+    {0.000001, 0.435469, 0.349460, -0.000000, -0.956700, -0.290900, 0.092207, 0.936523},
+    {0.270889, 0.324653, 0.331611, -0.974800, -0.141000, -0.172900, 0.051818, 0.936523},
+    {0.193922, 0.234890, 0.317526, -0.397200, 0.916700, 0.044200, 0.042069, 0.936523},
+    {0.120149, 0.384523, 0.465828, -0.403500, -0.864300, -0.300200, 0.075494, 0.953235},
+    {0.140608, 0.223568, 0.500432, -0.295800, 0.903800, -0.309400, 0.042069, 0.953235},
+    {0.202726, 0.298988, 0.543263, -0.734700, -0.023800, -0.678000, 0.051818, 0.953235},
+    {-0.120148, 0.384523, 0.465828, 0.403500, -0.864300, -0.300200, 0.075494, 0.953235},
+    {0.000001, 0.398764, 0.574928, -0.000000, -0.735200, -0.677900, 0.089279, 0.965914},
+    {0.000001, 0.315446, 0.618483, -0.000000, -0.004100, -1.000000, 0.048336, 0.966466},
+    {-0.202724, 0.298988, 0.543263, 0.734700, -0.023800, -0.678000, 0.051818, 0.953235},
+    {0.000001, 0.232652, 0.541115, -0.000000, 0.904600, -0.426300, 0.025357, 0.953235},
+    {-0.140606, 0.223568, 0.500432, 0.295800, 0.903800, -0.309400, 0.042069, 0.953235},
+    {0.160000, 0.434738, 0.162932, -0.039100, -0.987200, 0.154800, 0.044493, 0.911901},
+    {0.157321, 0.468989, 0.193512, 0.055900, -0.163700, 0.984900, 0.049930, 0.920258},
+    {0.122857, 0.451952, 0.182750, -0.715800, -0.495400, 0.492100, 0.041425, 0.922613},
+    {0.178328, 0.449548, 0.177566, 0.392400, -0.623200, 0.676500, 0.050252, 0.914080},
+    {0.219280, 0.459575, 0.124332, 0.478900, -0.861200, -0.170300, 0.059845, 0.902693},
+    {0.125531, 0.496723, 0.175191, -0.810200, 0.399500, 0.429100, 0.049566, 0.930222},
+    {0.150055, 0.500390, 0.187622, -0.191300, 0.426400, 0.884100, 0.053383, 0.925391},
+    {0.215591, 0.506744, 0.166448, 0.508200, 0.113800, 0.853700, 0.063656, 0.916457},
+    {0.227335, 0.474524, 0.151095, 0.697700, -0.479600, 0.532100, 0.061683, 0.909329},
+    {0.264913, 0.509470, 0.118037, 0.908900, -0.265800, 0.321400, 0.073930, 0.907524},
+    {0.265559, 0.507793, 0.090357, 0.810200, -0.399500, -0.429100, 0.077747, 0.902693},
+    {0.192866, 0.536507, 0.163355, 0.069000, 0.651200, 0.755800, 0.065630, 0.923586},
+    {0.236641, 0.560312, 0.128093, 0.325200, 0.783800, 0.529000, 0.077061, 0.918835},
+    {0.262880, 0.542042, 0.120938, 0.808700, 0.357300, 0.467400, 0.077383, 0.912657},
+    {0.171809, 0.544940, 0.141216, -0.478900, 0.861200, 0.170300, 0.067468, 0.930222},
+    {0.231091, 0.569777, 0.102617, 0.039100, 0.987200, -0.154800, 0.082820, 0.921014},
+    {0.268234, 0.552563, 0.082799, 0.715800, 0.495400, -0.492100, 0.085888, 0.910302},
+    {0.212762, 0.554968, 0.087983, -0.392400, 0.623200, -0.676500, 0.029819, 0.983012},
+    {0.171809, 0.544940, 0.141216, -0.478900, 0.861200, 0.170300, 0.041206, 0.973418},
+    {0.231091, 0.569777, 0.102617, 0.039100, 0.987200, -0.154800, 0.031998, 0.988770},
+    {0.175499, 0.497771, 0.099102, -0.508200, -0.113800, -0.853700, 0.027441, 0.969607},
+    {0.233770, 0.535526, 0.072038, -0.055900, 0.163700, -0.984900, 0.023641, 0.983334},
+    {0.163756, 0.529991, 0.114455, -0.697700, 0.479600, -0.532100, 0.034570, 0.971581},
+    {0.126178, 0.495046, 0.147512, -0.908900, 0.265800, -0.321400, 0.036375, 0.959334},
+    {0.125531, 0.496723, 0.175191, -0.810200, 0.399500, 0.429100, 0.041206, 0.955516},
+    {0.241036, 0.504125, 0.077927, 0.191300, -0.426400, -0.884100, 0.018508, 0.979880},
+    {0.154450, 0.444203, 0.137456, -0.325200, -0.783800, -0.529000, 0.025064, 0.956202},
+    {0.198224, 0.468008, 0.102195, -0.069000, -0.651200, -0.755800, 0.020313, 0.967633},
+    {0.128210, 0.462473, 0.144612, -0.808700, -0.357300, -0.467400, 0.031242, 0.955880},
+    {0.268234, 0.552563, 0.082799, 0.715800, 0.495400, -0.492100, 0.021286, 0.991838},
+    {0.265559, 0.507793, 0.090357, 0.810200, -0.399500, -0.429100, 0.013677, 0.983697},
+    {0.219280, 0.459575, 0.124332, 0.478900, -0.861200, -0.170300, 0.013677, 0.965795},
+    {0.160000, 0.434738, 0.162932, -0.039100, -0.987200, 0.154800, 0.022885, 0.950443},
+    {0.122857, 0.451952, 0.182750, -0.715800, -0.495400, 0.492100, 0.033597, 0.947375},
+    {-0.219280, 0.459575, 0.124332, -0.478900, -0.861200, -0.170300, 0.041206, 0.928736},
+    {-0.241034, 0.504125, 0.077927, -0.191300, -0.426400, -0.884100, 0.029819, 0.938329},
+    {-0.198223, 0.468008, 0.102195, 0.069000, -0.651200, -0.755800, 0.034570, 0.926898},
+    {-0.154448, 0.444203, 0.137456, 0.325200, -0.783800, -0.529000, 0.036375, 0.914651},
+    {-0.159998, 0.434738, 0.162932, 0.039100, -0.987200, 0.154800, 0.041206, 0.910834},
+    {-0.265558, 0.507793, 0.090357, -0.810200, -0.399500, -0.429100, 0.031998, 0.944088},
+    {-0.175498, 0.497771, 0.099102, 0.508200, -0.113800, -0.853700, 0.027441, 0.924925},
+    {-0.233768, 0.535526, 0.072038, 0.055900, 0.163700, -0.984900, 0.023641, 0.938651},
+    {-0.128209, 0.462473, 0.144612, 0.808700, -0.357300, -0.467400, 0.031242, 0.911198},
+    {-0.122855, 0.451952, 0.182750, 0.715800, -0.495400, 0.492100, 0.033597, 0.902693},
+    {-0.126176, 0.495046, 0.147512, 0.908900, 0.265800, -0.321400, 0.025064, 0.911520},
+    {-0.125530, 0.496723, 0.175191, 0.810200, 0.399500, 0.429100, 0.022885, 0.905761},
+    {-0.212761, 0.554968, 0.087983, 0.392400, 0.623200, -0.676500, 0.018508, 0.935198},
+    {-0.163754, 0.529991, 0.114455, 0.697700, 0.479600, -0.532100, 0.020313, 0.922951},
+    {-0.231089, 0.569777, 0.102617, -0.039100, 0.987200, -0.154800, 0.013677, 0.939015},
+    {-0.268232, 0.552563, 0.082800, -0.715800, 0.495400, -0.492100, 0.021286, 0.947156},
+    {-0.171808, 0.544940, 0.141216, 0.478900, 0.861200, 0.170300, 0.013677, 0.921113},
+    {-0.171808, 0.544940, 0.141216, 0.478900, 0.861200, 0.170300, 0.068954, 0.965795},
+    {-0.150053, 0.500390, 0.187622, 0.191300, 0.426400, 0.884100, 0.057567, 0.956202},
+    {-0.125530, 0.496723, 0.175191, 0.810200, 0.399500, 0.429100, 0.059746, 0.950443},
+    {-0.236639, 0.560312, 0.128093, -0.325200, 0.783800, 0.529000, 0.064123, 0.979880},
+    {-0.192865, 0.536507, 0.163355, -0.069000, 0.651200, 0.755800, 0.062318, 0.967633},
+    {-0.231089, 0.569777, 0.102617, -0.039100, 0.987200, -0.154800, 0.068954, 0.983697},
+    {-0.215590, 0.506744, 0.166448, -0.508200, 0.113800, 0.853700, 0.055189, 0.969607},
+    {-0.157319, 0.468989, 0.193512, -0.055900, -0.163700, 0.984900, 0.051388, 0.955880},
+    {-0.122855, 0.451952, 0.182750, 0.715800, -0.495400, 0.492100, 0.049034, 0.947375},
+    {-0.178327, 0.449548, 0.177566, -0.392400, -0.623200, 0.676500, 0.046256, 0.959334},
+    {-0.159998, 0.434738, 0.162932, 0.039100, -0.987200, 0.154800, 0.041425, 0.955516},
+    {-0.262879, 0.542042, 0.120938, -0.808700, 0.357300, 0.467400, 0.058990, 0.983334},
+    {-0.264911, 0.509470, 0.118037, -0.908900, -0.265800, 0.321400, 0.052812, 0.983012},
+    {-0.227333, 0.474524, 0.151095, -0.697700, -0.479600, 0.532100, 0.048061, 0.971581},
+    {-0.268232, 0.552563, 0.082800, -0.715800, 0.495400, -0.492100, 0.061345, 0.991838},
+    {-0.265558, 0.507793, 0.090357, -0.810200, -0.399500, -0.429100, 0.050633, 0.988770},
+    {-0.219280, 0.459575, 0.124332, -0.478900, -0.861200, -0.170300, 0.041425, 0.973418},
+    {0.000001, -0.571441, -0.543753, -0.000000, -0.244800, -0.969600, 0.229068, 0.283003},
+    {-0.174280, -0.704023, -0.455259, -0.292300, -0.599400, -0.745200, 0.171021, 0.368583},
+    {-0.193304, -0.570808, -0.511405, -0.342600, -0.251700, -0.905100, 0.235716, 0.372905},
+    {0.174281, -0.704024, -0.455259, 0.292300, -0.599400, -0.745200, 0.159565, 0.206435},
+    {0.000001, -0.710828, -0.485344, -0.000000, -0.613400, -0.789800, 0.161402, 0.287784},
+    {-0.197051, -0.413219, -0.526654, -0.349800, -0.002400, -0.936800, 0.309148, 0.369469},
+    {0.000001, -0.411439, -0.558484, -0.000000, -0.003800, -1.000000, 0.303499, 0.277744},
+    {0.197053, -0.413219, -0.526654, 0.349800, -0.002400, -0.936800, 0.296194, 0.186135},
+    {0.193306, -0.570808, -0.511405, 0.342600, -0.251700, -0.905100, 0.223009, 0.193059},
+    {-0.358873, -0.578813, -0.404284, -0.679000, -0.266800, -0.684000, 0.237434, 0.450190},
+    {-0.366301, -0.421561, -0.422379, -0.700200, -0.004900, -0.713900, 0.310830, 0.448476},
+    {-0.342110, -0.239909, -0.419029, -0.678500, 0.157300, -0.717500, 0.394538, 0.431253},
+    {-0.183424, -0.235276, -0.513898, -0.343800, 0.132800, -0.929600, 0.391478, 0.357281},
+    {0.000001, -0.233795, -0.543821, -0.000000, 0.117700, -0.993000, 0.386138, 0.271905},
+    {0.183425, -0.235276, -0.513898, 0.343800, 0.132800, -0.929600, 0.379420, 0.186626},
+    {0.342112, -0.239909, -0.419029, 0.678500, 0.157300, -0.717500, 0.372049, 0.112959},
+    {0.366302, -0.421561, -0.422379, 0.700200, -0.004900, -0.713900, 0.286751, 0.107677},
+    {0.358874, -0.578813, -0.404284, 0.679000, -0.266800, -0.684000, 0.213843, 0.116300},
+    {0.483043, -0.437992, -0.241275, 0.922300, -0.004200, -0.386500, 0.274120, 0.050504},
+    {0.453620, -0.247694, -0.257920, 0.900800, 0.173400, -0.398200, 0.364516, 0.057606},
+    {0.294743, -0.039434, -0.403273, 0.659700, 0.210300, -0.721500, 0.466865, 0.128406},
+    {0.395044, -0.043952, -0.266310, 0.876800, 0.235700, -0.419100, 0.461538, 0.079237},
+    {0.156919, -0.035966, -0.486609, 0.344700, 0.178200, -0.921700, 0.473008, 0.192406},
+    {-0.156917, -0.035966, -0.486609, -0.344700, 0.178200, -0.921700, 0.483323, 0.338399},
+    {0.000001, -0.034412, -0.513778, -0.000000, 0.161600, -0.986900, 0.478888, 0.265352},
+    {0.132884, 0.180638, -0.451963, 0.349400, 0.177800, -0.920000, 0.574560, 0.196467},
+    {0.251099, 0.175670, -0.379512, 0.658100, 0.182700, -0.730400, 0.568364, 0.141638},
+    {0.339472, 0.169760, -0.263785, 0.875800, 0.190200, -0.443600, 0.562792, 0.099218},
+    {0.380816, 0.159715, -0.129771, 0.974800, 0.216000, -0.056700, 0.557045, 0.073896},
+    {0.442040, -0.052336, -0.099382, 0.957300, 0.283400, -0.057300, 0.456667, 0.039012},
+    {0.504716, -0.257458, -0.054706, 0.974300, 0.217100, -0.059500, 0.356289, 0.004127},
+    {0.534974, -0.452152, -0.014140, 0.997900, 0.024400, -0.059200, 0.258456, 0.004127},
+    {0.472010, -0.602954, -0.217557, 0.884900, -0.280800, -0.371600, 0.196028, 0.060322},
+    {0.520151, -0.621311, 0.012464, 0.955600, -0.292000, -0.040100, 0.160623, 0.004128},
+    {0.320236, -0.702955, -0.359127, 0.567600, -0.575000, -0.589200, 0.156030, 0.138449},
+    {0.416225, -0.727564, -0.190293, 0.700900, -0.647500, -0.299100, 0.137983, 0.091398},
+    {0.454603, -0.745843, 0.019679, 0.705100, -0.708900, -0.015500, 0.109722, 0.052739},
+    {0.339575, -0.802283, 0.011226, 0.210300, -0.977600, -0.013000, 0.058820, 0.101351},
+    {0.316384, -0.793309, -0.176827, 0.279200, -0.949800, -0.141100, 0.095632, 0.140872},
+    {0.273548, -0.771223, -0.306753, 0.333300, -0.860900, -0.384400, 0.118666, 0.162916},
+    {0.160103, -0.784519, -0.351702, 0.156800, -0.923700, -0.349600, 0.108167, 0.216695},
+    {0.171517, -0.796382, -0.194544, -0.013800, -0.999800, -0.013500, 0.068431, 0.212573},
+    {0.181417, -0.784429, -0.005086, -0.101700, -0.994800, -0.000000, 0.031594, 0.200115},
+    {0.000001, -0.759469, -0.014259, -0.000000, -0.999900, 0.013000, 0.004367, 0.298879},
+    {0.000001, -0.784976, -0.208845, -0.000000, -0.998600, 0.052400, 0.059852, 0.294958},
+    {0.000001, -0.790496, -0.374140, -0.000000, -0.947900, -0.318600, 0.104567, 0.291799},
+    {-0.160102, -0.784519, -0.351702, -0.156800, -0.923700, -0.349600, 0.118691, 0.365651},
+    {-0.171515, -0.796382, -0.194544, 0.013800, -0.999800, -0.013500, 0.079930, 0.375319},
+    {-0.181415, -0.784429, -0.005086, 0.101700, -0.994800, -0.000000, 0.045210, 0.392834},
+    {-0.273547, -0.771223, -0.306753, -0.333300, -0.860900, -0.384400, 0.136648, 0.417420},
+    {-0.316382, -0.793309, -0.176827, -0.279200, -0.949800, -0.141100, 0.116942, 0.442483},
+    {-0.320234, -0.702955, -0.359127, -0.567600, -0.575000, -0.589200, 0.177081, 0.436390},
+    {-0.472009, -0.602954, -0.217557, -0.884900, -0.280800, -0.371600, 0.227666, 0.508117},
+    {-0.416224, -0.727564, -0.190293, -0.700900, -0.647500, -0.299100, 0.165829, 0.485511},
+    {-0.339574, -0.802283, 0.011226, -0.210300, -0.977600, -0.013000, 0.086053, 0.486788},
+    {-0.454601, -0.745843, 0.019679, -0.705100, -0.708900, -0.015500, 0.143284, 0.527760},
+    {-0.520150, -0.621311, 0.012464, -0.955600, -0.292000, -0.040100, 0.200515, 0.568731},
+    {-0.483041, -0.437992, -0.241275, -0.922300, -0.004200, -0.386500, 0.306364, 0.506857},
+    {-0.534973, -0.452152, -0.014140, -0.997900, 0.024400, -0.059200, 0.297376, 0.554975},
+    {-0.504715, -0.257458, -0.054706, -0.974300, 0.217100, -0.059500, 0.394237, 0.541219},
+    {-0.453619, -0.247694, -0.257920, -0.900800, 0.173400, -0.398200, 0.394863, 0.487115},
+    {-0.395042, -0.043952, -0.266310, -0.876800, 0.235700, -0.419100, 0.487880, 0.452057},
+    {-0.442039, -0.052336, -0.099382, -0.957300, 0.283400, -0.057300, 0.488713, 0.492568},
+    {-0.294742, -0.039434, -0.403273, -0.659700, 0.210300, -0.721500, 0.486240, 0.402628},
+    {-0.380815, 0.159715, -0.129771, -0.974800, 0.216000, -0.056700, 0.583189, 0.443916},
+    {-0.339470, 0.169760, -0.263785, -0.875800, 0.190200, -0.443600, 0.585318, 0.418038},
+    {-0.251098, 0.175670, -0.379512, -0.658100, 0.182700, -0.730400, 0.584870, 0.375255},
+    {-0.312544, 0.387668, -0.247344, -0.882600, 0.154800, -0.443800, 0.685605, 0.399110},
+    {-0.348029, 0.373915, -0.130422, -0.988600, 0.143000, -0.047000, 0.685443, 0.431535},
+    {-0.132883, 0.180638, -0.451963, -0.349400, 0.177800, -0.920000, 0.583296, 0.320100},
+    {-0.232861, 0.397189, -0.349008, -0.651800, 0.179100, -0.736900, 0.686303, 0.359562},
+    {-0.123775, 0.404939, -0.412651, -0.341200, 0.208900, -0.916500, 0.686235, 0.308569},
+    {0.000001, 0.182948, -0.476118, -0.000000, 0.175900, -0.984400, 0.580003, 0.258208},
+    {-0.119594, 0.610294, -0.359743, -0.316200, 0.328000, -0.890200, 0.773900, 0.300420},
+    {-0.222358, 0.599408, -0.305107, -0.638200, 0.281200, -0.716700, 0.772919, 0.348532},
+    {-0.321937, 0.568757, -0.106233, -0.979000, 0.203500, -0.009100, 0.787697, 0.419153},
+    {-0.292940, 0.586394, -0.214084, -0.883000, 0.242800, -0.401600, 0.774076, 0.384184},
+    {-0.198167, 0.753506, -0.244366, -0.611200, 0.480600, -0.628800, 0.829115, 0.333252},
+    {-0.108991, 0.768799, -0.285403, -0.273800, 0.543500, -0.793500, 0.830885, 0.291437},
+    {0.000001, 0.408368, -0.433834, -0.000000, 0.220400, -0.975400, 0.683794, 0.250874},
+    {0.000001, 0.615146, -0.377113, -0.000000, 0.351900, -0.936000, 0.772487, 0.244608},
+    {0.123776, 0.404939, -0.412651, 0.341200, 0.208900, -0.916500, 0.678098, 0.193410},
+    {0.119596, 0.610294, -0.359743, 0.316200, 0.328000, -0.890200, 0.766038, 0.189151},
+    {0.000001, 0.775991, -0.296841, -0.000000, 0.571300, -0.820700, 0.831241, 0.240456},
+    {0.108992, 0.768799, -0.285403, 0.273800, 0.543500, -0.793500, 0.823720, 0.190033},
+    {-0.168068, 0.835357, -0.189717, -0.533200, 0.714100, -0.453600, 0.858218, 0.317125},
+    {-0.099358, 0.865963, -0.196678, -0.259200, 0.814400, -0.519200, 0.866299, 0.284431},
+    {-0.253535, 0.741601, -0.165394, -0.844700, 0.452100, -0.286500, 0.835276, 0.360419},
+    {-0.274555, 0.722423, -0.068044, -0.910600, 0.406300, 0.076100, 0.848399, 0.380665},
+    {-0.190000, 0.844813, -0.120802, -0.661300, 0.738200, -0.133000, 0.874462, 0.327577},
+    {0.000001, 0.878002, -0.199531, -0.000000, 0.840200, -0.542200, 0.869054, 0.237785},
+    {-0.102431, 0.900050, -0.100455, -0.328100, 0.939300, -0.099900, 0.894551, 0.284367},
+    {0.099359, 0.865963, -0.196678, 0.259200, 0.814400, -0.519200, 0.859768, 0.191989},
+    {0.168070, 0.835357, -0.189717, 0.533200, 0.714100, -0.453600, 0.847170, 0.160757},
+    {0.198169, 0.753506, -0.244366, 0.611200, 0.480600, -0.628800, 0.816088, 0.148881},
+    {0.190001, 0.844813, -0.120802, 0.661300, 0.738200, -0.133000, 0.861783, 0.148124},
+    {0.102433, 0.900050, -0.100455, 0.328100, 0.939300, -0.099900, 0.887748, 0.188080},
+    {0.000001, 0.916321, -0.095758, -0.000000, 0.994700, -0.103000, 0.899896, 0.235606},
+    {-0.201689, 0.828541, -0.030127, -0.709000, 0.677900, 0.194500, 0.909101, 0.342178},
+    {-0.106777, 0.886574, -0.005250, -0.363000, 0.885600, 0.289600, 0.923458, 0.287552},
+    {0.000001, 0.903854, 0.003258, -0.000000, 0.947500, 0.319700, 0.937815, 0.232927},
+    {0.106778, 0.886576, -0.005250, 0.363000, 0.885600, 0.289600, 0.915920, 0.180862},
+    {0.201691, 0.828541, -0.030127, 0.709000, 0.677900, 0.194500, 0.894025, 0.128798},
+    {0.274556, 0.722423, -0.068044, 0.910600, 0.406300, 0.076100, 0.828514, 0.099228},
+    {0.253537, 0.741601, -0.165394, 0.844700, 0.452100, -0.286500, 0.818368, 0.121118},
+    {0.321938, 0.568757, -0.106233, 0.979000, 0.203500, -0.009100, 0.763004, 0.069658},
+    {0.292942, 0.586394, -0.214084, 0.883000, 0.242800, -0.401600, 0.754435, 0.106194},
+    {0.312545, 0.387668, -0.247344, 0.882600, 0.154800, -0.443800, 0.664745, 0.103857},
+    {0.348031, 0.373915, -0.130422, 0.988600, 0.143000, -0.047000, 0.660024, 0.071777},
+    {0.222359, 0.599408, -0.305107, 0.638200, 0.281200, -0.716700, 0.758302, 0.141655},
+    {0.232862, 0.397189, -0.349008, 0.651800, 0.179100, -0.736900, 0.670996, 0.142913},
+    {0.278056, -0.767084, 0.317796, 0.233400, -0.912800, 0.335100, 0.868437, 0.835431},
+    {0.169669, -0.787303, 0.183210, -0.044400, -0.997900, 0.047600, 0.916164, 0.782980},
+    {0.317351, -0.788665, 0.196571, 0.215300, -0.962700, 0.163900, 0.891119, 0.855846},
+    {0.185054, -0.714073, 0.443702, 0.190000, -0.665600, 0.721700, 0.834344, 0.794361},
+    {0.336359, -0.709703, 0.375713, 0.481100, -0.647700, 0.590700, 0.836519, 0.864944},
+    {0.426998, -0.730529, 0.224519, 0.657100, -0.698400, 0.283700, 0.852630, 0.909631},
+    {0.161072, -0.776995, 0.338754, 0.072300, -0.958100, 0.277100, 0.877245, 0.780118},
+    {0.000001, -0.774587, 0.179081, -0.000000, -0.999800, -0.020800, 0.924195, 0.701498},
+    {0.181417, -0.784429, -0.005086, -0.101700, -0.994800, -0.000000, 0.957286, 0.796000},
+    {0.339575, -0.802283, 0.011226, 0.210300, -0.977600, -0.013000, 0.930059, 0.894764},
+    {0.454603, -0.745843, 0.019679, 0.705100, -0.708900, -0.015500, 0.879158, 0.943376},
+    {0.520151, -0.621311, 0.012464, 0.955600, -0.292000, -0.040100, 0.828257, 0.991987},
+    {0.494870, -0.614192, 0.238644, 0.899000, -0.294500, 0.324200, 0.798831, 0.946058},
+    {0.216166, -0.600098, 0.496433, 0.263300, -0.234000, 0.935900, 0.780248, 0.812728},
+    {0.392126, -0.600247, 0.411696, 0.645400, -0.259800, 0.718300, 0.786100, 0.894578},
+    {0.410197, -0.450740, 0.399776, 0.688600, 0.152400, 0.709000, 0.717145, 0.907898},
+    {0.513220, -0.454511, 0.216920, 0.948400, 0.086100, 0.305200, 0.723436, 0.959106},
+    {0.534974, -0.452152, -0.014140, 0.997900, 0.024400, -0.059200, 0.730424, 0.991987},
+    {0.388096, -0.272138, 0.331569, 0.653300, 0.414800, 0.633400, 0.633335, 0.903487},
+    {0.485234, -0.267122, 0.157056, 0.902500, 0.317000, 0.291700, 0.634440, 0.952577},
+    {0.215039, -0.269761, 0.430833, 0.292100, 0.424900, 0.856800, 0.626541, 0.823061},
+    {0.227231, -0.448480, 0.494324, 0.282700, 0.169200, 0.944200, 0.710080, 0.822858},
+    {0.000001, -0.603925, 0.516231, -0.000000, -0.233700, 0.972300, 0.774922, 0.712044},
+    {0.000001, -0.448060, 0.518600, -0.000000, 0.158200, 0.987400, 0.702416, 0.717167},
+    {0.000001, -0.069820, 0.349082, -0.000000, 0.485500, 0.874200, 0.526463, 0.729599},
+    {0.000001, -0.266897, 0.460298, -0.000000, 0.398500, 0.917200, 0.618141, 0.723122},
+    {0.184982, -0.073462, 0.313008, 0.332000, 0.502400, 0.798400, 0.534236, 0.815531},
+    {0.335563, -0.075269, 0.214380, 0.634700, 0.483300, 0.603000, 0.540027, 0.885520},
+    {0.504716, -0.257458, -0.054706, 0.974300, 0.217100, -0.059500, 0.632591, 0.991987},
+    {0.423107, -0.065777, 0.069287, 0.867900, 0.385800, 0.313100, 0.538417, 0.929215},
+    {0.154762, 0.131593, 0.205140, 0.401900, 0.355300, 0.843900, 0.437854, 0.808212},
+    {0.282920, 0.131836, 0.111509, 0.675600, 0.336000, 0.656200, 0.441953, 0.867838},
+    {0.000001, 0.134398, 0.245123, -0.000000, 0.352700, 0.935700, 0.431463, 0.736311},
+    {-0.215038, -0.269761, 0.430833, -0.292100, 0.424900, 0.856800, 0.612405, 0.622994},
+    {-0.184981, -0.073462, 0.313008, -0.332000, 0.502400, 0.798400, 0.522077, 0.643428},
+    {-0.388094, -0.272138, 0.331569, -0.653300, 0.414800, 0.633400, 0.607823, 0.542411},
+    {-0.227230, -0.448480, 0.494324, -0.282700, 0.169200, 0.944200, 0.695143, 0.611448},
+    {-0.410195, -0.450740, 0.399776, -0.688600, 0.152400, 0.709000, 0.690181, 0.526260},
+    {-0.154760, 0.131593, 0.205140, -0.401900, 0.355300, 0.843900, 0.427681, 0.664226},
+    {-0.335561, -0.075269, 0.214380, -0.634700, 0.483300, 0.603000, 0.517969, 0.573320},
+    {0.000001, 0.335486, 0.201882, -0.000000, 0.124300, 0.992200, 0.337918, 0.742921},
+    {0.139265, 0.334733, 0.164514, 0.429000, 0.117200, 0.895700, 0.342845, 0.807680},
+    {0.129796, 0.517253, 0.163151, 0.400900, 0.046800, 0.914900, 0.257628, 0.809274},
+    {0.000001, 0.516584, 0.193598, -0.000000, 0.057900, 0.998300, 0.253673, 0.748873},
+    {-0.129794, 0.517253, 0.163151, -0.400900, 0.046800, 0.914900, 0.249096, 0.688515},
+    {-0.139264, 0.334733, 0.164514, -0.429000, 0.117200, 0.895700, 0.333691, 0.678111},
+    {-0.282919, 0.131836, 0.111509, -0.675600, 0.336000, 0.656200, 0.423355, 0.604616},
+    {-0.485233, -0.267122, 0.157056, -0.902500, 0.317000, 0.291700, 0.602015, 0.493654},
+    {-0.423104, -0.065777, 0.069287, -0.867900, 0.385800, 0.313100, 0.510231, 0.530285},
+    {-0.361348, 0.143905, -0.002664, -0.889600, 0.274800, 0.364800, 0.414871, 0.567050},
+    {-0.255389, 0.339049, 0.079269, -0.704200, 0.114300, 0.700800, 0.327867, 0.624233},
+    {-0.237193, 0.525041, 0.090008, -0.698500, 0.060900, 0.713100, 0.241943, 0.638810},
+    {-0.115685, 0.662038, 0.158229, -0.349000, 0.158100, 0.923700, 0.182207, 0.699838},
+    {-0.207907, 0.667844, 0.101724, -0.664600, 0.168100, 0.728100, 0.176475, 0.657128},
+    {-0.328031, 0.354737, -0.020656, -0.910400, 0.125100, 0.394300, 0.317477, 0.588761},
+    {-0.303140, 0.545131, -0.002413, -0.906000, 0.131100, 0.402500, 0.228802, 0.606173},
+    {-0.260230, 0.693281, 0.024537, -0.858000, 0.293100, 0.421900, 0.161718, 0.631992},
+    {-0.442039, -0.052336, -0.099382, -0.957300, 0.283400, -0.057300, 0.500167, 0.503547},
+    {-0.380815, 0.159715, -0.129771, -0.974800, 0.216000, -0.056700, 0.405691, 0.552198},
+    {-0.504715, -0.257458, -0.054706, -0.974300, 0.217100, -0.059500, 0.594643, 0.454895},
+    {-0.534973, -0.452152, -0.014140, -0.997900, 0.024400, -0.059200, 0.691504, 0.441139},
+    {-0.520150, -0.621311, 0.012464, -0.955600, -0.292000, -0.040100, 0.788365, 0.427384},
+    {-0.513218, -0.454511, 0.216920, -0.948400, 0.086100, 0.305200, 0.689209, 0.474676},
+    {-0.426997, -0.730529, 0.224519, -0.657100, -0.698400, 0.283700, 0.824076, 0.505494},
+    {-0.494869, -0.614192, 0.238644, -0.899000, -0.294500, 0.324200, 0.765689, 0.476993},
+    {-0.454601, -0.745843, 0.019679, -0.705100, -0.708900, -0.015500, 0.845596, 0.468355},
+    {-0.336358, -0.709703, 0.375713, -0.481100, -0.647700, 0.590700, 0.814409, 0.552003},
+    {-0.392125, -0.600247, 0.411696, -0.645400, -0.259800, 0.718300, 0.760323, 0.529752},
+    {-0.317350, -0.788665, 0.196571, -0.215300, -0.962700, 0.163900, 0.869745, 0.553333},
+    {-0.278054, -0.767084, 0.317796, -0.233400, -0.912800, 0.335100, 0.850159, 0.576735},
+    {-0.339574, -0.802283, 0.011226, -0.210300, -0.977600, -0.013000, 0.902827, 0.509326},
+    {-0.169667, -0.787303, 0.183210, 0.044400, -0.997900, 0.047600, 0.904787, 0.621954},
+    {-0.161071, -0.776995, 0.338754, -0.072300, -0.958100, 0.277100, 0.866657, 0.630260},
+    {-0.185053, -0.714073, 0.443702, -0.190000, -0.665600, 0.721700, 0.822179, 0.622190},
+    {-0.216164, -0.600098, 0.496433, -0.263300, -0.234000, 0.935900, 0.766038, 0.611612},
+    {0.000001, -0.722494, 0.457649, -0.000000, -0.690100, 0.723700, 0.832905, 0.707948},
+    {0.000001, -0.781928, 0.343776, -0.000000, -0.975400, 0.220300, 0.880327, 0.704597},
+    {-0.181415, -0.784429, -0.005086, 0.101700, -0.994800, -0.000000, 0.943670, 0.603281},
+    {0.000001, -0.759469, -0.014259, -0.000000, -0.999900, 0.013000, 0.984513, 0.697236},
+    {-0.348029, 0.373915, -0.130422, -0.988600, 0.143000, -0.047000, 0.303437, 0.564580},
+    {-0.321937, 0.568757, -0.106233, -0.979000, 0.203500, -0.009100, 0.201183, 0.576962},
+    {-0.274555, 0.722423, -0.068044, -0.910600, 0.406300, 0.076100, 0.140481, 0.615449},
+    {-0.201689, 0.828541, -0.030127, -0.709000, 0.677900, 0.194500, 0.079778, 0.653937},
+    {-0.194324, 0.791575, 0.051098, -0.675700, 0.555700, 0.484400, 0.117239, 0.666316},
+    {-0.174727, 0.750364, 0.101738, -0.574700, 0.377200, 0.726300, 0.139178, 0.675275},
+    {-0.106777, 0.886574, -0.005250, -0.363000, 0.885600, 0.289600, 0.065422, 0.708562},
+    {-0.104689, 0.841333, 0.076011, -0.335700, 0.715200, 0.613000, 0.097441, 0.710472},
+    {-0.103684, 0.767768, 0.132312, -0.298700, 0.429500, 0.852300, 0.133417, 0.708896},
+    {0.000001, 0.855305, 0.086883, -0.000000, 0.749700, 0.661800, 0.093800, 0.760168},
+    {0.000001, 0.903854, 0.003258, -0.000000, 0.947500, 0.319700, 0.051065, 0.763188},
+    {0.000001, 0.662936, 0.180674, -0.000000, 0.178900, 0.983900, 0.185592, 0.753683},
+    {0.000001, 0.774808, 0.147416, -0.000000, 0.449600, 0.893200, 0.133550, 0.757360},
+    {0.115687, 0.662038, 0.158229, 0.349000, 0.158100, 0.923700, 0.189812, 0.807469},
+    {0.103685, 0.767768, 0.132312, 0.298700, 0.429500, 0.852300, 0.140233, 0.805362},
+    {0.104690, 0.841333, 0.076011, 0.335700, 0.715200, 0.613000, 0.104392, 0.808859},
+    {0.106778, 0.886576, -0.005250, 0.363000, 0.885600, 0.289600, 0.072960, 0.815252},
+    {0.174728, 0.750364, 0.101738, 0.574700, 0.377200, 0.726300, 0.150664, 0.837838},
+    {0.194326, 0.791575, 0.051098, 0.675700, 0.555700, 0.484400, 0.130202, 0.849793},
+    {0.207908, 0.667844, 0.101724, 0.664600, 0.168100, 0.728100, 0.190142, 0.850561},
+    {0.260231, 0.693281, 0.024537, 0.858000, 0.293100, 0.421900, 0.179066, 0.877522},
+    {0.201691, 0.828541, -0.030127, 0.709000, 0.677900, 0.194500, 0.094854, 0.867316},
+    {0.274556, 0.722423, -0.068044, 0.910600, 0.406300, 0.076100, 0.160365, 0.896887},
+    {0.237194, 0.525041, 0.090008, 0.698500, 0.060900, 0.713100, 0.257535, 0.859491},
+    {0.303142, 0.545131, -0.002413, 0.906000, 0.131100, 0.402500, 0.249114, 0.893652},
+    {0.321938, 0.568757, -0.106233, 0.979000, 0.203500, -0.009100, 0.225876, 0.926457},
+    {0.328033, 0.354737, -0.020656, 0.910400, 0.125100, 0.394300, 0.339356, 0.898423},
+    {0.255391, 0.339049, 0.079269, 0.704200, 0.114300, 0.700800, 0.344655, 0.861842},
+    {0.348031, 0.373915, -0.130422, 0.988600, 0.143000, -0.047000, 0.328855, 0.924338},
+    {0.361349, 0.143905, -0.002664, 0.889600, 0.274800, 0.364800, 0.438835, 0.906224},
+    {0.380816, 0.159715, -0.129771, 0.974800, 0.216000, -0.056700, 0.431835, 0.922219},
+    {0.442040, -0.052336, -0.099382, 0.957300, 0.283400, -0.057300, 0.532213, 0.957103},
+    {0.000001, -0.586198, -0.601911, -0.000000, 0.249000, 0.968500, 0.038332, 0.914438},
+    {-0.191722, -0.739739, -0.500205, 0.288200, 0.597300, 0.748400, 0.032492, 0.923049},
+    {0.000001, -0.747628, -0.532734, -0.000000, 0.616400, 0.787400, 0.031524, 0.914919},
+    {0.191723, -0.739739, -0.500205, -0.288200, 0.597300, 0.748400, 0.031339, 0.906734},
+    {0.214076, -0.585938, -0.565624, -0.343700, 0.254700, 0.903900, 0.037723, 0.905389},
+    {-0.218185, -0.413573, -0.582808, 0.351400, 0.004400, 0.936200, 0.046390, 0.923138},
+    {-0.214075, -0.585938, -0.565624, 0.343700, 0.254700, 0.903900, 0.039001, 0.923484},
+    {0.218186, -0.413573, -0.582808, -0.351400, 0.004400, 0.936200, 0.045086, 0.904692},
+    {0.000001, -0.411791, -0.618483, -0.000000, 0.005800, 1.000000, 0.045821, 0.913909},
+    {0.000001, -0.846874, -0.394675, -0.000000, 0.944700, 0.327900, 0.025805, 0.915324},
+    {-0.169015, -0.839891, -0.373020, 0.145200, 0.925400, 0.350100, 0.027226, 0.922754},
+    {0.000001, -0.844934, -0.206605, -0.000000, 0.999200, -0.040600, 0.021306, 0.915641},
+    {0.169016, -0.839891, -0.373020, -0.145200, 0.925400, 0.350100, 0.026168, 0.907767},
+    {-0.293500, -0.823523, -0.328351, 0.341500, 0.864800, 0.368100, 0.029033, 0.927963},
+    {-0.170485, -0.856369, -0.195298, -0.008000, 0.999800, 0.019400, 0.023326, 0.923727},
+    {0.170486, -0.856369, -0.195298, 0.008000, 0.999800, 0.019400, 0.022169, 0.907352},
+    {0.000001, -0.819448, -0.012634, -0.000000, 0.999900, -0.011600, 0.015724, 0.916036},
+    {0.293501, -0.823523, -0.328351, -0.341500, 0.864800, 0.368100, 0.027224, 0.902356},
+    {0.333410, -0.850028, -0.186471, -0.286200, 0.947500, 0.142800, 0.024906, 0.900138},
+    {0.176549, -0.844220, -0.003897, 0.092200, 0.995700, 0.001200, 0.018463, 0.906098},
+    {-0.176548, -0.844220, -0.003897, -0.092200, 0.995700, 0.001200, 0.019833, 0.925489},
+    {-0.333409, -0.850028, -0.186471, 0.286200, 0.947500, 0.142800, 0.027050, 0.930485},
+    {-0.458197, -0.766274, -0.208726, 0.699900, 0.648700, 0.299000, 0.031969, 0.934814},
+    {-0.354041, -0.738199, -0.393985, 0.573800, 0.571400, 0.586700, 0.033101, 0.929872},
+    {-0.353326, -0.860686, 0.011348, 0.222900, 0.974800, 0.012700, 0.023943, 0.934943},
+    {-0.577484, -0.638801, 0.009849, 0.954200, 0.296800, 0.038800, 0.035459, 0.943188},
+    {-0.525079, -0.619808, -0.239904, 0.883900, 0.283800, 0.371700, 0.038191, 0.937089},
+    {-0.497170, -0.788113, 0.018603, 0.705100, 0.709000, 0.015700, 0.029701, 0.939065},
+    {-0.399548, -0.594805, -0.445390, 0.678200, 0.268600, 0.684100, 0.039174, 0.931260},
+    {-0.538333, -0.438140, -0.264574, 0.921900, 0.006000, 0.387400, 0.046110, 0.936962},
+    {-0.408350, -0.421969, -0.465177, 0.700100, 0.006800, 0.714000, 0.046559, 0.931088},
+    {-0.594848, -0.450686, -0.017715, 0.998100, -0.022200, 0.057600, 0.045205, 0.941803},
+    {-0.563135, -0.244294, -0.058431, 0.974600, -0.216100, 0.058100, 0.054951, 0.940419},
+    {-0.507658, -0.237290, -0.281830, 0.900700, -0.172300, 0.398800, 0.055014, 0.934976},
+    {-0.383051, -0.230746, -0.461923, 0.678800, -0.156100, 0.717600, 0.054981, 0.929355},
+    {-0.499429, -0.035209, -0.103003, 0.957500, -0.283100, 0.056100, 0.064457, 0.935524},
+    {-0.447710, -0.029885, -0.291372, 0.876900, -0.235500, 0.419100, 0.064373, 0.931448},
+    {-0.334528, -0.026990, -0.446427, 0.659500, -0.210000, 0.721800, 0.064208, 0.926475},
+    {-0.204224, -0.227473, -0.569634, 0.345400, -0.131900, 0.929100, 0.054673, 0.921912},
+    {0.000001, -0.226718, -0.603402, -0.000000, -0.117000, 0.993100, 0.054136, 0.913322},
+    {-0.177629, -0.025294, -0.541900, 0.345300, -0.178000, 0.921500, 0.063915, 0.920012},
+    {-0.392096, 0.181094, -0.290280, 0.876100, -0.190600, 0.442800, 0.074177, 0.928025},
+    {-0.290561, 0.186661, -0.423351, 0.657200, -0.182900, 0.731200, 0.074132, 0.923721},
+    {-0.439277, 0.172726, -0.133350, 0.974700, -0.216200, 0.056700, 0.073963, 0.930629},
+    {-0.407351, 0.382442, -0.133257, 0.988500, -0.143600, 0.047500, 0.084251, 0.929383},
+    {-0.365527, 0.396944, -0.273927, 0.883300, -0.155300, 0.442300, 0.084268, 0.926121},
+    {-0.153665, 0.191420, -0.507207, 0.348600, -0.177900, 0.920200, 0.073974, 0.918171},
+    {-0.272059, 0.407879, -0.393159, 0.651600, -0.179700, 0.737000, 0.084338, 0.922142},
+    {0.000001, -0.024607, -0.572971, -0.000000, -0.161400, 0.986900, 0.063468, 0.912662},
+    {0.177631, -0.025294, -0.541900, -0.345300, -0.178000, 0.921500, 0.062877, 0.905323},
+    {0.204226, -0.227473, -0.569634, -0.345400, -0.131900, 0.929100, 0.053460, 0.904741},
+    {0.334529, -0.026990, -0.446427, -0.659500, -0.210000, 0.721800, 0.062259, 0.898883},
+    {0.383053, -0.230746, -0.461923, -0.678800, -0.156100, 0.717600, 0.052719, 0.897329},
+    {0.290563, 0.186661, -0.423351, -0.657200, -0.182900, 0.731200, 0.072471, 0.900215},
+    {0.153667, 0.191420, -0.507207, -0.348600, -0.177900, 0.920200, 0.073095, 0.905731},
+    {0.000001, 0.193622, -0.535161, -0.000000, -0.176000, 0.984400, 0.073642, 0.911944},
+    {-0.144052, 0.417370, -0.467736, 0.341400, -0.209500, 0.916300, 0.084331, 0.917011},
+    {0.144053, 0.417370, -0.467736, -0.341400, -0.209500, 0.916300, 0.083512, 0.905424},
+    {0.000001, 0.421582, -0.492361, -0.000000, -0.220900, 0.975300, 0.084085, 0.911206},
+    {0.272060, 0.407879, -0.393159, -0.651600, -0.179700, 0.737000, 0.082798, 0.900343},
+    {0.365528, 0.396944, -0.273927, -0.883300, -0.155300, 0.442300, 0.082169, 0.896413},
+    {0.392098, 0.181094, -0.290280, -0.876100, -0.190600, 0.442800, 0.071911, 0.895947},
+    {0.447712, -0.029885, -0.291372, -0.876900, -0.235500, 0.419100, 0.061723, 0.893936},
+    {0.407353, 0.382442, -0.133257, -0.988500, -0.143600, 0.047500, 0.081694, 0.893185},
+    {0.439279, 0.172726, -0.133350, -0.974700, -0.216200, 0.056700, 0.071332, 0.893399},
+    {0.380650, 0.581113, -0.106782, -0.978800, -0.204400, 0.008700, 0.092055, 0.892972},
+    {0.260869, 0.616687, -0.347751, -0.638800, -0.282600, 0.715600, 0.091582, 0.900216},
+    {0.345892, 0.601333, -0.238024, -0.883200, -0.243800, 0.400700, 0.091193, 0.896648},
+    {0.138481, 0.630142, -0.413124, -0.318300, -0.329200, 0.889000, 0.092361, 0.904995},
+    {0.234779, 0.782992, -0.281652, -0.611400, -0.482200, 0.627400, 0.097397, 0.900944},
+    {0.125510, 0.801407, -0.332983, -0.276500, -0.546100, 0.790700, 0.098164, 0.905084},
+    {0.000001, 0.636148, -0.433318, -0.000000, -0.352900, 0.935600, 0.093009, 0.910575},
+    {0.304172, 0.768817, -0.182578, -0.843300, -0.454800, 0.286400, 0.097626, 0.898150},
+    {0.329261, 0.746698, -0.063783, -0.909500, -0.408600, -0.076900, 0.098647, 0.895948},
+    {0.200501, 0.877277, -0.217840, -0.539000, -0.704000, 0.462400, 0.100524, 0.902138},
+    {0.229711, 0.888923, -0.129609, -0.665400, -0.735300, 0.128600, 0.101994, 0.900867},
+    {0.000001, 0.810104, -0.346200, -0.000000, -0.574600, 0.818400, 0.098921, 0.910158},
+    {0.115454, 0.914515, -0.228042, -0.253100, -0.814600, 0.521800, 0.101791, 0.905281},
+    {-0.125509, 0.801407, -0.332983, 0.276500, -0.546100, 0.790700, 0.098885, 0.915287},
+    {-0.138479, 0.630142, -0.413124, 0.318300, -0.329200, 0.889000, 0.093152, 0.916191},
+    {-0.115453, 0.914515, -0.228042, 0.253100, -0.814600, 0.521800, 0.102449, 0.914582},
+    {0.000001, 0.928312, -0.232224, -0.000000, -0.842400, 0.538900, 0.102726, 0.909889},
+    {0.121979, 0.956479, -0.106266, -0.325200, -0.940800, 0.095900, 0.104607, 0.904888},
+    {0.244303, 0.869197, -0.018670, -0.707500, -0.679800, -0.193400, 0.105238, 0.898923},
+    {0.128573, 0.939713, 0.012110, -0.364100, -0.886000, -0.287200, 0.107441, 0.904161},
+    {0.000001, 0.976015, -0.101812, -0.000000, -0.994600, 0.103900, 0.105829, 0.909670},
+    {-0.121978, 0.956479, -0.106266, 0.325200, -0.940800, 0.095900, 0.105291, 0.914576},
+    {-0.200500, 0.877277, -0.217840, 0.539000, -0.704000, 0.462400, 0.101635, 0.917872},
+    {-0.234778, 0.782992, -0.281652, 0.611400, -0.482200, 0.627400, 0.098707, 0.919494},
+    {-0.229708, 0.888923, -0.129609, 0.665400, -0.735300, 0.128600, 0.103270, 0.918923},
+    {-0.304171, 0.768817, -0.182578, 0.843300, -0.454800, 0.286400, 0.099327, 0.922228},
+    {-0.244301, 0.869197, -0.018670, 0.707500, -0.679800, -0.193400, 0.106755, 0.920392},
+    {-0.128572, 0.939713, 0.012110, 0.364100, -0.886000, -0.287200, 0.108200, 0.914896},
+    {0.000001, 0.960676, 0.022527, -0.000000, -0.948100, -0.317800, 0.109644, 0.909400},
+    {-0.329260, 0.746698, -0.063783, 0.909500, -0.408600, -0.076900, 0.100648, 0.924265},
+    {-0.345890, 0.601333, -0.238024, 0.883200, -0.243800, 0.400700, 0.093169, 0.924619},
+    {-0.380648, 0.581113, -0.106782, 0.978800, -0.204400, 0.008700, 0.094540, 0.928137},
+    {-0.260867, 0.616687, -0.347751, 0.638800, -0.282600, 0.715600, 0.093053, 0.921032},
+    {0.499430, -0.035209, -0.103003, -0.957500, -0.283100, 0.056100, 0.061233, 0.889889},
+    {0.507659, -0.237290, -0.281830, -0.900700, -0.172300, 0.398800, 0.051961, 0.891760},
+    {0.563137, -0.244294, -0.058431, -0.974600, -0.216100, 0.058100, 0.051133, 0.886379},
+    {0.408352, -0.421969, -0.465177, -0.700100, 0.006800, 0.714000, 0.044136, 0.896798},
+    {0.538334, -0.438140, -0.264574, -0.921900, 0.006000, 0.387400, 0.042865, 0.891045},
+    {0.399550, -0.594806, -0.445390, -0.678200, 0.268600, 0.684100, 0.036800, 0.897665},
+    {0.594850, -0.450686, -0.017715, -0.998100, -0.022200, 0.057600, 0.041289, 0.886379},
+    {0.525080, -0.619808, -0.239904, -0.883900, 0.283800, 0.371700, 0.035008, 0.892033},
+    {0.354043, -0.738199, -0.393985, -0.573800, 0.571400, 0.586700, 0.030983, 0.899894},
+    {0.458198, -0.766274, -0.208726, -0.699900, 0.648700, 0.299000, 0.029168, 0.895160},
+    {0.577486, -0.638801, 0.009849, -0.954200, 0.296800, 0.038800, 0.031446, 0.886379},
+    {0.353327, -0.860686, 0.011348, -0.222900, 0.974800, 0.012700, 0.021202, 0.896161},
+    {0.497171, -0.788113, 0.018603, -0.705100, 0.709000, 0.015700, 0.026324, 0.891270},
+    {0.291712, -0.822029, 0.337659, -0.237900, 0.910000, -0.339600, 0.102664, 0.970022},
+    {0.167237, -0.847235, 0.184691, 0.026800, 0.998900, -0.038000, 0.107466, 0.964745},
+    {0.165352, -0.834181, 0.356403, -0.089200, 0.950400, -0.298000, 0.103550, 0.964457},
+    {0.196453, -0.754103, 0.486917, -0.193100, 0.662600, -0.723700, 0.099233, 0.965890},
+    {0.466382, -0.772526, 0.241404, -0.659600, 0.695600, -0.284900, 0.101073, 0.977488},
+    {0.364517, -0.749591, 0.410586, -0.483600, 0.645300, -0.591400, 0.099452, 0.972992},
+    {0.330691, -0.846437, 0.205757, -0.223300, 0.960700, -0.165100, 0.104946, 0.972076},
+    {0.000001, -0.839914, 0.359195, -0.000000, 0.966500, -0.256500, 0.103860, 0.956858},
+    {0.176549, -0.844220, -0.003897, 0.092200, 0.995700, 0.001200, 0.111603, 0.966055},
+    {0.000001, -0.834574, 0.177801, -0.000000, 0.999200, 0.039100, 0.108274, 0.956546},
+    {0.353327, -0.860686, 0.011348, -0.222900, 0.974800, 0.012700, 0.108864, 0.975992},
+    {0.000001, -0.763759, 0.501206, -0.000000, 0.688600, -0.725200, 0.099089, 0.957195},
+    {0.000001, -0.617620, 0.574647, -0.000000, 0.237100, -0.971500, 0.093255, 0.957607},
+    {0.232168, -0.613928, 0.552582, -0.266800, 0.235500, -0.934500, 0.093790, 0.967738},
+    {0.548950, -0.631316, 0.258192, -0.897700, 0.295600, -0.326600, 0.095660, 0.981153},
+    {0.430907, -0.615445, 0.454881, -0.646100, 0.259500, -0.717800, 0.094379, 0.975973},
+    {0.000001, -0.438430, 0.577823, -0.000000, -0.148000, -0.989000, 0.085959, 0.958123},
+    {0.244616, -0.438406, 0.550859, -0.291200, -0.161600, -0.942900, 0.086730, 0.968757},
+    {-0.232166, -0.613928, 0.552582, 0.266800, 0.235500, -0.934500, 0.092361, 0.947502},
+    {-0.196451, -0.754103, 0.486917, 0.193100, 0.662600, -0.723700, 0.098009, 0.948566},
+    {-0.165350, -0.834181, 0.356403, 0.089200, 0.950400, -0.298000, 0.102485, 0.949378},
+    {-0.291710, -0.822029, 0.337659, 0.237900, 0.910000, -0.339600, 0.100825, 0.943993},
+    {-0.364516, -0.749591, 0.410586, 0.483600, 0.645300, -0.591400, 0.097228, 0.941504},
+    {-0.430906, -0.615445, 0.454881, 0.646100, 0.259500, -0.717800, 0.091786, 0.939266},
+    {-0.244615, -0.438406, 0.550859, 0.291200, -0.161600, -0.942900, 0.085227, 0.947486},
+    {0.000001, -0.241853, 0.514821, -0.000000, -0.405100, -0.914300, 0.077480, 0.958722},
+    {0.232868, -0.244028, 0.482019, -0.299500, -0.426300, -0.853600, 0.078325, 0.968778},
+    {0.451384, -0.441841, 0.442488, -0.689100, -0.148700, -0.709200, 0.087441, 0.977314},
+    {0.570089, -0.449506, 0.235382, -0.947400, -0.083200, -0.309000, 0.088074, 0.982466},
+    {0.427051, -0.247622, 0.370058, -0.654100, -0.412500, -0.634000, 0.079008, 0.976870},
+    {0.000001, -0.040252, 0.401291, -0.000000, -0.485500, -0.874200, 0.068255, 0.959374},
+    {0.204719, -0.043450, 0.361068, -0.332300, -0.502400, -0.798200, 0.069037, 0.968020},
+    {-0.232867, -0.244028, 0.482019, 0.299500, -0.426300, -0.853600, 0.076903, 0.948647},
+    {-0.451382, -0.441841, 0.442488, 0.689100, -0.148700, -0.709200, 0.084728, 0.938914},
+    {-0.548948, -0.631318, 0.258192, 0.897700, 0.295600, -0.326600, 0.092326, 0.933957},
+    {-0.570088, -0.449506, 0.235382, 0.947400, -0.083200, -0.309000, 0.084630, 0.933724},
+    {-0.427049, -0.247622, 0.370058, 0.654100, -0.412500, -0.634000, 0.076441, 0.940539},
+    {-0.204718, -0.043450, 0.361068, 0.332300, -0.502400, -0.798200, 0.067814, 0.950703},
+    {0.000001, 0.155497, 0.301292, -0.000000, -0.352000, -0.936000, 0.058697, 0.960049},
+    {0.178430, 0.152591, 0.256119, -0.399100, -0.355400, -0.845200, 0.059340, 0.967283},
+    {0.373349, -0.046570, 0.251100, -0.635800, -0.483300, -0.601800, 0.069620, 0.975062},
+    {0.539368, -0.248195, 0.174701, -0.902200, -0.315200, -0.294300, 0.079120, 0.981809},
+    {0.475180, -0.042641, 0.088076, -0.868000, -0.385500, -0.313000, 0.069458, 0.979458},
+    {0.323273, 0.151816, 0.151164, -0.678000, -0.335800, -0.653800, 0.059752, 0.973283},
+    {0.000001, 0.342979, 0.261413, -0.000000, -0.122400, -0.992500, 0.049284, 0.960714},
+    {0.164713, 0.341933, 0.218372, -0.425700, -0.115400, -0.897500, 0.049780, 0.967230},
+    {-0.178429, 0.152591, 0.256119, 0.399100, -0.355400, -0.845200, 0.058316, 0.952796},
+    {-0.373348, -0.046570, 0.251100, 0.635800, -0.483300, -0.601800, 0.067401, 0.943649},
+    {-0.539366, -0.248195, 0.174701, 0.902200, -0.315200, -0.294300, 0.075857, 0.935634},
+    {-0.475178, -0.042641, 0.088076, 0.868000, -0.385500, -0.313000, 0.066622, 0.939319},
+    {-0.323272, 0.151816, 0.151164, 0.678000, -0.335800, -0.653800, 0.057881, 0.946798},
+    {-0.164711, 0.341933, 0.218372, 0.425700, -0.115400, -0.897500, 0.048859, 0.954193},
+    {0.153907, 0.520067, 0.218021, -0.399200, -0.046600, -0.915700, 0.041206, 0.967390},
+    {-0.153905, 0.520067, 0.218021, 0.399200, -0.046600, -0.915700, 0.040347, 0.955240},
+    {0.000001, 0.519713, 0.253517, -0.000000, -0.057900, -0.998300, 0.040808, 0.961313},
+    {0.278927, 0.528842, 0.132950, -0.700100, -0.061500, -0.711400, 0.041197, 0.972443},
+    {0.297553, 0.346183, 0.121358, -0.706600, -0.113100, -0.698500, 0.049962, 0.972680},
+    {0.136862, 0.671452, 0.213573, -0.348200, -0.160900, -0.923500, 0.034382, 0.967209},
+    {0.247495, 0.678671, 0.145493, -0.665600, -0.170900, -0.726500, 0.034416, 0.971545},
+    {-0.136861, 0.671452, 0.213573, 0.348200, -0.160900, -0.923500, 0.033617, 0.956379},
+    {0.000001, 0.673190, 0.239792, -0.000000, -0.181900, -0.983300, 0.033958, 0.961797},
+    {-0.278926, 0.528842, 0.132950, 0.700100, -0.061500, -0.711400, 0.039628, 0.950239},
+    {-0.247493, 0.678671, 0.145493, 0.665600, -0.170900, -0.726500, 0.033041, 0.952082},
+    {-0.297551, 0.346183, 0.121358, 0.706600, -0.113100, -0.698500, 0.048273, 0.948772},
+    {-0.382765, 0.362444, 0.002687, 0.912800, -0.125300, -0.388800, 0.047228, 0.945203},
+    {-0.357532, 0.552964, 0.021674, 0.907100, -0.132700, -0.399500, 0.038306, 0.946955},
+    {-0.311681, 0.710912, 0.049872, 0.857600, -0.295900, -0.420600, 0.031556, 0.949553},
+    {-0.209183, 0.772829, 0.145419, 0.574400, -0.379700, -0.725200, 0.029288, 0.953908},
+    {-0.122608, 0.793451, 0.183128, 0.298900, -0.432500, -0.850700, 0.028708, 0.957291},
+    {0.000001, 0.801500, 0.201152, -0.000000, -0.451800, -0.892100, 0.028722, 0.962167},
+    {0.122609, 0.793451, 0.183128, -0.298900, -0.432500, -0.850700, 0.029394, 0.966997},
+    {0.000001, 0.900422, 0.126435, -0.000000, -0.750400, -0.661000, 0.024722, 0.962449},
+    {-0.125057, 0.884321, 0.112578, 0.336200, -0.716500, -0.611200, 0.025088, 0.957449},
+    {-0.234662, 0.824516, 0.080894, 0.674400, -0.557100, -0.484600, 0.027080, 0.953006},
+    {-0.244301, 0.869197, -0.018670, 0.707500, -0.679800, -0.193400, 0.023311, 0.951761},
+    {-0.329260, 0.746698, -0.063783, 0.909500, -0.408600, -0.076900, 0.029419, 0.947888},
+    {-0.128572, 0.939713, 0.012110, 0.364100, -0.886000, -0.287200, 0.021867, 0.957257},
+    {0.000001, 0.960676, 0.022527, -0.000000, -0.948100, -0.317800, 0.020422, 0.962753},
+    {0.125059, 0.884321, 0.112578, -0.336200, -0.716500, -0.611200, 0.025788, 0.967349},
+    {0.209185, 0.772829, 0.145419, -0.574400, -0.379700, -0.725200, 0.030443, 0.970264},
+    {0.128573, 0.939713, 0.012110, -0.364100, -0.886000, -0.287200, 0.022625, 0.967992},
+    {0.234664, 0.824516, 0.080894, -0.674400, -0.557100, -0.484600, 0.028385, 0.971467},
+    {0.311683, 0.710912, 0.049872, -0.857600, -0.295900, -0.420600, 0.033301, 0.974257},
+    {0.244303, 0.869197, -0.018670, -0.707500, -0.679800, -0.193400, 0.024828, 0.973230},
+    {0.329261, 0.746698, -0.063783, -0.909500, -0.408600, -0.076900, 0.031420, 0.976206},
+    {0.357533, 0.552964, 0.021674, -0.907100, -0.132700, -0.399500, 0.040349, 0.975880},
+    {0.382766, 0.362444, 0.002687, -0.912800, -0.125300, -0.388800, 0.049429, 0.976360},
+    {0.407353, 0.382442, -0.133257, -0.988500, -0.143600, 0.047500, 0.048373, 0.978968},
+    {0.380650, 0.581113, -0.106782, -0.978800, -0.204400, 0.008700, 0.038011, 0.979181},
+    {0.414829, 0.160529, 0.018867, -0.891500, -0.274700, -0.360100, 0.059438, 0.977145},
+    {0.439279, 0.172726, -0.133350, -0.974700, -0.216200, 0.056700, 0.058734, 0.978754},
+    {0.499430, -0.035209, -0.103003, -0.957500, -0.283100, 0.056100, 0.068834, 0.982264},
+    {0.563137, -0.244294, -0.058431, -0.974600, -0.216100, 0.058100, 0.078934, 0.985774},
+    {0.594850, -0.450686, -0.017715, -0.998100, -0.022200, 0.057600, 0.088777, 0.985774},
+    {0.577486, -0.638801, 0.009849, -0.954200, 0.296800, 0.038800, 0.098621, 0.985774},
+    {0.497171, -0.788113, 0.018603, -0.705100, 0.709000, 0.015700, 0.103742, 0.980883},
+    {-0.407351, 0.382442, -0.133257, 0.988500, -0.143600, 0.047500, 0.045815, 0.942770},
+    {-0.380648, 0.581113, -0.106782, 0.978800, -0.204400, 0.008700, 0.035527, 0.944016},
+    {-0.439277, 0.172726, -0.133350, 0.974700, -0.216200, 0.056700, 0.056104, 0.941524},
+    {-0.414827, 0.160529, 0.018867, 0.891500, -0.274700, -0.360100, 0.057027, 0.943018},
+    {-0.499429, -0.035209, -0.103003, 0.957500, -0.283100, 0.056100, 0.065609, 0.936629},
+    {-0.563135, -0.244294, -0.058431, 0.974600, -0.216100, 0.058100, 0.075115, 0.931734},
+    {-0.594848, -0.450686, -0.017715, 0.998100, -0.022200, 0.057600, 0.084861, 0.930350},
+    {-0.577484, -0.638801, 0.009849, 0.954200, 0.296800, 0.038800, 0.094607, 0.928966},
+    {-0.466381, -0.772526, 0.241404, 0.659600, 0.695600, -0.284900, 0.098200, 0.936825},
+    {-0.497170, -0.788113, 0.018603, 0.705100, 0.709000, 0.015700, 0.100365, 0.933088},
+    {-0.330689, -0.846437, 0.205757, 0.223300, 0.960700, -0.165100, 0.102795, 0.941638},
+    {-0.353326, -0.860686, 0.011348, 0.222900, 0.974800, 0.012700, 0.106124, 0.937210},
+    {-0.167236, -0.847235, 0.184691, -0.026800, 0.998900, -0.038000, 0.106321, 0.948543},
+    {-0.176548, -0.844220, -0.003897, -0.092200, 0.995700, 0.001200, 0.110233, 0.946664},
+    {0.000001, -0.819448, -0.012634, -0.000000, 0.999900, -0.011600, 0.114343, 0.956117},
+    {-0.763241, -0.883499, 0.123206, -0.480600, -0.873000, -0.083100, 0.026495, 0.015853},
+    {-0.668456, -0.833767, -0.142815, -0.752200, -0.259900, -0.605400, 0.033128, 0.022486},
+    {-0.617731, -0.893993, -0.100539, -0.333700, -0.900700, -0.278100, 0.026495, 0.022486},
+    {-0.824596, -0.833767, 0.147677, -0.986500, -0.161700, -0.026900, 0.033128, 0.015853},
+    {-0.783811, -0.765491, 0.131409, -0.810500, 0.582600, -0.061200, 0.037537, 0.015853},
+    {-0.423877, -0.615053, -0.283993, -0.211400, 0.586400, -0.781900, 0.039761, 0.029119},
+    {-0.410866, -0.833767, -0.348754, -0.209000, -0.270700, -0.939700, 0.033128, 0.029119},
+    {-0.423877, -0.883499, -0.283993, -0.168300, -0.873000, -0.457800, 0.026495, 0.029119},
+    {-0.617731, -0.583588, -0.100539, -0.634400, 0.693300, -0.341900, 0.039761, 0.022486},
+    {-0.276391, -0.583588, -0.236682, 0.428000, 0.743700, -0.513500, 0.039761, 0.035752},
+    {-0.276391, -0.893993, -0.236682, 0.203600, -0.948100, -0.244300, 0.026495, 0.035752},
+    {-0.198358, -0.833767, -0.330312, 0.617400, -0.264700, -0.740800, 0.033128, 0.035752},
+    {-0.141914, -0.833767, -0.124608, 0.962000, -0.270700, 0.036200, 0.033128, 0.042386},
+    {-0.203270, -0.615053, -0.100137, 0.807200, 0.586400, 0.067000, 0.039761, 0.042386},
+    {-0.203270, -0.883499, -0.100137, 0.480600, -0.873000, 0.083100, 0.026495, 0.042386},
+    {-0.298054, -0.833767, 0.165882, 0.731100, -0.259900, 0.630800, 0.033128, 0.049019},
+    {-0.483256, -0.517555, 0.011534, -0.118700, 0.982700, 0.142500, 0.046394, 0.049019},
+    {-0.348779, -0.583588, 0.123608, 0.450600, 0.693300, 0.562300, 0.039761, 0.049019},
+    {-0.276391, -0.583588, -0.236682, 0.428000, 0.743700, -0.513500, 0.046394, 0.042386},
+    {-0.348779, -0.893993, 0.123608, 0.333700, -0.900700, 0.278100, 0.026495, 0.049019},
+    {-0.546995, -0.765491, 0.328773, 0.206300, 0.582600, 0.786200, 0.037537, 0.055652},
+    {-0.555644, -0.833767, 0.371822, 0.204300, -0.161700, 0.965500, 0.033128, 0.055652},
+    {-0.542633, -0.883499, 0.307062, 0.168300, -0.873000, 0.457800, 0.026495, 0.055652},
+    {-0.483256, -0.916015, 0.011534, -0.000000, -1.000000, -0.000000, 0.019862, 0.049019},
+    {-0.276391, -0.893993, -0.236682, 0.203600, -0.948100, -0.244300, 0.019862, 0.042386},
+    {-0.690121, -0.893993, 0.259749, -0.203600, -0.948100, 0.244300, 0.026495, 0.062285},
+    {-0.690121, -0.893993, 0.259749, -0.203600, -0.948100, 0.244300, 0.019862, 0.055652},
+    {-0.716281, -0.744574, 0.291140, -0.426800, 0.745300, 0.512200, 0.037537, 0.062285},
+    {-0.768152, -0.833767, 0.353379, -0.633100, -0.148400, 0.759700, 0.033128, 0.062285},
+    {-0.716281, -0.744574, 0.291140, -0.426800, 0.745300, 0.512200, 0.046394, 0.056875},
+    {-0.783811, -0.765491, 0.131409, -0.810500, 0.582600, -0.061200, 0.053748, 0.056327},
+    {-0.617731, -0.583588, -0.100539, -0.634400, 0.693300, -0.341900, 0.053027, 0.049019},
+    {-0.423877, -0.615053, -0.283993, -0.211400, 0.586400, -0.781900, 0.053027, 0.042386},
+    {-0.824596, -0.833767, 0.147677, -0.986500, -0.161700, -0.026900, 0.033128, 0.068918},
+    {-0.783811, -0.765491, 0.131409, -0.810500, 0.582600, -0.061200, 0.037537, 0.068918},
+    {-0.763241, -0.883499, 0.123206, -0.480600, -0.873000, -0.083100, 0.026495, 0.068918},
+    {-0.763241, -0.883499, 0.123206, -0.480600, -0.873000, -0.083100, 0.013229, 0.055652},
+    {-0.617731, -0.893993, -0.100539, -0.333700, -0.900700, -0.278100, 0.013229, 0.049019},
+    {-0.423877, -0.883499, -0.283993, -0.168300, -0.873000, -0.457800, 0.013229, 0.042386},
+    {0.763241, -0.883499, 0.123206, 0.480600, -0.873000, -0.083100, 0.026495, 0.015853},
+    {0.668458, -0.833767, -0.142815, 0.752200, -0.259900, -0.605400, 0.033128, 0.022486},
+    {0.824597, -0.833767, 0.147677, 0.986500, -0.161700, -0.026900, 0.033128, 0.015853},
+    {0.617732, -0.893993, -0.100539, 0.333700, -0.900700, -0.278100, 0.026495, 0.022486},
+    {0.783812, -0.765491, 0.131409, 0.810500, 0.582600, -0.061200, 0.037537, 0.015853},
+    {0.423878, -0.615053, -0.283993, 0.211400, 0.586400, -0.781900, 0.039761, 0.029119},
+    {0.617732, -0.583588, -0.100539, 0.634400, 0.693300, -0.341900, 0.039761, 0.022486},
+    {0.423878, -0.883499, -0.283993, 0.168300, -0.873000, -0.457800, 0.026495, 0.029119},
+    {0.410867, -0.833767, -0.348754, 0.209000, -0.270700, -0.939700, 0.033128, 0.029119},
+    {0.276392, -0.583588, -0.236682, -0.428000, 0.743700, -0.513500, 0.039761, 0.035752},
+    {0.276392, -0.893993, -0.236682, -0.203600, -0.948100, -0.244300, 0.026495, 0.035752},
+    {0.198359, -0.833767, -0.330312, -0.617400, -0.264700, -0.740800, 0.033128, 0.035752},
+    {0.141916, -0.833767, -0.124608, -0.962000, -0.270700, 0.036200, 0.033128, 0.042386},
+    {0.203272, -0.615053, -0.100137, -0.807200, 0.586400, 0.067000, 0.039761, 0.042386},
+    {0.203272, -0.883499, -0.100137, -0.480600, -0.873000, 0.083100, 0.026495, 0.042386},
+    {0.298055, -0.833767, 0.165882, -0.731100, -0.259900, 0.630800, 0.033128, 0.049019},
+    {0.483257, -0.517555, 0.011534, 0.118700, 0.982700, 0.142500, 0.046394, 0.049019},
+    {0.276392, -0.583588, -0.236682, -0.428000, 0.743700, -0.513500, 0.046394, 0.042386},
+    {0.348781, -0.583588, 0.123608, -0.450600, 0.693300, 0.562300, 0.039761, 0.049019},
+    {0.546997, -0.765491, 0.328773, -0.206300, 0.582600, 0.786200, 0.037537, 0.055652},
+    {0.542635, -0.883499, 0.307062, -0.168300, -0.873000, 0.457800, 0.026495, 0.055652},
+    {0.348781, -0.893993, 0.123608, -0.333700, -0.900700, 0.278100, 0.026495, 0.049019},
+    {0.555646, -0.833767, 0.371822, -0.204300, -0.161700, 0.965500, 0.033128, 0.055652},
+    {0.483257, -0.916015, 0.011534, -0.000000, -1.000000, -0.000000, 0.019862, 0.049019},
+    {0.276392, -0.893993, -0.236682, -0.203600, -0.948100, -0.244300, 0.019862, 0.042386},
+    {0.690121, -0.893993, 0.259749, 0.203600, -0.948100, 0.244300, 0.026495, 0.062285},
+    {0.690121, -0.893993, 0.259749, 0.203600, -0.948100, 0.244300, 0.019862, 0.055652},
+    {0.716282, -0.744574, 0.291140, 0.426800, 0.745300, 0.512200, 0.037537, 0.062285},
+    {0.768154, -0.833767, 0.353379, 0.633100, -0.148400, 0.759700, 0.033128, 0.062285},
+    {0.716282, -0.744574, 0.291140, 0.426800, 0.745300, 0.512200, 0.046394, 0.056875},
+    {0.783812, -0.765491, 0.131409, 0.810500, 0.582600, -0.061200, 0.053748, 0.056327},
+    {0.617732, -0.583588, -0.100539, 0.634400, 0.693300, -0.341900, 0.053027, 0.049019},
+    {0.423878, -0.615053, -0.283993, 0.211400, 0.586400, -0.781900, 0.053027, 0.042386},
+    {0.824597, -0.833767, 0.147677, 0.986500, -0.161700, -0.026900, 0.033128, 0.068918},
+    {0.783812, -0.765491, 0.131409, 0.810500, 0.582600, -0.061200, 0.037537, 0.068918},
+    {0.763241, -0.883499, 0.123206, 0.480600, -0.873000, -0.083100, 0.026495, 0.068918},
+    {0.763241, -0.883499, 0.123206, 0.480600, -0.873000, -0.083100, 0.013229, 0.055652},
+    {0.617732, -0.893993, -0.100539, 0.333700, -0.900700, -0.278100, 0.013229, 0.049019},
+    {0.423878, -0.883499, -0.283993, 0.168300, -0.873000, -0.457800, 0.013229, 0.042386},
+    {-0.790303, -0.936706, 0.117147, 0.523400, 0.849800, 0.062800, 0.043345, 0.873754},
+    {-0.713729, -0.848225, -0.179439, 0.755100, 0.233900, 0.612500, 0.057804, 0.888212},
+    {-0.883301, -0.845923, 0.145245, 0.984600, 0.173500, 0.023200, 0.057804, 0.873754},
+    {-0.638681, -0.947437, -0.117999, 0.359200, 0.883800, 0.299700, 0.043345, 0.888212},
+    {-0.832943, -0.731266, 0.127589, 0.845300, -0.533100, 0.035400, 0.067415, 0.873754},
+    {-0.438794, -0.579449, -0.329926, 0.228100, -0.589700, 0.774700, 0.072262, 0.902670},
+    {-0.655045, -0.541910, -0.122233, 0.632300, -0.692200, 0.348100, 0.072262, 0.888212},
+    {-0.434714, -0.936706, -0.309520, 0.157900, 0.855000, 0.494000, 0.043345, 0.902670},
+    {-0.424076, -0.850762, -0.404760, 0.215500, 0.264100, 0.940100, 0.057804, 0.902670},
+    {-0.161284, -0.849473, -0.374796, -0.618200, 0.259900, 0.741800, 0.057804, 0.917128},
+    {-0.251272, -0.538192, -0.266820, -0.419800, -0.755000, 0.503800, 0.072262, 0.917128},
+    {-0.263990, -0.950782, -0.251559, -0.240500, 0.926700, 0.288600, 0.043345, 0.917128},
+    {-0.155401, -0.579449, -0.093742, -0.803200, -0.589700, -0.084700, 0.072262, 0.931587},
+    {-0.084445, -0.850762, -0.121708, -0.963600, 0.264100, -0.042500, 0.057804, 0.931587},
+    {-0.176207, -0.936706, -0.094078, -0.514400, 0.855000, -0.066300, 0.043345, 0.931587},
+    {-0.253870, -0.848225, 0.203813, -0.738600, 0.233900, -0.632300, 0.057804, 0.946045},
+    {-0.490054, -0.458501, 0.019692, 0.114800, -0.983800, -0.137700, 0.086720, 0.946045},
+    {-0.251272, -0.538192, -0.266820, -0.419800, -0.755000, 0.503800, 0.086720, 0.931587},
+    {-0.320716, -0.541910, 0.156401, -0.456300, -0.692200, -0.559200, 0.072262, 0.946045},
+    {-0.534382, -0.731266, 0.376413, -0.187200, -0.533100, -0.825100, 0.067415, 0.960503},
+    {-0.531796, -0.936706, 0.332589, -0.156100, 0.849800, -0.503500, 0.043345, 0.960503},
+    {-0.327829, -0.947437, 0.141068, -0.359500, 0.883800, -0.299300, 0.043345, 0.946045},
+    {-0.542672, -0.845923, 0.429128, -0.200300, 0.173500, -0.964300, 0.057804, 0.960503},
+    {-0.483256, -0.976015, 0.011534, -0.000000, 1.000000, -0.000000, 0.028887, 0.946045},
+    {-0.263990, -0.950782, -0.251559, -0.240500, 0.926700, 0.288600, 0.028887, 0.931587},
+    {-0.702520, -0.950782, 0.274628, 0.249200, 0.921100, -0.299000, 0.043345, 0.974962},
+    {-0.702520, -0.950782, 0.274628, 0.249200, 0.921100, -0.299000, 0.028887, 0.960503},
+    {-0.742256, -0.700372, 0.322308, 0.458200, -0.698500, -0.549700, 0.067415, 0.974962},
+    {-0.806158, -0.842494, 0.398980, 0.633400, 0.145900, -0.760000, 0.057804, 0.974962},
+    {-0.742256, -0.700372, 0.322308, 0.458200, -0.698500, -0.549700, 0.086720, 0.963170},
+    {-0.832943, -0.731266, 0.127589, 0.845300, -0.533100, 0.035400, 0.102750, 0.961976},
+    {-0.655045, -0.541910, -0.122233, 0.632300, -0.692200, 0.348100, 0.101178, 0.946045},
+    {-0.438794, -0.579449, -0.329926, 0.228100, -0.589700, 0.774700, 0.101178, 0.931587},
+    {-0.883301, -0.845923, 0.145245, 0.984600, 0.173500, 0.023200, 0.057804, 0.989420},
+    {-0.832943, -0.731266, 0.127589, 0.845300, -0.533100, 0.035400, 0.067415, 0.989420},
+    {-0.790303, -0.936706, 0.117147, 0.523400, 0.849800, 0.062800, 0.043345, 0.989420},
+    {-0.790303, -0.936706, 0.117147, 0.523400, 0.849800, 0.062800, 0.014429, 0.960503},
+    {-0.638681, -0.947437, -0.117999, 0.359200, 0.883800, 0.299700, 0.014429, 0.946045},
+    {-0.434714, -0.936706, -0.309520, 0.157900, 0.855000, 0.494000, 0.014429, 0.931587},
+    {0.790304, -0.936706, 0.117147, -0.523400, 0.849800, 0.062800, 0.033214, 0.908776},
+    {0.713731, -0.848225, -0.179439, -0.755100, 0.233900, 0.612500, 0.043601, 0.919163},
+    {0.638683, -0.947437, -0.117999, -0.359200, 0.883800, 0.299700, 0.033214, 0.919163},
+    {0.883301, -0.845923, 0.145245, -0.984600, 0.173500, 0.023200, 0.043601, 0.908776},
+    {0.832945, -0.731266, 0.127589, -0.845300, -0.533100, 0.035400, 0.050505, 0.908776},
+    {0.438796, -0.579449, -0.329926, -0.228100, -0.589700, 0.774700, 0.053988, 0.929550},
+    {0.424078, -0.850762, -0.404760, -0.215500, 0.264100, 0.940100, 0.043601, 0.929550},
+    {0.434716, -0.936706, -0.309520, -0.157900, 0.855000, 0.494000, 0.033214, 0.929550},
+    {0.655046, -0.541910, -0.122233, -0.632300, -0.692200, 0.348100, 0.053988, 0.919163},
+    {0.161285, -0.849473, -0.374796, 0.618200, 0.259900, 0.741800, 0.043601, 0.939937},
+    {0.251273, -0.538192, -0.266820, 0.419800, -0.755000, 0.503800, 0.053988, 0.939937},
+    {0.263992, -0.950782, -0.251559, 0.240500, 0.926700, 0.288600, 0.033214, 0.939937},
+    {0.155402, -0.579449, -0.093742, 0.803200, -0.589700, -0.084700, 0.053988, 0.950323},
+    {0.084446, -0.850762, -0.121708, 0.963600, 0.264100, -0.042500, 0.043601, 0.950323},
+    {0.176209, -0.936706, -0.094078, 0.514400, 0.855000, -0.066300, 0.033214, 0.950323},
+    {0.253871, -0.848225, 0.203813, 0.738600, 0.233900, -0.632300, 0.043601, 0.960710},
+    {0.490055, -0.458501, 0.019692, -0.114800, -0.983800, -0.137700, 0.064375, 0.960710},
+    {0.320717, -0.541910, 0.156401, 0.456300, -0.692200, -0.559200, 0.053988, 0.960710},
+    {0.251273, -0.538192, -0.266820, 0.419800, -0.755000, 0.503800, 0.064375, 0.950323},
+    {0.327830, -0.947437, 0.141068, 0.359500, 0.883800, -0.299300, 0.033214, 0.960710},
+    {0.534383, -0.731266, 0.376413, 0.187200, -0.533100, -0.825100, 0.050505, 0.971097},
+    {0.542674, -0.845923, 0.429128, 0.200300, 0.173500, -0.964300, 0.043601, 0.971097},
+    {0.531797, -0.936706, 0.332589, 0.156100, 0.849800, -0.503500, 0.033214, 0.971097},
+    {0.483257, -0.976015, 0.011534, -0.000000, 1.000000, -0.000000, 0.022827, 0.960710},
+    {0.263992, -0.950782, -0.251559, 0.240500, 0.926700, 0.288600, 0.022827, 0.950323},
+    {0.702521, -0.950782, 0.274628, -0.249200, 0.921100, -0.299000, 0.033214, 0.981484},
+    {0.702521, -0.950782, 0.274628, -0.249200, 0.921100, -0.299000, 0.022827, 0.971097},
+    {0.742258, -0.700372, 0.322308, -0.458200, -0.698500, -0.549700, 0.050505, 0.981484},
+    {0.806159, -0.842494, 0.398980, -0.633400, 0.145900, -0.760000, 0.043601, 0.981484},
+    {0.742258, -0.700372, 0.322308, -0.458200, -0.698500, -0.549700, 0.064375, 0.973013},
+    {0.832945, -0.731266, 0.127589, -0.845300, -0.533100, 0.035400, 0.075890, 0.972155},
+    {0.655046, -0.541910, -0.122233, -0.632300, -0.692200, 0.348100, 0.074761, 0.960710},
+    {0.438796, -0.579449, -0.329926, -0.228100, -0.589700, 0.774700, 0.074761, 0.950323},
+    {0.883301, -0.845923, 0.145245, -0.984600, 0.173500, 0.023200, 0.043601, 0.991871},
+    {0.832945, -0.731266, 0.127589, -0.845300, -0.533100, 0.035400, 0.050505, 0.991871},
+    {0.790304, -0.936706, 0.117147, -0.523400, 0.849800, 0.062800, 0.033214, 0.991871},
+    {0.790304, -0.936706, 0.117147, -0.523400, 0.849800, 0.062800, 0.012440, 0.971097},
+    {0.638683, -0.947437, -0.117999, -0.359200, 0.883800, 0.299700, 0.012440, 0.960710},
+    {0.434716, -0.936706, -0.309520, -0.157900, 0.855000, 0.494000, 0.012440, 0.950323},
+    {0.000001, 0.310883, 0.573716, -0.000000, -0.100500, 0.994900, 0.027346, 0.058473},
+    {0.000001, 0.394519, 0.330803, -0.000000, 0.972000, 0.234800, 0.060783, 0.035651},
+    {-0.168862, 0.299834, 0.513638, -0.736200, 0.042700, 0.675400, 0.030000, 0.048389},
+    {-0.130370, 0.265927, 0.489209, -0.229800, -0.938200, 0.258900, 0.022569, 0.048389},
+    {0.104333, 0.344153, 0.453780, 0.332100, 0.907400, 0.257700, 0.048045, 0.048389},
+    {0.130372, 0.265927, 0.489209, 0.229800, -0.938200, 0.258900, 0.022569, 0.048389},
+    {0.168863, 0.299834, 0.513638, 0.736200, 0.042700, 0.675400, 0.030000, 0.048389},
+    {0.131147, 0.388591, 0.162489, 0.396000, 0.898300, -0.190300, 0.048045, 0.022913},
+    {0.000001, 0.496334, 0.127686, -0.000000, 0.935600, -0.353000, 0.060783, 0.022913},
+    {-0.243691, 0.346372, 0.133902, -0.853500, 0.130300, -0.504500, 0.030000, 0.022913},
+    {0.243692, 0.346372, 0.133902, 0.853500, 0.130300, -0.504500, 0.030000, 0.022913},
+    {-0.188143, 0.307190, 0.152513, -0.253300, -0.885000, -0.390600, 0.022569, 0.022913},
+    {0.000001, 0.324976, 0.114528, -0.000000, -0.934700, -0.355400, 0.022569, 0.010176},
+    {0.188144, 0.307190, 0.152513, 0.253300, -0.885000, -0.390600, 0.022569, 0.022913},
+    {-0.202724, 0.298988, 0.543263, 0.734700, -0.023800, -0.678000, 0.051818, 0.953235},
+    {0.000001, 0.435469, 0.349460, -0.000000, -0.956700, -0.290900, 0.092207, 0.936523},
+    {0.000001, 0.315446, 0.618483, -0.000000, -0.004100, -1.000000, 0.048336, 0.966466},
+    {0.000001, 0.540575, 0.119456, -0.000000, -0.930100, 0.367300, 0.092207, 0.919810},
+    {-0.282685, 0.344434, 0.111528, 0.849300, -0.099300, 0.518400, 0.051818, 0.919810},
+    {-0.198985, 0.266606, 0.136377, 0.330900, 0.847800, 0.414400, 0.042069, 0.919810},
+    {-0.140606, 0.223568, 0.500432, 0.295800, 0.903800, -0.309400, 0.042069, 0.953235},
+    {0.282686, 0.344434, 0.111528, -0.849300, -0.099300, 0.518400, 0.051818, 0.919810},
+    {0.202726, 0.298988, 0.543263, -0.734700, -0.023800, -0.678000, 0.051818, 0.953235},
+    {0.140608, 0.223568, 0.500432, -0.295800, 0.903800, -0.309400, 0.042069, 0.953235},
+    {0.000001, 0.285221, 0.093446, -0.000000, 0.891600, 0.452700, 0.042069, 0.903098},
+    {0.000001, 0.341621, 0.028716, -0.000000, 0.108200, 0.994100, 0.048336, 0.906579},
+    {0.198986, 0.266606, 0.136377, -0.330900, 0.847800, 0.414400, 0.042069, 0.919810},
+    {0.175499, 0.497771, 0.099102, -0.508200, -0.113800, -0.853700, 0.027441, 0.969607},
+    {0.171809, 0.544940, 0.141216, -0.478900, 0.861200, 0.170300, 0.041206, 0.973418},
+    {0.231091, 0.569777, 0.102617, 0.039100, 0.987200, -0.154800, 0.031998, 0.988770},
+    {0.219280, 0.459575, 0.124332, 0.478900, -0.861200, -0.170300, 0.013677, 0.965795},
+    {0.268234, 0.552563, 0.082799, 0.715800, 0.495400, -0.492100, 0.021286, 0.991838},
+    {0.122857, 0.451952, 0.182750, -0.715800, -0.495400, 0.492100, 0.033597, 0.947375},
+    {0.125531, 0.496723, 0.175191, -0.810200, 0.399500, 0.429100, 0.041206, 0.955516},
+    {0.160000, 0.434738, 0.162932, -0.039100, -0.987200, 0.154800, 0.022885, 0.950443},
+    {0.265559, 0.507793, 0.090357, 0.810200, -0.399500, -0.429100, 0.013677, 0.983697},
+    {-0.219280, 0.459575, 0.124332, -0.478900, -0.861200, -0.170300, 0.041206, 0.928736},
+    {-0.233768, 0.535526, 0.072038, 0.055900, 0.163700, -0.984900, 0.023641, 0.938651},
+    {-0.154448, 0.444203, 0.137456, 0.325200, -0.783800, -0.529000, 0.036375, 0.914651},
+    {-0.159998, 0.434738, 0.162932, 0.039100, -0.987200, 0.154800, 0.041206, 0.910834},
+    {-0.265558, 0.507793, 0.090357, -0.810200, -0.399500, -0.429100, 0.031998, 0.944088},
+    {-0.212761, 0.554968, 0.087983, 0.392400, 0.623200, -0.676500, 0.018508, 0.935198},
+    {-0.122855, 0.451952, 0.182750, 0.715800, -0.495400, 0.492100, 0.033597, 0.902693},
+    {-0.231089, 0.569777, 0.102617, -0.039100, 0.987200, -0.154800, 0.013677, 0.939015},
+    {-0.268232, 0.552563, 0.082800, -0.715800, 0.495400, -0.492100, 0.021286, 0.947156},
+    {-0.125530, 0.496723, 0.175191, 0.810200, 0.399500, 0.429100, 0.022885, 0.905761},
+    {-0.171808, 0.544940, 0.141216, 0.478900, 0.861200, 0.170300, 0.013677, 0.921113},
+    {-0.171808, 0.544940, 0.141216, 0.478900, 0.861200, 0.170300, 0.068954, 0.965795},
+    {-0.150053, 0.500390, 0.187622, 0.191300, 0.426400, 0.884100, 0.057567, 0.956202},
+    {-0.125530, 0.496723, 0.175191, 0.810200, 0.399500, 0.429100, 0.059746, 0.950443},
+    {-0.231089, 0.569777, 0.102617, -0.039100, 0.987200, -0.154800, 0.068954, 0.983697},
+    {-0.122855, 0.451952, 0.182750, 0.715800, -0.495400, 0.492100, 0.049034, 0.947375},
+    {-0.178327, 0.449548, 0.177566, -0.392400, -0.623200, 0.676500, 0.046256, 0.959334},
+    {-0.268232, 0.552563, 0.082800, -0.715800, 0.495400, -0.492100, 0.061345, 0.991838},
+    {-0.159998, 0.434738, 0.162932, 0.039100, -0.987200, 0.154800, 0.041425, 0.955516},
+    {-0.219280, 0.459575, 0.124332, -0.478900, -0.861200, -0.170300, 0.041425, 0.973418},
+    {-0.265558, 0.507793, 0.090357, -0.810200, -0.399500, -0.429100, 0.050633, 0.988770},
+    {0.231091, 0.569777, 0.102617, 0.039100, 0.987200, -0.154800, 0.082820, 0.921014},
+    {0.262880, 0.542042, 0.120938, 0.808700, 0.357300, 0.467400, 0.077383, 0.912657},
+    {0.268234, 0.552563, 0.082799, 0.715800, 0.495400, -0.492100, 0.085888, 0.910302},
+    {0.171809, 0.544940, 0.141216, -0.478900, 0.861200, 0.170300, 0.067468, 0.930222},
+    {0.150055, 0.500390, 0.187622, -0.191300, 0.426400, 0.884100, 0.053383, 0.925391},
+    {0.265559, 0.507793, 0.090357, 0.810200, -0.399500, -0.429100, 0.077747, 0.902693},
+    {0.178328, 0.449548, 0.177566, 0.392400, -0.623200, 0.676500, 0.050252, 0.914080},
+    {0.122857, 0.451952, 0.182750, -0.715800, -0.495400, 0.492100, 0.041425, 0.922613},
+    {0.125531, 0.496723, 0.175191, -0.810200, 0.399500, 0.429100, 0.049566, 0.930222},
+    {0.160000, 0.434738, 0.162932, -0.039100, -0.987200, 0.154800, 0.044493, 0.911901},
+    {0.219280, 0.459575, 0.124332, 0.478900, -0.861200, -0.170300, 0.059845, 0.902693},
+    {0.000001, -0.411439, -0.558484, -0.000000, -0.003800, -1.000000, 0.303499, 0.277744},
+    {-0.174280, -0.704023, -0.455259, -0.292300, -0.599400, -0.745200, 0.171021, 0.368583},
+    {-0.193304, -0.570808, -0.511405, -0.342600, -0.251700, -0.905100, 0.235716, 0.372905},
+    {0.183425, -0.235276, -0.513898, 0.343800, 0.132800, -0.929600, 0.379420, 0.186626},
+    {0.193306, -0.570808, -0.511405, 0.342600, -0.251700, -0.905100, 0.223009, 0.193059},
+    {-0.183424, -0.235276, -0.513898, -0.343800, 0.132800, -0.929600, 0.391478, 0.357281},
+    {0.000001, -0.034412, -0.513778, -0.000000, 0.161600, -0.986900, 0.478888, 0.265352},
+    {0.174281, -0.704024, -0.455259, 0.292300, -0.599400, -0.745200, 0.159565, 0.206435},
+    {0.000001, -0.790496, -0.374140, -0.000000, -0.947900, -0.318600, 0.104567, 0.291799},
+    {-0.416224, -0.727564, -0.190293, -0.700900, -0.647500, -0.299100, 0.165829, 0.485511},
+    {-0.358873, -0.578813, -0.404284, -0.679000, -0.266800, -0.684000, 0.237434, 0.450190},
+    {-0.342110, -0.239909, -0.419029, -0.678500, 0.157300, -0.717500, 0.394538, 0.431253},
+    {-0.251098, 0.175670, -0.379512, -0.658100, 0.182700, -0.730400, 0.584870, 0.375255},
+    {-0.123775, 0.404939, -0.412651, -0.341200, 0.208900, -0.916500, 0.686235, 0.308569},
+    {0.123776, 0.404939, -0.412651, 0.341200, 0.208900, -0.916500, 0.678098, 0.193410},
+    {0.000001, 0.408368, -0.433834, -0.000000, 0.220400, -0.975400, 0.683794, 0.250874},
+    {-0.222358, 0.599408, -0.305107, -0.638200, 0.281200, -0.716700, 0.772919, 0.348532},
+    {-0.119594, 0.610294, -0.359743, -0.316200, 0.328000, -0.890200, 0.773900, 0.300420},
+    {-0.292940, 0.586394, -0.214084, -0.883000, 0.242800, -0.401600, 0.774076, 0.384184},
+    {-0.483041, -0.437992, -0.241275, -0.922300, -0.004200, -0.386500, 0.306364, 0.506857},
+    {-0.520150, -0.621311, 0.012464, -0.955600, -0.292000, -0.040100, 0.200515, 0.568731},
+    {-0.380815, 0.159715, -0.129771, -0.974800, 0.216000, -0.056700, 0.583189, 0.443916},
+    {-0.442039, -0.052336, -0.099382, -0.957300, 0.283400, -0.057300, 0.488713, 0.492568},
+    {-0.504715, -0.257458, -0.054706, -0.974300, 0.217100, -0.059500, 0.394237, 0.541219},
+    {-0.534973, -0.452152, -0.014140, -0.997900, 0.024400, -0.059200, 0.297376, 0.554975},
+    {-0.348029, 0.373915, -0.130422, -0.988600, 0.143000, -0.047000, 0.685443, 0.431535},
+    {-0.198167, 0.753506, -0.244366, -0.611200, 0.480600, -0.628800, 0.829115, 0.333252},
+    {-0.274555, 0.722423, -0.068044, -0.910600, 0.406300, 0.076100, 0.848399, 0.380665},
+    {-0.321937, 0.568757, -0.106233, -0.979000, 0.203500, -0.009100, 0.787697, 0.419153},
+    {0.000001, 0.775991, -0.296841, -0.000000, 0.571300, -0.820700, 0.831241, 0.240456},
+    {-0.201689, 0.828541, -0.030127, -0.709000, 0.677900, 0.194500, 0.909101, 0.342178},
+    {-0.102431, 0.900050, -0.100455, -0.328100, 0.939300, -0.099900, 0.894551, 0.284367},
+    {-0.099358, 0.865963, -0.196678, -0.259200, 0.814400, -0.519200, 0.866299, 0.284431},
+    {0.099359, 0.865963, -0.196678, 0.259200, 0.814400, -0.519200, 0.859768, 0.191989},
+    {0.198169, 0.753506, -0.244366, 0.611200, 0.480600, -0.628800, 0.816088, 0.148881},
+    {0.190001, 0.844813, -0.120802, 0.661300, 0.738200, -0.133000, 0.861783, 0.148124},
+    {0.106778, 0.886576, -0.005250, 0.363000, 0.885600, 0.289600, 0.915920, 0.180862},
+    {0.000001, 0.903854, 0.003258, -0.000000, 0.947500, 0.319700, 0.937815, 0.232927},
+    {-0.106777, 0.886574, -0.005250, -0.363000, 0.885600, 0.289600, 0.923458, 0.287552},
+    {0.201691, 0.828541, -0.030127, 0.709000, 0.677900, 0.194500, 0.894025, 0.128798},
+    {0.274556, 0.722423, -0.068044, 0.910600, 0.406300, 0.076100, 0.828514, 0.099228},
+    {0.222359, 0.599408, -0.305107, 0.638200, 0.281200, -0.716700, 0.758302, 0.141655},
+    {0.292942, 0.586394, -0.214084, 0.883000, 0.242800, -0.401600, 0.754435, 0.106194},
+    {0.321938, 0.568757, -0.106233, 0.979000, 0.203500, -0.009100, 0.763004, 0.069658},
+    {0.348031, 0.373915, -0.130422, 0.988600, 0.143000, -0.047000, 0.660024, 0.071777},
+    {0.483043, -0.437992, -0.241275, 0.922300, -0.004200, -0.386500, 0.274120, 0.050504},
+    {0.251099, 0.175670, -0.379512, 0.658100, 0.182700, -0.730400, 0.568364, 0.141638},
+    {0.342112, -0.239909, -0.419029, 0.678500, 0.157300, -0.717500, 0.372049, 0.112959},
+    {0.358874, -0.578813, -0.404284, 0.679000, -0.266800, -0.684000, 0.213843, 0.116300},
+    {0.520151, -0.621311, 0.012464, 0.955600, -0.292000, -0.040100, 0.160623, 0.004128},
+    {0.416225, -0.727564, -0.190293, 0.700900, -0.647500, -0.299100, 0.137983, 0.091398},
+    {0.160103, -0.784519, -0.351702, 0.156800, -0.923700, -0.349600, 0.108167, 0.216695},
+    {0.339575, -0.802283, 0.011226, 0.210300, -0.977600, -0.013000, 0.058820, 0.101351},
+    {0.454603, -0.745843, 0.019679, 0.705100, -0.708900, -0.015500, 0.109722, 0.052739},
+    {0.534974, -0.452152, -0.014140, 0.997900, 0.024400, -0.059200, 0.258456, 0.004127},
+    {0.504716, -0.257458, -0.054706, 0.974300, 0.217100, -0.059500, 0.356289, 0.004127},
+    {0.442040, -0.052336, -0.099382, 0.957300, 0.283400, -0.057300, 0.456667, 0.039012},
+    {0.380816, 0.159715, -0.129771, 0.974800, 0.216000, -0.056700, 0.557045, 0.073896},
+    {0.181417, -0.784429, -0.005086, -0.101700, -0.994800, -0.000000, 0.031594, 0.200115},
+    {-0.316382, -0.793309, -0.176827, -0.279200, -0.949800, -0.141100, 0.116942, 0.442483},
+    {0.000001, -0.759469, -0.014259, -0.000000, -0.999900, 0.013000, 0.004367, 0.298879},
+    {-0.181415, -0.784429, -0.005086, 0.101700, -0.994800, -0.000000, 0.045210, 0.392834},
+    {-0.339574, -0.802283, 0.011226, -0.210300, -0.977600, -0.013000, 0.086053, 0.486788},
+    {-0.454601, -0.745843, 0.019679, -0.705100, -0.708900, -0.015500, 0.143284, 0.527760},
+    {0.278056, -0.767084, 0.317796, 0.233400, -0.912800, 0.335100, 0.868437, 0.835431},
+    {0.339575, -0.802283, 0.011226, 0.210300, -0.977600, -0.013000, 0.930059, 0.894764},
+    {0.454603, -0.745843, 0.019679, 0.705100, -0.708900, -0.015500, 0.879158, 0.943376},
+    {0.000001, -0.759469, -0.014259, -0.000000, -0.999900, 0.013000, 0.984513, 0.697236},
+    {-0.185053, -0.714073, 0.443702, -0.190000, -0.665600, 0.721700, 0.822179, 0.622190},
+    {0.185054, -0.714073, 0.443702, 0.190000, -0.665600, 0.721700, 0.834344, 0.794361},
+    {0.392126, -0.600247, 0.411696, 0.645400, -0.259800, 0.718300, 0.786100, 0.894578},
+    {-0.161071, -0.776995, 0.338754, -0.072300, -0.958100, 0.277100, 0.866657, 0.630260},
+    {0.181417, -0.784429, -0.005086, -0.101700, -0.994800, -0.000000, 0.957286, 0.796000},
+    {-0.181415, -0.784429, -0.005086, 0.101700, -0.994800, -0.000000, 0.943670, 0.603281},
+    {-0.339574, -0.802283, 0.011226, -0.210300, -0.977600, -0.013000, 0.902827, 0.509326},
+    {-0.426997, -0.730529, 0.224519, -0.657100, -0.698400, 0.283700, 0.824076, 0.505494},
+    {-0.227230, -0.448480, 0.494324, -0.282700, 0.169200, 0.944200, 0.695143, 0.611448},
+    {-0.392125, -0.600247, 0.411696, -0.645400, -0.259800, 0.718300, 0.760323, 0.529752},
+    {0.216166, -0.600098, 0.496433, 0.263300, -0.234000, 0.935900, 0.780248, 0.812728},
+    {0.227231, -0.448480, 0.494324, 0.282700, 0.169200, 0.944200, 0.710080, 0.822858},
+    {0.410197, -0.450740, 0.399776, 0.688600, 0.152400, 0.709000, 0.717145, 0.907898},
+    {0.494870, -0.614192, 0.238644, 0.899000, -0.294500, 0.324200, 0.798831, 0.946058},
+    {0.154762, 0.131593, 0.205140, 0.401900, 0.355300, 0.843900, 0.437854, 0.808212},
+    {0.000001, -0.266897, 0.460298, -0.000000, 0.398500, 0.917200, 0.618141, 0.723122},
+    {-0.215038, -0.269761, 0.430833, -0.292100, 0.424900, 0.856800, 0.612405, 0.622994},
+    {-0.410195, -0.450740, 0.399776, -0.688600, 0.152400, 0.709000, 0.690181, 0.526260},
+    {-0.494869, -0.614192, 0.238644, -0.899000, -0.294500, 0.324200, 0.765689, 0.476993},
+    {-0.504715, -0.257458, -0.054706, -0.974300, 0.217100, -0.059500, 0.594643, 0.454895},
+    {-0.282919, 0.131836, 0.111509, -0.675600, 0.336000, 0.656200, 0.423355, 0.604616},
+    {0.000001, 0.134398, 0.245123, -0.000000, 0.352700, 0.935700, 0.431463, 0.736311},
+    {-0.154760, 0.131593, 0.205140, -0.401900, 0.355300, 0.843900, 0.427681, 0.664226},
+    {0.000001, 0.335486, 0.201882, -0.000000, 0.124300, 0.992200, 0.337918, 0.742921},
+    {0.282920, 0.131836, 0.111509, 0.675600, 0.336000, 0.656200, 0.441953, 0.867838},
+    {0.139265, 0.334733, 0.164514, 0.429000, 0.117200, 0.895700, 0.342845, 0.807680},
+    {-0.103684, 0.767768, 0.132312, -0.298700, 0.429500, 0.852300, 0.133417, 0.708896},
+    {-0.139264, 0.334733, 0.164514, -0.429000, 0.117200, 0.895700, 0.333691, 0.678111},
+    {0.115687, 0.662038, 0.158229, 0.349000, 0.158100, 0.923700, 0.189812, 0.807469},
+    {0.000001, 0.774808, 0.147416, -0.000000, 0.449600, 0.893200, 0.133550, 0.757360},
+    {-0.361348, 0.143905, -0.002664, -0.889600, 0.274800, 0.364800, 0.414871, 0.567050},
+    {-0.534973, -0.452152, -0.014140, -0.997900, 0.024400, -0.059200, 0.691504, 0.441139},
+    {-0.442039, -0.052336, -0.099382, -0.957300, 0.283400, -0.057300, 0.500167, 0.503547},
+    {-0.207907, 0.667844, 0.101724, -0.664600, 0.168100, 0.728100, 0.176475, 0.657128},
+    {-0.380815, 0.159715, -0.129771, -0.974800, 0.216000, -0.056700, 0.405691, 0.552198},
+    {-0.260230, 0.693281, 0.024537, -0.858000, 0.293100, 0.421900, 0.161718, 0.631992},
+    {-0.348029, 0.373915, -0.130422, -0.988600, 0.143000, -0.047000, 0.303437, 0.564580},
+    {-0.321937, 0.568757, -0.106233, -0.979000, 0.203500, -0.009100, 0.201183, 0.576962},
+    {-0.274555, 0.722423, -0.068044, -0.910600, 0.406300, 0.076100, 0.140481, 0.615449},
+    {-0.201689, 0.828541, -0.030127, -0.709000, 0.677900, 0.194500, 0.079778, 0.653937},
+    {-0.106777, 0.886574, -0.005250, -0.363000, 0.885600, 0.289600, 0.065422, 0.708562},
+    {0.000001, 0.855305, 0.086883, -0.000000, 0.749700, 0.661800, 0.093800, 0.760168},
+    {0.000001, 0.903854, 0.003258, -0.000000, 0.947500, 0.319700, 0.051065, 0.763188},
+    {0.106778, 0.886576, -0.005250, 0.363000, 0.885600, 0.289600, 0.072960, 0.815252},
+    {0.207908, 0.667844, 0.101724, 0.664600, 0.168100, 0.728100, 0.190142, 0.850561},
+    {0.201691, 0.828541, -0.030127, 0.709000, 0.677900, 0.194500, 0.094854, 0.867316},
+    {0.260231, 0.693281, 0.024537, 0.858000, 0.293100, 0.421900, 0.179066, 0.877522},
+    {0.361349, 0.143905, -0.002664, 0.889600, 0.274800, 0.364800, 0.438835, 0.906224},
+    {0.274556, 0.722423, -0.068044, 0.910600, 0.406300, 0.076100, 0.160365, 0.896887},
+    {0.321938, 0.568757, -0.106233, 0.979000, 0.203500, -0.009100, 0.225876, 0.926457},
+    {0.348031, 0.373915, -0.130422, 0.988600, 0.143000, -0.047000, 0.328855, 0.924338},
+    {0.380816, 0.159715, -0.129771, 0.974800, 0.216000, -0.056700, 0.431835, 0.922219},
+    {0.442040, -0.052336, -0.099382, 0.957300, 0.283400, -0.057300, 0.532213, 0.957103},
+    {0.504716, -0.257458, -0.054706, 0.974300, 0.217100, -0.059500, 0.632591, 0.991987},
+    {0.534974, -0.452152, -0.014140, 0.997900, 0.024400, -0.059200, 0.730424, 0.991987},
+    {0.520151, -0.621311, 0.012464, 0.955600, -0.292000, -0.040100, 0.828257, 0.991987},
+    {-0.520150, -0.621311, 0.012464, -0.955600, -0.292000, -0.040100, 0.788365, 0.427384},
+    {-0.454601, -0.745843, 0.019679, -0.705100, -0.708900, -0.015500, 0.845596, 0.468355},
+    {-0.214075, -0.585938, -0.565624, 0.343700, 0.254700, 0.903900, 0.039001, 0.923484},
+    {0.000001, -0.846874, -0.394675, -0.000000, 0.944700, 0.327900, 0.025805, 0.915324},
+    {0.000001, -0.747628, -0.532734, -0.000000, 0.616400, 0.787400, 0.031524, 0.914919},
+    {-0.383051, -0.230746, -0.461923, 0.678800, -0.156100, 0.717600, 0.054981, 0.929355},
+    {-0.399548, -0.594805, -0.445390, 0.678200, 0.268600, 0.684100, 0.039174, 0.931260},
+    {0.000001, -0.411791, -0.618483, -0.000000, 0.005800, 1.000000, 0.045821, 0.913909},
+    {-0.204224, -0.227473, -0.569634, 0.345400, -0.131900, 0.929100, 0.054673, 0.921912},
+    {-0.293500, -0.823523, -0.328351, 0.341500, 0.864800, 0.368100, 0.029033, 0.927963},
+    {0.214076, -0.585938, -0.565624, -0.343700, 0.254700, 0.903900, 0.037723, 0.905389},
+    {0.204226, -0.227473, -0.569634, -0.345400, -0.131900, 0.929100, 0.053460, 0.904741},
+    {0.000001, -0.024607, -0.572971, -0.000000, -0.161400, 0.986900, 0.063468, 0.912662},
+    {-0.290561, 0.186661, -0.423351, 0.657200, -0.182900, 0.731200, 0.074132, 0.923721},
+    {-0.144052, 0.417370, -0.467736, 0.341400, -0.209500, 0.916300, 0.084331, 0.917011},
+    {-0.538333, -0.438140, -0.264574, 0.921900, 0.006000, 0.387400, 0.046110, 0.936962},
+    {-0.497170, -0.788113, 0.018603, 0.705100, 0.709000, 0.015700, 0.029701, 0.939065},
+    {-0.577484, -0.638801, 0.009849, 0.954200, 0.296800, 0.038800, 0.035459, 0.943188},
+    {-0.353326, -0.860686, 0.011348, 0.222900, 0.974800, 0.012700, 0.023943, 0.934943},
+    {-0.176548, -0.844220, -0.003897, -0.092200, 0.995700, 0.001200, 0.019833, 0.925489},
+    {-0.170485, -0.856369, -0.195298, -0.008000, 0.999800, 0.019400, 0.023326, 0.923727},
+    {0.000001, -0.819448, -0.012634, -0.000000, 0.999900, -0.011600, 0.015724, 0.916036},
+    {0.176549, -0.844220, -0.003897, 0.092200, 0.995700, 0.001200, 0.018463, 0.906098},
+    {0.293501, -0.823523, -0.328351, -0.341500, 0.864800, 0.368100, 0.027224, 0.902356},
+    {0.353327, -0.860686, 0.011348, -0.222900, 0.974800, 0.012700, 0.021202, 0.896161},
+    {0.399550, -0.594806, -0.445390, -0.678200, 0.268600, 0.684100, 0.036800, 0.897665},
+    {0.497171, -0.788113, 0.018603, -0.705100, 0.709000, 0.015700, 0.026324, 0.891270},
+    {0.538334, -0.438140, -0.264574, -0.921900, 0.006000, 0.387400, 0.042865, 0.891045},
+    {0.525080, -0.619808, -0.239904, -0.883900, 0.283800, 0.371700, 0.035008, 0.892033},
+    {0.383053, -0.230746, -0.461923, -0.678800, -0.156100, 0.717600, 0.052719, 0.897329},
+    {0.577486, -0.638801, 0.009849, -0.954200, 0.296800, 0.038800, 0.031446, 0.886379},
+    {0.594850, -0.450686, -0.017715, -0.998100, -0.022200, 0.057600, 0.041289, 0.886379},
+    {0.563137, -0.244294, -0.058431, -0.974600, -0.216100, 0.058100, 0.051133, 0.886379},
+    {0.499430, -0.035209, -0.103003, -0.957500, -0.283100, 0.056100, 0.061233, 0.889889},
+    {0.439279, 0.172726, -0.133350, -0.974700, -0.216200, 0.056700, 0.071332, 0.893399},
+    {0.407353, 0.382442, -0.133257, -0.988500, -0.143600, 0.047500, 0.081694, 0.893185},
+    {0.345892, 0.601333, -0.238024, -0.883200, -0.243800, 0.400700, 0.091193, 0.896648},
+    {0.290563, 0.186661, -0.423351, -0.657200, -0.182900, 0.731200, 0.072471, 0.900215},
+    {0.144053, 0.417370, -0.467736, -0.341400, -0.209500, 0.916300, 0.083512, 0.905424},
+    {0.260869, 0.616687, -0.347751, -0.638800, -0.282600, 0.715600, 0.091582, 0.900216},
+    {0.380650, 0.581113, -0.106782, -0.978800, -0.204400, 0.008700, 0.092055, 0.892972},
+    {0.329261, 0.746698, -0.063783, -0.909500, -0.408600, -0.076900, 0.098647, 0.895948},
+    {0.138481, 0.630142, -0.413124, -0.318300, -0.329200, 0.889000, 0.092361, 0.904995},
+    {0.000001, 0.421582, -0.492361, -0.000000, -0.220900, 0.975300, 0.084085, 0.911206},
+    {0.125510, 0.801407, -0.332983, -0.276500, -0.546100, 0.790700, 0.098164, 0.905084},
+    {-0.138479, 0.630142, -0.413124, 0.318300, -0.329200, 0.889000, 0.093152, 0.916191},
+    {0.200501, 0.877277, -0.217840, -0.539000, -0.704000, 0.462400, 0.100524, 0.902138},
+    {0.244303, 0.869197, -0.018670, -0.707500, -0.679800, -0.193400, 0.105238, 0.898923},
+    {0.000001, 0.928312, -0.232224, -0.000000, -0.842400, 0.538900, 0.102726, 0.909889},
+    {-0.234778, 0.782992, -0.281652, 0.611400, -0.482200, 0.627400, 0.098707, 0.919494},
+    {-0.260867, 0.616687, -0.347751, 0.638800, -0.282600, 0.715600, 0.093053, 0.921032},
+    {-0.345890, 0.601333, -0.238024, 0.883200, -0.243800, 0.400700, 0.093169, 0.924619},
+    {-0.329260, 0.746698, -0.063783, 0.909500, -0.408600, -0.076900, 0.100648, 0.924265},
+    {-0.229708, 0.888923, -0.129609, 0.665400, -0.735300, 0.128600, 0.103270, 0.918923},
+    {0.000001, 0.960676, 0.022527, -0.000000, -0.948100, -0.317800, 0.109644, 0.909400},
+    {0.128573, 0.939713, 0.012110, -0.364100, -0.886000, -0.287200, 0.107441, 0.904161},
+    {-0.128572, 0.939713, 0.012110, 0.364100, -0.886000, -0.287200, 0.108200, 0.914896},
+    {-0.244301, 0.869197, -0.018670, 0.707500, -0.679800, -0.193400, 0.106755, 0.920392},
+    {-0.380648, 0.581113, -0.106782, 0.978800, -0.204400, 0.008700, 0.094540, 0.928137},
+    {-0.407351, 0.382442, -0.133257, 0.988500, -0.143600, 0.047500, 0.084251, 0.929383},
+    {-0.439277, 0.172726, -0.133350, 0.974700, -0.216200, 0.056700, 0.073963, 0.930629},
+    {-0.594848, -0.450686, -0.017715, 0.998100, -0.022200, 0.057600, 0.045205, 0.941803},
+    {-0.499429, -0.035209, -0.103003, 0.957500, -0.283100, 0.056100, 0.064457, 0.935524},
+    {-0.563135, -0.244294, -0.058431, 0.974600, -0.216100, 0.058100, 0.054951, 0.940419},
+    {0.176549, -0.844220, -0.003897, 0.092200, 0.995700, 0.001200, 0.111603, 0.966055},
+    {0.291712, -0.822029, 0.337659, -0.237900, 0.910000, -0.339600, 0.102664, 0.970022},
+    {0.353327, -0.860686, 0.011348, -0.222900, 0.974800, 0.012700, 0.108864, 0.975992},
+    {0.000001, -0.819448, -0.012634, -0.000000, 0.999900, -0.011600, 0.114343, 0.956117},
+    {0.497171, -0.788113, 0.018603, -0.705100, 0.709000, 0.015700, 0.103742, 0.980883},
+    {0.430907, -0.615445, 0.454881, -0.646100, 0.259500, -0.717800, 0.094379, 0.975973},
+    {0.577486, -0.638801, 0.009849, -0.954200, 0.296800, 0.038800, 0.098621, 0.985774},
+    {0.548950, -0.631316, 0.258192, -0.897700, 0.295600, -0.326600, 0.095660, 0.981153},
+    {0.451384, -0.441841, 0.442488, -0.689100, -0.148700, -0.709200, 0.087441, 0.977314},
+    {-0.232166, -0.613928, 0.552582, 0.266800, 0.235500, -0.934500, 0.092361, 0.947502},
+    {0.196453, -0.754103, 0.486917, -0.193100, 0.662600, -0.723700, 0.099233, 0.965890},
+    {0.244616, -0.438406, 0.550859, -0.291200, -0.161600, -0.942900, 0.086730, 0.968757},
+    {0.563137, -0.244294, -0.058431, -0.974600, -0.216100, 0.058100, 0.078934, 0.985774},
+    {0.594850, -0.450686, -0.017715, -0.998100, -0.022200, 0.057600, 0.088777, 0.985774},
+    {0.178430, 0.152591, 0.256119, -0.399100, -0.355400, -0.845200, 0.059340, 0.967283},
+    {0.323273, 0.151816, 0.151164, -0.678000, -0.335800, -0.653800, 0.059752, 0.973283},
+    {0.000001, -0.241853, 0.514821, -0.000000, -0.405100, -0.914300, 0.077480, 0.958722},
+    {-0.196451, -0.754103, 0.486917, 0.193100, 0.662600, -0.723700, 0.098009, 0.948566},
+    {-0.244615, -0.438406, 0.550859, 0.291200, -0.161600, -0.942900, 0.085227, 0.947486},
+    {-0.430906, -0.615445, 0.454881, 0.646100, 0.259500, -0.717800, 0.091786, 0.939266},
+    {-0.291710, -0.822029, 0.337659, 0.237900, 0.910000, -0.339600, 0.100825, 0.943993},
+    {-0.577484, -0.638801, 0.009849, 0.954200, 0.296800, 0.038800, 0.094607, 0.928966},
+    {-0.548948, -0.631318, 0.258192, 0.897700, 0.295600, -0.326600, 0.092326, 0.933957},
+    {-0.353326, -0.860686, 0.011348, 0.222900, 0.974800, 0.012700, 0.106124, 0.937210},
+    {-0.497170, -0.788113, 0.018603, 0.705100, 0.709000, 0.015700, 0.100365, 0.933088},
+    {-0.451382, -0.441841, 0.442488, 0.689100, -0.148700, -0.709200, 0.084728, 0.938914},
+    {-0.178429, 0.152591, 0.256119, 0.399100, -0.355400, -0.845200, 0.058316, 0.952796},
+    {0.000001, 0.155497, 0.301292, -0.000000, -0.352000, -0.936000, 0.058697, 0.960049},
+    {0.000001, 0.342979, 0.261413, -0.000000, -0.122400, -0.992500, 0.049284, 0.960714},
+    {-0.323272, 0.151816, 0.151164, 0.678000, -0.335800, -0.653800, 0.057881, 0.946798},
+    {-0.164711, 0.341933, 0.218372, 0.425700, -0.115400, -0.897500, 0.048859, 0.954193},
+    {-0.563135, -0.244294, -0.058431, 0.974600, -0.216100, 0.058100, 0.075115, 0.931734},
+    {-0.594848, -0.450686, -0.017715, 0.998100, -0.022200, 0.057600, 0.084861, 0.930350},
+    {-0.414827, 0.160529, 0.018867, 0.891500, -0.274700, -0.360100, 0.057027, 0.943018},
+    {-0.499429, -0.035209, -0.103003, 0.957500, -0.283100, 0.056100, 0.065609, 0.936629},
+    {-0.297551, 0.346183, 0.121358, 0.706600, -0.113100, -0.698500, 0.048273, 0.948772},
+    {-0.247493, 0.678671, 0.145493, 0.665600, -0.170900, -0.726500, 0.033041, 0.952082},
+    {-0.136861, 0.671452, 0.213573, 0.348200, -0.160900, -0.923500, 0.033617, 0.956379},
+    {-0.128572, 0.939713, 0.012110, 0.364100, -0.886000, -0.287200, 0.021867, 0.957257},
+    {-0.244301, 0.869197, -0.018670, 0.707500, -0.679800, -0.193400, 0.023311, 0.951761},
+    {0.000001, 0.801500, 0.201152, -0.000000, -0.451800, -0.892100, 0.028722, 0.962167},
+    {-0.311681, 0.710912, 0.049872, 0.857600, -0.295900, -0.420600, 0.031556, 0.949553},
+    {0.000001, 0.900422, 0.126435, -0.000000, -0.750400, -0.661000, 0.024722, 0.962449},
+    {0.122609, 0.793451, 0.183128, -0.298900, -0.432500, -0.850700, 0.029394, 0.966997},
+    {0.000001, 0.960676, 0.022527, -0.000000, -0.948100, -0.317800, 0.020422, 0.962753},
+    {0.128573, 0.939713, 0.012110, -0.364100, -0.886000, -0.287200, 0.022625, 0.967992},
+    {0.244303, 0.869197, -0.018670, -0.707500, -0.679800, -0.193400, 0.024828, 0.973230},
+    {0.164713, 0.341933, 0.218372, -0.425700, -0.115400, -0.897500, 0.049780, 0.967230},
+    {0.311683, 0.710912, 0.049872, -0.857600, -0.295900, -0.420600, 0.033301, 0.974257},
+    {0.247495, 0.678671, 0.145493, -0.665600, -0.170900, -0.726500, 0.034416, 0.971545},
+    {0.329261, 0.746698, -0.063783, -0.909500, -0.408600, -0.076900, 0.031420, 0.976206},
+    {0.407353, 0.382442, -0.133257, -0.988500, -0.143600, 0.047500, 0.048373, 0.978968},
+    {0.380650, 0.581113, -0.106782, -0.978800, -0.204400, 0.008700, 0.038011, 0.979181},
+    {0.414829, 0.160529, 0.018867, -0.891500, -0.274700, -0.360100, 0.059438, 0.977145},
+    {0.297553, 0.346183, 0.121358, -0.706600, -0.113100, -0.698500, 0.049962, 0.972680},
+    {0.439279, 0.172726, -0.133350, -0.974700, -0.216200, 0.056700, 0.058734, 0.978754},
+    {0.499430, -0.035209, -0.103003, -0.957500, -0.283100, 0.056100, 0.068834, 0.982264},
+    {-0.329260, 0.746698, -0.063783, 0.909500, -0.408600, -0.076900, 0.029419, 0.947888},
+    {-0.380648, 0.581113, -0.106782, 0.978800, -0.204400, 0.008700, 0.035527, 0.944016},
+    {-0.407351, 0.382442, -0.133257, 0.988500, -0.143600, 0.047500, 0.045815, 0.942770},
+    {-0.439277, 0.172726, -0.133350, 0.974700, -0.216200, 0.056700, 0.056104, 0.941524},
+    {-0.176548, -0.844220, -0.003897, -0.092200, 0.995700, 0.001200, 0.110233, 0.946664},
+    {-0.783811, -0.765491, 0.131409, -0.810500, 0.582600, -0.061200, 0.037537, 0.015853},
+    {-0.617731, -0.893993, -0.100539, -0.333700, -0.900700, -0.278100, 0.026495, 0.022486},
+    {-0.824596, -0.833767, 0.147677, -0.986500, -0.161700, -0.026900, 0.033128, 0.015853},
+    {-0.617731, -0.583588, -0.100539, -0.634400, 0.693300, -0.341900, 0.039761, 0.022486},
+    {-0.423877, -0.615053, -0.283993, -0.211400, 0.586400, -0.781900, 0.039761, 0.029119},
+    {-0.423877, -0.883499, -0.283993, -0.168300, -0.873000, -0.457800, 0.026495, 0.029119},
+    {-0.763241, -0.883499, 0.123206, -0.480600, -0.873000, -0.083100, 0.026495, 0.015853},
+    {-0.276391, -0.583588, -0.236682, 0.428000, 0.743700, -0.513500, 0.039761, 0.035752},
+    {-0.276391, -0.893993, -0.236682, 0.203600, -0.948100, -0.244300, 0.026495, 0.035752},
+    {-0.203270, -0.615053, -0.100137, 0.807200, 0.586400, 0.067000, 0.039761, 0.042386},
+    {-0.203270, -0.883499, -0.100137, 0.480600, -0.873000, 0.083100, 0.026495, 0.042386},
+    {-0.348779, -0.583588, 0.123608, 0.450600, 0.693300, 0.562300, 0.039761, 0.049019},
+    {-0.276391, -0.583588, -0.236682, 0.428000, 0.743700, -0.513500, 0.046394, 0.042386},
+    {-0.555644, -0.833767, 0.371822, 0.204300, -0.161700, 0.965500, 0.033128, 0.055652},
+    {-0.423877, -0.883499, -0.283993, -0.168300, -0.873000, -0.457800, 0.013229, 0.042386},
+    {-0.617731, -0.893993, -0.100539, -0.333700, -0.900700, -0.278100, 0.013229, 0.049019},
+    {-0.690121, -0.893993, 0.259749, -0.203600, -0.948100, 0.244300, 0.019862, 0.055652},
+    {-0.763241, -0.883499, 0.123206, -0.480600, -0.873000, -0.083100, 0.013229, 0.055652},
+    {-0.276391, -0.893993, -0.236682, 0.203600, -0.948100, -0.244300, 0.019862, 0.042386},
+    {-0.716281, -0.744574, 0.291140, -0.426800, 0.745300, 0.512200, 0.037537, 0.062285},
+    {-0.690121, -0.893993, 0.259749, -0.203600, -0.948100, 0.244300, 0.026495, 0.062285},
+    {-0.716281, -0.744574, 0.291140, -0.426800, 0.745300, 0.512200, 0.046394, 0.056875},
+    {-0.824596, -0.833767, 0.147677, -0.986500, -0.161700, -0.026900, 0.033128, 0.068918},
+    {-0.783811, -0.765491, 0.131409, -0.810500, 0.582600, -0.061200, 0.037537, 0.068918},
+    {-0.763241, -0.883499, 0.123206, -0.480600, -0.873000, -0.083100, 0.026495, 0.068918},
+    {-0.783811, -0.765491, 0.131409, -0.810500, 0.582600, -0.061200, 0.053748, 0.056327},
+    {-0.617731, -0.583588, -0.100539, -0.634400, 0.693300, -0.341900, 0.053027, 0.049019},
+    {-0.423877, -0.615053, -0.283993, -0.211400, 0.586400, -0.781900, 0.053027, 0.042386},
+    {0.763241, -0.883499, 0.123206, 0.480600, -0.873000, -0.083100, 0.026495, 0.015853},
+    {0.617732, -0.893993, -0.100539, 0.333700, -0.900700, -0.278100, 0.026495, 0.022486},
+    {0.824597, -0.833767, 0.147677, 0.986500, -0.161700, -0.026900, 0.033128, 0.015853},
+    {0.783812, -0.765491, 0.131409, 0.810500, 0.582600, -0.061200, 0.037537, 0.015853},
+    {0.423878, -0.615053, -0.283993, 0.211400, 0.586400, -0.781900, 0.039761, 0.029119},
+    {0.617732, -0.583588, -0.100539, 0.634400, 0.693300, -0.341900, 0.039761, 0.022486},
+    {0.423878, -0.883499, -0.283993, 0.168300, -0.873000, -0.457800, 0.026495, 0.029119},
+    {0.276392, -0.583588, -0.236682, -0.428000, 0.743700, -0.513500, 0.039761, 0.035752},
+    {0.276392, -0.893993, -0.236682, -0.203600, -0.948100, -0.244300, 0.026495, 0.035752},
+    {0.203272, -0.615053, -0.100137, -0.807200, 0.586400, 0.067000, 0.039761, 0.042386},
+    {0.203272, -0.883499, -0.100137, -0.480600, -0.873000, 0.083100, 0.026495, 0.042386},
+    {0.348781, -0.583588, 0.123608, -0.450600, 0.693300, 0.562300, 0.039761, 0.049019},
+    {0.276392, -0.583588, -0.236682, -0.428000, 0.743700, -0.513500, 0.046394, 0.042386},
+    {0.555646, -0.833767, 0.371822, -0.204300, -0.161700, 0.965500, 0.033128, 0.055652},
+    {0.423878, -0.883499, -0.283993, 0.168300, -0.873000, -0.457800, 0.013229, 0.042386},
+    {0.276392, -0.893993, -0.236682, -0.203600, -0.948100, -0.244300, 0.019862, 0.042386},
+    {0.763241, -0.883499, 0.123206, 0.480600, -0.873000, -0.083100, 0.013229, 0.055652},
+    {0.617732, -0.893993, -0.100539, 0.333700, -0.900700, -0.278100, 0.013229, 0.049019},
+    {0.690121, -0.893993, 0.259749, 0.203600, -0.948100, 0.244300, 0.019862, 0.055652},
+    {0.690121, -0.893993, 0.259749, 0.203600, -0.948100, 0.244300, 0.026495, 0.062285},
+    {0.716282, -0.744574, 0.291140, 0.426800, 0.745300, 0.512200, 0.037537, 0.062285},
+    {0.716282, -0.744574, 0.291140, 0.426800, 0.745300, 0.512200, 0.046394, 0.056875},
+    {0.824597, -0.833767, 0.147677, 0.986500, -0.161700, -0.026900, 0.033128, 0.068918},
+    {0.763241, -0.883499, 0.123206, 0.480600, -0.873000, -0.083100, 0.026495, 0.068918},
+    {0.783812, -0.765491, 0.131409, 0.810500, 0.582600, -0.061200, 0.037537, 0.068918},
+    {0.423878, -0.615053, -0.283993, 0.211400, 0.586400, -0.781900, 0.053027, 0.042386},
+    {0.783812, -0.765491, 0.131409, 0.810500, 0.582600, -0.061200, 0.053748, 0.056327},
+    {0.617732, -0.583588, -0.100539, 0.634400, 0.693300, -0.341900, 0.053027, 0.049019},
+    {-0.883301, -0.845923, 0.145245, 0.984600, 0.173500, 0.023200, 0.057804, 0.873754},
+    {-0.438794, -0.579449, -0.329926, 0.228100, -0.589700, 0.774700, 0.072262, 0.902670},
+    {-0.655045, -0.541910, -0.122233, 0.632300, -0.692200, 0.348100, 0.072262, 0.888212},
+    {-0.434714, -0.936706, -0.309520, 0.157900, 0.855000, 0.494000, 0.043345, 0.902670},
+    {-0.638681, -0.947437, -0.117999, 0.359200, 0.883800, 0.299700, 0.043345, 0.888212},
+    {-0.790303, -0.936706, 0.117147, 0.523400, 0.849800, 0.062800, 0.043345, 0.873754},
+    {-0.832943, -0.731266, 0.127589, 0.845300, -0.533100, 0.035400, 0.067415, 0.873754},
+    {-0.161284, -0.849473, -0.374796, -0.618200, 0.259900, 0.741800, 0.057804, 0.917128},
+    {-0.251272, -0.538192, -0.266820, -0.419800, -0.755000, 0.503800, 0.072262, 0.917128},
+    {-0.263990, -0.950782, -0.251559, -0.240500, 0.926700, 0.288600, 0.043345, 0.917128},
+    {-0.084445, -0.850762, -0.121708, -0.963600, 0.264100, -0.042500, 0.057804, 0.931587},
+    {-0.251272, -0.538192, -0.266820, -0.419800, -0.755000, 0.503800, 0.086720, 0.931587},
+    {-0.263990, -0.950782, -0.251559, -0.240500, 0.926700, 0.288600, 0.028887, 0.931587},
+    {-0.531796, -0.936706, 0.332589, -0.156100, 0.849800, -0.503500, 0.043345, 0.960503},
+    {-0.320716, -0.541910, 0.156401, -0.456300, -0.692200, -0.559200, 0.072262, 0.946045},
+    {-0.542672, -0.845923, 0.429128, -0.200300, 0.173500, -0.964300, 0.057804, 0.960503},
+    {-0.438794, -0.579449, -0.329926, 0.228100, -0.589700, 0.774700, 0.101178, 0.931587},
+    {-0.742256, -0.700372, 0.322308, 0.458200, -0.698500, -0.549700, 0.067415, 0.974962},
+    {-0.832943, -0.731266, 0.127589, 0.845300, -0.533100, 0.035400, 0.102750, 0.961976},
+    {-0.655045, -0.541910, -0.122233, 0.632300, -0.692200, 0.348100, 0.101178, 0.946045},
+    {-0.742256, -0.700372, 0.322308, 0.458200, -0.698500, -0.549700, 0.086720, 0.963170},
+    {-0.702520, -0.950782, 0.274628, 0.249200, 0.921100, -0.299000, 0.043345, 0.974962},
+    {-0.702520, -0.950782, 0.274628, 0.249200, 0.921100, -0.299000, 0.028887, 0.960503},
+    {-0.790303, -0.936706, 0.117147, 0.523400, 0.849800, 0.062800, 0.014429, 0.960503},
+    {-0.638681, -0.947437, -0.117999, 0.359200, 0.883800, 0.299700, 0.014429, 0.946045},
+    {-0.434714, -0.936706, -0.309520, 0.157900, 0.855000, 0.494000, 0.014429, 0.931587},
+    {-0.883301, -0.845923, 0.145245, 0.984600, 0.173500, 0.023200, 0.057804, 0.989420},
+    {-0.832943, -0.731266, 0.127589, 0.845300, -0.533100, 0.035400, 0.067415, 0.989420},
+    {-0.790303, -0.936706, 0.117147, 0.523400, 0.849800, 0.062800, 0.043345, 0.989420},
+    {0.790304, -0.936706, 0.117147, -0.523400, 0.849800, 0.062800, 0.033214, 0.908776},
+    {0.883301, -0.845923, 0.145245, -0.984600, 0.173500, 0.023200, 0.043601, 0.908776},
+    {0.638683, -0.947437, -0.117999, -0.359200, 0.883800, 0.299700, 0.033214, 0.919163},
+    {0.438796, -0.579449, -0.329926, -0.228100, -0.589700, 0.774700, 0.053988, 0.929550},
+    {0.434716, -0.936706, -0.309520, -0.157900, 0.855000, 0.494000, 0.033214, 0.929550},
+    {0.832945, -0.731266, 0.127589, -0.845300, -0.533100, 0.035400, 0.050505, 0.908776},
+    {0.655046, -0.541910, -0.122233, -0.632300, -0.692200, 0.348100, 0.053988, 0.919163},
+    {0.161285, -0.849473, -0.374796, 0.618200, 0.259900, 0.741800, 0.043601, 0.939937},
+    {0.251273, -0.538192, -0.266820, 0.419800, -0.755000, 0.503800, 0.053988, 0.939937},
+    {0.263992, -0.950782, -0.251559, 0.240500, 0.926700, 0.288600, 0.033214, 0.939937},
+    {0.251273, -0.538192, -0.266820, 0.419800, -0.755000, 0.503800, 0.064375, 0.950323},
+    {0.084446, -0.850762, -0.121708, 0.963600, 0.264100, -0.042500, 0.043601, 0.950323},
+    {0.438796, -0.579449, -0.329926, -0.228100, -0.589700, 0.774700, 0.074761, 0.950323},
+    {0.320717, -0.541910, 0.156401, 0.456300, -0.692200, -0.559200, 0.053988, 0.960710},
+    {0.263992, -0.950782, -0.251559, 0.240500, 0.926700, 0.288600, 0.022827, 0.950323},
+    {0.531797, -0.936706, 0.332589, 0.156100, 0.849800, -0.503500, 0.033214, 0.971097},
+    {0.542674, -0.845923, 0.429128, 0.200300, 0.173500, -0.964300, 0.043601, 0.971097},
+    {0.832945, -0.731266, 0.127589, -0.845300, -0.533100, 0.035400, 0.075890, 0.972155},
+    {0.742258, -0.700372, 0.322308, -0.458200, -0.698500, -0.549700, 0.064375, 0.973013},
+    {0.742258, -0.700372, 0.322308, -0.458200, -0.698500, -0.549700, 0.050505, 0.981484},
+    {0.655046, -0.541910, -0.122233, -0.632300, -0.692200, 0.348100, 0.074761, 0.960710},
+    {0.702521, -0.950782, 0.274628, -0.249200, 0.921100, -0.299000, 0.033214, 0.981484},
+    {0.702521, -0.950782, 0.274628, -0.249200, 0.921100, -0.299000, 0.022827, 0.971097},
+    {0.434716, -0.936706, -0.309520, -0.157900, 0.855000, 0.494000, 0.012440, 0.950323},
+    {0.638683, -0.947437, -0.117999, -0.359200, 0.883800, 0.299700, 0.012440, 0.960710},
+    {0.790304, -0.936706, 0.117147, -0.523400, 0.849800, 0.062800, 0.012440, 0.971097},
+    {0.883301, -0.845923, 0.145245, -0.984600, 0.173500, 0.023200, 0.043601, 0.991871},
+    {0.790304, -0.936706, 0.117147, -0.523400, 0.849800, 0.062800, 0.033214, 0.991871},
+    {0.832945, -0.731266, 0.127589, -0.845300, -0.533100, 0.035400, 0.050505, 0.991871},
+    {-0.243691, 0.346372, 0.133902, -0.853500, 0.130300, -0.504500, 0.030000, 0.022913},
+    {0.000001, 0.496334, 0.127686, -0.000000, 0.935600, -0.353000, 0.060783, 0.022913},
+    {0.243692, 0.346372, 0.133902, 0.853500, 0.130300, -0.504500, 0.030000, 0.022913},
+    {-0.130370, 0.265927, 0.489209, -0.229800, -0.938200, 0.258900, 0.022569, 0.048389},
+    {0.000001, 0.310883, 0.573716, -0.000000, -0.100500, 0.994900, 0.027346, 0.058473},
+    {0.168863, 0.299834, 0.513638, 0.736200, 0.042700, 0.675400, 0.030000, 0.048389},
+    {0.000001, 0.540575, 0.119456, -0.000000, -0.930100, 0.367300, 0.092207, 0.919810},
+    {-0.202724, 0.298988, 0.543263, 0.734700, -0.023800, -0.678000, 0.051818, 0.953235},
+    {-0.282685, 0.344434, 0.111528, 0.849300, -0.099300, 0.518400, 0.051818, 0.919810},
+    {0.198986, 0.266606, 0.136377, -0.330900, 0.847800, 0.414400, 0.042069, 0.919810},
+    {0.202726, 0.298988, 0.543263, -0.734700, -0.023800, -0.678000, 0.051818, 0.953235},
+    {0.268234, 0.552563, 0.082799, 0.715800, 0.495400, -0.492100, 0.021286, 0.991838},
+    {0.171809, 0.544940, 0.141216, -0.478900, 0.861200, 0.170300, 0.041206, 0.973418},
+    {0.231091, 0.569777, 0.102617, 0.039100, 0.987200, -0.154800, 0.031998, 0.988770},
+    {0.122857, 0.451952, 0.182750, -0.715800, -0.495400, 0.492100, 0.033597, 0.947375},
+    {0.265559, 0.507793, 0.090357, 0.810200, -0.399500, -0.429100, 0.013677, 0.983697},
+    {0.219280, 0.459575, 0.124332, 0.478900, -0.861200, -0.170300, 0.013677, 0.965795},
+    {0.125531, 0.496723, 0.175191, -0.810200, 0.399500, 0.429100, 0.041206, 0.955516},
+    {0.160000, 0.434738, 0.162932, -0.039100, -0.987200, 0.154800, 0.022885, 0.950443},
+    {0.231091, 0.569777, 0.102617, 0.039100, 0.987200, -0.154800, 0.082820, 0.921014},
+    {0.171809, 0.544940, 0.141216, -0.478900, 0.861200, 0.170300, 0.067468, 0.930222},
+    {0.125531, 0.496723, 0.175191, -0.810200, 0.399500, 0.429100, 0.049566, 0.930222},
+    {0.265559, 0.507793, 0.090357, 0.810200, -0.399500, -0.429100, 0.077747, 0.902693},
+    {0.160000, 0.434738, 0.162932, -0.039100, -0.987200, 0.154800, 0.044493, 0.911901},
+    {0.268234, 0.552563, 0.082799, 0.715800, 0.495400, -0.492100, 0.085888, 0.910302},
+    {0.122857, 0.451952, 0.182750, -0.715800, -0.495400, 0.492100, 0.041425, 0.922613},
+    {0.219280, 0.459575, 0.124332, 0.478900, -0.861200, -0.170300, 0.059845, 0.902693},
+    {-0.122855, 0.451952, 0.182750, 0.715800, -0.495400, 0.492100, 0.049034, 0.947375},
+    {-0.125530, 0.496723, 0.175191, 0.810200, 0.399500, 0.429100, 0.059746, 0.950443},
+    {-0.171808, 0.544940, 0.141216, 0.478900, 0.861200, 0.170300, 0.068954, 0.965795},
+    {-0.159998, 0.434738, 0.162932, 0.039100, -0.987200, 0.154800, 0.041425, 0.955516},
+    {-0.231089, 0.569777, 0.102617, -0.039100, 0.987200, -0.154800, 0.068954, 0.983697},
+    {-0.268232, 0.552563, 0.082800, -0.715800, 0.495400, -0.492100, 0.061345, 0.991838},
+    {-0.219280, 0.459575, 0.124332, -0.478900, -0.861200, -0.170300, 0.041425, 0.973418},
+    {-0.265558, 0.507793, 0.090357, -0.810200, -0.399500, -0.429100, 0.050633, 0.988770},
+    {-0.125530, 0.496723, 0.175191, 0.810200, 0.399500, 0.429100, 0.022885, 0.905761},
+    {-0.122855, 0.451952, 0.182750, 0.715800, -0.495400, 0.492100, 0.033597, 0.902693},
+    {-0.231089, 0.569777, 0.102617, -0.039100, 0.987200, -0.154800, 0.013677, 0.939015},
+    {-0.171808, 0.544940, 0.141216, 0.478900, 0.861200, 0.170300, 0.013677, 0.921113},
+    {-0.219280, 0.459575, 0.124332, -0.478900, -0.861200, -0.170300, 0.041206, 0.928736},
+    {-0.159998, 0.434738, 0.162932, 0.039100, -0.987200, 0.154800, 0.041206, 0.910834},
+    {-0.265558, 0.507793, 0.090357, -0.810200, -0.399500, -0.429100, 0.031998, 0.944088},
+    {-0.268232, 0.552563, 0.082800, -0.715800, 0.495400, -0.492100, 0.021286, 0.947156},
+    {0.000001, -0.790496, -0.374140, -0.000000, -0.947900, -0.318600, 0.104567, 0.291799},
+    {-0.181415, -0.784429, -0.005086, 0.101700, -0.994800, -0.000000, 0.045210, 0.392834},
+    {-0.193304, -0.570808, -0.511405, -0.342600, -0.251700, -0.905100, 0.235716, 0.372905},
+    {0.339575, -0.802283, 0.011226, 0.210300, -0.977600, -0.013000, 0.058820, 0.101351},
+    {0.181417, -0.784429, -0.005086, -0.101700, -0.994800, -0.000000, 0.031594, 0.200115},
+    {0.358874, -0.578813, -0.404284, 0.679000, -0.266800, -0.684000, 0.213843, 0.116300},
+    {0.000001, -0.759469, -0.014259, -0.000000, -0.999900, 0.013000, 0.004367, 0.298879},
+    {-0.520150, -0.621311, 0.012464, -0.955600, -0.292000, -0.040100, 0.200515, 0.568731},
+    {-0.483041, -0.437992, -0.241275, -0.922300, -0.004200, -0.386500, 0.306364, 0.506857},
+    {-0.339574, -0.802283, 0.011226, -0.210300, -0.977600, -0.013000, 0.086053, 0.486788},
+    {-0.454601, -0.745843, 0.019679, -0.705100, -0.708900, -0.015500, 0.143284, 0.527760},
+    {-0.183424, -0.235276, -0.513898, -0.343800, 0.132800, -0.929600, 0.391478, 0.357281},
+    {0.000001, 0.408368, -0.433834, -0.000000, 0.220400, -0.975400, 0.683794, 0.250874},
+    {0.520151, -0.621311, 0.012464, 0.955600, -0.292000, -0.040100, 0.160623, 0.004128},
+    {0.483043, -0.437992, -0.241275, 0.922300, -0.004200, -0.386500, 0.274120, 0.050504},
+    {0.454603, -0.745843, 0.019679, 0.705100, -0.708900, -0.015500, 0.109722, 0.052739},
+    {0.534974, -0.452152, -0.014140, 0.997900, 0.024400, -0.059200, 0.258456, 0.004127},
+    {0.504716, -0.257458, -0.054706, 0.974300, 0.217100, -0.059500, 0.356289, 0.004127},
+    {0.222359, 0.599408, -0.305107, 0.638200, 0.281200, -0.716700, 0.758302, 0.141655},
+    {0.348031, 0.373915, -0.130422, 0.988600, 0.143000, -0.047000, 0.660024, 0.071777},
+    {0.321938, 0.568757, -0.106233, 0.979000, 0.203500, -0.009100, 0.763004, 0.069658},
+    {0.380816, 0.159715, -0.129771, 0.974800, 0.216000, -0.056700, 0.557045, 0.073896},
+    {0.442040, -0.052336, -0.099382, 0.957300, 0.283400, -0.057300, 0.456667, 0.039012},
+    {0.274556, 0.722423, -0.068044, 0.910600, 0.406300, 0.076100, 0.828514, 0.099228},
+    {0.201691, 0.828541, -0.030127, 0.709000, 0.677900, 0.194500, 0.894025, 0.128798},
+    {0.000001, 0.775991, -0.296841, -0.000000, 0.571300, -0.820700, 0.831241, 0.240456},
+    {-0.106777, 0.886574, -0.005250, -0.363000, 0.885600, 0.289600, 0.923458, 0.287552},
+    {0.106778, 0.886576, -0.005250, 0.363000, 0.885600, 0.289600, 0.915920, 0.180862},
+    {-0.198167, 0.753506, -0.244366, -0.611200, 0.480600, -0.628800, 0.829115, 0.333252},
+    {0.000001, 0.903854, 0.003258, -0.000000, 0.947500, 0.319700, 0.937815, 0.232927},
+    {-0.201689, 0.828541, -0.030127, -0.709000, 0.677900, 0.194500, 0.909101, 0.342178},
+    {-0.274555, 0.722423, -0.068044, -0.910600, 0.406300, 0.076100, 0.848399, 0.380665},
+    {-0.321937, 0.568757, -0.106233, -0.979000, 0.203500, -0.009100, 0.787697, 0.419153},
+    {-0.348029, 0.373915, -0.130422, -0.988600, 0.143000, -0.047000, 0.685443, 0.431535},
+    {-0.380815, 0.159715, -0.129771, -0.974800, 0.216000, -0.056700, 0.583189, 0.443916},
+    {-0.442039, -0.052336, -0.099382, -0.957300, 0.283400, -0.057300, 0.488713, 0.492568},
+    {-0.504715, -0.257458, -0.054706, -0.974300, 0.217100, -0.059500, 0.394237, 0.541219},
+    {-0.534973, -0.452152, -0.014140, -0.997900, 0.024400, -0.059200, 0.297376, 0.554975},
+    {-0.185053, -0.714073, 0.443702, -0.190000, -0.665600, 0.721700, 0.822179, 0.622190},
+    {0.339575, -0.802283, 0.011226, 0.210300, -0.977600, -0.013000, 0.930059, 0.894764},
+    {0.454603, -0.745843, 0.019679, 0.705100, -0.708900, -0.015500, 0.879158, 0.943376},
+    {0.000001, -0.759469, -0.014259, -0.000000, -0.999900, 0.013000, 0.984513, 0.697236},
+    {-0.454601, -0.745843, 0.019679, -0.705100, -0.708900, -0.015500, 0.845596, 0.468355},
+    {-0.339574, -0.802283, 0.011226, -0.210300, -0.977600, -0.013000, 0.902827, 0.509326},
+    {0.216166, -0.600098, 0.496433, 0.263300, -0.234000, 0.935900, 0.780248, 0.812728},
+    {-0.227230, -0.448480, 0.494324, -0.282700, 0.169200, 0.944200, 0.695143, 0.611448},
+    {-0.504715, -0.257458, -0.054706, -0.974300, 0.217100, -0.059500, 0.594643, 0.454895},
+    {0.181417, -0.784429, -0.005086, -0.101700, -0.994800, -0.000000, 0.957286, 0.796000},
+    {-0.181415, -0.784429, -0.005086, 0.101700, -0.994800, -0.000000, 0.943670, 0.603281},
+    {0.000001, 0.134398, 0.245123, -0.000000, 0.352700, 0.935700, 0.431463, 0.736311},
+    {0.410197, -0.450740, 0.399776, 0.688600, 0.152400, 0.709000, 0.717145, 0.907898},
+    {-0.282919, 0.131836, 0.111509, -0.675600, 0.336000, 0.656200, 0.423355, 0.604616},
+    {0.520151, -0.621311, 0.012464, 0.955600, -0.292000, -0.040100, 0.828257, 0.991987},
+    {0.504716, -0.257458, -0.054706, 0.974300, 0.217100, -0.059500, 0.632591, 0.991987},
+    {0.282920, 0.131836, 0.111509, 0.675600, 0.336000, 0.656200, 0.441953, 0.867838},
+    {-0.207907, 0.667844, 0.101724, -0.664600, 0.168100, 0.728100, 0.176475, 0.657128},
+    {0.207908, 0.667844, 0.101724, 0.664600, 0.168100, 0.728100, 0.190142, 0.850561},
+    {-0.442039, -0.052336, -0.099382, -0.957300, 0.283400, -0.057300, 0.500167, 0.503547},
+    {-0.520150, -0.621311, 0.012464, -0.955600, -0.292000, -0.040100, 0.788365, 0.427384},
+    {-0.534973, -0.452152, -0.014140, -0.997900, 0.024400, -0.059200, 0.691504, 0.441139},
+    {-0.380815, 0.159715, -0.129771, -0.974800, 0.216000, -0.056700, 0.405691, 0.552198},
+    {-0.274555, 0.722423, -0.068044, -0.910600, 0.406300, 0.076100, 0.140481, 0.615449},
+    {-0.348029, 0.373915, -0.130422, -0.988600, 0.143000, -0.047000, 0.303437, 0.564580},
+    {-0.321937, 0.568757, -0.106233, -0.979000, 0.203500, -0.009100, 0.201183, 0.576962},
+    {-0.201689, 0.828541, -0.030127, -0.709000, 0.677900, 0.194500, 0.079778, 0.653937},
+    {-0.106777, 0.886574, -0.005250, -0.363000, 0.885600, 0.289600, 0.065422, 0.708562},
+    {0.000001, 0.903854, 0.003258, -0.000000, 0.947500, 0.319700, 0.051065, 0.763188},
+    {0.106778, 0.886576, -0.005250, 0.363000, 0.885600, 0.289600, 0.072960, 0.815252},
+    {0.201691, 0.828541, -0.030127, 0.709000, 0.677900, 0.194500, 0.094854, 0.867316},
+    {0.274556, 0.722423, -0.068044, 0.910600, 0.406300, 0.076100, 0.160365, 0.896887},
+    {0.321938, 0.568757, -0.106233, 0.979000, 0.203500, -0.009100, 0.225876, 0.926457},
+    {0.348031, 0.373915, -0.130422, 0.988600, 0.143000, -0.047000, 0.328855, 0.924338},
+    {0.380816, 0.159715, -0.129771, 0.974800, 0.216000, -0.056700, 0.431835, 0.922219},
+    {0.442040, -0.052336, -0.099382, 0.957300, 0.283400, -0.057300, 0.532213, 0.957103},
+    {0.534974, -0.452152, -0.014140, 0.997900, 0.024400, -0.059200, 0.730424, 0.991987},
+    {0.000001, 0.421582, -0.492361, -0.000000, -0.220900, 0.975300, 0.084085, 0.911206},
+    {-0.234778, 0.782992, -0.281652, 0.611400, -0.482200, 0.627400, 0.098707, 0.919494},
+    {-0.260867, 0.616687, -0.347751, 0.638800, -0.282600, 0.715600, 0.093053, 0.921032},
+    {0.204226, -0.227473, -0.569634, -0.345400, -0.131900, 0.929100, 0.053460, 0.904741},
+    {-0.214075, -0.585938, -0.565624, 0.343700, 0.254700, 0.903900, 0.039001, 0.923484},
+    {-0.383051, -0.230746, -0.461923, 0.678800, -0.156100, 0.717600, 0.054981, 0.929355},
+    {0.260869, 0.616687, -0.347751, -0.638800, -0.282600, 0.715600, 0.091582, 0.900216},
+    {0.128573, 0.939713, 0.012110, -0.364100, -0.886000, -0.287200, 0.107441, 0.904161},
+    {-0.329260, 0.746698, -0.063783, 0.909500, -0.408600, -0.076900, 0.100648, 0.924265},
+    {-0.244301, 0.869197, -0.018670, 0.707500, -0.679800, -0.193400, 0.106755, 0.920392},
+    {-0.407351, 0.382442, -0.133257, 0.988500, -0.143600, 0.047500, 0.084251, 0.929383},
+    {-0.380648, 0.581113, -0.106782, 0.978800, -0.204400, 0.008700, 0.094540, 0.928137},
+    {-0.439277, 0.172726, -0.133350, 0.974700, -0.216200, 0.056700, 0.073963, 0.930629},
+    {-0.499429, -0.035209, -0.103003, 0.957500, -0.283100, 0.056100, 0.064457, 0.935524},
+    {-0.563135, -0.244294, -0.058431, 0.974600, -0.216100, 0.058100, 0.054951, 0.940419},
+    {-0.594848, -0.450686, -0.017715, 0.998100, -0.022200, 0.057600, 0.045205, 0.941803},
+    {-0.577484, -0.638801, 0.009849, 0.954200, 0.296800, 0.038800, 0.035459, 0.943188},
+    {-0.497170, -0.788113, 0.018603, 0.705100, 0.709000, 0.015700, 0.029701, 0.939065},
+    {-0.353326, -0.860686, 0.011348, 0.222900, 0.974800, 0.012700, 0.023943, 0.934943},
+    {0.000001, -0.846874, -0.394675, -0.000000, 0.944700, 0.327900, 0.025805, 0.915324},
+    {-0.176548, -0.844220, -0.003897, -0.092200, 0.995700, 0.001200, 0.019833, 0.925489},
+    {0.353327, -0.860686, 0.011348, -0.222900, 0.974800, 0.012700, 0.021202, 0.896161},
+    {0.538334, -0.438140, -0.264574, -0.921900, 0.006000, 0.387400, 0.042865, 0.891045},
+    {0.000001, -0.819448, -0.012634, -0.000000, 0.999900, -0.011600, 0.015724, 0.916036},
+    {0.176549, -0.844220, -0.003897, 0.092200, 0.995700, 0.001200, 0.018463, 0.906098},
+    {0.497171, -0.788113, 0.018603, -0.705100, 0.709000, 0.015700, 0.026324, 0.891270},
+    {0.577486, -0.638801, 0.009849, -0.954200, 0.296800, 0.038800, 0.031446, 0.886379},
+    {0.594850, -0.450686, -0.017715, -0.998100, -0.022200, 0.057600, 0.041289, 0.886379},
+    {0.563137, -0.244294, -0.058431, -0.974600, -0.216100, 0.058100, 0.051133, 0.886379},
+    {0.499430, -0.035209, -0.103003, -0.957500, -0.283100, 0.056100, 0.061233, 0.889889},
+    {0.439279, 0.172726, -0.133350, -0.974700, -0.216200, 0.056700, 0.071332, 0.893399},
+    {0.407353, 0.382442, -0.133257, -0.988500, -0.143600, 0.047500, 0.081694, 0.893185},
+    {0.380650, 0.581113, -0.106782, -0.978800, -0.204400, 0.008700, 0.092055, 0.892972},
+    {0.329261, 0.746698, -0.063783, -0.909500, -0.408600, -0.076900, 0.098647, 0.895948},
+    {0.244303, 0.869197, -0.018670, -0.707500, -0.679800, -0.193400, 0.105238, 0.898923},
+    {0.000001, 0.960676, 0.022527, -0.000000, -0.948100, -0.317800, 0.109644, 0.909400},
+    {-0.128572, 0.939713, 0.012110, 0.364100, -0.886000, -0.287200, 0.108200, 0.914896},
+    {0.176549, -0.844220, -0.003897, 0.092200, 0.995700, 0.001200, 0.111603, 0.966055},
+    {-0.196451, -0.754103, 0.486917, 0.193100, 0.662600, -0.723700, 0.098009, 0.948566},
+    {0.353327, -0.860686, 0.011348, -0.222900, 0.974800, 0.012700, 0.108864, 0.975992},
+    {0.000001, -0.819448, -0.012634, -0.000000, 0.999900, -0.011600, 0.114343, 0.956117},
+    {0.497171, -0.788113, 0.018603, -0.705100, 0.709000, 0.015700, 0.103742, 0.980883},
+    {0.577486, -0.638801, 0.009849, -0.954200, 0.296800, 0.038800, 0.098621, 0.985774},
+    {0.594850, -0.450686, -0.017715, -0.998100, -0.022200, 0.057600, 0.088777, 0.985774},
+    {0.323273, 0.151816, 0.151164, -0.678000, -0.335800, -0.653800, 0.059752, 0.973283},
+    {0.244616, -0.438406, 0.550859, -0.291200, -0.161600, -0.942900, 0.086730, 0.968757},
+    {0.563137, -0.244294, -0.058431, -0.974600, -0.216100, 0.058100, 0.078934, 0.985774},
+    {0.499430, -0.035209, -0.103003, -0.957500, -0.283100, 0.056100, 0.068834, 0.982264},
+    {0.380650, 0.581113, -0.106782, -0.978800, -0.204400, 0.008700, 0.038011, 0.979181},
+    {0.000001, 0.155497, 0.301292, -0.000000, -0.352000, -0.936000, 0.058697, 0.960049},
+    {0.122609, 0.793451, 0.183128, -0.298900, -0.432500, -0.850700, 0.029394, 0.966997},
+    {-0.244615, -0.438406, 0.550859, 0.291200, -0.161600, -0.942900, 0.085227, 0.947486},
+    {-0.430906, -0.615445, 0.454881, 0.646100, 0.259500, -0.717800, 0.091786, 0.939266},
+    {-0.247493, 0.678671, 0.145493, 0.665600, -0.170900, -0.726500, 0.033041, 0.952082},
+    {0.000001, 0.960676, 0.022527, -0.000000, -0.948100, -0.317800, 0.020422, 0.962753},
+    {-0.499429, -0.035209, -0.103003, 0.957500, -0.283100, 0.056100, 0.065609, 0.936629},
+    {0.128573, 0.939713, 0.012110, -0.364100, -0.886000, -0.287200, 0.022625, 0.967992},
+    {0.244303, 0.869197, -0.018670, -0.707500, -0.679800, -0.193400, 0.024828, 0.973230},
+    {0.439279, 0.172726, -0.133350, -0.974700, -0.216200, 0.056700, 0.058734, 0.978754},
+    {0.407353, 0.382442, -0.133257, -0.988500, -0.143600, 0.047500, 0.048373, 0.978968},
+    {0.329261, 0.746698, -0.063783, -0.909500, -0.408600, -0.076900, 0.031420, 0.976206},
+    {-0.128572, 0.939713, 0.012110, 0.364100, -0.886000, -0.287200, 0.021867, 0.957257},
+    {-0.244301, 0.869197, -0.018670, 0.707500, -0.679800, -0.193400, 0.023311, 0.951761},
+    {-0.329260, 0.746698, -0.063783, 0.909500, -0.408600, -0.076900, 0.029419, 0.947888},
+    {-0.380648, 0.581113, -0.106782, 0.978800, -0.204400, 0.008700, 0.035527, 0.944016},
+    {-0.407351, 0.382442, -0.133257, 0.988500, -0.143600, 0.047500, 0.045815, 0.942770},
+    {-0.439277, 0.172726, -0.133350, 0.974700, -0.216200, 0.056700, 0.056104, 0.941524},
+    {-0.563135, -0.244294, -0.058431, 0.974600, -0.216100, 0.058100, 0.075115, 0.931734},
+    {-0.577484, -0.638801, 0.009849, 0.954200, 0.296800, 0.038800, 0.094607, 0.928966},
+    {-0.594848, -0.450686, -0.017715, 0.998100, -0.022200, 0.057600, 0.084861, 0.930350},
+    {-0.497170, -0.788113, 0.018603, 0.705100, 0.709000, 0.015700, 0.100365, 0.933088},
+    {-0.353326, -0.860686, 0.011348, 0.222900, 0.974800, 0.012700, 0.106124, 0.937210},
+    {-0.176548, -0.844220, -0.003897, -0.092200, 0.995700, 0.001200, 0.110233, 0.946664},
+    {-0.783811, -0.765491, 0.131409, -0.810500, 0.582600, -0.061200, 0.037537, 0.015853},
+    {-0.617731, -0.893993, -0.100539, -0.333700, -0.900700, -0.278100, 0.026495, 0.022486},
+    {-0.824596, -0.833767, 0.147677, -0.986500, -0.161700, -0.026900, 0.033128, 0.015853},
+    {-0.617731, -0.583588, -0.100539, -0.634400, 0.693300, -0.341900, 0.039761, 0.022486},
+    {-0.423877, -0.615053, -0.283993, -0.211400, 0.586400, -0.781900, 0.039761, 0.029119},
+    {-0.423877, -0.883499, -0.283993, -0.168300, -0.873000, -0.457800, 0.026495, 0.029119},
+    {-0.763241, -0.883499, 0.123206, -0.480600, -0.873000, -0.083100, 0.026495, 0.015853},
+    {-0.276391, -0.583588, -0.236682, 0.428000, 0.743700, -0.513500, 0.039761, 0.035752},
+    {-0.276391, -0.893993, -0.236682, 0.203600, -0.948100, -0.244300, 0.026495, 0.035752},
+    {-0.276391, -0.583588, -0.236682, 0.428000, 0.743700, -0.513500, 0.046394, 0.042386},
+    {-0.716281, -0.744574, 0.291140, -0.426800, 0.745300, 0.512200, 0.046394, 0.056875},
+    {-0.276391, -0.893993, -0.236682, 0.203600, -0.948100, -0.244300, 0.019862, 0.042386},
+    {-0.783811, -0.765491, 0.131409, -0.810500, 0.582600, -0.061200, 0.053748, 0.056327},
+    {-0.423877, -0.615053, -0.283993, -0.211400, 0.586400, -0.781900, 0.053027, 0.042386},
+    {-0.617731, -0.583588, -0.100539, -0.634400, 0.693300, -0.341900, 0.053027, 0.049019},
+    {-0.690121, -0.893993, 0.259749, -0.203600, -0.948100, 0.244300, 0.019862, 0.055652},
+    {-0.423877, -0.883499, -0.283993, -0.168300, -0.873000, -0.457800, 0.013229, 0.042386},
+    {-0.617731, -0.893993, -0.100539, -0.333700, -0.900700, -0.278100, 0.013229, 0.049019},
+    {-0.763241, -0.883499, 0.123206, -0.480600, -0.873000, -0.083100, 0.013229, 0.055652},
+    {-0.716281, -0.744574, 0.291140, -0.426800, 0.745300, 0.512200, 0.037537, 0.062285},
+    {-0.824596, -0.833767, 0.147677, -0.986500, -0.161700, -0.026900, 0.033128, 0.068918},
+    {-0.690121, -0.893993, 0.259749, -0.203600, -0.948100, 0.244300, 0.026495, 0.062285},
+    {-0.783811, -0.765491, 0.131409, -0.810500, 0.582600, -0.061200, 0.037537, 0.068918},
+    {-0.763241, -0.883499, 0.123206, -0.480600, -0.873000, -0.083100, 0.026495, 0.068918},
+    {0.763241, -0.883499, 0.123206, 0.480600, -0.873000, -0.083100, 0.026495, 0.015853},
+    {0.617732, -0.893993, -0.100539, 0.333700, -0.900700, -0.278100, 0.026495, 0.022486},
+    {0.824597, -0.833767, 0.147677, 0.986500, -0.161700, -0.026900, 0.033128, 0.015853},
+    {0.783812, -0.765491, 0.131409, 0.810500, 0.582600, -0.061200, 0.037537, 0.015853},
+    {0.423878, -0.615053, -0.283993, 0.211400, 0.586400, -0.781900, 0.039761, 0.029119},
+    {0.617732, -0.583588, -0.100539, 0.634400, 0.693300, -0.341900, 0.039761, 0.022486},
+    {0.423878, -0.883499, -0.283993, 0.168300, -0.873000, -0.457800, 0.026495, 0.029119},
+    {0.276392, -0.583588, -0.236682, -0.428000, 0.743700, -0.513500, 0.039761, 0.035752},
+    {0.716282, -0.744574, 0.291140, 0.426800, 0.745300, 0.512200, 0.046394, 0.056875},
+    {0.276392, -0.583588, -0.236682, -0.428000, 0.743700, -0.513500, 0.046394, 0.042386},
+    {0.423878, -0.883499, -0.283993, 0.168300, -0.873000, -0.457800, 0.013229, 0.042386},
+    {0.690121, -0.893993, 0.259749, 0.203600, -0.948100, 0.244300, 0.019862, 0.055652},
+    {0.783812, -0.765491, 0.131409, 0.810500, 0.582600, -0.061200, 0.053748, 0.056327},
+    {0.617732, -0.583588, -0.100539, 0.634400, 0.693300, -0.341900, 0.053027, 0.049019},
+    {0.423878, -0.615053, -0.283993, 0.211400, 0.586400, -0.781900, 0.053027, 0.042386},
+    {0.763241, -0.883499, 0.123206, 0.480600, -0.873000, -0.083100, 0.013229, 0.055652},
+    {0.617732, -0.893993, -0.100539, 0.333700, -0.900700, -0.278100, 0.013229, 0.049019},
+    {0.824597, -0.833767, 0.147677, 0.986500, -0.161700, -0.026900, 0.033128, 0.068918},
+    {0.716282, -0.744574, 0.291140, 0.426800, 0.745300, 0.512200, 0.037537, 0.062285},
+    {0.690121, -0.893993, 0.259749, 0.203600, -0.948100, 0.244300, 0.026495, 0.062285},
+    {0.783812, -0.765491, 0.131409, 0.810500, 0.582600, -0.061200, 0.037537, 0.068918},
+    {0.763241, -0.883499, 0.123206, 0.480600, -0.873000, -0.083100, 0.026495, 0.068918},
+    {-0.883301, -0.845923, 0.145245, 0.984600, 0.173500, 0.023200, 0.057804, 0.873754},
+    {-0.438794, -0.579449, -0.329926, 0.228100, -0.589700, 0.774700, 0.072262, 0.902670},
+    {-0.655045, -0.541910, -0.122233, 0.632300, -0.692200, 0.348100, 0.072262, 0.888212},
+    {-0.434714, -0.936706, -0.309520, 0.157900, 0.855000, 0.494000, 0.043345, 0.902670},
+    {-0.638681, -0.947437, -0.117999, 0.359200, 0.883800, 0.299700, 0.043345, 0.888212},
+    {-0.790303, -0.936706, 0.117147, 0.523400, 0.849800, 0.062800, 0.043345, 0.873754},
+    {-0.832943, -0.731266, 0.127589, 0.845300, -0.533100, 0.035400, 0.067415, 0.873754},
+    {-0.263990, -0.950782, -0.251559, -0.240500, 0.926700, 0.288600, 0.043345, 0.917128},
+    {-0.251272, -0.538192, -0.266820, -0.419800, -0.755000, 0.503800, 0.072262, 0.917128},
+    {-0.320716, -0.541910, 0.156401, -0.456300, -0.692200, -0.559200, 0.072262, 0.946045},
+    {-0.251272, -0.538192, -0.266820, -0.419800, -0.755000, 0.503800, 0.086720, 0.931587},
+    {-0.702520, -0.950782, 0.274628, 0.249200, 0.921100, -0.299000, 0.028887, 0.960503},
+    {-0.742256, -0.700372, 0.322308, 0.458200, -0.698500, -0.549700, 0.067415, 0.974962},
+    {-0.438794, -0.579449, -0.329926, 0.228100, -0.589700, 0.774700, 0.101178, 0.931587},
+    {-0.832943, -0.731266, 0.127589, 0.845300, -0.533100, 0.035400, 0.102750, 0.961976},
+    {-0.655045, -0.541910, -0.122233, 0.632300, -0.692200, 0.348100, 0.101178, 0.946045},
+    {-0.263990, -0.950782, -0.251559, -0.240500, 0.926700, 0.288600, 0.028887, 0.931587},
+    {-0.742256, -0.700372, 0.322308, 0.458200, -0.698500, -0.549700, 0.086720, 0.963170},
+    {-0.790303, -0.936706, 0.117147, 0.523400, 0.849800, 0.062800, 0.014429, 0.960503},
+    {-0.638681, -0.947437, -0.117999, 0.359200, 0.883800, 0.299700, 0.014429, 0.946045},
+    {-0.434714, -0.936706, -0.309520, 0.157900, 0.855000, 0.494000, 0.014429, 0.931587},
+    {-0.883301, -0.845923, 0.145245, 0.984600, 0.173500, 0.023200, 0.057804, 0.989420},
+    {-0.702520, -0.950782, 0.274628, 0.249200, 0.921100, -0.299000, 0.043345, 0.974962},
+    {-0.832943, -0.731266, 0.127589, 0.845300, -0.533100, 0.035400, 0.067415, 0.989420},
+    {-0.790303, -0.936706, 0.117147, 0.523400, 0.849800, 0.062800, 0.043345, 0.989420},
+    {0.790304, -0.936706, 0.117147, -0.523400, 0.849800, 0.062800, 0.033214, 0.908776},
+    {0.883301, -0.845923, 0.145245, -0.984600, 0.173500, 0.023200, 0.043601, 0.908776},
+    {0.638683, -0.947437, -0.117999, -0.359200, 0.883800, 0.299700, 0.033214, 0.919163},
+    {0.438796, -0.579449, -0.329926, -0.228100, -0.589700, 0.774700, 0.053988, 0.929550},
+    {0.434716, -0.936706, -0.309520, -0.157900, 0.855000, 0.494000, 0.033214, 0.929550},
+    {0.832945, -0.731266, 0.127589, -0.845300, -0.533100, 0.035400, 0.050505, 0.908776},
+    {0.655046, -0.541910, -0.122233, -0.632300, -0.692200, 0.348100, 0.053988, 0.919163},
+    {0.263992, -0.950782, -0.251559, 0.240500, 0.926700, 0.288600, 0.033214, 0.939937},
+    {0.251273, -0.538192, -0.266820, 0.419800, -0.755000, 0.503800, 0.053988, 0.939937},
+    {0.251273, -0.538192, -0.266820, 0.419800, -0.755000, 0.503800, 0.064375, 0.950323},
+    {0.320717, -0.541910, 0.156401, 0.456300, -0.692200, -0.559200, 0.053988, 0.960710},
+    {0.438796, -0.579449, -0.329926, -0.228100, -0.589700, 0.774700, 0.074761, 0.950323},
+    {0.263992, -0.950782, -0.251559, 0.240500, 0.926700, 0.288600, 0.022827, 0.950323},
+    {0.702521, -0.950782, 0.274628, -0.249200, 0.921100, -0.299000, 0.022827, 0.971097},
+    {0.832945, -0.731266, 0.127589, -0.845300, -0.533100, 0.035400, 0.075890, 0.972155},
+    {0.742258, -0.700372, 0.322308, -0.458200, -0.698500, -0.549700, 0.064375, 0.973013},
+    {0.742258, -0.700372, 0.322308, -0.458200, -0.698500, -0.549700, 0.050505, 0.981484},
+    {0.655046, -0.541910, -0.122233, -0.632300, -0.692200, 0.348100, 0.074761, 0.960710},
+    {0.434716, -0.936706, -0.309520, -0.157900, 0.855000, 0.494000, 0.012440, 0.950323},
+    {0.638683, -0.947437, -0.117999, -0.359200, 0.883800, 0.299700, 0.012440, 0.960710},
+    {0.790304, -0.936706, 0.117147, -0.523400, 0.849800, 0.062800, 0.012440, 0.971097},
+    {0.883301, -0.845923, 0.145245, -0.984600, 0.173500, 0.023200, 0.043601, 0.991871},
+    {0.702521, -0.950782, 0.274628, -0.249200, 0.921100, -0.299000, 0.033214, 0.981484},
+    {0.832945, -0.731266, 0.127589, -0.845300, -0.533100, 0.035400, 0.050505, 0.991871},
+    {0.790304, -0.936706, 0.117147, -0.523400, 0.849800, 0.062800, 0.033214, 0.991871},
+    {0.268234, 0.552563, 0.082799, 0.715800, 0.495400, -0.492100, 0.021286, 0.991838},
+    {0.171809, 0.544940, 0.141216, -0.478900, 0.861200, 0.170300, 0.041206, 0.973418},
+    {0.231091, 0.569777, 0.102617, 0.039100, 0.987200, -0.154800, 0.031998, 0.988770},
+    {0.122857, 0.451952, 0.182750, -0.715800, -0.495400, 0.492100, 0.033597, 0.947375},
+    {0.265559, 0.507793, 0.090357, 0.810200, -0.399500, -0.429100, 0.013677, 0.983697},
+    {0.219280, 0.459575, 0.124332, 0.478900, -0.861200, -0.170300, 0.013677, 0.965795},
+    {0.125531, 0.496723, 0.175191, -0.810200, 0.399500, 0.429100, 0.041206, 0.955516},
+    {0.160000, 0.434738, 0.162932, -0.039100, -0.987200, 0.154800, 0.022885, 0.950443},
+    {0.231091, 0.569777, 0.102617, 0.039100, 0.987200, -0.154800, 0.082820, 0.921014},
+    {0.171809, 0.544940, 0.141216, -0.478900, 0.861200, 0.170300, 0.067468, 0.930222},
+    {0.125531, 0.496723, 0.175191, -0.810200, 0.399500, 0.429100, 0.049566, 0.930222},
+    {0.265559, 0.507793, 0.090357, 0.810200, -0.399500, -0.429100, 0.077747, 0.902693},
+    {0.160000, 0.434738, 0.162932, -0.039100, -0.987200, 0.154800, 0.044493, 0.911901},
+    {0.268234, 0.552563, 0.082799, 0.715800, 0.495400, -0.492100, 0.085888, 0.910302},
+    {0.122857, 0.451952, 0.182750, -0.715800, -0.495400, 0.492100, 0.041425, 0.922613},
+    {0.219280, 0.459575, 0.124332, 0.478900, -0.861200, -0.170300, 0.059845, 0.902693},
+    {-0.122855, 0.451952, 0.182750, 0.715800, -0.495400, 0.492100, 0.049034, 0.947375},
+    {-0.125530, 0.496723, 0.175191, 0.810200, 0.399500, 0.429100, 0.059746, 0.950443},
+    {-0.171808, 0.544940, 0.141216, 0.478900, 0.861200, 0.170300, 0.068954, 0.965795},
+    {-0.159998, 0.434738, 0.162932, 0.039100, -0.987200, 0.154800, 0.041425, 0.955516},
+    {-0.231089, 0.569777, 0.102617, -0.039100, 0.987200, -0.154800, 0.068954, 0.983697},
+    {-0.268232, 0.552563, 0.082800, -0.715800, 0.495400, -0.492100, 0.061345, 0.991838},
+    {-0.219280, 0.459575, 0.124332, -0.478900, -0.861200, -0.170300, 0.041425, 0.973418},
+    {-0.265558, 0.507793, 0.090357, -0.810200, -0.399500, -0.429100, 0.050633, 0.988770},
+    {-0.125530, 0.496723, 0.175191, 0.810200, 0.399500, 0.429100, 0.022885, 0.905761},
+    {-0.122855, 0.451952, 0.182750, 0.715800, -0.495400, 0.492100, 0.033597, 0.902693},
+    {-0.231089, 0.569777, 0.102617, -0.039100, 0.987200, -0.154800, 0.013677, 0.939015},
+    {-0.171808, 0.544940, 0.141216, 0.478900, 0.861200, 0.170300, 0.013677, 0.921113},
+    {-0.219280, 0.459575, 0.124332, -0.478900, -0.861200, -0.170300, 0.041206, 0.928736},
+    {-0.159998, 0.434738, 0.162932, 0.039100, -0.987200, 0.154800, 0.041206, 0.910834},
+    {-0.265558, 0.507793, 0.090357, -0.810200, -0.399500, -0.429100, 0.031998, 0.944088},
+    {-0.268232, 0.552563, 0.082800, -0.715800, 0.495400, -0.492100, 0.021286, 0.947156},
+    {-0.339574, -0.802283, 0.011226, -0.210300, -0.977600, -0.013000, 0.902827, 0.509326},
+    {0.339575, -0.802283, 0.011226, 0.210300, -0.977600, -0.013000, 0.930059, 0.894764},
+    {0.454603, -0.745843, 0.019679, 0.705100, -0.708900, -0.015500, 0.879158, 0.943376},
+    {0.000001, -0.759469, -0.014259, -0.000000, -0.999900, 0.013000, 0.984513, 0.697236},
+    {-0.181415, -0.784429, -0.005086, 0.101700, -0.994800, -0.000000, 0.943670, 0.603281},
+    {0.321938, 0.568757, -0.106233, 0.979000, 0.203500, -0.009100, 0.225876, 0.926457},
+    {-0.504715, -0.257458, -0.054706, -0.974300, 0.217100, -0.059500, 0.594643, 0.454895},
+    {-0.454601, -0.745843, 0.019679, -0.705100, -0.708900, -0.015500, 0.845596, 0.468355},
+    {0.181417, -0.784429, -0.005086, -0.101700, -0.994800, -0.000000, 0.957286, 0.796000},
+    {-0.520150, -0.621311, 0.012464, -0.955600, -0.292000, -0.040100, 0.788365, 0.427384},
+    {-0.534973, -0.452152, -0.014140, -0.997900, 0.024400, -0.059200, 0.691504, 0.441139},
+    {-0.442039, -0.052336, -0.099382, -0.957300, 0.283400, -0.057300, 0.500167, 0.503547},
+    {-0.201689, 0.828541, -0.030127, -0.709000, 0.677900, 0.194500, 0.079778, 0.653937},
+    {-0.380815, 0.159715, -0.129771, -0.974800, 0.216000, -0.056700, 0.405691, 0.552198},
+    {-0.274555, 0.722423, -0.068044, -0.910600, 0.406300, 0.076100, 0.140481, 0.615449},
+    {0.000001, 0.903854, 0.003258, -0.000000, 0.947500, 0.319700, 0.051065, 0.763188},
+    {-0.106777, 0.886574, -0.005250, -0.363000, 0.885600, 0.289600, 0.065422, 0.708562},
+    {0.106778, 0.886576, -0.005250, 0.363000, 0.885600, 0.289600, 0.072960, 0.815252},
+    {0.201691, 0.828541, -0.030127, 0.709000, 0.677900, 0.194500, 0.094854, 0.867316},
+    {0.274556, 0.722423, -0.068044, 0.910600, 0.406300, 0.076100, 0.160365, 0.896887},
+    {0.380816, 0.159715, -0.129771, 0.974800, 0.216000, -0.056700, 0.431835, 0.922219},
+    {0.348031, 0.373915, -0.130422, 0.988600, 0.143000, -0.047000, 0.328855, 0.924338},
+    {0.520151, -0.621311, 0.012464, 0.955600, -0.292000, -0.040100, 0.828257, 0.991987},
+    {0.504716, -0.257458, -0.054706, 0.974300, 0.217100, -0.059500, 0.632591, 0.991987},
+    {0.442040, -0.052336, -0.099382, 0.957300, 0.283400, -0.057300, 0.532213, 0.957103},
+    {0.534974, -0.452152, -0.014140, 0.997900, 0.024400, -0.059200, 0.730424, 0.991987},
+    {-0.348029, 0.373915, -0.130422, -0.988600, 0.143000, -0.047000, 0.303437, 0.564580},
+    {-0.321937, 0.568757, -0.106233, -0.979000, 0.203500, -0.009100, 0.201183, 0.576962},
+    {-0.181415, -0.784429, -0.005086, 0.101700, -0.994800, -0.000000, 0.045210, 0.392834},
+    {-0.520150, -0.621311, 0.012464, -0.955600, -0.292000, -0.040100, 0.200515, 0.568731},
+    {-0.483041, -0.437992, -0.241275, -0.922300, -0.004200, -0.386500, 0.306364, 0.506857},
+    {-0.339574, -0.802283, 0.011226, -0.210300, -0.977600, -0.013000, 0.086053, 0.486788},
+    {-0.454601, -0.745843, 0.019679, -0.705100, -0.708900, -0.015500, 0.143284, 0.527760},
+    {0.483043, -0.437992, -0.241275, 0.922300, -0.004200, -0.386500, 0.274120, 0.050504},
+    {0.000001, -0.759469, -0.014259, -0.000000, -0.999900, 0.013000, 0.004367, 0.298879},
+    {-0.534973, -0.452152, -0.014140, -0.997900, 0.024400, -0.059200, 0.297376, 0.554975},
+    {-0.504715, -0.257458, -0.054706, -0.974300, 0.217100, -0.059500, 0.394237, 0.541219},
+    {-0.442039, -0.052336, -0.099382, -0.957300, 0.283400, -0.057300, 0.488713, 0.492568},
+    {-0.380815, 0.159715, -0.129771, -0.974800, 0.216000, -0.056700, 0.583189, 0.443916},
+    {-0.348029, 0.373915, -0.130422, -0.988600, 0.143000, -0.047000, 0.685443, 0.431535},
+    {0.274556, 0.722423, -0.068044, 0.910600, 0.406300, 0.076100, 0.828514, 0.099228},
+    {-0.321937, 0.568757, -0.106233, -0.979000, 0.203500, -0.009100, 0.787697, 0.419153},
+    {-0.201689, 0.828541, -0.030127, -0.709000, 0.677900, 0.194500, 0.909101, 0.342178},
+    {-0.106777, 0.886574, -0.005250, -0.363000, 0.885600, 0.289600, 0.923458, 0.287552},
+    {-0.274555, 0.722423, -0.068044, -0.910600, 0.406300, 0.076100, 0.848399, 0.380665},
+    {0.201691, 0.828541, -0.030127, 0.709000, 0.677900, 0.194500, 0.894025, 0.128798},
+    {0.321938, 0.568757, -0.106233, 0.979000, 0.203500, -0.009100, 0.763004, 0.069658},
+    {0.106778, 0.886576, -0.005250, 0.363000, 0.885600, 0.289600, 0.915920, 0.180862},
+    {0.000001, 0.903854, 0.003258, -0.000000, 0.947500, 0.319700, 0.937815, 0.232927},
+    {0.520151, -0.621311, 0.012464, 0.955600, -0.292000, -0.040100, 0.160623, 0.004128},
+    {0.339575, -0.802283, 0.011226, 0.210300, -0.977600, -0.013000, 0.058820, 0.101351},
+    {0.181417, -0.784429, -0.005086, -0.101700, -0.994800, -0.000000, 0.031594, 0.200115},
+    {0.534974, -0.452152, -0.014140, 0.997900, 0.024400, -0.059200, 0.258456, 0.004127},
+    {0.348031, 0.373915, -0.130422, 0.988600, 0.143000, -0.047000, 0.660024, 0.071777},
+    {0.504716, -0.257458, -0.054706, 0.974300, 0.217100, -0.059500, 0.356289, 0.004127},
+    {0.380816, 0.159715, -0.129771, 0.974800, 0.216000, -0.056700, 0.557045, 0.073896},
+    {0.442040, -0.052336, -0.099382, 0.957300, 0.283400, -0.057300, 0.456667, 0.039012},
+    {0.454603, -0.745843, 0.019679, 0.705100, -0.708900, -0.015500, 0.109722, 0.052739},
+    {0.176549, -0.844220, -0.003897, 0.092200, 0.995700, 0.001200, 0.111603, 0.966055},
+    {-0.577484, -0.638801, 0.009849, 0.954200, 0.296800, 0.038800, 0.094607, 0.928966},
+    {0.353327, -0.860686, 0.011348, -0.222900, 0.974800, 0.012700, 0.108864, 0.975992},
+    {0.000001, -0.819448, -0.012634, -0.000000, 0.999900, -0.011600, 0.114343, 0.956117},
+    {0.497171, -0.788113, 0.018603, -0.705100, 0.709000, 0.015700, 0.103742, 0.980883},
+    {0.577486, -0.638801, 0.009849, -0.954200, 0.296800, 0.038800, 0.098621, 0.985774},
+    {0.594850, -0.450686, -0.017715, -0.998100, -0.022200, 0.057600, 0.088777, 0.985774},
+    {0.000001, 0.960676, 0.022527, -0.000000, -0.948100, -0.317800, 0.020422, 0.962753},
+    {0.563137, -0.244294, -0.058431, -0.974600, -0.216100, 0.058100, 0.078934, 0.985774},
+    {0.499430, -0.035209, -0.103003, -0.957500, -0.283100, 0.056100, 0.068834, 0.982264},
+    {0.380650, 0.581113, -0.106782, -0.978800, -0.204400, 0.008700, 0.038011, 0.979181},
+    {0.128573, 0.939713, 0.012110, -0.364100, -0.886000, -0.287200, 0.022625, 0.967992},
+    {0.244303, 0.869197, -0.018670, -0.707500, -0.679800, -0.193400, 0.024828, 0.973230},
+    {-0.499429, -0.035209, -0.103003, 0.957500, -0.283100, 0.056100, 0.065609, 0.936629},
+    {-0.128572, 0.939713, 0.012110, 0.364100, -0.886000, -0.287200, 0.021867, 0.957257},
+    {0.439279, 0.172726, -0.133350, -0.974700, -0.216200, 0.056700, 0.058734, 0.978754},
+    {0.407353, 0.382442, -0.133257, -0.988500, -0.143600, 0.047500, 0.048373, 0.978968},
+    {0.329261, 0.746698, -0.063783, -0.909500, -0.408600, -0.076900, 0.031420, 0.976206},
+    {-0.407351, 0.382442, -0.133257, 0.988500, -0.143600, 0.047500, 0.045815, 0.942770},
+    {-0.380648, 0.581113, -0.106782, 0.978800, -0.204400, 0.008700, 0.035527, 0.944016},
+    {-0.439277, 0.172726, -0.133350, 0.974700, -0.216200, 0.056700, 0.056104, 0.941524},
+    {-0.244301, 0.869197, -0.018670, 0.707500, -0.679800, -0.193400, 0.023311, 0.951761},
+    {-0.329260, 0.746698, -0.063783, 0.909500, -0.408600, -0.076900, 0.029419, 0.947888},
+    {-0.563135, -0.244294, -0.058431, 0.974600, -0.216100, 0.058100, 0.075115, 0.931734},
+    {-0.353326, -0.860686, 0.011348, 0.222900, 0.974800, 0.012700, 0.106124, 0.937210},
+    {-0.497170, -0.788113, 0.018603, 0.705100, 0.709000, 0.015700, 0.100365, 0.933088},
+    {-0.594848, -0.450686, -0.017715, 0.998100, -0.022200, 0.057600, 0.084861, 0.930350},
+    {-0.176548, -0.844220, -0.003897, -0.092200, 0.995700, 0.001200, 0.110233, 0.946664},
+    {-0.497170, -0.788113, 0.018603, 0.705100, 0.709000, 0.015700, 0.029701, 0.939065},
+    {-0.353326, -0.860686, 0.011348, 0.222900, 0.974800, 0.012700, 0.023943, 0.934943},
+    {0.538334, -0.438140, -0.264574, -0.921900, 0.006000, 0.387400, 0.042865, 0.891045},
+    {0.128573, 0.939713, 0.012110, -0.364100, -0.886000, -0.287200, 0.107441, 0.904161},
+    {-0.577484, -0.638801, 0.009849, 0.954200, 0.296800, 0.038800, 0.035459, 0.943188},
+    {-0.176548, -0.844220, -0.003897, -0.092200, 0.995700, 0.001200, 0.019833, 0.925489},
+    {0.000001, -0.819448, -0.012634, -0.000000, 0.999900, -0.011600, 0.015724, 0.916036},
+    {0.176549, -0.844220, -0.003897, 0.092200, 0.995700, 0.001200, 0.018463, 0.906098},
+    {0.353327, -0.860686, 0.011348, -0.222900, 0.974800, 0.012700, 0.021202, 0.896161},
+    {0.497171, -0.788113, 0.018603, -0.705100, 0.709000, 0.015700, 0.026324, 0.891270},
+    {0.577486, -0.638801, 0.009849, -0.954200, 0.296800, 0.038800, 0.031446, 0.886379},
+    {0.594850, -0.450686, -0.017715, -0.998100, -0.022200, 0.057600, 0.041289, 0.886379},
+    {0.563137, -0.244294, -0.058431, -0.974600, -0.216100, 0.058100, 0.051133, 0.886379},
+    {0.499430, -0.035209, -0.103003, -0.957500, -0.283100, 0.056100, 0.061233, 0.889889},
+    {0.439279, 0.172726, -0.133350, -0.974700, -0.216200, 0.056700, 0.071332, 0.893399},
+    {0.407353, 0.382442, -0.133257, -0.988500, -0.143600, 0.047500, 0.081694, 0.893185},
+    {0.380650, 0.581113, -0.106782, -0.978800, -0.204400, 0.008700, 0.092055, 0.892972},
+    {0.329261, 0.746698, -0.063783, -0.909500, -0.408600, -0.076900, 0.098647, 0.895948},
+    {0.244303, 0.869197, -0.018670, -0.707500, -0.679800, -0.193400, 0.105238, 0.898923},
+    {-0.244301, 0.869197, -0.018670, 0.707500, -0.679800, -0.193400, 0.106755, 0.920392},
+    {0.000001, 0.960676, 0.022527, -0.000000, -0.948100, -0.317800, 0.109644, 0.909400},
+    {-0.329260, 0.746698, -0.063783, 0.909500, -0.408600, -0.076900, 0.100648, 0.924265},
+    {-0.594848, -0.450686, -0.017715, 0.998100, -0.022200, 0.057600, 0.045205, 0.941803},
+    {-0.439277, 0.172726, -0.133350, 0.974700, -0.216200, 0.056700, 0.073963, 0.930629},
+    {-0.499429, -0.035209, -0.103003, 0.957500, -0.283100, 0.056100, 0.064457, 0.935524},
+    {-0.563135, -0.244294, -0.058431, 0.974600, -0.216100, 0.058100, 0.054951, 0.940419},
+    {-0.380648, 0.581113, -0.106782, 0.978800, -0.204400, 0.008700, 0.094540, 0.928137},
+    {-0.407351, 0.382442, -0.133257, 0.988500, -0.143600, 0.047500, 0.084251, 0.929383},
+    {-0.128572, 0.939713, 0.012110, 0.364100, -0.886000, -0.287200, 0.108200, 0.914896},
+    {-0.783811, -0.765491, 0.131409, -0.810500, 0.582600, -0.061200, 0.037537, 0.015853},
+    {-0.617731, -0.893993, -0.100539, -0.333700, -0.900700, -0.278100, 0.026495, 0.022486},
+    {-0.824596, -0.833767, 0.147677, -0.986500, -0.161700, -0.026900, 0.033128, 0.015853},
+    {-0.617731, -0.583588, -0.100539, -0.634400, 0.693300, -0.341900, 0.039761, 0.022486},
+    {-0.423877, -0.615053, -0.283993, -0.211400, 0.586400, -0.781900, 0.039761, 0.029119},
+    {-0.423877, -0.883499, -0.283993, -0.168300, -0.873000, -0.457800, 0.026495, 0.029119},
+    {-0.763241, -0.883499, 0.123206, -0.480600, -0.873000, -0.083100, 0.026495, 0.015853},
+    {-0.276391, -0.583588, -0.236682, 0.428000, 0.743700, -0.513500, 0.039761, 0.035752},
+    {-0.276391, -0.893993, -0.236682, 0.203600, -0.948100, -0.244300, 0.026495, 0.035752},
+    {-0.276391, -0.583588, -0.236682, 0.428000, 0.743700, -0.513500, 0.046394, 0.042386},
+    {-0.716281, -0.744574, 0.291140, -0.426800, 0.745300, 0.512200, 0.046394, 0.056875},
+    {-0.276391, -0.893993, -0.236682, 0.203600, -0.948100, -0.244300, 0.019862, 0.042386},
+    {-0.783811, -0.765491, 0.131409, -0.810500, 0.582600, -0.061200, 0.053748, 0.056327},
+    {-0.423877, -0.615053, -0.283993, -0.211400, 0.586400, -0.781900, 0.053027, 0.042386},
+    {-0.617731, -0.583588, -0.100539, -0.634400, 0.693300, -0.341900, 0.053027, 0.049019},
+    {-0.690121, -0.893993, 0.259749, -0.203600, -0.948100, 0.244300, 0.019862, 0.055652},
+    {-0.423877, -0.883499, -0.283993, -0.168300, -0.873000, -0.457800, 0.013229, 0.042386},
+    {-0.617731, -0.893993, -0.100539, -0.333700, -0.900700, -0.278100, 0.013229, 0.049019},
+    {-0.763241, -0.883499, 0.123206, -0.480600, -0.873000, -0.083100, 0.013229, 0.055652},
+    {-0.716281, -0.744574, 0.291140, -0.426800, 0.745300, 0.512200, 0.037537, 0.062285},
+    {-0.824596, -0.833767, 0.147677, -0.986500, -0.161700, -0.026900, 0.033128, 0.068918},
+    {-0.690121, -0.893993, 0.259749, -0.203600, -0.948100, 0.244300, 0.026495, 0.062285},
+    {-0.783811, -0.765491, 0.131409, -0.810500, 0.582600, -0.061200, 0.037537, 0.068918},
+    {-0.763241, -0.883499, 0.123206, -0.480600, -0.873000, -0.083100, 0.026495, 0.068918},
+    {0.763241, -0.883499, 0.123206, 0.480600, -0.873000, -0.083100, 0.026495, 0.015853},
+    {0.617732, -0.893993, -0.100539, 0.333700, -0.900700, -0.278100, 0.026495, 0.022486},
+    {0.824597, -0.833767, 0.147677, 0.986500, -0.161700, -0.026900, 0.033128, 0.015853},
+    {0.783812, -0.765491, 0.131409, 0.810500, 0.582600, -0.061200, 0.037537, 0.015853},
+    {0.423878, -0.615053, -0.283993, 0.211400, 0.586400, -0.781900, 0.039761, 0.029119},
+    {0.617732, -0.583588, -0.100539, 0.634400, 0.693300, -0.341900, 0.039761, 0.022486},
+    {0.423878, -0.883499, -0.283993, 0.168300, -0.873000, -0.457800, 0.026495, 0.029119},
+    {0.276392, -0.583588, -0.236682, -0.428000, 0.743700, -0.513500, 0.039761, 0.035752},
+    {0.716282, -0.744574, 0.291140, 0.426800, 0.745300, 0.512200, 0.046394, 0.056875},
+    {0.276392, -0.583588, -0.236682, -0.428000, 0.743700, -0.513500, 0.046394, 0.042386},
+    {0.423878, -0.883499, -0.283993, 0.168300, -0.873000, -0.457800, 0.013229, 0.042386},
+    {0.690121, -0.893993, 0.259749, 0.203600, -0.948100, 0.244300, 0.019862, 0.055652},
+    {0.783812, -0.765491, 0.131409, 0.810500, 0.582600, -0.061200, 0.053748, 0.056327},
+    {0.617732, -0.583588, -0.100539, 0.634400, 0.693300, -0.341900, 0.053027, 0.049019},
+    {0.423878, -0.615053, -0.283993, 0.211400, 0.586400, -0.781900, 0.053027, 0.042386},
+    {0.763241, -0.883499, 0.123206, 0.480600, -0.873000, -0.083100, 0.013229, 0.055652},
+    {0.617732, -0.893993, -0.100539, 0.333700, -0.900700, -0.278100, 0.013229, 0.049019},
+    {0.824597, -0.833767, 0.147677, 0.986500, -0.161700, -0.026900, 0.033128, 0.068918},
+    {0.716282, -0.744574, 0.291140, 0.426800, 0.745300, 0.512200, 0.037537, 0.062285},
+    {0.690121, -0.893993, 0.259749, 0.203600, -0.948100, 0.244300, 0.026495, 0.062285},
+    {0.783812, -0.765491, 0.131409, 0.810500, 0.582600, -0.061200, 0.037537, 0.068918},
+    {0.763241, -0.883499, 0.123206, 0.480600, -0.873000, -0.083100, 0.026495, 0.068918},
+    {-0.883301, -0.845923, 0.145245, 0.984600, 0.173500, 0.023200, 0.057804, 0.873754},
+    {-0.438794, -0.579449, -0.329926, 0.228100, -0.589700, 0.774700, 0.072262, 0.902670},
+    {-0.655045, -0.541910, -0.122233, 0.632300, -0.692200, 0.348100, 0.072262, 0.888212},
+    {-0.434714, -0.936706, -0.309520, 0.157900, 0.855000, 0.494000, 0.043345, 0.902670},
+    {-0.638681, -0.947437, -0.117999, 0.359200, 0.883800, 0.299700, 0.043345, 0.888212},
+    {-0.790303, -0.936706, 0.117147, 0.523400, 0.849800, 0.062800, 0.043345, 0.873754},
+    {-0.832943, -0.731266, 0.127589, 0.845300, -0.533100, 0.035400, 0.067415, 0.873754},
+    {-0.263990, -0.950782, -0.251559, -0.240500, 0.926700, 0.288600, 0.043345, 0.917128},
+    {-0.251272, -0.538192, -0.266820, -0.419800, -0.755000, 0.503800, 0.072262, 0.917128},
+    {-0.702520, -0.950782, 0.274628, 0.249200, 0.921100, -0.299000, 0.028887, 0.960503},
+    {-0.742256, -0.700372, 0.322308, 0.458200, -0.698500, -0.549700, 0.067415, 0.974962},
+    {-0.251272, -0.538192, -0.266820, -0.419800, -0.755000, 0.503800, 0.086720, 0.931587},
+    {-0.263990, -0.950782, -0.251559, -0.240500, 0.926700, 0.288600, 0.028887, 0.931587},
+    {-0.790303, -0.936706, 0.117147, 0.523400, 0.849800, 0.062800, 0.014429, 0.960503},
+    {-0.883301, -0.845923, 0.145245, 0.984600, 0.173500, 0.023200, 0.057804, 0.989420},
+    {-0.702520, -0.950782, 0.274628, 0.249200, 0.921100, -0.299000, 0.043345, 0.974962},
+    {-0.832943, -0.731266, 0.127589, 0.845300, -0.533100, 0.035400, 0.067415, 0.989420},
+    {-0.790303, -0.936706, 0.117147, 0.523400, 0.849800, 0.062800, 0.043345, 0.989420},
+    {-0.638681, -0.947437, -0.117999, 0.359200, 0.883800, 0.299700, 0.014429, 0.946045},
+    {-0.434714, -0.936706, -0.309520, 0.157900, 0.855000, 0.494000, 0.014429, 0.931587},
+    {-0.832943, -0.731266, 0.127589, 0.845300, -0.533100, 0.035400, 0.102750, 0.961976},
+    {-0.655045, -0.541910, -0.122233, 0.632300, -0.692200, 0.348100, 0.101178, 0.946045},
+    {-0.438794, -0.579449, -0.329926, 0.228100, -0.589700, 0.774700, 0.101178, 0.931587},
+    {-0.742256, -0.700372, 0.322308, 0.458200, -0.698500, -0.549700, 0.086720, 0.963170},
+    {0.790304, -0.936706, 0.117147, -0.523400, 0.849800, 0.062800, 0.033214, 0.908776},
+    {0.883301, -0.845923, 0.145245, -0.984600, 0.173500, 0.023200, 0.043601, 0.908776},
+    {0.638683, -0.947437, -0.117999, -0.359200, 0.883800, 0.299700, 0.033214, 0.919163},
+    {0.438796, -0.579449, -0.329926, -0.228100, -0.589700, 0.774700, 0.053988, 0.929550},
+    {0.434716, -0.936706, -0.309520, -0.157900, 0.855000, 0.494000, 0.033214, 0.929550},
+    {0.832945, -0.731266, 0.127589, -0.845300, -0.533100, 0.035400, 0.050505, 0.908776},
+    {0.655046, -0.541910, -0.122233, -0.632300, -0.692200, 0.348100, 0.053988, 0.919163},
+    {0.263992, -0.950782, -0.251559, 0.240500, 0.926700, 0.288600, 0.033214, 0.939937},
+    {0.251273, -0.538192, -0.266820, 0.419800, -0.755000, 0.503800, 0.053988, 0.939937},
+    {0.263992, -0.950782, -0.251559, 0.240500, 0.926700, 0.288600, 0.022827, 0.950323},
+    {0.251273, -0.538192, -0.266820, 0.419800, -0.755000, 0.503800, 0.064375, 0.950323},
+    {0.702521, -0.950782, 0.274628, -0.249200, 0.921100, -0.299000, 0.022827, 0.971097},
+    {0.434716, -0.936706, -0.309520, -0.157900, 0.855000, 0.494000, 0.012440, 0.950323},
+    {0.638683, -0.947437, -0.117999, -0.359200, 0.883800, 0.299700, 0.012440, 0.960710},
+    {0.790304, -0.936706, 0.117147, -0.523400, 0.849800, 0.062800, 0.012440, 0.971097},
+    {0.832945, -0.731266, 0.127589, -0.845300, -0.533100, 0.035400, 0.075890, 0.972155},
+    {0.742258, -0.700372, 0.322308, -0.458200, -0.698500, -0.549700, 0.064375, 0.973013},
+    {0.742258, -0.700372, 0.322308, -0.458200, -0.698500, -0.549700, 0.050505, 0.981484},
+    {0.438796, -0.579449, -0.329926, -0.228100, -0.589700, 0.774700, 0.074761, 0.950323},
+    {0.655046, -0.541910, -0.122233, -0.632300, -0.692200, 0.348100, 0.074761, 0.960710},
+    {0.883301, -0.845923, 0.145245, -0.984600, 0.173500, 0.023200, 0.043601, 0.991871},
+    {0.702521, -0.950782, 0.274628, -0.249200, 0.921100, -0.299000, 0.033214, 0.981484},
+    {0.832945, -0.731266, 0.127589, -0.845300, -0.533100, 0.035400, 0.050505, 0.991871},
+    {0.790304, -0.936706, 0.117147, -0.523400, 0.849800, 0.062800, 0.033214, 0.991871},
+};
+static const int mesh_indices[] = {
+    0, 1, 2,
+    0, 3, 4,
+    0, 5, 6,
+    7, 0, 2,
+    0, 4, 1,
+    0, 6, 3,
+    0, 8, 5,
+    7, 8, 0,
+    1, 9, 10,
+    1, 11, 2,
+    1, 4, 9,
+    1, 10, 11,
+    7, 2, 11,
+    7, 11, 12,
+    7, 13, 8,
+    7, 12, 13,
+    8, 14, 5,
+    8, 13, 14,
+    5, 15, 6,
+    5, 14, 15,
+    3, 6, 15,
+    15, 16, 17,
+    3, 15, 17,
+    18, 15, 14,
+    15, 19, 16,
+    18, 19, 15,
+    13, 18, 14,
+    20, 13, 12,
+    13, 21, 18,
+    20, 21, 13,
+    11, 20, 12,
+    20, 22, 21,
+    20, 23, 22,
+    11, 23, 20,
+    18, 21, 22,
+    18, 22, 19,
+    16, 19, 22,
+    16, 22, 24,
+    9, 16, 24,
+    9, 17, 16,
+    17, 4, 3,
+    17, 9, 4,
+    9, 25, 10,
+    9, 24, 25,
+    25, 24, 22,
+    25, 22, 23,
+    11, 25, 23,
+    11, 10, 25,
+    26, 27, 28,
+    26, 29, 30,
+    26, 31, 32,
+    26, 30, 27,
+    26, 32, 29,
+    26, 28, 31,
+    33, 31, 28,
+    27, 33, 28,
+    31, 34, 35,
+    31, 36, 32,
+    31, 37, 34,
+    33, 37, 31,
+    31, 35, 36,
+    36, 29, 32,
+    35, 38, 36,
+    36, 38, 29,
+    39, 35, 34,
+    39, 40, 35,
+    35, 40, 38,
+    41, 34, 37,
+    41, 39, 34,
+    33, 41, 37,
+    27, 42, 33,
+    33, 42, 41,
+    41, 43, 39,
+    44, 41, 42,
+    41, 45, 43,
+    44, 45, 41,
+    43, 40, 39,
+    46, 40, 47,
+    46, 38, 40,
+    43, 47, 40,
+    29, 38, 46,
+    46, 48, 49,
+    29, 46, 49,
+    46, 47, 48,
+    48, 47, 43,
+    48, 43, 45,
+    44, 48, 45,
+    27, 44, 42,
+    27, 50, 44,
+    44, 50, 48,
+    51, 48, 50,
+    51, 49, 48,
+    51, 29, 49,
+    51, 30, 29,
+    27, 51, 50,
+    27, 30, 51,
+    52, 53, 54,
+    52, 55, 53,
+    55, 52, 56,
+    53, 57, 54,
+    53, 58, 57,
+    58, 53, 59,
+    59, 53, 55,
+    55, 56, 60,
+    59, 55, 60,
+    56, 61, 60,
+    56, 62, 61,
+    61, 59, 60,
+    58, 59, 63,
+    64, 59, 65,
+    61, 65, 59,
+    64, 63, 59,
+    66, 58, 63,
+    66, 57, 58,
+    64, 66, 63,
+    67, 64, 65,
+    64, 67, 66,
+    67, 65, 68,
+    62, 65, 61,
+    62, 68, 65,
+    69, 70, 71,
+    72, 69, 73,
+    69, 74, 70,
+    72, 74, 69,
+    73, 69, 71,
+    75, 70, 74,
+    75, 76, 70,
+    75, 74, 72,
+    77, 72, 73,
+    78, 72, 79,
+    75, 72, 80,
+    77, 79, 72,
+    78, 80, 72,
+    73, 71, 81,
+    73, 82, 77,
+    73, 81, 82,
+    77, 83, 79,
+    77, 82, 83,
+    78, 79, 83,
+    84, 80, 78,
+    78, 83, 84,
+    76, 80, 85,
+    76, 75, 80,
+    84, 85, 80,
+    86, 87, 88,
+    86, 89, 90,
+    86, 91, 87,
+    86, 88, 89,
+    92, 87, 93,
+    91, 93, 87,
+    92, 88, 87,
+    92, 89, 88,
+    92, 94, 89,
+    90, 89, 94,
+    90, 94, 95,
+    92, 96, 94,
+    97, 94, 96,
+    97, 95, 94,
+    98, 92, 93,
+    92, 99, 96,
+    98, 99, 92,
+    100, 93, 101,
+    100, 98, 93,
+    91, 101, 93,
+    102, 98, 100,
+    102, 99, 98,
+    102, 96, 99,
+    102, 97, 96,
+    103, 104, 105,
+    103, 106, 107,
+    103, 107, 104,
+    103, 108, 106,
+    109, 104, 107,
+    110, 105, 104,
+    109, 110, 104,
+    110, 111, 105,
+    109, 112, 110,
+    113, 110, 112,
+    113, 111, 110,
+    109, 106, 114,
+    109, 115, 116,
+    109, 116, 112,
+    109, 107, 106,
+    109, 114, 115,
+    108, 114, 106,
+    108, 117, 114,
+    118, 114, 117,
+    118, 115, 114,
+    119, 115, 118,
+    119, 116, 115,
+    119, 112, 116,
+    119, 113, 112,
+    120, 121, 122,
+    120, 123, 124,
+    120, 125, 126,
+    120, 127, 128,
+    120, 124, 121,
+    120, 128, 123,
+    120, 122, 125,
+    120, 126, 127,
+    121, 129, 122,
+    122, 130, 125,
+    122, 129, 130,
+    125, 131, 132,
+    125, 130, 131,
+    126, 125, 132,
+    126, 132, 133,
+    126, 134, 127,
+    126, 133, 134,
+    127, 135, 136,
+    127, 134, 135,
+    128, 127, 136,
+    137, 123, 128,
+    128, 136, 137,
+    138, 137, 136,
+    139, 136, 135,
+    139, 138, 136,
+    134, 140, 135,
+    141, 135, 140,
+    141, 139, 135,
+    133, 142, 134,
+    134, 142, 140,
+    133, 143, 144,
+    133, 144, 142,
+    133, 132, 143,
+    144, 145, 142,
+    142, 146, 140,
+    142, 145, 146,
+    147, 140, 146,
+    147, 141, 140,
+    148, 141, 147,
+    149, 139, 141,
+    148, 149, 141,
+    150, 138, 139,
+    149, 150, 139,
+    150, 151, 138,
+    151, 152, 138,
+    151, 153, 152,
+    152, 154, 137,
+    153, 155, 152,
+    152, 155, 154,
+    138, 152, 137,
+    153, 156, 155,
+    155, 157, 158,
+    155, 159, 154,
+    155, 156, 157,
+    155, 158, 159,
+    154, 160, 123,
+    137, 154, 123,
+    154, 159, 160,
+    159, 161, 160,
+    159, 158, 161,
+    158, 162, 161,
+    158, 157, 162,
+    161, 163, 164,
+    161, 162, 163,
+    160, 161, 164,
+    160, 164, 165,
+    123, 160, 165,
+    123, 165, 124,
+    165, 121, 124,
+    165, 166, 121,
+    166, 165, 164,
+    166, 164, 167,
+    167, 164, 163,
+    167, 163, 168,
+    169, 167, 170,
+    169, 166, 167,
+    170, 167, 168,
+    166, 171, 121,
+    166, 169, 171,
+    121, 171, 129,
+    171, 172, 129,
+    169, 173, 171,
+    171, 173, 172,
+    169, 170, 173,
+    170, 168, 174,
+    173, 170, 174,
+    173, 174, 175,
+    173, 176, 172,
+    173, 175, 176,
+    177, 129, 172,
+    178, 172, 176,
+    178, 177, 172,
+    177, 130, 129,
+    179, 177, 178,
+    180, 130, 177,
+    179, 180, 177,
+    180, 131, 130,
+    181, 131, 180,
+    182, 180, 179,
+    182, 181, 180,
+    181, 183, 131,
+    132, 131, 183,
+    184, 181, 182,
+    185, 183, 181,
+    184, 185, 181,
+    132, 183, 143,
+    185, 186, 183,
+    143, 183, 186,
+    187, 186, 185,
+    188, 185, 184,
+    188, 187, 185,
+    143, 186, 189,
+    189, 186, 190,
+    187, 190, 186,
+    144, 143, 189,
+    189, 190, 191,
+    144, 189, 192,
+    192, 189, 191,
+    190, 193, 191,
+    190, 194, 193,
+    194, 190, 187,
+    195, 187, 188,
+    194, 187, 196,
+    195, 196, 187,
+    193, 194, 197,
+    197, 194, 196,
+    193, 197, 198,
+    199, 193, 200,
+    200, 193, 198,
+    199, 191, 193,
+    192, 191, 199,
+    192, 201, 145,
+    144, 192, 145,
+    192, 199, 201,
+    199, 202, 201,
+    199, 200, 202,
+    200, 198, 203,
+    200, 204, 202,
+    200, 203, 204,
+    198, 205, 206,
+    198, 197, 205,
+    203, 198, 206,
+    197, 196, 207,
+    205, 197, 207,
+    207, 196, 195,
+    207, 195, 208,
+    205, 207, 209,
+    209, 207, 208,
+    209, 206, 205,
+    203, 206, 210,
+    211, 210, 206,
+    209, 211, 206,
+    203, 212, 204,
+    203, 210, 212,
+    204, 213, 214,
+    204, 212, 213,
+    202, 204, 214,
+    215, 212, 216,
+    215, 213, 212,
+    216, 212, 210,
+    216, 210, 217,
+    211, 217, 210,
+    218, 211, 209,
+    219, 217, 211,
+    218, 219, 211,
+    209, 208, 218,
+    219, 220, 217,
+    221, 217, 220,
+    221, 216, 217,
+    222, 216, 221,
+    222, 215, 216,
+    223, 215, 222,
+    224, 213, 215,
+    223, 224, 215,
+    224, 214, 213,
+    225, 224, 223,
+    226, 214, 224,
+    225, 226, 224,
+    225, 227, 226,
+    225, 228, 227,
+    227, 229, 226,
+    226, 229, 214,
+    228, 147, 227,
+    227, 146, 230,
+    227, 147, 146,
+    227, 230, 229,
+    228, 148, 147,
+    202, 214, 229,
+    202, 229, 230,
+    202, 230, 201,
+    145, 230, 146,
+    145, 201, 230,
+    231, 232, 233,
+    234, 231, 235,
+    231, 236, 235,
+    231, 237, 232,
+    234, 237, 231,
+    231, 233, 236,
+    237, 238, 232,
+    238, 239, 232,
+    232, 240, 233,
+    232, 239, 240,
+    233, 241, 236,
+    233, 240, 241,
+    236, 242, 243,
+    235, 236, 243,
+    236, 241, 242,
+    244, 235, 245,
+    235, 243, 245,
+    244, 234, 235,
+    246, 243, 247,
+    246, 245, 243,
+    247, 243, 242,
+    247, 242, 248,
+    249, 247, 250,
+    250, 247, 248,
+    249, 246, 247,
+    246, 251, 252,
+    245, 246, 252,
+    246, 249, 251,
+    245, 252, 244,
+    253, 234, 244,
+    244, 254, 253,
+    244, 252, 254,
+    254, 252, 251,
+    251, 255, 256,
+    249, 257, 251,
+    254, 251, 256,
+    251, 257, 255,
+    249, 258, 257,
+    258, 249, 250,
+    250, 248, 259,
+    258, 250, 260,
+    260, 250, 259,
+    258, 261, 257,
+    258, 262, 261,
+    262, 258, 260,
+    257, 263, 255,
+    257, 261, 263,
+    255, 264, 256,
+    263, 265, 255,
+    255, 265, 264,
+    254, 256, 264,
+    265, 266, 264,
+    254, 264, 267,
+    264, 268, 267,
+    264, 266, 268,
+    269, 270, 265,
+    263, 269, 265,
+    265, 270, 266,
+    261, 271, 263,
+    271, 269, 263,
+    262, 272, 261,
+    261, 272, 271,
+    271, 273, 274,
+    271, 275, 276,
+    271, 272, 273,
+    271, 276, 269,
+    271, 274, 275,
+    276, 277, 269,
+    269, 277, 270,
+    278, 270, 279,
+    278, 266, 270,
+    279, 270, 277,
+    279, 277, 280,
+    280, 277, 281,
+    276, 281, 277,
+    276, 282, 281,
+    276, 275, 282,
+    274, 283, 275,
+    275, 284, 282,
+    275, 283, 284,
+    285, 282, 286,
+    287, 282, 284,
+    285, 281, 282,
+    287, 286, 282,
+    280, 281, 285,
+    288, 280, 289,
+    289, 280, 285,
+    288, 279, 280,
+    290, 279, 288,
+    290, 278, 279,
+    291, 278, 290,
+    292, 293, 291,
+    291, 293, 278,
+    292, 294, 295,
+    292, 295, 293,
+    292, 296, 294,
+    295, 268, 293,
+    293, 266, 278,
+    293, 268, 266,
+    295, 297, 298,
+    295, 298, 268,
+    295, 294, 297,
+    296, 299, 294,
+    294, 300, 297,
+    294, 299, 300,
+    296, 301, 299,
+    301, 302, 299,
+    300, 299, 302,
+    300, 302, 303,
+    304, 300, 303,
+    304, 297, 300,
+    305, 297, 304,
+    305, 298, 297,
+    267, 298, 305,
+    267, 268, 298,
+    254, 305, 253,
+    254, 267, 305,
+    253, 305, 304,
+    253, 304, 306,
+    306, 304, 303,
+    303, 238, 307,
+    306, 303, 307,
+    303, 302, 238,
+    308, 238, 302,
+    301, 308, 302,
+    237, 307, 238,
+    238, 309, 239,
+    308, 309, 238,
+    306, 307, 237,
+    306, 237, 234,
+    253, 306, 234,
+    289, 285, 310,
+    310, 285, 286,
+    310, 286, 311,
+    311, 286, 287,
+    311, 287, 312,
+    313, 287, 314,
+    287, 315, 314,
+    313, 312, 287,
+    287, 284, 315,
+    314, 316, 313,
+    315, 317, 314,
+    314, 317, 316,
+    283, 315, 284,
+    315, 318, 317,
+    283, 318, 315,
+    318, 319, 317,
+    317, 320, 316,
+    317, 319, 320,
+    321, 318, 283,
+    318, 322, 319,
+    321, 322, 318,
+    274, 321, 283,
+    274, 323, 321,
+    321, 324, 322,
+    321, 323, 324,
+    319, 322, 324,
+    319, 324, 325,
+    320, 319, 325,
+    320, 325, 326,
+    325, 327, 328,
+    326, 325, 328,
+    325, 324, 327,
+    323, 327, 324,
+    273, 329, 323,
+    274, 273, 323,
+    323, 329, 327,
+    327, 330, 328,
+    327, 329, 330,
+    326, 328, 331,
+    331, 328, 330,
+    331, 330, 332,
+    330, 333, 334,
+    330, 335, 332,
+    330, 329, 333,
+    330, 334, 335,
+    273, 333, 329,
+    272, 333, 273,
+    333, 336, 334,
+    333, 337, 336,
+    272, 337, 333,
+    334, 338, 335,
+    334, 336, 338,
+    337, 339, 336,
+    336, 340, 338,
+    336, 339, 340,
+    337, 262, 339,
+    262, 337, 272,
+    339, 341, 340,
+    262, 260, 339,
+    339, 260, 341,
+    260, 259, 341,
+    342, 343, 344,
+    342, 345, 346,
+    342, 347, 348,
+    342, 349, 350,
+    342, 348, 343,
+    342, 344, 345,
+    342, 350, 347,
+    342, 346, 349,
+    343, 351, 344,
+    351, 345, 344,
+    352, 353, 351,
+    343, 352, 351,
+    351, 354, 345,
+    354, 351, 353,
+    343, 355, 352,
+    355, 356, 352,
+    352, 356, 353,
+    354, 353, 357,
+    356, 358, 353,
+    357, 353, 358,
+    345, 354, 359,
+    359, 354, 357,
+    359, 357, 360,
+    357, 358, 361,
+    360, 357, 361,
+    356, 362, 358,
+    363, 362, 356,
+    355, 363, 356,
+    364, 355, 365,
+    343, 365, 355,
+    364, 363, 355,
+    364, 366, 363,
+    363, 366, 362,
+    367, 364, 368,
+    368, 364, 365,
+    364, 369, 366,
+    367, 369, 364,
+    368, 365, 370,
+    370, 365, 343,
+    370, 343, 348,
+    371, 370, 372,
+    348, 372, 370,
+    371, 368, 370,
+    373, 368, 371,
+    373, 367, 368,
+    374, 371, 375,
+    374, 373, 371,
+    375, 371, 372,
+    375, 372, 376,
+    347, 376, 372,
+    348, 347, 372,
+    377, 375, 378,
+    378, 375, 376,
+    377, 374, 375,
+    378, 376, 379,
+    380, 379, 376,
+    347, 380, 376,
+    350, 380, 347,
+    381, 382, 380,
+    350, 381, 380,
+    380, 382, 379,
+    383, 379, 384,
+    382, 384, 379,
+    383, 378, 379,
+    385, 378, 383,
+    385, 377, 378,
+    386, 383, 387,
+    387, 383, 384,
+    386, 385, 383,
+    388, 389, 384,
+    387, 384, 389,
+    382, 388, 384,
+    390, 388, 382,
+    381, 390, 382,
+    381, 391, 390,
+    350, 392, 381,
+    381, 392, 391,
+    350, 349, 392,
+    392, 393, 391,
+    349, 394, 392,
+    392, 394, 393,
+    391, 395, 396,
+    390, 391, 396,
+    391, 393, 395,
+    390, 396, 397,
+    390, 397, 388,
+    397, 398, 388,
+    388, 398, 389,
+    397, 399, 400,
+    397, 400, 398,
+    397, 396, 399,
+    396, 401, 399,
+    396, 395, 401,
+    402, 395, 403,
+    402, 401, 395,
+    403, 395, 393,
+    403, 393, 404,
+    404, 393, 394,
+    405, 403, 406,
+    405, 402, 403,
+    406, 403, 404,
+    407, 402, 405,
+    408, 402, 409,
+    407, 409, 402,
+    408, 401, 402,
+    401, 410, 399,
+    401, 408, 410,
+    400, 399, 410,
+    410, 411, 412,
+    400, 410, 413,
+    413, 410, 412,
+    410, 408, 411,
+    411, 408, 409,
+    411, 409, 414,
+    414, 409, 407,
+    414, 407, 415,
+    416, 414, 417,
+    417, 414, 415,
+    416, 411, 414,
+    412, 411, 416,
+    413, 412, 418,
+    412, 416, 419,
+    418, 412, 419,
+    413, 420, 421,
+    413, 418, 420,
+    400, 413, 421,
+    418, 422, 420,
+    418, 419, 423,
+    418, 423, 422,
+    424, 423, 419,
+    424, 419, 416,
+    424, 416, 417,
+    425, 424, 417,
+    417, 415, 425,
+    426, 427, 424,
+    425, 426, 424,
+    424, 427, 423,
+    428, 423, 427,
+    428, 422, 423,
+    420, 422, 429,
+    429, 422, 428,
+    420, 429, 430,
+    421, 420, 430,
+    429, 428, 431,
+    432, 429, 431,
+    432, 430, 429,
+    433, 428, 434,
+    433, 431, 428,
+    434, 428, 427,
+    434, 427, 435,
+    426, 435, 427,
+    436, 431, 433,
+    436, 432, 431,
+    437, 430, 432,
+    438, 432, 436,
+    438, 437, 432,
+    421, 430, 439,
+    437, 439, 430,
+    438, 387, 437,
+    387, 439, 437,
+    438, 386, 387,
+    387, 389, 439,
+    421, 439, 389,
+    421, 389, 398,
+    400, 421, 398,
+    406, 404, 440,
+    404, 394, 441,
+    440, 404, 441,
+    440, 441, 442,
+    441, 443, 444,
+    442, 441, 444,
+    441, 394, 443,
+    349, 443, 394,
+    346, 443, 349,
+    444, 443, 445,
+    346, 445, 443,
+    442, 444, 446,
+    444, 445, 447,
+    446, 444, 447,
+    345, 445, 346,
+    448, 447, 445,
+    345, 448, 445,
+    449, 450, 447,
+    446, 447, 450,
+    448, 449, 447,
+    345, 359, 448,
+    359, 449, 448,
+    449, 451, 452,
+    449, 452, 450,
+    449, 360, 451,
+    359, 360, 449,
+    360, 361, 451,
+    453, 454, 455,
+    456, 453, 455,
+    457, 453, 458,
+    453, 459, 454,
+    456, 458, 453,
+    457, 459, 453,
+    454, 460, 455,
+    461, 462, 454,
+    463, 454, 459,
+    454, 462, 460,
+    463, 461, 454,
+    464, 455, 460,
+    464, 456, 455,
+    465, 456, 464,
+    466, 458, 456,
+    465, 466, 456,
+    467, 458, 468,
+    466, 468, 458,
+    467, 457, 458,
+    469, 466, 465,
+    470, 468, 466,
+    469, 470, 466,
+    471, 469, 465,
+    465, 472, 471,
+    465, 464, 472,
+    464, 473, 472,
+    464, 460, 473,
+    472, 474, 475,
+    471, 472, 475,
+    472, 473, 474,
+    476, 477, 471,
+    471, 475, 476,
+    471, 477, 469,
+    477, 478, 469,
+    478, 470, 469,
+    479, 480, 470,
+    470, 480, 468,
+    478, 479, 470,
+    467, 468, 480,
+    467, 480, 481,
+    481, 480, 482,
+    479, 482, 480,
+    483, 479, 478,
+    484, 482, 479,
+    483, 484, 479,
+    485, 483, 478,
+    477, 485, 478,
+    486, 485, 477,
+    476, 486, 477,
+    475, 487, 476,
+    486, 476, 487,
+    486, 487, 488,
+    489, 486, 488,
+    486, 489, 485,
+    489, 490, 485,
+    485, 490, 483,
+    490, 491, 483,
+    491, 484, 483,
+    492, 493, 484,
+    484, 493, 482,
+    491, 492, 484,
+    481, 482, 494,
+    494, 482, 493,
+    494, 493, 495,
+    492, 496, 493,
+    495, 493, 496,
+    497, 492, 491,
+    498, 496, 492,
+    497, 498, 492,
+    499, 497, 491,
+    490, 499, 491,
+    500, 499, 490,
+    489, 500, 490,
+    489, 488, 501,
+    500, 489, 501,
+    500, 501, 502,
+    500, 503, 499,
+    503, 500, 502,
+    503, 504, 499,
+    499, 504, 497,
+    497, 505, 498,
+    497, 506, 507,
+    497, 507, 505,
+    497, 504, 506,
+    498, 508, 509,
+    498, 509, 496,
+    498, 505, 508,
+    507, 510, 505,
+    505, 511, 508,
+    505, 510, 511,
+    507, 512, 513,
+    507, 506, 512,
+    507, 513, 510,
+    504, 514, 506,
+    506, 515, 512,
+    506, 514, 515,
+    504, 516, 514,
+    503, 516, 504,
+    514, 517, 518,
+    519, 514, 518,
+    514, 516, 517,
+    519, 515, 514,
+    512, 515, 520,
+    520, 515, 519,
+    512, 520, 521,
+    513, 512, 521,
+    513, 521, 522,
+    513, 523, 510,
+    513, 522, 523,
+    524, 521, 525,
+    525, 521, 520,
+    524, 522, 521,
+    525, 520, 526,
+    520, 519, 526,
+    527, 519, 528,
+    527, 526, 519,
+    528, 519, 518,
+    529, 526, 527,
+    529, 525, 526,
+    530, 525, 529,
+    530, 524, 525,
+    523, 524, 531,
+    531, 524, 530,
+    523, 522, 524,
+    532, 523, 531,
+    510, 523, 532,
+    531, 530, 533,
+    532, 531, 534,
+    534, 531, 533,
+    510, 532, 511,
+    535, 532, 534,
+    535, 511, 532,
+    534, 533, 536,
+    536, 535, 534,
+    535, 508, 511,
+    537, 538, 535,
+    536, 537, 535,
+    535, 538, 508,
+    539, 508, 538,
+    539, 509, 508,
+    540, 538, 541,
+    540, 539, 538,
+    537, 541, 538,
+    542, 509, 539,
+    543, 539, 540,
+    543, 542, 539,
+    542, 496, 509,
+    544, 542, 543,
+    495, 496, 542,
+    544, 495, 542,
+    545, 495, 544,
+    545, 494, 495,
+    546, 494, 545,
+    546, 481, 494,
+    547, 481, 546,
+    547, 467, 481,
+    547, 457, 467,
+    547, 548, 457,
+    548, 459, 457,
+    548, 463, 459,
+    518, 549, 550,
+    528, 518, 550,
+    518, 517, 549,
+    517, 551, 549,
+    516, 552, 517,
+    517, 552, 551,
+    552, 553, 551,
+    503, 502, 552,
+    516, 503, 552,
+    552, 502, 553,
+    502, 554, 553,
+    502, 501, 554,
+    501, 555, 554,
+    501, 488, 555,
+    488, 556, 555,
+    488, 487, 556,
+    557, 556, 487,
+    557, 558, 556,
+    475, 557, 487,
+    559, 558, 557,
+    474, 557, 475,
+    474, 559, 557,
+    559, 560, 558,
+    474, 561, 559,
+    561, 560, 559,
+    474, 473, 561,
+    462, 562, 561,
+    460, 561, 473,
+    561, 562, 560,
+    460, 462, 561,
+    461, 563, 462,
+    462, 563, 562,
+    564, 565, 566,
+    564, 567, 565,
+    568, 565, 567,
+    565, 569, 570,
+    565, 571, 566,
+    568, 572, 565,
+    565, 572, 569,
+    565, 570, 571,
+    570, 569, 573,
+    570, 574, 571,
+    570, 573, 575,
+    570, 575, 574,
+    573, 576, 575,
+    573, 577, 576,
+    574, 575, 576,
+    574, 576, 578,
+    577, 579, 576,
+    578, 576, 579,
+    577, 580, 581,
+    577, 581, 579,
+    577, 582, 580,
+    578, 579, 583,
+    579, 584, 585,
+    579, 586, 583,
+    579, 581, 584,
+    579, 585, 586,
+    578, 587, 588,
+    578, 583, 587,
+    587, 583, 586,
+    585, 589, 586,
+    587, 586, 590,
+    585, 591, 592,
+    585, 592, 589,
+    585, 584, 591,
+    580, 584, 581,
+    580, 593, 584,
+    580, 594, 593,
+    580, 595, 594,
+    596, 595, 580,
+    596, 580, 582,
+    591, 597, 592,
+    591, 598, 597,
+    589, 592, 597,
+    589, 597, 599,
+    587, 590, 600,
+    587, 600, 601,
+    602, 587, 601,
+    602, 588, 587,
+    603, 604, 605,
+    603, 606, 604,
+    604, 607, 605,
+    604, 608, 609,
+    610, 604, 606,
+    604, 609, 607,
+    604, 611, 608,
+    610, 611, 604,
+    611, 612, 608,
+    613, 611, 610,
+    613, 614, 611,
+    611, 614, 612,
+    615, 612, 614,
+    615, 616, 612,
+    613, 615, 614,
+    613, 617, 615,
+    617, 618, 615,
+    618, 616, 615,
+    616, 619, 620,
+    618, 621, 616,
+    616, 621, 619,
+    618, 622, 621,
+    623, 618, 624,
+    617, 624, 618,
+    618, 625, 622,
+    623, 625, 618,
+    626, 617, 627,
+    626, 624, 617,
+    626, 623, 624,
+    628, 625, 623,
+    626, 629, 623,
+    625, 630, 622,
+    628, 631, 625,
+    625, 631, 630,
+    622, 619, 621,
+    622, 632, 619,
+    619, 632, 633,
+    619, 633, 634,
+    619, 634, 635,
+    619, 635, 620,
+    636, 630, 631,
+    636, 637, 630,
+    628, 636, 631,
+    628, 638, 636,
+    639, 629, 626,
+    639, 626, 640,
+    641, 640, 626,
+    641, 626, 627,
+    642, 643, 644,
+    642, 645, 643,
+    643, 646, 644,
+    643, 647, 648,
+    649, 643, 645,
+    643, 648, 646,
+    643, 650, 647,
+    649, 650, 643,
+    651, 647, 650,
+    651, 652, 647,
+    653, 650, 649,
+    653, 651, 650,
+    651, 654, 652,
+    653, 655, 651,
+    651, 655, 654,
+    653, 656, 655,
+    656, 657, 655,
+    657, 654, 655,
+    654, 658, 659,
+    657, 660, 654,
+    654, 660, 658,
+    657, 661, 660,
+    662, 657, 663,
+    656, 663, 657,
+    657, 664, 661,
+    662, 664, 657,
+    665, 656, 666,
+    665, 663, 656,
+    665, 662, 663,
+    667, 664, 662,
+    665, 668, 662,
+    664, 669, 661,
+    667, 670, 664,
+    664, 670, 669,
+    661, 658, 660,
+    661, 671, 658,
+    658, 671, 672,
+    658, 672, 673,
+    658, 673, 674,
+    658, 674, 659,
+    675, 669, 670,
+    675, 676, 669,
+    667, 675, 670,
+    667, 677, 675,
+    678, 668, 665,
+    678, 665, 679,
+    680, 679, 665,
+    680, 665, 666,
+    681, 682, 683,
+    681, 684, 682,
+    685, 682, 684,
+    682, 686, 687,
+    682, 688, 683,
+    685, 689, 682,
+    682, 689, 686,
+    682, 687, 688,
+    686, 690, 687,
+    686, 691, 690,
+    687, 692, 688,
+    687, 690, 692,
+    690, 693, 694,
+    690, 691, 693,
+    692, 690, 694,
+    692, 694, 695,
+    693, 696, 694,
+    695, 694, 696,
+    693, 697, 698,
+    693, 698, 696,
+    693, 699, 697,
+    695, 696, 700,
+    696, 701, 702,
+    696, 703, 700,
+    696, 698, 701,
+    696, 702, 703,
+    695, 704, 705,
+    695, 700, 704,
+    704, 700, 703,
+    702, 706, 703,
+    704, 703, 707,
+    702, 708, 709,
+    702, 709, 706,
+    702, 701, 708,
+    697, 701, 698,
+    697, 710, 701,
+    697, 711, 710,
+    697, 712, 711,
+    713, 712, 697,
+    713, 697, 699,
+    708, 714, 709,
+    708, 715, 714,
+    706, 709, 714,
+    706, 714, 716,
+    704, 707, 717,
+    704, 717, 718,
+    719, 704, 718,
+    719, 705, 704,
+    0, 1, 2,
+    3, 0, 2,
+    4, 1, 0,
+    5, 0, 3,
+    4, 0, 6,
+    5, 6, 0,
+    7, 8, 1,
+    8, 9, 1,
+    10, 1, 4,
+    7, 1, 10,
+    9, 2, 1,
+    2, 11, 3,
+    2, 9, 11,
+    12, 3, 11,
+    12, 5, 3,
+    13, 10, 5,
+    5, 10, 6,
+    13, 5, 12,
+    10, 4, 6,
+    8, 7, 10,
+    13, 8, 10,
+    11, 8, 12,
+    11, 9, 8,
+    13, 12, 8,
+    14, 15, 16,
+    17, 14, 18,
+    19, 18, 14,
+    20, 14, 16,
+    17, 15, 14,
+    20, 19, 14,
+    21, 22, 15,
+    21, 15, 17,
+    22, 16, 15,
+    23, 16, 22,
+    23, 20, 16,
+    24, 19, 20,
+    24, 20, 23,
+    19, 25, 18,
+    19, 24, 25,
+    25, 17, 18,
+    25, 21, 17,
+    23, 21, 26,
+    26, 21, 25,
+    23, 22, 21,
+    24, 23, 26,
+    26, 25, 24,
+    27, 28, 29,
+    30, 27, 31,
+    28, 27, 32,
+    30, 32, 27,
+    31, 27, 29,
+    33, 28, 32,
+    34, 32, 30,
+    31, 35, 30,
+    36, 37, 38,
+    36, 38, 39,
+    36, 40, 37,
+    37, 41, 42,
+    43, 37, 44,
+    37, 42, 38,
+    43, 41, 37,
+    40, 44, 37,
+    39, 38, 42,
+    45, 42, 41,
+    46, 41, 43,
+    46, 45, 41,
+    47, 48, 49,
+    47, 50, 48,
+    51, 49, 48,
+    52, 51, 48,
+    52, 48, 50,
+    52, 50, 53,
+    54, 51, 52,
+    55, 54, 52,
+    55, 52, 56,
+    52, 53, 56,
+    57, 58, 59,
+    57, 60, 61,
+    57, 61, 58,
+    62, 58, 63,
+    62, 59, 58,
+    61, 64, 58,
+    58, 64, 63,
+    64, 61, 65,
+    60, 65, 61,
+    66, 63, 64,
+    67, 62, 63,
+    63, 66, 67,
+    68, 69, 70,
+    68, 71, 72,
+    68, 73, 74,
+    68, 75, 69,
+    68, 72, 75,
+    68, 74, 71,
+    68, 70, 73,
+    76, 69, 75,
+    76, 77, 69,
+    69, 78, 70,
+    69, 77, 78,
+    70, 79, 73,
+    70, 78, 79,
+    73, 80, 81,
+    73, 79, 80,
+    74, 73, 81,
+    74, 82, 71,
+    74, 81, 83,
+    74, 83, 82,
+    84, 85, 81,
+    81, 80, 84,
+    83, 81, 85,
+    86, 80, 87,
+    87, 80, 79,
+    86, 84, 80,
+    87, 79, 78,
+    77, 88, 78,
+    87, 78, 88,
+    89, 87, 90,
+    90, 87, 91,
+    91, 87, 92,
+    93, 87, 89,
+    92, 87, 88,
+    93, 86, 87,
+    94, 86, 95,
+    96, 86, 93,
+    94, 84, 86,
+    95, 86, 96,
+    85, 84, 94,
+    83, 85, 97,
+    97, 85, 94,
+    98, 99, 94,
+    94, 95, 98,
+    97, 94, 100,
+    94, 99, 100,
+    97, 101, 102,
+    97, 100, 101,
+    83, 97, 102,
+    103, 100, 99,
+    103, 101, 100,
+    104, 99, 105,
+    104, 103, 99,
+    98, 106, 99,
+    106, 105, 99,
+    107, 103, 104,
+    108, 103, 107,
+    108, 102, 103,
+    103, 102, 101,
+    83, 102, 82,
+    102, 109, 82,
+    110, 102, 108,
+    110, 109, 102,
+    111, 110, 108,
+    112, 113, 110,
+    110, 114, 109,
+    111, 112, 110,
+    110, 113, 114,
+    82, 109, 114,
+    71, 82, 114,
+    71, 114, 115,
+    113, 115, 114,
+    72, 71, 115,
+    113, 116, 115,
+    72, 115, 116,
+    116, 75, 72,
+    117, 118, 116,
+    116, 118, 75,
+    113, 117, 116,
+    118, 119, 75,
+    75, 119, 76,
+    118, 120, 119,
+    117, 121, 118,
+    118, 121, 120,
+    122, 117, 113,
+    123, 122, 113,
+    124, 123, 113,
+    125, 124, 113,
+    112, 125, 113,
+    119, 120, 126,
+    119, 126, 76,
+    76, 127, 77,
+    76, 126, 128,
+    127, 76, 128,
+    127, 128, 129,
+    127, 129, 130,
+    77, 127, 130,
+    77, 130, 131,
+    77, 131, 88,
+    132, 133, 134,
+    132, 135, 133,
+    136, 132, 137,
+    137, 132, 138,
+    132, 134, 138,
+    132, 139, 135,
+    136, 139, 132,
+    135, 140, 133,
+    141, 135, 142,
+    139, 142, 135,
+    143, 142, 139,
+    136, 143, 139,
+    144, 145, 136,
+    146, 136, 137,
+    146, 144, 136,
+    136, 145, 143,
+    146, 137, 138,
+    138, 147, 146,
+    146, 147, 144,
+    148, 138, 149,
+    138, 134, 149,
+    138, 148, 147,
+    148, 150, 147,
+    144, 147, 151,
+    147, 150, 151,
+    152, 153, 144,
+    144, 151, 152,
+    144, 153, 145,
+    154, 145, 153,
+    154, 143, 145,
+    154, 153, 155,
+    152, 156, 153,
+    155, 153, 156,
+    157, 152, 151,
+    158, 156, 152,
+    157, 158, 152,
+    150, 157, 151,
+    150, 159, 157,
+    159, 158, 157,
+    160, 161, 150,
+    150, 161, 159,
+    148, 160, 150,
+    159, 162, 163,
+    159, 164, 165,
+    159, 163, 158,
+    159, 165, 162,
+    159, 161, 164,
+    163, 156, 158,
+    155, 156, 166,
+    163, 166, 156,
+    167, 154, 155,
+    168, 155, 166,
+    163, 169, 166,
+    168, 166, 170,
+    170, 166, 171,
+    171, 166, 169,
+    163, 162, 169,
+    171, 169, 162,
+    172, 171, 173,
+    170, 171, 172,
+    173, 171, 174,
+    171, 162, 175,
+    175, 174, 171,
+    162, 176, 175,
+    162, 177, 176,
+    176, 177, 178,
+    177, 165, 179,
+    162, 165, 177,
+    178, 177, 179,
+    179, 180, 181,
+    179, 165, 180,
+    161, 180, 164,
+    164, 180, 165,
+    180, 182, 181,
+    182, 180, 183,
+    161, 183, 180,
+    181, 182, 184,
+    182, 185, 184,
+    182, 183, 185,
+    183, 186, 185,
+    183, 187, 186,
+    183, 188, 187,
+    160, 189, 183,
+    160, 183, 161,
+    183, 189, 188,
+    160, 148, 189,
+    148, 149, 189,
+    189, 149, 190,
+    149, 191, 190,
+    134, 191, 149,
+    192, 154, 167,
+    192, 143, 154,
+    192, 193, 143,
+    193, 142, 143,
+    194, 195, 196,
+    194, 197, 198,
+    199, 200, 194,
+    194, 201, 195,
+    194, 198, 201,
+    196, 199, 194,
+    194, 200, 197,
+    195, 202, 196,
+    196, 202, 199,
+    199, 203, 204,
+    199, 202, 203,
+    199, 204, 200,
+    200, 205, 197,
+    204, 206, 200,
+    200, 206, 205,
+    207, 197, 205,
+    207, 198, 197,
+    208, 201, 198,
+    209, 208, 198,
+    207, 209, 198,
+    208, 210, 201,
+    201, 211, 212,
+    201, 212, 195,
+    201, 210, 211,
+    212, 211, 213,
+    212, 213, 195,
+    195, 213, 214,
+    202, 195, 215,
+    215, 195, 214,
+    215, 214, 216,
+    202, 215, 217,
+    215, 218, 217,
+    218, 215, 216,
+    219, 217, 220,
+    217, 218, 220,
+    219, 221, 217,
+    202, 217, 221,
+    218, 222, 220,
+    223, 220, 222,
+    223, 219, 220,
+    224, 219, 223,
+    225, 219, 224,
+    226, 219, 225,
+    227, 219, 226,
+    228, 229, 219,
+    227, 228, 219,
+    219, 229, 221,
+    202, 221, 203,
+    203, 221, 229,
+    203, 229, 230,
+    230, 229, 231,
+    228, 231, 229,
+    232, 228, 227,
+    233, 228, 232,
+    233, 231, 228,
+    231, 234, 230,
+    234, 231, 233,
+    204, 230, 235,
+    204, 203, 230,
+    235, 230, 234,
+    234, 233, 236,
+    235, 234, 237,
+    237, 234, 236,
+    238, 233, 239,
+    236, 233, 238,
+    236, 240, 241,
+    236, 238, 240,
+    237, 236, 241,
+    237, 241, 242,
+    237, 242, 206,
+    235, 237, 206,
+    204, 235, 206,
+    206, 242, 205,
+    243, 205, 242,
+    243, 242, 241,
+    244, 241, 245,
+    243, 241, 244,
+    241, 240, 245,
+    245, 240, 246,
+    238, 246, 240,
+    247, 246, 238,
+    239, 247, 238,
+    248, 245, 246,
+    249, 245, 248,
+    244, 245, 249,
+    250, 243, 244,
+    251, 207, 243,
+    250, 251, 243,
+    243, 207, 205,
+    251, 252, 207,
+    253, 209, 207,
+    252, 254, 207,
+    254, 255, 207,
+    255, 253, 207,
+    256, 257, 258,
+    256, 259, 257,
+    260, 258, 257,
+    260, 257, 261,
+    262, 260, 263,
+    263, 260, 261,
+    263, 261, 264,
+    265, 261, 266,
+    266, 261, 257,
+    265, 267, 261,
+    267, 264, 261,
+    263, 264, 268,
+    262, 263, 269,
+    269, 263, 268,
+    270, 264, 267,
+    270, 271, 264,
+    268, 264, 271,
+    272, 267, 265,
+    272, 270, 267,
+    265, 266, 273,
+    274, 272, 265,
+    275, 274, 265,
+    265, 273, 275,
+    273, 266, 257,
+    273, 276, 275,
+    273, 257, 276,
+    275, 277, 278,
+    279, 280, 275,
+    281, 275, 278,
+    275, 281, 274,
+    275, 280, 277,
+    276, 279, 275,
+    281, 282, 274,
+    274, 282, 272,
+    282, 283, 272,
+    283, 270, 272,
+    282, 284, 283,
+    285, 286, 282,
+    281, 285, 282,
+    282, 286, 284,
+    281, 278, 287,
+    285, 281, 287,
+    278, 277, 288,
+    287, 278, 288,
+    285, 287, 289,
+    289, 287, 290,
+    291, 285, 289,
+    285, 291, 286,
+    286, 292, 293,
+    286, 291, 292,
+    284, 286, 293,
+    292, 291, 289,
+    294, 292, 295,
+    293, 292, 296,
+    297, 292, 289,
+    292, 297, 295,
+    294, 296, 292,
+    284, 293, 296,
+    298, 296, 294,
+    299, 296, 298,
+    284, 296, 299,
+    300, 298, 294,
+    299, 298, 301,
+    301, 298, 300,
+    299, 301, 302,
+    284, 299, 303,
+    304, 299, 302,
+    303, 299, 305,
+    304, 305, 299,
+    302, 306, 304,
+    307, 304, 308,
+    309, 310, 304,
+    311, 304, 307,
+    304, 310, 305,
+    311, 309, 304,
+    306, 308, 304,
+    303, 305, 310,
+    303, 271, 270,
+    284, 303, 270,
+    303, 310, 271,
+    284, 270, 283,
+    268, 271, 309,
+    309, 271, 310,
+    312, 309, 311,
+    312, 268, 309,
+    295, 297, 313,
+    313, 297, 289,
+    313, 289, 314,
+    289, 315, 314,
+    289, 316, 315,
+    289, 290, 316,
+    276, 257, 279,
+    257, 317, 279,
+    257, 259, 317,
+    318, 319, 320,
+    318, 321, 319,
+    319, 322, 323,
+    324, 320, 319,
+    319, 321, 322,
+    323, 322, 325,
+    323, 325, 326,
+    325, 327, 326,
+    326, 327, 328,
+    328, 327, 329,
+    327, 330, 329,
+    329, 331, 328,
+    332, 328, 333,
+    328, 331, 334,
+    328, 335, 333,
+    332, 336, 328,
+    328, 334, 335,
+    331, 337, 338,
+    329, 339, 331,
+    337, 340, 338,
+    337, 341, 340,
+    338, 340, 342,
+    329, 343, 339,
+    329, 344, 343,
+    345, 344, 329,
+    345, 329, 330,
+    346, 347, 348,
+    347, 349, 348,
+    347, 350, 351,
+    347, 351, 349,
+    347, 352, 350,
+    352, 353, 350,
+    352, 354, 353,
+    355, 353, 354,
+    354, 356, 355,
+    356, 357, 355,
+    355, 357, 358,
+    359, 357, 356,
+    360, 356, 361,
+    362, 356, 363,
+    360, 363, 356,
+    356, 364, 359,
+    362, 364, 356,
+    359, 365, 366,
+    359, 367, 357,
+    368, 366, 365,
+    365, 369, 368,
+    368, 370, 366,
+    357, 371, 358,
+    357, 372, 373,
+    357, 373, 371,
+    357, 367, 372,
+    374, 375, 376,
+    377, 374, 378,
+    379, 378, 374,
+    374, 376, 380,
+    374, 377, 375,
+    381, 375, 377,
+    381, 382, 375,
+    383, 381, 377,
+    383, 384, 381,
+    381, 384, 385,
+    386, 387, 384,
+    384, 388, 385,
+    384, 389, 388,
+    387, 389, 384,
+    388, 390, 385,
+    389, 391, 388,
+    388, 392, 393,
+    388, 393, 390,
+    388, 394, 392,
+    395, 389, 387,
+    389, 395, 391,
+    386, 396, 387,
+    397, 396, 386,
+    397, 386, 398,
+    399, 398, 386,
+    400, 391, 395,
+    400, 401, 391,
+    395, 402, 400,
+    403, 404, 405,
+    404, 406, 407,
+    404, 407, 405,
+    408, 409, 404,
+    404, 409, 406,
+    406, 410, 407,
+    406, 411, 410,
+    407, 410, 412,
+    410, 413, 414,
+    412, 410, 414,
+    415, 416, 413,
+    413, 416, 414,
+    417, 414, 418,
+    414, 416, 419,
+    414, 419, 418,
+    416, 420, 421,
+    419, 416, 422,
+    415, 423, 416,
+    416, 423, 420,
+    419, 424, 418,
+    419, 422, 424,
+    417, 418, 425,
+    426, 417, 427,
+    417, 428, 427,
+    417, 425, 428,
+    422, 429, 424,
+    424, 429, 430,
+    422, 431, 429,
+    0, 1, 2,
+    2, 3, 0,
+    1, 0, 4,
+    0, 3, 4,
+    2, 1, 4,
+    2, 5, 3,
+    2, 4, 5,
+    5, 4, 3,
+    6, 7, 8,
+    9, 10, 6,
+    8, 9, 6,
+    10, 7, 6,
+    9, 8, 7,
+    9, 7, 10,
+    11, 12, 13,
+    12, 11, 14,
+    11, 15, 16,
+    16, 14, 11,
+    17, 12, 14,
+    18, 14, 16,
+    19, 20, 21,
+    22, 19, 23,
+    22, 24, 19,
+    21, 25, 19,
+    19, 25, 23,
+    26, 22, 23,
+    27, 28, 29,
+    30, 27, 29,
+    30, 29, 31,
+    30, 31, 32,
+    33, 30, 34,
+    30, 32, 34,
+    35, 36, 37,
+    38, 35, 37,
+    37, 36, 39,
+    40, 39, 36,
+    39, 41, 37,
+    41, 42, 37,
+    43, 44, 45,
+    46, 47, 43,
+    45, 48, 43,
+    48, 46, 43,
+    43, 47, 49,
+    44, 43, 49,
+    44, 50, 51,
+    44, 52, 53,
+    45, 44, 51,
+    44, 53, 50,
+    45, 51, 54,
+    45, 55, 48,
+    45, 54, 55,
+    56, 46, 48,
+    57, 56, 48,
+    48, 55, 57,
+    56, 58, 46,
+    59, 56, 57,
+    60, 59, 57,
+    55, 61, 57,
+    62, 57, 63,
+    62, 64, 57,
+    63, 57, 61,
+    64, 65, 57,
+    65, 60, 57,
+    63, 61, 66,
+    66, 61, 67,
+    67, 61, 68,
+    55, 68, 61,
+    67, 68, 69,
+    70, 67, 69,
+    55, 71, 68,
+    68, 71, 69,
+    70, 69, 72,
+    73, 69, 71,
+    71, 74, 73,
+    71, 75, 74,
+    75, 71, 51,
+    55, 54, 71,
+    54, 51, 71,
+    76, 75, 51,
+    77, 51, 78,
+    78, 51, 79,
+    79, 51, 80,
+    76, 51, 77,
+    80, 51, 50,
+    81, 82, 83,
+    81, 84, 82,
+    85, 86, 81,
+    81, 83, 87,
+    81, 86, 84,
+    88, 89, 81,
+    89, 85, 81,
+    87, 88, 81,
+    84, 90, 82,
+    91, 84, 86,
+    92, 88, 93,
+    92, 94, 88,
+    88, 94, 89,
+    87, 93, 88,
+    93, 87, 95,
+    87, 83, 95,
+    93, 95, 96,
+    93, 97, 92,
+    97, 93, 96,
+    92, 98, 94,
+    92, 99, 98,
+    92, 97, 99,
+    94, 98, 100,
+    89, 94, 100,
+    101, 89, 102,
+    101, 85, 89,
+    103, 100, 104,
+    104, 100, 98,
+    103, 104, 105,
+    105, 104, 106,
+    104, 98, 107,
+    98, 108, 107,
+    98, 109, 108,
+    109, 98, 110,
+    110, 98, 99,
+    110, 99, 111,
+    99, 112, 111,
+    112, 99, 97,
+    112, 97, 113,
+    97, 114, 113,
+    97, 115, 114,
+    97, 116, 115,
+    97, 96, 116,
+    96, 95, 117,
+    118, 119, 120,
+    121, 118, 122,
+    118, 120, 123,
+    118, 124, 119,
+    118, 121, 124,
+    122, 118, 123,
+    124, 125, 119,
+    126, 119, 127,
+    120, 119, 126,
+    119, 125, 127,
+    128, 123, 120,
+    129, 120, 126,
+    129, 128, 120,
+    128, 130, 123,
+    130, 131, 123,
+    131, 132, 123,
+    132, 133, 123,
+    133, 134, 123,
+    122, 123, 135,
+    123, 134, 135,
+    135, 136, 137,
+    122, 135, 137,
+    137, 136, 138,
+    137, 139, 140,
+    137, 141, 142,
+    122, 137, 121,
+    137, 140, 121,
+    139, 137, 142,
+    137, 138, 141,
+    139, 143, 140,
+    143, 144, 140,
+    145, 140, 144,
+    146, 140, 145,
+    147, 140, 146,
+    148, 140, 147,
+    149, 140, 148,
+    149, 150, 140,
+    150, 124, 140,
+    151, 124, 150,
+    121, 140, 124,
+    124, 151, 125,
+    125, 151, 152,
+    127, 125, 153,
+    154, 127, 153,
+    155, 156, 157,
+    155, 158, 156,
+    159, 157, 156,
+    160, 159, 161,
+    161, 159, 156,
+    162, 161, 163,
+    163, 161, 156,
+    164, 161, 162,
+    165, 162, 166,
+    167, 162, 163,
+    167, 168, 162,
+    164, 162, 165,
+    166, 162, 168,
+    169, 167, 163,
+    169, 163, 156,
+    170, 167, 169,
+    167, 171, 172,
+    170, 173, 167,
+    167, 173, 171,
+    167, 172, 168,
+    168, 172, 174,
+    168, 174, 175,
+    166, 168, 175,
+    176, 166, 177,
+    176, 165, 166,
+    175, 178, 166,
+    179, 172, 171,
+    179, 171, 180,
+    181, 171, 173,
+    171, 181, 180,
+    181, 173, 182,
+    173, 183, 182,
+    173, 184, 183,
+    173, 170, 185,
+    170, 186, 185,
+    185, 186, 187,
+    170, 188, 186,
+    189, 188, 170,
+    156, 189, 170,
+    169, 156, 170,
+    156, 190, 189,
+    156, 158, 190,
+    191, 192, 193,
+    191, 194, 192,
+    192, 195, 196,
+    197, 193, 192,
+    192, 194, 195,
+    196, 195, 198,
+    196, 198, 199,
+    200, 201, 202,
+    200, 203, 201,
+    204, 205, 200,
+    200, 205, 203,
+    202, 201, 206,
+    207, 202, 208,
+    202, 209, 208,
+    202, 206, 209,
+    210, 211, 212,
+    210, 213, 211,
+    212, 211, 214,
+    215, 216, 217,
+    216, 218, 217,
+    216, 219, 220,
+    216, 220, 218,
+    216, 221, 219,
+    221, 222, 219,
+    223, 224, 225,
+    225, 226, 223,
+    224, 223, 227,
+    224, 227, 228,
+    224, 228, 229,
+    230, 226, 225,
+    230, 225, 231,
+    232, 233, 234,
+    232, 235, 233,
+    234, 236, 232,
+    237, 238, 239,
+    240, 237, 241,
+    242, 241, 237,
+    237, 239, 243,
+    237, 240, 238,
+    244, 238, 240,
+    244, 245, 238,
+    244, 246, 247,
+    248, 249, 246,
+    246, 250, 247,
+    246, 251, 252,
+    253, 248, 246,
+    246, 252, 250,
+    246, 254, 251,
+    255, 248, 253,
+    255, 253, 256,
+    257, 256, 253,
+    258, 249, 259,
+    258, 260, 249,
+    259, 261, 258,
+    262, 263, 264,
+    263, 265, 266,
+    263, 266, 264,
+    267, 268, 263,
+    263, 268, 265,
+    265, 269, 266,
+    265, 270, 269,
+    269, 271, 272,
+    273, 272, 271,
+    274, 272, 275,
+    272, 276, 277,
+    275, 272, 278,
+    273, 279, 272,
+    272, 279, 276,
+    280, 274, 281,
+    274, 282, 281,
+    274, 275, 282,
+    278, 283, 284,
+    278, 285, 283,
+    284, 283, 286,
+    0, 1, 2,
+    1, 0, 3,
+    0, 4, 5,
+    5, 3, 0,
+    6, 1, 3,
+    7, 3, 5,
+    8, 9, 10,
+    11, 8, 12,
+    11, 13, 8,
+    10, 14, 8,
+    8, 14, 12,
+    15, 11, 12,
+    16, 17, 18,
+    19, 16, 18,
+    19, 18, 20,
+    19, 20, 21,
+    22, 19, 23,
+    19, 21, 23,
+    24, 25, 26,
+    27, 24, 26,
+    26, 25, 28,
+    29, 28, 25,
+    28, 30, 26,
+    30, 31, 26,
+    32, 33, 34,
+    32, 35, 33,
+    36, 35, 32,
+    32, 34, 37,
+    37, 38, 32,
+    38, 39, 32,
+    35, 40, 33,
+    41, 39, 38,
+    41, 38, 42,
+    37, 43, 38,
+    44, 43, 37,
+    45, 43, 46,
+    46, 43, 44,
+    44, 47, 48,
+    47, 44, 49,
+    49, 44, 37,
+    49, 37, 50,
+    37, 51, 50,
+    37, 52, 53,
+    37, 54, 55,
+    37, 56, 52,
+    37, 34, 54,
+    37, 55, 56,
+    55, 54, 57,
+    58, 46, 59,
+    45, 46, 58,
+    60, 61, 62,
+    60, 63, 64,
+    65, 60, 62,
+    60, 64, 61,
+    60, 65, 66,
+    67, 62, 61,
+    68, 62, 67,
+    69, 62, 68,
+    70, 62, 69,
+    71, 62, 70,
+    65, 62, 72,
+    73, 72, 62,
+    71, 73, 62,
+    74, 75, 72,
+    72, 76, 74,
+    72, 73, 76,
+    77, 72, 75,
+    78, 65, 72,
+    79, 75, 80,
+    79, 77, 75,
+    81, 82, 65,
+    82, 83, 65,
+    84, 81, 65,
+    85, 65, 78,
+    65, 83, 66,
+    86, 84, 65,
+    85, 87, 65,
+    87, 88, 65,
+    88, 86, 65,
+    81, 89, 82,
+    90, 91, 92,
+    90, 93, 91,
+    94, 92, 91,
+    95, 94, 96,
+    96, 94, 91,
+    97, 96, 91,
+    98, 96, 97,
+    99, 97, 100,
+    97, 101, 102,
+    100, 97, 102,
+    98, 97, 99,
+    91, 103, 97,
+    104, 97, 103,
+    105, 99, 100,
+    105, 100, 106,
+    102, 107, 100,
+    103, 108, 109,
+    103, 110, 108,
+    104, 103, 111,
+    112, 103, 109,
+    103, 112, 111,
+    103, 91, 113,
+    114, 115, 91,
+    113, 91, 116,
+    91, 117, 114,
+    91, 93, 117,
+    118, 119, 120,
+    120, 121, 118,
+    121, 122, 118,
+    120, 119, 123,
+    120, 123, 124,
+    120, 124, 125,
+    126, 120, 125,
+    126, 127, 120,
+    127, 128, 120,
+    129, 120, 128,
+    130, 120, 129,
+    131, 120, 130,
+    132, 120, 131,
+    133, 120, 132,
+    133, 134, 120,
+    134, 121, 120,
+    135, 121, 134,
+    121, 135, 136,
+    137, 121, 138,
+    139, 121, 137,
+    140, 122, 121,
+    141, 142, 121,
+    142, 143, 121,
+    144, 121, 139,
+    143, 140, 121,
+    144, 145, 121,
+    145, 141, 121,
+    146, 137, 138,
+    147, 148, 149,
+    147, 150, 148,
+    148, 151, 152,
+    153, 149, 148,
+    148, 150, 151,
+    152, 151, 154,
+    152, 154, 155,
+    156, 157, 158,
+    156, 159, 157,
+    160, 161, 156,
+    156, 161, 159,
+    158, 157, 162,
+    163, 158, 164,
+    158, 165, 164,
+    158, 162, 165,
+    166, 167, 168,
+    166, 169, 167,
+    168, 167, 170,
+    171, 172, 173,
+    172, 174, 173,
+    172, 175, 176,
+    172, 176, 174,
+    172, 177, 175,
+    177, 178, 175,
+    179, 180, 181,
+    181, 182, 179,
+    180, 179, 183,
+    180, 183, 184,
+    180, 184, 185,
+    186, 182, 181,
+    186, 181, 187,
+    188, 189, 190,
+    188, 191, 189,
+    190, 192, 188,
+    193, 194, 195,
+    196, 193, 197,
+    198, 197, 193,
+    193, 195, 199,
+    193, 196, 194,
+    200, 194, 196,
+    200, 201, 194,
+    202, 203, 204,
+    205, 202, 204,
+    206, 202, 205,
+    207, 203, 208,
+    207, 209, 203,
+    208, 210, 207,
+    206, 205, 211,
+    212, 211, 205,
+    204, 213, 214,
+    204, 214, 215,
+    204, 216, 213,
+    217, 218, 219,
+    218, 220, 221,
+    218, 221, 219,
+    222, 223, 218,
+    218, 223, 220,
+    220, 224, 221,
+    220, 225, 224,
+    226, 227, 228,
+    229, 226, 230,
+    226, 231, 230,
+    226, 228, 231,
+    227, 232, 233,
+    228, 227, 234,
+    235, 236, 227,
+    227, 236, 232,
+    234, 237, 238,
+    234, 239, 237,
+    238, 237, 240,
+};
+#define mesh_lods_count 4
+static const int mesh_lods[][4] = {
+    {0, 720, 0, 1152},
+    {720, 432, 3456, 576},
+    {1152, 287, 5184, 288},
+    {1439, 241, 6048, 204},
+};
+static const float mesh_lod_errors[] = {
+    0.000000,
+    0.084067,
+    0.175787,
+    0.433798,
+};
+#endif // OBJ_H_
@@ -0,0 +1,593 @@
+#ifndef TSODINCUP_H_
+#define TSODINCUP_H_
+size_t tsodinCup_width = 64;
+size_t tsodinCup_height = 64;
+uint32_t tsodinCup_pixels[] = {
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x01000000,0x01000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x02000000,0x02000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00020000,0x00020000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000002,0x00000002,0x00000002,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00363537,0x00363537,0x00343537,0x00343537,0x00363636,
+   0x00383536,0x003A3634,0x003A3634,0x007D7C7A,0x007D7C7A,0x007D7C7A,0x007D7C7A,
+   0x007C7B79,0x007F7D7B,0x007A7B79,0x007B7B7B,0x00949095,0x00949095,0x00939196,
+   0x00939294,0x00949494,0x00939393,0x00939491,0x00929290,0x00959996,0x00949795,
+   0x00949795,0x00959996,0x00959996,0x00959996,0x00979A97,0x00999997,0x00858585,
+   0x00878485,0x00858585,0x00858585,0x00858585,0x00858585,0x00858585,0x00858585,
+   0x004D494C,0x004D494C,0x004B4A4C,0x004B4A4C,0x00484B4B,0x00484B4B,0x00484C49,
+   0x00484C49,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,
+   0x00020202,0x00020202,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00363537,0x00363439,0x00343537,0x00343537,
+   0x00363636,0x00383536,0x003A3634,0x003A3634,0x007D7C7A,0x007D7C7A,0x007D7C7A,
+   0x007D7C7A,0x007C7B79,0x007C7B79,0x007B7C7A,0x007A7A7A,0x00959196,0x00959196,
+   0x00939196,0x00939294,0x00939393,0x00959293,0x00959391,0x00939491,0x00959996,
+   0x00959996,0x00959996,0x00959996,0x00959996,0x00959996,0x00959996,0x00999997,
+   0x00858585,0x00878485,0x00858585,0x00858585,0x00848484,0x00848484,0x00848484,
+   0x00848484,0x004B4A4C,0x004B4A4C,0x004B4A4C,0x004B4B4B,0x00484B4B,0x00484C49,
+   0x00484C49,0x00484C49,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,
+   0x00020202,0x00020202,0x00020202,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00363537,0x00363537,0x00343537,
+   0x00343537,0x00343636,0x00363636,0x00383536,0x00383536,0x007B7B7B,0x007B7B7B,
+   0x007D7B7B,0x007F7B7B,0x007F7B7B,0x007C7A7A,0x04000000,0x0E010101,0x19020002,
+   0x28020002,0x38020002,0x43020002,0x4D020000,0x56040000,0x5E040000,0x63020000,
+   0x68000000,0x6B000100,0x68000000,0x61000000,0x5A000000,0x51000000,0x40000000,
+   0x31000000,0x22000000,0x12000000,0x06000000,0x01000000,0x00838585,0x00838585,
+   0x00838585,0x00838585,0x00484B4B,0x004B4B4B,0x004B4B4B,0x004B4B49,0x004B4B49,
+   0x004B4C47,0x004B4C47,0x004B4B49,0x00020202,0x00020202,0x00020202,0x00020202,
+   0x00020202,0x00020202,0x00020202,0x00020202,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00363537,0x00363537,
+   0x00343537,0x00343537,0x00343636,0x00363636,0x00363636,0x00363636,0x03000002,
+   0x10000002,0x27000002,0x46000002,0x68000002,0x8C000002,0xAF000002,0xC8000000,
+   0xD9000002,0xE7000004,0xF2000307,0xF7010506,0xFA060A0C,0xFD090D0E,0xFE090F11,
+   0xFF0B1213,0xFF0B1617,0xFF0C1718,0xFF0E1718,0xFF0D1617,0xFE091213,0xFB080E10,
+   0xF602080A,0xEE000506,0xE2000002,0xCF000002,0xB6000002,0x96000002,0x6A000002,
+   0x3F000002,0x1B000002,0x04000000,0x00484B4B,0x00484B4B,0x004B4B4B,0x004B4B49,
+   0x004B4B49,0x004B4C47,0x004B4C47,0x004B4B49,0x00020202,0x00020202,0x00020202,
+   0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00353737,
+   0x00343636,0x00343434,0x00343434,0x00363537,0x0F000002,0x42000000,0x7A000002,
+   0xA7000002,0xCB000003,0xE6000003,0xF8000508,0xFF091316,0xFF162527,0xFF2C4041,
+   0xFF425859,0xFF5A6E6F,0xFF6E8185,0xFF85989C,0xFF90A6A9,0xFF98AEB1,0xFF9EB6B9,
+   0xFFA1BBC0,0xFFA6BFC4,0xFFA7C0C5,0xFFADC5CA,0xFFADC5CA,0xFFACC1C7,0xFFA7BCC2,
+   0xFFAABDC3,0xFFA4B4BB,0xFF96A7AB,0xFF839395,0xFF69787A,0xFF4F5C5E,0xFF334042,
+   0xFE172124,0xF4040C0F,0xDA000206,0xAA000002,0x70000002,0x37000002,0x10000002,
+   0x01000201,0x00484B4B,0x00484C49,0x00474B48,0x00484C49,0x00010101,0x00030303,
+   0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00353737,0x00343636,0x00343434,0x17010101,0x68000002,0xC0000103,0xF4000304,
+   0xFF070F12,0xFF273036,0xFF465459,0xFF6B7C80,0xFF8C9FA3,0xFFA7BDC0,0xFFBAD0D3,
+   0xFFC7DFE2,0xFFCFE7EA,0xFFD6ECEF,0xFFD6ECEF,0xFFD3EBEE,0xFFCFEAEC,0xFFCAE9ED,
+   0xFFC8E9ED,0xFFC5E8ED,0xFFC4E9EF,0xFFC6E9EF,0xFFC9EAF0,0xFFC9EAF0,0xFFCAE8EF,
+   0xFFCFEAF1,0xFFD5EEF6,0xFFE0F9FF,0xFFE3FAFF,0xFFE6FCFF,0xFFE7FAFE,0xFFE5F8FC,
+   0xFFD8EBEF,0xFFC1D2D6,0xFFA5B4B8,0xFF7B878C,0xFF4C565B,0xFE232B2E,0xF0081013,
+   0xC9000104,0x8C000002,0x45000000,0x12000201,0x00484B4B,0x00484B4B,0x00020202,
+   0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00343533,0x12010200,0x68000000,0xCB000100,0xFC000707,0xFF283636,
+   0xFF6A7E80,0xFFA1B8B9,0xFFBDD7DA,0xFFCAE6EB,0xFFCAE9ED,0xFFCBEAEE,0xFFCCE8ED,
+   0xFFD5ECF2,0xFFE0F0F6,0xFFE9F7FC,0xFFECF9FB,0xFFEEFBFE,0xFFE7F8FA,0xFFDDF2F6,
+   0xFFD2EBF0,0xFFC9E8EC,0xFFC4E6EC,0xFFC2E7EC,0xFFC2E7EC,0xFFC2E7EC,0xFFC6E9EF,
+   0xFFC9EAF0,0xFFCDEAF1,0xFFD4F0F7,0xFFE0F9FF,0xFFE1F7FF,0xFFE3FAFF,0xFFE2F9FE,
+   0xFFE1F8FD,0xFFDCF3F9,0xFFD4EEF3,0xFFD1EAEF,0xFFD1EAEF,0xFFCAE3E8,0xFFBFD6DB,
+   0xFF9CB4B7,0xFF6D8386,0xFF394B4D,0xF50E1A1D,0xC9000304,0x77000002,0x23000103,
+   0x01020202,0x00030303,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,
+   0x00020202,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x1E010200,0xB0000000,0xFC000607,0xFF283235,0xFF7E9091,
+   0xFFC0D5D9,0xFFCBE8EA,0xFFCBEBEC,0xFFC7E8EC,0xFFC5E8EC,0xFFC3E6E9,0xFFC5E8EC,
+   0xFFCAE6EB,0xFFDFF4FA,0xFFEFFCFF,0xFFF5FFFF,0xFFF7FFFF,0xFFF6FFFF,0xFFF1FFFF,
+   0xFFEBFEFF,0xFFD6F0F5,0xFFC9E8EC,0xFFC3E5EB,0xFFC1E6EB,0xFFC2E7EC,0xFFC7EAF0,
+   0xFFCDEDF3,0xFFCEEEF4,0xFFD5F2F9,0xFFDAF6FD,0xFFE0F9FF,0xFFE0F9FF,0xFFE2F8FF,
+   0xFFE2F8FF,0xFFE2F8FF,0xFFDDF6FE,0xFFCFEDF3,0xFFC8E8EF,0xFFC5E5EB,0xFFC6E6EC,
+   0xFFC6E6EC,0xFFC7E8EC,0xFFCAEAEB,0xFFC9E3E6,0xFFABC0C4,0xFF65767A,0xFE162227,
+   0xDC000104,0x7F000000,0x1E070707,0x00020202,0x00010101,0x00020202,0x00020202,
+   0x00020202,0x00020202,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x07000000,0x9F000000,0xFF000809,0xFF607075,0xFFBED5DA,
+   0xFFCDE9F0,0xFFC8E6EC,0xFFC6E6EC,0xFFC4E6EC,0xFFC7E7ED,0xFFC6E6EC,0xFFC9E8EC,
+   0xFFCDEAEC,0xFFD3EBEE,0xFFDFF2F6,0xFFEEFAFF,0xFFF1FBFF,0xFFEDF8FF,0xFFEBF9FF,
+   0xFFE5F7FD,0xFFE1F6FC,0xFFD1ECF3,0xFFC8E6EC,0xFFC4E6EC,0xFFC4E6EC,0xFFC9E7ED,
+   0xFFD0EBF2,0xFFD9F4FB,0xFFDBF7FE,0xFFDEF9FF,0xFFE0F9FF,0xFFE0F9FF,0xFFE2F8FF,
+   0xFFE5F8FF,0xFFE4F7FF,0xFFE2F7FF,0xFFDCF4FE,0xFFCEEBF4,0xFFC7E6EF,0xFFC4E6EE,
+   0xFFC4E6EE,0xFFC6E5EE,0xFFC6E6EC,0xFFC4E7EB,0xFFC4E7EB,0xFFC9EAF0,0xFFCDE9F0,
+   0xFFAFC6CB,0xFF627475,0xFE131C1B,0xCF000201,0x4D000000,0x03000002,0x001D1D1D,
+   0x001D1D1D,0x001D1E1C,0x001B1E1C,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x34000000,0xEC000000,0xFF454E4E,0xFFCDE1E4,
+   0xFFCCE8EF,0xFFC6E5EE,0xFFC5E6F1,0xFFC2E6EE,0xFFC3E7EF,0xFFC4E6EE,0xFFC8E8EF,
+   0xFFD1F0F4,0xFFD9F6F8,0xFFE1F9FC,0xFFDFF5F8,0xFFDDEEF2,0xFFD9EAEE,0xFFD6E7F0,
+   0xFFD4E8F0,0xFFD0E7EF,0xFFCCE5EC,0xFFCAE8EF,0xFFC5E5EB,0xFFC5E8ED,0xFFCBEBF1,
+   0xFFD2EDF4,0xFFDCF5FD,0xFFE0F9FF,0xFFDFF7FF,0xFFE0F9FF,0xFFE0F9FF,0xFFE0F9FF,
+   0xFFE2F8FF,0xFFE4F8FF,0xFFE4F7FF,0xFFE2F7FF,0xFFDDF5FF,0xFFCEEBF4,0xFFC8E8F0,
+   0xFFC5E7EF,0xFFC2E6EE,0xFFC4E5EF,0xFFC4E6EE,0xFFC2E7EC,0xFFC0E8EB,0xFFC1E5ED,
+   0xFFC4E6EE,0xFFCAE8EF,0xFFD2E8EB,0xFFA6B1B1,0xFF1E2322,0xE9000103,0x3E000002,
+   0x001D1D1D,0x001D1D1D,0x001B1D1D,0x001B1D1D,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x62000000,0xFF000002,0xFF191F23,
+   0xFF94A3A5,0xFFCBE2E7,0xFFCDEAF1,0xFFC5E7EF,0xFFC3E7EF,0xFFC3E7EF,0xFFC2E7EC,
+   0xFFC3E8ED,0xFFCBEBF1,0xFFD0EEF4,0xFFD2EDF4,0xFFD0EBF2,0xFFCDEAEE,0xFFCBE6ED,
+   0xFFC9E7ED,0xFFC9E6EF,0xFFC9E6EF,0xFFC6E5EE,0xFFC4E6EE,0xFFC4E6EE,0xFFC2E6EE,
+   0xFFCBEAF2,0xFFD8F2FC,0xFFE2F7FF,0xFFE2F7FF,0xFFE2F7FF,0xFFE2F7FF,0xFFE2F7FF,
+   0xFFE2F7FF,0xFFE2F8FF,0xFFE2F8FF,0xFFE2F8FF,0xFFE0F9FF,0xFFDBF7FE,0xFFD0EEF4,
+   0xFFC9EAF0,0xFFC5E7EF,0xFFC1E5ED,0xFFC2E6EE,0xFFC2E6EE,0xFFC0E6EE,0xFFC2E6EE,
+   0xFFC4E6EE,0xFFC6E5EE,0xFFCAE8EF,0xFFCDE5E8,0xFF8F9C9E,0xFF12191A,0xFC000002,
+   0x54000002,0x001D1D1D,0x001D1D1D,0x001B1D1D,0x001B1D1F,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x56000002,0xFC000004,
+   0xFF050918,0xFF010C23,0xFF374760,0xFF8397AB,0xFFBBD3E3,0xFFCAE6F2,0xFFC9EAF0,
+   0xFFC7E7ED,0xFFC7E7ED,0xFFC6E6EC,0xFFC6E6EC,0xFFC6E6EC,0xFFC7E7ED,0xFFC4E6EC,
+   0xFFC3E5EB,0xFFC4E6EE,0xFFC4E6EE,0xFFC4E6EE,0xFFC1E5ED,0xFFC2E6EE,0xFFC2E6EE,
+   0xFFC3E7EF,0xFFCEEDF6,0xFFDCF4FE,0xFFE2F7FF,0xFFE2F7FF,0xFFE1F6FF,0xFFE2F7FF,
+   0xFFE2F7FF,0xFFE2F7FF,0xFFE2F8FF,0xFFE1F8FD,0xFFE2F9FE,0xFFE0F9FE,0xFFDDF8FF,
+   0xFFD6F4FA,0xFFCDEDF3,0xFFC6E8F0,0xFFC4E6EE,0xFFC4E6EE,0xFFC4E6EE,0xFFC4E6EC,
+   0xFFC6E6EC,0xFFC9E6EF,0xFFCCE4EE,0xFFABC1CB,0xFF546472,0xFF010B1E,0xFF020616,
+   0xF9000005,0x49000000,0x001D1D1D,0x001D1D1D,0x001B1D1D,0x001B1D1F,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x3B000003,
+   0xF300000C,0xFF282A4E,0xFF383C7B,0xFF060E4F,0xFF00002D,0xFF1B2644,0xFF5C6D7D,
+   0xFF98ACB4,0xFFBDD3DB,0xFFCBE4EB,0xFFCFEAF1,0xFFC8E8EF,0xFFC6E9EF,0xFFC5E8ED,
+   0xFFC3E8ED,0xFFC0E4EB,0xFFC1E6EB,0xFFC2E7EC,0xFFC2E7EC,0xFFC2E7EC,0xFFC2E7EC,
+   0xFFC2E7EC,0xFFC9EBF1,0xFFD4F4FA,0xFFE0F9FF,0xFFE1F7FF,0xFFE2F8FF,0xFFE1F7FF,
+   0xFFE2F8FF,0xFFE2F8FF,0xFFE2F8FF,0xFFE3F9FF,0xFFE1F9FC,0xFFE2FAFD,0xFFE0FAFD,
+   0xFFDEFAFE,0xFFD6F4FA,0xFFCEEEF4,0xFFC8E8F0,0xFFC8E8F0,0xFFC8E7F2,0xFFC9E9F1,
+   0xFFCBE7EC,0xFFC3DDE0,0xFF9EB1B5,0xFF56666E,0xFF101927,0xFF000016,0xFF191949,
+   0xFF2C2B56,0xF500000B,0x3E000002,0x001D1D1D,0x001B1D1D,0x001B1D1D,0x001B1D1D,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x28000005,0xE800000D,0xFF1E214F,0xFF5154AA,0xFF494BAC,0xFF383784,0xFF131651,
+   0xFF00002C,0xFF000426,0xFF162240,0xFF414F68,0xFF6E8296,0xFF91AAB8,0xFFACC9D2,
+   0xFFBDDAE3,0xFFC6E2EB,0xFFCAE7F0,0xFFCBEBF1,0xFFC9EAEE,0xFFC9EAEE,0xFFC8E9ED,
+   0xFFCAE9ED,0xFFCBEAEE,0xFFCDEBEF,0xFFD6F2F6,0xFFDCF3F9,0xFFE4F6FC,0xFFE6F8FE,
+   0xFFE5F7FD,0xFFE7F9FF,0xFFE7F9FF,0xFFE7F9FF,0xFFE7F9FF,0xFFE7FBFC,0xFFE7FBFC,
+   0xFFE6FDFE,0xFFE6FCFF,0xFFE1F8FD,0xFFD6EFF7,0xFFCCE4EE,0xFFBFD6E3,0xFFA8BECD,
+   0xFF8198A6,0xFF576B7A,0xFF253646,0xFF00081D,0xFF000016,0xFF00002D,0xFF292861,
+   0xFF535095,0xFF24205A,0xED000010,0x31020002,0x001D1D1D,0x001B1D1D,0x001B1D1D,
+   0x001B1D1D,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x17000003,0xD600000A,0xFF101341,0xFF4A4DAF,0xFF4649C1,0xFF4A4ABC,
+   0xFF4A4BB3,0xFF3D41A0,0xFF272B7F,0xFF0D1157,0xFF000039,0xFF000027,0xFF000121,
+   0xFF0A172E,0xFF223141,0xFF3E4B5B,0xFF55646F,0xFF6F7F85,0xFF849599,0xFF94A5A9,
+   0xFFA2B3B7,0xFFAFC2C6,0xFFB8CCCF,0xFFBED2D5,0xFFC2D5D9,0xFFC7D5DA,0xFFCBD7DC,
+   0xFFD1DDE2,0xFFD5E1E6,0xFFD6E2E7,0xFFD6E2E7,0xFFD2DEE3,0xFFCEDADD,0xFFCAD5D6,
+   0xFFC1CCCC,0xFFADBABC,0xFF9CA8AC,0xFF848F97,0xFF637079,0xFF3E4A55,0xFF222D3B,
+   0xFF050D23,0xFF000018,0xFF00001D,0xFF00002A,0xFF010845,0xFF1D236F,0xFF3C3FA1,
+   0xFF4C4FB3,0xFF4F50A4,0xFF0E0C48,0xDA000010,0x1A030003,0x001D1D1D,0x001B1D1D,
+   0x001B1D1D,0x001B1D1F,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x07000003,0xB6000008,0xFF04042D,0xFF4244A5,0xFF4345C5,
+   0xFF4446C7,0xFF4345C5,0xFF4648C2,0xFF4B4BBD,0xFF4D4AB1,0xFF48469F,0xFF3B3A88,
+   0xFF2D2E6F,0xFF171B53,0xFF090C3E,0xFF000231,0xFF000025,0xFE00001B,0xFE00001A,
+   0xFF00001C,0xFF000523,0xFF020B27,0xFF08112D,0xFF0A162F,0xFF101C35,0xFF121B35,
+   0xFF161D37,0xFF19213B,0xFF181F3A,0xFF181F3A,0xFF181F3A,0xFF141B35,0xFF0F172F,
+   0xFF0A1026,0xFF030A1E,0xFF000218,0xFF000015,0xFF000015,0xFF000018,0xFF000221,
+   0xFF080B31,0xFF1B1C4E,0xFF2F306B,0xFF3B3D83,0xFF444395,0xFF484BA8,0xFF494DBA,
+   0xFF4447C6,0xFF4649BF,0xFF45469C,0xFF000037,0xC000000E,0x0A000000,0x001D1D1D,
+   0x001D1D1D,0x001B1D1F,0x001B1D1F,0x003C3E3E,0x003C3E3E,0x003C3E3E,0x003C3E3E,
+   0x003B3E3B,0x003B3E3B,0x00413E3F,0x00403C3F,0x8F010004,0xFF00001E,0xFF3B3B92,
+   0xFF484ABE,0xFF4749C4,0xFF4346C3,0xFF4146C5,0xFF4345C5,0xFF4847C4,0xFF4A47C2,
+   0xFF4C48BF,0xFF4C4ABC,0xFF4A49B7,0xFF4748B3,0xFF4243AB,0xFF3E3EA2,0xFD383694,
+   0xFC312E88,0xFF29277E,0xFF1E1F73,0xFF171A69,0xFF131764,0xFF0D125C,0xFF0A0F57,
+   0xFF090F54,0xFF0A0D53,0xFF080C52,0xFF080C52,0xFF080C52,0xFF0B0E54,0xFF0D1157,
+   0xFF0F1457,0xFF151958,0xFF1B1F5C,0xFF252968,0xFF303374,0xFF3A3C80,0xFF4A4C92,
+   0xFF6363AC,0xFF7171C3,0xFF6566C8,0xFF4C4EBB,0xFF4A4ABC,0xFF4849BF,0xFF4847C2,
+   0xFF4545C5,0xFF4343C9,0xFF4A49BE,0xFF3C3D86,0xFF000021,0x9D00000B,0x01010003,
+   0x000C0A0A,0x000C0A0A,0x000A0A0A,0x00080B0A,0x003E3E3E,0x003C3E3E,0x003C3E3E,
+   0x003C3E3E,0x003B3D3D,0x003D3E42,0x003E3A44,0x0702000E,0x7E000010,0xFF000020,
+   0xFF14156B,0xFF292B98,0xFF292DA1,0xFF2E32AC,0xFF3C40C1,0xFF4143C9,0xFF4342CB,
+   0xFF4341CC,0xFF4341CC,0xFF4342CB,0xFF4241CA,0xFF4241CA,0xFF4343C9,0xFF4746CA,
+   0xFF4A46C4,0xFF4C47C1,0xFF4C48BF,0xFF4C49BE,0xFF4B4AB9,0xFF4B4AB8,0xFF4B4BB6,
+   0xFF4B4CB5,0xFF4A4CB2,0xFF494AB1,0xFF494AB1,0xFF494AB1,0xFF494AB1,0xFF494AB1,
+   0xFF4B4DB3,0xFF4E51B5,0xFF7073CF,0xFF7E81DC,0xFF898CE9,0xFF9395F4,0xFF9A9AFE,
+   0xFF9E9EFF,0xFF9998FF,0xFF7B79E9,0xFF4F50CD,0xFF4343C9,0xFF4245CA,0xFF4143CB,
+   0xFF4443CC,0xFF4341CC,0xFF4341CC,0xFF4C4ABC,0xFF323373,0xFF000016,0x6E000009,
+   0x000A0A0A,0x000C0A0A,0x000C0A0A,0x000A0A0A,0x00080B0A,0x00403C3F,0x003E3D3F,
+   0x003E3E3E,0x003E3D3F,0x003C3C41,0x0800000B,0x57000016,0xBA000027,0xED080642,
+   0xFF0F0F5A,0xFF181B7D,0xFF1F2490,0xFF202596,0xFF22279F,0xFF393DBE,0xFF3F44C9,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4241CA,0xFF4240CB,
+   0xFF4342CB,0xFF4243C7,0xFF4544C6,0xFF4544C6,0xFF4646C6,0xFF4545C5,0xFF4545C5,
+   0xFF4545C5,0xFF4545C5,0xFF4546C3,0xFF4546C3,0xFF4546C3,0xFF4647C4,0xFF4647C4,
+   0xFF4546C3,0xFF4647C4,0xFF494CC4,0xFF6368D9,0xFF6B6FDC,0xFF7073E2,0xFF6D6FE3,
+   0xFF6667DE,0xFF5B5BD4,0xFF4E4DC8,0xFF4545C5,0xFF4344C8,0xFF4042C8,0xFF4143C9,
+   0xFF4041CA,0xFF4342CB,0xFF4341CC,0xFF4540CE,0xFF4B49BB,0xFF21225B,0xF5000010,
+   0x41000005,0x000C0C0C,0x000C0A0A,0x000C0A0A,0x000A0A0C,0x00080A0C,0x00403D3E,
+   0x003E3E3E,0x003E3E3E,0x003C3C42,0x1400000E,0x95000021,0xF6191551,0xFF3A3783,
+   0xFF48489A,0xFF4B4DAA,0xFF494CB6,0xFF484BBC,0xFF484BBC,0xFF4649BF,0xFF4347C1,
+   0xFF4146C5,0xFF4345C5,0xFF4345C5,0xFF4145C6,0xFF4144C8,0xFF4143C9,0xFF4244CC,
+   0xFF4243CE,0xFF4143CB,0xFF4041CA,0xFF4143C9,0xFF4042C8,0xFF4143C9,0xFF4143CB,
+   0xFF4143CB,0xFF4244CC,0xFF4244CC,0xFF4041CA,0xFF4041CA,0xFF4143CB,0xFF4244CC,
+   0xFF4041CA,0xFF4143CB,0xFF4143CB,0xFF4245CA,0xFF4043C2,0xFF4245C2,0xFF3F43BF,
+   0xFF4043C2,0xFF4042C4,0xFF4041C5,0xFF4041C7,0xFF4343C9,0xFF4041CA,0xFF4244CC,
+   0xFF4143C9,0xFF4041CA,0xFF4240CB,0xFF4541CC,0xFF4542CB,0xFF4C4AB5,0xFF101244,
+   0xDD00000A,0x1E000004,0x000A0A0A,0x000C0A0A,0x000C0A0A,0x000A0A0C,0x00080A0C,
+   0x003E3F3C,0x003E3F3C,0x003C3E3E,0x0C00000D,0x9B00002E,0xFE2A2A75,0xFF4B49AE,
+   0xFF4D4BB6,0xFF5B5ABA,0xFF6868CC,0xFF5252C6,0xFF4947C0,0xFF4948BE,0xFF494BBF,
+   0xFF474AB9,0xFF474BB8,0xFF4A4CB9,0xFF494AB9,0xFF4747C0,0xFF4444C3,0xFF4344C8,
+   0xFF4143C9,0xFF4143C9,0xFF4143C9,0xFF4143C9,0xFF4342CB,0xFF4342CB,0xFF4342CB,
+   0xFF4343C9,0xFF4343C9,0xFF4343C9,0xFF4343C9,0xFF4342CB,0xFF4342CB,0xFF4342CB,
+   0xFF4342CB,0xFF4342CB,0xFF4342CB,0xFF4342CB,0xFF4342CB,0xFF4343C9,0xFF4343C9,
+   0xFF4343C9,0xFF4343C9,0xFF4343C9,0xFF4343C9,0xFF4343C9,0xFF4343C9,0xFF4143CB,
+   0xFD3F43CB,0xFF3F44C9,0xFF4143CB,0xFF4341CC,0xFF4643CC,0xFF4845C7,0xFF4140A2,
+   0xFF01012A,0xB2000005,0x07010003,0x00090909,0x000C0A0A,0x000C0A0A,0x000A0A0C,
+   0x000A0A0C,0x003D3D3B,0x003C3E3E,0x003A3D41,0x69000013,0xFA21216A,0xFF4D4CB3,
+   0xFF4847BB,0xFF6060D2,0xFFA5A5FF,0xFF9D9DF3,0xFF6260C0,0xFF4341A6,0xFF323298,
+   0xFF23228B,0xFF15177D,0xFF0F1178,0xFF0D0F75,0xFF11117C,0xFF1E1C93,0xFF3B3AB7,
+   0xFF4344C8,0xFF4143C9,0xFF3F45C8,0xFF3F45C8,0xFF4143C9,0xFF4342CB,0xFF4342CB,
+   0xFF4342CB,0xFF4343C9,0xFF4343C9,0xFF4343C9,0xFF4343C9,0xFF4343C9,0xFF4342CB,
+   0xFF4342CB,0xFF4342CB,0xFF4342CB,0xFF4342CB,0xFF4342CB,0xFF4342CB,0xFF4342CB,
+   0xFF4342CB,0xFF4342CB,0xFF4342CB,0xFF4343C9,0xFF4343C9,0xFF4343C9,0xFF4143C9,
+   0xFF3F43CB,0xFF3F43CB,0xFF3F43CB,0xFF4143CB,0xFF4241CA,0xFF4442C7,0xFF4849BF,
+   0xFF2F3086,0xFF00001B,0x77010006,0x0008070A,0x000A0A0A,0x000C0A0A,0x000C0A0A,
+   0x000A0A0A,0x000A0A0A,0x003C3E3E,0x003A3E3F,0x15000008,0xCB03032C,0xFF42419C,
+   0xFF4C4ABC,0xFF5B5BC6,0xFFA9A9FF,0xFF8E8ED7,0xFF393871,0xFF131544,0xFF000233,
+   0xFF00003D,0xFF040355,0xFF121370,0xFF191B81,0xFF212390,0xFF2B2DA1,0xFF3837B2,
+   0xFF4040C1,0xFF4343C9,0xFF4143C9,0xFF3F44C9,0xFF3F44C9,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143C9,0xFF4143C9,
+   0xFF4143C9,0xFF4143C9,0xFF4143C9,0xFF4143C9,0xFF4143C9,0xFF4143C9,0xFF4143C9,
+   0xFF4143C9,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF3F43CB,0xFF3F43CB,0xFF3D43CB,0xFF3F43CB,0xFF4143CB,0xFF4342CB,0xFF4546C3,
+   0xFF464BB5,0xFF141963,0xF2000013,0x3D020003,0x000B080B,0x000C0A0A,0x000A0A0A,
+   0x000A0B09,0x000C0C07,0x000C0C07,0x003A3E3E,0x003A3D41,0x2B000009,0xEA080934,
+   0xFF4847A9,0xFF4846BD,0xFF6A6BD4,0xFF7C7DD1,0xFF242158,0xF4000019,0xE800000D,
+   0xFF000013,0xFF2F2F65,0xFF504E9E,0xFF4D4EB0,0xFF4B4CBC,0xFF4849BF,0xFF4647C4,
+   0xFF4544C6,0xFF4343C9,0xFF4342CB,0xFF4143CB,0xFF3F44C9,0xFF3F44C9,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143C9,0xFF4143C9,0xFF4143C9,0xFF4143C9,0xFF4143C9,0xFF4143C9,0xFF4143C9,
+   0xFF4143C9,0xFF3F44C9,0xFF3F44C9,0xFF3F43CB,0xFF3F43CB,0xFF3F43CB,0xFF3F43CB,
+   0xFF3F43CB,0xFF3F43CB,0xFF3F43CB,0xFF3F43CB,0xFF3F43CB,0xFF4143CB,0xFF4040C9,
+   0xFF4746C1,0xFF4548A4,0xFF040742,0xCE00000E,0x14050003,0x000B080B,0x000C090C,
+   0x000A0A0A,0x000A0B09,0x000C0C07,0x000C0C07,0x002F3131,0x002C3031,0x1D000006,
+   0xDC000024,0xFF3A3C94,0xFF4B4BBD,0xFF4C4DBD,0xFF35368A,0xF7000021,0x6C000008,
+   0x5E000003,0xF900000E,0xFF211F5A,0xFF5150AB,0xFF4948BD,0xFF4545C5,0xFF4345C6,
+   0xFF4343C9,0xFF4342CB,0xFF4342CB,0xFF4341CC,0xFF4143CB,0xFF4143C9,0xFF4143C9,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143C9,0xFF4143C9,0xFF4143C9,0xFF4143CB,
+   0xFF4341CC,0xFF4B4AC0,0xFF3A3A85,0xFF000021,0x9100000A,0x00020000,0x00020002,
+   0x00000002,0x00000000,0x00000100,0x00000100,0x00000100,0x00302F31,0x002F3033,
+   0x05000003,0xA7000013,0xFF1A1D65,0xFF4A4CB0,0xFF474AB9,0xFF23237C,0xC6000016,
+   0x0E040002,0x1B030101,0xD700000D,0xFF050239,0xFF45459E,0xFF4646BF,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4142CC,0xFF4142CC,0xFF4341CC,0xFF4341CC,0xFF4143CB,
+   0xFF4143C9,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143C9,0xFF4143C9,0xFF4143C9,
+   0xFF4143C9,0xFF4241CA,0xFF4B4AB9,0xFF211F5A,0xF6000013,0x49000006,0x00020000,
+   0x00000002,0x00000002,0x00000000,0x00000000,0x00000100,0x00000100,0x00343035,
+   0x00312F34,0x002F3034,0x4C00000F,0xF4000131,0xFF424592,0xFF4B4EB8,0xFF2D2F8F,
+   0xC3000021,0x0D000006,0x0028242A,0x9500000B,0xFF00001C,0xFF323176,0xFF494CBD,
+   0xFF4143C9,0xFF4143CB,0xFF4143CB,0xFF4142CC,0xFF4142CC,0xFF4341CC,0xFF4341CC,
+   0xFF4143CB,0xFF4143C9,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4342CB,0xFF4342CB,
+   0xFF4143C9,0xFF4144C8,0xFF4446C7,0xFF4444A8,0xFF080634,0xCC00000A,0x14000003,
+   0x00020000,0x00000002,0x00000002,0x00000000,0x00000000,0x00000100,0x00000100,
+   0x00343035,0x00332F34,0x00313033,0x09000007,0xA9000012,0xFF22245C,0xFF4B4EB1,
+   0xFF4445A6,0xF3080A3C,0x4900000E,0x0025222C,0x45010008,0xF300000E,0xFF15164A,
+   0xFF494AB1,0xFF4044C5,0xFF4143C9,0xFF4143CB,0xFF4142CC,0xFF4142CC,0xFF4341CC,
+   0xFF4341CC,0xFF4143CB,0xFF4143C9,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4342CB,
+   0xFF4342CB,0xFF4143C9,0xFF4345C5,0xFF484ABE,0xFF2E2F83,0xFF00001A,0x86000003,
+   0x00020002,0x00020000,0x00000002,0x00000002,0x00000000,0x00000000,0x00000100,
+   0x00000100,0x00333033,0x00333033,0x00333033,0x00312F34,0x3D00000A,0xEC03022D,
+   0xFF3E3D98,0xFF4F50B2,0xFF262865,0xAE000018,0x0800000A,0x0D010004,0xBF000006,
+   0xFF000022,0xFF3B3D96,0xFF474AC2,0xFF4344C8,0xFF4143CB,0xFF4142CC,0xFF4142CC,
+   0xFF4341CC,0xFF4341CC,0xFF4143CB,0xFF4143C9,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4443CE,0xFF4342CB,0xFF4143C9,0xFF4348C0,0xFF494DAC,0xFF0F114E,0xEB00000D,
+   0x37020000,0x00020000,0x00020000,0x00000002,0x00000002,0x00000000,0x00000000,
+   0x00000100,0x00000100,0x00333033,0x00333033,0x00333131,0x00333033,0x04010004,
+   0x95000014,0xFF15135A,0xFF5050A7,0xFF434792,0xF3000138,0x4B000010,0x0026252A,
+   0x6C010003,0xFE000013,0xFF1B1C62,0xFF4B4DB3,0xFF4546C3,0xFF4143CB,0xFF4142CC,
+   0xFF4142CC,0xFF4341CC,0xFF4341CC,0xFF4143CB,0xFF4143C9,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4041CB,0xFF4143CB,0xFF3F44C9,0xFF464BBC,0xFF3A3E89,0xFF000026,
+   0xA9000008,0x06020000,0x00020000,0x00020000,0x00000002,0x00000002,0x00000000,
+   0x00000000,0x00000100,0x00000100,0x00313131,0x00333131,0x00333131,0x00333131,
+   0x00313131,0x2800000A,0xDA000026,0xFF34367A,0xFF4F54AC,0xFF1E216E,0xB4000018,
+   0x0A000008,0x1E000002,0xD700000B,0xFF00002D,0xFF414394,0xFF4748BE,0xFF4143CB,
+   0xFF4142CC,0xFF4142CC,0xFF4341CC,0xFF4341CC,0xFF4143CB,0xFF4143C9,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4041CA,0xFF3E42CA,0xFF4045CA,0xFF474CB6,0xFF1C1F55,
+   0xF6000010,0x4F000005,0x004D4A4B,0x00020000,0x00020000,0x00000002,0x00000002,
+   0x00000000,0x00000000,0x00000100,0x00000100,0x00313131,0x00313131,0x0033312F,
+   0x0033312F,0x0031322F,0x002E2E35,0x6700000E,0xF9080B3A,0xFF44489C,0xFF46489C,
+   0xF7080634,0x5800000D,0x0024252A,0x80000006,0xFF000013,0xFD20225F,0xFF494CB6,
+   0xFF4344C8,0xFF4143CB,0xFF4143CB,0xFF4142CC,0xFF4142CC,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF3F43CB,0xFF3E42CA,0xFF4144C8,0xFF4347C1,0xFF3B3E9B,
+   0xFF000027,0xBE000006,0x0F000001,0x004B4A4C,0x00020000,0x00020000,0x00000002,
+   0x00000002,0x00000000,0x00000000,0x00000100,0x00000100,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000002,0x0C000005,0xA9000013,0xFF1C1D5C,
+   0xFF55559E,0xFF2F2E67,0xC500001C,0x13000009,0x28000003,0xE000000A,0xFF00012C,
+   0xFF3F3F9C,0xFF4648C2,0xFF4547C8,0xFF4042C8,0xFF3F43CB,0xFF3F42CC,0xFF3F42CC,
+   0xFF3F43CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4342CB,0xFF4342CB,0xFF4342CB,0xFF4143CB,
+   0xFF4143CB,0xFF3F43CB,0xFF3F43CB,0xFF3F43CB,0xFF4043CE,0xFF4345C5,0xFF4E4DB6,
+   0xFF1A1960,0xF8000013,0x59000003,0x00282729,0x00262626,0x00020000,0x00020000,
+   0x00000002,0x00000002,0x00000000,0x00000000,0x00000100,0x00000100,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x2D00000A,
+   0xDB000023,0xFF363772,0xFF525092,0xFD0E0C41,0x7500000D,0x0016171C,0x88000003,
+   0xFF000014,0xFF1D1E66,0xFF4C4DB6,0xFF4648C2,0xFF4245CA,0xFF3F43CB,0xFF3F43CB,
+   0xFF3D43CC,0xFF3F42CC,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4342CB,0xFF4542CB,0xFF4342CB,
+   0xFF4143CB,0xFF4143CB,0xFF3F43CB,0xFF3F43CB,0xFF3F44C9,0xFF3F44C9,0xFF484ABE,
+   0xFF413F8F,0xFF01002E,0xBA00000D,0x0F010003,0x00262628,0x00252525,0x00020000,
+   0x00020000,0x00000002,0x00000002,0x00000000,0x00000000,0x00000100,0x00000100,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000005,0x5F00000D,0xF5080831,0xFF47468C,0xFF353579,0xE200001C,0x33000008,
+   0x24000003,0xDB00000B,0xFF010433,0xFF444494,0xFF4A49BE,0xFF4343C9,0xFF4143C9,
+   0xFF4143C9,0xFF3F43CB,0xFF3F42CC,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4343C9,0xFF4343C9,
+   0xFF4342CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF3F44C9,0xFF3F45C8,0xFF4345C5,
+   0xFF494BAF,0xFF1A1A4F,0xF5000011,0x52000006,0x0024252A,0x00242628,0x00252427,
+   0x00020000,0x00020000,0x00000002,0x00000002,0x00000000,0x00000000,0x00000100,
+   0x00000100,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000002,0x07000003,0x92000013,0xFF10104B,0xFF4D4B8E,0xFF1A1742,
+   0xB6000012,0x16000008,0x78000007,0xFE000013,0xFF252560,0xFF4B4CB5,0xFF4544C6,
+   0xFF4344C8,0xFF4343C9,0xFF4143CB,0xFF3F42CC,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4345C5,
+   0xFF484BBA,0xFF313484,0xFF00001C,0xA6000005,0x09000002,0x00262729,0x00242628,
+   0x00262626,0x00020000,0x00020000,0x00000002,0x00000002,0x00000000,0x00000000,
+   0x00000100,0x00000100,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x001A191B,0x18000008,0xBA000018,0xFF222050,
+   0xFF48457E,0xFD090636,0xB700000D,0x62000006,0xD7000008,0xFF000026,0xFF3B3D96,
+   0xFF494AC0,0xFF4545C5,0xFF4444CA,0xFF4143CB,0xFF3F43CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4243CE,0xFF4243CE,0xFF4141CE,
+   0xFF4746C1,0xFF4749A1,0xFF070A40,0xE200000D,0x32000000,0x00262628,0x00262628,
+   0x00242726,0x00262626,0x00020000,0x00020000,0x00000002,0x00000002,0x00000000,
+   0x00000000,0x00000100,0x00000100,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x001A1A1A,0x001A181D,0x2C00000B,
+   0xCC000018,0xFF2A285D,0xFF413F74,0xFF070525,0xF100000E,0xEE000011,0xFF00001B,
+   0xFF090B5C,0xFF393AA9,0xFF3937B5,0xFF3F40C4,0xFF4245CA,0xFF3F43CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF3F43CB,0xFF3F43CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4342CB,
+   0xFF4343C9,0xFF4849B8,0xFF232667,0xFD000019,0x79000006,0x00282725,0x00262628,
+   0x00262628,0x00262626,0x00262725,0x00020000,0x00020000,0x00000002,0x00000002,
+   0x00000000,0x00000000,0x00000100,0x00000100,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x001A171A,0x001C181B,
+   0x0016171C,0x2F00000A,0xC700001B,0xFF2D2A53,0xFF3E3C6C,0xFF050434,0xFF0F103B,
+   0xFF20215A,0xFF121269,0xFF21208E,0xFF3130AB,0xFF3E40C1,0xFF4143C9,0xFF3F44C9,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFE3F44C9,0xFD3F44C9,0xFF3F42CC,0xFF4142CC,0xFF4143C9,
+   0xFF4243C5,0xFF4649C1,0xFF383C96,0xFF00002A,0xBB00000A,0x14000004,0x00252525,
+   0x00282528,0x00282528,0x00262626,0x00262725,0x00020000,0x00020000,0x00000002,
+   0x00000002,0x00000000,0x00000000,0x00000100,0x00000100,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x001C181B,
+   0x001C191A,0x001B1B1B,0x0018181D,0x2A00000C,0xB1000018,0xFA191942,0xFF313160,
+   0xFF141442,0xFF1D1D54,0xFF494790,0xFF5252AB,0xFF4D4CB5,0xFF4B4BBD,0xFF4D50C8,
+   0xFF5457D6,0xFF4549CC,0xFF4143C9,0xFF4143C9,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF3F44C9,0xFF3D43CB,0xFF3F42CC,0xFF4142CC,
+   0xFF4242C8,0xFF4747C0,0xFF4549A8,0xFF0A0E4D,0xE8000011,0x3E000002,0x00252525,
+   0x00252525,0x00282528,0x00282528,0x00262626,0x00262725,0x00020000,0x00020000,
+   0x00000002,0x00000002,0x00000000,0x00000000,0x00000100,0x00000100,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00020202,0x00020202,0x00020202,0x00020204,0x00010207,0x0F000006,0x6C00000B,
+   0xDA060618,0xFE15162F,0xFF040524,0xFF07072E,0xFF28285D,0xFF423F84,0xFF403C91,
+   0xFF39389A,0xFF5253C3,0xFF5658D3,0xFF4345C6,0xFF4043C7,0xFF4143C9,0xFF3F43CB,
+   0xFF3F43CB,0xFF3F44C9,0xFF3F43CB,0xFF4143CB,0xFF4142CC,0xFF4143CB,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143C9,0xFF4143CB,0xFF3F42CC,0xFF3F42CC,0xFF4142CC,
+   0xFF4342CB,0xFF4445C9,0xFF4949B4,0xFF282865,0xFC000017,0x79000008,0x01000000,
+   0x00000000,0x00000000,0x00000000,0x01000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,
+   0x00020202,0x24000002,0x6E000009,0xA800000C,0xDA00000C,0xF8000013,0xFF000023,
+   0xFF0F0B47,0xFF2E2C81,0xFF36359C,0xFF4446BC,0xFF4447C6,0xFF4344C8,0xFF4245CA,
+   0xFF4143CB,0xFF3F42CC,0xFF3F43CB,0xFF3F43CB,0xFF4142CC,0xFF4142CC,0xFF4143CB,
+   0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF4143CB,0xFF3F42CC,0xFF3E42CA,
+   0xFF4042C8,0xFF4444C3,0xFF484ABE,0xFF383A8E,0xFF000023,0xAC000006,0x0F000002,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x01000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,
+   0x00020202,0x00030303,0x00010003,0x001B1C20,0x03000003,0x1B000103,0x5A000005,
+   0xE000000C,0xFF010128,0xFF393984,0xFF4E4EB4,0xFF4747C0,0xFF4645C7,0xFF4343C9,
+   0xFF4341CC,0xFF4141CE,0xFF4141CE,0xFF3F41CE,0xFF3F42CC,0xFF4142CC,0xFF4341CC,
+   0xFF4341CC,0xFF4341CC,0xFF4341CC,0xFF4341CE,0xFF4341CE,0xFF4341CC,0xFF4143C9,
+   0xFF4245C9,0xFF4446C7,0xFF474ABB,0xFF434899,0xFF090C3E,0xCD00000E,0x28010003,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00020202,0x00020202,0x00020202,0x00020202,
+   0x00010101,0x00020202,0x00010101,0x00030303,0x001C1C1C,0x001D1D1D,0x001D1E1C,
+   0x001D1E1C,0x54000002,0xEC00000E,0xFF03033E,0xFF37388E,0xFF4241AA,0xFF4644B6,
+   0xFF4846BD,0xFF4A48C1,0xFF4746C1,0xFF4746C1,0xFF4547C1,0xFF4547C0,0xFF4747C0,
+   0xFF4947C0,0xFF4947C0,0xFF4947C0,0xFF4947C0,0xFF4946C1,0xFF4946C1,0xFF4947C0,
+   0xFF4545B9,0xFF4242B4,0xFF3B3EAF,0xFF292C88,0xFF060C44,0xD8000016,0x35000006,
+   0x00383838,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00020202,0x00020202,0x00020202,
+   0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x001D1D1D,0x001D1D1D,
+   0x001D1D1D,0x001C1D1A,0x02010200,0x65000009,0xF0000019,0xFF000037,0xFF020148,
+   0xFF070555,0xFF100D60,0xFF1C1B6F,0xFF25247A,0xFF292A80,0xFF303286,0xFF343589,
+   0xFF38378B,0xFF38378B,0xFF37368A,0xFF353388,0xFF2F2E82,0xFF28277B,0xFF1F1D72,
+   0xFF151567,0xFF0A095B,0xFF010153,0xFF000054,0xFF000048,0xFF000026,0x7700000D,
+   0x0037373E,0x003B3939,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00020202,0x00020202,
+   0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x001D1D1D,
+   0x001D1D1D,0x001D1D1D,0x001C1C1C,0x001C1D1A,0x03000003,0x9B000218,0xFF36365F,
+   0xFF3F407B,0xFF323177,0xFF2B2972,0xFF1D1C6A,0xFF141262,0xFF0C0C5C,0xFF060755,
+   0xFF030451,0xFF030250,0xFF02014F,0xFF030250,0xFF050351,0xFF070752,0xFF0D0D56,
+   0xFF14145D,0xFF1F1E65,0xFF2C2C70,0xFF36367A,0xFF44438A,0xFF52538E,0xFD1D1E3E,
+   0x5B00000A,0x0039373C,0x003A3738,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00020202,
+   0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,
+   0x001B1E1C,0x001D1D1D,0x001D1C1F,0x001E1B1E,0x001F1D1D,0x001B1B22,0x64000011,
+   0xFD2E3360,0xFF51549A,0xFF5252A9,0xFF5254AE,0xFF5252B2,0xFF4F4FB5,0xFF4D4CB5,
+   0xFF494AB2,0xFF4748B1,0xFF4847B0,0xFF4946AD,0xFF4947AC,0xFF4948AA,0xFF4D4CAC,
+   0xFF5051AC,0xFF5051AC,0xFF5354A9,0xFF4F519E,0xFF4A4C92,0xFF414183,0xFF333468,
+   0xF311132E,0x61000009,0x0038363B,0x003C3A3A,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,
+   0x00020202,0x001B1E1C,0x001D1D1D,0x001D1C1F,0x001E1B1E,0x001E1C1C,0x001B1B22,
+   0x6300000C,0xE9000325,0xFA090D45,0xFF101258,0xFF1C1E69,0xFF272777,0xFF292B7F,
+   0xFF2E2E85,0xFF33328B,0xFF35358D,0xFF36348B,0xFF353389,0xFF313084,0xFF2E2D7F,
+   0xFF272777,0xFF1F216B,0xFF161863,0xFD111457,0xF1080A47,0xDA000339,0xB700002B,
+   0x8300001D,0x4400000E,0x0D000005,0x0039383B,0x003B3939,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000002,0x0C000005,0x2D000008,0x5000000D,0x72000010,0x8E000012,0xA3000013,
+   0xB3000017,0xBE000018,0xC4000018,0xC9000018,0xCB00001C,0xC800001B,0xBD000014,
+   0xB3000014,0xA4000013,0x90000012,0x76000012,0x59000010,0x3800000E,0x1B00000D,
+   0x0800000B,0x00000008,0x00000006,0x00010003,0x00010101,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x01000000,0x05000000,0x09000000,0x0C000000,0x0E000000,0x0F090909,0x0E0A0A0A,
+   0x09000000,0x05000000,0x02010101,0x00010101,0x00020202,0x00010101,0x00000000,
+   0x00000000,0x00010101,0x00010101,0x00010101,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00020202,
+   0x00020202,0x00020202,0x00020202,0x00020202,0x00010101,0x00010101,0x00010101,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00020202,0x00010101,0x00020202,0x00010101,0x00020202,0x00020202,0x00020202,
+   0x00020202,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,
+   0x00020202,0x00020202,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,
+   0x00020202,0x00020202,0x00020202,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00020202,0x00020202,0x00020202,0x00020202,
+   0x00020202,0x00020202,0x00020202,0x00020202,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00020202,0x00020202,0x00020202,
+   0x00020202,0x00020202,0x00020202,0x00020202,0x00020202,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
+   0x00000000,
+};
+#endif // TSODINCUP_H_
@@ -0,0 +1,1018 @@
+#ifndef OBJ_H_
+#define OBJ_H_
+#define vertices_count 118
+static const float vertices[][3] = {
+    {0.048039, 0.563912, -0.799652},
+    {-0.421985, 0.563912, -0.646932},
+    {-0.712475, 0.563912, -0.247106},
+    {-0.712475, 0.563912, 0.247106},
+    {-0.421985, 0.563912, 0.646932},
+    {0.048039, 0.563912, 0.799652},
+    {0.518062, 0.563912, 0.646932},
+    {0.808553, 0.563912, 0.247106},
+    {0.808553, 0.563912, -0.247106},
+    {0.518062, 0.563912, -0.646932},
+    {0.048039, 0.156786, -0.716293},
+    {-0.372988, 0.156786, -0.579494},
+    {-0.633196, 0.156786, -0.221347},
+    {-0.633196, 0.156786, 0.221347},
+    {-0.372988, 0.156786, 0.579494},
+    {0.048039, 0.156786, 0.716293},
+    {0.469066, 0.156786, 0.579494},
+    {0.729275, 0.156786, 0.221347},
+    {0.729275, 0.156786, -0.221347},
+    {0.469066, 0.156786, -0.579494},
+    {0.048039, -0.211548, -0.574568},
+    {-0.289684, -0.211548, -0.464836},
+    {-0.498408, -0.211548, -0.177551},
+    {-0.498408, -0.211548, 0.177551},
+    {-0.289684, -0.211548, 0.464836},
+    {0.048039, -0.211548, 0.574568},
+    {0.385762, -0.211548, 0.464836},
+    {0.594486, -0.211548, 0.177551},
+    {0.594486, -0.211548, -0.177551},
+    {0.385762, -0.211548, -0.464836},
+    {0.048039, -0.502768, -0.373209},
+    {-0.171328, -0.502768, -0.301932},
+    {-0.306904, -0.502768, -0.115327},
+    {-0.306904, -0.502768, 0.115327},
+    {-0.171328, -0.502768, 0.301932},
+    {0.048039, -0.502768, 0.373209},
+    {0.267406, -0.502768, 0.301932},
+    {0.402982, -0.502768, 0.115328},
+    {0.402982, -0.502768, -0.115328},
+    {0.267406, -0.502768, -0.301932},
+    {0.048039, -0.572172, -0.373209},
+    {-0.171328, -0.572172, -0.301932},
+    {-0.306904, -0.572172, -0.115327},
+    {-0.306904, -0.572172, 0.115327},
+    {-0.171328, -0.572172, 0.301932},
+    {0.048039, -0.572172, 0.373209},
+    {0.267406, -0.572172, 0.301932},
+    {0.402982, -0.572172, 0.115328},
+    {0.402982, -0.572172, -0.115328},
+    {0.267406, -0.572172, -0.301932},
+    {0.048039, 0.572172, -0.740687},
+    {-0.387326, 0.572172, -0.599228},
+    {-0.656396, 0.572172, -0.228885},
+    {-0.656396, 0.572172, 0.228885},
+    {-0.387326, 0.572172, 0.599228},
+    {0.048039, 0.572172, 0.740687},
+    {0.483404, 0.572172, 0.599228},
+    {0.752474, 0.572172, 0.228885},
+    {0.752474, 0.572172, -0.228885},
+    {0.483404, 0.572172, -0.599228},
+    {0.048039, 0.173190, -0.656666},
+    {-0.337940, 0.173190, -0.531254},
+    {-0.576487, 0.173190, -0.202921},
+    {-0.576487, 0.173190, 0.202921},
+    {-0.337940, 0.173190, 0.531254},
+    {0.048039, 0.173190, 0.656666},
+    {0.434017, 0.173190, 0.531254},
+    {0.672565, 0.173190, 0.202921},
+    {0.672565, 0.173190, -0.202921},
+    {0.434017, 0.173190, -0.531254},
+    {0.048039, -0.181146, -0.518781},
+    {-0.256893, -0.181146, -0.419702},
+    {-0.445351, -0.181146, -0.160312},
+    {-0.445351, -0.181146, 0.160312},
+    {-0.256893, -0.181146, 0.419702},
+    {0.048039, -0.181146, 0.518781},
+    {0.352971, -0.181146, 0.419702},
+    {0.541429, -0.181146, 0.160312},
+    {0.541429, -0.181146, -0.160313},
+    {0.352971, -0.181146, -0.419702},
+    {0.048039, -0.461316, -0.317240},
+    {-0.138430, -0.461316, -0.256653},
+    {-0.253675, -0.461316, -0.098033},
+    {-0.253675, -0.461316, 0.098033},
+    {-0.138430, -0.461316, 0.256653},
+    {0.048039, -0.461316, 0.317240},
+    {0.234508, -0.461316, 0.256653},
+    {0.349753, -0.461316, 0.098033},
+    {0.349753, -0.461316, -0.098033},
+    {0.234508, -0.461316, -0.256653},
+    {-0.622369, 0.355320, 0.302164},
+    {-0.446753, 0.355206, 0.543556},
+    {-0.604765, 0.260004, 0.294812},
+    {-0.434281, 0.259893, 0.529151},
+    {-0.734604, 0.344487, 0.406394},
+    {-0.580657, 0.344370, 0.618054},
+    {-0.720060, 0.262493, 0.395674},
+    {-0.565908, 0.262374, 0.607616},
+    {-0.808553, 0.270591, 0.474901},
+    {-0.668662, 0.270500, 0.667188},
+    {-0.750136, 0.232905, 0.432313},
+    {-0.610051, 0.232813, 0.624867},
+    {-0.799774, 0.138711, 0.488986},
+    {-0.679203, 0.138623, 0.654715},
+    {-0.739960, 0.165137, 0.445553},
+    {-0.619387, 0.165049, 0.611284},
+    {-0.642884, -0.164652, 0.405466},
+    {-0.551090, -0.164718, 0.531662},
+    {-0.611781, -0.120237, 0.382960},
+    {-0.520074, -0.120302, 0.509037},
+    {-0.473486, -0.325173, 0.291530},
+    {-0.390344, -0.325227, 0.405814},
+    {-0.475693, -0.276800, 0.293283},
+    {-0.392711, -0.276854, 0.407345},
+    {-0.414984, -0.268429, 0.228796},
+    {-0.312556, -0.268496, 0.369589},
+    {-0.389406, -0.316347, 0.210393},
+    {-0.287114, -0.316413, 0.350998},
+};
+#define texcoords_count 0
+static const float texcoords[1][3] = {0};
+#define normals_count 0
+static const float normals[1][3] = {0};
+#define faces_count 224
+static const int faces[224][9] = {
+    {26, 17, 16, -1, -1, -1, -1, -1, -1},
+    {9, 10, 0, -1, -1, -1, -1, -1, -1},
+    {16, 7, 6, -1, -1, -1, -1, -1, -1},
+    {13, 4, 3, -1, -1, -1, -1, -1, -1},
+    {0, 11, 1, -1, -1, -1, -1, -1, -1},
+    {7, 18, 8, -1, -1, -1, -1, -1, -1},
+    {14, 5, 4, -1, -1, -1, -1, -1, -1},
+    {1, 12, 2, -1, -1, -1, -1, -1, -1},
+    {18, 9, 8, -1, -1, -1, -1, -1, -1},
+    {15, 6, 5, -1, -1, -1, -1, -1, -1},
+    {12, 3, 2, -1, -1, -1, -1, -1, -1},
+    {23, 34, 24, -1, -1, -1, -1, -1, -1},
+    {23, 14, 13, -1, -1, -1, -1, -1, -1},
+    {20, 11, 10, -1, -1, -1, -1, -1, -1},
+    {17, 28, 18, -1, -1, -1, -1, -1, -1},
+    {24, 15, 14, -1, -1, -1, -1, -1, -1},
+    {21, 12, 11, -1, -1, -1, -1, -1, -1},
+    {28, 19, 18, -1, -1, -1, -1, -1, -1},
+    {25, 16, 15, -1, -1, -1, -1, -1, -1},
+    {22, 13, 12, -1, -1, -1, -1, -1, -1},
+    {29, 10, 19, -1, -1, -1, -1, -1, -1},
+    {33, 44, 34, -1, -1, -1, -1, -1, -1},
+    {20, 31, 21, -1, -1, -1, -1, -1, -1},
+    {27, 38, 28, -1, -1, -1, -1, -1, -1},
+    {34, 25, 24, -1, -1, -1, -1, -1, -1},
+    {21, 32, 22, -1, -1, -1, -1, -1, -1},
+    {28, 39, 29, -1, -1, -1, -1, -1, -1},
+    {35, 26, 25, -1, -1, -1, -1, -1, -1},
+    {32, 23, 22, -1, -1, -1, -1, -1, -1},
+    {39, 20, 29, -1, -1, -1, -1, -1, -1},
+    {36, 27, 26, -1, -1, -1, -1, -1, -1},
+    {45, 43, 41, -1, -1, -1, -1, -1, -1},
+    {40, 31, 30, -1, -1, -1, -1, -1, -1},
+    {47, 38, 37, -1, -1, -1, -1, -1, -1},
+    {34, 45, 35, -1, -1, -1, -1, -1, -1},
+    {41, 32, 31, -1, -1, -1, -1, -1, -1},
+    {48, 39, 38, -1, -1, -1, -1, -1, -1},
+    {45, 36, 35, -1, -1, -1, -1, -1, -1},
+    {42, 33, 32, -1, -1, -1, -1, -1, -1},
+    {49, 30, 39, -1, -1, -1, -1, -1, -1},
+    {46, 37, 36, -1, -1, -1, -1, -1, -1},
+    {100, 94, 96, -1, -1, -1, -1, -1, -1},
+    {90, 95, 91, -1, -1, -1, -1, -1, -1},
+    {96, 90, 92, -1, -1, -1, -1, -1, -1},
+    {97, 92, 93, -1, -1, -1, -1, -1, -1},
+    {91, 97, 93, -1, -1, -1, -1, -1, -1},
+    {103, 101, 99, -1, -1, -1, -1, -1, -1},
+    {101, 96, 97, -1, -1, -1, -1, -1, -1},
+    {95, 101, 97, -1, -1, -1, -1, -1, -1},
+    {94, 99, 95, -1, -1, -1, -1, -1, -1},
+    {103, 109, 105, -1, -1, -1, -1, -1, -1},
+    {102, 99, 98, -1, -1, -1, -1, -1, -1},
+    {100, 102, 98, -1, -1, -1, -1, -1, -1},
+    {101, 104, 100, -1, -1, -1, -1, -1, -1},
+    {110, 107, 106, -1, -1, -1, -1, -1, -1},
+    {106, 103, 102, -1, -1, -1, -1, -1, -1},
+    {108, 102, 104, -1, -1, -1, -1, -1, -1},
+    {105, 108, 104, -1, -1, -1, -1, -1, -1},
+    {114, 110, 112, -1, -1, -1, -1, -1, -1},
+    {112, 106, 108, -1, -1, -1, -1, -1, -1},
+    {109, 112, 108, -1, -1, -1, -1, -1, -1},
+    {107, 113, 109, -1, -1, -1, -1, -1, -1},
+    {116, 111, 110, -1, -1, -1, -1, -1, -1},
+    {115, 111, 117, -1, -1, -1, -1, -1, -1},
+    {114, 113, 115, -1, -1, -1, -1, -1, -1},
+    {26, 27, 17, -1, -1, -1, -1, -1, -1},
+    {9, 19, 10, -1, -1, -1, -1, -1, -1},
+    {16, 17, 7, -1, -1, -1, -1, -1, -1},
+    {13, 14, 4, -1, -1, -1, -1, -1, -1},
+    {0, 10, 11, -1, -1, -1, -1, -1, -1},
+    {7, 17, 18, -1, -1, -1, -1, -1, -1},
+    {14, 15, 5, -1, -1, -1, -1, -1, -1},
+    {1, 11, 12, -1, -1, -1, -1, -1, -1},
+    {18, 19, 9, -1, -1, -1, -1, -1, -1},
+    {15, 16, 6, -1, -1, -1, -1, -1, -1},
+    {12, 13, 3, -1, -1, -1, -1, -1, -1},
+    {23, 33, 34, -1, -1, -1, -1, -1, -1},
+    {23, 24, 14, -1, -1, -1, -1, -1, -1},
+    {20, 21, 11, -1, -1, -1, -1, -1, -1},
+    {17, 27, 28, -1, -1, -1, -1, -1, -1},
+    {24, 25, 15, -1, -1, -1, -1, -1, -1},
+    {21, 22, 12, -1, -1, -1, -1, -1, -1},
+    {28, 29, 19, -1, -1, -1, -1, -1, -1},
+    {25, 26, 16, -1, -1, -1, -1, -1, -1},
+    {22, 23, 13, -1, -1, -1, -1, -1, -1},
+    {29, 20, 10, -1, -1, -1, -1, -1, -1},
+    {33, 43, 44, -1, -1, -1, -1, -1, -1},
+    {20, 30, 31, -1, -1, -1, -1, -1, -1},
+    {27, 37, 38, -1, -1, -1, -1, -1, -1},
+    {34, 35, 25, -1, -1, -1, -1, -1, -1},
+    {21, 31, 32, -1, -1, -1, -1, -1, -1},
+    {28, 38, 39, -1, -1, -1, -1, -1, -1},
+    {35, 36, 26, -1, -1, -1, -1, -1, -1},
+    {32, 33, 23, -1, -1, -1, -1, -1, -1},
+    {39, 30, 20, -1, -1, -1, -1, -1, -1},
+    {36, 37, 27, -1, -1, -1, -1, -1, -1},
+    {41, 40, 49, -1, -1, -1, -1, -1, -1},
+    {49, 48, 41, -1, -1, -1, -1, -1, -1},
+    {48, 47, 41, -1, -1, -1, -1, -1, -1},
+    {47, 46, 45, -1, -1, -1, -1, -1, -1},
+    {45, 44, 43, -1, -1, -1, -1, -1, -1},
+    {43, 42, 41, -1, -1, -1, -1, -1, -1},
+    {47, 45, 41, -1, -1, -1, -1, -1, -1},
+    {40, 41, 31, -1, -1, -1, -1, -1, -1},
+    {47, 48, 38, -1, -1, -1, -1, -1, -1},
+    {34, 44, 45, -1, -1, -1, -1, -1, -1},
+    {41, 42, 32, -1, -1, -1, -1, -1, -1},
+    {48, 49, 39, -1, -1, -1, -1, -1, -1},
+    {45, 46, 36, -1, -1, -1, -1, -1, -1},
+    {42, 43, 33, -1, -1, -1, -1, -1, -1},
+    {49, 40, 30, -1, -1, -1, -1, -1, -1},
+    {46, 47, 37, -1, -1, -1, -1, -1, -1},
+    {100, 98, 94, -1, -1, -1, -1, -1, -1},
+    {90, 94, 95, -1, -1, -1, -1, -1, -1},
+    {96, 94, 90, -1, -1, -1, -1, -1, -1},
+    {97, 96, 92, -1, -1, -1, -1, -1, -1},
+    {91, 95, 97, -1, -1, -1, -1, -1, -1},
+    {103, 105, 101, -1, -1, -1, -1, -1, -1},
+    {101, 100, 96, -1, -1, -1, -1, -1, -1},
+    {95, 99, 101, -1, -1, -1, -1, -1, -1},
+    {94, 98, 99, -1, -1, -1, -1, -1, -1},
+    {103, 107, 109, -1, -1, -1, -1, -1, -1},
+    {102, 103, 99, -1, -1, -1, -1, -1, -1},
+    {100, 104, 102, -1, -1, -1, -1, -1, -1},
+    {101, 105, 104, -1, -1, -1, -1, -1, -1},
+    {110, 111, 107, -1, -1, -1, -1, -1, -1},
+    {106, 107, 103, -1, -1, -1, -1, -1, -1},
+    {108, 106, 102, -1, -1, -1, -1, -1, -1},
+    {105, 109, 108, -1, -1, -1, -1, -1, -1},
+    {114, 116, 110, -1, -1, -1, -1, -1, -1},
+    {112, 110, 106, -1, -1, -1, -1, -1, -1},
+    {109, 113, 112, -1, -1, -1, -1, -1, -1},
+    {107, 111, 113, -1, -1, -1, -1, -1, -1},
+    {116, 117, 111, -1, -1, -1, -1, -1, -1},
+    {115, 113, 111, -1, -1, -1, -1, -1, -1},
+    {114, 112, 113, -1, -1, -1, -1, -1, -1},
+    {68, 57, 58, -1, -1, -1, -1, -1, -1},
+    {78, 67, 68, -1, -1, -1, -1, -1, -1},
+    {65, 54, 55, -1, -1, -1, -1, -1, -1},
+    {62, 51, 52, -1, -1, -1, -1, -1, -1},
+    {69, 58, 59, -1, -1, -1, -1, -1, -1},
+    {56, 65, 55, -1, -1, -1, -1, -1, -1},
+    {63, 52, 53, -1, -1, -1, -1, -1, -1},
+    {60, 59, 50, -1, -1, -1, -1, -1, -1},
+    {67, 56, 57, -1, -1, -1, -1, -1, -1},
+    {64, 53, 54, -1, -1, -1, -1, -1, -1},
+    {51, 60, 50, -1, -1, -1, -1, -1, -1},
+    {75, 84, 74, -1, -1, -1, -1, -1, -1},
+    {65, 74, 64, -1, -1, -1, -1, -1, -1},
+    {72, 61, 62, -1, -1, -1, -1, -1, -1},
+    {79, 68, 69, -1, -1, -1, -1, -1, -1},
+    {66, 75, 65, -1, -1, -1, -1, -1, -1},
+    {63, 72, 62, -1, -1, -1, -1, -1, -1},
+    {60, 79, 69, -1, -1, -1, -1, -1, -1},
+    {67, 76, 66, -1, -1, -1, -1, -1, -1},
+    {74, 63, 64, -1, -1, -1, -1, -1, -1},
+    {71, 60, 61, -1, -1, -1, -1, -1, -1},
+    {83, 87, 89, -1, -1, -1, -1, -1, -1},
+    {82, 71, 72, -1, -1, -1, -1, -1, -1},
+    {89, 78, 79, -1, -1, -1, -1, -1, -1},
+    {76, 85, 75, -1, -1, -1, -1, -1, -1},
+    {73, 82, 72, -1, -1, -1, -1, -1, -1},
+    {80, 79, 70, -1, -1, -1, -1, -1, -1},
+    {77, 86, 76, -1, -1, -1, -1, -1, -1},
+    {84, 73, 74, -1, -1, -1, -1, -1, -1},
+    {81, 70, 71, -1, -1, -1, -1, -1, -1},
+    {88, 77, 78, -1, -1, -1, -1, -1, -1},
+    {68, 67, 57, -1, -1, -1, -1, -1, -1},
+    {78, 77, 67, -1, -1, -1, -1, -1, -1},
+    {65, 64, 54, -1, -1, -1, -1, -1, -1},
+    {62, 61, 51, -1, -1, -1, -1, -1, -1},
+    {69, 68, 58, -1, -1, -1, -1, -1, -1},
+    {56, 66, 65, -1, -1, -1, -1, -1, -1},
+    {63, 62, 52, -1, -1, -1, -1, -1, -1},
+    {60, 69, 59, -1, -1, -1, -1, -1, -1},
+    {67, 66, 56, -1, -1, -1, -1, -1, -1},
+    {64, 63, 53, -1, -1, -1, -1, -1, -1},
+    {51, 61, 60, -1, -1, -1, -1, -1, -1},
+    {75, 85, 84, -1, -1, -1, -1, -1, -1},
+    {65, 75, 74, -1, -1, -1, -1, -1, -1},
+    {72, 71, 61, -1, -1, -1, -1, -1, -1},
+    {79, 78, 68, -1, -1, -1, -1, -1, -1},
+    {66, 76, 75, -1, -1, -1, -1, -1, -1},
+    {63, 73, 72, -1, -1, -1, -1, -1, -1},
+    {60, 70, 79, -1, -1, -1, -1, -1, -1},
+    {67, 77, 76, -1, -1, -1, -1, -1, -1},
+    {74, 73, 63, -1, -1, -1, -1, -1, -1},
+    {71, 70, 60, -1, -1, -1, -1, -1, -1},
+    {89, 80, 81, -1, -1, -1, -1, -1, -1},
+    {81, 82, 83, -1, -1, -1, -1, -1, -1},
+    {83, 84, 85, -1, -1, -1, -1, -1, -1},
+    {85, 86, 87, -1, -1, -1, -1, -1, -1},
+    {87, 88, 89, -1, -1, -1, -1, -1, -1},
+    {89, 81, 83, -1, -1, -1, -1, -1, -1},
+    {83, 85, 87, -1, -1, -1, -1, -1, -1},
+    {82, 81, 71, -1, -1, -1, -1, -1, -1},
+    {89, 88, 78, -1, -1, -1, -1, -1, -1},
+    {76, 86, 85, -1, -1, -1, -1, -1, -1},
+    {73, 83, 82, -1, -1, -1, -1, -1, -1},
+    {80, 89, 79, -1, -1, -1, -1, -1, -1},
+    {77, 87, 86, -1, -1, -1, -1, -1, -1},
+    {84, 83, 73, -1, -1, -1, -1, -1, -1},
+    {81, 80, 70, -1, -1, -1, -1, -1, -1},
+    {88, 87, 77, -1, -1, -1, -1, -1, -1},
+    {3, 52, 2, -1, -1, -1, -1, -1, -1},
+    {0, 59, 9, -1, -1, -1, -1, -1, -1},
+    {57, 6, 7, -1, -1, -1, -1, -1, -1},
+    {4, 53, 3, -1, -1, -1, -1, -1, -1},
+    {51, 0, 1, -1, -1, -1, -1, -1, -1},
+    {58, 7, 8, -1, -1, -1, -1, -1, -1},
+    {55, 4, 5, -1, -1, -1, -1, -1, -1},
+    {52, 1, 2, -1, -1, -1, -1, -1, -1},
+    {9, 58, 8, -1, -1, -1, -1, -1, -1},
+    {56, 5, 6, -1, -1, -1, -1, -1, -1},
+    {3, 53, 52, -1, -1, -1, -1, -1, -1},
+    {0, 50, 59, -1, -1, -1, -1, -1, -1},
+    {57, 56, 6, -1, -1, -1, -1, -1, -1},
+    {4, 54, 53, -1, -1, -1, -1, -1, -1},
+    {51, 50, 0, -1, -1, -1, -1, -1, -1},
+    {58, 57, 7, -1, -1, -1, -1, -1, -1},
+    {55, 54, 4, -1, -1, -1, -1, -1, -1},
+    {52, 51, 1, -1, -1, -1, -1, -1, -1},
+    {9, 59, 58, -1, -1, -1, -1, -1, -1},
+    {56, 55, 5, -1, -1, -1, -1, -1, -1},
+};
+#define mesh_stride 3
+#define mesh_vertices_count 229
+static const float mesh_vertices[][3] = {
+    {0.385762, -0.211548, 0.464836},
+    {0.729275, 0.156786, 0.221347},
+    {0.469066, 0.156786, 0.579494},
+    {0.048039, -0.502768, 0.373209},
+    {0.048039, -0.211548, 0.574568},
+    {0.267406, -0.502768, 0.301932},
+    {0.594486, -0.211548, 0.177551},
+    {0.594486, -0.211548, -0.177551},
+    {0.729275, 0.156786, -0.221347},
+    {0.808553, 0.563912, 0.247106},
+    {0.518062, 0.563912, 0.646932},
+    {0.048039, 0.156786, 0.716293},
+    {-0.171328, -0.502768, 0.301932},
+    {-0.289684, -0.211548, 0.464836},
+    {0.048039, -0.572172, 0.373209},
+    {0.267406, -0.572172, 0.301932},
+    {0.402982, -0.502768, 0.115328},
+    {0.402982, -0.502768, -0.115328},
+    {0.402982, -0.572172, 0.115328},
+    {-0.306904, -0.572172, 0.115327},
+    {-0.171328, -0.572172, -0.301932},
+    {-0.171328, -0.572172, 0.301932},
+    {-0.498408, -0.211548, 0.177551},
+    {-0.306904, -0.502768, 0.115327},
+    {-0.372988, 0.156786, 0.579494},
+    {-0.633196, 0.156786, 0.221347},
+    {-0.306904, -0.502768, -0.115327},
+    {-0.498408, -0.211548, -0.177551},
+    {-0.306904, -0.572172, -0.115327},
+    {-0.289684, -0.211548, -0.464836},
+    {-0.171328, -0.502768, -0.301932},
+    {-0.633196, 0.156786, -0.221347},
+    {-0.421985, 0.563912, 0.646932},
+    {-0.712475, 0.563912, 0.247106},
+    {0.048039, 0.563912, 0.799652},
+    {-0.656396, 0.572172, 0.228885},
+    {0.048039, 0.572172, 0.740687},
+    {-0.387326, 0.572172, 0.599228},
+    {-0.712475, 0.563912, -0.247106},
+    {-0.656396, 0.572172, -0.228885},
+    {-0.421985, 0.563912, -0.646932},
+    {-0.372988, 0.156786, -0.579494},
+    {-0.576487, 0.173190, -0.202921},
+    {-0.387326, 0.572172, -0.599228},
+    {-0.576487, 0.173190, 0.202921},
+    {-0.337940, 0.173190, 0.531254},
+    {0.048039, 0.173190, 0.656666},
+    {0.483404, 0.572172, 0.599228},
+    {-0.256893, -0.181146, 0.419702},
+    {0.434017, 0.173190, 0.531254},
+    {0.048039, -0.181146, 0.518781},
+    {-0.445351, -0.181146, -0.160312},
+    {-0.445351, -0.181146, 0.160312},
+    {-0.337940, 0.173190, -0.531254},
+    {-0.253675, -0.461316, -0.098033},
+    {-0.256893, -0.181146, -0.419702},
+    {-0.138430, -0.461316, 0.256653},
+    {-0.253675, -0.461316, 0.098033},
+    {0.352971, -0.181146, 0.419702},
+    {0.048039, -0.461316, 0.317240},
+    {0.672565, 0.173190, 0.202921},
+    {0.541429, -0.181146, 0.160312},
+    {0.234508, -0.461316, 0.256653},
+    {0.349753, -0.461316, 0.098033},
+    {0.234508, -0.461316, -0.256653},
+    {-0.138430, -0.461316, -0.256653},
+    {0.048039, -0.181146, -0.518781},
+    {0.048039, -0.461316, -0.317240},
+    {0.541429, -0.181146, -0.160313},
+    {0.352971, -0.181146, -0.419702},
+    {0.349753, -0.461316, -0.098033},
+    {0.672565, 0.173190, -0.202921},
+    {0.752474, 0.572172, 0.228885},
+    {0.752474, 0.572172, -0.228885},
+    {0.434017, 0.173190, -0.531254},
+    {0.048039, 0.173190, -0.656666},
+    {0.483404, 0.572172, -0.599228},
+    {0.048039, 0.572172, -0.740687},
+    {0.808553, 0.563912, -0.247106},
+    {0.518062, 0.563912, -0.646932},
+    {0.048039, 0.156786, -0.716293},
+    {0.048039, 0.563912, -0.799652},
+    {0.469066, 0.156786, -0.579494},
+    {0.048039, -0.211548, -0.574568},
+    {0.385762, -0.211548, -0.464836},
+    {0.267406, -0.502768, -0.301932},
+    {0.048039, -0.502768, -0.373209},
+    {0.402982, -0.572172, -0.115328},
+    {0.267406, -0.572172, -0.301932},
+    {0.048039, -0.572172, -0.373209},
+    {-0.750136, 0.232905, 0.432313},
+    {-0.734604, 0.344487, 0.406394},
+    {-0.720060, 0.262493, 0.395674},
+    {-0.799774, 0.138711, 0.488986},
+    {-0.808553, 0.270591, 0.474901},
+    {-0.610051, 0.232813, 0.624867},
+    {-0.739960, 0.165137, 0.445553},
+    {-0.668662, 0.270500, 0.667188},
+    {-0.580657, 0.344370, 0.618054},
+    {-0.622369, 0.355320, 0.302164},
+    {-0.604765, 0.260004, 0.294812},
+    {-0.565908, 0.262374, 0.607616},
+    {-0.446753, 0.355206, 0.543556},
+    {-0.679203, 0.138623, 0.654715},
+    {-0.619387, 0.165049, 0.611284},
+    {-0.611781, -0.120237, 0.382960},
+    {-0.520074, -0.120302, 0.509037},
+    {-0.642884, -0.164652, 0.405466},
+    {-0.551090, -0.164718, 0.531662},
+    {-0.475693, -0.276800, 0.293283},
+    {-0.392711, -0.276854, 0.407345},
+    {-0.473486, -0.325173, 0.291530},
+    {-0.390344, -0.325227, 0.405814},
+    {-0.414984, -0.268429, 0.228796},
+    {-0.312556, -0.268496, 0.369589},
+    {-0.389406, -0.316347, 0.210393},
+    {-0.287114, -0.316413, 0.350998},
+    {-0.434281, 0.259893, 0.529151},
+    {0.518062, 0.563912, -0.646932},
+    {0.048039, 0.156786, -0.716293},
+    {0.048039, 0.563912, -0.799652},
+    {0.385762, -0.211548, -0.464836},
+    {0.808553, 0.563912, -0.247106},
+    {0.048039, 0.173190, -0.656666},
+    {0.352971, -0.181146, -0.419702},
+    {0.752474, 0.572172, -0.228885},
+    {0.048039, -0.211548, -0.574568},
+    {-0.421985, 0.563912, -0.646932},
+    {-0.445351, -0.181146, -0.160312},
+    {-0.656396, 0.572172, -0.228885},
+    {-0.256893, -0.181146, -0.419702},
+    {0.048039, -0.461316, -0.317240},
+    {0.541429, -0.181146, -0.160313},
+    {0.541429, -0.181146, 0.160312},
+    {0.808553, 0.563912, 0.247106},
+    {0.234508, -0.461316, 0.256653},
+    {-0.253675, -0.461316, -0.098033},
+    {-0.445351, -0.181146, 0.160312},
+    {-0.138430, -0.461316, 0.256653},
+    {0.352971, -0.181146, 0.419702},
+    {0.048039, 0.173190, 0.656666},
+    {0.483404, 0.572172, 0.599228},
+    {0.469066, 0.156786, 0.579494},
+    {0.048039, 0.156786, 0.716293},
+    {0.048039, 0.563912, 0.799652},
+    {-0.387326, 0.572172, 0.599228},
+    {-0.256893, -0.181146, 0.419702},
+    {-0.656396, 0.572172, 0.228885},
+    {-0.372988, 0.156786, 0.579494},
+    {-0.712475, 0.563912, 0.247106},
+    {0.385762, -0.211548, 0.464836},
+    {-0.306904, -0.572172, 0.115327},
+    {-0.171328, -0.502768, 0.301932},
+    {-0.633196, 0.156786, -0.221347},
+    {-0.171328, -0.572172, -0.301932},
+    {-0.306904, -0.502768, -0.115327},
+    {0.048039, -0.572172, 0.373209},
+    {0.267406, -0.502768, 0.301932},
+    {0.402982, -0.572172, 0.115328},
+    {0.267406, -0.572172, -0.301932},
+    {0.402982, -0.502768, -0.115328},
+    {0.594486, -0.211548, -0.177551},
+    {-0.720060, 0.262493, 0.395674},
+    {-0.622369, 0.355320, 0.302164},
+    {-0.604765, 0.260004, 0.294812},
+    {-0.619387, 0.165049, 0.611284},
+    {-0.434281, 0.259893, 0.529151},
+    {-0.799774, 0.138711, 0.488986},
+    {-0.808553, 0.270591, 0.474901},
+    {-0.446753, 0.355206, 0.543556},
+    {-0.668662, 0.270500, 0.667188},
+    {-0.642884, -0.164652, 0.405466},
+    {-0.520074, -0.120302, 0.509037},
+    {-0.551090, -0.164718, 0.531662},
+    {-0.473486, -0.325173, 0.291530},
+    {-0.287114, -0.316413, 0.350998},
+    {-0.390344, -0.325227, 0.405814},
+    {-0.389406, -0.316347, 0.210393},
+    {-0.414984, -0.268429, 0.228796},
+    {0.469066, 0.156786, 0.579494},
+    {0.808553, 0.563912, 0.247106},
+    {0.483404, 0.572172, 0.599228},
+    {0.402982, -0.572172, 0.115328},
+    {0.808553, 0.563912, -0.247106},
+    {0.048039, -0.572172, 0.373209},
+    {0.048039, 0.563912, 0.799652},
+    {0.541429, -0.181146, -0.160313},
+    {0.234508, -0.461316, 0.256653},
+    {-0.306904, -0.572172, 0.115327},
+    {-0.387326, 0.572172, 0.599228},
+    {-0.256893, -0.181146, 0.419702},
+    {-0.171328, -0.572172, -0.301932},
+    {0.518062, 0.563912, -0.646932},
+    {0.048039, -0.211548, -0.574568},
+    {0.048039, -0.461316, -0.317240},
+    {-0.712475, 0.563912, 0.247106},
+    {-0.633196, 0.156786, -0.221347},
+    {0.048039, 0.563912, -0.799652},
+    {0.048039, 0.173190, -0.656666},
+    {-0.256893, -0.181146, -0.419702},
+    {-0.619387, 0.165049, 0.611284},
+    {-0.808553, 0.270591, 0.474901},
+    {-0.434281, 0.259893, 0.529151},
+    {-0.446753, 0.355206, 0.543556},
+    {-0.642884, -0.164652, 0.405466},
+    {-0.551090, -0.164718, 0.531662},
+    {-0.287114, -0.316413, 0.350998},
+    {-0.668662, 0.270500, 0.667188},
+    {-0.604765, 0.260004, 0.294812},
+    {-0.389406, -0.316347, 0.210393},
+    {-0.414984, -0.268429, 0.228796},
+    {0.048039, -0.572172, 0.373209},
+    {0.048039, 0.563912, 0.799652},
+    {-0.712475, 0.563912, 0.247106},
+    {0.808553, 0.563912, 0.247106},
+    {0.402982, -0.572172, 0.115328},
+    {-0.171328, -0.572172, -0.301932},
+    {0.234508, -0.461316, 0.256653},
+    {-0.256893, -0.181146, -0.419702},
+    {0.048039, -0.461316, -0.317240},
+    {0.518062, 0.563912, -0.646932},
+    {-0.604765, 0.260004, 0.294812},
+    {-0.668662, 0.270500, 0.667188},
+    {-0.446753, 0.355206, 0.543556},
+    {-0.414984, -0.268429, 0.228796},
+    {-0.434281, 0.259893, 0.529151},
+    {-0.551090, -0.164718, 0.531662},
+    {-0.389406, -0.316347, 0.210393},
+    {-0.287114, -0.316413, 0.350998},
+};
+static const int mesh_indices[] = {
+    0, 1, 2,
+    3, 0, 4,
+    5, 6, 0,
+    0, 6, 1,
+    4, 0, 2,
+    3, 5, 0,
+    1, 7, 8,
+    2, 1, 9,
+    9, 1, 8,
+    1, 6, 7,
+    2, 9, 10,
+    4, 2, 11,
+    11, 2, 10,
+    12, 4, 13,
+    13, 4, 11,
+    12, 3, 4,
+    12, 14, 3,
+    14, 5, 3,
+    15, 16, 5,
+    5, 16, 6,
+    14, 15, 5,
+    6, 17, 7,
+    6, 16, 17,
+    18, 17, 16,
+    15, 18, 16,
+    18, 15, 14,
+    14, 19, 20,
+    14, 21, 19,
+    18, 14, 20,
+    12, 21, 14,
+    22, 12, 13,
+    23, 21, 12,
+    22, 23, 12,
+    13, 11, 24,
+    22, 13, 24,
+    22, 24, 25,
+    26, 22, 27,
+    27, 22, 25,
+    26, 23, 22,
+    28, 23, 26,
+    23, 19, 21,
+    28, 19, 23,
+    19, 28, 20,
+    20, 28, 26,
+    29, 26, 27,
+    20, 26, 30,
+    29, 30, 26,
+    27, 25, 31,
+    29, 27, 31,
+    25, 32, 33,
+    25, 24, 32,
+    31, 25, 33,
+    24, 34, 32,
+    24, 11, 34,
+    32, 35, 33,
+    36, 32, 34,
+    32, 37, 35,
+    36, 37, 32,
+    31, 33, 38,
+    33, 39, 38,
+    33, 35, 39,
+    40, 31, 38,
+    29, 31, 41,
+    40, 41, 31,
+    39, 40, 38,
+    42, 43, 39,
+    44, 39, 35,
+    44, 42, 39,
+    39, 43, 40,
+    45, 35, 37,
+    45, 44, 35,
+    46, 37, 36,
+    46, 45, 37,
+    47, 46, 36,
+    47, 36, 34,
+    46, 48, 45,
+    49, 50, 46,
+    47, 49, 46,
+    46, 50, 48,
+    48, 44, 45,
+    44, 51, 42,
+    44, 52, 51,
+    48, 52, 44,
+    51, 53, 42,
+    42, 53, 43,
+    54, 55, 51,
+    52, 54, 51,
+    51, 55, 53,
+    56, 52, 48,
+    52, 57, 54,
+    56, 57, 52,
+    50, 56, 48,
+    58, 59, 50,
+    50, 59, 56,
+    49, 58, 50,
+    60, 58, 49,
+    60, 49, 47,
+    61, 62, 58,
+    60, 61, 58,
+    58, 62, 59,
+    57, 56, 59,
+    59, 62, 63,
+    57, 59, 63,
+    57, 63, 64,
+    65, 54, 57,
+    64, 65, 57,
+    54, 65, 55,
+    65, 66, 55,
+    64, 67, 65,
+    65, 67, 66,
+    64, 68, 69,
+    63, 70, 64,
+    64, 70, 68,
+    67, 64, 69,
+    61, 63, 62,
+    70, 63, 61,
+    70, 61, 68,
+    68, 61, 60,
+    68, 60, 71,
+    69, 68, 71,
+    60, 47, 72,
+    71, 60, 72,
+    71, 72, 73,
+    69, 71, 74,
+    74, 71, 73,
+    75, 69, 74,
+    67, 69, 66,
+    75, 66, 69,
+    55, 66, 75,
+    75, 76, 77,
+    43, 75, 77,
+    55, 75, 53,
+    75, 74, 76,
+    43, 53, 75,
+    74, 73, 76,
+    73, 9, 78,
+    79, 73, 78,
+    73, 72, 9,
+    79, 76, 73,
+    72, 10, 9,
+    72, 47, 10,
+    47, 34, 10,
+    11, 10, 34,
+    9, 8, 78,
+    8, 79, 78,
+    79, 80, 81,
+    79, 82, 80,
+    8, 82, 79,
+    81, 76, 79,
+    81, 77, 76,
+    43, 77, 81,
+    43, 81, 40,
+    81, 41, 40,
+    81, 80, 41,
+    83, 41, 80,
+    84, 80, 82,
+    84, 83, 80,
+    7, 82, 8,
+    7, 84, 82,
+    7, 85, 84,
+    85, 83, 84,
+    83, 30, 29,
+    83, 29, 41,
+    83, 86, 30,
+    85, 86, 83,
+    87, 85, 17,
+    88, 86, 85,
+    7, 17, 85,
+    87, 88, 85,
+    89, 30, 86,
+    88, 89, 86,
+    89, 20, 30,
+    20, 89, 88,
+    88, 87, 20,
+    87, 18, 20,
+    18, 87, 17,
+    90, 91, 92,
+    90, 93, 94,
+    95, 96, 90,
+    90, 94, 91,
+    95, 90, 92,
+    90, 96, 93,
+    91, 97, 98,
+    99, 91, 98,
+    92, 91, 99,
+    91, 94, 97,
+    92, 99, 100,
+    95, 92, 101,
+    101, 92, 100,
+    99, 98, 102,
+    98, 95, 101,
+    102, 98, 101,
+    98, 97, 95,
+    103, 95, 97,
+    103, 104, 95,
+    95, 104, 96,
+    105, 93, 96,
+    104, 105, 96,
+    103, 106, 104,
+    104, 106, 105,
+    107, 103, 93,
+    103, 108, 106,
+    93, 103, 97,
+    107, 108, 103,
+    93, 97, 94,
+    105, 107, 93,
+    109, 107, 105,
+    106, 109, 105,
+    108, 110, 106,
+    106, 110, 109,
+    111, 108, 107,
+    111, 112, 108,
+    108, 112, 110,
+    109, 111, 107,
+    113, 111, 109,
+    113, 109, 110,
+    113, 110, 114,
+    114, 110, 112,
+    115, 112, 111,
+    114, 112, 116,
+    115, 116, 112,
+    113, 115, 111,
+    101, 100, 117,
+    102, 101, 117,
+    0, 1, 2,
+    0, 3, 1,
+    4, 3, 0,
+    5, 0, 2,
+    6, 7, 0,
+    5, 6, 0,
+    0, 7, 4,
+    8, 9, 1,
+    2, 1, 9,
+    3, 8, 1,
+    5, 2, 9,
+    10, 5, 11,
+    10, 12, 5,
+    5, 13, 6,
+    12, 13, 5,
+    11, 5, 9,
+    13, 14, 6,
+    6, 14, 7,
+    14, 15, 7,
+    7, 15, 16,
+    7, 16, 4,
+    17, 14, 13,
+    14, 17, 15,
+    18, 17, 13,
+    18, 13, 12,
+    18, 12, 10,
+    19, 18, 10,
+    19, 10, 11,
+    18, 20, 17,
+    20, 18, 19,
+    21, 17, 22,
+    15, 17, 21,
+    22, 17, 20,
+    15, 23, 16,
+    15, 21, 23,
+    24, 16, 23,
+    16, 24, 4,
+    25, 23, 26,
+    25, 24, 23,
+    23, 22, 26,
+    23, 21, 22,
+    22, 27, 26,
+    22, 20, 28,
+    22, 28, 27,
+    20, 19, 28,
+    28, 19, 27,
+    19, 11, 29,
+    27, 19, 29,
+    30, 26, 27,
+    31, 30, 27,
+    27, 29, 31,
+    30, 25, 26,
+    32, 24, 25,
+    30, 32, 25,
+    33, 34, 30,
+    33, 30, 31,
+    34, 32, 30,
+    35, 31, 11,
+    35, 33, 31,
+    31, 29, 11,
+    9, 35, 11,
+    36, 35, 9,
+    36, 37, 35,
+    37, 33, 35,
+    38, 33, 36,
+    38, 34, 33,
+    33, 37, 36,
+    34, 38, 32,
+    39, 40, 32,
+    38, 39, 32,
+    32, 40, 24,
+    40, 39, 38,
+    40, 38, 36,
+    8, 36, 9,
+    8, 41, 36,
+    41, 40, 36,
+    40, 42, 43,
+    24, 40, 43,
+    40, 41, 42,
+    24, 43, 4,
+    43, 3, 4,
+    43, 8, 3,
+    43, 42, 8,
+    41, 8, 42,
+    44, 45, 46,
+    47, 44, 48,
+    44, 49, 50,
+    47, 49, 44,
+    44, 50, 45,
+    48, 44, 46,
+    45, 50, 51,
+    50, 52, 51,
+    49, 52, 50,
+    53, 52, 49,
+    47, 53, 49,
+    51, 47, 48,
+    52, 54, 47,
+    51, 52, 47,
+    47, 54, 53,
+    52, 55, 54,
+    53, 55, 52,
+    56, 55, 53,
+    54, 56, 53,
+    55, 57, 54,
+    54, 57, 56,
+    56, 58, 55,
+    55, 58, 57,
+    59, 58, 56,
+    60, 59, 56,
+    60, 56, 57,
+    59, 57, 58,
+    0, 1, 2,
+    0, 3, 4,
+    5, 0, 6,
+    5, 3, 0,
+    1, 0, 4,
+    6, 0, 2,
+    7, 1, 4,
+    1, 8, 2,
+    7, 8, 1,
+    2, 8, 6,
+    9, 6, 10,
+    9, 5, 6,
+    6, 11, 10,
+    6, 8, 11,
+    5, 9, 12,
+    3, 5, 12,
+    3, 13, 4,
+    3, 14, 13,
+    12, 14, 3,
+    13, 7, 4,
+    15, 7, 13,
+    8, 7, 15,
+    15, 11, 8,
+    11, 16, 10,
+    11, 15, 16,
+    16, 9, 10,
+    12, 9, 17,
+    17, 9, 16,
+    12, 17, 18,
+    14, 12, 18,
+    13, 14, 18,
+    19, 13, 18,
+    19, 15, 13,
+    16, 15, 20,
+    20, 15, 19,
+    18, 17, 16,
+    20, 19, 16,
+    16, 19, 18,
+    21, 22, 23,
+    24, 21, 23,
+    21, 25, 22,
+    26, 27, 21,
+    24, 28, 21,
+    28, 26, 21,
+    21, 27, 25,
+    22, 28, 24,
+    25, 28, 22,
+    29, 22, 24,
+    23, 22, 29,
+    25, 30, 26,
+    25, 26, 28,
+    31, 30, 25,
+    31, 25, 27,
+    26, 30, 27,
+    0, 1, 2,
+    0, 3, 1,
+    0, 4, 3,
+    5, 0, 2,
+    4, 0, 5,
+    1, 6, 2,
+    3, 6, 1,
+    7, 5, 2,
+    2, 8, 7,
+    6, 8, 2,
+    4, 5, 9,
+    9, 5, 7,
+    3, 4, 9,
+    9, 6, 3,
+    6, 9, 8,
+    7, 8, 9,
+    10, 11, 12,
+    13, 11, 10,
+    14, 13, 10,
+    12, 11, 14,
+    11, 15, 14,
+    13, 15, 11,
+    13, 16, 15,
+    14, 17, 13,
+    15, 17, 14,
+    15, 16, 17,
+};
+#define mesh_lods_count 4
+static const int mesh_lods[][4] = {
+    {0, 118, 0, 224},
+    {118, 61, 672, 111},
+    {179, 32, 1005, 54},
+    {211, 18, 1167, 26},
+};
+static const float mesh_lod_errors[] = {
+    0.000000,
+    0.127717,
+    0.144527,
+    0.203059,
+};
+#endif // OBJ_H_
@@ -0,0 +1,1799 @@
+#ifndef TSODINPOG_H_
+#define TSODINPOG_H_
+size_t tsodinPog_width = 112;
+size_t tsodinPog_height = 112;
+uint32_t tsodinPog_pixels[] = {
+   0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,
+   0xFF6D5E54,0xFF67594F,0xFF0A0907,0xFF020303,0xFFB1BFD4,0xFFD9EAFB,0xFFD1E2FA,
+   0xFFD5E6FF,0xFFD8E9FF,0xFFDAEBFF,0xFFDCEEFF,0xFFDEF0FF,0xFFDFF0FF,0xFFDFF1FF,
+   0xFFDEF0FF,0xFFDEEFFF,0xFFDCEEFF,0xFFDAEBFF,0xFFD8E9FF,0xFFD6E7FF,0xFFD3E4FD,
+   0xFFD2E3FB,0xFFD2E2FB,0xFFD2E2FB,0xFFD3E3FC,0xFFD4E5FD,0xFFD5E5FE,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,0xFF6B5C52,
+   0xFF6E6055,0xFF584C45,0xFF000000,0xFF1F2125,0xFFDEF0FF,0xFFE4F6FF,0xFFDFF1FF,
+   0xFFD5E6FF,0xFFCCDCF4,0xFFC3D2E9,0xFFB8C6DC,0xFFAFBDD2,0xFFACB9CD,0xFFAAB8CB,
+   0xFFADBBCF,0xFFB1BED3,0xFFB8C7DD,0xFFC4D4EB,0xFFCBDBF3,0xFFD3E3FC,0xFFDDEEFF,
+   0xFFE2F4FF,0xFFE3F5FF,0xFFE3F5FF,0xFFDFF1FF,0xFFDAEBFF,0xFFD5E6FF,0xFFD2E3FC,
+   0xFFD2E3FB,0xFFD3E4FD,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,0xFF6B5C52,0xFF6C5D53,
+   0xFF7A695E,0xFF493F39,0xFF000000,0xFF2B2F33,0xFF8F9BAA,0xFF636A75,0xFF43474F,
+   0xFF2B2E33,0xFF16181A,0xFF060708,0xFF000000,0xFF000000,0xFF000000,0xFF000000,
+   0xFF000000,0xFF000000,0xFF000000,0xFF070808,0xFF131517,0xFF26292D,0xFF3A3E45,
+   0xFF4E545C,0xFF6C7480,0xFF8993A3,0xFFA3B0C3,0xFFC1D0E7,0xFFD5E6FE,0xFFE1F3FF,
+   0xFFE3F5FF,0xFFDEEFFF,0xFFD6E8FF,0xFFD2E3FC,0xFFD2E3FC,0xFFD4E5FE,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,0xFF726258,0xFF67584F,
+   0xFF4E433C,0xFF1D1917,0xFF030303,0xFF000000,0xFF000000,0xFF000000,0xFF000000,
+   0xFF000000,0xFF000000,0xFF050505,0xFF0E0E0E,0xFF161616,0xFF1A1A1A,0xFF1D1D1D,
+   0xFF181818,0xFF161616,0xFF0F0F0F,0xFF060605,0xFF000000,0xFF000000,0xFF000000,
+   0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF09090B,0xFF2A2D32,0xFF4D535B,
+   0xFF7E8896,0xFFAEBCCE,0xFFD1E1F7,0xFFE2F4FF,0xFFE0F2FF,0xFFD7E8FF,0xFFD2E2FB,
+   0xFFD4E4FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF6C5D53,0xFF6C5D53,0xFF6C5D53,0xFF6B5D52,0xFF716157,0xFF3C332E,0xFF0F0D0C,
+   0xFF000000,0xFF000000,0xFF000000,0xFF0F0F0F,0xFF3A3A3B,0xFF676868,0xFF909091,
+   0xFFB4B4B4,0xFFCACACA,0xFFDCDCDC,0xFFE9EAEA,0xFFF4F4F4,0xFFF8F8F8,0xFFF8F8F8,
+   0xFFF7F7F7,0xFFF5F5F5,0xFFEBEBEB,0xFFDEDEDE,0xFFD1D1D1,0xFFBEBEBE,0xFFA6A6A6,
+   0xFF878787,0xFF656566,0xFF454546,0xFF202020,0xFF030303,0xFF000000,0xFF000000,
+   0xFF000000,0xFF000000,0xFF232528,0xFF5B626B,0xFF9BA7B9,0xFFD0E0F7,0xFFE3F6FF,
+   0xFFDBEDFF,0xFFD2E3FC,0xFFD4E4FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF6C5D53,0xFF6C5D53,0xFF6A5C52,0xFF736358,0xFF413832,0xFF000000,0xFF000000,
+   0xFF201F1F,0xFF696969,0xFFB2B2B2,0xFFE6E6E6,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFF8F8F8,0xFFD9D9D9,0xFFB4B5B5,0xFF7D7D7D,
+   0xFF464646,0xFF111111,0xFF000000,0xFF000000,0xFF000000,0xFF222427,0xFF6B747D,
+   0xFFBCCBDC,0xFFE3F5FF,0xFFDAECFF,0xFFD2E2FC,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF6C5D53,0xFF6B5C53,0xFF706056,0xFF5C4F47,0xFF060505,0xFF000000,0xFF717171,
+   0xFFF2F2F2,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFBFBFB,0xFFFBFBFB,
+   0xFFFCFCFC,0xFFFCFCFC,0xFFFDFDFD,0xFFFEFEFE,0xFFFEFEFE,0xFFFEFEFE,0xFFFEFEFE,
+   0xFFFEFEFE,0xFFFEFEFE,0xFFFEFEFE,0xFFFDFDFD,0xFFFDFDFD,0xFFFCFCFC,0xFFFBFBFB,
+   0xFFFBFBFB,0xFFFBFBFB,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFE8E8E8,0xFFACACAD,0xFF636363,0xFF1A1A1A,0xFF000000,0xFF000000,
+   0xFF0D0E0F,0xFF5D646D,0xFFBECDDE,0xFFE3F5FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF6C5D53,0xFF6B5C52,0xFF716257,0xFF25201D,0xFF000000,0xFF393939,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFBFBFB,0xFFFCFCFC,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFFFDFDFD,0xFFFCFCFC,0xFFFBFBFB,
+   0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFEDEDED,0xFFA1A1A1,0xFF3F3F40,
+   0xFF000000,0xFF000000,0xFF111214,0xFF77808C,0xFFD8EAFE,0xFFD8E9FF,0xFFD4E5FE,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF6B5C52,0xFF716157,0xFF574A42,0xFF020302,0xFF020202,0xFFC1C1C1,0xFFFFFFFF,
+   0xFFFBFBFB,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFEFEFE,0xFFFCFCFC,0xFFFCFCFC,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFB4B4B4,0xFF3C3C3C,0xFF000000,0xFF000000,0xFF373C43,0xFFCDDDF0,0xFFD7E8FE,
+   0xFFD5E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF6A5C52,0xFF736359,0xFF2F2824,0xFF000000,0xFF3E3E3E,0xFFFFFFFF,0xFFFDFDFD,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFFFCFCFC,0xFFFEFEFE,
+   0xFFFFFFFF,0xFFFDFDFD,0xFF929293,0xFF111112,0xFF000000,0xFF808A9A,0xFFE3F5FF,
+   0xFFD2E3FB,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF6D5E54,0xFF675950,0xFF0E0C0B,0xFF000000,0xFFA3A3A3,0xFFFFFFFF,0xFFFBFBFB,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFCFCFC,0xFFFCFCFC,0xFFFFFFFF,0xFF7D7D7E,0xFF020203,0xFF40444B,0xFFDEEFFF,
+   0xFFD3E4FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF726258,0xFF4F443D,0xFF000000,0xFF121211,0xFFEAEAEA,0xFFFFFFFF,0xFFFDFDFD,
+   0xFFFCFCFC,0xFFFBFBFB,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFBFBFB,0xFFFCFCFC,0xFFC5C5C5,0xFF000000,0xFF131416,0xFFC7D7EF,
+   0xFFD9EAFF,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF746459,0xFF352F2A,0xFF000000,0xFF504F4F,0xFFFFFFFF,0xFFFDFDFD,0xFFFDFDFD,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFDFDFD,0xFFFFFFFF,0xFFEAEAEA,0xFF111111,0xFF000000,0xFFB0BED2,
+   0xFFDDEFFF,0xFFD3E4FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF6E5F55,0xFF1D1917,0xFF000000,0xFF919191,0xFFFEFEFE,0xFFF9F9F9,0xFFFFFFFF,
+   0xFFBFBFBF,0xFF8D8D8D,0xFFEDEDED,0xFFFFFFFF,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFF2A2A2A,0xFF000000,0xFF98A4B6,
+   0xFFE1F3FF,0xFFD2E3FC,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF64564D,0xFF090807,0xFF000000,0xFFC8C8C8,0xFFFFFFFF,0xFFFFFFFF,0xFF9F9F9F,
+   0xFF000000,0xFF000000,0xFF444444,0xFFFDFDFD,0xFFFDFDFD,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFFFFFFFF,0xFF3D3E3E,0xFF000000,0xFF8A95A5,
+   0xFFE3F5FF,0xFFD2E3FB,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD4E5FD,0xFFD3E4FC,0xFFD2E3FC,0xFFD2E3FB,0xFFD2E3FB,0xFFD2E3FB,0xFFD2E3FC,
+   0xFFD3E3FC,0xFFD3E4FD,0xFFD4E5FE,0xFFD5E6FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF554941,0xFF000000,0xFF131313,0xFFEDEDED,0xFFFEFEFE,0xFFDADADA,0xFF090909,
+   0xFF000000,0xFF050505,0xFF000000,0xFFCCCCCC,0xFFFFFFFF,0xFFFDFDFD,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFDFDFD,0xFFFFFFFF,0xFF464647,0xFF000000,0xFF848E9D,
+   0xFFE4F6FF,0xFFD2E2FB,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD3E4FD,0xFFD2E3FB,0xFFD5E6FF,
+   0xFFDBECFF,0xFFDFF1FF,0xFFE1F3FF,0xFFE2F4FF,0xFFE2F4FF,0xFFE2F4FF,0xFFE1F3FF,
+   0xFFE0F2FF,0xFFDDEFFF,0xFFD9EAFF,0xFFD5E6FF,0xFFD3E4FD,0xFFD2E2FB,0xFFD2E3FC,
+   0xFFD3E4FD,0xFFD5E6FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF463C36,0xFF000000,0xFF393939,0xFFFEFEFE,0xFFFFFFFF,0xFF656565,0xFF000000,
+   0xFF040404,0xFF030303,0xFF010101,0xFF9B9B9B,0xFFFFFFFF,0xFFFBFBFB,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFFFFFFFF,0xFF444445,0xFF000000,0xFF8691A0,
+   0xFFE4F6FF,0xFFD2E3FB,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD2E3FC,0xFFDCEEFF,0xFFE3F5FF,0xFFD7E8FF,
+   0xFFBECDE2,0xFFA6B4C7,0xFF939FB0,0xFF8893A2,0xFF8892A0,0xFF8B94A3,0xFF939EAE,
+   0xFFA2AFC2,0xFFB3C1D4,0xFFC5D4EA,0xFFD6E6FF,0xFFDFF1FF,0xFFE4F6FF,0xFFE1F3FF,
+   0xFFDCEDFF,0xFFD5E6FF,0xFFD2E3FB,0xFFD2E3FC,0xFFD4E5FD,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF37302B,0xFF000000,0xFF5A5A5A,0xFFFFFFFF,0xFFE8E8E8,0xFF111111,0xFF010101,
+   0xFF020202,0xFF040404,0xFF000000,0xFF888888,0xFFFFFFFF,0xFFFBFBFB,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFFFFFFFF,0xFF383939,0xFF000000,0xFF8E99AA,
+   0xFFE2F4FF,0xFFD2E3FB,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD3E4FE,0xFFD8E9FF,0xFFE1F3FF,0xFFB2C1D4,0xFF676F7B,0xFF2D3035,
+   0xFF090A0C,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,
+   0xFF000000,0xFF000000,0xFF111112,0xFF26282B,0xFF4A4F55,0xFF6D7580,0xFF97A3B3,
+   0xFFB9C8DB,0xFFD6E6FF,0xFFE3F5FF,0xFFE2F4FF,0xFFDAEBFF,0xFFD3E4FD,0xFFD2E3FB,
+   0xFFD3E4FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF292420,0xFF000000,0xFF7A7A7A,0xFFFFFFFF,0xFFA8A8A8,0xFF000000,0xFF020202,
+   0xFF000000,0xFF040404,0xFF000000,0xFF898989,0xFFFFFFFF,0xFFFBFBFB,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFEFEFE,0xFFFFFFFF,0xFFFDFDFD,0xFF262626,0xFF000000,0xFF9EAABD,
+   0xFFE0F1FF,0xFFD3E3FC,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD3E4FE,0xFFD9EBFF,0xFFCEDEF2,0xFF596069,0xFF060707,0xFF000000,0xFF000000,
+   0xFF030303,0xFF242424,0xFF393A3A,0xFF464646,0xFF4A4A4A,0xFF464647,0xFF3A3B3B,
+   0xFF2B2B2C,0xFF161616,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,
+   0xFF050505,0xFF292C30,0xFF5B616B,0xFF909CAA,0xFFC1D0E4,0xFFDDEFFF,0xFFE3F5FF,
+   0xFFDDEEFF,0xFFD4E5FE,0xFFD2E2FB,0xFFD3E4FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFF1F1B19,0xFF000000,0xFF949494,0xFFFFFFFF,0xFF6B6B6B,0xFF010101,0xFF040404,
+   0xFF000000,0xFF030303,0xFF000000,0xFF9B9B9B,0xFFFFFFFF,0xFFFBFBFB,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFEFEFE,0xFFFFFFFF,0xFFEBEBEB,0xFF131313,0xFF000000,0xFFB2C0D5,
+   0xFFDDEEFF,0xFFD3E4FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,
+   0xFFD6E8FD,0xFFD4E5F7,0xFF34383E,0xFF000000,0xFF000000,0xFF4F4F4F,0xFFA6A7A7,
+   0xFFDEDEDE,0xFFF6F6F6,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFCFCFC,0xFFEDEDED,0xFFDBDBDB,0xFFB8B8B8,0xFF919191,0xFF5F5F5F,0xFF313131,
+   0xFF060606,0xFF000000,0xFF000000,0xFF000000,0xFF0D0E0F,0xFF40454B,0xFF7C8592,
+   0xFFB3C1D5,0xFFDAEBFF,0xFFE3F6FF,0xFFDCEDFF,0xFFD3E4FE,0xFFD2E3FC,0xFFD4E5FE,
+   0xFF171412,0xFF000000,0xFFADACAC,0xFFFFFFFF,0xFF3F3F3F,0xFF000000,0xFF030303,
+   0xFF000000,0xFF020202,0xFF000000,0xFFBCBCBC,0xFFFFFFFF,0xFFFCFCFC,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFDFDFD,0xFFFFFFFF,0xFFD3D3D3,0xFF010101,0xFF101114,0xFFC5D5ED,
+   0xFFD9EAFF,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FC,
+   0xFFE2F4FF,0xFF5A616D,0xFF000000,0xFF151515,0xFFB5B5B5,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFFFDFDFD,0xFFFDFDFD,0xFFFDFDFD,0xFFFDFDFD,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFE0E0E0,0xFFACADAD,0xFF6E6F6F,0xFF2F2F2F,0xFF000000,0xFF000000,0xFF000000,
+   0xFF010202,0xFF363A40,0xFF7A8491,0xFFB8C7DA,0xFFDDEFFF,0xFFE2F4FF,0xFFD8EAFF,
+   0xFF100E0D,0xFF000000,0xFFBDBDBD,0xFFFFFFFF,0xFF272727,0xFF000000,0xFF020202,
+   0xFF010101,0xFF000000,0xFF0C0C0C,0xFFE4E4E4,0xFFFFFFFF,0xFFFDFDFD,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFCFCFC,0xFFFFFFFF,0xFFADADAE,0xFF000000,0xFF2D3035,0xFFD8E9FE,
+   0xFFD5E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD3E3FC,0xFFDFF1FF,
+   0xFFA3B0C4,0xFF030202,0xFF030303,0xFFB1B1B1,0xFFFFFFFF,0xFFFBFBFB,0xFFFCFCFC,
+   0xFFFDFDFD,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFEFEFE,0xFFFEFEFE,0xFFFDFDFD,0xFFFCFCFC,0xFFFBFBFB,0xFFFCFCFC,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFCFCFC,0xFFCECECE,0xFF8B8B8B,0xFF434344,
+   0xFF070707,0xFF000000,0xFF000000,0xFF060607,0xFF3E4348,0xFF8C97A4,0xFFC9D9EC,
+   0xFF090908,0xFF000000,0xFFC8C8C8,0xFFFFFFFF,0xFF1B1B1B,0xFF000000,0xFF020202,
+   0xFF030303,0xFF010101,0xFF393939,0xFFFFFFFF,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFBFBFB,0xFFFFFFFF,0xFF7A7A7A,0xFF000000,0xFF535962,0xFFDEF0FB,
+   0xFFCFDFF8,0xFFD2E3FB,0xFFD2E2FB,0xFFD2E3FB,0xFFD2E3FB,0xFFD2E3FB,0xFFD2E3FC,
+   0xFFD3E3FC,0xFFD3E4FD,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD3E4FD,0xFFDDEEFF,
+   0xFF3A3E45,0xFF000000,0xFF5F6060,0xFFFFFFFF,0xFFFAFAFA,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,
+   0xFFFDFDFD,0xFFFCFCFC,0xFFFCFCFC,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFDBDBDB,0xFF909091,0xFF3E3F3F,0xFF010101,0xFF000000,0xFF000000,0xFF17181A,
+   0xFF070605,0xFF000000,0xFFCCCBCB,0xFFFFFFFF,0xFF1D1D1D,0xFF000000,0xFF020202,
+   0xFF040404,0xFF000000,0xFF888888,0xFFFFFFFF,0xFFFBFBFB,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFEFEFE,0xFFFFFFFF,0xFF414142,0xFF000000,0xFF8E99AA,0xFFF2FFFF,
+   0xFFE0F2FF,0xFFE4F6FF,0xFFE4F6FF,0xFFE3F5FF,0xFFE3F5FF,0xFFE2F4FF,0xFFE2F4FF,
+   0xFFE0F1FF,0xFFDCEDFF,0xFFD7E9FF,0xFFD4E5FE,0xFFD2E3FB,0xFFD2E3FB,0xFFD3E4FD,
+   0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FC,0xFFDFF1FF,0xFFA1AEC2,
+   0xFF010102,0xFF0B0B0B,0xFFDCDCDC,0xFFFEFEFE,0xFFFDFDFD,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFFFDFDFD,0xFFFBFBFB,0xFFFEFEFE,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFD2D2D2,0xFF7D7D7D,0xFF29292A,0xFF000000,
+   0xFF060504,0xFF000000,0xFFC9C9C9,0xFFFFFFFF,0xFF2F2F2F,0xFF010101,0xFF040404,
+   0xFF030303,0xFF0C0C0C,0xFFE4E4E4,0xFFFFFFFF,0xFFFDFDFD,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFDFDFD,0xFFFFFFFF,0xFFE6E6E6,0xFF0C0C0C,0xFF000000,0xFF606872,0xFF727B84,
+   0xFF646C78,0xFF626A76,0xFF636B76,0xFF69717D,0xFF737C89,0xFF808B99,0xFF909BAD,
+   0xFFA2AFC2,0xFFB7C5DB,0xFFCCDDF4,0xFFD9EBFF,0xFFE3F5FF,0xFFE2F5FF,0xFFDDEFFF,
+   0xFFD6E7FF,0xFFD2E3FB,0xFFD2E3FC,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FC,0xFFE2F4FF,0xFF515860,
+   0xFF000000,0xFF616262,0xFFFFFFFF,0xFFFCFCFC,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFDFDFD,0xFFFBFBFB,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFF9F9F9,0xFFB5B5B5,
+   0xFF080706,0xFF000000,0xFFC0C0C0,0xFFFFFFFF,0xFF626262,0xFF000000,0xFF080808,
+   0xFF000000,0xFF808080,0xFFFFFFFF,0xFFFCFCFC,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFBFBFB,0xFFFEFEFE,0xFFA6A6A6,0xFF000000,0xFF060707,0xFF000000,0xFF000000,
+   0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,
+   0xFF000000,0xFF0A0B0C,0xFF15171A,0xFF34393E,0xFF565D67,0xFF838E9D,0xFFAFBDCF,
+   0xFFD1E1FA,0xFFE2F4FF,0xFFE1F3FF,0xFFD8E9FF,0xFFD2E3FC,0xFFD3E4FC,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD9EBFF,0xFFC4D3EB,0xFF101113,
+   0xFF000000,0xFFC2C2C2,0xFFFEFEFE,0xFFFCFCFC,0xFFFFFFFF,0xFFFFFFFF,0xFFFDFDFD,
+   0xFFFCFCFC,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFDFDFD,0xFFFBFBFB,0xFFFFFFFF,0xFFFFFFFF,
+   0xFF070606,0xFF000000,0xFFB7B7B7,0xFFFFFFFF,0xFFD1D1D1,0xFF101010,0xFF000000,
+   0xFF565656,0xFFF9F9F9,0xFFFDFDFD,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFDFDFD,0xFFFFFFFF,0xFF535353,0xFF010101,0xFF000000,0xFF000000,0xFF000000,
+   0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,
+   0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF030303,
+   0xFF212428,0xFF545B65,0xFF939FAF,0xFFC9D9EF,0xFFE2F4FF,0xFFDFF0FF,0xFFD4E5FE,
+   0xFFD2E3FC,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FC,0xFFE2F4FF,0xFF8F9BAB,0xFF000000,
+   0xFF292A29,0xFFFAFAFA,0xFFFEFEFE,0xFFFEFEFE,0xFFFFFFFF,0xFFFDFDFD,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFFFCFCFC,
+   0xFF050505,0xFF000000,0xFFA8A8A8,0xFFFFFFFF,0xFFFFFFFF,0xFFD9D9D9,0xFFBCBCBC,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFDFDFD,
+   0xFFFFFFFF,0xFFE6E6E6,0xFF0E0E0E,0xFF000000,0xFF363B42,0xFF52595F,0xFF5F6672,
+   0xFF68707D,0xFF6C7481,0xFF68717D,0xFF606873,0xFF525962,0xFF41464E,0xFF2D3136,
+   0xFF161719,0xFF050506,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF010102,
+   0xFF000000,0xFF000000,0xFF000000,0xFF17181B,0xFF596069,0xFFA7B4C6,0xFFDAECFF,
+   0xFFE1F3FF,0xFFD5E6FF,0xFFD2E3FC,0xFFD2E3FC,0xFFE1F4FF,0xFF545A63,0xFF010101,
+   0xFF727273,0xFFFFFFFF,0xFFFCFCFC,0xFFFFFFFF,0xFFFDFDFD,0xFFFFFFFF,0xFFD0D0D0,
+   0xFFBFBFBF,0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFF000000,0xFF000000,0xFF8D8D8D,0xFFFFFFFF,0xFFFAFAFA,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFEFEFE,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFBFBFB,
+   0xFFFFFFFF,0xFF919292,0xFF000000,0xFF25292C,0xFFD9EAFF,0xFFE2F4FF,0xFFE0F2FF,
+   0xFFE2F4FF,0xFFE2F4FF,0xFFE3F5FF,0xFFE3F5FF,0xFFE3F5FF,0xFFE0F2FF,0xFFD7E8FF,
+   0xFFCBDBF3,0xFFB6C4D8,0xFF949FB0,0xFF6B727B,0xFF3A3E44,0xFF111213,0xFF000000,
+   0xFF000000,0xFF000000,0xFF040404,0xFF000000,0xFF000000,0xFF000000,0xFF353A3F,
+   0xFF929EAC,0xFFD7E9FF,0xFFE0F2FF,0xFFD4E4FD,0xFFD1E2F9,0xFF222528,0xFF000000,
+   0xFFB5B6B6,0xFFFFFFFF,0xFFFCFCFC,0xFFFCFCFC,0xFFFFFFFF,0xFF848484,0xFF030303,
+   0xFF000000,0xFF7A7A7A,0xFFFFFFFF,0xFFFCFCFC,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFF32363C,0xFF000000,0xFF6C6C6C,0xFFFFFFFF,0xFFFBFBFB,0xFFFDFDFD,0xFFFCFCFC,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFFFEFEFE,
+   0xFFFAFAFA,0xFF2B2B2B,0xFF000000,0xFF798391,0xFFEAFDFF,0xFFD8E9FF,0xFFDBECFF,
+   0xFFD8E9FF,0xFFD4E5FE,0xFFCFE0F8,0xFFCFDFF8,0xFFD1E2FA,0xFFD3E3FC,0xFFD5E6FF,
+   0xFFD8E9FF,0xFFDCEDFF,0xFFE1F3FF,0xFFE3F6FF,0xFFDDEEFF,0xFFC7D6EB,0xFF9AA4B3,
+   0xFF5B6068,0xFF1D1E20,0xFF000000,0xFF000000,0xFF010102,0xFF040404,0xFF000000,
+   0xFF000000,0xFF2F3339,0xFF96A2B1,0xFFE6F9FF,0xFFBCCBE0,0xFF030404,0xFF0C0C0C,
+   0xFFE6E6E6,0xFFFFFFFF,0xFFFBFBFB,0xFFFFFFFF,0xFFA1A1A1,0xFF000000,0xFF020202,
+   0xFF010101,0xFF0A0A0A,0xFFE8E8E8,0xFFFFFFFF,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFF707986,0xFF000000,0xFF464647,0xFFFFFFFF,0xFFFDFDFD,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFCFCFC,0xFFFFFFFF,
+   0xFFA8A8A8,0xFF000000,0xFF17191C,0xFFB9C8DD,0xFFB8C7D7,0xFFA8B5C9,0xFFACBACE,
+   0xFFBDCCE2,0xFFD0E0F8,0xFFE0F2FF,0xFFE2F4FF,0xFFD8EAFF,0xFFD2E3FB,0xFFD4E4FD,
+   0xFFD4E5FE,0xFFD3E4FD,0xFFD2E3FC,0xFFD2E2FB,0xFFD3E4FD,0xFFD8EAFF,0xFFE1F3FF,
+   0xFFE3F5FF,0xFFCFDEF4,0xFF99A4B1,0xFF494E53,0xFF070708,0xFF000000,0xFF000000,
+   0xFF050506,0xFF000000,0xFF000000,0xFF4E555B,0xFF76808D,0xFF000000,0xFF343434,
+   0xFFFEFEFE,0xFFFDFDFD,0xFFFEFEFE,0xFFE8E8E8,0xFF131313,0xFF020202,0xFF030303,
+   0xFF020202,0xFF000000,0xFFBCBCBC,0xFFFFFFFF,0xFFFCFCFC,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFF95A1B2,0xFF000000,0xFF171717,0xFFF2F2F2,0xFFFFFFFF,0xFFFEFEFE,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFFFDFDFD,0xFFFAFAFA,
+   0xFF2B2B2B,0xFF020202,0xFF141517,0xFF131517,0xFF000000,0xFF000000,0xFF000000,
+   0xFF000000,0xFF1D2022,0xFF4B5159,0xFF8B95A5,0xFFC8D8EE,0xFFE3F5FF,0xFFD8EAFF,
+   0xFFD2E3FC,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD2E3FC,
+   0xFFD2E3FC,0xFFD7E8FF,0xFFE1F3FF,0xFFE0F2FF,0xFFB9C7D8,0xFF687079,0xFF141517,
+   0xFF000000,0xFF000000,0xFF040405,0xFF000000,0xFF000000,0xFF000000,0xFF5C5C5C,
+   0xFFFFFFFF,0xFFF8F8F8,0xFFFFFFFF,0xFF7B7B7B,0xFF000000,0xFF040404,0xFF000000,
+   0xFF030303,0xFF010101,0xFFAEAEAE,0xFFFFFFFF,0xFFFBFBFB,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFC1D0E8,0xFF111214,0xFF000000,0xFFBFBFBF,0xFFFCFCFC,0xFFFAFAFA,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFBFBFB,0xFFFFFFFF,0xFF8E8E8E,
+   0xFF000000,0xFF000000,0xFF000000,0xFF070708,0xFF2C3034,0xFF3B3F46,0xFF32363C,
+   0xFF181A1D,0xFF000000,0xFF000000,0xFF000000,0xFF131417,0xFF6C7480,0xFFCCDCEF,
+   0xFFE2F4FF,0xFFD2E3FC,0xFFD5E5FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD4E5FE,0xFFD2E3FC,0xFFD2E3FD,0xFFDBEDFF,0xFFE3F6FF,0xFFC5D5E7,
+   0xFF6E7681,0xFF111315,0xFF000000,0xFF020202,0xFF050505,0xFF000000,0xFF888888,
+   0xFFFFFFFF,0xFFFDFDFD,0xFFF3F3F3,0xFF1A1A1A,0xFF010101,0xFF020202,0xFF000000,
+   0xFF030303,0xFF000000,0xFFB2B2B2,0xFFFFFFFF,0xFFFCFCFC,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFDFF2FF,0xFF464B53,0xFF020202,0xFF686868,0xFFFFFFFF,0xFFFFFFFF,0xFFFBFBFB,
+   0xFFFCFCFC,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFBFBFB,0xFFFFFFFF,0xFFD8D8D8,0xFF0D0D0E,
+   0xFF000000,0xFF131417,0xFF7D8793,0xFFC4D4E6,0xFFD8E9FF,0xFFDCEDFF,0xFFDAEBFF,
+   0xFFD0E0F9,0xFFB4C3D5,0xFF86919E,0xFF474C53,0xFF090A0B,0xFF000000,0xFF0D0E10,
+   0xFF909BA9,0xFFE5F7FF,0xFFD6E8FF,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD3E4FD,0xFFD2E2FC,0xFFD9EAFF,
+   0xFFE4F6FF,0xFFC3D1E4,0xFF5E656E,0xFF060606,0xFF040404,0xFF000000,0xFFA7A7A7,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFB1B1B1,0xFF000000,0xFF020202,0xFF000000,0xFF000000,
+   0xFF010101,0xFF000000,0xFFC4C4C4,0xFFFFFFFF,0xFFFCFCFC,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFE2F4FF,0xFF95A0B3,0xFF000000,0xFF0A0B0B,0xFF858585,0xFFEAEAEA,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFDFDFD,0xFFFBFBFB,0xFFFBFBFB,0xFFFDFDFD,0xFFFDFDFD,
+   0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFFFEFEFE,0xFFFDFDFD,
+   0xFFFCFCFC,0xFFFBFBFB,0xFFFCFCFC,0xFFFFFFFF,0xFFFCFCFC,0xFF3A3A3B,0xFF000000,
+   0xFF26292E,0xFFBCCBDB,0xFFE6F8FF,0xFFD9EAFF,0xFFD4E5FF,0xFFD4E5FD,0xFFD4E5FE,
+   0xFFD7E8FF,0xFFDDEEFF,0xFFE3F5FF,0xFFE0F2FF,0xFFC3D3E6,0xFF8B96A3,0xFF3B3F44,
+   0xFF040506,0xFF596069,0xFFD4E5F7,0xFFD6E7FE,0xFFD5E6FE,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,
+   0xFFD1E2FB,0xFFD9EAFF,0xFFE5F7FF,0xFFA6B3C6,0xFF0E0F11,0xFF000000,0xFFC4C4C4,
+   0xFFFFFFFF,0xFFFFFFFF,0xFF696969,0xFF010101,0xFF040404,0xFF000000,0xFF010101,
+   0xFF000000,0xFF0B0B0B,0xFFE4E4E4,0xFFFFFFFF,0xFFFDFDFD,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FD,0xFFD7E9FC,0xFF42474F,0xFF000000,0xFF000000,0xFF191919,0xFF6A6B6B,
+   0xFFB5B5B6,0xFFECECEC,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFEFEFE,0xFFFDFDFD,0xFFFCFCFC,0xFFFBFBFB,0xFFFBFBFB,0xFFFBFBFB,
+   0xFFFBFBFB,0xFFFBFBFB,0xFFFBFBFB,0xFFFBFBFB,0xFFFBFBFB,0xFFFBFBFB,0xFFFBFBFB,
+   0xFFFBFBFB,0xFFFCFCFC,0xFFFCFCFC,0xFFFDFDFD,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFE4E4E4,0xFF616161,0xFF000000,0xFF16181A,
+   0xFFBFCEE1,0xFFE0F2FF,0xFFD0E1FA,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD4E5FE,0xFFD3E4FD,0xFFD2E3FC,0xFFD3E3FD,0xFFDAEBFF,0xFFE3F5FF,0xFFE0F2FF,
+   0xFFBECEDF,0xFF6B7380,0xFF8A95A6,0xFFD9EBFC,0xFFD4E5FD,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD3E4FC,0xFFD6E7FC,0xFFCEDEF6,0xFF131517,0xFF000000,0xFFD9D9DA,
+   0xFFFFFFFF,0xFFFEFEFE,0xFF333333,0xFF000000,0xFF030303,0xFF000000,0xFF020202,
+   0xFF000000,0xFF2E2E2E,0xFFFDFDFD,0xFFFEFEFE,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD4E5FE,0xFFD6E8FE,0xFFD8E9FD,0xFF808A98,0xFF24272A,0xFF000000,0xFF000000,
+   0xFF000000,0xFF161616,0xFF454546,0xFF7C7C7C,0xFFA4A4A4,0xFFCCCCCD,0xFFE5E5E5,
+   0xFFF6F6F6,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFDFDFD,0xFFECECEC,0xFFD5D5D5,
+   0xFFAEAEAE,0xFF808080,0xFF464646,0xFF0E0E0E,0xFF000000,0xFF000000,0xFF939FB1,
+   0xFFE3F6FF,0xFFD0E1FB,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD2E3FC,0xFFD3E4FD,
+   0xFFDBEDFF,0xFFE5F7FF,0xFFD2E3FB,0xFFD3E4FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD4E4FD,0xFFDBECFF,0xFFB9C8DE,0xFF050607,0xFF090909,0xFFE6E6E6,
+   0xFFFFFFFF,0xFFEBEBEB,0xFF121212,0xFF000000,0xFF010101,0xFF000000,0xFF040404,
+   0xFF010101,0xFF6C6C6C,0xFFFFFFFF,0xFFFBFBFB,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD4E5FF,0xFFD5E6FF,0xFFE3F5FF,0xFFD0E0F5,0xFF939EAC,0xFF4F555D,
+   0xFF1A1C1E,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF090909,
+   0xFF232323,0xFF393939,0xFF4D4D4E,0xFF646464,0xFF767777,0xFF838384,0xFF8F8F90,
+   0xFF979797,0xFF9A9B9B,0xFF9F9F9F,0xFF9D9D9D,0xFF999999,0xFF949494,0xFF898A8A,
+   0xFF7D7D7E,0xFF6E6E6F,0xFF595A5A,0xFF444444,0xFF2E2E2E,0xFF151616,0xFF000000,
+   0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF0A0B0C,0xFF40464D,0xFFE1F2FF,
+   0xFFD2E3FB,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD4E4FD,0xFFD2E3FB,0xFFD6E7FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD3E4FD,0xFFDCEEFF,0xFFB5C4D9,0xFF000000,0xFF141413,0xFFEBEBEB,
+   0xFFFFFFFF,0xFFD4D4D4,0xFF040404,0xFF000000,0xFF010101,0xFF000000,0xFF020202,
+   0xFF000000,0xFFBDBDBD,0xFFFFFFFF,0xFFFCFCFC,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FE,0xFFD2E3FC,0xFFD7E8FF,0xFFE1F3FF,0xFFE1F3FF,
+   0xFFCCDCF4,0xFFABB9CD,0xFF848E9B,0xFF595F69,0xFF363A3E,0xFF191A1D,0xFF060606,
+   0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,
+   0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,
+   0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF0D0D0D,
+   0xFF25272A,0xFF494F56,0xFF737C89,0xFFB8C7D4,0xFF6E7783,0xFF9DAABC,0xFFE1F3FE,
+   0xFFD3E3FC,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD3E4FD,0xFFDEEFFF,0xFFB1BFD3,0xFF000000,0xFF1A1A1B,0xFFEEEEEE,
+   0xFFFFFFFF,0xFFCBCBCB,0xFF000000,0xFF000000,0xFF000000,0xFF030303,0xFF010101,
+   0xFF2A2A2A,0xFFFAFAFA,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD2E3FC,0xFFD2E3FC,
+   0xFFD7E9FF,0xFFDEF0FF,0xFFE3F5FF,0xFFE2F4FF,0xFFDBECFF,0xFFCDDDF4,0xFFBBC9DE,
+   0xFFA9B6C9,0xFF949FAF,0xFF838D9A,0xFF717985,0xFF626A75,0xFF595F6A,0xFF4F555D,
+   0xFF484D55,0xFF444950,0xFF40454C,0xFF40454C,0xFF43484F,0xFF464B53,0xFF4D535B,
+   0xFF555C66,0xFF606772,0xFF6F7784,0xFF818A97,0xFF98A2B1,0xFFAFBBCC,0xFFC1CFE3,
+   0xFFD5E5FD,0xFFDFF1FF,0xFFE3F5FF,0xFFE1F3FF,0xFFC1D1E7,0xFFD1E2FA,0xFFD6E7FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD3E4FD,0xFFDEEFFF,0xFFB0BED3,0xFF000000,0xFF1B1B1B,0xFFEFEFEF,
+   0xFFFFFFFF,0xFFD1D1D1,0xFF030303,0xFF000000,0xFF010101,0xFF050505,0xFF000000,
+   0xFF9E9E9E,0xFFFFFFFF,0xFFFBFBFB,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD4E5FE,0xFFD3E4FD,0xFFD2E3FB,0xFFD2E3FC,0xFFD4E5FE,0xFFD7E8FF,0xFFDBEDFF,
+   0xFFDFF1FF,0xFFE1F3FF,0xFFE3F5FF,0xFFE5F7FF,0xFFE4F6FF,0xFFE2F4FF,0xFFE0F2FF,
+   0xFFDEF0FF,0xFFDEEFFF,0xFFDDEFFF,0xFFDDEFFF,0xFFDDEFFF,0xFFDEF0FF,0xFFE0F1FF,
+   0xFFE1F3FF,0xFFE4F6FF,0xFFE5F7FF,0xFFE3F5FF,0xFFE1F3FF,0xFFDEF0FF,0xFFDAECFF,
+   0xFFD5E7FF,0xFFD3E4FD,0xFFD2E3FB,0xFFD2E3FD,0xFFD8E9FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD3E4FD,0xFFDDEFFF,0xFFB2C0D5,0xFF000000,0xFF191919,0xFFEFEFEF,
+   0xFFFFFFFF,0xFFEDEDED,0xFF111111,0xFF030303,0xFF080808,0xFF000000,0xFF383838,
+   0xFFFBFBFB,0xFFFDFDFD,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD4E4FD,
+   0xFFD3E4FC,0xFFD2E3FC,0xFFD2E3FB,0xFFD1E2FB,0xFFD2E2FB,0xFFD2E3FC,0xFFD3E3FC,
+   0xFFD3E4FD,0xFFD3E4FD,0xFFD3E4FD,0xFFD3E4FD,0xFFD3E4FC,0xFFD2E3FB,0xFFD1E1FA,
+   0xFFD0E0F9,0xFFD0E1F9,0xFFD2E2FB,0xFFD2E3FB,0xFFD2E3FC,0xFFD3E4FC,0xFFD4E5FD,
+   0xFFD5E6FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD3E4FD,0xFFDCEDFF,0xFFB8C7DD,0xFF030304,0xFF0E0E0E,0xFFE9E9E9,
+   0xFFFFFFFF,0xFFFFFFFF,0xFF5B5B5B,0xFF000000,0xFF000000,0xFF1B1B1B,0xFFDBDBDB,
+   0xFFFFFFFF,0xFFFDFDFD,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD3E4FD,0xFFD2E3FC,
+   0xFFD2E3FB,0xFFD1E2FB,0xFFD2E3FC,0xFFD4E5FE,0xFFD6E7FF,0xFFDAECFF,0xFFDEF0FF,
+   0xFFE4F6FF,0xFFDCEEFF,0xFFD4E5FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD4E5FD,0xFFD9EBFF,0xFFC2D1E7,0xFF0C0E0F,0xFF020202,0xFFE0E0E0,
+   0xFFFFFFFF,0xFFFDFDFD,0xFFE9E9E9,0xFF656565,0xFF626262,0xFFDDDDDD,0xFFFFFFFF,
+   0xFFFDFDFD,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD4E5FD,0xFFD2E3FC,0xFFD2E2FB,0xFFD3E4FD,0xFFD7E8FF,0xFFDCEDFF,0xFFE0F2FF,
+   0xFFE3F5FF,0xFFE5F7FF,0xFFE1F3FF,0xFFDCEDFF,0xFFD3E4FD,0xFFC2D1E7,0xFFABB9CD,
+   0xFF858F9F,0xFFA3B0C4,0xFFDAEBFF,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD4E5FE,0xFFD6E8FF,0xFFD0E0F8,0xFF1A1D20,0xFF000000,0xFFC8C9C9,
+   0xFFFFFFFF,0xFFFCFCFC,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFDFDFD,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD2E3FC,0xFFD3E4FD,
+   0xFFDAECFF,0xFFE1F3FF,0xFFE4F6FF,0xFFDDEFFF,0xFFCFDFF8,0xFFB9C8DC,0xFFA2AFC2,
+   0xFF8691A0,0xFF6B7480,0xFF4F555E,0xFF2F3338,0xFF131416,0xFF000000,0xFF070708,
+   0xFF525962,0xFFC2D1E3,0xFFD8E9FE,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFDBECFF,0xFF34383D,0xFF000000,0xFFA8A8A9,
+   0xFFFFFFFF,0xFFFBFBFB,0xFFFEFEFE,0xFFFCFCFC,0xFFFCFCFC,0xFFFDFDFD,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FC,0xFFD7E8FF,0xFFE3F5FF,0xFFDDEFFF,
+   0xFFBFCEE3,0xFF94A0B0,0xFF656D79,0xFF3E4249,0xFF1B1D20,0xFF020202,0xFF000000,
+   0xFF000000,0xFF000000,0xFF000000,0xFF040405,0xFF2F3338,0xFF707986,0xFFBBCADE,
+   0xFFE3F5FF,0xFFDAECFF,0xFFD4E5FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD2E2FC,0xFFE3F5FF,0xFF595F68,0xFF000000,0xFF7A7A7B,
+   0xFFFFFFFF,0xFFFBFBFB,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD3E3FD,0xFFE0F2FF,0xFFCFE0F4,0xFF8892A0,0xFF3F444A,
+   0xFF0E0F10,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF0F1011,0xFF2E3237,
+   0xFF545A63,0xFF7A8593,0xFFA3AFC2,0xFFC4D4EA,0xFFDDEEFF,0xFFE4F6FF,0xFFDBEDFF,
+   0xFFD2E3FC,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD2E2FB,0xFFE3F5FF,0xFF858F9D,0xFF000000,0xFF3B3B3C,
+   0xFFFFFFFF,0xFFFCFCFC,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD3E4FD,0xFFE0F2FF,0xFF98A5B4,0xFF23262A,0xFF000000,0xFF000000,
+   0xFF000000,0xFF212326,0xFF555C63,0xFF838E9D,0xFFACB9CD,0xFFC6D6EB,0xFFD9EAFF,
+   0xFFE1F4FF,0xFFE4F6FF,0xFFE0F1FF,0xFFDAEBFF,0xFFD4E5FE,0xFFD2E3FB,0xFFD4E4FD,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD3E4FD,0xFFDCEDFF,0xFFB8C7DD,0xFF070708,0xFF070707,
+   0xFFD7D7D7,0xFFFFFFFF,0xFFFAFAFA,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD2E3FC,0xFFE0F2FF,0xFF929DAD,0xFF000000,0xFF000000,0xFF010102,0xFF4C5259,
+   0xFF9EABBA,0xFFD0E1F5,0xFFE1F4FF,0xFFE3F5FF,0xFFDEF0FF,0xFFD9EAFF,0xFFD4E5FE,
+   0xFFD2E3FC,0xFFD2E2FB,0xFFD3E3FC,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD3E4FD,0xFFDEEFFF,0xFF3B4047,0xFF000000,
+   0xFF303131,0xFFC4C4C4,0xFFFFFFFF,0xFFFFFFFF,0xFFFBFBFB,0xFFFEFEFE,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,
+   0xFFD6E8FE,0xFFD1E1F6,0xFF1C1E22,0xFF000000,0xFF2E3237,0xFFB1BFCF,0xFFECFFFF,
+   0xFFE5F7FF,0xFFD7E9FF,0xFFD0E1FA,0xFFCEDFF7,0xFFD0E1F9,0xFFD2E3FC,0xFFD4E5FE,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD3E4FC,0xFFDDEEFE,0xFFADBBCC,0xFF16181B,
+   0xFF000000,0xFF040404,0xFF6F6F6F,0xFFE9E9E9,0xFFFFFFFF,0xFFFFFFFF,0xFFFCFCFC,
+   0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD3E3FC,
+   0xFFDFF1FF,0xFF9EABC0,0xFF0B0A0F,0xFF0A0A0E,0xFF545A67,0xFF98A4B1,0xFFA0ACC1,
+   0xFFBBCAE1,0xFFD2E2FA,0xFFDEF0FF,0xFFE4F7FF,0xFFE2F4FF,0xFFDDEEFF,0xFFD6E7FF,
+   0xFFD3E3FC,0xFFD2E2FB,0xFFD3E4FC,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD3E4FE,0xFFDDEFFF,0xFFC4D2E4,
+   0xFF4C5259,0xFF000000,0xFF000000,0xFF1E1E1E,0xFF909090,0xFFF4F4F4,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFCFCFC,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD3E4FC,
+   0xFFDEF0FF,0xFFA8B6CA,0xFF000000,0xFF010101,0xFF000000,0xFF000000,0xFF000000,
+   0xFF0A0B0C,0xFF1D1F23,0xFF41464F,0xFF646D77,0xFF909CAD,0xFFB3C1D4,0xFFD1E2F9,
+   0xFFE0F2FF,0xFFE3F6FF,0xFFDEF0FF,0xFFD7E8FF,0xFFD2E3FC,0xFFD2E3FC,0xFFD4E5FD,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD3E3FD,0xFFDAEBFF,
+   0xFFE0F2FF,0xFF98A4B2,0xFF2B2E32,0xFF000000,0xFF000000,0xFF2D2E2E,0xFFA0A0A0,
+   0xFFFAFAFA,0xFFFFFFFF,0xFFFFFFFF,0xFFFCFCFC,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,
+   0xFFD9EBFF,0xFFC4D4EC,0xFF0D0F10,0xFF000000,0xFF0E0E15,0xFF0D0D12,0xFF070709,
+   0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF020202,0xFF1C1E21,
+   0xFF474D56,0xFF798390,0xFFABB9CA,0xFFCFE0F8,0xFFE1F3FF,0xFFE3F4FF,0xFFDAECFF,
+   0xFFD3E4FD,0xFFD2E2FB,0xFFD4E4FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD3E4FE,
+   0xFFD3E3FD,0xFFE1F3FF,0xFFD4E4F9,0xFF808A95,0xFF1C1E21,0xFF000000,0xFF000000,
+   0xFF333333,0xFFA5A5A5,0xFFFBFBFB,0xFFFFFFFF,0xFFFFFFFF,0xFFFBFBFB,0xFFFEFEFE,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD4E5FE,0xFFDBECFF,0xFF34373D,0xFF000000,0xFF232334,0xFF2C2C43,0xFF27273B,
+   0xFF252538,0xFF212131,0xFF1D1D2A,0xFF16161F,0xFF0E0E13,0xFF040406,0xFF000000,
+   0xFF000000,0xFF000000,0xFF000000,0xFF1B1D21,0xFF4C535C,0xFF8A95A4,0xFFBFCEE2,
+   0xFFDDEFFF,0xFFE3F5FF,0xFFDBECFF,0xFFD3E4FD,0xFFD2E3FC,0xFFD4E5FE,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD2E3FC,0xFFD5E7FF,0xFFE3F6FF,0xFFC9D9EC,0xFF717A84,0xFF17191B,
+   0xFF000000,0xFF000000,0xFF333333,0xFF9C9C9C,0xFFF6F6F6,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFBFBFB,0xFFFDFDFD,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD2E3FB,0xFFE4F6FF,0xFF6D7682,0xFF000000,0xFF15151F,0xFF2F2F48,0xFF2B2B42,
+   0xFF2C2C43,0xFF2C2C43,0xFF2C2C43,0xFF2C2C42,0xFF2B2B40,0xFF27273B,0xFF222333,
+   0xFF1B1C29,0xFF13131A,0xFF07070A,0xFF000000,0xFF000000,0xFF000000,0xFF090A0B,
+   0xFF3A3F45,0xFF7D8693,0xFFBCCCDE,0xFFDEF0FF,0xFFE2F4FF,0xFFD8E9FF,0xFFD2E3FB,
+   0xFFD3E4FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E5FE,0xFFD2E2FC,0xFFD8E9FF,0xFFE4F6FF,0xFFC5D5E7,
+   0xFF6C747F,0xFF17181A,0xFF000000,0xFF000000,0xFF2C2C2C,0xFF909091,0xFFEBEBEB,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFCFCFC,0xFFFCFCFC,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD3E4FD,0xFFDDEFFF,0xFFB1BFD5,0xFF030304,0xFF040507,0xFF2C2C44,0xFF2F2F49,
+   0xFF2D2D46,0xFF2D2D45,0xFF2C2C44,0xFF2B2B43,0xFF2B2B42,0xFF2B2B42,0xFF2C2C43,
+   0xFF2C2C43,0xFF2C2C42,0xFF29293D,0xFF232335,0xFF1A1A27,0xFF0E0E14,0xFF000001,
+   0xFF000000,0xFF000000,0xFF080809,0xFF40454B,0xFF8994A1,0xFFC9DAEE,0xFFE3F5FF,
+   0xFFDEEFFF,0xFFD4E4FE,0xFFD2E3FC,0xFFD5E6FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD1E2FB,0xFFD9EAFF,
+   0xFFE4F6FF,0xFFC6D5E8,0xFF717A85,0xFF1C1D20,0xFF000000,0xFF000000,0xFF1E1E1E,
+   0xFF7F7F7F,0xFFDCDCDC,0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFFFCFCFC,0xFFFEFEFE,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD3E4FD,0xFFDEF0FF,0xFF3F444B,0xFF000000,0xFF1C1C2A,0xFF343452,
+   0xFF2F2F4B,0xFF2F2F4B,0xFF2F2F4A,0xFF2E2E49,0xFF2E2E48,0xFF2D2D47,0xFF2D2D45,
+   0xFF2C2C44,0xFF2B2B43,0xFF2B2B43,0xFF2C2C44,0xFF2D2D45,0xFF2C2C42,0xFF27273A,
+   0xFF1E1E2D,0xFF111119,0xFF000001,0xFF000000,0xFF000000,0xFF17191C,0xFF5F6671,
+   0xFFADBACC,0xFFDCEEFF,0xFFE1F3FF,0xFFD5E6FF,0xFFD2E3FC,0xFFD4E5FE,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,
+   0xFFD2E2FB,0xFFD9EAFF,0xFFE4F6FF,0xFFC9D9ED,0xFF7E8894,0xFF282A2F,0xFF000000,
+   0xFF000000,0xFF0D0D0D,0xFF626262,0xFFC5C5C5,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFBFBFB,0xFFFDFDFD,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD3E4FC,0xFFDFF1FF,0xFFA4B1C6,0xFF010201,0xFF050507,0xFF2D2D48,
+   0xFF343454,0xFF32324F,0xFF31314F,0xFF31314E,0xFF30304D,0xFF30304C,0xFF2F2F4B,
+   0xFF2F2F4A,0xFF2E2E49,0xFF2E2E48,0xFF2D2D46,0xFF2C2C45,0xFF2C2C44,0xFF2D2D45,
+   0xFF2E2E46,0xFF2D2D45,0xFF27273C,0xFF1D1D2B,0xFF0D0E14,0xFF000000,0xFF000000,
+   0xFF000000,0xFF3B3F45,0xFF949FAE,0xFFD5E6FD,0xFFE3F5FF,0xFFD6E7FF,0xFFD2E3FC,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD4E5FE,0xFFD2E2FB,0xFFD8E9FF,0xFFE3F6FF,0xFFD2E3F8,0xFF8D98A4,
+   0xFF363A3F,0xFF000000,0xFF000000,0xFF000000,0xFF424243,0xFFA2A2A2,0xFFF1F1F1,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFEFEFE,0xFFFCFCFC,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FC,0xFFE2F4FF,0xFF525964,0xFF000000,0xFF11111B,
+   0xFF373759,0xFF343455,0xFF343454,0xFF333353,0xFF333352,0xFF323251,0xFF323250,
+   0xFF31314F,0xFF31314E,0xFF30304D,0xFF30304C,0xFF2F2F4B,0xFF2F2F4A,0xFF2E2E48,
+   0xFF2E2E47,0xFF2D2D46,0xFF2E2E47,0xFF2F2F49,0xFF2E2E46,0xFF252538,0xFF171722,
+   0xFF050508,0xFF000000,0xFF000000,0xFF282B2F,0xFF858F9C,0xFFD2E3F8,0xFFE3F5FF,
+   0xFFD5E6FF,0xFFD2E3FC,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD2E2FB,0xFFD6E7FF,0xFFE2F4FF,
+   0xFFDAECFF,0xFFA3B0C0,0xFF50565D,0xFF080909,0xFF000000,0xFF000000,0xFF212122,
+   0xFF797979,0xFFCDCDCD,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFCFCFC,0xFFFCFCFC,
+   0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FD,0xFFD9EAFD,0xFFC8D8EB,0xFF191B1E,0xFF000000,
+   0xFF1D1D30,0xFF3B3B61,0xFF353557,0xFF363658,0xFF353557,0xFF353556,0xFF343455,
+   0xFF343454,0xFF333353,0xFF333352,0xFF323251,0xFF323250,0xFF31314F,0xFF31314E,
+   0xFF30304D,0xFF30304C,0xFF2F2F4A,0xFF2F2F49,0xFF2E2E48,0xFF30304B,0xFF30304B,
+   0xFF2B2B43,0xFF1D1D2D,0xFF0B0B0F,0xFF000000,0xFF000000,0xFF24262B,0xFF87929E,
+   0xFFD5E6FC,0xFFE1F3FF,0xFFD3E4FD,0xFFD3E4FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD2E3FC,
+   0xFFD4E5FE,0xFFDFF1FF,0xFFE0F2FF,0xFFB9C7DA,0xFF6F7783,0xFF232528,0xFF000000,
+   0xFF000000,0xFF000000,0xFF424242,0xFF9B9C9C,0xFFE8E8E8,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFFFFFFF,0xFFFCFCFC,0xFFFCFCFC,0xFFFEFEFE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FC,0xFFE1F2FF,0xFFA0ADBE,0xFF030303,
+   0xFF020202,0xFF26263F,0xFF3D3D65,0xFF37375B,0xFF38385C,0xFF37375B,0xFF37375A,
+   0xFF363659,0xFF363658,0xFF353557,0xFF353556,0xFF343455,0xFF343454,0xFF333353,
+   0xFF333352,0xFF323251,0xFF323250,0xFF31314F,0xFF31314E,0xFF30304D,0xFF30304B,
+   0xFF30304C,0xFF32324F,0xFF2F2F49,0xFF212134,0xFF0C0D12,0xFF000000,0xFF000000,
+   0xFF2C2F34,0xFF95A1AF,0xFFDDEEFF,0xFFDEEFFF,0xFFD2E2FB,0xFFD4E5FE,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD3E3FC,0xFFD2E3FC,0xFFDCEDFF,0xFFE3F5FF,0xFFD0E1F6,0xFF929EAB,
+   0xFF43474D,0xFF060606,0xFF000000,0xFF000000,0xFF141414,0xFF5E5E5F,0xFFB0B0B1,
+   0xFFF3F3F3,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,0xFFFCFCFC,0xFFFBFBFB,0xFFFDFDFD,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E2FB,0xFFE3F6FF,0xFF7C8695,
+   0xFF000000,0xFF050506,0xFF2D2D4A,0xFF3F3F69,0xFF39395F,0xFF3A3A60,0xFF39395F,
+   0xFF39395E,0xFF38385D,0xFF38385C,0xFF37375B,0xFF37375A,0xFF363659,0xFF363658,
+   0xFF353557,0xFF353556,0xFF343455,0xFF343454,0xFF333353,0xFF333352,0xFF323251,
+   0xFF323250,0xFF31314E,0xFF31314E,0xFF333351,0xFF31314D,0xFF222235,0xFF0C0C12,
+   0xFF000000,0xFF000000,0xFF41464D,0xFFB0BFCF,0xFFE4F6FF,0xFFD7E8FF,0xFFD2E3FC,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD3E4FD,0xFFD2E2FB,0xFFD7E8FF,0xFFE1F4FF,
+   0xFFDEF0FF,0xFFB8C6D9,0xFF727B87,0xFF292C30,0xFF000000,0xFF000000,0xFF000000,
+   0xFF202020,0xFF666666,0xFFB1B1B2,0xFFEEEEEE,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FB,0xFFE3F5FF,
+   0xFF666E7A,0xFF000000,0xFF070709,0xFF303050,0xFF41416D,0xFF3C3C63,0xFF3C3C64,
+   0xFF3B3B63,0xFF3B3B62,0xFF3A3A61,0xFF3A3A60,0xFF39395F,0xFF39395E,0xFF38385D,
+   0xFF38385C,0xFF37375B,0xFF37375A,0xFF363659,0xFF363658,0xFF353557,0xFF353556,
+   0xFF343455,0xFF343454,0xFF333353,0xFF333351,0xFF323251,0xFF353555,0xFF32324F,
+   0xFF202032,0xFF08080B,0xFF000000,0xFF060708,0xFF69727D,0xFFD0E1F4,0xFFE0F2FF,
+   0xFFD2E3FC,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD2E3FC,
+   0xFFD3E4FD,0xFFDCEDFF,0xFFE3F6FF,0xFFD4E5FB,0xFFA4B0C1,0xFF606670,0xFF1E2023,
+   0xFF000000,0xFF000000,0xFF000000,0xFF171717,0xFF535353,0xFF959596,0xFFCFCFCF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD4E5FB,
+   0xFFE0F2FF,0xFF5B626D,0xFF000000,0xFF07070A,0xFF323254,0xFF434371,0xFF3D3D67,
+   0xFF3E3E68,0xFF3E3E67,0xFF3D3D66,0xFF3D3D65,0xFF3C3C64,0xFF3C3C63,0xFF3B3B62,
+   0xFF3B3B61,0xFF3A3A60,0xFF3A3A5F,0xFF39395E,0xFF39395D,0xFF38385C,0xFF38385B,
+   0xFF37375A,0xFF373759,0xFF363658,0xFF363657,0xFF353556,0xFF343454,0xFF343455,
+   0xFF373759,0xFF30304D,0xFF191A28,0xFF000000,0xFF000000,0xFF26292E,0xFFA1AEBD,
+   0xFFE2F5FF,0xFFD6E7FF,0xFFD3E3FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD3E4FD,0xFFD2E2FB,0xFFD6E7FF,0xFFDFF1FF,0xFFE3F5FF,0xFFCEDEF3,
+   0xFF9CA8B8,0xFF5E646E,0xFF222428,0xFF000000,0xFF000000,0xFF000000,0xFF000000,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,
+   0xFFD5E5FC,0xFFDFF1FF,0xFF565C68,0xFF000000,0xFF07070B,0xFF35355A,0xFF454574,
+   0xFF40406B,0xFF40406D,0xFF40406C,0xFF3F3F6B,0xFF3F3F6A,0xFF3E3E69,0xFF3E3E68,
+   0xFF3D3D67,0xFF3D3D66,0xFF3C3C65,0xFF3C3C64,0xFF3B3B63,0xFF3B3B62,0xFF3A3A61,
+   0xFF3A3A60,0xFF39395F,0xFF39395E,0xFF38385D,0xFF38385C,0xFF37375B,0xFF373759,
+   0xFF353557,0xFF363658,0xFF38385C,0xFF2B2B45,0xFF0F0F16,0xFF000000,0xFF000000,
+   0xFF646C76,0xFFD5E6F9,0xFFDDEFFF,0xFFD1E2FB,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD3E3FC,0xFFD2E3FC,0xFFD7E8FF,
+   0xFFE0F2FF,0xFFE3F5FF,0xFFD1E2F9,0xFFA6B3C7,0xFF727B87,0xFF3C4046,0xFF0F1112,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD4E5FE,0xFFD5E6FC,0xFFDEF0FF,0xFF515863,0xFF000000,0xFF09090D,0xFF3B3B65,
+   0xFF464677,0xFF424270,0xFF424271,0xFF424270,0xFF41416F,0xFF41416E,0xFF40406D,
+   0xFF40406C,0xFF3F3F6B,0xFF3F3F6A,0xFF3E3E69,0xFF3E3E68,0xFF3D3D67,0xFF3D3D66,
+   0xFF3C3C65,0xFF3C3C64,0xFF3B3B63,0xFF3B3B62,0xFF3A3A61,0xFF3A3A60,0xFF39395F,
+   0xFF39395D,0xFF38385C,0xFF37375A,0xFF3A3A5E,0xFF37375B,0xFF1F1F31,0xFF010102,
+   0xFF000000,0xFF2F3339,0xFFB6C4D5,0xFFE3F5FF,0xFFD2E3FC,0xFFD4E5FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,
+   0xFFD2E3FC,0xFFD2E3FC,0xFFD6E7FF,0xFFDFF1FF,0xFFE4F6FF,0xFFDCEDFF,0xFFC3D2E9,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD3E4FE,0xFFD6E7FD,0xFFDCEDFF,0xFF454B55,0xFF000000,0xFF0F0F18,
+   0xFF444474,0xFF464678,0xFF444475,0xFF444475,0xFF444474,0xFF434373,0xFF434372,
+   0xFF424271,0xFF424270,0xFF41416F,0xFF41416E,0xFF40406D,0xFF40406C,0xFF3F3F6B,
+   0xFF3F3F6A,0xFF3E3E69,0xFF3E3E68,0xFF3D3D67,0xFF3D3D66,0xFF3C3C65,0xFF3C3C64,
+   0xFF3B3B62,0xFF3B3B62,0xFF3A3A61,0xFF39395F,0xFF39395F,0xFF3D3D64,0xFF2E2E4B,
+   0xFF0C0D14,0xFF000000,0xFF0C0E10,0xFF8E9AA7,0xFFE3F5FF,0xFFD4E5FD,0xFFD3E4FE,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD3E4FC,0xFFD2E2FB,0xFFD4E5FE,0xFFD9EBFF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD3E4FD,0xFFD8E9FD,0xFFD4E5F6,0xFF2D3137,0xFF000000,
+   0xFF1F1F34,0xFF4C4C83,0xFF464679,0xFF47477A,0xFF464679,0xFF464678,0xFF454577,
+   0xFF454576,0xFF444475,0xFF444474,0xFF434373,0xFF434372,0xFF424271,0xFF424270,
+   0xFF41416F,0xFF41416E,0xFF40406D,0xFF40406C,0xFF3F3F6B,0xFF3F3F6A,0xFF3E3E69,
+   0xFF3E3E68,0xFF3D3D67,0xFF3D3D66,0xFF3C3C65,0xFF3B3B63,0xFF3A3A61,0xFF3E3E66,
+   0xFF39395F,0xFF191929,0xFF000000,0xFF000000,0xFF67707C,0xFFDDEFFF,0xFFD8E9FF,
+   0xFFD2E3FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FC,0xFFDEEFFF,0xFFB7C5DA,0xFF0C0D0F,
+   0xFF010101,0xFF3A3A64,0xFF4D4D86,0xFF49497D,0xFF49497E,0xFF48487D,0xFF48487C,
+   0xFF47477B,0xFF47477A,0xFF464679,0xFF464678,0xFF454577,0xFF454576,0xFF444475,
+   0xFF444474,0xFF434373,0xFF434372,0xFF424271,0xFF424270,0xFF41416F,0xFF41416E,
+   0xFF40406D,0xFF40406C,0xFF3F3F6B,0xFF3F3F6A,0xFF3E3E69,0xFF3E3E68,0xFF3D3D65,
+   0xFF3E3E67,0xFF40406B,0xFF25253E,0xFF020202,0xFF000000,0xFF494E58,0xFFD1E2F4,
+   0xFFDDEFFF,0xFFD1E2FB,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD1E1FB,0xFFE5F7FF,0xFF6D7583,
+   0xFF000000,0xFF1D1D31,0xFF51518C,0xFF4B4B82,0xFF4B4B83,0xFF4B4B82,0xFF4A4A81,
+   0xFF4A4A80,0xFF49497F,0xFF49497E,0xFF48487D,0xFF48487C,0xFF47477B,0xFF47477A,
+   0xFF464679,0xFF464678,0xFF454577,0xFF454576,0xFF444475,0xFF444474,0xFF434373,
+   0xFF434372,0xFF424271,0xFF424270,0xFF41416F,0xFF41416E,0xFF40406D,0xFF40406C,
+   0xFF3F3F6A,0xFF3E3E69,0xFF434370,0xFF2F2F4F,0xFF08080C,0xFF000000,0xFF2D3137,
+   0xFFBDCCDC,0xFFE2F4FF,0xFFD1E2FB,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD3E4FD,0xFFDAECFE,0xFFBDCCE3,
+   0xFF080808,0xFF05050A,0xFF4B4B83,0xFF50508B,0xFF4E4E87,0xFF4E4E87,0xFF4D4D86,
+   0xFF4D4D85,0xFF4C4C84,0xFF4C4C83,0xFF4B4B82,0xFF4B4B81,0xFF4A4A80,0xFF4A4A7F,
+   0xFF49497E,0xFF49497D,0xFF48487C,0xFF48487B,0xFF47477A,0xFF474779,0xFF464678,
+   0xFF454577,0xFF454576,0xFF444475,0xFF444474,0xFF444473,0xFF434372,0xFF434371,
+   0xFF424270,0xFF42426F,0xFF40406C,0xFF444473,0xFF38385F,0xFF0E0E16,0xFF000000,
+   0xFF141519,0xFF97A4B2,0xFFE3F6FF,0xFFD8EAFF,0xFFD1E2FB,0xFFD4E5FE,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD6E7FF,
+   0xFF26292D,0xFF000000,0xFF464679,0xFF545493,0xFF50508C,0xFF50508C,0xFF50508B,
+   0xFF4F4F8A,0xFF4F4F89,0xFF4E4E88,0xFF4E4E87,0xFF4D4D86,0xFF4D4D85,0xFF4C4C84,
+   0xFF4C4C83,0xFF4B4B82,0xFF4B4B81,0xFF4A4A80,0xFF4A4A7F,0xFF49497E,0xFF49497D,
+   0xFF48487C,0xFF48487B,0xFF47477A,0xFF474779,0xFF464678,0xFF464677,0xFF454576,
+   0xFF454575,0xFF444474,0xFF444473,0xFF424270,0xFF454575,0xFF40406C,0xFF181828,
+   0xFF000000,0xFF000000,0xFF5D646F,0xFFC9DAED,0xFFE4F6FF,0xFFD8E9FF,0xFFD2E3FC,
+   0xFFD2E3FC,0xFFD3E4FD,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E5FF,0xFFD8EAFF,
+   0xFF2E3237,0xFF000000,0xFF46467A,0xFF575799,0xFF525291,0xFF535391,0xFF525290,
+   0xFF52528F,0xFF51518E,0xFF51518D,0xFF50508C,0xFF50508B,0xFF4F4F8A,0xFF4F4F89,
+   0xFF4E4E88,0xFF4E4E87,0xFF4D4D86,0xFF4D4D85,0xFF4C4C84,0xFF4C4C83,0xFF4B4B82,
+   0xFF4B4B81,0xFF4A4A80,0xFF4A4A7F,0xFF49497E,0xFF49497D,0xFF48487C,0xFF48487B,
+   0xFF47477A,0xFF474779,0xFF464678,0xFF464677,0xFF444475,0xFF464677,0xFF474778,
+   0xFF282843,0xFF030304,0xFF000000,0xFF191B1F,0xFF7B8591,0xFFC8D8EB,0xFFE2F4FF,
+   0xFFE2F4FF,0xFFDCEEFF,0xFFD7E8FF,0xFFD4E5FE,0xFFD3E3FC,0xFFD1E2FB,0xFFD2E3FB,
+   0xFFD2E3FC,0xFFD3E4FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD7E8FF,0xFFCEDEF6,
+   0xFF16181A,0xFF000001,0xFF4E4E8A,0xFF58589C,0xFF555596,0xFF555596,0xFF555595,
+   0xFF545494,0xFF545493,0xFF535392,0xFF535391,0xFF525290,0xFF52528F,0xFF51518E,
+   0xFF51518D,0xFF50508C,0xFF50508B,0xFF4F4F8A,0xFF4F4F89,0xFF4E4E88,0xFF4E4E87,
+   0xFF4D4D86,0xFF4D4D85,0xFF4C4C84,0xFF4C4C83,0xFF4B4B82,0xFF4B4B81,0xFF4A4A80,
+   0xFF4A4A7F,0xFF49497E,0xFF49497D,0xFF48487C,0xFF48487B,0xFF474779,0xFF464679,
+   0xFF4B4B80,0xFF3B3B65,0xFF171726,0xFF000000,0xFF000000,0xFF121315,0xFF535961,
+   0xFF8F9AA9,0xFFB5C4D7,0xFFCDDEF6,0xFFDBECFF,0xFFE0F2FF,0xFFE5F7FF,0xFFE3F5FF,
+   0xFFE1F3FF,0xFFDFF1FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD3E4FD,0xFFDDEFFF,0xFFAEBDD1,
+   0xFF010100,0xFF0F0F1B,0xFF59599E,0xFF59599E,0xFF58589C,0xFF58589B,0xFF57579A,
+   0xFF575799,0xFF565698,0xFF565697,0xFF555596,0xFF555595,0xFF545494,0xFF545493,
+   0xFF535392,0xFF535391,0xFF525290,0xFF52528F,0xFF51518E,0xFF51518D,0xFF50508C,
+   0xFF50508B,0xFF4F4F8A,0xFF4F4F89,0xFF4E4E88,0xFF4E4E87,0xFF4D4D86,0xFF4D4D85,
+   0xFF4C4C84,0xFF4C4C83,0xFF4B4B82,0xFF4B4B81,0xFF4A4A80,0xFF4A4A80,0xFF49497E,
+   0xFF48487C,0xFF4B4B81,0xFF4A4A7F,0xFF35355A,0xFF181827,0xFF000000,0xFF000000,
+   0xFF000000,0xFF010100,0xFF181A1C,0xFF32353A,0xFF4B515B,0xFF626A75,0xFF798290,
+   0xFF919DAE,0xFFA7B4C7,0xFFD3E4FD,0xFFD6E7FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FB,0xFFE2F4FF,0xFF8C97A8,
+   0xFF000000,0xFF23233C,0xFF6161AD,0xFF5A5AA0,0xFF5B5BA2,0xFF5A5AA0,0xFF5A5A9F,
+   0xFF59599E,0xFF59599D,0xFF58589C,0xFF58589B,0xFF57579A,0xFF575799,0xFF565698,
+   0xFF565697,0xFF555596,0xFF555595,0xFF545494,0xFF545493,0xFF535392,0xFF535391,
+   0xFF525290,0xFF52528F,0xFF51518E,0xFF51518D,0xFF50508C,0xFF50508B,0xFF4F4F8A,
+   0xFF4F4F89,0xFF4E4E89,0xFF4E4E88,0xFF4D4D87,0xFF4D4D85,0xFF4C4C84,0xFF4C4C83,
+   0xFF4B4B83,0xFF4A4A80,0xFF4A4A80,0xFF4E4E86,0xFF4C4C83,0xFF3F3F6B,0xFF2C2C4A,
+   0xFF19192A,0xFF0A0A13,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,
+   0xFF000000,0xFF484E57,0xFFDFF0FE,0xFFD3E4FC,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E2FB,0xFFE4F6FF,0xFF6E7785,
+   0xFF000000,0xFF333359,0xFF6565B4,0xFF5C5CA5,0xFF5D5DA7,0xFF5D5DA6,0xFF5C5CA5,
+   0xFF5C5CA4,0xFF5B5BA3,0xFF5B5BA2,0xFF5A5AA1,0xFF5A5AA0,0xFF59599F,0xFF59599E,
+   0xFF58589D,0xFF58589C,0xFF57579B,0xFF57579A,0xFF565699,0xFF565698,0xFF555597,
+   0xFF555595,0xFF545494,0xFF545493,0xFF535392,0xFF535391,0xFF525290,0xFF525290,
+   0xFF51518F,0xFF51518E,0xFF50508D,0xFF50508C,0xFF4F4F8B,0xFF4F4F8A,0xFF4E4E89,
+   0xFF4E4E88,0xFF4D4D87,0xFF4D4D85,0xFF4B4B83,0xFF4B4B83,0xFF4E4E87,0xFF50508A,
+   0xFF4E4E87,0xFF49497E,0xFF434372,0xFF3A3B63,0xFF36375C,0xFF1E1E31,0xFF040505,
+   0xFF111214,0xFFC1D1E5,0xFFDBEDFF,0xFFD3E4FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD1E2FB,0xFFE4F7FF,0xFF5B626E,
+   0xFF000000,0xFF3E3E6E,0xFF6868BA,0xFF5F5FAA,0xFF6060AC,0xFF5F5FAB,0xFF5F5FAA,
+   0xFF5E5EA9,0xFF5E5EA8,0xFF5D5DA7,0xFF5D5DA6,0xFF5D5DA5,0xFF5C5CA4,0xFF5C5CA3,
+   0xFF5B5BA2,0xFF5B5BA1,0xFF5A5AA0,0xFF5A5A9F,0xFF59599E,0xFF59599D,0xFF58589C,
+   0xFF57579A,0xFF57579A,0xFF565698,0xFF565697,0xFF555597,0xFF555596,0xFF545495,
+   0xFF545494,0xFF535393,0xFF535392,0xFF525291,0xFF525290,0xFF51518F,0xFF51518E,
+   0xFF50508D,0xFF50508C,0xFF50508B,0xFF4F4F8A,0xFF4E4E89,0xFF4D4D87,0xFF4C4C85,
+   0xFF4C4C84,0xFF4D4D85,0xFF4D4D86,0xFF4F4F89,0xFF4E4E86,0xFF12131E,0xFF000000,
+   0xFF788191,0xFFE4F6FF,0xFFD1E2FC,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FB,0xFFE2F5FF,0xFF525964,
+   0xFF000000,0xFF444478,0xFF6A6ABE,0xFF6262AF,0xFF6262B1,0xFF6262B0,0xFF6161AF,
+   0xFF6161AE,0xFF6161AD,0xFF6060AC,0xFF6060AB,0xFF5F5FAA,0xFF5F5FA9,0xFF5E5EA8,
+   0xFF5E5EA7,0xFF5D5DA6,0xFF5D5DA5,0xFF5C5CA4,0xFF5C5CA3,0xFF5B5BA2,0xFF5B5BA1,
+   0xFF5A5AA0,0xFF59599F,0xFF59599E,0xFF58589D,0xFF58589C,0xFF57579B,0xFF57579A,
+   0xFF565699,0xFF565698,0xFF555597,0xFF555596,0xFF545495,0xFF545494,0xFF545493,
+   0xFF535392,0xFF535391,0xFF525290,0xFF52528F,0xFF51518E,0xFF51518D,0xFF50508C,
+   0xFF4F4F8B,0xFF4F4F89,0xFF4D4D85,0xFF52528F,0xFF22223A,0xFF000000,0xFF30343A,
+   0xFFD9EAFB,0xFFD5E5FC,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FB,0xFFE3F5FF,0xFF545B66,
+   0xFF000000,0xFF44447A,0xFF6D6DC4,0xFF6464B4,0xFF6565B6,0xFF6565B5,0xFF6464B4,
+   0xFF6464B3,0xFF6363B2,0xFF6363B1,0xFF6262B0,0xFF6262AF,0xFF6161AE,0xFF6161AD,
+   0xFF6060AC,0xFF6060AB,0xFF5F5FAA,0xFF5F5FA9,0xFF5E5EA8,0xFF5E5EA7,0xFF5D5DA6,
+   0xFF5C5CA5,0xFF5C5CA4,0xFF5B5BA3,0xFF5B5BA2,0xFF5A5AA1,0xFF5A5AA0,0xFF59599F,
+   0xFF59599E,0xFF58589D,0xFF58589C,0xFF57579B,0xFF57579A,0xFF575799,0xFF565698,
+   0xFF565697,0xFF555596,0xFF555595,0xFF545494,0xFF545493,0xFF535392,0xFF535391,
+   0xFF525290,0xFF50508C,0xFF565697,0xFF3A3A64,0xFF020203,0xFF09090A,0xFFB1C0D4,
+   0xFFDEEFFF,0xFFD3E3FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD1E2FB,0xFFE5F7FF,0xFF616975,
+   0xFF000000,0xFF404070,0xFF7070CA,0xFF6666B9,0xFF6868BB,0xFF6767BA,0xFF6767B9,
+   0xFF6666B8,0xFF6666B7,0xFF6565B6,0xFF6565B5,0xFF6464B4,0xFF6464B3,0xFF6363B2,
+   0xFF6363B1,0xFF6262B0,0xFF6262AF,0xFF6161AE,0xFF6161AD,0xFF6060AC,0xFF6060AB,
+   0xFF5F5FAA,0xFF5E5EA9,0xFF5E5EA8,0xFF5D5DA7,0xFF5D5DA6,0xFF5C5CA5,0xFF5C5CA4,
+   0xFF5B5BA3,0xFF5B5BA2,0xFF5B5BA1,0xFF5A5AA0,0xFF5A5A9F,0xFF59599E,0xFF59599D,
+   0xFF58589C,0xFF58589B,0xFF57579A,0xFF575799,0xFF565698,0xFF565697,0xFF555596,
+   0xFF535393,0xFF575799,0xFF4B4B84,0xFF0B0B11,0xFF000000,0xFF798293,0xFFE4F6FF,
+   0xFFD1E2FC,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FB,0xFFE3F5FF,0xFF7B8493,
+   0xFF000001,0xFF323258,0xFF7272CE,0xFF6969BE,0xFF6A6AC0,0xFF6A6ABF,0xFF6969BE,
+   0xFF6969BD,0xFF6868BC,0xFF6868BB,0xFF6767BA,0xFF6767B9,0xFF6666B8,0xFF6666B7,
+   0xFF6565B6,0xFF6565B5,0xFF6464B4,0xFF6464B3,0xFF6363B2,0xFF6363B1,0xFF6262B0,
+   0xFF6161AF,0xFF6161AE,0xFF6060AD,0xFF6060AC,0xFF5F5FAB,0xFF5F5FAA,0xFF5F5FA9,
+   0xFF5E5EA8,0xFF5E5EA7,0xFF5D5DA6,0xFF5D5DA5,0xFF5C5CA4,0xFF5C5CA3,0xFF5B5BA2,
+   0xFF5B5BA1,0xFF5A5AA0,0xFF5A5A9F,0xFF59599E,0xFF59599D,0xFF58589C,0xFF57579A,
+   0xFF58589B,0xFF57579A,0xFF161625,0xFF000000,0xFF454B55,0xFFDFF0FF,0xFFD4E4FB,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FC,0xFFE0F2FF,0xFF9FABBE,
+   0xFF000000,0xFF1C1C32,0xFF7171CD,0xFF6C6CC5,0xFF6D6DC5,0xFF6C6CC4,0xFF6C6CC3,
+   0xFF6B6BC2,0xFF6B6BC1,0xFF6A6AC0,0xFF6A6ABF,0xFF6969BE,0xFF6969BD,0xFF6868BC,
+   0xFF6868BB,0xFF6767BA,0xFF6767B9,0xFF6666B8,0xFF6666B7,0xFF6565B6,0xFF6565B5,
+   0xFF6464B4,0xFF6363B3,0xFF6363B2,0xFF6363B1,0xFF6262B0,0xFF6262AF,0xFF6161AE,
+   0xFF6161AD,0xFF6060AC,0xFF6060AB,0xFF5F5FAA,0xFF5F5FA9,0xFF5E5EA8,0xFF5E5EA7,
+   0xFF5D5DA6,0xFF5D5DA5,0xFF5C5CA4,0xFF5C5CA3,0xFF5B5BA2,0xFF5A5AA0,0xFF59599F,
+   0xFF5E5EA7,0xFF22223C,0xFF000000,0xFF22252A,0xFFCEDDF0,0xFFD8E9FD,0xFFD3E4FE,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD9EAFF,0xFFC5D4ED,
+   0xFF0D0E0F,0xFF040308,0xFF6464B5,0xFF7171CD,0xFF6D6DC7,0xFF6E6EC8,0xFF6E6EC7,
+   0xFF6E6EC7,0xFF6D6DC6,0xFF6D6DC5,0xFF6C6CC5,0xFF6C6CC3,0xFF6B6BC2,0xFF6B6BC1,
+   0xFF6A6AC0,0xFF6A6ABF,0xFF6969BE,0xFF6969BD,0xFF6868BC,0xFF6868BB,0xFF6767BA,
+   0xFF6767B9,0xFF6666B8,0xFF6666B7,0xFF6565B6,0xFF6565B5,0xFF6464B4,0xFF6464B3,
+   0xFF6363B2,0xFF6363B1,0xFF6262B0,0xFF6262AF,0xFF6161AE,0xFF6161AD,0xFF6060AC,
+   0xFF6060AB,0xFF5F5FAA,0xFF5F5FA9,0xFF5E5EA8,0xFF5D5DA7,0xFF5C5CA4,0xFF6262B0,
+   0xFF2B2B4D,0xFF000000,0xFF0F1014,0xFFB6C4D6,0xFFDEF0FF,0xFFD2E3FD,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD3E4FD,0xFFDFF1FF,
+   0xFF434851,0xFF000000,0xFF45457B,0xFF7676D6,0xFF6C6CC5,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC7,0xFF6D6DC6,
+   0xFF6D6DC5,0xFF6C6CC5,0xFF6C6CC3,0xFF6B6BC2,0xFF6B6BC1,0xFF6A6AC0,0xFF6A6ABF,
+   0xFF6969BE,0xFF6969BD,0xFF6868BC,0xFF6868BB,0xFF6767BA,0xFF6767B9,0xFF6666B8,
+   0xFF6666B7,0xFF6565B6,0xFF6565B5,0xFF6464B4,0xFF6464B3,0xFF6363B2,0xFF6363B1,
+   0xFF6262B0,0xFF6262AF,0xFF6161AE,0xFF6060AC,0xFF5F5FAB,0xFF6666B7,0xFF323258,
+   0xFF000000,0xFF060608,0xFF9FABBD,0xFFE2F4FF,0xFFD1E2FC,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FC,0xFFE2F4FF,
+   0xFF919DAF,0xFF000000,0xFF161626,0xFF6F6FC9,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC7,0xFF6D6DC6,0xFF6D6DC6,0xFF6C6CC5,
+   0xFF6C6CC3,0xFF6B6BC2,0xFF6B6BC1,0xFF6A6AC0,0xFF6A6ABF,0xFF6969BE,0xFF6969BD,
+   0xFF6868BC,0xFF6868BB,0xFF6767BA,0xFF6767B9,0xFF6666B8,0xFF6666B7,0xFF6565B6,
+   0xFF6565B5,0xFF6464B5,0xFF6363B2,0xFF6363B2,0xFF6969BD,0xFF323259,0xFF000000,
+   0xFF030304,0xFF929DAD,0xFFE4F6FF,0xFFD1E2FB,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E5FE,0xFFD6E6FE,
+   0xFFD5E6F9,0xFF25282D,0xFF000000,0xFF44447B,0xFF7676D7,0xFF6B6BC4,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC7,0xFF6D6DC6,0xFF6D6DC5,0xFF6C6CC4,0xFF6C6CC3,0xFF6B6BC2,
+   0xFF6B6BC1,0xFF6A6AC0,0xFF6A6ABF,0xFF6969BE,0xFF6969BD,0xFF6868BC,0xFF6868BB,
+   0xFF6767BB,0xFF6565B6,0xFF6868BC,0xFF6969BE,0xFF2D2D51,0xFF000000,0xFF030405,
+   0xFF8E99A8,0xFFE4F6FF,0xFFD1E2FB,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FC,
+   0xFFE2F4FF,0xFF929EB1,0xFF000000,0xFF0C0C14,0xFF6262B3,0xFF7272CF,0xFF6C6CC5,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC7,
+   0xFF6D6DC7,0xFF6D6DC6,0xFF6C6CC5,0xFF6C6CC4,0xFF6B6BC3,0xFF6B6BC2,0xFF6A6AC0,
+   0xFF6868BC,0xFF6F6FC9,0xFF6464B5,0xFF22223C,0xFF000000,0xFF090A0C,0xFF96A3B2,
+   0xFFE4F6FF,0xFFD1E2FB,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD3E4FC,0xFFDFF1FF,0xFF494F59,0xFF000000,0xFF1B1B2F,0xFF6D6DC6,0xFF7070CC,
+   0xFF6C6CC5,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC7,0xFF6C6CC4,0xFF6D6DC6,
+   0xFF7474D2,0xFF55569B,0xFF131422,0xFF000000,0xFF17191D,0xFFA8B5C6,0xFFE3F5FF,
+   0xFFD1E2FB,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD4E5FE,0xFFD8E9FD,0xFFCDDEEF,0xFF26292F,0xFF000000,0xFF22223C,0xFF6D6DC7,
+   0xFF7272CF,0xFF6C6CC4,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6D6DC6,0xFF6D6DC6,0xFF7474D3,0xFF6E6EC8,
+   0xFF3A3A68,0xFF010102,0xFF000000,0xFF373B42,0xFFC0D0E0,0xFFE0F2FF,0xFFD1E2FB,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD2E3FD,0xFFDDEFFF,0xFFBCCBDD,0xFF1B1D22,0xFF000000,0xFF1C1D31,
+   0xFF6363B4,0xFF7676D6,0xFF6D6DC6,0xFF6D6DC5,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC7,0xFF6C6CC5,0xFF6D6DC6,0xFF7373D1,0xFF7373D1,0xFF515193,0xFF18182A,
+   0xFF000000,0xFF000000,0xFF69717C,0xFFD7E8FA,0xFFDCEDFF,0xFFD2E2FC,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD2E2FC,0xFFDEF0FF,0xFFBCCBDC,0xFF24272D,0xFF000000,
+   0xFF0C0C14,0xFF494984,0xFF7272CF,0xFF7474D3,0xFF6E6EC8,0xFF6C6CC5,0xFF6D6DC6,
+   0xFF6E6EC7,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,
+   0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6E6EC8,0xFF6D6DC7,0xFF6D6DC5,0xFF6D6DC5,
+   0xFF6F6FCA,0xFF7575D4,0xFF7272CF,0xFF56569B,0xFF262642,0xFF000000,0xFF000000,
+   0xFF2C2F35,0xFFA5B2C1,0xFFE3F6FF,0xFFD5E6FF,0xFFD3E4FD,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E2FC,0xFFDDEEFF,0xFFCCDCEE,0xFF4B515A,
+   0xFF000000,0xFF000000,0xFF202139,0xFF515192,0xFF6F6FCA,0xFF7676D5,0xFF7272D0,
+   0xFF6F6FC9,0xFF6D6DC6,0xFF6C6CC5,0xFF6C6CC5,0xFF6C6CC5,0xFF6C6CC5,0xFF6C6CC5,
+   0xFF6C6CC5,0xFF6C6CC5,0xFF6D6DC6,0xFF6E6EC8,0xFF7171CE,0xFF7575D4,0xFF7575D4,
+   0xFF6A6AC0,0xFF4D4D8A,0xFF23233D,0xFF000000,0xFF000000,0xFF15171A,0xFF79838F,
+   0xFFD5E6F9,0xFFDFF1FF,0xFFD2E2FC,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD2E3FD,0xFFD9EAFF,0xFFDDEFFF,
+   0xFF8C97A5,0xFF1E2024,0xFF000000,0xFF000000,0xFF171729,0xFF3E3E6E,0xFF5B5BA5,
+   0xFF6C6CC4,0xFF7373D2,0xFF7575D5,0xFF7676D7,0xFF7575D5,0xFF7575D5,0xFF7575D5,
+   0xFF7676D7,0xFF7575D5,0xFF7474D2,0xFF6F6FC9,0xFF6262B1,0xFF4D4D8A,0xFF2E2E52,
+   0xFF0C0C16,0xFF000000,0xFF000000,0xFF181A1C,0xFF707984,0xFFC5D5E9,0xFFE3F5FF,
+   0xFFD5E7FF,0xFFD2E3FC,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E4FE,0xFFD4E4FD,
+   0xFFE2F4FF,0xFFCBDCEF,0xFF798390,0xFF23262A,0xFF000000,0xFF000000,0xFF000000,
+   0xFF0F0F1C,0xFF23233E,0xFF35355F,0xFF404173,0xFF47477F,0xFF484982,0xFF47477F,
+   0xFF414174,0xFF373761,0xFF262643,0xFF141424,0xFF000000,0xFF000000,0xFF000000,
+   0xFF020201,0xFF373B42,0xFF86909F,0xFFC9D9ED,0xFFE4F6FF,0xFFD9EAFF,0xFFD2E2FC,
+   0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD2E3FC,0xFFD8E9FF,0xFFE3F5FF,0xFFD2E3F8,0xFF9AA6B6,0xFF575E68,0xFF222428,
+   0xFF010100,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF000000,
+   0xFF000000,0xFF000000,0xFF000000,0xFF000000,0xFF181A1C,0xFF42484F,0xFF7C8595,
+   0xFFB5C3D9,0xFFDAECFF,0xFFE3F5FF,0xFFD8E9FF,0xFFD2E2FC,0xFFD4E5FE,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD4E5FE,0xFFD2E3FC,0xFFD6E7FF,0xFFE1F3FF,0xFFE3F5FF,0xFFD2E3FC,
+   0xFFB7C5DA,0xFF97A3B6,0xFF798392,0xFF666E7B,0xFF5A606C,0xFF565D68,0xFF59606B,
+   0xFF666E7B,0xFF76808E,0xFF94A0B2,0xFFB0BDD3,0xFFCCDCF5,0xFFDFF0FF,0xFFE3F5FF,
+   0xFFDCEEFF,0xFFD4E5FE,0xFFD2E3FB,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,0xFFD2E3FC,0xFFD2E3FC,0xFFD6E7FF,
+   0xFFDCEEFF,0xFFE1F2FF,0xFFE4F6FF,0xFFE5F7FF,0xFFE3F5FF,0xFFE2F4FF,0xFFE2F4FF,
+   0xFFE5F7FF,0xFFE4F6FF,0xFFE1F3FF,0xFFDEEFFF,0xFFD7E8FF,0xFFD3E4FD,0xFFD2E3FB,
+   0xFFD3E4FD,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD4E5FE,
+   0xFFD3E4FD,0xFFD2E3FC,0xFFD2E2FB,0xFFD1E2FB,0xFFD2E3FB,0xFFD2E3FC,0xFFD2E3FB,
+   0xFFD1E2FB,0xFFD2E2FB,0xFFD2E3FC,0xFFD3E4FD,0xFFD4E5FE,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+   0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,0xFFD5E6FF,
+};
+#endif // TSODINPOG_H_
@@ -0,0 +1,28882 @@
+#ifndef OBJ_H_
+#define OBJ_H_
+#define vertices_count 3644
+static const float vertices[][3] = {
+    {-1.286800, 0.090000, 0.000000},
+    {-1.283440, 0.090000, -0.032400},
+    {-1.283440, 0.090000, 0.032400},
+    {-1.282580, 0.036465, 0.000000},
+    {-1.280800, 0.138780, 0.000000},
+    {-1.280800, 0.138780, 0.000000},
+    {-1.279270, 0.037138, -0.032400},
+    {-1.279270, 0.037138, 0.032400},
+    {-1.277475, 0.138097, -0.032400},
+    {-1.277475, 0.138097, 0.032400},
+    {-1.274320, 0.090000, -0.057600},
+    {-1.274320, 0.090000, 0.057600},
+    {-1.270285, 0.038962, -0.057600},
+    {-1.270285, 0.038962, 0.057600},
+    {-1.269840, -0.016080, 0.000000},
+    {-1.269840, -0.016080, 0.000000},
+    {-1.268449, 0.136244, -0.057600},
+    {-1.268449, 0.136244, 0.057600},
+    {-1.266677, -0.014884, -0.032400},
+    {-1.266677, -0.014884, 0.032400},
+    {-1.262800, 0.177840, 0.000000},
+    {-1.260880, 0.090000, -0.075600},
+    {-1.260880, 0.090000, 0.075600},
+    {-1.259583, 0.176610, 0.032400},
+    {-1.259583, 0.176610, -0.032400},
+    {-1.258092, -0.011637, -0.057600},
+    {-1.258092, -0.011637, 0.057600},
+    {-1.257044, 0.041652, -0.075600},
+    {-1.257044, 0.041652, 0.075600},
+    {-1.255148, 0.133512, -0.075600},
+    {-1.255148, 0.133512, 0.075600},
+    {-1.250852, 0.173272, -0.057600},
+    {-1.250852, 0.173272, 0.057600},
+    {-1.248460, -0.067545, 0.000000},
+    {-1.248460, -0.067545, 0.000000},
+    {-1.245538, -0.065946, 0.032400},
+    {-1.245538, -0.065946, -0.032400},
+    {-1.245441, -0.006852, -0.075600},
+    {-1.245441, -0.006852, 0.075600},
+    {-1.244560, 0.090000, -0.086400},
+    {-1.244560, 0.090000, 0.086400},
+    {-1.240966, 0.044918, -0.086400},
+    {-1.240966, 0.044918, 0.086400},
+    {-1.238996, 0.130195, -0.086400},
+    {-1.238996, 0.130195, 0.086400},
+    {-1.237986, 0.168353, -0.075600},
+    {-1.237986, 0.168353, 0.075600},
+    {-1.237609, -0.061606, -0.057600},
+    {-1.237609, -0.061606, 0.057600},
+    {-1.232800, 0.208260, 0.000000},
+    {-1.230078, -0.001042, 0.086400},
+    {-1.230078, -0.001042, -0.086400},
+    {-1.229773, 0.206604, -0.032400},
+    {-1.229773, 0.206604, 0.032400},
+    {-1.226800, 0.090000, -0.090000},
+    {-1.226800, 0.090000, 0.090000},
+    {-1.225922, -0.055210, 0.075600},
+    {-1.225922, -0.055210, -0.075600},
+    {-1.223470, 0.048472, 0.090000},
+    {-1.223470, 0.048472, -0.090000},
+    {-1.222362, 0.162380, -0.086400},
+    {-1.222362, 0.162380, 0.086400},
+    {-1.221556, 0.202110, -0.057600},
+    {-1.221556, 0.202110, 0.057600},
+    {-1.221420, 0.126585, -0.090000},
+    {-1.221420, 0.126585, 0.090000},
+    {-1.218320, -0.117840, 0.000000},
+    {-1.215730, -0.115932, -0.032400},
+    {-1.215730, -0.115932, 0.032400},
+    {-1.213360, 0.005280, -0.090000},
+    {-1.213360, 0.005280, 0.090000},
+    {-1.211732, -0.047444, 0.086400},
+    {-1.211732, -0.047444, -0.086400},
+    {-1.209446, 0.195488, -0.075600},
+    {-1.209446, 0.195488, 0.075600},
+    {-1.209040, 0.090000, -0.086400},
+    {-1.209040, 0.090000, 0.086400},
+    {-1.208702, -0.110751, -0.057600},
+    {-1.208702, -0.110751, 0.057600},
+    {-1.205974, 0.052027, -0.086400},
+    {-1.205974, 0.052027, 0.086400},
+    {-1.205360, 0.155880, 0.090000},
+    {-1.205360, 0.155880, -0.090000},
+    {-1.203844, 0.122975, -0.086400},
+    {-1.203844, 0.122975, 0.086400},
+    {-1.198344, -0.103118, -0.075600},
+    {-1.198344, -0.103118, 0.075600},
+    {-1.196642, 0.011602, 0.086400},
+    {-1.196642, 0.011602, -0.086400},
+    {-1.196290, -0.038992, 0.090000},
+    {-1.196290, -0.038992, -0.090000},
+    {-1.194742, 0.187446, -0.086400},
+    {-1.194742, 0.187446, 0.086400},
+    {-1.192720, 0.090000, -0.075600},
+    {-1.192720, 0.090000, 0.075600},
+    {-1.190800, 0.231120, 0.000000},
+    {-1.190800, 0.231120, 0.000000},
+    {-1.189896, 0.055293, -0.075600},
+    {-1.189896, 0.055293, 0.075600},
+    {-1.188358, 0.149380, -0.086400},
+    {-1.188358, 0.149380, 0.086400},
+    {-1.188049, 0.229144, -0.032400},
+    {-1.188049, 0.229144, 0.032400},
+    {-1.187692, 0.119658, -0.075600},
+    {-1.187692, 0.119658, 0.075600},
+    {-1.185767, -0.093848, -0.086400},
+    {-1.185767, -0.093848, 0.086400},
+    {-1.181279, 0.017412, -0.075600},
+    {-1.181279, 0.017412, 0.075600},
+    {-1.180848, -0.030541, 0.086400},
+    {-1.180848, -0.030541, -0.086400},
+    {-1.180583, 0.223782, -0.057600},
+    {-1.180583, 0.223782, 0.057600},
+    {-1.179300, -0.166875, 0.000000},
+    {-1.179300, -0.166875, 0.000000},
+    {-1.179280, 0.090000, -0.057600},
+    {-1.179280, 0.090000, 0.057600},
+    {-1.178740, 0.178695, -0.090000},
+    {-1.178740, 0.178695, 0.090000},
+    {-1.177130, -0.164722, 0.032400},
+    {-1.177130, -0.164722, -0.032400},
+    {-1.176655, 0.057982, -0.057600},
+    {-1.176655, 0.057982, 0.057600},
+    {-1.174391, 0.116926, -0.057600},
+    {-1.174391, 0.116926, 0.057600},
+    {-1.172734, 0.143407, -0.075600},
+    {-1.172734, 0.143407, 0.075600},
+    {-1.172080, -0.083760, -0.090000},
+    {-1.172080, -0.083760, 0.090000},
+    {-1.171240, -0.158880, -0.057600},
+    {-1.171240, -0.158880, 0.057600},
+    {-1.170160, 0.090000, -0.032400},
+    {-1.170160, 0.090000, 0.032400},
+    {-1.169580, 0.215879, -0.075600},
+    {-1.169580, 0.215879, 0.075600},
+    {-1.168628, 0.022197, -0.057600},
+    {-1.168628, 0.022197, 0.057600},
+    {-1.167670, 0.059808, -0.032400},
+    {-1.167670, 0.059808, 0.032400},
+    {-1.166800, 0.090000, 0.000000},
+    {-1.166658, -0.022775, 0.075600},
+    {-1.166658, -0.022775, -0.075600},
+    {-1.165365, 0.115073, -0.032400},
+    {-1.165365, 0.115073, 0.032400},
+    {-1.164360, 0.060480, 0.000000},
+    {-1.162738, 0.169944, -0.086400},
+    {-1.162738, 0.169944, 0.086400},
+    {-1.162560, -0.150270, -0.075600},
+    {-1.162560, -0.150270, 0.075600},
+    {-1.162040, 0.114390, 0.000000},
+    {-1.162040, 0.114390, 0.000000},
+    {-1.160043, 0.025444, -0.032400},
+    {-1.160043, 0.025444, 0.032400},
+    {-1.159868, 0.138488, -0.057600},
+    {-1.159868, 0.138488, 0.057600},
+    {-1.158393, -0.073672, -0.086400},
+    {-1.158393, -0.073672, 0.086400},
+    {-1.156880, 0.026640, 0.000000},
+    {-1.156880, 0.026640, 0.000000},
+    {-1.156220, 0.206283, -0.086400},
+    {-1.156220, 0.206283, 0.086400},
+    {-1.154971, -0.016379, -0.057600},
+    {-1.154971, -0.016379, 0.057600},
+    {-1.152020, -0.139815, -0.086400},
+    {-1.152020, -0.139815, 0.086400},
+    {-1.151137, 0.135150, 0.032400},
+    {-1.151137, 0.135150, -0.032400},
+    {-1.148034, 0.161902, -0.075600},
+    {-1.148034, 0.161902, 0.075600},
+    {-1.147920, 0.133920, 0.000000},
+    {-1.147920, 0.133920, 0.000000},
+    {-1.147042, -0.012039, 0.032400},
+    {-1.147042, -0.012039, -0.032400},
+    {-1.145816, -0.064402, -0.075600},
+    {-1.145816, -0.064402, 0.075600},
+    {-1.144120, -0.010440, 0.000000},
+    {-1.141680, 0.195840, -0.090000},
+    {-1.141680, 0.195840, 0.090000},
+    {-1.140550, -0.128438, 0.090000},
+    {-1.140550, -0.128438, -0.090000},
+    {-1.136800, 0.247500, 0.000000},
+    {-1.135924, 0.155280, -0.057600},
+    {-1.135924, 0.155280, 0.057600},
+    {-1.135458, -0.056769, -0.057600},
+    {-1.135458, -0.056769, 0.057600},
+    {-1.134420, 0.245295, -0.032400},
+    {-1.134420, 0.245295, 0.032400},
+    {-1.131280, -0.214560, 0.000000},
+    {-1.131280, -0.214560, 0.000000},
+    {-1.129614, -0.212201, 0.032400},
+    {-1.129614, -0.212201, -0.032400},
+    {-1.129080, -0.117060, -0.086400},
+    {-1.129080, -0.117060, 0.086400},
+    {-1.128430, -0.051588, -0.032400},
+    {-1.128430, -0.051588, 0.032400},
+    {-1.127960, 0.239310, -0.057600},
+    {-1.127960, 0.239310, 0.057600},
+    {-1.127707, 0.150786, -0.032400},
+    {-1.127707, 0.150786, 0.032400},
+    {-1.127140, 0.185397, -0.086400},
+    {-1.127140, 0.185397, 0.086400},
+    {-1.125840, -0.049680, 0.000000},
+    {-1.125090, -0.205799, -0.057600},
+    {-1.125090, -0.205799, 0.057600},
+    {-1.124680, 0.149130, 0.000000},
+    {-1.118540, -0.106605, -0.075600},
+    {-1.118540, -0.106605, 0.075600},
+    {-1.118440, 0.230490, -0.075600},
+    {-1.118440, 0.230490, 0.075600},
+    {-1.118424, -0.196364, -0.075600},
+    {-1.118424, -0.196364, 0.075600},
+    {-1.113780, 0.175801, -0.075600},
+    {-1.113780, 0.175801, 0.075600},
+    {-1.110329, -0.184908, 0.086400},
+    {-1.110329, -0.184908, -0.086400},
+    {-1.109860, -0.097995, -0.057600},
+    {-1.109860, -0.097995, 0.057600},
+    {-1.106880, 0.219780, -0.086400},
+    {-1.106880, 0.219780, 0.086400},
+    {-1.103970, -0.092152, 0.032400},
+    {-1.103970, -0.092152, -0.032400},
+    {-1.102777, 0.167898, -0.057600},
+    {-1.102777, 0.167898, 0.057600},
+    {-1.101800, -0.090000, 0.000000},
+    {-1.101800, -0.090000, 0.000000},
+    {-1.101520, -0.172440, 0.090000},
+    {-1.101520, -0.172440, -0.090000},
+    {-1.095311, 0.162536, -0.032400},
+    {-1.095311, 0.162536, 0.032400},
+    {-1.094300, 0.208125, -0.090000},
+    {-1.094300, 0.208125, 0.090000},
+    {-1.092711, -0.159972, 0.086400},
+    {-1.092711, -0.159972, -0.086400},
+    {-1.092560, 0.160560, 0.000000},
+    {-1.092560, 0.160560, 0.000000},
+    {-1.084616, -0.148516, -0.075600},
+    {-1.084616, -0.148516, 0.075600},
+    {-1.081720, 0.196470, -0.086400},
+    {-1.081720, 0.196470, 0.086400},
+    {-1.077950, -0.139081, -0.057600},
+    {-1.077950, -0.139081, 0.057600},
+    {-1.074140, -0.260805, 0.000000},
+    {-1.073426, -0.132679, 0.032400},
+    {-1.073426, -0.132679, -0.032400},
+    {-1.073058, -0.258250, -0.032400},
+    {-1.073058, -0.258250, 0.032400},
+    {-1.071760, -0.130320, 0.000000},
+    {-1.071760, -0.130320, 0.000000},
+    {-1.070800, 0.258480, 0.000000},
+    {-1.070800, 0.258480, 0.000000},
+    {-1.070160, 0.185760, -0.075600},
+    {-1.070160, 0.185760, 0.075600},
+    {-1.070119, -0.251316, -0.057600},
+    {-1.070119, -0.251316, 0.057600},
+    {-1.068892, 0.256121, -0.032400},
+    {-1.068892, 0.256121, 0.032400},
+    {-1.065790, -0.241096, 0.075600},
+    {-1.065790, -0.241096, -0.075600},
+    {-1.063711, 0.249719, -0.057600},
+    {-1.063711, 0.249719, 0.057600},
+    {-1.060640, 0.176940, -0.057600},
+    {-1.060640, 0.176940, 0.057600},
+    {-1.060532, -0.228687, -0.086400},
+    {-1.060532, -0.228687, 0.086400},
+    {-1.056078, 0.240284, -0.075600},
+    {-1.056078, 0.240284, 0.075600},
+    {-1.054810, -0.215182, -0.090000},
+    {-1.054810, -0.215182, 0.090000},
+    {-1.054180, 0.170955, -0.032400},
+    {-1.054180, 0.170955, 0.032400},
+    {-1.051800, 0.168750, 0.000000},
+    {-1.051800, 0.168750, 0.000000},
+    {-1.049088, -0.201678, -0.086400},
+    {-1.049088, -0.201678, 0.086400},
+    {-1.046808, 0.228828, -0.086400},
+    {-1.046808, 0.228828, 0.086400},
+    {-1.043830, -0.189269, -0.075600},
+    {-1.043830, -0.189269, 0.075600},
+    {-1.039501, -0.179050, -0.057600},
+    {-1.039501, -0.179050, 0.057600},
+    {-1.036720, 0.216360, -0.090000},
+    {-1.036720, 0.216360, 0.090000},
+    {-1.036562, -0.172115, 0.032400},
+    {-1.036562, -0.172115, -0.032400},
+    {-1.035480, -0.169560, 0.000000},
+    {-1.026632, 0.203892, -0.086400},
+    {-1.026632, 0.203892, 0.086400},
+    {-1.017362, 0.192436, -0.075600},
+    {-1.017362, 0.192436, 0.075600},
+    {-1.009729, 0.183001, -0.057600},
+    {-1.009729, 0.183001, 0.057600},
+    {-1.007760, -0.305520, 0.000000},
+    {-1.007760, -0.305520, 0.000000},
+    {-1.007339, -0.302751, 0.032400},
+    {-1.007339, -0.302751, -0.032400},
+    {-1.006196, -0.295236, 0.057600},
+    {-1.006196, -0.295236, -0.057600},
+    {-1.004548, 0.176599, -0.032400},
+    {-1.004548, 0.176599, 0.032400},
+    {-1.004511, -0.284162, 0.075600},
+    {-1.004511, -0.284162, -0.075600},
+    {-1.002640, 0.174240, 0.000000},
+    {-1.002640, 0.174240, 0.000000},
+    {-1.002466, -0.270714, 0.086400},
+    {-1.002466, -0.270714, -0.086400},
+    {-1.000240, -0.256080, 0.090000},
+    {-1.000240, -0.256080, -0.090000},
+    {-0.998014, -0.241446, 0.086400},
+    {-0.998014, -0.241446, -0.086400},
+    {-0.995969, -0.227998, 0.075600},
+    {-0.995969, -0.227998, -0.075600},
+    {-0.994284, -0.216924, -0.057600},
+    {-0.994284, -0.216924, 0.057600},
+    {-0.993141, -0.209409, 0.032400},
+    {-0.993141, -0.209409, -0.032400},
+    {-0.992800, 0.265140, 0.000000},
+    {-0.992720, -0.206640, 0.000000},
+    {-0.992720, -0.206640, 0.000000},
+    {-0.991470, 0.262688, -0.032400},
+    {-0.991470, 0.262688, 0.032400},
+    {-0.987862, 0.256033, -0.057600},
+    {-0.987862, 0.256033, 0.057600},
+    {-0.982544, 0.246225, -0.075600},
+    {-0.982544, 0.246225, 0.075600},
+    {-0.976087, 0.234315, -0.086400},
+    {-0.976087, 0.234315, 0.086400},
+    {-0.969060, 0.221355, 0.090000},
+    {-0.969060, 0.221355, -0.090000},
+    {-0.962033, 0.208395, -0.086400},
+    {-0.962033, 0.208395, 0.086400},
+    {-0.955576, 0.196485, -0.075600},
+    {-0.955576, 0.196485, 0.075600},
+    {-0.950258, 0.186677, -0.057600},
+    {-0.950258, 0.186677, 0.057600},
+    {-0.946650, 0.180022, -0.032400},
+    {-0.946650, 0.180022, 0.032400},
+    {-0.945320, 0.177570, 0.000000},
+    {-0.943240, -0.240480, 0.000000},
+    {-0.943240, -0.240480, 0.000000},
+    {-0.942926, -0.243508, 0.032400},
+    {-0.942926, -0.243508, -0.032400},
+    {-0.942073, -0.251726, 0.057600},
+    {-0.942073, -0.251726, -0.057600},
+    {-0.940816, -0.263837, 0.075600},
+    {-0.940816, -0.263837, -0.075600},
+    {-0.939290, -0.278544, 0.086400},
+    {-0.939290, -0.278544, -0.086400},
+    {-0.937630, -0.294548, 0.090000},
+    {-0.937630, -0.294548, -0.090000},
+    {-0.935970, -0.310552, 0.086400},
+    {-0.935970, -0.310552, -0.086400},
+    {-0.934444, -0.325258, 0.075600},
+    {-0.934444, -0.325258, -0.075600},
+    {-0.933187, -0.337369, 0.057600},
+    {-0.933187, -0.337369, -0.057600},
+    {-0.932334, -0.345587, 0.032400},
+    {-0.932334, -0.345587, -0.032400},
+    {-0.932020, -0.348615, 0.000000},
+    {-0.932020, -0.348615, 0.000000},
+    {-0.902800, 0.268560, 0.000000},
+    {-0.902800, 0.268560, 0.000000},
+    {-0.902164, 0.266060, -0.032400},
+    {-0.902164, 0.266060, 0.032400},
+    {-0.900437, 0.259275, -0.057600},
+    {-0.900437, 0.259275, 0.057600},
+    {-0.897892, 0.249276, -0.075600},
+    {-0.897892, 0.249276, 0.075600},
+    {-0.894802, 0.237134, 0.086400},
+    {-0.894802, 0.237134, -0.086400},
+    {-0.891440, 0.223920, 0.090000},
+    {-0.891440, 0.223920, -0.090000},
+    {-0.888078, 0.210706, 0.086400},
+    {-0.888078, 0.210706, -0.086400},
+    {-0.886800, -0.270000, 0.000000},
+    {-0.886800, -0.270000, 0.000000},
+    {-0.886800, -0.270000, 0.000000},
+    {-0.885680, -0.273360, 0.032400},
+    {-0.885680, -0.273360, -0.032400},
+    {-0.884988, 0.198564, -0.075600},
+    {-0.884988, 0.198564, 0.075600},
+    {-0.883900, -0.215130, -0.000000},
+    {-0.883900, -0.215130, 0.000000},
+    {-0.882640, -0.282480, 0.057600},
+    {-0.882640, -0.282480, -0.057600},
+    {-0.882443, 0.188565, 0.057600},
+    {-0.882443, 0.188565, -0.057600},
+    {-0.881200, -0.321330, 0.000000},
+    {-0.881200, -0.321330, 0.000000},
+    {-0.880716, 0.181780, -0.032400},
+    {-0.880716, 0.181780, 0.032400},
+    {-0.880080, 0.179280, 0.000000},
+    {-0.880080, 0.179280, 0.000000},
+    {-0.878160, -0.295920, 0.075600},
+    {-0.878160, -0.295920, -0.075600},
+    {-0.876496, -0.270000, -0.131264},
+    {-0.876496, -0.270000, -0.131264},
+    {-0.876496, -0.270000, 0.131264},
+    {-0.875600, -0.158640, -0.000000},
+    {-0.875600, -0.158640, 0.000000},
+    {-0.873633, -0.215130, -0.130788},
+    {-0.873633, -0.215130, 0.130788},
+    {-0.872720, -0.312240, 0.086400},
+    {-0.872720, -0.312240, -0.086400},
+    {-0.870968, -0.321330, -0.130345},
+    {-0.870968, -0.321330, 0.130345},
+    {-0.866800, -0.330000, -0.090000},
+    {-0.866800, -0.330000, 0.090000},
+    {-0.866000, -0.367440, 0.000000},
+    {-0.866000, -0.367440, 0.000000},
+    {-0.865440, -0.158640, -0.129426},
+    {-0.865440, -0.158640, 0.129426},
+    {-0.862500, -0.100710, 0.000000},
+    {-0.862500, -0.100710, 0.000000},
+    {-0.860880, -0.347760, 0.086400},
+    {-0.860880, -0.347760, -0.086400},
+    {-0.855964, -0.367440, -0.127851},
+    {-0.855964, -0.367440, 0.127851},
+    {-0.855440, -0.364080, 0.075600},
+    {-0.855440, -0.364080, -0.075600},
+    {-0.852509, -0.100710, -0.127277},
+    {-0.852509, -0.100710, 0.127277},
+    {-0.850960, -0.377520, 0.057600},
+    {-0.850960, -0.377520, -0.057600},
+    {-0.847920, -0.386640, 0.032400},
+    {-0.847920, -0.386640, -0.032400},
+    {-0.846800, -0.390000, 0.000000},
+    {-0.846800, -0.390000, 0.000000},
+    {-0.846608, -0.270000, -0.255232},
+    {-0.846608, -0.270000, -0.255232},
+    {-0.846608, -0.270000, 0.255232},
+    {-0.846608, -0.270000, 0.255232},
+    {-0.845200, -0.041520, 0.000000},
+    {-0.845200, -0.041520, 0.000000},
+    {-0.843854, -0.215130, -0.254307},
+    {-0.843854, -0.215130, 0.254307},
+    {-0.843600, -0.408510, 0.000000},
+    {-0.843600, -0.408510, 0.000000},
+    {-0.841289, -0.321330, -0.253445},
+    {-0.841289, -0.321330, 0.253445},
+    {-0.835971, -0.158640, -0.251659},
+    {-0.835971, -0.158640, 0.251659},
+    {-0.835432, -0.041520, -0.124438},
+    {-0.835432, -0.041520, 0.124438},
+    {-0.833852, -0.408510, -0.124176},
+    {-0.833852, -0.408510, 0.124176},
+    {-0.826853, -0.367440, -0.248596},
+    {-0.826853, -0.367440, 0.248596},
+    {-0.824300, 0.018750, 0.000000},
+    {-0.824300, 0.018750, 0.000000},
+    {-0.823529, -0.100710, -0.247479},
+    {-0.823529, -0.100710, 0.247479},
+    {-0.816400, -0.444720, -0.000000},
+    {-0.816400, -0.444720, 0.000000},
+    {-0.814801, 0.018750, -0.121009},
+    {-0.814801, 0.018750, 0.121009},
+    {-0.807160, 0.179910, 0.000000},
+    {-0.807098, -0.041520, -0.241960},
+    {-0.807098, -0.041520, 0.241960},
+    {-0.807003, -0.444720, -0.119713},
+    {-0.807003, -0.444720, 0.119713},
+    {-0.806982, 0.182428, -0.032400},
+    {-0.806982, 0.182428, 0.032400},
+    {-0.806498, 0.189261, -0.057600},
+    {-0.806498, 0.189261, 0.057600},
+    {-0.805786, 0.199330, -0.075600},
+    {-0.805786, 0.199330, 0.075600},
+    {-0.805578, -0.408510, -0.241450},
+    {-0.805578, -0.408510, 0.241450},
+    {-0.804921, 0.211558, -0.086400},
+    {-0.804921, 0.211558, 0.086400},
+    {-0.803980, 0.224865, -0.090000},
+    {-0.803980, 0.224865, 0.090000},
+    {-0.803039, 0.238172, -0.086400},
+    {-0.803039, 0.238172, 0.086400},
+    {-0.802174, 0.250400, -0.075600},
+    {-0.802174, 0.250400, 0.075600},
+    {-0.801462, 0.260469, -0.057600},
+    {-0.801462, 0.260469, 0.057600},
+    {-0.800978, 0.267302, -0.032400},
+    {-0.800978, 0.267302, 0.032400},
+    {-0.800800, 0.269820, 0.000000},
+    {-0.800400, 0.079920, -0.000000},
+    {-0.800400, 0.079920, 0.000000},
+    {-0.798672, -0.270000, -0.370368},
+    {-0.798672, -0.270000, -0.370368},
+    {-0.798672, -0.270000, 0.370368},
+    {-0.798672, -0.270000, 0.370368},
+    {-0.796092, -0.215130, -0.369026},
+    {-0.796092, -0.215130, 0.369026},
+    {-0.793689, -0.321330, -0.367776},
+    {-0.793689, -0.321330, 0.367776},
+    {-0.791209, 0.079920, -0.117088},
+    {-0.791209, 0.079920, 0.117088},
+    {-0.788706, -0.158640, -0.365183},
+    {-0.788706, -0.158640, 0.365183},
+    {-0.787248, 0.018750, -0.235292},
+    {-0.787248, 0.018750, 0.235292},
+    {-0.786800, -0.476250, -0.000000},
+    {-0.786800, -0.476250, 0.000000},
+    {-0.780163, -0.367440, -0.360738},
+    {-0.780163, -0.367440, 0.360738},
+    {-0.779745, -0.444720, -0.232772},
+    {-0.779745, -0.444720, 0.232772},
+    {-0.777784, -0.476250, -0.114856},
+    {-0.777784, -0.476250, 0.114856},
+    {-0.777049, -0.100710, -0.359118},
+    {-0.777049, -0.100710, 0.359118},
+    {-0.774100, 0.141810, -0.000000},
+    {-0.774100, 0.141810, 0.000000},
+    {-0.765248, 0.141810, -0.112772},
+    {-0.765248, 0.141810, 0.112772},
+    {-0.764549, 0.079920, -0.227667},
+    {-0.764549, 0.079920, 0.227667},
+    {-0.761655, -0.041520, -0.351109},
+    {-0.761655, -0.041520, 0.351109},
+    {-0.760231, -0.408510, -0.350368},
+    {-0.760231, -0.408510, 0.350368},
+    {-0.757200, -0.503280, 0.000000},
+    {-0.757200, -0.503280, 0.000000},
+    {-0.751632, -0.476250, -0.223328},
+    {-0.751632, -0.476250, 0.223328},
+    {-0.748565, -0.503280, -0.109999},
+    {-0.748565, -0.503280, 0.109999},
+    {-0.746000, 0.204240, 0.000000},
+    {-0.746000, 0.204240, 0.000000},
+    {-0.743057, 0.018750, -0.341433},
+    {-0.743057, 0.018750, 0.341433},
+    {-0.739570, 0.141810, -0.219276},
+    {-0.739570, 0.141810, 0.219276},
+    {-0.737510, 0.204240, -0.108162},
+    {-0.737510, 0.204240, 0.108162},
+    {-0.736027, -0.444720, -0.337776},
+    {-0.736027, -0.444720, 0.337776},
+    {-0.734224, -0.270000, -0.475136},
+    {-0.734224, -0.270000, -0.475136},
+    {-0.734224, -0.270000, 0.475136},
+    {-0.734224, -0.270000, 0.475136},
+    {-0.731877, -0.215130, -0.473414},
+    {-0.731877, -0.215130, 0.473414},
+    {-0.730000, -0.525990, -0.000000},
+    {-0.730000, -0.525990, 0.000000},
+    {-0.729692, -0.321330, -0.471810},
+    {-0.729692, -0.321330, 0.471810},
+    {-0.726800, 0.180000, 0.000000},
+    {-0.725680, 0.182520, -0.032400},
+    {-0.725680, 0.182520, 0.032400},
+    {-0.725160, -0.158640, -0.468484},
+    {-0.725160, -0.158640, 0.468484},
+    {-0.723519, -0.503280, -0.213884},
+    {-0.723519, -0.503280, 0.213884},
+    {-0.722640, 0.189360, -0.057600},
+    {-0.722640, 0.189360, 0.057600},
+    {-0.721790, 0.079920, -0.330368},
+    {-0.721790, 0.079920, 0.330368},
+    {-0.721716, -0.525990, 0.105536},
+    {-0.721716, -0.525990, -0.105536},
+    {-0.718160, 0.199440, -0.075600},
+    {-0.718160, 0.199440, 0.075600},
+    {-0.717391, -0.367440, -0.462782},
+    {-0.717391, -0.367440, 0.462782},
+    {-0.716700, 0.267030, 0.000000},
+    {-0.716700, 0.267030, 0.000000},
+    {-0.714558, -0.100710, -0.460704},
+    {-0.714558, -0.100710, 0.460704},
+    {-0.712882, 0.204240, -0.210311},
+    {-0.712882, 0.204240, 0.210311},
+    {-0.712720, 0.211680, -0.086400},
+    {-0.712720, 0.211680, 0.086400},
+    {-0.709688, -0.476250, -0.324072},
+    {-0.709688, -0.476250, 0.324072},
+    {-0.708587, 0.267030, -0.103354},
+    {-0.708587, 0.267030, 0.103354},
+    {-0.707600, -0.544560, 0.000000},
+    {-0.707600, -0.544560, 0.000000},
+    {-0.706800, 0.225000, -0.090000},
+    {-0.706800, 0.225000, 0.090000},
+    {-0.700880, 0.238320, -0.086400},
+    {-0.700880, 0.238320, 0.086400},
+    {-0.700558, -0.041520, -0.450429},
+    {-0.700558, -0.041520, 0.450429},
+    {-0.699604, -0.544560, 0.101861},
+    {-0.699604, -0.544560, -0.101861},
+    {-0.699263, -0.408510, -0.449479},
+    {-0.699263, -0.408510, 0.449479},
+    {-0.698387, 0.141810, -0.318192},
+    {-0.698387, 0.141810, 0.318192},
+    {-0.697686, -0.525990, -0.205206},
+    {-0.697686, -0.525990, 0.205206},
+    {-0.695440, 0.250560, -0.075600},
+    {-0.695440, 0.250560, 0.075600},
+    {-0.692400, -0.559170, 0.000000},
+    {-0.692400, -0.559170, 0.000000},
+    {-0.690960, 0.260640, -0.057600},
+    {-0.690960, 0.260640, 0.057600},
+    {-0.687920, 0.267480, -0.032400},
+    {-0.687920, 0.267480, 0.032400},
+    {-0.686800, 0.330000, 0.000000},
+    {-0.686800, -0.570000, 0.000000},
+    {-0.686800, 0.270000, 0.000000},
+    {-0.686800, 0.330000, 0.000000},
+    {-0.686800, -0.570000, 0.000000},
+    {-0.685390, -0.578970, -0.000000},
+    {-0.685390, -0.578970, 0.000000},
+    {-0.685054, 0.267030, -0.200963},
+    {-0.685054, 0.267030, 0.200963},
+    {-0.684600, -0.559170, 0.099367},
+    {-0.684600, -0.559170, -0.099367},
+    {-0.683644, 0.018750, -0.438016},
+    {-0.683644, 0.018750, 0.438016},
+    {-0.683349, -0.503280, -0.310368},
+    {-0.683349, -0.503280, 0.310368},
+    {-0.679120, -0.587760, 0.000000},
+    {-0.679120, -0.587760, -0.000000},
+    {-0.679072, 0.330000, -0.098448},
+    {-0.679072, -0.570000, 0.098448},
+    {-0.679072, 0.330000, 0.098448},
+    {-0.679072, -0.570000, -0.098448},
+    {-0.679072, -0.570000, -0.098448},
+    {-0.679072, -0.570000, 0.098448},
+    {-0.678930, 0.344175, 0.000000},
+    {-0.678930, 0.344175, 0.000000},
+    {-0.677680, -0.578970, 0.098217},
+    {-0.677680, -0.578970, -0.098217},
+    {-0.677251, -0.444720, -0.433324},
+    {-0.677251, -0.444720, 0.433324},
+    {-0.676411, -0.544560, 0.198060},
+    {-0.676411, -0.544560, -0.198060},
+    {-0.673382, 0.204240, -0.305183},
+    {-0.673382, 0.204240, 0.305183},
+    {-0.671491, -0.587760, -0.097188},
+    {-0.671491, -0.587760, 0.097188},
+    {-0.671303, 0.344175, -0.097157},
+    {-0.671303, 0.344175, 0.097157},
+    {-0.670640, 0.355200, 0.000000},
+    {-0.670640, 0.355200, 0.000000},
+    {-0.664930, -0.596190, 0.000000},
+    {-0.664930, -0.596190, 0.000000},
+    {-0.664302, 0.079920, -0.423821},
+    {-0.664302, 0.079920, 0.423821},
+    {-0.663120, 0.355200, -0.095796},
+    {-0.663120, 0.355200, 0.095796},
+    {-0.662410, 0.363075, 0.000000},
+    {-0.661975, -0.559170, 0.193211},
+    {-0.661975, -0.559170, -0.193211},
+    {-0.659145, -0.525990, 0.297776},
+    {-0.659145, -0.525990, -0.297776},
+    {-0.657484, -0.596190, -0.094860},
+    {-0.657484, -0.596190, 0.094860},
+    {-0.656656, 0.330000, -0.191424},
+    {-0.656656, -0.570000, -0.191424},
+    {-0.656656, -0.570000, -0.191424},
+    {-0.656656, -0.570000, 0.191424},
+    {-0.656656, -0.570000, 0.191424},
+    {-0.656656, 0.330000, 0.191424},
+    {-0.655317, -0.578970, 0.190974},
+    {-0.655317, -0.578970, -0.190974},
+    {-0.654996, 0.363075, -0.094446},
+    {-0.654996, 0.363075, 0.094446},
+    {-0.654800, -0.270000, -0.568000},
+    {-0.654800, -0.270000, -0.568000},
+    {-0.654800, -0.270000, 0.568000},
+    {-0.654800, -0.270000, 0.568000},
+    {-0.654720, 0.367800, 0.000000},
+    {-0.654720, 0.367800, 0.000000},
+    {-0.653296, -0.476250, -0.415744},
+    {-0.653296, -0.476250, 0.415744},
+    {-0.652741, -0.215130, -0.565941},
+    {-0.652741, -0.215130, 0.565941},
+    {-0.650824, -0.321330, -0.564024},
+    {-0.650824, -0.321330, 0.564024},
+    {-0.649362, -0.587760, -0.188974},
+    {-0.649362, -0.587760, 0.188974},
+    {-0.649181, 0.344175, -0.188913},
+    {-0.649181, 0.344175, 0.188913},
+    {-0.648050, 0.369375, 0.000000},
+    {-0.648050, 0.369375, 0.000000},
+    {-0.647405, 0.367800, -0.093184},
+    {-0.647405, 0.367800, 0.093184},
+    {-0.647310, 0.267030, -0.291618},
+    {-0.647310, 0.267030, 0.291618},
+    {-0.646848, -0.158640, -0.560048},
+    {-0.646848, -0.158640, 0.560048},
+    {-0.646800, 0.330000, 0.000000},
+    {-0.646800, 0.330000, 0.000000},
+    {-0.643018, 0.141810, -0.408201},
+    {-0.643018, 0.141810, 0.408201},
+    {-0.642880, 0.367800, 0.000000},
+    {-0.642880, 0.367800, 0.000000},
+    {-0.641308, 0.355200, -0.186268},
+    {-0.641308, 0.355200, 0.186268},
+    {-0.641170, 0.344175, 0.000000},
+    {-0.641170, 0.344175, 0.000000},
+    {-0.640821, 0.369375, -0.092090},
+    {-0.640821, 0.369375, 0.092090},
+    {-0.640032, -0.367440, -0.553232},
+    {-0.640032, -0.367440, 0.553232},
+    {-0.639760, -0.604080, -0.000000},
+    {-0.639760, -0.604080, 0.000000},
+    {-0.639690, 0.363075, -0.000000},
+    {-0.639690, 0.363075, 0.000000},
+    {-0.639587, 0.330000, -0.091885},
+    {-0.639587, 0.330000, 0.091885},
+    {-0.639213, -0.544560, 0.287406},
+    {-0.639213, -0.544560, -0.287406},
+    {-0.638960, 0.355200, 0.000000},
+    {-0.638960, 0.355200, 0.000000},
+    {-0.637547, -0.100710, -0.550747},
+    {-0.637547, -0.100710, 0.550747},
+    {-0.635885, -0.596190, -0.184446},
+    {-0.635885, -0.596190, 0.184446},
+    {-0.635718, 0.367800, -0.091242},
+    {-0.635718, 0.367800, 0.091242},
+    {-0.634030, 0.344175, -0.090961},
+    {-0.634030, 0.344175, 0.090961},
+    {-0.633491, 0.363075, -0.183643},
+    {-0.633491, 0.363075, 0.183643},
+    {-0.632638, -0.604080, -0.090730},
+    {-0.632638, -0.604080, 0.090730},
+    {-0.632569, 0.363075, -0.090718},
+    {-0.632569, 0.363075, 0.090718},
+    {-0.631848, 0.355200, -0.090598},
+    {-0.631848, 0.355200, 0.090598},
+    {-0.629341, -0.503280, -0.398164},
+    {-0.629341, -0.503280, 0.398164},
+    {-0.626188, 0.367800, -0.181189},
+    {-0.626188, 0.367800, 0.181189},
+    {-0.625687, -0.559170, 0.280368},
+    {-0.625687, -0.559170, -0.280368},
+    {-0.625264, -0.041520, -0.538464},
+    {-0.625264, -0.041520, 0.538464},
+    {-0.624128, -0.408510, -0.537328},
+    {-0.624128, -0.408510, 0.537328},
+    {-0.620704, 0.330000, -0.277776},
+    {-0.620704, -0.570000, -0.277776},
+    {-0.620704, -0.570000, 0.277776},
+    {-0.620704, -0.570000, 0.277776},
+    {-0.620704, 0.330000, 0.277776},
+    {-0.620704, -0.570000, -0.277776},
+    {-0.620277, 0.204240, -0.391512},
+    {-0.620277, 0.204240, 0.391512},
+    {-0.619853, 0.369375, -0.179061},
+    {-0.619853, 0.369375, 0.179061},
+    {-0.619449, -0.578970, 0.277123},
+    {-0.619449, -0.578970, -0.277123},
+    {-0.618666, 0.330000, -0.178662},
+    {-0.618666, 0.330000, 0.178662},
+    {-0.614942, 0.367800, -0.177412},
+    {-0.614942, 0.367800, 0.177412},
+    {-0.613870, -0.587760, -0.274220},
+    {-0.613870, -0.587760, 0.274220},
+    {-0.613701, 0.344175, -0.274132},
+    {-0.613701, 0.344175, 0.274132},
+    {-0.613318, 0.344175, -0.176866},
+    {-0.613318, 0.344175, 0.176866},
+    {-0.611979, -0.604080, 0.176416},
+    {-0.611979, -0.604080, -0.176416},
+    {-0.611913, 0.363075, -0.176394},
+    {-0.611913, 0.363075, 0.176394},
+    {-0.611220, 0.355200, -0.176161},
+    {-0.611220, 0.355200, 0.176161},
+    {-0.610425, 0.018750, -0.523625},
+    {-0.610425, 0.018750, 0.523625},
+    {-0.607329, -0.525990, 0.382009},
+    {-0.607329, -0.525990, -0.382009},
+    {-0.606800, 0.330000, 0.000000},
+    {-0.606800, 0.330000, 0.000000},
+    {-0.606324, 0.355200, -0.270294},
+    {-0.606324, 0.355200, 0.270294},
+    {-0.604816, -0.444720, -0.518016},
+    {-0.604816, -0.444720, 0.518016},
+    {-0.601243, -0.596190, -0.267651},
+    {-0.601243, -0.596190, 0.267651},
+    {-0.600550, -0.611250, 0.000000},
+    {-0.600550, -0.611250, 0.000000},
+    {-0.600102, 0.330000, -0.085322},
+    {-0.600102, 0.330000, 0.085322},
+    {-0.599001, 0.363075, -0.266484},
+    {-0.599001, 0.363075, 0.266484},
+    {-0.596640, 0.346320, 0.000000},
+    {-0.596640, 0.346320, 0.000000},
+    {-0.596566, 0.267030, -0.374110},
+    {-0.596566, 0.267030, 0.374110},
+    {-0.593933, -0.611250, -0.084296},
+    {-0.593933, -0.611250, 0.084296},
+    {-0.593456, 0.079920, -0.506656},
+    {-0.593456, 0.079920, 0.506656},
+    {-0.592158, 0.367800, -0.262924},
+    {-0.592158, 0.367800, 0.262924},
+    {-0.590073, 0.346320, 0.083654},
+    {-0.590073, 0.346320, -0.083654},
+    {-0.589201, -0.544560, 0.368706},
+    {-0.589201, -0.544560, -0.368706},
+    {-0.586223, 0.369375, -0.259836},
+    {-0.586223, 0.369375, 0.259836},
+    {-0.585110, 0.330000, -0.259258},
+    {-0.585110, 0.330000, 0.259258},
+    {-0.583800, -0.476250, -0.497000},
+    {-0.583800, -0.476250, 0.497000},
+    {-0.581622, 0.367800, -0.257443},
+    {-0.581622, 0.367800, 0.257443},
+    {-0.580675, 0.330000, -0.165901},
+    {-0.580675, 0.330000, 0.165901},
+    {-0.580101, 0.344175, -0.256651},
+    {-0.580101, 0.344175, 0.256651},
+    {-0.578846, -0.604080, -0.255998},
+    {-0.578846, -0.604080, 0.255998},
+    {-0.578784, 0.363075, -0.255966},
+    {-0.578784, 0.363075, 0.255966},
+    {-0.578134, 0.355200, -0.255628},
+    {-0.578134, 0.355200, 0.255628},
+    {-0.576900, -0.559170, 0.359678},
+    {-0.576900, -0.559170, -0.359678},
+    {-0.574783, 0.141810, 0.487983},
+    {-0.574783, 0.141810, -0.487983},
+    {-0.574739, -0.611250, -0.163907},
+    {-0.574739, -0.611250, 0.163907},
+    {-0.572368, 0.330000, -0.356352},
+    {-0.572368, -0.570000, -0.356352},
+    {-0.572368, -0.570000, -0.356352},
+    {-0.572368, -0.570000, 0.356352},
+    {-0.572368, -0.570000, 0.356352},
+    {-0.572368, 0.330000, 0.356352},
+    {-0.571227, -0.578970, 0.355514},
+    {-0.571227, -0.578970, -0.355514},
+    {-0.571026, 0.346320, 0.162659},
+    {-0.571026, 0.346320, -0.162659},
+    {-0.568720, 0.359760, 0.000000},
+    {-0.568720, 0.359760, 0.000000},
+    {-0.566153, -0.587760, -0.351791},
+    {-0.566153, -0.587760, 0.351791},
+    {-0.565999, 0.344175, -0.351678},
+    {-0.565999, 0.344175, 0.351678},
+    {-0.562784, -0.503280, -0.475984},
+    {-0.562784, -0.503280, 0.475984},
+    {-0.562513, 0.359760, -0.079074},
+    {-0.562513, 0.359760, 0.079074},
+    {-0.561936, -0.270000, -0.647424},
+    {-0.561936, -0.270000, -0.647424},
+    {-0.561936, -0.270000, 0.647424},
+    {-0.561936, -0.270000, 0.647424},
+    {-0.560214, -0.215130, -0.645077},
+    {-0.560214, -0.215130, 0.645077},
+    {-0.559290, 0.355200, -0.346754},
+    {-0.559290, 0.355200, 0.346754},
+    {-0.558610, -0.321330, -0.642892},
+    {-0.558610, -0.321330, 0.642892},
+    {-0.555284, -0.158640, -0.638360},
+    {-0.555284, -0.158640, 0.638360},
+    {-0.554832, 0.204240, -0.468032},
+    {-0.554832, 0.204240, 0.468032},
+    {-0.554669, -0.596190, -0.343363},
+    {-0.554669, -0.596190, 0.343363},
+    {-0.552630, 0.363075, -0.341866},
+    {-0.552630, 0.363075, 0.341866},
+    {-0.549582, -0.367440, -0.630591},
+    {-0.549582, -0.367440, 0.630591},
+    {-0.549517, 0.330000, -0.240739},
+    {-0.549517, 0.330000, 0.240739},
+    {-0.547504, -0.100710, -0.627758},
+    {-0.547504, -0.100710, 0.627758},
+    {-0.546406, 0.367800, -0.337299},
+    {-0.546406, 0.367800, 0.337299},
+    {-0.544508, 0.359760, -0.153752},
+    {-0.544508, 0.359760, 0.153752},
+    {-0.544240, -0.617520, 0.000000},
+    {-0.544240, -0.617520, 0.000000},
+    {-0.543955, -0.611250, -0.237846},
+    {-0.543955, -0.611250, 0.237846},
+    {-0.543472, -0.525990, 0.456672},
+    {-0.543472, -0.525990, -0.456672},
+    {-0.541008, 0.369375, -0.333338},
+    {-0.541008, 0.369375, 0.333338},
+    {-0.540476, 0.346320, 0.236036},
+    {-0.540476, 0.346320, -0.236036},
+    {-0.539997, 0.330000, -0.332595},
+    {-0.539997, 0.330000, 0.332595},
+    {-0.538348, -0.617520, -0.075057},
+    {-0.538348, -0.617520, 0.075057},
+    {-0.537229, -0.041520, -0.613758},
+    {-0.537229, -0.041520, 0.613758},
+    {-0.536824, 0.367800, -0.330267},
+    {-0.536824, 0.367800, 0.330267},
+    {-0.536279, -0.408510, -0.612463},
+    {-0.536279, -0.408510, 0.612463},
+    {-0.535440, 0.344175, -0.329252},
+    {-0.535440, 0.344175, 0.329252},
+    {-0.534300, -0.604080, -0.328414},
+    {-0.534300, -0.604080, 0.328414},
+    {-0.534243, 0.363075, -0.328372},
+    {-0.534243, 0.363075, 0.328372},
+    {-0.534029, 0.267030, -0.447229},
+    {-0.534029, 0.267030, 0.447229},
+    {-0.533652, 0.355200, -0.327939},
+    {-0.533652, 0.355200, 0.327939},
+    {-0.527568, -0.544560, 0.440768},
+    {-0.527568, -0.544560, -0.440768},
+    {-0.526880, 0.371040, 0.000000},
+    {-0.526880, 0.371040, 0.000000},
+    {-0.524816, 0.018750, -0.596844},
+    {-0.524816, 0.018750, 0.596844},
+    {-0.521258, -0.617520, 0.145942},
+    {-0.521258, -0.617520, -0.145942},
+    {-0.521212, 0.371040, 0.072208},
+    {-0.521212, 0.371040, -0.072208},
+    {-0.520124, -0.444720, -0.590451},
+    {-0.520124, -0.444720, 0.590451},
+    {-0.516776, -0.559170, -0.429976},
+    {-0.516776, -0.559170, 0.429976},
+    {-0.515632, 0.359760, -0.223110},
+    {-0.515632, 0.359760, 0.223110},
+    {-0.512800, 0.330000, -0.426000},
+    {-0.512800, -0.570000, -0.426000},
+    {-0.512800, -0.570000, 0.426000},
+    {-0.512800, 0.330000, 0.426000},
+    {-0.511799, -0.578970, 0.424999},
+    {-0.511799, -0.578970, -0.424999},
+    {-0.510621, 0.079920, -0.577502},
+    {-0.510621, 0.079920, 0.577502},
+    {-0.507626, 0.330000, -0.308838},
+    {-0.507626, 0.330000, 0.308838},
+    {-0.507347, -0.587760, -0.420547},
+    {-0.507347, -0.587760, 0.420547},
+    {-0.507212, 0.344175, -0.420412},
+    {-0.507212, 0.344175, 0.420412},
+    {-0.504770, 0.371040, -0.140403},
+    {-0.504770, 0.371040, 0.140403},
+    {-0.502568, -0.611250, -0.305126},
+    {-0.502568, -0.611250, 0.305126},
+    {-0.502544, -0.476250, -0.566496},
+    {-0.502544, -0.476250, 0.566496},
+    {-0.501326, 0.355200, -0.414526},
+    {-0.501326, 0.355200, 0.414526},
+    {-0.499403, 0.346320, 0.302804},
+    {-0.499403, 0.346320, -0.302804},
+    {-0.497272, -0.596190, -0.410472},
+    {-0.497272, -0.596190, 0.410472},
+    {-0.495483, 0.363075, -0.408683},
+    {-0.495483, 0.363075, 0.408683},
+    {-0.495001, 0.141810, -0.556218},
+    {-0.495001, 0.141810, 0.556218},
+    {-0.493848, -0.617520, 0.211776},
+    {-0.493848, -0.617520, -0.211776},
+    {-0.490023, 0.367800, -0.403223},
+    {-0.490023, 0.367800, 0.403223},
+    {-0.485288, 0.369375, -0.398488},
+    {-0.485288, 0.369375, 0.398488},
+    {-0.484964, -0.503280, -0.542541},
+    {-0.484964, -0.503280, 0.542541},
+    {-0.484400, 0.330000, -0.397600},
+    {-0.484400, 0.330000, 0.397600},
+    {-0.481617, 0.367800, -0.394817},
+    {-0.481617, 0.367800, 0.394817},
+    {-0.480403, 0.344175, -0.393603},
+    {-0.480403, 0.344175, 0.393603},
+    {-0.479402, -0.604080, 0.392602},
+    {-0.479402, -0.604080, -0.392602},
+    {-0.479352, 0.363075, -0.392552},
+    {-0.479352, 0.363075, 0.392552},
+    {-0.478834, 0.355200, -0.392034},
+    {-0.478834, 0.355200, 0.392034},
+    {-0.478401, 0.371040, 0.203740},
+    {-0.478401, 0.371040, -0.203740},
+    {-0.478312, 0.204240, -0.533477},
+    {-0.478312, 0.204240, 0.533477},
+    {-0.476808, 0.359760, -0.286222},
+    {-0.476808, 0.359760, 0.286222},
+    {-0.474960, 0.380880, 0.000000},
+    {-0.474960, 0.380880, 0.000000},
+    {-0.469960, 0.380880, -0.063689},
+    {-0.469960, 0.380880, 0.063689},
+    {-0.468809, -0.525990, 0.520529},
+    {-0.468809, -0.525990, -0.520529},
+    {-0.467770, -0.622710, -0.000000},
+    {-0.467770, -0.622710, 0.000000},
+    {-0.462863, -0.622710, 0.062510},
+    {-0.462863, -0.622710, -0.062510},
+    {-0.460910, 0.267030, -0.509766},
+    {-0.460910, 0.267030, 0.509766},
+    {-0.457168, -0.270000, -0.711872},
+    {-0.457168, -0.270000, 0.711872},
+    {-0.457168, -0.270000, 0.711872},
+    {-0.457168, -0.270000, -0.711872},
+    {-0.456997, -0.617520, 0.271683},
+    {-0.456997, -0.617520, -0.271683},
+    {-0.456000, 0.330000, -0.369200},
+    {-0.456000, 0.330000, 0.369200},
+    {-0.455826, -0.215130, 0.709292},
+    {-0.455826, -0.215130, -0.709292},
+    {-0.455506, -0.544560, 0.502401},
+    {-0.455506, -0.544560, -0.502401},
+    {-0.455459, 0.380880, -0.123838},
+    {-0.455459, 0.380880, 0.123838},
+    {-0.454576, -0.321330, -0.706889},
+    {-0.454576, -0.321330, 0.706889},
+    {-0.451983, -0.158640, -0.701906},
+    {-0.451983, -0.158640, 0.701906},
+    {-0.451562, -0.611250, -0.364762},
+    {-0.451562, -0.611250, 0.364762},
+    {-0.448786, 0.346320, 0.361986},
+    {-0.448786, 0.346320, -0.361986},
+    {-0.448630, -0.622710, 0.121545},
+    {-0.448630, -0.622710, -0.121545},
+    {-0.447538, -0.367440, -0.693363},
+    {-0.447538, -0.367440, 0.693363},
+    {-0.446478, -0.559170, 0.490100},
+    {-0.446478, -0.559170, -0.490100},
+    {-0.445918, -0.100710, -0.690249},
+    {-0.445918, -0.100710, 0.690249},
+    {-0.443152, -0.570000, -0.485568},
+    {-0.443152, -0.570000, 0.485568},
+    {-0.443152, 0.330000, -0.485568},
+    {-0.443152, -0.570000, -0.485568},
+    {-0.443152, -0.570000, 0.485568},
+    {-0.443152, 0.330000, 0.485568},
+    {-0.442948, 0.371040, -0.261372},
+    {-0.442948, 0.371040, 0.261372},
+    {-0.442314, -0.578970, 0.484427},
+    {-0.442314, -0.578970, -0.484427},
+    {-0.438591, -0.587760, -0.479353},
+    {-0.438591, -0.587760, 0.479353},
+    {-0.438478, 0.344175, -0.479199},
+    {-0.438478, 0.344175, 0.479199},
+    {-0.437909, -0.041520, -0.674855},
+    {-0.437909, -0.041520, 0.674855},
+    {-0.437168, -0.408510, -0.673431},
+    {-0.437168, -0.408510, 0.673431},
+    {-0.433554, 0.355200, -0.472490},
+    {-0.433554, 0.355200, 0.472490},
+    {-0.432200, 0.380880, -0.179702},
+    {-0.432200, 0.380880, 0.179702},
+    {-0.430163, -0.596190, -0.467869},
+    {-0.430163, -0.596190, 0.467869},
+    {-0.428963, 0.359760, -0.342163},
+    {-0.428963, 0.359760, 0.342163},
+    {-0.428666, 0.363075, -0.465830},
+    {-0.428666, 0.363075, 0.465830},
+    {-0.428233, 0.018750, -0.656257},
+    {-0.428233, 0.018750, 0.656257},
+    {-0.425802, -0.622710, -0.176374},
+    {-0.425802, -0.622710, 0.176374},
+    {-0.424576, -0.444720, 0.649227},
+    {-0.424576, -0.444720, -0.649227},
+    {-0.424099, 0.367800, -0.459606},
+    {-0.424099, 0.367800, 0.459606},
+    {-0.420138, 0.369375, -0.454208},
+    {-0.420138, 0.369375, 0.454208},
+    {-0.419395, 0.330000, -0.453197},
+    {-0.419395, 0.330000, 0.453197},
+    {-0.417168, 0.079920, 0.634990},
+    {-0.417168, 0.079920, -0.634990},
+    {-0.417067, 0.367800, -0.450024},
+    {-0.417067, 0.367800, 0.450024},
+    {-0.416800, 0.390000, 0.000000},
+    {-0.416800, 0.390000, 0.000000},
+    {-0.416052, 0.344175, -0.448640},
+    {-0.416052, 0.344175, 0.448640},
+    {-0.415214, -0.604080, 0.447500},
+    {-0.415214, -0.604080, -0.447500},
+    {-0.415172, 0.363075, 0.447443},
+    {-0.415172, 0.363075, -0.447443},
+    {-0.414739, 0.355200, -0.446852},
+    {-0.414739, 0.355200, 0.446852},
+    {-0.412550, 0.390000, -0.054146},
+    {-0.412550, 0.390000, 0.054146},
+    {-0.411582, -0.617520, 0.324782},
+    {-0.411582, -0.617520, -0.324782},
+    {-0.410872, -0.476250, 0.622888},
+    {-0.410872, -0.476250, -0.622888},
+    {-0.404992, 0.141810, 0.611587},
+    {-0.404992, 0.141810, -0.611587},
+    {-0.400930, 0.380880, -0.230536},
+    {-0.400930, 0.380880, 0.230536},
+    {-0.400221, 0.390000, -0.105283},
+    {-0.400221, 0.390000, 0.105283},
+    {-0.399257, 0.371040, -0.312457},
+    {-0.399257, 0.371040, 0.312457},
+    {-0.397168, -0.503280, -0.596549},
+    {-0.397168, -0.503280, 0.596549},
+    {-0.395638, 0.330000, -0.420826},
+    {-0.395638, 0.330000, 0.420826},
+    {-0.395112, -0.622710, 0.226266},
+    {-0.395112, -0.622710, -0.226266},
+    {-0.391983, 0.204240, -0.586582},
+    {-0.391983, 0.204240, 0.586582},
+    {-0.391926, -0.611250, -0.415768},
+    {-0.391926, -0.611250, 0.415768},
+    {-0.389604, 0.346320, 0.412603},
+    {-0.389604, 0.346320, -0.412603},
+    {-0.384576, -0.525990, 0.572345},
+    {-0.384576, -0.525990, -0.572345},
+    {-0.380447, 0.390000, -0.152777},
+    {-0.380447, 0.390000, 0.152777},
+    {-0.378418, 0.267030, -0.560510},
+    {-0.378418, 0.267030, 0.560510},
+    {-0.374206, -0.544560, 0.552413},
+    {-0.374206, -0.544560, -0.552413},
+    {-0.373022, 0.359760, -0.390008},
+    {-0.373022, 0.359760, 0.390008},
+    {-0.368080, -0.626640, 0.000000},
+    {-0.367168, -0.559170, 0.538887},
+    {-0.367168, -0.559170, -0.538887},
+    {-0.364576, -0.570000, -0.533904},
+    {-0.364576, -0.570000, 0.533904},
+    {-0.364576, 0.330000, 0.533904},
+    {-0.364576, -0.570000, 0.533904},
+    {-0.364576, 0.330000, -0.533904},
+    {-0.364576, -0.570000, -0.533904},
+    {-0.364457, -0.626640, -0.046152},
+    {-0.364457, -0.626640, 0.046152},
+    {-0.363923, -0.578970, 0.532649},
+    {-0.363923, -0.578970, -0.532649},
+    {-0.362394, 0.380880, -0.275594},
+    {-0.362394, 0.380880, 0.275594},
+    {-0.361020, -0.587760, -0.527070},
+    {-0.361020, -0.587760, 0.527070},
+    {-0.360932, 0.344175, -0.526901},
+    {-0.360932, 0.344175, 0.526901},
+    {-0.358483, -0.617520, -0.370197},
+    {-0.358483, -0.617520, 0.370197},
+    {-0.357289, -0.622710, 0.270489},
+    {-0.357289, -0.622710, -0.270489},
+    {-0.357094, 0.355200, -0.519524},
+    {-0.357094, 0.355200, 0.519524},
+    {-0.356240, 0.399120, 0.000000},
+    {-0.356240, 0.399120, 0.000000},
+    {-0.354451, -0.596190, -0.514443},
+    {-0.354451, -0.596190, 0.514443},
+    {-0.353948, -0.626640, -0.089740},
+    {-0.353948, -0.626640, 0.089740},
+    {-0.353862, 0.390000, -0.195994},
+    {-0.353862, 0.390000, 0.195994},
+    {-0.353284, 0.363075, 0.512201},
+    {-0.353284, 0.363075, -0.512201},
+    {-0.352770, 0.399120, -0.044210},
+    {-0.352770, 0.399120, 0.044210},
+    {-0.349724, 0.367800, -0.505358},
+    {-0.349724, 0.367800, 0.505358},
+    {-0.348172, 0.371040, -0.356148},
+    {-0.348172, 0.371040, 0.356148},
+    {-0.346636, 0.369375, -0.499423},
+    {-0.346636, 0.369375, 0.499423},
+    {-0.346058, 0.330000, -0.498310},
+    {-0.346058, 0.330000, 0.498310},
+    {-0.344243, 0.367800, -0.494822},
+    {-0.344243, 0.367800, 0.494822},
+    {-0.343451, 0.344175, -0.493301},
+    {-0.343451, 0.344175, 0.493301},
+    {-0.342798, -0.604080, -0.492046},
+    {-0.342798, -0.604080, 0.492046},
+    {-0.342766, 0.363075, 0.491984},
+    {-0.342766, 0.363075, -0.491984},
+    {-0.342703, 0.399120, -0.085962},
+    {-0.342703, 0.399120, 0.085962},
+    {-0.342428, 0.355200, -0.491334},
+    {-0.342428, 0.355200, 0.491334},
+    {-0.342032, -0.270000, -0.759808},
+    {-0.342032, -0.270000, -0.759808},
+    {-0.342032, -0.270000, 0.759808},
+    {-0.342032, -0.270000, 0.759808},
+    {-0.341107, -0.215130, -0.757054},
+    {-0.341107, -0.215130, 0.757054},
+    {-0.340245, -0.321330, -0.754489},
+    {-0.340245, -0.321330, 0.754489},
+    {-0.338459, -0.158640, -0.749171},
+    {-0.338459, -0.158640, 0.749171},
+    {-0.337094, -0.626640, 0.130221},
+    {-0.337094, -0.626640, -0.130221},
+    {-0.335396, -0.367440, -0.740053},
+    {-0.335396, -0.367440, 0.740053},
+    {-0.334279, -0.100710, -0.736729},
+    {-0.334279, -0.100710, 0.736729},
+    {-0.328760, -0.041520, -0.720298},
+    {-0.328760, -0.041520, 0.720298},
+    {-0.328250, -0.408510, -0.718778},
+    {-0.328250, -0.408510, 0.718778},
+    {-0.327539, 0.330000, -0.462717},
+    {-0.327539, 0.330000, 0.462717},
+    {-0.326558, 0.399120, -0.124740},
+    {-0.326558, 0.399120, 0.124740},
+    {-0.324646, -0.611250, -0.457155},
+    {-0.324646, -0.611250, 0.457155},
+    {-0.322836, 0.346320, 0.453676},
+    {-0.322836, 0.346320, -0.453676},
+    {-0.322092, 0.018750, -0.700448},
+    {-0.322092, 0.018750, 0.700448},
+    {-0.321100, 0.390000, -0.234300},
+    {-0.321100, 0.390000, 0.234300},
+    {-0.319572, -0.444720, -0.692945},
+    {-0.319572, -0.444720, 0.692945},
+    {-0.317336, 0.380880, -0.314130},
+    {-0.317336, 0.380880, 0.314130},
+    {-0.314467, 0.079920, -0.677749},
+    {-0.314467, 0.079920, 0.677749},
+    {-0.314434, -0.626640, -0.167058},
+    {-0.314434, -0.626640, 0.167058},
+    {-0.313066, -0.622710, 0.308312},
+    {-0.313066, -0.622710, -0.308312},
+    {-0.310128, -0.476250, -0.664832},
+    {-0.310128, -0.476250, 0.664832},
+    {-0.309910, 0.359760, -0.428832},
+    {-0.309910, 0.359760, 0.428832},
+    {-0.306076, 0.141810, -0.652770},
+    {-0.306076, 0.141810, 0.652770},
+    {-0.304852, 0.399120, -0.160026},
+    {-0.304852, 0.399120, 0.160026},
+    {-0.300684, -0.503280, -0.636719},
+    {-0.300684, -0.503280, 0.636719},
+    {-0.298576, -0.617520, -0.407048},
+    {-0.298576, -0.617520, 0.407048},
+    {-0.297120, 0.408960, 0.000000},
+    {-0.297120, 0.408960, 0.000000},
+    {-0.297111, 0.204240, -0.626082},
+    {-0.297111, 0.204240, 0.626082},
+    {-0.294411, 0.408960, 0.034509},
+    {-0.294411, 0.408960, -0.034509},
+    {-0.292006, -0.525990, -0.610886},
+    {-0.292006, -0.525990, 0.610886},
+    {-0.290540, 0.371040, 0.391601},
+    {-0.290540, 0.371040, -0.391601},
+    {-0.287763, 0.267030, -0.598254},
+    {-0.287763, 0.267030, 0.598254},
+    {-0.286554, 0.408960, -0.067100},
+    {-0.286554, 0.408960, 0.067100},
+    {-0.286509, -0.626640, -0.199709},
+    {-0.286509, -0.626640, 0.199709},
+    {-0.284860, -0.544560, -0.589611},
+    {-0.284860, -0.544560, 0.589611},
+    {-0.282794, 0.390000, -0.267062},
+    {-0.282794, 0.390000, 0.267062},
+    {-0.280011, -0.559170, -0.575175},
+    {-0.280011, -0.559170, 0.575175},
+    {-0.278224, -0.570000, 0.569856},
+    {-0.278224, 0.330000, -0.569856},
+    {-0.278224, -0.570000, -0.569856},
+    {-0.278224, -0.570000, -0.569856},
+    {-0.278224, -0.570000, 0.569856},
+    {-0.278224, 0.330000, 0.569856},
+    {-0.278102, 0.399120, -0.191302},
+    {-0.278102, 0.399120, 0.191302},
+    {-0.277774, -0.578970, 0.568517},
+    {-0.277774, -0.578970, -0.568517},
+    {-0.275774, -0.587760, 0.562562},
+    {-0.275774, -0.587760, -0.562562},
+    {-0.275713, 0.344175, -0.562381},
+    {-0.275713, 0.344175, 0.562381},
+    {-0.273951, 0.408960, -0.097370},
+    {-0.273951, 0.408960, 0.097370},
+    {-0.273068, 0.355200, -0.554508},
+    {-0.273068, 0.355200, 0.554508},
+    {-0.271246, -0.596190, 0.549085},
+    {-0.271246, -0.596190, -0.549085},
+    {-0.270443, 0.363075, -0.546691},
+    {-0.270443, 0.363075, 0.546691},
+    {-0.267989, 0.367800, -0.539388},
+    {-0.267989, 0.367800, 0.539388},
+    {-0.266502, 0.380880, -0.345400},
+    {-0.266502, 0.380880, 0.345400},
+    {-0.265861, 0.369375, -0.533053},
+    {-0.265861, 0.369375, 0.533053},
+    {-0.265462, 0.330000, -0.531866},
+    {-0.265462, 0.330000, 0.531866},
+    {-0.264212, 0.367800, -0.528142},
+    {-0.264212, 0.367800, 0.528142},
+    {-0.263666, 0.344175, -0.526518},
+    {-0.263666, 0.344175, 0.526518},
+    {-0.263216, -0.604080, 0.525179},
+    {-0.263216, -0.604080, -0.525179},
+    {-0.263194, 0.363075, -0.525113},
+    {-0.263194, 0.363075, 0.525113},
+    {-0.263174, -0.622710, 0.339002},
+    {-0.263174, -0.622710, -0.339002},
+    {-0.262961, 0.355200, -0.524420},
+    {-0.262961, 0.355200, 0.524420},
+    {-0.257008, 0.408960, 0.124913},
+    {-0.257008, 0.408960, -0.124913},
+    {-0.253858, -0.626640, -0.227634},
+    {-0.253858, -0.626640, 0.227634},
+    {-0.252701, 0.330000, -0.493875},
+    {-0.252701, 0.330000, 0.493875},
+    {-0.250707, -0.611250, 0.487939},
+    {-0.250707, -0.611250, -0.487939},
+    {-0.249459, 0.346320, -0.484226},
+    {-0.249459, 0.346320, 0.484226},
+    {-0.246826, 0.399120, -0.218052},
+    {-0.246826, 0.399120, 0.218052},
+    {-0.243280, 0.420240, 0.000000},
+    {-0.243280, 0.420240, 0.000000},
+    {-0.242110, -0.629130, -0.000000},
+    {-0.242110, -0.629130, 0.000000},
+    {-0.241264, 0.420240, -0.025675},
+    {-0.241264, 0.420240, 0.025675},
+    {-0.240552, 0.359760, -0.457708},
+    {-0.240552, 0.359760, 0.457708},
+    {-0.240110, -0.629130, -0.025483},
+    {-0.240110, -0.629130, 0.025483},
+    {-0.239577, 0.390000, -0.293647},
+    {-0.239577, 0.390000, 0.293647},
+    {-0.236127, 0.408960, -0.149327},
+    {-0.236127, 0.408960, 0.149327},
+    {-0.235418, 0.420240, -0.049923},
+    {-0.235418, 0.420240, 0.049923},
+    {-0.234307, -0.629130, -0.049550},
+    {-0.234307, -0.629130, 0.049550},
+    {-0.232742, -0.617520, 0.434458},
+    {-0.232742, -0.617520, -0.434458},
+    {-0.230160, 0.583920, 0.000000},
+    {-0.230160, 0.583920, 0.000000},
+    {-0.230080, 0.602460, 0.000000},
+    {-0.230080, 0.602460, 0.000000},
+    {-0.228323, 0.583920, -0.023606},
+    {-0.228323, 0.583920, 0.023606},
+    {-0.228244, 0.602460, -0.023595},
+    {-0.228244, 0.602460, 0.023595},
+    {-0.227203, 0.371040, -0.417970},
+    {-0.227203, 0.371040, 0.417970},
+    {-0.226042, 0.420240, -0.072444},
+    {-0.226042, 0.420240, 0.072444},
+    {-0.225001, -0.629130, -0.071902},
+    {-0.225001, -0.629130, 0.071902},
+    {-0.222991, 0.583920, -0.045870},
+    {-0.222991, 0.583920, 0.045870},
+    {-0.222916, 0.602460, -0.045848},
+    {-0.222916, 0.602460, 0.045848},
+    {-0.218064, -0.270000, -0.789696},
+    {-0.218064, -0.270000, 0.789696},
+    {-0.218064, -0.270000, 0.789696},
+    {-0.217588, -0.215130, -0.786833},
+    {-0.217588, -0.215130, 0.786833},
+    {-0.217145, -0.321330, -0.784168},
+    {-0.217145, -0.321330, 0.784168},
+    {-0.217021, -0.626640, -0.250294},
+    {-0.217021, -0.626640, 0.250294},
+    {-0.216800, 0.562500, 0.000000},
+    {-0.216800, 0.562500, 0.000000},
+    {-0.216226, -0.158640, -0.778640},
+    {-0.216226, -0.158640, 0.778640},
+    {-0.215134, 0.562500, -0.021403},
+    {-0.215134, 0.562500, 0.021403},
+    {-0.214651, -0.367440, -0.769164},
+    {-0.214651, -0.367440, 0.769164},
+    {-0.214433, 0.583920, -0.066522},
+    {-0.214433, 0.583920, 0.066522},
+    {-0.214363, 0.602460, -0.066488},
+    {-0.214363, 0.602460, 0.066488},
+    {-0.214077, -0.100710, -0.765709},
+    {-0.214077, -0.100710, 0.765709},
+    {-0.213436, 0.420240, -0.092937},
+    {-0.213436, 0.420240, 0.092937},
+    {-0.212489, -0.629130, -0.092242},
+    {-0.212489, -0.629130, 0.092242},
+    {-0.211713, 0.408960, -0.170208},
+    {-0.211713, 0.408960, 0.170208},
+    {-0.211540, 0.399120, -0.239758},
+    {-0.211540, 0.399120, 0.239758},
+    {-0.211238, -0.041520, -0.748632},
+    {-0.211238, -0.041520, 0.748632},
+    {-0.210976, -0.408510, -0.747052},
+    {-0.210976, -0.408510, 0.747052},
+    {-0.210638, 0.380880, -0.368659},
+    {-0.210638, 0.380880, 0.368659},
+    {-0.210320, 0.617040, 0.000000},
+    {-0.210320, 0.617040, 0.000000},
+    {-0.210298, 0.562500, -0.041590},
+    {-0.210298, 0.562500, 0.041590},
+    {-0.208737, 0.617040, -0.020342},
+    {-0.208737, 0.617040, 0.020342},
+    {-0.208345, -0.622710, 0.361830},
+    {-0.208345, -0.622710, -0.361830},
+    {-0.207809, 0.018750, -0.728001},
+    {-0.207809, 0.018750, 0.728001},
+    {-0.206513, -0.444720, -0.720203},
+    {-0.206513, -0.444720, 0.720203},
+    {-0.204144, 0.617040, -0.039526},
+    {-0.204144, 0.617040, 0.039526},
+    {-0.203888, 0.079920, -0.704409},
+    {-0.203888, 0.079920, 0.704409},
+    {-0.202918, 0.583920, -0.085294},
+    {-0.202918, 0.583920, 0.085294},
+    {-0.202855, 0.602460, -0.085249},
+    {-0.202855, 0.602460, 0.085249},
+    {-0.202536, 0.562500, -0.060317},
+    {-0.202536, 0.562500, 0.060317},
+    {-0.201656, -0.476250, -0.690984},
+    {-0.201656, -0.476250, 0.690984},
+    {-0.199572, 0.141810, 0.678448},
+    {-0.199572, 0.141810, -0.678448},
+    {-0.198560, 0.433680, 0.000000},
+    {-0.197901, 0.420240, -0.111101},
+    {-0.197901, 0.420240, 0.111101},
+    {-0.197120, 0.433680, -0.018338},
+    {-0.197120, 0.433680, 0.018338},
+    {-0.197070, -0.629130, -0.110270},
+    {-0.197070, -0.629130, 0.110270},
+    {-0.196799, -0.503280, -0.661765},
+    {-0.196799, -0.503280, 0.661765},
+    {-0.196771, 0.617040, -0.057320},
+    {-0.196771, 0.617040, 0.057320},
+    {-0.196240, 0.539280, 0.000000},
+    {-0.196240, 0.539280, 0.000000},
+    {-0.194962, 0.204240, -0.650710},
+    {-0.194962, 0.204240, 0.650710},
+    {-0.194837, 0.539280, -0.018013},
+    {-0.194837, 0.539280, 0.018013},
+    {-0.192945, 0.433680, -0.035656},
+    {-0.192945, 0.433680, 0.035656},
+    {-0.192336, -0.525990, 0.634916},
+    {-0.192336, -0.525990, -0.634916},
+    {-0.192093, 0.562500, -0.077339},
+    {-0.192093, 0.562500, 0.077339},
+    {-0.192083, 0.390000, -0.313421},
+    {-0.192083, 0.390000, 0.313421},
+    {-0.190764, 0.539280, -0.035004},
+    {-0.190764, 0.539280, 0.035004},
+    {-0.190154, 0.267030, -0.621787},
+    {-0.190154, 0.267030, 0.621787},
+    {-0.188715, 0.583920, -0.101915},
+    {-0.188715, 0.583920, 0.101915},
+    {-0.188661, 0.602460, -0.101861},
+    {-0.188661, 0.602460, 0.101861},
+    {-0.188661, -0.544560, -0.612804},
+    {-0.188661, -0.544560, 0.612804},
+    {-0.186851, 0.617040, -0.073494},
+    {-0.186851, 0.617040, 0.073494},
+    {-0.186248, 0.433680, 0.051740},
+    {-0.186248, 0.433680, -0.051740},
+    {-0.186167, -0.559170, -0.597800},
+    {-0.186167, -0.559170, 0.597800},
+    {-0.185248, -0.570000, 0.592272},
+    {-0.185248, 0.330000, -0.592272},
+    {-0.185248, -0.570000, -0.592272},
+    {-0.185248, -0.570000, -0.592272},
+    {-0.185248, -0.570000, 0.592272},
+    {-0.185248, 0.330000, 0.592272},
+    {-0.185017, -0.578970, 0.590880},
+    {-0.185017, -0.578970, -0.590880},
+    {-0.184228, 0.539280, -0.050768},
+    {-0.184228, 0.539280, 0.050768},
+    {-0.184170, 0.408960, 0.187151},
+    {-0.184170, 0.408960, -0.187151},
+    {-0.183988, -0.587760, 0.584691},
+    {-0.183988, -0.587760, -0.584691},
+    {-0.183957, 0.344175, -0.584503},
+    {-0.183957, 0.344175, 0.584503},
+    {-0.182596, 0.355200, -0.576320},
+    {-0.182596, 0.355200, 0.576320},
+    {-0.181660, -0.596190, 0.570684},
+    {-0.181660, -0.596190, -0.570684},
+    {-0.181246, 0.363075, -0.568196},
+    {-0.181246, 0.363075, 0.568196},
+    {-0.179984, 0.367800, -0.560605},
+    {-0.179984, 0.367800, 0.560605},
+    {-0.179737, 0.420240, -0.126636},
+    {-0.179737, 0.420240, 0.126636},
+    {-0.179212, 0.562500, -0.092412},
+    {-0.179212, 0.562500, 0.092412},
+    {-0.179042, -0.629130, -0.125689},
+    {-0.179042, -0.629130, 0.125689},
+    {-0.178890, 0.369375, -0.554021},
+    {-0.178890, 0.369375, 0.554021},
+    {-0.178685, 0.330000, -0.552787},
+    {-0.178685, 0.330000, 0.552787},
+    {-0.178042, 0.367800, -0.548918},
+    {-0.178042, 0.367800, 0.548918},
+    {-0.177761, 0.344175, -0.547230},
+    {-0.177761, 0.344175, 0.547230},
+    {-0.177530, -0.604080, 0.545838},
+    {-0.177530, -0.604080, -0.545838},
+    {-0.177518, 0.363075, 0.545769},
+    {-0.177518, 0.363075, -0.545769},
+    {-0.177398, 0.355200, -0.545048},
+    {-0.177398, 0.355200, 0.545048},
+    {-0.177245, 0.433680, -0.066376},
+    {-0.177245, 0.433680, 0.066376},
+    {-0.176540, -0.626640, 0.267148},
+    {-0.176540, -0.626640, -0.267148},
+    {-0.175434, 0.539280, -0.065098},
+    {-0.175434, 0.539280, 0.065098},
+    {-0.174720, 0.515340, 0.000000},
+    {-0.174720, 0.515340, 0.000000},
+    {-0.174614, 0.617040, -0.087814},
+    {-0.174614, 0.617040, 0.087814},
+    {-0.173592, 0.515340, 0.014463},
+    {-0.173592, 0.515340, -0.014463},
+    {-0.172762, 0.399120, -0.255903},
+    {-0.172762, 0.399120, 0.255903},
+    {-0.172122, 0.330000, -0.513302},
+    {-0.172122, 0.330000, 0.513302},
+    {-0.172094, 0.583920, -0.116118},
+    {-0.172094, 0.583920, 0.116118},
+    {-0.172049, 0.602460, -0.116055},
+    {-0.172049, 0.602460, 0.116055},
+    {-0.171096, -0.611250, -0.507133},
+    {-0.171096, -0.611250, 0.507133},
+    {-0.170454, 0.346320, -0.503273},
+    {-0.170454, 0.346320, 0.503273},
+    {-0.170318, 0.515340, 0.028108},
+    {-0.170318, 0.515340, -0.028108},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.166150, 0.433680, -0.079350},
+    {-0.166150, 0.433680, 0.079350},
+    {-0.165874, 0.359760, -0.475713},
+    {-0.165874, 0.359760, 0.475713},
+    {-0.165770, 0.450000, -0.013126},
+    {-0.165770, 0.450000, 0.013126},
+    {-0.165770, 0.450000, 0.013126},
+    {-0.165770, 0.450000, -0.013126},
+    {-0.165063, 0.515340, -0.040770},
+    {-0.165063, 0.515340, 0.040770},
+    {-0.164640, 0.626580, 0.000000},
+    {-0.164640, 0.626580, 0.000000},
+    {-0.164589, 0.539280, -0.077789},
+    {-0.164589, 0.539280, 0.077789},
+    {-0.164139, 0.562500, -0.105293},
+    {-0.164139, 0.562500, 0.105293},
+    {-0.163643, 0.626580, -0.012819},
+    {-0.163643, 0.626580, 0.012819},
+    {-0.162781, 0.450000, -0.025523},
+    {-0.162781, 0.450000, 0.025523},
+    {-0.162781, 0.450000, 0.025523},
+    {-0.162781, 0.450000, -0.025523},
+    {-0.161857, -0.617520, 0.451548},
+    {-0.161857, -0.617520, -0.451548},
+    {-0.160748, 0.626580, -0.024909},
+    {-0.160748, 0.626580, 0.024909},
+    {-0.160294, 0.617040, -0.100051},
+    {-0.160294, 0.617040, 0.100051},
+    {-0.159244, 0.420240, 0.139242},
+    {-0.159244, 0.420240, -0.139242},
+    {-0.159008, 0.371040, -0.434412},
+    {-0.159008, 0.371040, 0.434412},
+    {-0.158702, -0.629130, -0.138201},
+    {-0.158702, -0.629130, 0.138201},
+    {-0.158480, 0.491760, 0.000000},
+    {-0.158480, 0.491760, 0.000000},
+    {-0.157996, 0.515340, -0.052283},
+    {-0.157996, 0.515340, 0.052283},
+    {-0.157987, 0.450000, -0.037037},
+    {-0.157987, 0.450000, 0.037037},
+    {-0.157987, 0.450000, 0.037037},
+    {-0.157987, 0.450000, -0.037037},
+    {-0.157559, 0.491760, 0.011780},
+    {-0.157559, 0.491760, -0.011780},
+    {-0.156102, 0.626580, -0.036122},
+    {-0.156102, 0.626580, 0.036122},
+    {-0.154886, 0.491760, 0.022898},
+    {-0.154886, 0.491760, -0.022898},
+    {-0.153900, 0.408960, -0.199754},
+    {-0.153900, 0.408960, 0.199754},
+    {-0.153760, 0.469620, 0.000000},
+    {-0.153760, 0.469620, 0.000000},
+    {-0.153322, 0.583920, -0.127633},
+    {-0.153322, 0.583920, 0.127633},
+    {-0.153288, 0.602460, 0.127563},
+    {-0.153288, 0.602460, -0.127563},
+    {-0.153176, 0.433680, -0.090445},
+    {-0.153176, 0.433680, 0.090445},
+    {-0.152898, 0.469620, 0.010992},
+    {-0.152898, 0.469620, -0.010992},
+    {-0.151898, 0.539280, -0.088634},
+    {-0.151898, 0.539280, 0.088634},
+    {-0.151542, 0.450000, -0.047514},
+    {-0.151542, 0.450000, 0.047514},
+    {-0.151542, 0.450000, 0.047514},
+    {-0.151542, 0.450000, -0.047514},
+    {-0.150598, 0.491760, 0.033219},
+    {-0.150598, 0.491760, -0.033219},
+    {-0.150489, 0.380880, -0.383160},
+    {-0.150489, 0.380880, 0.383160},
+    {-0.150398, 0.469620, 0.021371},
+    {-0.150398, 0.469620, -0.021371},
+    {-0.149850, 0.626580, -0.046315},
+    {-0.149850, 0.626580, 0.046315},
+    {-0.149310, -0.622710, 0.376063},
+    {-0.149310, -0.622710, -0.376063},
+    {-0.149280, 0.515340, -0.062480},
+    {-0.149280, 0.515340, 0.062480},
+    {-0.147117, 0.562500, -0.115736},
+    {-0.147117, 0.562500, 0.115736},
+    {-0.146388, 0.469620, 0.031009},
+    {-0.146388, 0.469620, -0.031009},
+    {-0.144831, 0.491760, 0.042605},
+    {-0.144831, 0.491760, -0.042605},
+    {-0.144120, 0.617040, -0.109971},
+    {-0.144120, 0.617040, 0.109971},
+    {-0.143600, 0.450000, -0.056800},
+    {-0.143600, 0.450000, 0.056800},
+    {-0.143600, 0.450000, 0.056800},
+    {-0.143600, 0.450000, -0.056800},
+    {-0.142139, 0.626580, -0.055339},
+    {-0.142139, 0.626580, 0.055339},
+    {-0.140996, 0.469620, 0.039778},
+    {-0.140996, 0.469620, -0.039778},
+    {-0.140946, 0.390000, -0.325750},
+    {-0.140946, 0.390000, 0.325750},
+    {-0.139083, 0.515340, -0.071196},
+    {-0.139083, 0.515340, 0.071196},
+    {-0.138540, 0.433680, 0.099448},
+    {-0.138540, 0.433680, -0.099448},
+    {-0.137722, 0.491760, 0.050922},
+    {-0.137722, 0.491760, -0.050922},
+    {-0.137568, 0.539280, -0.097428},
+    {-0.137568, 0.539280, 0.097428},
+    {-0.136723, 0.420240, -0.148618},
+    {-0.136723, 0.420240, 0.148618},
+    {-0.136350, -0.629130, 0.147507},
+    {-0.136350, -0.629130, -0.147507},
+    {-0.134350, 0.469620, 0.047550},
+    {-0.134350, 0.469620, -0.047550},
+    {-0.134314, 0.450000, -0.064742},
+    {-0.134314, 0.450000, 0.064742},
+    {-0.134314, 0.450000, 0.064742},
+    {-0.134314, 0.450000, -0.064742},
+    {-0.133115, 0.626580, -0.063050},
+    {-0.133115, 0.626580, 0.063050},
+    {-0.132952, -0.626640, 0.277657},
+    {-0.132952, -0.626640, -0.277657},
+    {-0.132670, 0.583920, -0.136191},
+    {-0.132670, 0.583920, 0.136191},
+    {-0.132648, 0.602460, -0.136116},
+    {-0.132648, 0.602460, 0.136116},
+    {-0.131010, 0.399120, -0.265970},
+    {-0.131010, 0.399120, 0.265970},
+    {-0.129405, 0.491760, -0.058031},
+    {-0.129405, 0.491760, 0.058031},
+    {-0.128390, 0.562500, -0.123498},
+    {-0.128390, 0.562500, 0.123498},
+    {-0.127570, 0.515340, -0.078263},
+    {-0.127570, 0.515340, 0.078263},
+    {-0.126578, 0.469620, 0.054196},
+    {-0.126578, 0.469620, -0.054196},
+    {-0.126326, 0.617040, -0.117344},
+    {-0.126326, 0.617040, 0.117344},
+    {-0.123837, 0.450000, -0.071187},
+    {-0.123837, 0.450000, 0.071187},
+    {-0.123837, 0.450000, -0.071187},
+    {-0.123837, 0.450000, 0.071187},
+    {-0.122922, 0.626580, -0.069302},
+    {-0.122922, 0.626580, 0.069302},
+    {-0.122456, 0.433680, -0.106145},
+    {-0.122456, 0.433680, 0.106145},
+    {-0.121804, 0.539280, -0.103964},
+    {-0.121804, 0.539280, 0.103964},
+    {-0.121309, 0.408960, -0.207611},
+    {-0.121309, 0.408960, 0.207611},
+    {-0.120019, 0.491760, -0.063798},
+    {-0.120019, 0.491760, 0.063798},
+    {-0.117809, 0.469620, -0.059588},
+    {-0.117809, 0.469620, 0.059588},
+    {-0.114908, 0.515340, -0.083518},
+    {-0.114908, 0.515340, 0.083518},
+    {-0.112475, 0.420240, -0.154464},
+    {-0.112475, 0.420240, 0.154464},
+    {-0.112323, 0.450000, -0.075981},
+    {-0.112323, 0.450000, 0.075981},
+    {-0.112323, 0.450000, -0.075981},
+    {-0.112323, 0.450000, 0.075981},
+    {-0.112283, -0.629130, 0.153310},
+    {-0.112283, -0.629130, -0.153310},
+    {-0.111709, 0.626580, -0.073948},
+    {-0.111709, 0.626580, 0.073948},
+    {-0.110406, 0.583920, -0.141523},
+    {-0.110406, 0.583920, 0.141523},
+    {-0.110395, 0.602460, -0.141444},
+    {-0.110395, 0.602460, 0.141444},
+    {-0.109698, 0.491760, -0.068086},
+    {-0.109698, 0.491760, 0.068086},
+    {-0.108203, 0.562500, -0.128334},
+    {-0.108203, 0.562500, 0.128334},
+    {-0.108171, 0.469620, -0.063598},
+    {-0.108171, 0.469620, 0.063598},
+    {-0.107142, 0.617040, -0.121937},
+    {-0.107142, 0.617040, 0.121937},
+    {-0.105138, 0.433680, -0.110320},
+    {-0.105138, 0.433680, 0.110320},
+    {-0.104813, 0.539280, -0.108037},
+    {-0.104813, 0.539280, 0.108037},
+    {-0.101263, 0.515340, -0.086792},
+    {-0.101263, 0.515340, 0.086792},
+    {-0.099926, 0.450000, -0.078970},
+    {-0.099926, 0.450000, 0.078970},
+    {-0.099926, 0.450000, -0.078970},
+    {-0.099926, 0.450000, 0.078970},
+    {-0.099619, 0.626580, -0.076843},
+    {-0.099619, 0.626580, 0.076843},
+    {-0.098580, 0.491760, -0.070759},
+    {-0.098580, 0.491760, 0.070759},
+    {-0.097792, 0.469620, -0.066098},
+    {-0.097792, 0.469620, 0.066098},
+    {-0.086800, -0.525990, 0.643200},
+    {-0.086800, 0.141810, 0.687300},
+    {-0.086800, 0.204240, -0.659200},
+    {-0.086800, -0.367440, -0.779200},
+    {-0.086800, -0.321330, -0.794400},
+    {-0.086800, 0.363075, 0.552890},
+    {-0.086800, 0.450000, -0.080000},
+    {-0.086800, -0.578970, 0.598590},
+    {-0.086800, 0.359760, -0.481920},
+    {-0.086800, 0.469620, -0.066960},
+    {-0.086800, -0.622710, 0.380970},
+    {-0.086800, -0.611250, -0.513750},
+    {-0.086800, -0.604080, 0.552960},
+    {-0.086800, -0.476250, 0.700000},
+    {-0.086800, -0.444720, 0.729600},
+    {-0.086800, -0.408510, -0.756800},
+    {-0.086800, -0.215130, 0.797100},
+    {-0.086800, -0.158640, 0.788800},
+    {-0.086800, -0.100710, -0.775700},
+    {-0.086800, 0.018750, -0.737500},
+    {-0.086800, 0.079920, 0.713600},
+    {-0.086800, 0.330000, -0.520000},
+    {-0.086800, 0.344175, -0.592130},
+    {-0.086800, 0.344175, -0.554370},
+    {-0.086800, 0.355200, -0.583840},
+    {-0.086800, 0.355200, -0.552160},
+    {-0.086800, 0.367800, -0.556080},
+    {-0.086800, 0.371040, -0.440080},
+    {-0.086800, 0.491760, -0.071680},
+    {-0.086800, 0.515340, -0.087920},
+    {-0.086800, 0.399120, -0.269440},
+    {-0.086800, -0.587760, 0.592320},
+    {-0.086800, -0.559170, -0.605600},
+    {-0.086800, 0.367800, -0.567920},
+    {-0.086800, 0.380880, -0.388160},
+    {-0.086800, 0.539280, -0.109440},
+    {-0.086800, 0.617040, -0.123520},
+    {-0.086800, 0.408960, -0.210320},
+    {-0.086800, 0.450000, -0.080000},
+    {-0.086800, 0.562500, -0.130000},
+    {-0.086800, 0.626580, -0.077840},
+    {-0.086800, -0.629130, 0.155310},
+    {-0.086800, 0.602460, -0.143280},
+    {-0.086800, -0.630000, 0.000000},
+    {-0.086800, -0.629130, -0.155310},
+    {-0.086800, -0.629130, 0.155310},
+    {-0.086800, -0.626640, -0.281280},
+    {-0.086800, -0.626640, 0.281280},
+    {-0.086800, -0.622710, -0.380970},
+    {-0.086800, -0.622710, 0.380970},
+    {-0.086800, -0.617520, -0.457440},
+    {-0.086800, -0.617520, -0.457440},
+    {-0.086800, -0.617520, 0.457440},
+    {-0.086800, -0.617520, 0.457440},
+    {-0.086800, -0.611250, -0.513750},
+    {-0.086800, -0.611250, 0.513750},
+    {-0.086800, -0.604080, -0.552960},
+    {-0.086800, -0.604080, 0.552960},
+    {-0.086800, -0.596190, -0.578130},
+    {-0.086800, -0.596190, -0.578130},
+    {-0.086800, -0.596190, 0.578130},
+    {-0.086800, -0.596190, 0.578130},
+    {-0.086800, -0.587760, -0.592320},
+    {-0.086800, -0.587760, 0.592320},
+    {-0.086800, -0.578970, -0.598590},
+    {-0.086800, -0.578970, 0.598590},
+    {-0.086800, -0.570000, -0.600000},
+    {-0.086800, -0.570000, -0.600000},
+    {-0.086800, -0.570000, 0.600000},
+    {-0.086800, -0.570000, 0.600000},
+    {-0.086800, -0.559170, -0.605600},
+    {-0.086800, -0.559170, 0.605600},
+    {-0.086800, -0.544560, -0.620800},
+    {-0.086800, -0.544560, -0.620800},
+    {-0.086800, -0.544560, 0.620800},
+    {-0.086800, -0.544560, 0.620800},
+    {-0.086800, -0.525990, -0.643200},
+    {-0.086800, -0.525990, 0.643200},
+    {-0.086800, -0.503280, -0.670400},
+    {-0.086800, -0.503280, -0.670400},
+    {-0.086800, -0.503280, 0.670400},
+    {-0.086800, -0.503280, 0.670400},
+    {-0.086800, -0.476250, -0.700000},
+    {-0.086800, -0.476250, 0.700000},
+    {-0.086800, -0.444720, -0.729600},
+    {-0.086800, -0.444720, 0.729600},
+    {-0.086800, -0.408510, -0.756800},
+    {-0.086800, -0.408510, 0.756800},
+    {-0.086800, -0.367440, -0.779200},
+    {-0.086800, -0.367440, 0.779200},
+    {-0.086800, -0.321330, -0.794400},
+    {-0.086800, -0.321330, 0.794400},
+    {-0.086800, -0.270000, -0.800000},
+    {-0.086800, -0.270000, -0.800000},
+    {-0.086800, -0.270000, 0.800000},
+    {-0.086800, -0.270000, 0.800000},
+    {-0.086800, -0.215130, -0.797100},
+    {-0.086800, -0.215130, 0.797100},
+    {-0.086800, -0.158640, -0.788800},
+    {-0.086800, -0.158640, 0.788800},
+    {-0.086800, -0.100710, -0.775700},
+    {-0.086800, -0.100710, 0.775700},
+    {-0.086800, -0.041520, -0.758400},
+    {-0.086800, -0.041520, -0.758400},
+    {-0.086800, -0.041520, 0.758400},
+    {-0.086800, -0.041520, 0.758400},
+    {-0.086800, 0.018750, -0.737500},
+    {-0.086800, 0.018750, 0.737500},
+    {-0.086800, 0.079920, -0.713600},
+    {-0.086800, 0.079920, 0.713600},
+    {-0.086800, 0.141810, -0.687300},
+    {-0.086800, 0.141810, 0.687300},
+    {-0.086800, 0.204240, -0.659200},
+    {-0.086800, 0.204240, 0.659200},
+    {-0.086800, 0.267030, -0.629900},
+    {-0.086800, 0.267030, -0.629900},
+    {-0.086800, 0.267030, 0.629900},
+    {-0.086800, 0.267030, 0.629900},
+    {-0.086800, 0.330000, -0.600000},
+    {-0.086800, 0.330000, -0.600000},
+    {-0.086800, 0.330000, -0.560000},
+    {-0.086800, 0.330000, -0.560000},
+    {-0.086800, 0.330000, -0.520000},
+    {-0.086800, 0.330000, 0.520000},
+    {-0.086800, 0.330000, 0.560000},
+    {-0.086800, 0.330000, 0.560000},
+    {-0.086800, 0.330000, 0.600000},
+    {-0.086800, 0.330000, 0.600000},
+    {-0.086800, 0.344175, -0.592130},
+    {-0.086800, 0.344175, -0.554370},
+    {-0.086800, 0.344175, 0.554370},
+    {-0.086800, 0.344175, 0.592130},
+    {-0.086800, 0.346320, -0.509840},
+    {-0.086800, 0.346320, -0.509840},
+    {-0.086800, 0.346320, 0.509840},
+    {-0.086800, 0.346320, 0.509840},
+    {-0.086800, 0.355200, -0.583840},
+    {-0.086800, 0.355200, -0.552160},
+    {-0.086800, 0.355200, 0.552160},
+    {-0.086800, 0.355200, 0.583840},
+    {-0.086800, 0.359760, -0.481920},
+    {-0.086800, 0.359760, 0.481920},
+    {-0.086800, 0.363075, -0.575610},
+    {-0.086800, 0.363075, -0.552890},
+    {-0.086800, 0.363075, 0.552890},
+    {-0.086800, 0.363075, 0.575610},
+    {-0.086800, 0.367800, -0.567920},
+    {-0.086800, 0.367800, -0.556080},
+    {-0.086800, 0.367800, 0.556080},
+    {-0.086800, 0.367800, 0.567920},
+    {-0.086800, 0.369375, -0.561250},
+    {-0.086800, 0.369375, -0.561250},
+    {-0.086800, 0.369375, 0.561250},
+    {-0.086800, 0.369375, 0.561250},
+    {-0.086800, 0.371040, -0.440080},
+    {-0.086800, 0.371040, 0.440080},
+    {-0.086800, 0.380880, -0.388160},
+    {-0.086800, 0.380880, 0.388160},
+    {-0.086800, 0.390000, -0.330000},
+    {-0.086800, 0.390000, -0.330000},
+    {-0.086800, 0.390000, 0.330000},
+    {-0.086800, 0.390000, 0.330000},
+    {-0.086800, 0.399120, -0.269440},
+    {-0.086800, 0.399120, 0.269440},
+    {-0.086800, 0.408960, -0.210320},
+    {-0.086800, 0.408960, 0.210320},
+    {-0.086800, 0.420240, -0.156480},
+    {-0.086800, 0.420240, -0.156480},
+    {-0.086800, 0.420240, 0.156480},
+    {-0.086800, 0.420240, 0.156480},
+    {-0.086800, 0.433680, -0.111760},
+    {-0.086800, 0.433680, 0.111760},
+    {-0.086800, 0.450000, -0.080000},
+    {-0.086800, 0.450000, -0.080000},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.086800, 0.469620, -0.066960},
+    {-0.086800, 0.469620, 0.066960},
+    {-0.086800, 0.491760, -0.071680},
+    {-0.086800, 0.491760, 0.071680},
+    {-0.086800, 0.515340, -0.087920},
+    {-0.086800, 0.515340, 0.087920},
+    {-0.086800, 0.539280, -0.109440},
+    {-0.086800, 0.539280, 0.109440},
+    {-0.086800, 0.562500, -0.130000},
+    {-0.086800, 0.562500, 0.130000},
+    {-0.086800, 0.583920, -0.143360},
+    {-0.086800, 0.583920, -0.143360},
+    {-0.086800, 0.583920, 0.143360},
+    {-0.086800, 0.583920, 0.143360},
+    {-0.086800, 0.602460, -0.143280},
+    {-0.086800, 0.602460, 0.143280},
+    {-0.086800, 0.617040, -0.123520},
+    {-0.086800, 0.617040, 0.123520},
+    {-0.086800, 0.626580, -0.077840},
+    {-0.086800, 0.626580, 0.077840},
+    {-0.086800, 0.630000, 0.000000},
+    {-0.086800, -0.629130, -0.155310},
+    {-0.086800, 0.602460, 0.143280},
+    {-0.086800, 0.408960, 0.210320},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.086800, 0.562500, 0.130000},
+    {-0.086800, 0.626580, 0.077840},
+    {-0.086800, 0.617040, 0.123520},
+    {-0.086800, -0.587760, -0.592320},
+    {-0.086800, -0.559170, 0.605600},
+    {-0.086800, 0.367800, 0.567920},
+    {-0.086800, 0.380880, 0.388160},
+    {-0.086800, 0.539280, 0.109440},
+    {-0.086800, 0.399120, 0.269440},
+    {-0.086800, 0.515340, 0.087920},
+    {-0.086800, -0.622710, -0.380970},
+    {-0.086800, -0.611250, 0.513750},
+    {-0.086800, -0.604080, -0.552960},
+    {-0.086800, -0.476250, -0.700000},
+    {-0.086800, -0.444720, -0.729600},
+    {-0.086800, -0.408510, 0.756800},
+    {-0.086800, -0.215130, -0.797100},
+    {-0.086800, -0.158640, -0.788800},
+    {-0.086800, -0.100710, 0.775700},
+    {-0.086800, 0.018750, 0.737500},
+    {-0.086800, 0.079920, -0.713600},
+    {-0.086800, 0.330000, 0.520000},
+    {-0.086800, 0.344175, 0.554370},
+    {-0.086800, 0.344175, 0.592130},
+    {-0.086800, 0.355200, 0.552160},
+    {-0.086800, 0.355200, 0.583840},
+    {-0.086800, 0.367800, 0.556080},
+    {-0.086800, 0.371040, 0.440080},
+    {-0.086800, 0.491760, 0.071680},
+    {-0.086800, 0.469620, 0.066960},
+    {-0.086800, -0.578970, -0.598590},
+    {-0.086800, 0.359760, 0.481920},
+    {-0.086800, -0.367440, 0.779200},
+    {-0.086800, -0.321330, 0.794400},
+    {-0.086800, 0.363075, -0.552890},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.086800, -0.525990, -0.643200},
+    {-0.086800, 0.141810, -0.687300},
+    {-0.086800, 0.204240, 0.659200},
+    {-0.075808, 0.469620, -0.066098},
+    {-0.075808, 0.469620, 0.066098},
+    {-0.075020, 0.491760, -0.070759},
+    {-0.075020, 0.491760, 0.070759},
+    {-0.073981, 0.626580, -0.076843},
+    {-0.073981, 0.626580, 0.076843},
+    {-0.073674, 0.450000, -0.078970},
+    {-0.073674, 0.450000, 0.078970},
+    {-0.073674, 0.450000, -0.078970},
+    {-0.073674, 0.450000, 0.078970},
+    {-0.072337, 0.515340, -0.086792},
+    {-0.072337, 0.515340, 0.086792},
+    {-0.068787, 0.539280, -0.108037},
+    {-0.068787, 0.539280, 0.108037},
+    {-0.068462, 0.433680, -0.110320},
+    {-0.068462, 0.433680, 0.110320},
+    {-0.066458, 0.617040, -0.121937},
+    {-0.066458, 0.617040, 0.121937},
+    {-0.065429, 0.469620, -0.063598},
+    {-0.065429, 0.469620, 0.063598},
+    {-0.065397, 0.562500, -0.128334},
+    {-0.065397, 0.562500, 0.128334},
+    {-0.063902, 0.491760, -0.068086},
+    {-0.063902, 0.491760, 0.068086},
+    {-0.063205, 0.602460, -0.141444},
+    {-0.063205, 0.602460, 0.141444},
+    {-0.063194, 0.583920, -0.141523},
+    {-0.063194, 0.583920, 0.141523},
+    {-0.061891, 0.626580, -0.073948},
+    {-0.061891, 0.626580, 0.073948},
+    {-0.061317, -0.629130, 0.153310},
+    {-0.061317, -0.629130, -0.153310},
+    {-0.061277, 0.450000, -0.075981},
+    {-0.061277, 0.450000, 0.075981},
+    {-0.061277, 0.450000, -0.075981},
+    {-0.061277, 0.450000, 0.075981},
+    {-0.061125, 0.420240, -0.154464},
+    {-0.061125, 0.420240, 0.154464},
+    {-0.058692, 0.515340, -0.083518},
+    {-0.058692, 0.515340, 0.083518},
+    {-0.055791, 0.469620, -0.059588},
+    {-0.055791, 0.469620, 0.059588},
+    {-0.053581, 0.491760, -0.063798},
+    {-0.053581, 0.491760, 0.063798},
+    {-0.052291, 0.408960, -0.207611},
+    {-0.052291, 0.408960, 0.207611},
+    {-0.051796, 0.539280, -0.103964},
+    {-0.051796, 0.539280, 0.103964},
+    {-0.051144, 0.433680, -0.106145},
+    {-0.051144, 0.433680, 0.106145},
+    {-0.050678, 0.626580, -0.069302},
+    {-0.050678, 0.626580, 0.069302},
+    {-0.049763, 0.450000, -0.071187},
+    {-0.049763, 0.450000, 0.071187},
+    {-0.049763, 0.450000, -0.071187},
+    {-0.049763, 0.450000, 0.071187},
+    {-0.047274, 0.617040, -0.117344},
+    {-0.047274, 0.617040, 0.117344},
+    {-0.047022, 0.469620, 0.054196},
+    {-0.047022, 0.469620, -0.054196},
+    {-0.046030, 0.515340, -0.078263},
+    {-0.046030, 0.515340, 0.078263},
+    {-0.045210, 0.562500, -0.123498},
+    {-0.045210, 0.562500, 0.123498},
+    {-0.044195, 0.491760, -0.058031},
+    {-0.044195, 0.491760, 0.058031},
+    {-0.042590, 0.399120, -0.265970},
+    {-0.042590, 0.399120, 0.265970},
+    {-0.040952, 0.602460, -0.136116},
+    {-0.040952, 0.602460, 0.136116},
+    {-0.040930, 0.583920, -0.136191},
+    {-0.040930, 0.583920, 0.136191},
+    {-0.040648, -0.626640, 0.277657},
+    {-0.040648, -0.626640, -0.277657},
+    {-0.040485, 0.626580, -0.063050},
+    {-0.040485, 0.626580, 0.063050},
+    {-0.039286, 0.450000, 0.064742},
+    {-0.039286, 0.450000, -0.064742},
+    {-0.039286, 0.450000, -0.064742},
+    {-0.039286, 0.450000, 0.064742},
+    {-0.039250, 0.469620, 0.047550},
+    {-0.039250, 0.469620, -0.047550},
+    {-0.037250, -0.629130, 0.147507},
+    {-0.037250, -0.629130, -0.147507},
+    {-0.036877, 0.420240, -0.148618},
+    {-0.036877, 0.420240, 0.148618},
+    {-0.036032, 0.539280, -0.097428},
+    {-0.036032, 0.539280, 0.097428},
+    {-0.035878, 0.491760, 0.050922},
+    {-0.035878, 0.491760, -0.050922},
+    {-0.035060, 0.433680, 0.099448},
+    {-0.035060, 0.433680, -0.099448},
+    {-0.034517, 0.515340, -0.071196},
+    {-0.034517, 0.515340, 0.071196},
+    {-0.032654, 0.390000, -0.325750},
+    {-0.032654, 0.390000, 0.325750},
+    {-0.032604, 0.469620, 0.039778},
+    {-0.032604, 0.469620, -0.039778},
+    {-0.031461, 0.626580, -0.055339},
+    {-0.031461, 0.626580, 0.055339},
+    {-0.030000, 0.450000, 0.056800},
+    {-0.030000, 0.450000, -0.056800},
+    {-0.030000, 0.450000, -0.056800},
+    {-0.030000, 0.450000, 0.056800},
+    {-0.029480, 0.617040, -0.109971},
+    {-0.029480, 0.617040, 0.109971},
+    {-0.028769, 0.491760, 0.042605},
+    {-0.028769, 0.491760, -0.042605},
+    {-0.027212, 0.469620, 0.031009},
+    {-0.027212, 0.469620, -0.031009},
+    {-0.026483, 0.562500, -0.115736},
+    {-0.026483, 0.562500, 0.115736},
+    {-0.024320, 0.515340, -0.062480},
+    {-0.024320, 0.515340, 0.062480},
+    {-0.024290, -0.622710, 0.376063},
+    {-0.024290, -0.622710, -0.376063},
+    {-0.023750, 0.626580, -0.046315},
+    {-0.023750, 0.626580, 0.046315},
+    {-0.023202, 0.469620, 0.021371},
+    {-0.023202, 0.469620, -0.021371},
+    {-0.023111, 0.380880, -0.383160},
+    {-0.023111, 0.380880, 0.383160},
+    {-0.023002, 0.491760, 0.033219},
+    {-0.023002, 0.491760, -0.033219},
+    {-0.022058, 0.450000, 0.047514},
+    {-0.022058, 0.450000, -0.047514},
+    {-0.022058, 0.450000, -0.047514},
+    {-0.022058, 0.450000, 0.047514},
+    {-0.021702, 0.539280, -0.088634},
+    {-0.021702, 0.539280, 0.088634},
+    {-0.020702, 0.469620, 0.010992},
+    {-0.020702, 0.469620, -0.010992},
+    {-0.020424, 0.433680, -0.090445},
+    {-0.020424, 0.433680, 0.090445},
+    {-0.020312, 0.602460, 0.127563},
+    {-0.020312, 0.602460, -0.127563},
+    {-0.020278, 0.583920, -0.127633},
+    {-0.020278, 0.583920, 0.127633},
+    {-0.019840, 0.469620, -0.000000},
+    {-0.019840, 0.469620, 0.000000},
+    {-0.019700, 0.408960, -0.199754},
+    {-0.019700, 0.408960, 0.199754},
+    {-0.018714, 0.491760, 0.022898},
+    {-0.018714, 0.491760, -0.022898},
+    {-0.017498, 0.626580, -0.036122},
+    {-0.017498, 0.626580, 0.036122},
+    {-0.016041, 0.491760, 0.011780},
+    {-0.016041, 0.491760, -0.011780},
+    {-0.015613, 0.450000, 0.037037},
+    {-0.015613, 0.450000, -0.037037},
+    {-0.015613, 0.450000, -0.037037},
+    {-0.015613, 0.450000, 0.037037},
+    {-0.015604, 0.515340, -0.052283},
+    {-0.015604, 0.515340, 0.052283},
+    {-0.015120, 0.491760, -0.000000},
+    {-0.015120, 0.491760, 0.000000},
+    {-0.014898, -0.629130, -0.138201},
+    {-0.014898, -0.629130, 0.138201},
+    {-0.014592, 0.371040, -0.434412},
+    {-0.014592, 0.371040, 0.434412},
+    {-0.014356, 0.420240, 0.139242},
+    {-0.014356, 0.420240, -0.139242},
+    {-0.013306, 0.617040, -0.100051},
+    {-0.013306, 0.617040, 0.100051},
+    {-0.012852, 0.626580, -0.024909},
+    {-0.012852, 0.626580, 0.024909},
+    {-0.011743, -0.617520, 0.451548},
+    {-0.011743, -0.617520, -0.451548},
+    {-0.010819, 0.450000, 0.025523},
+    {-0.010819, 0.450000, -0.025523},
+    {-0.010819, 0.450000, -0.025523},
+    {-0.010819, 0.450000, 0.025523},
+    {-0.009957, 0.626580, -0.012819},
+    {-0.009957, 0.626580, 0.012819},
+    {-0.009461, 0.562500, -0.105293},
+    {-0.009461, 0.562500, 0.105293},
+    {-0.009011, 0.539280, -0.077789},
+    {-0.009011, 0.539280, 0.077789},
+    {-0.008960, 0.626580, 0.000000},
+    {-0.008960, 0.626580, -0.000000},
+    {-0.008537, 0.515340, -0.040770},
+    {-0.008537, 0.515340, 0.040770},
+    {-0.007830, 0.450000, 0.013126},
+    {-0.007830, 0.450000, -0.013126},
+    {-0.007830, 0.450000, -0.013126},
+    {-0.007830, 0.450000, 0.013126},
+    {-0.007726, 0.359760, -0.475713},
+    {-0.007726, 0.359760, 0.475713},
+    {-0.007450, 0.433680, -0.079350},
+    {-0.007450, 0.433680, 0.079350},
+    {-0.006800, 0.450000, -0.000000},
+    {-0.006800, 0.450000, 0.000000},
+    {-0.006800, 0.450000, 0.000000},
+    {-0.006800, 0.450000, -0.000000},
+    {-0.003282, 0.515340, 0.028108},
+    {-0.003282, 0.515340, -0.028108},
+    {-0.003146, 0.346320, -0.503273},
+    {-0.003146, 0.346320, 0.503273},
+    {-0.002504, -0.611250, -0.507133},
+    {-0.002504, -0.611250, 0.507133},
+    {-0.001551, 0.602460, -0.116055},
+    {-0.001551, 0.602460, 0.116055},
+    {-0.001506, 0.583920, -0.116118},
+    {-0.001506, 0.583920, 0.116118},
+    {-0.001478, 0.330000, -0.513302},
+    {-0.001478, 0.330000, 0.513302},
+    {-0.000838, 0.399120, -0.255903},
+    {-0.000838, 0.399120, 0.255903},
+    {-0.000008, 0.515340, 0.014463},
+    {-0.000008, 0.515340, -0.014463},
+    {0.001014, 0.617040, -0.087814},
+    {0.001014, 0.617040, 0.087814},
+    {0.001120, 0.515340, -0.000000},
+    {0.001120, 0.515340, 0.000000},
+    {0.001834, 0.539280, -0.065098},
+    {0.001834, 0.539280, 0.065098},
+    {0.002940, -0.626640, 0.267148},
+    {0.002940, -0.626640, -0.267148},
+    {0.003645, 0.433680, -0.066376},
+    {0.003645, 0.433680, 0.066376},
+    {0.003798, 0.355200, -0.545048},
+    {0.003798, 0.355200, 0.545048},
+    {0.003918, 0.363075, 0.545769},
+    {0.003918, 0.363075, -0.545769},
+    {0.003930, -0.604080, 0.545838},
+    {0.003930, -0.604080, -0.545838},
+    {0.004161, 0.344175, -0.547230},
+    {0.004161, 0.344175, 0.547230},
+    {0.004442, 0.367800, -0.548918},
+    {0.004442, 0.367800, 0.548918},
+    {0.005085, 0.330000, -0.552787},
+    {0.005085, 0.330000, 0.552787},
+    {0.005290, 0.369375, -0.554021},
+    {0.005290, 0.369375, 0.554021},
+    {0.005442, -0.629130, -0.125689},
+    {0.005442, -0.629130, 0.125689},
+    {0.005612, 0.562500, -0.092412},
+    {0.005612, 0.562500, 0.092412},
+    {0.006137, 0.420240, -0.126636},
+    {0.006137, 0.420240, 0.126636},
+    {0.006384, 0.367800, -0.560605},
+    {0.006384, 0.367800, 0.560605},
+    {0.007646, 0.363075, -0.568196},
+    {0.007646, 0.363075, 0.568196},
+    {0.008060, -0.596190, 0.570684},
+    {0.008060, -0.596190, -0.570684},
+    {0.008996, 0.355200, -0.576320},
+    {0.008996, 0.355200, 0.576320},
+    {0.010357, 0.344175, -0.584503},
+    {0.010357, 0.344175, 0.584503},
+    {0.010388, -0.587760, 0.584691},
+    {0.010388, -0.587760, -0.584691},
+    {0.010570, 0.408960, 0.187151},
+    {0.010570, 0.408960, -0.187151},
+    {0.010628, 0.539280, -0.050768},
+    {0.010628, 0.539280, 0.050768},
+    {0.011417, -0.578970, 0.590880},
+    {0.011417, -0.578970, -0.590880},
+    {0.011648, -0.570000, -0.592272},
+    {0.011648, 0.330000, -0.592272},
+    {0.011648, -0.570000, 0.592272},
+    {0.011648, -0.570000, 0.592272},
+    {0.011648, 0.330000, 0.592272},
+    {0.011648, -0.570000, -0.592272},
+    {0.012567, -0.559170, -0.597800},
+    {0.012567, -0.559170, 0.597800},
+    {0.012648, 0.433680, 0.051740},
+    {0.012648, 0.433680, -0.051740},
+    {0.013251, 0.617040, -0.073494},
+    {0.013251, 0.617040, 0.073494},
+    {0.015061, -0.544560, -0.612804},
+    {0.015061, -0.544560, 0.612804},
+    {0.015061, 0.602460, -0.101861},
+    {0.015061, 0.602460, 0.101861},
+    {0.015115, 0.583920, -0.101915},
+    {0.015115, 0.583920, 0.101915},
+    {0.016554, 0.267030, -0.621787},
+    {0.016554, 0.267030, 0.621787},
+    {0.017164, 0.539280, -0.035004},
+    {0.017164, 0.539280, 0.035004},
+    {0.018483, 0.390000, -0.313421},
+    {0.018483, 0.390000, 0.313421},
+    {0.018493, 0.562500, -0.077339},
+    {0.018493, 0.562500, 0.077339},
+    {0.018736, -0.525990, 0.634916},
+    {0.018736, -0.525990, -0.634916},
+    {0.019345, 0.433680, -0.035656},
+    {0.019345, 0.433680, 0.035656},
+    {0.021237, 0.539280, -0.018013},
+    {0.021237, 0.539280, 0.018013},
+    {0.021362, 0.204240, -0.650710},
+    {0.021362, 0.204240, 0.650710},
+    {0.022640, 0.539280, -0.000000},
+    {0.022640, 0.539280, 0.000000},
+    {0.023171, 0.617040, -0.057320},
+    {0.023171, 0.617040, 0.057320},
+    {0.023199, -0.503280, -0.661765},
+    {0.023199, -0.503280, 0.661765},
+    {0.023470, -0.629130, -0.110270},
+    {0.023470, -0.629130, 0.110270},
+    {0.023520, 0.433680, -0.018338},
+    {0.023520, 0.433680, 0.018338},
+    {0.024301, 0.420240, -0.111101},
+    {0.024301, 0.420240, 0.111101},
+    {0.024960, 0.433680, 0.000000},
+    {0.025972, 0.141810, 0.678448},
+    {0.025972, 0.141810, -0.678448},
+    {0.028056, -0.476250, -0.690984},
+    {0.028056, -0.476250, 0.690984},
+    {0.028936, 0.562500, -0.060317},
+    {0.028936, 0.562500, 0.060317},
+    {0.029255, 0.602460, -0.085249},
+    {0.029255, 0.602460, 0.085249},
+    {0.029318, 0.583920, -0.085294},
+    {0.029318, 0.583920, 0.085294},
+    {0.030288, 0.079920, -0.704409},
+    {0.030288, 0.079920, 0.704409},
+    {0.030544, 0.617040, -0.039526},
+    {0.030544, 0.617040, 0.039526},
+    {0.032913, -0.444720, -0.720203},
+    {0.032913, -0.444720, 0.720203},
+    {0.034209, 0.018750, -0.728001},
+    {0.034209, 0.018750, 0.728001},
+    {0.034745, -0.622710, 0.361830},
+    {0.034745, -0.622710, -0.361830},
+    {0.035137, 0.617040, -0.020342},
+    {0.035137, 0.617040, 0.020342},
+    {0.036698, 0.562500, -0.041590},
+    {0.036698, 0.562500, 0.041590},
+    {0.036720, 0.617040, 0.000000},
+    {0.036720, 0.617040, -0.000000},
+    {0.037038, 0.380880, -0.368659},
+    {0.037038, 0.380880, 0.368659},
+    {0.037376, -0.408510, -0.747052},
+    {0.037376, -0.408510, 0.747052},
+    {0.037638, -0.041520, -0.748632},
+    {0.037638, -0.041520, 0.748632},
+    {0.037940, 0.399120, -0.239758},
+    {0.037940, 0.399120, 0.239758},
+    {0.038113, 0.408960, -0.170208},
+    {0.038113, 0.408960, 0.170208},
+    {0.038889, -0.629130, -0.092242},
+    {0.038889, -0.629130, 0.092242},
+    {0.039836, 0.420240, -0.092937},
+    {0.039836, 0.420240, 0.092937},
+    {0.040477, -0.100710, -0.765709},
+    {0.040477, -0.100710, 0.765709},
+    {0.040763, 0.602460, -0.066488},
+    {0.040763, 0.602460, 0.066488},
+    {0.040833, 0.583920, -0.066522},
+    {0.040833, 0.583920, 0.066522},
+    {0.041051, -0.367440, -0.769164},
+    {0.041051, -0.367440, 0.769164},
+    {0.041534, 0.562500, -0.021403},
+    {0.041534, 0.562500, 0.021403},
+    {0.042626, -0.158640, -0.778640},
+    {0.042626, -0.158640, 0.778640},
+    {0.043200, 0.562500, 0.000000},
+    {0.043200, 0.562500, -0.000000},
+    {0.043421, -0.626640, -0.250294},
+    {0.043421, -0.626640, 0.250294},
+    {0.043545, -0.321330, -0.784168},
+    {0.043545, -0.321330, 0.784168},
+    {0.043988, -0.215130, -0.786833},
+    {0.043988, -0.215130, 0.786833},
+    {0.044464, -0.270000, -0.789696},
+    {0.044464, -0.270000, -0.789696},
+    {0.044464, -0.270000, 0.789696},
+    {0.049316, 0.602460, -0.045848},
+    {0.049316, 0.602460, 0.045848},
+    {0.049391, 0.583920, -0.045870},
+    {0.049391, 0.583920, 0.045870},
+    {0.051401, -0.629130, -0.071902},
+    {0.051401, -0.629130, 0.071902},
+    {0.052442, 0.420240, -0.072444},
+    {0.052442, 0.420240, 0.072444},
+    {0.053603, 0.371040, -0.417970},
+    {0.053603, 0.371040, 0.417970},
+    {0.054644, 0.602460, -0.023595},
+    {0.054644, 0.602460, 0.023595},
+    {0.054723, 0.583920, -0.023606},
+    {0.054723, 0.583920, 0.023606},
+    {0.056480, 0.602460, -0.000000},
+    {0.056480, 0.602460, 0.000000},
+    {0.056560, 0.583920, 0.000000},
+    {0.056560, 0.583920, 0.000000},
+    {0.059142, -0.617520, 0.434458},
+    {0.059142, -0.617520, -0.434458},
+    {0.060707, -0.629130, -0.049550},
+    {0.060707, -0.629130, 0.049550},
+    {0.061818, 0.420240, -0.049923},
+    {0.061818, 0.420240, 0.049923},
+    {0.062527, 0.408960, -0.149327},
+    {0.062527, 0.408960, 0.149327},
+    {0.065977, 0.390000, -0.293647},
+    {0.065977, 0.390000, 0.293647},
+    {0.066510, -0.629130, -0.025483},
+    {0.066510, -0.629130, 0.025483},
+    {0.066952, 0.359760, -0.457708},
+    {0.066952, 0.359760, 0.457708},
+    {0.067664, 0.420240, -0.025675},
+    {0.067664, 0.420240, 0.025675},
+    {0.068510, -0.629130, 0.000000},
+    {0.068510, -0.629130, 0.000000},
+    {0.069680, 0.420240, 0.000000},
+    {0.069680, 0.420240, 0.000000},
+    {0.073226, 0.399120, -0.218052},
+    {0.073226, 0.399120, 0.218052},
+    {0.075859, 0.346320, -0.484226},
+    {0.075859, 0.346320, 0.484226},
+    {0.077107, -0.611250, 0.487939},
+    {0.077107, -0.611250, -0.487939},
+    {0.079101, 0.330000, -0.493875},
+    {0.079101, 0.330000, 0.493875},
+    {0.080258, -0.626640, -0.227634},
+    {0.080258, -0.626640, 0.227634},
+    {0.083408, 0.408960, 0.124913},
+    {0.083408, 0.408960, -0.124913},
+    {0.089361, 0.355200, -0.524420},
+    {0.089361, 0.355200, 0.524420},
+    {0.089574, -0.622710, 0.339002},
+    {0.089574, -0.622710, -0.339002},
+    {0.089594, 0.363075, -0.525113},
+    {0.089594, 0.363075, 0.525113},
+    {0.089616, -0.604080, 0.525179},
+    {0.089616, -0.604080, -0.525179},
+    {0.090066, 0.344175, -0.526518},
+    {0.090066, 0.344175, 0.526518},
+    {0.090612, 0.367800, -0.528142},
+    {0.090612, 0.367800, 0.528142},
+    {0.091862, 0.330000, -0.531866},
+    {0.091862, 0.330000, 0.531866},
+    {0.092261, 0.369375, -0.533053},
+    {0.092261, 0.369375, 0.533053},
+    {0.092902, 0.380880, -0.345400},
+    {0.092902, 0.380880, 0.345400},
+    {0.094389, 0.367800, -0.539388},
+    {0.094389, 0.367800, 0.539388},
+    {0.096843, 0.363075, -0.546691},
+    {0.096843, 0.363075, 0.546691},
+    {0.097646, -0.596190, 0.549085},
+    {0.097646, -0.596190, -0.549085},
+    {0.099468, 0.355200, -0.554508},
+    {0.099468, 0.355200, 0.554508},
+    {0.100351, 0.408960, -0.097370},
+    {0.100351, 0.408960, 0.097370},
+    {0.102113, 0.344175, -0.562381},
+    {0.102113, 0.344175, 0.562381},
+    {0.102174, -0.587760, 0.562562},
+    {0.102174, -0.587760, -0.562562},
+    {0.104174, -0.578970, 0.568517},
+    {0.104174, -0.578970, -0.568517},
+    {0.104502, 0.399120, -0.191302},
+    {0.104502, 0.399120, 0.191302},
+    {0.104624, -0.570000, -0.569856},
+    {0.104624, 0.330000, -0.569856},
+    {0.104624, -0.570000, 0.569856},
+    {0.104624, -0.570000, 0.569856},
+    {0.104624, -0.570000, -0.569856},
+    {0.104624, 0.330000, 0.569856},
+    {0.106411, -0.559170, -0.575175},
+    {0.106411, -0.559170, 0.575175},
+    {0.109194, 0.390000, -0.267062},
+    {0.109194, 0.390000, 0.267062},
+    {0.111260, -0.544560, -0.589611},
+    {0.111260, -0.544560, 0.589611},
+    {0.112909, -0.626640, -0.199709},
+    {0.112909, -0.626640, 0.199709},
+    {0.112954, 0.408960, -0.067100},
+    {0.112954, 0.408960, 0.067100},
+    {0.114163, 0.267030, -0.598254},
+    {0.114163, 0.267030, 0.598254},
+    {0.116940, 0.371040, 0.391601},
+    {0.116940, 0.371040, -0.391601},
+    {0.118406, -0.525990, -0.610886},
+    {0.118406, -0.525990, 0.610886},
+    {0.120811, 0.408960, 0.034509},
+    {0.120811, 0.408960, -0.034509},
+    {0.123511, 0.204240, -0.626082},
+    {0.123511, 0.204240, 0.626082},
+    {0.123520, 0.408960, -0.000000},
+    {0.123520, 0.408960, 0.000000},
+    {0.124976, -0.617520, -0.407048},
+    {0.124976, -0.617520, 0.407048},
+    {0.127084, -0.503280, -0.636719},
+    {0.127084, -0.503280, 0.636719},
+    {0.131252, 0.399120, -0.160026},
+    {0.131252, 0.399120, 0.160026},
+    {0.132476, 0.141810, -0.652770},
+    {0.132476, 0.141810, 0.652770},
+    {0.136310, 0.359760, -0.428832},
+    {0.136310, 0.359760, 0.428832},
+    {0.136528, -0.476250, -0.664832},
+    {0.136528, -0.476250, 0.664832},
+    {0.139466, -0.622710, 0.308312},
+    {0.139466, -0.622710, -0.308312},
+    {0.140834, -0.626640, -0.167058},
+    {0.140834, -0.626640, 0.167058},
+    {0.140867, 0.079920, -0.677749},
+    {0.140867, 0.079920, 0.677749},
+    {0.143736, 0.380880, -0.314130},
+    {0.143736, 0.380880, 0.314130},
+    {0.145972, -0.444720, -0.692945},
+    {0.145972, -0.444720, 0.692945},
+    {0.147500, 0.390000, -0.234300},
+    {0.147500, 0.390000, 0.234300},
+    {0.148492, 0.018750, -0.700448},
+    {0.148492, 0.018750, 0.700448},
+    {0.149236, 0.346320, 0.453676},
+    {0.149236, 0.346320, -0.453676},
+    {0.151046, -0.611250, -0.457155},
+    {0.151046, -0.611250, 0.457155},
+    {0.152958, 0.399120, -0.124740},
+    {0.152958, 0.399120, 0.124740},
+    {0.153939, 0.330000, -0.462717},
+    {0.153939, 0.330000, 0.462717},
+    {0.154650, -0.408510, -0.718778},
+    {0.154650, -0.408510, 0.718778},
+    {0.155160, -0.041520, -0.720298},
+    {0.155160, -0.041520, 0.720298},
+    {0.160679, -0.100710, -0.736729},
+    {0.160679, -0.100710, 0.736729},
+    {0.161796, -0.367440, -0.740053},
+    {0.161796, -0.367440, 0.740053},
+    {0.163494, -0.626640, 0.130221},
+    {0.163494, -0.626640, -0.130221},
+    {0.164859, -0.158640, -0.749171},
+    {0.164859, -0.158640, 0.749171},
+    {0.166645, -0.321330, -0.754489},
+    {0.166645, -0.321330, 0.754489},
+    {0.167507, -0.215130, -0.757054},
+    {0.167507, -0.215130, 0.757054},
+    {0.168432, -0.270000, -0.759808},
+    {0.168432, -0.270000, -0.759808},
+    {0.168432, -0.270000, 0.759808},
+    {0.168432, -0.270000, 0.759808},
+    {0.168828, 0.355200, -0.491334},
+    {0.168828, 0.355200, 0.491334},
+    {0.169103, 0.399120, -0.085962},
+    {0.169103, 0.399120, 0.085962},
+    {0.169166, 0.363075, 0.491984},
+    {0.169166, 0.363075, -0.491984},
+    {0.169198, -0.604080, -0.492046},
+    {0.169198, -0.604080, 0.492046},
+    {0.169851, 0.344175, -0.493301},
+    {0.169851, 0.344175, 0.493301},
+    {0.170643, 0.367800, -0.494822},
+    {0.170643, 0.367800, 0.494822},
+    {0.172458, 0.330000, -0.498310},
+    {0.172458, 0.330000, 0.498310},
+    {0.173036, 0.369375, -0.499423},
+    {0.173036, 0.369375, 0.499423},
+    {0.174572, 0.371040, -0.356148},
+    {0.174572, 0.371040, 0.356148},
+    {0.176124, 0.367800, -0.505358},
+    {0.176124, 0.367800, 0.505358},
+    {0.179170, 0.399120, -0.044210},
+    {0.179170, 0.399120, 0.044210},
+    {0.179684, 0.363075, 0.512201},
+    {0.179684, 0.363075, -0.512201},
+    {0.180262, 0.390000, -0.195994},
+    {0.180262, 0.390000, 0.195994},
+    {0.180348, -0.626640, -0.089740},
+    {0.180348, -0.626640, 0.089740},
+    {0.180851, -0.596190, -0.514443},
+    {0.180851, -0.596190, 0.514443},
+    {0.182640, 0.399120, 0.000000},
+    {0.182640, 0.399120, -0.000000},
+    {0.183494, 0.355200, -0.519524},
+    {0.183494, 0.355200, 0.519524},
+    {0.183689, -0.622710, 0.270489},
+    {0.183689, -0.622710, -0.270489},
+    {0.184883, -0.617520, -0.370197},
+    {0.184883, -0.617520, 0.370197},
+    {0.187332, 0.344175, -0.526901},
+    {0.187332, 0.344175, 0.526901},
+    {0.187420, -0.587760, -0.527070},
+    {0.187420, -0.587760, 0.527070},
+    {0.188794, 0.380880, -0.275594},
+    {0.188794, 0.380880, 0.275594},
+    {0.190323, -0.578970, 0.532649},
+    {0.190323, -0.578970, -0.532649},
+    {0.190857, -0.626640, -0.046152},
+    {0.190857, -0.626640, 0.046152},
+    {0.190976, -0.570000, 0.533904},
+    {0.190976, -0.570000, -0.533904},
+    {0.190976, 0.330000, 0.533904},
+    {0.190976, -0.570000, -0.533904},
+    {0.190976, -0.570000, 0.533904},
+    {0.190976, 0.330000, -0.533904},
+    {0.193568, -0.559170, 0.538887},
+    {0.193568, -0.559170, -0.538887},
+    {0.194480, -0.626640, 0.000000},
+    {0.199422, 0.359760, -0.390008},
+    {0.199422, 0.359760, 0.390008},
+    {0.200606, -0.544560, 0.552413},
+    {0.200606, -0.544560, -0.552413},
+    {0.204818, 0.267030, -0.560510},
+    {0.204818, 0.267030, 0.560510},
+    {0.206847, 0.390000, -0.152777},
+    {0.206847, 0.390000, 0.152777},
+    {0.210976, -0.525990, 0.572345},
+    {0.210976, -0.525990, -0.572345},
+    {0.216004, 0.346320, 0.412603},
+    {0.216004, 0.346320, -0.412603},
+    {0.218326, -0.611250, -0.415768},
+    {0.218326, -0.611250, 0.415768},
+    {0.218383, 0.204240, -0.586582},
+    {0.218383, 0.204240, 0.586582},
+    {0.221512, -0.622710, 0.226266},
+    {0.221512, -0.622710, -0.226266},
+    {0.222038, 0.330000, -0.420826},
+    {0.222038, 0.330000, 0.420826},
+    {0.223568, -0.503280, -0.596549},
+    {0.223568, -0.503280, 0.596549},
+    {0.225657, 0.371040, -0.312457},
+    {0.225657, 0.371040, 0.312457},
+    {0.226621, 0.390000, -0.105283},
+    {0.226621, 0.390000, 0.105283},
+    {0.227330, 0.380880, -0.230536},
+    {0.227330, 0.380880, 0.230536},
+    {0.231392, 0.141810, 0.611587},
+    {0.231392, 0.141810, -0.611587},
+    {0.237272, -0.476250, 0.622888},
+    {0.237272, -0.476250, -0.622888},
+    {0.237982, -0.617520, 0.324782},
+    {0.237982, -0.617520, -0.324782},
+    {0.238950, 0.390000, -0.054146},
+    {0.238950, 0.390000, 0.054146},
+    {0.241139, 0.355200, -0.446852},
+    {0.241139, 0.355200, 0.446852},
+    {0.241572, 0.363075, 0.447443},
+    {0.241572, 0.363075, -0.447443},
+    {0.241614, -0.604080, 0.447500},
+    {0.241614, -0.604080, -0.447500},
+    {0.242452, 0.344175, -0.448640},
+    {0.242452, 0.344175, 0.448640},
+    {0.243200, 0.390000, 0.000000},
+    {0.243200, 0.390000, 0.000000},
+    {0.243467, 0.367800, -0.450024},
+    {0.243467, 0.367800, 0.450024},
+    {0.243568, 0.079920, 0.634990},
+    {0.243568, 0.079920, -0.634990},
+    {0.245795, 0.330000, -0.453197},
+    {0.245795, 0.330000, 0.453197},
+    {0.246538, 0.369375, -0.454208},
+    {0.246538, 0.369375, 0.454208},
+    {0.250499, 0.367800, -0.459606},
+    {0.250499, 0.367800, 0.459606},
+    {0.250976, -0.444720, 0.649227},
+    {0.250976, -0.444720, -0.649227},
+    {0.252202, -0.622710, -0.176374},
+    {0.252202, -0.622710, 0.176374},
+    {0.254633, 0.018750, -0.656257},
+    {0.254633, 0.018750, 0.656257},
+    {0.255066, 0.363075, -0.465830},
+    {0.255066, 0.363075, 0.465830},
+    {0.255363, 0.359760, -0.342163},
+    {0.255363, 0.359760, 0.342163},
+    {0.256563, -0.596190, -0.467869},
+    {0.256563, -0.596190, 0.467869},
+    {0.258600, 0.380880, -0.179702},
+    {0.258600, 0.380880, 0.179702},
+    {0.259954, 0.355200, -0.472490},
+    {0.259954, 0.355200, 0.472490},
+    {0.263568, -0.408510, -0.673431},
+    {0.263568, -0.408510, 0.673431},
+    {0.264309, -0.041520, -0.674855},
+    {0.264309, -0.041520, 0.674855},
+    {0.264878, 0.344175, -0.479199},
+    {0.264878, 0.344175, 0.479199},
+    {0.264991, -0.587760, -0.479353},
+    {0.264991, -0.587760, 0.479353},
+    {0.268714, -0.578970, 0.484427},
+    {0.268714, -0.578970, -0.484427},
+    {0.269348, 0.371040, -0.261372},
+    {0.269348, 0.371040, 0.261372},
+    {0.269552, -0.570000, -0.485568},
+    {0.269552, -0.570000, 0.485568},
+    {0.269552, 0.330000, -0.485568},
+    {0.269552, -0.570000, -0.485568},
+    {0.269552, -0.570000, 0.485568},
+    {0.269552, 0.330000, 0.485568},
+    {0.272318, -0.100710, -0.690249},
+    {0.272318, -0.100710, 0.690249},
+    {0.272878, -0.559170, 0.490100},
+    {0.272878, -0.559170, -0.490100},
+    {0.273938, -0.367440, -0.693363},
+    {0.273938, -0.367440, 0.693363},
+    {0.275030, -0.622710, 0.121545},
+    {0.275030, -0.622710, -0.121545},
+    {0.275186, 0.346320, 0.361986},
+    {0.275186, 0.346320, -0.361986},
+    {0.277962, -0.611250, -0.364762},
+    {0.277962, -0.611250, 0.364762},
+    {0.278383, -0.158640, -0.701906},
+    {0.278383, -0.158640, 0.701906},
+    {0.280976, -0.321330, -0.706889},
+    {0.280976, -0.321330, 0.706889},
+    {0.281859, 0.380880, -0.123838},
+    {0.281859, 0.380880, 0.123838},
+    {0.281906, -0.544560, 0.502401},
+    {0.281906, -0.544560, -0.502401},
+    {0.282226, -0.215130, 0.709292},
+    {0.282226, -0.215130, -0.709292},
+    {0.282400, 0.330000, -0.369200},
+    {0.282400, 0.330000, 0.369200},
+    {0.283397, -0.617520, 0.271683},
+    {0.283397, -0.617520, -0.271683},
+    {0.283568, -0.270000, 0.711872},
+    {0.283568, -0.270000, -0.711872},
+    {0.283568, -0.270000, -0.711872},
+    {0.283568, -0.270000, 0.711872},
+    {0.287310, 0.267030, -0.509766},
+    {0.287310, 0.267030, 0.509766},
+    {0.289263, -0.622710, 0.062510},
+    {0.289263, -0.622710, -0.062510},
+    {0.294170, -0.622710, 0.000000},
+    {0.294170, -0.622710, 0.000000},
+    {0.295209, -0.525990, 0.520529},
+    {0.295209, -0.525990, -0.520529},
+    {0.296360, 0.380880, -0.063689},
+    {0.296360, 0.380880, 0.063689},
+    {0.301360, 0.380880, 0.000000},
+    {0.301360, 0.380880, -0.000000},
+    {0.303208, 0.359760, -0.286222},
+    {0.303208, 0.359760, 0.286222},
+    {0.304712, 0.204240, -0.533477},
+    {0.304712, 0.204240, 0.533477},
+    {0.304801, 0.371040, 0.203740},
+    {0.304801, 0.371040, -0.203740},
+    {0.305234, 0.355200, -0.392034},
+    {0.305234, 0.355200, 0.392034},
+    {0.305752, 0.363075, -0.392552},
+    {0.305752, 0.363075, 0.392552},
+    {0.305802, -0.604080, 0.392602},
+    {0.305802, -0.604080, -0.392602},
+    {0.306803, 0.344175, -0.393603},
+    {0.306803, 0.344175, 0.393603},
+    {0.308017, 0.367800, -0.394817},
+    {0.308017, 0.367800, 0.394817},
+    {0.310800, 0.330000, -0.397600},
+    {0.310800, 0.330000, 0.397600},
+    {0.311364, -0.503280, -0.542541},
+    {0.311364, -0.503280, 0.542541},
+    {0.311688, 0.369375, -0.398488},
+    {0.311688, 0.369375, 0.398488},
+    {0.316423, 0.367800, -0.403223},
+    {0.316423, 0.367800, 0.403223},
+    {0.320248, -0.617520, 0.211776},
+    {0.320248, -0.617520, -0.211776},
+    {0.321401, 0.141810, -0.556218},
+    {0.321401, 0.141810, 0.556218},
+    {0.321883, 0.363075, -0.408683},
+    {0.321883, 0.363075, 0.408683},
+    {0.323672, -0.596190, -0.410472},
+    {0.323672, -0.596190, 0.410472},
+    {0.325803, 0.346320, 0.302804},
+    {0.325803, 0.346320, -0.302804},
+    {0.327726, 0.355200, -0.414526},
+    {0.327726, 0.355200, 0.414526},
+    {0.328944, -0.476250, -0.566496},
+    {0.328944, -0.476250, 0.566496},
+    {0.328968, -0.611250, -0.305126},
+    {0.328968, -0.611250, 0.305126},
+    {0.331170, 0.371040, -0.140403},
+    {0.331170, 0.371040, 0.140403},
+    {0.333612, 0.344175, -0.420412},
+    {0.333612, 0.344175, 0.420412},
+    {0.333747, -0.587760, -0.420547},
+    {0.333747, -0.587760, 0.420547},
+    {0.334026, 0.330000, -0.308838},
+    {0.334026, 0.330000, 0.308838},
+    {0.337021, 0.079920, -0.577502},
+    {0.337021, 0.079920, 0.577502},
+    {0.338199, -0.578970, 0.424999},
+    {0.338199, -0.578970, -0.424999},
+    {0.339200, -0.570000, -0.426000},
+    {0.339200, -0.570000, 0.426000},
+    {0.339200, 0.330000, -0.426000},
+    {0.339200, 0.330000, 0.426000},
+    {0.342032, 0.359760, -0.223110},
+    {0.342032, 0.359760, 0.223110},
+    {0.343176, -0.559170, -0.429976},
+    {0.343176, -0.559170, 0.429976},
+    {0.346524, -0.444720, -0.590451},
+    {0.346524, -0.444720, 0.590451},
+    {0.347612, 0.371040, 0.072208},
+    {0.347612, 0.371040, -0.072208},
+    {0.347658, -0.617520, 0.145942},
+    {0.347658, -0.617520, -0.145942},
+    {0.351216, 0.018750, -0.596844},
+    {0.351216, 0.018750, 0.596844},
+    {0.353280, 0.371040, -0.000000},
+    {0.353280, 0.371040, 0.000000},
+    {0.353968, -0.544560, 0.440768},
+    {0.353968, -0.544560, -0.440768},
+    {0.360052, 0.355200, -0.327939},
+    {0.360052, 0.355200, 0.327939},
+    {0.360429, 0.267030, -0.447229},
+    {0.360429, 0.267030, 0.447229},
+    {0.360643, 0.363075, -0.328372},
+    {0.360643, 0.363075, 0.328372},
+    {0.360700, -0.604080, -0.328414},
+    {0.360700, -0.604080, 0.328414},
+    {0.361840, 0.344175, -0.329252},
+    {0.361840, 0.344175, 0.329252},
+    {0.362679, -0.408510, -0.612463},
+    {0.362679, -0.408510, 0.612463},
+    {0.363224, 0.367800, -0.330267},
+    {0.363224, 0.367800, 0.330267},
+    {0.363629, -0.041520, -0.613758},
+    {0.363629, -0.041520, 0.613758},
+    {0.364748, -0.617520, -0.075057},
+    {0.364748, -0.617520, 0.075057},
+    {0.366397, 0.330000, -0.332595},
+    {0.366397, 0.330000, 0.332595},
+    {0.366876, 0.346320, 0.236036},
+    {0.366876, 0.346320, -0.236036},
+    {0.367408, 0.369375, -0.333338},
+    {0.367408, 0.369375, 0.333338},
+    {0.369872, -0.525990, 0.456672},
+    {0.369872, -0.525990, -0.456672},
+    {0.370355, -0.611250, -0.237846},
+    {0.370355, -0.611250, 0.237846},
+    {0.370640, -0.617520, 0.000000},
+    {0.370640, -0.617520, 0.000000},
+    {0.370908, 0.359760, -0.153752},
+    {0.370908, 0.359760, 0.153752},
+    {0.372806, 0.367800, -0.337299},
+    {0.372806, 0.367800, 0.337299},
+    {0.373904, -0.100710, -0.627758},
+    {0.373904, -0.100710, 0.627758},
+    {0.375917, 0.330000, -0.240739},
+    {0.375917, 0.330000, 0.240739},
+    {0.375982, -0.367440, -0.630591},
+    {0.375982, -0.367440, 0.630591},
+    {0.379030, 0.363075, -0.341866},
+    {0.379030, 0.363075, 0.341866},
+    {0.381069, -0.596190, -0.343363},
+    {0.381069, -0.596190, 0.343363},
+    {0.381232, 0.204240, -0.468032},
+    {0.381232, 0.204240, 0.468032},
+    {0.381684, -0.158640, -0.638360},
+    {0.381684, -0.158640, 0.638360},
+    {0.385010, -0.321330, -0.642892},
+    {0.385010, -0.321330, 0.642892},
+    {0.385690, 0.355200, -0.346754},
+    {0.385690, 0.355200, 0.346754},
+    {0.386614, -0.215130, -0.645077},
+    {0.386614, -0.215130, 0.645077},
+    {0.388336, -0.270000, -0.647424},
+    {0.388336, -0.270000, -0.647424},
+    {0.388336, -0.270000, 0.647424},
+    {0.388336, -0.270000, 0.647424},
+    {0.388913, 0.359760, -0.079074},
+    {0.388913, 0.359760, 0.079074},
+    {0.389184, -0.503280, -0.475984},
+    {0.389184, -0.503280, 0.475984},
+    {0.392399, 0.344175, -0.351678},
+    {0.392399, 0.344175, 0.351678},
+    {0.392553, -0.587760, -0.351791},
+    {0.392553, -0.587760, 0.351791},
+    {0.395120, 0.359760, 0.000000},
+    {0.395120, 0.359760, -0.000000},
+    {0.397426, 0.346320, 0.162659},
+    {0.397426, 0.346320, -0.162659},
+    {0.397627, -0.578970, 0.355514},
+    {0.397627, -0.578970, -0.355514},
+    {0.398768, -0.570000, -0.356352},
+    {0.398768, -0.570000, -0.356352},
+    {0.398768, -0.570000, 0.356352},
+    {0.398768, -0.570000, 0.356352},
+    {0.398768, 0.330000, -0.356352},
+    {0.398768, 0.330000, 0.356352},
+    {0.401139, -0.611250, -0.163907},
+    {0.401139, -0.611250, 0.163907},
+    {0.401183, 0.141810, 0.487983},
+    {0.401183, 0.141810, -0.487983},
+    {0.403300, -0.559170, 0.359678},
+    {0.403300, -0.559170, -0.359678},
+    {0.404534, 0.355200, -0.255628},
+    {0.404534, 0.355200, 0.255628},
+    {0.405184, 0.363075, -0.255966},
+    {0.405184, 0.363075, 0.255966},
+    {0.405246, -0.604080, -0.255998},
+    {0.405246, -0.604080, 0.255998},
+    {0.406501, 0.344175, -0.256651},
+    {0.406501, 0.344175, 0.256651},
+    {0.407075, 0.330000, -0.165901},
+    {0.407075, 0.330000, 0.165901},
+    {0.408022, 0.367800, -0.257443},
+    {0.408022, 0.367800, 0.257443},
+    {0.410200, -0.476250, -0.497000},
+    {0.410200, -0.476250, 0.497000},
+    {0.411510, 0.330000, -0.259258},
+    {0.411510, 0.330000, 0.259258},
+    {0.412623, 0.369375, -0.259836},
+    {0.412623, 0.369375, 0.259836},
+    {0.415601, -0.544560, 0.368706},
+    {0.415601, -0.544560, -0.368706},
+    {0.416473, 0.346320, 0.083654},
+    {0.416473, 0.346320, -0.083654},
+    {0.418558, 0.367800, -0.262924},
+    {0.418558, 0.367800, 0.262924},
+    {0.419856, 0.079920, -0.506656},
+    {0.419856, 0.079920, 0.506656},
+    {0.420333, -0.611250, -0.084296},
+    {0.420333, -0.611250, 0.084296},
+    {0.422966, 0.267030, -0.374110},
+    {0.422966, 0.267030, 0.374110},
+    {0.423040, 0.346320, 0.000000},
+    {0.423040, 0.346320, 0.000000},
+    {0.425401, 0.363075, -0.266484},
+    {0.425401, 0.363075, 0.266484},
+    {0.426502, 0.330000, -0.085322},
+    {0.426502, 0.330000, 0.085322},
+    {0.426950, -0.611250, 0.000000},
+    {0.426950, -0.611250, -0.000000},
+    {0.427643, -0.596190, -0.267651},
+    {0.427643, -0.596190, 0.267651},
+    {0.431216, -0.444720, -0.518016},
+    {0.431216, -0.444720, 0.518016},
+    {0.432724, 0.355200, -0.270294},
+    {0.432724, 0.355200, 0.270294},
+    {0.433200, 0.330000, 0.000000},
+    {0.433200, 0.330000, -0.000000},
+    {0.433729, -0.525990, 0.382009},
+    {0.433729, -0.525990, -0.382009},
+    {0.436825, 0.018750, -0.523625},
+    {0.436825, 0.018750, 0.523625},
+    {0.437620, 0.355200, -0.176161},
+    {0.437620, 0.355200, 0.176161},
+    {0.438313, 0.363075, -0.176394},
+    {0.438313, 0.363075, 0.176394},
+    {0.438379, -0.604080, 0.176416},
+    {0.438379, -0.604080, -0.176416},
+    {0.439718, 0.344175, -0.176866},
+    {0.439718, 0.344175, 0.176866},
+    {0.440101, 0.344175, -0.274132},
+    {0.440101, 0.344175, 0.274132},
+    {0.440270, -0.587760, -0.274220},
+    {0.440270, -0.587760, 0.274220},
+    {0.441342, 0.367800, -0.177412},
+    {0.441342, 0.367800, 0.177412},
+    {0.445066, 0.330000, -0.178662},
+    {0.445066, 0.330000, 0.178662},
+    {0.445849, -0.578970, 0.277123},
+    {0.445849, -0.578970, -0.277123},
+    {0.446253, 0.369375, -0.179061},
+    {0.446253, 0.369375, 0.179061},
+    {0.446677, 0.204240, -0.391512},
+    {0.446677, 0.204240, 0.391512},
+    {0.447104, -0.570000, 0.277776},
+    {0.447104, -0.570000, -0.277776},
+    {0.447104, -0.570000, -0.277776},
+    {0.447104, -0.570000, 0.277776},
+    {0.447104, 0.330000, -0.277776},
+    {0.447104, 0.330000, 0.277776},
+    {0.450528, -0.408510, -0.537328},
+    {0.450528, -0.408510, 0.537328},
+    {0.451664, -0.041520, -0.538464},
+    {0.451664, -0.041520, 0.538464},
+    {0.452087, -0.559170, 0.280368},
+    {0.452087, -0.559170, -0.280368},
+    {0.452588, 0.367800, -0.181189},
+    {0.452588, 0.367800, 0.181189},
+    {0.455741, -0.503280, -0.398164},
+    {0.455741, -0.503280, 0.398164},
+    {0.458248, 0.355200, -0.090598},
+    {0.458248, 0.355200, 0.090598},
+    {0.458969, 0.363075, -0.090718},
+    {0.458969, 0.363075, 0.090718},
+    {0.459038, -0.604080, -0.090730},
+    {0.459038, -0.604080, 0.090730},
+    {0.459891, 0.363075, -0.183643},
+    {0.459891, 0.363075, 0.183643},
+    {0.460430, 0.344175, -0.090961},
+    {0.460430, 0.344175, 0.090961},
+    {0.462118, 0.367800, -0.091242},
+    {0.462118, 0.367800, 0.091242},
+    {0.462285, -0.596190, -0.184446},
+    {0.462285, -0.596190, 0.184446},
+    {0.463947, -0.100710, -0.550747},
+    {0.463947, -0.100710, 0.550747},
+    {0.465360, 0.355200, 0.000000},
+    {0.465360, 0.355200, -0.000000},
+    {0.465613, -0.544560, 0.287406},
+    {0.465613, -0.544560, -0.287406},
+    {0.465987, 0.330000, -0.091885},
+    {0.465987, 0.330000, 0.091885},
+    {0.466090, 0.363075, 0.000000},
+    {0.466090, 0.363075, 0.000000},
+    {0.466160, -0.604080, 0.000000},
+    {0.466160, -0.604080, 0.000000},
+    {0.466432, -0.367440, -0.553232},
+    {0.466432, -0.367440, 0.553232},
+    {0.467221, 0.369375, -0.092090},
+    {0.467221, 0.369375, 0.092090},
+    {0.467570, 0.344175, 0.000000},
+    {0.467570, 0.344175, -0.000000},
+    {0.467708, 0.355200, -0.186268},
+    {0.467708, 0.355200, 0.186268},
+    {0.469280, 0.367800, 0.000000},
+    {0.469280, 0.367800, -0.000000},
+    {0.469418, 0.141810, -0.408201},
+    {0.469418, 0.141810, 0.408201},
+    {0.473200, 0.330000, 0.000000},
+    {0.473200, 0.330000, 0.000000},
+    {0.473248, -0.158640, -0.560048},
+    {0.473248, -0.158640, 0.560048},
+    {0.473710, 0.267030, -0.291618},
+    {0.473710, 0.267030, 0.291618},
+    {0.473805, 0.367800, -0.093184},
+    {0.473805, 0.367800, 0.093184},
+    {0.474450, 0.369375, 0.000000},
+    {0.474450, 0.369375, 0.000000},
+    {0.475581, 0.344175, -0.188913},
+    {0.475581, 0.344175, 0.188913},
+    {0.475762, -0.587760, -0.188974},
+    {0.475762, -0.587760, 0.188974},
+    {0.477224, -0.321330, -0.564024},
+    {0.477224, -0.321330, 0.564024},
+    {0.479141, -0.215130, -0.565941},
+    {0.479141, -0.215130, 0.565941},
+    {0.479696, -0.476250, -0.415744},
+    {0.479696, -0.476250, 0.415744},
+    {0.481120, 0.367800, 0.000000},
+    {0.481120, 0.367800, -0.000000},
+    {0.481200, -0.270000, -0.568000},
+    {0.481200, -0.270000, -0.568000},
+    {0.481200, -0.270000, 0.568000},
+    {0.481200, -0.270000, 0.568000},
+    {0.481396, 0.363075, -0.094446},
+    {0.481396, 0.363075, 0.094446},
+    {0.481717, -0.578970, 0.190974},
+    {0.481717, -0.578970, -0.190974},
+    {0.483056, -0.570000, -0.191424},
+    {0.483056, -0.570000, -0.191424},
+    {0.483056, -0.570000, 0.191424},
+    {0.483056, -0.570000, 0.191424},
+    {0.483056, 0.330000, -0.191424},
+    {0.483056, 0.330000, 0.191424},
+    {0.483884, -0.596190, -0.094860},
+    {0.483884, -0.596190, 0.094860},
+    {0.485545, -0.525990, 0.297776},
+    {0.485545, -0.525990, -0.297776},
+    {0.488375, -0.559170, 0.193211},
+    {0.488375, -0.559170, -0.193211},
+    {0.488810, 0.363075, 0.000000},
+    {0.489520, 0.355200, -0.095796},
+    {0.489520, 0.355200, 0.095796},
+    {0.490702, 0.079920, -0.423821},
+    {0.490702, 0.079920, 0.423821},
+    {0.491330, -0.596190, 0.000000},
+    {0.491330, -0.596190, 0.000000},
+    {0.497040, 0.355200, 0.000000},
+    {0.497040, 0.355200, -0.000000},
+    {0.497703, 0.344175, -0.097157},
+    {0.497703, 0.344175, 0.097157},
+    {0.497891, -0.587760, -0.097188},
+    {0.497891, -0.587760, 0.097188},
+    {0.499782, 0.204240, -0.305183},
+    {0.499782, 0.204240, 0.305183},
+    {0.502811, -0.544560, 0.198060},
+    {0.502811, -0.544560, -0.198060},
+    {0.503651, -0.444720, -0.433324},
+    {0.503651, -0.444720, 0.433324},
+    {0.504080, -0.578970, 0.098217},
+    {0.504080, -0.578970, -0.098217},
+    {0.505330, 0.344175, 0.000000},
+    {0.505330, 0.344175, -0.000000},
+    {0.505472, -0.570000, -0.098448},
+    {0.505472, -0.570000, 0.098448},
+    {0.505472, -0.570000, 0.098448},
+    {0.505472, -0.570000, -0.098448},
+    {0.505472, 0.330000, -0.098448},
+    {0.505472, 0.330000, 0.098448},
+    {0.505520, -0.587760, 0.000000},
+    {0.505520, -0.587760, 0.000000},
+    {0.509749, -0.503280, -0.310368},
+    {0.509749, -0.503280, 0.310368},
+    {0.510044, 0.018750, -0.438016},
+    {0.510044, 0.018750, 0.438016},
+    {0.511000, -0.559170, 0.099367},
+    {0.511000, -0.559170, -0.099367},
+    {0.511454, 0.267030, -0.200963},
+    {0.511454, 0.267030, 0.200963},
+    {0.511790, -0.578970, 0.000000},
+    {0.511790, -0.578970, 0.000000},
+    {0.513200, -0.570000, 0.000000},
+    {0.513200, -0.570000, 0.000000},
+    {0.513200, 0.330000, 0.000000},
+    {0.513200, 0.330000, 0.000000},
+    {0.518800, -0.559170, -0.000000},
+    {0.518800, -0.559170, 0.000000},
+    {0.524086, -0.525990, -0.205206},
+    {0.524086, -0.525990, 0.205206},
+    {0.524787, 0.141810, -0.318192},
+    {0.524787, 0.141810, 0.318192},
+    {0.525663, -0.408510, -0.449479},
+    {0.525663, -0.408510, 0.449479},
+    {0.526004, -0.544560, 0.101861},
+    {0.526004, -0.544560, -0.101861},
+    {0.526958, -0.041520, -0.450429},
+    {0.526958, -0.041520, 0.450429},
+    {0.534000, -0.544560, 0.000000},
+    {0.534000, -0.544560, 0.000000},
+    {0.534987, 0.267030, -0.103354},
+    {0.534987, 0.267030, 0.103354},
+    {0.536088, -0.476250, -0.324072},
+    {0.536088, -0.476250, 0.324072},
+    {0.539282, 0.204240, -0.210311},
+    {0.539282, 0.204240, 0.210311},
+    {0.540958, -0.100710, -0.460704},
+    {0.540958, -0.100710, 0.460704},
+    {0.543100, 0.267030, 0.000000},
+    {0.543100, 0.267030, 0.000000},
+    {0.543791, -0.367440, -0.462782},
+    {0.543791, -0.367440, 0.462782},
+    {0.548116, -0.525990, 0.105536},
+    {0.548116, -0.525990, -0.105536},
+    {0.548190, 0.079920, -0.330368},
+    {0.548190, 0.079920, 0.330368},
+    {0.549919, -0.503280, -0.213884},
+    {0.549919, -0.503280, 0.213884},
+    {0.551560, -0.158640, -0.468484},
+    {0.551560, -0.158640, 0.468484},
+    {0.556092, -0.321330, -0.471810},
+    {0.556092, -0.321330, 0.471810},
+    {0.556400, -0.525990, 0.000000},
+    {0.556400, -0.525990, 0.000000},
+    {0.558277, -0.215130, -0.473414},
+    {0.558277, -0.215130, 0.473414},
+    {0.560624, -0.270000, -0.475136},
+    {0.560624, -0.270000, -0.475136},
+    {0.560624, -0.270000, 0.475136},
+    {0.560624, -0.270000, 0.475136},
+    {0.562427, -0.444720, -0.337776},
+    {0.562427, -0.444720, 0.337776},
+    {0.563910, 0.204240, -0.108162},
+    {0.563910, 0.204240, 0.108162},
+    {0.565970, 0.141810, -0.219276},
+    {0.565970, 0.141810, 0.219276},
+    {0.569457, 0.018750, -0.341433},
+    {0.569457, 0.018750, 0.341433},
+    {0.572400, 0.204240, 0.000000},
+    {0.572400, 0.204240, -0.000000},
+    {0.574965, -0.503280, -0.109999},
+    {0.574965, -0.503280, 0.109999},
+    {0.578032, -0.476250, -0.223328},
+    {0.578032, -0.476250, 0.223328},
+    {0.583600, -0.503280, 0.000000},
+    {0.583600, -0.503280, 0.000000},
+    {0.586631, -0.408510, -0.350368},
+    {0.586631, -0.408510, 0.350368},
+    {0.588055, -0.041520, -0.351109},
+    {0.588055, -0.041520, 0.351109},
+    {0.590949, 0.079920, -0.227667},
+    {0.590949, 0.079920, 0.227667},
+    {0.591648, 0.141810, -0.112772},
+    {0.591648, 0.141810, 0.112772},
+    {0.593200, -0.390000, 0.000000},
+    {0.593200, -0.390000, 0.000000},
+    {0.593200, -0.380760, 0.071280},
+    {0.593200, -0.380760, -0.071280},
+    {0.593200, -0.355680, -0.126720},
+    {0.593200, -0.355680, 0.126720},
+    {0.593200, -0.318720, 0.166320},
+    {0.593200, -0.318720, -0.166320},
+    {0.593200, -0.273840, -0.190080},
+    {0.593200, -0.273840, 0.190080},
+    {0.593200, -0.225000, -0.198000},
+    {0.593200, -0.225000, 0.198000},
+    {0.593200, -0.176160, -0.190080},
+    {0.593200, -0.176160, 0.190080},
+    {0.593200, -0.131280, 0.166320},
+    {0.593200, -0.131280, -0.166320},
+    {0.593200, -0.094320, -0.126720},
+    {0.593200, -0.094320, 0.126720},
+    {0.593200, -0.069240, 0.071280},
+    {0.593200, -0.069240, -0.071280},
+    {0.593200, -0.060000, 0.000000},
+    {0.593200, -0.060000, 0.000000},
+    {0.600500, 0.141810, 0.000000},
+    {0.600500, 0.141810, 0.000000},
+    {0.603449, -0.100710, -0.359118},
+    {0.603449, -0.100710, 0.359118},
+    {0.604184, -0.476250, -0.114856},
+    {0.604184, -0.476250, 0.114856},
+    {0.606145, -0.444720, -0.232772},
+    {0.606145, -0.444720, 0.232772},
+    {0.606563, -0.367440, -0.360738},
+    {0.606563, -0.367440, 0.360738},
+    {0.613200, -0.476250, 0.000000},
+    {0.613200, -0.476250, 0.000000},
+    {0.613648, 0.018750, -0.235292},
+    {0.613648, 0.018750, 0.235292},
+    {0.615106, -0.158640, -0.365183},
+    {0.615106, -0.158640, 0.365183},
+    {0.617609, 0.079920, -0.117088},
+    {0.617609, 0.079920, 0.117088},
+    {0.620089, -0.321330, -0.367776},
+    {0.620089, -0.321330, 0.367776},
+    {0.622492, -0.215130, -0.369026},
+    {0.622492, -0.215130, 0.369026},
+    {0.625072, -0.270000, -0.370368},
+    {0.625072, -0.270000, -0.370368},
+    {0.625072, -0.270000, 0.370368},
+    {0.625072, -0.270000, 0.370368},
+    {0.626800, 0.079920, 0.000000},
+    {0.626800, 0.079920, 0.000000},
+    {0.631978, -0.408510, -0.241450},
+    {0.631978, -0.408510, 0.241450},
+    {0.633403, -0.444720, -0.119713},
+    {0.633403, -0.444720, 0.119713},
+    {0.633498, -0.041520, -0.241960},
+    {0.633498, -0.041520, 0.241960},
+    {0.641201, 0.018750, -0.121009},
+    {0.641201, 0.018750, 0.121009},
+    {0.642800, -0.444720, 0.000000},
+    {0.642800, -0.444720, 0.000000},
+    {0.649929, -0.100710, -0.247479},
+    {0.649929, -0.100710, 0.247479},
+    {0.650700, 0.018750, 0.000000},
+    {0.650700, 0.018750, -0.000000},
+    {0.653253, -0.367440, -0.248596},
+    {0.653253, -0.367440, 0.248596},
+    {0.660252, -0.408510, -0.124176},
+    {0.660252, -0.408510, 0.124176},
+    {0.661832, -0.041520, -0.124438},
+    {0.661832, -0.041520, 0.124438},
+    {0.662371, -0.158640, -0.251659},
+    {0.662371, -0.158640, 0.251659},
+    {0.667689, -0.321330, -0.253445},
+    {0.667689, -0.321330, 0.253445},
+    {0.670000, -0.408510, 0.000000},
+    {0.670000, -0.408510, -0.000000},
+    {0.670254, -0.215130, -0.254307},
+    {0.670254, -0.215130, 0.254307},
+    {0.671600, -0.041520, 0.000000},
+    {0.671600, -0.041520, 0.000000},
+    {0.673008, -0.270000, -0.255232},
+    {0.673008, -0.270000, -0.255232},
+    {0.673008, -0.270000, 0.255232},
+    {0.673008, -0.270000, 0.255232},
+    {0.678909, -0.100710, -0.127277},
+    {0.678909, -0.100710, 0.127277},
+    {0.682364, -0.367440, -0.127851},
+    {0.682364, -0.367440, 0.127851},
+    {0.687560, -0.052320, 0.000000},
+    {0.687560, -0.052320, 0.000000},
+    {0.688900, -0.100710, 0.000000},
+    {0.688900, -0.100710, -0.000000},
+    {0.688958, -0.060712, -0.070040},
+    {0.688958, -0.060712, 0.070040},
+    {0.691840, -0.158640, -0.129426},
+    {0.691840, -0.158640, 0.129426},
+    {0.692400, -0.367440, 0.000000},
+    {0.692400, -0.367440, -0.000000},
+    {0.692752, -0.083489, -0.124516},
+    {0.692752, -0.083489, 0.124516},
+    {0.697368, -0.321330, -0.130345},
+    {0.697368, -0.321330, 0.130345},
+    {0.698343, -0.117055, -0.163427},
+    {0.698343, -0.117055, 0.163427},
+    {0.700033, -0.215130, -0.130788},
+    {0.700033, -0.215130, 0.130788},
+    {0.702000, -0.158640, 0.000000},
+    {0.702000, -0.158640, 0.000000},
+    {0.702896, -0.270000, -0.131264},
+    {0.702896, -0.270000, 0.131264},
+    {0.702896, -0.270000, 0.131264},
+    {0.705132, -0.157814, -0.186774},
+    {0.705132, -0.157814, 0.186774},
+    {0.707600, -0.321330, 0.000000},
+    {0.707600, -0.321330, -0.000000},
+    {0.710300, -0.215130, 0.000000},
+    {0.710300, -0.215130, 0.000000},
+    {0.712520, -0.202170, -0.194556},
+    {0.712520, -0.202170, 0.194556},
+    {0.713200, -0.270000, 0.000000},
+    {0.713200, -0.270000, 0.000000},
+    {0.719908, -0.246526, -0.186774},
+    {0.719908, -0.246526, 0.186774},
+    {0.726697, -0.287285, -0.163427},
+    {0.726697, -0.287285, 0.163427},
+    {0.732288, -0.320851, 0.124516},
+    {0.732288, -0.320851, -0.124516},
+    {0.736082, -0.343628, 0.070040},
+    {0.736082, -0.343628, -0.070040},
+    {0.737480, -0.352020, 0.000000},
+    {0.737480, -0.352020, 0.000000},
+    {0.757680, -0.030960, 0.000000},
+    {0.757680, -0.030960, 0.000000},
+    {0.759992, -0.038352, -0.066675},
+    {0.759992, -0.038352, 0.066675},
+    {0.766266, -0.058416, -0.118533},
+    {0.766266, -0.058416, 0.118533},
+    {0.775513, -0.087984, -0.155575},
+    {0.775513, -0.087984, 0.155575},
+    {0.786741, -0.123888, -0.177800},
+    {0.786741, -0.123888, 0.177800},
+    {0.798960, -0.162960, -0.185208},
+    {0.798960, -0.162960, 0.185208},
+    {0.808120, 0.001560, 0.000000},
+    {0.808120, 0.001560, 0.000000},
+    {0.810983, -0.004732, -0.061716},
+    {0.810983, -0.004732, 0.061716},
+    {0.811179, -0.202032, -0.177800},
+    {0.811179, -0.202032, 0.177800},
+    {0.818753, -0.021809, -0.109716},
+    {0.818753, -0.021809, 0.109716},
+    {0.822407, -0.237936, -0.155575},
+    {0.822407, -0.237936, 0.155575},
+    {0.830204, -0.046975, -0.144003},
+    {0.830204, -0.046975, 0.144003},
+    {0.831654, -0.267504, -0.118533},
+    {0.831654, -0.267504, 0.118533},
+    {0.837928, -0.287568, -0.066675},
+    {0.837928, -0.287568, 0.066675},
+    {0.840240, -0.294960, 0.000000},
+    {0.840240, -0.294960, 0.000000},
+    {0.843440, 0.042720, 0.000000},
+    {0.843440, 0.042720, 0.000000},
+    {0.844108, -0.077534, -0.164575},
+    {0.844108, -0.077534, 0.164575},
+    {0.846612, 0.037579, -0.055694},
+    {0.846612, 0.037579, 0.055694},
+    {0.855221, 0.023626, -0.099010},
+    {0.855221, 0.023626, 0.099010},
+    {0.859240, -0.110790, -0.171432},
+    {0.859240, -0.110790, 0.171432},
+    {0.867908, 0.003062, -0.129951},
+    {0.867908, 0.003062, 0.129951},
+    {0.868200, 0.090000, 0.000000},
+    {0.868200, 0.090000, 0.000000},
+    {0.871560, 0.086010, 0.049140},
+    {0.871560, 0.086010, -0.049140},
+    {0.874372, -0.144046, -0.164575},
+    {0.874372, -0.144046, 0.164575},
+    {0.880680, 0.075180, -0.087360},
+    {0.880680, 0.075180, 0.087360},
+    {0.883314, -0.021907, -0.148516},
+    {0.883314, -0.021907, 0.148516},
+    {0.886960, 0.140880, 0.000000},
+    {0.886960, 0.140880, 0.000000},
+    {0.888276, -0.174605, -0.144003},
+    {0.888276, -0.174605, 0.144003},
+    {0.890508, 0.137990, 0.042586},
+    {0.890508, 0.137990, -0.042586},
+    {0.894120, 0.059220, -0.114660},
+    {0.894120, 0.059220, 0.114660},
+    {0.899727, -0.199771, -0.109716},
+    {0.899727, -0.199771, 0.109716},
+    {0.900080, -0.049080, -0.154704},
+    {0.900080, -0.049080, 0.154704},
+    {0.900139, 0.130147, 0.075710},
+    {0.900139, 0.130147, -0.075710},
+    {0.904280, 0.192840, 0.000000},
+    {0.904280, 0.192840, 0.000000},
+    {0.907497, -0.216848, -0.061716},
+    {0.907497, -0.216848, 0.061716},
+    {0.908137, 0.190950, -0.036564},
+    {0.908137, 0.190950, 0.036564},
+    {0.910360, -0.223140, 0.000000},
+    {0.910360, -0.223140, 0.000000},
+    {0.910440, 0.039840, -0.131040},
+    {0.910440, 0.039840, 0.131040},
+    {0.914332, 0.118589, 0.099369},
+    {0.914332, 0.118589, -0.099369},
+    {0.916846, -0.076253, -0.148516},
+    {0.916846, -0.076253, 0.148516},
+    {0.918607, 0.185820, 0.065004},
+    {0.918607, 0.185820, -0.065004},
+    {0.924720, 0.243360, 0.000000},
+    {0.928200, 0.018750, -0.136500},
+    {0.928200, 0.018750, 0.136500},
+    {0.929128, 0.242318, -0.031605},
+    {0.929128, 0.242318, 0.031605},
+    {0.931566, 0.104554, -0.113564},
+    {0.931566, 0.104554, 0.113564},
+    {0.932252, -0.101222, -0.129951},
+    {0.932252, -0.101222, 0.129951},
+    {0.934036, 0.178260, -0.085317},
+    {0.934036, 0.178260, 0.085317},
+    {0.941094, 0.239491, -0.056187},
+    {0.941094, 0.239491, 0.056187},
+    {0.944939, -0.121786, -0.099010},
+    {0.944939, -0.121786, 0.099010},
+    {0.945960, -0.002340, -0.131040},
+    {0.945960, -0.002340, 0.131040},
+    {0.950320, 0.089280, -0.118296},
+    {0.950320, 0.089280, 0.118296},
+    {0.952772, 0.169080, -0.097505},
+    {0.952772, 0.169080, 0.097505},
+    {0.952840, 0.289920, 0.000000},
+    {0.952840, 0.289920, 0.000000},
+    {0.953548, -0.135739, -0.055694},
+    {0.953548, -0.135739, 0.055694},
+    {0.956720, -0.140880, 0.000000},
+    {0.956720, -0.140880, 0.000000},
+    {0.958162, 0.289525, 0.028240},
+    {0.958162, 0.289525, -0.028240},
+    {0.958727, 0.235325, -0.073745},
+    {0.958727, 0.235325, 0.073745},
+    {0.962280, -0.021720, -0.114660},
+    {0.962280, -0.021720, 0.114660},
+    {0.969074, 0.074006, -0.113564},
+    {0.969074, 0.074006, 0.113564},
+    {0.972608, 0.288454, 0.050204},
+    {0.972608, 0.288454, -0.050204},
+    {0.973160, 0.159090, 0.101568},
+    {0.973160, 0.159090, -0.101568},
+    {0.975720, -0.037680, -0.087360},
+    {0.975720, -0.037680, 0.087360},
+    {0.980139, 0.230266, -0.084280},
+    {0.980139, 0.230266, 0.084280},
+    {0.984840, -0.048510, 0.049140},
+    {0.984840, -0.048510, -0.049140},
+    {0.986308, 0.059971, 0.099369},
+    {0.986308, 0.059971, -0.099369},
+    {0.988200, -0.052500, 0.000000},
+    {0.988200, -0.052500, 0.000000},
+    {0.993200, 0.330000, 0.000000},
+    {0.993200, 0.330000, 0.000000},
+    {0.993200, 0.330000, 0.000000},
+    {0.993548, 0.149100, -0.097505},
+    {0.993548, 0.149100, 0.097505},
+    {0.993897, 0.286874, 0.065893},
+    {0.993897, 0.286874, -0.065893},
+    {0.999920, 0.330000, 0.027000},
+    {0.999920, 0.330000, -0.027000},
+    {0.999920, 0.330000, -0.027000},
+    {0.999920, 0.330000, 0.027000},
+    {1.000501, 0.048413, 0.075710},
+    {1.000501, 0.048413, -0.075710},
+    {1.003440, 0.224760, -0.087792},
+    {1.003440, 0.224760, 0.087792},
+    {1.005120, 0.338100, 0.000000},
+    {1.010132, 0.040570, 0.042586},
+    {1.010132, 0.040570, -0.042586},
+    {1.012163, 0.338162, -0.026698},
+    {1.012163, 0.338162, 0.026698},
+    {1.012284, 0.139920, -0.085317},
+    {1.012284, 0.139920, 0.085317},
+    {1.013680, 0.037680, 0.000000},
+    {1.013680, 0.037680, 0.000000},
+    {1.016560, 0.344400, 0.000000},
+    {1.018160, 0.330000, 0.048000},
+    {1.018160, 0.330000, -0.048000},
+    {1.018160, 0.330000, -0.048000},
+    {1.018160, 0.330000, 0.048000},
+    {1.019748, 0.284957, 0.075306},
+    {1.019748, 0.284957, -0.075306},
+    {1.023746, 0.344521, -0.025877},
+    {1.023746, 0.344521, 0.025877},
+    {1.026741, 0.219254, -0.084280},
+    {1.026741, 0.219254, 0.084280},
+    {1.027040, 0.348900, 0.000000},
+    {1.027040, 0.348900, 0.000000},
+    {1.027713, 0.132360, 0.065004},
+    {1.027713, 0.132360, -0.065004},
+    {1.031279, 0.338332, -0.047462},
+    {1.031279, 0.338332, 0.047462},
+    {1.033200, 0.330000, 0.000000},
+    {1.034211, 0.349072, -0.024667},
+    {1.034211, 0.349072, 0.024667},
+    {1.036080, 0.351600, 0.000000},
+    {1.037680, 0.330000, -0.016200},
+    {1.037680, 0.330000, 0.016200},
+    {1.038183, 0.127230, 0.036564},
+    {1.038183, 0.127230, -0.036564},
+    {1.042040, 0.125340, 0.000000},
+    {1.042040, 0.125340, 0.000000},
+    {1.042880, 0.338100, 0.000000},
+    {1.042880, 0.338100, 0.000000},
+    {1.043100, 0.351812, -0.023198},
+    {1.043100, 0.351812, 0.023198},
+    {1.043200, 0.352500, 0.000000},
+    {1.043200, 0.352500, 0.000000},
+    {1.043250, 0.344849, -0.046003},
+    {1.043250, 0.344849, 0.046003},
+    {1.045040, 0.330000, 0.063000},
+    {1.045040, 0.330000, -0.063000},
+    {1.045040, 0.330000, -0.063000},
+    {1.045040, 0.330000, 0.063000},
+    {1.047869, 0.338208, -0.016502},
+    {1.047869, 0.338208, 0.016502},
+    {1.047880, 0.282870, 0.078444},
+    {1.047880, 0.282870, -0.078444},
+    {1.047920, 0.351600, 0.000000},
+    {1.047920, 0.351600, 0.000000},
+    {1.048153, 0.214195, -0.073745},
+    {1.048153, 0.214195, 0.073745},
+    {1.048240, 0.344400, 0.000000},
+    {1.048240, 0.344400, 0.000000},
+    {1.049760, 0.348900, 0.000000},
+    {1.049760, 0.348900, 0.000000},
+    {1.049840, 0.330000, -0.028800},
+    {1.049840, 0.330000, 0.028800},
+    {1.049955, 0.352736, -0.021600},
+    {1.049955, 0.352736, 0.021600},
+    {1.053676, 0.349539, -0.043853},
+    {1.053676, 0.349539, 0.043853},
+    {1.053732, 0.344582, -0.017323},
+    {1.053732, 0.344582, 0.017323},
+    {1.054318, 0.351842, -0.020002},
+    {1.054318, 0.351842, 0.020002},
+    {1.055729, 0.349125, -0.018533},
+    {1.055729, 0.349125, 0.018533},
+    {1.059451, 0.338581, -0.062294},
+    {1.059451, 0.338581, 0.062294},
+    {1.061410, 0.338500, -0.029338},
+    {1.061410, 0.338500, 0.029338},
+    {1.062155, 0.352386, -0.041242},
+    {1.062155, 0.352386, 0.041242},
+    {1.065786, 0.210029, -0.056187},
+    {1.065786, 0.210029, 0.056187},
+    {1.067760, 0.330000, -0.037800},
+    {1.067760, 0.330000, 0.037800},
+    {1.068290, 0.353378, -0.038400},
+    {1.068290, 0.353378, 0.038400},
+    {1.068641, 0.345074, -0.030797},
+    {1.068641, 0.345074, 0.030797},
+    {1.071682, 0.352498, 0.035558},
+    {1.071682, 0.352498, -0.035558},
+    {1.071932, 0.349735, -0.032947},
+    {1.071932, 0.349735, 0.032947},
+    {1.071994, 0.345333, -0.060379},
+    {1.071994, 0.345333, 0.060379},
+    {1.076012, 0.280783, 0.075306},
+    {1.076012, 0.280783, -0.075306},
+    {1.077680, 0.330000, -0.072000},
+    {1.077680, 0.330000, -0.072000},
+    {1.077680, 0.330000, 0.072000},
+    {1.077752, 0.207202, -0.031605},
+    {1.077752, 0.207202, 0.031605},
+    {1.081365, 0.338931, -0.038506},
+    {1.081365, 0.338931, 0.038506},
+    {1.082160, 0.206160, 0.000000},
+    {1.082360, 0.350227, -0.057557},
+    {1.082360, 0.350227, 0.057557},
+    {1.089520, 0.330000, -0.043200},
+    {1.089520, 0.330000, 0.043200},
+    {1.090236, 0.353233, -0.054130},
+    {1.090236, 0.353233, 0.054130},
+    {1.090610, 0.345800, -0.040421},
+    {1.090610, 0.345800, 0.040421},
+    {1.093658, 0.338884, -0.071194},
+    {1.093658, 0.338884, 0.071194},
+    {1.095310, 0.354322, -0.050400},
+    {1.095310, 0.354322, 0.050400},
+    {1.095809, 0.350635, -0.043243},
+    {1.095809, 0.350635, 0.043243},
+    {1.097272, 0.353466, -0.046670},
+    {1.097272, 0.353466, 0.046670},
+    {1.101863, 0.278866, 0.065893},
+    {1.101863, 0.278866, -0.065893},
+    {1.105596, 0.339454, 0.044006},
+    {1.105596, 0.339454, -0.044006},
+    {1.106897, 0.345921, -0.069005},
+    {1.106897, 0.345921, 0.069005},
+    {1.113200, 0.330000, -0.075000},
+    {1.113200, 0.330000, -0.075000},
+    {1.113200, 0.330000, -0.045000},
+    {1.113200, 0.330000, 0.045000},
+    {1.113200, 0.330000, 0.075000},
+    {1.117191, 0.351062, -0.065779},
+    {1.117191, 0.351062, 0.065779},
+    {1.117288, 0.346681, -0.046195},
+    {1.117288, 0.346681, 0.046195},
+    {1.123152, 0.277286, 0.050204},
+    {1.123152, 0.277286, -0.050204},
+    {1.124334, 0.354261, -0.061862},
+    {1.124334, 0.354261, 0.061862},
+    {1.124803, 0.351728, -0.049421},
+    {1.124803, 0.351728, 0.049421},
+    {1.128120, 0.355470, -0.057600},
+    {1.128120, 0.355470, 0.057600},
+    {1.128345, 0.354641, 0.053338},
+    {1.128345, 0.354641, -0.053338},
+    {1.130885, 0.339214, -0.074160},
+    {1.130885, 0.339214, 0.074160},
+    {1.131965, 0.340024, 0.045840},
+    {1.131965, 0.340024, -0.045840},
+    {1.136880, 0.330000, -0.043200},
+    {1.136880, 0.330000, 0.043200},
+    {1.137598, 0.276215, 0.028240},
+    {1.137598, 0.276215, -0.028240},
+    {1.142920, 0.275820, 0.000000},
+    {1.142920, 0.275820, 0.000000},
+    {1.144880, 0.346560, -0.071880},
+    {1.144880, 0.346560, 0.071880},
+    {1.146320, 0.347640, -0.048120},
+    {1.146320, 0.347640, 0.048120},
+    {1.148720, 0.330000, -0.072000},
+    {1.148720, 0.330000, -0.072000},
+    {1.148720, 0.330000, 0.072000},
+    {1.155095, 0.351971, -0.068520},
+    {1.155095, 0.351971, 0.068520},
+    {1.156355, 0.352916, -0.051480},
+    {1.156355, 0.352916, 0.051480},
+    {1.158334, 0.340593, 0.044006},
+    {1.158334, 0.340593, -0.044006},
+    {1.158640, 0.330000, -0.037800},
+    {1.158640, 0.330000, 0.037800},
+    {1.161440, 0.355380, 0.064440},
+    {1.161440, 0.355380, -0.064440},
+    {1.162160, 0.355920, 0.055560},
+    {1.162160, 0.355920, -0.055560},
+    {1.163825, 0.356719, -0.060000},
+    {1.163825, 0.356719, 0.060000},
+    {1.168112, 0.339544, -0.071194},
+    {1.168112, 0.339544, 0.071194},
+    {1.175352, 0.348599, -0.046195},
+    {1.175352, 0.348599, 0.046195},
+    {1.176560, 0.330000, -0.028800},
+    {1.176560, 0.330000, 0.028800},
+    {1.181360, 0.330000, -0.063000},
+    {1.181360, 0.330000, 0.063000},
+    {1.181360, 0.330000, -0.063000},
+    {1.182565, 0.341116, -0.038506},
+    {1.182565, 0.341116, 0.038506},
+    {1.182863, 0.347199, -0.069005},
+    {1.182863, 0.347199, 0.069005},
+    {1.187907, 0.354105, -0.049421},
+    {1.187907, 0.354105, 0.049421},
+    {1.188720, 0.330000, -0.016200},
+    {1.188720, 0.330000, 0.016200},
+    {1.192999, 0.352880, -0.065779},
+    {1.192999, 0.352880, 0.065779},
+    {1.193200, 0.330000, 0.000000},
+    {1.195975, 0.357199, 0.053338},
+    {1.195975, 0.357199, -0.053338},
+    {1.198546, 0.356499, -0.061862},
+    {1.198546, 0.356499, 0.061862},
+    {1.199530, 0.357968, -0.057600},
+    {1.199530, 0.357968, 0.057600},
+    {1.202030, 0.349480, -0.040421},
+    {1.202030, 0.349480, 0.040421},
+    {1.202320, 0.339846, -0.062294},
+    {1.202320, 0.339846, 0.062294},
+    {1.202520, 0.341547, -0.029338},
+    {1.202520, 0.341547, 0.029338},
+    {1.208240, 0.330000, -0.048000},
+    {1.208240, 0.330000, 0.048000},
+    {1.208240, 0.330000, -0.048000},
+    {1.216061, 0.341840, -0.016502},
+    {1.216061, 0.341840, 0.016502},
+    {1.216901, 0.355198, -0.043243},
+    {1.216901, 0.355198, 0.043243},
+    {1.217766, 0.347787, -0.060379},
+    {1.217766, 0.347787, 0.060379},
+    {1.221050, 0.341948, 0.000000},
+    {1.221050, 0.341948, 0.000000},
+    {1.223999, 0.350206, -0.030797},
+    {1.223999, 0.350206, 0.030797},
+    {1.226480, 0.330000, -0.027000},
+    {1.226480, 0.330000, 0.027000},
+    {1.226480, 0.330000, -0.027000},
+    {1.227048, 0.358374, -0.046670},
+    {1.227048, 0.358374, 0.046670},
+    {1.227830, 0.353716, -0.057557},
+    {1.227830, 0.353716, 0.057557},
+    {1.230491, 0.340096, -0.047462},
+    {1.230491, 0.340096, 0.047462},
+    {1.232340, 0.359115, -0.050400},
+    {1.232340, 0.359115, 0.050400},
+    {1.232644, 0.357527, -0.054130},
+    {1.232644, 0.357527, 0.054130},
+    {1.233200, 0.330000, 0.000000},
+    {1.233200, 0.330000, 0.000000},
+    {1.238908, 0.350698, -0.017323},
+    {1.238908, 0.350698, 0.017323},
+    {1.240778, 0.356097, -0.032947},
+    {1.240778, 0.356097, 0.032947},
+    {1.244400, 0.350880, 0.000000},
+    {1.244400, 0.350880, 0.000000},
+    {1.246510, 0.348271, -0.046003},
+    {1.246510, 0.348271, 0.046003},
+    {1.249607, 0.340265, -0.026698},
+    {1.249607, 0.340265, 0.026698},
+    {1.252638, 0.359342, 0.035558},
+    {1.252638, 0.359342, -0.035558},
+    {1.256514, 0.354404, -0.043853},
+    {1.256514, 0.354404, 0.043853},
+    {1.256650, 0.340328, 0.000000},
+    {1.256981, 0.356708, -0.018533},
+    {1.256981, 0.356708, 0.018533},
+    {1.259360, 0.360060, -0.038400},
+    {1.259360, 0.360060, 0.038400},
+    {1.260725, 0.358374, -0.041242},
+    {1.260725, 0.358374, 0.041242},
+    {1.262950, 0.356932, 0.000000},
+    {1.262950, 0.356932, 0.000000},
+    {1.266014, 0.348599, -0.025877},
+    {1.266014, 0.348599, 0.025877},
+    {1.270002, 0.359998, -0.020002},
+    {1.270002, 0.359998, 0.020002},
+    {1.273200, 0.348720, 0.000000},
+    {1.275979, 0.354870, -0.024667},
+    {1.275979, 0.354870, 0.024667},
+    {1.276400, 0.360240, 0.000000},
+    {1.276400, 0.360240, 0.000000},
+    {1.277695, 0.360701, -0.021600},
+    {1.277695, 0.360701, 0.021600},
+    {1.279780, 0.358948, -0.023198},
+    {1.279780, 0.358948, 0.023198},
+    {1.283150, 0.355042, 0.000000},
+    {1.284450, 0.360938, 0.000000},
+    {1.284450, 0.360938, 0.000000},
+    {1.286800, 0.359160, 0.000000},
+};
+#define texcoords_count 0
+static const float texcoords[1][3] = {0};
+#define normals_count 0
+static const float normals[1][3] = {0};
+#define faces_count 6320
+static const int faces[6320][9] = {
+    {2908, 2920, 2938, -1, -1, -1, -1, -1, -1},
+    {2938, 2930, 2908, -1, -1, -1, -1, -1, -1},
+    {2868, 2876, 2920, -1, -1, -1, -1, -1, -1},
+    {2920, 2908, 2868, -1, -1, -1, -1, -1, -1},
+    {2818, 2826, 2876, -1, -1, -1, -1, -1, -1},
+    {2876, 2868, 2818, -1, -1, -1, -1, -1, -1},
+    {2736, 2746, 2826, -1, -1, -1, -1, -1, -1},
+    {2826, 2818, 2736, -1, -1, -1, -1, -1, -1},
+    {2668, 2672, 2746, -1, -1, -1, -1, -1, -1},
+    {2746, 2736, 2668, -1, -1, -1, -1, -1, -1},
+    {2566, 2574, 2672, -1, -1, -1, -1, -1, -1},
+    {2672, 2668, 2566, -1, -1, -1, -1, -1, -1},
+    {2475, 2479, 2574, -1, -1, -1, -1, -1, -1},
+    {2574, 2566, 2475, -1, -1, -1, -1, -1, -1},
+    {2357, 2361, 2479, -1, -1, -1, -1, -1, -1},
+    {2479, 2475, 2357, -1, -1, -1, -1, -1, -1},
+    {2157, 2161, 2361, -1, -1, -1, -1, -1, -1},
+    {2361, 2357, 2157, -1, -1, -1, -1, -1, -1},
+    {1714, 1811, 2161, -1, -1, -1, -1, -1, -1},
+    {2161, 2157, 1714, -1, -1, -1, -1, -1, -1},
+    {2900, 2908, 2930, -1, -1, -1, -1, -1, -1},
+    {2930, 2916, 2900, -1, -1, -1, -1, -1, -1},
+    {2862, 2868, 2908, -1, -1, -1, -1, -1, -1},
+    {2908, 2900, 2862, -1, -1, -1, -1, -1, -1},
+    {2812, 2818, 2868, -1, -1, -1, -1, -1, -1},
+    {2868, 2862, 2812, -1, -1, -1, -1, -1, -1},
+    {2728, 2736, 2818, -1, -1, -1, -1, -1, -1},
+    {2818, 2812, 2728, -1, -1, -1, -1, -1, -1},
+    {2662, 2668, 2736, -1, -1, -1, -1, -1, -1},
+    {2736, 2728, 2662, -1, -1, -1, -1, -1, -1},
+    {2560, 2566, 2668, -1, -1, -1, -1, -1, -1},
+    {2668, 2662, 2560, -1, -1, -1, -1, -1, -1},
+    {2467, 2475, 2566, -1, -1, -1, -1, -1, -1},
+    {2566, 2560, 2467, -1, -1, -1, -1, -1, -1},
+    {2349, 2357, 2475, -1, -1, -1, -1, -1, -1},
+    {2475, 2467, 2349, -1, -1, -1, -1, -1, -1},
+    {2151, 2157, 2357, -1, -1, -1, -1, -1, -1},
+    {2357, 2349, 2151, -1, -1, -1, -1, -1, -1},
+    {1716, 1714, 2157, -1, -1, -1, -1, -1, -1},
+    {2157, 2151, 1716, -1, -1, -1, -1, -1, -1},
+    {2902, 2900, 2916, -1, -1, -1, -1, -1, -1},
+    {2916, 2922, 2902, -1, -1, -1, -1, -1, -1},
+    {2864, 2862, 2900, -1, -1, -1, -1, -1, -1},
+    {2900, 2902, 2864, -1, -1, -1, -1, -1, -1},
+    {2814, 2812, 2862, -1, -1, -1, -1, -1, -1},
+    {2862, 2864, 2814, -1, -1, -1, -1, -1, -1},
+    {2732, 2728, 2812, -1, -1, -1, -1, -1, -1},
+    {2812, 2814, 2732, -1, -1, -1, -1, -1, -1},
+    {2664, 2662, 2728, -1, -1, -1, -1, -1, -1},
+    {2728, 2732, 2664, -1, -1, -1, -1, -1, -1},
+    {2563, 2560, 2662, -1, -1, -1, -1, -1, -1},
+    {2662, 2664, 2563, -1, -1, -1, -1, -1, -1},
+    {2472, 2467, 2560, -1, -1, -1, -1, -1, -1},
+    {2560, 2563, 2472, -1, -1, -1, -1, -1, -1},
+    {2353, 2349, 2467, -1, -1, -1, -1, -1, -1},
+    {2467, 2472, 2353, -1, -1, -1, -1, -1, -1},
+    {2154, 2151, 2349, -1, -1, -1, -1, -1, -1},
+    {2349, 2353, 2154, -1, -1, -1, -1, -1, -1},
+    {1926, 1716, 2151, -1, -1, -1, -1, -1, -1},
+    {2151, 2154, 1926, -1, -1, -1, -1, -1, -1},
+    {2910, 2902, 2922, -1, -1, -1, -1, -1, -1},
+    {2922, 2934, 2910, -1, -1, -1, -1, -1, -1},
+    {2874, 2864, 2902, -1, -1, -1, -1, -1, -1},
+    {2902, 2910, 2874, -1, -1, -1, -1, -1, -1},
+    {2822, 2814, 2864, -1, -1, -1, -1, -1, -1},
+    {2864, 2874, 2822, -1, -1, -1, -1, -1, -1},
+    {2740, 2732, 2814, -1, -1, -1, -1, -1, -1},
+    {2814, 2822, 2740, -1, -1, -1, -1, -1, -1},
+    {2670, 2664, 2732, -1, -1, -1, -1, -1, -1},
+    {2732, 2740, 2670, -1, -1, -1, -1, -1, -1},
+    {2570, 2563, 2664, -1, -1, -1, -1, -1, -1},
+    {2664, 2670, 2570, -1, -1, -1, -1, -1, -1},
+    {2477, 2472, 2563, -1, -1, -1, -1, -1, -1},
+    {2563, 2570, 2477, -1, -1, -1, -1, -1, -1},
+    {2359, 2353, 2472, -1, -1, -1, -1, -1, -1},
+    {2472, 2477, 2359, -1, -1, -1, -1, -1, -1},
+    {2159, 2154, 2353, -1, -1, -1, -1, -1, -1},
+    {2353, 2359, 2159, -1, -1, -1, -1, -1, -1},
+    {1717, 1926, 2154, -1, -1, -1, -1, -1, -1},
+    {2154, 2159, 1717, -1, -1, -1, -1, -1, -1},
+    {2928, 2910, 2934, -1, -1, -1, -1, -1, -1},
+    {2934, 2946, 2928, -1, -1, -1, -1, -1, -1},
+    {2880, 2874, 2910, -1, -1, -1, -1, -1, -1},
+    {2910, 2928, 2880, -1, -1, -1, -1, -1, -1},
+    {2828, 2822, 2874, -1, -1, -1, -1, -1, -1},
+    {2874, 2880, 2828, -1, -1, -1, -1, -1, -1},
+    {2750, 2740, 2822, -1, -1, -1, -1, -1, -1},
+    {2822, 2828, 2750, -1, -1, -1, -1, -1, -1},
+    {2676, 2670, 2740, -1, -1, -1, -1, -1, -1},
+    {2740, 2750, 2676, -1, -1, -1, -1, -1, -1},
+    {2576, 2570, 2670, -1, -1, -1, -1, -1, -1},
+    {2670, 2676, 2576, -1, -1, -1, -1, -1, -1},
+    {2481, 2477, 2570, -1, -1, -1, -1, -1, -1},
+    {2570, 2576, 2481, -1, -1, -1, -1, -1, -1},
+    {2363, 2359, 2477, -1, -1, -1, -1, -1, -1},
+    {2477, 2481, 2363, -1, -1, -1, -1, -1, -1},
+    {2163, 2159, 2359, -1, -1, -1, -1, -1, -1},
+    {2359, 2363, 2163, -1, -1, -1, -1, -1, -1},
+    {1841, 1717, 2159, -1, -1, -1, -1, -1, -1},
+    {2159, 2163, 1841, -1, -1, -1, -1, -1, -1},
+    {2944, 2928, 2946, -1, -1, -1, -1, -1, -1},
+    {2946, 2958, 2944, -1, -1, -1, -1, -1, -1},
+    {2896, 2880, 2928, -1, -1, -1, -1, -1, -1},
+    {2928, 2944, 2896, -1, -1, -1, -1, -1, -1},
+    {2834, 2828, 2880, -1, -1, -1, -1, -1, -1},
+    {2880, 2896, 2834, -1, -1, -1, -1, -1, -1},
+    {2760, 2750, 2828, -1, -1, -1, -1, -1, -1},
+    {2828, 2834, 2760, -1, -1, -1, -1, -1, -1},
+    {2678, 2676, 2750, -1, -1, -1, -1, -1, -1},
+    {2750, 2760, 2678, -1, -1, -1, -1, -1, -1},
+    {2578, 2576, 2676, -1, -1, -1, -1, -1, -1},
+    {2676, 2678, 2578, -1, -1, -1, -1, -1, -1},
+    {2485, 2481, 2576, -1, -1, -1, -1, -1, -1},
+    {2576, 2578, 2485, -1, -1, -1, -1, -1, -1},
+    {2367, 2363, 2481, -1, -1, -1, -1, -1, -1},
+    {2481, 2485, 2367, -1, -1, -1, -1, -1, -1},
+    {2171, 2163, 2363, -1, -1, -1, -1, -1, -1},
+    {2363, 2367, 2171, -1, -1, -1, -1, -1, -1},
+    {1724, 1841, 2163, -1, -1, -1, -1, -1, -1},
+    {2163, 2171, 1724, -1, -1, -1, -1, -1, -1},
+    {2964, 2944, 2958, -1, -1, -1, -1, -1, -1},
+    {2958, 2980, 2964, -1, -1, -1, -1, -1, -1},
+    {2906, 2896, 2944, -1, -1, -1, -1, -1, -1},
+    {2944, 2964, 2906, -1, -1, -1, -1, -1, -1},
+    {2844, 2834, 2896, -1, -1, -1, -1, -1, -1},
+    {2896, 2906, 2844, -1, -1, -1, -1, -1, -1},
+    {2768, 2760, 2834, -1, -1, -1, -1, -1, -1},
+    {2834, 2844, 2768, -1, -1, -1, -1, -1, -1},
+    {2684, 2678, 2760, -1, -1, -1, -1, -1, -1},
+    {2760, 2768, 2684, -1, -1, -1, -1, -1, -1},
+    {2586, 2578, 2678, -1, -1, -1, -1, -1, -1},
+    {2678, 2684, 2586, -1, -1, -1, -1, -1, -1},
+    {2490, 2485, 2578, -1, -1, -1, -1, -1, -1},
+    {2578, 2586, 2490, -1, -1, -1, -1, -1, -1},
+    {2369, 2367, 2485, -1, -1, -1, -1, -1, -1},
+    {2485, 2490, 2369, -1, -1, -1, -1, -1, -1},
+    {2173, 2171, 2367, -1, -1, -1, -1, -1, -1},
+    {2367, 2369, 2173, -1, -1, -1, -1, -1, -1},
+    {1833, 1724, 2171, -1, -1, -1, -1, -1, -1},
+    {2171, 2173, 1833, -1, -1, -1, -1, -1, -1},
+    {2981, 2964, 2980, -1, -1, -1, -1, -1, -1},
+    {2980, 2987, 2981, -1, -1, -1, -1, -1, -1},
+    {2932, 2906, 2964, -1, -1, -1, -1, -1, -1},
+    {2964, 2981, 2932, -1, -1, -1, -1, -1, -1},
+    {2854, 2844, 2906, -1, -1, -1, -1, -1, -1},
+    {2906, 2932, 2854, -1, -1, -1, -1, -1, -1},
+    {2778, 2768, 2844, -1, -1, -1, -1, -1, -1},
+    {2844, 2854, 2778, -1, -1, -1, -1, -1, -1},
+    {2690, 2684, 2768, -1, -1, -1, -1, -1, -1},
+    {2768, 2778, 2690, -1, -1, -1, -1, -1, -1},
+    {2594, 2586, 2684, -1, -1, -1, -1, -1, -1},
+    {2684, 2690, 2594, -1, -1, -1, -1, -1, -1},
+    {2499, 2490, 2586, -1, -1, -1, -1, -1, -1},
+    {2586, 2594, 2499, -1, -1, -1, -1, -1, -1},
+    {2373, 2369, 2490, -1, -1, -1, -1, -1, -1},
+    {2490, 2499, 2373, -1, -1, -1, -1, -1, -1},
+    {2177, 2173, 2369, -1, -1, -1, -1, -1, -1},
+    {2369, 2373, 2177, -1, -1, -1, -1, -1, -1},
+    {1715, 1833, 2173, -1, -1, -1, -1, -1, -1},
+    {2173, 2177, 1715, -1, -1, -1, -1, -1, -1},
+    {2989, 2981, 2987, -1, -1, -1, -1, -1, -1},
+    {2987, 3001, 2989, -1, -1, -1, -1, -1, -1},
+    {2948, 2932, 2981, -1, -1, -1, -1, -1, -1},
+    {2981, 2989, 2948, -1, -1, -1, -1, -1, -1},
+    {2870, 2854, 2932, -1, -1, -1, -1, -1, -1},
+    {2932, 2948, 2870, -1, -1, -1, -1, -1, -1},
+    {2790, 2778, 2854, -1, -1, -1, -1, -1, -1},
+    {2854, 2870, 2790, -1, -1, -1, -1, -1, -1},
+    {2698, 2690, 2778, -1, -1, -1, -1, -1, -1},
+    {2778, 2790, 2698, -1, -1, -1, -1, -1, -1},
+    {2600, 2594, 2690, -1, -1, -1, -1, -1, -1},
+    {2690, 2698, 2600, -1, -1, -1, -1, -1, -1},
+    {2505, 2499, 2594, -1, -1, -1, -1, -1, -1},
+    {2594, 2600, 2505, -1, -1, -1, -1, -1, -1},
+    {2377, 2373, 2499, -1, -1, -1, -1, -1, -1},
+    {2499, 2505, 2377, -1, -1, -1, -1, -1, -1},
+    {2179, 2177, 2373, -1, -1, -1, -1, -1, -1},
+    {2373, 2377, 2179, -1, -1, -1, -1, -1, -1},
+    {1713, 1715, 2177, -1, -1, -1, -1, -1, -1},
+    {2177, 2179, 1713, -1, -1, -1, -1, -1, -1},
+    {3007, 2989, 3001, -1, -1, -1, -1, -1, -1},
+    {3001, 3023, 3007, -1, -1, -1, -1, -1, -1},
+    {2972, 2948, 2989, -1, -1, -1, -1, -1, -1},
+    {2989, 3007, 2972, -1, -1, -1, -1, -1, -1},
+    {2888, 2870, 2948, -1, -1, -1, -1, -1, -1},
+    {2948, 2972, 2888, -1, -1, -1, -1, -1, -1},
+    {2804, 2790, 2870, -1, -1, -1, -1, -1, -1},
+    {2870, 2888, 2804, -1, -1, -1, -1, -1, -1},
+    {2710, 2698, 2790, -1, -1, -1, -1, -1, -1},
+    {2790, 2804, 2710, -1, -1, -1, -1, -1, -1},
+    {2610, 2600, 2698, -1, -1, -1, -1, -1, -1},
+    {2698, 2710, 2610, -1, -1, -1, -1, -1, -1},
+    {2520, 2505, 2600, -1, -1, -1, -1, -1, -1},
+    {2600, 2610, 2520, -1, -1, -1, -1, -1, -1},
+    {2386, 2377, 2505, -1, -1, -1, -1, -1, -1},
+    {2505, 2520, 2386, -1, -1, -1, -1, -1, -1},
+    {2190, 2179, 2377, -1, -1, -1, -1, -1, -1},
+    {2377, 2386, 2190, -1, -1, -1, -1, -1, -1},
+    {1809, 1713, 2179, -1, -1, -1, -1, -1, -1},
+    {2179, 2190, 1809, -1, -1, -1, -1, -1, -1},
+    {1463, 1459, 1812, -1, -1, -1, -1, -1, -1},
+    {1812, 1820, 1463, -1, -1, -1, -1, -1, -1},
+    {1263, 1259, 1459, -1, -1, -1, -1, -1, -1},
+    {1459, 1463, 1263, -1, -1, -1, -1, -1, -1},
+    {1145, 1141, 1259, -1, -1, -1, -1, -1, -1},
+    {1259, 1263, 1145, -1, -1, -1, -1, -1, -1},
+    {1054, 1046, 1141, -1, -1, -1, -1, -1, -1},
+    {1141, 1145, 1054, -1, -1, -1, -1, -1, -1},
+    {952, 948, 1046, -1, -1, -1, -1, -1, -1},
+    {1046, 1054, 952, -1, -1, -1, -1, -1, -1},
+    {884, 874, 948, -1, -1, -1, -1, -1, -1},
+    {948, 952, 884, -1, -1, -1, -1, -1, -1},
+    {802, 794, 874, -1, -1, -1, -1, -1, -1},
+    {874, 884, 802, -1, -1, -1, -1, -1, -1},
+    {752, 744, 794, -1, -1, -1, -1, -1, -1},
+    {794, 802, 752, -1, -1, -1, -1, -1, -1},
+    {712, 700, 744, -1, -1, -1, -1, -1, -1},
+    {744, 752, 712, -1, -1, -1, -1, -1, -1},
+    {690, 682, 700, -1, -1, -1, -1, -1, -1},
+    {700, 712, 690, -1, -1, -1, -1, -1, -1},
+    {1469, 1463, 1820, -1, -1, -1, -1, -1, -1},
+    {1820, 1828, 1469, -1, -1, -1, -1, -1, -1},
+    {1271, 1263, 1463, -1, -1, -1, -1, -1, -1},
+    {1463, 1469, 1271, -1, -1, -1, -1, -1, -1},
+    {1153, 1145, 1263, -1, -1, -1, -1, -1, -1},
+    {1263, 1271, 1153, -1, -1, -1, -1, -1, -1},
+    {1060, 1054, 1145, -1, -1, -1, -1, -1, -1},
+    {1145, 1153, 1060, -1, -1, -1, -1, -1, -1},
+    {958, 952, 1054, -1, -1, -1, -1, -1, -1},
+    {1054, 1060, 958, -1, -1, -1, -1, -1, -1},
+    {892, 884, 952, -1, -1, -1, -1, -1, -1},
+    {952, 958, 892, -1, -1, -1, -1, -1, -1},
+    {808, 802, 884, -1, -1, -1, -1, -1, -1},
+    {884, 892, 808, -1, -1, -1, -1, -1, -1},
+    {758, 752, 802, -1, -1, -1, -1, -1, -1},
+    {802, 808, 758, -1, -1, -1, -1, -1, -1},
+    {720, 712, 752, -1, -1, -1, -1, -1, -1},
+    {752, 758, 720, -1, -1, -1, -1, -1, -1},
+    {704, 690, 712, -1, -1, -1, -1, -1, -1},
+    {712, 720, 704, -1, -1, -1, -1, -1, -1},
+    {1468, 1469, 1828, -1, -1, -1, -1, -1, -1},
+    {1828, 1834, 1468, -1, -1, -1, -1, -1, -1},
+    {1267, 1271, 1469, -1, -1, -1, -1, -1, -1},
+    {1469, 1468, 1267, -1, -1, -1, -1, -1, -1},
+    {1150, 1153, 1271, -1, -1, -1, -1, -1, -1},
+    {1271, 1267, 1150, -1, -1, -1, -1, -1, -1},
+    {1059, 1060, 1153, -1, -1, -1, -1, -1, -1},
+    {1153, 1150, 1059, -1, -1, -1, -1, -1, -1},
+    {956, 958, 1060, -1, -1, -1, -1, -1, -1},
+    {1060, 1059, 956, -1, -1, -1, -1, -1, -1},
+    {888, 892, 958, -1, -1, -1, -1, -1, -1},
+    {958, 956, 888, -1, -1, -1, -1, -1, -1},
+    {806, 808, 892, -1, -1, -1, -1, -1, -1},
+    {892, 888, 806, -1, -1, -1, -1, -1, -1},
+    {756, 758, 808, -1, -1, -1, -1, -1, -1},
+    {808, 806, 756, -1, -1, -1, -1, -1, -1},
+    {718, 720, 758, -1, -1, -1, -1, -1, -1},
+    {758, 756, 718, -1, -1, -1, -1, -1, -1},
+    {698, 704, 720, -1, -1, -1, -1, -1, -1},
+    {720, 718, 698, -1, -1, -1, -1, -1, -1},
+    {1461, 1468, 1834, -1, -1, -1, -1, -1, -1},
+    {1834, 1838, 1461, -1, -1, -1, -1, -1, -1},
+    {1261, 1267, 1468, -1, -1, -1, -1, -1, -1},
+    {1468, 1461, 1261, -1, -1, -1, -1, -1, -1},
+    {1143, 1150, 1267, -1, -1, -1, -1, -1, -1},
+    {1267, 1261, 1143, -1, -1, -1, -1, -1, -1},
+    {1050, 1059, 1150, -1, -1, -1, -1, -1, -1},
+    {1150, 1143, 1050, -1, -1, -1, -1, -1, -1},
+    {950, 956, 1059, -1, -1, -1, -1, -1, -1},
+    {1059, 1050, 950, -1, -1, -1, -1, -1, -1},
+    {880, 888, 956, -1, -1, -1, -1, -1, -1},
+    {956, 950, 880, -1, -1, -1, -1, -1, -1},
+    {798, 806, 888, -1, -1, -1, -1, -1, -1},
+    {888, 880, 798, -1, -1, -1, -1, -1, -1},
+    {746, 756, 806, -1, -1, -1, -1, -1, -1},
+    {806, 798, 746, -1, -1, -1, -1, -1, -1},
+    {710, 718, 756, -1, -1, -1, -1, -1, -1},
+    {756, 746, 710, -1, -1, -1, -1, -1, -1},
+    {686, 698, 718, -1, -1, -1, -1, -1, -1},
+    {718, 710, 686, -1, -1, -1, -1, -1, -1},
+    {1457, 1461, 1838, -1, -1, -1, -1, -1, -1},
+    {1838, 1842, 1457, -1, -1, -1, -1, -1, -1},
+    {1257, 1261, 1461, -1, -1, -1, -1, -1, -1},
+    {1461, 1457, 1257, -1, -1, -1, -1, -1, -1},
+    {1139, 1143, 1261, -1, -1, -1, -1, -1, -1},
+    {1261, 1257, 1139, -1, -1, -1, -1, -1, -1},
+    {1044, 1050, 1143, -1, -1, -1, -1, -1, -1},
+    {1143, 1139, 1044, -1, -1, -1, -1, -1, -1},
+    {944, 950, 1050, -1, -1, -1, -1, -1, -1},
+    {1050, 1044, 944, -1, -1, -1, -1, -1, -1},
+    {870, 880, 950, -1, -1, -1, -1, -1, -1},
+    {950, 944, 870, -1, -1, -1, -1, -1, -1},
+    {792, 798, 880, -1, -1, -1, -1, -1, -1},
+    {880, 870, 792, -1, -1, -1, -1, -1, -1},
+    {740, 746, 798, -1, -1, -1, -1, -1, -1},
+    {798, 792, 740, -1, -1, -1, -1, -1, -1},
+    {692, 710, 746, -1, -1, -1, -1, -1, -1},
+    {746, 740, 692, -1, -1, -1, -1, -1, -1},
+    {674, 686, 710, -1, -1, -1, -1, -1, -1},
+    {710, 692, 674, -1, -1, -1, -1, -1, -1},
+    {1449, 1457, 1842, -1, -1, -1, -1, -1, -1},
+    {1842, 1837, 1449, -1, -1, -1, -1, -1, -1},
+    {1253, 1257, 1457, -1, -1, -1, -1, -1, -1},
+    {1457, 1449, 1253, -1, -1, -1, -1, -1, -1},
+    {1135, 1139, 1257, -1, -1, -1, -1, -1, -1},
+    {1257, 1253, 1135, -1, -1, -1, -1, -1, -1},
+    {1042, 1044, 1139, -1, -1, -1, -1, -1, -1},
+    {1139, 1135, 1042, -1, -1, -1, -1, -1, -1},
+    {942, 944, 1044, -1, -1, -1, -1, -1, -1},
+    {1044, 1042, 942, -1, -1, -1, -1, -1, -1},
+    {860, 870, 944, -1, -1, -1, -1, -1, -1},
+    {944, 942, 860, -1, -1, -1, -1, -1, -1},
+    {786, 792, 870, -1, -1, -1, -1, -1, -1},
+    {870, 860, 786, -1, -1, -1, -1, -1, -1},
+    {724, 740, 792, -1, -1, -1, -1, -1, -1},
+    {792, 786, 724, -1, -1, -1, -1, -1, -1},
+    {676, 692, 740, -1, -1, -1, -1, -1, -1},
+    {740, 724, 676, -1, -1, -1, -1, -1, -1},
+    {662, 674, 692, -1, -1, -1, -1, -1, -1},
+    {692, 676, 662, -1, -1, -1, -1, -1, -1},
+    {1447, 1449, 1837, -1, -1, -1, -1, -1, -1},
+    {1837, 1833, 1447, -1, -1, -1, -1, -1, -1},
+    {1251, 1253, 1449, -1, -1, -1, -1, -1, -1},
+    {1449, 1447, 1251, -1, -1, -1, -1, -1, -1},
+    {1132, 1135, 1253, -1, -1, -1, -1, -1, -1},
+    {1253, 1251, 1132, -1, -1, -1, -1, -1, -1},
+    {1034, 1042, 1135, -1, -1, -1, -1, -1, -1},
+    {1135, 1132, 1034, -1, -1, -1, -1, -1, -1},
+    {936, 942, 1042, -1, -1, -1, -1, -1, -1},
+    {1042, 1034, 936, -1, -1, -1, -1, -1, -1},
+    {852, 860, 942, -1, -1, -1, -1, -1, -1},
+    {942, 936, 852, -1, -1, -1, -1, -1, -1},
+    {776, 786, 860, -1, -1, -1, -1, -1, -1},
+    {860, 852, 776, -1, -1, -1, -1, -1, -1},
+    {714, 724, 786, -1, -1, -1, -1, -1, -1},
+    {786, 776, 714, -1, -1, -1, -1, -1, -1},
+    {656, 676, 724, -1, -1, -1, -1, -1, -1},
+    {724, 714, 656, -1, -1, -1, -1, -1, -1},
+    {641, 662, 676, -1, -1, -1, -1, -1, -1},
+    {676, 656, 641, -1, -1, -1, -1, -1, -1},
+    {1443, 1447, 1833, -1, -1, -1, -1, -1, -1},
+    {1833, 1827, 1443, -1, -1, -1, -1, -1, -1},
+    {1247, 1251, 1447, -1, -1, -1, -1, -1, -1},
+    {1447, 1443, 1247, -1, -1, -1, -1, -1, -1},
+    {1121, 1132, 1251, -1, -1, -1, -1, -1, -1},
+    {1251, 1247, 1121, -1, -1, -1, -1, -1, -1},
+    {1026, 1034, 1132, -1, -1, -1, -1, -1, -1},
+    {1132, 1121, 1026, -1, -1, -1, -1, -1, -1},
+    {930, 936, 1034, -1, -1, -1, -1, -1, -1},
+    {1034, 1026, 930, -1, -1, -1, -1, -1, -1},
+    {842, 852, 936, -1, -1, -1, -1, -1, -1},
+    {936, 930, 842, -1, -1, -1, -1, -1, -1},
+    {766, 776, 852, -1, -1, -1, -1, -1, -1},
+    {852, 842, 766, -1, -1, -1, -1, -1, -1},
+    {688, 714, 776, -1, -1, -1, -1, -1, -1},
+    {776, 766, 688, -1, -1, -1, -1, -1, -1},
+    {639, 656, 714, -1, -1, -1, -1, -1, -1},
+    {714, 688, 639, -1, -1, -1, -1, -1, -1},
+    {633, 641, 656, -1, -1, -1, -1, -1, -1},
+    {656, 639, 633, -1, -1, -1, -1, -1, -1},
+    {1441, 1443, 1827, -1, -1, -1, -1, -1, -1},
+    {1827, 1819, 1441, -1, -1, -1, -1, -1, -1},
+    {1243, 1247, 1443, -1, -1, -1, -1, -1, -1},
+    {1443, 1441, 1243, -1, -1, -1, -1, -1, -1},
+    {1115, 1121, 1247, -1, -1, -1, -1, -1, -1},
+    {1247, 1243, 1115, -1, -1, -1, -1, -1, -1},
+    {1020, 1026, 1121, -1, -1, -1, -1, -1, -1},
+    {1121, 1115, 1020, -1, -1, -1, -1, -1, -1},
+    {922, 930, 1026, -1, -1, -1, -1, -1, -1},
+    {1026, 1020, 922, -1, -1, -1, -1, -1, -1},
+    {830, 842, 930, -1, -1, -1, -1, -1, -1},
+    {930, 922, 830, -1, -1, -1, -1, -1, -1},
+    {750, 766, 842, -1, -1, -1, -1, -1, -1},
+    {842, 830, 750, -1, -1, -1, -1, -1, -1},
+    {672, 688, 766, -1, -1, -1, -1, -1, -1},
+    {766, 750, 672, -1, -1, -1, -1, -1, -1},
+    {631, 639, 688, -1, -1, -1, -1, -1, -1},
+    {688, 672, 631, -1, -1, -1, -1, -1, -1},
+    {619, 633, 639, -1, -1, -1, -1, -1, -1},
+    {639, 631, 619, -1, -1, -1, -1, -1, -1},
+    {1428, 1441, 1819, -1, -1, -1, -1, -1, -1},
+    {1819, 1810, 1428, -1, -1, -1, -1, -1, -1},
+    {1232, 1243, 1441, -1, -1, -1, -1, -1, -1},
+    {1441, 1428, 1232, -1, -1, -1, -1, -1, -1},
+    {1105, 1115, 1243, -1, -1, -1, -1, -1, -1},
+    {1243, 1232, 1105, -1, -1, -1, -1, -1, -1},
+    {1010, 1020, 1115, -1, -1, -1, -1, -1, -1},
+    {1115, 1105, 1010, -1, -1, -1, -1, -1, -1},
+    {910, 922, 1020, -1, -1, -1, -1, -1, -1},
+    {1020, 1010, 910, -1, -1, -1, -1, -1, -1},
+    {816, 830, 922, -1, -1, -1, -1, -1, -1},
+    {922, 910, 816, -1, -1, -1, -1, -1, -1},
+    {732, 750, 830, -1, -1, -1, -1, -1, -1},
+    {830, 816, 732, -1, -1, -1, -1, -1, -1},
+    {648, 672, 750, -1, -1, -1, -1, -1, -1},
+    {750, 732, 648, -1, -1, -1, -1, -1, -1},
+    {613, 631, 672, -1, -1, -1, -1, -1, -1},
+    {672, 648, 613, -1, -1, -1, -1, -1, -1},
+    {596, 619, 631, -1, -1, -1, -1, -1, -1},
+    {631, 613, 596, -1, -1, -1, -1, -1, -1},
+    {713, 701, 683, -1, -1, -1, -1, -1, -1},
+    {683, 691, 713, -1, -1, -1, -1, -1, -1},
+    {753, 745, 701, -1, -1, -1, -1, -1, -1},
+    {701, 713, 753, -1, -1, -1, -1, -1, -1},
+    {803, 795, 745, -1, -1, -1, -1, -1, -1},
+    {745, 753, 803, -1, -1, -1, -1, -1, -1},
+    {885, 875, 795, -1, -1, -1, -1, -1, -1},
+    {795, 803, 885, -1, -1, -1, -1, -1, -1},
+    {953, 949, 875, -1, -1, -1, -1, -1, -1},
+    {875, 885, 953, -1, -1, -1, -1, -1, -1},
+    {1055, 1047, 949, -1, -1, -1, -1, -1, -1},
+    {949, 953, 1055, -1, -1, -1, -1, -1, -1},
+    {1146, 1142, 1047, -1, -1, -1, -1, -1, -1},
+    {1047, 1055, 1146, -1, -1, -1, -1, -1, -1},
+    {1264, 1260, 1142, -1, -1, -1, -1, -1, -1},
+    {1142, 1146, 1264, -1, -1, -1, -1, -1, -1},
+    {1464, 1460, 1260, -1, -1, -1, -1, -1, -1},
+    {1260, 1264, 1464, -1, -1, -1, -1, -1, -1},
+    {1914, 1816, 1460, -1, -1, -1, -1, -1, -1},
+    {1460, 1464, 1914, -1, -1, -1, -1, -1, -1},
+    {721, 713, 691, -1, -1, -1, -1, -1, -1},
+    {691, 705, 721, -1, -1, -1, -1, -1, -1},
+    {759, 753, 713, -1, -1, -1, -1, -1, -1},
+    {713, 721, 759, -1, -1, -1, -1, -1, -1},
+    {809, 803, 753, -1, -1, -1, -1, -1, -1},
+    {753, 759, 809, -1, -1, -1, -1, -1, -1},
+    {893, 885, 803, -1, -1, -1, -1, -1, -1},
+    {803, 809, 893, -1, -1, -1, -1, -1, -1},
+    {959, 953, 885, -1, -1, -1, -1, -1, -1},
+    {885, 893, 959, -1, -1, -1, -1, -1, -1},
+    {1061, 1055, 953, -1, -1, -1, -1, -1, -1},
+    {953, 959, 1061, -1, -1, -1, -1, -1, -1},
+    {1154, 1146, 1055, -1, -1, -1, -1, -1, -1},
+    {1055, 1061, 1154, -1, -1, -1, -1, -1, -1},
+    {1272, 1264, 1146, -1, -1, -1, -1, -1, -1},
+    {1146, 1154, 1272, -1, -1, -1, -1, -1, -1},
+    {1470, 1464, 1264, -1, -1, -1, -1, -1, -1},
+    {1264, 1272, 1470, -1, -1, -1, -1, -1, -1},
+    {1916, 1914, 1464, -1, -1, -1, -1, -1, -1},
+    {1464, 1470, 1916, -1, -1, -1, -1, -1, -1},
+    {719, 721, 705, -1, -1, -1, -1, -1, -1},
+    {705, 699, 719, -1, -1, -1, -1, -1, -1},
+    {757, 759, 721, -1, -1, -1, -1, -1, -1},
+    {721, 719, 757, -1, -1, -1, -1, -1, -1},
+    {807, 809, 759, -1, -1, -1, -1, -1, -1},
+    {759, 757, 807, -1, -1, -1, -1, -1, -1},
+    {889, 893, 809, -1, -1, -1, -1, -1, -1},
+    {809, 807, 889, -1, -1, -1, -1, -1, -1},
+    {957, 959, 893, -1, -1, -1, -1, -1, -1},
+    {893, 889, 957, -1, -1, -1, -1, -1, -1},
+    {1058, 1061, 959, -1, -1, -1, -1, -1, -1},
+    {959, 957, 1058, -1, -1, -1, -1, -1, -1},
+    {1149, 1154, 1061, -1, -1, -1, -1, -1, -1},
+    {1061, 1058, 1149, -1, -1, -1, -1, -1, -1},
+    {1268, 1272, 1154, -1, -1, -1, -1, -1, -1},
+    {1154, 1149, 1268, -1, -1, -1, -1, -1, -1},
+    {1467, 1470, 1272, -1, -1, -1, -1, -1, -1},
+    {1272, 1268, 1467, -1, -1, -1, -1, -1, -1},
+    {1696, 1916, 1470, -1, -1, -1, -1, -1, -1},
+    {1470, 1467, 1696, -1, -1, -1, -1, -1, -1},
+    {711, 719, 699, -1, -1, -1, -1, -1, -1},
+    {699, 687, 711, -1, -1, -1, -1, -1, -1},
+    {747, 757, 719, -1, -1, -1, -1, -1, -1},
+    {719, 711, 747, -1, -1, -1, -1, -1, -1},
+    {799, 807, 757, -1, -1, -1, -1, -1, -1},
+    {757, 747, 799, -1, -1, -1, -1, -1, -1},
+    {881, 889, 807, -1, -1, -1, -1, -1, -1},
+    {807, 799, 881, -1, -1, -1, -1, -1, -1},
+    {951, 957, 889, -1, -1, -1, -1, -1, -1},
+    {889, 881, 951, -1, -1, -1, -1, -1, -1},
+    {1051, 1058, 957, -1, -1, -1, -1, -1, -1},
+    {957, 951, 1051, -1, -1, -1, -1, -1, -1},
+    {1144, 1149, 1058, -1, -1, -1, -1, -1, -1},
+    {1058, 1051, 1144, -1, -1, -1, -1, -1, -1},
+    {1262, 1268, 1149, -1, -1, -1, -1, -1, -1},
+    {1149, 1144, 1262, -1, -1, -1, -1, -1, -1},
+    {1462, 1467, 1268, -1, -1, -1, -1, -1, -1},
+    {1268, 1262, 1462, -1, -1, -1, -1, -1, -1},
+    {1918, 1696, 1467, -1, -1, -1, -1, -1, -1},
+    {1467, 1462, 1918, -1, -1, -1, -1, -1, -1},
+    {693, 711, 687, -1, -1, -1, -1, -1, -1},
+    {687, 675, 693, -1, -1, -1, -1, -1, -1},
+    {741, 747, 711, -1, -1, -1, -1, -1, -1},
+    {711, 693, 741, -1, -1, -1, -1, -1, -1},
+    {793, 799, 747, -1, -1, -1, -1, -1, -1},
+    {747, 741, 793, -1, -1, -1, -1, -1, -1},
+    {871, 881, 799, -1, -1, -1, -1, -1, -1},
+    {799, 793, 871, -1, -1, -1, -1, -1, -1},
+    {945, 951, 881, -1, -1, -1, -1, -1, -1},
+    {881, 871, 945, -1, -1, -1, -1, -1, -1},
+    {1045, 1051, 951, -1, -1, -1, -1, -1, -1},
+    {951, 945, 1045, -1, -1, -1, -1, -1, -1},
+    {1140, 1144, 1051, -1, -1, -1, -1, -1, -1},
+    {1051, 1045, 1140, -1, -1, -1, -1, -1, -1},
+    {1258, 1262, 1144, -1, -1, -1, -1, -1, -1},
+    {1144, 1140, 1258, -1, -1, -1, -1, -1, -1},
+    {1458, 1462, 1262, -1, -1, -1, -1, -1, -1},
+    {1262, 1258, 1458, -1, -1, -1, -1, -1, -1},
+    {1844, 1918, 1462, -1, -1, -1, -1, -1, -1},
+    {1462, 1458, 1844, -1, -1, -1, -1, -1, -1},
+    {677, 693, 675, -1, -1, -1, -1, -1, -1},
+    {675, 663, 677, -1, -1, -1, -1, -1, -1},
+    {725, 741, 693, -1, -1, -1, -1, -1, -1},
+    {693, 677, 725, -1, -1, -1, -1, -1, -1},
+    {787, 793, 741, -1, -1, -1, -1, -1, -1},
+    {741, 725, 787, -1, -1, -1, -1, -1, -1},
+    {861, 871, 793, -1, -1, -1, -1, -1, -1},
+    {793, 787, 861, -1, -1, -1, -1, -1, -1},
+    {943, 945, 871, -1, -1, -1, -1, -1, -1},
+    {871, 861, 943, -1, -1, -1, -1, -1, -1},
+    {1043, 1045, 945, -1, -1, -1, -1, -1, -1},
+    {945, 943, 1043, -1, -1, -1, -1, -1, -1},
+    {1136, 1140, 1045, -1, -1, -1, -1, -1, -1},
+    {1045, 1043, 1136, -1, -1, -1, -1, -1, -1},
+    {1254, 1258, 1140, -1, -1, -1, -1, -1, -1},
+    {1140, 1136, 1254, -1, -1, -1, -1, -1, -1},
+    {1450, 1458, 1258, -1, -1, -1, -1, -1, -1},
+    {1258, 1254, 1450, -1, -1, -1, -1, -1, -1},
+    {1897, 1844, 1458, -1, -1, -1, -1, -1, -1},
+    {1458, 1450, 1897, -1, -1, -1, -1, -1, -1},
+    {657, 677, 663, -1, -1, -1, -1, -1, -1},
+    {663, 641, 657, -1, -1, -1, -1, -1, -1},
+    {715, 725, 677, -1, -1, -1, -1, -1, -1},
+    {677, 657, 715, -1, -1, -1, -1, -1, -1},
+    {777, 787, 725, -1, -1, -1, -1, -1, -1},
+    {725, 715, 777, -1, -1, -1, -1, -1, -1},
+    {853, 861, 787, -1, -1, -1, -1, -1, -1},
+    {787, 777, 853, -1, -1, -1, -1, -1, -1},
+    {937, 943, 861, -1, -1, -1, -1, -1, -1},
+    {861, 853, 937, -1, -1, -1, -1, -1, -1},
+    {1035, 1043, 943, -1, -1, -1, -1, -1, -1},
+    {943, 937, 1035, -1, -1, -1, -1, -1, -1},
+    {1131, 1136, 1043, -1, -1, -1, -1, -1, -1},
+    {1043, 1035, 1131, -1, -1, -1, -1, -1, -1},
+    {1252, 1254, 1136, -1, -1, -1, -1, -1, -1},
+    {1136, 1131, 1252, -1, -1, -1, -1, -1, -1},
+    {1448, 1450, 1254, -1, -1, -1, -1, -1, -1},
+    {1254, 1252, 1448, -1, -1, -1, -1, -1, -1},
+    {1836, 1897, 1450, -1, -1, -1, -1, -1, -1},
+    {1450, 1448, 1836, -1, -1, -1, -1, -1, -1},
+    {640, 657, 641, -1, -1, -1, -1, -1, -1},
+    {641, 634, 640, -1, -1, -1, -1, -1, -1},
+    {689, 715, 657, -1, -1, -1, -1, -1, -1},
+    {657, 640, 689, -1, -1, -1, -1, -1, -1},
+    {767, 777, 715, -1, -1, -1, -1, -1, -1},
+    {715, 689, 767, -1, -1, -1, -1, -1, -1},
+    {843, 853, 777, -1, -1, -1, -1, -1, -1},
+    {777, 767, 843, -1, -1, -1, -1, -1, -1},
+    {931, 937, 853, -1, -1, -1, -1, -1, -1},
+    {853, 843, 931, -1, -1, -1, -1, -1, -1},
+    {1027, 1035, 937, -1, -1, -1, -1, -1, -1},
+    {937, 931, 1027, -1, -1, -1, -1, -1, -1},
+    {1122, 1131, 1035, -1, -1, -1, -1, -1, -1},
+    {1035, 1027, 1122, -1, -1, -1, -1, -1, -1},
+    {1248, 1252, 1131, -1, -1, -1, -1, -1, -1},
+    {1131, 1122, 1248, -1, -1, -1, -1, -1, -1},
+    {1444, 1448, 1252, -1, -1, -1, -1, -1, -1},
+    {1252, 1248, 1444, -1, -1, -1, -1, -1, -1},
+    {1917, 1836, 1448, -1, -1, -1, -1, -1, -1},
+    {1448, 1444, 1917, -1, -1, -1, -1, -1, -1},
+    {632, 640, 634, -1, -1, -1, -1, -1, -1},
+    {634, 620, 632, -1, -1, -1, -1, -1, -1},
+    {673, 689, 640, -1, -1, -1, -1, -1, -1},
+    {640, 632, 673, -1, -1, -1, -1, -1, -1},
+    {751, 767, 689, -1, -1, -1, -1, -1, -1},
+    {689, 673, 751, -1, -1, -1, -1, -1, -1},
+    {831, 843, 767, -1, -1, -1, -1, -1, -1},
+    {767, 751, 831, -1, -1, -1, -1, -1, -1},
+    {923, 931, 843, -1, -1, -1, -1, -1, -1},
+    {843, 831, 923, -1, -1, -1, -1, -1, -1},
+    {1021, 1027, 931, -1, -1, -1, -1, -1, -1},
+    {931, 923, 1021, -1, -1, -1, -1, -1, -1},
+    {1116, 1122, 1027, -1, -1, -1, -1, -1, -1},
+    {1027, 1021, 1116, -1, -1, -1, -1, -1, -1},
+    {1244, 1248, 1122, -1, -1, -1, -1, -1, -1},
+    {1122, 1116, 1244, -1, -1, -1, -1, -1, -1},
+    {1442, 1444, 1248, -1, -1, -1, -1, -1, -1},
+    {1248, 1244, 1442, -1, -1, -1, -1, -1, -1},
+    {1915, 1917, 1444, -1, -1, -1, -1, -1, -1},
+    {1444, 1442, 1915, -1, -1, -1, -1, -1, -1},
+    {615, 632, 620, -1, -1, -1, -1, -1, -1},
+    {620, 599, 615, -1, -1, -1, -1, -1, -1},
+    {653, 673, 632, -1, -1, -1, -1, -1, -1},
+    {632, 615, 653, -1, -1, -1, -1, -1, -1},
+    {736, 751, 673, -1, -1, -1, -1, -1, -1},
+    {673, 653, 736, -1, -1, -1, -1, -1, -1},
+    {821, 831, 751, -1, -1, -1, -1, -1, -1},
+    {751, 736, 821, -1, -1, -1, -1, -1, -1},
+    {913, 923, 831, -1, -1, -1, -1, -1, -1},
+    {831, 821, 913, -1, -1, -1, -1, -1, -1},
+    {1013, 1021, 923, -1, -1, -1, -1, -1, -1},
+    {923, 913, 1013, -1, -1, -1, -1, -1, -1},
+    {1103, 1116, 1021, -1, -1, -1, -1, -1, -1},
+    {1021, 1013, 1103, -1, -1, -1, -1, -1, -1},
+    {1236, 1244, 1116, -1, -1, -1, -1, -1, -1},
+    {1116, 1103, 1236, -1, -1, -1, -1, -1, -1},
+    {1432, 1442, 1244, -1, -1, -1, -1, -1, -1},
+    {1244, 1236, 1432, -1, -1, -1, -1, -1, -1},
+    {1818, 1915, 1442, -1, -1, -1, -1, -1, -1},
+    {1442, 1432, 1818, -1, -1, -1, -1, -1, -1},
+    {2158, 2162, 1815, -1, -1, -1, -1, -1, -1},
+    {1815, 1821, 2158, -1, -1, -1, -1, -1, -1},
+    {2358, 2362, 2162, -1, -1, -1, -1, -1, -1},
+    {2162, 2158, 2358, -1, -1, -1, -1, -1, -1},
+    {2476, 2480, 2362, -1, -1, -1, -1, -1, -1},
+    {2362, 2358, 2476, -1, -1, -1, -1, -1, -1},
+    {2567, 2575, 2480, -1, -1, -1, -1, -1, -1},
+    {2480, 2476, 2567, -1, -1, -1, -1, -1, -1},
+    {2669, 2673, 2575, -1, -1, -1, -1, -1, -1},
+    {2575, 2567, 2669, -1, -1, -1, -1, -1, -1},
+    {2737, 2747, 2673, -1, -1, -1, -1, -1, -1},
+    {2673, 2669, 2737, -1, -1, -1, -1, -1, -1},
+    {2819, 2827, 2747, -1, -1, -1, -1, -1, -1},
+    {2747, 2737, 2819, -1, -1, -1, -1, -1, -1},
+    {2869, 2877, 2827, -1, -1, -1, -1, -1, -1},
+    {2827, 2819, 2869, -1, -1, -1, -1, -1, -1},
+    {2909, 2921, 2877, -1, -1, -1, -1, -1, -1},
+    {2877, 2869, 2909, -1, -1, -1, -1, -1, -1},
+    {2931, 2939, 2921, -1, -1, -1, -1, -1, -1},
+    {2921, 2909, 2931, -1, -1, -1, -1, -1, -1},
+    {2152, 2158, 1821, -1, -1, -1, -1, -1, -1},
+    {1821, 1829, 2152, -1, -1, -1, -1, -1, -1},
+    {2350, 2358, 2158, -1, -1, -1, -1, -1, -1},
+    {2158, 2152, 2350, -1, -1, -1, -1, -1, -1},
+    {2468, 2476, 2358, -1, -1, -1, -1, -1, -1},
+    {2358, 2350, 2468, -1, -1, -1, -1, -1, -1},
+    {2561, 2567, 2476, -1, -1, -1, -1, -1, -1},
+    {2476, 2468, 2561, -1, -1, -1, -1, -1, -1},
+    {2663, 2669, 2567, -1, -1, -1, -1, -1, -1},
+    {2567, 2561, 2663, -1, -1, -1, -1, -1, -1},
+    {2729, 2737, 2669, -1, -1, -1, -1, -1, -1},
+    {2669, 2663, 2729, -1, -1, -1, -1, -1, -1},
+    {2813, 2819, 2737, -1, -1, -1, -1, -1, -1},
+    {2737, 2729, 2813, -1, -1, -1, -1, -1, -1},
+    {2863, 2869, 2819, -1, -1, -1, -1, -1, -1},
+    {2819, 2813, 2863, -1, -1, -1, -1, -1, -1},
+    {2901, 2909, 2869, -1, -1, -1, -1, -1, -1},
+    {2869, 2863, 2901, -1, -1, -1, -1, -1, -1},
+    {2917, 2931, 2909, -1, -1, -1, -1, -1, -1},
+    {2909, 2901, 2917, -1, -1, -1, -1, -1, -1},
+    {2153, 2152, 1829, -1, -1, -1, -1, -1, -1},
+    {1829, 1835, 2153, -1, -1, -1, -1, -1, -1},
+    {2354, 2350, 2152, -1, -1, -1, -1, -1, -1},
+    {2152, 2153, 2354, -1, -1, -1, -1, -1, -1},
+    {2471, 2468, 2350, -1, -1, -1, -1, -1, -1},
+    {2350, 2354, 2471, -1, -1, -1, -1, -1, -1},
+    {2562, 2561, 2468, -1, -1, -1, -1, -1, -1},
+    {2468, 2471, 2562, -1, -1, -1, -1, -1, -1},
+    {2665, 2663, 2561, -1, -1, -1, -1, -1, -1},
+    {2561, 2562, 2665, -1, -1, -1, -1, -1, -1},
+    {2733, 2729, 2663, -1, -1, -1, -1, -1, -1},
+    {2663, 2665, 2733, -1, -1, -1, -1, -1, -1},
+    {2815, 2813, 2729, -1, -1, -1, -1, -1, -1},
+    {2729, 2733, 2815, -1, -1, -1, -1, -1, -1},
+    {2865, 2863, 2813, -1, -1, -1, -1, -1, -1},
+    {2813, 2815, 2865, -1, -1, -1, -1, -1, -1},
+    {2903, 2901, 2863, -1, -1, -1, -1, -1, -1},
+    {2863, 2865, 2903, -1, -1, -1, -1, -1, -1},
+    {2923, 2917, 2901, -1, -1, -1, -1, -1, -1},
+    {2901, 2903, 2923, -1, -1, -1, -1, -1, -1},
+    {2160, 2153, 1835, -1, -1, -1, -1, -1, -1},
+    {1835, 1839, 2160, -1, -1, -1, -1, -1, -1},
+    {2360, 2354, 2153, -1, -1, -1, -1, -1, -1},
+    {2153, 2160, 2360, -1, -1, -1, -1, -1, -1},
+    {2478, 2471, 2354, -1, -1, -1, -1, -1, -1},
+    {2354, 2360, 2478, -1, -1, -1, -1, -1, -1},
+    {2571, 2562, 2471, -1, -1, -1, -1, -1, -1},
+    {2471, 2478, 2571, -1, -1, -1, -1, -1, -1},
+    {2671, 2665, 2562, -1, -1, -1, -1, -1, -1},
+    {2562, 2571, 2671, -1, -1, -1, -1, -1, -1},
+    {2741, 2733, 2665, -1, -1, -1, -1, -1, -1},
+    {2665, 2671, 2741, -1, -1, -1, -1, -1, -1},
+    {2823, 2815, 2733, -1, -1, -1, -1, -1, -1},
+    {2733, 2741, 2823, -1, -1, -1, -1, -1, -1},
+    {2875, 2865, 2815, -1, -1, -1, -1, -1, -1},
+    {2815, 2823, 2875, -1, -1, -1, -1, -1, -1},
+    {2911, 2903, 2865, -1, -1, -1, -1, -1, -1},
+    {2865, 2875, 2911, -1, -1, -1, -1, -1, -1},
+    {2935, 2923, 2903, -1, -1, -1, -1, -1, -1},
+    {2903, 2911, 2935, -1, -1, -1, -1, -1, -1},
+    {2164, 2160, 1839, -1, -1, -1, -1, -1, -1},
+    {1839, 1843, 2164, -1, -1, -1, -1, -1, -1},
+    {2364, 2360, 2160, -1, -1, -1, -1, -1, -1},
+    {2160, 2164, 2364, -1, -1, -1, -1, -1, -1},
+    {2482, 2478, 2360, -1, -1, -1, -1, -1, -1},
+    {2360, 2364, 2482, -1, -1, -1, -1, -1, -1},
+    {2577, 2571, 2478, -1, -1, -1, -1, -1, -1},
+    {2478, 2482, 2577, -1, -1, -1, -1, -1, -1},
+    {2677, 2671, 2571, -1, -1, -1, -1, -1, -1},
+    {2571, 2577, 2677, -1, -1, -1, -1, -1, -1},
+    {2751, 2741, 2671, -1, -1, -1, -1, -1, -1},
+    {2671, 2677, 2751, -1, -1, -1, -1, -1, -1},
+    {2829, 2823, 2741, -1, -1, -1, -1, -1, -1},
+    {2741, 2751, 2829, -1, -1, -1, -1, -1, -1},
+    {2881, 2875, 2823, -1, -1, -1, -1, -1, -1},
+    {2823, 2829, 2881, -1, -1, -1, -1, -1, -1},
+    {2929, 2911, 2875, -1, -1, -1, -1, -1, -1},
+    {2875, 2881, 2929, -1, -1, -1, -1, -1, -1},
+    {2947, 2935, 2911, -1, -1, -1, -1, -1, -1},
+    {2911, 2929, 2947, -1, -1, -1, -1, -1, -1},
+    {2172, 2164, 1843, -1, -1, -1, -1, -1, -1},
+    {1843, 1840, 2172, -1, -1, -1, -1, -1, -1},
+    {2368, 2364, 2164, -1, -1, -1, -1, -1, -1},
+    {2164, 2172, 2368, -1, -1, -1, -1, -1, -1},
+    {2486, 2482, 2364, -1, -1, -1, -1, -1, -1},
+    {2364, 2368, 2486, -1, -1, -1, -1, -1, -1},
+    {2579, 2577, 2482, -1, -1, -1, -1, -1, -1},
+    {2482, 2486, 2579, -1, -1, -1, -1, -1, -1},
+    {2679, 2677, 2577, -1, -1, -1, -1, -1, -1},
+    {2577, 2579, 2679, -1, -1, -1, -1, -1, -1},
+    {2761, 2751, 2677, -1, -1, -1, -1, -1, -1},
+    {2677, 2679, 2761, -1, -1, -1, -1, -1, -1},
+    {2835, 2829, 2751, -1, -1, -1, -1, -1, -1},
+    {2751, 2761, 2835, -1, -1, -1, -1, -1, -1},
+    {2897, 2881, 2829, -1, -1, -1, -1, -1, -1},
+    {2829, 2835, 2897, -1, -1, -1, -1, -1, -1},
+    {2945, 2929, 2881, -1, -1, -1, -1, -1, -1},
+    {2881, 2897, 2945, -1, -1, -1, -1, -1, -1},
+    {2959, 2947, 2929, -1, -1, -1, -1, -1, -1},
+    {2929, 2945, 2959, -1, -1, -1, -1, -1, -1},
+    {2174, 2172, 1840, -1, -1, -1, -1, -1, -1},
+    {1840, 1836, 2174, -1, -1, -1, -1, -1, -1},
+    {2370, 2368, 2172, -1, -1, -1, -1, -1, -1},
+    {2172, 2174, 2370, -1, -1, -1, -1, -1, -1},
+    {2489, 2486, 2368, -1, -1, -1, -1, -1, -1},
+    {2368, 2370, 2489, -1, -1, -1, -1, -1, -1},
+    {2587, 2579, 2486, -1, -1, -1, -1, -1, -1},
+    {2486, 2489, 2587, -1, -1, -1, -1, -1, -1},
+    {2685, 2679, 2579, -1, -1, -1, -1, -1, -1},
+    {2579, 2587, 2685, -1, -1, -1, -1, -1, -1},
+    {2769, 2761, 2679, -1, -1, -1, -1, -1, -1},
+    {2679, 2685, 2769, -1, -1, -1, -1, -1, -1},
+    {2845, 2835, 2761, -1, -1, -1, -1, -1, -1},
+    {2761, 2769, 2845, -1, -1, -1, -1, -1, -1},
+    {2907, 2897, 2835, -1, -1, -1, -1, -1, -1},
+    {2835, 2845, 2907, -1, -1, -1, -1, -1, -1},
+    {2965, 2945, 2897, -1, -1, -1, -1, -1, -1},
+    {2897, 2907, 2965, -1, -1, -1, -1, -1, -1},
+    {2980, 2959, 2945, -1, -1, -1, -1, -1, -1},
+    {2945, 2965, 2980, -1, -1, -1, -1, -1, -1},
+    {2178, 2174, 1836, -1, -1, -1, -1, -1, -1},
+    {1836, 1830, 2178, -1, -1, -1, -1, -1, -1},
+    {2374, 2370, 2174, -1, -1, -1, -1, -1, -1},
+    {2174, 2178, 2374, -1, -1, -1, -1, -1, -1},
+    {2500, 2489, 2370, -1, -1, -1, -1, -1, -1},
+    {2370, 2374, 2500, -1, -1, -1, -1, -1, -1},
+    {2595, 2587, 2489, -1, -1, -1, -1, -1, -1},
+    {2489, 2500, 2595, -1, -1, -1, -1, -1, -1},
+    {2691, 2685, 2587, -1, -1, -1, -1, -1, -1},
+    {2587, 2595, 2691, -1, -1, -1, -1, -1, -1},
+    {2779, 2769, 2685, -1, -1, -1, -1, -1, -1},
+    {2685, 2691, 2779, -1, -1, -1, -1, -1, -1},
+    {2855, 2845, 2769, -1, -1, -1, -1, -1, -1},
+    {2769, 2779, 2855, -1, -1, -1, -1, -1, -1},
+    {2933, 2907, 2845, -1, -1, -1, -1, -1, -1},
+    {2845, 2855, 2933, -1, -1, -1, -1, -1, -1},
+    {2982, 2965, 2907, -1, -1, -1, -1, -1, -1},
+    {2907, 2933, 2982, -1, -1, -1, -1, -1, -1},
+    {2988, 2980, 2965, -1, -1, -1, -1, -1, -1},
+    {2965, 2982, 2988, -1, -1, -1, -1, -1, -1},
+    {2180, 2178, 1830, -1, -1, -1, -1, -1, -1},
+    {1830, 1822, 2180, -1, -1, -1, -1, -1, -1},
+    {2378, 2374, 2178, -1, -1, -1, -1, -1, -1},
+    {2178, 2180, 2378, -1, -1, -1, -1, -1, -1},
+    {2506, 2500, 2374, -1, -1, -1, -1, -1, -1},
+    {2374, 2378, 2506, -1, -1, -1, -1, -1, -1},
+    {2601, 2595, 2500, -1, -1, -1, -1, -1, -1},
+    {2500, 2506, 2601, -1, -1, -1, -1, -1, -1},
+    {2699, 2691, 2595, -1, -1, -1, -1, -1, -1},
+    {2595, 2601, 2699, -1, -1, -1, -1, -1, -1},
+    {2791, 2779, 2691, -1, -1, -1, -1, -1, -1},
+    {2691, 2699, 2791, -1, -1, -1, -1, -1, -1},
+    {2871, 2855, 2779, -1, -1, -1, -1, -1, -1},
+    {2779, 2791, 2871, -1, -1, -1, -1, -1, -1},
+    {2949, 2933, 2855, -1, -1, -1, -1, -1, -1},
+    {2855, 2871, 2949, -1, -1, -1, -1, -1, -1},
+    {2990, 2982, 2933, -1, -1, -1, -1, -1, -1},
+    {2933, 2949, 2990, -1, -1, -1, -1, -1, -1},
+    {3002, 2988, 2982, -1, -1, -1, -1, -1, -1},
+    {2982, 2990, 3002, -1, -1, -1, -1, -1, -1},
+    {2193, 2180, 1822, -1, -1, -1, -1, -1, -1},
+    {1822, 1817, 2193, -1, -1, -1, -1, -1, -1},
+    {2390, 2378, 2180, -1, -1, -1, -1, -1, -1},
+    {2180, 2193, 2390, -1, -1, -1, -1, -1, -1},
+    {2517, 2506, 2378, -1, -1, -1, -1, -1, -1},
+    {2378, 2390, 2517, -1, -1, -1, -1, -1, -1},
+    {2613, 2601, 2506, -1, -1, -1, -1, -1, -1},
+    {2506, 2517, 2613, -1, -1, -1, -1, -1, -1},
+    {2711, 2699, 2601, -1, -1, -1, -1, -1, -1},
+    {2601, 2613, 2711, -1, -1, -1, -1, -1, -1},
+    {2805, 2791, 2699, -1, -1, -1, -1, -1, -1},
+    {2699, 2711, 2805, -1, -1, -1, -1, -1, -1},
+    {2889, 2871, 2791, -1, -1, -1, -1, -1, -1},
+    {2791, 2805, 2889, -1, -1, -1, -1, -1, -1},
+    {2973, 2949, 2871, -1, -1, -1, -1, -1, -1},
+    {2871, 2889, 2973, -1, -1, -1, -1, -1, -1},
+    {3008, 2990, 2949, -1, -1, -1, -1, -1, -1},
+    {2949, 2973, 3008, -1, -1, -1, -1, -1, -1},
+    {3024, 3002, 2990, -1, -1, -1, -1, -1, -1},
+    {2990, 3008, 3024, -1, -1, -1, -1, -1, -1},
+    {3039, 3007, 3023, -1, -1, -1, -1, -1, -1},
+    {3023, 3047, 3039, -1, -1, -1, -1, -1, -1},
+    {3017, 2972, 3007, -1, -1, -1, -1, -1, -1},
+    {3007, 3039, 3017, -1, -1, -1, -1, -1, -1},
+    {2942, 2888, 2972, -1, -1, -1, -1, -1, -1},
+    {2972, 3017, 2942, -1, -1, -1, -1, -1, -1},
+    {2840, 2804, 2888, -1, -1, -1, -1, -1, -1},
+    {2888, 2942, 2840, -1, -1, -1, -1, -1, -1},
+    {2730, 2710, 2804, -1, -1, -1, -1, -1, -1},
+    {2804, 2840, 2730, -1, -1, -1, -1, -1, -1},
+    {2644, 2610, 2710, -1, -1, -1, -1, -1, -1},
+    {2710, 2730, 2644, -1, -1, -1, -1, -1, -1},
+    {2528, 2520, 2610, -1, -1, -1, -1, -1, -1},
+    {2610, 2644, 2528, -1, -1, -1, -1, -1, -1},
+    {2401, 2386, 2520, -1, -1, -1, -1, -1, -1},
+    {2520, 2528, 2401, -1, -1, -1, -1, -1, -1},
+    {2207, 2190, 2386, -1, -1, -1, -1, -1, -1},
+    {2386, 2401, 2207, -1, -1, -1, -1, -1, -1},
+    {1805, 1809, 2190, -1, -1, -1, -1, -1, -1},
+    {2190, 2207, 1805, -1, -1, -1, -1, -1, -1},
+    {3071, 3039, 3047, -1, -1, -1, -1, -1, -1},
+    {3047, 3077, 3071, -1, -1, -1, -1, -1, -1},
+    {3043, 3017, 3039, -1, -1, -1, -1, -1, -1},
+    {3039, 3071, 3043, -1, -1, -1, -1, -1, -1},
+    {2993, 2942, 3017, -1, -1, -1, -1, -1, -1},
+    {3017, 3043, 2993, -1, -1, -1, -1, -1, -1},
+    {2882, 2840, 2942, -1, -1, -1, -1, -1, -1},
+    {2942, 2993, 2882, -1, -1, -1, -1, -1, -1},
+    {2772, 2730, 2840, -1, -1, -1, -1, -1, -1},
+    {2840, 2882, 2772, -1, -1, -1, -1, -1, -1},
+    {2658, 2644, 2730, -1, -1, -1, -1, -1, -1},
+    {2730, 2772, 2658, -1, -1, -1, -1, -1, -1},
+    {2538, 2528, 2644, -1, -1, -1, -1, -1, -1},
+    {2644, 2658, 2538, -1, -1, -1, -1, -1, -1},
+    {2409, 2401, 2528, -1, -1, -1, -1, -1, -1},
+    {2528, 2538, 2409, -1, -1, -1, -1, -1, -1},
+    {2221, 2207, 2401, -1, -1, -1, -1, -1, -1},
+    {2401, 2409, 2221, -1, -1, -1, -1, -1, -1},
+    {1693, 1805, 2207, -1, -1, -1, -1, -1, -1},
+    {2207, 2221, 1693, -1, -1, -1, -1, -1, -1},
+    {3091, 3071, 3077, -1, -1, -1, -1, -1, -1},
+    {3077, 3115, 3091, -1, -1, -1, -1, -1, -1},
+    {3073, 3043, 3071, -1, -1, -1, -1, -1, -1},
+    {3071, 3091, 3073, -1, -1, -1, -1, -1, -1},
+    {3029, 2993, 3043, -1, -1, -1, -1, -1, -1},
+    {3043, 3073, 3029, -1, -1, -1, -1, -1, -1},
+    {2936, 2882, 2993, -1, -1, -1, -1, -1, -1},
+    {2993, 3029, 2936, -1, -1, -1, -1, -1, -1},
+    {2809, 2772, 2882, -1, -1, -1, -1, -1, -1},
+    {2882, 2936, 2809, -1, -1, -1, -1, -1, -1},
+    {2682, 2658, 2772, -1, -1, -1, -1, -1, -1},
+    {2772, 2809, 2682, -1, -1, -1, -1, -1, -1},
+    {2553, 2538, 2658, -1, -1, -1, -1, -1, -1},
+    {2658, 2682, 2553, -1, -1, -1, -1, -1, -1},
+    {2419, 2409, 2538, -1, -1, -1, -1, -1, -1},
+    {2538, 2553, 2419, -1, -1, -1, -1, -1, -1},
+    {2237, 2221, 2409, -1, -1, -1, -1, -1, -1},
+    {2409, 2419, 2237, -1, -1, -1, -1, -1, -1},
+    {1929, 1693, 2221, -1, -1, -1, -1, -1, -1},
+    {2221, 2237, 1929, -1, -1, -1, -1, -1, -1},
+    {3131, 3091, 3115, -1, -1, -1, -1, -1, -1},
+    {3115, 3141, 3131, -1, -1, -1, -1, -1, -1},
+    {3089, 3073, 3091, -1, -1, -1, -1, -1, -1},
+    {3091, 3131, 3089, -1, -1, -1, -1, -1, -1},
+    {3053, 3029, 3073, -1, -1, -1, -1, -1, -1},
+    {3073, 3089, 3053, -1, -1, -1, -1, -1, -1},
+    {2983, 2936, 3029, -1, -1, -1, -1, -1, -1},
+    {3029, 3053, 2983, -1, -1, -1, -1, -1, -1},
+    {2836, 2809, 2936, -1, -1, -1, -1, -1, -1},
+    {2936, 2983, 2836, -1, -1, -1, -1, -1, -1},
+    {2704, 2682, 2809, -1, -1, -1, -1, -1, -1},
+    {2809, 2836, 2704, -1, -1, -1, -1, -1, -1},
+    {2573, 2553, 2682, -1, -1, -1, -1, -1, -1},
+    {2682, 2704, 2573, -1, -1, -1, -1, -1, -1},
+    {2429, 2419, 2553, -1, -1, -1, -1, -1, -1},
+    {2553, 2573, 2429, -1, -1, -1, -1, -1, -1},
+    {2246, 2237, 2419, -1, -1, -1, -1, -1, -1},
+    {2419, 2429, 2246, -1, -1, -1, -1, -1, -1},
+    {1912, 1929, 2237, -1, -1, -1, -1, -1, -1},
+    {2237, 2246, 1912, -1, -1, -1, -1, -1, -1},
+    {3149, 3131, 3141, -1, -1, -1, -1, -1, -1},
+    {3141, 3155, 3149, -1, -1, -1, -1, -1, -1},
+    {3127, 3089, 3131, -1, -1, -1, -1, -1, -1},
+    {3131, 3149, 3127, -1, -1, -1, -1, -1, -1},
+    {3075, 3053, 3089, -1, -1, -1, -1, -1, -1},
+    {3089, 3127, 3075, -1, -1, -1, -1, -1, -1},
+    {3013, 2983, 3053, -1, -1, -1, -1, -1, -1},
+    {3053, 3075, 3013, -1, -1, -1, -1, -1, -1},
+    {2860, 2836, 2983, -1, -1, -1, -1, -1, -1},
+    {2983, 3013, 2860, -1, -1, -1, -1, -1, -1},
+    {2722, 2704, 2836, -1, -1, -1, -1, -1, -1},
+    {2836, 2860, 2722, -1, -1, -1, -1, -1, -1},
+    {2584, 2573, 2704, -1, -1, -1, -1, -1, -1},
+    {2704, 2722, 2584, -1, -1, -1, -1, -1, -1},
+    {2437, 2429, 2573, -1, -1, -1, -1, -1, -1},
+    {2573, 2584, 2437, -1, -1, -1, -1, -1, -1},
+    {2252, 2246, 2429, -1, -1, -1, -1, -1, -1},
+    {2429, 2437, 2252, -1, -1, -1, -1, -1, -1},
+    {1710, 1912, 2246, -1, -1, -1, -1, -1, -1},
+    {2246, 2252, 1710, -1, -1, -1, -1, -1, -1},
+    {3161, 3149, 3155, -1, -1, -1, -1, -1, -1},
+    {3155, 3171, 3161, -1, -1, -1, -1, -1, -1},
+    {3147, 3127, 3149, -1, -1, -1, -1, -1, -1},
+    {3149, 3161, 3147, -1, -1, -1, -1, -1, -1},
+    {3087, 3075, 3127, -1, -1, -1, -1, -1, -1},
+    {3127, 3147, 3087, -1, -1, -1, -1, -1, -1},
+    {3035, 3013, 3075, -1, -1, -1, -1, -1, -1},
+    {3075, 3087, 3035, -1, -1, -1, -1, -1, -1},
+    {2892, 2860, 3013, -1, -1, -1, -1, -1, -1},
+    {3013, 3035, 2892, -1, -1, -1, -1, -1, -1},
+    {2742, 2722, 2860, -1, -1, -1, -1, -1, -1},
+    {2860, 2892, 2742, -1, -1, -1, -1, -1, -1},
+    {2598, 2584, 2722, -1, -1, -1, -1, -1, -1},
+    {2722, 2742, 2598, -1, -1, -1, -1, -1, -1},
+    {2449, 2437, 2584, -1, -1, -1, -1, -1, -1},
+    {2584, 2598, 2449, -1, -1, -1, -1, -1, -1},
+    {2266, 2252, 2437, -1, -1, -1, -1, -1, -1},
+    {2437, 2449, 2266, -1, -1, -1, -1, -1, -1},
+    {1793, 1710, 2252, -1, -1, -1, -1, -1, -1},
+    {2252, 2266, 1793, -1, -1, -1, -1, -1, -1},
+    {3177, 3161, 3171, -1, -1, -1, -1, -1, -1},
+    {3171, 3183, 3177, -1, -1, -1, -1, -1, -1},
+    {3153, 3147, 3161, -1, -1, -1, -1, -1, -1},
+    {3161, 3177, 3153, -1, -1, -1, -1, -1, -1},
+    {3117, 3087, 3147, -1, -1, -1, -1, -1, -1},
+    {3147, 3153, 3117, -1, -1, -1, -1, -1, -1},
+    {3045, 3035, 3087, -1, -1, -1, -1, -1, -1},
+    {3087, 3117, 3045, -1, -1, -1, -1, -1, -1},
+    {2914, 2892, 3035, -1, -1, -1, -1, -1, -1},
+    {3035, 3045, 2914, -1, -1, -1, -1, -1, -1},
+    {2762, 2742, 2892, -1, -1, -1, -1, -1, -1},
+    {2892, 2914, 2762, -1, -1, -1, -1, -1, -1},
+    {2614, 2598, 2742, -1, -1, -1, -1, -1, -1},
+    {2742, 2762, 2614, -1, -1, -1, -1, -1, -1},
+    {2451, 2449, 2598, -1, -1, -1, -1, -1, -1},
+    {2598, 2614, 2451, -1, -1, -1, -1, -1, -1},
+    {2276, 2266, 2449, -1, -1, -1, -1, -1, -1},
+    {2449, 2451, 2276, -1, -1, -1, -1, -1, -1},
+    {1709, 1793, 2266, -1, -1, -1, -1, -1, -1},
+    {2266, 2276, 1709, -1, -1, -1, -1, -1, -1},
+    {3187, 3177, 3183, -1, -1, -1, -1, -1, -1},
+    {3183, 3199, 3187, -1, -1, -1, -1, -1, -1},
+    {3163, 3153, 3177, -1, -1, -1, -1, -1, -1},
+    {3177, 3187, 3163, -1, -1, -1, -1, -1, -1},
+    {3129, 3117, 3153, -1, -1, -1, -1, -1, -1},
+    {3153, 3163, 3129, -1, -1, -1, -1, -1, -1},
+    {3057, 3045, 3117, -1, -1, -1, -1, -1, -1},
+    {3117, 3129, 3057, -1, -1, -1, -1, -1, -1},
+    {2940, 2914, 3045, -1, -1, -1, -1, -1, -1},
+    {3045, 3057, 2940, -1, -1, -1, -1, -1, -1},
+    {2774, 2762, 2914, -1, -1, -1, -1, -1, -1},
+    {2914, 2940, 2774, -1, -1, -1, -1, -1, -1},
+    {2626, 2614, 2762, -1, -1, -1, -1, -1, -1},
+    {2762, 2774, 2626, -1, -1, -1, -1, -1, -1},
+    {2457, 2451, 2614, -1, -1, -1, -1, -1, -1},
+    {2614, 2626, 2457, -1, -1, -1, -1, -1, -1},
+    {2286, 2276, 2451, -1, -1, -1, -1, -1, -1},
+    {2451, 2457, 2286, -1, -1, -1, -1, -1, -1},
+    {1909, 1709, 2276, -1, -1, -1, -1, -1, -1},
+    {2276, 2286, 1909, -1, -1, -1, -1, -1, -1},
+    {3197, 3187, 3199, -1, -1, -1, -1, -1, -1},
+    {3199, 3208, 3197, -1, -1, -1, -1, -1, -1},
+    {3169, 3163, 3187, -1, -1, -1, -1, -1, -1},
+    {3187, 3197, 3169, -1, -1, -1, -1, -1, -1},
+    {3135, 3129, 3163, -1, -1, -1, -1, -1, -1},
+    {3163, 3169, 3135, -1, -1, -1, -1, -1, -1},
+    {3063, 3057, 3129, -1, -1, -1, -1, -1, -1},
+    {3129, 3135, 3063, -1, -1, -1, -1, -1, -1},
+    {2954, 2940, 3057, -1, -1, -1, -1, -1, -1},
+    {3057, 3063, 2954, -1, -1, -1, -1, -1, -1},
+    {2780, 2774, 2940, -1, -1, -1, -1, -1, -1},
+    {2940, 2954, 2780, -1, -1, -1, -1, -1, -1},
+    {2635, 2626, 2774, -1, -1, -1, -1, -1, -1},
+    {2774, 2780, 2635, -1, -1, -1, -1, -1, -1},
+    {2461, 2457, 2626, -1, -1, -1, -1, -1, -1},
+    {2626, 2635, 2461, -1, -1, -1, -1, -1, -1},
+    {2294, 2286, 2457, -1, -1, -1, -1, -1, -1},
+    {2457, 2461, 2294, -1, -1, -1, -1, -1, -1},
+    {1908, 1909, 2286, -1, -1, -1, -1, -1, -1},
+    {2286, 2294, 1908, -1, -1, -1, -1, -1, -1},
+    {3201, 3197, 3208, -1, -1, -1, -1, -1, -1},
+    {3208, 3212, 3201, -1, -1, -1, -1, -1, -1},
+    {3173, 3169, 3197, -1, -1, -1, -1, -1, -1},
+    {3197, 3201, 3173, -1, -1, -1, -1, -1, -1},
+    {3137, 3135, 3169, -1, -1, -1, -1, -1, -1},
+    {3169, 3173, 3137, -1, -1, -1, -1, -1, -1},
+    {3065, 3063, 3135, -1, -1, -1, -1, -1, -1},
+    {3135, 3137, 3065, -1, -1, -1, -1, -1, -1},
+    {2960, 2954, 3063, -1, -1, -1, -1, -1, -1},
+    {3063, 3065, 2960, -1, -1, -1, -1, -1, -1},
+    {2782, 2780, 2954, -1, -1, -1, -1, -1, -1},
+    {2954, 2960, 2782, -1, -1, -1, -1, -1, -1},
+    {2641, 2635, 2780, -1, -1, -1, -1, -1, -1},
+    {2780, 2782, 2641, -1, -1, -1, -1, -1, -1},
+    {2463, 2461, 2635, -1, -1, -1, -1, -1, -1},
+    {2635, 2641, 2463, -1, -1, -1, -1, -1, -1},
+    {2296, 2294, 2461, -1, -1, -1, -1, -1, -1},
+    {2461, 2463, 2296, -1, -1, -1, -1, -1, -1},
+    {1783, 1908, 2294, -1, -1, -1, -1, -1, -1},
+    {2294, 2296, 1783, -1, -1, -1, -1, -1, -1},
+    {1413, 1428, 1810, -1, -1, -1, -1, -1, -1},
+    {1810, 1806, 1413, -1, -1, -1, -1, -1, -1},
+    {1219, 1232, 1428, -1, -1, -1, -1, -1, -1},
+    {1428, 1413, 1219, -1, -1, -1, -1, -1, -1},
+    {1092, 1105, 1232, -1, -1, -1, -1, -1, -1},
+    {1232, 1219, 1092, -1, -1, -1, -1, -1, -1},
+    {976, 1010, 1105, -1, -1, -1, -1, -1, -1},
+    {1105, 1092, 976, -1, -1, -1, -1, -1, -1},
+    {890, 910, 1010, -1, -1, -1, -1, -1, -1},
+    {1010, 976, 890, -1, -1, -1, -1, -1, -1},
+    {780, 816, 910, -1, -1, -1, -1, -1, -1},
+    {910, 890, 780, -1, -1, -1, -1, -1, -1},
+    {678, 732, 816, -1, -1, -1, -1, -1, -1},
+    {816, 780, 678, -1, -1, -1, -1, -1, -1},
+    {603, 648, 732, -1, -1, -1, -1, -1, -1},
+    {732, 678, 603, -1, -1, -1, -1, -1, -1},
+    {570, 613, 648, -1, -1, -1, -1, -1, -1},
+    {648, 603, 570, -1, -1, -1, -1, -1, -1},
+    {560, 596, 613, -1, -1, -1, -1, -1, -1},
+    {613, 570, 560, -1, -1, -1, -1, -1, -1},
+    {1399, 1413, 1806, -1, -1, -1, -1, -1, -1},
+    {1806, 1803, 1399, -1, -1, -1, -1, -1, -1},
+    {1211, 1219, 1413, -1, -1, -1, -1, -1, -1},
+    {1413, 1399, 1211, -1, -1, -1, -1, -1, -1},
+    {1082, 1092, 1219, -1, -1, -1, -1, -1, -1},
+    {1219, 1211, 1082, -1, -1, -1, -1, -1, -1},
+    {962, 976, 1092, -1, -1, -1, -1, -1, -1},
+    {1092, 1082, 962, -1, -1, -1, -1, -1, -1},
+    {848, 890, 976, -1, -1, -1, -1, -1, -1},
+    {976, 962, 848, -1, -1, -1, -1, -1, -1},
+    {738, 780, 890, -1, -1, -1, -1, -1, -1},
+    {890, 848, 738, -1, -1, -1, -1, -1, -1},
+    {627, 678, 780, -1, -1, -1, -1, -1, -1},
+    {780, 738, 627, -1, -1, -1, -1, -1, -1},
+    {564, 603, 678, -1, -1, -1, -1, -1, -1},
+    {678, 627, 564, -1, -1, -1, -1, -1, -1},
+    {529, 570, 603, -1, -1, -1, -1, -1, -1},
+    {603, 564, 529, -1, -1, -1, -1, -1, -1},
+    {523, 560, 570, -1, -1, -1, -1, -1, -1},
+    {570, 529, 523, -1, -1, -1, -1, -1, -1},
+    {1385, 1399, 1803, -1, -1, -1, -1, -1, -1},
+    {1803, 1801, 1385, -1, -1, -1, -1, -1, -1},
+    {1201, 1211, 1399, -1, -1, -1, -1, -1, -1},
+    {1399, 1385, 1201, -1, -1, -1, -1, -1, -1},
+    {1069, 1082, 1211, -1, -1, -1, -1, -1, -1},
+    {1211, 1201, 1069, -1, -1, -1, -1, -1, -1},
+    {938, 962, 1082, -1, -1, -1, -1, -1, -1},
+    {1082, 1069, 938, -1, -1, -1, -1, -1, -1},
+    {813, 848, 962, -1, -1, -1, -1, -1, -1},
+    {962, 938, 813, -1, -1, -1, -1, -1, -1},
+    {684, 738, 848, -1, -1, -1, -1, -1, -1},
+    {848, 813, 684, -1, -1, -1, -1, -1, -1},
+    {584, 627, 738, -1, -1, -1, -1, -1, -1},
+    {738, 684, 584, -1, -1, -1, -1, -1, -1},
+    {527, 564, 627, -1, -1, -1, -1, -1, -1},
+    {627, 584, 527, -1, -1, -1, -1, -1, -1},
+    {509, 529, 564, -1, -1, -1, -1, -1, -1},
+    {564, 527, 509, -1, -1, -1, -1, -1, -1},
+    {507, 523, 529, -1, -1, -1, -1, -1, -1},
+    {529, 509, 507, -1, -1, -1, -1, -1, -1},
+    {1374, 1385, 1801, -1, -1, -1, -1, -1, -1},
+    {1801, 1799, 1374, -1, -1, -1, -1, -1, -1},
+    {1191, 1201, 1385, -1, -1, -1, -1, -1, -1},
+    {1385, 1374, 1191, -1, -1, -1, -1, -1, -1},
+    {1049, 1069, 1201, -1, -1, -1, -1, -1, -1},
+    {1201, 1191, 1049, -1, -1, -1, -1, -1, -1},
+    {916, 938, 1069, -1, -1, -1, -1, -1, -1},
+    {1069, 1049, 916, -1, -1, -1, -1, -1, -1},
+    {784, 813, 938, -1, -1, -1, -1, -1, -1},
+    {938, 916, 784, -1, -1, -1, -1, -1, -1},
+    {637, 684, 813, -1, -1, -1, -1, -1, -1},
+    {813, 784, 637, -1, -1, -1, -1, -1, -1},
+    {552, 584, 684, -1, -1, -1, -1, -1, -1},
+    {684, 637, 552, -1, -1, -1, -1, -1, -1},
+    {511, 527, 584, -1, -1, -1, -1, -1, -1},
+    {584, 552, 511, -1, -1, -1, -1, -1, -1},
+    {491, 509, 527, -1, -1, -1, -1, -1, -1},
+    {527, 511, 491, -1, -1, -1, -1, -1, -1},
+    {481, 507, 509, -1, -1, -1, -1, -1, -1},
+    {509, 491, 481, -1, -1, -1, -1, -1, -1},
+    {1368, 1374, 1799, -1, -1, -1, -1, -1, -1},
+    {1799, 1797, 1368, -1, -1, -1, -1, -1, -1},
+    {1183, 1191, 1374, -1, -1, -1, -1, -1, -1},
+    {1374, 1368, 1183, -1, -1, -1, -1, -1, -1},
+    {1036, 1049, 1191, -1, -1, -1, -1, -1, -1},
+    {1191, 1183, 1036, -1, -1, -1, -1, -1, -1},
+    {898, 916, 1049, -1, -1, -1, -1, -1, -1},
+    {1049, 1036, 898, -1, -1, -1, -1, -1, -1},
+    {760, 784, 916, -1, -1, -1, -1, -1, -1},
+    {916, 898, 760, -1, -1, -1, -1, -1, -1},
+    {607, 637, 784, -1, -1, -1, -1, -1, -1},
+    {784, 760, 607, -1, -1, -1, -1, -1, -1},
+    {525, 552, 637, -1, -1, -1, -1, -1, -1},
+    {637, 607, 525, -1, -1, -1, -1, -1, -1},
+    {495, 511, 552, -1, -1, -1, -1, -1, -1},
+    {552, 525, 495, -1, -1, -1, -1, -1, -1},
+    {453, 491, 511, -1, -1, -1, -1, -1, -1},
+    {511, 495, 453, -1, -1, -1, -1, -1, -1},
+    {447, 481, 491, -1, -1, -1, -1, -1, -1},
+    {491, 453, 447, -1, -1, -1, -1, -1, -1},
+    {1354, 1368, 1797, -1, -1, -1, -1, -1, -1},
+    {1797, 1794, 1354, -1, -1, -1, -1, -1, -1},
+    {1171, 1183, 1368, -1, -1, -1, -1, -1, -1},
+    {1368, 1354, 1171, -1, -1, -1, -1, -1, -1},
+    {1022, 1036, 1183, -1, -1, -1, -1, -1, -1},
+    {1183, 1171, 1022, -1, -1, -1, -1, -1, -1},
+    {878, 898, 1036, -1, -1, -1, -1, -1, -1},
+    {1036, 1022, 878, -1, -1, -1, -1, -1, -1},
+    {728, 760, 898, -1, -1, -1, -1, -1, -1},
+    {898, 878, 728, -1, -1, -1, -1, -1, -1},
+    {578, 607, 760, -1, -1, -1, -1, -1, -1},
+    {760, 728, 578, -1, -1, -1, -1, -1, -1},
+    {513, 525, 607, -1, -1, -1, -1, -1, -1},
+    {607, 578, 513, -1, -1, -1, -1, -1, -1},
+    {456, 495, 525, -1, -1, -1, -1, -1, -1},
+    {525, 513, 456, -1, -1, -1, -1, -1, -1},
+    {441, 453, 495, -1, -1, -1, -1, -1, -1},
+    {495, 456, 441, -1, -1, -1, -1, -1, -1},
+    {431, 447, 453, -1, -1, -1, -1, -1, -1},
+    {453, 441, 431, -1, -1, -1, -1, -1, -1},
+    {1344, 1354, 1794, -1, -1, -1, -1, -1, -1},
+    {1794, 1791, 1344, -1, -1, -1, -1, -1, -1},
+    {1169, 1171, 1354, -1, -1, -1, -1, -1, -1},
+    {1354, 1344, 1169, -1, -1, -1, -1, -1, -1},
+    {1006, 1022, 1171, -1, -1, -1, -1, -1, -1},
+    {1171, 1169, 1006, -1, -1, -1, -1, -1, -1},
+    {858, 878, 1022, -1, -1, -1, -1, -1, -1},
+    {1022, 1006, 858, -1, -1, -1, -1, -1, -1},
+    {706, 728, 878, -1, -1, -1, -1, -1, -1},
+    {878, 858, 706, -1, -1, -1, -1, -1, -1},
+    {562, 578, 728, -1, -1, -1, -1, -1, -1},
+    {728, 706, 562, -1, -1, -1, -1, -1, -1},
+    {505, 513, 578, -1, -1, -1, -1, -1, -1},
+    {578, 562, 505, -1, -1, -1, -1, -1, -1},
+    {449, 456, 513, -1, -1, -1, -1, -1, -1},
+    {513, 505, 449, -1, -1, -1, -1, -1, -1},
+    {419, 441, 456, -1, -1, -1, -1, -1, -1},
+    {456, 449, 419, -1, -1, -1, -1, -1, -1},
+    {411, 431, 441, -1, -1, -1, -1, -1, -1},
+    {441, 419, 411, -1, -1, -1, -1, -1, -1},
+    {1334, 1344, 1791, -1, -1, -1, -1, -1, -1},
+    {1791, 1789, 1334, -1, -1, -1, -1, -1, -1},
+    {1163, 1169, 1344, -1, -1, -1, -1, -1, -1},
+    {1344, 1334, 1163, -1, -1, -1, -1, -1, -1},
+    {994, 1006, 1169, -1, -1, -1, -1, -1, -1},
+    {1169, 1163, 994, -1, -1, -1, -1, -1, -1},
+    {846, 858, 1006, -1, -1, -1, -1, -1, -1},
+    {1006, 994, 846, -1, -1, -1, -1, -1, -1},
+    {680, 706, 858, -1, -1, -1, -1, -1, -1},
+    {858, 846, 680, -1, -1, -1, -1, -1, -1},
+    {546, 562, 706, -1, -1, -1, -1, -1, -1},
+    {706, 680, 546, -1, -1, -1, -1, -1, -1},
+    {493, 505, 562, -1, -1, -1, -1, -1, -1},
+    {562, 546, 493, -1, -1, -1, -1, -1, -1},
+    {439, 449, 505, -1, -1, -1, -1, -1, -1},
+    {505, 493, 439, -1, -1, -1, -1, -1, -1},
+    {409, 419, 449, -1, -1, -1, -1, -1, -1},
+    {449, 439, 409, -1, -1, -1, -1, -1, -1},
+    {397, 411, 419, -1, -1, -1, -1, -1, -1},
+    {419, 409, 397, -1, -1, -1, -1, -1, -1},
+    {1326, 1334, 1789, -1, -1, -1, -1, -1, -1},
+    {1789, 1787, 1326, -1, -1, -1, -1, -1, -1},
+    {1159, 1163, 1334, -1, -1, -1, -1, -1, -1},
+    {1334, 1326, 1159, -1, -1, -1, -1, -1, -1},
+    {987, 994, 1163, -1, -1, -1, -1, -1, -1},
+    {1163, 1159, 987, -1, -1, -1, -1, -1, -1},
+    {840, 846, 994, -1, -1, -1, -1, -1, -1},
+    {994, 987, 840, -1, -1, -1, -1, -1, -1},
+    {666, 680, 846, -1, -1, -1, -1, -1, -1},
+    {846, 840, 666, -1, -1, -1, -1, -1, -1},
+    {537, 546, 680, -1, -1, -1, -1, -1, -1},
+    {680, 666, 537, -1, -1, -1, -1, -1, -1},
+    {487, 493, 546, -1, -1, -1, -1, -1, -1},
+    {546, 537, 487, -1, -1, -1, -1, -1, -1},
+    {433, 439, 493, -1, -1, -1, -1, -1, -1},
+    {493, 487, 433, -1, -1, -1, -1, -1, -1},
+    {399, 409, 439, -1, -1, -1, -1, -1, -1},
+    {439, 433, 399, -1, -1, -1, -1, -1, -1},
+    {380, 397, 409, -1, -1, -1, -1, -1, -1},
+    {409, 399, 380, -1, -1, -1, -1, -1, -1},
+    {1323, 1326, 1787, -1, -1, -1, -1, -1, -1},
+    {1787, 1784, 1323, -1, -1, -1, -1, -1, -1},
+    {1155, 1159, 1326, -1, -1, -1, -1, -1, -1},
+    {1326, 1323, 1155, -1, -1, -1, -1, -1, -1},
+    {978, 987, 1159, -1, -1, -1, -1, -1, -1},
+    {1159, 1155, 978, -1, -1, -1, -1, -1, -1},
+    {836, 840, 987, -1, -1, -1, -1, -1, -1},
+    {987, 978, 836, -1, -1, -1, -1, -1, -1},
+    {658, 666, 840, -1, -1, -1, -1, -1, -1},
+    {840, 836, 658, -1, -1, -1, -1, -1, -1},
+    {533, 537, 666, -1, -1, -1, -1, -1, -1},
+    {666, 658, 533, -1, -1, -1, -1, -1, -1},
+    {483, 487, 537, -1, -1, -1, -1, -1, -1},
+    {537, 533, 483, -1, -1, -1, -1, -1, -1},
+    {427, 433, 487, -1, -1, -1, -1, -1, -1},
+    {487, 483, 427, -1, -1, -1, -1, -1, -1},
+    {394, 399, 433, -1, -1, -1, -1, -1, -1},
+    {433, 427, 394, -1, -1, -1, -1, -1, -1},
+    {373, 380, 399, -1, -1, -1, -1, -1, -1},
+    {399, 394, 373, -1, -1, -1, -1, -1, -1},
+    {571, 615, 599, -1, -1, -1, -1, -1, -1},
+    {599, 561, 571, -1, -1, -1, -1, -1, -1},
+    {604, 653, 615, -1, -1, -1, -1, -1, -1},
+    {615, 571, 604, -1, -1, -1, -1, -1, -1},
+    {679, 736, 653, -1, -1, -1, -1, -1, -1},
+    {653, 604, 679, -1, -1, -1, -1, -1, -1},
+    {781, 821, 736, -1, -1, -1, -1, -1, -1},
+    {736, 679, 781, -1, -1, -1, -1, -1, -1},
+    {891, 913, 821, -1, -1, -1, -1, -1, -1},
+    {821, 781, 891, -1, -1, -1, -1, -1, -1},
+    {977, 1013, 913, -1, -1, -1, -1, -1, -1},
+    {913, 891, 977, -1, -1, -1, -1, -1, -1},
+    {1093, 1103, 1013, -1, -1, -1, -1, -1, -1},
+    {1013, 977, 1093, -1, -1, -1, -1, -1, -1},
+    {1220, 1236, 1103, -1, -1, -1, -1, -1, -1},
+    {1103, 1093, 1220, -1, -1, -1, -1, -1, -1},
+    {1414, 1432, 1236, -1, -1, -1, -1, -1, -1},
+    {1236, 1220, 1414, -1, -1, -1, -1, -1, -1},
+    {1808, 1818, 1432, -1, -1, -1, -1, -1, -1},
+    {1432, 1414, 1808, -1, -1, -1, -1, -1, -1},
+    {530, 571, 561, -1, -1, -1, -1, -1, -1},
+    {561, 524, 530, -1, -1, -1, -1, -1, -1},
+    {565, 604, 571, -1, -1, -1, -1, -1, -1},
+    {571, 530, 565, -1, -1, -1, -1, -1, -1},
+    {628, 679, 604, -1, -1, -1, -1, -1, -1},
+    {604, 565, 628, -1, -1, -1, -1, -1, -1},
+    {739, 781, 679, -1, -1, -1, -1, -1, -1},
+    {679, 628, 739, -1, -1, -1, -1, -1, -1},
+    {849, 891, 781, -1, -1, -1, -1, -1, -1},
+    {781, 739, 849, -1, -1, -1, -1, -1, -1},
+    {963, 977, 891, -1, -1, -1, -1, -1, -1},
+    {891, 849, 963, -1, -1, -1, -1, -1, -1},
+    {1083, 1093, 977, -1, -1, -1, -1, -1, -1},
+    {977, 963, 1083, -1, -1, -1, -1, -1, -1},
+    {1212, 1220, 1093, -1, -1, -1, -1, -1, -1},
+    {1093, 1083, 1212, -1, -1, -1, -1, -1, -1},
+    {1400, 1414, 1220, -1, -1, -1, -1, -1, -1},
+    {1220, 1212, 1400, -1, -1, -1, -1, -1, -1},
+    {1930, 1808, 1414, -1, -1, -1, -1, -1, -1},
+    {1414, 1400, 1930, -1, -1, -1, -1, -1, -1},
+    {510, 530, 524, -1, -1, -1, -1, -1, -1},
+    {524, 508, 510, -1, -1, -1, -1, -1, -1},
+    {528, 565, 530, -1, -1, -1, -1, -1, -1},
+    {530, 510, 528, -1, -1, -1, -1, -1, -1},
+    {585, 628, 565, -1, -1, -1, -1, -1, -1},
+    {565, 528, 585, -1, -1, -1, -1, -1, -1},
+    {685, 739, 628, -1, -1, -1, -1, -1, -1},
+    {628, 585, 685, -1, -1, -1, -1, -1, -1},
+    {812, 849, 739, -1, -1, -1, -1, -1, -1},
+    {739, 685, 812, -1, -1, -1, -1, -1, -1},
+    {939, 963, 849, -1, -1, -1, -1, -1, -1},
+    {849, 812, 939, -1, -1, -1, -1, -1, -1},
+    {1068, 1083, 963, -1, -1, -1, -1, -1, -1},
+    {963, 939, 1068, -1, -1, -1, -1, -1, -1},
+    {1202, 1212, 1083, -1, -1, -1, -1, -1, -1},
+    {1083, 1068, 1202, -1, -1, -1, -1, -1, -1},
+    {1384, 1400, 1212, -1, -1, -1, -1, -1, -1},
+    {1212, 1202, 1384, -1, -1, -1, -1, -1, -1},
+    {1692, 1930, 1400, -1, -1, -1, -1, -1, -1},
+    {1400, 1384, 1692, -1, -1, -1, -1, -1, -1},
+    {492, 510, 508, -1, -1, -1, -1, -1, -1},
+    {508, 482, 492, -1, -1, -1, -1, -1, -1},
+    {512, 528, 510, -1, -1, -1, -1, -1, -1},
+    {510, 492, 512, -1, -1, -1, -1, -1, -1},
+    {553, 585, 528, -1, -1, -1, -1, -1, -1},
+    {528, 512, 553, -1, -1, -1, -1, -1, -1},
+    {638, 685, 585, -1, -1, -1, -1, -1, -1},
+    {585, 553, 638, -1, -1, -1, -1, -1, -1},
+    {785, 812, 685, -1, -1, -1, -1, -1, -1},
+    {685, 638, 785, -1, -1, -1, -1, -1, -1},
+    {917, 939, 812, -1, -1, -1, -1, -1, -1},
+    {812, 785, 917, -1, -1, -1, -1, -1, -1},
+    {1048, 1068, 939, -1, -1, -1, -1, -1, -1},
+    {939, 917, 1048, -1, -1, -1, -1, -1, -1},
+    {1192, 1202, 1068, -1, -1, -1, -1, -1, -1},
+    {1068, 1048, 1192, -1, -1, -1, -1, -1, -1},
+    {1375, 1384, 1202, -1, -1, -1, -1, -1, -1},
+    {1202, 1192, 1375, -1, -1, -1, -1, -1, -1},
+    {1711, 1692, 1384, -1, -1, -1, -1, -1, -1},
+    {1384, 1375, 1711, -1, -1, -1, -1, -1, -1},
+    {454, 492, 482, -1, -1, -1, -1, -1, -1},
+    {482, 448, 454, -1, -1, -1, -1, -1, -1},
+    {496, 512, 492, -1, -1, -1, -1, -1, -1},
+    {492, 454, 496, -1, -1, -1, -1, -1, -1},
+    {526, 553, 512, -1, -1, -1, -1, -1, -1},
+    {512, 496, 526, -1, -1, -1, -1, -1, -1},
+    {608, 638, 553, -1, -1, -1, -1, -1, -1},
+    {553, 526, 608, -1, -1, -1, -1, -1, -1},
+    {761, 785, 638, -1, -1, -1, -1, -1, -1},
+    {638, 608, 761, -1, -1, -1, -1, -1, -1},
+    {899, 917, 785, -1, -1, -1, -1, -1, -1},
+    {785, 761, 899, -1, -1, -1, -1, -1, -1},
+    {1037, 1048, 917, -1, -1, -1, -1, -1, -1},
+    {917, 899, 1037, -1, -1, -1, -1, -1, -1},
+    {1184, 1192, 1048, -1, -1, -1, -1, -1, -1},
+    {1048, 1037, 1184, -1, -1, -1, -1, -1, -1},
+    {1369, 1375, 1192, -1, -1, -1, -1, -1, -1},
+    {1192, 1184, 1369, -1, -1, -1, -1, -1, -1},
+    {1911, 1711, 1375, -1, -1, -1, -1, -1, -1},
+    {1375, 1369, 1911, -1, -1, -1, -1, -1, -1},
+    {442, 454, 448, -1, -1, -1, -1, -1, -1},
+    {448, 432, 442, -1, -1, -1, -1, -1, -1},
+    {457, 496, 454, -1, -1, -1, -1, -1, -1},
+    {454, 442, 457, -1, -1, -1, -1, -1, -1},
+    {514, 526, 496, -1, -1, -1, -1, -1, -1},
+    {496, 457, 514, -1, -1, -1, -1, -1, -1},
+    {579, 608, 526, -1, -1, -1, -1, -1, -1},
+    {526, 514, 579, -1, -1, -1, -1, -1, -1},
+    {729, 761, 608, -1, -1, -1, -1, -1, -1},
+    {608, 579, 729, -1, -1, -1, -1, -1, -1},
+    {879, 899, 761, -1, -1, -1, -1, -1, -1},
+    {761, 729, 879, -1, -1, -1, -1, -1, -1},
+    {1023, 1037, 899, -1, -1, -1, -1, -1, -1},
+    {899, 879, 1023, -1, -1, -1, -1, -1, -1},
+    {1172, 1184, 1037, -1, -1, -1, -1, -1, -1},
+    {1037, 1023, 1172, -1, -1, -1, -1, -1, -1},
+    {1355, 1369, 1184, -1, -1, -1, -1, -1, -1},
+    {1184, 1172, 1355, -1, -1, -1, -1, -1, -1},
+    {1796, 1911, 1369, -1, -1, -1, -1, -1, -1},
+    {1369, 1355, 1796, -1, -1, -1, -1, -1, -1},
+    {420, 442, 432, -1, -1, -1, -1, -1, -1},
+    {432, 412, 420, -1, -1, -1, -1, -1, -1},
+    {450, 457, 442, -1, -1, -1, -1, -1, -1},
+    {442, 420, 450, -1, -1, -1, -1, -1, -1},
+    {506, 514, 457, -1, -1, -1, -1, -1, -1},
+    {457, 450, 506, -1, -1, -1, -1, -1, -1},
+    {563, 579, 514, -1, -1, -1, -1, -1, -1},
+    {514, 506, 563, -1, -1, -1, -1, -1, -1},
+    {707, 729, 579, -1, -1, -1, -1, -1, -1},
+    {579, 563, 707, -1, -1, -1, -1, -1, -1},
+    {859, 879, 729, -1, -1, -1, -1, -1, -1},
+    {729, 707, 859, -1, -1, -1, -1, -1, -1},
+    {1007, 1023, 879, -1, -1, -1, -1, -1, -1},
+    {879, 859, 1007, -1, -1, -1, -1, -1, -1},
+    {1170, 1172, 1023, -1, -1, -1, -1, -1, -1},
+    {1023, 1007, 1170, -1, -1, -1, -1, -1, -1},
+    {1345, 1355, 1172, -1, -1, -1, -1, -1, -1},
+    {1172, 1170, 1345, -1, -1, -1, -1, -1, -1},
+    {1910, 1796, 1355, -1, -1, -1, -1, -1, -1},
+    {1355, 1345, 1910, -1, -1, -1, -1, -1, -1},
+    {410, 420, 412, -1, -1, -1, -1, -1, -1},
+    {412, 398, 410, -1, -1, -1, -1, -1, -1},
+    {440, 450, 420, -1, -1, -1, -1, -1, -1},
+    {420, 410, 440, -1, -1, -1, -1, -1, -1},
+    {494, 506, 450, -1, -1, -1, -1, -1, -1},
+    {450, 440, 494, -1, -1, -1, -1, -1, -1},
+    {547, 563, 506, -1, -1, -1, -1, -1, -1},
+    {506, 494, 547, -1, -1, -1, -1, -1, -1},
+    {681, 707, 563, -1, -1, -1, -1, -1, -1},
+    {563, 547, 681, -1, -1, -1, -1, -1, -1},
+    {847, 859, 707, -1, -1, -1, -1, -1, -1},
+    {707, 681, 847, -1, -1, -1, -1, -1, -1},
+    {995, 1007, 859, -1, -1, -1, -1, -1, -1},
+    {859, 847, 995, -1, -1, -1, -1, -1, -1},
+    {1164, 1170, 1007, -1, -1, -1, -1, -1, -1},
+    {1007, 995, 1164, -1, -1, -1, -1, -1, -1},
+    {1335, 1345, 1170, -1, -1, -1, -1, -1, -1},
+    {1170, 1164, 1335, -1, -1, -1, -1, -1, -1},
+    {1708, 1910, 1345, -1, -1, -1, -1, -1, -1},
+    {1345, 1335, 1708, -1, -1, -1, -1, -1, -1},
+    {400, 410, 398, -1, -1, -1, -1, -1, -1},
+    {398, 381, 400, -1, -1, -1, -1, -1, -1},
+    {434, 440, 410, -1, -1, -1, -1, -1, -1},
+    {410, 400, 434, -1, -1, -1, -1, -1, -1},
+    {488, 494, 440, -1, -1, -1, -1, -1, -1},
+    {440, 434, 488, -1, -1, -1, -1, -1, -1},
+    {538, 547, 494, -1, -1, -1, -1, -1, -1},
+    {494, 488, 538, -1, -1, -1, -1, -1, -1},
+    {667, 681, 547, -1, -1, -1, -1, -1, -1},
+    {547, 538, 667, -1, -1, -1, -1, -1, -1},
+    {841, 847, 681, -1, -1, -1, -1, -1, -1},
+    {681, 667, 841, -1, -1, -1, -1, -1, -1},
+    {986, 995, 847, -1, -1, -1, -1, -1, -1},
+    {847, 841, 986, -1, -1, -1, -1, -1, -1},
+    {1160, 1164, 995, -1, -1, -1, -1, -1, -1},
+    {995, 986, 1160, -1, -1, -1, -1, -1, -1},
+    {1327, 1335, 1164, -1, -1, -1, -1, -1, -1},
+    {1164, 1160, 1327, -1, -1, -1, -1, -1, -1},
+    {1707, 1708, 1335, -1, -1, -1, -1, -1, -1},
+    {1335, 1327, 1707, -1, -1, -1, -1, -1, -1},
+    {396, 400, 381, -1, -1, -1, -1, -1, -1},
+    {381, 375, 396, -1, -1, -1, -1, -1, -1},
+    {430, 434, 400, -1, -1, -1, -1, -1, -1},
+    {400, 396, 430, -1, -1, -1, -1, -1, -1},
+    {486, 488, 434, -1, -1, -1, -1, -1, -1},
+    {434, 430, 486, -1, -1, -1, -1, -1, -1},
+    {536, 538, 488, -1, -1, -1, -1, -1, -1},
+    {488, 486, 536, -1, -1, -1, -1, -1, -1},
+    {661, 667, 538, -1, -1, -1, -1, -1, -1},
+    {538, 536, 661, -1, -1, -1, -1, -1, -1},
+    {839, 841, 667, -1, -1, -1, -1, -1, -1},
+    {667, 661, 839, -1, -1, -1, -1, -1, -1},
+    {980, 986, 841, -1, -1, -1, -1, -1, -1},
+    {841, 839, 980, -1, -1, -1, -1, -1, -1},
+    {1158, 1160, 986, -1, -1, -1, -1, -1, -1},
+    {986, 980, 1158, -1, -1, -1, -1, -1, -1},
+    {1325, 1327, 1160, -1, -1, -1, -1, -1, -1},
+    {1160, 1158, 1325, -1, -1, -1, -1, -1, -1},
+    {1786, 1707, 1327, -1, -1, -1, -1, -1, -1},
+    {1327, 1325, 1786, -1, -1, -1, -1, -1, -1},
+    {2208, 2193, 1817, -1, -1, -1, -1, -1, -1},
+    {1817, 1807, 2208, -1, -1, -1, -1, -1, -1},
+    {2402, 2390, 2193, -1, -1, -1, -1, -1, -1},
+    {2193, 2208, 2402, -1, -1, -1, -1, -1, -1},
+    {2529, 2517, 2390, -1, -1, -1, -1, -1, -1},
+    {2390, 2402, 2529, -1, -1, -1, -1, -1, -1},
+    {2645, 2613, 2517, -1, -1, -1, -1, -1, -1},
+    {2517, 2529, 2645, -1, -1, -1, -1, -1, -1},
+    {2731, 2711, 2613, -1, -1, -1, -1, -1, -1},
+    {2613, 2645, 2731, -1, -1, -1, -1, -1, -1},
+    {2841, 2805, 2711, -1, -1, -1, -1, -1, -1},
+    {2711, 2731, 2841, -1, -1, -1, -1, -1, -1},
+    {2943, 2889, 2805, -1, -1, -1, -1, -1, -1},
+    {2805, 2841, 2943, -1, -1, -1, -1, -1, -1},
+    {3018, 2973, 2889, -1, -1, -1, -1, -1, -1},
+    {2889, 2943, 3018, -1, -1, -1, -1, -1, -1},
+    {3040, 3008, 2973, -1, -1, -1, -1, -1, -1},
+    {2973, 3018, 3040, -1, -1, -1, -1, -1, -1},
+    {3048, 3024, 3008, -1, -1, -1, -1, -1, -1},
+    {3008, 3040, 3048, -1, -1, -1, -1, -1, -1},
+    {2222, 2208, 1807, -1, -1, -1, -1, -1, -1},
+    {1807, 1804, 2222, -1, -1, -1, -1, -1, -1},
+    {2410, 2402, 2208, -1, -1, -1, -1, -1, -1},
+    {2208, 2222, 2410, -1, -1, -1, -1, -1, -1},
+    {2539, 2529, 2402, -1, -1, -1, -1, -1, -1},
+    {2402, 2410, 2539, -1, -1, -1, -1, -1, -1},
+    {2659, 2645, 2529, -1, -1, -1, -1, -1, -1},
+    {2529, 2539, 2659, -1, -1, -1, -1, -1, -1},
+    {2773, 2731, 2645, -1, -1, -1, -1, -1, -1},
+    {2645, 2659, 2773, -1, -1, -1, -1, -1, -1},
+    {2883, 2841, 2731, -1, -1, -1, -1, -1, -1},
+    {2731, 2773, 2883, -1, -1, -1, -1, -1, -1},
+    {2994, 2943, 2841, -1, -1, -1, -1, -1, -1},
+    {2841, 2883, 2994, -1, -1, -1, -1, -1, -1},
+    {3044, 3018, 2943, -1, -1, -1, -1, -1, -1},
+    {2943, 2994, 3044, -1, -1, -1, -1, -1, -1},
+    {3072, 3040, 3018, -1, -1, -1, -1, -1, -1},
+    {3018, 3044, 3072, -1, -1, -1, -1, -1, -1},
+    {3078, 3048, 3040, -1, -1, -1, -1, -1, -1},
+    {3040, 3072, 3078, -1, -1, -1, -1, -1, -1},
+    {2236, 2222, 1804, -1, -1, -1, -1, -1, -1},
+    {1804, 1802, 2236, -1, -1, -1, -1, -1, -1},
+    {2420, 2410, 2222, -1, -1, -1, -1, -1, -1},
+    {2222, 2236, 2420, -1, -1, -1, -1, -1, -1},
+    {2552, 2539, 2410, -1, -1, -1, -1, -1, -1},
+    {2410, 2420, 2552, -1, -1, -1, -1, -1, -1},
+    {2683, 2659, 2539, -1, -1, -1, -1, -1, -1},
+    {2539, 2552, 2683, -1, -1, -1, -1, -1, -1},
+    {2808, 2773, 2659, -1, -1, -1, -1, -1, -1},
+    {2659, 2683, 2808, -1, -1, -1, -1, -1, -1},
+    {2937, 2883, 2773, -1, -1, -1, -1, -1, -1},
+    {2773, 2808, 2937, -1, -1, -1, -1, -1, -1},
+    {3030, 2994, 2883, -1, -1, -1, -1, -1, -1},
+    {2883, 2937, 3030, -1, -1, -1, -1, -1, -1},
+    {3074, 3044, 2994, -1, -1, -1, -1, -1, -1},
+    {2994, 3030, 3074, -1, -1, -1, -1, -1, -1},
+    {3092, 3072, 3044, -1, -1, -1, -1, -1, -1},
+    {3044, 3074, 3092, -1, -1, -1, -1, -1, -1},
+    {3116, 3078, 3072, -1, -1, -1, -1, -1, -1},
+    {3072, 3092, 3116, -1, -1, -1, -1, -1, -1},
+    {2247, 2236, 1802, -1, -1, -1, -1, -1, -1},
+    {1802, 1800, 2247, -1, -1, -1, -1, -1, -1},
+    {2430, 2420, 2236, -1, -1, -1, -1, -1, -1},
+    {2236, 2247, 2430, -1, -1, -1, -1, -1, -1},
+    {2572, 2552, 2420, -1, -1, -1, -1, -1, -1},
+    {2420, 2430, 2572, -1, -1, -1, -1, -1, -1},
+    {2705, 2683, 2552, -1, -1, -1, -1, -1, -1},
+    {2552, 2572, 2705, -1, -1, -1, -1, -1, -1},
+    {2837, 2808, 2683, -1, -1, -1, -1, -1, -1},
+    {2683, 2705, 2837, -1, -1, -1, -1, -1, -1},
+    {2984, 2937, 2808, -1, -1, -1, -1, -1, -1},
+    {2808, 2837, 2984, -1, -1, -1, -1, -1, -1},
+    {3054, 3030, 2937, -1, -1, -1, -1, -1, -1},
+    {2937, 2984, 3054, -1, -1, -1, -1, -1, -1},
+    {3090, 3074, 3030, -1, -1, -1, -1, -1, -1},
+    {3030, 3054, 3090, -1, -1, -1, -1, -1, -1},
+    {3132, 3092, 3074, -1, -1, -1, -1, -1, -1},
+    {3074, 3090, 3132, -1, -1, -1, -1, -1, -1},
+    {3142, 3116, 3092, -1, -1, -1, -1, -1, -1},
+    {3092, 3132, 3142, -1, -1, -1, -1, -1, -1},
+    {2253, 2247, 1800, -1, -1, -1, -1, -1, -1},
+    {1800, 1798, 2253, -1, -1, -1, -1, -1, -1},
+    {2438, 2430, 2247, -1, -1, -1, -1, -1, -1},
+    {2247, 2253, 2438, -1, -1, -1, -1, -1, -1},
+    {2585, 2572, 2430, -1, -1, -1, -1, -1, -1},
+    {2430, 2438, 2585, -1, -1, -1, -1, -1, -1},
+    {2723, 2705, 2572, -1, -1, -1, -1, -1, -1},
+    {2572, 2585, 2723, -1, -1, -1, -1, -1, -1},
+    {2861, 2837, 2705, -1, -1, -1, -1, -1, -1},
+    {2705, 2723, 2861, -1, -1, -1, -1, -1, -1},
+    {3014, 2984, 2837, -1, -1, -1, -1, -1, -1},
+    {2837, 2861, 3014, -1, -1, -1, -1, -1, -1},
+    {3076, 3054, 2984, -1, -1, -1, -1, -1, -1},
+    {2984, 3014, 3076, -1, -1, -1, -1, -1, -1},
+    {3128, 3090, 3054, -1, -1, -1, -1, -1, -1},
+    {3054, 3076, 3128, -1, -1, -1, -1, -1, -1},
+    {3150, 3132, 3090, -1, -1, -1, -1, -1, -1},
+    {3090, 3128, 3150, -1, -1, -1, -1, -1, -1},
+    {3156, 3142, 3132, -1, -1, -1, -1, -1, -1},
+    {3132, 3150, 3156, -1, -1, -1, -1, -1, -1},
+    {2267, 2253, 1798, -1, -1, -1, -1, -1, -1},
+    {1798, 1795, 2267, -1, -1, -1, -1, -1, -1},
+    {2450, 2438, 2253, -1, -1, -1, -1, -1, -1},
+    {2253, 2267, 2450, -1, -1, -1, -1, -1, -1},
+    {2599, 2585, 2438, -1, -1, -1, -1, -1, -1},
+    {2438, 2450, 2599, -1, -1, -1, -1, -1, -1},
+    {2743, 2723, 2585, -1, -1, -1, -1, -1, -1},
+    {2585, 2599, 2743, -1, -1, -1, -1, -1, -1},
+    {2893, 2861, 2723, -1, -1, -1, -1, -1, -1},
+    {2723, 2743, 2893, -1, -1, -1, -1, -1, -1},
+    {3036, 3014, 2861, -1, -1, -1, -1, -1, -1},
+    {2861, 2893, 3036, -1, -1, -1, -1, -1, -1},
+    {3088, 3076, 3014, -1, -1, -1, -1, -1, -1},
+    {3014, 3036, 3088, -1, -1, -1, -1, -1, -1},
+    {3148, 3128, 3076, -1, -1, -1, -1, -1, -1},
+    {3076, 3088, 3148, -1, -1, -1, -1, -1, -1},
+    {3162, 3150, 3128, -1, -1, -1, -1, -1, -1},
+    {3128, 3148, 3162, -1, -1, -1, -1, -1, -1},
+    {3172, 3156, 3150, -1, -1, -1, -1, -1, -1},
+    {3150, 3162, 3172, -1, -1, -1, -1, -1, -1},
+    {2277, 2267, 1795, -1, -1, -1, -1, -1, -1},
+    {1795, 1792, 2277, -1, -1, -1, -1, -1, -1},
+    {2452, 2450, 2267, -1, -1, -1, -1, -1, -1},
+    {2267, 2277, 2452, -1, -1, -1, -1, -1, -1},
+    {2615, 2599, 2450, -1, -1, -1, -1, -1, -1},
+    {2450, 2452, 2615, -1, -1, -1, -1, -1, -1},
+    {2763, 2743, 2599, -1, -1, -1, -1, -1, -1},
+    {2599, 2615, 2763, -1, -1, -1, -1, -1, -1},
+    {2915, 2893, 2743, -1, -1, -1, -1, -1, -1},
+    {2743, 2763, 2915, -1, -1, -1, -1, -1, -1},
+    {3046, 3036, 2893, -1, -1, -1, -1, -1, -1},
+    {2893, 2915, 3046, -1, -1, -1, -1, -1, -1},
+    {3118, 3088, 3036, -1, -1, -1, -1, -1, -1},
+    {3036, 3046, 3118, -1, -1, -1, -1, -1, -1},
+    {3154, 3148, 3088, -1, -1, -1, -1, -1, -1},
+    {3088, 3118, 3154, -1, -1, -1, -1, -1, -1},
+    {3178, 3162, 3148, -1, -1, -1, -1, -1, -1},
+    {3148, 3154, 3178, -1, -1, -1, -1, -1, -1},
+    {3184, 3172, 3162, -1, -1, -1, -1, -1, -1},
+    {3162, 3178, 3184, -1, -1, -1, -1, -1, -1},
+    {2287, 2277, 1792, -1, -1, -1, -1, -1, -1},
+    {1792, 1790, 2287, -1, -1, -1, -1, -1, -1},
+    {2458, 2452, 2277, -1, -1, -1, -1, -1, -1},
+    {2277, 2287, 2458, -1, -1, -1, -1, -1, -1},
+    {2627, 2615, 2452, -1, -1, -1, -1, -1, -1},
+    {2452, 2458, 2627, -1, -1, -1, -1, -1, -1},
+    {2775, 2763, 2615, -1, -1, -1, -1, -1, -1},
+    {2615, 2627, 2775, -1, -1, -1, -1, -1, -1},
+    {2941, 2915, 2763, -1, -1, -1, -1, -1, -1},
+    {2763, 2775, 2941, -1, -1, -1, -1, -1, -1},
+    {3058, 3046, 2915, -1, -1, -1, -1, -1, -1},
+    {2915, 2941, 3058, -1, -1, -1, -1, -1, -1},
+    {3130, 3118, 3046, -1, -1, -1, -1, -1, -1},
+    {3046, 3058, 3130, -1, -1, -1, -1, -1, -1},
+    {3164, 3154, 3118, -1, -1, -1, -1, -1, -1},
+    {3118, 3130, 3164, -1, -1, -1, -1, -1, -1},
+    {3188, 3178, 3154, -1, -1, -1, -1, -1, -1},
+    {3154, 3164, 3188, -1, -1, -1, -1, -1, -1},
+    {3200, 3184, 3178, -1, -1, -1, -1, -1, -1},
+    {3178, 3188, 3200, -1, -1, -1, -1, -1, -1},
+    {2295, 2287, 1790, -1, -1, -1, -1, -1, -1},
+    {1790, 1788, 2295, -1, -1, -1, -1, -1, -1},
+    {2462, 2458, 2287, -1, -1, -1, -1, -1, -1},
+    {2287, 2295, 2462, -1, -1, -1, -1, -1, -1},
+    {2634, 2627, 2458, -1, -1, -1, -1, -1, -1},
+    {2458, 2462, 2634, -1, -1, -1, -1, -1, -1},
+    {2781, 2775, 2627, -1, -1, -1, -1, -1, -1},
+    {2627, 2634, 2781, -1, -1, -1, -1, -1, -1},
+    {2955, 2941, 2775, -1, -1, -1, -1, -1, -1},
+    {2775, 2781, 2955, -1, -1, -1, -1, -1, -1},
+    {3064, 3058, 2941, -1, -1, -1, -1, -1, -1},
+    {2941, 2955, 3064, -1, -1, -1, -1, -1, -1},
+    {3136, 3130, 3058, -1, -1, -1, -1, -1, -1},
+    {3058, 3064, 3136, -1, -1, -1, -1, -1, -1},
+    {3170, 3164, 3130, -1, -1, -1, -1, -1, -1},
+    {3130, 3136, 3170, -1, -1, -1, -1, -1, -1},
+    {3198, 3188, 3164, -1, -1, -1, -1, -1, -1},
+    {3164, 3170, 3198, -1, -1, -1, -1, -1, -1},
+    {3209, 3200, 3188, -1, -1, -1, -1, -1, -1},
+    {3188, 3198, 3209, -1, -1, -1, -1, -1, -1},
+    {2298, 2295, 1788, -1, -1, -1, -1, -1, -1},
+    {1788, 1785, 2298, -1, -1, -1, -1, -1, -1},
+    {2466, 2462, 2295, -1, -1, -1, -1, -1, -1},
+    {2295, 2298, 2466, -1, -1, -1, -1, -1, -1},
+    {2643, 2634, 2462, -1, -1, -1, -1, -1, -1},
+    {2462, 2466, 2643, -1, -1, -1, -1, -1, -1},
+    {2785, 2781, 2634, -1, -1, -1, -1, -1, -1},
+    {2634, 2643, 2785, -1, -1, -1, -1, -1, -1},
+    {2963, 2955, 2781, -1, -1, -1, -1, -1, -1},
+    {2781, 2785, 2963, -1, -1, -1, -1, -1, -1},
+    {3068, 3064, 2955, -1, -1, -1, -1, -1, -1},
+    {2955, 2963, 3068, -1, -1, -1, -1, -1, -1},
+    {3140, 3136, 3064, -1, -1, -1, -1, -1, -1},
+    {3064, 3068, 3140, -1, -1, -1, -1, -1, -1},
+    {3176, 3170, 3136, -1, -1, -1, -1, -1, -1},
+    {3136, 3140, 3176, -1, -1, -1, -1, -1, -1},
+    {3203, 3198, 3170, -1, -1, -1, -1, -1, -1},
+    {3170, 3176, 3203, -1, -1, -1, -1, -1, -1},
+    {3213, 3209, 3198, -1, -1, -1, -1, -1, -1},
+    {3198, 3203, 3213, -1, -1, -1, -1, -1, -1},
+    {3193, 3201, 3212, -1, -1, -1, -1, -1, -1},
+    {3212, 3206, 3193, -1, -1, -1, -1, -1, -1},
+    {3165, 3174, 3201, -1, -1, -1, -1, -1, -1},
+    {3201, 3193, 3165, -1, -1, -1, -1, -1, -1},
+    {3133, 3138, 3174, -1, -1, -1, -1, -1, -1},
+    {3174, 3165, 3133, -1, -1, -1, -1, -1, -1},
+    {3059, 3066, 3138, -1, -1, -1, -1, -1, -1},
+    {3138, 3133, 3059, -1, -1, -1, -1, -1, -1},
+    {2952, 2961, 3066, -1, -1, -1, -1, -1, -1},
+    {3066, 3059, 2952, -1, -1, -1, -1, -1, -1},
+    {2776, 2783, 2961, -1, -1, -1, -1, -1, -1},
+    {2961, 2952, 2776, -1, -1, -1, -1, -1, -1},
+    {2628, 2642, 2783, -1, -1, -1, -1, -1, -1},
+    {2783, 2776, 2628, -1, -1, -1, -1, -1, -1},
+    {2459, 2464, 2642, -1, -1, -1, -1, -1, -1},
+    {2642, 2628, 2459, -1, -1, -1, -1, -1, -1},
+    {2292, 2297, 2464, -1, -1, -1, -1, -1, -1},
+    {2464, 2459, 2292, -1, -1, -1, -1, -1, -1},
+    {1695, 1784, 2297, -1, -1, -1, -1, -1, -1},
+    {2297, 2292, 1695, -1, -1, -1, -1, -1, -1},
+    {3179, 3193, 3206, -1, -1, -1, -1, -1, -1},
+    {3206, 3189, 3179, -1, -1, -1, -1, -1, -1},
+    {3157, 3165, 3193, -1, -1, -1, -1, -1, -1},
+    {3193, 3179, 3157, -1, -1, -1, -1, -1, -1},
+    {3123, 3133, 3165, -1, -1, -1, -1, -1, -1},
+    {3165, 3157, 3123, -1, -1, -1, -1, -1, -1},
+    {3049, 3059, 3133, -1, -1, -1, -1, -1, -1},
+    {3133, 3123, 3049, -1, -1, -1, -1, -1, -1},
+    {2926, 2952, 3059, -1, -1, -1, -1, -1, -1},
+    {3059, 3049, 2926, -1, -1, -1, -1, -1, -1},
+    {2766, 2776, 2952, -1, -1, -1, -1, -1, -1},
+    {2952, 2926, 2766, -1, -1, -1, -1, -1, -1},
+    {2618, 2628, 2776, -1, -1, -1, -1, -1, -1},
+    {2776, 2766, 2618, -1, -1, -1, -1, -1, -1},
+    {2453, 2459, 2628, -1, -1, -1, -1, -1, -1},
+    {2628, 2618, 2453, -1, -1, -1, -1, -1, -1},
+    {2282, 2292, 2459, -1, -1, -1, -1, -1, -1},
+    {2459, 2453, 2282, -1, -1, -1, -1, -1, -1},
+    {1694, 1695, 2292, -1, -1, -1, -1, -1, -1},
+    {2292, 2282, 1694, -1, -1, -1, -1, -1, -1},
+    {3159, 3179, 3189, -1, -1, -1, -1, -1, -1},
+    {3189, 3167, 3159, -1, -1, -1, -1, -1, -1},
+    {3143, 3157, 3179, -1, -1, -1, -1, -1, -1},
+    {3179, 3159, 3143, -1, -1, -1, -1, -1, -1},
+    {3085, 3123, 3157, -1, -1, -1, -1, -1, -1},
+    {3157, 3143, 3085, -1, -1, -1, -1, -1, -1},
+    {3031, 3049, 3123, -1, -1, -1, -1, -1, -1},
+    {3123, 3085, 3031, -1, -1, -1, -1, -1, -1},
+    {2890, 2926, 3049, -1, -1, -1, -1, -1, -1},
+    {3049, 3031, 2890, -1, -1, -1, -1, -1, -1},
+    {2738, 2766, 2926, -1, -1, -1, -1, -1, -1},
+    {2926, 2890, 2738, -1, -1, -1, -1, -1, -1},
+    {2596, 2618, 2766, -1, -1, -1, -1, -1, -1},
+    {2766, 2738, 2596, -1, -1, -1, -1, -1, -1},
+    {2447, 2453, 2618, -1, -1, -1, -1, -1, -1},
+    {2618, 2596, 2447, -1, -1, -1, -1, -1, -1},
+    {2264, 2282, 2453, -1, -1, -1, -1, -1, -1},
+    {2453, 2447, 2264, -1, -1, -1, -1, -1, -1},
+    {1706, 1694, 2282, -1, -1, -1, -1, -1, -1},
+    {2282, 2264, 1706, -1, -1, -1, -1, -1, -1},
+    {3145, 3159, 3167, -1, -1, -1, -1, -1, -1},
+    {3167, 3151, 3145, -1, -1, -1, -1, -1, -1},
+    {3121, 3143, 3159, -1, -1, -1, -1, -1, -1},
+    {3159, 3145, 3121, -1, -1, -1, -1, -1, -1},
+    {3069, 3085, 3143, -1, -1, -1, -1, -1, -1},
+    {3143, 3121, 3069, -1, -1, -1, -1, -1, -1},
+    {2997, 3031, 3085, -1, -1, -1, -1, -1, -1},
+    {3085, 3069, 2997, -1, -1, -1, -1, -1, -1},
+    {2852, 2890, 3031, -1, -1, -1, -1, -1, -1},
+    {3031, 2997, 2852, -1, -1, -1, -1, -1, -1},
+    {2716, 2738, 2890, -1, -1, -1, -1, -1, -1},
+    {2890, 2852, 2716, -1, -1, -1, -1, -1, -1},
+    {2581, 2596, 2738, -1, -1, -1, -1, -1, -1},
+    {2738, 2716, 2581, -1, -1, -1, -1, -1, -1},
+    {2433, 2447, 2596, -1, -1, -1, -1, -1, -1},
+    {2596, 2581, 2433, -1, -1, -1, -1, -1, -1},
+    {2250, 2264, 2447, -1, -1, -1, -1, -1, -1},
+    {2447, 2433, 2250, -1, -1, -1, -1, -1, -1},
+    {1906, 1706, 2264, -1, -1, -1, -1, -1, -1},
+    {2264, 2250, 1906, -1, -1, -1, -1, -1, -1},
+    {3119, 3145, 3151, -1, -1, -1, -1, -1, -1},
+    {3151, 3125, 3119, -1, -1, -1, -1, -1, -1},
+    {3081, 3121, 3145, -1, -1, -1, -1, -1, -1},
+    {3145, 3119, 3081, -1, -1, -1, -1, -1, -1},
+    {3041, 3069, 3121, -1, -1, -1, -1, -1, -1},
+    {3121, 3081, 3041, -1, -1, -1, -1, -1, -1},
+    {2956, 2997, 3069, -1, -1, -1, -1, -1, -1},
+    {3069, 3041, 2956, -1, -1, -1, -1, -1, -1},
+    {2824, 2852, 2997, -1, -1, -1, -1, -1, -1},
+    {2997, 2956, 2824, -1, -1, -1, -1, -1, -1},
+    {2692, 2716, 2852, -1, -1, -1, -1, -1, -1},
+    {2852, 2824, 2692, -1, -1, -1, -1, -1, -1},
+    {2555, 2581, 2716, -1, -1, -1, -1, -1, -1},
+    {2716, 2692, 2555, -1, -1, -1, -1, -1, -1},
+    {2423, 2433, 2581, -1, -1, -1, -1, -1, -1},
+    {2581, 2555, 2423, -1, -1, -1, -1, -1, -1},
+    {2238, 2250, 2433, -1, -1, -1, -1, -1, -1},
+    {2433, 2423, 2238, -1, -1, -1, -1, -1, -1},
+    {1905, 1906, 2250, -1, -1, -1, -1, -1, -1},
+    {2250, 2238, 1905, -1, -1, -1, -1, -1, -1},
+    {3079, 3119, 3125, -1, -1, -1, -1, -1, -1},
+    {3125, 3083, 3079, -1, -1, -1, -1, -1, -1},
+    {3055, 3081, 3119, -1, -1, -1, -1, -1, -1},
+    {3119, 3079, 3055, -1, -1, -1, -1, -1, -1},
+    {3011, 3041, 3081, -1, -1, -1, -1, -1, -1},
+    {3081, 3055, 3011, -1, -1, -1, -1, -1, -1},
+    {2898, 2956, 3041, -1, -1, -1, -1, -1, -1},
+    {3041, 3011, 2898, -1, -1, -1, -1, -1, -1},
+    {2788, 2824, 2956, -1, -1, -1, -1, -1, -1},
+    {2956, 2898, 2788, -1, -1, -1, -1, -1, -1},
+    {2674, 2692, 2824, -1, -1, -1, -1, -1, -1},
+    {2824, 2788, 2674, -1, -1, -1, -1, -1, -1},
+    {2544, 2555, 2692, -1, -1, -1, -1, -1, -1},
+    {2692, 2674, 2544, -1, -1, -1, -1, -1, -1},
+    {2415, 2423, 2555, -1, -1, -1, -1, -1, -1},
+    {2555, 2544, 2415, -1, -1, -1, -1, -1, -1},
+    {2227, 2238, 2423, -1, -1, -1, -1, -1, -1},
+    {2423, 2415, 2227, -1, -1, -1, -1, -1, -1},
+    {1769, 1905, 2238, -1, -1, -1, -1, -1, -1},
+    {2238, 2227, 1769, -1, -1, -1, -1, -1, -1},
+    {3052, 3079, 3083, -1, -1, -1, -1, -1, -1},
+    {3083, 3061, 3052, -1, -1, -1, -1, -1, -1},
+    {3027, 3055, 3079, -1, -1, -1, -1, -1, -1},
+    {3079, 3052, 3027, -1, -1, -1, -1, -1, -1},
+    {2977, 3011, 3055, -1, -1, -1, -1, -1, -1},
+    {3055, 3027, 2977, -1, -1, -1, -1, -1, -1},
+    {2859, 2898, 3011, -1, -1, -1, -1, -1, -1},
+    {3011, 2977, 2859, -1, -1, -1, -1, -1, -1},
+    {2753, 2788, 2898, -1, -1, -1, -1, -1, -1},
+    {2898, 2859, 2753, -1, -1, -1, -1, -1, -1},
+    {2651, 2674, 2788, -1, -1, -1, -1, -1, -1},
+    {2788, 2753, 2651, -1, -1, -1, -1, -1, -1},
+    {2533, 2544, 2674, -1, -1, -1, -1, -1, -1},
+    {2674, 2651, 2533, -1, -1, -1, -1, -1, -1},
+    {2405, 2415, 2544, -1, -1, -1, -1, -1, -1},
+    {2544, 2533, 2405, -1, -1, -1, -1, -1, -1},
+    {2216, 2227, 2415, -1, -1, -1, -1, -1, -1},
+    {2415, 2405, 2216, -1, -1, -1, -1, -1, -1},
+    {1928, 1769, 2227, -1, -1, -1, -1, -1, -1},
+    {2227, 2216, 1928, -1, -1, -1, -1, -1, -1},
+    {3034, 3052, 3061, -1, -1, -1, -1, -1, -1},
+    {3061, 3038, 3034, -1, -1, -1, -1, -1, -1},
+    {2996, 3027, 3052, -1, -1, -1, -1, -1, -1},
+    {3052, 3034, 2996, -1, -1, -1, -1, -1, -1},
+    {2919, 2977, 3027, -1, -1, -1, -1, -1, -1},
+    {3027, 2996, 2919, -1, -1, -1, -1, -1, -1},
+    {2831, 2859, 2977, -1, -1, -1, -1, -1, -1},
+    {2977, 2919, 2831, -1, -1, -1, -1, -1, -1},
+    {2727, 2753, 2859, -1, -1, -1, -1, -1, -1},
+    {2859, 2831, 2727, -1, -1, -1, -1, -1, -1},
+    {2633, 2651, 2753, -1, -1, -1, -1, -1, -1},
+    {2753, 2727, 2633, -1, -1, -1, -1, -1, -1},
+    {2527, 2533, 2651, -1, -1, -1, -1, -1, -1},
+    {2651, 2633, 2527, -1, -1, -1, -1, -1, -1},
+    {2395, 2405, 2533, -1, -1, -1, -1, -1, -1},
+    {2533, 2527, 2395, -1, -1, -1, -1, -1, -1},
+    {2201, 2216, 2405, -1, -1, -1, -1, -1, -1},
+    {2405, 2395, 2201, -1, -1, -1, -1, -1, -1},
+    {1764, 1928, 2216, -1, -1, -1, -1, -1, -1},
+    {2216, 2201, 1764, -1, -1, -1, -1, -1, -1},
+    {3016, 3034, 3038, -1, -1, -1, -1, -1, -1},
+    {3038, 3026, 3016, -1, -1, -1, -1, -1, -1},
+    {2979, 2996, 3034, -1, -1, -1, -1, -1, -1},
+    {3034, 3016, 2979, -1, -1, -1, -1, -1, -1},
+    {2895, 2919, 2996, -1, -1, -1, -1, -1, -1},
+    {2996, 2979, 2895, -1, -1, -1, -1, -1, -1},
+    {2811, 2831, 2919, -1, -1, -1, -1, -1, -1},
+    {2919, 2895, 2811, -1, -1, -1, -1, -1, -1},
+    {2714, 2727, 2831, -1, -1, -1, -1, -1, -1},
+    {2831, 2811, 2714, -1, -1, -1, -1, -1, -1},
+    {2617, 2633, 2727, -1, -1, -1, -1, -1, -1},
+    {2727, 2714, 2617, -1, -1, -1, -1, -1, -1},
+    {2522, 2527, 2633, -1, -1, -1, -1, -1, -1},
+    {2633, 2617, 2522, -1, -1, -1, -1, -1, -1},
+    {2391, 2395, 2527, -1, -1, -1, -1, -1, -1},
+    {2527, 2522, 2391, -1, -1, -1, -1, -1, -1},
+    {2195, 2201, 2395, -1, -1, -1, -1, -1, -1},
+    {2395, 2391, 2195, -1, -1, -1, -1, -1, -1},
+    {1723, 1764, 2201, -1, -1, -1, -1, -1, -1},
+    {2201, 2195, 1723, -1, -1, -1, -1, -1, -1},
+    {3006, 3016, 3026, -1, -1, -1, -1, -1, -1},
+    {3026, 3022, 3006, -1, -1, -1, -1, -1, -1},
+    {2968, 2979, 3016, -1, -1, -1, -1, -1, -1},
+    {3016, 3006, 2968, -1, -1, -1, -1, -1, -1},
+    {2886, 2895, 2979, -1, -1, -1, -1, -1, -1},
+    {2979, 2968, 2886, -1, -1, -1, -1, -1, -1},
+    {2801, 2811, 2895, -1, -1, -1, -1, -1, -1},
+    {2895, 2886, 2801, -1, -1, -1, -1, -1, -1},
+    {2708, 2714, 2811, -1, -1, -1, -1, -1, -1},
+    {2811, 2801, 2708, -1, -1, -1, -1, -1, -1},
+    {2608, 2617, 2714, -1, -1, -1, -1, -1, -1},
+    {2714, 2708, 2608, -1, -1, -1, -1, -1, -1},
+    {2518, 2522, 2617, -1, -1, -1, -1, -1, -1},
+    {2617, 2608, 2518, -1, -1, -1, -1, -1, -1},
+    {2385, 2391, 2522, -1, -1, -1, -1, -1, -1},
+    {2522, 2518, 2385, -1, -1, -1, -1, -1, -1},
+    {2189, 2195, 2391, -1, -1, -1, -1, -1, -1},
+    {2391, 2385, 2189, -1, -1, -1, -1, -1, -1},
+    {1758, 1723, 2195, -1, -1, -1, -1, -1, -1},
+    {2195, 2189, 1758, -1, -1, -1, -1, -1, -1},
+    {1328, 1323, 1784, -1, -1, -1, -1, -1, -1},
+    {1784, 1781, 1328, -1, -1, -1, -1, -1, -1},
+    {1161, 1156, 1323, -1, -1, -1, -1, -1, -1},
+    {1323, 1328, 1161, -1, -1, -1, -1, -1, -1},
+    {992, 981, 1156, -1, -1, -1, -1, -1, -1},
+    {1156, 1161, 992, -1, -1, -1, -1, -1, -1},
+    {844, 837, 981, -1, -1, -1, -1, -1, -1},
+    {981, 992, 844, -1, -1, -1, -1, -1, -1},
+    {668, 659, 837, -1, -1, -1, -1, -1, -1},
+    {837, 844, 668, -1, -1, -1, -1, -1, -1},
+    {541, 534, 659, -1, -1, -1, -1, -1, -1},
+    {659, 668, 541, -1, -1, -1, -1, -1, -1},
+    {489, 484, 534, -1, -1, -1, -1, -1, -1},
+    {534, 541, 489, -1, -1, -1, -1, -1, -1},
+    {437, 428, 484, -1, -1, -1, -1, -1, -1},
+    {484, 489, 437, -1, -1, -1, -1, -1, -1},
+    {403, 395, 428, -1, -1, -1, -1, -1, -1},
+    {428, 437, 403, -1, -1, -1, -1, -1, -1},
+    {386, 375, 395, -1, -1, -1, -1, -1, -1},
+    {395, 403, 386, -1, -1, -1, -1, -1, -1},
+    {1338, 1328, 1781, -1, -1, -1, -1, -1, -1},
+    {1781, 1779, 1338, -1, -1, -1, -1, -1, -1},
+    {1167, 1161, 1328, -1, -1, -1, -1, -1, -1},
+    {1328, 1338, 1167, -1, -1, -1, -1, -1, -1},
+    {1002, 992, 1161, -1, -1, -1, -1, -1, -1},
+    {1161, 1167, 1002, -1, -1, -1, -1, -1, -1},
+    {854, 844, 992, -1, -1, -1, -1, -1, -1},
+    {992, 1002, 854, -1, -1, -1, -1, -1, -1},
+    {694, 668, 844, -1, -1, -1, -1, -1, -1},
+    {844, 854, 694, -1, -1, -1, -1, -1, -1},
+    {558, 541, 668, -1, -1, -1, -1, -1, -1},
+    {668, 694, 558, -1, -1, -1, -1, -1, -1},
+    {499, 489, 541, -1, -1, -1, -1, -1, -1},
+    {541, 558, 499, -1, -1, -1, -1, -1, -1},
+    {445, 437, 489, -1, -1, -1, -1, -1, -1},
+    {489, 499, 445, -1, -1, -1, -1, -1, -1},
+    {415, 403, 437, -1, -1, -1, -1, -1, -1},
+    {437, 445, 415, -1, -1, -1, -1, -1, -1},
+    {407, 386, 403, -1, -1, -1, -1, -1, -1},
+    {403, 415, 407, -1, -1, -1, -1, -1, -1},
+    {1356, 1338, 1779, -1, -1, -1, -1, -1, -1},
+    {1779, 1777, 1356, -1, -1, -1, -1, -1, -1},
+    {1173, 1167, 1338, -1, -1, -1, -1, -1, -1},
+    {1338, 1356, 1173, -1, -1, -1, -1, -1, -1},
+    {1024, 1002, 1167, -1, -1, -1, -1, -1, -1},
+    {1167, 1173, 1024, -1, -1, -1, -1, -1, -1},
+    {882, 854, 1002, -1, -1, -1, -1, -1, -1},
+    {1002, 1024, 882, -1, -1, -1, -1, -1, -1},
+    {730, 694, 854, -1, -1, -1, -1, -1, -1},
+    {854, 882, 730, -1, -1, -1, -1, -1, -1},
+    {582, 558, 694, -1, -1, -1, -1, -1, -1},
+    {694, 730, 582, -1, -1, -1, -1, -1, -1},
+    {515, 499, 558, -1, -1, -1, -1, -1, -1},
+    {558, 582, 515, -1, -1, -1, -1, -1, -1},
+    {466, 445, 499, -1, -1, -1, -1, -1, -1},
+    {499, 515, 466, -1, -1, -1, -1, -1, -1},
+    {443, 415, 445, -1, -1, -1, -1, -1, -1},
+    {445, 466, 443, -1, -1, -1, -1, -1, -1},
+    {435, 407, 415, -1, -1, -1, -1, -1, -1},
+    {415, 443, 435, -1, -1, -1, -1, -1, -1},
+    {1370, 1356, 1777, -1, -1, -1, -1, -1, -1},
+    {1777, 1775, 1370, -1, -1, -1, -1, -1, -1},
+    {1187, 1173, 1356, -1, -1, -1, -1, -1, -1},
+    {1356, 1370, 1187, -1, -1, -1, -1, -1, -1},
+    {1041, 1024, 1173, -1, -1, -1, -1, -1, -1},
+    {1173, 1187, 1041, -1, -1, -1, -1, -1, -1},
+    {904, 882, 1024, -1, -1, -1, -1, -1, -1},
+    {1024, 1041, 904, -1, -1, -1, -1, -1, -1},
+    {768, 730, 882, -1, -1, -1, -1, -1, -1},
+    {882, 904, 768, -1, -1, -1, -1, -1, -1},
+    {623, 582, 730, -1, -1, -1, -1, -1, -1},
+    {730, 768, 623, -1, -1, -1, -1, -1, -1},
+    {531, 515, 582, -1, -1, -1, -1, -1, -1},
+    {582, 623, 531, -1, -1, -1, -1, -1, -1},
+    {501, 466, 515, -1, -1, -1, -1, -1, -1},
+    {515, 531, 501, -1, -1, -1, -1, -1, -1},
+    {458, 443, 466, -1, -1, -1, -1, -1, -1},
+    {466, 501, 458, -1, -1, -1, -1, -1, -1},
+    {451, 435, 443, -1, -1, -1, -1, -1, -1},
+    {443, 458, 451, -1, -1, -1, -1, -1, -1},
+    {1382, 1370, 1775, -1, -1, -1, -1, -1, -1},
+    {1775, 1773, 1382, -1, -1, -1, -1, -1, -1},
+    {1197, 1187, 1370, -1, -1, -1, -1, -1, -1},
+    {1370, 1382, 1197, -1, -1, -1, -1, -1, -1},
+    {1067, 1041, 1187, -1, -1, -1, -1, -1, -1},
+    {1187, 1197, 1067, -1, -1, -1, -1, -1, -1},
+    {928, 904, 1041, -1, -1, -1, -1, -1, -1},
+    {1041, 1067, 928, -1, -1, -1, -1, -1, -1},
+    {796, 768, 904, -1, -1, -1, -1, -1, -1},
+    {904, 928, 796, -1, -1, -1, -1, -1, -1},
+    {664, 623, 768, -1, -1, -1, -1, -1, -1},
+    {768, 796, 664, -1, -1, -1, -1, -1, -1},
+    {568, 531, 623, -1, -1, -1, -1, -1, -1},
+    {623, 664, 568, -1, -1, -1, -1, -1, -1},
+    {519, 501, 531, -1, -1, -1, -1, -1, -1},
+    {531, 568, 519, -1, -1, -1, -1, -1, -1},
+    {503, 458, 501, -1, -1, -1, -1, -1, -1},
+    {501, 519, 503, -1, -1, -1, -1, -1, -1},
+    {497, 451, 458, -1, -1, -1, -1, -1, -1},
+    {458, 503, 497, -1, -1, -1, -1, -1, -1},
+    {1393, 1382, 1773, -1, -1, -1, -1, -1, -1},
+    {1773, 1770, 1393, -1, -1, -1, -1, -1, -1},
+    {1205, 1197, 1382, -1, -1, -1, -1, -1, -1},
+    {1382, 1393, 1205, -1, -1, -1, -1, -1, -1},
+    {1076, 1067, 1197, -1, -1, -1, -1, -1, -1},
+    {1197, 1205, 1076, -1, -1, -1, -1, -1, -1},
+    {946, 928, 1067, -1, -1, -1, -1, -1, -1},
+    {1067, 1076, 946, -1, -1, -1, -1, -1, -1},
+    {832, 796, 928, -1, -1, -1, -1, -1, -1},
+    {928, 946, 832, -1, -1, -1, -1, -1, -1},
+    {722, 664, 796, -1, -1, -1, -1, -1, -1},
+    {796, 832, 722, -1, -1, -1, -1, -1, -1},
+    {609, 568, 664, -1, -1, -1, -1, -1, -1},
+    {664, 722, 609, -1, -1, -1, -1, -1, -1},
+    {548, 519, 568, -1, -1, -1, -1, -1, -1},
+    {568, 609, 548, -1, -1, -1, -1, -1, -1},
+    {521, 503, 519, -1, -1, -1, -1, -1, -1},
+    {519, 548, 521, -1, -1, -1, -1, -1, -1},
+    {517, 497, 503, -1, -1, -1, -1, -1, -1},
+    {503, 521, 517, -1, -1, -1, -1, -1, -1},
+    {1406, 1393, 1770, -1, -1, -1, -1, -1, -1},
+    {1770, 1767, 1406, -1, -1, -1, -1, -1, -1},
+    {1215, 1205, 1393, -1, -1, -1, -1, -1, -1},
+    {1393, 1406, 1215, -1, -1, -1, -1, -1, -1},
+    {1089, 1076, 1205, -1, -1, -1, -1, -1, -1},
+    {1205, 1215, 1089, -1, -1, -1, -1, -1, -1},
+    {971, 946, 1076, -1, -1, -1, -1, -1, -1},
+    {1076, 1089, 971, -1, -1, -1, -1, -1, -1},
+    {869, 832, 946, -1, -1, -1, -1, -1, -1},
+    {946, 971, 869, -1, -1, -1, -1, -1, -1},
+    {763, 722, 832, -1, -1, -1, -1, -1, -1},
+    {832, 869, 763, -1, -1, -1, -1, -1, -1},
+    {645, 609, 722, -1, -1, -1, -1, -1, -1},
+    {722, 763, 645, -1, -1, -1, -1, -1, -1},
+    {586, 548, 609, -1, -1, -1, -1, -1, -1},
+    {609, 645, 586, -1, -1, -1, -1, -1, -1},
+    {555, 521, 548, -1, -1, -1, -1, -1, -1},
+    {548, 586, 555, -1, -1, -1, -1, -1, -1},
+    {539, 517, 521, -1, -1, -1, -1, -1, -1},
+    {521, 555, 539, -1, -1, -1, -1, -1, -1},
+    {1419, 1406, 1767, -1, -1, -1, -1, -1, -1},
+    {1767, 1763, 1419, -1, -1, -1, -1, -1, -1},
+    {1225, 1215, 1406, -1, -1, -1, -1, -1, -1},
+    {1406, 1419, 1225, -1, -1, -1, -1, -1, -1},
+    {1095, 1089, 1215, -1, -1, -1, -1, -1, -1},
+    {1215, 1225, 1095, -1, -1, -1, -1, -1, -1},
+    {989, 971, 1089, -1, -1, -1, -1, -1, -1},
+    {1089, 1095, 989, -1, -1, -1, -1, -1, -1},
+    {895, 869, 971, -1, -1, -1, -1, -1, -1},
+    {971, 989, 895, -1, -1, -1, -1, -1, -1},
+    {791, 763, 869, -1, -1, -1, -1, -1, -1},
+    {869, 895, 791, -1, -1, -1, -1, -1, -1},
+    {703, 645, 763, -1, -1, -1, -1, -1, -1},
+    {763, 791, 703, -1, -1, -1, -1, -1, -1},
+    {626, 586, 645, -1, -1, -1, -1, -1, -1},
+    {645, 703, 626, -1, -1, -1, -1, -1, -1},
+    {581, 555, 586, -1, -1, -1, -1, -1, -1},
+    {586, 626, 581, -1, -1, -1, -1, -1, -1},
+    {573, 539, 555, -1, -1, -1, -1, -1, -1},
+    {555, 581, 573, -1, -1, -1, -1, -1, -1},
+    {1425, 1419, 1763, -1, -1, -1, -1, -1, -1},
+    {1763, 1761, 1425, -1, -1, -1, -1, -1, -1},
+    {1229, 1225, 1419, -1, -1, -1, -1, -1, -1},
+    {1419, 1425, 1229, -1, -1, -1, -1, -1, -1},
+    {1100, 1095, 1225, -1, -1, -1, -1, -1, -1},
+    {1225, 1229, 1100, -1, -1, -1, -1, -1, -1},
+    {1005, 989, 1095, -1, -1, -1, -1, -1, -1},
+    {1095, 1100, 1005, -1, -1, -1, -1, -1, -1},
+    {906, 895, 989, -1, -1, -1, -1, -1, -1},
+    {989, 1005, 906, -1, -1, -1, -1, -1, -1},
+    {811, 791, 895, -1, -1, -1, -1, -1, -1},
+    {895, 906, 811, -1, -1, -1, -1, -1, -1},
+    {727, 703, 791, -1, -1, -1, -1, -1, -1},
+    {791, 811, 727, -1, -1, -1, -1, -1, -1},
+    {643, 626, 703, -1, -1, -1, -1, -1, -1},
+    {703, 727, 643, -1, -1, -1, -1, -1, -1},
+    {606, 581, 626, -1, -1, -1, -1, -1, -1},
+    {626, 643, 606, -1, -1, -1, -1, -1, -1},
+    {591, 573, 581, -1, -1, -1, -1, -1, -1},
+    {581, 606, 591, -1, -1, -1, -1, -1, -1},
+    {1429, 1425, 1761, -1, -1, -1, -1, -1, -1},
+    {1761, 1757, 1429, -1, -1, -1, -1, -1, -1},
+    {1233, 1229, 1425, -1, -1, -1, -1, -1, -1},
+    {1425, 1429, 1233, -1, -1, -1, -1, -1, -1},
+    {1106, 1100, 1229, -1, -1, -1, -1, -1, -1},
+    {1229, 1233, 1106, -1, -1, -1, -1, -1, -1},
+    {1011, 1005, 1100, -1, -1, -1, -1, -1, -1},
+    {1100, 1106, 1011, -1, -1, -1, -1, -1, -1},
+    {911, 906, 1005, -1, -1, -1, -1, -1, -1},
+    {1005, 1011, 911, -1, -1, -1, -1, -1, -1},
+    {818, 811, 906, -1, -1, -1, -1, -1, -1},
+    {906, 911, 818, -1, -1, -1, -1, -1, -1},
+    {737, 727, 811, -1, -1, -1, -1, -1, -1},
+    {811, 818, 737, -1, -1, -1, -1, -1, -1},
+    {650, 643, 727, -1, -1, -1, -1, -1, -1},
+    {727, 737, 650, -1, -1, -1, -1, -1, -1},
+    {617, 606, 643, -1, -1, -1, -1, -1, -1},
+    {643, 650, 617, -1, -1, -1, -1, -1, -1},
+    {600, 591, 606, -1, -1, -1, -1, -1, -1},
+    {606, 617, 600, -1, -1, -1, -1, -1, -1},
+    {404, 396, 375, -1, -1, -1, -1, -1, -1},
+    {375, 387, 404, -1, -1, -1, -1, -1, -1},
+    {438, 429, 396, -1, -1, -1, -1, -1, -1},
+    {396, 404, 438, -1, -1, -1, -1, -1, -1},
+    {490, 485, 429, -1, -1, -1, -1, -1, -1},
+    {429, 438, 490, -1, -1, -1, -1, -1, -1},
+    {542, 535, 485, -1, -1, -1, -1, -1, -1},
+    {485, 490, 542, -1, -1, -1, -1, -1, -1},
+    {669, 660, 535, -1, -1, -1, -1, -1, -1},
+    {535, 542, 669, -1, -1, -1, -1, -1, -1},
+    {845, 838, 660, -1, -1, -1, -1, -1, -1},
+    {660, 669, 845, -1, -1, -1, -1, -1, -1},
+    {993, 979, 838, -1, -1, -1, -1, -1, -1},
+    {838, 845, 993, -1, -1, -1, -1, -1, -1},
+    {1162, 1157, 979, -1, -1, -1, -1, -1, -1},
+    {979, 993, 1162, -1, -1, -1, -1, -1, -1},
+    {1329, 1324, 1157, -1, -1, -1, -1, -1, -1},
+    {1157, 1162, 1329, -1, -1, -1, -1, -1, -1},
+    {1925, 1785, 1324, -1, -1, -1, -1, -1, -1},
+    {1324, 1329, 1925, -1, -1, -1, -1, -1, -1},
+    {416, 404, 387, -1, -1, -1, -1, -1, -1},
+    {387, 408, 416, -1, -1, -1, -1, -1, -1},
+    {446, 438, 404, -1, -1, -1, -1, -1, -1},
+    {404, 416, 446, -1, -1, -1, -1, -1, -1},
+    {500, 490, 438, -1, -1, -1, -1, -1, -1},
+    {438, 446, 500, -1, -1, -1, -1, -1, -1},
+    {559, 542, 490, -1, -1, -1, -1, -1, -1},
+    {490, 500, 559, -1, -1, -1, -1, -1, -1},
+    {695, 669, 542, -1, -1, -1, -1, -1, -1},
+    {542, 559, 695, -1, -1, -1, -1, -1, -1},
+    {855, 845, 669, -1, -1, -1, -1, -1, -1},
+    {669, 695, 855, -1, -1, -1, -1, -1, -1},
+    {1003, 993, 845, -1, -1, -1, -1, -1, -1},
+    {845, 855, 1003, -1, -1, -1, -1, -1, -1},
+    {1168, 1162, 993, -1, -1, -1, -1, -1, -1},
+    {993, 1003, 1168, -1, -1, -1, -1, -1, -1},
+    {1339, 1329, 1162, -1, -1, -1, -1, -1, -1},
+    {1162, 1168, 1339, -1, -1, -1, -1, -1, -1},
+    {1924, 1925, 1329, -1, -1, -1, -1, -1, -1},
+    {1329, 1339, 1924, -1, -1, -1, -1, -1, -1},
+    {444, 416, 408, -1, -1, -1, -1, -1, -1},
+    {408, 436, 444, -1, -1, -1, -1, -1, -1},
+    {467, 446, 416, -1, -1, -1, -1, -1, -1},
+    {416, 444, 467, -1, -1, -1, -1, -1, -1},
+    {516, 500, 446, -1, -1, -1, -1, -1, -1},
+    {446, 467, 516, -1, -1, -1, -1, -1, -1},
+    {583, 559, 500, -1, -1, -1, -1, -1, -1},
+    {500, 516, 583, -1, -1, -1, -1, -1, -1},
+    {731, 695, 559, -1, -1, -1, -1, -1, -1},
+    {559, 583, 731, -1, -1, -1, -1, -1, -1},
+    {883, 855, 695, -1, -1, -1, -1, -1, -1},
+    {695, 731, 883, -1, -1, -1, -1, -1, -1},
+    {1025, 1003, 855, -1, -1, -1, -1, -1, -1},
+    {855, 883, 1025, -1, -1, -1, -1, -1, -1},
+    {1174, 1168, 1003, -1, -1, -1, -1, -1, -1},
+    {1003, 1025, 1174, -1, -1, -1, -1, -1, -1},
+    {1357, 1339, 1168, -1, -1, -1, -1, -1, -1},
+    {1168, 1174, 1357, -1, -1, -1, -1, -1, -1},
+    {1907, 1924, 1339, -1, -1, -1, -1, -1, -1},
+    {1339, 1357, 1907, -1, -1, -1, -1, -1, -1},
+    {459, 444, 436, -1, -1, -1, -1, -1, -1},
+    {436, 452, 459, -1, -1, -1, -1, -1, -1},
+    {502, 467, 444, -1, -1, -1, -1, -1, -1},
+    {444, 459, 502, -1, -1, -1, -1, -1, -1},
+    {532, 516, 467, -1, -1, -1, -1, -1, -1},
+    {467, 502, 532, -1, -1, -1, -1, -1, -1},
+    {624, 583, 516, -1, -1, -1, -1, -1, -1},
+    {516, 532, 624, -1, -1, -1, -1, -1, -1},
+    {769, 731, 583, -1, -1, -1, -1, -1, -1},
+    {583, 624, 769, -1, -1, -1, -1, -1, -1},
+    {905, 883, 731, -1, -1, -1, -1, -1, -1},
+    {731, 769, 905, -1, -1, -1, -1, -1, -1},
+    {1040, 1025, 883, -1, -1, -1, -1, -1, -1},
+    {883, 905, 1040, -1, -1, -1, -1, -1, -1},
+    {1188, 1174, 1025, -1, -1, -1, -1, -1, -1},
+    {1025, 1040, 1188, -1, -1, -1, -1, -1, -1},
+    {1371, 1357, 1174, -1, -1, -1, -1, -1, -1},
+    {1174, 1188, 1371, -1, -1, -1, -1, -1, -1},
+    {1705, 1907, 1357, -1, -1, -1, -1, -1, -1},
+    {1357, 1371, 1705, -1, -1, -1, -1, -1, -1},
+    {504, 459, 452, -1, -1, -1, -1, -1, -1},
+    {452, 498, 504, -1, -1, -1, -1, -1, -1},
+    {520, 502, 459, -1, -1, -1, -1, -1, -1},
+    {459, 504, 520, -1, -1, -1, -1, -1, -1},
+    {569, 532, 502, -1, -1, -1, -1, -1, -1},
+    {502, 520, 569, -1, -1, -1, -1, -1, -1},
+    {665, 624, 532, -1, -1, -1, -1, -1, -1},
+    {532, 569, 665, -1, -1, -1, -1, -1, -1},
+    {797, 769, 624, -1, -1, -1, -1, -1, -1},
+    {624, 665, 797, -1, -1, -1, -1, -1, -1},
+    {929, 905, 769, -1, -1, -1, -1, -1, -1},
+    {769, 797, 929, -1, -1, -1, -1, -1, -1},
+    {1066, 1040, 905, -1, -1, -1, -1, -1, -1},
+    {905, 929, 1066, -1, -1, -1, -1, -1, -1},
+    {1198, 1188, 1040, -1, -1, -1, -1, -1, -1},
+    {1040, 1066, 1198, -1, -1, -1, -1, -1, -1},
+    {1383, 1371, 1188, -1, -1, -1, -1, -1, -1},
+    {1188, 1198, 1383, -1, -1, -1, -1, -1, -1},
+    {1704, 1705, 1371, -1, -1, -1, -1, -1, -1},
+    {1371, 1383, 1704, -1, -1, -1, -1, -1, -1},
+    {522, 504, 498, -1, -1, -1, -1, -1, -1},
+    {498, 518, 522, -1, -1, -1, -1, -1, -1},
+    {549, 520, 504, -1, -1, -1, -1, -1, -1},
+    {504, 522, 549, -1, -1, -1, -1, -1, -1},
+    {610, 569, 520, -1, -1, -1, -1, -1, -1},
+    {520, 549, 610, -1, -1, -1, -1, -1, -1},
+    {723, 665, 569, -1, -1, -1, -1, -1, -1},
+    {569, 610, 723, -1, -1, -1, -1, -1, -1},
+    {833, 797, 665, -1, -1, -1, -1, -1, -1},
+    {665, 723, 833, -1, -1, -1, -1, -1, -1},
+    {947, 929, 797, -1, -1, -1, -1, -1, -1},
+    {797, 833, 947, -1, -1, -1, -1, -1, -1},
+    {1077, 1066, 929, -1, -1, -1, -1, -1, -1},
+    {929, 947, 1077, -1, -1, -1, -1, -1, -1},
+    {1206, 1198, 1066, -1, -1, -1, -1, -1, -1},
+    {1066, 1077, 1206, -1, -1, -1, -1, -1, -1},
+    {1394, 1383, 1198, -1, -1, -1, -1, -1, -1},
+    {1198, 1206, 1394, -1, -1, -1, -1, -1, -1},
+    {1772, 1704, 1383, -1, -1, -1, -1, -1, -1},
+    {1383, 1394, 1772, -1, -1, -1, -1, -1, -1},
+    {554, 522, 518, -1, -1, -1, -1, -1, -1},
+    {518, 540, 554, -1, -1, -1, -1, -1, -1},
+    {587, 549, 522, -1, -1, -1, -1, -1, -1},
+    {522, 554, 587, -1, -1, -1, -1, -1, -1},
+    {644, 610, 549, -1, -1, -1, -1, -1, -1},
+    {549, 587, 644, -1, -1, -1, -1, -1, -1},
+    {762, 723, 610, -1, -1, -1, -1, -1, -1},
+    {610, 644, 762, -1, -1, -1, -1, -1, -1},
+    {868, 833, 723, -1, -1, -1, -1, -1, -1},
+    {723, 762, 868, -1, -1, -1, -1, -1, -1},
+    {970, 947, 833, -1, -1, -1, -1, -1, -1},
+    {833, 868, 970, -1, -1, -1, -1, -1, -1},
+    {1088, 1077, 947, -1, -1, -1, -1, -1, -1},
+    {947, 970, 1088, -1, -1, -1, -1, -1, -1},
+    {1216, 1206, 1077, -1, -1, -1, -1, -1, -1},
+    {1077, 1088, 1216, -1, -1, -1, -1, -1, -1},
+    {1405, 1394, 1206, -1, -1, -1, -1, -1, -1},
+    {1206, 1216, 1405, -1, -1, -1, -1, -1, -1},
+    {1691, 1772, 1394, -1, -1, -1, -1, -1, -1},
+    {1394, 1405, 1691, -1, -1, -1, -1, -1, -1},
+    {580, 554, 540, -1, -1, -1, -1, -1, -1},
+    {540, 572, 580, -1, -1, -1, -1, -1, -1},
+    {625, 587, 554, -1, -1, -1, -1, -1, -1},
+    {554, 580, 625, -1, -1, -1, -1, -1, -1},
+    {702, 644, 587, -1, -1, -1, -1, -1, -1},
+    {587, 625, 702, -1, -1, -1, -1, -1, -1},
+    {790, 762, 644, -1, -1, -1, -1, -1, -1},
+    {644, 702, 790, -1, -1, -1, -1, -1, -1},
+    {894, 868, 762, -1, -1, -1, -1, -1, -1},
+    {762, 790, 894, -1, -1, -1, -1, -1, -1},
+    {988, 970, 868, -1, -1, -1, -1, -1, -1},
+    {868, 894, 988, -1, -1, -1, -1, -1, -1},
+    {1094, 1088, 970, -1, -1, -1, -1, -1, -1},
+    {970, 988, 1094, -1, -1, -1, -1, -1, -1},
+    {1226, 1216, 1088, -1, -1, -1, -1, -1, -1},
+    {1088, 1094, 1226, -1, -1, -1, -1, -1, -1},
+    {1420, 1405, 1216, -1, -1, -1, -1, -1, -1},
+    {1216, 1226, 1420, -1, -1, -1, -1, -1, -1},
+    {1765, 1691, 1405, -1, -1, -1, -1, -1, -1},
+    {1405, 1420, 1765, -1, -1, -1, -1, -1, -1},
+    {605, 580, 572, -1, -1, -1, -1, -1, -1},
+    {572, 590, 605, -1, -1, -1, -1, -1, -1},
+    {642, 625, 580, -1, -1, -1, -1, -1, -1},
+    {580, 605, 642, -1, -1, -1, -1, -1, -1},
+    {726, 702, 625, -1, -1, -1, -1, -1, -1},
+    {625, 642, 726, -1, -1, -1, -1, -1, -1},
+    {810, 790, 702, -1, -1, -1, -1, -1, -1},
+    {702, 726, 810, -1, -1, -1, -1, -1, -1},
+    {907, 894, 790, -1, -1, -1, -1, -1, -1},
+    {790, 810, 907, -1, -1, -1, -1, -1, -1},
+    {1004, 988, 894, -1, -1, -1, -1, -1, -1},
+    {894, 907, 1004, -1, -1, -1, -1, -1, -1},
+    {1099, 1094, 988, -1, -1, -1, -1, -1, -1},
+    {988, 1004, 1099, -1, -1, -1, -1, -1, -1},
+    {1230, 1226, 1094, -1, -1, -1, -1, -1, -1},
+    {1094, 1099, 1230, -1, -1, -1, -1, -1, -1},
+    {1426, 1420, 1226, -1, -1, -1, -1, -1, -1},
+    {1226, 1230, 1426, -1, -1, -1, -1, -1, -1},
+    {1896, 1765, 1420, -1, -1, -1, -1, -1, -1},
+    {1420, 1426, 1896, -1, -1, -1, -1, -1, -1},
+    {614, 605, 590, -1, -1, -1, -1, -1, -1},
+    {590, 597, 614, -1, -1, -1, -1, -1, -1},
+    {652, 642, 605, -1, -1, -1, -1, -1, -1},
+    {605, 614, 652, -1, -1, -1, -1, -1, -1},
+    {734, 726, 642, -1, -1, -1, -1, -1, -1},
+    {642, 652, 734, -1, -1, -1, -1, -1, -1},
+    {819, 810, 726, -1, -1, -1, -1, -1, -1},
+    {726, 734, 819, -1, -1, -1, -1, -1, -1},
+    {912, 907, 810, -1, -1, -1, -1, -1, -1},
+    {810, 819, 912, -1, -1, -1, -1, -1, -1},
+    {1012, 1004, 907, -1, -1, -1, -1, -1, -1},
+    {907, 912, 1012, -1, -1, -1, -1, -1, -1},
+    {1102, 1099, 1004, -1, -1, -1, -1, -1, -1},
+    {1004, 1012, 1102, -1, -1, -1, -1, -1, -1},
+    {1235, 1230, 1099, -1, -1, -1, -1, -1, -1},
+    {1099, 1102, 1235, -1, -1, -1, -1, -1, -1},
+    {1431, 1426, 1230, -1, -1, -1, -1, -1, -1},
+    {1230, 1235, 1431, -1, -1, -1, -1, -1, -1},
+    {1759, 1896, 1426, -1, -1, -1, -1, -1, -1},
+    {1426, 1431, 1759, -1, -1, -1, -1, -1, -1},
+    {2293, 2298, 1785, -1, -1, -1, -1, -1, -1},
+    {1785, 1782, 2293, -1, -1, -1, -1, -1, -1},
+    {2460, 2465, 2298, -1, -1, -1, -1, -1, -1},
+    {2298, 2293, 2460, -1, -1, -1, -1, -1, -1},
+    {2629, 2640, 2465, -1, -1, -1, -1, -1, -1},
+    {2465, 2460, 2629, -1, -1, -1, -1, -1, -1},
+    {2777, 2784, 2640, -1, -1, -1, -1, -1, -1},
+    {2640, 2629, 2777, -1, -1, -1, -1, -1, -1},
+    {2953, 2962, 2784, -1, -1, -1, -1, -1, -1},
+    {2784, 2777, 2953, -1, -1, -1, -1, -1, -1},
+    {3060, 3067, 2962, -1, -1, -1, -1, -1, -1},
+    {2962, 2953, 3060, -1, -1, -1, -1, -1, -1},
+    {3134, 3139, 3067, -1, -1, -1, -1, -1, -1},
+    {3067, 3060, 3134, -1, -1, -1, -1, -1, -1},
+    {3166, 3175, 3139, -1, -1, -1, -1, -1, -1},
+    {3139, 3134, 3166, -1, -1, -1, -1, -1, -1},
+    {3194, 3202, 3175, -1, -1, -1, -1, -1, -1},
+    {3175, 3166, 3194, -1, -1, -1, -1, -1, -1},
+    {3207, 3212, 3202, -1, -1, -1, -1, -1, -1},
+    {3202, 3194, 3207, -1, -1, -1, -1, -1, -1},
+    {2283, 2293, 1782, -1, -1, -1, -1, -1, -1},
+    {1782, 1780, 2283, -1, -1, -1, -1, -1, -1},
+    {2454, 2460, 2293, -1, -1, -1, -1, -1, -1},
+    {2293, 2283, 2454, -1, -1, -1, -1, -1, -1},
+    {2619, 2629, 2460, -1, -1, -1, -1, -1, -1},
+    {2460, 2454, 2619, -1, -1, -1, -1, -1, -1},
+    {2767, 2777, 2629, -1, -1, -1, -1, -1, -1},
+    {2629, 2619, 2767, -1, -1, -1, -1, -1, -1},
+    {2927, 2953, 2777, -1, -1, -1, -1, -1, -1},
+    {2777, 2767, 2927, -1, -1, -1, -1, -1, -1},
+    {3050, 3060, 2953, -1, -1, -1, -1, -1, -1},
+    {2953, 2927, 3050, -1, -1, -1, -1, -1, -1},
+    {3124, 3134, 3060, -1, -1, -1, -1, -1, -1},
+    {3060, 3050, 3124, -1, -1, -1, -1, -1, -1},
+    {3158, 3166, 3134, -1, -1, -1, -1, -1, -1},
+    {3134, 3124, 3158, -1, -1, -1, -1, -1, -1},
+    {3180, 3194, 3166, -1, -1, -1, -1, -1, -1},
+    {3166, 3158, 3180, -1, -1, -1, -1, -1, -1},
+    {3190, 3207, 3194, -1, -1, -1, -1, -1, -1},
+    {3194, 3180, 3190, -1, -1, -1, -1, -1, -1},
+    {2265, 2283, 1780, -1, -1, -1, -1, -1, -1},
+    {1780, 1778, 2265, -1, -1, -1, -1, -1, -1},
+    {2448, 2454, 2283, -1, -1, -1, -1, -1, -1},
+    {2283, 2265, 2448, -1, -1, -1, -1, -1, -1},
+    {2597, 2619, 2454, -1, -1, -1, -1, -1, -1},
+    {2454, 2448, 2597, -1, -1, -1, -1, -1, -1},
+    {2739, 2767, 2619, -1, -1, -1, -1, -1, -1},
+    {2619, 2597, 2739, -1, -1, -1, -1, -1, -1},
+    {2891, 2927, 2767, -1, -1, -1, -1, -1, -1},
+    {2767, 2739, 2891, -1, -1, -1, -1, -1, -1},
+    {3032, 3050, 2927, -1, -1, -1, -1, -1, -1},
+    {2927, 2891, 3032, -1, -1, -1, -1, -1, -1},
+    {3086, 3124, 3050, -1, -1, -1, -1, -1, -1},
+    {3050, 3032, 3086, -1, -1, -1, -1, -1, -1},
+    {3144, 3158, 3124, -1, -1, -1, -1, -1, -1},
+    {3124, 3086, 3144, -1, -1, -1, -1, -1, -1},
+    {3160, 3180, 3158, -1, -1, -1, -1, -1, -1},
+    {3158, 3144, 3160, -1, -1, -1, -1, -1, -1},
+    {3168, 3190, 3180, -1, -1, -1, -1, -1, -1},
+    {3180, 3160, 3168, -1, -1, -1, -1, -1, -1},
+    {2251, 2265, 1778, -1, -1, -1, -1, -1, -1},
+    {1778, 1776, 2251, -1, -1, -1, -1, -1, -1},
+    {2434, 2448, 2265, -1, -1, -1, -1, -1, -1},
+    {2265, 2251, 2434, -1, -1, -1, -1, -1, -1},
+    {2580, 2597, 2448, -1, -1, -1, -1, -1, -1},
+    {2448, 2434, 2580, -1, -1, -1, -1, -1, -1},
+    {2717, 2739, 2597, -1, -1, -1, -1, -1, -1},
+    {2597, 2580, 2717, -1, -1, -1, -1, -1, -1},
+    {2853, 2891, 2739, -1, -1, -1, -1, -1, -1},
+    {2739, 2717, 2853, -1, -1, -1, -1, -1, -1},
+    {2998, 3032, 2891, -1, -1, -1, -1, -1, -1},
+    {2891, 2853, 2998, -1, -1, -1, -1, -1, -1},
+    {3070, 3086, 3032, -1, -1, -1, -1, -1, -1},
+    {3032, 2998, 3070, -1, -1, -1, -1, -1, -1},
+    {3122, 3144, 3086, -1, -1, -1, -1, -1, -1},
+    {3086, 3070, 3122, -1, -1, -1, -1, -1, -1},
+    {3146, 3160, 3144, -1, -1, -1, -1, -1, -1},
+    {3144, 3122, 3146, -1, -1, -1, -1, -1, -1},
+    {3152, 3168, 3160, -1, -1, -1, -1, -1, -1},
+    {3160, 3146, 3152, -1, -1, -1, -1, -1, -1},
+    {2239, 2251, 1776, -1, -1, -1, -1, -1, -1},
+    {1776, 1774, 2239, -1, -1, -1, -1, -1, -1},
+    {2424, 2434, 2251, -1, -1, -1, -1, -1, -1},
+    {2251, 2239, 2424, -1, -1, -1, -1, -1, -1},
+    {2554, 2580, 2434, -1, -1, -1, -1, -1, -1},
+    {2434, 2424, 2554, -1, -1, -1, -1, -1, -1},
+    {2693, 2717, 2580, -1, -1, -1, -1, -1, -1},
+    {2580, 2554, 2693, -1, -1, -1, -1, -1, -1},
+    {2825, 2853, 2717, -1, -1, -1, -1, -1, -1},
+    {2717, 2693, 2825, -1, -1, -1, -1, -1, -1},
+    {2957, 2998, 2853, -1, -1, -1, -1, -1, -1},
+    {2853, 2825, 2957, -1, -1, -1, -1, -1, -1},
+    {3042, 3070, 2998, -1, -1, -1, -1, -1, -1},
+    {2998, 2957, 3042, -1, -1, -1, -1, -1, -1},
+    {3082, 3122, 3070, -1, -1, -1, -1, -1, -1},
+    {3070, 3042, 3082, -1, -1, -1, -1, -1, -1},
+    {3120, 3146, 3122, -1, -1, -1, -1, -1, -1},
+    {3122, 3082, 3120, -1, -1, -1, -1, -1, -1},
+    {3126, 3152, 3146, -1, -1, -1, -1, -1, -1},
+    {3146, 3120, 3126, -1, -1, -1, -1, -1, -1},
+    {2228, 2239, 1774, -1, -1, -1, -1, -1, -1},
+    {1774, 1771, 2228, -1, -1, -1, -1, -1, -1},
+    {2416, 2424, 2239, -1, -1, -1, -1, -1, -1},
+    {2239, 2228, 2416, -1, -1, -1, -1, -1, -1},
+    {2545, 2554, 2424, -1, -1, -1, -1, -1, -1},
+    {2424, 2416, 2545, -1, -1, -1, -1, -1, -1},
+    {2675, 2693, 2554, -1, -1, -1, -1, -1, -1},
+    {2554, 2545, 2675, -1, -1, -1, -1, -1, -1},
+    {2789, 2825, 2693, -1, -1, -1, -1, -1, -1},
+    {2693, 2675, 2789, -1, -1, -1, -1, -1, -1},
+    {2899, 2957, 2825, -1, -1, -1, -1, -1, -1},
+    {2825, 2789, 2899, -1, -1, -1, -1, -1, -1},
+    {3012, 3042, 2957, -1, -1, -1, -1, -1, -1},
+    {2957, 2899, 3012, -1, -1, -1, -1, -1, -1},
+    {3056, 3082, 3042, -1, -1, -1, -1, -1, -1},
+    {3042, 3012, 3056, -1, -1, -1, -1, -1, -1},
+    {3080, 3120, 3082, -1, -1, -1, -1, -1, -1},
+    {3082, 3056, 3080, -1, -1, -1, -1, -1, -1},
+    {3084, 3126, 3120, -1, -1, -1, -1, -1, -1},
+    {3120, 3080, 3084, -1, -1, -1, -1, -1, -1},
+    {2215, 2228, 1771, -1, -1, -1, -1, -1, -1},
+    {1771, 1768, 2215, -1, -1, -1, -1, -1, -1},
+    {2406, 2416, 2228, -1, -1, -1, -1, -1, -1},
+    {2228, 2215, 2406, -1, -1, -1, -1, -1, -1},
+    {2532, 2545, 2416, -1, -1, -1, -1, -1, -1},
+    {2416, 2406, 2532, -1, -1, -1, -1, -1, -1},
+    {2650, 2675, 2545, -1, -1, -1, -1, -1, -1},
+    {2545, 2532, 2650, -1, -1, -1, -1, -1, -1},
+    {2752, 2789, 2675, -1, -1, -1, -1, -1, -1},
+    {2675, 2650, 2752, -1, -1, -1, -1, -1, -1},
+    {2858, 2899, 2789, -1, -1, -1, -1, -1, -1},
+    {2789, 2752, 2858, -1, -1, -1, -1, -1, -1},
+    {2976, 3012, 2899, -1, -1, -1, -1, -1, -1},
+    {2899, 2858, 2976, -1, -1, -1, -1, -1, -1},
+    {3028, 3056, 3012, -1, -1, -1, -1, -1, -1},
+    {3012, 2976, 3028, -1, -1, -1, -1, -1, -1},
+    {3051, 3080, 3056, -1, -1, -1, -1, -1, -1},
+    {3056, 3028, 3051, -1, -1, -1, -1, -1, -1},
+    {3062, 3084, 3080, -1, -1, -1, -1, -1, -1},
+    {3080, 3051, 3062, -1, -1, -1, -1, -1, -1},
+    {2202, 2215, 1768, -1, -1, -1, -1, -1, -1},
+    {1768, 1766, 2202, -1, -1, -1, -1, -1, -1},
+    {2396, 2406, 2215, -1, -1, -1, -1, -1, -1},
+    {2215, 2202, 2396, -1, -1, -1, -1, -1, -1},
+    {2526, 2532, 2406, -1, -1, -1, -1, -1, -1},
+    {2406, 2396, 2526, -1, -1, -1, -1, -1, -1},
+    {2632, 2650, 2532, -1, -1, -1, -1, -1, -1},
+    {2532, 2526, 2632, -1, -1, -1, -1, -1, -1},
+    {2726, 2752, 2650, -1, -1, -1, -1, -1, -1},
+    {2650, 2632, 2726, -1, -1, -1, -1, -1, -1},
+    {2830, 2858, 2752, -1, -1, -1, -1, -1, -1},
+    {2752, 2726, 2830, -1, -1, -1, -1, -1, -1},
+    {2918, 2976, 2858, -1, -1, -1, -1, -1, -1},
+    {2858, 2830, 2918, -1, -1, -1, -1, -1, -1},
+    {2995, 3028, 2976, -1, -1, -1, -1, -1, -1},
+    {2976, 2918, 2995, -1, -1, -1, -1, -1, -1},
+    {3033, 3051, 3028, -1, -1, -1, -1, -1, -1},
+    {3028, 2995, 3033, -1, -1, -1, -1, -1, -1},
+    {3037, 3062, 3051, -1, -1, -1, -1, -1, -1},
+    {3051, 3033, 3037, -1, -1, -1, -1, -1, -1},
+    {2196, 2202, 1766, -1, -1, -1, -1, -1, -1},
+    {1766, 1762, 2196, -1, -1, -1, -1, -1, -1},
+    {2392, 2396, 2202, -1, -1, -1, -1, -1, -1},
+    {2202, 2196, 2392, -1, -1, -1, -1, -1, -1},
+    {2521, 2526, 2396, -1, -1, -1, -1, -1, -1},
+    {2396, 2392, 2521, -1, -1, -1, -1, -1, -1},
+    {2616, 2632, 2526, -1, -1, -1, -1, -1, -1},
+    {2526, 2521, 2616, -1, -1, -1, -1, -1, -1},
+    {2715, 2726, 2632, -1, -1, -1, -1, -1, -1},
+    {2632, 2616, 2715, -1, -1, -1, -1, -1, -1},
+    {2810, 2830, 2726, -1, -1, -1, -1, -1, -1},
+    {2726, 2715, 2810, -1, -1, -1, -1, -1, -1},
+    {2894, 2918, 2830, -1, -1, -1, -1, -1, -1},
+    {2830, 2810, 2894, -1, -1, -1, -1, -1, -1},
+    {2978, 2995, 2918, -1, -1, -1, -1, -1, -1},
+    {2918, 2894, 2978, -1, -1, -1, -1, -1, -1},
+    {3015, 3033, 2995, -1, -1, -1, -1, -1, -1},
+    {2995, 2978, 3015, -1, -1, -1, -1, -1, -1},
+    {3025, 3037, 3033, -1, -1, -1, -1, -1, -1},
+    {3033, 3015, 3025, -1, -1, -1, -1, -1, -1},
+    {2192, 2196, 1762, -1, -1, -1, -1, -1, -1},
+    {1762, 1760, 2192, -1, -1, -1, -1, -1, -1},
+    {2388, 2392, 2196, -1, -1, -1, -1, -1, -1},
+    {2196, 2192, 2388, -1, -1, -1, -1, -1, -1},
+    {2515, 2521, 2392, -1, -1, -1, -1, -1, -1},
+    {2392, 2388, 2515, -1, -1, -1, -1, -1, -1},
+    {2609, 2616, 2521, -1, -1, -1, -1, -1, -1},
+    {2521, 2515, 2609, -1, -1, -1, -1, -1, -1},
+    {2709, 2715, 2616, -1, -1, -1, -1, -1, -1},
+    {2616, 2609, 2709, -1, -1, -1, -1, -1, -1},
+    {2802, 2810, 2715, -1, -1, -1, -1, -1, -1},
+    {2715, 2709, 2802, -1, -1, -1, -1, -1, -1},
+    {2884, 2894, 2810, -1, -1, -1, -1, -1, -1},
+    {2810, 2802, 2884, -1, -1, -1, -1, -1, -1},
+    {2970, 2978, 2894, -1, -1, -1, -1, -1, -1},
+    {2894, 2884, 2970, -1, -1, -1, -1, -1, -1},
+    {3004, 3015, 2978, -1, -1, -1, -1, -1, -1},
+    {2978, 2970, 3004, -1, -1, -1, -1, -1, -1},
+    {3021, 3025, 3015, -1, -1, -1, -1, -1, -1},
+    {3015, 3004, 3021, -1, -1, -1, -1, -1, -1},
+    {460, 544, 543, -1, -1, -1, -1, -1, -1},
+    {543, 455, 460, -1, -1, -1, -1, -1, -1},
+    {462, 550, 544, -1, -1, -1, -1, -1, -1},
+    {544, 460, 462, -1, -1, -1, -1, -1, -1},
+    {464, 556, 550, -1, -1, -1, -1, -1, -1},
+    {550, 462, 464, -1, -1, -1, -1, -1, -1},
+    {468, 566, 556, -1, -1, -1, -1, -1, -1},
+    {556, 464, 468, -1, -1, -1, -1, -1, -1},
+    {470, 574, 566, -1, -1, -1, -1, -1, -1},
+    {566, 468, 470, -1, -1, -1, -1, -1, -1},
+    {472, 576, 574, -1, -1, -1, -1, -1, -1},
+    {574, 470, 472, -1, -1, -1, -1, -1, -1},
+    {474, 588, 576, -1, -1, -1, -1, -1, -1},
+    {576, 472, 474, -1, -1, -1, -1, -1, -1},
+    {476, 592, 588, -1, -1, -1, -1, -1, -1},
+    {588, 474, 476, -1, -1, -1, -1, -1, -1},
+    {478, 594, 592, -1, -1, -1, -1, -1, -1},
+    {592, 476, 478, -1, -1, -1, -1, -1, -1},
+    {480, 598, 594, -1, -1, -1, -1, -1, -1},
+    {594, 478, 480, -1, -1, -1, -1, -1, -1},
+    {388, 460, 455, -1, -1, -1, -1, -1, -1},
+    {455, 391, 388, -1, -1, -1, -1, -1, -1},
+    {385, 462, 460, -1, -1, -1, -1, -1, -1},
+    {460, 388, 385, -1, -1, -1, -1, -1, -1},
+    {378, 464, 462, -1, -1, -1, -1, -1, -1},
+    {462, 385, 378, -1, -1, -1, -1, -1, -1},
+    {372, 468, 464, -1, -1, -1, -1, -1, -1},
+    {464, 378, 372, -1, -1, -1, -1, -1, -1},
+    {370, 470, 468, -1, -1, -1, -1, -1, -1},
+    {468, 372, 370, -1, -1, -1, -1, -1, -1},
+    {368, 472, 470, -1, -1, -1, -1, -1, -1},
+    {470, 370, 368, -1, -1, -1, -1, -1, -1},
+    {365, 474, 472, -1, -1, -1, -1, -1, -1},
+    {472, 368, 365, -1, -1, -1, -1, -1, -1},
+    {363, 476, 474, -1, -1, -1, -1, -1, -1},
+    {474, 365, 363, -1, -1, -1, -1, -1, -1},
+    {361, 478, 476, -1, -1, -1, -1, -1, -1},
+    {476, 363, 361, -1, -1, -1, -1, -1, -1},
+    {360, 480, 478, -1, -1, -1, -1, -1, -1},
+    {478, 361, 360, -1, -1, -1, -1, -1, -1},
+    {334, 388, 391, -1, -1, -1, -1, -1, -1},
+    {391, 336, 334, -1, -1, -1, -1, -1, -1},
+    {332, 385, 388, -1, -1, -1, -1, -1, -1},
+    {388, 334, 332, -1, -1, -1, -1, -1, -1},
+    {330, 378, 385, -1, -1, -1, -1, -1, -1},
+    {385, 332, 330, -1, -1, -1, -1, -1, -1},
+    {328, 372, 378, -1, -1, -1, -1, -1, -1},
+    {378, 330, 328, -1, -1, -1, -1, -1, -1},
+    {327, 370, 372, -1, -1, -1, -1, -1, -1},
+    {372, 328, 327, -1, -1, -1, -1, -1, -1},
+    {324, 368, 370, -1, -1, -1, -1, -1, -1},
+    {370, 327, 324, -1, -1, -1, -1, -1, -1},
+    {322, 365, 368, -1, -1, -1, -1, -1, -1},
+    {368, 324, 322, -1, -1, -1, -1, -1, -1},
+    {320, 363, 365, -1, -1, -1, -1, -1, -1},
+    {365, 322, 320, -1, -1, -1, -1, -1, -1},
+    {318, 361, 363, -1, -1, -1, -1, -1, -1},
+    {363, 320, 318, -1, -1, -1, -1, -1, -1},
+    {315, 360, 361, -1, -1, -1, -1, -1, -1},
+    {361, 318, 315, -1, -1, -1, -1, -1, -1},
+    {297, 334, 336, -1, -1, -1, -1, -1, -1},
+    {336, 301, 297, -1, -1, -1, -1, -1, -1},
+    {289, 332, 334, -1, -1, -1, -1, -1, -1},
+    {334, 297, 289, -1, -1, -1, -1, -1, -1},
+    {287, 330, 332, -1, -1, -1, -1, -1, -1},
+    {332, 289, 287, -1, -1, -1, -1, -1, -1},
+    {285, 328, 330, -1, -1, -1, -1, -1, -1},
+    {330, 287, 285, -1, -1, -1, -1, -1, -1},
+    {280, 327, 328, -1, -1, -1, -1, -1, -1},
+    {328, 285, 280, -1, -1, -1, -1, -1, -1},
+    {274, 324, 327, -1, -1, -1, -1, -1, -1},
+    {327, 280, 274, -1, -1, -1, -1, -1, -1},
+    {264, 322, 324, -1, -1, -1, -1, -1, -1},
+    {324, 274, 264, -1, -1, -1, -1, -1, -1},
+    {258, 320, 322, -1, -1, -1, -1, -1, -1},
+    {322, 264, 258, -1, -1, -1, -1, -1, -1},
+    {254, 318, 320, -1, -1, -1, -1, -1, -1},
+    {320, 258, 254, -1, -1, -1, -1, -1, -1},
+    {248, 315, 318, -1, -1, -1, -1, -1, -1},
+    {318, 254, 248, -1, -1, -1, -1, -1, -1},
+    {268, 297, 301, -1, -1, -1, -1, -1, -1},
+    {301, 270, 268, -1, -1, -1, -1, -1, -1},
+    {260, 289, 297, -1, -1, -1, -1, -1, -1},
+    {297, 268, 260, -1, -1, -1, -1, -1, -1},
+    {250, 287, 289, -1, -1, -1, -1, -1, -1},
+    {289, 260, 250, -1, -1, -1, -1, -1, -1},
+    {237, 285, 287, -1, -1, -1, -1, -1, -1},
+    {287, 250, 237, -1, -1, -1, -1, -1, -1},
+    {229, 280, 285, -1, -1, -1, -1, -1, -1},
+    {285, 237, 229, -1, -1, -1, -1, -1, -1},
+    {217, 274, 280, -1, -1, -1, -1, -1, -1},
+    {280, 229, 217, -1, -1, -1, -1, -1, -1},
+    {207, 264, 274, -1, -1, -1, -1, -1, -1},
+    {274, 217, 207, -1, -1, -1, -1, -1, -1},
+    {195, 258, 264, -1, -1, -1, -1, -1, -1},
+    {264, 207, 195, -1, -1, -1, -1, -1, -1},
+    {185, 254, 258, -1, -1, -1, -1, -1, -1},
+    {258, 195, 185, -1, -1, -1, -1, -1, -1},
+    {180, 248, 254, -1, -1, -1, -1, -1, -1},
+    {254, 185, 180, -1, -1, -1, -1, -1, -1},
+    {227, 268, 270, -1, -1, -1, -1, -1, -1},
+    {270, 233, 227, -1, -1, -1, -1, -1, -1},
+    {221, 260, 268, -1, -1, -1, -1, -1, -1},
+    {268, 227, 221, -1, -1, -1, -1, -1, -1},
+    {211, 250, 260, -1, -1, -1, -1, -1, -1},
+    {260, 221, 211, -1, -1, -1, -1, -1, -1},
+    {199, 237, 250, -1, -1, -1, -1, -1, -1},
+    {250, 211, 199, -1, -1, -1, -1, -1, -1},
+    {176, 229, 237, -1, -1, -1, -1, -1, -1},
+    {237, 199, 176, -1, -1, -1, -1, -1, -1},
+    {159, 217, 229, -1, -1, -1, -1, -1, -1},
+    {229, 176, 159, -1, -1, -1, -1, -1, -1},
+    {133, 207, 217, -1, -1, -1, -1, -1, -1},
+    {217, 159, 133, -1, -1, -1, -1, -1, -1},
+    {111, 195, 207, -1, -1, -1, -1, -1, -1},
+    {207, 133, 111, -1, -1, -1, -1, -1, -1},
+    {101, 185, 195, -1, -1, -1, -1, -1, -1},
+    {195, 111, 101, -1, -1, -1, -1, -1, -1},
+    {95, 180, 185, -1, -1, -1, -1, -1, -1},
+    {185, 101, 95, -1, -1, -1, -1, -1, -1},
+    {197, 227, 233, -1, -1, -1, -1, -1, -1},
+    {233, 204, 197, -1, -1, -1, -1, -1, -1},
+    {181, 221, 227, -1, -1, -1, -1, -1, -1},
+    {227, 197, 181, -1, -1, -1, -1, -1, -1},
+    {167, 211, 221, -1, -1, -1, -1, -1, -1},
+    {221, 181, 167, -1, -1, -1, -1, -1, -1},
+    {145, 199, 211, -1, -1, -1, -1, -1, -1},
+    {211, 167, 145, -1, -1, -1, -1, -1, -1},
+    {117, 176, 199, -1, -1, -1, -1, -1, -1},
+    {199, 145, 117, -1, -1, -1, -1, -1, -1},
+    {91, 159, 176, -1, -1, -1, -1, -1, -1},
+    {176, 117, 91, -1, -1, -1, -1, -1, -1},
+    {73, 133, 159, -1, -1, -1, -1, -1, -1},
+    {159, 91, 73, -1, -1, -1, -1, -1, -1},
+    {62, 111, 133, -1, -1, -1, -1, -1, -1},
+    {133, 73, 62, -1, -1, -1, -1, -1, -1},
+    {52, 101, 111, -1, -1, -1, -1, -1, -1},
+    {111, 62, 52, -1, -1, -1, -1, -1, -1},
+    {49, 95, 101, -1, -1, -1, -1, -1, -1},
+    {101, 52, 49, -1, -1, -1, -1, -1, -1},
+    {166, 197, 204, -1, -1, -1, -1, -1, -1},
+    {204, 169, 166, -1, -1, -1, -1, -1, -1},
+    {153, 181, 197, -1, -1, -1, -1, -1, -1},
+    {197, 166, 153, -1, -1, -1, -1, -1, -1},
+    {125, 167, 181, -1, -1, -1, -1, -1, -1},
+    {181, 153, 125, -1, -1, -1, -1, -1, -1},
+    {99, 145, 167, -1, -1, -1, -1, -1, -1},
+    {167, 125, 99, -1, -1, -1, -1, -1, -1},
+    {82, 117, 145, -1, -1, -1, -1, -1, -1},
+    {145, 99, 82, -1, -1, -1, -1, -1, -1},
+    {60, 91, 117, -1, -1, -1, -1, -1, -1},
+    {117, 82, 60, -1, -1, -1, -1, -1, -1},
+    {45, 73, 91, -1, -1, -1, -1, -1, -1},
+    {91, 60, 45, -1, -1, -1, -1, -1, -1},
+    {31, 62, 73, -1, -1, -1, -1, -1, -1},
+    {73, 45, 31, -1, -1, -1, -1, -1, -1},
+    {24, 52, 62, -1, -1, -1, -1, -1, -1},
+    {62, 31, 24, -1, -1, -1, -1, -1, -1},
+    {20, 49, 52, -1, -1, -1, -1, -1, -1},
+    {52, 24, 20, -1, -1, -1, -1, -1, -1},
+    {142, 166, 169, -1, -1, -1, -1, -1, -1},
+    {169, 149, 142, -1, -1, -1, -1, -1, -1},
+    {123, 153, 166, -1, -1, -1, -1, -1, -1},
+    {166, 142, 123, -1, -1, -1, -1, -1, -1},
+    {103, 125, 153, -1, -1, -1, -1, -1, -1},
+    {153, 123, 103, -1, -1, -1, -1, -1, -1},
+    {83, 99, 125, -1, -1, -1, -1, -1, -1},
+    {125, 103, 83, -1, -1, -1, -1, -1, -1},
+    {64, 82, 99, -1, -1, -1, -1, -1, -1},
+    {99, 83, 64, -1, -1, -1, -1, -1, -1},
+    {43, 60, 82, -1, -1, -1, -1, -1, -1},
+    {82, 64, 43, -1, -1, -1, -1, -1, -1},
+    {29, 45, 60, -1, -1, -1, -1, -1, -1},
+    {60, 43, 29, -1, -1, -1, -1, -1, -1},
+    {16, 31, 45, -1, -1, -1, -1, -1, -1},
+    {45, 29, 16, -1, -1, -1, -1, -1, -1},
+    {8, 24, 31, -1, -1, -1, -1, -1, -1},
+    {31, 16, 8, -1, -1, -1, -1, -1, -1},
+    {4, 20, 24, -1, -1, -1, -1, -1, -1},
+    {24, 8, 4, -1, -1, -1, -1, -1, -1},
+    {131, 142, 149, -1, -1, -1, -1, -1, -1},
+    {149, 139, 131, -1, -1, -1, -1, -1, -1},
+    {115, 123, 142, -1, -1, -1, -1, -1, -1},
+    {142, 131, 115, -1, -1, -1, -1, -1, -1},
+    {93, 103, 123, -1, -1, -1, -1, -1, -1},
+    {123, 115, 93, -1, -1, -1, -1, -1, -1},
+    {75, 83, 103, -1, -1, -1, -1, -1, -1},
+    {103, 93, 75, -1, -1, -1, -1, -1, -1},
+    {54, 64, 83, -1, -1, -1, -1, -1, -1},
+    {83, 75, 54, -1, -1, -1, -1, -1, -1},
+    {39, 43, 64, -1, -1, -1, -1, -1, -1},
+    {64, 54, 39, -1, -1, -1, -1, -1, -1},
+    {21, 29, 43, -1, -1, -1, -1, -1, -1},
+    {43, 39, 21, -1, -1, -1, -1, -1, -1},
+    {10, 16, 29, -1, -1, -1, -1, -1, -1},
+    {29, 21, 10, -1, -1, -1, -1, -1, -1},
+    {1, 8, 16, -1, -1, -1, -1, -1, -1},
+    {16, 10, 1, -1, -1, -1, -1, -1, -1},
+    {0, 4, 8, -1, -1, -1, -1, -1, -1},
+    {8, 1, 0, -1, -1, -1, -1, -1, -1},
+    {479, 595, 598, -1, -1, -1, -1, -1, -1},
+    {598, 480, 479, -1, -1, -1, -1, -1, -1},
+    {477, 593, 595, -1, -1, -1, -1, -1, -1},
+    {595, 479, 477, -1, -1, -1, -1, -1, -1},
+    {475, 589, 593, -1, -1, -1, -1, -1, -1},
+    {593, 477, 475, -1, -1, -1, -1, -1, -1},
+    {473, 577, 589, -1, -1, -1, -1, -1, -1},
+    {589, 475, 473, -1, -1, -1, -1, -1, -1},
+    {471, 575, 577, -1, -1, -1, -1, -1, -1},
+    {577, 473, 471, -1, -1, -1, -1, -1, -1},
+    {469, 567, 575, -1, -1, -1, -1, -1, -1},
+    {575, 471, 469, -1, -1, -1, -1, -1, -1},
+    {465, 557, 567, -1, -1, -1, -1, -1, -1},
+    {567, 469, 465, -1, -1, -1, -1, -1, -1},
+    {463, 551, 557, -1, -1, -1, -1, -1, -1},
+    {557, 465, 463, -1, -1, -1, -1, -1, -1},
+    {461, 545, 551, -1, -1, -1, -1, -1, -1},
+    {551, 463, 461, -1, -1, -1, -1, -1, -1},
+    {455, 543, 545, -1, -1, -1, -1, -1, -1},
+    {545, 461, 455, -1, -1, -1, -1, -1, -1},
+    {362, 479, 480, -1, -1, -1, -1, -1, -1},
+    {480, 359, 362, -1, -1, -1, -1, -1, -1},
+    {364, 477, 479, -1, -1, -1, -1, -1, -1},
+    {479, 362, 364, -1, -1, -1, -1, -1, -1},
+    {366, 475, 477, -1, -1, -1, -1, -1, -1},
+    {477, 364, 366, -1, -1, -1, -1, -1, -1},
+    {367, 473, 475, -1, -1, -1, -1, -1, -1},
+    {475, 366, 367, -1, -1, -1, -1, -1, -1},
+    {369, 471, 473, -1, -1, -1, -1, -1, -1},
+    {473, 367, 369, -1, -1, -1, -1, -1, -1},
+    {371, 469, 471, -1, -1, -1, -1, -1, -1},
+    {471, 369, 371, -1, -1, -1, -1, -1, -1},
+    {379, 465, 469, -1, -1, -1, -1, -1, -1},
+    {469, 371, 379, -1, -1, -1, -1, -1, -1},
+    {384, 463, 465, -1, -1, -1, -1, -1, -1},
+    {465, 379, 384, -1, -1, -1, -1, -1, -1},
+    {389, 461, 463, -1, -1, -1, -1, -1, -1},
+    {463, 384, 389, -1, -1, -1, -1, -1, -1},
+    {390, 455, 461, -1, -1, -1, -1, -1, -1},
+    {461, 389, 390, -1, -1, -1, -1, -1, -1},
+    {319, 362, 359, -1, -1, -1, -1, -1, -1},
+    {359, 315, 319, -1, -1, -1, -1, -1, -1},
+    {321, 364, 362, -1, -1, -1, -1, -1, -1},
+    {362, 319, 321, -1, -1, -1, -1, -1, -1},
+    {323, 366, 364, -1, -1, -1, -1, -1, -1},
+    {364, 321, 323, -1, -1, -1, -1, -1, -1},
+    {325, 367, 366, -1, -1, -1, -1, -1, -1},
+    {366, 323, 325, -1, -1, -1, -1, -1, -1},
+    {326, 369, 367, -1, -1, -1, -1, -1, -1},
+    {367, 325, 326, -1, -1, -1, -1, -1, -1},
+    {329, 371, 369, -1, -1, -1, -1, -1, -1},
+    {369, 326, 329, -1, -1, -1, -1, -1, -1},
+    {331, 379, 371, -1, -1, -1, -1, -1, -1},
+    {371, 329, 331, -1, -1, -1, -1, -1, -1},
+    {333, 384, 379, -1, -1, -1, -1, -1, -1},
+    {379, 331, 333, -1, -1, -1, -1, -1, -1},
+    {335, 389, 384, -1, -1, -1, -1, -1, -1},
+    {384, 333, 335, -1, -1, -1, -1, -1, -1},
+    {336, 390, 389, -1, -1, -1, -1, -1, -1},
+    {389, 335, 336, -1, -1, -1, -1, -1, -1},
+    {255, 319, 315, -1, -1, -1, -1, -1, -1},
+    {315, 249, 255, -1, -1, -1, -1, -1, -1},
+    {259, 321, 319, -1, -1, -1, -1, -1, -1},
+    {319, 255, 259, -1, -1, -1, -1, -1, -1},
+    {265, 323, 321, -1, -1, -1, -1, -1, -1},
+    {321, 259, 265, -1, -1, -1, -1, -1, -1},
+    {275, 325, 323, -1, -1, -1, -1, -1, -1},
+    {323, 265, 275, -1, -1, -1, -1, -1, -1},
+    {281, 326, 325, -1, -1, -1, -1, -1, -1},
+    {325, 275, 281, -1, -1, -1, -1, -1, -1},
+    {286, 329, 326, -1, -1, -1, -1, -1, -1},
+    {326, 281, 286, -1, -1, -1, -1, -1, -1},
+    {288, 331, 329, -1, -1, -1, -1, -1, -1},
+    {329, 286, 288, -1, -1, -1, -1, -1, -1},
+    {290, 333, 331, -1, -1, -1, -1, -1, -1},
+    {331, 288, 290, -1, -1, -1, -1, -1, -1},
+    {298, 335, 333, -1, -1, -1, -1, -1, -1},
+    {333, 290, 298, -1, -1, -1, -1, -1, -1},
+    {302, 336, 335, -1, -1, -1, -1, -1, -1},
+    {335, 298, 302, -1, -1, -1, -1, -1, -1},
+    {186, 255, 249, -1, -1, -1, -1, -1, -1},
+    {249, 180, 186, -1, -1, -1, -1, -1, -1},
+    {196, 259, 255, -1, -1, -1, -1, -1, -1},
+    {255, 186, 196, -1, -1, -1, -1, -1, -1},
+    {208, 265, 259, -1, -1, -1, -1, -1, -1},
+    {259, 196, 208, -1, -1, -1, -1, -1, -1},
+    {218, 275, 265, -1, -1, -1, -1, -1, -1},
+    {265, 208, 218, -1, -1, -1, -1, -1, -1},
+    {230, 281, 275, -1, -1, -1, -1, -1, -1},
+    {275, 218, 230, -1, -1, -1, -1, -1, -1},
+    {238, 286, 281, -1, -1, -1, -1, -1, -1},
+    {281, 230, 238, -1, -1, -1, -1, -1, -1},
+    {251, 288, 286, -1, -1, -1, -1, -1, -1},
+    {286, 238, 251, -1, -1, -1, -1, -1, -1},
+    {261, 290, 288, -1, -1, -1, -1, -1, -1},
+    {288, 251, 261, -1, -1, -1, -1, -1, -1},
+    {269, 298, 290, -1, -1, -1, -1, -1, -1},
+    {290, 261, 269, -1, -1, -1, -1, -1, -1},
+    {271, 302, 298, -1, -1, -1, -1, -1, -1},
+    {298, 269, 271, -1, -1, -1, -1, -1, -1},
+    {102, 186, 180, -1, -1, -1, -1, -1, -1},
+    {180, 96, 102, -1, -1, -1, -1, -1, -1},
+    {112, 196, 186, -1, -1, -1, -1, -1, -1},
+    {186, 102, 112, -1, -1, -1, -1, -1, -1},
+    {134, 208, 196, -1, -1, -1, -1, -1, -1},
+    {196, 112, 134, -1, -1, -1, -1, -1, -1},
+    {160, 218, 208, -1, -1, -1, -1, -1, -1},
+    {208, 134, 160, -1, -1, -1, -1, -1, -1},
+    {177, 230, 218, -1, -1, -1, -1, -1, -1},
+    {218, 160, 177, -1, -1, -1, -1, -1, -1},
+    {200, 238, 230, -1, -1, -1, -1, -1, -1},
+    {230, 177, 200, -1, -1, -1, -1, -1, -1},
+    {212, 251, 238, -1, -1, -1, -1, -1, -1},
+    {238, 200, 212, -1, -1, -1, -1, -1, -1},
+    {222, 261, 251, -1, -1, -1, -1, -1, -1},
+    {251, 212, 222, -1, -1, -1, -1, -1, -1},
+    {228, 269, 261, -1, -1, -1, -1, -1, -1},
+    {261, 222, 228, -1, -1, -1, -1, -1, -1},
+    {234, 271, 269, -1, -1, -1, -1, -1, -1},
+    {269, 228, 234, -1, -1, -1, -1, -1, -1},
+    {53, 102, 96, -1, -1, -1, -1, -1, -1},
+    {96, 49, 53, -1, -1, -1, -1, -1, -1},
+    {63, 112, 102, -1, -1, -1, -1, -1, -1},
+    {102, 53, 63, -1, -1, -1, -1, -1, -1},
+    {74, 134, 112, -1, -1, -1, -1, -1, -1},
+    {112, 63, 74, -1, -1, -1, -1, -1, -1},
+    {92, 160, 134, -1, -1, -1, -1, -1, -1},
+    {134, 74, 92, -1, -1, -1, -1, -1, -1},
+    {118, 177, 160, -1, -1, -1, -1, -1, -1},
+    {160, 92, 118, -1, -1, -1, -1, -1, -1},
+    {146, 200, 177, -1, -1, -1, -1, -1, -1},
+    {177, 118, 146, -1, -1, -1, -1, -1, -1},
+    {168, 212, 200, -1, -1, -1, -1, -1, -1},
+    {200, 146, 168, -1, -1, -1, -1, -1, -1},
+    {182, 222, 212, -1, -1, -1, -1, -1, -1},
+    {212, 168, 182, -1, -1, -1, -1, -1, -1},
+    {198, 228, 222, -1, -1, -1, -1, -1, -1},
+    {222, 182, 198, -1, -1, -1, -1, -1, -1},
+    {204, 234, 228, -1, -1, -1, -1, -1, -1},
+    {228, 198, 204, -1, -1, -1, -1, -1, -1},
+    {23, 53, 49, -1, -1, -1, -1, -1, -1},
+    {49, 20, 23, -1, -1, -1, -1, -1, -1},
+    {32, 63, 53, -1, -1, -1, -1, -1, -1},
+    {53, 23, 32, -1, -1, -1, -1, -1, -1},
+    {46, 74, 63, -1, -1, -1, -1, -1, -1},
+    {63, 32, 46, -1, -1, -1, -1, -1, -1},
+    {61, 92, 74, -1, -1, -1, -1, -1, -1},
+    {74, 46, 61, -1, -1, -1, -1, -1, -1},
+    {81, 118, 92, -1, -1, -1, -1, -1, -1},
+    {92, 61, 81, -1, -1, -1, -1, -1, -1},
+    {100, 146, 118, -1, -1, -1, -1, -1, -1},
+    {118, 81, 100, -1, -1, -1, -1, -1, -1},
+    {126, 168, 146, -1, -1, -1, -1, -1, -1},
+    {146, 100, 126, -1, -1, -1, -1, -1, -1},
+    {154, 182, 168, -1, -1, -1, -1, -1, -1},
+    {168, 126, 154, -1, -1, -1, -1, -1, -1},
+    {165, 198, 182, -1, -1, -1, -1, -1, -1},
+    {182, 154, 165, -1, -1, -1, -1, -1, -1},
+    {170, 204, 198, -1, -1, -1, -1, -1, -1},
+    {198, 165, 170, -1, -1, -1, -1, -1, -1},
+    {9, 23, 20, -1, -1, -1, -1, -1, -1},
+    {20, 5, 9, -1, -1, -1, -1, -1, -1},
+    {17, 32, 23, -1, -1, -1, -1, -1, -1},
+    {23, 9, 17, -1, -1, -1, -1, -1, -1},
+    {30, 46, 32, -1, -1, -1, -1, -1, -1},
+    {32, 17, 30, -1, -1, -1, -1, -1, -1},
+    {44, 61, 46, -1, -1, -1, -1, -1, -1},
+    {46, 30, 44, -1, -1, -1, -1, -1, -1},
+    {65, 81, 61, -1, -1, -1, -1, -1, -1},
+    {61, 44, 65, -1, -1, -1, -1, -1, -1},
+    {84, 100, 81, -1, -1, -1, -1, -1, -1},
+    {81, 65, 84, -1, -1, -1, -1, -1, -1},
+    {104, 126, 100, -1, -1, -1, -1, -1, -1},
+    {100, 84, 104, -1, -1, -1, -1, -1, -1},
+    {124, 154, 126, -1, -1, -1, -1, -1, -1},
+    {126, 104, 124, -1, -1, -1, -1, -1, -1},
+    {143, 165, 154, -1, -1, -1, -1, -1, -1},
+    {154, 124, 143, -1, -1, -1, -1, -1, -1},
+    {150, 170, 165, -1, -1, -1, -1, -1, -1},
+    {165, 143, 150, -1, -1, -1, -1, -1, -1},
+    {2, 9, 5, -1, -1, -1, -1, -1, -1},
+    {5, 0, 2, -1, -1, -1, -1, -1, -1},
+    {11, 17, 9, -1, -1, -1, -1, -1, -1},
+    {9, 2, 11, -1, -1, -1, -1, -1, -1},
+    {22, 30, 17, -1, -1, -1, -1, -1, -1},
+    {17, 11, 22, -1, -1, -1, -1, -1, -1},
+    {40, 44, 30, -1, -1, -1, -1, -1, -1},
+    {30, 22, 40, -1, -1, -1, -1, -1, -1},
+    {55, 65, 44, -1, -1, -1, -1, -1, -1},
+    {44, 40, 55, -1, -1, -1, -1, -1, -1},
+    {76, 84, 65, -1, -1, -1, -1, -1, -1},
+    {65, 55, 76, -1, -1, -1, -1, -1, -1},
+    {94, 104, 84, -1, -1, -1, -1, -1, -1},
+    {84, 76, 94, -1, -1, -1, -1, -1, -1},
+    {116, 124, 104, -1, -1, -1, -1, -1, -1},
+    {104, 94, 116, -1, -1, -1, -1, -1, -1},
+    {132, 143, 124, -1, -1, -1, -1, -1, -1},
+    {124, 116, 132, -1, -1, -1, -1, -1, -1},
+    {139, 150, 143, -1, -1, -1, -1, -1, -1},
+    {143, 132, 139, -1, -1, -1, -1, -1, -1},
+    {137, 131, 139, -1, -1, -1, -1, -1, -1},
+    {139, 144, 137, -1, -1, -1, -1, -1, -1},
+    {121, 115, 131, -1, -1, -1, -1, -1, -1},
+    {131, 137, 121, -1, -1, -1, -1, -1, -1},
+    {97, 93, 115, -1, -1, -1, -1, -1, -1},
+    {115, 121, 97, -1, -1, -1, -1, -1, -1},
+    {79, 75, 93, -1, -1, -1, -1, -1, -1},
+    {93, 97, 79, -1, -1, -1, -1, -1, -1},
+    {59, 54, 75, -1, -1, -1, -1, -1, -1},
+    {75, 79, 59, -1, -1, -1, -1, -1, -1},
+    {41, 39, 54, -1, -1, -1, -1, -1, -1},
+    {54, 59, 41, -1, -1, -1, -1, -1, -1},
+    {27, 21, 39, -1, -1, -1, -1, -1, -1},
+    {39, 41, 27, -1, -1, -1, -1, -1, -1},
+    {12, 10, 21, -1, -1, -1, -1, -1, -1},
+    {21, 27, 12, -1, -1, -1, -1, -1, -1},
+    {6, 1, 10, -1, -1, -1, -1, -1, -1},
+    {10, 12, 6, -1, -1, -1, -1, -1, -1},
+    {3, 0, 1, -1, -1, -1, -1, -1, -1},
+    {1, 6, 3, -1, -1, -1, -1, -1, -1},
+    {151, 137, 144, -1, -1, -1, -1, -1, -1},
+    {144, 157, 151, -1, -1, -1, -1, -1, -1},
+    {135, 121, 137, -1, -1, -1, -1, -1, -1},
+    {137, 151, 135, -1, -1, -1, -1, -1, -1},
+    {107, 97, 121, -1, -1, -1, -1, -1, -1},
+    {121, 135, 107, -1, -1, -1, -1, -1, -1},
+    {88, 79, 97, -1, -1, -1, -1, -1, -1},
+    {97, 107, 88, -1, -1, -1, -1, -1, -1},
+    {69, 59, 79, -1, -1, -1, -1, -1, -1},
+    {79, 88, 69, -1, -1, -1, -1, -1, -1},
+    {51, 41, 59, -1, -1, -1, -1, -1, -1},
+    {59, 69, 51, -1, -1, -1, -1, -1, -1},
+    {37, 27, 41, -1, -1, -1, -1, -1, -1},
+    {41, 51, 37, -1, -1, -1, -1, -1, -1},
+    {25, 12, 27, -1, -1, -1, -1, -1, -1},
+    {27, 37, 25, -1, -1, -1, -1, -1, -1},
+    {18, 6, 12, -1, -1, -1, -1, -1, -1},
+    {12, 25, 18, -1, -1, -1, -1, -1, -1},
+    {14, 3, 6, -1, -1, -1, -1, -1, -1},
+    {6, 18, 14, -1, -1, -1, -1, -1, -1},
+    {172, 151, 157, -1, -1, -1, -1, -1, -1},
+    {157, 175, 172, -1, -1, -1, -1, -1, -1},
+    {161, 135, 151, -1, -1, -1, -1, -1, -1},
+    {151, 172, 161, -1, -1, -1, -1, -1, -1},
+    {141, 107, 135, -1, -1, -1, -1, -1, -1},
+    {135, 161, 141, -1, -1, -1, -1, -1, -1},
+    {110, 88, 107, -1, -1, -1, -1, -1, -1},
+    {107, 141, 110, -1, -1, -1, -1, -1, -1},
+    {90, 69, 88, -1, -1, -1, -1, -1, -1},
+    {88, 110, 90, -1, -1, -1, -1, -1, -1},
+    {72, 51, 69, -1, -1, -1, -1, -1, -1},
+    {69, 90, 72, -1, -1, -1, -1, -1, -1},
+    {57, 37, 51, -1, -1, -1, -1, -1, -1},
+    {51, 72, 57, -1, -1, -1, -1, -1, -1},
+    {47, 25, 37, -1, -1, -1, -1, -1, -1},
+    {37, 57, 47, -1, -1, -1, -1, -1, -1},
+    {36, 18, 25, -1, -1, -1, -1, -1, -1},
+    {25, 47, 36, -1, -1, -1, -1, -1, -1},
+    {34, 14, 18, -1, -1, -1, -1, -1, -1},
+    {18, 36, 34, -1, -1, -1, -1, -1, -1},
+    {193, 172, 175, -1, -1, -1, -1, -1, -1},
+    {175, 201, 193, -1, -1, -1, -1, -1, -1},
+    {183, 161, 172, -1, -1, -1, -1, -1, -1},
+    {172, 193, 183, -1, -1, -1, -1, -1, -1},
+    {173, 141, 161, -1, -1, -1, -1, -1, -1},
+    {161, 183, 173, -1, -1, -1, -1, -1, -1},
+    {155, 110, 141, -1, -1, -1, -1, -1, -1},
+    {141, 173, 155, -1, -1, -1, -1, -1, -1},
+    {127, 90, 110, -1, -1, -1, -1, -1, -1},
+    {110, 155, 127, -1, -1, -1, -1, -1, -1},
+    {105, 72, 90, -1, -1, -1, -1, -1, -1},
+    {90, 127, 105, -1, -1, -1, -1, -1, -1},
+    {85, 57, 72, -1, -1, -1, -1, -1, -1},
+    {72, 105, 85, -1, -1, -1, -1, -1, -1},
+    {77, 47, 57, -1, -1, -1, -1, -1, -1},
+    {57, 85, 77, -1, -1, -1, -1, -1, -1},
+    {67, 36, 47, -1, -1, -1, -1, -1, -1},
+    {47, 77, 67, -1, -1, -1, -1, -1, -1},
+    {66, 34, 36, -1, -1, -1, -1, -1, -1},
+    {36, 67, 66, -1, -1, -1, -1, -1, -1},
+    {220, 193, 201, -1, -1, -1, -1, -1, -1},
+    {201, 224, 220, -1, -1, -1, -1, -1, -1},
+    {215, 183, 193, -1, -1, -1, -1, -1, -1},
+    {193, 220, 215, -1, -1, -1, -1, -1, -1},
+    {205, 173, 183, -1, -1, -1, -1, -1, -1},
+    {183, 215, 205, -1, -1, -1, -1, -1, -1},
+    {191, 155, 173, -1, -1, -1, -1, -1, -1},
+    {173, 205, 191, -1, -1, -1, -1, -1, -1},
+    {179, 127, 155, -1, -1, -1, -1, -1, -1},
+    {155, 191, 179, -1, -1, -1, -1, -1, -1},
+    {163, 105, 127, -1, -1, -1, -1, -1, -1},
+    {127, 179, 163, -1, -1, -1, -1, -1, -1},
+    {147, 85, 105, -1, -1, -1, -1, -1, -1},
+    {105, 163, 147, -1, -1, -1, -1, -1, -1},
+    {129, 77, 85, -1, -1, -1, -1, -1, -1},
+    {85, 147, 129, -1, -1, -1, -1, -1, -1},
+    {120, 67, 77, -1, -1, -1, -1, -1, -1},
+    {77, 129, 120, -1, -1, -1, -1, -1, -1},
+    {114, 66, 67, -1, -1, -1, -1, -1, -1},
+    {67, 120, 114, -1, -1, -1, -1, -1, -1},
+    {243, 220, 224, -1, -1, -1, -1, -1, -1},
+    {224, 246, 243, -1, -1, -1, -1, -1, -1},
+    {239, 215, 220, -1, -1, -1, -1, -1, -1},
+    {220, 243, 239, -1, -1, -1, -1, -1, -1},
+    {235, 205, 215, -1, -1, -1, -1, -1, -1},
+    {215, 239, 235, -1, -1, -1, -1, -1, -1},
+    {232, 191, 205, -1, -1, -1, -1, -1, -1},
+    {205, 235, 232, -1, -1, -1, -1, -1, -1},
+    {226, 179, 191, -1, -1, -1, -1, -1, -1},
+    {191, 232, 226, -1, -1, -1, -1, -1, -1},
+    {214, 163, 179, -1, -1, -1, -1, -1, -1},
+    {179, 226, 214, -1, -1, -1, -1, -1, -1},
+    {209, 147, 163, -1, -1, -1, -1, -1, -1},
+    {163, 214, 209, -1, -1, -1, -1, -1, -1},
+    {202, 129, 147, -1, -1, -1, -1, -1, -1},
+    {147, 209, 202, -1, -1, -1, -1, -1, -1},
+    {190, 120, 129, -1, -1, -1, -1, -1, -1},
+    {129, 202, 190, -1, -1, -1, -1, -1, -1},
+    {187, 114, 120, -1, -1, -1, -1, -1, -1},
+    {120, 190, 187, -1, -1, -1, -1, -1, -1},
+    {283, 243, 246, -1, -1, -1, -1, -1, -1},
+    {246, 284, 283, -1, -1, -1, -1, -1, -1},
+    {278, 239, 243, -1, -1, -1, -1, -1, -1},
+    {243, 283, 278, -1, -1, -1, -1, -1, -1},
+    {276, 235, 239, -1, -1, -1, -1, -1, -1},
+    {239, 278, 276, -1, -1, -1, -1, -1, -1},
+    {272, 232, 235, -1, -1, -1, -1, -1, -1},
+    {235, 276, 272, -1, -1, -1, -1, -1, -1},
+    {266, 226, 232, -1, -1, -1, -1, -1, -1},
+    {232, 272, 266, -1, -1, -1, -1, -1, -1},
+    {262, 214, 226, -1, -1, -1, -1, -1, -1},
+    {226, 266, 262, -1, -1, -1, -1, -1, -1},
+    {257, 209, 214, -1, -1, -1, -1, -1, -1},
+    {214, 262, 257, -1, -1, -1, -1, -1, -1},
+    {252, 202, 209, -1, -1, -1, -1, -1, -1},
+    {209, 257, 252, -1, -1, -1, -1, -1, -1},
+    {244, 190, 202, -1, -1, -1, -1, -1, -1},
+    {202, 252, 244, -1, -1, -1, -1, -1, -1},
+    {241, 187, 190, -1, -1, -1, -1, -1, -1},
+    {190, 244, 241, -1, -1, -1, -1, -1, -1},
+    {314, 283, 284, -1, -1, -1, -1, -1, -1},
+    {284, 317, 314, -1, -1, -1, -1, -1, -1},
+    {311, 278, 283, -1, -1, -1, -1, -1, -1},
+    {283, 314, 311, -1, -1, -1, -1, -1, -1},
+    {310, 276, 278, -1, -1, -1, -1, -1, -1},
+    {278, 311, 310, -1, -1, -1, -1, -1, -1},
+    {308, 272, 276, -1, -1, -1, -1, -1, -1},
+    {276, 310, 308, -1, -1, -1, -1, -1, -1},
+    {306, 266, 272, -1, -1, -1, -1, -1, -1},
+    {272, 308, 306, -1, -1, -1, -1, -1, -1},
+    {304, 262, 266, -1, -1, -1, -1, -1, -1},
+    {266, 306, 304, -1, -1, -1, -1, -1, -1},
+    {300, 257, 262, -1, -1, -1, -1, -1, -1},
+    {262, 304, 300, -1, -1, -1, -1, -1, -1},
+    {296, 252, 257, -1, -1, -1, -1, -1, -1},
+    {257, 300, 296, -1, -1, -1, -1, -1, -1},
+    {294, 244, 252, -1, -1, -1, -1, -1, -1},
+    {252, 296, 294, -1, -1, -1, -1, -1, -1},
+    {292, 241, 244, -1, -1, -1, -1, -1, -1},
+    {244, 294, 292, -1, -1, -1, -1, -1, -1},
+    {340, 314, 317, -1, -1, -1, -1, -1, -1},
+    {317, 338, 340, -1, -1, -1, -1, -1, -1},
+    {342, 311, 314, -1, -1, -1, -1, -1, -1},
+    {314, 340, 342, -1, -1, -1, -1, -1, -1},
+    {344, 310, 311, -1, -1, -1, -1, -1, -1},
+    {311, 342, 344, -1, -1, -1, -1, -1, -1},
+    {346, 308, 310, -1, -1, -1, -1, -1, -1},
+    {310, 344, 346, -1, -1, -1, -1, -1, -1},
+    {348, 306, 308, -1, -1, -1, -1, -1, -1},
+    {308, 346, 348, -1, -1, -1, -1, -1, -1},
+    {350, 304, 306, -1, -1, -1, -1, -1, -1},
+    {306, 348, 350, -1, -1, -1, -1, -1, -1},
+    {352, 300, 304, -1, -1, -1, -1, -1, -1},
+    {304, 350, 352, -1, -1, -1, -1, -1, -1},
+    {354, 296, 300, -1, -1, -1, -1, -1, -1},
+    {300, 352, 354, -1, -1, -1, -1, -1, -1},
+    {356, 294, 296, -1, -1, -1, -1, -1, -1},
+    {296, 354, 356, -1, -1, -1, -1, -1, -1},
+    {358, 292, 294, -1, -1, -1, -1, -1, -1},
+    {294, 356, 358, -1, -1, -1, -1, -1, -1},
+    {377, 340, 338, -1, -1, -1, -1, -1, -1},
+    {338, 375, 377, -1, -1, -1, -1, -1, -1},
+    {383, 342, 340, -1, -1, -1, -1, -1, -1},
+    {340, 377, 383, -1, -1, -1, -1, -1, -1},
+    {393, 344, 342, -1, -1, -1, -1, -1, -1},
+    {342, 383, 393, -1, -1, -1, -1, -1, -1},
+    {402, 346, 344, -1, -1, -1, -1, -1, -1},
+    {344, 393, 402, -1, -1, -1, -1, -1, -1},
+    {405, 348, 346, -1, -1, -1, -1, -1, -1},
+    {346, 402, 405, -1, -1, -1, -1, -1, -1},
+    {414, 350, 348, -1, -1, -1, -1, -1, -1},
+    {348, 405, 414, -1, -1, -1, -1, -1, -1},
+    {418, 352, 350, -1, -1, -1, -1, -1, -1},
+    {350, 414, 418, -1, -1, -1, -1, -1, -1},
+    {422, 354, 352, -1, -1, -1, -1, -1, -1},
+    {352, 418, 422, -1, -1, -1, -1, -1, -1},
+    {424, 356, 354, -1, -1, -1, -1, -1, -1},
+    {354, 422, 424, -1, -1, -1, -1, -1, -1},
+    {426, 358, 356, -1, -1, -1, -1, -1, -1},
+    {356, 424, 426, -1, -1, -1, -1, -1, -1},
+    {7, 2, 0, -1, -1, -1, -1, -1, -1},
+    {0, 3, 7, -1, -1, -1, -1, -1, -1},
+    {13, 11, 2, -1, -1, -1, -1, -1, -1},
+    {2, 7, 13, -1, -1, -1, -1, -1, -1},
+    {28, 22, 11, -1, -1, -1, -1, -1, -1},
+    {11, 13, 28, -1, -1, -1, -1, -1, -1},
+    {42, 40, 22, -1, -1, -1, -1, -1, -1},
+    {22, 28, 42, -1, -1, -1, -1, -1, -1},
+    {58, 55, 40, -1, -1, -1, -1, -1, -1},
+    {40, 42, 58, -1, -1, -1, -1, -1, -1},
+    {80, 76, 55, -1, -1, -1, -1, -1, -1},
+    {55, 58, 80, -1, -1, -1, -1, -1, -1},
+    {98, 94, 76, -1, -1, -1, -1, -1, -1},
+    {76, 80, 98, -1, -1, -1, -1, -1, -1},
+    {122, 116, 94, -1, -1, -1, -1, -1, -1},
+    {94, 98, 122, -1, -1, -1, -1, -1, -1},
+    {138, 132, 116, -1, -1, -1, -1, -1, -1},
+    {116, 122, 138, -1, -1, -1, -1, -1, -1},
+    {144, 139, 132, -1, -1, -1, -1, -1, -1},
+    {132, 138, 144, -1, -1, -1, -1, -1, -1},
+    {19, 7, 3, -1, -1, -1, -1, -1, -1},
+    {3, 15, 19, -1, -1, -1, -1, -1, -1},
+    {26, 13, 7, -1, -1, -1, -1, -1, -1},
+    {7, 19, 26, -1, -1, -1, -1, -1, -1},
+    {38, 28, 13, -1, -1, -1, -1, -1, -1},
+    {13, 26, 38, -1, -1, -1, -1, -1, -1},
+    {50, 42, 28, -1, -1, -1, -1, -1, -1},
+    {28, 38, 50, -1, -1, -1, -1, -1, -1},
+    {70, 58, 42, -1, -1, -1, -1, -1, -1},
+    {42, 50, 70, -1, -1, -1, -1, -1, -1},
+    {87, 80, 58, -1, -1, -1, -1, -1, -1},
+    {58, 70, 87, -1, -1, -1, -1, -1, -1},
+    {108, 98, 80, -1, -1, -1, -1, -1, -1},
+    {80, 87, 108, -1, -1, -1, -1, -1, -1},
+    {136, 122, 98, -1, -1, -1, -1, -1, -1},
+    {98, 108, 136, -1, -1, -1, -1, -1, -1},
+    {152, 138, 122, -1, -1, -1, -1, -1, -1},
+    {122, 136, 152, -1, -1, -1, -1, -1, -1},
+    {158, 144, 138, -1, -1, -1, -1, -1, -1},
+    {138, 152, 158, -1, -1, -1, -1, -1, -1},
+    {35, 19, 15, -1, -1, -1, -1, -1, -1},
+    {15, 33, 35, -1, -1, -1, -1, -1, -1},
+    {48, 26, 19, -1, -1, -1, -1, -1, -1},
+    {19, 35, 48, -1, -1, -1, -1, -1, -1},
+    {56, 38, 26, -1, -1, -1, -1, -1, -1},
+    {26, 48, 56, -1, -1, -1, -1, -1, -1},
+    {71, 50, 38, -1, -1, -1, -1, -1, -1},
+    {38, 56, 71, -1, -1, -1, -1, -1, -1},
+    {89, 70, 50, -1, -1, -1, -1, -1, -1},
+    {50, 71, 89, -1, -1, -1, -1, -1, -1},
+    {109, 87, 70, -1, -1, -1, -1, -1, -1},
+    {70, 89, 109, -1, -1, -1, -1, -1, -1},
+    {140, 108, 87, -1, -1, -1, -1, -1, -1},
+    {87, 109, 140, -1, -1, -1, -1, -1, -1},
+    {162, 136, 108, -1, -1, -1, -1, -1, -1},
+    {108, 140, 162, -1, -1, -1, -1, -1, -1},
+    {171, 152, 136, -1, -1, -1, -1, -1, -1},
+    {136, 162, 171, -1, -1, -1, -1, -1, -1},
+    {175, 158, 152, -1, -1, -1, -1, -1, -1},
+    {152, 171, 175, -1, -1, -1, -1, -1, -1},
+    {68, 35, 33, -1, -1, -1, -1, -1, -1},
+    {33, 66, 68, -1, -1, -1, -1, -1, -1},
+    {78, 48, 35, -1, -1, -1, -1, -1, -1},
+    {35, 68, 78, -1, -1, -1, -1, -1, -1},
+    {86, 56, 48, -1, -1, -1, -1, -1, -1},
+    {48, 78, 86, -1, -1, -1, -1, -1, -1},
+    {106, 71, 56, -1, -1, -1, -1, -1, -1},
+    {56, 86, 106, -1, -1, -1, -1, -1, -1},
+    {128, 89, 71, -1, -1, -1, -1, -1, -1},
+    {71, 106, 128, -1, -1, -1, -1, -1, -1},
+    {156, 109, 89, -1, -1, -1, -1, -1, -1},
+    {89, 128, 156, -1, -1, -1, -1, -1, -1},
+    {174, 140, 109, -1, -1, -1, -1, -1, -1},
+    {109, 156, 174, -1, -1, -1, -1, -1, -1},
+    {184, 162, 140, -1, -1, -1, -1, -1, -1},
+    {140, 174, 184, -1, -1, -1, -1, -1, -1},
+    {194, 171, 162, -1, -1, -1, -1, -1, -1},
+    {162, 184, 194, -1, -1, -1, -1, -1, -1},
+    {201, 175, 171, -1, -1, -1, -1, -1, -1},
+    {171, 194, 201, -1, -1, -1, -1, -1, -1},
+    {119, 68, 66, -1, -1, -1, -1, -1, -1},
+    {66, 113, 119, -1, -1, -1, -1, -1, -1},
+    {130, 78, 68, -1, -1, -1, -1, -1, -1},
+    {68, 119, 130, -1, -1, -1, -1, -1, -1},
+    {148, 86, 78, -1, -1, -1, -1, -1, -1},
+    {78, 130, 148, -1, -1, -1, -1, -1, -1},
+    {164, 106, 86, -1, -1, -1, -1, -1, -1},
+    {86, 148, 164, -1, -1, -1, -1, -1, -1},
+    {178, 128, 106, -1, -1, -1, -1, -1, -1},
+    {106, 164, 178, -1, -1, -1, -1, -1, -1},
+    {192, 156, 128, -1, -1, -1, -1, -1, -1},
+    {128, 178, 192, -1, -1, -1, -1, -1, -1},
+    {206, 174, 156, -1, -1, -1, -1, -1, -1},
+    {156, 192, 206, -1, -1, -1, -1, -1, -1},
+    {216, 184, 174, -1, -1, -1, -1, -1, -1},
+    {174, 206, 216, -1, -1, -1, -1, -1, -1},
+    {219, 194, 184, -1, -1, -1, -1, -1, -1},
+    {184, 216, 219, -1, -1, -1, -1, -1, -1},
+    {223, 201, 194, -1, -1, -1, -1, -1, -1},
+    {194, 219, 223, -1, -1, -1, -1, -1, -1},
+    {189, 119, 113, -1, -1, -1, -1, -1, -1},
+    {113, 188, 189, -1, -1, -1, -1, -1, -1},
+    {203, 130, 119, -1, -1, -1, -1, -1, -1},
+    {119, 189, 203, -1, -1, -1, -1, -1, -1},
+    {210, 148, 130, -1, -1, -1, -1, -1, -1},
+    {130, 203, 210, -1, -1, -1, -1, -1, -1},
+    {213, 164, 148, -1, -1, -1, -1, -1, -1},
+    {148, 210, 213, -1, -1, -1, -1, -1, -1},
+    {225, 178, 164, -1, -1, -1, -1, -1, -1},
+    {164, 213, 225, -1, -1, -1, -1, -1, -1},
+    {231, 192, 178, -1, -1, -1, -1, -1, -1},
+    {178, 225, 231, -1, -1, -1, -1, -1, -1},
+    {236, 206, 192, -1, -1, -1, -1, -1, -1},
+    {192, 231, 236, -1, -1, -1, -1, -1, -1},
+    {240, 216, 206, -1, -1, -1, -1, -1, -1},
+    {206, 236, 240, -1, -1, -1, -1, -1, -1},
+    {242, 219, 216, -1, -1, -1, -1, -1, -1},
+    {216, 240, 242, -1, -1, -1, -1, -1, -1},
+    {247, 223, 219, -1, -1, -1, -1, -1, -1},
+    {219, 242, 247, -1, -1, -1, -1, -1, -1},
+    {245, 189, 188, -1, -1, -1, -1, -1, -1},
+    {188, 241, 245, -1, -1, -1, -1, -1, -1},
+    {253, 203, 189, -1, -1, -1, -1, -1, -1},
+    {189, 245, 253, -1, -1, -1, -1, -1, -1},
+    {256, 210, 203, -1, -1, -1, -1, -1, -1},
+    {203, 253, 256, -1, -1, -1, -1, -1, -1},
+    {263, 213, 210, -1, -1, -1, -1, -1, -1},
+    {210, 256, 263, -1, -1, -1, -1, -1, -1},
+    {267, 225, 213, -1, -1, -1, -1, -1, -1},
+    {213, 263, 267, -1, -1, -1, -1, -1, -1},
+    {273, 231, 225, -1, -1, -1, -1, -1, -1},
+    {225, 267, 273, -1, -1, -1, -1, -1, -1},
+    {277, 236, 231, -1, -1, -1, -1, -1, -1},
+    {231, 273, 277, -1, -1, -1, -1, -1, -1},
+    {279, 240, 236, -1, -1, -1, -1, -1, -1},
+    {236, 277, 279, -1, -1, -1, -1, -1, -1},
+    {282, 242, 240, -1, -1, -1, -1, -1, -1},
+    {240, 279, 282, -1, -1, -1, -1, -1, -1},
+    {284, 247, 242, -1, -1, -1, -1, -1, -1},
+    {242, 282, 284, -1, -1, -1, -1, -1, -1},
+    {293, 245, 241, -1, -1, -1, -1, -1, -1},
+    {241, 291, 293, -1, -1, -1, -1, -1, -1},
+    {295, 253, 245, -1, -1, -1, -1, -1, -1},
+    {245, 293, 295, -1, -1, -1, -1, -1, -1},
+    {299, 256, 253, -1, -1, -1, -1, -1, -1},
+    {253, 295, 299, -1, -1, -1, -1, -1, -1},
+    {303, 263, 256, -1, -1, -1, -1, -1, -1},
+    {256, 299, 303, -1, -1, -1, -1, -1, -1},
+    {305, 267, 263, -1, -1, -1, -1, -1, -1},
+    {263, 303, 305, -1, -1, -1, -1, -1, -1},
+    {307, 273, 267, -1, -1, -1, -1, -1, -1},
+    {267, 305, 307, -1, -1, -1, -1, -1, -1},
+    {309, 277, 273, -1, -1, -1, -1, -1, -1},
+    {273, 307, 309, -1, -1, -1, -1, -1, -1},
+    {312, 279, 277, -1, -1, -1, -1, -1, -1},
+    {277, 309, 312, -1, -1, -1, -1, -1, -1},
+    {313, 282, 279, -1, -1, -1, -1, -1, -1},
+    {279, 312, 313, -1, -1, -1, -1, -1, -1},
+    {316, 284, 282, -1, -1, -1, -1, -1, -1},
+    {282, 313, 316, -1, -1, -1, -1, -1, -1},
+    {355, 293, 291, -1, -1, -1, -1, -1, -1},
+    {291, 357, 355, -1, -1, -1, -1, -1, -1},
+    {353, 295, 293, -1, -1, -1, -1, -1, -1},
+    {293, 355, 353, -1, -1, -1, -1, -1, -1},
+    {351, 299, 295, -1, -1, -1, -1, -1, -1},
+    {295, 353, 351, -1, -1, -1, -1, -1, -1},
+    {349, 303, 299, -1, -1, -1, -1, -1, -1},
+    {299, 351, 349, -1, -1, -1, -1, -1, -1},
+    {347, 305, 303, -1, -1, -1, -1, -1, -1},
+    {303, 349, 347, -1, -1, -1, -1, -1, -1},
+    {345, 307, 305, -1, -1, -1, -1, -1, -1},
+    {305, 347, 345, -1, -1, -1, -1, -1, -1},
+    {343, 309, 307, -1, -1, -1, -1, -1, -1},
+    {307, 345, 343, -1, -1, -1, -1, -1, -1},
+    {341, 312, 309, -1, -1, -1, -1, -1, -1},
+    {309, 343, 341, -1, -1, -1, -1, -1, -1},
+    {339, 313, 312, -1, -1, -1, -1, -1, -1},
+    {312, 341, 339, -1, -1, -1, -1, -1, -1},
+    {337, 316, 313, -1, -1, -1, -1, -1, -1},
+    {313, 339, 337, -1, -1, -1, -1, -1, -1},
+    {423, 355, 357, -1, -1, -1, -1, -1, -1},
+    {357, 425, 423, -1, -1, -1, -1, -1, -1},
+    {421, 353, 355, -1, -1, -1, -1, -1, -1},
+    {355, 423, 421, -1, -1, -1, -1, -1, -1},
+    {417, 351, 353, -1, -1, -1, -1, -1, -1},
+    {353, 421, 417, -1, -1, -1, -1, -1, -1},
+    {413, 349, 351, -1, -1, -1, -1, -1, -1},
+    {351, 417, 413, -1, -1, -1, -1, -1, -1},
+    {406, 347, 349, -1, -1, -1, -1, -1, -1},
+    {349, 413, 406, -1, -1, -1, -1, -1, -1},
+    {401, 345, 347, -1, -1, -1, -1, -1, -1},
+    {347, 406, 401, -1, -1, -1, -1, -1, -1},
+    {392, 343, 345, -1, -1, -1, -1, -1, -1},
+    {345, 401, 392, -1, -1, -1, -1, -1, -1},
+    {382, 341, 343, -1, -1, -1, -1, -1, -1},
+    {343, 392, 382, -1, -1, -1, -1, -1, -1},
+    {376, 339, 341, -1, -1, -1, -1, -1, -1},
+    {341, 382, 376, -1, -1, -1, -1, -1, -1},
+    {374, 337, 339, -1, -1, -1, -1, -1, -1},
+    {339, 376, 374, -1, -1, -1, -1, -1, -1},
+    {3185, 3112, 3114, -1, -1, -1, -1, -1, -1},
+    {3114, 3181, 3185, -1, -1, -1, -1, -1, -1},
+    {3191, 3109, 3112, -1, -1, -1, -1, -1, -1},
+    {3112, 3185, 3191, -1, -1, -1, -1, -1, -1},
+    {3195, 3108, 3109, -1, -1, -1, -1, -1, -1},
+    {3109, 3191, 3195, -1, -1, -1, -1, -1, -1},
+    {3204, 3105, 3108, -1, -1, -1, -1, -1, -1},
+    {3108, 3195, 3204, -1, -1, -1, -1, -1, -1},
+    {3210, 3103, 3105, -1, -1, -1, -1, -1, -1},
+    {3105, 3204, 3210, -1, -1, -1, -1, -1, -1},
+    {3214, 3101, 3103, -1, -1, -1, -1, -1, -1},
+    {3103, 3210, 3214, -1, -1, -1, -1, -1, -1},
+    {3216, 3100, 3101, -1, -1, -1, -1, -1, -1},
+    {3101, 3214, 3216, -1, -1, -1, -1, -1, -1},
+    {3219, 3097, 3100, -1, -1, -1, -1, -1, -1},
+    {3100, 3216, 3219, -1, -1, -1, -1, -1, -1},
+    {3221, 3096, 3097, -1, -1, -1, -1, -1, -1},
+    {3097, 3219, 3221, -1, -1, -1, -1, -1, -1},
+    {3222, 3094, 3096, -1, -1, -1, -1, -1, -1},
+    {3096, 3221, 3222, -1, -1, -1, -1, -1, -1},
+    {3226, 3185, 3181, -1, -1, -1, -1, -1, -1},
+    {3181, 3224, 3226, -1, -1, -1, -1, -1, -1},
+    {3228, 3191, 3185, -1, -1, -1, -1, -1, -1},
+    {3185, 3226, 3228, -1, -1, -1, -1, -1, -1},
+    {3230, 3195, 3191, -1, -1, -1, -1, -1, -1},
+    {3191, 3228, 3230, -1, -1, -1, -1, -1, -1},
+    {3232, 3204, 3195, -1, -1, -1, -1, -1, -1},
+    {3195, 3230, 3232, -1, -1, -1, -1, -1, -1},
+    {3234, 3210, 3204, -1, -1, -1, -1, -1, -1},
+    {3204, 3232, 3234, -1, -1, -1, -1, -1, -1},
+    {3240, 3214, 3210, -1, -1, -1, -1, -1, -1},
+    {3210, 3234, 3240, -1, -1, -1, -1, -1, -1},
+    {3244, 3216, 3214, -1, -1, -1, -1, -1, -1},
+    {3214, 3240, 3244, -1, -1, -1, -1, -1, -1},
+    {3248, 3219, 3216, -1, -1, -1, -1, -1, -1},
+    {3216, 3244, 3248, -1, -1, -1, -1, -1, -1},
+    {3250, 3221, 3219, -1, -1, -1, -1, -1, -1},
+    {3219, 3248, 3250, -1, -1, -1, -1, -1, -1},
+    {3252, 3222, 3221, -1, -1, -1, -1, -1, -1},
+    {3221, 3250, 3252, -1, -1, -1, -1, -1, -1},
+    {3238, 3226, 3224, -1, -1, -1, -1, -1, -1},
+    {3224, 3236, 3238, -1, -1, -1, -1, -1, -1},
+    {3242, 3228, 3226, -1, -1, -1, -1, -1, -1},
+    {3226, 3238, 3242, -1, -1, -1, -1, -1, -1},
+    {3246, 3230, 3228, -1, -1, -1, -1, -1, -1},
+    {3228, 3242, 3246, -1, -1, -1, -1, -1, -1},
+    {3256, 3232, 3230, -1, -1, -1, -1, -1, -1},
+    {3230, 3246, 3256, -1, -1, -1, -1, -1, -1},
+    {3262, 3234, 3232, -1, -1, -1, -1, -1, -1},
+    {3232, 3256, 3262, -1, -1, -1, -1, -1, -1},
+    {3270, 3240, 3234, -1, -1, -1, -1, -1, -1},
+    {3234, 3262, 3270, -1, -1, -1, -1, -1, -1},
+    {3278, 3244, 3240, -1, -1, -1, -1, -1, -1},
+    {3240, 3270, 3278, -1, -1, -1, -1, -1, -1},
+    {3284, 3248, 3244, -1, -1, -1, -1, -1, -1},
+    {3244, 3278, 3284, -1, -1, -1, -1, -1, -1},
+    {3292, 3250, 3248, -1, -1, -1, -1, -1, -1},
+    {3248, 3284, 3292, -1, -1, -1, -1, -1, -1},
+    {3296, 3252, 3250, -1, -1, -1, -1, -1, -1},
+    {3250, 3292, 3296, -1, -1, -1, -1, -1, -1},
+    {3258, 3238, 3236, -1, -1, -1, -1, -1, -1},
+    {3236, 3254, 3258, -1, -1, -1, -1, -1, -1},
+    {3260, 3242, 3238, -1, -1, -1, -1, -1, -1},
+    {3238, 3258, 3260, -1, -1, -1, -1, -1, -1},
+    {3264, 3246, 3242, -1, -1, -1, -1, -1, -1},
+    {3242, 3260, 3264, -1, -1, -1, -1, -1, -1},
+    {3274, 3256, 3246, -1, -1, -1, -1, -1, -1},
+    {3246, 3264, 3274, -1, -1, -1, -1, -1, -1},
+    {3286, 3262, 3256, -1, -1, -1, -1, -1, -1},
+    {3256, 3274, 3286, -1, -1, -1, -1, -1, -1},
+    {3302, 3270, 3262, -1, -1, -1, -1, -1, -1},
+    {3262, 3286, 3302, -1, -1, -1, -1, -1, -1},
+    {3313, 3278, 3270, -1, -1, -1, -1, -1, -1},
+    {3270, 3302, 3313, -1, -1, -1, -1, -1, -1},
+    {3319, 3284, 3278, -1, -1, -1, -1, -1, -1},
+    {3278, 3313, 3319, -1, -1, -1, -1, -1, -1},
+    {3329, 3292, 3284, -1, -1, -1, -1, -1, -1},
+    {3284, 3319, 3329, -1, -1, -1, -1, -1, -1},
+    {3331, 3296, 3292, -1, -1, -1, -1, -1, -1},
+    {3292, 3329, 3331, -1, -1, -1, -1, -1, -1},
+    {3269, 3258, 3254, -1, -1, -1, -1, -1, -1},
+    {3254, 3267, 3269, -1, -1, -1, -1, -1, -1},
+    {3272, 3260, 3258, -1, -1, -1, -1, -1, -1},
+    {3258, 3269, 3272, -1, -1, -1, -1, -1, -1},
+    {3282, 3264, 3260, -1, -1, -1, -1, -1, -1},
+    {3260, 3272, 3282, -1, -1, -1, -1, -1, -1},
+    {3298, 3274, 3264, -1, -1, -1, -1, -1, -1},
+    {3264, 3282, 3298, -1, -1, -1, -1, -1, -1},
+    {3307, 3286, 3274, -1, -1, -1, -1, -1, -1},
+    {3274, 3298, 3307, -1, -1, -1, -1, -1, -1},
+    {3321, 3302, 3286, -1, -1, -1, -1, -1, -1},
+    {3286, 3307, 3321, -1, -1, -1, -1, -1, -1},
+    {3337, 3313, 3302, -1, -1, -1, -1, -1, -1},
+    {3302, 3321, 3337, -1, -1, -1, -1, -1, -1},
+    {3345, 3319, 3313, -1, -1, -1, -1, -1, -1},
+    {3313, 3337, 3345, -1, -1, -1, -1, -1, -1},
+    {3350, 3329, 3319, -1, -1, -1, -1, -1, -1},
+    {3319, 3345, 3350, -1, -1, -1, -1, -1, -1},
+    {3354, 3331, 3329, -1, -1, -1, -1, -1, -1},
+    {3329, 3350, 3354, -1, -1, -1, -1, -1, -1},
+    {3281, 3269, 3267, -1, -1, -1, -1, -1, -1},
+    {3267, 3277, 3281, -1, -1, -1, -1, -1, -1},
+    {3289, 3272, 3269, -1, -1, -1, -1, -1, -1},
+    {3269, 3281, 3289, -1, -1, -1, -1, -1, -1},
+    {3301, 3282, 3272, -1, -1, -1, -1, -1, -1},
+    {3272, 3289, 3301, -1, -1, -1, -1, -1, -1},
+    {3311, 3298, 3282, -1, -1, -1, -1, -1, -1},
+    {3282, 3301, 3311, -1, -1, -1, -1, -1, -1},
+    {3323, 3307, 3298, -1, -1, -1, -1, -1, -1},
+    {3298, 3311, 3323, -1, -1, -1, -1, -1, -1},
+    {3339, 3321, 3307, -1, -1, -1, -1, -1, -1},
+    {3307, 3323, 3339, -1, -1, -1, -1, -1, -1},
+    {3352, 3337, 3321, -1, -1, -1, -1, -1, -1},
+    {3321, 3339, 3352, -1, -1, -1, -1, -1, -1},
+    {3367, 3345, 3337, -1, -1, -1, -1, -1, -1},
+    {3337, 3352, 3367, -1, -1, -1, -1, -1, -1},
+    {3372, 3350, 3345, -1, -1, -1, -1, -1, -1},
+    {3345, 3367, 3372, -1, -1, -1, -1, -1, -1},
+    {3378, 3354, 3350, -1, -1, -1, -1, -1, -1},
+    {3350, 3372, 3378, -1, -1, -1, -1, -1, -1},
+    {3294, 3281, 3277, -1, -1, -1, -1, -1, -1},
+    {3277, 3291, 3294, -1, -1, -1, -1, -1, -1},
+    {3305, 3289, 3281, -1, -1, -1, -1, -1, -1},
+    {3281, 3294, 3305, -1, -1, -1, -1, -1, -1},
+    {3315, 3301, 3289, -1, -1, -1, -1, -1, -1},
+    {3289, 3305, 3315, -1, -1, -1, -1, -1, -1},
+    {3325, 3311, 3301, -1, -1, -1, -1, -1, -1},
+    {3301, 3315, 3325, -1, -1, -1, -1, -1, -1},
+    {3344, 3323, 3311, -1, -1, -1, -1, -1, -1},
+    {3311, 3325, 3344, -1, -1, -1, -1, -1, -1},
+    {3358, 3339, 3323, -1, -1, -1, -1, -1, -1},
+    {3323, 3344, 3358, -1, -1, -1, -1, -1, -1},
+    {3375, 3352, 3339, -1, -1, -1, -1, -1, -1},
+    {3339, 3358, 3375, -1, -1, -1, -1, -1, -1},
+    {3393, 3367, 3352, -1, -1, -1, -1, -1, -1},
+    {3352, 3375, 3393, -1, -1, -1, -1, -1, -1},
+    {3403, 3372, 3367, -1, -1, -1, -1, -1, -1},
+    {3367, 3393, 3403, -1, -1, -1, -1, -1, -1},
+    {3405, 3378, 3372, -1, -1, -1, -1, -1, -1},
+    {3372, 3403, 3405, -1, -1, -1, -1, -1, -1},
+    {3309, 3294, 3291, -1, -1, -1, -1, -1, -1},
+    {3291, 3306, 3309, -1, -1, -1, -1, -1, -1},
+    {3317, 3305, 3294, -1, -1, -1, -1, -1, -1},
+    {3294, 3309, 3317, -1, -1, -1, -1, -1, -1},
+    {3335, 3315, 3305, -1, -1, -1, -1, -1, -1},
+    {3305, 3317, 3335, -1, -1, -1, -1, -1, -1},
+    {3347, 3325, 3315, -1, -1, -1, -1, -1, -1},
+    {3315, 3335, 3347, -1, -1, -1, -1, -1, -1},
+    {3368, 3344, 3325, -1, -1, -1, -1, -1, -1},
+    {3325, 3347, 3368, -1, -1, -1, -1, -1, -1},
+    {3388, 3358, 3344, -1, -1, -1, -1, -1, -1},
+    {3344, 3368, 3388, -1, -1, -1, -1, -1, -1},
+    {3424, 3375, 3358, -1, -1, -1, -1, -1, -1},
+    {3358, 3388, 3424, -1, -1, -1, -1, -1, -1},
+    {3448, 3393, 3375, -1, -1, -1, -1, -1, -1},
+    {3375, 3424, 3448, -1, -1, -1, -1, -1, -1},
+    {3467, 3403, 3393, -1, -1, -1, -1, -1, -1},
+    {3393, 3448, 3467, -1, -1, -1, -1, -1, -1},
+    {3471, 3405, 3403, -1, -1, -1, -1, -1, -1},
+    {3403, 3467, 3471, -1, -1, -1, -1, -1, -1},
+    {3334, 3309, 3306, -1, -1, -1, -1, -1, -1},
+    {3306, 3328, 3334, -1, -1, -1, -1, -1, -1},
+    {3342, 3317, 3309, -1, -1, -1, -1, -1, -1},
+    {3309, 3334, 3342, -1, -1, -1, -1, -1, -1},
+    {3361, 3335, 3317, -1, -1, -1, -1, -1, -1},
+    {3317, 3342, 3361, -1, -1, -1, -1, -1, -1},
+    {3385, 3347, 3335, -1, -1, -1, -1, -1, -1},
+    {3335, 3361, 3385, -1, -1, -1, -1, -1, -1},
+    {3421, 3368, 3347, -1, -1, -1, -1, -1, -1},
+    {3347, 3385, 3421, -1, -1, -1, -1, -1, -1},
+    {3463, 3388, 3368, -1, -1, -1, -1, -1, -1},
+    {3368, 3421, 3463, -1, -1, -1, -1, -1, -1},
+    {3489, 3424, 3388, -1, -1, -1, -1, -1, -1},
+    {3388, 3463, 3489, -1, -1, -1, -1, -1, -1},
+    {3504, 3448, 3424, -1, -1, -1, -1, -1, -1},
+    {3424, 3489, 3504, -1, -1, -1, -1, -1, -1},
+    {3520, 3467, 3448, -1, -1, -1, -1, -1, -1},
+    {3448, 3504, 3520, -1, -1, -1, -1, -1, -1},
+    {3522, 3471, 3467, -1, -1, -1, -1, -1, -1},
+    {3467, 3520, 3522, -1, -1, -1, -1, -1, -1},
+    {3363, 3334, 3328, -1, -1, -1, -1, -1, -1},
+    {3328, 3356, 3363, -1, -1, -1, -1, -1, -1},
+    {3381, 3342, 3334, -1, -1, -1, -1, -1, -1},
+    {3334, 3363, 3381, -1, -1, -1, -1, -1, -1},
+    {3415, 3361, 3342, -1, -1, -1, -1, -1, -1},
+    {3342, 3381, 3415, -1, -1, -1, -1, -1, -1},
+    {3464, 3385, 3361, -1, -1, -1, -1, -1, -1},
+    {3361, 3415, 3464, -1, -1, -1, -1, -1, -1},
+    {3494, 3421, 3385, -1, -1, -1, -1, -1, -1},
+    {3385, 3464, 3494, -1, -1, -1, -1, -1, -1},
+    {3527, 3463, 3421, -1, -1, -1, -1, -1, -1},
+    {3421, 3494, 3527, -1, -1, -1, -1, -1, -1},
+    {3552, 3489, 3463, -1, -1, -1, -1, -1, -1},
+    {3463, 3527, 3552, -1, -1, -1, -1, -1, -1},
+    {3578, 3504, 3489, -1, -1, -1, -1, -1, -1},
+    {3489, 3552, 3578, -1, -1, -1, -1, -1, -1},
+    {3591, 3520, 3504, -1, -1, -1, -1, -1, -1},
+    {3504, 3578, 3591, -1, -1, -1, -1, -1, -1},
+    {3603, 3522, 3520, -1, -1, -1, -1, -1, -1},
+    {3520, 3591, 3603, -1, -1, -1, -1, -1, -1},
+    {3220, 3095, 3093, -1, -1, -1, -1, -1, -1},
+    {3093, 3223, 3220, -1, -1, -1, -1, -1, -1},
+    {3218, 3098, 3095, -1, -1, -1, -1, -1, -1},
+    {3095, 3220, 3218, -1, -1, -1, -1, -1, -1},
+    {3217, 3099, 3098, -1, -1, -1, -1, -1, -1},
+    {3098, 3218, 3217, -1, -1, -1, -1, -1, -1},
+    {3215, 3102, 3099, -1, -1, -1, -1, -1, -1},
+    {3099, 3217, 3215, -1, -1, -1, -1, -1, -1},
+    {3211, 3104, 3102, -1, -1, -1, -1, -1, -1},
+    {3102, 3215, 3211, -1, -1, -1, -1, -1, -1},
+    {3205, 3106, 3104, -1, -1, -1, -1, -1, -1},
+    {3104, 3211, 3205, -1, -1, -1, -1, -1, -1},
+    {3196, 3107, 3106, -1, -1, -1, -1, -1, -1},
+    {3106, 3205, 3196, -1, -1, -1, -1, -1, -1},
+    {3192, 3110, 3107, -1, -1, -1, -1, -1, -1},
+    {3107, 3196, 3192, -1, -1, -1, -1, -1, -1},
+    {3186, 3111, 3110, -1, -1, -1, -1, -1, -1},
+    {3110, 3192, 3186, -1, -1, -1, -1, -1, -1},
+    {3182, 3113, 3111, -1, -1, -1, -1, -1, -1},
+    {3111, 3186, 3182, -1, -1, -1, -1, -1, -1},
+    {3251, 3220, 3223, -1, -1, -1, -1, -1, -1},
+    {3223, 3253, 3251, -1, -1, -1, -1, -1, -1},
+    {3249, 3218, 3220, -1, -1, -1, -1, -1, -1},
+    {3220, 3251, 3249, -1, -1, -1, -1, -1, -1},
+    {3245, 3217, 3218, -1, -1, -1, -1, -1, -1},
+    {3218, 3249, 3245, -1, -1, -1, -1, -1, -1},
+    {3241, 3215, 3217, -1, -1, -1, -1, -1, -1},
+    {3217, 3245, 3241, -1, -1, -1, -1, -1, -1},
+    {3235, 3211, 3215, -1, -1, -1, -1, -1, -1},
+    {3215, 3241, 3235, -1, -1, -1, -1, -1, -1},
+    {3233, 3205, 3211, -1, -1, -1, -1, -1, -1},
+    {3211, 3235, 3233, -1, -1, -1, -1, -1, -1},
+    {3231, 3196, 3205, -1, -1, -1, -1, -1, -1},
+    {3205, 3233, 3231, -1, -1, -1, -1, -1, -1},
+    {3229, 3192, 3196, -1, -1, -1, -1, -1, -1},
+    {3196, 3231, 3229, -1, -1, -1, -1, -1, -1},
+    {3227, 3186, 3192, -1, -1, -1, -1, -1, -1},
+    {3192, 3229, 3227, -1, -1, -1, -1, -1, -1},
+    {3225, 3182, 3186, -1, -1, -1, -1, -1, -1},
+    {3186, 3227, 3225, -1, -1, -1, -1, -1, -1},
+    {3293, 3251, 3253, -1, -1, -1, -1, -1, -1},
+    {3253, 3297, 3293, -1, -1, -1, -1, -1, -1},
+    {3285, 3249, 3251, -1, -1, -1, -1, -1, -1},
+    {3251, 3293, 3285, -1, -1, -1, -1, -1, -1},
+    {3279, 3245, 3249, -1, -1, -1, -1, -1, -1},
+    {3249, 3285, 3279, -1, -1, -1, -1, -1, -1},
+    {3271, 3241, 3245, -1, -1, -1, -1, -1, -1},
+    {3245, 3279, 3271, -1, -1, -1, -1, -1, -1},
+    {3263, 3235, 3241, -1, -1, -1, -1, -1, -1},
+    {3241, 3271, 3263, -1, -1, -1, -1, -1, -1},
+    {3257, 3233, 3235, -1, -1, -1, -1, -1, -1},
+    {3235, 3263, 3257, -1, -1, -1, -1, -1, -1},
+    {3247, 3231, 3233, -1, -1, -1, -1, -1, -1},
+    {3233, 3257, 3247, -1, -1, -1, -1, -1, -1},
+    {3243, 3229, 3231, -1, -1, -1, -1, -1, -1},
+    {3231, 3247, 3243, -1, -1, -1, -1, -1, -1},
+    {3239, 3227, 3229, -1, -1, -1, -1, -1, -1},
+    {3229, 3243, 3239, -1, -1, -1, -1, -1, -1},
+    {3237, 3225, 3227, -1, -1, -1, -1, -1, -1},
+    {3227, 3239, 3237, -1, -1, -1, -1, -1, -1},
+    {3330, 3293, 3297, -1, -1, -1, -1, -1, -1},
+    {3297, 3332, 3330, -1, -1, -1, -1, -1, -1},
+    {3320, 3285, 3293, -1, -1, -1, -1, -1, -1},
+    {3293, 3330, 3320, -1, -1, -1, -1, -1, -1},
+    {3314, 3279, 3285, -1, -1, -1, -1, -1, -1},
+    {3285, 3320, 3314, -1, -1, -1, -1, -1, -1},
+    {3303, 3271, 3279, -1, -1, -1, -1, -1, -1},
+    {3279, 3314, 3303, -1, -1, -1, -1, -1, -1},
+    {3287, 3263, 3271, -1, -1, -1, -1, -1, -1},
+    {3271, 3303, 3287, -1, -1, -1, -1, -1, -1},
+    {3275, 3257, 3263, -1, -1, -1, -1, -1, -1},
+    {3263, 3287, 3275, -1, -1, -1, -1, -1, -1},
+    {3265, 3247, 3257, -1, -1, -1, -1, -1, -1},
+    {3257, 3275, 3265, -1, -1, -1, -1, -1, -1},
+    {3261, 3243, 3247, -1, -1, -1, -1, -1, -1},
+    {3247, 3265, 3261, -1, -1, -1, -1, -1, -1},
+    {3259, 3239, 3243, -1, -1, -1, -1, -1, -1},
+    {3243, 3261, 3259, -1, -1, -1, -1, -1, -1},
+    {3255, 3237, 3239, -1, -1, -1, -1, -1, -1},
+    {3239, 3259, 3255, -1, -1, -1, -1, -1, -1},
+    {3349, 3330, 3332, -1, -1, -1, -1, -1, -1},
+    {3332, 3353, 3349, -1, -1, -1, -1, -1, -1},
+    {3346, 3320, 3330, -1, -1, -1, -1, -1, -1},
+    {3330, 3349, 3346, -1, -1, -1, -1, -1, -1},
+    {3338, 3314, 3320, -1, -1, -1, -1, -1, -1},
+    {3320, 3346, 3338, -1, -1, -1, -1, -1, -1},
+    {3322, 3303, 3314, -1, -1, -1, -1, -1, -1},
+    {3314, 3338, 3322, -1, -1, -1, -1, -1, -1},
+    {3308, 3287, 3303, -1, -1, -1, -1, -1, -1},
+    {3303, 3322, 3308, -1, -1, -1, -1, -1, -1},
+    {3299, 3275, 3287, -1, -1, -1, -1, -1, -1},
+    {3287, 3308, 3299, -1, -1, -1, -1, -1, -1},
+    {3283, 3265, 3275, -1, -1, -1, -1, -1, -1},
+    {3275, 3299, 3283, -1, -1, -1, -1, -1, -1},
+    {3273, 3261, 3265, -1, -1, -1, -1, -1, -1},
+    {3265, 3283, 3273, -1, -1, -1, -1, -1, -1},
+    {3268, 3259, 3261, -1, -1, -1, -1, -1, -1},
+    {3261, 3273, 3268, -1, -1, -1, -1, -1, -1},
+    {3266, 3255, 3259, -1, -1, -1, -1, -1, -1},
+    {3259, 3268, 3266, -1, -1, -1, -1, -1, -1},
+    {3371, 3349, 3353, -1, -1, -1, -1, -1, -1},
+    {3353, 3377, 3371, -1, -1, -1, -1, -1, -1},
+    {3366, 3346, 3349, -1, -1, -1, -1, -1, -1},
+    {3349, 3371, 3366, -1, -1, -1, -1, -1, -1},
+    {3351, 3338, 3346, -1, -1, -1, -1, -1, -1},
+    {3346, 3366, 3351, -1, -1, -1, -1, -1, -1},
+    {3340, 3322, 3338, -1, -1, -1, -1, -1, -1},
+    {3338, 3351, 3340, -1, -1, -1, -1, -1, -1},
+    {3324, 3308, 3322, -1, -1, -1, -1, -1, -1},
+    {3322, 3340, 3324, -1, -1, -1, -1, -1, -1},
+    {3312, 3299, 3308, -1, -1, -1, -1, -1, -1},
+    {3308, 3324, 3312, -1, -1, -1, -1, -1, -1},
+    {3300, 3283, 3299, -1, -1, -1, -1, -1, -1},
+    {3299, 3312, 3300, -1, -1, -1, -1, -1, -1},
+    {3288, 3273, 3283, -1, -1, -1, -1, -1, -1},
+    {3283, 3300, 3288, -1, -1, -1, -1, -1, -1},
+    {3280, 3268, 3273, -1, -1, -1, -1, -1, -1},
+    {3273, 3288, 3280, -1, -1, -1, -1, -1, -1},
+    {3276, 3266, 3268, -1, -1, -1, -1, -1, -1},
+    {3268, 3280, 3276, -1, -1, -1, -1, -1, -1},
+    {3402, 3371, 3377, -1, -1, -1, -1, -1, -1},
+    {3377, 3404, 3402, -1, -1, -1, -1, -1, -1},
+    {3392, 3366, 3371, -1, -1, -1, -1, -1, -1},
+    {3371, 3402, 3392, -1, -1, -1, -1, -1, -1},
+    {3376, 3351, 3366, -1, -1, -1, -1, -1, -1},
+    {3366, 3392, 3376, -1, -1, -1, -1, -1, -1},
+    {3359, 3340, 3351, -1, -1, -1, -1, -1, -1},
+    {3351, 3376, 3359, -1, -1, -1, -1, -1, -1},
+    {3343, 3324, 3340, -1, -1, -1, -1, -1, -1},
+    {3340, 3359, 3343, -1, -1, -1, -1, -1, -1},
+    {3326, 3312, 3324, -1, -1, -1, -1, -1, -1},
+    {3324, 3343, 3326, -1, -1, -1, -1, -1, -1},
+    {3316, 3300, 3312, -1, -1, -1, -1, -1, -1},
+    {3312, 3326, 3316, -1, -1, -1, -1, -1, -1},
+    {3304, 3288, 3300, -1, -1, -1, -1, -1, -1},
+    {3300, 3316, 3304, -1, -1, -1, -1, -1, -1},
+    {3295, 3280, 3288, -1, -1, -1, -1, -1, -1},
+    {3288, 3304, 3295, -1, -1, -1, -1, -1, -1},
+    {3290, 3276, 3280, -1, -1, -1, -1, -1, -1},
+    {3280, 3295, 3290, -1, -1, -1, -1, -1, -1},
+    {3468, 3402, 3404, -1, -1, -1, -1, -1, -1},
+    {3404, 3471, 3468, -1, -1, -1, -1, -1, -1},
+    {3449, 3392, 3402, -1, -1, -1, -1, -1, -1},
+    {3402, 3468, 3449, -1, -1, -1, -1, -1, -1},
+    {3425, 3376, 3392, -1, -1, -1, -1, -1, -1},
+    {3392, 3449, 3425, -1, -1, -1, -1, -1, -1},
+    {3389, 3359, 3376, -1, -1, -1, -1, -1, -1},
+    {3376, 3425, 3389, -1, -1, -1, -1, -1, -1},
+    {3369, 3343, 3359, -1, -1, -1, -1, -1, -1},
+    {3359, 3389, 3369, -1, -1, -1, -1, -1, -1},
+    {3348, 3326, 3343, -1, -1, -1, -1, -1, -1},
+    {3343, 3369, 3348, -1, -1, -1, -1, -1, -1},
+    {3336, 3316, 3326, -1, -1, -1, -1, -1, -1},
+    {3326, 3348, 3336, -1, -1, -1, -1, -1, -1},
+    {3318, 3304, 3316, -1, -1, -1, -1, -1, -1},
+    {3316, 3336, 3318, -1, -1, -1, -1, -1, -1},
+    {3310, 3295, 3304, -1, -1, -1, -1, -1, -1},
+    {3304, 3318, 3310, -1, -1, -1, -1, -1, -1},
+    {3306, 3290, 3295, -1, -1, -1, -1, -1, -1},
+    {3295, 3310, 3306, -1, -1, -1, -1, -1, -1},
+    {3519, 3468, 3471, -1, -1, -1, -1, -1, -1},
+    {3471, 3521, 3519, -1, -1, -1, -1, -1, -1},
+    {3503, 3449, 3468, -1, -1, -1, -1, -1, -1},
+    {3468, 3519, 3503, -1, -1, -1, -1, -1, -1},
+    {3488, 3425, 3449, -1, -1, -1, -1, -1, -1},
+    {3449, 3503, 3488, -1, -1, -1, -1, -1, -1},
+    {3462, 3389, 3425, -1, -1, -1, -1, -1, -1},
+    {3425, 3488, 3462, -1, -1, -1, -1, -1, -1},
+    {3420, 3369, 3389, -1, -1, -1, -1, -1, -1},
+    {3389, 3462, 3420, -1, -1, -1, -1, -1, -1},
+    {3384, 3348, 3369, -1, -1, -1, -1, -1, -1},
+    {3369, 3420, 3384, -1, -1, -1, -1, -1, -1},
+    {3360, 3336, 3348, -1, -1, -1, -1, -1, -1},
+    {3348, 3384, 3360, -1, -1, -1, -1, -1, -1},
+    {3341, 3318, 3336, -1, -1, -1, -1, -1, -1},
+    {3336, 3360, 3341, -1, -1, -1, -1, -1, -1},
+    {3333, 3310, 3318, -1, -1, -1, -1, -1, -1},
+    {3318, 3341, 3333, -1, -1, -1, -1, -1, -1},
+    {3327, 3306, 3310, -1, -1, -1, -1, -1, -1},
+    {3310, 3333, 3327, -1, -1, -1, -1, -1, -1},
+    {3590, 3519, 3521, -1, -1, -1, -1, -1, -1},
+    {3521, 3602, 3590, -1, -1, -1, -1, -1, -1},
+    {3577, 3503, 3519, -1, -1, -1, -1, -1, -1},
+    {3519, 3590, 3577, -1, -1, -1, -1, -1, -1},
+    {3551, 3488, 3503, -1, -1, -1, -1, -1, -1},
+    {3503, 3577, 3551, -1, -1, -1, -1, -1, -1},
+    {3529, 3462, 3488, -1, -1, -1, -1, -1, -1},
+    {3488, 3551, 3529, -1, -1, -1, -1, -1, -1},
+    {3498, 3420, 3462, -1, -1, -1, -1, -1, -1},
+    {3462, 3529, 3498, -1, -1, -1, -1, -1, -1},
+    {3466, 3384, 3420, -1, -1, -1, -1, -1, -1},
+    {3420, 3498, 3466, -1, -1, -1, -1, -1, -1},
+    {3414, 3360, 3384, -1, -1, -1, -1, -1, -1},
+    {3384, 3466, 3414, -1, -1, -1, -1, -1, -1},
+    {3380, 3341, 3360, -1, -1, -1, -1, -1, -1},
+    {3360, 3414, 3380, -1, -1, -1, -1, -1, -1},
+    {3362, 3333, 3341, -1, -1, -1, -1, -1, -1},
+    {3341, 3380, 3362, -1, -1, -1, -1, -1, -1},
+    {3355, 3327, 3333, -1, -1, -1, -1, -1, -1},
+    {3333, 3362, 3355, -1, -1, -1, -1, -1, -1},
+    {3373, 3364, 3357, -1, -1, -1, -1, -1, -1},
+    {3357, 3370, 3373, -1, -1, -1, -1, -1, -1},
+    {3394, 3382, 3364, -1, -1, -1, -1, -1, -1},
+    {3364, 3373, 3394, -1, -1, -1, -1, -1, -1},
+    {3442, 3416, 3382, -1, -1, -1, -1, -1, -1},
+    {3382, 3394, 3442, -1, -1, -1, -1, -1, -1},
+    {3480, 3465, 3416, -1, -1, -1, -1, -1, -1},
+    {3416, 3442, 3480, -1, -1, -1, -1, -1, -1},
+    {3513, 3495, 3465, -1, -1, -1, -1, -1, -1},
+    {3465, 3480, 3513, -1, -1, -1, -1, -1, -1},
+    {3544, 3528, 3495, -1, -1, -1, -1, -1, -1},
+    {3495, 3513, 3544, -1, -1, -1, -1, -1, -1},
+    {3572, 3550, 3528, -1, -1, -1, -1, -1, -1},
+    {3528, 3544, 3572, -1, -1, -1, -1, -1, -1},
+    {3596, 3576, 3550, -1, -1, -1, -1, -1, -1},
+    {3550, 3572, 3596, -1, -1, -1, -1, -1, -1},
+    {3612, 3589, 3576, -1, -1, -1, -1, -1, -1},
+    {3576, 3596, 3612, -1, -1, -1, -1, -1, -1},
+    {3618, 3602, 3589, -1, -1, -1, -1, -1, -1},
+    {3589, 3612, 3618, -1, -1, -1, -1, -1, -1},
+    {3386, 3373, 3370, -1, -1, -1, -1, -1, -1},
+    {3370, 3379, 3386, -1, -1, -1, -1, -1, -1},
+    {3412, 3394, 3373, -1, -1, -1, -1, -1, -1},
+    {3373, 3386, 3412, -1, -1, -1, -1, -1, -1},
+    {3460, 3442, 3394, -1, -1, -1, -1, -1, -1},
+    {3394, 3412, 3460, -1, -1, -1, -1, -1, -1},
+    {3492, 3480, 3442, -1, -1, -1, -1, -1, -1},
+    {3442, 3460, 3492, -1, -1, -1, -1, -1, -1},
+    {3523, 3513, 3480, -1, -1, -1, -1, -1, -1},
+    {3480, 3492, 3523, -1, -1, -1, -1, -1, -1},
+    {3555, 3544, 3513, -1, -1, -1, -1, -1, -1},
+    {3513, 3523, 3555, -1, -1, -1, -1, -1, -1},
+    {3583, 3572, 3544, -1, -1, -1, -1, -1, -1},
+    {3544, 3555, 3583, -1, -1, -1, -1, -1, -1},
+    {3610, 3596, 3572, -1, -1, -1, -1, -1, -1},
+    {3572, 3583, 3610, -1, -1, -1, -1, -1, -1},
+    {3627, 3612, 3596, -1, -1, -1, -1, -1, -1},
+    {3596, 3610, 3627, -1, -1, -1, -1, -1, -1},
+    {3631, 3618, 3612, -1, -1, -1, -1, -1, -1},
+    {3612, 3627, 3631, -1, -1, -1, -1, -1, -1},
+    {3397, 3386, 3379, -1, -1, -1, -1, -1, -1},
+    {3379, 3390, 3397, -1, -1, -1, -1, -1, -1},
+    {3434, 3412, 3386, -1, -1, -1, -1, -1, -1},
+    {3386, 3397, 3434, -1, -1, -1, -1, -1, -1},
+    {3472, 3460, 3412, -1, -1, -1, -1, -1, -1},
+    {3412, 3434, 3472, -1, -1, -1, -1, -1, -1},
+    {3499, 3492, 3460, -1, -1, -1, -1, -1, -1},
+    {3460, 3472, 3499, -1, -1, -1, -1, -1, -1},
+    {3530, 3523, 3492, -1, -1, -1, -1, -1, -1},
+    {3492, 3499, 3530, -1, -1, -1, -1, -1, -1},
+    {3561, 3555, 3523, -1, -1, -1, -1, -1, -1},
+    {3523, 3530, 3561, -1, -1, -1, -1, -1, -1},
+    {3594, 3583, 3555, -1, -1, -1, -1, -1, -1},
+    {3555, 3561, 3594, -1, -1, -1, -1, -1, -1},
+    {3616, 3610, 3583, -1, -1, -1, -1, -1, -1},
+    {3583, 3594, 3616, -1, -1, -1, -1, -1, -1},
+    {3632, 3627, 3610, -1, -1, -1, -1, -1, -1},
+    {3610, 3616, 3632, -1, -1, -1, -1, -1, -1},
+    {3640, 3631, 3627, -1, -1, -1, -1, -1, -1},
+    {3627, 3632, 3640, -1, -1, -1, -1, -1, -1},
+    {3408, 3397, 3390, -1, -1, -1, -1, -1, -1},
+    {3390, 3399, 3408, -1, -1, -1, -1, -1, -1},
+    {3446, 3434, 3397, -1, -1, -1, -1, -1, -1},
+    {3397, 3408, 3446, -1, -1, -1, -1, -1, -1},
+    {3476, 3472, 3434, -1, -1, -1, -1, -1, -1},
+    {3434, 3446, 3476, -1, -1, -1, -1, -1, -1},
+    {3505, 3499, 3472, -1, -1, -1, -1, -1, -1},
+    {3472, 3476, 3505, -1, -1, -1, -1, -1, -1},
+    {3539, 3530, 3499, -1, -1, -1, -1, -1, -1},
+    {3499, 3505, 3539, -1, -1, -1, -1, -1, -1},
+    {3566, 3561, 3530, -1, -1, -1, -1, -1, -1},
+    {3530, 3539, 3566, -1, -1, -1, -1, -1, -1},
+    {3600, 3594, 3561, -1, -1, -1, -1, -1, -1},
+    {3561, 3566, 3600, -1, -1, -1, -1, -1, -1},
+    {3623, 3616, 3594, -1, -1, -1, -1, -1, -1},
+    {3594, 3600, 3623, -1, -1, -1, -1, -1, -1},
+    {3638, 3632, 3616, -1, -1, -1, -1, -1, -1},
+    {3616, 3623, 3638, -1, -1, -1, -1, -1, -1},
+    {3643, 3640, 3632, -1, -1, -1, -1, -1, -1},
+    {3632, 3638, 3643, -1, -1, -1, -1, -1, -1},
+    {3432, 3408, 3399, -1, -1, -1, -1, -1, -1},
+    {3399, 3410, 3432, -1, -1, -1, -1, -1, -1},
+    {3452, 3446, 3408, -1, -1, -1, -1, -1, -1},
+    {3408, 3432, 3452, -1, -1, -1, -1, -1, -1},
+    {3482, 3476, 3446, -1, -1, -1, -1, -1, -1},
+    {3446, 3452, 3482, -1, -1, -1, -1, -1, -1},
+    {3509, 3505, 3476, -1, -1, -1, -1, -1, -1},
+    {3476, 3482, 3509, -1, -1, -1, -1, -1, -1},
+    {3542, 3539, 3505, -1, -1, -1, -1, -1, -1},
+    {3505, 3509, 3542, -1, -1, -1, -1, -1, -1},
+    {3568, 3566, 3539, -1, -1, -1, -1, -1, -1},
+    {3539, 3542, 3568, -1, -1, -1, -1, -1, -1},
+    {3598, 3600, 3566, -1, -1, -1, -1, -1, -1},
+    {3566, 3568, 3598, -1, -1, -1, -1, -1, -1},
+    {3621, 3623, 3600, -1, -1, -1, -1, -1, -1},
+    {3600, 3598, 3621, -1, -1, -1, -1, -1, -1},
+    {3636, 3638, 3623, -1, -1, -1, -1, -1, -1},
+    {3623, 3621, 3636, -1, -1, -1, -1, -1, -1},
+    {3641, 3643, 3638, -1, -1, -1, -1, -1, -1},
+    {3638, 3636, 3641, -1, -1, -1, -1, -1, -1},
+    {3438, 3432, 3410, -1, -1, -1, -1, -1, -1},
+    {3410, 3423, 3438, -1, -1, -1, -1, -1, -1},
+    {3457, 3452, 3432, -1, -1, -1, -1, -1, -1},
+    {3432, 3438, 3457, -1, -1, -1, -1, -1, -1},
+    {3486, 3482, 3452, -1, -1, -1, -1, -1, -1},
+    {3452, 3457, 3486, -1, -1, -1, -1, -1, -1},
+    {3512, 3509, 3482, -1, -1, -1, -1, -1, -1},
+    {3482, 3486, 3512, -1, -1, -1, -1, -1, -1},
+    {3541, 3542, 3509, -1, -1, -1, -1, -1, -1},
+    {3509, 3512, 3541, -1, -1, -1, -1, -1, -1},
+    {3565, 3568, 3542, -1, -1, -1, -1, -1, -1},
+    {3542, 3541, 3565, -1, -1, -1, -1, -1, -1},
+    {3592, 3598, 3568, -1, -1, -1, -1, -1, -1},
+    {3568, 3565, 3592, -1, -1, -1, -1, -1, -1},
+    {3615, 3621, 3598, -1, -1, -1, -1, -1, -1},
+    {3598, 3592, 3615, -1, -1, -1, -1, -1, -1},
+    {3629, 3636, 3621, -1, -1, -1, -1, -1, -1},
+    {3621, 3615, 3629, -1, -1, -1, -1, -1, -1},
+    {3635, 3641, 3636, -1, -1, -1, -1, -1, -1},
+    {3636, 3629, 3635, -1, -1, -1, -1, -1, -1},
+    {3440, 3438, 3423, -1, -1, -1, -1, -1, -1},
+    {3423, 3428, 3440, -1, -1, -1, -1, -1, -1},
+    {3458, 3457, 3438, -1, -1, -1, -1, -1, -1},
+    {3438, 3440, 3458, -1, -1, -1, -1, -1, -1},
+    {3484, 3486, 3457, -1, -1, -1, -1, -1, -1},
+    {3457, 3458, 3484, -1, -1, -1, -1, -1, -1},
+    {3507, 3512, 3486, -1, -1, -1, -1, -1, -1},
+    {3486, 3484, 3507, -1, -1, -1, -1, -1, -1},
+    {3532, 3541, 3512, -1, -1, -1, -1, -1, -1},
+    {3512, 3507, 3532, -1, -1, -1, -1, -1, -1},
+    {3557, 3565, 3541, -1, -1, -1, -1, -1, -1},
+    {3541, 3532, 3557, -1, -1, -1, -1, -1, -1},
+    {3581, 3592, 3565, -1, -1, -1, -1, -1, -1},
+    {3565, 3557, 3581, -1, -1, -1, -1, -1, -1},
+    {3606, 3615, 3592, -1, -1, -1, -1, -1, -1},
+    {3592, 3581, 3606, -1, -1, -1, -1, -1, -1},
+    {3619, 3629, 3615, -1, -1, -1, -1, -1, -1},
+    {3615, 3606, 3619, -1, -1, -1, -1, -1, -1},
+    {3625, 3635, 3629, -1, -1, -1, -1, -1, -1},
+    {3629, 3619, 3625, -1, -1, -1, -1, -1, -1},
+    {3436, 3440, 3428, -1, -1, -1, -1, -1, -1},
+    {3428, 3426, 3436, -1, -1, -1, -1, -1, -1},
+    {3454, 3458, 3440, -1, -1, -1, -1, -1, -1},
+    {3440, 3436, 3454, -1, -1, -1, -1, -1, -1},
+    {3478, 3484, 3458, -1, -1, -1, -1, -1, -1},
+    {3458, 3454, 3478, -1, -1, -1, -1, -1, -1},
+    {3501, 3507, 3484, -1, -1, -1, -1, -1, -1},
+    {3484, 3478, 3501, -1, -1, -1, -1, -1, -1},
+    {3525, 3532, 3507, -1, -1, -1, -1, -1, -1},
+    {3507, 3501, 3525, -1, -1, -1, -1, -1, -1},
+    {3546, 3557, 3532, -1, -1, -1, -1, -1, -1},
+    {3532, 3525, 3546, -1, -1, -1, -1, -1, -1},
+    {3570, 3581, 3557, -1, -1, -1, -1, -1, -1},
+    {3557, 3546, 3570, -1, -1, -1, -1, -1, -1},
+    {3587, 3606, 3581, -1, -1, -1, -1, -1, -1},
+    {3581, 3570, 3587, -1, -1, -1, -1, -1, -1},
+    {3604, 3619, 3606, -1, -1, -1, -1, -1, -1},
+    {3606, 3587, 3604, -1, -1, -1, -1, -1, -1},
+    {3608, 3625, 3619, -1, -1, -1, -1, -1, -1},
+    {3619, 3604, 3608, -1, -1, -1, -1, -1, -1},
+    {3418, 3436, 3426, -1, -1, -1, -1, -1, -1},
+    {3426, 3407, 3418, -1, -1, -1, -1, -1, -1},
+    {3444, 3454, 3436, -1, -1, -1, -1, -1, -1},
+    {3436, 3418, 3444, -1, -1, -1, -1, -1, -1},
+    {3469, 3478, 3454, -1, -1, -1, -1, -1, -1},
+    {3454, 3444, 3469, -1, -1, -1, -1, -1, -1},
+    {3491, 3501, 3478, -1, -1, -1, -1, -1, -1},
+    {3478, 3469, 3491, -1, -1, -1, -1, -1, -1},
+    {3516, 3525, 3501, -1, -1, -1, -1, -1, -1},
+    {3501, 3491, 3516, -1, -1, -1, -1, -1, -1},
+    {3535, 3546, 3525, -1, -1, -1, -1, -1, -1},
+    {3525, 3516, 3535, -1, -1, -1, -1, -1, -1},
+    {3553, 3570, 3546, -1, -1, -1, -1, -1, -1},
+    {3546, 3535, 3553, -1, -1, -1, -1, -1, -1},
+    {3574, 3587, 3570, -1, -1, -1, -1, -1, -1},
+    {3570, 3553, 3574, -1, -1, -1, -1, -1, -1},
+    {3579, 3604, 3587, -1, -1, -1, -1, -1, -1},
+    {3587, 3574, 3579, -1, -1, -1, -1, -1, -1},
+    {3586, 3608, 3604, -1, -1, -1, -1, -1, -1},
+    {3604, 3579, 3586, -1, -1, -1, -1, -1, -1},
+    {3400, 3418, 3407, -1, -1, -1, -1, -1, -1},
+    {3407, 3396, 3400, -1, -1, -1, -1, -1, -1},
+    {3430, 3444, 3418, -1, -1, -1, -1, -1, -1},
+    {3418, 3400, 3430, -1, -1, -1, -1, -1, -1},
+    {3450, 3469, 3444, -1, -1, -1, -1, -1, -1},
+    {3444, 3430, 3450, -1, -1, -1, -1, -1, -1},
+    {3474, 3491, 3469, -1, -1, -1, -1, -1, -1},
+    {3469, 3450, 3474, -1, -1, -1, -1, -1, -1},
+    {3496, 3516, 3491, -1, -1, -1, -1, -1, -1},
+    {3491, 3474, 3496, -1, -1, -1, -1, -1, -1},
+    {3517, 3535, 3516, -1, -1, -1, -1, -1, -1},
+    {3516, 3496, 3517, -1, -1, -1, -1, -1, -1},
+    {3536, 3553, 3535, -1, -1, -1, -1, -1, -1},
+    {3535, 3517, 3536, -1, -1, -1, -1, -1, -1},
+    {3548, 3574, 3553, -1, -1, -1, -1, -1, -1},
+    {3553, 3536, 3548, -1, -1, -1, -1, -1, -1},
+    {3559, 3579, 3574, -1, -1, -1, -1, -1, -1},
+    {3574, 3548, 3559, -1, -1, -1, -1, -1, -1},
+    {3563, 3586, 3579, -1, -1, -1, -1, -1, -1},
+    {3579, 3559, 3563, -1, -1, -1, -1, -1, -1},
+    {3613, 3590, 3602, -1, -1, -1, -1, -1, -1},
+    {3602, 3618, 3613, -1, -1, -1, -1, -1, -1},
+    {3597, 3577, 3590, -1, -1, -1, -1, -1, -1},
+    {3590, 3613, 3597, -1, -1, -1, -1, -1, -1},
+    {3573, 3551, 3577, -1, -1, -1, -1, -1, -1},
+    {3577, 3597, 3573, -1, -1, -1, -1, -1, -1},
+    {3545, 3529, 3551, -1, -1, -1, -1, -1, -1},
+    {3551, 3573, 3545, -1, -1, -1, -1, -1, -1},
+    {3514, 3498, 3529, -1, -1, -1, -1, -1, -1},
+    {3529, 3545, 3514, -1, -1, -1, -1, -1, -1},
+    {3481, 3466, 3498, -1, -1, -1, -1, -1, -1},
+    {3498, 3514, 3481, -1, -1, -1, -1, -1, -1},
+    {3443, 3417, 3466, -1, -1, -1, -1, -1, -1},
+    {3466, 3481, 3443, -1, -1, -1, -1, -1, -1},
+    {3395, 3383, 3417, -1, -1, -1, -1, -1, -1},
+    {3417, 3443, 3395, -1, -1, -1, -1, -1, -1},
+    {3374, 3365, 3383, -1, -1, -1, -1, -1, -1},
+    {3383, 3395, 3374, -1, -1, -1, -1, -1, -1},
+    {3370, 3357, 3365, -1, -1, -1, -1, -1, -1},
+    {3365, 3374, 3370, -1, -1, -1, -1, -1, -1},
+    {3628, 3613, 3618, -1, -1, -1, -1, -1, -1},
+    {3618, 3631, 3628, -1, -1, -1, -1, -1, -1},
+    {3611, 3597, 3613, -1, -1, -1, -1, -1, -1},
+    {3613, 3628, 3611, -1, -1, -1, -1, -1, -1},
+    {3584, 3573, 3597, -1, -1, -1, -1, -1, -1},
+    {3597, 3611, 3584, -1, -1, -1, -1, -1, -1},
+    {3556, 3545, 3573, -1, -1, -1, -1, -1, -1},
+    {3573, 3584, 3556, -1, -1, -1, -1, -1, -1},
+    {3524, 3514, 3545, -1, -1, -1, -1, -1, -1},
+    {3545, 3556, 3524, -1, -1, -1, -1, -1, -1},
+    {3493, 3481, 3514, -1, -1, -1, -1, -1, -1},
+    {3514, 3524, 3493, -1, -1, -1, -1, -1, -1},
+    {3461, 3443, 3481, -1, -1, -1, -1, -1, -1},
+    {3481, 3493, 3461, -1, -1, -1, -1, -1, -1},
+    {3413, 3395, 3443, -1, -1, -1, -1, -1, -1},
+    {3443, 3461, 3413, -1, -1, -1, -1, -1, -1},
+    {3387, 3374, 3395, -1, -1, -1, -1, -1, -1},
+    {3395, 3413, 3387, -1, -1, -1, -1, -1, -1},
+    {3379, 3370, 3374, -1, -1, -1, -1, -1, -1},
+    {3374, 3387, 3379, -1, -1, -1, -1, -1, -1},
+    {3633, 3628, 3631, -1, -1, -1, -1, -1, -1},
+    {3631, 3640, 3633, -1, -1, -1, -1, -1, -1},
+    {3617, 3611, 3628, -1, -1, -1, -1, -1, -1},
+    {3628, 3633, 3617, -1, -1, -1, -1, -1, -1},
+    {3595, 3584, 3611, -1, -1, -1, -1, -1, -1},
+    {3611, 3617, 3595, -1, -1, -1, -1, -1, -1},
+    {3562, 3556, 3584, -1, -1, -1, -1, -1, -1},
+    {3584, 3595, 3562, -1, -1, -1, -1, -1, -1},
+    {3531, 3524, 3556, -1, -1, -1, -1, -1, -1},
+    {3556, 3562, 3531, -1, -1, -1, -1, -1, -1},
+    {3500, 3493, 3524, -1, -1, -1, -1, -1, -1},
+    {3524, 3531, 3500, -1, -1, -1, -1, -1, -1},
+    {3473, 3461, 3493, -1, -1, -1, -1, -1, -1},
+    {3493, 3500, 3473, -1, -1, -1, -1, -1, -1},
+    {3435, 3413, 3461, -1, -1, -1, -1, -1, -1},
+    {3461, 3473, 3435, -1, -1, -1, -1, -1, -1},
+    {3398, 3387, 3413, -1, -1, -1, -1, -1, -1},
+    {3413, 3435, 3398, -1, -1, -1, -1, -1, -1},
+    {3391, 3379, 3387, -1, -1, -1, -1, -1, -1},
+    {3387, 3398, 3391, -1, -1, -1, -1, -1, -1},
+    {3639, 3633, 3640, -1, -1, -1, -1, -1, -1},
+    {3640, 3643, 3639, -1, -1, -1, -1, -1, -1},
+    {3624, 3617, 3633, -1, -1, -1, -1, -1, -1},
+    {3633, 3639, 3624, -1, -1, -1, -1, -1, -1},
+    {3601, 3595, 3617, -1, -1, -1, -1, -1, -1},
+    {3617, 3624, 3601, -1, -1, -1, -1, -1, -1},
+    {3567, 3562, 3595, -1, -1, -1, -1, -1, -1},
+    {3595, 3601, 3567, -1, -1, -1, -1, -1, -1},
+    {3538, 3531, 3562, -1, -1, -1, -1, -1, -1},
+    {3562, 3567, 3538, -1, -1, -1, -1, -1, -1},
+    {3506, 3500, 3531, -1, -1, -1, -1, -1, -1},
+    {3531, 3538, 3506, -1, -1, -1, -1, -1, -1},
+    {3477, 3473, 3500, -1, -1, -1, -1, -1, -1},
+    {3500, 3506, 3477, -1, -1, -1, -1, -1, -1},
+    {3447, 3435, 3473, -1, -1, -1, -1, -1, -1},
+    {3473, 3477, 3447, -1, -1, -1, -1, -1, -1},
+    {3409, 3398, 3435, -1, -1, -1, -1, -1, -1},
+    {3435, 3447, 3409, -1, -1, -1, -1, -1, -1},
+    {3399, 3391, 3398, -1, -1, -1, -1, -1, -1},
+    {3398, 3409, 3399, -1, -1, -1, -1, -1, -1},
+    {3637, 3639, 3643, -1, -1, -1, -1, -1, -1},
+    {3643, 3642, 3637, -1, -1, -1, -1, -1, -1},
+    {3622, 3624, 3639, -1, -1, -1, -1, -1, -1},
+    {3639, 3637, 3622, -1, -1, -1, -1, -1, -1},
+    {3599, 3601, 3624, -1, -1, -1, -1, -1, -1},
+    {3624, 3622, 3599, -1, -1, -1, -1, -1, -1},
+    {3569, 3567, 3601, -1, -1, -1, -1, -1, -1},
+    {3601, 3599, 3569, -1, -1, -1, -1, -1, -1},
+    {3543, 3538, 3567, -1, -1, -1, -1, -1, -1},
+    {3567, 3569, 3543, -1, -1, -1, -1, -1, -1},
+    {3510, 3506, 3538, -1, -1, -1, -1, -1, -1},
+    {3538, 3543, 3510, -1, -1, -1, -1, -1, -1},
+    {3483, 3477, 3506, -1, -1, -1, -1, -1, -1},
+    {3506, 3510, 3483, -1, -1, -1, -1, -1, -1},
+    {3453, 3447, 3477, -1, -1, -1, -1, -1, -1},
+    {3477, 3483, 3453, -1, -1, -1, -1, -1, -1},
+    {3433, 3409, 3447, -1, -1, -1, -1, -1, -1},
+    {3447, 3453, 3433, -1, -1, -1, -1, -1, -1},
+    {3411, 3399, 3409, -1, -1, -1, -1, -1, -1},
+    {3409, 3433, 3411, -1, -1, -1, -1, -1, -1},
+    {3630, 3637, 3642, -1, -1, -1, -1, -1, -1},
+    {3642, 3634, 3630, -1, -1, -1, -1, -1, -1},
+    {3614, 3622, 3637, -1, -1, -1, -1, -1, -1},
+    {3637, 3630, 3614, -1, -1, -1, -1, -1, -1},
+    {3593, 3599, 3622, -1, -1, -1, -1, -1, -1},
+    {3622, 3614, 3593, -1, -1, -1, -1, -1, -1},
+    {3564, 3569, 3599, -1, -1, -1, -1, -1, -1},
+    {3599, 3593, 3564, -1, -1, -1, -1, -1, -1},
+    {3540, 3543, 3569, -1, -1, -1, -1, -1, -1},
+    {3569, 3564, 3540, -1, -1, -1, -1, -1, -1},
+    {3511, 3510, 3543, -1, -1, -1, -1, -1, -1},
+    {3543, 3540, 3511, -1, -1, -1, -1, -1, -1},
+    {3487, 3483, 3510, -1, -1, -1, -1, -1, -1},
+    {3510, 3511, 3487, -1, -1, -1, -1, -1, -1},
+    {3456, 3453, 3483, -1, -1, -1, -1, -1, -1},
+    {3483, 3487, 3456, -1, -1, -1, -1, -1, -1},
+    {3439, 3433, 3453, -1, -1, -1, -1, -1, -1},
+    {3453, 3456, 3439, -1, -1, -1, -1, -1, -1},
+    {3422, 3411, 3433, -1, -1, -1, -1, -1, -1},
+    {3433, 3439, 3422, -1, -1, -1, -1, -1, -1},
+    {3620, 3630, 3634, -1, -1, -1, -1, -1, -1},
+    {3634, 3626, 3620, -1, -1, -1, -1, -1, -1},
+    {3607, 3614, 3630, -1, -1, -1, -1, -1, -1},
+    {3630, 3620, 3607, -1, -1, -1, -1, -1, -1},
+    {3582, 3593, 3614, -1, -1, -1, -1, -1, -1},
+    {3614, 3607, 3582, -1, -1, -1, -1, -1, -1},
+    {3558, 3564, 3593, -1, -1, -1, -1, -1, -1},
+    {3593, 3582, 3558, -1, -1, -1, -1, -1, -1},
+    {3533, 3540, 3564, -1, -1, -1, -1, -1, -1},
+    {3564, 3558, 3533, -1, -1, -1, -1, -1, -1},
+    {3508, 3511, 3540, -1, -1, -1, -1, -1, -1},
+    {3540, 3533, 3508, -1, -1, -1, -1, -1, -1},
+    {3485, 3487, 3511, -1, -1, -1, -1, -1, -1},
+    {3511, 3508, 3485, -1, -1, -1, -1, -1, -1},
+    {3459, 3456, 3487, -1, -1, -1, -1, -1, -1},
+    {3487, 3485, 3459, -1, -1, -1, -1, -1, -1},
+    {3441, 3439, 3456, -1, -1, -1, -1, -1, -1},
+    {3456, 3459, 3441, -1, -1, -1, -1, -1, -1},
+    {3429, 3422, 3439, -1, -1, -1, -1, -1, -1},
+    {3439, 3441, 3429, -1, -1, -1, -1, -1, -1},
+    {3605, 3620, 3626, -1, -1, -1, -1, -1, -1},
+    {3626, 3609, 3605, -1, -1, -1, -1, -1, -1},
+    {3588, 3607, 3620, -1, -1, -1, -1, -1, -1},
+    {3620, 3605, 3588, -1, -1, -1, -1, -1, -1},
+    {3571, 3582, 3607, -1, -1, -1, -1, -1, -1},
+    {3607, 3588, 3571, -1, -1, -1, -1, -1, -1},
+    {3547, 3558, 3582, -1, -1, -1, -1, -1, -1},
+    {3582, 3571, 3547, -1, -1, -1, -1, -1, -1},
+    {3526, 3533, 3558, -1, -1, -1, -1, -1, -1},
+    {3558, 3547, 3526, -1, -1, -1, -1, -1, -1},
+    {3502, 3508, 3533, -1, -1, -1, -1, -1, -1},
+    {3533, 3526, 3502, -1, -1, -1, -1, -1, -1},
+    {3479, 3485, 3508, -1, -1, -1, -1, -1, -1},
+    {3508, 3502, 3479, -1, -1, -1, -1, -1, -1},
+    {3455, 3459, 3485, -1, -1, -1, -1, -1, -1},
+    {3485, 3479, 3455, -1, -1, -1, -1, -1, -1},
+    {3437, 3441, 3459, -1, -1, -1, -1, -1, -1},
+    {3459, 3455, 3437, -1, -1, -1, -1, -1, -1},
+    {3427, 3429, 3441, -1, -1, -1, -1, -1, -1},
+    {3441, 3437, 3427, -1, -1, -1, -1, -1, -1},
+    {3580, 3605, 3609, -1, -1, -1, -1, -1, -1},
+    {3609, 3585, 3580, -1, -1, -1, -1, -1, -1},
+    {3575, 3588, 3605, -1, -1, -1, -1, -1, -1},
+    {3605, 3580, 3575, -1, -1, -1, -1, -1, -1},
+    {3554, 3571, 3588, -1, -1, -1, -1, -1, -1},
+    {3588, 3575, 3554, -1, -1, -1, -1, -1, -1},
+    {3534, 3547, 3571, -1, -1, -1, -1, -1, -1},
+    {3571, 3554, 3534, -1, -1, -1, -1, -1, -1},
+    {3515, 3526, 3547, -1, -1, -1, -1, -1, -1},
+    {3547, 3534, 3515, -1, -1, -1, -1, -1, -1},
+    {3490, 3502, 3526, -1, -1, -1, -1, -1, -1},
+    {3526, 3515, 3490, -1, -1, -1, -1, -1, -1},
+    {3470, 3479, 3502, -1, -1, -1, -1, -1, -1},
+    {3502, 3490, 3470, -1, -1, -1, -1, -1, -1},
+    {3445, 3455, 3479, -1, -1, -1, -1, -1, -1},
+    {3479, 3470, 3445, -1, -1, -1, -1, -1, -1},
+    {3419, 3437, 3455, -1, -1, -1, -1, -1, -1},
+    {3455, 3445, 3419, -1, -1, -1, -1, -1, -1},
+    {3406, 3427, 3437, -1, -1, -1, -1, -1, -1},
+    {3437, 3419, 3406, -1, -1, -1, -1, -1, -1},
+    {3560, 3580, 3585, -1, -1, -1, -1, -1, -1},
+    {3585, 3563, 3560, -1, -1, -1, -1, -1, -1},
+    {3549, 3575, 3580, -1, -1, -1, -1, -1, -1},
+    {3580, 3560, 3549, -1, -1, -1, -1, -1, -1},
+    {3537, 3554, 3575, -1, -1, -1, -1, -1, -1},
+    {3575, 3549, 3537, -1, -1, -1, -1, -1, -1},
+    {3518, 3534, 3554, -1, -1, -1, -1, -1, -1},
+    {3554, 3537, 3518, -1, -1, -1, -1, -1, -1},
+    {3497, 3515, 3534, -1, -1, -1, -1, -1, -1},
+    {3534, 3518, 3497, -1, -1, -1, -1, -1, -1},
+    {3475, 3490, 3515, -1, -1, -1, -1, -1, -1},
+    {3515, 3497, 3475, -1, -1, -1, -1, -1, -1},
+    {3451, 3470, 3490, -1, -1, -1, -1, -1, -1},
+    {3490, 3475, 3451, -1, -1, -1, -1, -1, -1},
+    {3431, 3445, 3470, -1, -1, -1, -1, -1, -1},
+    {3470, 3451, 3431, -1, -1, -1, -1, -1, -1},
+    {3401, 3419, 3445, -1, -1, -1, -1, -1, -1},
+    {3445, 3431, 3401, -1, -1, -1, -1, -1, -1},
+    {3396, 3406, 3419, -1, -1, -1, -1, -1, -1},
+    {3419, 3401, 3396, -1, -1, -1, -1, -1, -1},
+    {1887, 2109, 2103, -1, -1, -1, -1, -1, -1},
+    {1887, 2103, 2095, -1, -1, -1, -1, -1, -1},
+    {1887, 2095, 2075, -1, -1, -1, -1, -1, -1},
+    {1887, 2075, 2047, -1, -1, -1, -1, -1, -1},
+    {1887, 2047, 2029, -1, -1, -1, -1, -1, -1},
+    {1887, 2029, 2005, -1, -1, -1, -1, -1, -1},
+    {1887, 2005, 1981, -1, -1, -1, -1, -1, -1},
+    {1887, 1981, 1959, -1, -1, -1, -1, -1, -1},
+    {1887, 1959, 1935, -1, -1, -1, -1, -1, -1},
+    {1887, 1935, 1731, -1, -1, -1, -1, -1, -1},
+    {2256, 2103, 2109, -1, -1, -1, -1, -1, -1},
+    {2109, 2260, 2256, -1, -1, -1, -1, -1, -1},
+    {2248, 2095, 2103, -1, -1, -1, -1, -1, -1},
+    {2103, 2256, 2248, -1, -1, -1, -1, -1, -1},
+    {2225, 2075, 2095, -1, -1, -1, -1, -1, -1},
+    {2095, 2248, 2225, -1, -1, -1, -1, -1, -1},
+    {2199, 2047, 2075, -1, -1, -1, -1, -1, -1},
+    {2075, 2225, 2199, -1, -1, -1, -1, -1, -1},
+    {2141, 2029, 2047, -1, -1, -1, -1, -1, -1},
+    {2047, 2199, 2141, -1, -1, -1, -1, -1, -1},
+    {2093, 2005, 2029, -1, -1, -1, -1, -1, -1},
+    {2029, 2141, 2093, -1, -1, -1, -1, -1, -1},
+    {2035, 1981, 2005, -1, -1, -1, -1, -1, -1},
+    {2005, 2093, 2035, -1, -1, -1, -1, -1, -1},
+    {1987, 1959, 1981, -1, -1, -1, -1, -1, -1},
+    {1981, 2035, 1987, -1, -1, -1, -1, -1, -1},
+    {1947, 1935, 1959, -1, -1, -1, -1, -1, -1},
+    {1959, 1987, 1947, -1, -1, -1, -1, -1, -1},
+    {1727, 1731, 1935, -1, -1, -1, -1, -1, -1},
+    {1935, 1947, 1727, -1, -1, -1, -1, -1, -1},
+    {2309, 2256, 2260, -1, -1, -1, -1, -1, -1},
+    {2260, 2314, 2309, -1, -1, -1, -1, -1, -1},
+    {2299, 2248, 2256, -1, -1, -1, -1, -1, -1},
+    {2256, 2309, 2299, -1, -1, -1, -1, -1, -1},
+    {2278, 2225, 2248, -1, -1, -1, -1, -1, -1},
+    {2248, 2299, 2278, -1, -1, -1, -1, -1, -1},
+    {2242, 2199, 2225, -1, -1, -1, -1, -1, -1},
+    {2225, 2278, 2242, -1, -1, -1, -1, -1, -1},
+    {2203, 2141, 2199, -1, -1, -1, -1, -1, -1},
+    {2199, 2242, 2203, -1, -1, -1, -1, -1, -1},
+    {2131, 2093, 2141, -1, -1, -1, -1, -1, -1},
+    {2141, 2203, 2131, -1, -1, -1, -1, -1, -1},
+    {2066, 2035, 2093, -1, -1, -1, -1, -1, -1},
+    {2093, 2131, 2066, -1, -1, -1, -1, -1, -1},
+    {1999, 1987, 2035, -1, -1, -1, -1, -1, -1},
+    {2035, 2066, 1999, -1, -1, -1, -1, -1, -1},
+    {1955, 1947, 1987, -1, -1, -1, -1, -1, -1},
+    {1987, 1999, 1955, -1, -1, -1, -1, -1, -1},
+    {1733, 1727, 1947, -1, -1, -1, -1, -1, -1},
+    {1947, 1955, 1733, -1, -1, -1, -1, -1, -1},
+    {2311, 2309, 2314, -1, -1, -1, -1, -1, -1},
+    {2314, 2315, 2311, -1, -1, -1, -1, -1, -1},
+    {2301, 2299, 2309, -1, -1, -1, -1, -1, -1},
+    {2309, 2311, 2301, -1, -1, -1, -1, -1, -1},
+    {2280, 2278, 2299, -1, -1, -1, -1, -1, -1},
+    {2299, 2301, 2280, -1, -1, -1, -1, -1, -1},
+    {2244, 2242, 2278, -1, -1, -1, -1, -1, -1},
+    {2278, 2280, 2244, -1, -1, -1, -1, -1, -1},
+    {2205, 2203, 2242, -1, -1, -1, -1, -1, -1},
+    {2242, 2244, 2205, -1, -1, -1, -1, -1, -1},
+    {2133, 2131, 2203, -1, -1, -1, -1, -1, -1},
+    {2203, 2205, 2133, -1, -1, -1, -1, -1, -1},
+    {2067, 2066, 2131, -1, -1, -1, -1, -1, -1},
+    {2131, 2133, 2067, -1, -1, -1, -1, -1, -1},
+    {2001, 1999, 2066, -1, -1, -1, -1, -1, -1},
+    {2066, 2067, 2001, -1, -1, -1, -1, -1, -1},
+    {1957, 1955, 1999, -1, -1, -1, -1, -1, -1},
+    {1999, 2001, 1957, -1, -1, -1, -1, -1, -1},
+    {1877, 1733, 1955, -1, -1, -1, -1, -1, -1},
+    {1955, 1957, 1877, -1, -1, -1, -1, -1, -1},
+    {2284, 2311, 2315, -1, -1, -1, -1, -1, -1},
+    {2315, 2288, 2284, -1, -1, -1, -1, -1, -1},
+    {2258, 2301, 2311, -1, -1, -1, -1, -1, -1},
+    {2311, 2284, 2258, -1, -1, -1, -1, -1, -1},
+    {2240, 2280, 2301, -1, -1, -1, -1, -1, -1},
+    {2301, 2258, 2240, -1, -1, -1, -1, -1, -1},
+    {2213, 2244, 2280, -1, -1, -1, -1, -1, -1},
+    {2280, 2240, 2213, -1, -1, -1, -1, -1, -1},
+    {2167, 2205, 2244, -1, -1, -1, -1, -1, -1},
+    {2244, 2213, 2167, -1, -1, -1, -1, -1, -1},
+    {2105, 2133, 2205, -1, -1, -1, -1, -1, -1},
+    {2205, 2167, 2105, -1, -1, -1, -1, -1, -1},
+    {2041, 2067, 2133, -1, -1, -1, -1, -1, -1},
+    {2133, 2105, 2041, -1, -1, -1, -1, -1, -1},
+    {1993, 2001, 2067, -1, -1, -1, -1, -1, -1},
+    {2067, 2041, 1993, -1, -1, -1, -1, -1, -1},
+    {1951, 1957, 2001, -1, -1, -1, -1, -1, -1},
+    {2001, 1993, 1951, -1, -1, -1, -1, -1, -1},
+    {1730, 1877, 1957, -1, -1, -1, -1, -1, -1},
+    {1957, 1951, 1730, -1, -1, -1, -1, -1, -1},
+    {2219, 2284, 2288, -1, -1, -1, -1, -1, -1},
+    {2288, 2224, 2219, -1, -1, -1, -1, -1, -1},
+    {2209, 2258, 2284, -1, -1, -1, -1, -1, -1},
+    {2284, 2219, 2209, -1, -1, -1, -1, -1, -1},
+    {2185, 2240, 2258, -1, -1, -1, -1, -1, -1},
+    {2258, 2209, 2185, -1, -1, -1, -1, -1, -1},
+    {2145, 2213, 2240, -1, -1, -1, -1, -1, -1},
+    {2240, 2185, 2145, -1, -1, -1, -1, -1, -1},
+    {2107, 2167, 2213, -1, -1, -1, -1, -1, -1},
+    {2213, 2145, 2107, -1, -1, -1, -1, -1, -1},
+    {2059, 2105, 2167, -1, -1, -1, -1, -1, -1},
+    {2167, 2107, 2059, -1, -1, -1, -1, -1, -1},
+    {2017, 2041, 2105, -1, -1, -1, -1, -1, -1},
+    {2105, 2059, 2017, -1, -1, -1, -1, -1, -1},
+    {1977, 1993, 2041, -1, -1, -1, -1, -1, -1},
+    {2041, 2017, 1977, -1, -1, -1, -1, -1, -1},
+    {1943, 1951, 1993, -1, -1, -1, -1, -1, -1},
+    {1993, 1977, 1943, -1, -1, -1, -1, -1, -1},
+    {1726, 1730, 1951, -1, -1, -1, -1, -1, -1},
+    {1951, 1943, 1726, -1, -1, -1, -1, -1, -1},
+    {2140, 2219, 2224, -1, -1, -1, -1, -1, -1},
+    {2224, 2144, 2140, -1, -1, -1, -1, -1, -1},
+    {2126, 2209, 2219, -1, -1, -1, -1, -1, -1},
+    {2219, 2140, 2126, -1, -1, -1, -1, -1, -1},
+    {2111, 2185, 2209, -1, -1, -1, -1, -1, -1},
+    {2209, 2126, 2111, -1, -1, -1, -1, -1, -1},
+    {2083, 2145, 2185, -1, -1, -1, -1, -1, -1},
+    {2185, 2111, 2083, -1, -1, -1, -1, -1, -1},
+    {2043, 2107, 2145, -1, -1, -1, -1, -1, -1},
+    {2145, 2083, 2043, -1, -1, -1, -1, -1, -1},
+    {2023, 2059, 2107, -1, -1, -1, -1, -1, -1},
+    {2107, 2043, 2023, -1, -1, -1, -1, -1, -1},
+    {1991, 2017, 2059, -1, -1, -1, -1, -1, -1},
+    {2059, 2023, 1991, -1, -1, -1, -1, -1, -1},
+    {1969, 1977, 2017, -1, -1, -1, -1, -1, -1},
+    {2017, 1991, 1969, -1, -1, -1, -1, -1, -1},
+    {1941, 1943, 1977, -1, -1, -1, -1, -1, -1},
+    {1977, 1969, 1941, -1, -1, -1, -1, -1, -1},
+    {1720, 1726, 1943, -1, -1, -1, -1, -1, -1},
+    {1943, 1941, 1720, -1, -1, -1, -1, -1, -1},
+    {2078, 2140, 2144, -1, -1, -1, -1, -1, -1},
+    {2144, 2086, 2078, -1, -1, -1, -1, -1, -1},
+    {2074, 2126, 2140, -1, -1, -1, -1, -1, -1},
+    {2140, 2078, 2074, -1, -1, -1, -1, -1, -1},
+    {2054, 2111, 2126, -1, -1, -1, -1, -1, -1},
+    {2126, 2074, 2054, -1, -1, -1, -1, -1, -1},
+    {2038, 2083, 2111, -1, -1, -1, -1, -1, -1},
+    {2111, 2054, 2038, -1, -1, -1, -1, -1, -1},
+    {2020, 2043, 2083, -1, -1, -1, -1, -1, -1},
+    {2083, 2038, 2020, -1, -1, -1, -1, -1, -1},
+    {1995, 2023, 2043, -1, -1, -1, -1, -1, -1},
+    {2043, 2020, 1995, -1, -1, -1, -1, -1, -1},
+    {1973, 1991, 2023, -1, -1, -1, -1, -1, -1},
+    {2023, 1995, 1973, -1, -1, -1, -1, -1, -1},
+    {1953, 1969, 1991, -1, -1, -1, -1, -1, -1},
+    {1991, 1973, 1953, -1, -1, -1, -1, -1, -1},
+    {1933, 1941, 1969, -1, -1, -1, -1, -1, -1},
+    {1969, 1953, 1933, -1, -1, -1, -1, -1, -1},
+    {1719, 1720, 1941, -1, -1, -1, -1, -1, -1},
+    {1941, 1933, 1719, -1, -1, -1, -1, -1, -1},
+    {2062, 2078, 2086, -1, -1, -1, -1, -1, -1},
+    {2086, 2070, 2062, -1, -1, -1, -1, -1, -1},
+    {2050, 2074, 2078, -1, -1, -1, -1, -1, -1},
+    {2078, 2062, 2050, -1, -1, -1, -1, -1, -1},
+    {2040, 2054, 2074, -1, -1, -1, -1, -1, -1},
+    {2074, 2050, 2040, -1, -1, -1, -1, -1, -1},
+    {2028, 2038, 2054, -1, -1, -1, -1, -1, -1},
+    {2054, 2040, 2028, -1, -1, -1, -1, -1, -1},
+    {2012, 2020, 2038, -1, -1, -1, -1, -1, -1},
+    {2038, 2028, 2012, -1, -1, -1, -1, -1, -1},
+    {1990, 1995, 2020, -1, -1, -1, -1, -1, -1},
+    {2020, 2012, 1990, -1, -1, -1, -1, -1, -1},
+    {1971, 1973, 1995, -1, -1, -1, -1, -1, -1},
+    {1995, 1990, 1971, -1, -1, -1, -1, -1, -1},
+    {1949, 1953, 1973, -1, -1, -1, -1, -1, -1},
+    {1973, 1971, 1949, -1, -1, -1, -1, -1, -1},
+    {1931, 1933, 1953, -1, -1, -1, -1, -1, -1},
+    {1953, 1949, 1931, -1, -1, -1, -1, -1, -1},
+    {1700, 1719, 1933, -1, -1, -1, -1, -1, -1},
+    {1933, 1931, 1700, -1, -1, -1, -1, -1, -1},
+    {2114, 2062, 2070, -1, -1, -1, -1, -1, -1},
+    {2070, 2122, 2114, -1, -1, -1, -1, -1, -1},
+    {2100, 2050, 2062, -1, -1, -1, -1, -1, -1},
+    {2062, 2114, 2100, -1, -1, -1, -1, -1, -1},
+    {2080, 2040, 2050, -1, -1, -1, -1, -1, -1},
+    {2050, 2100, 2080, -1, -1, -1, -1, -1, -1},
+    {2056, 2028, 2040, -1, -1, -1, -1, -1, -1},
+    {2040, 2080, 2056, -1, -1, -1, -1, -1, -1},
+    {2032, 2012, 2028, -1, -1, -1, -1, -1, -1},
+    {2028, 2056, 2032, -1, -1, -1, -1, -1, -1},
+    {2008, 1990, 2012, -1, -1, -1, -1, -1, -1},
+    {2012, 2032, 2008, -1, -1, -1, -1, -1, -1},
+    {1983, 1971, 1990, -1, -1, -1, -1, -1, -1},
+    {1990, 2008, 1983, -1, -1, -1, -1, -1, -1},
+    {1963, 1949, 1971, -1, -1, -1, -1, -1, -1},
+    {1971, 1983, 1963, -1, -1, -1, -1, -1, -1},
+    {1937, 1931, 1949, -1, -1, -1, -1, -1, -1},
+    {1949, 1963, 1937, -1, -1, -1, -1, -1, -1},
+    {1697, 1700, 1931, -1, -1, -1, -1, -1, -1},
+    {1931, 1937, 1697, -1, -1, -1, -1, -1, -1},
+    {1887, 1885, 1685, -1, -1, -1, -1, -1, -1},
+    {1887, 1685, 1661, -1, -1, -1, -1, -1, -1},
+    {1887, 1661, 1639, -1, -1, -1, -1, -1, -1},
+    {1887, 1639, 1615, -1, -1, -1, -1, -1, -1},
+    {1887, 1615, 1591, -1, -1, -1, -1, -1, -1},
+    {1887, 1591, 1573, -1, -1, -1, -1, -1, -1},
+    {1887, 1573, 1545, -1, -1, -1, -1, -1, -1},
+    {1887, 1545, 1525, -1, -1, -1, -1, -1, -1},
+    {1887, 1525, 1517, -1, -1, -1, -1, -1, -1},
+    {1887, 1517, 1511, -1, -1, -1, -1, -1, -1},
+    {1673, 1685, 1885, -1, -1, -1, -1, -1, -1},
+    {1885, 1883, 1673, -1, -1, -1, -1, -1, -1},
+    {1633, 1661, 1685, -1, -1, -1, -1, -1, -1},
+    {1685, 1673, 1633, -1, -1, -1, -1, -1, -1},
+    {1585, 1639, 1661, -1, -1, -1, -1, -1, -1},
+    {1661, 1633, 1585, -1, -1, -1, -1, -1, -1},
+    {1527, 1615, 1639, -1, -1, -1, -1, -1, -1},
+    {1639, 1585, 1527, -1, -1, -1, -1, -1, -1},
+    {1479, 1591, 1615, -1, -1, -1, -1, -1, -1},
+    {1615, 1527, 1479, -1, -1, -1, -1, -1, -1},
+    {1421, 1573, 1591, -1, -1, -1, -1, -1, -1},
+    {1591, 1479, 1421, -1, -1, -1, -1, -1, -1},
+    {1395, 1545, 1573, -1, -1, -1, -1, -1, -1},
+    {1573, 1421, 1395, -1, -1, -1, -1, -1, -1},
+    {1372, 1525, 1545, -1, -1, -1, -1, -1, -1},
+    {1545, 1395, 1372, -1, -1, -1, -1, -1, -1},
+    {1364, 1517, 1525, -1, -1, -1, -1, -1, -1},
+    {1525, 1372, 1364, -1, -1, -1, -1, -1, -1},
+    {1360, 1511, 1517, -1, -1, -1, -1, -1, -1},
+    {1517, 1364, 1360, -1, -1, -1, -1, -1, -1},
+    {1665, 1673, 1883, -1, -1, -1, -1, -1, -1},
+    {1883, 1881, 1665, -1, -1, -1, -1, -1, -1},
+    {1621, 1633, 1673, -1, -1, -1, -1, -1, -1},
+    {1673, 1665, 1621, -1, -1, -1, -1, -1, -1},
+    {1556, 1585, 1633, -1, -1, -1, -1, -1, -1},
+    {1633, 1621, 1556, -1, -1, -1, -1, -1, -1},
+    {1489, 1527, 1585, -1, -1, -1, -1, -1, -1},
+    {1585, 1556, 1489, -1, -1, -1, -1, -1, -1},
+    {1417, 1479, 1527, -1, -1, -1, -1, -1, -1},
+    {1527, 1489, 1417, -1, -1, -1, -1, -1, -1},
+    {1378, 1421, 1479, -1, -1, -1, -1, -1, -1},
+    {1479, 1417, 1378, -1, -1, -1, -1, -1, -1},
+    {1342, 1395, 1421, -1, -1, -1, -1, -1, -1},
+    {1421, 1378, 1342, -1, -1, -1, -1, -1, -1},
+    {1321, 1372, 1395, -1, -1, -1, -1, -1, -1},
+    {1395, 1342, 1321, -1, -1, -1, -1, -1, -1},
+    {1311, 1364, 1372, -1, -1, -1, -1, -1, -1},
+    {1372, 1321, 1311, -1, -1, -1, -1, -1, -1},
+    {1308, 1360, 1364, -1, -1, -1, -1, -1, -1},
+    {1364, 1311, 1308, -1, -1, -1, -1, -1, -1},
+    {1663, 1665, 1881, -1, -1, -1, -1, -1, -1},
+    {1881, 1878, 1663, -1, -1, -1, -1, -1, -1},
+    {1619, 1621, 1665, -1, -1, -1, -1, -1, -1},
+    {1665, 1663, 1619, -1, -1, -1, -1, -1, -1},
+    {1553, 1556, 1621, -1, -1, -1, -1, -1, -1},
+    {1621, 1619, 1553, -1, -1, -1, -1, -1, -1},
+    {1487, 1489, 1556, -1, -1, -1, -1, -1, -1},
+    {1556, 1553, 1487, -1, -1, -1, -1, -1, -1},
+    {1415, 1417, 1489, -1, -1, -1, -1, -1, -1},
+    {1489, 1487, 1415, -1, -1, -1, -1, -1, -1},
+    {1376, 1378, 1417, -1, -1, -1, -1, -1, -1},
+    {1417, 1415, 1376, -1, -1, -1, -1, -1, -1},
+    {1340, 1342, 1378, -1, -1, -1, -1, -1, -1},
+    {1378, 1376, 1340, -1, -1, -1, -1, -1, -1},
+    {1319, 1321, 1342, -1, -1, -1, -1, -1, -1},
+    {1342, 1340, 1319, -1, -1, -1, -1, -1, -1},
+    {1309, 1311, 1321, -1, -1, -1, -1, -1, -1},
+    {1321, 1319, 1309, -1, -1, -1, -1, -1, -1},
+    {1305, 1308, 1311, -1, -1, -1, -1, -1, -1},
+    {1311, 1309, 1305, -1, -1, -1, -1, -1, -1},
+    {1669, 1663, 1878, -1, -1, -1, -1, -1, -1},
+    {1878, 1875, 1669, -1, -1, -1, -1, -1, -1},
+    {1627, 1619, 1663, -1, -1, -1, -1, -1, -1},
+    {1663, 1669, 1627, -1, -1, -1, -1, -1, -1},
+    {1579, 1553, 1619, -1, -1, -1, -1, -1, -1},
+    {1619, 1627, 1579, -1, -1, -1, -1, -1, -1},
+    {1515, 1487, 1553, -1, -1, -1, -1, -1, -1},
+    {1553, 1579, 1515, -1, -1, -1, -1, -1, -1},
+    {1453, 1415, 1487, -1, -1, -1, -1, -1, -1},
+    {1487, 1515, 1453, -1, -1, -1, -1, -1, -1},
+    {1407, 1376, 1415, -1, -1, -1, -1, -1, -1},
+    {1415, 1453, 1407, -1, -1, -1, -1, -1, -1},
+    {1380, 1340, 1376, -1, -1, -1, -1, -1, -1},
+    {1376, 1407, 1380, -1, -1, -1, -1, -1, -1},
+    {1362, 1319, 1340, -1, -1, -1, -1, -1, -1},
+    {1340, 1380, 1362, -1, -1, -1, -1, -1, -1},
+    {1336, 1309, 1319, -1, -1, -1, -1, -1, -1},
+    {1319, 1362, 1336, -1, -1, -1, -1, -1, -1},
+    {1332, 1305, 1309, -1, -1, -1, -1, -1, -1},
+    {1309, 1336, 1332, -1, -1, -1, -1, -1, -1},
+    {1677, 1669, 1875, -1, -1, -1, -1, -1, -1},
+    {1875, 1873, 1677, -1, -1, -1, -1, -1, -1},
+    {1643, 1627, 1669, -1, -1, -1, -1, -1, -1},
+    {1669, 1677, 1643, -1, -1, -1, -1, -1, -1},
+    {1603, 1579, 1627, -1, -1, -1, -1, -1, -1},
+    {1627, 1643, 1603, -1, -1, -1, -1, -1, -1},
+    {1561, 1515, 1579, -1, -1, -1, -1, -1, -1},
+    {1579, 1603, 1561, -1, -1, -1, -1, -1, -1},
+    {1513, 1453, 1515, -1, -1, -1, -1, -1, -1},
+    {1515, 1561, 1513, -1, -1, -1, -1, -1, -1},
+    {1475, 1407, 1453, -1, -1, -1, -1, -1, -1},
+    {1453, 1513, 1475, -1, -1, -1, -1, -1, -1},
+    {1435, 1380, 1407, -1, -1, -1, -1, -1, -1},
+    {1407, 1475, 1435, -1, -1, -1, -1, -1, -1},
+    {1411, 1362, 1380, -1, -1, -1, -1, -1, -1},
+    {1380, 1435, 1411, -1, -1, -1, -1, -1, -1},
+    {1401, 1336, 1362, -1, -1, -1, -1, -1, -1},
+    {1362, 1411, 1401, -1, -1, -1, -1, -1, -1},
+    {1398, 1332, 1336, -1, -1, -1, -1, -1, -1},
+    {1336, 1401, 1398, -1, -1, -1, -1, -1, -1},
+    {1679, 1677, 1873, -1, -1, -1, -1, -1, -1},
+    {1873, 1871, 1679, -1, -1, -1, -1, -1, -1},
+    {1651, 1643, 1677, -1, -1, -1, -1, -1, -1},
+    {1677, 1679, 1651, -1, -1, -1, -1, -1, -1},
+    {1629, 1603, 1643, -1, -1, -1, -1, -1, -1},
+    {1643, 1651, 1629, -1, -1, -1, -1, -1, -1},
+    {1597, 1561, 1603, -1, -1, -1, -1, -1, -1},
+    {1603, 1629, 1597, -1, -1, -1, -1, -1, -1},
+    {1577, 1513, 1561, -1, -1, -1, -1, -1, -1},
+    {1561, 1597, 1577, -1, -1, -1, -1, -1, -1},
+    {1537, 1475, 1513, -1, -1, -1, -1, -1, -1},
+    {1513, 1577, 1537, -1, -1, -1, -1, -1, -1},
+    {1509, 1435, 1475, -1, -1, -1, -1, -1, -1},
+    {1475, 1537, 1509, -1, -1, -1, -1, -1, -1},
+    {1496, 1411, 1435, -1, -1, -1, -1, -1, -1},
+    {1435, 1509, 1496, -1, -1, -1, -1, -1, -1},
+    {1482, 1401, 1411, -1, -1, -1, -1, -1, -1},
+    {1411, 1496, 1482, -1, -1, -1, -1, -1, -1},
+    {1478, 1398, 1401, -1, -1, -1, -1, -1, -1},
+    {1401, 1482, 1478, -1, -1, -1, -1, -1, -1},
+    {1687, 1679, 1871, -1, -1, -1, -1, -1, -1},
+    {1871, 1869, 1687, -1, -1, -1, -1, -1, -1},
+    {1667, 1651, 1679, -1, -1, -1, -1, -1, -1},
+    {1679, 1687, 1667, -1, -1, -1, -1, -1, -1},
+    {1647, 1629, 1651, -1, -1, -1, -1, -1, -1},
+    {1651, 1667, 1647, -1, -1, -1, -1, -1, -1},
+    {1625, 1597, 1629, -1, -1, -1, -1, -1, -1},
+    {1629, 1647, 1625, -1, -1, -1, -1, -1, -1},
+    {1602, 1577, 1597, -1, -1, -1, -1, -1, -1},
+    {1597, 1625, 1602, -1, -1, -1, -1, -1, -1},
+    {1584, 1537, 1577, -1, -1, -1, -1, -1, -1},
+    {1577, 1602, 1584, -1, -1, -1, -1, -1, -1},
+    {1568, 1509, 1537, -1, -1, -1, -1, -1, -1},
+    {1537, 1584, 1568, -1, -1, -1, -1, -1, -1},
+    {1548, 1496, 1509, -1, -1, -1, -1, -1, -1},
+    {1509, 1568, 1548, -1, -1, -1, -1, -1, -1},
+    {1544, 1482, 1496, -1, -1, -1, -1, -1, -1},
+    {1496, 1548, 1544, -1, -1, -1, -1, -1, -1},
+    {1536, 1478, 1482, -1, -1, -1, -1, -1, -1},
+    {1482, 1544, 1536, -1, -1, -1, -1, -1, -1},
+    {1689, 1687, 1869, -1, -1, -1, -1, -1, -1},
+    {1869, 1867, 1689, -1, -1, -1, -1, -1, -1},
+    {1671, 1667, 1687, -1, -1, -1, -1, -1, -1},
+    {1687, 1689, 1671, -1, -1, -1, -1, -1, -1},
+    {1649, 1647, 1667, -1, -1, -1, -1, -1, -1},
+    {1667, 1671, 1649, -1, -1, -1, -1, -1, -1},
+    {1632, 1625, 1647, -1, -1, -1, -1, -1, -1},
+    {1647, 1649, 1632, -1, -1, -1, -1, -1, -1},
+    {1610, 1602, 1625, -1, -1, -1, -1, -1, -1},
+    {1625, 1632, 1610, -1, -1, -1, -1, -1, -1},
+    {1594, 1584, 1602, -1, -1, -1, -1, -1, -1},
+    {1602, 1610, 1594, -1, -1, -1, -1, -1, -1},
+    {1582, 1568, 1584, -1, -1, -1, -1, -1, -1},
+    {1584, 1594, 1582, -1, -1, -1, -1, -1, -1},
+    {1572, 1548, 1568, -1, -1, -1, -1, -1, -1},
+    {1568, 1582, 1572, -1, -1, -1, -1, -1, -1},
+    {1560, 1544, 1548, -1, -1, -1, -1, -1, -1},
+    {1548, 1572, 1560, -1, -1, -1, -1, -1, -1},
+    {1552, 1536, 1544, -1, -1, -1, -1, -1, -1},
+    {1544, 1560, 1552, -1, -1, -1, -1, -1, -1},
+    {1683, 1689, 1867, -1, -1, -1, -1, -1, -1},
+    {1867, 1864, 1683, -1, -1, -1, -1, -1, -1},
+    {1657, 1671, 1689, -1, -1, -1, -1, -1, -1},
+    {1689, 1683, 1657, -1, -1, -1, -1, -1, -1},
+    {1637, 1649, 1671, -1, -1, -1, -1, -1, -1},
+    {1671, 1657, 1637, -1, -1, -1, -1, -1, -1},
+    {1614, 1632, 1649, -1, -1, -1, -1, -1, -1},
+    {1649, 1637, 1614, -1, -1, -1, -1, -1, -1},
+    {1590, 1610, 1632, -1, -1, -1, -1, -1, -1},
+    {1632, 1614, 1590, -1, -1, -1, -1, -1, -1},
+    {1566, 1594, 1610, -1, -1, -1, -1, -1, -1},
+    {1610, 1590, 1566, -1, -1, -1, -1, -1, -1},
+    {1542, 1582, 1594, -1, -1, -1, -1, -1, -1},
+    {1594, 1566, 1542, -1, -1, -1, -1, -1, -1},
+    {1522, 1572, 1582, -1, -1, -1, -1, -1, -1},
+    {1582, 1542, 1522, -1, -1, -1, -1, -1, -1},
+    {1508, 1560, 1572, -1, -1, -1, -1, -1, -1},
+    {1572, 1522, 1508, -1, -1, -1, -1, -1, -1},
+    {1500, 1552, 1560, -1, -1, -1, -1, -1, -1},
+    {1560, 1508, 1500, -1, -1, -1, -1, -1, -1},
+    {1887, 1512, 1518, -1, -1, -1, -1, -1, -1},
+    {1887, 1518, 1526, -1, -1, -1, -1, -1, -1},
+    {1887, 1526, 1546, -1, -1, -1, -1, -1, -1},
+    {1887, 1546, 1574, -1, -1, -1, -1, -1, -1},
+    {1887, 1574, 1592, -1, -1, -1, -1, -1, -1},
+    {1887, 1592, 1616, -1, -1, -1, -1, -1, -1},
+    {1887, 1616, 1640, -1, -1, -1, -1, -1, -1},
+    {1887, 1640, 1662, -1, -1, -1, -1, -1, -1},
+    {1887, 1662, 1686, -1, -1, -1, -1, -1, -1},
+    {1887, 1686, 1893, -1, -1, -1, -1, -1, -1},
+    {1365, 1518, 1512, -1, -1, -1, -1, -1, -1},
+    {1512, 1361, 1365, -1, -1, -1, -1, -1, -1},
+    {1373, 1526, 1518, -1, -1, -1, -1, -1, -1},
+    {1518, 1365, 1373, -1, -1, -1, -1, -1, -1},
+    {1396, 1546, 1526, -1, -1, -1, -1, -1, -1},
+    {1526, 1373, 1396, -1, -1, -1, -1, -1, -1},
+    {1422, 1574, 1546, -1, -1, -1, -1, -1, -1},
+    {1546, 1396, 1422, -1, -1, -1, -1, -1, -1},
+    {1480, 1592, 1574, -1, -1, -1, -1, -1, -1},
+    {1574, 1422, 1480, -1, -1, -1, -1, -1, -1},
+    {1528, 1616, 1592, -1, -1, -1, -1, -1, -1},
+    {1592, 1480, 1528, -1, -1, -1, -1, -1, -1},
+    {1586, 1640, 1616, -1, -1, -1, -1, -1, -1},
+    {1616, 1528, 1586, -1, -1, -1, -1, -1, -1},
+    {1634, 1662, 1640, -1, -1, -1, -1, -1, -1},
+    {1640, 1586, 1634, -1, -1, -1, -1, -1, -1},
+    {1674, 1686, 1662, -1, -1, -1, -1, -1, -1},
+    {1662, 1634, 1674, -1, -1, -1, -1, -1, -1},
+    {1894, 1893, 1686, -1, -1, -1, -1, -1, -1},
+    {1686, 1674, 1894, -1, -1, -1, -1, -1, -1},
+    {1312, 1365, 1361, -1, -1, -1, -1, -1, -1},
+    {1361, 1307, 1312, -1, -1, -1, -1, -1, -1},
+    {1322, 1373, 1365, -1, -1, -1, -1, -1, -1},
+    {1365, 1312, 1322, -1, -1, -1, -1, -1, -1},
+    {1343, 1396, 1373, -1, -1, -1, -1, -1, -1},
+    {1373, 1322, 1343, -1, -1, -1, -1, -1, -1},
+    {1379, 1422, 1396, -1, -1, -1, -1, -1, -1},
+    {1396, 1343, 1379, -1, -1, -1, -1, -1, -1},
+    {1418, 1480, 1422, -1, -1, -1, -1, -1, -1},
+    {1422, 1379, 1418, -1, -1, -1, -1, -1, -1},
+    {1490, 1528, 1480, -1, -1, -1, -1, -1, -1},
+    {1480, 1418, 1490, -1, -1, -1, -1, -1, -1},
+    {1555, 1586, 1528, -1, -1, -1, -1, -1, -1},
+    {1528, 1490, 1555, -1, -1, -1, -1, -1, -1},
+    {1622, 1634, 1586, -1, -1, -1, -1, -1, -1},
+    {1586, 1555, 1622, -1, -1, -1, -1, -1, -1},
+    {1666, 1674, 1634, -1, -1, -1, -1, -1, -1},
+    {1634, 1622, 1666, -1, -1, -1, -1, -1, -1},
+    {1889, 1894, 1674, -1, -1, -1, -1, -1, -1},
+    {1674, 1666, 1889, -1, -1, -1, -1, -1, -1},
+    {1310, 1312, 1307, -1, -1, -1, -1, -1, -1},
+    {1307, 1306, 1310, -1, -1, -1, -1, -1, -1},
+    {1320, 1322, 1312, -1, -1, -1, -1, -1, -1},
+    {1312, 1310, 1320, -1, -1, -1, -1, -1, -1},
+    {1341, 1343, 1322, -1, -1, -1, -1, -1, -1},
+    {1322, 1320, 1341, -1, -1, -1, -1, -1, -1},
+    {1377, 1379, 1343, -1, -1, -1, -1, -1, -1},
+    {1343, 1341, 1377, -1, -1, -1, -1, -1, -1},
+    {1416, 1418, 1379, -1, -1, -1, -1, -1, -1},
+    {1379, 1377, 1416, -1, -1, -1, -1, -1, -1},
+    {1488, 1490, 1418, -1, -1, -1, -1, -1, -1},
+    {1418, 1416, 1488, -1, -1, -1, -1, -1, -1},
+    {1554, 1555, 1490, -1, -1, -1, -1, -1, -1},
+    {1490, 1488, 1554, -1, -1, -1, -1, -1, -1},
+    {1620, 1622, 1555, -1, -1, -1, -1, -1, -1},
+    {1555, 1554, 1620, -1, -1, -1, -1, -1, -1},
+    {1664, 1666, 1622, -1, -1, -1, -1, -1, -1},
+    {1622, 1620, 1664, -1, -1, -1, -1, -1, -1},
+    {1880, 1889, 1666, -1, -1, -1, -1, -1, -1},
+    {1666, 1664, 1880, -1, -1, -1, -1, -1, -1},
+    {1337, 1310, 1306, -1, -1, -1, -1, -1, -1},
+    {1306, 1333, 1337, -1, -1, -1, -1, -1, -1},
+    {1363, 1320, 1310, -1, -1, -1, -1, -1, -1},
+    {1310, 1337, 1363, -1, -1, -1, -1, -1, -1},
+    {1381, 1341, 1320, -1, -1, -1, -1, -1, -1},
+    {1320, 1363, 1381, -1, -1, -1, -1, -1, -1},
+    {1408, 1377, 1341, -1, -1, -1, -1, -1, -1},
+    {1341, 1381, 1408, -1, -1, -1, -1, -1, -1},
+    {1454, 1416, 1377, -1, -1, -1, -1, -1, -1},
+    {1377, 1408, 1454, -1, -1, -1, -1, -1, -1},
+    {1516, 1488, 1416, -1, -1, -1, -1, -1, -1},
+    {1416, 1454, 1516, -1, -1, -1, -1, -1, -1},
+    {1580, 1554, 1488, -1, -1, -1, -1, -1, -1},
+    {1488, 1516, 1580, -1, -1, -1, -1, -1, -1},
+    {1628, 1620, 1554, -1, -1, -1, -1, -1, -1},
+    {1554, 1580, 1628, -1, -1, -1, -1, -1, -1},
+    {1670, 1664, 1620, -1, -1, -1, -1, -1, -1},
+    {1620, 1628, 1670, -1, -1, -1, -1, -1, -1},
+    {1892, 1880, 1664, -1, -1, -1, -1, -1, -1},
+    {1664, 1670, 1892, -1, -1, -1, -1, -1, -1},
+    {1402, 1337, 1333, -1, -1, -1, -1, -1, -1},
+    {1333, 1397, 1402, -1, -1, -1, -1, -1, -1},
+    {1412, 1363, 1337, -1, -1, -1, -1, -1, -1},
+    {1337, 1402, 1412, -1, -1, -1, -1, -1, -1},
+    {1436, 1381, 1363, -1, -1, -1, -1, -1, -1},
+    {1363, 1412, 1436, -1, -1, -1, -1, -1, -1},
+    {1476, 1408, 1381, -1, -1, -1, -1, -1, -1},
+    {1381, 1436, 1476, -1, -1, -1, -1, -1, -1},
+    {1514, 1454, 1408, -1, -1, -1, -1, -1, -1},
+    {1408, 1476, 1514, -1, -1, -1, -1, -1, -1},
+    {1562, 1516, 1454, -1, -1, -1, -1, -1, -1},
+    {1454, 1514, 1562, -1, -1, -1, -1, -1, -1},
+    {1604, 1580, 1516, -1, -1, -1, -1, -1, -1},
+    {1516, 1562, 1604, -1, -1, -1, -1, -1, -1},
+    {1644, 1628, 1580, -1, -1, -1, -1, -1, -1},
+    {1580, 1604, 1644, -1, -1, -1, -1, -1, -1},
+    {1678, 1670, 1628, -1, -1, -1, -1, -1, -1},
+    {1628, 1644, 1678, -1, -1, -1, -1, -1, -1},
+    {1899, 1892, 1670, -1, -1, -1, -1, -1, -1},
+    {1670, 1678, 1899, -1, -1, -1, -1, -1, -1},
+    {1481, 1402, 1397, -1, -1, -1, -1, -1, -1},
+    {1397, 1477, 1481, -1, -1, -1, -1, -1, -1},
+    {1495, 1412, 1402, -1, -1, -1, -1, -1, -1},
+    {1402, 1481, 1495, -1, -1, -1, -1, -1, -1},
+    {1510, 1436, 1412, -1, -1, -1, -1, -1, -1},
+    {1412, 1495, 1510, -1, -1, -1, -1, -1, -1},
+    {1538, 1476, 1436, -1, -1, -1, -1, -1, -1},
+    {1436, 1510, 1538, -1, -1, -1, -1, -1, -1},
+    {1578, 1514, 1476, -1, -1, -1, -1, -1, -1},
+    {1476, 1538, 1578, -1, -1, -1, -1, -1, -1},
+    {1598, 1562, 1514, -1, -1, -1, -1, -1, -1},
+    {1514, 1578, 1598, -1, -1, -1, -1, -1, -1},
+    {1630, 1604, 1562, -1, -1, -1, -1, -1, -1},
+    {1562, 1598, 1630, -1, -1, -1, -1, -1, -1},
+    {1652, 1644, 1604, -1, -1, -1, -1, -1, -1},
+    {1604, 1630, 1652, -1, -1, -1, -1, -1, -1},
+    {1680, 1678, 1644, -1, -1, -1, -1, -1, -1},
+    {1644, 1652, 1680, -1, -1, -1, -1, -1, -1},
+    {1901, 1899, 1678, -1, -1, -1, -1, -1, -1},
+    {1678, 1680, 1901, -1, -1, -1, -1, -1, -1},
+    {1543, 1481, 1477, -1, -1, -1, -1, -1, -1},
+    {1477, 1535, 1543, -1, -1, -1, -1, -1, -1},
+    {1547, 1495, 1481, -1, -1, -1, -1, -1, -1},
+    {1481, 1543, 1547, -1, -1, -1, -1, -1, -1},
+    {1567, 1510, 1495, -1, -1, -1, -1, -1, -1},
+    {1495, 1547, 1567, -1, -1, -1, -1, -1, -1},
+    {1583, 1538, 1510, -1, -1, -1, -1, -1, -1},
+    {1510, 1567, 1583, -1, -1, -1, -1, -1, -1},
+    {1601, 1578, 1538, -1, -1, -1, -1, -1, -1},
+    {1538, 1583, 1601, -1, -1, -1, -1, -1, -1},
+    {1626, 1598, 1578, -1, -1, -1, -1, -1, -1},
+    {1578, 1601, 1626, -1, -1, -1, -1, -1, -1},
+    {1648, 1630, 1598, -1, -1, -1, -1, -1, -1},
+    {1598, 1626, 1648, -1, -1, -1, -1, -1, -1},
+    {1668, 1652, 1630, -1, -1, -1, -1, -1, -1},
+    {1630, 1648, 1668, -1, -1, -1, -1, -1, -1},
+    {1688, 1680, 1652, -1, -1, -1, -1, -1, -1},
+    {1652, 1668, 1688, -1, -1, -1, -1, -1, -1},
+    {1920, 1901, 1680, -1, -1, -1, -1, -1, -1},
+    {1680, 1688, 1920, -1, -1, -1, -1, -1, -1},
+    {1559, 1543, 1535, -1, -1, -1, -1, -1, -1},
+    {1535, 1551, 1559, -1, -1, -1, -1, -1, -1},
+    {1571, 1547, 1543, -1, -1, -1, -1, -1, -1},
+    {1543, 1559, 1571, -1, -1, -1, -1, -1, -1},
+    {1581, 1567, 1547, -1, -1, -1, -1, -1, -1},
+    {1547, 1571, 1581, -1, -1, -1, -1, -1, -1},
+    {1593, 1583, 1567, -1, -1, -1, -1, -1, -1},
+    {1567, 1581, 1593, -1, -1, -1, -1, -1, -1},
+    {1609, 1601, 1583, -1, -1, -1, -1, -1, -1},
+    {1583, 1593, 1609, -1, -1, -1, -1, -1, -1},
+    {1631, 1626, 1601, -1, -1, -1, -1, -1, -1},
+    {1601, 1609, 1631, -1, -1, -1, -1, -1, -1},
+    {1650, 1648, 1626, -1, -1, -1, -1, -1, -1},
+    {1626, 1631, 1650, -1, -1, -1, -1, -1, -1},
+    {1672, 1668, 1648, -1, -1, -1, -1, -1, -1},
+    {1648, 1650, 1672, -1, -1, -1, -1, -1, -1},
+    {1690, 1688, 1668, -1, -1, -1, -1, -1, -1},
+    {1668, 1672, 1690, -1, -1, -1, -1, -1, -1},
+    {1921, 1920, 1688, -1, -1, -1, -1, -1, -1},
+    {1688, 1690, 1921, -1, -1, -1, -1, -1, -1},
+    {1507, 1559, 1551, -1, -1, -1, -1, -1, -1},
+    {1551, 1499, 1507, -1, -1, -1, -1, -1, -1},
+    {1521, 1571, 1559, -1, -1, -1, -1, -1, -1},
+    {1559, 1507, 1521, -1, -1, -1, -1, -1, -1},
+    {1541, 1581, 1571, -1, -1, -1, -1, -1, -1},
+    {1571, 1521, 1541, -1, -1, -1, -1, -1, -1},
+    {1565, 1593, 1581, -1, -1, -1, -1, -1, -1},
+    {1581, 1541, 1565, -1, -1, -1, -1, -1, -1},
+    {1589, 1609, 1593, -1, -1, -1, -1, -1, -1},
+    {1593, 1565, 1589, -1, -1, -1, -1, -1, -1},
+    {1613, 1631, 1609, -1, -1, -1, -1, -1, -1},
+    {1609, 1589, 1613, -1, -1, -1, -1, -1, -1},
+    {1638, 1650, 1631, -1, -1, -1, -1, -1, -1},
+    {1631, 1613, 1638, -1, -1, -1, -1, -1, -1},
+    {1658, 1672, 1650, -1, -1, -1, -1, -1, -1},
+    {1650, 1638, 1658, -1, -1, -1, -1, -1, -1},
+    {1684, 1690, 1672, -1, -1, -1, -1, -1, -1},
+    {1672, 1658, 1684, -1, -1, -1, -1, -1, -1},
+    {1927, 1921, 1690, -1, -1, -1, -1, -1, -1},
+    {1690, 1684, 1927, -1, -1, -1, -1, -1, -1},
+    {1887, 1886, 1936, -1, -1, -1, -1, -1, -1},
+    {1887, 1936, 1960, -1, -1, -1, -1, -1, -1},
+    {1887, 1960, 1982, -1, -1, -1, -1, -1, -1},
+    {1887, 1982, 2006, -1, -1, -1, -1, -1, -1},
+    {1887, 2006, 2030, -1, -1, -1, -1, -1, -1},
+    {1887, 2030, 2048, -1, -1, -1, -1, -1, -1},
+    {1887, 2048, 2076, -1, -1, -1, -1, -1, -1},
+    {1887, 2076, 2096, -1, -1, -1, -1, -1, -1},
+    {1887, 2096, 2104, -1, -1, -1, -1, -1, -1},
+    {1887, 2104, 2110, -1, -1, -1, -1, -1, -1},
+    {1948, 1936, 1886, -1, -1, -1, -1, -1, -1},
+    {1886, 1884, 1948, -1, -1, -1, -1, -1, -1},
+    {1988, 1960, 1936, -1, -1, -1, -1, -1, -1},
+    {1936, 1948, 1988, -1, -1, -1, -1, -1, -1},
+    {2036, 1982, 1960, -1, -1, -1, -1, -1, -1},
+    {1960, 1988, 2036, -1, -1, -1, -1, -1, -1},
+    {2094, 2006, 1982, -1, -1, -1, -1, -1, -1},
+    {1982, 2036, 2094, -1, -1, -1, -1, -1, -1},
+    {2142, 2030, 2006, -1, -1, -1, -1, -1, -1},
+    {2006, 2094, 2142, -1, -1, -1, -1, -1, -1},
+    {2200, 2048, 2030, -1, -1, -1, -1, -1, -1},
+    {2030, 2142, 2200, -1, -1, -1, -1, -1, -1},
+    {2226, 2076, 2048, -1, -1, -1, -1, -1, -1},
+    {2048, 2200, 2226, -1, -1, -1, -1, -1, -1},
+    {2249, 2096, 2076, -1, -1, -1, -1, -1, -1},
+    {2076, 2226, 2249, -1, -1, -1, -1, -1, -1},
+    {2257, 2104, 2096, -1, -1, -1, -1, -1, -1},
+    {2096, 2249, 2257, -1, -1, -1, -1, -1, -1},
+    {2261, 2110, 2104, -1, -1, -1, -1, -1, -1},
+    {2104, 2257, 2261, -1, -1, -1, -1, -1, -1},
+    {1956, 1948, 1884, -1, -1, -1, -1, -1, -1},
+    {1884, 1882, 1956, -1, -1, -1, -1, -1, -1},
+    {2000, 1988, 1948, -1, -1, -1, -1, -1, -1},
+    {1948, 1956, 2000, -1, -1, -1, -1, -1, -1},
+    {2065, 2036, 1988, -1, -1, -1, -1, -1, -1},
+    {1988, 2000, 2065, -1, -1, -1, -1, -1, -1},
+    {2132, 2094, 2036, -1, -1, -1, -1, -1, -1},
+    {2036, 2065, 2132, -1, -1, -1, -1, -1, -1},
+    {2204, 2142, 2094, -1, -1, -1, -1, -1, -1},
+    {2094, 2132, 2204, -1, -1, -1, -1, -1, -1},
+    {2243, 2200, 2142, -1, -1, -1, -1, -1, -1},
+    {2142, 2204, 2243, -1, -1, -1, -1, -1, -1},
+    {2279, 2226, 2200, -1, -1, -1, -1, -1, -1},
+    {2200, 2243, 2279, -1, -1, -1, -1, -1, -1},
+    {2300, 2249, 2226, -1, -1, -1, -1, -1, -1},
+    {2226, 2279, 2300, -1, -1, -1, -1, -1, -1},
+    {2310, 2257, 2249, -1, -1, -1, -1, -1, -1},
+    {2249, 2300, 2310, -1, -1, -1, -1, -1, -1},
+    {2313, 2261, 2257, -1, -1, -1, -1, -1, -1},
+    {2257, 2310, 2313, -1, -1, -1, -1, -1, -1},
+    {1958, 1956, 1882, -1, -1, -1, -1, -1, -1},
+    {1882, 1879, 1958, -1, -1, -1, -1, -1, -1},
+    {2002, 2000, 1956, -1, -1, -1, -1, -1, -1},
+    {1956, 1958, 2002, -1, -1, -1, -1, -1, -1},
+    {2068, 2065, 2000, -1, -1, -1, -1, -1, -1},
+    {2000, 2002, 2068, -1, -1, -1, -1, -1, -1},
+    {2134, 2132, 2065, -1, -1, -1, -1, -1, -1},
+    {2065, 2068, 2134, -1, -1, -1, -1, -1, -1},
+    {2206, 2204, 2132, -1, -1, -1, -1, -1, -1},
+    {2132, 2134, 2206, -1, -1, -1, -1, -1, -1},
+    {2245, 2243, 2204, -1, -1, -1, -1, -1, -1},
+    {2204, 2206, 2245, -1, -1, -1, -1, -1, -1},
+    {2281, 2279, 2243, -1, -1, -1, -1, -1, -1},
+    {2243, 2245, 2281, -1, -1, -1, -1, -1, -1},
+    {2302, 2300, 2279, -1, -1, -1, -1, -1, -1},
+    {2279, 2281, 2302, -1, -1, -1, -1, -1, -1},
+    {2312, 2310, 2300, -1, -1, -1, -1, -1, -1},
+    {2300, 2302, 2312, -1, -1, -1, -1, -1, -1},
+    {2316, 2313, 2310, -1, -1, -1, -1, -1, -1},
+    {2310, 2312, 2316, -1, -1, -1, -1, -1, -1},
+    {1952, 1958, 1879, -1, -1, -1, -1, -1, -1},
+    {1879, 1876, 1952, -1, -1, -1, -1, -1, -1},
+    {1994, 2002, 1958, -1, -1, -1, -1, -1, -1},
+    {1958, 1952, 1994, -1, -1, -1, -1, -1, -1},
+    {2042, 2068, 2002, -1, -1, -1, -1, -1, -1},
+    {2002, 1994, 2042, -1, -1, -1, -1, -1, -1},
+    {2106, 2134, 2068, -1, -1, -1, -1, -1, -1},
+    {2068, 2042, 2106, -1, -1, -1, -1, -1, -1},
+    {2168, 2206, 2134, -1, -1, -1, -1, -1, -1},
+    {2134, 2106, 2168, -1, -1, -1, -1, -1, -1},
+    {2214, 2245, 2206, -1, -1, -1, -1, -1, -1},
+    {2206, 2168, 2214, -1, -1, -1, -1, -1, -1},
+    {2241, 2281, 2245, -1, -1, -1, -1, -1, -1},
+    {2245, 2214, 2241, -1, -1, -1, -1, -1, -1},
+    {2259, 2302, 2281, -1, -1, -1, -1, -1, -1},
+    {2281, 2241, 2259, -1, -1, -1, -1, -1, -1},
+    {2285, 2312, 2302, -1, -1, -1, -1, -1, -1},
+    {2302, 2259, 2285, -1, -1, -1, -1, -1, -1},
+    {2289, 2316, 2312, -1, -1, -1, -1, -1, -1},
+    {2312, 2285, 2289, -1, -1, -1, -1, -1, -1},
+    {1944, 1952, 1876, -1, -1, -1, -1, -1, -1},
+    {1876, 1874, 1944, -1, -1, -1, -1, -1, -1},
+    {1978, 1994, 1952, -1, -1, -1, -1, -1, -1},
+    {1952, 1944, 1978, -1, -1, -1, -1, -1, -1},
+    {2018, 2042, 1994, -1, -1, -1, -1, -1, -1},
+    {1994, 1978, 2018, -1, -1, -1, -1, -1, -1},
+    {2060, 2106, 2042, -1, -1, -1, -1, -1, -1},
+    {2042, 2018, 2060, -1, -1, -1, -1, -1, -1},
+    {2108, 2168, 2106, -1, -1, -1, -1, -1, -1},
+    {2106, 2060, 2108, -1, -1, -1, -1, -1, -1},
+    {2146, 2214, 2168, -1, -1, -1, -1, -1, -1},
+    {2168, 2108, 2146, -1, -1, -1, -1, -1, -1},
+    {2186, 2241, 2214, -1, -1, -1, -1, -1, -1},
+    {2214, 2146, 2186, -1, -1, -1, -1, -1, -1},
+    {2210, 2259, 2241, -1, -1, -1, -1, -1, -1},
+    {2241, 2186, 2210, -1, -1, -1, -1, -1, -1},
+    {2220, 2285, 2259, -1, -1, -1, -1, -1, -1},
+    {2259, 2210, 2220, -1, -1, -1, -1, -1, -1},
+    {2223, 2289, 2285, -1, -1, -1, -1, -1, -1},
+    {2285, 2220, 2223, -1, -1, -1, -1, -1, -1},
+    {1942, 1944, 1874, -1, -1, -1, -1, -1, -1},
+    {1874, 1872, 1942, -1, -1, -1, -1, -1, -1},
+    {1970, 1978, 1944, -1, -1, -1, -1, -1, -1},
+    {1944, 1942, 1970, -1, -1, -1, -1, -1, -1},
+    {1992, 2018, 1978, -1, -1, -1, -1, -1, -1},
+    {1978, 1970, 1992, -1, -1, -1, -1, -1, -1},
+    {2024, 2060, 2018, -1, -1, -1, -1, -1, -1},
+    {2018, 1992, 2024, -1, -1, -1, -1, -1, -1},
+    {2044, 2108, 2060, -1, -1, -1, -1, -1, -1},
+    {2060, 2024, 2044, -1, -1, -1, -1, -1, -1},
+    {2084, 2146, 2108, -1, -1, -1, -1, -1, -1},
+    {2108, 2044, 2084, -1, -1, -1, -1, -1, -1},
+    {2112, 2186, 2146, -1, -1, -1, -1, -1, -1},
+    {2146, 2084, 2112, -1, -1, -1, -1, -1, -1},
+    {2125, 2210, 2186, -1, -1, -1, -1, -1, -1},
+    {2186, 2112, 2125, -1, -1, -1, -1, -1, -1},
+    {2139, 2220, 2210, -1, -1, -1, -1, -1, -1},
+    {2210, 2125, 2139, -1, -1, -1, -1, -1, -1},
+    {2143, 2223, 2220, -1, -1, -1, -1, -1, -1},
+    {2220, 2139, 2143, -1, -1, -1, -1, -1, -1},
+    {1934, 1942, 1872, -1, -1, -1, -1, -1, -1},
+    {1872, 1870, 1934, -1, -1, -1, -1, -1, -1},
+    {1954, 1970, 1942, -1, -1, -1, -1, -1, -1},
+    {1942, 1934, 1954, -1, -1, -1, -1, -1, -1},
+    {1974, 1992, 1970, -1, -1, -1, -1, -1, -1},
+    {1970, 1954, 1974, -1, -1, -1, -1, -1, -1},
+    {1996, 2024, 1992, -1, -1, -1, -1, -1, -1},
+    {1992, 1974, 1996, -1, -1, -1, -1, -1, -1},
+    {2019, 2044, 2024, -1, -1, -1, -1, -1, -1},
+    {2024, 1996, 2019, -1, -1, -1, -1, -1, -1},
+    {2037, 2084, 2044, -1, -1, -1, -1, -1, -1},
+    {2044, 2019, 2037, -1, -1, -1, -1, -1, -1},
+    {2053, 2112, 2084, -1, -1, -1, -1, -1, -1},
+    {2084, 2037, 2053, -1, -1, -1, -1, -1, -1},
+    {2073, 2125, 2112, -1, -1, -1, -1, -1, -1},
+    {2112, 2053, 2073, -1, -1, -1, -1, -1, -1},
+    {2077, 2139, 2125, -1, -1, -1, -1, -1, -1},
+    {2125, 2073, 2077, -1, -1, -1, -1, -1, -1},
+    {2085, 2143, 2139, -1, -1, -1, -1, -1, -1},
+    {2139, 2077, 2085, -1, -1, -1, -1, -1, -1},
+    {1932, 1934, 1870, -1, -1, -1, -1, -1, -1},
+    {1870, 1868, 1932, -1, -1, -1, -1, -1, -1},
+    {1950, 1954, 1934, -1, -1, -1, -1, -1, -1},
+    {1934, 1932, 1950, -1, -1, -1, -1, -1, -1},
+    {1972, 1974, 1954, -1, -1, -1, -1, -1, -1},
+    {1954, 1950, 1972, -1, -1, -1, -1, -1, -1},
+    {1989, 1996, 1974, -1, -1, -1, -1, -1, -1},
+    {1974, 1972, 1989, -1, -1, -1, -1, -1, -1},
+    {2011, 2019, 1996, -1, -1, -1, -1, -1, -1},
+    {1996, 1989, 2011, -1, -1, -1, -1, -1, -1},
+    {2027, 2037, 2019, -1, -1, -1, -1, -1, -1},
+    {2019, 2011, 2027, -1, -1, -1, -1, -1, -1},
+    {2039, 2053, 2037, -1, -1, -1, -1, -1, -1},
+    {2037, 2027, 2039, -1, -1, -1, -1, -1, -1},
+    {2049, 2073, 2053, -1, -1, -1, -1, -1, -1},
+    {2053, 2039, 2049, -1, -1, -1, -1, -1, -1},
+    {2061, 2077, 2073, -1, -1, -1, -1, -1, -1},
+    {2073, 2049, 2061, -1, -1, -1, -1, -1, -1},
+    {2069, 2085, 2077, -1, -1, -1, -1, -1, -1},
+    {2077, 2061, 2069, -1, -1, -1, -1, -1, -1},
+    {1938, 1932, 1868, -1, -1, -1, -1, -1, -1},
+    {1868, 1865, 1938, -1, -1, -1, -1, -1, -1},
+    {1964, 1950, 1932, -1, -1, -1, -1, -1, -1},
+    {1932, 1938, 1964, -1, -1, -1, -1, -1, -1},
+    {1984, 1972, 1950, -1, -1, -1, -1, -1, -1},
+    {1950, 1964, 1984, -1, -1, -1, -1, -1, -1},
+    {2007, 1989, 1972, -1, -1, -1, -1, -1, -1},
+    {1972, 1984, 2007, -1, -1, -1, -1, -1, -1},
+    {2031, 2011, 1989, -1, -1, -1, -1, -1, -1},
+    {1989, 2007, 2031, -1, -1, -1, -1, -1, -1},
+    {2055, 2027, 2011, -1, -1, -1, -1, -1, -1},
+    {2011, 2031, 2055, -1, -1, -1, -1, -1, -1},
+    {2079, 2039, 2027, -1, -1, -1, -1, -1, -1},
+    {2027, 2055, 2079, -1, -1, -1, -1, -1, -1},
+    {2099, 2049, 2039, -1, -1, -1, -1, -1, -1},
+    {2039, 2079, 2099, -1, -1, -1, -1, -1, -1},
+    {2113, 2061, 2049, -1, -1, -1, -1, -1, -1},
+    {2049, 2099, 2113, -1, -1, -1, -1, -1, -1},
+    {2121, 2069, 2061, -1, -1, -1, -1, -1, -1},
+    {2061, 2113, 2121, -1, -1, -1, -1, -1, -1},
+    {2231, 2115, 2123, -1, -1, -1, -1, -1, -1},
+    {2123, 2235, 2231, -1, -1, -1, -1, -1, -1},
+    {2217, 2101, 2115, -1, -1, -1, -1, -1, -1},
+    {2115, 2231, 2217, -1, -1, -1, -1, -1, -1},
+    {2198, 2081, 2101, -1, -1, -1, -1, -1, -1},
+    {2101, 2217, 2198, -1, -1, -1, -1, -1, -1},
+    {2149, 2057, 2081, -1, -1, -1, -1, -1, -1},
+    {2081, 2198, 2149, -1, -1, -1, -1, -1, -1},
+    {2119, 2033, 2057, -1, -1, -1, -1, -1, -1},
+    {2057, 2149, 2119, -1, -1, -1, -1, -1, -1},
+    {2063, 2009, 2033, -1, -1, -1, -1, -1, -1},
+    {2033, 2119, 2063, -1, -1, -1, -1, -1, -1},
+    {2022, 1985, 2009, -1, -1, -1, -1, -1, -1},
+    {2009, 2063, 2022, -1, -1, -1, -1, -1, -1},
+    {1979, 1965, 1985, -1, -1, -1, -1, -1, -1},
+    {1985, 2022, 1979, -1, -1, -1, -1, -1, -1},
+    {1945, 1939, 1965, -1, -1, -1, -1, -1, -1},
+    {1965, 1979, 1945, -1, -1, -1, -1, -1, -1},
+    {1861, 1729, 1939, -1, -1, -1, -1, -1, -1},
+    {1939, 1945, 1861, -1, -1, -1, -1, -1, -1},
+    {2331, 2231, 2235, -1, -1, -1, -1, -1, -1},
+    {2235, 2335, 2331, -1, -1, -1, -1, -1, -1},
+    {2321, 2217, 2231, -1, -1, -1, -1, -1, -1},
+    {2231, 2331, 2321, -1, -1, -1, -1, -1, -1},
+    {2305, 2198, 2217, -1, -1, -1, -1, -1, -1},
+    {2217, 2321, 2305, -1, -1, -1, -1, -1, -1},
+    {2274, 2149, 2198, -1, -1, -1, -1, -1, -1},
+    {2198, 2305, 2274, -1, -1, -1, -1, -1, -1},
+    {2233, 2119, 2149, -1, -1, -1, -1, -1, -1},
+    {2149, 2274, 2233, -1, -1, -1, -1, -1, -1},
+    {2169, 2063, 2119, -1, -1, -1, -1, -1, -1},
+    {2119, 2233, 2169, -1, -1, -1, -1, -1, -1},
+    {2092, 2022, 2063, -1, -1, -1, -1, -1, -1},
+    {2063, 2169, 2092, -1, -1, -1, -1, -1, -1},
+    {2015, 1979, 2022, -1, -1, -1, -1, -1, -1},
+    {2022, 2092, 2015, -1, -1, -1, -1, -1, -1},
+    {1967, 1945, 1979, -1, -1, -1, -1, -1, -1},
+    {1979, 2015, 1967, -1, -1, -1, -1, -1, -1},
+    {1857, 1861, 1945, -1, -1, -1, -1, -1, -1},
+    {1945, 1967, 1857, -1, -1, -1, -1, -1, -1},
+    {2408, 2331, 2335, -1, -1, -1, -1, -1, -1},
+    {2335, 2412, 2408, -1, -1, -1, -1, -1, -1},
+    {2399, 2321, 2331, -1, -1, -1, -1, -1, -1},
+    {2331, 2408, 2399, -1, -1, -1, -1, -1, -1},
+    {2375, 2305, 2321, -1, -1, -1, -1, -1, -1},
+    {2321, 2399, 2375, -1, -1, -1, -1, -1, -1},
+    {2348, 2274, 2305, -1, -1, -1, -1, -1, -1},
+    {2305, 2375, 2348, -1, -1, -1, -1, -1, -1},
+    {2323, 2233, 2274, -1, -1, -1, -1, -1, -1},
+    {2274, 2348, 2323, -1, -1, -1, -1, -1, -1},
+    {2270, 2169, 2233, -1, -1, -1, -1, -1, -1},
+    {2233, 2323, 2270, -1, -1, -1, -1, -1, -1},
+    {2184, 2092, 2169, -1, -1, -1, -1, -1, -1},
+    {2169, 2270, 2184, -1, -1, -1, -1, -1, -1},
+    {2071, 2015, 2092, -1, -1, -1, -1, -1, -1},
+    {2092, 2184, 2071, -1, -1, -1, -1, -1, -1},
+    {1975, 1967, 2015, -1, -1, -1, -1, -1, -1},
+    {2015, 2071, 1975, -1, -1, -1, -1, -1, -1},
+    {1728, 1857, 1967, -1, -1, -1, -1, -1, -1},
+    {1967, 1975, 1728, -1, -1, -1, -1, -1, -1},
+    {2487, 2408, 2412, -1, -1, -1, -1, -1, -1},
+    {2412, 2497, 2487, -1, -1, -1, -1, -1, -1},
+    {2469, 2399, 2408, -1, -1, -1, -1, -1, -1},
+    {2408, 2487, 2469, -1, -1, -1, -1, -1, -1},
+    {2443, 2375, 2399, -1, -1, -1, -1, -1, -1},
+    {2399, 2469, 2443, -1, -1, -1, -1, -1, -1},
+    {2417, 2348, 2375, -1, -1, -1, -1, -1, -1},
+    {2375, 2443, 2417, -1, -1, -1, -1, -1, -1},
+    {2383, 2323, 2348, -1, -1, -1, -1, -1, -1},
+    {2348, 2417, 2383, -1, -1, -1, -1, -1, -1},
+    {2337, 2270, 2323, -1, -1, -1, -1, -1, -1},
+    {2323, 2383, 2337, -1, -1, -1, -1, -1, -1},
+    {2268, 2184, 2270, -1, -1, -1, -1, -1, -1},
+    {2270, 2337, 2268, -1, -1, -1, -1, -1, -1},
+    {2137, 2071, 2184, -1, -1, -1, -1, -1, -1},
+    {2184, 2268, 2137, -1, -1, -1, -1, -1, -1},
+    {1997, 1975, 2071, -1, -1, -1, -1, -1, -1},
+    {2071, 2137, 1997, -1, -1, -1, -1, -1, -1},
+    {1721, 1728, 1975, -1, -1, -1, -1, -1, -1},
+    {1975, 1997, 1721, -1, -1, -1, -1, -1, -1},
+    {2558, 2487, 2497, -1, -1, -1, -1, -1, -1},
+    {2497, 2568, 2558, -1, -1, -1, -1, -1, -1},
+    {2548, 2469, 2487, -1, -1, -1, -1, -1, -1},
+    {2487, 2558, 2548, -1, -1, -1, -1, -1, -1},
+    {2530, 2443, 2469, -1, -1, -1, -1, -1, -1},
+    {2469, 2548, 2530, -1, -1, -1, -1, -1, -1},
+    {2491, 2417, 2443, -1, -1, -1, -1, -1, -1},
+    {2443, 2530, 2491, -1, -1, -1, -1, -1, -1},
+    {2435, 2383, 2417, -1, -1, -1, -1, -1, -1},
+    {2417, 2491, 2435, -1, -1, -1, -1, -1, -1},
+    {2393, 2337, 2383, -1, -1, -1, -1, -1, -1},
+    {2383, 2435, 2393, -1, -1, -1, -1, -1, -1},
+    {2325, 2268, 2337, -1, -1, -1, -1, -1, -1},
+    {2337, 2393, 2325, -1, -1, -1, -1, -1, -1},
+    {2211, 2137, 2268, -1, -1, -1, -1, -1, -1},
+    {2268, 2325, 2211, -1, -1, -1, -1, -1, -1},
+    {2025, 1997, 2137, -1, -1, -1, -1, -1, -1},
+    {2137, 2211, 2025, -1, -1, -1, -1, -1, -1},
+    {1849, 1721, 1997, -1, -1, -1, -1, -1, -1},
+    {1997, 2025, 1849, -1, -1, -1, -1, -1, -1},
+    {2652, 2558, 2568, -1, -1, -1, -1, -1, -1},
+    {2568, 2654, 2652, -1, -1, -1, -1, -1, -1},
+    {2630, 2548, 2558, -1, -1, -1, -1, -1, -1},
+    {2558, 2652, 2630, -1, -1, -1, -1, -1, -1},
+    {2592, 2530, 2548, -1, -1, -1, -1, -1, -1},
+    {2548, 2630, 2592, -1, -1, -1, -1, -1, -1},
+    {2550, 2491, 2530, -1, -1, -1, -1, -1, -1},
+    {2530, 2592, 2550, -1, -1, -1, -1, -1, -1},
+    {2509, 2435, 2491, -1, -1, -1, -1, -1, -1},
+    {2491, 2550, 2509, -1, -1, -1, -1, -1, -1},
+    {2431, 2393, 2435, -1, -1, -1, -1, -1, -1},
+    {2435, 2509, 2431, -1, -1, -1, -1, -1, -1},
+    {2365, 2325, 2393, -1, -1, -1, -1, -1, -1},
+    {2393, 2431, 2365, -1, -1, -1, -1, -1, -1},
+    {2262, 2211, 2325, -1, -1, -1, -1, -1, -1},
+    {2325, 2365, 2262, -1, -1, -1, -1, -1, -1},
+    {2051, 2025, 2211, -1, -1, -1, -1, -1, -1},
+    {2211, 2262, 2051, -1, -1, -1, -1, -1, -1},
+    {1725, 1849, 2025, -1, -1, -1, -1, -1, -1},
+    {2025, 2051, 1725, -1, -1, -1, -1, -1, -1},
+    {2719, 2652, 2654, -1, -1, -1, -1, -1, -1},
+    {2654, 2725, 2719, -1, -1, -1, -1, -1, -1},
+    {2696, 2630, 2652, -1, -1, -1, -1, -1, -1},
+    {2652, 2719, 2696, -1, -1, -1, -1, -1, -1},
+    {2661, 2592, 2630, -1, -1, -1, -1, -1, -1},
+    {2630, 2696, 2661, -1, -1, -1, -1, -1, -1},
+    {2606, 2550, 2592, -1, -1, -1, -1, -1, -1},
+    {2592, 2661, 2606, -1, -1, -1, -1, -1, -1},
+    {2546, 2509, 2550, -1, -1, -1, -1, -1, -1},
+    {2550, 2606, 2546, -1, -1, -1, -1, -1, -1},
+    {2483, 2431, 2509, -1, -1, -1, -1, -1, -1},
+    {2509, 2546, 2483, -1, -1, -1, -1, -1, -1},
+    {2404, 2365, 2431, -1, -1, -1, -1, -1, -1},
+    {2431, 2483, 2404, -1, -1, -1, -1, -1, -1},
+    {2307, 2262, 2365, -1, -1, -1, -1, -1, -1},
+    {2365, 2404, 2307, -1, -1, -1, -1, -1, -1},
+    {2089, 2051, 2262, -1, -1, -1, -1, -1, -1},
+    {2262, 2307, 2089, -1, -1, -1, -1, -1, -1},
+    {1718, 1725, 2051, -1, -1, -1, -1, -1, -1},
+    {2051, 2089, 1718, -1, -1, -1, -1, -1, -1},
+    {2786, 2719, 2725, -1, -1, -1, -1, -1, -1},
+    {2725, 2794, 2786, -1, -1, -1, -1, -1, -1},
+    {2758, 2696, 2719, -1, -1, -1, -1, -1, -1},
+    {2719, 2786, 2758, -1, -1, -1, -1, -1, -1},
+    {2712, 2661, 2696, -1, -1, -1, -1, -1, -1},
+    {2696, 2758, 2712, -1, -1, -1, -1, -1, -1},
+    {2656, 2606, 2661, -1, -1, -1, -1, -1, -1},
+    {2661, 2712, 2656, -1, -1, -1, -1, -1, -1},
+    {2588, 2546, 2606, -1, -1, -1, -1, -1, -1},
+    {2606, 2656, 2588, -1, -1, -1, -1, -1, -1},
+    {2524, 2483, 2546, -1, -1, -1, -1, -1, -1},
+    {2546, 2588, 2524, -1, -1, -1, -1, -1, -1},
+    {2421, 2404, 2483, -1, -1, -1, -1, -1, -1},
+    {2483, 2524, 2421, -1, -1, -1, -1, -1, -1},
+    {2329, 2307, 2404, -1, -1, -1, -1, -1, -1},
+    {2404, 2421, 2329, -1, -1, -1, -1, -1, -1},
+    {2117, 2089, 2307, -1, -1, -1, -1, -1, -1},
+    {2307, 2329, 2117, -1, -1, -1, -1, -1, -1},
+    {1699, 1718, 2089, -1, -1, -1, -1, -1, -1},
+    {2089, 2117, 1699, -1, -1, -1, -1, -1, -1},
+    {2833, 2786, 2794, -1, -1, -1, -1, -1, -1},
+    {2794, 2843, 2833, -1, -1, -1, -1, -1, -1},
+    {2797, 2758, 2786, -1, -1, -1, -1, -1, -1},
+    {2786, 2833, 2797, -1, -1, -1, -1, -1, -1},
+    {2749, 2712, 2758, -1, -1, -1, -1, -1, -1},
+    {2758, 2797, 2749, -1, -1, -1, -1, -1, -1},
+    {2689, 2656, 2712, -1, -1, -1, -1, -1, -1},
+    {2712, 2749, 2689, -1, -1, -1, -1, -1, -1},
+    {2623, 2588, 2656, -1, -1, -1, -1, -1, -1},
+    {2656, 2689, 2623, -1, -1, -1, -1, -1, -1},
+    {2535, 2524, 2588, -1, -1, -1, -1, -1, -1},
+    {2588, 2623, 2535, -1, -1, -1, -1, -1, -1},
+    {2440, 2421, 2524, -1, -1, -1, -1, -1, -1},
+    {2524, 2535, 2440, -1, -1, -1, -1, -1, -1},
+    {2339, 2329, 2421, -1, -1, -1, -1, -1, -1},
+    {2421, 2440, 2339, -1, -1, -1, -1, -1, -1},
+    {2127, 2117, 2329, -1, -1, -1, -1, -1, -1},
+    {2329, 2339, 2127, -1, -1, -1, -1, -1, -1},
+    {1824, 1699, 2117, -1, -1, -1, -1, -1, -1},
+    {2117, 2127, 1824, -1, -1, -1, -1, -1, -1},
+    {2846, 2833, 2843, -1, -1, -1, -1, -1, -1},
+    {2843, 2856, 2846, -1, -1, -1, -1, -1, -1},
+    {2820, 2797, 2833, -1, -1, -1, -1, -1, -1},
+    {2833, 2846, 2820, -1, -1, -1, -1, -1, -1},
+    {2764, 2749, 2797, -1, -1, -1, -1, -1, -1},
+    {2797, 2820, 2764, -1, -1, -1, -1, -1, -1},
+    {2702, 2689, 2749, -1, -1, -1, -1, -1, -1},
+    {2749, 2764, 2702, -1, -1, -1, -1, -1, -1},
+    {2636, 2623, 2689, -1, -1, -1, -1, -1, -1},
+    {2689, 2702, 2636, -1, -1, -1, -1, -1, -1},
+    {2542, 2535, 2623, -1, -1, -1, -1, -1, -1},
+    {2623, 2636, 2542, -1, -1, -1, -1, -1, -1},
+    {2445, 2440, 2535, -1, -1, -1, -1, -1, -1},
+    {2535, 2542, 2445, -1, -1, -1, -1, -1, -1},
+    {2343, 2339, 2440, -1, -1, -1, -1, -1, -1},
+    {2440, 2445, 2343, -1, -1, -1, -1, -1, -1},
+    {2135, 2127, 2339, -1, -1, -1, -1, -1, -1},
+    {2339, 2343, 2135, -1, -1, -1, -1, -1, -1},
+    {1712, 1824, 2127, -1, -1, -1, -1, -1, -1},
+    {2127, 2135, 1712, -1, -1, -1, -1, -1, -1},
+    {1675, 1681, 1863, -1, -1, -1, -1, -1, -1},
+    {1863, 1861, 1675, -1, -1, -1, -1, -1, -1},
+    {1641, 1655, 1681, -1, -1, -1, -1, -1, -1},
+    {1681, 1675, 1641, -1, -1, -1, -1, -1, -1},
+    {1600, 1635, 1655, -1, -1, -1, -1, -1, -1},
+    {1655, 1641, 1600, -1, -1, -1, -1, -1, -1},
+    {1557, 1611, 1635, -1, -1, -1, -1, -1, -1},
+    {1635, 1600, 1557, -1, -1, -1, -1, -1, -1},
+    {1501, 1587, 1611, -1, -1, -1, -1, -1, -1},
+    {1611, 1557, 1501, -1, -1, -1, -1, -1, -1},
+    {1471, 1563, 1587, -1, -1, -1, -1, -1, -1},
+    {1587, 1501, 1471, -1, -1, -1, -1, -1, -1},
+    {1424, 1539, 1563, -1, -1, -1, -1, -1, -1},
+    {1563, 1471, 1424, -1, -1, -1, -1, -1, -1},
+    {1403, 1519, 1539, -1, -1, -1, -1, -1, -1},
+    {1539, 1424, 1403, -1, -1, -1, -1, -1, -1},
+    {1389, 1505, 1519, -1, -1, -1, -1, -1, -1},
+    {1519, 1403, 1389, -1, -1, -1, -1, -1, -1},
+    {1386, 1497, 1505, -1, -1, -1, -1, -1, -1},
+    {1505, 1389, 1386, -1, -1, -1, -1, -1, -1},
+    {1653, 1675, 1861, -1, -1, -1, -1, -1, -1},
+    {1861, 1858, 1653, -1, -1, -1, -1, -1, -1},
+    {1605, 1641, 1675, -1, -1, -1, -1, -1, -1},
+    {1675, 1653, 1605, -1, -1, -1, -1, -1, -1},
+    {1530, 1600, 1641, -1, -1, -1, -1, -1, -1},
+    {1641, 1605, 1530, -1, -1, -1, -1, -1, -1},
+    {1451, 1557, 1600, -1, -1, -1, -1, -1, -1},
+    {1600, 1530, 1451, -1, -1, -1, -1, -1, -1},
+    {1387, 1501, 1557, -1, -1, -1, -1, -1, -1},
+    {1557, 1451, 1387, -1, -1, -1, -1, -1, -1},
+    {1346, 1471, 1501, -1, -1, -1, -1, -1, -1},
+    {1501, 1387, 1346, -1, -1, -1, -1, -1, -1},
+    {1315, 1424, 1471, -1, -1, -1, -1, -1, -1},
+    {1471, 1346, 1315, -1, -1, -1, -1, -1, -1},
+    {1299, 1403, 1424, -1, -1, -1, -1, -1, -1},
+    {1424, 1315, 1299, -1, -1, -1, -1, -1, -1},
+    {1289, 1389, 1403, -1, -1, -1, -1, -1, -1},
+    {1403, 1299, 1289, -1, -1, -1, -1, -1, -1},
+    {1285, 1386, 1389, -1, -1, -1, -1, -1, -1},
+    {1389, 1289, 1285, -1, -1, -1, -1, -1, -1},
+    {1645, 1653, 1858, -1, -1, -1, -1, -1, -1},
+    {1858, 1855, 1645, -1, -1, -1, -1, -1, -1},
+    {1549, 1605, 1653, -1, -1, -1, -1, -1, -1},
+    {1653, 1645, 1549, -1, -1, -1, -1, -1, -1},
+    {1438, 1530, 1605, -1, -1, -1, -1, -1, -1},
+    {1605, 1549, 1438, -1, -1, -1, -1, -1, -1},
+    {1350, 1451, 1530, -1, -1, -1, -1, -1, -1},
+    {1530, 1438, 1350, -1, -1, -1, -1, -1, -1},
+    {1297, 1387, 1451, -1, -1, -1, -1, -1, -1},
+    {1451, 1350, 1297, -1, -1, -1, -1, -1, -1},
+    {1274, 1346, 1387, -1, -1, -1, -1, -1, -1},
+    {1387, 1297, 1274, -1, -1, -1, -1, -1, -1},
+    {1245, 1315, 1346, -1, -1, -1, -1, -1, -1},
+    {1346, 1274, 1245, -1, -1, -1, -1, -1, -1},
+    {1221, 1299, 1315, -1, -1, -1, -1, -1, -1},
+    {1315, 1245, 1221, -1, -1, -1, -1, -1, -1},
+    {1214, 1289, 1299, -1, -1, -1, -1, -1, -1},
+    {1299, 1221, 1214, -1, -1, -1, -1, -1, -1},
+    {1210, 1285, 1289, -1, -1, -1, -1, -1, -1},
+    {1289, 1214, 1210, -1, -1, -1, -1, -1, -1},
+    {1623, 1645, 1855, -1, -1, -1, -1, -1, -1},
+    {1855, 1853, 1623, -1, -1, -1, -1, -1, -1},
+    {1483, 1549, 1645, -1, -1, -1, -1, -1, -1},
+    {1645, 1623, 1483, -1, -1, -1, -1, -1, -1},
+    {1352, 1438, 1549, -1, -1, -1, -1, -1, -1},
+    {1549, 1483, 1352, -1, -1, -1, -1, -1, -1},
+    {1283, 1350, 1438, -1, -1, -1, -1, -1, -1},
+    {1438, 1352, 1283, -1, -1, -1, -1, -1, -1},
+    {1237, 1297, 1350, -1, -1, -1, -1, -1, -1},
+    {1350, 1283, 1237, -1, -1, -1, -1, -1, -1},
+    {1203, 1274, 1297, -1, -1, -1, -1, -1, -1},
+    {1297, 1237, 1203, -1, -1, -1, -1, -1, -1},
+    {1177, 1245, 1274, -1, -1, -1, -1, -1, -1},
+    {1274, 1203, 1177, -1, -1, -1, -1, -1, -1},
+    {1151, 1221, 1245, -1, -1, -1, -1, -1, -1},
+    {1245, 1177, 1151, -1, -1, -1, -1, -1, -1},
+    {1133, 1214, 1221, -1, -1, -1, -1, -1, -1},
+    {1221, 1151, 1133, -1, -1, -1, -1, -1, -1},
+    {1123, 1210, 1214, -1, -1, -1, -1, -1, -1},
+    {1214, 1133, 1123, -1, -1, -1, -1, -1, -1},
+    {1595, 1623, 1853, -1, -1, -1, -1, -1, -1},
+    {1853, 1850, 1595, -1, -1, -1, -1, -1, -1},
+    {1409, 1483, 1623, -1, -1, -1, -1, -1, -1},
+    {1623, 1595, 1409, -1, -1, -1, -1, -1, -1},
+    {1295, 1352, 1483, -1, -1, -1, -1, -1, -1},
+    {1483, 1409, 1295, -1, -1, -1, -1, -1, -1},
+    {1227, 1283, 1352, -1, -1, -1, -1, -1, -1},
+    {1352, 1295, 1227, -1, -1, -1, -1, -1, -1},
+    {1185, 1237, 1283, -1, -1, -1, -1, -1, -1},
+    {1283, 1227, 1185, -1, -1, -1, -1, -1, -1},
+    {1129, 1203, 1237, -1, -1, -1, -1, -1, -1},
+    {1237, 1185, 1129, -1, -1, -1, -1, -1, -1},
+    {1090, 1177, 1203, -1, -1, -1, -1, -1, -1},
+    {1203, 1129, 1090, -1, -1, -1, -1, -1, -1},
+    {1072, 1151, 1177, -1, -1, -1, -1, -1, -1},
+    {1177, 1090, 1072, -1, -1, -1, -1, -1, -1},
+    {1062, 1133, 1151, -1, -1, -1, -1, -1, -1},
+    {1151, 1072, 1062, -1, -1, -1, -1, -1, -1},
+    {1052, 1123, 1133, -1, -1, -1, -1, -1, -1},
+    {1133, 1062, 1052, -1, -1, -1, -1, -1, -1},
+    {1569, 1595, 1850, -1, -1, -1, -1, -1, -1},
+    {1850, 1847, 1569, -1, -1, -1, -1, -1, -1},
+    {1358, 1409, 1595, -1, -1, -1, -1, -1, -1},
+    {1595, 1569, 1358, -1, -1, -1, -1, -1, -1},
+    {1255, 1295, 1409, -1, -1, -1, -1, -1, -1},
+    {1409, 1358, 1255, -1, -1, -1, -1, -1, -1},
+    {1189, 1227, 1295, -1, -1, -1, -1, -1, -1},
+    {1295, 1255, 1189, -1, -1, -1, -1, -1, -1},
+    {1111, 1185, 1227, -1, -1, -1, -1, -1, -1},
+    {1227, 1189, 1111, -1, -1, -1, -1, -1, -1},
+    {1070, 1129, 1185, -1, -1, -1, -1, -1, -1},
+    {1185, 1111, 1070, -1, -1, -1, -1, -1, -1},
+    {1028, 1090, 1129, -1, -1, -1, -1, -1, -1},
+    {1129, 1070, 1028, -1, -1, -1, -1, -1, -1},
+    {990, 1072, 1090, -1, -1, -1, -1, -1, -1},
+    {1090, 1028, 990, -1, -1, -1, -1, -1, -1},
+    {968, 1062, 1072, -1, -1, -1, -1, -1, -1},
+    {1072, 990, 968, -1, -1, -1, -1, -1, -1},
+    {966, 1052, 1062, -1, -1, -1, -1, -1, -1},
+    {1062, 968, 966, -1, -1, -1, -1, -1, -1},
+    {1531, 1569, 1847, -1, -1, -1, -1, -1, -1},
+    {1847, 1845, 1531, -1, -1, -1, -1, -1, -1},
+    {1313, 1358, 1569, -1, -1, -1, -1, -1, -1},
+    {1569, 1531, 1313, -1, -1, -1, -1, -1, -1},
+    {1218, 1255, 1358, -1, -1, -1, -1, -1, -1},
+    {1358, 1313, 1218, -1, -1, -1, -1, -1, -1},
+    {1137, 1189, 1255, -1, -1, -1, -1, -1, -1},
+    {1255, 1218, 1137, -1, -1, -1, -1, -1, -1},
+    {1074, 1111, 1189, -1, -1, -1, -1, -1, -1},
+    {1189, 1137, 1074, -1, -1, -1, -1, -1, -1},
+    {1014, 1070, 1111, -1, -1, -1, -1, -1, -1},
+    {1111, 1074, 1014, -1, -1, -1, -1, -1, -1},
+    {961, 1028, 1070, -1, -1, -1, -1, -1, -1},
+    {1070, 1014, 961, -1, -1, -1, -1, -1, -1},
+    {924, 990, 1028, -1, -1, -1, -1, -1, -1},
+    {1028, 961, 924, -1, -1, -1, -1, -1, -1},
+    {903, 968, 990, -1, -1, -1, -1, -1, -1},
+    {990, 924, 903, -1, -1, -1, -1, -1, -1},
+    {897, 966, 968, -1, -1, -1, -1, -1, -1},
+    {968, 903, 897, -1, -1, -1, -1, -1, -1},
+    {1503, 1531, 1845, -1, -1, -1, -1, -1, -1},
+    {1845, 1831, 1503, -1, -1, -1, -1, -1, -1},
+    {1291, 1313, 1531, -1, -1, -1, -1, -1, -1},
+    {1531, 1503, 1291, -1, -1, -1, -1, -1, -1},
+    {1199, 1218, 1313, -1, -1, -1, -1, -1, -1},
+    {1313, 1291, 1199, -1, -1, -1, -1, -1, -1},
+    {1096, 1137, 1218, -1, -1, -1, -1, -1, -1},
+    {1218, 1199, 1096, -1, -1, -1, -1, -1, -1},
+    {1032, 1074, 1137, -1, -1, -1, -1, -1, -1},
+    {1137, 1096, 1032, -1, -1, -1, -1, -1, -1},
+    {964, 1014, 1074, -1, -1, -1, -1, -1, -1},
+    {1074, 1032, 964, -1, -1, -1, -1, -1, -1},
+    {908, 961, 1014, -1, -1, -1, -1, -1, -1},
+    {1014, 964, 908, -1, -1, -1, -1, -1, -1},
+    {862, 924, 961, -1, -1, -1, -1, -1, -1},
+    {961, 908, 862, -1, -1, -1, -1, -1, -1},
+    {834, 903, 924, -1, -1, -1, -1, -1, -1},
+    {924, 862, 834, -1, -1, -1, -1, -1, -1},
+    {826, 897, 903, -1, -1, -1, -1, -1, -1},
+    {903, 834, 826, -1, -1, -1, -1, -1, -1},
+    {1493, 1503, 1831, -1, -1, -1, -1, -1, -1},
+    {1831, 1823, 1493, -1, -1, -1, -1, -1, -1},
+    {1281, 1291, 1503, -1, -1, -1, -1, -1, -1},
+    {1503, 1493, 1281, -1, -1, -1, -1, -1, -1},
+    {1182, 1199, 1291, -1, -1, -1, -1, -1, -1},
+    {1291, 1281, 1182, -1, -1, -1, -1, -1, -1},
+    {1087, 1096, 1199, -1, -1, -1, -1, -1, -1},
+    {1199, 1182, 1087, -1, -1, -1, -1, -1, -1},
+    {999, 1032, 1096, -1, -1, -1, -1, -1, -1},
+    {1096, 1087, 999, -1, -1, -1, -1, -1, -1},
+    {933, 964, 1032, -1, -1, -1, -1, -1, -1},
+    {1032, 999, 933, -1, -1, -1, -1, -1, -1},
+    {873, 908, 964, -1, -1, -1, -1, -1, -1},
+    {964, 933, 873, -1, -1, -1, -1, -1, -1},
+    {825, 862, 908, -1, -1, -1, -1, -1, -1},
+    {908, 873, 825, -1, -1, -1, -1, -1, -1},
+    {789, 834, 862, -1, -1, -1, -1, -1, -1},
+    {862, 825, 789, -1, -1, -1, -1, -1, -1},
+    {779, 826, 834, -1, -1, -1, -1, -1, -1},
+    {834, 789, 779, -1, -1, -1, -1, -1, -1},
+    {1485, 1493, 1823, -1, -1, -1, -1, -1, -1},
+    {1823, 1813, 1485, -1, -1, -1, -1, -1, -1},
+    {1277, 1281, 1493, -1, -1, -1, -1, -1, -1},
+    {1493, 1485, 1277, -1, -1, -1, -1, -1, -1},
+    {1175, 1182, 1281, -1, -1, -1, -1, -1, -1},
+    {1281, 1277, 1175, -1, -1, -1, -1, -1, -1},
+    {1078, 1087, 1182, -1, -1, -1, -1, -1, -1},
+    {1182, 1175, 1078, -1, -1, -1, -1, -1, -1},
+    {984, 999, 1087, -1, -1, -1, -1, -1, -1},
+    {1087, 1078, 984, -1, -1, -1, -1, -1, -1},
+    {918, 933, 999, -1, -1, -1, -1, -1, -1},
+    {999, 984, 918, -1, -1, -1, -1, -1, -1},
+    {856, 873, 933, -1, -1, -1, -1, -1, -1},
+    {933, 918, 856, -1, -1, -1, -1, -1, -1},
+    {800, 825, 873, -1, -1, -1, -1, -1, -1},
+    {873, 856, 800, -1, -1, -1, -1, -1, -1},
+    {774, 789, 825, -1, -1, -1, -1, -1, -1},
+    {825, 800, 774, -1, -1, -1, -1, -1, -1},
+    {764, 779, 789, -1, -1, -1, -1, -1, -1},
+    {789, 774, 764, -1, -1, -1, -1, -1, -1},
+    {1390, 1506, 1498, -1, -1, -1, -1, -1, -1},
+    {1498, 1386, 1390, -1, -1, -1, -1, -1, -1},
+    {1404, 1520, 1506, -1, -1, -1, -1, -1, -1},
+    {1506, 1390, 1404, -1, -1, -1, -1, -1, -1},
+    {1423, 1540, 1520, -1, -1, -1, -1, -1, -1},
+    {1520, 1404, 1423, -1, -1, -1, -1, -1, -1},
+    {1472, 1564, 1540, -1, -1, -1, -1, -1, -1},
+    {1540, 1423, 1472, -1, -1, -1, -1, -1, -1},
+    {1502, 1588, 1564, -1, -1, -1, -1, -1, -1},
+    {1564, 1472, 1502, -1, -1, -1, -1, -1, -1},
+    {1558, 1612, 1588, -1, -1, -1, -1, -1, -1},
+    {1588, 1502, 1558, -1, -1, -1, -1, -1, -1},
+    {1599, 1636, 1612, -1, -1, -1, -1, -1, -1},
+    {1612, 1558, 1599, -1, -1, -1, -1, -1, -1},
+    {1642, 1656, 1636, -1, -1, -1, -1, -1, -1},
+    {1636, 1599, 1642, -1, -1, -1, -1, -1, -1},
+    {1676, 1682, 1656, -1, -1, -1, -1, -1, -1},
+    {1656, 1642, 1676, -1, -1, -1, -1, -1, -1},
+    {1862, 1891, 1682, -1, -1, -1, -1, -1, -1},
+    {1682, 1676, 1862, -1, -1, -1, -1, -1, -1},
+    {1290, 1390, 1386, -1, -1, -1, -1, -1, -1},
+    {1386, 1286, 1290, -1, -1, -1, -1, -1, -1},
+    {1300, 1404, 1390, -1, -1, -1, -1, -1, -1},
+    {1390, 1290, 1300, -1, -1, -1, -1, -1, -1},
+    {1316, 1423, 1404, -1, -1, -1, -1, -1, -1},
+    {1404, 1300, 1316, -1, -1, -1, -1, -1, -1},
+    {1347, 1472, 1423, -1, -1, -1, -1, -1, -1},
+    {1423, 1316, 1347, -1, -1, -1, -1, -1, -1},
+    {1388, 1502, 1472, -1, -1, -1, -1, -1, -1},
+    {1472, 1347, 1388, -1, -1, -1, -1, -1, -1},
+    {1452, 1558, 1502, -1, -1, -1, -1, -1, -1},
+    {1502, 1388, 1452, -1, -1, -1, -1, -1, -1},
+    {1529, 1599, 1558, -1, -1, -1, -1, -1, -1},
+    {1558, 1452, 1529, -1, -1, -1, -1, -1, -1},
+    {1606, 1642, 1599, -1, -1, -1, -1, -1, -1},
+    {1599, 1529, 1606, -1, -1, -1, -1, -1, -1},
+    {1654, 1676, 1642, -1, -1, -1, -1, -1, -1},
+    {1642, 1606, 1654, -1, -1, -1, -1, -1, -1},
+    {1860, 1862, 1676, -1, -1, -1, -1, -1, -1},
+    {1676, 1654, 1860, -1, -1, -1, -1, -1, -1},
+    {1213, 1290, 1286, -1, -1, -1, -1, -1, -1},
+    {1286, 1209, 1213, -1, -1, -1, -1, -1, -1},
+    {1222, 1300, 1290, -1, -1, -1, -1, -1, -1},
+    {1290, 1213, 1222, -1, -1, -1, -1, -1, -1},
+    {1246, 1316, 1300, -1, -1, -1, -1, -1, -1},
+    {1300, 1222, 1246, -1, -1, -1, -1, -1, -1},
+    {1273, 1347, 1316, -1, -1, -1, -1, -1, -1},
+    {1316, 1246, 1273, -1, -1, -1, -1, -1, -1},
+    {1298, 1388, 1347, -1, -1, -1, -1, -1, -1},
+    {1347, 1273, 1298, -1, -1, -1, -1, -1, -1},
+    {1351, 1452, 1388, -1, -1, -1, -1, -1, -1},
+    {1388, 1298, 1351, -1, -1, -1, -1, -1, -1},
+    {1437, 1529, 1452, -1, -1, -1, -1, -1, -1},
+    {1452, 1351, 1437, -1, -1, -1, -1, -1, -1},
+    {1550, 1606, 1529, -1, -1, -1, -1, -1, -1},
+    {1529, 1437, 1550, -1, -1, -1, -1, -1, -1},
+    {1646, 1654, 1606, -1, -1, -1, -1, -1, -1},
+    {1606, 1550, 1646, -1, -1, -1, -1, -1, -1},
+    {1890, 1860, 1654, -1, -1, -1, -1, -1, -1},
+    {1654, 1646, 1890, -1, -1, -1, -1, -1, -1},
+    {1134, 1213, 1209, -1, -1, -1, -1, -1, -1},
+    {1209, 1124, 1134, -1, -1, -1, -1, -1, -1},
+    {1152, 1222, 1213, -1, -1, -1, -1, -1, -1},
+    {1213, 1134, 1152, -1, -1, -1, -1, -1, -1},
+    {1178, 1246, 1222, -1, -1, -1, -1, -1, -1},
+    {1222, 1152, 1178, -1, -1, -1, -1, -1, -1},
+    {1204, 1273, 1246, -1, -1, -1, -1, -1, -1},
+    {1246, 1178, 1204, -1, -1, -1, -1, -1, -1},
+    {1238, 1298, 1273, -1, -1, -1, -1, -1, -1},
+    {1273, 1204, 1238, -1, -1, -1, -1, -1, -1},
+    {1284, 1351, 1298, -1, -1, -1, -1, -1, -1},
+    {1298, 1238, 1284, -1, -1, -1, -1, -1, -1},
+    {1353, 1437, 1351, -1, -1, -1, -1, -1, -1},
+    {1351, 1284, 1353, -1, -1, -1, -1, -1, -1},
+    {1484, 1550, 1437, -1, -1, -1, -1, -1, -1},
+    {1437, 1353, 1484, -1, -1, -1, -1, -1, -1},
+    {1624, 1646, 1550, -1, -1, -1, -1, -1, -1},
+    {1550, 1484, 1624, -1, -1, -1, -1, -1, -1},
+    {1900, 1890, 1646, -1, -1, -1, -1, -1, -1},
+    {1646, 1624, 1900, -1, -1, -1, -1, -1, -1},
+    {1063, 1134, 1124, -1, -1, -1, -1, -1, -1},
+    {1124, 1053, 1063, -1, -1, -1, -1, -1, -1},
+    {1073, 1152, 1134, -1, -1, -1, -1, -1, -1},
+    {1134, 1063, 1073, -1, -1, -1, -1, -1, -1},
+    {1091, 1178, 1152, -1, -1, -1, -1, -1, -1},
+    {1152, 1073, 1091, -1, -1, -1, -1, -1, -1},
+    {1130, 1204, 1178, -1, -1, -1, -1, -1, -1},
+    {1178, 1091, 1130, -1, -1, -1, -1, -1, -1},
+    {1186, 1238, 1204, -1, -1, -1, -1, -1, -1},
+    {1204, 1130, 1186, -1, -1, -1, -1, -1, -1},
+    {1228, 1284, 1238, -1, -1, -1, -1, -1, -1},
+    {1238, 1186, 1228, -1, -1, -1, -1, -1, -1},
+    {1296, 1353, 1284, -1, -1, -1, -1, -1, -1},
+    {1284, 1228, 1296, -1, -1, -1, -1, -1, -1},
+    {1410, 1484, 1353, -1, -1, -1, -1, -1, -1},
+    {1353, 1296, 1410, -1, -1, -1, -1, -1, -1},
+    {1596, 1624, 1484, -1, -1, -1, -1, -1, -1},
+    {1484, 1410, 1596, -1, -1, -1, -1, -1, -1},
+    {1852, 1900, 1624, -1, -1, -1, -1, -1, -1},
+    {1624, 1596, 1852, -1, -1, -1, -1, -1, -1},
+    {969, 1063, 1053, -1, -1, -1, -1, -1, -1},
+    {1053, 967, 969, -1, -1, -1, -1, -1, -1},
+    {991, 1073, 1063, -1, -1, -1, -1, -1, -1},
+    {1063, 969, 991, -1, -1, -1, -1, -1, -1},
+    {1029, 1091, 1073, -1, -1, -1, -1, -1, -1},
+    {1073, 991, 1029, -1, -1, -1, -1, -1, -1},
+    {1071, 1130, 1091, -1, -1, -1, -1, -1, -1},
+    {1091, 1029, 1071, -1, -1, -1, -1, -1, -1},
+    {1112, 1186, 1130, -1, -1, -1, -1, -1, -1},
+    {1130, 1071, 1112, -1, -1, -1, -1, -1, -1},
+    {1190, 1228, 1186, -1, -1, -1, -1, -1, -1},
+    {1186, 1112, 1190, -1, -1, -1, -1, -1, -1},
+    {1256, 1296, 1228, -1, -1, -1, -1, -1, -1},
+    {1228, 1190, 1256, -1, -1, -1, -1, -1, -1},
+    {1359, 1410, 1296, -1, -1, -1, -1, -1, -1},
+    {1296, 1256, 1359, -1, -1, -1, -1, -1, -1},
+    {1570, 1596, 1410, -1, -1, -1, -1, -1, -1},
+    {1410, 1359, 1570, -1, -1, -1, -1, -1, -1},
+    {1898, 1852, 1596, -1, -1, -1, -1, -1, -1},
+    {1596, 1570, 1898, -1, -1, -1, -1, -1, -1},
+    {902, 969, 967, -1, -1, -1, -1, -1, -1},
+    {967, 896, 902, -1, -1, -1, -1, -1, -1},
+    {925, 991, 969, -1, -1, -1, -1, -1, -1},
+    {969, 902, 925, -1, -1, -1, -1, -1, -1},
+    {960, 1029, 991, -1, -1, -1, -1, -1, -1},
+    {991, 925, 960, -1, -1, -1, -1, -1, -1},
+    {1015, 1071, 1029, -1, -1, -1, -1, -1, -1},
+    {1029, 960, 1015, -1, -1, -1, -1, -1, -1},
+    {1075, 1112, 1071, -1, -1, -1, -1, -1, -1},
+    {1071, 1015, 1075, -1, -1, -1, -1, -1, -1},
+    {1138, 1190, 1112, -1, -1, -1, -1, -1, -1},
+    {1112, 1075, 1138, -1, -1, -1, -1, -1, -1},
+    {1217, 1256, 1190, -1, -1, -1, -1, -1, -1},
+    {1190, 1138, 1217, -1, -1, -1, -1, -1, -1},
+    {1314, 1359, 1256, -1, -1, -1, -1, -1, -1},
+    {1256, 1217, 1314, -1, -1, -1, -1, -1, -1},
+    {1532, 1570, 1359, -1, -1, -1, -1, -1, -1},
+    {1359, 1314, 1532, -1, -1, -1, -1, -1, -1},
+    {1919, 1898, 1570, -1, -1, -1, -1, -1, -1},
+    {1570, 1532, 1919, -1, -1, -1, -1, -1, -1},
+    {835, 902, 896, -1, -1, -1, -1, -1, -1},
+    {896, 827, 835, -1, -1, -1, -1, -1, -1},
+    {863, 925, 902, -1, -1, -1, -1, -1, -1},
+    {902, 835, 863, -1, -1, -1, -1, -1, -1},
+    {909, 960, 925, -1, -1, -1, -1, -1, -1},
+    {925, 863, 909, -1, -1, -1, -1, -1, -1},
+    {965, 1015, 960, -1, -1, -1, -1, -1, -1},
+    {960, 909, 965, -1, -1, -1, -1, -1, -1},
+    {1033, 1075, 1015, -1, -1, -1, -1, -1, -1},
+    {1015, 965, 1033, -1, -1, -1, -1, -1, -1},
+    {1097, 1138, 1075, -1, -1, -1, -1, -1, -1},
+    {1075, 1033, 1097, -1, -1, -1, -1, -1, -1},
+    {1200, 1217, 1138, -1, -1, -1, -1, -1, -1},
+    {1138, 1097, 1200, -1, -1, -1, -1, -1, -1},
+    {1292, 1314, 1217, -1, -1, -1, -1, -1, -1},
+    {1217, 1200, 1292, -1, -1, -1, -1, -1, -1},
+    {1504, 1532, 1314, -1, -1, -1, -1, -1, -1},
+    {1314, 1292, 1504, -1, -1, -1, -1, -1, -1},
+    {1923, 1919, 1532, -1, -1, -1, -1, -1, -1},
+    {1532, 1504, 1923, -1, -1, -1, -1, -1, -1},
+    {788, 835, 827, -1, -1, -1, -1, -1, -1},
+    {827, 778, 788, -1, -1, -1, -1, -1, -1},
+    {824, 863, 835, -1, -1, -1, -1, -1, -1},
+    {835, 788, 824, -1, -1, -1, -1, -1, -1},
+    {872, 909, 863, -1, -1, -1, -1, -1, -1},
+    {863, 824, 872, -1, -1, -1, -1, -1, -1},
+    {932, 965, 909, -1, -1, -1, -1, -1, -1},
+    {909, 872, 932, -1, -1, -1, -1, -1, -1},
+    {998, 1033, 965, -1, -1, -1, -1, -1, -1},
+    {965, 932, 998, -1, -1, -1, -1, -1, -1},
+    {1086, 1097, 1033, -1, -1, -1, -1, -1, -1},
+    {1033, 998, 1086, -1, -1, -1, -1, -1, -1},
+    {1181, 1200, 1097, -1, -1, -1, -1, -1, -1},
+    {1097, 1086, 1181, -1, -1, -1, -1, -1, -1},
+    {1282, 1292, 1200, -1, -1, -1, -1, -1, -1},
+    {1200, 1181, 1282, -1, -1, -1, -1, -1, -1},
+    {1494, 1504, 1292, -1, -1, -1, -1, -1, -1},
+    {1292, 1282, 1494, -1, -1, -1, -1, -1, -1},
+    {1825, 1923, 1504, -1, -1, -1, -1, -1, -1},
+    {1504, 1494, 1825, -1, -1, -1, -1, -1, -1},
+    {775, 788, 778, -1, -1, -1, -1, -1, -1},
+    {778, 765, 775, -1, -1, -1, -1, -1, -1},
+    {801, 824, 788, -1, -1, -1, -1, -1, -1},
+    {788, 775, 801, -1, -1, -1, -1, -1, -1},
+    {857, 872, 824, -1, -1, -1, -1, -1, -1},
+    {824, 801, 857, -1, -1, -1, -1, -1, -1},
+    {919, 932, 872, -1, -1, -1, -1, -1, -1},
+    {872, 857, 919, -1, -1, -1, -1, -1, -1},
+    {985, 998, 932, -1, -1, -1, -1, -1, -1},
+    {932, 919, 985, -1, -1, -1, -1, -1, -1},
+    {1079, 1086, 998, -1, -1, -1, -1, -1, -1},
+    {998, 985, 1079, -1, -1, -1, -1, -1, -1},
+    {1176, 1181, 1086, -1, -1, -1, -1, -1, -1},
+    {1086, 1079, 1176, -1, -1, -1, -1, -1, -1},
+    {1278, 1282, 1181, -1, -1, -1, -1, -1, -1},
+    {1181, 1176, 1278, -1, -1, -1, -1, -1, -1},
+    {1486, 1494, 1282, -1, -1, -1, -1, -1, -1},
+    {1282, 1278, 1486, -1, -1, -1, -1, -1, -1},
+    {1913, 1825, 1494, -1, -1, -1, -1, -1, -1},
+    {1494, 1486, 1913, -1, -1, -1, -1, -1, -1},
+    {1946, 1940, 1866, -1, -1, -1, -1, -1, -1},
+    {1866, 1862, 1946, -1, -1, -1, -1, -1, -1},
+    {1980, 1966, 1940, -1, -1, -1, -1, -1, -1},
+    {1940, 1946, 1980, -1, -1, -1, -1, -1, -1},
+    {2021, 1986, 1966, -1, -1, -1, -1, -1, -1},
+    {1966, 1980, 2021, -1, -1, -1, -1, -1, -1},
+    {2064, 2010, 1986, -1, -1, -1, -1, -1, -1},
+    {1986, 2021, 2064, -1, -1, -1, -1, -1, -1},
+    {2120, 2034, 2010, -1, -1, -1, -1, -1, -1},
+    {2010, 2064, 2120, -1, -1, -1, -1, -1, -1},
+    {2150, 2058, 2034, -1, -1, -1, -1, -1, -1},
+    {2034, 2120, 2150, -1, -1, -1, -1, -1, -1},
+    {2197, 2082, 2058, -1, -1, -1, -1, -1, -1},
+    {2058, 2150, 2197, -1, -1, -1, -1, -1, -1},
+    {2218, 2102, 2082, -1, -1, -1, -1, -1, -1},
+    {2082, 2197, 2218, -1, -1, -1, -1, -1, -1},
+    {2232, 2116, 2102, -1, -1, -1, -1, -1, -1},
+    {2102, 2218, 2232, -1, -1, -1, -1, -1, -1},
+    {2235, 2124, 2116, -1, -1, -1, -1, -1, -1},
+    {2116, 2232, 2235, -1, -1, -1, -1, -1, -1},
+    {1968, 1946, 1862, -1, -1, -1, -1, -1, -1},
+    {1862, 1859, 1968, -1, -1, -1, -1, -1, -1},
+    {2016, 1980, 1946, -1, -1, -1, -1, -1, -1},
+    {1946, 1968, 2016, -1, -1, -1, -1, -1, -1},
+    {2091, 2021, 1980, -1, -1, -1, -1, -1, -1},
+    {1980, 2016, 2091, -1, -1, -1, -1, -1, -1},
+    {2170, 2064, 2021, -1, -1, -1, -1, -1, -1},
+    {2021, 2091, 2170, -1, -1, -1, -1, -1, -1},
+    {2234, 2120, 2064, -1, -1, -1, -1, -1, -1},
+    {2064, 2170, 2234, -1, -1, -1, -1, -1, -1},
+    {2275, 2150, 2120, -1, -1, -1, -1, -1, -1},
+    {2120, 2234, 2275, -1, -1, -1, -1, -1, -1},
+    {2306, 2197, 2150, -1, -1, -1, -1, -1, -1},
+    {2150, 2275, 2306, -1, -1, -1, -1, -1, -1},
+    {2322, 2218, 2197, -1, -1, -1, -1, -1, -1},
+    {2197, 2306, 2322, -1, -1, -1, -1, -1, -1},
+    {2332, 2232, 2218, -1, -1, -1, -1, -1, -1},
+    {2218, 2322, 2332, -1, -1, -1, -1, -1, -1},
+    {2336, 2235, 2232, -1, -1, -1, -1, -1, -1},
+    {2232, 2332, 2336, -1, -1, -1, -1, -1, -1},
+    {1976, 1968, 1859, -1, -1, -1, -1, -1, -1},
+    {1859, 1856, 1976, -1, -1, -1, -1, -1, -1},
+    {2072, 2016, 1968, -1, -1, -1, -1, -1, -1},
+    {1968, 1976, 2072, -1, -1, -1, -1, -1, -1},
+    {2183, 2091, 2016, -1, -1, -1, -1, -1, -1},
+    {2016, 2072, 2183, -1, -1, -1, -1, -1, -1},
+    {2271, 2170, 2091, -1, -1, -1, -1, -1, -1},
+    {2091, 2183, 2271, -1, -1, -1, -1, -1, -1},
+    {2324, 2234, 2170, -1, -1, -1, -1, -1, -1},
+    {2170, 2271, 2324, -1, -1, -1, -1, -1, -1},
+    {2347, 2275, 2234, -1, -1, -1, -1, -1, -1},
+    {2234, 2324, 2347, -1, -1, -1, -1, -1, -1},
+    {2376, 2306, 2275, -1, -1, -1, -1, -1, -1},
+    {2275, 2347, 2376, -1, -1, -1, -1, -1, -1},
+    {2400, 2322, 2306, -1, -1, -1, -1, -1, -1},
+    {2306, 2376, 2400, -1, -1, -1, -1, -1, -1},
+    {2407, 2332, 2322, -1, -1, -1, -1, -1, -1},
+    {2322, 2400, 2407, -1, -1, -1, -1, -1, -1},
+    {2411, 2336, 2332, -1, -1, -1, -1, -1, -1},
+    {2332, 2407, 2411, -1, -1, -1, -1, -1, -1},
+    {1998, 1976, 1856, -1, -1, -1, -1, -1, -1},
+    {1856, 1854, 1998, -1, -1, -1, -1, -1, -1},
+    {2138, 2072, 1976, -1, -1, -1, -1, -1, -1},
+    {1976, 1998, 2138, -1, -1, -1, -1, -1, -1},
+    {2269, 2183, 2072, -1, -1, -1, -1, -1, -1},
+    {2072, 2138, 2269, -1, -1, -1, -1, -1, -1},
+    {2338, 2271, 2183, -1, -1, -1, -1, -1, -1},
+    {2183, 2269, 2338, -1, -1, -1, -1, -1, -1},
+    {2384, 2324, 2271, -1, -1, -1, -1, -1, -1},
+    {2271, 2338, 2384, -1, -1, -1, -1, -1, -1},
+    {2418, 2347, 2324, -1, -1, -1, -1, -1, -1},
+    {2324, 2384, 2418, -1, -1, -1, -1, -1, -1},
+    {2444, 2376, 2347, -1, -1, -1, -1, -1, -1},
+    {2347, 2418, 2444, -1, -1, -1, -1, -1, -1},
+    {2470, 2400, 2376, -1, -1, -1, -1, -1, -1},
+    {2376, 2444, 2470, -1, -1, -1, -1, -1, -1},
+    {2488, 2407, 2400, -1, -1, -1, -1, -1, -1},
+    {2400, 2470, 2488, -1, -1, -1, -1, -1, -1},
+    {2498, 2411, 2407, -1, -1, -1, -1, -1, -1},
+    {2407, 2488, 2498, -1, -1, -1, -1, -1, -1},
+    {2026, 1998, 1854, -1, -1, -1, -1, -1, -1},
+    {1854, 1851, 2026, -1, -1, -1, -1, -1, -1},
+    {2212, 2138, 1998, -1, -1, -1, -1, -1, -1},
+    {1998, 2026, 2212, -1, -1, -1, -1, -1, -1},
+    {2326, 2269, 2138, -1, -1, -1, -1, -1, -1},
+    {2138, 2212, 2326, -1, -1, -1, -1, -1, -1},
+    {2394, 2338, 2269, -1, -1, -1, -1, -1, -1},
+    {2269, 2326, 2394, -1, -1, -1, -1, -1, -1},
+    {2436, 2384, 2338, -1, -1, -1, -1, -1, -1},
+    {2338, 2394, 2436, -1, -1, -1, -1, -1, -1},
+    {2492, 2418, 2384, -1, -1, -1, -1, -1, -1},
+    {2384, 2436, 2492, -1, -1, -1, -1, -1, -1},
+    {2531, 2444, 2418, -1, -1, -1, -1, -1, -1},
+    {2418, 2492, 2531, -1, -1, -1, -1, -1, -1},
+    {2549, 2470, 2444, -1, -1, -1, -1, -1, -1},
+    {2444, 2531, 2549, -1, -1, -1, -1, -1, -1},
+    {2559, 2488, 2470, -1, -1, -1, -1, -1, -1},
+    {2470, 2549, 2559, -1, -1, -1, -1, -1, -1},
+    {2569, 2498, 2488, -1, -1, -1, -1, -1, -1},
+    {2488, 2559, 2569, -1, -1, -1, -1, -1, -1},
+    {2052, 2026, 1851, -1, -1, -1, -1, -1, -1},
+    {1851, 1848, 2052, -1, -1, -1, -1, -1, -1},
+    {2263, 2212, 2026, -1, -1, -1, -1, -1, -1},
+    {2026, 2052, 2263, -1, -1, -1, -1, -1, -1},
+    {2366, 2326, 2212, -1, -1, -1, -1, -1, -1},
+    {2212, 2263, 2366, -1, -1, -1, -1, -1, -1},
+    {2432, 2394, 2326, -1, -1, -1, -1, -1, -1},
+    {2326, 2366, 2432, -1, -1, -1, -1, -1, -1},
+    {2510, 2436, 2394, -1, -1, -1, -1, -1, -1},
+    {2394, 2432, 2510, -1, -1, -1, -1, -1, -1},
+    {2551, 2492, 2436, -1, -1, -1, -1, -1, -1},
+    {2436, 2510, 2551, -1, -1, -1, -1, -1, -1},
+    {2593, 2531, 2492, -1, -1, -1, -1, -1, -1},
+    {2492, 2551, 2593, -1, -1, -1, -1, -1, -1},
+    {2631, 2549, 2531, -1, -1, -1, -1, -1, -1},
+    {2531, 2593, 2631, -1, -1, -1, -1, -1, -1},
+    {2653, 2559, 2549, -1, -1, -1, -1, -1, -1},
+    {2549, 2631, 2653, -1, -1, -1, -1, -1, -1},
+    {2655, 2569, 2559, -1, -1, -1, -1, -1, -1},
+    {2559, 2653, 2655, -1, -1, -1, -1, -1, -1},
+    {2090, 2052, 1848, -1, -1, -1, -1, -1, -1},
+    {1848, 1846, 2090, -1, -1, -1, -1, -1, -1},
+    {2308, 2263, 2052, -1, -1, -1, -1, -1, -1},
+    {2052, 2090, 2308, -1, -1, -1, -1, -1, -1},
+    {2403, 2366, 2263, -1, -1, -1, -1, -1, -1},
+    {2263, 2308, 2403, -1, -1, -1, -1, -1, -1},
+    {2484, 2432, 2366, -1, -1, -1, -1, -1, -1},
+    {2366, 2403, 2484, -1, -1, -1, -1, -1, -1},
+    {2547, 2510, 2432, -1, -1, -1, -1, -1, -1},
+    {2432, 2484, 2547, -1, -1, -1, -1, -1, -1},
+    {2607, 2551, 2510, -1, -1, -1, -1, -1, -1},
+    {2510, 2547, 2607, -1, -1, -1, -1, -1, -1},
+    {2660, 2593, 2551, -1, -1, -1, -1, -1, -1},
+    {2551, 2607, 2660, -1, -1, -1, -1, -1, -1},
+    {2697, 2631, 2593, -1, -1, -1, -1, -1, -1},
+    {2593, 2660, 2697, -1, -1, -1, -1, -1, -1},
+    {2718, 2653, 2631, -1, -1, -1, -1, -1, -1},
+    {2631, 2697, 2718, -1, -1, -1, -1, -1, -1},
+    {2724, 2655, 2653, -1, -1, -1, -1, -1, -1},
+    {2653, 2718, 2724, -1, -1, -1, -1, -1, -1},
+    {2118, 2090, 1846, -1, -1, -1, -1, -1, -1},
+    {1846, 1832, 2118, -1, -1, -1, -1, -1, -1},
+    {2330, 2308, 2090, -1, -1, -1, -1, -1, -1},
+    {2090, 2118, 2330, -1, -1, -1, -1, -1, -1},
+    {2422, 2403, 2308, -1, -1, -1, -1, -1, -1},
+    {2308, 2330, 2422, -1, -1, -1, -1, -1, -1},
+    {2525, 2484, 2403, -1, -1, -1, -1, -1, -1},
+    {2403, 2422, 2525, -1, -1, -1, -1, -1, -1},
+    {2589, 2547, 2484, -1, -1, -1, -1, -1, -1},
+    {2484, 2525, 2589, -1, -1, -1, -1, -1, -1},
+    {2657, 2607, 2547, -1, -1, -1, -1, -1, -1},
+    {2547, 2589, 2657, -1, -1, -1, -1, -1, -1},
+    {2713, 2660, 2607, -1, -1, -1, -1, -1, -1},
+    {2607, 2657, 2713, -1, -1, -1, -1, -1, -1},
+    {2759, 2697, 2660, -1, -1, -1, -1, -1, -1},
+    {2660, 2713, 2759, -1, -1, -1, -1, -1, -1},
+    {2787, 2718, 2697, -1, -1, -1, -1, -1, -1},
+    {2697, 2759, 2787, -1, -1, -1, -1, -1, -1},
+    {2795, 2724, 2718, -1, -1, -1, -1, -1, -1},
+    {2718, 2787, 2795, -1, -1, -1, -1, -1, -1},
+    {2128, 2118, 1832, -1, -1, -1, -1, -1, -1},
+    {1832, 1826, 2128, -1, -1, -1, -1, -1, -1},
+    {2340, 2330, 2118, -1, -1, -1, -1, -1, -1},
+    {2118, 2128, 2340, -1, -1, -1, -1, -1, -1},
+    {2439, 2422, 2330, -1, -1, -1, -1, -1, -1},
+    {2330, 2340, 2439, -1, -1, -1, -1, -1, -1},
+    {2534, 2525, 2422, -1, -1, -1, -1, -1, -1},
+    {2422, 2439, 2534, -1, -1, -1, -1, -1, -1},
+    {2622, 2589, 2525, -1, -1, -1, -1, -1, -1},
+    {2525, 2534, 2622, -1, -1, -1, -1, -1, -1},
+    {2688, 2657, 2589, -1, -1, -1, -1, -1, -1},
+    {2589, 2622, 2688, -1, -1, -1, -1, -1, -1},
+    {2748, 2713, 2657, -1, -1, -1, -1, -1, -1},
+    {2657, 2688, 2748, -1, -1, -1, -1, -1, -1},
+    {2796, 2759, 2713, -1, -1, -1, -1, -1, -1},
+    {2713, 2748, 2796, -1, -1, -1, -1, -1, -1},
+    {2832, 2787, 2759, -1, -1, -1, -1, -1, -1},
+    {2759, 2796, 2832, -1, -1, -1, -1, -1, -1},
+    {2842, 2795, 2787, -1, -1, -1, -1, -1, -1},
+    {2787, 2832, 2842, -1, -1, -1, -1, -1, -1},
+    {2136, 2128, 1826, -1, -1, -1, -1, -1, -1},
+    {1826, 1814, 2136, -1, -1, -1, -1, -1, -1},
+    {2344, 2340, 2128, -1, -1, -1, -1, -1, -1},
+    {2128, 2136, 2344, -1, -1, -1, -1, -1, -1},
+    {2446, 2439, 2340, -1, -1, -1, -1, -1, -1},
+    {2340, 2344, 2446, -1, -1, -1, -1, -1, -1},
+    {2543, 2534, 2439, -1, -1, -1, -1, -1, -1},
+    {2439, 2446, 2543, -1, -1, -1, -1, -1, -1},
+    {2637, 2622, 2534, -1, -1, -1, -1, -1, -1},
+    {2534, 2543, 2637, -1, -1, -1, -1, -1, -1},
+    {2703, 2688, 2622, -1, -1, -1, -1, -1, -1},
+    {2622, 2637, 2703, -1, -1, -1, -1, -1, -1},
+    {2765, 2748, 2688, -1, -1, -1, -1, -1, -1},
+    {2688, 2703, 2765, -1, -1, -1, -1, -1, -1},
+    {2821, 2796, 2748, -1, -1, -1, -1, -1, -1},
+    {2748, 2765, 2821, -1, -1, -1, -1, -1, -1},
+    {2847, 2832, 2796, -1, -1, -1, -1, -1, -1},
+    {2796, 2821, 2847, -1, -1, -1, -1, -1, -1},
+    {2857, 2842, 2832, -1, -1, -1, -1, -1, -1},
+    {2832, 2847, 2857, -1, -1, -1, -1, -1, -1},
+    {1734, 2333, 2328, -1, -1, -1, -1, -1, -1},
+    {1734, 2328, 2320, -1, -1, -1, -1, -1, -1},
+    {1734, 2320, 2304, -1, -1, -1, -1, -1, -1},
+    {1734, 2304, 2273, -1, -1, -1, -1, -1, -1},
+    {1734, 2273, 2230, -1, -1, -1, -1, -1, -1},
+    {1734, 2230, 2166, -1, -1, -1, -1, -1, -1},
+    {1734, 2166, 2088, -1, -1, -1, -1, -1, -1},
+    {1734, 2088, 2013, -1, -1, -1, -1, -1, -1},
+    {1734, 2013, 1961, -1, -1, -1, -1, -1, -1},
+    {1734, 1961, 1732, -1, -1, -1, -1, -1, -1},
+    {2514, 2328, 2333, -1, -1, -1, -1, -1, -1},
+    {2333, 2523, 2514, -1, -1, -1, -1, -1, -1},
+    {2494, 2320, 2328, -1, -1, -1, -1, -1, -1},
+    {2328, 2514, 2494, -1, -1, -1, -1, -1, -1},
+    {2455, 2304, 2320, -1, -1, -1, -1, -1, -1},
+    {2320, 2494, 2455, -1, -1, -1, -1, -1, -1},
+    {2428, 2273, 2304, -1, -1, -1, -1, -1, -1},
+    {2304, 2455, 2428, -1, -1, -1, -1, -1, -1},
+    {2398, 2230, 2273, -1, -1, -1, -1, -1, -1},
+    {2273, 2428, 2398, -1, -1, -1, -1, -1, -1},
+    {2346, 2166, 2230, -1, -1, -1, -1, -1, -1},
+    {2230, 2398, 2346, -1, -1, -1, -1, -1, -1},
+    {2291, 2088, 2166, -1, -1, -1, -1, -1, -1},
+    {2166, 2346, 2291, -1, -1, -1, -1, -1, -1},
+    {2147, 2013, 2088, -1, -1, -1, -1, -1, -1},
+    {2088, 2291, 2147, -1, -1, -1, -1, -1, -1},
+    {2003, 1961, 2013, -1, -1, -1, -1, -1, -1},
+    {2013, 2147, 2003, -1, -1, -1, -1, -1, -1},
+    {1738, 1732, 1961, -1, -1, -1, -1, -1, -1},
+    {1961, 2003, 1738, -1, -1, -1, -1, -1, -1},
+    {2646, 2514, 2523, -1, -1, -1, -1, -1, -1},
+    {2523, 2648, 2646, -1, -1, -1, -1, -1, -1},
+    {2620, 2494, 2514, -1, -1, -1, -1, -1, -1},
+    {2514, 2646, 2620, -1, -1, -1, -1, -1, -1},
+    {2583, 2455, 2494, -1, -1, -1, -1, -1, -1},
+    {2494, 2620, 2583, -1, -1, -1, -1, -1, -1},
+    {2540, 2428, 2455, -1, -1, -1, -1, -1, -1},
+    {2455, 2583, 2540, -1, -1, -1, -1, -1, -1},
+    {2501, 2398, 2428, -1, -1, -1, -1, -1, -1},
+    {2428, 2540, 2501, -1, -1, -1, -1, -1, -1},
+    {2425, 2346, 2398, -1, -1, -1, -1, -1, -1},
+    {2398, 2501, 2425, -1, -1, -1, -1, -1, -1},
+    {2351, 2291, 2346, -1, -1, -1, -1, -1, -1},
+    {2346, 2425, 2351, -1, -1, -1, -1, -1, -1},
+    {2254, 2147, 2291, -1, -1, -1, -1, -1, -1},
+    {2291, 2351, 2254, -1, -1, -1, -1, -1, -1},
+    {2045, 2003, 2147, -1, -1, -1, -1, -1, -1},
+    {2147, 2254, 2045, -1, -1, -1, -1, -1, -1},
+    {1701, 1738, 2003, -1, -1, -1, -1, -1, -1},
+    {2003, 2045, 1701, -1, -1, -1, -1, -1, -1},
+    {2745, 2646, 2648, -1, -1, -1, -1, -1, -1},
+    {2648, 2756, 2745, -1, -1, -1, -1, -1, -1},
+    {2720, 2620, 2646, -1, -1, -1, -1, -1, -1},
+    {2646, 2745, 2720, -1, -1, -1, -1, -1, -1},
+    {2680, 2583, 2620, -1, -1, -1, -1, -1, -1},
+    {2620, 2720, 2680, -1, -1, -1, -1, -1, -1},
+    {2638, 2540, 2583, -1, -1, -1, -1, -1, -1},
+    {2583, 2680, 2638, -1, -1, -1, -1, -1, -1},
+    {2556, 2501, 2540, -1, -1, -1, -1, -1, -1},
+    {2540, 2638, 2556, -1, -1, -1, -1, -1, -1},
+    {2504, 2425, 2501, -1, -1, -1, -1, -1, -1},
+    {2501, 2556, 2504, -1, -1, -1, -1, -1, -1},
+    {2414, 2351, 2425, -1, -1, -1, -1, -1, -1},
+    {2425, 2504, 2414, -1, -1, -1, -1, -1, -1},
+    {2317, 2254, 2351, -1, -1, -1, -1, -1, -1},
+    {2351, 2414, 2317, -1, -1, -1, -1, -1, -1},
+    {2097, 2045, 2254, -1, -1, -1, -1, -1, -1},
+    {2254, 2317, 2097, -1, -1, -1, -1, -1, -1},
+    {1744, 1701, 2045, -1, -1, -1, -1, -1, -1},
+    {2045, 2097, 1744, -1, -1, -1, -1, -1, -1},
+    {2839, 2745, 2756, -1, -1, -1, -1, -1, -1},
+    {2756, 2848, 2839, -1, -1, -1, -1, -1, -1},
+    {2807, 2720, 2745, -1, -1, -1, -1, -1, -1},
+    {2745, 2839, 2807, -1, -1, -1, -1, -1, -1},
+    {2755, 2680, 2720, -1, -1, -1, -1, -1, -1},
+    {2720, 2807, 2755, -1, -1, -1, -1, -1, -1},
+    {2695, 2638, 2680, -1, -1, -1, -1, -1, -1},
+    {2680, 2755, 2695, -1, -1, -1, -1, -1, -1},
+    {2625, 2556, 2638, -1, -1, -1, -1, -1, -1},
+    {2638, 2695, 2625, -1, -1, -1, -1, -1, -1},
+    {2537, 2504, 2556, -1, -1, -1, -1, -1, -1},
+    {2556, 2625, 2537, -1, -1, -1, -1, -1, -1},
+    {2442, 2414, 2504, -1, -1, -1, -1, -1, -1},
+    {2504, 2537, 2442, -1, -1, -1, -1, -1, -1},
+    {2341, 2317, 2414, -1, -1, -1, -1, -1, -1},
+    {2414, 2442, 2341, -1, -1, -1, -1, -1, -1},
+    {2130, 2097, 2317, -1, -1, -1, -1, -1, -1},
+    {2317, 2341, 2130, -1, -1, -1, -1, -1, -1},
+    {1903, 1744, 2097, -1, -1, -1, -1, -1, -1},
+    {2097, 2130, 1903, -1, -1, -1, -1, -1, -1},
+    {2905, 2839, 2848, -1, -1, -1, -1, -1, -1},
+    {2848, 2924, 2905, -1, -1, -1, -1, -1, -1},
+    {2866, 2807, 2839, -1, -1, -1, -1, -1, -1},
+    {2839, 2905, 2866, -1, -1, -1, -1, -1, -1},
+    {2817, 2755, 2807, -1, -1, -1, -1, -1, -1},
+    {2807, 2866, 2817, -1, -1, -1, -1, -1, -1},
+    {2735, 2695, 2755, -1, -1, -1, -1, -1, -1},
+    {2755, 2817, 2735, -1, -1, -1, -1, -1, -1},
+    {2666, 2625, 2695, -1, -1, -1, -1, -1, -1},
+    {2695, 2735, 2666, -1, -1, -1, -1, -1, -1},
+    {2564, 2537, 2625, -1, -1, -1, -1, -1, -1},
+    {2625, 2666, 2564, -1, -1, -1, -1, -1, -1},
+    {2474, 2442, 2537, -1, -1, -1, -1, -1, -1},
+    {2537, 2564, 2474, -1, -1, -1, -1, -1, -1},
+    {2355, 2341, 2442, -1, -1, -1, -1, -1, -1},
+    {2442, 2474, 2355, -1, -1, -1, -1, -1, -1},
+    {2155, 2130, 2341, -1, -1, -1, -1, -1, -1},
+    {2341, 2355, 2155, -1, -1, -1, -1, -1, -1},
+    {1703, 1903, 2130, -1, -1, -1, -1, -1, -1},
+    {2130, 2155, 1703, -1, -1, -1, -1, -1, -1},
+    {2975, 2905, 2924, -1, -1, -1, -1, -1, -1},
+    {2924, 2986, 2975, -1, -1, -1, -1, -1, -1},
+    {2913, 2866, 2905, -1, -1, -1, -1, -1, -1},
+    {2905, 2975, 2913, -1, -1, -1, -1, -1, -1},
+    {2851, 2817, 2866, -1, -1, -1, -1, -1, -1},
+    {2866, 2913, 2851, -1, -1, -1, -1, -1, -1},
+    {2771, 2735, 2817, -1, -1, -1, -1, -1, -1},
+    {2817, 2851, 2771, -1, -1, -1, -1, -1, -1},
+    {2687, 2666, 2735, -1, -1, -1, -1, -1, -1},
+    {2735, 2771, 2687, -1, -1, -1, -1, -1, -1},
+    {2591, 2564, 2666, -1, -1, -1, -1, -1, -1},
+    {2666, 2687, 2591, -1, -1, -1, -1, -1, -1},
+    {2496, 2474, 2564, -1, -1, -1, -1, -1, -1},
+    {2564, 2591, 2496, -1, -1, -1, -1, -1, -1},
+    {2371, 2355, 2474, -1, -1, -1, -1, -1, -1},
+    {2474, 2496, 2371, -1, -1, -1, -1, -1, -1},
+    {2175, 2155, 2355, -1, -1, -1, -1, -1, -1},
+    {2355, 2371, 2175, -1, -1, -1, -1, -1, -1},
+    {1751, 1703, 2155, -1, -1, -1, -1, -1, -1},
+    {2155, 2175, 1751, -1, -1, -1, -1, -1, -1},
+    {2992, 2975, 2986, -1, -1, -1, -1, -1, -1},
+    {2986, 3010, 2992, -1, -1, -1, -1, -1, -1},
+    {2951, 2913, 2975, -1, -1, -1, -1, -1, -1},
+    {2975, 2992, 2951, -1, -1, -1, -1, -1, -1},
+    {2873, 2851, 2913, -1, -1, -1, -1, -1, -1},
+    {2913, 2951, 2873, -1, -1, -1, -1, -1, -1},
+    {2793, 2771, 2851, -1, -1, -1, -1, -1, -1},
+    {2851, 2873, 2793, -1, -1, -1, -1, -1, -1},
+    {2701, 2687, 2771, -1, -1, -1, -1, -1, -1},
+    {2771, 2793, 2701, -1, -1, -1, -1, -1, -1},
+    {2603, 2591, 2687, -1, -1, -1, -1, -1, -1},
+    {2687, 2701, 2603, -1, -1, -1, -1, -1, -1},
+    {2508, 2496, 2591, -1, -1, -1, -1, -1, -1},
+    {2591, 2603, 2508, -1, -1, -1, -1, -1, -1},
+    {2379, 2371, 2496, -1, -1, -1, -1, -1, -1},
+    {2496, 2508, 2379, -1, -1, -1, -1, -1, -1},
+    {2181, 2175, 2371, -1, -1, -1, -1, -1, -1},
+    {2371, 2379, 2181, -1, -1, -1, -1, -1, -1},
+    {1722, 1751, 2175, -1, -1, -1, -1, -1, -1},
+    {2175, 2181, 1722, -1, -1, -1, -1, -1, -1},
+    {2999, 2992, 3010, -1, -1, -1, -1, -1, -1},
+    {3010, 3019, 2999, -1, -1, -1, -1, -1, -1},
+    {2966, 2951, 2992, -1, -1, -1, -1, -1, -1},
+    {2992, 2999, 2966, -1, -1, -1, -1, -1, -1},
+    {2878, 2873, 2951, -1, -1, -1, -1, -1, -1},
+    {2951, 2966, 2878, -1, -1, -1, -1, -1, -1},
+    {2798, 2793, 2873, -1, -1, -1, -1, -1, -1},
+    {2873, 2878, 2798, -1, -1, -1, -1, -1, -1},
+    {2706, 2701, 2793, -1, -1, -1, -1, -1, -1},
+    {2793, 2798, 2706, -1, -1, -1, -1, -1, -1},
+    {2604, 2603, 2701, -1, -1, -1, -1, -1, -1},
+    {2701, 2706, 2604, -1, -1, -1, -1, -1, -1},
+    {2511, 2508, 2603, -1, -1, -1, -1, -1, -1},
+    {2603, 2604, 2511, -1, -1, -1, -1, -1, -1},
+    {2381, 2379, 2508, -1, -1, -1, -1, -1, -1},
+    {2508, 2511, 2381, -1, -1, -1, -1, -1, -1},
+    {2187, 2181, 2379, -1, -1, -1, -1, -1, -1},
+    {2379, 2381, 2187, -1, -1, -1, -1, -1, -1},
+    {1698, 1722, 2181, -1, -1, -1, -1, -1, -1},
+    {2181, 2187, 1698, -1, -1, -1, -1, -1, -1},
+    {3005, 2999, 3019, -1, -1, -1, -1, -1, -1},
+    {3019, 3021, 3005, -1, -1, -1, -1, -1, -1},
+    {2971, 2966, 2999, -1, -1, -1, -1, -1, -1},
+    {2999, 3005, 2971, -1, -1, -1, -1, -1, -1},
+    {2887, 2878, 2966, -1, -1, -1, -1, -1, -1},
+    {2966, 2971, 2887, -1, -1, -1, -1, -1, -1},
+    {2803, 2798, 2878, -1, -1, -1, -1, -1, -1},
+    {2878, 2887, 2803, -1, -1, -1, -1, -1, -1},
+    {2709, 2706, 2798, -1, -1, -1, -1, -1, -1},
+    {2798, 2803, 2709, -1, -1, -1, -1, -1, -1},
+    {2612, 2604, 2706, -1, -1, -1, -1, -1, -1},
+    {2706, 2709, 2612, -1, -1, -1, -1, -1, -1},
+    {2519, 2511, 2604, -1, -1, -1, -1, -1, -1},
+    {2604, 2612, 2519, -1, -1, -1, -1, -1, -1},
+    {2387, 2381, 2511, -1, -1, -1, -1, -1, -1},
+    {2511, 2519, 2387, -1, -1, -1, -1, -1, -1},
+    {2191, 2187, 2381, -1, -1, -1, -1, -1, -1},
+    {2381, 2387, 2191, -1, -1, -1, -1, -1, -1},
+    {1759, 1698, 2187, -1, -1, -1, -1, -1, -1},
+    {2187, 2191, 1759, -1, -1, -1, -1, -1, -1},
+    {1734, 1736, 1659, -1, -1, -1, -1, -1, -1},
+    {1734, 1659, 1607, -1, -1, -1, -1, -1, -1},
+    {1734, 1607, 1534, -1, -1, -1, -1, -1, -1},
+    {1734, 1534, 1456, -1, -1, -1, -1, -1, -1},
+    {1734, 1456, 1392, -1, -1, -1, -1, -1, -1},
+    {1734, 1392, 1349, -1, -1, -1, -1, -1, -1},
+    {1734, 1349, 1318, -1, -1, -1, -1, -1, -1},
+    {1734, 1318, 1302, -1, -1, -1, -1, -1, -1},
+    {1734, 1302, 1294, -1, -1, -1, -1, -1, -1},
+    {1734, 1294, 1287, -1, -1, -1, -1, -1, -1},
+    {1617, 1659, 1736, -1, -1, -1, -1, -1, -1},
+    {1736, 1738, 1617, -1, -1, -1, -1, -1, -1},
+    {1473, 1607, 1659, -1, -1, -1, -1, -1, -1},
+    {1659, 1617, 1473, -1, -1, -1, -1, -1, -1},
+    {1331, 1534, 1607, -1, -1, -1, -1, -1, -1},
+    {1607, 1473, 1331, -1, -1, -1, -1, -1, -1},
+    {1276, 1456, 1534, -1, -1, -1, -1, -1, -1},
+    {1534, 1331, 1276, -1, -1, -1, -1, -1, -1},
+    {1224, 1392, 1456, -1, -1, -1, -1, -1, -1},
+    {1456, 1276, 1224, -1, -1, -1, -1, -1, -1},
+    {1194, 1349, 1392, -1, -1, -1, -1, -1, -1},
+    {1392, 1224, 1194, -1, -1, -1, -1, -1, -1},
+    {1165, 1318, 1349, -1, -1, -1, -1, -1, -1},
+    {1349, 1194, 1165, -1, -1, -1, -1, -1, -1},
+    {1128, 1302, 1318, -1, -1, -1, -1, -1, -1},
+    {1318, 1165, 1128, -1, -1, -1, -1, -1, -1},
+    {1108, 1294, 1302, -1, -1, -1, -1, -1, -1},
+    {1302, 1128, 1108, -1, -1, -1, -1, -1, -1},
+    {1098, 1287, 1294, -1, -1, -1, -1, -1, -1},
+    {1294, 1108, 1098, -1, -1, -1, -1, -1, -1},
+    {1575, 1617, 1738, -1, -1, -1, -1, -1, -1},
+    {1738, 1740, 1575, -1, -1, -1, -1, -1, -1},
+    {1366, 1473, 1617, -1, -1, -1, -1, -1, -1},
+    {1617, 1575, 1366, -1, -1, -1, -1, -1, -1},
+    {1269, 1331, 1473, -1, -1, -1, -1, -1, -1},
+    {1473, 1366, 1269, -1, -1, -1, -1, -1, -1},
+    {1195, 1276, 1331, -1, -1, -1, -1, -1, -1},
+    {1331, 1269, 1195, -1, -1, -1, -1, -1, -1},
+    {1119, 1224, 1276, -1, -1, -1, -1, -1, -1},
+    {1276, 1195, 1119, -1, -1, -1, -1, -1, -1},
+    {1080, 1194, 1224, -1, -1, -1, -1, -1, -1},
+    {1224, 1119, 1080, -1, -1, -1, -1, -1, -1},
+    {1039, 1165, 1194, -1, -1, -1, -1, -1, -1},
+    {1194, 1080, 1039, -1, -1, -1, -1, -1, -1},
+    {1000, 1128, 1165, -1, -1, -1, -1, -1, -1},
+    {1165, 1039, 1000, -1, -1, -1, -1, -1, -1},
+    {974, 1108, 1128, -1, -1, -1, -1, -1, -1},
+    {1128, 1000, 974, -1, -1, -1, -1, -1, -1},
+    {972, 1098, 1108, -1, -1, -1, -1, -1, -1},
+    {1108, 974, 972, -1, -1, -1, -1, -1, -1},
+    {1523, 1575, 1740, -1, -1, -1, -1, -1, -1},
+    {1740, 1743, 1523, -1, -1, -1, -1, -1, -1},
+    {1303, 1366, 1575, -1, -1, -1, -1, -1, -1},
+    {1575, 1523, 1303, -1, -1, -1, -1, -1, -1},
+    {1208, 1269, 1366, -1, -1, -1, -1, -1, -1},
+    {1366, 1303, 1208, -1, -1, -1, -1, -1, -1},
+    {1118, 1195, 1269, -1, -1, -1, -1, -1, -1},
+    {1269, 1208, 1118, -1, -1, -1, -1, -1, -1},
+    {1064, 1119, 1195, -1, -1, -1, -1, -1, -1},
+    {1195, 1118, 1064, -1, -1, -1, -1, -1, -1},
+    {982, 1080, 1119, -1, -1, -1, -1, -1, -1},
+    {1119, 1064, 982, -1, -1, -1, -1, -1, -1},
+    {940, 1039, 1080, -1, -1, -1, -1, -1, -1},
+    {1080, 982, 940, -1, -1, -1, -1, -1, -1},
+    {900, 1000, 1039, -1, -1, -1, -1, -1, -1},
+    {1039, 940, 900, -1, -1, -1, -1, -1, -1},
+    {877, 974, 1000, -1, -1, -1, -1, -1, -1},
+    {1000, 900, 877, -1, -1, -1, -1, -1, -1},
+    {864, 972, 974, -1, -1, -1, -1, -1, -1},
+    {974, 877, 864, -1, -1, -1, -1, -1, -1},
+    {1492, 1523, 1743, -1, -1, -1, -1, -1, -1},
+    {1743, 1746, 1492, -1, -1, -1, -1, -1, -1},
+    {1279, 1303, 1523, -1, -1, -1, -1, -1, -1},
+    {1523, 1492, 1279, -1, -1, -1, -1, -1, -1},
+    {1180, 1208, 1303, -1, -1, -1, -1, -1, -1},
+    {1303, 1279, 1180, -1, -1, -1, -1, -1, -1},
+    {1085, 1118, 1208, -1, -1, -1, -1, -1, -1},
+    {1208, 1180, 1085, -1, -1, -1, -1, -1, -1},
+    {997, 1064, 1118, -1, -1, -1, -1, -1, -1},
+    {1118, 1085, 997, -1, -1, -1, -1, -1, -1},
+    {927, 982, 1064, -1, -1, -1, -1, -1, -1},
+    {1064, 997, 927, -1, -1, -1, -1, -1, -1},
+    {867, 940, 982, -1, -1, -1, -1, -1, -1},
+    {982, 927, 867, -1, -1, -1, -1, -1, -1},
+    {815, 900, 940, -1, -1, -1, -1, -1, -1},
+    {940, 867, 815, -1, -1, -1, -1, -1, -1},
+    {783, 877, 900, -1, -1, -1, -1, -1, -1},
+    {900, 815, 783, -1, -1, -1, -1, -1, -1},
+    {772, 864, 877, -1, -1, -1, -1, -1, -1},
+    {877, 783, 772, -1, -1, -1, -1, -1, -1},
+    {1465, 1492, 1746, -1, -1, -1, -1, -1, -1},
+    {1746, 1748, 1465, -1, -1, -1, -1, -1, -1},
+    {1265, 1279, 1492, -1, -1, -1, -1, -1, -1},
+    {1492, 1465, 1265, -1, -1, -1, -1, -1, -1},
+    {1148, 1180, 1279, -1, -1, -1, -1, -1, -1},
+    {1279, 1265, 1148, -1, -1, -1, -1, -1, -1},
+    {1056, 1085, 1180, -1, -1, -1, -1, -1, -1},
+    {1180, 1148, 1056, -1, -1, -1, -1, -1, -1},
+    {954, 997, 1085, -1, -1, -1, -1, -1, -1},
+    {1085, 1056, 954, -1, -1, -1, -1, -1, -1},
+    {887, 927, 997, -1, -1, -1, -1, -1, -1},
+    {997, 954, 887, -1, -1, -1, -1, -1, -1},
+    {805, 867, 927, -1, -1, -1, -1, -1, -1},
+    {927, 887, 805, -1, -1, -1, -1, -1, -1},
+    {754, 815, 867, -1, -1, -1, -1, -1, -1},
+    {867, 805, 754, -1, -1, -1, -1, -1, -1},
+    {717, 783, 815, -1, -1, -1, -1, -1, -1},
+    {815, 754, 717, -1, -1, -1, -1, -1, -1},
+    {696, 772, 783, -1, -1, -1, -1, -1, -1},
+    {783, 717, 696, -1, -1, -1, -1, -1, -1},
+    {1445, 1465, 1748, -1, -1, -1, -1, -1, -1},
+    {1748, 1752, 1445, -1, -1, -1, -1, -1, -1},
+    {1249, 1265, 1465, -1, -1, -1, -1, -1, -1},
+    {1465, 1445, 1249, -1, -1, -1, -1, -1, -1},
+    {1126, 1148, 1265, -1, -1, -1, -1, -1, -1},
+    {1265, 1249, 1126, -1, -1, -1, -1, -1, -1},
+    {1031, 1056, 1148, -1, -1, -1, -1, -1, -1},
+    {1148, 1126, 1031, -1, -1, -1, -1, -1, -1},
+    {935, 954, 1056, -1, -1, -1, -1, -1, -1},
+    {1056, 1031, 935, -1, -1, -1, -1, -1, -1},
+    {851, 887, 954, -1, -1, -1, -1, -1, -1},
+    {954, 935, 851, -1, -1, -1, -1, -1, -1},
+    {771, 805, 887, -1, -1, -1, -1, -1, -1},
+    {887, 851, 771, -1, -1, -1, -1, -1, -1},
+    {709, 754, 805, -1, -1, -1, -1, -1, -1},
+    {805, 771, 709, -1, -1, -1, -1, -1, -1},
+    {647, 717, 754, -1, -1, -1, -1, -1, -1},
+    {754, 709, 647, -1, -1, -1, -1, -1, -1},
+    {636, 696, 717, -1, -1, -1, -1, -1, -1},
+    {717, 647, 636, -1, -1, -1, -1, -1, -1},
+    {1439, 1445, 1752, -1, -1, -1, -1, -1, -1},
+    {1752, 1754, 1439, -1, -1, -1, -1, -1, -1},
+    {1241, 1249, 1445, -1, -1, -1, -1, -1, -1},
+    {1445, 1439, 1241, -1, -1, -1, -1, -1, -1},
+    {1114, 1126, 1249, -1, -1, -1, -1, -1, -1},
+    {1249, 1241, 1114, -1, -1, -1, -1, -1, -1},
+    {1019, 1031, 1126, -1, -1, -1, -1, -1, -1},
+    {1126, 1114, 1019, -1, -1, -1, -1, -1, -1},
+    {921, 935, 1031, -1, -1, -1, -1, -1, -1},
+    {1031, 1019, 921, -1, -1, -1, -1, -1, -1},
+    {829, 851, 935, -1, -1, -1, -1, -1, -1},
+    {935, 921, 829, -1, -1, -1, -1, -1, -1},
+    {749, 771, 851, -1, -1, -1, -1, -1, -1},
+    {851, 829, 749, -1, -1, -1, -1, -1, -1},
+    {671, 709, 771, -1, -1, -1, -1, -1, -1},
+    {771, 749, 671, -1, -1, -1, -1, -1, -1},
+    {630, 647, 709, -1, -1, -1, -1, -1, -1},
+    {709, 671, 630, -1, -1, -1, -1, -1, -1},
+    {612, 636, 647, -1, -1, -1, -1, -1, -1},
+    {647, 630, 612, -1, -1, -1, -1, -1, -1},
+    {1433, 1439, 1754, -1, -1, -1, -1, -1, -1},
+    {1754, 1756, 1433, -1, -1, -1, -1, -1, -1},
+    {1239, 1241, 1439, -1, -1, -1, -1, -1, -1},
+    {1439, 1433, 1239, -1, -1, -1, -1, -1, -1},
+    {1109, 1114, 1241, -1, -1, -1, -1, -1, -1},
+    {1241, 1239, 1109, -1, -1, -1, -1, -1, -1},
+    {1016, 1019, 1114, -1, -1, -1, -1, -1, -1},
+    {1114, 1109, 1016, -1, -1, -1, -1, -1, -1},
+    {914, 921, 1019, -1, -1, -1, -1, -1, -1},
+    {1019, 1016, 914, -1, -1, -1, -1, -1, -1},
+    {822, 829, 921, -1, -1, -1, -1, -1, -1},
+    {921, 914, 822, -1, -1, -1, -1, -1, -1},
+    {742, 749, 829, -1, -1, -1, -1, -1, -1},
+    {829, 822, 742, -1, -1, -1, -1, -1, -1},
+    {654, 671, 749, -1, -1, -1, -1, -1, -1},
+    {749, 742, 654, -1, -1, -1, -1, -1, -1},
+    {621, 630, 671, -1, -1, -1, -1, -1, -1},
+    {671, 654, 621, -1, -1, -1, -1, -1, -1},
+    {601, 612, 630, -1, -1, -1, -1, -1, -1},
+    {630, 621, 601, -1, -1, -1, -1, -1, -1},
+    {1427, 1433, 1756, -1, -1, -1, -1, -1, -1},
+    {1756, 1759, 1427, -1, -1, -1, -1, -1, -1},
+    {1231, 1239, 1433, -1, -1, -1, -1, -1, -1},
+    {1433, 1427, 1231, -1, -1, -1, -1, -1, -1},
+    {1104, 1109, 1239, -1, -1, -1, -1, -1, -1},
+    {1239, 1231, 1104, -1, -1, -1, -1, -1, -1},
+    {1009, 1016, 1109, -1, -1, -1, -1, -1, -1},
+    {1109, 1104, 1009, -1, -1, -1, -1, -1, -1},
+    {912, 914, 1016, -1, -1, -1, -1, -1, -1},
+    {1016, 1009, 912, -1, -1, -1, -1, -1, -1},
+    {820, 822, 914, -1, -1, -1, -1, -1, -1},
+    {914, 912, 820, -1, -1, -1, -1, -1, -1},
+    {735, 742, 822, -1, -1, -1, -1, -1, -1},
+    {822, 820, 735, -1, -1, -1, -1, -1, -1},
+    {651, 654, 742, -1, -1, -1, -1, -1, -1},
+    {742, 735, 651, -1, -1, -1, -1, -1, -1},
+    {618, 621, 654, -1, -1, -1, -1, -1, -1},
+    {654, 651, 618, -1, -1, -1, -1, -1, -1},
+    {600, 601, 621, -1, -1, -1, -1, -1, -1},
+    {621, 618, 600, -1, -1, -1, -1, -1, -1},
+    {1734, 1288, 1293, -1, -1, -1, -1, -1, -1},
+    {1734, 1293, 1301, -1, -1, -1, -1, -1, -1},
+    {1734, 1301, 1317, -1, -1, -1, -1, -1, -1},
+    {1734, 1317, 1348, -1, -1, -1, -1, -1, -1},
+    {1734, 1348, 1391, -1, -1, -1, -1, -1, -1},
+    {1734, 1391, 1455, -1, -1, -1, -1, -1, -1},
+    {1734, 1455, 1533, -1, -1, -1, -1, -1, -1},
+    {1734, 1533, 1608, -1, -1, -1, -1, -1, -1},
+    {1734, 1608, 1660, -1, -1, -1, -1, -1, -1},
+    {1734, 1660, 1888, -1, -1, -1, -1, -1, -1},
+    {1107, 1293, 1288, -1, -1, -1, -1, -1, -1},
+    {1288, 1098, 1107, -1, -1, -1, -1, -1, -1},
+    {1127, 1301, 1293, -1, -1, -1, -1, -1, -1},
+    {1293, 1107, 1127, -1, -1, -1, -1, -1, -1},
+    {1166, 1317, 1301, -1, -1, -1, -1, -1, -1},
+    {1301, 1127, 1166, -1, -1, -1, -1, -1, -1},
+    {1193, 1348, 1317, -1, -1, -1, -1, -1, -1},
+    {1317, 1166, 1193, -1, -1, -1, -1, -1, -1},
+    {1223, 1391, 1348, -1, -1, -1, -1, -1, -1},
+    {1348, 1193, 1223, -1, -1, -1, -1, -1, -1},
+    {1275, 1455, 1391, -1, -1, -1, -1, -1, -1},
+    {1391, 1223, 1275, -1, -1, -1, -1, -1, -1},
+    {1330, 1533, 1455, -1, -1, -1, -1, -1, -1},
+    {1455, 1275, 1330, -1, -1, -1, -1, -1, -1},
+    {1474, 1608, 1533, -1, -1, -1, -1, -1, -1},
+    {1533, 1330, 1474, -1, -1, -1, -1, -1, -1},
+    {1618, 1660, 1608, -1, -1, -1, -1, -1, -1},
+    {1608, 1474, 1618, -1, -1, -1, -1, -1, -1},
+    {1737, 1888, 1660, -1, -1, -1, -1, -1, -1},
+    {1660, 1618, 1737, -1, -1, -1, -1, -1, -1},
+    {975, 1107, 1098, -1, -1, -1, -1, -1, -1},
+    {1098, 973, 975, -1, -1, -1, -1, -1, -1},
+    {1001, 1127, 1107, -1, -1, -1, -1, -1, -1},
+    {1107, 975, 1001, -1, -1, -1, -1, -1, -1},
+    {1038, 1166, 1127, -1, -1, -1, -1, -1, -1},
+    {1127, 1001, 1038, -1, -1, -1, -1, -1, -1},
+    {1081, 1193, 1166, -1, -1, -1, -1, -1, -1},
+    {1166, 1038, 1081, -1, -1, -1, -1, -1, -1},
+    {1120, 1223, 1193, -1, -1, -1, -1, -1, -1},
+    {1193, 1081, 1120, -1, -1, -1, -1, -1, -1},
+    {1196, 1275, 1223, -1, -1, -1, -1, -1, -1},
+    {1223, 1120, 1196, -1, -1, -1, -1, -1, -1},
+    {1270, 1330, 1275, -1, -1, -1, -1, -1, -1},
+    {1275, 1196, 1270, -1, -1, -1, -1, -1, -1},
+    {1367, 1474, 1330, -1, -1, -1, -1, -1, -1},
+    {1330, 1270, 1367, -1, -1, -1, -1, -1, -1},
+    {1576, 1618, 1474, -1, -1, -1, -1, -1, -1},
+    {1474, 1367, 1576, -1, -1, -1, -1, -1, -1},
+    {1902, 1737, 1618, -1, -1, -1, -1, -1, -1},
+    {1618, 1576, 1902, -1, -1, -1, -1, -1, -1},
+    {876, 975, 973, -1, -1, -1, -1, -1, -1},
+    {973, 865, 876, -1, -1, -1, -1, -1, -1},
+    {901, 1001, 975, -1, -1, -1, -1, -1, -1},
+    {975, 876, 901, -1, -1, -1, -1, -1, -1},
+    {941, 1038, 1001, -1, -1, -1, -1, -1, -1},
+    {1001, 901, 941, -1, -1, -1, -1, -1, -1},
+    {983, 1081, 1038, -1, -1, -1, -1, -1, -1},
+    {1038, 941, 983, -1, -1, -1, -1, -1, -1},
+    {1065, 1120, 1081, -1, -1, -1, -1, -1, -1},
+    {1081, 983, 1065, -1, -1, -1, -1, -1, -1},
+    {1117, 1196, 1120, -1, -1, -1, -1, -1, -1},
+    {1120, 1065, 1117, -1, -1, -1, -1, -1, -1},
+    {1207, 1270, 1196, -1, -1, -1, -1, -1, -1},
+    {1196, 1117, 1207, -1, -1, -1, -1, -1, -1},
+    {1304, 1367, 1270, -1, -1, -1, -1, -1, -1},
+    {1270, 1207, 1304, -1, -1, -1, -1, -1, -1},
+    {1524, 1576, 1367, -1, -1, -1, -1, -1, -1},
+    {1367, 1304, 1524, -1, -1, -1, -1, -1, -1},
+    {1741, 1902, 1576, -1, -1, -1, -1, -1, -1},
+    {1576, 1524, 1741, -1, -1, -1, -1, -1, -1},
+    {782, 876, 865, -1, -1, -1, -1, -1, -1},
+    {865, 773, 782, -1, -1, -1, -1, -1, -1},
+    {814, 901, 876, -1, -1, -1, -1, -1, -1},
+    {876, 782, 814, -1, -1, -1, -1, -1, -1},
+    {866, 941, 901, -1, -1, -1, -1, -1, -1},
+    {901, 814, 866, -1, -1, -1, -1, -1, -1},
+    {926, 983, 941, -1, -1, -1, -1, -1, -1},
+    {941, 866, 926, -1, -1, -1, -1, -1, -1},
+    {996, 1065, 983, -1, -1, -1, -1, -1, -1},
+    {983, 926, 996, -1, -1, -1, -1, -1, -1},
+    {1084, 1117, 1065, -1, -1, -1, -1, -1, -1},
+    {1065, 996, 1084, -1, -1, -1, -1, -1, -1},
+    {1179, 1207, 1117, -1, -1, -1, -1, -1, -1},
+    {1117, 1084, 1179, -1, -1, -1, -1, -1, -1},
+    {1280, 1304, 1207, -1, -1, -1, -1, -1, -1},
+    {1207, 1179, 1280, -1, -1, -1, -1, -1, -1},
+    {1491, 1524, 1304, -1, -1, -1, -1, -1, -1},
+    {1304, 1280, 1491, -1, -1, -1, -1, -1, -1},
+    {1702, 1741, 1524, -1, -1, -1, -1, -1, -1},
+    {1524, 1491, 1702, -1, -1, -1, -1, -1, -1},
+    {716, 782, 773, -1, -1, -1, -1, -1, -1},
+    {773, 697, 716, -1, -1, -1, -1, -1, -1},
+    {755, 814, 782, -1, -1, -1, -1, -1, -1},
+    {782, 716, 755, -1, -1, -1, -1, -1, -1},
+    {804, 866, 814, -1, -1, -1, -1, -1, -1},
+    {814, 755, 804, -1, -1, -1, -1, -1, -1},
+    {886, 926, 866, -1, -1, -1, -1, -1, -1},
+    {866, 804, 886, -1, -1, -1, -1, -1, -1},
+    {955, 996, 926, -1, -1, -1, -1, -1, -1},
+    {926, 886, 955, -1, -1, -1, -1, -1, -1},
+    {1057, 1084, 996, -1, -1, -1, -1, -1, -1},
+    {996, 955, 1057, -1, -1, -1, -1, -1, -1},
+    {1147, 1179, 1084, -1, -1, -1, -1, -1, -1},
+    {1084, 1057, 1147, -1, -1, -1, -1, -1, -1},
+    {1266, 1280, 1179, -1, -1, -1, -1, -1, -1},
+    {1179, 1147, 1266, -1, -1, -1, -1, -1, -1},
+    {1466, 1491, 1280, -1, -1, -1, -1, -1, -1},
+    {1280, 1266, 1466, -1, -1, -1, -1, -1, -1},
+    {1904, 1702, 1491, -1, -1, -1, -1, -1, -1},
+    {1491, 1466, 1904, -1, -1, -1, -1, -1, -1},
+    {646, 716, 697, -1, -1, -1, -1, -1, -1},
+    {697, 635, 646, -1, -1, -1, -1, -1, -1},
+    {708, 755, 716, -1, -1, -1, -1, -1, -1},
+    {716, 646, 708, -1, -1, -1, -1, -1, -1},
+    {770, 804, 755, -1, -1, -1, -1, -1, -1},
+    {755, 708, 770, -1, -1, -1, -1, -1, -1},
+    {850, 886, 804, -1, -1, -1, -1, -1, -1},
+    {804, 770, 850, -1, -1, -1, -1, -1, -1},
+    {934, 955, 886, -1, -1, -1, -1, -1, -1},
+    {886, 850, 934, -1, -1, -1, -1, -1, -1},
+    {1030, 1057, 955, -1, -1, -1, -1, -1, -1},
+    {955, 934, 1030, -1, -1, -1, -1, -1, -1},
+    {1125, 1147, 1057, -1, -1, -1, -1, -1, -1},
+    {1057, 1030, 1125, -1, -1, -1, -1, -1, -1},
+    {1250, 1266, 1147, -1, -1, -1, -1, -1, -1},
+    {1147, 1125, 1250, -1, -1, -1, -1, -1, -1},
+    {1446, 1466, 1266, -1, -1, -1, -1, -1, -1},
+    {1266, 1250, 1446, -1, -1, -1, -1, -1, -1},
+    {1750, 1904, 1466, -1, -1, -1, -1, -1, -1},
+    {1466, 1446, 1750, -1, -1, -1, -1, -1, -1},
+    {629, 646, 635, -1, -1, -1, -1, -1, -1},
+    {635, 611, 629, -1, -1, -1, -1, -1, -1},
+    {670, 708, 646, -1, -1, -1, -1, -1, -1},
+    {646, 629, 670, -1, -1, -1, -1, -1, -1},
+    {748, 770, 708, -1, -1, -1, -1, -1, -1},
+    {708, 670, 748, -1, -1, -1, -1, -1, -1},
+    {828, 850, 770, -1, -1, -1, -1, -1, -1},
+    {770, 748, 828, -1, -1, -1, -1, -1, -1},
+    {920, 934, 850, -1, -1, -1, -1, -1, -1},
+    {850, 828, 920, -1, -1, -1, -1, -1, -1},
+    {1018, 1030, 934, -1, -1, -1, -1, -1, -1},
+    {934, 920, 1018, -1, -1, -1, -1, -1, -1},
+    {1113, 1125, 1030, -1, -1, -1, -1, -1, -1},
+    {1030, 1018, 1113, -1, -1, -1, -1, -1, -1},
+    {1242, 1250, 1125, -1, -1, -1, -1, -1, -1},
+    {1125, 1113, 1242, -1, -1, -1, -1, -1, -1},
+    {1440, 1446, 1250, -1, -1, -1, -1, -1, -1},
+    {1250, 1242, 1440, -1, -1, -1, -1, -1, -1},
+    {1895, 1750, 1446, -1, -1, -1, -1, -1, -1},
+    {1446, 1440, 1895, -1, -1, -1, -1, -1, -1},
+    {622, 629, 611, -1, -1, -1, -1, -1, -1},
+    {611, 602, 622, -1, -1, -1, -1, -1, -1},
+    {655, 670, 629, -1, -1, -1, -1, -1, -1},
+    {629, 622, 655, -1, -1, -1, -1, -1, -1},
+    {743, 748, 670, -1, -1, -1, -1, -1, -1},
+    {670, 655, 743, -1, -1, -1, -1, -1, -1},
+    {823, 828, 748, -1, -1, -1, -1, -1, -1},
+    {748, 743, 823, -1, -1, -1, -1, -1, -1},
+    {915, 920, 828, -1, -1, -1, -1, -1, -1},
+    {828, 823, 915, -1, -1, -1, -1, -1, -1},
+    {1017, 1018, 920, -1, -1, -1, -1, -1, -1},
+    {920, 915, 1017, -1, -1, -1, -1, -1, -1},
+    {1110, 1113, 1018, -1, -1, -1, -1, -1, -1},
+    {1018, 1017, 1110, -1, -1, -1, -1, -1, -1},
+    {1240, 1242, 1113, -1, -1, -1, -1, -1, -1},
+    {1113, 1110, 1240, -1, -1, -1, -1, -1, -1},
+    {1434, 1440, 1242, -1, -1, -1, -1, -1, -1},
+    {1242, 1240, 1434, -1, -1, -1, -1, -1, -1},
+    {1922, 1895, 1440, -1, -1, -1, -1, -1, -1},
+    {1440, 1434, 1922, -1, -1, -1, -1, -1, -1},
+    {616, 622, 602, -1, -1, -1, -1, -1, -1},
+    {602, 600, 616, -1, -1, -1, -1, -1, -1},
+    {649, 655, 622, -1, -1, -1, -1, -1, -1},
+    {622, 616, 649, -1, -1, -1, -1, -1, -1},
+    {733, 743, 655, -1, -1, -1, -1, -1, -1},
+    {655, 649, 733, -1, -1, -1, -1, -1, -1},
+    {817, 823, 743, -1, -1, -1, -1, -1, -1},
+    {743, 733, 817, -1, -1, -1, -1, -1, -1},
+    {911, 915, 823, -1, -1, -1, -1, -1, -1},
+    {823, 817, 911, -1, -1, -1, -1, -1, -1},
+    {1008, 1017, 915, -1, -1, -1, -1, -1, -1},
+    {915, 911, 1008, -1, -1, -1, -1, -1, -1},
+    {1101, 1110, 1017, -1, -1, -1, -1, -1, -1},
+    {1017, 1008, 1101, -1, -1, -1, -1, -1, -1},
+    {1234, 1240, 1110, -1, -1, -1, -1, -1, -1},
+    {1110, 1101, 1234, -1, -1, -1, -1, -1, -1},
+    {1430, 1434, 1240, -1, -1, -1, -1, -1, -1},
+    {1240, 1234, 1430, -1, -1, -1, -1, -1, -1},
+    {1758, 1922, 1434, -1, -1, -1, -1, -1, -1},
+    {1434, 1430, 1758, -1, -1, -1, -1, -1, -1},
+    {1734, 1735, 1962, -1, -1, -1, -1, -1, -1},
+    {1734, 1962, 2014, -1, -1, -1, -1, -1, -1},
+    {1734, 2014, 2087, -1, -1, -1, -1, -1, -1},
+    {1734, 2087, 2165, -1, -1, -1, -1, -1, -1},
+    {1734, 2165, 2229, -1, -1, -1, -1, -1, -1},
+    {1734, 2229, 2272, -1, -1, -1, -1, -1, -1},
+    {1734, 2272, 2303, -1, -1, -1, -1, -1, -1},
+    {1734, 2303, 2319, -1, -1, -1, -1, -1, -1},
+    {1734, 2319, 2327, -1, -1, -1, -1, -1, -1},
+    {1734, 2327, 2334, -1, -1, -1, -1, -1, -1},
+    {2004, 1962, 1735, -1, -1, -1, -1, -1, -1},
+    {1735, 1737, 2004, -1, -1, -1, -1, -1, -1},
+    {2148, 2014, 1962, -1, -1, -1, -1, -1, -1},
+    {1962, 2004, 2148, -1, -1, -1, -1, -1, -1},
+    {2290, 2087, 2014, -1, -1, -1, -1, -1, -1},
+    {2014, 2148, 2290, -1, -1, -1, -1, -1, -1},
+    {2345, 2165, 2087, -1, -1, -1, -1, -1, -1},
+    {2087, 2290, 2345, -1, -1, -1, -1, -1, -1},
+    {2397, 2229, 2165, -1, -1, -1, -1, -1, -1},
+    {2165, 2345, 2397, -1, -1, -1, -1, -1, -1},
+    {2427, 2272, 2229, -1, -1, -1, -1, -1, -1},
+    {2229, 2397, 2427, -1, -1, -1, -1, -1, -1},
+    {2456, 2303, 2272, -1, -1, -1, -1, -1, -1},
+    {2272, 2427, 2456, -1, -1, -1, -1, -1, -1},
+    {2493, 2319, 2303, -1, -1, -1, -1, -1, -1},
+    {2303, 2456, 2493, -1, -1, -1, -1, -1, -1},
+    {2513, 2327, 2319, -1, -1, -1, -1, -1, -1},
+    {2319, 2493, 2513, -1, -1, -1, -1, -1, -1},
+    {2523, 2334, 2327, -1, -1, -1, -1, -1, -1},
+    {2327, 2513, 2523, -1, -1, -1, -1, -1, -1},
+    {2046, 2004, 1737, -1, -1, -1, -1, -1, -1},
+    {1737, 1739, 2046, -1, -1, -1, -1, -1, -1},
+    {2255, 2148, 2004, -1, -1, -1, -1, -1, -1},
+    {2004, 2046, 2255, -1, -1, -1, -1, -1, -1},
+    {2352, 2290, 2148, -1, -1, -1, -1, -1, -1},
+    {2148, 2255, 2352, -1, -1, -1, -1, -1, -1},
+    {2426, 2345, 2290, -1, -1, -1, -1, -1, -1},
+    {2290, 2352, 2426, -1, -1, -1, -1, -1, -1},
+    {2502, 2397, 2345, -1, -1, -1, -1, -1, -1},
+    {2345, 2426, 2502, -1, -1, -1, -1, -1, -1},
+    {2541, 2427, 2397, -1, -1, -1, -1, -1, -1},
+    {2397, 2502, 2541, -1, -1, -1, -1, -1, -1},
+    {2582, 2456, 2427, -1, -1, -1, -1, -1, -1},
+    {2427, 2541, 2582, -1, -1, -1, -1, -1, -1},
+    {2621, 2493, 2456, -1, -1, -1, -1, -1, -1},
+    {2456, 2582, 2621, -1, -1, -1, -1, -1, -1},
+    {2647, 2513, 2493, -1, -1, -1, -1, -1, -1},
+    {2493, 2621, 2647, -1, -1, -1, -1, -1, -1},
+    {2649, 2523, 2513, -1, -1, -1, -1, -1, -1},
+    {2513, 2647, 2649, -1, -1, -1, -1, -1, -1},
+    {2098, 2046, 1739, -1, -1, -1, -1, -1, -1},
+    {1739, 1742, 2098, -1, -1, -1, -1, -1, -1},
+    {2318, 2255, 2046, -1, -1, -1, -1, -1, -1},
+    {2046, 2098, 2318, -1, -1, -1, -1, -1, -1},
+    {2413, 2352, 2255, -1, -1, -1, -1, -1, -1},
+    {2255, 2318, 2413, -1, -1, -1, -1, -1, -1},
+    {2503, 2426, 2352, -1, -1, -1, -1, -1, -1},
+    {2352, 2413, 2503, -1, -1, -1, -1, -1, -1},
+    {2557, 2502, 2426, -1, -1, -1, -1, -1, -1},
+    {2426, 2503, 2557, -1, -1, -1, -1, -1, -1},
+    {2639, 2541, 2502, -1, -1, -1, -1, -1, -1},
+    {2502, 2557, 2639, -1, -1, -1, -1, -1, -1},
+    {2681, 2582, 2541, -1, -1, -1, -1, -1, -1},
+    {2541, 2639, 2681, -1, -1, -1, -1, -1, -1},
+    {2721, 2621, 2582, -1, -1, -1, -1, -1, -1},
+    {2582, 2681, 2721, -1, -1, -1, -1, -1, -1},
+    {2744, 2647, 2621, -1, -1, -1, -1, -1, -1},
+    {2621, 2721, 2744, -1, -1, -1, -1, -1, -1},
+    {2757, 2649, 2647, -1, -1, -1, -1, -1, -1},
+    {2647, 2744, 2757, -1, -1, -1, -1, -1, -1},
+    {2129, 2098, 1742, -1, -1, -1, -1, -1, -1},
+    {1742, 1745, 2129, -1, -1, -1, -1, -1, -1},
+    {2342, 2318, 2098, -1, -1, -1, -1, -1, -1},
+    {2098, 2129, 2342, -1, -1, -1, -1, -1, -1},
+    {2441, 2413, 2318, -1, -1, -1, -1, -1, -1},
+    {2318, 2342, 2441, -1, -1, -1, -1, -1, -1},
+    {2536, 2503, 2413, -1, -1, -1, -1, -1, -1},
+    {2413, 2441, 2536, -1, -1, -1, -1, -1, -1},
+    {2624, 2557, 2503, -1, -1, -1, -1, -1, -1},
+    {2503, 2536, 2624, -1, -1, -1, -1, -1, -1},
+    {2694, 2639, 2557, -1, -1, -1, -1, -1, -1},
+    {2557, 2624, 2694, -1, -1, -1, -1, -1, -1},
+    {2754, 2681, 2639, -1, -1, -1, -1, -1, -1},
+    {2639, 2694, 2754, -1, -1, -1, -1, -1, -1},
+    {2806, 2721, 2681, -1, -1, -1, -1, -1, -1},
+    {2681, 2754, 2806, -1, -1, -1, -1, -1, -1},
+    {2838, 2744, 2721, -1, -1, -1, -1, -1, -1},
+    {2721, 2806, 2838, -1, -1, -1, -1, -1, -1},
+    {2849, 2757, 2744, -1, -1, -1, -1, -1, -1},
+    {2744, 2838, 2849, -1, -1, -1, -1, -1, -1},
+    {2156, 2129, 1745, -1, -1, -1, -1, -1, -1},
+    {1745, 1747, 2156, -1, -1, -1, -1, -1, -1},
+    {2356, 2342, 2129, -1, -1, -1, -1, -1, -1},
+    {2129, 2156, 2356, -1, -1, -1, -1, -1, -1},
+    {2473, 2441, 2342, -1, -1, -1, -1, -1, -1},
+    {2342, 2356, 2473, -1, -1, -1, -1, -1, -1},
+    {2565, 2536, 2441, -1, -1, -1, -1, -1, -1},
+    {2441, 2473, 2565, -1, -1, -1, -1, -1, -1},
+    {2667, 2624, 2536, -1, -1, -1, -1, -1, -1},
+    {2536, 2565, 2667, -1, -1, -1, -1, -1, -1},
+    {2734, 2694, 2624, -1, -1, -1, -1, -1, -1},
+    {2624, 2667, 2734, -1, -1, -1, -1, -1, -1},
+    {2816, 2754, 2694, -1, -1, -1, -1, -1, -1},
+    {2694, 2734, 2816, -1, -1, -1, -1, -1, -1},
+    {2867, 2806, 2754, -1, -1, -1, -1, -1, -1},
+    {2754, 2816, 2867, -1, -1, -1, -1, -1, -1},
+    {2904, 2838, 2806, -1, -1, -1, -1, -1, -1},
+    {2806, 2867, 2904, -1, -1, -1, -1, -1, -1},
+    {2925, 2849, 2838, -1, -1, -1, -1, -1, -1},
+    {2838, 2904, 2925, -1, -1, -1, -1, -1, -1},
+    {2176, 2156, 1747, -1, -1, -1, -1, -1, -1},
+    {1747, 1749, 2176, -1, -1, -1, -1, -1, -1},
+    {2372, 2356, 2156, -1, -1, -1, -1, -1, -1},
+    {2156, 2176, 2372, -1, -1, -1, -1, -1, -1},
+    {2495, 2473, 2356, -1, -1, -1, -1, -1, -1},
+    {2356, 2372, 2495, -1, -1, -1, -1, -1, -1},
+    {2590, 2565, 2473, -1, -1, -1, -1, -1, -1},
+    {2473, 2495, 2590, -1, -1, -1, -1, -1, -1},
+    {2686, 2667, 2565, -1, -1, -1, -1, -1, -1},
+    {2565, 2590, 2686, -1, -1, -1, -1, -1, -1},
+    {2770, 2734, 2667, -1, -1, -1, -1, -1, -1},
+    {2667, 2686, 2770, -1, -1, -1, -1, -1, -1},
+    {2850, 2816, 2734, -1, -1, -1, -1, -1, -1},
+    {2734, 2770, 2850, -1, -1, -1, -1, -1, -1},
+    {2912, 2867, 2816, -1, -1, -1, -1, -1, -1},
+    {2816, 2850, 2912, -1, -1, -1, -1, -1, -1},
+    {2974, 2904, 2867, -1, -1, -1, -1, -1, -1},
+    {2867, 2912, 2974, -1, -1, -1, -1, -1, -1},
+    {2985, 2925, 2904, -1, -1, -1, -1, -1, -1},
+    {2904, 2974, 2985, -1, -1, -1, -1, -1, -1},
+    {2182, 2176, 1749, -1, -1, -1, -1, -1, -1},
+    {1749, 1753, 2182, -1, -1, -1, -1, -1, -1},
+    {2380, 2372, 2176, -1, -1, -1, -1, -1, -1},
+    {2176, 2182, 2380, -1, -1, -1, -1, -1, -1},
+    {2507, 2495, 2372, -1, -1, -1, -1, -1, -1},
+    {2372, 2380, 2507, -1, -1, -1, -1, -1, -1},
+    {2602, 2590, 2495, -1, -1, -1, -1, -1, -1},
+    {2495, 2507, 2602, -1, -1, -1, -1, -1, -1},
+    {2700, 2686, 2590, -1, -1, -1, -1, -1, -1},
+    {2590, 2602, 2700, -1, -1, -1, -1, -1, -1},
+    {2792, 2770, 2686, -1, -1, -1, -1, -1, -1},
+    {2686, 2700, 2792, -1, -1, -1, -1, -1, -1},
+    {2872, 2850, 2770, -1, -1, -1, -1, -1, -1},
+    {2770, 2792, 2872, -1, -1, -1, -1, -1, -1},
+    {2950, 2912, 2850, -1, -1, -1, -1, -1, -1},
+    {2850, 2872, 2950, -1, -1, -1, -1, -1, -1},
+    {2991, 2974, 2912, -1, -1, -1, -1, -1, -1},
+    {2912, 2950, 2991, -1, -1, -1, -1, -1, -1},
+    {3009, 2985, 2974, -1, -1, -1, -1, -1, -1},
+    {2974, 2991, 3009, -1, -1, -1, -1, -1, -1},
+    {2188, 2182, 1753, -1, -1, -1, -1, -1, -1},
+    {1753, 1755, 2188, -1, -1, -1, -1, -1, -1},
+    {2382, 2380, 2182, -1, -1, -1, -1, -1, -1},
+    {2182, 2188, 2382, -1, -1, -1, -1, -1, -1},
+    {2512, 2507, 2380, -1, -1, -1, -1, -1, -1},
+    {2380, 2382, 2512, -1, -1, -1, -1, -1, -1},
+    {2605, 2602, 2507, -1, -1, -1, -1, -1, -1},
+    {2507, 2512, 2605, -1, -1, -1, -1, -1, -1},
+    {2707, 2700, 2602, -1, -1, -1, -1, -1, -1},
+    {2602, 2605, 2707, -1, -1, -1, -1, -1, -1},
+    {2799, 2792, 2700, -1, -1, -1, -1, -1, -1},
+    {2700, 2707, 2799, -1, -1, -1, -1, -1, -1},
+    {2879, 2872, 2792, -1, -1, -1, -1, -1, -1},
+    {2792, 2799, 2879, -1, -1, -1, -1, -1, -1},
+    {2967, 2950, 2872, -1, -1, -1, -1, -1, -1},
+    {2872, 2879, 2967, -1, -1, -1, -1, -1, -1},
+    {3000, 2991, 2950, -1, -1, -1, -1, -1, -1},
+    {2950, 2967, 3000, -1, -1, -1, -1, -1, -1},
+    {3020, 3009, 2991, -1, -1, -1, -1, -1, -1},
+    {2991, 3000, 3020, -1, -1, -1, -1, -1, -1},
+    {2194, 2188, 1755, -1, -1, -1, -1, -1, -1},
+    {1755, 1758, 2194, -1, -1, -1, -1, -1, -1},
+    {2389, 2382, 2188, -1, -1, -1, -1, -1, -1},
+    {2188, 2194, 2389, -1, -1, -1, -1, -1, -1},
+    {2516, 2512, 2382, -1, -1, -1, -1, -1, -1},
+    {2382, 2389, 2516, -1, -1, -1, -1, -1, -1},
+    {2611, 2605, 2512, -1, -1, -1, -1, -1, -1},
+    {2512, 2516, 2611, -1, -1, -1, -1, -1, -1},
+    {2708, 2707, 2605, -1, -1, -1, -1, -1, -1},
+    {2605, 2611, 2708, -1, -1, -1, -1, -1, -1},
+    {2800, 2799, 2707, -1, -1, -1, -1, -1, -1},
+    {2707, 2708, 2800, -1, -1, -1, -1, -1, -1},
+    {2885, 2879, 2799, -1, -1, -1, -1, -1, -1},
+    {2799, 2800, 2885, -1, -1, -1, -1, -1, -1},
+    {2969, 2967, 2879, -1, -1, -1, -1, -1, -1},
+    {2879, 2885, 2969, -1, -1, -1, -1, -1, -1},
+    {3003, 3000, 2967, -1, -1, -1, -1, -1, -1},
+    {2967, 2969, 3003, -1, -1, -1, -1, -1, -1},
+    {3021, 3020, 3000, -1, -1, -1, -1, -1, -1},
+    {3000, 3003, 3021, -1, -1, -1, -1, -1, -1},
+};
+#define mesh_stride 3
+#define mesh_vertices_count 7037
+static const float mesh_vertices[][3] = {
+    {0.460430, 0.344175, -0.090961},
+    {0.465987, 0.330000, -0.091885},
+    {0.473200, 0.330000, 0.000000},
+    {0.467570, 0.344175, 0.000000},
+    {0.439718, 0.344175, -0.176866},
+    {0.458248, 0.355200, -0.090598},
+    {0.437620, 0.355200, -0.176161},
+    {0.445066, 0.330000, -0.178662},
+    {0.406501, 0.344175, -0.256651},
+    {0.404534, 0.355200, -0.255628},
+    {0.438313, 0.363075, -0.176394},
+    {0.405184, 0.363075, -0.255966},
+    {0.465360, 0.355200, 0.000000},
+    {0.458969, 0.363075, -0.090718},
+    {0.441342, 0.367800, -0.177412},
+    {0.408022, 0.367800, -0.257443},
+    {0.360643, 0.363075, -0.328372},
+    {0.363224, 0.367800, -0.330267},
+    {0.360052, 0.355200, -0.327939},
+    {0.305752, 0.363075, -0.392552},
+    {0.308017, 0.367800, -0.394817},
+    {0.367408, 0.369375, -0.333338},
+    {0.311688, 0.369375, -0.398488},
+    {0.412623, 0.369375, -0.259836},
+    {0.462118, 0.367800, -0.091242},
+    {0.446253, 0.369375, -0.179061},
+    {0.418558, 0.367800, -0.262924},
+    {0.372806, 0.367800, -0.337299},
+    {0.316423, 0.367800, -0.403223},
+    {0.246538, 0.369375, -0.454208},
+    {0.250499, 0.367800, -0.459606},
+    {0.243467, 0.367800, -0.450024},
+    {0.173036, 0.369375, -0.499423},
+    {0.176124, 0.367800, -0.505358},
+    {0.255066, 0.363075, -0.465830},
+    {0.179684, 0.363075, -0.512201},
+    {0.321883, 0.363075, -0.408683},
+    {0.379030, 0.363075, -0.341866},
+    {0.327726, 0.355200, -0.414526},
+    {0.259954, 0.355200, -0.472490},
+    {0.183494, 0.355200, -0.519524},
+    {0.096843, 0.363075, -0.546691},
+    {0.099468, 0.355200, -0.554508},
+    {0.094389, 0.367800, -0.539388},
+    {0.007646, 0.363075, -0.568196},
+    {0.008996, 0.355200, -0.576320},
+    {0.102113, 0.344175, -0.562381},
+    {0.010357, 0.344175, -0.584503},
+    {0.187332, 0.344175, -0.526901},
+    {0.264878, 0.344175, -0.479199},
+    {0.190976, 0.330000, -0.533904},
+    {0.104624, 0.330000, -0.569856},
+    {0.011648, 0.330000, -0.592272},
+    {-0.086800, 0.344175, -0.592130},
+    {-0.086800, 0.330000, -0.600000},
+    {-0.086800, 0.355200, -0.583840},
+    {-0.086800, 0.363075, -0.575610},
+    {-0.086800, 0.367800, -0.567920},
+    {0.006384, 0.367800, -0.560605},
+    {-0.086800, 0.367800, -0.567920},
+    {-0.181246, 0.363075, -0.568196},
+    {-0.182596, 0.355200, -0.576320},
+    {-0.086800, 0.355200, -0.583840},
+    {-0.086800, 0.369375, -0.561250},
+    {0.005290, 0.369375, -0.554021},
+    {0.092261, 0.369375, -0.533053},
+    {0.004442, 0.367800, -0.548918},
+    {0.090612, 0.367800, -0.528142},
+    {-0.086800, 0.367800, -0.556080},
+    {0.003918, 0.363075, -0.545769},
+    {0.089594, 0.363075, -0.525113},
+    {0.169166, 0.363075, -0.491984},
+    {0.170643, 0.367800, -0.494822},
+    {0.241572, 0.363075, -0.447443},
+    {0.168828, 0.355200, -0.491334},
+    {0.241139, 0.355200, -0.446852},
+    {0.089361, 0.355200, -0.524420},
+    {0.003798, 0.355200, -0.545048},
+    {-0.086800, 0.363075, -0.552890},
+    {0.090066, 0.344175, -0.526518},
+    {0.169851, 0.344175, -0.493301},
+    {0.242452, 0.344175, -0.448640},
+    {0.306803, 0.344175, -0.393603},
+    {0.305234, 0.355200, -0.392034},
+    {0.361840, 0.344175, -0.329252},
+    {0.310800, 0.330000, -0.397600},
+    {0.366397, 0.330000, -0.332595},
+    {0.245795, 0.330000, -0.453197},
+    {0.172458, 0.330000, -0.498310},
+    {0.091862, 0.330000, -0.531866},
+    {0.004161, 0.344175, -0.547230},
+    {0.005085, 0.330000, -0.552787},
+    {-0.086800, 0.344175, -0.554370},
+    {-0.086800, 0.355200, -0.552160},
+    {-0.086800, 0.330000, -0.560000},
+    {0.411510, 0.330000, -0.259258},
+    {-0.273068, 0.355200, -0.554508},
+    {-0.183957, 0.344175, -0.584503},
+    {-0.275713, 0.344175, -0.562381},
+    {-0.179984, 0.367800, -0.560605},
+    {-0.270443, 0.363075, -0.546691},
+    {-0.357094, 0.355200, -0.519524},
+    {-0.360932, 0.344175, -0.526901},
+    {-0.278224, 0.330000, -0.569856},
+    {-0.364576, 0.330000, -0.533904},
+    {-0.086800, 0.344175, -0.592130},
+    {-0.185248, 0.330000, -0.592272},
+    {-0.287763, 0.267030, -0.598254},
+    {-0.378418, 0.267030, -0.560510},
+    {-0.443152, 0.330000, -0.485568},
+    {-0.460910, 0.267030, -0.509766},
+    {-0.438478, 0.344175, -0.479199},
+    {-0.512800, 0.330000, -0.426000},
+    {-0.534029, 0.267030, -0.447229},
+    {-0.478312, 0.204240, -0.533477},
+    {-0.554832, 0.204240, -0.468032},
+    {-0.391983, 0.204240, -0.586582},
+    {-0.190154, 0.267030, -0.621787},
+    {-0.297111, 0.204240, -0.626082},
+    {-0.404992, 0.141810, -0.611587},
+    {-0.495001, 0.141810, -0.556218},
+    {-0.574783, 0.141810, -0.487983},
+    {-0.620277, 0.204240, -0.391512},
+    {-0.643018, 0.141810, -0.408201},
+    {-0.596566, 0.267030, -0.374110},
+    {-0.673382, 0.204240, -0.305183},
+    {-0.698387, 0.141810, -0.318192},
+    {-0.664302, 0.079920, -0.423821},
+    {-0.721790, 0.079920, -0.330368},
+    {-0.593456, 0.079920, -0.506656},
+    {-0.510621, 0.079920, -0.577502},
+    {-0.610425, 0.018750, -0.523625},
+    {-0.683644, 0.018750, -0.438016},
+    {-0.743057, 0.018750, -0.341433},
+    {-0.764549, 0.079920, -0.227667},
+    {-0.787248, 0.018750, -0.235292},
+    {-0.739570, 0.141810, -0.219276},
+    {-0.791209, 0.079920, -0.117088},
+    {-0.814801, 0.018750, -0.121009},
+    {-0.807098, -0.041520, -0.241960},
+    {-0.835432, -0.041520, -0.124438},
+    {-0.761655, -0.041520, -0.351109},
+    {-0.700558, -0.041520, -0.450429},
+    {-0.777049, -0.100710, -0.359118},
+    {-0.823529, -0.100710, -0.247479},
+    {-0.852509, -0.100710, -0.127277},
+    {-0.845200, -0.041520, 0.000000},
+    {-0.862500, -0.100710, 0.000000},
+    {-0.824300, 0.018750, 0.000000},
+    {-0.800400, 0.079920, -0.000000},
+    {-0.774100, 0.141810, -0.000000},
+    {-0.765248, 0.141810, -0.112772},
+    {-0.746000, 0.204240, 0.000000},
+    {-0.737510, 0.204240, -0.108162},
+    {-0.712882, 0.204240, -0.210311},
+    {-0.708587, 0.267030, -0.103354},
+    {-0.685054, 0.267030, -0.200963},
+    {-0.716700, 0.267030, 0.000000},
+    {-0.679072, 0.330000, -0.098448},
+    {-0.656656, 0.330000, -0.191424},
+    {-0.620704, 0.330000, -0.277776},
+    {-0.647310, 0.267030, -0.291618},
+    {-0.572368, 0.330000, -0.356352},
+    {-0.613701, 0.344175, -0.274132},
+    {-0.565999, 0.344175, -0.351678},
+    {-0.649181, 0.344175, -0.188913},
+    {-0.671303, 0.344175, -0.097157},
+    {-0.686800, 0.330000, 0.000000},
+    {-0.641308, 0.355200, -0.186268},
+    {-0.606324, 0.355200, -0.270294},
+    {-0.559290, 0.355200, -0.346754},
+    {-0.501326, 0.355200, -0.414526},
+    {-0.507212, 0.344175, -0.420412},
+    {-0.433554, 0.355200, -0.472490},
+    {-0.495483, 0.363075, -0.408683},
+    {-0.428666, 0.363075, -0.465830},
+    {-0.552630, 0.363075, -0.341866},
+    {-0.599001, 0.363075, -0.266484},
+    {-0.546406, 0.367800, -0.337299},
+    {-0.490023, 0.367800, -0.403223},
+    {-0.424099, 0.367800, -0.459606},
+    {-0.349724, 0.367800, -0.505358},
+    {-0.353284, 0.363075, -0.512201},
+    {-0.267989, 0.367800, -0.539388},
+    {-0.346636, 0.369375, -0.499423},
+    {-0.265861, 0.369375, -0.533053},
+    {-0.420138, 0.369375, -0.454208},
+    {-0.485288, 0.369375, -0.398488},
+    {-0.417067, 0.367800, -0.450024},
+    {-0.344243, 0.367800, -0.494822},
+    {-0.264212, 0.367800, -0.528142},
+    {-0.178042, 0.367800, -0.548918},
+    {-0.178890, 0.369375, -0.554021},
+    {-0.086800, 0.367800, -0.556080},
+    {-0.086800, 0.369375, -0.561250},
+    {-0.177518, 0.363075, -0.545769},
+    {-0.086800, 0.363075, -0.552890},
+    {-0.263194, 0.363075, -0.525113},
+    {-0.342766, 0.363075, -0.491984},
+    {-0.262961, 0.355200, -0.524420},
+    {-0.177398, 0.355200, -0.545048},
+    {-0.086800, 0.355200, -0.552160},
+    {-0.177761, 0.344175, -0.547230},
+    {-0.086800, 0.344175, -0.554370},
+    {-0.263666, 0.344175, -0.526518},
+    {-0.342428, 0.355200, -0.491334},
+    {-0.415172, 0.363075, -0.447443},
+    {-0.343451, 0.344175, -0.493301},
+    {-0.414739, 0.355200, -0.446852},
+    {-0.265462, 0.330000, -0.531866},
+    {-0.178685, 0.330000, -0.552787},
+    {-0.086800, 0.330000, -0.560000},
+    {-0.346058, 0.330000, -0.498310},
+    {-0.416052, 0.344175, -0.448640},
+    {-0.478834, 0.355200, -0.392034},
+    {-0.479352, 0.363075, -0.392552},
+    {-0.481617, 0.367800, -0.394817},
+    {-0.536824, 0.367800, -0.330267},
+    {-0.541008, 0.369375, -0.333338},
+    {-0.534243, 0.363075, -0.328372},
+    {-0.480403, 0.344175, -0.393603},
+    {-0.533652, 0.355200, -0.327939},
+    {-0.419395, 0.330000, -0.453197},
+    {-0.484400, 0.330000, -0.397600},
+    {-0.535440, 0.344175, -0.329252},
+    {-0.578134, 0.355200, -0.255628},
+    {-0.578784, 0.363075, -0.255966},
+    {-0.581622, 0.367800, -0.257443},
+    {-0.586223, 0.369375, -0.259836},
+    {-0.614942, 0.367800, -0.177412},
+    {-0.619853, 0.369375, -0.179061},
+    {-0.611913, 0.363075, -0.176394},
+    {-0.580101, 0.344175, -0.256651},
+    {-0.611220, 0.355200, -0.176161},
+    {-0.539997, 0.330000, -0.332595},
+    {-0.585110, 0.330000, -0.259258},
+    {-0.613318, 0.344175, -0.176866},
+    {-0.631848, 0.355200, -0.090598},
+    {-0.632569, 0.363075, -0.090718},
+    {-0.635718, 0.367800, -0.091242},
+    {-0.640821, 0.369375, -0.092090},
+    {-0.642880, 0.367800, 0.000000},
+    {-0.648050, 0.369375, 0.000000},
+    {-0.639690, 0.363075, -0.000000},
+    {-0.634030, 0.344175, -0.090961},
+    {-0.638960, 0.355200, 0.000000},
+    {-0.618666, 0.330000, -0.178662},
+    {-0.639587, 0.330000, -0.091885},
+    {-0.641170, 0.344175, 0.000000},
+    {-0.646800, 0.330000, 0.000000},
+    {-0.654720, 0.367800, 0.000000},
+    {-0.647405, 0.367800, -0.093184},
+    {-0.662410, 0.363075, 0.000000},
+    {-0.626188, 0.367800, -0.181189},
+    {-0.654996, 0.363075, -0.094446},
+    {-0.592158, 0.367800, -0.262924},
+    {-0.633491, 0.363075, -0.183643},
+    {-0.663120, 0.355200, -0.095796},
+    {-0.670640, 0.355200, 0.000000},
+    {-0.654720, 0.367800, 0.000000},
+    {-0.654996, 0.363075, 0.094446},
+    {-0.663120, 0.355200, 0.095796},
+    {-0.670640, 0.355200, 0.000000},
+    {-0.648050, 0.369375, 0.000000},
+    {-0.647405, 0.367800, 0.093184},
+    {-0.633491, 0.363075, 0.183643},
+    {-0.641308, 0.355200, 0.186268},
+    {-0.671303, 0.344175, 0.097157},
+    {-0.649181, 0.344175, 0.188913},
+    {-0.678930, 0.344175, 0.000000},
+    {-0.679072, 0.330000, 0.098448},
+    {-0.656656, 0.330000, 0.191424},
+    {-0.613701, 0.344175, 0.274132},
+    {-0.620704, 0.330000, 0.277776},
+    {-0.606324, 0.355200, 0.270294},
+    {-0.626188, 0.367800, 0.181189},
+    {-0.599001, 0.363075, 0.266484},
+    {-0.559290, 0.355200, 0.346754},
+    {-0.565999, 0.344175, 0.351678},
+    {-0.572368, 0.330000, 0.356352},
+    {-0.647310, 0.267030, 0.291618},
+    {-0.596566, 0.267030, 0.374110},
+    {-0.685054, 0.267030, 0.200963},
+    {-0.673382, 0.204240, 0.305183},
+    {-0.620277, 0.204240, 0.391512},
+    {-0.534029, 0.267030, 0.447229},
+    {-0.554832, 0.204240, 0.468032},
+    {-0.512800, 0.330000, 0.426000},
+    {-0.507212, 0.344175, 0.420412},
+    {-0.443152, 0.330000, 0.485568},
+    {-0.460910, 0.267030, 0.509766},
+    {-0.478312, 0.204240, 0.533477},
+    {-0.574783, 0.141810, 0.487983},
+    {-0.495001, 0.141810, 0.556218},
+    {-0.643018, 0.141810, 0.408201},
+    {-0.593456, 0.079920, 0.506656},
+    {-0.510621, 0.079920, 0.577502},
+    {-0.404992, 0.141810, 0.611587},
+    {-0.417168, 0.079920, 0.634990},
+    {-0.391983, 0.204240, 0.586582},
+    {-0.378418, 0.267030, 0.560510},
+    {-0.297111, 0.204240, 0.626082},
+    {-0.306076, 0.141810, 0.652770},
+    {-0.314467, 0.079920, 0.677749},
+    {-0.428233, 0.018750, 0.656257},
+    {-0.322092, 0.018750, 0.700448},
+    {-0.524816, 0.018750, 0.596844},
+    {-0.437909, -0.041520, 0.674855},
+    {-0.328760, -0.041520, 0.720298},
+    {-0.207809, 0.018750, 0.728001},
+    {-0.211238, -0.041520, 0.748632},
+    {-0.203888, 0.079920, 0.704409},
+    {-0.199572, 0.141810, 0.678448},
+    {-0.086800, 0.079920, 0.713600},
+    {-0.086800, 0.018750, 0.737500},
+    {-0.086800, -0.041520, 0.758400},
+    {-0.214077, -0.100710, 0.765709},
+    {-0.086800, -0.100710, 0.775700},
+    {-0.334279, -0.100710, 0.736729},
+    {-0.216226, -0.158640, 0.778640},
+    {-0.086800, -0.158640, 0.788800},
+    {-0.445918, -0.100710, 0.690249},
+    {-0.338459, -0.158640, 0.749171},
+    {-0.217588, -0.215130, 0.786833},
+    {-0.086800, -0.215130, 0.797100},
+    {-0.451983, -0.158640, 0.701906},
+    {-0.341107, -0.215130, 0.757054},
+    {-0.537229, -0.041520, 0.613758},
+    {-0.547504, -0.100710, 0.627758},
+    {-0.555284, -0.158640, 0.638360},
+    {-0.455826, -0.215130, 0.709292},
+    {-0.342032, -0.270000, 0.759808},
+    {-0.218064, -0.270000, 0.789696},
+    {-0.086800, -0.270000, 0.800000},
+    {-0.457168, -0.270000, 0.711872},
+    {-0.560214, -0.215130, 0.645077},
+    {-0.637547, -0.100710, 0.550747},
+    {-0.646848, -0.158640, 0.560048},
+    {-0.625264, -0.041520, 0.538464},
+    {-0.700558, -0.041520, 0.450429},
+    {-0.714558, -0.100710, 0.460704},
+    {-0.725160, -0.158640, 0.468484},
+    {-0.652741, -0.215130, 0.565941},
+    {-0.561936, -0.270000, 0.647424},
+    {-0.731877, -0.215130, 0.473414},
+    {-0.654800, -0.270000, 0.568000},
+    {-0.777049, -0.100710, 0.359118},
+    {-0.788706, -0.158640, 0.365183},
+    {-0.761655, -0.041520, 0.351109},
+    {-0.683644, 0.018750, 0.438016},
+    {-0.743057, 0.018750, 0.341433},
+    {-0.787248, 0.018750, 0.235292},
+    {-0.807098, -0.041520, 0.241960},
+    {-0.823529, -0.100710, 0.247479},
+    {-0.835971, -0.158640, 0.251659},
+    {-0.796092, -0.215130, 0.369026},
+    {-0.734224, -0.270000, 0.475136},
+    {-0.843854, -0.215130, 0.254307},
+    {-0.798672, -0.270000, 0.370368},
+    {-0.852509, -0.100710, 0.127277},
+    {-0.865440, -0.158640, 0.129426},
+    {-0.835432, -0.041520, 0.124438},
+    {-0.814801, 0.018750, 0.121009},
+    {-0.824300, 0.018750, 0.000000},
+    {-0.845200, -0.041520, 0.000000},
+    {-0.862500, -0.100710, 0.000000},
+    {-0.875600, -0.158640, 0.000000},
+    {-0.873633, -0.215130, 0.130788},
+    {-0.846608, -0.270000, 0.255232},
+    {-0.883900, -0.215130, 0.000000},
+    {-0.876496, -0.270000, 0.131264},
+    {-0.886800, -0.270000, 0.000000},
+    {-0.870968, -0.321330, 0.130345},
+    {-0.841289, -0.321330, 0.253445},
+    {-0.846608, -0.270000, 0.255232},
+    {-0.881200, -0.321330, 0.000000},
+    {-0.876496, -0.270000, -0.131264},
+    {-0.881200, -0.321330, 0.000000},
+    {-0.943240, -0.240480, 0.000000},
+    {-0.885680, -0.273360, -0.032400},
+    {-0.855964, -0.367440, 0.127851},
+    {-0.826853, -0.367440, 0.248596},
+    {-0.793689, -0.321330, 0.367776},
+    {-0.780163, -0.367440, 0.360738},
+    {-0.798672, -0.270000, 0.370368},
+    {-0.729692, -0.321330, 0.471810},
+    {-0.717391, -0.367440, 0.462782},
+    {-0.760231, -0.408510, 0.350368},
+    {-0.699263, -0.408510, 0.449479},
+    {-0.805578, -0.408510, 0.241450},
+    {-0.866000, -0.367440, 0.000000},
+    {-0.833852, -0.408510, 0.124176},
+    {-0.779745, -0.444720, 0.232772},
+    {-0.736027, -0.444720, 0.337776},
+    {-0.677251, -0.444720, 0.433324},
+    {-0.624128, -0.408510, 0.537328},
+    {-0.604816, -0.444720, 0.518016},
+    {-0.640032, -0.367440, 0.553232},
+    {-0.536279, -0.408510, 0.612463},
+    {-0.520124, -0.444720, 0.590451},
+    {-0.583800, -0.476250, 0.497000},
+    {-0.502544, -0.476250, 0.566496},
+    {-0.653296, -0.476250, 0.415744},
+    {-0.709688, -0.476250, 0.324072},
+    {-0.629341, -0.503280, 0.398164},
+    {-0.562784, -0.503280, 0.475984},
+    {-0.484964, -0.503280, 0.542541},
+    {-0.410872, -0.476250, 0.622888},
+    {-0.397168, -0.503280, 0.596549},
+    {-0.424576, -0.444720, 0.649227},
+    {-0.310128, -0.476250, 0.664832},
+    {-0.300684, -0.503280, 0.636719},
+    {-0.384576, -0.525990, 0.572345},
+    {-0.292006, -0.525990, 0.610886},
+    {-0.468809, -0.525990, 0.520529},
+    {-0.543472, -0.525990, 0.456672},
+    {-0.455506, -0.544560, 0.502401},
+    {-0.374206, -0.544560, 0.552413},
+    {-0.284860, -0.544560, 0.589611},
+    {-0.192336, -0.525990, 0.634916},
+    {-0.188661, -0.544560, 0.612804},
+    {-0.196799, -0.503280, 0.661765},
+    {-0.086800, -0.525990, 0.643200},
+    {-0.086800, -0.544560, 0.620800},
+    {-0.186167, -0.559170, 0.597800},
+    {-0.086800, -0.559170, 0.605600},
+    {-0.280011, -0.559170, 0.575175},
+    {-0.367168, -0.559170, 0.538887},
+    {-0.278224, -0.570000, 0.569856},
+    {-0.185248, -0.570000, 0.592272},
+    {-0.086800, -0.570000, 0.600000},
+    {-0.086800, -0.578970, 0.598590},
+    {0.011417, -0.578970, 0.590880},
+    {0.011648, -0.570000, 0.592272},
+    {-0.086800, -0.578970, 0.598590},
+    {-0.185248, -0.570000, 0.592272},
+    {-0.086800, -0.587760, 0.592320},
+    {0.010388, -0.587760, 0.584691},
+    {0.102174, -0.587760, 0.562562},
+    {0.104174, -0.578970, 0.568517},
+    {0.104624, -0.570000, 0.569856},
+    {0.187420, -0.587760, 0.527070},
+    {0.190323, -0.578970, 0.532649},
+    {0.097646, -0.596190, 0.549085},
+    {0.180851, -0.596190, 0.514443},
+    {0.008060, -0.596190, 0.570684},
+    {-0.086800, -0.596190, 0.578130},
+    {0.003930, -0.604080, 0.545838},
+    {0.089616, -0.604080, 0.525179},
+    {0.169198, -0.604080, 0.492046},
+    {0.241614, -0.604080, 0.447500},
+    {0.256563, -0.596190, 0.467869},
+    {0.264991, -0.587760, 0.479353},
+    {0.305802, -0.604080, 0.392602},
+    {0.323672, -0.596190, 0.410472},
+    {0.218326, -0.611250, 0.415768},
+    {0.277962, -0.611250, 0.364762},
+    {0.151046, -0.611250, 0.457155},
+    {0.077107, -0.611250, 0.487939},
+    {0.124976, -0.617520, 0.407048},
+    {0.184883, -0.617520, 0.370197},
+    {0.237982, -0.617520, 0.324782},
+    {0.283397, -0.617520, 0.271683},
+    {0.328968, -0.611250, 0.305126},
+    {0.360700, -0.604080, 0.328414},
+    {0.320248, -0.617520, 0.211776},
+    {0.370355, -0.611250, 0.237846},
+    {0.221512, -0.622710, 0.226266},
+    {0.252202, -0.622710, 0.176374},
+    {0.183689, -0.622710, 0.270489},
+    {0.139466, -0.622710, 0.308312},
+    {0.112909, -0.626640, 0.199709},
+    {0.140834, -0.626640, 0.167058},
+    {0.163494, -0.626640, 0.130221},
+    {0.180348, -0.626640, 0.089740},
+    {0.275030, -0.622710, 0.121545},
+    {0.347658, -0.617520, 0.145942},
+    {0.190857, -0.626640, 0.046152},
+    {0.289263, -0.622710, 0.062510},
+    {0.060707, -0.629130, 0.049550},
+    {0.066510, -0.629130, 0.025483},
+    {0.051401, -0.629130, 0.071902},
+    {0.038889, -0.629130, 0.092242},
+    {-0.086800, -0.630000, 0.000000},
+    {0.068510, -0.629130, 0.000000},
+    {0.194480, -0.626640, 0.000000},
+    {0.294170, -0.622710, 0.000000},
+    {0.364748, -0.617520, 0.075057},
+    {0.401139, -0.611250, 0.163907},
+    {0.370640, -0.617520, 0.000000},
+    {0.420333, -0.611250, 0.084296},
+    {0.438379, -0.604080, 0.176416},
+    {0.405246, -0.604080, 0.255998},
+    {0.427643, -0.596190, 0.267651},
+    {0.381069, -0.596190, 0.343363},
+    {0.459038, -0.604080, 0.090730},
+    {0.462285, -0.596190, 0.184446},
+    {0.426950, -0.611250, 0.000000},
+    {0.466160, -0.604080, 0.000000},
+    {0.483884, -0.596190, 0.094860},
+    {0.475762, -0.587760, 0.188974},
+    {0.440270, -0.587760, 0.274220},
+    {0.392553, -0.587760, 0.351791},
+    {0.333747, -0.587760, 0.420547},
+    {0.397627, -0.578970, 0.355514},
+    {0.338199, -0.578970, 0.424999},
+    {0.445849, -0.578970, 0.277123},
+    {0.497891, -0.587760, 0.097188},
+    {0.481717, -0.578970, 0.190974},
+    {0.491330, -0.596190, 0.000000},
+    {0.505520, -0.587760, 0.000000},
+    {0.504080, -0.578970, 0.098217},
+    {0.483056, -0.570000, 0.191424},
+    {0.447104, -0.570000, 0.277776},
+    {0.398768, -0.570000, 0.356352},
+    {0.339200, -0.570000, 0.426000},
+    {0.343176, -0.559170, 0.429976},
+    {0.272878, -0.559170, 0.490100},
+    {0.269552, -0.570000, 0.485568},
+    {0.398768, -0.570000, 0.356352},
+    {0.269552, -0.570000, 0.485568},
+    {0.353968, -0.544560, 0.440768},
+    {0.281906, -0.544560, 0.502401},
+    {0.403300, -0.559170, 0.359678},
+    {0.200606, -0.544560, 0.552413},
+    {0.193568, -0.559170, 0.538887},
+    {0.190976, -0.570000, 0.533904},
+    {0.111260, -0.544560, 0.589611},
+    {0.106411, -0.559170, 0.575175},
+    {0.210976, -0.525990, 0.572345},
+    {0.118406, -0.525990, 0.610886},
+    {0.295209, -0.525990, 0.520529},
+    {0.223568, -0.503280, 0.596549},
+    {0.127084, -0.503280, 0.636719},
+    {0.023199, -0.503280, 0.661765},
+    {0.018736, -0.525990, 0.634916},
+    {0.015061, -0.544560, 0.612804},
+    {0.012567, -0.559170, 0.597800},
+    {0.104624, -0.570000, 0.569856},
+    {-0.086800, -0.525990, 0.643200},
+    {-0.086800, -0.544560, 0.620800},
+    {-0.086800, -0.503280, 0.670400},
+    {0.028056, -0.476250, 0.690984},
+    {-0.086800, -0.476250, 0.700000},
+    {0.136528, -0.476250, 0.664832},
+    {0.032913, -0.444720, 0.720203},
+    {-0.086800, -0.444720, 0.729600},
+    {0.145972, -0.444720, 0.692945},
+    {0.237272, -0.476250, 0.622888},
+    {0.037376, -0.408510, 0.747052},
+    {-0.086800, -0.408510, 0.756800},
+    {0.154650, -0.408510, 0.718778},
+    {0.250976, -0.444720, 0.649227},
+    {0.328944, -0.476250, 0.566496},
+    {0.311364, -0.503280, 0.542541},
+    {0.389184, -0.503280, 0.475984},
+    {0.369872, -0.525990, 0.456672},
+    {0.346524, -0.444720, 0.590451},
+    {0.410200, -0.476250, 0.497000},
+    {0.263568, -0.408510, 0.673431},
+    {0.161796, -0.367440, 0.740053},
+    {0.041051, -0.367440, 0.769164},
+    {0.273938, -0.367440, 0.693363},
+    {0.362679, -0.408510, 0.612463},
+    {0.431216, -0.444720, 0.518016},
+    {0.479696, -0.476250, 0.415744},
+    {0.455741, -0.503280, 0.398164},
+    {0.433729, -0.525990, 0.382009},
+    {0.509749, -0.503280, 0.310368},
+    {0.485545, -0.525990, 0.297776},
+    {0.503651, -0.444720, 0.433324},
+    {0.536088, -0.476250, 0.324072},
+    {0.450528, -0.408510, 0.537328},
+    {0.375982, -0.367440, 0.630591},
+    {0.466432, -0.367440, 0.553232},
+    {0.525663, -0.408510, 0.449479},
+    {0.562427, -0.444720, 0.337776},
+    {0.578032, -0.476250, 0.223328},
+    {0.549919, -0.503280, 0.213884},
+    {0.524086, -0.525990, 0.205206},
+    {0.574965, -0.503280, 0.109999},
+    {0.548116, -0.525990, 0.105536},
+    {0.606145, -0.444720, 0.232772},
+    {0.604184, -0.476250, 0.114856},
+    {0.586631, -0.408510, 0.350368},
+    {0.543791, -0.367440, 0.462782},
+    {0.606563, -0.367440, 0.360738},
+    {0.631978, -0.408510, 0.241450},
+    {0.633403, -0.444720, 0.119713},
+    {0.613200, -0.476250, 0.000000},
+    {0.583600, -0.503280, 0.000000},
+    {0.556400, -0.525990, 0.000000},
+    {0.534000, -0.544560, 0.000000},
+    {0.526004, -0.544560, 0.101861},
+    {0.518800, -0.559170, -0.000000},
+    {0.502811, -0.544560, 0.198060},
+    {0.511000, -0.559170, 0.099367},
+    {0.513200, -0.570000, 0.000000},
+    {0.488375, -0.559170, 0.193211},
+    {0.505472, -0.570000, 0.098448},
+    {0.465613, -0.544560, 0.287406},
+    {0.452087, -0.559170, 0.280368},
+    {0.483056, -0.570000, 0.191424},
+    {0.415601, -0.544560, 0.368706},
+    {0.447104, -0.570000, 0.277776},
+    {0.511790, -0.578970, 0.000000},
+    {0.505472, -0.570000, 0.098448},
+    {0.511790, -0.578970, 0.000000},
+    {0.504080, -0.578970, -0.098217},
+    {0.505472, -0.570000, -0.098448},
+    {0.481717, -0.578970, -0.190974},
+    {0.483056, -0.570000, -0.191424},
+    {0.497891, -0.587760, -0.097188},
+    {0.475762, -0.587760, -0.188974},
+    {0.505520, -0.587760, 0.000000},
+    {0.483884, -0.596190, -0.094860},
+    {0.462285, -0.596190, -0.184446},
+    {0.427643, -0.596190, -0.267651},
+    {0.440270, -0.587760, -0.274220},
+    {0.445849, -0.578970, -0.277123},
+    {0.447104, -0.570000, -0.277776},
+    {0.392553, -0.587760, -0.351791},
+    {0.397627, -0.578970, -0.355514},
+    {0.381069, -0.596190, -0.343363},
+    {0.405246, -0.604080, -0.255998},
+    {0.360700, -0.604080, -0.328414},
+    {0.438379, -0.604080, -0.176416},
+    {0.370355, -0.611250, -0.237846},
+    {0.328968, -0.611250, -0.305126},
+    {0.277962, -0.611250, -0.364762},
+    {0.305802, -0.604080, -0.392602},
+    {0.323672, -0.596190, -0.410472},
+    {0.333747, -0.587760, -0.420547},
+    {0.241614, -0.604080, -0.447500},
+    {0.256563, -0.596190, -0.467869},
+    {0.218326, -0.611250, -0.415768},
+    {0.237982, -0.617520, -0.324782},
+    {0.184883, -0.617520, -0.370197},
+    {0.283397, -0.617520, -0.271683},
+    {0.183689, -0.622710, -0.270489},
+    {0.139466, -0.622710, -0.308312},
+    {0.089574, -0.622710, -0.339002},
+    {0.124976, -0.617520, -0.407048},
+    {0.151046, -0.611250, -0.457155},
+    {0.169198, -0.604080, -0.492046},
+    {0.059142, -0.617520, -0.434458},
+    {0.077107, -0.611250, -0.487939},
+    {0.034745, -0.622710, -0.361830},
+    {0.043421, -0.626640, -0.250294},
+    {0.002940, -0.626640, -0.267148},
+    {0.080258, -0.626640, -0.227634},
+    {-0.014898, -0.629130, -0.138201},
+    {-0.037250, -0.629130, -0.147507},
+    {-0.061317, -0.629130, -0.153310},
+    {-0.040648, -0.626640, -0.277657},
+    {-0.024290, -0.622710, -0.376063},
+    {-0.011743, -0.617520, -0.451548},
+    {-0.086800, -0.626640, -0.281280},
+    {-0.086800, -0.622710, -0.380970},
+    {-0.086800, -0.629130, -0.155310},
+    {0.005442, -0.629130, -0.125689},
+    {0.112909, -0.626640, -0.199709},
+    {0.023470, -0.629130, -0.110270},
+    {0.140834, -0.626640, -0.167058},
+    {0.221512, -0.622710, -0.226266},
+    {0.252202, -0.622710, -0.176374},
+    {0.320248, -0.617520, -0.211776},
+    {0.038889, -0.629130, -0.092242},
+    {0.163494, -0.626640, -0.130221},
+    {0.051401, -0.629130, -0.071902},
+    {0.180348, -0.626640, -0.089740},
+    {0.275030, -0.622710, -0.121545},
+    {0.347658, -0.617520, -0.145942},
+    {0.401139, -0.611250, -0.163907},
+    {0.364748, -0.617520, -0.075057},
+    {0.420333, -0.611250, -0.084296},
+    {0.289263, -0.622710, -0.062510},
+    {0.060707, -0.629130, -0.049550},
+    {0.190857, -0.626640, -0.046152},
+    {0.066510, -0.629130, -0.025483},
+    {0.294170, -0.622710, 0.000000},
+    {0.370640, -0.617520, 0.000000},
+    {0.426950, -0.611250, -0.000000},
+    {0.459038, -0.604080, -0.090730},
+    {0.466160, -0.604080, 0.000000},
+    {0.491330, -0.596190, 0.000000},
+    {0.068510, -0.629130, 0.000000},
+    {0.023470, -0.629130, 0.110270},
+    {0.005442, -0.629130, 0.125689},
+    {-0.014898, -0.629130, 0.138201},
+    {-0.037250, -0.629130, 0.147507},
+    {-0.061317, -0.629130, 0.153310},
+    {-0.086800, -0.629130, 0.155310},
+    {-0.086800, -0.629130, 0.155310},
+    {-0.112283, -0.629130, 0.153310},
+    {-0.136350, -0.629130, 0.147507},
+    {-0.158702, -0.629130, 0.138201},
+    {-0.179042, -0.629130, 0.125689},
+    {-0.197070, -0.629130, 0.110270},
+    {-0.212489, -0.629130, 0.092242},
+    {-0.225001, -0.629130, 0.071902},
+    {-0.234307, -0.629130, 0.049550},
+    {-0.240110, -0.629130, 0.025483},
+    {-0.242110, -0.629130, -0.000000},
+    {-0.242110, -0.629130, 0.000000},
+    {-0.240110, -0.629130, -0.025483},
+    {-0.234307, -0.629130, -0.049550},
+    {-0.225001, -0.629130, -0.071902},
+    {-0.212489, -0.629130, -0.092242},
+    {-0.197070, -0.629130, -0.110270},
+    {-0.179042, -0.629130, -0.125689},
+    {-0.158702, -0.629130, -0.138201},
+    {-0.136350, -0.629130, -0.147507},
+    {-0.112283, -0.629130, -0.153310},
+    {-0.086800, -0.629130, -0.155310},
+    {-0.368080, -0.626640, 0.000000},
+    {-0.364457, -0.626640, 0.046152},
+    {-0.467770, -0.622710, -0.000000},
+    {-0.364457, -0.626640, -0.046152},
+    {-0.462863, -0.622710, -0.062510},
+    {-0.467770, -0.622710, 0.000000},
+    {-0.353948, -0.626640, 0.089740},
+    {-0.462863, -0.622710, 0.062510},
+    {-0.544240, -0.617520, 0.000000},
+    {-0.448630, -0.622710, 0.121545},
+    {-0.538348, -0.617520, 0.075057},
+    {-0.337094, -0.626640, 0.130221},
+    {-0.425802, -0.622710, 0.176374},
+    {-0.521258, -0.617520, 0.145942},
+    {-0.593933, -0.611250, 0.084296},
+    {-0.600550, -0.611250, 0.000000},
+    {-0.493848, -0.617520, 0.211776},
+    {-0.574739, -0.611250, 0.163907},
+    {-0.314434, -0.626640, 0.167058},
+    {-0.395112, -0.622710, 0.226266},
+    {-0.286509, -0.626640, 0.199709},
+    {-0.357289, -0.622710, 0.270489},
+    {-0.456997, -0.617520, 0.271683},
+    {-0.543955, -0.611250, 0.237846},
+    {-0.611979, -0.604080, 0.176416},
+    {-0.632638, -0.604080, 0.090730},
+    {-0.502568, -0.611250, 0.305126},
+    {-0.578846, -0.604080, 0.255998},
+    {-0.411582, -0.617520, 0.324782},
+    {-0.253858, -0.626640, 0.227634},
+    {-0.313066, -0.622710, 0.308312},
+    {-0.217021, -0.626640, 0.250294},
+    {-0.263174, -0.622710, 0.339002},
+    {-0.358483, -0.617520, 0.370197},
+    {-0.451562, -0.611250, 0.364762},
+    {-0.534300, -0.604080, 0.328414},
+    {-0.391926, -0.611250, 0.415768},
+    {-0.479402, -0.604080, 0.392602},
+    {-0.298576, -0.617520, 0.407048},
+    {-0.176540, -0.626640, 0.267148},
+    {-0.208345, -0.622710, 0.361830},
+    {-0.132952, -0.626640, 0.277657},
+    {-0.149310, -0.622710, 0.376063},
+    {-0.232742, -0.617520, 0.434458},
+    {-0.324646, -0.611250, 0.457155},
+    {-0.415214, -0.604080, 0.447500},
+    {-0.250707, -0.611250, 0.487939},
+    {-0.342798, -0.604080, 0.492046},
+    {-0.161857, -0.617520, 0.451548},
+    {-0.086800, -0.626640, 0.281280},
+    {-0.086800, -0.622710, 0.380970},
+    {-0.040648, -0.626640, 0.277657},
+    {-0.086800, -0.622710, 0.380970},
+    {0.002940, -0.626640, 0.267148},
+    {-0.024290, -0.622710, 0.376063},
+    {-0.086800, -0.617520, 0.457440},
+    {0.034745, -0.622710, 0.361830},
+    {-0.011743, -0.617520, 0.451548},
+    {0.043421, -0.626640, 0.250294},
+    {0.089574, -0.622710, 0.339002},
+    {0.059142, -0.617520, 0.434458},
+    {-0.002504, -0.611250, 0.507133},
+    {-0.086800, -0.611250, 0.513750},
+    {0.080258, -0.626640, 0.227634},
+    {-0.086800, -0.604080, 0.552960},
+    {-0.086800, -0.617520, 0.457440},
+    {-0.171096, -0.611250, 0.507133},
+    {-0.086800, -0.611250, 0.513750},
+    {-0.177530, -0.604080, 0.545838},
+    {-0.263216, -0.604080, 0.525179},
+    {-0.086800, -0.604080, 0.552960},
+    {-0.181660, -0.596190, 0.570684},
+    {-0.271246, -0.596190, 0.549085},
+    {-0.354451, -0.596190, 0.514443},
+    {-0.275774, -0.587760, 0.562562},
+    {-0.361020, -0.587760, 0.527070},
+    {-0.086800, -0.596190, 0.578130},
+    {-0.183988, -0.587760, 0.584691},
+    {-0.277774, -0.578970, 0.568517},
+    {-0.363923, -0.578970, 0.532649},
+    {-0.438591, -0.587760, 0.479353},
+    {-0.442314, -0.578970, 0.484427},
+    {-0.430163, -0.596190, 0.467869},
+    {-0.497272, -0.596190, 0.410472},
+    {-0.507347, -0.587760, 0.420547},
+    {-0.511799, -0.578970, 0.424999},
+    {-0.443152, -0.570000, 0.485568},
+    {-0.512800, -0.570000, 0.426000},
+    {-0.364576, -0.570000, 0.533904},
+    {-0.278224, -0.570000, 0.569856},
+    {-0.185017, -0.578970, 0.590880},
+    {-0.086800, -0.587760, 0.592320},
+    {-0.516776, -0.559170, 0.429976},
+    {-0.576900, -0.559170, 0.359678},
+    {-0.572368, -0.570000, 0.356352},
+    {-0.443152, -0.570000, 0.485568},
+    {-0.572368, -0.570000, 0.356352},
+    {-0.527568, -0.544560, 0.440768},
+    {-0.589201, -0.544560, 0.368706},
+    {-0.446478, -0.559170, 0.490100},
+    {-0.639213, -0.544560, 0.287406},
+    {-0.625687, -0.559170, 0.280368},
+    {-0.620704, -0.570000, 0.277776},
+    {-0.676411, -0.544560, 0.198060},
+    {-0.661975, -0.559170, 0.193211},
+    {-0.659145, -0.525990, 0.297776},
+    {-0.697686, -0.525990, 0.205206},
+    {-0.607329, -0.525990, 0.382009},
+    {-0.683349, -0.503280, 0.310368},
+    {-0.723519, -0.503280, 0.213884},
+    {-0.748565, -0.503280, 0.109999},
+    {-0.721716, -0.525990, 0.105536},
+    {-0.699604, -0.544560, 0.101861},
+    {-0.684600, -0.559170, 0.099367},
+    {-0.656656, -0.570000, 0.191424},
+    {-0.730000, -0.525990, 0.000000},
+    {-0.707600, -0.544560, 0.000000},
+    {-0.757200, -0.503280, 0.000000},
+    {-0.777784, -0.476250, 0.114856},
+    {-0.786800, -0.476250, 0.000000},
+    {-0.751632, -0.476250, 0.223328},
+    {-0.807003, -0.444720, 0.119713},
+    {-0.816400, -0.444720, 0.000000},
+    {-0.843600, -0.408510, 0.000000},
+    {-0.364576, -0.570000, 0.533904},
+    {-0.692400, -0.559170, 0.000000},
+    {-0.679072, -0.570000, 0.098448},
+    {-0.686800, -0.570000, 0.000000},
+    {-0.571227, -0.578970, 0.355514},
+    {-0.620704, -0.570000, 0.277776},
+    {-0.566153, -0.587760, 0.351791},
+    {-0.619449, -0.578970, 0.277123},
+    {-0.656656, -0.570000, 0.191424},
+    {-0.613870, -0.587760, 0.274220},
+    {-0.655317, -0.578970, 0.190974},
+    {-0.554669, -0.596190, 0.343363},
+    {-0.601243, -0.596190, 0.267651},
+    {-0.649362, -0.587760, 0.188974},
+    {-0.677680, -0.578970, 0.098217},
+    {-0.679072, -0.570000, 0.098448},
+    {-0.635885, -0.596190, 0.184446},
+    {-0.671491, -0.587760, 0.097188},
+    {-0.657484, -0.596190, 0.094860},
+    {-0.679120, -0.587760, -0.000000},
+    {-0.685390, -0.578970, -0.000000},
+    {-0.686800, -0.570000, 0.000000},
+    {-0.692400, -0.559170, 0.000000},
+    {-0.684600, -0.559170, -0.099367},
+    {-0.679072, -0.570000, -0.098448},
+    {-0.685390, -0.578970, 0.000000},
+    {-0.679072, -0.570000, -0.098448},
+    {-0.707600, -0.544560, 0.000000},
+    {-0.699604, -0.544560, -0.101861},
+    {-0.676411, -0.544560, -0.198060},
+    {-0.661975, -0.559170, -0.193211},
+    {-0.656656, -0.570000, -0.191424},
+    {-0.639213, -0.544560, -0.287406},
+    {-0.625687, -0.559170, -0.280368},
+    {-0.697686, -0.525990, -0.205206},
+    {-0.659145, -0.525990, -0.297776},
+    {-0.721716, -0.525990, -0.105536},
+    {-0.730000, -0.525990, -0.000000},
+    {-0.748565, -0.503280, -0.109999},
+    {-0.723519, -0.503280, -0.213884},
+    {-0.683349, -0.503280, -0.310368},
+    {-0.629341, -0.503280, -0.398164},
+    {-0.607329, -0.525990, -0.382009},
+    {-0.589201, -0.544560, -0.368706},
+    {-0.562784, -0.503280, -0.475984},
+    {-0.543472, -0.525990, -0.456672},
+    {-0.653296, -0.476250, -0.415744},
+    {-0.583800, -0.476250, -0.497000},
+    {-0.709688, -0.476250, -0.324072},
+    {-0.751632, -0.476250, -0.223328},
+    {-0.736027, -0.444720, -0.337776},
+    {-0.677251, -0.444720, -0.433324},
+    {-0.604816, -0.444720, -0.518016},
+    {-0.520124, -0.444720, -0.590451},
+    {-0.502544, -0.476250, -0.566496},
+    {-0.484964, -0.503280, -0.542541},
+    {-0.424576, -0.444720, -0.649227},
+    {-0.410872, -0.476250, -0.622888},
+    {-0.536279, -0.408510, -0.612463},
+    {-0.437168, -0.408510, -0.673431},
+    {-0.624128, -0.408510, -0.537328},
+    {-0.699263, -0.408510, -0.449479},
+    {-0.640032, -0.367440, -0.553232},
+    {-0.549582, -0.367440, -0.630591},
+    {-0.447538, -0.367440, -0.693363},
+    {-0.335396, -0.367440, -0.740053},
+    {-0.328250, -0.408510, -0.718778},
+    {-0.319572, -0.444720, -0.692945},
+    {-0.214651, -0.367440, -0.769164},
+    {-0.210976, -0.408510, -0.747052},
+    {-0.340245, -0.321330, -0.754489},
+    {-0.217145, -0.321330, -0.784168},
+    {-0.454576, -0.321330, -0.706889},
+    {-0.558610, -0.321330, -0.642892},
+    {-0.457168, -0.270000, -0.711872},
+    {-0.342032, -0.270000, -0.759808},
+    {-0.218064, -0.270000, -0.789696},
+    {-0.086800, -0.270000, -0.800000},
+    {-0.086800, -0.321330, -0.794400},
+    {-0.086800, -0.367440, -0.779200},
+    {-0.086800, -0.408510, -0.756800},
+    {-0.206513, -0.444720, -0.720203},
+    {-0.086800, -0.444720, -0.729600},
+    {-0.201656, -0.476250, -0.690984},
+    {-0.310128, -0.476250, -0.664832},
+    {-0.086800, -0.476250, -0.700000},
+    {-0.196799, -0.503280, -0.661765},
+    {-0.300684, -0.503280, -0.636719},
+    {-0.397168, -0.503280, -0.596549},
+    {-0.292006, -0.525990, -0.610886},
+    {-0.384576, -0.525990, -0.572345},
+    {-0.086800, -0.503280, -0.670400},
+    {-0.192336, -0.525990, -0.634916},
+    {-0.284860, -0.544560, -0.589611},
+    {-0.374206, -0.544560, -0.552413},
+    {-0.468809, -0.525990, -0.520529},
+    {-0.455506, -0.544560, -0.502401},
+    {-0.527568, -0.544560, -0.440768},
+    {-0.446478, -0.559170, -0.490100},
+    {-0.516776, -0.559170, -0.429976},
+    {-0.367168, -0.559170, -0.538887},
+    {-0.188661, -0.544560, -0.612804},
+    {-0.280011, -0.559170, -0.575175},
+    {-0.364576, -0.570000, -0.533904},
+    {-0.443152, -0.570000, -0.485568},
+    {-0.512800, -0.570000, -0.426000},
+    {-0.576900, -0.559170, -0.359678},
+    {-0.572368, -0.570000, -0.356352},
+    {-0.620704, -0.570000, -0.277776},
+    {-0.511799, -0.578970, -0.424999},
+    {-0.571227, -0.578970, -0.355514},
+    {-0.572368, -0.570000, -0.356352},
+    {-0.443152, -0.570000, -0.485568},
+    {-0.507347, -0.587760, -0.420547},
+    {-0.566153, -0.587760, -0.351791},
+    {-0.442314, -0.578970, -0.484427},
+    {-0.613870, -0.587760, -0.274220},
+    {-0.619449, -0.578970, -0.277123},
+    {-0.620704, -0.570000, -0.277776},
+    {-0.649362, -0.587760, -0.188974},
+    {-0.655317, -0.578970, -0.190974},
+    {-0.601243, -0.596190, -0.267651},
+    {-0.635885, -0.596190, -0.184446},
+    {-0.554669, -0.596190, -0.343363},
+    {-0.578846, -0.604080, -0.255998},
+    {-0.611979, -0.604080, -0.176416},
+    {-0.632638, -0.604080, -0.090730},
+    {-0.657484, -0.596190, -0.094860},
+    {-0.671491, -0.587760, -0.097188},
+    {-0.677680, -0.578970, -0.098217},
+    {-0.656656, -0.570000, -0.191424},
+    {-0.664930, -0.596190, 0.000000},
+    {-0.679120, -0.587760, 0.000000},
+    {-0.639760, -0.604080, 0.000000},
+    {-0.593933, -0.611250, -0.084296},
+    {-0.600550, -0.611250, 0.000000},
+    {-0.574739, -0.611250, -0.163907},
+    {-0.538348, -0.617520, -0.075057},
+    {-0.544240, -0.617520, 0.000000},
+    {-0.521258, -0.617520, -0.145942},
+    {-0.543955, -0.611250, -0.237846},
+    {-0.448630, -0.622710, -0.121545},
+    {-0.493848, -0.617520, -0.211776},
+    {-0.502568, -0.611250, -0.305126},
+    {-0.534300, -0.604080, -0.328414},
+    {-0.479402, -0.604080, -0.392602},
+    {-0.497272, -0.596190, -0.410472},
+    {-0.456997, -0.617520, -0.271683},
+    {-0.451562, -0.611250, -0.364762},
+    {-0.425802, -0.622710, -0.176374},
+    {-0.353948, -0.626640, -0.089740},
+    {-0.337094, -0.626640, -0.130221},
+    {-0.395112, -0.622710, -0.226266},
+    {-0.411582, -0.617520, -0.324782},
+    {-0.391926, -0.611250, -0.415768},
+    {-0.415214, -0.604080, -0.447500},
+    {-0.430163, -0.596190, -0.467869},
+    {-0.342798, -0.604080, -0.492046},
+    {-0.354451, -0.596190, -0.514443},
+    {-0.358483, -0.617520, -0.370197},
+    {-0.324646, -0.611250, -0.457155},
+    {-0.357289, -0.622710, -0.270489},
+    {-0.314434, -0.626640, -0.167058},
+    {-0.286509, -0.626640, -0.199709},
+    {-0.313066, -0.622710, -0.308312},
+    {-0.298576, -0.617520, -0.407048},
+    {-0.250707, -0.611250, -0.487939},
+    {-0.263216, -0.604080, -0.525179},
+    {-0.271246, -0.596190, -0.549085},
+    {-0.177530, -0.604080, -0.545838},
+    {-0.181660, -0.596190, -0.570684},
+    {-0.232742, -0.617520, -0.434458},
+    {-0.171096, -0.611250, -0.507133},
+    {-0.263174, -0.622710, -0.339002},
+    {-0.253858, -0.626640, -0.227634},
+    {-0.217021, -0.626640, -0.250294},
+    {-0.208345, -0.622710, -0.361830},
+    {-0.161857, -0.617520, -0.451548},
+    {-0.086800, -0.611250, -0.513750},
+    {-0.086800, -0.604080, -0.552960},
+    {-0.086800, -0.596190, -0.578130},
+    {-0.086800, -0.587760, -0.592320},
+    {-0.183988, -0.587760, -0.584691},
+    {-0.086800, -0.578970, -0.598590},
+    {-0.275774, -0.587760, -0.562562},
+    {-0.185017, -0.578970, -0.590880},
+    {-0.086800, -0.570000, -0.600000},
+    {-0.277774, -0.578970, -0.568517},
+    {-0.185248, -0.570000, -0.592272},
+    {-0.361020, -0.587760, -0.527070},
+    {-0.363923, -0.578970, -0.532649},
+    {-0.278224, -0.570000, -0.569856},
+    {-0.438591, -0.587760, -0.479353},
+    {-0.364576, -0.570000, -0.533904},
+    {-0.086800, -0.559170, -0.605600},
+    {0.012567, -0.559170, -0.597800},
+    {0.011648, -0.570000, -0.592272},
+    {-0.086800, -0.578970, -0.598590},
+    {0.011648, -0.570000, -0.592272},
+    {-0.086800, -0.544560, -0.620800},
+    {0.015061, -0.544560, -0.612804},
+    {0.111260, -0.544560, -0.589611},
+    {0.106411, -0.559170, -0.575175},
+    {0.104624, -0.570000, -0.569856},
+    {0.200606, -0.544560, -0.552413},
+    {0.193568, -0.559170, -0.538887},
+    {0.118406, -0.525990, -0.610886},
+    {0.210976, -0.525990, -0.572345},
+    {0.018736, -0.525990, -0.634916},
+    {-0.086800, -0.525990, -0.643200},
+    {0.023199, -0.503280, -0.661765},
+    {0.127084, -0.503280, -0.636719},
+    {0.223568, -0.503280, -0.596549},
+    {0.311364, -0.503280, -0.542541},
+    {0.295209, -0.525990, -0.520529},
+    {0.281906, -0.544560, -0.502401},
+    {0.389184, -0.503280, -0.475984},
+    {0.369872, -0.525990, -0.456672},
+    {0.328944, -0.476250, -0.566496},
+    {0.410200, -0.476250, -0.497000},
+    {0.237272, -0.476250, -0.622888},
+    {0.136528, -0.476250, -0.664832},
+    {0.250976, -0.444720, -0.649227},
+    {0.346524, -0.444720, -0.590451},
+    {0.431216, -0.444720, -0.518016},
+    {0.503651, -0.444720, -0.433324},
+    {0.479696, -0.476250, -0.415744},
+    {0.455741, -0.503280, -0.398164},
+    {0.562427, -0.444720, -0.337776},
+    {0.536088, -0.476250, -0.324072},
+    {0.525663, -0.408510, -0.449479},
+    {0.586631, -0.408510, -0.350368},
+    {0.450528, -0.408510, -0.537328},
+    {0.362679, -0.408510, -0.612463},
+    {0.466432, -0.367440, -0.553232},
+    {0.543791, -0.367440, -0.462782},
+    {0.606563, -0.367440, -0.360738},
+    {0.653253, -0.367440, -0.248596},
+    {0.631978, -0.408510, -0.241450},
+    {0.606145, -0.444720, -0.232772},
+    {0.682364, -0.367440, -0.127851},
+    {0.660252, -0.408510, -0.124176},
+    {0.667689, -0.321330, -0.253445},
+    {0.697368, -0.321330, -0.130345},
+    {0.620089, -0.321330, -0.367776},
+    {0.556092, -0.321330, -0.471810},
+    {0.625072, -0.270000, -0.370368},
+    {0.673008, -0.270000, -0.255232},
+    {0.702896, -0.270000, -0.131264},
+    {0.713200, -0.270000, 0.000000},
+    {0.707600, -0.321330, 0.000000},
+    {0.692400, -0.367440, 0.000000},
+    {0.670000, -0.408510, 0.000000},
+    {0.633403, -0.444720, -0.119713},
+    {0.642800, -0.444720, 0.000000},
+    {0.604184, -0.476250, -0.114856},
+    {0.578032, -0.476250, -0.223328},
+    {0.613200, -0.476250, 0.000000},
+    {0.574965, -0.503280, -0.109999},
+    {0.549919, -0.503280, -0.213884},
+    {0.509749, -0.503280, -0.310368},
+    {0.524086, -0.525990, -0.205206},
+    {0.485545, -0.525990, -0.297776},
+    {0.583600, -0.503280, 0.000000},
+    {0.548116, -0.525990, -0.105536},
+    {0.502811, -0.544560, -0.198060},
+    {0.465613, -0.544560, -0.287406},
+    {0.433729, -0.525990, -0.382009},
+    {0.415601, -0.544560, -0.368706},
+    {0.353968, -0.544560, -0.440768},
+    {0.403300, -0.559170, -0.359678},
+    {0.343176, -0.559170, -0.429976},
+    {0.452087, -0.559170, -0.280368},
+    {0.526004, -0.544560, -0.101861},
+    {0.488375, -0.559170, -0.193211},
+    {0.447104, -0.570000, -0.277776},
+    {0.398768, -0.570000, -0.356352},
+    {0.339200, -0.570000, -0.426000},
+    {0.272878, -0.559170, -0.490100},
+    {0.269552, -0.570000, -0.485568},
+    {0.190976, -0.570000, -0.533904},
+    {0.338199, -0.578970, -0.424999},
+    {0.268714, -0.578970, -0.484427},
+    {0.269552, -0.570000, -0.485568},
+    {0.398768, -0.570000, -0.356352},
+    {0.264991, -0.587760, -0.479353},
+    {0.187420, -0.587760, -0.527070},
+    {0.190323, -0.578970, -0.532649},
+    {0.190976, -0.570000, -0.533904},
+    {0.102174, -0.587760, -0.562562},
+    {0.104174, -0.578970, -0.568517},
+    {0.180851, -0.596190, -0.514443},
+    {0.097646, -0.596190, -0.549085},
+    {0.089616, -0.604080, -0.525179},
+    {0.003930, -0.604080, -0.545838},
+    {0.008060, -0.596190, -0.570684},
+    {0.010388, -0.587760, -0.584691},
+    {0.011417, -0.578970, -0.590880},
+    {0.104624, -0.570000, -0.569856},
+    {-0.086800, -0.596190, -0.578130},
+    {-0.086800, -0.587760, -0.592320},
+    {-0.086800, -0.604080, -0.552960},
+    {-0.002504, -0.611250, -0.507133},
+    {-0.086800, -0.611250, -0.513750},
+    {-0.086800, -0.617520, -0.457440},
+    {0.483056, -0.570000, -0.191424},
+    {0.511000, -0.559170, -0.099367},
+    {0.505472, -0.570000, -0.098448},
+    {0.534000, -0.544560, 0.000000},
+    {0.518800, -0.559170, 0.000000},
+    {0.556400, -0.525990, 0.000000},
+    {0.513200, -0.570000, 0.000000},
+    {0.710300, -0.215130, 0.000000},
+    {0.707600, -0.321330, -0.000000},
+    {0.702896, -0.270000, 0.131264},
+    {0.702000, -0.158640, 0.000000},
+    {0.700033, -0.215130, -0.130788},
+    {0.673008, -0.270000, -0.255232},
+    {0.691840, -0.158640, -0.129426},
+    {0.670254, -0.215130, -0.254307},
+    {0.688900, -0.100710, 0.000000},
+    {0.678909, -0.100710, -0.127277},
+    {0.662371, -0.158640, -0.251659},
+    {0.622492, -0.215130, -0.369026},
+    {0.625072, -0.270000, -0.370368},
+    {0.649929, -0.100710, -0.247479},
+    {0.615106, -0.158640, -0.365183},
+    {0.661832, -0.041520, -0.124438},
+    {0.671600, -0.041520, 0.000000},
+    {0.633498, -0.041520, -0.241960},
+    {0.603449, -0.100710, -0.359118},
+    {0.551560, -0.158640, -0.468484},
+    {0.558277, -0.215130, -0.473414},
+    {0.560624, -0.270000, -0.475136},
+    {0.479141, -0.215130, -0.565941},
+    {0.481200, -0.270000, -0.568000},
+    {0.540958, -0.100710, -0.460704},
+    {0.473248, -0.158640, -0.560048},
+    {0.588055, -0.041520, -0.351109},
+    {0.613648, 0.018750, -0.235292},
+    {0.641201, 0.018750, -0.121009},
+    {0.569457, 0.018750, -0.341433},
+    {0.526958, -0.041520, -0.450429},
+    {0.463947, -0.100710, -0.550747},
+    {0.381684, -0.158640, -0.638360},
+    {0.386614, -0.215130, -0.645077},
+    {0.388336, -0.270000, -0.647424},
+    {0.282226, -0.215130, -0.709292},
+    {0.283568, -0.270000, -0.711872},
+    {0.373904, -0.100710, -0.627758},
+    {0.278383, -0.158640, -0.701906},
+    {0.451664, -0.041520, -0.538464},
+    {0.510044, 0.018750, -0.438016},
+    {0.436825, 0.018750, -0.523625},
+    {0.363629, -0.041520, -0.613758},
+    {0.272318, -0.100710, -0.690249},
+    {0.164859, -0.158640, -0.749171},
+    {0.167507, -0.215130, -0.757054},
+    {0.168432, -0.270000, -0.759808},
+    {0.043988, -0.215130, -0.786833},
+    {0.044464, -0.270000, -0.789696},
+    {0.160679, -0.100710, -0.736729},
+    {0.042626, -0.158640, -0.778640},
+    {0.264309, -0.041520, -0.674855},
+    {0.351216, 0.018750, -0.596844},
+    {0.254633, 0.018750, -0.656257},
+    {0.155160, -0.041520, -0.720298},
+    {0.040477, -0.100710, -0.765709},
+    {-0.086800, -0.158640, -0.788800},
+    {-0.086800, -0.215130, -0.797100},
+    {-0.086800, -0.270000, -0.800000},
+    {-0.086800, -0.100710, -0.775700},
+    {0.037638, -0.041520, -0.748632},
+    {0.148492, 0.018750, -0.700448},
+    {0.243568, 0.079920, -0.634990},
+    {0.337021, 0.079920, -0.577502},
+    {0.419856, 0.079920, -0.506656},
+    {0.321401, 0.141810, -0.556218},
+    {0.401183, 0.141810, -0.487983},
+    {0.231392, 0.141810, -0.611587},
+    {0.140867, 0.079920, -0.677749},
+    {0.034209, 0.018750, -0.728001},
+    {-0.086800, -0.041520, -0.758400},
+    {0.030288, 0.079920, -0.704409},
+    {-0.086800, 0.018750, -0.737500},
+    {0.132476, 0.141810, -0.652770},
+    {0.218383, 0.204240, -0.586582},
+    {0.304712, 0.204240, -0.533477},
+    {0.381232, 0.204240, -0.468032},
+    {0.287310, 0.267030, -0.509766},
+    {0.360429, 0.267030, -0.447229},
+    {0.204818, 0.267030, -0.560510},
+    {0.123511, 0.204240, -0.626082},
+    {0.025972, 0.141810, -0.678448},
+    {-0.086800, 0.079920, -0.713600},
+    {0.021362, 0.204240, -0.650710},
+    {-0.086800, 0.141810, -0.687300},
+    {0.114163, 0.267030, -0.598254},
+    {0.269552, 0.330000, -0.485568},
+    {0.339200, 0.330000, -0.426000},
+    {0.333612, 0.344175, -0.420412},
+    {0.016554, 0.267030, -0.621787},
+    {-0.086800, 0.204240, -0.659200},
+    {-0.086800, 0.267030, -0.629900},
+    {0.385690, 0.355200, -0.346754},
+    {0.392399, 0.344175, -0.351678},
+    {0.398768, 0.330000, -0.356352},
+    {0.432724, 0.355200, -0.270294},
+    {0.440101, 0.344175, -0.274132},
+    {0.425401, 0.363075, -0.266484},
+    {0.459891, 0.363075, -0.183643},
+    {0.467708, 0.355200, -0.186268},
+    {0.475581, 0.344175, -0.188913},
+    {0.447104, 0.330000, -0.277776},
+    {0.422966, 0.267030, -0.374110},
+    {0.473710, 0.267030, -0.291618},
+    {0.446677, 0.204240, -0.391512},
+    {0.483056, 0.330000, -0.191424},
+    {0.489520, 0.355200, -0.095796},
+    {0.497703, 0.344175, -0.097157},
+    {0.481396, 0.363075, -0.094446},
+    {0.488810, 0.363075, 0.000000},
+    {0.497040, 0.355200, 0.000000},
+    {0.505330, 0.344175, 0.000000},
+    {0.505472, 0.330000, -0.098448},
+    {0.511454, 0.267030, -0.200963},
+    {0.499782, 0.204240, -0.305183},
+    {0.534987, 0.267030, -0.103354},
+    {0.539282, 0.204240, -0.210311},
+    {0.513200, 0.330000, 0.000000},
+    {0.543100, 0.267030, 0.000000},
+    {0.563910, 0.204240, -0.108162},
+    {0.565970, 0.141810, -0.219276},
+    {0.524787, 0.141810, -0.318192},
+    {0.469418, 0.141810, -0.408201},
+    {0.548190, 0.079920, -0.330368},
+    {0.490702, 0.079920, -0.423821},
+    {0.591648, 0.141810, -0.112772},
+    {0.590949, 0.079920, -0.227667},
+    {0.572400, 0.204240, 0.000000},
+    {0.600500, 0.141810, 0.000000},
+    {0.617609, 0.079920, -0.117088},
+    {0.626800, 0.079920, 0.000000},
+    {0.650700, 0.018750, 0.000000},
+    {0.481120, 0.367800, 0.000000},
+    {0.481120, 0.367800, -0.000000},
+    {0.473805, 0.367800, 0.093184},
+    {0.481396, 0.363075, 0.094446},
+    {0.497040, 0.355200, -0.000000},
+    {0.474450, 0.369375, 0.000000},
+    {0.473805, 0.367800, -0.093184},
+    {0.467221, 0.369375, -0.092090},
+    {0.452588, 0.367800, -0.181189},
+    {0.469280, 0.367800, 0.000000},
+    {0.466090, 0.363075, 0.000000},
+    {0.452588, 0.367800, 0.181189},
+    {0.459891, 0.363075, 0.183643},
+    {0.489520, 0.355200, 0.095796},
+    {0.467221, 0.369375, 0.092090},
+    {0.446253, 0.369375, 0.179061},
+    {0.412623, 0.369375, 0.259836},
+    {0.418558, 0.367800, 0.262924},
+    {0.425401, 0.363075, 0.266484},
+    {0.467708, 0.355200, 0.186268},
+    {0.497703, 0.344175, 0.097157},
+    {0.505330, 0.344175, -0.000000},
+    {0.432724, 0.355200, 0.270294},
+    {0.475581, 0.344175, 0.188913},
+    {0.372806, 0.367800, 0.337299},
+    {0.379030, 0.363075, 0.341866},
+    {0.367408, 0.369375, 0.333338},
+    {0.311688, 0.369375, 0.398488},
+    {0.316423, 0.367800, 0.403223},
+    {0.321883, 0.363075, 0.408683},
+    {0.385690, 0.355200, 0.346754},
+    {0.440101, 0.344175, 0.274132},
+    {0.483056, 0.330000, 0.191424},
+    {0.505472, 0.330000, 0.098448},
+    {0.392399, 0.344175, 0.351678},
+    {0.447104, 0.330000, 0.277776},
+    {0.327726, 0.355200, 0.414526},
+    {0.250499, 0.367800, 0.459606},
+    {0.255066, 0.363075, 0.465830},
+    {0.246538, 0.369375, 0.454208},
+    {0.173036, 0.369375, 0.499423},
+    {0.176124, 0.367800, 0.505358},
+    {0.179684, 0.363075, 0.512201},
+    {0.259954, 0.355200, 0.472490},
+    {0.333612, 0.344175, 0.420412},
+    {0.398768, 0.330000, 0.356352},
+    {0.264878, 0.344175, 0.479199},
+    {0.339200, 0.330000, 0.426000},
+    {0.183494, 0.355200, 0.519524},
+    {0.094389, 0.367800, 0.539388},
+    {0.096843, 0.363075, 0.546691},
+    {0.092261, 0.369375, 0.533053},
+    {0.005290, 0.369375, 0.554021},
+    {0.006384, 0.367800, 0.560605},
+    {0.007646, 0.363075, 0.568196},
+    {0.099468, 0.355200, 0.554508},
+    {0.187332, 0.344175, 0.526901},
+    {0.269552, 0.330000, 0.485568},
+    {0.102113, 0.344175, 0.562381},
+    {0.190976, 0.330000, 0.533904},
+    {0.008996, 0.355200, 0.576320},
+    {-0.086800, 0.367800, 0.567920},
+    {-0.086800, 0.363075, 0.575610},
+    {-0.086800, 0.369375, 0.561250},
+    {-0.086800, 0.367800, 0.556080},
+    {-0.086800, 0.363075, 0.552890},
+    {0.004442, 0.367800, 0.548918},
+    {-0.086800, 0.355200, 0.552160},
+    {0.003918, 0.363075, 0.545769},
+    {0.090612, 0.367800, 0.528142},
+    {0.003798, 0.355200, 0.545048},
+    {0.089594, 0.363075, 0.525113},
+    {-0.086800, 0.344175, 0.554370},
+    {0.004161, 0.344175, 0.547230},
+    {0.089361, 0.355200, 0.524420},
+    {0.169166, 0.363075, 0.491984},
+    {0.170643, 0.367800, 0.494822},
+    {0.243467, 0.367800, 0.450024},
+    {0.168828, 0.355200, 0.491334},
+    {0.241572, 0.363075, 0.447443},
+    {0.090066, 0.344175, 0.526518},
+    {0.005085, 0.330000, 0.552787},
+    {-0.086800, 0.330000, 0.560000},
+    {0.091862, 0.330000, 0.531866},
+    {0.169851, 0.344175, 0.493301},
+    {0.241139, 0.355200, 0.446852},
+    {0.305752, 0.363075, 0.392552},
+    {0.308017, 0.367800, 0.394817},
+    {0.363224, 0.367800, 0.330267},
+    {0.305234, 0.355200, 0.392034},
+    {0.360643, 0.363075, 0.328372},
+    {0.242452, 0.344175, 0.448640},
+    {0.172458, 0.330000, 0.498310},
+    {0.245795, 0.330000, 0.453197},
+    {0.306803, 0.344175, 0.393603},
+    {0.360052, 0.355200, 0.327939},
+    {0.405184, 0.363075, 0.255966},
+    {0.408022, 0.367800, 0.257443},
+    {0.441342, 0.367800, 0.177412},
+    {0.404534, 0.355200, 0.255628},
+    {0.438313, 0.363075, 0.176394},
+    {0.361840, 0.344175, 0.329252},
+    {0.310800, 0.330000, 0.397600},
+    {0.366397, 0.330000, 0.332595},
+    {0.406501, 0.344175, 0.256651},
+    {0.437620, 0.355200, 0.176161},
+    {0.458969, 0.363075, 0.090718},
+    {0.462118, 0.367800, 0.091242},
+    {0.469280, 0.367800, -0.000000},
+    {0.474450, 0.369375, 0.000000},
+    {0.458248, 0.355200, 0.090598},
+    {0.466090, 0.363075, 0.000000},
+    {0.439718, 0.344175, 0.176866},
+    {0.411510, 0.330000, 0.259258},
+    {0.445066, 0.330000, 0.178662},
+    {0.460430, 0.344175, 0.090961},
+    {0.465360, 0.355200, -0.000000},
+    {0.465987, 0.330000, 0.091885},
+    {0.467570, 0.344175, -0.000000},
+    {0.473200, 0.330000, 0.000000},
+    {-0.086800, 0.367800, 0.567920},
+    {-0.179984, 0.367800, 0.560605},
+    {-0.181246, 0.363075, 0.568196},
+    {-0.086800, 0.355200, 0.583840},
+    {-0.086800, 0.355200, 0.583840},
+    {-0.086800, 0.369375, 0.561250},
+    {-0.178890, 0.369375, 0.554021},
+    {-0.265861, 0.369375, 0.533053},
+    {-0.267989, 0.367800, 0.539388},
+    {-0.270443, 0.363075, 0.546691},
+    {-0.182596, 0.355200, 0.576320},
+    {-0.086800, 0.344175, 0.592130},
+    {-0.273068, 0.355200, 0.554508},
+    {-0.183957, 0.344175, 0.584503},
+    {-0.349724, 0.367800, 0.505358},
+    {-0.353284, 0.363075, 0.512201},
+    {-0.346636, 0.369375, 0.499423},
+    {-0.264212, 0.367800, 0.528142},
+    {-0.344243, 0.367800, 0.494822},
+    {-0.417067, 0.367800, 0.450024},
+    {-0.420138, 0.369375, 0.454208},
+    {-0.424099, 0.367800, 0.459606},
+    {-0.428666, 0.363075, 0.465830},
+    {-0.357094, 0.355200, 0.519524},
+    {-0.275713, 0.344175, 0.562381},
+    {-0.433554, 0.355200, 0.472490},
+    {-0.360932, 0.344175, 0.526901},
+    {-0.490023, 0.367800, 0.403223},
+    {-0.495483, 0.363075, 0.408683},
+    {-0.485288, 0.369375, 0.398488},
+    {-0.481617, 0.367800, 0.394817},
+    {-0.536824, 0.367800, 0.330267},
+    {-0.541008, 0.369375, 0.333338},
+    {-0.546406, 0.367800, 0.337299},
+    {-0.552630, 0.363075, 0.341866},
+    {-0.501326, 0.355200, 0.414526},
+    {-0.438478, 0.344175, 0.479199},
+    {-0.592158, 0.367800, 0.262924},
+    {-0.586223, 0.369375, 0.259836},
+    {-0.581622, 0.367800, 0.257443},
+    {-0.614942, 0.367800, 0.177412},
+    {-0.619853, 0.369375, 0.179061},
+    {-0.635718, 0.367800, 0.091242},
+    {-0.640821, 0.369375, 0.092090},
+    {-0.611913, 0.363075, 0.176394},
+    {-0.632569, 0.363075, 0.090718},
+    {-0.578784, 0.363075, 0.255966},
+    {-0.611220, 0.355200, 0.176161},
+    {-0.631848, 0.355200, 0.090598},
+    {-0.638960, 0.355200, 0.000000},
+    {-0.639690, 0.363075, 0.000000},
+    {-0.642880, 0.367800, 0.000000},
+    {-0.641170, 0.344175, 0.000000},
+    {-0.634030, 0.344175, 0.090961},
+    {-0.613318, 0.344175, 0.176866},
+    {-0.578134, 0.355200, 0.255628},
+    {-0.639587, 0.330000, 0.091885},
+    {-0.646800, 0.330000, 0.000000},
+    {-0.618666, 0.330000, 0.178662},
+    {-0.580101, 0.344175, 0.256651},
+    {-0.533652, 0.355200, 0.327939},
+    {-0.534243, 0.363075, 0.328372},
+    {-0.585110, 0.330000, 0.259258},
+    {-0.535440, 0.344175, 0.329252},
+    {-0.478834, 0.355200, 0.392034},
+    {-0.479352, 0.363075, 0.392552},
+    {-0.415172, 0.363075, 0.447443},
+    {-0.480403, 0.344175, 0.393603},
+    {-0.414739, 0.355200, 0.446852},
+    {-0.539997, 0.330000, 0.332595},
+    {-0.484400, 0.330000, 0.397600},
+    {-0.416052, 0.344175, 0.448640},
+    {-0.342428, 0.355200, 0.491334},
+    {-0.342766, 0.363075, 0.491984},
+    {-0.263194, 0.363075, 0.525113},
+    {-0.343451, 0.344175, 0.493301},
+    {-0.262961, 0.355200, 0.524420},
+    {-0.419395, 0.330000, 0.453197},
+    {-0.346058, 0.330000, 0.498310},
+    {-0.263666, 0.344175, 0.526518},
+    {-0.177398, 0.355200, 0.545048},
+    {-0.177518, 0.363075, 0.545769},
+    {-0.178042, 0.367800, 0.548918},
+    {-0.086800, 0.367800, 0.556080},
+    {-0.086800, 0.363075, 0.552890},
+    {-0.177761, 0.344175, 0.547230},
+    {-0.086800, 0.355200, 0.552160},
+    {-0.265462, 0.330000, 0.531866},
+    {-0.178685, 0.330000, 0.552787},
+    {-0.086800, 0.344175, 0.554370},
+    {-0.086800, 0.330000, 0.560000},
+    {-0.364576, 0.330000, 0.533904},
+    {-0.278224, 0.330000, 0.569856},
+    {-0.287763, 0.267030, 0.598254},
+    {-0.185248, 0.330000, 0.592272},
+    {-0.190154, 0.267030, 0.621787},
+    {-0.194962, 0.204240, 0.650710},
+    {-0.086800, 0.267030, 0.629900},
+    {-0.086800, 0.204240, 0.659200},
+    {-0.086800, 0.330000, 0.600000},
+    {-0.086800, 0.141810, 0.687300},
+    {0.010357, 0.344175, 0.584503},
+    {-0.086800, 0.344175, 0.592130},
+    {0.011648, 0.330000, 0.592272},
+    {0.104624, 0.330000, 0.569856},
+    {0.114163, 0.267030, 0.598254},
+    {0.204818, 0.267030, 0.560510},
+    {-0.086800, 0.330000, 0.600000},
+    {0.016554, 0.267030, 0.621787},
+    {0.123511, 0.204240, 0.626082},
+    {0.218383, 0.204240, 0.586582},
+    {0.287310, 0.267030, 0.509766},
+    {0.304712, 0.204240, 0.533477},
+    {0.360429, 0.267030, 0.447229},
+    {0.381232, 0.204240, 0.468032},
+    {0.321401, 0.141810, 0.556218},
+    {0.401183, 0.141810, 0.487983},
+    {0.231392, 0.141810, 0.611587},
+    {0.021362, 0.204240, 0.650710},
+    {0.132476, 0.141810, 0.652770},
+    {0.243568, 0.079920, 0.634990},
+    {0.337021, 0.079920, 0.577502},
+    {0.419856, 0.079920, 0.506656},
+    {0.469418, 0.141810, 0.408201},
+    {0.490702, 0.079920, 0.423821},
+    {0.446677, 0.204240, 0.391512},
+    {0.524787, 0.141810, 0.318192},
+    {0.548190, 0.079920, 0.330368},
+    {0.510044, 0.018750, 0.438016},
+    {0.569457, 0.018750, 0.341433},
+    {0.436825, 0.018750, 0.523625},
+    {0.351216, 0.018750, 0.596844},
+    {0.451664, -0.041520, 0.538464},
+    {0.526958, -0.041520, 0.450429},
+    {0.588055, -0.041520, 0.351109},
+    {0.613648, 0.018750, 0.235292},
+    {0.633498, -0.041520, 0.241960},
+    {0.590949, 0.079920, 0.227667},
+    {0.641201, 0.018750, 0.121009},
+    {0.661832, -0.041520, 0.124438},
+    {0.649929, -0.100710, 0.247479},
+    {0.678909, -0.100710, 0.127277},
+    {0.603449, -0.100710, 0.359118},
+    {0.540958, -0.100710, 0.460704},
+    {0.615106, -0.158640, 0.365183},
+    {0.662371, -0.158640, 0.251659},
+    {0.691840, -0.158640, 0.129426},
+    {0.688900, -0.100710, -0.000000},
+    {0.702000, -0.158640, 0.000000},
+    {0.671600, -0.041520, 0.000000},
+    {0.650700, 0.018750, -0.000000},
+    {0.626800, 0.079920, 0.000000},
+    {0.617609, 0.079920, 0.117088},
+    {0.600500, 0.141810, 0.000000},
+    {0.591648, 0.141810, 0.112772},
+    {0.565970, 0.141810, 0.219276},
+    {0.563910, 0.204240, 0.108162},
+    {0.539282, 0.204240, 0.210311},
+    {0.572400, 0.204240, -0.000000},
+    {0.534987, 0.267030, 0.103354},
+    {0.511454, 0.267030, 0.200963},
+    {0.473710, 0.267030, 0.291618},
+    {0.499782, 0.204240, 0.305183},
+    {0.422966, 0.267030, 0.374110},
+    {0.543100, 0.267030, 0.000000},
+    {0.513200, 0.330000, 0.000000},
+    {0.710300, -0.215130, 0.000000},
+    {0.700033, -0.215130, 0.130788},
+    {0.713200, -0.270000, 0.000000},
+    {0.670254, -0.215130, 0.254307},
+    {0.702896, -0.270000, 0.131264},
+    {0.622492, -0.215130, 0.369026},
+    {0.673008, -0.270000, 0.255232},
+    {0.551560, -0.158640, 0.468484},
+    {0.558277, -0.215130, 0.473414},
+    {0.625072, -0.270000, 0.370368},
+    {0.463947, -0.100710, 0.550747},
+    {0.473248, -0.158640, 0.560048},
+    {0.363629, -0.041520, 0.613758},
+    {0.373904, -0.100710, 0.627758},
+    {0.381684, -0.158640, 0.638360},
+    {0.479141, -0.215130, 0.565941},
+    {0.560624, -0.270000, 0.475136},
+    {0.386614, -0.215130, 0.645077},
+    {0.481200, -0.270000, 0.568000},
+    {0.272318, -0.100710, 0.690249},
+    {0.278383, -0.158640, 0.701906},
+    {0.264309, -0.041520, 0.674855},
+    {0.254633, 0.018750, 0.656257},
+    {0.148492, 0.018750, 0.700448},
+    {0.155160, -0.041520, 0.720298},
+    {0.160679, -0.100710, 0.736729},
+    {0.164859, -0.158640, 0.749171},
+    {0.282226, -0.215130, 0.709292},
+    {0.388336, -0.270000, 0.647424},
+    {0.167507, -0.215130, 0.757054},
+    {0.283568, -0.270000, 0.711872},
+    {0.040477, -0.100710, 0.765709},
+    {0.042626, -0.158640, 0.778640},
+    {0.037638, -0.041520, 0.748632},
+    {0.034209, 0.018750, 0.728001},
+    {-0.086800, 0.018750, 0.737500},
+    {-0.086800, -0.041520, 0.758400},
+    {-0.086800, -0.100710, 0.775700},
+    {-0.086800, -0.158640, 0.788800},
+    {0.043988, -0.215130, 0.786833},
+    {0.168432, -0.270000, 0.759808},
+    {-0.086800, -0.215130, 0.797100},
+    {0.044464, -0.270000, 0.789696},
+    {-0.086800, -0.270000, 0.800000},
+    {0.043545, -0.321330, 0.784168},
+    {0.166645, -0.321330, 0.754489},
+    {0.168432, -0.270000, 0.759808},
+    {-0.086800, -0.321330, 0.794400},
+    {-0.218064, -0.270000, 0.789696},
+    {-0.086800, -0.321330, 0.794400},
+    {0.280976, -0.321330, 0.706889},
+    {0.283568, -0.270000, 0.711872},
+    {0.385010, -0.321330, 0.642892},
+    {0.388336, -0.270000, 0.647424},
+    {0.477224, -0.321330, 0.564024},
+    {0.481200, -0.270000, 0.568000},
+    {0.556092, -0.321330, 0.471810},
+    {0.560624, -0.270000, 0.475136},
+    {0.620089, -0.321330, 0.367776},
+    {0.625072, -0.270000, 0.370368},
+    {0.667689, -0.321330, 0.253445},
+    {0.653253, -0.367440, 0.248596},
+    {0.682364, -0.367440, 0.127851},
+    {0.660252, -0.408510, 0.124176},
+    {0.673008, -0.270000, 0.255232},
+    {0.697368, -0.321330, 0.130345},
+    {0.692400, -0.367440, -0.000000},
+    {0.670000, -0.408510, -0.000000},
+    {0.642800, -0.444720, 0.000000},
+    {-0.086800, -0.367440, 0.779200},
+    {-0.217145, -0.321330, 0.784168},
+    {-0.342032, -0.270000, 0.759808},
+    {-0.340245, -0.321330, 0.754489},
+    {-0.214651, -0.367440, 0.769164},
+    {-0.086800, -0.367440, 0.779200},
+    {-0.457168, -0.270000, 0.711872},
+    {-0.454576, -0.321330, 0.706889},
+    {-0.335396, -0.367440, 0.740053},
+    {-0.210976, -0.408510, 0.747052},
+    {-0.086800, -0.408510, 0.756800},
+    {-0.447538, -0.367440, 0.693363},
+    {-0.328250, -0.408510, 0.718778},
+    {-0.561936, -0.270000, 0.647424},
+    {-0.558610, -0.321330, 0.642892},
+    {-0.549582, -0.367440, 0.630591},
+    {-0.437168, -0.408510, 0.673431},
+    {-0.319572, -0.444720, 0.692945},
+    {-0.206513, -0.444720, 0.720203},
+    {-0.086800, -0.444720, 0.729600},
+    {-0.201656, -0.476250, 0.690984},
+    {-0.086800, -0.476250, 0.700000},
+    {-0.650824, -0.321330, 0.564024},
+    {-0.654800, -0.270000, 0.568000},
+    {-0.734224, -0.270000, 0.475136},
+    {-0.086800, -0.503280, 0.670400},
+    {-0.086800, 0.079920, 0.713600},
+    {-0.086800, 0.141810, 0.687300},
+    {0.030288, 0.079920, 0.704409},
+    {0.025972, 0.141810, 0.678448},
+    {0.140867, 0.079920, 0.677749},
+    {-0.086800, 0.204240, 0.659200},
+    {-0.086800, 0.267030, 0.629900},
+    {0.560624, -0.270000, -0.475136},
+    {0.477224, -0.321330, -0.564024},
+    {0.481200, -0.270000, -0.568000},
+    {0.385010, -0.321330, -0.642892},
+    {0.375982, -0.367440, -0.630591},
+    {0.273938, -0.367440, -0.693363},
+    {0.263568, -0.408510, -0.673431},
+    {0.388336, -0.270000, -0.647424},
+    {0.280976, -0.321330, -0.706889},
+    {0.161796, -0.367440, -0.740053},
+    {0.154650, -0.408510, -0.718778},
+    {0.145972, -0.444720, -0.692945},
+    {0.037376, -0.408510, -0.747052},
+    {0.032913, -0.444720, -0.720203},
+    {0.166645, -0.321330, -0.754489},
+    {0.041051, -0.367440, -0.769164},
+    {0.283568, -0.270000, -0.711872},
+    {0.168432, -0.270000, -0.759808},
+    {0.043545, -0.321330, -0.784168},
+    {-0.086800, -0.367440, -0.779200},
+    {-0.086800, -0.408510, -0.756800},
+    {-0.086800, -0.444720, -0.729600},
+    {0.028056, -0.476250, -0.690984},
+    {-0.086800, -0.476250, -0.700000},
+    {-0.086800, -0.503280, -0.670400},
+    {-0.086800, -0.321330, -0.794400},
+    {0.044464, -0.270000, -0.789696},
+    {-0.086800, -0.215130, -0.797100},
+    {-0.086800, -0.158640, -0.788800},
+    {-0.217588, -0.215130, -0.786833},
+    {-0.342032, -0.270000, -0.759808},
+    {-0.216226, -0.158640, -0.778640},
+    {-0.341107, -0.215130, -0.757054},
+    {-0.086800, -0.100710, -0.775700},
+    {-0.214077, -0.100710, -0.765709},
+    {-0.338459, -0.158640, -0.749171},
+    {-0.455826, -0.215130, -0.709292},
+    {-0.457168, -0.270000, -0.711872},
+    {-0.334279, -0.100710, -0.736729},
+    {-0.451983, -0.158640, -0.701906},
+    {-0.211238, -0.041520, -0.748632},
+    {-0.086800, -0.041520, -0.758400},
+    {-0.328760, -0.041520, -0.720298},
+    {-0.445918, -0.100710, -0.690249},
+    {-0.555284, -0.158640, -0.638360},
+    {-0.560214, -0.215130, -0.645077},
+    {-0.561936, -0.270000, -0.647424},
+    {-0.652741, -0.215130, -0.565941},
+    {-0.654800, -0.270000, -0.568000},
+    {-0.547504, -0.100710, -0.627758},
+    {-0.646848, -0.158640, -0.560048},
+    {-0.437909, -0.041520, -0.674855},
+    {-0.322092, 0.018750, -0.700448},
+    {-0.207809, 0.018750, -0.728001},
+    {-0.428233, 0.018750, -0.656257},
+    {-0.537229, -0.041520, -0.613758},
+    {-0.637547, -0.100710, -0.550747},
+    {-0.725160, -0.158640, -0.468484},
+    {-0.731877, -0.215130, -0.473414},
+    {-0.734224, -0.270000, -0.475136},
+    {-0.796092, -0.215130, -0.369026},
+    {-0.798672, -0.270000, -0.370368},
+    {-0.714558, -0.100710, -0.460704},
+    {-0.788706, -0.158640, -0.365183},
+    {-0.625264, -0.041520, -0.538464},
+    {-0.524816, 0.018750, -0.596844},
+    {-0.835971, -0.158640, -0.251659},
+    {-0.843854, -0.215130, -0.254307},
+    {-0.846608, -0.270000, -0.255232},
+    {-0.873633, -0.215130, -0.130788},
+    {-0.876496, -0.270000, -0.131264},
+    {-0.865440, -0.158640, -0.129426},
+    {-0.883900, -0.215130, -0.000000},
+    {-0.886800, -0.270000, 0.000000},
+    {-0.875600, -0.158640, -0.000000},
+    {-0.417168, 0.079920, -0.634990},
+    {-0.306076, 0.141810, -0.652770},
+    {-0.314467, 0.079920, -0.677749},
+    {-0.194962, 0.204240, -0.650710},
+    {-0.199572, 0.141810, -0.678448},
+    {-0.203888, 0.079920, -0.704409},
+    {-0.086800, 0.204240, -0.659200},
+    {-0.086800, 0.141810, -0.687300},
+    {-0.086800, 0.267030, -0.629900},
+    {-0.086800, 0.330000, -0.600000},
+    {-0.086800, 0.079920, -0.713600},
+    {-0.086800, 0.018750, -0.737500},
+    {-0.086800, -0.617520, -0.457440},
+    {-0.086800, -0.622710, -0.380970},
+    {-0.149310, -0.622710, -0.376063},
+    {-0.132952, -0.626640, -0.277657},
+    {-0.176540, -0.626640, -0.267148},
+    {-0.278224, -0.570000, -0.569856},
+    {-0.186167, -0.559170, -0.597800},
+    {-0.185248, -0.570000, -0.592272},
+    {-0.086800, -0.544560, -0.620800},
+    {-0.086800, -0.559170, -0.605600},
+    {-0.086800, -0.525990, -0.643200},
+    {-0.086800, -0.570000, -0.600000},
+    {-0.561936, -0.270000, -0.647424},
+    {-0.650824, -0.321330, -0.564024},
+    {-0.654800, -0.270000, -0.568000},
+    {-0.729692, -0.321330, -0.471810},
+    {-0.717391, -0.367440, -0.462782},
+    {-0.780163, -0.367440, -0.360738},
+    {-0.760231, -0.408510, -0.350368},
+    {-0.734224, -0.270000, -0.475136},
+    {-0.793689, -0.321330, -0.367776},
+    {-0.826853, -0.367440, -0.248596},
+    {-0.805578, -0.408510, -0.241450},
+    {-0.779745, -0.444720, -0.232772},
+    {-0.833852, -0.408510, -0.124176},
+    {-0.807003, -0.444720, -0.119713},
+    {-0.841289, -0.321330, -0.253445},
+    {-0.855964, -0.367440, -0.127851},
+    {-0.798672, -0.270000, -0.370368},
+    {-0.846608, -0.270000, -0.255232},
+    {-0.870968, -0.321330, -0.130345},
+    {-0.866000, -0.367440, 0.000000},
+    {-0.843600, -0.408510, 0.000000},
+    {-0.816400, -0.444720, -0.000000},
+    {-0.777784, -0.476250, -0.114856},
+    {-0.786800, -0.476250, -0.000000},
+    {-0.757200, -0.503280, 0.000000},
+    {-0.664930, -0.596190, 0.000000},
+    {-0.639760, -0.604080, -0.000000},
+    {-0.086800, -0.559170, 0.605600},
+    {0.011648, -0.570000, 0.592272},
+    {-0.086800, -0.570000, 0.600000},
+    {0.268714, -0.578970, 0.484427},
+    {0.190976, -0.570000, 0.533904},
+    {-0.942926, -0.243508, -0.032400},
+    {-0.882640, -0.282480, -0.057600},
+    {-0.993141, -0.209409, -0.032400},
+    {-0.992720, -0.206640, 0.000000},
+    {-0.942073, -0.251726, -0.057600},
+    {-0.878160, -0.295920, -0.075600},
+    {-0.994284, -0.216924, -0.057600},
+    {-0.940816, -0.263837, -0.075600},
+    {-1.036562, -0.172115, -0.032400},
+    {-1.035480, -0.169560, 0.000000},
+    {-1.039501, -0.179050, -0.057600},
+    {-0.995969, -0.227998, -0.075600},
+    {-0.939290, -0.278544, -0.086400},
+    {-0.872720, -0.312240, -0.086400},
+    {-1.043830, -0.189269, -0.075600},
+    {-0.998014, -0.241446, -0.086400},
+    {-1.077950, -0.139081, -0.057600},
+    {-1.073426, -0.132679, -0.032400},
+    {-1.071760, -0.130320, 0.000000},
+    {-1.071760, -0.130320, 0.000000},
+    {-1.073426, -0.132679, 0.032400},
+    {-1.036562, -0.172115, 0.032400},
+    {-0.992720, -0.206640, 0.000000},
+    {-1.101800, -0.090000, 0.000000},
+    {-1.103970, -0.092152, 0.032400},
+    {-1.109860, -0.097995, 0.057600},
+    {-1.077950, -0.139081, 0.057600},
+    {-1.039501, -0.179050, 0.057600},
+    {-0.993141, -0.209409, 0.032400},
+    {-0.943240, -0.240480, 0.000000},
+    {-0.994284, -0.216924, 0.057600},
+    {-0.942926, -0.243508, 0.032400},
+    {-1.084616, -0.148516, 0.075600},
+    {-1.043830, -0.189269, 0.075600},
+    {-1.118540, -0.106605, 0.075600},
+    {-1.135458, -0.056769, 0.057600},
+    {-1.145816, -0.064402, 0.075600},
+    {-1.158393, -0.073672, 0.086400},
+    {-1.129080, -0.117060, 0.086400},
+    {-1.092711, -0.159972, 0.086400},
+    {-1.049088, -0.201678, 0.086400},
+    {-0.995969, -0.227998, 0.075600},
+    {-0.942073, -0.251726, 0.057600},
+    {-0.998014, -0.241446, 0.086400},
+    {-0.940816, -0.263837, 0.075600},
+    {-1.101520, -0.172440, 0.090000},
+    {-1.054810, -0.215182, 0.090000},
+    {-1.140550, -0.128438, 0.090000},
+    {-1.172080, -0.083760, 0.090000},
+    {-1.185767, -0.093848, 0.086400},
+    {-1.152020, -0.139815, 0.086400},
+    {-1.110329, -0.184908, 0.086400},
+    {-1.060532, -0.228687, 0.086400},
+    {-1.000240, -0.256080, 0.090000},
+    {-0.939290, -0.278544, 0.086400},
+    {-1.002466, -0.270714, 0.086400},
+    {-0.937630, -0.294548, 0.090000},
+    {-1.118424, -0.196364, 0.075600},
+    {-1.065790, -0.241096, 0.075600},
+    {-1.162560, -0.150270, 0.075600},
+    {-1.198344, -0.103118, 0.075600},
+    {-1.208702, -0.110751, 0.057600},
+    {-1.171240, -0.158880, 0.057600},
+    {-1.125090, -0.205799, 0.057600},
+    {-1.070119, -0.251316, 0.057600},
+    {-1.004511, -0.284162, 0.075600},
+    {-0.935970, -0.310552, 0.086400},
+    {-1.006196, -0.295236, 0.057600},
+    {-0.934444, -0.325258, 0.075600},
+    {-1.129614, -0.212201, 0.032400},
+    {-1.073058, -0.258250, 0.032400},
+    {-1.177130, -0.164722, 0.032400},
+    {-1.215730, -0.115932, 0.032400},
+    {-1.218320, -0.117840, 0.000000},
+    {-1.179300, -0.166875, 0.000000},
+    {-1.131280, -0.214560, 0.000000},
+    {-1.074140, -0.260805, 0.000000},
+    {-1.007339, -0.302751, 0.032400},
+    {-0.933187, -0.337369, 0.057600},
+    {-1.007760, -0.305520, 0.000000},
+    {-0.932334, -0.345587, 0.032400},
+    {-1.131280, -0.214560, 0.000000},
+    {-1.129614, -0.212201, -0.032400},
+    {-1.073058, -0.258250, -0.032400},
+    {-1.007760, -0.305520, 0.000000},
+    {-1.179300, -0.166875, 0.000000},
+    {-1.177130, -0.164722, -0.032400},
+    {-1.171240, -0.158880, -0.057600},
+    {-1.125090, -0.205799, -0.057600},
+    {-1.070119, -0.251316, -0.057600},
+    {-1.007339, -0.302751, -0.032400},
+    {-0.932020, -0.348615, 0.000000},
+    {-1.006196, -0.295236, -0.057600},
+    {-0.932334, -0.345587, -0.032400},
+    {-1.118424, -0.196364, -0.075600},
+    {-1.065790, -0.241096, -0.075600},
+    {-1.162560, -0.150270, -0.075600},
+    {-1.208702, -0.110751, -0.057600},
+    {-1.198344, -0.103118, -0.075600},
+    {-1.185767, -0.093848, -0.086400},
+    {-1.152020, -0.139815, -0.086400},
+    {-1.110329, -0.184908, -0.086400},
+    {-1.060532, -0.228687, -0.086400},
+    {-1.004511, -0.284162, -0.075600},
+    {-0.933187, -0.337369, -0.057600},
+    {-1.002466, -0.270714, -0.086400},
+    {-0.934444, -0.325258, -0.075600},
+    {-1.101520, -0.172440, -0.090000},
+    {-1.054810, -0.215182, -0.090000},
+    {-1.140550, -0.128438, -0.090000},
+    {-1.172080, -0.083760, -0.090000},
+    {-1.158393, -0.073672, -0.086400},
+    {-1.129080, -0.117060, -0.086400},
+    {-1.092711, -0.159972, -0.086400},
+    {-1.049088, -0.201678, -0.086400},
+    {-1.000240, -0.256080, -0.090000},
+    {-0.935970, -0.310552, -0.086400},
+    {-0.937630, -0.294548, -0.090000},
+    {-1.084616, -0.148516, -0.075600},
+    {-1.118540, -0.106605, -0.075600},
+    {-1.145816, -0.064402, -0.075600},
+    {-1.135458, -0.056769, -0.057600},
+    {-1.109860, -0.097995, -0.057600},
+    {-1.128430, -0.051588, -0.032400},
+    {-1.103970, -0.092152, -0.032400},
+    {-1.154971, -0.016379, -0.057600},
+    {-1.147042, -0.012039, -0.032400},
+    {-1.166658, -0.022775, -0.075600},
+    {-1.168628, 0.022197, -0.057600},
+    {-1.160043, 0.025444, -0.032400},
+    {-1.156880, 0.026640, 0.000000},
+    {-1.144120, -0.010440, 0.000000},
+    {-1.125840, -0.049680, 0.000000},
+    {-1.101800, -0.090000, 0.000000},
+    {-1.147042, -0.012039, 0.032400},
+    {-1.128430, -0.051588, 0.032400},
+    {-1.156880, 0.026640, 0.000000},
+    {-1.160043, 0.025444, 0.032400},
+    {-1.168628, 0.022197, 0.057600},
+    {-1.154971, -0.016379, 0.057600},
+    {-1.181279, 0.017412, 0.075600},
+    {-1.166658, -0.022775, 0.075600},
+    {-1.176655, 0.057982, 0.057600},
+    {-1.189896, 0.055293, 0.075600},
+    {-1.167670, 0.059808, 0.032400},
+    {-1.164360, 0.060480, 0.000000},
+    {-1.170160, 0.090000, 0.032400},
+    {-1.179280, 0.090000, 0.057600},
+    {-1.192720, 0.090000, 0.075600},
+    {-1.209040, 0.090000, 0.086400},
+    {-1.205974, 0.052027, 0.086400},
+    {-1.196642, 0.011602, 0.086400},
+    {-1.226800, 0.090000, 0.090000},
+    {-1.223470, 0.048472, 0.090000},
+    {-1.203844, 0.122975, 0.086400},
+    {-1.221420, 0.126585, 0.090000},
+    {-1.187692, 0.119658, 0.075600},
+    {-1.174391, 0.116926, 0.057600},
+    {-1.172734, 0.143407, 0.075600},
+    {-1.188358, 0.149380, 0.086400},
+    {-1.205360, 0.155880, 0.090000},
+    {-1.222362, 0.162380, 0.086400},
+    {-1.238996, 0.130195, 0.086400},
+    {-1.244560, 0.090000, 0.086400},
+    {-1.237986, 0.168353, 0.075600},
+    {-1.255148, 0.133512, 0.075600},
+    {-1.194742, 0.187446, 0.086400},
+    {-1.209446, 0.195488, 0.075600},
+    {-1.178740, 0.178695, 0.090000},
+    {-1.162738, 0.169944, 0.086400},
+    {-1.141680, 0.195840, 0.090000},
+    {-1.156220, 0.206283, 0.086400},
+    {-1.169580, 0.215879, 0.075600},
+    {-1.180583, 0.223782, 0.057600},
+    {-1.221556, 0.202110, 0.057600},
+    {-1.250852, 0.173272, 0.057600},
+    {-1.188049, 0.229144, 0.032400},
+    {-1.229773, 0.206604, 0.032400},
+    {-1.127960, 0.239310, 0.057600},
+    {-1.134420, 0.245295, 0.032400},
+    {-1.118440, 0.230490, 0.075600},
+    {-1.106880, 0.219780, 0.086400},
+    {-1.056078, 0.240284, 0.075600},
+    {-1.063711, 0.249719, 0.057600},
+    {-1.068892, 0.256121, 0.032400},
+    {-1.070800, 0.258480, 0.000000},
+    {-1.136800, 0.247500, 0.000000},
+    {-1.190800, 0.231120, 0.000000},
+    {-1.070800, 0.258480, 0.000000},
+    {-1.068892, 0.256121, -0.032400},
+    {-1.134420, 0.245295, -0.032400},
+    {-1.190800, 0.231120, 0.000000},
+    {-0.992800, 0.265140, 0.000000},
+    {-0.991470, 0.262688, -0.032400},
+    {-0.987862, 0.256033, -0.057600},
+    {-1.063711, 0.249719, -0.057600},
+    {-1.127960, 0.239310, -0.057600},
+    {-1.188049, 0.229144, -0.032400},
+    {-1.232800, 0.208260, 0.000000},
+    {-1.180583, 0.223782, -0.057600},
+    {-1.229773, 0.206604, -0.032400},
+    {-1.056078, 0.240284, -0.075600},
+    {-1.118440, 0.230490, -0.075600},
+    {-0.982544, 0.246225, -0.075600},
+    {-0.900437, 0.259275, -0.057600},
+    {-0.897892, 0.249276, -0.075600},
+    {-0.894802, 0.237134, -0.086400},
+    {-0.976087, 0.234315, -0.086400},
+    {-1.046808, 0.228828, -0.086400},
+    {-1.106880, 0.219780, -0.086400},
+    {-1.169580, 0.215879, -0.075600},
+    {-1.221556, 0.202110, -0.057600},
+    {-1.156220, 0.206283, -0.086400},
+    {-1.209446, 0.195488, -0.075600},
+    {-1.036720, 0.216360, -0.090000},
+    {-1.094300, 0.208125, -0.090000},
+    {-0.969060, 0.221355, -0.090000},
+    {-0.891440, 0.223920, -0.090000},
+    {-0.888078, 0.210706, -0.086400},
+    {-0.962033, 0.208395, -0.086400},
+    {-1.026632, 0.203892, -0.086400},
+    {-1.081720, 0.196470, -0.086400},
+    {-1.141680, 0.195840, -0.090000},
+    {-1.194742, 0.187446, -0.086400},
+    {-1.127140, 0.185397, -0.086400},
+    {-1.178740, 0.178695, -0.090000},
+    {-1.017362, 0.192436, -0.075600},
+    {-1.070160, 0.185760, -0.075600},
+    {-0.955576, 0.196485, -0.075600},
+    {-0.884988, 0.198564, -0.075600},
+    {-0.882443, 0.188565, -0.057600},
+    {-0.950258, 0.186677, -0.057600},
+    {-1.009729, 0.183001, -0.057600},
+    {-1.060640, 0.176940, -0.057600},
+    {-1.113780, 0.175801, -0.075600},
+    {-1.162738, 0.169944, -0.086400},
+    {-1.102777, 0.167898, -0.057600},
+    {-1.148034, 0.161902, -0.075600},
+    {-1.004548, 0.176599, -0.032400},
+    {-1.054180, 0.170955, -0.032400},
+    {-0.946650, 0.180022, -0.032400},
+    {-0.880716, 0.181780, -0.032400},
+    {-0.880080, 0.179280, 0.000000},
+    {-0.945320, 0.177570, 0.000000},
+    {-1.002640, 0.174240, 0.000000},
+    {-1.051800, 0.168750, 0.000000},
+    {-1.095311, 0.162536, -0.032400},
+    {-1.135924, 0.155280, -0.057600},
+    {-1.092560, 0.160560, 0.000000},
+    {-1.127707, 0.150786, -0.032400},
+    {-1.159868, 0.138488, -0.057600},
+    {-1.172734, 0.143407, -0.075600},
+    {-1.124680, 0.149130, 0.000000},
+    {-1.151137, 0.135150, -0.032400},
+    {-1.174391, 0.116926, -0.057600},
+    {-1.187692, 0.119658, -0.075600},
+    {-1.188358, 0.149380, -0.086400},
+    {-1.203844, 0.122975, -0.086400},
+    {-1.192720, 0.090000, -0.075600},
+    {-1.209040, 0.090000, -0.086400},
+    {-1.165365, 0.115073, -0.032400},
+    {-1.179280, 0.090000, -0.057600},
+    {-1.147920, 0.133920, 0.000000},
+    {-1.162040, 0.114390, 0.000000},
+    {-1.170160, 0.090000, -0.032400},
+    {-1.176655, 0.057982, -0.057600},
+    {-1.189896, 0.055293, -0.075600},
+    {-1.205974, 0.052027, -0.086400},
+    {-1.226800, 0.090000, -0.090000},
+    {-1.223470, 0.048472, -0.090000},
+    {-1.196642, 0.011602, -0.086400},
+    {-1.213360, 0.005280, -0.090000},
+    {-1.181279, 0.017412, -0.075600},
+    {-1.167670, 0.059808, -0.032400},
+    {-1.166800, 0.090000, 0.000000},
+    {-1.180848, -0.030541, -0.086400},
+    {-1.196290, -0.038992, -0.090000},
+    {-1.230078, -0.001042, -0.086400},
+    {-1.211732, -0.047444, -0.086400},
+    {-1.225922, -0.055210, -0.075600},
+    {-1.240966, 0.044918, -0.086400},
+    {-1.245441, -0.006852, -0.075600},
+    {-1.237609, -0.061606, -0.057600},
+    {-1.257044, 0.041652, -0.075600},
+    {-1.258092, -0.011637, -0.057600},
+    {-1.244560, 0.090000, -0.086400},
+    {-1.260880, 0.090000, -0.075600},
+    {-1.270285, 0.038962, -0.057600},
+    {-1.266677, -0.014884, -0.032400},
+    {-1.245538, -0.065946, -0.032400},
+    {-1.215730, -0.115932, -0.032400},
+    {-1.248460, -0.067545, 0.000000},
+    {-1.279270, 0.037138, -0.032400},
+    {-1.269840, -0.016080, 0.000000},
+    {-1.274320, 0.090000, -0.057600},
+    {-1.283440, 0.090000, -0.032400},
+    {-1.282580, 0.036465, 0.000000},
+    {-1.268449, 0.136244, -0.057600},
+    {-1.255148, 0.133512, -0.075600},
+    {-1.277475, 0.138097, -0.032400},
+    {-1.286800, 0.090000, 0.000000},
+    {-1.279270, 0.037138, 0.032400},
+    {-1.266677, -0.014884, 0.032400},
+    {-1.269840, -0.016080, 0.000000},
+    {-1.280800, 0.138780, 0.000000},
+    {-1.280800, 0.138780, 0.000000},
+    {-1.283440, 0.090000, 0.032400},
+    {-1.259583, 0.176610, -0.032400},
+    {-1.250852, 0.173272, -0.057600},
+    {-1.237986, 0.168353, -0.075600},
+    {-1.262800, 0.177840, 0.000000},
+    {-1.259583, 0.176610, 0.032400},
+    {-1.277475, 0.138097, 0.032400},
+    {-1.268449, 0.136244, 0.057600},
+    {-1.274320, 0.090000, 0.057600},
+    {-1.260880, 0.090000, 0.075600},
+    {-1.270285, 0.038962, 0.057600},
+    {-1.257044, 0.041652, 0.075600},
+    {-1.240966, 0.044918, 0.086400},
+    {-1.245441, -0.006852, 0.075600},
+    {-1.230078, -0.001042, 0.086400},
+    {-1.258092, -0.011637, 0.057600},
+    {-1.225922, -0.055210, 0.075600},
+    {-1.211732, -0.047444, 0.086400},
+    {-1.213360, 0.005280, 0.090000},
+    {-1.196290, -0.038992, 0.090000},
+    {-1.180848, -0.030541, 0.086400},
+    {-1.237609, -0.061606, 0.057600},
+    {-1.245538, -0.065946, 0.032400},
+    {-1.248460, -0.067545, 0.000000},
+    {-1.222362, 0.162380, -0.086400},
+    {-1.205360, 0.155880, -0.090000},
+    {-1.238996, 0.130195, -0.086400},
+    {-1.221420, 0.126585, -0.090000},
+    {-1.162040, 0.114390, 0.000000},
+    {-1.165365, 0.115073, 0.032400},
+    {-1.151137, 0.135150, 0.032400},
+    {-1.159868, 0.138488, 0.057600},
+    {-1.147920, 0.133920, 0.000000},
+    {-1.127707, 0.150786, 0.032400},
+    {-1.135924, 0.155280, 0.057600},
+    {-1.148034, 0.161902, 0.075600},
+    {-1.102777, 0.167898, 0.057600},
+    {-1.113780, 0.175801, 0.075600},
+    {-1.095311, 0.162536, 0.032400},
+    {-1.060640, 0.176940, 0.057600},
+    {-1.070160, 0.185760, 0.075600},
+    {-1.081720, 0.196470, 0.086400},
+    {-1.127140, 0.185397, 0.086400},
+    {-1.094300, 0.208125, 0.090000},
+    {-1.026632, 0.203892, 0.086400},
+    {-1.036720, 0.216360, 0.090000},
+    {-1.017362, 0.192436, 0.075600},
+    {-1.009729, 0.183001, 0.057600},
+    {-1.054180, 0.170955, 0.032400},
+    {-0.955576, 0.196485, 0.075600},
+    {-0.962033, 0.208395, 0.086400},
+    {-0.969060, 0.221355, 0.090000},
+    {-0.976087, 0.234315, 0.086400},
+    {-1.046808, 0.228828, 0.086400},
+    {-0.982544, 0.246225, 0.075600},
+    {-0.894802, 0.237134, 0.086400},
+    {-0.897892, 0.249276, 0.075600},
+    {-0.891440, 0.223920, 0.090000},
+    {-0.888078, 0.210706, 0.086400},
+    {-0.803980, 0.224865, 0.090000},
+    {-0.803039, 0.238172, 0.086400},
+    {-0.802174, 0.250400, 0.075600},
+    {-0.801462, 0.260469, 0.057600},
+    {-0.900437, 0.259275, 0.057600},
+    {-0.987862, 0.256033, 0.057600},
+    {-0.902164, 0.266060, 0.032400},
+    {-0.991470, 0.262688, 0.032400},
+    {-0.800978, 0.267302, 0.032400},
+    {-0.690960, 0.260640, 0.057600},
+    {-0.687920, 0.267480, 0.032400},
+    {-0.695440, 0.250560, 0.075600},
+    {-0.700880, 0.238320, 0.086400},
+    {-0.706800, 0.225000, 0.090000},
+    {-0.804921, 0.211558, 0.086400},
+    {-0.712720, 0.211680, 0.086400},
+    {-0.805786, 0.199330, 0.075600},
+    {-0.884988, 0.198564, 0.075600},
+    {-0.718160, 0.199440, 0.075600},
+    {-0.806498, 0.189261, 0.057600},
+    {-0.882443, 0.188565, 0.057600},
+    {-0.950258, 0.186677, 0.057600},
+    {-0.880716, 0.181780, 0.032400},
+    {-0.946650, 0.180022, 0.032400},
+    {-0.722640, 0.189360, 0.057600},
+    {-0.806982, 0.182428, 0.032400},
+    {-0.880080, 0.179280, 0.000000},
+    {-1.004548, 0.176599, 0.032400},
+    {-1.002640, 0.174240, 0.000000},
+    {-1.051800, 0.168750, 0.000000},
+    {-1.092560, 0.160560, 0.000000},
+    {-0.807160, 0.179910, 0.000000},
+    {-0.725680, 0.182520, 0.032400},
+    {-0.726800, 0.180000, 0.000000},
+    {-0.806982, 0.182428, -0.032400},
+    {-0.725680, 0.182520, -0.032400},
+    {-0.806498, 0.189261, -0.057600},
+    {-0.722640, 0.189360, -0.057600},
+    {-0.805786, 0.199330, -0.075600},
+    {-0.718160, 0.199440, -0.075600},
+    {-0.804921, 0.211558, -0.086400},
+    {-0.712720, 0.211680, -0.086400},
+    {-0.803980, 0.224865, -0.090000},
+    {-0.706800, 0.225000, -0.090000},
+    {-0.803039, 0.238172, -0.086400},
+    {-0.700880, 0.238320, -0.086400},
+    {-0.802174, 0.250400, -0.075600},
+    {-0.695440, 0.250560, -0.075600},
+    {-0.801462, 0.260469, -0.057600},
+    {-0.690960, 0.260640, -0.057600},
+    {-0.800978, 0.267302, -0.032400},
+    {-0.902164, 0.266060, -0.032400},
+    {-0.902800, 0.268560, 0.000000},
+    {-0.687920, 0.267480, -0.032400},
+    {-0.800800, 0.269820, 0.000000},
+    {-0.686800, 0.270000, 0.000000},
+    {-0.902800, 0.268560, 0.000000},
+    {-0.866800, -0.330000, -0.090000},
+    {-0.860880, -0.347760, -0.086400},
+    {-0.855440, -0.364080, -0.075600},
+    {-0.850960, -0.377520, -0.057600},
+    {-0.847920, -0.386640, -0.032400},
+    {-0.846800, -0.390000, 0.000000},
+    {-0.850960, -0.377520, 0.057600},
+    {-0.855440, -0.364080, 0.075600},
+    {-0.847920, -0.386640, 0.032400},
+    {-0.932020, -0.348615, 0.000000},
+    {-0.846800, -0.390000, 0.000000},
+    {-0.860880, -0.347760, 0.086400},
+    {-0.866800, -0.330000, 0.090000},
+    {-0.872720, -0.312240, 0.086400},
+    {-0.878160, -0.295920, 0.075600},
+    {-0.882640, -0.282480, 0.057600},
+    {-0.885680, -0.273360, 0.032400},
+    {-0.886800, -0.270000, 0.000000},
+    {-0.800400, 0.079920, 0.000000},
+    {-0.774100, 0.141810, 0.000000},
+    {-0.791209, 0.079920, 0.117088},
+    {-0.765248, 0.141810, 0.112772},
+    {-0.764549, 0.079920, 0.227667},
+    {-0.746000, 0.204240, 0.000000},
+    {-0.737510, 0.204240, 0.108162},
+    {-0.739570, 0.141810, 0.219276},
+    {-0.721790, 0.079920, 0.330368},
+    {-0.712882, 0.204240, 0.210311},
+    {-0.698387, 0.141810, 0.318192},
+    {-0.708587, 0.267030, 0.103354},
+    {-0.716700, 0.267030, 0.000000},
+    {-0.664302, 0.079920, 0.423821},
+    {-0.610425, 0.018750, 0.523625},
+    {-0.686800, 0.330000, 0.000000},
+    {-0.678930, 0.344175, 0.000000},
+    {0.688958, -0.060712, -0.070040},
+    {0.593200, -0.069240, -0.071280},
+    {0.593200, -0.060000, 0.000000},
+    {0.687560, -0.052320, 0.000000},
+    {0.692752, -0.083489, -0.124516},
+    {0.759992, -0.038352, -0.066675},
+    {0.766266, -0.058416, -0.118533},
+    {0.593200, -0.094320, -0.126720},
+    {0.698343, -0.117055, -0.163427},
+    {0.775513, -0.087984, -0.155575},
+    {0.818753, -0.021809, -0.109716},
+    {0.830204, -0.046975, -0.144003},
+    {0.757680, -0.030960, 0.000000},
+    {0.810983, -0.004732, -0.061716},
+    {0.855221, 0.023626, -0.099010},
+    {0.867908, 0.003062, -0.129951},
+    {0.844108, -0.077534, -0.164575},
+    {0.883314, -0.021907, -0.148516},
+    {0.786741, -0.123888, -0.177800},
+    {0.859240, -0.110790, -0.171432},
+    {0.900080, -0.049080, -0.154704},
+    {0.910440, 0.039840, -0.131040},
+    {0.928200, 0.018750, -0.136500},
+    {0.894120, 0.059220, -0.114660},
+    {0.846612, 0.037579, -0.055694},
+    {0.880680, 0.075180, -0.087360},
+    {0.914332, 0.118589, -0.099369},
+    {0.931566, 0.104554, -0.113564},
+    {0.950320, 0.089280, -0.118296},
+    {0.945960, -0.002340, -0.131040},
+    {0.969074, 0.074006, -0.113564},
+    {0.916846, -0.076253, -0.148516},
+    {0.962280, -0.021720, -0.114660},
+    {0.986308, 0.059971, -0.099369},
+    {0.993548, 0.149100, -0.097505},
+    {1.012284, 0.139920, -0.085317},
+    {0.973160, 0.159090, -0.101568},
+    {0.952772, 0.169080, -0.097505},
+    {1.003440, 0.224760, -0.087792},
+    {1.026741, 0.219254, -0.084280},
+    {1.048153, 0.214195, -0.073745},
+    {1.027713, 0.132360, -0.065004},
+    {1.065786, 0.210029, -0.056187},
+    {1.000501, 0.048413, -0.075710},
+    {1.038183, 0.127230, -0.036564},
+    {1.077752, 0.207202, -0.031605},
+    {1.123152, 0.277286, -0.050204},
+    {1.137598, 0.276215, -0.028240},
+    {1.101863, 0.278866, -0.065893},
+    {1.076012, 0.280783, -0.075306},
+    {1.181360, 0.330000, -0.063000},
+    {1.208240, 0.330000, -0.048000},
+    {1.226480, 0.330000, -0.027000},
+    {1.142920, 0.275820, 0.000000},
+    {1.233200, 0.330000, 0.000000},
+    {1.082160, 0.206160, 0.000000},
+    {1.042040, 0.125340, 0.000000},
+    {1.042040, 0.125340, 0.000000},
+    {1.077752, 0.207202, 0.031605},
+    {1.137598, 0.276215, 0.028240},
+    {1.142920, 0.275820, 0.000000},
+    {1.013680, 0.037680, 0.000000},
+    {1.010132, 0.040570, -0.042586},
+    {0.988200, -0.052500, 0.000000},
+    {0.984840, -0.048510, -0.049140},
+    {0.975720, -0.037680, -0.087360},
+    {0.953548, -0.135739, -0.055694},
+    {0.944939, -0.121786, -0.099010},
+    {0.956720, -0.140880, 0.000000},
+    {0.907497, -0.216848, -0.061716},
+    {0.899727, -0.199771, -0.109716},
+    {0.888276, -0.174605, -0.144003},
+    {0.932252, -0.101222, -0.129951},
+    {0.874372, -0.144046, -0.164575},
+    {0.822407, -0.237936, -0.155575},
+    {0.811179, -0.202032, -0.177800},
+    {0.831654, -0.267504, -0.118533},
+    {0.837928, -0.287568, -0.066675},
+    {0.910360, -0.223140, 0.000000},
+    {0.732288, -0.320851, -0.124516},
+    {0.726697, -0.287285, -0.163427},
+    {0.719908, -0.246526, -0.186774},
+    {0.712520, -0.202170, -0.194556},
+    {0.798960, -0.162960, -0.185208},
+    {0.705132, -0.157814, -0.186774},
+    {0.593200, -0.225000, -0.198000},
+    {0.593200, -0.176160, -0.190080},
+    {0.593200, -0.273840, -0.190080},
+    {0.593200, -0.318720, -0.166320},
+    {0.593200, -0.355680, -0.126720},
+    {0.736082, -0.343628, -0.070040},
+    {0.593200, -0.380760, -0.071280},
+    {0.737480, -0.352020, 0.000000},
+    {0.840240, -0.294960, 0.000000},
+    {0.593200, -0.390000, 0.000000},
+    {0.593200, -0.131280, -0.166320},
+    {1.123152, 0.277286, 0.050204},
+    {1.226480, 0.330000, 0.027000},
+    {1.208240, 0.330000, 0.048000},
+    {1.038183, 0.127230, 0.036564},
+    {1.065786, 0.210029, 0.056187},
+    {1.101863, 0.278866, 0.065893},
+    {1.181360, 0.330000, 0.063000},
+    {1.230491, 0.340096, 0.047462},
+    {1.202320, 0.339846, 0.062294},
+    {1.233200, 0.330000, 0.000000},
+    {1.249607, 0.340265, 0.026698},
+    {1.246510, 0.348271, 0.046003},
+    {1.217766, 0.347787, 0.060379},
+    {1.168112, 0.339544, 0.071194},
+    {1.182863, 0.347199, 0.069005},
+    {1.148720, 0.330000, 0.072000},
+    {1.130885, 0.339214, 0.074160},
+    {1.144880, 0.346560, 0.071880},
+    {1.192999, 0.352880, 0.065779},
+    {1.155095, 0.351971, 0.068520},
+    {1.227830, 0.353716, 0.057557},
+    {1.266014, 0.348599, 0.025877},
+    {1.256514, 0.354404, 0.043853},
+    {1.232644, 0.357527, 0.054130},
+    {1.198546, 0.356499, 0.061862},
+    {1.161440, 0.355380, 0.064440},
+    {1.117191, 0.351062, 0.065779},
+    {1.124334, 0.354261, 0.061862},
+    {1.106897, 0.345921, 0.069005},
+    {1.082360, 0.350227, 0.057557},
+    {1.090236, 0.353233, 0.054130},
+    {1.128120, 0.355470, 0.057600},
+    {1.095310, 0.354322, 0.050400},
+    {1.163825, 0.356719, 0.060000},
+    {1.199530, 0.357968, 0.057600},
+    {1.162160, 0.355920, 0.055560},
+    {1.128345, 0.354641, 0.053338},
+    {1.097272, 0.353466, 0.046670},
+    {1.068290, 0.353378, 0.038400},
+    {1.071682, 0.352498, 0.035558},
+    {1.062155, 0.352386, 0.041242},
+    {1.049955, 0.352736, 0.021600},
+    {1.054318, 0.351842, 0.020002},
+    {1.071932, 0.349735, 0.032947},
+    {1.055729, 0.349125, 0.018533},
+    {1.095809, 0.350635, 0.043243},
+    {1.124803, 0.351728, 0.049421},
+    {1.090610, 0.345800, 0.040421},
+    {1.068641, 0.345074, 0.030797},
+    {1.053732, 0.344582, 0.017323},
+    {1.049760, 0.348900, 0.000000},
+    {1.048240, 0.344400, 0.000000},
+    {1.047920, 0.351600, 0.000000},
+    {1.043200, 0.352500, 0.000000},
+    {1.036080, 0.351600, 0.000000},
+    {1.043100, 0.351812, 0.023198},
+    {1.027040, 0.348900, 0.000000},
+    {1.043100, 0.351812, -0.023198},
+    {1.049955, 0.352736, -0.021600},
+    {1.043200, 0.352500, 0.000000},
+    {1.027040, 0.348900, 0.000000},
+    {1.034211, 0.349072, 0.024667},
+    {1.053676, 0.349539, 0.043853},
+    {1.023746, 0.344521, 0.025877},
+    {1.043250, 0.344849, 0.046003},
+    {1.016560, 0.344400, 0.000000},
+    {1.012163, 0.338162, 0.026698},
+    {1.031279, 0.338332, 0.047462},
+    {1.059451, 0.338581, 0.062294},
+    {1.071994, 0.345333, 0.060379},
+    {1.093658, 0.338884, 0.071194},
+    {1.045040, 0.330000, 0.063000},
+    {1.077680, 0.330000, 0.072000},
+    {1.018160, 0.330000, 0.048000},
+    {0.999920, 0.330000, 0.027000},
+    {1.005120, 0.338100, 0.000000},
+    {0.993200, 0.330000, 0.000000},
+    {1.012163, 0.338162, -0.026698},
+    {1.023746, 0.344521, -0.025877},
+    {0.999920, 0.330000, -0.027000},
+    {1.031279, 0.338332, -0.047462},
+    {1.043250, 0.344849, -0.046003},
+    {1.034211, 0.349072, -0.024667},
+    {1.053676, 0.349539, -0.043853},
+    {1.071994, 0.345333, -0.060379},
+    {1.082360, 0.350227, -0.057557},
+    {1.018160, 0.330000, -0.048000},
+    {1.059451, 0.338581, -0.062294},
+    {1.106897, 0.345921, -0.069005},
+    {1.117191, 0.351062, -0.065779},
+    {1.090236, 0.353233, -0.054130},
+    {1.124334, 0.354261, -0.061862},
+    {1.062155, 0.352386, -0.041242},
+    {1.095310, 0.354322, -0.050400},
+    {1.128120, 0.355470, -0.057600},
+    {1.161440, 0.355380, -0.064440},
+    {1.163825, 0.356719, -0.060000},
+    {1.155095, 0.351971, -0.068520},
+    {1.093658, 0.338884, -0.071194},
+    {1.144880, 0.346560, -0.071880},
+    {1.192999, 0.352880, -0.065779},
+    {1.198546, 0.356499, -0.061862},
+    {1.199530, 0.357968, -0.057600},
+    {1.162160, 0.355920, -0.055560},
+    {1.195975, 0.357199, -0.053338},
+    {1.128345, 0.354641, -0.053338},
+    {1.156355, 0.352916, -0.051480},
+    {1.187907, 0.354105, -0.049421},
+    {1.227048, 0.358374, -0.046670},
+    {1.216901, 0.355198, -0.043243},
+    {1.232340, 0.359115, -0.050400},
+    {1.232644, 0.357527, -0.054130},
+    {1.259360, 0.360060, -0.038400},
+    {1.252638, 0.359342, -0.035558},
+    {1.240778, 0.356097, -0.032947},
+    {1.202030, 0.349480, -0.040421},
+    {1.223999, 0.350206, -0.030797},
+    {1.175352, 0.348599, -0.046195},
+    {1.182565, 0.341116, -0.038506},
+    {1.202520, 0.341547, -0.029338},
+    {1.238908, 0.350698, -0.017323},
+    {1.216061, 0.341840, -0.016502},
+    {1.256981, 0.356708, -0.018533},
+    {1.270002, 0.359998, -0.020002},
+    {1.262950, 0.356932, 0.000000},
+    {1.244400, 0.350880, 0.000000},
+    {1.221050, 0.341948, 0.000000},
+    {1.188720, 0.330000, -0.016200},
+    {1.193200, 0.330000, 0.000000},
+    {1.176560, 0.330000, -0.028800},
+    {1.158640, 0.330000, -0.037800},
+    {1.158334, 0.340593, -0.044006},
+    {1.136880, 0.330000, -0.043200},
+    {1.146320, 0.347640, -0.048120},
+    {1.131965, 0.340024, -0.045840},
+    {1.113200, 0.330000, -0.045000},
+    {1.117288, 0.346681, -0.046195},
+    {1.105596, 0.339454, -0.044006},
+    {1.124803, 0.351728, -0.049421},
+    {1.095809, 0.350635, -0.043243},
+    {1.090610, 0.345800, -0.040421},
+    {1.081365, 0.338931, -0.038506},
+    {1.089520, 0.330000, -0.043200},
+    {1.071932, 0.349735, -0.032947},
+    {1.068641, 0.345074, -0.030797},
+    {1.097272, 0.353466, -0.046670},
+    {1.071682, 0.352498, -0.035558},
+    {1.068290, 0.353378, -0.038400},
+    {1.054318, 0.351842, -0.020002},
+    {1.055729, 0.349125, -0.018533},
+    {1.053732, 0.344582, -0.017323},
+    {1.061410, 0.338500, -0.029338},
+    {1.047920, 0.351600, 0.000000},
+    {1.049760, 0.348900, 0.000000},
+    {1.048240, 0.344400, 0.000000},
+    {1.047869, 0.338208, -0.016502},
+    {1.042880, 0.338100, 0.000000},
+    {1.037680, 0.330000, -0.016200},
+    {1.049840, 0.330000, -0.028800},
+    {1.033200, 0.330000, 0.000000},
+    {1.042880, 0.338100, 0.000000},
+    {1.047869, 0.338208, 0.016502},
+    {1.037680, 0.330000, 0.016200},
+    {1.061410, 0.338500, 0.029338},
+    {1.049840, 0.330000, 0.028800},
+    {1.081365, 0.338931, 0.038506},
+    {1.067760, 0.330000, 0.037800},
+    {1.117288, 0.346681, 0.046195},
+    {1.105596, 0.339454, 0.044006},
+    {1.156355, 0.352916, 0.051480},
+    {1.146320, 0.347640, 0.048120},
+    {1.131965, 0.340024, 0.045840},
+    {1.089520, 0.330000, 0.043200},
+    {1.187907, 0.354105, 0.049421},
+    {1.175352, 0.348599, 0.046195},
+    {1.195975, 0.357199, 0.053338},
+    {1.227048, 0.358374, 0.046670},
+    {1.216901, 0.355198, 0.043243},
+    {1.202030, 0.349480, 0.040421},
+    {1.158334, 0.340593, 0.044006},
+    {1.113200, 0.330000, 0.045000},
+    {1.182565, 0.341116, 0.038506},
+    {1.136880, 0.330000, 0.043200},
+    {1.240778, 0.356097, 0.032947},
+    {1.223999, 0.350206, 0.030797},
+    {1.252638, 0.359342, 0.035558},
+    {1.232340, 0.359115, 0.050400},
+    {1.259360, 0.360060, 0.038400},
+    {1.277695, 0.360701, 0.021600},
+    {1.270002, 0.359998, 0.020002},
+    {1.256981, 0.356708, 0.018533},
+    {1.238908, 0.350698, 0.017323},
+    {1.202520, 0.341547, 0.029338},
+    {1.158640, 0.330000, 0.037800},
+    {1.216061, 0.341840, 0.016502},
+    {1.176560, 0.330000, 0.028800},
+    {1.262950, 0.356932, 0.000000},
+    {1.244400, 0.350880, 0.000000},
+    {1.276400, 0.360240, 0.000000},
+    {1.284450, 0.360938, 0.000000},
+    {1.286800, 0.359160, 0.000000},
+    {1.283150, 0.355042, 0.000000},
+    {1.275979, 0.354870, -0.024667},
+    {1.279780, 0.358948, -0.023198},
+    {1.284450, 0.360938, 0.000000},
+    {1.279780, 0.358948, 0.023198},
+    {1.273200, 0.348720, 0.000000},
+    {1.266014, 0.348599, -0.025877},
+    {1.275979, 0.354870, 0.024667},
+    {1.246510, 0.348271, -0.046003},
+    {1.256514, 0.354404, -0.043853},
+    {1.260725, 0.358374, -0.041242},
+    {1.277695, 0.360701, -0.021600},
+    {1.276400, 0.360240, 0.000000},
+    {1.227830, 0.353716, -0.057557},
+    {1.217766, 0.347787, -0.060379},
+    {1.230491, 0.340096, -0.047462},
+    {1.202320, 0.339846, -0.062294},
+    {1.168112, 0.339544, -0.071194},
+    {1.182863, 0.347199, -0.069005},
+    {1.130885, 0.339214, -0.074160},
+    {1.148720, 0.330000, -0.072000},
+    {1.113200, 0.330000, -0.075000},
+    {1.181360, 0.330000, -0.063000},
+    {1.208240, 0.330000, -0.048000},
+    {1.249607, 0.340265, -0.026698},
+    {1.226480, 0.330000, -0.027000},
+    {1.256650, 0.340328, 0.000000},
+    {1.260725, 0.358374, 0.041242},
+    {1.077680, 0.330000, -0.072000},
+    {1.045040, 0.330000, -0.063000},
+    {1.221050, 0.341948, 0.000000},
+    {1.188720, 0.330000, 0.016200},
+    {1.067760, 0.330000, -0.037800},
+    {1.113200, 0.330000, 0.075000},
+    {1.019748, 0.284957, 0.075306},
+    {1.047880, 0.282870, 0.078444},
+    {1.045040, 0.330000, 0.063000},
+    {1.076012, 0.280783, 0.075306},
+    {1.003440, 0.224760, 0.087792},
+    {1.026741, 0.219254, 0.084280},
+    {0.980139, 0.230266, 0.084280},
+    {0.993897, 0.286874, 0.065893},
+    {1.018160, 0.330000, 0.048000},
+    {0.958727, 0.235325, 0.073745},
+    {0.972608, 0.288454, 0.050204},
+    {0.952772, 0.169080, 0.097505},
+    {0.973160, 0.159090, 0.101568},
+    {0.993548, 0.149100, 0.097505},
+    {1.012284, 0.139920, 0.085317},
+    {1.048153, 0.214195, 0.073745},
+    {0.969074, 0.074006, 0.113564},
+    {0.986308, 0.059971, 0.099369},
+    {0.950320, 0.089280, 0.118296},
+    {0.931566, 0.104554, 0.113564},
+    {0.934036, 0.178260, 0.085317},
+    {0.941094, 0.239491, 0.056187},
+    {0.914332, 0.118589, 0.099369},
+    {0.918607, 0.185820, 0.065004},
+    {0.910440, 0.039840, 0.131040},
+    {0.928200, 0.018750, 0.136500},
+    {0.945960, -0.002340, 0.131040},
+    {0.962280, -0.021720, 0.114660},
+    {0.916846, -0.076253, 0.148516},
+    {0.932252, -0.101222, 0.129951},
+    {0.900080, -0.049080, 0.154704},
+    {0.883314, -0.021907, 0.148516},
+    {0.894120, 0.059220, 0.114660},
+    {0.900139, 0.130147, 0.075710},
+    {0.867908, 0.003062, 0.129951},
+    {0.880680, 0.075180, 0.087360},
+    {0.844108, -0.077534, 0.164575},
+    {0.859240, -0.110790, 0.171432},
+    {0.874372, -0.144046, 0.164575},
+    {0.888276, -0.174605, 0.144003},
+    {0.811179, -0.202032, 0.177800},
+    {0.822407, -0.237936, 0.155575},
+    {0.798960, -0.162960, 0.185208},
+    {0.786741, -0.123888, 0.177800},
+    {0.830204, -0.046975, 0.144003},
+    {0.855221, 0.023626, 0.099010},
+    {0.775513, -0.087984, 0.155575},
+    {0.818753, -0.021809, 0.109716},
+    {0.705132, -0.157814, 0.186774},
+    {0.712520, -0.202170, 0.194556},
+    {0.719908, -0.246526, 0.186774},
+    {0.726697, -0.287285, 0.163427},
+    {0.593200, -0.273840, 0.190080},
+    {0.593200, -0.318720, 0.166320},
+    {0.593200, -0.225000, 0.198000},
+    {0.593200, -0.176160, 0.190080},
+    {0.698343, -0.117055, 0.163427},
+    {0.766266, -0.058416, 0.118533},
+    {0.593200, -0.131280, 0.166320},
+    {0.692752, -0.083489, 0.124516},
+    {0.759992, -0.038352, 0.066675},
+    {0.810983, -0.004732, 0.061716},
+    {0.593200, -0.094320, 0.126720},
+    {0.688958, -0.060712, 0.070040},
+    {0.757680, -0.030960, 0.000000},
+    {0.808120, 0.001560, 0.000000},
+    {0.846612, 0.037579, 0.055694},
+    {0.843440, 0.042720, 0.000000},
+    {0.871560, 0.086010, 0.049140},
+    {0.868200, 0.090000, 0.000000},
+    {0.890508, 0.137990, 0.042586},
+    {0.886960, 0.140880, 0.000000},
+    {0.908137, 0.190950, 0.036564},
+    {0.904280, 0.192840, 0.000000},
+    {0.929128, 0.242318, 0.031605},
+    {0.924720, 0.243360, 0.000000},
+    {0.958162, 0.289525, 0.028240},
+    {0.952840, 0.289920, 0.000000},
+    {0.904280, 0.192840, 0.000000},
+    {0.929128, 0.242318, -0.031605},
+    {0.958162, 0.289525, -0.028240},
+    {0.952840, 0.289920, 0.000000},
+    {0.886960, 0.140880, 0.000000},
+    {0.908137, 0.190950, -0.036564},
+    {0.941094, 0.239491, -0.056187},
+    {0.972608, 0.288454, -0.050204},
+    {0.999920, 0.330000, -0.027000},
+    {1.018160, 0.330000, -0.048000},
+    {0.993200, 0.330000, 0.000000},
+    {1.045040, 0.330000, -0.063000},
+    {0.993897, 0.286874, -0.065893},
+    {0.918607, 0.185820, -0.065004},
+    {0.958727, 0.235325, -0.073745},
+    {0.890508, 0.137990, -0.042586},
+    {0.868200, 0.090000, 0.000000},
+    {0.871560, 0.086010, -0.049140},
+    {0.900139, 0.130147, -0.075710},
+    {0.934036, 0.178260, -0.085317},
+    {0.980139, 0.230266, -0.084280},
+    {1.019748, 0.284957, -0.075306},
+    {1.077680, 0.330000, -0.072000},
+    {1.047880, 0.282870, -0.078444},
+    {1.113200, 0.330000, -0.075000},
+    {0.808120, 0.001560, 0.000000},
+    {0.843440, 0.042720, 0.000000},
+    {1.148720, 0.330000, -0.072000},
+    {0.993200, 0.330000, 0.000000},
+    {0.999920, 0.330000, 0.027000},
+    {0.687560, -0.052320, 0.000000},
+    {0.593200, -0.060000, 0.000000},
+    {0.593200, -0.069240, 0.071280},
+    {0.593200, -0.355680, 0.126720},
+    {0.732288, -0.320851, 0.124516},
+    {0.593200, -0.380760, 0.071280},
+    {0.736082, -0.343628, 0.070040},
+    {0.831654, -0.267504, 0.118533},
+    {0.837928, -0.287568, 0.066675},
+    {0.899727, -0.199771, 0.109716},
+    {0.593200, -0.390000, 0.000000},
+    {0.737480, -0.352020, 0.000000},
+    {0.840240, -0.294960, 0.000000},
+    {0.907497, -0.216848, 0.061716},
+    {0.944939, -0.121786, 0.099010},
+    {0.910360, -0.223140, 0.000000},
+    {0.953548, -0.135739, 0.055694},
+    {0.975720, -0.037680, 0.087360},
+    {0.956720, -0.140880, 0.000000},
+    {0.984840, -0.048510, 0.049140},
+    {1.000501, 0.048413, 0.075710},
+    {0.988200, -0.052500, 0.000000},
+    {1.010132, 0.040570, 0.042586},
+    {1.027713, 0.132360, 0.065004},
+    {1.013680, 0.037680, 0.000000},
+    {-0.086800, 0.630000, 0.000000},
+    {-0.008960, 0.626580, 0.000000},
+    {-0.009957, 0.626580, -0.012819},
+    {-0.012852, 0.626580, -0.024909},
+    {-0.017498, 0.626580, -0.036122},
+    {-0.023750, 0.626580, -0.046315},
+    {-0.031461, 0.626580, -0.055339},
+    {-0.040485, 0.626580, -0.063050},
+    {-0.050678, 0.626580, -0.069302},
+    {-0.061891, 0.626580, -0.073948},
+    {-0.073981, 0.626580, -0.076843},
+    {-0.086800, 0.626580, -0.077840},
+    {-0.086800, 0.626580, -0.077840},
+    {-0.099619, 0.626580, -0.076843},
+    {-0.111709, 0.626580, -0.073948},
+    {-0.122922, 0.626580, -0.069302},
+    {-0.133115, 0.626580, -0.063050},
+    {-0.142139, 0.626580, -0.055339},
+    {-0.149850, 0.626580, -0.046315},
+    {-0.156102, 0.626580, -0.036122},
+    {-0.160748, 0.626580, -0.024909},
+    {-0.163643, 0.626580, -0.012819},
+    {-0.164640, 0.626580, 0.000000},
+    {-0.164640, 0.626580, 0.000000},
+    {-0.163643, 0.626580, 0.012819},
+    {-0.160748, 0.626580, 0.024909},
+    {-0.156102, 0.626580, 0.036122},
+    {-0.149850, 0.626580, 0.046315},
+    {-0.142139, 0.626580, 0.055339},
+    {-0.133115, 0.626580, 0.063050},
+    {-0.122922, 0.626580, 0.069302},
+    {-0.111709, 0.626580, 0.073948},
+    {-0.099619, 0.626580, 0.076843},
+    {-0.086800, 0.626580, 0.077840},
+    {-0.086800, 0.626580, 0.077840},
+    {-0.073981, 0.626580, 0.076843},
+    {-0.061891, 0.626580, 0.073948},
+    {-0.050678, 0.626580, 0.069302},
+    {-0.040485, 0.626580, 0.063050},
+    {-0.031461, 0.626580, 0.055339},
+    {-0.023750, 0.626580, 0.046315},
+    {-0.017498, 0.626580, 0.036122},
+    {-0.012852, 0.626580, 0.024909},
+    {-0.009957, 0.626580, 0.012819},
+    {-0.008960, 0.626580, -0.000000},
+    {-0.086800, 0.617040, 0.123520},
+    {-0.107142, 0.617040, 0.121937},
+    {-0.086800, 0.602460, 0.143280},
+    {-0.126326, 0.617040, 0.117344},
+    {-0.110395, 0.602460, 0.141444},
+    {-0.086800, 0.583920, 0.143360},
+    {-0.132648, 0.602460, 0.136116},
+    {-0.110406, 0.583920, 0.141523},
+    {-0.144120, 0.617040, 0.109971},
+    {-0.153288, 0.602460, 0.127563},
+    {-0.132670, 0.583920, 0.136191},
+    {-0.108203, 0.562500, 0.128334},
+    {-0.086800, 0.562500, 0.130000},
+    {-0.153322, 0.583920, 0.127633},
+    {-0.128390, 0.562500, 0.123498},
+    {-0.160294, 0.617040, 0.100051},
+    {-0.172049, 0.602460, 0.116055},
+    {-0.174614, 0.617040, 0.087814},
+    {-0.188661, 0.602460, 0.101861},
+    {-0.172094, 0.583920, 0.116118},
+    {-0.147117, 0.562500, 0.115736},
+    {-0.121804, 0.539280, 0.103964},
+    {-0.104813, 0.539280, 0.108037},
+    {-0.164139, 0.562500, 0.105293},
+    {-0.137568, 0.539280, 0.097428},
+    {-0.188715, 0.583920, 0.101915},
+    {-0.186851, 0.617040, 0.073494},
+    {-0.202855, 0.602460, 0.085249},
+    {-0.196771, 0.617040, 0.057320},
+    {-0.214363, 0.602460, 0.066488},
+    {-0.202918, 0.583920, 0.085294},
+    {-0.179212, 0.562500, 0.092412},
+    {-0.151898, 0.539280, 0.088634},
+    {-0.192093, 0.562500, 0.077339},
+    {-0.164589, 0.539280, 0.077789},
+    {-0.214433, 0.583920, 0.066522},
+    {-0.204144, 0.617040, 0.039526},
+    {-0.222916, 0.602460, 0.045848},
+    {-0.208737, 0.617040, 0.020342},
+    {-0.228244, 0.602460, 0.023595},
+    {-0.222991, 0.583920, 0.045870},
+    {-0.202536, 0.562500, 0.060317},
+    {-0.175434, 0.539280, 0.065098},
+    {-0.210298, 0.562500, 0.041590},
+    {-0.184228, 0.539280, 0.050768},
+    {-0.228323, 0.583920, 0.023606},
+    {-0.210320, 0.617040, 0.000000},
+    {-0.230080, 0.602460, 0.000000},
+    {-0.230160, 0.583920, 0.000000},
+    {-0.215134, 0.562500, 0.021403},
+    {-0.190764, 0.539280, 0.035004},
+    {-0.165063, 0.515340, 0.040770},
+    {-0.157996, 0.515340, 0.052283},
+    {-0.149280, 0.515340, 0.062480},
+    {-0.144831, 0.491760, 0.042605},
+    {-0.137722, 0.491760, 0.050922},
+    {-0.170318, 0.515340, 0.028108},
+    {-0.150598, 0.491760, 0.033219},
+    {-0.194837, 0.539280, 0.018013},
+    {-0.216800, 0.562500, 0.000000},
+    {-0.196240, 0.539280, 0.000000},
+    {-0.173592, 0.515340, 0.014463},
+    {-0.154886, 0.491760, 0.022898},
+    {-0.146388, 0.469620, 0.031009},
+    {-0.140996, 0.469620, 0.039778},
+    {-0.134350, 0.469620, 0.047550},
+    {-0.151542, 0.450000, 0.047514},
+    {-0.143600, 0.450000, 0.056800},
+    {-0.150398, 0.469620, 0.021371},
+    {-0.157987, 0.450000, 0.037037},
+    {-0.157559, 0.491760, 0.011780},
+    {-0.174720, 0.515340, 0.000000},
+    {-0.158480, 0.491760, 0.000000},
+    {-0.152898, 0.469620, 0.010992},
+    {-0.162781, 0.450000, 0.025523},
+    {-0.153760, 0.469620, 0.000000},
+    {-0.165770, 0.450000, 0.013126},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.134314, 0.450000, 0.064742},
+    {-0.126578, 0.469620, 0.054196},
+    {-0.123837, 0.450000, 0.071187},
+    {-0.129405, 0.491760, 0.058031},
+    {-0.117809, 0.469620, 0.059588},
+    {-0.112323, 0.450000, 0.075981},
+    {-0.120019, 0.491760, 0.063798},
+    {-0.108171, 0.469620, 0.063598},
+    {-0.139083, 0.515340, 0.071196},
+    {-0.127570, 0.515340, 0.078263},
+    {-0.109698, 0.491760, 0.068086},
+    {-0.097792, 0.469620, 0.066098},
+    {-0.099926, 0.450000, 0.078970},
+    {-0.114908, 0.515340, 0.083518},
+    {-0.098580, 0.491760, 0.070759},
+    {-0.101263, 0.515340, 0.086792},
+    {-0.086800, 0.491760, 0.071680},
+    {-0.086800, 0.469620, 0.066960},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.086800, 0.515340, 0.087920},
+    {-0.086800, 0.539280, 0.109440},
+    {0.036720, 0.617040, -0.000000},
+    {0.035137, 0.617040, 0.020342},
+    {0.056480, 0.602460, -0.000000},
+    {0.030544, 0.617040, 0.039526},
+    {0.054644, 0.602460, 0.023595},
+    {0.056560, 0.583920, 0.000000},
+    {0.049316, 0.602460, 0.045848},
+    {0.054723, 0.583920, 0.023606},
+    {0.023171, 0.617040, 0.057320},
+    {0.040763, 0.602460, 0.066488},
+    {0.049391, 0.583920, 0.045870},
+    {0.041534, 0.562500, 0.021403},
+    {0.043200, 0.562500, -0.000000},
+    {0.040833, 0.583920, 0.066522},
+    {0.036698, 0.562500, 0.041590},
+    {0.013251, 0.617040, 0.073494},
+    {0.029255, 0.602460, 0.085249},
+    {0.001014, 0.617040, 0.087814},
+    {0.015061, 0.602460, 0.101861},
+    {0.029318, 0.583920, 0.085294},
+    {0.028936, 0.562500, 0.060317},
+    {0.017164, 0.539280, 0.035004},
+    {0.021237, 0.539280, 0.018013},
+    {0.018493, 0.562500, 0.077339},
+    {0.010628, 0.539280, 0.050768},
+    {0.015115, 0.583920, 0.101915},
+    {-0.013306, 0.617040, 0.100051},
+    {-0.001551, 0.602460, 0.116055},
+    {-0.029480, 0.617040, 0.109971},
+    {-0.020312, 0.602460, 0.127563},
+    {-0.001506, 0.583920, 0.116118},
+    {0.005612, 0.562500, 0.092412},
+    {0.001834, 0.539280, 0.065098},
+    {-0.009461, 0.562500, 0.105293},
+    {-0.009011, 0.539280, 0.077789},
+    {-0.020278, 0.583920, 0.127633},
+    {-0.047274, 0.617040, 0.117344},
+    {-0.040952, 0.602460, 0.136116},
+    {-0.066458, 0.617040, 0.121937},
+    {-0.063205, 0.602460, 0.141444},
+    {-0.040930, 0.583920, 0.136191},
+    {-0.026483, 0.562500, 0.115736},
+    {-0.021702, 0.539280, 0.088634},
+    {-0.045210, 0.562500, 0.123498},
+    {-0.036032, 0.539280, 0.097428},
+    {-0.063194, 0.583920, 0.141523},
+    {-0.086800, 0.617040, 0.123520},
+    {-0.086800, 0.602460, 0.143280},
+    {-0.086800, 0.583920, 0.143360},
+    {-0.065397, 0.562500, 0.128334},
+    {-0.051796, 0.539280, 0.103964},
+    {-0.046030, 0.515340, 0.078263},
+    {-0.034517, 0.515340, 0.071196},
+    {-0.024320, 0.515340, 0.062480},
+    {-0.044195, 0.491760, 0.058031},
+    {-0.035878, 0.491760, 0.050922},
+    {-0.058692, 0.515340, 0.083518},
+    {-0.053581, 0.491760, 0.063798},
+    {-0.068787, 0.539280, 0.108037},
+    {-0.086800, 0.562500, 0.130000},
+    {-0.086800, 0.539280, 0.109440},
+    {-0.072337, 0.515340, 0.086792},
+    {-0.063902, 0.491760, 0.068086},
+    {-0.055791, 0.469620, 0.059588},
+    {-0.047022, 0.469620, 0.054196},
+    {-0.039250, 0.469620, 0.047550},
+    {-0.039286, 0.450000, 0.064742},
+    {-0.030000, 0.450000, 0.056800},
+    {-0.065429, 0.469620, 0.063598},
+    {-0.049763, 0.450000, 0.071187},
+    {-0.075020, 0.491760, 0.070759},
+    {-0.086800, 0.515340, 0.087920},
+    {-0.086800, 0.491760, 0.071680},
+    {-0.075808, 0.469620, 0.066098},
+    {-0.061277, 0.450000, 0.075981},
+    {-0.086800, 0.469620, 0.066960},
+    {-0.073674, 0.450000, 0.078970},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.022058, 0.450000, 0.047514},
+    {-0.032604, 0.469620, 0.039778},
+    {-0.015613, 0.450000, 0.037037},
+    {-0.028769, 0.491760, 0.042605},
+    {-0.027212, 0.469620, 0.031009},
+    {-0.010819, 0.450000, 0.025523},
+    {-0.023002, 0.491760, 0.033219},
+    {-0.023202, 0.469620, 0.021371},
+    {-0.015604, 0.515340, 0.052283},
+    {-0.008537, 0.515340, 0.040770},
+    {-0.018714, 0.491760, 0.022898},
+    {-0.020702, 0.469620, 0.010992},
+    {-0.007830, 0.450000, 0.013126},
+    {-0.003282, 0.515340, 0.028108},
+    {-0.016041, 0.491760, 0.011780},
+    {-0.000008, 0.515340, 0.014463},
+    {-0.015120, 0.491760, -0.000000},
+    {-0.019840, 0.469620, -0.000000},
+    {-0.006800, 0.450000, -0.000000},
+    {0.001120, 0.515340, -0.000000},
+    {0.022640, 0.539280, -0.000000},
+    {-0.210320, 0.617040, 0.000000},
+    {-0.208737, 0.617040, -0.020342},
+    {-0.230080, 0.602460, 0.000000},
+    {-0.204144, 0.617040, -0.039526},
+    {-0.228244, 0.602460, -0.023595},
+    {-0.230160, 0.583920, 0.000000},
+    {-0.222916, 0.602460, -0.045848},
+    {-0.228323, 0.583920, -0.023606},
+    {-0.196771, 0.617040, -0.057320},
+    {-0.214363, 0.602460, -0.066488},
+    {-0.222991, 0.583920, -0.045870},
+    {-0.215134, 0.562500, -0.021403},
+    {-0.216800, 0.562500, 0.000000},
+    {-0.214433, 0.583920, -0.066522},
+    {-0.210298, 0.562500, -0.041590},
+    {-0.186851, 0.617040, -0.073494},
+    {-0.202855, 0.602460, -0.085249},
+    {-0.174614, 0.617040, -0.087814},
+    {-0.188661, 0.602460, -0.101861},
+    {-0.202918, 0.583920, -0.085294},
+    {-0.202536, 0.562500, -0.060317},
+    {-0.190764, 0.539280, -0.035004},
+    {-0.194837, 0.539280, -0.018013},
+    {-0.192093, 0.562500, -0.077339},
+    {-0.184228, 0.539280, -0.050768},
+    {-0.188715, 0.583920, -0.101915},
+    {-0.160294, 0.617040, -0.100051},
+    {-0.172049, 0.602460, -0.116055},
+    {-0.144120, 0.617040, -0.109971},
+    {-0.153288, 0.602460, -0.127563},
+    {-0.172094, 0.583920, -0.116118},
+    {-0.179212, 0.562500, -0.092412},
+    {-0.175434, 0.539280, -0.065098},
+    {-0.164139, 0.562500, -0.105293},
+    {-0.164589, 0.539280, -0.077789},
+    {-0.153322, 0.583920, -0.127633},
+    {-0.126326, 0.617040, -0.117344},
+    {-0.132648, 0.602460, -0.136116},
+    {-0.107142, 0.617040, -0.121937},
+    {-0.110395, 0.602460, -0.141444},
+    {-0.132670, 0.583920, -0.136191},
+    {-0.147117, 0.562500, -0.115736},
+    {-0.151898, 0.539280, -0.088634},
+    {-0.128390, 0.562500, -0.123498},
+    {-0.137568, 0.539280, -0.097428},
+    {-0.110406, 0.583920, -0.141523},
+    {-0.086800, 0.617040, -0.123520},
+    {-0.086800, 0.602460, -0.143280},
+    {-0.086800, 0.583920, -0.143360},
+    {-0.108203, 0.562500, -0.128334},
+    {-0.121804, 0.539280, -0.103964},
+    {-0.127570, 0.515340, -0.078263},
+    {-0.139083, 0.515340, -0.071196},
+    {-0.149280, 0.515340, -0.062480},
+    {-0.129405, 0.491760, -0.058031},
+    {-0.137722, 0.491760, -0.050922},
+    {-0.114908, 0.515340, -0.083518},
+    {-0.120019, 0.491760, -0.063798},
+    {-0.104813, 0.539280, -0.108037},
+    {-0.086800, 0.562500, -0.130000},
+    {-0.086800, 0.539280, -0.109440},
+    {-0.101263, 0.515340, -0.086792},
+    {-0.109698, 0.491760, -0.068086},
+    {-0.117809, 0.469620, -0.059588},
+    {-0.126578, 0.469620, -0.054196},
+    {-0.134350, 0.469620, -0.047550},
+    {-0.134314, 0.450000, -0.064742},
+    {-0.143600, 0.450000, -0.056800},
+    {-0.108171, 0.469620, -0.063598},
+    {-0.123837, 0.450000, -0.071187},
+    {-0.098580, 0.491760, -0.070759},
+    {-0.086800, 0.515340, -0.087920},
+    {-0.086800, 0.491760, -0.071680},
+    {-0.097792, 0.469620, -0.066098},
+    {-0.112323, 0.450000, -0.075981},
+    {-0.086800, 0.469620, -0.066960},
+    {-0.099926, 0.450000, -0.078970},
+    {-0.086800, 0.450000, -0.080000},
+    {-0.151542, 0.450000, -0.047514},
+    {-0.140996, 0.469620, -0.039778},
+    {-0.157987, 0.450000, -0.037037},
+    {-0.144831, 0.491760, -0.042605},
+    {-0.146388, 0.469620, -0.031009},
+    {-0.162781, 0.450000, -0.025523},
+    {-0.150598, 0.491760, -0.033219},
+    {-0.150398, 0.469620, -0.021371},
+    {-0.157996, 0.515340, -0.052283},
+    {-0.165063, 0.515340, -0.040770},
+    {-0.154886, 0.491760, -0.022898},
+    {-0.152898, 0.469620, -0.010992},
+    {-0.165770, 0.450000, -0.013126},
+    {-0.170318, 0.515340, -0.028108},
+    {-0.157559, 0.491760, -0.011780},
+    {-0.173592, 0.515340, -0.014463},
+    {-0.158480, 0.491760, 0.000000},
+    {-0.153760, 0.469620, 0.000000},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.174720, 0.515340, 0.000000},
+    {-0.196240, 0.539280, 0.000000},
+    {-0.086800, 0.617040, -0.123520},
+    {-0.066458, 0.617040, -0.121937},
+    {-0.086800, 0.602460, -0.143280},
+    {-0.047274, 0.617040, -0.117344},
+    {-0.063205, 0.602460, -0.141444},
+    {-0.086800, 0.583920, -0.143360},
+    {-0.040952, 0.602460, -0.136116},
+    {-0.063194, 0.583920, -0.141523},
+    {-0.029480, 0.617040, -0.109971},
+    {-0.020312, 0.602460, -0.127563},
+    {-0.040930, 0.583920, -0.136191},
+    {-0.065397, 0.562500, -0.128334},
+    {-0.086800, 0.562500, -0.130000},
+    {-0.020278, 0.583920, -0.127633},
+    {-0.045210, 0.562500, -0.123498},
+    {-0.013306, 0.617040, -0.100051},
+    {-0.001551, 0.602460, -0.116055},
+    {0.001014, 0.617040, -0.087814},
+    {0.015061, 0.602460, -0.101861},
+    {-0.001506, 0.583920, -0.116118},
+    {-0.026483, 0.562500, -0.115736},
+    {-0.051796, 0.539280, -0.103964},
+    {-0.068787, 0.539280, -0.108037},
+    {-0.009461, 0.562500, -0.105293},
+    {-0.036032, 0.539280, -0.097428},
+    {0.015115, 0.583920, -0.101915},
+    {0.013251, 0.617040, -0.073494},
+    {0.029255, 0.602460, -0.085249},
+    {0.023171, 0.617040, -0.057320},
+    {0.040763, 0.602460, -0.066488},
+    {0.029318, 0.583920, -0.085294},
+    {0.005612, 0.562500, -0.092412},
+    {-0.021702, 0.539280, -0.088634},
+    {0.018493, 0.562500, -0.077339},
+    {-0.009011, 0.539280, -0.077789},
+    {0.040833, 0.583920, -0.066522},
+    {0.030544, 0.617040, -0.039526},
+    {0.049316, 0.602460, -0.045848},
+    {0.035137, 0.617040, -0.020342},
+    {0.054644, 0.602460, -0.023595},
+    {0.049391, 0.583920, -0.045870},
+    {0.028936, 0.562500, -0.060317},
+    {0.001834, 0.539280, -0.065098},
+    {0.036698, 0.562500, -0.041590},
+    {0.010628, 0.539280, -0.050768},
+    {0.054723, 0.583920, -0.023606},
+    {0.036720, 0.617040, 0.000000},
+    {0.056480, 0.602460, 0.000000},
+    {0.056560, 0.583920, 0.000000},
+    {0.041534, 0.562500, -0.021403},
+    {0.017164, 0.539280, -0.035004},
+    {-0.008537, 0.515340, -0.040770},
+    {-0.015604, 0.515340, -0.052283},
+    {-0.024320, 0.515340, -0.062480},
+    {-0.028769, 0.491760, -0.042605},
+    {-0.035878, 0.491760, -0.050922},
+    {-0.003282, 0.515340, -0.028108},
+    {-0.023002, 0.491760, -0.033219},
+    {0.021237, 0.539280, -0.018013},
+    {0.043200, 0.562500, 0.000000},
+    {0.022640, 0.539280, 0.000000},
+    {-0.000008, 0.515340, -0.014463},
+    {-0.018714, 0.491760, -0.022898},
+    {-0.027212, 0.469620, -0.031009},
+    {-0.032604, 0.469620, -0.039778},
+    {-0.039250, 0.469620, -0.047550},
+    {-0.022058, 0.450000, -0.047514},
+    {-0.030000, 0.450000, -0.056800},
+    {-0.023202, 0.469620, -0.021371},
+    {-0.015613, 0.450000, -0.037037},
+    {-0.016041, 0.491760, -0.011780},
+    {0.001120, 0.515340, 0.000000},
+    {-0.015120, 0.491760, 0.000000},
+    {-0.020702, 0.469620, -0.010992},
+    {-0.010819, 0.450000, -0.025523},
+    {-0.019840, 0.469620, 0.000000},
+    {-0.007830, 0.450000, -0.013126},
+    {-0.006800, 0.450000, 0.000000},
+    {-0.039286, 0.450000, -0.064742},
+    {-0.047022, 0.469620, -0.054196},
+    {-0.049763, 0.450000, -0.071187},
+    {-0.044195, 0.491760, -0.058031},
+    {-0.055791, 0.469620, -0.059588},
+    {-0.061277, 0.450000, -0.075981},
+    {-0.053581, 0.491760, -0.063798},
+    {-0.065429, 0.469620, -0.063598},
+    {-0.034517, 0.515340, -0.071196},
+    {-0.046030, 0.515340, -0.078263},
+    {-0.063902, 0.491760, -0.068086},
+    {-0.075808, 0.469620, -0.066098},
+    {-0.073674, 0.450000, -0.078970},
+    {-0.058692, 0.515340, -0.083518},
+    {-0.075020, 0.491760, -0.070759},
+    {-0.072337, 0.515340, -0.086792},
+    {-0.086800, 0.491760, -0.071680},
+    {-0.086800, 0.469620, -0.066960},
+    {-0.086800, 0.450000, -0.080000},
+    {-0.086800, 0.515340, -0.087920},
+    {-0.086800, 0.539280, -0.109440},
+    {0.023520, 0.433680, -0.018338},
+    {-0.007830, 0.450000, -0.013126},
+    {-0.006800, 0.450000, 0.000000},
+    {0.024960, 0.433680, 0.000000},
+    {0.019345, 0.433680, -0.035656},
+    {0.067664, 0.420240, -0.025675},
+    {0.061818, 0.420240, -0.049923},
+    {-0.010819, 0.450000, -0.025523},
+    {0.012648, 0.433680, -0.051740},
+    {0.052442, 0.420240, -0.072444},
+    {0.112954, 0.408960, -0.067100},
+    {0.100351, 0.408960, -0.097370},
+    {0.069680, 0.420240, 0.000000},
+    {0.120811, 0.408960, -0.034509},
+    {0.169103, 0.399120, -0.085962},
+    {0.152958, 0.399120, -0.124740},
+    {0.083408, 0.408960, -0.124913},
+    {0.131252, 0.399120, -0.160026},
+    {0.039836, 0.420240, -0.092937},
+    {0.062527, 0.408960, -0.149327},
+    {0.104502, 0.399120, -0.191302},
+    {0.180262, 0.390000, -0.195994},
+    {0.147500, 0.390000, -0.234300},
+    {0.206847, 0.390000, -0.152777},
+    {0.179170, 0.399120, -0.044210},
+    {0.226621, 0.390000, -0.105283},
+    {0.258600, 0.380880, -0.179702},
+    {0.227330, 0.380880, -0.230536},
+    {0.188794, 0.380880, -0.275594},
+    {0.109194, 0.390000, -0.267062},
+    {0.143736, 0.380880, -0.314130},
+    {0.073226, 0.399120, -0.218052},
+    {0.065977, 0.390000, -0.293647},
+    {0.092902, 0.380880, -0.345400},
+    {0.174572, 0.371040, -0.356148},
+    {0.116940, 0.371040, -0.391601},
+    {0.225657, 0.371040, -0.312457},
+    {0.269348, 0.371040, -0.261372},
+    {0.255363, 0.359760, -0.342163},
+    {0.199422, 0.359760, -0.390008},
+    {0.136310, 0.359760, -0.428832},
+    {0.053603, 0.371040, -0.417970},
+    {0.066952, 0.359760, -0.457708},
+    {0.037038, 0.380880, -0.368659},
+    {-0.014592, 0.371040, -0.434412},
+    {-0.007726, 0.359760, -0.475713},
+    {0.075859, 0.346320, -0.484226},
+    {-0.003146, 0.346320, -0.503273},
+    {0.149236, 0.346320, -0.453676},
+    {0.216004, 0.346320, -0.412603},
+    {0.153939, 0.330000, -0.462717},
+    {0.079101, 0.330000, -0.493875},
+    {-0.001478, 0.330000, -0.513302},
+    {-0.086800, 0.346320, -0.509840},
+    {-0.086800, 0.330000, -0.520000},
+    {-0.086800, 0.359760, -0.481920},
+    {-0.086800, 0.371040, -0.440080},
+    {-0.086800, 0.380880, -0.388160},
+    {-0.023111, 0.380880, -0.383160},
+    {-0.086800, 0.390000, -0.330000},
+    {-0.032654, 0.390000, -0.325750},
+    {0.018483, 0.390000, -0.313421},
+    {-0.042590, 0.399120, -0.265970},
+    {-0.000838, 0.399120, -0.255903},
+    {-0.086800, 0.399120, -0.269440},
+    {-0.052291, 0.408960, -0.207611},
+    {-0.019700, 0.408960, -0.199754},
+    {0.010570, 0.408960, -0.187151},
+    {0.037940, 0.399120, -0.239758},
+    {0.038113, 0.408960, -0.170208},
+    {-0.014356, 0.420240, -0.139242},
+    {0.006137, 0.420240, -0.126636},
+    {-0.036877, 0.420240, -0.148618},
+    {-0.061125, 0.420240, -0.154464},
+    {-0.086800, 0.408960, -0.210320},
+    {-0.051144, 0.433680, -0.106145},
+    {-0.035060, 0.433680, -0.099448},
+    {-0.020424, 0.433680, -0.090445},
+    {-0.007450, 0.433680, -0.079350},
+    {0.024301, 0.420240, -0.111101},
+    {0.003645, 0.433680, -0.066376},
+    {-0.030000, 0.450000, -0.056800},
+    {-0.022058, 0.450000, -0.047514},
+    {-0.039286, 0.450000, -0.064742},
+    {-0.049763, 0.450000, -0.071187},
+    {-0.061277, 0.450000, -0.075981},
+    {-0.068462, 0.433680, -0.110320},
+    {-0.073674, 0.450000, -0.078970},
+    {-0.086800, 0.433680, -0.111760},
+    {-0.086800, 0.420240, -0.156480},
+    {-0.086800, 0.450000, -0.080000},
+    {-0.086800, 0.450000, -0.080000},
+    {-0.105138, 0.433680, -0.110320},
+    {-0.112475, 0.420240, -0.154464},
+    {-0.086800, 0.420240, -0.156480},
+    {-0.099926, 0.450000, -0.078970},
+    {-0.122456, 0.433680, -0.106145},
+    {-0.136723, 0.420240, -0.148618},
+    {-0.121309, 0.408960, -0.207611},
+    {-0.153900, 0.408960, -0.199754},
+    {-0.086800, 0.408960, -0.210320},
+    {-0.131010, 0.399120, -0.265970},
+    {-0.172762, 0.399120, -0.255903},
+    {-0.184170, 0.408960, -0.187151},
+    {-0.211540, 0.399120, -0.239758},
+    {-0.159244, 0.420240, -0.139242},
+    {-0.112323, 0.450000, -0.075981},
+    {-0.138540, 0.433680, -0.099448},
+    {-0.179737, 0.420240, -0.126636},
+    {-0.211713, 0.408960, -0.170208},
+    {-0.246826, 0.399120, -0.218052},
+    {-0.239577, 0.390000, -0.293647},
+    {-0.282794, 0.390000, -0.267062},
+    {-0.192083, 0.390000, -0.313421},
+    {-0.266502, 0.380880, -0.345400},
+    {-0.317336, 0.380880, -0.314130},
+    {-0.321100, 0.390000, -0.234300},
+    {-0.362394, 0.380880, -0.275594},
+    {-0.278102, 0.399120, -0.191302},
+    {-0.236127, 0.408960, -0.149327},
+    {-0.304852, 0.399120, -0.160026},
+    {-0.353862, 0.390000, -0.195994},
+    {-0.400930, 0.380880, -0.230536},
+    {-0.399257, 0.371040, -0.312457},
+    {-0.442948, 0.371040, -0.261372},
+    {-0.348172, 0.371040, -0.356148},
+    {-0.428963, 0.359760, -0.342163},
+    {-0.476808, 0.359760, -0.286222},
+    {-0.478401, 0.371040, -0.203740},
+    {-0.515632, 0.359760, -0.223110},
+    {-0.432200, 0.380880, -0.179702},
+    {-0.380447, 0.390000, -0.152777},
+    {-0.455459, 0.380880, -0.123838},
+    {-0.504770, 0.371040, -0.140403},
+    {-0.544508, 0.359760, -0.153752},
+    {-0.540476, 0.346320, -0.236036},
+    {-0.571026, 0.346320, -0.162659},
+    {-0.499403, 0.346320, -0.302804},
+    {-0.549517, 0.330000, -0.240739},
+    {-0.580675, 0.330000, -0.165901},
+    {-0.590073, 0.346320, -0.083654},
+    {-0.600102, 0.330000, -0.085322},
+    {-0.562513, 0.359760, -0.079074},
+    {-0.521212, 0.371040, -0.072208},
+    {-0.568720, 0.359760, 0.000000},
+    {-0.596640, 0.346320, 0.000000},
+    {-0.606800, 0.330000, 0.000000},
+    {-0.526880, 0.371040, 0.000000},
+    {-0.469960, 0.380880, -0.063689},
+    {-0.474960, 0.380880, 0.000000},
+    {-0.412550, 0.390000, -0.054146},
+    {-0.400221, 0.390000, -0.105283},
+    {-0.342703, 0.399120, -0.085962},
+    {-0.326558, 0.399120, -0.124740},
+    {-0.352770, 0.399120, -0.044210},
+    {-0.416800, 0.390000, 0.000000},
+    {-0.286554, 0.408960, -0.067100},
+    {-0.273951, 0.408960, -0.097370},
+    {-0.257008, 0.408960, -0.124913},
+    {-0.226042, 0.420240, -0.072444},
+    {-0.213436, 0.420240, -0.092937},
+    {-0.235418, 0.420240, -0.049923},
+    {-0.294411, 0.408960, -0.034509},
+    {-0.356240, 0.399120, 0.000000},
+    {-0.241264, 0.420240, -0.025675},
+    {-0.297120, 0.408960, 0.000000},
+    {-0.192945, 0.433680, -0.035656},
+    {-0.186248, 0.433680, -0.051740},
+    {-0.177245, 0.433680, -0.066376},
+    {-0.166150, 0.433680, -0.079350},
+    {-0.197901, 0.420240, -0.111101},
+    {-0.151542, 0.450000, -0.047514},
+    {-0.143600, 0.450000, -0.056800},
+    {-0.157987, 0.450000, -0.037037},
+    {-0.162781, 0.450000, -0.025523},
+    {-0.197120, 0.433680, -0.018338},
+    {-0.243280, 0.420240, 0.000000},
+    {-0.165770, 0.450000, -0.013126},
+    {-0.198560, 0.433680, 0.000000},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.197120, 0.433680, 0.018338},
+    {-0.241264, 0.420240, 0.025675},
+    {-0.243280, 0.420240, 0.000000},
+    {-0.165770, 0.450000, 0.013126},
+    {-0.192945, 0.433680, 0.035656},
+    {-0.235418, 0.420240, 0.049923},
+    {-0.294411, 0.408960, 0.034509},
+    {-0.286554, 0.408960, 0.067100},
+    {-0.297120, 0.408960, 0.000000},
+    {-0.352770, 0.399120, 0.044210},
+    {-0.342703, 0.399120, 0.085962},
+    {-0.273951, 0.408960, 0.097370},
+    {-0.326558, 0.399120, 0.124740},
+    {-0.226042, 0.420240, 0.072444},
+    {-0.162781, 0.450000, 0.025523},
+    {-0.186248, 0.433680, 0.051740},
+    {-0.213436, 0.420240, 0.092937},
+    {-0.257008, 0.408960, 0.124913},
+    {-0.304852, 0.399120, 0.160026},
+    {-0.380447, 0.390000, 0.152777},
+    {-0.353862, 0.390000, 0.195994},
+    {-0.400221, 0.390000, 0.105283},
+    {-0.432200, 0.380880, 0.179702},
+    {-0.400930, 0.380880, 0.230536},
+    {-0.321100, 0.390000, 0.234300},
+    {-0.362394, 0.380880, 0.275594},
+    {-0.278102, 0.399120, 0.191302},
+    {-0.236127, 0.408960, 0.149327},
+    {-0.246826, 0.399120, 0.218052},
+    {-0.282794, 0.390000, 0.267062},
+    {-0.317336, 0.380880, 0.314130},
+    {-0.399257, 0.371040, 0.312457},
+    {-0.348172, 0.371040, 0.356148},
+    {-0.442948, 0.371040, 0.261372},
+    {-0.428963, 0.359760, 0.342163},
+    {-0.373022, 0.359760, 0.390008},
+    {-0.290540, 0.371040, 0.391601},
+    {-0.309910, 0.359760, 0.428832},
+    {-0.266502, 0.380880, 0.345400},
+    {-0.239577, 0.390000, 0.293647},
+    {-0.210638, 0.380880, 0.368659},
+    {-0.227203, 0.371040, 0.417970},
+    {-0.240552, 0.359760, 0.457708},
+    {-0.322836, 0.346320, 0.453676},
+    {-0.249459, 0.346320, 0.484226},
+    {-0.389604, 0.346320, 0.412603},
+    {-0.327539, 0.330000, 0.462717},
+    {-0.252701, 0.330000, 0.493875},
+    {-0.170454, 0.346320, 0.503273},
+    {-0.172122, 0.330000, 0.513302},
+    {-0.165874, 0.359760, 0.475713},
+    {-0.159008, 0.371040, 0.434412},
+    {-0.086800, 0.359760, 0.481920},
+    {-0.086800, 0.346320, 0.509840},
+    {-0.086800, 0.330000, 0.520000},
+    {-0.086800, 0.371040, 0.440080},
+    {-0.150489, 0.380880, 0.383160},
+    {-0.086800, 0.380880, 0.388160},
+    {-0.140946, 0.390000, 0.325750},
+    {-0.192083, 0.390000, 0.313421},
+    {-0.172762, 0.399120, 0.255903},
+    {-0.211540, 0.399120, 0.239758},
+    {-0.131010, 0.399120, 0.265970},
+    {-0.086800, 0.390000, 0.330000},
+    {-0.153900, 0.408960, 0.199754},
+    {-0.184170, 0.408960, 0.187151},
+    {-0.211713, 0.408960, 0.170208},
+    {-0.159244, 0.420240, 0.139242},
+    {-0.179737, 0.420240, 0.126636},
+    {-0.136723, 0.420240, 0.148618},
+    {-0.121309, 0.408960, 0.207611},
+    {-0.086800, 0.399120, 0.269440},
+    {-0.112475, 0.420240, 0.154464},
+    {-0.086800, 0.408960, 0.210320},
+    {-0.122456, 0.433680, 0.106145},
+    {-0.138540, 0.433680, 0.099448},
+    {-0.153176, 0.433680, 0.090445},
+    {-0.166150, 0.433680, 0.079350},
+    {-0.197901, 0.420240, 0.111101},
+    {-0.134314, 0.450000, 0.064742},
+    {-0.143600, 0.450000, 0.056800},
+    {-0.123837, 0.450000, 0.071187},
+    {-0.112323, 0.450000, 0.075981},
+    {-0.105138, 0.433680, 0.110320},
+    {-0.086800, 0.420240, 0.156480},
+    {-0.099926, 0.450000, 0.078970},
+    {-0.086800, 0.433680, 0.111760},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.068462, 0.433680, 0.110320},
+    {-0.061125, 0.420240, 0.154464},
+    {-0.086800, 0.420240, 0.156480},
+    {-0.073674, 0.450000, 0.078970},
+    {-0.051144, 0.433680, 0.106145},
+    {-0.036877, 0.420240, 0.148618},
+    {-0.052291, 0.408960, 0.207611},
+    {-0.019700, 0.408960, 0.199754},
+    {-0.086800, 0.408960, 0.210320},
+    {-0.042590, 0.399120, 0.265970},
+    {-0.000838, 0.399120, 0.255903},
+    {0.010570, 0.408960, 0.187151},
+    {0.037940, 0.399120, 0.239758},
+    {-0.014356, 0.420240, 0.139242},
+    {-0.061277, 0.450000, 0.075981},
+    {-0.035060, 0.433680, 0.099448},
+    {0.006137, 0.420240, 0.126636},
+    {0.038113, 0.408960, 0.170208},
+    {0.073226, 0.399120, 0.218052},
+    {0.065977, 0.390000, 0.293647},
+    {0.109194, 0.390000, 0.267062},
+    {0.018483, 0.390000, 0.313421},
+    {0.092902, 0.380880, 0.345400},
+    {0.143736, 0.380880, 0.314130},
+    {0.147500, 0.390000, 0.234300},
+    {0.188794, 0.380880, 0.275594},
+    {0.104502, 0.399120, 0.191302},
+    {0.062527, 0.408960, 0.149327},
+    {0.131252, 0.399120, 0.160026},
+    {0.180262, 0.390000, 0.195994},
+    {0.227330, 0.380880, 0.230536},
+    {0.225657, 0.371040, 0.312457},
+    {0.269348, 0.371040, 0.261372},
+    {0.174572, 0.371040, 0.356148},
+    {0.255363, 0.359760, 0.342163},
+    {0.303208, 0.359760, 0.286222},
+    {0.304801, 0.371040, 0.203740},
+    {0.342032, 0.359760, 0.223110},
+    {0.258600, 0.380880, 0.179702},
+    {0.206847, 0.390000, 0.152777},
+    {0.281859, 0.380880, 0.123838},
+    {0.331170, 0.371040, 0.140403},
+    {0.370908, 0.359760, 0.153752},
+    {0.366876, 0.346320, 0.236036},
+    {0.397426, 0.346320, 0.162659},
+    {0.325803, 0.346320, 0.302804},
+    {0.375917, 0.330000, 0.240739},
+    {0.407075, 0.330000, 0.165901},
+    {0.416473, 0.346320, 0.083654},
+    {0.426502, 0.330000, 0.085322},
+    {0.388913, 0.359760, 0.079074},
+    {0.347612, 0.371040, 0.072208},
+    {0.395120, 0.359760, -0.000000},
+    {0.423040, 0.346320, 0.000000},
+    {0.433200, 0.330000, -0.000000},
+    {0.353280, 0.371040, -0.000000},
+    {0.296360, 0.380880, 0.063689},
+    {0.301360, 0.380880, -0.000000},
+    {0.238950, 0.390000, 0.054146},
+    {0.226621, 0.390000, 0.105283},
+    {0.169103, 0.399120, 0.085962},
+    {0.152958, 0.399120, 0.124740},
+    {0.179170, 0.399120, 0.044210},
+    {0.243200, 0.390000, 0.000000},
+    {0.112954, 0.408960, 0.067100},
+    {0.100351, 0.408960, 0.097370},
+    {0.083408, 0.408960, 0.124913},
+    {0.052442, 0.420240, 0.072444},
+    {0.039836, 0.420240, 0.092937},
+    {0.061818, 0.420240, 0.049923},
+    {0.120811, 0.408960, 0.034509},
+    {0.182640, 0.399120, -0.000000},
+    {0.067664, 0.420240, 0.025675},
+    {0.123520, 0.408960, -0.000000},
+    {0.019345, 0.433680, 0.035656},
+    {0.012648, 0.433680, 0.051740},
+    {0.003645, 0.433680, 0.066376},
+    {-0.007450, 0.433680, 0.079350},
+    {0.024301, 0.420240, 0.111101},
+    {-0.022058, 0.450000, 0.047514},
+    {-0.030000, 0.450000, 0.056800},
+    {-0.015613, 0.450000, 0.037037},
+    {-0.010819, 0.450000, 0.025523},
+    {0.023520, 0.433680, 0.018338},
+    {0.069680, 0.420240, 0.000000},
+    {-0.007830, 0.450000, 0.013126},
+    {-0.006800, 0.450000, -0.000000},
+    {-0.039286, 0.450000, 0.064742},
+    {-0.020424, 0.433680, 0.090445},
+    {-0.049763, 0.450000, 0.071187},
+    {0.334026, 0.330000, 0.308838},
+    {0.275186, 0.346320, 0.361986},
+    {0.282400, 0.330000, 0.369200},
+    {0.199422, 0.359760, 0.390008},
+    {0.216004, 0.346320, 0.412603},
+    {0.116940, 0.371040, 0.391601},
+    {0.136310, 0.359760, 0.428832},
+    {0.149236, 0.346320, 0.453676},
+    {0.222038, 0.330000, 0.420826},
+    {0.053603, 0.371040, 0.417970},
+    {0.066952, 0.359760, 0.457708},
+    {0.037038, 0.380880, 0.368659},
+    {-0.023111, 0.380880, 0.383160},
+    {-0.014592, 0.371040, 0.434412},
+    {-0.007726, 0.359760, 0.475713},
+    {0.075859, 0.346320, 0.484226},
+    {0.153939, 0.330000, 0.462717},
+    {-0.003146, 0.346320, 0.503273},
+    {0.079101, 0.330000, 0.493875},
+    {-0.086800, 0.371040, 0.440080},
+    {-0.086800, 0.359760, 0.481920},
+    {-0.086800, 0.380880, 0.388160},
+    {-0.032654, 0.390000, 0.325750},
+    {-0.086800, 0.390000, 0.330000},
+    {-0.086800, 0.399120, 0.269440},
+    {-0.086800, 0.346320, 0.509840},
+    {-0.001478, 0.330000, 0.513302},
+    {-0.086800, 0.330000, 0.520000},
+    {-0.151542, 0.450000, 0.047514},
+    {-0.177245, 0.433680, 0.066376},
+    {-0.157987, 0.450000, 0.037037},
+    {-0.395638, 0.330000, 0.420826},
+    {-0.448786, 0.346320, 0.361986},
+    {-0.456000, 0.330000, 0.369200},
+    {-0.476808, 0.359760, 0.286222},
+    {-0.499403, 0.346320, 0.302804},
+    {-0.478401, 0.371040, 0.203740},
+    {-0.515632, 0.359760, 0.223110},
+    {-0.540476, 0.346320, 0.236036},
+    {-0.507626, 0.330000, 0.308838},
+    {-0.504770, 0.371040, 0.140403},
+    {-0.544508, 0.359760, 0.153752},
+    {-0.455459, 0.380880, 0.123838},
+    {-0.469960, 0.380880, 0.063689},
+    {-0.521212, 0.371040, 0.072208},
+    {-0.562513, 0.359760, 0.079074},
+    {-0.571026, 0.346320, 0.162659},
+    {-0.549517, 0.330000, 0.240739},
+    {-0.590073, 0.346320, 0.083654},
+    {-0.580675, 0.330000, 0.165901},
+    {-0.526880, 0.371040, 0.000000},
+    {-0.568720, 0.359760, 0.000000},
+    {-0.474960, 0.380880, 0.000000},
+    {-0.412550, 0.390000, 0.054146},
+    {-0.416800, 0.390000, 0.000000},
+    {-0.356240, 0.399120, 0.000000},
+    {-0.596640, 0.346320, 0.000000},
+    {-0.600102, 0.330000, 0.085322},
+    {-0.606800, 0.330000, 0.000000},
+    {-0.134314, 0.450000, -0.064742},
+    {-0.153176, 0.433680, -0.090445},
+    {-0.123837, 0.450000, -0.071187},
+    {-0.507626, 0.330000, -0.308838},
+    {-0.448786, 0.346320, -0.361986},
+    {-0.456000, 0.330000, -0.369200},
+    {-0.373022, 0.359760, -0.390008},
+    {-0.389604, 0.346320, -0.412603},
+    {-0.290540, 0.371040, -0.391601},
+    {-0.309910, 0.359760, -0.428832},
+    {-0.322836, 0.346320, -0.453676},
+    {-0.395638, 0.330000, -0.420826},
+    {-0.227203, 0.371040, -0.417970},
+    {-0.240552, 0.359760, -0.457708},
+    {-0.210638, 0.380880, -0.368659},
+    {-0.150489, 0.380880, -0.383160},
+    {-0.159008, 0.371040, -0.434412},
+    {-0.165874, 0.359760, -0.475713},
+    {-0.249459, 0.346320, -0.484226},
+    {-0.327539, 0.330000, -0.462717},
+    {-0.170454, 0.346320, -0.503273},
+    {-0.252701, 0.330000, -0.493875},
+    {-0.086800, 0.371040, -0.440080},
+    {-0.086800, 0.359760, -0.481920},
+    {-0.086800, 0.380880, -0.388160},
+    {-0.140946, 0.390000, -0.325750},
+    {-0.086800, 0.390000, -0.330000},
+    {-0.086800, 0.399120, -0.269440},
+    {-0.086800, 0.346320, -0.509840},
+    {-0.172122, 0.330000, -0.513302},
+    {-0.086800, 0.330000, -0.520000},
+    {-0.015613, 0.450000, -0.037037},
+    {0.222038, 0.330000, -0.420826},
+    {0.275186, 0.346320, -0.361986},
+    {0.282400, 0.330000, -0.369200},
+    {0.303208, 0.359760, -0.286222},
+    {0.325803, 0.346320, -0.302804},
+    {0.304801, 0.371040, -0.203740},
+    {0.342032, 0.359760, -0.223110},
+    {0.366876, 0.346320, -0.236036},
+    {0.334026, 0.330000, -0.308838},
+    {0.331170, 0.371040, -0.140403},
+    {0.370908, 0.359760, -0.153752},
+    {0.281859, 0.380880, -0.123838},
+    {0.296360, 0.380880, -0.063689},
+    {0.347612, 0.371040, -0.072208},
+    {0.388913, 0.359760, -0.079074},
+    {0.397426, 0.346320, -0.162659},
+    {0.375917, 0.330000, -0.240739},
+    {0.416473, 0.346320, -0.083654},
+    {0.407075, 0.330000, -0.165901},
+    {0.353280, 0.371040, 0.000000},
+    {0.395120, 0.359760, 0.000000},
+    {0.301360, 0.380880, 0.000000},
+    {0.238950, 0.390000, -0.054146},
+    {0.243200, 0.390000, 0.000000},
+    {0.182640, 0.399120, 0.000000},
+    {0.123520, 0.408960, 0.000000},
+    {0.423040, 0.346320, 0.000000},
+    {0.426502, 0.330000, -0.085322},
+    {0.433200, 0.330000, 0.000000},
+    {0.458248, 0.355200, -0.090598},
+    {0.465987, 0.330000, -0.091885},
+    {0.473200, 0.330000, 0.000000},
+    {0.466090, 0.363075, 0.000000},
+    {0.437620, 0.355200, -0.176161},
+    {0.462118, 0.367800, -0.091242},
+    {0.441342, 0.367800, -0.177412},
+    {0.445066, 0.330000, -0.178662},
+    {0.404534, 0.355200, -0.255628},
+    {0.408022, 0.367800, -0.257443},
+    {0.446253, 0.369375, -0.179061},
+    {0.412623, 0.369375, -0.259836},
+    {0.467221, 0.369375, -0.092090},
+    {0.481120, 0.367800, 0.000000},
+    {0.481396, 0.363075, -0.094446},
+    {0.459891, 0.363075, -0.183643},
+    {0.425401, 0.363075, -0.266484},
+    {0.367408, 0.369375, -0.333338},
+    {0.379030, 0.363075, -0.341866},
+    {0.363224, 0.367800, -0.330267},
+    {0.411510, 0.330000, -0.259258},
+    {0.305752, 0.363075, -0.392552},
+    {0.243467, 0.367800, -0.450024},
+    {0.311688, 0.369375, -0.398488},
+    {0.321883, 0.363075, -0.408683},
+    {0.392399, 0.344175, -0.351678},
+    {0.333612, 0.344175, -0.420412},
+    {0.440101, 0.344175, -0.274132},
+    {0.447104, 0.330000, -0.277776},
+    {0.339200, 0.330000, -0.426000},
+    {0.446677, 0.204240, -0.391512},
+    {0.381232, 0.204240, -0.468032},
+    {0.264878, 0.344175, -0.479199},
+    {0.255066, 0.363075, -0.465830},
+    {0.246538, 0.369375, -0.454208},
+    {0.179684, 0.363075, -0.512201},
+    {0.187332, 0.344175, -0.526901},
+    {0.190976, 0.330000, -0.533904},
+    {0.304712, 0.204240, -0.533477},
+    {0.218383, 0.204240, -0.586582},
+    {0.419856, 0.079920, -0.506656},
+    {0.337021, 0.079920, -0.577502},
+    {0.243568, 0.079920, -0.634990},
+    {0.123511, 0.204240, -0.626082},
+    {0.140867, 0.079920, -0.677749},
+    {0.102113, 0.344175, -0.562381},
+    {0.096843, 0.363075, -0.546691},
+    {0.010357, 0.344175, -0.584503},
+    {0.011648, 0.330000, -0.592272},
+    {0.021362, 0.204240, -0.650710},
+    {0.030288, 0.079920, -0.704409},
+    {0.155160, -0.041520, -0.720298},
+    {0.037638, -0.041520, -0.748632},
+    {0.264309, -0.041520, -0.674855},
+    {0.164859, -0.158640, -0.749171},
+    {0.042626, -0.158640, -0.778640},
+    {-0.086800, -0.041520, -0.758400},
+    {-0.086800, 0.141810, -0.687300},
+    {-0.086800, 0.330000, -0.600000},
+    {-0.086800, 0.363075, -0.575610},
+    {-0.086800, 0.369375, -0.561250},
+    {0.005290, 0.369375, -0.554021},
+    {0.007646, 0.363075, -0.568196},
+    {-0.086800, 0.367800, -0.567920},
+    {-0.181246, 0.363075, -0.568196},
+    {-0.183957, 0.344175, -0.584503},
+    {-0.086800, 0.344175, -0.592130},
+    {-0.086800, 0.363075, -0.552890},
+    {0.004442, 0.367800, -0.548918},
+    {0.090612, 0.367800, -0.528142},
+    {0.092261, 0.369375, -0.533053},
+    {0.173036, 0.369375, -0.499423},
+    {0.089361, 0.355200, -0.524420},
+    {0.169166, 0.363075, -0.491984},
+    {0.003798, 0.355200, -0.545048},
+    {-0.086800, 0.330000, -0.560000},
+    {0.005085, 0.330000, -0.552787},
+    {0.091862, 0.330000, -0.531866},
+    {0.172458, 0.330000, -0.498310},
+    {0.245795, 0.330000, -0.453197},
+    {0.241572, 0.363075, -0.447443},
+    {0.310800, 0.330000, -0.397600},
+    {0.366397, 0.330000, -0.332595},
+    {-0.275713, 0.344175, -0.562381},
+    {-0.185248, 0.330000, -0.592272},
+    {-0.178890, 0.369375, -0.554021},
+    {-0.270443, 0.363075, -0.546691},
+    {-0.360932, 0.344175, -0.526901},
+    {-0.364576, 0.330000, -0.533904},
+    {-0.297111, 0.204240, -0.626082},
+    {-0.391983, 0.204240, -0.586582},
+    {-0.194962, 0.204240, -0.650710},
+    {-0.086800, 0.204240, -0.659200},
+    {-0.203888, 0.079920, -0.704409},
+    {-0.314467, 0.079920, -0.677749},
+    {-0.417168, 0.079920, -0.634990},
+    {-0.478312, 0.204240, -0.533477},
+    {-0.510621, 0.079920, -0.577502},
+    {-0.438478, 0.344175, -0.479199},
+    {-0.353284, 0.363075, -0.512201},
+    {-0.428666, 0.363075, -0.465830},
+    {-0.507212, 0.344175, -0.420412},
+    {-0.512800, 0.330000, -0.426000},
+    {-0.554832, 0.204240, -0.468032},
+    {-0.593456, 0.079920, -0.506656},
+    {-0.537229, -0.041520, -0.613758},
+    {-0.625264, -0.041520, -0.538464},
+    {-0.437909, -0.041520, -0.674855},
+    {-0.555284, -0.158640, -0.638360},
+    {-0.646848, -0.158640, -0.560048},
+    {-0.700558, -0.041520, -0.450429},
+    {-0.725160, -0.158640, -0.468484},
+    {-0.664302, 0.079920, -0.423821},
+    {-0.620277, 0.204240, -0.391512},
+    {-0.565999, 0.344175, -0.351678},
+    {-0.673382, 0.204240, -0.305183},
+    {-0.721790, 0.079920, -0.330368},
+    {-0.761655, -0.041520, -0.351109},
+    {-0.788706, -0.158640, -0.365183},
+    {-0.734224, -0.270000, -0.475136},
+    {-0.798672, -0.270000, -0.370368},
+    {-0.654800, -0.270000, -0.568000},
+    {-0.561936, -0.270000, -0.647424},
+    {-0.451983, -0.158640, -0.701906},
+    {-0.457168, -0.270000, -0.711872},
+    {-0.328760, -0.041520, -0.720298},
+    {-0.338459, -0.158640, -0.749171},
+    {-0.342032, -0.270000, -0.759808},
+    {-0.211238, -0.041520, -0.748632},
+    {-0.216226, -0.158640, -0.778640},
+    {-0.086800, 0.079920, -0.713600},
+    {-0.086800, -0.041520, -0.758400},
+    {-0.086800, -0.158640, -0.788800},
+    {-0.218064, -0.270000, -0.789696},
+    {-0.086800, -0.270000, -0.800000},
+    {-0.217145, -0.321330, -0.784168},
+    {-0.457168, -0.270000, -0.711872},
+    {-0.086800, -0.321330, -0.794400},
+    {0.044464, -0.270000, -0.789696},
+    {-0.086800, -0.321330, -0.794400},
+    {-0.454576, -0.321330, -0.706889},
+    {-0.214651, -0.367440, -0.769164},
+    {-0.335396, -0.367440, -0.740053},
+    {-0.447538, -0.367440, -0.693363},
+    {-0.561936, -0.270000, -0.647424},
+    {-0.549582, -0.367440, -0.630591},
+    {-0.424576, -0.444720, -0.649227},
+    {-0.520124, -0.444720, -0.590451},
+    {-0.319572, -0.444720, -0.692945},
+    {-0.086800, -0.408510, -0.756800},
+    {-0.206513, -0.444720, -0.720203},
+    {-0.300684, -0.503280, -0.636719},
+    {-0.374206, -0.544560, -0.552413},
+    {-0.484964, -0.503280, -0.542541},
+    {-0.604816, -0.444720, -0.518016},
+    {-0.562784, -0.503280, -0.475984},
+    {-0.640032, -0.367440, -0.553232},
+    {-0.677251, -0.444720, -0.433324},
+    {-0.629341, -0.503280, -0.398164},
+    {-0.516776, -0.559170, -0.429976},
+    {-0.589201, -0.544560, -0.368706},
+    {-0.455506, -0.544560, -0.502401},
+    {-0.443152, -0.570000, -0.485568},
+    {-0.572368, -0.570000, -0.356352},
+    {-0.512800, -0.570000, -0.426000},
+    {-0.639213, -0.544560, -0.287406},
+    {-0.620704, -0.570000, -0.277776},
+    {-0.683349, -0.503280, -0.310368},
+    {-0.676411, -0.544560, -0.198060},
+    {-0.656656, -0.570000, -0.191424},
+    {-0.736027, -0.444720, -0.337776},
+    {-0.779745, -0.444720, -0.232772},
+    {-0.748565, -0.503280, -0.109999},
+    {-0.699604, -0.544560, -0.101861},
+    {-0.679072, -0.570000, -0.098448},
+    {-0.780163, -0.367440, -0.360738},
+    {-0.717391, -0.367440, -0.462782},
+    {-0.826853, -0.367440, -0.248596},
+    {-0.807003, -0.444720, -0.119713},
+    {-0.757200, -0.503280, 0.000000},
+    {-0.692400, -0.559170, 0.000000},
+    {-0.686800, -0.570000, 0.000000},
+    {-0.664930, -0.596190, 0.000000},
+    {-0.671491, -0.587760, 0.097188},
+    {-0.679072, -0.570000, 0.098448},
+    {-0.679120, -0.587760, 0.000000},
+    {-0.679072, -0.570000, -0.098448},
+    {-0.639760, -0.604080, -0.000000},
+    {-0.657484, -0.596190, 0.094860},
+    {-0.635885, -0.596190, 0.184446},
+    {-0.649362, -0.587760, 0.188974},
+    {-0.656656, -0.570000, 0.191424},
+    {-0.613870, -0.587760, 0.274220},
+    {-0.611979, -0.604080, 0.176416},
+    {-0.534300, -0.604080, 0.328414},
+    {-0.554669, -0.596190, 0.343363},
+    {-0.600550, -0.611250, 0.000000},
+    {-0.574739, -0.611250, 0.163907},
+    {-0.456997, -0.617520, 0.271683},
+    {-0.358483, -0.617520, 0.370197},
+    {-0.391926, -0.611250, 0.415768},
+    {-0.415214, -0.604080, 0.447500},
+    {-0.438591, -0.587760, 0.479353},
+    {-0.507347, -0.587760, 0.420547},
+    {-0.566153, -0.587760, 0.351791},
+    {-0.250707, -0.611250, 0.487939},
+    {-0.263216, -0.604080, 0.525179},
+    {-0.354451, -0.596190, 0.514443},
+    {-0.232742, -0.617520, 0.434458},
+    {-0.263174, -0.622710, 0.339002},
+    {-0.395112, -0.622710, 0.226266},
+    {-0.253858, -0.626640, 0.227634},
+    {-0.217021, -0.626640, 0.250294},
+    {-0.314434, -0.626640, 0.167058},
+    {-0.448630, -0.622710, 0.121545},
+    {-0.176540, -0.626640, 0.267148},
+    {-0.086800, -0.626640, 0.281280},
+    {-0.086800, -0.622710, 0.380970},
+    {-0.086800, -0.617520, 0.457440},
+    {-0.086800, -0.604080, 0.552960},
+    {-0.271246, -0.596190, 0.549085},
+    {-0.086800, -0.587760, 0.592320},
+    {-0.183988, -0.587760, 0.584691},
+    {-0.275774, -0.587760, 0.562562},
+    {-0.361020, -0.587760, 0.527070},
+    {-0.185248, -0.570000, 0.592272},
+    {-0.086800, -0.570000, 0.600000},
+    {-0.278224, -0.570000, 0.569856},
+    {-0.364576, -0.570000, 0.533904},
+    {-0.443152, -0.570000, 0.485568},
+    {-0.512800, -0.570000, 0.426000},
+    {-0.516776, -0.559170, 0.429976},
+    {-0.572368, -0.570000, 0.356352},
+    {-0.443152, -0.570000, 0.485568},
+    {-0.572368, -0.570000, 0.356352},
+    {-0.620704, -0.570000, 0.277776},
+    {-0.455506, -0.544560, 0.502401},
+    {-0.364576, -0.570000, 0.533904},
+    {-0.484964, -0.503280, 0.542541},
+    {-0.562784, -0.503280, 0.475984},
+    {-0.374206, -0.544560, 0.552413},
+    {-0.278224, -0.570000, 0.569856},
+    {-0.397168, -0.503280, 0.596549},
+    {-0.284860, -0.544560, 0.589611},
+    {-0.520124, -0.444720, 0.590451},
+    {-0.604816, -0.444720, 0.518016},
+    {-0.677251, -0.444720, 0.433324},
+    {-0.629341, -0.503280, 0.398164},
+    {-0.640032, -0.367440, 0.553232},
+    {-0.717391, -0.367440, 0.462782},
+    {-0.549582, -0.367440, 0.630591},
+    {-0.424576, -0.444720, 0.649227},
+    {-0.447538, -0.367440, 0.693363},
+    {-0.319572, -0.444720, 0.692945},
+    {-0.561936, -0.270000, 0.647424},
+    {-0.650824, -0.321330, 0.564024},
+    {-0.734224, -0.270000, 0.475136},
+    {-0.793689, -0.321330, 0.367776},
+    {-0.780163, -0.367440, 0.360738},
+    {-0.798672, -0.270000, 0.370368},
+    {-0.454576, -0.321330, 0.706889},
+    {-0.342032, -0.270000, 0.759808},
+    {-0.335396, -0.367440, 0.740053},
+    {-0.206513, -0.444720, 0.720203},
+    {-0.196799, -0.503280, 0.661765},
+    {-0.214651, -0.367440, 0.769164},
+    {-0.218064, -0.270000, 0.789696},
+    {-0.086800, -0.367440, 0.779200},
+    {-0.086800, -0.444720, 0.729600},
+    {-0.086800, -0.503280, 0.670400},
+    {-0.188661, -0.544560, 0.612804},
+    {-0.086800, -0.559170, 0.605600},
+    {-0.185248, -0.570000, 0.592272},
+    {-0.086800, -0.596190, 0.578130},
+    {0.010388, -0.587760, 0.584691},
+    {0.011648, -0.570000, 0.592272},
+    {-0.086800, -0.604080, 0.552960},
+    {0.008060, -0.596190, 0.570684},
+    {0.097646, -0.596190, 0.549085},
+    {0.102174, -0.587760, 0.562562},
+    {0.104624, -0.570000, 0.569856},
+    {0.187420, -0.587760, 0.527070},
+    {0.089616, -0.604080, 0.525179},
+    {0.241614, -0.604080, 0.447500},
+    {0.256563, -0.596190, 0.467869},
+    {-0.086800, -0.611250, 0.513750},
+    {0.077107, -0.611250, 0.487939},
+    {0.184883, -0.617520, 0.370197},
+    {0.283397, -0.617520, 0.271683},
+    {0.328968, -0.611250, 0.305126},
+    {0.360700, -0.604080, 0.328414},
+    {0.392553, -0.587760, 0.351791},
+    {0.333747, -0.587760, 0.420547},
+    {0.264991, -0.587760, 0.479353},
+    {0.401139, -0.611250, 0.163907},
+    {0.438379, -0.604080, 0.176416},
+    {0.427643, -0.596190, 0.267651},
+    {0.347658, -0.617520, 0.145942},
+    {0.252202, -0.622710, 0.176374},
+    {0.139466, -0.622710, 0.308312},
+    {0.140834, -0.626640, 0.167058},
+    {0.163494, -0.626640, 0.130221},
+    {0.080258, -0.626640, 0.227634},
+    {0.034745, -0.622710, 0.361830},
+    {0.180348, -0.626640, 0.089740},
+    {0.194480, -0.626640, 0.000000},
+    {0.294170, -0.622710, 0.000000},
+    {0.370640, -0.617520, 0.000000},
+    {0.466160, -0.604080, 0.000000},
+    {0.462285, -0.596190, 0.184446},
+    {0.505520, -0.587760, 0.000000},
+    {0.497891, -0.587760, 0.097188},
+    {0.475762, -0.587760, 0.188974},
+    {0.440270, -0.587760, 0.274220},
+    {0.505472, -0.570000, 0.098448},
+    {0.513200, -0.570000, 0.000000},
+    {0.483056, -0.570000, 0.191424},
+    {0.447104, -0.570000, 0.277776},
+    {0.398768, -0.570000, 0.356352},
+    {0.339200, -0.570000, 0.426000},
+    {0.343176, -0.559170, 0.429976},
+    {0.269552, -0.570000, 0.485568},
+    {0.398768, -0.570000, 0.356352},
+    {0.269552, -0.570000, 0.485568},
+    {0.190976, -0.570000, 0.533904},
+    {0.415601, -0.544560, 0.368706},
+    {0.447104, -0.570000, 0.277776},
+    {0.455741, -0.503280, 0.398164},
+    {0.389184, -0.503280, 0.475984},
+    {0.465613, -0.544560, 0.287406},
+    {0.483056, -0.570000, 0.191424},
+    {0.509749, -0.503280, 0.310368},
+    {0.502811, -0.544560, 0.198060},
+    {0.503651, -0.444720, 0.433324},
+    {0.431216, -0.444720, 0.518016},
+    {0.346524, -0.444720, 0.590451},
+    {0.311364, -0.503280, 0.542541},
+    {0.466432, -0.367440, 0.553232},
+    {0.375982, -0.367440, 0.630591},
+    {0.543791, -0.367440, 0.462782},
+    {0.562427, -0.444720, 0.337776},
+    {0.606563, -0.367440, 0.360738},
+    {0.606145, -0.444720, 0.232772},
+    {0.560624, -0.270000, 0.475136},
+    {0.477224, -0.321330, 0.564024},
+    {0.388336, -0.270000, 0.647424},
+    {0.280976, -0.321330, 0.706889},
+    {0.273938, -0.367440, 0.693363},
+    {0.283568, -0.270000, 0.711872},
+    {0.620089, -0.321330, 0.367776},
+    {0.673008, -0.270000, 0.255232},
+    {0.653253, -0.367440, 0.248596},
+    {0.633403, -0.444720, 0.119713},
+    {0.574965, -0.503280, 0.109999},
+    {0.682364, -0.367440, 0.127851},
+    {0.702896, -0.270000, 0.131264},
+    {0.692400, -0.367440, -0.000000},
+    {0.642800, -0.444720, 0.000000},
+    {0.583600, -0.503280, 0.000000},
+    {0.526004, -0.544560, 0.101861},
+    {0.518800, -0.559170, -0.000000},
+    {0.505472, -0.570000, 0.098448},
+    {0.491330, -0.596190, 0.000000},
+    {0.497891, -0.587760, -0.097188},
+    {0.505472, -0.570000, -0.098448},
+    {0.466160, -0.604080, 0.000000},
+    {0.483884, -0.596190, -0.094860},
+    {0.462285, -0.596190, -0.184446},
+    {0.475762, -0.587760, -0.188974},
+    {0.483056, -0.570000, -0.191424},
+    {0.440270, -0.587760, -0.274220},
+    {0.438379, -0.604080, -0.176416},
+    {0.360700, -0.604080, -0.328414},
+    {0.381069, -0.596190, -0.343363},
+    {0.426950, -0.611250, -0.000000},
+    {0.401139, -0.611250, -0.163907},
+    {0.283397, -0.617520, -0.271683},
+    {0.184883, -0.617520, -0.370197},
+    {0.218326, -0.611250, -0.415768},
+    {0.241614, -0.604080, -0.447500},
+    {0.264991, -0.587760, -0.479353},
+    {0.333747, -0.587760, -0.420547},
+    {0.392553, -0.587760, -0.351791},
+    {0.077107, -0.611250, -0.487939},
+    {0.089616, -0.604080, -0.525179},
+    {0.180851, -0.596190, -0.514443},
+    {0.059142, -0.617520, -0.434458},
+    {0.089574, -0.622710, -0.339002},
+    {0.221512, -0.622710, -0.226266},
+    {0.080258, -0.626640, -0.227634},
+    {0.043421, -0.626640, -0.250294},
+    {0.140834, -0.626640, -0.167058},
+    {0.275030, -0.622710, -0.121545},
+    {0.002940, -0.626640, -0.267148},
+    {-0.086800, -0.626640, -0.281280},
+    {-0.086800, -0.622710, -0.380970},
+    {-0.086800, -0.617520, -0.457440},
+    {-0.086800, -0.604080, -0.552960},
+    {0.097646, -0.596190, -0.549085},
+    {-0.086800, -0.587760, -0.592320},
+    {0.010388, -0.587760, -0.584691},
+    {0.102174, -0.587760, -0.562562},
+    {0.187420, -0.587760, -0.527070},
+    {0.011648, -0.570000, -0.592272},
+    {-0.086800, -0.570000, -0.600000},
+    {0.104624, -0.570000, -0.569856},
+    {0.190976, -0.570000, -0.533904},
+    {0.269552, -0.570000, -0.485568},
+    {0.339200, -0.570000, -0.426000},
+    {0.343176, -0.559170, -0.429976},
+    {0.398768, -0.570000, -0.356352},
+    {0.269552, -0.570000, -0.485568},
+    {0.398768, -0.570000, -0.356352},
+    {0.447104, -0.570000, -0.277776},
+    {0.281906, -0.544560, -0.502401},
+    {0.190976, -0.570000, -0.533904},
+    {0.311364, -0.503280, -0.542541},
+    {0.389184, -0.503280, -0.475984},
+    {0.200606, -0.544560, -0.552413},
+    {0.104624, -0.570000, -0.569856},
+    {0.223568, -0.503280, -0.596549},
+    {0.111260, -0.544560, -0.589611},
+    {0.346524, -0.444720, -0.590451},
+    {0.431216, -0.444720, -0.518016},
+    {0.503651, -0.444720, -0.433324},
+    {0.455741, -0.503280, -0.398164},
+    {0.466432, -0.367440, -0.553232},
+    {0.543791, -0.367440, -0.462782},
+    {0.375982, -0.367440, -0.630591},
+    {0.250976, -0.444720, -0.649227},
+    {0.273938, -0.367440, -0.693363},
+    {0.145972, -0.444720, -0.692945},
+    {0.388336, -0.270000, -0.647424},
+    {0.477224, -0.321330, -0.564024},
+    {0.560624, -0.270000, -0.475136},
+    {0.620089, -0.321330, -0.367776},
+    {0.606563, -0.367440, -0.360738},
+    {0.625072, -0.270000, -0.370368},
+    {0.280976, -0.321330, -0.706889},
+    {0.168432, -0.270000, -0.759808},
+    {0.161796, -0.367440, -0.740053},
+    {0.032913, -0.444720, -0.720203},
+    {0.023199, -0.503280, -0.661765},
+    {0.041051, -0.367440, -0.769164},
+    {-0.086800, -0.367440, -0.779200},
+    {-0.086800, -0.444720, -0.729600},
+    {-0.086800, -0.503280, -0.670400},
+    {0.015061, -0.544560, -0.612804},
+    {-0.086800, -0.559170, -0.605600},
+    {0.011648, -0.570000, -0.592272},
+    {-0.086800, -0.596190, -0.578130},
+    {-0.183988, -0.587760, -0.584691},
+    {-0.185248, -0.570000, -0.592272},
+    {-0.086800, -0.604080, -0.552960},
+    {-0.181660, -0.596190, -0.570684},
+    {-0.271246, -0.596190, -0.549085},
+    {-0.275774, -0.587760, -0.562562},
+    {-0.278224, -0.570000, -0.569856},
+    {-0.361020, -0.587760, -0.527070},
+    {-0.263216, -0.604080, -0.525179},
+    {-0.415214, -0.604080, -0.447500},
+    {-0.430163, -0.596190, -0.467869},
+    {-0.086800, -0.611250, -0.513750},
+    {-0.250707, -0.611250, -0.487939},
+    {-0.358483, -0.617520, -0.370197},
+    {-0.456997, -0.617520, -0.271683},
+    {-0.502568, -0.611250, -0.305126},
+    {-0.534300, -0.604080, -0.328414},
+    {-0.566153, -0.587760, -0.351791},
+    {-0.507347, -0.587760, -0.420547},
+    {-0.438591, -0.587760, -0.479353},
+    {-0.574739, -0.611250, -0.163907},
+    {-0.611979, -0.604080, -0.176416},
+    {-0.601243, -0.596190, -0.267651},
+    {-0.521258, -0.617520, -0.145942},
+    {-0.425802, -0.622710, -0.176374},
+    {-0.313066, -0.622710, -0.308312},
+    {-0.314434, -0.626640, -0.167058},
+    {-0.337094, -0.626640, -0.130221},
+    {-0.253858, -0.626640, -0.227634},
+    {-0.208345, -0.622710, -0.361830},
+    {-0.353948, -0.626640, -0.089740},
+    {-0.368080, -0.626640, 0.000000},
+    {-0.467770, -0.622710, 0.000000},
+    {-0.544240, -0.617520, 0.000000},
+    {-0.639760, -0.604080, 0.000000},
+    {-0.635885, -0.596190, -0.184446},
+    {-0.671491, -0.587760, -0.097188},
+    {-0.649362, -0.587760, -0.188974},
+    {-0.613870, -0.587760, -0.274220},
+    {-0.656656, -0.570000, -0.191424},
+    {-0.620704, -0.570000, -0.277776},
+    {-0.572368, -0.570000, -0.356352},
+    {-0.443152, -0.570000, -0.485568},
+    {-0.364576, -0.570000, -0.533904},
+    {-0.225001, -0.629130, -0.071902},
+    {-0.242110, -0.629130, 0.000000},
+    {-0.086800, -0.630000, 0.000000},
+    {-0.179042, -0.629130, -0.125689},
+    {-0.086800, -0.629130, -0.155310},
+    {-0.176540, -0.626640, -0.267148},
+    {-0.086800, -0.617520, -0.457440},
+    {-0.086800, -0.629130, -0.155310},
+    {-0.014898, -0.629130, -0.138201},
+    {0.038889, -0.629130, -0.092242},
+    {0.068510, -0.629130, 0.000000},
+    {0.180348, -0.626640, -0.089740},
+    {0.370640, -0.617520, 0.000000},
+    {0.068510, -0.629130, 0.000000},
+    {0.051401, -0.629130, 0.071902},
+    {0.005442, -0.629130, 0.125689},
+    {-0.086800, -0.629130, 0.155310},
+    {0.002940, -0.626640, 0.267148},
+    {-0.086800, -0.617520, 0.457440},
+    {-0.086800, -0.629130, 0.155310},
+    {-0.158702, -0.629130, 0.138201},
+    {-0.212489, -0.629130, 0.092242},
+    {-0.242110, -0.629130, -0.000000},
+    {-0.353948, -0.626640, 0.089740},
+    {-0.544240, -0.617520, 0.000000},
+    {0.697368, -0.321330, -0.130345},
+    {0.702896, -0.270000, -0.131264},
+    {0.713200, -0.270000, 0.000000},
+    {0.707600, -0.321330, 0.000000},
+    {0.682364, -0.367440, -0.127851},
+    {0.653253, -0.367440, -0.248596},
+    {0.562427, -0.444720, -0.337776},
+    {0.606145, -0.444720, -0.232772},
+    {0.670000, -0.408510, 0.000000},
+    {0.633403, -0.444720, -0.119713},
+    {0.549919, -0.503280, -0.213884},
+    {0.465613, -0.544560, -0.287406},
+    {0.502811, -0.544560, -0.198060},
+    {0.415601, -0.544560, -0.368706},
+    {0.447104, -0.570000, -0.277776},
+    {0.574965, -0.503280, -0.109999},
+    {0.642800, -0.444720, 0.000000},
+    {0.534000, -0.544560, 0.000000},
+    {0.526004, -0.544560, -0.101861},
+    {0.483056, -0.570000, -0.191424},
+    {0.505472, -0.570000, -0.098448},
+    {0.513200, -0.570000, 0.000000},
+    {0.702000, -0.158640, 0.000000},
+    {0.707600, -0.321330, -0.000000},
+    {0.671600, -0.041520, 0.000000},
+    {0.691840, -0.158640, -0.129426},
+    {0.673008, -0.270000, -0.255232},
+    {0.661832, -0.041520, -0.124438},
+    {0.662371, -0.158640, -0.251659},
+    {0.626800, 0.079920, 0.000000},
+    {0.617609, 0.079920, -0.117088},
+    {0.633498, -0.041520, -0.241960},
+    {0.615106, -0.158640, -0.365183},
+    {0.625072, -0.270000, -0.370368},
+    {0.590949, 0.079920, -0.227667},
+    {0.588055, -0.041520, -0.351109},
+    {0.563910, 0.204240, -0.108162},
+    {0.572400, 0.204240, 0.000000},
+    {0.539282, 0.204240, -0.210311},
+    {0.548190, 0.079920, -0.330368},
+    {0.526958, -0.041520, -0.450429},
+    {0.551560, -0.158640, -0.468484},
+    {0.560624, -0.270000, -0.475136},
+    {0.473248, -0.158640, -0.560048},
+    {0.481200, -0.270000, -0.568000},
+    {0.490702, 0.079920, -0.423821},
+    {0.451664, -0.041520, -0.538464},
+    {0.499782, 0.204240, -0.305183},
+    {0.475581, 0.344175, -0.188913},
+    {0.505472, 0.330000, -0.098448},
+    {0.363629, -0.041520, -0.613758},
+    {0.381684, -0.158640, -0.638360},
+    {0.388336, -0.270000, -0.647424},
+    {0.278383, -0.158640, -0.701906},
+    {0.283568, -0.270000, -0.711872},
+    {0.168432, -0.270000, -0.759808},
+    {0.044464, -0.270000, -0.789696},
+    {-0.086800, -0.270000, -0.800000},
+    {-0.086800, -0.158640, -0.788800},
+    {0.497703, 0.344175, -0.097157},
+    {0.488810, 0.363075, 0.000000},
+    {0.505330, 0.344175, 0.000000},
+    {0.474450, 0.369375, 0.000000},
+    {0.467221, 0.369375, 0.092090},
+    {0.481396, 0.363075, 0.094446},
+    {0.497703, 0.344175, 0.097157},
+    {0.513200, 0.330000, 0.000000},
+    {0.466090, 0.363075, 0.000000},
+    {0.462118, 0.367800, 0.091242},
+    {0.441342, 0.367800, 0.177412},
+    {0.446253, 0.369375, 0.179061},
+    {0.459891, 0.363075, 0.183643},
+    {0.475581, 0.344175, 0.188913},
+    {0.505472, 0.330000, 0.098448},
+    {0.563910, 0.204240, 0.108162},
+    {0.600500, 0.141810, 0.000000},
+    {0.425401, 0.363075, 0.266484},
+    {0.440101, 0.344175, 0.274132},
+    {0.447104, 0.330000, 0.277776},
+    {0.539282, 0.204240, 0.210311},
+    {0.412623, 0.369375, 0.259836},
+    {0.363224, 0.367800, 0.330267},
+    {0.367408, 0.369375, 0.333338},
+    {0.379030, 0.363075, 0.341866},
+    {0.392399, 0.344175, 0.351678},
+    {0.499782, 0.204240, 0.305183},
+    {0.590949, 0.079920, 0.227667},
+    {0.617609, 0.079920, 0.117088},
+    {0.671600, -0.041520, 0.000000},
+    {0.661832, -0.041520, 0.124438},
+    {0.548190, 0.079920, 0.330368},
+    {0.633498, -0.041520, 0.241960},
+    {0.446677, 0.204240, 0.391512},
+    {0.490702, 0.079920, 0.423821},
+    {0.588055, -0.041520, 0.351109},
+    {0.662371, -0.158640, 0.251659},
+    {0.691840, -0.158640, 0.129426},
+    {0.702000, -0.158640, 0.000000},
+    {0.702896, -0.270000, 0.131264},
+    {0.713200, -0.270000, 0.000000},
+    {0.615106, -0.158640, 0.365183},
+    {0.673008, -0.270000, 0.255232},
+    {0.526958, -0.041520, 0.450429},
+    {0.381232, 0.204240, 0.468032},
+    {0.419856, 0.079920, 0.506656},
+    {0.451664, -0.041520, 0.538464},
+    {0.551560, -0.158640, 0.468484},
+    {0.625072, -0.270000, 0.370368},
+    {0.473248, -0.158640, 0.560048},
+    {0.560624, -0.270000, 0.475136},
+    {0.337021, 0.079920, 0.577502},
+    {0.363629, -0.041520, 0.613758},
+    {0.304712, 0.204240, 0.533477},
+    {0.339200, 0.330000, 0.426000},
+    {0.264878, 0.344175, 0.479199},
+    {0.190976, 0.330000, 0.533904},
+    {0.218383, 0.204240, 0.586582},
+    {0.243568, 0.079920, 0.634990},
+    {0.264309, -0.041520, 0.674855},
+    {0.381684, -0.158640, 0.638360},
+    {0.123511, 0.204240, 0.626082},
+    {0.140867, 0.079920, 0.677749},
+    {0.102113, 0.344175, 0.562381},
+    {0.187332, 0.344175, 0.526901},
+    {0.096843, 0.363075, 0.546691},
+    {0.007646, 0.363075, 0.568196},
+    {0.010357, 0.344175, 0.584503},
+    {0.011648, 0.330000, 0.592272},
+    {0.021362, 0.204240, 0.650710},
+    {0.030288, 0.079920, 0.704409},
+    {0.155160, -0.041520, 0.720298},
+    {-0.086800, 0.344175, 0.592130},
+    {-0.086800, 0.204240, 0.659200},
+    {-0.086800, 0.363075, 0.575610},
+    {0.005290, 0.369375, 0.554021},
+    {-0.086800, 0.367800, 0.567920},
+    {-0.086800, 0.369375, 0.561250},
+    {-0.178890, 0.369375, 0.554021},
+    {-0.181246, 0.363075, 0.568196},
+    {-0.183957, 0.344175, 0.584503},
+    {-0.086800, 0.330000, 0.600000},
+    {-0.086800, 0.363075, 0.552890},
+    {-0.178042, 0.367800, 0.548918},
+    {-0.264212, 0.367800, 0.528142},
+    {-0.265861, 0.369375, 0.533053},
+    {-0.270443, 0.363075, 0.546691},
+    {-0.275713, 0.344175, 0.562381},
+    {-0.185248, 0.330000, 0.592272},
+    {-0.194962, 0.204240, 0.650710},
+    {-0.086800, 0.141810, 0.687300},
+    {-0.353284, 0.363075, 0.512201},
+    {-0.360932, 0.344175, 0.526901},
+    {-0.364576, 0.330000, 0.533904},
+    {-0.297111, 0.204240, 0.626082},
+    {-0.346636, 0.369375, 0.499423},
+    {-0.417067, 0.367800, 0.450024},
+    {-0.420138, 0.369375, 0.454208},
+    {-0.428666, 0.363075, 0.465830},
+    {-0.438478, 0.344175, 0.479199},
+    {-0.391983, 0.204240, 0.586582},
+    {-0.314467, 0.079920, 0.677749},
+    {-0.203888, 0.079920, 0.704409},
+    {-0.086800, -0.041520, 0.758400},
+    {-0.211238, -0.041520, 0.748632},
+    {-0.417168, 0.079920, 0.634990},
+    {-0.328760, -0.041520, 0.720298},
+    {-0.478312, 0.204240, 0.533477},
+    {-0.510621, 0.079920, 0.577502},
+    {-0.437909, -0.041520, 0.674855},
+    {-0.338459, -0.158640, 0.749171},
+    {-0.216226, -0.158640, 0.778640},
+    {-0.086800, -0.158640, 0.788800},
+    {-0.218064, -0.270000, 0.789696},
+    {-0.086800, -0.270000, 0.800000},
+    {-0.451983, -0.158640, 0.701906},
+    {-0.342032, -0.270000, 0.759808},
+    {-0.537229, -0.041520, 0.613758},
+    {-0.554832, 0.204240, 0.468032},
+    {-0.593456, 0.079920, 0.506656},
+    {-0.625264, -0.041520, 0.538464},
+    {-0.555284, -0.158640, 0.638360},
+    {-0.457168, -0.270000, 0.711872},
+    {-0.646848, -0.158640, 0.560048},
+    {-0.561936, -0.270000, 0.647424},
+    {-0.664302, 0.079920, 0.423821},
+    {-0.700558, -0.041520, 0.450429},
+    {-0.620277, 0.204240, 0.391512},
+    {-0.512800, 0.330000, 0.426000},
+    {-0.565999, 0.344175, 0.351678},
+    {-0.620704, 0.330000, 0.277776},
+    {-0.673382, 0.204240, 0.305183},
+    {-0.721790, 0.079920, 0.330368},
+    {-0.761655, -0.041520, 0.351109},
+    {-0.725160, -0.158640, 0.468484},
+    {-0.712882, 0.204240, 0.210311},
+    {-0.764549, 0.079920, 0.227667},
+    {-0.649181, 0.344175, 0.188913},
+    {-0.613701, 0.344175, 0.274132},
+    {-0.633491, 0.363075, 0.183643},
+    {-0.654996, 0.363075, 0.094446},
+    {-0.671303, 0.344175, 0.097157},
+    {-0.679072, 0.330000, 0.098448},
+    {-0.737510, 0.204240, 0.108162},
+    {-0.791209, 0.079920, 0.117088},
+    {-0.807098, -0.041520, 0.241960},
+    {-0.678930, 0.344175, 0.000000},
+    {-0.746000, 0.204240, 0.000000},
+    {-0.662410, 0.363075, 0.000000},
+    {-0.640821, 0.369375, 0.092090},
+    {-0.654720, 0.367800, 0.000000},
+    {-0.648050, 0.369375, 0.000000},
+    {-0.640821, 0.369375, -0.092090},
+    {-0.654996, 0.363075, -0.094446},
+    {-0.671303, 0.344175, -0.097157},
+    {-0.686800, 0.330000, 0.000000},
+    {-0.639690, 0.363075, -0.000000},
+    {-0.635718, 0.367800, -0.091242},
+    {-0.614942, 0.367800, -0.177412},
+    {-0.619853, 0.369375, -0.179061},
+    {-0.633491, 0.363075, -0.183643},
+    {-0.649181, 0.344175, -0.188913},
+    {-0.679072, 0.330000, -0.098448},
+    {-0.737510, 0.204240, -0.108162},
+    {-0.774100, 0.141810, -0.000000},
+    {-0.599001, 0.363075, -0.266484},
+    {-0.613701, 0.344175, -0.274132},
+    {-0.620704, 0.330000, -0.277776},
+    {-0.712882, 0.204240, -0.210311},
+    {-0.586223, 0.369375, -0.259836},
+    {-0.536824, 0.367800, -0.330267},
+    {-0.541008, 0.369375, -0.333338},
+    {-0.552630, 0.363075, -0.341866},
+    {-0.764549, 0.079920, -0.227667},
+    {-0.791209, 0.079920, -0.117088},
+    {-0.845200, -0.041520, 0.000000},
+    {-0.835432, -0.041520, -0.124438},
+    {-0.807098, -0.041520, -0.241960},
+    {-0.865440, -0.158640, -0.129426},
+    {-0.875600, -0.158640, -0.000000},
+    {-0.835971, -0.158640, -0.251659},
+    {-0.876496, -0.270000, -0.131264},
+    {-0.886800, -0.270000, 0.000000},
+    {-0.846608, -0.270000, -0.255232},
+    {-0.495483, 0.363075, -0.408683},
+    {-0.485288, 0.369375, -0.398488},
+    {-0.420138, 0.369375, -0.454208},
+    {-0.417067, 0.367800, -0.450024},
+    {-0.344243, 0.367800, -0.494822},
+    {-0.346636, 0.369375, -0.499423},
+    {-0.264212, 0.367800, -0.528142},
+    {-0.265861, 0.369375, -0.533053},
+    {-0.342428, 0.355200, -0.491334},
+    {-0.262961, 0.355200, -0.524420},
+    {-0.346058, 0.330000, -0.498310},
+    {-0.479352, 0.363075, -0.392552},
+    {-0.265462, 0.330000, -0.531866},
+    {-0.178685, 0.330000, -0.552787},
+    {-0.177398, 0.355200, -0.545048},
+    {-0.178042, 0.367800, -0.548918},
+    {-0.086800, 0.363075, -0.552890},
+    {-0.086800, 0.330000, -0.560000},
+    {-0.419395, 0.330000, -0.453197},
+    {-0.484400, 0.330000, -0.397600},
+    {-0.534243, 0.363075, -0.328372},
+    {-0.539997, 0.330000, -0.332595},
+    {-0.578784, 0.363075, -0.255966},
+    {-0.585110, 0.330000, -0.259258},
+    {-0.611220, 0.355200, -0.176161},
+    {-0.618666, 0.330000, -0.178662},
+    {-0.631848, 0.355200, -0.090598},
+    {-0.639587, 0.330000, -0.091885},
+    {-0.646800, 0.330000, 0.000000},
+    {-0.619853, 0.369375, 0.179061},
+    {-0.599001, 0.363075, 0.266484},
+    {-0.614942, 0.367800, 0.177412},
+    {-0.635718, 0.367800, 0.091242},
+    {-0.586223, 0.369375, 0.259836},
+    {-0.639690, 0.363075, 0.000000},
+    {-0.631848, 0.355200, 0.090598},
+    {-0.611220, 0.355200, 0.176161},
+    {-0.581622, 0.367800, 0.257443},
+    {-0.541008, 0.369375, 0.333338},
+    {-0.552630, 0.363075, 0.341866},
+    {-0.495483, 0.363075, 0.408683},
+    {-0.507212, 0.344175, 0.420412},
+    {-0.536824, 0.367800, 0.330267},
+    {-0.485288, 0.369375, 0.398488},
+    {-0.578134, 0.355200, 0.255628},
+    {-0.618666, 0.330000, 0.178662},
+    {-0.639587, 0.330000, 0.091885},
+    {-0.585110, 0.330000, 0.259258},
+    {-0.479352, 0.363075, 0.392552},
+    {-0.415172, 0.363075, 0.447443},
+    {-0.342766, 0.363075, 0.491984},
+    {-0.484400, 0.330000, 0.397600},
+    {-0.539997, 0.330000, 0.332595},
+    {-0.419395, 0.330000, 0.453197},
+    {-0.346058, 0.330000, 0.498310},
+    {-0.262961, 0.355200, 0.524420},
+    {-0.265462, 0.330000, 0.531866},
+    {-0.177398, 0.355200, 0.545048},
+    {-0.178685, 0.330000, 0.552787},
+    {-0.086800, 0.330000, 0.560000},
+    {-0.646800, 0.330000, 0.000000},
+    {-0.800400, 0.079920, 0.000000},
+    {-0.835432, -0.041520, 0.124438},
+    {-0.845200, -0.041520, 0.000000},
+    {-0.865440, -0.158640, 0.129426},
+    {-0.835971, -0.158640, 0.251659},
+    {-0.875600, -0.158640, 0.000000},
+    {-0.876496, -0.270000, 0.131264},
+    {-0.846608, -0.270000, 0.255232},
+    {-0.788706, -0.158640, 0.365183},
+    {-0.798672, -0.270000, 0.370368},
+    {-0.734224, -0.270000, 0.475136},
+    {-0.654800, -0.270000, 0.568000},
+    {-0.886800, -0.270000, 0.000000},
+    {-0.870968, -0.321330, 0.130345},
+    {-0.881200, -0.321330, 0.000000},
+    {-0.876496, -0.270000, -0.131264},
+    {-0.881200, -0.321330, 0.000000},
+    {-0.992720, -0.206640, 0.000000},
+    {-0.942926, -0.243508, -0.032400},
+    {-0.882640, -0.282480, -0.057600},
+    {-0.866000, -0.367440, 0.000000},
+    {-0.855964, -0.367440, -0.127851},
+    {-0.846608, -0.270000, -0.255232},
+    {-0.816400, -0.444720, -0.000000},
+    {-0.793689, -0.321330, -0.367776},
+    {-0.734224, -0.270000, -0.475136},
+    {-0.650824, -0.321330, -0.564024},
+    {-0.942073, -0.251726, -0.057600},
+    {-0.940816, -0.263837, -0.075600},
+    {-0.872720, -0.312240, -0.086400},
+    {-0.994284, -0.216924, -0.057600},
+    {-1.035480, -0.169560, 0.000000},
+    {-1.036562, -0.172115, -0.032400},
+    {-1.101800, -0.090000, 0.000000},
+    {-1.071760, -0.130320, 0.000000},
+    {-1.036562, -0.172115, 0.032400},
+    {-0.992720, -0.206640, 0.000000},
+    {-1.039501, -0.179050, -0.057600},
+    {-0.939290, -0.278544, -0.086400},
+    {-1.000240, -0.256080, -0.090000},
+    {-0.860880, -0.347760, -0.086400},
+    {-1.049088, -0.201678, -0.086400},
+    {-1.077950, -0.139081, -0.057600},
+    {-1.043830, -0.189269, -0.075600},
+    {-1.054810, -0.215182, -0.090000},
+    {-1.084616, -0.148516, -0.075600},
+    {-0.935970, -0.310552, -0.086400},
+    {-0.850960, -0.377520, -0.057600},
+    {-1.060532, -0.228687, -0.086400},
+    {-0.934444, -0.325258, -0.075600},
+    {-1.158393, -0.073672, -0.086400},
+    {-1.145816, -0.064402, -0.075600},
+    {-1.140550, -0.128438, -0.090000},
+    {-1.135458, -0.056769, -0.057600},
+    {-1.144120, -0.010440, 0.000000},
+    {-1.164360, 0.060480, 0.000000},
+    {-1.160043, 0.025444, -0.032400},
+    {-1.147042, -0.012039, -0.032400},
+    {-1.156880, 0.026640, 0.000000},
+    {-1.147042, -0.012039, 0.032400},
+    {-1.154971, -0.016379, -0.057600},
+    {-1.166658, -0.022775, -0.075600},
+    {-1.176655, 0.057982, -0.057600},
+    {-1.170160, 0.090000, -0.032400},
+    {-1.162040, 0.114390, 0.000000},
+    {-1.170160, 0.090000, 0.032400},
+    {-1.168628, 0.022197, 0.057600},
+    {-1.135458, -0.056769, 0.057600},
+    {-1.103970, -0.092152, 0.032400},
+    {-1.165365, 0.115073, 0.032400},
+    {-1.174391, 0.116926, 0.057600},
+    {-1.187692, 0.119658, 0.075600},
+    {-1.124680, 0.149130, 0.000000},
+    {-1.151137, 0.135150, -0.032400},
+    {-1.165365, 0.115073, -0.032400},
+    {-1.147920, 0.133920, 0.000000},
+    {-1.135924, 0.155280, 0.057600},
+    {-1.172734, 0.143407, 0.075600},
+    {-1.151137, 0.135150, 0.032400},
+    {-1.188358, 0.149380, 0.086400},
+    {-1.203844, 0.122975, 0.086400},
+    {-1.192720, 0.090000, 0.075600},
+    {-1.113780, 0.175801, 0.075600},
+    {-1.127140, 0.185397, 0.086400},
+    {-1.060640, 0.176940, 0.057600},
+    {-1.127707, 0.150786, 0.032400},
+    {-1.054180, 0.170955, 0.032400},
+    {-0.882443, 0.188565, 0.057600},
+    {-1.017362, 0.192436, 0.075600},
+    {-1.004548, 0.176599, 0.032400},
+    {-1.026632, 0.203892, 0.086400},
+    {-1.036720, 0.216360, 0.090000},
+    {-1.141680, 0.195840, 0.090000},
+    {-0.888078, 0.210706, 0.086400},
+    {-0.706800, 0.225000, 0.090000},
+    {-0.884988, 0.198564, 0.075600},
+    {-0.722640, 0.189360, 0.057600},
+    {-0.880716, 0.181780, 0.032400},
+    {-1.002640, 0.174240, 0.000000},
+    {-0.807160, 0.179910, 0.000000},
+    {-0.946650, 0.180022, -0.032400},
+    {-1.054180, 0.170955, -0.032400},
+    {-1.051800, 0.168750, 0.000000},
+    {-0.880080, 0.179280, 0.000000},
+    {-0.726800, 0.180000, 0.000000},
+    {-0.712720, 0.211680, 0.086400},
+    {-0.700880, 0.238320, 0.086400},
+    {-0.894802, 0.237134, 0.086400},
+    {-0.695440, 0.250560, 0.075600},
+    {-0.897892, 0.249276, 0.075600},
+    {-1.046808, 0.228828, 0.086400},
+    {-1.056078, 0.240284, 0.075600},
+    {-1.106880, 0.219780, 0.086400},
+    {-0.900437, 0.259275, 0.057600},
+    {-0.687920, 0.267480, 0.032400},
+    {-0.991470, 0.262688, 0.032400},
+    {-1.127960, 0.239310, 0.057600},
+    {-1.118440, 0.230490, 0.075600},
+    {-1.180583, 0.223782, 0.057600},
+    {-1.194742, 0.187446, 0.086400},
+    {-1.205360, 0.155880, 0.090000},
+    {-1.222362, 0.162380, 0.086400},
+    {-1.226800, 0.090000, 0.090000},
+    {-1.209446, 0.195488, 0.075600},
+    {-1.237986, 0.168353, 0.075600},
+    {-1.244560, 0.090000, 0.086400},
+    {-1.213360, 0.005280, 0.090000},
+    {-1.180848, -0.030541, 0.086400},
+    {-1.166658, -0.022775, 0.075600},
+    {-1.274320, 0.090000, 0.057600},
+    {-1.257044, 0.041652, 0.075600},
+    {-1.230078, -0.001042, 0.086400},
+    {-1.185767, -0.093848, 0.086400},
+    {-1.129080, -0.117060, 0.086400},
+    {-1.101520, -0.172440, 0.090000},
+    {-1.118540, -0.106605, 0.075600},
+    {-1.077950, -0.139081, 0.057600},
+    {-1.043830, -0.189269, 0.075600},
+    {-1.049088, -0.201678, 0.086400},
+    {-1.152020, -0.139815, 0.086400},
+    {-1.000240, -0.256080, 0.090000},
+    {-1.225922, -0.055210, 0.075600},
+    {-1.270285, 0.038962, 0.057600},
+    {-1.237609, -0.061606, 0.057600},
+    {-1.208702, -0.110751, 0.057600},
+    {-1.162560, -0.150270, 0.075600},
+    {-1.002466, -0.270714, 0.086400},
+    {-0.939290, -0.278544, 0.086400},
+    {-0.866800, -0.330000, 0.090000},
+    {-0.940816, -0.263837, 0.075600},
+    {-0.878160, -0.295920, 0.075600},
+    {-0.855440, -0.364080, 0.075600},
+    {-1.065790, -0.241096, 0.075600},
+    {-0.934444, -0.325258, 0.075600},
+    {-1.171240, -0.158880, 0.057600},
+    {-1.125090, -0.205799, 0.057600},
+    {-1.070119, -0.251316, 0.057600},
+    {-1.006196, -0.295236, 0.057600},
+    {-0.933187, -0.337369, 0.057600},
+    {-0.850960, -0.377520, 0.057600},
+    {-1.007339, -0.302751, 0.032400},
+    {-0.932020, -0.348615, 0.000000},
+    {-1.074140, -0.260805, 0.000000},
+    {-1.131280, -0.214560, 0.000000},
+    {-1.177130, -0.164722, 0.032400},
+    {-1.215730, -0.115932, 0.032400},
+    {-1.218320, -0.117840, 0.000000},
+    {-1.248460, -0.067545, 0.000000},
+    {-1.282580, 0.036465, 0.000000},
+    {-1.266677, -0.014884, 0.032400},
+    {-1.283440, 0.090000, 0.032400},
+    {-1.286800, 0.090000, 0.000000},
+    {-1.274320, 0.090000, -0.057600},
+    {-1.270285, 0.038962, -0.057600},
+    {-1.266677, -0.014884, -0.032400},
+    {-1.248460, -0.067545, 0.000000},
+    {-1.280800, 0.138780, 0.000000},
+    {-1.268449, 0.136244, 0.057600},
+    {-1.262800, 0.177840, 0.000000},
+    {-1.250852, 0.173272, 0.057600},
+    {-1.221556, 0.202110, 0.057600},
+    {-1.232800, 0.208260, 0.000000},
+    {-1.229773, 0.206604, -0.032400},
+    {-1.280800, 0.138780, 0.000000},
+    {-1.190800, 0.231120, 0.000000},
+    {-1.136800, 0.247500, 0.000000},
+    {-1.188049, 0.229144, 0.032400},
+    {-1.070800, 0.258480, 0.000000},
+    {-1.068892, 0.256121, -0.032400},
+    {-1.127960, 0.239310, -0.057600},
+    {-0.992800, 0.265140, 0.000000},
+    {-1.068892, 0.256121, 0.032400},
+    {-1.063711, 0.249719, -0.057600},
+    {-1.056078, 0.240284, -0.075600},
+    {-1.169580, 0.215879, -0.075600},
+    {-0.902164, 0.266060, -0.032400},
+    {-0.900437, 0.259275, -0.057600},
+    {-0.902800, 0.268560, 0.000000},
+    {-0.800800, 0.269820, 0.000000},
+    {-0.686800, 0.270000, 0.000000},
+    {-0.690960, 0.260640, -0.057600},
+    {-0.695440, 0.250560, -0.075600},
+    {-0.700880, 0.238320, -0.086400},
+    {-0.894802, 0.237134, -0.086400},
+    {-0.706800, 0.225000, -0.090000},
+    {-1.046808, 0.228828, -0.086400},
+    {-0.712720, 0.211680, -0.086400},
+    {-0.888078, 0.210706, -0.086400},
+    {-1.036720, 0.216360, -0.090000},
+    {-1.156220, 0.206283, -0.086400},
+    {-1.026632, 0.203892, -0.086400},
+    {-1.141680, 0.195840, -0.090000},
+    {-0.718160, 0.199440, -0.075600},
+    {-1.017362, 0.192436, -0.075600},
+    {-1.081720, 0.196470, -0.086400},
+    {-1.205360, 0.155880, -0.090000},
+    {-1.222362, 0.162380, -0.086400},
+    {-1.221556, 0.202110, -0.057600},
+    {-1.237986, 0.168353, -0.075600},
+    {-1.250852, 0.173272, -0.057600},
+    {-1.255148, 0.133512, -0.075600},
+    {-1.162738, 0.169944, -0.086400},
+    {-1.221420, 0.126585, -0.090000},
+    {-1.113780, 0.175801, -0.075600},
+    {-1.148034, 0.161902, -0.075600},
+    {-1.172734, 0.143407, -0.075600},
+    {-1.203844, 0.122975, -0.086400},
+    {-1.260880, 0.090000, -0.075600},
+    {-1.211732, -0.047444, -0.086400},
+    {-1.240966, 0.044918, -0.086400},
+    {-1.277475, 0.138097, -0.032400},
+    {-1.245441, -0.006852, -0.075600},
+    {-1.258092, -0.011637, -0.057600},
+    {-1.198344, -0.103118, -0.075600},
+    {-1.237609, -0.061606, -0.057600},
+    {-1.208702, -0.110751, -0.057600},
+    {-1.215730, -0.115932, -0.032400},
+    {-1.152020, -0.139815, -0.086400},
+    {-1.118424, -0.196364, -0.075600},
+    {-1.125090, -0.205799, -0.057600},
+    {-1.177130, -0.164722, -0.032400},
+    {-1.129614, -0.212201, -0.032400},
+    {-1.070119, -0.251316, -0.057600},
+    {-1.073058, -0.258250, -0.032400},
+    {-1.065790, -0.241096, -0.075600},
+    {-0.933187, -0.337369, -0.057600},
+    {-1.007339, -0.302751, -0.032400},
+    {-0.846800, -0.390000, 0.000000},
+    {-0.932334, -0.345587, -0.032400},
+    {-1.196290, -0.038992, -0.090000},
+    {-1.205974, 0.052027, -0.086400},
+    {-1.187692, 0.119658, -0.075600},
+    {-1.189896, 0.055293, -0.075600},
+    {-1.174391, 0.116926, -0.057600},
+    {-1.095311, 0.162536, -0.032400},
+    {-1.127707, 0.150786, -0.032400},
+    {-1.060640, 0.176940, -0.057600},
+    {-0.882443, 0.188565, -0.057600},
+    {-0.725680, 0.182520, -0.032400},
+    {-0.722640, 0.189360, -0.057600},
+    {-0.846800, -0.390000, 0.000000},
+    {-0.942073, -0.251726, 0.057600},
+    {-0.886800, -0.270000, 0.000000},
+    {-0.994284, -0.216924, 0.057600},
+    {-0.942926, -0.243508, 0.032400},
+    {-1.039501, -0.179050, 0.057600},
+    {-0.855964, -0.367440, 0.127851},
+    {-0.826853, -0.367440, 0.248596},
+    {-0.843600, -0.408510, 0.000000},
+    {-0.807003, -0.444720, 0.119713},
+    {-0.779745, -0.444720, 0.232772},
+    {-0.736027, -0.444720, 0.337776},
+    {-0.639213, -0.544560, 0.287406},
+    {-0.723519, -0.503280, 0.213884},
+    {-0.816400, -0.444720, 0.000000},
+    {-0.748565, -0.503280, 0.109999},
+    {-0.676411, -0.544560, 0.198060},
+    {-0.589201, -0.544560, 0.368706},
+    {-0.620704, -0.570000, 0.277776},
+    {-0.656656, -0.570000, 0.191424},
+    {-0.699604, -0.544560, 0.101861},
+    {-0.707600, -0.544560, 0.000000},
+    {-0.679072, -0.570000, 0.098448},
+    {-0.686800, -0.570000, 0.000000},
+    {0.092261, 0.369375, 0.533053},
+    {0.179684, 0.363075, 0.512201},
+    {0.090612, 0.367800, 0.528142},
+    {0.004442, 0.367800, 0.548918},
+    {0.173036, 0.369375, 0.499423},
+    {-0.086800, 0.363075, 0.552890},
+    {0.003798, 0.355200, 0.545048},
+    {0.089361, 0.355200, 0.524420},
+    {0.170643, 0.367800, 0.494822},
+    {0.246538, 0.369375, 0.454208},
+    {0.255066, 0.363075, 0.465830},
+    {0.321883, 0.363075, 0.408683},
+    {0.333612, 0.344175, 0.420412},
+    {0.243467, 0.367800, 0.450024},
+    {0.311688, 0.369375, 0.398488},
+    {0.168828, 0.355200, 0.491334},
+    {0.091862, 0.330000, 0.531866},
+    {0.005085, 0.330000, 0.552787},
+    {0.172458, 0.330000, 0.498310},
+    {0.305752, 0.363075, 0.392552},
+    {0.360643, 0.363075, 0.328372},
+    {0.405184, 0.363075, 0.255966},
+    {0.310800, 0.330000, 0.397600},
+    {0.245795, 0.330000, 0.453197},
+    {0.366397, 0.330000, 0.332595},
+    {0.411510, 0.330000, 0.259258},
+    {0.437620, 0.355200, 0.176161},
+    {0.445066, 0.330000, 0.178662},
+    {0.458248, 0.355200, 0.090598},
+    {0.465987, 0.330000, 0.091885},
+    {0.473200, 0.330000, 0.000000},
+    {-0.086800, 0.330000, 0.560000},
+    {-0.086800, 0.079920, 0.713600},
+    {0.037638, -0.041520, 0.748632},
+    {-0.086800, -0.041520, 0.758400},
+    {0.042626, -0.158640, 0.778640},
+    {0.164859, -0.158640, 0.749171},
+    {-0.086800, -0.158640, 0.788800},
+    {0.044464, -0.270000, 0.789696},
+    {0.168432, -0.270000, 0.759808},
+    {0.278383, -0.158640, 0.701906},
+    {0.283568, -0.270000, 0.711872},
+    {0.388336, -0.270000, 0.647424},
+    {0.481200, -0.270000, 0.568000},
+    {-0.086800, -0.270000, 0.800000},
+    {0.043545, -0.321330, 0.784168},
+    {-0.086800, -0.321330, 0.794400},
+    {-0.086800, -0.321330, 0.794400},
+    {0.041051, -0.367440, 0.769164},
+    {0.161796, -0.367440, 0.740053},
+    {-0.086800, -0.408510, 0.756800},
+    {0.032913, -0.444720, 0.720203},
+    {0.145972, -0.444720, 0.692945},
+    {0.250976, -0.444720, 0.649227},
+    {0.200606, -0.544560, 0.552413},
+    {0.127084, -0.503280, 0.636719},
+    {-0.086800, -0.444720, 0.729600},
+    {0.023199, -0.503280, 0.661765},
+    {0.111260, -0.544560, 0.589611},
+    {0.281906, -0.544560, 0.502401},
+    {0.190976, -0.570000, 0.533904},
+    {0.104624, -0.570000, 0.569856},
+    {0.015061, -0.544560, 0.612804},
+    {-0.086800, -0.544560, 0.620800},
+    {0.011648, -0.570000, 0.592272},
+    {-0.086800, -0.570000, 0.600000},
+    {-0.364576, -0.570000, -0.533904},
+    {-0.284860, -0.544560, -0.589611},
+    {-0.278224, -0.570000, -0.569856},
+    {-0.196799, -0.503280, -0.661765},
+    {-0.188661, -0.544560, -0.612804},
+    {-0.086800, -0.444720, -0.729600},
+    {-0.086800, -0.544560, -0.620800},
+    {-0.185248, -0.570000, -0.592272},
+    {-0.086800, -0.570000, -0.600000},
+    {0.593200, -0.094320, -0.126720},
+    {0.593200, -0.060000, 0.000000},
+    {0.692752, -0.083489, -0.124516},
+    {0.698343, -0.117055, -0.163427},
+    {0.593200, -0.176160, -0.190080},
+    {0.759992, -0.038352, -0.066675},
+    {0.757680, -0.030960, 0.000000},
+    {0.766266, -0.058416, -0.118533},
+    {0.786741, -0.123888, -0.177800},
+    {0.830204, -0.046975, -0.144003},
+    {0.798960, -0.162960, -0.185208},
+    {0.593200, -0.273840, -0.190080},
+    {0.883314, -0.021907, -0.148516},
+    {0.900080, -0.049080, -0.154704},
+    {0.818753, -0.021809, -0.109716},
+    {0.894120, 0.059220, -0.114660},
+    {0.846612, 0.037579, -0.055694},
+    {0.808120, 0.001560, 0.000000},
+    {0.880680, 0.075180, -0.087360},
+    {0.934036, 0.178260, -0.085317},
+    {0.952772, 0.169080, -0.097505},
+    {0.950320, 0.089280, -0.118296},
+    {1.003440, 0.224760, -0.087792},
+    {1.019748, 0.284957, -0.075306},
+    {0.941094, 0.239491, -0.056187},
+    {0.958727, 0.235325, -0.073745},
+    {0.908137, 0.190950, -0.036564},
+    {0.868200, 0.090000, 0.000000},
+    {0.929128, 0.242318, -0.031605},
+    {0.972608, 0.288454, -0.050204},
+    {1.018160, 0.330000, -0.048000},
+    {1.077680, 0.330000, -0.072000},
+    {1.076012, 0.280783, -0.075306},
+    {1.148720, 0.330000, -0.072000},
+    {1.048153, 0.214195, -0.073745},
+    {1.101863, 0.278866, -0.065893},
+    {1.208240, 0.330000, -0.048000},
+    {0.993548, 0.149100, -0.097505},
+    {1.012284, 0.139920, -0.085317},
+    {1.065786, 0.210029, -0.056187},
+    {1.123152, 0.277286, -0.050204},
+    {1.233200, 0.330000, 0.000000},
+    {1.142920, 0.275820, 0.000000},
+    {1.027713, 0.132360, -0.065004},
+    {1.082160, 0.206160, 0.000000},
+    {0.932252, -0.101222, -0.129951},
+    {0.945960, -0.002340, -0.131040},
+    {0.874372, -0.144046, -0.164575},
+    {0.888276, -0.174605, -0.144003},
+    {0.944939, -0.121786, -0.099010},
+    {0.984840, -0.048510, -0.049140},
+    {1.038183, 0.127230, -0.036564},
+    {0.953548, -0.135739, -0.055694},
+    {0.811179, -0.202032, -0.177800},
+    {0.831654, -0.267504, -0.118533},
+    {0.910360, -0.223140, 0.000000},
+    {0.719908, -0.246526, -0.186774},
+    {0.726697, -0.287285, -0.163427},
+    {0.732288, -0.320851, -0.124516},
+    {0.840240, -0.294960, 0.000000},
+    {0.988200, -0.052500, 0.000000},
+    {1.042040, 0.125340, 0.000000},
+    {1.042040, 0.125340, 0.000000},
+    {1.077752, 0.207202, 0.031605},
+    {1.142920, 0.275820, 0.000000},
+    {0.956720, -0.140880, 0.000000},
+    {0.984840, -0.048510, 0.049140},
+    {1.038183, 0.127230, 0.036564},
+    {1.101863, 0.278866, 0.065893},
+    {1.233200, 0.330000, 0.000000},
+    {1.226480, 0.330000, 0.027000},
+    {1.208240, 0.330000, 0.048000},
+    {1.181360, 0.330000, 0.063000},
+    {1.027713, 0.132360, 0.065004},
+    {1.048153, 0.214195, 0.073745},
+    {1.076012, 0.280783, 0.075306},
+    {0.975720, -0.037680, 0.087360},
+    {0.910360, -0.223140, 0.000000},
+    {0.944939, -0.121786, 0.099010},
+    {0.962280, -0.021720, 0.114660},
+    {1.012284, 0.139920, 0.085317},
+    {0.993548, 0.149100, 0.097505},
+    {1.047880, 0.282870, 0.078444},
+    {1.130885, 0.339214, 0.074160},
+    {1.182863, 0.347199, 0.069005},
+    {0.973160, 0.159090, 0.101568},
+    {0.980139, 0.230266, 0.084280},
+    {1.045040, 0.330000, 0.063000},
+    {1.077680, 0.330000, 0.072000},
+    {0.916846, -0.076253, 0.148516},
+    {0.888276, -0.174605, 0.144003},
+    {0.811179, -0.202032, 0.177800},
+    {0.900080, -0.049080, 0.154704},
+    {0.798960, -0.162960, 0.185208},
+    {0.883314, -0.021907, 0.148516},
+    {0.719908, -0.246526, 0.186774},
+    {0.726697, -0.287285, 0.163427},
+    {0.831654, -0.267504, 0.118533},
+    {0.899727, -0.199771, 0.109716},
+    {0.732288, -0.320851, 0.124516},
+    {0.737480, -0.352020, 0.000000},
+    {0.840240, -0.294960, 0.000000},
+    {0.593200, -0.273840, 0.190080},
+    {0.593200, -0.355680, 0.126720},
+    {0.593200, -0.225000, 0.198000},
+    {0.786741, -0.123888, 0.177800},
+    {0.593200, -0.176160, 0.190080},
+    {0.775513, -0.087984, 0.155575},
+    {0.830204, -0.046975, 0.144003},
+    {0.593200, -0.094320, 0.126720},
+    {0.692752, -0.083489, 0.124516},
+    {0.766266, -0.058416, 0.118533},
+    {0.855221, 0.023626, 0.099010},
+    {0.894120, 0.059220, 0.114660},
+    {0.808120, 0.001560, 0.000000},
+    {0.810983, -0.004732, 0.061716},
+    {0.846612, 0.037579, 0.055694},
+    {0.688958, -0.060712, 0.070040},
+    {0.593200, -0.060000, 0.000000},
+    {0.687560, -0.052320, 0.000000},
+    {0.868200, 0.090000, 0.000000},
+    {0.890508, 0.137990, 0.042586},
+    {0.918607, 0.185820, 0.065004},
+    {0.929128, 0.242318, 0.031605},
+    {0.924720, 0.243360, 0.000000},
+    {0.958727, 0.235325, 0.073745},
+    {0.972608, 0.288454, 0.050204},
+    {0.999920, 0.330000, 0.027000},
+    {0.993200, 0.330000, 0.000000},
+    {0.958162, 0.289525, -0.028240},
+    {0.993200, 0.330000, 0.000000},
+    {0.993897, 0.286874, 0.065893},
+    {0.593200, -0.390000, 0.000000},
+    {1.106897, 0.345921, 0.069005},
+    {1.071994, 0.345333, 0.060379},
+    {1.045040, 0.330000, 0.063000},
+    {1.144880, 0.346560, 0.071880},
+    {1.090236, 0.353233, 0.054130},
+    {1.161440, 0.355380, 0.064440},
+    {1.192999, 0.352880, 0.065779},
+    {1.163825, 0.356719, 0.060000},
+    {1.095310, 0.354322, 0.050400},
+    {1.062155, 0.352386, 0.041242},
+    {1.054318, 0.351842, 0.020002},
+    {1.071682, 0.352498, 0.035558},
+    {1.043250, 0.344849, 0.046003},
+    {1.018160, 0.330000, 0.048000},
+    {0.999920, 0.330000, 0.027000},
+    {1.043100, 0.351812, 0.023198},
+    {1.047920, 0.351600, 0.000000},
+    {1.055729, 0.349125, 0.018533},
+    {1.095809, 0.350635, 0.043243},
+    {1.199530, 0.357968, 0.057600},
+    {1.156355, 0.352916, 0.051480},
+    {1.117288, 0.346681, 0.046195},
+    {1.049840, 0.330000, 0.028800},
+    {1.068641, 0.345074, 0.030797},
+    {1.053732, 0.344582, 0.017323},
+    {1.048240, 0.344400, 0.000000},
+    {1.036080, 0.351600, 0.000000},
+    {1.016560, 0.344400, 0.000000},
+    {0.993200, 0.330000, 0.000000},
+    {0.999920, 0.330000, -0.027000},
+    {1.053676, 0.349539, -0.043853},
+    {1.027040, 0.348900, 0.000000},
+    {1.043250, 0.344849, -0.046003},
+    {1.018160, 0.330000, -0.048000},
+    {1.082360, 0.350227, -0.057557},
+    {1.043100, 0.351812, -0.023198},
+    {1.062155, 0.352386, -0.041242},
+    {1.071682, 0.352498, -0.035558},
+    {1.055729, 0.349125, -0.018533},
+    {1.047920, 0.351600, 0.000000},
+    {1.128345, 0.354641, -0.053338},
+    {1.124803, 0.351728, -0.049421},
+    {1.124334, 0.354261, -0.061862},
+    {1.163825, 0.356719, -0.060000},
+    {1.187907, 0.354105, -0.049421},
+    {1.090610, 0.345800, -0.040421},
+    {1.146320, 0.347640, -0.048120},
+    {1.113200, 0.330000, -0.045000},
+    {1.227048, 0.358374, -0.046670},
+    {1.202030, 0.349480, -0.040421},
+    {1.175352, 0.348599, -0.046195},
+    {1.161440, 0.355380, -0.064440},
+    {1.198546, 0.356499, -0.061862},
+    {1.144880, 0.346560, -0.071880},
+    {1.106897, 0.345921, -0.069005},
+    {1.192999, 0.352880, -0.065779},
+    {1.232644, 0.357527, -0.054130},
+    {1.260725, 0.358374, -0.041242},
+    {1.252638, 0.359342, -0.035558},
+    {1.270002, 0.359998, -0.020002},
+    {1.223999, 0.350206, -0.030797},
+    {1.244400, 0.350880, 0.000000},
+    {1.256514, 0.354404, -0.043853},
+    {1.279780, 0.358948, -0.023198},
+    {1.217766, 0.347787, -0.060379},
+    {1.148720, 0.330000, -0.072000},
+    {1.113200, 0.330000, -0.075000},
+    {1.181360, 0.330000, -0.063000},
+    {1.246510, 0.348271, -0.046003},
+    {1.275979, 0.354870, -0.024667},
+    {1.286800, 0.359160, 0.000000},
+    {1.276400, 0.360240, 0.000000},
+    {1.188720, 0.330000, -0.016200},
+    {1.193200, 0.330000, 0.000000},
+    {1.176560, 0.330000, -0.028800},
+    {1.158640, 0.330000, -0.037800},
+    {1.067760, 0.330000, -0.037800},
+    {1.037680, 0.330000, -0.016200},
+    {1.068641, 0.345074, -0.030797},
+    {1.053732, 0.344582, -0.017323},
+    {1.048240, 0.344400, 0.000000},
+    {1.033200, 0.330000, 0.000000},
+    {1.037680, 0.330000, 0.016200},
+    {1.067760, 0.330000, 0.037800},
+    {1.146320, 0.347640, 0.048120},
+    {1.136880, 0.330000, 0.043200},
+    {1.187907, 0.354105, 0.049421},
+    {1.158334, 0.340593, 0.044006},
+    {1.216901, 0.355198, 0.043243},
+    {1.240778, 0.356097, 0.032947},
+    {1.176560, 0.330000, 0.028800},
+    {1.232340, 0.359115, 0.050400},
+    {1.259360, 0.360060, 0.038400},
+    {1.227830, 0.353716, 0.057557},
+    {1.260725, 0.358374, 0.041242},
+    {1.246510, 0.348271, 0.046003},
+    {1.279780, 0.358948, 0.023198},
+    {1.273200, 0.348720, 0.000000},
+    {1.284450, 0.360938, 0.000000},
+    {1.226480, 0.330000, -0.027000},
+    {1.208240, 0.330000, -0.048000},
+    {1.262950, 0.356932, 0.000000},
+    {1.238908, 0.350698, 0.017323},
+    {1.188720, 0.330000, 0.016200},
+    {1.077680, 0.330000, -0.072000},
+    {1.045040, 0.330000, -0.063000},
+    {0.737480, -0.352020, 0.000000},
+    {0.593200, -0.390000, 0.000000},
+    {0.593200, -0.355680, -0.126720},
+    {-0.086800, 0.630000, 0.000000},
+    {-0.008960, 0.626580, 0.000000},
+    {-0.023750, 0.626580, -0.046315},
+    {-0.040485, 0.626580, -0.063050},
+    {-0.086800, 0.626580, -0.077840},
+    {-0.086800, 0.626580, -0.077840},
+    {-0.133115, 0.626580, -0.063050},
+    {-0.149850, 0.626580, -0.046315},
+    {-0.164640, 0.626580, 0.000000},
+    {-0.164640, 0.626580, 0.000000},
+    {-0.149850, 0.626580, 0.046315},
+    {-0.133115, 0.626580, 0.063050},
+    {-0.086800, 0.626580, 0.077840},
+    {-0.086800, 0.626580, 0.077840},
+    {-0.040485, 0.626580, 0.063050},
+    {-0.023750, 0.626580, 0.046315},
+    {-0.008960, 0.626580, -0.000000},
+    {-0.086800, 0.617040, -0.123520},
+    {-0.047274, 0.617040, -0.117344},
+    {-0.086800, 0.602460, -0.143280},
+    {-0.013306, 0.617040, -0.100051},
+    {-0.040952, 0.602460, -0.136116},
+    {-0.086800, 0.583920, -0.143360},
+    {-0.001551, 0.602460, -0.116055},
+    {-0.040930, 0.583920, -0.136191},
+    {0.013251, 0.617040, -0.073494},
+    {0.029255, 0.602460, -0.085249},
+    {0.015115, 0.583920, -0.101915},
+    {-0.009461, 0.562500, -0.105293},
+    {-0.045210, 0.562500, -0.123498},
+    {-0.065397, 0.562500, -0.128334},
+    {-0.086800, 0.515340, -0.087920},
+    {-0.058692, 0.515340, -0.083518},
+    {0.005612, 0.562500, -0.092412},
+    {-0.034517, 0.515340, -0.071196},
+    {-0.046030, 0.515340, -0.078263},
+    {0.040833, 0.583920, -0.066522},
+    {0.018493, 0.562500, -0.077339},
+    {-0.015604, 0.515340, -0.052283},
+    {-0.044195, 0.491760, -0.058031},
+    {-0.063902, 0.491760, -0.068086},
+    {-0.086800, 0.491760, -0.071680},
+    {-0.055791, 0.469620, -0.059588},
+    {-0.086800, 0.469620, -0.066960},
+    {-0.028769, 0.491760, -0.042605},
+    {-0.047022, 0.469620, -0.054196},
+    {0.036698, 0.562500, -0.041590},
+    {-0.008537, 0.515340, -0.040770},
+    {0.049391, 0.583920, -0.045870},
+    {0.056560, 0.583920, 0.000000},
+    {0.041534, 0.562500, -0.021403},
+    {-0.003282, 0.515340, -0.028108},
+    {-0.018714, 0.491760, -0.022898},
+    {-0.032604, 0.469620, -0.039778},
+    {-0.039286, 0.450000, -0.064742},
+    {-0.049763, 0.450000, -0.071187},
+    {-0.023202, 0.469620, -0.021371},
+    {-0.022058, 0.450000, -0.047514},
+    {0.001120, 0.515340, 0.000000},
+    {-0.015120, 0.491760, 0.000000},
+    {0.049316, 0.602460, -0.045848},
+    {0.056480, 0.602460, 0.000000},
+    {0.030544, 0.617040, -0.039526},
+    {0.036720, 0.617040, 0.000000},
+    {-0.019840, 0.469620, 0.000000},
+    {-0.010819, 0.450000, -0.025523},
+    {-0.006800, 0.450000, 0.000000},
+    {-0.086800, 0.450000, -0.080000},
+    {0.036720, 0.617040, -0.000000},
+    {0.030544, 0.617040, 0.039526},
+    {0.056480, 0.602460, -0.000000},
+    {0.013251, 0.617040, 0.073494},
+    {0.049316, 0.602460, 0.045848},
+    {0.056560, 0.583920, 0.000000},
+    {0.029255, 0.602460, 0.085249},
+    {0.049391, 0.583920, 0.045870},
+    {-0.013306, 0.617040, 0.100051},
+    {-0.047274, 0.617040, 0.117344},
+    {-0.001551, 0.602460, 0.116055},
+    {0.015115, 0.583920, 0.101915},
+    {0.018493, 0.562500, 0.077339},
+    {0.036698, 0.562500, 0.041590},
+    {0.041534, 0.562500, 0.021403},
+    {0.001120, 0.515340, -0.000000},
+    {-0.003282, 0.515340, 0.028108},
+    {0.005612, 0.562500, 0.092412},
+    {-0.015604, 0.515340, 0.052283},
+    {-0.008537, 0.515340, 0.040770},
+    {-0.020278, 0.583920, 0.127633},
+    {-0.040952, 0.602460, 0.136116},
+    {-0.040930, 0.583920, 0.136191},
+    {-0.045210, 0.562500, 0.123498},
+    {-0.009461, 0.562500, 0.105293},
+    {-0.034517, 0.515340, 0.071196},
+    {-0.028769, 0.491760, 0.042605},
+    {-0.018714, 0.491760, 0.022898},
+    {-0.015120, 0.491760, -0.000000},
+    {-0.027212, 0.469620, 0.031009},
+    {-0.019840, 0.469620, -0.000000},
+    {-0.044195, 0.491760, 0.058031},
+    {-0.032604, 0.469620, 0.039778},
+    {-0.046030, 0.515340, 0.078263},
+    {-0.063902, 0.491760, 0.068086},
+    {-0.047022, 0.469620, 0.054196},
+    {-0.022058, 0.450000, 0.047514},
+    {-0.015613, 0.450000, 0.037037},
+    {-0.006800, 0.450000, -0.000000},
+    {-0.039286, 0.450000, 0.064742},
+    {-0.065429, 0.469620, 0.063598},
+    {-0.058692, 0.515340, 0.083518},
+    {-0.086800, 0.515340, 0.087920},
+    {-0.086800, 0.491760, 0.071680},
+    {-0.065397, 0.562500, 0.128334},
+    {-0.086800, 0.583920, 0.143360},
+    {-0.086800, 0.602460, 0.143280},
+    {-0.086800, 0.617040, 0.123520},
+    {-0.086800, 0.469620, 0.066960},
+    {-0.061277, 0.450000, 0.075981},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.086800, 0.617040, 0.123520},
+    {-0.126326, 0.617040, 0.117344},
+    {-0.086800, 0.602460, 0.143280},
+    {-0.160294, 0.617040, 0.100051},
+    {-0.132648, 0.602460, 0.136116},
+    {-0.086800, 0.583920, 0.143360},
+    {-0.172049, 0.602460, 0.116055},
+    {-0.132670, 0.583920, 0.136191},
+    {-0.186851, 0.617040, 0.073494},
+    {-0.204144, 0.617040, 0.039526},
+    {-0.202855, 0.602460, 0.085249},
+    {-0.188715, 0.583920, 0.101915},
+    {-0.164139, 0.562500, 0.105293},
+    {-0.128390, 0.562500, 0.123498},
+    {-0.108203, 0.562500, 0.128334},
+    {-0.086800, 0.515340, 0.087920},
+    {-0.114908, 0.515340, 0.083518},
+    {-0.179212, 0.562500, 0.092412},
+    {-0.139083, 0.515340, 0.071196},
+    {-0.127570, 0.515340, 0.078263},
+    {-0.214433, 0.583920, 0.066522},
+    {-0.222916, 0.602460, 0.045848},
+    {-0.222991, 0.583920, 0.045870},
+    {-0.210298, 0.562500, 0.041590},
+    {-0.192093, 0.562500, 0.077339},
+    {-0.157996, 0.515340, 0.052283},
+    {-0.129405, 0.491760, 0.058031},
+    {-0.109698, 0.491760, 0.068086},
+    {-0.086800, 0.491760, 0.071680},
+    {-0.117809, 0.469620, 0.059588},
+    {-0.086800, 0.469620, 0.066960},
+    {-0.144831, 0.491760, 0.042605},
+    {-0.126578, 0.469620, 0.054196},
+    {-0.165063, 0.515340, 0.040770},
+    {-0.154886, 0.491760, 0.022898},
+    {-0.140996, 0.469620, 0.039778},
+    {-0.134314, 0.450000, 0.064742},
+    {-0.123837, 0.450000, 0.071187},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.151542, 0.450000, 0.047514},
+    {-0.150398, 0.469620, 0.021371},
+    {-0.170318, 0.515340, 0.028108},
+    {-0.174720, 0.515340, 0.000000},
+    {-0.158480, 0.491760, 0.000000},
+    {-0.215134, 0.562500, 0.021403},
+    {-0.230160, 0.583920, 0.000000},
+    {-0.230080, 0.602460, 0.000000},
+    {-0.210320, 0.617040, 0.000000},
+    {-0.153760, 0.469620, 0.000000},
+    {-0.162781, 0.450000, 0.025523},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.210320, 0.617040, 0.000000},
+    {-0.204144, 0.617040, -0.039526},
+    {-0.230080, 0.602460, 0.000000},
+    {-0.186851, 0.617040, -0.073494},
+    {-0.222916, 0.602460, -0.045848},
+    {-0.230160, 0.583920, 0.000000},
+    {-0.202855, 0.602460, -0.085249},
+    {-0.222991, 0.583920, -0.045870},
+    {-0.160294, 0.617040, -0.100051},
+    {-0.126326, 0.617040, -0.117344},
+    {-0.172049, 0.602460, -0.116055},
+    {-0.188715, 0.583920, -0.101915},
+    {-0.192093, 0.562500, -0.077339},
+    {-0.210298, 0.562500, -0.041590},
+    {-0.215134, 0.562500, -0.021403},
+    {-0.174720, 0.515340, 0.000000},
+    {-0.170318, 0.515340, -0.028108},
+    {-0.179212, 0.562500, -0.092412},
+    {-0.157996, 0.515340, -0.052283},
+    {-0.165063, 0.515340, -0.040770},
+    {-0.153322, 0.583920, -0.127633},
+    {-0.132648, 0.602460, -0.136116},
+    {-0.132670, 0.583920, -0.136191},
+    {-0.128390, 0.562500, -0.123498},
+    {-0.164139, 0.562500, -0.105293},
+    {-0.139083, 0.515340, -0.071196},
+    {-0.144831, 0.491760, -0.042605},
+    {-0.154886, 0.491760, -0.022898},
+    {-0.158480, 0.491760, 0.000000},
+    {-0.146388, 0.469620, -0.031009},
+    {-0.153760, 0.469620, 0.000000},
+    {-0.129405, 0.491760, -0.058031},
+    {-0.140996, 0.469620, -0.039778},
+    {-0.127570, 0.515340, -0.078263},
+    {-0.109698, 0.491760, -0.068086},
+    {-0.126578, 0.469620, -0.054196},
+    {-0.151542, 0.450000, -0.047514},
+    {-0.157987, 0.450000, -0.037037},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.134314, 0.450000, -0.064742},
+    {-0.108171, 0.469620, -0.063598},
+    {-0.114908, 0.515340, -0.083518},
+    {-0.086800, 0.515340, -0.087920},
+    {-0.086800, 0.491760, -0.071680},
+    {-0.108203, 0.562500, -0.128334},
+    {-0.086800, 0.583920, -0.143360},
+    {-0.086800, 0.602460, -0.143280},
+    {-0.086800, 0.617040, -0.123520},
+    {-0.086800, 0.469620, -0.066960},
+    {-0.112323, 0.450000, -0.075981},
+    {-0.086800, 0.450000, -0.080000},
+    {0.019345, 0.433680, -0.035656},
+    {-0.015613, 0.450000, -0.037037},
+    {-0.006800, 0.450000, 0.000000},
+    {0.024960, 0.433680, 0.000000},
+    {0.003645, 0.433680, -0.066376},
+    {0.061818, 0.420240, -0.049923},
+    {0.039836, 0.420240, -0.092937},
+    {-0.030000, 0.450000, -0.056800},
+    {-0.035060, 0.433680, -0.099448},
+    {0.006137, 0.420240, -0.126636},
+    {0.083408, 0.408960, -0.124913},
+    {0.038113, 0.408960, -0.170208},
+    {0.069680, 0.420240, 0.000000},
+    {0.112954, 0.408960, -0.067100},
+    {0.131252, 0.399120, -0.160026},
+    {0.188794, 0.380880, -0.275594},
+    {0.123520, 0.408960, 0.000000},
+    {0.169103, 0.399120, -0.085962},
+    {0.258600, 0.380880, -0.179702},
+    {0.227330, 0.380880, -0.230536},
+    {0.073226, 0.399120, -0.218052},
+    {0.143736, 0.380880, -0.314130},
+    {0.174572, 0.371040, -0.356148},
+    {0.304801, 0.371040, -0.203740},
+    {0.179170, 0.399120, -0.044210},
+    {0.301360, 0.380880, 0.000000},
+    {0.296360, 0.380880, -0.063689},
+    {0.388913, 0.359760, -0.079074},
+    {0.370908, 0.359760, -0.153752},
+    {0.366876, 0.346320, -0.236036},
+    {0.325803, 0.346320, -0.302804},
+    {0.255363, 0.359760, -0.342163},
+    {0.053603, 0.371040, -0.417970},
+    {0.136310, 0.359760, -0.428832},
+    {0.334026, 0.330000, -0.308838},
+    {0.149236, 0.346320, -0.453676},
+    {0.397426, 0.346320, -0.162659},
+    {0.407075, 0.330000, -0.165901},
+    {0.395120, 0.359760, 0.000000},
+    {0.433200, 0.330000, 0.000000},
+    {0.426502, 0.330000, -0.085322},
+    {0.222038, 0.330000, -0.420826},
+    {-0.003146, 0.346320, -0.503273},
+    {0.079101, 0.330000, -0.493875},
+    {-0.007726, 0.359760, -0.475713},
+    {-0.086800, 0.330000, -0.520000},
+    {-0.001478, 0.330000, -0.513302},
+    {-0.086800, 0.371040, -0.440080},
+    {-0.086800, 0.399120, -0.269440},
+    {-0.023111, 0.380880, -0.383160},
+    {0.037038, 0.380880, -0.368659},
+    {-0.086800, 0.408960, -0.210320},
+    {-0.019700, 0.408960, -0.199754},
+    {-0.000838, 0.399120, -0.255903},
+    {0.092902, 0.380880, -0.345400},
+    {-0.036877, 0.420240, -0.148618},
+    {-0.086800, 0.420240, -0.156480},
+    {-0.051144, 0.433680, -0.106145},
+    {-0.086800, 0.433680, -0.111760},
+    {-0.049763, 0.450000, -0.071187},
+    {-0.086800, 0.450000, -0.080000},
+    {-0.086800, 0.450000, -0.080000},
+    {-0.122456, 0.433680, -0.106145},
+    {-0.136723, 0.420240, -0.148618},
+    {-0.086800, 0.420240, -0.156480},
+    {-0.123837, 0.450000, -0.071187},
+    {-0.153176, 0.433680, -0.090445},
+    {-0.179737, 0.420240, -0.126636},
+    {-0.153900, 0.408960, -0.199754},
+    {-0.211713, 0.408960, -0.170208},
+    {-0.086800, 0.408960, -0.210320},
+    {-0.172762, 0.399120, -0.255903},
+    {-0.246826, 0.399120, -0.218052},
+    {-0.266502, 0.380880, -0.345400},
+    {-0.317336, 0.380880, -0.314130},
+    {-0.257008, 0.408960, -0.124913},
+    {-0.362394, 0.380880, -0.275594},
+    {-0.213436, 0.420240, -0.092937},
+    {-0.286554, 0.408960, -0.067100},
+    {-0.304852, 0.399120, -0.160026},
+    {-0.342703, 0.399120, -0.085962},
+    {-0.432200, 0.380880, -0.179702},
+    {-0.455459, 0.380880, -0.123838},
+    {-0.400930, 0.380880, -0.230536},
+    {-0.442948, 0.371040, -0.261372},
+    {-0.290540, 0.371040, -0.391601},
+    {-0.131010, 0.399120, -0.265970},
+    {-0.150489, 0.380880, -0.383160},
+    {-0.165874, 0.359760, -0.475713},
+    {-0.240552, 0.359760, -0.457708},
+    {-0.322836, 0.346320, -0.453676},
+    {-0.389604, 0.346320, -0.412603},
+    {-0.428963, 0.359760, -0.342163},
+    {-0.504770, 0.371040, -0.140403},
+    {-0.515632, 0.359760, -0.223110},
+    {-0.526880, 0.371040, 0.000000},
+    {-0.562513, 0.359760, -0.079074},
+    {-0.540476, 0.346320, -0.236036},
+    {-0.590073, 0.346320, -0.083654},
+    {-0.395638, 0.330000, -0.420826},
+    {-0.249459, 0.346320, -0.484226},
+    {-0.252701, 0.330000, -0.493875},
+    {-0.086800, 0.359760, -0.481920},
+    {-0.086800, 0.330000, -0.520000},
+    {-0.172122, 0.330000, -0.513302},
+    {-0.086800, 0.380880, -0.388160},
+    {-0.507626, 0.330000, -0.308838},
+    {-0.580675, 0.330000, -0.165901},
+    {-0.600102, 0.330000, -0.085322},
+    {-0.606800, 0.330000, 0.000000},
+    {-0.356240, 0.399120, 0.000000},
+    {-0.469960, 0.380880, -0.063689},
+    {-0.297120, 0.408960, 0.000000},
+    {-0.235418, 0.420240, -0.049923},
+    {-0.243280, 0.420240, 0.000000},
+    {-0.186248, 0.433680, -0.051740},
+    {-0.192945, 0.433680, -0.035656},
+    {-0.157987, 0.450000, -0.037037},
+    {-0.143600, 0.450000, -0.056800},
+    {-0.198560, 0.433680, 0.000000},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.192945, 0.433680, 0.035656},
+    {-0.235418, 0.420240, 0.049923},
+    {-0.243280, 0.420240, 0.000000},
+    {-0.157987, 0.450000, 0.037037},
+    {-0.177245, 0.433680, 0.066376},
+    {-0.213436, 0.420240, 0.092937},
+    {-0.286554, 0.408960, 0.067100},
+    {-0.257008, 0.408960, 0.124913},
+    {-0.297120, 0.408960, 0.000000},
+    {-0.342703, 0.399120, 0.085962},
+    {-0.304852, 0.399120, 0.160026},
+    {-0.432200, 0.380880, 0.179702},
+    {-0.400930, 0.380880, 0.230536},
+    {-0.211713, 0.408960, 0.170208},
+    {-0.362394, 0.380880, 0.275594},
+    {-0.179737, 0.420240, 0.126636},
+    {-0.153900, 0.408960, 0.199754},
+    {-0.246826, 0.399120, 0.218052},
+    {-0.172762, 0.399120, 0.255903},
+    {-0.266502, 0.380880, 0.345400},
+    {-0.210638, 0.380880, 0.368659},
+    {-0.317336, 0.380880, 0.314130},
+    {-0.348172, 0.371040, 0.356148},
+    {-0.478401, 0.371040, 0.203740},
+    {-0.352770, 0.399120, 0.044210},
+    {-0.469960, 0.380880, 0.063689},
+    {-0.562513, 0.359760, 0.079074},
+    {-0.544508, 0.359760, 0.153752},
+    {-0.540476, 0.346320, 0.236036},
+    {-0.499403, 0.346320, 0.302804},
+    {-0.428963, 0.359760, 0.342163},
+    {-0.227203, 0.371040, 0.417970},
+    {-0.309910, 0.359760, 0.428832},
+    {-0.086800, 0.371040, 0.440080},
+    {-0.165874, 0.359760, 0.475713},
+    {-0.322836, 0.346320, 0.453676},
+    {-0.170454, 0.346320, 0.503273},
+    {-0.507626, 0.330000, 0.308838},
+    {-0.571026, 0.346320, 0.162659},
+    {-0.580675, 0.330000, 0.165901},
+    {-0.568720, 0.359760, 0.000000},
+    {-0.606800, 0.330000, 0.000000},
+    {-0.600102, 0.330000, 0.085322},
+    {-0.474960, 0.380880, 0.000000},
+    {-0.395638, 0.330000, 0.420826},
+    {-0.252701, 0.330000, 0.493875},
+    {-0.172122, 0.330000, 0.513302},
+    {-0.086800, 0.330000, 0.520000},
+    {-0.086800, 0.399120, 0.269440},
+    {-0.150489, 0.380880, 0.383160},
+    {-0.086800, 0.408960, 0.210320},
+    {-0.136723, 0.420240, 0.148618},
+    {-0.086800, 0.420240, 0.156480},
+    {-0.138540, 0.433680, 0.099448},
+    {-0.122456, 0.433680, 0.106145},
+    {-0.123837, 0.450000, 0.071187},
+    {-0.143600, 0.450000, 0.056800},
+    {-0.086800, 0.433680, 0.111760},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.051144, 0.433680, 0.106145},
+    {-0.036877, 0.420240, 0.148618},
+    {-0.086800, 0.420240, 0.156480},
+    {-0.049763, 0.450000, 0.071187},
+    {-0.020424, 0.433680, 0.090445},
+    {0.006137, 0.420240, 0.126636},
+    {-0.019700, 0.408960, 0.199754},
+    {0.038113, 0.408960, 0.170208},
+    {-0.086800, 0.408960, 0.210320},
+    {-0.000838, 0.399120, 0.255903},
+    {0.073226, 0.399120, 0.218052},
+    {0.092902, 0.380880, 0.345400},
+    {0.143736, 0.380880, 0.314130},
+    {0.083408, 0.408960, 0.124913},
+    {0.188794, 0.380880, 0.275594},
+    {0.039836, 0.420240, 0.092937},
+    {0.112954, 0.408960, 0.067100},
+    {0.131252, 0.399120, 0.160026},
+    {0.169103, 0.399120, 0.085962},
+    {0.258600, 0.380880, 0.179702},
+    {0.281859, 0.380880, 0.123838},
+    {0.227330, 0.380880, 0.230536},
+    {0.269348, 0.371040, 0.261372},
+    {0.116940, 0.371040, 0.391601},
+    {-0.042590, 0.399120, 0.265970},
+    {-0.023111, 0.380880, 0.383160},
+    {-0.007726, 0.359760, 0.475713},
+    {0.066952, 0.359760, 0.457708},
+    {0.149236, 0.346320, 0.453676},
+    {0.216004, 0.346320, 0.412603},
+    {0.255363, 0.359760, 0.342163},
+    {0.331170, 0.371040, 0.140403},
+    {0.342032, 0.359760, 0.223110},
+    {0.353280, 0.371040, -0.000000},
+    {0.388913, 0.359760, 0.079074},
+    {0.366876, 0.346320, 0.236036},
+    {0.416473, 0.346320, 0.083654},
+    {0.222038, 0.330000, 0.420826},
+    {0.075859, 0.346320, 0.484226},
+    {0.079101, 0.330000, 0.493875},
+    {-0.086800, 0.359760, 0.481920},
+    {-0.086800, 0.330000, 0.520000},
+    {-0.001478, 0.330000, 0.513302},
+    {-0.086800, 0.380880, 0.388160},
+    {0.334026, 0.330000, 0.308838},
+    {0.407075, 0.330000, 0.165901},
+    {0.426502, 0.330000, 0.085322},
+    {0.433200, 0.330000, -0.000000},
+    {0.182640, 0.399120, -0.000000},
+    {0.296360, 0.380880, 0.063689},
+    {0.123520, 0.408960, -0.000000},
+    {0.061818, 0.420240, 0.049923},
+    {0.069680, 0.420240, 0.000000},
+    {0.012648, 0.433680, 0.051740},
+    {0.019345, 0.433680, 0.035656},
+    {-0.015613, 0.450000, 0.037037},
+    {-0.030000, 0.450000, 0.056800},
+    {-0.006800, 0.450000, -0.000000},
+    {0.473200, 0.330000, 0.000000},
+    {0.466090, 0.363075, 0.000000},
+    {0.465987, 0.330000, -0.091885},
+    {0.446253, 0.369375, -0.179061},
+    {0.481120, 0.367800, 0.000000},
+    {0.467221, 0.369375, -0.092090},
+    {0.445066, 0.330000, -0.178662},
+    {0.408022, 0.367800, -0.257443},
+    {0.379030, 0.363075, -0.341866},
+    {0.425401, 0.363075, -0.266484},
+    {0.475581, 0.344175, -0.188913},
+    {0.440101, 0.344175, -0.274132},
+    {0.497703, 0.344175, -0.097157},
+    {0.590949, 0.079920, -0.227667},
+    {0.548190, 0.079920, -0.330368},
+    {0.392399, 0.344175, -0.351678},
+    {0.490702, 0.079920, -0.423821},
+    {0.333612, 0.344175, -0.420412},
+    {0.419856, 0.079920, -0.506656},
+    {0.588055, -0.041520, -0.351109},
+    {0.451664, -0.041520, -0.538464},
+    {0.551560, -0.158640, -0.468484},
+    {0.662371, -0.158640, -0.251659},
+    {0.673008, -0.270000, -0.255232},
+    {0.560624, -0.270000, -0.475136},
+    {0.363629, -0.041520, -0.613758},
+    {0.381684, -0.158640, -0.638360},
+    {0.388336, -0.270000, -0.647424},
+    {0.337021, 0.079920, -0.577502},
+    {0.243568, 0.079920, -0.634990},
+    {0.278383, -0.158640, -0.701906},
+    {0.283568, -0.270000, -0.711872},
+    {0.155160, -0.041520, -0.720298},
+    {0.187332, 0.344175, -0.526901},
+    {0.264878, 0.344175, -0.479199},
+    {0.140867, 0.079920, -0.677749},
+    {0.246538, 0.369375, -0.454208},
+    {0.321883, 0.363075, -0.408683},
+    {0.179684, 0.363075, -0.512201},
+    {0.102113, 0.344175, -0.562381},
+    {0.030288, 0.079920, -0.704409},
+    {0.042626, -0.158640, -0.778640},
+    {0.044464, -0.270000, -0.789696},
+    {0.010357, 0.344175, -0.584503},
+    {-0.086800, 0.330000, -0.600000},
+    {-0.086800, -0.270000, -0.800000},
+    {0.092261, 0.369375, -0.533053},
+    {0.241572, 0.363075, -0.447443},
+    {0.090612, 0.367800, -0.528142},
+    {0.005290, 0.369375, -0.554021},
+    {-0.086800, 0.367800, -0.567920},
+    {0.004442, 0.367800, -0.548918},
+    {0.091862, 0.330000, -0.531866},
+    {0.169166, 0.363075, -0.491984},
+    {0.245795, 0.330000, -0.453197},
+    {0.305752, 0.363075, -0.392552},
+    {0.363224, 0.367800, -0.330267},
+    {-0.086800, 0.330000, -0.560000},
+    {-0.086800, 0.363075, -0.552890},
+    {-0.086800, 0.363075, -0.552890},
+    {-0.178890, 0.369375, -0.554021},
+    {-0.183957, 0.344175, -0.584503},
+    {-0.086800, 0.344175, -0.592130},
+    {-0.086800, 0.330000, -0.560000},
+    {-0.178685, 0.330000, -0.552787},
+    {-0.265861, 0.369375, -0.533053},
+    {-0.275713, 0.344175, -0.562381},
+    {-0.086800, 0.079920, -0.713600},
+    {-0.203888, 0.079920, -0.704409},
+    {-0.314467, 0.079920, -0.677749},
+    {-0.360932, 0.344175, -0.526901},
+    {-0.417168, 0.079920, -0.634990},
+    {-0.211238, -0.041520, -0.748632},
+    {-0.437909, -0.041520, -0.674855},
+    {-0.338459, -0.158640, -0.749171},
+    {-0.086800, -0.041520, -0.758400},
+    {-0.218064, -0.270000, -0.789696},
+    {-0.342032, -0.270000, -0.759808},
+    {-0.510621, 0.079920, -0.577502},
+    {-0.555284, -0.158640, -0.638360},
+    {-0.561936, -0.270000, -0.647424},
+    {-0.438478, 0.344175, -0.479199},
+    {-0.593456, 0.079920, -0.506656},
+    {-0.625264, -0.041520, -0.538464},
+    {-0.734224, -0.270000, -0.475136},
+    {-0.700558, -0.041520, -0.450429},
+    {-0.725160, -0.158640, -0.468484},
+    {-0.507212, 0.344175, -0.420412},
+    {-0.664302, 0.079920, -0.423821},
+    {-0.428666, 0.363075, -0.465830},
+    {-0.353284, 0.363075, -0.512201},
+    {-0.495483, 0.363075, -0.408683},
+    {-0.565999, 0.344175, -0.351678},
+    {-0.721790, 0.079920, -0.330368},
+    {-0.788706, -0.158640, -0.365183},
+    {-0.798672, -0.270000, -0.370368},
+    {-0.807098, -0.041520, -0.241960},
+    {-0.613701, 0.344175, -0.274132},
+    {-0.764549, 0.079920, -0.227667},
+    {-0.541008, 0.369375, -0.333338},
+    {-0.417067, 0.367800, -0.450024},
+    {-0.534243, 0.363075, -0.328372},
+    {-0.619853, 0.369375, -0.179061},
+    {-0.599001, 0.363075, -0.266484},
+    {-0.649181, 0.344175, -0.188913},
+    {-0.791209, 0.079920, -0.117088},
+    {-0.865440, -0.158640, -0.129426},
+    {-0.876496, -0.270000, -0.131264},
+    {-0.671303, 0.344175, -0.097157},
+    {-0.686800, 0.330000, 0.000000},
+    {-0.886800, -0.270000, 0.000000},
+    {-0.614942, 0.367800, -0.177412},
+    {-0.640821, 0.369375, -0.092090},
+    {-0.654720, 0.367800, 0.000000},
+    {-0.635718, 0.367800, -0.091242},
+    {-0.618666, 0.330000, -0.178662},
+    {-0.578784, 0.363075, -0.255966},
+    {-0.639690, 0.363075, -0.000000},
+    {-0.639690, 0.363075, 0.000000},
+    {-0.640821, 0.369375, 0.092090},
+    {-0.671303, 0.344175, 0.097157},
+    {-0.678930, 0.344175, 0.000000},
+    {-0.646800, 0.330000, 0.000000},
+    {-0.639587, 0.330000, 0.091885},
+    {-0.619853, 0.369375, 0.179061},
+    {-0.649181, 0.344175, 0.188913},
+    {-0.800400, 0.079920, 0.000000},
+    {-0.791209, 0.079920, 0.117088},
+    {-0.764549, 0.079920, 0.227667},
+    {-0.613701, 0.344175, 0.274132},
+    {-0.721790, 0.079920, 0.330368},
+    {-0.835432, -0.041520, 0.124438},
+    {-0.761655, -0.041520, 0.351109},
+    {-0.835971, -0.158640, 0.251659},
+    {-0.845200, -0.041520, 0.000000},
+    {-0.876496, -0.270000, 0.131264},
+    {-0.846608, -0.270000, 0.255232},
+    {-0.664302, 0.079920, 0.423821},
+    {-0.725160, -0.158640, 0.468484},
+    {-0.734224, -0.270000, 0.475136},
+    {-0.565999, 0.344175, 0.351678},
+    {-0.593456, 0.079920, 0.506656},
+    {-0.625264, -0.041520, 0.538464},
+    {-0.561936, -0.270000, 0.647424},
+    {-0.537229, -0.041520, 0.613758},
+    {-0.555284, -0.158640, 0.638360},
+    {-0.507212, 0.344175, 0.420412},
+    {-0.510621, 0.079920, 0.577502},
+    {-0.552630, 0.363075, 0.341866},
+    {-0.599001, 0.363075, 0.266484},
+    {-0.495483, 0.363075, 0.408683},
+    {-0.438478, 0.344175, 0.479199},
+    {-0.417168, 0.079920, 0.634990},
+    {-0.451983, -0.158640, 0.701906},
+    {-0.457168, -0.270000, 0.711872},
+    {-0.328760, -0.041520, 0.720298},
+    {-0.360932, 0.344175, 0.526901},
+    {-0.314467, 0.079920, 0.677749},
+    {-0.420138, 0.369375, 0.454208},
+    {-0.536824, 0.367800, 0.330267},
+    {-0.415172, 0.363075, 0.447443},
+    {-0.265861, 0.369375, 0.533053},
+    {-0.353284, 0.363075, 0.512201},
+    {-0.275713, 0.344175, 0.562381},
+    {-0.203888, 0.079920, 0.704409},
+    {-0.216226, -0.158640, 0.778640},
+    {-0.218064, -0.270000, 0.789696},
+    {-0.183957, 0.344175, 0.584503},
+    {-0.086800, 0.330000, 0.600000},
+    {-0.086800, -0.270000, 0.800000},
+    {-0.264212, 0.367800, 0.528142},
+    {-0.178890, 0.369375, 0.554021},
+    {-0.086800, 0.367800, 0.567920},
+    {-0.178042, 0.367800, 0.548918},
+    {-0.265462, 0.330000, 0.531866},
+    {-0.342766, 0.363075, 0.491984},
+    {-0.086800, 0.363075, 0.552890},
+    {-0.086800, 0.363075, 0.552890},
+    {0.005290, 0.369375, 0.554021},
+    {0.010357, 0.344175, 0.584503},
+    {-0.086800, 0.344175, 0.592130},
+    {-0.086800, 0.330000, 0.560000},
+    {0.005085, 0.330000, 0.552787},
+    {0.092261, 0.369375, 0.533053},
+    {0.102113, 0.344175, 0.562381},
+    {-0.086800, 0.079920, 0.713600},
+    {0.030288, 0.079920, 0.704409},
+    {0.140867, 0.079920, 0.677749},
+    {0.187332, 0.344175, 0.526901},
+    {0.243568, 0.079920, 0.634990},
+    {0.037638, -0.041520, 0.748632},
+    {0.264309, -0.041520, 0.674855},
+    {0.164859, -0.158640, 0.749171},
+    {-0.086800, -0.041520, 0.758400},
+    {0.044464, -0.270000, 0.789696},
+    {0.168432, -0.270000, 0.759808},
+    {0.337021, 0.079920, 0.577502},
+    {0.381684, -0.158640, 0.638360},
+    {0.388336, -0.270000, 0.647424},
+    {0.264878, 0.344175, 0.479199},
+    {0.419856, 0.079920, 0.506656},
+    {0.451664, -0.041520, 0.538464},
+    {0.560624, -0.270000, 0.475136},
+    {0.526958, -0.041520, 0.450429},
+    {0.551560, -0.158640, 0.468484},
+    {0.333612, 0.344175, 0.420412},
+    {0.490702, 0.079920, 0.423821},
+    {0.255066, 0.363075, 0.465830},
+    {0.179684, 0.363075, 0.512201},
+    {0.321883, 0.363075, 0.408683},
+    {0.392399, 0.344175, 0.351678},
+    {0.548190, 0.079920, 0.330368},
+    {0.615106, -0.158640, 0.365183},
+    {0.625072, -0.270000, 0.370368},
+    {0.633498, -0.041520, 0.241960},
+    {0.440101, 0.344175, 0.274132},
+    {0.590949, 0.079920, 0.227667},
+    {0.367408, 0.369375, 0.333338},
+    {0.243467, 0.367800, 0.450024},
+    {0.360643, 0.363075, 0.328372},
+    {0.446253, 0.369375, 0.179061},
+    {0.425401, 0.363075, 0.266484},
+    {0.475581, 0.344175, 0.188913},
+    {0.617609, 0.079920, 0.117088},
+    {0.691840, -0.158640, 0.129426},
+    {0.702896, -0.270000, 0.131264},
+    {0.497703, 0.344175, 0.097157},
+    {0.513200, 0.330000, 0.000000},
+    {0.713200, -0.270000, 0.000000},
+    {0.441342, 0.367800, 0.177412},
+    {0.467221, 0.369375, 0.092090},
+    {0.462118, 0.367800, 0.091242},
+    {0.445066, 0.330000, 0.178662},
+    {0.405184, 0.363075, 0.255966},
+    {0.466090, 0.363075, 0.000000},
+    {0.505330, 0.344175, 0.000000},
+    {0.626800, 0.079920, 0.000000},
+    {0.617609, 0.079920, -0.117088},
+    {0.661832, -0.041520, -0.124438},
+    {0.671600, -0.041520, 0.000000},
+    {0.702896, -0.270000, -0.131264},
+    {0.713200, -0.270000, 0.000000},
+    {0.697368, -0.321330, -0.130345},
+    {0.625072, -0.270000, -0.370368},
+    {0.682364, -0.367440, -0.127851},
+    {0.670000, -0.408510, 0.000000},
+    {0.692400, -0.367440, -0.000000},
+    {0.673008, -0.270000, 0.255232},
+    {0.562427, -0.444720, -0.337776},
+    {0.466432, -0.367440, -0.553232},
+    {0.388336, -0.270000, -0.647424},
+    {0.543791, -0.367440, -0.462782},
+    {0.606145, -0.444720, -0.232772},
+    {0.503651, -0.444720, -0.433324},
+    {0.465613, -0.544560, -0.287406},
+    {0.633403, -0.444720, -0.119713},
+    {0.534000, -0.544560, 0.000000},
+    {0.483056, -0.570000, -0.191424},
+    {0.447104, -0.570000, -0.277776},
+    {0.431216, -0.444720, -0.518016},
+    {0.343176, -0.559170, -0.429976},
+    {0.346524, -0.444720, -0.590451},
+    {0.190976, -0.570000, -0.533904},
+    {0.339200, -0.570000, -0.426000},
+    {0.200606, -0.544560, -0.552413},
+    {0.104624, -0.570000, -0.569856},
+    {0.273938, -0.367440, -0.693363},
+    {0.250976, -0.444720, -0.649227},
+    {0.145972, -0.444720, -0.692945},
+    {0.011648, -0.570000, -0.592272},
+    {0.168432, -0.270000, -0.759808},
+    {0.161796, -0.367440, -0.740053},
+    {0.032913, -0.444720, -0.720203},
+    {-0.086800, -0.570000, -0.600000},
+    {0.041051, -0.367440, -0.769164},
+    {-0.086800, -0.444720, -0.729600},
+    {-0.086800, -0.367440, -0.779200},
+    {-0.086800, -0.270000, -0.800000},
+    {-0.217145, -0.321330, -0.784168},
+    {-0.214651, -0.367440, -0.769164},
+    {-0.086800, -0.408510, -0.756800},
+    {-0.457168, -0.270000, -0.711872},
+    {-0.424576, -0.444720, -0.649227},
+    {-0.206513, -0.444720, -0.720203},
+    {-0.319572, -0.444720, -0.692945},
+    {-0.086800, -0.544560, -0.620800},
+    {-0.278224, -0.570000, -0.569856},
+    {-0.374206, -0.544560, -0.552413},
+    {-0.549582, -0.367440, -0.630591},
+    {-0.520124, -0.444720, -0.590451},
+    {-0.640032, -0.367440, -0.553232},
+    {-0.734224, -0.270000, -0.475136},
+    {-0.604816, -0.444720, -0.518016},
+    {-0.516776, -0.559170, -0.429976},
+    {-0.364576, -0.570000, -0.533904},
+    {-0.086800, -0.570000, -0.600000},
+    {-0.512800, -0.570000, -0.426000},
+    {-0.620704, -0.570000, -0.277776},
+    {-0.677251, -0.444720, -0.433324},
+    {-0.780163, -0.367440, -0.360738},
+    {-0.846608, -0.270000, -0.255232},
+    {-0.826853, -0.367440, -0.248596},
+    {-0.736027, -0.444720, -0.337776},
+    {-0.779745, -0.444720, -0.232772},
+    {-0.639213, -0.544560, -0.287406},
+    {-0.656656, -0.570000, -0.191424},
+    {-0.807003, -0.444720, -0.119713},
+    {-0.679072, -0.570000, -0.098448},
+    {-0.855964, -0.367440, -0.127851},
+    {-0.866000, -0.367440, 0.000000},
+    {-0.886800, -0.270000, 0.000000},
+    {-0.816400, -0.444720, -0.000000},
+    {-0.686800, -0.570000, 0.000000},
+    {-0.664930, -0.596190, 0.000000},
+    {-0.671491, -0.587760, 0.097188},
+    {-0.656656, -0.570000, 0.191424},
+    {-0.671491, -0.587760, -0.097188},
+    {-0.679120, -0.587760, 0.000000},
+    {-0.620704, -0.570000, -0.277776},
+    {-0.544240, -0.617520, 0.000000},
+    {-0.574739, -0.611250, 0.163907},
+    {-0.635885, -0.596190, 0.184446},
+    {-0.554669, -0.596190, 0.343363},
+    {-0.566153, -0.587760, 0.351791},
+    {-0.512800, -0.570000, 0.426000},
+    {-0.415214, -0.604080, 0.447500},
+    {-0.395112, -0.622710, 0.226266},
+    {-0.358483, -0.617520, 0.370197},
+    {-0.368080, -0.626640, 0.000000},
+    {-0.314434, -0.626640, 0.167058},
+    {-0.253858, -0.626640, 0.227634},
+    {-0.086800, -0.626640, 0.281280},
+    {-0.086800, -0.617520, 0.457440},
+    {-0.250707, -0.611250, 0.487939},
+    {-0.086800, -0.604080, 0.552960},
+    {-0.438591, -0.587760, 0.479353},
+    {-0.086800, -0.587760, 0.592320},
+    {-0.271246, -0.596190, 0.549085},
+    {-0.364576, -0.570000, 0.533904},
+    {-0.183988, -0.587760, 0.584691},
+    {-0.086800, -0.570000, 0.600000},
+    {-0.086800, -0.444720, 0.729600},
+    {-0.206513, -0.444720, 0.720203},
+    {-0.185248, -0.570000, 0.592272},
+    {-0.086800, -0.596190, 0.578130},
+    {0.010388, -0.587760, 0.584691},
+    {0.104624, -0.570000, 0.569856},
+    {-0.086800, -0.367440, 0.779200},
+    {-0.214651, -0.367440, 0.769164},
+    {-0.335396, -0.367440, 0.740053},
+    {-0.319572, -0.444720, 0.692945},
+    {-0.278224, -0.570000, 0.569856},
+    {-0.447538, -0.367440, 0.693363},
+    {-0.424576, -0.444720, 0.649227},
+    {-0.342032, -0.270000, 0.759808},
+    {-0.086800, -0.270000, 0.800000},
+    {-0.561936, -0.270000, 0.647424},
+    {-0.640032, -0.367440, 0.553232},
+    {-0.520124, -0.444720, 0.590451},
+    {-0.374206, -0.544560, 0.552413},
+    {-0.364576, -0.570000, 0.533904},
+    {-0.604816, -0.444720, 0.518016},
+    {-0.798672, -0.270000, 0.370368},
+    {-0.717391, -0.367440, 0.462782},
+    {-0.677251, -0.444720, 0.433324},
+    {-0.516776, -0.559170, 0.429976},
+    {-0.620704, -0.570000, 0.277776},
+    {-0.736027, -0.444720, 0.337776},
+    {-0.639213, -0.544560, 0.287406},
+    {-0.870968, -0.321330, 0.130345},
+    {-0.855964, -0.367440, 0.127851},
+    {-0.779745, -0.444720, 0.232772},
+    {-0.656656, -0.570000, 0.191424},
+    {-0.807003, -0.444720, 0.119713},
+    {-0.843600, -0.408510, 0.000000},
+    {-1.035480, -0.169560, 0.000000},
+    {-0.940816, -0.263837, -0.075600},
+    {-0.882640, -0.282480, -0.057600},
+    {-1.036562, -0.172115, -0.032400},
+    {-1.101800, -0.090000, 0.000000},
+    {-1.071760, -0.130320, 0.000000},
+    {-1.077950, -0.139081, 0.057600},
+    {-0.992720, -0.206640, 0.000000},
+    {-1.039501, -0.179050, -0.057600},
+    {-1.054810, -0.215182, -0.090000},
+    {-0.872720, -0.312240, -0.086400},
+    {-1.077950, -0.139081, -0.057600},
+    {-1.049088, -0.201678, -0.086400},
+    {-1.144120, -0.010440, 0.000000},
+    {-1.145816, -0.064402, -0.075600},
+    {-1.196290, -0.038992, -0.090000},
+    {-1.118424, -0.196364, -0.075600},
+    {-0.935970, -0.310552, -0.086400},
+    {-0.860880, -0.347760, -0.086400},
+    {-1.176655, 0.057982, -0.057600},
+    {-1.147042, -0.012039, -0.032400},
+    {-1.189896, 0.055293, -0.075600},
+    {-1.203844, 0.122975, -0.086400},
+    {-1.211732, -0.047444, -0.086400},
+    {-1.198344, -0.103118, -0.075600},
+    {-1.174391, 0.116926, -0.057600},
+    {-1.164360, 0.060480, 0.000000},
+    {-1.162040, 0.114390, 0.000000},
+    {-1.170160, 0.090000, 0.032400},
+    {-1.156880, 0.026640, 0.000000},
+    {-1.148034, 0.161902, -0.075600},
+    {-1.124680, 0.149130, 0.000000},
+    {-1.205360, 0.155880, -0.090000},
+    {-1.260880, 0.090000, -0.075600},
+    {-1.258092, -0.011637, -0.057600},
+    {-1.081720, 0.196470, -0.086400},
+    {-1.113780, 0.175801, -0.075600},
+    {-1.156220, 0.206283, -0.086400},
+    {-1.222362, 0.162380, -0.086400},
+    {-1.255148, 0.133512, -0.075600},
+    {-1.274320, 0.090000, -0.057600},
+    {-1.282580, 0.036465, 0.000000},
+    {-1.208702, -0.110751, -0.057600},
+    {-1.248460, -0.067545, 0.000000},
+    {-1.277475, 0.138097, -0.032400},
+    {-1.286800, 0.090000, 0.000000},
+    {-1.221556, 0.202110, -0.057600},
+    {-1.262800, 0.177840, 0.000000},
+    {-1.280800, 0.138780, 0.000000},
+    {-1.274320, 0.090000, 0.057600},
+    {-1.266677, -0.014884, 0.032400},
+    {-1.248460, -0.067545, 0.000000},
+    {-1.230078, -0.001042, 0.086400},
+    {-1.225922, -0.055210, 0.075600},
+    {-1.250852, 0.173272, 0.057600},
+    {-1.237986, 0.168353, 0.075600},
+    {-1.226800, 0.090000, 0.090000},
+    {-1.232800, 0.208260, 0.000000},
+    {-1.221556, 0.202110, 0.057600},
+    {-1.222362, 0.162380, 0.086400},
+    {-1.205360, 0.155880, 0.090000},
+    {-1.187692, 0.119658, 0.075600},
+    {-1.192720, 0.090000, 0.075600},
+    {-1.152020, -0.139815, 0.086400},
+    {-1.166658, -0.022775, 0.075600},
+    {-1.129080, -0.117060, 0.086400},
+    {-1.162560, -0.150270, 0.075600},
+    {-1.101520, -0.172440, 0.090000},
+    {-1.002466, -0.270714, 0.086400},
+    {-1.000240, -0.256080, 0.090000},
+    {-1.165365, 0.115073, 0.032400},
+    {-1.172734, 0.143407, 0.075600},
+    {-1.113780, 0.175801, 0.075600},
+    {-1.147920, 0.133920, 0.000000},
+    {-1.036720, 0.216360, 0.090000},
+    {-1.026632, 0.203892, 0.086400},
+    {-1.004548, 0.176599, 0.032400},
+    {-0.700880, 0.238320, 0.086400},
+    {-1.046808, 0.228828, 0.086400},
+    {-1.106880, 0.219780, 0.086400},
+    {-0.695440, 0.250560, 0.075600},
+    {-1.056078, 0.240284, 0.075600},
+    {-0.712720, 0.211680, 0.086400},
+    {-0.882443, 0.188565, 0.057600},
+    {-1.002640, 0.174240, 0.000000},
+    {-1.051800, 0.168750, 0.000000},
+    {-1.127707, 0.150786, -0.032400},
+    {-0.807160, 0.179910, 0.000000},
+    {-1.060640, 0.176940, -0.057600},
+    {-0.880080, 0.179280, 0.000000},
+    {-0.722640, 0.189360, 0.057600},
+    {-0.726800, 0.180000, 0.000000},
+    {-0.882443, 0.188565, -0.057600},
+    {-0.718160, 0.199440, -0.075600},
+    {-0.712720, 0.211680, -0.086400},
+    {-1.046808, 0.228828, -0.086400},
+    {-0.700880, 0.238320, -0.086400},
+    {-1.056078, 0.240284, -0.075600},
+    {-1.127960, 0.239310, -0.057600},
+    {-1.070800, 0.258480, 0.000000},
+    {-1.136800, 0.247500, 0.000000},
+    {-1.190800, 0.231120, 0.000000},
+    {-0.695440, 0.250560, -0.075600},
+    {-0.690960, 0.260640, -0.057600},
+    {-0.902800, 0.268560, 0.000000},
+    {-0.992800, 0.265140, 0.000000},
+    {-0.686800, 0.270000, 0.000000},
+    {-0.800800, 0.269820, 0.000000},
+    {-0.900437, 0.259275, 0.057600},
+    {-1.180583, 0.223782, 0.057600},
+    {-1.043830, -0.189269, 0.075600},
+    {-0.942073, -0.251726, 0.057600},
+    {-0.886800, -0.270000, 0.000000},
+    {-0.878160, -0.295920, 0.075600},
+    {-0.855440, -0.364080, 0.075600},
+    {-1.125090, -0.205799, 0.057600},
+    {-1.006196, -0.295236, 0.057600},
+    {-0.846800, -0.390000, 0.000000},
+    {-1.074140, -0.260805, 0.000000},
+    {-0.932020, -0.348615, 0.000000},
+    {-1.208702, -0.110751, 0.057600},
+    {-1.131280, -0.214560, 0.000000},
+    {-1.218320, -0.117840, 0.000000},
+    {-1.125090, -0.205799, -0.057600},
+    {-1.070119, -0.251316, -0.057600},
+    {-0.933187, -0.337369, -0.057600},
+    {-0.846800, -0.390000, 0.000000},
+    {-0.850960, -0.377520, -0.057600},
+    {-0.707600, -0.544560, 0.000000},
+    {-0.686800, -0.570000, 0.000000},
+    {0.043545, -0.321330, 0.784168},
+    {0.041051, -0.367440, 0.769164},
+    {-0.086800, -0.408510, 0.756800},
+    {0.283568, -0.270000, 0.711872},
+    {0.250976, -0.444720, 0.649227},
+    {0.032913, -0.444720, 0.720203},
+    {0.145972, -0.444720, 0.692945},
+    {-0.086800, -0.544560, 0.620800},
+    {0.104624, -0.570000, 0.569856},
+    {0.200606, -0.544560, 0.552413},
+    {0.375982, -0.367440, 0.630591},
+    {0.346524, -0.444720, 0.590451},
+    {0.466432, -0.367440, 0.553232},
+    {0.560624, -0.270000, 0.475136},
+    {0.431216, -0.444720, 0.518016},
+    {0.343176, -0.559170, 0.429976},
+    {0.190976, -0.570000, 0.533904},
+    {-0.086800, -0.570000, 0.600000},
+    {0.339200, -0.570000, 0.426000},
+    {0.447104, -0.570000, 0.277776},
+    {0.503651, -0.444720, 0.433324},
+    {0.606563, -0.367440, 0.360738},
+    {0.653253, -0.367440, 0.248596},
+    {0.562427, -0.444720, 0.337776},
+    {0.606145, -0.444720, 0.232772},
+    {0.465613, -0.544560, 0.287406},
+    {0.483056, -0.570000, 0.191424},
+    {0.633403, -0.444720, 0.119713},
+    {0.505472, -0.570000, 0.098448},
+    {0.682364, -0.367440, 0.127851},
+    {0.642800, -0.444720, 0.000000},
+    {0.513200, -0.570000, 0.000000},
+    {0.497891, -0.587760, 0.097188},
+    {0.505520, -0.587760, 0.000000},
+    {0.447104, -0.570000, 0.277776},
+    {0.491330, -0.596190, 0.000000},
+    {0.497891, -0.587760, -0.097188},
+    {0.483056, -0.570000, -0.191424},
+    {0.462285, -0.596190, 0.184446},
+    {0.466160, -0.604080, 0.000000},
+    {0.392553, -0.587760, 0.351791},
+    {0.360700, -0.604080, 0.328414},
+    {0.256563, -0.596190, 0.467869},
+    {0.370640, -0.617520, 0.000000},
+    {0.401139, -0.611250, 0.163907},
+    {0.283397, -0.617520, 0.271683},
+    {0.077107, -0.611250, 0.487939},
+    {0.097646, -0.596190, 0.549085},
+    {0.264991, -0.587760, 0.479353},
+    {0.139466, -0.622710, 0.308312},
+    {-0.086800, -0.617520, 0.457440},
+    {0.140834, -0.626640, 0.167058},
+    {0.080258, -0.626640, 0.227634},
+    {-0.086800, -0.629130, 0.155310},
+    {0.194480, -0.626640, 0.000000},
+    {-0.086800, -0.630000, 0.000000},
+    {0.068510, -0.629130, 0.000000},
+    {0.140834, -0.626640, -0.167058},
+    {0.370640, -0.617520, 0.000000},
+    {-0.242110, -0.629130, -0.000000},
+    {-0.314434, -0.626640, -0.167058},
+    {-0.253858, -0.626640, -0.227634},
+    {-0.086800, -0.629130, -0.155310},
+    {-0.086800, -0.626640, -0.281280},
+    {0.080258, -0.626640, -0.227634},
+    {0.221512, -0.622710, -0.226266},
+    {0.401139, -0.611250, -0.163907},
+    {0.184883, -0.617520, -0.370197},
+    {-0.086800, -0.617520, -0.457440},
+    {-0.086800, -0.617520, -0.457440},
+    {-0.313066, -0.622710, -0.308312},
+    {-0.250707, -0.611250, -0.487939},
+    {-0.086800, -0.596190, -0.578130},
+    {-0.456997, -0.617520, -0.271683},
+    {-0.534300, -0.604080, -0.328414},
+    {-0.271246, -0.596190, -0.549085},
+    {-0.183988, -0.587760, -0.584691},
+    {-0.278224, -0.570000, -0.569856},
+    {-0.430163, -0.596190, -0.467869},
+    {-0.574739, -0.611250, -0.163907},
+    {-0.639760, -0.604080, 0.000000},
+    {-0.566153, -0.587760, -0.351791},
+    {-0.544240, -0.617520, 0.000000},
+    {-0.635885, -0.596190, -0.184446},
+    {-0.438591, -0.587760, -0.479353},
+    {0.010388, -0.587760, -0.584691},
+    {-0.086800, -0.587760, -0.592320},
+    {0.190976, -0.570000, -0.533904},
+    {0.097646, -0.596190, -0.549085},
+    {-0.086800, -0.604080, -0.552960},
+    {0.264991, -0.587760, -0.479353},
+    {0.241614, -0.604080, -0.447500},
+    {0.381069, -0.596190, -0.343363},
+    {0.077107, -0.611250, -0.487939},
+    {0.462285, -0.596190, -0.184446},
+    {0.392553, -0.587760, -0.351791},
+    {0.513200, -0.570000, 0.000000},
+    {0.473200, 0.330000, 0.000000},
+    {0.366397, 0.330000, 0.332595},
+    {0.305752, 0.363075, 0.392552},
+    {0.245795, 0.330000, 0.453197},
+    {0.091862, 0.330000, 0.531866},
+    {0.170643, 0.367800, 0.494822},
+    {-0.086800, 0.330000, 0.560000},
+    {-0.419395, 0.330000, 0.453197},
+    {-0.479352, 0.363075, 0.392552},
+    {-0.539997, 0.330000, 0.332595},
+    {-0.618666, 0.330000, 0.178662},
+    {-0.581622, 0.367800, 0.257443},
+    {-0.646800, 0.330000, 0.000000},
+    {-0.539997, 0.330000, -0.332595},
+    {-0.479352, 0.363075, -0.392552},
+    {-0.419395, 0.330000, -0.453197},
+    {-0.265462, 0.330000, -0.531866},
+    {-0.344243, 0.367800, -0.494822},
+    {0.366397, 0.330000, -0.332595},
+    {0.698343, -0.117055, -0.163427},
+    {0.593200, -0.176160, -0.190080},
+    {0.593200, -0.094320, -0.126720},
+    {0.830204, -0.046975, -0.144003},
+    {0.798960, -0.162960, -0.185208},
+    {0.726697, -0.287285, -0.163427},
+    {0.593200, -0.390000, 0.000000},
+    {0.811179, -0.202032, -0.177800},
+    {0.932252, -0.101222, -0.129951},
+    {0.883314, -0.021907, -0.148516},
+    {0.900080, -0.049080, -0.154704},
+    {0.593200, -0.060000, 0.000000},
+    {0.759992, -0.038352, -0.066675},
+    {0.818753, -0.021809, -0.109716},
+    {0.880680, 0.075180, -0.087360},
+    {0.958727, 0.235325, -0.073745},
+    {0.952772, 0.169080, -0.097505},
+    {1.012284, 0.139920, -0.085317},
+    {0.944939, -0.121786, -0.099010},
+    {1.027713, 0.132360, -0.065004},
+    {1.048153, 0.214195, -0.073745},
+    {1.142920, 0.275820, 0.000000},
+    {1.101863, 0.278866, -0.065893},
+    {1.077680, 0.330000, -0.072000},
+    {0.941094, 0.239491, -0.056187},
+    {1.018160, 0.330000, -0.048000},
+    {1.148720, 0.330000, -0.072000},
+    {1.208240, 0.330000, -0.048000},
+    {1.233200, 0.330000, 0.000000},
+    {1.082160, 0.206160, 0.000000},
+    {0.953548, -0.135739, -0.055694},
+    {1.042040, 0.125340, 0.000000},
+    {1.042040, 0.125340, 0.000000},
+    {1.077752, 0.207202, 0.031605},
+    {1.142920, 0.275820, 0.000000},
+    {0.910360, -0.223140, 0.000000},
+    {0.737480, -0.352020, 0.000000},
+    {0.831654, -0.267504, -0.118533},
+    {1.048153, 0.214195, 0.073745},
+    {1.076012, 0.280783, 0.075306},
+    {0.956720, -0.140880, 0.000000},
+    {0.944939, -0.121786, 0.099010},
+    {1.012284, 0.139920, 0.085317},
+    {0.993548, 0.149100, 0.097505},
+    {0.980139, 0.230266, 0.084280},
+    {1.208240, 0.330000, 0.048000},
+    {1.144880, 0.346560, 0.071880},
+    {1.182863, 0.347199, 0.069005},
+    {0.883314, -0.021907, 0.148516},
+    {0.900080, -0.049080, 0.154704},
+    {0.958727, 0.235325, 0.073745},
+    {1.077680, 0.330000, 0.072000},
+    {0.916846, -0.076253, 0.148516},
+    {0.888276, -0.174605, 0.144003},
+    {0.811179, -0.202032, 0.177800},
+    {0.726697, -0.287285, 0.163427},
+    {0.831654, -0.267504, 0.118533},
+    {0.593200, -0.225000, 0.198000},
+    {0.840240, -0.294960, 0.000000},
+    {0.593200, -0.355680, 0.126720},
+    {0.593200, -0.390000, 0.000000},
+    {0.593200, -0.273840, 0.190080},
+    {0.775513, -0.087984, 0.155575},
+    {0.593200, -0.094320, 0.126720},
+    {0.830204, -0.046975, 0.144003},
+    {0.692752, -0.083489, 0.124516},
+    {0.766266, -0.058416, 0.118533},
+    {0.808120, 0.001560, 0.000000},
+    {0.593200, -0.060000, 0.000000},
+    {0.855221, 0.023626, 0.099010},
+    {0.868200, 0.090000, 0.000000},
+    {0.929128, 0.242318, 0.031605},
+    {0.924720, 0.243360, 0.000000},
+    {0.972608, 0.288454, 0.050204},
+    {0.993200, 0.330000, 0.000000},
+    {1.106897, 0.345921, 0.069005},
+    {1.045040, 0.330000, 0.063000},
+    {1.095310, 0.354322, 0.050400},
+    {1.163825, 0.356719, 0.060000},
+    {1.232340, 0.359115, 0.050400},
+    {1.187907, 0.354105, 0.049421},
+    {1.095809, 0.350635, 0.043243},
+    {1.062155, 0.352386, 0.041242},
+    {1.055729, 0.349125, 0.018533},
+    {1.018160, 0.330000, 0.048000},
+    {1.043100, 0.351812, 0.023198},
+    {1.047920, 0.351600, 0.000000},
+    {1.037680, 0.330000, 0.016200},
+    {1.033200, 0.330000, 0.000000},
+    {1.067760, 0.330000, 0.037800},
+    {1.049840, 0.330000, 0.028800},
+    {1.136880, 0.330000, 0.043200},
+    {1.176560, 0.330000, 0.028800},
+    {1.259360, 0.360060, 0.038400},
+    {1.262950, 0.356932, 0.000000},
+    {1.193200, 0.330000, 0.000000},
+    {1.260725, 0.358374, 0.041242},
+    {1.279780, 0.358948, 0.023198},
+    {1.286800, 0.359160, 0.000000},
+    {1.233200, 0.330000, 0.000000},
+    {1.275979, 0.354870, -0.024667},
+    {1.270002, 0.359998, -0.020002},
+    {1.276400, 0.360240, 0.000000},
+    {1.208240, 0.330000, -0.048000},
+    {1.256514, 0.354404, -0.043853},
+    {1.260725, 0.358374, -0.041242},
+    {1.227048, 0.358374, -0.046670},
+    {1.232644, 0.357527, -0.054130},
+    {1.148720, 0.330000, -0.072000},
+    {1.192999, 0.352880, -0.065779},
+    {1.163825, 0.356719, -0.060000},
+    {1.124803, 0.351728, -0.049421},
+    {1.202030, 0.349480, -0.040421},
+    {1.188720, 0.330000, -0.016200},
+    {1.077680, 0.330000, -0.072000},
+    {1.082360, 0.350227, -0.057557},
+    {1.071682, 0.352498, -0.035558},
+    {1.018160, 0.330000, -0.048000},
+    {0.999920, 0.330000, -0.027000},
+    {1.036080, 0.351600, 0.000000},
+    {1.055729, 0.349125, -0.018533},
+    {1.027040, 0.348900, 0.000000},
+    {1.047920, 0.351600, 0.000000},
+    {1.016560, 0.344400, 0.000000},
+    {0.999920, 0.330000, 0.027000},
+    {1.037680, 0.330000, -0.016200},
+    {1.067760, 0.330000, -0.037800},
+    {1.113200, 0.330000, -0.045000},
+    {1.158640, 0.330000, -0.037800},
+    {0.757680, -0.030960, 0.000000},
+    {0.846612, 0.037579, -0.055694},
+    {0.993200, 0.330000, 0.000000},
+    {-0.086800, 0.630000, 0.000000},
+    {0.036720, 0.617040, 0.000000},
+    {0.013251, 0.617040, -0.073494},
+    {-0.086800, 0.617040, -0.123520},
+    {-0.160294, 0.617040, -0.100051},
+    {-0.086800, 0.617040, -0.123520},
+    {-0.204144, 0.617040, -0.039526},
+    {-0.210320, 0.617040, 0.000000},
+    {-0.210320, 0.617040, 0.000000},
+    {-0.186851, 0.617040, 0.073494},
+    {-0.086800, 0.617040, 0.123520},
+    {-0.013306, 0.617040, 0.100051},
+    {0.036720, 0.617040, -0.000000},
+    {-0.086800, 0.617040, 0.123520},
+    {-0.172049, 0.602460, -0.116055},
+    {-0.202855, 0.602460, -0.085249},
+    {-0.086800, 0.583920, -0.143360},
+    {-0.132648, 0.602460, -0.136116},
+    {-0.153322, 0.583920, -0.127633},
+    {-0.222991, 0.583920, -0.045870},
+    {-0.164139, 0.562500, -0.105293},
+    {-0.192093, 0.562500, -0.077339},
+    {-0.230160, 0.583920, 0.000000},
+    {-0.174720, 0.515340, 0.000000},
+    {-0.154886, 0.491760, -0.022898},
+    {-0.153760, 0.469620, 0.000000},
+    {-0.128390, 0.562500, -0.123498},
+    {-0.144831, 0.491760, -0.042605},
+    {-0.086800, 0.491760, -0.071680},
+    {-0.114908, 0.515340, -0.083518},
+    {-0.129405, 0.491760, -0.058031},
+    {-0.157987, 0.450000, -0.037037},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.126578, 0.469620, -0.054196},
+    {-0.134314, 0.450000, -0.064742},
+    {-0.086800, 0.469620, -0.066960},
+    {-0.086800, 0.450000, -0.080000},
+    {0.030544, 0.617040, 0.039526},
+    {-0.001551, 0.602460, 0.116055},
+    {0.029255, 0.602460, 0.085249},
+    {0.056560, 0.583920, 0.000000},
+    {0.049391, 0.583920, 0.045870},
+    {-0.040952, 0.602460, 0.136116},
+    {-0.020278, 0.583920, 0.127633},
+    {-0.009461, 0.562500, 0.105293},
+    {0.018493, 0.562500, 0.077339},
+    {-0.086800, 0.583920, 0.143360},
+    {-0.045210, 0.562500, 0.123498},
+    {-0.028769, 0.491760, 0.042605},
+    {-0.018714, 0.491760, 0.022898},
+    {0.001120, 0.515340, -0.000000},
+    {-0.019840, 0.469620, -0.000000},
+    {-0.006800, 0.450000, -0.000000},
+    {-0.058692, 0.515340, 0.083518},
+    {-0.044195, 0.491760, 0.058031},
+    {-0.015613, 0.450000, 0.037037},
+    {-0.086800, 0.491760, 0.071680},
+    {-0.047022, 0.469620, 0.054196},
+    {-0.039286, 0.450000, 0.064742},
+    {-0.086800, 0.469620, 0.066960},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.126326, 0.617040, 0.117344},
+    {-0.172049, 0.602460, 0.116055},
+    {-0.086800, 0.583920, 0.143360},
+    {-0.202855, 0.602460, 0.085249},
+    {-0.132670, 0.583920, 0.136191},
+    {-0.086800, 0.515340, 0.087920},
+    {-0.164139, 0.562500, 0.105293},
+    {-0.222916, 0.602460, 0.045848},
+    {-0.214433, 0.583920, 0.066522},
+    {-0.192093, 0.562500, 0.077339},
+    {-0.230160, 0.583920, 0.000000},
+    {-0.210298, 0.562500, 0.041590},
+    {-0.129405, 0.491760, 0.058031},
+    {-0.109698, 0.491760, 0.068086},
+    {-0.086800, 0.469620, 0.066960},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.170318, 0.515340, 0.028108},
+    {-0.144831, 0.491760, 0.042605},
+    {-0.123837, 0.450000, 0.071187},
+    {-0.158480, 0.491760, 0.000000},
+    {-0.140996, 0.469620, 0.039778},
+    {-0.151542, 0.450000, 0.047514},
+    {-0.153760, 0.469620, 0.000000},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.047274, 0.617040, -0.117344},
+    {-0.001551, 0.602460, -0.116055},
+    {-0.086800, 0.583920, -0.143360},
+    {0.029255, 0.602460, -0.085249},
+    {-0.040930, 0.583920, -0.136191},
+    {-0.086800, 0.515340, -0.087920},
+    {-0.009461, 0.562500, -0.105293},
+    {0.049316, 0.602460, -0.045848},
+    {0.040833, 0.583920, -0.066522},
+    {0.018493, 0.562500, -0.077339},
+    {0.056560, 0.583920, 0.000000},
+    {0.036698, 0.562500, -0.041590},
+    {-0.044195, 0.491760, -0.058031},
+    {-0.063902, 0.491760, -0.068086},
+    {-0.086800, 0.469620, -0.066960},
+    {-0.086800, 0.450000, -0.080000},
+    {-0.003282, 0.515340, -0.028108},
+    {-0.028769, 0.491760, -0.042605},
+    {-0.049763, 0.450000, -0.071187},
+    {-0.015120, 0.491760, 0.000000},
+    {-0.032604, 0.469620, -0.039778},
+    {-0.022058, 0.450000, -0.047514},
+    {-0.019840, 0.469620, 0.000000},
+    {-0.006800, 0.450000, 0.000000},
+    {-0.006800, 0.450000, 0.000000},
+    {0.024960, 0.433680, 0.000000},
+    {-0.015613, 0.450000, -0.037037},
+    {0.061818, 0.420240, -0.049923},
+    {0.123520, 0.408960, 0.000000},
+    {-0.006800, 0.450000, -0.000000},
+    {0.012648, 0.433680, 0.051740},
+    {0.123520, 0.408960, -0.000000},
+    {-0.035060, 0.433680, -0.099448},
+    {-0.086800, 0.450000, -0.080000},
+    {0.006137, 0.420240, -0.126636},
+    {0.112954, 0.408960, -0.067100},
+    {0.083408, 0.408960, -0.124913},
+    {0.304801, 0.371040, -0.203740},
+    {0.301360, 0.380880, 0.000000},
+    {0.227330, 0.380880, -0.230536},
+    {0.038113, 0.408960, -0.170208},
+    {0.143736, 0.380880, -0.314130},
+    {-0.086800, 0.408960, -0.210320},
+    {-0.023111, 0.380880, -0.383160},
+    {-0.086800, 0.433680, -0.111760},
+    {-0.086800, 0.371040, -0.440080},
+    {0.053603, 0.371040, -0.417970},
+    {0.255363, 0.359760, -0.342163},
+    {0.325803, 0.346320, -0.302804},
+    {-0.003146, 0.346320, -0.503273},
+    {0.334026, 0.330000, -0.308838},
+    {0.079101, 0.330000, -0.493875},
+    {-0.086800, 0.330000, -0.520000},
+    {0.407075, 0.330000, -0.165901},
+    {0.388913, 0.359760, -0.079074},
+    {0.397426, 0.346320, -0.162659},
+    {0.433200, 0.330000, 0.000000},
+    {-0.086800, 0.450000, -0.080000},
+    {-0.123837, 0.450000, -0.071187},
+    {-0.136723, 0.420240, -0.148618},
+    {-0.086800, 0.408960, -0.210320},
+    {-0.186248, 0.433680, -0.051740},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.213436, 0.420240, -0.092937},
+    {-0.153900, 0.408960, -0.199754},
+    {-0.211713, 0.408960, -0.170208},
+    {-0.290540, 0.371040, -0.391601},
+    {-0.086800, 0.380880, -0.388160},
+    {-0.317336, 0.380880, -0.314130},
+    {-0.257008, 0.408960, -0.124913},
+    {-0.400930, 0.380880, -0.230536},
+    {-0.297120, 0.408960, 0.000000},
+    {-0.469960, 0.380880, -0.063689},
+    {-0.198560, 0.433680, 0.000000},
+    {-0.526880, 0.371040, 0.000000},
+    {-0.504770, 0.371040, -0.140403},
+    {-0.428963, 0.359760, -0.342163},
+    {-0.389604, 0.346320, -0.412603},
+    {-0.590073, 0.346320, -0.083654},
+    {-0.395638, 0.330000, -0.420826},
+    {-0.580675, 0.330000, -0.165901},
+    {-0.606800, 0.330000, 0.000000},
+    {-0.252701, 0.330000, -0.493875},
+    {-0.165874, 0.359760, -0.475713},
+    {-0.249459, 0.346320, -0.484226},
+    {-0.086800, 0.330000, -0.520000},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.157987, 0.450000, 0.037037},
+    {-0.235418, 0.420240, 0.049923},
+    {-0.297120, 0.408960, 0.000000},
+    {-0.138540, 0.433680, 0.099448},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.179737, 0.420240, 0.126636},
+    {-0.286554, 0.408960, 0.067100},
+    {-0.257008, 0.408960, 0.124913},
+    {-0.478401, 0.371040, 0.203740},
+    {-0.474960, 0.380880, 0.000000},
+    {-0.400930, 0.380880, 0.230536},
+    {-0.211713, 0.408960, 0.170208},
+    {-0.317336, 0.380880, 0.314130},
+    {-0.086800, 0.408960, 0.210320},
+    {-0.150489, 0.380880, 0.383160},
+    {-0.086800, 0.433680, 0.111760},
+    {-0.086800, 0.371040, 0.440080},
+    {-0.227203, 0.371040, 0.417970},
+    {-0.428963, 0.359760, 0.342163},
+    {-0.499403, 0.346320, 0.302804},
+    {-0.170454, 0.346320, 0.503273},
+    {-0.507626, 0.330000, 0.308838},
+    {-0.252701, 0.330000, 0.493875},
+    {-0.086800, 0.330000, 0.520000},
+    {-0.580675, 0.330000, 0.165901},
+    {-0.562513, 0.359760, 0.079074},
+    {-0.571026, 0.346320, 0.162659},
+    {-0.606800, 0.330000, 0.000000},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.049763, 0.450000, 0.071187},
+    {-0.036877, 0.420240, 0.148618},
+    {-0.086800, 0.408960, 0.210320},
+    {0.039836, 0.420240, 0.092937},
+    {-0.019700, 0.408960, 0.199754},
+    {0.038113, 0.408960, 0.170208},
+    {0.116940, 0.371040, 0.391601},
+    {-0.086800, 0.380880, 0.388160},
+    {0.143736, 0.380880, 0.314130},
+    {0.083408, 0.408960, 0.124913},
+    {0.227330, 0.380880, 0.230536},
+    {0.296360, 0.380880, 0.063689},
+    {0.331170, 0.371040, 0.140403},
+    {0.255363, 0.359760, 0.342163},
+    {-0.007726, 0.359760, 0.475713},
+    {0.216004, 0.346320, 0.412603},
+    {-0.086800, 0.330000, 0.520000},
+    {0.075859, 0.346320, 0.484226},
+    {0.222038, 0.330000, 0.420826},
+    {0.079101, 0.330000, 0.493875},
+    {0.416473, 0.346320, 0.083654},
+    {0.407075, 0.330000, 0.165901},
+    {0.353280, 0.371040, -0.000000},
+    {0.433200, 0.330000, -0.000000},
+    {0.245795, 0.330000, -0.453197},
+    {0.366397, 0.330000, -0.332595},
+    {0.241572, 0.363075, -0.447443},
+    {0.092261, 0.369375, -0.533053},
+    {0.091862, 0.330000, -0.531866},
+    {0.363224, 0.367800, -0.330267},
+    {0.445066, 0.330000, -0.178662},
+    {0.264878, 0.344175, -0.479199},
+    {-0.086800, 0.367800, -0.567920},
+    {0.187332, 0.344175, -0.526901},
+    {-0.086800, 0.330000, -0.600000},
+    {-0.086800, 0.330000, -0.560000},
+    {-0.086800, 0.330000, -0.560000},
+    {-0.183957, 0.344175, -0.584503},
+    {-0.086800, 0.344175, -0.592130},
+    {-0.265462, 0.330000, -0.531866},
+    {-0.265861, 0.369375, -0.533053},
+    {-0.360932, 0.344175, -0.526901},
+    {-0.211238, -0.041520, -0.748632},
+    {-0.314467, 0.079920, -0.677749},
+    {-0.086800, -0.041520, -0.758400},
+    {-0.342032, -0.270000, -0.759808},
+    {-0.437909, -0.041520, -0.674855},
+    {-0.438478, 0.344175, -0.479199},
+    {-0.510621, 0.079920, -0.577502},
+    {-0.417067, 0.367800, -0.450024},
+    {-0.419395, 0.330000, -0.453197},
+    {-0.534243, 0.363075, -0.328372},
+    {-0.565999, 0.344175, -0.351678},
+    {-0.507212, 0.344175, -0.420412},
+    {-0.625264, -0.041520, -0.538464},
+    {-0.561936, -0.270000, -0.647424},
+    {-0.725160, -0.158640, -0.468484},
+    {-0.798672, -0.270000, -0.370368},
+    {-0.664302, 0.079920, -0.423821},
+    {-0.619853, 0.369375, -0.179061},
+    {-0.613701, 0.344175, -0.274132},
+    {-0.721790, 0.079920, -0.330368},
+    {-0.539997, 0.330000, -0.332595},
+    {-0.618666, 0.330000, -0.178662},
+    {-0.654720, 0.367800, 0.000000},
+    {-0.686800, 0.330000, 0.000000},
+    {-0.807098, -0.041520, -0.241960},
+    {-0.886800, -0.270000, 0.000000},
+    {-0.791209, 0.079920, -0.117088},
+    {-0.646800, 0.330000, 0.000000},
+    {-0.646800, 0.330000, 0.000000},
+    {-0.671303, 0.344175, 0.097157},
+    {-0.678930, 0.344175, 0.000000},
+    {-0.618666, 0.330000, 0.178662},
+    {-0.619853, 0.369375, 0.179061},
+    {-0.613701, 0.344175, 0.274132},
+    {-0.835432, -0.041520, 0.124438},
+    {-0.764549, 0.079920, 0.227667},
+    {-0.845200, -0.041520, 0.000000},
+    {-0.846608, -0.270000, 0.255232},
+    {-0.761655, -0.041520, 0.351109},
+    {-0.565999, 0.344175, 0.351678},
+    {-0.664302, 0.079920, 0.423821},
+    {-0.536824, 0.367800, 0.330267},
+    {-0.539997, 0.330000, 0.332595},
+    {-0.415172, 0.363075, 0.447443},
+    {-0.438478, 0.344175, 0.479199},
+    {-0.507212, 0.344175, 0.420412},
+    {-0.625264, -0.041520, 0.538464},
+    {-0.734224, -0.270000, 0.475136},
+    {-0.555284, -0.158640, 0.638360},
+    {-0.457168, -0.270000, 0.711872},
+    {-0.510621, 0.079920, 0.577502},
+    {-0.265861, 0.369375, 0.533053},
+    {-0.360932, 0.344175, 0.526901},
+    {-0.417168, 0.079920, 0.634990},
+    {-0.419395, 0.330000, 0.453197},
+    {-0.265462, 0.330000, 0.531866},
+    {-0.086800, 0.367800, 0.567920},
+    {-0.086800, 0.330000, 0.600000},
+    {-0.328760, -0.041520, 0.720298},
+    {-0.086800, -0.270000, 0.800000},
+    {-0.203888, 0.079920, 0.704409},
+    {-0.086800, 0.330000, 0.560000},
+    {-0.086800, 0.330000, 0.560000},
+    {0.010357, 0.344175, 0.584503},
+    {-0.086800, 0.344175, 0.592130},
+    {0.091862, 0.330000, 0.531866},
+    {0.092261, 0.369375, 0.533053},
+    {0.187332, 0.344175, 0.526901},
+    {0.037638, -0.041520, 0.748632},
+    {0.140867, 0.079920, 0.677749},
+    {-0.086800, -0.041520, 0.758400},
+    {0.168432, -0.270000, 0.759808},
+    {0.264309, -0.041520, 0.674855},
+    {0.264878, 0.344175, 0.479199},
+    {0.337021, 0.079920, 0.577502},
+    {0.243467, 0.367800, 0.450024},
+    {0.245795, 0.330000, 0.453197},
+    {0.360643, 0.363075, 0.328372},
+    {0.392399, 0.344175, 0.351678},
+    {0.333612, 0.344175, 0.420412},
+    {0.451664, -0.041520, 0.538464},
+    {0.388336, -0.270000, 0.647424},
+    {0.551560, -0.158640, 0.468484},
+    {0.625072, -0.270000, 0.370368},
+    {0.490702, 0.079920, 0.423821},
+    {0.446253, 0.369375, 0.179061},
+    {0.440101, 0.344175, 0.274132},
+    {0.548190, 0.079920, 0.330368},
+    {0.366397, 0.330000, 0.332595},
+    {0.445066, 0.330000, 0.178662},
+    {0.481120, 0.367800, 0.000000},
+    {0.513200, 0.330000, 0.000000},
+    {0.633498, -0.041520, 0.241960},
+    {0.713200, -0.270000, 0.000000},
+    {0.617609, 0.079920, 0.117088},
+    {0.473200, 0.330000, 0.000000},
+    {0.497703, 0.344175, -0.097157},
+    {0.505330, 0.344175, 0.000000},
+    {0.473200, 0.330000, 0.000000},
+    {0.446253, 0.369375, -0.179061},
+    {0.440101, 0.344175, -0.274132},
+    {0.661832, -0.041520, -0.124438},
+    {0.590949, 0.079920, -0.227667},
+    {0.671600, -0.041520, 0.000000},
+    {0.673008, -0.270000, -0.255232},
+    {0.588055, -0.041520, -0.351109},
+    {0.392399, 0.344175, -0.351678},
+    {0.490702, 0.079920, -0.423821},
+    {0.333612, 0.344175, -0.420412},
+    {0.451664, -0.041520, -0.538464},
+    {0.560624, -0.270000, -0.475136},
+    {0.713200, -0.270000, 0.000000},
+    {0.682364, -0.367440, -0.127851},
+    {0.562427, -0.444720, -0.337776},
+    {0.625072, -0.270000, -0.370368},
+    {0.670000, -0.408510, 0.000000},
+    {0.642800, -0.444720, 0.000000},
+    {0.673008, -0.270000, 0.255232},
+    {0.633403, -0.444720, -0.119713},
+    {0.466432, -0.367440, -0.553232},
+    {0.503651, -0.444720, -0.433324},
+    {0.447104, -0.570000, -0.277776},
+    {0.388336, -0.270000, -0.647424},
+    {0.273938, -0.367440, -0.693363},
+    {0.339200, -0.570000, -0.426000},
+    {0.250976, -0.444720, -0.649227},
+    {0.513200, -0.570000, 0.000000},
+    {0.190976, -0.570000, -0.533904},
+    {0.483056, -0.570000, -0.191424},
+    {0.190976, -0.570000, -0.533904},
+    {0.032913, -0.444720, -0.720203},
+    {0.168432, -0.270000, -0.759808},
+    {0.041051, -0.367440, -0.769164},
+    {-0.086800, -0.444720, -0.729600},
+    {-0.086800, -0.570000, -0.600000},
+    {-0.086800, -0.270000, -0.800000},
+    {-0.214651, -0.367440, -0.769164},
+    {-0.086800, -0.408510, -0.756800},
+    {-0.424576, -0.444720, -0.649227},
+    {-0.457168, -0.270000, -0.711872},
+    {-0.206513, -0.444720, -0.720203},
+    {-0.086800, -0.570000, -0.600000},
+    {-0.364576, -0.570000, -0.533904},
+    {-0.640032, -0.367440, -0.553232},
+    {-0.520124, -0.444720, -0.590451},
+    {-0.846608, -0.270000, -0.255232},
+    {-0.780163, -0.367440, -0.360738},
+    {-0.512800, -0.570000, -0.426000},
+    {-0.736027, -0.444720, -0.337776},
+    {-0.620704, -0.570000, -0.277776},
+    {-0.438591, -0.587760, -0.479353},
+    {-0.620704, -0.570000, -0.277776},
+    {-0.278224, -0.570000, -0.569856},
+    {-0.807003, -0.444720, -0.119713},
+    {-0.855964, -0.367440, -0.127851},
+    {-0.866000, -0.367440, 0.000000},
+    {-0.886800, -0.270000, 0.000000},
+    {-0.686800, -0.570000, 0.000000},
+    {-0.664930, -0.596190, 0.000000},
+    {-0.656656, -0.570000, 0.191424},
+    {-0.639760, -0.604080, 0.000000},
+    {-0.671491, -0.587760, -0.097188},
+    {-0.544240, -0.617520, 0.000000},
+    {-0.635885, -0.596190, 0.184446},
+    {-0.415214, -0.604080, 0.447500},
+    {-0.364576, -0.570000, 0.533904},
+    {-0.512800, -0.570000, 0.426000},
+    {-0.395112, -0.622710, 0.226266},
+    {-0.368080, -0.626640, 0.000000},
+    {-0.242110, -0.629130, -0.000000},
+    {-0.086800, -0.626640, 0.281280},
+    {-0.086800, -0.617520, 0.457440},
+    {-0.086800, -0.604080, 0.552960},
+    {-0.183988, -0.587760, 0.584691},
+    {-0.086800, -0.570000, 0.600000},
+    {-0.206513, -0.444720, 0.720203},
+    {-0.364576, -0.570000, 0.533904},
+    {-0.086800, -0.444720, 0.729600},
+    {-0.086800, -0.596190, 0.578130},
+    {0.104624, -0.570000, 0.569856},
+    {-0.214651, -0.367440, 0.769164},
+    {-0.447538, -0.367440, 0.693363},
+    {-0.424576, -0.444720, 0.649227},
+    {-0.640032, -0.367440, 0.553232},
+    {-0.342032, -0.270000, 0.759808},
+    {-0.561936, -0.270000, 0.647424},
+    {-0.086800, -0.270000, 0.800000},
+    {0.041051, -0.367440, 0.769164},
+    {-0.086800, -0.408510, 0.756800},
+    {0.250976, -0.444720, 0.649227},
+    {0.283568, -0.270000, 0.711872},
+    {0.032913, -0.444720, 0.720203},
+    {-0.086800, -0.570000, 0.600000},
+    {0.190976, -0.570000, 0.533904},
+    {0.466432, -0.367440, 0.553232},
+    {0.346524, -0.444720, 0.590451},
+    {0.560624, -0.270000, 0.475136},
+    {0.606563, -0.367440, 0.360738},
+    {0.339200, -0.570000, 0.426000},
+    {0.562427, -0.444720, 0.337776},
+    {0.447104, -0.570000, 0.277776},
+    {0.447104, -0.570000, 0.277776},
+    {0.633403, -0.444720, 0.119713},
+    {0.682364, -0.367440, 0.127851},
+    {0.513200, -0.570000, 0.000000},
+    {0.466160, -0.604080, 0.000000},
+    {0.497891, -0.587760, 0.097188},
+    {0.491330, -0.596190, 0.000000},
+    {0.360700, -0.604080, 0.328414},
+    {0.097646, -0.596190, 0.549085},
+    {0.139466, -0.622710, 0.308312},
+    {0.370640, -0.617520, 0.000000},
+    {-0.086800, -0.617520, 0.457440},
+    {-0.086800, -0.629130, 0.155310},
+    {0.194480, -0.626640, 0.000000},
+    {-0.086800, -0.630000, 0.000000},
+    {0.068510, -0.629130, 0.000000},
+    {0.221512, -0.622710, -0.226266},
+    {0.370640, -0.617520, 0.000000},
+    {-0.086800, -0.626640, -0.281280},
+    {-0.086800, -0.629130, -0.155310},
+    {-0.456997, -0.617520, -0.271683},
+    {-0.086800, -0.617520, -0.457440},
+    {-0.250707, -0.611250, -0.487939},
+    {-0.086800, -0.617520, -0.457440},
+    {0.241614, -0.604080, -0.447500},
+    {-0.086800, -0.604080, -0.552960},
+    {0.462285, -0.596190, -0.184446},
+    {0.010388, -0.587760, -0.584691},
+    {-0.086800, -0.596190, -0.578130},
+    {-0.798672, -0.270000, 0.370368},
+    {-0.736027, -0.444720, 0.337776},
+    {-0.677251, -0.444720, 0.433324},
+    {-0.855964, -0.367440, 0.127851},
+    {-0.807003, -0.444720, 0.119713},
+    {-0.620704, -0.570000, 0.277776},
+    {-0.686800, -0.570000, 0.000000},
+    {-0.843600, -0.408510, 0.000000},
+    {-0.992720, -0.206640, 0.000000},
+    {-0.872720, -0.312240, -0.086400},
+    {-1.039501, -0.179050, -0.057600},
+    {-1.101800, -0.090000, 0.000000},
+    {-1.071760, -0.130320, 0.000000},
+    {-1.077950, -0.139081, 0.057600},
+    {-0.942073, -0.251726, 0.057600},
+    {-0.886800, -0.270000, 0.000000},
+    {-0.935970, -0.310552, -0.086400},
+    {-0.850960, -0.377520, -0.057600},
+    {-1.077950, -0.139081, -0.057600},
+    {-1.144120, -0.010440, 0.000000},
+    {-1.129080, -0.117060, 0.086400},
+    {-1.152020, -0.139815, 0.086400},
+    {-0.855440, -0.364080, 0.075600},
+    {-1.226800, 0.090000, 0.090000},
+    {-1.230078, -0.001042, 0.086400},
+    {-1.208702, -0.110751, 0.057600},
+    {-1.125090, -0.205799, 0.057600},
+    {-1.002466, -0.270714, 0.086400},
+    {-0.846800, -0.390000, 0.000000},
+    {-1.074140, -0.260805, 0.000000},
+    {-1.131280, -0.214560, 0.000000},
+    {-1.248460, -0.067545, 0.000000},
+    {-1.218320, -0.117840, 0.000000},
+    {-1.286800, 0.090000, 0.000000},
+    {-1.282580, 0.036465, 0.000000},
+    {-1.262800, 0.177840, 0.000000},
+    {-1.255148, 0.133512, -0.075600},
+    {-1.260880, 0.090000, -0.075600},
+    {-1.280800, 0.138780, 0.000000},
+    {-1.258092, -0.011637, -0.057600},
+    {-1.198344, -0.103118, -0.075600},
+    {-1.118424, -0.196364, -0.075600},
+    {-1.196290, -0.038992, -0.090000},
+    {-1.205360, 0.155880, -0.090000},
+    {-1.046808, 0.228828, -0.086400},
+    {-1.221556, 0.202110, -0.057600},
+    {-1.081720, 0.196470, -0.086400},
+    {-1.148034, 0.161902, -0.075600},
+    {-1.203844, 0.122975, -0.086400},
+    {-0.700880, 0.238320, -0.086400},
+    {-0.718160, 0.199440, -0.075600},
+    {-1.070800, 0.258480, 0.000000},
+    {-1.190800, 0.231120, 0.000000},
+    {-1.232800, 0.208260, 0.000000},
+    {-1.136800, 0.247500, 0.000000},
+    {-0.902800, 0.268560, 0.000000},
+    {-0.992800, 0.265140, 0.000000},
+    {-0.686800, 0.270000, 0.000000},
+    {-0.800800, 0.269820, 0.000000},
+    {-0.700880, 0.238320, 0.086400},
+    {-1.106880, 0.219780, 0.086400},
+    {-1.250852, 0.173272, 0.057600},
+    {-1.222362, 0.162380, 0.086400},
+    {-1.205360, 0.155880, 0.090000},
+    {-1.026632, 0.203892, 0.086400},
+    {-0.712720, 0.211680, 0.086400},
+    {-1.004548, 0.176599, 0.032400},
+    {-1.113780, 0.175801, 0.075600},
+    {-1.192720, 0.090000, 0.075600},
+    {-1.162040, 0.114390, 0.000000},
+    {-1.164360, 0.060480, 0.000000},
+    {-1.156880, 0.026640, 0.000000},
+    {-1.124680, 0.149130, 0.000000},
+    {-1.147920, 0.133920, 0.000000},
+    {-1.189896, 0.055293, -0.075600},
+    {-1.145816, -0.064402, -0.075600},
+    {-1.051800, 0.168750, 0.000000},
+    {-1.002640, 0.174240, 0.000000},
+    {-0.807160, 0.179910, 0.000000},
+    {-0.880080, 0.179280, 0.000000},
+    {-0.726800, 0.180000, 0.000000},
+    {-0.846800, -0.390000, 0.000000},
+    {0.381684, -0.158640, -0.638360},
+    {0.283568, -0.270000, -0.711872},
+    {0.337021, 0.079920, -0.577502},
+    {0.155160, -0.041520, -0.720298},
+    {0.243568, 0.079920, -0.634990},
+    {0.030288, 0.079920, -0.704409},
+    {-0.086800, -0.270000, -0.800000},
+    {0.726697, -0.287285, -0.163427},
+    {0.593200, -0.390000, 0.000000},
+    {0.593200, -0.176160, -0.190080},
+    {0.932252, -0.101222, -0.129951},
+    {0.944939, -0.121786, -0.099010},
+    {0.910360, -0.223140, 0.000000},
+    {0.593200, -0.094320, -0.126720},
+    {0.830204, -0.046975, -0.144003},
+    {0.883314, -0.021907, -0.148516},
+    {1.012284, 0.139920, -0.085317},
+    {1.082160, 0.206160, 0.000000},
+    {0.952772, 0.169080, -0.097505},
+    {1.142920, 0.275820, 0.000000},
+    {1.101863, 0.278866, -0.065893},
+    {0.880680, 0.075180, -0.087360},
+    {0.941094, 0.239491, -0.056187},
+    {0.593200, -0.060000, 0.000000},
+    {0.757680, -0.030960, 0.000000},
+    {0.924720, 0.243360, 0.000000},
+    {0.993200, 0.330000, 0.000000},
+    {1.077680, 0.330000, -0.072000},
+    {1.233200, 0.330000, 0.000000},
+    {0.868200, 0.090000, 0.000000},
+    {0.972608, 0.288454, 0.050204},
+    {0.993200, 0.330000, 0.000000},
+    {0.808120, 0.001560, 0.000000},
+    {0.775513, -0.087984, 0.155575},
+    {0.855221, 0.023626, 0.099010},
+    {0.883314, -0.021907, 0.148516},
+    {0.980139, 0.230266, 0.084280},
+    {1.045040, 0.330000, 0.063000},
+    {1.144880, 0.346560, 0.071880},
+    {1.095310, 0.354322, 0.050400},
+    {1.062155, 0.352386, 0.041242},
+    {0.999920, 0.330000, 0.027000},
+    {1.182863, 0.347199, 0.069005},
+    {1.259360, 0.360060, 0.038400},
+    {1.163825, 0.356719, 0.060000},
+    {1.067760, 0.330000, 0.037800},
+    {1.037680, 0.330000, 0.016200},
+    {1.016560, 0.344400, 0.000000},
+    {1.036080, 0.351600, 0.000000},
+    {1.033200, 0.330000, 0.000000},
+    {1.018160, 0.330000, -0.048000},
+    {1.027040, 0.348900, 0.000000},
+    {1.071682, 0.352498, -0.035558},
+    {1.077680, 0.330000, -0.072000},
+    {1.047920, 0.351600, 0.000000},
+    {1.163825, 0.356719, -0.060000},
+    {1.037680, 0.330000, -0.016200},
+    {1.067760, 0.330000, -0.037800},
+    {1.192999, 0.352880, -0.065779},
+    {1.208240, 0.330000, -0.048000},
+    {1.227048, 0.358374, -0.046670},
+    {1.158640, 0.330000, -0.037800},
+    {1.260725, 0.358374, -0.041242},
+    {1.286800, 0.359160, 0.000000},
+    {1.233200, 0.330000, 0.000000},
+    {1.193200, 0.330000, 0.000000},
+    {1.279780, 0.358948, 0.023198},
+    {1.262950, 0.356932, 0.000000},
+    {1.136880, 0.330000, 0.043200},
+    {0.900080, -0.049080, 0.154704},
+    {1.012284, 0.139920, 0.085317},
+    {1.077752, 0.207202, 0.031605},
+    {0.956720, -0.140880, 0.000000},
+    {0.888276, -0.174605, 0.144003},
+    {0.944939, -0.121786, 0.099010},
+    {0.811179, -0.202032, 0.177800},
+    {0.593200, -0.225000, 0.198000},
+    {0.593200, -0.273840, 0.190080},
+    {0.593200, -0.355680, 0.126720},
+    {0.593200, -0.390000, 0.000000},
+    {0.593200, -0.094320, 0.126720},
+    {0.593200, -0.060000, 0.000000},
+    {-0.086800, 0.630000, 0.000000},
+    {0.036720, 0.617040, 0.000000},
+    {-0.086800, 0.617040, -0.123520},
+    {-0.202855, 0.602460, -0.085249},
+    {-0.086800, 0.617040, -0.123520},
+    {-0.210320, 0.617040, 0.000000},
+    {-0.210320, 0.617040, 0.000000},
+    {-0.086800, 0.617040, 0.123520},
+    {-0.086800, 0.617040, 0.123520},
+    {0.036720, 0.617040, -0.000000},
+    {-0.001551, 0.602460, -0.116055},
+    {0.056560, 0.583920, 0.000000},
+    {-0.086800, 0.583920, -0.143360},
+    {-0.040930, 0.583920, -0.136191},
+    {0.018493, 0.562500, -0.077339},
+    {-0.015120, 0.491760, 0.000000},
+    {-0.028769, 0.491760, -0.042605},
+    {-0.086800, 0.469620, -0.066960},
+    {-0.049763, 0.450000, -0.071187},
+    {-0.006800, 0.450000, 0.000000},
+    {0.029255, 0.602460, 0.085249},
+    {0.056560, 0.583920, 0.000000},
+    {-0.086800, 0.583920, 0.143360},
+    {0.049391, 0.583920, 0.045870},
+    {-0.009461, 0.562500, 0.105293},
+    {-0.019840, 0.469620, -0.000000},
+    {-0.086800, 0.491760, 0.071680},
+    {-0.044195, 0.491760, 0.058031},
+    {-0.015613, 0.450000, 0.037037},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.172049, 0.602460, 0.116055},
+    {-0.086800, 0.583920, 0.143360},
+    {-0.230160, 0.583920, 0.000000},
+    {-0.132670, 0.583920, 0.136191},
+    {-0.192093, 0.562500, 0.077339},
+    {-0.086800, 0.469620, 0.066960},
+    {-0.158480, 0.491760, 0.000000},
+    {-0.144831, 0.491760, 0.042605},
+    {-0.123837, 0.450000, 0.071187},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.230160, 0.583920, 0.000000},
+    {-0.222991, 0.583920, -0.045870},
+    {-0.153760, 0.469620, 0.000000},
+    {-0.086800, 0.583920, -0.143360},
+    {-0.164139, 0.562500, -0.105293},
+    {-0.129405, 0.491760, -0.058031},
+    {-0.157987, 0.450000, -0.037037},
+    {-0.086800, 0.491760, -0.071680},
+    {-0.086800, 0.450000, -0.080000},
+    {-0.006800, 0.450000, 0.000000},
+    {0.024960, 0.433680, 0.000000},
+    {-0.015613, 0.450000, -0.037037},
+    {0.006137, 0.420240, -0.126636},
+    {0.123520, 0.408960, 0.000000},
+    {-0.006800, 0.450000, -0.000000},
+    {-0.049763, 0.450000, 0.071187},
+    {0.039836, 0.420240, 0.092937},
+    {0.123520, 0.408960, -0.000000},
+    {-0.086800, 0.433680, -0.111760},
+    {-0.086800, 0.450000, -0.080000},
+    {-0.086800, 0.408960, -0.210320},
+    {-0.086800, 0.450000, -0.080000},
+    {-0.123837, 0.450000, -0.071187},
+    {-0.213436, 0.420240, -0.092937},
+    {-0.086800, 0.408960, -0.210320},
+    {0.053603, 0.371040, -0.417970},
+    {-0.086800, 0.330000, -0.520000},
+    {0.143736, 0.380880, -0.314130},
+    {0.255363, 0.359760, -0.342163},
+    {0.079101, 0.330000, -0.493875},
+    {0.304801, 0.371040, -0.203740},
+    {0.334026, 0.330000, -0.308838},
+    {0.388913, 0.359760, -0.079074},
+    {0.407075, 0.330000, -0.165901},
+    {0.433200, 0.330000, 0.000000},
+    {-0.198560, 0.433680, 0.000000},
+    {-0.297120, 0.408960, 0.000000},
+    {-0.400930, 0.380880, -0.230536},
+    {-0.504770, 0.371040, -0.140403},
+    {-0.290540, 0.371040, -0.391601},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.166800, 0.450000, 0.000000},
+    {-0.157987, 0.450000, 0.037037},
+    {-0.179737, 0.420240, 0.126636},
+    {-0.297120, 0.408960, 0.000000},
+    {-0.086800, 0.433680, 0.111760},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.086800, 0.408960, 0.210320},
+    {-0.317336, 0.380880, 0.314130},
+    {-0.227203, 0.371040, 0.417970},
+    {-0.478401, 0.371040, 0.203740},
+    {-0.606800, 0.330000, 0.000000},
+    {-0.562513, 0.359760, 0.079074},
+    {-0.428963, 0.359760, 0.342163},
+    {-0.507626, 0.330000, 0.308838},
+    {-0.086800, 0.330000, 0.520000},
+    {-0.252701, 0.330000, 0.493875},
+    {-0.580675, 0.330000, 0.165901},
+    {-0.086800, 0.450000, 0.080000},
+    {-0.086800, 0.408960, 0.210320},
+    {0.227330, 0.380880, 0.230536},
+    {0.331170, 0.371040, 0.140403},
+    {0.116940, 0.371040, 0.391601},
+    {-0.086800, 0.330000, 0.520000},
+    {-0.007726, 0.359760, 0.475713},
+    {0.255363, 0.359760, 0.342163},
+    {0.222038, 0.330000, 0.420826},
+    {0.433200, 0.330000, -0.000000},
+    {0.407075, 0.330000, 0.165901},
+    {0.079101, 0.330000, 0.493875},
+    {-0.428963, 0.359760, -0.342163},
+    {-0.395638, 0.330000, -0.420826},
+    {-0.580675, 0.330000, -0.165901},
+    {-0.165874, 0.359760, -0.475713},
+    {-0.252701, 0.330000, -0.493875},
+    {-0.086800, 0.330000, -0.520000},
+    {-0.606800, 0.330000, 0.000000},
+};
+static const int mesh_indices[] = {
+    0, 1, 2,
+    2, 3, 0,
+    1, 0, 4,
+    5, 0, 3,
+    6, 4, 0,
+    0, 5, 6,
+    4, 7, 1,
+    7, 4, 8,
+    9, 8, 4,
+    4, 6, 9,
+    10, 6, 5,
+    11, 9, 6,
+    6, 10, 11,
+    3, 12, 5,
+    13, 5, 12,
+    5, 13, 10,
+    14, 10, 13,
+    15, 11, 10,
+    10, 14, 15,
+    9, 11, 16,
+    17, 16, 11,
+    11, 15, 17,
+    8, 9, 18,
+    16, 18, 9,
+    18, 16, 19,
+    20, 19, 16,
+    16, 17, 20,
+    21, 17, 15,
+    22, 20, 17,
+    17, 21, 22,
+    23, 15, 14,
+    15, 23, 21,
+    13, 24, 14,
+    25, 14, 24,
+    14, 25, 23,
+    26, 23, 25,
+    27, 21, 23,
+    23, 26, 27,
+    28, 22, 21,
+    21, 27, 28,
+    20, 22, 29,
+    30, 29, 22,
+    22, 28, 30,
+    19, 20, 31,
+    29, 31, 20,
+    31, 29, 32,
+    33, 32, 29,
+    29, 30, 33,
+    34, 30, 28,
+    35, 33, 30,
+    30, 34, 35,
+    36, 28, 27,
+    28, 36, 34,
+    37, 27, 26,
+    27, 37, 36,
+    38, 36, 37,
+    39, 34, 36,
+    36, 38, 39,
+    40, 35, 34,
+    34, 39, 40,
+    33, 35, 41,
+    42, 41, 35,
+    35, 40, 42,
+    32, 33, 43,
+    41, 43, 33,
+    43, 41, 44,
+    45, 44, 41,
+    41, 42, 45,
+    46, 42, 40,
+    47, 45, 42,
+    42, 46, 47,
+    48, 40, 39,
+    40, 48, 46,
+    49, 39, 38,
+    39, 49, 48,
+    50, 48, 49,
+    51, 46, 48,
+    48, 50, 51,
+    52, 47, 46,
+    46, 51, 52,
+    45, 47, 53,
+    54, 53, 47,
+    47, 52, 54,
+    44, 45, 55,
+    53, 55, 45,
+    55, 56, 44,
+    56, 57, 58,
+    58, 44, 56,
+    59, 56, 60,
+    61, 60, 56,
+    56, 62, 61,
+    57, 63, 64,
+    64, 58, 57,
+    58, 64, 65,
+    65, 43, 58,
+    44, 58, 43,
+    64, 66, 67,
+    67, 65, 64,
+    66, 64, 63,
+    63, 68, 66,
+    66, 69, 70,
+    70, 67, 66,
+    69, 66, 68,
+    67, 70, 71,
+    71, 72, 67,
+    65, 67, 72,
+    72, 32, 65,
+    43, 65, 32,
+    72, 71, 73,
+    73, 31, 72,
+    32, 72, 31,
+    71, 74, 75,
+    75, 73, 71,
+    74, 71, 70,
+    70, 76, 74,
+    76, 70, 69,
+    69, 77, 76,
+    77, 69, 78,
+    68, 78, 69,
+    76, 79, 80,
+    80, 74, 76,
+    79, 76, 77,
+    74, 80, 81,
+    81, 75, 74,
+    75, 81, 82,
+    82, 83, 75,
+    73, 75, 83,
+    83, 19, 73,
+    31, 73, 19,
+    83, 82, 84,
+    84, 18, 83,
+    19, 83, 18,
+    82, 85, 86,
+    86, 84, 82,
+    85, 82, 81,
+    81, 87, 85,
+    87, 81, 80,
+    80, 88, 87,
+    88, 80, 79,
+    79, 89, 88,
+    90, 91, 89,
+    89, 79, 90,
+    91, 90, 92,
+    77, 90, 79,
+    93, 92, 90,
+    90, 77, 93,
+    92, 94, 91,
+    78, 93, 77,
+    84, 86, 95,
+    95, 8, 84,
+    18, 84, 8,
+    8, 95, 7,
+    60, 61, 96,
+    97, 61, 62,
+    98, 96, 61,
+    61, 97, 98,
+    60, 99, 59,
+    99, 60, 100,
+    96, 100, 60,
+    100, 96, 101,
+    102, 101, 96,
+    96, 98, 102,
+    103, 98, 97,
+    104, 102, 98,
+    98, 103, 104,
+    62, 105, 97,
+    106, 97, 105,
+    97, 106, 103,
+    107, 103, 106,
+    108, 104, 103,
+    103, 107, 108,
+    102, 104, 109,
+    110, 109, 104,
+    104, 108, 110,
+    101, 102, 111,
+    109, 111, 102,
+    111, 109, 112,
+    113, 112, 109,
+    109, 110, 113,
+    114, 110, 108,
+    115, 113, 110,
+    110, 114, 115,
+    116, 108, 107,
+    108, 116, 114,
+    106, 117, 107,
+    118, 107, 117,
+    107, 118, 116,
+    119, 116, 118,
+    120, 114, 116,
+    116, 119, 120,
+    121, 115, 114,
+    114, 120, 121,
+    113, 115, 122,
+    123, 122, 115,
+    115, 121, 123,
+    112, 113, 124,
+    122, 124, 113,
+    124, 122, 125,
+    126, 125, 122,
+    122, 123, 126,
+    127, 123, 121,
+    128, 126, 123,
+    123, 127, 128,
+    129, 121, 120,
+    121, 129, 127,
+    130, 120, 119,
+    120, 130, 129,
+    131, 129, 130,
+    132, 127, 129,
+    129, 131, 132,
+    133, 128, 127,
+    127, 132, 133,
+    126, 128, 134,
+    135, 134, 128,
+    128, 133, 135,
+    125, 126, 136,
+    134, 136, 126,
+    136, 134, 137,
+    138, 137, 134,
+    134, 135, 138,
+    139, 135, 133,
+    140, 138, 135,
+    135, 139, 140,
+    141, 133, 132,
+    133, 141, 139,
+    142, 132, 131,
+    132, 142, 141,
+    143, 141, 142,
+    144, 139, 141,
+    141, 143, 144,
+    145, 140, 139,
+    139, 144, 145,
+    138, 140, 146,
+    147, 146, 140,
+    140, 145, 147,
+    137, 138, 148,
+    146, 148, 138,
+    148, 149, 137,
+    149, 150, 151,
+    151, 137, 149,
+    150, 152, 153,
+    153, 151, 150,
+    151, 153, 154,
+    154, 136, 151,
+    137, 151, 136,
+    153, 155, 156,
+    156, 154, 153,
+    155, 153, 152,
+    152, 157, 155,
+    155, 158, 159,
+    159, 156, 155,
+    158, 155, 157,
+    156, 159, 160,
+    160, 161, 156,
+    154, 156, 161,
+    161, 125, 154,
+    136, 154, 125,
+    161, 160, 162,
+    162, 124, 161,
+    125, 161, 124,
+    160, 163, 164,
+    164, 162, 160,
+    163, 160, 159,
+    159, 165, 163,
+    165, 159, 158,
+    158, 166, 165,
+    166, 158, 167,
+    157, 167, 158,
+    165, 168, 169,
+    169, 163, 165,
+    168, 165, 166,
+    163, 169, 170,
+    170, 164, 163,
+    164, 170, 171,
+    171, 172, 164,
+    162, 164, 172,
+    172, 112, 162,
+    124, 162, 112,
+    172, 171, 173,
+    173, 111, 172,
+    112, 172, 111,
+    171, 174, 175,
+    175, 173, 171,
+    174, 171, 170,
+    170, 176, 174,
+    176, 170, 169,
+    169, 177, 176,
+    177, 169, 168,
+    176, 178, 179,
+    179, 174, 176,
+    178, 176, 177,
+    174, 179, 180,
+    180, 175, 174,
+    175, 180, 181,
+    181, 182, 175,
+    173, 175, 182,
+    182, 101, 173,
+    111, 173, 101,
+    182, 181, 183,
+    183, 100, 182,
+    101, 182, 100,
+    181, 184, 185,
+    185, 183, 181,
+    184, 181, 180,
+    180, 186, 184,
+    186, 180, 179,
+    179, 187, 186,
+    187, 179, 178,
+    186, 188, 189,
+    189, 184, 186,
+    188, 186, 187,
+    184, 189, 190,
+    190, 185, 184,
+    185, 190, 191,
+    191, 192, 185,
+    183, 185, 192,
+    192, 99, 183,
+    100, 183, 99,
+    192, 191, 193,
+    193, 194, 192,
+    99, 192, 194,
+    191, 195, 196,
+    196, 193, 191,
+    195, 191, 190,
+    190, 197, 195,
+    197, 190, 189,
+    189, 198, 197,
+    198, 189, 188,
+    197, 199, 200,
+    200, 195, 197,
+    199, 197, 198,
+    195, 200, 201,
+    201, 196, 195,
+    200, 202, 203,
+    203, 201, 200,
+    202, 200, 199,
+    199, 204, 202,
+    204, 199, 205,
+    198, 205, 199,
+    205, 198, 206,
+    188, 206, 198,
+    205, 207, 204,
+    207, 205, 208,
+    206, 208, 205,
+    204, 209, 210,
+    210, 202, 204,
+    209, 204, 207,
+    202, 210, 211,
+    211, 203, 202,
+    207, 212, 209,
+    212, 207, 213,
+    208, 213, 207,
+    213, 208, 214,
+    215, 214, 208,
+    208, 206, 215,
+    216, 215, 206,
+    206, 188, 216,
+    187, 216, 188,
+    215, 216, 217,
+    218, 217, 216,
+    216, 187, 218,
+    214, 215, 219,
+    217, 219, 215,
+    214, 220, 213,
+    220, 214, 221,
+    219, 221, 214,
+    213, 222, 212,
+    222, 213, 220,
+    220, 223, 222,
+    223, 220, 224,
+    221, 224, 220,
+    224, 221, 225,
+    226, 225, 221,
+    221, 219, 226,
+    227, 226, 219,
+    219, 217, 227,
+    228, 227, 217,
+    217, 218, 228,
+    226, 227, 229,
+    230, 229, 227,
+    227, 228, 230,
+    225, 226, 231,
+    229, 231, 226,
+    225, 232, 224,
+    232, 225, 233,
+    231, 233, 225,
+    224, 234, 223,
+    234, 224, 232,
+    232, 235, 234,
+    235, 232, 236,
+    233, 236, 232,
+    236, 233, 237,
+    238, 237, 233,
+    233, 231, 238,
+    239, 238, 231,
+    231, 229, 239,
+    240, 239, 229,
+    229, 230, 240,
+    238, 239, 241,
+    242, 241, 239,
+    239, 240, 242,
+    237, 238, 243,
+    241, 243, 238,
+    237, 244, 236,
+    244, 237, 245,
+    243, 245, 237,
+    236, 246, 235,
+    246, 236, 244,
+    244, 247, 246,
+    247, 244, 248,
+    245, 248, 244,
+    248, 249, 247,
+    250, 242, 240,
+    251, 240, 230,
+    240, 251, 250,
+    252, 250, 251,
+    230, 253, 251,
+    254, 251, 253,
+    251, 254, 252,
+    253, 230, 228,
+    228, 255, 253,
+    256, 253, 255,
+    253, 256, 254,
+    257, 254, 256,
+    258, 252, 254,
+    254, 257, 258,
+    259, 252, 260,
+    261, 260, 252,
+    252, 262, 261,
+    263, 259, 264,
+    260, 264, 259,
+    264, 260, 265,
+    266, 265, 260,
+    260, 261, 266,
+    267, 261, 262,
+    268, 266, 261,
+    261, 267, 268,
+    262, 269, 267,
+    270, 267, 269,
+    271, 268, 267,
+    267, 270, 271,
+    266, 268, 272,
+    273, 272, 268,
+    268, 271, 273,
+    265, 266, 274,
+    272, 274, 266,
+    265, 275, 264,
+    275, 265, 276,
+    274, 276, 265,
+    276, 274, 277,
+    278, 277, 274,
+    274, 272, 278,
+    279, 278, 272,
+    272, 273, 279,
+    280, 273, 271,
+    281, 279, 273,
+    273, 280, 281,
+    282, 271, 270,
+    271, 282, 280,
+    283, 280, 282,
+    284, 281, 280,
+    280, 283, 284,
+    279, 281, 285,
+    286, 285, 281,
+    281, 284, 286,
+    278, 279, 287,
+    285, 287, 279,
+    277, 278, 288,
+    287, 288, 278,
+    288, 287, 289,
+    290, 289, 287,
+    287, 285, 290,
+    291, 290, 285,
+    285, 286, 291,
+    292, 286, 284,
+    293, 291, 286,
+    286, 292, 293,
+    294, 284, 283,
+    284, 294, 292,
+    295, 292, 294,
+    296, 293, 292,
+    292, 295, 296,
+    291, 293, 297,
+    298, 297, 293,
+    293, 296, 298,
+    290, 291, 299,
+    297, 299, 291,
+    289, 290, 300,
+    299, 300, 290,
+    300, 299, 301,
+    302, 301, 299,
+    299, 297, 302,
+    303, 302, 297,
+    297, 298, 303,
+    304, 298, 296,
+    305, 303, 298,
+    298, 304, 305,
+    306, 296, 295,
+    296, 306, 304,
+    307, 304, 306,
+    308, 305, 304,
+    304, 307, 308,
+    303, 305, 309,
+    310, 309, 305,
+    305, 308, 310,
+    302, 303, 311,
+    309, 311, 303,
+    301, 302, 312,
+    311, 312, 302,
+    312, 311, 313,
+    314, 313, 311,
+    311, 309, 314,
+    315, 314, 309,
+    309, 310, 315,
+    316, 310, 308,
+    317, 315, 310,
+    310, 316, 317,
+    318, 308, 307,
+    308, 318, 316,
+    319, 316, 318,
+    320, 317, 316,
+    316, 319, 320,
+    307, 321, 318,
+    322, 318, 321,
+    318, 322, 319,
+    323, 319, 322,
+    324, 320, 319,
+    319, 323, 324,
+    321, 325, 322,
+    326, 322, 325,
+    322, 326, 323,
+    321, 307, 327,
+    327, 328, 321,
+    325, 321, 328,
+    328, 329, 325,
+    330, 325, 329,
+    325, 330, 326,
+    331, 326, 330,
+    332, 323, 326,
+    326, 331, 332,
+    333, 324, 323,
+    323, 332, 333,
+    330, 334, 331,
+    329, 335, 330,
+    334, 330, 335,
+    329, 328, 336,
+    336, 337, 329,
+    335, 329, 337,
+    328, 327, 338,
+    338, 336, 328,
+    336, 338, 339,
+    339, 340, 336,
+    337, 336, 340,
+    340, 341, 337,
+    342, 337, 341,
+    337, 342, 335,
+    343, 335, 342,
+    335, 343, 334,
+    341, 344, 342,
+    345, 342, 344,
+    342, 345, 343,
+    341, 340, 346,
+    346, 347, 341,
+    344, 341, 347,
+    340, 339, 348,
+    348, 346, 340,
+    339, 349, 350,
+    350, 348, 339,
+    349, 339, 338,
+    348, 350, 351,
+    351, 352, 348,
+    346, 348, 352,
+    352, 353, 346,
+    347, 346, 353,
+    353, 354, 347,
+    355, 347, 354,
+    347, 355, 344,
+    356, 344, 355,
+    344, 356, 345,
+    354, 357, 355,
+    358, 355, 357,
+    355, 358, 356,
+    354, 353, 359,
+    359, 360, 354,
+    357, 354, 360,
+    353, 352, 361,
+    361, 359, 353,
+    352, 351, 362,
+    362, 361, 352,
+    361, 362, 363,
+    363, 364, 361,
+    359, 361, 364,
+    364, 365, 359,
+    360, 359, 365,
+    365, 366, 360,
+    367, 360, 366,
+    360, 367, 357,
+    368, 357, 367,
+    357, 368, 358,
+    366, 369, 367,
+    370, 367, 369,
+    367, 370, 368,
+    369, 371, 370,
+    372, 370, 371,
+    373, 374, 370,
+    370, 372, 373,
+    375, 371, 376,
+    371, 377, 372,
+    378, 371, 379,
+    380, 372, 377,
+    381, 373, 372,
+    372, 380, 381,
+    374, 373, 382,
+    383, 382, 373,
+    373, 381, 383,
+    382, 384, 374,
+    384, 382, 385,
+    386, 385, 382,
+    382, 383, 386,
+    387, 383, 381,
+    388, 386, 383,
+    383, 387, 388,
+    389, 381, 380,
+    381, 389, 387,
+    377, 390, 380,
+    391, 380, 390,
+    380, 391, 389,
+    392, 389, 391,
+    393, 387, 389,
+    389, 392, 393,
+    394, 388, 387,
+    387, 393, 394,
+    386, 388, 395,
+    396, 395, 388,
+    388, 394, 396,
+    385, 386, 397,
+    395, 397, 386,
+    397, 395, 398,
+    399, 398, 395,
+    395, 396, 399,
+    400, 396, 394,
+    401, 399, 396,
+    396, 400, 401,
+    402, 394, 393,
+    394, 402, 400,
+    403, 393, 392,
+    393, 403, 402,
+    404, 402, 403,
+    405, 400, 402,
+    402, 404, 405,
+    406, 401, 400,
+    400, 405, 406,
+    399, 401, 407,
+    408, 407, 401,
+    401, 406, 408,
+    398, 399, 409,
+    407, 409, 399,
+    409, 407, 410,
+    411, 410, 407,
+    407, 408, 411,
+    412, 408, 406,
+    413, 411, 408,
+    408, 412, 413,
+    414, 406, 405,
+    406, 414, 412,
+    415, 405, 404,
+    405, 415, 414,
+    416, 414, 415,
+    417, 412, 414,
+    414, 416, 417,
+    418, 413, 412,
+    412, 417, 418,
+    411, 413, 419,
+    420, 419, 413,
+    413, 418, 420,
+    410, 411, 421,
+    419, 421, 411,
+    421, 419, 422,
+    423, 422, 419,
+    419, 420, 423,
+    424, 420, 418,
+    425, 423, 420,
+    420, 424, 425,
+    426, 418, 417,
+    418, 426, 424,
+    427, 417, 416,
+    417, 427, 426,
+    428, 426, 427,
+    429, 424, 426,
+    426, 428, 429,
+    430, 425, 424,
+    424, 429, 430,
+    430, 431, 432,
+    432, 433, 430,
+    434, 430, 435,
+    431, 436, 437,
+    437, 432, 431,
+    432, 437, 438,
+    438, 439, 432,
+    433, 432, 439,
+    439, 440, 433,
+    439, 438, 441,
+    441, 442, 439,
+    440, 439, 442,
+    438, 443, 444,
+    444, 441, 438,
+    443, 438, 437,
+    437, 445, 443,
+    445, 437, 436,
+    436, 446, 445,
+    445, 447, 448,
+    448, 443, 445,
+    447, 445, 446,
+    443, 448, 449,
+    449, 444, 443,
+    444, 449, 450,
+    450, 451, 444,
+    441, 444, 451,
+    451, 452, 441,
+    442, 441, 452,
+    451, 450, 453,
+    453, 454, 451,
+    452, 451, 454,
+    450, 455, 456,
+    456, 453, 450,
+    455, 450, 449,
+    449, 457, 455,
+    457, 449, 448,
+    448, 458, 457,
+    458, 448, 447,
+    457, 459, 460,
+    460, 455, 457,
+    459, 457, 458,
+    455, 460, 461,
+    461, 456, 455,
+    456, 461, 462,
+    462, 463, 456,
+    453, 456, 463,
+    463, 464, 453,
+    454, 453, 464,
+    463, 462, 465,
+    465, 466, 463,
+    464, 463, 466,
+    462, 467, 468,
+    468, 465, 462,
+    467, 462, 461,
+    461, 469, 467,
+    469, 461, 460,
+    460, 470, 469,
+    470, 460, 459,
+    469, 471, 472,
+    472, 467, 469,
+    471, 469, 470,
+    467, 472, 473,
+    473, 468, 467,
+    468, 473, 474,
+    474, 475, 468,
+    465, 468, 475,
+    475, 476, 465,
+    466, 465, 476,
+    475, 474, 477,
+    477, 478, 475,
+    476, 475, 478,
+    474, 479, 480,
+    480, 477, 474,
+    479, 474, 473,
+    473, 481, 479,
+    481, 473, 472,
+    472, 482, 481,
+    482, 472, 471,
+    483, 479, 481,
+    483, 481, 482,
+    483, 480, 479,
+    483, 484, 480,
+    477, 480, 484,
+    484, 485, 477,
+    478, 477, 485,
+    485, 486, 478,
+    487, 478, 486,
+    478, 487, 476,
+    488, 476, 487,
+    476, 488, 466,
+    486, 489, 487,
+    490, 487, 489,
+    487, 490, 488,
+    491, 488, 490,
+    492, 466, 488,
+    488, 491, 492,
+    466, 492, 464,
+    493, 492, 491,
+    494, 464, 492,
+    492, 493, 494,
+    490, 495, 491,
+    496, 491, 495,
+    491, 496, 493,
+    489, 497, 490,
+    495, 490, 497,
+    497, 498, 495,
+    499, 495, 498,
+    495, 499, 496,
+    500, 496, 499,
+    501, 493, 496,
+    496, 500, 501,
+    502, 494, 493,
+    493, 501, 502,
+    464, 494, 454,
+    503, 454, 494,
+    494, 502, 503,
+    504, 502, 501,
+    505, 503, 502,
+    502, 504, 505,
+    506, 501, 500,
+    501, 506, 504,
+    499, 507, 500,
+    508, 500, 507,
+    500, 508, 506,
+    498, 509, 499,
+    507, 499, 509,
+    509, 510, 507,
+    511, 507, 510,
+    507, 511, 508,
+    512, 508, 511,
+    513, 506, 508,
+    508, 512, 513,
+    514, 504, 506,
+    506, 513, 514,
+    515, 505, 504,
+    504, 514, 515,
+    515, 516, 517,
+    517, 518, 515,
+    516, 515, 519,
+    505, 515, 520,
+    516, 521, 522,
+    522, 517, 516,
+    521, 516, 523,
+    519, 523, 516,
+    517, 522, 524,
+    524, 525, 517,
+    518, 517, 525,
+    525, 526, 518,
+    525, 524, 527,
+    527, 528, 525,
+    526, 525, 528,
+    524, 529, 530,
+    530, 527, 524,
+    529, 524, 522,
+    522, 531, 529,
+    531, 522, 521,
+    529, 532, 533,
+    533, 530, 529,
+    532, 529, 531,
+    530, 533, 534,
+    534, 535, 530,
+    527, 530, 535,
+    535, 536, 527,
+    528, 527, 536,
+    536, 537, 528,
+    538, 528, 537,
+    528, 538, 526,
+    536, 535, 539,
+    539, 540, 536,
+    537, 536, 540,
+    535, 534, 541,
+    541, 539, 535,
+    534, 542, 543,
+    543, 541, 534,
+    542, 534, 533,
+    533, 544, 542,
+    544, 533, 532,
+    542, 545, 546,
+    546, 543, 542,
+    545, 542, 544,
+    544, 547, 545,
+    547, 544, 548,
+    532, 548, 544,
+    545, 549, 550,
+    550, 546, 545,
+    549, 545, 547,
+    547, 551, 549,
+    551, 547, 552,
+    548, 552, 547,
+    552, 548, 553,
+    554, 553, 548,
+    548, 532, 554,
+    531, 554, 532,
+    553, 554, 555,
+    556, 555, 554,
+    554, 531, 556,
+    553, 557, 552,
+    557, 553, 558,
+    555, 558, 553,
+    552, 559, 551,
+    559, 552, 557,
+    551, 560, 561,
+    561, 549, 551,
+    560, 551, 559,
+    559, 562, 560,
+    562, 559, 563,
+    557, 563, 559,
+    563, 557, 564,
+    558, 564, 557,
+    564, 558, 565,
+    566, 565, 558,
+    558, 555, 566,
+    567, 566, 555,
+    555, 556, 567,
+    565, 566, 568,
+    569, 568, 566,
+    566, 567, 569,
+    565, 570, 564,
+    570, 565, 571,
+    568, 571, 565,
+    564, 572, 563,
+    572, 564, 570,
+    563, 573, 562,
+    573, 563, 572,
+    572, 574, 573,
+    574, 572, 575,
+    570, 575, 572,
+    575, 570, 576,
+    571, 576, 570,
+    576, 571, 577,
+    578, 577, 571,
+    571, 568, 578,
+    579, 578, 568,
+    568, 569, 579,
+    577, 578, 580,
+    581, 580, 578,
+    578, 579, 581,
+    577, 582, 576,
+    582, 577, 583,
+    580, 583, 577,
+    576, 584, 575,
+    584, 576, 582,
+    575, 585, 574,
+    585, 575, 584,
+    584, 586, 585,
+    586, 584, 587,
+    582, 587, 584,
+    587, 582, 588,
+    583, 588, 582,
+    588, 583, 589,
+    590, 589, 583,
+    583, 580, 590,
+    591, 590, 580,
+    580, 581, 591,
+    592, 591, 581,
+    593, 581, 579,
+    581, 593, 592,
+    594, 592, 593,
+    579, 595, 593,
+    596, 593, 595,
+    593, 596, 594,
+    597, 594, 596,
+    595, 598, 596,
+    599, 596, 598,
+    596, 599, 597,
+    595, 579, 569,
+    569, 600, 595,
+    598, 595, 600,
+    600, 601, 598,
+    602, 598, 601,
+    598, 602, 599,
+    600, 569, 567,
+    567, 603, 600,
+    601, 600, 603,
+    603, 523, 601,
+    604, 601, 523,
+    601, 604, 602,
+    603, 567, 556,
+    556, 521, 603,
+    523, 603, 521,
+    523, 519, 604,
+    521, 556, 531,
+    605, 597, 606,
+    597, 607, 608,
+    608, 609, 597,
+    510, 605, 511,
+    606, 511, 605,
+    511, 606, 512,
+    609, 608, 610,
+    610, 611, 609,
+    608, 612, 613,
+    613, 610, 608,
+    612, 608, 607,
+    607, 614, 612,
+    612, 615, 616,
+    616, 613, 612,
+    615, 612, 614,
+    613, 616, 617,
+    617, 618, 613,
+    610, 613, 618,
+    618, 619, 610,
+    611, 610, 619,
+    619, 620, 611,
+    619, 618, 621,
+    621, 622, 619,
+    620, 619, 622,
+    618, 617, 623,
+    623, 621, 618,
+    617, 624, 625,
+    625, 623, 617,
+    624, 617, 616,
+    616, 626, 624,
+    626, 616, 615,
+    624, 627, 628,
+    628, 625, 624,
+    627, 624, 626,
+    625, 628, 629,
+    629, 630, 625,
+    623, 625, 630,
+    630, 631, 623,
+    621, 623, 631,
+    631, 632, 621,
+    622, 621, 632,
+    631, 630, 633,
+    633, 634, 631,
+    632, 631, 634,
+    630, 629, 635,
+    635, 633, 630,
+    629, 636, 637,
+    637, 635, 629,
+    636, 629, 628,
+    628, 638, 636,
+    638, 628, 627,
+    636, 639, 640,
+    640, 637, 636,
+    639, 636, 638,
+    637, 640, 641,
+    641, 642, 637,
+    635, 637, 642,
+    642, 643, 635,
+    633, 635, 643,
+    643, 644, 633,
+    634, 633, 644,
+    643, 642, 645,
+    645, 646, 643,
+    644, 643, 646,
+    642, 641, 647,
+    647, 645, 642,
+    641, 648, 649,
+    649, 647, 641,
+    648, 641, 640,
+    640, 650, 648,
+    650, 640, 639,
+    648, 651, 652,
+    652, 649, 648,
+    651, 648, 650,
+    649, 652, 653,
+    653, 654, 649,
+    647, 649, 654,
+    654, 655, 647,
+    645, 647, 655,
+    655, 656, 645,
+    646, 645, 656,
+    655, 654, 657,
+    657, 658, 655,
+    656, 655, 658,
+    654, 653, 659,
+    659, 657, 654,
+    483, 659, 653,
+    483, 653, 652,
+    483, 652, 651,
+    483, 651, 660,
+    650, 660, 651,
+    660, 650, 661,
+    639, 661, 650,
+    483, 660, 662,
+    661, 662, 660,
+    662, 661, 663,
+    664, 663, 661,
+    661, 639, 664,
+    638, 664, 639,
+    663, 664, 665,
+    666, 665, 664,
+    664, 638, 666,
+    663, 667, 662,
+    667, 663, 668,
+    665, 668, 663,
+    483, 662, 667,
+    483, 667, 669,
+    668, 669, 667,
+    669, 668, 670,
+    671, 670, 668,
+    668, 665, 671,
+    672, 671, 665,
+    665, 666, 672,
+    627, 666, 638,
+    673, 672, 666,
+    666, 627, 673,
+    671, 672, 674,
+    675, 674, 672,
+    672, 673, 675,
+    670, 671, 676,
+    674, 676, 671,
+    670, 677, 669,
+    677, 670, 678,
+    676, 678, 670,
+    483, 669, 677,
+    483, 677, 679,
+    678, 679, 677,
+    679, 678, 485,
+    680, 485, 678,
+    678, 676, 680,
+    681, 680, 676,
+    676, 674, 681,
+    682, 681, 674,
+    674, 675, 682,
+    683, 675, 673,
+    684, 682, 675,
+    675, 683, 684,
+    673, 626, 683,
+    615, 683, 626,
+    685, 684, 683,
+    683, 615, 685,
+    626, 673, 627,
+    614, 685, 615,
+    485, 686, 679,
+    483, 679, 686,
+    483, 482, 687,
+    483, 687, 688,
+    483, 688, 689,
+    483, 689, 690,
+    483, 690, 691,
+    483, 691, 692,
+    483, 693, 694,
+    483, 694, 695,
+    483, 695, 696,
+    483, 696, 697,
+    483, 697, 698,
+    483, 698, 699,
+    483, 699, 700,
+    483, 700, 701,
+    483, 701, 702,
+    483, 702, 703,
+    483, 704, 705,
+    483, 705, 706,
+    483, 706, 707,
+    483, 707, 708,
+    483, 708, 709,
+    483, 709, 710,
+    483, 710, 711,
+    483, 711, 712,
+    483, 712, 713,
+    483, 713, 714,
+    715, 703, 702,
+    702, 716, 715,
+    717, 715, 716,
+    704, 715, 718,
+    719, 718, 715,
+    715, 720, 719,
+    716, 702, 701,
+    701, 721, 716,
+    722, 716, 721,
+    716, 722, 717,
+    723, 717, 722,
+    721, 724, 722,
+    725, 722, 724,
+    722, 725, 723,
+    721, 701, 700,
+    700, 726, 721,
+    724, 721, 726,
+    726, 727, 724,
+    728, 724, 727,
+    724, 728, 725,
+    729, 725, 728,
+    730, 723, 725,
+    725, 729, 730,
+    727, 731, 728,
+    732, 728, 731,
+    728, 732, 729,
+    727, 726, 733,
+    733, 734, 727,
+    731, 727, 734,
+    726, 700, 699,
+    699, 733, 726,
+    733, 699, 698,
+    698, 735, 733,
+    734, 733, 735,
+    735, 736, 734,
+    737, 734, 736,
+    734, 737, 731,
+    738, 731, 737,
+    731, 738, 732,
+    739, 732, 738,
+    740, 729, 732,
+    732, 739, 740,
+    737, 741, 738,
+    742, 738, 741,
+    738, 742, 739,
+    736, 743, 737,
+    741, 737, 743,
+    736, 735, 744,
+    744, 745, 736,
+    743, 736, 745,
+    735, 698, 697,
+    697, 744, 735,
+    744, 697, 696,
+    696, 746, 744,
+    745, 744, 746,
+    746, 747, 745,
+    748, 745, 747,
+    745, 748, 743,
+    749, 743, 748,
+    743, 749, 741,
+    750, 741, 749,
+    741, 750, 742,
+    748, 751, 749,
+    752, 749, 751,
+    749, 752, 750,
+    747, 753, 748,
+    751, 748, 753,
+    747, 746, 754,
+    754, 755, 747,
+    753, 747, 755,
+    746, 696, 695,
+    695, 754, 746,
+    754, 695, 694,
+    694, 756, 754,
+    755, 754, 756,
+    756, 757, 755,
+    758, 755, 757,
+    755, 758, 753,
+    759, 753, 758,
+    753, 759, 751,
+    760, 751, 759,
+    751, 760, 752,
+    758, 761, 759,
+    762, 759, 761,
+    759, 762, 760,
+    757, 763, 758,
+    761, 758, 763,
+    757, 756, 764,
+    764, 765, 757,
+    763, 757, 765,
+    756, 694, 693,
+    693, 764, 756,
+    764, 692, 691,
+    691, 766, 764,
+    767, 764, 766,
+    766, 691, 690,
+    690, 768, 766,
+    769, 766, 768,
+    766, 769, 767,
+    770, 767, 769,
+    768, 771, 769,
+    772, 769, 771,
+    769, 772, 770,
+    768, 690, 689,
+    689, 773, 768,
+    771, 768, 773,
+    773, 774, 771,
+    775, 771, 774,
+    771, 775, 772,
+    776, 772, 775,
+    777, 770, 772,
+    772, 776, 777,
+    774, 459, 775,
+    458, 775, 459,
+    775, 458, 776,
+    774, 773, 778,
+    778, 470, 774,
+    459, 774, 470,
+    773, 689, 688,
+    688, 778, 773,
+    778, 688, 687,
+    687, 471, 778,
+    470, 778, 471,
+    471, 687, 482,
+    447, 776, 458,
+    779, 777, 776,
+    776, 447, 779,
+    446, 779, 447,
+    765, 780, 763,
+    781, 763, 780,
+    780, 782, 781,
+    763, 781, 761,
+    783, 781, 782,
+    784, 761, 781,
+    781, 783, 784,
+    782, 785, 783,
+    786, 783, 785,
+    787, 784, 783,
+    783, 786, 787,
+    761, 784, 762,
+    788, 762, 784,
+    784, 787, 788,
+    789, 787, 786,
+    790, 788, 787,
+    787, 789, 790,
+    785, 791, 786,
+    792, 786, 791,
+    786, 792, 789,
+    793, 789, 792,
+    794, 790, 789,
+    789, 793, 794,
+    788, 790, 795,
+    796, 795, 790,
+    790, 794, 796,
+    762, 788, 797,
+    795, 797, 788,
+    797, 760, 762,
+    760, 797, 798,
+    799, 798, 797,
+    797, 795, 799,
+    800, 799, 795,
+    795, 796, 800,
+    801, 796, 794,
+    802, 800, 796,
+    796, 801, 802,
+    803, 794, 793,
+    794, 803, 801,
+    793, 804, 803,
+    804, 793, 805,
+    805, 435, 804,
+    805, 792, 806,
+    806, 434, 805,
+    792, 805, 793,
+    435, 805, 434,
+    791, 806, 792,
+    802, 807, 808,
+    808, 809, 802,
+    807, 802, 810,
+    800, 802, 811,
+    807, 812, 813,
+    813, 808, 807,
+    812, 807, 814,
+    810, 814, 807,
+    808, 813, 815,
+    815, 816, 808,
+    809, 808, 816,
+    816, 817, 809,
+    816, 815, 818,
+    818, 819, 816,
+    817, 816, 819,
+    815, 820, 821,
+    821, 818, 815,
+    820, 815, 813,
+    813, 822, 820,
+    822, 813, 812,
+    820, 823, 824,
+    824, 821, 820,
+    823, 820, 822,
+    821, 824, 825,
+    825, 826, 821,
+    818, 821, 826,
+    826, 827, 818,
+    819, 818, 827,
+    827, 828, 819,
+    829, 819, 828,
+    819, 829, 817,
+    827, 826, 830,
+    830, 831, 827,
+    828, 827, 831,
+    826, 825, 832,
+    832, 830, 826,
+    825, 833, 834,
+    834, 832, 825,
+    833, 825, 824,
+    824, 835, 833,
+    835, 824, 823,
+    833, 836, 837,
+    837, 834, 833,
+    836, 833, 835,
+    835, 392, 836,
+    392, 835, 403,
+    823, 403, 835,
+    836, 391, 838,
+    838, 837, 836,
+    391, 836, 392,
+    390, 838, 391,
+    403, 823, 404,
+    822, 404, 823,
+    404, 822, 415,
+    812, 415, 822,
+    415, 812, 416,
+    814, 416, 812,
+    416, 814, 427,
+    839, 427, 814,
+    814, 810, 839,
+    427, 839, 428,
+    831, 840, 828,
+    841, 828, 840,
+    840, 842, 841,
+    828, 841, 829,
+    811, 843, 800,
+    843, 811, 844,
+    843, 845, 799,
+    799, 800, 843,
+    845, 843, 846,
+    844, 846, 843,
+    846, 844, 847,
+    846, 848, 845,
+    848, 846, 849,
+    847, 849, 846,
+    845, 850, 798,
+    798, 799, 845,
+    850, 845, 848,
+    848, 851, 850,
+    851, 848, 852,
+    849, 852, 848,
+    852, 849, 853,
+    854, 853, 849,
+    849, 847, 854,
+    852, 855, 851,
+    855, 852, 856,
+    853, 856, 852,
+    851, 742, 750,
+    750, 850, 851,
+    742, 851, 855,
+    850, 750, 752,
+    752, 798, 850,
+    798, 752, 760,
+    855, 739, 742,
+    739, 855, 857,
+    856, 857, 855,
+    857, 856, 858,
+    859, 858, 856,
+    856, 853, 859,
+    860, 859, 853,
+    853, 854, 860,
+    860, 861, 862,
+    862, 863, 860,
+    864, 860, 865,
+    861, 866, 867,
+    867, 862, 861,
+    862, 867, 868,
+    868, 869, 862,
+    863, 862, 869,
+    869, 870, 863,
+    869, 868, 871,
+    871, 872, 869,
+    870, 869, 872,
+    868, 873, 874,
+    874, 871, 868,
+    873, 868, 867,
+    867, 875, 873,
+    875, 867, 866,
+    866, 876, 875,
+    875, 877, 878,
+    878, 873, 875,
+    877, 875, 876,
+    873, 878, 879,
+    879, 874, 873,
+    874, 879, 880,
+    880, 881, 874,
+    871, 874, 881,
+    881, 882, 871,
+    872, 871, 882,
+    881, 880, 883,
+    883, 884, 881,
+    882, 881, 884,
+    880, 885, 886,
+    886, 883, 880,
+    885, 880, 879,
+    879, 887, 885,
+    887, 879, 878,
+    878, 888, 887,
+    888, 878, 877,
+    887, 889, 890,
+    890, 885, 887,
+    889, 887, 888,
+    885, 890, 891,
+    891, 886, 885,
+    886, 891, 892,
+    892, 893, 886,
+    883, 886, 893,
+    893, 894, 883,
+    884, 883, 894,
+    893, 892, 895,
+    895, 896, 893,
+    894, 893, 896,
+    892, 897, 898,
+    898, 895, 892,
+    897, 892, 891,
+    891, 899, 897,
+    899, 891, 890,
+    890, 900, 899,
+    900, 890, 889,
+    899, 901, 902,
+    902, 897, 899,
+    901, 899, 900,
+    897, 902, 903,
+    903, 898, 897,
+    898, 903, 904,
+    904, 905, 898,
+    895, 898, 905,
+    905, 906, 895,
+    896, 895, 906,
+    905, 904, 907,
+    907, 908, 905,
+    906, 905, 908,
+    904, 909, 910,
+    910, 907, 904,
+    909, 904, 903,
+    903, 911, 909,
+    911, 903, 902,
+    902, 912, 911,
+    912, 902, 901,
+    911, 913, 914,
+    914, 909, 911,
+    913, 911, 912,
+    909, 914, 915,
+    915, 910, 909,
+    910, 915, 916,
+    916, 917, 910,
+    907, 910, 917,
+    917, 918, 907,
+    908, 907, 918,
+    918, 919, 908,
+    920, 908, 919,
+    908, 920, 906,
+    919, 921, 920,
+    922, 920, 921,
+    923, 906, 920,
+    920, 922, 923,
+    921, 924, 922,
+    925, 922, 924,
+    926, 923, 922,
+    922, 925, 926,
+    906, 923, 896,
+    927, 896, 923,
+    923, 926, 927,
+    928, 926, 925,
+    929, 927, 926,
+    926, 928, 929,
+    924, 930, 925,
+    931, 925, 930,
+    925, 931, 928,
+    932, 928, 931,
+    933, 929, 928,
+    928, 932, 933,
+    927, 929, 934,
+    935, 934, 929,
+    929, 933, 935,
+    896, 927, 894,
+    934, 894, 927,
+    894, 934, 884,
+    936, 884, 934,
+    934, 935, 936,
+    937, 935, 933,
+    938, 936, 935,
+    935, 937, 938,
+    939, 933, 932,
+    933, 939, 937,
+    931, 940, 932,
+    941, 932, 940,
+    932, 941, 939,
+    942, 939, 941,
+    943, 937, 939,
+    939, 942, 943,
+    944, 938, 937,
+    937, 943, 944,
+    936, 938, 945,
+    946, 945, 938,
+    938, 944, 946,
+    884, 936, 882,
+    945, 882, 936,
+    882, 945, 872,
+    947, 872, 945,
+    945, 946, 947,
+    872, 947, 870,
+    944, 948, 949,
+    949, 950, 944,
+    948, 944, 951,
+    948, 952, 953,
+    953, 949, 948,
+    952, 948, 954,
+    951, 954, 948,
+    949, 953, 955,
+    955, 956, 949,
+    950, 949, 956,
+    956, 957, 950,
+    956, 955, 958,
+    958, 959, 956,
+    957, 956, 959,
+    955, 960, 961,
+    961, 958, 955,
+    960, 955, 953,
+    953, 962, 960,
+    962, 953, 952,
+    960, 963, 964,
+    964, 961, 960,
+    963, 960, 962,
+    961, 964, 965,
+    965, 966, 961,
+    958, 961, 966,
+    966, 967, 958,
+    959, 958, 967,
+    967, 968, 959,
+    969, 959, 968,
+    959, 969, 957,
+    967, 966, 970,
+    970, 971, 967,
+    968, 967, 971,
+    966, 965, 972,
+    972, 970, 966,
+    965, 973, 974,
+    974, 972, 965,
+    973, 965, 964,
+    964, 975, 973,
+    975, 964, 963,
+    973, 976, 977,
+    977, 974, 973,
+    976, 973, 975,
+    975, 978, 976,
+    978, 975, 979,
+    963, 979, 975,
+    976, 719, 720,
+    720, 977, 976,
+    719, 976, 978,
+    978, 980, 719,
+    980, 978, 981,
+    979, 981, 978,
+    981, 979, 982,
+    983, 982, 979,
+    979, 963, 983,
+    962, 983, 963,
+    982, 983, 984,
+    985, 984, 983,
+    983, 962, 985,
+    982, 986, 981,
+    986, 982, 987,
+    984, 987, 982,
+    981, 988, 980,
+    988, 981, 986,
+    980, 989, 718,
+    718, 719, 980,
+    989, 980, 988,
+    988, 990, 989,
+    990, 988, 991,
+    986, 991, 988,
+    991, 986, 992,
+    987, 992, 986,
+    992, 987, 993,
+    994, 993, 987,
+    987, 984, 994,
+    995, 994, 984,
+    984, 985, 995,
+    993, 994, 996,
+    997, 996, 994,
+    994, 995, 997,
+    993, 998, 992,
+    998, 993, 999,
+    996, 999, 993,
+    992, 1000, 991,
+    1000, 992, 998,
+    991, 1001, 990,
+    1001, 991, 1000,
+    1000, 1002, 1001,
+    1002, 1000, 1003,
+    998, 1003, 1000,
+    1003, 998, 1004,
+    999, 1004, 998,
+    1004, 999, 1005,
+    1006, 1005, 999,
+    999, 996, 1006,
+    1007, 1006, 996,
+    996, 997, 1007,
+    1005, 1006, 1008,
+    1009, 1008, 1006,
+    1006, 1007, 1009,
+    1005, 1010, 1004,
+    1010, 1005, 1011,
+    1008, 1011, 1005,
+    1004, 1012, 1003,
+    1012, 1004, 1010,
+    1003, 1013, 1002,
+    1013, 1003, 1012,
+    1012, 1014, 1013,
+    1014, 1012, 1015,
+    1010, 1015, 1012,
+    1015, 1010, 1016,
+    1011, 1016, 1010,
+    1016, 1011, 1017,
+    1018, 1017, 1011,
+    1011, 1008, 1018,
+    1019, 1018, 1008,
+    1008, 1009, 1019,
+    1020, 1019, 1009,
+    1021, 1009, 1007,
+    1009, 1021, 1020,
+    1022, 1020, 1021,
+    1007, 1023, 1021,
+    1024, 1021, 1023,
+    1021, 1024, 1022,
+    1025, 1022, 1024,
+    1023, 1026, 1024,
+    1027, 1024, 1026,
+    1024, 1027, 1025,
+    1023, 1007, 997,
+    997, 1028, 1023,
+    1026, 1023, 1028,
+    1028, 1029, 1026,
+    1030, 1026, 1029,
+    1026, 1030, 1027,
+    1028, 997, 995,
+    995, 1031, 1028,
+    1029, 1028, 1031,
+    1031, 954, 1029,
+    1032, 1029, 954,
+    1029, 1032, 1030,
+    1031, 995, 985,
+    985, 952, 1031,
+    954, 1031, 952,
+    954, 951, 1032,
+    952, 985, 962,
+    1025, 1033, 1034,
+    1034, 1035, 1025,
+    1036, 1025, 1037,
+    1033, 1038, 1039,
+    1039, 1034, 1033,
+    1034, 1039, 1040,
+    1040, 1041, 1034,
+    1035, 1034, 1041,
+    1041, 1042, 1035,
+    1041, 1040, 1043,
+    1043, 1044, 1041,
+    1042, 1041, 1044,
+    1040, 1045, 1046,
+    1046, 1043, 1040,
+    1045, 1040, 1039,
+    1039, 1047, 1045,
+    1047, 1039, 1038,
+    1038, 1048, 1047,
+    1047, 1049, 1050,
+    1050, 1045, 1047,
+    1049, 1047, 1048,
+    1045, 1050, 1051,
+    1051, 1046, 1045,
+    1046, 1051, 1052,
+    1052, 1053, 1046,
+    1043, 1046, 1053,
+    1053, 1054, 1043,
+    1044, 1043, 1054,
+    1053, 1052, 1055,
+    1055, 1056, 1053,
+    1054, 1053, 1056,
+    1052, 1057, 1058,
+    1058, 1055, 1052,
+    1057, 1052, 1051,
+    1051, 1059, 1057,
+    1059, 1051, 1050,
+    1050, 1060, 1059,
+    1060, 1050, 1049,
+    1059, 1061, 1062,
+    1062, 1057, 1059,
+    1061, 1059, 1060,
+    1057, 1062, 1063,
+    1063, 1058, 1057,
+    1058, 1063, 1064,
+    1064, 1065, 1058,
+    1055, 1058, 1065,
+    1065, 1066, 1055,
+    1056, 1055, 1066,
+    1065, 1064, 1067,
+    1067, 1068, 1065,
+    1066, 1065, 1068,
+    1064, 1069, 1070,
+    1070, 1067, 1064,
+    1069, 1064, 1063,
+    1063, 1071, 1069,
+    1071, 1063, 1062,
+    1062, 1072, 1071,
+    1072, 1062, 1061,
+    1071, 1073, 1074,
+    1074, 1069, 1071,
+    1073, 1071, 1072,
+    1069, 1074, 1075,
+    1075, 1070, 1069,
+    1070, 1075, 1076,
+    1076, 1077, 1070,
+    1067, 1070, 1077,
+    1077, 1078, 1067,
+    1068, 1067, 1078,
+    1077, 1076, 1079,
+    1079, 1080, 1077,
+    1078, 1077, 1080,
+    1076, 1081, 1082,
+    1082, 1079, 1076,
+    1081, 1076, 1075,
+    1075, 1083, 1081,
+    1083, 1075, 1074,
+    1074, 1084, 1083,
+    1084, 1074, 1073,
+    1083, 1085, 1086,
+    1086, 1081, 1083,
+    1085, 1083, 1084,
+    1081, 1086, 1087,
+    1087, 1082, 1081,
+    1082, 1087, 1088,
+    1088, 1089, 1082,
+    1079, 1082, 1089,
+    1089, 1090, 1079,
+    1080, 1079, 1090,
+    1090, 1091, 1080,
+    1092, 1080, 1091,
+    1080, 1092, 1078,
+    1091, 1093, 1092,
+    1094, 1092, 1093,
+    1095, 1078, 1092,
+    1092, 1094, 1095,
+    1093, 1096, 1094,
+    1097, 1094, 1096,
+    1098, 1095, 1094,
+    1094, 1097, 1098,
+    1078, 1095, 1068,
+    1099, 1068, 1095,
+    1095, 1098, 1099,
+    1100, 1098, 1097,
+    1101, 1099, 1098,
+    1098, 1100, 1101,
+    1096, 1102, 1097,
+    1103, 1097, 1102,
+    1097, 1103, 1100,
+    1104, 1100, 1103,
+    1105, 1101, 1100,
+    1100, 1104, 1105,
+    1099, 1101, 1106,
+    1107, 1106, 1101,
+    1101, 1105, 1107,
+    1068, 1099, 1066,
+    1106, 1066, 1099,
+    1066, 1106, 1056,
+    1108, 1056, 1106,
+    1106, 1107, 1108,
+    1109, 1107, 1105,
+    1110, 1108, 1107,
+    1107, 1109, 1110,
+    1111, 1105, 1104,
+    1105, 1111, 1109,
+    1103, 1112, 1104,
+    1113, 1104, 1112,
+    1104, 1113, 1111,
+    1114, 1111, 1113,
+    1115, 1109, 1111,
+    1111, 1114, 1115,
+    1116, 1110, 1109,
+    1109, 1115, 1116,
+    1108, 1110, 1117,
+    1118, 1117, 1110,
+    1110, 1116, 1118,
+    1056, 1108, 1054,
+    1117, 1054, 1108,
+    1054, 1117, 1044,
+    1119, 1044, 1117,
+    1117, 1118, 1119,
+    1044, 1119, 1042,
+    1116, 1120, 1121,
+    1121, 1122, 1116,
+    1120, 1116, 1123,
+    1120, 632, 1124,
+    1124, 1121, 1120,
+    632, 1120, 622,
+    1123, 622, 1120,
+    1121, 1124, 1125,
+    1125, 1126, 1121,
+    1122, 1121, 1126,
+    1126, 1127, 1122,
+    1126, 1125, 1128,
+    1128, 1129, 1126,
+    1127, 1126, 1129,
+    1125, 1130, 1131,
+    1131, 1128, 1125,
+    1130, 1125, 1124,
+    1124, 634, 1130,
+    634, 1124, 632,
+    1130, 644, 1132,
+    1132, 1131, 1130,
+    644, 1130, 634,
+    1131, 1132, 1133,
+    1133, 1134, 1131,
+    1128, 1131, 1134,
+    1134, 1135, 1128,
+    1129, 1128, 1135,
+    1135, 1136, 1129,
+    1137, 1129, 1136,
+    1129, 1137, 1127,
+    1135, 1134, 1138,
+    1138, 1139, 1135,
+    1136, 1135, 1139,
+    1134, 1133, 1140,
+    1140, 1138, 1134,
+    1133, 1141, 1142,
+    1142, 1140, 1133,
+    1141, 1133, 1132,
+    1132, 646, 1141,
+    646, 1132, 644,
+    1141, 656, 1143,
+    1143, 1142, 1141,
+    656, 1141, 646,
+    658, 1143, 656,
+    1139, 1036, 1136,
+    1037, 1136, 1036,
+    1136, 1037, 1137,
+    622, 1123, 620,
+    1113, 1144, 1114,
+    1112, 1145, 1113,
+    1144, 1113, 1145,
+    1145, 1146, 1144,
+    1145, 1112, 1147,
+    1147, 1148, 1145,
+    1146, 1145, 1148,
+    1112, 1103, 1149,
+    1149, 1147, 1112,
+    1102, 1149, 1103,
+    1148, 1150, 1146,
+    1151, 1088, 1087,
+    1152, 1088, 1153,
+    1154, 1151, 1155,
+    1087, 1155, 1151,
+    1155, 1087, 1156,
+    1155, 1157, 1154,
+    1157, 1155, 1158,
+    1156, 1158, 1155,
+    1159, 1154, 1157,
+    1157, 1160, 1159,
+    1160, 1157, 1161,
+    1158, 1161, 1157,
+    1161, 1158, 1162,
+    1163, 1162, 1158,
+    1158, 1156, 1163,
+    1161, 1164, 1160,
+    1164, 1161, 1165,
+    1162, 1165, 1161,
+    1160, 1166, 1167,
+    1167, 1159, 1160,
+    1166, 1160, 1164,
+    1164, 1168, 1166,
+    1168, 1164, 1169,
+    1165, 1169, 1164,
+    1169, 1165, 1170,
+    1171, 1170, 1165,
+    1165, 1162, 1171,
+    1172, 1171, 1162,
+    1162, 1163, 1172,
+    1170, 1171, 1173,
+    1174, 1173, 1171,
+    1171, 1172, 1174,
+    1170, 1175, 1169,
+    1175, 1170, 1176,
+    1173, 1176, 1170,
+    1169, 1177, 1168,
+    1177, 1169, 1175,
+    1168, 1178, 1179,
+    1179, 1166, 1168,
+    1178, 1168, 1177,
+    1177, 1180, 1178,
+    1180, 1177, 1181,
+    1175, 1181, 1177,
+    1181, 1175, 1182,
+    1176, 1182, 1175,
+    1182, 1176, 1183,
+    1184, 1183, 1176,
+    1176, 1173, 1184,
+    1185, 1184, 1173,
+    1173, 1174, 1185,
+    1183, 1184, 1186,
+    1187, 1186, 1184,
+    1184, 1185, 1187,
+    1183, 1188, 1182,
+    1188, 1183, 1189,
+    1186, 1189, 1183,
+    1182, 1190, 1181,
+    1190, 1182, 1188,
+    1181, 1191, 1180,
+    1191, 1181, 1190,
+    1190, 1192, 1191,
+    1192, 1190, 1193,
+    1188, 1193, 1190,
+    1193, 1188, 1194,
+    1189, 1194, 1188,
+    1194, 1189, 1195,
+    1196, 1195, 1189,
+    1189, 1186, 1196,
+    1197, 1196, 1186,
+    1186, 1187, 1197,
+    1195, 1196, 1198,
+    1199, 1198, 1196,
+    1196, 1197, 1199,
+    1195, 1200, 1194,
+    1200, 1195, 1201,
+    1198, 1201, 1195,
+    1194, 1202, 1193,
+    1202, 1194, 1200,
+    1193, 1203, 1192,
+    1203, 1193, 1202,
+    1202, 1204, 1203,
+    1204, 1202, 1205,
+    1200, 1205, 1202,
+    1205, 1200, 1206,
+    1201, 1206, 1200,
+    1206, 1201, 1207,
+    1208, 1207, 1201,
+    1201, 1198, 1208,
+    1209, 1208, 1198,
+    1198, 1199, 1209,
+    1207, 1210, 1206,
+    1206, 1211, 1205,
+    1211, 1206, 1210,
+    1205, 1212, 1204,
+    1212, 1205, 1211,
+    1204, 1213, 1214,
+    1214, 1203, 1204,
+    1213, 1204, 1212,
+    1203, 1214, 1215,
+    1215, 1192, 1203,
+    1214, 1216, 1217,
+    1217, 1215, 1214,
+    1216, 1214, 1213,
+    1213, 1218, 1216,
+    1218, 1213, 1219,
+    1212, 1219, 1213,
+    1219, 1212, 1220,
+    1211, 1220, 1212,
+    1220, 1211, 1221,
+    1210, 1221, 1211,
+    1220, 1222, 1219,
+    1222, 1220, 1223,
+    1221, 1223, 1220,
+    1219, 1224, 1218,
+    1224, 1219, 1222,
+    1218, 1225, 1226,
+    1226, 1216, 1218,
+    1225, 1218, 1224,
+    1216, 1226, 1227,
+    1227, 1217, 1216,
+    1226, 1228, 1229,
+    1229, 1227, 1226,
+    1228, 1226, 1225,
+    1225, 1230, 1228,
+    1230, 1225, 1231,
+    1224, 1231, 1225,
+    1231, 1224, 1232,
+    1222, 1232, 1224,
+    1232, 1222, 1233,
+    1223, 1233, 1222,
+    1232, 1234, 1231,
+    1234, 1232, 1235,
+    1233, 1235, 1232,
+    1231, 1236, 1230,
+    1236, 1231, 1234,
+    1230, 50, 1237,
+    1237, 1228, 1230,
+    50, 1230, 1236,
+    1228, 1237, 1238,
+    1238, 1229, 1228,
+    1237, 49, 1239,
+    1239, 1238, 1237,
+    49, 1237, 50,
+    1236, 51, 50,
+    51, 1236, 1240,
+    1234, 1240, 1236,
+    1240, 1234, 1241,
+    1235, 1241, 1234,
+    1240, 52, 51,
+    52, 1240, 1242,
+    1241, 1242, 1240,
+    1242, 54, 52,
+    38, 1239, 49,
+    1239, 38, 1243,
+    1243, 1244, 1239,
+    1238, 1239, 1244,
+    1244, 1245, 1238,
+    1229, 1238, 1245,
+    1244, 1243, 1246,
+    1246, 1247, 1244,
+    1245, 1244, 1247,
+    1243, 37, 1248,
+    1248, 1246, 1243,
+    37, 1243, 38,
+    1246, 1248, 1249,
+    1249, 1250, 1246,
+    1247, 1246, 1250,
+    1250, 1251, 1247,
+    1252, 1247, 1251,
+    1247, 1252, 1245,
+    1253, 1245, 1252,
+    1245, 1253, 1229,
+    1227, 1229, 1253,
+    1252, 1254, 1253,
+    1255, 1253, 1254,
+    1253, 1255, 1227,
+    1251, 1256, 1252,
+    1254, 1252, 1256,
+    1251, 1250, 1257,
+    1257, 1258, 1251,
+    1256, 1251, 1258,
+    1250, 1249, 1259,
+    1259, 1257, 1250,
+    1257, 1259, 1260,
+    1260, 1261, 1257,
+    1258, 1257, 1261,
+    1261, 1262, 1258,
+    1263, 1258, 1262,
+    1258, 1263, 1256,
+    1264, 1256, 1263,
+    1256, 1264, 1254,
+    1265, 1254, 1264,
+    1254, 1265, 1255,
+    1263, 1266, 1264,
+    1267, 1264, 1266,
+    1264, 1267, 1265,
+    1262, 1268, 1263,
+    1266, 1263, 1268,
+    1268, 1269, 1266,
+    1270, 1266, 1269,
+    1266, 1270, 1267,
+    1271, 1267, 1270,
+    1272, 1265, 1267,
+    1267, 1271, 1272,
+    1273, 1255, 1265,
+    1265, 1272, 1273,
+    1274, 1272, 1271,
+    1275, 1273, 1272,
+    1272, 1274, 1275,
+    1270, 1276, 1271,
+    1277, 1271, 1276,
+    1271, 1277, 1274,
+    1269, 1278, 1270,
+    1276, 1270, 1278,
+    1278, 1279, 1276,
+    1280, 1276, 1279,
+    1276, 1280, 1277,
+    1178, 1277, 1280,
+    1180, 1274, 1277,
+    1277, 1178, 1180,
+    1191, 1275, 1274,
+    1274, 1180, 1191,
+    1273, 1275, 1215,
+    1192, 1215, 1275,
+    1275, 1191, 1192,
+    1215, 1217, 1273,
+    1217, 1227, 1255,
+    1255, 1273, 1217,
+    1280, 1179, 1178,
+    1279, 1281, 1280,
+    1179, 1280, 1281,
+    1281, 1282, 1179,
+    1166, 1179, 1282,
+    1282, 1167, 1166,
+    1283, 1260, 1259,
+    1260, 1284, 1285,
+    1285, 1286, 1260,
+    1287, 1260, 1286,
+    1288, 1283, 1289,
+    1259, 1289, 1283,
+    1289, 1259, 1249,
+    1289, 1290, 1288,
+    1290, 1289, 1291,
+    1249, 1291, 1289,
+    1292, 1288, 1290,
+    1290, 24, 1292,
+    24, 1290, 25,
+    1291, 25, 1290,
+    25, 1291, 26,
+    1248, 26, 1291,
+    1291, 1249, 1248,
+    26, 1248, 37,
+    24, 13, 1293,
+    1293, 1292, 24,
+    12, 1293, 13,
+    1286, 1285, 1294,
+    1294, 1295, 1286,
+    1296, 1286, 1295,
+    1286, 1296, 1287,
+    1285, 1297, 1298,
+    1298, 1294, 1285,
+    1297, 1285, 1284,
+    1294, 1298, 1299,
+    1299, 1300, 1294,
+    1295, 1294, 1300,
+    1300, 1301, 1295,
+    1302, 1295, 1301,
+    1295, 1302, 1296,
+    1303, 1296, 1302,
+    1304, 1287, 1296,
+    1296, 1303, 1304,
+    1301, 1305, 1302,
+    1306, 1302, 1305,
+    1302, 1306, 1303,
+    1301, 1300, 1307,
+    1307, 1308, 1301,
+    1305, 1301, 1308,
+    1300, 1299, 1309,
+    1309, 1307, 1300,
+    1307, 1309, 1310,
+    1310, 1311, 1307,
+    1308, 1307, 1311,
+    1311, 1312, 1308,
+    1313, 1308, 1312,
+    1308, 1313, 1305,
+    1314, 1305, 1313,
+    1305, 1314, 1306,
+    1315, 1306, 1314,
+    1316, 1303, 1306,
+    1306, 1315, 1316,
+    1313, 1317, 1314,
+    1318, 1314, 1317,
+    1314, 1318, 1315,
+    1312, 1319, 1313,
+    1317, 1313, 1319,
+    1312, 1311, 1320,
+    1320, 1321, 1312,
+    1319, 1312, 1321,
+    1311, 1310, 1322,
+    1322, 1320, 1311,
+    1320, 1322, 1323,
+    1323, 1324, 1320,
+    1321, 1320, 1324,
+    1324, 1325, 1321,
+    1326, 1321, 1325,
+    1321, 1326, 1319,
+    1327, 1319, 1326,
+    1319, 1327, 1317,
+    1328, 1317, 1327,
+    1317, 1328, 1318,
+    1326, 1329, 1327,
+    1330, 1327, 1329,
+    1327, 1330, 1328,
+    1325, 1331, 1326,
+    1329, 1326, 1331,
+    1325, 1324, 1332,
+    1332, 1333, 1325,
+    1331, 1325, 1333,
+    1324, 1323, 1334,
+    1334, 1332, 1324,
+    1332, 1334, 1335,
+    1335, 1336, 1332,
+    1333, 1332, 1336,
+    1336, 1337, 1333,
+    1338, 1333, 1337,
+    1333, 1338, 1331,
+    1339, 1331, 1338,
+    1331, 1339, 1329,
+    1340, 1329, 1339,
+    1329, 1340, 1330,
+    1338, 1341, 1339,
+    1342, 1339, 1341,
+    1339, 1342, 1340,
+    1337, 1343, 1338,
+    1341, 1338, 1343,
+    1337, 1336, 1344,
+    1344, 1345, 1337,
+    1343, 1337, 1345,
+    1336, 1335, 1346,
+    1346, 1344, 1336,
+    1347, 1346, 1335,
+    1348, 1347, 1349,
+    1335, 1349, 1347,
+    1350, 1348, 1351,
+    1349, 1351, 1348,
+    1351, 1349, 1352,
+    1334, 1352, 1349,
+    1349, 1335, 1334,
+    1351, 1353, 1350,
+    1353, 1351, 1354,
+    1352, 1354, 1351,
+    1355, 1350, 1353,
+    1353, 1356, 1355,
+    1356, 1353, 1357,
+    1354, 1357, 1353,
+    1357, 1354, 1358,
+    1359, 1358, 1354,
+    1354, 1352, 1359,
+    1323, 1359, 1352,
+    1352, 1334, 1323,
+    1358, 1359, 1360,
+    1322, 1360, 1359,
+    1359, 1323, 1322,
+    1358, 1361, 1357,
+    1361, 1358, 1362,
+    1360, 1362, 1358,
+    1357, 1363, 1356,
+    1363, 1357, 1361,
+    1356, 1364, 1365,
+    1365, 1355, 1356,
+    1364, 1356, 1363,
+    1363, 1366, 1364,
+    1366, 1363, 1367,
+    1361, 1367, 1363,
+    1367, 1361, 1368,
+    1362, 1368, 1361,
+    1368, 1362, 1369,
+    1370, 1369, 1362,
+    1362, 1360, 1370,
+    1310, 1370, 1360,
+    1360, 1322, 1310,
+    1369, 1370, 1371,
+    1309, 1371, 1370,
+    1370, 1310, 1309,
+    1369, 1372, 1368,
+    1372, 1369, 1373,
+    1371, 1373, 1369,
+    1368, 1374, 1367,
+    1374, 1368, 1372,
+    1367, 1375, 1366,
+    1375, 1367, 1374,
+    1374, 1376, 1375,
+    1376, 1374, 1377,
+    1372, 1377, 1374,
+    1377, 1372, 1378,
+    1373, 1378, 1372,
+    1378, 1373, 1379,
+    1380, 1379, 1373,
+    1373, 1371, 1380,
+    1299, 1380, 1371,
+    1371, 1309, 1299,
+    1379, 1380, 1381,
+    1298, 1381, 1380,
+    1380, 1299, 1298,
+    1379, 1382, 1378,
+    1382, 1379, 1383,
+    1381, 1383, 1379,
+    1378, 1384, 1377,
+    1384, 1378, 1382,
+    1377, 1385, 1376,
+    1385, 1377, 1384,
+    1384, 1386, 1385,
+    1386, 1384, 1387,
+    1382, 1387, 1384,
+    1387, 1382, 1388,
+    1383, 1388, 1382,
+    1388, 1383, 1389,
+    1390, 1389, 1383,
+    1383, 1381, 1390,
+    1297, 1390, 1381,
+    1381, 1298, 1297,
+    1389, 1390, 1391,
+    1392, 1391, 1390,
+    1390, 1297, 1392,
+    1389, 1393, 1388,
+    1393, 1389, 1394,
+    1391, 1394, 1389,
+    1388, 1395, 1387,
+    1395, 1388, 1393,
+    1387, 1396, 1386,
+    1396, 1387, 1395,
+    1395, 1397, 1396,
+    1397, 1395, 1398,
+    1393, 1398, 1395,
+    1398, 1393, 1399,
+    1394, 1399, 1393,
+    1398, 1400, 1397,
+    1400, 1398, 1401,
+    1399, 1401, 1398,
+    1401, 1402, 1400,
+    1284, 1392, 1297,
+    1345, 1403, 1404,
+    1404, 1405, 1345,
+    1406, 1345, 1405,
+    1345, 1407, 1343,
+    1403, 1408, 1409,
+    1409, 1404, 1403,
+    1404, 1409, 1410,
+    1410, 1411, 1404,
+    1405, 1404, 1411,
+    1411, 1412, 1405,
+    1413, 1405, 1412,
+    1405, 1413, 1406,
+    1414, 1406, 1413,
+    1412, 1415, 1413,
+    1416, 1413, 1415,
+    1413, 1416, 1414,
+    1412, 1411, 1417,
+    1417, 1418, 1412,
+    1415, 1412, 1418,
+    1411, 1410, 1419,
+    1419, 1417, 1411,
+    1410, 1420, 1421,
+    1421, 1419, 1410,
+    1420, 1410, 1409,
+    1419, 1421, 1422,
+    1422, 1423, 1419,
+    1417, 1419, 1423,
+    1423, 1424, 1417,
+    1418, 1417, 1424,
+    1424, 1425, 1418,
+    1426, 1418, 1425,
+    1418, 1426, 1415,
+    1427, 1415, 1426,
+    1415, 1427, 1416,
+    1425, 1428, 1426,
+    1429, 1426, 1428,
+    1426, 1429, 1427,
+    1425, 1424, 1430,
+    1430, 1431, 1425,
+    1428, 1425, 1431,
+    1424, 1423, 1432,
+    1432, 1430, 1424,
+    1423, 1422, 1433,
+    1433, 1432, 1423,
+    1432, 1433, 1434,
+    1434, 1435, 1432,
+    1430, 1432, 1435,
+    1435, 1436, 1430,
+    1431, 1430, 1436,
+    1436, 1437, 1431,
+    1438, 1431, 1437,
+    1431, 1438, 1428,
+    1439, 1428, 1438,
+    1428, 1439, 1429,
+    1437, 277, 1438,
+    288, 1438, 277,
+    1438, 288, 1439,
+    1437, 1436, 1440,
+    1440, 276, 1437,
+    277, 1437, 276,
+    1436, 1435, 1441,
+    1441, 1440, 1436,
+    1435, 1434, 1442,
+    1442, 1441, 1435,
+    1441, 1442, 1443,
+    1443, 1444, 1441,
+    1440, 1441, 1444,
+    1444, 275, 1440,
+    276, 1440, 275,
+    1444, 1443, 1445,
+    1445, 1446, 1444,
+    275, 1444, 1446,
+    1443, 1447, 1448,
+    1448, 1445, 1443,
+    1447, 1443, 1442,
+    1442, 1449, 1447,
+    1449, 1442, 1434,
+    1447, 1450, 1451,
+    1451, 1448, 1447,
+    1450, 1447, 1449,
+    1448, 1451, 1452,
+    1452, 1453, 1448,
+    1445, 1448, 1453,
+    1453, 1454, 1445,
+    1446, 1445, 1454,
+    1454, 263, 1446,
+    264, 1446, 263,
+    1446, 264, 275,
+    1455, 1452, 1451,
+    1451, 1456, 1455,
+    1456, 1451, 1450,
+    1450, 1457, 1456,
+    1457, 1450, 1458,
+    1449, 1458, 1450,
+    1456, 1459, 1460,
+    1460, 1455, 1456,
+    1459, 1456, 1457,
+    1457, 1461, 1459,
+    1461, 1457, 1462,
+    1458, 1462, 1457,
+    1462, 1458, 1463,
+    1464, 1463, 1458,
+    1458, 1449, 1464,
+    1462, 1465, 1461,
+    1465, 1462, 1466,
+    1463, 1466, 1462,
+    1466, 1463, 1467,
+    1468, 1467, 1463,
+    1463, 1464, 1468,
+    1434, 1464, 1449,
+    1433, 1468, 1464,
+    1464, 1434, 1433,
+    1467, 1468, 1469,
+    1422, 1469, 1468,
+    1468, 1433, 1422,
+    1467, 1470, 1466,
+    1470, 1467, 1471,
+    1469, 1471, 1467,
+    1466, 1472, 1465,
+    1472, 1466, 1470,
+    1470, 1473, 1472,
+    1473, 1470, 1474,
+    1471, 1474, 1470,
+    1474, 1471, 1475,
+    1476, 1475, 1471,
+    1471, 1469, 1476,
+    1421, 1476, 1469,
+    1469, 1422, 1421,
+    1475, 1476, 1477,
+    1420, 1477, 1476,
+    1476, 1421, 1420,
+    1475, 1478, 1474,
+    1478, 1475, 1479,
+    1477, 1479, 1475,
+    1474, 1480, 1473,
+    1480, 1474, 1478,
+    1478, 1481, 1480,
+    1481, 1478, 1482,
+    1479, 1482, 1478,
+    1482, 1479, 1483,
+    1484, 1483, 1479,
+    1479, 1477, 1484,
+    1485, 1484, 1477,
+    1477, 1420, 1485,
+    1409, 1485, 1420,
+    1484, 1485, 1486,
+    1408, 1486, 1485,
+    1485, 1409, 1408,
+    1483, 1484, 1487,
+    1486, 1487, 1484,
+    1483, 1488, 1482,
+    1488, 1483, 1489,
+    1487, 1489, 1483,
+    1482, 1490, 1481,
+    1490, 1482, 1488,
+    1488, 1491, 1490,
+    1491, 1488, 1492,
+    1489, 1492, 1488,
+    1492, 1493, 1491,
+    289, 1439, 288,
+    1494, 1429, 1439,
+    1439, 289, 1494,
+    300, 1494, 289,
+    1429, 1494, 1495,
+    1496, 1495, 1494,
+    1494, 300, 1496,
+    1495, 1427, 1429,
+    1427, 1495, 1497,
+    1498, 1497, 1495,
+    1495, 1496, 1498,
+    301, 1496, 300,
+    1499, 1498, 1496,
+    1496, 301, 1499,
+    1497, 1498, 1500,
+    1501, 1500, 1498,
+    1498, 1499, 1501,
+    1497, 1416, 1427,
+    1416, 1497, 1502,
+    1500, 1502, 1497,
+    1502, 1414, 1416,
+    1503, 1501, 1499,
+    312, 1499, 301,
+    1499, 312, 1503,
+    313, 1503, 312,
+    1504, 1343, 1407,
+    1343, 1504, 1341,
+    1407, 1505, 1504,
+    1506, 1504, 1505,
+    1507, 1341, 1504,
+    1504, 1506, 1507,
+    1341, 1507, 1342,
+    1508, 1507, 1506,
+    1509, 1342, 1507,
+    1507, 1508, 1509,
+    1505, 1510, 1506,
+    1511, 1506, 1510,
+    1506, 1511, 1508,
+    1512, 1508, 1511,
+    1513, 1509, 1508,
+    1508, 1512, 1513,
+    1342, 1509, 1514,
+    1515, 1514, 1509,
+    1509, 1513, 1515,
+    1514, 1340, 1342,
+    1340, 1514, 1516,
+    1517, 1516, 1514,
+    1514, 1515, 1517,
+    1518, 1515, 1513,
+    1519, 1517, 1515,
+    1515, 1518, 1519,
+    1520, 1513, 1512,
+    1513, 1520, 1518,
+    1511, 1521, 1512,
+    1522, 1512, 1521,
+    1512, 1522, 1520,
+    1523, 1520, 1522,
+    1524, 1518, 1520,
+    1520, 1523, 1524,
+    1525, 1519, 1518,
+    1518, 1524, 1525,
+    1517, 1519, 1526,
+    1527, 1526, 1519,
+    1519, 1525, 1527,
+    1516, 1517, 1528,
+    1526, 1528, 1517,
+    1528, 1526, 1529,
+    1530, 1529, 1526,
+    1526, 1527, 1530,
+    1531, 1527, 1525,
+    1532, 1530, 1527,
+    1527, 1531, 1532,
+    1533, 1525, 1524,
+    1525, 1533, 1531,
+    1534, 1524, 1523,
+    1524, 1534, 1533,
+    1535, 1533, 1534,
+    1536, 1531, 1533,
+    1533, 1535, 1536,
+    1537, 1532, 1531,
+    1531, 1536, 1537,
+    1530, 1532, 1538,
+    1539, 1538, 1532,
+    1532, 1537, 1539,
+    1529, 1530, 1540,
+    1538, 1540, 1530,
+    1540, 1538, 1541,
+    1542, 1541, 1538,
+    1538, 1539, 1542,
+    1543, 1539, 1537,
+    1544, 1542, 1539,
+    1539, 1543, 1544,
+    1545, 1537, 1536,
+    1537, 1545, 1543,
+    1546, 1536, 1535,
+    1536, 1546, 1545,
+    1547, 1545, 1546,
+    1548, 1543, 1545,
+    1545, 1547, 1548,
+    1549, 1544, 1543,
+    1543, 1548, 1549,
+    1542, 1544, 1550,
+    1551, 1550, 1544,
+    1544, 1549, 1551,
+    1541, 1542, 1552,
+    1550, 1552, 1542,
+    1552, 1553, 1541,
+    1553, 1554, 1555,
+    1555, 1541, 1553,
+    1554, 1556, 1557,
+    1557, 1555, 1554,
+    1555, 1557, 1558,
+    1558, 1540, 1555,
+    1541, 1555, 1540,
+    1557, 1559, 1560,
+    1560, 1558, 1557,
+    1559, 1557, 1556,
+    1556, 1561, 1559,
+    1559, 1562, 1563,
+    1563, 1560, 1559,
+    1562, 1559, 1561,
+    1560, 1563, 1564,
+    1564, 1565, 1560,
+    1558, 1560, 1565,
+    1565, 1529, 1558,
+    1540, 1558, 1529,
+    1565, 1564, 1566,
+    1566, 1528, 1565,
+    1529, 1565, 1528,
+    1564, 1318, 1328,
+    1328, 1566, 1564,
+    1318, 1564, 1563,
+    1563, 1315, 1318,
+    1315, 1563, 1562,
+    1562, 1316, 1315,
+    1316, 1562, 1567,
+    1561, 1567, 1562,
+    1303, 1316, 1568,
+    1567, 1568, 1316,
+    1568, 1304, 1303,
+    1566, 1328, 1330,
+    1330, 1516, 1566,
+    1528, 1566, 1516,
+    1516, 1330, 1340,
+    1569, 1551, 1549,
+    1549, 1570, 1569,
+    1571, 1569, 1570,
+    1570, 1549, 1548,
+    1548, 1572, 1570,
+    1573, 1570, 1572,
+    1570, 1573, 1571,
+    1572, 1548, 1547,
+    1547, 1574, 1572,
+    1575, 1572, 1574,
+    1572, 1575, 1573,
+    1546, 1576, 1547,
+    1574, 1547, 1576,
+    1576, 1577, 1574,
+    1578, 1574, 1577,
+    1574, 1578, 1575,
+    1576, 1546, 1579,
+    1579, 1580, 1576,
+    1577, 1576, 1580,
+    1535, 1579, 1546,
+    1579, 1535, 1581,
+    1581, 1582, 1579,
+    1580, 1579, 1582,
+    1582, 1583, 1580,
+    1584, 1580, 1583,
+    1580, 1584, 1577,
+    1585, 1577, 1584,
+    1577, 1585, 1578,
+    1583, 1586, 1584,
+    1587, 1584, 1586,
+    1584, 1587, 1585,
+    1583, 1582, 1588,
+    1588, 1589, 1583,
+    1586, 1583, 1589,
+    1582, 1581, 1590,
+    1590, 1588, 1582,
+    1581, 1534, 1591,
+    1591, 1590, 1581,
+    1534, 1581, 1535,
+    1590, 1591, 1592,
+    1592, 1593, 1590,
+    1588, 1590, 1593,
+    1593, 1594, 1588,
+    1589, 1588, 1594,
+    1594, 1595, 1589,
+    1596, 1589, 1595,
+    1589, 1596, 1586,
+    1597, 1586, 1596,
+    1586, 1597, 1587,
+    1595, 1598, 1596,
+    1599, 1596, 1598,
+    1596, 1599, 1597,
+    1595, 1594, 1600,
+    1600, 1601, 1595,
+    1598, 1595, 1601,
+    1594, 1593, 1602,
+    1602, 1600, 1594,
+    1593, 1592, 1603,
+    1603, 1602, 1593,
+    1602, 1603, 1604,
+    1604, 1605, 1602,
+    1600, 1602, 1605,
+    1605, 1606, 1600,
+    1601, 1600, 1606,
+    1606, 1607, 1601,
+    1608, 1601, 1607,
+    1601, 1608, 1598,
+    1609, 1598, 1608,
+    1598, 1609, 1599,
+    1607, 1610, 1608,
+    1611, 1608, 1610,
+    1608, 1611, 1609,
+    1610, 1612, 1611,
+    1613, 1611, 1612,
+    1614, 1615, 1611,
+    1611, 1613, 1614,
+    1616, 1612, 1617,
+    1612, 1618, 1613,
+    561, 1613, 1618,
+    560, 1614, 1613,
+    1613, 561, 560,
+    1615, 1614, 1619,
+    562, 1619, 1614,
+    1614, 560, 562,
+    1619, 1620, 1615,
+    1620, 1619, 1621,
+    573, 1621, 1619,
+    1619, 562, 573,
+    1621, 1622, 1620,
+    1622, 1621, 1623,
+    574, 1623, 1621,
+    1621, 573, 574,
+    1623, 1624, 1622,
+    1624, 1623, 1625,
+    585, 1625, 1623,
+    1623, 574, 585,
+    1625, 1626, 1624,
+    1626, 1625, 1627,
+    586, 1627, 1625,
+    1625, 585, 586,
+    1627, 1628, 1626,
+    1628, 1627, 1629,
+    1630, 1629, 1627,
+    1627, 586, 1630,
+    587, 1630, 586,
+    1629, 1630, 1631,
+    1632, 1631, 1630,
+    1630, 587, 1632,
+    1629, 1633, 1628,
+    1633, 1629, 1634,
+    1631, 1634, 1629,
+    1634, 1631, 1635,
+    1636, 1635, 1631,
+    1631, 1632, 1636,
+    588, 1632, 587,
+    1637, 1636, 1632,
+    1632, 588, 1637,
+    589, 1637, 588,
+    1635, 1152, 1634,
+    1634, 1153, 1633,
+    1153, 1634, 1152,
+    1618, 1638, 561,
+    549, 561, 1638,
+    1638, 550, 549,
+    1639, 1617, 1640,
+    1617, 1639, 1616,
+    1640, 1641, 1639,
+    1642, 1639, 1641,
+    1643, 1616, 1639,
+    1639, 1642, 1643,
+    1641, 1640, 1644,
+    1644, 1645, 1641,
+    1646, 1641, 1645,
+    1641, 1646, 1642,
+    1647, 1642, 1646,
+    1648, 1643, 1642,
+    1642, 1647, 1648,
+    1645, 1649, 1646,
+    1650, 1646, 1649,
+    1646, 1650, 1647,
+    1645, 1644, 1651,
+    1651, 1652, 1645,
+    1649, 1645, 1652,
+    1652, 1653, 1649,
+    1654, 1649, 1653,
+    1649, 1654, 1650,
+    1655, 1650, 1654,
+    1656, 1647, 1650,
+    1650, 1655, 1656,
+    1657, 1648, 1647,
+    1647, 1656, 1657,
+    1658, 1656, 1655,
+    1659, 1657, 1656,
+    1656, 1658, 1659,
+    1654, 409, 1655,
+    410, 1655, 409,
+    1655, 410, 1658,
+    1653, 398, 1654,
+    409, 1654, 398,
+    1653, 1652, 1660,
+    1660, 397, 1653,
+    398, 1653, 397,
+    1660, 1661, 1662,
+    1662, 385, 1660,
+    1661, 1660, 1652,
+    397, 1660, 385,
+    1652, 1651, 1661,
+    385, 1662, 384,
+    421, 1658, 410,
+    1663, 1659, 1658,
+    1658, 421, 1663,
+    422, 1663, 421,
+    1664, 1604, 1603,
+    1665, 1664, 1666,
+    1603, 1666, 1664,
+    1666, 1603, 1592,
+    1666, 1667, 1665,
+    1667, 1666, 1668,
+    1592, 1668, 1666,
+    1669, 1665, 1667,
+    1667, 1521, 1669,
+    1521, 1667, 1522,
+    1668, 1522, 1667,
+    1522, 1668, 1523,
+    1591, 1523, 1668,
+    1668, 1592, 1591,
+    1523, 1591, 1534,
+    1521, 1511, 1670,
+    1670, 1669, 1521,
+    1510, 1670, 1511,
+    1084, 1671, 1085,
+    1671, 1084, 1672,
+    1073, 1672, 1084,
+    1672, 1673, 1671,
+    1673, 1672, 1674,
+    1675, 1674, 1672,
+    1672, 1073, 1675,
+    1072, 1675, 1073,
+    1674, 1675, 1676,
+    1677, 1676, 1675,
+    1675, 1072, 1677,
+    1674, 1678, 1673,
+    1678, 1674, 1679,
+    1676, 1679, 1674,
+    1679, 1676, 1680,
+    1681, 1680, 1676,
+    1676, 1677, 1681,
+    1061, 1677, 1072,
+    1682, 1681, 1677,
+    1677, 1061, 1682,
+    1680, 1681, 1683,
+    1684, 1683, 1681,
+    1681, 1682, 1684,
+    1680, 1685, 1679,
+    1685, 1680, 1686,
+    1683, 1686, 1680,
+    1679, 1687, 1678,
+    1687, 1679, 1685,
+    1685, 1688, 1687,
+    1688, 1685, 1689,
+    1686, 1689, 1685,
+    1689, 1686, 1690,
+    1691, 1690, 1686,
+    1686, 1683, 1691,
+    1692, 1691, 1683,
+    1683, 1684, 1692,
+    1693, 1684, 1682,
+    1694, 1692, 1684,
+    1684, 1693, 1694,
+    1682, 1060, 1693,
+    1049, 1693, 1060,
+    1695, 1694, 1693,
+    1693, 1049, 1695,
+    1060, 1682, 1061,
+    1048, 1695, 1049,
+    1690, 1696, 1689,
+    1689, 1697, 1688,
+    1697, 1689, 1696,
+    1696, 916, 1697,
+    1698, 916, 915,
+    1699, 1698, 1700,
+    915, 1700, 1698,
+    1700, 915, 1701,
+    1700, 1702, 1699,
+    1702, 1700, 1703,
+    1701, 1703, 1700,
+    1704, 1699, 1702,
+    1702, 1705, 1704,
+    1705, 1702, 1706,
+    1703, 1706, 1702,
+    1706, 1703, 1707,
+    1708, 1707, 1703,
+    1703, 1701, 1708,
+    1706, 1709, 1705,
+    1709, 1706, 1710,
+    1707, 1710, 1706,
+    1705, 1711, 1712,
+    1712, 1704, 1705,
+    1711, 1705, 1709,
+    1709, 1713, 1711,
+    1713, 1709, 1714,
+    1710, 1714, 1709,
+    1714, 1710, 1715,
+    1716, 1715, 1710,
+    1710, 1707, 1716,
+    1717, 1716, 1707,
+    1707, 1708, 1717,
+    1715, 1716, 1718,
+    1719, 1718, 1716,
+    1716, 1717, 1719,
+    1715, 1720, 1714,
+    1720, 1715, 1721,
+    1718, 1721, 1715,
+    1714, 1722, 1713,
+    1722, 1714, 1720,
+    1713, 1723, 1724,
+    1724, 1711, 1713,
+    1723, 1713, 1722,
+    1722, 1725, 1723,
+    1725, 1722, 1726,
+    1720, 1726, 1722,
+    1726, 1720, 1727,
+    1721, 1727, 1720,
+    1727, 1721, 1728,
+    1729, 1728, 1721,
+    1721, 1718, 1729,
+    1730, 1729, 1718,
+    1718, 1719, 1730,
+    1728, 1729, 1731,
+    1732, 1731, 1729,
+    1729, 1730, 1732,
+    1728, 1733, 1727,
+    1733, 1728, 1734,
+    1731, 1734, 1728,
+    1727, 1735, 1726,
+    1735, 1727, 1733,
+    1726, 1736, 1725,
+    1736, 1726, 1735,
+    1735, 131, 1736,
+    131, 1735, 142,
+    1733, 142, 1735,
+    142, 1733, 143,
+    1734, 143, 1733,
+    143, 1734, 1737,
+    1738, 1737, 1734,
+    1734, 1731, 1738,
+    1739, 1738, 1731,
+    1731, 1732, 1739,
+    1737, 1738, 1740,
+    1741, 1740, 1738,
+    1738, 1739, 1741,
+    1737, 144, 143,
+    144, 1737, 1742,
+    1740, 1742, 1737,
+    1742, 1740, 1743,
+    1744, 1743, 1740,
+    1740, 1741, 1744,
+    1742, 145, 144,
+    145, 1742, 1745,
+    1743, 1745, 1742,
+    1745, 147, 145,
+    130, 1736, 131,
+    119, 1746, 130,
+    1736, 130, 1746,
+    1746, 1725, 1736,
+    1746, 119, 1747,
+    1747, 1748, 1746,
+    1725, 1746, 1748,
+    118, 1747, 119,
+    1747, 118, 1749,
+    1749, 1750, 1747,
+    1748, 1747, 1750,
+    1750, 1751, 1748,
+    1723, 1748, 1751,
+    1748, 1723, 1725,
+    1750, 1749, 1752,
+    1752, 1753, 1750,
+    1751, 1750, 1753,
+    1749, 117, 1754,
+    1754, 1752, 1749,
+    117, 1749, 118,
+    117, 106, 1755,
+    1755, 1754, 117,
+    105, 1755, 106,
+    1753, 1756, 1751,
+    1724, 1751, 1756,
+    1751, 1724, 1723,
+    1756, 1757, 1724,
+    1711, 1724, 1757,
+    1757, 1712, 1711,
+    1017, 1758, 1016,
+    1758, 1759, 1760,
+    1760, 1016, 1758,
+    1016, 1760, 1015,
+    1760, 1761, 1762,
+    1762, 1015, 1760,
+    1761, 1760, 1759,
+    1759, 657, 1761,
+    1761, 713, 712,
+    712, 1762, 1761,
+    713, 1761, 657,
+    1762, 712, 711,
+    711, 1014, 1762,
+    1015, 1762, 1014,
+    1014, 711, 710,
+    710, 1013, 1014,
+    1013, 710, 709,
+    709, 1002, 1013,
+    1002, 709, 708,
+    708, 1001, 1002,
+    1001, 708, 707,
+    707, 990, 1001,
+    990, 707, 706,
+    706, 989, 990,
+    989, 706, 705,
+    705, 718, 989,
+    718, 705, 704,
+    657, 714, 713,
+    971, 864, 968,
+    865, 968, 864,
+    968, 865, 969,
+    941, 1763, 942,
+    940, 1764, 941,
+    1763, 941, 1764,
+    1764, 1765, 1763,
+    1764, 940, 1766,
+    1766, 1767, 1764,
+    1765, 1764, 1767,
+    940, 931, 1768,
+    1768, 1766, 940,
+    930, 1768, 931,
+    1767, 1769, 1765,
+    912, 1770, 913,
+    1770, 912, 1771,
+    901, 1771, 912,
+    1771, 1772, 1770,
+    1772, 1771, 1773,
+    1774, 1773, 1771,
+    1771, 901, 1774,
+    900, 1774, 901,
+    1773, 1774, 1775,
+    1776, 1775, 1774,
+    1774, 900, 1776,
+    1773, 1777, 1772,
+    1777, 1773, 1778,
+    1775, 1778, 1773,
+    1778, 1775, 1779,
+    1780, 1779, 1775,
+    1775, 1776, 1780,
+    889, 1776, 900,
+    1781, 1780, 1776,
+    1776, 889, 1781,
+    1779, 1780, 1782,
+    1783, 1782, 1780,
+    1780, 1781, 1783,
+    1779, 1784, 1778,
+    1784, 1779, 1785,
+    1782, 1785, 1779,
+    1778, 1786, 1777,
+    1786, 1778, 1784,
+    1784, 1787, 1786,
+    1787, 1784, 1788,
+    1785, 1788, 1784,
+    1788, 1785, 1789,
+    1790, 1789, 1785,
+    1785, 1782, 1790,
+    1791, 1790, 1782,
+    1782, 1783, 1791,
+    1792, 1783, 1781,
+    1793, 1791, 1783,
+    1783, 1792, 1793,
+    1781, 888, 1792,
+    877, 1792, 888,
+    1794, 1793, 1792,
+    1792, 877, 1794,
+    888, 1781, 889,
+    876, 1794, 877,
+    1789, 375, 1788,
+    1788, 376, 1787,
+    376, 1788, 375,
+    858, 1795, 857,
+    1795, 1796, 740,
+    740, 857, 1795,
+    857, 740, 739,
+    729, 740, 1796,
+    1796, 730, 729,
+    540, 1797, 537,
+    1798, 537, 1797,
+    1797, 1799, 1798,
+    537, 1798, 538,
+    520, 1800, 505,
+    1800, 520, 1801,
+    1800, 452, 503,
+    503, 505, 1800,
+    452, 1800, 442,
+    1801, 442, 1800,
+    442, 1801, 440,
+    454, 503, 452,
+    379, 1802, 378,
+    1802, 379, 1803,
+    1802, 1804, 1805,
+    1805, 378, 1802,
+    1804, 1802, 1806,
+    1803, 1806, 1802,
+    1806, 1803, 1807,
+    1806, 1808, 1804,
+    1808, 1806, 1809,
+    1807, 1809, 1806,
+    1804, 1810, 1811,
+    1811, 1805, 1804,
+    1810, 1804, 1808,
+    1808, 1812, 1810,
+    1812, 1808, 1813,
+    1809, 1813, 1808,
+    1813, 1809, 1814,
+    1815, 1814, 1809,
+    1809, 1807, 1815,
+    1813, 1816, 1812,
+    1816, 1813, 1817,
+    1814, 1817, 1813,
+    1812, 1818, 1819,
+    1819, 1810, 1812,
+    1818, 1812, 1816,
+    1810, 1819, 1820,
+    1820, 1811, 1810,
+    1811, 1821, 1822,
+    1822, 1823, 1811,
+    1824, 1811, 1823,
+    1821, 1825, 1826,
+    1826, 1822, 1821,
+    1822, 1826, 1827,
+    1827, 1828, 1822,
+    1823, 1822, 1828,
+    1828, 1829, 1823,
+    1830, 1823, 1829,
+    1823, 1830, 1824,
+    1831, 1824, 1830,
+    1829, 1832, 1830,
+    1833, 1830, 1832,
+    1830, 1833, 1831,
+    1829, 1828, 1834,
+    1834, 1835, 1829,
+    1832, 1829, 1835,
+    1828, 1827, 1836,
+    1836, 1834, 1828,
+    1827, 1837, 1838,
+    1838, 1836, 1827,
+    1837, 1827, 1826,
+    1836, 1838, 1839,
+    1839, 1840, 1836,
+    1834, 1836, 1840,
+    1840, 1841, 1834,
+    1835, 1834, 1841,
+    1841, 1842, 1835,
+    1843, 1835, 1842,
+    1835, 1843, 1832,
+    1844, 1832, 1843,
+    1832, 1844, 1833,
+    1842, 1845, 1843,
+    1846, 1843, 1845,
+    1843, 1846, 1844,
+    1842, 1841, 1847,
+    1847, 1848, 1842,
+    1845, 1842, 1848,
+    1841, 1840, 1849,
+    1849, 1847, 1841,
+    1840, 1839, 1850,
+    1850, 1849, 1840,
+    1849, 1850, 1851,
+    1851, 1852, 1849,
+    1847, 1849, 1852,
+    1852, 1853, 1847,
+    1848, 1847, 1853,
+    1853, 1854, 1848,
+    1855, 1848, 1854,
+    1848, 1855, 1845,
+    1856, 1845, 1855,
+    1845, 1856, 1846,
+    1854, 1857, 1855,
+    1858, 1855, 1857,
+    1855, 1858, 1856,
+    1854, 1853, 1859,
+    1859, 1860, 1854,
+    1857, 1854, 1860,
+    1853, 1852, 1861,
+    1861, 1859, 1853,
+    1852, 1851, 1862,
+    1862, 1861, 1852,
+    1861, 1862, 1863,
+    1863, 1864, 1861,
+    1859, 1861, 1864,
+    1864, 1865, 1859,
+    1860, 1859, 1865,
+    1865, 1866, 1860,
+    1867, 1860, 1866,
+    1860, 1867, 1857,
+    1868, 1857, 1867,
+    1857, 1868, 1858,
+    1866, 1869, 1867,
+    1870, 1867, 1869,
+    1867, 1870, 1868,
+    1866, 1865, 1871,
+    1871, 1872, 1866,
+    1869, 1866, 1872,
+    1865, 1864, 1873,
+    1873, 1871, 1865,
+    1864, 1863, 1874,
+    1874, 1873, 1864,
+    1873, 1874, 1875,
+    1875, 1876, 1873,
+    1871, 1873, 1876,
+    1876, 1877, 1871,
+    1872, 1871, 1877,
+    1877, 1878, 1872,
+    1879, 1872, 1878,
+    1872, 1879, 1869,
+    1880, 1869, 1879,
+    1869, 1880, 1870,
+    1878, 1881, 1879,
+    1882, 1879, 1881,
+    1879, 1882, 1880,
+    1878, 1883, 1884,
+    1884, 1885, 1878,
+    1886, 1878, 1885,
+    1883, 1887, 1888,
+    1888, 1884, 1883,
+    1884, 1888, 1889,
+    1889, 1890, 1884,
+    1885, 1884, 1890,
+    1890, 1891, 1885,
+    1892, 1885, 1891,
+    1885, 1892, 1886,
+    1893, 1886, 1892,
+    1891, 1894, 1892,
+    1895, 1892, 1894,
+    1892, 1895, 1893,
+    1891, 1890, 1896,
+    1896, 1897, 1891,
+    1894, 1891, 1897,
+    1890, 1889, 1898,
+    1898, 1896, 1890,
+    1889, 1899, 1900,
+    1900, 1898, 1889,
+    1899, 1889, 1888,
+    1898, 1900, 1901,
+    1901, 1902, 1898,
+    1896, 1898, 1902,
+    1902, 1903, 1896,
+    1897, 1896, 1903,
+    1903, 1904, 1897,
+    1905, 1897, 1904,
+    1897, 1905, 1894,
+    1906, 1894, 1905,
+    1894, 1906, 1895,
+    1904, 1907, 1905,
+    1908, 1905, 1907,
+    1905, 1908, 1906,
+    1904, 1903, 1909,
+    1909, 1910, 1904,
+    1907, 1904, 1910,
+    1903, 1902, 1911,
+    1911, 1909, 1903,
+    1902, 1901, 1912,
+    1912, 1911, 1902,
+    1911, 1912, 1913,
+    1913, 1914, 1911,
+    1909, 1911, 1914,
+    1914, 1915, 1909,
+    1910, 1909, 1915,
+    1915, 1916, 1910,
+    1917, 1910, 1916,
+    1910, 1917, 1907,
+    1918, 1907, 1917,
+    1907, 1918, 1908,
+    1916, 1817, 1917,
+    1919, 1917, 1817,
+    1917, 1919, 1918,
+    1916, 1915, 1920,
+    1920, 1816, 1916,
+    1817, 1916, 1816,
+    1915, 1914, 1921,
+    1921, 1920, 1915,
+    1914, 1913, 1922,
+    1922, 1921, 1914,
+    1921, 1922, 1923,
+    1923, 1924, 1921,
+    1920, 1921, 1924,
+    1924, 1818, 1920,
+    1816, 1920, 1818,
+    1924, 1923, 1925,
+    1925, 1926, 1924,
+    1818, 1924, 1926,
+    1923, 1927, 1928,
+    1928, 1925, 1923,
+    1927, 1923, 1922,
+    1922, 1929, 1927,
+    1929, 1922, 1913,
+    1927, 1930, 1931,
+    1931, 1928, 1927,
+    1930, 1927, 1929,
+    1928, 1931, 1932,
+    1932, 1933, 1928,
+    1925, 1928, 1933,
+    1933, 1934, 1925,
+    1926, 1925, 1934,
+    1934, 1935, 1926,
+    1819, 1926, 1935,
+    1926, 1819, 1818,
+    1934, 1933, 1936,
+    1936, 1937, 1934,
+    1825, 1934, 1937,
+    1933, 1938, 1939,
+    1939, 1936, 1933,
+    1936, 1939, 1940,
+    1940, 1941, 1936,
+    1937, 1936, 1941,
+    1941, 1837, 1937,
+    1826, 1937, 1837,
+    1937, 1826, 1825,
+    1941, 1940, 1942,
+    1942, 1943, 1941,
+    1837, 1941, 1943,
+    1940, 1944, 1945,
+    1945, 1942, 1940,
+    1944, 1940, 1939,
+    1939, 1946, 1944,
+    1946, 1939, 1938,
+    1938, 1947, 1946,
+    1946, 1948, 1949,
+    1949, 1944, 1946,
+    1948, 1946, 1947,
+    1944, 1949, 1950,
+    1950, 1945, 1944,
+    1945, 1950, 1951,
+    1951, 1952, 1945,
+    1942, 1945, 1952,
+    1952, 1953, 1942,
+    1943, 1942, 1953,
+    1952, 1951, 1954,
+    1954, 1955, 1952,
+    1953, 1952, 1955,
+    1951, 1956, 1957,
+    1957, 1954, 1951,
+    1956, 1951, 1950,
+    1950, 1958, 1956,
+    1958, 1950, 1949,
+    1949, 1959, 1958,
+    1959, 1949, 1948,
+    1958, 1960, 1961,
+    1961, 1956, 1958,
+    1960, 1958, 1959,
+    1956, 1961, 1962,
+    1962, 1957, 1956,
+    1957, 1962, 1963,
+    1963, 1964, 1957,
+    1954, 1957, 1964,
+    1964, 1965, 1954,
+    1955, 1954, 1965,
+    1964, 1963, 1966,
+    1966, 1967, 1964,
+    1965, 1964, 1967,
+    1963, 1968, 1969,
+    1969, 1966, 1963,
+    1968, 1963, 1962,
+    1962, 1970, 1968,
+    1970, 1962, 1961,
+    1961, 1971, 1970,
+    1971, 1961, 1960,
+    1970, 1972, 1973,
+    1973, 1968, 1970,
+    1972, 1970, 1971,
+    1968, 1973, 1974,
+    1974, 1969, 1968,
+    1969, 1974, 1975,
+    1975, 1976, 1969,
+    1966, 1969, 1976,
+    1976, 1977, 1966,
+    1967, 1966, 1977,
+    1976, 1975, 1978,
+    1978, 1979, 1976,
+    1977, 1976, 1979,
+    1975, 1980, 1981,
+    1981, 1978, 1975,
+    1980, 1975, 1974,
+    1974, 1982, 1980,
+    1982, 1974, 1973,
+    1973, 1983, 1982,
+    1983, 1973, 1972,
+    1982, 1984, 1985,
+    1985, 1980, 1982,
+    1984, 1982, 1983,
+    1980, 1985, 1986,
+    1986, 1981, 1980,
+    1981, 1986, 1987,
+    1987, 1988, 1981,
+    1978, 1981, 1988,
+    1988, 1989, 1978,
+    1979, 1978, 1989,
+    1988, 1990, 1991,
+    1991, 1992, 1988,
+    1993, 1988, 1992,
+    1990, 1994, 1995,
+    1995, 1991, 1990,
+    1991, 1995, 1996,
+    1996, 1997, 1991,
+    1992, 1991, 1997,
+    1997, 1998, 1992,
+    1999, 1992, 1998,
+    1992, 1999, 1993,
+    2000, 1993, 1999,
+    1998, 2001, 1999,
+    2002, 1999, 2001,
+    1999, 2002, 2000,
+    1998, 1997, 2003,
+    2003, 2004, 1998,
+    2001, 1998, 2004,
+    1997, 1996, 2005,
+    2005, 2003, 1997,
+    1996, 2006, 2007,
+    2007, 2005, 1996,
+    2006, 1996, 1995,
+    2005, 2007, 2008,
+    2008, 2009, 2005,
+    2003, 2005, 2009,
+    2009, 2010, 2003,
+    2004, 2003, 2010,
+    2010, 2011, 2004,
+    2012, 2004, 2011,
+    2004, 2012, 2001,
+    2013, 2001, 2012,
+    2001, 2013, 2002,
+    2011, 2014, 2012,
+    2015, 2012, 2014,
+    2012, 2015, 2013,
+    2011, 2010, 2016,
+    2016, 2017, 2011,
+    2014, 2011, 2017,
+    2010, 2009, 2018,
+    2018, 2016, 2010,
+    2009, 2008, 2019,
+    2019, 2018, 2009,
+    2018, 2019, 2020,
+    2020, 2021, 2018,
+    2016, 2018, 2021,
+    2021, 2022, 2016,
+    2017, 2016, 2022,
+    2022, 2023, 2017,
+    2024, 2017, 2023,
+    2017, 2024, 2014,
+    2025, 2014, 2024,
+    2014, 2025, 2015,
+    2023, 2026, 2024,
+    2027, 2024, 2026,
+    2024, 2027, 2025,
+    2023, 2022, 2028,
+    2028, 2029, 2023,
+    2026, 2023, 2029,
+    2022, 2021, 2030,
+    2030, 2028, 2022,
+    2021, 2020, 2031,
+    2031, 2030, 2021,
+    2030, 2031, 2032,
+    2032, 2033, 2030,
+    2028, 2030, 2033,
+    2033, 2034, 2028,
+    2029, 2028, 2034,
+    2034, 2035, 2029,
+    2036, 2029, 2035,
+    2029, 2036, 2026,
+    2037, 2026, 2036,
+    2026, 2037, 2027,
+    2035, 2038, 2036,
+    2039, 2036, 2038,
+    2036, 2039, 2037,
+    2035, 2034, 2040,
+    2040, 2041, 2035,
+    2038, 2035, 2041,
+    2034, 2033, 2042,
+    2042, 2040, 2034,
+    2033, 2032, 2043,
+    2043, 2042, 2033,
+    2042, 2043, 2044,
+    2044, 2045, 2042,
+    2040, 2042, 2045,
+    2045, 2046, 2040,
+    2041, 2040, 2046,
+    2046, 2047, 2041,
+    2048, 2041, 2047,
+    2041, 2048, 2038,
+    2049, 2038, 2048,
+    2038, 2049, 2039,
+    2047, 2050, 2048,
+    2051, 2048, 2050,
+    2048, 2051, 2049,
+    2052, 2049, 2051,
+    2053, 2039, 2049,
+    2049, 2052, 2053,
+    2050, 2054, 2051,
+    2055, 2051, 2054,
+    2051, 2055, 2052,
+    2056, 2052, 2055,
+    2057, 2053, 2052,
+    2052, 2056, 2057,
+    2039, 2053, 2058,
+    2059, 2058, 2053,
+    2053, 2057, 2059,
+    2060, 2057, 2056,
+    2061, 2059, 2057,
+    2057, 2060, 2061,
+    2055, 2062, 2056,
+    2063, 2056, 2062,
+    2056, 2063, 2060,
+    2054, 2064, 2055,
+    2062, 2055, 2064,
+    2064, 2065, 2062,
+    2066, 2062, 2065,
+    2062, 2066, 2063,
+    2067, 2063, 2066,
+    2068, 2060, 2063,
+    2063, 2067, 2068,
+    2069, 2061, 2060,
+    2060, 2068, 2069,
+    2059, 2061, 2070,
+    2071, 2070, 2061,
+    2061, 2069, 2071,
+    2072, 2069, 2068,
+    2073, 2071, 2069,
+    2069, 2072, 2073,
+    2074, 2068, 2067,
+    2068, 2074, 2072,
+    2066, 2075, 2067,
+    1930, 2067, 2075,
+    2067, 1930, 2074,
+    2065, 2076, 2066,
+    2075, 2066, 2076,
+    2076, 1947, 2075,
+    1931, 2075, 1947,
+    2075, 1931, 1930,
+    1929, 2074, 1930,
+    2077, 2072, 2074,
+    2074, 1929, 2077,
+    2078, 2073, 2072,
+    2072, 2077, 2078,
+    2071, 2073, 2079,
+    2080, 2079, 2073,
+    2073, 2078, 2080,
+    1912, 2078, 2077,
+    1901, 2080, 2078,
+    2078, 1912, 1901,
+    1913, 2077, 1929,
+    2077, 1913, 1912,
+    2080, 1901, 1900,
+    2079, 2080, 2081,
+    1900, 2081, 2080,
+    2079, 2082, 2071,
+    2082, 2079, 2083,
+    2081, 2083, 2079,
+    2083, 2081, 2084,
+    1899, 2084, 2081,
+    2081, 1900, 1899,
+    2083, 2085, 2082,
+    2085, 2083, 2086,
+    2084, 2086, 2083,
+    2082, 2087, 2070,
+    2070, 2071, 2082,
+    2087, 2082, 2085,
+    2085, 2088, 2087,
+    2088, 2085, 2089,
+    2086, 2089, 2085,
+    2089, 2086, 2090,
+    2091, 2090, 2086,
+    2086, 2084, 2091,
+    2092, 2091, 2084,
+    2084, 1899, 2092,
+    1888, 2092, 1899,
+    2091, 2092, 1875,
+    1887, 1875, 2092,
+    2092, 1888, 1887,
+    2090, 2091, 2093,
+    1875, 2093, 2091,
+    2090, 2094, 2089,
+    2094, 2090, 2095,
+    2093, 2095, 2090,
+    2089, 2096, 2088,
+    2096, 2089, 2094,
+    2094, 2097, 2096,
+    2097, 2094, 2098,
+    2095, 2098, 2094,
+    2096, 2099, 2100,
+    2100, 2088, 2096,
+    2099, 2096, 2097,
+    2097, 2101, 2099,
+    2101, 2097, 2102,
+    2098, 2102, 2097,
+    2102, 2098, 2103,
+    2104, 2103, 2098,
+    2098, 2105, 2104,
+    2102, 2106, 2101,
+    2107, 2102, 2108,
+    2103, 2108, 2102,
+    2101, 2109, 2110,
+    2110, 2099, 2101,
+    2109, 2101, 2106,
+    2099, 2110, 2111,
+    2111, 2100, 2099,
+    2110, 2013, 2015,
+    2015, 2111, 2110,
+    2013, 2110, 2109,
+    2109, 2002, 2013,
+    2002, 2109, 2112,
+    2106, 2112, 2109,
+    2112, 2000, 2002,
+    2000, 2112, 2113,
+    2114, 2113, 2112,
+    2112, 2107, 2114,
+    2108, 2114, 2107,
+    2113, 2114, 2115,
+    2116, 2115, 2114,
+    2114, 2108, 2116,
+    2113, 1979, 2000,
+    1979, 2113, 1977,
+    2115, 1977, 2113,
+    1989, 2000, 1979,
+    1977, 2115, 1967,
+    2117, 1967, 2115,
+    2115, 2116, 2117,
+    2118, 2116, 2108,
+    2119, 2117, 2116,
+    2116, 2118, 2119,
+    1967, 2117, 1965,
+    2120, 1965, 2117,
+    2117, 2119, 2120,
+    2121, 2119, 2118,
+    2122, 2120, 2119,
+    2119, 2121, 2122,
+    2108, 2103, 2118,
+    2123, 2118, 2103,
+    2118, 2123, 2121,
+    2124, 2121, 2123,
+    2125, 2122, 2121,
+    2121, 2124, 2125,
+    2120, 2122, 2126,
+    2127, 2126, 2122,
+    2122, 2125, 2127,
+    1965, 2120, 1955,
+    2126, 1955, 2120,
+    1955, 2126, 1953,
+    2128, 1953, 2126,
+    2126, 2127, 2128,
+    1850, 2127, 2125,
+    1839, 2128, 2127,
+    2127, 1850, 1839,
+    1851, 2125, 2124,
+    2125, 1851, 1850,
+    2123, 2129, 2124,
+    1862, 2124, 2129,
+    2124, 1862, 1851,
+    2129, 2123, 2104,
+    2104, 2130, 2129,
+    1863, 2129, 2130,
+    2129, 1863, 1862,
+    2103, 2104, 2123,
+    2130, 2104, 2105,
+    2105, 2131, 2130,
+    1874, 2130, 2131,
+    2130, 1874, 1863,
+    2131, 1875, 1874,
+    2128, 1839, 1838,
+    1838, 1943, 2128,
+    1943, 1838, 1837,
+    1953, 2128, 1943,
+    2111, 2015, 2025,
+    2025, 2132, 2111,
+    2100, 2111, 2132,
+    2132, 2025, 2027,
+    2027, 2133, 2132,
+    2134, 2132, 2133,
+    2132, 2134, 2100,
+    2088, 2100, 2134,
+    2133, 2135, 2134,
+    2087, 2134, 2135,
+    2134, 2087, 2088,
+    2133, 2027, 2037,
+    2037, 2058, 2133,
+    2135, 2133, 2058,
+    2058, 2059, 2135,
+    2070, 2135, 2059,
+    2135, 2070, 2087,
+    2058, 2037, 2039,
+    1947, 1932, 1931,
+    1947, 2076, 1948,
+    2076, 2136, 2137,
+    2137, 1948, 2076,
+    1948, 2137, 1959,
+    2137, 2138, 2139,
+    2139, 1959, 2137,
+    2138, 2137, 2136,
+    2136, 2140, 2138,
+    2138, 2141, 2142,
+    2142, 2139, 2138,
+    2141, 2138, 2140,
+    2139, 2142, 2143,
+    2143, 1960, 2139,
+    1959, 2139, 1960,
+    2142, 2144, 2145,
+    2145, 2143, 2142,
+    2144, 2142, 2141,
+    2141, 2146, 2144,
+    2146, 2141, 2054,
+    2140, 2054, 2141,
+    2144, 2147, 2148,
+    2148, 2145, 2144,
+    2147, 2144, 2146,
+    2145, 2148, 2149,
+    2149, 2150, 2145,
+    2143, 2145, 2150,
+    2150, 1971, 2143,
+    1960, 2143, 1971,
+    2150, 2149, 2151,
+    2151, 1972, 2150,
+    1971, 2150, 1972,
+    2149, 2152, 2153,
+    2153, 2151, 2149,
+    2152, 2149, 2148,
+    2148, 2154, 2152,
+    2154, 2148, 2147,
+    2147, 2155, 2154,
+    2155, 2147, 2156,
+    2146, 2156, 2147,
+    2154, 2157, 2158,
+    2158, 2152, 2154,
+    2157, 2154, 2155,
+    2152, 2158, 2159,
+    2159, 2153, 2152,
+    2153, 2159, 2160,
+    2160, 2161, 2153,
+    2151, 2153, 2161,
+    2161, 1983, 2151,
+    1972, 2151, 1983,
+    2161, 2160, 2162,
+    2162, 1984, 2161,
+    1983, 2161, 1984,
+    2160, 2163, 2164,
+    2164, 2162, 2160,
+    2163, 2160, 2159,
+    2159, 2165, 2163,
+    2165, 2159, 2158,
+    2158, 2166, 2165,
+    2166, 2158, 2157,
+    2165, 2167, 2168,
+    2168, 2163, 2165,
+    2167, 2165, 2166,
+    2163, 2168, 2169,
+    2169, 2164, 2163,
+    2164, 2169, 2170,
+    2170, 2171, 2164,
+    2162, 2164, 2171,
+    2171, 2172, 2162,
+    1984, 2162, 2172,
+    2172, 1985, 1984,
+    2172, 2171, 2173,
+    2173, 2174, 2172,
+    1985, 2172, 2174,
+    2171, 2170, 2175,
+    2175, 2173, 2171,
+    2170, 2176, 2177,
+    2177, 2175, 2170,
+    2176, 2170, 2169,
+    2169, 2178, 2176,
+    2178, 2169, 2168,
+    2168, 2179, 2178,
+    2179, 2168, 2167,
+    2167, 2180, 2179,
+    2181, 2182, 2180,
+    2180, 2167, 2181,
+    2182, 2181, 2183,
+    2166, 2181, 2167,
+    2184, 2183, 2181,
+    2181, 2166, 2184,
+    2183, 2185, 2182,
+    2185, 2183, 2186,
+    2187, 2186, 2183,
+    2183, 2184, 2187,
+    2157, 2184, 2166,
+    2188, 2187, 2184,
+    2184, 2157, 2188,
+    2186, 2187, 2189,
+    2190, 2189, 2187,
+    2187, 2188, 2190,
+    2186, 2191, 2185,
+    2191, 2186, 2192,
+    2189, 2192, 2186,
+    2192, 2189, 2193,
+    2045, 2193, 2189,
+    2189, 2190, 2045,
+    2194, 2190, 2188,
+    2195, 2045, 2190,
+    2190, 2194, 2195,
+    2155, 2188, 2157,
+    2188, 2155, 2194,
+    2156, 2194, 2155,
+    2196, 2195, 2194,
+    2194, 2156, 2196,
+    2197, 2196, 2156,
+    2156, 2146, 2197,
+    2054, 2197, 2146,
+    2193, 2198, 2192,
+    2192, 2199, 2191,
+    2199, 2192, 2198,
+    2200, 2198, 2201,
+    2043, 2201, 2198,
+    2198, 2044, 2043,
+    2198, 2200, 2199,
+    2201, 2202, 2200,
+    2202, 2201, 2203,
+    2032, 2203, 2201,
+    2201, 2043, 2032,
+    2203, 2204, 2202,
+    2204, 2203, 2205,
+    2031, 2205, 2203,
+    2203, 2032, 2031,
+    2205, 2206, 2204,
+    2206, 2205, 2207,
+    2020, 2207, 2205,
+    2205, 2031, 2020,
+    2207, 2208, 2206,
+    2208, 2207, 2209,
+    2019, 2209, 2207,
+    2207, 2020, 2019,
+    2209, 2210, 2208,
+    2210, 2209, 2211,
+    2008, 2211, 2209,
+    2209, 2019, 2008,
+    2211, 2212, 2210,
+    2212, 2211, 2213,
+    2007, 2213, 2211,
+    2211, 2008, 2007,
+    2213, 2214, 2212,
+    2214, 2213, 2215,
+    2006, 2215, 2213,
+    2213, 2007, 2006,
+    2215, 2216, 2214,
+    2216, 2215, 2217,
+    2218, 2217, 2215,
+    2215, 2006, 2218,
+    1995, 2218, 2006,
+    2217, 2218, 2219,
+    1994, 2219, 2218,
+    2218, 1995, 1994,
+    2217, 2220, 2216,
+    2220, 2217, 2221,
+    2219, 2221, 2217,
+    2221, 2222, 2220,
+    2222, 2221, 2175,
+    2173, 2175, 2221,
+    2221, 2223, 2173,
+    2175, 2177, 2222,
+    2174, 2173, 2223,
+    2223, 1994, 2174,
+    1986, 2174, 1994,
+    1994, 1987, 1986,
+    2174, 1986, 1985,
+    1935, 1820, 1819,
+    1817, 1814, 1919,
+    2224, 1919, 1814,
+    1814, 1815, 2224,
+    2225, 1918, 1919,
+    1919, 2224, 2225,
+    1918, 2225, 2226,
+    2226, 1908, 1918,
+    1908, 2226, 2227,
+    2227, 1906, 1908,
+    1906, 2227, 2228,
+    2228, 1895, 1906,
+    1895, 2228, 2229,
+    2229, 1893, 1895,
+    2230, 1880, 1882,
+    2231, 1870, 1880,
+    1880, 2230, 2231,
+    1882, 2232, 2230,
+    1881, 2233, 1882,
+    2232, 1882, 2233,
+    2233, 2234, 2232,
+    1870, 2231, 2235,
+    2235, 1868, 1870,
+    1868, 2235, 2236,
+    2236, 1858, 1868,
+    1858, 2236, 2237,
+    2237, 1856, 1858,
+    1856, 2237, 2238,
+    2238, 1846, 1856,
+    1846, 2238, 2239,
+    2239, 1844, 1846,
+    1844, 2239, 2240,
+    2240, 1833, 1844,
+    1833, 2240, 2241,
+    2241, 1831, 1833,
+    2242, 363, 362,
+    2243, 2242, 2244,
+    362, 2244, 2242,
+    2244, 362, 351,
+    2244, 2245, 2243,
+    2245, 2244, 2246,
+    351, 2246, 2244,
+    2247, 2243, 2245,
+    2245, 2248, 2247,
+    2248, 2245, 2249,
+    2246, 2249, 2245,
+    2249, 2246, 2250,
+    350, 2250, 2246,
+    2246, 351, 350,
+    2249, 2251, 2248,
+    2251, 2249, 2252,
+    2250, 2252, 2249,
+    2248, 2253, 2254,
+    2254, 2247, 2248,
+    2253, 2248, 2251,
+    2251, 282, 2253,
+    282, 2251, 283,
+    2252, 283, 2251,
+    283, 2252, 294,
+    2255, 294, 2252,
+    2252, 2250, 2255,
+    349, 2255, 2250,
+    2250, 350, 349,
+    294, 2255, 295,
+    2256, 295, 2255,
+    2255, 349, 2256,
+    338, 2256, 349,
+    295, 2256, 306,
+    327, 306, 2256,
+    2256, 338, 327,
+    306, 327, 307,
+    270, 2253, 282,
+    269, 2257, 270,
+    2253, 270, 2257,
+    2257, 2254, 2253,
+    2258, 258, 257,
+    257, 166, 2258,
+    167, 2258, 166,
+    256, 168, 257,
+    166, 257, 168,
+    255, 177, 256,
+    168, 256, 177,
+    255, 228, 218,
+    218, 178, 255,
+    177, 255, 178,
+    178, 218, 187,
+    194, 59, 99,
+    2259, 2260, 2261,
+    2261, 2262, 2259,
+    2260, 2259, 2263,
+    2264, 2259, 2262,
+    2265, 2263, 2259,
+    2259, 2264, 2265,
+    2263, 2266, 2260,
+    2266, 2263, 2267,
+    2268, 2267, 2263,
+    2263, 2265, 2268,
+    2269, 2265, 2264,
+    2270, 2268, 2265,
+    2265, 2269, 2270,
+    2262, 2271, 2264,
+    2272, 2264, 2271,
+    2264, 2272, 2269,
+    2273, 2269, 2272,
+    2274, 2270, 2269,
+    2269, 2273, 2274,
+    2268, 2270, 2275,
+    2276, 2275, 2270,
+    2270, 2274, 2276,
+    2267, 2268, 2277,
+    2275, 2277, 2268,
+    2277, 2275, 2278,
+    2279, 2278, 2275,
+    2275, 2276, 2279,
+    2280, 2276, 2274,
+    2281, 2279, 2276,
+    2276, 2280, 2281,
+    2282, 2274, 2273,
+    2274, 2282, 2280,
+    2272, 2283, 2273,
+    2284, 2273, 2283,
+    2273, 2284, 2282,
+    2285, 2282, 2284,
+    2286, 2280, 2282,
+    2282, 2285, 2286,
+    2287, 2281, 2280,
+    2280, 2286, 2287,
+    2279, 2281, 2288,
+    2289, 2288, 2281,
+    2281, 2287, 2289,
+    2278, 2279, 2290,
+    2288, 2290, 2279,
+    2290, 2288, 2291,
+    2292, 2291, 2288,
+    2288, 2289, 2292,
+    2293, 2289, 2287,
+    2294, 2292, 2289,
+    2289, 2293, 2294,
+    2295, 2287, 2286,
+    2287, 2295, 2293,
+    2296, 2286, 2285,
+    2286, 2296, 2295,
+    2297, 2295, 2296,
+    2298, 2293, 2295,
+    2295, 2297, 2298,
+    2299, 2294, 2293,
+    2293, 2298, 2299,
+    2292, 2294, 2300,
+    2301, 2300, 2294,
+    2294, 2299, 2301,
+    2291, 2292, 2302,
+    2300, 2302, 2292,
+    2302, 2300, 2303,
+    2304, 2303, 2300,
+    2300, 2301, 2304,
+    2305, 2301, 2299,
+    2306, 2304, 2301,
+    2301, 2305, 2306,
+    2307, 2299, 2298,
+    2299, 2307, 2305,
+    2308, 2298, 2297,
+    2298, 2308, 2307,
+    2309, 2307, 2308,
+    2310, 2305, 2307,
+    2307, 2309, 2310,
+    2311, 2306, 2305,
+    2305, 2310, 2311,
+    2304, 2306, 2312,
+    2313, 2312, 2306,
+    2306, 2311, 2313,
+    2303, 2304, 2314,
+    2312, 2314, 2304,
+    2314, 2315, 2303,
+    2316, 2314, 2317,
+    2318, 2317, 2314,
+    2314, 2319, 2318,
+    2315, 2320, 2321,
+    2321, 2303, 2315,
+    2320, 2322, 2323,
+    2323, 2321, 2320,
+    2321, 2323, 2324,
+    2324, 2302, 2321,
+    2303, 2321, 2302,
+    2323, 2325, 2326,
+    2326, 2324, 2323,
+    2325, 2323, 2322,
+    2322, 2327, 2325,
+    2325, 2328, 2329,
+    2329, 2326, 2325,
+    2328, 2325, 2327,
+    2326, 2329, 2330,
+    2330, 2331, 2326,
+    2324, 2326, 2331,
+    2331, 2291, 2324,
+    2302, 2324, 2291,
+    2331, 2330, 2332,
+    2332, 2290, 2331,
+    2291, 2331, 2290,
+    2330, 2333, 2334,
+    2334, 2332, 2330,
+    2333, 2330, 2329,
+    2329, 2335, 2333,
+    2335, 2329, 2328,
+    2328, 2336, 2335,
+    2336, 2328, 2337,
+    2327, 2337, 2328,
+    2335, 2338, 2339,
+    2339, 2333, 2335,
+    2338, 2335, 2336,
+    2333, 2339, 2340,
+    2340, 2334, 2333,
+    2334, 2340, 2341,
+    2341, 2342, 2334,
+    2332, 2334, 2342,
+    2342, 2278, 2332,
+    2290, 2332, 2278,
+    2342, 2341, 2343,
+    2343, 2277, 2342,
+    2278, 2342, 2277,
+    2341, 2344, 2345,
+    2345, 2343, 2341,
+    2344, 2341, 2340,
+    2340, 2346, 2344,
+    2346, 2340, 2339,
+    2339, 2347, 2346,
+    2347, 2339, 2338,
+    2338, 2348, 2347,
+    2349, 2350, 2348,
+    2348, 2338, 2349,
+    2350, 2349, 2351,
+    2336, 2349, 2338,
+    2352, 2351, 2349,
+    2349, 2336, 2352,
+    2351, 2353, 2350,
+    2337, 2352, 2336,
+    2343, 2345, 2354,
+    2354, 2267, 2343,
+    2277, 2343, 2267,
+    2267, 2354, 2266,
+    2317, 2318, 2355,
+    2356, 2318, 2319,
+    2357, 2355, 2318,
+    2318, 2356, 2357,
+    2317, 2358, 2316,
+    2358, 2317, 2359,
+    2355, 2359, 2317,
+    2359, 2355, 2360,
+    2361, 2360, 2355,
+    2355, 2357, 2361,
+    2362, 2357, 2356,
+    2363, 2361, 2357,
+    2357, 2362, 2363,
+    2319, 2364, 2356,
+    2365, 2356, 2364,
+    2356, 2365, 2362,
+    2366, 2362, 2365,
+    2367, 2363, 2362,
+    2362, 2366, 2367,
+    2361, 2363, 2368,
+    2369, 2368, 2363,
+    2363, 2367, 2369,
+    2360, 2361, 2370,
+    2368, 2370, 2361,
+    2370, 2368, 2371,
+    2372, 2371, 2368,
+    2368, 2369, 2372,
+    2373, 2369, 2367,
+    2374, 2372, 2369,
+    2369, 2373, 2374,
+    2375, 2367, 2366,
+    2367, 2375, 2373,
+    2365, 2376, 2366,
+    2377, 2366, 2376,
+    2366, 2377, 2375,
+    2378, 2375, 2377,
+    2379, 2373, 2375,
+    2375, 2378, 2379,
+    2380, 2374, 2373,
+    2373, 2379, 2380,
+    2372, 2374, 2381,
+    2382, 2381, 2374,
+    2374, 2380, 2382,
+    2371, 2372, 2383,
+    2381, 2383, 2372,
+    2383, 2381, 2384,
+    2385, 2384, 2381,
+    2381, 2382, 2385,
+    2386, 2382, 2380,
+    2387, 2385, 2382,
+    2382, 2386, 2387,
+    2388, 2380, 2379,
+    2380, 2388, 2386,
+    2389, 2379, 2378,
+    2379, 2389, 2388,
+    2390, 2388, 2389,
+    2391, 2386, 2388,
+    2388, 2390, 2391,
+    2392, 2387, 2386,
+    2386, 2391, 2392,
+    2385, 2387, 2393,
+    2394, 2393, 2387,
+    2387, 2392, 2394,
+    2384, 2385, 2395,
+    2393, 2395, 2385,
+    2395, 2393, 2396,
+    2397, 2396, 2393,
+    2393, 2394, 2397,
+    2398, 2394, 2392,
+    2399, 2397, 2394,
+    2394, 2398, 2399,
+    2400, 2392, 2391,
+    2392, 2400, 2398,
+    2401, 2391, 2390,
+    2391, 2401, 2400,
+    2402, 2400, 2401,
+    2403, 2398, 2400,
+    2400, 2402, 2403,
+    2404, 2399, 2398,
+    2398, 2403, 2404,
+    2397, 2399, 2405,
+    2406, 2405, 2399,
+    2399, 2404, 2406,
+    2396, 2397, 2407,
+    2405, 2407, 2397,
+    2407, 2408, 2396,
+    2408, 2409, 2410,
+    2410, 2396, 2408,
+    2411, 2409, 2412,
+    2413, 2412, 2409,
+    2409, 2414, 2413,
+    2409, 2415, 2416,
+    2416, 2410, 2409,
+    2410, 2416, 2417,
+    2417, 2395, 2410,
+    2396, 2410, 2395,
+    2416, 2418, 2419,
+    2419, 2417, 2416,
+    2418, 2416, 2415,
+    2415, 2420, 2418,
+    2418, 2421, 2422,
+    2422, 2419, 2418,
+    2421, 2418, 2420,
+    2419, 2422, 2423,
+    2423, 2424, 2419,
+    2417, 2419, 2424,
+    2424, 2384, 2417,
+    2395, 2417, 2384,
+    2424, 2423, 2425,
+    2425, 2383, 2424,
+    2384, 2424, 2383,
+    2423, 2426, 2427,
+    2427, 2425, 2423,
+    2426, 2423, 2422,
+    2422, 2428, 2426,
+    2428, 2422, 2421,
+    2421, 2429, 2428,
+    2429, 2421, 2430,
+    2420, 2430, 2421,
+    2430, 2431, 2429,
+    2431, 2430, 2432,
+    2433, 2432, 2430,
+    2430, 2420, 2433,
+    2432, 2434, 2431,
+    2434, 2432, 2435,
+    2436, 2435, 2432,
+    2432, 2433, 2436,
+    2437, 2433, 2420,
+    2438, 2436, 2433,
+    2433, 2437, 2438,
+    2435, 2436, 2439,
+    2440, 2439, 2436,
+    2436, 2438, 2440,
+    2435, 2441, 2434,
+    2441, 2435, 2442,
+    2439, 2442, 2435,
+    2442, 2439, 2443,
+    2444, 2443, 2439,
+    2439, 2440, 2444,
+    2445, 2440, 2438,
+    2446, 2444, 2440,
+    2440, 2445, 2446,
+    2447, 2438, 2437,
+    2438, 2447, 2445,
+    2448, 2445, 2447,
+    2449, 2446, 2445,
+    2445, 2448, 2449,
+    2444, 2446, 2450,
+    2451, 2450, 2446,
+    2446, 2449, 2451,
+    2443, 2444, 2452,
+    2450, 2452, 2444,
+    2443, 2453, 2442,
+    2453, 2443, 2454,
+    2452, 2454, 2443,
+    2454, 2452, 2455,
+    2456, 2455, 2452,
+    2452, 2450, 2456,
+    2457, 2456, 2450,
+    2450, 2451, 2457,
+    2458, 2451, 2449,
+    2459, 2457, 2451,
+    2451, 2458, 2459,
+    2460, 2449, 2448,
+    2449, 2460, 2458,
+    2461, 2458, 2460,
+    2462, 2459, 2458,
+    2458, 2461, 2462,
+    2457, 2459, 2463,
+    2464, 2463, 2459,
+    2459, 2462, 2464,
+    2456, 2457, 2465,
+    2463, 2465, 2457,
+    2455, 2456, 2466,
+    2465, 2466, 2456,
+    2466, 2465, 2467,
+    2468, 2467, 2465,
+    2465, 2463, 2468,
+    2469, 2468, 2463,
+    2463, 2464, 2469,
+    2470, 2464, 2462,
+    2471, 2469, 2464,
+    2464, 2470, 2471,
+    2472, 2462, 2461,
+    2462, 2472, 2470,
+    2473, 2470, 2472,
+    2474, 2471, 2470,
+    2470, 2473, 2474,
+    2469, 2471, 2475,
+    2476, 2475, 2471,
+    2471, 2474, 2476,
+    2468, 2469, 2477,
+    2475, 2477, 2469,
+    2467, 2468, 2478,
+    2477, 2478, 2468,
+    2478, 2477, 2479,
+    2480, 2479, 2477,
+    2477, 2475, 2480,
+    2481, 2480, 2475,
+    2475, 2476, 2481,
+    2482, 2476, 2474,
+    2483, 2481, 2476,
+    2476, 2482, 2483,
+    2484, 2474, 2473,
+    2474, 2484, 2482,
+    2473, 2485, 2484,
+    2485, 2473, 2486,
+    2486, 2487, 2485,
+    2486, 2472, 2488,
+    2488, 2489, 2486,
+    2472, 2486, 2473,
+    2487, 2486, 2489,
+    2489, 2490, 2487,
+    2489, 2488, 2491,
+    2491, 2492, 2489,
+    2490, 2489, 2492,
+    2488, 2461, 2493,
+    2493, 2491, 2488,
+    2461, 2488, 2472,
+    2491, 2493, 2494,
+    2494, 2495, 2491,
+    2492, 2491, 2495,
+    2495, 2496, 2492,
+    2497, 2492, 2496,
+    2492, 2497, 2490,
+    2495, 2494, 2498,
+    2498, 2499, 2495,
+    2496, 2495, 2499,
+    2494, 2500, 2501,
+    2501, 2498, 2494,
+    2500, 2494, 2493,
+    2493, 2460, 2500,
+    2460, 2493, 2461,
+    2500, 2448, 2502,
+    2502, 2501, 2500,
+    2448, 2500, 2460,
+    2501, 2502, 2413,
+    2413, 2503, 2501,
+    2498, 2501, 2503,
+    2503, 2504, 2498,
+    2499, 2498, 2504,
+    2504, 2505, 2499,
+    2506, 2499, 2505,
+    2499, 2506, 2496,
+    2504, 2503, 2507,
+    2507, 2508, 2504,
+    2505, 2504, 2508,
+    2503, 2413, 2414,
+    2414, 2507, 2503,
+    2412, 2413, 2502,
+    2502, 2447, 2412,
+    2447, 2502, 2448,
+    2412, 2437, 2411,
+    2437, 2412, 2447,
+    2420, 2411, 2437,
+    2508, 2509, 2505,
+    2510, 2505, 2509,
+    2505, 2510, 2506,
+    2509, 2511, 2510,
+    2512, 2510, 2511,
+    2513, 2506, 2510,
+    2510, 2512, 2513,
+    2511, 2514, 2512,
+    2514, 2515, 2516,
+    2516, 2517, 2514,
+    2515, 2406, 2404,
+    2404, 2516, 2515,
+    2516, 2404, 2403,
+    2403, 2518, 2516,
+    2517, 2516, 2518,
+    2518, 2519, 2517,
+    2518, 2403, 2402,
+    2402, 2520, 2518,
+    2519, 2518, 2520,
+    2520, 2521, 2519,
+    2520, 2402, 2522,
+    2522, 2523, 2520,
+    2521, 2520, 2523,
+    2401, 2522, 2402,
+    2522, 2401, 2524,
+    2524, 2525, 2522,
+    2523, 2522, 2525,
+    2525, 2526, 2523,
+    2527, 2523, 2526,
+    2523, 2527, 2521,
+    2525, 2524, 2528,
+    2528, 2529, 2525,
+    2526, 2525, 2529,
+    2524, 2390, 2530,
+    2530, 2528, 2524,
+    2390, 2524, 2401,
+    2528, 2530, 2531,
+    2531, 2532, 2528,
+    2529, 2528, 2532,
+    2532, 2533, 2529,
+    2534, 2529, 2533,
+    2529, 2534, 2526,
+    2535, 2526, 2534,
+    2526, 2535, 2527,
+    2533, 2536, 2534,
+    2537, 2534, 2536,
+    2534, 2537, 2535,
+    2533, 2532, 2538,
+    2538, 2539, 2533,
+    2536, 2533, 2539,
+    2532, 2531, 2540,
+    2540, 2538, 2532,
+    2531, 2541, 2542,
+    2542, 2540, 2531,
+    2541, 2531, 2530,
+    2540, 2542, 2543,
+    2543, 2544, 2540,
+    2538, 2540, 2544,
+    2544, 2545, 2538,
+    2539, 2538, 2545,
+    2545, 2546, 2539,
+    2547, 2539, 2546,
+    2539, 2547, 2536,
+    2548, 2536, 2547,
+    2536, 2548, 2537,
+    2546, 2549, 2547,
+    2550, 2547, 2549,
+    2547, 2550, 2548,
+    2546, 2545, 2551,
+    2551, 2552, 2546,
+    2549, 2546, 2552,
+    2545, 2544, 2553,
+    2553, 2551, 2545,
+    2544, 2543, 2554,
+    2554, 2553, 2544,
+    2555, 2554, 2543,
+    2555, 2556, 2557,
+    2557, 2558, 2555,
+    2559, 2555, 2558,
+    2556, 2555, 2560,
+    2543, 2560, 2555,
+    2556, 2561, 2562,
+    2562, 2557, 2556,
+    2561, 2556, 2563,
+    2560, 2563, 2556,
+    2557, 2562, 2564,
+    2564, 2565, 2557,
+    2558, 2557, 2565,
+    2565, 2566, 2558,
+    2567, 2558, 2566,
+    2558, 2567, 2559,
+    2568, 2559, 2567,
+    2566, 2467, 2567,
+    2478, 2567, 2467,
+    2567, 2478, 2568,
+    2566, 2565, 2569,
+    2569, 2466, 2566,
+    2467, 2566, 2466,
+    2565, 2564, 2570,
+    2570, 2569, 2565,
+    2564, 2571, 2572,
+    2572, 2570, 2564,
+    2571, 2564, 2562,
+    2570, 2572, 2573,
+    2573, 2574, 2570,
+    2569, 2570, 2574,
+    2574, 2455, 2569,
+    2466, 2569, 2455,
+    2574, 2573, 2575,
+    2575, 2454, 2574,
+    2455, 2574, 2454,
+    2573, 2576, 2577,
+    2577, 2575, 2573,
+    2576, 2573, 2572,
+    2572, 2578, 2576,
+    2578, 2572, 2571,
+    2571, 2579, 2578,
+    2579, 2571, 2580,
+    2562, 2580, 2571,
+    2580, 2581, 2579,
+    2581, 2580, 2582,
+    2561, 2582, 2580,
+    2580, 2562, 2561,
+    2582, 2364, 2581,
+    2364, 2582, 2365,
+    2376, 2365, 2582,
+    2582, 2561, 2376,
+    2563, 2376, 2561,
+    2376, 2563, 2377,
+    2583, 2377, 2563,
+    2563, 2560, 2583,
+    2377, 2583, 2378,
+    2542, 2583, 2560,
+    2541, 2378, 2583,
+    2583, 2542, 2541,
+    2560, 2543, 2542,
+    2378, 2541, 2389,
+    2530, 2389, 2541,
+    2389, 2530, 2390,
+    2575, 2577, 2584,
+    2584, 2453, 2575,
+    2454, 2575, 2453,
+    2453, 2584, 2585,
+    2585, 2442, 2453,
+    2442, 2585, 2441,
+    2479, 2568, 2478,
+    2552, 2586, 2549,
+    2587, 2549, 2586,
+    2586, 2483, 2587,
+    2549, 2587, 2550,
+    2506, 2513, 2588,
+    2588, 2496, 2506,
+    2496, 2588, 2497,
+    2425, 2427, 2589,
+    2589, 2371, 2425,
+    2383, 2425, 2371,
+    2427, 2590, 2591,
+    2591, 2589, 2427,
+    2590, 2427, 2592,
+    2589, 2591, 2593,
+    2593, 2370, 2589,
+    2371, 2589, 2370,
+    2591, 2594, 2595,
+    2595, 2593, 2591,
+    2594, 2591, 2590,
+    2590, 2596, 2594,
+    2596, 2590, 2597,
+    2592, 2597, 2590,
+    2597, 2592, 2598,
+    2597, 2599, 2596,
+    2599, 2597, 2600,
+    2598, 2600, 2597,
+    2596, 2601, 2602,
+    2602, 2594, 2596,
+    2601, 2596, 2599,
+    2594, 2602, 2603,
+    2603, 2595, 2594,
+    2595, 2603, 2604,
+    2604, 2605, 2595,
+    2593, 2595, 2605,
+    2603, 2606, 2607,
+    2607, 2604, 2603,
+    2606, 2603, 2602,
+    2602, 2608, 2606,
+    2608, 2602, 2601,
+    2601, 2609, 2608,
+    2609, 2601, 2610,
+    2599, 2610, 2601,
+    2610, 2599, 2611,
+    2600, 2611, 2599,
+    2610, 2612, 2609,
+    2612, 2610, 2613,
+    2611, 2613, 2610,
+    2609, 2614, 2615,
+    2615, 2608, 2609,
+    2614, 2609, 2612,
+    2608, 2615, 2616,
+    2616, 2606, 2608,
+    2606, 2616, 2617,
+    2617, 2607, 2606,
+    2616, 2618, 2619,
+    2619, 2617, 2616,
+    2618, 2616, 2615,
+    2615, 2620, 2618,
+    2620, 2615, 2614,
+    2614, 2621, 2620,
+    2621, 2614, 2622,
+    2612, 2622, 2614,
+    2622, 2612, 2623,
+    2613, 2623, 2612,
+    2622, 2624, 2621,
+    2624, 2622, 2625,
+    2623, 2625, 2622,
+    2621, 2626, 2627,
+    2627, 2620, 2621,
+    2626, 2621, 2624,
+    2620, 2627, 2628,
+    2628, 2618, 2620,
+    2618, 2628, 2629,
+    2629, 2619, 2618,
+    2628, 2630, 2631,
+    2631, 2629, 2628,
+    2630, 2628, 2627,
+    2627, 2632, 2630,
+    2632, 2627, 2626,
+    2626, 2633, 2632,
+    2633, 2626, 2634,
+    2624, 2634, 2626,
+    2634, 2624, 2635,
+    2625, 2635, 2624,
+    2634, 2636, 2633,
+    2636, 2634, 2637,
+    2635, 2637, 2634,
+    2633, 2638, 2639,
+    2639, 2632, 2633,
+    2638, 2633, 2636,
+    2632, 2639, 2640,
+    2640, 2630, 2632,
+    2630, 2640, 2641,
+    2641, 2631, 2630,
+    2640, 2642, 2643,
+    2643, 2641, 2640,
+    2642, 2640, 2639,
+    2639, 2644, 2642,
+    2644, 2639, 2638,
+    2638, 2645, 2644,
+    2645, 2638, 2646,
+    2636, 2646, 2638,
+    2646, 2636, 2647,
+    2637, 2647, 2636,
+    2646, 2648, 2645,
+    2648, 2646, 2649,
+    2647, 2649, 2646,
+    2649, 2647, 2650,
+    2651, 2650, 2647,
+    2647, 2637, 2651,
+    2649, 2652, 2648,
+    2652, 2649, 2653,
+    2650, 2653, 2649,
+    2653, 2650, 2654,
+    2655, 2654, 2650,
+    2650, 2651, 2655,
+    2656, 2651, 2637,
+    2657, 2655, 2651,
+    2651, 2656, 2657,
+    2637, 2635, 2656,
+    2658, 2656, 2635,
+    2659, 2657, 2656,
+    2656, 2658, 2659,
+    2635, 2625, 2658,
+    2660, 2658, 2625,
+    2661, 2659, 2658,
+    2658, 2660, 2661,
+    2625, 2623, 2660,
+    2662, 2660, 2623,
+    2663, 2661, 2660,
+    2660, 2662, 2663,
+    2623, 2613, 2662,
+    2664, 2662, 2613,
+    2665, 2663, 2662,
+    2662, 2664, 2665,
+    2613, 2611, 2664,
+    2666, 2664, 2611,
+    2667, 2665, 2664,
+    2664, 2666, 2667,
+    2668, 2665, 2669,
+    2670, 2669, 2665,
+    2665, 2671, 2670,
+    2672, 2668, 2673,
+    2669, 2673, 2668,
+    2673, 2669, 2674,
+    2675, 2674, 2669,
+    2669, 2670, 2675,
+    2676, 2670, 2671,
+    2677, 2675, 2670,
+    2670, 2676, 2677,
+    2671, 2678, 2676,
+    2675, 2677, 2679,
+    2674, 2675, 2680,
+    2679, 2680, 2675,
+    2674, 2681, 2673,
+    2681, 2674, 2682,
+    2680, 2682, 2674,
+    2673, 2683, 2672,
+    2683, 2673, 2681,
+    2684, 2672, 2683,
+    2683, 2685, 2684,
+    2685, 2683, 2686,
+    2681, 2686, 2683,
+    2686, 2681, 2687,
+    2682, 2687, 2681,
+    2687, 2682, 2688,
+    2689, 2688, 2682,
+    2682, 2680, 2689,
+    2690, 2689, 2680,
+    2680, 2679, 2690,
+    2688, 2689, 2691,
+    2692, 2691, 2689,
+    2689, 2690, 2692,
+    2688, 2296, 2687,
+    2296, 2688, 2297,
+    2691, 2297, 2688,
+    2687, 2285, 2686,
+    2285, 2687, 2296,
+    2686, 2284, 2685,
+    2284, 2686, 2285,
+    2283, 2685, 2284,
+    2283, 2272, 2693,
+    2693, 2694, 2283,
+    2685, 2283, 2694,
+    2271, 2693, 2272,
+    2694, 2684, 2685,
+    2297, 2691, 2308,
+    2695, 2308, 2691,
+    2308, 2695, 2309,
+    2691, 2692, 2695,
+    2696, 2667, 2666,
+    2666, 2697, 2696,
+    2611, 2600, 2666,
+    2697, 2666, 2600,
+    2600, 2598, 2697,
+    2654, 2698, 2653,
+    2698, 2699, 2700,
+    2700, 2653, 2698,
+    2653, 2700, 2652,
+    2641, 2643, 2701,
+    2701, 2702, 2641,
+    2631, 2641, 2702,
+    2702, 2701, 2703,
+    2703, 2704, 2702,
+    2705, 2702, 2704,
+    2702, 2705, 2631,
+    2629, 2631, 2705,
+    2704, 2706, 2705,
+    2707, 2705, 2706,
+    2705, 2707, 2629,
+    2704, 2703, 2708,
+    2708, 2709, 2704,
+    2706, 2704, 2709,
+    2709, 2710, 2706,
+    2711, 2706, 2710,
+    2706, 2711, 2707,
+    2712, 2707, 2711,
+    2619, 2629, 2707,
+    2707, 2712, 2619,
+    2710, 2713, 2711,
+    2714, 2711, 2713,
+    2711, 2714, 2712,
+    2715, 2712, 2714,
+    2617, 2619, 2712,
+    2712, 2715, 2617,
+    2713, 2716, 2714,
+    2717, 2714, 2716,
+    2714, 2717, 2715,
+    2718, 2715, 2717,
+    2607, 2617, 2715,
+    2715, 2718, 2607,
+    2716, 2719, 2717,
+    2720, 2717, 2719,
+    2717, 2720, 2718,
+    2721, 2718, 2720,
+    2604, 2607, 2718,
+    2718, 2721, 2604,
+    2719, 2722, 2720,
+    2358, 2720, 2722,
+    2720, 2358, 2721,
+    2359, 2721, 2358,
+    2605, 2604, 2721,
+    2721, 2359, 2605,
+    2722, 2316, 2358,
+    2360, 2605, 2359,
+    2605, 2360, 2593,
+    2370, 2593, 2360,
+    2723, 2724, 2725,
+    2723, 2725, 2726,
+    2723, 2726, 2727,
+    2723, 2727, 2728,
+    2723, 2728, 2729,
+    2723, 2729, 2730,
+    2723, 2730, 2731,
+    2723, 2731, 2732,
+    2723, 2732, 2733,
+    2723, 2733, 2734,
+    2723, 2735, 2736,
+    2723, 2736, 2737,
+    2723, 2737, 2738,
+    2723, 2738, 2739,
+    2723, 2739, 2740,
+    2723, 2740, 2741,
+    2723, 2741, 2742,
+    2723, 2742, 2743,
+    2723, 2743, 2744,
+    2723, 2744, 2745,
+    2723, 2746, 2747,
+    2723, 2747, 2748,
+    2723, 2748, 2749,
+    2723, 2749, 2750,
+    2723, 2750, 2751,
+    2723, 2751, 2752,
+    2723, 2752, 2753,
+    2723, 2753, 2754,
+    2723, 2754, 2755,
+    2723, 2755, 2756,
+    2723, 2757, 2758,
+    2723, 2758, 2759,
+    2723, 2759, 2760,
+    2723, 2760, 2761,
+    2723, 2761, 2762,
+    2723, 2762, 2763,
+    2723, 2763, 2764,
+    2723, 2764, 2765,
+    2723, 2765, 2766,
+    2723, 2766, 2767,
+    2768, 2756, 2755,
+    2755, 2769, 2768,
+    2770, 2768, 2769,
+    2769, 2755, 2754,
+    2754, 2771, 2769,
+    2772, 2769, 2771,
+    2769, 2772, 2770,
+    2773, 2770, 2772,
+    2771, 2774, 2772,
+    2775, 2772, 2774,
+    2772, 2775, 2773,
+    2771, 2754, 2753,
+    2753, 2776, 2771,
+    2774, 2771, 2776,
+    2776, 2777, 2774,
+    2778, 2774, 2777,
+    2774, 2778, 2775,
+    2779, 2775, 2778,
+    2780, 2773, 2775,
+    2775, 2779, 2780,
+    2777, 2781, 2778,
+    2782, 2778, 2781,
+    2778, 2782, 2779,
+    2777, 2776, 2783,
+    2783, 2784, 2777,
+    2781, 2777, 2784,
+    2776, 2753, 2752,
+    2752, 2783, 2776,
+    2783, 2752, 2751,
+    2751, 2785, 2783,
+    2784, 2783, 2785,
+    2785, 2786, 2784,
+    2787, 2784, 2786,
+    2784, 2787, 2781,
+    2788, 2781, 2787,
+    2781, 2788, 2782,
+    2789, 2782, 2788,
+    2790, 2779, 2782,
+    2782, 2789, 2790,
+    2787, 2791, 2788,
+    2792, 2788, 2791,
+    2788, 2792, 2789,
+    2786, 2793, 2787,
+    2791, 2787, 2793,
+    2786, 2785, 2794,
+    2794, 2795, 2786,
+    2793, 2786, 2795,
+    2785, 2751, 2750,
+    2750, 2794, 2785,
+    2794, 2750, 2749,
+    2749, 2796, 2794,
+    2795, 2794, 2796,
+    2796, 2797, 2795,
+    2798, 2795, 2797,
+    2795, 2798, 2793,
+    2799, 2793, 2798,
+    2793, 2799, 2791,
+    2800, 2791, 2799,
+    2791, 2800, 2792,
+    2798, 2801, 2799,
+    2802, 2799, 2801,
+    2799, 2802, 2800,
+    2797, 2803, 2798,
+    2801, 2798, 2803,
+    2797, 2796, 2804,
+    2804, 2805, 2797,
+    2803, 2797, 2805,
+    2796, 2749, 2748,
+    2748, 2804, 2796,
+    2804, 2748, 2747,
+    2747, 2806, 2804,
+    2805, 2804, 2806,
+    2806, 2807, 2805,
+    2808, 2805, 2807,
+    2805, 2808, 2803,
+    2809, 2803, 2808,
+    2803, 2809, 2801,
+    2810, 2801, 2809,
+    2801, 2810, 2802,
+    2808, 2811, 2809,
+    2812, 2809, 2811,
+    2809, 2812, 2810,
+    2807, 2813, 2808,
+    2811, 2808, 2813,
+    2807, 2806, 2814,
+    2814, 2815, 2807,
+    2813, 2807, 2815,
+    2806, 2747, 2746,
+    2746, 2814, 2806,
+    2815, 2816, 2813,
+    2817, 2813, 2816,
+    2813, 2817, 2811,
+    2818, 2811, 2817,
+    2811, 2818, 2812,
+    2819, 2812, 2818,
+    2820, 2810, 2812,
+    2812, 2819, 2820,
+    2821, 2802, 2810,
+    2810, 2820, 2821,
+    2822, 2820, 2819,
+    2823, 2821, 2820,
+    2820, 2822, 2823,
+    2818, 2824, 2819,
+    2825, 2819, 2824,
+    2819, 2825, 2822,
+    2817, 2826, 2818,
+    2824, 2818, 2826,
+    2816, 2827, 2817,
+    2826, 2817, 2827,
+    2827, 2828, 2826,
+    2829, 2826, 2828,
+    2826, 2829, 2824,
+    2830, 2824, 2829,
+    2824, 2830, 2825,
+    2831, 2825, 2830,
+    2832, 2822, 2825,
+    2825, 2831, 2832,
+    2833, 2823, 2822,
+    2822, 2832, 2833,
+    2834, 2832, 2831,
+    2835, 2833, 2832,
+    2832, 2834, 2835,
+    2830, 2836, 2831,
+    2837, 2831, 2836,
+    2831, 2837, 2834,
+    2829, 2838, 2830,
+    2836, 2830, 2838,
+    2828, 2839, 2829,
+    2838, 2829, 2839,
+    2839, 2840, 2838,
+    2841, 2838, 2840,
+    2838, 2841, 2836,
+    2842, 2836, 2841,
+    2836, 2842, 2837,
+    2840, 2843, 2841,
+    2844, 2841, 2843,
+    2841, 2844, 2842,
+    2843, 2845, 2844,
+    2833, 2835, 2846,
+    2846, 2847, 2833,
+    2847, 2846, 2848,
+    2847, 2849, 2823,
+    2823, 2833, 2847,
+    2849, 2847, 2850,
+    2848, 2850, 2847,
+    2850, 2848, 2851,
+    2850, 2852, 2849,
+    2852, 2850, 2853,
+    2851, 2853, 2850,
+    2849, 2854, 2821,
+    2821, 2823, 2849,
+    2854, 2849, 2852,
+    2852, 2855, 2854,
+    2855, 2852, 2856,
+    2853, 2856, 2852,
+    2856, 2853, 2857,
+    2858, 2857, 2853,
+    2853, 2851, 2858,
+    2856, 2859, 2855,
+    2859, 2856, 2860,
+    2857, 2860, 2856,
+    2855, 2792, 2800,
+    2800, 2854, 2855,
+    2792, 2855, 2859,
+    2854, 2800, 2802,
+    2802, 2821, 2854,
+    2859, 2789, 2792,
+    2789, 2859, 2861,
+    2860, 2861, 2859,
+    2861, 2860, 2862,
+    2863, 2862, 2860,
+    2860, 2857, 2863,
+    2864, 2863, 2857,
+    2857, 2858, 2864,
+    2862, 2865, 2861,
+    2861, 2790, 2789,
+    2790, 2861, 2865,
+    2865, 2866, 2790,
+    2779, 2790, 2866,
+    2866, 2780, 2779,
+    2867, 2767, 2766,
+    2766, 2868, 2867,
+    2869, 2867, 2868,
+    2868, 2766, 2765,
+    2765, 2870, 2868,
+    2871, 2868, 2870,
+    2868, 2871, 2869,
+    2872, 2869, 2871,
+    2870, 2873, 2871,
+    2874, 2871, 2873,
+    2871, 2874, 2872,
+    2870, 2765, 2764,
+    2764, 2875, 2870,
+    2873, 2870, 2875,
+    2875, 2876, 2873,
+    2877, 2873, 2876,
+    2873, 2877, 2874,
+    2878, 2874, 2877,
+    2879, 2872, 2874,
+    2874, 2878, 2879,
+    2876, 2880, 2877,
+    2881, 2877, 2880,
+    2877, 2881, 2878,
+    2876, 2875, 2882,
+    2882, 2883, 2876,
+    2880, 2876, 2883,
+    2875, 2764, 2763,
+    2763, 2882, 2875,
+    2882, 2763, 2762,
+    2762, 2884, 2882,
+    2883, 2882, 2884,
+    2884, 2885, 2883,
+    2886, 2883, 2885,
+    2883, 2886, 2880,
+    2887, 2880, 2886,
+    2880, 2887, 2881,
+    2888, 2881, 2887,
+    2889, 2878, 2881,
+    2881, 2888, 2889,
+    2886, 2890, 2887,
+    2891, 2887, 2890,
+    2887, 2891, 2888,
+    2885, 2892, 2886,
+    2890, 2886, 2892,
+    2885, 2884, 2893,
+    2893, 2894, 2885,
+    2892, 2885, 2894,
+    2884, 2762, 2761,
+    2761, 2893, 2884,
+    2893, 2761, 2760,
+    2760, 2895, 2893,
+    2894, 2893, 2895,
+    2895, 2896, 2894,
+    2897, 2894, 2896,
+    2894, 2897, 2892,
+    2898, 2892, 2897,
+    2892, 2898, 2890,
+    2899, 2890, 2898,
+    2890, 2899, 2891,
+    2897, 2900, 2898,
+    2901, 2898, 2900,
+    2898, 2901, 2899,
+    2896, 2902, 2897,
+    2900, 2897, 2902,
+    2896, 2895, 2903,
+    2903, 2904, 2896,
+    2902, 2896, 2904,
+    2895, 2760, 2759,
+    2759, 2903, 2895,
+    2903, 2759, 2758,
+    2758, 2905, 2903,
+    2904, 2903, 2905,
+    2905, 2906, 2904,
+    2907, 2904, 2906,
+    2904, 2907, 2902,
+    2908, 2902, 2907,
+    2902, 2908, 2900,
+    2909, 2900, 2908,
+    2900, 2909, 2901,
+    2907, 2910, 2908,
+    2911, 2908, 2910,
+    2908, 2911, 2909,
+    2906, 2912, 2907,
+    2910, 2907, 2912,
+    2906, 2905, 2913,
+    2913, 2914, 2906,
+    2912, 2906, 2914,
+    2905, 2758, 2757,
+    2757, 2913, 2905,
+    2914, 2915, 2912,
+    2916, 2912, 2915,
+    2912, 2916, 2910,
+    2917, 2910, 2916,
+    2910, 2917, 2911,
+    2918, 2911, 2917,
+    2919, 2909, 2911,
+    2911, 2918, 2919,
+    2920, 2901, 2909,
+    2909, 2919, 2920,
+    2921, 2919, 2918,
+    2922, 2920, 2919,
+    2919, 2921, 2922,
+    2917, 2923, 2918,
+    2924, 2918, 2923,
+    2918, 2924, 2921,
+    2916, 2925, 2917,
+    2923, 2917, 2925,
+    2915, 2926, 2916,
+    2925, 2916, 2926,
+    2926, 2927, 2925,
+    2928, 2925, 2927,
+    2925, 2928, 2923,
+    2929, 2923, 2928,
+    2923, 2929, 2924,
+    2930, 2924, 2929,
+    2931, 2921, 2924,
+    2924, 2930, 2931,
+    2932, 2922, 2921,
+    2921, 2931, 2932,
+    2933, 2931, 2930,
+    2934, 2932, 2931,
+    2931, 2933, 2934,
+    2929, 2935, 2930,
+    2936, 2930, 2935,
+    2930, 2936, 2933,
+    2928, 2937, 2929,
+    2935, 2929, 2937,
+    2927, 2938, 2928,
+    2937, 2928, 2938,
+    2938, 2939, 2937,
+    2940, 2937, 2939,
+    2937, 2940, 2935,
+    2941, 2935, 2940,
+    2935, 2941, 2936,
+    2939, 2942, 2940,
+    2943, 2940, 2942,
+    2940, 2943, 2941,
+    2942, 2944, 2943,
+    2932, 2934, 2945,
+    2945, 2946, 2932,
+    2946, 2945, 2947,
+    2946, 2948, 2922,
+    2922, 2932, 2946,
+    2948, 2946, 2949,
+    2947, 2949, 2946,
+    2949, 2947, 2950,
+    2949, 2951, 2948,
+    2951, 2949, 2952,
+    2950, 2952, 2949,
+    2948, 2953, 2920,
+    2920, 2922, 2948,
+    2953, 2948, 2951,
+    2951, 2954, 2953,
+    2954, 2951, 2955,
+    2952, 2955, 2951,
+    2955, 2952, 2956,
+    2957, 2956, 2952,
+    2952, 2950, 2957,
+    2955, 2958, 2954,
+    2958, 2955, 2959,
+    2956, 2959, 2955,
+    2954, 2891, 2899,
+    2899, 2953, 2954,
+    2891, 2954, 2958,
+    2953, 2899, 2901,
+    2901, 2920, 2953,
+    2958, 2888, 2891,
+    2888, 2958, 2960,
+    2959, 2960, 2958,
+    2960, 2959, 2961,
+    2962, 2961, 2959,
+    2959, 2956, 2962,
+    2963, 2962, 2956,
+    2956, 2957, 2963,
+    2961, 2964, 2960,
+    2960, 2889, 2888,
+    2889, 2960, 2964,
+    2964, 2965, 2889,
+    2878, 2889, 2965,
+    2965, 2879, 2878,
+    2966, 2745, 2744,
+    2744, 2967, 2966,
+    2968, 2966, 2967,
+    2967, 2744, 2743,
+    2743, 2969, 2967,
+    2970, 2967, 2969,
+    2967, 2970, 2968,
+    2971, 2968, 2970,
+    2969, 2972, 2970,
+    2973, 2970, 2972,
+    2970, 2973, 2971,
+    2969, 2743, 2742,
+    2742, 2974, 2969,
+    2972, 2969, 2974,
+    2974, 2975, 2972,
+    2976, 2972, 2975,
+    2972, 2976, 2973,
+    2977, 2973, 2976,
+    2978, 2971, 2973,
+    2973, 2977, 2978,
+    2975, 2979, 2976,
+    2980, 2976, 2979,
+    2976, 2980, 2977,
+    2975, 2974, 2981,
+    2981, 2982, 2975,
+    2979, 2975, 2982,
+    2974, 2742, 2741,
+    2741, 2981, 2974,
+    2981, 2741, 2740,
+    2740, 2983, 2981,
+    2982, 2981, 2983,
+    2983, 2984, 2982,
+    2985, 2982, 2984,
+    2982, 2985, 2979,
+    2986, 2979, 2985,
+    2979, 2986, 2980,
+    2987, 2980, 2986,
+    2988, 2977, 2980,
+    2980, 2987, 2988,
+    2985, 2989, 2986,
+    2990, 2986, 2989,
+    2986, 2990, 2987,
+    2984, 2991, 2985,
+    2989, 2985, 2991,
+    2984, 2983, 2992,
+    2992, 2993, 2984,
+    2991, 2984, 2993,
+    2983, 2740, 2739,
+    2739, 2992, 2983,
+    2992, 2739, 2738,
+    2738, 2994, 2992,
+    2993, 2992, 2994,
+    2994, 2995, 2993,
+    2996, 2993, 2995,
+    2993, 2996, 2991,
+    2997, 2991, 2996,
+    2991, 2997, 2989,
+    2998, 2989, 2997,
+    2989, 2998, 2990,
+    2996, 2999, 2997,
+    3000, 2997, 2999,
+    2997, 3000, 2998,
+    2995, 3001, 2996,
+    2999, 2996, 3001,
+    2995, 2994, 3002,
+    3002, 3003, 2995,
+    3001, 2995, 3003,
+    2994, 2738, 2737,
+    2737, 3002, 2994,
+    3002, 2737, 2736,
+    2736, 3004, 3002,
+    3003, 3002, 3004,
+    3004, 3005, 3003,
+    3006, 3003, 3005,
+    3003, 3006, 3001,
+    3007, 3001, 3006,
+    3001, 3007, 2999,
+    3008, 2999, 3007,
+    2999, 3008, 3000,
+    3006, 3009, 3007,
+    3010, 3007, 3009,
+    3007, 3010, 3008,
+    3005, 3011, 3006,
+    3009, 3006, 3011,
+    3005, 3004, 3012,
+    3012, 3013, 3005,
+    3011, 3005, 3013,
+    3004, 2736, 2735,
+    2735, 3012, 3004,
+    3013, 3014, 3011,
+    3015, 3011, 3014,
+    3011, 3015, 3009,
+    3016, 3009, 3015,
+    3009, 3016, 3010,
+    3017, 3010, 3016,
+    3018, 3008, 3010,
+    3010, 3017, 3018,
+    3019, 3000, 3008,
+    3008, 3018, 3019,
+    3020, 3018, 3017,
+    3021, 3019, 3018,
+    3018, 3020, 3021,
+    3016, 3022, 3017,
+    3023, 3017, 3022,
+    3017, 3023, 3020,
+    3015, 3024, 3016,
+    3022, 3016, 3024,
+    3014, 3025, 3015,
+    3024, 3015, 3025,
+    3025, 3026, 3024,
+    3027, 3024, 3026,
+    3024, 3027, 3022,
+    3028, 3022, 3027,
+    3022, 3028, 3023,
+    3029, 3023, 3028,
+    3030, 3020, 3023,
+    3023, 3029, 3030,
+    3031, 3021, 3020,
+    3020, 3030, 3031,
+    3032, 3030, 3029,
+    3033, 3031, 3030,
+    3030, 3032, 3033,
+    3028, 3034, 3029,
+    3035, 3029, 3034,
+    3029, 3035, 3032,
+    3027, 3036, 3028,
+    3034, 3028, 3036,
+    3026, 3037, 3027,
+    3036, 3027, 3037,
+    3037, 3038, 3036,
+    3039, 3036, 3038,
+    3036, 3039, 3034,
+    3040, 3034, 3039,
+    3034, 3040, 3035,
+    3038, 3041, 3039,
+    3042, 3039, 3041,
+    3039, 3042, 3040,
+    3041, 3043, 3042,
+    3031, 3033, 3044,
+    3044, 3045, 3031,
+    3045, 3044, 3046,
+    3045, 3047, 3021,
+    3021, 3031, 3045,
+    3047, 3045, 3048,
+    3046, 3048, 3045,
+    3048, 3046, 3049,
+    3048, 3050, 3047,
+    3050, 3048, 3051,
+    3049, 3051, 3048,
+    3047, 3052, 3019,
+    3019, 3021, 3047,
+    3052, 3047, 3050,
+    3050, 3053, 3052,
+    3053, 3050, 3054,
+    3051, 3054, 3050,
+    3054, 3051, 3055,
+    3056, 3055, 3051,
+    3051, 3049, 3056,
+    3054, 3057, 3053,
+    3057, 3054, 3058,
+    3055, 3058, 3054,
+    3053, 2990, 2998,
+    2998, 3052, 3053,
+    2990, 3053, 3057,
+    3052, 2998, 3000,
+    3000, 3019, 3052,
+    3057, 2987, 2990,
+    2987, 3057, 3059,
+    3058, 3059, 3057,
+    3059, 3058, 3060,
+    3061, 3060, 3058,
+    3058, 3055, 3061,
+    3062, 3061, 3055,
+    3055, 3056, 3062,
+    3060, 3063, 3059,
+    3059, 2988, 2987,
+    2988, 3059, 3063,
+    3063, 3064, 2988,
+    2977, 2988, 3064,
+    3064, 2978, 2977,
+    3065, 2734, 2733,
+    2733, 3066, 3065,
+    3067, 3065, 3066,
+    3066, 2733, 2732,
+    2732, 3068, 3066,
+    3069, 3066, 3068,
+    3066, 3069, 3067,
+    3070, 3067, 3069,
+    3068, 3071, 3069,
+    3072, 3069, 3071,
+    3069, 3072, 3070,
+    3068, 2732, 2731,
+    2731, 3073, 3068,
+    3071, 3068, 3073,
+    3073, 3074, 3071,
+    3075, 3071, 3074,
+    3071, 3075, 3072,
+    3076, 3072, 3075,
+    3077, 3070, 3072,
+    3072, 3076, 3077,
+    3074, 3078, 3075,
+    3079, 3075, 3078,
+    3075, 3079, 3076,
+    3074, 3073, 3080,
+    3080, 3081, 3074,
+    3078, 3074, 3081,
+    3073, 2731, 2730,
+    2730, 3080, 3073,
+    3080, 2730, 2729,
+    2729, 3082, 3080,
+    3081, 3080, 3082,
+    3082, 3083, 3081,
+    3084, 3081, 3083,
+    3081, 3084, 3078,
+    3085, 3078, 3084,
+    3078, 3085, 3079,
+    3086, 3079, 3085,
+    3087, 3076, 3079,
+    3079, 3086, 3087,
+    3084, 3088, 3085,
+    3089, 3085, 3088,
+    3085, 3089, 3086,
+    3083, 3090, 3084,
+    3088, 3084, 3090,
+    3083, 3082, 3091,
+    3091, 3092, 3083,
+    3090, 3083, 3092,
+    3082, 2729, 2728,
+    2728, 3091, 3082,
+    3091, 2728, 2727,
+    2727, 3093, 3091,
+    3092, 3091, 3093,
+    3093, 3094, 3092,
+    3095, 3092, 3094,
+    3092, 3095, 3090,
+    3096, 3090, 3095,
+    3090, 3096, 3088,
+    3097, 3088, 3096,
+    3088, 3097, 3089,
+    3095, 3098, 3096,
+    3099, 3096, 3098,
+    3096, 3099, 3097,
+    3094, 3100, 3095,
+    3098, 3095, 3100,
+    3094, 3093, 3101,
+    3101, 3102, 3094,
+    3100, 3094, 3102,
+    3093, 2727, 2726,
+    2726, 3101, 3093,
+    3101, 2726, 2725,
+    2725, 3103, 3101,
+    3102, 3101, 3103,
+    3103, 3104, 3102,
+    3105, 3102, 3104,
+    3102, 3105, 3100,
+    3106, 3100, 3105,
+    3100, 3106, 3098,
+    3107, 3098, 3106,
+    3098, 3107, 3099,
+    3105, 3108, 3106,
+    3109, 3106, 3108,
+    3106, 3109, 3107,
+    3104, 3110, 3105,
+    3108, 3105, 3110,
+    3104, 3103, 3111,
+    3111, 3112, 3104,
+    3110, 3104, 3112,
+    3103, 2725, 2724,
+    2724, 3111, 3103,
+    3112, 3113, 3110,
+    3114, 3110, 3113,
+    3110, 3114, 3108,
+    3115, 3108, 3114,
+    3108, 3115, 3109,
+    3116, 3109, 3115,
+    3117, 3107, 3109,
+    3109, 3116, 3117,
+    3118, 3099, 3107,
+    3107, 3117, 3118,
+    3119, 3117, 3116,
+    3120, 3118, 3117,
+    3117, 3119, 3120,
+    3115, 3121, 3116,
+    3122, 3116, 3121,
+    3116, 3122, 3119,
+    3114, 3123, 3115,
+    3121, 3115, 3123,
+    3113, 3124, 3114,
+    3123, 3114, 3124,
+    3124, 3125, 3123,
+    3126, 3123, 3125,
+    3123, 3126, 3121,
+    3127, 3121, 3126,
+    3121, 3127, 3122,
+    3128, 3122, 3127,
+    3129, 3119, 3122,
+    3122, 3128, 3129,
+    3130, 3120, 3119,
+    3119, 3129, 3130,
+    3131, 3129, 3128,
+    3132, 3130, 3129,
+    3129, 3131, 3132,
+    3127, 3133, 3128,
+    3134, 3128, 3133,
+    3128, 3134, 3131,
+    3126, 3135, 3127,
+    3133, 3127, 3135,
+    3125, 3136, 3126,
+    3135, 3126, 3136,
+    3136, 3137, 3135,
+    3138, 3135, 3137,
+    3135, 3138, 3133,
+    3139, 3133, 3138,
+    3133, 3139, 3134,
+    3137, 3140, 3138,
+    3141, 3138, 3140,
+    3138, 3141, 3139,
+    3140, 3142, 3141,
+    3130, 3132, 3143,
+    3143, 3144, 3130,
+    3144, 3143, 3145,
+    3144, 3146, 3120,
+    3120, 3130, 3144,
+    3146, 3144, 3147,
+    3145, 3147, 3144,
+    3147, 3145, 3148,
+    3147, 3149, 3146,
+    3149, 3147, 3150,
+    3148, 3150, 3147,
+    3146, 3151, 3118,
+    3118, 3120, 3146,
+    3151, 3146, 3149,
+    3149, 3152, 3151,
+    3152, 3149, 3153,
+    3150, 3153, 3149,
+    3153, 3150, 3154,
+    3155, 3154, 3150,
+    3150, 3148, 3155,
+    3153, 3156, 3152,
+    3156, 3153, 3157,
+    3154, 3157, 3153,
+    3152, 3089, 3097,
+    3097, 3151, 3152,
+    3089, 3152, 3156,
+    3151, 3097, 3099,
+    3099, 3118, 3151,
+    3156, 3086, 3089,
+    3086, 3156, 3158,
+    3157, 3158, 3156,
+    3158, 3157, 3159,
+    3160, 3159, 3157,
+    3157, 3154, 3160,
+    3161, 3160, 3154,
+    3154, 3155, 3161,
+    3159, 3162, 3158,
+    3158, 3087, 3086,
+    3087, 3158, 3162,
+    3162, 3163, 3087,
+    3076, 3087, 3163,
+    3163, 3077, 3076,
+    3164, 3165, 3166,
+    3166, 3167, 3164,
+    3165, 3164, 3168,
+    3169, 3164, 3167,
+    3170, 3168, 3164,
+    3164, 3169, 3170,
+    3168, 3171, 3165,
+    3171, 3168, 3172,
+    3173, 3172, 3168,
+    3168, 3170, 3173,
+    3174, 3170, 3169,
+    3175, 3173, 3170,
+    3170, 3174, 3175,
+    3167, 3176, 3169,
+    3177, 3169, 3176,
+    3169, 3177, 3174,
+    3178, 3174, 3177,
+    3179, 3175, 3174,
+    3174, 3178, 3179,
+    3173, 3175, 3180,
+    3181, 3180, 3175,
+    3175, 3179, 3181,
+    3172, 3173, 3182,
+    3180, 3182, 3173,
+    3182, 3180, 3183,
+    3184, 3183, 3180,
+    3180, 3181, 3184,
+    3185, 3181, 3179,
+    3186, 3184, 3181,
+    3181, 3185, 3186,
+    3187, 3179, 3178,
+    3179, 3187, 3185,
+    3177, 3188, 3178,
+    3189, 3178, 3188,
+    3178, 3189, 3187,
+    3190, 3187, 3189,
+    3191, 3185, 3187,
+    3187, 3190, 3191,
+    3192, 3186, 3185,
+    3185, 3191, 3192,
+    3184, 3186, 3193,
+    3194, 3193, 3186,
+    3186, 3192, 3194,
+    3183, 3184, 3195,
+    3193, 3195, 3184,
+    3195, 3193, 3196,
+    3197, 3196, 3193,
+    3193, 3194, 3197,
+    3198, 3194, 3192,
+    3199, 3197, 3194,
+    3194, 3198, 3199,
+    3200, 3192, 3191,
+    3192, 3200, 3198,
+    3201, 3191, 3190,
+    3191, 3201, 3200,
+    3202, 3200, 3201,
+    3203, 3198, 3200,
+    3200, 3202, 3203,
+    3204, 3199, 3198,
+    3198, 3203, 3204,
+    3197, 3199, 3205,
+    3206, 3205, 3199,
+    3199, 3204, 3206,
+    3196, 3197, 3207,
+    3205, 3207, 3197,
+    3207, 3205, 3208,
+    3209, 3208, 3205,
+    3205, 3206, 3209,
+    3210, 3206, 3204,
+    3211, 3209, 3206,
+    3206, 3210, 3211,
+    3212, 3204, 3203,
+    3204, 3212, 3210,
+    3213, 3203, 3202,
+    3203, 3213, 3212,
+    3214, 3212, 3213,
+    3215, 3210, 3212,
+    3212, 3214, 3215,
+    3216, 3211, 3210,
+    3210, 3215, 3216,
+    3209, 3211, 3217,
+    3218, 3217, 3211,
+    3211, 3216, 3218,
+    3208, 3209, 3219,
+    3217, 3219, 3209,
+    3219, 3220, 3208,
+    3220, 3221, 3222,
+    3222, 3208, 3220,
+    3221, 3223, 3224,
+    3224, 3222, 3221,
+    3222, 3224, 3225,
+    3225, 3207, 3222,
+    3208, 3222, 3207,
+    3224, 3226, 3227,
+    3227, 3225, 3224,
+    3226, 3224, 3223,
+    3223, 3228, 3226,
+    3226, 3229, 3230,
+    3230, 3227, 3226,
+    3229, 3226, 3228,
+    3227, 3230, 3231,
+    3231, 3232, 3227,
+    3225, 3227, 3232,
+    3232, 3196, 3225,
+    3207, 3225, 3196,
+    3232, 3231, 3233,
+    3233, 3195, 3232,
+    3196, 3232, 3195,
+    3231, 3234, 3235,
+    3235, 3233, 3231,
+    3234, 3231, 3230,
+    3230, 3236, 3234,
+    3236, 3230, 3229,
+    3229, 3237, 3236,
+    3237, 3229, 3238,
+    3228, 3238, 3229,
+    3236, 3239, 3240,
+    3240, 3234, 3236,
+    3239, 3236, 3237,
+    3234, 3240, 3241,
+    3241, 3235, 3234,
+    3235, 3241, 3242,
+    3242, 3243, 3235,
+    3233, 3235, 3243,
+    3243, 3183, 3233,
+    3195, 3233, 3183,
+    3243, 3242, 3244,
+    3244, 3182, 3243,
+    3183, 3243, 3182,
+    3242, 3245, 3246,
+    3246, 3244, 3242,
+    3245, 3242, 3241,
+    3241, 3247, 3245,
+    3247, 3241, 3240,
+    3240, 3248, 3247,
+    3248, 3240, 3239,
+    3239, 3249, 3248,
+    3250, 3251, 3249,
+    3249, 3239, 3250,
+    3251, 3250, 3252,
+    3237, 3250, 3239,
+    3253, 3252, 3250,
+    3250, 3237, 3253,
+    3252, 3254, 3251,
+    3255, 3252, 3256,
+    3257, 3256, 3252,
+    3252, 3258, 3257,
+    3256, 3259, 3255,
+    3259, 3256, 3260,
+    3261, 3260, 3256,
+    3256, 3257, 3261,
+    3262, 3257, 3258,
+    3263, 3261, 3257,
+    3257, 3262, 3263,
+    3258, 3264, 3262,
+    3265, 3262, 3264,
+    3266, 3263, 3262,
+    3262, 3265, 3266,
+    3261, 3263, 3267,
+    3268, 3267, 3263,
+    3263, 3266, 3268,
+    3260, 3261, 3269,
+    3267, 3269, 3261,
+    3260, 3270, 3259,
+    3270, 3260, 3271,
+    3269, 3271, 3260,
+    3271, 3269, 3272,
+    3273, 3272, 3269,
+    3269, 3267, 3273,
+    3274, 3273, 3267,
+    3267, 3268, 3274,
+    3275, 3268, 3266,
+    3276, 3274, 3268,
+    3268, 3275, 3276,
+    3277, 3266, 3265,
+    3266, 3277, 3275,
+    3278, 3275, 3277,
+    3279, 3276, 3275,
+    3275, 3278, 3279,
+    3274, 3276, 3280,
+    3281, 3280, 3276,
+    3276, 3279, 3281,
+    3273, 3274, 3282,
+    3280, 3282, 3274,
+    3272, 3273, 3283,
+    3282, 3283, 3273,
+    3283, 3282, 3284,
+    3285, 3284, 3282,
+    3282, 3280, 3285,
+    3286, 3285, 3280,
+    3280, 3281, 3286,
+    3287, 3281, 3279,
+    3288, 3286, 3281,
+    3281, 3287, 3288,
+    3289, 3279, 3278,
+    3279, 3289, 3287,
+    3290, 3287, 3289,
+    3291, 3288, 3287,
+    3287, 3290, 3291,
+    3286, 3288, 3292,
+    3293, 3292, 3288,
+    3288, 3291, 3293,
+    3285, 3286, 3294,
+    3292, 3294, 3286,
+    3284, 3285, 3295,
+    3294, 3295, 3285,
+    3295, 3294, 3296,
+    3297, 3296, 3294,
+    3294, 3292, 3297,
+    3298, 3297, 3292,
+    3292, 3293, 3298,
+    3299, 3293, 3291,
+    3300, 3298, 3293,
+    3293, 3299, 3300,
+    3301, 3291, 3290,
+    3291, 3301, 3299,
+    3302, 3299, 3301,
+    3303, 3300, 3299,
+    3299, 3302, 3303,
+    3298, 3300, 3304,
+    3305, 3304, 3300,
+    3300, 3303, 3305,
+    3297, 3298, 3306,
+    3304, 3306, 3298,
+    3296, 3297, 3307,
+    3306, 3307, 3297,
+    3307, 3306, 3308,
+    3309, 3308, 3306,
+    3306, 3304, 3309,
+    3310, 3309, 3304,
+    3304, 3305, 3310,
+    3308, 3311, 3307,
+    3307, 3312, 3296,
+    3312, 3307, 3311,
+    3311, 3313, 3312,
+    3312, 3314, 3315,
+    3315, 3296, 3312,
+    3314, 3312, 3313,
+    3296, 3315, 3295,
+    3315, 3316, 3317,
+    3317, 3295, 3315,
+    3316, 3315, 3314,
+    3314, 3318, 3316,
+    3318, 3314, 3319,
+    3313, 3319, 3314,
+    3316, 3320, 3321,
+    3321, 3317, 3316,
+    3320, 3316, 3318,
+    3317, 3321, 3322,
+    3322, 3284, 3317,
+    3295, 3317, 3284,
+    3321, 3323, 3324,
+    3324, 3322, 3321,
+    3323, 3321, 3320,
+    3320, 3325, 3323,
+    3325, 3320, 3326,
+    3318, 3326, 3320,
+    3326, 3318, 3327,
+    3319, 3327, 3318,
+    3326, 3328, 3325,
+    3328, 3326, 3329,
+    3327, 3329, 3326,
+    3325, 3330, 3331,
+    3331, 3323, 3325,
+    3330, 3325, 3328,
+    3323, 3331, 3332,
+    3332, 3324, 3323,
+    3324, 3332, 3333,
+    3333, 3334, 3324,
+    3322, 3324, 3334,
+    3332, 3335, 3336,
+    3336, 3333, 3332,
+    3335, 3332, 3331,
+    3331, 3337, 3335,
+    3337, 3331, 3330,
+    3330, 3338, 3337,
+    3338, 3330, 3339,
+    3328, 3339, 3330,
+    3339, 3328, 3340,
+    3329, 3340, 3328,
+    3339, 3341, 3338,
+    3341, 3339, 3342,
+    3340, 3342, 3339,
+    3342, 3343, 3341,
+    3344, 3342, 3345,
+    3346, 3345, 3342,
+    3342, 3347, 3346,
+    3345, 3348, 3344,
+    3348, 3345, 3349,
+    3350, 3349, 3345,
+    3345, 3346, 3350,
+    3351, 3346, 3347,
+    3352, 3350, 3346,
+    3346, 3351, 3352,
+    3347, 3353, 3351,
+    3354, 3351, 3353,
+    3355, 3352, 3351,
+    3351, 3354, 3355,
+    3350, 3352, 3356,
+    3357, 3356, 3352,
+    3352, 3355, 3357,
+    3349, 3350, 3358,
+    3356, 3358, 3350,
+    3349, 3359, 3348,
+    3359, 3349, 3360,
+    3358, 3360, 3349,
+    3360, 3358, 3361,
+    3362, 3361, 3358,
+    3358, 3356, 3362,
+    3363, 3362, 3356,
+    3356, 3357, 3363,
+    3364, 3357, 3355,
+    3365, 3363, 3357,
+    3357, 3364, 3365,
+    3366, 3355, 3354,
+    3355, 3366, 3364,
+    3367, 3364, 3366,
+    3368, 3365, 3364,
+    3364, 3367, 3368,
+    3363, 3365, 3369,
+    3370, 3369, 3365,
+    3365, 3368, 3370,
+    3362, 3363, 3371,
+    3369, 3371, 3363,
+    3361, 3362, 3372,
+    3371, 3372, 3362,
+    3372, 3371, 3373,
+    3374, 3373, 3371,
+    3371, 3369, 3374,
+    3375, 3374, 3369,
+    3369, 3370, 3375,
+    3376, 3370, 3368,
+    3377, 3375, 3370,
+    3370, 3376, 3377,
+    3378, 3368, 3367,
+    3368, 3378, 3376,
+    3379, 3376, 3378,
+    3380, 3377, 3376,
+    3376, 3379, 3380,
+    3375, 3377, 3381,
+    3382, 3381, 3377,
+    3377, 3380, 3382,
+    3374, 3375, 3383,
+    3381, 3383, 3375,
+    3373, 3374, 3384,
+    3383, 3384, 3374,
+    3384, 3383, 3385,
+    3386, 3385, 3383,
+    3383, 3381, 3386,
+    3387, 3386, 3381,
+    3381, 3382, 3387,
+    3388, 3382, 3380,
+    3389, 3387, 3382,
+    3382, 3388, 3389,
+    3390, 3380, 3379,
+    3380, 3390, 3388,
+    3391, 3388, 3390,
+    3392, 3389, 3388,
+    3388, 3391, 3392,
+    3387, 3389, 3393,
+    3394, 3393, 3389,
+    3389, 3392, 3394,
+    3386, 3387, 3395,
+    3393, 3395, 3387,
+    3385, 3386, 3396,
+    3395, 3396, 3386,
+    3396, 3395, 3397,
+    3398, 3397, 3395,
+    3395, 3393, 3398,
+    3399, 3398, 3393,
+    3393, 3394, 3399,
+    3397, 3400, 3396,
+    3396, 3401, 3385,
+    3401, 3396, 3400,
+    3400, 3402, 3401,
+    3401, 3403, 3404,
+    3404, 3385, 3401,
+    3403, 3401, 3402,
+    3385, 3404, 3384,
+    3404, 3405, 3406,
+    3406, 3384, 3404,
+    3405, 3404, 3403,
+    3403, 3407, 3405,
+    3407, 3403, 3408,
+    3402, 3408, 3403,
+    3405, 3409, 3410,
+    3410, 3406, 3405,
+    3409, 3405, 3407,
+    3406, 3410, 3411,
+    3411, 3373, 3406,
+    3384, 3406, 3373,
+    3410, 3412, 3413,
+    3413, 3411, 3410,
+    3412, 3410, 3409,
+    3409, 3414, 3412,
+    3414, 3409, 3415,
+    3407, 3415, 3409,
+    3415, 3407, 3416,
+    3408, 3416, 3407,
+    3415, 3417, 3414,
+    3417, 3415, 3418,
+    3416, 3418, 3415,
+    3414, 3419, 3420,
+    3420, 3412, 3414,
+    3419, 3414, 3417,
+    3412, 3420, 3421,
+    3421, 3413, 3412,
+    3413, 3421, 3422,
+    3422, 3423, 3413,
+    3411, 3413, 3423,
+    3421, 3424, 3425,
+    3425, 3422, 3421,
+    3424, 3421, 3420,
+    3420, 3426, 3424,
+    3426, 3420, 3419,
+    3419, 3427, 3426,
+    3427, 3419, 3428,
+    3417, 3428, 3419,
+    3428, 3417, 3429,
+    3418, 3429, 3417,
+    3428, 3430, 3427,
+    3430, 3428, 3431,
+    3429, 3431, 3428,
+    3431, 3432, 3430,
+    3433, 3431, 3434,
+    3435, 3434, 3431,
+    3431, 3436, 3435,
+    3434, 3437, 3433,
+    3437, 3434, 3438,
+    3439, 3438, 3434,
+    3434, 3435, 3439,
+    3440, 3435, 3436,
+    3441, 3439, 3435,
+    3435, 3440, 3441,
+    3436, 3442, 3440,
+    3443, 3440, 3442,
+    3444, 3441, 3440,
+    3440, 3443, 3444,
+    3439, 3441, 3445,
+    3446, 3445, 3441,
+    3441, 3444, 3446,
+    3438, 3439, 3447,
+    3445, 3447, 3439,
+    3438, 3448, 3437,
+    3448, 3438, 3449,
+    3447, 3449, 3438,
+    3449, 3447, 3450,
+    3451, 3450, 3447,
+    3447, 3445, 3451,
+    3452, 3451, 3445,
+    3445, 3446, 3452,
+    3453, 3446, 3444,
+    3454, 3452, 3446,
+    3446, 3453, 3454,
+    3455, 3444, 3443,
+    3444, 3455, 3453,
+    3456, 3453, 3455,
+    3457, 3454, 3453,
+    3453, 3456, 3457,
+    3452, 3454, 3458,
+    3459, 3458, 3454,
+    3454, 3457, 3459,
+    3451, 3452, 3460,
+    3458, 3460, 3452,
+    3450, 3451, 3461,
+    3460, 3461, 3451,
+    3461, 3460, 3462,
+    3463, 3462, 3460,
+    3460, 3458, 3463,
+    3464, 3463, 3458,
+    3458, 3459, 3464,
+    3465, 3459, 3457,
+    3466, 3464, 3459,
+    3459, 3465, 3466,
+    3467, 3457, 3456,
+    3457, 3467, 3465,
+    3468, 3465, 3467,
+    3469, 3466, 3465,
+    3465, 3468, 3469,
+    3464, 3466, 3470,
+    3471, 3470, 3466,
+    3466, 3469, 3471,
+    3463, 3464, 3472,
+    3470, 3472, 3464,
+    3462, 3463, 3473,
+    3472, 3473, 3463,
+    3473, 3472, 3474,
+    3475, 3474, 3472,
+    3472, 3470, 3475,
+    3476, 3475, 3470,
+    3470, 3471, 3476,
+    3477, 3471, 3469,
+    3478, 3476, 3471,
+    3471, 3477, 3478,
+    3479, 3469, 3468,
+    3469, 3479, 3477,
+    3480, 3477, 3479,
+    3481, 3478, 3477,
+    3477, 3480, 3481,
+    3476, 3478, 3482,
+    3483, 3482, 3478,
+    3478, 3481, 3483,
+    3475, 3476, 3484,
+    3482, 3484, 3476,
+    3474, 3475, 3485,
+    3484, 3485, 3475,
+    3485, 3484, 3486,
+    3487, 3486, 3484,
+    3484, 3482, 3487,
+    3488, 3487, 3482,
+    3482, 3483, 3488,
+    3486, 3489, 3485,
+    3485, 3490, 3474,
+    3490, 3485, 3489,
+    3489, 3491, 3490,
+    3490, 3492, 3493,
+    3493, 3474, 3490,
+    3492, 3490, 3491,
+    3474, 3493, 3473,
+    3493, 3494, 3495,
+    3495, 3473, 3493,
+    3494, 3493, 3492,
+    3492, 3496, 3494,
+    3496, 3492, 3497,
+    3491, 3497, 3492,
+    3494, 3498, 3499,
+    3499, 3495, 3494,
+    3498, 3494, 3496,
+    3495, 3499, 3500,
+    3500, 3462, 3495,
+    3473, 3495, 3462,
+    3499, 3501, 3502,
+    3502, 3500, 3499,
+    3501, 3499, 3498,
+    3498, 3503, 3501,
+    3503, 3498, 3504,
+    3496, 3504, 3498,
+    3504, 3496, 3505,
+    3497, 3505, 3496,
+    3504, 3506, 3503,
+    3506, 3504, 3507,
+    3505, 3507, 3504,
+    3503, 3508, 3509,
+    3509, 3501, 3503,
+    3508, 3503, 3506,
+    3501, 3509, 3510,
+    3510, 3502, 3501,
+    3502, 3510, 3511,
+    3511, 3512, 3502,
+    3500, 3502, 3512,
+    3510, 3513, 3514,
+    3514, 3511, 3510,
+    3513, 3510, 3509,
+    3509, 3515, 3513,
+    3515, 3509, 3508,
+    3508, 3516, 3515,
+    3516, 3508, 3517,
+    3506, 3517, 3508,
+    3517, 3506, 3518,
+    3507, 3518, 3506,
+    3517, 3519, 3516,
+    3519, 3517, 3167,
+    3518, 3167, 3517,
+    3167, 3520, 3519,
+    3511, 3514, 3521,
+    3521, 3522, 3511,
+    3512, 3511, 3522,
+    3522, 3521, 3523,
+    3523, 3449, 3522,
+    3450, 3522, 3449,
+    3522, 3450, 3512,
+    3449, 3523, 3448,
+    3461, 3512, 3450,
+    3512, 3461, 3500,
+    3462, 3500, 3461,
+    3479, 3524, 3480,
+    3468, 3525, 3479,
+    3524, 3479, 3525,
+    3525, 3526, 3524,
+    3525, 3468, 3527,
+    3527, 3528, 3525,
+    3526, 3525, 3528,
+    3467, 3527, 3468,
+    3527, 3467, 3529,
+    3529, 3530, 3527,
+    3528, 3527, 3530,
+    3530, 3531, 3528,
+    3532, 3528, 3531,
+    3528, 3532, 3526,
+    3530, 3529, 3533,
+    3533, 3534, 3530,
+    3531, 3530, 3534,
+    3529, 3456, 3535,
+    3535, 3533, 3529,
+    3456, 3529, 3467,
+    3533, 3535, 3536,
+    3536, 3537, 3533,
+    3534, 3533, 3537,
+    3537, 3538, 3534,
+    3539, 3534, 3538,
+    3534, 3539, 3531,
+    3540, 3531, 3539,
+    3531, 3540, 3532,
+    3538, 3541, 3539,
+    3542, 3539, 3541,
+    3539, 3542, 3540,
+    3538, 3537, 3543,
+    3543, 3544, 3538,
+    3541, 3538, 3544,
+    3537, 3536, 3545,
+    3545, 3543, 3537,
+    3536, 3546, 3547,
+    3547, 3545, 3536,
+    3546, 3536, 3535,
+    3546, 3443, 3548,
+    3548, 3547, 3546,
+    3443, 3546, 3455,
+    3535, 3455, 3546,
+    3442, 3548, 3443,
+    3455, 3535, 3456,
+    3544, 3549, 3541,
+    3550, 3541, 3549,
+    3549, 3551, 3550,
+    3541, 3550, 3542,
+    3422, 3425, 3552,
+    3552, 3553, 3422,
+    3423, 3422, 3553,
+    3553, 3552, 3554,
+    3554, 3360, 3553,
+    3361, 3553, 3360,
+    3553, 3361, 3423,
+    3372, 3423, 3361,
+    3423, 3372, 3411,
+    3373, 3411, 3372,
+    3360, 3554, 3359,
+    3390, 3555, 3391,
+    3379, 3556, 3390,
+    3555, 3390, 3556,
+    3556, 3557, 3555,
+    3556, 3379, 3558,
+    3558, 3559, 3556,
+    3557, 3556, 3559,
+    3378, 3558, 3379,
+    3558, 3378, 3560,
+    3560, 3561, 3558,
+    3559, 3558, 3561,
+    3561, 3562, 3559,
+    3563, 3559, 3562,
+    3559, 3563, 3557,
+    3561, 3560, 3564,
+    3564, 3565, 3561,
+    3562, 3561, 3565,
+    3560, 3367, 3566,
+    3566, 3564, 3560,
+    3367, 3560, 3378,
+    3564, 3566, 3567,
+    3567, 3568, 3564,
+    3565, 3564, 3568,
+    3568, 3569, 3565,
+    3570, 3565, 3569,
+    3565, 3570, 3562,
+    3571, 3562, 3570,
+    3562, 3571, 3563,
+    3569, 3572, 3570,
+    3573, 3570, 3572,
+    3570, 3573, 3571,
+    3569, 3568, 3574,
+    3574, 3575, 3569,
+    3572, 3569, 3575,
+    3568, 3567, 3576,
+    3576, 3574, 3568,
+    3567, 3577, 3578,
+    3578, 3576, 3567,
+    3577, 3567, 3566,
+    3577, 3354, 3579,
+    3579, 3578, 3577,
+    3354, 3577, 3366,
+    3566, 3366, 3577,
+    3353, 3579, 3354,
+    3366, 3566, 3367,
+    3575, 3580, 3572,
+    3581, 3572, 3580,
+    3580, 3582, 3581,
+    3572, 3581, 3573,
+    3333, 3336, 3583,
+    3583, 3584, 3333,
+    3334, 3333, 3584,
+    3584, 3583, 3585,
+    3585, 3271, 3584,
+    3272, 3584, 3271,
+    3584, 3272, 3334,
+    3283, 3334, 3272,
+    3334, 3283, 3322,
+    3284, 3322, 3283,
+    3271, 3585, 3270,
+    3301, 3586, 3302,
+    3290, 3587, 3301,
+    3586, 3301, 3587,
+    3587, 3588, 3586,
+    3587, 3290, 3589,
+    3589, 3590, 3587,
+    3588, 3587, 3590,
+    3289, 3589, 3290,
+    3589, 3289, 3591,
+    3591, 3592, 3589,
+    3590, 3589, 3592,
+    3592, 3593, 3590,
+    3594, 3590, 3593,
+    3590, 3594, 3588,
+    3592, 3591, 3595,
+    3595, 3596, 3592,
+    3593, 3592, 3596,
+    3591, 3278, 3597,
+    3597, 3595, 3591,
+    3278, 3591, 3289,
+    3595, 3597, 3598,
+    3598, 3599, 3595,
+    3596, 3595, 3599,
+    3599, 3600, 3596,
+    3601, 3596, 3600,
+    3596, 3601, 3593,
+    3602, 3593, 3601,
+    3593, 3602, 3594,
+    3600, 3603, 3601,
+    3604, 3601, 3603,
+    3601, 3604, 3602,
+    3600, 3599, 3605,
+    3605, 3606, 3600,
+    3603, 3600, 3606,
+    3599, 3598, 3607,
+    3607, 3605, 3599,
+    3598, 3608, 3609,
+    3609, 3607, 3598,
+    3608, 3598, 3597,
+    3608, 3265, 3610,
+    3610, 3609, 3608,
+    3265, 3608, 3277,
+    3597, 3277, 3608,
+    3264, 3610, 3265,
+    3277, 3597, 3278,
+    3606, 3611, 3603,
+    3612, 3603, 3611,
+    3611, 3613, 3612,
+    3603, 3612, 3604,
+    3238, 3253, 3237,
+    3244, 3246, 3614,
+    3614, 3172, 3244,
+    3182, 3244, 3172,
+    3172, 3614, 3171,
+    3213, 3615, 3214,
+    3202, 3616, 3213,
+    3615, 3213, 3616,
+    3616, 3617, 3615,
+    3616, 3202, 3618,
+    3618, 3619, 3616,
+    3617, 3616, 3619,
+    3201, 3618, 3202,
+    3618, 3201, 3620,
+    3620, 3621, 3618,
+    3619, 3618, 3621,
+    3621, 3622, 3619,
+    3623, 3619, 3622,
+    3619, 3623, 3617,
+    3621, 3620, 3624,
+    3624, 3625, 3621,
+    3622, 3621, 3625,
+    3620, 3190, 3626,
+    3626, 3624, 3620,
+    3190, 3620, 3201,
+    3624, 3626, 3627,
+    3627, 3628, 3624,
+    3625, 3624, 3628,
+    3628, 3629, 3625,
+    3630, 3625, 3629,
+    3625, 3630, 3622,
+    3631, 3622, 3630,
+    3622, 3631, 3623,
+    3629, 3632, 3630,
+    3633, 3630, 3632,
+    3630, 3633, 3631,
+    3629, 3628, 3634,
+    3634, 3635, 3629,
+    3632, 3629, 3635,
+    3628, 3627, 3636,
+    3636, 3634, 3628,
+    3627, 3637, 3638,
+    3638, 3636, 3627,
+    3637, 3627, 3626,
+    3637, 3188, 3639,
+    3639, 3638, 3637,
+    3188, 3637, 3189,
+    3626, 3189, 3637,
+    3188, 3177, 3640,
+    3640, 3639, 3188,
+    3176, 3640, 3177,
+    3189, 3626, 3190,
+    3635, 3641, 3632,
+    3642, 3632, 3641,
+    3641, 3643, 3642,
+    3632, 3642, 3633,
+    0, 1, 2,
+    2, 3, 0,
+    1, 0, 4,
+    5, 0, 3,
+    6, 4, 0,
+    0, 5, 6,
+    4, 7, 1,
+    7, 4, 8,
+    9, 8, 4,
+    4, 6, 9,
+    10, 6, 5,
+    11, 9, 6,
+    6, 10, 11,
+    12, 5, 3,
+    5, 12, 10,
+    3, 13, 12,
+    14, 12, 13,
+    15, 10, 12,
+    12, 14, 15,
+    16, 11, 10,
+    10, 15, 16,
+    9, 11, 17,
+    18, 17, 11,
+    11, 16, 18,
+    8, 9, 19,
+    17, 19, 9,
+    8, 20, 7,
+    19, 20, 8,
+    20, 19, 21,
+    22, 21, 19,
+    23, 22, 19,
+    19, 17, 23,
+    24, 23, 17,
+    17, 18, 24,
+    25, 18, 16,
+    26, 24, 18,
+    18, 25, 26,
+    27, 16, 15,
+    16, 27, 25,
+    27, 28, 25,
+    29, 26, 25,
+    30, 25, 28,
+    31, 29, 25,
+    25, 30, 31,
+    24, 26, 32,
+    26, 29, 32,
+    23, 24, 33,
+    32, 33, 24,
+    22, 23, 34,
+    33, 34, 23,
+    34, 33, 35,
+    36, 35, 33,
+    33, 32, 36,
+    37, 36, 32,
+    38, 32, 29,
+    39, 37, 32,
+    32, 38, 39,
+    29, 31, 38,
+    40, 31, 30,
+    41, 38, 31,
+    31, 40, 41,
+    42, 39, 38,
+    38, 41, 42,
+    37, 39, 43,
+    44, 43, 39,
+    39, 42, 44,
+    36, 37, 45,
+    43, 45, 37,
+    35, 36, 45,
+    45, 46, 35,
+    46, 45, 47,
+    48, 47, 45,
+    49, 48, 45,
+    45, 43, 49,
+    50, 49, 43,
+    43, 44, 50,
+    51, 44, 42,
+    52, 50, 44,
+    44, 51, 52,
+    53, 42, 41,
+    42, 53, 51,
+    54, 51, 53,
+    55, 52, 51,
+    51, 54, 55,
+    50, 52, 56,
+    52, 55, 56,
+    49, 50, 57,
+    56, 57, 50,
+    48, 49, 58,
+    57, 58, 49,
+    47, 48, 58,
+    58, 59, 47,
+    59, 60, 61,
+    61, 62, 59,
+    62, 47, 59,
+    63, 59, 64,
+    65, 64, 59,
+    59, 66, 65,
+    60, 67, 68,
+    68, 61, 60,
+    61, 68, 69,
+    69, 70, 61,
+    62, 61, 70,
+    70, 46, 62,
+    47, 62, 46,
+    70, 69, 22,
+    22, 71, 70,
+    46, 70, 71,
+    69, 72, 73,
+    72, 69, 68,
+    73, 22, 69,
+    68, 74, 72,
+    74, 68, 67,
+    67, 75, 76,
+    76, 74, 67,
+    74, 76, 77,
+    77, 72, 74,
+    72, 77, 78,
+    78, 73, 72,
+    73, 78, 79,
+    79, 80, 73,
+    22, 73, 80,
+    22, 80, 21,
+    22, 34, 71,
+    35, 71, 34,
+    71, 35, 46,
+    21, 81, 82,
+    82, 20, 21,
+    81, 21, 80,
+    80, 79, 81,
+    64, 65, 83,
+    84, 65, 66,
+    65, 84, 83,
+    64, 85, 63,
+    85, 64, 86,
+    83, 86, 64,
+    86, 83, 87,
+    88, 87, 83,
+    89, 83, 84,
+    90, 88, 83,
+    83, 89, 90,
+    91, 84, 66,
+    84, 91, 89,
+    66, 92, 91,
+    93, 91, 92,
+    94, 89, 91,
+    91, 93, 94,
+    95, 90, 89,
+    89, 94, 95,
+    88, 90, 96,
+    97, 96, 90,
+    90, 95, 97,
+    87, 88, 98,
+    96, 98, 88,
+    87, 99, 86,
+    99, 87, 98,
+    98, 100, 99,
+    100, 98, 101,
+    102, 101, 98,
+    103, 102, 98,
+    98, 96, 103,
+    104, 103, 96,
+    96, 97, 104,
+    105, 97, 95,
+    106, 104, 97,
+    97, 105, 106,
+    107, 95, 94,
+    95, 107, 105,
+    108, 105, 107,
+    109, 106, 105,
+    105, 108, 109,
+    104, 106, 110,
+    111, 110, 106,
+    106, 109, 111,
+    103, 104, 112,
+    110, 112, 104,
+    102, 103, 113,
+    112, 113, 103,
+    101, 102, 114,
+    113, 114, 102,
+    114, 113, 115,
+    116, 115, 113,
+    113, 112, 116,
+    117, 116, 112,
+    112, 110, 117,
+    118, 117, 110,
+    110, 111, 118,
+    119, 111, 109,
+    120, 118, 111,
+    111, 119, 120,
+    121, 109, 108,
+    109, 121, 119,
+    108, 122, 121,
+    122, 108, 123,
+    123, 124, 122,
+    123, 107, 125,
+    125, 126, 123,
+    107, 123, 108,
+    124, 123, 126,
+    126, 127, 124,
+    126, 125, 128,
+    128, 129, 126,
+    127, 126, 129,
+    125, 94, 93,
+    93, 128, 125,
+    94, 125, 107,
+    128, 93, 130,
+    130, 131, 128,
+    129, 128, 131,
+    131, 132, 129,
+    133, 129, 132,
+    129, 133, 127,
+    132, 134, 133,
+    135, 133, 134,
+    135, 136, 133,
+    137, 134, 138,
+    134, 139, 135,
+    136, 135, 140,
+    141, 135, 139,
+    135, 141, 142,
+    143, 140, 135,
+    135, 142, 143,
+    136, 140, 144,
+    145, 144, 140,
+    140, 143, 145,
+    146, 143, 142,
+    147, 145, 143,
+    143, 146, 147,
+    148, 142, 141,
+    142, 148, 146,
+    139, 149, 141,
+    150, 141, 149,
+    141, 150, 148,
+    151, 148, 150,
+    152, 146, 148,
+    148, 151, 152,
+    153, 147, 146,
+    146, 152, 153,
+    145, 147, 154,
+    155, 154, 147,
+    147, 153, 155,
+    144, 145, 156,
+    154, 156, 145,
+    156, 154, 157,
+    158, 157, 154,
+    154, 155, 158,
+    159, 155, 153,
+    160, 158, 155,
+    155, 159, 160,
+    161, 153, 152,
+    153, 161, 159,
+    161, 162, 159,
+    163, 160, 159,
+    164, 159, 162,
+    159, 164, 163,
+    158, 160, 165,
+    166, 165, 160,
+    160, 163, 166,
+    157, 158, 167,
+    165, 167, 158,
+    167, 165, 168,
+    169, 168, 165,
+    165, 166, 169,
+    167, 170, 157,
+    170, 167, 168,
+    168, 171, 170,
+    171, 168, 172,
+    173, 172, 168,
+    174, 173, 168,
+    168, 169, 174,
+    170, 175, 176,
+    176, 157, 170,
+    175, 170, 171,
+    171, 177, 175,
+    177, 171, 178,
+    172, 178, 171,
+    178, 172, 179,
+    180, 179, 172,
+    172, 173, 180,
+    173, 174, 180,
+    181, 180, 174,
+    181, 182, 183,
+    183, 184, 181,
+    185, 181, 186,
+    187, 188, 182,
+    188, 183, 182,
+    183, 188, 189,
+    189, 190, 183,
+    184, 183, 190,
+    190, 191, 184,
+    189, 192, 190,
+    191, 190, 192,
+    189, 193, 194,
+    194, 195, 189,
+    193, 189, 188,
+    192, 189, 195,
+    188, 187, 193,
+    187, 196, 197,
+    197, 193, 187,
+    193, 197, 194,
+    194, 198, 199,
+    199, 200, 194,
+    198, 194, 197,
+    200, 201, 194,
+    195, 194, 201,
+    201, 202, 195,
+    203, 195, 202,
+    195, 203, 204,
+    195, 204, 192,
+    201, 200, 205,
+    205, 206, 201,
+    207, 201, 206,
+    201, 207, 202,
+    200, 199, 208,
+    208, 205, 200,
+    209, 208, 199,
+    199, 210, 209,
+    210, 199, 198,
+    210, 198, 197,
+    210, 211, 212,
+    212, 209, 210,
+    210, 213, 211,
+    213, 210, 214,
+    197, 214, 210,
+    209, 215, 216,
+    216, 217, 209,
+    209, 212, 215,
+    208, 209, 217,
+    217, 218, 208,
+    205, 208, 218,
+    218, 219, 205,
+    206, 205, 219,
+    220, 206, 219,
+    219, 221, 220,
+    206, 220, 207,
+    222, 220, 221,
+    220, 222, 223,
+    224, 207, 220,
+    220, 223, 224,
+    225, 222, 221,
+    221, 226, 225,
+    227, 223, 222,
+    222, 225, 227,
+    228, 224, 223,
+    223, 227, 228,
+    207, 224, 202,
+    229, 202, 224,
+    224, 228, 229,
+    230, 203, 202,
+    202, 229, 230,
+    230, 231, 232,
+    231, 230, 233,
+    203, 230, 234,
+    234, 204, 203,
+    204, 234, 235,
+    235, 192, 204,
+    192, 235, 191,
+    233, 236, 231,
+    236, 233, 237,
+    236, 238, 239,
+    239, 231, 236,
+    238, 236, 240,
+    237, 240, 236,
+    240, 237, 241,
+    240, 242, 238,
+    242, 240, 243,
+    241, 243, 240,
+    238, 244, 245,
+    245, 239, 238,
+    244, 238, 242,
+    239, 245, 246,
+    246, 247, 239,
+    231, 239, 247,
+    245, 248, 249,
+    249, 246, 245,
+    248, 245, 244,
+    244, 250, 248,
+    250, 244, 251,
+    242, 251, 244,
+    251, 242, 243,
+    251, 252, 250,
+    252, 251, 253,
+    243, 253, 251,
+    250, 254, 255,
+    255, 248, 250,
+    254, 250, 252,
+    248, 255, 256,
+    256, 249, 248,
+    249, 256, 257,
+    257, 258, 249,
+    246, 249, 258,
+    259, 257, 256,
+    255, 254, 256,
+    260, 261, 254,
+    252, 260, 254,
+    260, 252, 262,
+    253, 262, 252,
+    262, 253, 263,
+    264, 263, 253,
+    253, 243, 264,
+    262, 261, 260,
+    261, 262, 265,
+    263, 265, 262,
+    265, 266, 261,
+    266, 265, 267,
+    268, 267, 265,
+    265, 263, 268,
+    269, 268, 263,
+    263, 264, 269,
+    270, 264, 243,
+    271, 269, 264,
+    264, 270, 271,
+    272, 270, 243,
+    243, 241, 272,
+    270, 272, 271,
+    226, 271, 272,
+    226, 273, 274,
+    274, 275, 226,
+    276, 277, 273,
+    277, 274, 273,
+    274, 277, 278,
+    278, 279, 274,
+    275, 274, 279,
+    279, 280, 275,
+    278, 281, 279,
+    280, 279, 281,
+    278, 282, 283,
+    283, 284, 278,
+    282, 278, 277,
+    281, 278, 284,
+    277, 276, 282,
+    276, 285, 286,
+    286, 282, 276,
+    282, 286, 283,
+    283, 287, 288,
+    288, 289, 283,
+    287, 283, 286,
+    289, 290, 283,
+    284, 283, 290,
+    290, 291, 284,
+    292, 284, 291,
+    284, 292, 293,
+    284, 293, 281,
+    290, 289, 294,
+    294, 295, 290,
+    296, 290, 295,
+    290, 296, 291,
+    289, 288, 297,
+    297, 294, 289,
+    298, 297, 288,
+    288, 299, 298,
+    299, 288, 287,
+    299, 287, 286,
+    299, 300, 301,
+    301, 298, 299,
+    299, 302, 300,
+    302, 299, 303,
+    286, 303, 299,
+    298, 304, 305,
+    305, 306, 298,
+    298, 301, 304,
+    297, 298, 306,
+    306, 307, 297,
+    294, 297, 307,
+    307, 308, 294,
+    295, 294, 308,
+    309, 295, 308,
+    308, 310, 309,
+    295, 309, 296,
+    311, 309, 310,
+    309, 311, 312,
+    313, 296, 309,
+    309, 312, 313,
+    314, 311, 310,
+    310, 315, 314,
+    316, 312, 311,
+    311, 314, 316,
+    317, 313, 312,
+    312, 316, 317,
+    296, 313, 291,
+    318, 291, 313,
+    313, 317, 318,
+    319, 292, 291,
+    291, 318, 319,
+    319, 320, 321,
+    320, 319, 322,
+    292, 319, 323,
+    323, 293, 292,
+    293, 323, 324,
+    324, 281, 293,
+    281, 324, 280,
+    322, 325, 320,
+    325, 322, 326,
+    325, 327, 328,
+    328, 320, 325,
+    327, 325, 329,
+    326, 329, 325,
+    329, 326, 330,
+    329, 331, 327,
+    331, 329, 332,
+    330, 332, 329,
+    327, 333, 334,
+    334, 328, 327,
+    333, 327, 331,
+    328, 334, 335,
+    335, 336, 328,
+    320, 328, 336,
+    334, 337, 338,
+    338, 335, 334,
+    337, 334, 333,
+    333, 339, 337,
+    339, 333, 340,
+    331, 340, 333,
+    340, 331, 332,
+    340, 341, 339,
+    341, 340, 342,
+    332, 342, 340,
+    339, 343, 344,
+    344, 337, 339,
+    343, 339, 341,
+    337, 344, 345,
+    345, 338, 337,
+    338, 345, 346,
+    346, 347, 338,
+    335, 338, 347,
+    348, 346, 345,
+    344, 343, 345,
+    349, 350, 343,
+    341, 349, 343,
+    349, 341, 351,
+    342, 351, 341,
+    351, 342, 352,
+    353, 352, 342,
+    342, 332, 353,
+    351, 350, 349,
+    350, 351, 354,
+    352, 354, 351,
+    354, 355, 350,
+    355, 354, 356,
+    357, 356, 354,
+    354, 352, 357,
+    358, 357, 352,
+    352, 353, 358,
+    359, 353, 332,
+    360, 358, 353,
+    353, 359, 360,
+    361, 359, 332,
+    332, 330, 361,
+    359, 361, 360,
+    315, 360, 361,
+    315, 362, 363,
+    363, 364, 315,
+    365, 366, 362,
+    366, 363, 362,
+    363, 366, 367,
+    367, 368, 363,
+    364, 363, 368,
+    368, 369, 364,
+    367, 370, 368,
+    369, 368, 370,
+    367, 371, 372,
+    372, 373, 367,
+    371, 367, 366,
+    370, 367, 373,
+    366, 365, 371,
+    365, 374, 375,
+    375, 371, 365,
+    371, 375, 372,
+    372, 376, 377,
+    377, 378, 372,
+    376, 372, 375,
+    378, 379, 372,
+    373, 372, 379,
+    379, 380, 373,
+    381, 373, 380,
+    373, 381, 382,
+    373, 382, 370,
+    379, 378, 383,
+    383, 384, 379,
+    385, 379, 384,
+    379, 385, 380,
+    378, 377, 386,
+    386, 383, 378,
+    387, 386, 377,
+    377, 388, 387,
+    388, 377, 376,
+    388, 376, 375,
+    388, 389, 390,
+    390, 387, 388,
+    388, 391, 389,
+    391, 388, 392,
+    375, 392, 388,
+    387, 393, 394,
+    394, 395, 387,
+    387, 390, 393,
+    386, 387, 395,
+    395, 396, 386,
+    383, 386, 396,
+    396, 397, 383,
+    384, 383, 397,
+    398, 384, 397,
+    397, 399, 398,
+    384, 398, 385,
+    400, 398, 399,
+    398, 400, 401,
+    402, 385, 398,
+    398, 401, 402,
+    403, 400, 399,
+    399, 404, 403,
+    405, 401, 400,
+    400, 403, 405,
+    406, 402, 401,
+    401, 405, 406,
+    385, 402, 380,
+    407, 380, 402,
+    402, 406, 407,
+    408, 381, 380,
+    380, 407, 408,
+    408, 409, 410,
+    409, 408, 411,
+    381, 408, 412,
+    412, 382, 381,
+    382, 412, 413,
+    413, 370, 382,
+    370, 413, 369,
+    411, 414, 409,
+    414, 411, 415,
+    414, 416, 417,
+    417, 409, 414,
+    416, 414, 418,
+    415, 418, 414,
+    418, 415, 419,
+    418, 420, 416,
+    420, 418, 421,
+    419, 421, 418,
+    416, 422, 423,
+    423, 417, 416,
+    422, 416, 420,
+    417, 423, 424,
+    424, 425, 417,
+    409, 417, 425,
+    423, 426, 427,
+    427, 424, 423,
+    426, 423, 422,
+    422, 428, 426,
+    428, 422, 429,
+    420, 429, 422,
+    429, 420, 421,
+    429, 430, 428,
+    430, 429, 431,
+    421, 431, 429,
+    428, 432, 433,
+    433, 426, 428,
+    432, 428, 430,
+    426, 433, 434,
+    434, 427, 426,
+    427, 434, 435,
+    435, 436, 427,
+    424, 427, 436,
+    437, 435, 434,
+    433, 432, 434,
+    438, 439, 432,
+    430, 438, 432,
+    438, 430, 440,
+    431, 440, 430,
+    440, 431, 441,
+    442, 441, 431,
+    431, 421, 442,
+    440, 439, 438,
+    439, 440, 443,
+    441, 443, 440,
+    443, 138, 439,
+    138, 443, 444,
+    445, 444, 443,
+    443, 441, 445,
+    446, 445, 441,
+    441, 442, 446,
+    447, 442, 421,
+    448, 446, 442,
+    442, 447, 448,
+    449, 447, 421,
+    421, 419, 449,
+    447, 449, 448,
+    404, 448, 449,
+    404, 450, 451,
+    451, 452, 404,
+    453, 454, 450,
+    454, 451, 450,
+    451, 454, 455,
+    455, 456, 451,
+    452, 451, 456,
+    456, 457, 452,
+    455, 458, 456,
+    457, 456, 458,
+    455, 459, 460,
+    460, 461, 455,
+    459, 455, 454,
+    458, 455, 461,
+    454, 453, 459,
+    453, 462, 463,
+    463, 459, 453,
+    459, 463, 460,
+    460, 464, 465,
+    465, 466, 460,
+    464, 460, 463,
+    466, 467, 460,
+    461, 460, 467,
+    467, 468, 461,
+    469, 461, 468,
+    461, 469, 470,
+    461, 470, 458,
+    467, 466, 471,
+    471, 472, 467,
+    473, 467, 472,
+    467, 473, 468,
+    466, 465, 474,
+    474, 471, 466,
+    475, 474, 465,
+    465, 476, 475,
+    476, 465, 464,
+    476, 464, 463,
+    476, 477, 478,
+    478, 475, 476,
+    476, 479, 477,
+    479, 476, 480,
+    463, 480, 476,
+    475, 481, 482,
+    482, 483, 475,
+    475, 478, 481,
+    474, 475, 483,
+    483, 484, 474,
+    471, 474, 484,
+    484, 485, 471,
+    472, 471, 485,
+    486, 472, 485,
+    485, 185, 486,
+    472, 486, 473,
+    487, 486, 185,
+    486, 487, 488,
+    489, 473, 486,
+    486, 488, 489,
+    186, 487, 185,
+    490, 488, 487,
+    487, 186, 490,
+    491, 489, 488,
+    488, 490, 491,
+    473, 489, 468,
+    492, 468, 489,
+    489, 491, 492,
+    164, 469, 468,
+    468, 492, 164,
+    469, 164, 493,
+    493, 470, 469,
+    470, 493, 494,
+    494, 458, 470,
+    458, 494, 457,
+    481, 495, 496,
+    496, 482, 481,
+    495, 481, 478,
+    497, 496, 495,
+    497, 495, 498,
+    495, 478, 477,
+    479, 498, 495,
+    495, 477, 479,
+    497, 498, 499,
+    500, 499, 498,
+    498, 479, 500,
+    480, 500, 479,
+    499, 500, 394,
+    501, 394, 500,
+    500, 480, 501,
+    480, 463, 501,
+    462, 501, 463,
+    502, 394, 393,
+    497, 502, 503,
+    393, 503, 502,
+    503, 393, 390,
+    497, 503, 504,
+    503, 390, 389,
+    391, 504, 503,
+    503, 389, 391,
+    497, 504, 505,
+    506, 505, 504,
+    504, 391, 506,
+    392, 506, 391,
+    505, 506, 305,
+    507, 305, 506,
+    506, 392, 507,
+    392, 375, 507,
+    374, 507, 375,
+    508, 305, 304,
+    497, 508, 509,
+    304, 509, 508,
+    509, 304, 301,
+    497, 509, 510,
+    509, 301, 300,
+    302, 510, 509,
+    509, 300, 302,
+    497, 510, 511,
+    512, 511, 510,
+    510, 302, 512,
+    303, 512, 302,
+    511, 512, 216,
+    513, 216, 512,
+    512, 303, 513,
+    303, 286, 513,
+    285, 513, 286,
+    514, 216, 215,
+    497, 514, 515,
+    215, 515, 514,
+    515, 215, 212,
+    497, 515, 516,
+    515, 212, 211,
+    213, 516, 515,
+    515, 211, 213,
+    497, 516, 517,
+    518, 517, 516,
+    516, 213, 518,
+    214, 518, 213,
+    517, 518, 482,
+    519, 482, 518,
+    518, 214, 519,
+    214, 197, 519,
+    196, 519, 197,
+    444, 137, 138,
+    437, 520, 435,
+    436, 435, 520,
+    520, 437, 521,
+    520, 521, 522,
+    522, 523, 520,
+    524, 520, 523,
+    520, 524, 525,
+    520, 525, 436,
+    526, 436, 525,
+    436, 526, 424,
+    527, 525, 524,
+    525, 527, 526,
+    523, 528, 524,
+    529, 524, 528,
+    524, 529, 527,
+    530, 527, 529,
+    531, 526, 527,
+    527, 530, 531,
+    425, 424, 526,
+    526, 531, 425,
+    530, 532, 531,
+    533, 425, 531,
+    534, 531, 532,
+    410, 533, 531,
+    531, 534, 410,
+    529, 535, 530,
+    532, 530, 535,
+    528, 536, 529,
+    535, 529, 536,
+    536, 537, 535,
+    538, 535, 537,
+    535, 538, 532,
+    539, 532, 538,
+    532, 539, 534,
+    540, 538, 537,
+    538, 540, 539,
+    537, 541, 540,
+    533, 410, 409,
+    425, 533, 409,
+    542, 522, 521,
+    543, 522, 355,
+    544, 542, 545,
+    521, 545, 542,
+    545, 521, 546,
+    545, 547, 544,
+    547, 545, 548,
+    546, 548, 545,
+    549, 544, 547,
+    547, 550, 549,
+    550, 547, 551,
+    548, 551, 547,
+    551, 548, 552,
+    553, 552, 548,
+    548, 546, 553,
+    551, 554, 550,
+    554, 551, 555,
+    552, 555, 551,
+    550, 556, 557,
+    557, 549, 550,
+    556, 550, 554,
+    554, 558, 556,
+    558, 554, 559,
+    555, 559, 554,
+    559, 555, 560,
+    561, 560, 555,
+    555, 552, 561,
+    562, 561, 552,
+    552, 553, 562,
+    560, 561, 563,
+    564, 563, 561,
+    561, 562, 564,
+    560, 565, 559,
+    565, 560, 566,
+    563, 566, 560,
+    559, 567, 558,
+    567, 559, 565,
+    558, 568, 569,
+    569, 556, 558,
+    568, 558, 567,
+    567, 28, 568,
+    28, 567, 30,
+    565, 30, 567,
+    30, 565, 40,
+    566, 40, 565,
+    40, 566, 570,
+    571, 570, 566,
+    566, 563, 571,
+    572, 571, 563,
+    563, 564, 572,
+    570, 571, 573,
+    574, 573, 571,
+    571, 572, 574,
+    570, 41, 40,
+    41, 570, 53,
+    573, 53, 570,
+    53, 573, 54,
+    575, 54, 573,
+    573, 574, 575,
+    576, 55, 54,
+    54, 575, 576,
+    55, 576, 577,
+    578, 56, 55,
+    577, 578, 55,
+    28, 27, 568,
+    15, 568, 27,
+    568, 15, 14,
+    14, 579, 568,
+    579, 569, 568,
+    13, 580, 14,
+    579, 14, 580,
+    580, 581, 579,
+    569, 579, 581,
+    556, 569, 581,
+    581, 557, 556,
+    580, 582, 583,
+    583, 584, 580,
+    584, 585, 580,
+    586, 580, 585,
+    582, 587, 588,
+    588, 583, 582,
+    583, 588, 589,
+    589, 590, 583,
+    584, 583, 590,
+    590, 591, 584,
+    585, 584, 591,
+    591, 592, 585,
+    593, 585, 592,
+    585, 593, 586,
+    593, 594, 586,
+    595, 586, 594,
+    594, 593, 592,
+    592, 591, 596,
+    596, 597, 592,
+    597, 598, 592,
+    599, 592, 598,
+    592, 599, 594,
+    591, 590, 600,
+    600, 596, 591,
+    590, 589, 601,
+    601, 600, 590,
+    601, 602, 600,
+    596, 600, 602,
+    602, 603, 596,
+    597, 596, 603,
+    603, 604, 597,
+    598, 597, 604,
+    605, 598, 604,
+    598, 605, 599,
+    606, 599, 605,
+    607, 594, 599,
+    599, 606, 607,
+    594, 607, 595,
+    608, 595, 607,
+    609, 607, 606,
+    607, 609, 608,
+    605, 610, 606,
+    611, 606, 610,
+    606, 611, 609,
+    604, 612, 605,
+    610, 605, 612,
+    612, 613, 610,
+    614, 610, 613,
+    610, 614, 611,
+    615, 611, 614,
+    616, 609, 611,
+    611, 615, 616,
+    609, 616, 608,
+    617, 608, 616,
+    618, 616, 615,
+    619, 617, 616,
+    616, 618, 619,
+    614, 620, 615,
+    621, 615, 620,
+    615, 621, 618,
+    613, 622, 614,
+    620, 614, 622,
+    613, 612, 623,
+    623, 624, 613,
+    622, 613, 624,
+    624, 625, 622,
+    626, 622, 625,
+    622, 626, 620,
+    627, 620, 626,
+    620, 627, 621,
+    625, 628, 626,
+    629, 626, 628,
+    626, 629, 627,
+    625, 624, 630,
+    630, 631, 625,
+    628, 625, 631,
+    624, 623, 632,
+    632, 630, 624,
+    623, 633, 634,
+    634, 632, 623,
+    633, 623, 612,
+    632, 634, 635,
+    635, 636, 632,
+    630, 632, 636,
+    636, 637, 630,
+    631, 630, 637,
+    637, 638, 631,
+    639, 631, 638,
+    631, 639, 628,
+    637, 636, 640,
+    640, 641, 637,
+    638, 637, 641,
+    636, 635, 642,
+    642, 640, 636,
+    635, 643, 642,
+    643, 635, 634,
+    642, 644, 645,
+    645, 646, 642,
+    644, 642, 643,
+    646, 647, 642,
+    640, 642, 647,
+    647, 648, 640,
+    641, 640, 648,
+    648, 649, 641,
+    650, 641, 649,
+    641, 650, 638,
+    648, 647, 651,
+    651, 652, 648,
+    649, 648, 652,
+    647, 646, 651,
+    646, 645, 653,
+    653, 651, 646,
+    645, 654, 655,
+    655, 653, 645,
+    654, 645, 644,
+    653, 656, 657,
+    657, 658, 653,
+    658, 659, 653,
+    660, 653, 659,
+    656, 661, 662,
+    662, 657, 656,
+    657, 662, 663,
+    663, 664, 657,
+    658, 657, 664,
+    664, 665, 658,
+    659, 658, 665,
+    665, 666, 659,
+    667, 659, 666,
+    659, 667, 660,
+    667, 668, 660,
+    669, 660, 668,
+    668, 667, 666,
+    666, 665, 670,
+    670, 671, 666,
+    671, 672, 666,
+    673, 666, 672,
+    666, 673, 668,
+    665, 664, 674,
+    674, 670, 665,
+    664, 663, 675,
+    675, 674, 664,
+    675, 676, 674,
+    670, 674, 676,
+    676, 677, 670,
+    671, 670, 677,
+    677, 678, 671,
+    672, 671, 678,
+    679, 672, 678,
+    672, 679, 673,
+    680, 673, 679,
+    681, 668, 673,
+    673, 680, 681,
+    668, 681, 669,
+    682, 669, 681,
+    683, 681, 680,
+    681, 683, 682,
+    679, 684, 680,
+    685, 680, 684,
+    680, 685, 683,
+    678, 686, 679,
+    684, 679, 686,
+    686, 687, 684,
+    688, 684, 687,
+    684, 688, 685,
+    689, 685, 688,
+    690, 683, 685,
+    685, 689, 690,
+    683, 690, 682,
+    691, 682, 690,
+    692, 690, 689,
+    693, 691, 690,
+    690, 692, 693,
+    688, 694, 689,
+    695, 689, 694,
+    689, 695, 692,
+    687, 696, 688,
+    694, 688, 696,
+    687, 686, 697,
+    697, 698, 687,
+    696, 687, 698,
+    698, 699, 696,
+    700, 696, 699,
+    696, 700, 694,
+    701, 694, 700,
+    694, 701, 695,
+    699, 702, 700,
+    703, 700, 702,
+    700, 703, 701,
+    699, 698, 704,
+    704, 705, 699,
+    702, 699, 705,
+    698, 697, 706,
+    706, 704, 698,
+    697, 707, 708,
+    708, 706, 697,
+    707, 697, 686,
+    706, 708, 709,
+    709, 710, 706,
+    704, 706, 710,
+    710, 711, 704,
+    705, 704, 711,
+    711, 712, 705,
+    713, 705, 712,
+    705, 713, 702,
+    711, 710, 714,
+    714, 715, 711,
+    712, 711, 715,
+    710, 709, 716,
+    716, 714, 710,
+    709, 717, 716,
+    717, 709, 708,
+    716, 718, 719,
+    719, 720, 716,
+    718, 716, 717,
+    720, 721, 716,
+    714, 716, 721,
+    721, 722, 714,
+    715, 714, 722,
+    722, 723, 715,
+    724, 715, 723,
+    715, 724, 712,
+    722, 721, 725,
+    725, 726, 722,
+    723, 722, 726,
+    721, 720, 725,
+    720, 719, 727,
+    727, 725, 720,
+    719, 728, 729,
+    729, 727, 719,
+    728, 719, 718,
+    727, 730, 731,
+    731, 732, 727,
+    732, 733, 727,
+    734, 727, 733,
+    730, 735, 736,
+    736, 731, 730,
+    731, 736, 737,
+    737, 738, 731,
+    732, 731, 738,
+    738, 739, 732,
+    733, 732, 739,
+    739, 740, 733,
+    741, 733, 740,
+    733, 741, 734,
+    741, 742, 734,
+    743, 734, 742,
+    742, 741, 740,
+    740, 739, 744,
+    744, 745, 740,
+    745, 746, 740,
+    747, 740, 746,
+    740, 747, 742,
+    739, 738, 748,
+    748, 744, 739,
+    738, 737, 749,
+    749, 748, 738,
+    749, 750, 748,
+    744, 748, 750,
+    750, 751, 744,
+    745, 744, 751,
+    751, 114, 745,
+    746, 745, 114,
+    115, 746, 114,
+    746, 115, 747,
+    752, 747, 115,
+    753, 742, 747,
+    747, 752, 753,
+    742, 753, 743,
+    754, 743, 753,
+    755, 753, 752,
+    753, 755, 754,
+    115, 116, 752,
+    756, 752, 116,
+    752, 756, 755,
+    757, 755, 756,
+    755, 757, 754,
+    758, 754, 757,
+    756, 759, 757,
+    760, 757, 759,
+    761, 758, 757,
+    757, 760, 761,
+    116, 117, 756,
+    759, 756, 117,
+    117, 118, 759,
+    762, 759, 118,
+    759, 762, 760,
+    118, 120, 762,
+    114, 751, 763,
+    763, 101, 114,
+    751, 750, 764,
+    764, 763, 751,
+    763, 764, 765,
+    765, 100, 763,
+    101, 763, 100,
+    764, 749, 766,
+    766, 765, 764,
+    749, 764, 750,
+    765, 766, 767,
+    767, 768, 765,
+    100, 765, 768,
+    768, 99, 100,
+    768, 767, 769,
+    769, 770, 768,
+    99, 768, 770,
+    767, 771, 772,
+    772, 769, 767,
+    771, 767, 766,
+    766, 773, 771,
+    773, 766, 774,
+    749, 774, 766,
+    771, 773, 775,
+    775, 772, 771,
+    772, 775, 776,
+    776, 777, 772,
+    769, 772, 777,
+    777, 778, 769,
+    770, 769, 778,
+    778, 85, 770,
+    86, 770, 85,
+    770, 86, 99,
+    778, 777, 779,
+    85, 778, 779,
+    777, 776, 780,
+    780, 779, 777,
+    779, 63, 85,
+    781, 773, 774,
+    774, 782, 781,
+    782, 774, 783,
+    749, 783, 774,
+    783, 784, 782,
+    784, 783, 785,
+    749, 785, 783,
+    785, 749, 737,
+    785, 786, 784,
+    786, 785, 787,
+    737, 787, 785,
+    787, 737, 736,
+    787, 788, 786,
+    788, 787, 789,
+    736, 789, 787,
+    789, 736, 735,
+    789, 790, 788,
+    790, 789, 735,
+    735, 791, 790,
+    718, 792, 728,
+    792, 718, 793,
+    717, 793, 718,
+    792, 794, 795,
+    795, 728, 792,
+    794, 792, 796,
+    793, 796, 792,
+    728, 795, 797,
+    797, 729, 728,
+    795, 798, 797,
+    798, 795, 794,
+    794, 799, 798,
+    799, 794, 800,
+    796, 800, 794,
+    800, 796, 801,
+    802, 801, 796,
+    796, 793, 802,
+    708, 802, 793,
+    793, 717, 708,
+    801, 802, 803,
+    804, 803, 802,
+    802, 708, 804,
+    801, 805, 800,
+    805, 801, 806,
+    803, 806, 801,
+    800, 807, 799,
+    807, 800, 805,
+    799, 808, 809,
+    809, 798, 799,
+    808, 799, 807,
+    807, 810, 808,
+    805, 810, 807,
+    810, 805, 811,
+    675, 811, 805,
+    806, 675, 805,
+    675, 806, 676,
+    677, 676, 806,
+    806, 803, 677,
+    678, 677, 803,
+    803, 804, 678,
+    707, 804, 708,
+    804, 707, 678,
+    686, 678, 707,
+    675, 812, 811,
+    675, 813, 812,
+    813, 675, 663,
+    811, 814, 815,
+    815, 810, 811,
+    814, 811, 812,
+    812, 816, 814,
+    816, 812, 813,
+    813, 817, 816,
+    817, 813, 818,
+    663, 818, 813,
+    818, 663, 662,
+    818, 819, 817,
+    819, 818, 820,
+    662, 820, 818,
+    820, 662, 661,
+    820, 821, 819,
+    821, 820, 661,
+    661, 822, 821,
+    798, 809, 823,
+    823, 797, 798,
+    726, 824, 723,
+    825, 723, 824,
+    824, 826, 825,
+    723, 825, 724,
+    827, 825, 826,
+    828, 724, 825,
+    825, 827, 828,
+    826, 829, 827,
+    830, 827, 829,
+    831, 828, 827,
+    827, 830, 831,
+    724, 828, 832,
+    833, 832, 828,
+    828, 831, 833,
+    832, 712, 724,
+    712, 832, 713,
+    834, 713, 832,
+    832, 833, 834,
+    835, 702, 713,
+    713, 834, 835,
+    702, 835, 703,
+    829, 836, 830,
+    837, 830, 836,
+    837, 259, 830,
+    838, 836, 839,
+    836, 840, 837,
+    841, 836, 842,
+    842, 836, 843,
+    844, 838, 839,
+    845, 839, 846,
+    839, 845, 844,
+    847, 844, 845,
+    846, 177, 845,
+    178, 845, 177,
+    845, 178, 847,
+    848, 846, 849,
+    177, 846, 848,
+    848, 175, 177,
+    175, 848, 849,
+    850, 849, 144,
+    176, 849, 850,
+    849, 176, 175,
+    156, 850, 144,
+    850, 156, 176,
+    157, 176, 156,
+    179, 847, 178,
+    843, 851, 842,
+    843, 852, 851,
+    852, 843, 853,
+    851, 854, 855,
+    855, 842, 851,
+    854, 851, 852,
+    842, 855, 841,
+    856, 857, 855,
+    856, 855, 854,
+    855, 858, 859,
+    860, 855, 859,
+    854, 861, 856,
+    852, 861, 854,
+    861, 852, 862,
+    853, 862, 852,
+    853, 863, 862,
+    863, 853, 864,
+    862, 865, 861,
+    865, 862, 863,
+    861, 866, 857,
+    857, 856, 861,
+    866, 861, 867,
+    867, 861, 865,
+    865, 868, 869,
+    869, 867, 865,
+    863, 868, 865,
+    868, 863, 870,
+    864, 870, 863,
+    870, 864, 871,
+    870, 872, 868,
+    872, 870, 873,
+    871, 873, 870,
+    868, 874, 875,
+    875, 869, 868,
+    868, 876, 874,
+    876, 868, 872,
+    869, 877, 878,
+    878, 866, 869,
+    877, 869, 875,
+    867, 869, 866,
+    866, 878, 857,
+    879, 878, 880,
+    881, 880, 878,
+    881, 878, 877,
+    878, 882, 883,
+    857, 878, 883,
+    877, 884, 881,
+    884, 877, 875,
+    875, 885, 884,
+    885, 875, 874,
+    884, 886, 880,
+    880, 881, 884,
+    886, 884, 885,
+    880, 887, 879,
+    887, 880, 886,
+    888, 879, 887,
+    879, 888, 889,
+    882, 879, 889,
+    889, 883, 882,
+    883, 889, 890,
+    890, 891, 883,
+    892, 883, 891,
+    883, 892, 857,
+    889, 893, 894,
+    894, 895, 889,
+    893, 889, 888,
+    895, 890, 889,
+    896, 888, 897,
+    898, 897, 888,
+    887, 898, 888,
+    888, 899, 893,
+    893, 900, 901,
+    900, 893, 902,
+    894, 893, 901,
+    902, 893, 899,
+    901, 895, 894,
+    895, 901, 903,
+    903, 904, 895,
+    905, 895, 904,
+    890, 895, 905,
+    901, 906, 907,
+    907, 903, 901,
+    906, 901, 900,
+    900, 908, 906,
+    908, 900, 909,
+    902, 909, 900,
+    909, 902, 899,
+    899, 896, 909,
+    909, 910, 908,
+    910, 909, 896,
+    908, 911, 912,
+    911, 908, 913,
+    912, 906, 908,
+    910, 913, 908,
+    906, 912, 914,
+    914, 907, 906,
+    907, 914, 915,
+    915, 916, 907,
+    903, 907, 916,
+    914, 917, 918,
+    918, 915, 914,
+    917, 914, 912,
+    912, 919, 917,
+    919, 912, 911,
+    920, 919, 911,
+    920, 911, 921,
+    913, 921, 911,
+    921, 913, 922,
+    913, 910, 922,
+    896, 922, 910,
+    923, 922, 924,
+    925, 924, 922,
+    922, 926, 925,
+    922, 927, 921,
+    921, 928, 920,
+    928, 921, 923,
+    927, 923, 921,
+    919, 920, 929,
+    929, 917, 919,
+    917, 929, 918,
+    930, 931, 918,
+    915, 918, 931,
+    931, 930, 932,
+    932, 933, 931,
+    934, 931, 933,
+    931, 934, 915,
+    916, 915, 934,
+    933, 935, 934,
+    936, 934, 935,
+    934, 936, 916,
+    933, 932, 937,
+    935, 933, 937,
+    937, 932, 938,
+    938, 939, 937,
+    940, 937, 939,
+    937, 940, 935,
+    941, 935, 940,
+    935, 941, 936,
+    941, 942, 936,
+    943, 936, 942,
+    944, 916, 936,
+    936, 943, 944,
+    916, 944, 903,
+    943, 945, 944,
+    904, 903, 944,
+    946, 944, 945,
+    944, 946, 904,
+    942, 947, 943,
+    945, 943, 947,
+    947, 948, 945,
+    949, 945, 948,
+    945, 949, 946,
+    904, 946, 905,
+    950, 946, 949,
+    946, 950, 951,
+    952, 905, 946,
+    946, 951, 952,
+    948, 953, 949,
+    953, 954, 949,
+    955, 949, 954,
+    949, 955, 950,
+    955, 956, 950,
+    957, 951, 950,
+    958, 950, 956,
+    950, 958, 957,
+    959, 952, 951,
+    951, 957, 959,
+    905, 952, 890,
+    891, 890, 952,
+    952, 959, 891,
+    960, 891, 959,
+    961, 959, 957,
+    959, 961, 960,
+    962, 957, 958,
+    957, 962, 961,
+    956, 963, 958,
+    964, 958, 963,
+    958, 964, 962,
+    956, 955, 965,
+    963, 956, 965,
+    954, 965, 955,
+    965, 954, 966,
+    966, 967, 965,
+    967, 968, 965,
+    969, 965, 968,
+    965, 969, 963,
+    970, 963, 969,
+    963, 970, 964,
+    971, 962, 964,
+    972, 964, 970,
+    964, 972, 971,
+    973, 961, 962,
+    962, 971, 973,
+    974, 973, 971,
+    971, 972, 974,
+    970, 975, 972,
+    969, 976, 970,
+    976, 977, 970,
+    975, 970, 977,
+    968, 978, 969,
+    978, 979, 969,
+    976, 969, 979,
+    979, 980, 976,
+    980, 981, 976,
+    977, 976, 981,
+    981, 982, 977,
+    975, 977, 982,
+    982, 983, 975,
+    982, 981, 984,
+    984, 985, 982,
+    983, 982, 985,
+    981, 980, 986,
+    986, 984, 981,
+    980, 979, 987,
+    987, 986, 980,
+    979, 978, 988,
+    988, 987, 979,
+    978, 968, 989,
+    989, 988, 978,
+    988, 989, 990,
+    990, 987, 988,
+    991, 990, 989,
+    991, 989, 968,
+    968, 967, 991,
+    992, 991, 993,
+    993, 991, 967,
+    967, 966, 993,
+    993, 994, 992,
+    994, 993, 966,
+    992, 995, 996,
+    996, 997, 992,
+    998, 992, 997,
+    999, 992, 998,
+    995, 992, 994,
+    1000, 995, 994,
+    1000, 994, 953,
+    966, 953, 994,
+    953, 966, 954,
+    953, 1001, 1000,
+    953, 948, 1001,
+    1002, 1000, 1001,
+    1001, 1003, 1002,
+    1003, 1001, 948,
+    948, 947, 1004,
+    1004, 1003, 948,
+    1003, 1004, 1005,
+    1005, 1002, 1003,
+    1002, 1005, 1006,
+    1006, 1007, 1002,
+    1008, 1006, 1005,
+    1009, 1005, 1010,
+    1010, 1005, 1004,
+    1004, 942, 1010,
+    942, 1004, 947,
+    1009, 1010, 942,
+    1009, 1011, 1012,
+    1012, 1013, 1009,
+    1008, 1009, 1013,
+    1014, 1009, 1015,
+    1015, 1009, 940,
+    942, 940, 1009,
+    1013, 1006, 1008,
+    1013, 1016, 1017,
+    1017, 1018, 1013,
+    1013, 1012, 1016,
+    1006, 1013, 1018,
+    1012, 1019, 1020,
+    1020, 1016, 1012,
+    1019, 1012, 1014,
+    1011, 1014, 1012,
+    1014, 1021, 1019,
+    1022, 1014, 939,
+    1015, 939, 1014,
+    939, 1015, 940,
+    942, 941, 940,
+    939, 938, 1022,
+    1023, 1019, 1022,
+    1021, 1022, 1019,
+    1023, 1022, 938,
+    1019, 1023, 1024,
+    1024, 1020, 1019,
+    1020, 1024, 1025,
+    1016, 1020, 1025,
+    1025, 1017, 1016,
+    1026, 1027, 1025,
+    1017, 1025, 1027,
+    1027, 1026, 1028,
+    1029, 1027, 1028,
+    1027, 1029, 1017,
+    1030, 1031, 1028,
+    1032, 1028, 1031,
+    1028, 1032, 1029,
+    1033, 1029, 1032,
+    1018, 1017, 1029,
+    1029, 1033, 1018,
+    1031, 1034, 1032,
+    1035, 1032, 1034,
+    1032, 1035, 1033,
+    1031, 1030, 1036,
+    1034, 1031, 1036,
+    1036, 1037, 1034,
+    1038, 1034, 1037,
+    1034, 1038, 1035,
+    1039, 1035, 1038,
+    1040, 1033, 1035,
+    1035, 1039, 1040,
+    1041, 1018, 1033,
+    1033, 1040, 1041,
+    1041, 1006, 1018,
+    1042, 1041, 1040,
+    1041, 1042, 1043,
+    1007, 1006, 1041,
+    1041, 1043, 1007,
+    1044, 1040, 1039,
+    1044, 1042, 1040,
+    1038, 1045, 1039,
+    1045, 1046, 1039,
+    1039, 1046, 1044,
+    1037, 1047, 1038,
+    1045, 1038, 1047,
+    1047, 1048, 1045,
+    1046, 1045, 1048,
+    1048, 1049, 1046,
+    1050, 1046, 1049,
+    1051, 1044, 1046,
+    1052, 1046, 1050,
+    1053, 1051, 1046,
+    1046, 1052, 1053,
+    1042, 1044, 1054,
+    996, 1054, 1044,
+    1044, 1051, 996,
+    997, 996, 1051,
+    1055, 1051, 1053,
+    1056, 997, 1051,
+    1051, 1055, 1056,
+    1053, 1052, 1055,
+    1057, 1055, 1052,
+    1058, 1056, 1055,
+    1055, 1057, 1058,
+    997, 1056, 998,
+    999, 998, 1056,
+    1056, 1058, 999,
+    1059, 1058, 1057,
+    1060, 999, 1058,
+    1058, 1059, 1060,
+    1052, 1061, 1057,
+    1062, 1057, 1061,
+    1063, 1059, 1057,
+    1057, 1062, 1063,
+    1064, 1060, 1059,
+    1059, 1063, 1064,
+    999, 1060, 990,
+    1060, 1064, 990,
+    1065, 1064, 1063,
+    986, 990, 1064,
+    1064, 1065, 986,
+    1066, 1063, 1062,
+    1067, 1065, 1063,
+    1063, 1066, 1067,
+    1061, 872, 1062,
+    1068, 1062, 872,
+    1062, 1068, 1066,
+    1069, 1066, 1068,
+    1070, 1067, 1066,
+    1066, 1069, 1070,
+    1065, 1067, 986,
+    1067, 1070, 986,
+    1071, 986, 1070,
+    986, 985, 984,
+    1072, 1070, 1069,
+    1070, 1072, 1071,
+    1068, 873, 1069,
+    871, 1069, 873,
+    871, 1072, 1069,
+    873, 1068, 872,
+    872, 1061, 876,
+    1061, 1052, 1073,
+    1073, 876, 1061,
+    876, 1073, 874,
+    1073, 1052, 1074,
+    1074, 874, 1073,
+    1050, 1074, 1052,
+    1074, 1050, 1075,
+    1075, 1076, 1074,
+    874, 1074, 1076,
+    1076, 885, 874,
+    1076, 1075, 1077,
+    1077, 886, 1076,
+    885, 1076, 886,
+    1049, 1077, 1075,
+    1049, 1075, 1050,
+    1077, 1049, 897,
+    897, 898, 1077,
+    898, 887, 1077,
+    886, 1077, 887,
+    1049, 1078, 1079,
+    1079, 897, 1049,
+    1049, 1048, 1078,
+    897, 1079, 896,
+    1079, 1078, 896,
+    1078, 925, 926,
+    926, 896, 1078,
+    925, 1078, 1048,
+    1048, 1080, 925,
+    1080, 1048, 1047,
+    924, 925, 1080,
+    1080, 1081, 924,
+    1081, 1080, 1037,
+    1047, 1037, 1080,
+    924, 1082, 923,
+    1082, 924, 1081,
+    1081, 1083, 1082,
+    1083, 1081, 1036,
+    1037, 1036, 1081,
+    928, 923, 1082,
+    1072, 871, 1071,
+    985, 1084, 983,
+    1054, 996, 995,
+    1054, 1043, 1042,
+    1054, 1007, 1043,
+    995, 1007, 1054,
+    974, 1085, 973,
+    1085, 974, 1086,
+    1085, 1087, 973,
+    1087, 1085, 1088,
+    1086, 1088, 1085,
+    961, 973, 1087,
+    1087, 1089, 961,
+    1089, 1087, 860,
+    1088, 860, 1087,
+    1086, 860, 1088,
+    860, 859, 1089,
+    1089, 960, 961,
+    960, 1089, 859,
+    859, 892, 960,
+    892, 859, 858,
+    891, 960, 892,
+    858, 857, 892,
+    259, 837, 257,
+    1090, 837, 840,
+    837, 1090, 1091,
+    258, 257, 837,
+    837, 1091, 258,
+    840, 1092, 1090,
+    1093, 1090, 1092,
+    1094, 1091, 1090,
+    1090, 1093, 1094,
+    1095, 258, 1091,
+    1091, 1094, 1095,
+    258, 1095, 246,
+    1096, 1095, 1094,
+    247, 246, 1095,
+    1095, 1096, 247,
+    1097, 1094, 1093,
+    1094, 1097, 1096,
+    1092, 1098, 1093,
+    1099, 1093, 1098,
+    1093, 1099, 1097,
+    1100, 1097, 1099,
+    1097, 1100, 1096,
+    1101, 247, 1096,
+    1102, 1096, 1100,
+    232, 1101, 1096,
+    1096, 1102, 232,
+    247, 1101, 231,
+    1101, 232, 231,
+    1100, 1103, 1102,
+    1099, 1104, 1100,
+    1103, 1100, 1104,
+    1098, 1105, 1099,
+    1104, 1099, 1105,
+    1106, 1104, 1105,
+    1104, 1106, 1103,
+    1105, 1107, 1106,
+    644, 1108, 654,
+    1108, 644, 1109,
+    643, 1109, 644,
+    1108, 1110, 1111,
+    1111, 654, 1108,
+    1110, 1108, 1112,
+    1109, 1112, 1108,
+    654, 1111, 1113,
+    1113, 655, 654,
+    1111, 1114, 1113,
+    1114, 1111, 1110,
+    1110, 1115, 1114,
+    1115, 1110, 1116,
+    1112, 1116, 1110,
+    1116, 1112, 1117,
+    1118, 1117, 1112,
+    1112, 1109, 1118,
+    634, 1118, 1109,
+    1109, 643, 634,
+    1117, 1118, 1119,
+    1120, 1119, 1118,
+    1118, 634, 1120,
+    1117, 1121, 1116,
+    1121, 1117, 1122,
+    1119, 1122, 1117,
+    1116, 1123, 1115,
+    1123, 1116, 1121,
+    1115, 1124, 1125,
+    1125, 1114, 1115,
+    1124, 1115, 1123,
+    1123, 1126, 1124,
+    1121, 1126, 1123,
+    1126, 1121, 1127,
+    601, 1127, 1121,
+    1122, 601, 1121,
+    601, 1122, 602,
+    603, 602, 1122,
+    1122, 1119, 603,
+    604, 603, 1119,
+    1119, 1120, 604,
+    633, 1120, 634,
+    1120, 633, 604,
+    612, 604, 633,
+    601, 1128, 1127,
+    601, 1129, 1128,
+    1129, 601, 589,
+    1127, 1130, 1131,
+    1131, 1126, 1127,
+    1130, 1127, 1128,
+    1128, 1132, 1130,
+    1132, 1128, 1129,
+    1129, 1133, 1132,
+    1133, 1129, 1134,
+    589, 1134, 1129,
+    1134, 589, 588,
+    1134, 1135, 1133,
+    1135, 1134, 1136,
+    588, 1136, 1134,
+    1136, 588, 587,
+    1136, 1137, 1135,
+    1137, 1136, 587,
+    587, 1138, 1137,
+    1114, 1125, 1139,
+    1139, 1113, 1114,
+    652, 1140, 649,
+    1141, 649, 1140,
+    1140, 1142, 1141,
+    649, 1141, 650,
+    1143, 1141, 1142,
+    1144, 650, 1141,
+    1141, 1143, 1144,
+    1142, 1145, 1143,
+    1146, 1143, 1145,
+    1147, 1144, 1143,
+    1143, 1146, 1147,
+    650, 1144, 1148,
+    1149, 1148, 1144,
+    1144, 1147, 1149,
+    1148, 638, 650,
+    638, 1148, 639,
+    1150, 639, 1148,
+    1148, 1149, 1150,
+    1151, 628, 639,
+    639, 1150, 1151,
+    628, 1151, 629,
+    1145, 1152, 1146,
+    1153, 1146, 1152,
+    1153, 348, 1146,
+    1154, 1152, 266,
+    1152, 1155, 1153,
+    348, 1153, 346,
+    1156, 1153, 1155,
+    1153, 1156, 1157,
+    347, 346, 1153,
+    1153, 1157, 347,
+    1155, 1158, 1156,
+    1159, 1156, 1158,
+    1160, 1157, 1156,
+    1156, 1159, 1160,
+    1161, 347, 1157,
+    1157, 1160, 1161,
+    347, 1161, 335,
+    1162, 1161, 1160,
+    336, 335, 1161,
+    1161, 1162, 336,
+    1163, 1160, 1159,
+    1160, 1163, 1162,
+    1158, 1164, 1159,
+    1165, 1159, 1164,
+    1159, 1165, 1163,
+    1166, 1163, 1165,
+    1163, 1166, 1162,
+    1167, 336, 1162,
+    1168, 1162, 1166,
+    321, 1167, 1162,
+    1162, 1168, 321,
+    336, 1167, 320,
+    1167, 321, 320,
+    1166, 1169, 1168,
+    1165, 1170, 1166,
+    1169, 1166, 1170,
+    1164, 1171, 1165,
+    1170, 1165, 1171,
+    1172, 1170, 1171,
+    1170, 1172, 1169,
+    1171, 1173, 1172,
+    267, 1154, 266,
+    356, 543, 355,
+    162, 161, 152,
+    152, 1174, 162,
+    151, 1175, 152,
+    1174, 152, 1175,
+    1175, 1176, 1174,
+    1175, 151, 1177,
+    1177, 1178, 1175,
+    1176, 1175, 1178,
+    150, 1177, 151,
+    1177, 150, 1179,
+    1179, 1180, 1177,
+    1178, 1177, 1180,
+    1181, 1178, 1180,
+    1178, 1181, 1176,
+    1180, 1182, 1181,
+    149, 1179, 150,
+    92, 130, 93,
+    1183, 1184, 1185,
+    1186, 1187, 1183,
+    1183, 1185, 1186,
+    1188, 1184, 1189,
+    1190, 1185, 1184,
+    1184, 1188, 1190,
+    1185, 1190, 1186,
+    1191, 1187, 1186,
+    1192, 1186, 1190,
+    1186, 1192, 1191,
+    1193, 1194, 1187,
+    1187, 1191, 1193,
+    1195, 1191, 1192,
+    1196, 1193, 1191,
+    1191, 1195, 1196,
+    1190, 1197, 1192,
+    1198, 1192, 1197,
+    1192, 1198, 1195,
+    1197, 1190, 1188,
+    1188, 1189, 1197,
+    1199, 1189, 1200,
+    1189, 1199, 1197,
+    1201, 1197, 1199,
+    1197, 1201, 1198,
+    1202, 1198, 1201,
+    1203, 1195, 1198,
+    1198, 1202, 1203,
+    1204, 1196, 1195,
+    1195, 1203, 1204,
+    1205, 1204, 1203,
+    1206, 1203, 1202,
+    1203, 1206, 1205,
+    1201, 1207, 1202,
+    1208, 1202, 1207,
+    1202, 1208, 1206,
+    1199, 1209, 1201,
+    1207, 1201, 1209,
+    1200, 1210, 1199,
+    1209, 1199, 1210,
+    1211, 1209, 1210,
+    1209, 1211, 1207,
+    1212, 1207, 1211,
+    1207, 1212, 1208,
+    1213, 1208, 1212,
+    1214, 1206, 1208,
+    1208, 1213, 1214,
+    1214, 1205, 1206,
+    1205, 1214, 1215,
+    1216, 1215, 1214,
+    1215, 1217, 1205,
+    1217, 1215, 1218,
+    1219, 1218, 1215,
+    1215, 1216, 1219,
+    1217, 1220, 1205,
+    1217, 1221, 1220,
+    1221, 1217, 1222,
+    1223, 1222, 1217,
+    1217, 1218, 1223,
+    1219, 1223, 1218,
+    1223, 1219, 1224,
+    1222, 1223, 1225,
+    1224, 1225, 1223,
+    1222, 1226, 1221,
+    1226, 1222, 1227,
+    1225, 1227, 1222,
+    1221, 1228, 1229,
+    1229, 1220, 1221,
+    1228, 1221, 1226,
+    1220, 1229, 1196,
+    1196, 1204, 1220,
+    1204, 1205, 1220,
+    1229, 1230, 1196,
+    1230, 1229, 1228,
+    1228, 1231, 1230,
+    1231, 1228, 1232,
+    1226, 1232, 1228,
+    1232, 1226, 1233,
+    1234, 1233, 1226,
+    1227, 1234, 1226,
+    1231, 1232, 1235,
+    1233, 1235, 1232,
+    1236, 1230, 1231,
+    1231, 1237, 1236,
+    1237, 1231, 1238,
+    1235, 1238, 1231,
+    1230, 1236, 1193,
+    1193, 1196, 1230,
+    1236, 1239, 1194,
+    1194, 1193, 1236,
+    1236, 1240, 1239,
+    1240, 1236, 1237,
+    1237, 1241, 1240,
+    1241, 1237, 1242,
+    1238, 1242, 1237,
+    1243, 1238, 1235,
+    1235, 1233, 1243,
+    1244, 1243, 1233,
+    1233, 1234, 1244,
+    1227, 1244, 1234,
+    1245, 1227, 1246,
+    1247, 1246, 1227,
+    1248, 1245, 1249,
+    1250, 1249, 1245,
+    1246, 1250, 1245,
+    1250, 1246, 1251,
+    1247, 1251, 1246,
+    1247, 1252, 1253,
+    1247, 1253, 1254,
+    1255, 1251, 1247,
+    1247, 1254, 1255,
+    1251, 1256, 1250,
+    1256, 1251, 1257,
+    1257, 1251, 1258,
+    1251, 1255, 1258,
+    1249, 1250, 1256,
+    1248, 1249, 1259,
+    1256, 1259, 1249,
+    1260, 1248, 1261,
+    1259, 1261, 1248,
+    1261, 1259, 1262,
+    1263, 1262, 1259,
+    1259, 1256, 1263,
+    1257, 1263, 1256,
+    1257, 1264, 1263,
+    1264, 1257, 1265,
+    1257, 1258, 1265,
+    1266, 1265, 1258,
+    1267, 1258, 1255,
+    1258, 1267, 1266,
+    1265, 1268, 1264,
+    1268, 1265, 1269,
+    1270, 1269, 1265,
+    1271, 1270, 1265,
+    1265, 1266, 1271,
+    1264, 1272, 1262,
+    1272, 1264, 1268,
+    1262, 1263, 1264,
+    1262, 1273, 1261,
+    1273, 1262, 1272,
+    1272, 1274, 1273,
+    1274, 1272, 1275,
+    1268, 1275, 1272,
+    1275, 1268, 1269,
+    1275, 1276, 1274,
+    1276, 1275, 1277,
+    1269, 1277, 1275,
+    1274, 1278, 1279,
+    1279, 1280, 1274,
+    1278, 1274, 1276,
+    1280, 1273, 1274,
+    1280, 1281, 1273,
+    1281, 1261, 1273,
+    1280, 1282, 1283,
+    1283, 1284, 1280,
+    1280, 1279, 1282,
+    1281, 1280, 1284,
+    1279, 1285, 1286,
+    1286, 1282, 1279,
+    1285, 1279, 1278,
+    1285, 1278, 1287,
+    1276, 1287, 1278,
+    1288, 1289, 1287,
+    1287, 1276, 1288,
+    1289, 1288, 1290,
+    1277, 1288, 1276,
+    1291, 1290, 1288,
+    1288, 1277, 1291,
+    1290, 1292, 1289,
+    1292, 1290, 1293,
+    1294, 1293, 1290,
+    1290, 1291, 1294,
+    1295, 1294, 1291,
+    1296, 1291, 1277,
+    1291, 1296, 1295,
+    1293, 1294, 1297,
+    1298, 1297, 1294,
+    1299, 1298, 1294,
+    1294, 1295, 1299,
+    1292, 1293, 1300,
+    1297, 1300, 1293,
+    1300, 1301, 1292,
+    1301, 1300, 1302,
+    1300, 1297, 1302,
+    1298, 1299, 1297,
+    1303, 1297, 1299,
+    1304, 1299, 1295,
+    1299, 1304, 1303,
+    1305, 1295, 1296,
+    1295, 1305, 1304,
+    1306, 1304, 1305,
+    1307, 1303, 1304,
+    1304, 1306, 1307,
+    1296, 1308, 1305,
+    1309, 1305, 1308,
+    1305, 1309, 1306,
+    1310, 1306, 1309,
+    1311, 1307, 1306,
+    1306, 1310, 1311,
+    1210, 1307, 1211,
+    1312, 1211, 1307,
+    1307, 1313, 1312,
+    1211, 1312, 1212,
+    1213, 1212, 1312,
+    1312, 1313, 1213,
+    1310, 1309, 1314,
+    1314, 1270, 1310,
+    1308, 1314, 1309,
+    1308, 1296, 1269,
+    1314, 1308, 1269,
+    1269, 1270, 1314,
+    1277, 1269, 1296,
+    1282, 1286, 1315,
+    1315, 1283, 1282,
+    1284, 1260, 1281,
+    1261, 1281, 1260,
+    1316, 1271, 1266,
+    1317, 1318, 1271,
+    1271, 1316, 1317,
+    1266, 1319, 1316,
+    1320, 1317, 1316,
+    1321, 1316, 1319,
+    1316, 1321, 1320,
+    1319, 1266, 1267,
+    1267, 1322, 1319,
+    1321, 1319, 1322,
+    1323, 1321, 1322,
+    1321, 1323, 1324,
+    1324, 1320, 1321,
+    1317, 1320, 1325,
+    1325, 1320, 1326,
+    1327, 1320, 1324,
+    1320, 1327, 1326,
+    1318, 1317, 1328,
+    1325, 1328, 1317,
+    1328, 1329, 1318,
+    1329, 1328, 1330,
+    1331, 1330, 1328,
+    1328, 1325, 1331,
+    1326, 1331, 1325,
+    1331, 1326, 1332,
+    1333, 1326, 1327,
+    1326, 1333, 1332,
+    1333, 1327, 1324,
+    1334, 1324, 1323,
+    1324, 1334, 1333,
+    1322, 1335, 1323,
+    1334, 1323, 1335,
+    1335, 1336, 1334,
+    1337, 1334, 1336,
+    1334, 1337, 1338,
+    1339, 1333, 1334,
+    1334, 1338, 1339,
+    1333, 1339, 1340,
+    1341, 1332, 1333,
+    1333, 1340, 1341,
+    1332, 1342, 1331,
+    1330, 1331, 1343,
+    1342, 1343, 1331,
+    1343, 1344, 1330,
+    1344, 1343, 1345,
+    1346, 1345, 1343,
+    1343, 1347, 1346,
+    1348, 1349, 1345,
+    1346, 1348, 1345,
+    1348, 1346, 1350,
+    1351, 1346, 1347,
+    1346, 1351, 1352,
+    1352, 1350, 1346,
+    1347, 1342, 1351,
+    1353, 1351, 1342,
+    1353, 1352, 1351,
+    1354, 1342, 1355,
+    1354, 1353, 1342,
+    1352, 1353, 1356,
+    1357, 1356, 1353,
+    1353, 1354, 1357,
+    1350, 1352, 1358,
+    1359, 1358, 1352,
+    1356, 1359, 1352,
+    1360, 1359, 1356,
+    1356, 1357, 1360,
+    1354, 1361, 1357,
+    1362, 1360, 1357,
+    1363, 1357, 1361,
+    1363, 1362, 1357,
+    1360, 1364, 1359,
+    1364, 1360, 1365,
+    1360, 1362, 1366,
+    1360, 1366, 1365,
+    1359, 1367, 1358,
+    1367, 1359, 1368,
+    1364, 1368, 1359,
+    1350, 1358, 1367,
+    1367, 1369, 1370,
+    1370, 1350, 1367,
+    1369, 1367, 1371,
+    1368, 1371, 1367,
+    1371, 1368, 1372,
+    1372, 1368, 1373,
+    1374, 1373, 1368,
+    1368, 1364, 1374,
+    1364, 1365, 1374,
+    1373, 1374, 1375,
+    1376, 1374, 1365,
+    1377, 1375, 1374,
+    1374, 1376, 1377,
+    1373, 1378, 1372,
+    1378, 1373, 1379,
+    1375, 1379, 1373,
+    1372, 1380, 1371,
+    1380, 1372, 1378,
+    1371, 1381, 1382,
+    1382, 1369, 1371,
+    1381, 1371, 1380,
+    1380, 1383, 1381,
+    1383, 1380, 1384,
+    1378, 1384, 1380,
+    1384, 1378, 1385,
+    1379, 1385, 1378,
+    1385, 1379, 1386,
+    1379, 1375, 1386,
+    1387, 1386, 1375,
+    1377, 1387, 1375,
+    1388, 1377, 1376,
+    1377, 1388, 1389,
+    1376, 1390, 1388,
+    1390, 1376, 1365,
+    1365, 1391, 1390,
+    1366, 1391, 1365,
+    1391, 1366, 1362,
+    1362, 1363, 1391,
+    1392, 1363, 1361,
+    1392, 1361, 1393,
+    1354, 1394, 1361,
+    1394, 1393, 1361,
+    1393, 1395, 1396,
+    1396, 1397, 1393,
+    1393, 1394, 1395,
+    1354, 1395, 1394,
+    1355, 1396, 1354,
+    1395, 1354, 1396,
+    1397, 1341, 1398,
+    1340, 1398, 1341,
+    1398, 1340, 1339,
+    1339, 1338, 1398,
+    1399, 1338, 1337,
+    1399, 1337, 1400,
+    1400, 1401, 1399,
+    1336, 1400, 1337,
+    1400, 1336, 1402,
+    1402, 1403, 1400,
+    1401, 1400, 1403,
+    1401, 1404, 1405,
+    1405, 1406, 1401,
+    1404, 1401, 1403,
+    1403, 1402, 1404,
+    1402, 1407, 1408,
+    1408, 1404, 1402,
+    1407, 1402, 1336,
+    1336, 1335, 1407,
+    1407, 1409, 1410,
+    1409, 1407, 1322,
+    1410, 1408, 1407,
+    1335, 1322, 1407,
+    1409, 1255, 1254,
+    1254, 1411, 1409,
+    1255, 1409, 1267,
+    1411, 1410, 1409,
+    1322, 1267, 1409,
+    1410, 1411, 1253,
+    1253, 1412, 1410,
+    1408, 1410, 1412,
+    1411, 1254, 1253,
+    1252, 1413, 1253,
+    1412, 1253, 1413,
+    1413, 1386, 1412,
+    1414, 1412, 1386,
+    1412, 1414, 1408,
+    1413, 1252, 1415,
+    1415, 1385, 1413,
+    1386, 1413, 1385,
+    1385, 1415, 1416,
+    1416, 1384, 1385,
+    1384, 1416, 1383,
+    1414, 1417, 1408,
+    1408, 1405, 1404,
+    1418, 1408, 1417,
+    1408, 1418, 1405,
+    1417, 1389, 1418,
+    1406, 1405, 1418,
+    1419, 1418, 1389,
+    1418, 1419, 1406,
+    1369, 1382, 1420,
+    1420, 1370, 1369,
+    1370, 1420, 1421,
+    1350, 1370, 1421,
+    1349, 1348, 1421,
+    1350, 1421, 1348,
+    1242, 1422, 1241,
+    1422, 1423, 1424,
+    1424, 1241, 1422,
+    1424, 1240, 1241,
+    1240, 1424, 1194,
+    1194, 1239, 1240,
+    1425, 1426, 1427,
+    1425, 1427, 1428,
+    1425, 1428, 1429,
+    1425, 1430, 1431,
+    1425, 1431, 1432,
+    1425, 1432, 1433,
+    1425, 1434, 1435,
+    1425, 1435, 1436,
+    1425, 1436, 1437,
+    1425, 1438, 1439,
+    1425, 1439, 1440,
+    1425, 1440, 1441,
+    1442, 1429, 1428,
+    1428, 1443, 1442,
+    1444, 1442, 1443,
+    1428, 1445, 1443,
+    1446, 1443, 1445,
+    1443, 1446, 1444,
+    1447, 1444, 1446,
+    1445, 1448, 1446,
+    1449, 1446, 1448,
+    1446, 1449, 1447,
+    1445, 1428, 1427,
+    1427, 1450, 1445,
+    1448, 1445, 1450,
+    1450, 1451, 1448,
+    1452, 1448, 1451,
+    1448, 1452, 1449,
+    1453, 1449, 1452,
+    1449, 1453, 1454,
+    1455, 1447, 1449,
+    1449, 1454, 1455,
+    1456, 1447, 1455,
+    1456, 1455, 1454,
+    1457, 1454, 1453,
+    1454, 1457, 1456,
+    1452, 1458, 1453,
+    1459, 1453, 1458,
+    1453, 1459, 1460,
+    1453, 1460, 1457,
+    1451, 1461, 1452,
+    1458, 1452, 1461,
+    1461, 1462, 1458,
+    1463, 1458, 1462,
+    1458, 1463, 1459,
+    1464, 1459, 1463,
+    1464, 1460, 1459,
+    1465, 1457, 1460,
+    1460, 1464, 1465,
+    1466, 1456, 1457,
+    1457, 1465, 1466,
+    1467, 1465, 1464,
+    1468, 1466, 1465,
+    1465, 1467, 1468,
+    1463, 1469, 1464,
+    1470, 1464, 1469,
+    1464, 1470, 1467,
+    1463, 1462, 1471,
+    1471, 1472, 1463,
+    1469, 1463, 1472,
+    1461, 1471, 1462,
+    1471, 1473, 1474,
+    1474, 1475, 1471,
+    1471, 1461, 1473,
+    1476, 1471, 1475,
+    1471, 1476, 1472,
+    1477, 1472, 1476,
+    1472, 1477, 1469,
+    1478, 1469, 1477,
+    1469, 1478, 1470,
+    1479, 1470, 1478,
+    1480, 1467, 1470,
+    1470, 1479, 1480,
+    1477, 1481, 1478,
+    1482, 1478, 1481,
+    1478, 1482, 1479,
+    1477, 1476, 1483,
+    1483, 1484, 1477,
+    1481, 1477, 1484,
+    1475, 1483, 1476,
+    1474, 1483, 1475,
+    1474, 1485, 1486,
+    1485, 1474, 1473,
+    1485, 1473, 1461,
+    1485, 1487, 1488,
+    1488, 1486, 1485,
+    1487, 1485, 1451,
+    1461, 1451, 1485,
+    1426, 1488, 1487,
+    1426, 1487, 1450,
+    1451, 1450, 1487,
+    1450, 1427, 1426,
+    1484, 1489, 1481,
+    1490, 1481, 1489,
+    1489, 1491, 1490,
+    1481, 1490, 1482,
+    1467, 1480, 1492,
+    1492, 1468, 1467,
+    1493, 1441, 1440,
+    1440, 1494, 1493,
+    1495, 1493, 1494,
+    1496, 1440, 1439,
+    1440, 1496, 1494,
+    1497, 1494, 1496,
+    1494, 1497, 1495,
+    1498, 1495, 1497,
+    1496, 1499, 1497,
+    1500, 1497, 1499,
+    1497, 1500, 1498,
+    1439, 1501, 1496,
+    1499, 1496, 1501,
+    1501, 1439, 1438,
+    1438, 1502, 1501,
+    1503, 1501, 1502,
+    1501, 1503, 1499,
+    1504, 1499, 1503,
+    1499, 1504, 1500,
+    1505, 1500, 1504,
+    1500, 1505, 1506,
+    1507, 1498, 1500,
+    1500, 1506, 1507,
+    1508, 1498, 1507,
+    1508, 1507, 1506,
+    1509, 1506, 1505,
+    1506, 1509, 1508,
+    1504, 1510, 1505,
+    1511, 1505, 1510,
+    1505, 1511, 1512,
+    1505, 1512, 1509,
+    1503, 1513, 1504,
+    1510, 1504, 1513,
+    1502, 1514, 1503,
+    1513, 1503, 1514,
+    1514, 1515, 1513,
+    1516, 1513, 1515,
+    1513, 1516, 1517,
+    1513, 1517, 1510,
+    1518, 1510, 1517,
+    1510, 1518, 1511,
+    1519, 1511, 1518,
+    1519, 1512, 1511,
+    1520, 1509, 1512,
+    1512, 1519, 1520,
+    1521, 1508, 1509,
+    1509, 1520, 1521,
+    1522, 1520, 1519,
+    1523, 1521, 1520,
+    1520, 1522, 1523,
+    1518, 1524, 1519,
+    1525, 1519, 1524,
+    1519, 1525, 1522,
+    1518, 1517, 1516,
+    1516, 1526, 1518,
+    1524, 1518, 1526,
+    1526, 1527, 1524,
+    1528, 1524, 1527,
+    1524, 1528, 1525,
+    1529, 1525, 1528,
+    1530, 1522, 1525,
+    1525, 1529, 1530,
+    1531, 1523, 1522,
+    1522, 1530, 1531,
+    1528, 1532, 1529,
+    1527, 1533, 1528,
+    1532, 1528, 1533,
+    1527, 1534, 1535,
+    1535, 1536, 1527,
+    1527, 1526, 1534,
+    1533, 1527, 1536,
+    1516, 1534, 1526,
+    1534, 1516, 1537,
+    1537, 1535, 1534,
+    1538, 1535, 1537,
+    1538, 1537, 1516,
+    1516, 1515, 1538,
+    1538, 1514, 1539,
+    1514, 1538, 1515,
+    1514, 1502, 1540,
+    1540, 1539, 1514,
+    1438, 1540, 1502,
+    1536, 1541, 1533,
+    1542, 1533, 1541,
+    1541, 1543, 1542,
+    1533, 1542, 1532,
+    1544, 1437, 1436,
+    1436, 1545, 1544,
+    1546, 1544, 1545,
+    1547, 1436, 1435,
+    1436, 1547, 1545,
+    1548, 1545, 1547,
+    1545, 1548, 1546,
+    1549, 1546, 1548,
+    1547, 1550, 1548,
+    1551, 1548, 1550,
+    1548, 1551, 1549,
+    1435, 1552, 1547,
+    1550, 1547, 1552,
+    1552, 1435, 1434,
+    1434, 1553, 1552,
+    1554, 1552, 1553,
+    1552, 1554, 1550,
+    1555, 1550, 1554,
+    1550, 1555, 1551,
+    1556, 1551, 1555,
+    1551, 1556, 1557,
+    1558, 1549, 1551,
+    1551, 1557, 1558,
+    1559, 1549, 1558,
+    1559, 1558, 1557,
+    1560, 1557, 1556,
+    1557, 1560, 1559,
+    1555, 1561, 1556,
+    1562, 1556, 1561,
+    1556, 1562, 1563,
+    1556, 1563, 1560,
+    1554, 1564, 1555,
+    1561, 1555, 1564,
+    1553, 1565, 1554,
+    1564, 1554, 1565,
+    1565, 1566, 1564,
+    1567, 1564, 1566,
+    1564, 1567, 1568,
+    1564, 1568, 1561,
+    1569, 1561, 1568,
+    1561, 1569, 1562,
+    1570, 1562, 1569,
+    1570, 1563, 1562,
+    1571, 1560, 1563,
+    1563, 1570, 1571,
+    1572, 1559, 1560,
+    1560, 1571, 1572,
+    1573, 1571, 1570,
+    1574, 1572, 1571,
+    1571, 1573, 1574,
+    1569, 1575, 1570,
+    1576, 1570, 1575,
+    1570, 1576, 1573,
+    1569, 1568, 1567,
+    1567, 1577, 1569,
+    1575, 1569, 1577,
+    1577, 1578, 1575,
+    1579, 1575, 1578,
+    1575, 1579, 1576,
+    1580, 1576, 1579,
+    1581, 1573, 1576,
+    1576, 1580, 1581,
+    1582, 1574, 1573,
+    1573, 1581, 1582,
+    1579, 1583, 1580,
+    1578, 1584, 1579,
+    1583, 1579, 1584,
+    1578, 1585, 1586,
+    1586, 1587, 1578,
+    1578, 1577, 1585,
+    1584, 1578, 1587,
+    1567, 1585, 1577,
+    1585, 1567, 1588,
+    1588, 1586, 1585,
+    1589, 1586, 1588,
+    1589, 1588, 1567,
+    1567, 1566, 1589,
+    1589, 1565, 1590,
+    1565, 1589, 1566,
+    1565, 1553, 1591,
+    1591, 1590, 1565,
+    1434, 1591, 1553,
+    1587, 1592, 1584,
+    1593, 1584, 1592,
+    1592, 1594, 1593,
+    1584, 1593, 1583,
+    1595, 1433, 1432,
+    1432, 1596, 1595,
+    1597, 1595, 1596,
+    1598, 1432, 1431,
+    1432, 1598, 1596,
+    1599, 1596, 1598,
+    1596, 1599, 1597,
+    1600, 1597, 1599,
+    1598, 1601, 1599,
+    1602, 1599, 1601,
+    1599, 1602, 1600,
+    1431, 1603, 1598,
+    1601, 1598, 1603,
+    1603, 1431, 1430,
+    1430, 1604, 1603,
+    1605, 1603, 1604,
+    1603, 1605, 1601,
+    1606, 1601, 1605,
+    1601, 1606, 1602,
+    1607, 1602, 1606,
+    1602, 1607, 1608,
+    1609, 1600, 1602,
+    1602, 1608, 1609,
+    1610, 1600, 1609,
+    1610, 1609, 1608,
+    1611, 1608, 1607,
+    1608, 1611, 1610,
+    1606, 1612, 1607,
+    1613, 1607, 1612,
+    1607, 1613, 1614,
+    1607, 1614, 1611,
+    1605, 1615, 1606,
+    1612, 1606, 1615,
+    1604, 1616, 1605,
+    1615, 1605, 1616,
+    1616, 1617, 1615,
+    1618, 1615, 1617,
+    1615, 1618, 1619,
+    1615, 1619, 1612,
+    1620, 1612, 1619,
+    1612, 1620, 1613,
+    1621, 1613, 1620,
+    1621, 1614, 1613,
+    1622, 1611, 1614,
+    1614, 1621, 1622,
+    1623, 1610, 1611,
+    1611, 1622, 1623,
+    1624, 1622, 1621,
+    1625, 1623, 1622,
+    1622, 1624, 1625,
+    1620, 1626, 1621,
+    1627, 1621, 1626,
+    1621, 1627, 1624,
+    1620, 1619, 1618,
+    1618, 1628, 1620,
+    1626, 1620, 1628,
+    1628, 1629, 1626,
+    1630, 1626, 1629,
+    1626, 1630, 1627,
+    1631, 1627, 1630,
+    1632, 1624, 1627,
+    1627, 1631, 1632,
+    1633, 1625, 1624,
+    1624, 1632, 1633,
+    1630, 1634, 1631,
+    1629, 1635, 1630,
+    1634, 1630, 1635,
+    1629, 1636, 1637,
+    1637, 1638, 1629,
+    1629, 1628, 1636,
+    1635, 1629, 1638,
+    1618, 1636, 1628,
+    1636, 1618, 1639,
+    1639, 1637, 1636,
+    1640, 1637, 1639,
+    1640, 1639, 1618,
+    1618, 1617, 1640,
+    1640, 1616, 1641,
+    1616, 1640, 1617,
+    1616, 1604, 1642,
+    1642, 1641, 1616,
+    1430, 1642, 1604,
+    1638, 1643, 1635,
+    1644, 1635, 1643,
+    1643, 1645, 1644,
+    1635, 1644, 1634,
+    1646, 1647, 1648,
+    1648, 1649, 1646,
+    1647, 1646, 1650,
+    1651, 1646, 1649,
+    1652, 1650, 1646,
+    1646, 1651, 1652,
+    1650, 1653, 1647,
+    1653, 1650, 1654,
+    1650, 1652, 1655,
+    1655, 1654, 1650,
+    1656, 1652, 1651,
+    1657, 1655, 1652,
+    1652, 1656, 1657,
+    1649, 1658, 1651,
+    1659, 1651, 1658,
+    1651, 1659, 1656,
+    1656, 1659, 1660,
+    1661, 1657, 1656,
+    1656, 1660, 1661,
+    1658, 1662, 1659,
+    1663, 1659, 1662,
+    1664, 1659, 1663,
+    1665, 1660, 1659,
+    1659, 1664, 1665,
+    1660, 1665, 1661,
+    1657, 1661, 1666,
+    1667, 1666, 1661,
+    1668, 1661, 1665,
+    1668, 1667, 1661,
+    1669, 1665, 1664,
+    1665, 1669, 1668,
+    1663, 1669, 1664,
+    1662, 1670, 1663,
+    1669, 1663, 1670,
+    1662, 1671, 1670,
+    1672, 1670, 1671,
+    1670, 1672, 1669,
+    1672, 1673, 1669,
+    1674, 1669, 1673,
+    1669, 1674, 1675,
+    1669, 1675, 1676,
+    1677, 1668, 1669,
+    1669, 1676, 1677,
+    1667, 1668, 1678,
+    1668, 1677, 1679,
+    1679, 1678, 1668,
+    1680, 1677, 1676,
+    1681, 1679, 1677,
+    1677, 1680, 1681,
+    1680, 1676, 1675,
+    1674, 1682, 1675,
+    1683, 1675, 1682,
+    1675, 1683, 1680,
+    1682, 1674, 1673,
+    1682, 1673, 1684,
+    1684, 1685, 1682,
+    1686, 1682, 1685,
+    1682, 1686, 1683,
+    1671, 1684, 1673,
+    1673, 1672, 1671,
+    1687, 1681, 1680,
+    1679, 1681, 1688,
+    1689, 1688, 1681,
+    1681, 1687, 1689,
+    1678, 1679, 1690,
+    1688, 1690, 1679,
+    1690, 1688, 1691,
+    1688, 1689, 1692,
+    1688, 1692, 1691,
+    1690, 1693, 1678,
+    1691, 1693, 1690,
+    1693, 1694, 1695,
+    1693, 1695, 1696,
+    1696, 1678, 1693,
+    1694, 1697, 1698,
+    1698, 1699, 1694,
+    1695, 1694, 1699,
+    1699, 1696, 1695,
+    1696, 1699, 1657,
+    1657, 1700, 1696,
+    1678, 1696, 1700,
+    1678, 1700, 1667,
+    1700, 1657, 1666,
+    1666, 1667, 1700,
+    1655, 1657, 1698,
+    1698, 1657, 1699,
+    1698, 1701, 1655,
+    1701, 1698, 1697,
+    1697, 1702, 1701,
+    1654, 1655, 1701,
+    1701, 1703, 1654,
+    1703, 1701, 1702,
+    1702, 1704, 1703,
+    1705, 1654, 1703,
+    1705, 1703, 1704,
+    1654, 1705, 1653,
+    1704, 1706, 1705,
+    1707, 1704, 1708,
+    1709, 1708, 1704,
+    1704, 1710, 1709,
+    1708, 1711, 1707,
+    1711, 1708, 1712,
+    1713, 1712, 1708,
+    1708, 1709, 1713,
+    1714, 1709, 1710,
+    1709, 1714, 1715,
+    1715, 1713, 1709,
+    1710, 1716, 1714,
+    1717, 1714, 1716,
+    1715, 1714, 1718,
+    1719, 1714, 1717,
+    1720, 1718, 1714,
+    1714, 1719, 1720,
+    1713, 1715, 1721,
+    1722, 1721, 1715,
+    1715, 1718, 1722,
+    1712, 1713, 1723,
+    1721, 1723, 1713,
+    1723, 1721, 1724,
+    1721, 1722, 1725,
+    1724, 1721, 1726,
+    1727, 1721, 1725,
+    1728, 1726, 1721,
+    1721, 1727, 1728,
+    1718, 1720, 1722,
+    1729, 1725, 1722,
+    1730, 1722, 1720,
+    1730, 1729, 1722,
+    1731, 1720, 1719,
+    1720, 1731, 1730,
+    1717, 1731, 1719,
+    1716, 1732, 1717,
+    1731, 1717, 1732,
+    1732, 1733, 1731,
+    1733, 1734, 1731,
+    1735, 1731, 1734,
+    1731, 1735, 1736,
+    1731, 1736, 1737,
+    1738, 1730, 1731,
+    1731, 1737, 1738,
+    1729, 1730, 1739,
+    1730, 1738, 1740,
+    1740, 1739, 1730,
+    1725, 1729, 1727,
+    1739, 1727, 1729,
+    1739, 1728, 1727,
+    1728, 1739, 1741,
+    1739, 1740, 1742,
+    1742, 1741, 1739,
+    1743, 1740, 1738,
+    1744, 1742, 1740,
+    1740, 1743, 1744,
+    1745, 1738, 1737,
+    1738, 1745, 1743,
+    1745, 1737, 1736,
+    1735, 1746, 1736,
+    1747, 1736, 1746,
+    1736, 1747, 1745,
+    1746, 1735, 1734,
+    1746, 1734, 1748,
+    1748, 1749, 1746,
+    1750, 1746, 1749,
+    1746, 1750, 1747,
+    1751, 1748, 1734,
+    1716, 1751, 1732,
+    1733, 1732, 1751,
+    1734, 1733, 1751,
+    1752, 1743, 1745,
+    1743, 1752, 1753,
+    1753, 1744, 1743,
+    1744, 1753, 1754,
+    1744, 1754, 1755,
+    1755, 1741, 1742,
+    1742, 1744, 1755,
+    1741, 1756, 1757,
+    1741, 1757, 1728,
+    1756, 1758, 1724,
+    1724, 1726, 1756,
+    1757, 1756, 1726,
+    1726, 1728, 1757,
+    1724, 1759, 1723,
+    1759, 1724, 1758,
+    1758, 1760, 1759,
+    1761, 1723, 1759,
+    1759, 1762, 1761,
+    1762, 1759, 1760,
+    1723, 1761, 1712,
+    1761, 1763, 1764,
+    1764, 1712, 1761,
+    1763, 1761, 1762,
+    1763, 1762, 1765,
+    1760, 1765, 1762,
+    1765, 1766, 1763,
+    1767, 1765, 1768,
+    1769, 1768, 1765,
+    1765, 1770, 1769,
+    1768, 1771, 1767,
+    1771, 1768, 1772,
+    1773, 1772, 1768,
+    1768, 1769, 1773,
+    1774, 1769, 1770,
+    1769, 1774, 1775,
+    1775, 1773, 1769,
+    1770, 1776, 1774,
+    1777, 1774, 1776,
+    1775, 1774, 1778,
+    1779, 1774, 1777,
+    1780, 1778, 1774,
+    1774, 1779, 1780,
+    1773, 1775, 1781,
+    1782, 1781, 1775,
+    1775, 1778, 1782,
+    1772, 1773, 1783,
+    1781, 1783, 1773,
+    1783, 1781, 1784,
+    1781, 1782, 1785,
+    1784, 1781, 1786,
+    1787, 1781, 1785,
+    1788, 1786, 1781,
+    1781, 1787, 1788,
+    1778, 1780, 1782,
+    1789, 1785, 1782,
+    1790, 1782, 1780,
+    1790, 1789, 1782,
+    1791, 1780, 1779,
+    1780, 1791, 1790,
+    1777, 1791, 1779,
+    1776, 1792, 1777,
+    1791, 1777, 1792,
+    1792, 1793, 1791,
+    1793, 1794, 1791,
+    1795, 1791, 1794,
+    1791, 1795, 1796,
+    1791, 1796, 1797,
+    1798, 1790, 1791,
+    1791, 1797, 1798,
+    1789, 1790, 1799,
+    1790, 1798, 1800,
+    1800, 1799, 1790,
+    1785, 1789, 1787,
+    1799, 1787, 1789,
+    1799, 1788, 1787,
+    1788, 1799, 1801,
+    1799, 1800, 1802,
+    1802, 1801, 1799,
+    1803, 1800, 1798,
+    1804, 1802, 1800,
+    1800, 1803, 1804,
+    1805, 1798, 1797,
+    1798, 1805, 1803,
+    1805, 1797, 1796,
+    1795, 1806, 1796,
+    1807, 1796, 1806,
+    1796, 1807, 1805,
+    1806, 1795, 1794,
+    1806, 1794, 1808,
+    1808, 1809, 1806,
+    1810, 1806, 1809,
+    1806, 1810, 1807,
+    1811, 1808, 1794,
+    1776, 1811, 1792,
+    1793, 1792, 1811,
+    1794, 1793, 1811,
+    1812, 1803, 1805,
+    1803, 1812, 1813,
+    1813, 1804, 1803,
+    1804, 1813, 1814,
+    1804, 1814, 1815,
+    1815, 1801, 1802,
+    1802, 1804, 1815,
+    1801, 1816, 1817,
+    1801, 1817, 1788,
+    1816, 1818, 1784,
+    1784, 1786, 1816,
+    1817, 1816, 1786,
+    1786, 1788, 1817,
+    1784, 1819, 1783,
+    1819, 1784, 1818,
+    1818, 1820, 1819,
+    1821, 1783, 1819,
+    1819, 1822, 1821,
+    1822, 1819, 1820,
+    1783, 1821, 1772,
+    1821, 1823, 1824,
+    1824, 1772, 1821,
+    1823, 1821, 1822,
+    1823, 1822, 1825,
+    1820, 1825, 1822,
+    1825, 1826, 1823,
+    1827, 1825, 1828,
+    1829, 1828, 1825,
+    1825, 1830, 1829,
+    1828, 1831, 1827,
+    1831, 1828, 1832,
+    1833, 1832, 1828,
+    1828, 1829, 1833,
+    1834, 1829, 1830,
+    1829, 1834, 1835,
+    1835, 1833, 1829,
+    1830, 1836, 1834,
+    1837, 1834, 1836,
+    1835, 1834, 1838,
+    1839, 1834, 1837,
+    1840, 1838, 1834,
+    1834, 1839, 1840,
+    1833, 1835, 1841,
+    1842, 1841, 1835,
+    1835, 1838, 1842,
+    1832, 1833, 1843,
+    1841, 1843, 1833,
+    1843, 1841, 1844,
+    1841, 1842, 1845,
+    1844, 1841, 1846,
+    1847, 1841, 1845,
+    1848, 1846, 1841,
+    1841, 1847, 1848,
+    1838, 1840, 1842,
+    1849, 1845, 1842,
+    1850, 1842, 1840,
+    1850, 1849, 1842,
+    1851, 1840, 1839,
+    1840, 1851, 1850,
+    1837, 1851, 1839,
+    1836, 1852, 1837,
+    1851, 1837, 1852,
+    1852, 1853, 1851,
+    1853, 1854, 1851,
+    1855, 1851, 1854,
+    1851, 1855, 1856,
+    1851, 1856, 1857,
+    1858, 1850, 1851,
+    1851, 1857, 1858,
+    1849, 1850, 1859,
+    1850, 1858, 1860,
+    1860, 1859, 1850,
+    1845, 1849, 1847,
+    1859, 1847, 1849,
+    1859, 1848, 1847,
+    1848, 1859, 1861,
+    1859, 1860, 1862,
+    1862, 1861, 1859,
+    1863, 1860, 1858,
+    1864, 1862, 1860,
+    1860, 1863, 1864,
+    1865, 1858, 1857,
+    1858, 1865, 1863,
+    1865, 1857, 1856,
+    1855, 1866, 1856,
+    1867, 1856, 1866,
+    1856, 1867, 1865,
+    1866, 1855, 1854,
+    1866, 1854, 1868,
+    1868, 1869, 1866,
+    1870, 1866, 1869,
+    1866, 1870, 1867,
+    1871, 1868, 1854,
+    1836, 1871, 1852,
+    1853, 1852, 1871,
+    1854, 1853, 1871,
+    1872, 1863, 1865,
+    1863, 1872, 1873,
+    1873, 1864, 1863,
+    1864, 1873, 1874,
+    1864, 1874, 1875,
+    1875, 1861, 1862,
+    1862, 1864, 1875,
+    1861, 1876, 1877,
+    1861, 1877, 1848,
+    1876, 1878, 1844,
+    1844, 1846, 1876,
+    1877, 1876, 1846,
+    1846, 1848, 1877,
+    1844, 1879, 1843,
+    1879, 1844, 1878,
+    1878, 1880, 1879,
+    1881, 1843, 1879,
+    1879, 1882, 1881,
+    1882, 1879, 1880,
+    1843, 1881, 1832,
+    1881, 1883, 1884,
+    1884, 1832, 1881,
+    1883, 1881, 1882,
+    1883, 1882, 1649,
+    1880, 1649, 1882,
+    1649, 1885, 1883,
+    1832, 1884, 1831,
+    1772, 1824, 1771,
+    1712, 1764, 1711,
+    0, 1, 2,
+    2, 1, 3,
+    1, 4, 5,
+    1, 5, 3,
+    3, 6, 2,
+    6, 3, 7,
+    8, 7, 3,
+    9, 8, 3,
+    10, 3, 5,
+    11, 9, 3,
+    3, 10, 11,
+    12, 5, 4,
+    5, 12, 10,
+    13, 10, 12,
+    14, 11, 10,
+    10, 13, 14,
+    9, 11, 15,
+    16, 15, 11,
+    11, 14, 16,
+    15, 8, 9,
+    8, 15, 17,
+    18, 17, 15,
+    15, 16, 18,
+    14, 19, 16,
+    20, 18, 16,
+    21, 16, 19,
+    16, 21, 20,
+    19, 14, 13,
+    13, 22, 19,
+    23, 19, 22,
+    24, 21, 19,
+    19, 23, 24,
+    24, 20, 21,
+    18, 20, 25,
+    26, 25, 20,
+    27, 26, 20,
+    20, 24, 27,
+    17, 18, 28,
+    25, 28, 18,
+    28, 25, 29,
+    30, 29, 25,
+    25, 26, 30,
+    31, 30, 26,
+    26, 27, 31,
+    29, 30, 32,
+    31, 32, 30,
+    29, 33, 34,
+    34, 28, 29,
+    33, 29, 35,
+    32, 35, 29,
+    28, 34, 17,
+    34, 36, 37,
+    37, 17, 34,
+    36, 34, 33,
+    33, 38, 36,
+    38, 33, 39,
+    35, 39, 33,
+    39, 35, 40,
+    35, 32, 40,
+    41, 40, 32,
+    42, 41, 32,
+    32, 31, 42,
+    40, 43, 39,
+    43, 40, 44,
+    45, 44, 40,
+    40, 41, 45,
+    39, 46, 38,
+    46, 39, 43,
+    38, 46, 36,
+    47, 36, 46,
+    46, 48, 47,
+    48, 46, 49,
+    43, 49, 46,
+    49, 43, 50,
+    44, 50, 43,
+    49, 51, 48,
+    51, 49, 50,
+    48, 52, 53,
+    52, 48, 51,
+    53, 47, 48,
+    54, 55, 47,
+    54, 47, 53,
+    47, 55, 56,
+    36, 47, 56,
+    53, 52, 54,
+    57, 52, 58,
+    52, 51, 58,
+    50, 58, 51,
+    59, 50, 60,
+    61, 60, 50,
+    50, 62, 61,
+    63, 59, 64,
+    64, 59, 65,
+    59, 60, 65,
+    66, 65, 60,
+    60, 61, 66,
+    62, 67, 61,
+    68, 61, 67,
+    69, 66, 61,
+    61, 68, 69,
+    65, 66, 70,
+    71, 70, 66,
+    66, 69, 71,
+    68, 72, 69,
+    73, 71, 69,
+    74, 69, 72,
+    69, 74, 73,
+    72, 68, 67,
+    67, 75, 72,
+    76, 72, 75,
+    77, 74, 72,
+    72, 76, 77,
+    77, 73, 74,
+    71, 73, 78,
+    79, 78, 73,
+    80, 79, 73,
+    73, 77, 80,
+    70, 71, 78,
+    78, 81, 70,
+    81, 78, 82,
+    83, 82, 78,
+    78, 79, 83,
+    80, 83, 79,
+    83, 80, 84,
+    82, 83, 85,
+    86, 85, 83,
+    84, 86, 83,
+    82, 87, 81,
+    87, 82, 88,
+    85, 88, 82,
+    81, 89, 90,
+    90, 70, 81,
+    89, 81, 87,
+    87, 91, 89,
+    91, 87, 92,
+    88, 92, 87,
+    92, 88, 93,
+    88, 85, 93,
+    94, 93, 85,
+    85, 86, 94,
+    95, 94, 86,
+    86, 84, 95,
+    93, 94, 96,
+    95, 96, 94,
+    93, 97, 92,
+    97, 93, 98,
+    96, 98, 93,
+    92, 99, 91,
+    99, 92, 97,
+    91, 99, 100,
+    100, 89, 91,
+    99, 101, 100,
+    101, 99, 102,
+    103, 102, 99,
+    97, 103, 99,
+    103, 97, 104,
+    98, 104, 97,
+    104, 98, 105,
+    98, 96, 105,
+    106, 105, 96,
+    107, 106, 96,
+    96, 95, 107,
+    105, 108, 104,
+    108, 105, 109,
+    110, 109, 105,
+    105, 106, 110,
+    104, 102, 103,
+    102, 104, 108,
+    102, 111, 101,
+    111, 102, 112,
+    108, 112, 102,
+    112, 108, 113,
+    109, 113, 108,
+    112, 114, 111,
+    114, 112, 113,
+    111, 115, 116,
+    115, 111, 114,
+    116, 101, 111,
+    115, 114, 117,
+    113, 117, 114,
+    118, 113, 119,
+    120, 119, 113,
+    113, 121, 120,
+    122, 118, 123,
+    123, 118, 124,
+    118, 119, 124,
+    125, 124, 119,
+    119, 120, 125,
+    121, 126, 120,
+    127, 120, 126,
+    128, 125, 120,
+    120, 127, 128,
+    124, 125, 129,
+    130, 129, 125,
+    125, 128, 130,
+    127, 131, 128,
+    132, 130, 128,
+    133, 128, 131,
+    128, 133, 132,
+    131, 127, 126,
+    126, 134, 131,
+    135, 131, 134,
+    136, 133, 131,
+    131, 135, 136,
+    136, 132, 133,
+    130, 132, 137,
+    138, 137, 132,
+    139, 138, 132,
+    132, 136, 139,
+    129, 130, 137,
+    137, 140, 129,
+    140, 137, 141,
+    142, 141, 137,
+    137, 138, 142,
+    139, 142, 138,
+    142, 139, 143,
+    141, 142, 144,
+    145, 144, 142,
+    143, 145, 142,
+    141, 146, 140,
+    146, 141, 147,
+    144, 147, 141,
+    140, 148, 149,
+    149, 129, 140,
+    148, 140, 146,
+    146, 150, 148,
+    150, 146, 151,
+    147, 151, 146,
+    151, 147, 152,
+    147, 144, 152,
+    153, 152, 144,
+    144, 145, 153,
+    154, 153, 145,
+    145, 143, 154,
+    152, 153, 155,
+    154, 155, 153,
+    152, 156, 151,
+    156, 152, 157,
+    155, 157, 152,
+    151, 158, 150,
+    158, 151, 156,
+    150, 158, 159,
+    159, 148, 150,
+    158, 160, 159,
+    160, 158, 161,
+    162, 161, 158,
+    156, 162, 158,
+    162, 156, 163,
+    157, 163, 156,
+    163, 157, 164,
+    157, 155, 164,
+    165, 164, 155,
+    166, 165, 155,
+    155, 154, 166,
+    164, 167, 163,
+    167, 164, 168,
+    169, 168, 164,
+    164, 165, 169,
+    163, 161, 162,
+    161, 163, 167,
+    161, 170, 160,
+    170, 161, 171,
+    167, 171, 161,
+    171, 167, 172,
+    168, 172, 167,
+    171, 173, 170,
+    173, 171, 172,
+    170, 174, 175,
+    174, 170, 173,
+    175, 160, 170,
+    174, 173, 176,
+    172, 176, 173,
+    177, 172, 178,
+    179, 178, 172,
+    172, 180, 179,
+    181, 177, 182,
+    182, 177, 183,
+    177, 178, 183,
+    184, 183, 178,
+    178, 179, 184,
+    180, 185, 179,
+    186, 179, 185,
+    187, 184, 179,
+    179, 186, 187,
+    183, 184, 188,
+    189, 188, 184,
+    184, 187, 189,
+    186, 190, 187,
+    191, 189, 187,
+    192, 187, 190,
+    187, 192, 191,
+    190, 186, 185,
+    185, 193, 190,
+    194, 190, 193,
+    195, 192, 190,
+    190, 194, 195,
+    195, 191, 192,
+    189, 191, 196,
+    197, 196, 191,
+    198, 197, 191,
+    191, 195, 198,
+    188, 189, 196,
+    196, 199, 188,
+    199, 196, 200,
+    201, 200, 196,
+    196, 197, 201,
+    198, 201, 197,
+    201, 198, 202,
+    200, 201, 203,
+    204, 203, 201,
+    202, 204, 201,
+    200, 205, 199,
+    205, 200, 206,
+    203, 206, 200,
+    199, 207, 208,
+    208, 188, 199,
+    207, 199, 205,
+    205, 209, 207,
+    209, 205, 210,
+    206, 210, 205,
+    210, 206, 211,
+    206, 203, 211,
+    212, 211, 203,
+    203, 204, 212,
+    213, 212, 204,
+    204, 202, 213,
+    211, 212, 214,
+    213, 214, 212,
+    211, 215, 210,
+    215, 211, 216,
+    214, 216, 211,
+    210, 217, 209,
+    217, 210, 215,
+    209, 217, 218,
+    218, 207, 209,
+    217, 219, 218,
+    219, 217, 220,
+    221, 220, 217,
+    215, 221, 217,
+    221, 215, 222,
+    216, 222, 215,
+    222, 216, 223,
+    216, 214, 223,
+    224, 223, 214,
+    225, 224, 214,
+    214, 213, 225,
+    223, 226, 222,
+    226, 223, 227,
+    228, 227, 223,
+    223, 224, 228,
+    222, 220, 221,
+    220, 222, 226,
+    220, 229, 219,
+    229, 220, 230,
+    226, 230, 220,
+    230, 226, 4,
+    227, 4, 226,
+    230, 231, 229,
+    231, 230, 4,
+    229, 232, 233,
+    232, 229, 231,
+    233, 219, 229,
+    232, 231, 234,
+    4, 234, 231,
+    4, 235, 12,
+    235, 236, 12,
+    237, 12, 236,
+    12, 237, 13,
+    238, 237, 236,
+    236, 239, 238,
+    237, 238, 13,
+    22, 13, 238,
+    240, 238, 239,
+    23, 22, 238,
+    238, 240, 23,
+    239, 241, 240,
+    242, 240, 241,
+    242, 243, 240,
+    244, 242, 241,
+    241, 245, 244,
+    246, 241, 247,
+    248, 243, 242,
+    242, 244, 248,
+    249, 250, 243,
+    243, 248, 251,
+    243, 251, 249,
+    244, 252, 248,
+    253, 251, 248,
+    254, 248, 252,
+    248, 254, 253,
+    255, 244, 245,
+    244, 255, 252,
+    245, 256, 255,
+    257, 252, 255,
+    257, 255, 256,
+    252, 257, 254,
+    258, 254, 257,
+    258, 253, 254,
+    251, 253, 259,
+    260, 259, 253,
+    253, 258, 260,
+    259, 249, 251,
+    249, 259, 261,
+    262, 261, 259,
+    259, 260, 262,
+    263, 262, 260,
+    263, 260, 258,
+    261, 262, 264,
+    264, 262, 265,
+    261, 266, 249,
+    266, 261, 267,
+    264, 267, 261,
+    267, 264, 265,
+    265, 268, 267,
+    268, 265, 269,
+    266, 267, 268,
+    266, 270, 250,
+    266, 250, 249,
+    271, 270, 266,
+    268, 271, 266,
+    271, 268, 272,
+    269, 272, 268,
+    272, 269, 273,
+    272, 274, 271,
+    274, 272, 275,
+    273, 275, 272,
+    270, 271, 274,
+    276, 277, 270,
+    270, 274, 276,
+    275, 276, 274,
+    75, 277, 76,
+    278, 76, 277,
+    279, 278, 277,
+    277, 280, 279,
+    278, 281, 76,
+    282, 281, 278,
+    278, 279, 282,
+    283, 279, 280,
+    279, 283, 284,
+    279, 284, 282,
+    280, 285, 283,
+    286, 284, 283,
+    286, 283, 285,
+    287, 282, 284,
+    284, 286, 287,
+    281, 282, 288,
+    289, 288, 282,
+    282, 287, 289,
+    290, 291, 281,
+    281, 288, 290,
+    292, 290, 288,
+    288, 289, 292,
+    293, 292, 289,
+    294, 289, 287,
+    289, 294, 293,
+    294, 287, 286,
+    295, 286, 285,
+    296, 293, 294,
+    292, 293, 297,
+    296, 297, 293,
+    290, 292, 298,
+    297, 298, 292,
+    299, 291, 290,
+    298, 299, 290,
+    299, 300, 291,
+    301, 300, 299,
+    299, 298, 302,
+    303, 301, 299,
+    299, 302, 303,
+    304, 302, 298,
+    298, 297, 304,
+    304, 297, 305,
+    302, 304, 305,
+    305, 303, 302,
+    301, 303, 306,
+    307, 306, 303,
+    303, 305, 307,
+    300, 301, 308,
+    306, 308, 301,
+    309, 310, 300,
+    300, 308, 309,
+    311, 309, 308,
+    308, 306, 311,
+    312, 311, 306,
+    306, 307, 312,
+    312, 313, 314,
+    314, 315, 312,
+    312, 316, 317,
+    316, 312, 318,
+    313, 319, 320,
+    314, 313, 320,
+    320, 321, 314,
+    315, 314, 321,
+    315, 322, 323,
+    323, 324, 315,
+    315, 321, 322,
+    321, 320, 325,
+    325, 322, 321,
+    326, 327, 320,
+    326, 320, 319,
+    327, 325, 320,
+    319, 328, 329,
+    329, 326, 319,
+    330, 327, 326,
+    326, 329, 330,
+    327, 330, 331,
+    331, 332, 327,
+    333, 327, 332,
+    325, 327, 333,
+    333, 334, 325,
+    335, 325, 334,
+    325, 335, 322,
+    332, 334, 333,
+    334, 336, 337,
+    334, 337, 335,
+    324, 322, 335,
+    338, 335, 337,
+    335, 338, 324,
+    339, 337, 336,
+    338, 337, 339,
+    340, 339, 336,
+    339, 340, 338,
+    340, 341, 342,
+    342, 343, 340,
+    340, 344, 345,
+    345, 346, 340,
+    341, 347, 348,
+    348, 342, 341,
+    342, 348, 349,
+    349, 350, 342,
+    343, 342, 350,
+    350, 351, 343,
+    350, 349, 352,
+    352, 353, 350,
+    351, 350, 353,
+    349, 354, 352,
+    354, 349, 348,
+    354, 348, 347,
+    347, 355, 354,
+    352, 354, 356,
+    352, 356, 357,
+    358, 352, 357,
+    352, 358, 353,
+    359, 353, 358,
+    353, 359, 351,
+    359, 360, 351,
+    358, 360, 359,
+    357, 361, 358,
+    360, 358, 361,
+    357, 356, 362,
+    362, 363, 357,
+    361, 357, 363,
+    363, 364, 361,
+    365, 361, 364,
+    361, 365, 360,
+    324, 360, 365,
+    364, 366, 365,
+    324, 365, 366,
+    364, 363, 367,
+    367, 368, 364,
+    366, 364, 368,
+    362, 367, 363,
+    369, 362, 135,
+    367, 362, 369,
+    369, 370, 367,
+    370, 371, 367,
+    368, 367, 371,
+    371, 372, 368,
+    366, 368, 372,
+    370, 373, 371,
+    372, 371, 373,
+    370, 369, 374,
+    373, 370, 374,
+    369, 135, 310,
+    310, 374, 369,
+    134, 310, 135,
+    375, 310, 376,
+    377, 376, 310,
+    378, 379, 375,
+    376, 378, 375,
+    375, 380, 381,
+    382, 375, 381,
+    376, 383, 378,
+    383, 376, 384,
+    385, 384, 376,
+    376, 377, 385,
+    379, 378, 383,
+    383, 386, 379,
+    386, 383, 387,
+    384, 387, 383,
+    386, 388, 379,
+    386, 389, 388,
+    389, 386, 384,
+    387, 384, 386,
+    384, 390, 389,
+    390, 384, 391,
+    392, 391, 384,
+    393, 392, 384,
+    384, 385, 393,
+    389, 394, 395,
+    389, 396, 394,
+    396, 389, 390,
+    395, 388, 389,
+    397, 396, 390,
+    397, 390, 398,
+    399, 398, 390,
+    391, 399, 390,
+    396, 397, 400,
+    400, 394, 396,
+    394, 400, 401,
+    401, 395, 394,
+    401, 388, 395,
+    402, 401, 400,
+    401, 402, 403,
+    404, 401, 403,
+    400, 405, 406,
+    406, 402, 400,
+    405, 400, 397,
+    397, 407, 405,
+    398, 407, 397,
+    398, 408, 407,
+    409, 408, 398,
+    399, 409, 398,
+    407, 410, 411,
+    411, 405, 407,
+    407, 412, 410,
+    412, 407, 413,
+    414, 413, 407,
+    408, 414, 407,
+    414, 408, 415,
+    409, 415, 408,
+    415, 409, 416,
+    409, 399, 417,
+    418, 416, 409,
+    409, 417, 418,
+    415, 419, 414,
+    419, 415, 420,
+    416, 420, 415,
+    413, 414, 419,
+    412, 413, 421,
+    421, 413, 422,
+    419, 422, 413,
+    420, 422, 419,
+    423, 420, 424,
+    425, 424, 420,
+    425, 420, 416,
+    416, 426, 425,
+    424, 425, 427,
+    425, 426, 428,
+    428, 427, 425,
+    424, 429, 423,
+    424, 430, 429,
+    430, 424, 431,
+    424, 427, 431,
+    422, 423, 429,
+    422, 432, 421,
+    432, 422, 429,
+    429, 433, 432,
+    433, 429, 430,
+    433, 430, 434,
+    431, 434, 430,
+    431, 435, 434,
+    435, 431, 436,
+    436, 431, 437,
+    431, 427, 438,
+    439, 437, 431,
+    431, 438, 439,
+    438, 427, 428,
+    440, 439, 438,
+    428, 441, 438,
+    438, 442, 440,
+    443, 438, 441,
+    444, 442, 438,
+    438, 443, 444,
+    437, 439, 388,
+    379, 388, 439,
+    381, 439, 440,
+    439, 381, 379,
+    436, 437, 403,
+    388, 403, 437,
+    403, 388, 404,
+    403, 445, 446,
+    446, 436, 403,
+    445, 403, 402,
+    445, 447, 446,
+    447, 445, 448,
+    402, 448, 445,
+    446, 447, 449,
+    449, 435, 446,
+    436, 446, 435,
+    450, 449, 447,
+    450, 447, 451,
+    451, 447, 406,
+    448, 406, 447,
+    452, 453, 449,
+    452, 449, 450,
+    435, 449, 453,
+    435, 453, 454,
+    454, 434, 435,
+    453, 452, 455,
+    455, 456, 453,
+    454, 453, 456,
+    450, 457, 452,
+    457, 450, 458,
+    451, 458, 450,
+    458, 451, 459,
+    406, 459, 451,
+    460, 406, 461,
+    461, 406, 405,
+    461, 459, 460,
+    462, 459, 463,
+    405, 463, 459,
+    459, 461, 405,
+    459, 464, 458,
+    465, 457, 458,
+    458, 466, 465,
+    466, 458, 462,
+    464, 462, 458,
+    466, 462, 467,
+    463, 467, 462,
+    411, 467, 463,
+    463, 405, 411,
+    467, 468, 466,
+    468, 467, 410,
+    467, 411, 410,
+    410, 469, 468,
+    469, 410, 470,
+    412, 470, 410,
+    470, 471, 469,
+    471, 470, 472,
+    473, 472, 470,
+    470, 412, 473,
+    421, 473, 412,
+    473, 474, 472,
+    474, 473, 475,
+    473, 421, 476,
+    476, 475, 473,
+    472, 477, 471,
+    472, 478, 477,
+    478, 472, 474,
+    474, 479, 478,
+    479, 474, 480,
+    479, 481, 478,
+    481, 479, 482,
+    483, 455, 481,
+    480, 481, 482,
+    481, 480, 483,
+    456, 483, 480,
+    480, 475, 456,
+    456, 455, 483,
+    484, 456, 475,
+    456, 484, 454,
+    433, 484, 475,
+    434, 454, 484,
+    484, 433, 434,
+    475, 432, 433,
+    476, 421, 432,
+    379, 381, 380,
+    440, 485, 381,
+    382, 381, 485,
+    440, 442, 485,
+    486, 485, 442,
+    486, 382, 485,
+    487, 382, 486,
+    442, 444, 486,
+    488, 486, 444,
+    486, 488, 487,
+    488, 444, 443,
+    443, 489, 488,
+    443, 441, 490,
+    490, 491, 443,
+    489, 443, 491,
+    491, 492, 489,
+    491, 490, 493,
+    493, 494, 491,
+    492, 491, 494,
+    490, 495, 496,
+    495, 490, 441,
+    496, 493, 490,
+    441, 428, 495,
+    495, 428, 426,
+    426, 497, 495,
+    497, 496, 495,
+    497, 418, 417,
+    417, 498, 497,
+    497, 498, 493,
+    498, 499, 493,
+    499, 500, 493,
+    501, 493, 500,
+    498, 417, 399,
+    399, 391, 498,
+    499, 498, 391,
+    500, 499, 391,
+    391, 392, 500,
+    502, 500, 392,
+    502, 501, 500,
+    392, 393, 502,
+    374, 503, 373,
+    372, 373, 503,
+    504, 372, 503,
+    322, 324, 323,
+    193, 355, 194,
+    505, 194, 355,
+    506, 505, 355,
+    355, 507, 506,
+    505, 508, 194,
+    509, 508, 505,
+    505, 506, 509,
+    510, 506, 507,
+    506, 510, 511,
+    506, 511, 509,
+    507, 512, 510,
+    513, 511, 510,
+    513, 510, 512,
+    514, 509, 511,
+    511, 513, 514,
+    508, 509, 515,
+    516, 515, 509,
+    509, 514, 516,
+    517, 518, 508,
+    508, 515, 517,
+    519, 517, 515,
+    515, 516, 519,
+    520, 519, 516,
+    521, 516, 514,
+    516, 521, 520,
+    521, 514, 513,
+    522, 513, 512,
+    523, 520, 521,
+    519, 520, 524,
+    523, 524, 520,
+    517, 519, 525,
+    524, 525, 519,
+    526, 518, 517,
+    525, 526, 517,
+    526, 247, 518,
+    527, 247, 526,
+    526, 525, 528,
+    529, 527, 526,
+    526, 528, 529,
+    530, 528, 525,
+    525, 524, 530,
+    530, 524, 531,
+    528, 530, 531,
+    531, 529, 528,
+    527, 529, 532,
+    533, 532, 529,
+    529, 531, 533,
+    247, 527, 534,
+    532, 534, 527,
+    247, 534, 246,
+    535, 246, 534,
+    534, 532, 535,
+    536, 535, 532,
+    532, 533, 536,
+    536, 537, 538,
+    537, 536, 539,
+    536, 540, 541,
+    541, 542, 536,
+    537, 543, 538,
+    539, 543, 537,
+    544, 538, 543,
+    544, 543, 545,
+    539, 545, 543,
+    545, 539, 523,
+    545, 546, 544,
+    546, 545, 547,
+    523, 547, 545,
+    548, 544, 549,
+    549, 544, 546,
+    546, 550, 549,
+    550, 546, 551,
+    552, 551, 546,
+    546, 547, 552,
+    547, 523, 553,
+    346, 547, 553,
+    346, 552, 547,
+    553, 523, 346,
+    346, 345, 552,
+    551, 552, 345,
+    554, 550, 551,
+    554, 551, 555,
+    344, 555, 551,
+    345, 344, 551,
+    556, 550, 554,
+    554, 557, 556,
+    557, 554, 555,
+    555, 331, 557,
+    557, 558, 559,
+    559, 556, 557,
+    558, 557, 331,
+    550, 556, 559,
+    560, 559, 558,
+    559, 548, 550,
+    561, 562, 559,
+    563, 559, 562,
+    560, 331, 564,
+    565, 560, 328,
+    566, 567, 560,
+    560, 565, 566,
+    560, 568, 561,
+    562, 561, 568,
+    568, 569, 562,
+    570, 562, 569,
+    562, 570, 563,
+    570, 571, 563,
+    540, 563, 571,
+    569, 572, 570,
+    570, 572, 571,
+    572, 569, 568,
+    567, 566, 568,
+    573, 568, 566,
+    568, 574, 572,
+    575, 566, 565,
+    566, 575, 573,
+    575, 576, 573,
+    577, 573, 576,
+    565, 578, 575,
+    575, 578, 576,
+    578, 579, 576,
+    580, 576, 579,
+    581, 577, 576,
+    576, 580, 581,
+    273, 577, 581,
+    582, 581, 580,
+    581, 582, 273,
+    579, 583, 580,
+    582, 580, 583,
+    579, 578, 584,
+    584, 585, 579,
+    586, 579, 585,
+    579, 586, 583,
+    578, 565, 328,
+    328, 587, 578,
+    584, 578, 587,
+    587, 585, 584,
+    585, 317, 588,
+    585, 588, 586,
+    296, 583, 586,
+    318, 586, 588,
+    586, 318, 296,
+    583, 296, 589,
+    582, 583, 589,
+    589, 296, 582,
+    318, 588, 316,
+    316, 588, 317,
+    564, 329, 328,
+    329, 564, 331,
+    331, 330, 329,
+    273, 590, 591,
+    590, 273, 592,
+    590, 593, 591,
+    592, 593, 590,
+    594, 591, 593,
+    594, 593, 595,
+    592, 595, 593,
+    595, 592, 263,
+    595, 596, 594,
+    596, 595, 597,
+    263, 597, 595,
+    574, 594, 598,
+    598, 594, 596,
+    596, 572, 598,
+    572, 596, 571,
+    599, 571, 596,
+    596, 597, 599,
+    597, 263, 600,
+    542, 597, 600,
+    542, 599, 597,
+    600, 263, 542,
+    542, 541, 599,
+    571, 599, 541,
+    541, 540, 571,
+    598, 572, 574,
+    549, 550, 548,
+    601, 257, 256,
+    602, 232, 234,
+    233, 232, 603,
+    603, 219, 233,
+    604, 603, 605,
+    603, 604, 219,
+    219, 604, 218,
+    605, 218, 604,
+    218, 605, 606,
+    606, 607, 218,
+    607, 207, 218,
+    183, 606, 182,
+    606, 183, 607,
+    207, 607, 183,
+    208, 207, 183,
+    188, 208, 183,
+    224, 225, 228,
+    608, 174, 176,
+    175, 174, 609,
+    609, 160, 175,
+    610, 609, 611,
+    609, 610, 160,
+    160, 610, 159,
+    611, 159, 610,
+    159, 611, 612,
+    612, 613, 159,
+    613, 148, 159,
+    124, 612, 123,
+    612, 124, 613,
+    148, 613, 124,
+    149, 148, 124,
+    129, 149, 124,
+    165, 166, 169,
+    614, 115, 117,
+    116, 115, 615,
+    615, 101, 116,
+    616, 615, 617,
+    615, 616, 101,
+    101, 616, 100,
+    617, 100, 616,
+    100, 617, 618,
+    618, 619, 100,
+    619, 89, 100,
+    65, 618, 64,
+    618, 65, 619,
+    89, 619, 65,
+    90, 89, 65,
+    70, 90, 65,
+    106, 107, 110,
+    55, 54, 620,
+    620, 56, 55,
+    56, 620, 6,
+    6, 7, 56,
+    7, 8, 56,
+    37, 36, 56,
+    56, 8, 37,
+    17, 37, 8,
+    41, 42, 45,
+    621, 622, 623,
+    623, 624, 621,
+    625, 622, 621,
+    621, 624, 625,
+    626, 627, 622,
+    628, 626, 622,
+    622, 625, 628,
+    629, 628, 625,
+    630, 625, 624,
+    625, 630, 631,
+    625, 631, 629,
+    624, 623, 632,
+    632, 633, 624,
+    634, 624, 633,
+    630, 624, 634,
+    634, 635, 630,
+    636, 630, 635,
+    630, 636, 637,
+    630, 637, 631,
+    638, 629, 631,
+    631, 637, 638,
+    628, 629, 639,
+    640, 639, 629,
+    629, 638, 640,
+    641, 638, 637,
+    642, 640, 638,
+    638, 641, 642,
+    643, 641, 637,
+    637, 644, 643,
+    644, 637, 636,
+    635, 645, 636,
+    646, 636, 645,
+    636, 646, 644,
+    647, 643, 644,
+    643, 642, 641,
+    643, 647, 648,
+    649, 642, 643,
+    643, 648, 649,
+    640, 642, 650,
+    639, 640, 651,
+    650, 651, 640,
+    651, 650, 652,
+    653, 650, 654,
+    655, 654, 650,
+    651, 656, 639,
+    652, 656, 651,
+    656, 657, 658,
+    658, 639, 656,
+    639, 658, 628,
+    626, 628, 658,
+    626, 658, 657,
+    627, 626, 657,
+    654, 659, 653,
+    659, 654, 660,
+    660, 654, 655,
+    661, 653, 662,
+    659, 662, 653,
+    662, 659, 663,
+    659, 664, 663,
+    664, 659, 665,
+    659, 660, 665,
+    655, 666, 660,
+    667, 665, 660,
+    660, 668, 667,
+    668, 660, 666,
+    665, 669, 670,
+    670, 664, 665,
+    671, 669, 665,
+    665, 672, 671,
+    665, 667, 672,
+    664, 673, 663,
+    664, 670, 673,
+    663, 674, 662,
+    674, 663, 673,
+    673, 675, 674,
+    675, 673, 670,
+    675, 670, 669,
+    676, 677, 675,
+    675, 678, 676,
+    677, 674, 675,
+    669, 678, 675,
+    674, 677, 679,
+    662, 674, 679,
+    677, 680, 681,
+    681, 679, 677,
+    677, 676, 680,
+    676, 682, 680,
+    682, 676, 678,
+    683, 684, 678,
+    685, 683, 678,
+    678, 669, 685,
+    684, 683, 686,
+    687, 686, 683,
+    683, 685, 687,
+    688, 684, 686,
+    684, 688, 689,
+    686, 687, 688,
+    690, 687, 685,
+    691, 688, 687,
+    687, 690, 691,
+    685, 669, 690,
+    692, 690, 669,
+    669, 671, 692,
+    692, 691, 690,
+    693, 691, 692,
+    694, 692, 671,
+    695, 692, 694,
+    695, 693, 692,
+    695, 694, 671,
+    671, 672, 695,
+    696, 672, 667,
+    672, 696, 697,
+    698, 697, 696,
+    699, 696, 667,
+    696, 699, 698,
+    668, 700, 667,
+    699, 667, 700,
+    701, 699, 700,
+    699, 701, 702,
+    702, 698, 699,
+    697, 698, 703,
+    698, 702, 704,
+    704, 703, 698,
+    703, 705, 697,
+    705, 703, 706,
+    706, 703, 707,
+    703, 704, 707,
+    708, 704, 702,
+    704, 708, 709,
+    709, 707, 704,
+    710, 702, 701,
+    702, 710, 711,
+    702, 711, 708,
+    701, 712, 710,
+    712, 701, 713,
+    714, 713, 701,
+    714, 715, 713,
+    715, 716, 713,
+    714, 717, 718,
+    718, 719, 714,
+    717, 714, 700,
+    719, 715, 714,
+    701, 700, 714,
+    717, 666, 718,
+    666, 717, 668,
+    700, 668, 717,
+    655, 720, 718,
+    655, 718, 666,
+    720, 719, 718,
+    719, 720, 721,
+    721, 722, 719,
+    723, 719, 722,
+    721, 720, 724,
+    724, 725, 721,
+    725, 726, 721,
+    722, 721, 726,
+    726, 727, 722,
+    716, 722, 727,
+    716, 723, 722,
+    726, 725, 728,
+    727, 726, 728,
+    724, 728, 725,
+    729, 730, 724,
+    728, 724, 730,
+    728, 730, 731,
+    727, 728, 731,
+    732, 727, 731,
+    727, 732, 733,
+    734, 727, 733,
+    727, 734, 716,
+    731, 730, 735,
+    735, 736, 731,
+    736, 737, 731,
+    732, 731, 737,
+    730, 729, 735,
+    736, 735, 738,
+    738, 739, 736,
+    739, 740, 736,
+    737, 736, 740,
+    741, 737, 740,
+    737, 741, 732,
+    740, 739, 742,
+    741, 740, 743,
+    740, 744, 706,
+    707, 740, 706,
+    745, 744, 739,
+    744, 742, 739,
+    745, 706, 744,
+    706, 745, 705,
+    746, 741, 743,
+    743, 709, 746,
+    741, 746, 747,
+    741, 747, 732,
+    748, 732, 747,
+    749, 733, 732,
+    732, 748, 749,
+    749, 734, 733,
+    750, 693, 751,
+    751, 693, 635,
+    645, 635, 693,
+    693, 752, 645,
+    633, 632, 750,
+    633, 750, 634,
+    750, 751, 634,
+    635, 634, 751,
+    645, 752, 646,
+    679, 661, 662,
+    753, 754, 755,
+    753, 755, 756,
+    757, 753, 758,
+    753, 757, 759,
+    753, 759, 760,
+    753, 761, 762,
+    753, 762, 763,
+    753, 764, 765,
+    753, 766, 764,
+    767, 757, 758,
+    757, 767, 768,
+    768, 759, 757,
+    758, 769, 770,
+    758, 770, 767,
+    771, 767, 770,
+    768, 767, 772,
+    773, 767, 771,
+    767, 773, 774,
+    774, 772, 767,
+    759, 768, 760,
+    775, 760, 768,
+    768, 772, 775,
+    772, 774, 776,
+    776, 775, 772,
+    777, 774, 773,
+    778, 776, 774,
+    774, 777, 778,
+    771, 779, 773,
+    780, 773, 779,
+    773, 780, 777,
+    770, 769, 771,
+    779, 771, 769,
+    769, 781, 779,
+    779, 781, 782,
+    779, 782, 780,
+    783, 780, 782,
+    784, 780, 783,
+    780, 784, 785,
+    785, 777, 780,
+    777, 785, 778,
+    783, 786, 784,
+    786, 787, 784,
+    783, 782, 781,
+    786, 783, 781,
+    781, 788, 786,
+    789, 786, 788,
+    786, 789, 787,
+    764, 790, 765,
+    791, 764, 766,
+    764, 791, 792,
+    792, 790, 764,
+    790, 792, 765,
+    793, 765, 792,
+    792, 791, 794,
+    792, 794, 793,
+    766, 795, 791,
+    796, 791, 795,
+    797, 791, 796,
+    791, 797, 798,
+    798, 794, 791,
+    766, 799, 795,
+    795, 799, 796,
+    800, 796, 799,
+    796, 800, 797,
+    801, 797, 800,
+    802, 798, 797,
+    797, 801, 802,
+    794, 798, 803,
+    804, 803, 798,
+    798, 802, 804,
+    803, 793, 794,
+    802, 805, 804,
+    805, 802, 801,
+    800, 806, 801,
+    807, 801, 806,
+    808, 801, 807,
+    801, 808, 805,
+    799, 809, 800,
+    800, 809, 806,
+    807, 806, 809,
+    810, 807, 809,
+    807, 810, 808,
+    810, 811, 808,
+    809, 812, 810,
+    813, 810, 812,
+    810, 813, 811,
+    762, 814, 763,
+    814, 815, 763,
+    816, 763, 815,
+    817, 762, 761,
+    762, 817, 815,
+    815, 814, 762,
+    815, 817, 818,
+    815, 818, 816,
+    819, 816, 818,
+    820, 818, 817,
+    818, 820, 819,
+    761, 821, 817,
+    822, 817, 821,
+    823, 817, 822,
+    817, 823, 820,
+    761, 824, 821,
+    821, 824, 822,
+    825, 822, 824,
+    822, 825, 823,
+    826, 823, 825,
+    827, 820, 823,
+    823, 826, 827,
+    828, 819, 820,
+    820, 827, 828,
+    829, 827, 826,
+    827, 829, 828,
+    825, 830, 826,
+    831, 826, 830,
+    832, 826, 831,
+    826, 832, 829,
+    824, 833, 825,
+    825, 833, 830,
+    831, 830, 833,
+    834, 831, 833,
+    831, 834, 832,
+    834, 835, 832,
+    833, 836, 834,
+    837, 834, 836,
+    834, 837, 835,
+    755, 838, 756,
+    838, 839, 756,
+    840, 756, 839,
+    841, 755, 754,
+    755, 841, 839,
+    839, 838, 755,
+    839, 841, 842,
+    839, 842, 840,
+    843, 840, 842,
+    844, 842, 841,
+    842, 844, 843,
+    754, 845, 841,
+    846, 841, 845,
+    847, 841, 846,
+    841, 847, 844,
+    754, 848, 845,
+    845, 848, 846,
+    849, 846, 848,
+    846, 849, 847,
+    850, 847, 849,
+    851, 844, 847,
+    847, 850, 851,
+    852, 843, 844,
+    844, 851, 852,
+    853, 851, 850,
+    851, 853, 852,
+    849, 854, 850,
+    855, 850, 854,
+    856, 850, 855,
+    850, 856, 853,
+    848, 857, 849,
+    849, 857, 854,
+    855, 854, 857,
+    858, 855, 857,
+    855, 858, 856,
+    858, 859, 856,
+    857, 860, 858,
+    861, 858, 860,
+    858, 861, 859,
+    862, 863, 864,
+    865, 864, 863,
+    863, 866, 865,
+    867, 868, 863,
+    869, 863, 868,
+    870, 871, 864,
+    864, 865, 872,
+    872, 870, 864,
+    873, 865, 866,
+    865, 873, 874,
+    874, 872, 865,
+    875, 873, 866,
+    866, 876, 875,
+    873, 875, 877,
+    877, 874, 873,
+    872, 874, 878,
+    879, 878, 874,
+    874, 877, 879,
+    870, 872, 880,
+    872, 878, 881,
+    872, 881, 880,
+    871, 870, 882,
+    880, 882, 870,
+    883, 880, 881,
+    884, 881, 878,
+    883, 881, 884,
+    878, 879, 884,
+    885, 879, 877,
+    879, 885, 884,
+    877, 875, 885,
+    875, 886, 885,
+    884, 885, 887,
+    888, 885, 886,
+    885, 888, 889,
+    885, 889, 887,
+    887, 883, 884,
+    890, 883, 887,
+    887, 889, 890,
+    886, 891, 888,
+    875, 892, 886,
+    892, 893, 886,
+    891, 886, 893,
+    891, 893, 894,
+    893, 892, 894,
+    876, 894, 892,
+    876, 892, 875,
+    895, 882, 896,
+    897, 896, 882,
+    882, 898, 897,
+    899, 900, 896,
+    896, 897, 901,
+    901, 899, 896,
+    902, 897, 898,
+    897, 902, 903,
+    903, 901, 897,
+    904, 902, 898,
+    898, 905, 904,
+    902, 904, 906,
+    906, 903, 902,
+    901, 903, 907,
+    908, 907, 903,
+    903, 906, 908,
+    899, 901, 909,
+    901, 907, 910,
+    901, 910, 909,
+    900, 899, 911,
+    909, 911, 899,
+    912, 909, 910,
+    913, 910, 907,
+    912, 910, 913,
+    907, 908, 913,
+    914, 908, 906,
+    908, 914, 913,
+    906, 904, 914,
+    904, 915, 914,
+    913, 914, 916,
+    917, 914, 915,
+    914, 917, 918,
+    914, 918, 916,
+    916, 912, 913,
+    919, 912, 916,
+    916, 918, 919,
+    915, 920, 917,
+    904, 921, 915,
+    921, 922, 915,
+    920, 915, 922,
+    920, 922, 923,
+    922, 921, 923,
+    905, 923, 921,
+    905, 921, 904,
+    924, 911, 925,
+    926, 925, 911,
+    911, 927, 926,
+    928, 929, 925,
+    925, 926, 930,
+    930, 928, 925,
+    931, 926, 927,
+    926, 931, 932,
+    932, 930, 926,
+    933, 931, 927,
+    927, 934, 933,
+    931, 933, 935,
+    935, 932, 931,
+    930, 932, 936,
+    937, 936, 932,
+    932, 935, 937,
+    928, 930, 938,
+    930, 936, 939,
+    930, 939, 938,
+    929, 928, 940,
+    938, 940, 928,
+    941, 938, 939,
+    942, 939, 936,
+    941, 939, 942,
+    936, 937, 942,
+    943, 937, 935,
+    937, 943, 942,
+    935, 933, 943,
+    933, 944, 943,
+    942, 943, 945,
+    946, 943, 944,
+    943, 946, 947,
+    943, 947, 945,
+    945, 941, 942,
+    948, 941, 945,
+    945, 947, 948,
+    944, 949, 946,
+    933, 950, 944,
+    950, 951, 944,
+    949, 944, 951,
+    949, 951, 952,
+    951, 950, 952,
+    934, 952, 950,
+    934, 950, 933,
+    953, 940, 954,
+    955, 954, 940,
+    940, 956, 955,
+    868, 867, 954,
+    954, 955, 957,
+    957, 868, 954,
+    958, 955, 956,
+    955, 958, 959,
+    959, 957, 955,
+    960, 958, 956,
+    956, 961, 960,
+    958, 960, 962,
+    962, 959, 958,
+    957, 959, 963,
+    964, 963, 959,
+    959, 962, 964,
+    868, 957, 869,
+    957, 963, 965,
+    957, 965, 869,
+    966, 965, 963,
+    963, 964, 966,
+    967, 964, 962,
+    964, 967, 966,
+    962, 960, 967,
+    961, 968, 960,
+    960, 968, 969,
+    960, 969, 967,
+    961, 970, 968,
+    971, 968, 970,
+    968, 971, 969,
+    972, 967, 969,
+    973, 969, 971,
+    969, 973, 972,
+    966, 967, 974,
+    967, 972, 975,
+    967, 975, 974,
+    976, 965, 966,
+    974, 976, 966,
+    976, 869, 965,
+    977, 976, 974,
+    974, 975, 977,
+    973, 971, 970,
+    0, 1, 2,
+    3, 4, 0,
+    0, 2, 3,
+    5, 1, 6,
+    2, 1, 5,
+    7, 2, 5,
+    2, 7, 3,
+    4, 3, 8,
+    9, 3, 7,
+    10, 3, 9,
+    10, 8, 3,
+    4, 8, 11,
+    12, 8, 13,
+    8, 14, 13,
+    15, 12, 16,
+    12, 13, 16,
+    17, 16, 13,
+    18, 13, 14,
+    19, 17, 13,
+    13, 18, 19,
+    14, 20, 18,
+    21, 19, 18,
+    21, 18, 20,
+    17, 19, 22,
+    19, 21, 22,
+    17, 23, 16,
+    24, 23, 17,
+    17, 22, 24,
+    15, 16, 25,
+    16, 23, 25,
+    25, 26, 15,
+    27, 26, 25,
+    28, 27, 25,
+    29, 28, 25,
+    25, 23, 29,
+    30, 29, 23,
+    23, 24, 30,
+    31, 24, 22,
+    24, 31, 30,
+    22, 21, 31,
+    31, 32, 30,
+    32, 31, 33,
+    29, 30, 34,
+    32, 34, 30,
+    34, 28, 29,
+    27, 28, 35,
+    36, 35, 28,
+    37, 36, 28,
+    28, 34, 37,
+    38, 26, 27,
+    38, 27, 35,
+    35, 39, 38,
+    39, 35, 40,
+    41, 35, 36,
+    41, 40, 35,
+    42, 41, 36,
+    36, 37, 42,
+    42, 37, 34,
+    34, 32, 42,
+    33, 42, 32,
+    42, 33, 43,
+    41, 42, 44,
+    43, 44, 42,
+    43, 41, 44,
+    39, 40, 45,
+    46, 40, 47,
+    40, 48, 47,
+    49, 46, 50,
+    46, 47, 50,
+    51, 50, 47,
+    52, 47, 48,
+    53, 51, 47,
+    47, 52, 53,
+    48, 54, 52,
+    55, 53, 52,
+    55, 52, 54,
+    51, 53, 56,
+    53, 55, 56,
+    51, 57, 50,
+    58, 57, 51,
+    51, 56, 58,
+    49, 50, 59,
+    50, 57, 59,
+    59, 60, 49,
+    61, 60, 59,
+    62, 61, 59,
+    63, 62, 59,
+    59, 57, 63,
+    64, 63, 57,
+    57, 58, 64,
+    65, 58, 56,
+    58, 65, 64,
+    56, 55, 65,
+    65, 66, 64,
+    66, 65, 67,
+    63, 64, 68,
+    66, 68, 64,
+    68, 62, 63,
+    61, 62, 69,
+    70, 69, 62,
+    71, 70, 62,
+    62, 68, 71,
+    72, 60, 61,
+    72, 61, 69,
+    69, 73, 72,
+    73, 69, 74,
+    75, 69, 70,
+    75, 74, 69,
+    76, 75, 70,
+    70, 71, 76,
+    76, 71, 68,
+    68, 66, 76,
+    67, 76, 66,
+    76, 67, 77,
+    75, 76, 78,
+    77, 78, 76,
+    77, 75, 78,
+    73, 74, 79,
+    80, 74, 81,
+    74, 82, 81,
+    83, 80, 84,
+    80, 81, 84,
+    85, 84, 81,
+    86, 81, 82,
+    87, 85, 81,
+    81, 86, 87,
+    82, 88, 86,
+    89, 87, 86,
+    89, 86, 88,
+    85, 87, 90,
+    87, 89, 90,
+    85, 91, 84,
+    92, 91, 85,
+    85, 90, 92,
+    83, 84, 93,
+    84, 91, 93,
+    93, 94, 83,
+    95, 94, 93,
+    96, 95, 93,
+    97, 96, 93,
+    93, 91, 97,
+    98, 97, 91,
+    91, 92, 98,
+    99, 92, 90,
+    92, 99, 98,
+    90, 89, 99,
+    99, 100, 98,
+    100, 99, 101,
+    97, 98, 102,
+    100, 102, 98,
+    102, 96, 97,
+    95, 96, 103,
+    104, 103, 96,
+    105, 104, 96,
+    96, 102, 105,
+    106, 94, 95,
+    106, 95, 103,
+    103, 107, 106,
+    107, 103, 108,
+    109, 103, 104,
+    109, 108, 103,
+    110, 109, 104,
+    104, 105, 110,
+    110, 105, 102,
+    102, 100, 110,
+    101, 110, 100,
+    110, 101, 111,
+    109, 110, 112,
+    111, 112, 110,
+    111, 109, 112,
+    113, 108, 114,
+    108, 115, 114,
+    107, 108, 116,
+    6, 113, 117,
+    113, 114, 117,
+    118, 117, 114,
+    119, 114, 115,
+    120, 118, 114,
+    114, 119, 120,
+    115, 121, 119,
+    122, 120, 119,
+    122, 119, 121,
+    118, 120, 123,
+    120, 122, 123,
+    118, 124, 117,
+    125, 124, 118,
+    118, 123, 125,
+    6, 117, 5,
+    117, 124, 5,
+    5, 124, 126,
+    127, 126, 124,
+    124, 125, 127,
+    128, 125, 123,
+    125, 128, 127,
+    123, 122, 128,
+    121, 129, 122,
+    130, 122, 129,
+    131, 132, 122,
+    122, 130, 131,
+    129, 133, 130,
+    134, 129, 135,
+    136, 130, 133,
+    130, 136, 131,
+    132, 131, 137,
+    138, 137, 131,
+    139, 131, 136,
+    131, 139, 138,
+    137, 140, 132,
+    141, 140, 137,
+    137, 138, 142,
+    143, 141, 137,
+    137, 142, 143,
+    138, 139, 142,
+    139, 136, 144,
+    133, 144, 136,
+    145, 143, 142,
+    142, 146, 147,
+    141, 143, 148,
+    145, 148, 143,
+    141, 149, 140,
+    150, 149, 141,
+    148, 150, 141,
+    150, 148, 151,
+    148, 145, 152,
+    152, 151, 148,
+    149, 150, 151,
+    151, 153, 149,
+    20, 153, 21,
+    154, 21, 153,
+    153, 155, 154,
+    156, 157, 21,
+    21, 154, 156,
+    158, 154, 155,
+    154, 158, 156,
+    155, 159, 158,
+    160, 156, 158,
+    160, 158, 159,
+    157, 156, 161,
+    162, 161, 156,
+    156, 160, 162,
+    161, 163, 157,
+    164, 163, 161,
+    161, 162, 165,
+    166, 164, 161,
+    161, 165, 166,
+    162, 160, 165,
+    167, 166, 165,
+    165, 168, 169,
+    168, 165, 170,
+    164, 166, 171,
+    167, 171, 166,
+    172, 163, 164,
+    171, 172, 164,
+    173, 174, 163,
+    163, 172, 173,
+    172, 171, 173,
+    171, 167, 175,
+    175, 173, 171,
+    176, 177, 175,
+    178, 175, 179,
+    179, 175, 169,
+    176, 180, 181,
+    177, 176, 181,
+    182, 183, 177,
+    182, 177, 181,
+    184, 177, 183,
+    185, 181, 180,
+    185, 182, 181,
+    180, 186, 185,
+    185, 187, 188,
+    187, 185, 186,
+    188, 189, 185,
+    182, 185, 189,
+    189, 190, 182,
+    183, 182, 190,
+    190, 191, 183,
+    191, 192, 183,
+    190, 192, 191,
+    193, 194, 192,
+    192, 195, 193,
+    196, 197, 192,
+    193, 198, 199,
+    199, 200, 193,
+    198, 193, 195,
+    194, 193, 200,
+    194, 200, 184,
+    200, 199, 201,
+    201, 184, 200,
+    199, 202, 203,
+    199, 203, 201,
+    198, 202, 199,
+    202, 198, 195,
+    195, 204, 202,
+    88, 204, 89,
+    205, 89, 204,
+    204, 206, 205,
+    207, 208, 89,
+    89, 205, 207,
+    209, 205, 206,
+    205, 209, 207,
+    206, 210, 209,
+    211, 207, 209,
+    211, 209, 210,
+    208, 207, 212,
+    213, 212, 207,
+    207, 211, 213,
+    212, 214, 208,
+    215, 214, 212,
+    212, 213, 216,
+    217, 215, 212,
+    212, 216, 217,
+    213, 211, 216,
+    218, 217, 216,
+    216, 197, 219,
+    215, 217, 220,
+    218, 220, 217,
+    215, 135, 214,
+    221, 135, 215,
+    220, 221, 215,
+    221, 220, 134,
+    220, 218, 222,
+    222, 134, 220,
+    135, 221, 134,
+    223, 222, 224,
+    224, 222, 219,
+    225, 146, 222,
+    219, 226, 223,
+    223, 224, 219,
+    226, 219, 197,
+    226, 197, 227,
+    197, 196, 227,
+    226, 228, 229,
+    228, 226, 227,
+    229, 223, 226,
+    228, 227, 230,
+    196, 230, 227,
+    228, 231, 232,
+    231, 228, 188,
+    232, 229, 228,
+    230, 188, 228,
+    233, 232, 231,
+    234, 235, 232,
+    236, 232, 235,
+    233, 237, 234,
+    235, 234, 237,
+    233, 188, 187,
+    186, 238, 233,
+    238, 186, 237,
+    186, 178, 239,
+    240, 237, 186,
+    186, 239, 241,
+    186, 241, 240,
+    237, 242, 235,
+    243, 235, 242,
+    242, 244, 243,
+    235, 243, 245,
+    147, 243, 244,
+    243, 147, 146,
+    243, 146, 245,
+    244, 152, 246,
+    244, 246, 147,
+    246, 152, 147,
+    247, 170, 152,
+    247, 240, 241,
+    241, 170, 247,
+    170, 241, 239,
+    239, 168, 170,
+    239, 169, 168,
+    169, 239, 178,
+    178, 179, 169,
+    235, 245, 236,
+    225, 236, 245,
+    146, 225, 245,
+    201, 203, 248,
+    248, 249, 201,
+    250, 201, 249,
+    201, 250, 184,
+    249, 248, 55,
+    55, 251, 249,
+    251, 252, 249,
+    253, 249, 252,
+    249, 253, 250,
+    250, 253, 184,
+    253, 252, 254,
+    252, 251, 255,
+    255, 254, 252,
+    251, 55, 255,
+    54, 174, 55,
+    174, 255, 55,
+    256, 174, 257,
+    258, 259, 256,
+    257, 258, 256,
+    256, 260, 261,
+    262, 256, 261,
+    263, 256, 262,
+    258, 257, 264,
+    264, 257, 265,
+    258, 266, 259,
+    266, 258, 264,
+    266, 267, 259,
+    267, 261, 259,
+    259, 261, 260,
+    261, 267, 268,
+    268, 269, 261,
+    262, 261, 269,
+    270, 262, 269,
+    262, 270, 263,
+    271, 272, 269,
+    271, 269, 267,
+    269, 272, 273,
+    268, 267, 269,
+    273, 274, 269,
+    275, 269, 274,
+    270, 269, 275,
+    275, 276, 270,
+    275, 274, 277,
+    277, 276, 275,
+    274, 273, 278,
+    278, 277, 274,
+    273, 272, 279,
+    279, 280, 273,
+    280, 278, 273,
+    271, 279, 272,
+    279, 271, 281,
+    279, 281, 282,
+    281, 283, 284,
+    284, 285, 281,
+    286, 281, 271,
+    287, 281, 285,
+    281, 287, 282,
+    280, 282, 287,
+    287, 288, 280,
+    288, 289, 280,
+    280, 289, 277,
+    287, 285, 290,
+    288, 287, 290,
+    285, 284, 291,
+    290, 285, 291,
+    292, 291, 284,
+    292, 284, 293,
+    293, 284, 283,
+    294, 295, 291,
+    291, 292, 294,
+    296, 291, 295,
+    290, 291, 296,
+    292, 297, 298,
+    298, 294, 292,
+    297, 292, 299,
+    300, 299, 292,
+    293, 300, 292,
+    300, 293, 301,
+    283, 301, 293,
+    299, 300, 302,
+    299, 303, 297,
+    303, 299, 304,
+    303, 305, 297,
+    305, 303, 306,
+    304, 307, 305,
+    304, 305, 306,
+    307, 304, 308,
+    304, 302, 308,
+    302, 301, 309,
+    310, 308, 302,
+    302, 309, 310,
+    301, 283, 309,
+    283, 286, 309,
+    271, 309, 286,
+    271, 310, 309,
+    308, 310, 311,
+    271, 311, 310,
+    307, 308, 312,
+    311, 312, 308,
+    312, 313, 307,
+    313, 312, 314,
+    312, 315, 314,
+    312, 311, 315,
+    316, 315, 311,
+    311, 271, 316,
+    267, 316, 271,
+    316, 317, 315,
+    318, 317, 316,
+    319, 318, 316,
+    316, 267, 319,
+    314, 315, 320,
+    321, 320, 315,
+    315, 317, 321,
+    320, 317, 296,
+    317, 318, 296,
+    322, 296, 318,
+    323, 322, 318,
+    318, 267, 323,
+    266, 323, 267,
+    322, 323, 290,
+    264, 290, 323,
+    323, 266, 264,
+    296, 322, 290,
+    296, 295, 320,
+    324, 320, 295,
+    320, 325, 314,
+    295, 294, 325,
+    325, 324, 295,
+    326, 325, 294,
+    325, 327, 314,
+    314, 328, 313,
+    328, 314, 326,
+    327, 326, 314,
+    328, 326, 294,
+    294, 298, 328,
+    289, 288, 290,
+    290, 264, 289,
+    289, 264, 265,
+    289, 265, 277,
+    329, 277, 265,
+    128, 330, 127,
+    330, 128, 331,
+    330, 332, 127,
+    332, 330, 333,
+    331, 333, 330,
+    126, 127, 332,
+    332, 7, 126,
+    7, 332, 334,
+    333, 334, 332,
+    333, 10, 9,
+    9, 334, 333,
+    10, 333, 335,
+    336, 335, 333,
+    333, 331, 336,
+    334, 9, 7,
+    126, 7, 5,
+    336, 10, 335,
+    337, 338, 339,
+    340, 337, 339,
+    337, 340, 341,
+    342, 338, 337,
+    337, 341, 342,
+    343, 344, 339,
+    345, 339, 344,
+    339, 345, 340,
+    346, 340, 345,
+    346, 341, 340,
+    347, 341, 346,
+    341, 347, 342,
+    345, 348, 346,
+    346, 349, 347,
+    350, 346, 348,
+    350, 349, 346,
+    344, 351, 345,
+    352, 345, 351,
+    345, 352, 348,
+    344, 343, 353,
+    353, 354, 344,
+    354, 351, 344,
+    354, 355, 351,
+    352, 351, 355,
+    355, 356, 352,
+    352, 356, 357,
+    357, 348, 352,
+    348, 357, 350,
+    350, 357, 358,
+    358, 349, 350,
+    355, 359, 360,
+    361, 355, 360,
+    359, 362, 363,
+    363, 364, 359,
+    360, 359, 364,
+    360, 364, 365,
+    365, 366, 360,
+    361, 360, 366,
+    366, 367, 361,
+    366, 368, 367,
+    369, 367, 368,
+    367, 369, 370,
+    370, 371, 367,
+    366, 372, 368,
+    372, 373, 368,
+    368, 374, 369,
+    374, 368, 373,
+    374, 375, 369,
+    376, 370, 369,
+    369, 375, 376,
+    371, 370, 377,
+    378, 377, 370,
+    370, 376, 379,
+    379, 378, 370,
+    371, 377, 380,
+    377, 381, 380,
+    382, 383, 380,
+    378, 380, 381,
+    380, 378, 382,
+    382, 378, 384,
+    383, 382, 385,
+    386, 382, 384,
+    382, 386, 387,
+    382, 387, 385,
+    383, 388, 389,
+    385, 388, 383,
+    390, 388, 385,
+    390, 385, 391,
+    385, 387, 391,
+    389, 388, 392,
+    390, 392, 388,
+    393, 394, 389,
+    389, 392, 393,
+    392, 390, 393,
+    395, 390, 391,
+    395, 393, 390,
+    394, 393, 396,
+    396, 393, 373,
+    393, 397, 373,
+    347, 394, 396,
+    347, 396, 366,
+    372, 366, 396,
+    396, 373, 372,
+    373, 398, 375,
+    375, 374, 373,
+    373, 397, 398,
+    397, 395, 398,
+    366, 365, 399,
+    399, 400, 366,
+    400, 401, 366,
+    366, 401, 347,
+    402, 347, 401,
+    401, 400, 402,
+    400, 403, 404,
+    403, 400, 399,
+    400, 404, 402,
+    399, 405, 403,
+    405, 399, 365,
+    365, 406, 405,
+    365, 363, 406,
+    364, 363, 365,
+    407, 403, 405,
+    405, 406, 407,
+    403, 408, 409,
+    403, 407, 408,
+    404, 403, 409,
+    409, 402, 404,
+    363, 410, 406,
+    410, 363, 362,
+    410, 362, 411,
+    384, 379, 386,
+    412, 413, 414,
+    415, 412, 416,
+    412, 415, 417,
+    412, 418, 419,
+    412, 420, 421,
+    422, 414, 413,
+    423, 422, 413,
+    424, 414, 422,
+    422, 425, 424,
+    426, 422, 423,
+    422, 426, 425,
+    423, 427, 426,
+    426, 427, 428,
+    425, 426, 429,
+    429, 426, 428,
+    429, 424, 425,
+    428, 430, 429,
+    431, 428, 427,
+    428, 431, 430,
+    432, 421, 420,
+    433, 421, 432,
+    420, 434, 432,
+    432, 435, 433,
+    436, 432, 434,
+    432, 436, 435,
+    437, 433, 435,
+    435, 436, 437,
+    434, 438, 436,
+    436, 438, 439,
+    437, 436, 439,
+    439, 440, 437,
+    441, 439, 438,
+    439, 441, 440,
+    442, 419, 418,
+    443, 419, 442,
+    444, 442, 418,
+    442, 445, 443,
+    446, 442, 444,
+    442, 446, 445,
+    447, 443, 445,
+    445, 446, 447,
+    444, 448, 446,
+    446, 448, 449,
+    447, 446, 449,
+    449, 450, 447,
+    451, 449, 448,
+    449, 451, 450,
+    452, 417, 415,
+    415, 453, 452,
+    454, 452, 453,
+    455, 415, 416,
+    456, 415, 455,
+    415, 456, 453,
+    453, 456, 454,
+    457, 458, 454,
+    454, 456, 457,
+    455, 459, 456,
+    456, 459, 457,
+    460, 457, 459,
+    457, 460, 458,
+    461, 462, 463,
+    464, 463, 462,
+    462, 465, 464,
+    462, 466, 467,
+    468, 462, 467,
+    462, 468, 469,
+    470, 471, 463,
+    464, 470, 463,
+    470, 464, 472,
+    473, 470, 474,
+    475, 474, 470,
+    470, 476, 475,
+    464, 477, 472,
+    478, 472, 477,
+    479, 477, 464,
+    479, 480, 477,
+    477, 480, 481,
+    481, 478, 477,
+    464, 482, 479,
+    480, 479, 482,
+    482, 483, 480,
+    480, 483, 481,
+    482, 464, 465,
+    465, 484, 482,
+    482, 484, 483,
+    484, 485, 483,
+    465, 486, 484,
+    485, 484, 486,
+    475, 487, 474,
+    487, 475, 488,
+    489, 490, 475,
+    475, 490, 488,
+    491, 475, 476,
+    475, 491, 489,
+    487, 492, 474,
+    493, 487, 494,
+    495, 494, 487,
+    487, 496, 495,
+    497, 498, 494,
+    495, 497, 494,
+    497, 495, 499,
+    500, 501, 495,
+    495, 501, 499,
+    502, 495, 496,
+    495, 502, 500,
+    496, 503, 504,
+    496, 504, 502,
+    505, 500, 502,
+    502, 504, 506,
+    502, 506, 505,
+    500, 505, 501,
+    507, 499, 501,
+    501, 505, 508,
+    508, 507, 501,
+    505, 506, 508,
+    504, 509, 506,
+    509, 504, 503,
+    510, 497, 467,
+    468, 467, 497,
+    497, 511, 468,
+    512, 513, 468,
+    468, 513, 469,
+    514, 468, 511,
+    468, 514, 512,
+    511, 515, 516,
+    511, 516, 514,
+    517, 512, 514,
+    514, 516, 518,
+    514, 518, 517,
+    512, 517, 513,
+    519, 469, 513,
+    513, 517, 520,
+    520, 519, 513,
+    517, 518, 520,
+    516, 521, 518,
+    521, 516, 515,
+    522, 489, 491,
+    489, 522, 490,
+    491, 523, 522,
+    490, 522, 524,
+    522, 523, 524,
+    476, 525, 491,
+    491, 525, 523,
+    525, 526, 523,
+    476, 527, 525,
+    526, 525, 527,
+    524, 528, 490,
+    528, 488, 490,
+};
+#define mesh_lods_count 4
+static const int mesh_lods[][4] = {
+    {0, 3644, 0, 6320},
+    {3644, 1886, 18960, 3160},
+    {5530, 978, 28440, 1580},
+    {6508, 529, 33180, 789},
+};
+static const float mesh_lod_errors[] = {
+    0.000000,
+    0.009509,
+    0.031173,
+    0.063062,
+};
+#endif // OBJ_H_
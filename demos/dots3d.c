@@ -24,7 +24,7 @@ Olivec_Canvas vc_render(float dt)
 {
     angle += 0.25*PI*dt;
 
-    Olivec_Canvas oc = olivec_canvas(pixels, WIDTH, HEIGHT, WIDTH);
+    Olivec_Canvas oc = vc_canvas(pixels, WIDTH, HEIGHT);
 
     olivec_fill(oc, BACKGROUND_COLOR);
     for (int ix = 0; ix < GRID_COUNT; ++ix) {
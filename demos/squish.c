@@ -6,9 +6,17 @@
 
 float sinf(float);
 
+#define BACKGROUND_COLOR 0xFF181818
+
 static uint32_t dst[WIDTH*HEIGHT];
 static float global_time = 0;
 
+// Only the sprite changes, so the frame keeps its own pixels and just erases the sprite from the previous
+// frame before drawing it again. The platforms then show only the damaged rectangles.
+static Olivec_Damage damage = {0};
+static bool background_drawn = false;
+static int sprite_x, sprite_y, sprite_w, sprite_h;
+
 #define SRC_SCALE 3
 
 Olivec_Canvas vc_render(float dt)
@@ -17,17 +25,24 @@ Olivec_Canvas vc_render(float dt)
 
     float t = sinf(10*global_time);
 
-    Olivec_Canvas dst_canvas = olivec_canvas(dst, WIDTH, HEIGHT, WIDTH);
+    Olivec_Canvas dst_canvas = olivec_damage_track(olivec_canvas(dst, WIDTH, HEIGHT, WIDTH), &damage);
 
-    olivec_fill(dst_canvas, 0xFF181818);
+    if (background_drawn) {
+        olivec_rect(dst_canvas, sprite_x, sprite_y, sprite_w, sprite_h, BACKGROUND_COLOR);
+    } else {
+        olivec_fill(dst_canvas, BACKGROUND_COLOR);
+        background_drawn = true;
+    }
 
     int factor = 100;
-    int w = tsodinPog_width*SRC_SCALE - t*factor;
-    int h = tsodinPog_height*SRC_SCALE + t*factor;
+    sprite_w = tsodinPog_width*SRC_SCALE - t*factor;
+    sprite_h = tsodinPog_height*SRC_SCALE + t*factor;
+    sprite_x = WIDTH/2 - sprite_w/2;
+    sprite_y = HEIGHT - sprite_h;
 
     olivec_sprite_copy_bilinear(
         dst_canvas,
-        WIDTH/2 - w/2, HEIGHT - h, w, h,
+        sprite_x, sprite_y, sprite_w, sprite_h,
         olivec_canvas(tsodinPog_pixels, tsodinPog_width, tsodinPog_height, tsodinPog_width));
 
     return dst_canvas;
@@ -32,7 +32,7 @@ static inline void rotate_point(float *x, float *y)
 
 Olivec_Canvas vc_render(float dt)
 {
-    Olivec_Canvas oc = olivec_canvas(pixels, WIDTH, HEIGHT, WIDTH);
+    Olivec_Canvas oc = vc_canvas(pixels, WIDTH, HEIGHT);
 
     olivec_fill(oc, BACKGROUND_COLOR);
 
@@ -58,7 +58,7 @@ Olivec_Canvas vc_render(float dt)
 {
     global_time += dt;
 
-    Olivec_Canvas oc1 = olivec_canvas(pixels1, WIDTH, HEIGHT, WIDTH);
+    Olivec_Canvas oc1 = vc_canvas(pixels1, WIDTH, HEIGHT);
     olivec_fill(oc1, 0xFF181818);
     Olivec_Canvas zb1 = olivec_canvas((uint32_t*)zbuffer1, WIDTH, HEIGHT, WIDTH);
     olivec_fill(zb1, 0);
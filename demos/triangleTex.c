@@ -17,7 +17,7 @@ float cosf(float x);
 
 Olivec_Canvas vc_render(float dt)
 {
-    Olivec_Canvas oc = olivec_canvas(pixels, WIDTH, HEIGHT, WIDTH);
+    Olivec_Canvas oc = vc_canvas(pixels, WIDTH, HEIGHT);
     Olivec_Canvas tsodinPog = olivec_canvas(tsodinPog_pixels, tsodinPog_width, tsodinPog_height, tsodinPog_width);
 
     olivec_fill(oc, BACKGROUND_COLOR);
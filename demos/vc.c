@@ -14,7 +14,7 @@
 //
 // static Olivec_Canvas vc_render(float dt)
 // {
-//     Olivec_Canvas oc = olivec_canvas(pixels, WIDTH, HEIGHT, WIDTH);
+//     Olivec_Canvas oc = vc_canvas(pixels, WIDTH, HEIGHT);
 //     // ...
 //     // ... render into oc ...
 //     // ...
@@ -34,6 +34,25 @@
 
 Olivec_Canvas vc_render(float dt);
 
+// Canvas for vc_render() to draw the frame into. Platforms that can show memory of their own without
+// copying it (the streaming texture of SDL) hand it out once its size is right, the rest get the
+// pixels buffer of width*height. Its content is undefined, so the frame must paint every pixel.
+// vc_render() may as well return any other canvas, which the platform then copies.
+//
+// A frame that redraws only what changed keeps its own pixels instead and returns them with a tracker
+// from olivec_damage_track() attached. The platforms then show only the damaged rectangles and clear
+// the tracker for the next frame.
+Olivec_Canvas vc_canvas(uint32_t *pixels, size_t width, size_t height);
+
+// The damage of the frame if it tracks the whole canvas it came with
+static inline Olivec_Damage *vc_damage(Olivec_Canvas oc)
+{
+    Olivec_Damage *damage = oc.damage;
+    if (damage == NULL) return NULL;
+    if (damage->pixels != oc.pixels || damage->width != oc.width || damage->height != oc.height) return NULL;
+    return damage;
+}
+
 #ifndef VC_PLATFORM
 #error "Please define VC_PLATFORM macro"
 #endif
@@ -52,6 +71,18 @@ Olivec_Canvas vc_render(float dt);
 static SDL_Texture *vc_sdl_texture = NULL;
 static size_t vc_sdl_actual_width = 0;
 static size_t vc_sdl_actual_height = 0;
+// The locked texture while vc_render() runs
+static Olivec_Canvas vc_sdl_canvas = {0};
+// The texture holds the previous frame, which was tracking its damage
+static bool vc_sdl_damaged = false;
+
+Olivec_Canvas vc_canvas(uint32_t *pixels, size_t width, size_t height)
+{
+    if (vc_sdl_canvas.pixels != NULL && vc_sdl_canvas.width == width && vc_sdl_canvas.height == height) {
+        return vc_sdl_canvas;
+    }
+    return olivec_canvas(pixels, width, height, width);
+}
 
 static bool vc_sdl_resize_texture(SDL_Renderer *renderer, size_t new_width, size_t new_height)
 {
@@ -103,21 +134,53 @@ int main(void)
             SDL_Rect window_rect = {0, 0, vc_sdl_actual_width, vc_sdl_actual_height};
 
             if (!pause) {
-                // Render the texture
-                Olivec_Canvas oc_src = vc_render(dt);
-                if (oc_src.width != vc_sdl_actual_width || oc_src.height != vc_sdl_actual_height) {
-                    if (!vc_sdl_resize_texture(renderer, oc_src.width, oc_src.height)) return_defer(1);
-                    SDL_SetWindowSize(window, vc_sdl_actual_width, vc_sdl_actual_height);
-                }
+                // Render the texture. vc_canvas() hands out the locked texture, so usually there is nothing to copy.
+                // Locking hands out undefined pixels, so after a frame that tracked its damage the texture is kept
+                // as it is and only the damaged rectangles of the next one are locked and copied.
                 void *pixels_dst;
                 int pitch;
-                if (SDL_LockTexture(vc_sdl_texture, &window_rect, &pixels_dst, &pitch) < 0) return_defer(1);
-                for (size_t y = 0; y < vc_sdl_actual_height; ++y) {
-                    // TODO: it would be cool if Olivec_Canvas supported pitch in bytes instead of pixels
-                    // It would be more flexible and we could draw on the locked texture memory directly
-                    memcpy((char*)pixels_dst + y*pitch, oc_src.pixels + y*vc_sdl_actual_width, vc_sdl_actual_width*sizeof(uint32_t));
+                if (vc_sdl_texture != NULL && !vc_sdl_damaged) {
+                    if (SDL_LockTexture(vc_sdl_texture, &window_rect, &pixels_dst, &pitch) < 0) return_defer(1);
+                    vc_sdl_canvas = olivec_canvas_pitch(pixels_dst, vc_sdl_actual_width, vc_sdl_actual_height, pitch);
                 }
-                SDL_UnlockTexture(vc_sdl_texture);
+                Olivec_Canvas oc_src = vc_render(dt);
+                Olivec_Damage *damage = vc_damage(oc_src);
+                bool drawn_in_place = vc_sdl_canvas.pixels != NULL && oc_src.pixels == vc_sdl_canvas.pixels &&
+                                      oc_src.width == vc_sdl_canvas.width && oc_src.height == vc_sdl_canvas.height;
+                if (drawn_in_place) {
+                    SDL_UnlockTexture(vc_sdl_texture);
+                } else {
+                    if (oc_src.width != vc_sdl_actual_width || oc_src.height != vc_sdl_actual_height) {
+                        if (vc_sdl_canvas.pixels != NULL) SDL_UnlockTexture(vc_sdl_texture);
+                        vc_sdl_canvas = OLIVEC_CANVAS_NULL;
+                        vc_sdl_damaged = false;
+                        if (!vc_sdl_resize_texture(renderer, oc_src.width, oc_src.height)) return_defer(1);
+                        SDL_SetWindowSize(window, vc_sdl_actual_width, vc_sdl_actual_height);
+                        window_rect = (SDL_Rect) {0, 0, vc_sdl_actual_width, vc_sdl_actual_height};
+                    }
+                    if (damage != NULL && vc_sdl_damaged) {
+                        for (size_t i = 0; i < damage->count; ++i) {
+                            Olivec_Damage_Rect r = damage->rects[i];
+                            SDL_Rect rect = {r.x, r.y, r.w, r.h};
+                            if (SDL_LockTexture(vc_sdl_texture, &rect, &pixels_dst, &pitch) < 0) return_defer(1);
+                            for (int y = 0; y < r.h; ++y) {
+                                memcpy((char*)pixels_dst + y*pitch, &OLIVEC_PIXEL(oc_src, r.x, r.y + y), r.w*sizeof(uint32_t));
+                            }
+                            SDL_UnlockTexture(vc_sdl_texture);
+                        }
+                    } else {
+                        if (vc_sdl_canvas.pixels == NULL) {
+                            if (SDL_LockTexture(vc_sdl_texture, &window_rect, &pixels_dst, &pitch) < 0) return_defer(1);
+                        }
+                        for (size_t y = 0; y < vc_sdl_actual_height; ++y) {
+                            memcpy((char*)pixels_dst + y*pitch, oc_src.pixels + y*oc_src.stride, vc_sdl_actual_width*sizeof(uint32_t));
+                        }
+                        SDL_UnlockTexture(vc_sdl_texture);
+                    }
+                }
+                vc_sdl_canvas = OLIVEC_CANVAS_NULL;
+                vc_sdl_damaged = damage != NULL && !drawn_in_place;
+                if (damage != NULL) olivec_damage_clear(damage);
             }
 
             // Display the texture
@@ -145,6 +208,7 @@ defer:
 #elif VC_PLATFORM == VC_TERM_PLATFORM
 
 #include <assert.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -156,11 +220,51 @@ defer:
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include "stb_image_write.h"
 
+#ifndef VC_TERM_SCALE_DOWN_FACTOR
+#define VC_TERM_SCALE_DOWN_FACTOR 20
+#endif // VC_TERM_SCALE_DOWN_FACTOR
+
+// By default a character is two spaces with one of the 256 colors of the palette as the background and
+// covers VC_TERM_SCALE_DOWN_FACTOR x VC_TERM_SCALE_DOWN_FACTOR pixels of the canvas. Terminals with 24-bit
+// colors can show the demos built with VC_TERM_TRUECOLOR defined, where every column is a character of its
+// own: an upper half block with the top pixel in the foreground color and the bottom one in the background
+// color. That puts four pixels of the terminal where there was one, each of them
+// VC_TERM_SCALE_DOWN_FACTOR/2 pixels of the canvas wide and high.
+#ifdef VC_TERM_TRUECOLOR
+#if VC_TERM_SCALE_DOWN_FACTOR%2 != 0
+#error "VC_TERM_SCALE_DOWN_FACTOR must be even for VC_TERM_TRUECOLOR"
+#endif
+#define VC_TERM_PIXEL_SIZE (VC_TERM_SCALE_DOWN_FACTOR/2)
+#define VC_TERM_CHAR_PIXELS 2
+#define VC_TERM_CHAR_COLUMNS 1
+#else
+#define VC_TERM_PIXEL_SIZE VC_TERM_SCALE_DOWN_FACTOR
+#define VC_TERM_CHAR_PIXELS 1
+#define VC_TERM_CHAR_COLUMNS 2
+#endif // VC_TERM_TRUECOLOR
+
 static size_t vc_term_actual_width = 0;
 static size_t vc_term_actual_height = 0;
+// Pixels of the terminal, VC_TERM_CHAR_PIXELS of them per character vertically. They are indices of the
+// palette, or 0xRRGGBB colors with VC_TERM_TRUECOLOR.
 static size_t vc_term_scaled_down_width = 0;
 static size_t vc_term_scaled_down_height = 0;
-static int *vc_term_char_canvas = 0;
+static int *vc_term_pixels = 0;
+// What the terminal currently shows, only valid if vc_term_printed is true
+static int *vc_term_prev_pixels = 0;
+static bool vc_term_printed = false;
+// Sums of the channels of every column of the canvas over a row of the pixels of the terminal
+static uint32_t *vc_term_sums = 0;
+
+// The whole frame is collected here and written at once
+static char *vc_term_out = NULL;
+static size_t vc_term_out_count = 0;
+static size_t vc_term_out_capacity = 0;
+
+Olivec_Canvas vc_canvas(uint32_t *pixels, size_t width, size_t height)
+{
+    return olivec_canvas(pixels, width, height, width);
+}
 
 int hsl256[][3] = {
     {0, 0, 0},
@@ -429,47 +533,21 @@ int distance_hsl256(int i, int h, int s, int l)
     return dh*dh + ds*ds + dl*dl;
 }
 
-// TODO: bring find_ansi_index_by_rgb from image2term
 int find_ansi_index_by_hsl(int h, int s, int l)
 {
     int index = 0;
-    for (int i = 0; i < 256; ++i) {
-        if (distance_hsl256(i, h, s, l) < distance_hsl256(index, h, s, l)) {
+    int distance = distance_hsl256(index, h, s, l);
+    for (int i = 1; i < 256; ++i) {
+        int d = distance_hsl256(i, h, s, l);
+        if (d < distance) {
             index = i;
+            distance = d;
         }
     }
     return index;
 }
 
-static uint32_t vc_term_compress_pixels_chunk(Olivec_Canvas oc)
-{
-    size_t r = 0;
-    size_t g = 0;
-    size_t b = 0;
-    size_t a = 0;
-
-    for (size_t y = 0; y < oc.height; ++y) {
-        for (size_t x = 0; x < oc.width; ++x) {
-            r += OLIVEC_RED(OLIVEC_PIXEL(oc, x, y));
-            g += OLIVEC_GREEN(OLIVEC_PIXEL(oc, x, y));
-            b += OLIVEC_BLUE(OLIVEC_PIXEL(oc, x, y));
-            a += OLIVEC_ALPHA(OLIVEC_PIXEL(oc, x, y));
-        }
-    }
-
-    r /= oc.width*oc.height;
-    g /= oc.width*oc.height;
-    b /= oc.width*oc.height;
-    a /= oc.width*oc.height;
-
-    return OLIVEC_RGBA(r, g, b, a);
-}
-
-#ifndef VC_TERM_SCALE_DOWN_FACTOR
-#define VC_TERM_SCALE_DOWN_FACTOR 20
-#endif // VC_TERM_SCALE_DOWN_FACTOR
-
-static void vc_term_resize_char_canvas(size_t new_width, size_t new_height)
+static void vc_term_resize_pixels(size_t new_width, size_t new_height)
 {
     // TODO: warn the user if vc_term_actual_width does not fit into the screen
     // TODO: can we just do something so the divisibility is not important?
@@ -479,11 +557,18 @@ static void vc_term_resize_char_canvas(size_t new_width, size_t new_height)
     assert(new_height%VC_TERM_SCALE_DOWN_FACTOR == 0 && "Height must be divisible by VC_TERM_SCALE_DOWN_FACTOR");
     vc_term_actual_width = new_width;
     vc_term_actual_height = new_height;
-    vc_term_scaled_down_width  = vc_term_actual_width/VC_TERM_SCALE_DOWN_FACTOR;
-    vc_term_scaled_down_height = vc_term_actual_height/VC_TERM_SCALE_DOWN_FACTOR;
-    free(vc_term_char_canvas);
-    vc_term_char_canvas = malloc(sizeof(*vc_term_char_canvas)*vc_term_scaled_down_width*vc_term_scaled_down_height);
-    assert(vc_term_char_canvas != NULL && "Just buy more RAM");
+    vc_term_scaled_down_width  = vc_term_actual_width/VC_TERM_PIXEL_SIZE;
+    vc_term_scaled_down_height = vc_term_actual_height/VC_TERM_PIXEL_SIZE;
+    free(vc_term_pixels);
+    vc_term_pixels = malloc(sizeof(*vc_term_pixels)*vc_term_scaled_down_width*vc_term_scaled_down_height);
+    assert(vc_term_pixels != NULL && "Just buy more RAM");
+    free(vc_term_prev_pixels);
+    vc_term_prev_pixels = malloc(sizeof(*vc_term_prev_pixels)*vc_term_scaled_down_width*vc_term_scaled_down_height);
+    assert(vc_term_prev_pixels != NULL && "Just buy more RAM");
+    free(vc_term_sums);
+    vc_term_sums = malloc(sizeof(*vc_term_sums)*4*vc_term_actual_width);
+    assert(vc_term_sums != NULL && "Just buy more RAM");
+    vc_term_printed = false;
 }
 
 void rgb_to_hsl(int r, int g, int b, int *h, int *s, int *l)
@@ -517,50 +602,284 @@ void rgb_to_hsl(int r, int g, int b, int *h, int *s, int *l)
     *l = lf*100.0f;
 }
 
-static void vc_term_compress_pixels(Olivec_Canvas oc)
+#ifndef VC_TERM_TRUECOLOR
+// Converting a color to HSL and searching the palette for it is too slow to do for every character
+// of every frame, so it is done once at startup for every color quantized to VC_TERM_LUT_BITS bits
+// per channel. Every quantized value stands for the colors around it, with 0 and 255 exact.
+#ifndef VC_TERM_LUT_BITS
+#define VC_TERM_LUT_BITS 6
+#endif // VC_TERM_LUT_BITS
+#define VC_TERM_LUT_SIZE (1 << VC_TERM_LUT_BITS)
+
+static uint8_t *vc_term_lut = NULL;
+
+static void vc_term_build_lut(void)
 {
-    if (vc_term_actual_width != oc.width || vc_term_actual_height != oc.height) {
-        vc_term_resize_char_canvas(oc.width, oc.height);
+    vc_term_lut = malloc(VC_TERM_LUT_SIZE*VC_TERM_LUT_SIZE*VC_TERM_LUT_SIZE);
+    assert(vc_term_lut != NULL && "Just buy more RAM");
+    for (int qr = 0; qr < VC_TERM_LUT_SIZE; ++qr) {
+        for (int qg = 0; qg < VC_TERM_LUT_SIZE; ++qg) {
+            for (int qb = 0; qb < VC_TERM_LUT_SIZE; ++qb) {
+                int h, s, l;
+                rgb_to_hsl(qr*255/(VC_TERM_LUT_SIZE - 1), qg*255/(VC_TERM_LUT_SIZE - 1), qb*255/(VC_TERM_LUT_SIZE - 1), &h, &s, &l);
+                vc_term_lut[(qr*VC_TERM_LUT_SIZE + qg)*VC_TERM_LUT_SIZE + qb] = find_ansi_index_by_hsl(h, s, l);
+            }
+        }
     }
+}
 
-    for (size_t y = 0; y < vc_term_scaled_down_height; ++y) {
-        for (size_t x = 0; x < vc_term_scaled_down_width; ++x) {
-            Olivec_Canvas soc = olivec_subcanvas(oc, x*VC_TERM_SCALE_DOWN_FACTOR, y*VC_TERM_SCALE_DOWN_FACTOR, VC_TERM_SCALE_DOWN_FACTOR, VC_TERM_SCALE_DOWN_FACTOR);
-            uint32_t cp = vc_term_compress_pixels_chunk(soc);
-            int r = OLIVEC_RED(cp);
-            int g = OLIVEC_GREEN(cp);
-            int b = OLIVEC_BLUE(cp);
-            int a = OLIVEC_ALPHA(cp);
+int find_ansi_index_by_rgb(int r, int g, int b)
+{
+    int shift = 8 - VC_TERM_LUT_BITS;
+    return vc_term_lut[((r >> shift)*VC_TERM_LUT_SIZE + (g >> shift))*VC_TERM_LUT_SIZE + (b >> shift)];
+}
+#endif // VC_TERM_TRUECOLOR
+
+// Averages the canvas over the pixels x1..x2, y1..y2 inclusive of the terminal. The rows of the canvas under a row
+// of them are summed up column by column first, which reads every pixel of the canvas once in the memory order
+// in a loop simple enough for the compiler to vectorize, and only then the columns are summed up per pixel.
+static void vc_term_compress_pixels_rect(Olivec_Canvas oc, size_t x1, size_t y1, size_t x2, size_t y2)
+{
+    size_t n = (x2 - x1 + 1)*VC_TERM_PIXEL_SIZE;
+    uint32_t *sums = vc_term_sums;
+    for (size_t y = y1; y <= y2; ++y) {
+        memset(sums, 0, sizeof(*sums)*4*n);
+        for (size_t py = y*VC_TERM_PIXEL_SIZE; py < (y + 1)*VC_TERM_PIXEL_SIZE; ++py) {
+            const uint32_t *row = &OLIVEC_PIXEL(oc, x1*VC_TERM_PIXEL_SIZE, py);
+            for (size_t i = 0; i < n; ++i) {
+                sums[4*i + 0] += OLIVEC_RED(row[i]);
+                sums[4*i + 1] += OLIVEC_GREEN(row[i]);
+                sums[4*i + 2] += OLIVEC_BLUE(row[i]);
+                sums[4*i + 3] += OLIVEC_ALPHA(row[i]);
+            }
+        }
+
+        const uint32_t *column = sums;
+        for (size_t x = x1; x <= x2; ++x) {
+            uint32_t r = 0, g = 0, b = 0, a = 0;
+            for (size_t i = 0; i < VC_TERM_PIXEL_SIZE; ++i, column += 4) {
+                r += column[0];
+                g += column[1];
+                b += column[2];
+                a += column[3];
+            }
+            r /= VC_TERM_PIXEL_SIZE*VC_TERM_PIXEL_SIZE;
+            g /= VC_TERM_PIXEL_SIZE*VC_TERM_PIXEL_SIZE;
+            b /= VC_TERM_PIXEL_SIZE*VC_TERM_PIXEL_SIZE;
+            a /= VC_TERM_PIXEL_SIZE*VC_TERM_PIXEL_SIZE;
             r = a*r/255;
             g = a*g/255;
             b = a*b/255;
-            int h, s, l;
-            rgb_to_hsl(r, g, b, &h, &s, &l);
-            vc_term_char_canvas[y*vc_term_scaled_down_width + x] = find_ansi_index_by_hsl(h, s, l);
+#ifdef VC_TERM_TRUECOLOR
+            vc_term_pixels[y*vc_term_scaled_down_width + x] = (r << 16) | (g << 8) | b;
+#else
+            vc_term_pixels[y*vc_term_scaled_down_width + x] = find_ansi_index_by_rgb(r, g, b);
+#endif // VC_TERM_TRUECOLOR
         }
     }
 }
 
-int main(void)
+static void vc_term_compress_pixels(Olivec_Canvas oc)
 {
-    for (;;) {
-        vc_term_compress_pixels(vc_render(1.f/60.f));
-        for (size_t y = 0; y < vc_term_scaled_down_height; ++y) {
-            for (size_t x = 0; x < vc_term_scaled_down_width; ++x) {
-                // TODO: explore the idea of figuring out aspect ratio of the character using escape ANSI codes of the terminal and rendering the image accordingly
-                printf("\033[48;5;%dm  ", vc_term_char_canvas[y*vc_term_scaled_down_width + x]);
+    // The damage is only enough when the characters outside of it are still there
+    static bool damaged = false;
+    Olivec_Damage *damage = vc_damage(oc);
+    if (vc_term_actual_width != oc.width || vc_term_actual_height != oc.height) {
+        vc_term_resize_pixels(oc.width, oc.height);
+        damaged = false;
+    }
+
+    if (damage != NULL && damaged) {
+        for (size_t i = 0; i < damage->count; ++i) {
+            Olivec_Damage_Rect r = damage->rects[i];
+            vc_term_compress_pixels_rect(oc,
+                                         r.x/VC_TERM_PIXEL_SIZE, r.y/VC_TERM_PIXEL_SIZE,
+                                         (r.x + r.w - 1)/VC_TERM_PIXEL_SIZE, (r.y + r.h - 1)/VC_TERM_PIXEL_SIZE);
+        }
+    } else if (vc_term_scaled_down_width > 0 && vc_term_scaled_down_height > 0) {
+        vc_term_compress_pixels_rect(oc, 0, 0, vc_term_scaled_down_width - 1, vc_term_scaled_down_height - 1);
+    }
+    damaged = damage != NULL;
+    if (damage != NULL) olivec_damage_clear(damage);
+}
+
+static void vc_term_printf(const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(NULL, 0, fmt, args);
+    va_end(args);
+    assert(n >= 0);
+
+    if (vc_term_out_count + n + 1 > vc_term_out_capacity) {
+        if (vc_term_out_capacity == 0) vc_term_out_capacity = 1024;
+        while (vc_term_out_count + n + 1 > vc_term_out_capacity) vc_term_out_capacity *= 2;
+        vc_term_out = realloc(vc_term_out, vc_term_out_capacity);
+        assert(vc_term_out != NULL && "Just buy more RAM");
+    }
+
+    va_start(args, fmt);
+    vsnprintf(vc_term_out + vc_term_out_count, n + 1, fmt, args);
+    va_end(args);
+    vc_term_out_count += n;
+}
+
+static void vc_term_flush(void)
+{
+    size_t written = 0;
+    while (written < vc_term_out_count) {
+        ssize_t n = write(STDOUT_FILENO, vc_term_out + written, vc_term_out_count - written);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            fprintf(stderr, "ERROR: could not write the frame: %s\n", strerror(errno));
+            exit(1);
+        }
+        written += n;
+    }
+    vc_term_out_count = 0;
+}
+
+// Colors the terminal currently uses, -1 if unknown
+typedef struct {
+    int fg;
+    int bg;
+} Vc_Term_Colors;
+
+#ifdef VC_TERM_TRUECOLOR
+static void vc_term_set_fg(Vc_Term_Colors *colors, int c)
+{
+    if (colors->fg == c) return;
+    vc_term_printf("\033[38;2;%d;%d;%dm", (c >> 16)&0xFF, (c >> 8)&0xFF, c&0xFF);
+    colors->fg = c;
+}
+#endif // VC_TERM_TRUECOLOR
+
+static void vc_term_set_bg(Vc_Term_Colors *colors, int c)
+{
+    if (colors->bg == c) return;
+#ifdef VC_TERM_TRUECOLOR
+    vc_term_printf("\033[48;2;%d;%d;%dm", (c >> 16)&0xFF, (c >> 8)&0xFF, c&0xFF);
+#else
+    vc_term_printf("\033[48;5;%dm", c);
+#endif // VC_TERM_TRUECOLOR
+    colors->bg = c;
+}
+
+// Whether the character x, y prints without changing the colors
+static bool vc_term_char_free(const Vc_Term_Colors *colors, size_t x, size_t y)
+{
+    const int *pixel = &vc_term_pixels[y*VC_TERM_CHAR_PIXELS*vc_term_scaled_down_width + x];
+#ifdef VC_TERM_TRUECOLOR
+    int top = pixel[0], bottom = pixel[vc_term_scaled_down_width];
+    return bottom == colors->bg && (top == bottom || top == colors->fg);
+#else
+    return pixel[0] == colors->bg;
+#endif // VC_TERM_TRUECOLOR
+}
+
+// The color escapes are only emitted when the colors differ from the previous character, so runs of the
+// same colors cost just the characters themselves.
+static void vc_term_put_char(Vc_Term_Colors *colors, size_t x, size_t y)
+{
+    // TODO: explore the idea of figuring out aspect ratio of the character using escape ANSI codes of the terminal and rendering the image accordingly
+    const int *pixel = &vc_term_pixels[y*VC_TERM_CHAR_PIXELS*vc_term_scaled_down_width + x];
+#ifdef VC_TERM_TRUECOLOR
+    int top = pixel[0], bottom = pixel[vc_term_scaled_down_width];
+    vc_term_set_bg(colors, bottom);
+    if (top == bottom) {
+        vc_term_printf(" ");
+    } else {
+        vc_term_set_fg(colors, top);
+        vc_term_printf("\xE2\x96\x80"); // U+2580 Upper Half Block
+    }
+#else
+    vc_term_set_bg(colors, pixel[0]);
+    vc_term_printf("  ");
+#endif // VC_TERM_TRUECOLOR
+}
+
+static bool vc_term_char_changed(size_t x, size_t y)
+{
+    for (size_t j = 0; j < VC_TERM_CHAR_PIXELS; ++j) {
+        size_t i = (y*VC_TERM_CHAR_PIXELS + j)*vc_term_scaled_down_width + x;
+        if (vc_term_pixels[i] != vc_term_prev_pixels[i]) return true;
+    }
+    return false;
+}
+
+// Moves the cursor from the character cx, cy to x, y. A short jump forward over characters that print without
+// changing the colors is cheaper to just print them again than to do with an escape sequence.
+static void vc_term_move(size_t *cx, size_t *cy, Vc_Term_Colors *colors, size_t x, size_t y)
+{
+    if (*cy == y && *cx < x && (x - *cx)*VC_TERM_CHAR_COLUMNS <= 4) {
+        bool cheap = true;
+        for (size_t i = *cx; i < x && cheap; ++i) cheap = vc_term_char_free(colors, i, y);
+        if (cheap) {
+            for (; *cx < x; ++*cx) vc_term_put_char(colors, *cx, y);
+            return;
+        }
+    }
+    if (y > *cy) vc_term_printf("\033[%zuB", y - *cy);
+    if (y < *cy) vc_term_printf("\033[%zuA", *cy - y);
+    if (x == 0 && *cx != 0) vc_term_printf("\r");
+    else if (x > *cx) vc_term_printf("\033[%zuC", VC_TERM_CHAR_COLUMNS*(x - *cx));
+    else if (x < *cx) vc_term_printf("\033[%zuD", VC_TERM_CHAR_COLUMNS*(*cx - x));
+    *cx = x;
+    *cy = y;
+}
+
+// Prints the characters that differ from what the terminal shows and leaves the cursor at the top left
+// of the frame, where the next one starts.
+static void vc_term_print(void)
+{
+    size_t width = vc_term_scaled_down_width;
+    size_t height = vc_term_scaled_down_height/VC_TERM_CHAR_PIXELS;
+    Vc_Term_Colors colors = {-1, -1};
+    if (!vc_term_printed) {
+        // Nothing to compare with, so every row is printed which also makes room for the frame in the terminal
+        for (size_t y = 0; y < height; ++y) {
+            for (size_t x = 0; x < width; ++x) vc_term_put_char(&colors, x, y);
+            vc_term_printf("\033[0m\n");
+            colors = (Vc_Term_Colors) {-1, -1};
+        }
+        if (height > 0) vc_term_printf("\033[%zuA", height);
+        vc_term_printed = true;
+    } else {
+        size_t cx = 0, cy = 0;
+        for (size_t y = 0; y < height; ++y) {
+            for (size_t x = 0; x < width; ++x) {
+                if (!vc_term_char_changed(x, y)) continue;
+                vc_term_move(&cx, &cy, &colors, x, y);
+                vc_term_put_char(&colors, x, y);
+                cx += 1;
             }
-            printf("\033[0m\n");
         }
+        if (colors.fg >= 0 || colors.bg >= 0) vc_term_printf("\033[0m");
+        if (cy > 0) vc_term_printf("\033[%zuA", cy);
+        if (cx > 0) vc_term_printf("\r");
+    }
+    memcpy(vc_term_prev_pixels, vc_term_pixels, sizeof(*vc_term_pixels)*vc_term_scaled_down_width*vc_term_scaled_down_height);
+    vc_term_flush();
+}
 
+int main(void)
+{
+#ifndef VC_TERM_TRUECOLOR
+    vc_term_build_lut();
+#endif // VC_TERM_TRUECOLOR
+    for (;;) {
+        vc_term_compress_pixels(vc_render(1.f/60.f));
+        vc_term_print();
         usleep(1000*1000/60);
-        printf("\033[%zuA", vc_term_scaled_down_height);
-        printf("\033[%zuD", vc_term_scaled_down_width);
     }
     return 0;
 }
 #elif VC_PLATFORM == VC_WASM_PLATFORM
-// Do nothing because all the work is done in ../js/vc.js
+// All the work is done in ../js/vc.js, which copies the canvas into an ImageData anyway
+Olivec_Canvas vc_canvas(uint32_t *pixels, size_t width, size_t height)
+{
+    return olivec_canvas(pixels, width, height, width);
+}
 #else
 #error "Unknown VC platform"
 #endif // VC_SDL_PLATFORM
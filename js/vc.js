@@ -26,6 +26,7 @@ const CANVAS_PIXELS = iota++;
 const CANVAS_WIDTH  = iota++;
 const CANVAS_HEIGHT = iota++;
 const CANVAS_STRIDE = iota++;
+const CANVAS_DAMAGE = iota++;
 const CANVAS_SIZE   = iota++;
 
 function readCanvasFromMemory(memory_buffer, canvas_ptr)
@@ -36,6 +37,37 @@ function readCanvasFromMemory(memory_buffer, canvas_ptr)
         width: canvas_memory[CANVAS_WIDTH],
         height: canvas_memory[CANVAS_HEIGHT],
         stride: canvas_memory[CANVAS_STRIDE],
+        damage: canvas_memory[CANVAS_DAMAGE],
+    };
+}
+
+iota = 0;
+const DAMAGE_PIXELS = iota++;
+const DAMAGE_WIDTH  = iota++;
+const DAMAGE_HEIGHT = iota++;
+const DAMAGE_STRIDE = iota++;
+const DAMAGE_COUNT  = iota++;
+const DAMAGE_RECTS  = iota++;
+const DAMAGE_RECT_SIZE = 4;
+
+// Olivec_Damage the canvas came with if it tracks the whole canvas, null otherwise
+function readDamageFromMemory(memory_buffer, canvas)
+{
+    if (canvas.damage === 0) return null;
+    const damage_memory = new Uint32Array(memory_buffer, canvas.damage, DAMAGE_RECTS);
+    if (damage_memory[DAMAGE_PIXELS] !== canvas.pixels ||
+        damage_memory[DAMAGE_WIDTH] !== canvas.width ||
+        damage_memory[DAMAGE_HEIGHT] !== canvas.height) return null;
+    const count = damage_memory[DAMAGE_COUNT];
+    const rects_memory = new Int32Array(memory_buffer, canvas.damage + DAMAGE_RECTS*4, count*DAMAGE_RECT_SIZE);
+    const rects = [];
+    for (let i = 0; i < count; ++i) {
+        const [x, y, w, h] = rects_memory.subarray(i*DAMAGE_RECT_SIZE, (i + 1)*DAMAGE_RECT_SIZE);
+        rects.push({x, y, w, h});
+    }
+    return {
+        rects,
+        clear: () => damage_memory[DAMAGE_COUNT] = 0,
     };
 }
 
@@ -63,9 +95,12 @@ async function startDemo(elementId, wasmPath) {
     // TODO: if __heap_base not found tell the user to compile their wasm module with -Wl,--export=__heap_base
     const heap_base = w.instance.exports.__heap_base.value;
 
+    // The HTML canvas holds the previous frame, which was tracking its damage
+    let damaged = false;
     function render(dt) {
-        const buffer = w.instance.exports.memory.buffer;
         w.instance.exports.vc_render(heap_base, dt*0.001);
+        // vc_render() may grow the memory, which detaches the old buffer
+        const buffer = w.instance.exports.memory.buffer;
         const canvas = readCanvasFromMemory(buffer, heap_base);
         if (canvas.width != canvas.stride) {
             // TODO: maybe we can preallocate a Uint8ClampedArray on JavaScript side and just copy the canvas data there to bring width and stride to the same value?
@@ -73,9 +108,20 @@ async function startDemo(elementId, wasmPath) {
             return;
         }
         const image = new ImageData(new Uint8ClampedArray(buffer, canvas.pixels, canvas.width*canvas.height*4), canvas.width);
-        app.width = canvas.width;
-        app.height = canvas.height;
-        ctx.putImageData(image, 0, 0);
+        // Resizing the HTML canvas clears it, so it is only done when the size actually changes
+        if (app.width !== canvas.width || app.height !== canvas.height) {
+            app.width = canvas.width;
+            app.height = canvas.height;
+            damaged = false;
+        }
+        const damage = readDamageFromMemory(buffer, canvas);
+        if (damage !== null && damaged) {
+            for (const r of damage.rects) ctx.putImageData(image, 0, 0, r.x, r.y, r.w, r.h);
+        } else {
+            ctx.putImageData(image, 0, 0);
+        }
+        damaged = damage !== null;
+        if (damage !== null) damage.clear();
     }
 
     let prev = null;
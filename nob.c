@@ -13,7 +13,7 @@ bool build_tools(Cmd *cmd)
     cmd_append(cmd, "clang", COMMON_CFLAGS, "-o", "./build/tools/png2c", "./tools/png2c.c", "-lm");
     if (!cmd_run_sync_and_reset(cmd)) return false;
 
-    cmd_append(cmd, "clang", COMMON_CFLAGS, "-o", "./build/tools/obj2c", "./tools/obj2c.c", "-lm");
+    cmd_append(cmd, "clang", COMMON_CFLAGS, "-o", "./build/tools/obj2c", "./tools/obj2c.c", "-lm", "-lpthread");
     if (!cmd_run_sync_and_reset(cmd)) return false;
 
     return true;
@@ -36,13 +36,13 @@ bool build_assets(Cmd *cmd)
     cmd_append(cmd, "./build/tools/png2c", "-n", "lavastone", "-o", "./build/assets/lavastone.c", "./assets/lavastone.png");
     if (!cmd_run_sync_and_reset(cmd)) return false;
 
-    cmd_append(cmd, "./build/tools/obj2c", "-o", "./build/assets/tsodinCupLowPoly.c", "./assets/tsodinCupLowPoly.obj");
+    cmd_append(cmd, "./build/tools/obj2c", "-r", "-l", "4", "-o", "./build/assets/tsodinCupLowPoly.c", "-b", "./build/assets/tsodinCupLowPoly.olvm", "./assets/tsodinCupLowPoly.obj");
     if (!cmd_run_sync_and_reset(cmd)) return false;
 
-    cmd_append(cmd, "./build/tools/obj2c", "-s", "0.40", "-o", "./build/assets/utahTeapot.c", "./assets/utahTeapot.obj");
+    cmd_append(cmd, "./build/tools/obj2c", "-r", "-l", "4", "-s", "0.40", "-o", "./build/assets/utahTeapot.c", "-b", "./build/assets/utahTeapot.olvm", "./assets/utahTeapot.obj");
     if (!cmd_run_sync_and_reset(cmd)) return false;
 
-    cmd_append(cmd, "./build/tools/obj2c", "-s", "1.5", "-o", "./build/assets/penger.c", "./assets/penger_obj/penger.obj");
+    cmd_append(cmd, "./build/tools/obj2c", "-r", "-l", "4", "-s", "1.5", "-o", "./build/assets/penger.c", "-b", "./build/assets/penger.olvm", "./assets/penger_obj/penger.obj");
     if (!cmd_run_sync_and_reset(cmd)) return false;
 
     return true;
@@ -50,7 +50,15 @@ bool build_assets(Cmd *cmd)
 
 bool build_tests(Cmd *cmd)
 {
-    cmd_append(cmd, "clang", COMMON_CFLAGS, "-fsanitize=memory", "-o", "./build/test", "test.c", "-lm");
+    cmd_append(cmd, "clang", COMMON_CFLAGS, "-fsanitize=memory", "-o", "./build/test", "test.c", "-lm", "-lpthread");
+    if (!cmd_run_sync_and_reset(cmd)) return false;
+    return true;
+}
+
+bool build_bench(Cmd *cmd)
+{
+    if (!mkdir_if_not_exists("build")) return false;
+    cmd_append(cmd, "clang", COMMON_CFLAGS, "-O3", "-o", "./build/bench", "bench.c", "-lm", "-lpthread");
     if (!cmd_run_sync_and_reset(cmd)) return false;
     return true;
 }
@@ -127,6 +135,10 @@ void usage(const char *program)
     nob_log(INFO, "    test[s] [<args>]");
     nob_log(INFO, "        Build and run test.c");
     nob_log(INFO, "        If <args> are provided the test utility is run with them.");
+    nob_log(INFO, "    bench [<args>]");
+    nob_log(INFO, "        Build and run bench.c");
+    nob_log(INFO, "        If <args> are provided the benchmark utility is run with them.");
+    nob_log(INFO, "        Otherwise all the benchmarks are run.");
     nob_log(INFO, "    demos [<platform>] [run]");
     nob_log(INFO, "        Build demos.");
     nob_log(INFO, "        Available platforms are: sdl, term, or wasm.");
@@ -158,6 +170,15 @@ int main(int argc, char **argv)
                 da_append_many(&cmd, argv, argc);
                 if (!cmd_run_sync_and_reset(&cmd)) return 1;
             }
+        } else if (strcmp(subcmd, "bench") == 0) {
+            if (!build_bench(&cmd)) return 1;
+            cmd_append(&cmd, "./build/bench");
+            if (argc > 0) {
+                da_append_many(&cmd, argv, argc);
+            } else {
+                cmd_append(&cmd, "run");
+            }
+            if (!cmd_run_sync_and_reset(&cmd)) return 1;
         } else if (strcmp(subcmd, "demos") == 0) {
             if (argc <= 0) {
                 if (!build_all_vc_demos(&cmd, &procs)) return 1;
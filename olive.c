@@ -34,6 +34,10 @@
 #define OLIVEC_AA_RES 2
 #endif
 
+// Define OLIVEC_SIMD to let the span functions (olivec_blend_span() and friends) use SIMD intrinsics.
+// The instruction set is picked based on what the compiler targets: AVX2 (-mavx2), SSE2 (x86_64) or
+// NEON (AArch64, -mfpu=neon). Without OLIVEC_SIMD everything is plain portable C.
+
 #define OLIVEC_SWAP(T, a, b) do { T t = a; a = b; b = t; } while (0)
 #define OLIVEC_SIGN(T, x) ((T)((x) > 0) - (T)((x) < 0))
 #define OLIVEC_ABS(T, x) (OLIVEC_SIGN(T, x)*(x))
@@ -398,6 +402,61 @@ static Olivec_Font olivec_default_font = {
     .height = OLIVEC_DEFAULT_FONT_HEIGHT,
 };
 
+typedef struct {
+    int x1, y1;
+    int x2, y2;
+} Olivec_Segment;
+
+typedef struct {
+    float x, y;
+} Olivec_Point;
+
+typedef enum {
+    OLIVEC_CAP_BUTT = 0,
+    OLIVEC_CAP_SQUARE,
+    OLIVEC_CAP_ROUND,
+} Olivec_Cap;
+
+typedef enum {
+    OLIVEC_JOIN_ROUND = 0,
+    OLIVEC_JOIN_BEVEL,
+    OLIVEC_JOIN_MITER,
+} Olivec_Join;
+
+// Miter joins longer than OLIVEC_MITER_LIMIT times the thickness fall back to bevel (same as SVG's default)
+#ifndef OLIVEC_MITER_LIMIT
+#define OLIVEC_MITER_LIMIT 4.0f
+#endif
+
+typedef struct {
+    float thickness;
+    Olivec_Cap cap;
+    Olivec_Join join;
+} Olivec_Stroke;
+
+// Damage tracking. Every primitive drawing onto a canvas with a tracker attached by olivec_damage_track()
+// reports the pixels it may have touched to it, so whoever shows the canvas can copy only those. The tracker
+// stays attached to the subcanvases and keeps the rectangles in the coordinates of the tracked canvas.
+#ifndef OLIVEC_DAMAGE_RECTS
+#define OLIVEC_DAMAGE_RECTS 8
+#endif
+
+typedef struct {
+    int x, y, w, h;
+} Olivec_Damage_Rect;
+
+typedef struct {
+    // The tracked canvas
+    uint32_t *pixels;
+    size_t width;
+    size_t height;
+    size_t stride;
+
+    // Damaged rectangles since the last olivec_damage_clear(). They may overlap but never leave the canvas.
+    size_t count;
+    Olivec_Damage_Rect rects[OLIVEC_DAMAGE_RECTS];
+} Olivec_Damage;
+
 // WARNING! Always initialize your Canvas with a color that has Non-Zero Alpha Channel!
 // A lot of functions use `olivec_blend_color()` function to blend with the Background
 // which preserves the original Alpha of the Background. So you may easily end up with
@@ -407,22 +466,40 @@ typedef struct {
     size_t width;
     size_t height;
     size_t stride;
+    Olivec_Damage *damage;
 } Olivec_Canvas;
 
 #define OLIVEC_CANVAS_NULL ((Olivec_Canvas) {0})
 #define OLIVEC_PIXEL(oc, x, y) (oc).pixels[(y)*(oc).stride + (x)]
 
 OLIVECDEF Olivec_Canvas olivec_canvas(uint32_t *pixels, size_t width, size_t height, size_t stride);
+// Canvas over memory whose rows are pitch bytes apart, like a locked SDL texture. Pixels are accessed as
+// uint32_t, so a pitch that is not a multiple of 4 bytes gives OLIVEC_CANVAS_NULL.
+OLIVECDEF Olivec_Canvas olivec_canvas_pitch(void *pixels, size_t width, size_t height, size_t pitch);
 OLIVECDEF Olivec_Canvas olivec_subcanvas(Olivec_Canvas oc, int x, int y, int w, int h);
+// Resets the tracker to the canvas and returns the canvas with the tracker attached
+OLIVECDEF Olivec_Canvas olivec_damage_track(Olivec_Canvas oc, Olivec_Damage *damage);
+OLIVECDEF void olivec_damage_clear(Olivec_Damage *damage);
+// Marks the rectangle of the canvas as damaged, the way olivec_rect() would fill it. Does nothing without a tracker.
+OLIVECDEF void olivec_damage(Olivec_Canvas oc, int x, int y, int w, int h);
 OLIVECDEF bool olivec_in_bounds(Olivec_Canvas oc, int x, int y);
 OLIVECDEF void olivec_blend_color(uint32_t *c1, uint32_t c2);
+OLIVECDEF void olivec_fill_span(uint32_t *dst, size_t n, uint32_t color);
+OLIVECDEF void olivec_opaque_span(uint32_t *dst, size_t n, uint32_t color);
+OLIVECDEF void olivec_blend_span(uint32_t *dst, size_t n, uint32_t color);
+OLIVECDEF void olivec_blend_span_pixels(uint32_t *dst, const uint32_t *src, size_t n);
 OLIVECDEF void olivec_fill(Olivec_Canvas oc, uint32_t color);
 OLIVECDEF void olivec_rect(Olivec_Canvas oc, int x, int y, int w, int h, uint32_t color);
 OLIVECDEF void olivec_frame(Olivec_Canvas oc, int x, int y, int w, int h, size_t thiccness, uint32_t color);
 OLIVECDEF void olivec_circle(Olivec_Canvas oc, int cx, int cy, int r, uint32_t color);
 OLIVECDEF void olivec_ellipse(Olivec_Canvas oc, int cx, int cy, int rx, int ry, uint32_t color);
-// TODO: lines with different thiccness
 OLIVECDEF void olivec_line(Olivec_Canvas oc, int x1, int y1, int x2, int y2, uint32_t color);
+OLIVECDEF void olivec_lines(Olivec_Canvas oc, const Olivec_Segment *segments, size_t count, uint32_t color);
+// Anti-aliased lines with sub-pixel coordinates. Pixel (x, y) covers the area from (x, y) to (x + 1, y + 1).
+OLIVECDEF void olivec_line_aa(Olivec_Canvas oc, float x1, float y1, float x2, float y2, Olivec_Stroke stroke, uint32_t color);
+// The whole path is blended as one shape, so the joints and the places where the path crosses itself
+// or comes back to the same pixels are not blended twice.
+OLIVECDEF void olivec_polyline_aa(Olivec_Canvas oc, const Olivec_Point *points, size_t count, Olivec_Stroke stroke, uint32_t color);
 OLIVECDEF bool olivec_normalize_triangle(size_t width, size_t height, int x1, int y1, int x2, int y2, int x3, int y3, int *lx, int *hx, int *ly, int *hy);
 OLIVECDEF bool olivec_barycentric(int x1, int y1, int x2, int y2, int x3, int y3, int xp, int yp, int *u1, int *u2, int *det);
 OLIVECDEF void olivec_triangle(Olivec_Canvas oc, int x1, int y1, int x2, int y2, int x3, int y3, uint32_t color);
@@ -430,11 +507,15 @@ OLIVECDEF void olivec_triangle3c(Olivec_Canvas oc, int x1, int y1, int x2, int y
 OLIVECDEF void olivec_triangle3z(Olivec_Canvas oc, int x1, int y1, int x2, int y2, int x3, int y3, float z1, float z2, float z3);
 OLIVECDEF void olivec_triangle3uv(Olivec_Canvas oc, int x1, int y1, int x2, int y2, int x3, int y3, float tx1, float ty1, float tx2, float ty2, float tx3, float ty3, float z1, float z2, float z3, Olivec_Canvas texture);
 OLIVECDEF void olivec_triangle3uv_bilinear(Olivec_Canvas oc, int x1, int y1, int x2, int y2, int x3, int y3, float tx1, float ty1, float tx2, float ty2, float tx3, float ty3, float z1, float z2, float z3, Olivec_Canvas texture);
+// Anti-aliased triangles with sub-pixel coordinates. Pixel (x, y) covers the area from (x, y) to (x + 1, y + 1).
+OLIVECDEF void olivec_triangle_aa(Olivec_Canvas oc, float x1, float y1, float x2, float y2, float x3, float y3, uint32_t color);
+OLIVECDEF void olivec_triangle3c_aa(Olivec_Canvas oc, float x1, float y1, float x2, float y2, float x3, float y3, uint32_t c1, uint32_t c2, uint32_t c3);
 OLIVECDEF void olivec_text(Olivec_Canvas oc, const char *text, int x, int y, Olivec_Font font, size_t size, uint32_t color);
 OLIVECDEF void olivec_sprite_blend(Olivec_Canvas oc, int x, int y, int w, int h, Olivec_Canvas sprite);
 OLIVECDEF void olivec_sprite_copy(Olivec_Canvas oc, int x, int y, int w, int h, Olivec_Canvas sprite);
 OLIVECDEF void olivec_sprite_copy_bilinear(Olivec_Canvas oc, int x, int y, int w, int h, Olivec_Canvas sprite);
 OLIVECDEF uint32_t olivec_pixel_bilinear(Olivec_Canvas sprite, int nx, int ny, int w, int h);
+OLIVECDEF uint32_t olivec_sample_bilinear(Olivec_Canvas sprite, int64_t u, int64_t v);
 
 typedef struct {
     // Safe ranges to iterate over.
@@ -462,10 +543,355 @@ OLIVECDEF bool olivec_normalize_rect(int x, int y, int w, int h,
                                      size_t canvas_width, size_t canvas_height,
                                      Olivec_Normalized_Rect *nr);
 
+typedef struct {
+    // Bounding box of the triangle clipped to the canvas.
+    int lx, hx;
+    int ly, hy;
+
+    // Edge functions u1 and u2 of olivec_barycentric() at (lx, ly) and how they change per pixel and per row.
+    // u3 is implied as det - u1 - u2.
+    int64_t u1, u2;
+    int du1_dx, du1_dy;
+    int du2_dx, du2_dy;
+    int det;
+} Olivec_Triangle_Raster;
+
+// Incremental replacement for calling olivec_barycentric() on every pixel of the bounding box.
+// For every row it finds the exact span of pixels that olivec_barycentric() would accept together
+// with u1 and u2 at the beginning of the span. Stepping x by one adds du1_dx and du2_dx to them.
+//
+// Olivec_Triangle_Raster tr = {0};
+// if (olivec_triangle_raster(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &tr)) {
+//     for (int y = tr.ly; y <= tr.hy; ++y) {
+//         int lx, hx, u1, u2;
+//         if (!olivec_triangle_raster_span(&tr, y, &lx, &hx, &u1, &u2)) continue;
+//         for (int x = lx; x <= hx; ++x, u1 += tr.du1_dx, u2 += tr.du2_dx) {
+//             // u1, u2, tr.det are the same as olivec_barycentric() would produce for (x, y)
+//         }
+//     }
+// }
+OLIVECDEF bool olivec_triangle_raster(size_t width, size_t height, int x1, int y1, int x2, int y2, int x3, int y3, Olivec_Triangle_Raster *tr);
+OLIVECDEF bool olivec_triangle_raster_span(const Olivec_Triangle_Raster *tr, int y, int *lx, int *hx, int *u1, int *u2);
+
+#ifndef OLIVEC_MAX_VARYINGS
+#define OLIVEC_MAX_VARYINGS 16
+#endif
+
+// Per-vertex attributes interpolated across a triangle as planes: the value at the pixel with the
+// edge functions u1, u2 of Olivec_Triangle_Raster is v3 + d1*u1 + d2*u2, and stepping x by one adds dx.
+// The gradients are computed once per triangle, so walking a span costs one addition per varying.
+typedef struct {
+    size_t count;
+    float v3[OLIVEC_MAX_VARYINGS];
+    float d1[OLIVEC_MAX_VARYINGS];
+    float d2[OLIVEC_MAX_VARYINGS];
+    float dx[OLIVEC_MAX_VARYINGS];
+} Olivec_Varyings;
+
+// Returns false for the triangles with zero area that have no gradients. Only the first
+// OLIVEC_MAX_VARYINGS varyings are taken.
+OLIVECDEF bool olivec_varyings(const Olivec_Triangle_Raster *tr, const float *v1, const float *v2, const float *v3, size_t count, Olivec_Varyings *vs);
+// Values of the varyings at the beginning of the span returned by olivec_triangle_raster_span()
+OLIVECDEF void olivec_varyings_span(const Olivec_Varyings *vs, int u1, int u2, float *v);
+
+// Called for every pixel of olivec_triangle_varyings() with the interpolated varyings. Returns false to
+// leave the pixel alone, otherwise *color is written into it.
+typedef bool (*Olivec_Shader)(void *data, int x, int y, const float *varyings, uint32_t *color);
+
+// Triangle with count arbitrary varyings per vertex (texture coordinates, normals, colors...) that are
+// interpolated for the shader. With perspective set varyings[0] is 1/z of the vertex and the rest of
+// them are premultiplied by it, like the texture coordinates of olivec_triangle3uv(). The shader then
+// gets them divided back by the interpolated 1/z, which costs one reciprocal per pixel, and 1/z itself
+// as varyings[0].
+OLIVECDEF void olivec_triangle_varyings(Olivec_Canvas oc, int x1, int y1, int x2, int y2, int x3, int y3,
+                                        const float *v1, const float *v2, const float *v3, size_t count,
+                                        bool perspective, Olivec_Shader shader, void *data);
+
+// Depth buffer companion of a canvas of the same size. A pixel passes the depth test when comparing its
+// depth with the stored one by func is true, and then its depth replaces the stored one. The depth is
+// whatever the triangles interpolate. olivec_triangle3z() and the 3D demos use 1/z, where closer pixels
+// have greater values, so OLIVEC_DEPTH_GREATER is the default and the buffer is cleared to 0.
+typedef enum {
+    OLIVEC_DEPTH_GREATER = 0,
+    OLIVEC_DEPTH_GEQUAL,
+    OLIVEC_DEPTH_LESS,
+    OLIVEC_DEPTH_LEQUAL,
+    OLIVEC_DEPTH_ALWAYS,
+} Olivec_Depth_Func;
+
+#ifndef OLIVEC_DEPTH_TILE
+#define OLIVEC_DEPTH_TILE 8
+#endif
+
+#define OLIVEC_DEPTH_TILES(width, height) ((((width) + OLIVEC_DEPTH_TILE - 1)/OLIVEC_DEPTH_TILE)*(((height) + OLIVEC_DEPTH_TILE - 1)/OLIVEC_DEPTH_TILE))
+
+// Bounds of the depths stored within a OLIVEC_DEPTH_TILExOLIVEC_DEPTH_TILE tile of the depth buffer.
+// They are always conservative. A triangle that covers the whole tile replaces them, any other write
+// only widens them and marks the tile stale. Stale tiles are rescanned when a triangle would have to
+// test their pixels one by one otherwise.
+typedef struct {
+    float min, max;
+    bool stale;
+} Olivec_Depth_Tile;
+
+// Depths are stored either as floats or, to halve the memory and bandwidth, as 16-bit integers covering
+// 0..1 in steps of 1/65535. Depths tested against a 16-bit buffer are clamped to 0..1 and rounded first.
+// Exactly one of values and values16 is not NULL.
+//
+// With the tiles attached by olivec_depth_buffer_tiles() the depth tested triangles skip the parts of
+// their spans where even their nearest depth can't pass against the bounds of the tile, without
+// testing them pixel by pixel.
+typedef struct {
+    float *values;
+    uint16_t *values16;
+    size_t width;
+    size_t height;
+    size_t stride;
+    Olivec_Depth_Func func;
+    Olivec_Depth_Tile *tiles;
+} Olivec_Depth_Buffer;
+
+OLIVECDEF Olivec_Depth_Buffer olivec_depth_buffer(float *values, size_t width, size_t height, size_t stride);
+OLIVECDEF Olivec_Depth_Buffer olivec_depth_buffer16(uint16_t *values, size_t width, size_t height, size_t stride);
+// Attaches OLIVEC_DEPTH_TILES(db.width, db.height) tiles to the depth buffer. They all start stale, so
+// the stored depths may be anything at this point.
+OLIVECDEF Olivec_Depth_Buffer olivec_depth_buffer_tiles(Olivec_Depth_Buffer db, Olivec_Depth_Tile *tiles);
+OLIVECDEF void olivec_depth_clear(Olivec_Depth_Buffer db, float depth);
+// Tests the depth of the pixel x, y and stores it if the test passes. Doesn't check the bounds.
+OLIVECDEF bool olivec_depth_test(Olivec_Depth_Buffer db, int x, int y, float depth);
+
+// Depth tested triangles. Depth z1, z2, z3 of the vertices is interpolated linearly across the screen.
+// The color of a pixel is only computed after it passes the depth test.
+OLIVECDEF void olivec_triangle_depth(Olivec_Canvas oc, Olivec_Depth_Buffer db, int x1, int y1, int x2, int y2, int x3, int y3, float z1, float z2, float z3, uint32_t color);
+OLIVECDEF void olivec_triangle3c_depth(Olivec_Canvas oc, Olivec_Depth_Buffer db, int x1, int y1, int x2, int y2, int x3, int y3, float z1, float z2, float z3, uint32_t c1, uint32_t c2, uint32_t c3);
+// olivec_triangle_varyings() that tests varyings[0] (1/z with perspective set) as the depth. The shader
+// only runs for the pixels that pass and the depth is stored only if it doesn't discard the pixel.
+OLIVECDEF void olivec_triangle_varyings_depth(Olivec_Canvas oc, Olivec_Depth_Buffer db, int x1, int y1, int x2, int y2, int x3, int y3,
+                                              const float *v1, const float *v2, const float *v3, size_t count,
+                                              bool perspective, Olivec_Shader shader, void *data);
+
+// 4x4 matrix applied to column vectors, m[row][column]
+typedef struct {
+    float m[4][4];
+} Olivec_Mat4;
+
+OLIVECDEF Olivec_Mat4 olivec_mat4_identity(void);
+// a*b, applies b first and then a
+OLIVECDEF Olivec_Mat4 olivec_mat4_mul(Olivec_Mat4 a, Olivec_Mat4 b);
+OLIVECDEF Olivec_Mat4 olivec_mat4_translate(float x, float y, float z);
+OLIVECDEF Olivec_Mat4 olivec_mat4_scale(float x, float y, float z);
+// olive.c doesn't depend on libm, so the rotations take the cosine and the sine of the angle
+OLIVECDEF Olivec_Mat4 olivec_mat4_rotate_x(float c, float s);
+OLIVECDEF Olivec_Mat4 olivec_mat4_rotate_y(float c, float s);
+OLIVECDEF Olivec_Mat4 olivec_mat4_rotate_z(float c, float s);
+// Projection for a right-handed camera at the origin looking along -z with y going up: the screen
+// coordinates become x*fx/-z, y*fy/-z and w becomes -z
+OLIVECDEF Olivec_Mat4 olivec_mat4_perspective(float fx, float fy);
+
+// Indexed triangle mesh. positions and attributes point into the vertex buffer, where each vertex takes
+// stride floats. attribute_count attributes of each vertex (colors, normals, texture coordinates...) are
+// interpolated for the shader, attributes may be NULL. Each triangle takes indices_stride elements of the
+// index buffer and its vertices are the first three of them, so the faces[][9] of tools/obj2c can be
+// used as they are, with indices_stride 9. The index buffer is either indices or, for meshes of up to
+// 65536 vertices, indices16.
+typedef struct {
+    const float *positions;
+    const float *attributes;
+    size_t attribute_count;
+    size_t stride;
+    size_t vertex_count;
+    const int *indices;
+    const uint16_t *indices16;
+    size_t indices_stride;
+    size_t triangle_count;
+} Olivec_Mesh;
+
+typedef enum {
+    OLIVEC_CULL_NONE = 0,
+    // Culls the triangles that are clockwise on the screen (with y going up), which are the back faces
+    // of the meshes in the usual counter-clockwise winding
+    OLIVEC_CULL_BACK,
+    OLIVEC_CULL_FRONT,
+} Olivec_Cull;
+
+// Floats of the scratch buffer of olivec_mesh(): the transformed vertices in SoA layout
+#define OLIVEC_MESH_SCRATCH(vertex_count) ((vertex_count)*6)
+
+// Pixels that the screen coordinates of the clipped triangles may go beyond the edges of the canvas,
+// which keeps them small enough for the integer rasterizer
+#ifndef OLIVEC_MESH_GUARD_BAND
+#define OLIVEC_MESH_GUARD_BAND 4096
+#endif
+
+// Draws a mesh with the depth test. Every vertex is transformed by the matrix into clip space once and
+// lands at ((x/w + 1)/2*width, (1 - y/w)/2*height) on the screen. The triangles are clipped by the near
+// plane w = near, culled by their winding on the screen and drawn by olivec_triangle_varyings_depth()
+// with perspective correction. The shader gets 1/w, which is also the depth, the barycentric
+// coordinates of the first two vertices of the triangle, and the attributes:
+//
+//   varyings[0] = 1/w, varyings[1] = b1, varyings[2] = b2, varyings[3 + i] = attribute i
+//
+// The scratch buffer takes OLIVEC_MESH_SCRATCH(mesh->vertex_count) floats. At most
+// OLIVEC_MAX_VARYINGS - 3 attributes are taken.
+OLIVECDEF void olivec_mesh(Olivec_Canvas oc, Olivec_Depth_Buffer db, const Olivec_Mesh *mesh, Olivec_Mat4 transform,
+                           float near, Olivec_Cull cull, float *scratch, Olivec_Shader shader, void *data);
+
+// Picks the level of detail to draw a mesh with: the coarsest one whose error, projected onto the canvas at the
+// distance of the origin of the model, stays within max_error pixels. errors[i] is how far level i strays from
+// the full one in model units, growing with i (see mesh_lod_errors generated by obj2c -l).
+OLIVECDEF size_t olivec_mesh_lod(Olivec_Canvas oc, Olivec_Mat4 transform, const float *errors, size_t count, float max_error);
+
+// Binary mesh file written by tools/obj2c -b. Everything in it is little-endian and 4-byte aligned, so the
+// renderer uses a file loaded or mapped into memory as is. Each vertex takes stride floats: the position,
+// then the normal with OLIVEC_MESH_FILE_NORMALS and the texture coordinates with OLIVEC_MESH_FILE_TEXCOORDS.
+// Each triangle takes 3 indices, 16-bit with OLIVEC_MESH_FILE_INDICES16 and 32-bit otherwise.
+#define OLIVEC_MESH_FILE_MAGIC 0x4D564C4F // "OLVM"
+#define OLIVEC_MESH_FILE_VERSION 1
+
+typedef enum {
+    OLIVEC_MESH_FILE_NORMALS   = 1<<0,
+    OLIVEC_MESH_FILE_TEXCOORDS = 1<<1,
+    OLIVEC_MESH_FILE_INDICES16 = 1<<2,
+} Olivec_Mesh_File_Flags;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t flags;
+    uint32_t stride;
+    uint32_t vertex_count;
+    uint32_t triangle_count;
+    // Bytes from the beginning of the file
+    uint32_t vertices_offset;
+    uint32_t indices_offset;
+} Olivec_Mesh_File_Header;
+
+// Checks the mesh file in memory and points the mesh into it without copying anything. The attributes
+// of the mesh are whatever follows the position: the normal and the texture coordinates. Returns false
+// if the file is malformed or any index is out of bounds.
+OLIVECDEF bool olivec_mesh_from_memory(const void *data, size_t size, Olivec_Mesh *mesh);
+
+// Define OLIVEC_TILED to get the tiled renderer. Instead of drawing immediately the olivec_tiled_*()
+// functions record the primitives into a command buffer. olivec_tiled_flush() then sorts the commands
+// into screen tiles and draws the tiles in parallel on a pool of pthreads, every tile through its own
+// olivec_subcanvas(). Within a tile the commands are replayed in the order they were recorded, so the
+// result is exactly the same as calling the immediate functions one after another.
+//
+// Unlike the rest of olive.c this part is not freestanding: it needs pthreads and malloc. Sprites and
+// fonts are referenced, not copied, so they must stay alive until olivec_tiled_flush() returns.
+//
+// Olivec_Tiled tiled = {0};
+// olivec_tiled_init(&tiled, 64, 4);
+// olivec_tiled_begin(&tiled, oc);
+// olivec_tiled_fill(&tiled, 0xFF181818);
+// olivec_tiled_circle(&tiled, 100, 100, 50, 0xFF2020FF);
+// olivec_tiled_flush(&tiled);
+// ...
+// olivec_tiled_free(&tiled);
+#ifdef OLIVEC_TILED
+#include <pthread.h>
+
+typedef enum {
+    OLIVEC_COMMAND_FILL = 0,
+    OLIVEC_COMMAND_RECT,
+    OLIVEC_COMMAND_CIRCLE,
+    OLIVEC_COMMAND_TRIANGLE,
+    OLIVEC_COMMAND_SPRITE_BLEND,
+    OLIVEC_COMMAND_SPRITE_COPY,
+    OLIVEC_COMMAND_TEXT,
+} Olivec_Command_Kind;
+
+typedef struct {
+    Olivec_Command_Kind kind;
+    // Pixels of the canvas the command may touch. Used only for binning.
+    int lx, hx;
+    int ly, hy;
+
+    int x1, y1, x2, y2, x3, y3;
+    int w, h;
+    uint32_t color;
+    Olivec_Canvas sprite;
+    Olivec_Font font;
+    size_t text;        // offset of the text in Olivec_Tiled.chars
+    size_t glyph_size;
+} Olivec_Command;
+
+typedef struct {
+    Olivec_Canvas oc;
+    size_t tile_size;
+    size_t tiles_x, tiles_y;
+
+    Olivec_Command *commands;
+    size_t commands_count;
+    size_t commands_capacity;
+
+    char *chars;
+    size_t chars_count;
+    size_t chars_capacity;
+
+    // Tile t owns bin_items[bins[t]..bins[t + 1]), indices into commands in the recording order.
+    size_t *bins;
+    size_t bins_capacity;
+    size_t *bin_items;
+    size_t bin_items_capacity;
+
+    pthread_t *threads;
+    size_t threads_count;
+    pthread_mutex_t mutex;
+    pthread_cond_t work;
+    pthread_cond_t done;
+    size_t generation;
+    size_t next_tile;
+    size_t busy;
+    bool quit;
+} Olivec_Tiled;
+
+// threads_count is the amount of additional worker threads. The thread calling olivec_tiled_flush()
+// always takes part in drawing, so 0 means drawing everything on the calling thread.
+OLIVECDEF bool olivec_tiled_init(Olivec_Tiled *tiled, size_t tile_size, size_t threads_count);
+OLIVECDEF void olivec_tiled_free(Olivec_Tiled *tiled);
+OLIVECDEF void olivec_tiled_begin(Olivec_Tiled *tiled, Olivec_Canvas oc);
+OLIVECDEF void olivec_tiled_fill(Olivec_Tiled *tiled, uint32_t color);
+OLIVECDEF void olivec_tiled_rect(Olivec_Tiled *tiled, int x, int y, int w, int h, uint32_t color);
+OLIVECDEF void olivec_tiled_circle(Olivec_Tiled *tiled, int cx, int cy, int r, uint32_t color);
+OLIVECDEF void olivec_tiled_triangle(Olivec_Tiled *tiled, int x1, int y1, int x2, int y2, int x3, int y3, uint32_t color);
+OLIVECDEF void olivec_tiled_sprite_blend(Olivec_Tiled *tiled, int x, int y, int w, int h, Olivec_Canvas sprite);
+OLIVECDEF void olivec_tiled_sprite_copy(Olivec_Tiled *tiled, int x, int y, int w, int h, Olivec_Canvas sprite);
+OLIVECDEF void olivec_tiled_text(Olivec_Tiled *tiled, const char *text, int x, int y, Olivec_Font font, size_t size, uint32_t color);
+// Draws all of the recorded commands and clears the command buffer.
+OLIVECDEF void olivec_tiled_flush(Olivec_Tiled *tiled);
+#endif // OLIVEC_TILED
+
+// Define OLIVEC_MESH_FILE to get olivec_mesh_file_map() that maps mesh files into memory. Like
+// OLIVEC_TILED it is not freestanding, it needs POSIX mmap.
+#ifdef OLIVEC_MESH_FILE
+typedef struct {
+    void *data;
+    size_t size;
+} Olivec_Mesh_File;
+
+// Maps the file and points the mesh into it. The mesh stays valid until olivec_mesh_file_unmap().
+OLIVECDEF bool olivec_mesh_file_map(const char *file_path, Olivec_Mesh_File *file, Olivec_Mesh *mesh);
+OLIVECDEF void olivec_mesh_file_unmap(Olivec_Mesh_File *file);
+#endif // OLIVEC_MESH_FILE
+
 #endif // OLIVE_C_
 
 #ifdef OLIVEC_IMPLEMENTATION
 
+#ifdef OLIVEC_SIMD
+#  if defined(__AVX2__)
+#    include <immintrin.h>
+#    define OLIVEC_SIMD_AVX2
+#  elif defined(__SSE2__)
+#    include <emmintrin.h>
+#    define OLIVEC_SIMD_SSE2
+#  elif defined(__ARM_NEON)
+#    include <arm_neon.h>
+#    define OLIVEC_SIMD_NEON
+#  endif
+#endif // OLIVEC_SIMD
+
 OLIVECDEF Olivec_Canvas olivec_canvas(uint32_t *pixels, size_t width, size_t height, size_t stride)
 {
     Olivec_Canvas oc = {
@@ -477,6 +903,12 @@ OLIVECDEF Olivec_Canvas olivec_canvas(uint32_t *pixels, size_t width, size_t hei
     return oc;
 }
 
+OLIVECDEF Olivec_Canvas olivec_canvas_pitch(void *pixels, size_t width, size_t height, size_t pitch)
+{
+    if (pitch%sizeof(uint32_t) != 0) return OLIVEC_CANVAS_NULL;
+    return olivec_canvas(pixels, width, height, pitch/sizeof(uint32_t));
+}
+
 OLIVECDEF bool olivec_normalize_rect(int x, int y, int w, int h,
                                      size_t canvas_width, size_t canvas_height,
                                      Olivec_Normalized_Rect *nr)
@@ -524,6 +956,86 @@ OLIVECDEF Olivec_Canvas olivec_subcanvas(Olivec_Canvas oc, int x, int y, int w,
     return oc;
 }
 
+OLIVECDEF Olivec_Canvas olivec_damage_track(Olivec_Canvas oc, Olivec_Damage *damage)
+{
+    damage->pixels = oc.pixels;
+    damage->width = oc.width;
+    damage->height = oc.height;
+    damage->stride = oc.stride;
+    damage->count = 0;
+    oc.damage = damage;
+    return oc;
+}
+
+OLIVECDEF void olivec_damage_clear(Olivec_Damage *damage)
+{
+    damage->count = 0;
+}
+
+OLIVECDEF int64_t olivec_damage_area(Olivec_Damage_Rect r)
+{
+    return (int64_t) r.w*r.h;
+}
+
+OLIVECDEF Olivec_Damage_Rect olivec_damage_union(Olivec_Damage_Rect a, Olivec_Damage_Rect b)
+{
+    int x1 = a.x < b.x ? a.x : b.x;
+    int y1 = a.y < b.y ? a.y : b.y;
+    int x2 = a.x + a.w > b.x + b.w ? a.x + a.w : b.x + b.w;
+    int y2 = a.y + a.h > b.y + b.h ? a.y + a.h : b.y + b.h;
+    return (Olivec_Damage_Rect) {x1, y1, x2 - x1, y2 - y1};
+}
+
+OLIVECDEF void olivec_damage(Olivec_Canvas oc, int x, int y, int w, int h)
+{
+    Olivec_Damage *damage = oc.damage;
+    if (damage == NULL) return;
+    Olivec_Normalized_Rect nr = {0};
+    if (!olivec_normalize_rect(x, y, w, h, oc.width, oc.height, &nr)) return;
+
+    // Subcanvases point into the pixels of the tracked canvas
+    size_t offset = oc.pixels - damage->pixels;
+    Olivec_Damage_Rect r = {
+        .x = offset%damage->stride + nr.x1,
+        .y = offset/damage->stride + nr.y1,
+        .w = nr.x2 - nr.x1 + 1,
+        .h = nr.y2 - nr.y1 + 1,
+    };
+
+    // A rectangle is merged into another one when their union is not larger than the two of them
+    // together, which keeps the overlapping and adjacent ones from piling up. The merged rectangle
+    // may in turn be merged with the others. When there is no room left the new rectangle goes into
+    // the one that grows the least.
+    for (;;) {
+        size_t i = 0;
+        while (i < damage->count) {
+            Olivec_Damage_Rect u = olivec_damage_union(damage->rects[i], r);
+            if (olivec_damage_area(u) == olivec_damage_area(damage->rects[i])) return;
+            if (olivec_damage_area(u) <= olivec_damage_area(damage->rects[i]) + olivec_damage_area(r)) {
+                r = u;
+                damage->rects[i] = damage->rects[--damage->count];
+                i = 0;
+            } else {
+                i += 1;
+            }
+        }
+        if (damage->count < OLIVEC_DAMAGE_RECTS) break;
+
+        size_t best = 0;
+        int64_t best_growth = 0;
+        for (i = 0; i < damage->count; ++i) {
+            int64_t growth = olivec_damage_area(olivec_damage_union(damage->rects[i], r)) - olivec_damage_area(damage->rects[i]);
+            if (i == 0 || growth < best_growth) {
+                best = i;
+                best_growth = growth;
+            }
+        }
+        r = olivec_damage_union(damage->rects[best], r);
+        damage->rects[best] = damage->rects[--damage->count];
+    }
+    damage->rects[damage->count++] = r;
+}
+
 // TODO: custom pixel formats
 // Maybe we can store pixel format info in Olivec_Canvas
 #define OLIVEC_RED(color)   (((color)&0x000000FF)>>(8*0))
@@ -534,29 +1046,215 @@ OLIVECDEF Olivec_Canvas olivec_subcanvas(Olivec_Canvas oc, int x, int y, int w,
 
 OLIVECDEF void olivec_blend_color(uint32_t *c1, uint32_t c2)
 {
-    uint32_t r1 = OLIVEC_RED(*c1);
-    uint32_t g1 = OLIVEC_GREEN(*c1);
-    uint32_t b1 = OLIVEC_BLUE(*c1);
-    uint32_t a1 = OLIVEC_ALPHA(*c1);
-
-    uint32_t r2 = OLIVEC_RED(c2);
-    uint32_t g2 = OLIVEC_GREEN(c2);
-    uint32_t b2 = OLIVEC_BLUE(c2);
     uint32_t a2 = OLIVEC_ALPHA(c2);
 
-    r1 = (r1*(255 - a2) + r2*a2)/255; if (r1 > 255) r1 = 255;
-    g1 = (g1*(255 - a2) + g2*a2)/255; if (g1 > 255) g1 = 255;
-    b1 = (b1*(255 - a2) + b2*a2)/255; if (b1 > 255) b1 = 255;
+    // Red and Blue are blended with a single multiplication since each of them gets its own 16 bits.
+    // c1*(255 - a2) + c2*a2 never exceeds 255*255 and (t + 1 + (t>>8))>>8 is exactly t/255 in that range.
+    uint32_t rb = (*c1&0x00FF00FF)*(255 - a2) + (c2&0x00FF00FF)*a2;
+    rb = ((rb + 0x00010001 + ((rb>>8)&0x00FF00FF))>>8)&0x00FF00FF;
+    uint32_t g = OLIVEC_GREEN(*c1)*(255 - a2) + OLIVEC_GREEN(c2)*a2;
+    g = (g + 1 + (g>>8))>>8;
+
+    *c1 = (*c1&0xFF000000) | rb | (g<<(8*1));
+}
+
+// Overwrite n consecutive pixels with the color. Unlike blending it does not preserve the alpha of dst.
+OLIVECDEF void olivec_fill_span(uint32_t *dst, size_t n, uint32_t color)
+{
+    size_t i = 0;
+#if defined(OLIVEC_SIMD_AVX2)
+    __m256i c = _mm256_set1_epi32(color);
+    for (; i + 16 <= n; i += 16) {
+        _mm256_storeu_si256((__m256i*)&dst[i + 0], c);
+        _mm256_storeu_si256((__m256i*)&dst[i + 8], c);
+    }
+#elif defined(OLIVEC_SIMD_SSE2)
+    __m128i c = _mm_set1_epi32(color);
+    for (; i + 8 <= n; i += 8) {
+        _mm_storeu_si128((__m128i*)&dst[i + 0], c);
+        _mm_storeu_si128((__m128i*)&dst[i + 4], c);
+    }
+#elif defined(OLIVEC_SIMD_NEON)
+    uint32x4_t c = vdupq_n_u32(color);
+    for (; i + 8 <= n; i += 8) {
+        vst1q_u32(&dst[i + 0], c);
+        vst1q_u32(&dst[i + 4], c);
+    }
+#endif
+    for (uint32_t *p = dst + i; p < dst + n; ++p) *p = color;
+}
+
+// Blending an opaque color just replaces the color channels while keeping the alpha of dst.
+// No multiplications are needed, so it runs at the speed of memory.
+OLIVECDEF void olivec_opaque_span(uint32_t *dst, size_t n, uint32_t color)
+{
+    uint32_t rgb = color&0x00FFFFFF;
+    size_t i = 0;
+#if defined(OLIVEC_SIMD_AVX2)
+    __m256i c = _mm256_set1_epi32(rgb);
+    __m256i amask = _mm256_set1_epi32(0xFF000000);
+    for (; i + 8 <= n; i += 8) {
+        __m256i d = _mm256_loadu_si256((const __m256i*)&dst[i]);
+        _mm256_storeu_si256((__m256i*)&dst[i], _mm256_or_si256(_mm256_and_si256(d, amask), c));
+    }
+#elif defined(OLIVEC_SIMD_SSE2)
+    __m128i c = _mm_set1_epi32(rgb);
+    __m128i amask = _mm_set1_epi32(0xFF000000);
+    for (; i + 4 <= n; i += 4) {
+        __m128i d = _mm_loadu_si128((const __m128i*)&dst[i]);
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_or_si128(_mm_and_si128(d, amask), c));
+    }
+#elif defined(OLIVEC_SIMD_NEON)
+    uint32x4_t c = vdupq_n_u32(rgb);
+    uint32x4_t amask = vdupq_n_u32(0xFF000000);
+    for (; i + 4 <= n; i += 4) {
+        vst1q_u32(&dst[i], vorrq_u32(vandq_u32(vld1q_u32(&dst[i]), amask), c));
+    }
+#endif
+    for (; i < n; ++i) dst[i] = (dst[i]&0xFF000000) | rgb;
+}
+
+// Blend the same color into n consecutive pixels. Produces exactly the same result as calling
+// olivec_blend_color() on every pixel.
+OLIVECDEF void olivec_blend_span(uint32_t *dst, size_t n, uint32_t color)
+{
+    uint32_t a = OLIVEC_ALPHA(color);
+    if (a == 0) return;
+    if (a == 255) {
+        olivec_opaque_span(dst, n, color);
+        return;
+    }
+
+    size_t i = 0;
+#if defined(OLIVEC_SIMD_AVX2)
+    // Every pixel unpacks into 4 lanes of 16 bits, so the color's contribution c*a is one 64 bit pattern
+    uint64_t ca = (uint64_t)(OLIVEC_RED(color)*a) | ((uint64_t)(OLIVEC_GREEN(color)*a)<<16) | ((uint64_t)(OLIVEC_BLUE(color)*a)<<32);
+    __m256i zero  = _mm256_setzero_si256();
+    __m256i ia    = _mm256_set1_epi16(255 - a);
+    __m256i sa    = _mm256_set1_epi64x(ca);
+    __m256i magic = _mm256_set1_epi16((short)0x8081);
+    __m256i amask = _mm256_set1_epi32(0xFF000000);
+    for (; i + 8 <= n; i += 8) {
+        __m256i d  = _mm256_loadu_si256((const __m256i*)&dst[i]);
+        __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), ia), sa);
+        __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), ia), sa);
+        // t/255 == (t*0x8081)>>23 for every t <= 255*255
+        lo = _mm256_srli_epi16(_mm256_mulhi_epu16(lo, magic), 7);
+        hi = _mm256_srli_epi16(_mm256_mulhi_epu16(hi, magic), 7);
+        __m256i r = _mm256_packus_epi16(lo, hi);
+        r = _mm256_or_si256(_mm256_andnot_si256(amask, r), _mm256_and_si256(amask, d));
+        _mm256_storeu_si256((__m256i*)&dst[i], r);
+    }
+#elif defined(OLIVEC_SIMD_SSE2)
+    uint64_t ca = (uint64_t)(OLIVEC_RED(color)*a) | ((uint64_t)(OLIVEC_GREEN(color)*a)<<16) | ((uint64_t)(OLIVEC_BLUE(color)*a)<<32);
+    __m128i zero  = _mm_setzero_si128();
+    __m128i ia    = _mm_set1_epi16(255 - a);
+    __m128i sa    = _mm_set1_epi64x(ca);
+    __m128i magic = _mm_set1_epi16((short)0x8081);
+    __m128i amask = _mm_set1_epi32(0xFF000000);
+    for (; i + 4 <= n; i += 4) {
+        __m128i d  = _mm_loadu_si128((const __m128i*)&dst[i]);
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), ia), sa);
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), ia), sa);
+        lo = _mm_srli_epi16(_mm_mulhi_epu16(lo, magic), 7);
+        hi = _mm_srli_epi16(_mm_mulhi_epu16(hi, magic), 7);
+        __m128i r = _mm_packus_epi16(lo, hi);
+        r = _mm_or_si128(_mm_andnot_si128(amask, r), _mm_and_si128(amask, d));
+        _mm_storeu_si128((__m128i*)&dst[i], r);
+    }
+#elif defined(OLIVEC_SIMD_NEON)
+    uint8x8_t ia = vdup_n_u8(255 - a);
+    uint16x8_t one = vdupq_n_u16(1);
+    uint16x8_t sa[3] = {
+        vdupq_n_u16(OLIVEC_RED(color)*a),
+        vdupq_n_u16(OLIVEC_GREEN(color)*a),
+        vdupq_n_u16(OLIVEC_BLUE(color)*a),
+    };
+    for (; i + 8 <= n; i += 8) {
+        // Deinterleaved into R, G, B, A planes. The alpha plane is stored back untouched.
+        uint8x8x4_t d = vld4_u8((const uint8_t*)&dst[i]);
+        for (int c = 0; c < 3; ++c) {
+            uint16x8_t t = vmlal_u8(sa[c], d.val[c], ia);
+            d.val[c] = vshrn_n_u16(vaddq_u16(vsraq_n_u16(t, t, 8), one), 8);
+        }
+        vst4_u8((uint8_t*)&dst[i], d);
+    }
+#endif
+    for (; i < n; ++i) olivec_blend_color(&dst[i], color);
+}
 
-    *c1 = OLIVEC_RGBA(r1, g1, b1, a1);
+// Blend n consecutive pixels of src on top of n consecutive pixels of dst. Produces exactly the same
+// result as calling olivec_blend_color() on every pair of pixels.
+OLIVECDEF void olivec_blend_span_pixels(uint32_t *dst, const uint32_t *src, size_t n)
+{
+    size_t i = 0;
+#if defined(OLIVEC_SIMD_AVX2)
+    __m256i zero  = _mm256_setzero_si256();
+    __m256i full  = _mm256_set1_epi16(255);
+    __m256i magic = _mm256_set1_epi16((short)0x8081);
+    __m256i amask = _mm256_set1_epi32(0xFF000000);
+    for (; i + 8 <= n; i += 8) {
+        __m256i d = _mm256_loadu_si256((const __m256i*)&dst[i]);
+        __m256i s = _mm256_loadu_si256((const __m256i*)&src[i]);
+        __m256i dlo = _mm256_unpacklo_epi8(d, zero), dhi = _mm256_unpackhi_epi8(d, zero);
+        __m256i slo = _mm256_unpacklo_epi8(s, zero), shi = _mm256_unpackhi_epi8(s, zero);
+        // Broadcast the alpha of every source pixel into all of its 4 lanes
+        __m256i alo = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(slo, 0xFF), 0xFF);
+        __m256i ahi = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(shi, 0xFF), 0xFF);
+        __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(dlo, _mm256_sub_epi16(full, alo)), _mm256_mullo_epi16(slo, alo));
+        __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(dhi, _mm256_sub_epi16(full, ahi)), _mm256_mullo_epi16(shi, ahi));
+        lo = _mm256_srli_epi16(_mm256_mulhi_epu16(lo, magic), 7);
+        hi = _mm256_srli_epi16(_mm256_mulhi_epu16(hi, magic), 7);
+        __m256i r = _mm256_packus_epi16(lo, hi);
+        r = _mm256_or_si256(_mm256_andnot_si256(amask, r), _mm256_and_si256(amask, d));
+        _mm256_storeu_si256((__m256i*)&dst[i], r);
+    }
+#elif defined(OLIVEC_SIMD_SSE2)
+    __m128i zero  = _mm_setzero_si128();
+    __m128i full  = _mm_set1_epi16(255);
+    __m128i magic = _mm_set1_epi16((short)0x8081);
+    __m128i amask = _mm_set1_epi32(0xFF000000);
+    for (; i + 4 <= n; i += 4) {
+        __m128i d = _mm_loadu_si128((const __m128i*)&dst[i]);
+        __m128i s = _mm_loadu_si128((const __m128i*)&src[i]);
+        __m128i dlo = _mm_unpacklo_epi8(d, zero), dhi = _mm_unpackhi_epi8(d, zero);
+        __m128i slo = _mm_unpacklo_epi8(s, zero), shi = _mm_unpackhi_epi8(s, zero);
+        __m128i alo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(slo, 0xFF), 0xFF);
+        __m128i ahi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(shi, 0xFF), 0xFF);
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(dlo, _mm_sub_epi16(full, alo)), _mm_mullo_epi16(slo, alo));
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(dhi, _mm_sub_epi16(full, ahi)), _mm_mullo_epi16(shi, ahi));
+        lo = _mm_srli_epi16(_mm_mulhi_epu16(lo, magic), 7);
+        hi = _mm_srli_epi16(_mm_mulhi_epu16(hi, magic), 7);
+        __m128i r = _mm_packus_epi16(lo, hi);
+        r = _mm_or_si128(_mm_andnot_si128(amask, r), _mm_and_si128(amask, d));
+        _mm_storeu_si128((__m128i*)&dst[i], r);
+    }
+#elif defined(OLIVEC_SIMD_NEON)
+    uint16x8_t one = vdupq_n_u16(1);
+    for (; i + 8 <= n; i += 8) {
+        uint8x8x4_t d = vld4_u8((const uint8_t*)&dst[i]);
+        uint8x8x4_t s = vld4_u8((const uint8_t*)&src[i]);
+        uint8x8_t ia = vmvn_u8(s.val[3]);
+        for (int c = 0; c < 3; ++c) {
+            uint16x8_t t = vmlal_u8(vmull_u8(d.val[c], ia), s.val[c], s.val[3]);
+            d.val[c] = vshrn_n_u16(vaddq_u16(vsraq_n_u16(t, t, 8), one), 8);
+        }
+        vst4_u8((uint8_t*)&dst[i], d);
+    }
+#endif
+    for (; i < n; ++i) olivec_blend_color(&dst[i], src[i]);
 }
 
 OLIVECDEF void olivec_fill(Olivec_Canvas oc, uint32_t color)
 {
+    olivec_damage(oc, 0, 0, oc.width, oc.height);
+    if (oc.width == oc.stride) {
+        // No gaps between the rows, the whole canvas is one span
+        olivec_fill_span(oc.pixels, oc.width*oc.height, color);
+        return;
+    }
     for (size_t y = 0; y < oc.height; ++y) {
-        for (size_t x = 0; x < oc.width; ++x) {
-            OLIVEC_PIXEL(oc, x, y) = color;
-        }
+        olivec_fill_span(&OLIVEC_PIXEL(oc, 0, y), oc.width, color);
     }
 }
 
@@ -564,10 +1262,15 @@ OLIVECDEF void olivec_rect(Olivec_Canvas oc, int x, int y, int w, int h, uint32_
 {
     Olivec_Normalized_Rect nr = {0};
     if (!olivec_normalize_rect(x, y, w, h, oc.width, oc.height, &nr)) return;
-    for (int x = nr.x1; x <= nr.x2; ++x) {
-        for (int y = nr.y1; y <= nr.y2; ++y) {
-            olivec_blend_color(&OLIVEC_PIXEL(oc, x, y), color);
-        }
+    olivec_damage(oc, nr.x1, nr.y1, nr.x2 - nr.x1 + 1, nr.y2 - nr.y1 + 1);
+    size_t span = nr.x2 - nr.x1 + 1;
+    if (span == oc.stride) {
+        // The rows are adjacent in memory, blend them all as one span
+        olivec_blend_span(&OLIVEC_PIXEL(oc, nr.x1, nr.y1), span*(nr.y2 - nr.y1 + 1), color);
+        return;
+    }
+    for (int y = nr.y1; y <= nr.y2; ++y) {
+        olivec_blend_span(&OLIVEC_PIXEL(oc, nr.x1, y), span, color);
     }
 }
 
@@ -589,23 +1292,110 @@ OLIVECDEF void olivec_frame(Olivec_Canvas oc, int x, int y, int w, int h, size_t
     olivec_rect(oc, x2 + t/2, y1 - t/2, -t, (y2 - y1 + 1) + t/2*2, color); // Right
 }
 
+// Integer division rounding towards negative and positive infinity respectively. b must be positive.
+OLIVECDEF int64_t olivec_div_floor(int64_t a, int64_t b)
+{
+    return a >= 0 ? a/b : -((-a + b - 1)/b);
+}
+
+OLIVECDEF int64_t olivec_div_ceil(int64_t a, int64_t b)
+{
+    return -olivec_div_floor(-a, b);
+}
+
+// Largest s such that s*s <= n
+OLIVECDEF uint64_t olivec_isqrt(uint64_t n)
+{
+    uint64_t s = 0;
+    uint64_t bit = n >> 32 ? (uint64_t)1 << 62 : (uint64_t)1 << 30;
+    while (bit > n) bit >>= 2;
+    while (bit != 0) {
+        if (n >= s + bit) {
+            n -= s + bit;
+            s = (s >> 1) + bit;
+        } else {
+            s >>= 1;
+        }
+        bit >>= 2;
+    }
+    return s;
+}
+
+OLIVECDEF bool olivec_ellipse_contains(Olivec_Normalized_Rect nr, int rx1, int ry1, int x, int y)
+{
+    float nx = (x + 0.5 - nr.x1)/(2.0f*rx1);
+    float ny = (y + 0.5 - nr.y1)/(2.0f*ry1);
+    float dx = nx - 0.5;
+    float dy = ny - 0.5;
+    return dx*dx + dy*dy <= 0.5*0.5;
+}
+
 OLIVECDEF void olivec_ellipse(Olivec_Canvas oc, int cx, int cy, int rx, int ry, uint32_t color)
 {
     Olivec_Normalized_Rect nr = {0};
     int rx1 = rx + OLIVEC_SIGN(int, rx);
     int ry1 = ry + OLIVEC_SIGN(int, ry);
     if (!olivec_normalize_rect(cx - rx1, cy - ry1, 2*rx1, 2*ry1, oc.width, oc.height, &nr)) return;
+    olivec_damage(oc, nr.x1, nr.y1, nr.x2 - nr.x1 + 1, nr.y2 - nr.y1 + 1);
 
+    // dx grows monotonically with x (or falls if rx is negative), so along a row dx*dx + dy*dy first
+    // falls and then grows. Its minimum is next to where dx crosses zero and the pixels that pass
+    // the test form one span around it, which we find by binary searching its ends.
+    int xc = nr.x1 + rx1 - 1;
     for (int y = nr.y1; y <= nr.y2; ++y) {
-        for (int x = nr.x1; x <= nr.x2; ++x) {
-            float nx = (x + 0.5 - nr.x1)/(2.0f*rx1);
-            float ny = (y + 0.5 - nr.y1)/(2.0f*ry1);
-            float dx = nx - 0.5;
-            float dy = ny - 0.5;
-            if (dx*dx + dy*dy <= 0.5*0.5) {
-                OLIVEC_PIXEL(oc, x, y) = color;
+        int xm = -1;
+        for (int x = xc; x <= xc + 1; ++x) {
+            int xi = x < nr.x1 ? nr.x1 : x > nr.x2 ? nr.x2 : x;
+            if (olivec_ellipse_contains(nr, rx1, ry1, xi, y)) {
+                xm = xi;
+                break;
             }
         }
+        if (xm < 0) continue;
+
+        int lo = nr.x1, hi = xm;
+        while (lo < hi) {
+            int mid = lo + (hi - lo)/2;
+            if (olivec_ellipse_contains(nr, rx1, ry1, mid, y)) hi = mid; else lo = mid + 1;
+        }
+        int x1 = lo;
+
+        lo = xm, hi = nr.x2;
+        while (lo < hi) {
+            int mid = hi - (hi - lo)/2;
+            if (olivec_ellipse_contains(nr, rx1, ry1, mid, y)) lo = mid; else hi = mid - 1;
+        }
+        int x2 = lo;
+
+        olivec_fill_span(&OLIVEC_PIXEL(oc, x1, y), x2 - x1 + 1, color);
+    }
+}
+
+// Amount of the OLIVEC_AA_RES*OLIVEC_AA_RES samples of the pixel (x, y) that are inside of the circle
+OLIVECDEF int olivec_circle_coverage(int x, int y, int cx, int cy, int r)
+{
+    int count = 0;
+    for (int sox = 0; sox < OLIVEC_AA_RES; ++sox) {
+        for (int soy = 0; soy < OLIVEC_AA_RES; ++soy) {
+            // TODO: switch to 64 bits to make the overflow less likely
+            // Also research the probability of overflow
+            int res1 = (OLIVEC_AA_RES + 1);
+            int dx = (x*res1*2 + 2 + sox*2 - res1*cx*2 - res1);
+            int dy = (y*res1*2 + 2 + soy*2 - res1*cy*2 - res1);
+            if (dx*dx + dy*dy <= res1*res1*r*r*2*2) count += 1;
+        }
+    }
+    return count;
+}
+
+OLIVECDEF void olivec_circle_boundary(Olivec_Canvas oc, int x1, int x2, int y, int cx, int cy, int r, uint32_t color)
+{
+    for (int x = x1; x <= x2; ++x) {
+        int count = olivec_circle_coverage(x, y, cx, cy, r);
+        if (count == 0) continue;
+        uint32_t alpha = ((color&0xFF000000)>>(3*8))*count/OLIVEC_AA_RES/OLIVEC_AA_RES;
+        uint32_t updated_color = (color&0x00FFFFFF)|(alpha<<(3*8));
+        olivec_blend_color(&OLIVEC_PIXEL(oc, x, y), updated_color);
     }
 }
 
@@ -614,23 +1404,50 @@ OLIVECDEF void olivec_circle(Olivec_Canvas oc, int cx, int cy, int r, uint32_t c
     Olivec_Normalized_Rect nr = {0};
     int r1 = r + OLIVEC_SIGN(int, r);
     if (!olivec_normalize_rect(cx - r1, cy - r1, 2*r1, 2*r1, oc.width, oc.height, &nr)) return;
-
+    olivec_damage(oc, nr.x1, nr.y1, nr.x2 - nr.x1 + 1, nr.y2 - nr.y1 + 1);
+
+    // In the units of olivec_circle_coverage() a sample at dx, dy is inside when dx*dx + dy*dy <= rr
+    // and dx = 2*res1*(x - cx) + k, where k depends only on the sample column sox.
+    int64_t res1 = OLIVEC_AA_RES + 1;
+    int64_t step = 2*res1;
+    int64_t rr = step*r*step*r;
+    int64_t k_first = 2 - res1;
+    int64_t k_last = 2 + 2*(OLIVEC_AA_RES - 1) - res1;
     for (int y = nr.y1; y <= nr.y2; ++y) {
-        for (int x = nr.x1; x <= nr.x2; ++x) {
-            int count = 0;
-            for (int sox = 0; sox < OLIVEC_AA_RES; ++sox) {
-                for (int soy = 0; soy < OLIVEC_AA_RES; ++soy) {
-                    // TODO: switch to 64 bits to make the overflow less likely
-                    // Also research the probability of overflow
-                    int res1 = (OLIVEC_AA_RES + 1);
-                    int dx = (x*res1*2 + 2 + sox*2 - res1*cx*2 - res1);
-                    int dy = (y*res1*2 + 2 + soy*2 - res1*cy*2 - res1);
-                    if (dx*dx + dy*dy <= res1*res1*r*r*2*2) count += 1;
-                }
-            }
-            uint32_t alpha = ((color&0xFF000000)>>(3*8))*count/OLIVEC_AA_RES/OLIVEC_AA_RES;
-            uint32_t updated_color = (color&0x00FFFFFF)|(alpha<<(3*8));
-            olivec_blend_color(&OLIVEC_PIXEL(oc, x, y), updated_color);
+        int64_t dy_min = -1, dy_max = 0;
+        for (int soy = 0; soy < OLIVEC_AA_RES; ++soy) {
+            int64_t dy = step*(y - cy) + 2 + 2*soy - res1;
+            dy = dy*dy;
+            if (dy_min < 0 || dy < dy_min) dy_min = dy;
+            if (dy > dy_max) dy_max = dy;
+        }
+        if (dy_min > rr) continue;
+
+        // Pixels that may have at least one sample inside
+        int64_t s = olivec_isqrt(rr - dy_min);
+        int64_t ox1 = cx + olivec_div_ceil(-s - k_last, step);
+        int64_t ox2 = cx + olivec_div_floor(s - k_first, step);
+        if (ox1 < nr.x1) ox1 = nr.x1;
+        if (ox2 > nr.x2) ox2 = nr.x2;
+        if (ox1 > ox2) continue;
+
+        // Pixels that have all of the samples inside. The samples of a pixel are a grid and the circle
+        // is convex, so it is enough to check the corners of the grid.
+        int64_t ix1 = 0, ix2 = -1;
+        if (dy_max <= rr) {
+            s = olivec_isqrt(rr - dy_max);
+            ix1 = cx + olivec_div_ceil(-s - k_first, step);
+            ix2 = cx + olivec_div_floor(s - k_last, step);
+            if (ix1 < ox1) ix1 = ox1;
+            if (ix2 > ox2) ix2 = ox2;
+        }
+
+        if (ix1 > ix2) {
+            olivec_circle_boundary(oc, ox1, ox2, y, cx, cy, r, color);
+        } else {
+            olivec_circle_boundary(oc, ox1, ix1 - 1, y, cx, cy, r, color);
+            olivec_blend_span(&OLIVEC_PIXEL(oc, ix1, y), ix2 - ix1 + 1, color);
+            olivec_circle_boundary(oc, ix2 + 1, ox2, y, cx, cy, r, color);
         }
     }
 }
@@ -640,11 +1457,50 @@ OLIVECDEF bool olivec_in_bounds(Olivec_Canvas oc, int x, int y)
     return 0 <= x && x < (int) oc.width && 0 <= y && y < (int) oc.height;
 }
 
-// TODO: AA for line
+// Walks the line along its major axis a with the minor axis b following b = b1 + sign(db)*(|db|*t/da)
+// for t = 0..da, where da > 0 and |db| <= da. Finds the range of t that keeps both coordinates
+// inside of the canvas without walking the line.
+OLIVECDEF bool olivec_line_clip(int64_t a1, int64_t b1, int64_t da, int64_t db, int64_t a_size, int64_t b_size, int64_t *t1, int64_t *t2)
+{
+    *t1 = 0;
+    *t2 = da;
+    if (*t1 < -a1) *t1 = -a1;
+    if (*t2 > a_size - 1 - a1) *t2 = a_size - 1 - a1;
+    if (*t1 > *t2) return false;
+
+    int64_t A = OLIVEC_ABS(int64_t, db);
+    if (A == 0) return 0 <= b1 && b1 < b_size;
+
+    // q(t) = A*t/da is non-decreasing, so every bound on it is a bound on t:
+    //   q(t) >= m <=> t >= ceil(m*da/A)
+    //   q(t) <= m <=> t <= floor(((m + 1)*da - 1)/A)
+    int64_t qmin, qmax;
+    if (db > 0) {
+        qmin = -b1;
+        qmax = b_size - 1 - b1;
+    } else {
+        qmin = b1 - (b_size - 1);
+        qmax = b1;
+    }
+    if (qmax < 0) return false;
+    int64_t lo = olivec_div_ceil(qmin*da, A);
+    int64_t hi = olivec_div_floor((qmax + 1)*da - 1, A);
+    if (*t1 < lo) *t1 = lo;
+    if (*t2 > hi) *t2 = hi;
+    return *t1 <= *t2;
+}
+
 OLIVECDEF void olivec_line(Olivec_Canvas oc, int x1, int y1, int x2, int y2, uint32_t color)
 {
+    // Trivially reject the lines that are completely on one side of the canvas
+    if (x1 < 0 && x2 < 0) return;
+    if (y1 < 0 && y2 < 0) return;
+    if (x1 >= (int) oc.width && x2 >= (int) oc.width) return;
+    if (y1 >= (int) oc.height && y2 >= (int) oc.height) return;
+
     int dx = x2 - x1;
     int dy = y2 - y1;
+    olivec_damage(oc, x1 < x2 ? x1 : x2, y1 < y2 ? y1 : y2, OLIVEC_ABS(int, dx) + 1, OLIVEC_ABS(int, dy) + 1);
 
     // If both of the differences are 0 there will be a division by 0 below.
     if (dx == 0 && dy == 0) {
@@ -654,94 +1510,706 @@ OLIVECDEF void olivec_line(Olivec_Canvas oc, int x1, int y1, int x2, int y2, uin
         return;
     }
 
-    if (OLIVEC_ABS(int, dx) > OLIVEC_ABS(int, dy)) {
-        if (x1 > x2) {
-            OLIVEC_SWAP(int, x1, x2);
-            OLIVEC_SWAP(int, y1, y2);
-        }
+    // The pixels are exactly the ones of y = dy*(x - x1)/dx + y1 (or x = dx*(y - y1)/dy + x1 for the steep
+    // lines) with the division rounding towards zero. The quotient is maintained incrementally with
+    // its remainder, which advances it by at most one per step.
+    bool steep = OLIVEC_ABS(int, dx) <= OLIVEC_ABS(int, dy);
+    int a1 = steep ? y1 : x1;
+    int b1 = steep ? x1 : y1;
+    int da = steep ? dy : dx;
+    int db = steep ? dx : dy;
+    if (da < 0) {
+        a1 += da;
+        b1 += db;
+        da = -da;
+        db = -db;
+    }
 
-        for (int x = x1; x <= x2; ++x) {
-            int y = dy*(x - x1)/dx + y1;
-            // TODO: move boundary checks out side of the loops in olivec_draw_line
-            if (olivec_in_bounds(oc, x, y)) {
-                olivec_blend_color(&OLIVEC_PIXEL(oc, x, y), color);
-            }
-        }
-    } else {
-        if (y1 > y2) {
-            OLIVEC_SWAP(int, x1, x2);
-            OLIVEC_SWAP(int, y1, y2);
+    int64_t t1, t2;
+    if (!olivec_line_clip(a1, b1, da, db, steep ? oc.height : oc.width, steep ? oc.width : oc.height, &t1, &t2)) return;
+
+    int A = OLIVEC_ABS(int, db);
+    int64_t num = (int64_t)A*t1;
+    int q = num/da;
+    int rem = num%da;
+    int a_step = steep ? oc.stride : 1;
+    int b_step = (steep ? 1 : (int) oc.stride)*OLIVEC_SIGN(int, db);
+    int a = a1 + t1;
+    int b = b1 + OLIVEC_SIGN(int, db)*q;
+    uint32_t *pixel = steep ? &OLIVEC_PIXEL(oc, b, a) : &OLIVEC_PIXEL(oc, a, b);
+    for (int64_t t = t1; t <= t2; ++t) {
+        olivec_blend_color(pixel, color);
+        pixel += a_step;
+        rem += A;
+        if (rem >= da) {
+            rem -= da;
+            pixel += b_step;
         }
+    }
+}
 
-        for (int y = y1; y <= y2; ++y) {
-            int x = dx*(y - y1)/dy + x1;
-            // TODO: move boundary checks out side of the loops in olivec_draw_line
-            if (olivec_in_bounds(oc, x, y)) {
-                olivec_blend_color(&OLIVEC_PIXEL(oc, x, y), color);
-            }
-        }
+OLIVECDEF void olivec_lines(Olivec_Canvas oc, const Olivec_Segment *segments, size_t count, uint32_t color)
+{
+    for (size_t i = 0; i < count; ++i) {
+        olivec_line(oc, segments[i].x1, segments[i].y1, segments[i].x2, segments[i].y2, color);
     }
 }
 
-OLIVECDEF uint32_t mix_colors2(uint32_t c1, uint32_t c2, int u1, int det)
+// sqrtf() without libm: bit hack estimate refined by Newton's method
+OLIVECDEF float olivec_sqrtf(float x)
 {
-    // TODO: estimate how much overflows are an issue in integer only environment
-    int64_t r1 = OLIVEC_RED(c1);
-    int64_t g1 = OLIVEC_GREEN(c1);
-    int64_t b1 = OLIVEC_BLUE(c1);
-    int64_t a1 = OLIVEC_ALPHA(c1);
+    if (x <= 0) return 0;
+    union { float f; uint32_t u; } v = {x};
+    v.u = 0x1FBD1DF5 + (v.u >> 1);
+    float s = v.f;
+    s = 0.5f*(s + x/s);
+    s = 0.5f*(s + x/s);
+    return s;
+}
 
-    int64_t r2 = OLIVEC_RED(c2);
-    int64_t g2 = OLIVEC_GREEN(c2);
-    int64_t b2 = OLIVEC_BLUE(c2);
-    int64_t a2 = OLIVEC_ALPHA(c2);
+OLIVECDEF float olivec_clamp01(float x)
+{
+    if (x < 0) return 0;
+    if (x > 1) return 1;
+    return x;
+}
 
-    if (det != 0) {
-        int u2 = det - u1;
-        int64_t r4 = (r1*u2 + r2*u1)/det;
-        int64_t g4 = (g1*u2 + g2*u1)/det;
-        int64_t b4 = (b1*u2 + b2*u1)/det;
-        int64_t a4 = (a1*u2 + a2*u1)/det;
+// Part of the pixel [s - 0.5, s + 0.5] covered by the band [-r, r]
+OLIVECDEF float olivec_band_coverage(float s, float r)
+{
+    float lo = s - 0.5f;
+    float hi = s + 0.5f;
+    if (lo < -r) lo = -r;
+    if (hi > r) hi = r;
+    return olivec_clamp01(hi - lo);
+}
 
-        return OLIVEC_RGBA(r4, g4, b4, a4);
-    }
+// A stroke is drawn as a sequence of convex pieces: the bodies of the segments and, for bevel and
+// miter joins, the polygons that fill the gaps at the joints. Coverage of a pixel is estimated from
+// its center with a box filter across every edge of the piece.
+typedef struct {
+    bool is_polygon;
+
+    // Body of the segment a..b of half-thickness r. dx, dy is the unit direction.
+    // The ends are either round or flat and extended by ext (square caps).
+    float ax, ay, bx, by;
+    float dx, dy, len;
+    float r;
+    bool round_a, round_b;
+    float ext_a, ext_b;
+
+    // Convex polygon. Edge i is the line nx[i]*x + ny[i]*y = c[i] with the outward unit normal.
+    int n;
+    float nx[4], ny[4], c[4];
+
+    // Pixels the piece may touch
+    int lx, hx;
+    int ly, hy;
+
+    // Half-planes ex[i]*x + ey[i]*y < ec[i] of the pixel centers where the coverage may be non-zero.
+    // They cut every row into a single span. inv_ex[i] is 1/ex[i].
+    int en;
+    float ex[4], ey[4], ec[4], inv_ex[4];
+} Olivec_Stroke_Piece;
+
+OLIVECDEF int olivec_floorf_clamped(float x)
+{
+    // Conversions are clamped so huge coordinates can't overflow int
+    if (x < -1e9f) return -1000000000;
+    if (x > 1e9f) return 1000000000;
+    int i = x;
+    return i > x ? i - 1 : i;
+}
 
-    return 0;
+// Pixels whose centers are within pad from the box lx..hx, ly..hy
+OLIVECDEF void olivec_stroke_piece_bbox(Olivec_Stroke_Piece *p, float lx, float ly, float hx, float hy, float pad)
+{
+    p->lx = olivec_floorf_clamped(lx - pad - 0.5f) + 1;
+    p->ly = olivec_floorf_clamped(ly - pad - 0.5f) + 1;
+    p->hx = olivec_floorf_clamped(hx + pad - 0.5f);
+    p->hy = olivec_floorf_clamped(hy + pad - 0.5f);
 }
 
-OLIVECDEF uint32_t mix_colors3(uint32_t c1, uint32_t c2, uint32_t c3, int u1, int u2, int det)
+OLIVECDEF void olivec_stroke_piece_edge(Olivec_Stroke_Piece *p, float ex, float ey, float ec)
 {
-    // TODO: estimate how much overflows are an issue in integer only environment
-    int64_t r1 = OLIVEC_RED(c1);
-    int64_t g1 = OLIVEC_GREEN(c1);
-    int64_t b1 = OLIVEC_BLUE(c1);
-    int64_t a1 = OLIVEC_ALPHA(c1);
+    int i = p->en++;
+    p->ex[i] = ex;
+    p->ey[i] = ey;
+    p->ec[i] = ec;
+    p->inv_ex[i] = ex != 0 ? 1/ex : 0;
+}
 
-    int64_t r2 = OLIVEC_RED(c2);
-    int64_t g2 = OLIVEC_GREEN(c2);
-    int64_t b2 = OLIVEC_BLUE(c2);
-    int64_t a2 = OLIVEC_ALPHA(c2);
+OLIVECDEF void olivec_stroke_body(Olivec_Stroke_Piece *p, Olivec_Point a, Olivec_Point b, Olivec_Stroke stroke, bool start, bool end)
+{
+    *p = (Olivec_Stroke_Piece) {0};
+    p->ax = a.x; p->ay = a.y;
+    p->bx = b.x; p->by = b.y;
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    p->len = olivec_sqrtf(dx*dx + dy*dy);
+    if (p->len > 0) {
+        p->dx = dx/p->len;
+        p->dy = dy/p->len;
+    } else {
+        p->dx = 1;
+    }
+    p->r = stroke.thickness/2;
+    p->round_a = start ? stroke.cap == OLIVEC_CAP_ROUND : stroke.join == OLIVEC_JOIN_ROUND;
+    p->round_b = end   ? stroke.cap == OLIVEC_CAP_ROUND : stroke.join == OLIVEC_JOIN_ROUND;
+    p->ext_a = start && stroke.cap == OLIVEC_CAP_SQUARE ? p->r : 0;
+    p->ext_b = end   && stroke.cap == OLIVEC_CAP_SQUARE ? p->r : 0;
+    olivec_stroke_piece_bbox(p,
+                             a.x < b.x ? a.x : b.x, a.y < b.y ? a.y : b.y,
+                             a.x > b.x ? a.x : b.x, a.y > b.y ? a.y : b.y,
+                             (p->ext_a > 0 || p->ext_b > 0 ? p->r*1.415f : p->r) + 0.5f);
+
+    // The band across the body and the ends along it, see olivec_stroke_piece_coverage()
+    float r = p->r + 0.5f;
+    float s = a.x*p->dy - a.y*p->dx;
+    float t = a.x*p->dx + a.y*p->dy;
+    olivec_stroke_piece_edge(p,  p->dy, -p->dx, r + s);
+    olivec_stroke_piece_edge(p, -p->dy,  p->dx, r - s);
+    olivec_stroke_piece_edge(p, -p->dx, -p->dy, (p->round_a ? r : p->ext_a + 0.5f) - t);
+    olivec_stroke_piece_edge(p,  p->dx,  p->dy, p->len + (p->round_b ? r : p->ext_b + 0.5f) + t);
+}
 
-    int64_t r3 = OLIVEC_RED(c3);
-    int64_t g3 = OLIVEC_GREEN(c3);
-    int64_t b3 = OLIVEC_BLUE(c3);
-    int64_t a3 = OLIVEC_ALPHA(c3);
+// Join at b between the segments a..b and b..c. Returns false if the join doesn't need a piece.
+OLIVECDEF bool olivec_stroke_join(Olivec_Stroke_Piece *p, Olivec_Point a, Olivec_Point b, Olivec_Point c, Olivec_Stroke stroke)
+{
+    float d0x = b.x - a.x, d0y = b.y - a.y;
+    float d1x = c.x - b.x, d1y = c.y - b.y;
+    float l0 = olivec_sqrtf(d0x*d0x + d0y*d0y);
+    float l1 = olivec_sqrtf(d1x*d1x + d1y*d1y);
+    if (l0 <= 0 || l1 <= 0) return false;
+    d0x /= l0; d0y /= l0;
+    d1x /= l1; d1y /= l1;
+    float turn = d0x*d1y - d0y*d1x;
+    if (turn > -1e-6f && turn < 1e-6f) return false;
+
+    // The gap is on the outer side of the turn
+    float r = stroke.thickness/2;
+    float side = turn > 0 ? -1 : 1;
+    float n0x = -d0y*side, n0y = d0x*side;
+    float n1x = -d1y*side, n1y = d1x*side;
+    float vx[4], vy[4];
+    int n = 0;
+    vx[n] = b.x;         vy[n] = b.y;         n++;
+    vx[n] = b.x + n0x*r; vy[n] = b.y + n0y*r; n++;
+    if (stroke.join == OLIVEC_JOIN_MITER) {
+        // The tip is on the bisector of the normals at the distance r/cos(half of the angle between them)
+        float mx = n0x + n1x, my = n0y + n1y;
+        float cos_half = olivec_sqrtf(mx*mx + my*my)/2;
+        if (cos_half > 0 && 1/cos_half <= OLIVEC_MITER_LIMIT) {
+            float k = r/(2*cos_half*cos_half);
+            vx[n] = b.x + mx*k; vy[n] = b.y + my*k; n++;
+        }
+    }
+    vx[n] = b.x + n1x*r; vy[n] = b.y + n1y*r; n++;
+
+    *p = (Olivec_Stroke_Piece) {0};
+    p->is_polygon = true;
+    p->n = n;
+    float area = 0;
+    for (int i = 0; i < n; ++i) {
+        int j = (i + 1)%n;
+        area += vx[i]*vy[j] - vx[j]*vy[i];
+    }
+    float lx = vx[0], hx = vx[0], ly = vy[0], hy = vy[0];
+    for (int i = 0; i < n; ++i) {
+        int j = (i + 1)%n;
+        float ex = vx[j] - vx[i], ey = vy[j] - vy[i];
+        float el = olivec_sqrtf(ex*ex + ey*ey);
+        if (el <= 0) el = 1;
+        // With positive area the inside is to the left of every edge
+        float nx = ey/el, ny = -ex/el;
+        if (area < 0) {
+            nx = -nx;
+            ny = -ny;
+        }
+        p->nx[i] = nx;
+        p->ny[i] = ny;
+        p->c[i] = nx*vx[i] + ny*vy[i];
+        olivec_stroke_piece_edge(p, nx, ny, p->c[i] + 0.5f);
+        if (vx[i] < lx) lx = vx[i];
+        if (vx[i] > hx) hx = vx[i];
+        if (vy[i] < ly) ly = vy[i];
+        if (vy[i] > hy) hy = vy[i];
+    }
+    olivec_stroke_piece_bbox(p, lx, ly, hx, hy, 0.5f);
+    return true;
+}
 
-    if (det != 0) {
-        int u3 = det - u1 - u2;
-        int64_t r4 = (r1*u1 + r2*u2 + r3*u3)/det;
-        int64_t g4 = (g1*u1 + g2*u2 + g3*u3)/det;
-        int64_t b4 = (b1*u1 + b2*u2 + b3*u3)/det;
-        int64_t a4 = (a1*u1 + a2*u2 + a3*u3)/det;
+OLIVECDEF float olivec_stroke_piece_coverage(const Olivec_Stroke_Piece *p, int x, int y)
+{
+    if (x < p->lx || x > p->hx || y < p->ly || y > p->hy) return 0;
+    float cx = x + 0.5f;
+    float cy = y + 0.5f;
+    if (p->is_polygon) {
+        float d = -1e30f;
+        for (int i = 0; i < p->n; ++i) {
+            float e = p->nx[i]*cx + p->ny[i]*cy - p->c[i];
+            if (e > d) d = e;
+        }
+        return olivec_clamp01(0.5f - d);
+    }
 
-        return OLIVEC_RGBA(r4, g4, b4, a4);
+    float px = cx - p->ax;
+    float py = cy - p->ay;
+    float t = px*p->dx + py*p->dy;
+    if ((t < 0 && p->round_a) || (t > p->len && p->round_b)) {
+        if (t > 0) {
+            px = cx - p->bx;
+            py = cy - p->by;
+        }
+        // Most of the pixels are either completely outside or inside of the rounded end
+        float d2 = px*px + py*py;
+        float outer = p->r + 0.5f;
+        if (d2 >= outer*outer) return 0;
+        float inner = p->r - 0.5f;
+        if (inner > 0 && d2 <= inner*inner) return 1;
+        return olivec_band_coverage(olivec_sqrtf(d2), p->r);
     }
+    float coverage = olivec_band_coverage(px*p->dy - py*p->dx, p->r);
+    if (!p->round_a) coverage *= olivec_clamp01(t + p->ext_a + 0.5f);
+    if (!p->round_b) coverage *= olivec_clamp01(p->len - t + p->ext_b + 0.5f);
+    return coverage;
+}
 
-    return 0;
+// Pixels x1..x2 of the row y outside of which the coverage of the piece is zero
+OLIVECDEF bool olivec_stroke_piece_span(const Olivec_Stroke_Piece *p, int y, int *x1, int *x2)
+{
+    if (y < p->ly || y > p->hy) return false;
+    float l = p->lx;
+    float h = p->hx + 1;
+    float cy = y + 0.5f;
+    for (int i = 0; i < p->en; ++i) {
+        float rhs = p->ec[i] - p->ey[i]*cy;
+        if (p->ex[i] > 0) {
+            float x = rhs*p->inv_ex[i];
+            if (x < h) h = x;
+        } else if (p->ex[i] < 0) {
+            float x = rhs*p->inv_ex[i];
+            if (x > l) l = x;
+        } else if (rhs <= 0) {
+            return false;
+        }
+    }
+    if (l > h) return false;
+
+    // A pixel of slack on both sides absorbs the rounding
+    int a = olivec_floorf_clamped(l - 0.5f);
+    int b = olivec_floorf_clamped(h - 0.5f) + 1;
+    if (a < p->lx) a = p->lx;
+    if (b > p->hx) b = p->hx;
+    if (a > b) return false;
+    *x1 = a;
+    *x2 = b;
+    return true;
 }
 
-// NOTE: we imply u3 = det - u1 - u2
-OLIVECDEF bool olivec_barycentric(int x1, int y1, int x2, int y2, int x3, int y3, int xp, int yp, int *u1, int *u2, int *det)
+// Walks the pieces of a polyline. Runs of points that stay within OLIVEC_STROKE_TOLERANCE pixels
+// from a straight segment are merged into that segment, which keeps dense polylines (like charts
+// with more points than pixels) from evaluating the same pixels over and over.
+//
+// Every OLIVEC_STROKE_BLOCK-th point always ends a run. So the pieces of a block of points only depend
+// on the points of the block and the ones right after it, and olivec_stroke_iter_block() walks them
+// without going through the whole polyline before the block.
+#ifndef OLIVEC_STROKE_TOLERANCE
+#define OLIVEC_STROKE_TOLERANCE (1.0f/32)
+#endif
+#ifndef OLIVEC_STROKE_BLOCK
+#define OLIVEC_STROKE_BLOCK 64
+#endif
+#define OLIVEC_STROKE_EPSILON 1e-4f
+
+typedef struct {
+    const Olivec_Point *points;
+    size_t count;
+    size_t next;            // Index of the first point after the window
+    size_t end;             // The walk stops when w[0] gets to the point with this index
+    Olivec_Point w[3];      // Window of the points of the current segment w[0]..w[1] and the one after it
+    size_t wi[3];           // Indices of the points of the window
+    size_t wn;
+    size_t segment;
+    bool join;              // The next piece is the join at w[1]
+    Olivec_Stroke stroke;
+} Olivec_Stroke_Iter;
+
+// Finds the end of the segment that starts at last. Every point within the tolerance from the line
+// through last narrows the cone of the directions the segment may take, the run ends on the first
+// point outside of the cone or closer to last than the current end.
+OLIVECDEF bool olivec_stroke_iter_point(Olivec_Stroke_Iter *it, Olivec_Point last, Olivec_Point *point, size_t *index)
+{
+    bool found = false;
+    bool has_cone = false;
+    float lx = 0, ly = 0, rx = 0, ry = 0;
+    float max_d2 = 0;
+    while (it->next < it->count) {
+        Olivec_Point p = it->points[it->next];
+        bool block_start = it->next%OLIVEC_STROKE_BLOCK == 0;
+        float vx = p.x - last.x;
+        float vy = p.y - last.y;
+        float d2 = vx*vx + vy*vy;
+        if (d2 <= OLIVEC_STROKE_EPSILON*OLIVEC_STROKE_EPSILON && !block_start) {
+            it->next += 1;
+            continue;
+        }
+        if (found) {
+            if (d2 < max_d2) break;
+            if (has_cone && (rx*vy - ry*vx < 0 || vx*ly - vy*lx < 0)) break;
+        }
+        *point = p;
+        *index = it->next;
+        found = true;
+        max_d2 = d2;
+        it->next += 1;
+        if (block_start) break;
+
+        if (d2 > OLIVEC_STROKE_TOLERANCE*OLIVEC_STROKE_TOLERANCE) {
+            // The directions that pass within the tolerance from p
+            float d = olivec_sqrtf(d2);
+            float ux = vx/d, uy = vy/d;
+            float s = OLIVEC_STROKE_TOLERANCE/d;
+            float c = olivec_sqrtf(1 - s*s);
+            float plx = c*ux - s*uy, ply = s*ux + c*uy;
+            float prx = c*ux + s*uy, pry = -s*ux + c*uy;
+            if (!has_cone || plx*ly - ply*lx > 0) {
+                lx = plx;
+                ly = ply;
+            }
+            if (!has_cone || rx*pry - ry*prx > 0) {
+                rx = prx;
+                ry = pry;
+            }
+            has_cone = true;
+        }
+    }
+    return found;
+}
+
+OLIVECDEF Olivec_Stroke_Iter olivec_stroke_iter(const Olivec_Point *points, size_t count, Olivec_Stroke stroke)
+{
+    Olivec_Stroke_Iter it = {0};
+    it.points = points;
+    it.count = count;
+    it.end = count;
+    it.stroke = stroke;
+    if (count == 0) return it;
+    it.w[0] = points[0];
+    it.next = 1;
+    it.wn = 1;
+    if (olivec_stroke_iter_point(&it, it.w[0], &it.w[1], &it.wi[1])) {
+        it.wn = 2;
+        if (olivec_stroke_iter_point(&it, it.w[1], &it.w[2], &it.wi[2])) it.wn = 3;
+    } else {
+        // A single point is a zero length segment which still gets its caps
+        it.w[1] = it.w[0];
+        it.wn = 2;
+    }
+    return it;
+}
+
+// Number of the blocks of points of a polyline. The last point of a block is the first one of the next block.
+OLIVECDEF size_t olivec_stroke_blocks(size_t count)
+{
+    if (count <= 1) return count;
+    return (count - 2)/OLIVEC_STROKE_BLOCK + 1;
+}
+
+// The pieces of the block: from its first point up to the join at its last point.
+// The walk over all the blocks one after another gives the same pieces as olivec_stroke_iter().
+OLIVECDEF Olivec_Stroke_Iter olivec_stroke_iter_block(const Olivec_Point *points, size_t count, Olivec_Stroke stroke, size_t block)
+{
+    size_t start = block*OLIVEC_STROKE_BLOCK;
+    if (start == 0) {
+        Olivec_Stroke_Iter it = olivec_stroke_iter(points, count, stroke);
+        it.end = OLIVEC_STROKE_BLOCK;
+        return it;
+    }
+
+    Olivec_Stroke_Iter it = {0};
+    it.points = points;
+    it.count = count;
+    it.end = start + OLIVEC_STROKE_BLOCK;
+    it.stroke = stroke;
+    it.segment = 1;
+    if (start >= count) return it;
+    it.w[0] = points[start];
+    it.wi[0] = start;
+    it.next = start + 1;
+    // Nothing after the first point means that the previous block already ended the polyline there
+    if (olivec_stroke_iter_point(&it, it.w[0], &it.w[1], &it.wi[1])) {
+        it.wn = 2;
+        if (olivec_stroke_iter_point(&it, it.w[1], &it.w[2], &it.wi[2])) it.wn = 3;
+    }
+    return it;
+}
+
+OLIVECDEF bool olivec_stroke_iter_next(Olivec_Stroke_Iter *it, Olivec_Stroke_Piece *piece)
+{
+    for (;;) {
+        if (it->wn < 2 || it->wi[0] >= it->end) return false;
+        if (!it->join) {
+            olivec_stroke_body(piece, it->w[0], it->w[1], it->stroke, it->segment == 0, it->wn == 2);
+            it->join = true;
+            return true;
+        }
+
+        bool joined = false;
+        if (it->wn == 3 && it->stroke.join != OLIVEC_JOIN_ROUND) {
+            joined = olivec_stroke_join(piece, it->w[0], it->w[1], it->w[2], it->stroke);
+        }
+        it->w[0] = it->w[1];
+        it->w[1] = it->w[2];
+        it->wi[0] = it->wi[1];
+        it->wi[1] = it->wi[2];
+        if (it->wn == 3 && !olivec_stroke_iter_point(it, it->w[1], &it->w[2], &it->wi[2])) it->wn = 2;
+        else if (it->wn == 2) it->wn = 0;
+        it->segment += 1;
+        it->join = false;
+        if (joined) return true;
+    }
+}
+
+// How far the pieces may reach from the polyline through the points: square caps, miter tips,
+// the merging tolerance and the anti-aliasing
+OLIVECDEF float olivec_stroke_reach(Olivec_Stroke stroke)
+{
+    float r = stroke.thickness/2;
+    return r*(OLIVEC_MITER_LIMIT > 1.5f ? OLIVEC_MITER_LIMIT : 1.5f) + 1;
+}
+
+// The coverage of the pieces is combined with max() in a buffer of OLIVEC_STROKE_TILE x OLIVEC_STROKE_TILE
+// pixels on the stack and only after that blended onto the canvas. Every tile collects all the pieces
+// that touch it, so every pixel is blended exactly once, no matter how many times the path comes back to it.
+#ifndef OLIVEC_STROKE_TILE
+#define OLIVEC_STROKE_TILE 64
+#endif
+
+// The canvas is split into at most OLIVEC_STROKE_STRIPS columns of tiles. The first pass finds the range
+// of the blocks and the rows that every strip needs, so the tiles of a strip only walk the blocks of that
+// range and only the blocks near the tile are turned into pieces.
+#ifndef OLIVEC_STROKE_STRIPS
+#define OLIVEC_STROKE_STRIPS 32
+#endif
+
+// Bounding box of the points of the block
+OLIVECDEF void olivec_stroke_block_bbox(const Olivec_Point *points, size_t count, size_t block, float *lx, float *ly, float *hx, float *hy)
+{
+    size_t start = block*OLIVEC_STROKE_BLOCK;
+    size_t end = start + OLIVEC_STROKE_BLOCK < count - 1 ? start + OLIVEC_STROKE_BLOCK : count - 1;
+    *lx = *hx = points[start].x;
+    *ly = *hy = points[start].y;
+    for (size_t i = start + 1; i <= end; ++i) {
+        if (points[i].x < *lx) *lx = points[i].x;
+        if (points[i].x > *hx) *hx = points[i].x;
+        if (points[i].y < *ly) *ly = points[i].y;
+        if (points[i].y > *hy) *hy = points[i].y;
+    }
+}
+
+OLIVECDEF void olivec_polyline_aa(Olivec_Canvas oc, const Olivec_Point *points, size_t count, Olivec_Stroke stroke, uint32_t color)
+{
+    if (stroke.thickness <= 0 || count == 0 || oc.width == 0 || oc.height == 0) return;
+    float reach = olivec_stroke_reach(stroke);
+    size_t blocks = olivec_stroke_blocks(count);
+
+    int tiles = (oc.width + OLIVEC_STROKE_TILE - 1)/OLIVEC_STROKE_TILE;
+    int strip_width = OLIVEC_STROKE_TILE*((tiles + OLIVEC_STROKE_STRIPS - 1)/OLIVEC_STROKE_STRIPS);
+    int strips = (oc.width + strip_width - 1)/strip_width;
+    size_t first[OLIVEC_STROKE_STRIPS], last[OLIVEC_STROKE_STRIPS];
+    int strip_ly[OLIVEC_STROKE_STRIPS], strip_hy[OLIVEC_STROKE_STRIPS];
+    for (int s = 0; s < strips; ++s) {
+        first[s] = blocks;
+        last[s] = 0;
+        strip_ly[s] = oc.height;
+        strip_hy[s] = -1;
+    }
+
+    // Rows of every strip that the segments between the points of a block may reach
+    for (size_t k = 0; k < blocks; ++k) {
+        size_t start = k*OLIVEC_STROKE_BLOCK;
+        size_t end = start + OLIVEC_STROKE_BLOCK < count - 1 ? start + OLIVEC_STROKE_BLOCK : count - 1;
+        for (size_t i = start; i <= end; ++i) {
+            if (i == end && end > start) break;
+            Olivec_Point p = points[i];
+            Olivec_Point q = i < end ? points[i + 1] : p;
+            float lx = p.x < q.x ? p.x : q.x;
+            float hx = p.x > q.x ? p.x : q.x;
+            int s1 = olivec_floorf_clamped(lx - reach);
+            int s2 = olivec_floorf_clamped(hx + reach);
+            if (s2 < 0 || s1 >= (int) oc.width) continue;
+            s1 = s1 > 0 ? s1/strip_width : 0;
+            s2 = s2 < (int) oc.width ? s2/strip_width : strips - 1;
+            for (int s = s1; s <= s2; ++s) {
+                // Part of the segment within the columns of the strip
+                float x1 = s*strip_width - reach;
+                float x2 = (s + 1)*strip_width + reach;
+                float t1 = 0, t2 = 1;
+                float dx = q.x - p.x;
+                if (dx != 0) {
+                    t1 = (x1 - p.x)/dx;
+                    t2 = (x2 - p.x)/dx;
+                    if (t1 > t2) {
+                        float t = t1;
+                        t1 = t2;
+                        t2 = t;
+                    }
+                    if (t1 < 0) t1 = 0;
+                    if (t2 > 1) t2 = 1;
+                    if (t1 > t2) continue;
+                }
+                float y1 = p.y + (q.y - p.y)*t1;
+                float y2 = p.y + (q.y - p.y)*t2;
+                int ly = olivec_floorf_clamped((y1 < y2 ? y1 : y2) - reach);
+                int hy = olivec_floorf_clamped((y1 > y2 ? y1 : y2) + reach);
+                if (ly < 0) ly = 0;
+                if (hy >= (int) oc.height) hy = oc.height - 1;
+                if (ly > hy) continue;
+                if (k < first[s]) first[s] = k;
+                last[s] = k;
+                if (ly < strip_ly[s]) strip_ly[s] = ly;
+                if (hy > strip_hy[s]) strip_hy[s] = hy;
+            }
+        }
+    }
+
+    uint8_t coverage[OLIVEC_STROKE_TILE*OLIVEC_STROKE_TILE];
+    for (int s = 0; s < strips; ++s) {
+        if (first[s] > last[s]) continue;
+        int sx1 = s*strip_width;
+        int sx2 = sx1 + strip_width - 1 < (int) oc.width - 1 ? sx1 + strip_width - 1 : (int) oc.width - 1;
+        olivec_damage(oc, sx1, strip_ly[s], sx2 - sx1 + 1, strip_hy[s] - strip_ly[s] + 1);
+
+        for (int ty = strip_ly[s]; ty <= strip_hy[s]; ty += OLIVEC_STROKE_TILE) {
+            int th = strip_hy[s] - ty + 1 < OLIVEC_STROKE_TILE ? strip_hy[s] - ty + 1 : OLIVEC_STROKE_TILE;
+            for (int tx = sx1; tx <= sx2; tx += OLIVEC_STROKE_TILE) {
+                int tw = sx2 - tx + 1 < OLIVEC_STROKE_TILE ? sx2 - tx + 1 : OLIVEC_STROKE_TILE;
+
+                // Columns touched on every row of the tile. Coverage is only cleared within them.
+                int row_x1[OLIVEC_STROKE_TILE], row_x2[OLIVEC_STROKE_TILE];
+                for (int i = 0; i < th; ++i) {
+                    row_x1[i] = tw;
+                    row_x2[i] = -1;
+                }
+
+                for (size_t k = first[s]; k <= last[s]; ++k) {
+                    float blx, bly, bhx, bhy;
+                    olivec_stroke_block_bbox(points, count, k, &blx, &bly, &bhx, &bhy);
+                    if (bhx + reach < tx || blx - reach > tx + tw || bhy + reach < ty || bly - reach > ty + th) continue;
+
+                    Olivec_Stroke_Iter it = olivec_stroke_iter_block(points, count, stroke, k);
+                    Olivec_Stroke_Piece p;
+                    while (olivec_stroke_iter_next(&it, &p)) {
+                        if (p.hx < tx || p.lx > tx + tw - 1) continue;
+                        int y1 = p.ly > ty ? p.ly : ty;
+                        int y2 = p.hy < ty + th - 1 ? p.hy : ty + th - 1;
+                        for (int y = y1; y <= y2; ++y) {
+                            int x1, x2;
+                            if (!olivec_stroke_piece_span(&p, y, &x1, &x2)) continue;
+                            x1 = x1 > tx ? x1 - tx : 0;
+                            x2 = x2 < tx + tw - 1 ? x2 - tx : tw - 1;
+                            if (x1 > x2) continue;
+
+                            uint8_t *row = &coverage[(y - ty)*tw];
+                            int *r1 = &row_x1[y - ty], *r2 = &row_x2[y - ty];
+                            if (*r1 > *r2) {
+                                for (int x = x1; x <= x2; ++x) row[x] = 0;
+                                *r1 = x1;
+                                *r2 = x2;
+                            } else {
+                                for (int x = x1; x < *r1; ++x) row[x] = 0;
+                                for (int x = *r2 + 1; x <= x2; ++x) row[x] = 0;
+                                if (x1 < *r1) *r1 = x1;
+                                if (x2 > *r2) *r2 = x2;
+                            }
+
+                            for (int x = x1; x <= x2; ++x) {
+                                uint8_t c = olivec_stroke_piece_coverage(&p, tx + x, y)*255 + 0.5f;
+                                if (row[x] < c) row[x] = c;
+                            }
+                        }
+                    }
+                }
+
+                for (int y = ty; y < ty + th; ++y) {
+                    for (int x = tx + row_x1[y - ty]; x <= tx + row_x2[y - ty]; ++x) {
+                        uint8_t c = coverage[(y - ty)*tw + (x - tx)];
+                        if (c == 0) continue;
+                        uint32_t alpha = OLIVEC_ALPHA(color)*c/255;
+                        olivec_blend_color(&OLIVEC_PIXEL(oc, x, y), (color&0x00FFFFFF)|(alpha<<(3*8)));
+                    }
+                }
+            }
+        }
+    }
+}
+
+OLIVECDEF void olivec_line_aa(Olivec_Canvas oc, float x1, float y1, float x2, float y2, Olivec_Stroke stroke, uint32_t color)
+{
+    Olivec_Point points[] = {{x1, y1}, {x2, y2}};
+    olivec_polyline_aa(oc, points, 2, stroke, color);
+}
+
+OLIVECDEF uint32_t mix_colors2(uint32_t c1, uint32_t c2, int u1, int det)
+{
+    // TODO: estimate how much overflows are an issue in integer only environment
+    int64_t r1 = OLIVEC_RED(c1);
+    int64_t g1 = OLIVEC_GREEN(c1);
+    int64_t b1 = OLIVEC_BLUE(c1);
+    int64_t a1 = OLIVEC_ALPHA(c1);
+
+    int64_t r2 = OLIVEC_RED(c2);
+    int64_t g2 = OLIVEC_GREEN(c2);
+    int64_t b2 = OLIVEC_BLUE(c2);
+    int64_t a2 = OLIVEC_ALPHA(c2);
+
+    if (det != 0) {
+        int u2 = det - u1;
+        int64_t r4 = (r1*u2 + r2*u1)/det;
+        int64_t g4 = (g1*u2 + g2*u1)/det;
+        int64_t b4 = (b1*u2 + b2*u1)/det;
+        int64_t a4 = (a1*u2 + a2*u1)/det;
+
+        return OLIVEC_RGBA(r4, g4, b4, a4);
+    }
+
+    return 0;
+}
+
+OLIVECDEF uint32_t mix_colors3(uint32_t c1, uint32_t c2, uint32_t c3, int u1, int u2, int det)
+{
+    // TODO: estimate how much overflows are an issue in integer only environment
+    int64_t r1 = OLIVEC_RED(c1);
+    int64_t g1 = OLIVEC_GREEN(c1);
+    int64_t b1 = OLIVEC_BLUE(c1);
+    int64_t a1 = OLIVEC_ALPHA(c1);
+
+    int64_t r2 = OLIVEC_RED(c2);
+    int64_t g2 = OLIVEC_GREEN(c2);
+    int64_t b2 = OLIVEC_BLUE(c2);
+    int64_t a2 = OLIVEC_ALPHA(c2);
+
+    int64_t r3 = OLIVEC_RED(c3);
+    int64_t g3 = OLIVEC_GREEN(c3);
+    int64_t b3 = OLIVEC_BLUE(c3);
+    int64_t a3 = OLIVEC_ALPHA(c3);
+
+    if (det != 0) {
+        int u3 = det - u1 - u2;
+        int64_t r4 = (r1*u1 + r2*u2 + r3*u3)/det;
+        int64_t g4 = (g1*u1 + g2*u2 + g3*u3)/det;
+        int64_t b4 = (b1*u1 + b2*u2 + b3*u3)/det;
+        int64_t a4 = (a1*u1 + a2*u2 + a3*u3)/det;
+
+        return OLIVEC_RGBA(r4, g4, b4, a4);
+    }
+
+    return 0;
+}
+
+// NOTE: we imply u3 = det - u1 - u2
+OLIVECDEF bool olivec_barycentric(int x1, int y1, int x2, int y2, int x3, int y3, int xp, int yp, int *u1, int *u2, int *det)
 {
     *det = ((x1 - x3)*(y2 - y3) - (x2 - x3)*(y1 - y3));
     *u1  = ((y2 - y3)*(xp - x3) + (x3 - x2)*(yp - y3));
@@ -781,241 +2249,1727 @@ OLIVECDEF bool olivec_normalize_triangle(size_t width, size_t height, int x1, in
     return true;
 }
 
-OLIVECDEF void olivec_triangle3c(Olivec_Canvas oc, int x1, int y1, int x2, int y2, int x3, int y3,
-                                 uint32_t c1, uint32_t c2, uint32_t c3)
+// Narrows [lo, hi] down to the values of t for which a + b*t >= 0. Returns false if none are left.
+OLIVECDEF bool olivec_clip_edge(int64_t a, int64_t b, int64_t *lo, int64_t *hi)
 {
-    int lx, hx, ly, hy;
-    if (olivec_normalize_triangle(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &lx, &hx, &ly, &hy)) {
-        for (int y = ly; y <= hy; ++y) {
-            for (int x = lx; x <= hx; ++x) {
-                int u1, u2, det;
-                if (olivec_barycentric(x1, y1, x2, y2, x3, y3, x, y, &u1, &u2, &det)) {
-                    olivec_blend_color(&OLIVEC_PIXEL(oc, x, y), mix_colors3(c1, c2, c3, u1, u2, det));
+    if (b == 0) return a >= 0;
+    if (b > 0) {
+        int64_t t = olivec_div_ceil(-a, b);
+        if (*lo < t) *lo = t;
+    } else {
+        int64_t t = olivec_div_floor(a, -b);
+        if (*hi > t) *hi = t;
+    }
+    return *lo <= *hi;
+}
+
+OLIVECDEF bool olivec_triangle_raster(size_t width, size_t height, int x1, int y1, int x2, int y2, int x3, int y3, Olivec_Triangle_Raster *tr)
+{
+    if (!olivec_normalize_triangle(width, height, x1, y1, x2, y2, x3, y3, &tr->lx, &tr->hx, &tr->ly, &tr->hy)) return false;
+    tr->det = ((x1 - x3)*(y2 - y3) - (x2 - x3)*(y1 - y3));
+    tr->du1_dx = y2 - y3;
+    tr->du1_dy = x3 - x2;
+    tr->du2_dx = y3 - y1;
+    tr->du2_dy = x1 - x3;
+    tr->u1 = (int64_t)tr->du1_dx*(tr->lx - x3) + (int64_t)tr->du1_dy*(tr->ly - y3);
+    tr->u2 = (int64_t)tr->du2_dx*(tr->lx - x3) + (int64_t)tr->du2_dy*(tr->ly - y3);
+    return true;
+}
+
+OLIVECDEF bool olivec_triangle_raster_span(const Olivec_Triangle_Raster *tr, int y, int *lx, int *hx, int *u1, int *u2)
+{
+    int64_t dy = y - tr->ly;
+    int64_t e1 = tr->u1 + tr->du1_dy*dy;
+    int64_t e2 = tr->u2 + tr->du2_dy*dy;
+    int64_t e3 = tr->det - e1 - e2;
+    int64_t d1 = tr->du1_dx;
+    int64_t d2 = tr->du2_dx;
+    int64_t d3 = -d1 - d2;
+
+    // olivec_barycentric() accepts a pixel when every edge function has the sign of det or is zero.
+    // Along the row each of them is linear in x, so the accepted pixels form a single interval.
+    int64_t lo = 0, hi = tr->hx - tr->lx;
+    int s = OLIVEC_SIGN(int, tr->det);
+    for (int k = -1; k <= 1; k += 2) {
+        // Degenerate triangle with det == 0 wants all of the edge functions to be exactly zero
+        if (s != 0 && k != s) continue;
+        if (!olivec_clip_edge(k*e1, k*d1, &lo, &hi)) return false;
+        if (!olivec_clip_edge(k*e2, k*d2, &lo, &hi)) return false;
+        if (!olivec_clip_edge(k*e3, k*d3, &lo, &hi)) return false;
+    }
+
+    *lx = tr->lx + lo;
+    *hx = tr->lx + hi;
+    *u1 = e1 + d1*lo;
+    *u2 = e2 + d2*lo;
+    return true;
+}
+
+OLIVECDEF bool olivec_varyings(const Olivec_Triangle_Raster *tr, const float *v1, const float *v2, const float *v3, size_t count, Olivec_Varyings *vs)
+{
+    if (tr->det == 0) return false;
+    if (count > OLIVEC_MAX_VARYINGS) count = OLIVEC_MAX_VARYINGS;
+    vs->count = count;
+    float det = tr->det;
+    for (size_t k = 0; k < count; ++k) {
+        vs->v3[k] = v3[k];
+        vs->d1[k] = (v1[k] - v3[k])/det;
+        vs->d2[k] = (v2[k] - v3[k])/det;
+        vs->dx[k] = vs->d1[k]*tr->du1_dx + vs->d2[k]*tr->du2_dx;
+    }
+    return true;
+}
+
+OLIVECDEF void olivec_varyings_span(const Olivec_Varyings *vs, int u1, int u2, float *v)
+{
+    for (size_t k = 0; k < vs->count; ++k) {
+        v[k] = vs->v3[k] + vs->d1[k]*u1 + vs->d2[k]*u2;
+    }
+}
+
+OLIVECDEF void olivec_triangle_varyings(Olivec_Canvas oc, int x1, int y1, int x2, int y2, int x3, int y3,
+                                        const float *v1, const float *v2, const float *v3, size_t count,
+                                        bool perspective, Olivec_Shader shader, void *data)
+{
+    Olivec_Triangle_Raster tr = {0};
+    Olivec_Varyings vs;
+    if (!olivec_triangle_raster(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &tr)) return;
+    olivec_damage(oc, tr.lx, tr.ly, tr.hx - tr.lx + 1, tr.hy - tr.ly + 1);
+    if (!olivec_varyings(&tr, v1, v2, v3, count, &vs)) return;
+    count = vs.count;
+    perspective = perspective && count > 0;
+
+    float v[OLIVEC_MAX_VARYINGS];
+    float pv[OLIVEC_MAX_VARYINGS];
+    for (int y = tr.ly; y <= tr.hy; ++y) {
+        int lx, hx, u1, u2;
+        if (!olivec_triangle_raster_span(&tr, y, &lx, &hx, &u1, &u2)) continue;
+        olivec_varyings_span(&vs, u1, u2, v);
+        uint32_t *pixel = &OLIVEC_PIXEL(oc, lx, y);
+        for (int x = lx; x <= hx; ++x, ++pixel) {
+            const float *varyings = v;
+            if (perspective) {
+                float r = 1/v[0];
+                pv[0] = v[0];
+                for (size_t k = 1; k < count; ++k) pv[k] = v[k]*r;
+                varyings = pv;
+            }
+            uint32_t color;
+            if (shader(data, x, y, varyings, &color)) *pixel = color;
+            for (size_t k = 0; k < count; ++k) v[k] += vs.dx[k];
+        }
+    }
+}
+
+OLIVECDEF Olivec_Depth_Buffer olivec_depth_buffer(float *values, size_t width, size_t height, size_t stride)
+{
+    Olivec_Depth_Buffer db = {
+        .values = values,
+        .width  = width,
+        .height = height,
+        .stride = stride,
+    };
+    return db;
+}
+
+OLIVECDEF Olivec_Depth_Buffer olivec_depth_buffer16(uint16_t *values, size_t width, size_t height, size_t stride)
+{
+    Olivec_Depth_Buffer db = {
+        .values16 = values,
+        .width    = width,
+        .height   = height,
+        .stride   = stride,
+    };
+    return db;
+}
+
+OLIVECDEF Olivec_Depth_Buffer olivec_depth_buffer_tiles(Olivec_Depth_Buffer db, Olivec_Depth_Tile *tiles)
+{
+    db.tiles = tiles;
+    size_t n = OLIVEC_DEPTH_TILES(db.width, db.height);
+    for (size_t i = 0; i < n; ++i) tiles[i].stale = true;
+    return db;
+}
+
+OLIVECDEF uint16_t olivec_depth16(float depth)
+{
+    return olivec_clamp01(depth)*65535 + 0.5f;
+}
+
+// Depth in the units of the stored values
+OLIVECDEF float olivec_depth_value(const Olivec_Depth_Buffer *db, float depth)
+{
+    return db->values16 ? olivec_depth16(depth) : depth;
+}
+
+OLIVECDEF float olivec_depth_clamp(float depth, float lo, float hi)
+{
+    return depth < lo ? lo : depth > hi ? hi : depth;
+}
+
+OLIVECDEF void olivec_depth_clear(Olivec_Depth_Buffer db, float depth)
+{
+    for (size_t y = 0; y < db.height; ++y) {
+        if (db.values16) {
+            uint16_t d = olivec_depth16(depth);
+            uint16_t *row = &db.values16[y*db.stride];
+            for (size_t x = 0; x < db.width; ++x) row[x] = d;
+        } else {
+            float *row = &db.values[y*db.stride];
+            for (size_t x = 0; x < db.width; ++x) row[x] = depth;
+        }
+    }
+
+    if (db.tiles) {
+        float d = olivec_depth_value(&db, depth);
+        size_t n = OLIVEC_DEPTH_TILES(db.width, db.height);
+        for (size_t i = 0; i < n; ++i) {
+            db.tiles[i].min = d;
+            db.tiles[i].max = d;
+            db.tiles[i].stale = false;
+        }
+    }
+}
+
+OLIVECDEF bool olivec_depth_compare(Olivec_Depth_Func func, float depth, float stored)
+{
+    switch (func) {
+    case OLIVEC_DEPTH_GREATER: return depth > stored;
+    case OLIVEC_DEPTH_GEQUAL:  return depth >= stored;
+    case OLIVEC_DEPTH_LESS:    return depth < stored;
+    case OLIVEC_DEPTH_LEQUAL:  return depth <= stored;
+    case OLIVEC_DEPTH_ALWAYS:
+    default:                   return true;
+    }
+}
+
+// Depth test of the i-th value of the buffer. The depth is stored only if store is set.
+OLIVECDEF bool olivec_depth_test_at(const Olivec_Depth_Buffer *db, size_t i, float depth, bool store)
+{
+    if (db->values16) {
+        uint16_t d = olivec_depth16(depth);
+        if (!olivec_depth_compare(db->func, d, db->values16[i])) return false;
+        if (store) db->values16[i] = d;
+    } else {
+        if (!olivec_depth_compare(db->func, depth, db->values[i])) return false;
+        if (store) db->values[i] = depth;
+    }
+    return true;
+}
+
+OLIVECDEF Olivec_Depth_Tile *olivec_depth_tile(const Olivec_Depth_Buffer *db, int x, int y)
+{
+    size_t tiles_per_row = (db->width + OLIVEC_DEPTH_TILE - 1)/OLIVEC_DEPTH_TILE;
+    return &db->tiles[(y/OLIVEC_DEPTH_TILE)*tiles_per_row + x/OLIVEC_DEPTH_TILE];
+}
+
+// Whether the bounds of the tile let anything between lo and hi pass
+OLIVECDEF bool olivec_depth_tile_passes(Olivec_Depth_Func func, const Olivec_Depth_Tile *tile, float lo, float hi)
+{
+    switch (func) {
+    case OLIVEC_DEPTH_GREATER:
+    case OLIVEC_DEPTH_GEQUAL:
+        return olivec_depth_compare(func, hi, tile->min);
+    case OLIVEC_DEPTH_LESS:
+    case OLIVEC_DEPTH_LEQUAL:
+        return olivec_depth_compare(func, lo, tile->max);
+    case OLIVEC_DEPTH_ALWAYS:
+    default:
+        return true;
+    }
+}
+
+// Whether any depth between lo and hi, in the units of the stored values, may pass the depth test
+// somewhere within the tile of the pixel x, y. Always true without the tiles. A stale tile is only
+// rescanned when its loose bounds are not enough to reject the depths.
+OLIVECDEF bool olivec_depth_tile_visible(const Olivec_Depth_Buffer *db, int x, int y, float lo, float hi)
+{
+    if (db->tiles == NULL) return true;
+    Olivec_Depth_Tile *tile = olivec_depth_tile(db, x, y);
+    if (!olivec_depth_tile_passes(db->func, tile, lo, hi)) return false;
+    if (!tile->stale) return true;
+
+    size_t tx = x - x%OLIVEC_DEPTH_TILE;
+    size_t ty = y - y%OLIVEC_DEPTH_TILE;
+    size_t tw = db->width - tx < OLIVEC_DEPTH_TILE ? db->width - tx : OLIVEC_DEPTH_TILE;
+    size_t th = db->height - ty < OLIVEC_DEPTH_TILE ? db->height - ty : OLIVEC_DEPTH_TILE;
+    float min = db->values16 ? db->values16[ty*db->stride + tx] : db->values[ty*db->stride + tx];
+    float max = min;
+    for (size_t j = ty; j < ty + th; ++j) {
+        for (size_t i = tx; i < tx + tw; ++i) {
+            float d = db->values16 ? db->values16[j*db->stride + i] : db->values[j*db->stride + i];
+            if (d < min) min = d;
+            if (d > max) max = d;
+        }
+    }
+    tile->min = min;
+    tile->max = max;
+    tile->stale = false;
+    return olivec_depth_tile_passes(db->func, tile, lo, hi);
+}
+
+// Accounts for count depths between lo and hi, in the units of the stored values, written into the tile
+// of the pixel x, y. The bounds are widened to include them, which keeps them valid but loose, unless
+// the depths covered the entire tile and the bounds can be replaced by them.
+OLIVECDEF void olivec_depth_tile_store(const Olivec_Depth_Buffer *db, int x, int y, size_t count, float lo, float hi)
+{
+    if (db->tiles == NULL || count == 0) return;
+    Olivec_Depth_Tile *tile = olivec_depth_tile(db, x, y);
+    size_t tx = x - x%OLIVEC_DEPTH_TILE;
+    size_t ty = y - y%OLIVEC_DEPTH_TILE;
+    size_t tw = db->width - tx < OLIVEC_DEPTH_TILE ? db->width - tx : OLIVEC_DEPTH_TILE;
+    size_t th = db->height - ty < OLIVEC_DEPTH_TILE ? db->height - ty : OLIVEC_DEPTH_TILE;
+    if (count == tw*th) {
+        tile->min = lo;
+        tile->max = hi;
+        tile->stale = false;
+    } else {
+        if (lo < tile->min) tile->min = lo;
+        if (hi > tile->max) tile->max = hi;
+        tile->stale = true;
+    }
+}
+
+OLIVECDEF bool olivec_depth_test(Olivec_Depth_Buffer db, int x, int y, float depth)
+{
+    if (!olivec_depth_test_at(&db, y*db.stride + x, depth, true)) return false;
+    float d = olivec_depth_value(&db, depth);
+    olivec_depth_tile_store(&db, x, y, 1, d, d);
+    return true;
+}
+
+// The depth tested triangles are walked by the tiles of the depth buffer. The rows of a band of
+// OLIVEC_DEPTH_TILE rows are clipped to one tile at a time, the tile is tested against the depths of
+// all of its parts at once and its bounds are updated once after they are drawn.
+typedef struct {
+    int y, rows;
+    int lx, hx;
+    int span_lx[OLIVEC_DEPTH_TILE], span_hx[OLIVEC_DEPTH_TILE];
+    int span_u1[OLIVEC_DEPTH_TILE], span_u2[OLIVEC_DEPTH_TILE];
+
+    // Parts of the spans within the current tile, lx > hx for the empty ones, with the edge functions
+    // at lx and the range of their depths. The interpolated depths are clamped to the range, so rounding
+    // can't make a pixel pass where the tile says nothing does.
+    int part_lx[OLIVEC_DEPTH_TILE], part_hx[OLIVEC_DEPTH_TILE];
+    int part_u1[OLIVEC_DEPTH_TILE], part_u2[OLIVEC_DEPTH_TILE];
+    float part_lo[OLIVEC_DEPTH_TILE], part_hi[OLIVEC_DEPTH_TILE];
+    float lo, hi;
+} Olivec_Depth_Band;
+
+// Finds the spans of the band of rows starting at y and ending at the bottom of its tile row.
+// band->lx > band->hx when the band is empty.
+OLIVECDEF void olivec_depth_band(const Olivec_Triangle_Raster *tr, int y, Olivec_Depth_Band *band)
+{
+    int end = y - y%OLIVEC_DEPTH_TILE + OLIVEC_DEPTH_TILE - 1;
+    if (end > tr->hy) end = tr->hy;
+    band->y = y;
+    band->rows = end - y + 1;
+    band->lx = tr->hx + 1;
+    band->hx = tr->lx - 1;
+    for (int j = 0; j < band->rows; ++j) {
+        int lx, hx, u1 = 0, u2 = 0;
+        if (!olivec_triangle_raster_span(tr, y + j, &lx, &hx, &u1, &u2)) {
+            lx = 0;
+            hx = -1;
+        } else {
+            if (lx < band->lx) band->lx = lx;
+            if (hx > band->hx) band->hx = hx;
+        }
+        band->span_lx[j] = lx;
+        band->span_hx[j] = hx;
+        band->span_u1[j] = u1;
+        band->span_u2[j] = u2;
+    }
+}
+
+// Clips the spans of the band to the tile column starting at tx and finds the depths of the parts.
+// Returns false if nothing within the tile can pass the depth test.
+OLIVECDEF bool olivec_depth_band_tile(const Olivec_Depth_Buffer *db, const Olivec_Triangle_Raster *tr, const Olivec_Varyings *vs, Olivec_Depth_Band *band, int tx)
+{
+    bool empty = true;
+    band->lo = 0;
+    band->hi = 0;
+    for (int j = 0; j < band->rows; ++j) {
+        int lx = band->span_lx[j] > tx ? band->span_lx[j] : tx;
+        int hx = band->span_hx[j] < tx + OLIVEC_DEPTH_TILE - 1 ? band->span_hx[j] : tx + OLIVEC_DEPTH_TILE - 1;
+        band->part_lx[j] = lx;
+        band->part_hx[j] = hx;
+        if (lx > hx) continue;
+
+        int u1 = band->span_u1[j] + (lx - band->span_lx[j])*tr->du1_dx;
+        int u2 = band->span_u2[j] + (lx - band->span_lx[j])*tr->du2_dx;
+        band->part_u1[j] = u1;
+        band->part_u2[j] = u2;
+        float z1 = vs->v3[0] + vs->d1[0]*u1 + vs->d2[0]*u2;
+        u1 += (hx - lx)*tr->du1_dx;
+        u2 += (hx - lx)*tr->du2_dx;
+        float z2 = vs->v3[0] + vs->d1[0]*u1 + vs->d2[0]*u2;
+        float lo = z1 < z2 ? z1 : z2;
+        float hi = z1 < z2 ? z2 : z1;
+        band->part_lo[j] = lo;
+        band->part_hi[j] = hi;
+        if (empty || lo < band->lo) band->lo = lo;
+        if (empty || hi > band->hi) band->hi = hi;
+        empty = false;
+    }
+    if (empty) return false;
+    return olivec_depth_tile_visible(db, tx, band->y, olivec_depth_value(db, band->lo), olivec_depth_value(db, band->hi));
+}
+
+OLIVECDEF void olivec_triangle_depth(Olivec_Canvas oc, Olivec_Depth_Buffer db, int x1, int y1, int x2, int y2, int x3, int y3, float z1, float z2, float z3, uint32_t color)
+{
+    Olivec_Triangle_Raster tr = {0};
+    Olivec_Varyings vs;
+    Olivec_Depth_Band band;
+    if (!olivec_triangle_raster(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &tr)) return;
+    olivec_damage(oc, tr.lx, tr.ly, tr.hx - tr.lx + 1, tr.hy - tr.ly + 1);
+    if (!olivec_varyings(&tr, &z1, &z2, &z3, 1, &vs)) return;
+    for (int by = tr.ly; by <= tr.hy; by += band.rows) {
+        olivec_depth_band(&tr, by, &band);
+        for (int tx = band.lx - band.lx%OLIVEC_DEPTH_TILE; tx <= band.hx; tx += OLIVEC_DEPTH_TILE) {
+            if (!olivec_depth_band_tile(&db, &tr, &vs, &band, tx)) continue;
+            size_t stored = 0;
+            for (int j = 0; j < band.rows; ++j) {
+                int y = band.y + j;
+                int lx = band.part_lx[j], hx = band.part_hx[j];
+                if (lx > hx) continue;
+                float z;
+                olivec_varyings_span(&vs, band.part_u1[j], band.part_u2[j], &z);
+                // Runs of the pixels that pass are blended as spans
+                size_t i = y*db.stride + lx;
+                int run = -1;
+                for (int x = lx; x <= hx; ++x, ++i, z += vs.dx[0]) {
+                    if (olivec_depth_test_at(&db, i, olivec_depth_clamp(z, band.part_lo[j], band.part_hi[j]), true)) {
+                        stored += 1;
+                        if (run < 0) run = x;
+                    } else if (run >= 0) {
+                        olivec_blend_span(&OLIVEC_PIXEL(oc, run, y), x - run, color);
+                        run = -1;
+                    }
                 }
+                if (run >= 0) olivec_blend_span(&OLIVEC_PIXEL(oc, run, y), hx - run + 1, color);
             }
+            olivec_depth_tile_store(&db, tx, band.y, stored, olivec_depth_value(&db, band.lo), olivec_depth_value(&db, band.hi));
         }
     }
 }
 
-OLIVECDEF void olivec_triangle3z(Olivec_Canvas oc, int x1, int y1, int x2, int y2, int x3, int y3, float z1, float z2, float z3)
+OLIVECDEF void olivec_triangle3c_depth(Olivec_Canvas oc, Olivec_Depth_Buffer db, int x1, int y1, int x2, int y2, int x3, int y3, float z1, float z2, float z3, uint32_t c1, uint32_t c2, uint32_t c3)
 {
-    int lx, hx, ly, hy;
-    if (olivec_normalize_triangle(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &lx, &hx, &ly, &hy)) {
-        for (int y = ly; y <= hy; ++y) {
-            for (int x = lx; x <= hx; ++x) {
-                int u1, u2, det;
-                if (olivec_barycentric(x1, y1, x2, y2, x3, y3, x, y, &u1, &u2, &det)) {
-                    float z = z1*u1/det + z2*u2/det + z3*(det - u1 - u2)/det;
-                    OLIVEC_PIXEL(oc, x, y) = *(uint32_t*)&z;
+    Olivec_Triangle_Raster tr = {0};
+    Olivec_Varyings vs;
+    Olivec_Depth_Band band;
+    if (!olivec_triangle_raster(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &tr)) return;
+    olivec_damage(oc, tr.lx, tr.ly, tr.hx - tr.lx + 1, tr.hy - tr.ly + 1);
+    if (!olivec_varyings(&tr, &z1, &z2, &z3, 1, &vs)) return;
+    int det = tr.det;
+    for (int by = tr.ly; by <= tr.hy; by += band.rows) {
+        olivec_depth_band(&tr, by, &band);
+        for (int tx = band.lx - band.lx%OLIVEC_DEPTH_TILE; tx <= band.hx; tx += OLIVEC_DEPTH_TILE) {
+            if (!olivec_depth_band_tile(&db, &tr, &vs, &band, tx)) continue;
+            size_t stored = 0;
+            for (int j = 0; j < band.rows; ++j) {
+                int y = band.y + j;
+                int lx = band.part_lx[j], hx = band.part_hx[j];
+                if (lx > hx) continue;
+                int u1 = band.part_u1[j], u2 = band.part_u2[j];
+                float z;
+                olivec_varyings_span(&vs, u1, u2, &z);
+                size_t i = y*db.stride + lx;
+                for (int x = lx; x <= hx; ++x, ++i, z += vs.dx[0], u1 += tr.du1_dx, u2 += tr.du2_dx) {
+                    if (!olivec_depth_test_at(&db, i, olivec_depth_clamp(z, band.part_lo[j], band.part_hi[j]), true)) continue;
+                    stored += 1;
+                    olivec_blend_color(&OLIVEC_PIXEL(oc, x, y), mix_colors3(c1, c2, c3, u1, u2, det));
                 }
             }
+            olivec_depth_tile_store(&db, tx, band.y, stored, olivec_depth_value(&db, band.lo), olivec_depth_value(&db, band.hi));
         }
     }
 }
 
-OLIVECDEF void olivec_triangle3uv(Olivec_Canvas oc, int x1, int y1, int x2, int y2, int x3, int y3, float tx1, float ty1, float tx2, float ty2, float tx3, float ty3, float z1, float z2, float z3, Olivec_Canvas texture)
+OLIVECDEF void olivec_triangle_varyings_depth(Olivec_Canvas oc, Olivec_Depth_Buffer db, int x1, int y1, int x2, int y2, int x3, int y3,
+                                              const float *v1, const float *v2, const float *v3, size_t count,
+                                              bool perspective, Olivec_Shader shader, void *data)
 {
-    int lx, hx, ly, hy;
-    if (olivec_normalize_triangle(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &lx, &hx, &ly, &hy)) {
-        for (int y = ly; y <= hy; ++y) {
-            for (int x = lx; x <= hx; ++x) {
-                int u1, u2, det;
-                if (olivec_barycentric(x1, y1, x2, y2, x3, y3, x, y, &u1, &u2, &det)) {
-                    int u3 = det - u1 - u2;
-                    float z = z1*u1/det + z2*u2/det + z3*(det - u1 - u2)/det;
-                    float tx = tx1*u1/det + tx2*u2/det + tx3*u3/det;
-                    float ty = ty1*u1/det + ty2*u2/det + ty3*u3/det;
-
-                    int texture_x = tx/z*texture.width;
-                    if (texture_x < 0) texture_x = 0;
-                    if ((size_t) texture_x >= texture.width) texture_x = texture.width - 1;
-
-                    int texture_y = ty/z*texture.height;
-                    if (texture_y < 0) texture_y = 0;
-                    if ((size_t) texture_y >= texture.height) texture_y = texture.height - 1;
-                    OLIVEC_PIXEL(oc, x, y) = OLIVEC_PIXEL(texture, (int)texture_x, (int)texture_y);
+    Olivec_Triangle_Raster tr = {0};
+    Olivec_Varyings vs;
+    Olivec_Depth_Band band;
+    if (count == 0) return;
+    if (!olivec_triangle_raster(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &tr)) return;
+    olivec_damage(oc, tr.lx, tr.ly, tr.hx - tr.lx + 1, tr.hy - tr.ly + 1);
+    if (!olivec_varyings(&tr, v1, v2, v3, count, &vs)) return;
+    count = vs.count;
+
+    float v[OLIVEC_MAX_VARYINGS];
+    float pv[OLIVEC_MAX_VARYINGS];
+    for (int by = tr.ly; by <= tr.hy; by += band.rows) {
+        olivec_depth_band(&tr, by, &band);
+        for (int tx = band.lx - band.lx%OLIVEC_DEPTH_TILE; tx <= band.hx; tx += OLIVEC_DEPTH_TILE) {
+            if (!olivec_depth_band_tile(&db, &tr, &vs, &band, tx)) continue;
+            size_t stored = 0;
+            for (int j = 0; j < band.rows; ++j) {
+                int y = band.y + j;
+                int lx = band.part_lx[j], hx = band.part_hx[j];
+                if (lx > hx) continue;
+                olivec_varyings_span(&vs, band.part_u1[j], band.part_u2[j], v);
+                size_t i = y*db.stride + lx;
+                for (int x = lx; x <= hx; ++x, ++i) {
+                    float z = olivec_depth_clamp(v[0], band.part_lo[j], band.part_hi[j]);
+                    if (olivec_depth_test_at(&db, i, z, false)) {
+                        const float *varyings = v;
+                        if (perspective) {
+                            float r = 1/v[0];
+                            pv[0] = v[0];
+                            for (size_t k = 1; k < count; ++k) pv[k] = v[k]*r;
+                            varyings = pv;
+                        }
+                        uint32_t color;
+                        if (shader(data, x, y, varyings, &color)) {
+                            olivec_depth_test_at(&db, i, z, true);
+                            OLIVEC_PIXEL(oc, x, y) = color;
+                            stored += 1;
+                        }
+                    }
+                    for (size_t k = 0; k < count; ++k) v[k] += vs.dx[k];
                 }
             }
+            olivec_depth_tile_store(&db, tx, band.y, stored, olivec_depth_value(&db, band.lo), olivec_depth_value(&db, band.hi));
         }
     }
 }
 
-OLIVECDEF void olivec_triangle3uv_bilinear(Olivec_Canvas oc, int x1, int y1, int x2, int y2, int x3, int y3, float tx1, float ty1, float tx2, float ty2, float tx3, float ty3, float z1, float z2, float z3, Olivec_Canvas texture)
+OLIVECDEF Olivec_Mat4 olivec_mat4_identity(void)
 {
-    int lx, hx, ly, hy;
-    if (olivec_normalize_triangle(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &lx, &hx, &ly, &hy)) {
-        for (int y = ly; y <= hy; ++y) {
-            for (int x = lx; x <= hx; ++x) {
-                int u1, u2, det;
-                if (olivec_barycentric(x1, y1, x2, y2, x3, y3, x, y, &u1, &u2, &det)) {
-                    int u3 = det - u1 - u2;
-                    float z = z1*u1/det + z2*u2/det + z3*(det - u1 - u2)/det;
-                    float tx = tx1*u1/det + tx2*u2/det + tx3*u3/det;
-                    float ty = ty1*u1/det + ty2*u2/det + ty3*u3/det;
-
-                    float texture_x = tx/z*texture.width;
-                    if (texture_x < 0) texture_x = 0;
-                    if (texture_x >= (float) texture.width) texture_x = texture.width - 1;
-
-                    float texture_y = ty/z*texture.height;
-                    if (texture_y < 0) texture_y = 0;
-                    if (texture_y >= (float) texture.height) texture_y = texture.height - 1;
-
-                    int precision = 100;
-                    OLIVEC_PIXEL(oc, x, y) = olivec_pixel_bilinear(
-                                                 texture,
-                                                 texture_x*precision, texture_y*precision,
-                                                 precision, precision);
+    Olivec_Mat4 r = {0};
+    for (int i = 0; i < 4; ++i) r.m[i][i] = 1;
+    return r;
+}
+
+OLIVECDEF Olivec_Mat4 olivec_mat4_mul(Olivec_Mat4 a, Olivec_Mat4 b)
+{
+    Olivec_Mat4 r;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            r.m[i][j] = a.m[i][0]*b.m[0][j] + a.m[i][1]*b.m[1][j] + a.m[i][2]*b.m[2][j] + a.m[i][3]*b.m[3][j];
+        }
+    }
+    return r;
+}
+
+OLIVECDEF Olivec_Mat4 olivec_mat4_translate(float x, float y, float z)
+{
+    Olivec_Mat4 r = olivec_mat4_identity();
+    r.m[0][3] = x;
+    r.m[1][3] = y;
+    r.m[2][3] = z;
+    return r;
+}
+
+OLIVECDEF Olivec_Mat4 olivec_mat4_scale(float x, float y, float z)
+{
+    Olivec_Mat4 r = olivec_mat4_identity();
+    r.m[0][0] = x;
+    r.m[1][1] = y;
+    r.m[2][2] = z;
+    return r;
+}
+
+OLIVECDEF Olivec_Mat4 olivec_mat4_rotate_x(float c, float s)
+{
+    Olivec_Mat4 r = olivec_mat4_identity();
+    r.m[1][1] = c; r.m[1][2] = -s;
+    r.m[2][1] = s; r.m[2][2] = c;
+    return r;
+}
+
+OLIVECDEF Olivec_Mat4 olivec_mat4_rotate_y(float c, float s)
+{
+    Olivec_Mat4 r = olivec_mat4_identity();
+    r.m[0][0] = c;  r.m[0][2] = s;
+    r.m[2][0] = -s; r.m[2][2] = c;
+    return r;
+}
+
+OLIVECDEF Olivec_Mat4 olivec_mat4_rotate_z(float c, float s)
+{
+    Olivec_Mat4 r = olivec_mat4_identity();
+    r.m[0][0] = c; r.m[0][1] = -s;
+    r.m[1][0] = s; r.m[1][1] = c;
+    return r;
+}
+
+OLIVECDEF Olivec_Mat4 olivec_mat4_perspective(float fx, float fy)
+{
+    Olivec_Mat4 r = {0};
+    r.m[0][0] = fx;
+    r.m[1][1] = fy;
+    r.m[2][2] = 1;
+    r.m[3][2] = -1;
+    return r;
+}
+
+// Planes the triangles of olivec_mesh() are clipped by: the near plane and the guard band around the
+// canvas. Bits of the outcodes of the vertices.
+#define OLIVEC_MESH_PLANES 5
+
+typedef struct {
+    float near;
+    float gx, gy;
+} Olivec_Mesh_Clip;
+
+// Positive inside of the plane
+OLIVECDEF float olivec_mesh_plane(const Olivec_Mesh_Clip *clip, int plane, float x, float y, float w)
+{
+    switch (plane) {
+    case 0:  return w - clip->near;
+    case 1:  return clip->gx*w + x;
+    case 2:  return clip->gx*w - x;
+    case 3:  return clip->gy*w + y;
+    default: return clip->gy*w - y;
+    }
+}
+
+OLIVECDEF uint8_t olivec_mesh_outcode(const Olivec_Mesh_Clip *clip, float x, float y, float w)
+{
+    uint8_t code = 0;
+    for (int plane = 0; plane < OLIVEC_MESH_PLANES; ++plane) {
+        if (olivec_mesh_plane(clip, plane, x, y, w) < 0) code |= 1<<plane;
+    }
+    return code;
+}
+
+// Vertex of a triangle being clipped: clip space position, screen position, 1/w and the values
+// interpolated across the triangle before they are divided by w
+typedef struct {
+    float x, y, w;
+    float sx, sy, rw;
+    float v[OLIVEC_MAX_VARYINGS];
+} Olivec_Mesh_Vertex;
+
+OLIVECDEF void olivec_mesh_triangle(Olivec_Canvas oc, Olivec_Depth_Buffer db, const Olivec_Mesh_Vertex *p1, const Olivec_Mesh_Vertex *p2, const Olivec_Mesh_Vertex *p3,
+                                    size_t count, Olivec_Cull cull, Olivec_Shader shader, void *data)
+{
+    int x1 = olivec_floorf_clamped(p1->sx), y1 = olivec_floorf_clamped(p1->sy);
+    int x2 = olivec_floorf_clamped(p2->sx), y2 = olivec_floorf_clamped(p2->sy);
+    int x3 = olivec_floorf_clamped(p3->sx), y3 = olivec_floorf_clamped(p3->sy);
+    // Counter-clockwise with y going up is negative with y going down
+    int64_t area = (int64_t)(x2 - x1)*(y3 - y1) - (int64_t)(x3 - x1)*(y2 - y1);
+    if (area == 0) return;
+    if (cull == OLIVEC_CULL_BACK && area > 0) return;
+    if (cull == OLIVEC_CULL_FRONT && area < 0) return;
+
+    float v1[OLIVEC_MAX_VARYINGS], v2[OLIVEC_MAX_VARYINGS], v3[OLIVEC_MAX_VARYINGS];
+    v1[0] = p1->rw;
+    v2[0] = p2->rw;
+    v3[0] = p3->rw;
+    for (size_t k = 1; k < count; ++k) {
+        v1[k] = p1->v[k - 1]*p1->rw;
+        v2[k] = p2->v[k - 1]*p2->rw;
+        v3[k] = p3->v[k - 1]*p3->rw;
+    }
+    olivec_triangle_varyings_depth(oc, db, x1, y1, x2, y2, x3, y3, v1, v2, v3, count, true, shader, data);
+}
+
+OLIVECDEF void olivec_mesh_screen(Olivec_Canvas oc, Olivec_Mesh_Vertex *p)
+{
+    p->rw = 1/p->w;
+    p->sx = (p->x*p->rw + 1)*0.5f*oc.width;
+    p->sy = (1 - p->y*p->rw)*0.5f*oc.height;
+}
+
+OLIVECDEF void olivec_mesh(Olivec_Canvas oc, Olivec_Depth_Buffer db, const Olivec_Mesh *mesh, Olivec_Mat4 transform,
+                           float near, Olivec_Cull cull, float *scratch, Olivec_Shader shader, void *data)
+{
+    if (oc.width == 0 || oc.height == 0) return;
+    Olivec_Mesh_Clip clip = {
+        .near = near,
+        .gx = 1 + 2.0f*OLIVEC_MESH_GUARD_BAND/oc.width,
+        .gy = 1 + 2.0f*OLIVEC_MESH_GUARD_BAND/oc.height,
+    };
+
+    // Every vertex is transformed once. The screen positions are only valid for the vertices
+    // with zero outcodes.
+    size_t n = mesh->vertex_count;
+    float *xs = scratch;
+    float *ys = scratch + n;
+    float *ws = scratch + 2*n;
+    float *sxs = scratch + 3*n;
+    float *sys = scratch + 4*n;
+    uint8_t *codes = (uint8_t*)(scratch + 5*n);
+    float (*m)[4] = transform.m;
+    for (size_t i = 0; i < n; ++i) {
+        const float *p = &mesh->positions[i*mesh->stride];
+        float x = m[0][0]*p[0] + m[0][1]*p[1] + m[0][2]*p[2] + m[0][3];
+        float y = m[1][0]*p[0] + m[1][1]*p[1] + m[1][2]*p[2] + m[1][3];
+        float w = m[3][0]*p[0] + m[3][1]*p[1] + m[3][2]*p[2] + m[3][3];
+        xs[i] = x;
+        ys[i] = y;
+        ws[i] = w;
+        codes[i] = olivec_mesh_outcode(&clip, x, y, w);
+        if (codes[i] == 0) {
+            float rw = 1/w;
+            sxs[i] = (x*rw + 1)*0.5f*oc.width;
+            sys[i] = (1 - y*rw)*0.5f*oc.height;
+        }
+    }
+
+    size_t attribute_count = mesh->attributes ? mesh->attribute_count : 0;
+    if (attribute_count > OLIVEC_MAX_VARYINGS - 3) attribute_count = OLIVEC_MAX_VARYINGS - 3;
+    size_t count = 3 + attribute_count;
+
+    Olivec_Mesh_Vertex polygon[2][3 + OLIVEC_MESH_PLANES];
+    for (size_t t = 0; t < mesh->triangle_count; ++t) {
+        int tri[3];
+        for (int j = 0; j < 3; ++j) {
+            size_t k = t*mesh->indices_stride + j;
+            tri[j] = mesh->indices16 ? mesh->indices16[k] : mesh->indices[k];
+        }
+        uint8_t c1 = codes[tri[0]], c2 = codes[tri[1]], c3 = codes[tri[2]];
+        // All of the vertices are outside of the same plane
+        if (c1 & c2 & c3) continue;
+
+        Olivec_Mesh_Vertex *in = polygon[0];
+        for (int j = 0; j < 3; ++j) {
+            int i = tri[j];
+            in[j].x = xs[i];
+            in[j].y = ys[i];
+            in[j].w = ws[i];
+            in[j].v[0] = j == 0;
+            in[j].v[1] = j == 1;
+            const float *a = mesh->attributes + i*mesh->stride;
+            for (size_t k = 0; k < attribute_count; ++k) in[j].v[2 + k] = a[k];
+        }
+
+        if ((c1 | c2 | c3) == 0) {
+            for (int j = 0; j < 3; ++j) {
+                in[j].sx = sxs[tri[j]];
+                in[j].sy = sys[tri[j]];
+                in[j].rw = 1/in[j].w;
+            }
+            olivec_mesh_triangle(oc, db, &in[0], &in[1], &in[2], count, cull, shader, data);
+            continue;
+        }
+
+        // Sutherland-Hodgman against the planes that any of the vertices are outside of
+        int in_count = 3;
+        for (int plane = 0; plane < OLIVEC_MESH_PLANES && in_count > 0; ++plane) {
+            if (((c1 | c2 | c3)&(1<<plane)) == 0) continue;
+            Olivec_Mesh_Vertex *out = in == polygon[0] ? polygon[1] : polygon[0];
+            int out_count = 0;
+            for (int j = 0; j < in_count; ++j) {
+                const Olivec_Mesh_Vertex *a = &in[j];
+                const Olivec_Mesh_Vertex *b = &in[(j + 1)%in_count];
+                float ea = olivec_mesh_plane(&clip, plane, a->x, a->y, a->w);
+                float eb = olivec_mesh_plane(&clip, plane, b->x, b->y, b->w);
+                if (ea >= 0) out[out_count++] = *a;
+                if ((ea >= 0) != (eb >= 0)) {
+                    float s = ea/(ea - eb);
+                    Olivec_Mesh_Vertex *p = &out[out_count++];
+                    p->x = a->x + (b->x - a->x)*s;
+                    p->y = a->y + (b->y - a->y)*s;
+                    p->w = a->w + (b->w - a->w)*s;
+                    for (size_t k = 0; k + 1 < count; ++k) p->v[k] = a->v[k] + (b->v[k] - a->v[k])*s;
                 }
             }
+            in = out;
+            in_count = out_count;
+        }
+        if (in_count < 3) continue;
+
+        for (int j = 0; j < in_count; ++j) olivec_mesh_screen(oc, &in[j]);
+        for (int j = 1; j + 1 < in_count; ++j) {
+            olivec_mesh_triangle(oc, db, &in[0], &in[j], &in[j + 1], count, cull, shader, data);
+        }
+    }
+}
+
+OLIVECDEF size_t olivec_mesh_lod(Olivec_Canvas oc, Olivec_Mat4 transform, const float *errors, size_t count, float max_error)
+{
+    float (*m)[4] = transform.m;
+    float w = m[3][3];
+    if (w <= 0) return 0;
+
+    // Squared pixels per model unit along both axes of the canvas
+    float hw = 0.5f*oc.width, hh = 0.5f*oc.height;
+    float sx = (m[0][0]*m[0][0] + m[0][1]*m[0][1] + m[0][2]*m[0][2])*hw*hw;
+    float sy = (m[1][0]*m[1][0] + m[1][1]*m[1][1] + m[1][2]*m[1][2])*hh*hh;
+    float s = sx > sy ? sx : sy;
+
+    for (size_t i = count; i-- > 1;) {
+        if (errors[i]*errors[i]*s <= max_error*max_error*w*w) return i;
+    }
+    return 0;
+}
+
+OLIVECDEF bool olivec_mesh_from_memory(const void *data, size_t size, Olivec_Mesh *mesh)
+{
+    const Olivec_Mesh_File_Header *header = data;
+    if (((uintptr_t)data & 3) != 0) return false;
+    if (size < sizeof(*header)) return false;
+    if (header->magic != OLIVEC_MESH_FILE_MAGIC) return false;
+    if (header->version != OLIVEC_MESH_FILE_VERSION) return false;
+
+    uint32_t stride = 3;
+    if (header->flags & OLIVEC_MESH_FILE_NORMALS) stride += 3;
+    if (header->flags & OLIVEC_MESH_FILE_TEXCOORDS) stride += 2;
+    if (header->stride != stride) return false;
+
+    bool indices16 = header->flags & OLIVEC_MESH_FILE_INDICES16;
+    uint64_t vertices_size = (uint64_t)header->vertex_count*stride*sizeof(float);
+    uint64_t indices_size = (uint64_t)header->triangle_count*3*(indices16 ? sizeof(uint16_t) : sizeof(int32_t));
+    if ((header->vertices_offset & 3) != 0 || (header->indices_offset & 3) != 0) return false;
+    if (header->vertices_offset + vertices_size > size) return false;
+    if (header->indices_offset + indices_size > size) return false;
+
+    const char *bytes = data;
+    Olivec_Mesh m = {
+        .positions = (const float*)(bytes + header->vertices_offset),
+        .attributes = stride > 3 ? (const float*)(bytes + header->vertices_offset) + 3 : NULL,
+        .attribute_count = stride - 3,
+        .stride = stride,
+        .vertex_count = header->vertex_count,
+        .indices_stride = 3,
+        .triangle_count = header->triangle_count,
+    };
+    size_t indices_count = (size_t)header->triangle_count*3;
+    if (indices16) {
+        m.indices16 = (const uint16_t*)(bytes + header->indices_offset);
+        for (size_t i = 0; i < indices_count; ++i) {
+            if (m.indices16[i] >= m.vertex_count) return false;
+        }
+    } else {
+        m.indices = (const int*)(bytes + header->indices_offset);
+        for (size_t i = 0; i < indices_count; ++i) {
+            if (m.indices[i] < 0 || (size_t)m.indices[i] >= m.vertex_count) return false;
+        }
+    }
+    *mesh = m;
+    return true;
+}
+
+OLIVECDEF void olivec_triangle3c(Olivec_Canvas oc, int x1, int y1, int x2, int y2, int x3, int y3,
+                                 uint32_t c1, uint32_t c2, uint32_t c3)
+{
+    Olivec_Triangle_Raster tr = {0};
+    if (olivec_triangle_raster(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &tr)) {
+        olivec_damage(oc, tr.lx, tr.ly, tr.hx - tr.lx + 1, tr.hy - tr.ly + 1);
+        int det = tr.det;
+        for (int y = tr.ly; y <= tr.hy; ++y) {
+            int lx, hx, u1, u2;
+            if (!olivec_triangle_raster_span(&tr, y, &lx, &hx, &u1, &u2)) continue;
+            for (int x = lx; x <= hx; ++x, u1 += tr.du1_dx, u2 += tr.du2_dx) {
+                olivec_blend_color(&OLIVEC_PIXEL(oc, x, y), mix_colors3(c1, c2, c3, u1, u2, det));
+            }
+        }
+    }
+}
+
+OLIVECDEF void olivec_triangle3z(Olivec_Canvas oc, int x1, int y1, int x2, int y2, int x3, int y3, float z1, float z2, float z3)
+{
+    Olivec_Triangle_Raster tr = {0};
+    Olivec_Varyings vs;
+    if (!olivec_triangle_raster(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &tr)) return;
+    olivec_damage(oc, tr.lx, tr.ly, tr.hx - tr.lx + 1, tr.hy - tr.ly + 1);
+    if (!olivec_varyings(&tr, &z1, &z2, &z3, 1, &vs)) return;
+    for (int y = tr.ly; y <= tr.hy; ++y) {
+        int lx, hx, u1, u2;
+        if (!olivec_triangle_raster_span(&tr, y, &lx, &hx, &u1, &u2)) continue;
+        float z;
+        olivec_varyings_span(&vs, u1, u2, &z);
+        uint32_t *pixel = &OLIVEC_PIXEL(oc, lx, y);
+        for (int x = lx; x <= hx; ++x, ++pixel, z += vs.dx[0]) {
+            union { float f; uint32_t u; } bits = {z};
+            *pixel = bits.u;
+        }
+    }
+}
+
+OLIVECDEF void olivec_triangle3uv(Olivec_Canvas oc, int x1, int y1, int x2, int y2, int x3, int y3, float tx1, float ty1, float tx2, float ty2, float tx3, float ty3, float z1, float z2, float z3, Olivec_Canvas texture)
+{
+    Olivec_Triangle_Raster tr = {0};
+    Olivec_Varyings vs;
+    float v1[] = {z1, tx1, ty1};
+    float v2[] = {z2, tx2, ty2};
+    float v3[] = {z3, tx3, ty3};
+    if (!olivec_triangle_raster(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &tr)) return;
+    olivec_damage(oc, tr.lx, tr.ly, tr.hx - tr.lx + 1, tr.hy - tr.ly + 1);
+    if (!olivec_varyings(&tr, v1, v2, v3, 3, &vs)) return;
+    for (int y = tr.ly; y <= tr.hy; ++y) {
+        int lx, hx, u1, u2;
+        if (!olivec_triangle_raster_span(&tr, y, &lx, &hx, &u1, &u2)) continue;
+        float v[3];
+        olivec_varyings_span(&vs, u1, u2, v);
+        uint32_t *pixel = &OLIVEC_PIXEL(oc, lx, y);
+        for (int x = lx; x <= hx; ++x, ++pixel) {
+            float r = 1/v[0];
+
+            int texture_x = v[1]*r*texture.width;
+            if (texture_x < 0) texture_x = 0;
+            if ((size_t) texture_x >= texture.width) texture_x = texture.width - 1;
+
+            int texture_y = v[2]*r*texture.height;
+            if (texture_y < 0) texture_y = 0;
+            if ((size_t) texture_y >= texture.height) texture_y = texture.height - 1;
+            *pixel = OLIVEC_PIXEL(texture, texture_x, texture_y);
+
+            v[0] += vs.dx[0];
+            v[1] += vs.dx[1];
+            v[2] += vs.dx[2];
+        }
+    }
+}
+
+OLIVECDEF void olivec_triangle3uv_bilinear(Olivec_Canvas oc, int x1, int y1, int x2, int y2, int x3, int y3, float tx1, float ty1, float tx2, float ty2, float tx3, float ty3, float z1, float z2, float z3, Olivec_Canvas texture)
+{
+    Olivec_Triangle_Raster tr = {0};
+    Olivec_Varyings vs;
+    float v1[] = {z1, tx1, ty1};
+    float v2[] = {z2, tx2, ty2};
+    float v3[] = {z3, tx3, ty3};
+    if (!olivec_triangle_raster(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &tr)) return;
+    olivec_damage(oc, tr.lx, tr.ly, tr.hx - tr.lx + 1, tr.hy - tr.ly + 1);
+    if (!olivec_varyings(&tr, v1, v2, v3, 3, &vs)) return;
+    float tw = texture.width, th = texture.height;
+    for (int y = tr.ly; y <= tr.hy; ++y) {
+        int lx, hx, u1, u2;
+        if (!olivec_triangle_raster_span(&tr, y, &lx, &hx, &u1, &u2)) continue;
+        float v[3];
+        olivec_varyings_span(&vs, u1, u2, v);
+        uint32_t *pixel = &OLIVEC_PIXEL(oc, lx, y);
+        for (int x = lx; x <= hx; ++x, ++pixel) {
+            float r = 1/v[0];
+
+            float texture_x = v[1]*r*tw;
+            if (texture_x < 0) texture_x = 0;
+            if (texture_x >= tw) texture_x = tw - 1;
+
+            float texture_y = v[2]*r*th;
+            if (texture_y < 0) texture_y = 0;
+            if (texture_y >= th) texture_y = th - 1;
+
+            *pixel = olivec_sample_bilinear(texture, texture_x*256, texture_y*256);
+
+            v[0] += vs.dx[0];
+            v[1] += vs.dx[1];
+            v[2] += vs.dx[2];
         }
     }
 }
 
-// TODO: AA for triangle
 OLIVECDEF void olivec_triangle(Olivec_Canvas oc, int x1, int y1, int x2, int y2, int x3, int y3, uint32_t color)
 {
-    int lx, hx, ly, hy;
-    if (olivec_normalize_triangle(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &lx, &hx, &ly, &hy)) {
-        for (int y = ly; y <= hy; ++y) {
-            for (int x = lx; x <= hx; ++x) {
-                int u1, u2, det;
-                if (olivec_barycentric(x1, y1, x2, y2, x3, y3, x, y, &u1, &u2, &det)) {
-                    olivec_blend_color(&OLIVEC_PIXEL(oc, x, y), color);
-                }
+    Olivec_Triangle_Raster tr = {0};
+    if (olivec_triangle_raster(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &tr)) {
+        olivec_damage(oc, tr.lx, tr.ly, tr.hx - tr.lx + 1, tr.hy - tr.ly + 1);
+        for (int y = tr.ly; y <= tr.hy; ++y) {
+            int lx, hx, u1, u2;
+            if (!olivec_triangle_raster_span(&tr, y, &lx, &hx, &u1, &u2)) continue;
+            olivec_blend_span(&OLIVEC_PIXEL(oc, lx, y), hx - lx + 1, color);
+        }
+    }
+}
+
+// Anti-aliased triangles use the same pixel model as olivec_line_aa(): pixel (x, y) covers the area
+// from (x, y) to (x + 1, y + 1). Coverage of a pixel by an edge is a linear ramp across the extent of
+// the pixel along the edge normal. The coverage by the triangle is the product of the ones of its edges,
+// which is exact where two edges meet at a right angle. Where they meet at a sharp angle, or run almost
+// parallel like the sides of a thin sliver, the product overestimates and is clamped by how much the
+// pixel is covered by both edges at once, c1 + c2 - 1, which is exact for parallel edges.
+// Every row splits into the pixels that are fully inside of all the edges, which are filled like in the
+// aliased olivec_triangle(), and the few pixels on the edges around them, the only ones that pay for the
+// coverage.
+typedef struct {
+    // Pixels the triangle may touch clipped to the canvas
+    int lx, hx;
+    int ly, hy;
+
+    // Edge i starts at ox[i], oy[i] and goes along ex[i], ey[i] with the inside on the left, so
+    // e = ey*(x - ox) - ex*(y - oy) is the distance from the edge scaled by its length, positive outside.
+    // The pixel is fully inside of the edge when e at its center is at most -w[i], and its coverage
+    // ramps by ramp[i] per unit of e from there. Working with the unnormalized e keeps the results
+    // the same whether the compiler fuses the multiplications and additions or not.
+    float ox[3], oy[3], ex[3], ey[3];
+    float w[3], ramp[3];
+
+    // How much the edges i and i + 1 face each other: minus the cosine between their normals, or 0
+    // when the angle between them is not sharp
+    float oppose[3];
+} Olivec_Triangle_AA;
+
+OLIVECDEF bool olivec_triangle_aa_raster(size_t width, size_t height, float x1, float y1, float x2, float y2, float x3, float y3, Olivec_Triangle_AA *ta)
+{
+    float vx[3] = {x1, x2, x3};
+    float vy[3] = {y1, y2, y3};
+    float area = (x2 - x1)*(y3 - y1) - (x3 - x1)*(y2 - y1);
+    if (area > -1e-6f && area < 1e-6f) return false;
+
+    float lx = x1, hx = x1, ly = y1, hy = y1;
+    for (int i = 0; i < 3; ++i) {
+        int j = (i + 1)%3;
+        float ex = vx[j] - vx[i], ey = vy[j] - vy[i];
+        if (area < 0) {
+            ex = -ex;
+            ey = -ey;
+        }
+        ta->ox[i] = vx[i];
+        ta->oy[i] = vy[i];
+        ta->ex[i] = ex;
+        ta->ey[i] = ey;
+        // Half of the extent of a pixel along the normal
+        ta->w[i] = (OLIVEC_ABS(float, ex) + OLIVEC_ABS(float, ey))/2;
+        ta->ramp[i] = 1/(2*ta->w[i]);
+        if (vx[i] < lx) lx = vx[i];
+        if (vx[i] > hx) hx = vx[i];
+        if (vy[i] < ly) ly = vy[i];
+        if (vy[i] > hy) hy = vy[i];
+    }
+    for (int i = 0; i < 3; ++i) {
+        int j = (i + 1)%3;
+        float li = olivec_sqrtf(ta->ex[i]*ta->ex[i] + ta->ey[i]*ta->ey[i]);
+        float lj = olivec_sqrtf(ta->ex[j]*ta->ex[j] + ta->ey[j]*ta->ey[j]);
+        float oppose = -(ta->ex[i]*ta->ex[j] + ta->ey[i]*ta->ey[j])/(li*lj);
+        ta->oppose[i] = oppose > 0 ? oppose : 0;
+    }
+
+    ta->lx = olivec_floorf_clamped(lx);
+    ta->ly = olivec_floorf_clamped(ly);
+    ta->hx = olivec_floorf_clamped(hx);
+    ta->hy = olivec_floorf_clamped(hy);
+    if (ta->lx < 0) ta->lx = 0;
+    if (ta->ly < 0) ta->ly = 0;
+    if (ta->hx >= (int) width) ta->hx = width - 1;
+    if (ta->hy >= (int) height) ta->hy = height - 1;
+    return ta->lx <= ta->hx && ta->ly <= ta->hy;
+}
+
+// Pixels of the row y that the triangle touches are lx..hx, the ones it fully covers are ilx..ihx.
+// The latter is empty when ilx > ihx. Both are a bit conservative, the coverage of the pixels in
+// between decides.
+OLIVECDEF bool olivec_triangle_aa_span(const Olivec_Triangle_AA *ta, int y, int *lx, int *hx, int *ilx, int *ihx)
+{
+    int olo = ta->lx, ohi = ta->hx;
+    int ilo = ta->lx, ihi = ta->hx;
+    for (int i = 0; i < 3; ++i) {
+        // e at the center of pixel x is ey*(x + 0.5) + a
+        float ey = ta->ey[i];
+        float a = -ey*ta->ox[i] - ta->ex[i]*(y + 0.5f - ta->oy[i]);
+        float w = ta->w[i];
+        if (ey > 0) {
+            int o = olivec_floorf_clamped((w - a)/ey - 0.5f);
+            int n = olivec_floorf_clamped((-w - a)/ey - 0.5f) - 1;
+            if (ohi > o) ohi = o;
+            if (ihi > n) ihi = n;
+        } else if (ey < 0) {
+            int o = olivec_floorf_clamped((w - a)/ey - 0.5f);
+            int n = olivec_floorf_clamped((-w - a)/ey - 0.5f) + 2;
+            if (olo < o) olo = o;
+            if (ilo < n) ilo = n;
+        } else {
+            if (a >= w) return false;
+            if (a > -w) ihi = ilo - 1;
+        }
+    }
+    if (olo > ohi) return false;
+    if (ilo < olo) ilo = olo;
+    if (ihi > ohi) ihi = ohi;
+    *lx = olo;
+    *hx = ohi;
+    *ilx = ilo;
+    *ihx = ihi;
+    return true;
+}
+
+OLIVECDEF uint8_t olivec_triangle_aa_coverage(const Olivec_Triangle_AA *ta, int x, int y)
+{
+    float c[3];
+    for (int i = 0; i < 3; ++i) {
+        float e = ta->ey[i]*(x + 0.5f - ta->ox[i]) - ta->ex[i]*(y + 0.5f - ta->oy[i]);
+        c[i] = olivec_clamp01((ta->w[i] - e)*ta->ramp[i]);
+    }
+    float coverage = c[0]*c[1]*c[2];
+    for (int i = 0; i < 3; ++i) {
+        float k = ta->oppose[i];
+        if (k == 0) continue;
+        int j = (i + 1)%3;
+        float both = (1 - k)*c[i]*c[j] + k*olivec_clamp01(c[i] + c[j] - 1);
+        if (coverage > both) coverage = both;
+    }
+    return coverage*255 + 0.5f;
+}
+
+OLIVECDEF uint32_t olivec_color_coverage(uint32_t color, uint8_t coverage)
+{
+    uint32_t alpha = OLIVEC_ALPHA(color)*coverage/255;
+    return (color&0x00FFFFFF)|(alpha<<(3*8));
+}
+
+OLIVECDEF void olivec_triangle_aa(Olivec_Canvas oc, float x1, float y1, float x2, float y2, float x3, float y3, uint32_t color)
+{
+    Olivec_Triangle_AA ta;
+    if (!olivec_triangle_aa_raster(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &ta)) return;
+    olivec_damage(oc, ta.lx, ta.ly, ta.hx - ta.lx + 1, ta.hy - ta.ly + 1);
+    for (int y = ta.ly; y <= ta.hy; ++y) {
+        int lx, hx, ilx, ihx;
+        if (!olivec_triangle_aa_span(&ta, y, &lx, &hx, &ilx, &ihx)) continue;
+        for (int x = lx; x <= hx; ++x) {
+            if (x == ilx && ilx <= ihx) {
+                olivec_blend_span(&OLIVEC_PIXEL(oc, x, y), ihx - ilx + 1, color);
+                x = ihx;
+                continue;
             }
+            uint8_t coverage = olivec_triangle_aa_coverage(&ta, x, y);
+            if (coverage == 0) continue;
+            olivec_blend_color(&OLIVEC_PIXEL(oc, x, y), olivec_color_coverage(color, coverage));
         }
     }
 }
 
-OLIVECDEF void olivec_text(Olivec_Canvas oc, const char *text, int tx, int ty, Olivec_Font font, size_t glyph_size, uint32_t color)
+OLIVECDEF void olivec_triangle3c_aa(Olivec_Canvas oc, float x1, float y1, float x2, float y2, float x3, float y3,
+                                    uint32_t c1, uint32_t c2, uint32_t c3)
 {
-    for (size_t i = 0; *text; ++i, ++text) {
-        int gx = tx + i*font.width*glyph_size;
-        int gy = ty;
+    Olivec_Triangle_AA ta;
+    if (!olivec_triangle_aa_raster(oc.width, oc.height, x1, y1, x2, y2, x3, y3, &ta)) return;
+    olivec_damage(oc, ta.lx, ta.ly, ta.hx - ta.lx + 1, ta.hy - ta.ly + 1);
+
+    // Barycentric coordinates in fixed point for mix_colors3(), clamped for the edge pixels outside
+    // of the triangle
+    const int det = 1 << 12;
+    float area = (x1 - x3)*(y2 - y3) - (x2 - x3)*(y1 - y3);
+    float du1_dx = (y2 - y3)*det/area;
+    float du2_dx = (y3 - y1)*det/area;
+    for (int y = ta.ly; y <= ta.hy; ++y) {
+        int lx, hx, ilx, ihx;
+        if (!olivec_triangle_aa_span(&ta, y, &lx, &hx, &ilx, &ihx)) continue;
+        float cx = lx + 0.5f - x3;
+        float cy = y + 0.5f - y3;
+        float e1 = (y2 - y3)*cx + (x3 - x2)*cy;
+        float e2 = (y3 - y1)*cx + (x1 - x3)*cy;
+        float u1 = e1*det/area;
+        float u2 = e2*det/area;
+        for (int x = lx; x <= hx; ++x, u1 += du1_dx, u2 += du2_dx) {
+            uint8_t coverage = ilx <= x && x <= ihx ? 255 : olivec_triangle_aa_coverage(&ta, x, y);
+            if (coverage == 0) continue;
+            int i1 = u1 < 0 ? 0 : u1 > det ? det : u1;
+            int i2 = u2 < 0 ? 0 : u2 > det - i1 ? det - i1 : u2;
+            uint32_t color = mix_colors3(c1, c2, c3, i1, i2, det);
+            olivec_blend_color(&OLIVEC_PIXEL(oc, x, y), olivec_color_coverage(color, coverage));
+        }
+    }
+}
+
+// Draws the cells of the glyphs whose top-left corners are within width x height, the way olivec_text()
+// always did, clipped to oc which is placed at ox, oy in those coordinates. olivec_text() passes the
+// canvas itself, the tiled renderer passes a tile of it.
+//
+// Glyphs are 1-bit cells, so at any glyph_size a glyph row is just its runs of lit cells scaled up.
+// Every run is found once per glyph row and blitted as glyph_size spans, and everything that depends
+// only on the string (the visible rows of cells, the clipping bounds) is computed once per string.
+OLIVECDEF void olivec_text_cells(Olivec_Canvas oc, int ox, int oy, size_t width, size_t height, const char *text, int tx, int ty, Olivec_Font font, size_t glyph_size, uint32_t color)
+{
+    if (glyph_size == 0 || font.width == 0 || font.height == 0) return;
+    int gs = glyph_size;
+    int fw = font.width;
+    int fh = font.height;
+
+    // Pixels that may be drawn
+    int64_t cx1 = ox > 0 ? ox : 0;
+    int64_t cy1 = oy > 0 ? oy : 0;
+    int64_t cx2 = (int64_t) ox + (int64_t) oc.width;
+    int64_t cy2 = (int64_t) oy + (int64_t) oc.height;
+    if (cx2 > (int64_t) width) cx2 = width;
+    if (cy2 > (int64_t) height) cy2 = height;
+    if (cx1 >= cx2 || cy1 >= cy2) return;
+
+    // Rows of cells with the top-left corners within the height
+    int64_t dy1 = ty >= 0 ? 0 : olivec_div_ceil(-(int64_t) ty, gs);
+    int64_t dy2 = olivec_div_floor((int64_t) height - 1 - ty, gs);
+    if (dy2 > fh - 1) dy2 = fh - 1;
+    // ...and the ones that reach the clipping bounds
+    int64_t ry1 = olivec_div_ceil(cy1 - ty - gs + 1, gs);
+    int64_t ry2 = olivec_div_floor(cy2 - 1 - ty, gs);
+    if (dy1 < ry1) dy1 = ry1;
+    if (dy2 > ry2) dy2 = ry2;
+    if (dy1 > dy2) return;
+
+    int64_t advance = (int64_t) fw*gs;
+    for (int64_t gx = tx; *text; gx += advance, ++text) {
+        if (gx >= cx2) break;
+        if (gx + advance <= cx1) continue;
+
+        // Columns of cells with the top-left corners within the width that reach the clipping bounds
+        int64_t dx1 = gx >= 0 ? 0 : olivec_div_ceil(-gx, gs);
+        int64_t dx2 = olivec_div_floor((int64_t) width - 1 - gx, gs);
+        if (dx2 > fw - 1) dx2 = fw - 1;
+        int64_t rx1 = olivec_div_ceil(cx1 - gx - gs + 1, gs);
+        int64_t rx2 = olivec_div_floor(cx2 - 1 - gx, gs);
+        if (dx1 < rx1) dx1 = rx1;
+        if (dx2 > rx2) dx2 = rx2;
+        if (dx1 > dx2) continue;
+        int64_t gx1 = gx + dx1*gs, gx2 = gx + (dx2 + 1)*gs;
+        int64_t gy1 = ty + dy1*gs, gy2 = ty + (dy2 + 1)*gs;
+        if (gx1 < cx1) gx1 = cx1;
+        if (gx2 > cx2) gx2 = cx2;
+        if (gy1 < cy1) gy1 = cy1;
+        if (gy2 > cy2) gy2 = cy2;
+        olivec_damage(oc, gx1 - ox, gy1 - oy, gx2 - gx1, gy2 - gy1);
+
         const char *glyph = &font.glyphs[(*text)*sizeof(char)*font.width*font.height];
-        for (int dy = 0; (size_t) dy < font.height; ++dy) {
-            for (int dx = 0; (size_t) dx < font.width; ++dx) {
-                int px = gx + dx*glyph_size;
-                int py = gy + dy*glyph_size;
-                if (0 <= px && px < (int) oc.width && 0 <= py && py < (int) oc.height) {
-                    if (glyph[dy*font.width + dx]) {
-                        olivec_rect(oc, px, py, glyph_size, glyph_size, color);
-                    }
+        for (int64_t dy = dy1; dy <= dy2; ++dy) {
+            const char *row = &glyph[dy*fw];
+            int64_t py1 = ty + dy*gs;
+            int64_t py2 = py1 + gs;
+            if (py1 < cy1) py1 = cy1;
+            if (py2 > cy2) py2 = cy2;
+            for (int64_t dx = dx1; dx <= dx2; ) {
+                if (!row[dx]) {
+                    dx += 1;
+                    continue;
+                }
+                int64_t start = dx;
+                while (dx <= dx2 && row[dx]) dx += 1;
+                int64_t px1 = gx + start*gs;
+                int64_t px2 = gx + dx*gs;
+                if (px1 < cx1) px1 = cx1;
+                if (px2 > cx2) px2 = cx2;
+                for (int64_t py = py1; py < py2; ++py) {
+                    olivec_blend_span(&OLIVEC_PIXEL(oc, px1 - ox, py - oy), px2 - px1, color);
                 }
             }
         }
     }
 }
 
-OLIVECDEF void olivec_sprite_blend(Olivec_Canvas oc, int x, int y, int w, int h, Olivec_Canvas sprite)
+OLIVECDEF void olivec_text(Olivec_Canvas oc, const char *text, int tx, int ty, Olivec_Font font, size_t glyph_size, uint32_t color)
+{
+    olivec_text_cells(oc, 0, 0, oc.width, oc.height, text, tx, ty, font, glyph_size, color);
+}
+
+// Nearest neighbour scaling of the sprite into the w x h rectangle at x, y. Negative w or h flip it.
+// A destination pixel d pixels away from x along the row takes the source column d*sprite.width/|w|,
+// which is stepped with an integer quotient and remainder instead of a division per pixel. Rows are
+// done the same way. Unflipped 1:1 rows go straight through the span functions and rows of an
+// upscaled copy that repeat the previous source row are copied from the previous destination row.
+OLIVECDEF void olivec_sprite_scale(Olivec_Canvas oc, int x, int y, int w, int h, Olivec_Canvas sprite, bool blend)
 {
     if (sprite.width == 0) return;
     if (sprite.height == 0) return;
 
+    // TODO: consider introducing flip parameter instead of relying on negative width and height
+    // Similar to how SDL_RenderCopyEx does that
     Olivec_Normalized_Rect nr = {0};
     if (!olivec_normalize_rect(x, y, w, h, oc.width, oc.height, &nr)) return;
+    olivec_damage(oc, nr.x1, nr.y1, nr.x2 - nr.x1 + 1, nr.y2 - nr.y1 + 1);
+
+    int64_t sw = sprite.width, sh = sprite.height;
+    int64_t aw = OLIVEC_ABS(int64_t, (int64_t) w);
+    int64_t ah = OLIVEC_ABS(int64_t, (int64_t) h);
+    size_t n = nr.x2 - nr.x1 + 1;
+
+    // Distance of the first pixel of the row we walk from x. Flipped rows are walked right to left.
+    int64_t d0 = w > 0 ? nr.x1 - x : x - nr.x2;
+    int dir = w > 0 ? 1 : -1;
+    int64_t q0 = d0*sw/aw, r0 = d0*sw%aw;
+    int64_t dq = sw/aw, dr = sw%aw;
+    bool unscaled = w > 0 && aw == sw;
+
+    int64_t prev_ny = -1;
+    for (int py = nr.y1; py <= nr.y2; ++py) {
+        int64_t ny = (h > 0 ? py - y : y - py)*sh/ah;
+        const uint32_t *src = &OLIVEC_PIXEL(sprite, 0, ny);
+        uint32_t *dst = &OLIVEC_PIXEL(oc, nr.x1, py);
+        if (!blend && ny == prev_ny) {
+            const uint32_t *above = dst - oc.stride;
+            for (size_t i = 0; i < n; ++i) dst[i] = above[i];
+            continue;
+        }
+        prev_ny = ny;
 
-    int xa = nr.ox1;
-    if (w < 0) xa = nr.ox2;
-    int ya = nr.oy1;
-    if (h < 0) ya = nr.oy2;
-    for (int y = nr.y1; y <= nr.y2; ++y) {
-        for (int x = nr.x1; x <= nr.x2; ++x) {
-            size_t nx = (x - xa)*((int) sprite.width)/w;
-            size_t ny = (y - ya)*((int) sprite.height)/h;
-            olivec_blend_color(&OLIVEC_PIXEL(oc, x, y), OLIVEC_PIXEL(sprite, nx, ny));
+        if (unscaled) {
+            if (blend) {
+                olivec_blend_span_pixels(dst, src + q0, n);
+            } else {
+                for (size_t i = 0; i < n; ++i) dst[i] = src[q0 + i];
+            }
+            continue;
+        }
+
+        if (dir < 0) dst += n - 1;
+        int64_t q = q0, r = r0;
+        for (size_t i = 0; i < n; ++i) {
+            if (blend) {
+                olivec_blend_color(dst, src[q]);
+            } else {
+                *dst = src[q];
+            }
+            dst += dir;
+            q += dq;
+            r += dr;
+            if (r >= aw) {
+                r -= aw;
+                q += 1;
+            }
         }
     }
 }
 
+OLIVECDEF void olivec_sprite_blend(Olivec_Canvas oc, int x, int y, int w, int h, Olivec_Canvas sprite)
+{
+    olivec_sprite_scale(oc, x, y, w, h, sprite, true);
+}
+
 OLIVECDEF void olivec_sprite_copy(Olivec_Canvas oc, int x, int y, int w, int h, Olivec_Canvas sprite)
+{
+    olivec_sprite_scale(oc, x, y, w, h, sprite, false);
+}
+
+// Linear interpolation between two colors with t in 0..256, two channels at a time: red and blue
+// in one 0x00FF00FF lane pair, green and alpha in the other. Every lane stays below 255*256, so the
+// channels never spill into each other.
+OLIVECDEF uint32_t olivec_lerp_pixel(uint32_t c1, uint32_t c2, uint32_t t)
+{
+    uint32_t s = 256 - t;
+    uint32_t rb = (((c1&0x00FF00FF)*s + (c2&0x00FF00FF)*t) >> 8)&0x00FF00FF;
+    uint32_t ga = ((((c1 >> 8)&0x00FF00FF)*s + ((c2 >> 8)&0x00FF00FF)*t) >> 8)&0x00FF00FF;
+    return rb|(ga << 8);
+}
+
+// Bilinear sample of the sprite at u, v given in 1/256 of a pixel. Centers of the pixels are at
+// the middle of them, everything outside of the centers of the border pixels is clamped to them.
+OLIVECDEF uint32_t olivec_sample_bilinear(Olivec_Canvas sprite, int64_t u, int64_t v)
+{
+    int64_t tx = u - 128, ty = v - 128;
+    int64_t x1 = tx < 0 ? 0 : tx >> 8, x2 = tx < 0 ? 0 : x1 + 1;
+    int64_t y1 = ty < 0 ? 0 : ty >> 8, y2 = ty < 0 ? 0 : y1 + 1;
+    int64_t mx = sprite.width - 1, my = sprite.height - 1;
+    if (x1 > mx) x1 = mx;
+    if (x2 > mx) x2 = mx;
+    if (y1 > my) y1 = my;
+    if (y2 > my) y2 = my;
+    uint32_t fx = tx&0xFF, fy = ty&0xFF;
+    const uint32_t *row1 = &OLIVEC_PIXEL(sprite, 0, y1);
+    const uint32_t *row2 = &OLIVEC_PIXEL(sprite, 0, y2);
+    return olivec_lerp_pixel(olivec_lerp_pixel(row1[x1], row1[x2], fx),
+                             olivec_lerp_pixel(row2[x1], row2[x2], fx),
+                             fy);
+}
+
+// Samples the sprite at nx/w, ny/h pixels
+OLIVECDEF uint32_t olivec_pixel_bilinear(Olivec_Canvas sprite, int nx, int ny, int w, int h)
+{
+    return olivec_sample_bilinear(sprite, (int64_t) nx*256/w, (int64_t) ny*256/h);
+}
+
+// Same mapping as olivec_sprite_scale(): a destination pixel d pixels away from x samples the sprite at
+// d*sprite.width/|w|. The sample position is stepped in 1/256 of a pixel with an integer quotient and
+// remainder, and the row of the sprite is picked once per row.
+OLIVECDEF void olivec_sprite_copy_bilinear(Olivec_Canvas oc, int x, int y, int w, int h, Olivec_Canvas sprite)
 {
     if (sprite.width == 0) return;
     if (sprite.height == 0) return;
 
-    // TODO: consider introducing flip parameter instead of relying on negative width and height
-    // Similar to how SDL_RenderCopyEx does that
     Olivec_Normalized_Rect nr = {0};
     if (!olivec_normalize_rect(x, y, w, h, oc.width, oc.height, &nr)) return;
+    olivec_damage(oc, nr.x1, nr.y1, nr.x2 - nr.x1 + 1, nr.y2 - nr.y1 + 1);
+
+    int64_t sw = (int64_t) sprite.width*256, sh = (int64_t) sprite.height*256;
+    int64_t aw = OLIVEC_ABS(int64_t, (int64_t) w);
+    int64_t ah = OLIVEC_ABS(int64_t, (int64_t) h);
+    size_t n = nr.x2 - nr.x1 + 1;
+    int64_t mx = sprite.width - 1;
+
+    int64_t d0 = w > 0 ? nr.x1 - x : x - nr.x2;
+    int dir = w > 0 ? 1 : -1;
+    int64_t q0 = d0*sw/aw, r0 = d0*sw%aw;
+    int64_t dq = sw/aw, dr = sw%aw;
+
+    for (int py = nr.y1; py <= nr.y2; ++py) {
+        int64_t ty = (h > 0 ? py - y : y - py)*sh/ah - 128;
+        int64_t y1 = ty < 0 ? 0 : ty >> 8, y2 = ty < 0 ? 0 : y1 + 1;
+        if (y1 > (int64_t) sprite.height - 1) y1 = sprite.height - 1;
+        if (y2 > (int64_t) sprite.height - 1) y2 = sprite.height - 1;
+        uint32_t fy = ty&0xFF;
+        const uint32_t *row1 = &OLIVEC_PIXEL(sprite, 0, y1);
+        const uint32_t *row2 = &OLIVEC_PIXEL(sprite, 0, y2);
+
+        uint32_t *dst = &OLIVEC_PIXEL(oc, nr.x1, py);
+        if (dir < 0) dst += n - 1;
+        int64_t q = q0, r = r0;
+        for (size_t i = 0; i < n; ++i) {
+            int64_t tx = q - 128;
+            int64_t x1 = tx < 0 ? 0 : tx >> 8, x2 = tx < 0 ? 0 : x1 + 1;
+            if (x1 > mx) x1 = mx;
+            if (x2 > mx) x2 = mx;
+            uint32_t fx = tx&0xFF;
+            *dst = olivec_lerp_pixel(olivec_lerp_pixel(row1[x1], row1[x2], fx),
+                                     olivec_lerp_pixel(row2[x1], row2[x2], fx),
+                                     fy);
+            dst += dir;
+            q += dq;
+            r += dr;
+            if (r >= aw) {
+                r -= aw;
+                q += 1;
+            }
+        }
+    }
+}
 
-    int xa = nr.ox1;
-    if (w < 0) xa = nr.ox2;
-    int ya = nr.oy1;
-    if (h < 0) ya = nr.oy2;
-    for (int y = nr.y1; y <= nr.y2; ++y) {
-        for (int x = nr.x1; x <= nr.x2; ++x) {
-            size_t nx = (x - xa)*((int) sprite.width)/w;
-            size_t ny = (y - ya)*((int) sprite.height)/h;
-            OLIVEC_PIXEL(oc, x, y) = OLIVEC_PIXEL(sprite, nx, ny);
+#ifdef OLIVEC_TILED
+#include <stdlib.h>
+
+#ifndef OLIVEC_REALLOC
+#define OLIVEC_REALLOC realloc
+#endif
+#ifndef OLIVEC_FREE
+#define OLIVEC_FREE free
+#endif
+
+OLIVECDEF bool olivec_tiled_reserve(void **items, size_t *capacity, size_t required, size_t item_size)
+{
+    if (required <= *capacity) return true;
+    size_t new_capacity = *capacity ? *capacity : 64;
+    while (new_capacity < required) new_capacity *= 2;
+    void *new_items = OLIVEC_REALLOC(*items, new_capacity*item_size);
+    if (new_items == NULL) return false;
+    *items = new_items;
+    *capacity = new_capacity;
+    return true;
+}
+
+OLIVECDEF void olivec_tiled_draw_tile(Olivec_Tiled *tiled, size_t t)
+{
+    size_t begin = tiled->bins[t];
+    size_t end = tiled->bins[t + 1];
+    if (begin == end) return;
+
+    int ox = (t%tiled->tiles_x)*tiled->tile_size;
+    int oy = (t/tiled->tiles_x)*tiled->tile_size;
+    Olivec_Canvas tile = olivec_subcanvas(tiled->oc, ox, oy, tiled->tile_size, tiled->tile_size);
+    // The tiles are drawn by several threads at once, the damage is marked by olivec_tiled_push() instead
+    tile.damage = NULL;
+    for (size_t i = begin; i < end; ++i) {
+        const Olivec_Command *cmd = &tiled->commands[tiled->bin_items[i]];
+        switch (cmd->kind) {
+        case OLIVEC_COMMAND_FILL:
+            olivec_fill(tile, cmd->color);
+            break;
+        case OLIVEC_COMMAND_RECT:
+            olivec_rect(tile, cmd->x1 - ox, cmd->y1 - oy, cmd->w, cmd->h, cmd->color);
+            break;
+        case OLIVEC_COMMAND_CIRCLE:
+            olivec_circle(tile, cmd->x1 - ox, cmd->y1 - oy, cmd->w, cmd->color);
+            break;
+        case OLIVEC_COMMAND_TRIANGLE:
+            olivec_triangle(tile, cmd->x1 - ox, cmd->y1 - oy, cmd->x2 - ox, cmd->y2 - oy, cmd->x3 - ox, cmd->y3 - oy, cmd->color);
+            break;
+        case OLIVEC_COMMAND_SPRITE_BLEND:
+            olivec_sprite_blend(tile, cmd->x1 - ox, cmd->y1 - oy, cmd->w, cmd->h, cmd->sprite);
+            break;
+        case OLIVEC_COMMAND_SPRITE_COPY:
+            olivec_sprite_copy(tile, cmd->x1 - ox, cmd->y1 - oy, cmd->w, cmd->h, cmd->sprite);
+            break;
+        case OLIVEC_COMMAND_TEXT:
+            // olivec_text() skips every glyph cell whose top left corner is outside of the canvas. Inside of a tile
+            // that check has to be done against the whole canvas, otherwise cells crossing the tile border get lost.
+            olivec_text_cells(tile, ox, oy, tiled->oc.width, tiled->oc.height, &tiled->chars[cmd->text], cmd->x1, cmd->y1, cmd->font, cmd->glyph_size, cmd->color);
+            break;
         }
     }
 }
 
-// TODO: olivec_pixel_bilinear does not check for out-of-bounds
-// But maybe it shouldn't. Maybe it's a responsibility of the caller of the function.
-OLIVECDEF uint32_t olivec_pixel_bilinear(Olivec_Canvas sprite, int nx, int ny, int w, int h)
+// Grabs tiles until there are none left. Called by the workers and by olivec_tiled_flush() itself.
+OLIVECDEF void olivec_tiled_draw_tiles(Olivec_Tiled *tiled)
+{
+    size_t tiles_count = tiled->tiles_x*tiled->tiles_y;
+    for (;;) {
+        pthread_mutex_lock(&tiled->mutex);
+        size_t t = tiled->next_tile++;
+        pthread_mutex_unlock(&tiled->mutex);
+        if (t >= tiles_count) break;
+        olivec_tiled_draw_tile(tiled, t);
+    }
+}
+
+OLIVECDEF void *olivec_tiled_worker(void *arg)
 {
-    int px = nx%w;
-    int py = ny%h;
+    Olivec_Tiled *tiled = arg;
+    size_t generation = 0;
+    pthread_mutex_lock(&tiled->mutex);
+    for (;;) {
+        while (!tiled->quit && tiled->generation == generation) {
+            pthread_cond_wait(&tiled->work, &tiled->mutex);
+        }
+        if (tiled->quit) break;
+        generation = tiled->generation;
+        pthread_mutex_unlock(&tiled->mutex);
 
-    int x1 = nx/w, x2 = nx/w;
-    int y1 = ny/h, y2 = ny/h;
-    if (px < w/2) {
-        // left
-        px += w/2;
-        x1 -= 1;
-        if (x1 < 0) x1 = 0;
-    } else {
-        // right
-        px -= w/2;
-        x2 += 1;
-        if ((size_t) x2 >= sprite.width) x2 = sprite.width - 1;
+        olivec_tiled_draw_tiles(tiled);
+
+        pthread_mutex_lock(&tiled->mutex);
+        tiled->busy -= 1;
+        if (tiled->busy == 0) pthread_cond_signal(&tiled->done);
     }
+    pthread_mutex_unlock(&tiled->mutex);
+    return NULL;
+}
 
-    if (py < h/2) {
-        // top
-        py += h/2;
-        y1 -= 1;
-        if (y1 < 0) y1 = 0;
-    } else {
-        // bottom
-        py -= h/2;
-        y2 += 1;
-        if ((size_t) y2 >= sprite.height) y2 = sprite.height - 1;
+OLIVECDEF bool olivec_tiled_init(Olivec_Tiled *tiled, size_t tile_size, size_t threads_count)
+{
+    if (tile_size == 0) return false;
+    *tiled = (Olivec_Tiled) {0};
+    tiled->tile_size = tile_size;
+    if (pthread_mutex_init(&tiled->mutex, NULL) != 0) return false;
+    pthread_cond_init(&tiled->work, NULL);
+    pthread_cond_init(&tiled->done, NULL);
+
+    if (threads_count > 0) {
+        tiled->threads = OLIVEC_REALLOC(NULL, threads_count*sizeof(*tiled->threads));
+        if (tiled->threads == NULL) {
+            olivec_tiled_free(tiled);
+            return false;
+        }
+        for (; tiled->threads_count < threads_count; ++tiled->threads_count) {
+            if (pthread_create(&tiled->threads[tiled->threads_count], NULL, olivec_tiled_worker, tiled) != 0) {
+                olivec_tiled_free(tiled);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+OLIVECDEF void olivec_tiled_free(Olivec_Tiled *tiled)
+{
+    pthread_mutex_lock(&tiled->mutex);
+    tiled->quit = true;
+    pthread_cond_broadcast(&tiled->work);
+    pthread_mutex_unlock(&tiled->mutex);
+    for (size_t i = 0; i < tiled->threads_count; ++i) {
+        pthread_join(tiled->threads[i], NULL);
     }
 
-    return mix_colors2(mix_colors2(OLIVEC_PIXEL(sprite, x1, y1),
-                                   OLIVEC_PIXEL(sprite, x2, y1),
-                                   px, w),
-                       mix_colors2(OLIVEC_PIXEL(sprite, x1, y2),
-                                   OLIVEC_PIXEL(sprite, x2, y2),
-                                   px, w),
-                       py, h);
+    pthread_cond_destroy(&tiled->done);
+    pthread_cond_destroy(&tiled->work);
+    pthread_mutex_destroy(&tiled->mutex);
+    OLIVEC_FREE(tiled->threads);
+    OLIVEC_FREE(tiled->commands);
+    OLIVEC_FREE(tiled->chars);
+    OLIVEC_FREE(tiled->bins);
+    OLIVEC_FREE(tiled->bin_items);
+    *tiled = (Olivec_Tiled) {0};
 }
 
-OLIVECDEF void olivec_sprite_copy_bilinear(Olivec_Canvas oc, int x, int y, int w, int h, Olivec_Canvas sprite)
+OLIVECDEF void olivec_tiled_begin(Olivec_Tiled *tiled, Olivec_Canvas oc)
+{
+    tiled->oc = oc;
+    tiled->tiles_x = (oc.width + tiled->tile_size - 1)/tiled->tile_size;
+    tiled->tiles_y = (oc.height + tiled->tile_size - 1)/tiled->tile_size;
+    tiled->commands_count = 0;
+    tiled->chars_count = 0;
+}
+
+// Takes the command with its bounding box set and drops it if the box misses the canvas.
+OLIVECDEF Olivec_Command *olivec_tiled_push(Olivec_Tiled *tiled, Olivec_Command cmd)
+{
+    if (cmd.lx < 0) cmd.lx = 0;
+    if (cmd.ly < 0) cmd.ly = 0;
+    if (cmd.hx >= (int) tiled->oc.width) cmd.hx = tiled->oc.width - 1;
+    if (cmd.hy >= (int) tiled->oc.height) cmd.hy = tiled->oc.height - 1;
+    if (cmd.lx > cmd.hx || cmd.ly > cmd.hy) return NULL;
+    if (!olivec_tiled_reserve((void**)&tiled->commands, &tiled->commands_capacity, tiled->commands_count + 1, sizeof(*tiled->commands))) return NULL;
+    Olivec_Command *result = &tiled->commands[tiled->commands_count++];
+    *result = cmd;
+    olivec_damage(tiled->oc, cmd.lx, cmd.ly, cmd.hx - cmd.lx + 1, cmd.hy - cmd.ly + 1);
+    return result;
+}
+
+OLIVECDEF void olivec_tiled_fill(Olivec_Tiled *tiled, uint32_t color)
 {
-    // TODO: support negative size in olivec_sprite_copy_bilinear()
-    if (w <= 0) return;
-    if (h <= 0) return;
+    olivec_tiled_push(tiled, (Olivec_Command) {
+        .kind = OLIVEC_COMMAND_FILL,
+        .lx = 0, .hx = tiled->oc.width - 1,
+        .ly = 0, .hy = tiled->oc.height - 1,
+        .color = color,
+    });
+}
 
+OLIVECDEF void olivec_tiled_rect(Olivec_Tiled *tiled, int x, int y, int w, int h, uint32_t color)
+{
     Olivec_Normalized_Rect nr = {0};
-    if (!olivec_normalize_rect(x, y, w, h, oc.width, oc.height, &nr)) return;
+    if (!olivec_normalize_rect(x, y, w, h, tiled->oc.width, tiled->oc.height, &nr)) return;
+    olivec_tiled_push(tiled, (Olivec_Command) {
+        .kind = OLIVEC_COMMAND_RECT,
+        .lx = nr.x1, .hx = nr.x2,
+        .ly = nr.y1, .hy = nr.y2,
+        .x1 = x, .y1 = y, .w = w, .h = h,
+        .color = color,
+    });
+}
 
-    for (int y = nr.y1; y <= nr.y2; ++y) {
-        for (int x = nr.x1; x <= nr.x2; ++x) {
-            size_t nx = (x - nr.ox1)*sprite.width;
-            size_t ny = (y - nr.oy1)*sprite.height;
-            OLIVEC_PIXEL(oc, x, y) = olivec_pixel_bilinear(sprite, nx, ny, w, h);
+OLIVECDEF void olivec_tiled_circle(Olivec_Tiled *tiled, int cx, int cy, int r, uint32_t color)
+{
+    Olivec_Normalized_Rect nr = {0};
+    int r1 = r + OLIVEC_SIGN(int, r);
+    if (!olivec_normalize_rect(cx - r1, cy - r1, 2*r1, 2*r1, tiled->oc.width, tiled->oc.height, &nr)) return;
+    olivec_tiled_push(tiled, (Olivec_Command) {
+        .kind = OLIVEC_COMMAND_CIRCLE,
+        .lx = nr.x1, .hx = nr.x2,
+        .ly = nr.y1, .hy = nr.y2,
+        .x1 = cx, .y1 = cy, .w = r,
+        .color = color,
+    });
+}
+
+OLIVECDEF void olivec_tiled_triangle(Olivec_Tiled *tiled, int x1, int y1, int x2, int y2, int x3, int y3, uint32_t color)
+{
+    int lx, hx, ly, hy;
+    if (!olivec_normalize_triangle(tiled->oc.width, tiled->oc.height, x1, y1, x2, y2, x3, y3, &lx, &hx, &ly, &hy)) return;
+    olivec_tiled_push(tiled, (Olivec_Command) {
+        .kind = OLIVEC_COMMAND_TRIANGLE,
+        .lx = lx, .hx = hx,
+        .ly = ly, .hy = hy,
+        .x1 = x1, .y1 = y1, .x2 = x2, .y2 = y2, .x3 = x3, .y3 = y3,
+        .color = color,
+    });
+}
+
+OLIVECDEF void olivec_tiled_sprite(Olivec_Tiled *tiled, Olivec_Command_Kind kind, int x, int y, int w, int h, Olivec_Canvas sprite)
+{
+    if (sprite.width == 0) return;
+    if (sprite.height == 0) return;
+    Olivec_Normalized_Rect nr = {0};
+    if (!olivec_normalize_rect(x, y, w, h, tiled->oc.width, tiled->oc.height, &nr)) return;
+    olivec_tiled_push(tiled, (Olivec_Command) {
+        .kind = kind,
+        .lx = nr.x1, .hx = nr.x2,
+        .ly = nr.y1, .hy = nr.y2,
+        .x1 = x, .y1 = y, .w = w, .h = h,
+        .sprite = sprite,
+    });
+}
+
+OLIVECDEF void olivec_tiled_sprite_blend(Olivec_Tiled *tiled, int x, int y, int w, int h, Olivec_Canvas sprite)
+{
+    olivec_tiled_sprite(tiled, OLIVEC_COMMAND_SPRITE_BLEND, x, y, w, h, sprite);
+}
+
+OLIVECDEF void olivec_tiled_sprite_copy(Olivec_Tiled *tiled, int x, int y, int w, int h, Olivec_Canvas sprite)
+{
+    olivec_tiled_sprite(tiled, OLIVEC_COMMAND_SPRITE_COPY, x, y, w, h, sprite);
+}
+
+OLIVECDEF void olivec_tiled_text(Olivec_Tiled *tiled, const char *text, int x, int y, Olivec_Font font, size_t size, uint32_t color)
+{
+    size_t n = 0;
+    while (text[n]) ++n;
+    if (n == 0) return;
+
+    // Glyph cells start at x + i*font.width*size and cover size pixels after that
+    Olivec_Command *cmd = olivec_tiled_push(tiled, (Olivec_Command) {
+        .kind = OLIVEC_COMMAND_TEXT,
+        .lx = x, .hx = x + (n*font.width - 1)*size + size - 1,
+        .ly = y, .hy = y + (font.height - 1)*size + size - 1,
+        .x1 = x, .y1 = y,
+        .color = color,
+        .font = font,
+        .glyph_size = size,
+    });
+    if (cmd == NULL) return;
+    if (!olivec_tiled_reserve((void**)&tiled->chars, &tiled->chars_capacity, tiled->chars_count + n + 1, sizeof(*tiled->chars))) {
+        tiled->commands_count -= 1;
+        return;
+    }
+    cmd->text = tiled->chars_count;
+    for (size_t i = 0; i <= n; ++i) tiled->chars[tiled->chars_count++] = text[i];
+}
+
+OLIVECDEF void olivec_tiled_flush(Olivec_Tiled *tiled)
+{
+    size_t tiles_count = tiled->tiles_x*tiled->tiles_y;
+    size_t ts = tiled->tile_size;
+    if (tiled->commands_count == 0 || tiles_count == 0) return;
+    if (!olivec_tiled_reserve((void**)&tiled->bins, &tiled->bins_capacity, tiles_count + 1, sizeof(*tiled->bins))) return;
+
+    // Counting sort of the commands by tiles. Commands are visited in the recording order,
+    // so each bin ends up in the recording order as well.
+    for (size_t t = 0; t <= tiles_count; ++t) tiled->bins[t] = 0;
+    for (size_t i = 0; i < tiled->commands_count; ++i) {
+        const Olivec_Command *cmd = &tiled->commands[i];
+        for (size_t ty = cmd->ly/ts; ty <= cmd->hy/ts; ++ty) {
+            for (size_t tx = cmd->lx/ts; tx <= cmd->hx/ts; ++tx) {
+                tiled->bins[ty*tiled->tiles_x + tx + 1] += 1;
+            }
         }
     }
+    for (size_t t = 0; t < tiles_count; ++t) tiled->bins[t + 1] += tiled->bins[t];
+    if (!olivec_tiled_reserve((void**)&tiled->bin_items, &tiled->bin_items_capacity, tiled->bins[tiles_count], sizeof(*tiled->bin_items))) return;
+    for (size_t i = 0; i < tiled->commands_count; ++i) {
+        const Olivec_Command *cmd = &tiled->commands[i];
+        for (size_t ty = cmd->ly/ts; ty <= cmd->hy/ts; ++ty) {
+            for (size_t tx = cmd->lx/ts; tx <= cmd->hx/ts; ++tx) {
+                tiled->bin_items[tiled->bins[ty*tiled->tiles_x + tx]++] = i;
+            }
+        }
+    }
+    // Filling advanced every bin to the beginning of the next one, shift them back
+    for (size_t t = tiles_count; t > 0; --t) tiled->bins[t] = tiled->bins[t - 1];
+    tiled->bins[0] = 0;
+
+    pthread_mutex_lock(&tiled->mutex);
+    tiled->next_tile = 0;
+    tiled->busy = tiled->threads_count;
+    tiled->generation += 1;
+    pthread_cond_broadcast(&tiled->work);
+    pthread_mutex_unlock(&tiled->mutex);
+
+    olivec_tiled_draw_tiles(tiled);
+
+    pthread_mutex_lock(&tiled->mutex);
+    while (tiled->busy > 0) pthread_cond_wait(&tiled->done, &tiled->mutex);
+    pthread_mutex_unlock(&tiled->mutex);
+
+    tiled->commands_count = 0;
+    tiled->chars_count = 0;
+}
+#endif // OLIVEC_TILED
+
+#ifdef OLIVEC_MESH_FILE
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+OLIVECDEF bool olivec_mesh_file_map(const char *file_path, Olivec_Mesh_File *file, Olivec_Mesh *mesh)
+{
+    int fd = open(file_path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+    if (!olivec_mesh_from_memory(data, st.st_size, mesh)) {
+        munmap(data, st.st_size);
+        return false;
+    }
+    file->data = data;
+    file->size = st.st_size;
+    return true;
+}
+
+OLIVECDEF void olivec_mesh_file_unmap(Olivec_Mesh_File *file)
+{
+    if (file->data) munmap(file->data, file->size);
+    file->data = NULL;
+    file->size = 0;
 }
+#endif // OLIVEC_MESH_FILE
 
 #endif // OLIVEC_IMPLEMENTATION
 
-// TODO: Benchmarking
-// TODO: SIMD implementations
 // TODO: bezier curves
 // TODO: olivec_ring
 // TODO: fuzzer
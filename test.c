@@ -45,6 +45,8 @@ static void *context_realloc(void *oldp, size_t oldsz, size_t newsz)
 #include "./stb_image_write.h"
 
 #define OLIVEC_IMPLEMENTATION
+#define OLIVEC_TILED
+#define OLIVEC_MESH_FILE
 #include "olive.c"
 
 #define BACKGROUND_COLOR 0xFF202020
@@ -221,6 +223,29 @@ Olivec_Canvas test_fill_circle(void)
     return oc;
 }
 
+Olivec_Canvas test_tiled(void)
+{
+    size_t width = 200;
+    size_t height = 150;
+    Olivec_Canvas oc = canvas_alloc(width, height);
+    Olivec_Canvas sprite = olivec_canvas(tsodinPog_pixels, tsodinPog_width, tsodinPog_height, tsodinPog_width);
+
+    // Odd tile size, so that the primitives cross the tile borders at random places
+    Olivec_Tiled tiled = {0};
+    if (!olivec_tiled_init(&tiled, 27, 3)) return OLIVEC_CANVAS_NULL;
+    olivec_tiled_begin(&tiled, oc);
+    olivec_tiled_fill(&tiled, BACKGROUND_COLOR);
+    olivec_tiled_rect(&tiled, -width/4, -height/4, width/2, height/2, BLUE_COLOR);
+    olivec_tiled_circle(&tiled, width/2, height/2, height/3, 0x882020AA);
+    olivec_tiled_triangle(&tiled, width, 0, 0, height, width*3/4, height, GREEN_COLOR);
+    olivec_tiled_sprite_blend(&tiled, width/8, height/3, -width/3, height/3, sprite);
+    olivec_tiled_sprite_copy(&tiled, width*2/3, height/6, width/3, width/3, sprite);
+    olivec_tiled_text(&tiled, "tiled", width/4, height*3/4, olivec_default_font, 5, WHITE_COLOR);
+    olivec_tiled_flush(&tiled);
+    olivec_tiled_free(&tiled);
+    return oc;
+}
+
 Olivec_Canvas test_draw_line(void)
 {
     size_t width = 128;
@@ -233,6 +258,105 @@ Olivec_Canvas test_draw_line(void)
     return oc;
 }
 
+Olivec_Canvas test_draw_lines_clipped(void)
+{
+    size_t width = 128;
+    size_t height = 128;
+    Olivec_Canvas oc = canvas_alloc(width, height);
+    olivec_fill(oc, BACKGROUND_COLOR);
+    int w = width, h = height;
+    Olivec_Segment segments[] = {
+        {-w, -h/2, w*2, h*3/2},
+        {w/2, -h*3, w/4, h*2},
+        {w*3/2, h/4, -w/2, h*3/4},
+        {-10, h + 10, w + 10, -10},
+        {-w, -h, -1, h*2},
+        {w/3, h/3, w/3 + 5, h/3 - 40},
+    };
+    olivec_lines(oc, segments, sizeof(segments)/sizeof(segments[0]), RED_COLOR);
+    return oc;
+}
+
+Olivec_Canvas test_aa_lines(void)
+{
+    size_t width = 128;
+    size_t height = 128;
+    Olivec_Canvas oc = canvas_alloc(width, height);
+    olivec_fill(oc, BACKGROUND_COLOR);
+
+    Olivec_Point zigzag[] = {{10, 12}, {50, 20}, {14, 52}, {54, 58}};
+    for (size_t i = 0; i < 3; ++i) {
+        Olivec_Point points[4];
+        for (size_t j = 0; j < 4; ++j) {
+            points[j].x = zigzag[j].x + (i%2)*60;
+            points[j].y = zigzag[j].y + (i/2)*60;
+        }
+        Olivec_Stroke stroke = {.thickness = 7, .cap = (Olivec_Cap) i, .join = (Olivec_Join) i};
+        olivec_polyline_aa(oc, points, 4, stroke, GREEN_COLOR);
+    }
+
+    Olivec_Point wave[64];
+    for (size_t i = 0; i < 64; ++i) {
+        wave[i].x = 66 + i*0.9f;
+        wave[i].y = 96 + (i%8 < 4 ? i%8 : 8 - i%8)*6.5f - 13;
+    }
+    olivec_polyline_aa(oc, wave, 64, (Olivec_Stroke) {.thickness = 3}, 0x88FF2020);
+
+    olivec_line_aa(oc, -20, 120.3f, 150, 110.7f, (Olivec_Stroke) {.thickness = 1}, RED_COLOR);
+    return oc;
+}
+
+Olivec_Canvas test_aa_polyline_overlap(void)
+{
+    size_t width = 128;
+    size_t height = 128;
+    Olivec_Canvas oc = canvas_alloc(width, height);
+    olivec_fill(oc, BACKGROUND_COLOR);
+
+    // Dense random walk that keeps coming back to the same pixels across the tiles and the blocks of points
+    static Olivec_Point walk[3000];
+    uint32_t seed = 69;
+    walk[0] = (Olivec_Point) {width/2.0f, height/2.0f};
+    for (size_t i = 1; i < 3000; ++i) {
+        seed = seed*1664525 + 1013904223;
+        float dx = (float) (seed>>24)/128 - 1;
+        seed = seed*1664525 + 1013904223;
+        float dy = (float) (seed>>24)/128 - 1;
+        walk[i].x = walk[i - 1].x + dx*2;
+        walk[i].y = walk[i - 1].y + dy*2;
+        if (walk[i].x < 0 || walk[i].x > width) walk[i].x = walk[i - 1].x - dx*2;
+        if (walk[i].y < 0 || walk[i].y > height) walk[i].y = walk[i - 1].y - dy*2;
+    }
+    Olivec_Stroke stroke = {.thickness = 1.5f};
+    uint32_t color = 0x80FFFFFF;
+    olivec_polyline_aa(oc, walk, 3000, stroke, color);
+
+    // Every pixel must be blended once with the largest coverage of all the pieces,
+    // the ones that got anything else are marked
+    Olivec_Canvas expected = canvas_alloc(width, height);
+    olivec_fill(expected, BACKGROUND_COLOR);
+    uint8_t *coverage = context_alloc(width*height);
+    memset(coverage, 0, width*height);
+    Olivec_Stroke_Iter it = olivec_stroke_iter(walk, 3000, stroke);
+    Olivec_Stroke_Piece piece;
+    while (olivec_stroke_iter_next(&it, &piece)) {
+        for (int y = 0; y < (int) height; ++y) {
+            for (int x = 0; x < (int) width; ++x) {
+                uint8_t c = olivec_stroke_piece_coverage(&piece, x, y)*255 + 0.5f;
+                if (coverage[y*width + x] < c) coverage[y*width + x] = c;
+            }
+        }
+    }
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 0; x < width; ++x) {
+            uint32_t alpha = OLIVEC_ALPHA(color)*coverage[y*width + x]/255;
+            olivec_blend_color(&OLIVEC_PIXEL(expected, x, y), (color&0x00FFFFFF)|(alpha<<(3*8)));
+            if (OLIVEC_PIXEL(expected, x, y) != OLIVEC_PIXEL(oc, x, y)) OLIVEC_PIXEL(oc, x, y) = RED_COLOR;
+        }
+    }
+    return oc;
+}
+
 Olivec_Canvas test_fill_triangle(void)
 {
     size_t width = 128;
@@ -265,6 +389,287 @@ Olivec_Canvas test_fill_triangle(void)
     return oc;
 }
 
+static bool checker_shader(void *data, int x, int y, const float *varyings, uint32_t *color)
+{
+    (void) data;
+    (void) x;
+    (void) y;
+    // varyings: 1/z, u, v, brightness
+    int cell = ((int)(varyings[1]*8) + (int)(varyings[2]*8))%2;
+    uint32_t c = varyings[3]*(cell ? 0xFF : 0x40);
+    *color = OLIVEC_RGBA(c, c/2, c/4, 0xFF);
+    return cell || varyings[3] > 0.5f;
+}
+
+Olivec_Canvas test_triangle_varyings(void)
+{
+    size_t width = 128;
+    size_t height = 128;
+    Olivec_Canvas oc = canvas_alloc(width, height);
+    olivec_fill(oc, BACKGROUND_COLOR);
+
+    // A quad going into the distance, the far edge is 4 times further than the near one. The corners
+    // make the determinants of both triangles powers of two, so the interpolation is exact.
+    float z1 = 1, z2 = 1.0f/4;
+    float a[] = {z1, 0*z1, 1*z1, 1*z1};
+    float b[] = {z1, 1*z1, 1*z1, 1*z1};
+    float c[] = {z2, 1*z2, 0*z2, 0.25f*z2};
+    float d[] = {z2, 0*z2, 0*z2, 0.25f*z2};
+    olivec_triangle_varyings(oc, 0, height, width, height, width*5/8, 0, a, b, c, 4, true, checker_shader, NULL);
+    olivec_triangle_varyings(oc, 0, height, width*5/8, 0, width*3/8, 0, a, c, d, 4, true, checker_shader, NULL);
+    return oc;
+}
+
+static void depth_triangles(Olivec_Canvas oc, Olivec_Depth_Buffer db)
+{
+    int w = oc.width, h = oc.height;
+    olivec_fill(oc, BACKGROUND_COLOR);
+    olivec_depth_clear(db, 0);
+
+    // Two triangles going through each other, all the determinants are powers of two and the depths
+    // are dyadic, so the interpolation is exact
+    olivec_triangle_depth(oc, db, 0, 0, w, 0, 0, h, 1, 0, 0.5f, RED_COLOR);
+    olivec_triangle3c_depth(oc, db, 0, 0, w, h, 0, h, 0, 1, 1, RED_COLOR, GREEN_COLOR, BLUE_COLOR);
+
+    // A flat one through both of them that discards some of its pixels
+    float a[] = {0.75f, 0, 0, 1};
+    float b[] = {0.75f, 1, 0, 1};
+    float c[] = {0.75f, 0, 1, 0.25f};
+    olivec_triangle_varyings_depth(oc, db, 0, h/2, w, h/2, 0, h, a, b, c, 4, false, checker_shader, NULL);
+}
+
+Olivec_Canvas test_depth_triangles(void)
+{
+    size_t width = 128;
+    size_t height = 128;
+    Olivec_Canvas oc = canvas_alloc(width*2, height);
+
+    // Left half is tested against a float depth buffer and the right one against a 16-bit one with
+    // tiles, which must not change anything
+    static float depth[128*128];
+    static uint16_t depth16[128*128];
+    static Olivec_Depth_Tile tiles[OLIVEC_DEPTH_TILES(128, 128)];
+    Olivec_Depth_Buffer db = olivec_depth_buffer(depth, width, height, width);
+    Olivec_Depth_Buffer db16 = olivec_depth_buffer_tiles(olivec_depth_buffer16(depth16, width, height, width), tiles);
+    depth_triangles(olivec_subcanvas(oc, 0, 0, width, height), db);
+    depth_triangles(olivec_subcanvas(oc, width, 0, width, height), db16);
+    return oc;
+}
+
+static bool palette_shader(void *data, int x, int y, const float *varyings, uint32_t *color)
+{
+    (void) x;
+    (void) y;
+    // varyings: 1/z, b1, b2, palette index
+    const uint32_t *palette = data;
+    *color = palette[(int)(varyings[3] + 0.5f)];
+    return true;
+}
+
+Olivec_Canvas test_mesh_clipped(void)
+{
+    size_t width = 128;
+    size_t height = 128;
+    Olivec_Canvas oc = canvas_alloc(width, height);
+    olivec_fill(oc, BACKGROUND_COLOR);
+    static float depth[128*128];
+    Olivec_Depth_Buffer db = olivec_depth_buffer(depth, width, height, width);
+    olivec_depth_clear(db, 0);
+
+    // x, y, z, palette index. All the clipped vertices land on dyadic coordinates.
+    static const float vertices[] = {
+        // Floor going behind the camera through the near plane
+        -1, -1, -3, 0,
+         1, -1, -3, 0,
+         1, -1,  1, 1,
+        -1, -1,  1, 1,
+        // Far beyond the left edge of the guard band
+        -195, 0.25f, -1, 2,
+          65, 0.25f, -1, 2,
+          65, 0.75f, -1, 2,
+        // Counter-clockwise and clockwise
+        -1.5f, -0.5f, -2, 3,
+        -0.5f, -0.5f, -2, 3,
+        -1.0f, 0.25f, -2, 3,
+         0.5f, -0.5f, -2, 1,
+         1.0f, 0.25f, -2, 1,
+         1.5f, -0.5f, -2, 1,
+    };
+    static const int indices[] = {
+        0, 3, 2,  0, 2, 1,
+        4, 5, 6,
+        7, 8, 9,
+        10, 11, 12,
+    };
+    uint32_t palette[] = {RED_COLOR, GREEN_COLOR, BLUE_COLOR, 0xFF20FFFF};
+    Olivec_Mesh mesh = {
+        .positions = vertices,
+        .attributes = vertices + 3,
+        .attribute_count = 1,
+        .stride = 4,
+        .vertex_count = 13,
+        .indices = indices,
+        .indices_stride = 3,
+        .triangle_count = 5,
+    };
+    float scratch[OLIVEC_MESH_SCRATCH(13)];
+    olivec_mesh(oc, db, &mesh, olivec_mat4_perspective(1, 1), 0.5f, OLIVEC_CULL_BACK, scratch, palette_shader, palette);
+    return oc;
+}
+
+Olivec_Canvas test_mesh_lod(void)
+{
+    size_t size = 64;
+    Olivec_Canvas oc = canvas_alloc(size*3, size);
+    olivec_fill(oc, BACKGROUND_COLOR);
+    static float depth[64*64];
+    Olivec_Depth_Buffer db = olivec_depth_buffer(depth, size, size, size);
+
+    // The same quad at every level, only the palette index tells them apart. Moving the quad twice as far
+    // halves the error in pixels and lets the next level through.
+    static const float vertices[] = {
+        -0.5f, -0.5f, 0, 0,  0.5f, -0.5f, 0, 0,  0.5f, 0.5f, 0, 0,  -0.5f, 0.5f, 0, 0,
+        -0.5f, -0.5f, 0, 1,  0.5f, -0.5f, 0, 1,  0.5f, 0.5f, 0, 1,  -0.5f, 0.5f, 0, 1,
+        -0.5f, -0.5f, 0, 2,  0.5f, -0.5f, 0, 2,  0.5f, 0.5f, 0, 2,  -0.5f, 0.5f, 0, 2,
+    };
+    static const int indices[] = {0, 1, 2,  0, 2, 3};
+    static const float errors[] = {0, 0.05f, 0.1f};
+    uint32_t palette[] = {RED_COLOR, GREEN_COLOR, BLUE_COLOR};
+    float scratch[OLIVEC_MESH_SCRATCH(4)];
+
+    for (size_t i = 0; i < 3; ++i) {
+        Olivec_Canvas sub = olivec_subcanvas(oc, i*size, 0, size, size);
+        olivec_depth_clear(db, 0);
+        Olivec_Mat4 transform = olivec_mat4_mul(olivec_mat4_perspective(1, 1), olivec_mat4_translate(0, 0, -(float)(1<<i)));
+        size_t lod = olivec_mesh_lod(sub, transform, errors, 3, 1);
+        Olivec_Mesh mesh = {
+            .positions = &vertices[lod*16],
+            .attributes = &vertices[lod*16 + 3],
+            .attribute_count = 1,
+            .stride = 4,
+            .vertex_count = 4,
+            .indices = indices,
+            .indices_stride = 3,
+            .triangle_count = 2,
+        };
+        olivec_mesh(sub, db, &mesh, transform, 0.5f, OLIVEC_CULL_BACK, scratch, palette_shader, palette);
+    }
+    return oc;
+}
+
+Olivec_Canvas test_mesh_file(void)
+{
+    size_t width = 128;
+    size_t height = 128;
+    Olivec_Canvas oc = canvas_alloc(width, height);
+    olivec_fill(oc, BACKGROUND_COLOR);
+    static float depth[128*128];
+    Olivec_Depth_Buffer db = olivec_depth_buffer(depth, width, height, width);
+    olivec_depth_clear(db, 0);
+
+    // A quad and a triangle in front of it. The first texture coordinate is the palette index.
+    typedef struct {
+        Olivec_Mesh_File_Header header;
+        float vertices[7][5];
+        uint16_t indices[9];
+    } File;
+    static const File file = {
+        .header = {
+            .magic = OLIVEC_MESH_FILE_MAGIC,
+            .version = OLIVEC_MESH_FILE_VERSION,
+            .flags = OLIVEC_MESH_FILE_TEXCOORDS|OLIVEC_MESH_FILE_INDICES16,
+            .stride = 5,
+            .vertex_count = 7,
+            .triangle_count = 3,
+            .vertices_offset = offsetof(File, vertices),
+            .indices_offset = offsetof(File, indices),
+        },
+        .vertices = {
+            {-1, -1, -2, 1, 0},
+            { 1, -1, -2, 1, 0},
+            { 1,  1, -2, 1, 0},
+            {-1,  1, -2, 1, 0},
+            {-0.75f, -0.5f,  -1, 2, 0},
+            { 0.25f, -0.5f,  -1, 2, 0},
+            {-0.25f,  0.25f, -1, 2, 0},
+        },
+        .indices = {0, 1, 2,  0, 2, 3,  4, 5, 6},
+    };
+
+    Olivec_Mesh mesh = {0};
+    if (!olivec_mesh_from_memory(&file, sizeof(file), &mesh)) return oc;
+
+    // Broken files must be rejected
+    File broken = file;
+    broken.indices[8] = 7;
+    Olivec_Mesh unused;
+    if (olivec_mesh_from_memory(&broken, sizeof(broken), &unused)) return oc;
+    broken = file;
+    broken.header.indices_offset += 2;
+    if (olivec_mesh_from_memory(&broken, sizeof(broken), &unused)) return oc;
+
+    uint32_t palette[] = {RED_COLOR, GREEN_COLOR, BLUE_COLOR, 0xFF20FFFF};
+    float scratch[OLIVEC_MESH_SCRATCH(7)];
+    olivec_mesh(oc, db, &mesh, olivec_mat4_perspective(1, 1), 0.5f, OLIVEC_CULL_BACK, scratch, palette_shader, palette);
+    return oc;
+}
+
+// The varyings of vertices that don't land on dyadic coordinates vary with the floating point contractions
+// of the compiler, so only the coverage is checked
+static bool solid_shader(void *data, int x, int y, const float *varyings, uint32_t *color)
+{
+    (void) x;
+    (void) y;
+    (void) varyings;
+    *color = *(const uint32_t*)data;
+    return true;
+}
+
+Olivec_Canvas test_mesh_file_map(void)
+{
+    size_t width = 128;
+    size_t height = 128;
+    Olivec_Canvas oc = canvas_alloc(width, height);
+    olivec_fill(oc, BACKGROUND_COLOR);
+    static float depth[128*128];
+    Olivec_Depth_Buffer db = olivec_depth_buffer(depth, width, height, width);
+    olivec_depth_clear(db, 0);
+
+    // Anything but a mesh file must be rejected
+    Olivec_Mesh_File file = {0};
+    Olivec_Mesh mesh = {0};
+    if (olivec_mesh_file_map("./test/fill_rect_expected.png", &file, &mesh)) return oc;
+
+    // The cup written by obj2c -b during the build
+    if (!olivec_mesh_file_map("./build/assets/tsodinCupLowPoly.olvm", &file, &mesh)) return oc;
+    float *scratch = context_alloc(sizeof(float)*OLIVEC_MESH_SCRATCH(mesh.vertex_count));
+    uint32_t color = GREEN_COLOR;
+    Olivec_Mat4 transform = olivec_mat4_perspective(1, 1);
+    transform = olivec_mat4_mul(transform, olivec_mat4_translate(0, 0, -1.5f));
+    transform = olivec_mat4_mul(transform, olivec_mat4_rotate_x(cosf(0.5f), sinf(0.5f)));
+    olivec_mesh(oc, db, &mesh, transform, 0.1f, OLIVEC_CULL_BACK, scratch, solid_shader, &color);
+    olivec_mesh_file_unmap(&file);
+    return oc;
+}
+
+Olivec_Canvas test_fill_triangle_aa(void)
+{
+    size_t width = 128;
+    size_t height = 128;
+    Olivec_Canvas oc = canvas_alloc(width, height);
+
+    olivec_fill(oc, BACKGROUND_COLOR);
+
+    olivec_triangle_aa(oc, width/2.0f, height/8.0f, width/8.0f, height/2.0f, width*7/8.0f, height*7/8.0f, RED_COLOR);
+    olivec_triangle_aa(oc, width/2.0f + 0.25f, height*2/8.0f, width*2/8.0f, height/2.0f + 0.5f, width*6/8.0f, height/2.0f, 0x7720AA20);
+    olivec_triangle3c_aa(oc, width/8.0f, height*5/8.0f, width*3/8.0f, height - 4.5f, 3.75f, height - 10.25f, RED_COLOR, GREEN_COLOR, BLUE_COLOR);
+    olivec_triangle_aa(oc, -20, height - 2.0f, width + 20.0f, height - 30.0f, width + 20.0f, height - 28.0f, WHITE_COLOR);
+    // Sliver that gets at most 0.2 pixels thin, it must stay faint
+    olivec_triangle_aa(oc, 4.0f, 6.0f, 4.0f, 6.2f, width/3.0f, height*3/8.0f, WHITE_COLOR);
+
+    return oc;
+}
+
 Olivec_Canvas test_alpha_blending(void)
 {
     size_t width = 128;
@@ -387,6 +792,110 @@ Olivec_Canvas test_hello_world_text_rendering(void)
     return oc;
 }
 
+Olivec_Canvas test_text_clipped(void)
+{
+    Olivec_Canvas oc = canvas_alloc(128, 64);
+    olivec_fill(oc, BACKGROUND_COLOR);
+    // Glyph cells that start outside of the canvas are skipped, the ones that start inside are clipped
+    olivec_text(oc, "clipped", -13, -7, olivec_default_font, 4, RED_COLOR);
+    olivec_text(oc, "olive.c", 75, 50, olivec_default_font, 3, GREEN_COLOR);
+    olivec_text(oc, "abc", 10, 30, olivec_default_font, 1, FOREGROUND_COLOR);
+    olivec_text(oc, "42", 30, 26, olivec_default_font, 2, 0x88AA2020);
+    return oc;
+}
+
+Olivec_Canvas test_damage(void)
+{
+    size_t width = 128;
+    size_t height = 128;
+    Olivec_Canvas oc = canvas_alloc(width, height);
+    olivec_fill(oc, BACKGROUND_COLOR);
+
+    Olivec_Damage damage;
+    Olivec_Canvas tracked = olivec_damage_track(oc, &damage);
+    olivec_rect(tracked, 8, 8, 24, 16, RED_COLOR);
+    // Adjacent to the previous one, the two become a single rectangle
+    olivec_rect(tracked, 32, 8, 16, 16, RED_COLOR);
+    olivec_circle(tracked, 100, 24, 12, GREEN_COLOR);
+    olivec_line(tracked, 10, 120, 40, 90, BLUE_COLOR);
+    olivec_text(tracked, "hi", 60, 100, olivec_default_font, 2, WHITE_COLOR);
+    olivec_rect(tracked, -10, 60, 20, 10, GREEN_COLOR);
+    // Reported in the coordinates of the tracked canvas
+    Olivec_Canvas sub = olivec_subcanvas(tracked, 64, 40, 48, 40);
+    olivec_triangle(sub, 0, 0, 47, 10, 20, 39, FOREGROUND_COLOR);
+    // More rectangles than the tracker has room for
+    for (int i = 0; i < 6; ++i) {
+        olivec_rect(tracked, 16 + i*8, 40 + i*6, 3, 3, WHITE_COLOR);
+    }
+
+    for (size_t i = 0; i < damage.count; ++i) {
+        Olivec_Damage_Rect r = damage.rects[i];
+        olivec_frame(oc, r.x, r.y, r.w, r.h, 1, 0xFF20AAAA);
+    }
+    return oc;
+}
+
+static bool damage_has_rect(const Olivec_Damage *damage, int x, int y, int w, int h)
+{
+    for (size_t i = 0; i < damage->count; ++i) {
+        Olivec_Damage_Rect r = damage->rects[i];
+        if (r.x == x && r.y == y && r.w == w && r.h == h) return true;
+    }
+    return false;
+}
+
+static bool damage_covers(const Olivec_Damage *damage, int x, int y, int w, int h)
+{
+    for (size_t i = 0; i < damage->count; ++i) {
+        Olivec_Damage_Rect r = damage->rects[i];
+        if (r.x <= x && r.y <= y && x + w <= r.x + r.w && y + h <= r.y + r.h) return true;
+    }
+    return false;
+}
+
+Olivec_Canvas test_damage_rects(void)
+{
+    size_t width = 128;
+    size_t height = 128;
+    Olivec_Canvas oc = canvas_alloc(width, height);
+    olivec_fill(oc, BACKGROUND_COLOR);
+    Olivec_Damage damage;
+    Olivec_Canvas tracked = olivec_damage_track(oc, &damage);
+
+    // Adjacent rectangles are merged, the ones within already damaged area add nothing
+    olivec_rect(tracked, 8, 8, 24, 16, RED_COLOR);
+    olivec_rect(tracked, 32, 8, 16, 16, RED_COLOR);
+    olivec_rect(tracked, 20, 12, 4, 4, GREEN_COLOR);
+    if (damage.count != 1 || !damage_has_rect(&damage, 8, 8, 40, 16)) return OLIVEC_CANVAS_NULL;
+
+    // Far apart rectangles stay apart
+    olivec_rect(tracked, 96, 96, 16, 16, RED_COLOR);
+    if (damage.count != 2 || !damage_has_rect(&damage, 96, 96, 16, 16)) return OLIVEC_CANVAS_NULL;
+
+    // Subcanvases report in the coordinates of the tracked canvas, clipped to themselves
+    Olivec_Canvas sub = olivec_subcanvas(tracked, 64, 40, 48, 40);
+    olivec_rect(sub, 2, 3, 10, 5, BLUE_COLOR);
+    if (!damage_has_rect(&damage, 66, 43, 10, 5)) return OLIVEC_CANVAS_NULL;
+    Olivec_Canvas subsub = olivec_subcanvas(sub, 20, 20, 20, 16);
+    olivec_rect(subsub, -5, -5, 10, 10, BLUE_COLOR);
+    if (!damage_has_rect(&damage, 84, 60, 5, 5)) return OLIVEC_CANVAS_NULL;
+
+    // Once the tracker is full the rectangles are merged into the ones that grow the least,
+    // but everything drawn stays covered
+    for (int i = 0; i < 12; ++i) {
+        olivec_rect(tracked, 4 + i*10, 32 + (i%3)*20, 3, 3, WHITE_COLOR);
+    }
+    if (damage.count > OLIVEC_DAMAGE_RECTS) return OLIVEC_CANVAS_NULL;
+    for (int i = 0; i < 12; ++i) {
+        if (!damage_covers(&damage, 4 + i*10, 32 + (i%3)*20, 3, 3)) return OLIVEC_CANVAS_NULL;
+    }
+    if (!damage_covers(&damage, 8, 8, 40, 16) || !damage_covers(&damage, 96, 96, 16, 16)) return OLIVEC_CANVAS_NULL;
+
+    olivec_damage_clear(&damage);
+    if (damage.count != 0) return OLIVEC_CANVAS_NULL;
+    return oc;
+}
+
 Olivec_Canvas test_line_edge_cases(void)
 {
     size_t width = 10;
@@ -594,6 +1103,18 @@ Olivec_Canvas test_bilinear_interpolation(void)
     return dst;
 }
 
+Olivec_Canvas test_bilinear_flip(void)
+{
+    Olivec_Canvas src = olivec_canvas(tsodinPog_pixels, tsodinPog_width, tsodinPog_height, tsodinPog_width);
+    int w = src.width*3/2;
+    int h = src.height*5/2;
+    Olivec_Canvas dst = canvas_alloc(w*2, h);
+    olivec_fill(dst, RED_COLOR);
+    olivec_sprite_copy_bilinear(dst, w - 1, 0, -w, h, src);
+    olivec_sprite_copy_bilinear(dst, w, h - 1, w, -h, src);
+    return dst;
+}
+
 Olivec_Canvas test_fill_ellipse(void)
 {
     size_t factor = 3;
@@ -643,8 +1164,23 @@ Test_Case test_cases[] = {
     DEFINE_TEST_CASE(triangle_order_flip),
     DEFINE_TEST_CASE(barycentric_overflow),
     DEFINE_TEST_CASE(bilinear_interpolation),
+    DEFINE_TEST_CASE(bilinear_flip),
     DEFINE_TEST_CASE(fill_ellipse),
     DEFINE_TEST_CASE(line_bug_offset),
+    DEFINE_TEST_CASE(tiled),
+    DEFINE_TEST_CASE(draw_lines_clipped),
+    DEFINE_TEST_CASE(aa_lines),
+    DEFINE_TEST_CASE(aa_polyline_overlap),
+    DEFINE_TEST_CASE(fill_triangle_aa),
+    DEFINE_TEST_CASE(triangle_varyings),
+    DEFINE_TEST_CASE(depth_triangles),
+    DEFINE_TEST_CASE(mesh_clipped),
+    DEFINE_TEST_CASE(mesh_file),
+    DEFINE_TEST_CASE(mesh_file_map),
+    DEFINE_TEST_CASE(mesh_lod),
+    DEFINE_TEST_CASE(text_clipped),
+    DEFINE_TEST_CASE(damage),
+    DEFINE_TEST_CASE(damage_rects),
 };
 #define TEST_CASES_COUNT (sizeof(test_cases)/sizeof(test_cases[0]))
 
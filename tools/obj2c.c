@@ -3,7 +3,11 @@
 #include <errno.h>
 #include <float.h>
 #include <limits.h>
+#include <math.h>
+#include <stdint.h>
 #include <string.h>
+#include <pthread.h>
+#include <unistd.h>
 
 #define NOB_IMPLEMENTATION
 #define NOB_STRIP_PREFIX
@@ -34,12 +38,6 @@ Vector3 make_vector3(float x, float y, float z)
     return v3;
 }
 
-typedef struct {
-    int *items;
-    size_t capacity;
-    size_t count;
-} Face_Indices;
-
 typedef struct {
     int *items;
     size_t capacity;
@@ -48,7 +46,6 @@ typedef struct {
 
 typedef struct {
     Vector3 position;
-    Face_Indices faces;
     int component;              // 0 means never visited, >0 is the index of the component vertex belongs to
 } Vertex;
 
@@ -67,6 +64,9 @@ typedef struct {
 
 #define VERTICES_PER_FACE 3
 
+// Texture coordinate or normal index of a corner that doesn't have one
+#define NO_ATTRIBUTE -1
+
 typedef struct {
     int v[VERTICES_PER_FACE];
     int vt[VERTICES_PER_FACE];
@@ -121,7 +121,527 @@ bool is_deleted_face(Vertices vertices, Face face, Component_Indices delete_comp
     return false;
 }
 
-void generate_code(FILE *out, Vertices vertices, TexCoords texcoords, Normals normals, Faces faces, Component_Indices delete_components)
+// Interleaved vertices with one index buffer per level of detail. The vertex is the position followed by the normal
+// and the texture coordinates if the OBJ has any of them. Every level has its own range of vertices, so drawing
+// a coarse level does not transform the vertices of the finer ones. Indices are relative to the level's first vertex.
+typedef struct {
+    float *items;
+    size_t count;
+    size_t capacity;
+} Floats;
+
+typedef struct {
+    size_t first_vertex;
+    size_t vertices_count;
+    size_t first_index;
+    size_t triangles_count;
+    float error;                // how far the surface may stray from the original one, in model units
+} Lod;
+
+typedef struct {
+    Lod *items;
+    size_t count;
+    size_t capacity;
+} Lods;
+
+typedef struct {
+    Floats vertices;
+    size_t stride;
+    size_t vertices_count;
+    Vertex_Indices indices;
+    Lods lods;
+    bool has_normals;
+    bool has_texcoords;
+} Mesh;
+
+typedef struct {
+    int v, vt, vn;
+    int index;                  // -1 means the slot is empty
+} Weld_Slot;
+
+size_t weld_hash(int v, int vt, int vn)
+{
+    size_t h = (size_t)v*73856093u ^ (size_t)vt*19349663u ^ (size_t)vn*83492791u;
+    return h ^ (h >> 16);
+}
+
+// Appends a level of detail made of the faces, welding the corners that share the same (v, vt, vn) into a single vertex
+void weld_lod(Mesh *mesh, Vertices vertices, TexCoords texcoords, Normals normals, Faces faces, float error)
+{
+    Lod lod = {
+        .first_vertex = mesh->vertices_count,
+        .first_index = mesh->indices.count,
+        .triangles_count = faces.count,
+        .error = error,
+    };
+
+    size_t capacity = 1;
+    while (capacity < 2*VERTICES_PER_FACE*faces.count) capacity *= 2;
+    Weld_Slot *slots = malloc(capacity*sizeof(*slots));
+    assert(slots != NULL);
+    for (size_t i = 0; i < capacity; ++i) slots[i].index = -1;
+
+    for (size_t i = 0; i < faces.count; ++i) {
+        Face f = faces.items[i];
+        for (size_t k = 0; k < VERTICES_PER_FACE; ++k) {
+            int v = f.v[k];
+            int vt = mesh->has_texcoords ? f.vt[k] : NO_ATTRIBUTE;
+            int vn = mesh->has_normals ? f.vn[k] : NO_ATTRIBUTE;
+            size_t h = weld_hash(v, vt, vn) & (capacity - 1);
+            while (slots[h].index >= 0 && (slots[h].v != v || slots[h].vt != vt || slots[h].vn != vn)) {
+                h = (h + 1) & (capacity - 1);
+            }
+            if (slots[h].index < 0) {
+                slots[h] = (Weld_Slot) {.v = v, .vt = vt, .vn = vn, .index = lod.vertices_count++};
+                Vector3 p = vertices.items[v].position;
+                da_append_many(&mesh->vertices, ((float[]) {p.x, p.y, p.z}), 3);
+                if (mesh->has_normals) {
+                    Vector3 n = vn == NO_ATTRIBUTE ? make_vector3(0, 0, 0) : normals.items[vn];
+                    da_append_many(&mesh->vertices, ((float[]) {n.x, n.y, n.z}), 3);
+                }
+                if (mesh->has_texcoords) {
+                    Vector2 t = vt == NO_ATTRIBUTE ? make_vector2(0, 0) : texcoords.items[vt];
+                    da_append_many(&mesh->vertices, ((float[]) {t.x, t.y}), 2);
+                }
+            }
+            da_append(&mesh->indices, slots[h].index);
+        }
+    }
+
+    mesh->vertices_count += lod.vertices_count;
+    da_append(&mesh->lods, lod);
+    free(slots);
+}
+
+// Triangles of every vertex: triangles[offsets[v]..offsets[v + 1]]. The vertices of triangle t are
+// indices[t*stride + 0..2].
+typedef struct {
+    int *offsets;
+    int *triangles;
+} Adjacency;
+
+Adjacency build_adjacency(const int *indices, size_t stride, size_t triangles_count, size_t vertices_count)
+{
+    Adjacency adj = {
+        .offsets = calloc(vertices_count + 1, sizeof(int)),
+        .triangles = malloc((triangles_count*VERTICES_PER_FACE + 1)*sizeof(int)),
+    };
+    assert(adj.offsets != NULL && adj.triangles != NULL);
+    for (size_t t = 0; t < triangles_count; ++t) {
+        for (size_t k = 0; k < VERTICES_PER_FACE; ++k) adj.offsets[indices[t*stride + k] + 1] += 1;
+    }
+    for (size_t v = 0; v < vertices_count; ++v) adj.offsets[v + 1] += adj.offsets[v];
+    for (size_t t = 0; t < triangles_count; ++t) {
+        for (size_t k = 0; k < VERTICES_PER_FACE; ++k) adj.triangles[adj.offsets[indices[t*stride + k]]++] = t;
+    }
+    for (size_t v = vertices_count; v > 0; --v) adj.offsets[v] = adj.offsets[v - 1];
+    adj.offsets[0] = 0;
+    return adj;
+}
+
+void free_adjacency(Adjacency adj)
+{
+    free(adj.offsets);
+    free(adj.triangles);
+}
+
+// Quadric error metric from "Surface Simplification Using Quadric Error Metrics" by Garland and Heckbert: the
+// weighted sum of the squared distances to a set of planes as a symmetric 4x4 matrix, of which q keeps the upper
+// triangle. Dividing by the total weight turns it into the mean squared distance, which is in model units.
+typedef struct {
+    double q[10];
+    double weight;
+} Quadric;
+
+void quadric_add_plane(Quadric *quadric, double a, double b, double c, double d, double w)
+{
+    double *q = quadric->q;
+    q[0] += w*a*a; q[1] += w*a*b; q[2] += w*a*c; q[3] += w*a*d;
+                   q[4] += w*b*b; q[5] += w*b*c; q[6] += w*b*d;
+                                  q[7] += w*c*c; q[8] += w*c*d;
+                                                 q[9] += w*d*d;
+    quadric->weight += w;
+}
+
+void quadric_add(Quadric *dst, const Quadric *src)
+{
+    for (size_t i = 0; i < 10; ++i) dst->q[i] += src->q[i];
+    dst->weight += src->weight;
+}
+
+double quadric_error(const Quadric *quadric, Vector3 p)
+{
+    const double *q = quadric->q;
+    double x = p.x, y = p.y, z = p.z;
+    double e = q[0]*x*x + 2*q[1]*x*y + 2*q[2]*x*z + 2*q[3]*x
+                        +   q[4]*y*y + 2*q[5]*y*z + 2*q[6]*y
+                                     +   q[7]*z*z + 2*q[8]*z
+                                                  +   q[9];
+    return e > 0 && quadric->weight > 0 ? e/quadric->weight : 0;
+}
+
+Vector3 face_normal(Vector3 p0, Vector3 p1, Vector3 p2)
+{
+    Vector3 a = make_vector3(p1.x - p0.x, p1.y - p0.y, p1.z - p0.z);
+    Vector3 b = make_vector3(p2.x - p0.x, p2.y - p0.y, p2.z - p0.z);
+    return make_vector3(a.y*b.z - a.z*b.y, a.z*b.x - a.x*b.z, a.x*b.y - a.y*b.x);
+}
+
+float dot3(Vector3 a, Vector3 b)
+{
+    return a.x*b.x + a.y*b.y + a.z*b.z;
+}
+
+// Edge collapses keep the positions of the vertices (one end moves onto the other), so the faces of every level
+// index the original vertices. The corners that move take the texture coordinates and the normal of the end they
+// move onto, which is why the vertices on a seam (the ones with more than one set of them) never move.
+typedef struct {
+    Faces faces;
+    Quadric *quadrics;
+    double max_error;           // largest quadric error of a collapse so far, squared model units
+    bool has_normals;
+    bool has_texcoords;
+} Simplifier;
+
+typedef struct {
+    int from, to;
+    double error;
+} Collapse;
+
+int compare_collapses(const void *a, const void *b)
+{
+    double ea = ((const Collapse*)a)->error;
+    double eb = ((const Collapse*)b)->error;
+    return (ea > eb) - (ea < eb);
+}
+
+bool face_has_vertex(Face f, int v)
+{
+    return f.v[0] == v || f.v[1] == v || f.v[2] == v;
+}
+
+// Number of faces that have the edge (a, b), given the faces around a
+size_t edge_faces_count(Faces faces, Adjacency adj, int a, int b)
+{
+    size_t count = 0;
+    for (int i = adj.offsets[a]; i < adj.offsets[a + 1]; ++i) {
+        if (face_has_vertex(faces.items[adj.triangles[i]], b)) count += 1;
+    }
+    return count;
+}
+
+// Link condition: the only vertices next to both a and b are the opposite corners of the faces that have the
+// edge (a, b). Collapsing an edge whose ends share any other neighbour pinches the surface into a non-manifold one.
+bool edge_link_condition(Faces faces, Adjacency adj, int a, int b)
+{
+    for (int i = adj.offsets[a]; i < adj.offsets[a + 1]; ++i) {
+        Face f = faces.items[adj.triangles[i]];
+        for (size_t k = 0; k < VERTICES_PER_FACE; ++k) {
+            int n = f.v[k];
+            if (n == a || n == b) continue;
+
+            bool shared = false;
+            for (int j = adj.offsets[b]; j < adj.offsets[b + 1] && !shared; ++j) {
+                shared = face_has_vertex(faces.items[adj.triangles[j]], n);
+            }
+            if (!shared) continue;
+
+            bool opposite = false;
+            for (int j = adj.offsets[a]; j < adj.offsets[a + 1] && !opposite; ++j) {
+                Face g = faces.items[adj.triangles[j]];
+                opposite = face_has_vertex(g, b) && face_has_vertex(g, n);
+            }
+            if (!opposite) return false;
+        }
+    }
+    return true;
+}
+
+bool same_corner_attributes(const Simplifier *s, Face f, size_t k, Face g, size_t l)
+{
+    return (!s->has_texcoords || f.vt[k] == g.vt[l]) && (!s->has_normals || f.vn[k] == g.vn[l]);
+}
+
+void simplifier_init(Simplifier *s, Vertices vertices, Faces faces)
+{
+    static_assert(sizeof(Face) == 3*VERTICES_PER_FACE*sizeof(int), "Face must be a plain array of ints for build_adjacency()");
+
+    da_append_many(&s->faces, faces.items, faces.count);
+    s->quadrics = calloc(vertices.count, sizeof(*s->quadrics));
+    assert(s->quadrics != NULL);
+
+    Adjacency adj = build_adjacency(&faces.items->v[0], 3*VERTICES_PER_FACE, faces.count, vertices.count);
+    for (size_t i = 0; i < faces.count; ++i) {
+        Face f = faces.items[i];
+        Vector3 p[VERTICES_PER_FACE];
+        for (size_t k = 0; k < VERTICES_PER_FACE; ++k) p[k] = vertices.items[f.v[k]].position;
+        Vector3 n = face_normal(p[0], p[1], p[2]);
+        double len = sqrt(dot3(n, n));
+        if (len == 0) continue;
+        double a = n.x/len, b = n.y/len, c = n.z/len;
+        for (size_t k = 0; k < VERTICES_PER_FACE; ++k) {
+            quadric_add_plane(&s->quadrics[f.v[k]], a, b, c, -(a*p[0].x + b*p[0].y + c*p[0].z), len/2);
+        }
+
+        // A plane perpendicular to the face through every border edge keeps the outline in place
+        for (size_t k = 0; k < VERTICES_PER_FACE; ++k) {
+            int i0 = f.v[k], i1 = f.v[(k + 1)%VERTICES_PER_FACE];
+            if (edge_faces_count(faces, adj, i0, i1) != 1) continue;
+            Vector3 p0 = p[k], p1 = p[(k + 1)%VERTICES_PER_FACE];
+            Vector3 e = make_vector3(p1.x - p0.x, p1.y - p0.y, p1.z - p0.z);
+            Vector3 m = make_vector3(e.y*c - e.z*b, e.z*a - e.x*c, e.x*b - e.y*a);
+            double mlen = sqrt(dot3(m, m));
+            if (mlen == 0) continue;
+            double ma = m.x/mlen, mb = m.y/mlen, mc = m.z/mlen;
+            double md = -(ma*p0.x + mb*p0.y + mc*p0.z);
+            quadric_add_plane(&s->quadrics[i0], ma, mb, mc, md, dot3(e, e));
+            quadric_add_plane(&s->quadrics[i1], ma, mb, mc, md, dot3(e, e));
+        }
+    }
+    free_adjacency(adj);
+}
+
+// Collapses the cheapest edges until at most target_count faces are left, in passes that each touch any part of
+// the mesh at most once. A collapse must keep the link condition, must not flip any of the faces it moves and a
+// vertex on the border may only slide along the border. Returns false once a pass cannot collapse anything.
+bool simplify(Simplifier *s, Vertices vertices, size_t target_count)
+{
+    Collapse *collapses = malloc(s->faces.count*2*VERTICES_PER_FACE*sizeof(*collapses));
+    bool *locked = malloc(vertices.count*sizeof(*locked));
+    bool *border = malloc(vertices.count*sizeof(*border));
+    bool *dead = malloc(s->faces.count*sizeof(*dead));
+    bool *seam = malloc(vertices.count*sizeof(*seam));
+    assert(collapses != NULL && locked != NULL && border != NULL && dead != NULL && seam != NULL);
+
+    bool progress = true;
+    while (s->faces.count > target_count && progress) {
+        Faces faces = s->faces;
+        Adjacency adj = build_adjacency(&faces.items->v[0], 3*VERTICES_PER_FACE, faces.count, vertices.count);
+
+        memset(border, 0, vertices.count*sizeof(*border));
+        memset(seam, 0, vertices.count*sizeof(*seam));
+        for (size_t i = 0; i < faces.count; ++i) {
+            Face f = faces.items[i];
+            for (size_t k = 0; k < VERTICES_PER_FACE; ++k) {
+                int a = f.v[k], b = f.v[(k + 1)%VERTICES_PER_FACE];
+                if (edge_faces_count(faces, adj, a, b) == 1) border[a] = border[b] = true;
+
+                Face g = faces.items[adj.triangles[adj.offsets[a]]];
+                size_t l = 0;
+                while (g.v[l] != a) l += 1;
+                if (!same_corner_attributes(s, f, k, g, l)) seam[a] = true;
+            }
+        }
+
+        size_t collapses_count = 0;
+        for (size_t i = 0; i < faces.count; ++i) {
+            for (size_t k = 0; k < VERTICES_PER_FACE; ++k) {
+                int a = faces.items[i].v[k], b = faces.items[i].v[(k + 1)%VERTICES_PER_FACE];
+                bool border_edge = (border[a] || border[b]) && edge_faces_count(faces, adj, a, b) == 1;
+                // Checked on the faces from the start of the pass. The collapses in the pass never touch the faces
+                // around the ends of a later one, those are locked.
+                if (!edge_link_condition(faces, adj, a, b)) continue;
+                for (size_t dir = 0; dir < 2; ++dir) {
+                    int from = dir ? b : a, to = dir ? a : b;
+                    if (seam[from] || (border[from] && !border_edge)) continue;
+                    Quadric q = s->quadrics[from];
+                    quadric_add(&q, &s->quadrics[to]);
+                    collapses[collapses_count++] = (Collapse) {
+                        .from = from,
+                        .to = to,
+                        .error = quadric_error(&q, vertices.items[to].position),
+                    };
+                }
+            }
+        }
+        qsort(collapses, collapses_count, sizeof(*collapses), compare_collapses);
+
+        memset(locked, 0, vertices.count*sizeof(*locked));
+        memset(dead, 0, faces.count*sizeof(*dead));
+        size_t removed = 0;
+        for (size_t i = 0; i < collapses_count && faces.count - removed > target_count; ++i) {
+            Collapse c = collapses[i];
+            if (locked[c.from] || locked[c.to]) continue;
+
+            bool flips = false;
+            for (int j = adj.offsets[c.from]; j < adj.offsets[c.from + 1] && !flips; ++j) {
+                Face f = faces.items[adj.triangles[j]];
+                if (face_has_vertex(f, c.to)) continue;
+                Vector3 p[VERTICES_PER_FACE], q[VERTICES_PER_FACE];
+                for (size_t k = 0; k < VERTICES_PER_FACE; ++k) {
+                    p[k] = vertices.items[f.v[k]].position;
+                    q[k] = vertices.items[f.v[k] == c.from ? c.to : f.v[k]].position;
+                }
+                flips = dot3(face_normal(p[0], p[1], p[2]), face_normal(q[0], q[1], q[2])) <= 0;
+            }
+            if (flips) continue;
+
+            // The attributes of the end we move onto from one of the faces that go away
+            Face edge_face = {0};
+            size_t edge_corner = 0;
+            for (int j = adj.offsets[c.from]; j < adj.offsets[c.from + 1]; ++j) {
+                Face f = faces.items[adj.triangles[j]];
+                for (size_t k = 0; k < VERTICES_PER_FACE; ++k) {
+                    if (f.v[k] == c.to) {
+                        edge_face = f;
+                        edge_corner = k;
+                    }
+                }
+            }
+
+            for (int j = adj.offsets[c.from]; j < adj.offsets[c.from + 1]; ++j) {
+                Face *f = &faces.items[adj.triangles[j]];
+                if (face_has_vertex(*f, c.to)) {
+                    if (!dead[adj.triangles[j]]) removed += 1;
+                    dead[adj.triangles[j]] = true;
+                }
+                for (size_t k = 0; k < VERTICES_PER_FACE; ++k) {
+                    locked[f->v[k]] = true;
+                    if (f->v[k] == c.from) {
+                        f->v[k] = c.to;
+                        f->vt[k] = edge_face.vt[edge_corner];
+                        f->vn[k] = edge_face.vn[edge_corner];
+                    }
+                }
+            }
+            quadric_add(&s->quadrics[c.to], &s->quadrics[c.from]);
+            if (s->max_error < c.error) s->max_error = c.error;
+        }
+        free_adjacency(adj);
+
+        s->faces.count = 0;
+        for (size_t i = 0; i < faces.count; ++i) {
+            Face f = faces.items[i];
+            if (!dead[i] && f.v[0] != f.v[1] && f.v[1] != f.v[2] && f.v[2] != f.v[0]) s->faces.items[s->faces.count++] = f;
+        }
+        progress = removed > 0;
+    }
+
+    free(collapses);
+    free(locked);
+    free(border);
+    free(dead);
+    free(seam);
+    return progress;
+}
+
+#define VERTEX_CACHE_SIZE 16
+
+// Average number of vertices transformed per triangle with a FIFO cache of VERTEX_CACHE_SIZE
+float average_cache_miss_ratio(const int *indices, size_t indices_count)
+{
+    int cache[VERTEX_CACHE_SIZE];
+    size_t head = 0, misses = 0;
+    for (size_t i = 0; i < VERTEX_CACHE_SIZE; ++i) cache[i] = -1;
+    for (size_t i = 0; i < indices_count; ++i) {
+        bool hit = false;
+        for (size_t j = 0; j < VERTEX_CACHE_SIZE && !hit; ++j) hit = cache[j] == indices[i];
+        if (!hit) {
+            cache[head] = indices[i];
+            head = (head + 1)%VERTEX_CACHE_SIZE;
+            misses += 1;
+        }
+    }
+    size_t triangles = indices_count/VERTICES_PER_FACE;
+    return triangles > 0 ? (float)misses/triangles : 0;
+}
+
+// Tipsify from "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw" by Sander, Nehab and Barczak.
+// Fans the triangles around one vertex at a time, moving on to the most recently used vertex that still has
+// triangles left and will stay in the cache long enough to emit them.
+void tipsify(int *indices, size_t indices_count, size_t vertices_count, int cache_size)
+{
+    size_t triangles_count = indices_count/VERTICES_PER_FACE;
+    Adjacency adj = build_adjacency(indices, VERTICES_PER_FACE, triangles_count, vertices_count);
+    int *live = malloc(vertices_count*sizeof(*live));
+    int *cache_time = calloc(vertices_count, sizeof(*cache_time));
+    bool *emitted = calloc(triangles_count, sizeof(*emitted));
+    assert(live && cache_time && emitted);
+    for (size_t v = 0; v < vertices_count; ++v) live[v] = adj.offsets[v + 1] - adj.offsets[v];
+
+    Vertex_Indices output = {0};
+    Vertex_Indices dead_end = {0};
+    Vertex_Indices candidates = {0};
+    int time = cache_size + 1;
+    size_t cursor = 1;
+    int fanning = vertices_count > 0 ? 0 : -1;
+    while (fanning >= 0) {
+        candidates.count = 0;
+        for (int i = adj.offsets[fanning]; i < adj.offsets[fanning + 1]; ++i) {
+            int t = adj.triangles[i];
+            if (emitted[t]) continue;
+            for (size_t k = 0; k < VERTICES_PER_FACE; ++k) {
+                int v = indices[t*VERTICES_PER_FACE + k];
+                da_append(&output, v);
+                da_append(&dead_end, v);
+                da_append(&candidates, v);
+                live[v] -= 1;
+                if (time - cache_time[v] > cache_size) cache_time[v] = time++;
+            }
+            emitted[t] = true;
+        }
+
+        int best = -1, best_priority = -1;
+        for (size_t i = 0; i < candidates.count; ++i) {
+            int v = candidates.items[i];
+            if (live[v] <= 0) continue;
+            int priority = 0;
+            if (time - cache_time[v] + 2*live[v] <= cache_size) priority = time - cache_time[v];
+            if (priority > best_priority) {
+                best_priority = priority;
+                best = v;
+            }
+        }
+        while (best < 0 && dead_end.count > 0) {
+            int v = dead_end.items[--dead_end.count];
+            if (live[v] > 0) best = v;
+        }
+        while (best < 0 && cursor < vertices_count) {
+            if (live[cursor] > 0) best = cursor;
+            cursor += 1;
+        }
+        fanning = best;
+    }
+    assert(output.count == indices_count);
+
+    memcpy(indices, output.items, indices_count*sizeof(*indices));
+    free(output.items);
+    free(dead_end.items);
+    free(candidates.items);
+    free_adjacency(adj);
+    free(live);
+    free(cache_time);
+    free(emitted);
+}
+
+// Renumbers the vertices of the level in the order its triangles first use them, so both transforming the
+// vertices and fetching them for the triangles walk memory mostly forward
+void sort_vertices_by_first_use(Mesh *mesh, Lod lod)
+{
+    int *remap = malloc(lod.vertices_count*sizeof(*remap));
+    float *sorted = malloc(lod.vertices_count*mesh->stride*sizeof(*sorted));
+    assert(remap != NULL && sorted != NULL);
+    for (size_t i = 0; i < lod.vertices_count; ++i) remap[i] = -1;
+
+    float *vertices = &mesh->vertices.items[lod.first_vertex*mesh->stride];
+    int *indices = &mesh->indices.items[lod.first_index];
+    int next = 0;
+    for (size_t i = 0; i < lod.triangles_count*VERTICES_PER_FACE; ++i) {
+        int v = indices[i];
+        if (remap[v] < 0) {
+            remap[v] = next;
+            memcpy(&sorted[next*mesh->stride], &vertices[v*mesh->stride], mesh->stride*sizeof(*sorted));
+            next += 1;
+        }
+        indices[i] = remap[v];
+    }
+    memcpy(vertices, sorted, lod.vertices_count*mesh->stride*sizeof(*sorted));
+
+    free(sorted);
+    free(remap);
+}
+
+void generate_code(FILE *out, Vertices vertices, TexCoords texcoords, Normals normals, Faces faces, Component_Indices delete_components, Mesh mesh)
 {
     fprintf(out, "#ifndef OBJ_H_\n");
     fprintf(out, "#define OBJ_H_\n");
@@ -181,9 +701,106 @@ void generate_code(FILE *out, Vertices vertices, TexCoords texcoords, Normals no
         }
         fprintf(out, "};\n");
     }
+
+    // The same mesh with the corners welded: mesh_stride floats per vertex and 3 indices per face. mesh_lods
+    // splits them into levels of detail starting from the full one: {first vertex, vertices count, first index,
+    // triangles count}, with the indices relative to the first vertex of the level. mesh_lod_errors is how far
+    // the surface of every level may stray from the original one (see olivec_mesh_lod()).
+    fprintf(out, "#define mesh_stride %zu\n", mesh.stride);
+    fprintf(out, "#define mesh_vertices_count %zu\n", mesh.vertices_count);
+    if (mesh.vertices_count == 0) {
+        fprintf(out, "static const float mesh_vertices[1][%zu] = {0};\n", mesh.stride);
+    } else {
+        fprintf(out, "static const float mesh_vertices[][%zu] = {\n", mesh.stride);
+        for (size_t i = 0; i < mesh.vertices_count; ++i) {
+            fprintf(out, "    {");
+            for (size_t j = 0; j < mesh.stride; ++j) {
+                fprintf(out, "%s%f", j > 0 ? ", " : "", mesh.vertices.items[i*mesh.stride + j]);
+            }
+            fprintf(out, "},\n");
+        }
+        fprintf(out, "};\n");
+    }
+    if (mesh.indices.count == 0) {
+        fprintf(out, "static const int mesh_indices[1] = {0};\n");
+    } else {
+        fprintf(out, "static const int mesh_indices[] = {\n");
+        for (size_t i = 0; i < mesh.indices.count; i += VERTICES_PER_FACE) {
+            fprintf(out, "    %d, %d, %d,\n", mesh.indices.items[i], mesh.indices.items[i + 1], mesh.indices.items[i + 2]);
+        }
+        fprintf(out, "};\n");
+    }
+    fprintf(out, "#define mesh_lods_count %zu\n", mesh.lods.count);
+    fprintf(out, "static const int mesh_lods[][4] = {\n");
+    for (size_t i = 0; i < mesh.lods.count; ++i) {
+        Lod lod = mesh.lods.items[i];
+        fprintf(out, "    {%zu, %zu, %zu, %zu},\n", lod.first_vertex, lod.vertices_count, lod.first_index, lod.triangles_count);
+    }
+    fprintf(out, "};\n");
+    fprintf(out, "static const float mesh_lod_errors[] = {\n");
+    for (size_t i = 0; i < mesh.lods.count; ++i) {
+        fprintf(out, "    %f,\n", mesh.lods.items[i].error);
+    }
+    fprintf(out, "};\n");
     fprintf(out, "#endif // OBJ_H_\n");
 }
 
+// Same layout as Olivec_Mesh_File_Header in olive.c, see it for the format. Keep the two in sync.
+#define MESH_FILE_MAGIC 0x4D564C4F // "OLVM"
+#define MESH_FILE_VERSION 1
+#define MESH_FILE_NORMALS   (1<<0)
+#define MESH_FILE_TEXCOORDS (1<<1)
+#define MESH_FILE_INDICES16 (1<<2)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t flags;
+    uint32_t stride;
+    uint32_t vertex_count;
+    uint32_t triangle_count;
+    uint32_t vertices_offset;
+    uint32_t indices_offset;
+} Mesh_File_Header;
+
+// Only the full level of detail goes into the file
+bool generate_binary(FILE *out, Mesh mesh)
+{
+    static_assert(sizeof(Mesh_File_Header) == 8*sizeof(uint32_t), "Mesh_File_Header must not have any padding");
+    Lod lod = mesh.lods.items[0];
+    Mesh_File_Header header = {
+        .magic = MESH_FILE_MAGIC,
+        .version = MESH_FILE_VERSION,
+        .stride = mesh.stride,
+        .vertex_count = lod.vertices_count,
+        .triangle_count = lod.triangles_count,
+        .vertices_offset = sizeof(Mesh_File_Header),
+    };
+    if (mesh.has_normals) header.flags |= MESH_FILE_NORMALS;
+    if (mesh.has_texcoords) header.flags |= MESH_FILE_TEXCOORDS;
+    bool indices16 = lod.vertices_count <= 65536;
+    if (indices16) header.flags |= MESH_FILE_INDICES16;
+    header.indices_offset = header.vertices_offset + lod.vertices_count*mesh.stride*sizeof(float);
+
+    if (fwrite(&header, sizeof(header), 1, out) != 1) return false;
+    const float *vertices = &mesh.vertices.items[lod.first_vertex*mesh.stride];
+    if (fwrite(vertices, sizeof(float)*mesh.stride, lod.vertices_count, out) != lod.vertices_count) return false;
+    const int *indices = &mesh.indices.items[lod.first_index];
+    for (size_t i = 0; i < lod.triangles_count*VERTICES_PER_FACE; ++i) {
+        bool ok;
+        if (indices16) {
+            uint16_t index16 = indices[i];
+            ok = fwrite(&index16, sizeof(index16), 1, out) == 1;
+        } else {
+            int32_t index32 = indices[i];
+            ok = fwrite(&index32, sizeof(index32), 1, out) == 1;
+        }
+        if (!ok) return false;
+    }
+
+    return true;
+}
+
 Vector3 remap_object(Vector3 v, float scale, float lx, float hx, float ly, float hy, float lz, float hz)
 {
     float cx = lx + (hx - lx)/2;
@@ -199,8 +816,12 @@ void usage(const char *program_name)
 {
     fprintf(stderr, "Usage: %s [OPTIONS] <INPUT.obj>\n", program_name);
     fprintf(stderr, "Options:\n");
-    fprintf(stderr, "    -o    output file path\n");
+    fprintf(stderr, "    -o    output file path of the C code\n");
+    fprintf(stderr, "    -b    output file path of the binary mesh (see Olivec_Mesh_File_Header in olive.c)\n");
     fprintf(stderr, "    -s    scale the model\n");
+    fprintf(stderr, "    -r    reorder the faces for the vertex cache\n");
+    fprintf(stderr, "    -l    number of levels of detail, each with half the faces of the previous one (default: 1)\n");
+    fprintf(stderr, "    -j    number of threads parsing the OBJ (default: number of CPUs)\n");
 }
 
 void parse_face_triple(String_View *line, int *lf, int *hf, int *v, int *vt, int *vn)
@@ -212,29 +833,160 @@ void parse_face_triple(String_View *line, int *lf, int *hf, int *v, int *vt, int
     if (*lf > *v) *lf = *v;
     if (*hf < *v) *hf = *v;
     sv_chop_left(line, endptr - line->data);
-    *vt = 0;
+    // Both a missing field (`1`) and an empty one (`1//3`) mean the corner doesn't have the attribute
+    *vt = NO_ATTRIBUTE;
     if (line->count > 0 && line->data[0] == '/') {
         sv_chop_left(line, 1);
-        *vt = strtol(line->data, &endptr, 10) - 1; // NOTE: -1 is to account for 1-based indexing.
+        int index = strtol(line->data, &endptr, 10);
+        if (endptr != line->data) *vt = index - 1; // NOTE: -1 is to account for 1-based indexing.
         sv_chop_left(line, endptr - line->data);
     }
-    *vn = 0;
+    *vn = NO_ATTRIBUTE;
     if (line->count > 0 && line->data[0] == '/') {
         sv_chop_left(line, 1);
-        *vn = strtol(line->data, &endptr, 10) - 1; // NOTE: -1 is to account for 1-based indexing.
+        int index = strtol(line->data, &endptr, 10);
+        if (endptr != line->data) *vn = index - 1; // NOTE: -1 is to account for 1-based indexing.
         sv_chop_left(line, endptr - line->data);
     }
     while (line->count > 0 && !isspace(*line->data)) sv_chop_left(line, 1);
 }
 
-int unvisited_vertex(Vertices vertices)
+// Line number of the face with the given index. The faces don't keep their lines, so the OBJ is scanned
+// again. Only used for reporting errors.
+size_t face_line_number(String_View content, size_t face_index)
 {
-    for (size_t i = 0; i < vertices.count; ++i) {
-        if (!vertices.items[i].component) {
-            return (int)i;
+    size_t line_number = 1;
+    for (; content.count > 0; ++line_number) {
+        String_View line = sv_trim_left(sv_chop_by_delim(&content, '\n'));
+        if (line.count == 0 || *line.data == '#') continue;
+        if (!sv_eq(sv_chop_by_delim(&line, ' '), sv_from_cstr("f"))) continue;
+        if (face_index == 0) break;
+        face_index -= 1;
+    }
+    return line_number;
+}
+
+typedef enum {
+    DIAGNOSTIC_OBJECT,
+    DIAGNOSTIC_MTLLIB,
+    DIAGNOSTIC_USEMTL,
+    DIAGNOSTIC_SMOOTH_GROUPS,
+    DIAGNOSTIC_UNKNOWN_KIND,    // stops the parsing of the chunk
+} Diagnostic_Kind;
+
+typedef struct {
+    Diagnostic_Kind kind;
+    size_t line_number;         // within the chunk
+    String_View sv;
+} Diagnostic;
+
+typedef struct {
+    Diagnostic *items;
+    size_t capacity;
+    size_t count;
+} Diagnostics;
+
+// The OBJ is split into chunks of whole lines that are parsed in parallel. Indices in OBJ are global, so the
+// results of the chunks are merged by concatenating them in order. Anything worth reporting is collected into
+// diagnostics and reported after the merge, when the global line numbers are known.
+typedef struct {
+    String_View content;
+    Vertices vertices;
+    TexCoords texcoords;
+    Normals normals;
+    Faces faces;
+    float lx, hx, ly, hy, lz, hz;
+    int lf, hf;
+    size_t lines_count;
+    Diagnostics diagnostics;
+} Chunk;
+
+void *parse_chunk(void *arg)
+{
+    Chunk *chunk = arg;
+    chunk->lx = FLT_MAX; chunk->hx = FLT_MIN;
+    chunk->ly = FLT_MAX; chunk->hy = FLT_MIN;
+    chunk->lz = FLT_MAX; chunk->hz = FLT_MIN;
+    chunk->lf = INT_MAX; chunk->hf = INT_MIN;
+
+    String_View content = chunk->content;
+    for (size_t line_number = 1; content.count > 0; ++line_number) {
+        chunk->lines_count = line_number;
+        String_View line = sv_trim_left(sv_chop_by_delim(&content, '\n'));
+        if (line.count > 0 && *line.data != '#') {
+            String_View kind = sv_chop_by_delim(&line, ' ');
+            if (sv_eq(kind, sv_from_cstr("v"))) {
+                char *endptr;
+
+                line = sv_trim_left(line);
+                float x = strtof(line.data, &endptr);
+                if (chunk->lx > x) chunk->lx = x;
+                if (chunk->hx < x) chunk->hx = x;
+                sv_chop_left(&line, endptr - line.data);
+
+                line = sv_trim_left(line);
+                float y = strtof(line.data, &endptr);
+                if (chunk->ly > y) chunk->ly = y;
+                if (chunk->hy < y) chunk->hy = y;
+                sv_chop_left(&line, endptr - line.data);
+
+                line = sv_trim_left(line);
+                float z = strtof(line.data, &endptr);
+                if (chunk->lz > z) chunk->lz = z;
+                if (chunk->hz < z) chunk->hz = z;
+                sv_chop_left(&line, endptr - line.data);
+
+                da_append(&chunk->vertices, make_vertex(x, y, z));
+            } else if (sv_eq(kind, sv_from_cstr("f"))) {
+                int v1, v2, v3, vt1, vt2, vt3, vn1, vn2, vn3;
+                parse_face_triple(&line, &chunk->lf, &chunk->hf, &v1, &vt1, &vn1);
+                parse_face_triple(&line, &chunk->lf, &chunk->hf, &v2, &vt2, &vn2);
+                parse_face_triple(&line, &chunk->lf, &chunk->hf, &v3, &vt3, &vn3);
+                da_append(&chunk->faces, make_face(v1, v2, v3, vt1, vt2, vt3, vn1, vn2, vn3));
+            } else if (sv_eq(kind, sv_from_cstr("mtllib"))) {
+                da_append(&chunk->diagnostics, ((Diagnostic) {DIAGNOSTIC_MTLLIB, line_number, kind}));
+            } else if (sv_eq(kind, sv_from_cstr("usemtl"))) {
+                da_append(&chunk->diagnostics, ((Diagnostic) {DIAGNOSTIC_USEMTL, line_number, kind}));
+            } else if (sv_eq(kind, sv_from_cstr("o"))) {
+                da_append(&chunk->diagnostics, ((Diagnostic) {DIAGNOSTIC_OBJECT, line_number, sv_trim_left(line)}));
+            } else if (sv_eq(kind, sv_from_cstr("s"))) {
+                da_append(&chunk->diagnostics, ((Diagnostic) {DIAGNOSTIC_SMOOTH_GROUPS, line_number, kind}));
+            } else if (sv_eq(kind, sv_from_cstr("vn"))) {
+                char *endptr;
+
+                line = sv_trim_left(line);
+                float x = strtof(line.data, &endptr);
+                sv_chop_left(&line, endptr - line.data);
+
+                line = sv_trim_left(line);
+                float y = strtof(line.data, &endptr);
+                sv_chop_left(&line, endptr - line.data);
+
+                line = sv_trim_left(line);
+                float z = strtof(line.data, &endptr);
+                sv_chop_left(&line, endptr - line.data);
+
+                da_append(&chunk->normals, make_vector3(x, y, z));
+            } else if (sv_eq(kind, sv_from_cstr("vt"))) {
+                char *endptr;
+
+                line = sv_trim_left(line);
+                float x = strtof(line.data, &endptr);
+                sv_chop_left(&line, endptr - line.data);
+
+                line = sv_trim_left(line);
+                float y = strtof(line.data, &endptr);
+                sv_chop_left(&line, endptr - line.data);
+
+                da_append(&chunk->texcoords, make_vector2(x, y));
+            } else {
+                da_append(&chunk->diagnostics, ((Diagnostic) {DIAGNOSTIC_UNKNOWN_KIND, line_number, kind}));
+                break;
+            }
         }
     }
-    return -1;
+
+    return NULL;
 }
 
 int main(int argc, char **argv)
@@ -244,8 +996,12 @@ int main(int argc, char **argv)
     assert(argc > 0);
     const char *program_name = shift(argv, argc);
     const char *output_file_path = NULL;
+    const char *binary_file_path = NULL;
     const char *input_file_path = NULL;
     float scale = 0.75;
+    bool reorder = false;
+    int lods_count = 1;
+    long threads_count = sysconf(_SC_NPROCESSORS_ONLN);
     Component_Indices delete_components = {0};
 
     // TODO: consider using https://github.com/tsoding/flag.h in here
@@ -265,6 +1021,20 @@ int main(int argc, char **argv)
             }
 
             output_file_path = shift(argv, argc);
+        } else if (strcmp(flag, "-b") == 0) {
+            if (argc <= 0) {
+                usage(program_name);
+                fprintf(stderr, "ERROR: no value is provided for flag %s\n", flag);
+                return_defer(1);
+            }
+
+            if (binary_file_path != NULL) {
+                usage(program_name);
+                fprintf(stderr, "ERROR: %s was already provided\n", flag);
+                return_defer(1);
+            }
+
+            binary_file_path = shift(argv, argc);
         } else if (strcmp(flag, "-s") == 0) {
             if (argc <= 0) {
                 usage(program_name);
@@ -274,6 +1044,36 @@ int main(int argc, char **argv)
 
             const char *value = shift(argv, argc);
             scale = strtof(value, NULL);
+        } else if (strcmp(flag, "-r") == 0) {
+            reorder = true;
+        } else if (strcmp(flag, "-l") == 0) {
+            if (argc <= 0) {
+                usage(program_name);
+                fprintf(stderr, "ERROR: no value is provided for flag %s\n", flag);
+                return_defer(1);
+            }
+
+            const char *value = shift(argv, argc);
+            lods_count = atoi(value);
+            if (lods_count < 1) {
+                usage(program_name);
+                fprintf(stderr, "ERROR: at least one level of detail is required\n");
+                return_defer(1);
+            }
+        } else if (strcmp(flag, "-j") == 0) {
+            if (argc <= 0) {
+                usage(program_name);
+                fprintf(stderr, "ERROR: no value is provided for flag %s\n", flag);
+                return_defer(1);
+            }
+
+            const char *value = shift(argv, argc);
+            threads_count = atol(value);
+            if (threads_count < 1) {
+                usage(program_name);
+                fprintf(stderr, "ERROR: at least one thread is required\n");
+                return_defer(1);
+            }
         } else if (strcmp(flag, "-d") == 0) {
             if (argc <= 0) {
                 usage(program_name);
@@ -299,7 +1099,7 @@ int main(int argc, char **argv)
         return_defer(1);
     }
 
-    if (output_file_path == NULL) {
+    if (output_file_path == NULL && binary_file_path == NULL) {
         usage(program_name);
         fprintf(stderr, "ERROR: no output file path is provided\n");
         return_defer(1);
@@ -308,7 +1108,28 @@ int main(int argc, char **argv)
     String_Builder buffer = {0};
     if (!read_entire_file(input_file_path, &buffer)) return_defer(1);
 
+    // Split the file into chunks of whole lines
+    if (threads_count < 1) threads_count = 1;
+    Chunk *chunks = calloc(threads_count, sizeof(*chunks));
+    pthread_t *threads = calloc(threads_count, sizeof(*threads));
+    assert(chunks != NULL && threads != NULL);
     String_View content = sb_to_sv(buffer);
+    for (long i = 0; i < threads_count; ++i) {
+        size_t n = content.count/(threads_count - i);
+        while (n < content.count && (n == 0 || content.data[n - 1] != '\n')) n += 1;
+        chunks[i].content = sv_from_parts(content.data, n);
+        sv_chop_left(&content, n);
+    }
+
+    for (long i = 1; i < threads_count; ++i) {
+        if (pthread_create(&threads[i], NULL, parse_chunk, &chunks[i]) != 0) {
+            fprintf(stderr, "ERROR: could not create a thread: %s\n", strerror(errno));
+            return_defer(1);
+        }
+    }
+    parse_chunk(&chunks[0]);
+    for (long i = 1; i < threads_count; ++i) pthread_join(threads[i], NULL);
+
     Vertices vertices = {0};
     TexCoords texcoords = {0};
     Normals normals = {0};
@@ -319,148 +1140,120 @@ int main(int argc, char **argv)
     int lf = INT_MAX, hf = INT_MIN;
     bool one_object_encountered = false;
     size_t one_object_line_number = 0;
-    for (size_t line_number = 1; content.count > 0; ++line_number) {
-        String_View line = sv_trim_left(sv_chop_by_delim(&content, '\n'));
-        if (line.count > 0 && *line.data != '#') {
-            String_View kind = sv_chop_by_delim(&line, ' ');
-            if (sv_eq(kind, sv_from_cstr("v"))) {
-                char *endptr;
-
-                line = sv_trim_left(line);
-                float x = strtof(line.data, &endptr);
-                if (lx > x) lx = x;
-                if (hx < x) hx = x;
-                sv_chop_left(&line, endptr - line.data);
-
-                line = sv_trim_left(line);
-                float y = strtof(line.data, &endptr);
-                if (ly > y) ly = y;
-                if (hy < y) hy = y;
-                sv_chop_left(&line, endptr - line.data);
-
-                line = sv_trim_left(line);
-                float z = strtof(line.data, &endptr);
-                if (lz > z) lz = z;
-                if (hz < z) hz = z;
-                sv_chop_left(&line, endptr - line.data);
-
-                da_append(&vertices, make_vertex(x, y, z));
-            } else if (sv_eq(kind, sv_from_cstr("f"))) {
-                // TODO: This code assumes that we already parsed all of the vertices.
-                // Since we don't have any OBJ files in the assets that have faces before
-                // vertices, it does not really matter that much. If we ever have any
-                // of such OBJ files, it's easy to restructure this loop to support any
-                // order of the elements.
-                int v1, v2, v3, vt1, vt2, vt3, vn1, vn2, vn3;
-
-                int face_index = faces.count;
-
-                parse_face_triple(&line, &lf, &hf, &v1, &vt1, &vn1);
-                da_append(&vertices.items[v1].faces, face_index);
-
-                parse_face_triple(&line, &lf, &hf, &v2, &vt2, &vn2);
-                da_append(&vertices.items[v2].faces, face_index);
-
-                parse_face_triple(&line, &lf, &hf, &v3, &vt3, &vn3);
-                da_append(&vertices.items[v3].faces, face_index);
-
-                da_append(&faces, make_face(v1, v2, v3, vt1, vt2, vt3, vn1, vn2, vn3));
-            } else if (sv_eq(kind, sv_from_cstr("mtllib"))) {
+    size_t first_line_number = 0;
+    for (long i = 0; i < threads_count; ++i) {
+        Chunk *chunk = &chunks[i];
+        for (size_t j = 0; j < chunk->diagnostics.count; ++j) {
+            Diagnostic d = chunk->diagnostics.items[j];
+            size_t line_number = first_line_number + d.line_number;
+            switch (d.kind) {
+            case DIAGNOSTIC_MTLLIB:
                 fprintf(stderr, "%s:%zu: WARNING: mtllib is not supported yet. Ignoring it...\n", input_file_path, line_number);
-            } else if (sv_eq(kind, sv_from_cstr("usemtl"))) {
+                break;
+            case DIAGNOSTIC_USEMTL:
                 fprintf(stderr, "%s:%zu: WARNING: usemtl is not supported yet. Ignoring it...\n", input_file_path, line_number);
-            } else if (sv_eq(kind, sv_from_cstr("o"))) {
+                break;
+            case DIAGNOSTIC_SMOOTH_GROUPS:
+                fprintf(stderr, "%s:%zu: WARNING: smooth groups are not supported right now. Ignoring them...\n", input_file_path, line_number);
+                break;
+            case DIAGNOSTIC_OBJECT:
                 if (one_object_encountered) {
                     fprintf(stderr, "%s:%zu: ERROR: %s supports only one object as of right now.\n", input_file_path, line_number, program_name);
                     fprintf(stderr, "%s:%zu: NOTE: we already processing this object\n", input_file_path, one_object_line_number);
                     return_defer(1);
                 }
-                line = sv_trim_left(line);
-                String_View name = line;
-                fprintf(stderr, "%s:%zu: INFO: processing object `"SV_Fmt"`\n", input_file_path, line_number, SV_Arg(name));
+                fprintf(stderr, "%s:%zu: INFO: processing object `"SV_Fmt"`\n", input_file_path, line_number, SV_Arg(d.sv));
                 one_object_encountered = true;
                 one_object_line_number = line_number;
-            } else if (sv_eq(kind, sv_from_cstr("s"))) {
-                fprintf(stderr, "%s:%zu: WARNING: smooth groups are not supported right now. Ignoring them...\n", input_file_path, line_number);
-            } else if (sv_eq(kind, sv_from_cstr("vn"))) {
-                char *endptr;
-
-                line = sv_trim_left(line);
-                float x = strtof(line.data, &endptr);
-                sv_chop_left(&line, endptr - line.data);
-
-                line = sv_trim_left(line);
-                float y = strtof(line.data, &endptr);
-                sv_chop_left(&line, endptr - line.data);
-
-                line = sv_trim_left(line);
-                float z = strtof(line.data, &endptr);
-                sv_chop_left(&line, endptr - line.data);
-
-                da_append(&normals, make_vector3(x, y, z));
-            } else if (sv_eq(kind, sv_from_cstr("vt"))) {
-                char *endptr;
-
-                line = sv_trim_left(line);
-                float x = strtof(line.data, &endptr);
-                sv_chop_left(&line, endptr - line.data);
-
-                line = sv_trim_left(line);
-                float y = strtof(line.data, &endptr);
-                sv_chop_left(&line, endptr - line.data);
+                break;
+            case DIAGNOSTIC_UNKNOWN_KIND:
+                fprintf(stderr, "%s:%zu: ERROR: unknown kind of entry `"SV_Fmt"`\n", input_file_path, line_number, SV_Arg(d.sv));
+                return_defer(1);
+            }
+        }
+        first_line_number += chunk->lines_count;
+
+        da_append_many(&vertices, chunk->vertices.items, chunk->vertices.count);
+        da_append_many(&texcoords, chunk->texcoords.items, chunk->texcoords.count);
+        da_append_many(&normals, chunk->normals.items, chunk->normals.count);
+        da_append_many(&faces, chunk->faces.items, chunk->faces.count);
+        free(chunk->vertices.items);
+        free(chunk->texcoords.items);
+        free(chunk->normals.items);
+        free(chunk->faces.items);
+        free(chunk->diagnostics.items);
+        if (lx > chunk->lx) lx = chunk->lx;
+        if (hx < chunk->hx) hx = chunk->hx;
+        if (ly > chunk->ly) ly = chunk->ly;
+        if (hy < chunk->hy) hy = chunk->hy;
+        if (lz > chunk->lz) lz = chunk->lz;
+        if (hz < chunk->hz) hz = chunk->hz;
+        if (lf > chunk->lf) lf = chunk->lf;
+        if (hf < chunk->hf) hf = chunk->hf;
+    }
+    free(chunks);
+    free(threads);
 
-                da_append(&texcoords, make_vector2(x, y));
-            } else {
-                fprintf(stderr, "%s:%zu: ERROR: unknown kind of entry `"SV_Fmt"`\n", input_file_path, line_number, SV_Arg(kind));
+    // Faces may come before the vertices they use, so the indices are only checked after the merge.
+    // A corner without a texture coordinate or a normal keeps NO_ATTRIBUTE. It's only welded with the corners
+    // that don't have them either and gets zeros in the mesh. Any other index must refer to an existing one.
+    for (size_t i = 0; i < faces.count; ++i) {
+        Face f = faces.items[i];
+        for (size_t k = 0; k < VERTICES_PER_FACE; ++k) {
+            if (f.v[k] < 0 || (size_t) f.v[k] >= vertices.count) {
+                fprintf(stderr, "%s:%zu: ERROR: face refers to vertex %d, but there are only %zu vertices\n", input_file_path, face_line_number(sb_to_sv(buffer), i), f.v[k] + 1, vertices.count);
+                return_defer(1);
+            }
+            if (f.vt[k] != NO_ATTRIBUTE && (f.vt[k] < 0 || (size_t) f.vt[k] >= texcoords.count)) {
+                fprintf(stderr, "%s:%zu: ERROR: face refers to texture coordinate %d, but there are only %zu texture coordinates\n", input_file_path, face_line_number(sb_to_sv(buffer), i), f.vt[k] + 1, texcoords.count);
+                return_defer(1);
+            }
+            if (f.vn[k] != NO_ATTRIBUTE && (f.vn[k] < 0 || (size_t) f.vn[k] >= normals.count)) {
+                fprintf(stderr, "%s:%zu: ERROR: face refers to normal %d, but there are only %zu normals\n", input_file_path, face_line_number(sb_to_sv(buffer), i), f.vn[k] + 1, normals.count);
                 return_defer(1);
             }
         }
     }
 
+    // Connected components by breadth-first search over the faces of every vertex
+    Adjacency adjacency = build_adjacency(&faces.items->v[0], 3*VERTICES_PER_FACE, faces.count, vertices.count);
     int min_faces = INT_MAX;
     int max_faces = INT_MIN;
-
     for (size_t i = 0; i < vertices.count; ++i) {
-        int count = vertices.items[i].faces.count;
+        int count = adjacency.offsets[i + 1] - adjacency.offsets[i];
         if (min_faces > count) min_faces = count;
         if (max_faces < count) max_faces = count;
     }
 
     size_t comp_count = 0;
-    int start = unvisited_vertex(vertices);
-    while (start >= 0) {
+    int *queue = malloc(vertices.count*sizeof(*queue) + 1);
+    assert(queue != NULL);
+    for (size_t start = 0; start < vertices.count; ++start) {
+        if (vertices.items[start].component) continue;
         comp_count += 1;
 
-        Vertex_Indices wave = {0};
-        Vertex_Indices next_wave = {0};
-
-        da_append(&wave, start);
+        size_t head = 0, tail = 0;
+        queue[tail++] = start;
         vertices.items[start].component = comp_count;
-        while (wave.count > 0) {
-            for (size_t i = 0; i < wave.count; ++i) {
-                Vertex *vertex = &vertices.items[wave.items[i]];
-                for (size_t j = 0; j < vertex->faces.count; ++j) {
-                    for (size_t k = 0; k < VERTICES_PER_FACE; ++k) {
-                        int neighbor_index = faces.items[vertex->faces.items[j]].v[k];
-                        if (!vertices.items[neighbor_index].component) {
-                            da_append(&next_wave, neighbor_index);
-                            vertices.items[neighbor_index].component = comp_count;
-                        }
+        while (head < tail) {
+            int vertex = queue[head++];
+            for (int j = adjacency.offsets[vertex]; j < adjacency.offsets[vertex + 1]; ++j) {
+                for (size_t k = 0; k < VERTICES_PER_FACE; ++k) {
+                    int neighbor_index = faces.items[adjacency.triangles[j]].v[k];
+                    if (!vertices.items[neighbor_index].component) {
+                        queue[tail++] = neighbor_index;
+                        vertices.items[neighbor_index].component = comp_count;
                     }
                 }
             }
-            wave.count = 0;
-
-            Vertex_Indices temp = wave;
-            wave = next_wave;
-            next_wave = temp;
         }
-
-        start = unvisited_vertex(vertices);
     }
+    free(queue);
+    free_adjacency(adjacency);
 
     printf("Input:               %s\n", input_file_path);
-    printf("Output:              %s\n", output_file_path);
+    if (output_file_path) printf("Output:              %s\n", output_file_path);
+    if (binary_file_path) printf("Binary Output:       %s\n", binary_file_path);
     printf("Vertices:            %zu (x: %f..%f, y: %f..%f, z: %f..%f)\n", vertices.count, lx, hx, ly, hy, lz, hz);
     printf("Normals:             %zu\n", normals.count);
     printf("Texture Coordinates: %zu\n", texcoords.count);
@@ -477,12 +1270,70 @@ int main(int argc, char **argv)
         vertices.items[i].position = remap_object(vertices.items[i].position, scale, lx, hx, ly, hy, lz, hz);
     }
 
-    FILE *out = fopen(output_file_path, "wb");
-    if (out == NULL) {
-        fprintf(stderr, "ERROR: Could not write file %s: %s\n", output_file_path, strerror(errno));
-        return_defer(1);
+    Faces visible_faces = {0};
+    for (size_t i = 0; i < faces.count; ++i) {
+        if (!is_deleted_face(vertices, faces.items[i], delete_components)) {
+            da_append(&visible_faces, faces.items[i]);
+        }
+    }
+
+    Mesh mesh = {
+        .has_normals = normals.count > 0,
+        .has_texcoords = texcoords.count > 0,
+    };
+    mesh.stride = 3 + 3*mesh.has_normals + 2*mesh.has_texcoords;
+    weld_lod(&mesh, vertices, texcoords, normals, visible_faces, 0);
+
+    Simplifier simplifier = {
+        .has_normals = mesh.has_normals,
+        .has_texcoords = mesh.has_texcoords,
+    };
+    if (lods_count > 1) simplifier_init(&simplifier, vertices, visible_faces);
+    for (int i = 1; i < lods_count; ++i) {
+        size_t previous_count = simplifier.faces.count;
+        simplify(&simplifier, vertices, previous_count/2);
+        // Not worth another level if the mesh barely got any simpler
+        if (simplifier.faces.count > previous_count*3/4) break;
+        weld_lod(&mesh, vertices, texcoords, normals, simplifier.faces, sqrt(simplifier.max_error));
+    }
+
+    for (size_t i = 0; i < mesh.lods.count; ++i) {
+        Lod lod = mesh.lods.items[i];
+        int *indices = &mesh.indices.items[lod.first_index];
+        size_t indices_count = lod.triangles_count*VERTICES_PER_FACE;
+        float acmr = average_cache_miss_ratio(indices, indices_count);
+        if (reorder) {
+            tipsify(indices, indices_count, lod.vertices_count, VERTEX_CACHE_SIZE);
+            sort_vertices_by_first_use(&mesh, lod);
+        }
+        printf("LOD %zu:               %zu vertices, %zu faces, error %f, ACMR %.3f", i, lod.vertices_count, lod.triangles_count, lod.error, acmr);
+        if (reorder) printf(" -> %.3f", average_cache_miss_ratio(indices, indices_count));
+        printf("\n");
+    }
+
+    if (output_file_path) {
+        FILE *out = fopen(output_file_path, "wb");
+        if (out == NULL) {
+            fprintf(stderr, "ERROR: Could not write file %s: %s\n", output_file_path, strerror(errno));
+            return_defer(1);
+        }
+        generate_code(out, vertices, texcoords, normals, faces, delete_components, mesh);
+        fclose(out);
+    }
+
+    if (binary_file_path) {
+        FILE *out = fopen(binary_file_path, "wb");
+        if (out == NULL) {
+            fprintf(stderr, "ERROR: Could not write file %s: %s\n", binary_file_path, strerror(errno));
+            return_defer(1);
+        }
+        bool ok = generate_binary(out, mesh);
+        if (fclose(out) != 0) ok = false;
+        if (!ok) {
+            fprintf(stderr, "ERROR: Could not write file %s: %s\n", binary_file_path, strerror(errno));
+            return_defer(1);
+        }
     }
-    generate_code(out, vertices, texcoords, normals, faces, delete_components);
 
 defer:
     return result;